@@ -0,0 +1,28 @@
+#----------------------------------------------------------------
+# Generated CMake target import file for configuration "Debug".
+#----------------------------------------------------------------
+
+# Commands may need to know the format version.
+set(CMAKE_IMPORT_FILE_VERSION 1)
+
+# Import target "PaRSEC::parsec-ptgpp" for configuration "Debug"
+set_property(TARGET PaRSEC::parsec-ptgpp APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(PaRSEC::parsec-ptgpp PROPERTIES
+  IMPORTED_LOCATION_DEBUG "${_IMPORT_PREFIX}/bin/parsec-ptgpp"
+  )
+
+list(APPEND _cmake_import_check_targets PaRSEC::parsec-ptgpp )
+list(APPEND _cmake_import_check_files_for_PaRSEC::parsec-ptgpp "${_IMPORT_PREFIX}/bin/parsec-ptgpp" )
+
+# Import target "PaRSEC::parsec" for configuration "Debug"
+set_property(TARGET PaRSEC::parsec APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(PaRSEC::parsec PROPERTIES
+  IMPORTED_LOCATION_DEBUG "${_IMPORT_PREFIX}/lib/libparsec.so.4.1.0"
+  IMPORTED_SONAME_DEBUG "libparsec.so.4"
+  )
+
+list(APPEND _cmake_import_check_targets PaRSEC::parsec )
+list(APPEND _cmake_import_check_files_for_PaRSEC::parsec "${_IMPORT_PREFIX}/lib/libparsec.so.4.1.0" )
+
+# Commands beyond this point should not need to know the version.
+set(CMAKE_IMPORT_FILE_VERSION)
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/myfort.dir/my_module.f90.o"
+  "CMakeFiles/myfort.dir/my_sub.f.o"
+  "CMakeFiles/myfort.dir/mymodule.f90.o"
+  "CMakeFiles/myfort.dir/mysub.f.o"
+  "libmyfort.a"
+  "libmyfort.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang Fortran)
+  include(CMakeFiles/myfort.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
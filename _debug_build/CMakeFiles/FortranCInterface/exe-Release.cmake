@@ -0,0 +1 @@
+set(FortranCInterface_EXE "/root/repo/_debug_build/CMakeFiles/FortranCInterface/FortranCInterface")
@@ -0,0 +1,4 @@
+const char* mymodule$mysub(void)
+{
+  return "INFO:symbol[mymodule$mysub]";
+}
@@ -0,0 +1,487 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "/root/repo/CTestConfig.cmake"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeFortranCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "CMakeFiles/CheckStructureFieldOffset/PARSEC_LIFO_HEAD_OFFSET.c"
+  "CMakeFiles/FortranCInterface/Output.cmake"
+  "/root/repo/cmake_modules/AddDocumentedFiles.cmake"
+  "/root/repo/cmake_modules/CheckAtomicIntrinsic.cmake"
+  "/root/repo/cmake_modules/CheckStructureFieldOffset.c.in"
+  "/root/repo/cmake_modules/CheckStructureFieldOffset.cmake"
+  "/root/repo/cmake_modules/FindHWLOC.cmake"
+  "/root/repo/cmake_modules/FindPAPI.cmake"
+  "/root/repo/cmake_modules/Findlevel-zero.cmake"
+  "/root/repo/cmake_modules/PaRSECConfig.cmake.in"
+  "/root/repo/cmake_modules/ParsecCompilePTG.cmake"
+  "/root/repo/cmake_modules/ParsecCompilerFlags.cmake"
+  "/root/repo/contrib/build_with_parsec/CMakeLists.txt.in"
+  "/root/repo/contrib/build_with_parsec/Makefile.in"
+  "/root/repo/docs/CMakeLists.txt"
+  "/root/repo/examples/CMakeLists.txt"
+  "/root/repo/examples/interfaces/dtd/CMakeLists.txt"
+  "/root/repo/parsec/CMakeLists.txt"
+  "/root/repo/parsec/class/lifo-external.h.in"
+  "/root/repo/parsec/data_dist/CMakeLists.txt"
+  "/root/repo/parsec/data_dist/matrix/CMakeLists.txt"
+  "/root/repo/parsec/data_dist/matrix/redistribute/CMakeLists.txt"
+  "/root/repo/parsec/fortran/CMakeLists.txt"
+  "/root/repo/parsec/include/parsec.pc.in"
+  "/root/repo/parsec/include/parsec/parsec_config.h.in"
+  "/root/repo/parsec/include/parsec/parsec_options.h.in"
+  "/root/repo/parsec/interfaces/CMakeLists.txt"
+  "/root/repo/parsec/interfaces/dtd/CMakeLists.txt"
+  "/root/repo/parsec/interfaces/ptg/CMakeLists.txt"
+  "/root/repo/parsec/interfaces/ptg/ptg-compiler/CMakeLists.txt"
+  "/root/repo/parsec/mca/CMakeLists.txt"
+  "/root/repo/parsec/mca/device/CMakeLists.txt"
+  "/root/repo/parsec/mca/device/cuda/ValidateModule.CMake"
+  "/root/repo/parsec/mca/device/hip/ValidateModule.CMake"
+  "/root/repo/parsec/mca/device/level_zero/ValidateModule.CMake"
+  "/root/repo/parsec/mca/mca_static_components.h.in"
+  "/root/repo/parsec/mca/pins/CMakeLists.txt"
+  "/root/repo/parsec/mca/pins/alperf/ValidateModule.CMake"
+  "/root/repo/parsec/mca/pins/iterators_checker/ValidateModule.CMake"
+  "/root/repo/parsec/mca/pins/papi/ValidateModule.CMake"
+  "/root/repo/parsec/mca/pins/print_steals/ValidateModule.CMake"
+  "/root/repo/parsec/mca/pins/ptg_to_dtd/ValidateModule.CMake"
+  "/root/repo/parsec/mca/pins/task_profiler/ValidateModule.CMake"
+  "/root/repo/parsec/mca/sched/lhq/ValidateModule.CMake"
+  "/root/repo/tests/CMakeLists.txt"
+  "/root/repo/tests/Testings.cmake"
+  "/root/repo/tests/api/CMakeLists.txt"
+  "/root/repo/tests/api/Testings.cmake"
+  "/root/repo/tests/api/taskpool_wait/CMakeLists.txt"
+  "/root/repo/tests/apps/CMakeLists.txt"
+  "/root/repo/tests/apps/Testings.cmake"
+  "/root/repo/tests/apps/all2all/CMakeLists.txt"
+  "/root/repo/tests/apps/generalized_reduction/CMakeLists.txt"
+  "/root/repo/tests/apps/haar_tree/CMakeLists.txt"
+  "/root/repo/tests/apps/haar_tree/Testings.cmake"
+  "/root/repo/tests/apps/merge_sort/CMakeLists.txt"
+  "/root/repo/tests/apps/merge_sort/Testings.cmake"
+  "/root/repo/tests/apps/pingpong/CMakeLists.txt"
+  "/root/repo/tests/apps/pingpong/Testings.cmake"
+  "/root/repo/tests/apps/stencil/CMakeLists.txt"
+  "/root/repo/tests/apps/stencil/Testings.cmake"
+  "/root/repo/tests/class/CMakeLists.txt"
+  "/root/repo/tests/class/Testings.cmake"
+  "/root/repo/tests/collections/CMakeLists.txt"
+  "/root/repo/tests/collections/Testings.cmake"
+  "/root/repo/tests/collections/redistribute/CMakeLists.txt"
+  "/root/repo/tests/collections/reshape/CMakeLists.txt"
+  "/root/repo/tests/collections/two_dim_band/CMakeLists.txt"
+  "/root/repo/tests/dsl/dtd/CMakeLists.txt"
+  "/root/repo/tests/dsl/dtd/Testings.cmake"
+  "/root/repo/tests/dsl/ptg/CMakeLists.txt"
+  "/root/repo/tests/dsl/ptg/Testings.cmake"
+  "/root/repo/tests/dsl/ptg/branching/CMakeLists.txt"
+  "/root/repo/tests/dsl/ptg/branching/Testings.cmake"
+  "/root/repo/tests/dsl/ptg/choice/CMakeLists.txt"
+  "/root/repo/tests/dsl/ptg/controlgather/CMakeLists.txt"
+  "/root/repo/tests/dsl/ptg/local-indices/CMakeLists.txt"
+  "/root/repo/tests/dsl/ptg/multisize_bcast/CMakeLists.txt"
+  "/root/repo/tests/dsl/ptg/multisize_bcast/Testings.cmake"
+  "/root/repo/tests/dsl/ptg/ptgpp/CMakeLists.txt"
+  "/root/repo/tests/dsl/ptg/ptgpp/Testings.cmake"
+  "/root/repo/tests/dsl/ptg/user-defined-functions/CMakeLists.txt"
+  "/root/repo/tests/dsl/ptg/user-defined-functions/Testings.cmake"
+  "/root/repo/tests/profiling/Testings.cmake"
+  "/root/repo/tests/runtime/CMakeLists.txt"
+  "/root/repo/tests/runtime/Testings.cmake"
+  "/root/repo/tests/runtime/cuda/CMakeLists.txt"
+  "/root/repo/tests/runtime/cuda/Testings.cmake"
+  "/root/repo/tests/runtime/scheduling/CMakeLists.txt"
+  "/root/repo/tests/runtime/scheduling/Testings.cmake"
+  "/root/repo/tools/CMakeLists.txt"
+  "/root/repo/tools/aggregator_visu/CMakeLists.txt"
+  "/root/repo/tools/profiling/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/BasicConfigVersion-SameMajorVersion.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCheckCompilerFlagCommonPatterns.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDependentOption.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeFortranInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePackageConfigHelpers.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePushCheckState.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystem.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CPack.cmake"
+  "/usr/share/cmake-3.25/Modules/CPackComponent.cmake"
+  "/usr/share/cmake-3.25/Modules/CTest.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestTargets.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestUseLaunchers.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceRuns.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckFortranCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckFortranSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckFunctionExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFileCXX.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLanguage.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckStructHasMember.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckSymbolExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckTypeSize.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-Fortran.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/DartConfiguration.tcl.in"
+  "/usr/share/cmake-3.25/Modules/FindBISON.cmake"
+  "/usr/share/cmake-3.25/Modules/FindCUDAToolkit.cmake"
+  "/usr/share/cmake-3.25/Modules/FindFLEX.cmake"
+  "/usr/share/cmake-3.25/Modules/FindLibXml2.cmake"
+  "/usr/share/cmake-3.25/Modules/FindMPI.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPkgConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPython.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPython/Support.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/FortranCInterface.cmake"
+  "/usr/share/cmake-3.25/Modules/FortranCInterface/Detect.cmake"
+  "/usr/share/cmake-3.25/Modules/FortranCInterface/Input.cmake.in"
+  "/usr/share/cmake-3.25/Modules/FortranCInterface/Macro.h.in"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/InstallRequiredSystemLibraries.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckFlagCommonConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceRuns.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-Fortran.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/WriteBasicConfigVersionFile.cmake"
+  "/usr/share/cmake-3.25/Templates/CPackConfig.cmake.in"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "DartConfiguration.tcl"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "parsec/include/parsec/parsec_config.h"
+  "parsec/include/parsec/parsec_options.h"
+  "CMakeFiles/CheckStructureFieldOffset/PARSEC_LIFO_HEAD_OFFSET.c"
+  "parsec/class/lifo-external.h"
+  "parsec/include/parsec/parsec_options.h"
+  "CPackConfig.cmake"
+  "CPackSourceConfig.cmake"
+  "parsec/include/parsec.pc"
+  "CMakeFiles/PaRSECConfig.cmake"
+  "CMakeFiles/ParsecConfigVersion.cmake"
+  "parsec-submodule-config.cmake"
+  "contrib/build_with_parsec/Makefile"
+  "contrib/build_with_parsec/CMakeLists.txt"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/profiling/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/aggregator_visu/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "parsec/mca/mca_static_components.h"
+  "parsec/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "parsec/interfaces/ptg/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "parsec/interfaces/ptg/ptg-compiler/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "parsec/data_dist/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "parsec/data_dist/matrix/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "parsec/data_dist/matrix/redistribute/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "CMakeFiles/FortranCInterface/Input.cmake"
+  "parsec/fortran/f2c_mangle.h"
+  "parsec/fortran/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/class/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/api/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/api/taskpool_wait/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/runtime/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/runtime/scheduling/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/runtime/cuda/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/dsl/ptg/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/dsl/ptg/ptgpp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/dsl/ptg/branching/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/dsl/ptg/choice/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/dsl/ptg/controlgather/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/dsl/ptg/user-defined-functions/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/dsl/ptg/local-indices/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/dsl/ptg/multisize_bcast/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/collections/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/collections/two_dim_band/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/collections/redistribute/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/collections/reshape/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/dsl/dtd/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/apps/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/apps/pingpong/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/apps/all2all/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/apps/generalized_reduction/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/apps/stencil/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/apps/merge_sort/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/apps/haar_tree/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/interfaces/dtd/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "docs/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/Experimental.dir/DependInfo.cmake"
+  "CMakeFiles/Nightly.dir/DependInfo.cmake"
+  "CMakeFiles/Continuous.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemoryCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyStart.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyBuild.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyTest.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlySubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalStart.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalTest.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalSubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousStart.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousTest.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousSubmit.dir/DependInfo.cmake"
+  "CMakeFiles/build_with_parsec.dir/DependInfo.cmake"
+  "tools/aggregator_visu/CMakeFiles/parsec-reader.dir/DependInfo.cmake"
+  "parsec/CMakeFiles/parsec.dir/DependInfo.cmake"
+  "parsec/CMakeFiles/parsec-base-obj.dir/DependInfo.cmake"
+  "parsec/CMakeFiles/parsec-base.dir/DependInfo.cmake"
+  "parsec/interfaces/ptg/ptg-compiler/CMakeFiles/parsec-ptgpp.dir/DependInfo.cmake"
+  "parsec/data_dist/matrix/CMakeFiles/ptgpp_parsec.reduce_col.dir/DependInfo.cmake"
+  "parsec/data_dist/matrix/CMakeFiles/ptgpp_parsec.reduce_row.dir/DependInfo.cmake"
+  "parsec/data_dist/matrix/CMakeFiles/ptgpp_parsec.reduce.dir/DependInfo.cmake"
+  "parsec/data_dist/matrix/CMakeFiles/ptgpp_parsec.diag_band_to_rect.dir/DependInfo.cmake"
+  "parsec/data_dist/matrix/CMakeFiles/ptgpp_parsec.apply.dir/DependInfo.cmake"
+  "parsec/data_dist/matrix/CMakeFiles/ptgpp_parsec.matrix_io.dir/DependInfo.cmake"
+  "parsec/data_dist/matrix/CMakeFiles/ptgpp_parsec.replicated_reduce.dir/DependInfo.cmake"
+  "parsec/data_dist/matrix/redistribute/CMakeFiles/ptgpp_parsec.redistribute.dir/DependInfo.cmake"
+  "parsec/data_dist/matrix/redistribute/CMakeFiles/ptgpp_parsec.redistribute_reshuffle.dir/DependInfo.cmake"
+  "tests/CMakeFiles/parsec_build_tests.dir/DependInfo.cmake"
+  "tests/CMakeFiles/tests_common.dir/DependInfo.cmake"
+  "tests/class/CMakeFiles/atomics.dir/DependInfo.cmake"
+  "tests/class/CMakeFiles/rwlock.dir/DependInfo.cmake"
+  "tests/class/CMakeFiles/barrier.dir/DependInfo.cmake"
+  "tests/class/CMakeFiles/mpmc_ring.dir/DependInfo.cmake"
+  "tests/class/CMakeFiles/future.dir/DependInfo.cmake"
+  "tests/class/CMakeFiles/future_datacopy.dir/DependInfo.cmake"
+  "tests/class/CMakeFiles/lifo.dir/DependInfo.cmake"
+  "tests/class/CMakeFiles/list.dir/DependInfo.cmake"
+  "tests/class/CMakeFiles/hash.dir/DependInfo.cmake"
+  "tests/class/CMakeFiles/atomics_inline.dir/DependInfo.cmake"
+  "tests/class/CMakeFiles/rwlock_inline.dir/DependInfo.cmake"
+  "tests/class/CMakeFiles/lifo_inline.dir/DependInfo.cmake"
+  "tests/class/CMakeFiles/list_inline.dir/DependInfo.cmake"
+  "tests/class/CMakeFiles/hash_inline.dir/DependInfo.cmake"
+  "tests/api/CMakeFiles/touch_ex.dir/DependInfo.cmake"
+  "tests/api/CMakeFiles/ptgpp_touch_ex.touch.dir/DependInfo.cmake"
+  "tests/api/CMakeFiles/touch_ex_inline.dir/DependInfo.cmake"
+  "tests/api/CMakeFiles/ptgpp_touch_ex_inline.touch.dir/DependInfo.cmake"
+  "tests/api/CMakeFiles/touch_exf.dir/DependInfo.cmake"
+  "tests/api/CMakeFiles/ptgpp_touch_exf.touch.dir/DependInfo.cmake"
+  "tests/api/CMakeFiles/init_fini.dir/DependInfo.cmake"
+  "tests/api/CMakeFiles/operator.dir/DependInfo.cmake"
+  "tests/api/CMakeFiles/compose.dir/DependInfo.cmake"
+  "tests/api/taskpool_wait/CMakeFiles/taskpool_wait.dir/DependInfo.cmake"
+  "tests/api/taskpool_wait/CMakeFiles/ptgpp_taskpool_wait.ptg_tp.dir/DependInfo.cmake"
+  "tests/runtime/CMakeFiles/multichain.dir/DependInfo.cmake"
+  "tests/runtime/CMakeFiles/ptgpp_multichain.multichain.dir/DependInfo.cmake"
+  "tests/runtime/CMakeFiles/datatype_pack.dir/DependInfo.cmake"
+  "tests/runtime/CMakeFiles/comm_compress.dir/DependInfo.cmake"
+  "tests/runtime/CMakeFiles/remote_dep_ranks.dir/DependInfo.cmake"
+  "tests/runtime/CMakeFiles/remote_dep_link.dir/DependInfo.cmake"
+  "tests/runtime/CMakeFiles/tests_runtime_tiles.dir/DependInfo.cmake"
+  "tests/runtime/CMakeFiles/inplace.dir/DependInfo.cmake"
+  "tests/runtime/CMakeFiles/ptgpp_inplace.inplace.dir/DependInfo.cmake"
+  "tests/runtime/CMakeFiles/put_sched.dir/DependInfo.cmake"
+  "tests/runtime/CMakeFiles/ptgpp_put_sched.put_sched.dir/DependInfo.cmake"
+  "tests/runtime/CMakeFiles/host_placement.dir/DependInfo.cmake"
+  "tests/runtime/CMakeFiles/ptgpp_host_placement.host_placement.dir/DependInfo.cmake"
+  "tests/runtime/CMakeFiles/tcp_engine.dir/DependInfo.cmake"
+  "tests/runtime/CMakeFiles/ptgpp_tcp_engine.tcp_engine.dir/DependInfo.cmake"
+  "tests/runtime/CMakeFiles/dtt_bug_replicator.dir/DependInfo.cmake"
+  "tests/runtime/CMakeFiles/ptgpp_dtt_bug_replicator.dtt_bug_replicator.dir/DependInfo.cmake"
+  "tests/runtime/scheduling/CMakeFiles/schedmicro.dir/DependInfo.cmake"
+  "tests/runtime/scheduling/CMakeFiles/ptgpp_schedmicro.ep.dir/DependInfo.cmake"
+  "tests/runtime/scheduling/CMakeFiles/locality.dir/DependInfo.cmake"
+  "tests/runtime/scheduling/CMakeFiles/ptgpp_locality.locality.dir/DependInfo.cmake"
+  "tests/dsl/ptg/CMakeFiles/strange.dir/DependInfo.cmake"
+  "tests/dsl/ptg/CMakeFiles/ptgpp_strange.strange.dir/DependInfo.cmake"
+  "tests/dsl/ptg/CMakeFiles/recursive.dir/DependInfo.cmake"
+  "tests/dsl/ptg/CMakeFiles/ptgpp_recursive.recursive.dir/DependInfo.cmake"
+  "tests/dsl/ptg/CMakeFiles/startup.dir/DependInfo.cmake"
+  "tests/dsl/ptg/CMakeFiles/ptgpp_startup.startup.dir/DependInfo.cmake"
+  "tests/dsl/ptg/CMakeFiles/complex_deps.dir/DependInfo.cmake"
+  "tests/dsl/ptg/CMakeFiles/ptgpp_complex_deps.complex_deps.dir/DependInfo.cmake"
+  "tests/dsl/ptg/CMakeFiles/fusion.dir/DependInfo.cmake"
+  "tests/dsl/ptg/CMakeFiles/ptgpp_fusion.fusion.dir/DependInfo.cmake"
+  "tests/dsl/ptg/ptgpp/CMakeFiles/write_check.dir/DependInfo.cmake"
+  "tests/dsl/ptg/ptgpp/CMakeFiles/ptgpp_write_check.write_check.dir/DependInfo.cmake"
+  "tests/dsl/ptg/ptgpp/CMakeFiles/jdf_forward_RW_NULL.dir/DependInfo.cmake"
+  "tests/dsl/ptg/ptgpp/CMakeFiles/ptgpp_jdf_forward_RW_NULL.forward_RW_NULL.dir/DependInfo.cmake"
+  "tests/dsl/ptg/ptgpp/CMakeFiles/jdf_forward_READ_NULL.dir/DependInfo.cmake"
+  "tests/dsl/ptg/ptgpp/CMakeFiles/ptgpp_jdf_forward_READ_NULL.forward_READ_NULL.dir/DependInfo.cmake"
+  "tests/dsl/ptg/ptgpp/CMakeFiles/must_fail_too_many_in_deps.dir/DependInfo.cmake"
+  "tests/dsl/ptg/ptgpp/CMakeFiles/ptgpp_must_fail_too_many_in_deps.too_many_in_deps.dir/DependInfo.cmake"
+  "tests/dsl/ptg/ptgpp/CMakeFiles/must_fail_too_many_out_deps.dir/DependInfo.cmake"
+  "tests/dsl/ptg/ptgpp/CMakeFiles/ptgpp_must_fail_too_many_out_deps.too_many_out_deps.dir/DependInfo.cmake"
+  "tests/dsl/ptg/ptgpp/CMakeFiles/must_fail_too_many_read_flows.dir/DependInfo.cmake"
+  "tests/dsl/ptg/ptgpp/CMakeFiles/ptgpp_must_fail_too_many_read_flows.too_many_read_flows.dir/DependInfo.cmake"
+  "tests/dsl/ptg/ptgpp/CMakeFiles/must_fail_too_many_write_flows.dir/DependInfo.cmake"
+  "tests/dsl/ptg/ptgpp/CMakeFiles/ptgpp_must_fail_too_many_write_flows.too_many_write_flows.dir/DependInfo.cmake"
+  "tests/dsl/ptg/ptgpp/CMakeFiles/must_fail_too_many_local_vars.dir/DependInfo.cmake"
+  "tests/dsl/ptg/ptgpp/CMakeFiles/ptgpp_must_fail_too_many_local_vars.too_many_local_vars.dir/DependInfo.cmake"
+  "tests/dsl/ptg/branching/CMakeFiles/branching.dir/DependInfo.cmake"
+  "tests/dsl/ptg/branching/CMakeFiles/ptgpp_branching.branching.dir/DependInfo.cmake"
+  "tests/dsl/ptg/branching/CMakeFiles/branching_ht.dir/DependInfo.cmake"
+  "tests/dsl/ptg/branching/CMakeFiles/ptgpp_branching_ht.branching_ht.dir/DependInfo.cmake"
+  "tests/dsl/ptg/branching/CMakeFiles/branching_idxarr.dir/DependInfo.cmake"
+  "tests/dsl/ptg/branching/CMakeFiles/ptgpp_branching_idxarr.branching_idxarr.dir/DependInfo.cmake"
+  "tests/dsl/ptg/choice/CMakeFiles/choice.dir/DependInfo.cmake"
+  "tests/dsl/ptg/choice/CMakeFiles/ptgpp_choice.choice.dir/DependInfo.cmake"
+  "tests/dsl/ptg/controlgather/CMakeFiles/ctlgat.dir/DependInfo.cmake"
+  "tests/dsl/ptg/controlgather/CMakeFiles/ptgpp_ctlgat.ctlgat.dir/DependInfo.cmake"
+  "tests/dsl/ptg/user-defined-functions/CMakeFiles/udf.dir/DependInfo.cmake"
+  "tests/dsl/ptg/user-defined-functions/CMakeFiles/ptgpp_udf.udf.dir/DependInfo.cmake"
+  "tests/dsl/ptg/user-defined-functions/CMakeFiles/utt.dir/DependInfo.cmake"
+  "tests/dsl/ptg/user-defined-functions/CMakeFiles/ptgpp_utt.utt.dir/DependInfo.cmake"
+  "tests/dsl/ptg/local-indices/CMakeFiles/local_indices.dir/DependInfo.cmake"
+  "tests/dsl/ptg/local-indices/CMakeFiles/ptgpp_local_indices.local_indices.dir/DependInfo.cmake"
+  "tests/dsl/ptg/multisize_bcast/CMakeFiles/check_multisize_bcast.dir/DependInfo.cmake"
+  "tests/dsl/ptg/multisize_bcast/CMakeFiles/ptgpp_check_multisize_bcast.check_multisize_bcast.dir/DependInfo.cmake"
+  "tests/collections/CMakeFiles/reduce.dir/DependInfo.cmake"
+  "tests/collections/CMakeFiles/matrix_io.dir/DependInfo.cmake"
+  "tests/collections/CMakeFiles/replicated.dir/DependInfo.cmake"
+  "tests/collections/CMakeFiles/kcyclic.dir/DependInfo.cmake"
+  "tests/collections/CMakeFiles/ptgpp_kcyclic.kcyclic.dir/DependInfo.cmake"
+  "tests/collections/two_dim_band/CMakeFiles/testing_band.dir/DependInfo.cmake"
+  "tests/collections/two_dim_band/CMakeFiles/ptgpp_testing_band.two_dim_band.dir/DependInfo.cmake"
+  "tests/collections/two_dim_band/CMakeFiles/ptgpp_testing_band.two_dim_band_free.dir/DependInfo.cmake"
+  "tests/collections/redistribute/CMakeFiles/testing_redistribute.dir/DependInfo.cmake"
+  "tests/collections/redistribute/CMakeFiles/ptgpp_testing_redistribute.redistribute_check.dir/DependInfo.cmake"
+  "tests/collections/redistribute/CMakeFiles/ptgpp_testing_redistribute.redistribute_check2.dir/DependInfo.cmake"
+  "tests/collections/redistribute/CMakeFiles/ptgpp_testing_redistribute.redistribute_bound.dir/DependInfo.cmake"
+  "tests/collections/redistribute/CMakeFiles/ptgpp_testing_redistribute.redistribute_no_optimization.dir/DependInfo.cmake"
+  "tests/collections/redistribute/CMakeFiles/testing_redistribute_random.dir/DependInfo.cmake"
+  "tests/collections/redistribute/CMakeFiles/ptgpp_testing_redistribute_random.redistribute_check.dir/DependInfo.cmake"
+  "tests/collections/redistribute/CMakeFiles/ptgpp_testing_redistribute_random.redistribute_check2.dir/DependInfo.cmake"
+  "tests/collections/redistribute/CMakeFiles/ptgpp_testing_redistribute_random.redistribute_bound.dir/DependInfo.cmake"
+  "tests/collections/redistribute/CMakeFiles/ptgpp_testing_redistribute_random.redistribute_no_optimization.dir/DependInfo.cmake"
+  "tests/collections/redistribute/CMakeFiles/testing_rebalance.dir/DependInfo.cmake"
+  "tests/collections/reshape/CMakeFiles/reshape.dir/DependInfo.cmake"
+  "tests/collections/reshape/CMakeFiles/ptgpp_reshape.local_no_reshape.dir/DependInfo.cmake"
+  "tests/collections/reshape/CMakeFiles/ptgpp_reshape.local_read_reshape.dir/DependInfo.cmake"
+  "tests/collections/reshape/CMakeFiles/ptgpp_reshape.local_output_reshape.dir/DependInfo.cmake"
+  "tests/collections/reshape/CMakeFiles/ptgpp_reshape.local_input_reshape.dir/DependInfo.cmake"
+  "tests/collections/reshape/CMakeFiles/ptgpp_reshape.remote_read_reshape.dir/DependInfo.cmake"
+  "tests/collections/reshape/CMakeFiles/ptgpp_reshape.remote_no_re_reshape.dir/DependInfo.cmake"
+  "tests/collections/reshape/CMakeFiles/ptgpp_reshape.local_input_LU_LL.dir/DependInfo.cmake"
+  "tests/collections/reshape/CMakeFiles/ptgpp_reshape.local_view_reshape.dir/DependInfo.cmake"
+  "tests/collections/reshape/CMakeFiles/input_dep_reshape_single_copy.dir/DependInfo.cmake"
+  "tests/collections/reshape/CMakeFiles/ptgpp_input_dep_reshape_single_copy.input_dep_single_copy_reshape.dir/DependInfo.cmake"
+  "tests/collections/reshape/CMakeFiles/remote_multiple_outs_same_pred_flow.dir/DependInfo.cmake"
+  "tests/collections/reshape/CMakeFiles/ptgpp_remote_multiple_outs_same_pred_flow.remote_multiple_outs_same_pred_flow.dir/DependInfo.cmake"
+  "tests/collections/reshape/CMakeFiles/ptgpp_remote_multiple_outs_same_pred_flow.remote_multiple_outs_same_pred_flow_multiple_deps.dir/DependInfo.cmake"
+  "tests/collections/reshape/CMakeFiles/avoidable_reshape.dir/DependInfo.cmake"
+  "tests/collections/reshape/CMakeFiles/ptgpp_avoidable_reshape.avoidable_reshape.dir/DependInfo.cmake"
+  "tests/collections/reshape/CMakeFiles/ptgpp_avoidable_reshape.local_reuse_reshape.dir/DependInfo.cmake"
+  "tests/dsl/dtd/CMakeFiles/dtd_test_empty.dir/DependInfo.cmake"
+  "tests/dsl/dtd/CMakeFiles/dtd_test_pingpong.dir/DependInfo.cmake"
+  "tests/dsl/dtd/CMakeFiles/dtd_test_task_generation.dir/DependInfo.cmake"
+  "tests/dsl/dtd/CMakeFiles/dtd_test_war.dir/DependInfo.cmake"
+  "tests/dsl/dtd/CMakeFiles/dtd_test_task_insertion.dir/DependInfo.cmake"
+  "tests/dsl/dtd/CMakeFiles/dtd_test_null_as_tile.dir/DependInfo.cmake"
+  "tests/dsl/dtd/CMakeFiles/dtd_test_task_inserting_task.dir/DependInfo.cmake"
+  "tests/dsl/dtd/CMakeFiles/dtd_test_flag_dont_track.dir/DependInfo.cmake"
+  "tests/dsl/dtd/CMakeFiles/dtd_test_multiple_handle_wait.dir/DependInfo.cmake"
+  "tests/dsl/dtd/CMakeFiles/dtd_test_broadcast.dir/DependInfo.cmake"
+  "tests/dsl/dtd/CMakeFiles/dtd_test_reduce.dir/DependInfo.cmake"
+  "tests/dsl/dtd/CMakeFiles/dtd_test_allreduce.dir/DependInfo.cmake"
+  "tests/dsl/dtd/CMakeFiles/dtd_test_template_counter.dir/DependInfo.cmake"
+  "tests/dsl/dtd/CMakeFiles/dtd_test_untie.dir/DependInfo.cmake"
+  "tests/dsl/dtd/CMakeFiles/dtd_test_hierarchy.dir/DependInfo.cmake"
+  "tests/dsl/dtd/CMakeFiles/dtd_test_task_placement.dir/DependInfo.cmake"
+  "tests/dsl/dtd/CMakeFiles/dtd_test_insert_task_interface.dir/DependInfo.cmake"
+  "tests/dsl/dtd/CMakeFiles/dtd_test_data_flush.dir/DependInfo.cmake"
+  "tests/dsl/dtd/CMakeFiles/dtd_test_global_id_for_dc_assumed.dir/DependInfo.cmake"
+  "tests/dsl/dtd/CMakeFiles/dtd_test_explicit_task_creation.dir/DependInfo.cmake"
+  "tests/dsl/dtd/CMakeFiles/dtd_test_tp_enqueue_dequeue.dir/DependInfo.cmake"
+  "tests/dsl/dtd/CMakeFiles/dtd_test_interleave_actions.dir/DependInfo.cmake"
+  "tests/dsl/dtd/CMakeFiles/dtd_test_ce.dir/DependInfo.cmake"
+  "tests/dsl/dtd/CMakeFiles/dtd_test_new_tile.dir/DependInfo.cmake"
+  "tests/apps/pingpong/CMakeFiles/rtt.dir/DependInfo.cmake"
+  "tests/apps/pingpong/CMakeFiles/ptgpp_rtt.rtt.dir/DependInfo.cmake"
+  "tests/apps/pingpong/CMakeFiles/bw_test.dir/DependInfo.cmake"
+  "tests/apps/pingpong/CMakeFiles/ptgpp_bw_test.bandwidth.dir/DependInfo.cmake"
+  "tests/apps/all2all/CMakeFiles/a2a.dir/DependInfo.cmake"
+  "tests/apps/all2all/CMakeFiles/ptgpp_a2a.a2a.dir/DependInfo.cmake"
+  "tests/apps/generalized_reduction/CMakeFiles/BT_reduction.dir/DependInfo.cmake"
+  "tests/apps/generalized_reduction/CMakeFiles/ptgpp_BT_reduction.BT_reduction.dir/DependInfo.cmake"
+  "tests/apps/stencil/CMakeFiles/testing_stencil_1D.dir/DependInfo.cmake"
+  "tests/apps/stencil/CMakeFiles/ptgpp_testing_stencil_1D.stencil_1D.dir/DependInfo.cmake"
+  "tests/apps/merge_sort/CMakeFiles/merge_sort.dir/DependInfo.cmake"
+  "tests/apps/merge_sort/CMakeFiles/ptgpp_merge_sort.merge_sort.dir/DependInfo.cmake"
+  "tests/apps/haar_tree/CMakeFiles/project.dir/DependInfo.cmake"
+  "tests/apps/haar_tree/CMakeFiles/ptgpp_project.project.dir/DependInfo.cmake"
+  "tests/apps/haar_tree/CMakeFiles/ptgpp_project.walk.dir/DependInfo.cmake"
+  "tests/apps/haar_tree/CMakeFiles/project_dyn.dir/DependInfo.cmake"
+  "tests/apps/haar_tree/CMakeFiles/ptgpp_project_dyn.project_dyn.dir/DependInfo.cmake"
+  "tests/apps/haar_tree/CMakeFiles/ptgpp_project_dyn.walk.dir/DependInfo.cmake"
+  "examples/CMakeFiles/ex00.dir/DependInfo.cmake"
+  "examples/CMakeFiles/ex01.dir/DependInfo.cmake"
+  "examples/CMakeFiles/ptgpp_ex01.Ex01_HelloWorld.dir/DependInfo.cmake"
+  "examples/CMakeFiles/ex02.dir/DependInfo.cmake"
+  "examples/CMakeFiles/ptgpp_ex02.Ex02_Chain.dir/DependInfo.cmake"
+  "examples/CMakeFiles/ex03.dir/DependInfo.cmake"
+  "examples/CMakeFiles/ptgpp_ex03.Ex03_ChainMPI.dir/DependInfo.cmake"
+  "examples/CMakeFiles/ex04.dir/DependInfo.cmake"
+  "examples/CMakeFiles/ptgpp_ex04.Ex04_ChainData.dir/DependInfo.cmake"
+  "examples/CMakeFiles/ex05.dir/DependInfo.cmake"
+  "examples/CMakeFiles/ptgpp_ex05.Ex05_Broadcast.dir/DependInfo.cmake"
+  "examples/CMakeFiles/ex06.dir/DependInfo.cmake"
+  "examples/CMakeFiles/ptgpp_ex06.Ex06_RAW.dir/DependInfo.cmake"
+  "examples/CMakeFiles/ex07.dir/DependInfo.cmake"
+  "examples/CMakeFiles/ptgpp_ex07.Ex07_RAW_CTL.dir/DependInfo.cmake"
+  "examples/interfaces/dtd/CMakeFiles/dtd_example_hello_world.dir/DependInfo.cmake"
+  "examples/interfaces/dtd/CMakeFiles/dtd_example_hello_arg.dir/DependInfo.cmake"
+  "examples/interfaces/dtd/CMakeFiles/dtd_example_hello_world_untied.dir/DependInfo.cmake"
+  "docs/CMakeFiles/docs-parsec.dir/DependInfo.cmake"
+  "docs/CMakeFiles/docs.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/build_with_parsec"
+  "contrib/build_with_parsec/dtd_test_allreduce.c"
+  "contrib/build_with_parsec/write_check.cu"
+  "contrib/build_with_parsec/write_check.jdf"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/build_with_parsec.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo
+# Build directory: /root/repo/_debug_build
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[launcher:shm]=] "/usr/bin/hostname")
+set_tests_properties([=[launcher:shm]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;991;add_test;/root/repo/CMakeLists.txt;0;")
+add_test([=[launcher:mpi]=] "/usr/bin/mpiexec" "-n" "4" "/usr/bin/hostname")
+set_tests_properties([=[launcher:mpi]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;993;add_test;/root/repo/CMakeLists.txt;0;")
+subdirs("tools")
+subdirs("parsec")
+subdirs("tests")
+subdirs("examples")
+subdirs("docs")
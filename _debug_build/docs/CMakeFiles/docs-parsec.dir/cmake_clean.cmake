@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/docs-parsec"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/docs-parsec.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
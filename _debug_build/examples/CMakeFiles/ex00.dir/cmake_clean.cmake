@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ex00.dir/Ex00_StartStop.c.o"
+  "CMakeFiles/ex00.dir/Ex00_StartStop.c.o.d"
+  "ex00"
+  "ex00.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ex00.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
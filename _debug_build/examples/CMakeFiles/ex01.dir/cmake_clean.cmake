@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ex01.dir/Ex01_HelloWorld.c.o"
+  "CMakeFiles/ex01.dir/Ex01_HelloWorld.c.o.d"
+  "ex01"
+  "ex01.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ex01.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
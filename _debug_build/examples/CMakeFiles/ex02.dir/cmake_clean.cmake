@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ex02.dir/Ex02_Chain.c.o"
+  "CMakeFiles/ex02.dir/Ex02_Chain.c.o.d"
+  "ex02"
+  "ex02.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ex02.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
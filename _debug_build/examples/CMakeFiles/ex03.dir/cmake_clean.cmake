@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ex03.dir/Ex03_ChainMPI.c.o"
+  "CMakeFiles/ex03.dir/Ex03_ChainMPI.c.o.d"
+  "ex03"
+  "ex03.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ex03.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ex04.dir/Ex04_ChainData.c.o"
+  "CMakeFiles/ex04.dir/Ex04_ChainData.c.o.d"
+  "ex04"
+  "ex04.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ex04.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
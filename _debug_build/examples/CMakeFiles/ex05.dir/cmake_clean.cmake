@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ex05.dir/Ex05_Broadcast.c.o"
+  "CMakeFiles/ex05.dir/Ex05_Broadcast.c.o.d"
+  "ex05"
+  "ex05.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ex05.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
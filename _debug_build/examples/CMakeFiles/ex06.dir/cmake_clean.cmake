@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ex06.dir/Ex06_RAW.c.o"
+  "CMakeFiles/ex06.dir/Ex06_RAW.c.o.d"
+  "ex06"
+  "ex06.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ex06.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ex07.dir/Ex07_RAW_CTL.c.o"
+  "CMakeFiles/ex07.dir/Ex07_RAW_CTL.c.o.d"
+  "ex07"
+  "ex07.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ex07.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
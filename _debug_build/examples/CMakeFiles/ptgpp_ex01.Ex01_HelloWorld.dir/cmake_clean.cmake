@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ptgpp_ex01.Ex01_HelloWorld"
+  "Ex01_HelloWorld.c"
+  "Ex01_HelloWorld.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ptgpp_ex01.Ex01_HelloWorld.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ptgpp_ex02.Ex02_Chain"
+  "Ex02_Chain.c"
+  "Ex02_Chain.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ptgpp_ex02.Ex02_Chain.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
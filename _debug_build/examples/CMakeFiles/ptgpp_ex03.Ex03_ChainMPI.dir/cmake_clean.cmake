@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ptgpp_ex03.Ex03_ChainMPI"
+  "Ex03_ChainMPI.c"
+  "Ex03_ChainMPI.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ptgpp_ex03.Ex03_ChainMPI.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
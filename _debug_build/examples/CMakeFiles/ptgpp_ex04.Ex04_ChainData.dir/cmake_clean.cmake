@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ptgpp_ex04.Ex04_ChainData"
+  "Ex04_ChainData.c"
+  "Ex04_ChainData.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ptgpp_ex04.Ex04_ChainData.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ptgpp_ex05.Ex05_Broadcast"
+  "Ex05_Broadcast.c"
+  "Ex05_Broadcast.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ptgpp_ex05.Ex05_Broadcast.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
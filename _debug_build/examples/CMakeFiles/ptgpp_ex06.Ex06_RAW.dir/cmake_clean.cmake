@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ptgpp_ex06.Ex06_RAW"
+  "Ex06_RAW.c"
+  "Ex06_RAW.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ptgpp_ex06.Ex06_RAW.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
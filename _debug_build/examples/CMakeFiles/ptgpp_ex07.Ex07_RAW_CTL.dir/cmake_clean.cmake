@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ptgpp_ex07.Ex07_RAW_CTL"
+  "Ex07_RAW_CTL.c"
+  "Ex07_RAW_CTL.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ptgpp_ex07.Ex07_RAW_CTL.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
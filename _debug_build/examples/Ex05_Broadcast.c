@@ -0,0 +1,1885 @@
+#include "parsec.h"
+#include "parsec/parsec_internal.h"
+#include "parsec/ayudame.h"
+#include "parsec/execution_stream.h"
+#include "parsec/parsec_binary_profile.h"
+#include "parsec/mca/device/device_gpu.h"
+#if defined(PARSEC_HAVE_DEV_CUDA_SUPPORT)
+#include "parsec/mca/device/cuda/device_cuda.h"
+#endif  /* defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) */
+#if defined(PARSEC_HAVE_DEV_HIP_SUPPORT)
+#include "parsec/mca/device/hip/device_hip.h"
+#endif  /* defined(PARSEC_HAVE_DEV_HIP_SUPPORT) */
+#if defined(_MSC_VER) || defined(__MINGW32__)
+#  include <malloc.h>
+#else
+#  include <alloca.h>
+#endif  /* defined(_MSC_VER) || defined(__MINGW32__) */
+
+#define PARSEC_Ex05_Broadcast_NB_TASK_CLASSES 2
+#define PARSEC_Ex05_Broadcast_NB_DATA 1
+
+typedef struct __parsec_Ex05_Broadcast_internal_taskpool_s __parsec_Ex05_Broadcast_internal_taskpool_t;
+struct parsec_Ex05_Broadcast_internal_taskpool_s;
+
+/** Predeclarations of the parsec_task_class_t */
+static const parsec_task_class_t Ex05_Broadcast_TaskRecv;
+static const parsec_task_class_t Ex05_Broadcast_TaskBcast;
+/** Predeclarations of the parameters */
+static const parsec_flow_t flow_of_Ex05_Broadcast_TaskRecv_for_A;
+static const parsec_flow_t flow_of_Ex05_Broadcast_TaskBcast_for_A;
+
+/**
+ * This example shows how to use execution spaces and broadcast information
+ *    Global properties
+ *    inline
+ *
+ * Each process broadcast an information to NB/2 tasks.
+ *
+ * @version 4.0
+ * @email parsec-users@icl.utk.edu
+ *
+ */
+
+#include "parsec.h"
+
+#define PARSEC_Ex05_Broadcast_DEFAULT_ADT    (&__parsec_tp->super.arenas_datatypes[PARSEC_Ex05_Broadcast_DEFAULT_ADT_IDX])
+#include "Ex05_Broadcast.h"
+
+struct __parsec_Ex05_Broadcast_internal_taskpool_s {
+ parsec_Ex05_Broadcast_taskpool_t super;
+ volatile int32_t sync_point;
+ volatile int32_t initial_number_tasks;
+ parsec_task_t* startup_queue;
+  /* The ranges to compute the hash key */
+  int TaskRecv_k_min;
+  int TaskRecv_k_range;
+  int TaskRecv_n_min;
+  int TaskRecv_n_range;
+  int TaskBcast_k_min;
+  int TaskBcast_k_range;
+  /* The list of data repositories  TaskBcast */
+  data_repo_t* repositories[2];
+};
+
+#if defined(PARSEC_PROF_TRACE)
+#  if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+static int Ex05_Broadcast_profiling_array[4*PARSEC_Ex05_Broadcast_NB_TASK_CLASSES] = {-2}; /* 2 pairs (begin, end) per task, times two because each task class has an internal_init task */
+#  else /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+static int Ex05_Broadcast_profiling_array[2*PARSEC_Ex05_Broadcast_NB_TASK_CLASSES] = {-2}; /* 2 pairs (begin, end) per task */
+#  endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+#endif  /* defined(PARSEC_PROF_TRACE) */
+/* Globals */
+#define mydata __parsec_tp->super._g_mydata
+#define nodes (__parsec_tp->super._g_nodes)
+#define rank (__parsec_tp->super._g_rank)
+#define NB (__parsec_tp->super._g_NB)
+
+static inline int parsec_imin(int a, int b) { return (a <= b) ? a : b; };
+
+static inline int parsec_imax(int a, int b) { return (a >= b) ? a : b; };
+
+static inline int32_t Ex05_Broadcast_TaskRecv_inline_c_expr1_line_48(const __parsec_Ex05_Broadcast_internal_taskpool_t *__parsec_tp, const __parsec_Ex05_Broadcast_TaskRecv_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task TaskRecv */
+  const int k = assignments->k.value; (void)k;
+  const int n = assignments->n.value; (void)n;
+  const int loc = assignments->loc.value; (void)loc;
+
+  (void)k;  (void)n;  (void)loc;
+
+ return k + n; 
+}
+
+static inline int32_t Ex05_Broadcast_TaskRecv_inline_c_expr2_line_46(const __parsec_Ex05_Broadcast_internal_taskpool_t *__parsec_tp, const __parsec_Ex05_Broadcast_TaskRecv_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task TaskRecv */
+  const int k = assignments->k.value; (void)k;
+  const int n = assignments->n.value; (void)n;
+  const int loc = assignments->loc.value; (void)loc;
+
+  (void)k;  (void)n;  (void)loc;
+
+ return nodes-1; 
+}
+
+static inline int32_t Ex05_Broadcast_TaskBcast_inline_c_expr3_line_27(const __parsec_Ex05_Broadcast_internal_taskpool_t *__parsec_tp, const __parsec_Ex05_Broadcast_TaskBcast_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task TaskBcast */
+  const int k = assignments->k.value; (void)k;
+
+  (void)k;
+
+ return nodes-1; 
+}
+
+/* Data Access Macros */
+#define data_of_mydata(mydata_d0)  (((parsec_data_collection_t*)__parsec_tp->super._g_mydata)->data_of((parsec_data_collection_t*)__parsec_tp->super._g_mydata, (mydata_d0)))
+
+#define rank_of_mydata(mydata_d0)  (((parsec_data_collection_t*)__parsec_tp->super._g_mydata)->rank_of((parsec_data_collection_t*)__parsec_tp->super._g_mydata, (mydata_d0)))
+
+/* Functions Predicates */
+#define TaskRecv_pred(k, n, loc) (((parsec_data_collection_t*)(__parsec_tp->super._g_mydata))->myrank == rank_of_mydata(loc))
+#define TaskBcast_pred(k) (((parsec_data_collection_t*)(__parsec_tp->super._g_mydata))->myrank == rank_of_mydata(k))
+
+/* Data Repositories */
+#define TaskRecv_repo (__parsec_tp->repositories[1])
+#define TaskBcast_repo (__parsec_tp->repositories[0])
+/* Release dependencies output macro */
+#if defined(PARSEC_DEBUG_NOISIER)
+#define RELEASE_DEP_OUTPUT(ES, DEPO, TASKO, DEPI, TASKI, RSRC, RDST, DATA)\
+  do { \
+    char tmp1[128], tmp2[128]; (void)tmp1; (void)tmp2;\
+    PARSEC_DEBUG_VERBOSE(20, parsec_debug_output, "thread %d VP %d explore deps from %s:%s to %s:%s (from rank %d to %d) base ptr %p",\
+           (NULL != (ES) ? (ES)->th_id : -1), (NULL != (ES) ? (ES)->virtual_process->vp_id : -1),\
+           DEPO, parsec_task_snprintf(tmp1, 128, (parsec_task_t*)(TASKO)),\
+           DEPI, parsec_task_snprintf(tmp2, 128, (parsec_task_t*)(TASKI)), (RSRC), (RDST), (DATA));\
+  } while(0)
+#define ACQUIRE_FLOW(TASKI, DEPI, FUNO, DEPO, LOCALS, PTR)\
+  do { \
+    char tmp1[128], tmp2[128]; (void)tmp1; (void)tmp2;\
+    PARSEC_DEBUG_VERBOSE(20, parsec_debug_output, "task %s acquires flow %s from %s %s data ptr %p",\
+           parsec_task_snprintf(tmp1, 128, (parsec_task_t*)(TASKI)), (DEPI),\
+           (DEPO), parsec_snprintf_assignments(tmp2, 128, (FUNO), (parsec_assignment_t*)(LOCALS)), (PTR));\
+  } while(0)
+#else
+#define RELEASE_DEP_OUTPUT(ES, DEPO, TASKO, DEPI, TASKI, RSRC, RDST, DATA)
+#define ACQUIRE_FLOW(TASKI, DEPI, TASKO, DEPO, LOCALS, PTR)
+#endif
+static inline parsec_key_t __jdf2c_make_key_TaskRecv(const parsec_taskpool_t *tp, const parsec_assignment_t *as)
+{
+  const __parsec_Ex05_Broadcast_internal_taskpool_t *__parsec_tp = (const __parsec_Ex05_Broadcast_internal_taskpool_t *)tp;
+  const __parsec_Ex05_Broadcast_TaskRecv_parsec_assignment_t *assignment = (const __parsec_Ex05_Broadcast_TaskRecv_parsec_assignment_t*)as;
+  uint64_t __parsec_id = 0;
+  __parsec_id += (assignment->k.value - __parsec_tp->TaskRecv_k_min);
+  __parsec_id += (assignment->n.value - __parsec_tp->TaskRecv_n_min) * __parsec_tp->TaskRecv_k_range;
+  return (parsec_key_t)__parsec_id;
+}
+static char *__jdf2c_key_fns_TaskRecv_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_Ex05_Broadcast_internal_taskpool_t *__parsec_tp = (__parsec_Ex05_Broadcast_internal_taskpool_t *)user_data;
+  __parsec_Ex05_Broadcast_TaskRecv_parsec_assignment_t __jdf2c__assignments = {  .k.value = 0, .n.value = 0, .loc.value = 0 };
+  int k = (__parsec_key) % __parsec_tp->TaskRecv_k_range + __parsec_tp->TaskRecv_k_min;
+  __parsec_key = __parsec_key / __parsec_tp->TaskRecv_k_range;
+  __jdf2c__assignments.k.value = k;
+  int n = (__parsec_key) % __parsec_tp->TaskRecv_n_range + __parsec_tp->TaskRecv_n_min;
+  __parsec_key = __parsec_key / __parsec_tp->TaskRecv_n_range;
+  __jdf2c__assignments.n.value = n;
+  int loc = Ex05_Broadcast_TaskRecv_inline_c_expr1_line_48(__parsec_tp, &__jdf2c__assignments);
+  (void)loc;
+  __jdf2c__assignments.loc.value = loc;
+  (void)__jdf2c__assignments;
+  snprintf(buffer, buffer_size, "TaskRecv(%d, %d)", k, n);
+  return buffer;
+}
+
+static parsec_key_fn_t __jdf2c_key_fns_TaskRecv = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = __jdf2c_key_fns_TaskRecv_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+static inline parsec_key_t __jdf2c_make_key_TaskBcast(const parsec_taskpool_t *tp, const parsec_assignment_t *as)
+{
+  const __parsec_Ex05_Broadcast_internal_taskpool_t *__parsec_tp = (const __parsec_Ex05_Broadcast_internal_taskpool_t *)tp;
+  const __parsec_Ex05_Broadcast_TaskBcast_parsec_assignment_t *assignment = (const __parsec_Ex05_Broadcast_TaskBcast_parsec_assignment_t*)as;
+  uint64_t __parsec_id = 0;
+  __parsec_id += (assignment->k.value - __parsec_tp->TaskBcast_k_min);
+  return (parsec_key_t)__parsec_id;
+}
+static char *__jdf2c_key_fns_TaskBcast_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_Ex05_Broadcast_internal_taskpool_t *__parsec_tp = (__parsec_Ex05_Broadcast_internal_taskpool_t *)user_data;
+  __parsec_Ex05_Broadcast_TaskBcast_parsec_assignment_t __jdf2c__assignments = {  .k.value = 0 };
+  int k = (__parsec_key) % __parsec_tp->TaskBcast_k_range + __parsec_tp->TaskBcast_k_min;
+  __parsec_key = __parsec_key / __parsec_tp->TaskBcast_k_range;
+  __jdf2c__assignments.k.value = k;
+  (void)__jdf2c__assignments;
+  snprintf(buffer, buffer_size, "TaskBcast(%d)", k);
+  return buffer;
+}
+
+static parsec_key_fn_t __jdf2c_key_fns_TaskBcast = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = __jdf2c_key_fns_TaskBcast_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/******                                    TaskRecv                                    ******/
+
+static inline int32_t minexpr_of_symb_Ex05_Broadcast_TaskRecv_k_fct(const __parsec_Ex05_Broadcast_internal_taskpool_t *__parsec_tp, const __parsec_Ex05_Broadcast_TaskRecv_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_Ex05_Broadcast_TaskRecv_k = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_Ex05_Broadcast_TaskRecv_k_fct }
+                   }
+};
+static inline int32_t maxexpr_of_symb_Ex05_Broadcast_TaskRecv_k_fct(const __parsec_Ex05_Broadcast_internal_taskpool_t *__parsec_tp, const __parsec_Ex05_Broadcast_TaskRecv_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return Ex05_Broadcast_TaskRecv_inline_c_expr2_line_46(__parsec_tp, locals);
+}
+static const parsec_expr_t maxexpr_of_symb_Ex05_Broadcast_TaskRecv_k = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_Ex05_Broadcast_TaskRecv_k_fct }
+                   }
+};
+static const parsec_symbol_t symb_Ex05_Broadcast_TaskRecv_k = { .name = "k", .context_index = 0, .min = &minexpr_of_symb_Ex05_Broadcast_TaskRecv_k, .max = &maxexpr_of_symb_Ex05_Broadcast_TaskRecv_k, .cst_inc = 1, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t minexpr_of_symb_Ex05_Broadcast_TaskRecv_n_fct(const __parsec_Ex05_Broadcast_internal_taskpool_t *__parsec_tp, const __parsec_Ex05_Broadcast_TaskRecv_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_Ex05_Broadcast_TaskRecv_n = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_Ex05_Broadcast_TaskRecv_n_fct }
+                   }
+};
+static inline int maxexpr_of_symb_Ex05_Broadcast_TaskRecv_n_fct(const __parsec_Ex05_Broadcast_internal_taskpool_t *__parsec_tp, const __parsec_Ex05_Broadcast_TaskRecv_parsec_assignment_t *locals)
+{
+  const int k = locals->k.value; (void)k;
+  const int n = locals->n.value; (void)n;
+  const int loc = locals->loc.value; (void)loc;
+
+  (void)k;
+  (void)n;
+  (void)loc;
+  (void)__parsec_tp; (void)locals;
+  return NB;
+}
+static const parsec_expr_t maxexpr_of_symb_Ex05_Broadcast_TaskRecv_n = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_Ex05_Broadcast_TaskRecv_n_fct }
+                   }
+};
+static const parsec_symbol_t symb_Ex05_Broadcast_TaskRecv_n = { .name = "n", .context_index = 1, .min = &minexpr_of_symb_Ex05_Broadcast_TaskRecv_n, .max = &maxexpr_of_symb_Ex05_Broadcast_TaskRecv_n, .cst_inc = 2, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int32_t expr_of_symb_Ex05_Broadcast_TaskRecv_loc_fct(const __parsec_Ex05_Broadcast_internal_taskpool_t *__parsec_tp, const __parsec_Ex05_Broadcast_TaskRecv_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return Ex05_Broadcast_TaskRecv_inline_c_expr1_line_48(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_Ex05_Broadcast_TaskRecv_loc = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_Ex05_Broadcast_TaskRecv_loc_fct }
+                   }
+};
+static const parsec_symbol_t symb_Ex05_Broadcast_TaskRecv_loc = { .name = "loc", .context_index = 2, .min = &expr_of_symb_Ex05_Broadcast_TaskRecv_loc, .max = &expr_of_symb_Ex05_Broadcast_TaskRecv_loc, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int affinity_of_Ex05_Broadcast_TaskRecv(const __parsec_Ex05_Broadcast_TaskRecv_task_t *this_task,
+                     parsec_data_ref_t *ref)
+{
+    const __parsec_Ex05_Broadcast_internal_taskpool_t *__parsec_tp = (const __parsec_Ex05_Broadcast_internal_taskpool_t*)this_task->taskpool;
+  const int k = this_task->locals.k.value; (void)k;
+  const int n = this_task->locals.n.value; (void)n;
+  const int loc = this_task->locals.loc.value; (void)loc;
+
+  /* Silent Warnings: should look into predicate to know what variables are usefull */
+  (void)k;
+  (void)n;
+  (void)loc;
+  ref->dc = (parsec_data_collection_t *)__parsec_tp->super._g_mydata;
+  /* Compute data key */
+  ref->key = ref->dc->data_key(ref->dc, loc);
+  return 1;
+}
+static const parsec_property_t properties_of_Ex05_Broadcast_TaskRecv[1] = {
+  {.name = NULL, .expr = NULL}
+};
+static const parsec_dep_t flow_of_Ex05_Broadcast_TaskRecv_for_A_dep1_atline_52 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 0, /* Ex05_Broadcast_TaskBcast */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_Ex05_Broadcast_TaskBcast_for_A,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_Ex05_Broadcast_TaskRecv_for_A,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_Ex05_Broadcast_TaskRecv_for_A = {
+  .name               = "A",
+  .sym_type           = PARSEC_SYM_IN,
+  .flow_flags         = PARSEC_FLOW_ACCESS_READ,
+  .flow_index         = 0,
+  .flow_datatype_mask = 0x0,
+  .dep_in     = { &flow_of_Ex05_Broadcast_TaskRecv_for_A_dep1_atline_52 },
+  .dep_out    = { NULL }
+};
+
+static void
+iterate_predecessors_of_Ex05_Broadcast_TaskRecv(parsec_execution_stream_t *es, const __parsec_Ex05_Broadcast_TaskRecv_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_Ex05_Broadcast_internal_taskpool_t *__parsec_tp = (const __parsec_Ex05_Broadcast_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_Ex05_Broadcast_TaskRecv_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_Ex05_Broadcast_TaskRecv_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int k = __jdf2c__tmp_locals.k.value; (void)k;
+  const int n = __jdf2c__tmp_locals.n.value; (void)n;
+  const int loc = __jdf2c__tmp_locals.loc.value; (void)loc;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)k;  (void)n;  (void)loc;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_mydata(loc);
+#endif
+  if( action_mask & 0x1 ) {  /* Flow of data A [0] */
+    data.data   = this_task->data._f_A.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x1 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_Ex05_Broadcast_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_Ex05_Broadcast_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        __parsec_Ex05_Broadcast_TaskBcast_task_t* ncc = (__parsec_Ex05_Broadcast_TaskBcast_task_t*)&nc;
+    nc.task_class = __parsec_tp->super.super.task_classes_array[Ex05_Broadcast_TaskBcast.task_class_id];
+      const int TaskBcast_k = k;
+      if( (TaskBcast_k >= (0)) && (TaskBcast_k <= (Ex05_Broadcast_TaskBcast_inline_c_expr3_line_27(__parsec_tp, &ncc->locals))) ) {
+        assert(&nc.locals[0].value == &ncc->locals.k.value);
+        ncc->locals.k.value = TaskBcast_k;
+#if defined(DISTRIBUTED)
+        rank_dst = rank_of_mydata(ncc->locals.k.value);
+        if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+          vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_mydata)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_mydata, ncc->locals.k.value);
+        nc.priority = __parsec_tp->super.super.priority;
+        successor_repo = NULL;
+        successor_repo_key = 0;
+      RELEASE_DEP_OUTPUT(es, "A", this_task, "A", &nc, rank_src, rank_dst, &data);
+      if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_Ex05_Broadcast_TaskRecv_for_A_dep1_atline_52, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+        }
+  }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static int release_deps_of_Ex05_Broadcast_TaskRecv(parsec_execution_stream_t *es, __parsec_Ex05_Broadcast_TaskRecv_task_t *this_task, uint32_t action_mask, parsec_remote_deps_t *deps)
+{
+  PARSEC_PINS(es, RELEASE_DEPS_BEGIN, (parsec_task_t *)this_task);  const __parsec_Ex05_Broadcast_internal_taskpool_t *__parsec_tp = (const __parsec_Ex05_Broadcast_internal_taskpool_t *)this_task->taskpool;
+  parsec_release_dep_fct_arg_t arg;
+  int __vp_id;
+  int consume_local_repo = 0;
+  arg.action_mask = action_mask;
+  arg.output_entry = NULL;
+  arg.output_repo = NULL;
+#if defined(DISTRIBUTED)
+  arg.remote_deps = deps;
+#endif  /* defined(DISTRIBUTED) */
+  assert(NULL != es);
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS )    arg.ready_lists = alloca(sizeof(parsec_task_t *) * es->virtual_process->parsec_context->nb_vp);
+  else
+    arg.ready_lists = NULL;
+  for( __vp_id = 0; __vp_id < es->virtual_process->parsec_context->nb_vp; arg.ready_lists[__vp_id++] = NULL );
+  (void)__parsec_tp; (void)deps;
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_A.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_A.source_repo, this_task->data._f_A.source_repo_entry->ht_item.key );
+    }
+  }
+  consume_local_repo = (this_task->repo_entry != NULL);
+  /* No successors, don't call iterate_successors and don't release any local deps */
+      if (consume_local_repo) {
+         data_repo_entry_used_once( TaskRecv_repo, this_task->repo_entry->ht_item.key );
+      }
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_A.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_A.data_in);
+    }
+  }
+  PARSEC_PINS(es, RELEASE_DEPS_END, (parsec_task_t *)this_task);  return 0;
+}
+
+static int data_lookup_of_Ex05_Broadcast_TaskRecv(parsec_execution_stream_t *es, __parsec_Ex05_Broadcast_TaskRecv_task_t *this_task)
+{
+  const __parsec_Ex05_Broadcast_internal_taskpool_t *__parsec_tp = (__parsec_Ex05_Broadcast_internal_taskpool_t *)this_task->taskpool;
+  parsec_assignment_t generic_locals[MAX_PARAM_COUNT];  /* generic task locals */
+  int target_device = 0; (void)target_device;
+  (void)__parsec_tp; (void)generic_locals; (void)es;
+  parsec_data_copy_t *chunk = NULL;
+  data_repo_t        *reshape_repo  = NULL, *consumed_repo  = NULL;
+  data_repo_entry_t  *reshape_entry = NULL, *consumed_entry = NULL;
+  parsec_key_t        reshape_entry_key = 0, consumed_entry_key = 0;
+  uint8_t             consumed_flow_index;
+  parsec_dep_data_description_t data;
+  int ret;
+  (void)reshape_repo; (void)reshape_entry; (void)reshape_entry_key;
+  (void)consumed_repo; (void)consumed_entry; (void)consumed_entry_key;
+  (void)consumed_flow_index;
+  (void)chunk; (void)data; (void)ret;
+  const int k = this_task->locals.k.value; (void)k;
+  const int n = this_task->locals.n.value; (void)n;
+  const int loc = this_task->locals.loc.value; (void)loc;
+  if( NULL == this_task->repo_entry ){
+    this_task->repo_entry = data_repo_lookup_entry_and_create(es, TaskRecv_repo,                                       __jdf2c_make_key_TaskRecv((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    data_repo_entry_addto_usage_limit(TaskRecv_repo, this_task->repo_entry->ht_item.key, 1);    this_task->repo_entry ->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(this_task->repo_entry ->sim_exec_date == 0);
+    this_task->repo_entry ->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  /* The reshape repo is the current task repo. */  reshape_repo = TaskRecv_repo;
+  reshape_entry_key = __jdf2c_make_key_TaskRecv((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals) ;
+  reshape_entry = this_task->repo_entry;
+  /* Lookup the input data, and store them in the context if any */
+
+if(! this_task->data._f_A.fulfill ){ /* Flow A */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_A.data_out = NULL;  /* input only */
+  /* Flow A [0] dependency [0] from predecessor TaskBcast */
+  if( NULL == (chunk = this_task->data._f_A.data_in) ) {
+  /* No data set up by predecessor on this task input flow */
+__parsec_Ex05_Broadcast_TaskBcast_parsec_assignment_t *target_locals = (__parsec_Ex05_Broadcast_TaskBcast_parsec_assignment_t*)&generic_locals;
+  const int TaskBcastk = target_locals->k.value = k; (void)TaskBcastk;
+    if( (reshape_entry != NULL) && (reshape_entry->data[0] != NULL) ){
+        /* Reshape promise set up on this task repo by predecessor */
+        consumed_repo = reshape_repo;
+        consumed_entry = reshape_entry;
+        consumed_entry_key = reshape_entry_key;
+        consumed_flow_index = 0;
+    }else{
+        /* Consume from predecessor's repo */
+        consumed_repo = TaskBcast_repo;
+        consumed_entry_key = __jdf2c_make_key_TaskBcast((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)target_locals) ;
+        consumed_entry = data_repo_lookup_entry( consumed_repo, consumed_entry_key );
+        consumed_flow_index = 0;
+    }
+    data.data   = NULL;
+    data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+        data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    ACQUIRE_FLOW(this_task, "A", &Ex05_Broadcast_TaskBcast, "A", target_locals, chunk);
+    this_task->data._f_A.data_out = chunk;
+  } 
+  else {
+    /* Data set up by predecessor on this task input flow */
+    consumed_repo = this_task->data._f_A.source_repo;
+    consumed_entry = this_task->data._f_A.source_repo_entry;
+    consumed_entry_key = this_task->data._f_A.source_repo_entry->ht_item.key;
+    if( (reshape_entry != NULL) && (reshape_entry->data[0] != NULL) ){
+        /* Reshape promise set up on input by predecessor is on this task repo */
+        consumed_flow_index = 0;
+        assert( (this_task->data._f_A.source_repo == reshape_repo)
+             && (this_task->data._f_A.source_repo_entry == reshape_entry));
+    }else{
+        /* Reshape promise set up on input by predecessor is the predecesssor task repo */
+        consumed_flow_index = 0;
+    }
+    data.data   = NULL;
+    data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+        data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    this_task->data._f_A.data_out = parsec_data_get_copy(chunk->original, target_device);
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+    parsec_prof_grapher_data_input(chunk->original, (parsec_task_t*)this_task, &flow_of_Ex05_Broadcast_TaskRecv_for_A, 0);
+#endif
+  }
+    this_task->data._f_A.data_in     = chunk;
+    this_task->data._f_A.source_repo       = consumed_repo;
+    this_task->data._f_A.source_repo_entry = consumed_entry;
+    this_task->data._f_A.fulfill = 1;
+}
+
+  /** Generate profiling information */
+#if defined(PARSEC_PROF_TRACE)
+  this_task->prof_info.desc = (parsec_data_collection_t*)__parsec_tp->super._g_mydata;
+  this_task->prof_info.priority = this_task->priority;
+  this_task->prof_info.data_id   = ((parsec_data_collection_t*)__parsec_tp->super._g_mydata)->data_key((parsec_data_collection_t*)__parsec_tp->super._g_mydata, loc);
+  this_task->prof_info.task_class_id = this_task->task_class->task_class_id;
+  this_task->prof_info.task_return_code = -1;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int datatype_lookup_of_Ex05_Broadcast_TaskRecv(parsec_execution_stream_t *es, const parsec_task_t *this_generic_task, const parsec_task_t *parent_task,
+              uint32_t* flow_mask, parsec_dep_data_description_t* data)
+{
+  const __parsec_Ex05_Broadcast_TaskRecv_task_t *this_task = (__parsec_Ex05_Broadcast_TaskRecv_task_t*)this_generic_task;
+  const __parsec_Ex05_Broadcast_internal_taskpool_t *__parsec_tp = (__parsec_Ex05_Broadcast_internal_taskpool_t *)this_task->taskpool;
+  (void)__parsec_tp; (void)es; (void)this_task; (void)data; (void)parent_task;
+  const int k = this_task->locals.k.value; (void)k;
+  const int n = this_task->locals.n.value; (void)n;
+  const int loc = this_task->locals.loc.value; (void)loc;
+  data->local.arena = data->remote.arena = NULL;
+  data->local.src_datatype  = data->local.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->local.src_count     = data->local.dst_count = 0;
+  data->local.src_displ     = data->local.dst_displ = 0;
+  data->data_future  = NULL;
+  if( (*flow_mask) & 0x80000000U ) { /* these are the input dependencies remote datatypes  */
+if( (*flow_mask) & 0x1U ) {  /* Flow A */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_Ex05_Broadcast_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_Ex05_Broadcast_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_Ex05_Broadcast_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+    goto no_mask_match;
+  }
+
+  /* these are the output dependencies remote datatypes */
+ no_mask_match:
+  data->data                             = NULL;
+  data->remote.src_datatype = data->remote.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->remote.src_count    = data->remote.dst_count = 0;
+  data->remote.src_displ    = data->remote.dst_displ = 0;
+  data->data_future  = NULL;
+  (*flow_mask) = 0;  /* nothing left */
+  (void)k;  (void)n;  (void)loc;
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+static int hook_of_Ex05_Broadcast_TaskRecv(parsec_execution_stream_t *es, __parsec_Ex05_Broadcast_TaskRecv_task_t *this_task)
+{
+  __parsec_Ex05_Broadcast_internal_taskpool_t *__parsec_tp = (__parsec_Ex05_Broadcast_internal_taskpool_t *)this_task->taskpool;
+  (void)es; (void)__parsec_tp;
+  const int k = this_task->locals.k.value; (void)k;
+  const int n = this_task->locals.n.value; (void)n;
+  const int loc = this_task->locals.loc.value; (void)loc;
+  (void)k;  (void)n;  (void)loc;
+
+  /** Declare the variables that will hold the data, and all the accounting for each */
+  parsec_data_copy_t *_f_A = this_task->data._f_A.data_in;
+  void *A = PARSEC_DATA_COPY_GET_PTR(_f_A); (void)A;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    data_repo_entry_t *eA = this_task->data._f_A.source_repo_entry;
+    if( (NULL != eA) && (eA->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eA->sim_exec_date;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+  /** Cache Awareness Accounting */
+#if defined(PARSEC_CACHE_AWARENESS)
+  cache_buf_referenced(es->closest_cache, A);
+#endif /* PARSEC_CACHE_AWARENESS */
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                                TaskRecv BODY                                  -----*/
+
+{
+    int *Aint = (int*)A;
+    printf("[%d] Recv %d\n", rank, *Aint );
+}
+
+/*-----                              END OF TaskRecv BODY                              -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#endif  /*  defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+static int complete_hook_of_Ex05_Broadcast_TaskRecv(parsec_execution_stream_t *es, __parsec_Ex05_Broadcast_TaskRecv_task_t *this_task)
+{
+  const __parsec_Ex05_Broadcast_internal_taskpool_t *__parsec_tp = (__parsec_Ex05_Broadcast_internal_taskpool_t *)this_task->taskpool;
+#if defined(DISTRIBUTED)
+    const int k = this_task->locals.k.value; (void)k;
+  const int n = this_task->locals.n.value; (void)n;
+  const int loc = this_task->locals.loc.value; (void)loc;
+#endif  /* defined(DISTRIBUTED) */
+  (void)es; (void)__parsec_tp;
+parsec_data_t* data_t_desc = NULL; (void)data_t_desc;
+#if defined(DISTRIBUTED)
+  /** If not working on distributed, there is no risk that data is not in place */
+  (void)k;  (void)n;  (void)loc;
+
+#endif /* DISTRIBUTED */
+#if defined(PARSEC_PROF_GRAPHER)
+  parsec_prof_grapher_task((parsec_task_t*)this_task, es->th_id, es->virtual_process->vp_id,
+     __jdf2c_key_fns_TaskRecv.key_hash(this_task->task_class->make_key( (parsec_taskpool_t*)this_task->taskpool, ((parsec_task_t*)this_task)->locals), NULL));
+#endif  /* defined(PARSEC_PROF_GRAPHER) */
+  release_deps_of_Ex05_Broadcast_TaskRecv(es, this_task,
+      PARSEC_ACTION_RELEASE_REMOTE_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_REFS |
+      PARSEC_ACTION_RESHAPE_ON_RELEASE |
+      0x0,  /* mask of all dep_index */ 
+      NULL);
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static parsec_hook_return_t release_task_of_Ex05_Broadcast_TaskRecv(parsec_execution_stream_t *es, parsec_task_t *this_task)
+{
+    const __parsec_Ex05_Broadcast_internal_taskpool_t *__parsec_tp =
+        (const __parsec_Ex05_Broadcast_internal_taskpool_t *)this_task->taskpool;
+    parsec_hash_table_t *ht = (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[1];
+    parsec_key_t key = this_task->task_class->make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals);
+    parsec_hashable_dependency_t *hash_dep = (parsec_hashable_dependency_t *)parsec_hash_table_remove(ht, key);
+    parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);
+    return parsec_release_task_to_mempool_update_nbtasks(es, this_task);
+}
+
+static char *Ex05_Broadcast_Ex05_Broadcast_TaskRecv_internal_init_deps_key_functions_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_Ex05_Broadcast_internal_taskpool_t *__parsec_tp = (__parsec_Ex05_Broadcast_internal_taskpool_t *)user_data;
+  __parsec_Ex05_Broadcast_TaskRecv_parsec_assignment_t __jdf2c__assignments = {  .k.value = 0, .n.value = 0, .loc.value = 0 };
+  int k = (__parsec_key) % __parsec_tp->TaskRecv_k_range + __parsec_tp->TaskRecv_k_min;
+  __parsec_key = __parsec_key / __parsec_tp->TaskRecv_k_range;
+  __jdf2c__assignments.k.value = k;
+  int n = (__parsec_key) % __parsec_tp->TaskRecv_n_range + __parsec_tp->TaskRecv_n_min;
+  __parsec_key = __parsec_key / __parsec_tp->TaskRecv_n_range;
+  __jdf2c__assignments.n.value = n;
+  int loc = Ex05_Broadcast_TaskRecv_inline_c_expr1_line_48(__parsec_tp, &__jdf2c__assignments);
+  (void)loc;
+  __jdf2c__assignments.loc.value = loc;
+  (void)__jdf2c__assignments;
+  snprintf(buffer, buffer_size, "TaskRecv(%d, %d)", k, n);
+  return buffer;
+}
+
+static parsec_key_fn_t Ex05_Broadcast_Ex05_Broadcast_TaskRecv_internal_init_deps_key_functions = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = Ex05_Broadcast_Ex05_Broadcast_TaskRecv_internal_init_deps_key_functions_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/* Needs: min-max count-tasks iterate */
+static int Ex05_Broadcast_TaskRecv_internal_init(parsec_execution_stream_t * es, __parsec_Ex05_Broadcast_TaskRecv_task_t * this_task)
+{
+  __parsec_Ex05_Broadcast_internal_taskpool_t *__parsec_tp = (__parsec_Ex05_Broadcast_internal_taskpool_t*)this_task->taskpool;
+  int32_t nb_tasks = 0, saved_nb_tasks = 0;
+int32_t __k_min = 0x7fffffff, __k_max = 0;int32_t __jdf2c_k_min = 0x7fffffff, __jdf2c_k_max = 0;int32_t __n_min = 0x7fffffff, __n_max = 0;int32_t __jdf2c_n_min = 0x7fffffff, __jdf2c_n_max = 0;  __parsec_Ex05_Broadcast_TaskRecv_parsec_assignment_t assignments = {  .k.value = 0, .n.value = 0, .loc.value = 0 };
+  int32_t  k,  n,  loc;
+  int32_t __jdf2c_k_start, __jdf2c_k_end, __jdf2c_k_inc;
+  int32_t __jdf2c_n_start, __jdf2c_n_end, __jdf2c_n_inc;
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+  PARSEC_PROFILING_TRACE(es->es_profile,
+                         this_task->taskpool->profiling_array[START_KEY(this_task->task_class->task_class_id)],
+                         0,
+                         this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    __jdf2c_k_start = 0;
+    __jdf2c_k_end = Ex05_Broadcast_TaskRecv_inline_c_expr2_line_46(__parsec_tp, &assignments);
+    __jdf2c_k_inc = 1;
+    __k_min = parsec_imin(__jdf2c_k_start, __jdf2c_k_end);
+    __k_max = parsec_imax(__jdf2c_k_start, __jdf2c_k_end);
+    __jdf2c_k_min = parsec_imin(__jdf2c_k_min, __k_min);
+    __jdf2c_k_max = parsec_imax(__jdf2c_k_max, __k_max);
+    for(k =  __jdf2c_k_start;
+        k <= __jdf2c_k_end;
+        k += __jdf2c_k_inc) {
+    assignments.k.value = k;
+      __jdf2c_n_start = 0;
+      __jdf2c_n_end = NB;
+      __jdf2c_n_inc = 2;
+      __n_min = parsec_imin(__jdf2c_n_start, __jdf2c_n_end);
+      __n_max = parsec_imax(__jdf2c_n_start, __jdf2c_n_end);
+      __jdf2c_n_min = parsec_imin(__jdf2c_n_min, __n_min);
+      __jdf2c_n_max = parsec_imax(__jdf2c_n_max, __n_max);
+      for(n =  __jdf2c_n_start;
+          n <= __jdf2c_n_end;
+          n += __jdf2c_n_inc) {
+      assignments.n.value = n;
+    {  /* block for the non-range variable loc */
+        loc = Ex05_Broadcast_TaskRecv_inline_c_expr1_line_48(__parsec_tp, &assignments);
+        assignments.loc.value = loc;
+        if( !TaskRecv_pred(k, n, loc) ) continue;
+        nb_tasks++;
+      } /* block for the non-range variable loc */ 
+    } /* Loop on normal range n */
+  } /* For loop of k */ 
+   if( 0 != nb_tasks ) {
+     (void)parsec_atomic_fetch_add_int32(&__parsec_tp->initial_number_tasks, nb_tasks);
+   }
+  /* Set the range variables for the collision-free hash-computation */
+  __parsec_tp->TaskRecv_k_min   = __jdf2c_k_min;
+  __parsec_tp->TaskRecv_k_range = (__jdf2c_k_max - __jdf2c_k_min) + 1;
+  __parsec_tp->TaskRecv_n_min   = __jdf2c_n_min;
+  __parsec_tp->TaskRecv_n_range = (__jdf2c_n_max - __jdf2c_n_min) + 1;
+  this_task->status = PARSEC_TASK_STATUS_COMPLETE;
+
+  PARSEC_AYU_REGISTER_TASK(&Ex05_Broadcast_TaskRecv);
+  __parsec_tp->super.super.dependencies_array[1] = PARSEC_OBJ_NEW(parsec_hash_table_t);
+  parsec_hash_table_init(__parsec_tp->super.super.dependencies_array[1], offsetof(parsec_hashable_dependency_t, ht_item), 10, Ex05_Broadcast_Ex05_Broadcast_TaskRecv_internal_init_deps_key_functions, this_task->taskpool);
+  __parsec_tp->repositories[1] = data_repo_create_nothreadsafe(nb_tasks, __jdf2c_key_fns_TaskRecv, (parsec_taskpool_t*)__parsec_tp, 1);
+(void)saved_nb_tasks;
+(void)__k_min; (void)__k_max;(void)__n_min; (void)__n_max;  (void)__jdf2c_k_start; (void)__jdf2c_k_end; (void)__jdf2c_k_inc;  (void)__jdf2c_n_start; (void)__jdf2c_n_end; (void)__jdf2c_n_inc;  (void)assignments; (void)__parsec_tp; (void)es;
+  if(1 == parsec_atomic_fetch_dec_int32(&__parsec_tp->sync_point)) {
+    /* Last initialization task complete. Update the number of tasks. */
+    __parsec_tp->super.super.tdm.module->taskpool_addto_nb_tasks(&__parsec_tp->super.super, __parsec_tp->initial_number_tasks);
+    parsec_mfence();  /* write memory barrier to guarantee that the scheduler gets the correct number of tasks */
+    parsec_taskpool_enable((parsec_taskpool_t*)__parsec_tp, &__parsec_tp->startup_queue,
+                           (parsec_task_t*)this_task, es, __parsec_tp->super.super.nb_pending_actions);
+    __parsec_tp->super.super.tdm.module->taskpool_ready(&__parsec_tp->super.super);
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+    PARSEC_PROFILING_TRACE(es->es_profile,
+                           this_task->taskpool->profiling_array[2 * this_task->task_class->task_class_id + 1],
+                           0,
+                           this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    return PARSEC_HOOK_RETURN_DONE;
+  }
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static const __parsec_chore_t __Ex05_Broadcast_TaskRecv_chores[] ={
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+    { .type     = PARSEC_DEV_CPU,
+      .evaluate = (parsec_evaluate_function_t*)NULL,
+      .hook     = (parsec_hook_t*)hook_of_Ex05_Broadcast_TaskRecv },
+#endif  /* defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+    { .type     = PARSEC_DEV_NONE,
+      .evaluate = NULL,
+      .hook     = (parsec_hook_t*)NULL },  /* End marker */
+};
+
+static const parsec_task_class_t Ex05_Broadcast_TaskRecv = {
+  .name = "TaskRecv",
+  .task_class_id = 1,
+  .nb_flows = 1,
+  .nb_parameters = 2,
+  .nb_locals = 3,
+  .task_class_type = PARSEC_TASK_CLASS_TYPE_PTG,
+  .params = { &symb_Ex05_Broadcast_TaskRecv_k, &symb_Ex05_Broadcast_TaskRecv_n, NULL },
+  .locals = { &symb_Ex05_Broadcast_TaskRecv_k, &symb_Ex05_Broadcast_TaskRecv_n, &symb_Ex05_Broadcast_TaskRecv_loc, NULL },
+  .data_affinity = (parsec_data_ref_fn_t*)affinity_of_Ex05_Broadcast_TaskRecv,
+  .initial_data = (parsec_data_ref_fn_t*)affinity_of_Ex05_Broadcast_TaskRecv,
+  .final_data = (parsec_data_ref_fn_t*)affinity_of_Ex05_Broadcast_TaskRecv,
+  .priority = NULL,
+  .properties = properties_of_Ex05_Broadcast_TaskRecv,
+#if MAX_PARAM_COUNT < 1  /* number of read flows of TaskRecv */
+  #error Too many read flows for task TaskRecv
+#endif  /* MAX_PARAM_COUNT */
+#if MAX_PARAM_COUNT < 0  /* number of write flows of TaskRecv */
+  #error Too many write flows for task TaskRecv
+#endif  /* MAX_PARAM_COUNT */
+  .in = { &flow_of_Ex05_Broadcast_TaskRecv_for_A, NULL },
+  .out = { NULL },
+  .flags = 0x0 | PARSEC_USE_DEPS_MASK,
+  .dependencies_goal = 0x1,
+  .make_key = __jdf2c_make_key_TaskRecv,
+  .task_snprintf = parsec_task_snprintf,
+#if defined(PARSEC_PROF_TRACE)
+  .profile_info = &parsec_task_profile_info,
+#endif
+  .key_functions = &__jdf2c_key_fns_TaskRecv,
+  .fini = (parsec_hook_t*)NULL,
+  .incarnations = __Ex05_Broadcast_TaskRecv_chores,
+  .find_deps = parsec_hash_find_deps,
+  .update_deps = parsec_update_deps_with_mask,
+  .iterate_successors = (parsec_traverse_function_t*)NULL,
+  .iterate_predecessors = (parsec_traverse_function_t*)iterate_predecessors_of_Ex05_Broadcast_TaskRecv,
+  .release_deps = (parsec_release_deps_t*)release_deps_of_Ex05_Broadcast_TaskRecv,
+  .prepare_output = (parsec_hook_t*)NULL,
+  .prepare_input = (parsec_hook_t*)data_lookup_of_Ex05_Broadcast_TaskRecv,
+  .time_estimate = NULL,
+  .get_datatype = datatype_lookup_of_Ex05_Broadcast_TaskRecv,
+  .complete_execution = (parsec_hook_t*)complete_hook_of_Ex05_Broadcast_TaskRecv,
+  .release_task = &release_task_of_Ex05_Broadcast_TaskRecv,
+#if defined(PARSEC_SIM)
+  .sim_cost_fct = (parsec_sim_cost_fct_t*)NULL,
+#endif
+};
+
+
+/******                                  TaskBcast                                    ******/
+
+static inline int32_t minexpr_of_symb_Ex05_Broadcast_TaskBcast_k_fct(const __parsec_Ex05_Broadcast_internal_taskpool_t *__parsec_tp, const __parsec_Ex05_Broadcast_TaskBcast_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_Ex05_Broadcast_TaskBcast_k = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_Ex05_Broadcast_TaskBcast_k_fct }
+                   }
+};
+static inline int32_t maxexpr_of_symb_Ex05_Broadcast_TaskBcast_k_fct(const __parsec_Ex05_Broadcast_internal_taskpool_t *__parsec_tp, const __parsec_Ex05_Broadcast_TaskBcast_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return Ex05_Broadcast_TaskBcast_inline_c_expr3_line_27(__parsec_tp, locals);
+}
+static const parsec_expr_t maxexpr_of_symb_Ex05_Broadcast_TaskBcast_k = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_Ex05_Broadcast_TaskBcast_k_fct }
+                   }
+};
+static const parsec_symbol_t symb_Ex05_Broadcast_TaskBcast_k = { .name = "k", .context_index = 0, .min = &minexpr_of_symb_Ex05_Broadcast_TaskBcast_k, .max = &maxexpr_of_symb_Ex05_Broadcast_TaskBcast_k, .cst_inc = 1, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int affinity_of_Ex05_Broadcast_TaskBcast(const __parsec_Ex05_Broadcast_TaskBcast_task_t *this_task,
+                     parsec_data_ref_t *ref)
+{
+    const __parsec_Ex05_Broadcast_internal_taskpool_t *__parsec_tp = (const __parsec_Ex05_Broadcast_internal_taskpool_t*)this_task->taskpool;
+  const int k = this_task->locals.k.value; (void)k;
+
+  /* Silent Warnings: should look into predicate to know what variables are usefull */
+  (void)k;
+  ref->dc = (parsec_data_collection_t *)__parsec_tp->super._g_mydata;
+  /* Compute data key */
+  ref->key = ref->dc->data_key(ref->dc, k);
+  return 1;
+}
+static const parsec_property_t properties_of_Ex05_Broadcast_TaskBcast[1] = {
+  {.name = NULL, .expr = NULL}
+};
+static parsec_data_t *flow_of_Ex05_Broadcast_TaskBcast_for_A_dep1_atline_31_direct_access(const __parsec_Ex05_Broadcast_internal_taskpool_t *__parsec_tp, const __parsec_Ex05_Broadcast_TaskBcast_parsec_assignment_t *assignments)
+{
+  const int k = assignments->k.value; (void)k;
+
+  /* Silence Warnings: should look into parameters to know what variables are useful */
+  (void)k;
+  if( __parsec_tp->super.super.context->my_rank == (int32_t)rank_of_mydata(k) )
+    return data_of_mydata(k);
+  return NULL;
+}
+
+static const parsec_dep_t flow_of_Ex05_Broadcast_TaskBcast_for_A_dep1_atline_31 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = PARSEC_LOCAL_DATA_TASK_CLASS_ID, /* Ex05_Broadcast_mydata */
+  .direct_data = (parsec_data_lookup_func_t)&flow_of_Ex05_Broadcast_TaskBcast_for_A_dep1_atline_31_direct_access,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_Ex05_Broadcast_TaskBcast_for_A,
+};
+static const parsec_dep_t flow_of_Ex05_Broadcast_TaskBcast_for_A_dep2_atline_32 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 1, /* Ex05_Broadcast_TaskRecv */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_Ex05_Broadcast_TaskRecv_for_A,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_Ex05_Broadcast_TaskBcast_for_A,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+#if MAX_DEP_OUT_COUNT < 1  /* number of output dependencies */
+    #error Too many output dependencies (supports up to MAX_DEP_OUT_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_OUT_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_Ex05_Broadcast_TaskBcast_for_A = {
+  .name               = "A",
+  .sym_type           = PARSEC_SYM_INOUT,
+  .flow_flags         = PARSEC_FLOW_ACCESS_RW|PARSEC_FLOW_HAS_IN_DEPS,
+  .flow_index         = 0,
+  .flow_datatype_mask = 0x1,
+  .dep_in     = { &flow_of_Ex05_Broadcast_TaskBcast_for_A_dep1_atline_31 },
+  .dep_out    = { &flow_of_Ex05_Broadcast_TaskBcast_for_A_dep2_atline_32 }
+};
+
+static void
+iterate_successors_of_Ex05_Broadcast_TaskBcast(parsec_execution_stream_t *es, const __parsec_Ex05_Broadcast_TaskBcast_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_Ex05_Broadcast_internal_taskpool_t *__parsec_tp = (const __parsec_Ex05_Broadcast_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_Ex05_Broadcast_TaskBcast_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_Ex05_Broadcast_TaskBcast_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int k = __jdf2c__tmp_locals.k.value; (void)k;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)k;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_mydata(k);
+#endif
+  if( action_mask & 0x1 ) {  /* Flow of data A [0] */
+    data.data   = this_task->data._f_A.data_out;
+    data.data_future  = NULL;
+    if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_Ex05_Broadcast_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_Ex05_Broadcast_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+       __parsec_Ex05_Broadcast_TaskRecv_task_t* ncc = (__parsec_Ex05_Broadcast_TaskRecv_task_t*)&nc;
+    nc.task_class = __parsec_tp->super.super.task_classes_array[Ex05_Broadcast_TaskRecv.task_class_id];
+      const int TaskRecv_k = k;
+      if( (TaskRecv_k >= (0)) && (TaskRecv_k <= (Ex05_Broadcast_TaskRecv_inline_c_expr2_line_46(__parsec_tp, &ncc->locals))) ) {
+        assert(&nc.locals[0].value == &ncc->locals.k.value);
+        ncc->locals.k.value = TaskRecv_k;
+        int TaskRecv_n;
+      for( TaskRecv_n = 0;TaskRecv_n <= NB; TaskRecv_n+=2) {
+          if( (TaskRecv_n >= (0)) && (TaskRecv_n <= (NB)) ) {
+            assert(&nc.locals[1].value == &ncc->locals.n.value);
+            ncc->locals.n.value = TaskRecv_n;
+            const int TaskRecv_loc = Ex05_Broadcast_TaskRecv_inline_c_expr1_line_48(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[2].value == &ncc->locals.loc.value);
+            ncc->locals.loc.value = TaskRecv_loc;
+#if defined(DISTRIBUTED)
+            rank_dst = rank_of_mydata(ncc->locals.loc.value);
+            if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+              vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_mydata)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_mydata, ncc->locals.loc.value);
+            nc.priority = __parsec_tp->super.super.priority;
+            successor_repo = TaskRecv_repo;
+            successor_repo_key = __jdf2c_make_key_TaskRecv((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+          RELEASE_DEP_OUTPUT(es, "A", this_task, "A", &nc, rank_src, rank_dst, &data);
+          if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_Ex05_Broadcast_TaskBcast_for_A_dep2_atline_32, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+            }
+          }
+        }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static int release_deps_of_Ex05_Broadcast_TaskBcast(parsec_execution_stream_t *es, __parsec_Ex05_Broadcast_TaskBcast_task_t *this_task, uint32_t action_mask, parsec_remote_deps_t *deps)
+{
+  PARSEC_PINS(es, RELEASE_DEPS_BEGIN, (parsec_task_t *)this_task);  const __parsec_Ex05_Broadcast_internal_taskpool_t *__parsec_tp = (const __parsec_Ex05_Broadcast_internal_taskpool_t *)this_task->taskpool;
+  parsec_release_dep_fct_arg_t arg;
+  int __vp_id;
+  int consume_local_repo = 0;
+  arg.action_mask = action_mask;
+  arg.output_entry = NULL;
+  arg.output_repo = NULL;
+#if defined(DISTRIBUTED)
+  arg.remote_deps = deps;
+#endif  /* defined(DISTRIBUTED) */
+  assert(NULL != es);
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS )    arg.ready_lists = alloca(sizeof(parsec_task_t *) * es->virtual_process->parsec_context->nb_vp);
+  else
+    arg.ready_lists = NULL;
+  for( __vp_id = 0; __vp_id < es->virtual_process->parsec_context->nb_vp; arg.ready_lists[__vp_id++] = NULL );
+  (void)__parsec_tp; (void)deps;
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_A.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_A.source_repo, this_task->data._f_A.source_repo_entry->ht_item.key );
+    }
+  }
+  consume_local_repo = (this_task->repo_entry != NULL);
+  arg.output_repo = TaskBcast_repo;
+  arg.output_entry = this_task->repo_entry;
+  arg.output_usage = 0;
+  if( action_mask & (PARSEC_ACTION_RELEASE_LOCAL_DEPS | PARSEC_ACTION_GET_REPO_ENTRY) ) {
+    arg.output_entry = data_repo_lookup_entry_and_create( es, arg.output_repo, __jdf2c_make_key_TaskBcast((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    arg.output_entry->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(arg.output_entry->sim_exec_date == 0);
+    arg.output_entry->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  if(action_mask & ( PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE ) ){
+    /* Generate the reshape promise for the outputs that need it */
+    iterate_successors_of_Ex05_Broadcast_TaskBcast(es, this_task, action_mask, parsec_set_up_reshape_promise, &arg);
+   }
+  iterate_successors_of_Ex05_Broadcast_TaskBcast(es, this_task, action_mask, parsec_release_dep_fct, &arg);
+
+#if defined(DISTRIBUTED)
+  if( (action_mask & PARSEC_ACTION_SEND_REMOTE_DEPS) && (NULL != arg.remote_deps)) {
+    parsec_remote_dep_activate(es, (parsec_task_t *)this_task, arg.remote_deps, arg.remote_deps->outgoing_mask);
+  }
+#endif
+
+  if(action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS) {
+    data_repo_entry_addto_usage_limit(TaskBcast_repo, arg.output_entry->ht_item.key, arg.output_usage);
+    __parsec_schedule_vp(es, arg.ready_lists, 0);
+  }
+      if (consume_local_repo) {
+         data_repo_entry_used_once( TaskBcast_repo, this_task->repo_entry->ht_item.key );
+      }
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_A.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_A.data_in);
+    }
+  }
+  PARSEC_PINS(es, RELEASE_DEPS_END, (parsec_task_t *)this_task);  return 0;
+}
+
+static int data_lookup_of_Ex05_Broadcast_TaskBcast(parsec_execution_stream_t *es, __parsec_Ex05_Broadcast_TaskBcast_task_t *this_task)
+{
+  const __parsec_Ex05_Broadcast_internal_taskpool_t *__parsec_tp = (__parsec_Ex05_Broadcast_internal_taskpool_t *)this_task->taskpool;
+  parsec_assignment_t generic_locals[MAX_PARAM_COUNT];  /* generic task locals */
+  int target_device = 0; (void)target_device;
+  (void)__parsec_tp; (void)generic_locals; (void)es;
+  parsec_data_copy_t *chunk = NULL;
+  data_repo_t        *reshape_repo  = NULL, *consumed_repo  = NULL;
+  data_repo_entry_t  *reshape_entry = NULL, *consumed_entry = NULL;
+  parsec_key_t        reshape_entry_key = 0, consumed_entry_key = 0;
+  uint8_t             consumed_flow_index;
+  parsec_dep_data_description_t data;
+  int ret;
+  (void)reshape_repo; (void)reshape_entry; (void)reshape_entry_key;
+  (void)consumed_repo; (void)consumed_entry; (void)consumed_entry_key;
+  (void)consumed_flow_index;
+  (void)chunk; (void)data; (void)ret;
+  const int k = this_task->locals.k.value; (void)k;
+  if( NULL == this_task->repo_entry ){
+    this_task->repo_entry = data_repo_lookup_entry_and_create(es, TaskBcast_repo,                                       __jdf2c_make_key_TaskBcast((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    data_repo_entry_addto_usage_limit(TaskBcast_repo, this_task->repo_entry->ht_item.key, 1);    this_task->repo_entry ->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(this_task->repo_entry ->sim_exec_date == 0);
+    this_task->repo_entry ->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  /* The reshape repo is the current task repo. */  reshape_repo = TaskBcast_repo;
+  reshape_entry_key = __jdf2c_make_key_TaskBcast((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals) ;
+  reshape_entry = this_task->repo_entry;
+  /* Lookup the input data, and store them in the context if any */
+
+if(! this_task->data._f_A.fulfill ){ /* Flow A */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_A.data_out = NULL;  /* By default, if nothing matches */
+  /* Flow A [0] dependency [0] from memory mydata */
+  if( NULL == (chunk = this_task->data._f_A.data_in) ) {
+  /* No data set up by predecessor on this task input flow */
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+  parsec_prof_grapher_data_input(data_of_mydata(k), (parsec_task_t*)this_task, &flow_of_Ex05_Broadcast_TaskBcast_for_A, 1);
+#endif
+    chunk = parsec_data_get_copy(data_of_mydata(k), target_device);
+    data.data = chunk;
+    data.data_future  = NULL;
+        data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.data_future   = NULL;
+    if( (ret = parsec_get_copy_reshape_from_desc(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    this_task->data._f_A.data_out = chunk;
+    PARSEC_OBJ_RETAIN(chunk);
+  } 
+    this_task->data._f_A.data_in     = chunk;
+    this_task->data._f_A.source_repo       = consumed_repo;
+    this_task->data._f_A.source_repo_entry = consumed_entry;
+    if( this_task->data._f_A.source_repo_entry == this_task->repo_entry ){
+      /* in case we have consume from this task repo entry for the flow,
+       * it is cleaned up, avoiding having old stuff during release_deps_of
+       */
+      this_task->repo_entry->data[0] = NULL;
+    }
+    this_task->data._f_A.fulfill = 1;
+}
+
+  /** Generate profiling information */
+#if defined(PARSEC_PROF_TRACE)
+  this_task->prof_info.desc = (parsec_data_collection_t*)__parsec_tp->super._g_mydata;
+  this_task->prof_info.priority = this_task->priority;
+  this_task->prof_info.data_id   = ((parsec_data_collection_t*)__parsec_tp->super._g_mydata)->data_key((parsec_data_collection_t*)__parsec_tp->super._g_mydata, k);
+  this_task->prof_info.task_class_id = this_task->task_class->task_class_id;
+  this_task->prof_info.task_return_code = -1;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int datatype_lookup_of_Ex05_Broadcast_TaskBcast(parsec_execution_stream_t *es, const parsec_task_t *this_generic_task, const parsec_task_t *parent_task,
+              uint32_t* flow_mask, parsec_dep_data_description_t* data)
+{
+  const __parsec_Ex05_Broadcast_TaskBcast_task_t *this_task = (__parsec_Ex05_Broadcast_TaskBcast_task_t*)this_generic_task;
+  const __parsec_Ex05_Broadcast_internal_taskpool_t *__parsec_tp = (__parsec_Ex05_Broadcast_internal_taskpool_t *)this_task->taskpool;
+  (void)__parsec_tp; (void)es; (void)this_task; (void)data; (void)parent_task;
+  const int k = this_task->locals.k.value; (void)k;
+  data->local.arena = data->remote.arena = NULL;
+  data->local.src_datatype  = data->local.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->local.src_count     = data->local.dst_count = 0;
+  data->local.src_displ     = data->local.dst_displ = 0;
+  data->data_future  = NULL;
+  if( (*flow_mask) & 0x80000000U ) { /* these are the input dependencies remote datatypes  */
+if( (*flow_mask) & 0x1U ) {  /* Flow A */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_Ex05_Broadcast_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_Ex05_Broadcast_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_Ex05_Broadcast_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+    goto no_mask_match;
+  }
+
+  /* these are the output dependencies remote datatypes */
+if( (*flow_mask) & 0x1U ) {  /* Flow A */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_Ex05_Broadcast_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_Ex05_Broadcast_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_Ex05_Broadcast_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+ no_mask_match:
+  data->data                             = NULL;
+  data->remote.src_datatype = data->remote.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->remote.src_count    = data->remote.dst_count = 0;
+  data->remote.src_displ    = data->remote.dst_displ = 0;
+  data->data_future  = NULL;
+  (*flow_mask) = 0;  /* nothing left */
+  (void)k;
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+static int hook_of_Ex05_Broadcast_TaskBcast(parsec_execution_stream_t *es, __parsec_Ex05_Broadcast_TaskBcast_task_t *this_task)
+{
+  __parsec_Ex05_Broadcast_internal_taskpool_t *__parsec_tp = (__parsec_Ex05_Broadcast_internal_taskpool_t *)this_task->taskpool;
+  (void)es; (void)__parsec_tp;
+  const int k = this_task->locals.k.value; (void)k;
+  (void)k;
+
+  /** Declare the variables that will hold the data, and all the accounting for each */
+  parsec_data_copy_t *_f_A = this_task->data._f_A.data_in;
+  void *A = PARSEC_DATA_COPY_GET_PTR(_f_A); (void)A;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    data_repo_entry_t *eA = this_task->data._f_A.source_repo_entry;
+    if( (NULL != eA) && (eA->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eA->sim_exec_date;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+    if ( NULL != _f_A ) {
+#if defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) || defined(PARSEC_HAVE_DEV_HIP_SUPPORT)
+      parsec_data_transfer_ownership_to_copy( _f_A->original, 0 /* device */,
+                                           PARSEC_FLOW_ACCESS_RW);
+#endif  /* defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) || defined(PARSEC_HAVE_DEV_HIP_SUPPORT) */
+      _f_A->version++;  /* A */
+#if defined(PARSEC_DEBUG_NOISIER)
+      char tmp[128];
+      PARSEC_DEBUG_VERBOSE(10, parsec_debug_output,
+                           "Body of %s: change Data copy %p to version %d",
+                           parsec_task_snprintf(tmp, 128, (parsec_task_t*)(this_task)),
+                           _f_A, _f_A->version);
+#endif /* defined(PARSEC_DEBUG_NOISIER) */
+    }
+  /** Cache Awareness Accounting */
+#if defined(PARSEC_CACHE_AWARENESS)
+  cache_buf_referenced(es->closest_cache, A);
+#endif /* PARSEC_CACHE_AWARENESS */
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                                TaskBcast BODY                                -----*/
+
+{
+    int *Aint = (int*)A;
+    *Aint = k;
+
+    printf("[%d] Send %d\n", rank, k );
+}
+
+/*-----                            END OF TaskBcast BODY                              -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#endif  /*  defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+static int complete_hook_of_Ex05_Broadcast_TaskBcast(parsec_execution_stream_t *es, __parsec_Ex05_Broadcast_TaskBcast_task_t *this_task)
+{
+  const __parsec_Ex05_Broadcast_internal_taskpool_t *__parsec_tp = (__parsec_Ex05_Broadcast_internal_taskpool_t *)this_task->taskpool;
+#if defined(DISTRIBUTED)
+    const int k = this_task->locals.k.value; (void)k;
+#endif  /* defined(DISTRIBUTED) */
+  (void)es; (void)__parsec_tp;
+parsec_data_t* data_t_desc = NULL; (void)data_t_desc;
+#if defined(DISTRIBUTED)
+  /** If not working on distributed, there is no risk that data is not in place */
+  (void)k;
+
+#endif /* DISTRIBUTED */
+#if defined(PARSEC_PROF_GRAPHER)
+  parsec_prof_grapher_task((parsec_task_t*)this_task, es->th_id, es->virtual_process->vp_id,
+     __jdf2c_key_fns_TaskBcast.key_hash(this_task->task_class->make_key( (parsec_taskpool_t*)this_task->taskpool, ((parsec_task_t*)this_task)->locals), NULL));
+#endif  /* defined(PARSEC_PROF_GRAPHER) */
+  release_deps_of_Ex05_Broadcast_TaskBcast(es, this_task,
+      PARSEC_ACTION_RELEASE_REMOTE_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_REFS |
+      PARSEC_ACTION_RESHAPE_ON_RELEASE |
+      0x1,  /* mask of all dep_index */ 
+      NULL);
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static parsec_hook_return_t release_task_of_Ex05_Broadcast_TaskBcast(parsec_execution_stream_t *es, parsec_task_t *this_task)
+{
+    const __parsec_Ex05_Broadcast_internal_taskpool_t *__parsec_tp =
+        (const __parsec_Ex05_Broadcast_internal_taskpool_t *)this_task->taskpool;
+    parsec_hash_table_t *ht = (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[0];
+    parsec_key_t key = this_task->task_class->make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals);
+    parsec_hashable_dependency_t *hash_dep = (parsec_hashable_dependency_t *)parsec_hash_table_remove(ht, key);
+    parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);
+    return parsec_release_task_to_mempool_update_nbtasks(es, this_task);
+}
+
+static char *Ex05_Broadcast_Ex05_Broadcast_TaskBcast_internal_init_deps_key_functions_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_Ex05_Broadcast_internal_taskpool_t *__parsec_tp = (__parsec_Ex05_Broadcast_internal_taskpool_t *)user_data;
+  __parsec_Ex05_Broadcast_TaskBcast_parsec_assignment_t __jdf2c__assignments = {  .k.value = 0 };
+  int k = (__parsec_key) % __parsec_tp->TaskBcast_k_range + __parsec_tp->TaskBcast_k_min;
+  __parsec_key = __parsec_key / __parsec_tp->TaskBcast_k_range;
+  __jdf2c__assignments.k.value = k;
+  (void)__jdf2c__assignments;
+  snprintf(buffer, buffer_size, "TaskBcast(%d)", k);
+  return buffer;
+}
+
+static parsec_key_fn_t Ex05_Broadcast_Ex05_Broadcast_TaskBcast_internal_init_deps_key_functions = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = Ex05_Broadcast_Ex05_Broadcast_TaskBcast_internal_init_deps_key_functions_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/* Needs: min-max count-tasks iterate */
+static int Ex05_Broadcast_TaskBcast_internal_init(parsec_execution_stream_t * es, __parsec_Ex05_Broadcast_TaskBcast_task_t * this_task)
+{
+  __parsec_Ex05_Broadcast_internal_taskpool_t *__parsec_tp = (__parsec_Ex05_Broadcast_internal_taskpool_t*)this_task->taskpool;
+  int32_t nb_tasks = 0, saved_nb_tasks = 0;
+int32_t __k_min = 0x7fffffff, __k_max = 0;int32_t __jdf2c_k_min = 0x7fffffff, __jdf2c_k_max = 0;  __parsec_Ex05_Broadcast_TaskBcast_parsec_assignment_t assignments = {  .k.value = 0 };
+  int32_t  k;
+  int32_t __jdf2c_k_start, __jdf2c_k_end, __jdf2c_k_inc;
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+  PARSEC_PROFILING_TRACE(es->es_profile,
+                         this_task->taskpool->profiling_array[START_KEY(this_task->task_class->task_class_id)],
+                         0,
+                         this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    __jdf2c_k_start = 0;
+    __jdf2c_k_end = Ex05_Broadcast_TaskBcast_inline_c_expr3_line_27(__parsec_tp, &assignments);
+    __jdf2c_k_inc = 1;
+    __k_min = parsec_imin(__jdf2c_k_start, __jdf2c_k_end);
+    __k_max = parsec_imax(__jdf2c_k_start, __jdf2c_k_end);
+    __jdf2c_k_min = parsec_imin(__jdf2c_k_min, __k_min);
+    __jdf2c_k_max = parsec_imax(__jdf2c_k_max, __k_max);
+    for(k =  __jdf2c_k_start;
+        k <= __jdf2c_k_end;
+        k += __jdf2c_k_inc) {
+    assignments.k.value = k;
+    if( !TaskBcast_pred(k) ) continue;
+    nb_tasks++;
+  } /* Loop on normal range k */
+   if( 0 != nb_tasks ) {
+     (void)parsec_atomic_fetch_add_int32(&__parsec_tp->initial_number_tasks, nb_tasks);
+   }
+  /* Set the range variables for the collision-free hash-computation */
+  __parsec_tp->TaskBcast_k_min   = __jdf2c_k_min;
+  __parsec_tp->TaskBcast_k_range = (__jdf2c_k_max - __jdf2c_k_min) + 1;
+    do {
+      this_task->super.list_next = (parsec_list_item_t*)__parsec_tp->startup_queue;
+    } while(!parsec_atomic_cas_ptr(&__parsec_tp->startup_queue, (parsec_list_item_t*)this_task->super.list_next, this_task));
+    this_task->status = PARSEC_TASK_STATUS_HOOK;
+
+  PARSEC_AYU_REGISTER_TASK(&Ex05_Broadcast_TaskBcast);
+  __parsec_tp->super.super.dependencies_array[0] = PARSEC_OBJ_NEW(parsec_hash_table_t);
+  parsec_hash_table_init(__parsec_tp->super.super.dependencies_array[0], offsetof(parsec_hashable_dependency_t, ht_item), 10, Ex05_Broadcast_Ex05_Broadcast_TaskBcast_internal_init_deps_key_functions, this_task->taskpool);
+  __parsec_tp->repositories[0] = data_repo_create_nothreadsafe(nb_tasks, __jdf2c_key_fns_TaskBcast, (parsec_taskpool_t*)__parsec_tp, 1);
+(void)saved_nb_tasks;
+(void)__k_min; (void)__k_max;  (void)__jdf2c_k_start; (void)__jdf2c_k_end; (void)__jdf2c_k_inc;  (void)assignments; (void)__parsec_tp; (void)es;
+  if(1 == parsec_atomic_fetch_dec_int32(&__parsec_tp->sync_point)) {
+    /* Last initialization task complete. Update the number of tasks. */
+    __parsec_tp->super.super.tdm.module->taskpool_addto_nb_tasks(&__parsec_tp->super.super, __parsec_tp->initial_number_tasks);
+    parsec_mfence();  /* write memory barrier to guarantee that the scheduler gets the correct number of tasks */
+    parsec_taskpool_enable((parsec_taskpool_t*)__parsec_tp, &__parsec_tp->startup_queue,
+                           (parsec_task_t*)this_task, es, __parsec_tp->super.super.nb_pending_actions);
+    __parsec_tp->super.super.tdm.module->taskpool_ready(&__parsec_tp->super.super);
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+    PARSEC_PROFILING_TRACE(es->es_profile,
+                           this_task->taskpool->profiling_array[2 * this_task->task_class->task_class_id + 1],
+                           0,
+                           this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    if( 1 >= __parsec_tp->super.super.nb_pending_actions ) {
+        /* if no tasks will be generated let's prevent the runtime from calling the hook and instead go directly to complete the task */
+        this_task->status = PARSEC_TASK_STATUS_COMPLETE;
+    }
+    return PARSEC_HOOK_RETURN_DONE;
+  }
+  return PARSEC_HOOK_RETURN_ASYNC;
+}
+
+static int __jdf2c_startup_TaskBcast(parsec_execution_stream_t * es, __parsec_Ex05_Broadcast_TaskBcast_task_t *this_task)
+{
+  __parsec_Ex05_Broadcast_TaskBcast_task_t* new_task;
+  __parsec_Ex05_Broadcast_internal_taskpool_t* __parsec_tp = (__parsec_Ex05_Broadcast_internal_taskpool_t*)this_task->taskpool;
+  parsec_context_t *context = __parsec_tp->super.super.context;
+  int vpid = 0, nb_tasks = 0;
+  size_t total_nb_tasks = 0;
+  parsec_list_item_t* pready_ring[context->nb_vp];
+  int restore_context = 0;
+  int k = this_task->locals.k.value;  /* retrieve value saved during the last iteration */
+  for(int _i = 0; _i < context->nb_vp; pready_ring[_i++] = NULL );
+  if( 0 != this_task->locals.reserved[0].value ) {
+    this_task->locals.reserved[0].value = 1; /* reset the submission process */
+    restore_context = 1;
+    goto restore_context_0;
+  }
+  this_task->locals.reserved[0].value = 1; /* a sane default value */
+  for(this_task->locals.k.value = k = 0;
+      this_task->locals.k.value <= Ex05_Broadcast_TaskBcast_inline_c_expr3_line_27(__parsec_tp, &this_task->locals);
+      this_task->locals.k.value += 1, k = this_task->locals.k.value) {
+    if( !TaskBcast_pred(k) ) continue;
+  __parsec_Ex05_Broadcast_TaskBcast_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_Ex05_Broadcast_TaskBcast_parsec_assignment_t*)&this_task->locals;
+  (void)__jdf2c__tmp_locals;
+  /* Flow for A is always a memory reference */
+    if( NULL != ((parsec_data_collection_t*)__parsec_tp->super._g_mydata)->vpid_of ) {
+      vpid = ((parsec_data_collection_t*)__parsec_tp->super._g_mydata)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_mydata, k);
+      assert(context->nb_vp >= vpid);
+    } else {
+      vpid = (vpid + 1) % context->nb_vp;  /* spread the initial joy */
+    }
+    new_task = (__parsec_Ex05_Broadcast_TaskBcast_task_t*)parsec_thread_mempool_allocate( context->virtual_processes[vpid]->execution_streams[0]->context_mempool );
+    PARSEC_OBJ_CONSTRUCT(new_task, parsec_task_t); /* construct called only when new, force-construct it again */
+    /* Copy only the valid elements from this_task to new_task one */
+    new_task->taskpool   = this_task->taskpool;
+    new_task->task_class = __parsec_tp->super.super.task_classes_array[Ex05_Broadcast_TaskBcast.task_class_id];
+    new_task->chore_mask   = PARSEC_DEV_ALL;
+    new_task->locals.k.value = this_task->locals.k.value;
+    PARSEC_LIST_ITEM_SINGLETON(new_task);
+    new_task->priority = __parsec_tp->super.super.priority;
+    new_task->repo_entry = NULL;
+    new_task->data._f_A.source_repo_entry = NULL;
+    new_task->data._f_A.source_repo       = NULL;
+    new_task->data._f_A.data_in         = NULL;
+    new_task->data._f_A.data_out        = NULL;
+    new_task->data._f_A.fulfill         = 0;
+#if defined(PARSEC_DEBUG_NOISIER)
+    {
+      char tmp[128];
+      PARSEC_DEBUG_VERBOSE(10, parsec_debug_output, "Add startup task %s to vpid %d",
+             parsec_task_snprintf(tmp, 128, (parsec_task_t*)new_task), vpid);
+    }
+#endif
+    parsec_dependencies_mark_task_as_startup((parsec_task_t*)new_task, es);
+    pready_ring[vpid] = parsec_list_item_ring_push_sorted(pready_ring[vpid],
+                                                          (parsec_list_item_t*)new_task,
+                                                          parsec_execution_context_priority_comparator);
+    nb_tasks++;
+   restore_context_0:  /* we jump here just so that we have code after the label */
+    restore_context = 0;
+    (void)restore_context;
+    if( nb_tasks > this_task->locals.reserved[0].value ) {
+      if( (size_t)this_task->locals.reserved[0].value < parsec_task_startup_iter ) this_task->locals.reserved[0].value <<= 1;
+      __parsec_schedule_vp(es, (parsec_task_t**)pready_ring, 0);
+      total_nb_tasks += nb_tasks;
+      nb_tasks = 0;
+      if( total_nb_tasks > parsec_task_startup_chunk ) {  /* stop here and request to be rescheduled */
+        return PARSEC_HOOK_RETURN_AGAIN;
+      }
+    }
+  } /* Loop on normal range k */
+  (void)vpid;
+  if( 0 != nb_tasks ) {
+    __parsec_schedule_vp(es, (parsec_task_t**)pready_ring, 0);
+    nb_tasks = 0;
+  }
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static const __parsec_chore_t __Ex05_Broadcast_TaskBcast_chores[] ={
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+    { .type     = PARSEC_DEV_CPU,
+      .evaluate = (parsec_evaluate_function_t*)NULL,
+      .hook     = (parsec_hook_t*)hook_of_Ex05_Broadcast_TaskBcast },
+#endif  /* defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+    { .type     = PARSEC_DEV_NONE,
+      .evaluate = NULL,
+      .hook     = (parsec_hook_t*)NULL },  /* End marker */
+};
+
+static const parsec_task_class_t Ex05_Broadcast_TaskBcast = {
+  .name = "TaskBcast",
+  .task_class_id = 0,
+  .nb_flows = 1,
+  .nb_parameters = 1,
+  .nb_locals = 1,
+  .task_class_type = PARSEC_TASK_CLASS_TYPE_PTG,
+  .params = { &symb_Ex05_Broadcast_TaskBcast_k, NULL },
+  .locals = { &symb_Ex05_Broadcast_TaskBcast_k, NULL },
+  .data_affinity = (parsec_data_ref_fn_t*)affinity_of_Ex05_Broadcast_TaskBcast,
+  .initial_data = (parsec_data_ref_fn_t*)affinity_of_Ex05_Broadcast_TaskBcast,
+  .final_data = (parsec_data_ref_fn_t*)affinity_of_Ex05_Broadcast_TaskBcast,
+  .priority = NULL,
+  .properties = properties_of_Ex05_Broadcast_TaskBcast,
+#if MAX_PARAM_COUNT < 1  /* number of read flows of TaskBcast */
+  #error Too many read flows for task TaskBcast
+#endif  /* MAX_PARAM_COUNT */
+#if MAX_PARAM_COUNT < 1  /* number of write flows of TaskBcast */
+  #error Too many write flows for task TaskBcast
+#endif  /* MAX_PARAM_COUNT */
+  .in = { &flow_of_Ex05_Broadcast_TaskBcast_for_A, NULL },
+  .out = { &flow_of_Ex05_Broadcast_TaskBcast_for_A, NULL },
+  .flags = 0x0 | PARSEC_HAS_IN_IN_DEPENDENCIES | PARSEC_USE_DEPS_MASK,
+  .dependencies_goal = 0x1,
+  .make_key = __jdf2c_make_key_TaskBcast,
+  .task_snprintf = parsec_task_snprintf,
+#if defined(PARSEC_PROF_TRACE)
+  .profile_info = &parsec_task_profile_info,
+#endif
+  .key_functions = &__jdf2c_key_fns_TaskBcast,
+  .fini = (parsec_hook_t*)NULL,
+  .incarnations = __Ex05_Broadcast_TaskBcast_chores,
+  .find_deps = parsec_hash_find_deps,
+  .update_deps = parsec_update_deps_with_mask,
+  .iterate_successors = (parsec_traverse_function_t*)iterate_successors_of_Ex05_Broadcast_TaskBcast,
+  .iterate_predecessors = (parsec_traverse_function_t*)NULL,
+  .release_deps = (parsec_release_deps_t*)release_deps_of_Ex05_Broadcast_TaskBcast,
+  .prepare_output = (parsec_hook_t*)NULL,
+  .prepare_input = (parsec_hook_t*)data_lookup_of_Ex05_Broadcast_TaskBcast,
+  .time_estimate = NULL,
+  .get_datatype = datatype_lookup_of_Ex05_Broadcast_TaskBcast,
+  .complete_execution = (parsec_hook_t*)complete_hook_of_Ex05_Broadcast_TaskBcast,
+  .release_task = &release_task_of_Ex05_Broadcast_TaskBcast,
+#if defined(PARSEC_SIM)
+  .sim_cost_fct = (parsec_sim_cost_fct_t*)NULL,
+#endif
+};
+
+
+static const parsec_task_class_t *Ex05_Broadcast_task_classes[] = {
+  &Ex05_Broadcast_TaskBcast,
+  &Ex05_Broadcast_TaskRecv
+};
+
+static void Ex05_Broadcast_startup(parsec_context_t *context, __parsec_Ex05_Broadcast_internal_taskpool_t *__parsec_tp, parsec_list_item_t ** ready_tasks)
+{
+  uint32_t i, supported_dev = 0;
+ 
+  for( i = 0; i < parsec_nb_devices; i++ ) {
+    if( !(__parsec_tp->super.super.devices_index_mask & (1<<i)) ) continue;
+    parsec_device_module_t* device = parsec_mca_device_get(i);
+    parsec_data_collection_t* parsec_dc;
+ 
+    if(NULL == device) continue;
+    if(NULL != device->taskpool_register)
+      if( PARSEC_SUCCESS != device->taskpool_register(device, (parsec_taskpool_t*)__parsec_tp) ) {
+        parsec_debug_verbose(5, parsec_debug_output, "Device %s refused to register taskpool %p", device->name, __parsec_tp);
+        __parsec_tp->super.super.devices_index_mask &= ~(1 << device->device_index);
+        continue;
+      }
+    if(NULL != device->memory_register) {  /* Register all the data */
+      parsec_dc = (parsec_data_collection_t*)__parsec_tp->super._g_mydata;
+      if( (NULL != parsec_dc->register_memory) &&
+          (PARSEC_SUCCESS != parsec_dc->register_memory(parsec_dc, device)) ) {
+        parsec_debug_verbose(3, parsec_debug_output, "Device %s refused to register memory for data %s (%p) from taskpool %p",
+                     device->name, parsec_dc->key_base, parsec_dc, __parsec_tp);
+        __parsec_tp->super.super.devices_index_mask &= ~(1 << device->device_index);
+      }
+    }
+    supported_dev |= device->type;
+  }
+  /* Remove all the chores without a backend device */
+  for( i = 0; i < PARSEC_Ex05_Broadcast_NB_TASK_CLASSES; i++ ) {
+    parsec_task_class_t* tc = (parsec_task_class_t*)__parsec_tp->super.super.task_classes_array[i];
+    __parsec_chore_t* chores = (__parsec_chore_t*)tc->incarnations;
+    uint32_t idx = 0, j;
+    for( j = 0; PARSEC_DEV_NONE != chores[j].type; j++ ) {
+      if( !(supported_dev & chores[j].type) ) continue;
+      if( j != idx ) {
+        chores[idx] = chores[j];
+        parsec_debug_verbose(20, parsec_debug_output, "Device type %i disabled for function %s"
+, chores[j].type, tc->name);
+      }
+      idx++;
+    }
+    chores[idx].type     = PARSEC_DEV_NONE;
+    chores[idx].evaluate = NULL;
+    chores[idx].hook     = NULL;
+    /* Create the initialization tasks for each taskclass */
+    parsec_task_t* task = (parsec_task_t*)parsec_thread_mempool_allocate(context->virtual_processes[0]->execution_streams[0]->context_mempool);
+    PARSEC_OBJ_CONSTRUCT(task, parsec_task_t); /* construct called only when new, force-construct it again */
+    task->taskpool = (parsec_taskpool_t *)__parsec_tp;
+    task->chore_mask = PARSEC_DEV_CPU;
+    memset(&task->locals, 0, sizeof(parsec_assignment_t) * MAX_LOCAL_COUNT);
+    PARSEC_LIST_ITEM_SINGLETON(task);
+    task->priority = -1;
+    task->task_class = task->taskpool->task_classes_array[PARSEC_Ex05_Broadcast_NB_TASK_CLASSES + i];
+    int where = i % context->nb_vp;
+    if( NULL == ready_tasks[where] ) ready_tasks[where] = &task->super;
+    else ready_tasks[where] = parsec_list_item_ring_push(ready_tasks[where], &task->super);
+  }
+}
+static void __parsec_Ex05_Broadcast_internal_destructor( __parsec_Ex05_Broadcast_internal_taskpool_t *__parsec_tp )
+{
+  uint32_t i;
+  parsec_taskpool_unregister( &__parsec_tp->super.super );
+  if(NULL != __parsec_tp->super.super.tdm.module) __parsec_tp->super.super.tdm.module->unmonitor_taskpool(&__parsec_tp->super.super);
+  for( i = 0; i < (uint32_t)(2 * __parsec_tp->super.super.nb_task_classes); i++ ) {  /* Extra startup function added at the end */
+    parsec_task_class_t* tc = (parsec_task_class_t*)__parsec_tp->super.super.task_classes_array[i];
+    free((void*)tc->incarnations);
+    free(tc);
+  }
+  free(__parsec_tp->super.super.task_classes_array); __parsec_tp->super.super.task_classes_array = NULL;
+  __parsec_tp->super.super.nb_task_classes = 0;
+
+  for(i = 0; i < (uint32_t)__parsec_tp->super.arenas_datatypes_size; i++) {
+    if( NULL != __parsec_tp->super.arenas_datatypes[i].arena ) {
+      PARSEC_OBJ_RELEASE(__parsec_tp->super.arenas_datatypes[i].arena);
+    }
+  }
+  /* Destroy the data repositories for this object */
+   data_repo_destroy_nothreadsafe(__parsec_tp->repositories[1]);  /* TaskRecv */
+   data_repo_destroy_nothreadsafe(__parsec_tp->repositories[0]);  /* TaskBcast */
+  /* Release the dependencies arrays for this object */
+  parsec_hash_table_fini( (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[1] );
+  PARSEC_OBJ_RELEASE(__parsec_tp->super.super.dependencies_array[1]);
+  __parsec_tp->super.super.dependencies_array[1] = NULL;
+  parsec_hash_table_fini( (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[0] );
+  PARSEC_OBJ_RELEASE(__parsec_tp->super.super.dependencies_array[0]);
+  __parsec_tp->super.super.dependencies_array[0] = NULL;
+  free( __parsec_tp->super.super.dependencies_array );
+  __parsec_tp->super.super.dependencies_array = NULL;
+  /* Unregister all the data */
+  uint32_t _i;
+  for( _i = 0; _i < parsec_nb_devices; _i++ ) {
+    parsec_device_module_t* device;
+    parsec_data_collection_t* parsec_dc;
+    if(!(__parsec_tp->super.super.devices_index_mask & (1 << _i))) continue;
+    if((NULL == (device = parsec_mca_device_get(_i))) || (NULL == device->memory_unregister)) continue;
+    parsec_dc = (parsec_data_collection_t*)__parsec_tp->super._g_mydata;
+  if( NULL != parsec_dc->unregister_memory ) { (void)parsec_dc->unregister_memory(parsec_dc, device); };
+}
+  /* Unregister the taskpool from the devices */
+  for( i = 0; i < parsec_nb_devices; i++ ) {
+    if(!(__parsec_tp->super.super.devices_index_mask & (1 << i))) continue;
+    __parsec_tp->super.super.devices_index_mask ^= (1 << i);
+    parsec_device_module_t* device = parsec_mca_device_get(i);
+    if((NULL == device) || (NULL == device->taskpool_unregister)) continue;
+    if( PARSEC_SUCCESS != device->taskpool_unregister(device, &__parsec_tp->super.super) ) continue;
+  }
+  free(__parsec_tp->super.super.taskpool_name); __parsec_tp->super.super.taskpool_name = NULL;
+}
+
+void __parsec_Ex05_Broadcast_internal_constructor(__parsec_Ex05_Broadcast_internal_taskpool_t* __parsec_tp)
+{
+  parsec_task_class_t* tc;
+  uint32_t i, j;
+
+  __parsec_tp->super.super.nb_task_classes = PARSEC_Ex05_Broadcast_NB_TASK_CLASSES;
+  __parsec_tp->super.super.devices_index_mask = PARSEC_DEVICES_ALL;
+  __parsec_tp->super.super.taskpool_name = strdup("Ex05_Broadcast");
+  parsec_termdet_open_module(&__parsec_tp->super.super, "local");
+  __parsec_tp->super.super.tdm.module->monitor_taskpool(&__parsec_tp->super.super,
+                                                        parsec_taskpool_termination_detected);
+  __parsec_tp->super.super.update_nb_runtime_task = parsec_add_fetch_runtime_task;
+  __parsec_tp->super.super.dependencies_array = (void **)
+              calloc(__parsec_tp->super.super.nb_task_classes, sizeof(void*));
+  /* Twice the size to hold the startup tasks function_t */
+  __parsec_tp->super.super.task_classes_array = (const parsec_task_class_t**)
+              calloc((2 * PARSEC_Ex05_Broadcast_NB_TASK_CLASSES + 1), sizeof(parsec_task_class_t*));
+  __parsec_tp->super.super.tdm.module->taskpool_addto_runtime_actions(&__parsec_tp->super.super, PARSEC_Ex05_Broadcast_NB_TASK_CLASSES);  /* for the startup tasks */
+  __parsec_tp->super.super.taskpool_type = PARSEC_TASKPOOL_TYPE_PTG;
+  __parsec_tp->sync_point = __parsec_tp->super.super.nb_task_classes;
+  __parsec_tp->initial_number_tasks = 0;
+  __parsec_tp->startup_queue = NULL;
+  for( i = 0; i < __parsec_tp->super.super.nb_task_classes; i++ ) {
+    __parsec_tp->super.super.task_classes_array[i] = tc = malloc(sizeof(parsec_task_class_t));
+    memcpy(tc, Ex05_Broadcast_task_classes[i], sizeof(parsec_task_class_t));
+    for( j = 0; PARSEC_DEV_NONE != tc->incarnations[j].type; j++);  /* compute the number of incarnations */
+    tc->incarnations = (__parsec_chore_t*)malloc((j+1) * sizeof(__parsec_chore_t));
+        memcpy((__parsec_chore_t*)tc->incarnations, Ex05_Broadcast_task_classes[i]->incarnations, (j+1) * sizeof(__parsec_chore_t));
+
+    /* Add a placeholder for initialization and startup task */
+    __parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+i] = tc = (parsec_task_class_t*)malloc(sizeof(parsec_task_class_t));
+    memcpy(tc, (void*)&__parsec_generic_startup, sizeof(parsec_task_class_t));
+    tc->task_class_id = __parsec_tp->super.super.nb_task_classes + i;
+    tc->incarnations = (__parsec_chore_t*)malloc(2 * sizeof(__parsec_chore_t));
+    memcpy((__parsec_chore_t*)tc->incarnations, (void*)__parsec_generic_startup.incarnations, 2 * sizeof(__parsec_chore_t));
+    tc->release_task = parsec_release_task_to_mempool_and_count_as_runtime_tasks;
+  }
+  /* Startup task for TaskRecv */
+  tc = (parsec_task_class_t *)__parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+0];
+  tc->name = "Startup for TaskRecv";
+  tc->prepare_input = (parsec_hook_t*)Ex05_Broadcast_TaskRecv_internal_init;
+  /* Startup task for TaskBcast */
+  tc = (parsec_task_class_t *)__parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+1];
+  tc->name = "Startup for TaskBcast";
+  tc->prepare_input = (parsec_hook_t*)Ex05_Broadcast_TaskBcast_internal_init;
+  ((__parsec_chore_t*)&tc->incarnations[0])->hook = (parsec_hook_t *)__jdf2c_startup_TaskBcast;
+  /* Compute the number of arenas_datatypes: */
+  /*   PARSEC_Ex05_Broadcast_DEFAULT_ARENA  ->  0 */
+  __parsec_tp->super.arenas_datatypes_size = 1;
+  memset(&__parsec_tp->super.arenas_datatypes[0], 0, __parsec_tp->super.arenas_datatypes_size*sizeof(parsec_arena_datatype_t));
+  /* If profiling is enabled, the keys for profiling */
+#  if defined(PARSEC_PROF_TRACE)
+  __parsec_tp->super.super.profiling_array = Ex05_Broadcast_profiling_array;
+  if( -2 == Ex05_Broadcast_profiling_array[0] ) {
+    #if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+parsec_profiling_add_dictionary_keyword("Ex05_Broadcast::TaskRecv::internal init", "fill:34D8D8",
+                                       0,
+                                       NULL,
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(Ex05_Broadcast_TaskRecv.task_class_id  + PARSEC_Ex05_Broadcast_NB_TASK_CLASSES)/* TaskRecv (internal init) start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(Ex05_Broadcast_TaskRecv.task_class_id  + PARSEC_Ex05_Broadcast_NB_TASK_CLASSES)/* TaskRecv (internal init) end key */]);
+#endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+parsec_profiling_add_dictionary_keyword("Ex05_Broadcast::TaskRecv", "fill:CC2828",
+                                       sizeof(parsec_task_prof_info_t)+3*sizeof(parsec_assignment_t),
+                                       "dc_key{uint64_t};priority{int32_t};dc_dataid{uint32_t};tcid{uint32_t};trc{int32_t};k{int32_t};n{int32_t};loc{int32_t}",
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(Ex05_Broadcast_TaskRecv.task_class_id) /* TaskRecv start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(Ex05_Broadcast_TaskRecv.task_class_id) /* TaskRecv end key */]);
+
+    #if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+parsec_profiling_add_dictionary_keyword("Ex05_Broadcast::TaskBcast::internal init", "fill:D83434",
+                                       0,
+                                       NULL,
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(Ex05_Broadcast_TaskBcast.task_class_id  + PARSEC_Ex05_Broadcast_NB_TASK_CLASSES)/* TaskBcast (internal init) start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(Ex05_Broadcast_TaskBcast.task_class_id  + PARSEC_Ex05_Broadcast_NB_TASK_CLASSES)/* TaskBcast (internal init) end key */]);
+#endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+parsec_profiling_add_dictionary_keyword("Ex05_Broadcast::TaskBcast", "fill:28CCCC",
+                                       sizeof(parsec_task_prof_info_t)+1*sizeof(parsec_assignment_t),
+                                       "dc_key{uint64_t};priority{int32_t};dc_dataid{uint32_t};tcid{uint32_t};trc{int32_t};k{int32_t}",
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(Ex05_Broadcast_TaskBcast.task_class_id) /* TaskBcast start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(Ex05_Broadcast_TaskBcast.task_class_id) /* TaskBcast end key */]);
+
+  }
+#  endif /* defined(PARSEC_PROF_TRACE) */
+  __parsec_tp->super.super.repo_array = __parsec_tp->repositories;
+  __parsec_tp->super.super.startup_hook = (parsec_startup_fn_t)Ex05_Broadcast_startup;
+  (void)parsec_taskpool_reserve_id((parsec_taskpool_t*)__parsec_tp);
+}
+
+  /** Generate class declaration and instance using the above constructor and destructor */
+  PARSEC_OBJ_CLASS_DECLARATION(__parsec_Ex05_Broadcast_internal_taskpool_t);
+  PARSEC_OBJ_CLASS_INSTANCE(__parsec_Ex05_Broadcast_internal_taskpool_t, parsec_Ex05_Broadcast_taskpool_t,
+                            __parsec_Ex05_Broadcast_internal_constructor, __parsec_Ex05_Broadcast_internal_destructor);
+
+#undef mydata
+#undef nodes
+#undef rank
+#undef NB
+
+parsec_Ex05_Broadcast_taskpool_t *parsec_Ex05_Broadcast_new(parsec_data_collection_t* mydata /* data mydata */, int nodes, int rank)
+{
+  __parsec_Ex05_Broadcast_internal_taskpool_t *__parsec_tp = PARSEC_OBJ_NEW(__parsec_Ex05_Broadcast_internal_taskpool_t);
+  /* Dump the hidden parameters with default values */
+  int NB;
+  /* Now the Parameter-dependent structures: */
+  __parsec_tp->super._g_mydata = mydata;
+  __parsec_tp->super._g_nodes = nodes;
+  __parsec_tp->super._g_rank = rank;
+  __parsec_tp->super._g_NB = NB = (6);
+  PARSEC_AYU_REGISTER_TASK(&Ex05_Broadcast_TaskRecv);
+  PARSEC_AYU_REGISTER_TASK(&Ex05_Broadcast_TaskBcast);
+  __parsec_tp->super.super.startup_hook = (parsec_startup_fn_t)Ex05_Broadcast_startup;
+  (void)parsec_taskpool_reserve_id((parsec_taskpool_t*)__parsec_tp);
+/* Prevent warnings related to not used hidden global variables */
+  (void)NB;
+  return (parsec_Ex05_Broadcast_taskpool_t*)__parsec_tp;
+}
+
+
+static uint32_t
+rank_of(parsec_data_collection_t *desc, ...)
+{
+    int k;
+    va_list ap;
+
+    va_start(ap, desc);
+    k = va_arg(ap, int);
+    va_end(ap);
+
+    return k % desc->nodes;
+}
+
+static int32_t
+vpid_of(parsec_data_collection_t *desc, ...)
+{
+    (void)desc;
+    return 0;
+}
+
+static parsec_data_key_t
+data_key(parsec_data_collection_t *desc, ...)
+{
+    int k;
+    va_list ap;
+    (void)desc;
+    va_start(ap, desc);
+    k = va_arg(ap, int);
+    va_end(ap);
+    return (uint64_t)k;
+}
+
+static parsec_data_t *ddata_mycounter = NULL;
+
+static parsec_data_t *
+data_of(parsec_data_collection_t *desc, ...)
+{
+    (void)desc;
+    return ddata_mycounter;
+}
+
+int main(int argc, char *argv[])
+{
+    parsec_context_t* parsec;
+    int rc;
+    int rank, world;
+    parsec_data_collection_t mydata;
+    parsec_Ex05_Broadcast_taskpool_t *tp;
+    int mycounter;
+    parsec_arena_datatype_t adt;
+
+#if defined(PARSEC_HAVE_MPI)
+    {
+        int provided;
+        MPI_Init_thread(&argc, &argv, MPI_THREAD_SERIALIZED, &provided);
+    }
+    MPI_Comm_size(MPI_COMM_WORLD, &world);
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#else
+    world = 1;
+    rank = 0;
+#endif
+
+    parsec = parsec_init(-1, &argc, &argv);
+
+    mycounter = 300 + rank;
+
+    parsec_data_collection_init(&mydata, world, rank);
+    mydata.rank_of = rank_of;
+    mydata.vpid_of = vpid_of;
+    mydata.data_key = data_key;
+    mydata.data_of = data_of;
+
+    parsec_arena_datatype_construct( &adt,
+                                     sizeof(int), PARSEC_ARENA_ALIGNMENT_SSE,
+                                     parsec_datatype_int_t );
+
+    ddata_mycounter = parsec_data_create(
+        &ddata_mycounter, &mydata, 0,
+        &mycounter, sizeof(int),
+        PARSEC_DATA_FLAG_PARSEC_MANAGED);
+
+    /**
+     * We now remove the NB parameter as it is an hidden global
+     */
+    tp = parsec_Ex05_Broadcast_new(&mydata, world, rank);
+
+    tp->arenas_datatypes[PARSEC_Ex05_Broadcast_DEFAULT_ADT_IDX] = adt;
+
+    rc = parsec_context_add_taskpool( parsec, (parsec_taskpool_t*)tp );
+    PARSEC_CHECK_ERROR(rc, "parsec_context_add_taskpool");
+    rc = parsec_context_start(parsec);
+    PARSEC_CHECK_ERROR(rc, "parsec_context_start");
+    rc = parsec_context_wait(parsec);
+    PARSEC_CHECK_ERROR(rc, "parsec_context_wait");
+
+    parsec_taskpool_free((parsec_taskpool_t*)tp);
+
+    parsec_data_destroy( ddata_mycounter );
+    parsec_data_collection_destroy( &mydata );
+
+    parsec_fini(&parsec);
+#if defined(PARSEC_HAVE_MPI)
+    MPI_Finalize();
+#endif
+
+    return 0;
+}
+
+PARSEC_OBJ_CLASS_INSTANCE(parsec_Ex05_Broadcast_taskpool_t, parsec_taskpool_t, NULL, NULL);
+
@@ -0,0 +1,121 @@
+#ifndef _Ex06_RAW_h_
+#define _Ex06_RAW_h_
+#include "parsec.h"
+#include "parsec/parsec_internal.h"
+#include "parsec/remote_dep.h"
+
+BEGIN_C_DECLS
+
+#define PARSEC_Ex06_RAW_DEFAULT_ADT_IDX    0
+#define PARSEC_Ex06_RAW_ADT_IDX_MAX       1
+typedef struct parsec_Ex06_RAW_taskpool_s {
+  parsec_taskpool_t super;
+  /* The list of globals */
+  parsec_data_collection_t* _g_mydata /* data mydata */;
+  int _g_nodes;
+  int _g_rank;
+  int _g_NB;
+  /* The array of datatypes (DEFAULT and co.) */
+  parsec_arena_datatype_t arenas_datatypes[PARSEC_Ex06_RAW_ADT_IDX_MAX];
+  uint32_t arenas_datatypes_size;
+} parsec_Ex06_RAW_taskpool_t;
+
+/** Beware that this object is not a superset of the internal object, and as a result
+ *  we should never create one directly. Instead we should rely on the creation of the
+ *  internal object (__parsec_Ex06_RAW_taskpool_t).
+ */
+PARSEC_OBJ_CLASS_DECLARATION(parsec_Ex06_RAW_taskpool_t);
+extern parsec_Ex06_RAW_taskpool_t *parsec_Ex06_RAW_new(parsec_data_collection_t* _g_mydata /* data mydata */, int _g_nodes, int _g_rank);
+
+#if MAX_LOCAL_COUNT < 1  /* number of parameters and locals TaskUpdate */
+  #error Too many parameters and local variables (1 out of MAX_LOCAL_COUNT) for task TaskUpdate
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_Ex06_RAW_TaskUpdate_assignment_s {
+  parsec_assignment_t k;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-1];
+} __parsec_Ex06_RAW_TaskUpdate_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 1  /* total number of flows for task TaskUpdate */
+  #error Too many flows (1 out of MAX_PARAM_COUNT) for task TaskUpdate
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_Ex06_RAW_TaskUpdate_data_s {
+  parsec_data_pair_t _f_A;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-1];
+} __parsec_Ex06_RAW_TaskUpdate_data_t;
+
+typedef struct __parsec_Ex06_RAW_TaskUpdate_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_Ex06_RAW_TaskUpdate_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_Ex06_RAW_TaskUpdate_data_s data;
+} __parsec_Ex06_RAW_TaskUpdate_task_t;
+
+
+#if MAX_LOCAL_COUNT < 3  /* number of parameters and locals TaskRecv */
+  #error Too many parameters and local variables (3 out of MAX_LOCAL_COUNT) for task TaskRecv
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_Ex06_RAW_TaskRecv_assignment_s {
+  parsec_assignment_t k;
+  parsec_assignment_t n;
+  parsec_assignment_t loc;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-3];
+} __parsec_Ex06_RAW_TaskRecv_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 1  /* total number of flows for task TaskRecv */
+  #error Too many flows (1 out of MAX_PARAM_COUNT) for task TaskRecv
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_Ex06_RAW_TaskRecv_data_s {
+  parsec_data_pair_t _f_A;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-1];
+} __parsec_Ex06_RAW_TaskRecv_data_t;
+
+typedef struct __parsec_Ex06_RAW_TaskRecv_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_Ex06_RAW_TaskRecv_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_Ex06_RAW_TaskRecv_data_s data;
+} __parsec_Ex06_RAW_TaskRecv_task_t;
+
+
+#if MAX_LOCAL_COUNT < 1  /* number of parameters and locals TaskBcast */
+  #error Too many parameters and local variables (1 out of MAX_LOCAL_COUNT) for task TaskBcast
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_Ex06_RAW_TaskBcast_assignment_s {
+  parsec_assignment_t k;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-1];
+} __parsec_Ex06_RAW_TaskBcast_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 1  /* total number of flows for task TaskBcast */
+  #error Too many flows (1 out of MAX_PARAM_COUNT) for task TaskBcast
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_Ex06_RAW_TaskBcast_data_s {
+  parsec_data_pair_t _f_A;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-1];
+} __parsec_Ex06_RAW_TaskBcast_data_t;
+
+typedef struct __parsec_Ex06_RAW_TaskBcast_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_Ex06_RAW_TaskBcast_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_Ex06_RAW_TaskBcast_data_s data;
+} __parsec_Ex06_RAW_TaskBcast_task_t;
+
+
+END_C_DECLS
+
+#endif /* _Ex06_RAW_h_ */ 
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dtd_example_hello_arg.dir/dtd_example_hello_arg.c.o"
+  "CMakeFiles/dtd_example_hello_arg.dir/dtd_example_hello_arg.c.o.d"
+  "dtd_example_hello_arg"
+  "dtd_example_hello_arg.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dtd_example_hello_arg.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dtd_example_hello_world.dir/dtd_example_hello_world.c.o"
+  "CMakeFiles/dtd_example_hello_world.dir/dtd_example_hello_world.c.o.d"
+  "dtd_example_hello_world"
+  "dtd_example_hello_world.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dtd_example_hello_world.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dtd_example_hello_world_untied.dir/dtd_example_hello_world_untied.c.o"
+  "CMakeFiles/dtd_example_hello_world_untied.dir/dtd_example_hello_world_untied.c.o.d"
+  "dtd_example_hello_world_untied"
+  "dtd_example_hello_world_untied.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dtd_example_hello_world_untied.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
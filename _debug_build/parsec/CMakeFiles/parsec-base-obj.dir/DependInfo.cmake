@@ -0,0 +1,50 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/parsec/class/info.c" "parsec/CMakeFiles/parsec-base-obj.dir/class/info.c.o" "gcc" "parsec/CMakeFiles/parsec-base-obj.dir/class/info.c.o.d"
+  "/root/repo/parsec/class/parsec_datacopy_future.c" "parsec/CMakeFiles/parsec-base-obj.dir/class/parsec_datacopy_future.c.o" "gcc" "parsec/CMakeFiles/parsec-base-obj.dir/class/parsec_datacopy_future.c.o.d"
+  "/root/repo/parsec/class/parsec_dequeue.c" "parsec/CMakeFiles/parsec-base-obj.dir/class/parsec_dequeue.c.o" "gcc" "parsec/CMakeFiles/parsec-base-obj.dir/class/parsec_dequeue.c.o.d"
+  "/root/repo/parsec/class/parsec_fifo.c" "parsec/CMakeFiles/parsec-base-obj.dir/class/parsec_fifo.c.o" "gcc" "parsec/CMakeFiles/parsec-base-obj.dir/class/parsec_fifo.c.o.d"
+  "/root/repo/parsec/class/parsec_future.c" "parsec/CMakeFiles/parsec-base-obj.dir/class/parsec_future.c.o" "gcc" "parsec/CMakeFiles/parsec-base-obj.dir/class/parsec_future.c.o.d"
+  "/root/repo/parsec/class/parsec_hash_table.c" "parsec/CMakeFiles/parsec-base-obj.dir/class/parsec_hash_table.c.o" "gcc" "parsec/CMakeFiles/parsec-base-obj.dir/class/parsec_hash_table.c.o.d"
+  "/root/repo/parsec/class/parsec_lifo.c" "parsec/CMakeFiles/parsec-base-obj.dir/class/parsec_lifo.c.o" "gcc" "parsec/CMakeFiles/parsec-base-obj.dir/class/parsec_lifo.c.o.d"
+  "/root/repo/parsec/class/parsec_list.c" "parsec/CMakeFiles/parsec-base-obj.dir/class/parsec_list.c.o" "gcc" "parsec/CMakeFiles/parsec-base-obj.dir/class/parsec_list.c.o.d"
+  "/root/repo/parsec/class/parsec_mpmc_ring.c" "parsec/CMakeFiles/parsec-base-obj.dir/class/parsec_mpmc_ring.c.o" "gcc" "parsec/CMakeFiles/parsec-base-obj.dir/class/parsec_mpmc_ring.c.o.d"
+  "/root/repo/parsec/class/parsec_object.c" "parsec/CMakeFiles/parsec-base-obj.dir/class/parsec_object.c.o" "gcc" "parsec/CMakeFiles/parsec-base-obj.dir/class/parsec_object.c.o.d"
+  "/root/repo/parsec/class/parsec_rwlock.c" "parsec/CMakeFiles/parsec-base-obj.dir/class/parsec_rwlock.c.o" "gcc" "parsec/CMakeFiles/parsec-base-obj.dir/class/parsec_rwlock.c.o.d"
+  "/root/repo/parsec/class/parsec_value_array.c" "parsec/CMakeFiles/parsec-base-obj.dir/class/parsec_value_array.c.o" "gcc" "parsec/CMakeFiles/parsec-base-obj.dir/class/parsec_value_array.c.o.d"
+  "/root/repo/parsec/utils/argv.c" "parsec/CMakeFiles/parsec-base-obj.dir/utils/argv.c.o" "gcc" "parsec/CMakeFiles/parsec-base-obj.dir/utils/argv.c.o.d"
+  "/root/repo/parsec/utils/atomic_external.c" "parsec/CMakeFiles/parsec-base-obj.dir/utils/atomic_external.c.o" "gcc" "parsec/CMakeFiles/parsec-base-obj.dir/utils/atomic_external.c.o.d"
+  "/root/repo/parsec/utils/cmd_line.c" "parsec/CMakeFiles/parsec-base-obj.dir/utils/cmd_line.c.o" "gcc" "parsec/CMakeFiles/parsec-base-obj.dir/utils/cmd_line.c.o.d"
+  "/root/repo/parsec/utils/colors.c" "parsec/CMakeFiles/parsec-base-obj.dir/utils/colors.c.o" "gcc" "parsec/CMakeFiles/parsec-base-obj.dir/utils/colors.c.o.d"
+  "/root/repo/parsec/utils/compress.c" "parsec/CMakeFiles/parsec-base-obj.dir/utils/compress.c.o" "gcc" "parsec/CMakeFiles/parsec-base-obj.dir/utils/compress.c.o.d"
+  "/root/repo/parsec/utils/debug.c" "parsec/CMakeFiles/parsec-base-obj.dir/utils/debug.c.o" "gcc" "parsec/CMakeFiles/parsec-base-obj.dir/utils/debug.c.o.d"
+  "/root/repo/parsec/utils/installdirs.c" "parsec/CMakeFiles/parsec-base-obj.dir/utils/installdirs.c.o" "gcc" "parsec/CMakeFiles/parsec-base-obj.dir/utils/installdirs.c.o.d"
+  "/root/repo/_debug_build/parsec/utils/keyval_lex.l.c" "parsec/CMakeFiles/parsec-base-obj.dir/utils/keyval_lex.l.c.o" "gcc" "parsec/CMakeFiles/parsec-base-obj.dir/utils/keyval_lex.l.c.o.d"
+  "/root/repo/parsec/utils/keyval_parse.c" "parsec/CMakeFiles/parsec-base-obj.dir/utils/keyval_parse.c.o" "gcc" "parsec/CMakeFiles/parsec-base-obj.dir/utils/keyval_parse.c.o.d"
+  "/root/repo/parsec/utils/mca_param.c" "parsec/CMakeFiles/parsec-base-obj.dir/utils/mca_param.c.o" "gcc" "parsec/CMakeFiles/parsec-base-obj.dir/utils/mca_param.c.o.d"
+  "/root/repo/parsec/utils/mca_param_cmd_line.c" "parsec/CMakeFiles/parsec-base-obj.dir/utils/mca_param_cmd_line.c.o" "gcc" "parsec/CMakeFiles/parsec-base-obj.dir/utils/mca_param_cmd_line.c.o.d"
+  "/root/repo/parsec/utils/mca_parse_paramfile.c" "parsec/CMakeFiles/parsec-base-obj.dir/utils/mca_parse_paramfile.c.o" "gcc" "parsec/CMakeFiles/parsec-base-obj.dir/utils/mca_parse_paramfile.c.o.d"
+  "/root/repo/parsec/utils/os_path.c" "parsec/CMakeFiles/parsec-base-obj.dir/utils/os_path.c.o" "gcc" "parsec/CMakeFiles/parsec-base-obj.dir/utils/os_path.c.o.d"
+  "/root/repo/parsec/utils/output.c" "parsec/CMakeFiles/parsec-base-obj.dir/utils/output.c.o" "gcc" "parsec/CMakeFiles/parsec-base-obj.dir/utils/output.c.o.d"
+  "/root/repo/parsec/utils/parsec_environ.c" "parsec/CMakeFiles/parsec-base-obj.dir/utils/parsec_environ.c.o" "gcc" "parsec/CMakeFiles/parsec-base-obj.dir/utils/parsec_environ.c.o.d"
+  "/root/repo/parsec/utils/process_name.c" "parsec/CMakeFiles/parsec-base-obj.dir/utils/process_name.c.o" "gcc" "parsec/CMakeFiles/parsec-base-obj.dir/utils/process_name.c.o.d"
+  "/root/repo/parsec/utils/show_help.c" "parsec/CMakeFiles/parsec-base-obj.dir/utils/show_help.c.o" "gcc" "parsec/CMakeFiles/parsec-base-obj.dir/utils/show_help.c.o.d"
+  "/root/repo/_debug_build/parsec/utils/show_help_lex.l.c" "parsec/CMakeFiles/parsec-base-obj.dir/utils/show_help_lex.l.c.o" "gcc" "parsec/CMakeFiles/parsec-base-obj.dir/utils/show_help_lex.l.c.o.d"
+  "/root/repo/parsec/utils/win_compat.c" "parsec/CMakeFiles/parsec-base-obj.dir/utils/win_compat.c.o" "gcc" "parsec/CMakeFiles/parsec-base-obj.dir/utils/win_compat.c.o.d"
+  "/root/repo/parsec/utils/zone_malloc.c" "parsec/CMakeFiles/parsec-base-obj.dir/utils/zone_malloc.c.o" "gcc" "parsec/CMakeFiles/parsec-base-obj.dir/utils/zone_malloc.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "/root/repo/_debug_build/parsec/include/fortran")
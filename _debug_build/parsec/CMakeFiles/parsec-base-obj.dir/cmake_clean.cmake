@@ -0,0 +1,73 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/parsec-base-obj.dir/class/info.c.o"
+  "CMakeFiles/parsec-base-obj.dir/class/info.c.o.d"
+  "CMakeFiles/parsec-base-obj.dir/class/parsec_datacopy_future.c.o"
+  "CMakeFiles/parsec-base-obj.dir/class/parsec_datacopy_future.c.o.d"
+  "CMakeFiles/parsec-base-obj.dir/class/parsec_dequeue.c.o"
+  "CMakeFiles/parsec-base-obj.dir/class/parsec_dequeue.c.o.d"
+  "CMakeFiles/parsec-base-obj.dir/class/parsec_fifo.c.o"
+  "CMakeFiles/parsec-base-obj.dir/class/parsec_fifo.c.o.d"
+  "CMakeFiles/parsec-base-obj.dir/class/parsec_future.c.o"
+  "CMakeFiles/parsec-base-obj.dir/class/parsec_future.c.o.d"
+  "CMakeFiles/parsec-base-obj.dir/class/parsec_hash_table.c.o"
+  "CMakeFiles/parsec-base-obj.dir/class/parsec_hash_table.c.o.d"
+  "CMakeFiles/parsec-base-obj.dir/class/parsec_lifo.c.o"
+  "CMakeFiles/parsec-base-obj.dir/class/parsec_lifo.c.o.d"
+  "CMakeFiles/parsec-base-obj.dir/class/parsec_list.c.o"
+  "CMakeFiles/parsec-base-obj.dir/class/parsec_list.c.o.d"
+  "CMakeFiles/parsec-base-obj.dir/class/parsec_mpmc_ring.c.o"
+  "CMakeFiles/parsec-base-obj.dir/class/parsec_mpmc_ring.c.o.d"
+  "CMakeFiles/parsec-base-obj.dir/class/parsec_object.c.o"
+  "CMakeFiles/parsec-base-obj.dir/class/parsec_object.c.o.d"
+  "CMakeFiles/parsec-base-obj.dir/class/parsec_rwlock.c.o"
+  "CMakeFiles/parsec-base-obj.dir/class/parsec_rwlock.c.o.d"
+  "CMakeFiles/parsec-base-obj.dir/class/parsec_value_array.c.o"
+  "CMakeFiles/parsec-base-obj.dir/class/parsec_value_array.c.o.d"
+  "CMakeFiles/parsec-base-obj.dir/utils/argv.c.o"
+  "CMakeFiles/parsec-base-obj.dir/utils/argv.c.o.d"
+  "CMakeFiles/parsec-base-obj.dir/utils/atomic_external.c.o"
+  "CMakeFiles/parsec-base-obj.dir/utils/atomic_external.c.o.d"
+  "CMakeFiles/parsec-base-obj.dir/utils/cmd_line.c.o"
+  "CMakeFiles/parsec-base-obj.dir/utils/cmd_line.c.o.d"
+  "CMakeFiles/parsec-base-obj.dir/utils/colors.c.o"
+  "CMakeFiles/parsec-base-obj.dir/utils/colors.c.o.d"
+  "CMakeFiles/parsec-base-obj.dir/utils/compress.c.o"
+  "CMakeFiles/parsec-base-obj.dir/utils/compress.c.o.d"
+  "CMakeFiles/parsec-base-obj.dir/utils/debug.c.o"
+  "CMakeFiles/parsec-base-obj.dir/utils/debug.c.o.d"
+  "CMakeFiles/parsec-base-obj.dir/utils/installdirs.c.o"
+  "CMakeFiles/parsec-base-obj.dir/utils/installdirs.c.o.d"
+  "CMakeFiles/parsec-base-obj.dir/utils/keyval_lex.l.c.o"
+  "CMakeFiles/parsec-base-obj.dir/utils/keyval_lex.l.c.o.d"
+  "CMakeFiles/parsec-base-obj.dir/utils/keyval_parse.c.o"
+  "CMakeFiles/parsec-base-obj.dir/utils/keyval_parse.c.o.d"
+  "CMakeFiles/parsec-base-obj.dir/utils/mca_param.c.o"
+  "CMakeFiles/parsec-base-obj.dir/utils/mca_param.c.o.d"
+  "CMakeFiles/parsec-base-obj.dir/utils/mca_param_cmd_line.c.o"
+  "CMakeFiles/parsec-base-obj.dir/utils/mca_param_cmd_line.c.o.d"
+  "CMakeFiles/parsec-base-obj.dir/utils/mca_parse_paramfile.c.o"
+  "CMakeFiles/parsec-base-obj.dir/utils/mca_parse_paramfile.c.o.d"
+  "CMakeFiles/parsec-base-obj.dir/utils/os_path.c.o"
+  "CMakeFiles/parsec-base-obj.dir/utils/os_path.c.o.d"
+  "CMakeFiles/parsec-base-obj.dir/utils/output.c.o"
+  "CMakeFiles/parsec-base-obj.dir/utils/output.c.o.d"
+  "CMakeFiles/parsec-base-obj.dir/utils/parsec_environ.c.o"
+  "CMakeFiles/parsec-base-obj.dir/utils/parsec_environ.c.o.d"
+  "CMakeFiles/parsec-base-obj.dir/utils/process_name.c.o"
+  "CMakeFiles/parsec-base-obj.dir/utils/process_name.c.o.d"
+  "CMakeFiles/parsec-base-obj.dir/utils/show_help.c.o"
+  "CMakeFiles/parsec-base-obj.dir/utils/show_help.c.o.d"
+  "CMakeFiles/parsec-base-obj.dir/utils/show_help_lex.l.c.o"
+  "CMakeFiles/parsec-base-obj.dir/utils/show_help_lex.l.c.o.d"
+  "CMakeFiles/parsec-base-obj.dir/utils/win_compat.c.o"
+  "CMakeFiles/parsec-base-obj.dir/utils/win_compat.c.o.d"
+  "CMakeFiles/parsec-base-obj.dir/utils/zone_malloc.c.o"
+  "CMakeFiles/parsec-base-obj.dir/utils/zone_malloc.c.o.d"
+  "utils/keyval_lex.l.c"
+  "utils/show_help_lex.l.c"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/parsec-base-obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
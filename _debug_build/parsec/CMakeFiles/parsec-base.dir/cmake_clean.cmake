@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libparsec-base.a"
+  "libparsec-base.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/parsec-base.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,188 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  "Fortran"
+  )
+# The set of files for implicit dependencies of each language:
+set(CMAKE_DEPENDS_CHECK_Fortran
+  "/root/repo/parsec/fortran/parsecf.F90" "/root/repo/_debug_build/parsec/CMakeFiles/parsec.dir/fortran/parsecf.F90.o"
+  )
+set(CMAKE_Fortran_COMPILER_ID "GNU")
+set(CMAKE_Fortran_SUBMODULE_SEP "@")
+set(CMAKE_Fortran_SUBMODULE_EXT ".smod")
+
+# Preprocessor definitions for this target.
+set(CMAKE_TARGET_DEFINITIONS_Fortran
+  "BUILDING_PARSEC"
+  "YYERROR_VERBOSE"
+  "_GNU_SOURCE"
+  "parsec_EXPORTS"
+  )
+
+# The include file search paths:
+set(CMAKE_Fortran_TARGET_INCLUDE_PATH
+  "parsec/include"
+  "."
+  "/root/repo/parsec/include"
+  "/root/repo"
+  "parsec/data_dist/matrix"
+  "parsec/data_dist/matrix/redistribute"
+  "/usr/include"
+  "/usr/lib/x86_64-linux-gnu/openmpi/include"
+  "/usr/lib/x86_64-linux-gnu/openmpi/include/openmpi"
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/parsec/arena.c" "parsec/CMakeFiles/parsec.dir/arena.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/arena.c.o.d"
+  "/root/repo/parsec/barrier.c" "parsec/CMakeFiles/parsec.dir/barrier.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/barrier.c.o.d"
+  "/root/repo/parsec/bindthread.c" "parsec/CMakeFiles/parsec.dir/bindthread.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/bindthread.c.o.d"
+  "/root/repo/parsec/checkpoint.c" "parsec/CMakeFiles/parsec.dir/checkpoint.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/checkpoint.c.o.d"
+  "/root/repo/parsec/class/info.c" "parsec/CMakeFiles/parsec.dir/class/info.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/class/info.c.o.d"
+  "/root/repo/parsec/class/parsec_datacopy_future.c" "parsec/CMakeFiles/parsec.dir/class/parsec_datacopy_future.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/class/parsec_datacopy_future.c.o.d"
+  "/root/repo/parsec/class/parsec_dequeue.c" "parsec/CMakeFiles/parsec.dir/class/parsec_dequeue.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/class/parsec_dequeue.c.o.d"
+  "/root/repo/parsec/class/parsec_fifo.c" "parsec/CMakeFiles/parsec.dir/class/parsec_fifo.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/class/parsec_fifo.c.o.d"
+  "/root/repo/parsec/class/parsec_future.c" "parsec/CMakeFiles/parsec.dir/class/parsec_future.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/class/parsec_future.c.o.d"
+  "/root/repo/parsec/class/parsec_hash_table.c" "parsec/CMakeFiles/parsec.dir/class/parsec_hash_table.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/class/parsec_hash_table.c.o.d"
+  "/root/repo/parsec/class/parsec_lifo.c" "parsec/CMakeFiles/parsec.dir/class/parsec_lifo.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/class/parsec_lifo.c.o.d"
+  "/root/repo/parsec/class/parsec_list.c" "parsec/CMakeFiles/parsec.dir/class/parsec_list.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/class/parsec_list.c.o.d"
+  "/root/repo/parsec/class/parsec_mpmc_ring.c" "parsec/CMakeFiles/parsec.dir/class/parsec_mpmc_ring.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/class/parsec_mpmc_ring.c.o.d"
+  "/root/repo/parsec/class/parsec_object.c" "parsec/CMakeFiles/parsec.dir/class/parsec_object.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/class/parsec_object.c.o.d"
+  "/root/repo/parsec/class/parsec_rwlock.c" "parsec/CMakeFiles/parsec.dir/class/parsec_rwlock.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/class/parsec_rwlock.c.o.d"
+  "/root/repo/parsec/class/parsec_value_array.c" "parsec/CMakeFiles/parsec.dir/class/parsec_value_array.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/class/parsec_value_array.c.o.d"
+  "/root/repo/parsec/compound.c" "parsec/CMakeFiles/parsec.dir/compound.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/compound.c.o.d"
+  "/root/repo/parsec/data.c" "parsec/CMakeFiles/parsec.dir/data.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/data.c.o.d"
+  "/root/repo/parsec/data_dist/hash_datadist.c" "parsec/CMakeFiles/parsec.dir/data_dist/hash_datadist.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/data_dist/hash_datadist.c.o.d"
+  "/root/repo/_debug_build/parsec/data_dist/matrix/apply.c" "parsec/CMakeFiles/parsec.dir/data_dist/matrix/apply.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/data_dist/matrix/apply.c.o.d"
+  "/root/repo/parsec/data_dist/matrix/apply_wrapper.c" "parsec/CMakeFiles/parsec.dir/data_dist/matrix/apply_wrapper.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/data_dist/matrix/apply_wrapper.c.o.d"
+  "/root/repo/_debug_build/parsec/data_dist/matrix/diag_band_to_rect.c" "parsec/CMakeFiles/parsec.dir/data_dist/matrix/diag_band_to_rect.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/data_dist/matrix/diag_band_to_rect.c.o.d"
+  "/root/repo/parsec/data_dist/matrix/grid_2Dcyclic.c" "parsec/CMakeFiles/parsec.dir/data_dist/matrix/grid_2Dcyclic.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/data_dist/matrix/grid_2Dcyclic.c.o.d"
+  "/root/repo/parsec/data_dist/matrix/map_operator.c" "parsec/CMakeFiles/parsec.dir/data_dist/matrix/map_operator.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/data_dist/matrix/map_operator.c.o.d"
+  "/root/repo/parsec/data_dist/matrix/matrix.c" "parsec/CMakeFiles/parsec.dir/data_dist/matrix/matrix.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/data_dist/matrix/matrix.c.o.d"
+  "/root/repo/_debug_build/parsec/data_dist/matrix/matrix_io.c" "parsec/CMakeFiles/parsec.dir/data_dist/matrix/matrix_io.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/data_dist/matrix/matrix_io.c.o.d"
+  "/root/repo/parsec/data_dist/matrix/matrix_io_wrapper.c" "parsec/CMakeFiles/parsec.dir/data_dist/matrix/matrix_io_wrapper.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/data_dist/matrix/matrix_io_wrapper.c.o.d"
+  "/root/repo/parsec/data_dist/matrix/matrixtypes.c" "parsec/CMakeFiles/parsec.dir/data_dist/matrix/matrixtypes.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/data_dist/matrix/matrixtypes.c.o.d"
+  "/root/repo/parsec/data_dist/matrix/redistribute/rebalance.c" "parsec/CMakeFiles/parsec.dir/data_dist/matrix/redistribute/rebalance.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/data_dist/matrix/redistribute/rebalance.c.o.d"
+  "/root/repo/_debug_build/parsec/data_dist/matrix/redistribute/redistribute.c" "parsec/CMakeFiles/parsec.dir/data_dist/matrix/redistribute/redistribute.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/data_dist/matrix/redistribute/redistribute.c.o.d"
+  "/root/repo/parsec/data_dist/matrix/redistribute/redistribute_dtd.c" "parsec/CMakeFiles/parsec.dir/data_dist/matrix/redistribute/redistribute_dtd.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/data_dist/matrix/redistribute/redistribute_dtd.c.o.d"
+  "/root/repo/_debug_build/parsec/data_dist/matrix/redistribute/redistribute_reshuffle.c" "parsec/CMakeFiles/parsec.dir/data_dist/matrix/redistribute/redistribute_reshuffle.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/data_dist/matrix/redistribute/redistribute_reshuffle.c.o.d"
+  "/root/repo/parsec/data_dist/matrix/redistribute/redistribute_wrapper.c" "parsec/CMakeFiles/parsec.dir/data_dist/matrix/redistribute/redistribute_wrapper.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/data_dist/matrix/redistribute/redistribute_wrapper.c.o.d"
+  "/root/repo/_debug_build/parsec/data_dist/matrix/reduce.c" "parsec/CMakeFiles/parsec.dir/data_dist/matrix/reduce.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/data_dist/matrix/reduce.c.o.d"
+  "/root/repo/_debug_build/parsec/data_dist/matrix/reduce_col.c" "parsec/CMakeFiles/parsec.dir/data_dist/matrix/reduce_col.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/data_dist/matrix/reduce_col.c.o.d"
+  "/root/repo/_debug_build/parsec/data_dist/matrix/reduce_row.c" "parsec/CMakeFiles/parsec.dir/data_dist/matrix/reduce_row.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/data_dist/matrix/reduce_row.c.o.d"
+  "/root/repo/parsec/data_dist/matrix/reduce_wrapper.c" "parsec/CMakeFiles/parsec.dir/data_dist/matrix/reduce_wrapper.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/data_dist/matrix/reduce_wrapper.c.o.d"
+  "/root/repo/_debug_build/parsec/data_dist/matrix/replicated_reduce.c" "parsec/CMakeFiles/parsec.dir/data_dist/matrix/replicated_reduce.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/data_dist/matrix/replicated_reduce.c.o.d"
+  "/root/repo/parsec/data_dist/matrix/replicated_reduce_wrapper.c" "parsec/CMakeFiles/parsec.dir/data_dist/matrix/replicated_reduce_wrapper.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/data_dist/matrix/replicated_reduce_wrapper.c.o.d"
+  "/root/repo/parsec/data_dist/matrix/subtile.c" "parsec/CMakeFiles/parsec.dir/data_dist/matrix/subtile.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/data_dist/matrix/subtile.c.o.d"
+  "/root/repo/parsec/data_dist/matrix/sym_two_dim_rectangle_cyclic.c" "parsec/CMakeFiles/parsec.dir/data_dist/matrix/sym_two_dim_rectangle_cyclic.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/data_dist/matrix/sym_two_dim_rectangle_cyclic.c.o.d"
+  "/root/repo/parsec/data_dist/matrix/sym_two_dim_rectangle_cyclic_band.c" "parsec/CMakeFiles/parsec.dir/data_dist/matrix/sym_two_dim_rectangle_cyclic_band.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/data_dist/matrix/sym_two_dim_rectangle_cyclic_band.c.o.d"
+  "/root/repo/parsec/data_dist/matrix/two_dim_rectangle_cyclic.c" "parsec/CMakeFiles/parsec.dir/data_dist/matrix/two_dim_rectangle_cyclic.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/data_dist/matrix/two_dim_rectangle_cyclic.c.o.d"
+  "/root/repo/parsec/data_dist/matrix/two_dim_rectangle_cyclic_band.c" "parsec/CMakeFiles/parsec.dir/data_dist/matrix/two_dim_rectangle_cyclic_band.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/data_dist/matrix/two_dim_rectangle_cyclic_band.c.o.d"
+  "/root/repo/parsec/data_dist/matrix/two_dim_rectangle_cyclic_replicated.c" "parsec/CMakeFiles/parsec.dir/data_dist/matrix/two_dim_rectangle_cyclic_replicated.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/data_dist/matrix/two_dim_rectangle_cyclic_replicated.c.o.d"
+  "/root/repo/parsec/data_dist/matrix/two_dim_tabular.c" "parsec/CMakeFiles/parsec.dir/data_dist/matrix/two_dim_tabular.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/data_dist/matrix/two_dim_tabular.c.o.d"
+  "/root/repo/parsec/data_dist/matrix/vector_two_dim_cyclic.c" "parsec/CMakeFiles/parsec.dir/data_dist/matrix/vector_two_dim_cyclic.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/data_dist/matrix/vector_two_dim_cyclic.c.o.d"
+  "/root/repo/parsec/data_distribution.c" "parsec/CMakeFiles/parsec.dir/data_distribution.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/data_distribution.c.o.d"
+  "/root/repo/parsec/datarepo.c" "parsec/CMakeFiles/parsec.dir/datarepo.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/datarepo.c.o.d"
+  "/root/repo/parsec/datatype/datatype_mpi.c" "parsec/CMakeFiles/parsec.dir/datatype/datatype_mpi.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/datatype/datatype_mpi.c.o.d"
+  "/root/repo/parsec/datatype/datatype_pack.c" "parsec/CMakeFiles/parsec.dir/datatype/datatype_pack.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/datatype/datatype_pack.c.o.d"
+  "/root/repo/parsec/debug_marks.c" "parsec/CMakeFiles/parsec.dir/debug_marks.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/debug_marks.c.o.d"
+  "/root/repo/parsec/fortran/parsecf.c" "parsec/CMakeFiles/parsec.dir/fortran/parsecf.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/fortran/parsecf.c.o.d"
+  "/root/repo/parsec/hbbuffer.c" "parsec/CMakeFiles/parsec.dir/hbbuffer.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/hbbuffer.c.o.d"
+  "/root/repo/parsec/interfaces/dtd/insert_function.c" "parsec/CMakeFiles/parsec.dir/interfaces/dtd/insert_function.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/interfaces/dtd/insert_function.c.o.d"
+  "/root/repo/parsec/interfaces/dtd/overlap_strategies.c" "parsec/CMakeFiles/parsec.dir/interfaces/dtd/overlap_strategies.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/interfaces/dtd/overlap_strategies.c.o.d"
+  "/root/repo/parsec/interfaces/dtd/parsec_dtd_data_flush.c" "parsec/CMakeFiles/parsec.dir/interfaces/dtd/parsec_dtd_data_flush.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/interfaces/dtd/parsec_dtd_data_flush.c.o.d"
+  "/root/repo/parsec/interfaces/interface.c" "parsec/CMakeFiles/parsec.dir/interfaces/interface.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/interfaces/interface.c.o.d"
+  "/root/repo/parsec/maxheap.c" "parsec/CMakeFiles/parsec.dir/maxheap.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/maxheap.c.o.d"
+  "/root/repo/parsec/mca/device/device.c" "parsec/CMakeFiles/parsec.dir/mca/device/device.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/mca/device/device.c.o.d"
+  "/root/repo/parsec/mca/mca_repository.c" "parsec/CMakeFiles/parsec.dir/mca/mca_repository.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/mca/mca_repository.c.o.d"
+  "/root/repo/parsec/mca/pins/iterators_checker/pins_iterators_checker_component.c" "parsec/CMakeFiles/parsec.dir/mca/pins/iterators_checker/pins_iterators_checker_component.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/mca/pins/iterators_checker/pins_iterators_checker_component.c.o.d"
+  "/root/repo/parsec/mca/pins/iterators_checker/pins_iterators_checker_module.c" "parsec/CMakeFiles/parsec.dir/mca/pins/iterators_checker/pins_iterators_checker_module.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/mca/pins/iterators_checker/pins_iterators_checker_module.c.o.d"
+  "/root/repo/parsec/mca/pins/pins.c" "parsec/CMakeFiles/parsec.dir/mca/pins/pins.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/mca/pins/pins.c.o.d"
+  "/root/repo/parsec/mca/pins/pins_init.c" "parsec/CMakeFiles/parsec.dir/mca/pins/pins_init.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/mca/pins/pins_init.c.o.d"
+  "/root/repo/parsec/mca/pins/print_steals/pins_print_steals_component.c" "parsec/CMakeFiles/parsec.dir/mca/pins/print_steals/pins_print_steals_component.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/mca/pins/print_steals/pins_print_steals_component.c.o.d"
+  "/root/repo/parsec/mca/pins/print_steals/pins_print_steals_module.c" "parsec/CMakeFiles/parsec.dir/mca/pins/print_steals/pins_print_steals_module.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/mca/pins/print_steals/pins_print_steals_module.c.o.d"
+  "/root/repo/parsec/mca/pins/ptg_to_dtd/pins_ptg_to_dtd_component.c" "parsec/CMakeFiles/parsec.dir/mca/pins/ptg_to_dtd/pins_ptg_to_dtd_component.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/mca/pins/ptg_to_dtd/pins_ptg_to_dtd_component.c.o.d"
+  "/root/repo/parsec/mca/pins/ptg_to_dtd/pins_ptg_to_dtd_module.c" "parsec/CMakeFiles/parsec.dir/mca/pins/ptg_to_dtd/pins_ptg_to_dtd_module.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/mca/pins/ptg_to_dtd/pins_ptg_to_dtd_module.c.o.d"
+  "/root/repo/parsec/mca/sched/ap/sched_ap_component.c" "parsec/CMakeFiles/parsec.dir/mca/sched/ap/sched_ap_component.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/mca/sched/ap/sched_ap_component.c.o.d"
+  "/root/repo/parsec/mca/sched/ap/sched_ap_module.c" "parsec/CMakeFiles/parsec.dir/mca/sched/ap/sched_ap_module.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/mca/sched/ap/sched_ap_module.c.o.d"
+  "/root/repo/parsec/mca/sched/gd/sched_gd_component.c" "parsec/CMakeFiles/parsec.dir/mca/sched/gd/sched_gd_component.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/mca/sched/gd/sched_gd_component.c.o.d"
+  "/root/repo/parsec/mca/sched/gd/sched_gd_module.c" "parsec/CMakeFiles/parsec.dir/mca/sched/gd/sched_gd_module.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/mca/sched/gd/sched_gd_module.c.o.d"
+  "/root/repo/parsec/mca/sched/ip/sched_ip_component.c" "parsec/CMakeFiles/parsec.dir/mca/sched/ip/sched_ip_component.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/mca/sched/ip/sched_ip_component.c.o.d"
+  "/root/repo/parsec/mca/sched/ip/sched_ip_module.c" "parsec/CMakeFiles/parsec.dir/mca/sched/ip/sched_ip_module.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/mca/sched/ip/sched_ip_module.c.o.d"
+  "/root/repo/parsec/mca/sched/la/sched_la_component.c" "parsec/CMakeFiles/parsec.dir/mca/sched/la/sched_la_component.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/mca/sched/la/sched_la_component.c.o.d"
+  "/root/repo/parsec/mca/sched/la/sched_la_module.c" "parsec/CMakeFiles/parsec.dir/mca/sched/la/sched_la_module.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/mca/sched/la/sched_la_module.c.o.d"
+  "/root/repo/parsec/mca/sched/lfq/sched_lfq_component.c" "parsec/CMakeFiles/parsec.dir/mca/sched/lfq/sched_lfq_component.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/mca/sched/lfq/sched_lfq_component.c.o.d"
+  "/root/repo/parsec/mca/sched/lfq/sched_lfq_module.c" "parsec/CMakeFiles/parsec.dir/mca/sched/lfq/sched_lfq_module.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/mca/sched/lfq/sched_lfq_module.c.o.d"
+  "/root/repo/parsec/mca/sched/lhq/sched_lhq_component.c" "parsec/CMakeFiles/parsec.dir/mca/sched/lhq/sched_lhq_component.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/mca/sched/lhq/sched_lhq_component.c.o.d"
+  "/root/repo/parsec/mca/sched/lhq/sched_lhq_module.c" "parsec/CMakeFiles/parsec.dir/mca/sched/lhq/sched_lhq_module.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/mca/sched/lhq/sched_lhq_module.c.o.d"
+  "/root/repo/parsec/mca/sched/ll/sched_ll_component.c" "parsec/CMakeFiles/parsec.dir/mca/sched/ll/sched_ll_component.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/mca/sched/ll/sched_ll_component.c.o.d"
+  "/root/repo/parsec/mca/sched/ll/sched_ll_module.c" "parsec/CMakeFiles/parsec.dir/mca/sched/ll/sched_ll_module.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/mca/sched/ll/sched_ll_module.c.o.d"
+  "/root/repo/parsec/mca/sched/llp/sched_llp_component.c" "parsec/CMakeFiles/parsec.dir/mca/sched/llp/sched_llp_component.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/mca/sched/llp/sched_llp_component.c.o.d"
+  "/root/repo/parsec/mca/sched/llp/sched_llp_module.c" "parsec/CMakeFiles/parsec.dir/mca/sched/llp/sched_llp_module.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/mca/sched/llp/sched_llp_module.c.o.d"
+  "/root/repo/parsec/mca/sched/ltq/sched_ltq_component.c" "parsec/CMakeFiles/parsec.dir/mca/sched/ltq/sched_ltq_component.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/mca/sched/ltq/sched_ltq_component.c.o.d"
+  "/root/repo/parsec/mca/sched/ltq/sched_ltq_module.c" "parsec/CMakeFiles/parsec.dir/mca/sched/ltq/sched_ltq_module.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/mca/sched/ltq/sched_ltq_module.c.o.d"
+  "/root/repo/parsec/mca/sched/pbq/sched_pbq_component.c" "parsec/CMakeFiles/parsec.dir/mca/sched/pbq/sched_pbq_component.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/mca/sched/pbq/sched_pbq_component.c.o.d"
+  "/root/repo/parsec/mca/sched/pbq/sched_pbq_module.c" "parsec/CMakeFiles/parsec.dir/mca/sched/pbq/sched_pbq_module.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/mca/sched/pbq/sched_pbq_module.c.o.d"
+  "/root/repo/parsec/mca/sched/rnd/sched_rnd_component.c" "parsec/CMakeFiles/parsec.dir/mca/sched/rnd/sched_rnd_component.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/mca/sched/rnd/sched_rnd_component.c.o.d"
+  "/root/repo/parsec/mca/sched/rnd/sched_rnd_module.c" "parsec/CMakeFiles/parsec.dir/mca/sched/rnd/sched_rnd_module.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/mca/sched/rnd/sched_rnd_module.c.o.d"
+  "/root/repo/parsec/mca/sched/spq/sched_spq_component.c" "parsec/CMakeFiles/parsec.dir/mca/sched/spq/sched_spq_component.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/mca/sched/spq/sched_spq_component.c.o.d"
+  "/root/repo/parsec/mca/sched/spq/sched_spq_module.c" "parsec/CMakeFiles/parsec.dir/mca/sched/spq/sched_spq_module.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/mca/sched/spq/sched_spq_module.c.o.d"
+  "/root/repo/parsec/mca/termdet/fourcounter/termdet_fourcounter_component.c" "parsec/CMakeFiles/parsec.dir/mca/termdet/fourcounter/termdet_fourcounter_component.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/mca/termdet/fourcounter/termdet_fourcounter_component.c.o.d"
+  "/root/repo/parsec/mca/termdet/fourcounter/termdet_fourcounter_module.c" "parsec/CMakeFiles/parsec.dir/mca/termdet/fourcounter/termdet_fourcounter_module.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/mca/termdet/fourcounter/termdet_fourcounter_module.c.o.d"
+  "/root/repo/parsec/mca/termdet/local/termdet_local_component.c" "parsec/CMakeFiles/parsec.dir/mca/termdet/local/termdet_local_component.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/mca/termdet/local/termdet_local_component.c.o.d"
+  "/root/repo/parsec/mca/termdet/local/termdet_local_module.c" "parsec/CMakeFiles/parsec.dir/mca/termdet/local/termdet_local_module.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/mca/termdet/local/termdet_local_module.c.o.d"
+  "/root/repo/parsec/mca/termdet/user_trigger/termdet_user_trigger_component.c" "parsec/CMakeFiles/parsec.dir/mca/termdet/user_trigger/termdet_user_trigger_component.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/mca/termdet/user_trigger/termdet_user_trigger_component.c.o.d"
+  "/root/repo/parsec/mca/termdet/user_trigger/termdet_user_trigger_module.c" "parsec/CMakeFiles/parsec.dir/mca/termdet/user_trigger/termdet_user_trigger_module.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/mca/termdet/user_trigger/termdet_user_trigger_module.c.o.d"
+  "/root/repo/parsec/mempool.c" "parsec/CMakeFiles/parsec.dir/mempool.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/mempool.c.o.d"
+  "/root/repo/parsec/parking_lot.c" "parsec/CMakeFiles/parsec.dir/parking_lot.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/parking_lot.c.o.d"
+  "/root/repo/parsec/parsec.c" "parsec/CMakeFiles/parsec.dir/parsec.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/parsec.c.o.d"
+  "/root/repo/parsec/parsec_comm_engine.c" "parsec/CMakeFiles/parsec.dir/parsec_comm_engine.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/parsec_comm_engine.c.o.d"
+  "/root/repo/parsec/parsec_hwloc.c" "parsec/CMakeFiles/parsec.dir/parsec_hwloc.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/parsec_hwloc.c.o.d"
+  "/root/repo/parsec/parsec_mpi_funnelled.c" "parsec/CMakeFiles/parsec.dir/parsec_mpi_funnelled.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/parsec_mpi_funnelled.c.o.d"
+  "/root/repo/parsec/parsec_reshape.c" "parsec/CMakeFiles/parsec.dir/parsec_reshape.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/parsec_reshape.c.o.d"
+  "/root/repo/parsec/parsec_tcp.c" "parsec/CMakeFiles/parsec.dir/parsec_tcp.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/parsec_tcp.c.o.d"
+  "/root/repo/parsec/private_mempool.c" "parsec/CMakeFiles/parsec.dir/private_mempool.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/private_mempool.c.o.d"
+  "/root/repo/parsec/profiling.c" "parsec/CMakeFiles/parsec.dir/profiling.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/profiling.c.o.d"
+  "/root/repo/parsec/remote_dep.c" "parsec/CMakeFiles/parsec.dir/remote_dep.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/remote_dep.c.o.d"
+  "/root/repo/parsec/remote_dep_mpi.c" "parsec/CMakeFiles/parsec.dir/remote_dep_mpi.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/remote_dep_mpi.c.o.d"
+  "/root/repo/parsec/scheduling.c" "parsec/CMakeFiles/parsec.dir/scheduling.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/scheduling.c.o.d"
+  "/root/repo/parsec/termdet.c" "parsec/CMakeFiles/parsec.dir/termdet.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/termdet.c.o.d"
+  "/root/repo/parsec/utils/argv.c" "parsec/CMakeFiles/parsec.dir/utils/argv.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/utils/argv.c.o.d"
+  "/root/repo/parsec/utils/atomic_external.c" "parsec/CMakeFiles/parsec.dir/utils/atomic_external.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/utils/atomic_external.c.o.d"
+  "/root/repo/parsec/utils/cmd_line.c" "parsec/CMakeFiles/parsec.dir/utils/cmd_line.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/utils/cmd_line.c.o.d"
+  "/root/repo/parsec/utils/colors.c" "parsec/CMakeFiles/parsec.dir/utils/colors.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/utils/colors.c.o.d"
+  "/root/repo/parsec/utils/compress.c" "parsec/CMakeFiles/parsec.dir/utils/compress.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/utils/compress.c.o.d"
+  "/root/repo/parsec/utils/debug.c" "parsec/CMakeFiles/parsec.dir/utils/debug.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/utils/debug.c.o.d"
+  "/root/repo/parsec/utils/installdirs.c" "parsec/CMakeFiles/parsec.dir/utils/installdirs.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/utils/installdirs.c.o.d"
+  "/root/repo/_debug_build/parsec/utils/keyval_lex.l.c" "parsec/CMakeFiles/parsec.dir/utils/keyval_lex.l.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/utils/keyval_lex.l.c.o.d"
+  "/root/repo/parsec/utils/keyval_parse.c" "parsec/CMakeFiles/parsec.dir/utils/keyval_parse.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/utils/keyval_parse.c.o.d"
+  "/root/repo/parsec/utils/mca_param.c" "parsec/CMakeFiles/parsec.dir/utils/mca_param.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/utils/mca_param.c.o.d"
+  "/root/repo/parsec/utils/mca_param_cmd_line.c" "parsec/CMakeFiles/parsec.dir/utils/mca_param_cmd_line.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/utils/mca_param_cmd_line.c.o.d"
+  "/root/repo/parsec/utils/mca_parse_paramfile.c" "parsec/CMakeFiles/parsec.dir/utils/mca_parse_paramfile.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/utils/mca_parse_paramfile.c.o.d"
+  "/root/repo/parsec/utils/os_path.c" "parsec/CMakeFiles/parsec.dir/utils/os_path.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/utils/os_path.c.o.d"
+  "/root/repo/parsec/utils/output.c" "parsec/CMakeFiles/parsec.dir/utils/output.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/utils/output.c.o.d"
+  "/root/repo/parsec/utils/parsec_environ.c" "parsec/CMakeFiles/parsec.dir/utils/parsec_environ.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/utils/parsec_environ.c.o.d"
+  "/root/repo/parsec/utils/process_name.c" "parsec/CMakeFiles/parsec.dir/utils/process_name.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/utils/process_name.c.o.d"
+  "/root/repo/parsec/utils/show_help.c" "parsec/CMakeFiles/parsec.dir/utils/show_help.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/utils/show_help.c.o.d"
+  "/root/repo/_debug_build/parsec/utils/show_help_lex.l.c" "parsec/CMakeFiles/parsec.dir/utils/show_help_lex.l.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/utils/show_help_lex.l.c.o.d"
+  "/root/repo/parsec/utils/win_compat.c" "parsec/CMakeFiles/parsec.dir/utils/win_compat.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/utils/win_compat.c.o.d"
+  "/root/repo/parsec/utils/zone_malloc.c" "parsec/CMakeFiles/parsec.dir/utils/zone_malloc.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/utils/zone_malloc.c.o.d"
+  "/root/repo/parsec/vpmap.c" "parsec/CMakeFiles/parsec.dir/vpmap.c.o" "gcc" "parsec/CMakeFiles/parsec.dir/vpmap.c.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_debug_build/parsec/libparsec.so" "/root/repo/_debug_build/parsec/libparsec.so.4.1.0"
+  "/root/repo/_debug_build/parsec/libparsec.so.4" "/root/repo/_debug_build/parsec/libparsec.so.4.1.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "/root/repo/_debug_build/parsec/include/fortran")
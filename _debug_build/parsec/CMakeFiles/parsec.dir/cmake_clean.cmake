@@ -0,0 +1,282 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/parsec.dir/arena.c.o"
+  "CMakeFiles/parsec.dir/arena.c.o.d"
+  "CMakeFiles/parsec.dir/barrier.c.o"
+  "CMakeFiles/parsec.dir/barrier.c.o.d"
+  "CMakeFiles/parsec.dir/bindthread.c.o"
+  "CMakeFiles/parsec.dir/bindthread.c.o.d"
+  "CMakeFiles/parsec.dir/checkpoint.c.o"
+  "CMakeFiles/parsec.dir/checkpoint.c.o.d"
+  "CMakeFiles/parsec.dir/class/info.c.o"
+  "CMakeFiles/parsec.dir/class/info.c.o.d"
+  "CMakeFiles/parsec.dir/class/parsec_datacopy_future.c.o"
+  "CMakeFiles/parsec.dir/class/parsec_datacopy_future.c.o.d"
+  "CMakeFiles/parsec.dir/class/parsec_dequeue.c.o"
+  "CMakeFiles/parsec.dir/class/parsec_dequeue.c.o.d"
+  "CMakeFiles/parsec.dir/class/parsec_fifo.c.o"
+  "CMakeFiles/parsec.dir/class/parsec_fifo.c.o.d"
+  "CMakeFiles/parsec.dir/class/parsec_future.c.o"
+  "CMakeFiles/parsec.dir/class/parsec_future.c.o.d"
+  "CMakeFiles/parsec.dir/class/parsec_hash_table.c.o"
+  "CMakeFiles/parsec.dir/class/parsec_hash_table.c.o.d"
+  "CMakeFiles/parsec.dir/class/parsec_lifo.c.o"
+  "CMakeFiles/parsec.dir/class/parsec_lifo.c.o.d"
+  "CMakeFiles/parsec.dir/class/parsec_list.c.o"
+  "CMakeFiles/parsec.dir/class/parsec_list.c.o.d"
+  "CMakeFiles/parsec.dir/class/parsec_mpmc_ring.c.o"
+  "CMakeFiles/parsec.dir/class/parsec_mpmc_ring.c.o.d"
+  "CMakeFiles/parsec.dir/class/parsec_object.c.o"
+  "CMakeFiles/parsec.dir/class/parsec_object.c.o.d"
+  "CMakeFiles/parsec.dir/class/parsec_rwlock.c.o"
+  "CMakeFiles/parsec.dir/class/parsec_rwlock.c.o.d"
+  "CMakeFiles/parsec.dir/class/parsec_value_array.c.o"
+  "CMakeFiles/parsec.dir/class/parsec_value_array.c.o.d"
+  "CMakeFiles/parsec.dir/compound.c.o"
+  "CMakeFiles/parsec.dir/compound.c.o.d"
+  "CMakeFiles/parsec.dir/data.c.o"
+  "CMakeFiles/parsec.dir/data.c.o.d"
+  "CMakeFiles/parsec.dir/data_dist/hash_datadist.c.o"
+  "CMakeFiles/parsec.dir/data_dist/hash_datadist.c.o.d"
+  "CMakeFiles/parsec.dir/data_dist/matrix/apply.c.o"
+  "CMakeFiles/parsec.dir/data_dist/matrix/apply.c.o.d"
+  "CMakeFiles/parsec.dir/data_dist/matrix/apply_wrapper.c.o"
+  "CMakeFiles/parsec.dir/data_dist/matrix/apply_wrapper.c.o.d"
+  "CMakeFiles/parsec.dir/data_dist/matrix/diag_band_to_rect.c.o"
+  "CMakeFiles/parsec.dir/data_dist/matrix/diag_band_to_rect.c.o.d"
+  "CMakeFiles/parsec.dir/data_dist/matrix/grid_2Dcyclic.c.o"
+  "CMakeFiles/parsec.dir/data_dist/matrix/grid_2Dcyclic.c.o.d"
+  "CMakeFiles/parsec.dir/data_dist/matrix/map_operator.c.o"
+  "CMakeFiles/parsec.dir/data_dist/matrix/map_operator.c.o.d"
+  "CMakeFiles/parsec.dir/data_dist/matrix/matrix.c.o"
+  "CMakeFiles/parsec.dir/data_dist/matrix/matrix.c.o.d"
+  "CMakeFiles/parsec.dir/data_dist/matrix/matrix_io.c.o"
+  "CMakeFiles/parsec.dir/data_dist/matrix/matrix_io.c.o.d"
+  "CMakeFiles/parsec.dir/data_dist/matrix/matrix_io_wrapper.c.o"
+  "CMakeFiles/parsec.dir/data_dist/matrix/matrix_io_wrapper.c.o.d"
+  "CMakeFiles/parsec.dir/data_dist/matrix/matrixtypes.c.o"
+  "CMakeFiles/parsec.dir/data_dist/matrix/matrixtypes.c.o.d"
+  "CMakeFiles/parsec.dir/data_dist/matrix/redistribute/rebalance.c.o"
+  "CMakeFiles/parsec.dir/data_dist/matrix/redistribute/rebalance.c.o.d"
+  "CMakeFiles/parsec.dir/data_dist/matrix/redistribute/redistribute.c.o"
+  "CMakeFiles/parsec.dir/data_dist/matrix/redistribute/redistribute.c.o.d"
+  "CMakeFiles/parsec.dir/data_dist/matrix/redistribute/redistribute_dtd.c.o"
+  "CMakeFiles/parsec.dir/data_dist/matrix/redistribute/redistribute_dtd.c.o.d"
+  "CMakeFiles/parsec.dir/data_dist/matrix/redistribute/redistribute_reshuffle.c.o"
+  "CMakeFiles/parsec.dir/data_dist/matrix/redistribute/redistribute_reshuffle.c.o.d"
+  "CMakeFiles/parsec.dir/data_dist/matrix/redistribute/redistribute_wrapper.c.o"
+  "CMakeFiles/parsec.dir/data_dist/matrix/redistribute/redistribute_wrapper.c.o.d"
+  "CMakeFiles/parsec.dir/data_dist/matrix/reduce.c.o"
+  "CMakeFiles/parsec.dir/data_dist/matrix/reduce.c.o.d"
+  "CMakeFiles/parsec.dir/data_dist/matrix/reduce_col.c.o"
+  "CMakeFiles/parsec.dir/data_dist/matrix/reduce_col.c.o.d"
+  "CMakeFiles/parsec.dir/data_dist/matrix/reduce_row.c.o"
+  "CMakeFiles/parsec.dir/data_dist/matrix/reduce_row.c.o.d"
+  "CMakeFiles/parsec.dir/data_dist/matrix/reduce_wrapper.c.o"
+  "CMakeFiles/parsec.dir/data_dist/matrix/reduce_wrapper.c.o.d"
+  "CMakeFiles/parsec.dir/data_dist/matrix/replicated_reduce.c.o"
+  "CMakeFiles/parsec.dir/data_dist/matrix/replicated_reduce.c.o.d"
+  "CMakeFiles/parsec.dir/data_dist/matrix/replicated_reduce_wrapper.c.o"
+  "CMakeFiles/parsec.dir/data_dist/matrix/replicated_reduce_wrapper.c.o.d"
+  "CMakeFiles/parsec.dir/data_dist/matrix/subtile.c.o"
+  "CMakeFiles/parsec.dir/data_dist/matrix/subtile.c.o.d"
+  "CMakeFiles/parsec.dir/data_dist/matrix/sym_two_dim_rectangle_cyclic.c.o"
+  "CMakeFiles/parsec.dir/data_dist/matrix/sym_two_dim_rectangle_cyclic.c.o.d"
+  "CMakeFiles/parsec.dir/data_dist/matrix/sym_two_dim_rectangle_cyclic_band.c.o"
+  "CMakeFiles/parsec.dir/data_dist/matrix/sym_two_dim_rectangle_cyclic_band.c.o.d"
+  "CMakeFiles/parsec.dir/data_dist/matrix/two_dim_rectangle_cyclic.c.o"
+  "CMakeFiles/parsec.dir/data_dist/matrix/two_dim_rectangle_cyclic.c.o.d"
+  "CMakeFiles/parsec.dir/data_dist/matrix/two_dim_rectangle_cyclic_band.c.o"
+  "CMakeFiles/parsec.dir/data_dist/matrix/two_dim_rectangle_cyclic_band.c.o.d"
+  "CMakeFiles/parsec.dir/data_dist/matrix/two_dim_rectangle_cyclic_replicated.c.o"
+  "CMakeFiles/parsec.dir/data_dist/matrix/two_dim_rectangle_cyclic_replicated.c.o.d"
+  "CMakeFiles/parsec.dir/data_dist/matrix/two_dim_tabular.c.o"
+  "CMakeFiles/parsec.dir/data_dist/matrix/two_dim_tabular.c.o.d"
+  "CMakeFiles/parsec.dir/data_dist/matrix/vector_two_dim_cyclic.c.o"
+  "CMakeFiles/parsec.dir/data_dist/matrix/vector_two_dim_cyclic.c.o.d"
+  "CMakeFiles/parsec.dir/data_distribution.c.o"
+  "CMakeFiles/parsec.dir/data_distribution.c.o.d"
+  "CMakeFiles/parsec.dir/datarepo.c.o"
+  "CMakeFiles/parsec.dir/datarepo.c.o.d"
+  "CMakeFiles/parsec.dir/datatype/datatype_mpi.c.o"
+  "CMakeFiles/parsec.dir/datatype/datatype_mpi.c.o.d"
+  "CMakeFiles/parsec.dir/datatype/datatype_pack.c.o"
+  "CMakeFiles/parsec.dir/datatype/datatype_pack.c.o.d"
+  "CMakeFiles/parsec.dir/debug_marks.c.o"
+  "CMakeFiles/parsec.dir/debug_marks.c.o.d"
+  "CMakeFiles/parsec.dir/fortran/parsecf.F90.o"
+  "CMakeFiles/parsec.dir/fortran/parsecf.c.o"
+  "CMakeFiles/parsec.dir/fortran/parsecf.c.o.d"
+  "CMakeFiles/parsec.dir/hbbuffer.c.o"
+  "CMakeFiles/parsec.dir/hbbuffer.c.o.d"
+  "CMakeFiles/parsec.dir/interfaces/dtd/insert_function.c.o"
+  "CMakeFiles/parsec.dir/interfaces/dtd/insert_function.c.o.d"
+  "CMakeFiles/parsec.dir/interfaces/dtd/overlap_strategies.c.o"
+  "CMakeFiles/parsec.dir/interfaces/dtd/overlap_strategies.c.o.d"
+  "CMakeFiles/parsec.dir/interfaces/dtd/parsec_dtd_data_flush.c.o"
+  "CMakeFiles/parsec.dir/interfaces/dtd/parsec_dtd_data_flush.c.o.d"
+  "CMakeFiles/parsec.dir/interfaces/interface.c.o"
+  "CMakeFiles/parsec.dir/interfaces/interface.c.o.d"
+  "CMakeFiles/parsec.dir/maxheap.c.o"
+  "CMakeFiles/parsec.dir/maxheap.c.o.d"
+  "CMakeFiles/parsec.dir/mca/device/device.c.o"
+  "CMakeFiles/parsec.dir/mca/device/device.c.o.d"
+  "CMakeFiles/parsec.dir/mca/mca_repository.c.o"
+  "CMakeFiles/parsec.dir/mca/mca_repository.c.o.d"
+  "CMakeFiles/parsec.dir/mca/pins/iterators_checker/pins_iterators_checker_component.c.o"
+  "CMakeFiles/parsec.dir/mca/pins/iterators_checker/pins_iterators_checker_component.c.o.d"
+  "CMakeFiles/parsec.dir/mca/pins/iterators_checker/pins_iterators_checker_module.c.o"
+  "CMakeFiles/parsec.dir/mca/pins/iterators_checker/pins_iterators_checker_module.c.o.d"
+  "CMakeFiles/parsec.dir/mca/pins/pins.c.o"
+  "CMakeFiles/parsec.dir/mca/pins/pins.c.o.d"
+  "CMakeFiles/parsec.dir/mca/pins/pins_init.c.o"
+  "CMakeFiles/parsec.dir/mca/pins/pins_init.c.o.d"
+  "CMakeFiles/parsec.dir/mca/pins/print_steals/pins_print_steals_component.c.o"
+  "CMakeFiles/parsec.dir/mca/pins/print_steals/pins_print_steals_component.c.o.d"
+  "CMakeFiles/parsec.dir/mca/pins/print_steals/pins_print_steals_module.c.o"
+  "CMakeFiles/parsec.dir/mca/pins/print_steals/pins_print_steals_module.c.o.d"
+  "CMakeFiles/parsec.dir/mca/pins/ptg_to_dtd/pins_ptg_to_dtd_component.c.o"
+  "CMakeFiles/parsec.dir/mca/pins/ptg_to_dtd/pins_ptg_to_dtd_component.c.o.d"
+  "CMakeFiles/parsec.dir/mca/pins/ptg_to_dtd/pins_ptg_to_dtd_module.c.o"
+  "CMakeFiles/parsec.dir/mca/pins/ptg_to_dtd/pins_ptg_to_dtd_module.c.o.d"
+  "CMakeFiles/parsec.dir/mca/sched/ap/sched_ap_component.c.o"
+  "CMakeFiles/parsec.dir/mca/sched/ap/sched_ap_component.c.o.d"
+  "CMakeFiles/parsec.dir/mca/sched/ap/sched_ap_module.c.o"
+  "CMakeFiles/parsec.dir/mca/sched/ap/sched_ap_module.c.o.d"
+  "CMakeFiles/parsec.dir/mca/sched/gd/sched_gd_component.c.o"
+  "CMakeFiles/parsec.dir/mca/sched/gd/sched_gd_component.c.o.d"
+  "CMakeFiles/parsec.dir/mca/sched/gd/sched_gd_module.c.o"
+  "CMakeFiles/parsec.dir/mca/sched/gd/sched_gd_module.c.o.d"
+  "CMakeFiles/parsec.dir/mca/sched/ip/sched_ip_component.c.o"
+  "CMakeFiles/parsec.dir/mca/sched/ip/sched_ip_component.c.o.d"
+  "CMakeFiles/parsec.dir/mca/sched/ip/sched_ip_module.c.o"
+  "CMakeFiles/parsec.dir/mca/sched/ip/sched_ip_module.c.o.d"
+  "CMakeFiles/parsec.dir/mca/sched/la/sched_la_component.c.o"
+  "CMakeFiles/parsec.dir/mca/sched/la/sched_la_component.c.o.d"
+  "CMakeFiles/parsec.dir/mca/sched/la/sched_la_module.c.o"
+  "CMakeFiles/parsec.dir/mca/sched/la/sched_la_module.c.o.d"
+  "CMakeFiles/parsec.dir/mca/sched/lfq/sched_lfq_component.c.o"
+  "CMakeFiles/parsec.dir/mca/sched/lfq/sched_lfq_component.c.o.d"
+  "CMakeFiles/parsec.dir/mca/sched/lfq/sched_lfq_module.c.o"
+  "CMakeFiles/parsec.dir/mca/sched/lfq/sched_lfq_module.c.o.d"
+  "CMakeFiles/parsec.dir/mca/sched/lhq/sched_lhq_component.c.o"
+  "CMakeFiles/parsec.dir/mca/sched/lhq/sched_lhq_component.c.o.d"
+  "CMakeFiles/parsec.dir/mca/sched/lhq/sched_lhq_module.c.o"
+  "CMakeFiles/parsec.dir/mca/sched/lhq/sched_lhq_module.c.o.d"
+  "CMakeFiles/parsec.dir/mca/sched/ll/sched_ll_component.c.o"
+  "CMakeFiles/parsec.dir/mca/sched/ll/sched_ll_component.c.o.d"
+  "CMakeFiles/parsec.dir/mca/sched/ll/sched_ll_module.c.o"
+  "CMakeFiles/parsec.dir/mca/sched/ll/sched_ll_module.c.o.d"
+  "CMakeFiles/parsec.dir/mca/sched/llp/sched_llp_component.c.o"
+  "CMakeFiles/parsec.dir/mca/sched/llp/sched_llp_component.c.o.d"
+  "CMakeFiles/parsec.dir/mca/sched/llp/sched_llp_module.c.o"
+  "CMakeFiles/parsec.dir/mca/sched/llp/sched_llp_module.c.o.d"
+  "CMakeFiles/parsec.dir/mca/sched/ltq/sched_ltq_component.c.o"
+  "CMakeFiles/parsec.dir/mca/sched/ltq/sched_ltq_component.c.o.d"
+  "CMakeFiles/parsec.dir/mca/sched/ltq/sched_ltq_module.c.o"
+  "CMakeFiles/parsec.dir/mca/sched/ltq/sched_ltq_module.c.o.d"
+  "CMakeFiles/parsec.dir/mca/sched/pbq/sched_pbq_component.c.o"
+  "CMakeFiles/parsec.dir/mca/sched/pbq/sched_pbq_component.c.o.d"
+  "CMakeFiles/parsec.dir/mca/sched/pbq/sched_pbq_module.c.o"
+  "CMakeFiles/parsec.dir/mca/sched/pbq/sched_pbq_module.c.o.d"
+  "CMakeFiles/parsec.dir/mca/sched/rnd/sched_rnd_component.c.o"
+  "CMakeFiles/parsec.dir/mca/sched/rnd/sched_rnd_component.c.o.d"
+  "CMakeFiles/parsec.dir/mca/sched/rnd/sched_rnd_module.c.o"
+  "CMakeFiles/parsec.dir/mca/sched/rnd/sched_rnd_module.c.o.d"
+  "CMakeFiles/parsec.dir/mca/sched/spq/sched_spq_component.c.o"
+  "CMakeFiles/parsec.dir/mca/sched/spq/sched_spq_component.c.o.d"
+  "CMakeFiles/parsec.dir/mca/sched/spq/sched_spq_module.c.o"
+  "CMakeFiles/parsec.dir/mca/sched/spq/sched_spq_module.c.o.d"
+  "CMakeFiles/parsec.dir/mca/termdet/fourcounter/termdet_fourcounter_component.c.o"
+  "CMakeFiles/parsec.dir/mca/termdet/fourcounter/termdet_fourcounter_component.c.o.d"
+  "CMakeFiles/parsec.dir/mca/termdet/fourcounter/termdet_fourcounter_module.c.o"
+  "CMakeFiles/parsec.dir/mca/termdet/fourcounter/termdet_fourcounter_module.c.o.d"
+  "CMakeFiles/parsec.dir/mca/termdet/local/termdet_local_component.c.o"
+  "CMakeFiles/parsec.dir/mca/termdet/local/termdet_local_component.c.o.d"
+  "CMakeFiles/parsec.dir/mca/termdet/local/termdet_local_module.c.o"
+  "CMakeFiles/parsec.dir/mca/termdet/local/termdet_local_module.c.o.d"
+  "CMakeFiles/parsec.dir/mca/termdet/user_trigger/termdet_user_trigger_component.c.o"
+  "CMakeFiles/parsec.dir/mca/termdet/user_trigger/termdet_user_trigger_component.c.o.d"
+  "CMakeFiles/parsec.dir/mca/termdet/user_trigger/termdet_user_trigger_module.c.o"
+  "CMakeFiles/parsec.dir/mca/termdet/user_trigger/termdet_user_trigger_module.c.o.d"
+  "CMakeFiles/parsec.dir/mempool.c.o"
+  "CMakeFiles/parsec.dir/mempool.c.o.d"
+  "CMakeFiles/parsec.dir/parking_lot.c.o"
+  "CMakeFiles/parsec.dir/parking_lot.c.o.d"
+  "CMakeFiles/parsec.dir/parsec.c.o"
+  "CMakeFiles/parsec.dir/parsec.c.o.d"
+  "CMakeFiles/parsec.dir/parsec_comm_engine.c.o"
+  "CMakeFiles/parsec.dir/parsec_comm_engine.c.o.d"
+  "CMakeFiles/parsec.dir/parsec_hwloc.c.o"
+  "CMakeFiles/parsec.dir/parsec_hwloc.c.o.d"
+  "CMakeFiles/parsec.dir/parsec_mpi_funnelled.c.o"
+  "CMakeFiles/parsec.dir/parsec_mpi_funnelled.c.o.d"
+  "CMakeFiles/parsec.dir/parsec_reshape.c.o"
+  "CMakeFiles/parsec.dir/parsec_reshape.c.o.d"
+  "CMakeFiles/parsec.dir/parsec_tcp.c.o"
+  "CMakeFiles/parsec.dir/parsec_tcp.c.o.d"
+  "CMakeFiles/parsec.dir/private_mempool.c.o"
+  "CMakeFiles/parsec.dir/private_mempool.c.o.d"
+  "CMakeFiles/parsec.dir/profiling.c.o"
+  "CMakeFiles/parsec.dir/profiling.c.o.d"
+  "CMakeFiles/parsec.dir/remote_dep.c.o"
+  "CMakeFiles/parsec.dir/remote_dep.c.o.d"
+  "CMakeFiles/parsec.dir/remote_dep_mpi.c.o"
+  "CMakeFiles/parsec.dir/remote_dep_mpi.c.o.d"
+  "CMakeFiles/parsec.dir/scheduling.c.o"
+  "CMakeFiles/parsec.dir/scheduling.c.o.d"
+  "CMakeFiles/parsec.dir/termdet.c.o"
+  "CMakeFiles/parsec.dir/termdet.c.o.d"
+  "CMakeFiles/parsec.dir/utils/argv.c.o"
+  "CMakeFiles/parsec.dir/utils/argv.c.o.d"
+  "CMakeFiles/parsec.dir/utils/atomic_external.c.o"
+  "CMakeFiles/parsec.dir/utils/atomic_external.c.o.d"
+  "CMakeFiles/parsec.dir/utils/cmd_line.c.o"
+  "CMakeFiles/parsec.dir/utils/cmd_line.c.o.d"
+  "CMakeFiles/parsec.dir/utils/colors.c.o"
+  "CMakeFiles/parsec.dir/utils/colors.c.o.d"
+  "CMakeFiles/parsec.dir/utils/compress.c.o"
+  "CMakeFiles/parsec.dir/utils/compress.c.o.d"
+  "CMakeFiles/parsec.dir/utils/debug.c.o"
+  "CMakeFiles/parsec.dir/utils/debug.c.o.d"
+  "CMakeFiles/parsec.dir/utils/installdirs.c.o"
+  "CMakeFiles/parsec.dir/utils/installdirs.c.o.d"
+  "CMakeFiles/parsec.dir/utils/keyval_lex.l.c.o"
+  "CMakeFiles/parsec.dir/utils/keyval_lex.l.c.o.d"
+  "CMakeFiles/parsec.dir/utils/keyval_parse.c.o"
+  "CMakeFiles/parsec.dir/utils/keyval_parse.c.o.d"
+  "CMakeFiles/parsec.dir/utils/mca_param.c.o"
+  "CMakeFiles/parsec.dir/utils/mca_param.c.o.d"
+  "CMakeFiles/parsec.dir/utils/mca_param_cmd_line.c.o"
+  "CMakeFiles/parsec.dir/utils/mca_param_cmd_line.c.o.d"
+  "CMakeFiles/parsec.dir/utils/mca_parse_paramfile.c.o"
+  "CMakeFiles/parsec.dir/utils/mca_parse_paramfile.c.o.d"
+  "CMakeFiles/parsec.dir/utils/os_path.c.o"
+  "CMakeFiles/parsec.dir/utils/os_path.c.o.d"
+  "CMakeFiles/parsec.dir/utils/output.c.o"
+  "CMakeFiles/parsec.dir/utils/output.c.o.d"
+  "CMakeFiles/parsec.dir/utils/parsec_environ.c.o"
+  "CMakeFiles/parsec.dir/utils/parsec_environ.c.o.d"
+  "CMakeFiles/parsec.dir/utils/process_name.c.o"
+  "CMakeFiles/parsec.dir/utils/process_name.c.o.d"
+  "CMakeFiles/parsec.dir/utils/show_help.c.o"
+  "CMakeFiles/parsec.dir/utils/show_help.c.o.d"
+  "CMakeFiles/parsec.dir/utils/show_help_lex.l.c.o"
+  "CMakeFiles/parsec.dir/utils/show_help_lex.l.c.o.d"
+  "CMakeFiles/parsec.dir/utils/win_compat.c.o"
+  "CMakeFiles/parsec.dir/utils/win_compat.c.o.d"
+  "CMakeFiles/parsec.dir/utils/zone_malloc.c.o"
+  "CMakeFiles/parsec.dir/utils/zone_malloc.c.o.d"
+  "CMakeFiles/parsec.dir/vpmap.c.o"
+  "CMakeFiles/parsec.dir/vpmap.c.o.d"
+  "libparsec.pdb"
+  "libparsec.so"
+  "libparsec.so.4"
+  "libparsec.so.4.1.0"
+  "utils/keyval_lex.l.c"
+  "utils/show_help_lex.l.c"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C Fortran)
+  include(CMakeFiles/parsec.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,6 @@
+# Remove fortran modules provided by this target.
+FILE(REMOVE
+  "include/fortran/parsec_f08_interfaces.mod"
+  "include/fortran/PARSEC_F08_INTERFACES.mod"
+  "CMakeFiles/parsec.dir/parsec_f08_interfaces.mod.stamp"
+  )
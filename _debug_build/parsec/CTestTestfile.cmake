@@ -0,0 +1,9 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/parsec
+# Build directory: /root/repo/_debug_build/parsec
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("interfaces/ptg")
+subdirs("data_dist")
+subdirs("fortran")
@@ -0,0 +1,335 @@
+# Install script for directory: /root/repo/parsec
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "Debug")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(NOT CMAKE_INSTALL_LOCAL_ONLY)
+  # Include the install script for the subdirectory.
+  include("/root/repo/_debug_build/parsec/interfaces/ptg/cmake_install.cmake")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/parsec/interfaces/dtd" TYPE FILE FILES "/root/repo/parsec/interfaces/dtd/insert_function.h")
+endif()
+
+if(NOT CMAKE_INSTALL_LOCAL_ONLY)
+  # Include the install script for the subdirectory.
+  include("/root/repo/_debug_build/parsec/data_dist/cmake_install.cmake")
+endif()
+
+if(NOT CMAKE_INSTALL_LOCAL_ONLY)
+  # Include the install script for the subdirectory.
+  include("/root/repo/_debug_build/parsec/fortran/cmake_install.cmake")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  foreach(file
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libparsec.so.4.1.0"
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libparsec.so.4"
+      )
+    if(EXISTS "${file}" AND
+       NOT IS_SYMLINK "${file}")
+      file(RPATH_CHECK
+           FILE "${file}"
+           RPATH "/usr/local/lib:/usr/lib/x86_64-linux-gnu/openmpi/lib")
+    endif()
+  endforeach()
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE SHARED_LIBRARY FILES
+    "/root/repo/_debug_build/parsec/libparsec.so.4.1.0"
+    "/root/repo/_debug_build/parsec/libparsec.so.4"
+    )
+  foreach(file
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libparsec.so.4.1.0"
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libparsec.so.4"
+      )
+    if(EXISTS "${file}" AND
+       NOT IS_SYMLINK "${file}")
+      file(RPATH_CHANGE
+           FILE "${file}"
+           OLD_RPATH "/usr/lib/x86_64-linux-gnu/openmpi/lib:::::::::::::::"
+           NEW_RPATH "/usr/local/lib:/usr/lib/x86_64-linux-gnu/openmpi/lib")
+      if(CMAKE_INSTALL_DO_STRIP)
+        execute_process(COMMAND "/usr/bin/strip" "${file}")
+      endif()
+    endif()
+  endforeach()
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libparsec.so" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libparsec.so")
+    file(RPATH_CHECK
+         FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libparsec.so"
+         RPATH "/usr/local/lib:/usr/lib/x86_64-linux-gnu/openmpi/lib")
+  endif()
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE SHARED_LIBRARY FILES "/root/repo/_debug_build/parsec/libparsec.so")
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libparsec.so" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libparsec.so")
+    file(RPATH_CHANGE
+         FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libparsec.so"
+         OLD_RPATH "/usr/lib/x86_64-linux-gnu/openmpi/lib:::::::::::::::"
+         NEW_RPATH "/usr/local/lib:/usr/lib/x86_64-linux-gnu/openmpi/lib")
+    if(CMAKE_INSTALL_DO_STRIP)
+      execute_process(COMMAND "/usr/bin/strip" "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libparsec.so")
+    endif()
+  endif()
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include" TYPE FILE FILES "/root/repo/parsec/include/parsec.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/parsec/mca/device" TYPE FILE FILES "/root/repo/parsec/mca/device/device.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/parsec/mca/device" TYPE FILE FILES "/root/repo/parsec/mca/device/device_gpu.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/parsec/mca/pins" TYPE FILE FILES "/root/repo/parsec/mca/pins/pins.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/parsec/mca" TYPE FILE FILES "/root/repo/parsec/mca/mca.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/parsec/mca/termdet" TYPE FILE FILES "/root/repo/parsec/mca/termdet/termdet.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/parsec/interfaces/dtd" TYPE FILE FILES "/root/repo/parsec/interfaces/dtd/insert_function_internal.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/parsec/interfaces" TYPE FILE FILES "/root/repo/parsec/interfaces/interface.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/parsec/data_dist/matrix/redistribute" TYPE FILE FILES "/root/repo/parsec/data_dist/matrix/redistribute/redistribute_internal.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/parsec/data_dist/matrix/redistribute" TYPE FILE FILES "/root/repo/parsec/data_dist/matrix/redistribute/rebalance.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/parsec/data_dist/matrix" TYPE FILE FILES "/root/repo/_debug_build/parsec/data_dist/matrix/diag_band_to_rect.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/parsec/data_dist/matrix" TYPE FILE FILES "/root/repo/parsec/data_dist/matrix/matrix.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/parsec/data_dist/matrix" TYPE FILE FILES "/root/repo/parsec/data_dist/matrix/two_dim_rectangle_cyclic.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/parsec/data_dist/matrix" TYPE FILE FILES "/root/repo/parsec/data_dist/matrix/two_dim_rectangle_cyclic_band.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/parsec/data_dist/matrix" TYPE FILE FILES "/root/repo/parsec/data_dist/matrix/two_dim_rectangle_cyclic_replicated.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/parsec/data_dist/matrix" TYPE FILE FILES "/root/repo/parsec/data_dist/matrix/sym_two_dim_rectangle_cyclic.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/parsec/data_dist/matrix" TYPE FILE FILES "/root/repo/parsec/data_dist/matrix/sym_two_dim_rectangle_cyclic_band.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/parsec/data_dist/matrix" TYPE FILE FILES "/root/repo/parsec/data_dist/matrix/vector_two_dim_cyclic.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/parsec/data_dist/matrix" TYPE FILE FILES "/root/repo/parsec/data_dist/matrix/two_dim_tabular.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/parsec/data_dist/matrix" TYPE FILE FILES "/root/repo/parsec/data_dist/matrix/grid_2Dcyclic.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/parsec/data_dist/matrix" TYPE FILE FILES "/root/repo/parsec/data_dist/matrix/subtile.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/parsec/data_dist/matrix/deprecated" TYPE FILE FILES "/root/repo/parsec/data_dist/matrix/deprecated/grid_2Dcyclic.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/parsec/data_dist/matrix/deprecated" TYPE FILE FILES "/root/repo/parsec/data_dist/matrix/deprecated/sym_two_dim_rectangle_cyclic_band.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/parsec/data_dist/matrix/deprecated" TYPE FILE FILES "/root/repo/parsec/data_dist/matrix/deprecated/two_dim_rectangle_cyclic_band.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/parsec/data_dist/matrix/deprecated" TYPE FILE FILES "/root/repo/parsec/data_dist/matrix/deprecated/two_dim_tabular.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/parsec/data_dist/matrix/deprecated" TYPE FILE FILES "/root/repo/parsec/data_dist/matrix/deprecated/matrix.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/parsec/data_dist/matrix/deprecated" TYPE FILE FILES "/root/repo/parsec/data_dist/matrix/deprecated/sym_two_dim_rectangle_cyclic.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/parsec/data_dist/matrix/deprecated" TYPE FILE FILES "/root/repo/parsec/data_dist/matrix/deprecated/two_dim_rectangle_cyclic.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/parsec/data_dist/matrix/deprecated" TYPE FILE FILES "/root/repo/parsec/data_dist/matrix/deprecated/vector_two_dim_cyclic.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/parsec/data_dist" TYPE FILE FILES "/root/repo/parsec/data_dist/hash_datadist.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/share/parsec" TYPE FILE FILES "/root/repo/parsec/utils/help-mca-param.txt")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/parsec" TYPE FILE FILES
+    "/root/repo/parsec/runtime.h"
+    "/root/repo/parsec/include/parsec/ayudame.h"
+    "/root/repo/parsec/include/parsec/constants.h"
+    "/root/repo/parsec/include/parsec/parsec_config_bottom.h"
+    "/root/repo/parsec/include/parsec/data_distribution.h"
+    "/root/repo/parsec/datatype.h"
+    "/root/repo/parsec/profiling.h"
+    "/root/repo/parsec/dictionary.h"
+    "/root/repo/parsec/data.h"
+    "/root/repo/parsec/checkpoint.h"
+    "/root/repo/parsec/private_mempool.h"
+    "/root/repo/parsec/bindthread.h"
+    "/root/repo/parsec/parsec_comm_engine.h"
+    "/root/repo/parsec/include/parsec/deprecated.h"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/parsec/utils" TYPE FILE FILES
+    "/root/repo/parsec/utils/output.h"
+    "/root/repo/parsec/utils/debug.h"
+    "/root/repo/parsec/utils/mca_param.h"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/parsec/class" TYPE FILE FILES
+    "/root/repo/parsec/class/parsec_object.h"
+    "/root/repo/parsec/class/parsec_hash_table.h"
+    "/root/repo/parsec/class/list_item.h"
+    "/root/repo/parsec/class/parsec_rwlock.h"
+    "/root/repo/parsec/class/fifo.h"
+    "/root/repo/parsec/class/barrier.h"
+    "/root/repo/parsec/class/list.h"
+    "/root/repo/parsec/class/info.h"
+    "/root/repo/parsec/class/parsec_future.h"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/parsec" TYPE FILE FILES
+    "/root/repo/parsec/scheduling.h"
+    "/root/repo/parsec/recursive.h"
+    "/root/repo/parsec/remote_dep.h"
+    "/root/repo/parsec/include/parsec/parsec_description_structures.h"
+    "/root/repo/parsec/datarepo.h"
+    "/root/repo/parsec/mempool.h"
+    "/root/repo/parsec/data_internal.h"
+    "/root/repo/parsec/arena.h"
+    "/root/repo/parsec/include/parsec/execution_stream.h"
+    "/root/repo/parsec/parsec_internal.h"
+    "/root/repo/parsec/vpmap.h"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/parsec" TYPE FILE FILES
+    "/root/repo/parsec/parsec_binary_profile.h"
+    "/root/repo/parsec/hbbuffer.h"
+    "/root/repo/parsec/include/parsec/os-spec-timing.h"
+    "/root/repo/parsec/maxheap.h"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/parsec/mca/pins" TYPE FILE FILES
+    "/root/repo/parsec/mca/pins/pins_papi_utils.h"
+    "/root/repo/parsec/mca/pins/pins_tau_utils.h"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/parsec/utils" TYPE FILE FILES
+    "/root/repo/parsec/utils/argv.h"
+    "/root/repo/parsec/utils/cmd_line.h"
+    "/root/repo/parsec/utils/parsec_environ.h"
+    "/root/repo/parsec/utils/mca_param_cmd_line.h"
+    "/root/repo/parsec/utils/os_path.h"
+    "/root/repo/parsec/utils/process_name.h"
+    "/root/repo/parsec/utils/output.h"
+    "/root/repo/parsec/utils/show_help.h"
+    "/root/repo/parsec/utils/zone_malloc.h"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/parsec/class" TYPE FILE FILES
+    "/root/repo/parsec/class/dequeue.h"
+    "/root/repo/parsec/class/mpmc_ring.h"
+    "/root/repo/parsec/class/fifo.h"
+    )
+endif()
+
@@ -0,0 +1,7 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/parsec/data_dist
+# Build directory: /root/repo/_debug_build/parsec/data_dist
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("matrix")
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ptgpp_parsec.apply"
+  "apply.c"
+  "apply.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ptgpp_parsec.apply.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
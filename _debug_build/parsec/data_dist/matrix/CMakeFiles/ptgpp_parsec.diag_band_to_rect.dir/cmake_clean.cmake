@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ptgpp_parsec.diag_band_to_rect"
+  "diag_band_to_rect.c"
+  "diag_band_to_rect.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ptgpp_parsec.diag_band_to_rect.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ptgpp_parsec.matrix_io"
+  "matrix_io.c"
+  "matrix_io.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ptgpp_parsec.matrix_io.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
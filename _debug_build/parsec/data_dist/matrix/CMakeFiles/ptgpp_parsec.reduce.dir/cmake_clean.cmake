@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ptgpp_parsec.reduce"
+  "reduce.c"
+  "reduce.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ptgpp_parsec.reduce.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ptgpp_parsec.reduce_col"
+  "reduce_col.c"
+  "reduce_col.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ptgpp_parsec.reduce_col.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ptgpp_parsec.reduce_row"
+  "reduce_row.c"
+  "reduce_row.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ptgpp_parsec.reduce_row.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
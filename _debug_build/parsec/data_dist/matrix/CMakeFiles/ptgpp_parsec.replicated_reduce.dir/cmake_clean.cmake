@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ptgpp_parsec.replicated_reduce"
+  "replicated_reduce.c"
+  "replicated_reduce.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ptgpp_parsec.replicated_reduce.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
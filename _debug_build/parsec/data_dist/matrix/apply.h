@@ -0,0 +1,123 @@
+#ifndef _apply_h_
+#define _apply_h_
+#include "parsec.h"
+#include "parsec/parsec_internal.h"
+#include "parsec/remote_dep.h"
+
+BEGIN_C_DECLS
+
+#define PARSEC_apply_DEFAULT_ADT_IDX    0
+#define PARSEC_apply_ADT_IDX_MAX       1
+typedef struct parsec_apply_taskpool_s {
+  parsec_taskpool_t super;
+  /* The list of globals */
+  int _g_uplo;
+  parsec_tiled_matrix_t* _g_descA /* data descA */;
+  parsec_tiled_matrix_unary_op_t _g_operation;
+  void * _g_op_args;
+  int _g_matrix_upper;
+  int _g_matrix_lower;
+  /* The array of datatypes (DEFAULT and co.) */
+  parsec_arena_datatype_t arenas_datatypes[PARSEC_apply_ADT_IDX_MAX];
+  uint32_t arenas_datatypes_size;
+} parsec_apply_taskpool_t;
+
+/** Beware that this object is not a superset of the internal object, and as a result
+ *  we should never create one directly. Instead we should rely on the creation of the
+ *  internal object (__parsec_apply_taskpool_t).
+ */
+PARSEC_OBJ_CLASS_DECLARATION(parsec_apply_taskpool_t);
+extern parsec_apply_taskpool_t *parsec_apply_new(int _g_uplo, parsec_tiled_matrix_t* _g_descA /* data descA */, parsec_tiled_matrix_unary_op_t _g_operation, void * _g_op_args);
+
+#if MAX_LOCAL_COUNT < 1  /* number of parameters and locals APPLY_DIAG */
+  #error Too many parameters and local variables (1 out of MAX_LOCAL_COUNT) for task APPLY_DIAG
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_apply_APPLY_DIAG_assignment_s {
+  parsec_assignment_t k;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-1];
+} __parsec_apply_APPLY_DIAG_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 1  /* total number of flows for task APPLY_DIAG */
+  #error Too many flows (1 out of MAX_PARAM_COUNT) for task APPLY_DIAG
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_apply_APPLY_DIAG_data_s {
+  parsec_data_pair_t _f_A;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-1];
+} __parsec_apply_APPLY_DIAG_data_t;
+
+typedef struct __parsec_apply_APPLY_DIAG_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_apply_APPLY_DIAG_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_apply_APPLY_DIAG_data_s data;
+} __parsec_apply_APPLY_DIAG_task_t;
+
+
+#if MAX_LOCAL_COUNT < 2  /* number of parameters and locals APPLY_U */
+  #error Too many parameters and local variables (2 out of MAX_LOCAL_COUNT) for task APPLY_U
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_apply_APPLY_U_assignment_s {
+  parsec_assignment_t m;
+  parsec_assignment_t n;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-2];
+} __parsec_apply_APPLY_U_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 1  /* total number of flows for task APPLY_U */
+  #error Too many flows (1 out of MAX_PARAM_COUNT) for task APPLY_U
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_apply_APPLY_U_data_s {
+  parsec_data_pair_t _f_A;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-1];
+} __parsec_apply_APPLY_U_data_t;
+
+typedef struct __parsec_apply_APPLY_U_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_apply_APPLY_U_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_apply_APPLY_U_data_s data;
+} __parsec_apply_APPLY_U_task_t;
+
+
+#if MAX_LOCAL_COUNT < 2  /* number of parameters and locals APPLY_L */
+  #error Too many parameters and local variables (2 out of MAX_LOCAL_COUNT) for task APPLY_L
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_apply_APPLY_L_assignment_s {
+  parsec_assignment_t m;
+  parsec_assignment_t n;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-2];
+} __parsec_apply_APPLY_L_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 1  /* total number of flows for task APPLY_L */
+  #error Too many flows (1 out of MAX_PARAM_COUNT) for task APPLY_L
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_apply_APPLY_L_data_s {
+  parsec_data_pair_t _f_A;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-1];
+} __parsec_apply_APPLY_L_data_t;
+
+typedef struct __parsec_apply_APPLY_L_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_apply_APPLY_L_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_apply_APPLY_L_data_s data;
+} __parsec_apply_APPLY_L_task_t;
+
+
+END_C_DECLS
+
+#endif /* _apply_h_ */ 
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ptgpp_parsec.redistribute"
+  "redistribute.c"
+  "redistribute.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ptgpp_parsec.redistribute.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ptgpp_parsec.redistribute_reshuffle"
+  "redistribute_reshuffle.c"
+  "redistribute_reshuffle.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ptgpp_parsec.redistribute_reshuffle.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/parsec/data_dist/matrix/redistribute
+# Build directory: /root/repo/_debug_build/parsec/data_dist/matrix/redistribute
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
@@ -0,0 +1,247 @@
+#ifndef _redistribute_h_
+#define _redistribute_h_
+#include "parsec.h"
+#include "parsec/parsec_internal.h"
+#include "parsec/remote_dep.h"
+
+BEGIN_C_DECLS
+
+#define PARSEC_redistribute_DEFAULT_ADT_IDX    0
+#define PARSEC_redistribute_TARGET_ADT_IDX    1
+#define PARSEC_redistribute_INNER_ADT_IDX    2
+#define PARSEC_redistribute_ADT_IDX_MAX       3
+typedef struct parsec_redistribute_taskpool_s {
+  parsec_taskpool_t super;
+  /* The list of globals */
+  parsec_tiled_matrix_t* _g_descY /* data descY */;
+  parsec_tiled_matrix_t* _g_descT /* data descT */;
+  int _g_size_row;
+  int _g_size_col;
+  int _g_disi_Y;
+  int _g_disj_Y;
+  int _g_disi_T;
+  int _g_disj_T;
+  int _g_R;
+  int _g_mb_Y_INNER;
+  int _g_nb_Y_INNER;
+  int _g_mb_T_INNER;
+  int _g_nb_T_INNER;
+  int _g_m_T_START;
+  int _g_n_T_START;
+  int _g_m_T_END;
+  int _g_n_T_END;
+  int _g_num_col;
+  int _g_NT;
+  /* The array of datatypes (DEFAULT,TARGET,INNER and co.) */
+  parsec_arena_datatype_t arenas_datatypes[PARSEC_redistribute_ADT_IDX_MAX];
+  uint32_t arenas_datatypes_size;
+} parsec_redistribute_taskpool_t;
+
+/** Beware that this object is not a superset of the internal object, and as a result
+ *  we should never create one directly. Instead we should rely on the creation of the
+ *  internal object (__parsec_redistribute_taskpool_t).
+ */
+PARSEC_OBJ_CLASS_DECLARATION(parsec_redistribute_taskpool_t);
+extern parsec_redistribute_taskpool_t *parsec_redistribute_new(parsec_tiled_matrix_t* _g_descY /* data descY */, parsec_tiled_matrix_t* _g_descT /* data descT */, int _g_size_row, int _g_size_col, int _g_disi_Y, int _g_disj_Y, int _g_disi_T, int _g_disj_T, int _g_R);
+
+#if MAX_LOCAL_COUNT < 16  /* number of parameters and locals Receive */
+  #error Too many parameters and local variables (16 out of MAX_LOCAL_COUNT) for task Receive
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_redistribute_Receive_assignment_s {
+  parsec_assignment_t batch_col;
+  parsec_assignment_t m_T;
+  parsec_assignment_t n_T;
+  parsec_assignment_t mb_T_inner;
+  parsec_assignment_t nb_T_inner;
+  parsec_assignment_t nb_T_inner_next;
+  parsec_assignment_t sizei_T;
+  parsec_assignment_t sizej_T;
+  parsec_assignment_t i_start;
+  parsec_assignment_t j_start;
+  parsec_assignment_t m_Y_start;
+  parsec_assignment_t n_Y_start;
+  parsec_assignment_t m_Y_end;
+  parsec_assignment_t n_Y_end;
+  parsec_assignment_t n_Y_start_next;
+  parsec_assignment_t n_Y_end_next;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-16];
+} __parsec_redistribute_Receive_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 3  /* total number of flows for task Receive */
+  #error Too many flows (3 out of MAX_PARAM_COUNT) for task Receive
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_redistribute_Receive_data_s {
+  parsec_data_pair_t _f_T;
+  parsec_data_pair_t _f_ctl1;
+  parsec_data_pair_t _f_ctl2;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-3];
+} __parsec_redistribute_Receive_data_t;
+
+typedef struct __parsec_redistribute_Receive_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_redistribute_Receive_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_redistribute_Receive_data_s data;
+} __parsec_redistribute_Receive_task_t;
+
+
+#if MAX_LOCAL_COUNT < 19  /* number of parameters and locals Update */
+  #error Too many parameters and local variables (19 out of MAX_LOCAL_COUNT) for task Update
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_redistribute_Update_assignment_s {
+  parsec_assignment_t batch_col;
+  parsec_assignment_t m_T;
+  parsec_assignment_t n_T;
+  parsec_assignment_t mb_T_inner;
+  parsec_assignment_t nb_T_inner;
+  parsec_assignment_t i_start;
+  parsec_assignment_t j_start;
+  parsec_assignment_t m_Y_start;
+  parsec_assignment_t n_Y_start;
+  parsec_assignment_t m_Y_end;
+  parsec_assignment_t n_Y_end;
+  parsec_assignment_t m_Y;
+  parsec_assignment_t n_Y;
+  parsec_assignment_t TL_row;
+  parsec_assignment_t TL_col;
+  parsec_assignment_t BR_row;
+  parsec_assignment_t BR_col;
+  parsec_assignment_t rank_Y;
+  parsec_assignment_t rank_T;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-19];
+} __parsec_redistribute_Update_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 11  /* total number of flows for task Update */
+  #error Too many flows (11 out of MAX_PARAM_COUNT) for task Update
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_redistribute_Update_data_s {
+  parsec_data_pair_t _f_T;
+  parsec_data_pair_t _f_NW;
+  parsec_data_pair_t _f_NE;
+  parsec_data_pair_t _f_SW;
+  parsec_data_pair_t _f_SE;
+  parsec_data_pair_t _f_N;
+  parsec_data_pair_t _f_S;
+  parsec_data_pair_t _f_W;
+  parsec_data_pair_t _f_E;
+  parsec_data_pair_t _f_I;
+  parsec_data_pair_t _f_ctl;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-11];
+} __parsec_redistribute_Update_data_t;
+
+typedef struct __parsec_redistribute_Update_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_redistribute_Update_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_redistribute_Update_data_s data;
+} __parsec_redistribute_Update_task_t;
+
+
+#if MAX_LOCAL_COUNT < 19  /* number of parameters and locals Send */
+  #error Too many parameters and local variables (19 out of MAX_LOCAL_COUNT) for task Send
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_redistribute_Send_assignment_s {
+  parsec_assignment_t batch_col;
+  parsec_assignment_t m_T;
+  parsec_assignment_t n_T;
+  parsec_assignment_t mb_T_inner;
+  parsec_assignment_t nb_T_inner;
+  parsec_assignment_t i_start;
+  parsec_assignment_t j_start;
+  parsec_assignment_t m_Y_start;
+  parsec_assignment_t n_Y_start;
+  parsec_assignment_t m_Y_end;
+  parsec_assignment_t n_Y_end;
+  parsec_assignment_t m_Y;
+  parsec_assignment_t n_Y;
+  parsec_assignment_t TL_row;
+  parsec_assignment_t TL_col;
+  parsec_assignment_t BR_row;
+  parsec_assignment_t BR_col;
+  parsec_assignment_t rank_Y;
+  parsec_assignment_t rank_T;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-19];
+} __parsec_redistribute_Send_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 10  /* total number of flows for task Send */
+  #error Too many flows (10 out of MAX_PARAM_COUNT) for task Send
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_redistribute_Send_data_s {
+  parsec_data_pair_t _f_Y;
+  parsec_data_pair_t _f_NW;
+  parsec_data_pair_t _f_NE;
+  parsec_data_pair_t _f_SW;
+  parsec_data_pair_t _f_SE;
+  parsec_data_pair_t _f_N;
+  parsec_data_pair_t _f_S;
+  parsec_data_pair_t _f_W;
+  parsec_data_pair_t _f_E;
+  parsec_data_pair_t _f_ctl;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-10];
+} __parsec_redistribute_Send_data_t;
+
+typedef struct __parsec_redistribute_Send_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_redistribute_Send_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_redistribute_Send_data_s data;
+} __parsec_redistribute_Send_task_t;
+
+
+#if MAX_LOCAL_COUNT < 11  /* number of parameters and locals Init */
+  #error Too many parameters and local variables (11 out of MAX_LOCAL_COUNT) for task Init
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_redistribute_Init_assignment_s {
+  parsec_assignment_t batch_col;
+  parsec_assignment_t m_T;
+  parsec_assignment_t n_T;
+  parsec_assignment_t mb_T_inner;
+  parsec_assignment_t nb_T_inner;
+  parsec_assignment_t sizei_T;
+  parsec_assignment_t sizej_T;
+  parsec_assignment_t m_Y_start;
+  parsec_assignment_t n_Y_start;
+  parsec_assignment_t m_Y_end;
+  parsec_assignment_t n_Y_end;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-11];
+} __parsec_redistribute_Init_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 1  /* total number of flows for task Init */
+  #error Too many flows (1 out of MAX_PARAM_COUNT) for task Init
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_redistribute_Init_data_s {
+  parsec_data_pair_t _f_T;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-1];
+} __parsec_redistribute_Init_data_t;
+
+typedef struct __parsec_redistribute_Init_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_redistribute_Init_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_redistribute_Init_data_s data;
+} __parsec_redistribute_Init_task_t;
+
+
+END_C_DECLS
+
+#endif /* _redistribute_h_ */ 
@@ -0,0 +1,3466 @@
+#include "parsec.h"
+#include "parsec/parsec_internal.h"
+#include "parsec/ayudame.h"
+#include "parsec/execution_stream.h"
+#include "parsec/parsec_binary_profile.h"
+#include "parsec/mca/device/device_gpu.h"
+#if defined(PARSEC_HAVE_DEV_CUDA_SUPPORT)
+#include "parsec/mca/device/cuda/device_cuda.h"
+#endif  /* defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) */
+#if defined(PARSEC_HAVE_DEV_HIP_SUPPORT)
+#include "parsec/mca/device/hip/device_hip.h"
+#endif  /* defined(PARSEC_HAVE_DEV_HIP_SUPPORT) */
+#if defined(_MSC_VER) || defined(__MINGW32__)
+#  include <malloc.h>
+#else
+#  include <alloca.h>
+#endif  /* defined(_MSC_VER) || defined(__MINGW32__) */
+
+#define PARSEC_redistribute_reshuffle_NB_TASK_CLASSES 2
+#define PARSEC_redistribute_reshuffle_NB_DATA 2
+
+typedef struct __parsec_redistribute_reshuffle_internal_taskpool_s __parsec_redistribute_reshuffle_internal_taskpool_t;
+struct parsec_redistribute_reshuffle_internal_taskpool_s;
+
+/** Predeclarations of the parsec_task_class_t */
+static const parsec_task_class_t redistribute_reshuffle_Receive;
+static const parsec_task_class_t redistribute_reshuffle_Send;
+/** Predeclarations of the parameters */
+static const parsec_flow_t flow_of_redistribute_reshuffle_Receive_for_Y;
+static const parsec_flow_t flow_of_redistribute_reshuffle_Receive_for_T;
+static const parsec_flow_t flow_of_redistribute_reshuffle_Receive_for_ctl;
+static const parsec_flow_t flow_of_redistribute_reshuffle_Send_for_Y;
+static const parsec_flow_t flow_of_redistribute_reshuffle_Send_for_R;
+static const parsec_flow_t flow_of_redistribute_reshuffle_Send_for_ctl;
+/*
+ * Copyright (c) 2017-2021 The University of Tennessee and The University
+ *                         of Tennessee Research Foundation. All rights
+ *                         reserved.
+ *
+ */
+#include "parsec/data_dist/matrix/redistribute/redistribute_internal.h"
+
+#define PARSEC_redistribute_reshuffle_DEFAULT_ADT    (&__parsec_tp->super.arenas_datatypes[PARSEC_redistribute_reshuffle_DEFAULT_ADT_IDX])
+#include "redistribute_reshuffle.h"
+
+struct __parsec_redistribute_reshuffle_internal_taskpool_s {
+ parsec_redistribute_reshuffle_taskpool_t super;
+ volatile int32_t sync_point;
+ volatile int32_t initial_number_tasks;
+ parsec_task_t* startup_queue;
+  /* The ranges to compute the hash key */
+  int Receive_m_T_min;
+  int Receive_m_T_range;
+  int Receive_n_T_min;
+  int Receive_n_T_range;
+  int Receive_batch_min;
+  int Receive_batch_range;
+  int Send_m_Y_min;
+  int Send_m_Y_range;
+  int Send_n_Y_min;
+  int Send_n_Y_range;
+  int Send_batch_min;
+  int Send_batch_range;
+  /* The list of data repositories  Send */
+  data_repo_t* repositories[2];
+};
+
+#if defined(PARSEC_PROF_TRACE)
+#  if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+static int redistribute_reshuffle_profiling_array[4*PARSEC_redistribute_reshuffle_NB_TASK_CLASSES] = {-2}; /* 2 pairs (begin, end) per task, times two because each task class has an internal_init task */
+#  else /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+static int redistribute_reshuffle_profiling_array[2*PARSEC_redistribute_reshuffle_NB_TASK_CLASSES] = {-2}; /* 2 pairs (begin, end) per task */
+#  endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+#endif  /* defined(PARSEC_PROF_TRACE) */
+/* Globals */
+#define descY __parsec_tp->super._g_descY
+#define descT __parsec_tp->super._g_descT
+#define size_row (__parsec_tp->super._g_size_row)
+#define size_col (__parsec_tp->super._g_size_col)
+#define disi_Y (__parsec_tp->super._g_disi_Y)
+#define disj_Y (__parsec_tp->super._g_disj_Y)
+#define disi_T (__parsec_tp->super._g_disi_T)
+#define disj_T (__parsec_tp->super._g_disj_T)
+#define m_Y_START (__parsec_tp->super._g_m_Y_START)
+#define n_Y_START (__parsec_tp->super._g_n_Y_START)
+#define m_Y_END (__parsec_tp->super._g_m_Y_END)
+#define n_Y_END (__parsec_tp->super._g_n_Y_END)
+#define m_T_START (__parsec_tp->super._g_m_T_START)
+#define n_T_START (__parsec_tp->super._g_n_T_START)
+#define m_T_END (__parsec_tp->super._g_m_T_END)
+#define n_T_END (__parsec_tp->super._g_n_T_END)
+#define num_col (__parsec_tp->super._g_num_col)
+#define NT (__parsec_tp->super._g_NT)
+
+static inline int parsec_imin(int a, int b) { return (a <= b) ? a : b; };
+
+static inline int parsec_imax(int a, int b) { return (a >= b) ? a : b; };
+
+static inline int32_t redistribute_reshuffle_Receive_inline_c_expr1_line_103(const __parsec_redistribute_reshuffle_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_reshuffle_Receive_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Receive */
+  const int batch = assignments->batch.value; (void)batch;
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int m_Y = assignments->m_Y.value; (void)m_Y;
+  const int n_Y = assignments->n_Y.value; (void)n_Y;
+  const int rank_Y = assignments->rank_Y.value; (void)rank_Y;
+  const int rank_T = assignments->rank_T.value; (void)rank_T;
+
+  (void)batch;  (void)m_T;  (void)n_T;  (void)m_Y;  (void)n_Y;  (void)rank_Y;  (void)rank_T;
+
+ return descT->super.rank_of(&descT->super, m_T, n_T); 
+}
+
+static inline int32_t redistribute_reshuffle_Receive_inline_c_expr2_line_102(const __parsec_redistribute_reshuffle_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_reshuffle_Receive_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Receive */
+  const int batch = assignments->batch.value; (void)batch;
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int m_Y = assignments->m_Y.value; (void)m_Y;
+  const int n_Y = assignments->n_Y.value; (void)n_Y;
+  const int rank_Y = assignments->rank_Y.value; (void)rank_Y;
+  const int rank_T = assignments->rank_T.value; (void)rank_T;
+
+  (void)batch;  (void)m_T;  (void)n_T;  (void)m_Y;  (void)n_Y;  (void)rank_Y;  (void)rank_T;
+
+ return descY->super.rank_of(&descY->super, m_Y, n_Y); 
+}
+
+static inline int32_t redistribute_reshuffle_Receive_inline_c_expr3_line_97(const __parsec_redistribute_reshuffle_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_reshuffle_Receive_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Receive */
+  const int batch = assignments->batch.value; (void)batch;
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int m_Y = assignments->m_Y.value; (void)m_Y;
+  const int n_Y = assignments->n_Y.value; (void)n_Y;
+  const int rank_Y = assignments->rank_Y.value; (void)rank_Y;
+  const int rank_T = assignments->rank_T.value; (void)rank_T;
+
+  (void)batch;  (void)m_T;  (void)n_T;  (void)m_Y;  (void)n_Y;  (void)rank_Y;  (void)rank_T;
+
+ return parsec_imin((batch+1)*num_col+n_T_START-1, n_T_END); 
+}
+
+static inline int32_t redistribute_reshuffle_Receive_inline_c_expr4_line_97(const __parsec_redistribute_reshuffle_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_reshuffle_Receive_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Receive */
+  const int batch = assignments->batch.value; (void)batch;
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int m_Y = assignments->m_Y.value; (void)m_Y;
+  const int n_Y = assignments->n_Y.value; (void)n_Y;
+  const int rank_Y = assignments->rank_Y.value; (void)rank_Y;
+  const int rank_T = assignments->rank_T.value; (void)rank_T;
+
+  (void)batch;  (void)m_T;  (void)n_T;  (void)m_Y;  (void)n_Y;  (void)rank_Y;  (void)rank_T;
+
+ return batch*num_col+n_T_START; 
+}
+
+static inline int32_t redistribute_reshuffle_Send_inline_c_expr5_line_59(const __parsec_redistribute_reshuffle_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_reshuffle_Send_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Send */
+  const int batch = assignments->batch.value; (void)batch;
+  const int m_Y = assignments->m_Y.value; (void)m_Y;
+  const int n_Y = assignments->n_Y.value; (void)n_Y;
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int rank_Y = assignments->rank_Y.value; (void)rank_Y;
+  const int rank_T = assignments->rank_T.value; (void)rank_T;
+
+  (void)batch;  (void)m_Y;  (void)n_Y;  (void)m_T;  (void)n_T;  (void)rank_Y;  (void)rank_T;
+
+ return descT->super.rank_of(&descT->super, m_T, n_T); 
+}
+
+static inline int32_t redistribute_reshuffle_Send_inline_c_expr6_line_58(const __parsec_redistribute_reshuffle_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_reshuffle_Send_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Send */
+  const int batch = assignments->batch.value; (void)batch;
+  const int m_Y = assignments->m_Y.value; (void)m_Y;
+  const int n_Y = assignments->n_Y.value; (void)n_Y;
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int rank_Y = assignments->rank_Y.value; (void)rank_Y;
+  const int rank_T = assignments->rank_T.value; (void)rank_T;
+
+  (void)batch;  (void)m_Y;  (void)n_Y;  (void)m_T;  (void)n_T;  (void)rank_Y;  (void)rank_T;
+
+ return descY->super.rank_of(&descY->super, m_Y, n_Y); 
+}
+
+static inline int32_t redistribute_reshuffle_Send_inline_c_expr7_line_53(const __parsec_redistribute_reshuffle_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_reshuffle_Send_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Send */
+  const int batch = assignments->batch.value; (void)batch;
+  const int m_Y = assignments->m_Y.value; (void)m_Y;
+  const int n_Y = assignments->n_Y.value; (void)n_Y;
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int rank_Y = assignments->rank_Y.value; (void)rank_Y;
+  const int rank_T = assignments->rank_T.value; (void)rank_T;
+
+  (void)batch;  (void)m_Y;  (void)n_Y;  (void)m_T;  (void)n_T;  (void)rank_Y;  (void)rank_T;
+
+ return parsec_imin((batch+1)*num_col+n_Y_START-1, n_Y_END); 
+}
+
+static inline int32_t redistribute_reshuffle_Send_inline_c_expr8_line_53(const __parsec_redistribute_reshuffle_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_reshuffle_Send_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Send */
+  const int batch = assignments->batch.value; (void)batch;
+  const int m_Y = assignments->m_Y.value; (void)m_Y;
+  const int n_Y = assignments->n_Y.value; (void)n_Y;
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int rank_Y = assignments->rank_Y.value; (void)rank_Y;
+  const int rank_T = assignments->rank_T.value; (void)rank_T;
+
+  (void)batch;  (void)m_Y;  (void)n_Y;  (void)m_T;  (void)n_T;  (void)rank_Y;  (void)rank_T;
+
+ return batch*num_col+n_Y_START; 
+}
+
+/* Data Access Macros */
+#define data_of_descT(descT_d0, descT_d1)  (((parsec_data_collection_t*)__parsec_tp->super._g_descT)->data_of((parsec_data_collection_t*)__parsec_tp->super._g_descT, (descT_d0), (descT_d1)))
+#define data_of_descY(descY_d0, descY_d1)  (((parsec_data_collection_t*)__parsec_tp->super._g_descY)->data_of((parsec_data_collection_t*)__parsec_tp->super._g_descY, (descY_d0), (descY_d1)))
+
+#define rank_of_descT(descT_d0, descT_d1)  (((parsec_data_collection_t*)__parsec_tp->super._g_descT)->rank_of((parsec_data_collection_t*)__parsec_tp->super._g_descT, (descT_d0), (descT_d1)))
+#define rank_of_descY(descY_d0, descY_d1)  (((parsec_data_collection_t*)__parsec_tp->super._g_descY)->rank_of((parsec_data_collection_t*)__parsec_tp->super._g_descY, (descY_d0), (descY_d1)))
+
+/* Functions Predicates */
+#define Receive_pred(batch, m_T, n_T, m_Y, n_Y, rank_Y, rank_T) (((parsec_data_collection_t*)(__parsec_tp->super._g_descT))->myrank == rank_of_descT(m_T, n_T))
+#define Send_pred(batch, m_Y, n_Y, m_T, n_T, rank_Y, rank_T) (((parsec_data_collection_t*)(__parsec_tp->super._g_descY))->myrank == rank_of_descY(m_Y, n_Y))
+
+/* Data Repositories */
+#define Receive_repo (__parsec_tp->repositories[1])
+#define Send_repo (__parsec_tp->repositories[0])
+/* Release dependencies output macro */
+#if defined(PARSEC_DEBUG_NOISIER)
+#define RELEASE_DEP_OUTPUT(ES, DEPO, TASKO, DEPI, TASKI, RSRC, RDST, DATA)\
+  do { \
+    char tmp1[128], tmp2[128]; (void)tmp1; (void)tmp2;\
+    PARSEC_DEBUG_VERBOSE(20, parsec_debug_output, "thread %d VP %d explore deps from %s:%s to %s:%s (from rank %d to %d) base ptr %p",\
+           (NULL != (ES) ? (ES)->th_id : -1), (NULL != (ES) ? (ES)->virtual_process->vp_id : -1),\
+           DEPO, parsec_task_snprintf(tmp1, 128, (parsec_task_t*)(TASKO)),\
+           DEPI, parsec_task_snprintf(tmp2, 128, (parsec_task_t*)(TASKI)), (RSRC), (RDST), (DATA));\
+  } while(0)
+#define ACQUIRE_FLOW(TASKI, DEPI, FUNO, DEPO, LOCALS, PTR)\
+  do { \
+    char tmp1[128], tmp2[128]; (void)tmp1; (void)tmp2;\
+    PARSEC_DEBUG_VERBOSE(20, parsec_debug_output, "task %s acquires flow %s from %s %s data ptr %p",\
+           parsec_task_snprintf(tmp1, 128, (parsec_task_t*)(TASKI)), (DEPI),\
+           (DEPO), parsec_snprintf_assignments(tmp2, 128, (FUNO), (parsec_assignment_t*)(LOCALS)), (PTR));\
+  } while(0)
+#else
+#define RELEASE_DEP_OUTPUT(ES, DEPO, TASKO, DEPI, TASKI, RSRC, RDST, DATA)
+#define ACQUIRE_FLOW(TASKI, DEPI, TASKO, DEPO, LOCALS, PTR)
+#endif
+static inline parsec_key_t __jdf2c_make_key_Receive(const parsec_taskpool_t *tp, const parsec_assignment_t *as)
+{
+  const __parsec_redistribute_reshuffle_internal_taskpool_t *__parsec_tp = (const __parsec_redistribute_reshuffle_internal_taskpool_t *)tp;
+  const __parsec_redistribute_reshuffle_Receive_parsec_assignment_t *assignment = (const __parsec_redistribute_reshuffle_Receive_parsec_assignment_t*)as;
+  uint64_t __parsec_id = 0;
+  __parsec_id += (assignment->batch.value - __parsec_tp->Receive_batch_min);
+  __parsec_id += (assignment->m_T.value - __parsec_tp->Receive_m_T_min) * __parsec_tp->Receive_batch_range;
+  __parsec_id += (assignment->n_T.value - __parsec_tp->Receive_n_T_min) * __parsec_tp->Receive_batch_range * __parsec_tp->Receive_m_T_range;
+  return (parsec_key_t)__parsec_id;
+}
+static char *__jdf2c_key_fns_Receive_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_redistribute_reshuffle_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_reshuffle_internal_taskpool_t *)user_data;
+  __parsec_redistribute_reshuffle_Receive_parsec_assignment_t __jdf2c__assignments = {  .batch.value = 0, .m_T.value = 0, .n_T.value = 0, .m_Y.value = 0, .n_Y.value = 0, .rank_Y.value = 0, .rank_T.value = 0 };
+  int batch = (__parsec_key) % __parsec_tp->Receive_batch_range + __parsec_tp->Receive_batch_min;
+  __parsec_key = __parsec_key / __parsec_tp->Receive_batch_range;
+  __jdf2c__assignments.batch.value = batch;
+  int m_T = (__parsec_key) % __parsec_tp->Receive_m_T_range + __parsec_tp->Receive_m_T_min;
+  __parsec_key = __parsec_key / __parsec_tp->Receive_m_T_range;
+  __jdf2c__assignments.m_T.value = m_T;
+  int n_T = (__parsec_key) % __parsec_tp->Receive_n_T_range + __parsec_tp->Receive_n_T_min;
+  __parsec_key = __parsec_key / __parsec_tp->Receive_n_T_range;
+  __jdf2c__assignments.n_T.value = n_T;
+  int m_Y = ((m_T - m_T_START) + m_Y_START);
+  (void)m_Y;
+  __jdf2c__assignments.m_Y.value = m_Y;
+  int n_Y = ((n_T - n_T_START) + n_Y_START);
+  (void)n_Y;
+  __jdf2c__assignments.n_Y.value = n_Y;
+  int rank_Y = redistribute_reshuffle_Receive_inline_c_expr2_line_102(__parsec_tp, &__jdf2c__assignments);
+  (void)rank_Y;
+  __jdf2c__assignments.rank_Y.value = rank_Y;
+  int rank_T = redistribute_reshuffle_Receive_inline_c_expr1_line_103(__parsec_tp, &__jdf2c__assignments);
+  (void)rank_T;
+  __jdf2c__assignments.rank_T.value = rank_T;
+  (void)__jdf2c__assignments;
+  snprintf(buffer, buffer_size, "Receive(%d, %d, %d)", batch, m_T, n_T);
+  return buffer;
+}
+
+static parsec_key_fn_t __jdf2c_key_fns_Receive = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = __jdf2c_key_fns_Receive_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+static inline parsec_key_t __jdf2c_make_key_Send(const parsec_taskpool_t *tp, const parsec_assignment_t *as)
+{
+  const __parsec_redistribute_reshuffle_internal_taskpool_t *__parsec_tp = (const __parsec_redistribute_reshuffle_internal_taskpool_t *)tp;
+  const __parsec_redistribute_reshuffle_Send_parsec_assignment_t *assignment = (const __parsec_redistribute_reshuffle_Send_parsec_assignment_t*)as;
+  uint64_t __parsec_id = 0;
+  __parsec_id += (assignment->batch.value - __parsec_tp->Send_batch_min);
+  __parsec_id += (assignment->m_Y.value - __parsec_tp->Send_m_Y_min) * __parsec_tp->Send_batch_range;
+  __parsec_id += (assignment->n_Y.value - __parsec_tp->Send_n_Y_min) * __parsec_tp->Send_batch_range * __parsec_tp->Send_m_Y_range;
+  return (parsec_key_t)__parsec_id;
+}
+static char *__jdf2c_key_fns_Send_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_redistribute_reshuffle_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_reshuffle_internal_taskpool_t *)user_data;
+  __parsec_redistribute_reshuffle_Send_parsec_assignment_t __jdf2c__assignments = {  .batch.value = 0, .m_Y.value = 0, .n_Y.value = 0, .m_T.value = 0, .n_T.value = 0, .rank_Y.value = 0, .rank_T.value = 0 };
+  int batch = (__parsec_key) % __parsec_tp->Send_batch_range + __parsec_tp->Send_batch_min;
+  __parsec_key = __parsec_key / __parsec_tp->Send_batch_range;
+  __jdf2c__assignments.batch.value = batch;
+  int m_Y = (__parsec_key) % __parsec_tp->Send_m_Y_range + __parsec_tp->Send_m_Y_min;
+  __parsec_key = __parsec_key / __parsec_tp->Send_m_Y_range;
+  __jdf2c__assignments.m_Y.value = m_Y;
+  int n_Y = (__parsec_key) % __parsec_tp->Send_n_Y_range + __parsec_tp->Send_n_Y_min;
+  __parsec_key = __parsec_key / __parsec_tp->Send_n_Y_range;
+  __jdf2c__assignments.n_Y.value = n_Y;
+  int m_T = ((m_Y - m_Y_START) + m_T_START);
+  (void)m_T;
+  __jdf2c__assignments.m_T.value = m_T;
+  int n_T = ((n_Y - n_Y_START) + n_T_START);
+  (void)n_T;
+  __jdf2c__assignments.n_T.value = n_T;
+  int rank_Y = redistribute_reshuffle_Send_inline_c_expr6_line_58(__parsec_tp, &__jdf2c__assignments);
+  (void)rank_Y;
+  __jdf2c__assignments.rank_Y.value = rank_Y;
+  int rank_T = redistribute_reshuffle_Send_inline_c_expr5_line_59(__parsec_tp, &__jdf2c__assignments);
+  (void)rank_T;
+  __jdf2c__assignments.rank_T.value = rank_T;
+  (void)__jdf2c__assignments;
+  snprintf(buffer, buffer_size, "Send(%d, %d, %d)", batch, m_Y, n_Y);
+  return buffer;
+}
+
+static parsec_key_fn_t __jdf2c_key_fns_Send = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = __jdf2c_key_fns_Send_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/******                                    Receive                                    ******/
+
+static inline int32_t minexpr_of_symb_redistribute_reshuffle_Receive_batch_fct(const __parsec_redistribute_reshuffle_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_reshuffle_Receive_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_redistribute_reshuffle_Receive_batch = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_redistribute_reshuffle_Receive_batch_fct }
+                   }
+};
+static inline int maxexpr_of_symb_redistribute_reshuffle_Receive_batch_fct(const __parsec_redistribute_reshuffle_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_reshuffle_Receive_parsec_assignment_t *locals)
+{
+  const int batch = locals->batch.value; (void)batch;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+  const int rank_Y = locals->rank_Y.value; (void)rank_Y;
+  const int rank_T = locals->rank_T.value; (void)rank_T;
+
+  (void)batch;
+  (void)m_T;
+  (void)n_T;
+  (void)m_Y;
+  (void)n_Y;
+  (void)rank_Y;
+  (void)rank_T;
+  (void)__parsec_tp; (void)locals;
+  return NT;
+}
+static const parsec_expr_t maxexpr_of_symb_redistribute_reshuffle_Receive_batch = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_redistribute_reshuffle_Receive_batch_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_reshuffle_Receive_batch = { .name = "batch", .context_index = 0, .min = &minexpr_of_symb_redistribute_reshuffle_Receive_batch, .max = &maxexpr_of_symb_redistribute_reshuffle_Receive_batch, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int minexpr_of_symb_redistribute_reshuffle_Receive_m_T_fct(const __parsec_redistribute_reshuffle_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_reshuffle_Receive_parsec_assignment_t *locals)
+{
+  const int batch = locals->batch.value; (void)batch;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+  const int rank_Y = locals->rank_Y.value; (void)rank_Y;
+  const int rank_T = locals->rank_T.value; (void)rank_T;
+
+  (void)batch;
+  (void)m_T;
+  (void)n_T;
+  (void)m_Y;
+  (void)n_Y;
+  (void)rank_Y;
+  (void)rank_T;
+  (void)__parsec_tp; (void)locals;
+  return m_T_START;
+}
+static const parsec_expr_t minexpr_of_symb_redistribute_reshuffle_Receive_m_T = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_redistribute_reshuffle_Receive_m_T_fct }
+                   }
+};
+static inline int maxexpr_of_symb_redistribute_reshuffle_Receive_m_T_fct(const __parsec_redistribute_reshuffle_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_reshuffle_Receive_parsec_assignment_t *locals)
+{
+  const int batch = locals->batch.value; (void)batch;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+  const int rank_Y = locals->rank_Y.value; (void)rank_Y;
+  const int rank_T = locals->rank_T.value; (void)rank_T;
+
+  (void)batch;
+  (void)m_T;
+  (void)n_T;
+  (void)m_Y;
+  (void)n_Y;
+  (void)rank_Y;
+  (void)rank_T;
+  (void)__parsec_tp; (void)locals;
+  return m_T_END;
+}
+static const parsec_expr_t maxexpr_of_symb_redistribute_reshuffle_Receive_m_T = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_redistribute_reshuffle_Receive_m_T_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_reshuffle_Receive_m_T = { .name = "m_T", .context_index = 1, .min = &minexpr_of_symb_redistribute_reshuffle_Receive_m_T, .max = &maxexpr_of_symb_redistribute_reshuffle_Receive_m_T, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int32_t minexpr_of_symb_redistribute_reshuffle_Receive_n_T_fct(const __parsec_redistribute_reshuffle_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_reshuffle_Receive_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_reshuffle_Receive_inline_c_expr4_line_97(__parsec_tp, locals);
+}
+static const parsec_expr_t minexpr_of_symb_redistribute_reshuffle_Receive_n_T = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_redistribute_reshuffle_Receive_n_T_fct }
+                   }
+};
+static inline int32_t maxexpr_of_symb_redistribute_reshuffle_Receive_n_T_fct(const __parsec_redistribute_reshuffle_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_reshuffle_Receive_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_reshuffle_Receive_inline_c_expr3_line_97(__parsec_tp, locals);
+}
+static const parsec_expr_t maxexpr_of_symb_redistribute_reshuffle_Receive_n_T = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_redistribute_reshuffle_Receive_n_T_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_reshuffle_Receive_n_T = { .name = "n_T", .context_index = 2, .min = &minexpr_of_symb_redistribute_reshuffle_Receive_n_T, .max = &maxexpr_of_symb_redistribute_reshuffle_Receive_n_T, .cst_inc = 1, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int expr_of_symb_redistribute_reshuffle_Receive_m_Y_fct(const __parsec_redistribute_reshuffle_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_reshuffle_Receive_parsec_assignment_t *locals)
+{
+  const int batch = locals->batch.value; (void)batch;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+  const int rank_Y = locals->rank_Y.value; (void)rank_Y;
+  const int rank_T = locals->rank_T.value; (void)rank_T;
+
+  (void)batch;
+  (void)m_T;
+  (void)n_T;
+  (void)m_Y;
+  (void)n_Y;
+  (void)rank_Y;
+  (void)rank_T;
+  (void)__parsec_tp; (void)locals;
+  return ((m_T - m_T_START) + m_Y_START);
+}
+static const parsec_expr_t expr_of_symb_redistribute_reshuffle_Receive_m_Y = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_reshuffle_Receive_m_Y_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_reshuffle_Receive_m_Y = { .name = "m_Y", .context_index = 3, .min = &expr_of_symb_redistribute_reshuffle_Receive_m_Y, .max = &expr_of_symb_redistribute_reshuffle_Receive_m_Y, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int expr_of_symb_redistribute_reshuffle_Receive_n_Y_fct(const __parsec_redistribute_reshuffle_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_reshuffle_Receive_parsec_assignment_t *locals)
+{
+  const int batch = locals->batch.value; (void)batch;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+  const int rank_Y = locals->rank_Y.value; (void)rank_Y;
+  const int rank_T = locals->rank_T.value; (void)rank_T;
+
+  (void)batch;
+  (void)m_T;
+  (void)n_T;
+  (void)m_Y;
+  (void)n_Y;
+  (void)rank_Y;
+  (void)rank_T;
+  (void)__parsec_tp; (void)locals;
+  return ((n_T - n_T_START) + n_Y_START);
+}
+static const parsec_expr_t expr_of_symb_redistribute_reshuffle_Receive_n_Y = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_reshuffle_Receive_n_Y_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_reshuffle_Receive_n_Y = { .name = "n_Y", .context_index = 4, .min = &expr_of_symb_redistribute_reshuffle_Receive_n_Y, .max = &expr_of_symb_redistribute_reshuffle_Receive_n_Y, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_redistribute_reshuffle_Receive_rank_Y_fct(const __parsec_redistribute_reshuffle_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_reshuffle_Receive_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_reshuffle_Receive_inline_c_expr2_line_102(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_redistribute_reshuffle_Receive_rank_Y = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_reshuffle_Receive_rank_Y_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_reshuffle_Receive_rank_Y = { .name = "rank_Y", .context_index = 5, .min = &expr_of_symb_redistribute_reshuffle_Receive_rank_Y, .max = &expr_of_symb_redistribute_reshuffle_Receive_rank_Y, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_redistribute_reshuffle_Receive_rank_T_fct(const __parsec_redistribute_reshuffle_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_reshuffle_Receive_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_reshuffle_Receive_inline_c_expr1_line_103(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_redistribute_reshuffle_Receive_rank_T = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_reshuffle_Receive_rank_T_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_reshuffle_Receive_rank_T = { .name = "rank_T", .context_index = 6, .min = &expr_of_symb_redistribute_reshuffle_Receive_rank_T, .max = &expr_of_symb_redistribute_reshuffle_Receive_rank_T, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int affinity_of_redistribute_reshuffle_Receive(const __parsec_redistribute_reshuffle_Receive_task_t *this_task,
+                     parsec_data_ref_t *ref)
+{
+    const __parsec_redistribute_reshuffle_internal_taskpool_t *__parsec_tp = (const __parsec_redistribute_reshuffle_internal_taskpool_t*)this_task->taskpool;
+  const int batch = this_task->locals.batch.value; (void)batch;
+  const int m_T = this_task->locals.m_T.value; (void)m_T;
+  const int n_T = this_task->locals.n_T.value; (void)n_T;
+  const int m_Y = this_task->locals.m_Y.value; (void)m_Y;
+  const int n_Y = this_task->locals.n_Y.value; (void)n_Y;
+  const int rank_Y = this_task->locals.rank_Y.value; (void)rank_Y;
+  const int rank_T = this_task->locals.rank_T.value; (void)rank_T;
+
+  /* Silent Warnings: should look into predicate to know what variables are usefull */
+  (void)batch;
+  (void)m_T;
+  (void)n_T;
+  (void)m_Y;
+  (void)n_Y;
+  (void)rank_Y;
+  (void)rank_T;
+  ref->dc = (parsec_data_collection_t *)__parsec_tp->super._g_descT;
+  /* Compute data key */
+  ref->key = ref->dc->data_key(ref->dc, m_T, n_T);
+  return 1;
+}
+static const parsec_property_t properties_of_redistribute_reshuffle_Receive[1] = {
+  {.name = NULL, .expr = NULL}
+};
+static inline int expr_of_cond_for_flow_of_redistribute_reshuffle_Receive_for_Y_dep1_atline_107_iftrue_fct(const __parsec_redistribute_reshuffle_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_reshuffle_Receive_parsec_assignment_t *locals)
+{
+  const int batch = locals->batch.value; (void)batch;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+  const int rank_Y = locals->rank_Y.value; (void)rank_Y;
+  const int rank_T = locals->rank_T.value; (void)rank_T;
+
+  (void)batch;
+  (void)m_T;
+  (void)n_T;
+  (void)m_Y;
+  (void)n_Y;
+  (void)rank_Y;
+  (void)rank_T;
+  (void)__parsec_tp; (void)locals;
+  return (rank_Y) == (rank_T);
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_redistribute_reshuffle_Receive_for_Y_dep1_atline_107_iftrue = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_redistribute_reshuffle_Receive_for_Y_dep1_atline_107_iftrue_fct }
+                   }
+};
+static const parsec_dep_t flow_of_redistribute_reshuffle_Receive_for_Y_dep1_atline_107_iftrue = {
+  .cond = &expr_of_cond_for_flow_of_redistribute_reshuffle_Receive_for_Y_dep1_atline_107_iftrue,  /* (rank_Y) == (rank_T) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 0, /* redistribute_reshuffle_Send */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_redistribute_reshuffle_Send_for_Y,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_redistribute_reshuffle_Receive_for_Y,
+};
+static inline int expr_of_cond_for_flow_of_redistribute_reshuffle_Receive_for_Y_dep1_atline_107_iffalse_fct(const __parsec_redistribute_reshuffle_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_reshuffle_Receive_parsec_assignment_t *locals)
+{
+  const int batch = locals->batch.value; (void)batch;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+  const int rank_Y = locals->rank_Y.value; (void)rank_Y;
+  const int rank_T = locals->rank_T.value; (void)rank_T;
+
+  (void)batch;
+  (void)m_T;
+  (void)n_T;
+  (void)m_Y;
+  (void)n_Y;
+  (void)rank_Y;
+  (void)rank_T;
+  (void)__parsec_tp; (void)locals;
+  return !((rank_Y) == (rank_T));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_redistribute_reshuffle_Receive_for_Y_dep1_atline_107_iffalse = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_redistribute_reshuffle_Receive_for_Y_dep1_atline_107_iffalse_fct }
+                   }
+};
+static const parsec_dep_t flow_of_redistribute_reshuffle_Receive_for_Y_dep1_atline_107_iffalse = {
+  .cond = &expr_of_cond_for_flow_of_redistribute_reshuffle_Receive_for_Y_dep1_atline_107_iffalse,  /* !(rank_Y) == (rank_T) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 0, /* redistribute_reshuffle_Send */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_redistribute_reshuffle_Send_for_R,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_redistribute_reshuffle_Receive_for_Y,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_redistribute_reshuffle_Receive_for_Y = {
+  .name               = "Y",
+  .sym_type           = PARSEC_SYM_IN,
+  .flow_flags         = PARSEC_FLOW_ACCESS_READ,
+  .flow_index         = 0,
+  .flow_datatype_mask = 0x0,
+  .dep_in     = { &flow_of_redistribute_reshuffle_Receive_for_Y_dep1_atline_107_iftrue,
+ &flow_of_redistribute_reshuffle_Receive_for_Y_dep1_atline_107_iffalse },
+  .dep_out    = { NULL }
+};
+
+static parsec_data_t *flow_of_redistribute_reshuffle_Receive_for_T_dep1_atline_109_direct_access(const __parsec_redistribute_reshuffle_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_reshuffle_Receive_parsec_assignment_t *assignments)
+{
+  const int batch = assignments->batch.value; (void)batch;
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int m_Y = assignments->m_Y.value; (void)m_Y;
+  const int n_Y = assignments->n_Y.value; (void)n_Y;
+  const int rank_Y = assignments->rank_Y.value; (void)rank_Y;
+  const int rank_T = assignments->rank_T.value; (void)rank_T;
+
+  /* Silence Warnings: should look into parameters to know what variables are useful */
+  (void)batch;
+  (void)m_T;
+  (void)n_T;
+  (void)m_Y;
+  (void)n_Y;
+  (void)rank_Y;
+  (void)rank_T;
+  if( __parsec_tp->super.super.context->my_rank == (int32_t)rank_of_descT(m_T, n_T) )
+    return data_of_descT(m_T, n_T);
+  return NULL;
+}
+
+static const parsec_dep_t flow_of_redistribute_reshuffle_Receive_for_T_dep1_atline_109 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = PARSEC_LOCAL_DATA_TASK_CLASS_ID, /* redistribute_reshuffle_descT */
+  .direct_data = (parsec_data_lookup_func_t)&flow_of_redistribute_reshuffle_Receive_for_T_dep1_atline_109_direct_access,
+  .dep_index = 1,
+  .dep_datatype_index = 1,
+  .belongs_to = &flow_of_redistribute_reshuffle_Receive_for_T,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_redistribute_reshuffle_Receive_for_T = {
+  .name               = "T",
+  .sym_type           = PARSEC_SYM_IN,
+  .flow_flags         = PARSEC_FLOW_ACCESS_READ|PARSEC_FLOW_HAS_IN_DEPS,
+  .flow_index         = 1,
+  .flow_datatype_mask = 0x0,
+  .dep_in     = { &flow_of_redistribute_reshuffle_Receive_for_T_dep1_atline_109 },
+  .dep_out    = { NULL }
+};
+
+static inline int expr_of_cond_for_flow_of_redistribute_reshuffle_Receive_for_ctl_dep1_atline_111_fct(const __parsec_redistribute_reshuffle_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_reshuffle_Receive_parsec_assignment_t *locals)
+{
+  const int batch = locals->batch.value; (void)batch;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+  const int rank_Y = locals->rank_Y.value; (void)rank_Y;
+  const int rank_T = locals->rank_T.value; (void)rank_T;
+
+  (void)batch;
+  (void)m_T;
+  (void)n_T;
+  (void)m_Y;
+  (void)n_Y;
+  (void)rank_Y;
+  (void)rank_T;
+  (void)__parsec_tp; (void)locals;
+  return (batch) < (NT);
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_redistribute_reshuffle_Receive_for_ctl_dep1_atline_111 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_redistribute_reshuffle_Receive_for_ctl_dep1_atline_111_fct }
+                   }
+};
+static const parsec_dep_t flow_of_redistribute_reshuffle_Receive_for_ctl_dep1_atline_111 = {
+  .cond = &expr_of_cond_for_flow_of_redistribute_reshuffle_Receive_for_ctl_dep1_atline_111,  /* (batch) < (NT) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 0, /* redistribute_reshuffle_Send */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_redistribute_reshuffle_Send_for_ctl,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_redistribute_reshuffle_Receive_for_ctl,
+};
+#if MAX_DEP_OUT_COUNT < 1  /* number of output dependencies */
+    #error Too many output dependencies (supports up to MAX_DEP_OUT_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_OUT_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_redistribute_reshuffle_Receive_for_ctl = {
+  .name               = "ctl",
+  .sym_type           = PARSEC_SYM_OUT,
+  .flow_flags         = PARSEC_FLOW_ACCESS_NONE,
+  .flow_index         = 2,
+  .flow_datatype_mask = 0x1,
+  .dep_in     = { NULL },
+  .dep_out    = { &flow_of_redistribute_reshuffle_Receive_for_ctl_dep1_atline_111 }
+};
+
+static void
+iterate_successors_of_redistribute_reshuffle_Receive(parsec_execution_stream_t *es, const __parsec_redistribute_reshuffle_Receive_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_redistribute_reshuffle_internal_taskpool_t *__parsec_tp = (const __parsec_redistribute_reshuffle_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_redistribute_reshuffle_Receive_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_redistribute_reshuffle_Receive_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int batch = __jdf2c__tmp_locals.batch.value; (void)batch;
+  const int m_T = __jdf2c__tmp_locals.m_T.value; (void)m_T;
+  const int n_T = __jdf2c__tmp_locals.n_T.value; (void)n_T;
+  const int m_Y = __jdf2c__tmp_locals.m_Y.value; (void)m_Y;
+  const int n_Y = __jdf2c__tmp_locals.n_Y.value; (void)n_Y;
+  const int rank_Y = __jdf2c__tmp_locals.rank_Y.value; (void)rank_Y;
+  const int rank_T = __jdf2c__tmp_locals.rank_T.value; (void)rank_T;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)batch;  (void)m_T;  (void)n_T;  (void)m_Y;  (void)n_Y;  (void)rank_Y;  (void)rank_T;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_descT(m_T, n_T);
+#endif
+  /* Flow of data Y has only IN dependencies */
+  /* Flow of data T has only IN dependencies */
+  if( action_mask & 0x1 ) {  /* Flow of data ctl [2] */
+    data.data   = this_task->data._f_ctl.data_out;
+    data.data_future  = NULL;
+    if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  =   /* Control: always empty */ 0;
+    data.local.dst_count  =   /* Control: always empty */ 0;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = NULL;
+    data.remote.src_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.src_count  =   /* Control: always empty */ 0;
+    data.remote.dst_count  =   /* Control: always empty */ 0;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+       if( (batch) < (NT) ) {
+      __parsec_redistribute_reshuffle_Send_task_t* ncc = (__parsec_redistribute_reshuffle_Send_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[redistribute_reshuffle_Send.task_class_id];
+        const int Send_batch = (batch + 1);
+        if( (Send_batch >= (0)) && (Send_batch <= (NT)) ) {
+          assert(&nc.locals[0].value == &ncc->locals.batch.value);
+          ncc->locals.batch.value = Send_batch;
+          const int Send_m_Y = m_Y;
+          if( (Send_m_Y >= (m_Y_START)) && (Send_m_Y <= (m_Y_END)) ) {
+            assert(&nc.locals[1].value == &ncc->locals.m_Y.value);
+            ncc->locals.m_Y.value = Send_m_Y;
+            const int Send_n_Y = (n_Y + num_col);
+            if( (Send_n_Y >= (redistribute_reshuffle_Send_inline_c_expr8_line_53(__parsec_tp, &ncc->locals))) && (Send_n_Y <= (redistribute_reshuffle_Send_inline_c_expr7_line_53(__parsec_tp, &ncc->locals))) ) {
+              assert(&nc.locals[2].value == &ncc->locals.n_Y.value);
+              ncc->locals.n_Y.value = Send_n_Y;
+              const int Send_m_T = ((ncc->locals.m_Y.value - m_Y_START) + m_T_START);
+              assert(&nc.locals[3].value == &ncc->locals.m_T.value);
+              ncc->locals.m_T.value = Send_m_T;
+              const int Send_n_T = ((ncc->locals.n_Y.value - n_Y_START) + n_T_START);
+              assert(&nc.locals[4].value == &ncc->locals.n_T.value);
+              ncc->locals.n_T.value = Send_n_T;
+              const int Send_rank_Y = redistribute_reshuffle_Send_inline_c_expr6_line_58(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[5].value == &ncc->locals.rank_Y.value);
+              ncc->locals.rank_Y.value = Send_rank_Y;
+              const int Send_rank_T = redistribute_reshuffle_Send_inline_c_expr5_line_59(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[6].value == &ncc->locals.rank_T.value);
+              ncc->locals.rank_T.value = Send_rank_T;
+#if defined(DISTRIBUTED)
+              rank_dst = rank_of_descY(ncc->locals.m_Y.value, ncc->locals.n_Y.value);
+              if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+                vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descY)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descY, ncc->locals.m_Y.value, ncc->locals.n_Y.value);
+              nc.priority = __parsec_tp->super.super.priority;
+              successor_repo = Send_repo;
+              successor_repo_key = __jdf2c_make_key_Send((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+            RELEASE_DEP_OUTPUT(es, "ctl", this_task, "ctl", &nc, rank_src, rank_dst, &data);
+            if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_redistribute_reshuffle_Receive_for_ctl_dep1_atline_111, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+              }
+            }
+          }
+    }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static void
+iterate_predecessors_of_redistribute_reshuffle_Receive(parsec_execution_stream_t *es, const __parsec_redistribute_reshuffle_Receive_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_redistribute_reshuffle_internal_taskpool_t *__parsec_tp = (const __parsec_redistribute_reshuffle_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_redistribute_reshuffle_Receive_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_redistribute_reshuffle_Receive_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int batch = __jdf2c__tmp_locals.batch.value; (void)batch;
+  const int m_T = __jdf2c__tmp_locals.m_T.value; (void)m_T;
+  const int n_T = __jdf2c__tmp_locals.n_T.value; (void)n_T;
+  const int m_Y = __jdf2c__tmp_locals.m_Y.value; (void)m_Y;
+  const int n_Y = __jdf2c__tmp_locals.n_Y.value; (void)n_Y;
+  const int rank_Y = __jdf2c__tmp_locals.rank_Y.value; (void)rank_Y;
+  const int rank_T = __jdf2c__tmp_locals.rank_T.value; (void)rank_T;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)batch;  (void)m_T;  (void)n_T;  (void)m_Y;  (void)n_Y;  (void)rank_Y;  (void)rank_T;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_descT(m_T, n_T);
+#endif
+  if( action_mask & 0x1 ) {  /* Flow of data Y [0] */
+    data.data   = this_task->data._f_Y.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x1 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_redistribute_reshuffle_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_redistribute_reshuffle_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( (rank_Y) == (rank_T) ) {
+      __parsec_redistribute_reshuffle_Send_task_t* ncc = (__parsec_redistribute_reshuffle_Send_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[redistribute_reshuffle_Send.task_class_id];
+        const int Send_batch = batch;
+        if( (Send_batch >= (0)) && (Send_batch <= (NT)) ) {
+          assert(&nc.locals[0].value == &ncc->locals.batch.value);
+          ncc->locals.batch.value = Send_batch;
+          const int Send_m_Y = m_Y;
+          if( (Send_m_Y >= (m_Y_START)) && (Send_m_Y <= (m_Y_END)) ) {
+            assert(&nc.locals[1].value == &ncc->locals.m_Y.value);
+            ncc->locals.m_Y.value = Send_m_Y;
+            const int Send_n_Y = n_Y;
+            if( (Send_n_Y >= (redistribute_reshuffle_Send_inline_c_expr8_line_53(__parsec_tp, &ncc->locals))) && (Send_n_Y <= (redistribute_reshuffle_Send_inline_c_expr7_line_53(__parsec_tp, &ncc->locals))) ) {
+              assert(&nc.locals[2].value == &ncc->locals.n_Y.value);
+              ncc->locals.n_Y.value = Send_n_Y;
+              const int Send_m_T = ((ncc->locals.m_Y.value - m_Y_START) + m_T_START);
+              assert(&nc.locals[3].value == &ncc->locals.m_T.value);
+              ncc->locals.m_T.value = Send_m_T;
+              const int Send_n_T = ((ncc->locals.n_Y.value - n_Y_START) + n_T_START);
+              assert(&nc.locals[4].value == &ncc->locals.n_T.value);
+              ncc->locals.n_T.value = Send_n_T;
+              const int Send_rank_Y = redistribute_reshuffle_Send_inline_c_expr6_line_58(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[5].value == &ncc->locals.rank_Y.value);
+              ncc->locals.rank_Y.value = Send_rank_Y;
+              const int Send_rank_T = redistribute_reshuffle_Send_inline_c_expr5_line_59(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[6].value == &ncc->locals.rank_T.value);
+              ncc->locals.rank_T.value = Send_rank_T;
+#if defined(DISTRIBUTED)
+              rank_dst = rank_of_descY(ncc->locals.m_Y.value, ncc->locals.n_Y.value);
+              if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+                vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descY)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descY, ncc->locals.m_Y.value, ncc->locals.n_Y.value);
+              nc.priority = __parsec_tp->super.super.priority;
+              successor_repo = Send_repo;
+              successor_repo_key = __jdf2c_make_key_Send((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+            RELEASE_DEP_OUTPUT(es, "Y", this_task, "Y", &nc, rank_src, rank_dst, &data);
+            if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_redistribute_reshuffle_Receive_for_Y_dep1_atline_107_iftrue, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+              }
+            }
+          }
+    } else {
+      __parsec_redistribute_reshuffle_Send_task_t* ncc = (__parsec_redistribute_reshuffle_Send_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[redistribute_reshuffle_Send.task_class_id];
+        const int Send_batch = batch;
+        if( (Send_batch >= (0)) && (Send_batch <= (NT)) ) {
+          assert(&nc.locals[0].value == &ncc->locals.batch.value);
+          ncc->locals.batch.value = Send_batch;
+          const int Send_m_Y = m_Y;
+          if( (Send_m_Y >= (m_Y_START)) && (Send_m_Y <= (m_Y_END)) ) {
+            assert(&nc.locals[1].value == &ncc->locals.m_Y.value);
+            ncc->locals.m_Y.value = Send_m_Y;
+            const int Send_n_Y = n_Y;
+            if( (Send_n_Y >= (redistribute_reshuffle_Send_inline_c_expr8_line_53(__parsec_tp, &ncc->locals))) && (Send_n_Y <= (redistribute_reshuffle_Send_inline_c_expr7_line_53(__parsec_tp, &ncc->locals))) ) {
+              assert(&nc.locals[2].value == &ncc->locals.n_Y.value);
+              ncc->locals.n_Y.value = Send_n_Y;
+              const int Send_m_T = ((ncc->locals.m_Y.value - m_Y_START) + m_T_START);
+              assert(&nc.locals[3].value == &ncc->locals.m_T.value);
+              ncc->locals.m_T.value = Send_m_T;
+              const int Send_n_T = ((ncc->locals.n_Y.value - n_Y_START) + n_T_START);
+              assert(&nc.locals[4].value == &ncc->locals.n_T.value);
+              ncc->locals.n_T.value = Send_n_T;
+              const int Send_rank_Y = redistribute_reshuffle_Send_inline_c_expr6_line_58(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[5].value == &ncc->locals.rank_Y.value);
+              ncc->locals.rank_Y.value = Send_rank_Y;
+              const int Send_rank_T = redistribute_reshuffle_Send_inline_c_expr5_line_59(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[6].value == &ncc->locals.rank_T.value);
+              ncc->locals.rank_T.value = Send_rank_T;
+#if defined(DISTRIBUTED)
+              rank_dst = rank_of_descY(ncc->locals.m_Y.value, ncc->locals.n_Y.value);
+              if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+                vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descY)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descY, ncc->locals.m_Y.value, ncc->locals.n_Y.value);
+              nc.priority = __parsec_tp->super.super.priority;
+              successor_repo = Send_repo;
+              successor_repo_key = __jdf2c_make_key_Send((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+            RELEASE_DEP_OUTPUT(es, "Y", this_task, "R", &nc, rank_src, rank_dst, &data);
+            if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_redistribute_reshuffle_Receive_for_Y_dep1_atline_107_iffalse, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+              }
+            }
+          }
+    }
+  }
+  }
+  /* Flow of data T has only OUTPUT dependencies to Memory */
+  /* Flow of data ctl has only IN dependencies */
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static int release_deps_of_redistribute_reshuffle_Receive(parsec_execution_stream_t *es, __parsec_redistribute_reshuffle_Receive_task_t *this_task, uint32_t action_mask, parsec_remote_deps_t *deps)
+{
+  PARSEC_PINS(es, RELEASE_DEPS_BEGIN, (parsec_task_t *)this_task);  const __parsec_redistribute_reshuffle_internal_taskpool_t *__parsec_tp = (const __parsec_redistribute_reshuffle_internal_taskpool_t *)this_task->taskpool;
+  parsec_release_dep_fct_arg_t arg;
+  int __vp_id;
+  int consume_local_repo = 0;
+  arg.action_mask = action_mask;
+  arg.output_entry = NULL;
+  arg.output_repo = NULL;
+#if defined(DISTRIBUTED)
+  arg.remote_deps = deps;
+#endif  /* defined(DISTRIBUTED) */
+  assert(NULL != es);
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS )    arg.ready_lists = alloca(sizeof(parsec_task_t *) * es->virtual_process->parsec_context->nb_vp);
+  else
+    arg.ready_lists = NULL;
+  for( __vp_id = 0; __vp_id < es->virtual_process->parsec_context->nb_vp; arg.ready_lists[__vp_id++] = NULL );
+  (void)__parsec_tp; (void)deps;
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_Y.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_Y.source_repo, this_task->data._f_Y.source_repo_entry->ht_item.key );
+    }
+    if( NULL != this_task->data._f_T.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_T.source_repo, this_task->data._f_T.source_repo_entry->ht_item.key );
+    }
+  }
+  consume_local_repo = (this_task->repo_entry != NULL);
+  arg.output_repo = Receive_repo;
+  arg.output_entry = this_task->repo_entry;
+  arg.output_usage = 0;
+  if( action_mask & (PARSEC_ACTION_RELEASE_LOCAL_DEPS | PARSEC_ACTION_GET_REPO_ENTRY) ) {
+    arg.output_entry = data_repo_lookup_entry_and_create( es, arg.output_repo, __jdf2c_make_key_Receive((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    arg.output_entry->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(arg.output_entry->sim_exec_date == 0);
+    arg.output_entry->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  if(action_mask & ( PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE ) ){
+    /* Generate the reshape promise for the outputs that need it */
+    iterate_successors_of_redistribute_reshuffle_Receive(es, this_task, action_mask, parsec_set_up_reshape_promise, &arg);
+   }
+  iterate_successors_of_redistribute_reshuffle_Receive(es, this_task, action_mask, parsec_release_dep_fct, &arg);
+
+#if defined(DISTRIBUTED)
+  if( (action_mask & PARSEC_ACTION_SEND_REMOTE_DEPS) && (NULL != arg.remote_deps)) {
+    parsec_remote_dep_activate(es, (parsec_task_t *)this_task, arg.remote_deps, arg.remote_deps->outgoing_mask);
+  }
+#endif
+
+  if(action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS) {
+    data_repo_entry_addto_usage_limit(Receive_repo, arg.output_entry->ht_item.key, arg.output_usage);
+    __parsec_schedule_vp(es, arg.ready_lists, 0);
+  }
+      if (consume_local_repo) {
+         data_repo_entry_used_once( Receive_repo, this_task->repo_entry->ht_item.key );
+      }
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_Y.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_Y.data_in);
+    }
+    if( NULL != this_task->data._f_T.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_T.data_in);
+    }
+  }
+  PARSEC_PINS(es, RELEASE_DEPS_END, (parsec_task_t *)this_task);  return 0;
+}
+
+static int data_lookup_of_redistribute_reshuffle_Receive(parsec_execution_stream_t *es, __parsec_redistribute_reshuffle_Receive_task_t *this_task)
+{
+  const __parsec_redistribute_reshuffle_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_reshuffle_internal_taskpool_t *)this_task->taskpool;
+  parsec_assignment_t generic_locals[MAX_PARAM_COUNT];  /* generic task locals */
+  int target_device = 0; (void)target_device;
+  (void)__parsec_tp; (void)generic_locals; (void)es;
+  parsec_data_copy_t *chunk = NULL;
+  data_repo_t        *reshape_repo  = NULL, *consumed_repo  = NULL;
+  data_repo_entry_t  *reshape_entry = NULL, *consumed_entry = NULL;
+  parsec_key_t        reshape_entry_key = 0, consumed_entry_key = 0;
+  uint8_t             consumed_flow_index;
+  parsec_dep_data_description_t data;
+  int ret;
+  (void)reshape_repo; (void)reshape_entry; (void)reshape_entry_key;
+  (void)consumed_repo; (void)consumed_entry; (void)consumed_entry_key;
+  (void)consumed_flow_index;
+  (void)chunk; (void)data; (void)ret;
+  const int batch = this_task->locals.batch.value; (void)batch;
+  const int m_T = this_task->locals.m_T.value; (void)m_T;
+  const int n_T = this_task->locals.n_T.value; (void)n_T;
+  const int m_Y = this_task->locals.m_Y.value; (void)m_Y;
+  const int n_Y = this_task->locals.n_Y.value; (void)n_Y;
+  const int rank_Y = this_task->locals.rank_Y.value; (void)rank_Y;
+  const int rank_T = this_task->locals.rank_T.value; (void)rank_T;
+  if( NULL == this_task->repo_entry ){
+    this_task->repo_entry = data_repo_lookup_entry_and_create(es, Receive_repo,                                       __jdf2c_make_key_Receive((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    data_repo_entry_addto_usage_limit(Receive_repo, this_task->repo_entry->ht_item.key, 1);    this_task->repo_entry ->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(this_task->repo_entry ->sim_exec_date == 0);
+    this_task->repo_entry ->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  /* The reshape repo is the current task repo. */  reshape_repo = Receive_repo;
+  reshape_entry_key = __jdf2c_make_key_Receive((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals) ;
+  reshape_entry = this_task->repo_entry;
+  /* Lookup the input data, and store them in the context if any */
+
+if(! this_task->data._f_Y.fulfill ){ /* Flow Y */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_Y.data_out = NULL;  /* input only */
+    if( (rank_Y) == (rank_T) ) {
+    /* Flow Y [0] dependency [0] from predecessor Send */
+    if( NULL == (chunk = this_task->data._f_Y.data_in) ) {
+    /* No data set up by predecessor on this task input flow */
+__parsec_redistribute_reshuffle_Send_parsec_assignment_t *target_locals = (__parsec_redistribute_reshuffle_Send_parsec_assignment_t*)&generic_locals;
+      const int Sendbatch = target_locals->batch.value = batch; (void)Sendbatch;
+      const int Sendm_Y = target_locals->m_Y.value = m_Y; (void)Sendm_Y;
+      const int Sendn_Y = target_locals->n_Y.value = n_Y; (void)Sendn_Y;
+      const int Sendm_T = target_locals->m_T.value = ((Sendm_Y - m_Y_START) + m_T_START); (void)Sendm_T;
+      const int Sendn_T = target_locals->n_T.value = ((Sendn_Y - n_Y_START) + n_T_START); (void)Sendn_T;
+      const int Sendrank_Y = target_locals->rank_Y.value = redistribute_reshuffle_Send_inline_c_expr6_line_58(__parsec_tp, target_locals); (void)Sendrank_Y;
+      const int Sendrank_T = target_locals->rank_T.value = redistribute_reshuffle_Send_inline_c_expr5_line_59(__parsec_tp, target_locals); (void)Sendrank_T;
+      if( (reshape_entry != NULL) && (reshape_entry->data[0] != NULL) ){
+          /* Reshape promise set up on this task repo by predecessor */
+          consumed_repo = reshape_repo;
+          consumed_entry = reshape_entry;
+          consumed_entry_key = reshape_entry_key;
+          consumed_flow_index = 0;
+      }else{
+          /* Consume from predecessor's repo */
+          consumed_repo = Send_repo;
+          consumed_entry_key = __jdf2c_make_key_Send((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)target_locals) ;
+          consumed_entry = data_repo_lookup_entry( consumed_repo, consumed_entry_key );
+          consumed_flow_index = 0;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      ACQUIRE_FLOW(this_task, "Y", &redistribute_reshuffle_Send, "Y", target_locals, chunk);
+      this_task->data._f_Y.data_out = chunk;
+    } 
+    else {
+      /* Data set up by predecessor on this task input flow */
+      consumed_repo = this_task->data._f_Y.source_repo;
+      consumed_entry = this_task->data._f_Y.source_repo_entry;
+      consumed_entry_key = this_task->data._f_Y.source_repo_entry->ht_item.key;
+      if( (reshape_entry != NULL) && (reshape_entry->data[0] != NULL) ){
+          /* Reshape promise set up on input by predecessor is on this task repo */
+          consumed_flow_index = 0;
+          assert( (this_task->data._f_Y.source_repo == reshape_repo)
+               && (this_task->data._f_Y.source_repo_entry == reshape_entry));
+      }else{
+          /* Reshape promise set up on input by predecessor is the predecesssor task repo */
+          consumed_flow_index = 0;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      this_task->data._f_Y.data_out = parsec_data_get_copy(chunk->original, target_device);
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+      parsec_prof_grapher_data_input(chunk->original, (parsec_task_t*)this_task, &flow_of_redistribute_reshuffle_Receive_for_Y, 0);
+#endif
+    }
+    } else {
+    /* Flow Y [0] dependency [0] from predecessor Send */
+    if( NULL == (chunk = this_task->data._f_Y.data_in) ) {
+    /* No data set up by predecessor on this task input flow */
+__parsec_redistribute_reshuffle_Send_parsec_assignment_t *target_locals = (__parsec_redistribute_reshuffle_Send_parsec_assignment_t*)&generic_locals;
+      const int Sendbatch = target_locals->batch.value = batch; (void)Sendbatch;
+      const int Sendm_Y = target_locals->m_Y.value = m_Y; (void)Sendm_Y;
+      const int Sendn_Y = target_locals->n_Y.value = n_Y; (void)Sendn_Y;
+      const int Sendm_T = target_locals->m_T.value = ((Sendm_Y - m_Y_START) + m_T_START); (void)Sendm_T;
+      const int Sendn_T = target_locals->n_T.value = ((Sendn_Y - n_Y_START) + n_T_START); (void)Sendn_T;
+      const int Sendrank_Y = target_locals->rank_Y.value = redistribute_reshuffle_Send_inline_c_expr6_line_58(__parsec_tp, target_locals); (void)Sendrank_Y;
+      const int Sendrank_T = target_locals->rank_T.value = redistribute_reshuffle_Send_inline_c_expr5_line_59(__parsec_tp, target_locals); (void)Sendrank_T;
+      if( (reshape_entry != NULL) && (reshape_entry->data[0] != NULL) ){
+          /* Reshape promise set up on this task repo by predecessor */
+          consumed_repo = reshape_repo;
+          consumed_entry = reshape_entry;
+          consumed_entry_key = reshape_entry_key;
+          consumed_flow_index = 0;
+      }else{
+          /* Consume from predecessor's repo */
+          consumed_repo = Send_repo;
+          consumed_entry_key = __jdf2c_make_key_Send((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)target_locals) ;
+          consumed_entry = data_repo_lookup_entry( consumed_repo, consumed_entry_key );
+          consumed_flow_index = 1;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      ACQUIRE_FLOW(this_task, "Y", &redistribute_reshuffle_Send, "R", target_locals, chunk);
+      this_task->data._f_Y.data_out = chunk;
+    } 
+    else {
+      /* Data set up by predecessor on this task input flow */
+      consumed_repo = this_task->data._f_Y.source_repo;
+      consumed_entry = this_task->data._f_Y.source_repo_entry;
+      consumed_entry_key = this_task->data._f_Y.source_repo_entry->ht_item.key;
+      if( (reshape_entry != NULL) && (reshape_entry->data[0] != NULL) ){
+          /* Reshape promise set up on input by predecessor is on this task repo */
+          consumed_flow_index = 0;
+          assert( (this_task->data._f_Y.source_repo == reshape_repo)
+               && (this_task->data._f_Y.source_repo_entry == reshape_entry));
+      }else{
+          /* Reshape promise set up on input by predecessor is the predecesssor task repo */
+          consumed_flow_index = 1;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      this_task->data._f_Y.data_out = parsec_data_get_copy(chunk->original, target_device);
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+      parsec_prof_grapher_data_input(chunk->original, (parsec_task_t*)this_task, &flow_of_redistribute_reshuffle_Receive_for_Y, 0);
+#endif
+    }
+    }
+    this_task->data._f_Y.data_in     = chunk;
+    this_task->data._f_Y.source_repo       = consumed_repo;
+    this_task->data._f_Y.source_repo_entry = consumed_entry;
+    if( this_task->data._f_Y.source_repo_entry == this_task->repo_entry ){
+      /* in case we have consume from this task repo entry for the flow,
+       * it is cleaned up, avoiding having old stuff during release_deps_of
+       */
+      this_task->repo_entry->data[0] = NULL;
+    }
+    this_task->data._f_Y.fulfill = 1;
+}
+
+
+if(! this_task->data._f_T.fulfill ){ /* Flow T */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_T.data_out = NULL;  /* input only */
+  /* Flow T [1] dependency [1] from memory descT */
+  if( NULL == (chunk = this_task->data._f_T.data_in) ) {
+  /* No data set up by predecessor on this task input flow */
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+  parsec_prof_grapher_data_input(data_of_descT(m_T, n_T), (parsec_task_t*)this_task, &flow_of_redistribute_reshuffle_Receive_for_T, 1);
+#endif
+    chunk = parsec_data_get_copy(data_of_descT(m_T, n_T), target_device);
+    data.data = chunk;
+    data.data_future  = NULL;
+        data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.data_future   = NULL;
+    if( (ret = parsec_get_copy_reshape_from_desc(es, this_task->taskpool, (parsec_task_t *)this_task, 1, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    this_task->data._f_T.data_out = chunk;
+    PARSEC_OBJ_RETAIN(chunk);
+  } 
+    this_task->data._f_T.data_in     = chunk;
+    this_task->data._f_T.source_repo       = consumed_repo;
+    this_task->data._f_T.source_repo_entry = consumed_entry;
+    if( this_task->data._f_T.source_repo_entry == this_task->repo_entry ){
+      /* in case we have consume from this task repo entry for the flow,
+       * it is cleaned up, avoiding having old stuff during release_deps_of
+       */
+      this_task->repo_entry->data[1] = NULL;
+    }
+    this_task->data._f_T.fulfill = 1;
+}
+
+  /* ctl is a control flow */
+  this_task->data._f_ctl.data_in         = NULL;
+  this_task->data._f_ctl.data_out        = NULL;
+  this_task->data._f_ctl.source_repo       = NULL;
+  this_task->data._f_ctl.source_repo_entry = NULL;
+  /** Generate profiling information */
+#if defined(PARSEC_PROF_TRACE)
+  this_task->prof_info.desc = (parsec_data_collection_t*)__parsec_tp->super._g_descT;
+  this_task->prof_info.priority = this_task->priority;
+  this_task->prof_info.data_id   = ((parsec_data_collection_t*)__parsec_tp->super._g_descT)->data_key((parsec_data_collection_t*)__parsec_tp->super._g_descT, m_T, n_T);
+  this_task->prof_info.task_class_id = this_task->task_class->task_class_id;
+  this_task->prof_info.task_return_code = -1;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int datatype_lookup_of_redistribute_reshuffle_Receive(parsec_execution_stream_t *es, const parsec_task_t *this_generic_task, const parsec_task_t *parent_task,
+              uint32_t* flow_mask, parsec_dep_data_description_t* data)
+{
+  const __parsec_redistribute_reshuffle_Receive_task_t *this_task = (__parsec_redistribute_reshuffle_Receive_task_t*)this_generic_task;
+  const __parsec_redistribute_reshuffle_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_reshuffle_internal_taskpool_t *)this_task->taskpool;
+  (void)__parsec_tp; (void)es; (void)this_task; (void)data; (void)parent_task;
+  const int batch = this_task->locals.batch.value; (void)batch;
+  const int m_T = this_task->locals.m_T.value; (void)m_T;
+  const int n_T = this_task->locals.n_T.value; (void)n_T;
+  const int m_Y = this_task->locals.m_Y.value; (void)m_Y;
+  const int n_Y = this_task->locals.n_Y.value; (void)n_Y;
+  const int rank_Y = this_task->locals.rank_Y.value; (void)rank_Y;
+  const int rank_T = this_task->locals.rank_T.value; (void)rank_T;
+  data->local.arena = data->remote.arena = NULL;
+  data->local.src_datatype  = data->local.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->local.src_count     = data->local.dst_count = 0;
+  data->local.src_displ     = data->local.dst_displ = 0;
+  data->data_future  = NULL;
+  if( (*flow_mask) & 0x80000000U ) { /* these are the input dependencies remote datatypes  */
+if( (*flow_mask) & 0x1U ) {  /* Flow Y */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_redistribute_reshuffle_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_redistribute_reshuffle_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_redistribute_reshuffle_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+if( (*flow_mask) & 0x2U ) {  /* Flow T */
+    if( ((*flow_mask) & 0x2U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_redistribute_reshuffle_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_redistribute_reshuffle_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_redistribute_reshuffle_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x2U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x2U) */
+    goto no_mask_match;
+  }
+
+  /* these are the output dependencies remote datatypes */
+ no_mask_match:
+  data->data                             = NULL;
+  data->remote.src_datatype = data->remote.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->remote.src_count    = data->remote.dst_count = 0;
+  data->remote.src_displ    = data->remote.dst_displ = 0;
+  data->data_future  = NULL;
+  (*flow_mask) = 0;  /* nothing left */
+  (void)batch;  (void)m_T;  (void)n_T;  (void)m_Y;  (void)n_Y;  (void)rank_Y;  (void)rank_T;
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+static int hook_of_redistribute_reshuffle_Receive(parsec_execution_stream_t *es, __parsec_redistribute_reshuffle_Receive_task_t *this_task)
+{
+  __parsec_redistribute_reshuffle_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_reshuffle_internal_taskpool_t *)this_task->taskpool;
+  (void)es; (void)__parsec_tp;
+  const int batch = this_task->locals.batch.value; (void)batch;
+  const int m_T = this_task->locals.m_T.value; (void)m_T;
+  const int n_T = this_task->locals.n_T.value; (void)n_T;
+  const int m_Y = this_task->locals.m_Y.value; (void)m_Y;
+  const int n_Y = this_task->locals.n_Y.value; (void)n_Y;
+  const int rank_Y = this_task->locals.rank_Y.value; (void)rank_Y;
+  const int rank_T = this_task->locals.rank_T.value; (void)rank_T;
+  (void)batch;  (void)m_T;  (void)n_T;  (void)m_Y;  (void)n_Y;  (void)rank_Y;  (void)rank_T;
+
+  /** Declare the variables that will hold the data, and all the accounting for each */
+  parsec_data_copy_t *_f_Y = this_task->data._f_Y.data_in;
+  void *Y = PARSEC_DATA_COPY_GET_PTR(_f_Y); (void)Y;
+  parsec_data_copy_t *_f_T = this_task->data._f_T.data_in;
+  void *T = PARSEC_DATA_COPY_GET_PTR(_f_T); (void)T;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    data_repo_entry_t *eY = this_task->data._f_Y.source_repo_entry;
+    if( (NULL != eY) && (eY->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eY->sim_exec_date;
+    data_repo_entry_t *eT = this_task->data._f_T.source_repo_entry;
+    if( (NULL != eT) && (eT->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eT->sim_exec_date;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+  /** Cache Awareness Accounting */
+#if defined(PARSEC_CACHE_AWARENESS)
+  cache_buf_referenced(es->closest_cache, Y);
+  cache_buf_referenced(es->closest_cache, T);
+#endif /* PARSEC_CACHE_AWARENESS */
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                                  Receive BODY                                  -----*/
+
+{
+    const int mb = (m_T == m_T_END)? parsec_imin(descT->mb, size_row-(m_T_END-m_T_START)*descT->mb): descT->mb;
+    const int nb = (n_T == n_T_END)? parsec_imin(descT->nb, size_col-(n_T_END-n_T_START)*descT->nb): descT->nb;
+
+    if( (descT->storage != PARSEC_MATRIX_LAPACK) && (descY->storage != PARSEC_MATRIX_LAPACK)
+        && ( m_T != m_T_END )){
+        memcpy(T, Y, sizeof(DTYPE)*mb*nb);
+    }else{
+        /* T is local, rely on storage */
+        const int T_lda = ( descT->storage == PARSEC_MATRIX_LAPACK )? descT->llm : descT->mb;
+        const int Y_lda = ( rank_Y == rank_T ) && ( descY->storage == PARSEC_MATRIX_LAPACK )? descY->llm : descY->mb;
+        CORE_redistribute_reshuffle_copy(T, Y, mb, nb, T_lda, Y_lda);
+    }
+}
+
+/*-----                              END OF Receive BODY                              -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#endif  /*  defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+static int complete_hook_of_redistribute_reshuffle_Receive(parsec_execution_stream_t *es, __parsec_redistribute_reshuffle_Receive_task_t *this_task)
+{
+  const __parsec_redistribute_reshuffle_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_reshuffle_internal_taskpool_t *)this_task->taskpool;
+#if defined(DISTRIBUTED)
+    const int batch = this_task->locals.batch.value; (void)batch;
+  const int m_T = this_task->locals.m_T.value; (void)m_T;
+  const int n_T = this_task->locals.n_T.value; (void)n_T;
+  const int m_Y = this_task->locals.m_Y.value; (void)m_Y;
+  const int n_Y = this_task->locals.n_Y.value; (void)n_Y;
+  const int rank_Y = this_task->locals.rank_Y.value; (void)rank_Y;
+  const int rank_T = this_task->locals.rank_T.value; (void)rank_T;
+#endif  /* defined(DISTRIBUTED) */
+  (void)es; (void)__parsec_tp;
+parsec_data_t* data_t_desc = NULL; (void)data_t_desc;
+#if defined(DISTRIBUTED)
+  /** If not working on distributed, there is no risk that data is not in place */
+  (void)batch;  (void)m_T;  (void)n_T;  (void)m_Y;  (void)n_Y;  (void)rank_Y;  (void)rank_T;
+
+#endif /* DISTRIBUTED */
+#if defined(PARSEC_PROF_GRAPHER)
+  parsec_prof_grapher_task((parsec_task_t*)this_task, es->th_id, es->virtual_process->vp_id,
+     __jdf2c_key_fns_Receive.key_hash(this_task->task_class->make_key( (parsec_taskpool_t*)this_task->taskpool, ((parsec_task_t*)this_task)->locals), NULL));
+#endif  /* defined(PARSEC_PROF_GRAPHER) */
+  release_deps_of_redistribute_reshuffle_Receive(es, this_task,
+      PARSEC_ACTION_RELEASE_REMOTE_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_REFS |
+      PARSEC_ACTION_RESHAPE_ON_RELEASE |
+      0x1,  /* mask of all dep_index */ 
+      NULL);
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static parsec_hook_return_t release_task_of_redistribute_reshuffle_Receive(parsec_execution_stream_t *es, parsec_task_t *this_task)
+{
+    const __parsec_redistribute_reshuffle_internal_taskpool_t *__parsec_tp =
+        (const __parsec_redistribute_reshuffle_internal_taskpool_t *)this_task->taskpool;
+    parsec_hash_table_t *ht = (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[1];
+    parsec_key_t key = this_task->task_class->make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals);
+    parsec_hashable_dependency_t *hash_dep = (parsec_hashable_dependency_t *)parsec_hash_table_remove(ht, key);
+    parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);
+    return parsec_release_task_to_mempool_update_nbtasks(es, this_task);
+}
+
+static char *redistribute_reshuffle_redistribute_reshuffle_Receive_internal_init_deps_key_functions_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_redistribute_reshuffle_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_reshuffle_internal_taskpool_t *)user_data;
+  __parsec_redistribute_reshuffle_Receive_parsec_assignment_t __jdf2c__assignments = {  .batch.value = 0, .m_T.value = 0, .n_T.value = 0, .m_Y.value = 0, .n_Y.value = 0, .rank_Y.value = 0, .rank_T.value = 0 };
+  int batch = (__parsec_key) % __parsec_tp->Receive_batch_range + __parsec_tp->Receive_batch_min;
+  __parsec_key = __parsec_key / __parsec_tp->Receive_batch_range;
+  __jdf2c__assignments.batch.value = batch;
+  int m_T = (__parsec_key) % __parsec_tp->Receive_m_T_range + __parsec_tp->Receive_m_T_min;
+  __parsec_key = __parsec_key / __parsec_tp->Receive_m_T_range;
+  __jdf2c__assignments.m_T.value = m_T;
+  int n_T = (__parsec_key) % __parsec_tp->Receive_n_T_range + __parsec_tp->Receive_n_T_min;
+  __parsec_key = __parsec_key / __parsec_tp->Receive_n_T_range;
+  __jdf2c__assignments.n_T.value = n_T;
+  int m_Y = ((m_T - m_T_START) + m_Y_START);
+  (void)m_Y;
+  __jdf2c__assignments.m_Y.value = m_Y;
+  int n_Y = ((n_T - n_T_START) + n_Y_START);
+  (void)n_Y;
+  __jdf2c__assignments.n_Y.value = n_Y;
+  int rank_Y = redistribute_reshuffle_Receive_inline_c_expr2_line_102(__parsec_tp, &__jdf2c__assignments);
+  (void)rank_Y;
+  __jdf2c__assignments.rank_Y.value = rank_Y;
+  int rank_T = redistribute_reshuffle_Receive_inline_c_expr1_line_103(__parsec_tp, &__jdf2c__assignments);
+  (void)rank_T;
+  __jdf2c__assignments.rank_T.value = rank_T;
+  (void)__jdf2c__assignments;
+  snprintf(buffer, buffer_size, "Receive(%d, %d, %d)", batch, m_T, n_T);
+  return buffer;
+}
+
+static parsec_key_fn_t redistribute_reshuffle_redistribute_reshuffle_Receive_internal_init_deps_key_functions = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = redistribute_reshuffle_redistribute_reshuffle_Receive_internal_init_deps_key_functions_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/* Needs: min-max count-tasks iterate */
+static int redistribute_reshuffle_Receive_internal_init(parsec_execution_stream_t * es, __parsec_redistribute_reshuffle_Receive_task_t * this_task)
+{
+  __parsec_redistribute_reshuffle_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_reshuffle_internal_taskpool_t*)this_task->taskpool;
+  int32_t nb_tasks = 0, saved_nb_tasks = 0;
+int32_t __batch_min = 0x7fffffff, __batch_max = 0;int32_t __jdf2c_batch_min = 0x7fffffff, __jdf2c_batch_max = 0;int32_t __m_T_min = 0x7fffffff, __m_T_max = 0;int32_t __jdf2c_m_T_min = 0x7fffffff, __jdf2c_m_T_max = 0;int32_t __n_T_min = 0x7fffffff, __n_T_max = 0;int32_t __jdf2c_n_T_min = 0x7fffffff, __jdf2c_n_T_max = 0;  __parsec_redistribute_reshuffle_Receive_parsec_assignment_t assignments = {  .batch.value = 0, .m_T.value = 0, .n_T.value = 0, .m_Y.value = 0, .n_Y.value = 0, .rank_Y.value = 0, .rank_T.value = 0 };
+  int32_t  batch,  m_T,  n_T,  m_Y,  n_Y,  rank_Y,  rank_T;
+  int32_t __jdf2c_batch_start, __jdf2c_batch_end, __jdf2c_batch_inc;
+  int32_t __jdf2c_m_T_start, __jdf2c_m_T_end, __jdf2c_m_T_inc;
+  int32_t __jdf2c_n_T_start, __jdf2c_n_T_end, __jdf2c_n_T_inc;
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+  PARSEC_PROFILING_TRACE(es->es_profile,
+                         this_task->taskpool->profiling_array[START_KEY(this_task->task_class->task_class_id)],
+                         0,
+                         this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    __jdf2c_batch_start = 0;
+    __jdf2c_batch_end = NT;
+    __jdf2c_batch_inc = 1;
+    __batch_min = parsec_imin(__jdf2c_batch_start, __jdf2c_batch_end);
+    __batch_max = parsec_imax(__jdf2c_batch_start, __jdf2c_batch_end);
+    __jdf2c_batch_min = parsec_imin(__jdf2c_batch_min, __batch_min);
+    __jdf2c_batch_max = parsec_imax(__jdf2c_batch_max, __batch_max);
+    for(batch =  __jdf2c_batch_start;
+        batch <= __jdf2c_batch_end;
+        batch += __jdf2c_batch_inc) {
+    assignments.batch.value = batch;
+      __jdf2c_m_T_start = m_T_START;
+      __jdf2c_m_T_end = m_T_END;
+      __jdf2c_m_T_inc = 1;
+      __m_T_min = parsec_imin(__jdf2c_m_T_start, __jdf2c_m_T_end);
+      __m_T_max = parsec_imax(__jdf2c_m_T_start, __jdf2c_m_T_end);
+      __jdf2c_m_T_min = parsec_imin(__jdf2c_m_T_min, __m_T_min);
+      __jdf2c_m_T_max = parsec_imax(__jdf2c_m_T_max, __m_T_max);
+      for(m_T =  __jdf2c_m_T_start;
+          m_T <= __jdf2c_m_T_end;
+          m_T += __jdf2c_m_T_inc) {
+      assignments.m_T.value = m_T;
+        __jdf2c_n_T_start = redistribute_reshuffle_Receive_inline_c_expr4_line_97(__parsec_tp, &assignments);
+        __jdf2c_n_T_end = redistribute_reshuffle_Receive_inline_c_expr3_line_97(__parsec_tp, &assignments);
+        __jdf2c_n_T_inc = 1;
+        __n_T_min = parsec_imin(__jdf2c_n_T_start, __jdf2c_n_T_end);
+        __n_T_max = parsec_imax(__jdf2c_n_T_start, __jdf2c_n_T_end);
+        __jdf2c_n_T_min = parsec_imin(__jdf2c_n_T_min, __n_T_min);
+        __jdf2c_n_T_max = parsec_imax(__jdf2c_n_T_max, __n_T_max);
+        for(n_T =  __jdf2c_n_T_start;
+            n_T <= __jdf2c_n_T_end;
+            n_T += __jdf2c_n_T_inc) {
+        assignments.n_T.value = n_T;
+      {  /* block for the non-range variable m_Y */
+          m_Y = ((m_T - m_T_START) + m_Y_START);
+          assignments.m_Y.value = m_Y;
+        {  /* block for the non-range variable n_Y */
+            n_Y = ((n_T - n_T_START) + n_Y_START);
+            assignments.n_Y.value = n_Y;
+          {  /* block for the non-range variable rank_Y */
+              rank_Y = redistribute_reshuffle_Receive_inline_c_expr2_line_102(__parsec_tp, &assignments);
+              assignments.rank_Y.value = rank_Y;
+            {  /* block for the non-range variable rank_T */
+                rank_T = redistribute_reshuffle_Receive_inline_c_expr1_line_103(__parsec_tp, &assignments);
+                assignments.rank_T.value = rank_T;
+                if( !Receive_pred(batch, m_T, n_T, m_Y, n_Y, rank_Y, rank_T) ) continue;
+                nb_tasks++;
+              } /* block for the non-range variable rank_T */ 
+            } /* block for the non-range variable rank_Y */ 
+          } /* block for the non-range variable n_Y */ 
+        } /* block for the non-range variable m_Y */ 
+      } /* Loop on normal range n_T */
+    } /* For loop of m_T */ 
+  } /* For loop of batch */ 
+   if( 0 != nb_tasks ) {
+     (void)parsec_atomic_fetch_add_int32(&__parsec_tp->initial_number_tasks, nb_tasks);
+   }
+  /* Set the range variables for the collision-free hash-computation */
+  __parsec_tp->Receive_batch_min   = __jdf2c_batch_min;
+  __parsec_tp->Receive_batch_range = (__jdf2c_batch_max - __jdf2c_batch_min) + 1;
+  __parsec_tp->Receive_m_T_min   = __jdf2c_m_T_min;
+  __parsec_tp->Receive_m_T_range = (__jdf2c_m_T_max - __jdf2c_m_T_min) + 1;
+  __parsec_tp->Receive_n_T_min   = __jdf2c_n_T_min;
+  __parsec_tp->Receive_n_T_range = (__jdf2c_n_T_max - __jdf2c_n_T_min) + 1;
+  this_task->status = PARSEC_TASK_STATUS_COMPLETE;
+
+  PARSEC_AYU_REGISTER_TASK(&redistribute_reshuffle_Receive);
+  __parsec_tp->super.super.dependencies_array[1] = PARSEC_OBJ_NEW(parsec_hash_table_t);
+  parsec_hash_table_init(__parsec_tp->super.super.dependencies_array[1], offsetof(parsec_hashable_dependency_t, ht_item), 10, redistribute_reshuffle_redistribute_reshuffle_Receive_internal_init_deps_key_functions, this_task->taskpool);
+  __parsec_tp->repositories[1] = data_repo_create_nothreadsafe(nb_tasks, __jdf2c_key_fns_Receive, (parsec_taskpool_t*)__parsec_tp, 3);
+(void)saved_nb_tasks;
+(void)__batch_min; (void)__batch_max;(void)__m_T_min; (void)__m_T_max;(void)__n_T_min; (void)__n_T_max;  (void)__jdf2c_batch_start; (void)__jdf2c_batch_end; (void)__jdf2c_batch_inc;  (void)__jdf2c_m_T_start; (void)__jdf2c_m_T_end; (void)__jdf2c_m_T_inc;  (void)__jdf2c_n_T_start; (void)__jdf2c_n_T_end; (void)__jdf2c_n_T_inc;  (void)assignments; (void)__parsec_tp; (void)es;
+  if(1 == parsec_atomic_fetch_dec_int32(&__parsec_tp->sync_point)) {
+    /* Last initialization task complete. Update the number of tasks. */
+    __parsec_tp->super.super.tdm.module->taskpool_addto_nb_tasks(&__parsec_tp->super.super, __parsec_tp->initial_number_tasks);
+    parsec_mfence();  /* write memory barrier to guarantee that the scheduler gets the correct number of tasks */
+    parsec_taskpool_enable((parsec_taskpool_t*)__parsec_tp, &__parsec_tp->startup_queue,
+                           (parsec_task_t*)this_task, es, __parsec_tp->super.super.nb_pending_actions);
+    __parsec_tp->super.super.tdm.module->taskpool_ready(&__parsec_tp->super.super);
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+    PARSEC_PROFILING_TRACE(es->es_profile,
+                           this_task->taskpool->profiling_array[2 * this_task->task_class->task_class_id + 1],
+                           0,
+                           this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    return PARSEC_HOOK_RETURN_DONE;
+  }
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static const __parsec_chore_t __redistribute_reshuffle_Receive_chores[] ={
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+    { .type     = PARSEC_DEV_CPU,
+      .evaluate = (parsec_evaluate_function_t*)NULL,
+      .hook     = (parsec_hook_t*)hook_of_redistribute_reshuffle_Receive },
+#endif  /* defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+    { .type     = PARSEC_DEV_NONE,
+      .evaluate = NULL,
+      .hook     = (parsec_hook_t*)NULL },  /* End marker */
+};
+
+static const parsec_task_class_t redistribute_reshuffle_Receive = {
+  .name = "Receive",
+  .task_class_id = 1,
+  .nb_flows = 3,
+  .nb_parameters = 3,
+  .nb_locals = 7,
+  .task_class_type = PARSEC_TASK_CLASS_TYPE_PTG,
+  .params = { &symb_redistribute_reshuffle_Receive_m_T, &symb_redistribute_reshuffle_Receive_n_T, &symb_redistribute_reshuffle_Receive_batch, NULL },
+  .locals = { &symb_redistribute_reshuffle_Receive_batch, &symb_redistribute_reshuffle_Receive_m_T, &symb_redistribute_reshuffle_Receive_n_T, &symb_redistribute_reshuffle_Receive_m_Y, &symb_redistribute_reshuffle_Receive_n_Y, &symb_redistribute_reshuffle_Receive_rank_Y, &symb_redistribute_reshuffle_Receive_rank_T, NULL },
+  .data_affinity = (parsec_data_ref_fn_t*)affinity_of_redistribute_reshuffle_Receive,
+  .initial_data = (parsec_data_ref_fn_t*)affinity_of_redistribute_reshuffle_Receive,
+  .final_data = (parsec_data_ref_fn_t*)affinity_of_redistribute_reshuffle_Receive,
+  .priority = NULL,
+  .properties = properties_of_redistribute_reshuffle_Receive,
+#if MAX_PARAM_COUNT < 2  /* number of read flows of Receive */
+  #error Too many read flows for task Receive
+#endif  /* MAX_PARAM_COUNT */
+#if MAX_PARAM_COUNT < 0  /* number of write flows of Receive */
+  #error Too many write flows for task Receive
+#endif  /* MAX_PARAM_COUNT */
+  .in = { &flow_of_redistribute_reshuffle_Receive_for_Y, &flow_of_redistribute_reshuffle_Receive_for_T, NULL },
+  .out = { &flow_of_redistribute_reshuffle_Receive_for_ctl, NULL },
+  .flags = 0x0 | PARSEC_HAS_IN_IN_DEPENDENCIES | PARSEC_USE_DEPS_MASK,
+  .dependencies_goal = 0x3,
+  .make_key = __jdf2c_make_key_Receive,
+  .task_snprintf = parsec_task_snprintf,
+#if defined(PARSEC_PROF_TRACE)
+  .profile_info = &parsec_task_profile_info,
+#endif
+  .key_functions = &__jdf2c_key_fns_Receive,
+  .fini = (parsec_hook_t*)NULL,
+  .incarnations = __redistribute_reshuffle_Receive_chores,
+  .find_deps = parsec_hash_find_deps,
+  .update_deps = parsec_update_deps_with_mask,
+  .iterate_successors = (parsec_traverse_function_t*)iterate_successors_of_redistribute_reshuffle_Receive,
+  .iterate_predecessors = (parsec_traverse_function_t*)iterate_predecessors_of_redistribute_reshuffle_Receive,
+  .release_deps = (parsec_release_deps_t*)release_deps_of_redistribute_reshuffle_Receive,
+  .prepare_output = (parsec_hook_t*)NULL,
+  .prepare_input = (parsec_hook_t*)data_lookup_of_redistribute_reshuffle_Receive,
+  .time_estimate = NULL,
+  .get_datatype = datatype_lookup_of_redistribute_reshuffle_Receive,
+  .complete_execution = (parsec_hook_t*)complete_hook_of_redistribute_reshuffle_Receive,
+  .release_task = &release_task_of_redistribute_reshuffle_Receive,
+#if defined(PARSEC_SIM)
+  .sim_cost_fct = (parsec_sim_cost_fct_t*)NULL,
+#endif
+};
+
+
+/******                                      Send                                      ******/
+
+static inline int32_t minexpr_of_symb_redistribute_reshuffle_Send_batch_fct(const __parsec_redistribute_reshuffle_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_reshuffle_Send_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_redistribute_reshuffle_Send_batch = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_redistribute_reshuffle_Send_batch_fct }
+                   }
+};
+static inline int maxexpr_of_symb_redistribute_reshuffle_Send_batch_fct(const __parsec_redistribute_reshuffle_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_reshuffle_Send_parsec_assignment_t *locals)
+{
+  const int batch = locals->batch.value; (void)batch;
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int rank_Y = locals->rank_Y.value; (void)rank_Y;
+  const int rank_T = locals->rank_T.value; (void)rank_T;
+
+  (void)batch;
+  (void)m_Y;
+  (void)n_Y;
+  (void)m_T;
+  (void)n_T;
+  (void)rank_Y;
+  (void)rank_T;
+  (void)__parsec_tp; (void)locals;
+  return NT;
+}
+static const parsec_expr_t maxexpr_of_symb_redistribute_reshuffle_Send_batch = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_redistribute_reshuffle_Send_batch_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_reshuffle_Send_batch = { .name = "batch", .context_index = 0, .min = &minexpr_of_symb_redistribute_reshuffle_Send_batch, .max = &maxexpr_of_symb_redistribute_reshuffle_Send_batch, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int minexpr_of_symb_redistribute_reshuffle_Send_m_Y_fct(const __parsec_redistribute_reshuffle_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_reshuffle_Send_parsec_assignment_t *locals)
+{
+  const int batch = locals->batch.value; (void)batch;
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int rank_Y = locals->rank_Y.value; (void)rank_Y;
+  const int rank_T = locals->rank_T.value; (void)rank_T;
+
+  (void)batch;
+  (void)m_Y;
+  (void)n_Y;
+  (void)m_T;
+  (void)n_T;
+  (void)rank_Y;
+  (void)rank_T;
+  (void)__parsec_tp; (void)locals;
+  return m_Y_START;
+}
+static const parsec_expr_t minexpr_of_symb_redistribute_reshuffle_Send_m_Y = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_redistribute_reshuffle_Send_m_Y_fct }
+                   }
+};
+static inline int maxexpr_of_symb_redistribute_reshuffle_Send_m_Y_fct(const __parsec_redistribute_reshuffle_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_reshuffle_Send_parsec_assignment_t *locals)
+{
+  const int batch = locals->batch.value; (void)batch;
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int rank_Y = locals->rank_Y.value; (void)rank_Y;
+  const int rank_T = locals->rank_T.value; (void)rank_T;
+
+  (void)batch;
+  (void)m_Y;
+  (void)n_Y;
+  (void)m_T;
+  (void)n_T;
+  (void)rank_Y;
+  (void)rank_T;
+  (void)__parsec_tp; (void)locals;
+  return m_Y_END;
+}
+static const parsec_expr_t maxexpr_of_symb_redistribute_reshuffle_Send_m_Y = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_redistribute_reshuffle_Send_m_Y_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_reshuffle_Send_m_Y = { .name = "m_Y", .context_index = 1, .min = &minexpr_of_symb_redistribute_reshuffle_Send_m_Y, .max = &maxexpr_of_symb_redistribute_reshuffle_Send_m_Y, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int32_t minexpr_of_symb_redistribute_reshuffle_Send_n_Y_fct(const __parsec_redistribute_reshuffle_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_reshuffle_Send_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_reshuffle_Send_inline_c_expr8_line_53(__parsec_tp, locals);
+}
+static const parsec_expr_t minexpr_of_symb_redistribute_reshuffle_Send_n_Y = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_redistribute_reshuffle_Send_n_Y_fct }
+                   }
+};
+static inline int32_t maxexpr_of_symb_redistribute_reshuffle_Send_n_Y_fct(const __parsec_redistribute_reshuffle_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_reshuffle_Send_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_reshuffle_Send_inline_c_expr7_line_53(__parsec_tp, locals);
+}
+static const parsec_expr_t maxexpr_of_symb_redistribute_reshuffle_Send_n_Y = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_redistribute_reshuffle_Send_n_Y_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_reshuffle_Send_n_Y = { .name = "n_Y", .context_index = 2, .min = &minexpr_of_symb_redistribute_reshuffle_Send_n_Y, .max = &maxexpr_of_symb_redistribute_reshuffle_Send_n_Y, .cst_inc = 1, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int expr_of_symb_redistribute_reshuffle_Send_m_T_fct(const __parsec_redistribute_reshuffle_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_reshuffle_Send_parsec_assignment_t *locals)
+{
+  const int batch = locals->batch.value; (void)batch;
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int rank_Y = locals->rank_Y.value; (void)rank_Y;
+  const int rank_T = locals->rank_T.value; (void)rank_T;
+
+  (void)batch;
+  (void)m_Y;
+  (void)n_Y;
+  (void)m_T;
+  (void)n_T;
+  (void)rank_Y;
+  (void)rank_T;
+  (void)__parsec_tp; (void)locals;
+  return ((m_Y - m_Y_START) + m_T_START);
+}
+static const parsec_expr_t expr_of_symb_redistribute_reshuffle_Send_m_T = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_reshuffle_Send_m_T_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_reshuffle_Send_m_T = { .name = "m_T", .context_index = 3, .min = &expr_of_symb_redistribute_reshuffle_Send_m_T, .max = &expr_of_symb_redistribute_reshuffle_Send_m_T, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int expr_of_symb_redistribute_reshuffle_Send_n_T_fct(const __parsec_redistribute_reshuffle_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_reshuffle_Send_parsec_assignment_t *locals)
+{
+  const int batch = locals->batch.value; (void)batch;
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int rank_Y = locals->rank_Y.value; (void)rank_Y;
+  const int rank_T = locals->rank_T.value; (void)rank_T;
+
+  (void)batch;
+  (void)m_Y;
+  (void)n_Y;
+  (void)m_T;
+  (void)n_T;
+  (void)rank_Y;
+  (void)rank_T;
+  (void)__parsec_tp; (void)locals;
+  return ((n_Y - n_Y_START) + n_T_START);
+}
+static const parsec_expr_t expr_of_symb_redistribute_reshuffle_Send_n_T = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_reshuffle_Send_n_T_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_reshuffle_Send_n_T = { .name = "n_T", .context_index = 4, .min = &expr_of_symb_redistribute_reshuffle_Send_n_T, .max = &expr_of_symb_redistribute_reshuffle_Send_n_T, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_redistribute_reshuffle_Send_rank_Y_fct(const __parsec_redistribute_reshuffle_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_reshuffle_Send_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_reshuffle_Send_inline_c_expr6_line_58(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_redistribute_reshuffle_Send_rank_Y = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_reshuffle_Send_rank_Y_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_reshuffle_Send_rank_Y = { .name = "rank_Y", .context_index = 5, .min = &expr_of_symb_redistribute_reshuffle_Send_rank_Y, .max = &expr_of_symb_redistribute_reshuffle_Send_rank_Y, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_redistribute_reshuffle_Send_rank_T_fct(const __parsec_redistribute_reshuffle_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_reshuffle_Send_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_reshuffle_Send_inline_c_expr5_line_59(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_redistribute_reshuffle_Send_rank_T = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_reshuffle_Send_rank_T_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_reshuffle_Send_rank_T = { .name = "rank_T", .context_index = 6, .min = &expr_of_symb_redistribute_reshuffle_Send_rank_T, .max = &expr_of_symb_redistribute_reshuffle_Send_rank_T, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int affinity_of_redistribute_reshuffle_Send(const __parsec_redistribute_reshuffle_Send_task_t *this_task,
+                     parsec_data_ref_t *ref)
+{
+    const __parsec_redistribute_reshuffle_internal_taskpool_t *__parsec_tp = (const __parsec_redistribute_reshuffle_internal_taskpool_t*)this_task->taskpool;
+  const int batch = this_task->locals.batch.value; (void)batch;
+  const int m_Y = this_task->locals.m_Y.value; (void)m_Y;
+  const int n_Y = this_task->locals.n_Y.value; (void)n_Y;
+  const int m_T = this_task->locals.m_T.value; (void)m_T;
+  const int n_T = this_task->locals.n_T.value; (void)n_T;
+  const int rank_Y = this_task->locals.rank_Y.value; (void)rank_Y;
+  const int rank_T = this_task->locals.rank_T.value; (void)rank_T;
+
+  /* Silent Warnings: should look into predicate to know what variables are usefull */
+  (void)batch;
+  (void)m_Y;
+  (void)n_Y;
+  (void)m_T;
+  (void)n_T;
+  (void)rank_Y;
+  (void)rank_T;
+  ref->dc = (parsec_data_collection_t *)__parsec_tp->super._g_descY;
+  /* Compute data key */
+  ref->key = ref->dc->data_key(ref->dc, m_Y, n_Y);
+  return 1;
+}
+static const parsec_property_t properties_of_redistribute_reshuffle_Send[1] = {
+  {.name = NULL, .expr = NULL}
+};
+static parsec_data_t *flow_of_redistribute_reshuffle_Send_for_Y_dep1_atline_63_direct_access(const __parsec_redistribute_reshuffle_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_reshuffle_Send_parsec_assignment_t *assignments)
+{
+  const int batch = assignments->batch.value; (void)batch;
+  const int m_Y = assignments->m_Y.value; (void)m_Y;
+  const int n_Y = assignments->n_Y.value; (void)n_Y;
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int rank_Y = assignments->rank_Y.value; (void)rank_Y;
+  const int rank_T = assignments->rank_T.value; (void)rank_T;
+
+  /* Silence Warnings: should look into parameters to know what variables are useful */
+  (void)batch;
+  (void)m_Y;
+  (void)n_Y;
+  (void)m_T;
+  (void)n_T;
+  (void)rank_Y;
+  (void)rank_T;
+  if( __parsec_tp->super.super.context->my_rank == (int32_t)rank_of_descY(m_Y, n_Y) )
+    return data_of_descY(m_Y, n_Y);
+  return NULL;
+}
+
+static const parsec_dep_t flow_of_redistribute_reshuffle_Send_for_Y_dep1_atline_63 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = PARSEC_LOCAL_DATA_TASK_CLASS_ID, /* redistribute_reshuffle_descY */
+  .direct_data = (parsec_data_lookup_func_t)&flow_of_redistribute_reshuffle_Send_for_Y_dep1_atline_63_direct_access,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_redistribute_reshuffle_Send_for_Y,
+};
+static inline int expr_of_cond_for_flow_of_redistribute_reshuffle_Send_for_Y_dep2_atline_64_fct(const __parsec_redistribute_reshuffle_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_reshuffle_Send_parsec_assignment_t *locals)
+{
+  const int batch = locals->batch.value; (void)batch;
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int rank_Y = locals->rank_Y.value; (void)rank_Y;
+  const int rank_T = locals->rank_T.value; (void)rank_T;
+
+  (void)batch;
+  (void)m_Y;
+  (void)n_Y;
+  (void)m_T;
+  (void)n_T;
+  (void)rank_Y;
+  (void)rank_T;
+  (void)__parsec_tp; (void)locals;
+  return (rank_Y) == (rank_T);
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_redistribute_reshuffle_Send_for_Y_dep2_atline_64 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_redistribute_reshuffle_Send_for_Y_dep2_atline_64_fct }
+                   }
+};
+static const parsec_dep_t flow_of_redistribute_reshuffle_Send_for_Y_dep2_atline_64 = {
+  .cond = &expr_of_cond_for_flow_of_redistribute_reshuffle_Send_for_Y_dep2_atline_64,  /* (rank_Y) == (rank_T) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 1, /* redistribute_reshuffle_Receive */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_redistribute_reshuffle_Receive_for_Y,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_redistribute_reshuffle_Send_for_Y,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+#if MAX_DEP_OUT_COUNT < 1  /* number of output dependencies */
+    #error Too many output dependencies (supports up to MAX_DEP_OUT_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_OUT_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_redistribute_reshuffle_Send_for_Y = {
+  .name               = "Y",
+  .sym_type           = PARSEC_SYM_INOUT,
+  .flow_flags         = PARSEC_FLOW_ACCESS_READ|PARSEC_FLOW_HAS_IN_DEPS,
+  .flow_index         = 0,
+  .flow_datatype_mask = 0x1,
+  .dep_in     = { &flow_of_redistribute_reshuffle_Send_for_Y_dep1_atline_63 },
+  .dep_out    = { &flow_of_redistribute_reshuffle_Send_for_Y_dep2_atline_64 }
+};
+
+static inline int expr_of_cond_for_flow_of_redistribute_reshuffle_Send_for_R_dep1_atline_66_iftrue_fct(const __parsec_redistribute_reshuffle_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_reshuffle_Send_parsec_assignment_t *locals)
+{
+  const int batch = locals->batch.value; (void)batch;
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int rank_Y = locals->rank_Y.value; (void)rank_Y;
+  const int rank_T = locals->rank_T.value; (void)rank_T;
+
+  (void)batch;
+  (void)m_Y;
+  (void)n_Y;
+  (void)m_T;
+  (void)n_T;
+  (void)rank_Y;
+  (void)rank_T;
+  (void)__parsec_tp; (void)locals;
+  return (rank_Y) != (rank_T);
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_redistribute_reshuffle_Send_for_R_dep1_atline_66_iftrue = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_redistribute_reshuffle_Send_for_R_dep1_atline_66_iftrue_fct }
+                   }
+};
+static const parsec_dep_t flow_of_redistribute_reshuffle_Send_for_R_dep1_atline_66_iftrue = {
+  .cond = &expr_of_cond_for_flow_of_redistribute_reshuffle_Send_for_R_dep1_atline_66_iftrue,  /* (rank_Y) != (rank_T) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = PARSEC_LOCAL_DATA_TASK_CLASS_ID, /* redistribute_reshuffle___parsec_write_type */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .dep_index = 1,
+  .dep_datatype_index = 1,
+  .belongs_to = &flow_of_redistribute_reshuffle_Send_for_R,
+};
+static inline int expr_of_cond_for_flow_of_redistribute_reshuffle_Send_for_R_dep1_atline_66_iffalse_fct(const __parsec_redistribute_reshuffle_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_reshuffle_Send_parsec_assignment_t *locals)
+{
+  const int batch = locals->batch.value; (void)batch;
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int rank_Y = locals->rank_Y.value; (void)rank_Y;
+  const int rank_T = locals->rank_T.value; (void)rank_T;
+
+  (void)batch;
+  (void)m_Y;
+  (void)n_Y;
+  (void)m_T;
+  (void)n_T;
+  (void)rank_Y;
+  (void)rank_T;
+  (void)__parsec_tp; (void)locals;
+  return !((rank_Y) != (rank_T));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_redistribute_reshuffle_Send_for_R_dep1_atline_66_iffalse = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_redistribute_reshuffle_Send_for_R_dep1_atline_66_iffalse_fct }
+                   }
+};
+static const parsec_dep_t flow_of_redistribute_reshuffle_Send_for_R_dep1_atline_66_iffalse = {
+  .cond = &expr_of_cond_for_flow_of_redistribute_reshuffle_Send_for_R_dep1_atline_66_iffalse,  /* !(rank_Y) != (rank_T) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = PARSEC_LOCAL_DATA_TASK_CLASS_ID, /* redistribute_reshuffle___parsec_null_type */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .dep_index = 1,
+  .dep_datatype_index = 1,
+  .belongs_to = &flow_of_redistribute_reshuffle_Send_for_R,
+};
+static inline int expr_of_cond_for_flow_of_redistribute_reshuffle_Send_for_R_dep2_atline_67_fct(const __parsec_redistribute_reshuffle_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_reshuffle_Send_parsec_assignment_t *locals)
+{
+  const int batch = locals->batch.value; (void)batch;
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int rank_Y = locals->rank_Y.value; (void)rank_Y;
+  const int rank_T = locals->rank_T.value; (void)rank_T;
+
+  (void)batch;
+  (void)m_Y;
+  (void)n_Y;
+  (void)m_T;
+  (void)n_T;
+  (void)rank_Y;
+  (void)rank_T;
+  (void)__parsec_tp; (void)locals;
+  return (rank_Y) != (rank_T);
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_redistribute_reshuffle_Send_for_R_dep2_atline_67 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_redistribute_reshuffle_Send_for_R_dep2_atline_67_fct }
+                   }
+};
+static const parsec_dep_t flow_of_redistribute_reshuffle_Send_for_R_dep2_atline_67 = {
+  .cond = &expr_of_cond_for_flow_of_redistribute_reshuffle_Send_for_R_dep2_atline_67,  /* (rank_Y) != (rank_T) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 1, /* redistribute_reshuffle_Receive */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_redistribute_reshuffle_Receive_for_Y,
+  .dep_index = 1,
+  .dep_datatype_index = 1,
+  .belongs_to = &flow_of_redistribute_reshuffle_Send_for_R,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+#if MAX_DEP_OUT_COUNT < 1  /* number of output dependencies */
+    #error Too many output dependencies (supports up to MAX_DEP_OUT_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_OUT_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_redistribute_reshuffle_Send_for_R = {
+  .name               = "R",
+  .sym_type           = PARSEC_SYM_INOUT,
+  .flow_flags         = PARSEC_FLOW_ACCESS_RW|PARSEC_FLOW_HAS_IN_DEPS,
+  .flow_index         = 1,
+  .flow_datatype_mask = 0x2,
+  .dep_in     = { &flow_of_redistribute_reshuffle_Send_for_R_dep1_atline_66_iftrue,
+ &flow_of_redistribute_reshuffle_Send_for_R_dep1_atline_66_iffalse },
+  .dep_out    = { &flow_of_redistribute_reshuffle_Send_for_R_dep2_atline_67 }
+};
+
+static inline int expr_of_cond_for_flow_of_redistribute_reshuffle_Send_for_ctl_dep1_atline_69_fct(const __parsec_redistribute_reshuffle_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_reshuffle_Send_parsec_assignment_t *locals)
+{
+  const int batch = locals->batch.value;
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int rank_Y = locals->rank_Y.value; (void)rank_Y;
+  const int rank_T = locals->rank_T.value; (void)rank_T;
+
+  (void)batch;
+  (void)m_Y;
+  (void)n_Y;
+  (void)m_T;
+  (void)n_T;
+  (void)rank_Y;
+  (void)rank_T;
+  (void)__parsec_tp; (void)locals;
+  return (batch) > (0);
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_redistribute_reshuffle_Send_for_ctl_dep1_atline_69 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_redistribute_reshuffle_Send_for_ctl_dep1_atline_69_fct }
+                   }
+};
+static const parsec_dep_t flow_of_redistribute_reshuffle_Send_for_ctl_dep1_atline_69 = {
+  .cond = &expr_of_cond_for_flow_of_redistribute_reshuffle_Send_for_ctl_dep1_atline_69,  /* (batch) > (0) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 1, /* redistribute_reshuffle_Receive */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_redistribute_reshuffle_Receive_for_ctl,
+  .dep_index = 2,
+  .dep_datatype_index = 2,
+  .belongs_to = &flow_of_redistribute_reshuffle_Send_for_ctl,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_redistribute_reshuffle_Send_for_ctl = {
+  .name               = "ctl",
+  .sym_type           = PARSEC_SYM_IN,
+  .flow_flags         = PARSEC_FLOW_ACCESS_NONE|PARSEC_FLOW_HAS_IN_DEPS,
+  .flow_index         = 2,
+  .flow_datatype_mask = 0x0,
+  .dep_in     = { &flow_of_redistribute_reshuffle_Send_for_ctl_dep1_atline_69 },
+  .dep_out    = { NULL }
+};
+
+static void
+iterate_successors_of_redistribute_reshuffle_Send(parsec_execution_stream_t *es, const __parsec_redistribute_reshuffle_Send_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_redistribute_reshuffle_internal_taskpool_t *__parsec_tp = (const __parsec_redistribute_reshuffle_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_redistribute_reshuffle_Send_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_redistribute_reshuffle_Send_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int batch = __jdf2c__tmp_locals.batch.value; (void)batch;
+  const int m_Y = __jdf2c__tmp_locals.m_Y.value; (void)m_Y;
+  const int n_Y = __jdf2c__tmp_locals.n_Y.value; (void)n_Y;
+  const int m_T = __jdf2c__tmp_locals.m_T.value; (void)m_T;
+  const int n_T = __jdf2c__tmp_locals.n_T.value; (void)n_T;
+  const int rank_Y = __jdf2c__tmp_locals.rank_Y.value; (void)rank_Y;
+  const int rank_T = __jdf2c__tmp_locals.rank_T.value; (void)rank_T;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)batch;  (void)m_Y;  (void)n_Y;  (void)m_T;  (void)n_T;  (void)rank_Y;  (void)rank_T;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_descY(m_Y, n_Y);
+#endif
+  if( action_mask & 0x1 ) {  /* Flow of data Y [0] */
+    data.data   = this_task->data._f_Y.data_out;
+    data.data_future  = NULL;
+    if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_redistribute_reshuffle_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_redistribute_reshuffle_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+       if( (rank_Y) == (rank_T) ) {
+      __parsec_redistribute_reshuffle_Receive_task_t* ncc = (__parsec_redistribute_reshuffle_Receive_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[redistribute_reshuffle_Receive.task_class_id];
+        const int Receive_batch = batch;
+        if( (Receive_batch >= (0)) && (Receive_batch <= (NT)) ) {
+          assert(&nc.locals[0].value == &ncc->locals.batch.value);
+          ncc->locals.batch.value = Receive_batch;
+          const int Receive_m_T = m_T;
+          if( (Receive_m_T >= (m_T_START)) && (Receive_m_T <= (m_T_END)) ) {
+            assert(&nc.locals[1].value == &ncc->locals.m_T.value);
+            ncc->locals.m_T.value = Receive_m_T;
+            const int Receive_n_T = n_T;
+            if( (Receive_n_T >= (redistribute_reshuffle_Receive_inline_c_expr4_line_97(__parsec_tp, &ncc->locals))) && (Receive_n_T <= (redistribute_reshuffle_Receive_inline_c_expr3_line_97(__parsec_tp, &ncc->locals))) ) {
+              assert(&nc.locals[2].value == &ncc->locals.n_T.value);
+              ncc->locals.n_T.value = Receive_n_T;
+              const int Receive_m_Y = ((ncc->locals.m_T.value - m_T_START) + m_Y_START);
+              assert(&nc.locals[3].value == &ncc->locals.m_Y.value);
+              ncc->locals.m_Y.value = Receive_m_Y;
+              const int Receive_n_Y = ((ncc->locals.n_T.value - n_T_START) + n_Y_START);
+              assert(&nc.locals[4].value == &ncc->locals.n_Y.value);
+              ncc->locals.n_Y.value = Receive_n_Y;
+              const int Receive_rank_Y = redistribute_reshuffle_Receive_inline_c_expr2_line_102(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[5].value == &ncc->locals.rank_Y.value);
+              ncc->locals.rank_Y.value = Receive_rank_Y;
+              const int Receive_rank_T = redistribute_reshuffle_Receive_inline_c_expr1_line_103(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[6].value == &ncc->locals.rank_T.value);
+              ncc->locals.rank_T.value = Receive_rank_T;
+#if defined(DISTRIBUTED)
+              rank_dst = rank_of_descT(ncc->locals.m_T.value, ncc->locals.n_T.value);
+              if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+                vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descT)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descT, ncc->locals.m_T.value, ncc->locals.n_T.value);
+              nc.priority = __parsec_tp->super.super.priority;
+              successor_repo = Receive_repo;
+              successor_repo_key = __jdf2c_make_key_Receive((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+            RELEASE_DEP_OUTPUT(es, "Y", this_task, "Y", &nc, rank_src, rank_dst, &data);
+            if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_redistribute_reshuffle_Send_for_Y_dep2_atline_64, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+              }
+            }
+          }
+    }
+  }
+  if( action_mask & 0x2 ) {  /* Flow of data R [1] */
+    data.data   = this_task->data._f_R.data_out;
+    data.data_future  = NULL;
+    if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_redistribute_reshuffle_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_redistribute_reshuffle_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+       if( (rank_Y) != (rank_T) ) {
+      __parsec_redistribute_reshuffle_Receive_task_t* ncc = (__parsec_redistribute_reshuffle_Receive_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[redistribute_reshuffle_Receive.task_class_id];
+        const int Receive_batch = batch;
+        if( (Receive_batch >= (0)) && (Receive_batch <= (NT)) ) {
+          assert(&nc.locals[0].value == &ncc->locals.batch.value);
+          ncc->locals.batch.value = Receive_batch;
+          const int Receive_m_T = m_T;
+          if( (Receive_m_T >= (m_T_START)) && (Receive_m_T <= (m_T_END)) ) {
+            assert(&nc.locals[1].value == &ncc->locals.m_T.value);
+            ncc->locals.m_T.value = Receive_m_T;
+            const int Receive_n_T = n_T;
+            if( (Receive_n_T >= (redistribute_reshuffle_Receive_inline_c_expr4_line_97(__parsec_tp, &ncc->locals))) && (Receive_n_T <= (redistribute_reshuffle_Receive_inline_c_expr3_line_97(__parsec_tp, &ncc->locals))) ) {
+              assert(&nc.locals[2].value == &ncc->locals.n_T.value);
+              ncc->locals.n_T.value = Receive_n_T;
+              const int Receive_m_Y = ((ncc->locals.m_T.value - m_T_START) + m_Y_START);
+              assert(&nc.locals[3].value == &ncc->locals.m_Y.value);
+              ncc->locals.m_Y.value = Receive_m_Y;
+              const int Receive_n_Y = ((ncc->locals.n_T.value - n_T_START) + n_Y_START);
+              assert(&nc.locals[4].value == &ncc->locals.n_Y.value);
+              ncc->locals.n_Y.value = Receive_n_Y;
+              const int Receive_rank_Y = redistribute_reshuffle_Receive_inline_c_expr2_line_102(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[5].value == &ncc->locals.rank_Y.value);
+              ncc->locals.rank_Y.value = Receive_rank_Y;
+              const int Receive_rank_T = redistribute_reshuffle_Receive_inline_c_expr1_line_103(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[6].value == &ncc->locals.rank_T.value);
+              ncc->locals.rank_T.value = Receive_rank_T;
+#if defined(DISTRIBUTED)
+              rank_dst = rank_of_descT(ncc->locals.m_T.value, ncc->locals.n_T.value);
+              if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+                vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descT)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descT, ncc->locals.m_T.value, ncc->locals.n_T.value);
+              nc.priority = __parsec_tp->super.super.priority;
+              successor_repo = Receive_repo;
+              successor_repo_key = __jdf2c_make_key_Receive((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+            RELEASE_DEP_OUTPUT(es, "R", this_task, "Y", &nc, rank_src, rank_dst, &data);
+            if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_redistribute_reshuffle_Send_for_R_dep2_atline_67, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+              }
+            }
+          }
+    }
+  }
+  /* Flow of data ctl has only IN dependencies */
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static void
+iterate_predecessors_of_redistribute_reshuffle_Send(parsec_execution_stream_t *es, const __parsec_redistribute_reshuffle_Send_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_redistribute_reshuffle_internal_taskpool_t *__parsec_tp = (const __parsec_redistribute_reshuffle_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_redistribute_reshuffle_Send_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_redistribute_reshuffle_Send_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int batch = __jdf2c__tmp_locals.batch.value; (void)batch;
+  const int m_Y = __jdf2c__tmp_locals.m_Y.value; (void)m_Y;
+  const int n_Y = __jdf2c__tmp_locals.n_Y.value; (void)n_Y;
+  const int m_T = __jdf2c__tmp_locals.m_T.value; (void)m_T;
+  const int n_T = __jdf2c__tmp_locals.n_T.value; (void)n_T;
+  const int rank_Y = __jdf2c__tmp_locals.rank_Y.value; (void)rank_Y;
+  const int rank_T = __jdf2c__tmp_locals.rank_T.value; (void)rank_T;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)batch;  (void)m_Y;  (void)n_Y;  (void)m_T;  (void)n_T;  (void)rank_Y;  (void)rank_T;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_descY(m_Y, n_Y);
+#endif
+  /* Flow of data Y has only OUTPUT dependencies to Memory */
+  /* Flow of data R has only OUTPUT dependencies to Memory */
+  if( action_mask & 0x4 ) {  /* Flow of data ctl [2] */
+    data.data   = this_task->data._f_ctl.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x4 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  =   /* Control: always empty */ 0;
+    data.local.dst_count  =   /* Control: always empty */ 0;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = NULL;
+    data.remote.src_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.src_count  =   /* Control: always empty */ 0;
+    data.remote.dst_count  =   /* Control: always empty */ 0;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( (batch) > (0) ) {
+      __parsec_redistribute_reshuffle_Receive_task_t* ncc = (__parsec_redistribute_reshuffle_Receive_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[redistribute_reshuffle_Receive.task_class_id];
+        const int Receive_batch = (batch - 1);
+        if( (Receive_batch >= (0)) && (Receive_batch <= (NT)) ) {
+          assert(&nc.locals[0].value == &ncc->locals.batch.value);
+          ncc->locals.batch.value = Receive_batch;
+          const int Receive_m_T = m_T;
+          if( (Receive_m_T >= (m_T_START)) && (Receive_m_T <= (m_T_END)) ) {
+            assert(&nc.locals[1].value == &ncc->locals.m_T.value);
+            ncc->locals.m_T.value = Receive_m_T;
+            const int Receive_n_T = (n_T - num_col);
+            if( (Receive_n_T >= (redistribute_reshuffle_Receive_inline_c_expr4_line_97(__parsec_tp, &ncc->locals))) && (Receive_n_T <= (redistribute_reshuffle_Receive_inline_c_expr3_line_97(__parsec_tp, &ncc->locals))) ) {
+              assert(&nc.locals[2].value == &ncc->locals.n_T.value);
+              ncc->locals.n_T.value = Receive_n_T;
+              const int Receive_m_Y = ((ncc->locals.m_T.value - m_T_START) + m_Y_START);
+              assert(&nc.locals[3].value == &ncc->locals.m_Y.value);
+              ncc->locals.m_Y.value = Receive_m_Y;
+              const int Receive_n_Y = ((ncc->locals.n_T.value - n_T_START) + n_Y_START);
+              assert(&nc.locals[4].value == &ncc->locals.n_Y.value);
+              ncc->locals.n_Y.value = Receive_n_Y;
+              const int Receive_rank_Y = redistribute_reshuffle_Receive_inline_c_expr2_line_102(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[5].value == &ncc->locals.rank_Y.value);
+              ncc->locals.rank_Y.value = Receive_rank_Y;
+              const int Receive_rank_T = redistribute_reshuffle_Receive_inline_c_expr1_line_103(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[6].value == &ncc->locals.rank_T.value);
+              ncc->locals.rank_T.value = Receive_rank_T;
+#if defined(DISTRIBUTED)
+              rank_dst = rank_of_descT(ncc->locals.m_T.value, ncc->locals.n_T.value);
+              if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+                vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descT)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descT, ncc->locals.m_T.value, ncc->locals.n_T.value);
+              nc.priority = __parsec_tp->super.super.priority;
+              successor_repo = Receive_repo;
+              successor_repo_key = __jdf2c_make_key_Receive((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+            RELEASE_DEP_OUTPUT(es, "ctl", this_task, "ctl", &nc, rank_src, rank_dst, &data);
+            if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_redistribute_reshuffle_Send_for_ctl_dep1_atline_69, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+              }
+            }
+          }
+    }
+  }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static int release_deps_of_redistribute_reshuffle_Send(parsec_execution_stream_t *es, __parsec_redistribute_reshuffle_Send_task_t *this_task, uint32_t action_mask, parsec_remote_deps_t *deps)
+{
+  PARSEC_PINS(es, RELEASE_DEPS_BEGIN, (parsec_task_t *)this_task);  const __parsec_redistribute_reshuffle_internal_taskpool_t *__parsec_tp = (const __parsec_redistribute_reshuffle_internal_taskpool_t *)this_task->taskpool;
+  parsec_release_dep_fct_arg_t arg;
+  int __vp_id;
+  int consume_local_repo = 0;
+  arg.action_mask = action_mask;
+  arg.output_entry = NULL;
+  arg.output_repo = NULL;
+#if defined(DISTRIBUTED)
+  arg.remote_deps = deps;
+#endif  /* defined(DISTRIBUTED) */
+  assert(NULL != es);
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS )    arg.ready_lists = alloca(sizeof(parsec_task_t *) * es->virtual_process->parsec_context->nb_vp);
+  else
+    arg.ready_lists = NULL;
+  for( __vp_id = 0; __vp_id < es->virtual_process->parsec_context->nb_vp; arg.ready_lists[__vp_id++] = NULL );
+  (void)__parsec_tp; (void)deps;
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_Y.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_Y.source_repo, this_task->data._f_Y.source_repo_entry->ht_item.key );
+    }
+    if( NULL != this_task->data._f_R.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_R.source_repo, this_task->data._f_R.source_repo_entry->ht_item.key );
+    }
+  }
+  consume_local_repo = (this_task->repo_entry != NULL);
+  arg.output_repo = Send_repo;
+  arg.output_entry = this_task->repo_entry;
+  arg.output_usage = 0;
+  if( action_mask & (PARSEC_ACTION_RELEASE_LOCAL_DEPS | PARSEC_ACTION_GET_REPO_ENTRY) ) {
+    arg.output_entry = data_repo_lookup_entry_and_create( es, arg.output_repo, __jdf2c_make_key_Send((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    arg.output_entry->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(arg.output_entry->sim_exec_date == 0);
+    arg.output_entry->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  if(action_mask & ( PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE ) ){
+    /* Generate the reshape promise for the outputs that need it */
+    iterate_successors_of_redistribute_reshuffle_Send(es, this_task, action_mask, parsec_set_up_reshape_promise, &arg);
+   }
+  iterate_successors_of_redistribute_reshuffle_Send(es, this_task, action_mask, parsec_release_dep_fct, &arg);
+
+#if defined(DISTRIBUTED)
+  if( (action_mask & PARSEC_ACTION_SEND_REMOTE_DEPS) && (NULL != arg.remote_deps)) {
+    parsec_remote_dep_activate(es, (parsec_task_t *)this_task, arg.remote_deps, arg.remote_deps->outgoing_mask);
+  }
+#endif
+
+  if(action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS) {
+    data_repo_entry_addto_usage_limit(Send_repo, arg.output_entry->ht_item.key, arg.output_usage);
+    __parsec_schedule_vp(es, arg.ready_lists, 0);
+  }
+      if (consume_local_repo) {
+         data_repo_entry_used_once( Send_repo, this_task->repo_entry->ht_item.key );
+      }
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_Y.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_Y.data_in);
+    }
+    if( NULL != this_task->data._f_R.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_R.data_in);
+    }
+  }
+  PARSEC_PINS(es, RELEASE_DEPS_END, (parsec_task_t *)this_task);  return 0;
+}
+
+static int data_lookup_of_redistribute_reshuffle_Send(parsec_execution_stream_t *es, __parsec_redistribute_reshuffle_Send_task_t *this_task)
+{
+  const __parsec_redistribute_reshuffle_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_reshuffle_internal_taskpool_t *)this_task->taskpool;
+  parsec_assignment_t generic_locals[MAX_PARAM_COUNT];  /* generic task locals */
+  int target_device = 0; (void)target_device;
+  (void)__parsec_tp; (void)generic_locals; (void)es;
+  parsec_data_copy_t *chunk = NULL;
+  data_repo_t        *reshape_repo  = NULL, *consumed_repo  = NULL;
+  data_repo_entry_t  *reshape_entry = NULL, *consumed_entry = NULL;
+  parsec_key_t        reshape_entry_key = 0, consumed_entry_key = 0;
+  uint8_t             consumed_flow_index;
+  parsec_dep_data_description_t data;
+  int ret;
+  (void)reshape_repo; (void)reshape_entry; (void)reshape_entry_key;
+  (void)consumed_repo; (void)consumed_entry; (void)consumed_entry_key;
+  (void)consumed_flow_index;
+  (void)chunk; (void)data; (void)ret;
+  const int batch = this_task->locals.batch.value; (void)batch;
+  const int m_Y = this_task->locals.m_Y.value; (void)m_Y;
+  const int n_Y = this_task->locals.n_Y.value; (void)n_Y;
+  const int m_T = this_task->locals.m_T.value; (void)m_T;
+  const int n_T = this_task->locals.n_T.value; (void)n_T;
+  const int rank_Y = this_task->locals.rank_Y.value; (void)rank_Y;
+  const int rank_T = this_task->locals.rank_T.value; (void)rank_T;
+  if( NULL == this_task->repo_entry ){
+    this_task->repo_entry = data_repo_lookup_entry_and_create(es, Send_repo,                                       __jdf2c_make_key_Send((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    data_repo_entry_addto_usage_limit(Send_repo, this_task->repo_entry->ht_item.key, 1);    this_task->repo_entry ->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(this_task->repo_entry ->sim_exec_date == 0);
+    this_task->repo_entry ->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  /* The reshape repo is the current task repo. */  reshape_repo = Send_repo;
+  reshape_entry_key = __jdf2c_make_key_Send((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals) ;
+  reshape_entry = this_task->repo_entry;
+  /* Lookup the input data, and store them in the context if any */
+
+if(! this_task->data._f_Y.fulfill ){ /* Flow Y */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_Y.data_out = NULL;  /* By default, if nothing matches */
+  /* Flow Y [0] dependency [0] from memory descY */
+  if( NULL == (chunk = this_task->data._f_Y.data_in) ) {
+  /* No data set up by predecessor on this task input flow */
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+  parsec_prof_grapher_data_input(data_of_descY(m_Y, n_Y), (parsec_task_t*)this_task, &flow_of_redistribute_reshuffle_Send_for_Y, 1);
+#endif
+    chunk = parsec_data_get_copy(data_of_descY(m_Y, n_Y), target_device);
+    data.data = chunk;
+    data.data_future  = NULL;
+        data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.data_future   = NULL;
+    if( (ret = parsec_get_copy_reshape_from_desc(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    this_task->data._f_Y.data_out = chunk;
+    PARSEC_OBJ_RETAIN(chunk);
+  } 
+    this_task->data._f_Y.data_in     = chunk;
+    this_task->data._f_Y.source_repo       = consumed_repo;
+    this_task->data._f_Y.source_repo_entry = consumed_entry;
+    if( this_task->data._f_Y.source_repo_entry == this_task->repo_entry ){
+      /* in case we have consume from this task repo entry for the flow,
+       * it is cleaned up, avoiding having old stuff during release_deps_of
+       */
+      this_task->repo_entry->data[0] = NULL;
+    }
+    this_task->data._f_Y.fulfill = 1;
+}
+
+
+if(! this_task->data._f_R.fulfill ){ /* Flow R */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_R.data_out = NULL;  /* By default, if nothing matches */
+    if( (rank_Y) != (rank_T) ) {
+    /* Flow R [1] dependency [1] from memory NEW or NULL data */
+    if( NULL == (chunk = this_task->data._f_R.data_in) ) {
+    /* No data set up by predecessor on this task input flow */
+      chunk = parsec_arena_get_copy(PARSEC_redistribute_reshuffle_DEFAULT_ADT->arena, 1, target_device, PARSEC_redistribute_reshuffle_DEFAULT_ADT->opaque_dtt);
+      chunk->original->owner_device = target_device;
+      this_task->data._f_R.data_out = chunk;
+    } 
+    } else {
+    /* Flow R [1] dependency [1] from memory NEW or NULL data */
+    if( NULL == (chunk = this_task->data._f_R.data_in) ) {
+    /* No data set up by predecessor on this task input flow */
+    } 
+    }
+    this_task->data._f_R.data_in     = chunk;
+    this_task->data._f_R.source_repo       = consumed_repo;
+    this_task->data._f_R.source_repo_entry = consumed_entry;
+    if( this_task->data._f_R.source_repo_entry == this_task->repo_entry ){
+      /* in case we have consume from this task repo entry for the flow,
+       * it is cleaned up, avoiding having old stuff during release_deps_of
+       */
+      this_task->repo_entry->data[1] = NULL;
+    }
+    this_task->data._f_R.fulfill = 1;
+}
+
+  /* ctl is a control flow */
+  this_task->data._f_ctl.data_in         = NULL;
+  this_task->data._f_ctl.data_out        = NULL;
+  this_task->data._f_ctl.source_repo       = NULL;
+  this_task->data._f_ctl.source_repo_entry = NULL;
+  /** Generate profiling information */
+#if defined(PARSEC_PROF_TRACE)
+  this_task->prof_info.desc = (parsec_data_collection_t*)__parsec_tp->super._g_descY;
+  this_task->prof_info.priority = this_task->priority;
+  this_task->prof_info.data_id   = ((parsec_data_collection_t*)__parsec_tp->super._g_descY)->data_key((parsec_data_collection_t*)__parsec_tp->super._g_descY, m_Y, n_Y);
+  this_task->prof_info.task_class_id = this_task->task_class->task_class_id;
+  this_task->prof_info.task_return_code = -1;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int datatype_lookup_of_redistribute_reshuffle_Send(parsec_execution_stream_t *es, const parsec_task_t *this_generic_task, const parsec_task_t *parent_task,
+              uint32_t* flow_mask, parsec_dep_data_description_t* data)
+{
+  const __parsec_redistribute_reshuffle_Send_task_t *this_task = (__parsec_redistribute_reshuffle_Send_task_t*)this_generic_task;
+  const __parsec_redistribute_reshuffle_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_reshuffle_internal_taskpool_t *)this_task->taskpool;
+  (void)__parsec_tp; (void)es; (void)this_task; (void)data; (void)parent_task;
+  const int batch = this_task->locals.batch.value; (void)batch;
+  const int m_Y = this_task->locals.m_Y.value; (void)m_Y;
+  const int n_Y = this_task->locals.n_Y.value; (void)n_Y;
+  const int m_T = this_task->locals.m_T.value; (void)m_T;
+  const int n_T = this_task->locals.n_T.value; (void)n_T;
+  const int rank_Y = this_task->locals.rank_Y.value; (void)rank_Y;
+  const int rank_T = this_task->locals.rank_T.value; (void)rank_T;
+  data->local.arena = data->remote.arena = NULL;
+  data->local.src_datatype  = data->local.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->local.src_count     = data->local.dst_count = 0;
+  data->local.src_displ     = data->local.dst_displ = 0;
+  data->data_future  = NULL;
+  if( (*flow_mask) & 0x80000000U ) { /* these are the input dependencies remote datatypes  */
+if( (*flow_mask) & 0x1U ) {  /* Flow Y */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_redistribute_reshuffle_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_redistribute_reshuffle_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_redistribute_reshuffle_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+if( (*flow_mask) & 0x2U ) {  /* Flow R */
+    if( ((*flow_mask) & 0x2U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_redistribute_reshuffle_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_redistribute_reshuffle_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_redistribute_reshuffle_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x2U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x2U) */
+    goto no_mask_match;
+  }
+
+  /* these are the output dependencies remote datatypes */
+if( (*flow_mask) & 0x1U ) {  /* Flow Y */
+    if( ((*flow_mask) & 0x1U)
+ && ((rank_Y) == (rank_T)) ) {
+    data->remote.arena  =  PARSEC_redistribute_reshuffle_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_redistribute_reshuffle_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_redistribute_reshuffle_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+if( (*flow_mask) & 0x2U ) {  /* Flow R */
+    if( ((*flow_mask) & 0x2U)
+ && ((rank_Y) != (rank_T)) ) {
+    data->remote.arena  =  PARSEC_redistribute_reshuffle_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_redistribute_reshuffle_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_redistribute_reshuffle_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x2U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x2U) */
+ no_mask_match:
+  data->data                             = NULL;
+  data->remote.src_datatype = data->remote.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->remote.src_count    = data->remote.dst_count = 0;
+  data->remote.src_displ    = data->remote.dst_displ = 0;
+  data->data_future  = NULL;
+  (*flow_mask) = 0;  /* nothing left */
+  (void)batch;  (void)m_Y;  (void)n_Y;  (void)m_T;  (void)n_T;  (void)rank_Y;  (void)rank_T;
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+static int hook_of_redistribute_reshuffle_Send(parsec_execution_stream_t *es, __parsec_redistribute_reshuffle_Send_task_t *this_task)
+{
+  __parsec_redistribute_reshuffle_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_reshuffle_internal_taskpool_t *)this_task->taskpool;
+  (void)es; (void)__parsec_tp;
+  const int batch = this_task->locals.batch.value; (void)batch;
+  const int m_Y = this_task->locals.m_Y.value; (void)m_Y;
+  const int n_Y = this_task->locals.n_Y.value; (void)n_Y;
+  const int m_T = this_task->locals.m_T.value; (void)m_T;
+  const int n_T = this_task->locals.n_T.value; (void)n_T;
+  const int rank_Y = this_task->locals.rank_Y.value; (void)rank_Y;
+  const int rank_T = this_task->locals.rank_T.value; (void)rank_T;
+  (void)batch;  (void)m_Y;  (void)n_Y;  (void)m_T;  (void)n_T;  (void)rank_Y;  (void)rank_T;
+
+  /** Declare the variables that will hold the data, and all the accounting for each */
+  parsec_data_copy_t *_f_Y = this_task->data._f_Y.data_in;
+  void *Y = PARSEC_DATA_COPY_GET_PTR(_f_Y); (void)Y;
+  parsec_data_copy_t *_f_R = this_task->data._f_R.data_in;
+  void *R = PARSEC_DATA_COPY_GET_PTR(_f_R); (void)R;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    data_repo_entry_t *eY = this_task->data._f_Y.source_repo_entry;
+    if( (NULL != eY) && (eY->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eY->sim_exec_date;
+    data_repo_entry_t *eR = this_task->data._f_R.source_repo_entry;
+    if( (NULL != eR) && (eR->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eR->sim_exec_date;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+    if ( NULL != _f_R ) {
+#if defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) || defined(PARSEC_HAVE_DEV_HIP_SUPPORT)
+      parsec_data_transfer_ownership_to_copy( _f_R->original, 0 /* device */,
+                                           PARSEC_FLOW_ACCESS_RW);
+#endif  /* defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) || defined(PARSEC_HAVE_DEV_HIP_SUPPORT) */
+      _f_R->version++;  /* R */
+#if defined(PARSEC_DEBUG_NOISIER)
+      char tmp[128];
+      PARSEC_DEBUG_VERBOSE(10, parsec_debug_output,
+                           "Body of %s: change Data copy %p to version %d",
+                           parsec_task_snprintf(tmp, 128, (parsec_task_t*)(this_task)),
+                           _f_R, _f_R->version);
+#endif /* defined(PARSEC_DEBUG_NOISIER) */
+    }
+  /** Cache Awareness Accounting */
+#if defined(PARSEC_CACHE_AWARENESS)
+  cache_buf_referenced(es->closest_cache, Y);
+  cache_buf_referenced(es->closest_cache, R);
+#endif /* PARSEC_CACHE_AWARENESS */
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                                  Send BODY                                    -----*/
+
+{
+    if( rank_Y != rank_T ){
+        if( (descT->storage == PARSEC_MATRIX_LAPACK) || (descY->storage == PARSEC_MATRIX_LAPACK)){
+            /* R is TILED */
+            const int R_lda = descT->mb;
+            /* Y is local, rely on storage */
+            const int Y_lda = ( descY->storage == PARSEC_MATRIX_LAPACK )? descY->llm : descY->mb;
+            CORE_redistribute_reshuffle_copy(R, Y, descT->mb, descT->nb, R_lda, Y_lda);
+        }else{
+            memcpy(R, Y, sizeof(DTYPE)*descT->mb*descT->nb);
+        }
+    }
+}
+
+/*-----                                END OF Send BODY                                -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#endif  /*  defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+static int complete_hook_of_redistribute_reshuffle_Send(parsec_execution_stream_t *es, __parsec_redistribute_reshuffle_Send_task_t *this_task)
+{
+  const __parsec_redistribute_reshuffle_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_reshuffle_internal_taskpool_t *)this_task->taskpool;
+#if defined(DISTRIBUTED)
+    const int batch = this_task->locals.batch.value; (void)batch;
+  const int m_Y = this_task->locals.m_Y.value; (void)m_Y;
+  const int n_Y = this_task->locals.n_Y.value; (void)n_Y;
+  const int m_T = this_task->locals.m_T.value; (void)m_T;
+  const int n_T = this_task->locals.n_T.value; (void)n_T;
+  const int rank_Y = this_task->locals.rank_Y.value; (void)rank_Y;
+  const int rank_T = this_task->locals.rank_T.value; (void)rank_T;
+#endif  /* defined(DISTRIBUTED) */
+  (void)es; (void)__parsec_tp;
+parsec_data_t* data_t_desc = NULL; (void)data_t_desc;
+#if defined(DISTRIBUTED)
+  /** If not working on distributed, there is no risk that data is not in place */
+  (void)batch;  (void)m_Y;  (void)n_Y;  (void)m_T;  (void)n_T;  (void)rank_Y;  (void)rank_T;
+
+#endif /* DISTRIBUTED */
+#if defined(PARSEC_PROF_GRAPHER)
+  parsec_prof_grapher_task((parsec_task_t*)this_task, es->th_id, es->virtual_process->vp_id,
+     __jdf2c_key_fns_Send.key_hash(this_task->task_class->make_key( (parsec_taskpool_t*)this_task->taskpool, ((parsec_task_t*)this_task)->locals), NULL));
+#endif  /* defined(PARSEC_PROF_GRAPHER) */
+  release_deps_of_redistribute_reshuffle_Send(es, this_task,
+      PARSEC_ACTION_RELEASE_REMOTE_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_REFS |
+      PARSEC_ACTION_RESHAPE_ON_RELEASE |
+      0x3,  /* mask of all dep_index */ 
+      NULL);
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static parsec_hook_return_t release_task_of_redistribute_reshuffle_Send(parsec_execution_stream_t *es, parsec_task_t *this_task)
+{
+    const __parsec_redistribute_reshuffle_internal_taskpool_t *__parsec_tp =
+        (const __parsec_redistribute_reshuffle_internal_taskpool_t *)this_task->taskpool;
+    parsec_hash_table_t *ht = (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[0];
+    parsec_key_t key = this_task->task_class->make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals);
+    parsec_hashable_dependency_t *hash_dep = (parsec_hashable_dependency_t *)parsec_hash_table_remove(ht, key);
+    parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);
+    return parsec_release_task_to_mempool_update_nbtasks(es, this_task);
+}
+
+static char *redistribute_reshuffle_redistribute_reshuffle_Send_internal_init_deps_key_functions_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_redistribute_reshuffle_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_reshuffle_internal_taskpool_t *)user_data;
+  __parsec_redistribute_reshuffle_Send_parsec_assignment_t __jdf2c__assignments = {  .batch.value = 0, .m_Y.value = 0, .n_Y.value = 0, .m_T.value = 0, .n_T.value = 0, .rank_Y.value = 0, .rank_T.value = 0 };
+  int batch = (__parsec_key) % __parsec_tp->Send_batch_range + __parsec_tp->Send_batch_min;
+  __parsec_key = __parsec_key / __parsec_tp->Send_batch_range;
+  __jdf2c__assignments.batch.value = batch;
+  int m_Y = (__parsec_key) % __parsec_tp->Send_m_Y_range + __parsec_tp->Send_m_Y_min;
+  __parsec_key = __parsec_key / __parsec_tp->Send_m_Y_range;
+  __jdf2c__assignments.m_Y.value = m_Y;
+  int n_Y = (__parsec_key) % __parsec_tp->Send_n_Y_range + __parsec_tp->Send_n_Y_min;
+  __parsec_key = __parsec_key / __parsec_tp->Send_n_Y_range;
+  __jdf2c__assignments.n_Y.value = n_Y;
+  int m_T = ((m_Y - m_Y_START) + m_T_START);
+  (void)m_T;
+  __jdf2c__assignments.m_T.value = m_T;
+  int n_T = ((n_Y - n_Y_START) + n_T_START);
+  (void)n_T;
+  __jdf2c__assignments.n_T.value = n_T;
+  int rank_Y = redistribute_reshuffle_Send_inline_c_expr6_line_58(__parsec_tp, &__jdf2c__assignments);
+  (void)rank_Y;
+  __jdf2c__assignments.rank_Y.value = rank_Y;
+  int rank_T = redistribute_reshuffle_Send_inline_c_expr5_line_59(__parsec_tp, &__jdf2c__assignments);
+  (void)rank_T;
+  __jdf2c__assignments.rank_T.value = rank_T;
+  (void)__jdf2c__assignments;
+  snprintf(buffer, buffer_size, "Send(%d, %d, %d)", batch, m_Y, n_Y);
+  return buffer;
+}
+
+static parsec_key_fn_t redistribute_reshuffle_redistribute_reshuffle_Send_internal_init_deps_key_functions = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = redistribute_reshuffle_redistribute_reshuffle_Send_internal_init_deps_key_functions_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/* Needs: min-max count-tasks iterate */
+static int redistribute_reshuffle_Send_internal_init(parsec_execution_stream_t * es, __parsec_redistribute_reshuffle_Send_task_t * this_task)
+{
+  __parsec_redistribute_reshuffle_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_reshuffle_internal_taskpool_t*)this_task->taskpool;
+  int32_t nb_tasks = 0, saved_nb_tasks = 0;
+int32_t __batch_min = 0x7fffffff, __batch_max = 0;int32_t __jdf2c_batch_min = 0x7fffffff, __jdf2c_batch_max = 0;int32_t __m_Y_min = 0x7fffffff, __m_Y_max = 0;int32_t __jdf2c_m_Y_min = 0x7fffffff, __jdf2c_m_Y_max = 0;int32_t __n_Y_min = 0x7fffffff, __n_Y_max = 0;int32_t __jdf2c_n_Y_min = 0x7fffffff, __jdf2c_n_Y_max = 0;  __parsec_redistribute_reshuffle_Send_parsec_assignment_t assignments = {  .batch.value = 0, .m_Y.value = 0, .n_Y.value = 0, .m_T.value = 0, .n_T.value = 0, .rank_Y.value = 0, .rank_T.value = 0 };
+  int32_t  batch,  m_Y,  n_Y,  m_T,  n_T,  rank_Y,  rank_T;
+  int32_t __jdf2c_batch_start, __jdf2c_batch_end, __jdf2c_batch_inc;
+  int32_t __jdf2c_m_Y_start, __jdf2c_m_Y_end, __jdf2c_m_Y_inc;
+  int32_t __jdf2c_n_Y_start, __jdf2c_n_Y_end, __jdf2c_n_Y_inc;
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+  PARSEC_PROFILING_TRACE(es->es_profile,
+                         this_task->taskpool->profiling_array[START_KEY(this_task->task_class->task_class_id)],
+                         0,
+                         this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    __jdf2c_batch_start = 0;
+    __jdf2c_batch_end = NT;
+    __jdf2c_batch_inc = 1;
+    __batch_min = parsec_imin(__jdf2c_batch_start, __jdf2c_batch_end);
+    __batch_max = parsec_imax(__jdf2c_batch_start, __jdf2c_batch_end);
+    __jdf2c_batch_min = parsec_imin(__jdf2c_batch_min, __batch_min);
+    __jdf2c_batch_max = parsec_imax(__jdf2c_batch_max, __batch_max);
+    for(batch =  __jdf2c_batch_start;
+        batch <= __jdf2c_batch_end;
+        batch += __jdf2c_batch_inc) {
+    assignments.batch.value = batch;
+      __jdf2c_m_Y_start = m_Y_START;
+      __jdf2c_m_Y_end = m_Y_END;
+      __jdf2c_m_Y_inc = 1;
+      __m_Y_min = parsec_imin(__jdf2c_m_Y_start, __jdf2c_m_Y_end);
+      __m_Y_max = parsec_imax(__jdf2c_m_Y_start, __jdf2c_m_Y_end);
+      __jdf2c_m_Y_min = parsec_imin(__jdf2c_m_Y_min, __m_Y_min);
+      __jdf2c_m_Y_max = parsec_imax(__jdf2c_m_Y_max, __m_Y_max);
+      for(m_Y =  __jdf2c_m_Y_start;
+          m_Y <= __jdf2c_m_Y_end;
+          m_Y += __jdf2c_m_Y_inc) {
+      assignments.m_Y.value = m_Y;
+        __jdf2c_n_Y_start = redistribute_reshuffle_Send_inline_c_expr8_line_53(__parsec_tp, &assignments);
+        __jdf2c_n_Y_end = redistribute_reshuffle_Send_inline_c_expr7_line_53(__parsec_tp, &assignments);
+        __jdf2c_n_Y_inc = 1;
+        __n_Y_min = parsec_imin(__jdf2c_n_Y_start, __jdf2c_n_Y_end);
+        __n_Y_max = parsec_imax(__jdf2c_n_Y_start, __jdf2c_n_Y_end);
+        __jdf2c_n_Y_min = parsec_imin(__jdf2c_n_Y_min, __n_Y_min);
+        __jdf2c_n_Y_max = parsec_imax(__jdf2c_n_Y_max, __n_Y_max);
+        for(n_Y =  __jdf2c_n_Y_start;
+            n_Y <= __jdf2c_n_Y_end;
+            n_Y += __jdf2c_n_Y_inc) {
+        assignments.n_Y.value = n_Y;
+      {  /* block for the non-range variable m_T */
+          m_T = ((m_Y - m_Y_START) + m_T_START);
+          assignments.m_T.value = m_T;
+        {  /* block for the non-range variable n_T */
+            n_T = ((n_Y - n_Y_START) + n_T_START);
+            assignments.n_T.value = n_T;
+          {  /* block for the non-range variable rank_Y */
+              rank_Y = redistribute_reshuffle_Send_inline_c_expr6_line_58(__parsec_tp, &assignments);
+              assignments.rank_Y.value = rank_Y;
+            {  /* block for the non-range variable rank_T */
+                rank_T = redistribute_reshuffle_Send_inline_c_expr5_line_59(__parsec_tp, &assignments);
+                assignments.rank_T.value = rank_T;
+                if( !Send_pred(batch, m_Y, n_Y, m_T, n_T, rank_Y, rank_T) ) continue;
+                nb_tasks++;
+              } /* block for the non-range variable rank_T */ 
+            } /* block for the non-range variable rank_Y */ 
+          } /* block for the non-range variable n_T */ 
+        } /* block for the non-range variable m_T */ 
+      } /* Loop on normal range n_Y */
+    } /* For loop of m_Y */ 
+  } /* For loop of batch */ 
+   if( 0 != nb_tasks ) {
+     (void)parsec_atomic_fetch_add_int32(&__parsec_tp->initial_number_tasks, nb_tasks);
+   }
+  /* Set the range variables for the collision-free hash-computation */
+  __parsec_tp->Send_batch_min   = __jdf2c_batch_min;
+  __parsec_tp->Send_batch_range = (__jdf2c_batch_max - __jdf2c_batch_min) + 1;
+  __parsec_tp->Send_m_Y_min   = __jdf2c_m_Y_min;
+  __parsec_tp->Send_m_Y_range = (__jdf2c_m_Y_max - __jdf2c_m_Y_min) + 1;
+  __parsec_tp->Send_n_Y_min   = __jdf2c_n_Y_min;
+  __parsec_tp->Send_n_Y_range = (__jdf2c_n_Y_max - __jdf2c_n_Y_min) + 1;
+    do {
+      this_task->super.list_next = (parsec_list_item_t*)__parsec_tp->startup_queue;
+    } while(!parsec_atomic_cas_ptr(&__parsec_tp->startup_queue, (parsec_list_item_t*)this_task->super.list_next, this_task));
+    this_task->status = PARSEC_TASK_STATUS_HOOK;
+
+  PARSEC_AYU_REGISTER_TASK(&redistribute_reshuffle_Send);
+  __parsec_tp->super.super.dependencies_array[0] = PARSEC_OBJ_NEW(parsec_hash_table_t);
+  parsec_hash_table_init(__parsec_tp->super.super.dependencies_array[0], offsetof(parsec_hashable_dependency_t, ht_item), 10, redistribute_reshuffle_redistribute_reshuffle_Send_internal_init_deps_key_functions, this_task->taskpool);
+  __parsec_tp->repositories[0] = data_repo_create_nothreadsafe(nb_tasks, __jdf2c_key_fns_Send, (parsec_taskpool_t*)__parsec_tp, 3);
+(void)saved_nb_tasks;
+(void)__batch_min; (void)__batch_max;(void)__m_Y_min; (void)__m_Y_max;(void)__n_Y_min; (void)__n_Y_max;  (void)__jdf2c_batch_start; (void)__jdf2c_batch_end; (void)__jdf2c_batch_inc;  (void)__jdf2c_m_Y_start; (void)__jdf2c_m_Y_end; (void)__jdf2c_m_Y_inc;  (void)__jdf2c_n_Y_start; (void)__jdf2c_n_Y_end; (void)__jdf2c_n_Y_inc;  (void)assignments; (void)__parsec_tp; (void)es;
+  if(1 == parsec_atomic_fetch_dec_int32(&__parsec_tp->sync_point)) {
+    /* Last initialization task complete. Update the number of tasks. */
+    __parsec_tp->super.super.tdm.module->taskpool_addto_nb_tasks(&__parsec_tp->super.super, __parsec_tp->initial_number_tasks);
+    parsec_mfence();  /* write memory barrier to guarantee that the scheduler gets the correct number of tasks */
+    parsec_taskpool_enable((parsec_taskpool_t*)__parsec_tp, &__parsec_tp->startup_queue,
+                           (parsec_task_t*)this_task, es, __parsec_tp->super.super.nb_pending_actions);
+    __parsec_tp->super.super.tdm.module->taskpool_ready(&__parsec_tp->super.super);
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+    PARSEC_PROFILING_TRACE(es->es_profile,
+                           this_task->taskpool->profiling_array[2 * this_task->task_class->task_class_id + 1],
+                           0,
+                           this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    if( 1 >= __parsec_tp->super.super.nb_pending_actions ) {
+        /* if no tasks will be generated let's prevent the runtime from calling the hook and instead go directly to complete the task */
+        this_task->status = PARSEC_TASK_STATUS_COMPLETE;
+    }
+    return PARSEC_HOOK_RETURN_DONE;
+  }
+  return PARSEC_HOOK_RETURN_ASYNC;
+}
+
+static int __jdf2c_startup_Send(parsec_execution_stream_t * es, __parsec_redistribute_reshuffle_Send_task_t *this_task)
+{
+  __parsec_redistribute_reshuffle_Send_task_t* new_task;
+  __parsec_redistribute_reshuffle_internal_taskpool_t* __parsec_tp = (__parsec_redistribute_reshuffle_internal_taskpool_t*)this_task->taskpool;
+  parsec_context_t *context = __parsec_tp->super.super.context;
+  int vpid = 0, nb_tasks = 0;
+  size_t total_nb_tasks = 0;
+  parsec_list_item_t* pready_ring[context->nb_vp];
+  int restore_context = 0;
+  int batch = this_task->locals.batch.value;  /* retrieve value saved during the last iteration */
+  int m_Y = this_task->locals.m_Y.value;  /* retrieve value saved during the last iteration */
+  int n_Y = this_task->locals.n_Y.value;  /* retrieve value saved during the last iteration */
+  int m_T = this_task->locals.m_T.value;  /* retrieve value saved during the last iteration */
+  int n_T = this_task->locals.n_T.value;  /* retrieve value saved during the last iteration */
+  int rank_Y = this_task->locals.rank_Y.value;  /* retrieve value saved during the last iteration */
+  int rank_T = this_task->locals.rank_T.value;  /* retrieve value saved during the last iteration */
+  for(int _i = 0; _i < context->nb_vp; pready_ring[_i++] = NULL );
+  if( 0 != this_task->locals.reserved[0].value ) {
+    this_task->locals.reserved[0].value = 1; /* reset the submission process */
+    restore_context = 1;
+    goto restore_context_0;
+  }
+  this_task->locals.reserved[0].value = 1; /* a sane default value */
+  for(this_task->locals.batch.value = batch = 0;
+      this_task->locals.batch.value <= NT;
+      this_task->locals.batch.value += 1, batch = this_task->locals.batch.value) {
+    for(this_task->locals.m_Y.value = m_Y = m_Y_START;
+        this_task->locals.m_Y.value <= m_Y_END;
+        this_task->locals.m_Y.value += 1, m_Y = this_task->locals.m_Y.value) {
+      for(this_task->locals.n_Y.value = n_Y = redistribute_reshuffle_Send_inline_c_expr8_line_53(__parsec_tp, &this_task->locals);
+          this_task->locals.n_Y.value <= redistribute_reshuffle_Send_inline_c_expr7_line_53(__parsec_tp, &this_task->locals);
+          this_task->locals.n_Y.value += 1, n_Y = this_task->locals.n_Y.value) {
+        this_task->locals.m_T.value = m_T = ((m_Y - m_Y_START) + m_T_START);
+        this_task->locals.n_T.value = n_T = ((n_Y - n_Y_START) + n_T_START);
+        this_task->locals.rank_Y.value = rank_Y = redistribute_reshuffle_Send_inline_c_expr6_line_58(__parsec_tp, &this_task->locals);
+        this_task->locals.rank_T.value = rank_T = redistribute_reshuffle_Send_inline_c_expr5_line_59(__parsec_tp, &this_task->locals);
+        if( !Send_pred(batch, m_Y, n_Y, m_T, n_T, rank_Y, rank_T) ) continue;
+  __parsec_redistribute_reshuffle_Send_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_redistribute_reshuffle_Send_parsec_assignment_t*)&this_task->locals;
+  (void)__jdf2c__tmp_locals;
+  /* Flow for Y is always a memory reference */
+  /* Flow for R is always a memory reference */
+  if( (batch) > (0) ) continue; /* ctl Receive() is not a memory reference for flow ctl */
+        if( NULL != ((parsec_data_collection_t*)__parsec_tp->super._g_descY)->vpid_of ) {
+          vpid = ((parsec_data_collection_t*)__parsec_tp->super._g_descY)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descY, m_Y, n_Y);
+          assert(context->nb_vp >= vpid);
+        } else {
+          vpid = (vpid + 1) % context->nb_vp;  /* spread the initial joy */
+        }
+        new_task = (__parsec_redistribute_reshuffle_Send_task_t*)parsec_thread_mempool_allocate( context->virtual_processes[vpid]->execution_streams[0]->context_mempool );
+        PARSEC_OBJ_CONSTRUCT(new_task, parsec_task_t); /* construct called only when new, force-construct it again */
+        /* Copy only the valid elements from this_task to new_task one */
+        new_task->taskpool   = this_task->taskpool;
+        new_task->task_class = __parsec_tp->super.super.task_classes_array[redistribute_reshuffle_Send.task_class_id];
+        new_task->chore_mask   = PARSEC_DEV_ALL;
+        new_task->locals.batch.value = this_task->locals.batch.value;
+        new_task->locals.m_Y.value = this_task->locals.m_Y.value;
+        new_task->locals.n_Y.value = this_task->locals.n_Y.value;
+        new_task->locals.m_T.value = this_task->locals.m_T.value;
+        new_task->locals.n_T.value = this_task->locals.n_T.value;
+        new_task->locals.rank_Y.value = this_task->locals.rank_Y.value;
+        new_task->locals.rank_T.value = this_task->locals.rank_T.value;
+        PARSEC_LIST_ITEM_SINGLETON(new_task);
+        new_task->priority = __parsec_tp->super.super.priority;
+        new_task->repo_entry = NULL;
+        new_task->data._f_Y.source_repo_entry = NULL;
+        new_task->data._f_Y.source_repo       = NULL;
+        new_task->data._f_Y.data_in         = NULL;
+        new_task->data._f_Y.data_out        = NULL;
+        new_task->data._f_Y.fulfill         = 0;
+        new_task->data._f_R.source_repo_entry = NULL;
+        new_task->data._f_R.source_repo       = NULL;
+        new_task->data._f_R.data_in         = NULL;
+        new_task->data._f_R.data_out        = NULL;
+        new_task->data._f_R.fulfill         = 0;
+        new_task->data._f_ctl.source_repo_entry = NULL;
+        new_task->data._f_ctl.source_repo       = NULL;
+        new_task->data._f_ctl.data_in         = NULL;
+        new_task->data._f_ctl.data_out        = NULL;
+        new_task->data._f_ctl.fulfill         = 0;
+#if defined(PARSEC_DEBUG_NOISIER)
+        {
+          char tmp[128];
+          PARSEC_DEBUG_VERBOSE(10, parsec_debug_output, "Add startup task %s to vpid %d",
+                 parsec_task_snprintf(tmp, 128, (parsec_task_t*)new_task), vpid);
+        }
+#endif
+        parsec_dependencies_mark_task_as_startup((parsec_task_t*)new_task, es);
+        pready_ring[vpid] = parsec_list_item_ring_push_sorted(pready_ring[vpid],
+                                                              (parsec_list_item_t*)new_task,
+                                                              parsec_execution_context_priority_comparator);
+        nb_tasks++;
+       restore_context_0:  /* we jump here just so that we have code after the label */
+        restore_context = 0;
+        (void)restore_context;
+        if( nb_tasks > this_task->locals.reserved[0].value ) {
+          if( (size_t)this_task->locals.reserved[0].value < parsec_task_startup_iter ) this_task->locals.reserved[0].value <<= 1;
+          __parsec_schedule_vp(es, (parsec_task_t**)pready_ring, 0);
+          total_nb_tasks += nb_tasks;
+          nb_tasks = 0;
+          if( total_nb_tasks > parsec_task_startup_chunk ) {  /* stop here and request to be rescheduled */
+            return PARSEC_HOOK_RETURN_AGAIN;
+          }
+        }
+      } /* Loop on normal range n_Y */
+    } /* Loop on normal range m_Y */
+  } /* Loop on normal range batch */
+  (void)vpid;
+  if( 0 != nb_tasks ) {
+    __parsec_schedule_vp(es, (parsec_task_t**)pready_ring, 0);
+    nb_tasks = 0;
+  }
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static const __parsec_chore_t __redistribute_reshuffle_Send_chores[] ={
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+    { .type     = PARSEC_DEV_CPU,
+      .evaluate = (parsec_evaluate_function_t*)NULL,
+      .hook     = (parsec_hook_t*)hook_of_redistribute_reshuffle_Send },
+#endif  /* defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+    { .type     = PARSEC_DEV_NONE,
+      .evaluate = NULL,
+      .hook     = (parsec_hook_t*)NULL },  /* End marker */
+};
+
+static const parsec_task_class_t redistribute_reshuffle_Send = {
+  .name = "Send",
+  .task_class_id = 0,
+  .nb_flows = 3,
+  .nb_parameters = 3,
+  .nb_locals = 7,
+  .task_class_type = PARSEC_TASK_CLASS_TYPE_PTG,
+  .params = { &symb_redistribute_reshuffle_Send_m_Y, &symb_redistribute_reshuffle_Send_n_Y, &symb_redistribute_reshuffle_Send_batch, NULL },
+  .locals = { &symb_redistribute_reshuffle_Send_batch, &symb_redistribute_reshuffle_Send_m_Y, &symb_redistribute_reshuffle_Send_n_Y, &symb_redistribute_reshuffle_Send_m_T, &symb_redistribute_reshuffle_Send_n_T, &symb_redistribute_reshuffle_Send_rank_Y, &symb_redistribute_reshuffle_Send_rank_T, NULL },
+  .data_affinity = (parsec_data_ref_fn_t*)affinity_of_redistribute_reshuffle_Send,
+  .initial_data = (parsec_data_ref_fn_t*)affinity_of_redistribute_reshuffle_Send,
+  .final_data = (parsec_data_ref_fn_t*)affinity_of_redistribute_reshuffle_Send,
+  .priority = NULL,
+  .properties = properties_of_redistribute_reshuffle_Send,
+#if MAX_PARAM_COUNT < 2  /* number of read flows of Send */
+  #error Too many read flows for task Send
+#endif  /* MAX_PARAM_COUNT */
+#if MAX_PARAM_COUNT < 1  /* number of write flows of Send */
+  #error Too many write flows for task Send
+#endif  /* MAX_PARAM_COUNT */
+  .in = { &flow_of_redistribute_reshuffle_Send_for_Y, &flow_of_redistribute_reshuffle_Send_for_R, &flow_of_redistribute_reshuffle_Send_for_ctl, NULL },
+  .out = { &flow_of_redistribute_reshuffle_Send_for_Y, &flow_of_redistribute_reshuffle_Send_for_R, NULL },
+  .flags = 0x0 | PARSEC_HAS_IN_IN_DEPENDENCIES | PARSEC_USE_DEPS_MASK,
+  .dependencies_goal = 0x7,
+  .make_key = __jdf2c_make_key_Send,
+  .task_snprintf = parsec_task_snprintf,
+#if defined(PARSEC_PROF_TRACE)
+  .profile_info = &parsec_task_profile_info,
+#endif
+  .key_functions = &__jdf2c_key_fns_Send,
+  .fini = (parsec_hook_t*)NULL,
+  .incarnations = __redistribute_reshuffle_Send_chores,
+  .find_deps = parsec_hash_find_deps,
+  .update_deps = parsec_update_deps_with_mask,
+  .iterate_successors = (parsec_traverse_function_t*)iterate_successors_of_redistribute_reshuffle_Send,
+  .iterate_predecessors = (parsec_traverse_function_t*)iterate_predecessors_of_redistribute_reshuffle_Send,
+  .release_deps = (parsec_release_deps_t*)release_deps_of_redistribute_reshuffle_Send,
+  .prepare_output = (parsec_hook_t*)NULL,
+  .prepare_input = (parsec_hook_t*)data_lookup_of_redistribute_reshuffle_Send,
+  .time_estimate = NULL,
+  .get_datatype = datatype_lookup_of_redistribute_reshuffle_Send,
+  .complete_execution = (parsec_hook_t*)complete_hook_of_redistribute_reshuffle_Send,
+  .release_task = &release_task_of_redistribute_reshuffle_Send,
+#if defined(PARSEC_SIM)
+  .sim_cost_fct = (parsec_sim_cost_fct_t*)NULL,
+#endif
+};
+
+
+static const parsec_task_class_t *redistribute_reshuffle_task_classes[] = {
+  &redistribute_reshuffle_Send,
+  &redistribute_reshuffle_Receive
+};
+
+static void redistribute_reshuffle_startup(parsec_context_t *context, __parsec_redistribute_reshuffle_internal_taskpool_t *__parsec_tp, parsec_list_item_t ** ready_tasks)
+{
+  uint32_t i, supported_dev = 0;
+ 
+  for( i = 0; i < parsec_nb_devices; i++ ) {
+    if( !(__parsec_tp->super.super.devices_index_mask & (1<<i)) ) continue;
+    parsec_device_module_t* device = parsec_mca_device_get(i);
+    parsec_data_collection_t* parsec_dc;
+ 
+    if(NULL == device) continue;
+    if(NULL != device->taskpool_register)
+      if( PARSEC_SUCCESS != device->taskpool_register(device, (parsec_taskpool_t*)__parsec_tp) ) {
+        parsec_debug_verbose(5, parsec_debug_output, "Device %s refused to register taskpool %p", device->name, __parsec_tp);
+        __parsec_tp->super.super.devices_index_mask &= ~(1 << device->device_index);
+        continue;
+      }
+    if(NULL != device->memory_register) {  /* Register all the data */
+      parsec_dc = (parsec_data_collection_t*)__parsec_tp->super._g_descY;
+      if( (NULL != parsec_dc->register_memory) &&
+          (PARSEC_SUCCESS != parsec_dc->register_memory(parsec_dc, device)) ) {
+        parsec_debug_verbose(3, parsec_debug_output, "Device %s refused to register memory for data %s (%p) from taskpool %p",
+                     device->name, parsec_dc->key_base, parsec_dc, __parsec_tp);
+        __parsec_tp->super.super.devices_index_mask &= ~(1 << device->device_index);
+      }
+      parsec_dc = (parsec_data_collection_t*)__parsec_tp->super._g_descT;
+      if( (NULL != parsec_dc->register_memory) &&
+          (PARSEC_SUCCESS != parsec_dc->register_memory(parsec_dc, device)) ) {
+        parsec_debug_verbose(3, parsec_debug_output, "Device %s refused to register memory for data %s (%p) from taskpool %p",
+                     device->name, parsec_dc->key_base, parsec_dc, __parsec_tp);
+        __parsec_tp->super.super.devices_index_mask &= ~(1 << device->device_index);
+      }
+    }
+    supported_dev |= device->type;
+  }
+  /* Remove all the chores without a backend device */
+  for( i = 0; i < PARSEC_redistribute_reshuffle_NB_TASK_CLASSES; i++ ) {
+    parsec_task_class_t* tc = (parsec_task_class_t*)__parsec_tp->super.super.task_classes_array[i];
+    __parsec_chore_t* chores = (__parsec_chore_t*)tc->incarnations;
+    uint32_t idx = 0, j;
+    for( j = 0; PARSEC_DEV_NONE != chores[j].type; j++ ) {
+      if( !(supported_dev & chores[j].type) ) continue;
+      if( j != idx ) {
+        chores[idx] = chores[j];
+        parsec_debug_verbose(20, parsec_debug_output, "Device type %i disabled for function %s"
+, chores[j].type, tc->name);
+      }
+      idx++;
+    }
+    chores[idx].type     = PARSEC_DEV_NONE;
+    chores[idx].evaluate = NULL;
+    chores[idx].hook     = NULL;
+    /* Create the initialization tasks for each taskclass */
+    parsec_task_t* task = (parsec_task_t*)parsec_thread_mempool_allocate(context->virtual_processes[0]->execution_streams[0]->context_mempool);
+    PARSEC_OBJ_CONSTRUCT(task, parsec_task_t); /* construct called only when new, force-construct it again */
+    task->taskpool = (parsec_taskpool_t *)__parsec_tp;
+    task->chore_mask = PARSEC_DEV_CPU;
+    memset(&task->locals, 0, sizeof(parsec_assignment_t) * MAX_LOCAL_COUNT);
+    PARSEC_LIST_ITEM_SINGLETON(task);
+    task->priority = -1;
+    task->task_class = task->taskpool->task_classes_array[PARSEC_redistribute_reshuffle_NB_TASK_CLASSES + i];
+    int where = i % context->nb_vp;
+    if( NULL == ready_tasks[where] ) ready_tasks[where] = &task->super;
+    else ready_tasks[where] = parsec_list_item_ring_push(ready_tasks[where], &task->super);
+  }
+}
+static void __parsec_redistribute_reshuffle_internal_destructor( __parsec_redistribute_reshuffle_internal_taskpool_t *__parsec_tp )
+{
+  uint32_t i;
+  parsec_taskpool_unregister( &__parsec_tp->super.super );
+  if(NULL != __parsec_tp->super.super.tdm.module) __parsec_tp->super.super.tdm.module->unmonitor_taskpool(&__parsec_tp->super.super);
+  for( i = 0; i < (uint32_t)(2 * __parsec_tp->super.super.nb_task_classes); i++ ) {  /* Extra startup function added at the end */
+    parsec_task_class_t* tc = (parsec_task_class_t*)__parsec_tp->super.super.task_classes_array[i];
+    free((void*)tc->incarnations);
+    free(tc);
+  }
+  free(__parsec_tp->super.super.task_classes_array); __parsec_tp->super.super.task_classes_array = NULL;
+  __parsec_tp->super.super.nb_task_classes = 0;
+
+  for(i = 0; i < (uint32_t)__parsec_tp->super.arenas_datatypes_size; i++) {
+    if( NULL != __parsec_tp->super.arenas_datatypes[i].arena ) {
+      PARSEC_OBJ_RELEASE(__parsec_tp->super.arenas_datatypes[i].arena);
+    }
+  }
+  /* Destroy the data repositories for this object */
+   data_repo_destroy_nothreadsafe(__parsec_tp->repositories[1]);  /* Receive */
+   data_repo_destroy_nothreadsafe(__parsec_tp->repositories[0]);  /* Send */
+  /* Release the dependencies arrays for this object */
+  parsec_hash_table_fini( (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[1] );
+  PARSEC_OBJ_RELEASE(__parsec_tp->super.super.dependencies_array[1]);
+  __parsec_tp->super.super.dependencies_array[1] = NULL;
+  parsec_hash_table_fini( (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[0] );
+  PARSEC_OBJ_RELEASE(__parsec_tp->super.super.dependencies_array[0]);
+  __parsec_tp->super.super.dependencies_array[0] = NULL;
+  free( __parsec_tp->super.super.dependencies_array );
+  __parsec_tp->super.super.dependencies_array = NULL;
+  /* Unregister all the data */
+  uint32_t _i;
+  for( _i = 0; _i < parsec_nb_devices; _i++ ) {
+    parsec_device_module_t* device;
+    parsec_data_collection_t* parsec_dc;
+    if(!(__parsec_tp->super.super.devices_index_mask & (1 << _i))) continue;
+    if((NULL == (device = parsec_mca_device_get(_i))) || (NULL == device->memory_unregister)) continue;
+    parsec_dc = (parsec_data_collection_t*)__parsec_tp->super._g_descY;
+  if( NULL != parsec_dc->unregister_memory ) { (void)parsec_dc->unregister_memory(parsec_dc, device); };
+  parsec_dc = (parsec_data_collection_t*)__parsec_tp->super._g_descT;
+  if( NULL != parsec_dc->unregister_memory ) { (void)parsec_dc->unregister_memory(parsec_dc, device); };
+}
+  /* Unregister the taskpool from the devices */
+  for( i = 0; i < parsec_nb_devices; i++ ) {
+    if(!(__parsec_tp->super.super.devices_index_mask & (1 << i))) continue;
+    __parsec_tp->super.super.devices_index_mask ^= (1 << i);
+    parsec_device_module_t* device = parsec_mca_device_get(i);
+    if((NULL == device) || (NULL == device->taskpool_unregister)) continue;
+    if( PARSEC_SUCCESS != device->taskpool_unregister(device, &__parsec_tp->super.super) ) continue;
+  }
+  free(__parsec_tp->super.super.taskpool_name); __parsec_tp->super.super.taskpool_name = NULL;
+}
+
+void __parsec_redistribute_reshuffle_internal_constructor(__parsec_redistribute_reshuffle_internal_taskpool_t* __parsec_tp)
+{
+  parsec_task_class_t* tc;
+  uint32_t i, j;
+
+  __parsec_tp->super.super.nb_task_classes = PARSEC_redistribute_reshuffle_NB_TASK_CLASSES;
+  __parsec_tp->super.super.devices_index_mask = PARSEC_DEVICES_ALL;
+  __parsec_tp->super.super.taskpool_name = strdup("redistribute_reshuffle");
+  parsec_termdet_open_module(&__parsec_tp->super.super, "local");
+  __parsec_tp->super.super.tdm.module->monitor_taskpool(&__parsec_tp->super.super,
+                                                        parsec_taskpool_termination_detected);
+  __parsec_tp->super.super.update_nb_runtime_task = parsec_add_fetch_runtime_task;
+  __parsec_tp->super.super.dependencies_array = (void **)
+              calloc(__parsec_tp->super.super.nb_task_classes, sizeof(void*));
+  /* Twice the size to hold the startup tasks function_t */
+  __parsec_tp->super.super.task_classes_array = (const parsec_task_class_t**)
+              calloc((2 * PARSEC_redistribute_reshuffle_NB_TASK_CLASSES + 1), sizeof(parsec_task_class_t*));
+  __parsec_tp->super.super.tdm.module->taskpool_addto_runtime_actions(&__parsec_tp->super.super, PARSEC_redistribute_reshuffle_NB_TASK_CLASSES);  /* for the startup tasks */
+  __parsec_tp->super.super.taskpool_type = PARSEC_TASKPOOL_TYPE_PTG;
+  __parsec_tp->sync_point = __parsec_tp->super.super.nb_task_classes;
+  __parsec_tp->initial_number_tasks = 0;
+  __parsec_tp->startup_queue = NULL;
+  for( i = 0; i < __parsec_tp->super.super.nb_task_classes; i++ ) {
+    __parsec_tp->super.super.task_classes_array[i] = tc = malloc(sizeof(parsec_task_class_t));
+    memcpy(tc, redistribute_reshuffle_task_classes[i], sizeof(parsec_task_class_t));
+    for( j = 0; PARSEC_DEV_NONE != tc->incarnations[j].type; j++);  /* compute the number of incarnations */
+    tc->incarnations = (__parsec_chore_t*)malloc((j+1) * sizeof(__parsec_chore_t));
+        memcpy((__parsec_chore_t*)tc->incarnations, redistribute_reshuffle_task_classes[i]->incarnations, (j+1) * sizeof(__parsec_chore_t));
+
+    /* Add a placeholder for initialization and startup task */
+    __parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+i] = tc = (parsec_task_class_t*)malloc(sizeof(parsec_task_class_t));
+    memcpy(tc, (void*)&__parsec_generic_startup, sizeof(parsec_task_class_t));
+    tc->task_class_id = __parsec_tp->super.super.nb_task_classes + i;
+    tc->incarnations = (__parsec_chore_t*)malloc(2 * sizeof(__parsec_chore_t));
+    memcpy((__parsec_chore_t*)tc->incarnations, (void*)__parsec_generic_startup.incarnations, 2 * sizeof(__parsec_chore_t));
+    tc->release_task = parsec_release_task_to_mempool_and_count_as_runtime_tasks;
+  }
+  /* Startup task for Receive */
+  tc = (parsec_task_class_t *)__parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+0];
+  tc->name = "Startup for Receive";
+  tc->prepare_input = (parsec_hook_t*)redistribute_reshuffle_Receive_internal_init;
+  /* Startup task for Send */
+  tc = (parsec_task_class_t *)__parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+1];
+  tc->name = "Startup for Send";
+  tc->prepare_input = (parsec_hook_t*)redistribute_reshuffle_Send_internal_init;
+  ((__parsec_chore_t*)&tc->incarnations[0])->hook = (parsec_hook_t *)__jdf2c_startup_Send;
+  /* Compute the number of arenas_datatypes: */
+  /*   PARSEC_redistribute_reshuffle_DEFAULT_ARENA  ->  0 */
+  __parsec_tp->super.arenas_datatypes_size = 1;
+  memset(&__parsec_tp->super.arenas_datatypes[0], 0, __parsec_tp->super.arenas_datatypes_size*sizeof(parsec_arena_datatype_t));
+  /* If profiling is enabled, the keys for profiling */
+#  if defined(PARSEC_PROF_TRACE)
+  __parsec_tp->super.super.profiling_array = redistribute_reshuffle_profiling_array;
+  if( -2 == redistribute_reshuffle_profiling_array[0] ) {
+    #if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+parsec_profiling_add_dictionary_keyword("redistribute_reshuffle::Receive::internal init", "fill:34D8D8",
+                                       0,
+                                       NULL,
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(redistribute_reshuffle_Receive.task_class_id  + PARSEC_redistribute_reshuffle_NB_TASK_CLASSES)/* Receive (internal init) start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(redistribute_reshuffle_Receive.task_class_id  + PARSEC_redistribute_reshuffle_NB_TASK_CLASSES)/* Receive (internal init) end key */]);
+#endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+parsec_profiling_add_dictionary_keyword("redistribute_reshuffle::Receive", "fill:CC2828",
+                                       sizeof(parsec_task_prof_info_t)+7*sizeof(parsec_assignment_t),
+                                       "dc_key{uint64_t};priority{int32_t};dc_dataid{uint32_t};tcid{uint32_t};trc{int32_t};batch{int32_t};m_T{int32_t};n_T{int32_t};m_Y{int32_t};n_Y{int32_t};rank_Y{int32_t};rank_T{int32_t}",
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(redistribute_reshuffle_Receive.task_class_id) /* Receive start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(redistribute_reshuffle_Receive.task_class_id) /* Receive end key */]);
+
+    #if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+parsec_profiling_add_dictionary_keyword("redistribute_reshuffle::Send::internal init", "fill:D83434",
+                                       0,
+                                       NULL,
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(redistribute_reshuffle_Send.task_class_id  + PARSEC_redistribute_reshuffle_NB_TASK_CLASSES)/* Send (internal init) start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(redistribute_reshuffle_Send.task_class_id  + PARSEC_redistribute_reshuffle_NB_TASK_CLASSES)/* Send (internal init) end key */]);
+#endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+parsec_profiling_add_dictionary_keyword("redistribute_reshuffle::Send", "fill:28CCCC",
+                                       sizeof(parsec_task_prof_info_t)+7*sizeof(parsec_assignment_t),
+                                       "dc_key{uint64_t};priority{int32_t};dc_dataid{uint32_t};tcid{uint32_t};trc{int32_t};batch{int32_t};m_Y{int32_t};n_Y{int32_t};m_T{int32_t};n_T{int32_t};rank_Y{int32_t};rank_T{int32_t}",
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(redistribute_reshuffle_Send.task_class_id) /* Send start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(redistribute_reshuffle_Send.task_class_id) /* Send end key */]);
+
+  }
+#  endif /* defined(PARSEC_PROF_TRACE) */
+  __parsec_tp->super.super.repo_array = __parsec_tp->repositories;
+  __parsec_tp->super.super.startup_hook = (parsec_startup_fn_t)redistribute_reshuffle_startup;
+  (void)parsec_taskpool_reserve_id((parsec_taskpool_t*)__parsec_tp);
+}
+
+  /** Generate class declaration and instance using the above constructor and destructor */
+  PARSEC_OBJ_CLASS_DECLARATION(__parsec_redistribute_reshuffle_internal_taskpool_t);
+  PARSEC_OBJ_CLASS_INSTANCE(__parsec_redistribute_reshuffle_internal_taskpool_t, parsec_redistribute_reshuffle_taskpool_t,
+                            __parsec_redistribute_reshuffle_internal_constructor, __parsec_redistribute_reshuffle_internal_destructor);
+
+#undef descY
+#undef descT
+#undef size_row
+#undef size_col
+#undef disi_Y
+#undef disj_Y
+#undef disi_T
+#undef disj_T
+#undef m_Y_START
+#undef n_Y_START
+#undef m_Y_END
+#undef n_Y_END
+#undef m_T_START
+#undef n_T_START
+#undef m_T_END
+#undef n_T_END
+#undef num_col
+#undef NT
+
+parsec_redistribute_reshuffle_taskpool_t *parsec_redistribute_reshuffle_new(parsec_tiled_matrix_t* descY /* data descY */, parsec_tiled_matrix_t* descT /* data descT */, int size_row, int size_col, int disi_Y, int disj_Y, int disi_T, int disj_T)
+{
+  __parsec_redistribute_reshuffle_internal_taskpool_t *__parsec_tp = PARSEC_OBJ_NEW(__parsec_redistribute_reshuffle_internal_taskpool_t);
+  /* Dump the hidden parameters with default values */
+  int m_Y_START;
+  int n_Y_START;
+  int m_Y_END;
+  int n_Y_END;
+  int m_T_START;
+  int n_T_START;
+  int m_T_END;
+  int n_T_END;
+  int num_col;
+  int NT;
+  /* Now the Parameter-dependent structures: */
+  __parsec_tp->super._g_descY = descY;
+  __parsec_tp->super._g_descT = descT;
+  __parsec_tp->super._g_size_row = size_row;
+  __parsec_tp->super._g_size_col = size_col;
+  __parsec_tp->super._g_disi_Y = disi_Y;
+  __parsec_tp->super._g_disj_Y = disj_Y;
+  __parsec_tp->super._g_disi_T = disi_T;
+  __parsec_tp->super._g_disj_T = disj_T;
+  __parsec_tp->super._g_m_Y_START = m_Y_START = disi_Y/descY->mb;
+  __parsec_tp->super._g_n_Y_START = n_Y_START = disj_Y/descY->nb;
+  __parsec_tp->super._g_m_Y_END = m_Y_END = (disi_Y+size_row-1)/descY->mb;
+  __parsec_tp->super._g_n_Y_END = n_Y_END = (disj_Y+size_col-1)/descY->nb;
+  __parsec_tp->super._g_m_T_START = m_T_START = disi_T/descT->mb;
+  __parsec_tp->super._g_n_T_START = n_T_START = disj_T/descT->nb;
+  __parsec_tp->super._g_m_T_END = m_T_END = (disi_T+size_row-1)/descT->mb;
+  __parsec_tp->super._g_n_T_END = n_T_END = (disj_T+size_col-1)/descT->nb;
+  __parsec_tp->super._g_num_col = num_col = descT->lnt;
+  __parsec_tp->super._g_NT = NT = (n_T_END-n_T_START)/num_col;
+  PARSEC_AYU_REGISTER_TASK(&redistribute_reshuffle_Receive);
+  PARSEC_AYU_REGISTER_TASK(&redistribute_reshuffle_Send);
+  __parsec_tp->super.super.startup_hook = (parsec_startup_fn_t)redistribute_reshuffle_startup;
+  (void)parsec_taskpool_reserve_id((parsec_taskpool_t*)__parsec_tp);
+/* Prevent warnings related to not used hidden global variables */
+  (void)m_Y_START;  (void)n_Y_START;  (void)m_Y_END;  (void)n_Y_END;  (void)m_T_START;  (void)n_T_START;  (void)m_T_END;  (void)n_T_END;  (void)num_col;  (void)NT;
+  return (parsec_redistribute_reshuffle_taskpool_t*)__parsec_tp;
+}
+
@@ -0,0 +1,1820 @@
+#include "parsec.h"
+#include "parsec/parsec_internal.h"
+#include "parsec/ayudame.h"
+#include "parsec/execution_stream.h"
+#include "parsec/parsec_binary_profile.h"
+#include "parsec/mca/device/device_gpu.h"
+#if defined(PARSEC_HAVE_DEV_CUDA_SUPPORT)
+#include "parsec/mca/device/cuda/device_cuda.h"
+#endif  /* defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) */
+#if defined(PARSEC_HAVE_DEV_HIP_SUPPORT)
+#include "parsec/mca/device/hip/device_hip.h"
+#endif  /* defined(PARSEC_HAVE_DEV_HIP_SUPPORT) */
+#if defined(_MSC_VER) || defined(__MINGW32__)
+#  include <malloc.h>
+#else
+#  include <alloca.h>
+#endif  /* defined(_MSC_VER) || defined(__MINGW32__) */
+
+#define PARSEC_reduce_NB_TASK_CLASSES 1
+#define PARSEC_reduce_NB_DATA 2
+
+typedef struct __parsec_reduce_internal_taskpool_s __parsec_reduce_internal_taskpool_t;
+struct parsec_reduce_internal_taskpool_s;
+
+/** Predeclarations of the parsec_task_class_t */
+static const parsec_task_class_t reduce_reduce;
+/** Predeclarations of the parameters */
+static const parsec_flow_t flow_of_reduce_reduce_for_C;
+static const parsec_flow_t flow_of_reduce_reduce_for_A;
+static const parsec_flow_t flow_of_reduce_reduce_for_B;
+/*
+ * Copyright (c) 2011-2022 The University of Tennessee and The University
+ *                         of Tennessee Research Foundation.  All rights
+ *                         reserved.
+ */
+
+#include <math.h>
+#include "parsec/data_dist/matrix/matrix.h"
+
+#define PARSEC_reduce_DEFAULT_ADT    (&__parsec_tp->super.arenas_datatypes[PARSEC_reduce_DEFAULT_ADT_IDX])
+#include "reduce.h"
+
+struct __parsec_reduce_internal_taskpool_s {
+ parsec_reduce_taskpool_t super;
+ volatile int32_t sync_point;
+ volatile int32_t initial_number_tasks;
+ parsec_task_t* startup_queue;
+  /* The ranges to compute the hash key */
+  int reduce_l_min;
+  int reduce_l_range;
+  int reduce_p_min;
+  int reduce_p_range;
+  /* The list of data repositories  reduce */
+  data_repo_t* repositories[1];
+};
+
+#if defined(PARSEC_PROF_TRACE)
+#  if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+static int reduce_profiling_array[4*PARSEC_reduce_NB_TASK_CLASSES] = {-2}; /* 2 pairs (begin, end) per task, times two because each task class has an internal_init task */
+#  else /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+static int reduce_profiling_array[2*PARSEC_reduce_NB_TASK_CLASSES] = {-2}; /* 2 pairs (begin, end) per task */
+#  endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+#endif  /* defined(PARSEC_PROF_TRACE) */
+/* Globals */
+#define descA __parsec_tp->super._g_descA
+#define R __parsec_tp->super._g_R
+#define MT (__parsec_tp->super._g_MT)
+#define depth (__parsec_tp->super._g_depth)
+#define ELEM_NEUTRE (__parsec_tp->super._g_ELEM_NEUTRE)
+
+static inline int parsec_imin(int a, int b) { return (a <= b) ? a : b; };
+
+static inline int parsec_imax(int a, int b) { return (a >= b) ? a : b; };
+
+/* Data Access Macros */
+#define data_of_R(R_d0, R_d1)  (((parsec_data_collection_t*)__parsec_tp->super._g_R)->data_of((parsec_data_collection_t*)__parsec_tp->super._g_R, (R_d0), (R_d1)))
+#define data_of_descA(descA_d0, descA_d1)  (((parsec_data_collection_t*)__parsec_tp->super._g_descA)->data_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, (descA_d0), (descA_d1)))
+
+#define rank_of_R(R_d0, R_d1)  (((parsec_data_collection_t*)__parsec_tp->super._g_R)->rank_of((parsec_data_collection_t*)__parsec_tp->super._g_R, (R_d0), (R_d1)))
+#define rank_of_descA(descA_d0, descA_d1)  (((parsec_data_collection_t*)__parsec_tp->super._g_descA)->rank_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, (descA_d0), (descA_d1)))
+
+/* Functions Predicates */
+#define reduce_pred(l, p) (((parsec_data_collection_t*)(__parsec_tp->super._g_descA))->myrank == rank_of_descA(p, 0))
+
+/* Data Repositories */
+#define reduce_repo (__parsec_tp->repositories[0])
+/* Release dependencies output macro */
+#if defined(PARSEC_DEBUG_NOISIER)
+#define RELEASE_DEP_OUTPUT(ES, DEPO, TASKO, DEPI, TASKI, RSRC, RDST, DATA)\
+  do { \
+    char tmp1[128], tmp2[128]; (void)tmp1; (void)tmp2;\
+    PARSEC_DEBUG_VERBOSE(20, parsec_debug_output, "thread %d VP %d explore deps from %s:%s to %s:%s (from rank %d to %d) base ptr %p",\
+           (NULL != (ES) ? (ES)->th_id : -1), (NULL != (ES) ? (ES)->virtual_process->vp_id : -1),\
+           DEPO, parsec_task_snprintf(tmp1, 128, (parsec_task_t*)(TASKO)),\
+           DEPI, parsec_task_snprintf(tmp2, 128, (parsec_task_t*)(TASKI)), (RSRC), (RDST), (DATA));\
+  } while(0)
+#define ACQUIRE_FLOW(TASKI, DEPI, FUNO, DEPO, LOCALS, PTR)\
+  do { \
+    char tmp1[128], tmp2[128]; (void)tmp1; (void)tmp2;\
+    PARSEC_DEBUG_VERBOSE(20, parsec_debug_output, "task %s acquires flow %s from %s %s data ptr %p",\
+           parsec_task_snprintf(tmp1, 128, (parsec_task_t*)(TASKI)), (DEPI),\
+           (DEPO), parsec_snprintf_assignments(tmp2, 128, (FUNO), (parsec_assignment_t*)(LOCALS)), (PTR));\
+  } while(0)
+#else
+#define RELEASE_DEP_OUTPUT(ES, DEPO, TASKO, DEPI, TASKI, RSRC, RDST, DATA)
+#define ACQUIRE_FLOW(TASKI, DEPI, TASKO, DEPO, LOCALS, PTR)
+#endif
+static inline parsec_key_t __jdf2c_make_key_reduce(const parsec_taskpool_t *tp, const parsec_assignment_t *as)
+{
+  const __parsec_reduce_internal_taskpool_t *__parsec_tp = (const __parsec_reduce_internal_taskpool_t *)tp;
+  const __parsec_reduce_reduce_parsec_assignment_t *assignment = (const __parsec_reduce_reduce_parsec_assignment_t*)as;
+  uint64_t __parsec_id = 0;
+  __parsec_id += (assignment->l.value - __parsec_tp->reduce_l_min);
+  __parsec_id += (assignment->p.value - __parsec_tp->reduce_p_min) * __parsec_tp->reduce_l_range;
+  return (parsec_key_t)__parsec_id;
+}
+static char *__jdf2c_key_fns_reduce_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_reduce_internal_taskpool_t *__parsec_tp = (__parsec_reduce_internal_taskpool_t *)user_data;
+  int l = (__parsec_key) % __parsec_tp->reduce_l_range + __parsec_tp->reduce_l_min;
+  __parsec_key = __parsec_key / __parsec_tp->reduce_l_range;
+  int p = (__parsec_key) % __parsec_tp->reduce_p_range + __parsec_tp->reduce_p_min;
+  __parsec_key = __parsec_key / __parsec_tp->reduce_p_range;
+  snprintf(buffer, buffer_size, "reduce(%d, %d)", l, p);
+  return buffer;
+}
+
+static parsec_key_fn_t __jdf2c_key_fns_reduce = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = __jdf2c_key_fns_reduce_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/******                                    reduce                                    ******/
+
+static inline int32_t minexpr_of_symb_reduce_reduce_l_fct(const __parsec_reduce_internal_taskpool_t *__parsec_tp, const __parsec_reduce_reduce_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 1;
+}
+static const parsec_expr_t minexpr_of_symb_reduce_reduce_l = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_reduce_reduce_l_fct }
+                   }
+};
+static inline int maxexpr_of_symb_reduce_reduce_l_fct(const __parsec_reduce_internal_taskpool_t *__parsec_tp, const __parsec_reduce_reduce_parsec_assignment_t *locals)
+{
+  const int l = locals->l.value; (void)l;
+  const int p = locals->p.value; (void)p;
+
+  (void)l;
+  (void)p;
+  (void)__parsec_tp; (void)locals;
+  return (depth + 1);
+}
+static const parsec_expr_t maxexpr_of_symb_reduce_reduce_l = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_reduce_reduce_l_fct }
+                   }
+};
+static const parsec_symbol_t symb_reduce_reduce_l = { .name = "l", .context_index = 0, .min = &minexpr_of_symb_reduce_reduce_l, .max = &maxexpr_of_symb_reduce_reduce_l, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int32_t minexpr_of_symb_reduce_reduce_p_fct(const __parsec_reduce_internal_taskpool_t *__parsec_tp, const __parsec_reduce_reduce_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_reduce_reduce_p = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_reduce_reduce_p_fct }
+                   }
+};
+static inline int maxexpr_of_symb_reduce_reduce_p_fct(const __parsec_reduce_internal_taskpool_t *__parsec_tp, const __parsec_reduce_reduce_parsec_assignment_t *locals)
+{
+  const int l = locals->l.value; (void)l;
+  const int p = locals->p.value; (void)p;
+
+  (void)l;
+  (void)p;
+  (void)__parsec_tp; (void)locals;
+  return (MT / (1 << l));
+}
+static const parsec_expr_t maxexpr_of_symb_reduce_reduce_p = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_reduce_reduce_p_fct }
+                   }
+};
+static const parsec_symbol_t symb_reduce_reduce_p = { .name = "p", .context_index = 1, .min = &minexpr_of_symb_reduce_reduce_p, .max = &maxexpr_of_symb_reduce_reduce_p, .cst_inc = 1, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int affinity_of_reduce_reduce(const __parsec_reduce_reduce_task_t *this_task,
+                     parsec_data_ref_t *ref)
+{
+    const __parsec_reduce_internal_taskpool_t *__parsec_tp = (const __parsec_reduce_internal_taskpool_t*)this_task->taskpool;
+  const int l = this_task->locals.l.value; (void)l;
+  const int p = this_task->locals.p.value; (void)p;
+
+  /* Silent Warnings: should look into predicate to know what variables are usefull */
+  (void)l;
+  (void)p;
+  ref->dc = (parsec_data_collection_t *)__parsec_tp->super._g_descA;
+  /* Compute data key */
+  ref->key = ref->dc->data_key(ref->dc, p, 0);
+  return 1;
+}
+static const parsec_property_t properties_of_reduce_reduce[1] = {
+  {.name = NULL, .expr = NULL}
+};
+static inline int expr_of_cond_for_flow_of_reduce_reduce_for_C_dep2_atline_34_fct(const __parsec_reduce_internal_taskpool_t *__parsec_tp, const __parsec_reduce_reduce_parsec_assignment_t *locals)
+{
+  const int l = locals->l.value; (void)l;
+  const int p = locals->p.value; (void)p;
+
+  (void)l;
+  (void)p;
+  (void)__parsec_tp; (void)locals;
+  return ((depth + 1)) == (l);
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_reduce_reduce_for_C_dep2_atline_34 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_reduce_reduce_for_C_dep2_atline_34_fct }
+                   }
+};
+static parsec_data_t *flow_of_reduce_reduce_for_C_dep2_atline_34_direct_access(const __parsec_reduce_internal_taskpool_t *__parsec_tp, const __parsec_reduce_reduce_parsec_assignment_t *assignments)
+{
+  const int l = assignments->l.value; (void)l;
+  const int p = assignments->p.value; (void)p;
+
+  /* Silence Warnings: should look into parameters to know what variables are useful */
+  (void)l;
+  (void)p;
+  if( __parsec_tp->super.super.context->my_rank == (int32_t)rank_of_R(p, 0) )
+    return data_of_R(p, 0);
+  return NULL;
+}
+
+static const parsec_dep_t flow_of_reduce_reduce_for_C_dep2_atline_34 = {
+  .cond = &expr_of_cond_for_flow_of_reduce_reduce_for_C_dep2_atline_34,  /* ((depth + 1)) == (l) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = PARSEC_LOCAL_DATA_TASK_CLASS_ID, /* reduce_R */
+  .direct_data = (parsec_data_lookup_func_t)&flow_of_reduce_reduce_for_C_dep2_atline_34_direct_access,
+  .flags = PARSEC_DEP_FINAL_WRITE_AS_IS,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_reduce_reduce_for_C,
+};
+static inline int expr_of_cond_for_flow_of_reduce_reduce_for_C_dep3_atline_35_fct(const __parsec_reduce_internal_taskpool_t *__parsec_tp, const __parsec_reduce_reduce_parsec_assignment_t *locals)
+{
+  const int l = locals->l.value; (void)l;
+  const int p = locals->p.value; (void)p;
+
+  (void)l;
+  (void)p;
+  (void)__parsec_tp; (void)locals;
+  return (((depth + 1)) != (l) && (0) == ((p % 2)));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_reduce_reduce_for_C_dep3_atline_35 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_reduce_reduce_for_C_dep3_atline_35_fct }
+                   }
+};
+static const parsec_dep_t flow_of_reduce_reduce_for_C_dep3_atline_35 = {
+  .cond = &expr_of_cond_for_flow_of_reduce_reduce_for_C_dep3_atline_35,  /* (((depth + 1)) != (l) && (0) == ((p % 2))) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 0, /* reduce_reduce */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_reduce_reduce_for_A,
+  .dep_index = 1,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_reduce_reduce_for_C,
+};
+static inline int expr_of_cond_for_flow_of_reduce_reduce_for_C_dep4_atline_36_fct(const __parsec_reduce_internal_taskpool_t *__parsec_tp, const __parsec_reduce_reduce_parsec_assignment_t *locals)
+{
+  const int l = locals->l.value; (void)l;
+  const int p = locals->p.value; (void)p;
+
+  (void)l;
+  (void)p;
+  (void)__parsec_tp; (void)locals;
+  return (((depth + 1)) != (l) && (0) != ((p % 2)));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_reduce_reduce_for_C_dep4_atline_36 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_reduce_reduce_for_C_dep4_atline_36_fct }
+                   }
+};
+static const parsec_dep_t flow_of_reduce_reduce_for_C_dep4_atline_36 = {
+  .cond = &expr_of_cond_for_flow_of_reduce_reduce_for_C_dep4_atline_36,  /* (((depth + 1)) != (l) && (0) != ((p % 2))) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 0, /* reduce_reduce */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_reduce_reduce_for_B,
+  .dep_index = 2,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_reduce_reduce_for_C,
+};
+#if MAX_DEP_OUT_COUNT < 3  /* number of output dependencies */
+    #error Too many output dependencies (supports up to MAX_DEP_OUT_COUNT [=10] but found 3). Fix the code or recompile PaRSEC with a larger MAX_DEP_OUT_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_reduce_reduce_for_C = {
+  .name               = "C",
+  .sym_type           = PARSEC_SYM_OUT,
+  .flow_flags         = PARSEC_FLOW_ACCESS_WRITE|PARSEC_FLOW_HAS_IN_DEPS,
+  .flow_index         = 0,
+  .flow_datatype_mask = 0x1,
+  .dep_in     = { NULL },
+  .dep_out    = { &flow_of_reduce_reduce_for_C_dep2_atline_34,
+ &flow_of_reduce_reduce_for_C_dep3_atline_35,
+ &flow_of_reduce_reduce_for_C_dep4_atline_36 }
+};
+
+static inline int expr_of_cond_for_flow_of_reduce_reduce_for_A_dep1_atline_29_iftrue_fct(const __parsec_reduce_internal_taskpool_t *__parsec_tp, const __parsec_reduce_reduce_parsec_assignment_t *locals)
+{
+  const int l = locals->l.value;
+  const int p = locals->p.value; (void)p;
+
+  (void)l;
+  (void)p;
+  (void)__parsec_tp; (void)locals;
+  return (1) == (l);
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_reduce_reduce_for_A_dep1_atline_29_iftrue = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_reduce_reduce_for_A_dep1_atline_29_iftrue_fct }
+                   }
+};
+static parsec_data_t *flow_of_reduce_reduce_for_A_dep1_atline_29_direct_access(const __parsec_reduce_internal_taskpool_t *__parsec_tp, const __parsec_reduce_reduce_parsec_assignment_t *assignments)
+{
+  const int l = assignments->l.value; (void)l;
+  const int p = assignments->p.value; (void)p;
+
+  /* Silence Warnings: should look into parameters to know what variables are useful */
+  (void)l;
+  (void)p;
+  if( __parsec_tp->super.super.context->my_rank == (int32_t)rank_of_descA((2 * p), 0) )
+    return data_of_descA((2 * p), 0);
+  return NULL;
+}
+
+static const parsec_dep_t flow_of_reduce_reduce_for_A_dep1_atline_29_iftrue = {
+  .cond = &expr_of_cond_for_flow_of_reduce_reduce_for_A_dep1_atline_29_iftrue,  /* (1) == (l) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = PARSEC_LOCAL_DATA_TASK_CLASS_ID, /* reduce_descA */
+  .direct_data = (parsec_data_lookup_func_t)&flow_of_reduce_reduce_for_A_dep1_atline_29_direct_access,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_reduce_reduce_for_A,
+};
+static inline int expr_of_cond_for_flow_of_reduce_reduce_for_A_dep1_atline_29_iffalse_fct(const __parsec_reduce_internal_taskpool_t *__parsec_tp, const __parsec_reduce_reduce_parsec_assignment_t *locals)
+{
+  const int l = locals->l.value;
+  const int p = locals->p.value; (void)p;
+
+  (void)l;
+  (void)p;
+  (void)__parsec_tp; (void)locals;
+  return !((1) == (l));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_reduce_reduce_for_A_dep1_atline_29_iffalse = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_reduce_reduce_for_A_dep1_atline_29_iffalse_fct }
+                   }
+};
+static const parsec_dep_t flow_of_reduce_reduce_for_A_dep1_atline_29_iffalse = {
+  .cond = &expr_of_cond_for_flow_of_reduce_reduce_for_A_dep1_atline_29_iffalse,  /* !(1) == (l) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 0, /* reduce_reduce */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_reduce_reduce_for_C,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_reduce_reduce_for_A,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_reduce_reduce_for_A = {
+  .name               = "A",
+  .sym_type           = PARSEC_SYM_IN,
+  .flow_flags         = PARSEC_FLOW_ACCESS_READ|PARSEC_FLOW_HAS_IN_DEPS,
+  .flow_index         = 1,
+  .flow_datatype_mask = 0x0,
+  .dep_in     = { &flow_of_reduce_reduce_for_A_dep1_atline_29_iftrue,
+ &flow_of_reduce_reduce_for_A_dep1_atline_29_iffalse },
+  .dep_out    = { NULL }
+};
+
+static inline int expr_of_cond_for_flow_of_reduce_reduce_for_B_dep1_atline_30_fct(const __parsec_reduce_internal_taskpool_t *__parsec_tp, const __parsec_reduce_reduce_parsec_assignment_t *locals)
+{
+  const int l = locals->l.value; (void)l;
+  const int p = locals->p.value; (void)p;
+
+  (void)l;
+  (void)p;
+  (void)__parsec_tp; (void)locals;
+  return (((p * (1 << l)) + (1 << (l - 1)))) >= (MT);
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_reduce_reduce_for_B_dep1_atline_30 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_reduce_reduce_for_B_dep1_atline_30_fct }
+                   }
+};
+static const parsec_dep_t flow_of_reduce_reduce_for_B_dep1_atline_30 = {
+  .cond = &expr_of_cond_for_flow_of_reduce_reduce_for_B_dep1_atline_30,  /* (((p * (1 << l)) + (1 << (l - 1)))) >= (MT) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = PARSEC_LOCAL_DATA_TASK_CLASS_ID, /* reduce___parsec_null_type */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .dep_index = 1,
+  .dep_datatype_index = 1,
+  .belongs_to = &flow_of_reduce_reduce_for_B,
+};
+static inline int expr_of_cond_for_flow_of_reduce_reduce_for_B_dep2_atline_31_fct(const __parsec_reduce_internal_taskpool_t *__parsec_tp, const __parsec_reduce_reduce_parsec_assignment_t *locals)
+{
+  const int l = locals->l.value; (void)l;
+  const int p = locals->p.value; (void)p;
+
+  (void)l;
+  (void)p;
+  (void)__parsec_tp; (void)locals;
+  return ((1) == (l) && (((p * (1 << l)) + (1 << (l - 1)))) < (MT));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_reduce_reduce_for_B_dep2_atline_31 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_reduce_reduce_for_B_dep2_atline_31_fct }
+                   }
+};
+static parsec_data_t *flow_of_reduce_reduce_for_B_dep2_atline_31_direct_access(const __parsec_reduce_internal_taskpool_t *__parsec_tp, const __parsec_reduce_reduce_parsec_assignment_t *assignments)
+{
+  const int l = assignments->l.value; (void)l;
+  const int p = assignments->p.value; (void)p;
+
+  /* Silence Warnings: should look into parameters to know what variables are useful */
+  (void)l;
+  (void)p;
+  if( __parsec_tp->super.super.context->my_rank == (int32_t)rank_of_descA(((2 * p) + 1), 0) )
+    return data_of_descA(((2 * p) + 1), 0);
+  return NULL;
+}
+
+static const parsec_dep_t flow_of_reduce_reduce_for_B_dep2_atline_31 = {
+  .cond = &expr_of_cond_for_flow_of_reduce_reduce_for_B_dep2_atline_31,  /* ((1) == (l) && (((p * (1 << l)) + (1 << (l - 1)))) < (MT)) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = PARSEC_LOCAL_DATA_TASK_CLASS_ID, /* reduce_descA */
+  .direct_data = (parsec_data_lookup_func_t)&flow_of_reduce_reduce_for_B_dep2_atline_31_direct_access,
+  .dep_index = 2,
+  .dep_datatype_index = 1,
+  .belongs_to = &flow_of_reduce_reduce_for_B,
+};
+static inline int expr_of_cond_for_flow_of_reduce_reduce_for_B_dep3_atline_32_fct(const __parsec_reduce_internal_taskpool_t *__parsec_tp, const __parsec_reduce_reduce_parsec_assignment_t *locals)
+{
+  const int l = locals->l.value; (void)l;
+  const int p = locals->p.value; (void)p;
+
+  (void)l;
+  (void)p;
+  (void)__parsec_tp; (void)locals;
+  return ((1) != (l) && (((p * (1 << l)) + (1 << (l - 1)))) < (MT));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_reduce_reduce_for_B_dep3_atline_32 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_reduce_reduce_for_B_dep3_atline_32_fct }
+                   }
+};
+static const parsec_dep_t flow_of_reduce_reduce_for_B_dep3_atline_32 = {
+  .cond = &expr_of_cond_for_flow_of_reduce_reduce_for_B_dep3_atline_32,  /* ((1) != (l) && (((p * (1 << l)) + (1 << (l - 1)))) < (MT)) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 0, /* reduce_reduce */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_reduce_reduce_for_C,
+  .dep_index = 3,
+  .dep_datatype_index = 1,
+  .belongs_to = &flow_of_reduce_reduce_for_B,
+};
+#if MAX_DEP_IN_COUNT < 3  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 3). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_reduce_reduce_for_B = {
+  .name               = "B",
+  .sym_type           = PARSEC_SYM_IN,
+  .flow_flags         = PARSEC_FLOW_ACCESS_READ|PARSEC_FLOW_HAS_IN_DEPS,
+  .flow_index         = 2,
+  .flow_datatype_mask = 0x0,
+  .dep_in     = { &flow_of_reduce_reduce_for_B_dep1_atline_30,
+ &flow_of_reduce_reduce_for_B_dep2_atline_31,
+ &flow_of_reduce_reduce_for_B_dep3_atline_32 },
+  .dep_out    = { NULL }
+};
+
+static void
+iterate_successors_of_reduce_reduce(parsec_execution_stream_t *es, const __parsec_reduce_reduce_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_reduce_internal_taskpool_t *__parsec_tp = (const __parsec_reduce_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_reduce_reduce_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_reduce_reduce_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int l = __jdf2c__tmp_locals.l.value; (void)l;
+  const int p = __jdf2c__tmp_locals.p.value; (void)p;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)l;  (void)p;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_descA(p, 0);
+#endif
+  if( action_mask & 0x7 ) {  /* Flow of data C [0] */
+    data.data   = this_task->data._f_C.data_out;
+    data.data_future  = NULL;
+    /* action_mask & 0x1 goes to data R(p, 0) */
+  if( action_mask & 0x2 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_reduce_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_reduce_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( (((depth + 1)) != (l) && (0) == ((p % 2))) ) {
+      __parsec_reduce_reduce_task_t* ncc = (__parsec_reduce_reduce_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[reduce_reduce.task_class_id];
+        const int reduce_l = (l + 1);
+        if( (reduce_l >= (1)) && (reduce_l <= ((depth + 1))) ) {
+          assert(&nc.locals[0].value == &ncc->locals.l.value);
+          ncc->locals.l.value = reduce_l;
+          const int reduce_p = (p / 2);
+          if( (reduce_p >= (0)) && (reduce_p <= ((MT / (1 << ncc->locals.l.value)))) ) {
+            assert(&nc.locals[1].value == &ncc->locals.p.value);
+            ncc->locals.p.value = reduce_p;
+#if defined(DISTRIBUTED)
+            rank_dst = rank_of_descA(ncc->locals.p.value, 0);
+            if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+              vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, ncc->locals.p.value, 0);
+            nc.priority = __parsec_tp->super.super.priority;
+            successor_repo = reduce_repo;
+            successor_repo_key = __jdf2c_make_key_reduce((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+          RELEASE_DEP_OUTPUT(es, "C", this_task, "A", &nc, rank_src, rank_dst, &data);
+          if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_reduce_reduce_for_C_dep3_atline_35, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+            }
+          }
+    }
+  }
+  if( action_mask & 0x4 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_reduce_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_reduce_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( (((depth + 1)) != (l) && (0) != ((p % 2))) ) {
+      __parsec_reduce_reduce_task_t* ncc = (__parsec_reduce_reduce_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[reduce_reduce.task_class_id];
+        const int reduce_l = (l + 1);
+        if( (reduce_l >= (1)) && (reduce_l <= ((depth + 1))) ) {
+          assert(&nc.locals[0].value == &ncc->locals.l.value);
+          ncc->locals.l.value = reduce_l;
+          const int reduce_p = (p / 2);
+          if( (reduce_p >= (0)) && (reduce_p <= ((MT / (1 << ncc->locals.l.value)))) ) {
+            assert(&nc.locals[1].value == &ncc->locals.p.value);
+            ncc->locals.p.value = reduce_p;
+#if defined(DISTRIBUTED)
+            rank_dst = rank_of_descA(ncc->locals.p.value, 0);
+            if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+              vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, ncc->locals.p.value, 0);
+            nc.priority = __parsec_tp->super.super.priority;
+            successor_repo = reduce_repo;
+            successor_repo_key = __jdf2c_make_key_reduce((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+          RELEASE_DEP_OUTPUT(es, "C", this_task, "B", &nc, rank_src, rank_dst, &data);
+          if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_reduce_reduce_for_C_dep4_atline_36, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+            }
+          }
+    }
+  }
+  }
+  /* Flow of data A has only IN dependencies */
+  /* Flow of data B has only IN dependencies */
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static void
+iterate_predecessors_of_reduce_reduce(parsec_execution_stream_t *es, const __parsec_reduce_reduce_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_reduce_internal_taskpool_t *__parsec_tp = (const __parsec_reduce_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_reduce_reduce_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_reduce_reduce_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int l = __jdf2c__tmp_locals.l.value; (void)l;
+  const int p = __jdf2c__tmp_locals.p.value; (void)p;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)l;  (void)p;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_descA(p, 0);
+#endif
+  /* Flow of data C has only IN dependencies */
+  if( action_mask & 0x1 ) {  /* Flow of data A [1] */
+    data.data   = this_task->data._f_A.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x1 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_reduce_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_reduce_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( !((1) == (l)) ) {
+      __parsec_reduce_reduce_task_t* ncc = (__parsec_reduce_reduce_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[reduce_reduce.task_class_id];
+        const int reduce_l = (l - 1);
+        if( (reduce_l >= (1)) && (reduce_l <= ((depth + 1))) ) {
+          assert(&nc.locals[0].value == &ncc->locals.l.value);
+          ncc->locals.l.value = reduce_l;
+          const int reduce_p = (2 * p);
+          if( (reduce_p >= (0)) && (reduce_p <= ((MT / (1 << ncc->locals.l.value)))) ) {
+            assert(&nc.locals[1].value == &ncc->locals.p.value);
+            ncc->locals.p.value = reduce_p;
+#if defined(DISTRIBUTED)
+            rank_dst = rank_of_descA(ncc->locals.p.value, 0);
+            if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+              vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, ncc->locals.p.value, 0);
+            nc.priority = __parsec_tp->super.super.priority;
+            successor_repo = reduce_repo;
+            successor_repo_key = __jdf2c_make_key_reduce((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+          RELEASE_DEP_OUTPUT(es, "A", this_task, "C", &nc, rank_src, rank_dst, &data);
+          if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_reduce_reduce_for_A_dep1_atline_29_iffalse, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+            }
+          }
+    }
+  }
+  }
+  if( action_mask & 0xe ) {  /* Flow of data B [2] */
+    data.data   = this_task->data._f_B.data_out;
+    data.data_future  = NULL;
+    /* action_mask & 0x2 goes to data __parsec_null_type() */
+    /* action_mask & 0x4 goes to data descA(((2 * p) + 1), 0) */
+  if( action_mask & 0x8 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_reduce_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_reduce_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( ((1) != (l) && (((p * (1 << l)) + (1 << (l - 1)))) < (MT)) ) {
+      __parsec_reduce_reduce_task_t* ncc = (__parsec_reduce_reduce_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[reduce_reduce.task_class_id];
+        const int reduce_l = (l - 1);
+        if( (reduce_l >= (1)) && (reduce_l <= ((depth + 1))) ) {
+          assert(&nc.locals[0].value == &ncc->locals.l.value);
+          ncc->locals.l.value = reduce_l;
+          const int reduce_p = ((p * 2) + 1);
+          if( (reduce_p >= (0)) && (reduce_p <= ((MT / (1 << ncc->locals.l.value)))) ) {
+            assert(&nc.locals[1].value == &ncc->locals.p.value);
+            ncc->locals.p.value = reduce_p;
+#if defined(DISTRIBUTED)
+            rank_dst = rank_of_descA(ncc->locals.p.value, 0);
+            if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+              vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, ncc->locals.p.value, 0);
+            nc.priority = __parsec_tp->super.super.priority;
+            successor_repo = reduce_repo;
+            successor_repo_key = __jdf2c_make_key_reduce((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+          RELEASE_DEP_OUTPUT(es, "B", this_task, "C", &nc, rank_src, rank_dst, &data);
+          if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_reduce_reduce_for_B_dep3_atline_32, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+            }
+          }
+    }
+  }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static int release_deps_of_reduce_reduce(parsec_execution_stream_t *es, __parsec_reduce_reduce_task_t *this_task, uint32_t action_mask, parsec_remote_deps_t *deps)
+{
+  PARSEC_PINS(es, RELEASE_DEPS_BEGIN, (parsec_task_t *)this_task);  const __parsec_reduce_internal_taskpool_t *__parsec_tp = (const __parsec_reduce_internal_taskpool_t *)this_task->taskpool;
+  parsec_release_dep_fct_arg_t arg;
+  int __vp_id;
+  int consume_local_repo = 0;
+  arg.action_mask = action_mask;
+  arg.output_entry = NULL;
+  arg.output_repo = NULL;
+#if defined(DISTRIBUTED)
+  arg.remote_deps = deps;
+#endif  /* defined(DISTRIBUTED) */
+  assert(NULL != es);
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS )    arg.ready_lists = alloca(sizeof(parsec_task_t *) * es->virtual_process->parsec_context->nb_vp);
+  else
+    arg.ready_lists = NULL;
+  for( __vp_id = 0; __vp_id < es->virtual_process->parsec_context->nb_vp; arg.ready_lists[__vp_id++] = NULL );
+  (void)__parsec_tp; (void)deps;
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_C.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_C.source_repo, this_task->data._f_C.source_repo_entry->ht_item.key );
+    }
+    if( NULL != this_task->data._f_A.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_A.source_repo, this_task->data._f_A.source_repo_entry->ht_item.key );
+    }
+    if( NULL != this_task->data._f_B.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_B.source_repo, this_task->data._f_B.source_repo_entry->ht_item.key );
+    }
+  }
+  consume_local_repo = (this_task->repo_entry != NULL);
+  arg.output_repo = reduce_repo;
+  arg.output_entry = this_task->repo_entry;
+  arg.output_usage = 0;
+  if( action_mask & (PARSEC_ACTION_RELEASE_LOCAL_DEPS | PARSEC_ACTION_GET_REPO_ENTRY) ) {
+    arg.output_entry = data_repo_lookup_entry_and_create( es, arg.output_repo, __jdf2c_make_key_reduce((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    arg.output_entry->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(arg.output_entry->sim_exec_date == 0);
+    arg.output_entry->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  if(action_mask & ( PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE ) ){
+    /* Generate the reshape promise for the outputs that need it */
+    iterate_successors_of_reduce_reduce(es, this_task, action_mask, parsec_set_up_reshape_promise, &arg);
+   }
+  iterate_successors_of_reduce_reduce(es, this_task, action_mask, parsec_release_dep_fct, &arg);
+
+#if defined(DISTRIBUTED)
+  if( (action_mask & PARSEC_ACTION_SEND_REMOTE_DEPS) && (NULL != arg.remote_deps)) {
+    parsec_remote_dep_activate(es, (parsec_task_t *)this_task, arg.remote_deps, arg.remote_deps->outgoing_mask);
+  }
+#endif
+
+  if(action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS) {
+    data_repo_entry_addto_usage_limit(reduce_repo, arg.output_entry->ht_item.key, arg.output_usage);
+    __parsec_schedule_vp(es, arg.ready_lists, 0);
+  }
+      if (consume_local_repo) {
+         data_repo_entry_used_once( reduce_repo, this_task->repo_entry->ht_item.key );
+      }
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_C.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_C.data_in);
+    }
+    if( NULL != this_task->data._f_A.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_A.data_in);
+    }
+    if( NULL != this_task->data._f_B.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_B.data_in);
+    }
+  }
+  PARSEC_PINS(es, RELEASE_DEPS_END, (parsec_task_t *)this_task);  return 0;
+}
+
+static int data_lookup_of_reduce_reduce(parsec_execution_stream_t *es, __parsec_reduce_reduce_task_t *this_task)
+{
+  const __parsec_reduce_internal_taskpool_t *__parsec_tp = (__parsec_reduce_internal_taskpool_t *)this_task->taskpool;
+  parsec_assignment_t generic_locals[MAX_PARAM_COUNT];  /* generic task locals */
+  int target_device = 0; (void)target_device;
+  (void)__parsec_tp; (void)generic_locals; (void)es;
+  parsec_data_copy_t *chunk = NULL;
+  data_repo_t        *reshape_repo  = NULL, *consumed_repo  = NULL;
+  data_repo_entry_t  *reshape_entry = NULL, *consumed_entry = NULL;
+  parsec_key_t        reshape_entry_key = 0, consumed_entry_key = 0;
+  uint8_t             consumed_flow_index;
+  parsec_dep_data_description_t data;
+  int ret;
+  (void)reshape_repo; (void)reshape_entry; (void)reshape_entry_key;
+  (void)consumed_repo; (void)consumed_entry; (void)consumed_entry_key;
+  (void)consumed_flow_index;
+  (void)chunk; (void)data; (void)ret;
+  const int l = this_task->locals.l.value; (void)l;
+  const int p = this_task->locals.p.value; (void)p;
+  if( NULL == this_task->repo_entry ){
+    this_task->repo_entry = data_repo_lookup_entry_and_create(es, reduce_repo,                                       __jdf2c_make_key_reduce((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    data_repo_entry_addto_usage_limit(reduce_repo, this_task->repo_entry->ht_item.key, 1);    this_task->repo_entry ->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(this_task->repo_entry ->sim_exec_date == 0);
+    this_task->repo_entry ->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  /* The reshape repo is the current task repo. */  reshape_repo = reduce_repo;
+  reshape_entry_key = __jdf2c_make_key_reduce((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals) ;
+  reshape_entry = this_task->repo_entry;
+  /* Lookup the input data, and store them in the context if any */
+
+if(! this_task->data._f_C.fulfill ){ /* Flow C */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_C.data_out = NULL;  /* By default, if nothing matches */
+    /* Flow C [0] dependency [4] pure output data  */
+    if( NULL == (chunk = this_task->data._f_C.data_in) ) {
+       /* No data set up by predecessor */
+      chunk = parsec_arena_get_copy(PARSEC_reduce_DEFAULT_ADT->arena, 1, target_device, PARSEC_reduce_DEFAULT_ADT->opaque_dtt);
+      chunk->original->owner_device = target_device;
+      this_task->data._f_C.data_out = chunk;
+    }
+    this_task->data._f_C.data_in     = chunk;
+    this_task->data._f_C.source_repo       = consumed_repo;
+    this_task->data._f_C.source_repo_entry = consumed_entry;
+    if( this_task->data._f_C.source_repo_entry == this_task->repo_entry ){
+      /* in case we have consume from this task repo entry for the flow,
+       * it is cleaned up, avoiding having old stuff during release_deps_of
+       */
+      this_task->repo_entry->data[0] = NULL;
+    }
+    this_task->data._f_C.fulfill = 1;
+}
+
+
+if(! this_task->data._f_A.fulfill ){ /* Flow A */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_A.data_out = NULL;  /* input only */
+    if( (1) == (l) ) {
+    /* Flow A [1] dependency [0] from memory descA */
+    if( NULL == (chunk = this_task->data._f_A.data_in) ) {
+    /* No data set up by predecessor on this task input flow */
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+    parsec_prof_grapher_data_input(data_of_descA((2 * p), 0), (parsec_task_t*)this_task, &flow_of_reduce_reduce_for_A, 1);
+#endif
+      chunk = parsec_data_get_copy(data_of_descA((2 * p), 0), target_device);
+      data.data = chunk;
+      data.data_future  = NULL;
+          data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      data.data_future   = NULL;
+      if( (ret = parsec_get_copy_reshape_from_desc(es, this_task->taskpool, (parsec_task_t *)this_task, 1, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      this_task->data._f_A.data_out = chunk;
+      PARSEC_OBJ_RETAIN(chunk);
+    } 
+    } else {
+    /* Flow A [1] dependency [0] from predecessor reduce */
+    if( NULL == (chunk = this_task->data._f_A.data_in) ) {
+    /* No data set up by predecessor on this task input flow */
+__parsec_reduce_reduce_parsec_assignment_t *target_locals = (__parsec_reduce_reduce_parsec_assignment_t*)&generic_locals;
+      const int reducel = target_locals->l.value = (l - 1); (void)reducel;
+      const int reducep = target_locals->p.value = (2 * p); (void)reducep;
+      if( (reshape_entry != NULL) && (reshape_entry->data[1] != NULL) ){
+          /* Reshape promise set up on this task repo by predecessor */
+          consumed_repo = reshape_repo;
+          consumed_entry = reshape_entry;
+          consumed_entry_key = reshape_entry_key;
+          consumed_flow_index = 1;
+      }else{
+          /* Consume from predecessor's repo */
+          consumed_repo = reduce_repo;
+          consumed_entry_key = __jdf2c_make_key_reduce((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)target_locals) ;
+          consumed_entry = data_repo_lookup_entry( consumed_repo, consumed_entry_key );
+          consumed_flow_index = 0;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 1, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      ACQUIRE_FLOW(this_task, "A", &reduce_reduce, "C", target_locals, chunk);
+      this_task->data._f_A.data_out = chunk;
+    } 
+    else {
+      /* Data set up by predecessor on this task input flow */
+      consumed_repo = this_task->data._f_A.source_repo;
+      consumed_entry = this_task->data._f_A.source_repo_entry;
+      consumed_entry_key = this_task->data._f_A.source_repo_entry->ht_item.key;
+      if( (reshape_entry != NULL) && (reshape_entry->data[1] != NULL) ){
+          /* Reshape promise set up on input by predecessor is on this task repo */
+          consumed_flow_index = 1;
+          assert( (this_task->data._f_A.source_repo == reshape_repo)
+               && (this_task->data._f_A.source_repo_entry == reshape_entry));
+      }else{
+          /* Reshape promise set up on input by predecessor is the predecesssor task repo */
+          consumed_flow_index = 0;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 1, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      this_task->data._f_A.data_out = parsec_data_get_copy(chunk->original, target_device);
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+      parsec_prof_grapher_data_input(chunk->original, (parsec_task_t*)this_task, &flow_of_reduce_reduce_for_A, 0);
+#endif
+    }
+    }
+    this_task->data._f_A.data_in     = chunk;
+    this_task->data._f_A.source_repo       = consumed_repo;
+    this_task->data._f_A.source_repo_entry = consumed_entry;
+    if( this_task->data._f_A.source_repo_entry == this_task->repo_entry ){
+      /* in case we have consume from this task repo entry for the flow,
+       * it is cleaned up, avoiding having old stuff during release_deps_of
+       */
+      this_task->repo_entry->data[1] = NULL;
+    }
+    this_task->data._f_A.fulfill = 1;
+}
+
+
+if(! this_task->data._f_B.fulfill ){ /* Flow B */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_B.data_out = NULL;  /* input only */
+    if( (((p * (1 << l)) + (1 << (l - 1)))) >= (MT) ) {
+    /* Flow B [2] dependency [1] from memory NEW or NULL data */
+    if( NULL == (chunk = this_task->data._f_B.data_in) ) {
+    /* No data set up by predecessor on this task input flow */
+    } 
+    }
+    else if( ((1) == (l) && (((p * (1 << l)) + (1 << (l - 1)))) < (MT)) ) {
+    /* Flow B [2] dependency [2] from memory descA */
+    if( NULL == (chunk = this_task->data._f_B.data_in) ) {
+    /* No data set up by predecessor on this task input flow */
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+    parsec_prof_grapher_data_input(data_of_descA(((2 * p) + 1), 0), (parsec_task_t*)this_task, &flow_of_reduce_reduce_for_B, 1);
+#endif
+      chunk = parsec_data_get_copy(data_of_descA(((2 * p) + 1), 0), target_device);
+      data.data = chunk;
+      data.data_future  = NULL;
+          data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      data.data_future   = NULL;
+      if( (ret = parsec_get_copy_reshape_from_desc(es, this_task->taskpool, (parsec_task_t *)this_task, 2, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      this_task->data._f_B.data_out = chunk;
+      PARSEC_OBJ_RETAIN(chunk);
+    } 
+    }
+    else if( ((1) != (l) && (((p * (1 << l)) + (1 << (l - 1)))) < (MT)) ) {
+    /* Flow B [2] dependency [3] from predecessor reduce */
+    if( NULL == (chunk = this_task->data._f_B.data_in) ) {
+    /* No data set up by predecessor on this task input flow */
+__parsec_reduce_reduce_parsec_assignment_t *target_locals = (__parsec_reduce_reduce_parsec_assignment_t*)&generic_locals;
+      const int reducel = target_locals->l.value = (l - 1); (void)reducel;
+      const int reducep = target_locals->p.value = ((p * 2) + 1); (void)reducep;
+      if( (reshape_entry != NULL) && (reshape_entry->data[2] != NULL) ){
+          /* Reshape promise set up on this task repo by predecessor */
+          consumed_repo = reshape_repo;
+          consumed_entry = reshape_entry;
+          consumed_entry_key = reshape_entry_key;
+          consumed_flow_index = 2;
+      }else{
+          /* Consume from predecessor's repo */
+          consumed_repo = reduce_repo;
+          consumed_entry_key = __jdf2c_make_key_reduce((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)target_locals) ;
+          consumed_entry = data_repo_lookup_entry( consumed_repo, consumed_entry_key );
+          consumed_flow_index = 0;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 2, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      ACQUIRE_FLOW(this_task, "B", &reduce_reduce, "C", target_locals, chunk);
+      this_task->data._f_B.data_out = chunk;
+    } 
+    else {
+      /* Data set up by predecessor on this task input flow */
+      consumed_repo = this_task->data._f_B.source_repo;
+      consumed_entry = this_task->data._f_B.source_repo_entry;
+      consumed_entry_key = this_task->data._f_B.source_repo_entry->ht_item.key;
+      if( (reshape_entry != NULL) && (reshape_entry->data[2] != NULL) ){
+          /* Reshape promise set up on input by predecessor is on this task repo */
+          consumed_flow_index = 2;
+          assert( (this_task->data._f_B.source_repo == reshape_repo)
+               && (this_task->data._f_B.source_repo_entry == reshape_entry));
+      }else{
+          /* Reshape promise set up on input by predecessor is the predecesssor task repo */
+          consumed_flow_index = 0;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 2, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      this_task->data._f_B.data_out = parsec_data_get_copy(chunk->original, target_device);
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+      parsec_prof_grapher_data_input(chunk->original, (parsec_task_t*)this_task, &flow_of_reduce_reduce_for_B, 0);
+#endif
+    }
+    }
+    this_task->data._f_B.data_in     = chunk;
+    this_task->data._f_B.source_repo       = consumed_repo;
+    this_task->data._f_B.source_repo_entry = consumed_entry;
+    if( this_task->data._f_B.source_repo_entry == this_task->repo_entry ){
+      /* in case we have consume from this task repo entry for the flow,
+       * it is cleaned up, avoiding having old stuff during release_deps_of
+       */
+      this_task->repo_entry->data[2] = NULL;
+    }
+    this_task->data._f_B.fulfill = 1;
+}
+
+  /** Generate profiling information */
+#if defined(PARSEC_PROF_TRACE)
+  this_task->prof_info.desc = (parsec_data_collection_t*)__parsec_tp->super._g_descA;
+  this_task->prof_info.priority = this_task->priority;
+  this_task->prof_info.data_id   = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->data_key((parsec_data_collection_t*)__parsec_tp->super._g_descA, p, 0);
+  this_task->prof_info.task_class_id = this_task->task_class->task_class_id;
+  this_task->prof_info.task_return_code = -1;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int datatype_lookup_of_reduce_reduce(parsec_execution_stream_t *es, const parsec_task_t *this_generic_task, const parsec_task_t *parent_task,
+              uint32_t* flow_mask, parsec_dep_data_description_t* data)
+{
+  const __parsec_reduce_reduce_task_t *this_task = (__parsec_reduce_reduce_task_t*)this_generic_task;
+  const __parsec_reduce_internal_taskpool_t *__parsec_tp = (__parsec_reduce_internal_taskpool_t *)this_task->taskpool;
+  (void)__parsec_tp; (void)es; (void)this_task; (void)data; (void)parent_task;
+  const int l = this_task->locals.l.value; (void)l;
+  const int p = this_task->locals.p.value; (void)p;
+  data->local.arena = data->remote.arena = NULL;
+  data->local.src_datatype  = data->local.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->local.src_count     = data->local.dst_count = 0;
+  data->local.src_displ     = data->local.dst_displ = 0;
+  data->data_future  = NULL;
+  if( (*flow_mask) & 0x80000000U ) { /* these are the input dependencies remote datatypes  */
+if( (*flow_mask) & 0x1U ) {  /* Flow C */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_reduce_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_reduce_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_reduce_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+if( (*flow_mask) & 0x2U ) {  /* Flow A */
+    if( ((*flow_mask) & 0x2U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_reduce_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_reduce_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_reduce_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x2U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x2U) */
+if( (*flow_mask) & 0x4U ) {  /* Flow B */
+    if( ((*flow_mask) & 0x4U)
+ && ((((p * (1 << l)) + (1 << (l - 1)))) >= (MT) || ((1) == (l) && (((p * (1 << l)) + (1 << (l - 1)))) < (MT)) || ((1) != (l) && (((p * (1 << l)) + (1 << (l - 1)))) < (MT))) ) {
+    data->remote.arena  =  PARSEC_reduce_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_reduce_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_reduce_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x4U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x4U) */
+    goto no_mask_match;
+  }
+
+  /* these are the output dependencies remote datatypes */
+if( (*flow_mask) & 0x7U ) {  /* Flow C */
+    if( ((*flow_mask) & 0x7U)
+ && (((depth + 1)) == (l) || (((depth + 1)) != (l) && (0) == ((p % 2))) || (((depth + 1)) != (l) && (0) != ((p % 2)))) ) {
+    data->remote.arena  =  PARSEC_reduce_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_reduce_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_reduce_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x7U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x7U) */
+ no_mask_match:
+  data->data                             = NULL;
+  data->remote.src_datatype = data->remote.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->remote.src_count    = data->remote.dst_count = 0;
+  data->remote.src_displ    = data->remote.dst_displ = 0;
+  data->data_future  = NULL;
+  (*flow_mask) = 0;  /* nothing left */
+  (void)l;  (void)p;
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+static int hook_of_reduce_reduce(parsec_execution_stream_t *es, __parsec_reduce_reduce_task_t *this_task)
+{
+  __parsec_reduce_internal_taskpool_t *__parsec_tp = (__parsec_reduce_internal_taskpool_t *)this_task->taskpool;
+  (void)es; (void)__parsec_tp;
+  const int l = this_task->locals.l.value; (void)l;
+  const int p = this_task->locals.p.value; (void)p;
+  (void)l;  (void)p;
+
+  /** Declare the variables that will hold the data, and all the accounting for each */
+  parsec_data_copy_t *_f_C = this_task->data._f_C.data_in;
+  void *C = PARSEC_DATA_COPY_GET_PTR(_f_C); (void)C;
+  parsec_data_copy_t *_f_A = this_task->data._f_A.data_in;
+  void *A = PARSEC_DATA_COPY_GET_PTR(_f_A); (void)A;
+  parsec_data_copy_t *_f_B = this_task->data._f_B.data_in;
+  void *B = PARSEC_DATA_COPY_GET_PTR(_f_B); (void)B;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    data_repo_entry_t *eC = this_task->data._f_C.source_repo_entry;
+    if( (NULL != eC) && (eC->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eC->sim_exec_date;
+    data_repo_entry_t *eA = this_task->data._f_A.source_repo_entry;
+    if( (NULL != eA) && (eA->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eA->sim_exec_date;
+    data_repo_entry_t *eB = this_task->data._f_B.source_repo_entry;
+    if( (NULL != eB) && (eB->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eB->sim_exec_date;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+    if ( NULL != _f_C ) {
+#if defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) || defined(PARSEC_HAVE_DEV_HIP_SUPPORT)
+      parsec_data_transfer_ownership_to_copy( _f_C->original, 0 /* device */,
+                                           PARSEC_FLOW_ACCESS_WRITE);
+#endif  /* defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) || defined(PARSEC_HAVE_DEV_HIP_SUPPORT) */
+      _f_C->version++;  /* C */
+#if defined(PARSEC_DEBUG_NOISIER)
+      char tmp[128];
+      PARSEC_DEBUG_VERBOSE(10, parsec_debug_output,
+                           "Body of %s: change Data copy %p to version %d",
+                           parsec_task_snprintf(tmp, 128, (parsec_task_t*)(this_task)),
+                           _f_C, _f_C->version);
+#endif /* defined(PARSEC_DEBUG_NOISIER) */
+    }
+  /** Cache Awareness Accounting */
+#if defined(PARSEC_CACHE_AWARENESS)
+  cache_buf_referenced(es->closest_cache, C);
+  cache_buf_referenced(es->closest_cache, A);
+  cache_buf_referenced(es->closest_cache, B);
+#endif /* PARSEC_CACHE_AWARENESS */
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                                  reduce BODY                                  -----*/
+
+  printf( "reduce(level = %d, process = %d) %d %d (p [%d .. %d])\n",
+          l, p, p * (1 << l), p * (1 << l) + (1 << (l-1)), 0, (MT / (1<<l)) );
+
+/*-----                              END OF reduce BODY                              -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#endif  /*  defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+static int complete_hook_of_reduce_reduce(parsec_execution_stream_t *es, __parsec_reduce_reduce_task_t *this_task)
+{
+  const __parsec_reduce_internal_taskpool_t *__parsec_tp = (__parsec_reduce_internal_taskpool_t *)this_task->taskpool;
+#if defined(DISTRIBUTED)
+    const int l = this_task->locals.l.value; (void)l;
+  const int p = this_task->locals.p.value; (void)p;
+#endif  /* defined(DISTRIBUTED) */
+  (void)es; (void)__parsec_tp;
+parsec_data_t* data_t_desc = NULL; (void)data_t_desc;
+#if defined(DISTRIBUTED)
+  /** If not working on distributed, there is no risk that data is not in place */
+  if( ((depth + 1)) == (l) ) {
+    data_t_desc = data_of_R(p, 0);
+    if( (NULL != this_task->data._f_C.data_out) && (this_task->data._f_C.data_out->original != data_t_desc) ) {
+      /* Writting back using remote_type */;
+      parsec_dep_data_description_t data;
+      data.data         = this_task->data._f_C.data_out;
+      data.local.arena        = NULL;
+      data.local.src_datatype = data.data->dtt;
+      data.local.src_count    = 1;
+      data.local.src_displ    = 0;
+      data.local.dst_datatype = parsec_data_get_copy(data_t_desc, 0)->dtt;
+      data.local.dst_count    = 1;
+      data.local.dst_displ    = 0;
+      data.data_future  = NULL;
+      assert( data.local.src_count > 0 );
+      parsec_remote_dep_memcpy(es,
+                              this_task->taskpool,
+                              parsec_data_get_copy(data_of_R(p, 0), 0),
+                              this_task->data._f_C.data_out, &data);
+    }
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+    parsec_prof_grapher_data_output((parsec_task_t*)this_task, data_of_R(p, 0), &flow_of_reduce_reduce_for_C);
+#endif
+  }
+  (void)l;  (void)p;
+
+#endif /* DISTRIBUTED */
+#if defined(PARSEC_PROF_GRAPHER)
+  parsec_prof_grapher_task((parsec_task_t*)this_task, es->th_id, es->virtual_process->vp_id,
+     __jdf2c_key_fns_reduce.key_hash(this_task->task_class->make_key( (parsec_taskpool_t*)this_task->taskpool, ((parsec_task_t*)this_task)->locals), NULL));
+#endif  /* defined(PARSEC_PROF_GRAPHER) */
+  release_deps_of_reduce_reduce(es, this_task,
+      PARSEC_ACTION_RELEASE_REMOTE_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_REFS |
+      PARSEC_ACTION_RESHAPE_ON_RELEASE |
+      0x7,  /* mask of all dep_index */ 
+      NULL);
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static parsec_hook_return_t release_task_of_reduce_reduce(parsec_execution_stream_t *es, parsec_task_t *this_task)
+{
+    const __parsec_reduce_internal_taskpool_t *__parsec_tp =
+        (const __parsec_reduce_internal_taskpool_t *)this_task->taskpool;
+    parsec_hash_table_t *ht = (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[0];
+    parsec_key_t key = this_task->task_class->make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals);
+    parsec_hashable_dependency_t *hash_dep = (parsec_hashable_dependency_t *)parsec_hash_table_remove(ht, key);
+    parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);
+    return parsec_release_task_to_mempool_update_nbtasks(es, this_task);
+}
+
+static char *reduce_reduce_reduce_internal_init_deps_key_functions_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_reduce_internal_taskpool_t *__parsec_tp = (__parsec_reduce_internal_taskpool_t *)user_data;
+  int l = (__parsec_key) % __parsec_tp->reduce_l_range + __parsec_tp->reduce_l_min;
+  __parsec_key = __parsec_key / __parsec_tp->reduce_l_range;
+  int p = (__parsec_key) % __parsec_tp->reduce_p_range + __parsec_tp->reduce_p_min;
+  __parsec_key = __parsec_key / __parsec_tp->reduce_p_range;
+  snprintf(buffer, buffer_size, "reduce(%d, %d)", l, p);
+  return buffer;
+}
+
+static parsec_key_fn_t reduce_reduce_reduce_internal_init_deps_key_functions = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = reduce_reduce_reduce_internal_init_deps_key_functions_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/* Needs: min-max count-tasks iterate */
+static int reduce_reduce_internal_init(parsec_execution_stream_t * es, __parsec_reduce_reduce_task_t * this_task)
+{
+  __parsec_reduce_internal_taskpool_t *__parsec_tp = (__parsec_reduce_internal_taskpool_t*)this_task->taskpool;
+  int32_t nb_tasks = 0, saved_nb_tasks = 0;
+int32_t __l_min = 0x7fffffff, __l_max = 0;int32_t __jdf2c_l_min = 0x7fffffff, __jdf2c_l_max = 0;int32_t __p_min = 0x7fffffff, __p_max = 0;int32_t __jdf2c_p_min = 0x7fffffff, __jdf2c_p_max = 0;  __parsec_reduce_reduce_parsec_assignment_t assignments = {  .l.value = 0, .p.value = 0 };
+  int32_t  l,  p;
+  int32_t __jdf2c_l_start, __jdf2c_l_end, __jdf2c_l_inc;
+  int32_t __jdf2c_p_start, __jdf2c_p_end, __jdf2c_p_inc;
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+  PARSEC_PROFILING_TRACE(es->es_profile,
+                         this_task->taskpool->profiling_array[START_KEY(this_task->task_class->task_class_id)],
+                         0,
+                         this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    __jdf2c_l_start = 1;
+    __jdf2c_l_end = (depth + 1);
+    __jdf2c_l_inc = 1;
+    __l_min = parsec_imin(__jdf2c_l_start, __jdf2c_l_end);
+    __l_max = parsec_imax(__jdf2c_l_start, __jdf2c_l_end);
+    __jdf2c_l_min = parsec_imin(__jdf2c_l_min, __l_min);
+    __jdf2c_l_max = parsec_imax(__jdf2c_l_max, __l_max);
+    for(l =  __jdf2c_l_start;
+        l <= __jdf2c_l_end;
+        l += __jdf2c_l_inc) {
+    assignments.l.value = l;
+      __jdf2c_p_start = 0;
+      __jdf2c_p_end = (MT / (1 << l));
+      __jdf2c_p_inc = 1;
+      __p_min = parsec_imin(__jdf2c_p_start, __jdf2c_p_end);
+      __p_max = parsec_imax(__jdf2c_p_start, __jdf2c_p_end);
+      __jdf2c_p_min = parsec_imin(__jdf2c_p_min, __p_min);
+      __jdf2c_p_max = parsec_imax(__jdf2c_p_max, __p_max);
+      for(p =  __jdf2c_p_start;
+          p <= __jdf2c_p_end;
+          p += __jdf2c_p_inc) {
+      assignments.p.value = p;
+      if( !reduce_pred(l, p) ) continue;
+      nb_tasks++;
+    } /* Loop on normal range p */
+  } /* For loop of l */ 
+   if( 0 != nb_tasks ) {
+     (void)parsec_atomic_fetch_add_int32(&__parsec_tp->initial_number_tasks, nb_tasks);
+   }
+  /* Set the range variables for the collision-free hash-computation */
+  __parsec_tp->reduce_l_min   = __jdf2c_l_min;
+  __parsec_tp->reduce_l_range = (__jdf2c_l_max - __jdf2c_l_min) + 1;
+  __parsec_tp->reduce_p_min   = __jdf2c_p_min;
+  __parsec_tp->reduce_p_range = (__jdf2c_p_max - __jdf2c_p_min) + 1;
+    do {
+      this_task->super.list_next = (parsec_list_item_t*)__parsec_tp->startup_queue;
+    } while(!parsec_atomic_cas_ptr(&__parsec_tp->startup_queue, (parsec_list_item_t*)this_task->super.list_next, this_task));
+    this_task->status = PARSEC_TASK_STATUS_HOOK;
+
+  PARSEC_AYU_REGISTER_TASK(&reduce_reduce);
+  __parsec_tp->super.super.dependencies_array[0] = PARSEC_OBJ_NEW(parsec_hash_table_t);
+  parsec_hash_table_init(__parsec_tp->super.super.dependencies_array[0], offsetof(parsec_hashable_dependency_t, ht_item), 10, reduce_reduce_reduce_internal_init_deps_key_functions, this_task->taskpool);
+  __parsec_tp->repositories[0] = data_repo_create_nothreadsafe(nb_tasks, __jdf2c_key_fns_reduce, (parsec_taskpool_t*)__parsec_tp, 3);
+(void)saved_nb_tasks;
+(void)__l_min; (void)__l_max;(void)__p_min; (void)__p_max;  (void)__jdf2c_l_start; (void)__jdf2c_l_end; (void)__jdf2c_l_inc;  (void)__jdf2c_p_start; (void)__jdf2c_p_end; (void)__jdf2c_p_inc;  (void)assignments; (void)__parsec_tp; (void)es;
+  if(1 == parsec_atomic_fetch_dec_int32(&__parsec_tp->sync_point)) {
+    /* Last initialization task complete. Update the number of tasks. */
+    __parsec_tp->super.super.tdm.module->taskpool_addto_nb_tasks(&__parsec_tp->super.super, __parsec_tp->initial_number_tasks);
+    parsec_mfence();  /* write memory barrier to guarantee that the scheduler gets the correct number of tasks */
+    parsec_taskpool_enable((parsec_taskpool_t*)__parsec_tp, &__parsec_tp->startup_queue,
+                           (parsec_task_t*)this_task, es, __parsec_tp->super.super.nb_pending_actions);
+    __parsec_tp->super.super.tdm.module->taskpool_ready(&__parsec_tp->super.super);
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+    PARSEC_PROFILING_TRACE(es->es_profile,
+                           this_task->taskpool->profiling_array[2 * this_task->task_class->task_class_id + 1],
+                           0,
+                           this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    if( 1 >= __parsec_tp->super.super.nb_pending_actions ) {
+        /* if no tasks will be generated let's prevent the runtime from calling the hook and instead go directly to complete the task */
+        this_task->status = PARSEC_TASK_STATUS_COMPLETE;
+    }
+    return PARSEC_HOOK_RETURN_DONE;
+  }
+  return PARSEC_HOOK_RETURN_ASYNC;
+}
+
+static int __jdf2c_startup_reduce(parsec_execution_stream_t * es, __parsec_reduce_reduce_task_t *this_task)
+{
+  __parsec_reduce_reduce_task_t* new_task;
+  __parsec_reduce_internal_taskpool_t* __parsec_tp = (__parsec_reduce_internal_taskpool_t*)this_task->taskpool;
+  parsec_context_t *context = __parsec_tp->super.super.context;
+  int vpid = 0, nb_tasks = 0;
+  size_t total_nb_tasks = 0;
+  parsec_list_item_t* pready_ring[context->nb_vp];
+  int restore_context = 0;
+  int l = this_task->locals.l.value;  /* retrieve value saved during the last iteration */
+  int p = this_task->locals.p.value;  /* retrieve value saved during the last iteration */
+  for(int _i = 0; _i < context->nb_vp; pready_ring[_i++] = NULL );
+  if( 0 != this_task->locals.reserved[0].value ) {
+    this_task->locals.reserved[0].value = 1; /* reset the submission process */
+    restore_context = 1;
+    goto restore_context_0;
+  }
+  this_task->locals.reserved[0].value = 1; /* a sane default value */
+  for(this_task->locals.l.value = l = 1;
+      this_task->locals.l.value <= (depth + 1);
+      this_task->locals.l.value += 1, l = this_task->locals.l.value) {
+    for(this_task->locals.p.value = p = 0;
+        this_task->locals.p.value <= (MT / (1 << l));
+        this_task->locals.p.value += 1, p = this_task->locals.p.value) {
+      if( !reduce_pred(l, p) ) continue;
+  __parsec_reduce_reduce_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_reduce_reduce_parsec_assignment_t*)&this_task->locals;
+  (void)__jdf2c__tmp_locals;
+  /* Flow for C is always a memory reference */
+  if( (1) == (l) ) goto B_check_flow;
+  continue; /* All other cases are not startup tasks */
+ B_check_flow:
+  if( (((p * (1 << l)) + (1 << (l - 1)))) >= (MT) ) goto __jdf2c_done_check_flow;
+  if( ((1) == (l) && (((p * (1 << l)) + (1 << (l - 1)))) < (MT)) ) goto __jdf2c_done_check_flow;
+  if( ((1) != (l) && (((p * (1 << l)) + (1 << (l - 1)))) < (MT)) ) continue; /* C reduce() is not a memory reference for flow B */
+  continue; /* All other cases are not startup tasks */
+ __jdf2c_done_check_flow:
+      if( NULL != ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of ) {
+        vpid = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, p, 0);
+        assert(context->nb_vp >= vpid);
+      } else {
+        vpid = (vpid + 1) % context->nb_vp;  /* spread the initial joy */
+      }
+      new_task = (__parsec_reduce_reduce_task_t*)parsec_thread_mempool_allocate( context->virtual_processes[vpid]->execution_streams[0]->context_mempool );
+      PARSEC_OBJ_CONSTRUCT(new_task, parsec_task_t); /* construct called only when new, force-construct it again */
+      /* Copy only the valid elements from this_task to new_task one */
+      new_task->taskpool   = this_task->taskpool;
+      new_task->task_class = __parsec_tp->super.super.task_classes_array[reduce_reduce.task_class_id];
+      new_task->chore_mask   = PARSEC_DEV_ALL;
+      new_task->locals.l.value = this_task->locals.l.value;
+      new_task->locals.p.value = this_task->locals.p.value;
+      PARSEC_LIST_ITEM_SINGLETON(new_task);
+      new_task->priority = __parsec_tp->super.super.priority;
+      new_task->repo_entry = NULL;
+      new_task->data._f_C.source_repo_entry = NULL;
+      new_task->data._f_C.source_repo       = NULL;
+      new_task->data._f_C.data_in         = NULL;
+      new_task->data._f_C.data_out        = NULL;
+      new_task->data._f_C.fulfill         = 0;
+      new_task->data._f_A.source_repo_entry = NULL;
+      new_task->data._f_A.source_repo       = NULL;
+      new_task->data._f_A.data_in         = NULL;
+      new_task->data._f_A.data_out        = NULL;
+      new_task->data._f_A.fulfill         = 0;
+      new_task->data._f_B.source_repo_entry = NULL;
+      new_task->data._f_B.source_repo       = NULL;
+      new_task->data._f_B.data_in         = NULL;
+      new_task->data._f_B.data_out        = NULL;
+      new_task->data._f_B.fulfill         = 0;
+#if defined(PARSEC_DEBUG_NOISIER)
+      {
+        char tmp[128];
+        PARSEC_DEBUG_VERBOSE(10, parsec_debug_output, "Add startup task %s to vpid %d",
+               parsec_task_snprintf(tmp, 128, (parsec_task_t*)new_task), vpid);
+      }
+#endif
+      parsec_dependencies_mark_task_as_startup((parsec_task_t*)new_task, es);
+      pready_ring[vpid] = parsec_list_item_ring_push_sorted(pready_ring[vpid],
+                                                            (parsec_list_item_t*)new_task,
+                                                            parsec_execution_context_priority_comparator);
+      nb_tasks++;
+     restore_context_0:  /* we jump here just so that we have code after the label */
+      restore_context = 0;
+      (void)restore_context;
+      if( nb_tasks > this_task->locals.reserved[0].value ) {
+        if( (size_t)this_task->locals.reserved[0].value < parsec_task_startup_iter ) this_task->locals.reserved[0].value <<= 1;
+        __parsec_schedule_vp(es, (parsec_task_t**)pready_ring, 0);
+        total_nb_tasks += nb_tasks;
+        nb_tasks = 0;
+        if( total_nb_tasks > parsec_task_startup_chunk ) {  /* stop here and request to be rescheduled */
+          return PARSEC_HOOK_RETURN_AGAIN;
+        }
+      }
+    } /* Loop on normal range p */
+  } /* Loop on normal range l */
+  (void)vpid;
+  if( 0 != nb_tasks ) {
+    __parsec_schedule_vp(es, (parsec_task_t**)pready_ring, 0);
+    nb_tasks = 0;
+  }
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static const __parsec_chore_t __reduce_reduce_chores[] ={
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+    { .type     = PARSEC_DEV_CPU,
+      .evaluate = (parsec_evaluate_function_t*)NULL,
+      .hook     = (parsec_hook_t*)hook_of_reduce_reduce },
+#endif  /* defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+    { .type     = PARSEC_DEV_NONE,
+      .evaluate = NULL,
+      .hook     = (parsec_hook_t*)NULL },  /* End marker */
+};
+
+static const parsec_task_class_t reduce_reduce = {
+  .name = "reduce",
+  .task_class_id = 0,
+  .nb_flows = 3,
+  .nb_parameters = 2,
+  .nb_locals = 2,
+  .task_class_type = PARSEC_TASK_CLASS_TYPE_PTG,
+  .params = { &symb_reduce_reduce_l, &symb_reduce_reduce_p, NULL },
+  .locals = { &symb_reduce_reduce_l, &symb_reduce_reduce_p, NULL },
+  .data_affinity = (parsec_data_ref_fn_t*)affinity_of_reduce_reduce,
+  .initial_data = (parsec_data_ref_fn_t*)affinity_of_reduce_reduce,
+  .final_data = (parsec_data_ref_fn_t*)affinity_of_reduce_reduce,
+  .priority = NULL,
+  .properties = properties_of_reduce_reduce,
+#if MAX_PARAM_COUNT < 2  /* number of read flows of reduce */
+  #error Too many read flows for task reduce
+#endif  /* MAX_PARAM_COUNT */
+#if MAX_PARAM_COUNT < 1  /* number of write flows of reduce */
+  #error Too many write flows for task reduce
+#endif  /* MAX_PARAM_COUNT */
+  .in = { &flow_of_reduce_reduce_for_C, &flow_of_reduce_reduce_for_A, &flow_of_reduce_reduce_for_B, NULL },
+  .out = { &flow_of_reduce_reduce_for_C, NULL },
+  .flags = 0x0 | PARSEC_HAS_IN_IN_DEPENDENCIES | PARSEC_USE_DEPS_MASK,
+  .dependencies_goal = 0x7,
+  .make_key = __jdf2c_make_key_reduce,
+  .task_snprintf = parsec_task_snprintf,
+#if defined(PARSEC_PROF_TRACE)
+  .profile_info = &parsec_task_profile_info,
+#endif
+  .key_functions = &__jdf2c_key_fns_reduce,
+  .fini = (parsec_hook_t*)NULL,
+  .incarnations = __reduce_reduce_chores,
+  .find_deps = parsec_hash_find_deps,
+  .update_deps = parsec_update_deps_with_mask,
+  .iterate_successors = (parsec_traverse_function_t*)iterate_successors_of_reduce_reduce,
+  .iterate_predecessors = (parsec_traverse_function_t*)iterate_predecessors_of_reduce_reduce,
+  .release_deps = (parsec_release_deps_t*)release_deps_of_reduce_reduce,
+  .prepare_output = (parsec_hook_t*)NULL,
+  .prepare_input = (parsec_hook_t*)data_lookup_of_reduce_reduce,
+  .time_estimate = NULL,
+  .get_datatype = datatype_lookup_of_reduce_reduce,
+  .complete_execution = (parsec_hook_t*)complete_hook_of_reduce_reduce,
+  .release_task = &release_task_of_reduce_reduce,
+#if defined(PARSEC_SIM)
+  .sim_cost_fct = (parsec_sim_cost_fct_t*)NULL,
+#endif
+};
+
+
+static const parsec_task_class_t *reduce_task_classes[] = {
+  &reduce_reduce
+};
+
+static void reduce_startup(parsec_context_t *context, __parsec_reduce_internal_taskpool_t *__parsec_tp, parsec_list_item_t ** ready_tasks)
+{
+  uint32_t i, supported_dev = 0;
+ 
+  for( i = 0; i < parsec_nb_devices; i++ ) {
+    if( !(__parsec_tp->super.super.devices_index_mask & (1<<i)) ) continue;
+    parsec_device_module_t* device = parsec_mca_device_get(i);
+    parsec_data_collection_t* parsec_dc;
+ 
+    if(NULL == device) continue;
+    if(NULL != device->taskpool_register)
+      if( PARSEC_SUCCESS != device->taskpool_register(device, (parsec_taskpool_t*)__parsec_tp) ) {
+        parsec_debug_verbose(5, parsec_debug_output, "Device %s refused to register taskpool %p", device->name, __parsec_tp);
+        __parsec_tp->super.super.devices_index_mask &= ~(1 << device->device_index);
+        continue;
+      }
+    if(NULL != device->memory_register) {  /* Register all the data */
+      parsec_dc = (parsec_data_collection_t*)__parsec_tp->super._g_descA;
+      if( (NULL != parsec_dc->register_memory) &&
+          (PARSEC_SUCCESS != parsec_dc->register_memory(parsec_dc, device)) ) {
+        parsec_debug_verbose(3, parsec_debug_output, "Device %s refused to register memory for data %s (%p) from taskpool %p",
+                     device->name, parsec_dc->key_base, parsec_dc, __parsec_tp);
+        __parsec_tp->super.super.devices_index_mask &= ~(1 << device->device_index);
+      }
+      parsec_dc = (parsec_data_collection_t*)__parsec_tp->super._g_R;
+      if( (NULL != parsec_dc->register_memory) &&
+          (PARSEC_SUCCESS != parsec_dc->register_memory(parsec_dc, device)) ) {
+        parsec_debug_verbose(3, parsec_debug_output, "Device %s refused to register memory for data %s (%p) from taskpool %p",
+                     device->name, parsec_dc->key_base, parsec_dc, __parsec_tp);
+        __parsec_tp->super.super.devices_index_mask &= ~(1 << device->device_index);
+      }
+    }
+    supported_dev |= device->type;
+  }
+  /* Remove all the chores without a backend device */
+  for( i = 0; i < PARSEC_reduce_NB_TASK_CLASSES; i++ ) {
+    parsec_task_class_t* tc = (parsec_task_class_t*)__parsec_tp->super.super.task_classes_array[i];
+    __parsec_chore_t* chores = (__parsec_chore_t*)tc->incarnations;
+    uint32_t idx = 0, j;
+    for( j = 0; PARSEC_DEV_NONE != chores[j].type; j++ ) {
+      if( !(supported_dev & chores[j].type) ) continue;
+      if( j != idx ) {
+        chores[idx] = chores[j];
+        parsec_debug_verbose(20, parsec_debug_output, "Device type %i disabled for function %s"
+, chores[j].type, tc->name);
+      }
+      idx++;
+    }
+    chores[idx].type     = PARSEC_DEV_NONE;
+    chores[idx].evaluate = NULL;
+    chores[idx].hook     = NULL;
+    /* Create the initialization tasks for each taskclass */
+    parsec_task_t* task = (parsec_task_t*)parsec_thread_mempool_allocate(context->virtual_processes[0]->execution_streams[0]->context_mempool);
+    PARSEC_OBJ_CONSTRUCT(task, parsec_task_t); /* construct called only when new, force-construct it again */
+    task->taskpool = (parsec_taskpool_t *)__parsec_tp;
+    task->chore_mask = PARSEC_DEV_CPU;
+    memset(&task->locals, 0, sizeof(parsec_assignment_t) * MAX_LOCAL_COUNT);
+    PARSEC_LIST_ITEM_SINGLETON(task);
+    task->priority = -1;
+    task->task_class = task->taskpool->task_classes_array[PARSEC_reduce_NB_TASK_CLASSES + i];
+    int where = i % context->nb_vp;
+    if( NULL == ready_tasks[where] ) ready_tasks[where] = &task->super;
+    else ready_tasks[where] = parsec_list_item_ring_push(ready_tasks[where], &task->super);
+  }
+}
+static void __parsec_reduce_internal_destructor( __parsec_reduce_internal_taskpool_t *__parsec_tp )
+{
+  uint32_t i;
+  parsec_taskpool_unregister( &__parsec_tp->super.super );
+  if(NULL != __parsec_tp->super.super.tdm.module) __parsec_tp->super.super.tdm.module->unmonitor_taskpool(&__parsec_tp->super.super);
+  for( i = 0; i < (uint32_t)(2 * __parsec_tp->super.super.nb_task_classes); i++ ) {  /* Extra startup function added at the end */
+    parsec_task_class_t* tc = (parsec_task_class_t*)__parsec_tp->super.super.task_classes_array[i];
+    free((void*)tc->incarnations);
+    free(tc);
+  }
+  free(__parsec_tp->super.super.task_classes_array); __parsec_tp->super.super.task_classes_array = NULL;
+  __parsec_tp->super.super.nb_task_classes = 0;
+
+  for(i = 0; i < (uint32_t)__parsec_tp->super.arenas_datatypes_size; i++) {
+    if( NULL != __parsec_tp->super.arenas_datatypes[i].arena ) {
+      PARSEC_OBJ_RELEASE(__parsec_tp->super.arenas_datatypes[i].arena);
+    }
+  }
+  /* Destroy the data repositories for this object */
+   data_repo_destroy_nothreadsafe(__parsec_tp->repositories[0]);  /* reduce */
+  /* Release the dependencies arrays for this object */
+  parsec_hash_table_fini( (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[0] );
+  PARSEC_OBJ_RELEASE(__parsec_tp->super.super.dependencies_array[0]);
+  __parsec_tp->super.super.dependencies_array[0] = NULL;
+  free( __parsec_tp->super.super.dependencies_array );
+  __parsec_tp->super.super.dependencies_array = NULL;
+  /* Unregister all the data */
+  uint32_t _i;
+  for( _i = 0; _i < parsec_nb_devices; _i++ ) {
+    parsec_device_module_t* device;
+    parsec_data_collection_t* parsec_dc;
+    if(!(__parsec_tp->super.super.devices_index_mask & (1 << _i))) continue;
+    if((NULL == (device = parsec_mca_device_get(_i))) || (NULL == device->memory_unregister)) continue;
+    parsec_dc = (parsec_data_collection_t*)__parsec_tp->super._g_descA;
+  if( NULL != parsec_dc->unregister_memory ) { (void)parsec_dc->unregister_memory(parsec_dc, device); };
+  parsec_dc = (parsec_data_collection_t*)__parsec_tp->super._g_R;
+  if( NULL != parsec_dc->unregister_memory ) { (void)parsec_dc->unregister_memory(parsec_dc, device); };
+}
+  /* Unregister the taskpool from the devices */
+  for( i = 0; i < parsec_nb_devices; i++ ) {
+    if(!(__parsec_tp->super.super.devices_index_mask & (1 << i))) continue;
+    __parsec_tp->super.super.devices_index_mask ^= (1 << i);
+    parsec_device_module_t* device = parsec_mca_device_get(i);
+    if((NULL == device) || (NULL == device->taskpool_unregister)) continue;
+    if( PARSEC_SUCCESS != device->taskpool_unregister(device, &__parsec_tp->super.super) ) continue;
+  }
+  free(__parsec_tp->super.super.taskpool_name); __parsec_tp->super.super.taskpool_name = NULL;
+}
+
+void __parsec_reduce_internal_constructor(__parsec_reduce_internal_taskpool_t* __parsec_tp)
+{
+  parsec_task_class_t* tc;
+  uint32_t i, j;
+
+  __parsec_tp->super.super.nb_task_classes = PARSEC_reduce_NB_TASK_CLASSES;
+  __parsec_tp->super.super.devices_index_mask = PARSEC_DEVICES_ALL;
+  __parsec_tp->super.super.taskpool_name = strdup("reduce");
+  parsec_termdet_open_module(&__parsec_tp->super.super, "local");
+  __parsec_tp->super.super.tdm.module->monitor_taskpool(&__parsec_tp->super.super,
+                                                        parsec_taskpool_termination_detected);
+  __parsec_tp->super.super.update_nb_runtime_task = parsec_add_fetch_runtime_task;
+  __parsec_tp->super.super.dependencies_array = (void **)
+              calloc(__parsec_tp->super.super.nb_task_classes, sizeof(void*));
+  /* Twice the size to hold the startup tasks function_t */
+  __parsec_tp->super.super.task_classes_array = (const parsec_task_class_t**)
+              calloc((2 * PARSEC_reduce_NB_TASK_CLASSES + 1), sizeof(parsec_task_class_t*));
+  __parsec_tp->super.super.tdm.module->taskpool_addto_runtime_actions(&__parsec_tp->super.super, PARSEC_reduce_NB_TASK_CLASSES);  /* for the startup tasks */
+  __parsec_tp->super.super.taskpool_type = PARSEC_TASKPOOL_TYPE_PTG;
+  __parsec_tp->sync_point = __parsec_tp->super.super.nb_task_classes;
+  __parsec_tp->initial_number_tasks = 0;
+  __parsec_tp->startup_queue = NULL;
+  for( i = 0; i < __parsec_tp->super.super.nb_task_classes; i++ ) {
+    __parsec_tp->super.super.task_classes_array[i] = tc = malloc(sizeof(parsec_task_class_t));
+    memcpy(tc, reduce_task_classes[i], sizeof(parsec_task_class_t));
+    for( j = 0; PARSEC_DEV_NONE != tc->incarnations[j].type; j++);  /* compute the number of incarnations */
+    tc->incarnations = (__parsec_chore_t*)malloc((j+1) * sizeof(__parsec_chore_t));
+        memcpy((__parsec_chore_t*)tc->incarnations, reduce_task_classes[i]->incarnations, (j+1) * sizeof(__parsec_chore_t));
+
+    /* Add a placeholder for initialization and startup task */
+    __parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+i] = tc = (parsec_task_class_t*)malloc(sizeof(parsec_task_class_t));
+    memcpy(tc, (void*)&__parsec_generic_startup, sizeof(parsec_task_class_t));
+    tc->task_class_id = __parsec_tp->super.super.nb_task_classes + i;
+    tc->incarnations = (__parsec_chore_t*)malloc(2 * sizeof(__parsec_chore_t));
+    memcpy((__parsec_chore_t*)tc->incarnations, (void*)__parsec_generic_startup.incarnations, 2 * sizeof(__parsec_chore_t));
+    tc->release_task = parsec_release_task_to_mempool_and_count_as_runtime_tasks;
+  }
+  /* Startup task for reduce */
+  tc = (parsec_task_class_t *)__parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+0];
+  tc->name = "Startup for reduce";
+  tc->prepare_input = (parsec_hook_t*)reduce_reduce_internal_init;
+  ((__parsec_chore_t*)&tc->incarnations[0])->hook = (parsec_hook_t *)__jdf2c_startup_reduce;
+  /* Compute the number of arenas_datatypes: */
+  /*   PARSEC_reduce_DEFAULT_ARENA  ->  0 */
+  __parsec_tp->super.arenas_datatypes_size = 1;
+  memset(&__parsec_tp->super.arenas_datatypes[0], 0, __parsec_tp->super.arenas_datatypes_size*sizeof(parsec_arena_datatype_t));
+  /* If profiling is enabled, the keys for profiling */
+#  if defined(PARSEC_PROF_TRACE)
+  __parsec_tp->super.super.profiling_array = reduce_profiling_array;
+  if( -2 == reduce_profiling_array[0] ) {
+    #if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+parsec_profiling_add_dictionary_keyword("reduce::reduce::internal init", "fill:34D8D8",
+                                       0,
+                                       NULL,
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(reduce_reduce.task_class_id  + PARSEC_reduce_NB_TASK_CLASSES)/* reduce (internal init) start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(reduce_reduce.task_class_id  + PARSEC_reduce_NB_TASK_CLASSES)/* reduce (internal init) end key */]);
+#endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+parsec_profiling_add_dictionary_keyword("reduce::reduce", "fill:CC2828",
+                                       sizeof(parsec_task_prof_info_t)+2*sizeof(parsec_assignment_t),
+                                       "dc_key{uint64_t};priority{int32_t};dc_dataid{uint32_t};tcid{uint32_t};trc{int32_t};l{int32_t};p{int32_t}",
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(reduce_reduce.task_class_id) /* reduce start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(reduce_reduce.task_class_id) /* reduce end key */]);
+
+  }
+#  endif /* defined(PARSEC_PROF_TRACE) */
+  __parsec_tp->super.super.repo_array = __parsec_tp->repositories;
+  __parsec_tp->super.super.startup_hook = (parsec_startup_fn_t)reduce_startup;
+  (void)parsec_taskpool_reserve_id((parsec_taskpool_t*)__parsec_tp);
+}
+
+  /** Generate class declaration and instance using the above constructor and destructor */
+  PARSEC_OBJ_CLASS_DECLARATION(__parsec_reduce_internal_taskpool_t);
+  PARSEC_OBJ_CLASS_INSTANCE(__parsec_reduce_internal_taskpool_t, parsec_reduce_taskpool_t,
+                            __parsec_reduce_internal_constructor, __parsec_reduce_internal_destructor);
+
+#undef descA
+#undef R
+#undef MT
+#undef depth
+#undef ELEM_NEUTRE
+
+parsec_reduce_taskpool_t *parsec_reduce_new(parsec_tiled_matrix_t* descA /* data descA */, parsec_tiled_matrix_t* R /* data R */, void* ELEM_NEUTRE)
+{
+  __parsec_reduce_internal_taskpool_t *__parsec_tp = PARSEC_OBJ_NEW(__parsec_reduce_internal_taskpool_t);
+  /* Dump the hidden parameters with default values */
+  int MT;
+  int depth;
+  /* Now the Parameter-dependent structures: */
+  __parsec_tp->super._g_descA = descA;
+  __parsec_tp->super._g_R = R;
+  __parsec_tp->super._g_MT = MT = descA->mt;
+  __parsec_tp->super._g_depth = depth = (int)ceil(log(descA->mt) / log(2.0));
+  __parsec_tp->super._g_ELEM_NEUTRE = ELEM_NEUTRE;
+  PARSEC_AYU_REGISTER_TASK(&reduce_reduce);
+  __parsec_tp->super.super.startup_hook = (parsec_startup_fn_t)reduce_startup;
+  (void)parsec_taskpool_reserve_id((parsec_taskpool_t*)__parsec_tp);
+/* Prevent warnings related to not used hidden global variables */
+  (void)MT;  (void)depth;
+  return (parsec_reduce_taskpool_t*)__parsec_tp;
+}
+
+PARSEC_OBJ_CLASS_INSTANCE(parsec_reduce_taskpool_t, parsec_taskpool_t, NULL, NULL);
+
@@ -0,0 +1,65 @@
+#ifndef _reduce_h_
+#define _reduce_h_
+#include "parsec.h"
+#include "parsec/parsec_internal.h"
+#include "parsec/remote_dep.h"
+
+BEGIN_C_DECLS
+
+#define PARSEC_reduce_DEFAULT_ADT_IDX    0
+#define PARSEC_reduce_ADT_IDX_MAX       1
+typedef struct parsec_reduce_taskpool_s {
+  parsec_taskpool_t super;
+  /* The list of globals */
+  parsec_tiled_matrix_t* _g_descA /* data descA */;
+  parsec_tiled_matrix_t* _g_R /* data R */;
+  int _g_MT;
+  int _g_depth;
+  void* _g_ELEM_NEUTRE;
+  /* The array of datatypes (DEFAULT and co.) */
+  parsec_arena_datatype_t arenas_datatypes[PARSEC_reduce_ADT_IDX_MAX];
+  uint32_t arenas_datatypes_size;
+} parsec_reduce_taskpool_t;
+
+/** Beware that this object is not a superset of the internal object, and as a result
+ *  we should never create one directly. Instead we should rely on the creation of the
+ *  internal object (__parsec_reduce_taskpool_t).
+ */
+PARSEC_OBJ_CLASS_DECLARATION(parsec_reduce_taskpool_t);
+extern parsec_reduce_taskpool_t *parsec_reduce_new(parsec_tiled_matrix_t* _g_descA /* data descA */, parsec_tiled_matrix_t* _g_R /* data R */, void* _g_ELEM_NEUTRE);
+
+#if MAX_LOCAL_COUNT < 2  /* number of parameters and locals reduce */
+  #error Too many parameters and local variables (2 out of MAX_LOCAL_COUNT) for task reduce
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_reduce_reduce_assignment_s {
+  parsec_assignment_t l;
+  parsec_assignment_t p;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-2];
+} __parsec_reduce_reduce_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 3  /* total number of flows for task reduce */
+  #error Too many flows (3 out of MAX_PARAM_COUNT) for task reduce
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_reduce_reduce_data_s {
+  parsec_data_pair_t _f_C;
+  parsec_data_pair_t _f_A;
+  parsec_data_pair_t _f_B;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-3];
+} __parsec_reduce_reduce_data_t;
+
+typedef struct __parsec_reduce_reduce_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_reduce_reduce_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_reduce_reduce_data_s data;
+} __parsec_reduce_reduce_task_t;
+
+
+END_C_DECLS
+
+#endif /* _reduce_h_ */ 
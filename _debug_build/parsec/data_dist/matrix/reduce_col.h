@@ -0,0 +1,99 @@
+#ifndef _reduce_col_h_
+#define _reduce_col_h_
+#include "parsec.h"
+#include "parsec/parsec_internal.h"
+#include "parsec/remote_dep.h"
+
+BEGIN_C_DECLS
+
+#define PARSEC_reduce_col_DEFAULT_ADT_IDX    0
+#define PARSEC_reduce_col_ADT_IDX_MAX       1
+typedef struct parsec_reduce_col_taskpool_s {
+  parsec_taskpool_t super;
+  /* The list of globals */
+  int _g_depth;
+  const parsec_tiled_matrix_t* _g_src /* data src */;
+  parsec_tiled_matrix_t* _g_dest /* data dest */;
+  parsec_operator_t _g_operation;
+  void* _g_op_data;
+  int _g_IA;
+  int _g_JA;
+  int _g_M;
+  int _g_N;
+  /* The array of datatypes (DEFAULT and co.) */
+  parsec_arena_datatype_t arenas_datatypes[PARSEC_reduce_col_ADT_IDX_MAX];
+  uint32_t arenas_datatypes_size;
+} parsec_reduce_col_taskpool_t;
+
+/** Beware that this object is not a superset of the internal object, and as a result
+ *  we should never create one directly. Instead we should rely on the creation of the
+ *  internal object (__parsec_reduce_col_taskpool_t).
+ */
+PARSEC_OBJ_CLASS_DECLARATION(parsec_reduce_col_taskpool_t);
+extern parsec_reduce_col_taskpool_t *parsec_reduce_col_new(const parsec_tiled_matrix_t* _g_src /* data src */, parsec_tiled_matrix_t* _g_dest /* data dest */, parsec_operator_t _g_operation, void* _g_op_data, int _g_IA, int _g_JA, int _g_M, int _g_N);
+
+#if MAX_LOCAL_COUNT < 3  /* number of parameters and locals reduce_col */
+  #error Too many parameters and local variables (3 out of MAX_LOCAL_COUNT) for task reduce_col
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_reduce_col_reduce_col_assignment_s {
+  parsec_assignment_t level;
+  parsec_assignment_t index;
+  parsec_assignment_t col;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-3];
+} __parsec_reduce_col_reduce_col_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 2  /* total number of flows for task reduce_col */
+  #error Too many flows (2 out of MAX_PARAM_COUNT) for task reduce_col
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_reduce_col_reduce_col_data_s {
+  parsec_data_pair_t _f_Rtop;
+  parsec_data_pair_t _f_Rbottom;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-2];
+} __parsec_reduce_col_reduce_col_data_t;
+
+typedef struct __parsec_reduce_col_reduce_col_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_reduce_col_reduce_col_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_reduce_col_reduce_col_data_s data;
+} __parsec_reduce_col_reduce_col_task_t;
+
+
+#if MAX_LOCAL_COUNT < 2  /* number of parameters and locals reduce_in_col */
+  #error Too many parameters and local variables (2 out of MAX_LOCAL_COUNT) for task reduce_in_col
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_reduce_col_reduce_in_col_assignment_s {
+  parsec_assignment_t row;
+  parsec_assignment_t col;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-2];
+} __parsec_reduce_col_reduce_in_col_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 1  /* total number of flows for task reduce_in_col */
+  #error Too many flows (1 out of MAX_PARAM_COUNT) for task reduce_in_col
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_reduce_col_reduce_in_col_data_s {
+  parsec_data_pair_t _f_Rtop;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-1];
+} __parsec_reduce_col_reduce_in_col_data_t;
+
+typedef struct __parsec_reduce_col_reduce_in_col_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_reduce_col_reduce_in_col_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_reduce_col_reduce_in_col_data_s data;
+} __parsec_reduce_col_reduce_in_col_task_t;
+
+
+END_C_DECLS
+
+#endif /* _reduce_col_h_ */ 
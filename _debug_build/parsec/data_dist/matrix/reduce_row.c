@@ -0,0 +1,2683 @@
+#include "parsec.h"
+#include "parsec/parsec_internal.h"
+#include "parsec/ayudame.h"
+#include "parsec/execution_stream.h"
+#include "parsec/parsec_binary_profile.h"
+#include "parsec/mca/device/device_gpu.h"
+#if defined(PARSEC_HAVE_DEV_CUDA_SUPPORT)
+#include "parsec/mca/device/cuda/device_cuda.h"
+#endif  /* defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) */
+#if defined(PARSEC_HAVE_DEV_HIP_SUPPORT)
+#include "parsec/mca/device/hip/device_hip.h"
+#endif  /* defined(PARSEC_HAVE_DEV_HIP_SUPPORT) */
+#if defined(_MSC_VER) || defined(__MINGW32__)
+#  include <malloc.h>
+#else
+#  include <alloca.h>
+#endif  /* defined(_MSC_VER) || defined(__MINGW32__) */
+
+#define PARSEC_reduce_row_NB_TASK_CLASSES 2
+#define PARSEC_reduce_row_NB_DATA 2
+
+typedef struct __parsec_reduce_row_internal_taskpool_s __parsec_reduce_row_internal_taskpool_t;
+struct parsec_reduce_row_internal_taskpool_s;
+
+/** Predeclarations of the parsec_task_class_t */
+static const parsec_task_class_t reduce_row_reduce_row;
+static const parsec_task_class_t reduce_row_reduce_in_row;
+/** Predeclarations of the parameters */
+static const parsec_flow_t flow_of_reduce_row_reduce_row_for_Rtop;
+static const parsec_flow_t flow_of_reduce_row_reduce_row_for_Rbottom;
+static const parsec_flow_t flow_of_reduce_row_reduce_in_row_for_Rtop;
+/*
+ * Copyright (c) 2011-2022 The University of Tennessee and The University
+ *                         of Tennessee Research Foundation.  All rights
+ *                         reserved.
+ */
+
+#include <math.h>
+#include "parsec/runtime.h"
+#include "parsec/data_dist/matrix/matrix.h"
+#define PARSEC_reduce_row_DEFAULT_ADT    (&__parsec_tp->super.arenas_datatypes[PARSEC_reduce_row_DEFAULT_ADT_IDX])
+#include "reduce_row.h"
+
+struct __parsec_reduce_row_internal_taskpool_s {
+ parsec_reduce_row_taskpool_t super;
+ volatile int32_t sync_point;
+ volatile int32_t initial_number_tasks;
+ parsec_task_t* startup_queue;
+  /* The ranges to compute the hash key */
+  int reduce_row_level_min;
+  int reduce_row_level_range;
+  int reduce_row_index_min;
+  int reduce_row_index_range;
+  int reduce_row_column_min;
+  int reduce_row_column_range;
+  int reduce_in_row_index_min;
+  int reduce_in_row_index_range;
+  int reduce_in_row_column_min;
+  int reduce_in_row_column_range;
+  /* The list of data repositories  reduce_row  reduce_in_row */
+  data_repo_t* repositories[2];
+};
+
+#if defined(PARSEC_PROF_TRACE)
+#  if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+static int reduce_row_profiling_array[4*PARSEC_reduce_row_NB_TASK_CLASSES] = {-2}; /* 2 pairs (begin, end) per task, times two because each task class has an internal_init task */
+#  else /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+static int reduce_row_profiling_array[2*PARSEC_reduce_row_NB_TASK_CLASSES] = {-2}; /* 2 pairs (begin, end) per task */
+#  endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+#endif  /* defined(PARSEC_PROF_TRACE) */
+/* Globals */
+#define depth (__parsec_tp->super._g_depth)
+#define src __parsec_tp->super._g_src
+#define dest __parsec_tp->super._g_dest
+#define operation (__parsec_tp->super._g_operation)
+#define op_data (__parsec_tp->super._g_op_data)
+#define IA (__parsec_tp->super._g_IA)
+#define JA (__parsec_tp->super._g_JA)
+#define M (__parsec_tp->super._g_M)
+#define N (__parsec_tp->super._g_N)
+
+static inline int parsec_imin(int a, int b) { return (a <= b) ? a : b; };
+
+static inline int parsec_imax(int a, int b) { return (a >= b) ? a : b; };
+
+/* Data Access Macros */
+#define data_of_dest(dest_d0)  (((parsec_data_collection_t*)__parsec_tp->super._g_dest)->data_of((parsec_data_collection_t*)__parsec_tp->super._g_dest, (dest_d0)))
+#define data_of_src(src_d0, src_d1)  (((parsec_data_collection_t*)__parsec_tp->super._g_src)->data_of((parsec_data_collection_t*)__parsec_tp->super._g_src, (src_d0), (src_d1)))
+
+#define rank_of_dest(dest_d0)  (((parsec_data_collection_t*)__parsec_tp->super._g_dest)->rank_of((parsec_data_collection_t*)__parsec_tp->super._g_dest, (dest_d0)))
+#define rank_of_src(src_d0, src_d1)  (((parsec_data_collection_t*)__parsec_tp->super._g_src)->rank_of((parsec_data_collection_t*)__parsec_tp->super._g_src, (src_d0), (src_d1)))
+
+/* Functions Predicates */
+#define reduce_row_pred(level, index, column) (((parsec_data_collection_t*)(__parsec_tp->super._g_src))->myrank == rank_of_src((2 * index), column))
+#define reduce_in_row_pred(index, column) (((parsec_data_collection_t*)(__parsec_tp->super._g_src))->myrank == rank_of_src(index, 0))
+
+/* Data Repositories */
+#define reduce_row_repo (__parsec_tp->repositories[1])
+#define reduce_in_row_repo (__parsec_tp->repositories[0])
+/* Release dependencies output macro */
+#if defined(PARSEC_DEBUG_NOISIER)
+#define RELEASE_DEP_OUTPUT(ES, DEPO, TASKO, DEPI, TASKI, RSRC, RDST, DATA)\
+  do { \
+    char tmp1[128], tmp2[128]; (void)tmp1; (void)tmp2;\
+    PARSEC_DEBUG_VERBOSE(20, parsec_debug_output, "thread %d VP %d explore deps from %s:%s to %s:%s (from rank %d to %d) base ptr %p",\
+           (NULL != (ES) ? (ES)->th_id : -1), (NULL != (ES) ? (ES)->virtual_process->vp_id : -1),\
+           DEPO, parsec_task_snprintf(tmp1, 128, (parsec_task_t*)(TASKO)),\
+           DEPI, parsec_task_snprintf(tmp2, 128, (parsec_task_t*)(TASKI)), (RSRC), (RDST), (DATA));\
+  } while(0)
+#define ACQUIRE_FLOW(TASKI, DEPI, FUNO, DEPO, LOCALS, PTR)\
+  do { \
+    char tmp1[128], tmp2[128]; (void)tmp1; (void)tmp2;\
+    PARSEC_DEBUG_VERBOSE(20, parsec_debug_output, "task %s acquires flow %s from %s %s data ptr %p",\
+           parsec_task_snprintf(tmp1, 128, (parsec_task_t*)(TASKI)), (DEPI),\
+           (DEPO), parsec_snprintf_assignments(tmp2, 128, (FUNO), (parsec_assignment_t*)(LOCALS)), (PTR));\
+  } while(0)
+#else
+#define RELEASE_DEP_OUTPUT(ES, DEPO, TASKO, DEPI, TASKI, RSRC, RDST, DATA)
+#define ACQUIRE_FLOW(TASKI, DEPI, TASKO, DEPO, LOCALS, PTR)
+#endif
+static inline parsec_key_t __jdf2c_make_key_reduce_row(const parsec_taskpool_t *tp, const parsec_assignment_t *as)
+{
+  const __parsec_reduce_row_internal_taskpool_t *__parsec_tp = (const __parsec_reduce_row_internal_taskpool_t *)tp;
+  const __parsec_reduce_row_reduce_row_parsec_assignment_t *assignment = (const __parsec_reduce_row_reduce_row_parsec_assignment_t*)as;
+  uint64_t __parsec_id = 0;
+  __parsec_id += (assignment->level.value - __parsec_tp->reduce_row_level_min);
+  __parsec_id += (assignment->index.value - __parsec_tp->reduce_row_index_min) * __parsec_tp->reduce_row_level_range;
+  __parsec_id += (assignment->column.value - __parsec_tp->reduce_row_column_min) * __parsec_tp->reduce_row_level_range * __parsec_tp->reduce_row_index_range;
+  return (parsec_key_t)__parsec_id;
+}
+static char *__jdf2c_key_fns_reduce_row_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_reduce_row_internal_taskpool_t *__parsec_tp = (__parsec_reduce_row_internal_taskpool_t *)user_data;
+  int level = (__parsec_key) % __parsec_tp->reduce_row_level_range + __parsec_tp->reduce_row_level_min;
+  __parsec_key = __parsec_key / __parsec_tp->reduce_row_level_range;
+  int index = (__parsec_key) % __parsec_tp->reduce_row_index_range + __parsec_tp->reduce_row_index_min;
+  __parsec_key = __parsec_key / __parsec_tp->reduce_row_index_range;
+  int column = (__parsec_key) % __parsec_tp->reduce_row_column_range + __parsec_tp->reduce_row_column_min;
+  __parsec_key = __parsec_key / __parsec_tp->reduce_row_column_range;
+  snprintf(buffer, buffer_size, "reduce_row(%d, %d, %d)", level, index, column);
+  return buffer;
+}
+
+static parsec_key_fn_t __jdf2c_key_fns_reduce_row = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = __jdf2c_key_fns_reduce_row_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+static inline parsec_key_t __jdf2c_make_key_reduce_in_row(const parsec_taskpool_t *tp, const parsec_assignment_t *as)
+{
+  const __parsec_reduce_row_internal_taskpool_t *__parsec_tp = (const __parsec_reduce_row_internal_taskpool_t *)tp;
+  const __parsec_reduce_row_reduce_in_row_parsec_assignment_t *assignment = (const __parsec_reduce_row_reduce_in_row_parsec_assignment_t*)as;
+  uint64_t __parsec_id = 0;
+  __parsec_id += (assignment->index.value - __parsec_tp->reduce_in_row_index_min);
+  __parsec_id += (assignment->column.value - __parsec_tp->reduce_in_row_column_min) * __parsec_tp->reduce_in_row_index_range;
+  return (parsec_key_t)__parsec_id;
+}
+static char *__jdf2c_key_fns_reduce_in_row_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_reduce_row_internal_taskpool_t *__parsec_tp = (__parsec_reduce_row_internal_taskpool_t *)user_data;
+  int index = (__parsec_key) % __parsec_tp->reduce_in_row_index_range + __parsec_tp->reduce_in_row_index_min;
+  __parsec_key = __parsec_key / __parsec_tp->reduce_in_row_index_range;
+  int column = (__parsec_key) % __parsec_tp->reduce_in_row_column_range + __parsec_tp->reduce_in_row_column_min;
+  __parsec_key = __parsec_key / __parsec_tp->reduce_in_row_column_range;
+  snprintf(buffer, buffer_size, "reduce_in_row(%d, %d)", index, column);
+  return buffer;
+}
+
+static parsec_key_fn_t __jdf2c_key_fns_reduce_in_row = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = __jdf2c_key_fns_reduce_in_row_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/******                                  reduce_row                                  ******/
+
+static inline int32_t minexpr_of_symb_reduce_row_reduce_row_level_fct(const __parsec_reduce_row_internal_taskpool_t *__parsec_tp, const __parsec_reduce_row_reduce_row_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 1;
+}
+static const parsec_expr_t minexpr_of_symb_reduce_row_reduce_row_level = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_reduce_row_reduce_row_level_fct }
+                   }
+};
+static inline int maxexpr_of_symb_reduce_row_reduce_row_level_fct(const __parsec_reduce_row_internal_taskpool_t *__parsec_tp, const __parsec_reduce_row_reduce_row_parsec_assignment_t *locals)
+{
+  const int level = locals->level.value; (void)level;
+  const int index = locals->index.value; (void)index;
+  const int column = locals->column.value; (void)column;
+
+  (void)level;
+  (void)index;
+  (void)column;
+  (void)__parsec_tp; (void)locals;
+  return depth;
+}
+static const parsec_expr_t maxexpr_of_symb_reduce_row_reduce_row_level = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_reduce_row_reduce_row_level_fct }
+                   }
+};
+static const parsec_symbol_t symb_reduce_row_reduce_row_level = { .name = "level", .context_index = 0, .min = &minexpr_of_symb_reduce_row_reduce_row_level, .max = &maxexpr_of_symb_reduce_row_reduce_row_level, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int32_t minexpr_of_symb_reduce_row_reduce_row_index_fct(const __parsec_reduce_row_internal_taskpool_t *__parsec_tp, const __parsec_reduce_row_reduce_row_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_reduce_row_reduce_row_index = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_reduce_row_reduce_row_index_fct }
+                   }
+};
+static inline int maxexpr_of_symb_reduce_row_reduce_row_index_fct(const __parsec_reduce_row_internal_taskpool_t *__parsec_tp, const __parsec_reduce_row_reduce_row_parsec_assignment_t *locals)
+{
+  const int level = locals->level.value; (void)level;
+  const int index = locals->index.value; (void)index;
+  const int column = locals->column.value; (void)column;
+
+  (void)level;
+  (void)index;
+  (void)column;
+  (void)__parsec_tp; (void)locals;
+  return ((1 << (depth - level)) - 1);
+}
+static const parsec_expr_t maxexpr_of_symb_reduce_row_reduce_row_index = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_reduce_row_reduce_row_index_fct }
+                   }
+};
+static const parsec_symbol_t symb_reduce_row_reduce_row_index = { .name = "index", .context_index = 1, .min = &minexpr_of_symb_reduce_row_reduce_row_index, .max = &maxexpr_of_symb_reduce_row_reduce_row_index, .cst_inc = 1, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int minexpr_of_symb_reduce_row_reduce_row_column_fct(const __parsec_reduce_row_internal_taskpool_t *__parsec_tp, const __parsec_reduce_row_reduce_row_parsec_assignment_t *locals)
+{
+  const int level = locals->level.value; (void)level;
+  const int index = locals->index.value; (void)index;
+  const int column = locals->column.value; (void)column;
+
+  (void)level;
+  (void)index;
+  (void)column;
+  (void)__parsec_tp; (void)locals;
+  return IA;
+}
+static const parsec_expr_t minexpr_of_symb_reduce_row_reduce_row_column = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_reduce_row_reduce_row_column_fct }
+                   }
+};
+static inline int maxexpr_of_symb_reduce_row_reduce_row_column_fct(const __parsec_reduce_row_internal_taskpool_t *__parsec_tp, const __parsec_reduce_row_reduce_row_parsec_assignment_t *locals)
+{
+  const int level = locals->level.value; (void)level;
+  const int index = locals->index.value; (void)index;
+  const int column = locals->column.value; (void)column;
+
+  (void)level;
+  (void)index;
+  (void)column;
+  (void)__parsec_tp; (void)locals;
+  return N;
+}
+static const parsec_expr_t maxexpr_of_symb_reduce_row_reduce_row_column = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_reduce_row_reduce_row_column_fct }
+                   }
+};
+static const parsec_symbol_t symb_reduce_row_reduce_row_column = { .name = "column", .context_index = 2, .min = &minexpr_of_symb_reduce_row_reduce_row_column, .max = &maxexpr_of_symb_reduce_row_reduce_row_column, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int affinity_of_reduce_row_reduce_row(const __parsec_reduce_row_reduce_row_task_t *this_task,
+                     parsec_data_ref_t *ref)
+{
+    const __parsec_reduce_row_internal_taskpool_t *__parsec_tp = (const __parsec_reduce_row_internal_taskpool_t*)this_task->taskpool;
+  const int level = this_task->locals.level.value; (void)level;
+  const int index = this_task->locals.index.value; (void)index;
+  const int column = this_task->locals.column.value; (void)column;
+
+  /* Silent Warnings: should look into predicate to know what variables are usefull */
+  (void)level;
+  (void)index;
+  (void)column;
+  ref->dc = (parsec_data_collection_t *)__parsec_tp->super._g_src;
+  /* Compute data key */
+  ref->key = ref->dc->data_key(ref->dc, (2 * index), column);
+  return 1;
+}
+static const parsec_property_t properties_of_reduce_row_reduce_row[1] = {
+  {.name = NULL, .expr = NULL}
+};
+static inline int expr_of_cond_for_flow_of_reduce_row_reduce_row_for_Rtop_dep1_atline_56_iftrue_fct(const __parsec_reduce_row_internal_taskpool_t *__parsec_tp, const __parsec_reduce_row_reduce_row_parsec_assignment_t *locals)
+{
+  const int level = locals->level.value;
+  const int index = locals->index.value; (void)index;
+  const int column = locals->column.value; (void)column;
+
+  (void)level;
+  (void)index;
+  (void)column;
+  (void)__parsec_tp; (void)locals;
+  return (level) == (1);
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_reduce_row_reduce_row_for_Rtop_dep1_atline_56_iftrue = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_reduce_row_reduce_row_for_Rtop_dep1_atline_56_iftrue_fct }
+                   }
+};
+static const parsec_dep_t flow_of_reduce_row_reduce_row_for_Rtop_dep1_atline_56_iftrue = {
+  .cond = &expr_of_cond_for_flow_of_reduce_row_reduce_row_for_Rtop_dep1_atline_56_iftrue,  /* (level) == (1) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 0, /* reduce_row_reduce_in_row */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_reduce_row_reduce_in_row_for_Rtop,
+  .dep_index = 1,
+  .dep_datatype_index = 1,
+  .belongs_to = &flow_of_reduce_row_reduce_row_for_Rtop,
+};
+static inline int expr_of_cond_for_flow_of_reduce_row_reduce_row_for_Rtop_dep1_atline_56_iffalse_fct(const __parsec_reduce_row_internal_taskpool_t *__parsec_tp, const __parsec_reduce_row_reduce_row_parsec_assignment_t *locals)
+{
+  const int level = locals->level.value;
+  const int index = locals->index.value; (void)index;
+  const int column = locals->column.value; (void)column;
+
+  (void)level;
+  (void)index;
+  (void)column;
+  (void)__parsec_tp; (void)locals;
+  return !((level) == (1));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_reduce_row_reduce_row_for_Rtop_dep1_atline_56_iffalse = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_reduce_row_reduce_row_for_Rtop_dep1_atline_56_iffalse_fct }
+                   }
+};
+static const parsec_dep_t flow_of_reduce_row_reduce_row_for_Rtop_dep1_atline_56_iffalse = {
+  .cond = &expr_of_cond_for_flow_of_reduce_row_reduce_row_for_Rtop_dep1_atline_56_iffalse,  /* !(level) == (1) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 1, /* reduce_row_reduce_row */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_reduce_row_reduce_row_for_Rtop,
+  .dep_index = 1,
+  .dep_datatype_index = 1,
+  .belongs_to = &flow_of_reduce_row_reduce_row_for_Rtop,
+};
+static inline int expr_of_cond_for_flow_of_reduce_row_reduce_row_for_Rtop_dep2_atline_60_fct(const __parsec_reduce_row_internal_taskpool_t *__parsec_tp, const __parsec_reduce_row_reduce_row_parsec_assignment_t *locals)
+{
+  const int level = locals->level.value; (void)level;
+  const int index = locals->index.value;
+  const int column = locals->column.value; (void)column;
+
+  (void)level;
+  (void)index;
+  (void)column;
+  (void)__parsec_tp; (void)locals;
+  return (0) == ((index % 2));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_reduce_row_reduce_row_for_Rtop_dep2_atline_60 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_reduce_row_reduce_row_for_Rtop_dep2_atline_60_fct }
+                   }
+};
+static const parsec_dep_t flow_of_reduce_row_reduce_row_for_Rtop_dep2_atline_60 = {
+  .cond = &expr_of_cond_for_flow_of_reduce_row_reduce_row_for_Rtop_dep2_atline_60,  /* (0) == ((index % 2)) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 1, /* reduce_row_reduce_row */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_reduce_row_reduce_row_for_Rtop,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_reduce_row_reduce_row_for_Rtop,
+};
+static inline int expr_of_cond_for_flow_of_reduce_row_reduce_row_for_Rtop_dep3_atline_63_fct(const __parsec_reduce_row_internal_taskpool_t *__parsec_tp, const __parsec_reduce_row_reduce_row_parsec_assignment_t *locals)
+{
+  const int level = locals->level.value; (void)level;
+  const int index = locals->index.value;
+  const int column = locals->column.value; (void)column;
+
+  (void)level;
+  (void)index;
+  (void)column;
+  (void)__parsec_tp; (void)locals;
+  return (1) == ((index % 2));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_reduce_row_reduce_row_for_Rtop_dep3_atline_63 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_reduce_row_reduce_row_for_Rtop_dep3_atline_63_fct }
+                   }
+};
+static const parsec_dep_t flow_of_reduce_row_reduce_row_for_Rtop_dep3_atline_63 = {
+  .cond = &expr_of_cond_for_flow_of_reduce_row_reduce_row_for_Rtop_dep3_atline_63,  /* (1) == ((index % 2)) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 1, /* reduce_row_reduce_row */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_reduce_row_reduce_row_for_Rbottom,
+  .dep_index = 1,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_reduce_row_reduce_row_for_Rtop,
+};
+static inline int expr_of_cond_for_flow_of_reduce_row_reduce_row_for_Rtop_dep4_atline_66_fct(const __parsec_reduce_row_internal_taskpool_t *__parsec_tp, const __parsec_reduce_row_reduce_row_parsec_assignment_t *locals)
+{
+  const int level = locals->level.value; (void)level;
+  const int index = locals->index.value; (void)index;
+  const int column = locals->column.value; (void)column;
+
+  (void)level;
+  (void)index;
+  (void)column;
+  (void)__parsec_tp; (void)locals;
+  return (level) == (depth);
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_reduce_row_reduce_row_for_Rtop_dep4_atline_66 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_reduce_row_reduce_row_for_Rtop_dep4_atline_66_fct }
+                   }
+};
+static parsec_data_t *flow_of_reduce_row_reduce_row_for_Rtop_dep4_atline_66_direct_access(const __parsec_reduce_row_internal_taskpool_t *__parsec_tp, const __parsec_reduce_row_reduce_row_parsec_assignment_t *assignments)
+{
+  const int level = assignments->level.value; (void)level;
+  const int index = assignments->index.value; (void)index;
+  const int column = assignments->column.value; (void)column;
+
+  /* Silence Warnings: should look into parameters to know what variables are useful */
+  (void)level;
+  (void)index;
+  (void)column;
+  if( __parsec_tp->super.super.context->my_rank == (int32_t)rank_of_dest(column) )
+    return data_of_dest(column);
+  return NULL;
+}
+
+static const parsec_dep_t flow_of_reduce_row_reduce_row_for_Rtop_dep4_atline_66 = {
+  .cond = &expr_of_cond_for_flow_of_reduce_row_reduce_row_for_Rtop_dep4_atline_66,  /* (level) == (depth) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = PARSEC_LOCAL_DATA_TASK_CLASS_ID, /* reduce_row_dest */
+  .direct_data = (parsec_data_lookup_func_t)&flow_of_reduce_row_reduce_row_for_Rtop_dep4_atline_66_direct_access,
+  .flags = PARSEC_DEP_FINAL_WRITE_AS_IS,
+  .dep_index = 2,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_reduce_row_reduce_row_for_Rtop,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+#if MAX_DEP_OUT_COUNT < 3  /* number of output dependencies */
+    #error Too many output dependencies (supports up to MAX_DEP_OUT_COUNT [=10] but found 3). Fix the code or recompile PaRSEC with a larger MAX_DEP_OUT_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_reduce_row_reduce_row_for_Rtop = {
+  .name               = "Rtop",
+  .sym_type           = PARSEC_SYM_INOUT,
+  .flow_flags         = PARSEC_FLOW_ACCESS_RW,
+  .flow_index         = 0,
+  .flow_datatype_mask = 0x1,
+  .dep_in     = { &flow_of_reduce_row_reduce_row_for_Rtop_dep1_atline_56_iftrue,
+ &flow_of_reduce_row_reduce_row_for_Rtop_dep1_atline_56_iffalse },
+  .dep_out    = { &flow_of_reduce_row_reduce_row_for_Rtop_dep2_atline_60,
+ &flow_of_reduce_row_reduce_row_for_Rtop_dep3_atline_63,
+ &flow_of_reduce_row_reduce_row_for_Rtop_dep4_atline_66 }
+};
+
+static inline int expr_of_cond_for_flow_of_reduce_row_reduce_row_for_Rbottom_dep1_atline_52_iftrue_fct(const __parsec_reduce_row_internal_taskpool_t *__parsec_tp, const __parsec_reduce_row_reduce_row_parsec_assignment_t *locals)
+{
+  const int level = locals->level.value;
+  const int index = locals->index.value; (void)index;
+  const int column = locals->column.value; (void)column;
+
+  (void)level;
+  (void)index;
+  (void)column;
+  (void)__parsec_tp; (void)locals;
+  return (level) == (1);
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_reduce_row_reduce_row_for_Rbottom_dep1_atline_52_iftrue = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_reduce_row_reduce_row_for_Rbottom_dep1_atline_52_iftrue_fct }
+                   }
+};
+static const parsec_dep_t flow_of_reduce_row_reduce_row_for_Rbottom_dep1_atline_52_iftrue = {
+  .cond = &expr_of_cond_for_flow_of_reduce_row_reduce_row_for_Rbottom_dep1_atline_52_iftrue,  /* (level) == (1) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 0, /* reduce_row_reduce_in_row */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_reduce_row_reduce_in_row_for_Rtop,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_reduce_row_reduce_row_for_Rbottom,
+};
+static inline int expr_of_cond_for_flow_of_reduce_row_reduce_row_for_Rbottom_dep1_atline_52_iffalse_fct(const __parsec_reduce_row_internal_taskpool_t *__parsec_tp, const __parsec_reduce_row_reduce_row_parsec_assignment_t *locals)
+{
+  const int level = locals->level.value;
+  const int index = locals->index.value; (void)index;
+  const int column = locals->column.value; (void)column;
+
+  (void)level;
+  (void)index;
+  (void)column;
+  (void)__parsec_tp; (void)locals;
+  return !((level) == (1));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_reduce_row_reduce_row_for_Rbottom_dep1_atline_52_iffalse = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_reduce_row_reduce_row_for_Rbottom_dep1_atline_52_iffalse_fct }
+                   }
+};
+static const parsec_dep_t flow_of_reduce_row_reduce_row_for_Rbottom_dep1_atline_52_iffalse = {
+  .cond = &expr_of_cond_for_flow_of_reduce_row_reduce_row_for_Rbottom_dep1_atline_52_iffalse,  /* !(level) == (1) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 1, /* reduce_row_reduce_row */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_reduce_row_reduce_row_for_Rtop,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_reduce_row_reduce_row_for_Rbottom,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_reduce_row_reduce_row_for_Rbottom = {
+  .name               = "Rbottom",
+  .sym_type           = PARSEC_SYM_IN,
+  .flow_flags         = PARSEC_FLOW_ACCESS_READ,
+  .flow_index         = 1,
+  .flow_datatype_mask = 0x0,
+  .dep_in     = { &flow_of_reduce_row_reduce_row_for_Rbottom_dep1_atline_52_iftrue,
+ &flow_of_reduce_row_reduce_row_for_Rbottom_dep1_atline_52_iffalse },
+  .dep_out    = { NULL }
+};
+
+static void
+iterate_successors_of_reduce_row_reduce_row(parsec_execution_stream_t *es, const __parsec_reduce_row_reduce_row_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_reduce_row_internal_taskpool_t *__parsec_tp = (const __parsec_reduce_row_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_reduce_row_reduce_row_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_reduce_row_reduce_row_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int level = __jdf2c__tmp_locals.level.value; (void)level;
+  const int index = __jdf2c__tmp_locals.index.value; (void)index;
+  const int column = __jdf2c__tmp_locals.column.value; (void)column;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)level;  (void)index;  (void)column;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_src((2 * index), column);
+#endif
+  if( action_mask & 0x7 ) {  /* Flow of data Rtop [0] */
+    data.data   = this_task->data._f_Rtop.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x1 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_reduce_row_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_reduce_row_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( (0) == ((index % 2)) ) {
+      __parsec_reduce_row_reduce_row_task_t* ncc = (__parsec_reduce_row_reduce_row_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[reduce_row_reduce_row.task_class_id];
+        const int reduce_row_level = (level + 1);
+        if( (reduce_row_level >= (1)) && (reduce_row_level <= (depth)) ) {
+          assert(&nc.locals[0].value == &ncc->locals.level.value);
+          ncc->locals.level.value = reduce_row_level;
+          const int reduce_row_index = (index / 2);
+          if( (reduce_row_index >= (0)) && (reduce_row_index <= (((1 << (depth - ncc->locals.level.value)) - 1))) ) {
+            assert(&nc.locals[1].value == &ncc->locals.index.value);
+            ncc->locals.index.value = reduce_row_index;
+            const int reduce_row_column = column;
+            if( (reduce_row_column >= (IA)) && (reduce_row_column <= (N)) ) {
+              assert(&nc.locals[2].value == &ncc->locals.column.value);
+              ncc->locals.column.value = reduce_row_column;
+#if defined(DISTRIBUTED)
+              rank_dst = rank_of_src((2 * ncc->locals.index.value), ncc->locals.column.value);
+              if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+                vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_src)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_src, (2 * ncc->locals.index.value), ncc->locals.column.value);
+              nc.priority = __parsec_tp->super.super.priority;
+              successor_repo = reduce_row_repo;
+              successor_repo_key = __jdf2c_make_key_reduce_row((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+            RELEASE_DEP_OUTPUT(es, "Rtop", this_task, "Rtop", &nc, rank_src, rank_dst, &data);
+            if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_reduce_row_reduce_row_for_Rtop_dep2_atline_60, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+              }
+            }
+          }
+    }
+  }
+  if( action_mask & 0x2 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_reduce_row_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_reduce_row_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( (1) == ((index % 2)) ) {
+      __parsec_reduce_row_reduce_row_task_t* ncc = (__parsec_reduce_row_reduce_row_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[reduce_row_reduce_row.task_class_id];
+        const int reduce_row_level = (level + 1);
+        if( (reduce_row_level >= (1)) && (reduce_row_level <= (depth)) ) {
+          assert(&nc.locals[0].value == &ncc->locals.level.value);
+          ncc->locals.level.value = reduce_row_level;
+          const int reduce_row_index = (index / 2);
+          if( (reduce_row_index >= (0)) && (reduce_row_index <= (((1 << (depth - ncc->locals.level.value)) - 1))) ) {
+            assert(&nc.locals[1].value == &ncc->locals.index.value);
+            ncc->locals.index.value = reduce_row_index;
+            const int reduce_row_column = column;
+            if( (reduce_row_column >= (IA)) && (reduce_row_column <= (N)) ) {
+              assert(&nc.locals[2].value == &ncc->locals.column.value);
+              ncc->locals.column.value = reduce_row_column;
+#if defined(DISTRIBUTED)
+              rank_dst = rank_of_src((2 * ncc->locals.index.value), ncc->locals.column.value);
+              if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+                vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_src)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_src, (2 * ncc->locals.index.value), ncc->locals.column.value);
+              nc.priority = __parsec_tp->super.super.priority;
+              successor_repo = reduce_row_repo;
+              successor_repo_key = __jdf2c_make_key_reduce_row((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+            RELEASE_DEP_OUTPUT(es, "Rtop", this_task, "Rbottom", &nc, rank_src, rank_dst, &data);
+            if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_reduce_row_reduce_row_for_Rtop_dep3_atline_63, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+              }
+            }
+          }
+    }
+  }
+    /* action_mask & 0x4 goes to data dest(column) */
+  }
+  /* Flow of data Rbottom has only IN dependencies */
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static void
+iterate_predecessors_of_reduce_row_reduce_row(parsec_execution_stream_t *es, const __parsec_reduce_row_reduce_row_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_reduce_row_internal_taskpool_t *__parsec_tp = (const __parsec_reduce_row_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_reduce_row_reduce_row_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_reduce_row_reduce_row_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int level = __jdf2c__tmp_locals.level.value; (void)level;
+  const int index = __jdf2c__tmp_locals.index.value; (void)index;
+  const int column = __jdf2c__tmp_locals.column.value; (void)column;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)level;  (void)index;  (void)column;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_src((2 * index), column);
+#endif
+  if( action_mask & 0x2 ) {  /* Flow of data Rtop [0] */
+    data.data   = this_task->data._f_Rtop.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x2 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_reduce_row_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_reduce_row_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( (level) == (1) ) {
+      __parsec_reduce_row_reduce_in_row_task_t* ncc = (__parsec_reduce_row_reduce_in_row_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[reduce_row_reduce_in_row.task_class_id];
+        const int reduce_in_row_index = (2 * index);
+        if( (reduce_in_row_index >= (0)) && (reduce_in_row_index <= (((1 << depth) - 1))) ) {
+          assert(&nc.locals[0].value == &ncc->locals.index.value);
+          ncc->locals.index.value = reduce_in_row_index;
+          const int reduce_in_row_column = column;
+          if( (reduce_in_row_column >= (IA)) && (reduce_in_row_column <= (N)) ) {
+            assert(&nc.locals[1].value == &ncc->locals.column.value);
+            ncc->locals.column.value = reduce_in_row_column;
+#if defined(DISTRIBUTED)
+            rank_dst = rank_of_src(ncc->locals.index.value, 0);
+            if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+              vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_src)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_src, ncc->locals.index.value, 0);
+            nc.priority = __parsec_tp->super.super.priority;
+            successor_repo = NULL;
+            successor_repo_key = 0;
+          RELEASE_DEP_OUTPUT(es, "Rtop", this_task, "Rtop", &nc, rank_src, rank_dst, &data);
+          if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_reduce_row_reduce_row_for_Rtop_dep1_atline_56_iftrue, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+            }
+          }
+    } else {
+      __parsec_reduce_row_reduce_row_task_t* ncc = (__parsec_reduce_row_reduce_row_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[reduce_row_reduce_row.task_class_id];
+        const int reduce_row_level = (level - 1);
+        if( (reduce_row_level >= (1)) && (reduce_row_level <= (depth)) ) {
+          assert(&nc.locals[0].value == &ncc->locals.level.value);
+          ncc->locals.level.value = reduce_row_level;
+          const int reduce_row_index = (2 * index);
+          if( (reduce_row_index >= (0)) && (reduce_row_index <= (((1 << (depth - ncc->locals.level.value)) - 1))) ) {
+            assert(&nc.locals[1].value == &ncc->locals.index.value);
+            ncc->locals.index.value = reduce_row_index;
+            const int reduce_row_column = column;
+            if( (reduce_row_column >= (IA)) && (reduce_row_column <= (N)) ) {
+              assert(&nc.locals[2].value == &ncc->locals.column.value);
+              ncc->locals.column.value = reduce_row_column;
+#if defined(DISTRIBUTED)
+              rank_dst = rank_of_src((2 * ncc->locals.index.value), ncc->locals.column.value);
+              if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+                vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_src)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_src, (2 * ncc->locals.index.value), ncc->locals.column.value);
+              nc.priority = __parsec_tp->super.super.priority;
+              successor_repo = reduce_row_repo;
+              successor_repo_key = __jdf2c_make_key_reduce_row((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+            RELEASE_DEP_OUTPUT(es, "Rtop", this_task, "Rtop", &nc, rank_src, rank_dst, &data);
+            if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_reduce_row_reduce_row_for_Rtop_dep1_atline_56_iffalse, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+              }
+            }
+          }
+    }
+  }
+  }
+  if( action_mask & 0x1 ) {  /* Flow of data Rbottom [1] */
+    data.data   = this_task->data._f_Rbottom.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x1 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_reduce_row_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_reduce_row_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( (level) == (1) ) {
+      __parsec_reduce_row_reduce_in_row_task_t* ncc = (__parsec_reduce_row_reduce_in_row_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[reduce_row_reduce_in_row.task_class_id];
+        const int reduce_in_row_index = ((2 * index) + 1);
+        if( (reduce_in_row_index >= (0)) && (reduce_in_row_index <= (((1 << depth) - 1))) ) {
+          assert(&nc.locals[0].value == &ncc->locals.index.value);
+          ncc->locals.index.value = reduce_in_row_index;
+          const int reduce_in_row_column = column;
+          if( (reduce_in_row_column >= (IA)) && (reduce_in_row_column <= (N)) ) {
+            assert(&nc.locals[1].value == &ncc->locals.column.value);
+            ncc->locals.column.value = reduce_in_row_column;
+#if defined(DISTRIBUTED)
+            rank_dst = rank_of_src(ncc->locals.index.value, 0);
+            if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+              vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_src)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_src, ncc->locals.index.value, 0);
+            nc.priority = __parsec_tp->super.super.priority;
+            successor_repo = NULL;
+            successor_repo_key = 0;
+          RELEASE_DEP_OUTPUT(es, "Rbottom", this_task, "Rtop", &nc, rank_src, rank_dst, &data);
+          if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_reduce_row_reduce_row_for_Rbottom_dep1_atline_52_iftrue, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+            }
+          }
+    } else {
+      __parsec_reduce_row_reduce_row_task_t* ncc = (__parsec_reduce_row_reduce_row_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[reduce_row_reduce_row.task_class_id];
+        const int reduce_row_level = (level - 1);
+        if( (reduce_row_level >= (1)) && (reduce_row_level <= (depth)) ) {
+          assert(&nc.locals[0].value == &ncc->locals.level.value);
+          ncc->locals.level.value = reduce_row_level;
+          const int reduce_row_index = ((2 * index) + 1);
+          if( (reduce_row_index >= (0)) && (reduce_row_index <= (((1 << (depth - ncc->locals.level.value)) - 1))) ) {
+            assert(&nc.locals[1].value == &ncc->locals.index.value);
+            ncc->locals.index.value = reduce_row_index;
+            const int reduce_row_column = column;
+            if( (reduce_row_column >= (IA)) && (reduce_row_column <= (N)) ) {
+              assert(&nc.locals[2].value == &ncc->locals.column.value);
+              ncc->locals.column.value = reduce_row_column;
+#if defined(DISTRIBUTED)
+              rank_dst = rank_of_src((2 * ncc->locals.index.value), ncc->locals.column.value);
+              if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+                vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_src)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_src, (2 * ncc->locals.index.value), ncc->locals.column.value);
+              nc.priority = __parsec_tp->super.super.priority;
+              successor_repo = reduce_row_repo;
+              successor_repo_key = __jdf2c_make_key_reduce_row((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+            RELEASE_DEP_OUTPUT(es, "Rbottom", this_task, "Rtop", &nc, rank_src, rank_dst, &data);
+            if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_reduce_row_reduce_row_for_Rbottom_dep1_atline_52_iffalse, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+              }
+            }
+          }
+    }
+  }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static int release_deps_of_reduce_row_reduce_row(parsec_execution_stream_t *es, __parsec_reduce_row_reduce_row_task_t *this_task, uint32_t action_mask, parsec_remote_deps_t *deps)
+{
+  PARSEC_PINS(es, RELEASE_DEPS_BEGIN, (parsec_task_t *)this_task);  const __parsec_reduce_row_internal_taskpool_t *__parsec_tp = (const __parsec_reduce_row_internal_taskpool_t *)this_task->taskpool;
+  parsec_release_dep_fct_arg_t arg;
+  int __vp_id;
+  int consume_local_repo = 0;
+  arg.action_mask = action_mask;
+  arg.output_entry = NULL;
+  arg.output_repo = NULL;
+#if defined(DISTRIBUTED)
+  arg.remote_deps = deps;
+#endif  /* defined(DISTRIBUTED) */
+  assert(NULL != es);
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS )    arg.ready_lists = alloca(sizeof(parsec_task_t *) * es->virtual_process->parsec_context->nb_vp);
+  else
+    arg.ready_lists = NULL;
+  for( __vp_id = 0; __vp_id < es->virtual_process->parsec_context->nb_vp; arg.ready_lists[__vp_id++] = NULL );
+  (void)__parsec_tp; (void)deps;
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_Rtop.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_Rtop.source_repo, this_task->data._f_Rtop.source_repo_entry->ht_item.key );
+    }
+    if( NULL != this_task->data._f_Rbottom.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_Rbottom.source_repo, this_task->data._f_Rbottom.source_repo_entry->ht_item.key );
+    }
+  }
+  consume_local_repo = (this_task->repo_entry != NULL);
+  arg.output_repo = reduce_row_repo;
+  arg.output_entry = this_task->repo_entry;
+  arg.output_usage = 0;
+  if( action_mask & (PARSEC_ACTION_RELEASE_LOCAL_DEPS | PARSEC_ACTION_GET_REPO_ENTRY) ) {
+    arg.output_entry = data_repo_lookup_entry_and_create( es, arg.output_repo, __jdf2c_make_key_reduce_row((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    arg.output_entry->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(arg.output_entry->sim_exec_date == 0);
+    arg.output_entry->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  if(action_mask & ( PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE ) ){
+    /* Generate the reshape promise for the outputs that need it */
+    iterate_successors_of_reduce_row_reduce_row(es, this_task, action_mask, parsec_set_up_reshape_promise, &arg);
+   }
+  iterate_successors_of_reduce_row_reduce_row(es, this_task, action_mask, parsec_release_dep_fct, &arg);
+
+#if defined(DISTRIBUTED)
+  if( (action_mask & PARSEC_ACTION_SEND_REMOTE_DEPS) && (NULL != arg.remote_deps)) {
+    parsec_remote_dep_activate(es, (parsec_task_t *)this_task, arg.remote_deps, arg.remote_deps->outgoing_mask);
+  }
+#endif
+
+  if(action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS) {
+    data_repo_entry_addto_usage_limit(reduce_row_repo, arg.output_entry->ht_item.key, arg.output_usage);
+    __parsec_schedule_vp(es, arg.ready_lists, 0);
+  }
+      if (consume_local_repo) {
+         data_repo_entry_used_once( reduce_row_repo, this_task->repo_entry->ht_item.key );
+      }
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_Rtop.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_Rtop.data_in);
+    }
+    if( NULL != this_task->data._f_Rbottom.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_Rbottom.data_in);
+    }
+  }
+  PARSEC_PINS(es, RELEASE_DEPS_END, (parsec_task_t *)this_task);  return 0;
+}
+
+static int data_lookup_of_reduce_row_reduce_row(parsec_execution_stream_t *es, __parsec_reduce_row_reduce_row_task_t *this_task)
+{
+  const __parsec_reduce_row_internal_taskpool_t *__parsec_tp = (__parsec_reduce_row_internal_taskpool_t *)this_task->taskpool;
+  parsec_assignment_t generic_locals[MAX_PARAM_COUNT];  /* generic task locals */
+  int target_device = 0; (void)target_device;
+  (void)__parsec_tp; (void)generic_locals; (void)es;
+  parsec_data_copy_t *chunk = NULL;
+  data_repo_t        *reshape_repo  = NULL, *consumed_repo  = NULL;
+  data_repo_entry_t  *reshape_entry = NULL, *consumed_entry = NULL;
+  parsec_key_t        reshape_entry_key = 0, consumed_entry_key = 0;
+  uint8_t             consumed_flow_index;
+  parsec_dep_data_description_t data;
+  int ret;
+  (void)reshape_repo; (void)reshape_entry; (void)reshape_entry_key;
+  (void)consumed_repo; (void)consumed_entry; (void)consumed_entry_key;
+  (void)consumed_flow_index;
+  (void)chunk; (void)data; (void)ret;
+  const int level = this_task->locals.level.value; (void)level;
+  const int index = this_task->locals.index.value; (void)index;
+  const int column = this_task->locals.column.value; (void)column;
+  if( NULL == this_task->repo_entry ){
+    this_task->repo_entry = data_repo_lookup_entry_and_create(es, reduce_row_repo,                                       __jdf2c_make_key_reduce_row((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    data_repo_entry_addto_usage_limit(reduce_row_repo, this_task->repo_entry->ht_item.key, 1);    this_task->repo_entry ->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(this_task->repo_entry ->sim_exec_date == 0);
+    this_task->repo_entry ->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  /* The reshape repo is the current task repo. */  reshape_repo = reduce_row_repo;
+  reshape_entry_key = __jdf2c_make_key_reduce_row((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals) ;
+  reshape_entry = this_task->repo_entry;
+  /* Lookup the input data, and store them in the context if any */
+
+if(! this_task->data._f_Rtop.fulfill ){ /* Flow Rtop */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_Rtop.data_out = NULL;  /* By default, if nothing matches */
+    if( (level) == (1) ) {
+    /* Flow Rtop [0] dependency [1] from predecessor reduce_in_row */
+    if( NULL == (chunk = this_task->data._f_Rtop.data_in) ) {
+    /* No data set up by predecessor on this task input flow */
+__parsec_reduce_row_reduce_in_row_parsec_assignment_t *target_locals = (__parsec_reduce_row_reduce_in_row_parsec_assignment_t*)&generic_locals;
+      const int reduce_in_rowindex = target_locals->index.value = (2 * index); (void)reduce_in_rowindex;
+      const int reduce_in_rowcolumn = target_locals->column.value = column; (void)reduce_in_rowcolumn;
+      if( (reshape_entry != NULL) && (reshape_entry->data[0] != NULL) ){
+          /* Reshape promise set up on this task repo by predecessor */
+          consumed_repo = reshape_repo;
+          consumed_entry = reshape_entry;
+          consumed_entry_key = reshape_entry_key;
+          consumed_flow_index = 0;
+      }else{
+          /* Consume from predecessor's repo */
+          consumed_repo = reduce_in_row_repo;
+          consumed_entry_key = __jdf2c_make_key_reduce_in_row((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)target_locals) ;
+          consumed_entry = data_repo_lookup_entry( consumed_repo, consumed_entry_key );
+          consumed_flow_index = 0;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      ACQUIRE_FLOW(this_task, "Rtop", &reduce_row_reduce_in_row, "Rtop", target_locals, chunk);
+      this_task->data._f_Rtop.data_out = chunk;
+    } 
+    else {
+      /* Data set up by predecessor on this task input flow */
+      consumed_repo = this_task->data._f_Rtop.source_repo;
+      consumed_entry = this_task->data._f_Rtop.source_repo_entry;
+      consumed_entry_key = this_task->data._f_Rtop.source_repo_entry->ht_item.key;
+      if( (reshape_entry != NULL) && (reshape_entry->data[0] != NULL) ){
+          /* Reshape promise set up on input by predecessor is on this task repo */
+          consumed_flow_index = 0;
+          assert( (this_task->data._f_Rtop.source_repo == reshape_repo)
+               && (this_task->data._f_Rtop.source_repo_entry == reshape_entry));
+      }else{
+          /* Reshape promise set up on input by predecessor is the predecesssor task repo */
+          consumed_flow_index = 0;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      this_task->data._f_Rtop.data_out = parsec_data_get_copy(chunk->original, target_device);
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+      parsec_prof_grapher_data_input(chunk->original, (parsec_task_t*)this_task, &flow_of_reduce_row_reduce_row_for_Rtop, 0);
+#endif
+    }
+    } else {
+    /* Flow Rtop [0] dependency [1] from predecessor reduce_row */
+    if( NULL == (chunk = this_task->data._f_Rtop.data_in) ) {
+    /* No data set up by predecessor on this task input flow */
+__parsec_reduce_row_reduce_row_parsec_assignment_t *target_locals = (__parsec_reduce_row_reduce_row_parsec_assignment_t*)&generic_locals;
+      const int reduce_rowlevel = target_locals->level.value = (level - 1); (void)reduce_rowlevel;
+      const int reduce_rowindex = target_locals->index.value = (2 * index); (void)reduce_rowindex;
+      const int reduce_rowcolumn = target_locals->column.value = column; (void)reduce_rowcolumn;
+      if( (reshape_entry != NULL) && (reshape_entry->data[0] != NULL) ){
+          /* Reshape promise set up on this task repo by predecessor */
+          consumed_repo = reshape_repo;
+          consumed_entry = reshape_entry;
+          consumed_entry_key = reshape_entry_key;
+          consumed_flow_index = 0;
+      }else{
+          /* Consume from predecessor's repo */
+          consumed_repo = reduce_row_repo;
+          consumed_entry_key = __jdf2c_make_key_reduce_row((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)target_locals) ;
+          consumed_entry = data_repo_lookup_entry( consumed_repo, consumed_entry_key );
+          consumed_flow_index = 0;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      ACQUIRE_FLOW(this_task, "Rtop", &reduce_row_reduce_row, "Rtop", target_locals, chunk);
+      this_task->data._f_Rtop.data_out = chunk;
+    } 
+    else {
+      /* Data set up by predecessor on this task input flow */
+      consumed_repo = this_task->data._f_Rtop.source_repo;
+      consumed_entry = this_task->data._f_Rtop.source_repo_entry;
+      consumed_entry_key = this_task->data._f_Rtop.source_repo_entry->ht_item.key;
+      if( (reshape_entry != NULL) && (reshape_entry->data[0] != NULL) ){
+          /* Reshape promise set up on input by predecessor is on this task repo */
+          consumed_flow_index = 0;
+          assert( (this_task->data._f_Rtop.source_repo == reshape_repo)
+               && (this_task->data._f_Rtop.source_repo_entry == reshape_entry));
+      }else{
+          /* Reshape promise set up on input by predecessor is the predecesssor task repo */
+          consumed_flow_index = 0;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      this_task->data._f_Rtop.data_out = parsec_data_get_copy(chunk->original, target_device);
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+      parsec_prof_grapher_data_input(chunk->original, (parsec_task_t*)this_task, &flow_of_reduce_row_reduce_row_for_Rtop, 0);
+#endif
+    }
+    }
+    this_task->data._f_Rtop.data_in     = chunk;
+    this_task->data._f_Rtop.source_repo       = consumed_repo;
+    this_task->data._f_Rtop.source_repo_entry = consumed_entry;
+    if( this_task->data._f_Rtop.source_repo_entry == this_task->repo_entry ){
+      /* in case we have consume from this task repo entry for the flow,
+       * it is cleaned up, avoiding having old stuff during release_deps_of
+       */
+      this_task->repo_entry->data[0] = NULL;
+    }
+    this_task->data._f_Rtop.fulfill = 1;
+}
+
+
+if(! this_task->data._f_Rbottom.fulfill ){ /* Flow Rbottom */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_Rbottom.data_out = NULL;  /* input only */
+    if( (level) == (1) ) {
+    /* Flow Rbottom [1] dependency [0] from predecessor reduce_in_row */
+    if( NULL == (chunk = this_task->data._f_Rbottom.data_in) ) {
+    /* No data set up by predecessor on this task input flow */
+__parsec_reduce_row_reduce_in_row_parsec_assignment_t *target_locals = (__parsec_reduce_row_reduce_in_row_parsec_assignment_t*)&generic_locals;
+      const int reduce_in_rowindex = target_locals->index.value = ((2 * index) + 1); (void)reduce_in_rowindex;
+      const int reduce_in_rowcolumn = target_locals->column.value = column; (void)reduce_in_rowcolumn;
+      if( (reshape_entry != NULL) && (reshape_entry->data[1] != NULL) ){
+          /* Reshape promise set up on this task repo by predecessor */
+          consumed_repo = reshape_repo;
+          consumed_entry = reshape_entry;
+          consumed_entry_key = reshape_entry_key;
+          consumed_flow_index = 1;
+      }else{
+          /* Consume from predecessor's repo */
+          consumed_repo = reduce_in_row_repo;
+          consumed_entry_key = __jdf2c_make_key_reduce_in_row((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)target_locals) ;
+          consumed_entry = data_repo_lookup_entry( consumed_repo, consumed_entry_key );
+          consumed_flow_index = 0;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 1, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      ACQUIRE_FLOW(this_task, "Rbottom", &reduce_row_reduce_in_row, "Rtop", target_locals, chunk);
+      this_task->data._f_Rbottom.data_out = chunk;
+    } 
+    else {
+      /* Data set up by predecessor on this task input flow */
+      consumed_repo = this_task->data._f_Rbottom.source_repo;
+      consumed_entry = this_task->data._f_Rbottom.source_repo_entry;
+      consumed_entry_key = this_task->data._f_Rbottom.source_repo_entry->ht_item.key;
+      if( (reshape_entry != NULL) && (reshape_entry->data[1] != NULL) ){
+          /* Reshape promise set up on input by predecessor is on this task repo */
+          consumed_flow_index = 1;
+          assert( (this_task->data._f_Rbottom.source_repo == reshape_repo)
+               && (this_task->data._f_Rbottom.source_repo_entry == reshape_entry));
+      }else{
+          /* Reshape promise set up on input by predecessor is the predecesssor task repo */
+          consumed_flow_index = 0;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 1, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      this_task->data._f_Rbottom.data_out = parsec_data_get_copy(chunk->original, target_device);
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+      parsec_prof_grapher_data_input(chunk->original, (parsec_task_t*)this_task, &flow_of_reduce_row_reduce_row_for_Rbottom, 0);
+#endif
+    }
+    } else {
+    /* Flow Rbottom [1] dependency [0] from predecessor reduce_row */
+    if( NULL == (chunk = this_task->data._f_Rbottom.data_in) ) {
+    /* No data set up by predecessor on this task input flow */
+__parsec_reduce_row_reduce_row_parsec_assignment_t *target_locals = (__parsec_reduce_row_reduce_row_parsec_assignment_t*)&generic_locals;
+      const int reduce_rowlevel = target_locals->level.value = (level - 1); (void)reduce_rowlevel;
+      const int reduce_rowindex = target_locals->index.value = ((2 * index) + 1); (void)reduce_rowindex;
+      const int reduce_rowcolumn = target_locals->column.value = column; (void)reduce_rowcolumn;
+      if( (reshape_entry != NULL) && (reshape_entry->data[1] != NULL) ){
+          /* Reshape promise set up on this task repo by predecessor */
+          consumed_repo = reshape_repo;
+          consumed_entry = reshape_entry;
+          consumed_entry_key = reshape_entry_key;
+          consumed_flow_index = 1;
+      }else{
+          /* Consume from predecessor's repo */
+          consumed_repo = reduce_row_repo;
+          consumed_entry_key = __jdf2c_make_key_reduce_row((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)target_locals) ;
+          consumed_entry = data_repo_lookup_entry( consumed_repo, consumed_entry_key );
+          consumed_flow_index = 0;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 1, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      ACQUIRE_FLOW(this_task, "Rbottom", &reduce_row_reduce_row, "Rtop", target_locals, chunk);
+      this_task->data._f_Rbottom.data_out = chunk;
+    } 
+    else {
+      /* Data set up by predecessor on this task input flow */
+      consumed_repo = this_task->data._f_Rbottom.source_repo;
+      consumed_entry = this_task->data._f_Rbottom.source_repo_entry;
+      consumed_entry_key = this_task->data._f_Rbottom.source_repo_entry->ht_item.key;
+      if( (reshape_entry != NULL) && (reshape_entry->data[1] != NULL) ){
+          /* Reshape promise set up on input by predecessor is on this task repo */
+          consumed_flow_index = 1;
+          assert( (this_task->data._f_Rbottom.source_repo == reshape_repo)
+               && (this_task->data._f_Rbottom.source_repo_entry == reshape_entry));
+      }else{
+          /* Reshape promise set up on input by predecessor is the predecesssor task repo */
+          consumed_flow_index = 0;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 1, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      this_task->data._f_Rbottom.data_out = parsec_data_get_copy(chunk->original, target_device);
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+      parsec_prof_grapher_data_input(chunk->original, (parsec_task_t*)this_task, &flow_of_reduce_row_reduce_row_for_Rbottom, 0);
+#endif
+    }
+    }
+    this_task->data._f_Rbottom.data_in     = chunk;
+    this_task->data._f_Rbottom.source_repo       = consumed_repo;
+    this_task->data._f_Rbottom.source_repo_entry = consumed_entry;
+    if( this_task->data._f_Rbottom.source_repo_entry == this_task->repo_entry ){
+      /* in case we have consume from this task repo entry for the flow,
+       * it is cleaned up, avoiding having old stuff during release_deps_of
+       */
+      this_task->repo_entry->data[1] = NULL;
+    }
+    this_task->data._f_Rbottom.fulfill = 1;
+}
+
+  /** Generate profiling information */
+#if defined(PARSEC_PROF_TRACE)
+  this_task->prof_info.desc = (parsec_data_collection_t*)__parsec_tp->super._g_src;
+  this_task->prof_info.priority = this_task->priority;
+  this_task->prof_info.data_id   = ((parsec_data_collection_t*)__parsec_tp->super._g_src)->data_key((parsec_data_collection_t*)__parsec_tp->super._g_src, (2 * index), column);
+  this_task->prof_info.task_class_id = this_task->task_class->task_class_id;
+  this_task->prof_info.task_return_code = -1;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int datatype_lookup_of_reduce_row_reduce_row(parsec_execution_stream_t *es, const parsec_task_t *this_generic_task, const parsec_task_t *parent_task,
+              uint32_t* flow_mask, parsec_dep_data_description_t* data)
+{
+  const __parsec_reduce_row_reduce_row_task_t *this_task = (__parsec_reduce_row_reduce_row_task_t*)this_generic_task;
+  const __parsec_reduce_row_internal_taskpool_t *__parsec_tp = (__parsec_reduce_row_internal_taskpool_t *)this_task->taskpool;
+  (void)__parsec_tp; (void)es; (void)this_task; (void)data; (void)parent_task;
+  const int level = this_task->locals.level.value; (void)level;
+  const int index = this_task->locals.index.value; (void)index;
+  const int column = this_task->locals.column.value; (void)column;
+  data->local.arena = data->remote.arena = NULL;
+  data->local.src_datatype  = data->local.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->local.src_count     = data->local.dst_count = 0;
+  data->local.src_displ     = data->local.dst_displ = 0;
+  data->data_future  = NULL;
+  if( (*flow_mask) & 0x80000000U ) { /* these are the input dependencies remote datatypes  */
+if( (*flow_mask) & 0x1U ) {  /* Flow Rtop */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_reduce_row_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_reduce_row_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_reduce_row_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+if( (*flow_mask) & 0x2U ) {  /* Flow Rbottom */
+    if( ((*flow_mask) & 0x2U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_reduce_row_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_reduce_row_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_reduce_row_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x2U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x2U) */
+    goto no_mask_match;
+  }
+
+  /* these are the output dependencies remote datatypes */
+if( (*flow_mask) & 0x7U ) {  /* Flow Rtop */
+    if( ((*flow_mask) & 0x7U)
+ && ((0) == ((index % 2)) || (1) == ((index % 2)) || (level) == (depth)) ) {
+    data->remote.arena  =  PARSEC_reduce_row_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_reduce_row_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_reduce_row_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x7U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x7U) */
+ no_mask_match:
+  data->data                             = NULL;
+  data->remote.src_datatype = data->remote.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->remote.src_count    = data->remote.dst_count = 0;
+  data->remote.src_displ    = data->remote.dst_displ = 0;
+  data->data_future  = NULL;
+  (*flow_mask) = 0;  /* nothing left */
+  (void)level;  (void)index;  (void)column;
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+static int hook_of_reduce_row_reduce_row(parsec_execution_stream_t *es, __parsec_reduce_row_reduce_row_task_t *this_task)
+{
+  __parsec_reduce_row_internal_taskpool_t *__parsec_tp = (__parsec_reduce_row_internal_taskpool_t *)this_task->taskpool;
+  (void)es; (void)__parsec_tp;
+  const int level = this_task->locals.level.value; (void)level;
+  const int index = this_task->locals.index.value; (void)index;
+  const int column = this_task->locals.column.value; (void)column;
+  (void)level;  (void)index;  (void)column;
+
+  /** Declare the variables that will hold the data, and all the accounting for each */
+  parsec_data_copy_t *_f_Rtop = this_task->data._f_Rtop.data_in;
+  void *Rtop = PARSEC_DATA_COPY_GET_PTR(_f_Rtop); (void)Rtop;
+  parsec_data_copy_t *_f_Rbottom = this_task->data._f_Rbottom.data_in;
+  void *Rbottom = PARSEC_DATA_COPY_GET_PTR(_f_Rbottom); (void)Rbottom;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    data_repo_entry_t *eRtop = this_task->data._f_Rtop.source_repo_entry;
+    if( (NULL != eRtop) && (eRtop->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eRtop->sim_exec_date;
+    data_repo_entry_t *eRbottom = this_task->data._f_Rbottom.source_repo_entry;
+    if( (NULL != eRbottom) && (eRbottom->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eRbottom->sim_exec_date;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+    if ( NULL != _f_Rtop ) {
+#if defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) || defined(PARSEC_HAVE_DEV_HIP_SUPPORT)
+      parsec_data_transfer_ownership_to_copy( _f_Rtop->original, 0 /* device */,
+                                           PARSEC_FLOW_ACCESS_RW);
+#endif  /* defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) || defined(PARSEC_HAVE_DEV_HIP_SUPPORT) */
+      _f_Rtop->version++;  /* Rtop */
+#if defined(PARSEC_DEBUG_NOISIER)
+      char tmp[128];
+      PARSEC_DEBUG_VERBOSE(10, parsec_debug_output,
+                           "Body of %s: change Data copy %p to version %d",
+                           parsec_task_snprintf(tmp, 128, (parsec_task_t*)(this_task)),
+                           _f_Rtop, _f_Rtop->version);
+#endif /* defined(PARSEC_DEBUG_NOISIER) */
+    }
+  /** Cache Awareness Accounting */
+#if defined(PARSEC_CACHE_AWARENESS)
+  cache_buf_referenced(es->closest_cache, Rtop);
+  cache_buf_referenced(es->closest_cache, Rbottom);
+#endif /* PARSEC_CACHE_AWARENESS */
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                                reduce_row BODY                                -----*/
+
+    printf( "reduce_row level: %i index: %i\n", level, index );
+
+/*-----                            END OF reduce_row BODY                            -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#endif  /*  defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+static int complete_hook_of_reduce_row_reduce_row(parsec_execution_stream_t *es, __parsec_reduce_row_reduce_row_task_t *this_task)
+{
+  const __parsec_reduce_row_internal_taskpool_t *__parsec_tp = (__parsec_reduce_row_internal_taskpool_t *)this_task->taskpool;
+#if defined(DISTRIBUTED)
+    const int level = this_task->locals.level.value; (void)level;
+  const int index = this_task->locals.index.value; (void)index;
+  const int column = this_task->locals.column.value; (void)column;
+#endif  /* defined(DISTRIBUTED) */
+  (void)es; (void)__parsec_tp;
+parsec_data_t* data_t_desc = NULL; (void)data_t_desc;
+#if defined(DISTRIBUTED)
+  /** If not working on distributed, there is no risk that data is not in place */
+  if( (level) == (depth) ) {
+    data_t_desc = data_of_dest(column);
+    if( (NULL != this_task->data._f_Rtop.data_out) && (this_task->data._f_Rtop.data_out->original != data_t_desc) ) {
+      /* Writting back using remote_type */;
+      parsec_dep_data_description_t data;
+      data.data         = this_task->data._f_Rtop.data_out;
+      data.local.arena        = NULL;
+      data.local.src_datatype = data.data->dtt;
+      data.local.src_count    = 1;
+      data.local.src_displ    = 0;
+      data.local.dst_datatype = parsec_data_get_copy(data_t_desc, 0)->dtt;
+      data.local.dst_count    = 1;
+      data.local.dst_displ    = 0;
+      data.data_future  = NULL;
+      assert( data.local.src_count > 0 );
+      parsec_remote_dep_memcpy(es,
+                              this_task->taskpool,
+                              parsec_data_get_copy(data_of_dest(column), 0),
+                              this_task->data._f_Rtop.data_out, &data);
+    }
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+    parsec_prof_grapher_data_output((parsec_task_t*)this_task, data_of_dest(column), &flow_of_reduce_row_reduce_row_for_Rtop);
+#endif
+  }
+  (void)level;  (void)index;  (void)column;
+
+#endif /* DISTRIBUTED */
+#if defined(PARSEC_PROF_GRAPHER)
+  parsec_prof_grapher_task((parsec_task_t*)this_task, es->th_id, es->virtual_process->vp_id,
+     __jdf2c_key_fns_reduce_row.key_hash(this_task->task_class->make_key( (parsec_taskpool_t*)this_task->taskpool, ((parsec_task_t*)this_task)->locals), NULL));
+#endif  /* defined(PARSEC_PROF_GRAPHER) */
+  release_deps_of_reduce_row_reduce_row(es, this_task,
+      PARSEC_ACTION_RELEASE_REMOTE_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_REFS |
+      PARSEC_ACTION_RESHAPE_ON_RELEASE |
+      0x7,  /* mask of all dep_index */ 
+      NULL);
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static parsec_hook_return_t release_task_of_reduce_row_reduce_row(parsec_execution_stream_t *es, parsec_task_t *this_task)
+{
+    const __parsec_reduce_row_internal_taskpool_t *__parsec_tp =
+        (const __parsec_reduce_row_internal_taskpool_t *)this_task->taskpool;
+    parsec_hash_table_t *ht = (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[1];
+    parsec_key_t key = this_task->task_class->make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals);
+    parsec_hashable_dependency_t *hash_dep = (parsec_hashable_dependency_t *)parsec_hash_table_remove(ht, key);
+    parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);
+    return parsec_release_task_to_mempool_update_nbtasks(es, this_task);
+}
+
+static char *reduce_row_reduce_row_reduce_row_internal_init_deps_key_functions_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_reduce_row_internal_taskpool_t *__parsec_tp = (__parsec_reduce_row_internal_taskpool_t *)user_data;
+  int level = (__parsec_key) % __parsec_tp->reduce_row_level_range + __parsec_tp->reduce_row_level_min;
+  __parsec_key = __parsec_key / __parsec_tp->reduce_row_level_range;
+  int index = (__parsec_key) % __parsec_tp->reduce_row_index_range + __parsec_tp->reduce_row_index_min;
+  __parsec_key = __parsec_key / __parsec_tp->reduce_row_index_range;
+  int column = (__parsec_key) % __parsec_tp->reduce_row_column_range + __parsec_tp->reduce_row_column_min;
+  __parsec_key = __parsec_key / __parsec_tp->reduce_row_column_range;
+  snprintf(buffer, buffer_size, "reduce_row(%d, %d, %d)", level, index, column);
+  return buffer;
+}
+
+static parsec_key_fn_t reduce_row_reduce_row_reduce_row_internal_init_deps_key_functions = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = reduce_row_reduce_row_reduce_row_internal_init_deps_key_functions_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/* Needs: min-max count-tasks iterate */
+static int reduce_row_reduce_row_internal_init(parsec_execution_stream_t * es, __parsec_reduce_row_reduce_row_task_t * this_task)
+{
+  __parsec_reduce_row_internal_taskpool_t *__parsec_tp = (__parsec_reduce_row_internal_taskpool_t*)this_task->taskpool;
+  int32_t nb_tasks = 0, saved_nb_tasks = 0;
+int32_t __level_min = 0x7fffffff, __level_max = 0;int32_t __jdf2c_level_min = 0x7fffffff, __jdf2c_level_max = 0;int32_t __index_min = 0x7fffffff, __index_max = 0;int32_t __jdf2c_index_min = 0x7fffffff, __jdf2c_index_max = 0;int32_t __column_min = 0x7fffffff, __column_max = 0;int32_t __jdf2c_column_min = 0x7fffffff, __jdf2c_column_max = 0;  __parsec_reduce_row_reduce_row_parsec_assignment_t assignments = {  .level.value = 0, .index.value = 0, .column.value = 0 };
+  int32_t  level,  index,  column;
+  int32_t __jdf2c_level_start, __jdf2c_level_end, __jdf2c_level_inc;
+  int32_t __jdf2c_index_start, __jdf2c_index_end, __jdf2c_index_inc;
+  int32_t __jdf2c_column_start, __jdf2c_column_end, __jdf2c_column_inc;
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+  PARSEC_PROFILING_TRACE(es->es_profile,
+                         this_task->taskpool->profiling_array[START_KEY(this_task->task_class->task_class_id)],
+                         0,
+                         this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    __jdf2c_level_start = 1;
+    __jdf2c_level_end = depth;
+    __jdf2c_level_inc = 1;
+    __level_min = parsec_imin(__jdf2c_level_start, __jdf2c_level_end);
+    __level_max = parsec_imax(__jdf2c_level_start, __jdf2c_level_end);
+    __jdf2c_level_min = parsec_imin(__jdf2c_level_min, __level_min);
+    __jdf2c_level_max = parsec_imax(__jdf2c_level_max, __level_max);
+    for(level =  __jdf2c_level_start;
+        level <= __jdf2c_level_end;
+        level += __jdf2c_level_inc) {
+    assignments.level.value = level;
+      __jdf2c_index_start = 0;
+      __jdf2c_index_end = ((1 << (depth - level)) - 1);
+      __jdf2c_index_inc = 1;
+      __index_min = parsec_imin(__jdf2c_index_start, __jdf2c_index_end);
+      __index_max = parsec_imax(__jdf2c_index_start, __jdf2c_index_end);
+      __jdf2c_index_min = parsec_imin(__jdf2c_index_min, __index_min);
+      __jdf2c_index_max = parsec_imax(__jdf2c_index_max, __index_max);
+      for(index =  __jdf2c_index_start;
+          index <= __jdf2c_index_end;
+          index += __jdf2c_index_inc) {
+      assignments.index.value = index;
+        __jdf2c_column_start = IA;
+        __jdf2c_column_end = N;
+        __jdf2c_column_inc = 1;
+        __column_min = parsec_imin(__jdf2c_column_start, __jdf2c_column_end);
+        __column_max = parsec_imax(__jdf2c_column_start, __jdf2c_column_end);
+        __jdf2c_column_min = parsec_imin(__jdf2c_column_min, __column_min);
+        __jdf2c_column_max = parsec_imax(__jdf2c_column_max, __column_max);
+        for(column =  __jdf2c_column_start;
+            column <= __jdf2c_column_end;
+            column += __jdf2c_column_inc) {
+        assignments.column.value = column;
+        if( !reduce_row_pred(level, index, column) ) continue;
+        nb_tasks++;
+      } /* Loop on normal range column */
+    } /* For loop of index */ 
+  } /* For loop of level */ 
+   if( 0 != nb_tasks ) {
+     (void)parsec_atomic_fetch_add_int32(&__parsec_tp->initial_number_tasks, nb_tasks);
+   }
+  /* Set the range variables for the collision-free hash-computation */
+  __parsec_tp->reduce_row_level_min   = __jdf2c_level_min;
+  __parsec_tp->reduce_row_level_range = (__jdf2c_level_max - __jdf2c_level_min) + 1;
+  __parsec_tp->reduce_row_index_min   = __jdf2c_index_min;
+  __parsec_tp->reduce_row_index_range = (__jdf2c_index_max - __jdf2c_index_min) + 1;
+  __parsec_tp->reduce_row_column_min   = __jdf2c_column_min;
+  __parsec_tp->reduce_row_column_range = (__jdf2c_column_max - __jdf2c_column_min) + 1;
+  this_task->status = PARSEC_TASK_STATUS_COMPLETE;
+
+  PARSEC_AYU_REGISTER_TASK(&reduce_row_reduce_row);
+  __parsec_tp->super.super.dependencies_array[1] = PARSEC_OBJ_NEW(parsec_hash_table_t);
+  parsec_hash_table_init(__parsec_tp->super.super.dependencies_array[1], offsetof(parsec_hashable_dependency_t, ht_item), 10, reduce_row_reduce_row_reduce_row_internal_init_deps_key_functions, this_task->taskpool);
+  __parsec_tp->repositories[1] = data_repo_create_nothreadsafe(nb_tasks, __jdf2c_key_fns_reduce_row, (parsec_taskpool_t*)__parsec_tp, 2);
+(void)saved_nb_tasks;
+(void)__level_min; (void)__level_max;(void)__index_min; (void)__index_max;(void)__column_min; (void)__column_max;  (void)__jdf2c_level_start; (void)__jdf2c_level_end; (void)__jdf2c_level_inc;  (void)__jdf2c_index_start; (void)__jdf2c_index_end; (void)__jdf2c_index_inc;  (void)__jdf2c_column_start; (void)__jdf2c_column_end; (void)__jdf2c_column_inc;  (void)assignments; (void)__parsec_tp; (void)es;
+  if(1 == parsec_atomic_fetch_dec_int32(&__parsec_tp->sync_point)) {
+    /* Last initialization task complete. Update the number of tasks. */
+    __parsec_tp->super.super.tdm.module->taskpool_addto_nb_tasks(&__parsec_tp->super.super, __parsec_tp->initial_number_tasks);
+    parsec_mfence();  /* write memory barrier to guarantee that the scheduler gets the correct number of tasks */
+    parsec_taskpool_enable((parsec_taskpool_t*)__parsec_tp, &__parsec_tp->startup_queue,
+                           (parsec_task_t*)this_task, es, __parsec_tp->super.super.nb_pending_actions);
+    __parsec_tp->super.super.tdm.module->taskpool_ready(&__parsec_tp->super.super);
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+    PARSEC_PROFILING_TRACE(es->es_profile,
+                           this_task->taskpool->profiling_array[2 * this_task->task_class->task_class_id + 1],
+                           0,
+                           this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    return PARSEC_HOOK_RETURN_DONE;
+  }
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static const __parsec_chore_t __reduce_row_reduce_row_chores[] ={
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+    { .type     = PARSEC_DEV_CPU,
+      .evaluate = (parsec_evaluate_function_t*)NULL,
+      .hook     = (parsec_hook_t*)hook_of_reduce_row_reduce_row },
+#endif  /* defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+    { .type     = PARSEC_DEV_NONE,
+      .evaluate = NULL,
+      .hook     = (parsec_hook_t*)NULL },  /* End marker */
+};
+
+static const parsec_task_class_t reduce_row_reduce_row = {
+  .name = "reduce_row",
+  .task_class_id = 1,
+  .nb_flows = 2,
+  .nb_parameters = 3,
+  .nb_locals = 3,
+  .task_class_type = PARSEC_TASK_CLASS_TYPE_PTG,
+  .params = { &symb_reduce_row_reduce_row_level, &symb_reduce_row_reduce_row_index, &symb_reduce_row_reduce_row_column, NULL },
+  .locals = { &symb_reduce_row_reduce_row_level, &symb_reduce_row_reduce_row_index, &symb_reduce_row_reduce_row_column, NULL },
+  .data_affinity = (parsec_data_ref_fn_t*)affinity_of_reduce_row_reduce_row,
+  .initial_data = (parsec_data_ref_fn_t*)affinity_of_reduce_row_reduce_row,
+  .final_data = (parsec_data_ref_fn_t*)affinity_of_reduce_row_reduce_row,
+  .priority = NULL,
+  .properties = properties_of_reduce_row_reduce_row,
+#if MAX_PARAM_COUNT < 2  /* number of read flows of reduce_row */
+  #error Too many read flows for task reduce_row
+#endif  /* MAX_PARAM_COUNT */
+#if MAX_PARAM_COUNT < 1  /* number of write flows of reduce_row */
+  #error Too many write flows for task reduce_row
+#endif  /* MAX_PARAM_COUNT */
+  .in = { &flow_of_reduce_row_reduce_row_for_Rtop, &flow_of_reduce_row_reduce_row_for_Rbottom, NULL },
+  .out = { &flow_of_reduce_row_reduce_row_for_Rtop, NULL },
+  .flags = 0x0 | PARSEC_USE_DEPS_MASK,
+  .dependencies_goal = 0x3,
+  .make_key = __jdf2c_make_key_reduce_row,
+  .task_snprintf = parsec_task_snprintf,
+#if defined(PARSEC_PROF_TRACE)
+  .profile_info = &parsec_task_profile_info,
+#endif
+  .key_functions = &__jdf2c_key_fns_reduce_row,
+  .fini = (parsec_hook_t*)NULL,
+  .incarnations = __reduce_row_reduce_row_chores,
+  .find_deps = parsec_hash_find_deps,
+  .update_deps = parsec_update_deps_with_mask,
+  .iterate_successors = (parsec_traverse_function_t*)iterate_successors_of_reduce_row_reduce_row,
+  .iterate_predecessors = (parsec_traverse_function_t*)iterate_predecessors_of_reduce_row_reduce_row,
+  .release_deps = (parsec_release_deps_t*)release_deps_of_reduce_row_reduce_row,
+  .prepare_output = (parsec_hook_t*)NULL,
+  .prepare_input = (parsec_hook_t*)data_lookup_of_reduce_row_reduce_row,
+  .time_estimate = NULL,
+  .get_datatype = datatype_lookup_of_reduce_row_reduce_row,
+  .complete_execution = (parsec_hook_t*)complete_hook_of_reduce_row_reduce_row,
+  .release_task = &release_task_of_reduce_row_reduce_row,
+#if defined(PARSEC_SIM)
+  .sim_cost_fct = (parsec_sim_cost_fct_t*)NULL,
+#endif
+};
+
+
+/******                                reduce_in_row                                  ******/
+
+static inline int32_t minexpr_of_symb_reduce_row_reduce_in_row_index_fct(const __parsec_reduce_row_internal_taskpool_t *__parsec_tp, const __parsec_reduce_row_reduce_in_row_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_reduce_row_reduce_in_row_index = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_reduce_row_reduce_in_row_index_fct }
+                   }
+};
+static inline int maxexpr_of_symb_reduce_row_reduce_in_row_index_fct(const __parsec_reduce_row_internal_taskpool_t *__parsec_tp, const __parsec_reduce_row_reduce_in_row_parsec_assignment_t *locals)
+{
+  const int index = locals->index.value; (void)index;
+  const int column = locals->column.value; (void)column;
+
+  (void)index;
+  (void)column;
+  (void)__parsec_tp; (void)locals;
+  return ((1 << depth) - 1);
+}
+static const parsec_expr_t maxexpr_of_symb_reduce_row_reduce_in_row_index = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_reduce_row_reduce_in_row_index_fct }
+                   }
+};
+static const parsec_symbol_t symb_reduce_row_reduce_in_row_index = { .name = "index", .context_index = 0, .min = &minexpr_of_symb_reduce_row_reduce_in_row_index, .max = &maxexpr_of_symb_reduce_row_reduce_in_row_index, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int minexpr_of_symb_reduce_row_reduce_in_row_column_fct(const __parsec_reduce_row_internal_taskpool_t *__parsec_tp, const __parsec_reduce_row_reduce_in_row_parsec_assignment_t *locals)
+{
+  const int index = locals->index.value; (void)index;
+  const int column = locals->column.value; (void)column;
+
+  (void)index;
+  (void)column;
+  (void)__parsec_tp; (void)locals;
+  return IA;
+}
+static const parsec_expr_t minexpr_of_symb_reduce_row_reduce_in_row_column = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_reduce_row_reduce_in_row_column_fct }
+                   }
+};
+static inline int maxexpr_of_symb_reduce_row_reduce_in_row_column_fct(const __parsec_reduce_row_internal_taskpool_t *__parsec_tp, const __parsec_reduce_row_reduce_in_row_parsec_assignment_t *locals)
+{
+  const int index = locals->index.value; (void)index;
+  const int column = locals->column.value; (void)column;
+
+  (void)index;
+  (void)column;
+  (void)__parsec_tp; (void)locals;
+  return N;
+}
+static const parsec_expr_t maxexpr_of_symb_reduce_row_reduce_in_row_column = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_reduce_row_reduce_in_row_column_fct }
+                   }
+};
+static const parsec_symbol_t symb_reduce_row_reduce_in_row_column = { .name = "column", .context_index = 1, .min = &minexpr_of_symb_reduce_row_reduce_in_row_column, .max = &maxexpr_of_symb_reduce_row_reduce_in_row_column, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int affinity_of_reduce_row_reduce_in_row(const __parsec_reduce_row_reduce_in_row_task_t *this_task,
+                     parsec_data_ref_t *ref)
+{
+    const __parsec_reduce_row_internal_taskpool_t *__parsec_tp = (const __parsec_reduce_row_internal_taskpool_t*)this_task->taskpool;
+  const int index = this_task->locals.index.value; (void)index;
+  const int column = this_task->locals.column.value; (void)column;
+
+  /* Silent Warnings: should look into predicate to know what variables are usefull */
+  (void)index;
+  (void)column;
+  ref->dc = (parsec_data_collection_t *)__parsec_tp->super._g_src;
+  /* Compute data key */
+  ref->key = ref->dc->data_key(ref->dc, index, 0);
+  return 1;
+}
+static const parsec_property_t properties_of_reduce_row_reduce_in_row[1] = {
+  {.name = NULL, .expr = NULL}
+};
+static parsec_data_t *flow_of_reduce_row_reduce_in_row_for_Rtop_dep1_atline_37_direct_access(const __parsec_reduce_row_internal_taskpool_t *__parsec_tp, const __parsec_reduce_row_reduce_in_row_parsec_assignment_t *assignments)
+{
+  const int index = assignments->index.value; (void)index;
+  const int column = assignments->column.value; (void)column;
+
+  /* Silence Warnings: should look into parameters to know what variables are useful */
+  (void)index;
+  (void)column;
+  if( __parsec_tp->super.super.context->my_rank == (int32_t)rank_of_src(index, 0) )
+    return data_of_src(index, 0);
+  return NULL;
+}
+
+static const parsec_dep_t flow_of_reduce_row_reduce_in_row_for_Rtop_dep1_atline_37 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = PARSEC_LOCAL_DATA_TASK_CLASS_ID, /* reduce_row_src */
+  .direct_data = (parsec_data_lookup_func_t)&flow_of_reduce_row_reduce_in_row_for_Rtop_dep1_atline_37_direct_access,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_reduce_row_reduce_in_row_for_Rtop,
+};
+static inline int expr_of_cond_for_flow_of_reduce_row_reduce_in_row_for_Rtop_dep2_atline_38_iftrue_fct(const __parsec_reduce_row_internal_taskpool_t *__parsec_tp, const __parsec_reduce_row_reduce_in_row_parsec_assignment_t *locals)
+{
+  const int index = locals->index.value;
+  const int column = locals->column.value; (void)column;
+
+  (void)index;
+  (void)column;
+  (void)__parsec_tp; (void)locals;
+  return ((index % 2)) == (0);
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_reduce_row_reduce_in_row_for_Rtop_dep2_atline_38_iftrue = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_reduce_row_reduce_in_row_for_Rtop_dep2_atline_38_iftrue_fct }
+                   }
+};
+static const parsec_dep_t flow_of_reduce_row_reduce_in_row_for_Rtop_dep2_atline_38_iftrue = {
+  .cond = &expr_of_cond_for_flow_of_reduce_row_reduce_in_row_for_Rtop_dep2_atline_38_iftrue,  /* ((index % 2)) == (0) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 1, /* reduce_row_reduce_row */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_reduce_row_reduce_row_for_Rtop,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_reduce_row_reduce_in_row_for_Rtop,
+};
+static inline int expr_of_cond_for_flow_of_reduce_row_reduce_in_row_for_Rtop_dep2_atline_38_iffalse_fct(const __parsec_reduce_row_internal_taskpool_t *__parsec_tp, const __parsec_reduce_row_reduce_in_row_parsec_assignment_t *locals)
+{
+  const int index = locals->index.value;
+  const int column = locals->column.value; (void)column;
+
+  (void)index;
+  (void)column;
+  (void)__parsec_tp; (void)locals;
+  return !(((index % 2)) == (0));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_reduce_row_reduce_in_row_for_Rtop_dep2_atline_38_iffalse = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_reduce_row_reduce_in_row_for_Rtop_dep2_atline_38_iffalse_fct }
+                   }
+};
+static const parsec_dep_t flow_of_reduce_row_reduce_in_row_for_Rtop_dep2_atline_38_iffalse = {
+  .cond = &expr_of_cond_for_flow_of_reduce_row_reduce_in_row_for_Rtop_dep2_atline_38_iffalse,  /* !((index % 2)) == (0) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 1, /* reduce_row_reduce_row */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_reduce_row_reduce_row_for_Rbottom,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_reduce_row_reduce_in_row_for_Rtop,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+#if MAX_DEP_OUT_COUNT < 1  /* number of output dependencies */
+    #error Too many output dependencies (supports up to MAX_DEP_OUT_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_OUT_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_reduce_row_reduce_in_row_for_Rtop = {
+  .name               = "Rtop",
+  .sym_type           = PARSEC_SYM_INOUT,
+  .flow_flags         = PARSEC_FLOW_ACCESS_READ|PARSEC_FLOW_HAS_IN_DEPS,
+  .flow_index         = 0,
+  .flow_datatype_mask = 0x1,
+  .dep_in     = { &flow_of_reduce_row_reduce_in_row_for_Rtop_dep1_atline_37 },
+  .dep_out    = { &flow_of_reduce_row_reduce_in_row_for_Rtop_dep2_atline_38_iftrue,
+ &flow_of_reduce_row_reduce_in_row_for_Rtop_dep2_atline_38_iffalse }
+};
+
+static void
+iterate_successors_of_reduce_row_reduce_in_row(parsec_execution_stream_t *es, const __parsec_reduce_row_reduce_in_row_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_reduce_row_internal_taskpool_t *__parsec_tp = (const __parsec_reduce_row_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_reduce_row_reduce_in_row_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_reduce_row_reduce_in_row_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int index = __jdf2c__tmp_locals.index.value; (void)index;
+  const int column = __jdf2c__tmp_locals.column.value; (void)column;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)index;  (void)column;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_src(index, 0);
+#endif
+  if( action_mask & 0x1 ) {  /* Flow of data Rtop [0] */
+    data.data   = this_task->data._f_Rtop.data_out;
+    data.data_future  = NULL;
+    if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_reduce_row_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_reduce_row_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+       if( ((index % 2)) == (0) ) {
+      __parsec_reduce_row_reduce_row_task_t* ncc = (__parsec_reduce_row_reduce_row_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[reduce_row_reduce_row.task_class_id];
+        const int reduce_row_level = 1;
+        if( (reduce_row_level >= (1)) && (reduce_row_level <= (depth)) ) {
+          assert(&nc.locals[0].value == &ncc->locals.level.value);
+          ncc->locals.level.value = reduce_row_level;
+          const int reduce_row_index = (index / 2);
+          if( (reduce_row_index >= (0)) && (reduce_row_index <= (((1 << (depth - ncc->locals.level.value)) - 1))) ) {
+            assert(&nc.locals[1].value == &ncc->locals.index.value);
+            ncc->locals.index.value = reduce_row_index;
+            const int reduce_row_column = column;
+            if( (reduce_row_column >= (IA)) && (reduce_row_column <= (N)) ) {
+              assert(&nc.locals[2].value == &ncc->locals.column.value);
+              ncc->locals.column.value = reduce_row_column;
+#if defined(DISTRIBUTED)
+              rank_dst = rank_of_src((2 * ncc->locals.index.value), ncc->locals.column.value);
+              if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+                vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_src)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_src, (2 * ncc->locals.index.value), ncc->locals.column.value);
+              nc.priority = __parsec_tp->super.super.priority;
+              successor_repo = reduce_row_repo;
+              successor_repo_key = __jdf2c_make_key_reduce_row((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+            RELEASE_DEP_OUTPUT(es, "Rtop", this_task, "Rtop", &nc, rank_src, rank_dst, &data);
+            if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_reduce_row_reduce_in_row_for_Rtop_dep2_atline_38_iftrue, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+              }
+            }
+          }
+    } else {
+      __parsec_reduce_row_reduce_row_task_t* ncc = (__parsec_reduce_row_reduce_row_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[reduce_row_reduce_row.task_class_id];
+        const int reduce_row_level = 1;
+        if( (reduce_row_level >= (1)) && (reduce_row_level <= (depth)) ) {
+          assert(&nc.locals[0].value == &ncc->locals.level.value);
+          ncc->locals.level.value = reduce_row_level;
+          const int reduce_row_index = (index / 2);
+          if( (reduce_row_index >= (0)) && (reduce_row_index <= (((1 << (depth - ncc->locals.level.value)) - 1))) ) {
+            assert(&nc.locals[1].value == &ncc->locals.index.value);
+            ncc->locals.index.value = reduce_row_index;
+            const int reduce_row_column = column;
+            if( (reduce_row_column >= (IA)) && (reduce_row_column <= (N)) ) {
+              assert(&nc.locals[2].value == &ncc->locals.column.value);
+              ncc->locals.column.value = reduce_row_column;
+#if defined(DISTRIBUTED)
+              rank_dst = rank_of_src((2 * ncc->locals.index.value), ncc->locals.column.value);
+              if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+                vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_src)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_src, (2 * ncc->locals.index.value), ncc->locals.column.value);
+              nc.priority = __parsec_tp->super.super.priority;
+              successor_repo = reduce_row_repo;
+              successor_repo_key = __jdf2c_make_key_reduce_row((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+            RELEASE_DEP_OUTPUT(es, "Rtop", this_task, "Rbottom", &nc, rank_src, rank_dst, &data);
+            if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_reduce_row_reduce_in_row_for_Rtop_dep2_atline_38_iffalse, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+              }
+            }
+          }
+    }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static int release_deps_of_reduce_row_reduce_in_row(parsec_execution_stream_t *es, __parsec_reduce_row_reduce_in_row_task_t *this_task, uint32_t action_mask, parsec_remote_deps_t *deps)
+{
+  PARSEC_PINS(es, RELEASE_DEPS_BEGIN, (parsec_task_t *)this_task);  const __parsec_reduce_row_internal_taskpool_t *__parsec_tp = (const __parsec_reduce_row_internal_taskpool_t *)this_task->taskpool;
+  parsec_release_dep_fct_arg_t arg;
+  int __vp_id;
+  int consume_local_repo = 0;
+  arg.action_mask = action_mask;
+  arg.output_entry = NULL;
+  arg.output_repo = NULL;
+#if defined(DISTRIBUTED)
+  arg.remote_deps = deps;
+#endif  /* defined(DISTRIBUTED) */
+  assert(NULL != es);
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS )    arg.ready_lists = alloca(sizeof(parsec_task_t *) * es->virtual_process->parsec_context->nb_vp);
+  else
+    arg.ready_lists = NULL;
+  for( __vp_id = 0; __vp_id < es->virtual_process->parsec_context->nb_vp; arg.ready_lists[__vp_id++] = NULL );
+  (void)__parsec_tp; (void)deps;
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_Rtop.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_Rtop.source_repo, this_task->data._f_Rtop.source_repo_entry->ht_item.key );
+    }
+  }
+  consume_local_repo = (this_task->repo_entry != NULL);
+  arg.output_repo = reduce_in_row_repo;
+  arg.output_entry = this_task->repo_entry;
+  arg.output_usage = 0;
+  if( action_mask & (PARSEC_ACTION_RELEASE_LOCAL_DEPS | PARSEC_ACTION_GET_REPO_ENTRY) ) {
+    arg.output_entry = data_repo_lookup_entry_and_create( es, arg.output_repo, __jdf2c_make_key_reduce_in_row((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    arg.output_entry->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(arg.output_entry->sim_exec_date == 0);
+    arg.output_entry->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  if(action_mask & ( PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE ) ){
+    /* Generate the reshape promise for the outputs that need it */
+    iterate_successors_of_reduce_row_reduce_in_row(es, this_task, action_mask, parsec_set_up_reshape_promise, &arg);
+   }
+  iterate_successors_of_reduce_row_reduce_in_row(es, this_task, action_mask, parsec_release_dep_fct, &arg);
+
+#if defined(DISTRIBUTED)
+  if( (action_mask & PARSEC_ACTION_SEND_REMOTE_DEPS) && (NULL != arg.remote_deps)) {
+    parsec_remote_dep_activate(es, (parsec_task_t *)this_task, arg.remote_deps, arg.remote_deps->outgoing_mask);
+  }
+#endif
+
+  if(action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS) {
+    data_repo_entry_addto_usage_limit(reduce_in_row_repo, arg.output_entry->ht_item.key, arg.output_usage);
+    __parsec_schedule_vp(es, arg.ready_lists, 0);
+  }
+      if (consume_local_repo) {
+         data_repo_entry_used_once( reduce_in_row_repo, this_task->repo_entry->ht_item.key );
+      }
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_Rtop.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_Rtop.data_in);
+    }
+  }
+  PARSEC_PINS(es, RELEASE_DEPS_END, (parsec_task_t *)this_task);  return 0;
+}
+
+static int data_lookup_of_reduce_row_reduce_in_row(parsec_execution_stream_t *es, __parsec_reduce_row_reduce_in_row_task_t *this_task)
+{
+  const __parsec_reduce_row_internal_taskpool_t *__parsec_tp = (__parsec_reduce_row_internal_taskpool_t *)this_task->taskpool;
+  parsec_assignment_t generic_locals[MAX_PARAM_COUNT];  /* generic task locals */
+  int target_device = 0; (void)target_device;
+  (void)__parsec_tp; (void)generic_locals; (void)es;
+  parsec_data_copy_t *chunk = NULL;
+  data_repo_t        *reshape_repo  = NULL, *consumed_repo  = NULL;
+  data_repo_entry_t  *reshape_entry = NULL, *consumed_entry = NULL;
+  parsec_key_t        reshape_entry_key = 0, consumed_entry_key = 0;
+  uint8_t             consumed_flow_index;
+  parsec_dep_data_description_t data;
+  int ret;
+  (void)reshape_repo; (void)reshape_entry; (void)reshape_entry_key;
+  (void)consumed_repo; (void)consumed_entry; (void)consumed_entry_key;
+  (void)consumed_flow_index;
+  (void)chunk; (void)data; (void)ret;
+  const int index = this_task->locals.index.value; (void)index;
+  const int column = this_task->locals.column.value; (void)column;
+  if( NULL == this_task->repo_entry ){
+    this_task->repo_entry = data_repo_lookup_entry_and_create(es, reduce_in_row_repo,                                       __jdf2c_make_key_reduce_in_row((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    data_repo_entry_addto_usage_limit(reduce_in_row_repo, this_task->repo_entry->ht_item.key, 1);    this_task->repo_entry ->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(this_task->repo_entry ->sim_exec_date == 0);
+    this_task->repo_entry ->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  /* The reshape repo is the current task repo. */  reshape_repo = reduce_in_row_repo;
+  reshape_entry_key = __jdf2c_make_key_reduce_in_row((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals) ;
+  reshape_entry = this_task->repo_entry;
+  /* Lookup the input data, and store them in the context if any */
+
+if(! this_task->data._f_Rtop.fulfill ){ /* Flow Rtop */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_Rtop.data_out = NULL;  /* By default, if nothing matches */
+  /* Flow Rtop [0] dependency [0] from memory src */
+  if( NULL == (chunk = this_task->data._f_Rtop.data_in) ) {
+  /* No data set up by predecessor on this task input flow */
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+  parsec_prof_grapher_data_input(data_of_src(index, 0), (parsec_task_t*)this_task, &flow_of_reduce_row_reduce_in_row_for_Rtop, 1);
+#endif
+    chunk = parsec_data_get_copy(data_of_src(index, 0), target_device);
+    data.data = chunk;
+    data.data_future  = NULL;
+        data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.data_future   = NULL;
+    if( (ret = parsec_get_copy_reshape_from_desc(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    this_task->data._f_Rtop.data_out = chunk;
+    PARSEC_OBJ_RETAIN(chunk);
+  } 
+    this_task->data._f_Rtop.data_in     = chunk;
+    this_task->data._f_Rtop.source_repo       = consumed_repo;
+    this_task->data._f_Rtop.source_repo_entry = consumed_entry;
+    if( this_task->data._f_Rtop.source_repo_entry == this_task->repo_entry ){
+      /* in case we have consume from this task repo entry for the flow,
+       * it is cleaned up, avoiding having old stuff during release_deps_of
+       */
+      this_task->repo_entry->data[0] = NULL;
+    }
+    this_task->data._f_Rtop.fulfill = 1;
+}
+
+  /** No profiling information */
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int datatype_lookup_of_reduce_row_reduce_in_row(parsec_execution_stream_t *es, const parsec_task_t *this_generic_task, const parsec_task_t *parent_task,
+              uint32_t* flow_mask, parsec_dep_data_description_t* data)
+{
+  const __parsec_reduce_row_reduce_in_row_task_t *this_task = (__parsec_reduce_row_reduce_in_row_task_t*)this_generic_task;
+  const __parsec_reduce_row_internal_taskpool_t *__parsec_tp = (__parsec_reduce_row_internal_taskpool_t *)this_task->taskpool;
+  (void)__parsec_tp; (void)es; (void)this_task; (void)data; (void)parent_task;
+  const int index = this_task->locals.index.value; (void)index;
+  const int column = this_task->locals.column.value; (void)column;
+  data->local.arena = data->remote.arena = NULL;
+  data->local.src_datatype  = data->local.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->local.src_count     = data->local.dst_count = 0;
+  data->local.src_displ     = data->local.dst_displ = 0;
+  data->data_future  = NULL;
+  if( (*flow_mask) & 0x80000000U ) { /* these are the input dependencies remote datatypes  */
+if( (*flow_mask) & 0x1U ) {  /* Flow Rtop */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_reduce_row_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_reduce_row_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_reduce_row_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+    goto no_mask_match;
+  }
+
+  /* these are the output dependencies remote datatypes */
+if( (*flow_mask) & 0x1U ) {  /* Flow Rtop */
+    if( ((*flow_mask) & 0x1U) ) {
+    data->remote.arena  =  PARSEC_reduce_row_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_reduce_row_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_reduce_row_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+ no_mask_match:
+  data->data                             = NULL;
+  data->remote.src_datatype = data->remote.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->remote.src_count    = data->remote.dst_count = 0;
+  data->remote.src_displ    = data->remote.dst_displ = 0;
+  data->data_future  = NULL;
+  (*flow_mask) = 0;  /* nothing left */
+  (void)index;  (void)column;
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+static int hook_of_reduce_row_reduce_in_row(parsec_execution_stream_t *es, __parsec_reduce_row_reduce_in_row_task_t *this_task)
+{
+  __parsec_reduce_row_internal_taskpool_t *__parsec_tp = (__parsec_reduce_row_internal_taskpool_t *)this_task->taskpool;
+  (void)es; (void)__parsec_tp;
+  const int index = this_task->locals.index.value; (void)index;
+  const int column = this_task->locals.column.value; (void)column;
+  (void)index;  (void)column;
+
+  /** Declare the variables that will hold the data, and all the accounting for each */
+  parsec_data_copy_t *_f_Rtop = this_task->data._f_Rtop.data_in;
+  void *Rtop = PARSEC_DATA_COPY_GET_PTR(_f_Rtop); (void)Rtop;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    data_repo_entry_t *eRtop = this_task->data._f_Rtop.source_repo_entry;
+    if( (NULL != eRtop) && (eRtop->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eRtop->sim_exec_date;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+  /** Cache Awareness Accounting */
+#if defined(PARSEC_CACHE_AWARENESS)
+  cache_buf_referenced(es->closest_cache, Rtop);
+#endif /* PARSEC_CACHE_AWARENESS */
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                              reduce_in_row BODY                              -----*/
+
+    /* Just the input task */
+
+/*-----                          END OF reduce_in_row BODY                            -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#endif  /*  defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+static int complete_hook_of_reduce_row_reduce_in_row(parsec_execution_stream_t *es, __parsec_reduce_row_reduce_in_row_task_t *this_task)
+{
+  const __parsec_reduce_row_internal_taskpool_t *__parsec_tp = (__parsec_reduce_row_internal_taskpool_t *)this_task->taskpool;
+#if defined(DISTRIBUTED)
+    const int index = this_task->locals.index.value; (void)index;
+  const int column = this_task->locals.column.value; (void)column;
+#endif  /* defined(DISTRIBUTED) */
+  (void)es; (void)__parsec_tp;
+parsec_data_t* data_t_desc = NULL; (void)data_t_desc;
+#if defined(DISTRIBUTED)
+  /** If not working on distributed, there is no risk that data is not in place */
+  (void)index;  (void)column;
+
+#endif /* DISTRIBUTED */
+#if defined(PARSEC_PROF_GRAPHER)
+  parsec_prof_grapher_task((parsec_task_t*)this_task, es->th_id, es->virtual_process->vp_id,
+     __jdf2c_key_fns_reduce_in_row.key_hash(this_task->task_class->make_key( (parsec_taskpool_t*)this_task->taskpool, ((parsec_task_t*)this_task)->locals), NULL));
+#endif  /* defined(PARSEC_PROF_GRAPHER) */
+  release_deps_of_reduce_row_reduce_in_row(es, this_task,
+      PARSEC_ACTION_RELEASE_REMOTE_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_REFS |
+      PARSEC_ACTION_RESHAPE_ON_RELEASE |
+      0x1,  /* mask of all dep_index */ 
+      NULL);
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static parsec_hook_return_t release_task_of_reduce_row_reduce_in_row(parsec_execution_stream_t *es, parsec_task_t *this_task)
+{
+    const __parsec_reduce_row_internal_taskpool_t *__parsec_tp =
+        (const __parsec_reduce_row_internal_taskpool_t *)this_task->taskpool;
+    parsec_hash_table_t *ht = (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[0];
+    parsec_key_t key = this_task->task_class->make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals);
+    parsec_hashable_dependency_t *hash_dep = (parsec_hashable_dependency_t *)parsec_hash_table_remove(ht, key);
+    parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);
+    return parsec_release_task_to_mempool_update_nbtasks(es, this_task);
+}
+
+static char *reduce_row_reduce_row_reduce_in_row_internal_init_deps_key_functions_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_reduce_row_internal_taskpool_t *__parsec_tp = (__parsec_reduce_row_internal_taskpool_t *)user_data;
+  int index = (__parsec_key) % __parsec_tp->reduce_in_row_index_range + __parsec_tp->reduce_in_row_index_min;
+  __parsec_key = __parsec_key / __parsec_tp->reduce_in_row_index_range;
+  int column = (__parsec_key) % __parsec_tp->reduce_in_row_column_range + __parsec_tp->reduce_in_row_column_min;
+  __parsec_key = __parsec_key / __parsec_tp->reduce_in_row_column_range;
+  snprintf(buffer, buffer_size, "reduce_in_row(%d, %d)", index, column);
+  return buffer;
+}
+
+static parsec_key_fn_t reduce_row_reduce_row_reduce_in_row_internal_init_deps_key_functions = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = reduce_row_reduce_row_reduce_in_row_internal_init_deps_key_functions_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/* Needs: min-max count-tasks iterate */
+static int reduce_row_reduce_in_row_internal_init(parsec_execution_stream_t * es, __parsec_reduce_row_reduce_in_row_task_t * this_task)
+{
+  __parsec_reduce_row_internal_taskpool_t *__parsec_tp = (__parsec_reduce_row_internal_taskpool_t*)this_task->taskpool;
+  int32_t nb_tasks = 0, saved_nb_tasks = 0;
+int32_t __index_min = 0x7fffffff, __index_max = 0;int32_t __jdf2c_index_min = 0x7fffffff, __jdf2c_index_max = 0;int32_t __column_min = 0x7fffffff, __column_max = 0;int32_t __jdf2c_column_min = 0x7fffffff, __jdf2c_column_max = 0;  __parsec_reduce_row_reduce_in_row_parsec_assignment_t assignments = {  .index.value = 0, .column.value = 0 };
+  int32_t  index,  column;
+  int32_t __jdf2c_index_start, __jdf2c_index_end, __jdf2c_index_inc;
+  int32_t __jdf2c_column_start, __jdf2c_column_end, __jdf2c_column_inc;
+    __jdf2c_index_start = 0;
+    __jdf2c_index_end = ((1 << depth) - 1);
+    __jdf2c_index_inc = 1;
+    __index_min = parsec_imin(__jdf2c_index_start, __jdf2c_index_end);
+    __index_max = parsec_imax(__jdf2c_index_start, __jdf2c_index_end);
+    __jdf2c_index_min = parsec_imin(__jdf2c_index_min, __index_min);
+    __jdf2c_index_max = parsec_imax(__jdf2c_index_max, __index_max);
+    for(index =  __jdf2c_index_start;
+        index <= __jdf2c_index_end;
+        index += __jdf2c_index_inc) {
+    assignments.index.value = index;
+      __jdf2c_column_start = IA;
+      __jdf2c_column_end = N;
+      __jdf2c_column_inc = 1;
+      __column_min = parsec_imin(__jdf2c_column_start, __jdf2c_column_end);
+      __column_max = parsec_imax(__jdf2c_column_start, __jdf2c_column_end);
+      __jdf2c_column_min = parsec_imin(__jdf2c_column_min, __column_min);
+      __jdf2c_column_max = parsec_imax(__jdf2c_column_max, __column_max);
+      for(column =  __jdf2c_column_start;
+          column <= __jdf2c_column_end;
+          column += __jdf2c_column_inc) {
+      assignments.column.value = column;
+      if( !reduce_in_row_pred(index, column) ) continue;
+      nb_tasks++;
+    } /* Loop on normal range column */
+  } /* For loop of index */ 
+   if( 0 != nb_tasks ) {
+     (void)parsec_atomic_fetch_add_int32(&__parsec_tp->initial_number_tasks, nb_tasks);
+   }
+  /* Set the range variables for the collision-free hash-computation */
+  __parsec_tp->reduce_in_row_index_min   = __jdf2c_index_min;
+  __parsec_tp->reduce_in_row_index_range = (__jdf2c_index_max - __jdf2c_index_min) + 1;
+  __parsec_tp->reduce_in_row_column_min   = __jdf2c_column_min;
+  __parsec_tp->reduce_in_row_column_range = (__jdf2c_column_max - __jdf2c_column_min) + 1;
+    do {
+      this_task->super.list_next = (parsec_list_item_t*)__parsec_tp->startup_queue;
+    } while(!parsec_atomic_cas_ptr(&__parsec_tp->startup_queue, (parsec_list_item_t*)this_task->super.list_next, this_task));
+    this_task->status = PARSEC_TASK_STATUS_HOOK;
+
+  PARSEC_AYU_REGISTER_TASK(&reduce_row_reduce_in_row);
+  __parsec_tp->super.super.dependencies_array[0] = PARSEC_OBJ_NEW(parsec_hash_table_t);
+  parsec_hash_table_init(__parsec_tp->super.super.dependencies_array[0], offsetof(parsec_hashable_dependency_t, ht_item), 10, reduce_row_reduce_row_reduce_in_row_internal_init_deps_key_functions, this_task->taskpool);
+  __parsec_tp->repositories[0] = data_repo_create_nothreadsafe(nb_tasks, __jdf2c_key_fns_reduce_in_row, (parsec_taskpool_t*)__parsec_tp, 1);
+(void)saved_nb_tasks;
+(void)__index_min; (void)__index_max;(void)__column_min; (void)__column_max;  (void)__jdf2c_index_start; (void)__jdf2c_index_end; (void)__jdf2c_index_inc;  (void)__jdf2c_column_start; (void)__jdf2c_column_end; (void)__jdf2c_column_inc;  (void)assignments; (void)__parsec_tp; (void)es;
+  if(1 == parsec_atomic_fetch_dec_int32(&__parsec_tp->sync_point)) {
+    /* Last initialization task complete. Update the number of tasks. */
+    __parsec_tp->super.super.tdm.module->taskpool_addto_nb_tasks(&__parsec_tp->super.super, __parsec_tp->initial_number_tasks);
+    parsec_mfence();  /* write memory barrier to guarantee that the scheduler gets the correct number of tasks */
+    parsec_taskpool_enable((parsec_taskpool_t*)__parsec_tp, &__parsec_tp->startup_queue,
+                           (parsec_task_t*)this_task, es, __parsec_tp->super.super.nb_pending_actions);
+    __parsec_tp->super.super.tdm.module->taskpool_ready(&__parsec_tp->super.super);
+    if( 1 >= __parsec_tp->super.super.nb_pending_actions ) {
+        /* if no tasks will be generated let's prevent the runtime from calling the hook and instead go directly to complete the task */
+        this_task->status = PARSEC_TASK_STATUS_COMPLETE;
+    }
+    return PARSEC_HOOK_RETURN_DONE;
+  }
+  return PARSEC_HOOK_RETURN_ASYNC;
+}
+
+static int __jdf2c_startup_reduce_in_row(parsec_execution_stream_t * es, __parsec_reduce_row_reduce_in_row_task_t *this_task)
+{
+  __parsec_reduce_row_reduce_in_row_task_t* new_task;
+  __parsec_reduce_row_internal_taskpool_t* __parsec_tp = (__parsec_reduce_row_internal_taskpool_t*)this_task->taskpool;
+  parsec_context_t *context = __parsec_tp->super.super.context;
+  int vpid = 0, nb_tasks = 0;
+  size_t total_nb_tasks = 0;
+  parsec_list_item_t* pready_ring[context->nb_vp];
+  int restore_context = 0;
+  int index = this_task->locals.index.value;  /* retrieve value saved during the last iteration */
+  int column = this_task->locals.column.value;  /* retrieve value saved during the last iteration */
+  for(int _i = 0; _i < context->nb_vp; pready_ring[_i++] = NULL );
+  if( 0 != this_task->locals.reserved[0].value ) {
+    this_task->locals.reserved[0].value = 1; /* reset the submission process */
+    restore_context = 1;
+    goto restore_context_0;
+  }
+  this_task->locals.reserved[0].value = 1; /* a sane default value */
+  for(this_task->locals.index.value = index = 0;
+      this_task->locals.index.value <= ((1 << depth) - 1);
+      this_task->locals.index.value += 1, index = this_task->locals.index.value) {
+    for(this_task->locals.column.value = column = IA;
+        this_task->locals.column.value <= N;
+        this_task->locals.column.value += 1, column = this_task->locals.column.value) {
+      if( !reduce_in_row_pred(index, column) ) continue;
+  __parsec_reduce_row_reduce_in_row_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_reduce_row_reduce_in_row_parsec_assignment_t*)&this_task->locals;
+  (void)__jdf2c__tmp_locals;
+  /* Flow for Rtop is always a memory reference */
+      if( NULL != ((parsec_data_collection_t*)__parsec_tp->super._g_src)->vpid_of ) {
+        vpid = ((parsec_data_collection_t*)__parsec_tp->super._g_src)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_src, index, 0);
+        assert(context->nb_vp >= vpid);
+      } else {
+        vpid = (vpid + 1) % context->nb_vp;  /* spread the initial joy */
+      }
+      new_task = (__parsec_reduce_row_reduce_in_row_task_t*)parsec_thread_mempool_allocate( context->virtual_processes[vpid]->execution_streams[0]->context_mempool );
+      PARSEC_OBJ_CONSTRUCT(new_task, parsec_task_t); /* construct called only when new, force-construct it again */
+      /* Copy only the valid elements from this_task to new_task one */
+      new_task->taskpool   = this_task->taskpool;
+      new_task->task_class = __parsec_tp->super.super.task_classes_array[reduce_row_reduce_in_row.task_class_id];
+      new_task->chore_mask   = PARSEC_DEV_ALL;
+      new_task->locals.index.value = this_task->locals.index.value;
+      new_task->locals.column.value = this_task->locals.column.value;
+      PARSEC_LIST_ITEM_SINGLETON(new_task);
+      new_task->priority = __parsec_tp->super.super.priority;
+      new_task->repo_entry = NULL;
+      new_task->data._f_Rtop.source_repo_entry = NULL;
+      new_task->data._f_Rtop.source_repo       = NULL;
+      new_task->data._f_Rtop.data_in         = NULL;
+      new_task->data._f_Rtop.data_out        = NULL;
+      new_task->data._f_Rtop.fulfill         = 0;
+#if defined(PARSEC_DEBUG_NOISIER)
+      {
+        char tmp[128];
+        PARSEC_DEBUG_VERBOSE(10, parsec_debug_output, "Add startup task %s to vpid %d",
+               parsec_task_snprintf(tmp, 128, (parsec_task_t*)new_task), vpid);
+      }
+#endif
+      parsec_dependencies_mark_task_as_startup((parsec_task_t*)new_task, es);
+      pready_ring[vpid] = parsec_list_item_ring_push_sorted(pready_ring[vpid],
+                                                            (parsec_list_item_t*)new_task,
+                                                            parsec_execution_context_priority_comparator);
+      nb_tasks++;
+     restore_context_0:  /* we jump here just so that we have code after the label */
+      restore_context = 0;
+      (void)restore_context;
+      if( nb_tasks > this_task->locals.reserved[0].value ) {
+        if( (size_t)this_task->locals.reserved[0].value < parsec_task_startup_iter ) this_task->locals.reserved[0].value <<= 1;
+        __parsec_schedule_vp(es, (parsec_task_t**)pready_ring, 0);
+        total_nb_tasks += nb_tasks;
+        nb_tasks = 0;
+        if( total_nb_tasks > parsec_task_startup_chunk ) {  /* stop here and request to be rescheduled */
+          return PARSEC_HOOK_RETURN_AGAIN;
+        }
+      }
+    } /* Loop on normal range column */
+  } /* Loop on normal range index */
+  (void)vpid;
+  if( 0 != nb_tasks ) {
+    __parsec_schedule_vp(es, (parsec_task_t**)pready_ring, 0);
+    nb_tasks = 0;
+  }
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static const __parsec_chore_t __reduce_row_reduce_in_row_chores[] ={
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+    { .type     = PARSEC_DEV_CPU,
+      .evaluate = (parsec_evaluate_function_t*)NULL,
+      .hook     = (parsec_hook_t*)hook_of_reduce_row_reduce_in_row },
+#endif  /* defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+    { .type     = PARSEC_DEV_NONE,
+      .evaluate = NULL,
+      .hook     = (parsec_hook_t*)NULL },  /* End marker */
+};
+
+static const parsec_task_class_t reduce_row_reduce_in_row = {
+  .name = "reduce_in_row",
+  .task_class_id = 0,
+  .nb_flows = 1,
+  .nb_parameters = 2,
+  .nb_locals = 2,
+  .task_class_type = PARSEC_TASK_CLASS_TYPE_PTG,
+  .params = { &symb_reduce_row_reduce_in_row_index, &symb_reduce_row_reduce_in_row_column, NULL },
+  .locals = { &symb_reduce_row_reduce_in_row_index, &symb_reduce_row_reduce_in_row_column, NULL },
+  .data_affinity = (parsec_data_ref_fn_t*)affinity_of_reduce_row_reduce_in_row,
+  .initial_data = (parsec_data_ref_fn_t*)affinity_of_reduce_row_reduce_in_row,
+  .final_data = (parsec_data_ref_fn_t*)affinity_of_reduce_row_reduce_in_row,
+  .priority = NULL,
+  .properties = properties_of_reduce_row_reduce_in_row,
+#if MAX_PARAM_COUNT < 1  /* number of read flows of reduce_in_row */
+  #error Too many read flows for task reduce_in_row
+#endif  /* MAX_PARAM_COUNT */
+#if MAX_PARAM_COUNT < 0  /* number of write flows of reduce_in_row */
+  #error Too many write flows for task reduce_in_row
+#endif  /* MAX_PARAM_COUNT */
+  .in = { &flow_of_reduce_row_reduce_in_row_for_Rtop, NULL },
+  .out = { &flow_of_reduce_row_reduce_in_row_for_Rtop, NULL },
+  .flags = 0x0 | PARSEC_HAS_IN_IN_DEPENDENCIES | PARSEC_USE_DEPS_MASK,
+  .dependencies_goal = 0x1,
+  .make_key = __jdf2c_make_key_reduce_in_row,
+  .task_snprintf = parsec_task_snprintf,
+#if defined(PARSEC_PROF_TRACE)
+  .profile_info = &parsec_task_profile_info,
+#endif
+  .key_functions = &__jdf2c_key_fns_reduce_in_row,
+  .fini = (parsec_hook_t*)NULL,
+  .incarnations = __reduce_row_reduce_in_row_chores,
+  .find_deps = parsec_hash_find_deps,
+  .update_deps = parsec_update_deps_with_mask,
+  .iterate_successors = (parsec_traverse_function_t*)iterate_successors_of_reduce_row_reduce_in_row,
+  .iterate_predecessors = (parsec_traverse_function_t*)NULL,
+  .release_deps = (parsec_release_deps_t*)release_deps_of_reduce_row_reduce_in_row,
+  .prepare_output = (parsec_hook_t*)NULL,
+  .prepare_input = (parsec_hook_t*)data_lookup_of_reduce_row_reduce_in_row,
+  .time_estimate = NULL,
+  .get_datatype = datatype_lookup_of_reduce_row_reduce_in_row,
+  .complete_execution = (parsec_hook_t*)complete_hook_of_reduce_row_reduce_in_row,
+  .release_task = &release_task_of_reduce_row_reduce_in_row,
+#if defined(PARSEC_SIM)
+  .sim_cost_fct = (parsec_sim_cost_fct_t*)NULL,
+#endif
+};
+
+
+static const parsec_task_class_t *reduce_row_task_classes[] = {
+  &reduce_row_reduce_in_row,
+  &reduce_row_reduce_row
+};
+
+static void reduce_row_startup(parsec_context_t *context, __parsec_reduce_row_internal_taskpool_t *__parsec_tp, parsec_list_item_t ** ready_tasks)
+{
+  uint32_t i, supported_dev = 0;
+ 
+  for( i = 0; i < parsec_nb_devices; i++ ) {
+    if( !(__parsec_tp->super.super.devices_index_mask & (1<<i)) ) continue;
+    parsec_device_module_t* device = parsec_mca_device_get(i);
+    parsec_data_collection_t* parsec_dc;
+ 
+    if(NULL == device) continue;
+    if(NULL != device->taskpool_register)
+      if( PARSEC_SUCCESS != device->taskpool_register(device, (parsec_taskpool_t*)__parsec_tp) ) {
+        parsec_debug_verbose(5, parsec_debug_output, "Device %s refused to register taskpool %p", device->name, __parsec_tp);
+        __parsec_tp->super.super.devices_index_mask &= ~(1 << device->device_index);
+        continue;
+      }
+    if(NULL != device->memory_register) {  /* Register all the data */
+      parsec_dc = (parsec_data_collection_t*)__parsec_tp->super._g_src;
+      if( (NULL != parsec_dc->register_memory) &&
+          (PARSEC_SUCCESS != parsec_dc->register_memory(parsec_dc, device)) ) {
+        parsec_debug_verbose(3, parsec_debug_output, "Device %s refused to register memory for data %s (%p) from taskpool %p",
+                     device->name, parsec_dc->key_base, parsec_dc, __parsec_tp);
+        __parsec_tp->super.super.devices_index_mask &= ~(1 << device->device_index);
+      }
+      parsec_dc = (parsec_data_collection_t*)__parsec_tp->super._g_dest;
+      if( (NULL != parsec_dc->register_memory) &&
+          (PARSEC_SUCCESS != parsec_dc->register_memory(parsec_dc, device)) ) {
+        parsec_debug_verbose(3, parsec_debug_output, "Device %s refused to register memory for data %s (%p) from taskpool %p",
+                     device->name, parsec_dc->key_base, parsec_dc, __parsec_tp);
+        __parsec_tp->super.super.devices_index_mask &= ~(1 << device->device_index);
+      }
+    }
+    supported_dev |= device->type;
+  }
+  /* Remove all the chores without a backend device */
+  for( i = 0; i < PARSEC_reduce_row_NB_TASK_CLASSES; i++ ) {
+    parsec_task_class_t* tc = (parsec_task_class_t*)__parsec_tp->super.super.task_classes_array[i];
+    __parsec_chore_t* chores = (__parsec_chore_t*)tc->incarnations;
+    uint32_t idx = 0, j;
+    for( j = 0; PARSEC_DEV_NONE != chores[j].type; j++ ) {
+      if( !(supported_dev & chores[j].type) ) continue;
+      if( j != idx ) {
+        chores[idx] = chores[j];
+        parsec_debug_verbose(20, parsec_debug_output, "Device type %i disabled for function %s"
+, chores[j].type, tc->name);
+      }
+      idx++;
+    }
+    chores[idx].type     = PARSEC_DEV_NONE;
+    chores[idx].evaluate = NULL;
+    chores[idx].hook     = NULL;
+    /* Create the initialization tasks for each taskclass */
+    parsec_task_t* task = (parsec_task_t*)parsec_thread_mempool_allocate(context->virtual_processes[0]->execution_streams[0]->context_mempool);
+    PARSEC_OBJ_CONSTRUCT(task, parsec_task_t); /* construct called only when new, force-construct it again */
+    task->taskpool = (parsec_taskpool_t *)__parsec_tp;
+    task->chore_mask = PARSEC_DEV_CPU;
+    memset(&task->locals, 0, sizeof(parsec_assignment_t) * MAX_LOCAL_COUNT);
+    PARSEC_LIST_ITEM_SINGLETON(task);
+    task->priority = -1;
+    task->task_class = task->taskpool->task_classes_array[PARSEC_reduce_row_NB_TASK_CLASSES + i];
+    int where = i % context->nb_vp;
+    if( NULL == ready_tasks[where] ) ready_tasks[where] = &task->super;
+    else ready_tasks[where] = parsec_list_item_ring_push(ready_tasks[where], &task->super);
+  }
+}
+static void __parsec_reduce_row_internal_destructor( __parsec_reduce_row_internal_taskpool_t *__parsec_tp )
+{
+  uint32_t i;
+  parsec_taskpool_unregister( &__parsec_tp->super.super );
+  if(NULL != __parsec_tp->super.super.tdm.module) __parsec_tp->super.super.tdm.module->unmonitor_taskpool(&__parsec_tp->super.super);
+  for( i = 0; i < (uint32_t)(2 * __parsec_tp->super.super.nb_task_classes); i++ ) {  /* Extra startup function added at the end */
+    parsec_task_class_t* tc = (parsec_task_class_t*)__parsec_tp->super.super.task_classes_array[i];
+    free((void*)tc->incarnations);
+    free(tc);
+  }
+  free(__parsec_tp->super.super.task_classes_array); __parsec_tp->super.super.task_classes_array = NULL;
+  __parsec_tp->super.super.nb_task_classes = 0;
+
+  for(i = 0; i < (uint32_t)__parsec_tp->super.arenas_datatypes_size; i++) {
+    if( NULL != __parsec_tp->super.arenas_datatypes[i].arena ) {
+      PARSEC_OBJ_RELEASE(__parsec_tp->super.arenas_datatypes[i].arena);
+    }
+  }
+  /* Destroy the data repositories for this object */
+   data_repo_destroy_nothreadsafe(__parsec_tp->repositories[1]);  /* reduce_row */
+   data_repo_destroy_nothreadsafe(__parsec_tp->repositories[0]);  /* reduce_in_row */
+  /* Release the dependencies arrays for this object */
+  parsec_hash_table_fini( (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[1] );
+  PARSEC_OBJ_RELEASE(__parsec_tp->super.super.dependencies_array[1]);
+  __parsec_tp->super.super.dependencies_array[1] = NULL;
+  parsec_hash_table_fini( (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[0] );
+  PARSEC_OBJ_RELEASE(__parsec_tp->super.super.dependencies_array[0]);
+  __parsec_tp->super.super.dependencies_array[0] = NULL;
+  free( __parsec_tp->super.super.dependencies_array );
+  __parsec_tp->super.super.dependencies_array = NULL;
+  /* Unregister all the data */
+  uint32_t _i;
+  for( _i = 0; _i < parsec_nb_devices; _i++ ) {
+    parsec_device_module_t* device;
+    parsec_data_collection_t* parsec_dc;
+    if(!(__parsec_tp->super.super.devices_index_mask & (1 << _i))) continue;
+    if((NULL == (device = parsec_mca_device_get(_i))) || (NULL == device->memory_unregister)) continue;
+    parsec_dc = (parsec_data_collection_t*)__parsec_tp->super._g_src;
+  if( NULL != parsec_dc->unregister_memory ) { (void)parsec_dc->unregister_memory(parsec_dc, device); };
+  parsec_dc = (parsec_data_collection_t*)__parsec_tp->super._g_dest;
+  if( NULL != parsec_dc->unregister_memory ) { (void)parsec_dc->unregister_memory(parsec_dc, device); };
+}
+  /* Unregister the taskpool from the devices */
+  for( i = 0; i < parsec_nb_devices; i++ ) {
+    if(!(__parsec_tp->super.super.devices_index_mask & (1 << i))) continue;
+    __parsec_tp->super.super.devices_index_mask ^= (1 << i);
+    parsec_device_module_t* device = parsec_mca_device_get(i);
+    if((NULL == device) || (NULL == device->taskpool_unregister)) continue;
+    if( PARSEC_SUCCESS != device->taskpool_unregister(device, &__parsec_tp->super.super) ) continue;
+  }
+  free(__parsec_tp->super.super.taskpool_name); __parsec_tp->super.super.taskpool_name = NULL;
+}
+
+void __parsec_reduce_row_internal_constructor(__parsec_reduce_row_internal_taskpool_t* __parsec_tp)
+{
+  parsec_task_class_t* tc;
+  uint32_t i, j;
+
+  __parsec_tp->super.super.nb_task_classes = PARSEC_reduce_row_NB_TASK_CLASSES;
+  __parsec_tp->super.super.devices_index_mask = PARSEC_DEVICES_ALL;
+  __parsec_tp->super.super.taskpool_name = strdup("reduce_row");
+  parsec_termdet_open_module(&__parsec_tp->super.super, "local");
+  __parsec_tp->super.super.tdm.module->monitor_taskpool(&__parsec_tp->super.super,
+                                                        parsec_taskpool_termination_detected);
+  __parsec_tp->super.super.update_nb_runtime_task = parsec_add_fetch_runtime_task;
+  __parsec_tp->super.super.dependencies_array = (void **)
+              calloc(__parsec_tp->super.super.nb_task_classes, sizeof(void*));
+  /* Twice the size to hold the startup tasks function_t */
+  __parsec_tp->super.super.task_classes_array = (const parsec_task_class_t**)
+              calloc((2 * PARSEC_reduce_row_NB_TASK_CLASSES + 1), sizeof(parsec_task_class_t*));
+  __parsec_tp->super.super.tdm.module->taskpool_addto_runtime_actions(&__parsec_tp->super.super, PARSEC_reduce_row_NB_TASK_CLASSES);  /* for the startup tasks */
+  __parsec_tp->super.super.taskpool_type = PARSEC_TASKPOOL_TYPE_PTG;
+  __parsec_tp->sync_point = __parsec_tp->super.super.nb_task_classes;
+  __parsec_tp->initial_number_tasks = 0;
+  __parsec_tp->startup_queue = NULL;
+  for( i = 0; i < __parsec_tp->super.super.nb_task_classes; i++ ) {
+    __parsec_tp->super.super.task_classes_array[i] = tc = malloc(sizeof(parsec_task_class_t));
+    memcpy(tc, reduce_row_task_classes[i], sizeof(parsec_task_class_t));
+    for( j = 0; PARSEC_DEV_NONE != tc->incarnations[j].type; j++);  /* compute the number of incarnations */
+    tc->incarnations = (__parsec_chore_t*)malloc((j+1) * sizeof(__parsec_chore_t));
+        memcpy((__parsec_chore_t*)tc->incarnations, reduce_row_task_classes[i]->incarnations, (j+1) * sizeof(__parsec_chore_t));
+
+    /* Add a placeholder for initialization and startup task */
+    __parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+i] = tc = (parsec_task_class_t*)malloc(sizeof(parsec_task_class_t));
+    memcpy(tc, (void*)&__parsec_generic_startup, sizeof(parsec_task_class_t));
+    tc->task_class_id = __parsec_tp->super.super.nb_task_classes + i;
+    tc->incarnations = (__parsec_chore_t*)malloc(2 * sizeof(__parsec_chore_t));
+    memcpy((__parsec_chore_t*)tc->incarnations, (void*)__parsec_generic_startup.incarnations, 2 * sizeof(__parsec_chore_t));
+    tc->release_task = parsec_release_task_to_mempool_and_count_as_runtime_tasks;
+  }
+  /* Startup task for reduce_row */
+  tc = (parsec_task_class_t *)__parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+0];
+  tc->name = "Startup for reduce_row";
+  tc->prepare_input = (parsec_hook_t*)reduce_row_reduce_row_internal_init;
+  /* Startup task for reduce_in_row */
+  tc = (parsec_task_class_t *)__parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+1];
+  tc->name = "Startup for reduce_in_row";
+  tc->prepare_input = (parsec_hook_t*)reduce_row_reduce_in_row_internal_init;
+  ((__parsec_chore_t*)&tc->incarnations[0])->hook = (parsec_hook_t *)__jdf2c_startup_reduce_in_row;
+  /* Compute the number of arenas_datatypes: */
+  /*   PARSEC_reduce_row_DEFAULT_ARENA  ->  0 */
+  __parsec_tp->super.arenas_datatypes_size = 1;
+  memset(&__parsec_tp->super.arenas_datatypes[0], 0, __parsec_tp->super.arenas_datatypes_size*sizeof(parsec_arena_datatype_t));
+  /* If profiling is enabled, the keys for profiling */
+#  if defined(PARSEC_PROF_TRACE)
+  __parsec_tp->super.super.profiling_array = reduce_row_profiling_array;
+  if( -2 == reduce_row_profiling_array[0] ) {
+    #if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+parsec_profiling_add_dictionary_keyword("reduce_row::reduce_row::internal init", "fill:34D8D8",
+                                       0,
+                                       NULL,
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(reduce_row_reduce_row.task_class_id  + PARSEC_reduce_row_NB_TASK_CLASSES)/* reduce_row (internal init) start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(reduce_row_reduce_row.task_class_id  + PARSEC_reduce_row_NB_TASK_CLASSES)/* reduce_row (internal init) end key */]);
+#endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+parsec_profiling_add_dictionary_keyword("reduce_row::reduce_row", "fill:CC2828",
+                                       sizeof(parsec_task_prof_info_t)+3*sizeof(parsec_assignment_t),
+                                       "dc_key{uint64_t};priority{int32_t};dc_dataid{uint32_t};tcid{uint32_t};trc{int32_t};level{int32_t};index{int32_t};column{int32_t}",
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(reduce_row_reduce_row.task_class_id) /* reduce_row start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(reduce_row_reduce_row.task_class_id) /* reduce_row end key */]);
+
+    #if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+  *(int*)&__parsec_tp->super.super.profiling_array[START_KEY(reduce_row_reduce_in_row.task_class_id  + PARSEC_reduce_row_NB_TASK_CLASSES)/* reduce_in_row (internal init) start key */] = -1;
+  *(int*)&__parsec_tp->super.super.profiling_array[END_KEY(reduce_row_reduce_in_row.task_class_id  + PARSEC_reduce_row_NB_TASK_CLASSES)/* reduce_in_row (internal init) end key */] = -1;
+#endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+*(int*)&__parsec_tp->super.super.profiling_array[START_KEY(reduce_row_reduce_in_row.task_class_id)] = -1;
+*(int*)&__parsec_tp->super.super.profiling_array[END_KEY(reduce_row_reduce_in_row.task_class_id)] = -1;
+
+  }
+#  endif /* defined(PARSEC_PROF_TRACE) */
+  __parsec_tp->super.super.repo_array = __parsec_tp->repositories;
+  __parsec_tp->super.super.startup_hook = (parsec_startup_fn_t)reduce_row_startup;
+  (void)parsec_taskpool_reserve_id((parsec_taskpool_t*)__parsec_tp);
+}
+
+  /** Generate class declaration and instance using the above constructor and destructor */
+  PARSEC_OBJ_CLASS_DECLARATION(__parsec_reduce_row_internal_taskpool_t);
+  PARSEC_OBJ_CLASS_INSTANCE(__parsec_reduce_row_internal_taskpool_t, parsec_reduce_row_taskpool_t,
+                            __parsec_reduce_row_internal_constructor, __parsec_reduce_row_internal_destructor);
+
+#undef depth
+#undef src
+#undef dest
+#undef operation
+#undef op_data
+#undef IA
+#undef JA
+#undef M
+#undef N
+
+parsec_reduce_row_taskpool_t *parsec_reduce_row_new(const parsec_tiled_matrix_t* src /* data src */, parsec_tiled_matrix_t* dest /* data dest */, parsec_operator_t operation, void* op_data, int IA, int JA, int M, int N)
+{
+  __parsec_reduce_row_internal_taskpool_t *__parsec_tp = PARSEC_OBJ_NEW(__parsec_reduce_row_internal_taskpool_t);
+  /* Dump the hidden parameters with default values */
+  int depth;
+  /* Now the Parameter-dependent structures: */
+  __parsec_tp->super._g_depth = depth = (int)ceil(log(src->mt) / log(2.0));
+  __parsec_tp->super._g_src = src;
+  __parsec_tp->super._g_dest = dest;
+  __parsec_tp->super._g_operation = operation;
+  __parsec_tp->super._g_op_data = op_data;
+  __parsec_tp->super._g_IA = IA;
+  __parsec_tp->super._g_JA = JA;
+  __parsec_tp->super._g_M = M;
+  __parsec_tp->super._g_N = N;
+  PARSEC_AYU_REGISTER_TASK(&reduce_row_reduce_row);
+  PARSEC_AYU_REGISTER_TASK(&reduce_row_reduce_in_row);
+  __parsec_tp->super.super.startup_hook = (parsec_startup_fn_t)reduce_row_startup;
+  (void)parsec_taskpool_reserve_id((parsec_taskpool_t*)__parsec_tp);
+/* Prevent warnings related to not used hidden global variables */
+  (void)depth;
+  return (parsec_reduce_row_taskpool_t*)__parsec_tp;
+}
+
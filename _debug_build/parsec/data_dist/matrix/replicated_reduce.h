@@ -0,0 +1,98 @@
+#ifndef _replicated_reduce_h_
+#define _replicated_reduce_h_
+#include "parsec.h"
+#include "parsec/parsec_internal.h"
+#include "parsec/remote_dep.h"
+
+BEGIN_C_DECLS
+
+#define PARSEC_replicated_reduce_DEFAULT_ADT_IDX    0
+#define PARSEC_replicated_reduce_ADT_IDX_MAX       1
+typedef struct parsec_replicated_reduce_taskpool_s {
+  parsec_taskpool_t super;
+  /* The list of globals */
+  parsec_data_collection_t* _g_descA /* data descA */;
+  parsec_operator_t _g_operation;
+  void* _g_op_data;
+  int _g_MT;
+  int _g_NT;
+  int _g_LAYERS;
+  int _g_broadcast;
+  /* The array of datatypes (DEFAULT and co.) */
+  parsec_arena_datatype_t arenas_datatypes[PARSEC_replicated_reduce_ADT_IDX_MAX];
+  uint32_t arenas_datatypes_size;
+} parsec_replicated_reduce_taskpool_t;
+
+/** Beware that this object is not a superset of the internal object, and as a result
+ *  we should never create one directly. Instead we should rely on the creation of the
+ *  internal object (__parsec_replicated_reduce_taskpool_t).
+ */
+PARSEC_OBJ_CLASS_DECLARATION(parsec_replicated_reduce_taskpool_t);
+extern parsec_replicated_reduce_taskpool_t *parsec_replicated_reduce_new(parsec_data_collection_t* _g_descA /* data descA */, parsec_operator_t _g_operation, void* _g_op_data, int _g_MT, int _g_NT, int _g_LAYERS, int _g_broadcast);
+
+#if MAX_LOCAL_COUNT < 3  /* number of parameters and locals BCAST */
+  #error Too many parameters and local variables (3 out of MAX_LOCAL_COUNT) for task BCAST
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_replicated_reduce_BCAST_assignment_s {
+  parsec_assignment_t m;
+  parsec_assignment_t n;
+  parsec_assignment_t l;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-3];
+} __parsec_replicated_reduce_BCAST_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 1  /* total number of flows for task BCAST */
+  #error Too many flows (1 out of MAX_PARAM_COUNT) for task BCAST
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_replicated_reduce_BCAST_data_s {
+  parsec_data_pair_t _f_A;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-1];
+} __parsec_replicated_reduce_BCAST_data_t;
+
+typedef struct __parsec_replicated_reduce_BCAST_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_replicated_reduce_BCAST_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_replicated_reduce_BCAST_data_s data;
+} __parsec_replicated_reduce_BCAST_task_t;
+
+
+#if MAX_LOCAL_COUNT < 3  /* number of parameters and locals FOLD */
+  #error Too many parameters and local variables (3 out of MAX_LOCAL_COUNT) for task FOLD
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_replicated_reduce_FOLD_assignment_s {
+  parsec_assignment_t m;
+  parsec_assignment_t n;
+  parsec_assignment_t l;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-3];
+} __parsec_replicated_reduce_FOLD_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 2  /* total number of flows for task FOLD */
+  #error Too many flows (2 out of MAX_PARAM_COUNT) for task FOLD
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_replicated_reduce_FOLD_data_s {
+  parsec_data_pair_t _f_A;
+  parsec_data_pair_t _f_P;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-2];
+} __parsec_replicated_reduce_FOLD_data_t;
+
+typedef struct __parsec_replicated_reduce_FOLD_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_replicated_reduce_FOLD_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_replicated_reduce_FOLD_data_s data;
+} __parsec_replicated_reduce_FOLD_task_t;
+
+
+END_C_DECLS
+
+#endif /* _replicated_reduce_h_ */ 
@@ -0,0 +1,7 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/parsec/interfaces/ptg
+# Build directory: /root/repo/_debug_build/parsec/interfaces/ptg
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("ptg-compiler")
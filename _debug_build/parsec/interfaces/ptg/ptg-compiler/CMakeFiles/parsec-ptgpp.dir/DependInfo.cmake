@@ -0,0 +1,30 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/parsec/interfaces/ptg/ptg-compiler/jdf.c" "parsec/interfaces/ptg/ptg-compiler/CMakeFiles/parsec-ptgpp.dir/jdf.c.o" "gcc" "parsec/interfaces/ptg/ptg-compiler/CMakeFiles/parsec-ptgpp.dir/jdf.c.o.d"
+  "/root/repo/parsec/interfaces/ptg/ptg-compiler/jdf2c.c" "parsec/interfaces/ptg/ptg-compiler/CMakeFiles/parsec-ptgpp.dir/jdf2c.c.o" "gcc" "parsec/interfaces/ptg/ptg-compiler/CMakeFiles/parsec-ptgpp.dir/jdf2c.c.o.d"
+  "/root/repo/parsec/interfaces/ptg/ptg-compiler/jdf_unparse.c" "parsec/interfaces/ptg/ptg-compiler/CMakeFiles/parsec-ptgpp.dir/jdf_unparse.c.o" "gcc" "parsec/interfaces/ptg/ptg-compiler/CMakeFiles/parsec-ptgpp.dir/jdf_unparse.c.o.d"
+  "/root/repo/_debug_build/parsec/interfaces/ptg/ptg-compiler/parsec.l.c" "parsec/interfaces/ptg/ptg-compiler/CMakeFiles/parsec-ptgpp.dir/parsec.l.c.o" "gcc" "parsec/interfaces/ptg/ptg-compiler/CMakeFiles/parsec-ptgpp.dir/parsec.l.c.o.d"
+  "/root/repo/_debug_build/parsec/interfaces/ptg/ptg-compiler/parsec.y.c" "parsec/interfaces/ptg/ptg-compiler/CMakeFiles/parsec-ptgpp.dir/parsec.y.c.o" "gcc" "parsec/interfaces/ptg/ptg-compiler/CMakeFiles/parsec-ptgpp.dir/parsec.y.c.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_debug_build/parsec/interfaces/ptg/ptg-compiler/parsec.y.h" "/root/repo/_debug_build/parsec/interfaces/ptg/ptg-compiler/parsec.y.c"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_debug_build/parsec/CMakeFiles/parsec-base.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "/root/repo/_debug_build/parsec/include/fortran")
@@ -0,0 +1,22 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/parsec-ptgpp.dir/jdf.c.o"
+  "CMakeFiles/parsec-ptgpp.dir/jdf.c.o.d"
+  "CMakeFiles/parsec-ptgpp.dir/jdf2c.c.o"
+  "CMakeFiles/parsec-ptgpp.dir/jdf2c.c.o.d"
+  "CMakeFiles/parsec-ptgpp.dir/jdf_unparse.c.o"
+  "CMakeFiles/parsec-ptgpp.dir/jdf_unparse.c.o.d"
+  "CMakeFiles/parsec-ptgpp.dir/parsec.l.c.o"
+  "CMakeFiles/parsec-ptgpp.dir/parsec.l.c.o.d"
+  "CMakeFiles/parsec-ptgpp.dir/parsec.y.c.o"
+  "CMakeFiles/parsec-ptgpp.dir/parsec.y.c.o.d"
+  "parsec-ptgpp"
+  "parsec-ptgpp.pdb"
+  "parsec.l.c"
+  "parsec.y.c"
+  "parsec.y.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/parsec-ptgpp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/parsec/interfaces/ptg/ptg-compiler
+# Build directory: /root/repo/_debug_build/parsec/interfaces/ptg/ptg-compiler
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
@@ -0,0 +1,2754 @@
+
+#define  YY_INT_ALIGNED short int
+
+/* A lexical scanner generated by flex */
+
+#define FLEX_SCANNER
+#define YY_FLEX_MAJOR_VERSION 2
+#define YY_FLEX_MINOR_VERSION 6
+#define YY_FLEX_SUBMINOR_VERSION 4
+#if YY_FLEX_SUBMINOR_VERSION > 0
+#define FLEX_BETA
+#endif
+
+/* First, we deal with  platform-specific or compiler-specific issues. */
+
+/* begin standard C headers. */
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <stdlib.h>
+
+/* end standard C headers. */
+
+/* flex integer type definitions */
+
+#ifndef FLEXINT_H
+#define FLEXINT_H
+
+/* C99 systems have <inttypes.h>. Non-C99 systems may or may not. */
+
+#if defined (__STDC_VERSION__) && __STDC_VERSION__ >= 199901L
+
+/* C99 says to define __STDC_LIMIT_MACROS before including stdint.h,
+ * if you want the limit (max/min) macros for int types. 
+ */
+#ifndef __STDC_LIMIT_MACROS
+#define __STDC_LIMIT_MACROS 1
+#endif
+
+#include <inttypes.h>
+typedef int8_t flex_int8_t;
+typedef uint8_t flex_uint8_t;
+typedef int16_t flex_int16_t;
+typedef uint16_t flex_uint16_t;
+typedef int32_t flex_int32_t;
+typedef uint32_t flex_uint32_t;
+#else
+typedef signed char flex_int8_t;
+typedef short int flex_int16_t;
+typedef int flex_int32_t;
+typedef unsigned char flex_uint8_t; 
+typedef unsigned short int flex_uint16_t;
+typedef unsigned int flex_uint32_t;
+
+/* Limits of integral types. */
+#ifndef INT8_MIN
+#define INT8_MIN               (-128)
+#endif
+#ifndef INT16_MIN
+#define INT16_MIN              (-32767-1)
+#endif
+#ifndef INT32_MIN
+#define INT32_MIN              (-2147483647-1)
+#endif
+#ifndef INT8_MAX
+#define INT8_MAX               (127)
+#endif
+#ifndef INT16_MAX
+#define INT16_MAX              (32767)
+#endif
+#ifndef INT32_MAX
+#define INT32_MAX              (2147483647)
+#endif
+#ifndef UINT8_MAX
+#define UINT8_MAX              (255U)
+#endif
+#ifndef UINT16_MAX
+#define UINT16_MAX             (65535U)
+#endif
+#ifndef UINT32_MAX
+#define UINT32_MAX             (4294967295U)
+#endif
+
+#ifndef SIZE_MAX
+#define SIZE_MAX               (~(size_t)0)
+#endif
+
+#endif /* ! C99 */
+
+#endif /* ! FLEXINT_H */
+
+/* begin standard C++ headers. */
+
+/* TODO: this is always defined, so inline it */
+#define yyconst const
+
+#if defined(__GNUC__) && __GNUC__ >= 3
+#define yynoreturn __attribute__((__noreturn__))
+#else
+#define yynoreturn
+#endif
+
+/* Returned upon end-of-file. */
+#define YY_NULL 0
+
+/* Promotes a possibly negative, possibly signed char to an
+ *   integer in range [0..255] for use as an array index.
+ */
+#define YY_SC_TO_UI(c) ((YY_CHAR) (c))
+
+/* Enter a start condition.  This macro really ought to take a parameter,
+ * but we do it the disgusting crufty way forced on us by the ()-less
+ * definition of BEGIN.
+ */
+#define BEGIN (yy_start) = 1 + 2 *
+/* Translate the current start state into a value that can be later handed
+ * to BEGIN to return to the state.  The YYSTATE alias is for lex
+ * compatibility.
+ */
+#define YY_START (((yy_start) - 1) / 2)
+#define YYSTATE YY_START
+/* Action number for EOF rule of a given start state. */
+#define YY_STATE_EOF(state) (YY_END_OF_BUFFER + state + 1)
+/* Special action meaning "start processing a new file". */
+#define YY_NEW_FILE yyrestart( yyin  )
+#define YY_END_OF_BUFFER_CHAR 0
+
+/* Size of default input buffer. */
+#ifndef YY_BUF_SIZE
+#ifdef __ia64__
+/* On IA-64, the buffer size is 16k, not 8k.
+ * Moreover, YY_BUF_SIZE is 2*YY_READ_BUF_SIZE in the general case.
+ * Ditto for the __ia64__ case accordingly.
+ */
+#define YY_BUF_SIZE 32768
+#else
+#define YY_BUF_SIZE 16384
+#endif /* __ia64__ */
+#endif
+
+/* The state buf must be large enough to hold one state per character in the main buffer.
+ */
+#define YY_STATE_BUF_SIZE   ((YY_BUF_SIZE + 2) * sizeof(yy_state_type))
+
+#ifndef YY_TYPEDEF_YY_BUFFER_STATE
+#define YY_TYPEDEF_YY_BUFFER_STATE
+typedef struct yy_buffer_state *YY_BUFFER_STATE;
+#endif
+
+#ifndef YY_TYPEDEF_YY_SIZE_T
+#define YY_TYPEDEF_YY_SIZE_T
+typedef size_t yy_size_t;
+#endif
+
+extern int yyleng;
+
+extern FILE *yyin, *yyout;
+
+#define EOB_ACT_CONTINUE_SCAN 0
+#define EOB_ACT_END_OF_FILE 1
+#define EOB_ACT_LAST_MATCH 2
+    
+    /* Note: We specifically omit the test for yy_rule_can_match_eol because it requires
+     *       access to the local variable yy_act. Since yyless() is a macro, it would break
+     *       existing scanners that call yyless() from OUTSIDE yylex.
+     *       One obvious solution it to make yy_act a global. I tried that, and saw
+     *       a 5% performance hit in a non-yylineno scanner, because yy_act is
+     *       normally declared as a register variable-- so it is not worth it.
+     */
+    #define  YY_LESS_LINENO(n) \
+            do { \
+                int yyl;\
+                for ( yyl = n; yyl < yyleng; ++yyl )\
+                    if ( yytext[yyl] == '\n' )\
+                        --yylineno;\
+            }while(0)
+    #define YY_LINENO_REWIND_TO(dst) \
+            do {\
+                const char *p;\
+                for ( p = yy_cp-1; p >= (dst); --p)\
+                    if ( *p == '\n' )\
+                        --yylineno;\
+            }while(0)
+    
+/* Return all but the first "n" matched characters back to the input stream. */
+#define yyless(n) \
+	do \
+		{ \
+		/* Undo effects of setting up yytext. */ \
+        int yyless_macro_arg = (n); \
+        YY_LESS_LINENO(yyless_macro_arg);\
+		*yy_cp = (yy_hold_char); \
+		YY_RESTORE_YY_MORE_OFFSET \
+		(yy_c_buf_p) = yy_cp = yy_bp + yyless_macro_arg - YY_MORE_ADJ; \
+		YY_DO_BEFORE_ACTION; /* set up yytext again */ \
+		} \
+	while ( 0 )
+#define unput(c) yyunput( c, (yytext_ptr)  )
+
+#ifndef YY_STRUCT_YY_BUFFER_STATE
+#define YY_STRUCT_YY_BUFFER_STATE
+struct yy_buffer_state
+	{
+	FILE *yy_input_file;
+
+	char *yy_ch_buf;		/* input buffer */
+	char *yy_buf_pos;		/* current position in input buffer */
+
+	/* Size of input buffer in bytes, not including room for EOB
+	 * characters.
+	 */
+	int yy_buf_size;
+
+	/* Number of characters read into yy_ch_buf, not including EOB
+	 * characters.
+	 */
+	int yy_n_chars;
+
+	/* Whether we "own" the buffer - i.e., we know we created it,
+	 * and can realloc() it to grow it, and should free() it to
+	 * delete it.
+	 */
+	int yy_is_our_buffer;
+
+	/* Whether this is an "interactive" input source; if so, and
+	 * if we're using stdio for input, then we want to use getc()
+	 * instead of fread(), to make sure we stop fetching input after
+	 * each newline.
+	 */
+	int yy_is_interactive;
+
+	/* Whether we're considered to be at the beginning of a line.
+	 * If so, '^' rules will be active on the next match, otherwise
+	 * not.
+	 */
+	int yy_at_bol;
+
+    int yy_bs_lineno; /**< The line count. */
+    int yy_bs_column; /**< The column count. */
+
+	/* Whether to try to fill the input buffer when we reach the
+	 * end of it.
+	 */
+	int yy_fill_buffer;
+
+	int yy_buffer_status;
+
+#define YY_BUFFER_NEW 0
+#define YY_BUFFER_NORMAL 1
+	/* When an EOF's been seen but there's still some text to process
+	 * then we mark the buffer as YY_EOF_PENDING, to indicate that we
+	 * shouldn't try reading from the input source any more.  We might
+	 * still have a bunch of tokens to match, though, because of
+	 * possible backing-up.
+	 *
+	 * When we actually see the EOF, we change the status to "new"
+	 * (via yyrestart()), so that the user can continue scanning by
+	 * just pointing yyin at a new input file.
+	 */
+#define YY_BUFFER_EOF_PENDING 2
+
+	};
+#endif /* !YY_STRUCT_YY_BUFFER_STATE */
+
+/* Stack of input buffers. */
+static size_t yy_buffer_stack_top = 0; /**< index of top of stack. */
+static size_t yy_buffer_stack_max = 0; /**< capacity of stack. */
+static YY_BUFFER_STATE * yy_buffer_stack = NULL; /**< Stack as an array. */
+
+/* We provide macros for accessing buffer states in case in the
+ * future we want to put the buffer states in a more general
+ * "scanner state".
+ *
+ * Returns the top of the stack, or NULL.
+ */
+#define YY_CURRENT_BUFFER ( (yy_buffer_stack) \
+                          ? (yy_buffer_stack)[(yy_buffer_stack_top)] \
+                          : NULL)
+/* Same as previous macro, but useful when we know that the buffer stack is not
+ * NULL or when we need an lvalue. For internal use only.
+ */
+#define YY_CURRENT_BUFFER_LVALUE (yy_buffer_stack)[(yy_buffer_stack_top)]
+
+/* yy_hold_char holds the character lost when yytext is formed. */
+static char yy_hold_char;
+static int yy_n_chars;		/* number of characters read into yy_ch_buf */
+int yyleng;
+
+/* Points to current character in buffer. */
+static char *yy_c_buf_p = NULL;
+static int yy_init = 0;		/* whether we need to initialize */
+static int yy_start = 0;	/* start state number */
+
+/* Flag which is used to allow yywrap()'s to do buffer switches
+ * instead of setting up a fresh yyin.  A bit of a hack ...
+ */
+static int yy_did_buffer_switch_on_eof;
+
+void yyrestart ( FILE *input_file  );
+void yy_switch_to_buffer ( YY_BUFFER_STATE new_buffer  );
+YY_BUFFER_STATE yy_create_buffer ( FILE *file, int size  );
+void yy_delete_buffer ( YY_BUFFER_STATE b  );
+void yy_flush_buffer ( YY_BUFFER_STATE b  );
+void yypush_buffer_state ( YY_BUFFER_STATE new_buffer  );
+void yypop_buffer_state ( void );
+
+static void yyensure_buffer_stack ( void );
+static void yy_load_buffer_state ( void );
+static void yy_init_buffer ( YY_BUFFER_STATE b, FILE *file  );
+#define YY_FLUSH_BUFFER yy_flush_buffer( YY_CURRENT_BUFFER )
+
+YY_BUFFER_STATE yy_scan_buffer ( char *base, yy_size_t size  );
+YY_BUFFER_STATE yy_scan_string ( const char *yy_str  );
+YY_BUFFER_STATE yy_scan_bytes ( const char *bytes, int len  );
+
+void *yyalloc ( yy_size_t  );
+void *yyrealloc ( void *, yy_size_t  );
+void yyfree ( void *  );
+
+#define yy_new_buffer yy_create_buffer
+#define yy_set_interactive(is_interactive) \
+	{ \
+	if ( ! YY_CURRENT_BUFFER ){ \
+        yyensure_buffer_stack (); \
+		YY_CURRENT_BUFFER_LVALUE =    \
+            yy_create_buffer( yyin, YY_BUF_SIZE ); \
+	} \
+	YY_CURRENT_BUFFER_LVALUE->yy_is_interactive = is_interactive; \
+	}
+#define yy_set_bol(at_bol) \
+	{ \
+	if ( ! YY_CURRENT_BUFFER ){\
+        yyensure_buffer_stack (); \
+		YY_CURRENT_BUFFER_LVALUE =    \
+            yy_create_buffer( yyin, YY_BUF_SIZE ); \
+	} \
+	YY_CURRENT_BUFFER_LVALUE->yy_at_bol = at_bol; \
+	}
+#define YY_AT_BOL() (YY_CURRENT_BUFFER_LVALUE->yy_at_bol)
+
+/* Begin user sect3 */
+
+#define yywrap() (/*CONSTCOND*/1)
+#define YY_SKIP_YYWRAP
+typedef flex_uint8_t YY_CHAR;
+
+FILE *yyin = NULL, *yyout = NULL;
+
+typedef int yy_state_type;
+
+extern int yylineno;
+int yylineno = 1;
+
+extern char *yytext;
+#ifdef yytext_ptr
+#undef yytext_ptr
+#endif
+#define yytext_ptr yytext
+
+static yy_state_type yy_get_previous_state ( void );
+static yy_state_type yy_try_NUL_trans ( yy_state_type current_state  );
+static int yy_get_next_buffer ( void );
+static void yynoreturn yy_fatal_error ( const char* msg  );
+
+/* Done after the current pattern has been matched and before the
+ * corresponding action - sets up yytext.
+ */
+#define YY_DO_BEFORE_ACTION \
+	(yytext_ptr) = yy_bp; \
+	(yytext_ptr) -= (yy_more_len); \
+	yyleng = (int) (yy_cp - (yytext_ptr)); \
+	(yy_hold_char) = *yy_cp; \
+	*yy_cp = '\0'; \
+	(yy_c_buf_p) = yy_cp;
+#define YY_NUM_RULES 76
+#define YY_END_OF_BUFFER 77
+/* This struct is not used in this scanner,
+   but its presence is necessary. */
+struct yy_trans_info
+	{
+	flex_int32_t yy_verify;
+	flex_int32_t yy_nxt;
+	};
+static const flex_int16_t yy_accept[333] =
+    {   0,
+        0,    0,    5,    5,    0,    0,    0,    0,   32,   32,
+        0,    0,   77,   76,    8,   73,   47,   62,   52,   40,
+       36,   37,   50,   48,   60,   49,   76,   51,    9,   58,
+       59,   43,   56,   45,   57,   75,   75,   75,   75,   75,
+       75,   20,   42,   75,   75,   41,    8,   52,   75,    5,
+        5,    5,    5,    5,    5,    5,    5,    6,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,   75,   75,   75,   75,   75,   21,   72,
+        8,   63,   47,   61,   52,   40,   36,   37,   50,   48,
+       60,   49,   72,   51,    9,   58,   59,   43,   56,   45,
+
+       57,   72,   76,   42,   41,   32,    8,   33,   32,   32,
+       32,   32,   32,   32,   32,   32,   32,   32,   32,   32,
+        9,   32,   32,   32,   32,   32,   32,   32,   32,   32,
+        8,   32,    8,   30,   52,   29,    8,    0,   39,    0,
+        0,   40,   18,   55,    4,    0,    9,   19,   53,   44,
+       38,   46,   54,    0,   75,   75,   75,   75,   75,   13,
+       11,   75,   15,   75,   75,   75,   41,    8,    0,    0,
+       75,    5,    5,    5,    5,    6,    6,    7,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,   75,   27,   75,   22,   75,   75,   72,    8,   39,
+
+       40,   18,   55,    4,   72,    9,   19,   53,   44,   38,
+       46,   54,   72,   72,   71,   71,   64,   65,   69,   70,
+       66,   68,   67,   41,   32,    8,   33,   32,   32,   18,
+       32,    4,   32,    9,   19,   32,   32,   32,   32,   32,
+       32,   32,   32,    8,   32,   32,    8,   30,   29,    0,
+        0,    0,   74,   74,   75,   10,   16,   75,   75,   75,
+       75,   75,   75,    0,    0,   75,    5,    5,   75,   25,
+       75,   24,   72,   72,   64,   65,   32,   34,   34,   32,
+       32,   31,    0,   75,   17,   12,   75,   75,   75,   75,
+        0,    0,   28,    5,   75,   23,   72,   64,    0,   32,
+
+       31,    2,   75,   14,   75,   75,   28,    0,   26,   75,
+       75,   75,    0,    3,    0,   75,   35,    0,   75,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        1,    0
+    } ;
+
+static const YY_CHAR yy_ec[256] =
+    {   0,
+        1,    1,    1,    1,    1,    1,    1,    1,    2,    3,
+        2,    2,    4,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    2,    5,    6,    1,    1,    7,    8,    1,    9,
+       10,   11,   12,   13,   14,   15,   16,   17,   17,   17,
+       17,   17,   17,   17,   17,   18,   18,   19,   20,   21,
+       22,   23,   24,    1,   25,   26,   27,   28,   29,   30,
+       31,   31,   32,   31,   31,   33,   34,   35,   36,   37,
+       31,   38,   39,   40,   41,   31,   42,   31,   43,   31,
+       44,   45,   46,   47,   48,    1,   49,   50,   51,   52,
+
+       53,   54,   31,   31,   55,   31,   31,   56,   31,   57,
+       58,   59,   31,   60,   61,   62,   63,   31,   31,   64,
+       65,   31,   66,   67,   68,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1
+    } ;
+
+static const YY_CHAR yy_meta[69] =
+    {   0,
+        1,    1,    2,    2,    1,    3,    1,    1,    1,    1,
+        4,    1,    1,    1,    5,    1,    5,    5,    1,    1,
+        1,    1,    1,    1,    6,    6,    6,    6,    6,    6,
+        6,    6,    6,    6,    6,    6,    6,    6,    6,    6,
+        6,    6,    6,    1,    7,    1,    1,    6,    6,    6,
+        6,    6,    6,    6,    6,    6,    6,    6,    6,    6,
+        6,    6,    6,    6,    6,    1,    1,    1
+    } ;
+
+static const flex_int16_t yy_base[353] =
+    {   0,
+        0,   67,  117,    0,  159,    0,  224,    0,  292,  359,
+      411,  465,  971, 1525,   68, 1525,  948, 1525,   20,  961,
+     1525, 1525, 1525, 1525, 1525,  945,  952,   61,   61, 1525,
+     1525,   59,  944,   60, 1525,  950,   61,   69,   70,   72,
+       73, 1525, 1525,  347,  348,  897,  366,  156,  349,    0,
+      961,  940,    0,    0,  953,    0,    0,   78,    0,    0,
+      937,  944,   79,   74,    0,    0,   86,  936,   74,    0,
+      520,    0,  890,  350,  351,  363,  359,  355, 1525,    0,
+      954, 1525,  933, 1525,    0,  946,    0,    0,    0,    0,
+        0,  930,  931,  177,   85,    0,    0,  197,  923,   91,
+
+        0,  588,  372,    0,  867,    0,  206, 1525,  910,    0,
+        0,  923,    0,    0,    0,    0,    0,  882,  851,  180,
+       98,    0,    0,  358,  842,  359,    0,  656,    0,  796,
+      392,  334,  398, 1525, 1525, 1525,  213,  320, 1525,  791,
+      849, 1525, 1525, 1525, 1525,  400,  406, 1525, 1525, 1525,
+     1525, 1525, 1525,    0,  840,  395,  391,  410,  175,  838,
+      836,  172,  834,  412,  368,  420, 1525,  434,  401,  402,
+      437,    0,  846,    0,    0,  440,  446, 1525,    0,    0,
+      467,  430,    0,    0,    0,    0,    0,    0,  724,  792,
+        0,  425,  832,  458,  831,  439,  462,    0,  841,    0,
+
+        0,    0,    0,    0,  479,  457,    0,    0,    0,    0,
+        0,    0,  860,  928, 1525, 1525,  469,  473, 1525, 1525,
+     1525, 1525, 1525,    0,    0,  491, 1525,    0,    0,    0,
+        0,    0,  493,  481,    0,    0,    0,    0,    0,    0,
+      996,    0,    0,  552,  480,  486,  547, 1525, 1525,  835,
+      767,  502, 1525,  507,  814,  813,  808,  498,  530,  532,
+      531,  464,  493,  524,  513,  563,  557, 1064,  555,  807,
+      598,  805,  576, 1132,  545,  555,  580, 1525,  611, 1200,
+      589,    0,  667,  713,  712,  645,  603,  604,  562,  788,
+      577,  537,  634, 1268,  780,  570, 1336,  606,  622,    0,
+
+        0, 1525,  614,  559,  795,  504, 1525,  594,  501,  781,
+      629,  802,  602,  448,  634,  803, 1525,    0,  817,  425,
+      636,  375,  643,  301,  644,  823,  827,  216,  837,  136,
+     1525, 1525, 1400, 1406, 1413, 1420, 1427, 1433, 1439, 1446,
+     1453, 1460,   99, 1467, 1474, 1481, 1484, 1490, 1497, 1503,
+     1510, 1517
+    } ;
+
+static const flex_int16_t yy_def[353] =
+    {   0,
+      332,    1,  332,    3,    1,    5,  332,    7,  332,    9,
+        1,    1,  332,  332,  332,  332,  332,  332,  332,  332,
+      332,  332,  332,  332,  332,  332,  332,  332,  332,  332,
+      332,  332,  332,  332,  332,  333,  333,  333,  333,  333,
+      333,  332,  332,  333,  333,  332,  332,  332,  333,  334,
+      334,  334,  334,  334,  334,  334,  334,  335,  334,  334,
+      334,  334,  334,  334,  334,  334,  334,  334,  334,  334,
+      336,  334,  334,  333,  333,  333,  333,  333,  332,  337,
+      337,  332,  337,  332,  337,  337,  337,  337,  337,  337,
+      337,  337,  337,  337,  337,  337,  337,  337,  337,  337,
+
+      337,  338,  339,  337,  337,  340,  340,  332,  340,  340,
+      340,  340,  340,  340,  340,  340,  340,  340,  340,  340,
+      340,  340,  340,  340,  340,  340,  340,  332,  340,  340,
+      340,  128,  332,  332,  332,  332,  332,  332,  332,  332,
+      341,  332,  332,  332,  332,  342,  332,  332,  332,  332,
+      332,  332,  332,  343,  333,  333,  333,  333,  333,  333,
+      333,  333,  333,  333,  333,  333,  332,  332,  332,  332,
+      333,  334,  334,  334,  334,  335,  335,  332,  334,  334,
+      344,  334,  334,  334,  334,  334,  334,  334,  332,  336,
+      334,  333,  333,  333,  333,  333,  333,  337,  337,  337,
+
+      337,  337,  337,  337,  345,  337,  337,  337,  337,  337,
+      337,  337,  332,  338,  332,  332,  332,  332,  332,  332,
+      332,  332,  332,  337,  340,  340,  332,  340,  340,  340,
+      340,  340,  346,  340,  340,  340,  340,  340,  340,  340,
+      332,  128,  340,  340,  340,  128,  332,  332,  332,  341,
+      341,  342,  332,  342,  347,  333,  333,  333,  333,  333,
+      333,  333,  333,  332,  332,  333,  344,  348,  333,  333,
+      333,  333,  345,  349,  332,  332,  346,  332,  350,  332,
+      340,  128,  341,  347,  333,  333,  333,  333,  333,  333,
+      332,  332,  333,  348,  333,  333,  349,  332,  350,  280,
+
+      340,  332,  333,  333,  333,  333,  332,  332,  333,  333,
+      333,  333,  332,  333,  332,  333,  332,  351,  333,  351,
+      332,  332,  332,  332,  332,  332,  352,  352,  352,  352,
+      332,    0,  332,  332,  332,  332,  332,  332,  332,  332,
+      332,  332,  332,  332,  332,  332,  332,  332,  332,  332,
+      332,  332
+    } ;
+
+static const flex_int16_t yy_nxt[1594] =
+    {   0,
+       14,   15,   16,   16,   17,   18,   19,   20,   21,   22,
+       23,   24,   25,   26,   27,   28,   29,   29,   30,   31,
+       32,   33,   34,   35,   36,   36,   37,   36,   36,   36,
+       36,   36,   36,   36,   38,   36,   36,   39,   40,   36,
+       36,   41,   36,   42,   14,   14,   43,   36,   36,   36,
+       36,   36,   44,   36,   45,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   14,   46,   14,   47,  137,
+      140,  145,  148,   48,  138,  154,  146,  147,  147,  149,
+      150,  152,  153,  154,  154,  141,  154,  154,  177,  145,
+      182,  182,   49,  178,  181,  187,  188,  157,  159,  183,
+
+      156,  206,  206,  162,  255,  160,  184,  185,  163,  158,
+      164,  161,  211,  212,  234,  234,   49,   50,   51,   16,
+       16,   52,   53,   54,   55,   56,   57,   58,   59,   60,
+       61,   62,   63,   64,   64,   65,   66,   67,   68,   69,
+       70,   71,   71,   71,   71,   71,   71,   71,   71,   71,
+       71,   71,   71,   71,   71,   71,   71,   71,   71,   71,
+       50,   50,   50,   72,   71,   71,   71,   71,   71,   71,
+       71,   71,   71,   71,   71,   71,   71,   71,   71,   71,
+       71,   71,   50,   73,   50,   36,  154,  204,   74,  154,
+      232,  170,  205,   75,   76,  233,   36,   36,   77,  259,
+
+       36,   78,   14,  331,   79,  260,  140,  226,  227,  227,
+      207,   36,   74,  170,  137,   75,   76,  208,  209,  138,
+       77,  141,  330,   78,   80,   81,   82,   82,   83,   84,
+       85,   86,   87,   88,   89,   90,   91,   92,   93,   94,
+       95,   95,   96,   97,   98,   99,  100,  101,  102,  102,
+      102,  102,  102,  102,  102,  102,  102,  102,  102,  102,
+      102,  102,  102,  102,  102,  102,  102,   80,  103,   80,
+      104,  102,  102,  102,  102,  102,  102,  102,  102,  102,
+      102,  102,  102,  102,  102,  102,  102,  102,  102,   80,
+      105,   80,  106,  107,  108,  108,  109,  110,  111,  112,
+
+      113,  114,  115,  116,  117,  118,  119,  120,  121,  121,
+      122,  123,  124,  125,  126,  127,  128,  128,  128,  128,
+      128,  128,  128,  128,  128,  128,  128,  128,  128,  128,
+      128,  128,  128,  128,  128,  106,  106,  106,  129,  128,
+      128,  128,  128,  128,  128,  128,  128,  128,  128,  128,
+      128,  128,  128,  128,  128,  128,  128,  106,  130,  106,
+      131,  154,  154,  154,  154,  154,  325,  168,  246,  154,
+      140,  235,  138,  154,  192,  216,  323,  154,  236,  237,
+      239,  240,  154,  197,  171,  141,  193,  132,  217,  218,
+      246,  169,  194,  244,  227,  227,  196,  195,  192,  247,
+
+      248,  248,  253,  254,  166,  154,  171,  197,  193,  154,
+      165,  132,  133,  134,  134,  169,  194,  135,  196,  195,
+      245,  219,  147,  147,  154,  220,  154,  256,  221,  262,
+      322,  222,  257,  223,  154,  168,  264,   36,  265,  154,
+      138,  249,  258,  261,  245,   36,  182,  182,   36,   36,
+      332,  154,   36,  154,  136,  332,  177,  269,  264,  169,
+      265,  178,  154,   36,  266,   36,  133,  134,  134,  253,
+      254,  135,  154,  206,  206,  263,  154,  252,  154,  271,
+      269,  253,  254,  169,  252,  275,  276,  270,  266,  276,
+      276,   36,  226,  227,  227,  278,  279,  234,  234,   36,
+
+      272,  271,   36,   36,  253,  254,   36,  154,  136,  253,
+      254,  270,  154,  282,  281,  154,  289,   36,  154,   36,
+      172,  172,  272,  252,  172,  172,  172,  172,  172,  172,
+      285,  172,  172,  172,  189,  172,  281,  282,  172,  172,
+      172,  172,  172,  172,  154,  154,  154,  290,  247,  248,
+      248,  291,  292,  244,  227,  227,  312,  286,  287,  253,
+      254,  298,  276,  172,  172,  172,  172,  252,  308,  154,
+      288,  276,  276,  154,  292,  291,  154,  154,  253,  254,
+      245,  252,  278,  279,  154,  172,  172,  172,  198,  198,
+      249,  308,  198,  295,  198,  198,  198,  198,  198,  198,
+
+      198,  198,  213,  198,  245,  293,  198,  198,  198,  198,
+      198,  198,  154,  278,  279,  295,  301,  154,  154,  307,
+      252,  305,  276,  276,  278,  279,  296,  293,  154,  313,
+      315,  198,  304,  198,  198,  315,  317,  321,  303,  318,
+      301,  307,  138,  154,  323,  326,  327,  327,  154,  324,
+      296,  313,  310,  198,  198,  198,  225,  225,  317,  154,
+      225,  225,  225,  225,  225,  225,  225,  225,  225,  225,
+      241,  225,  242,  242,  225,  225,  225,  225,  225,  225,
+      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
+      242,  242,  242,  242,  242,  242,  242,  242,  242,  225,
+
+      225,  225,  225,  242,  242,  242,  242,  242,  242,  242,
+      242,  242,  242,  242,  242,  242,  242,  242,  242,  242,
+      242,  225,  225,  225,  172,  172,  154,  154,  172,  172,
+      172,  172,  172,  172,  302,  172,  172,  172,  172,  172,
+      172,  172,  172,  172,  172,  172,  172,  172,  268,  268,
+      268,  268,  268,  268,  268,  268,  268,  268,  268,  268,
+      268,  268,  268,  268,  268,  268,  268,  172,  172,  172,
+      172,  268,  268,  268,  268,  268,  268,  268,  268,  268,
+      268,  268,  268,  268,  268,  268,  268,  268,  268,  172,
+      172,  172,  172,  172,  154,  154,  172,  172,  172,  172,
+
+      172,  172,  154,  172,  172,  172,  189,  172,  309,  154,
+      172,  172,  172,  172,  172,  172,  154,  154,  321,  154,
+      314,  154,  154,  138,  326,  327,  327,  154,  154,  329,
+      329,  154,  309,  330,  332,  172,  172,  172,  172,  329,
+      329,  283,  199,  330,  306,  154,  154,  173,  154,  316,
+      154,  311,  154,  319,  154,  251,  141,  172,  172,  172,
+      198,  198,  243,  238,  198,  231,  198,  198,  198,  198,
+      198,  198,  198,  198,  198,  198,  198,  198,  198,  198,
+      198,  198,  198,  198,  274,  274,  274,  274,  274,  274,
+      274,  274,  274,  274,  274,  274,  274,  274,  274,  274,
+
+      274,  274,  274,  198,  230,  198,  198,  274,  274,  274,
+      274,  274,  274,  274,  274,  274,  274,  274,  274,  274,
+      274,  274,  274,  274,  274,  198,  198,  198,  198,  198,
+      229,  228,  198,  224,  198,  198,  198,  198,  198,  198,
+      198,  198,  213,  198,  210,  203,  198,  198,  198,  198,
+      198,  198,  202,  201,  200,  199,  191,  186,  180,  179,
+      175,  174,  173,  167,  154,  151,  144,  143,  142,  139,
+      332,  198,  332,  198,  198,  332,  332,  332,  332,  332,
+      332,  332,  332,  332,  332,  332,  332,  332,  332,  332,
+      332,  332,  332,  198,  198,  198,  225,  225,  332,  332,
+
+      225,  225,  225,  225,  225,  225,  225,  225,  225,  225,
+      225,  225,  225,  225,  225,  225,  225,  225,  225,  225,
+      280,  280,  280,  280,  280,  280,  280,  280,  280,  280,
+      280,  280,  280,  280,  280,  280,  280,  280,  280,  225,
+      225,  225,  225,  280,  280,  280,  280,  280,  280,  280,
+      280,  280,  280,  280,  280,  280,  280,  280,  280,  280,
+      280,  225,  225,  225,  172,  172,  332,  332,  172,  172,
+      172,  172,  172,  172,  332,  172,  172,  172,  189,  172,
+      332,  332,  172,  172,  172,  172,  172,  172,  332,  332,
+      332,  332,  332,  332,  332,  332,  332,  332,  332,  332,
+
+      332,  332,  332,  332,  332,  332,  332,  172,  172,  172,
+      172,  332,  332,  332,  332,  332,  332,  332,  332,  332,
+      332,  332,  332,  332,  332,  332,  332,  332,  332,  172,
+      172,  172,  198,  198,  332,  332,  198,  332,  198,  198,
+      198,  198,  198,  198,  198,  198,  213,  198,  332,  332,
+      198,  198,  198,  198,  198,  198,  332,  332,  332,  332,
+      332,  332,  332,  332,  332,  332,  332,  332,  332,  332,
+      332,  332,  332,  332,  332,  198,  332,  198,  198,  332,
+      332,  332,  332,  332,  332,  332,  332,  332,  332,  332,
+      332,  332,  332,  332,  332,  332,  332,  198,  198,  198,
+
+      225,  225,  332,  332,  225,  225,  225,  225,  225,  225,
+      225,  225,  225,  225,  241,  225,  300,  300,  225,  225,
+      225,  225,  225,  225,  300,  300,  300,  300,  300,  300,
+      300,  300,  300,  300,  300,  300,  300,  300,  300,  300,
+      300,  300,  300,  225,  225,  225,  225,  300,  300,  300,
+      300,  300,  300,  300,  300,  300,  300,  300,  300,  300,
+      300,  300,  300,  300,  300,  225,  225,  225,  172,  172,
+      332,  332,  172,  172,  172,  172,  172,  172,  332,  172,
+      172,  172,  189,  172,  332,  332,  172,  172,  172,  172,
+      172,  172,  332,  332,  332,  332,  332,  332,  332,  332,
+
+      332,  332,  332,  332,  332,  332,  332,  332,  332,  332,
+      332,  172,  172,  172,  172,  332,  332,  332,  332,  332,
+      332,  332,  332,  332,  332,  332,  332,  332,  332,  332,
+      332,  332,  332,  172,  172,  172,  198,  198,  332,  332,
+      198,  332,  198,  198,  198,  198,  198,  198,  198,  198,
+      213,  198,  332,  332,  198,  198,  198,  198,  198,  198,
+      332,  332,  332,  332,  332,  332,  332,  332,  332,  332,
+      332,  332,  332,  332,  332,  332,  332,  332,  332,  198,
+      332,  198,  198,  332,  332,  332,  332,  332,  332,  332,
+      332,  332,  332,  332,  332,  332,  332,  332,  332,  332,
+
+      332,  198,  198,  198,  155,  155,  172,  332,  172,  332,
+      172,  172,  172,  176,  332,  176,  176,  176,  176,  176,
+      190,  332,  190,  332,  190,  190,  190,  198,  332,  332,
+      198,  198,  198,  214,  332,  332,  214,  214,  214,  215,
+      215,  215,  215,  215,  215,  215,  225,  332,  225,  225,
+      225,  225,  225,  250,  250,  250,  250,  250,  250,  250,
+      252,  252,  252,  252,  252,  252,  252,  267,  267,  267,
+      267,  267,  267,  267,  273,  273,  273,  273,  273,  273,
+      273,  277,  277,  277,  277,  277,  277,  277,  284,  284,
+      294,  332,  294,  332,  294,  294,  294,  297,  332,  332,
+
+      297,  297,  297,  299,  299,  299,  299,  299,  299,  299,
+      320,  320,  332,  320,  320,  320,  320,  328,  328,  328,
+      328,  328,  328,  328,   13,  332,  332,  332,  332,  332,
+      332,  332,  332,  332,  332,  332,  332,  332,  332,  332,
+      332,  332,  332,  332,  332,  332,  332,  332,  332,  332,
+      332,  332,  332,  332,  332,  332,  332,  332,  332,  332,
+      332,  332,  332,  332,  332,  332,  332,  332,  332,  332,
+      332,  332,  332,  332,  332,  332,  332,  332,  332,  332,
+      332,  332,  332,  332,  332,  332,  332,  332,  332,  332,
+      332,  332,  332
+
+    } ;
+
+static const flex_int16_t yy_chk[1594] =
+    {   0,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    2,   15,
+       19,   28,   32,    2,   15,   37,   28,   29,   29,   32,
+       32,   34,   34,   38,   39,   19,   40,   41,   58,   63,
+       64,   64,    2,   58,   63,   69,   69,   38,   39,   67,
+
+       37,   95,   95,   40,  343,   39,   67,   67,   41,   38,
+       41,   39,  100,  100,  121,  121,    2,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    5,  162,   94,    5,  159,
+      120,   48,   94,    5,    5,  120,    5,    5,    5,  159,
+
+        5,    5,    5,  330,    5,  162,   48,  107,  107,  107,
+       98,    5,    5,   48,  137,    5,    5,   98,   98,  137,
+        5,   48,  328,    5,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    9,    9,    9,    9,    9,    9,    9,    9,
+
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+       10,   44,   45,   49,   74,   75,  324,   47,  132,   78,
+      138,  124,   47,   77,   74,  103,  322,   76,  124,  124,
+      126,  126,  165,   78,   49,  138,   75,   10,  103,  103,
+      132,   47,   76,  131,  131,  131,   77,   76,   74,  133,
+
+      133,  133,  146,  146,   45,  157,   49,   78,   75,  156,
+       44,   10,   11,   11,   11,   47,   76,   11,   77,   76,
+      131,  103,  147,  147,  158,  103,  164,  156,  103,  165,
+      320,  103,  157,  103,  166,  168,  169,   11,  170,  192,
+      168,  133,  158,  164,  131,   11,  182,  182,   11,   11,
+      176,  171,   11,  196,   11,  176,  177,  192,  169,  168,
+      170,  177,  314,   11,  171,   11,   12,   12,   12,  181,
+      181,   12,  194,  206,  206,  166,  197,  181,  262,  196,
+      192,  205,  205,  168,  205,  217,  217,  194,  171,  218,
+      218,   12,  226,  226,  226,  233,  233,  234,  234,   12,
+
+      197,  196,   12,   12,  252,  252,   12,  263,   12,  254,
+      254,  194,  258,  246,  245,  309,  262,   12,  306,   12,
+       71,   71,  197,  205,   71,   71,   71,   71,   71,   71,
+      258,   71,   71,   71,   71,   71,  245,  246,   71,   71,
+       71,   71,   71,   71,  259,  261,  260,  263,  247,  247,
+      247,  264,  265,  244,  244,  244,  306,  259,  260,  267,
+      267,  275,  275,   71,   71,   71,   71,  267,  292,  269,
+      261,  276,  276,  304,  265,  264,  289,  266,  273,  273,
+      244,  273,  277,  277,  296,   71,   71,   71,  102,  102,
+      247,  292,  102,  269,  102,  102,  102,  102,  102,  102,
+
+      102,  102,  102,  102,  244,  266,  102,  102,  102,  102,
+      102,  102,  271,  279,  279,  269,  281,  287,  288,  291,
+      273,  289,  298,  298,  299,  299,  271,  266,  303,  308,
+      311,  102,  288,  102,  102,  315,  313,  321,  287,  315,
+      281,  291,  321,  311,  323,  325,  325,  325,  293,  323,
+      271,  308,  303,  102,  102,  102,  128,  128,  313,  286,
+      128,  128,  128,  128,  128,  128,  128,  128,  128,  128,
+      128,  128,  128,  128,  128,  128,  128,  128,  128,  128,
+      128,  128,  128,  128,  128,  128,  128,  128,  128,  128,
+      128,  128,  128,  128,  128,  128,  128,  128,  128,  128,
+
+      128,  128,  128,  128,  128,  128,  128,  128,  128,  128,
+      128,  128,  128,  128,  128,  128,  128,  128,  128,  128,
+      128,  128,  128,  128,  189,  189,  285,  284,  189,  189,
+      189,  189,  189,  189,  283,  189,  189,  189,  189,  189,
+      189,  189,  189,  189,  189,  189,  189,  189,  189,  189,
+      189,  189,  189,  189,  189,  189,  189,  189,  189,  189,
+      189,  189,  189,  189,  189,  189,  189,  189,  189,  189,
+      189,  189,  189,  189,  189,  189,  189,  189,  189,  189,
+      189,  189,  189,  189,  189,  189,  189,  189,  189,  189,
+      189,  189,  190,  190,  295,  310,  190,  190,  190,  190,
+
+      190,  190,  290,  190,  190,  190,  190,  190,  295,  305,
+      190,  190,  190,  190,  190,  190,  312,  316,  319,  272,
+      310,  270,  257,  319,  326,  326,  326,  256,  255,  327,
+      327,  319,  295,  327,  251,  190,  190,  190,  190,  329,
+      329,  250,  199,  329,  290,  195,  193,  173,  163,  312,
+      161,  305,  160,  316,  155,  141,  140,  190,  190,  190,
+      213,  213,  130,  125,  213,  119,  213,  213,  213,  213,
+      213,  213,  213,  213,  213,  213,  213,  213,  213,  213,
+      213,  213,  213,  213,  213,  213,  213,  213,  213,  213,
+      213,  213,  213,  213,  213,  213,  213,  213,  213,  213,
+
+      213,  213,  213,  213,  118,  213,  213,  213,  213,  213,
+      213,  213,  213,  213,  213,  213,  213,  213,  213,  213,
+      213,  213,  213,  213,  213,  213,  213,  213,  214,  214,
+      112,  109,  214,  105,  214,  214,  214,  214,  214,  214,
+      214,  214,  214,  214,   99,   93,  214,  214,  214,  214,
+      214,  214,   92,   86,   83,   81,   73,   68,   62,   61,
+       55,   52,   51,   46,   36,   33,   27,   26,   20,   17,
+       13,  214,    0,  214,  214,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,  214,  214,  214,  241,  241,    0,    0,
+
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  268,  268,    0,    0,  268,  268,
+      268,  268,  268,  268,    0,  268,  268,  268,  268,  268,
+        0,    0,  268,  268,  268,  268,  268,  268,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+
+        0,    0,    0,    0,    0,    0,    0,  268,  268,  268,
+      268,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,  268,
+      268,  268,  274,  274,    0,    0,  274,    0,  274,  274,
+      274,  274,  274,  274,  274,  274,  274,  274,    0,    0,
+      274,  274,  274,  274,  274,  274,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,  274,    0,  274,  274,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,  274,  274,  274,
+
+      280,  280,    0,    0,  280,  280,  280,  280,  280,  280,
+      280,  280,  280,  280,  280,  280,  280,  280,  280,  280,
+      280,  280,  280,  280,  280,  280,  280,  280,  280,  280,
+      280,  280,  280,  280,  280,  280,  280,  280,  280,  280,
+      280,  280,  280,  280,  280,  280,  280,  280,  280,  280,
+      280,  280,  280,  280,  280,  280,  280,  280,  280,  280,
+      280,  280,  280,  280,  280,  280,  280,  280,  294,  294,
+        0,    0,  294,  294,  294,  294,  294,  294,    0,  294,
+      294,  294,  294,  294,    0,    0,  294,  294,  294,  294,
+      294,  294,    0,    0,    0,    0,    0,    0,    0,    0,
+
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,  294,  294,  294,  294,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,  294,  294,  294,  297,  297,    0,    0,
+      297,    0,  297,  297,  297,  297,  297,  297,  297,  297,
+      297,  297,    0,    0,  297,  297,  297,  297,  297,  297,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,  297,
+        0,  297,  297,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+
+        0,  297,  297,  297,  333,  333,  334,    0,  334,    0,
+      334,  334,  334,  335,    0,  335,  335,  335,  335,  335,
+      336,    0,  336,    0,  336,  336,  336,  337,    0,    0,
+      337,  337,  337,  338,    0,    0,  338,  338,  338,  339,
+      339,  339,  339,  339,  339,  339,  340,    0,  340,  340,
+      340,  340,  340,  341,  341,  341,  341,  341,  341,  341,
+      342,  342,  342,  342,  342,  342,  342,  344,  344,  344,
+      344,  344,  344,  344,  345,  345,  345,  345,  345,  345,
+      345,  346,  346,  346,  346,  346,  346,  346,  347,  347,
+      348,    0,  348,    0,  348,  348,  348,  349,    0,    0,
+
+      349,  349,  349,  350,  350,  350,  350,  350,  350,  350,
+      351,  351,    0,  351,  351,  351,  351,  352,  352,  352,
+      352,  352,  352,  352,  332,  332,  332,  332,  332,  332,
+      332,  332,  332,  332,  332,  332,  332,  332,  332,  332,
+      332,  332,  332,  332,  332,  332,  332,  332,  332,  332,
+      332,  332,  332,  332,  332,  332,  332,  332,  332,  332,
+      332,  332,  332,  332,  332,  332,  332,  332,  332,  332,
+      332,  332,  332,  332,  332,  332,  332,  332,  332,  332,
+      332,  332,  332,  332,  332,  332,  332,  332,  332,  332,
+      332,  332,  332
+
+    } ;
+
+/* Table of booleans, true if rule could match eol. */
+static const flex_int32_t yy_rule_can_match_eol[77] =
+    {   0,
+1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 1, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0,     };
+
+static yy_state_type yy_last_accepting_state;
+static char *yy_last_accepting_cpos;
+
+extern int yy_flex_debug;
+int yy_flex_debug = 0;
+
+/* The intent behind this definition is that it'll catch
+ * any uses of REJECT which flex missed.
+ */
+#define REJECT reject_used_but_not_detected
+static int yy_more_flag = 0;
+static int yy_more_len = 0;
+#define yymore() ((yy_more_flag) = 1)
+#define YY_MORE_ADJ (yy_more_len)
+#define YY_RESTORE_YY_MORE_OFFSET
+char *yytext;
+/*
+ * Copyright (c) 2009-2022 The University of Tennessee and The University
+ *                         of Tennessee Research Foundation.  All rights
+ *                         reserved.
+ */
+
+/* When FLEX_FOUND is set, normal dependency tracking will generate the
+ * .l.c in the build directory from the .l in the source directory (this file).
+ * In addition, one shall invoke by hand the rule to update the pregen
+ * .l.c files, before committing any changes to the .l files, e.g.,
+ * `make parsec_pregen_flex_bison`.
+ *
+ * When FLEX_FOUND is not set, the .l.c version of this file is copied
+ * from the pregenerated .l.c file in `contrib/pregen_flex_bison`, and
+ * modifying this file will result in a compilation error.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <assert.h>
+
+#include "parsec/parsec_config.h"
+#include "jdf.h"
+
+extern char *yyfilename;
+extern int current_lineno;
+
+#if 0
+#define ECHO {fwrite("[", 1, 1, yyout);fwrite( yytext, yyleng, 1, yyout );fwrite("]", 1, 1, yyout);}
+#endif
+#define ECHO
+
+static char *extern_code(char *base, int len, int line)
+{
+     char *res;
+     int rp, rlen;
+
+     rlen = len + 16 + strlen(yyfilename);
+     res = (char*)calloc(1, rlen);
+
+     rp = 0;
+     if( !JDF_COMPILER_GLOBAL_ARGS.noline && line) {
+         /**
+          * As each extern_code is contiguous we only have to set the #line once.
+          */
+         rp += snprintf(res + rp, rlen - rp, "#line %d \"%s\"\n", current_lineno, yyfilename);
+     }
+     memcpy(res + rp, base, len);
+     rp += len;
+     res[rp] = '\0';
+     for(rp = 0; rp < len; rp++) {
+         if( base[rp] == '\n' ) {
+             current_lineno++;
+         }
+     }
+     return res;
+}
+
+#define MAX_STR_CONST  1024
+
+char string_buf[MAX_STR_CONST];
+char *string_buf_ptr;
+
+#if defined(PARSEC_HAVE_RECENT_LEX)
+#define YY_USER_ACTION yylloc->first_line = yylloc->last_line = yylineno; \
+    yylloc->first_column = yycolumn; yylloc->last_column = yycolumn + yyleng - 1; \
+    yycolumn += yyleng;
+#define YYLVAL(field)         yylval->field
+#define YY_PUSH_STATE(STATE)  yy_push_state(STATE, yyscanner)
+#define YY_POP_STATE()        yy_pop_state(yyscanner)
+#else
+#define YYLVAL(field)         yylval.field
+#define YY_PUSH_STATE(STATE)  yy_push_state(STATE)
+#define YY_POP_STATE()        yy_pop_state()
+typedef void* yyscan_t;
+#endif  /* defined(PARSEC_HAVE_RECENT_LEX) */
+#if defined(YYPURE) && YYPURE
+#define YY_DECL int yylex(struct yyscan_t *yycontrol)
+#else
+#define YY_DECL int yylex(void)
+#endif
+#include "parsec.y.h"
+/*%option bison-bridge bison-locations*/
+/*%option reentrant*/
+#define YY_NO_INPUT 1
+/*%option debug*/
+
+#define INITIAL 0
+#define comment 1
+#define properties 2
+#define dstr 3
+#define body 4
+#define body_init 5
+
+#ifndef YY_NO_UNISTD_H
+/* Special case for "unistd.h", since it is non-ANSI. We include it way
+ * down here because we want the user's section 1 to have been scanned first.
+ * The user has a chance to override it with an option.
+ */
+#include <unistd.h>
+#endif
+
+#ifndef YY_EXTRA_TYPE
+#define YY_EXTRA_TYPE void *
+#endif
+
+static int yy_init_globals ( void );
+
+/* Accessor methods to globals.
+   These are made visible to non-reentrant scanners for convenience. */
+
+int yylex_destroy ( void );
+
+int yyget_debug ( void );
+
+void yyset_debug ( int debug_flag  );
+
+YY_EXTRA_TYPE yyget_extra ( void );
+
+void yyset_extra ( YY_EXTRA_TYPE user_defined  );
+
+FILE *yyget_in ( void );
+
+void yyset_in  ( FILE * _in_str  );
+
+FILE *yyget_out ( void );
+
+void yyset_out  ( FILE * _out_str  );
+
+			int yyget_leng ( void );
+
+char *yyget_text ( void );
+
+int yyget_lineno ( void );
+
+void yyset_lineno ( int _line_number  );
+
+/* Macros after this point can all be overridden by user definitions in
+ * section 1.
+ */
+
+#ifndef YY_SKIP_YYWRAP
+#ifdef __cplusplus
+extern "C" int yywrap ( void );
+#else
+extern int yywrap ( void );
+#endif
+#endif
+
+#ifndef YY_NO_UNPUT
+    
+#endif
+
+#ifndef yytext_ptr
+static void yy_flex_strncpy ( char *, const char *, int );
+#endif
+
+#ifdef YY_NEED_STRLEN
+static int yy_flex_strlen ( const char * );
+#endif
+
+#ifndef YY_NO_INPUT
+#ifdef __cplusplus
+static int yyinput ( void );
+#else
+static int input ( void );
+#endif
+
+#endif
+
+        static int yy_start_stack_ptr = 0;
+        static int yy_start_stack_depth = 0;
+        static int *yy_start_stack = NULL;
+    
+    static void yy_push_state ( int _new_state );
+    
+    static void yy_pop_state ( void );
+    
+/* Amount of stuff to slurp up with each read. */
+#ifndef YY_READ_BUF_SIZE
+#ifdef __ia64__
+/* On IA-64, the buffer size is 16k, not 8k */
+#define YY_READ_BUF_SIZE 16384
+#else
+#define YY_READ_BUF_SIZE 8192
+#endif /* __ia64__ */
+#endif
+
+/* Copy whatever the last rule matched to the standard output. */
+#ifndef ECHO
+/* This used to be an fputs(), but since the string might contain NUL's,
+ * we now use fwrite().
+ */
+#define ECHO do { if (fwrite( yytext, (size_t) yyleng, 1, yyout )) {} } while (0)
+#endif
+
+/* Gets input and stuffs it into "buf".  number of characters read, or YY_NULL,
+ * is returned in "result".
+ */
+#ifndef YY_INPUT
+#define YY_INPUT(buf,result,max_size) \
+	if ( YY_CURRENT_BUFFER_LVALUE->yy_is_interactive ) \
+		{ \
+		int c = '*'; \
+		int n; \
+		for ( n = 0; n < max_size && \
+			     (c = getc( yyin )) != EOF && c != '\n'; ++n ) \
+			buf[n] = (char) c; \
+		if ( c == '\n' ) \
+			buf[n++] = (char) c; \
+		if ( c == EOF && ferror( yyin ) ) \
+			YY_FATAL_ERROR( "input in flex scanner failed" ); \
+		result = n; \
+		} \
+	else \
+		{ \
+		errno=0; \
+		while ( (result = (int) fread(buf, 1, (yy_size_t) max_size, yyin)) == 0 && ferror(yyin)) \
+			{ \
+			if( errno != EINTR) \
+				{ \
+				YY_FATAL_ERROR( "input in flex scanner failed" ); \
+				break; \
+				} \
+			errno=0; \
+			clearerr(yyin); \
+			} \
+		}\
+\
+
+#endif
+
+/* No semi-colon after return; correct usage is to write "yyterminate();" -
+ * we don't want an extra ';' after the "return" because that will cause
+ * some compilers to complain about unreachable statements.
+ */
+#ifndef yyterminate
+#define yyterminate() return YY_NULL
+#endif
+
+/* Number of entries by which start-condition stack grows. */
+#ifndef YY_START_STACK_INCR
+#define YY_START_STACK_INCR 25
+#endif
+
+/* Report a fatal error. */
+#ifndef YY_FATAL_ERROR
+#define YY_FATAL_ERROR(msg) yy_fatal_error( msg )
+#endif
+
+/* end tables serialization structures and prototypes */
+
+/* Default declaration of generated scanner - a define so the user can
+ * easily add parameters.
+ */
+#ifndef YY_DECL
+#define YY_DECL_IS_OURS 1
+
+extern int yylex (void);
+
+#define YY_DECL int yylex (void)
+#endif /* !YY_DECL */
+
+/* Code executed at the beginning of each rule, after yytext and yyleng
+ * have been set up.
+ */
+#ifndef YY_USER_ACTION
+#define YY_USER_ACTION
+#endif
+
+/* Code executed at the end of each rule. */
+#ifndef YY_BREAK
+#define YY_BREAK /*LINTED*/break;
+#endif
+
+#define YY_RULE_SETUP \
+	if ( yyleng > 0 ) \
+		YY_CURRENT_BUFFER_LVALUE->yy_at_bol = \
+				(yytext[yyleng - 1] == '\n'); \
+	YY_USER_ACTION
+
+/** The main scanner function which does all the work.
+ */
+YY_DECL
+{
+	yy_state_type yy_current_state;
+	char *yy_cp, *yy_bp;
+	int yy_act;
+    
+	if ( !(yy_init) )
+		{
+		(yy_init) = 1;
+
+#ifdef YY_USER_INIT
+		YY_USER_INIT;
+#endif
+
+		if ( ! (yy_start) )
+			(yy_start) = 1;	/* first start state */
+
+		if ( ! yyin )
+			yyin = stdin;
+
+		if ( ! yyout )
+			yyout = stdout;
+
+		if ( ! YY_CURRENT_BUFFER ) {
+			yyensure_buffer_stack ();
+			YY_CURRENT_BUFFER_LVALUE =
+				yy_create_buffer( yyin, YY_BUF_SIZE );
+		}
+
+		yy_load_buffer_state(  );
+		}
+
+	{
+
+	while ( /*CONSTCOND*/1 )		/* loops until end-of-file is reached */
+		{
+		(yy_more_len) = 0;
+		if ( (yy_more_flag) )
+			{
+			(yy_more_len) = (int) ((yy_c_buf_p) - (yytext_ptr));
+			(yy_more_flag) = 0;
+			}
+		yy_cp = (yy_c_buf_p);
+
+		/* Support of yytext. */
+		*yy_cp = (yy_hold_char);
+
+		/* yy_bp points to the position in yy_ch_buf of the start of
+		 * the current run.
+		 */
+		yy_bp = yy_cp;
+
+		yy_current_state = (yy_start);
+		yy_current_state += YY_AT_BOL();
+yy_match:
+		do
+			{
+			YY_CHAR yy_c = yy_ec[YY_SC_TO_UI(*yy_cp)] ;
+			if ( yy_accept[yy_current_state] )
+				{
+				(yy_last_accepting_state) = yy_current_state;
+				(yy_last_accepting_cpos) = yy_cp;
+				}
+			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
+				{
+				yy_current_state = (int) yy_def[yy_current_state];
+				if ( yy_current_state >= 333 )
+					yy_c = yy_meta[yy_c];
+				}
+			yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
+			++yy_cp;
+			}
+		while ( yy_base[yy_current_state] != 1525 );
+
+yy_find_action:
+		yy_act = yy_accept[yy_current_state];
+		if ( yy_act == 0 )
+			{ /* have to back up */
+			yy_cp = (yy_last_accepting_cpos);
+			yy_current_state = (yy_last_accepting_state);
+			yy_act = yy_accept[yy_current_state];
+			}
+
+		YY_DO_BEFORE_ACTION;
+
+		if ( yy_act != YY_END_OF_BUFFER && yy_rule_can_match_eol[yy_act] )
+			{
+			int yyl;
+			for ( yyl = (yy_more_len); yyl < yyleng; ++yyl )
+				if ( yytext[yyl] == '\n' )
+					
+    yylineno++;
+;
+			}
+
+do_action:	/* This label is used only to access EOF actions. */
+
+		switch ( yy_act )
+	{ /* beginning of action switch */
+			case 0: /* must back up */
+			/* undo the effects of YY_DO_BEFORE_ACTION */
+			*yy_cp = (yy_hold_char);
+			yy_cp = (yy_last_accepting_cpos);
+			yy_current_state = (yy_last_accepting_state);
+			goto yy_find_action;
+
+case 1:
+/* rule 1 can match eol */
+YY_RULE_SETUP
+{
+                          int lstart, lend, bstart, skip_line = 0;
+                          /* This assumes that no extern language rightfully has a "
+                           * in its name, which is also an assumption of the lexer anyway */
+
+                          /* find the beginning of the language */
+                          for(lstart = 0; yytext[lstart] != '"'; lstart++) /* nothing */;
+                          lstart++;
+
+                          /* find the end of the language */
+                          for(lend = lstart + 1; yytext[lend] != '"'; lend++) /* nothing */;
+                          assert( (yytext[lstart] == 'C') && ((lend-lstart) == 1) );
+
+                          /* Search for the start of the body */
+                          for(bstart = lend + 1; yytext[bstart] != '{'; bstart++ ) /* nothing */;
+                          bstart++;
+                          while( yytext[bstart] != '\n' ) bstart++;
+                          bstart++;
+                          for( lend = 0; lend <= bstart; lend++ )
+                              if( yytext[lend] == '\n' ) skip_line++;
+                          current_lineno += skip_line;
+                          YYLVAL(string) = extern_code( yytext + bstart, strlen(yytext)-bstart-2, 1 );
+                          ECHO; return EXTERN_DECL;
+                      }
+	YY_BREAK
+case 2:
+/* rule 2 can match eol */
+YY_RULE_SETUP
+{
+                          int start;
+                          for(start = 0; yytext[start] != '{'; start++) /* nothing */ ;
+                          start++;
+                          YYLVAL(string) = extern_code( yytext + start, strlen(yytext)-start-2, 0 );
+                          ECHO; return EXTERN_DECL;
+                      }
+	YY_BREAK
+case 3:
+YY_RULE_SETUP
+{ ECHO; return SIMCOST; }
+	YY_BREAK
+case 4:
+YY_RULE_SETUP
+{ YY_PUSH_STATE(comment);                            }
+	YY_BREAK
+case 5:
+YY_RULE_SETUP
+{  /* Eat up non '*'s */                             }
+	YY_BREAK
+case 6:
+YY_RULE_SETUP
+{  /* Eat '*'s not followed by a '/' */            }
+	YY_BREAK
+case 7:
+YY_RULE_SETUP
+{ YY_POP_STATE();  /* Done with the comment BLOCK */ }
+	YY_BREAK
+case 8:
+YY_RULE_SETUP
+{  /* Eat multiple white-spaces */                   }
+	YY_BREAK
+case 9:
+YY_RULE_SETUP
+{ YYLVAL(number) = atol(yytext);
+                        ECHO; return JDF_INT;                              }
+	YY_BREAK
+case 10:
+YY_RULE_SETUP
+{ YYLVAL(number) = JDF_FLOW_TYPE_CTL;
+                        ECHO; return DEPENDENCY_TYPE;                      }
+	YY_BREAK
+case 11:
+YY_RULE_SETUP
+{ YYLVAL(number) = JDF_FLOW_TYPE_READ | JDF_FLOW_TYPE_WRITE;
+                        ECHO; return DEPENDENCY_TYPE;                      }
+	YY_BREAK
+case 12:
+YY_RULE_SETUP
+{ YYLVAL(number) = JDF_FLOW_TYPE_READ;
+                        ECHO; return DEPENDENCY_TYPE;                      }
+	YY_BREAK
+case 13:
+YY_RULE_SETUP
+{ YYLVAL(number) = JDF_FLOW_TYPE_READ;
+                        ECHO; return DEPENDENCY_TYPE;                      }
+	YY_BREAK
+case 14:
+YY_RULE_SETUP
+{ YYLVAL(number) = JDF_FLOW_TYPE_WRITE;
+                        ECHO; return DEPENDENCY_TYPE;                      }
+	YY_BREAK
+case 15:
+YY_RULE_SETUP
+{ YYLVAL(number) = JDF_FLOW_TYPE_WRITE;
+                        ECHO; return DEPENDENCY_TYPE;                      }
+	YY_BREAK
+case 16:
+YY_RULE_SETUP
+{ ECHO; return DATA_NEW;                             }
+	YY_BREAK
+case 17:
+YY_RULE_SETUP
+{ ECHO; return DATA_NULL;                            }
+	YY_BREAK
+case 18:
+YY_RULE_SETUP
+{ YYLVAL(dep_type) = JDF_DEP_FLOW_OUT;
+                        ECHO; return ARROW;                                }
+	YY_BREAK
+case 19:
+YY_RULE_SETUP
+{ YYLVAL(dep_type) = JDF_DEP_FLOW_IN;
+                        ECHO; return ARROW;                                }
+	YY_BREAK
+case 20:
+YY_RULE_SETUP
+{ YYLVAL(property) = NULL;
+                        YY_PUSH_STATE(properties);
+                        ECHO; return PROPERTIES_ON;                        }
+	YY_BREAK
+case 21:
+YY_RULE_SETUP
+{ YY_POP_STATE();
+                        ECHO; return PROPERTIES_OFF;                       }
+	YY_BREAK
+case 22:
+YY_RULE_SETUP
+{ YYLVAL(number) = 1;
+                        ECHO; return JDF_INT;                              }
+	YY_BREAK
+case 23:
+YY_RULE_SETUP
+{
+                        YYLVAL(number) = 1;
+                        ECHO; return JDF_INT;                              }
+	YY_BREAK
+case 24:
+YY_RULE_SETUP
+{
+                        YYLVAL(number) = 1;
+                        ECHO; return JDF_INT;                              }
+	YY_BREAK
+case 25:
+YY_RULE_SETUP
+{
+                        YYLVAL(number) = 0;
+                        ECHO; return JDF_INT;                              }
+	YY_BREAK
+case 26:
+YY_RULE_SETUP
+{
+                        YYLVAL(number) = 0;
+                        ECHO; return JDF_INT;                              }
+	YY_BREAK
+case 27:
+YY_RULE_SETUP
+{  YYLVAL(number) = 0;
+                        ECHO; return JDF_INT;                              }
+	YY_BREAK
+case 28:
+YY_RULE_SETUP
+{
+                           YY_PUSH_STATE(body_init);
+                           return BODY_START;                              }
+	YY_BREAK
+case 29:
+YY_RULE_SETUP
+{
+                           YY_PUSH_STATE(properties);
+                           return PROPERTIES_ON;                           }
+	YY_BREAK
+case 30:
+/* rule 30 can match eol */
+YY_RULE_SETUP
+{    current_lineno++;
+                           YY_POP_STATE();
+                           YY_PUSH_STATE(body);                            }
+	YY_BREAK
+case 31:
+YY_RULE_SETUP
+{ YY_POP_STATE();
+                          YYLVAL(string) = extern_code(yytext, strlen(yytext) - 3, 1);
+                          ECHO; return BODY_END;                           }
+	YY_BREAK
+case 32:
+YY_RULE_SETUP
+{ yymore();}
+	YY_BREAK
+case 33:
+/* rule 33 can match eol */
+YY_RULE_SETUP
+{ yymore();}
+	YY_BREAK
+case 34:
+/* rule 34 can match eol */
+YY_RULE_SETUP
+{ yymore(); }
+	YY_BREAK
+case 35:
+YY_RULE_SETUP
+{ ECHO; return OPTION;                               }
+	YY_BREAK
+case 36:
+YY_RULE_SETUP
+{ ECHO; return OPEN_PAR;                             }
+	YY_BREAK
+case 37:
+YY_RULE_SETUP
+{ ECHO; return CLOSE_PAR;                            }
+	YY_BREAK
+case 38:
+YY_RULE_SETUP
+{ ECHO; return EQUAL;                                }
+	YY_BREAK
+case 39:
+YY_RULE_SETUP
+{ ECHO; return NOTEQUAL;                             }
+	YY_BREAK
+case 40:
+YY_RULE_SETUP
+{ ECHO; return AND;                                  }
+	YY_BREAK
+case 41:
+YY_RULE_SETUP
+{ ECHO; return OR;                                   }
+	YY_BREAK
+case 42:
+YY_RULE_SETUP
+{ ECHO; return XOR;                                  }
+	YY_BREAK
+case 43:
+YY_RULE_SETUP
+{ ECHO; return LESS;                                 }
+	YY_BREAK
+case 44:
+YY_RULE_SETUP
+{ ECHO; return LEQ;                                  }
+	YY_BREAK
+case 45:
+YY_RULE_SETUP
+{ ECHO; return MORE;                                 }
+	YY_BREAK
+case 46:
+YY_RULE_SETUP
+{ ECHO; return MEQ;                                  }
+	YY_BREAK
+case 47:
+YY_RULE_SETUP
+{ ECHO; return NOT;                                  }
+	YY_BREAK
+case 48:
+YY_RULE_SETUP
+{ ECHO; return PLUS;                                 }
+	YY_BREAK
+case 49:
+YY_RULE_SETUP
+{ ECHO; return MINUS;                                }
+	YY_BREAK
+case 50:
+YY_RULE_SETUP
+{ ECHO; return TIMES;                                }
+	YY_BREAK
+case 51:
+YY_RULE_SETUP
+{ ECHO; return DIV;                                  }
+	YY_BREAK
+case 52:
+YY_RULE_SETUP
+{ ECHO; return MODULO;                               }
+	YY_BREAK
+case 53:
+YY_RULE_SETUP
+{ ECHO; return SHL;                                  }
+	YY_BREAK
+case 54:
+YY_RULE_SETUP
+{ ECHO; return SHR;                                  }
+	YY_BREAK
+case 55:
+YY_RULE_SETUP
+{ ECHO; return RANGE;                                }
+	YY_BREAK
+case 56:
+YY_RULE_SETUP
+{ ECHO; return ASSIGNMENT;                           }
+	YY_BREAK
+case 57:
+YY_RULE_SETUP
+{ ECHO; return QUESTION_MARK;                        }
+	YY_BREAK
+case 58:
+YY_RULE_SETUP
+{ ECHO; return COLON;                                }
+	YY_BREAK
+case 59:
+YY_RULE_SETUP
+{ ECHO; return SEMICOLON;                            }
+	YY_BREAK
+case 60:
+YY_RULE_SETUP
+{ ECHO; return COMMA;                                }
+	YY_BREAK
+case 61:
+YY_RULE_SETUP
+{ /* saw closing quote - all done */
+                        YY_POP_STATE();
+                        *string_buf_ptr = '\0';
+                        /* return string constant token type and
+                        * value to parser
+                        */
+                        YYLVAL(string) = string_buf;
+                        ECHO; return STRING;                               }
+	YY_BREAK
+case 62:
+YY_RULE_SETUP
+{ string_buf_ptr = string_buf;
+                        YY_PUSH_STATE(dstr);                               }
+	YY_BREAK
+case 63:
+/* rule 63 can match eol */
+YY_RULE_SETUP
+{
+                        /* error - unterminated string constant */
+                        printf("Unterminated string constant at line %d\n", current_lineno);
+                        exit(-1);                                          }
+	YY_BREAK
+case 64:
+YY_RULE_SETUP
+{ /* octal escape sequence */
+                        int result;
+
+                        (void) sscanf( yytext + 1, "%o", &result );
+
+                        if ( result > 0xff ) {
+                            /* error, constant is out-of-bounds */
+                            printf("Constant out-of-bound in octal escape sequence at line %d\n", current_lineno);
+                            exit(-1);
+                        }
+                        *string_buf_ptr++ = (char)result;                  }
+	YY_BREAK
+case 65:
+YY_RULE_SETUP
+{ /* generate error - bad escape sequence; something
+                         * like '\48' or '\0777777'
+                         */
+                         printf("Bad escape sequence at line %d\n", current_lineno);
+                         exit(-1);                                         }
+	YY_BREAK
+case 66:
+YY_RULE_SETUP
+{ *string_buf_ptr++ = '\n'; current_lineno++;        }
+	YY_BREAK
+case 67:
+YY_RULE_SETUP
+{ *string_buf_ptr++ = '\t';                          }
+	YY_BREAK
+case 68:
+YY_RULE_SETUP
+{ *string_buf_ptr++ = '\r';                          }
+	YY_BREAK
+case 69:
+YY_RULE_SETUP
+{ *string_buf_ptr++ = '\b';                          }
+	YY_BREAK
+case 70:
+YY_RULE_SETUP
+{ *string_buf_ptr++ = '\f';                          }
+	YY_BREAK
+case 71:
+/* rule 71 can match eol */
+YY_RULE_SETUP
+{ *string_buf_ptr++ = yytext[1];                     }
+	YY_BREAK
+case 72:
+YY_RULE_SETUP
+{
+                        char *yptr = yytext;
+                        while ( *yptr )
+                            *string_buf_ptr++ = *yptr++;                   }
+	YY_BREAK
+case 73:
+/* rule 73 can match eol */
+YY_RULE_SETUP
+{ current_lineno++;                                  }
+	YY_BREAK
+case 74:
+/* rule 74 can match eol */
+YY_RULE_SETUP
+{ current_lineno++;                                  }
+	YY_BREAK
+case 75:
+YY_RULE_SETUP
+{
+                        YYLVAL(string) = strdup(yytext);
+                        ECHO; return VAR;                                  }
+	YY_BREAK
+case 76:
+YY_RULE_SETUP
+ECHO;
+	YY_BREAK
+case YY_STATE_EOF(INITIAL):
+case YY_STATE_EOF(comment):
+case YY_STATE_EOF(properties):
+case YY_STATE_EOF(dstr):
+case YY_STATE_EOF(body):
+case YY_STATE_EOF(body_init):
+	yyterminate();
+
+	case YY_END_OF_BUFFER:
+		{
+		/* Amount of text matched not including the EOB char. */
+		int yy_amount_of_matched_text = (int) (yy_cp - (yytext_ptr)) - 1;
+
+		/* Undo the effects of YY_DO_BEFORE_ACTION. */
+		*yy_cp = (yy_hold_char);
+		YY_RESTORE_YY_MORE_OFFSET
+
+		if ( YY_CURRENT_BUFFER_LVALUE->yy_buffer_status == YY_BUFFER_NEW )
+			{
+			/* We're scanning a new file or input source.  It's
+			 * possible that this happened because the user
+			 * just pointed yyin at a new source and called
+			 * yylex().  If so, then we have to assure
+			 * consistency between YY_CURRENT_BUFFER and our
+			 * globals.  Here is the right place to do so, because
+			 * this is the first action (other than possibly a
+			 * back-up) that will match for the new input source.
+			 */
+			(yy_n_chars) = YY_CURRENT_BUFFER_LVALUE->yy_n_chars;
+			YY_CURRENT_BUFFER_LVALUE->yy_input_file = yyin;
+			YY_CURRENT_BUFFER_LVALUE->yy_buffer_status = YY_BUFFER_NORMAL;
+			}
+
+		/* Note that here we test for yy_c_buf_p "<=" to the position
+		 * of the first EOB in the buffer, since yy_c_buf_p will
+		 * already have been incremented past the NUL character
+		 * (since all states make transitions on EOB to the
+		 * end-of-buffer state).  Contrast this with the test
+		 * in input().
+		 */
+		if ( (yy_c_buf_p) <= &YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[(yy_n_chars)] )
+			{ /* This was really a NUL. */
+			yy_state_type yy_next_state;
+
+			(yy_c_buf_p) = (yytext_ptr) + yy_amount_of_matched_text;
+
+			yy_current_state = yy_get_previous_state(  );
+
+			/* Okay, we're now positioned to make the NUL
+			 * transition.  We couldn't have
+			 * yy_get_previous_state() go ahead and do it
+			 * for us because it doesn't know how to deal
+			 * with the possibility of jamming (and we don't
+			 * want to build jamming into it because then it
+			 * will run more slowly).
+			 */
+
+			yy_next_state = yy_try_NUL_trans( yy_current_state );
+
+			yy_bp = (yytext_ptr) + YY_MORE_ADJ;
+
+			if ( yy_next_state )
+				{
+				/* Consume the NUL. */
+				yy_cp = ++(yy_c_buf_p);
+				yy_current_state = yy_next_state;
+				goto yy_match;
+				}
+
+			else
+				{
+				yy_cp = (yy_c_buf_p);
+				goto yy_find_action;
+				}
+			}
+
+		else switch ( yy_get_next_buffer(  ) )
+			{
+			case EOB_ACT_END_OF_FILE:
+				{
+				(yy_did_buffer_switch_on_eof) = 0;
+
+				if ( yywrap(  ) )
+					{
+					/* Note: because we've taken care in
+					 * yy_get_next_buffer() to have set up
+					 * yytext, we can now set up
+					 * yy_c_buf_p so that if some total
+					 * hoser (like flex itself) wants to
+					 * call the scanner after we return the
+					 * YY_NULL, it'll still work - another
+					 * YY_NULL will get returned.
+					 */
+					(yy_c_buf_p) = (yytext_ptr) + YY_MORE_ADJ;
+
+					yy_act = YY_STATE_EOF(YY_START);
+					goto do_action;
+					}
+
+				else
+					{
+					if ( ! (yy_did_buffer_switch_on_eof) )
+						YY_NEW_FILE;
+					}
+				break;
+				}
+
+			case EOB_ACT_CONTINUE_SCAN:
+				(yy_c_buf_p) =
+					(yytext_ptr) + yy_amount_of_matched_text;
+
+				yy_current_state = yy_get_previous_state(  );
+
+				yy_cp = (yy_c_buf_p);
+				yy_bp = (yytext_ptr) + YY_MORE_ADJ;
+				goto yy_match;
+
+			case EOB_ACT_LAST_MATCH:
+				(yy_c_buf_p) =
+				&YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[(yy_n_chars)];
+
+				yy_current_state = yy_get_previous_state(  );
+
+				yy_cp = (yy_c_buf_p);
+				yy_bp = (yytext_ptr) + YY_MORE_ADJ;
+				goto yy_find_action;
+			}
+		break;
+		}
+
+	default:
+		YY_FATAL_ERROR(
+			"fatal flex scanner internal error--no action found" );
+	} /* end of action switch */
+		} /* end of scanning one token */
+	} /* end of user's declarations */
+} /* end of yylex */
+
+/* yy_get_next_buffer - try to read in a new buffer
+ *
+ * Returns a code representing an action:
+ *	EOB_ACT_LAST_MATCH -
+ *	EOB_ACT_CONTINUE_SCAN - continue scanning from current position
+ *	EOB_ACT_END_OF_FILE - end of file
+ */
+static int yy_get_next_buffer (void)
+{
+    	char *dest = YY_CURRENT_BUFFER_LVALUE->yy_ch_buf;
+	char *source = (yytext_ptr);
+	int number_to_move, i;
+	int ret_val;
+
+	if ( (yy_c_buf_p) > &YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[(yy_n_chars) + 1] )
+		YY_FATAL_ERROR(
+		"fatal flex scanner internal error--end of buffer missed" );
+
+	if ( YY_CURRENT_BUFFER_LVALUE->yy_fill_buffer == 0 )
+		{ /* Don't try to fill the buffer, so this is an EOF. */
+		if ( (yy_c_buf_p) - (yytext_ptr) - YY_MORE_ADJ == 1 )
+			{
+			/* We matched a single character, the EOB, so
+			 * treat this as a final EOF.
+			 */
+			return EOB_ACT_END_OF_FILE;
+			}
+
+		else
+			{
+			/* We matched some text prior to the EOB, first
+			 * process it.
+			 */
+			return EOB_ACT_LAST_MATCH;
+			}
+		}
+
+	/* Try to read more data. */
+
+	/* First move last chars to start of buffer. */
+	number_to_move = (int) ((yy_c_buf_p) - (yytext_ptr) - 1);
+
+	for ( i = 0; i < number_to_move; ++i )
+		*(dest++) = *(source++);
+
+	if ( YY_CURRENT_BUFFER_LVALUE->yy_buffer_status == YY_BUFFER_EOF_PENDING )
+		/* don't do the read, it's not guaranteed to return an EOF,
+		 * just force an EOF
+		 */
+		YY_CURRENT_BUFFER_LVALUE->yy_n_chars = (yy_n_chars) = 0;
+
+	else
+		{
+			int num_to_read =
+			YY_CURRENT_BUFFER_LVALUE->yy_buf_size - number_to_move - 1;
+
+		while ( num_to_read <= 0 )
+			{ /* Not enough room in the buffer - grow it. */
+
+			/* just a shorter name for the current buffer */
+			YY_BUFFER_STATE b = YY_CURRENT_BUFFER_LVALUE;
+
+			int yy_c_buf_p_offset =
+				(int) ((yy_c_buf_p) - b->yy_ch_buf);
+
+			if ( b->yy_is_our_buffer )
+				{
+				int new_size = b->yy_buf_size * 2;
+
+				if ( new_size <= 0 )
+					b->yy_buf_size += b->yy_buf_size / 8;
+				else
+					b->yy_buf_size *= 2;
+
+				b->yy_ch_buf = (char *)
+					/* Include room in for 2 EOB chars. */
+					yyrealloc( (void *) b->yy_ch_buf,
+							 (yy_size_t) (b->yy_buf_size + 2)  );
+				}
+			else
+				/* Can't grow it, we don't own it. */
+				b->yy_ch_buf = NULL;
+
+			if ( ! b->yy_ch_buf )
+				YY_FATAL_ERROR(
+				"fatal error - scanner input buffer overflow" );
+
+			(yy_c_buf_p) = &b->yy_ch_buf[yy_c_buf_p_offset];
+
+			num_to_read = YY_CURRENT_BUFFER_LVALUE->yy_buf_size -
+						number_to_move - 1;
+
+			}
+
+		if ( num_to_read > YY_READ_BUF_SIZE )
+			num_to_read = YY_READ_BUF_SIZE;
+
+		/* Read in more data. */
+		YY_INPUT( (&YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[number_to_move]),
+			(yy_n_chars), num_to_read );
+
+		YY_CURRENT_BUFFER_LVALUE->yy_n_chars = (yy_n_chars);
+		}
+
+	if ( (yy_n_chars) == 0 )
+		{
+		if ( number_to_move == YY_MORE_ADJ )
+			{
+			ret_val = EOB_ACT_END_OF_FILE;
+			yyrestart( yyin  );
+			}
+
+		else
+			{
+			ret_val = EOB_ACT_LAST_MATCH;
+			YY_CURRENT_BUFFER_LVALUE->yy_buffer_status =
+				YY_BUFFER_EOF_PENDING;
+			}
+		}
+
+	else
+		ret_val = EOB_ACT_CONTINUE_SCAN;
+
+	if (((yy_n_chars) + number_to_move) > YY_CURRENT_BUFFER_LVALUE->yy_buf_size) {
+		/* Extend the array by 50%, plus the number we really need. */
+		int new_size = (yy_n_chars) + number_to_move + ((yy_n_chars) >> 1);
+		YY_CURRENT_BUFFER_LVALUE->yy_ch_buf = (char *) yyrealloc(
+			(void *) YY_CURRENT_BUFFER_LVALUE->yy_ch_buf, (yy_size_t) new_size  );
+		if ( ! YY_CURRENT_BUFFER_LVALUE->yy_ch_buf )
+			YY_FATAL_ERROR( "out of dynamic memory in yy_get_next_buffer()" );
+		/* "- 2" to take care of EOB's */
+		YY_CURRENT_BUFFER_LVALUE->yy_buf_size = (int) (new_size - 2);
+	}
+
+	(yy_n_chars) += number_to_move;
+	YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[(yy_n_chars)] = YY_END_OF_BUFFER_CHAR;
+	YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[(yy_n_chars) + 1] = YY_END_OF_BUFFER_CHAR;
+
+	(yytext_ptr) = &YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[0];
+
+	return ret_val;
+}
+
+/* yy_get_previous_state - get the state just before the EOB char was reached */
+
+    static yy_state_type yy_get_previous_state (void)
+{
+	yy_state_type yy_current_state;
+	char *yy_cp;
+    
+	yy_current_state = (yy_start);
+	yy_current_state += YY_AT_BOL();
+
+	for ( yy_cp = (yytext_ptr) + YY_MORE_ADJ; yy_cp < (yy_c_buf_p); ++yy_cp )
+		{
+		YY_CHAR yy_c = (*yy_cp ? yy_ec[YY_SC_TO_UI(*yy_cp)] : 1);
+		if ( yy_accept[yy_current_state] )
+			{
+			(yy_last_accepting_state) = yy_current_state;
+			(yy_last_accepting_cpos) = yy_cp;
+			}
+		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
+			{
+			yy_current_state = (int) yy_def[yy_current_state];
+			if ( yy_current_state >= 333 )
+				yy_c = yy_meta[yy_c];
+			}
+		yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
+		}
+
+	return yy_current_state;
+}
+
+/* yy_try_NUL_trans - try to make a transition on the NUL character
+ *
+ * synopsis
+ *	next_state = yy_try_NUL_trans( current_state );
+ */
+    static yy_state_type yy_try_NUL_trans  (yy_state_type yy_current_state )
+{
+	int yy_is_jam;
+    	char *yy_cp = (yy_c_buf_p);
+
+	YY_CHAR yy_c = 1;
+	if ( yy_accept[yy_current_state] )
+		{
+		(yy_last_accepting_state) = yy_current_state;
+		(yy_last_accepting_cpos) = yy_cp;
+		}
+	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
+		{
+		yy_current_state = (int) yy_def[yy_current_state];
+		if ( yy_current_state >= 333 )
+			yy_c = yy_meta[yy_c];
+		}
+	yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
+	yy_is_jam = (yy_current_state == 332);
+
+		return yy_is_jam ? 0 : yy_current_state;
+}
+
+#ifndef YY_NO_UNPUT
+
+#endif
+
+#ifndef YY_NO_INPUT
+#ifdef __cplusplus
+    static int yyinput (void)
+#else
+    static int input  (void)
+#endif
+
+{
+	int c;
+    
+	*(yy_c_buf_p) = (yy_hold_char);
+
+	if ( *(yy_c_buf_p) == YY_END_OF_BUFFER_CHAR )
+		{
+		/* yy_c_buf_p now points to the character we want to return.
+		 * If this occurs *before* the EOB characters, then it's a
+		 * valid NUL; if not, then we've hit the end of the buffer.
+		 */
+		if ( (yy_c_buf_p) < &YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[(yy_n_chars)] )
+			/* This was really a NUL. */
+			*(yy_c_buf_p) = '\0';
+
+		else
+			{ /* need more input */
+			int offset = (int) ((yy_c_buf_p) - (yytext_ptr));
+			++(yy_c_buf_p);
+
+			switch ( yy_get_next_buffer(  ) )
+				{
+				case EOB_ACT_LAST_MATCH:
+					/* This happens because yy_g_n_b()
+					 * sees that we've accumulated a
+					 * token and flags that we need to
+					 * try matching the token before
+					 * proceeding.  But for input(),
+					 * there's no matching to consider.
+					 * So convert the EOB_ACT_LAST_MATCH
+					 * to EOB_ACT_END_OF_FILE.
+					 */
+
+					/* Reset buffer status. */
+					yyrestart( yyin );
+
+					/*FALLTHROUGH*/
+
+				case EOB_ACT_END_OF_FILE:
+					{
+					if ( yywrap(  ) )
+						return 0;
+
+					if ( ! (yy_did_buffer_switch_on_eof) )
+						YY_NEW_FILE;
+#ifdef __cplusplus
+					return yyinput();
+#else
+					return input();
+#endif
+					}
+
+				case EOB_ACT_CONTINUE_SCAN:
+					(yy_c_buf_p) = (yytext_ptr) + offset;
+					break;
+				}
+			}
+		}
+
+	c = *(unsigned char *) (yy_c_buf_p);	/* cast for 8-bit char's */
+	*(yy_c_buf_p) = '\0';	/* preserve yytext */
+	(yy_hold_char) = *++(yy_c_buf_p);
+
+	YY_CURRENT_BUFFER_LVALUE->yy_at_bol = (c == '\n');
+	if ( YY_CURRENT_BUFFER_LVALUE->yy_at_bol )
+		
+    yylineno++;
+;
+
+	return c;
+}
+#endif	/* ifndef YY_NO_INPUT */
+
+/** Immediately switch to a different input stream.
+ * @param input_file A readable stream.
+ * 
+ * @note This function does not reset the start condition to @c INITIAL .
+ */
+    void yyrestart  (FILE * input_file )
+{
+    
+	if ( ! YY_CURRENT_BUFFER ){
+        yyensure_buffer_stack ();
+		YY_CURRENT_BUFFER_LVALUE =
+            yy_create_buffer( yyin, YY_BUF_SIZE );
+	}
+
+	yy_init_buffer( YY_CURRENT_BUFFER, input_file );
+	yy_load_buffer_state(  );
+}
+
+/** Switch to a different input buffer.
+ * @param new_buffer The new input buffer.
+ * 
+ */
+    void yy_switch_to_buffer  (YY_BUFFER_STATE  new_buffer )
+{
+    
+	/* TODO. We should be able to replace this entire function body
+	 * with
+	 *		yypop_buffer_state();
+	 *		yypush_buffer_state(new_buffer);
+     */
+	yyensure_buffer_stack ();
+	if ( YY_CURRENT_BUFFER == new_buffer )
+		return;
+
+	if ( YY_CURRENT_BUFFER )
+		{
+		/* Flush out information for old buffer. */
+		*(yy_c_buf_p) = (yy_hold_char);
+		YY_CURRENT_BUFFER_LVALUE->yy_buf_pos = (yy_c_buf_p);
+		YY_CURRENT_BUFFER_LVALUE->yy_n_chars = (yy_n_chars);
+		}
+
+	YY_CURRENT_BUFFER_LVALUE = new_buffer;
+	yy_load_buffer_state(  );
+
+	/* We don't actually know whether we did this switch during
+	 * EOF (yywrap()) processing, but the only time this flag
+	 * is looked at is after yywrap() is called, so it's safe
+	 * to go ahead and always set it.
+	 */
+	(yy_did_buffer_switch_on_eof) = 1;
+}
+
+static void yy_load_buffer_state  (void)
+{
+    	(yy_n_chars) = YY_CURRENT_BUFFER_LVALUE->yy_n_chars;
+	(yytext_ptr) = (yy_c_buf_p) = YY_CURRENT_BUFFER_LVALUE->yy_buf_pos;
+	yyin = YY_CURRENT_BUFFER_LVALUE->yy_input_file;
+	(yy_hold_char) = *(yy_c_buf_p);
+}
+
+/** Allocate and initialize an input buffer state.
+ * @param file A readable stream.
+ * @param size The character buffer size in bytes. When in doubt, use @c YY_BUF_SIZE.
+ * 
+ * @return the allocated buffer state.
+ */
+    YY_BUFFER_STATE yy_create_buffer  (FILE * file, int  size )
+{
+	YY_BUFFER_STATE b;
+    
+	b = (YY_BUFFER_STATE) yyalloc( sizeof( struct yy_buffer_state )  );
+	if ( ! b )
+		YY_FATAL_ERROR( "out of dynamic memory in yy_create_buffer()" );
+
+	b->yy_buf_size = size;
+
+	/* yy_ch_buf has to be 2 characters longer than the size given because
+	 * we need to put in 2 end-of-buffer characters.
+	 */
+	b->yy_ch_buf = (char *) yyalloc( (yy_size_t) (b->yy_buf_size + 2)  );
+	if ( ! b->yy_ch_buf )
+		YY_FATAL_ERROR( "out of dynamic memory in yy_create_buffer()" );
+
+	b->yy_is_our_buffer = 1;
+
+	yy_init_buffer( b, file );
+
+	return b;
+}
+
+/** Destroy the buffer.
+ * @param b a buffer created with yy_create_buffer()
+ * 
+ */
+    void yy_delete_buffer (YY_BUFFER_STATE  b )
+{
+    
+	if ( ! b )
+		return;
+
+	if ( b == YY_CURRENT_BUFFER ) /* Not sure if we should pop here. */
+		YY_CURRENT_BUFFER_LVALUE = (YY_BUFFER_STATE) 0;
+
+	if ( b->yy_is_our_buffer )
+		yyfree( (void *) b->yy_ch_buf  );
+
+	yyfree( (void *) b  );
+}
+
+/* Initializes or reinitializes a buffer.
+ * This function is sometimes called more than once on the same buffer,
+ * such as during a yyrestart() or at EOF.
+ */
+    static void yy_init_buffer  (YY_BUFFER_STATE  b, FILE * file )
+
+{
+	int oerrno = errno;
+    
+	yy_flush_buffer( b );
+
+	b->yy_input_file = file;
+	b->yy_fill_buffer = 1;
+
+    /* If b is the current buffer, then yy_init_buffer was _probably_
+     * called from yyrestart() or through yy_get_next_buffer.
+     * In that case, we don't want to reset the lineno or column.
+     */
+    if (b != YY_CURRENT_BUFFER){
+        b->yy_bs_lineno = 1;
+        b->yy_bs_column = 0;
+    }
+
+        b->yy_is_interactive = file ? (isatty( fileno(file) ) > 0) : 0;
+    
+	errno = oerrno;
+}
+
+/** Discard all buffered characters. On the next scan, YY_INPUT will be called.
+ * @param b the buffer state to be flushed, usually @c YY_CURRENT_BUFFER.
+ * 
+ */
+    void yy_flush_buffer (YY_BUFFER_STATE  b )
+{
+    	if ( ! b )
+		return;
+
+	b->yy_n_chars = 0;
+
+	/* We always need two end-of-buffer characters.  The first causes
+	 * a transition to the end-of-buffer state.  The second causes
+	 * a jam in that state.
+	 */
+	b->yy_ch_buf[0] = YY_END_OF_BUFFER_CHAR;
+	b->yy_ch_buf[1] = YY_END_OF_BUFFER_CHAR;
+
+	b->yy_buf_pos = &b->yy_ch_buf[0];
+
+	b->yy_at_bol = 1;
+	b->yy_buffer_status = YY_BUFFER_NEW;
+
+	if ( b == YY_CURRENT_BUFFER )
+		yy_load_buffer_state(  );
+}
+
+/** Pushes the new state onto the stack. The new state becomes
+ *  the current state. This function will allocate the stack
+ *  if necessary.
+ *  @param new_buffer The new state.
+ *  
+ */
+void yypush_buffer_state (YY_BUFFER_STATE new_buffer )
+{
+    	if (new_buffer == NULL)
+		return;
+
+	yyensure_buffer_stack();
+
+	/* This block is copied from yy_switch_to_buffer. */
+	if ( YY_CURRENT_BUFFER )
+		{
+		/* Flush out information for old buffer. */
+		*(yy_c_buf_p) = (yy_hold_char);
+		YY_CURRENT_BUFFER_LVALUE->yy_buf_pos = (yy_c_buf_p);
+		YY_CURRENT_BUFFER_LVALUE->yy_n_chars = (yy_n_chars);
+		}
+
+	/* Only push if top exists. Otherwise, replace top. */
+	if (YY_CURRENT_BUFFER)
+		(yy_buffer_stack_top)++;
+	YY_CURRENT_BUFFER_LVALUE = new_buffer;
+
+	/* copied from yy_switch_to_buffer. */
+	yy_load_buffer_state(  );
+	(yy_did_buffer_switch_on_eof) = 1;
+}
+
+/** Removes and deletes the top of the stack, if present.
+ *  The next element becomes the new top.
+ *  
+ */
+void yypop_buffer_state (void)
+{
+    	if (!YY_CURRENT_BUFFER)
+		return;
+
+	yy_delete_buffer(YY_CURRENT_BUFFER );
+	YY_CURRENT_BUFFER_LVALUE = NULL;
+	if ((yy_buffer_stack_top) > 0)
+		--(yy_buffer_stack_top);
+
+	if (YY_CURRENT_BUFFER) {
+		yy_load_buffer_state(  );
+		(yy_did_buffer_switch_on_eof) = 1;
+	}
+}
+
+/* Allocates the stack if it does not exist.
+ *  Guarantees space for at least one push.
+ */
+static void yyensure_buffer_stack (void)
+{
+	yy_size_t num_to_alloc;
+    
+	if (!(yy_buffer_stack)) {
+
+		/* First allocation is just for 2 elements, since we don't know if this
+		 * scanner will even need a stack. We use 2 instead of 1 to avoid an
+		 * immediate realloc on the next call.
+         */
+      num_to_alloc = 1; /* After all that talk, this was set to 1 anyways... */
+		(yy_buffer_stack) = (struct yy_buffer_state**)yyalloc
+								(num_to_alloc * sizeof(struct yy_buffer_state*)
+								);
+		if ( ! (yy_buffer_stack) )
+			YY_FATAL_ERROR( "out of dynamic memory in yyensure_buffer_stack()" );
+
+		memset((yy_buffer_stack), 0, num_to_alloc * sizeof(struct yy_buffer_state*));
+
+		(yy_buffer_stack_max) = num_to_alloc;
+		(yy_buffer_stack_top) = 0;
+		return;
+	}
+
+	if ((yy_buffer_stack_top) >= ((yy_buffer_stack_max)) - 1){
+
+		/* Increase the buffer to prepare for a possible push. */
+		yy_size_t grow_size = 8 /* arbitrary grow size */;
+
+		num_to_alloc = (yy_buffer_stack_max) + grow_size;
+		(yy_buffer_stack) = (struct yy_buffer_state**)yyrealloc
+								((yy_buffer_stack),
+								num_to_alloc * sizeof(struct yy_buffer_state*)
+								);
+		if ( ! (yy_buffer_stack) )
+			YY_FATAL_ERROR( "out of dynamic memory in yyensure_buffer_stack()" );
+
+		/* zero only the new slots.*/
+		memset((yy_buffer_stack) + (yy_buffer_stack_max), 0, grow_size * sizeof(struct yy_buffer_state*));
+		(yy_buffer_stack_max) = num_to_alloc;
+	}
+}
+
+/** Setup the input buffer state to scan directly from a user-specified character buffer.
+ * @param base the character buffer
+ * @param size the size in bytes of the character buffer
+ * 
+ * @return the newly allocated buffer state object.
+ */
+YY_BUFFER_STATE yy_scan_buffer  (char * base, yy_size_t  size )
+{
+	YY_BUFFER_STATE b;
+    
+	if ( size < 2 ||
+	     base[size-2] != YY_END_OF_BUFFER_CHAR ||
+	     base[size-1] != YY_END_OF_BUFFER_CHAR )
+		/* They forgot to leave room for the EOB's. */
+		return NULL;
+
+	b = (YY_BUFFER_STATE) yyalloc( sizeof( struct yy_buffer_state )  );
+	if ( ! b )
+		YY_FATAL_ERROR( "out of dynamic memory in yy_scan_buffer()" );
+
+	b->yy_buf_size = (int) (size - 2);	/* "- 2" to take care of EOB's */
+	b->yy_buf_pos = b->yy_ch_buf = base;
+	b->yy_is_our_buffer = 0;
+	b->yy_input_file = NULL;
+	b->yy_n_chars = b->yy_buf_size;
+	b->yy_is_interactive = 0;
+	b->yy_at_bol = 1;
+	b->yy_fill_buffer = 0;
+	b->yy_buffer_status = YY_BUFFER_NEW;
+
+	yy_switch_to_buffer( b  );
+
+	return b;
+}
+
+/** Setup the input buffer state to scan a string. The next call to yylex() will
+ * scan from a @e copy of @a str.
+ * @param yystr a NUL-terminated string to scan
+ * 
+ * @return the newly allocated buffer state object.
+ * @note If you want to scan bytes that may contain NUL values, then use
+ *       yy_scan_bytes() instead.
+ */
+YY_BUFFER_STATE yy_scan_string (const char * yystr )
+{
+    
+	return yy_scan_bytes( yystr, (int) strlen(yystr) );
+}
+
+/** Setup the input buffer state to scan the given bytes. The next call to yylex() will
+ * scan from a @e copy of @a bytes.
+ * @param yybytes the byte buffer to scan
+ * @param _yybytes_len the number of bytes in the buffer pointed to by @a bytes.
+ * 
+ * @return the newly allocated buffer state object.
+ */
+YY_BUFFER_STATE yy_scan_bytes  (const char * yybytes, int  _yybytes_len )
+{
+	YY_BUFFER_STATE b;
+	char *buf;
+	yy_size_t n;
+	int i;
+    
+	/* Get memory for full buffer, including space for trailing EOB's. */
+	n = (yy_size_t) (_yybytes_len + 2);
+	buf = (char *) yyalloc( n  );
+	if ( ! buf )
+		YY_FATAL_ERROR( "out of dynamic memory in yy_scan_bytes()" );
+
+	for ( i = 0; i < _yybytes_len; ++i )
+		buf[i] = yybytes[i];
+
+	buf[_yybytes_len] = buf[_yybytes_len+1] = YY_END_OF_BUFFER_CHAR;
+
+	b = yy_scan_buffer( buf, n );
+	if ( ! b )
+		YY_FATAL_ERROR( "bad buffer in yy_scan_bytes()" );
+
+	/* It's okay to grow etc. this buffer, and we should throw it
+	 * away when we're done.
+	 */
+	b->yy_is_our_buffer = 1;
+
+	return b;
+}
+
+    static void yy_push_state (int  _new_state )
+{
+    	if ( (yy_start_stack_ptr) >= (yy_start_stack_depth) )
+		{
+		yy_size_t new_size;
+
+		(yy_start_stack_depth) += YY_START_STACK_INCR;
+		new_size = (yy_size_t) (yy_start_stack_depth) * sizeof( int );
+
+		if ( ! (yy_start_stack) )
+			(yy_start_stack) = (int *) yyalloc( new_size  );
+
+		else
+			(yy_start_stack) = (int *) yyrealloc(
+					(void *) (yy_start_stack), new_size  );
+
+		if ( ! (yy_start_stack) )
+			YY_FATAL_ERROR( "out of memory expanding start-condition stack" );
+		}
+
+	(yy_start_stack)[(yy_start_stack_ptr)++] = YY_START;
+
+	BEGIN(_new_state);
+}
+
+    static void yy_pop_state  (void)
+{
+    	if ( --(yy_start_stack_ptr) < 0 )
+		YY_FATAL_ERROR( "start-condition stack underflow" );
+
+	BEGIN((yy_start_stack)[(yy_start_stack_ptr)]);
+}
+
+#ifndef YY_EXIT_FAILURE
+#define YY_EXIT_FAILURE 2
+#endif
+
+static void yynoreturn yy_fatal_error (const char* msg )
+{
+			fprintf( stderr, "%s\n", msg );
+	exit( YY_EXIT_FAILURE );
+}
+
+/* Redefine yyless() so it works in section 3 code. */
+
+#undef yyless
+#define yyless(n) \
+	do \
+		{ \
+		/* Undo effects of setting up yytext. */ \
+        int yyless_macro_arg = (n); \
+        YY_LESS_LINENO(yyless_macro_arg);\
+		yytext[yyleng] = (yy_hold_char); \
+		(yy_c_buf_p) = yytext + yyless_macro_arg; \
+		(yy_hold_char) = *(yy_c_buf_p); \
+		*(yy_c_buf_p) = '\0'; \
+		yyleng = yyless_macro_arg; \
+		} \
+	while ( 0 )
+
+/* Accessor  methods (get/set functions) to struct members. */
+
+/** Get the current line number.
+ * 
+ */
+int yyget_lineno  (void)
+{
+    
+    return yylineno;
+}
+
+/** Get the input stream.
+ * 
+ */
+FILE *yyget_in  (void)
+{
+        return yyin;
+}
+
+/** Get the output stream.
+ * 
+ */
+FILE *yyget_out  (void)
+{
+        return yyout;
+}
+
+/** Get the length of the current token.
+ * 
+ */
+int yyget_leng  (void)
+{
+        return yyleng;
+}
+
+/** Get the current token.
+ * 
+ */
+
+char *yyget_text  (void)
+{
+        return yytext;
+}
+
+/** Set the current line number.
+ * @param _line_number line number
+ * 
+ */
+void yyset_lineno (int  _line_number )
+{
+    
+    yylineno = _line_number;
+}
+
+/** Set the input stream. This does not discard the current
+ * input buffer.
+ * @param _in_str A readable stream.
+ * 
+ * @see yy_switch_to_buffer
+ */
+void yyset_in (FILE *  _in_str )
+{
+        yyin = _in_str ;
+}
+
+void yyset_out (FILE *  _out_str )
+{
+        yyout = _out_str ;
+}
+
+int yyget_debug  (void)
+{
+        return yy_flex_debug;
+}
+
+void yyset_debug (int  _bdebug )
+{
+        yy_flex_debug = _bdebug ;
+}
+
+static int yy_init_globals (void)
+{
+        /* Initialization is the same as for the non-reentrant scanner.
+     * This function is called from yylex_destroy(), so don't allocate here.
+     */
+
+    /* We do not touch yylineno unless the option is enabled. */
+    yylineno =  1;
+    
+    (yy_buffer_stack) = NULL;
+    (yy_buffer_stack_top) = 0;
+    (yy_buffer_stack_max) = 0;
+    (yy_c_buf_p) = NULL;
+    (yy_init) = 0;
+    (yy_start) = 0;
+
+    (yy_start_stack_ptr) = 0;
+    (yy_start_stack_depth) = 0;
+    (yy_start_stack) =  NULL;
+
+/* Defined in main.c */
+#ifdef YY_STDINIT
+    yyin = stdin;
+    yyout = stdout;
+#else
+    yyin = NULL;
+    yyout = NULL;
+#endif
+
+    /* For future reference: Set errno on error, since we are called by
+     * yylex_init()
+     */
+    return 0;
+}
+
+/* yylex_destroy is for both reentrant and non-reentrant scanners. */
+int yylex_destroy  (void)
+{
+    
+    /* Pop the buffer stack, destroying each element. */
+	while(YY_CURRENT_BUFFER){
+		yy_delete_buffer( YY_CURRENT_BUFFER  );
+		YY_CURRENT_BUFFER_LVALUE = NULL;
+		yypop_buffer_state();
+	}
+
+	/* Destroy the stack itself. */
+	yyfree((yy_buffer_stack) );
+	(yy_buffer_stack) = NULL;
+
+    /* Destroy the start condition stack. */
+        yyfree( (yy_start_stack)  );
+        (yy_start_stack) = NULL;
+
+    /* Reset the globals. This is important in a non-reentrant scanner so the next time
+     * yylex() is called, initialization will occur. */
+    yy_init_globals( );
+
+    return 0;
+}
+
+/*
+ * Internal utility routines.
+ */
+
+#ifndef yytext_ptr
+static void yy_flex_strncpy (char* s1, const char * s2, int n )
+{
+		
+	int i;
+	for ( i = 0; i < n; ++i )
+		s1[i] = s2[i];
+}
+#endif
+
+#ifdef YY_NEED_STRLEN
+static int yy_flex_strlen (const char * s )
+{
+	int n;
+	for ( n = 0; s[n]; ++n )
+		;
+
+	return n;
+}
+#endif
+
+void *yyalloc (yy_size_t  size )
+{
+			return malloc(size);
+}
+
+void *yyrealloc  (void * ptr, yy_size_t  size )
+{
+		
+	/* The cast to (char *) in the following accommodates both
+	 * implementations that use char* generic pointers, and those
+	 * that use void* generic pointers.  It works with the latter
+	 * because both ANSI C and C++ allow castless assignment from
+	 * any pointer type to void*, and deal with argument conversions
+	 * as though doing an assignment.
+	 */
+	return realloc(ptr, size);
+}
+
+void yyfree (void * ptr )
+{
+			free( (char *) ptr );	/* see yyrealloc() for (char *) cast */
+}
+
+#define YYTABLES_NAME "yytables"
+
+#include "main.c"
+
@@ -0,0 +1,4497 @@
+/* A Bison parser, made by GNU Bison 3.7.4.  */
+
+/* Skeleton implementation for Bison GLR parsers in C
+
+   Copyright (C) 2002-2015, 2018-2020 Free Software Foundation, Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* C GLR parser skeleton written by Paul Hilfinger.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30704
+
+/* Bison version string.  */
+#define YYBISON_VERSION "3.7.4"
+
+/* Skeleton name.  */
+#define YYSKELETON_NAME "glr.c"
+
+/* Pure parsers.  */
+#define YYPURE 0
+
+
+
+
+
+
+/* First part of user prologue.  */
+
+/**
+ * Copyright (c) 2009-2023 The University of Tennessee and The University
+ *                         of Tennessee Research Foundation.  All rights
+ *                         reserved.
+ */
+
+/* When BISON_FOUND is set, normal dependency tracking will generate the
+ * .y.[ch] in the build directory from the .y in the source directory (this file).
+ * In addition, one shall invoke by hand the rule to update the pregen
+ * .y.[ch] files, before committing any changes to the .y files, e.g.,
+ * `make parsec_pregen_flex_bison`.
+ *
+ * When BISON_FOUND is not set, the .y.[ch] version of this file is copied
+ * from the pregenerated .y.[ch] file in `contrib/pregen_flex_bison`, and
+ * modifying this file will result in a compilation error.
+ */
+
+#include "parsec/parsec_config.h"
+
+#include <stdio.h>
+#if defined(PARSEC_HAVE_STRING_H)
+#include <string.h>
+#endif  /* defined(PARSEC_HAVE_STRING_H) */
+#include <stdlib.h>
+#include <assert.h>
+
+#include "jdf.h"
+#include "string_arena.h"
+#include "jdf2c_utils.h"
+
+#define PARSEC_ERR_NEW_AS_OUTPUT  "Automatic data allocation with NEW only supported in IN dependencies.\n"
+#define PARSEC_ERR_NULL_AS_OUTPUT "NULL data only supported in IN dependencies.\n"
+
+#define YYDEBUG_LEXER_TEXT yytext
+
+/**
+ * Better error handling
+ */
+#define YYERROR_VERBOSE 1
+struct yyscan_t;
+#if defined(YYPURE) && YYPURE
+extern int yylex(struct yyscan_t *yycontrol);
+#else
+extern int yylex(void);
+#endif
+
+#include "parsec.y.h"
+
+extern int current_lineno;
+
+static jdf_expr_t *inline_c_functions = NULL;
+static jdf_expr_t *current_locally_bound_variables = NULL;
+static int current_locally_bound_variables_scope = 0;
+
+/**
+ *
+ * http://oreilly.com/linux/excerpts/9780596155971/error-reporting-recovery.html
+ *
+ */
+int yylex();
+
+static void yyerror(
+#if defined(YYPURE) && YYPURE
+                    YYLTYPE *locp,
+                    struct yyscan_t* yyscanner,
+#endif  /* defined(YYPURE) && YYPURE */
+                    char const *msg)
+{
+#if !defined(YYPURE) || !YYPURE
+    YYLTYPE *locp = &yylloc;
+#endif
+    if(NULL != locp) {
+        if(locp->first_line) {
+            fprintf(stderr, "parse error at (%d) %d.%d-%d.%d: %s\n",
+                    current_lineno, locp->first_line, locp->first_column,
+                    locp->last_line, locp->last_column, msg);
+        } else {
+            fprintf(stderr, "parse error at (%d): %s\n",
+                    current_lineno, msg);
+        }
+    } else {
+#if defined(YYPURE) && YYPURE
+        fprintf(stderr, "parse error near line %d: %s\n ", yyget_lineno(), msg);
+#endif
+    }
+}
+
+#define new(type) (type*)calloc(1, sizeof(type))
+
+jdf_def_list_t*
+jdf_create_properties_list( const char* name,
+                            int default_int,
+                            const char* default_char,
+                            jdf_def_list_t* next )
+{
+    jdf_def_list_t* property;
+    jdf_expr_t *e;
+
+    property                    = new(jdf_def_list_t);
+    property->next              = next;
+    property->name              = strdup(name);
+    JDF_OBJECT_LINENO(property) = current_lineno;
+
+    if( NULL != default_char ) {
+        e = new(jdf_expr_t);
+        e->op = JDF_STRING;
+        e->jdf_var = strdup(default_char);
+    } else {
+        e = new(jdf_expr_t);
+        e->op = JDF_CST;
+        e->jdf_cst = default_int;
+    }
+    property->expr = e;
+    return property;
+}
+
+static jdf_data_entry_t* jdf_find_or_create_data(jdf_t* jdf, const char* dname)
+{
+    jdf_data_entry_t* data = jdf->data;
+    jdf_global_entry_t* global = jdf->globals;
+
+    while( NULL != data ) {
+        if( !strcmp(data->dname, dname) ) {
+            return data;
+        }
+        data = data->next;
+    }
+    /* not found, create */
+    data = new(jdf_data_entry_t);
+    data->dname             = strdup(dname);
+    JDF_OBJECT_LINENO(data) = current_lineno;
+    data->nbparams          = -1;
+    data->next              = jdf->data;
+    jdf->data               = data;
+    /* Check if there is a global with the same name */
+    while( NULL != global ) {
+        if( !strcmp(global->name, data->dname) ) {
+            assert(NULL == global->data);
+            global->data = data;
+            data->global = global;
+
+            if( jdf_find_property( global->properties, "type", NULL ) == NULL ) {
+                global->properties = jdf_create_properties_list( "type", 0, "parsec_data_collection_t*", global->properties);
+            }
+
+            return data;
+        }
+        global = global->next;
+    }
+    assert(NULL == global);
+    global                    = new(jdf_global_entry_t);
+    global->name              = strdup(data->dname);
+    global->properties        = jdf_create_properties_list( "type", 0, "parsec_data_collection_t*", NULL );
+    global->data              = data;
+    global->expression        = NULL;
+    JDF_OBJECT_LINENO(global) = current_lineno;
+    data->global              = global;
+    /* Chain it with the other globals */
+    global->next = jdf->globals;
+    jdf->globals = global;
+
+    return data;
+}
+
+static int key_from_type(char *type) {
+    if (!strcmp(type, "int64_t")) return 1;
+    if (!strcmp(type, "float")) return 2;
+    if (!strcmp(type, "double")) return 3;
+    return 0;
+}
+
+static void named_expr_push_scope(void) {
+    current_locally_bound_variables_scope++;
+}
+
+static void named_expr_pop_scope(void) {
+    assert(current_locally_bound_variables_scope > 0);
+    while(NULL != current_locally_bound_variables && current_locally_bound_variables->scope == current_locally_bound_variables_scope) {
+        current_locally_bound_variables = current_locally_bound_variables->next;
+    }
+    current_locally_bound_variables_scope--;
+}
+
+static jdf_expr_t *named_expr_push_in_scope(char *var, jdf_expr_t *e) {
+    e->next = current_locally_bound_variables;
+    e->alias = var;
+    e->ldef_index = -1; /* Invalid index, used to capture mistakes and remember if an index was already assigned to this local definition */
+    e->scope = current_locally_bound_variables_scope;
+    current_locally_bound_variables = e;
+    return e;
+}
+
+static void
+process_datatype(jdf_datatransfer_type_t *datatype,
+                 jdf_dep_t *d,
+                 const jdf_def_list_t *properties,
+                 jdf_def_list_t *property,
+                 char *layout,
+                 char *count,
+                 char *displ)
+{
+    struct jdf_name_list *g, *e, *prec;
+    jdf_expr_t *expr = datatype->type;
+    if( NULL != jdf_find_property( properties, "arena_index", &property ) ) {
+        jdf_fatal(current_lineno, "Old construct arena_index used. Please update the code to use type instead.\n");
+        yyerror("");
+    }
+    if( NULL != jdf_find_property( properties, "nb_elt", &property ) ) {
+        jdf_fatal(current_lineno, "Old construct nb_elt used. Please update the code to use count instead.\n");
+        yyerror("");
+    }
+
+    if (expr->op == JDF_C_CODE){ /* Correct the type of the JDF_C_CODE function */
+        expr->jdf_type = PARSEC_RETURN_TYPE_ARENA_DATATYPE_T;
+    }
+
+    if( (JDF_STRING == expr->op) || (JDF_VAR == expr->op) ) {
+        /* Special case: [type = SOMETHING] -> define the PARSEC_ARENA_SOMETHING arena index */
+        for(prec = NULL, g = current_jdf.datatypes; g != NULL; g = g->next) {
+            if( 0 == strcmp(expr->jdf_var, g->name) ) {
+                break;
+            }
+            prec = g;
+        }
+        if( NULL == g ) {
+            e = new(struct jdf_name_list);
+            e->name = strdup(expr->jdf_var);
+            e->next = NULL;
+            if( NULL != prec ) {
+                prec->next = e;
+            } else {
+                current_jdf.datatypes = e;
+            }
+        }
+    }
+
+    /**
+     * The memory layout used for the transfer. Works together with the
+     * count and the displacement. If not layout is specified it is assumed
+     * the default layout of the type (arena) will be used.
+     */
+    datatype->layout = jdf_find_property( d->guard->properties, layout, &property );
+
+    /**
+     * The number of types to transfer.
+     */
+    expr = jdf_find_property( d->guard->properties, count, &property );
+    if( NULL == expr ) {
+        expr          = new(jdf_expr_t);
+        expr->op      = JDF_CST;
+        expr->jdf_cst = 1;
+    }
+    datatype->count = expr;
+
+    /**
+     * The displacement from the begining of the type.
+     */
+    expr = jdf_find_property( d->guard->properties, displ, &property );
+    if( NULL == expr ) {
+        expr          = new(jdf_expr_t);
+        expr->op      = JDF_CST;
+        expr->jdf_cst = 0;
+    } else {
+        if( !((JDF_CST != expr->op) && (0 == expr->jdf_cst)) )
+            d->dep_flags |= JDF_DEP_HAS_DISPL;
+    }
+    datatype->displ = expr;
+}
+
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
+
+#include "parsec.y.h"
+
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_VAR = 3,                        /* VAR  */
+  YYSYMBOL_ASSIGNMENT = 4,                 /* ASSIGNMENT  */
+  YYSYMBOL_EXTERN_DECL = 5,                /* EXTERN_DECL  */
+  YYSYMBOL_COMMA = 6,                      /* COMMA  */
+  YYSYMBOL_OPEN_PAR = 7,                   /* OPEN_PAR  */
+  YYSYMBOL_CLOSE_PAR = 8,                  /* CLOSE_PAR  */
+  YYSYMBOL_BODY_START = 9,                 /* BODY_START  */
+  YYSYMBOL_BODY_END = 10,                  /* BODY_END  */
+  YYSYMBOL_STRING = 11,                    /* STRING  */
+  YYSYMBOL_SIMCOST = 12,                   /* SIMCOST  */
+  YYSYMBOL_COLON = 13,                     /* COLON  */
+  YYSYMBOL_SEMICOLON = 14,                 /* SEMICOLON  */
+  YYSYMBOL_DEPENDENCY_TYPE = 15,           /* DEPENDENCY_TYPE  */
+  YYSYMBOL_ARROW = 16,                     /* ARROW  */
+  YYSYMBOL_QUESTION_MARK = 17,             /* QUESTION_MARK  */
+  YYSYMBOL_PROPERTIES_ON = 18,             /* PROPERTIES_ON  */
+  YYSYMBOL_PROPERTIES_OFF = 19,            /* PROPERTIES_OFF  */
+  YYSYMBOL_DATA_NEW = 20,                  /* DATA_NEW  */
+  YYSYMBOL_DATA_NULL = 21,                 /* DATA_NULL  */
+  YYSYMBOL_EQUAL = 22,                     /* EQUAL  */
+  YYSYMBOL_NOTEQUAL = 23,                  /* NOTEQUAL  */
+  YYSYMBOL_LESS = 24,                      /* LESS  */
+  YYSYMBOL_LEQ = 25,                       /* LEQ  */
+  YYSYMBOL_MORE = 26,                      /* MORE  */
+  YYSYMBOL_MEQ = 27,                       /* MEQ  */
+  YYSYMBOL_AND = 28,                       /* AND  */
+  YYSYMBOL_OR = 29,                        /* OR  */
+  YYSYMBOL_XOR = 30,                       /* XOR  */
+  YYSYMBOL_NOT = 31,                       /* NOT  */
+  YYSYMBOL_JDF_INT = 32,                   /* JDF_INT  */
+  YYSYMBOL_PLUS = 33,                      /* PLUS  */
+  YYSYMBOL_MINUS = 34,                     /* MINUS  */
+  YYSYMBOL_TIMES = 35,                     /* TIMES  */
+  YYSYMBOL_DIV = 36,                       /* DIV  */
+  YYSYMBOL_MODULO = 37,                    /* MODULO  */
+  YYSYMBOL_SHL = 38,                       /* SHL  */
+  YYSYMBOL_SHR = 39,                       /* SHR  */
+  YYSYMBOL_RANGE = 40,                     /* RANGE  */
+  YYSYMBOL_OPTION = 41,                    /* OPTION  */
+  YYSYMBOL_YYACCEPT = 42,                  /* $accept  */
+  YYSYMBOL_jdf_file = 43,                  /* jdf_file  */
+  YYSYMBOL_prologue = 44,                  /* prologue  */
+  YYSYMBOL_epilogue = 45,                  /* epilogue  */
+  YYSYMBOL_jdf = 46,                       /* jdf  */
+  YYSYMBOL_properties = 47,                /* properties  */
+  YYSYMBOL_property = 48,                  /* property  */
+  YYSYMBOL_properties_list = 49,           /* properties_list  */
+  YYSYMBOL_body = 50,                      /* body  */
+  YYSYMBOL_bodies = 51,                    /* bodies  */
+  YYSYMBOL_function = 52,                  /* function  */
+  YYSYMBOL_param_list = 53,                /* param_list  */
+  YYSYMBOL_local_variable = 54,            /* local_variable  */
+  YYSYMBOL_local_variables = 55,           /* local_variables  */
+  YYSYMBOL_simulation_cost = 56,           /* simulation_cost  */
+  YYSYMBOL_partitioning = 57,              /* partitioning  */
+  YYSYMBOL_dataflow_list = 58,             /* dataflow_list  */
+  YYSYMBOL_optional_flow_flags = 59,       /* optional_flow_flags  */
+  YYSYMBOL_dataflow = 60,                  /* dataflow  */
+  YYSYMBOL_named_expr = 61,                /* named_expr  */
+  YYSYMBOL_62_1 = 62,                      /* $@1  */
+  YYSYMBOL_named_expr_list = 63,           /* named_expr_list  */
+  YYSYMBOL_dependencies = 64,              /* dependencies  */
+  YYSYMBOL_dependency = 65,                /* dependency  */
+  YYSYMBOL_guarded_call = 66,              /* guarded_call  */
+  YYSYMBOL_call = 67,                      /* call  */
+  YYSYMBOL_priority = 68,                  /* priority  */
+  YYSYMBOL_expr_list_range = 69,           /* expr_list_range  */
+  YYSYMBOL_expr_list = 70,                 /* expr_list  */
+  YYSYMBOL_expr_range = 71,                /* expr_range  */
+  YYSYMBOL_72_2 = 72,                      /* $@2  */
+  YYSYMBOL_variable = 73,                  /* variable  */
+  YYSYMBOL_expr_simple = 74                /* expr_simple  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
+
+
+/* Default (constant) value used for initialization for null
+   right-hand sides.  Unlike the standard yacc.c template, here we set
+   the default value of $$ to a zeroed-out value.  Since the default
+   value is undefined, this behavior is technically correct.  */
+static YYSTYPE yyval_default;
+static YYLTYPE yyloc_default
+# if defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL
+  = { 1, 1, 1, 1 }
+# endif
+;
+
+
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef short
+# undef short
+#endif
+
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
+
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
+#endif
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
+#else
+typedef short yytype_int16;
+#endif
+
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
+#else
+typedef short yytype_uint8;
+#endif
+
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
+#else
+typedef int yytype_uint16;
+#endif
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
+#endif
+
+#ifndef YYSIZE_T
+# ifdef __SIZE_TYPE__
+#  define YYSIZE_T __SIZE_TYPE__
+# elif defined size_t
+#  define YYSIZE_T size_t
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYSIZE_T size_t
+# else
+#  define YYSIZE_T unsigned
+# endif
+#endif
+
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+#ifndef YY_
+# if defined YYENABLE_NLS && YYENABLE_NLS
+#  if ENABLE_NLS
+#   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
+#  endif
+# endif
+# ifndef YY_
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YYFREE
+# define YYFREE free
+#endif
+#ifndef YYMALLOC
+# define YYMALLOC malloc
+#endif
+#ifndef YYREALLOC
+# define YYREALLOC realloc
+#endif
+
+#ifdef __cplusplus
+  typedef bool yybool;
+# define yytrue true
+# define yyfalse false
+#else
+  /* When we move to stdbool, get rid of the various casts to yybool.  */
+  typedef signed char yybool;
+# define yytrue 1
+# define yyfalse 0
+#endif
+
+#ifndef YYSETJMP
+# include <setjmp.h>
+# define YYJMP_BUF jmp_buf
+# define YYSETJMP(Env) setjmp (Env)
+/* Pacify Clang and ICC.  */
+# define YYLONGJMP(Env, Val)                    \
+ do {                                           \
+   longjmp (Env, Val);                          \
+   YY_ASSERT (0);                               \
+ } while (yyfalse)
+#endif
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
+#endif
+
+/* The _Noreturn keyword of C11.  */
+#ifndef _Noreturn
+# if (defined __cplusplus \
+      && ((201103 <= __cplusplus && !(__GNUC__ == 4 && __GNUC_MINOR__ == 7)) \
+          || (defined _MSC_VER && 1900 <= _MSC_VER)))
+#  define _Noreturn [[noreturn]]
+# elif (!defined __cplusplus                     \
+        && (201112 <= (defined __STDC_VERSION__ ? __STDC_VERSION__ : 0)  \
+            || 4 < __GNUC__ + (7 <= __GNUC_MINOR__) \
+            || (defined __apple_build_version__ \
+                ? 6000000 <= __apple_build_version__ \
+                : 3 < __clang_major__ + (5 <= __clang_minor__))))
+   /* _Noreturn works as-is.  */
+# elif 2 < __GNUC__ + (8 <= __GNUC_MINOR__) || 0x5110 <= __SUNPRO_C
+#  define _Noreturn __attribute__ ((__noreturn__))
+# elif 1200 <= (defined _MSC_VER ? _MSC_VER : 0)
+#  define _Noreturn __declspec (noreturn)
+# else
+#  define _Noreturn
+# endif
+#endif
+
+/* Suppress unused-variable warnings by "using" E.  */
+#if ! defined lint || defined __GNUC__
+# define YYUSE(E) ((void) (E))
+#else
+# define YYUSE(E) /* empty */
+#endif
+
+#if defined __GNUC__ && ! defined __ICC && 407 <= __GNUC__ * 100 + __GNUC_MINOR__
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                            \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
+#else
+# define YY_INITIAL_VALUE(Value) Value
+#endif
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+/* YYFINAL -- State number of the termination state.  */
+#define YYFINAL  4
+/* YYLAST -- Last index in YYTABLE.  */
+#define YYLAST   423
+
+/* YYNTOKENS -- Number of terminals.  */
+#define YYNTOKENS  42
+/* YYNNTS -- Number of nonterminals.  */
+#define YYNNTS  33
+/* YYNRULES -- Number of rules.  */
+#define YYNRULES  86
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  168
+/* YYMAXRHS -- Maximum number of symbols on right-hand side of rule.  */
+#define YYMAXRHS 11
+/* YYMAXLEFT -- Maximum number of symbols to the left of a handle
+   accessed by $0, $-1, etc., in any rule.  */
+#define YYMAXLEFT 0
+
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   296
+
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_int8 yytranslate[] =
+{
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41
+};
+
+#if YYDEBUG
+/* YYRLINE[YYN] -- source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
+{
+       0,   367,   367,   375,   382,   386,   393,   397,   417,   442,
+     467,   473,   485,   490,   495,   504,   516,   521,   525,   552,
+     556,   563,   588,   598,   611,   624,   629,   636,   641,   644,
+     669,   675,   681,   685,   688,   712,   712,   717,   725,   729,
+     735,   741,   746,   863,   874,   885,   898,   910,   936,   946,
+     958,   962,   967,   973,   981,   986,   993,  1014,  1028,  1033,
+    1033,  1042,  1053,  1064,  1076,  1088,  1100,  1112,  1124,  1136,
+    1148,  1160,  1172,  1183,  1188,  1200,  1212,  1224,  1236,  1248,
+    1260,  1272,  1285,  1289,  1301,  1313,  1324
+};
+#endif
+
+#define YYPACT_NINF (-150)
+#define YYTABLE_NINF (-34)
+
+  /* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+     STATE-NUM.  */
+static const yytype_int16 yypact[] =
+{
+       9,  -150,     3,  -150,  -150,     4,    46,  -150,    57,  -150,
+    -150,   177,    65,    57,  -150,     2,  -150,  -150,  -150,   177,
+    -150,   177,  -150,    17,    53,   268,    64,    66,    57,    58,
+      72,   177,   135,  -150,  -150,    77,   177,   177,   177,   177,
+     177,   177,   177,   177,   177,   177,   177,   177,   177,   177,
+     177,   177,   177,  -150,    65,    63,  -150,  -150,   177,   291,
+    -150,  -150,   197,   384,   384,   158,   158,   158,   158,   350,
+     332,   368,   -14,   -14,  -150,  -150,  -150,    21,    21,  -150,
+      79,   291,   177,    80,    79,    71,   291,   172,  -150,   177,
+      73,  -150,    63,   220,   291,    87,    48,    88,  -150,   177,
+      85,  -150,    81,    91,    48,    92,    -4,   244,   177,   177,
+      90,    93,  -150,   172,    98,   177,   177,   100,   111,   291,
+      63,    90,  -150,    94,  -150,    93,  -150,   102,   291,   291,
+    -150,   177,   101,  -150,  -150,    41,  -150,   172,  -150,  -150,
+      88,   103,  -150,  -150,   112,    63,  -150,   314,  -150,     5,
+     172,   115,  -150,    82,  -150,   113,   116,   118,   106,  -150,
+     172,   172,    -2,  -150,   119,   103,  -150,  -150
+};
+
+  /* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+     Performed when YYTABLE does not specify something else to do.  Zero
+     means the default is an error.  */
+static const yytype_int8 yydefact[] =
+{
+       4,     3,     0,    11,     1,     6,    13,     5,     0,     2,
+       7,     0,     0,     0,     9,     0,    10,    61,    86,     0,
+      85,     0,    83,     0,    82,    13,    23,     0,    17,     0,
+       0,     0,     0,    72,    84,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     8,     0,    13,    16,    12,     0,    14,
+      73,    62,     0,    63,    64,    65,    66,    67,    68,    69,
+      70,    71,    74,    75,    76,    77,    78,    79,    80,    22,
+       0,    15,     0,     0,    26,    28,    81,     0,    25,     0,
+       0,    59,    13,    58,    27,     0,    31,     0,    24,     0,
+       0,    32,    51,     0,    31,     0,     0,    56,     0,     0,
+       0,    41,    30,     0,     0,     0,     0,     0,    55,    50,
+      13,    19,    21,    37,    34,    41,    38,     0,    60,    57,
+      29,     0,     0,    20,    35,     0,    40,     0,    54,    18,
+       0,    61,    48,    49,     0,    13,    43,     0,    39,     0,
+       0,     0,    42,     0,    36,     0,    53,     0,    44,    47,
+       0,     0,     0,    52,     0,     0,    45,    46
+};
+
+  /* YYPGOTO[NTERM-NUM].  */
+static const yytype_int16 yypgoto[] =
+{
+    -150,  -150,  -150,  -150,  -150,   -13,   121,    95,  -150,    10,
+    -150,    76,  -150,    42,  -150,  -150,    47,  -150,  -150,    30,
+    -150,    14,    31,  -150,  -150,  -149,  -150,   -95,    24,   -70,
+    -150,  -150,   -11
+};
+
+  /* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_int16 yydefgoto[] =
+{
+      -1,     2,     3,     9,     5,    14,    28,    29,   121,   122,
+      10,    27,    84,    85,    90,    96,   102,   103,   104,   144,
+     140,   106,   124,   125,   145,   146,   110,   155,   117,   156,
+      97,    24,    93
+};
+
+  /* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+     positive, shift that token.  If negative, reduce the rule whose
+     number is the opposite.  If YYTABLE_NINF, syntax error.  */
+static const yytype_int16 yytable[] =
+{
+      25,   165,   114,     4,   158,    30,    31,     6,    32,     7,
+      33,   114,    53,   166,     1,   115,   134,    92,   142,   143,
+      59,    48,    49,    50,   154,    62,    63,    64,    65,    66,
+      67,    68,    69,    70,    71,    72,    73,    74,    75,    76,
+      77,    78,    80,   126,   141,     8,    18,    81,    19,    34,
+      11,   -33,    20,    12,    46,    47,    48,    49,    50,   134,
+      15,   142,   143,   101,    13,   163,   164,   148,    26,    35,
+      54,    86,    21,    22,    55,    23,    58,    57,    94,    98,
+      61,    13,    83,    89,    87,   141,    95,    18,   107,    19,
+     100,   105,   108,    20,   111,   109,   113,   118,   119,   120,
+     134,   127,   142,   143,   128,   129,   137,   132,   130,   123,
+     150,   139,   134,    21,    22,   151,    23,   131,   157,   162,
+     118,   159,   160,    56,   147,   161,    88,   167,    36,    16,
+      79,   133,   152,    37,    38,    39,    40,    41,    42,    43,
+      44,    45,    62,    60,    46,    47,    48,    49,    50,    51,
+      52,   112,    36,   135,   149,   138,   136,    37,    38,    39,
+      40,    41,    42,    43,    44,    45,     0,     0,    46,    47,
+      48,    49,    50,    51,    52,    17,     0,    18,     0,    19,
+      17,     0,    18,    20,    19,     0,     0,     0,    20,     0,
+      91,    46,    47,    48,    49,    50,    51,    52,     0,     0,
+       0,     0,     0,    21,    22,     0,    23,     0,    21,    22,
+      82,    23,     0,     0,    36,     0,     0,     0,     0,    37,
+      38,    39,    40,    41,    42,    43,    44,    45,     0,     0,
+      46,    47,    48,    49,    50,    51,    52,    36,     0,     0,
+       0,     0,    37,    38,    39,    40,    41,    42,    43,    44,
+      45,     0,     0,    46,    47,    48,    49,    50,    51,    52,
+      99,    36,     0,     0,     0,     0,    37,    38,    39,    40,
+      41,    42,    43,    44,    45,     0,     0,    46,    47,    48,
+      49,    50,    51,    52,   116,    36,    13,     0,     0,     0,
+      37,    38,    39,    40,    41,    42,    43,    44,    45,     0,
+       0,    46,    47,    48,    49,    50,    51,    52,    36,     0,
+       0,     0,     0,    37,    38,    39,    40,    41,    42,    43,
+      44,    45,     0,     0,    46,    47,    48,    49,    50,    51,
+      52,   153,     0,     0,     0,     0,    37,    38,    39,    40,
+      41,    42,    43,    44,    45,     0,     0,    46,    47,    48,
+      49,    50,    51,    52,    37,    38,    39,    40,    41,    42,
+      43,     0,    45,     0,     0,    46,    47,    48,    49,    50,
+      51,    52,    37,    38,    39,    40,    41,    42,     0,     0,
+      45,     0,     0,    46,    47,    48,    49,    50,    51,    52,
+      37,    38,    39,    40,    41,    42,     0,     0,     0,     0,
+       0,    46,    47,    48,    49,    50,    51,    52,    39,    40,
+      41,    42,     0,     0,     0,     0,     0,    46,    47,    48,
+      49,    50,    51,    52
+};
+
+static const yytype_int16 yycheck[] =
+{
+      11,     3,     6,     0,   153,     3,     4,     3,    19,     5,
+      21,     6,    25,   162,     5,    19,    18,    87,    20,    21,
+      31,    35,    36,    37,    19,    36,    37,    38,    39,    40,
+      41,    42,    43,    44,    45,    46,    47,    48,    49,    50,
+      51,    52,    55,   113,     3,    41,     5,    58,     7,    32,
+       4,     3,    11,     7,    33,    34,    35,    36,    37,    18,
+       3,    20,    21,    15,    18,   160,   161,   137,     3,    16,
+       6,    82,    31,    32,     8,    34,     4,    19,    89,    92,
+       3,    18,     3,    12,     4,     3,    13,     5,    99,     7,
+       3,     3,     7,    11,     3,    14,     4,   108,   109,     9,
+      18,     3,    20,    21,   115,   116,     4,   120,     8,    16,
+       7,    10,    18,    31,    32,     3,    34,     6,     3,    13,
+     131,     8,     6,    28,   135,     7,    84,     8,    17,     8,
+      54,   121,   145,    22,    23,    24,    25,    26,    27,    28,
+      29,    30,   153,     8,    33,    34,    35,    36,    37,    38,
+      39,   104,    17,   123,   140,   131,   125,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    -1,    -1,    33,    34,
+      35,    36,    37,    38,    39,     3,    -1,     5,    -1,     7,
+       3,    -1,     5,    11,     7,    -1,    -1,    -1,    11,    -1,
+      18,    33,    34,    35,    36,    37,    38,    39,    -1,    -1,
+      -1,    -1,    -1,    31,    32,    -1,    34,    -1,    31,    32,
+      13,    34,    -1,    -1,    17,    -1,    -1,    -1,    -1,    22,
+      23,    24,    25,    26,    27,    28,    29,    30,    -1,    -1,
+      33,    34,    35,    36,    37,    38,    39,    17,    -1,    -1,
+      -1,    -1,    22,    23,    24,    25,    26,    27,    28,    29,
+      30,    -1,    -1,    33,    34,    35,    36,    37,    38,    39,
+      40,    17,    -1,    -1,    -1,    -1,    22,    23,    24,    25,
+      26,    27,    28,    29,    30,    -1,    -1,    33,    34,    35,
+      36,    37,    38,    39,    40,    17,    18,    -1,    -1,    -1,
+      22,    23,    24,    25,    26,    27,    28,    29,    30,    -1,
+      -1,    33,    34,    35,    36,    37,    38,    39,    17,    -1,
+      -1,    -1,    -1,    22,    23,    24,    25,    26,    27,    28,
+      29,    30,    -1,    -1,    33,    34,    35,    36,    37,    38,
+      39,    17,    -1,    -1,    -1,    -1,    22,    23,    24,    25,
+      26,    27,    28,    29,    30,    -1,    -1,    33,    34,    35,
+      36,    37,    38,    39,    22,    23,    24,    25,    26,    27,
+      28,    -1,    30,    -1,    -1,    33,    34,    35,    36,    37,
+      38,    39,    22,    23,    24,    25,    26,    27,    -1,    -1,
+      30,    -1,    -1,    33,    34,    35,    36,    37,    38,    39,
+      22,    23,    24,    25,    26,    27,    -1,    -1,    -1,    -1,
+      -1,    33,    34,    35,    36,    37,    38,    39,    24,    25,
+      26,    27,    -1,    -1,    -1,    -1,    -1,    33,    34,    35,
+      36,    37,    38,    39
+};
+
+  /* YYSTOS[STATE-NUM] -- The (internal number of the) accessing
+     symbol of state STATE-NUM.  */
+static const yytype_int8 yystos[] =
+{
+       0,     5,    43,    44,     0,    46,     3,     5,    41,    45,
+      52,     4,     7,    18,    47,     3,    48,     3,     5,     7,
+      11,    31,    32,    34,    73,    74,     3,    53,    48,    49,
+       3,     4,    74,    74,    32,    16,    17,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    33,    34,    35,    36,
+      37,    38,    39,    47,     6,     8,    49,    19,     4,    74,
+       8,     3,    74,    74,    74,    74,    74,    74,    74,    74,
+      74,    74,    74,    74,    74,    74,    74,    74,    74,    53,
+      47,    74,    13,     3,    54,    55,    74,     4,    55,    12,
+      56,    18,    71,    74,    74,    13,    57,    72,    47,    40,
+       3,    15,    58,    59,    60,     3,    63,    74,     7,    14,
+      68,     3,    58,     4,     6,    19,    40,    70,    74,    74,
+       9,    50,    51,    16,    64,    65,    71,     3,    74,    74,
+       8,     6,    47,    51,    18,    61,    64,     4,    70,    10,
+      62,     3,    20,    21,    61,    66,    67,    74,    71,    63,
+       7,     3,    47,    17,    19,    69,    71,     3,    67,     8,
+       6,     7,    13,    69,    69,     3,    67,     8
+};
+
+  /* YYR1[YYN] -- Symbol number of symbol that rule YYN derives.  */
+static const yytype_int8 yyr1[] =
+{
+       0,    42,    43,    44,    44,    45,    45,    46,    46,    46,
+      46,    46,    47,    47,    48,    48,    49,    49,    50,    51,
+      51,    52,    53,    53,    54,    55,    55,    56,    56,    57,
+      58,    58,    59,    59,    60,    62,    61,    61,    63,    63,
+      64,    64,    65,    66,    66,    66,    67,    67,    67,    67,
+      68,    68,    69,    69,    70,    70,    71,    71,    71,    72,
+      71,    73,    73,    74,    74,    74,    74,    74,    74,    74,
+      74,    74,    74,    74,    74,    74,    74,    74,    74,    74,
+      74,    74,    74,    74,    74,    74,    74
+};
+
+  /* YYR2[YYN] -- Number of symbols on the right hand side of rule YYN.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     3,     1,     0,     1,     0,     2,     5,     3,
+       3,     0,     3,     0,     3,     4,     2,     1,     3,     1,
+       2,    11,     3,     1,     4,     2,     1,     2,     0,     5,
+       2,     0,     1,     0,     3,     0,     4,     0,     3,     5,
+       2,     0,     4,     1,     3,     5,     6,     4,     1,     1,
+       2,     0,     3,     1,     3,     1,     3,     5,     1,     0,
+       5,     1,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     2,     3,     3,     3,     3,     3,     3,     3,
+       3,     5,     1,     1,     2,     1,     1
+};
+
+
+/* YYDPREC[RULE-NUM] -- Dynamic precedence of rule #RULE-NUM (0 if none).  */
+static const yytype_int8 yydprec[] =
+{
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0
+};
+
+/* YYMERGER[RULE-NUM] -- Index of merging function for rule #RULE-NUM.  */
+static const yytype_int8 yymerger[] =
+{
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0
+};
+
+/* YYIMMEDIATE[RULE-NUM] -- True iff rule #RULE-NUM is not to be deferred, as
+   in the case of predicates.  */
+static const yybool yyimmediate[] =
+{
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0
+};
+
+/* YYCONFLP[YYPACT[STATE-NUM]] -- Pointer into YYCONFL of start of
+   list of conflicting reductions corresponding to action entry for
+   state STATE-NUM in yytable.  0 means no conflicts.  The list in
+   yyconfl is terminated by a rule number of 0.  */
+static const yytype_int8 yyconflp[] =
+{
+       0,     9,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     1,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     5,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     7,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     3,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0
+};
+
+/* YYCONFL[I] -- lists of conflicting rule numbers, each terminated by
+   0, pointed into by YYCONFLP.  */
+static const short yyconfl[] =
+{
+       0,     4,     0,    37,     0,    37,     0,    37,     0,    37,
+       0
+};
+
+
+/* YYLLOC_DEFAULT -- Set CURRENT to span from RHS[1] to RHS[N].
+   If N is 0, then set CURRENT to the empty location which ends
+   the previous symbol: RHS[0] (always defined).  */
+
+#ifndef YYLLOC_DEFAULT
+# define YYLLOC_DEFAULT(Current, Rhs, N)                                \
+    do                                                                  \
+      if (N)                                                            \
+        {                                                               \
+          (Current).first_line   = YYRHSLOC (Rhs, 1).first_line;        \
+          (Current).first_column = YYRHSLOC (Rhs, 1).first_column;      \
+          (Current).last_line    = YYRHSLOC (Rhs, N).last_line;         \
+          (Current).last_column  = YYRHSLOC (Rhs, N).last_column;       \
+        }                                                               \
+      else                                                              \
+        {                                                               \
+          (Current).first_line   = (Current).last_line   =              \
+            YYRHSLOC (Rhs, 0).last_line;                                \
+          (Current).first_column = (Current).last_column =              \
+            YYRHSLOC (Rhs, 0).last_column;                              \
+        }                                                               \
+    while (0)
+#endif
+
+# define YYRHSLOC(Rhs, K) ((Rhs)[K].yystate.yyloc)
+
+
+YYSTYPE yylval;
+YYLTYPE yylloc;
+
+int yynerrs;
+int yychar;
+
+enum { YYENOMEM = -2 };
+
+typedef enum { yyok, yyaccept, yyabort, yyerr } YYRESULTTAG;
+
+#define YYCHK(YYE)                              \
+  do {                                          \
+    YYRESULTTAG yychk_flag = YYE;               \
+    if (yychk_flag != yyok)                     \
+      return yychk_flag;                        \
+  } while (0)
+
+/* YYINITDEPTH -- initial size of the parser's stacks.  */
+#ifndef YYINITDEPTH
+# define YYINITDEPTH 200
+#endif
+
+/* YYMAXDEPTH -- maximum size the stacks can grow to (effective only
+   if the built-in stack extension method is used).
+
+   Do not make this value too large; the results are undefined if
+   SIZE_MAX < YYMAXDEPTH * sizeof (GLRStackItem)
+   evaluated with infinite-precision integer arithmetic.  */
+
+#ifndef YYMAXDEPTH
+# define YYMAXDEPTH 10000
+#endif
+
+/* Minimum number of free items on the stack allowed after an
+   allocation.  This is to allow allocation and initialization
+   to be completed by functions that call yyexpandGLRStack before the
+   stack is expanded, thus insuring that all necessary pointers get
+   properly redirected to new data.  */
+#define YYHEADROOM 2
+
+#ifndef YYSTACKEXPANDABLE
+#  define YYSTACKEXPANDABLE 1
+#endif
+
+#if YYSTACKEXPANDABLE
+# define YY_RESERVE_GLRSTACK(Yystack)                   \
+  do {                                                  \
+    if (Yystack->yyspaceLeft < YYHEADROOM)              \
+      yyexpandGLRStack (Yystack);                       \
+  } while (0)
+#else
+# define YY_RESERVE_GLRSTACK(Yystack)                   \
+  do {                                                  \
+    if (Yystack->yyspaceLeft < YYHEADROOM)              \
+      yyMemoryExhausted (Yystack);                      \
+  } while (0)
+#endif
+
+/** State numbers. */
+typedef int yy_state_t;
+
+/** Rule numbers. */
+typedef int yyRuleNum;
+
+/** Item references. */
+typedef short yyItemNum;
+
+typedef struct yyGLRState yyGLRState;
+typedef struct yyGLRStateSet yyGLRStateSet;
+typedef struct yySemanticOption yySemanticOption;
+typedef union yyGLRStackItem yyGLRStackItem;
+typedef struct yyGLRStack yyGLRStack;
+
+struct yyGLRState {
+  /** Type tag: always true.  */
+  yybool yyisState;
+  /** Type tag for yysemantics.  If true, yysval applies, otherwise
+   *  yyfirstVal applies.  */
+  yybool yyresolved;
+  /** Number of corresponding LALR(1) machine state.  */
+  yy_state_t yylrState;
+  /** Preceding state in this stack */
+  yyGLRState* yypred;
+  /** Source position of the last token produced by my symbol */
+  YYPTRDIFF_T yyposn;
+  union {
+    /** First in a chain of alternative reductions producing the
+     *  nonterminal corresponding to this state, threaded through
+     *  yynext.  */
+    yySemanticOption* yyfirstVal;
+    /** Semantic value for this state.  */
+    YYSTYPE yysval;
+  } yysemantics;
+  /** Source location for this state.  */
+  YYLTYPE yyloc;
+};
+
+struct yyGLRStateSet {
+  yyGLRState** yystates;
+  /** During nondeterministic operation, yylookaheadNeeds tracks which
+   *  stacks have actually needed the current lookahead.  During deterministic
+   *  operation, yylookaheadNeeds[0] is not maintained since it would merely
+   *  duplicate yychar != YYEMPTY.  */
+  yybool* yylookaheadNeeds;
+  YYPTRDIFF_T yysize;
+  YYPTRDIFF_T yycapacity;
+};
+
+struct yySemanticOption {
+  /** Type tag: always false.  */
+  yybool yyisState;
+  /** Rule number for this reduction */
+  yyRuleNum yyrule;
+  /** The last RHS state in the list of states to be reduced.  */
+  yyGLRState* yystate;
+  /** The lookahead for this reduction.  */
+  int yyrawchar;
+  YYSTYPE yyval;
+  YYLTYPE yyloc;
+  /** Next sibling in chain of options.  To facilitate merging,
+   *  options are chained in decreasing order by address.  */
+  yySemanticOption* yynext;
+};
+
+/** Type of the items in the GLR stack.  The yyisState field
+ *  indicates which item of the union is valid.  */
+union yyGLRStackItem {
+  yyGLRState yystate;
+  yySemanticOption yyoption;
+};
+
+struct yyGLRStack {
+  int yyerrState;
+  /* To compute the location of the error token.  */
+  yyGLRStackItem yyerror_range[3];
+
+  YYJMP_BUF yyexception_buffer;
+  yyGLRStackItem* yyitems;
+  yyGLRStackItem* yynextFree;
+  YYPTRDIFF_T yyspaceLeft;
+  yyGLRState* yysplitPoint;
+  yyGLRState* yylastDeleted;
+  yyGLRStateSet yytops;
+};
+
+#if YYSTACKEXPANDABLE
+static void yyexpandGLRStack (yyGLRStack* yystackp);
+#endif
+
+_Noreturn static void
+yyFail (yyGLRStack* yystackp, const char* yymsg)
+{
+  if (yymsg != YY_NULLPTR)
+    yyerror (yymsg);
+  YYLONGJMP (yystackp->yyexception_buffer, 1);
+}
+
+_Noreturn static void
+yyMemoryExhausted (yyGLRStack* yystackp)
+{
+  YYLONGJMP (yystackp->yyexception_buffer, 2);
+}
+
+/** Accessing symbol of state YYSTATE.  */
+static inline yysymbol_kind_t
+yy_accessing_symbol (yy_state_t yystate)
+{
+  return YY_CAST (yysymbol_kind_t, yystos[yystate]);
+}
+
+#if 1
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
+/* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
+   First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
+static const char *const yytname[] =
+{
+  "\"end of file\"", "error", "\"invalid token\"", "VAR", "ASSIGNMENT",
+  "EXTERN_DECL", "COMMA", "OPEN_PAR", "CLOSE_PAR", "BODY_START",
+  "BODY_END", "STRING", "SIMCOST", "COLON", "SEMICOLON", "DEPENDENCY_TYPE",
+  "ARROW", "QUESTION_MARK", "PROPERTIES_ON", "PROPERTIES_OFF", "DATA_NEW",
+  "DATA_NULL", "EQUAL", "NOTEQUAL", "LESS", "LEQ", "MORE", "MEQ", "AND",
+  "OR", "XOR", "NOT", "JDF_INT", "PLUS", "MINUS", "TIMES", "DIV", "MODULO",
+  "SHL", "SHR", "RANGE", "OPTION", "$accept", "jdf_file", "prologue",
+  "epilogue", "jdf", "properties", "property", "properties_list", "body",
+  "bodies", "function", "param_list", "local_variable", "local_variables",
+  "simulation_cost", "partitioning", "dataflow_list",
+  "optional_flow_flags", "dataflow", "named_expr", "$@1",
+  "named_expr_list", "dependencies", "dependency", "guarded_call", "call",
+  "priority", "expr_list_range", "expr_list", "expr_range", "$@2",
+  "variable", "expr_simple", YY_NULLPTR
+};
+
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
+{
+  return yytname[yysymbol];
+}
+#endif
+
+#if YYDEBUG
+
+# ifndef YYFPRINTF
+#  define YYFPRINTF fprintf
+# endif
+
+# define YY_FPRINTF                             \
+  YY_IGNORE_USELESS_CAST_BEGIN YY_FPRINTF_
+
+# define YY_FPRINTF_(Args)                      \
+  do {                                          \
+    YYFPRINTF Args;                             \
+    YY_IGNORE_USELESS_CAST_END                  \
+  } while (0)
+
+# define YY_DPRINTF                             \
+  YY_IGNORE_USELESS_CAST_BEGIN YY_DPRINTF_
+
+# define YY_DPRINTF_(Args)                      \
+  do {                                          \
+    if (yydebug)                                \
+      YYFPRINTF Args;                           \
+    YY_IGNORE_USELESS_CAST_END                  \
+  } while (0)
+
+
+/* YY_LOCATION_PRINT -- Print the location on the stream.
+   This macro was not mandated originally: define only if we know
+   we won't break user code: when these are the locations we know.  */
+
+# ifndef YY_LOCATION_PRINT
+#  if defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL
+
+/* Print *YYLOCP on YYO.  Private, do not rely on its existence. */
+
+YY_ATTRIBUTE_UNUSED
+static int
+yy_location_print_ (FILE *yyo, YYLTYPE const * const yylocp)
+{
+  int res = 0;
+  int end_col = 0 != yylocp->last_column ? yylocp->last_column - 1 : 0;
+  if (0 <= yylocp->first_line)
+    {
+      res += YYFPRINTF (yyo, "%d", yylocp->first_line);
+      if (0 <= yylocp->first_column)
+        res += YYFPRINTF (yyo, ".%d", yylocp->first_column);
+    }
+  if (0 <= yylocp->last_line)
+    {
+      if (yylocp->first_line < yylocp->last_line)
+        {
+          res += YYFPRINTF (yyo, "-%d", yylocp->last_line);
+          if (0 <= end_col)
+            res += YYFPRINTF (yyo, ".%d", end_col);
+        }
+      else if (0 <= end_col && yylocp->first_column < end_col)
+        res += YYFPRINTF (yyo, "-%d", end_col);
+    }
+  return res;
+ }
+
+#   define YY_LOCATION_PRINT(File, Loc)          \
+  yy_location_print_ (File, &(Loc))
+
+#  else
+#   define YY_LOCATION_PRINT(File, Loc) ((void) 0)
+#  endif
+# endif /* !defined YY_LOCATION_PRINT */
+
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
+static void
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp)
+{
+  FILE *yyoutput = yyo;
+  YYUSE (yyoutput);
+  YYUSE (yylocationp);
+  if (!yyvaluep)
+    return;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YYUSE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
+
+static void
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp)
+{
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
+
+  YY_LOCATION_PRINT (yyo, *yylocationp);
+  YYFPRINTF (yyo, ": ");
+  yy_symbol_value_print (yyo, yykind, yyvaluep, yylocationp);
+  YYFPRINTF (yyo, ")");
+}
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                  \
+  do {                                                                  \
+    if (yydebug)                                                        \
+      {                                                                 \
+        YY_FPRINTF ((stderr, "%s ", Title));                            \
+        yy_symbol_print (stderr, Kind, Value, Location);        \
+        YY_FPRINTF ((stderr, "\n"));                                    \
+      }                                                                 \
+  } while (0)
+
+/* Nonzero means print parse trace.  It is left uninitialized so that
+   multiple parsers can coexist.  */
+int yydebug;
+
+static void yypstack (yyGLRStack* yystackp, YYPTRDIFF_T yyk)
+  YY_ATTRIBUTE_UNUSED;
+static void yypdumpstack (yyGLRStack* yystackp)
+  YY_ATTRIBUTE_UNUSED;
+
+#else /* !YYDEBUG */
+
+# define YY_DPRINTF(Args) do {} while (yyfalse)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
+
+#endif /* !YYDEBUG */
+
+#ifndef yystrlen
+# define yystrlen(S) (YY_CAST (YYPTRDIFF_T, strlen (S)))
+#endif
+
+#ifndef yystpcpy
+# if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
+#  define yystpcpy stpcpy
+# else
+/* Copy YYSRC to YYDEST, returning the address of the terminating '\0' in
+   YYDEST.  */
+static char *
+yystpcpy (char *yydest, const char *yysrc)
+{
+  char *yyd = yydest;
+  const char *yys = yysrc;
+
+  while ((*yyd++ = *yys++) != '\0')
+    continue;
+
+  return yyd - 1;
+}
+# endif
+#endif
+
+#ifndef yytnamerr
+/* Copy to YYRES the contents of YYSTR after stripping away unnecessary
+   quotes and backslashes, so that it's suitable for yyerror.  The
+   heuristic is that double-quoting is unnecessary unless the string
+   contains an apostrophe, a comma, or backslash (other than
+   backslash-backslash).  YYSTR is taken from yytname.  If YYRES is
+   null, do not copy; instead, return the length of what the result
+   would have been.  */
+static YYPTRDIFF_T
+yytnamerr (char *yyres, const char *yystr)
+{
+  if (*yystr == '"')
+    {
+      YYPTRDIFF_T yyn = 0;
+      char const *yyp = yystr;
+
+      for (;;)
+        switch (*++yyp)
+          {
+          case '\'':
+          case ',':
+            goto do_not_strip_quotes;
+
+          case '\\':
+            if (*++yyp != '\\')
+              goto do_not_strip_quotes;
+            else
+              goto append;
+
+          append:
+          default:
+            if (yyres)
+              yyres[yyn] = *yyp;
+            yyn++;
+            break;
+
+          case '"':
+            if (yyres)
+              yyres[yyn] = '\0';
+            return yyn;
+          }
+    do_not_strip_quotes: ;
+    }
+
+  if (yyres)
+    return yystpcpy (yyres, yystr) - yyres;
+  else
+    return yystrlen (yystr);
+}
+#endif
+
+
+/** Fill in YYVSP[YYLOW1 .. YYLOW0-1] from the chain of states starting
+ *  at YYVSP[YYLOW0].yystate.yypred.  Leaves YYVSP[YYLOW1].yystate.yypred
+ *  containing the pointer to the next state in the chain.  */
+static void yyfillin (yyGLRStackItem *, int, int) YY_ATTRIBUTE_UNUSED;
+static void
+yyfillin (yyGLRStackItem *yyvsp, int yylow0, int yylow1)
+{
+  int i;
+  yyGLRState *s = yyvsp[yylow0].yystate.yypred;
+  for (i = yylow0-1; i >= yylow1; i -= 1)
+    {
+#if YYDEBUG
+      yyvsp[i].yystate.yylrState = s->yylrState;
+#endif
+      yyvsp[i].yystate.yyresolved = s->yyresolved;
+      if (s->yyresolved)
+        yyvsp[i].yystate.yysemantics.yysval = s->yysemantics.yysval;
+      else
+        /* The effect of using yysval or yyloc (in an immediate rule) is
+         * undefined.  */
+        yyvsp[i].yystate.yysemantics.yyfirstVal = YY_NULLPTR;
+      yyvsp[i].yystate.yyloc = s->yyloc;
+      s = yyvsp[i].yystate.yypred = s->yypred;
+    }
+}
+
+
+/** If yychar is empty, fetch the next token.  */
+static inline yysymbol_kind_t
+yygetToken (int *yycharp)
+{
+  yysymbol_kind_t yytoken;
+  if (*yycharp == YYEMPTY)
+    {
+      YY_DPRINTF ((stderr, "Reading a token\n"));
+      *yycharp = yylex ();
+    }
+  if (*yycharp <= YYEOF)
+    {
+      *yycharp = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
+      YY_DPRINTF ((stderr, "Now at end of input.\n"));
+    }
+  else
+    {
+      yytoken = YYTRANSLATE (*yycharp);
+      YY_SYMBOL_PRINT ("Next token is", yytoken, &yylval, &yylloc);
+    }
+  return yytoken;
+}
+
+/* Do nothing if YYNORMAL or if *YYLOW <= YYLOW1.  Otherwise, fill in
+ * YYVSP[YYLOW1 .. *YYLOW-1] as in yyfillin and set *YYLOW = YYLOW1.
+ * For convenience, always return YYLOW1.  */
+static inline int yyfill (yyGLRStackItem *, int *, int, yybool)
+     YY_ATTRIBUTE_UNUSED;
+static inline int
+yyfill (yyGLRStackItem *yyvsp, int *yylow, int yylow1, yybool yynormal)
+{
+  if (!yynormal && yylow1 < *yylow)
+    {
+      yyfillin (yyvsp, *yylow, yylow1);
+      *yylow = yylow1;
+    }
+  return yylow1;
+}
+
+/** Perform user action for rule number YYN, with RHS length YYRHSLEN,
+ *  and top stack item YYVSP.  YYLVALP points to place to put semantic
+ *  value ($$), and yylocp points to place for location information
+ *  (@$).  Returns yyok for normal return, yyaccept for YYACCEPT,
+ *  yyerr for YYERROR, yyabort for YYABORT.  */
+static YYRESULTTAG
+yyuserAction (yyRuleNum yyn, int yyrhslen, yyGLRStackItem* yyvsp,
+              yyGLRStack* yystackp,
+              YYSTYPE* yyvalp, YYLTYPE *yylocp)
+{
+  yybool yynormal YY_ATTRIBUTE_UNUSED = yystackp->yysplitPoint == YY_NULLPTR;
+  int yylow;
+  YYUSE (yyvalp);
+  YYUSE (yylocp);
+  YYUSE (yyrhslen);
+# undef yyerrok
+# define yyerrok (yystackp->yyerrState = 0)
+# undef YYACCEPT
+# define YYACCEPT return yyaccept
+# undef YYABORT
+# define YYABORT return yyabort
+# undef YYERROR
+# define YYERROR return yyerrok, yyerr
+# undef YYRECOVERING
+# define YYRECOVERING() (yystackp->yyerrState != 0)
+# undef yyclearin
+# define yyclearin (yychar = YYEMPTY)
+# undef YYFILL
+# define YYFILL(N) yyfill (yyvsp, &yylow, (N), yynormal)
+# undef YYBACKUP
+# define YYBACKUP(Token, Value)                                              \
+  return yyerror (YY_("syntax error: cannot back up")),     \
+         yyerrok, yyerr
+
+  yylow = 1;
+  if (yyrhslen == 0)
+    *yyvalp = yyval_default;
+  else
+    *yyvalp = yyvsp[YYFILL (1-yyrhslen)].yystate.yysemantics.yysval;
+  /* Default location. */
+  YYLLOC_DEFAULT ((*yylocp), (yyvsp - yyrhslen), yyrhslen);
+  yystackp->yyerror_range[1].yystate.yyloc = *yylocp;
+
+  switch (yyn)
+    {
+  case 2: /* jdf_file: prologue jdf epilogue  */
+                {
+                    assert( NULL == current_jdf.prologue );
+                    assert( NULL == current_jdf.epilogue );
+                    current_jdf.prologue = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yysval.external_code);
+                    current_jdf.epilogue = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.external_code);
+                }
+    break;
+
+  case 3: /* prologue: EXTERN_DECL  */
+                {
+                    ((*yyvalp).external_code) = new(jdf_external_entry_t);
+                    ((*yyvalp).external_code)->external_code = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.string);
+                    JDF_OBJECT_LINENO(((*yyvalp).external_code)) = current_lineno;
+                }
+    break;
+
+  case 4: /* prologue: %empty  */
+                {
+                    ((*yyvalp).external_code) = NULL;
+                }
+    break;
+
+  case 5: /* epilogue: EXTERN_DECL  */
+                {
+                    ((*yyvalp).external_code) = new(jdf_external_entry_t);
+                    ((*yyvalp).external_code)->external_code = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.string);
+                    JDF_OBJECT_LINENO(((*yyvalp).external_code)) = current_lineno;
+                }
+    break;
+
+  case 6: /* epilogue: %empty  */
+                {
+                    ((*yyvalp).external_code) = NULL;
+                }
+    break;
+
+  case 7: /* jdf: jdf function  */
+                {
+                    jdf_expr_t *el;
+
+                    if( NULL == current_jdf.functions ) {
+                        (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.function)->task_class_id = 0;
+                    } else {
+                        (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.function)->task_class_id = current_jdf.functions->task_class_id + 1;
+                    }
+                    (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.function)->next = current_jdf.functions;
+                    current_jdf.functions = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.function);
+                    if( NULL != inline_c_functions) {
+                        /* Every inline functions declared here where within the context of $2 */
+                        for(el = inline_c_functions; NULL != el; el = el->next_inline) {
+                            el->jdf_c_code.function_context = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.function);
+                        }
+                    }
+                    (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.function)->inline_c_functions = inline_c_functions;
+                    inline_c_functions = NULL;
+                }
+    break;
+
+  case 8: /* jdf: jdf VAR ASSIGNMENT expr_simple properties  */
+                {
+                    jdf_global_entry_t *g, *e = new(jdf_global_entry_t);
+                    jdf_expr_t *el;
+
+                    e->next              = NULL;
+                    e->name              = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yysval.string);
+                    e->properties        = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.property);
+                    e->expression        = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yysval.expr);
+                    JDF_OBJECT_LINENO(e) = current_lineno;
+                    if( current_jdf.globals == NULL ) {
+                        current_jdf.globals = e;
+                    } else {
+                        for(g = current_jdf.globals; g->next != NULL; g = g->next)
+                            /* nothing */ ;
+                        g->next = e;
+                    }
+                    if( NULL != inline_c_functions ) {
+                        /* Every inline functions declared here where within the context of globals only (no assignment) */
+                        for(el = inline_c_functions; NULL != el->next_inline; el = el->next_inline) /* nothing */ ;
+                        el->next_inline = current_jdf.inline_c_functions;
+                        current_jdf.inline_c_functions = inline_c_functions;
+                        inline_c_functions = NULL;
+                    }
+                }
+    break;
+
+  case 9: /* jdf: jdf VAR properties  */
+                {
+                    jdf_global_entry_t *g, *e = new(jdf_global_entry_t);
+                    jdf_expr_t *el;
+
+                    e->next              = NULL;
+                    e->name              = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yysval.string);
+                    e->properties        = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.property);
+                    e->expression        = NULL;
+                    JDF_OBJECT_LINENO(e) = current_lineno;
+                    if( current_jdf.globals == NULL ) {
+                        current_jdf.globals = e;
+                    } else {
+                        for(g = current_jdf.globals; g->next != NULL; g = g->next)
+                            /* nothing */ ;
+                        g->next = e;
+                    }
+                    if( NULL != inline_c_functions ) {
+                        /* Every inline functions declared here where within the context of globals only (no assignment) */
+                        for(el = inline_c_functions; NULL != el->next_inline; el = el->next_inline) /* nothing */ ;
+                        el->next_inline = current_jdf.inline_c_functions;
+                        current_jdf.inline_c_functions = inline_c_functions;
+                        inline_c_functions = NULL;
+                    }
+                }
+    break;
+
+  case 10: /* jdf: jdf OPTION property  */
+                {
+                    (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.property)->next = current_jdf.global_properties;
+                    current_jdf.global_properties = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.property);
+                }
+    break;
+
+  case 11: /* jdf: %empty  */
+                {
+                    if( NULL != inline_c_functions ) {
+                        jdf_expr_t *el;
+                        /* Every inline functions declared here where within the context of globals only (no assignment) */
+                        for(el = inline_c_functions; NULL != el->next_inline; el = el->next_inline) /* nothing */ ;
+                        el->next_inline = current_jdf.inline_c_functions;
+                        current_jdf.inline_c_functions = inline_c_functions;
+                        inline_c_functions = NULL;
+                    }
+                }
+    break;
+
+  case 12: /* properties: PROPERTIES_ON properties_list PROPERTIES_OFF  */
+              {
+                  ((*yyvalp).property) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yysval.property);
+              }
+    break;
+
+  case 13: /* properties: %empty  */
+              {
+                  ((*yyvalp).property) = NULL;
+              }
+    break;
+
+  case 14: /* property: VAR ASSIGNMENT expr_simple  */
+              {
+                  jdf_def_list_t* assign = new(jdf_def_list_t);
+                  assign->next              = NULL;
+                  assign->name              = strdup((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yysval.string));
+                  assign->expr              = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.expr);
+                  JDF_OBJECT_LINENO(assign) = JDF_OBJECT_LINENO((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.expr));
+                  ((*yyvalp).property) = assign;
+              }
+    break;
+
+  case 15: /* property: VAR VAR ASSIGNMENT expr_simple  */
+              {
+                  jdf_def_list_t* assign = new(jdf_def_list_t);
+                  assign->next              = NULL;
+                  assign->name              = strdup((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yysval.string));
+                  assign->expr              = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.expr);
+                  assign->expr->jdf_type    = key_from_type((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yysval.string));
+                  JDF_OBJECT_LINENO(assign) = JDF_OBJECT_LINENO((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.expr));
+                  ((*yyvalp).property) = assign;
+              }
+    break;
+
+  case 16: /* properties_list: property properties_list  */
+              {
+                 (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yysval.property)->next = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.property);
+                 ((*yyvalp).property)       = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yysval.property);
+              }
+    break;
+
+  case 17: /* properties_list: property  */
+              { ((*yyvalp).property) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.property); }
+    break;
+
+  case 18: /* body: BODY_START properties BODY_END  */
+             {
+                 jdf_body_t* body = new(jdf_body_t);
+                 body->properties = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yysval.property);
+                 /**
+                  * Go over the list of properties and tag them with the type of the BODY. This
+                  * allows us to protect the generated code to avoid compiler warnings.
+                  */
+                 jdf_expr_t* type_str = jdf_find_property( body->properties, "type", NULL );
+                 if( NULL != type_str ) {
+                     char* protected_by;
+                     asprintf(&protected_by, "PARSEC_HAVE_DEV_%s_SUPPORT", type_str->jdf_var);
+                     jdf_def_list_t* property = body->properties;
+                     while( NULL != property ) {
+                         assert(NULL == property->expr->protected_by);
+                         property->expr->protected_by = strdup(protected_by);
+                         property = property->next;
+                     }
+                     free(protected_by);
+                 }
+                 body->next = NULL;
+                 /* The body of the function is stored as a string in BODY_END */
+                 body->external_code = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.string);
+                 JDF_OBJECT_LINENO(body) = current_lineno;
+                 ((*yyvalp).body) = body;
+             }
+    break;
+
+  case 19: /* bodies: body  */
+             {
+                 ((*yyvalp).body) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.body);
+             }
+    break;
+
+  case 20: /* bodies: body bodies  */
+             {
+                 jdf_body_t* body = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yysval.body);
+                 body->next = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.body);
+                 ((*yyvalp).body) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yysval.body);
+             }
+    break;
+
+  case 21: /* function: VAR OPEN_PAR param_list CLOSE_PAR properties local_variables simulation_cost partitioning dataflow_list priority bodies  */
+                {
+                    int rc;
+                    jdf_function_entry_t *e = new(jdf_function_entry_t);
+                    e->fname             = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-10)].yystate.yysemantics.yysval.string);
+                    e->parameters        = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-8)].yystate.yysemantics.yysval.param_list);
+                    e->properties        = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-6)].yystate.yysemantics.yysval.property);
+                    e->locals            = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-5)].yystate.yysemantics.yysval.variable_list);
+                    e->simcost           = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-4)].yystate.yysemantics.yysval.expr);
+                    e->predicate         = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yysval.call);
+                    e->dataflow          = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yysval.dataflow);
+                    e->priority          = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yysval.expr);
+                    e->bodies            = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.body);
+
+                    jdf_link_params_and_locals(e);  /* link params and locals */
+                    jdf_assign_ldef_index(e);       /* find the datatype indexes */
+
+                    rc = jdf_flatten_function(e);
+                    if( rc < 0 )
+                        YYERROR;
+                    ((*yyvalp).function) = e;
+                    JDF_OBJECT_LINENO(((*yyvalp).function)) = JDF_OBJECT_LINENO((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-8)].yystate.yysemantics.yysval.param_list));
+                }
+    break;
+
+  case 22: /* param_list: VAR COMMA param_list  */
+                {
+                    jdf_param_list_t *l = new(jdf_param_list_t);
+                    l->next = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.param_list);
+                    l->name = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yysval.string);
+                    l->local = NULL;
+                    JDF_OBJECT_LINENO(l) = current_lineno;
+
+                    ((*yyvalp).param_list) = l;
+                }
+    break;
+
+  case 23: /* param_list: VAR  */
+                {
+                    jdf_param_list_t *l = new(jdf_param_list_t);
+                    l->next = NULL;
+                    l->name = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.string);
+                    l->local = NULL;
+                    JDF_OBJECT_LINENO(l) = current_lineno;
+
+                    ((*yyvalp).param_list) = l;
+                }
+    break;
+
+  case 24: /* local_variable: VAR ASSIGNMENT expr_range properties  */
+                {
+                    jdf_variable_list_t *l = new(jdf_variable_list_t);
+                    l->name               = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yysval.string);
+                    l->expr               = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yysval.expr);
+                    l->properties         = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.property);
+                    l->next               = NULL;
+                    l->param              = NULL;
+                    ((*yyvalp).variable_list) = l;
+                    JDF_OBJECT_LINENO(((*yyvalp).variable_list)) = JDF_OBJECT_LINENO((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yysval.expr));
+                }
+    break;
+
+  case 25: /* local_variables: local_variable local_variables  */
+                {
+                    (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yysval.variable_list)->next = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.variable_list);
+                    ((*yyvalp).variable_list) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yysval.variable_list);
+                }
+    break;
+
+  case 26: /* local_variables: local_variable  */
+                {
+                    ((*yyvalp).variable_list) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.variable_list);
+                }
+    break;
+
+  case 27: /* simulation_cost: SIMCOST expr_simple  */
+                {
+                    ((*yyvalp).expr) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.expr);
+                    ((*yyvalp).expr)->protected_by = strdup("PARSEC_SIM");
+                }
+    break;
+
+  case 28: /* simulation_cost: %empty  */
+                {   ((*yyvalp).expr) = NULL; }
+    break;
+
+  case 29: /* partitioning: COLON VAR OPEN_PAR expr_list CLOSE_PAR  */
+              {
+                  jdf_data_entry_t* data;
+                  jdf_call_t *c = new(jdf_call_t);
+                  int nbparams;
+
+                  c->var = NULL;
+                  c->func_or_mem = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yysval.string);
+                  data = jdf_find_or_create_data(&current_jdf, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yysval.string));
+                  c->parameters = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yysval.expr);
+                  JDF_COUNT_LIST_ENTRIES((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yysval.expr), jdf_expr_t, next, nbparams);
+                  if( data->nbparams != -1 ) {
+                      if( data->nbparams != nbparams ) {
+                          jdf_fatal(current_lineno, "Data %s used with %d parameters at line %d while used with %d parameters line %d\n",
+                                    (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yysval.string), nbparams, current_lineno, data->nbparams, JDF_OBJECT_LINENO(data));
+                          YYERROR;
+                      }
+                  } else {
+                      data->nbparams          = nbparams;
+                  }
+                  ((*yyvalp).call) = c;
+                  JDF_OBJECT_LINENO(((*yyvalp).call)) = JDF_OBJECT_LINENO((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yysval.expr));
+              }
+    break;
+
+  case 30: /* dataflow_list: dataflow dataflow_list  */
+                {
+                    (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yysval.dataflow)->next = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.dataflow);
+                    ((*yyvalp).dataflow) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yysval.dataflow);
+                }
+    break;
+
+  case 31: /* dataflow_list: %empty  */
+                {
+                    ((*yyvalp).dataflow) = NULL;
+                }
+    break;
+
+  case 32: /* optional_flow_flags: DEPENDENCY_TYPE  */
+                {
+                    ((*yyvalp).number) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.number);
+                }
+    break;
+
+  case 33: /* optional_flow_flags: %empty  */
+                { ((*yyvalp).number) = JDF_FLOW_TYPE_READ | JDF_FLOW_TYPE_WRITE; }
+    break;
+
+  case 34: /* dataflow: optional_flow_flags VAR dependencies  */
+                {
+                    for(jdf_global_entry_t* g = current_jdf.globals; g != NULL; g = g->next) {
+                        if( !strcmp(g->name, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yysval.string)) ) {
+                            jdf_fatal(current_lineno, "Flow %s cannot shadow global variable with the same name (defined line %d)\n",
+                                      (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yysval.string), JDF_OBJECT_LINENO(g));
+                            YYERROR;
+                        }
+                    }
+
+                    jdf_dataflow_t *flow  = new(jdf_dataflow_t);
+                    flow->flow_flags      = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yysval.number);
+                    flow->varname         = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yysval.string);
+                    flow->deps            = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.dep);
+
+                    ((*yyvalp).dataflow) = flow;
+                    if( NULL == (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.dep)) {
+                        JDF_OBJECT_LINENO(((*yyvalp).dataflow)) = current_lineno;
+                    } else {
+                        JDF_OBJECT_LINENO(((*yyvalp).dataflow)) = JDF_OBJECT_LINENO((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.dep));
+                    }
+                }
+    break;
+
+  case 35: /* $@1: %empty  */
+                          { named_expr_push_scope(); }
+    break;
+
+  case 36: /* named_expr: PROPERTIES_ON $@1 named_expr_list PROPERTIES_OFF  */
+               {
+                   ((*yyvalp).named_expr) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yysval.named_expr);
+               }
+    break;
+
+  case 37: /* named_expr: %empty  */
+               {
+                   ((*yyvalp).named_expr) = NULL;
+                   /* We still create a new scope for the (inexisting) named range
+                    * as the scope will be popped unconditionally */
+                   named_expr_push_scope();
+               }
+    break;
+
+  case 38: /* named_expr_list: VAR ASSIGNMENT expr_range  */
+               {
+                   ((*yyvalp).named_expr) = named_expr_push_in_scope((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yysval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.expr));
+               }
+    break;
+
+  case 39: /* named_expr_list: named_expr_list COMMA VAR ASSIGNMENT expr_range  */
+               {
+                   ((*yyvalp).named_expr) = named_expr_push_in_scope((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yysval.string), (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.expr));
+               }
+    break;
+
+  case 40: /* dependencies: dependency dependencies  */
+               {
+                   (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yysval.dep)->next = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.dep);
+                   ((*yyvalp).dep) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yysval.dep);
+               }
+    break;
+
+  case 41: /* dependencies: %empty  */
+               {
+                   ((*yyvalp).dep) = NULL;
+               }
+    break;
+
+  case 42: /* dependency: ARROW named_expr guarded_call properties  */
+              {
+                  jdf_dep_t *d = new(jdf_dep_t);
+                  jdf_expr_t *expr;
+                  jdf_expr_t *expr_remote;
+                  jdf_expr_t *expr_data;
+                  jdf_def_list_t* property = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.property);
+                  jdf_def_list_t* property_remote = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.property);
+                  jdf_def_list_t* property_data = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.property);
+
+                  d->local_defs = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yysval.named_expr);
+
+                  expr = jdf_find_property((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.property), "type", &property);
+                  expr_remote = jdf_find_property((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.property), "type_remote", &property_remote);
+                  expr_data = jdf_find_property((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.property), "type_data", &property_data);
+                  /* Warn when using type_remote & type_data on the same dep.
+                   * Here we should check if type|type_data on in/out desc.
+                   * And type|type_remote on task dependencies.
+                   */
+                  if((expr_remote != NULL) && (expr_data != NULL)){
+                      jdf_fatal(JDF_OBJECT_LINENO((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.property)),
+                          " the simultaneous usage of type_remote and type_data is not supported. \n");
+                      YYERROR;
+                  }
+
+                  /* If neither is defined, we define the old simple DEFAULT arena */
+                  if( NULL == expr ) {
+                      property = jdf_create_properties_list( "type", 0, "DEFAULT", NULL );
+                      expr = jdf_find_property( property, "type", &property );
+                      property->next = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.property);
+                  }
+                  if( NULL == expr_remote ) {
+                      property_remote = jdf_create_properties_list( "type_remote", 0, "DEFAULT", NULL );
+                      expr_remote = jdf_find_property( property_remote, "type_remote", &property_remote );
+                      property_remote->next = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.property);
+                  }
+                  if( NULL == expr_data ) {
+                      property_data = jdf_create_properties_list( "type_data", 0, "DEFAULT", NULL );
+                      expr_data = jdf_find_property( property_data, "type_data", &property_data );
+                      property_data->next = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.property);
+                  }
+
+                  /* Validate the datatype definition of WRITE only data */
+                  if( (JDF_GUARD_UNCONDITIONAL == (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yysval.guarded_call)->guard_type) &&
+                      (NULL == (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yysval.guarded_call)->guard) && (NULL == (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yysval.guarded_call)->callfalse) ) {
+                      if( 0 == strcmp(PARSEC_WRITE_MAGIC_NAME, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yysval.guarded_call)->calltrue->func_or_mem) ) {
+                          if((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yysval.dep_type) != JDF_DEP_FLOW_IN) {
+                              jdf_fatal(JDF_OBJECT_LINENO((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yysval.guarded_call)), PARSEC_ERR_NEW_AS_OUTPUT);
+                              YYERROR;
+                          }
+                      }
+                  }
+
+                  /* Validate the WRITE only data allocation, and the unused data */
+                  if( JDF_IS_CALL_WITH_NO_INPUT((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yysval.guarded_call)->calltrue) ) {
+                      if( 0 == strcmp(PARSEC_WRITE_MAGIC_NAME, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yysval.guarded_call)->calltrue->func_or_mem) ) {
+                          if((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yysval.dep_type) != JDF_DEP_FLOW_IN) {
+                              jdf_fatal(JDF_OBJECT_LINENO((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yysval.guarded_call)), PARSEC_ERR_NEW_AS_OUTPUT);
+                              YYERROR;
+                          }
+                      }
+                      else if( 0 == strcmp(PARSEC_NULL_MAGIC_NAME, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yysval.guarded_call)->calltrue->func_or_mem) ) {
+                          if((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yysval.dep_type) != JDF_DEP_FLOW_IN) {
+                              jdf_fatal(JDF_OBJECT_LINENO((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yysval.guarded_call)), PARSEC_ERR_NULL_AS_OUTPUT);
+                              YYERROR;
+                          }
+                      } else {
+                          jdf_fatal(JDF_OBJECT_LINENO((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yysval.guarded_call)),
+                                    "%s is not a supported keyword to describe a data (Only NEW and NULL are supported by themselves)\n",
+                                    (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yysval.guarded_call)->calltrue->func_or_mem );
+                          YYERROR;
+                      }
+                  }
+
+                  /* Validate the WRITE only data allocation, and the unused data */
+                  if( (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yysval.guarded_call)->callfalse && JDF_IS_CALL_WITH_NO_INPUT((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yysval.guarded_call)->callfalse) ) {
+                      if( 0 == strcmp(PARSEC_WRITE_MAGIC_NAME, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yysval.guarded_call)->callfalse->func_or_mem) ) {
+                          if((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yysval.dep_type) != JDF_DEP_FLOW_IN) {
+                              jdf_fatal(JDF_OBJECT_LINENO((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yysval.guarded_call)), PARSEC_ERR_NEW_AS_OUTPUT);
+                              YYERROR;
+                          }
+                      }
+                      else if( 0 == strcmp(PARSEC_NULL_MAGIC_NAME, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yysval.guarded_call)->callfalse->func_or_mem) ) {
+                          if((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yysval.dep_type) != JDF_DEP_FLOW_IN) {
+                              jdf_fatal(JDF_OBJECT_LINENO((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yysval.guarded_call)), PARSEC_ERR_NULL_AS_OUTPUT);
+                              YYERROR;
+                          }
+                      } else {
+                          jdf_fatal(JDF_OBJECT_LINENO((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yysval.guarded_call)),
+                                    "%s is not a supported keyword to describe a data (Only NEW and NULL are supported by themselves)\n",
+                                    (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yysval.guarded_call)->callfalse->func_or_mem );
+                          YYERROR;
+                      }
+                  }
+
+                  (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yysval.guarded_call)->properties   = property;
+                  d->dep_flags     = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yysval.dep_type);
+                  d->guard         = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yysval.guarded_call);
+                  d->datatype_local.type = expr;
+                  d->datatype_remote.type = expr_remote;
+                  d->datatype_data.type = expr_data;
+                  JDF_OBJECT_LINENO(&d->datatype_local) = current_lineno;
+                  JDF_OBJECT_LINENO(&d->datatype_remote) = current_lineno;
+                  JDF_OBJECT_LINENO(&d->datatype_data) = current_lineno;
+
+                  process_datatype(&d->datatype_local, d, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.property), property, "layout", "count", "displ");
+                  process_datatype(&d->datatype_remote, d, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.property), property_remote, "layout_remote", "count_remote", "displ_remote");
+                  process_datatype(&d->datatype_data, d, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.property), property_data, "layout_data", "count_data", "displ_data");
+
+                  JDF_OBJECT_LINENO(d) = JDF_OBJECT_LINENO((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yysval.guarded_call));
+                  assert( 0 != JDF_OBJECT_LINENO((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yysval.guarded_call)) );
+                  ((*yyvalp).dep) = d;
+
+                  named_expr_pop_scope();
+              }
+    break;
+
+  case 43: /* guarded_call: call  */
+              {
+                  jdf_guarded_call_t *g = new(jdf_guarded_call_t);
+                  g->guard_type = JDF_GUARD_UNCONDITIONAL;
+                  g->guard = NULL;
+                  g->calltrue = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.call);
+                  g->callfalse = NULL;
+                  ((*yyvalp).guarded_call) = g;
+                  assert( 0 != JDF_OBJECT_LINENO((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.call)) );
+                  JDF_OBJECT_LINENO(((*yyvalp).guarded_call)) = JDF_OBJECT_LINENO((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.call));
+              }
+    break;
+
+  case 44: /* guarded_call: expr_simple QUESTION_MARK call  */
+              {
+                  jdf_guarded_call_t *g = new(jdf_guarded_call_t);
+                  g->guard_type = JDF_GUARD_BINARY;
+                  g->guard = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yysval.expr);
+                  g->calltrue = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.call);
+                  g->callfalse = NULL;
+                  ((*yyvalp).guarded_call) = g;
+                  assert( 0 != JDF_OBJECT_LINENO((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yysval.expr)) );
+                  JDF_OBJECT_LINENO(((*yyvalp).guarded_call)) = JDF_OBJECT_LINENO((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yysval.expr));
+              }
+    break;
+
+  case 45: /* guarded_call: expr_simple QUESTION_MARK call COLON call  */
+              {
+                  jdf_guarded_call_t *g = new(jdf_guarded_call_t);
+                  g->guard_type = JDF_GUARD_TERNARY;
+                  g->guard = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-4)].yystate.yysemantics.yysval.expr);
+                  g->calltrue = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yysval.call);
+                  g->callfalse = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.call);
+                  ((*yyvalp).guarded_call) = g;
+                  assert( 0 != JDF_OBJECT_LINENO((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-4)].yystate.yysemantics.yysval.expr)) );
+                  JDF_OBJECT_LINENO(((*yyvalp).guarded_call)) = JDF_OBJECT_LINENO((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-4)].yystate.yysemantics.yysval.expr));
+              }
+    break;
+
+  case 46: /* call: named_expr VAR VAR OPEN_PAR expr_list_range CLOSE_PAR  */
+              {
+                  jdf_call_t *c = new(jdf_call_t);
+                  c->var = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-4)].yystate.yysemantics.yysval.string);
+                  c->local_defs = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-5)].yystate.yysemantics.yysval.named_expr);
+                  c->func_or_mem = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yysval.string);
+                  c->parameters = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yysval.expr);
+                  ((*yyvalp).call) = c;
+                  JDF_OBJECT_LINENO(((*yyvalp).call)) = JDF_OBJECT_LINENO((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yysval.expr));
+                  assert( 0 != JDF_OBJECT_LINENO(((*yyvalp).call)) );
+                  named_expr_pop_scope();
+              }
+    break;
+
+  case 47: /* call: VAR OPEN_PAR expr_list_range CLOSE_PAR  */
+              {
+                  jdf_data_entry_t* data;
+                  jdf_call_t *c = new(jdf_call_t);
+                  int nbparams;
+
+                  c->var = NULL;
+                  c->func_or_mem = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yysval.string);
+                  c->parameters = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yysval.expr);
+                  c->local_defs = NULL;
+                  JDF_OBJECT_LINENO(c) = JDF_OBJECT_LINENO((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yysval.expr));
+                  ((*yyvalp).call) = c;
+                  assert( 0 != JDF_OBJECT_LINENO(((*yyvalp).call)) );
+                  data = jdf_find_or_create_data(&current_jdf, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yysval.string));
+                  JDF_COUNT_LIST_ENTRIES((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yysval.expr), jdf_expr_t, next, nbparams);
+                  if( data->nbparams != -1 ) {
+                      if( data->nbparams != nbparams ) {
+                          jdf_fatal(current_lineno, "Data %s used with %d parameters at line %d while used with %d parameters line %d\n",
+                                    (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-3)].yystate.yysemantics.yysval.string), nbparams, current_lineno, data->nbparams, JDF_OBJECT_LINENO(data));
+                          YYERROR;
+                      }
+                  } else {
+                      data->nbparams          = nbparams;
+                  }
+                  JDF_OBJECT_LINENO(data) = JDF_OBJECT_LINENO((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yysval.expr));
+              }
+    break;
+
+  case 48: /* call: DATA_NEW  */
+              {
+                  jdf_call_t *c = new(jdf_call_t);
+                  c->var = NULL;
+                  c->local_defs = NULL;
+                  c->func_or_mem = strdup(PARSEC_WRITE_MAGIC_NAME);
+                  c->parameters = NULL;
+                  JDF_OBJECT_LINENO(c) = current_lineno;
+                  ((*yyvalp).call) = c;
+             }
+    break;
+
+  case 49: /* call: DATA_NULL  */
+             {
+                  jdf_call_t *c = new(jdf_call_t);
+                  c->var = NULL;
+                  c->local_defs = NULL;
+                  c->func_or_mem = strdup(PARSEC_NULL_MAGIC_NAME);
+                  c->parameters = NULL;
+                  JDF_OBJECT_LINENO(c) = current_lineno;
+                  ((*yyvalp).call) = c;
+             }
+    break;
+
+  case 50: /* priority: SEMICOLON expr_simple  */
+              {
+                    ((*yyvalp).expr) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.expr);
+              }
+    break;
+
+  case 51: /* priority: %empty  */
+              { ((*yyvalp).expr) = NULL; }
+    break;
+
+  case 52: /* expr_list_range: expr_range COMMA expr_list_range  */
+              {
+                  (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yysval.expr)->next = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.expr);
+                  ((*yyvalp).expr)=(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yysval.expr);
+                  assert( 0 != JDF_OBJECT_LINENO(((*yyvalp).expr)) );
+              }
+    break;
+
+  case 53: /* expr_list_range: expr_range  */
+              {
+                  (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.expr)->next = NULL;
+                  ((*yyvalp).expr)=(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.expr);
+                  assert( 0 != JDF_OBJECT_LINENO(((*yyvalp).expr)) );
+              }
+    break;
+
+  case 54: /* expr_list: expr_simple COMMA expr_list  */
+              {
+                  (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yysval.expr)->next = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.expr);
+                  ((*yyvalp).expr)=(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yysval.expr);
+              }
+    break;
+
+  case 55: /* expr_list: expr_simple  */
+              {
+                  (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.expr)->next = NULL;
+                  ((*yyvalp).expr)=(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.expr);
+              }
+    break;
+
+  case 56: /* expr_range: expr_simple RANGE expr_simple  */
+            {
+                  jdf_expr_t *e = new(jdf_expr_t);
+                  e->op = JDF_RANGE;
+                  e->jdf_ta1 = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yysval.expr);               /* from */
+                  e->jdf_ta2 = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.expr);               /* to */
+
+                  e->jdf_ta3 = new(jdf_expr_t);  /* step */
+                  e->jdf_ta3->op = JDF_CST;
+                  e->jdf_ta3->jdf_cst = 1;
+                  e->jdf_ta3->local_variables = current_locally_bound_variables;
+                  e->jdf_ta3->scope = -1;
+                  e->jdf_ta3->alias = NULL;
+
+                  e->local_variables = current_locally_bound_variables;
+                  e->scope = -1;
+                  e->alias = NULL;
+                  ((*yyvalp).expr) = e;
+                  JDF_OBJECT_LINENO(((*yyvalp).expr)) = JDF_OBJECT_LINENO((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yysval.expr));
+                  assert( 0 != JDF_OBJECT_LINENO(((*yyvalp).expr)) );
+            }
+    break;
+
+  case 57: /* expr_range: expr_simple RANGE expr_simple RANGE expr_simple  */
+            {
+                  jdf_expr_t *e = new(jdf_expr_t);
+                  e->op = JDF_RANGE;
+                  e->jdf_ta1 = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-4)].yystate.yysemantics.yysval.expr);  /* from */
+                  e->jdf_ta2 = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yysval.expr);  /* to */
+                  e->jdf_ta3 = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.expr);  /* step */
+                  e->local_variables = current_locally_bound_variables;
+                  e->scope = -1;
+                  e->alias = NULL;
+                  ((*yyvalp).expr) = e;
+                  JDF_OBJECT_LINENO(((*yyvalp).expr)) = JDF_OBJECT_LINENO((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-4)].yystate.yysemantics.yysval.expr));
+                  assert( 0 != JDF_OBJECT_LINENO(((*yyvalp).expr)) );
+            }
+    break;
+
+  case 58: /* expr_range: expr_simple  */
+            {
+                  ((*yyvalp).expr) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.expr);
+                  assert( 0 != JDF_OBJECT_LINENO(((*yyvalp).expr)) );
+            }
+    break;
+
+  case 59: /* $@2: %empty  */
+                          { named_expr_push_scope(); }
+    break;
+
+  case 60: /* expr_range: PROPERTIES_ON $@2 named_expr_list PROPERTIES_OFF expr_simple  */
+            {
+                   /* we cannot simply say it's 'named_expr expr_simple', or this creates a lot of
+                    * ambiguous shift-reduce conflicts because named_expr can be empty */
+                   ((*yyvalp).expr) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.expr);
+                   named_expr_pop_scope();
+            }
+    break;
+
+  case 61: /* variable: VAR  */
+            {
+                 jdf_expr_t *e = new(jdf_expr_t);
+                 e->op = JDF_VAR;
+                 e->local_variables = current_locally_bound_variables;
+                 e->scope = -1;
+                 e->alias = NULL;
+                 e->jdf_var = strdup((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.string));
+                 ((*yyvalp).expr) = e;
+                 JDF_OBJECT_LINENO(((*yyvalp).expr)) = current_lineno;
+            }
+    break;
+
+  case 62: /* variable: variable ARROW VAR  */
+            {
+                 char* tmp = NULL;
+                 if( asprintf(&tmp, "%s->%s", (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yysval.expr)->jdf_var, (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.string)) <= 0 )
+                     tmp = NULL;
+                 free((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yysval.expr)->jdf_var);
+                 (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yysval.expr)->jdf_var = tmp;
+                 ((*yyvalp).expr) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yysval.expr);
+            }
+    break;
+
+  case 63: /* expr_simple: expr_simple EQUAL expr_simple  */
+              {
+                  jdf_expr_t *e = new(jdf_expr_t);
+                  e->op = JDF_EQUAL;
+                  e->local_variables = current_locally_bound_variables;
+                  e->scope = -1;
+                  e->alias = NULL;
+                  e->jdf_ba1 = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yysval.expr);
+                  e->jdf_ba2 = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.expr);
+                  ((*yyvalp).expr) = e;
+                  JDF_OBJECT_LINENO(((*yyvalp).expr)) = current_lineno;
+              }
+    break;
+
+  case 64: /* expr_simple: expr_simple NOTEQUAL expr_simple  */
+              {
+                  jdf_expr_t *e = new(jdf_expr_t);
+                  e->op = JDF_NOTEQUAL;
+                  e->local_variables = current_locally_bound_variables;
+                  e->scope = -1;
+                  e->alias = NULL;
+                  e->jdf_ba1 = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yysval.expr);
+                  e->jdf_ba2 = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.expr);
+                  ((*yyvalp).expr) = e;
+                  JDF_OBJECT_LINENO(((*yyvalp).expr)) = current_lineno;
+              }
+    break;
+
+  case 65: /* expr_simple: expr_simple LESS expr_simple  */
+              {
+                  jdf_expr_t *e = new(jdf_expr_t);
+                  e->op = JDF_LESS;
+                  e->local_variables = current_locally_bound_variables;
+                  e->scope = -1;
+                  e->alias = NULL;
+                  e->jdf_ba1 = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yysval.expr);
+                  e->jdf_ba2 = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.expr);
+                  ((*yyvalp).expr) = e;
+                  JDF_OBJECT_LINENO(((*yyvalp).expr)) = current_lineno;
+              }
+    break;
+
+  case 66: /* expr_simple: expr_simple LEQ expr_simple  */
+              {
+                  jdf_expr_t *e = new(jdf_expr_t);
+                  e->op = JDF_LEQ;
+                  e->local_variables = current_locally_bound_variables;
+                  e->scope = -1;
+                  e->alias = NULL;
+                  e->jdf_ba1 = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yysval.expr);
+                  e->jdf_ba2 = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.expr);
+                  ((*yyvalp).expr) = e;
+                  JDF_OBJECT_LINENO(((*yyvalp).expr)) = current_lineno;
+              }
+    break;
+
+  case 67: /* expr_simple: expr_simple MORE expr_simple  */
+              {
+                  jdf_expr_t *e = new(jdf_expr_t);
+                  e->op = JDF_MORE;
+                  e->local_variables = current_locally_bound_variables;
+                  e->scope = -1;
+                  e->alias = NULL;
+                  e->jdf_ba1 = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yysval.expr);
+                  e->jdf_ba2 = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.expr);
+                  ((*yyvalp).expr) = e;
+                  JDF_OBJECT_LINENO(((*yyvalp).expr)) = current_lineno;
+              }
+    break;
+
+  case 68: /* expr_simple: expr_simple MEQ expr_simple  */
+              {
+                  jdf_expr_t *e = new(jdf_expr_t);
+                  e->op = JDF_MEQ;
+                  e->local_variables = current_locally_bound_variables;
+                  e->scope = -1;
+                  e->alias = NULL;
+                  e->jdf_ba1 = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yysval.expr);
+                  e->jdf_ba2 = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.expr);
+                  ((*yyvalp).expr) = e;
+                  JDF_OBJECT_LINENO(((*yyvalp).expr)) = current_lineno;
+              }
+    break;
+
+  case 69: /* expr_simple: expr_simple AND expr_simple  */
+              {
+                  jdf_expr_t *e = new(jdf_expr_t);
+                  e->op = JDF_AND;
+                  e->local_variables = current_locally_bound_variables;
+                  e->scope = -1;
+                  e->alias = NULL;
+                  e->jdf_ba1 = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yysval.expr);
+                  e->jdf_ba2 = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.expr);
+                  ((*yyvalp).expr) = e;
+                  JDF_OBJECT_LINENO(((*yyvalp).expr)) = current_lineno;
+              }
+    break;
+
+  case 70: /* expr_simple: expr_simple OR expr_simple  */
+              {
+                  jdf_expr_t *e = new(jdf_expr_t);
+                  e->op = JDF_OR;
+                  e->local_variables = current_locally_bound_variables;
+                  e->scope = -1;
+                  e->alias = NULL;
+                  e->jdf_ba1 = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yysval.expr);
+                  e->jdf_ba2 = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.expr);
+                  ((*yyvalp).expr) = e;
+                  JDF_OBJECT_LINENO(((*yyvalp).expr)) = current_lineno;
+              }
+    break;
+
+  case 71: /* expr_simple: expr_simple XOR expr_simple  */
+              {
+                  jdf_expr_t *e = new(jdf_expr_t);
+                  e->op = JDF_XOR;
+                  e->local_variables = current_locally_bound_variables;
+                  e->scope = -1;
+                  e->alias = NULL;
+                  e->jdf_ba1 = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yysval.expr);
+                  e->jdf_ba2 = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.expr);
+                  ((*yyvalp).expr) = e;
+                  JDF_OBJECT_LINENO(((*yyvalp).expr)) = current_lineno;
+              }
+    break;
+
+  case 72: /* expr_simple: NOT expr_simple  */
+              {
+                  jdf_expr_t *e = new(jdf_expr_t);
+                  e->op = JDF_NOT;
+                  e->local_variables = current_locally_bound_variables;
+                  e->scope = -1;
+                  e->alias = NULL;
+                  e->jdf_ua = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.expr);
+                  ((*yyvalp).expr) = e;
+                  JDF_OBJECT_LINENO(((*yyvalp).expr)) = current_lineno;
+              }
+    break;
+
+  case 73: /* expr_simple: OPEN_PAR expr_simple CLOSE_PAR  */
+              {
+                  ((*yyvalp).expr) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-1)].yystate.yysemantics.yysval.expr);
+                  JDF_OBJECT_LINENO(((*yyvalp).expr)) = current_lineno;
+              }
+    break;
+
+  case 74: /* expr_simple: expr_simple PLUS expr_simple  */
+              {
+                  jdf_expr_t *e = new(jdf_expr_t);
+                  e->op = JDF_PLUS;
+                  e->local_variables = current_locally_bound_variables;
+                  e->scope = -1;
+                  e->alias = NULL;
+                  e->jdf_ba1 = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yysval.expr);
+                  e->jdf_ba2 = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.expr);
+                  ((*yyvalp).expr) = e;
+                  JDF_OBJECT_LINENO(((*yyvalp).expr)) = current_lineno;
+              }
+    break;
+
+  case 75: /* expr_simple: expr_simple MINUS expr_simple  */
+              {
+                  jdf_expr_t *e = new(jdf_expr_t);
+                  e->op = JDF_MINUS;
+                  e->local_variables = current_locally_bound_variables;
+                  e->scope = -1;
+                  e->alias = NULL;
+                  e->jdf_ba1 = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yysval.expr);
+                  e->jdf_ba2 = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.expr);
+                  ((*yyvalp).expr) = e;
+                  JDF_OBJECT_LINENO(((*yyvalp).expr)) = current_lineno;
+              }
+    break;
+
+  case 76: /* expr_simple: expr_simple TIMES expr_simple  */
+              {
+                  jdf_expr_t *e = new(jdf_expr_t);
+                  e->op = JDF_TIMES;
+                  e->local_variables = current_locally_bound_variables;
+                  e->scope = -1;
+                  e->alias = NULL;
+                  e->jdf_ba1 = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yysval.expr);
+                  e->jdf_ba2 = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.expr);
+                  ((*yyvalp).expr) = e;
+                  JDF_OBJECT_LINENO(((*yyvalp).expr)) = current_lineno;
+              }
+    break;
+
+  case 77: /* expr_simple: expr_simple DIV expr_simple  */
+              {
+                  jdf_expr_t *e = new(jdf_expr_t);
+                  e->op = JDF_DIV;
+                  e->local_variables = current_locally_bound_variables;
+                  e->scope = -1;
+                  e->alias = NULL;
+                  e->jdf_ba1 = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yysval.expr);
+                  e->jdf_ba2 = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.expr);
+                  ((*yyvalp).expr) = e;
+                  JDF_OBJECT_LINENO(((*yyvalp).expr)) = current_lineno;
+              }
+    break;
+
+  case 78: /* expr_simple: expr_simple MODULO expr_simple  */
+              {
+                  jdf_expr_t *e = new(jdf_expr_t);
+                  e->op = JDF_MODULO;
+                  e->local_variables = current_locally_bound_variables;
+                  e->scope = -1;
+                  e->alias = NULL;
+                  e->jdf_ba1 = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yysval.expr);
+                  e->jdf_ba2 = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.expr);
+                  ((*yyvalp).expr) = e;
+                  JDF_OBJECT_LINENO(((*yyvalp).expr)) = current_lineno;
+              }
+    break;
+
+  case 79: /* expr_simple: expr_simple SHL expr_simple  */
+              {
+                  jdf_expr_t *e = new(jdf_expr_t);
+                  e->op = JDF_SHL;
+                  e->local_variables = current_locally_bound_variables;
+                  e->scope = -1;
+                  e->alias = NULL;
+                  e->jdf_ba1 = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yysval.expr);
+                  e->jdf_ba2 = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.expr);
+                  ((*yyvalp).expr) = e;
+                  JDF_OBJECT_LINENO(((*yyvalp).expr)) = current_lineno;
+              }
+    break;
+
+  case 80: /* expr_simple: expr_simple SHR expr_simple  */
+              {
+                  jdf_expr_t *e = new(jdf_expr_t);
+                  e->op = JDF_SHR;
+                  e->local_variables = current_locally_bound_variables;
+                  e->scope = -1;
+                  e->alias = NULL;
+                  e->jdf_ba1 = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yysval.expr);
+                  e->jdf_ba2 = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.expr);
+                  ((*yyvalp).expr) = e;
+                  JDF_OBJECT_LINENO(((*yyvalp).expr)) = current_lineno;
+              }
+    break;
+
+  case 81: /* expr_simple: expr_simple QUESTION_MARK expr_simple COLON expr_simple  */
+              {
+                  jdf_expr_t *e = new(jdf_expr_t);
+                  e->op = JDF_TERNARY;
+                  e->local_variables = current_locally_bound_variables;
+                  e->scope = -1;
+                  e->alias = NULL;
+                  e->jdf_tat = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-4)].yystate.yysemantics.yysval.expr);
+                  e->jdf_ta1 = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (-2)].yystate.yysemantics.yysval.expr);
+                  e->jdf_ta2 = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.expr);
+                  ((*yyvalp).expr) = e;
+                  JDF_OBJECT_LINENO(((*yyvalp).expr)) = current_lineno;
+              }
+    break;
+
+  case 82: /* expr_simple: variable  */
+              {
+                  ((*yyvalp).expr) = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.expr);
+              }
+    break;
+
+  case 83: /* expr_simple: JDF_INT  */
+              {
+                  jdf_expr_t *e = new(jdf_expr_t);
+                  e->op = JDF_CST;
+                  e->local_variables = NULL;
+                  e->scope = -1;
+                  e->alias = NULL;
+                  e->jdf_cst = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.number);
+                  e->jdf_type = 0;
+                  ((*yyvalp).expr) = e;
+                  JDF_OBJECT_LINENO(((*yyvalp).expr)) = current_lineno;
+              }
+    break;
+
+  case 84: /* expr_simple: MINUS JDF_INT  */
+              {
+                  jdf_expr_t *e = new(jdf_expr_t);
+                  e->op = JDF_CST;
+                  e->local_variables = NULL;
+                  e->scope = -1;
+                  e->alias = NULL;
+                  e->jdf_cst = -(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.number);
+                  e->jdf_type = 0;
+                  ((*yyvalp).expr) = e;
+                  JDF_OBJECT_LINENO(((*yyvalp).expr)) = current_lineno;
+              }
+    break;
+
+  case 85: /* expr_simple: STRING  */
+              {
+                  jdf_expr_t *e = new(jdf_expr_t);
+                  e->local_variables = NULL;
+                  e->scope = -1;
+                  e->alias = NULL;
+                  e->op = JDF_STRING;
+                  e->jdf_var = strdup((YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.string));
+                  ((*yyvalp).expr) = e;
+                  JDF_OBJECT_LINENO(((*yyvalp).expr)) = current_lineno;
+              }
+    break;
+
+  case 86: /* expr_simple: EXTERN_DECL  */
+              {
+                  ((*yyvalp).expr) = new(jdf_expr_t);
+                  ((*yyvalp).expr)->op = JDF_C_CODE;
+                  ((*yyvalp).expr)->jdf_c_code.code = (YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL (0)].yystate.yysemantics.yysval.string);
+                  ((*yyvalp).expr)->jdf_type = PARSEC_RETURN_TYPE_INT32;
+                  ((*yyvalp).expr)->local_variables = current_locally_bound_variables;
+                  ((*yyvalp).expr)->scope = -1;
+                  ((*yyvalp).expr)->alias = NULL;
+                  ((*yyvalp).expr)->jdf_c_code.lineno = current_lineno;
+                  /* This will be set by the upper level parsing if necessary */
+                  ((*yyvalp).expr)->jdf_c_code.function_context = NULL;
+                  ((*yyvalp).expr)->jdf_c_code.fname = NULL;
+
+                  ((*yyvalp).expr)->next_inline = inline_c_functions;
+                  inline_c_functions = ((*yyvalp).expr);
+                  JDF_OBJECT_LINENO(((*yyvalp).expr)) = current_lineno;
+              }
+    break;
+
+
+
+      default: break;
+    }
+
+  return yyok;
+# undef yyerrok
+# undef YYABORT
+# undef YYACCEPT
+# undef YYERROR
+# undef YYBACKUP
+# undef yyclearin
+# undef YYRECOVERING
+}
+
+
+static void
+yyuserMerge (int yyn, YYSTYPE* yy0, YYSTYPE* yy1)
+{
+  YYUSE (yy0);
+  YYUSE (yy1);
+
+  switch (yyn)
+    {
+
+      default: break;
+    }
+}
+
+                              /* Bison grammar-table manipulation.  */
+
+/*-----------------------------------------------.
+| Release the memory associated to this symbol.  |
+`-----------------------------------------------*/
+
+static void
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep, YYLTYPE *yylocationp)
+{
+  YYUSE (yyvaluep);
+  YYUSE (yylocationp);
+  if (!yymsg)
+    yymsg = "Deleting";
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YYUSE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+/** Number of symbols composing the right hand side of rule #RULE.  */
+static inline int
+yyrhsLength (yyRuleNum yyrule)
+{
+  return yyr2[yyrule];
+}
+
+static void
+yydestroyGLRState (char const *yymsg, yyGLRState *yys)
+{
+  if (yys->yyresolved)
+    yydestruct (yymsg, yy_accessing_symbol (yys->yylrState),
+                &yys->yysemantics.yysval, &yys->yyloc);
+  else
+    {
+#if YYDEBUG
+      if (yydebug)
+        {
+          if (yys->yysemantics.yyfirstVal)
+            YY_FPRINTF ((stderr, "%s unresolved", yymsg));
+          else
+            YY_FPRINTF ((stderr, "%s incomplete", yymsg));
+          YY_SYMBOL_PRINT ("", yy_accessing_symbol (yys->yylrState), YY_NULLPTR, &yys->yyloc);
+        }
+#endif
+
+      if (yys->yysemantics.yyfirstVal)
+        {
+          yySemanticOption *yyoption = yys->yysemantics.yyfirstVal;
+          yyGLRState *yyrh;
+          int yyn;
+          for (yyrh = yyoption->yystate, yyn = yyrhsLength (yyoption->yyrule);
+               yyn > 0;
+               yyrh = yyrh->yypred, yyn -= 1)
+            yydestroyGLRState (yymsg, yyrh);
+        }
+    }
+}
+
+/** Left-hand-side symbol for rule #YYRULE.  */
+static inline yysymbol_kind_t
+yylhsNonterm (yyRuleNum yyrule)
+{
+  return YY_CAST (yysymbol_kind_t, yyr1[yyrule]);
+}
+
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
+
+/** True iff LR state YYSTATE has only a default reduction (regardless
+ *  of token).  */
+static inline yybool
+yyisDefaultedState (yy_state_t yystate)
+{
+  return yypact_value_is_default (yypact[yystate]);
+}
+
+/** The default reduction for YYSTATE, assuming it has one.  */
+static inline yyRuleNum
+yydefaultAction (yy_state_t yystate)
+{
+  return yydefact[yystate];
+}
+
+#define yytable_value_is_error(Yyn) \
+  0
+
+/** The action to take in YYSTATE on seeing YYTOKEN.
+ *  Result R means
+ *    R < 0:  Reduce on rule -R.
+ *    R = 0:  Error.
+ *    R > 0:  Shift to state R.
+ *  Set *YYCONFLICTS to a pointer into yyconfl to a 0-terminated list
+ *  of conflicting reductions.
+ */
+static inline int
+yygetLRActions (yy_state_t yystate, yysymbol_kind_t yytoken, const short** yyconflicts)
+{
+  int yyindex = yypact[yystate] + yytoken;
+  if (yytoken == YYSYMBOL_YYerror)
+    {
+      // This is the error token.
+      *yyconflicts = yyconfl;
+      return 0;
+    }
+  else if (yyisDefaultedState (yystate)
+           || yyindex < 0 || YYLAST < yyindex || yycheck[yyindex] != yytoken)
+    {
+      *yyconflicts = yyconfl;
+      return -yydefact[yystate];
+    }
+  else if (! yytable_value_is_error (yytable[yyindex]))
+    {
+      *yyconflicts = yyconfl + yyconflp[yyindex];
+      return yytable[yyindex];
+    }
+  else
+    {
+      *yyconflicts = yyconfl + yyconflp[yyindex];
+      return 0;
+    }
+}
+
+/** Compute post-reduction state.
+ * \param yystate   the current state
+ * \param yysym     the nonterminal to push on the stack
+ */
+static inline yy_state_t
+yyLRgotoState (yy_state_t yystate, yysymbol_kind_t yysym)
+{
+  int yyr = yypgoto[yysym - YYNTOKENS] + yystate;
+  if (0 <= yyr && yyr <= YYLAST && yycheck[yyr] == yystate)
+    return yytable[yyr];
+  else
+    return yydefgoto[yysym - YYNTOKENS];
+}
+
+static inline yybool
+yyisShiftAction (int yyaction)
+{
+  return 0 < yyaction;
+}
+
+static inline yybool
+yyisErrorAction (int yyaction)
+{
+  return yyaction == 0;
+}
+
+                                /* GLRStates */
+
+/** Return a fresh GLRStackItem in YYSTACKP.  The item is an LR state
+ *  if YYISSTATE, and otherwise a semantic option.  Callers should call
+ *  YY_RESERVE_GLRSTACK afterwards to make sure there is sufficient
+ *  headroom.  */
+
+static inline yyGLRStackItem*
+yynewGLRStackItem (yyGLRStack* yystackp, yybool yyisState)
+{
+  yyGLRStackItem* yynewItem = yystackp->yynextFree;
+  yystackp->yyspaceLeft -= 1;
+  yystackp->yynextFree += 1;
+  yynewItem->yystate.yyisState = yyisState;
+  return yynewItem;
+}
+
+/** Add a new semantic action that will execute the action for rule
+ *  YYRULE on the semantic values in YYRHS to the list of
+ *  alternative actions for YYSTATE.  Assumes that YYRHS comes from
+ *  stack #YYK of *YYSTACKP. */
+static void
+yyaddDeferredAction (yyGLRStack* yystackp, YYPTRDIFF_T yyk, yyGLRState* yystate,
+                     yyGLRState* yyrhs, yyRuleNum yyrule)
+{
+  yySemanticOption* yynewOption =
+    &yynewGLRStackItem (yystackp, yyfalse)->yyoption;
+  YY_ASSERT (!yynewOption->yyisState);
+  yynewOption->yystate = yyrhs;
+  yynewOption->yyrule = yyrule;
+  if (yystackp->yytops.yylookaheadNeeds[yyk])
+    {
+      yynewOption->yyrawchar = yychar;
+      yynewOption->yyval = yylval;
+      yynewOption->yyloc = yylloc;
+    }
+  else
+    yynewOption->yyrawchar = YYEMPTY;
+  yynewOption->yynext = yystate->yysemantics.yyfirstVal;
+  yystate->yysemantics.yyfirstVal = yynewOption;
+
+  YY_RESERVE_GLRSTACK (yystackp);
+}
+
+                                /* GLRStacks */
+
+/** Initialize YYSET to a singleton set containing an empty stack.  */
+static yybool
+yyinitStateSet (yyGLRStateSet* yyset)
+{
+  yyset->yysize = 1;
+  yyset->yycapacity = 16;
+  yyset->yystates
+    = YY_CAST (yyGLRState**,
+               YYMALLOC (YY_CAST (YYSIZE_T, yyset->yycapacity)
+                         * sizeof yyset->yystates[0]));
+  if (! yyset->yystates)
+    return yyfalse;
+  yyset->yystates[0] = YY_NULLPTR;
+  yyset->yylookaheadNeeds
+    = YY_CAST (yybool*,
+               YYMALLOC (YY_CAST (YYSIZE_T, yyset->yycapacity)
+                         * sizeof yyset->yylookaheadNeeds[0]));
+  if (! yyset->yylookaheadNeeds)
+    {
+      YYFREE (yyset->yystates);
+      return yyfalse;
+    }
+  memset (yyset->yylookaheadNeeds,
+          0,
+          YY_CAST (YYSIZE_T, yyset->yycapacity) * sizeof yyset->yylookaheadNeeds[0]);
+  return yytrue;
+}
+
+static void yyfreeStateSet (yyGLRStateSet* yyset)
+{
+  YYFREE (yyset->yystates);
+  YYFREE (yyset->yylookaheadNeeds);
+}
+
+/** Initialize *YYSTACKP to a single empty stack, with total maximum
+ *  capacity for all stacks of YYSIZE.  */
+static yybool
+yyinitGLRStack (yyGLRStack* yystackp, YYPTRDIFF_T yysize)
+{
+  yystackp->yyerrState = 0;
+  yynerrs = 0;
+  yystackp->yyspaceLeft = yysize;
+  yystackp->yyitems
+    = YY_CAST (yyGLRStackItem*,
+               YYMALLOC (YY_CAST (YYSIZE_T, yysize)
+                         * sizeof yystackp->yynextFree[0]));
+  if (!yystackp->yyitems)
+    return yyfalse;
+  yystackp->yynextFree = yystackp->yyitems;
+  yystackp->yysplitPoint = YY_NULLPTR;
+  yystackp->yylastDeleted = YY_NULLPTR;
+  return yyinitStateSet (&yystackp->yytops);
+}
+
+
+#if YYSTACKEXPANDABLE
+# define YYRELOC(YYFROMITEMS, YYTOITEMS, YYX, YYTYPE)                   \
+  &((YYTOITEMS)                                                         \
+    - ((YYFROMITEMS) - YY_REINTERPRET_CAST (yyGLRStackItem*, (YYX))))->YYTYPE
+
+/** If *YYSTACKP is expandable, extend it.  WARNING: Pointers into the
+    stack from outside should be considered invalid after this call.
+    We always expand when there are 1 or fewer items left AFTER an
+    allocation, so that we can avoid having external pointers exist
+    across an allocation.  */
+static void
+yyexpandGLRStack (yyGLRStack* yystackp)
+{
+  yyGLRStackItem* yynewItems;
+  yyGLRStackItem* yyp0, *yyp1;
+  YYPTRDIFF_T yynewSize;
+  YYPTRDIFF_T yyn;
+  YYPTRDIFF_T yysize = yystackp->yynextFree - yystackp->yyitems;
+  if (YYMAXDEPTH - YYHEADROOM < yysize)
+    yyMemoryExhausted (yystackp);
+  yynewSize = 2*yysize;
+  if (YYMAXDEPTH < yynewSize)
+    yynewSize = YYMAXDEPTH;
+  yynewItems
+    = YY_CAST (yyGLRStackItem*,
+               YYMALLOC (YY_CAST (YYSIZE_T, yynewSize)
+                         * sizeof yynewItems[0]));
+  if (! yynewItems)
+    yyMemoryExhausted (yystackp);
+  for (yyp0 = yystackp->yyitems, yyp1 = yynewItems, yyn = yysize;
+       0 < yyn;
+       yyn -= 1, yyp0 += 1, yyp1 += 1)
+    {
+      *yyp1 = *yyp0;
+      if (*YY_REINTERPRET_CAST (yybool *, yyp0))
+        {
+          yyGLRState* yys0 = &yyp0->yystate;
+          yyGLRState* yys1 = &yyp1->yystate;
+          if (yys0->yypred != YY_NULLPTR)
+            yys1->yypred =
+              YYRELOC (yyp0, yyp1, yys0->yypred, yystate);
+          if (! yys0->yyresolved && yys0->yysemantics.yyfirstVal != YY_NULLPTR)
+            yys1->yysemantics.yyfirstVal =
+              YYRELOC (yyp0, yyp1, yys0->yysemantics.yyfirstVal, yyoption);
+        }
+      else
+        {
+          yySemanticOption* yyv0 = &yyp0->yyoption;
+          yySemanticOption* yyv1 = &yyp1->yyoption;
+          if (yyv0->yystate != YY_NULLPTR)
+            yyv1->yystate = YYRELOC (yyp0, yyp1, yyv0->yystate, yystate);
+          if (yyv0->yynext != YY_NULLPTR)
+            yyv1->yynext = YYRELOC (yyp0, yyp1, yyv0->yynext, yyoption);
+        }
+    }
+  if (yystackp->yysplitPoint != YY_NULLPTR)
+    yystackp->yysplitPoint = YYRELOC (yystackp->yyitems, yynewItems,
+                                      yystackp->yysplitPoint, yystate);
+
+  for (yyn = 0; yyn < yystackp->yytops.yysize; yyn += 1)
+    if (yystackp->yytops.yystates[yyn] != YY_NULLPTR)
+      yystackp->yytops.yystates[yyn] =
+        YYRELOC (yystackp->yyitems, yynewItems,
+                 yystackp->yytops.yystates[yyn], yystate);
+  YYFREE (yystackp->yyitems);
+  yystackp->yyitems = yynewItems;
+  yystackp->yynextFree = yynewItems + yysize;
+  yystackp->yyspaceLeft = yynewSize - yysize;
+}
+#endif
+
+static void
+yyfreeGLRStack (yyGLRStack* yystackp)
+{
+  YYFREE (yystackp->yyitems);
+  yyfreeStateSet (&yystackp->yytops);
+}
+
+/** Assuming that YYS is a GLRState somewhere on *YYSTACKP, update the
+ *  splitpoint of *YYSTACKP, if needed, so that it is at least as deep as
+ *  YYS.  */
+static inline void
+yyupdateSplit (yyGLRStack* yystackp, yyGLRState* yys)
+{
+  if (yystackp->yysplitPoint != YY_NULLPTR && yystackp->yysplitPoint > yys)
+    yystackp->yysplitPoint = yys;
+}
+
+/** Invalidate stack #YYK in *YYSTACKP.  */
+static inline void
+yymarkStackDeleted (yyGLRStack* yystackp, YYPTRDIFF_T yyk)
+{
+  if (yystackp->yytops.yystates[yyk] != YY_NULLPTR)
+    yystackp->yylastDeleted = yystackp->yytops.yystates[yyk];
+  yystackp->yytops.yystates[yyk] = YY_NULLPTR;
+}
+
+/** Undelete the last stack in *YYSTACKP that was marked as deleted.  Can
+    only be done once after a deletion, and only when all other stacks have
+    been deleted.  */
+static void
+yyundeleteLastStack (yyGLRStack* yystackp)
+{
+  if (yystackp->yylastDeleted == YY_NULLPTR || yystackp->yytops.yysize != 0)
+    return;
+  yystackp->yytops.yystates[0] = yystackp->yylastDeleted;
+  yystackp->yytops.yysize = 1;
+  YY_DPRINTF ((stderr, "Restoring last deleted stack as stack #0.\n"));
+  yystackp->yylastDeleted = YY_NULLPTR;
+}
+
+static inline void
+yyremoveDeletes (yyGLRStack* yystackp)
+{
+  YYPTRDIFF_T yyi, yyj;
+  yyi = yyj = 0;
+  while (yyj < yystackp->yytops.yysize)
+    {
+      if (yystackp->yytops.yystates[yyi] == YY_NULLPTR)
+        {
+          if (yyi == yyj)
+            YY_DPRINTF ((stderr, "Removing dead stacks.\n"));
+          yystackp->yytops.yysize -= 1;
+        }
+      else
+        {
+          yystackp->yytops.yystates[yyj] = yystackp->yytops.yystates[yyi];
+          /* In the current implementation, it's unnecessary to copy
+             yystackp->yytops.yylookaheadNeeds[yyi] since, after
+             yyremoveDeletes returns, the parser immediately either enters
+             deterministic operation or shifts a token.  However, it doesn't
+             hurt, and the code might evolve to need it.  */
+          yystackp->yytops.yylookaheadNeeds[yyj] =
+            yystackp->yytops.yylookaheadNeeds[yyi];
+          if (yyj != yyi)
+            YY_DPRINTF ((stderr, "Rename stack %ld -> %ld.\n",
+                        YY_CAST (long, yyi), YY_CAST (long, yyj)));
+          yyj += 1;
+        }
+      yyi += 1;
+    }
+}
+
+/** Shift to a new state on stack #YYK of *YYSTACKP, corresponding to LR
+ * state YYLRSTATE, at input position YYPOSN, with (resolved) semantic
+ * value *YYVALP and source location *YYLOCP.  */
+static inline void
+yyglrShift (yyGLRStack* yystackp, YYPTRDIFF_T yyk, yy_state_t yylrState,
+            YYPTRDIFF_T yyposn,
+            YYSTYPE* yyvalp, YYLTYPE* yylocp)
+{
+  yyGLRState* yynewState = &yynewGLRStackItem (yystackp, yytrue)->yystate;
+
+  yynewState->yylrState = yylrState;
+  yynewState->yyposn = yyposn;
+  yynewState->yyresolved = yytrue;
+  yynewState->yypred = yystackp->yytops.yystates[yyk];
+  yynewState->yysemantics.yysval = *yyvalp;
+  yynewState->yyloc = *yylocp;
+  yystackp->yytops.yystates[yyk] = yynewState;
+
+  YY_RESERVE_GLRSTACK (yystackp);
+}
+
+/** Shift stack #YYK of *YYSTACKP, to a new state corresponding to LR
+ *  state YYLRSTATE, at input position YYPOSN, with the (unresolved)
+ *  semantic value of YYRHS under the action for YYRULE.  */
+static inline void
+yyglrShiftDefer (yyGLRStack* yystackp, YYPTRDIFF_T yyk, yy_state_t yylrState,
+                 YYPTRDIFF_T yyposn, yyGLRState* yyrhs, yyRuleNum yyrule)
+{
+  yyGLRState* yynewState = &yynewGLRStackItem (yystackp, yytrue)->yystate;
+  YY_ASSERT (yynewState->yyisState);
+
+  yynewState->yylrState = yylrState;
+  yynewState->yyposn = yyposn;
+  yynewState->yyresolved = yyfalse;
+  yynewState->yypred = yystackp->yytops.yystates[yyk];
+  yynewState->yysemantics.yyfirstVal = YY_NULLPTR;
+  yystackp->yytops.yystates[yyk] = yynewState;
+
+  /* Invokes YY_RESERVE_GLRSTACK.  */
+  yyaddDeferredAction (yystackp, yyk, yynewState, yyrhs, yyrule);
+}
+
+#if !YYDEBUG
+# define YY_REDUCE_PRINT(Args)
+#else
+# define YY_REDUCE_PRINT(Args)          \
+  do {                                  \
+    if (yydebug)                        \
+      yy_reduce_print Args;             \
+  } while (0)
+
+/*----------------------------------------------------------------------.
+| Report that stack #YYK of *YYSTACKP is going to be reduced by YYRULE. |
+`----------------------------------------------------------------------*/
+
+static inline void
+yy_reduce_print (yybool yynormal, yyGLRStackItem* yyvsp, YYPTRDIFF_T yyk,
+                 yyRuleNum yyrule)
+{
+  int yynrhs = yyrhsLength (yyrule);
+  int yylow = 1;
+  int yyi;
+  YY_FPRINTF ((stderr, "Reducing stack %ld by rule %d (line %d):\n",
+               YY_CAST (long, yyk), yyrule - 1, yyrline[yyrule]));
+  if (! yynormal)
+    yyfillin (yyvsp, 1, -yynrhs);
+  /* The symbols being reduced.  */
+  for (yyi = 0; yyi < yynrhs; yyi++)
+    {
+      YY_FPRINTF ((stderr, "   $%d = ", yyi + 1));
+      yy_symbol_print (stderr,
+                       yy_accessing_symbol (yyvsp[yyi - yynrhs + 1].yystate.yylrState),
+                       &yyvsp[yyi - yynrhs + 1].yystate.yysemantics.yysval,
+                       &(YY_CAST (yyGLRStackItem const *, yyvsp)[YYFILL ((yyi + 1) - (yynrhs))].yystate.yyloc)                       );
+      if (!yyvsp[yyi - yynrhs + 1].yystate.yyresolved)
+        YY_FPRINTF ((stderr, " (unresolved)"));
+      YY_FPRINTF ((stderr, "\n"));
+    }
+}
+#endif
+
+/** Pop the symbols consumed by reduction #YYRULE from the top of stack
+ *  #YYK of *YYSTACKP, and perform the appropriate semantic action on their
+ *  semantic values.  Assumes that all ambiguities in semantic values
+ *  have been previously resolved.  Set *YYVALP to the resulting value,
+ *  and *YYLOCP to the computed location (if any).  Return value is as
+ *  for userAction.  */
+static inline YYRESULTTAG
+yydoAction (yyGLRStack* yystackp, YYPTRDIFF_T yyk, yyRuleNum yyrule,
+            YYSTYPE* yyvalp, YYLTYPE *yylocp)
+{
+  int yynrhs = yyrhsLength (yyrule);
+
+  if (yystackp->yysplitPoint == YY_NULLPTR)
+    {
+      /* Standard special case: single stack.  */
+      yyGLRStackItem* yyrhs
+        = YY_REINTERPRET_CAST (yyGLRStackItem*, yystackp->yytops.yystates[yyk]);
+      YY_ASSERT (yyk == 0);
+      yystackp->yynextFree -= yynrhs;
+      yystackp->yyspaceLeft += yynrhs;
+      yystackp->yytops.yystates[0] = & yystackp->yynextFree[-1].yystate;
+      YY_REDUCE_PRINT ((yytrue, yyrhs, yyk, yyrule));
+      return yyuserAction (yyrule, yynrhs, yyrhs, yystackp,
+                           yyvalp, yylocp);
+    }
+  else
+    {
+      yyGLRStackItem yyrhsVals[YYMAXRHS + YYMAXLEFT + 1];
+      yyGLRState* yys = yyrhsVals[YYMAXRHS + YYMAXLEFT].yystate.yypred
+        = yystackp->yytops.yystates[yyk];
+      int yyi;
+      if (yynrhs == 0)
+        /* Set default location.  */
+        yyrhsVals[YYMAXRHS + YYMAXLEFT - 1].yystate.yyloc = yys->yyloc;
+      for (yyi = 0; yyi < yynrhs; yyi += 1)
+        {
+          yys = yys->yypred;
+          YY_ASSERT (yys);
+        }
+      yyupdateSplit (yystackp, yys);
+      yystackp->yytops.yystates[yyk] = yys;
+      YY_REDUCE_PRINT ((yyfalse, yyrhsVals + YYMAXRHS + YYMAXLEFT - 1, yyk, yyrule));
+      return yyuserAction (yyrule, yynrhs, yyrhsVals + YYMAXRHS + YYMAXLEFT - 1,
+                           yystackp, yyvalp, yylocp);
+    }
+}
+
+/** Pop items off stack #YYK of *YYSTACKP according to grammar rule YYRULE,
+ *  and push back on the resulting nonterminal symbol.  Perform the
+ *  semantic action associated with YYRULE and store its value with the
+ *  newly pushed state, if YYFORCEEVAL or if *YYSTACKP is currently
+ *  unambiguous.  Otherwise, store the deferred semantic action with
+ *  the new state.  If the new state would have an identical input
+ *  position, LR state, and predecessor to an existing state on the stack,
+ *  it is identified with that existing state, eliminating stack #YYK from
+ *  *YYSTACKP.  In this case, the semantic value is
+ *  added to the options for the existing state's semantic value.
+ */
+static inline YYRESULTTAG
+yyglrReduce (yyGLRStack* yystackp, YYPTRDIFF_T yyk, yyRuleNum yyrule,
+             yybool yyforceEval)
+{
+  YYPTRDIFF_T yyposn = yystackp->yytops.yystates[yyk]->yyposn;
+
+  if (yyforceEval || yystackp->yysplitPoint == YY_NULLPTR)
+    {
+      YYSTYPE yysval;
+      YYLTYPE yyloc;
+
+      YYRESULTTAG yyflag = yydoAction (yystackp, yyk, yyrule, &yysval, &yyloc);
+      if (yyflag == yyerr && yystackp->yysplitPoint != YY_NULLPTR)
+        YY_DPRINTF ((stderr,
+                     "Parse on stack %ld rejected by rule %d (line %d).\n",
+                     YY_CAST (long, yyk), yyrule - 1, yyrline[yyrule - 1]));
+      if (yyflag != yyok)
+        return yyflag;
+      YY_SYMBOL_PRINT ("-> $$ =", yylhsNonterm (yyrule), &yysval, &yyloc);
+      yyglrShift (yystackp, yyk,
+                  yyLRgotoState (yystackp->yytops.yystates[yyk]->yylrState,
+                                 yylhsNonterm (yyrule)),
+                  yyposn, &yysval, &yyloc);
+    }
+  else
+    {
+      YYPTRDIFF_T yyi;
+      int yyn;
+      yyGLRState* yys, *yys0 = yystackp->yytops.yystates[yyk];
+      yy_state_t yynewLRState;
+
+      for (yys = yystackp->yytops.yystates[yyk], yyn = yyrhsLength (yyrule);
+           0 < yyn; yyn -= 1)
+        {
+          yys = yys->yypred;
+          YY_ASSERT (yys);
+        }
+      yyupdateSplit (yystackp, yys);
+      yynewLRState = yyLRgotoState (yys->yylrState, yylhsNonterm (yyrule));
+      YY_DPRINTF ((stderr,
+                   "Reduced stack %ld by rule %d (line %d); action deferred.  "
+                   "Now in state %d.\n",
+                   YY_CAST (long, yyk), yyrule - 1, yyrline[yyrule - 1],
+                   yynewLRState));
+      for (yyi = 0; yyi < yystackp->yytops.yysize; yyi += 1)
+        if (yyi != yyk && yystackp->yytops.yystates[yyi] != YY_NULLPTR)
+          {
+            yyGLRState *yysplit = yystackp->yysplitPoint;
+            yyGLRState *yyp = yystackp->yytops.yystates[yyi];
+            while (yyp != yys && yyp != yysplit && yyp->yyposn >= yyposn)
+              {
+                if (yyp->yylrState == yynewLRState && yyp->yypred == yys)
+                  {
+                    yyaddDeferredAction (yystackp, yyk, yyp, yys0, yyrule);
+                    yymarkStackDeleted (yystackp, yyk);
+                    YY_DPRINTF ((stderr, "Merging stack %ld into stack %ld.\n",
+                                 YY_CAST (long, yyk), YY_CAST (long, yyi)));
+                    return yyok;
+                  }
+                yyp = yyp->yypred;
+              }
+          }
+      yystackp->yytops.yystates[yyk] = yys;
+      yyglrShiftDefer (yystackp, yyk, yynewLRState, yyposn, yys0, yyrule);
+    }
+  return yyok;
+}
+
+static YYPTRDIFF_T
+yysplitStack (yyGLRStack* yystackp, YYPTRDIFF_T yyk)
+{
+  if (yystackp->yysplitPoint == YY_NULLPTR)
+    {
+      YY_ASSERT (yyk == 0);
+      yystackp->yysplitPoint = yystackp->yytops.yystates[yyk];
+    }
+  if (yystackp->yytops.yycapacity <= yystackp->yytops.yysize)
+    {
+      YYPTRDIFF_T state_size = YYSIZEOF (yystackp->yytops.yystates[0]);
+      YYPTRDIFF_T half_max_capacity = YYSIZE_MAXIMUM / 2 / state_size;
+      if (half_max_capacity < yystackp->yytops.yycapacity)
+        yyMemoryExhausted (yystackp);
+      yystackp->yytops.yycapacity *= 2;
+
+      {
+        yyGLRState** yynewStates
+          = YY_CAST (yyGLRState**,
+                     YYREALLOC (yystackp->yytops.yystates,
+                                (YY_CAST (YYSIZE_T, yystackp->yytops.yycapacity)
+                                 * sizeof yynewStates[0])));
+        if (yynewStates == YY_NULLPTR)
+          yyMemoryExhausted (yystackp);
+        yystackp->yytops.yystates = yynewStates;
+      }
+
+      {
+        yybool* yynewLookaheadNeeds
+          = YY_CAST (yybool*,
+                     YYREALLOC (yystackp->yytops.yylookaheadNeeds,
+                                (YY_CAST (YYSIZE_T, yystackp->yytops.yycapacity)
+                                 * sizeof yynewLookaheadNeeds[0])));
+        if (yynewLookaheadNeeds == YY_NULLPTR)
+          yyMemoryExhausted (yystackp);
+        yystackp->yytops.yylookaheadNeeds = yynewLookaheadNeeds;
+      }
+    }
+  yystackp->yytops.yystates[yystackp->yytops.yysize]
+    = yystackp->yytops.yystates[yyk];
+  yystackp->yytops.yylookaheadNeeds[yystackp->yytops.yysize]
+    = yystackp->yytops.yylookaheadNeeds[yyk];
+  yystackp->yytops.yysize += 1;
+  return yystackp->yytops.yysize - 1;
+}
+
+/** True iff YYY0 and YYY1 represent identical options at the top level.
+ *  That is, they represent the same rule applied to RHS symbols
+ *  that produce the same terminal symbols.  */
+static yybool
+yyidenticalOptions (yySemanticOption* yyy0, yySemanticOption* yyy1)
+{
+  if (yyy0->yyrule == yyy1->yyrule)
+    {
+      yyGLRState *yys0, *yys1;
+      int yyn;
+      for (yys0 = yyy0->yystate, yys1 = yyy1->yystate,
+           yyn = yyrhsLength (yyy0->yyrule);
+           yyn > 0;
+           yys0 = yys0->yypred, yys1 = yys1->yypred, yyn -= 1)
+        if (yys0->yyposn != yys1->yyposn)
+          return yyfalse;
+      return yytrue;
+    }
+  else
+    return yyfalse;
+}
+
+/** Assuming identicalOptions (YYY0,YYY1), destructively merge the
+ *  alternative semantic values for the RHS-symbols of YYY1 and YYY0.  */
+static void
+yymergeOptionSets (yySemanticOption* yyy0, yySemanticOption* yyy1)
+{
+  yyGLRState *yys0, *yys1;
+  int yyn;
+  for (yys0 = yyy0->yystate, yys1 = yyy1->yystate,
+       yyn = yyrhsLength (yyy0->yyrule);
+       0 < yyn;
+       yys0 = yys0->yypred, yys1 = yys1->yypred, yyn -= 1)
+    {
+      if (yys0 == yys1)
+        break;
+      else if (yys0->yyresolved)
+        {
+          yys1->yyresolved = yytrue;
+          yys1->yysemantics.yysval = yys0->yysemantics.yysval;
+        }
+      else if (yys1->yyresolved)
+        {
+          yys0->yyresolved = yytrue;
+          yys0->yysemantics.yysval = yys1->yysemantics.yysval;
+        }
+      else
+        {
+          yySemanticOption** yyz0p = &yys0->yysemantics.yyfirstVal;
+          yySemanticOption* yyz1 = yys1->yysemantics.yyfirstVal;
+          while (yytrue)
+            {
+              if (yyz1 == *yyz0p || yyz1 == YY_NULLPTR)
+                break;
+              else if (*yyz0p == YY_NULLPTR)
+                {
+                  *yyz0p = yyz1;
+                  break;
+                }
+              else if (*yyz0p < yyz1)
+                {
+                  yySemanticOption* yyz = *yyz0p;
+                  *yyz0p = yyz1;
+                  yyz1 = yyz1->yynext;
+                  (*yyz0p)->yynext = yyz;
+                }
+              yyz0p = &(*yyz0p)->yynext;
+            }
+          yys1->yysemantics.yyfirstVal = yys0->yysemantics.yyfirstVal;
+        }
+    }
+}
+
+/** Y0 and Y1 represent two possible actions to take in a given
+ *  parsing state; return 0 if no combination is possible,
+ *  1 if user-mergeable, 2 if Y0 is preferred, 3 if Y1 is preferred.  */
+static int
+yypreference (yySemanticOption* y0, yySemanticOption* y1)
+{
+  yyRuleNum r0 = y0->yyrule, r1 = y1->yyrule;
+  int p0 = yydprec[r0], p1 = yydprec[r1];
+
+  if (p0 == p1)
+    {
+      if (yymerger[r0] == 0 || yymerger[r0] != yymerger[r1])
+        return 0;
+      else
+        return 1;
+    }
+  if (p0 == 0 || p1 == 0)
+    return 0;
+  if (p0 < p1)
+    return 3;
+  if (p1 < p0)
+    return 2;
+  return 0;
+}
+
+static YYRESULTTAG yyresolveValue (yyGLRState* yys,
+                                   yyGLRStack* yystackp);
+
+
+/** Resolve the previous YYN states starting at and including state YYS
+ *  on *YYSTACKP. If result != yyok, some states may have been left
+ *  unresolved possibly with empty semantic option chains.  Regardless
+ *  of whether result = yyok, each state has been left with consistent
+ *  data so that yydestroyGLRState can be invoked if necessary.  */
+static YYRESULTTAG
+yyresolveStates (yyGLRState* yys, int yyn,
+                 yyGLRStack* yystackp)
+{
+  if (0 < yyn)
+    {
+      YY_ASSERT (yys->yypred);
+      YYCHK (yyresolveStates (yys->yypred, yyn-1, yystackp));
+      if (! yys->yyresolved)
+        YYCHK (yyresolveValue (yys, yystackp));
+    }
+  return yyok;
+}
+
+/** Resolve the states for the RHS of YYOPT on *YYSTACKP, perform its
+ *  user action, and return the semantic value and location in *YYVALP
+ *  and *YYLOCP.  Regardless of whether result = yyok, all RHS states
+ *  have been destroyed (assuming the user action destroys all RHS
+ *  semantic values if invoked).  */
+static YYRESULTTAG
+yyresolveAction (yySemanticOption* yyopt, yyGLRStack* yystackp,
+                 YYSTYPE* yyvalp, YYLTYPE *yylocp)
+{
+  yyGLRStackItem yyrhsVals[YYMAXRHS + YYMAXLEFT + 1];
+  int yynrhs = yyrhsLength (yyopt->yyrule);
+  YYRESULTTAG yyflag =
+    yyresolveStates (yyopt->yystate, yynrhs, yystackp);
+  if (yyflag != yyok)
+    {
+      yyGLRState *yys;
+      for (yys = yyopt->yystate; yynrhs > 0; yys = yys->yypred, yynrhs -= 1)
+        yydestroyGLRState ("Cleanup: popping", yys);
+      return yyflag;
+    }
+
+  yyrhsVals[YYMAXRHS + YYMAXLEFT].yystate.yypred = yyopt->yystate;
+  if (yynrhs == 0)
+    /* Set default location.  */
+    yyrhsVals[YYMAXRHS + YYMAXLEFT - 1].yystate.yyloc = yyopt->yystate->yyloc;
+  {
+    int yychar_current = yychar;
+    YYSTYPE yylval_current = yylval;
+    YYLTYPE yylloc_current = yylloc;
+    yychar = yyopt->yyrawchar;
+    yylval = yyopt->yyval;
+    yylloc = yyopt->yyloc;
+    yyflag = yyuserAction (yyopt->yyrule, yynrhs,
+                           yyrhsVals + YYMAXRHS + YYMAXLEFT - 1,
+                           yystackp, yyvalp, yylocp);
+    yychar = yychar_current;
+    yylval = yylval_current;
+    yylloc = yylloc_current;
+  }
+  return yyflag;
+}
+
+#if YYDEBUG
+static void
+yyreportTree (yySemanticOption* yyx, int yyindent)
+{
+  int yynrhs = yyrhsLength (yyx->yyrule);
+  int yyi;
+  yyGLRState* yys;
+  yyGLRState* yystates[1 + YYMAXRHS];
+  yyGLRState yyleftmost_state;
+
+  for (yyi = yynrhs, yys = yyx->yystate; 0 < yyi; yyi -= 1, yys = yys->yypred)
+    yystates[yyi] = yys;
+  if (yys == YY_NULLPTR)
+    {
+      yyleftmost_state.yyposn = 0;
+      yystates[0] = &yyleftmost_state;
+    }
+  else
+    yystates[0] = yys;
+
+  if (yyx->yystate->yyposn < yys->yyposn + 1)
+    YY_FPRINTF ((stderr, "%*s%s -> <Rule %d, empty>\n",
+                 yyindent, "", yysymbol_name (yylhsNonterm (yyx->yyrule)),
+                 yyx->yyrule - 1));
+  else
+    YY_FPRINTF ((stderr, "%*s%s -> <Rule %d, tokens %ld .. %ld>\n",
+                 yyindent, "", yysymbol_name (yylhsNonterm (yyx->yyrule)),
+                 yyx->yyrule - 1, YY_CAST (long, yys->yyposn + 1),
+                 YY_CAST (long, yyx->yystate->yyposn)));
+  for (yyi = 1; yyi <= yynrhs; yyi += 1)
+    {
+      if (yystates[yyi]->yyresolved)
+        {
+          if (yystates[yyi-1]->yyposn+1 > yystates[yyi]->yyposn)
+            YY_FPRINTF ((stderr, "%*s%s <empty>\n", yyindent+2, "",
+                         yysymbol_name (yy_accessing_symbol (yystates[yyi]->yylrState))));
+          else
+            YY_FPRINTF ((stderr, "%*s%s <tokens %ld .. %ld>\n", yyindent+2, "",
+                         yysymbol_name (yy_accessing_symbol (yystates[yyi]->yylrState)),
+                         YY_CAST (long, yystates[yyi-1]->yyposn + 1),
+                         YY_CAST (long, yystates[yyi]->yyposn)));
+        }
+      else
+        yyreportTree (yystates[yyi]->yysemantics.yyfirstVal, yyindent+2);
+    }
+}
+#endif
+
+static YYRESULTTAG
+yyreportAmbiguity (yySemanticOption* yyx0,
+                   yySemanticOption* yyx1)
+{
+  YYUSE (yyx0);
+  YYUSE (yyx1);
+
+#if YYDEBUG
+  YY_FPRINTF ((stderr, "Ambiguity detected.\n"));
+  YY_FPRINTF ((stderr, "Option 1,\n"));
+  yyreportTree (yyx0, 2);
+  YY_FPRINTF ((stderr, "\nOption 2,\n"));
+  yyreportTree (yyx1, 2);
+  YY_FPRINTF ((stderr, "\n"));
+#endif
+
+  yyerror (YY_("syntax is ambiguous"));
+  return yyabort;
+}
+
+/** Resolve the locations for each of the YYN1 states in *YYSTACKP,
+ *  ending at YYS1.  Has no effect on previously resolved states.
+ *  The first semantic option of a state is always chosen.  */
+static void
+yyresolveLocations (yyGLRState *yys1, int yyn1,
+                    yyGLRStack *yystackp)
+{
+  if (0 < yyn1)
+    {
+      yyresolveLocations (yys1->yypred, yyn1 - 1, yystackp);
+      if (!yys1->yyresolved)
+        {
+          yyGLRStackItem yyrhsloc[1 + YYMAXRHS];
+          int yynrhs;
+          yySemanticOption *yyoption = yys1->yysemantics.yyfirstVal;
+          YY_ASSERT (yyoption);
+          yynrhs = yyrhsLength (yyoption->yyrule);
+          if (0 < yynrhs)
+            {
+              yyGLRState *yys;
+              int yyn;
+              yyresolveLocations (yyoption->yystate, yynrhs,
+                                  yystackp);
+              for (yys = yyoption->yystate, yyn = yynrhs;
+                   yyn > 0;
+                   yys = yys->yypred, yyn -= 1)
+                yyrhsloc[yyn].yystate.yyloc = yys->yyloc;
+            }
+          else
+            {
+              /* Both yyresolveAction and yyresolveLocations traverse the GSS
+                 in reverse rightmost order.  It is only necessary to invoke
+                 yyresolveLocations on a subforest for which yyresolveAction
+                 would have been invoked next had an ambiguity not been
+                 detected.  Thus the location of the previous state (but not
+                 necessarily the previous state itself) is guaranteed to be
+                 resolved already.  */
+              yyGLRState *yyprevious = yyoption->yystate;
+              yyrhsloc[0].yystate.yyloc = yyprevious->yyloc;
+            }
+          YYLLOC_DEFAULT ((yys1->yyloc), yyrhsloc, yynrhs);
+        }
+    }
+}
+
+/** Resolve the ambiguity represented in state YYS in *YYSTACKP,
+ *  perform the indicated actions, and set the semantic value of YYS.
+ *  If result != yyok, the chain of semantic options in YYS has been
+ *  cleared instead or it has been left unmodified except that
+ *  redundant options may have been removed.  Regardless of whether
+ *  result = yyok, YYS has been left with consistent data so that
+ *  yydestroyGLRState can be invoked if necessary.  */
+static YYRESULTTAG
+yyresolveValue (yyGLRState* yys, yyGLRStack* yystackp)
+{
+  yySemanticOption* yyoptionList = yys->yysemantics.yyfirstVal;
+  yySemanticOption* yybest = yyoptionList;
+  yySemanticOption** yypp;
+  yybool yymerge = yyfalse;
+  YYSTYPE yysval;
+  YYRESULTTAG yyflag;
+  YYLTYPE *yylocp = &yys->yyloc;
+
+  for (yypp = &yyoptionList->yynext; *yypp != YY_NULLPTR; )
+    {
+      yySemanticOption* yyp = *yypp;
+
+      if (yyidenticalOptions (yybest, yyp))
+        {
+          yymergeOptionSets (yybest, yyp);
+          *yypp = yyp->yynext;
+        }
+      else
+        {
+          switch (yypreference (yybest, yyp))
+            {
+            case 0:
+              yyresolveLocations (yys, 1, yystackp);
+              return yyreportAmbiguity (yybest, yyp);
+              break;
+            case 1:
+              yymerge = yytrue;
+              break;
+            case 2:
+              break;
+            case 3:
+              yybest = yyp;
+              yymerge = yyfalse;
+              break;
+            default:
+              /* This cannot happen so it is not worth a YY_ASSERT (yyfalse),
+                 but some compilers complain if the default case is
+                 omitted.  */
+              break;
+            }
+          yypp = &yyp->yynext;
+        }
+    }
+
+  if (yymerge)
+    {
+      yySemanticOption* yyp;
+      int yyprec = yydprec[yybest->yyrule];
+      yyflag = yyresolveAction (yybest, yystackp, &yysval, yylocp);
+      if (yyflag == yyok)
+        for (yyp = yybest->yynext; yyp != YY_NULLPTR; yyp = yyp->yynext)
+          {
+            if (yyprec == yydprec[yyp->yyrule])
+              {
+                YYSTYPE yysval_other;
+                YYLTYPE yydummy;
+                yyflag = yyresolveAction (yyp, yystackp, &yysval_other, &yydummy);
+                if (yyflag != yyok)
+                  {
+                    yydestruct ("Cleanup: discarding incompletely merged value for",
+                                yy_accessing_symbol (yys->yylrState),
+                                &yysval, yylocp);
+                    break;
+                  }
+                yyuserMerge (yymerger[yyp->yyrule], &yysval, &yysval_other);
+              }
+          }
+    }
+  else
+    yyflag = yyresolveAction (yybest, yystackp, &yysval, yylocp);
+
+  if (yyflag == yyok)
+    {
+      yys->yyresolved = yytrue;
+      yys->yysemantics.yysval = yysval;
+    }
+  else
+    yys->yysemantics.yyfirstVal = YY_NULLPTR;
+  return yyflag;
+}
+
+static YYRESULTTAG
+yyresolveStack (yyGLRStack* yystackp)
+{
+  if (yystackp->yysplitPoint != YY_NULLPTR)
+    {
+      yyGLRState* yys;
+      int yyn;
+
+      for (yyn = 0, yys = yystackp->yytops.yystates[0];
+           yys != yystackp->yysplitPoint;
+           yys = yys->yypred, yyn += 1)
+        continue;
+      YYCHK (yyresolveStates (yystackp->yytops.yystates[0], yyn, yystackp
+                             ));
+    }
+  return yyok;
+}
+
+static void
+yycompressStack (yyGLRStack* yystackp)
+{
+  yyGLRState* yyp, *yyq, *yyr;
+
+  if (yystackp->yytops.yysize != 1 || yystackp->yysplitPoint == YY_NULLPTR)
+    return;
+
+  for (yyp = yystackp->yytops.yystates[0], yyq = yyp->yypred, yyr = YY_NULLPTR;
+       yyp != yystackp->yysplitPoint;
+       yyr = yyp, yyp = yyq, yyq = yyp->yypred)
+    yyp->yypred = yyr;
+
+  yystackp->yyspaceLeft += yystackp->yynextFree - yystackp->yyitems;
+  yystackp->yynextFree = YY_REINTERPRET_CAST (yyGLRStackItem*, yystackp->yysplitPoint) + 1;
+  yystackp->yyspaceLeft -= yystackp->yynextFree - yystackp->yyitems;
+  yystackp->yysplitPoint = YY_NULLPTR;
+  yystackp->yylastDeleted = YY_NULLPTR;
+
+  while (yyr != YY_NULLPTR)
+    {
+      yystackp->yynextFree->yystate = *yyr;
+      yyr = yyr->yypred;
+      yystackp->yynextFree->yystate.yypred = &yystackp->yynextFree[-1].yystate;
+      yystackp->yytops.yystates[0] = &yystackp->yynextFree->yystate;
+      yystackp->yynextFree += 1;
+      yystackp->yyspaceLeft -= 1;
+    }
+}
+
+static YYRESULTTAG
+yyprocessOneStack (yyGLRStack* yystackp, YYPTRDIFF_T yyk,
+                   YYPTRDIFF_T yyposn)
+{
+  while (yystackp->yytops.yystates[yyk] != YY_NULLPTR)
+    {
+      yy_state_t yystate = yystackp->yytops.yystates[yyk]->yylrState;
+      YY_DPRINTF ((stderr, "Stack %ld Entering state %d\n",
+                   YY_CAST (long, yyk), yystate));
+
+      YY_ASSERT (yystate != YYFINAL);
+
+      if (yyisDefaultedState (yystate))
+        {
+          YYRESULTTAG yyflag;
+          yyRuleNum yyrule = yydefaultAction (yystate);
+          if (yyrule == 0)
+            {
+              YY_DPRINTF ((stderr, "Stack %ld dies.\n", YY_CAST (long, yyk)));
+              yymarkStackDeleted (yystackp, yyk);
+              return yyok;
+            }
+          yyflag = yyglrReduce (yystackp, yyk, yyrule, yyimmediate[yyrule]);
+          if (yyflag == yyerr)
+            {
+              YY_DPRINTF ((stderr,
+                           "Stack %ld dies "
+                           "(predicate failure or explicit user error).\n",
+                           YY_CAST (long, yyk)));
+              yymarkStackDeleted (yystackp, yyk);
+              return yyok;
+            }
+          if (yyflag != yyok)
+            return yyflag;
+        }
+      else
+        {
+          yysymbol_kind_t yytoken = yygetToken (&yychar);
+          const short* yyconflicts;
+          const int yyaction = yygetLRActions (yystate, yytoken, &yyconflicts);
+          yystackp->yytops.yylookaheadNeeds[yyk] = yytrue;
+
+          for (/* nothing */; *yyconflicts; yyconflicts += 1)
+            {
+              YYRESULTTAG yyflag;
+              YYPTRDIFF_T yynewStack = yysplitStack (yystackp, yyk);
+              YY_DPRINTF ((stderr, "Splitting off stack %ld from %ld.\n",
+                           YY_CAST (long, yynewStack), YY_CAST (long, yyk)));
+              yyflag = yyglrReduce (yystackp, yynewStack,
+                                    *yyconflicts,
+                                    yyimmediate[*yyconflicts]);
+              if (yyflag == yyok)
+                YYCHK (yyprocessOneStack (yystackp, yynewStack,
+                                          yyposn));
+              else if (yyflag == yyerr)
+                {
+                  YY_DPRINTF ((stderr, "Stack %ld dies.\n", YY_CAST (long, yynewStack)));
+                  yymarkStackDeleted (yystackp, yynewStack);
+                }
+              else
+                return yyflag;
+            }
+
+          if (yyisShiftAction (yyaction))
+            break;
+          else if (yyisErrorAction (yyaction))
+            {
+              YY_DPRINTF ((stderr, "Stack %ld dies.\n", YY_CAST (long, yyk)));
+              yymarkStackDeleted (yystackp, yyk);
+              break;
+            }
+          else
+            {
+              YYRESULTTAG yyflag = yyglrReduce (yystackp, yyk, -yyaction,
+                                                yyimmediate[-yyaction]);
+              if (yyflag == yyerr)
+                {
+                  YY_DPRINTF ((stderr,
+                               "Stack %ld dies "
+                               "(predicate failure or explicit user error).\n",
+                               YY_CAST (long, yyk)));
+                  yymarkStackDeleted (yystackp, yyk);
+                  break;
+                }
+              else if (yyflag != yyok)
+                return yyflag;
+            }
+        }
+    }
+  return yyok;
+}
+
+/* Put in YYARG at most YYARGN of the expected tokens given the
+   current YYSTACKP, and return the number of tokens stored in YYARG.  If
+   YYARG is null, return the number of expected tokens (guaranteed to
+   be less than YYNTOKENS).  */
+static int
+yypcontext_expected_tokens (const yyGLRStack* yystackp,
+                            yysymbol_kind_t yyarg[], int yyargn)
+{
+  /* Actual size of YYARG. */
+  int yycount = 0;
+  int yyn = yypact[yystackp->yytops.yystates[0]->yylrState];
+  if (!yypact_value_is_default (yyn))
+    {
+      /* Start YYX at -YYN if negative to avoid negative indexes in
+         YYCHECK.  In other words, skip the first -YYN actions for
+         this state because they are default actions.  */
+      int yyxbegin = yyn < 0 ? -yyn : 0;
+      /* Stay within bounds of both yycheck and yytname.  */
+      int yychecklim = YYLAST - yyn + 1;
+      int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
+      int yyx;
+      for (yyx = yyxbegin; yyx < yyxend; ++yyx)
+        if (yycheck[yyx + yyn] == yyx && yyx != YYSYMBOL_YYerror
+            && !yytable_value_is_error (yytable[yyx + yyn]))
+          {
+            if (!yyarg)
+              ++yycount;
+            else if (yycount == yyargn)
+              return 0;
+            else
+              yyarg[yycount++] = YY_CAST (yysymbol_kind_t, yyx);
+          }
+    }
+  if (yyarg && yycount == 0 && 0 < yyargn)
+    yyarg[0] = YYSYMBOL_YYEMPTY;
+  return yycount;
+}
+
+static int
+yy_syntax_error_arguments (const yyGLRStack* yystackp,
+                           yysymbol_kind_t yyarg[], int yyargn)
+{
+  yysymbol_kind_t yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
+  /* Actual size of YYARG. */
+  int yycount = 0;
+  /* There are many possibilities here to consider:
+     - If this state is a consistent state with a default action, then
+       the only way this function was invoked is if the default action
+       is an error action.  In that case, don't check for expected
+       tokens because there are none.
+     - The only way there can be no lookahead present (in yychar) is if
+       this state is a consistent state with a default action.  Thus,
+       detecting the absence of a lookahead is sufficient to determine
+       that there is no unexpected or expected token to report.  In that
+       case, just report a simple "syntax error".
+     - Don't assume there isn't a lookahead just because this state is a
+       consistent state with a default action.  There might have been a
+       previous inconsistent state, consistent state with a non-default
+       action, or user semantic action that manipulated yychar.b4_lac_if([
+       In the first two cases, it might appear that the current syntax
+       error should have been detected in the previous state when yy_lac
+       was invoked.  However, at that time, there might have been a
+       different syntax error that discarded a different initial context
+       during error recovery, leaving behind the current lookahead.], [
+     - Of course, the expected token list depends on states to have
+       correct lookahead information, and it depends on the parser not
+       to perform extra reductions after fetching a lookahead from the
+       scanner and before detecting a syntax error.  Thus, state merging
+       (from LALR or IELR) and default reductions corrupt the expected
+       token list.  However, the list is correct for canonical LR with
+       one exception: it will still contain any token that will not be
+       accepted due to an error action in a later state.])
+  */
+  if (yytoken != YYSYMBOL_YYEMPTY)
+    {
+      int yyn;
+      if (yyarg)
+        yyarg[yycount] = yytoken;
+      ++yycount;
+      yyn = yypcontext_expected_tokens (yystackp,
+                                        yyarg ? yyarg + 1 : yyarg, yyargn - 1);
+      if (yyn == YYENOMEM)
+        return YYENOMEM;
+      else
+        yycount += yyn;
+    }
+  return yycount;
+}
+
+
+
+static void
+yyreportSyntaxError (yyGLRStack* yystackp)
+{
+  if (yystackp->yyerrState != 0)
+    return;
+  {
+  yybool yysize_overflow = yyfalse;
+  char* yymsg = YY_NULLPTR;
+  enum { YYARGS_MAX = 5 };
+  /* Internationalized format string. */
+  const char *yyformat = YY_NULLPTR;
+  /* Arguments of yyformat: reported tokens (one for the "unexpected",
+     one per "expected"). */
+  yysymbol_kind_t yyarg[YYARGS_MAX];
+  /* Cumulated lengths of YYARG.  */
+  YYPTRDIFF_T yysize = 0;
+
+  /* Actual size of YYARG. */
+  int yycount
+    = yy_syntax_error_arguments (yystackp, yyarg, YYARGS_MAX);
+  if (yycount == YYENOMEM)
+    yyMemoryExhausted (yystackp);
+
+  switch (yycount)
+    {
+#define YYCASE_(N, S)                   \
+      case N:                           \
+        yyformat = S;                   \
+      break
+    default: /* Avoid compiler warnings. */
+      YYCASE_(0, YY_("syntax error"));
+      YYCASE_(1, YY_("syntax error, unexpected %s"));
+      YYCASE_(2, YY_("syntax error, unexpected %s, expecting %s"));
+      YYCASE_(3, YY_("syntax error, unexpected %s, expecting %s or %s"));
+      YYCASE_(4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
+      YYCASE_(5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
+#undef YYCASE_
+    }
+
+  /* Compute error message size.  Don't count the "%s"s, but reserve
+     room for the terminator.  */
+  yysize = yystrlen (yyformat) - 2 * yycount + 1;
+  {
+    int yyi;
+    for (yyi = 0; yyi < yycount; ++yyi)
+      {
+        YYPTRDIFF_T yysz
+          = yytnamerr (YY_NULLPTR, yytname[yyarg[yyi]]);
+        if (YYSIZE_MAXIMUM - yysize < yysz)
+          yysize_overflow = yytrue;
+        else
+          yysize += yysz;
+      }
+  }
+
+  if (!yysize_overflow)
+    yymsg = YY_CAST (char *, YYMALLOC (YY_CAST (YYSIZE_T, yysize)));
+
+  if (yymsg)
+    {
+      char *yyp = yymsg;
+      int yyi = 0;
+      while ((*yyp = *yyformat))
+        {
+          if (*yyp == '%' && yyformat[1] == 's' && yyi < yycount)
+            {
+              yyp += yytnamerr (yyp, yytname[yyarg[yyi++]]);
+              yyformat += 2;
+            }
+          else
+            {
+              ++yyp;
+              ++yyformat;
+            }
+        }
+      yyerror (yymsg);
+      YYFREE (yymsg);
+    }
+  else
+    {
+      yyerror (YY_("syntax error"));
+      yyMemoryExhausted (yystackp);
+    }
+  }
+  yynerrs += 1;
+}
+
+/* Recover from a syntax error on *YYSTACKP, assuming that *YYSTACKP->YYTOKENP,
+   yylval, and yylloc are the syntactic category, semantic value, and location
+   of the lookahead.  */
+static void
+yyrecoverSyntaxError (yyGLRStack* yystackp)
+{
+  if (yystackp->yyerrState == 3)
+    /* We just shifted the error token and (perhaps) took some
+       reductions.  Skip tokens until we can proceed.  */
+    while (yytrue)
+      {
+        yysymbol_kind_t yytoken;
+        int yyj;
+        if (yychar == YYEOF)
+          yyFail (yystackp, YY_NULLPTR);
+        if (yychar != YYEMPTY)
+          {
+            /* We throw away the lookahead, but the error range
+               of the shifted error token must take it into account.  */
+            yyGLRState *yys = yystackp->yytops.yystates[0];
+            yyGLRStackItem yyerror_range[3];
+            yyerror_range[1].yystate.yyloc = yys->yyloc;
+            yyerror_range[2].yystate.yyloc = yylloc;
+            YYLLOC_DEFAULT ((yys->yyloc), yyerror_range, 2);
+            yytoken = YYTRANSLATE (yychar);
+            yydestruct ("Error: discarding",
+                        yytoken, &yylval, &yylloc);
+            yychar = YYEMPTY;
+          }
+        yytoken = yygetToken (&yychar);
+        yyj = yypact[yystackp->yytops.yystates[0]->yylrState];
+        if (yypact_value_is_default (yyj))
+          return;
+        yyj += yytoken;
+        if (yyj < 0 || YYLAST < yyj || yycheck[yyj] != yytoken)
+          {
+            if (yydefact[yystackp->yytops.yystates[0]->yylrState] != 0)
+              return;
+          }
+        else if (! yytable_value_is_error (yytable[yyj]))
+          return;
+      }
+
+  /* Reduce to one stack.  */
+  {
+    YYPTRDIFF_T yyk;
+    for (yyk = 0; yyk < yystackp->yytops.yysize; yyk += 1)
+      if (yystackp->yytops.yystates[yyk] != YY_NULLPTR)
+        break;
+    if (yyk >= yystackp->yytops.yysize)
+      yyFail (yystackp, YY_NULLPTR);
+    for (yyk += 1; yyk < yystackp->yytops.yysize; yyk += 1)
+      yymarkStackDeleted (yystackp, yyk);
+    yyremoveDeletes (yystackp);
+    yycompressStack (yystackp);
+  }
+
+  /* Pop stack until we find a state that shifts the error token.  */
+  yystackp->yyerrState = 3;
+  while (yystackp->yytops.yystates[0] != YY_NULLPTR)
+    {
+      yyGLRState *yys = yystackp->yytops.yystates[0];
+      int yyj = yypact[yys->yylrState];
+      if (! yypact_value_is_default (yyj))
+        {
+          yyj += YYSYMBOL_YYerror;
+          if (0 <= yyj && yyj <= YYLAST && yycheck[yyj] == YYSYMBOL_YYerror
+              && yyisShiftAction (yytable[yyj]))
+            {
+              /* Shift the error token.  */
+              int yyaction = yytable[yyj];
+              /* First adjust its location.*/
+              YYLTYPE yyerrloc;
+              yystackp->yyerror_range[2].yystate.yyloc = yylloc;
+              YYLLOC_DEFAULT (yyerrloc, (yystackp->yyerror_range), 2);
+              YY_SYMBOL_PRINT ("Shifting", yy_accessing_symbol (yyaction),
+                               &yylval, &yyerrloc);
+              yyglrShift (yystackp, 0, yyaction,
+                          yys->yyposn, &yylval, &yyerrloc);
+              yys = yystackp->yytops.yystates[0];
+              break;
+            }
+        }
+      yystackp->yyerror_range[1].yystate.yyloc = yys->yyloc;
+      if (yys->yypred != YY_NULLPTR)
+        yydestroyGLRState ("Error: popping", yys);
+      yystackp->yytops.yystates[0] = yys->yypred;
+      yystackp->yynextFree -= 1;
+      yystackp->yyspaceLeft += 1;
+    }
+  if (yystackp->yytops.yystates[0] == YY_NULLPTR)
+    yyFail (yystackp, YY_NULLPTR);
+}
+
+#define YYCHK1(YYE)                                                          \
+  do {                                                                       \
+    switch (YYE) {                                                           \
+    case yyok:                                                               \
+      break;                                                                 \
+    case yyabort:                                                            \
+      goto yyabortlab;                                                       \
+    case yyaccept:                                                           \
+      goto yyacceptlab;                                                      \
+    case yyerr:                                                              \
+      goto yyuser_error;                                                     \
+    default:                                                                 \
+      goto yybuglab;                                                         \
+    }                                                                        \
+  } while (0)
+
+/*----------.
+| yyparse.  |
+`----------*/
+
+int
+yyparse (void)
+{
+  int yyresult;
+  yyGLRStack yystack;
+  yyGLRStack* const yystackp = &yystack;
+  YYPTRDIFF_T yyposn;
+
+  YY_DPRINTF ((stderr, "Starting parse\n"));
+
+  yychar = YYEMPTY;
+  yylval = yyval_default;
+  yylloc = yyloc_default;
+
+  if (! yyinitGLRStack (yystackp, YYINITDEPTH))
+    goto yyexhaustedlab;
+  switch (YYSETJMP (yystack.yyexception_buffer))
+    {
+    case 0: break;
+    case 1: goto yyabortlab;
+    case 2: goto yyexhaustedlab;
+    default: goto yybuglab;
+    }
+  yyglrShift (&yystack, 0, 0, 0, &yylval, &yylloc);
+  yyposn = 0;
+
+  while (yytrue)
+    {
+      /* For efficiency, we have two loops, the first of which is
+         specialized to deterministic operation (single stack, no
+         potential ambiguity).  */
+      /* Standard mode. */
+      while (yytrue)
+        {
+          yy_state_t yystate = yystack.yytops.yystates[0]->yylrState;
+          YY_DPRINTF ((stderr, "Entering state %d\n", yystate));
+          if (yystate == YYFINAL)
+            goto yyacceptlab;
+          if (yyisDefaultedState (yystate))
+            {
+              yyRuleNum yyrule = yydefaultAction (yystate);
+              if (yyrule == 0)
+                {
+                  yystack.yyerror_range[1].yystate.yyloc = yylloc;
+                  yyreportSyntaxError (&yystack);
+                  goto yyuser_error;
+                }
+              YYCHK1 (yyglrReduce (&yystack, 0, yyrule, yytrue));
+            }
+          else
+            {
+              yysymbol_kind_t yytoken = yygetToken (&yychar);
+              const short* yyconflicts;
+              int yyaction = yygetLRActions (yystate, yytoken, &yyconflicts);
+              if (*yyconflicts)
+                /* Enter nondeterministic mode.  */
+                break;
+              if (yyisShiftAction (yyaction))
+                {
+                  YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
+                  yychar = YYEMPTY;
+                  yyposn += 1;
+                  yyglrShift (&yystack, 0, yyaction, yyposn, &yylval, &yylloc);
+                  if (0 < yystack.yyerrState)
+                    yystack.yyerrState -= 1;
+                }
+              else if (yyisErrorAction (yyaction))
+                {
+                  yystack.yyerror_range[1].yystate.yyloc = yylloc;
+                  /* Issue an error message unless the scanner already
+                     did. */
+                  if (yychar != YYerror)
+                    yyreportSyntaxError (&yystack);
+                  goto yyuser_error;
+                }
+              else
+                YYCHK1 (yyglrReduce (&yystack, 0, -yyaction, yytrue));
+            }
+        }
+
+      /* Nondeterministic mode. */
+      while (yytrue)
+        {
+          yysymbol_kind_t yytoken_to_shift;
+          YYPTRDIFF_T yys;
+
+          for (yys = 0; yys < yystack.yytops.yysize; yys += 1)
+            yystackp->yytops.yylookaheadNeeds[yys] = yychar != YYEMPTY;
+
+          /* yyprocessOneStack returns one of three things:
+
+              - An error flag.  If the caller is yyprocessOneStack, it
+                immediately returns as well.  When the caller is finally
+                yyparse, it jumps to an error label via YYCHK1.
+
+              - yyok, but yyprocessOneStack has invoked yymarkStackDeleted
+                (&yystack, yys), which sets the top state of yys to NULL.  Thus,
+                yyparse's following invocation of yyremoveDeletes will remove
+                the stack.
+
+              - yyok, when ready to shift a token.
+
+             Except in the first case, yyparse will invoke yyremoveDeletes and
+             then shift the next token onto all remaining stacks.  This
+             synchronization of the shift (that is, after all preceding
+             reductions on all stacks) helps prevent double destructor calls
+             on yylval in the event of memory exhaustion.  */
+
+          for (yys = 0; yys < yystack.yytops.yysize; yys += 1)
+            YYCHK1 (yyprocessOneStack (&yystack, yys, yyposn));
+          yyremoveDeletes (&yystack);
+          if (yystack.yytops.yysize == 0)
+            {
+              yyundeleteLastStack (&yystack);
+              if (yystack.yytops.yysize == 0)
+                yyFail (&yystack, YY_("syntax error"));
+              YYCHK1 (yyresolveStack (&yystack));
+              YY_DPRINTF ((stderr, "Returning to deterministic operation.\n"));
+              yystack.yyerror_range[1].yystate.yyloc = yylloc;
+              yyreportSyntaxError (&yystack);
+              goto yyuser_error;
+            }
+
+          /* If any yyglrShift call fails, it will fail after shifting.  Thus,
+             a copy of yylval will already be on stack 0 in the event of a
+             failure in the following loop.  Thus, yychar is set to YYEMPTY
+             before the loop to make sure the user destructor for yylval isn't
+             called twice.  */
+          yytoken_to_shift = YYTRANSLATE (yychar);
+          yychar = YYEMPTY;
+          yyposn += 1;
+          for (yys = 0; yys < yystack.yytops.yysize; yys += 1)
+            {
+              yy_state_t yystate = yystack.yytops.yystates[yys]->yylrState;
+              const short* yyconflicts;
+              int yyaction = yygetLRActions (yystate, yytoken_to_shift,
+                              &yyconflicts);
+              /* Note that yyconflicts were handled by yyprocessOneStack.  */
+              YY_DPRINTF ((stderr, "On stack %ld, ", YY_CAST (long, yys)));
+              YY_SYMBOL_PRINT ("shifting", yytoken_to_shift, &yylval, &yylloc);
+              yyglrShift (&yystack, yys, yyaction, yyposn,
+                          &yylval, &yylloc);
+              YY_DPRINTF ((stderr, "Stack %ld now in state #%d\n",
+                           YY_CAST (long, yys),
+                           yystack.yytops.yystates[yys]->yylrState));
+            }
+
+          if (yystack.yytops.yysize == 1)
+            {
+              YYCHK1 (yyresolveStack (&yystack));
+              YY_DPRINTF ((stderr, "Returning to deterministic operation.\n"));
+              yycompressStack (&yystack);
+              break;
+            }
+        }
+      continue;
+    yyuser_error:
+      yyrecoverSyntaxError (&yystack);
+      yyposn = yystack.yytops.yystates[0]->yyposn;
+    }
+
+ yyacceptlab:
+  yyresult = 0;
+  goto yyreturn;
+
+ yybuglab:
+  YY_ASSERT (yyfalse);
+  goto yyabortlab;
+
+ yyabortlab:
+  yyresult = 1;
+  goto yyreturn;
+
+ yyexhaustedlab:
+  yyerror (YY_("memory exhausted"));
+  yyresult = 2;
+  goto yyreturn;
+
+ yyreturn:
+  if (yychar != YYEMPTY)
+    yydestruct ("Cleanup: discarding lookahead",
+                YYTRANSLATE (yychar), &yylval, &yylloc);
+
+  /* If the stack is well-formed, pop the stack until it is empty,
+     destroying its entries as we go.  But free the stack regardless
+     of whether it is well-formed.  */
+  if (yystack.yyitems)
+    {
+      yyGLRState** yystates = yystack.yytops.yystates;
+      if (yystates)
+        {
+          YYPTRDIFF_T yysize = yystack.yytops.yysize;
+          YYPTRDIFF_T yyk;
+          for (yyk = 0; yyk < yysize; yyk += 1)
+            if (yystates[yyk])
+              {
+                while (yystates[yyk])
+                  {
+                    yyGLRState *yys = yystates[yyk];
+                    yystack.yyerror_range[1].yystate.yyloc = yys->yyloc;
+                    if (yys->yypred != YY_NULLPTR)
+                      yydestroyGLRState ("Cleanup: popping", yys);
+                    yystates[yyk] = yys->yypred;
+                    yystack.yynextFree -= 1;
+                    yystack.yyspaceLeft += 1;
+                  }
+                break;
+              }
+        }
+      yyfreeGLRStack (&yystack);
+    }
+
+  return yyresult;
+}
+
+/* DEBUGGING ONLY */
+#if YYDEBUG
+static void
+yy_yypstack (yyGLRState* yys)
+{
+  if (yys->yypred)
+    {
+      yy_yypstack (yys->yypred);
+      YY_FPRINTF ((stderr, " -> "));
+    }
+  YY_FPRINTF ((stderr, "%d@%ld", yys->yylrState, YY_CAST (long, yys->yyposn)));
+}
+
+static void
+yypstates (yyGLRState* yyst)
+{
+  if (yyst == YY_NULLPTR)
+    YY_FPRINTF ((stderr, "<null>"));
+  else
+    yy_yypstack (yyst);
+  YY_FPRINTF ((stderr, "\n"));
+}
+
+static void
+yypstack (yyGLRStack* yystackp, YYPTRDIFF_T yyk)
+{
+  yypstates (yystackp->yytops.yystates[yyk]);
+}
+
+static void
+yypdumpstack (yyGLRStack* yystackp)
+{
+#define YYINDEX(YYX)                                                    \
+  YY_CAST (long,                                                        \
+           ((YYX)                                                       \
+            ? YY_REINTERPRET_CAST (yyGLRStackItem*, (YYX)) - yystackp->yyitems \
+            : -1))
+
+  yyGLRStackItem* yyp;
+  for (yyp = yystackp->yyitems; yyp < yystackp->yynextFree; yyp += 1)
+    {
+      YY_FPRINTF ((stderr, "%3ld. ",
+                   YY_CAST (long, yyp - yystackp->yyitems)));
+      if (*YY_REINTERPRET_CAST (yybool *, yyp))
+        {
+          YY_ASSERT (yyp->yystate.yyisState);
+          YY_ASSERT (yyp->yyoption.yyisState);
+          YY_FPRINTF ((stderr, "Res: %d, LR State: %d, posn: %ld, pred: %ld",
+                       yyp->yystate.yyresolved, yyp->yystate.yylrState,
+                       YY_CAST (long, yyp->yystate.yyposn),
+                       YYINDEX (yyp->yystate.yypred)));
+          if (! yyp->yystate.yyresolved)
+            YY_FPRINTF ((stderr, ", firstVal: %ld",
+                         YYINDEX (yyp->yystate.yysemantics.yyfirstVal)));
+        }
+      else
+        {
+          YY_ASSERT (!yyp->yystate.yyisState);
+          YY_ASSERT (!yyp->yyoption.yyisState);
+          YY_FPRINTF ((stderr, "Option. rule: %d, state: %ld, next: %ld",
+                       yyp->yyoption.yyrule - 1,
+                       YYINDEX (yyp->yyoption.yystate),
+                       YYINDEX (yyp->yyoption.yynext)));
+        }
+      YY_FPRINTF ((stderr, "\n"));
+    }
+
+  YY_FPRINTF ((stderr, "Tops:"));
+  {
+    YYPTRDIFF_T yyi;
+    for (yyi = 0; yyi < yystackp->yytops.yysize; yyi += 1)
+      YY_FPRINTF ((stderr, "%ld: %ld; ", YY_CAST (long, yyi),
+                   YYINDEX (yystackp->yytops.yystates[yyi])));
+    YY_FPRINTF ((stderr, "\n"));
+  }
+#undef YYINDEX
+}
+#endif
+
+#undef yylval
+#undef yychar
+#undef yynerrs
+#undef yylloc
+
+
+
+
+
+
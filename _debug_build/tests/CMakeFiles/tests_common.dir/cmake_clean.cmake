@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests_common.dir/tests_data.c.o"
+  "CMakeFiles/tests_common.dir/tests_data.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tests_common.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
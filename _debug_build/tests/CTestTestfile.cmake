@@ -0,0 +1,359 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests
+# Build directory: /root/repo/_debug_build/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[parsec_build_tests]=] "/usr/bin/cmake" "--build" "/root/repo/_debug_build" "--target" "parsec_build_tests")
+set_tests_properties([=[parsec_build_tests]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;2;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[class/atomics]=] "class/atomics" "-c" "4")
+set_tests_properties([=[class/atomics]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/class/Testings.cmake;2;add_test;/root/repo/tests/class/Testings.cmake;0;;/root/repo/tests/Testings.cmake;2;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[class/rwlock]=] "class/rwlock" "-c" "4")
+set_tests_properties([=[class/rwlock]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/class/Testings.cmake;4;add_test;/root/repo/tests/class/Testings.cmake;0;;/root/repo/tests/Testings.cmake;2;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[class/barrier]=] "class/barrier" "-m" "0" "-M" "17" "-n" "500")
+set_tests_properties([=[class/barrier]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/class/Testings.cmake;5;add_test;/root/repo/tests/class/Testings.cmake;0;;/root/repo/tests/Testings.cmake;2;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[class/mpmc_ring]=] "class/mpmc_ring" "-c" "4" "-b" "8")
+set_tests_properties([=[class/mpmc_ring]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/class/Testings.cmake;6;add_test;/root/repo/tests/class/Testings.cmake;0;;/root/repo/tests/Testings.cmake;2;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[class/mpmc_ring:single]=] "class/mpmc_ring" "-c" "8" "-b" "1" "-s" "16")
+set_tests_properties([=[class/mpmc_ring:single]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/class/Testings.cmake;7;add_test;/root/repo/tests/class/Testings.cmake;0;;/root/repo/tests/Testings.cmake;2;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[class/lifo]=] "class/lifo" "-c" "4")
+set_tests_properties([=[class/lifo]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/class/Testings.cmake;8;add_test;/root/repo/tests/class/Testings.cmake;0;;/root/repo/tests/Testings.cmake;2;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[class/list]=] "class/list" "-c" "4")
+set_tests_properties([=[class/list]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/class/Testings.cmake;9;add_test;/root/repo/tests/class/Testings.cmake;0;;/root/repo/tests/Testings.cmake;2;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[class/hash]=] "class/hash" "-#" "65536" "-r" "4" "-n")
+set_tests_properties([=[class/hash]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/class/Testings.cmake;10;add_test;/root/repo/tests/class/Testings.cmake;0;;/root/repo/tests/Testings.cmake;2;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[class/future]=] "class/future" "-c" "4")
+set_tests_properties([=[class/future]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/class/Testings.cmake;11;add_test;/root/repo/tests/class/Testings.cmake;0;;/root/repo/tests/Testings.cmake;2;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[class/future_datacopy]=] "class/future_datacopy")
+set_tests_properties([=[class/future_datacopy]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/class/Testings.cmake;12;add_test;/root/repo/tests/class/Testings.cmake;0;;/root/repo/tests/Testings.cmake;2;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[class/atomics:inline]=] "class/atomics_inline" "-c" "4")
+set_tests_properties([=[class/atomics:inline]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/class/Testings.cmake;15;add_test;/root/repo/tests/class/Testings.cmake;0;;/root/repo/tests/Testings.cmake;2;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[class/rwlock:inline]=] "class/rwlock_inline" "-c" "4")
+set_tests_properties([=[class/rwlock:inline]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/class/Testings.cmake;17;add_test;/root/repo/tests/class/Testings.cmake;0;;/root/repo/tests/Testings.cmake;2;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[class/lifo:inline]=] "class/lifo_inline" "-c" "4")
+set_tests_properties([=[class/lifo:inline]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/class/Testings.cmake;18;add_test;/root/repo/tests/class/Testings.cmake;0;;/root/repo/tests/Testings.cmake;2;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[class/list:inline]=] "class/list_inline" "-c" "4")
+set_tests_properties([=[class/list:inline]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/class/Testings.cmake;19;add_test;/root/repo/tests/class/Testings.cmake;0;;/root/repo/tests/Testings.cmake;2;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[class/hash:inline]=] "class/hash_inline" "-#" "65536" "-r" "4" "-n")
+set_tests_properties([=[class/hash:inline]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/class/Testings.cmake;20;add_test;/root/repo/tests/class/Testings.cmake;0;;/root/repo/tests/Testings.cmake;2;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[api/init_fini]=] "api/init_fini")
+set_tests_properties([=[api/init_fini]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/api/Testings.cmake;1;parsec_addtest_cmd;/root/repo/tests/api/Testings.cmake;0;;/root/repo/tests/Testings.cmake;3;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[api/touch]=] "api/touch_ex" "-v=5")
+set_tests_properties([=[api/touch]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/api/Testings.cmake;2;parsec_addtest_cmd;/root/repo/tests/api/Testings.cmake;0;;/root/repo/tests/Testings.cmake;3;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[api/touch:inline]=] "api/touch_ex_inline" "-v=5")
+set_tests_properties([=[api/touch:inline]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/api/Testings.cmake;3;parsec_addtest_cmd;/root/repo/tests/api/Testings.cmake;0;;/root/repo/tests/Testings.cmake;3;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[api/touchf:fortran]=] "api/touch_exf" "-v=5")
+set_tests_properties([=[api/touchf:fortran]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/api/Testings.cmake;7;parsec_addtest_cmd;/root/repo/tests/api/Testings.cmake;0;;/root/repo/tests/Testings.cmake;3;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[api/compose]=] "api/compose")
+set_tests_properties([=[api/compose]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/api/Testings.cmake;10;parsec_addtest_cmd;/root/repo/tests/api/Testings.cmake;0;;/root/repo/tests/Testings.cmake;3;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[api/init_fini:mp]=] "/usr/bin/mpiexec" "-n" "4" "api/init_fini")
+set_tests_properties([=[api/init_fini:mp]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/api/Testings.cmake;13;parsec_addtest_cmd;/root/repo/tests/api/Testings.cmake;0;;/root/repo/tests/Testings.cmake;3;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[api/compose:mp]=] "/usr/bin/mpiexec" "-n" "4" "api/compose")
+set_tests_properties([=[api/compose:mp]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/api/Testings.cmake;14;parsec_addtest_cmd;/root/repo/tests/api/Testings.cmake;0;;/root/repo/tests/Testings.cmake;3;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[api/operator:mp]=] "/usr/bin/mpiexec" "-n" "4" "api/operator")
+set_tests_properties([=[api/operator:mp]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/api/Testings.cmake;15;parsec_addtest_cmd;/root/repo/tests/api/Testings.cmake;0;;/root/repo/tests/Testings.cmake;3;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[api/taskpool_wait]=] "api/taskpool_wait/taskpool_wait")
+set_tests_properties([=[api/taskpool_wait]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/api/Testings.cmake;18;parsec_addtest_cmd;/root/repo/tests/api/Testings.cmake;0;;/root/repo/tests/Testings.cmake;3;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[api/taskpool_wait:mp]=] "/usr/bin/mpiexec" "-n" "8" "api/taskpool_wait/taskpool_wait")
+set_tests_properties([=[api/taskpool_wait:mp]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/api/Testings.cmake;20;parsec_addtest_cmd;/root/repo/tests/api/Testings.cmake;0;;/root/repo/tests/Testings.cmake;3;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[runtime/datatype_pack]=] "runtime/datatype_pack" "-n" "64" "-r" "10")
+set_tests_properties([=[runtime/datatype_pack]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/runtime/Testings.cmake;2;parsec_addtest_cmd;/root/repo/tests/runtime/Testings.cmake;0;;/root/repo/tests/Testings.cmake;4;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[runtime/comm_compress]=] "runtime/comm_compress" "--" "--mca" "runtime_comm_compress" "1")
+set_tests_properties([=[runtime/comm_compress]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/runtime/Testings.cmake;3;parsec_addtest_cmd;/root/repo/tests/runtime/Testings.cmake;0;;/root/repo/tests/Testings.cmake;4;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[runtime/comm_compress:mp]=] "/usr/bin/mpiexec" "-n" "4" "runtime/comm_compress" "--" "--mca" "runtime_comm_compress" "1")
+set_tests_properties([=[runtime/comm_compress:mp]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/runtime/Testings.cmake;4;parsec_addtest_cmd;/root/repo/tests/runtime/Testings.cmake;0;;/root/repo/tests/Testings.cmake;4;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[runtime/comm_compress:mp:raw]=] "/usr/bin/mpiexec" "-n" "4" "runtime/comm_compress")
+set_tests_properties([=[runtime/comm_compress:mp:raw]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/runtime/Testings.cmake;5;parsec_addtest_cmd;/root/repo/tests/runtime/Testings.cmake;0;;/root/repo/tests/Testings.cmake;4;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[runtime/remote_dep_ranks]=] "runtime/remote_dep_ranks" "-r" "1000")
+set_tests_properties([=[runtime/remote_dep_ranks]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/runtime/Testings.cmake;6;parsec_addtest_cmd;/root/repo/tests/runtime/Testings.cmake;0;;/root/repo/tests/Testings.cmake;4;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[runtime/remote_dep_link]=] "runtime/remote_dep_link")
+set_tests_properties([=[runtime/remote_dep_link]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/runtime/Testings.cmake;7;parsec_addtest_cmd;/root/repo/tests/runtime/Testings.cmake;0;;/root/repo/tests/Testings.cmake;4;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[runtime/inplace:mp]=] "/usr/bin/mpiexec" "-n" "4" "runtime/inplace" "--" "--mca" "runtime_comm_inplace" "1")
+set_tests_properties([=[runtime/inplace:mp]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/runtime/Testings.cmake;8;parsec_addtest_cmd;/root/repo/tests/runtime/Testings.cmake;0;;/root/repo/tests/Testings.cmake;4;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[runtime/inplace:mp:copy]=] "/usr/bin/mpiexec" "-n" "4" "runtime/inplace")
+set_tests_properties([=[runtime/inplace:mp:copy]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/runtime/Testings.cmake;9;parsec_addtest_cmd;/root/repo/tests/runtime/Testings.cmake;0;;/root/repo/tests/Testings.cmake;4;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[runtime/put_sched:mp]=] "/usr/bin/mpiexec" "-n" "2" "runtime/put_sched" "--" "--mca" "runtime_comm_put_max_bytes" "33554432" "--mca" "runtime_comm_put_peer_max_bytes" "8388608" "--mca" "runtime_comm_put_chunk" "2097152")
+set_tests_properties([=[runtime/put_sched:mp]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/runtime/Testings.cmake;10;parsec_addtest_cmd;/root/repo/tests/runtime/Testings.cmake;0;;/root/repo/tests/Testings.cmake;4;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[runtime/put_sched:mp:fifo]=] "/usr/bin/mpiexec" "-n" "2" "runtime/put_sched")
+set_tests_properties([=[runtime/put_sched:mp:fifo]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/runtime/Testings.cmake;11;parsec_addtest_cmd;/root/repo/tests/runtime/Testings.cmake;0;;/root/repo/tests/Testings.cmake;4;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[runtime/put_sched:mp:chunks]=] "/usr/bin/mpiexec" "-n" "3" "runtime/put_sched" "-t=4" "-b=512" "--" "--mca" "runtime_comm_put_chunk" "65536" "--mca" "runtime_comm_put_peer_max_bytes" "262144" "--mca" "runtime_comm_compress" "1")
+set_tests_properties([=[runtime/put_sched:mp:chunks]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/runtime/Testings.cmake;12;parsec_addtest_cmd;/root/repo/tests/runtime/Testings.cmake;0;;/root/repo/tests/Testings.cmake;4;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[runtime/put_sched:mp:stats]=] "/usr/bin/mpiexec" "-n" "2" "runtime/put_sched" "-t=4" "-b=512" "--" "--mca" "runtime_comm_stats" "1" "--mca" "runtime_comm_put_chunk" "65536")
+set_tests_properties([=[runtime/put_sched:mp:stats]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" FAIL_REGULAR_EXPRESSION "errors" PASS_REGULAR_EXPRESSION "Remote deps on rank [0-9]+: [1-9][0-9]* data" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/runtime/Testings.cmake;13;parsec_addtest_cmd;/root/repo/tests/runtime/Testings.cmake;0;;/root/repo/tests/Testings.cmake;4;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[runtime/host_placement:mp]=] "/usr/bin/mpiexec" "-n" "6" "runtime/host_placement" "--" "--mca" "runtime_comm_emulate_hosts" "2" "--mca" "runtime_comm_host_placement" "1")
+set_tests_properties([=[runtime/host_placement:mp]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/runtime/Testings.cmake;18;parsec_addtest_cmd;/root/repo/tests/runtime/Testings.cmake;0;;/root/repo/tests/Testings.cmake;4;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[runtime/host_placement:mp:plain]=] "/usr/bin/mpiexec" "-n" "6" "runtime/host_placement" "--" "--mca" "runtime_comm_emulate_hosts" "2")
+set_tests_properties([=[runtime/host_placement:mp:plain]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/runtime/Testings.cmake;19;parsec_addtest_cmd;/root/repo/tests/runtime/Testings.cmake;0;;/root/repo/tests/Testings.cmake;4;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[runtime/tcp_engine]=] "runtime/tcp_engine" "-n=3" "-b=16")
+set_tests_properties([=[runtime/tcp_engine]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/runtime/Testings.cmake;21;parsec_addtest_cmd;/root/repo/tests/runtime/Testings.cmake;0;;/root/repo/tests/Testings.cmake;4;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[runtime/tcp_engine:rdv]=] "runtime/tcp_engine" "-n=3" "-t=4" "-b=256" "--" "--mca" "runtime_comm_tcp_frag" "65536")
+set_tests_properties([=[runtime/tcp_engine:rdv]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_TCP_KEY=tcp_engine_rdv" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/runtime/Testings.cmake;22;parsec_addtest_cmd;/root/repo/tests/runtime/Testings.cmake;0;;/root/repo/tests/Testings.cmake;4;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[runtime/tcp_engine:short_adaptive]=] "runtime/tcp_engine" "-n=3" "-b=8" "--" "--mca" "runtime_comm_short_adaptive" "1")
+set_tests_properties([=[runtime/tcp_engine:short_adaptive]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/runtime/Testings.cmake;24;parsec_addtest_cmd;/root/repo/tests/runtime/Testings.cmake;0;;/root/repo/tests/Testings.cmake;4;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[runtime/scheduling:ap]=] "/usr/bin/mpiexec" "-n" "1" "runtime/scheduling/schedmicro" "-t" "10" "-l" "8" "-n" "512" "--" "--mca" "mca_sched" "ap")
+set_tests_properties([=[runtime/scheduling:ap]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/runtime/scheduling/Testings.cmake;2;parsec_addtest_cmd;/root/repo/tests/runtime/scheduling/Testings.cmake;0;;/root/repo/tests/runtime/Testings.cmake;32;include;/root/repo/tests/runtime/Testings.cmake;0;;/root/repo/tests/Testings.cmake;4;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[runtime/scheduling:stats:ap]=] "/usr/bin/mpiexec" "-n" "1" "runtime/scheduling/schedmicro" "-t" "2" "-l" "8" "-n" "512" "--" "--mca" "mca_sched" "ap" "--mca" "runtime_sched_stats" "1")
+set_tests_properties([=[runtime/scheduling:stats:ap]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/runtime/scheduling/Testings.cmake;3;parsec_addtest_cmd;/root/repo/tests/runtime/scheduling/Testings.cmake;0;;/root/repo/tests/runtime/Testings.cmake;32;include;/root/repo/tests/runtime/Testings.cmake;0;;/root/repo/tests/Testings.cmake;4;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[runtime/scheduling:locality:ap]=] "/usr/bin/mpiexec" "-n" "1" "runtime/scheduling/locality" "-n=16" "-i=4" "-b=64" "-t=2" "--" "--mca" "mca_sched" "ap")
+set_tests_properties([=[runtime/scheduling:locality:ap]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/runtime/scheduling/Testings.cmake;5;parsec_addtest_cmd;/root/repo/tests/runtime/scheduling/Testings.cmake;0;;/root/repo/tests/runtime/Testings.cmake;32;include;/root/repo/tests/runtime/Testings.cmake;0;;/root/repo/tests/Testings.cmake;4;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[runtime/scheduling:gd]=] "/usr/bin/mpiexec" "-n" "1" "runtime/scheduling/schedmicro" "-t" "10" "-l" "8" "-n" "512" "--" "--mca" "mca_sched" "gd")
+set_tests_properties([=[runtime/scheduling:gd]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/runtime/scheduling/Testings.cmake;2;parsec_addtest_cmd;/root/repo/tests/runtime/scheduling/Testings.cmake;0;;/root/repo/tests/runtime/Testings.cmake;32;include;/root/repo/tests/runtime/Testings.cmake;0;;/root/repo/tests/Testings.cmake;4;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[runtime/scheduling:stats:gd]=] "/usr/bin/mpiexec" "-n" "1" "runtime/scheduling/schedmicro" "-t" "2" "-l" "8" "-n" "512" "--" "--mca" "mca_sched" "gd" "--mca" "runtime_sched_stats" "1")
+set_tests_properties([=[runtime/scheduling:stats:gd]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/runtime/scheduling/Testings.cmake;3;parsec_addtest_cmd;/root/repo/tests/runtime/scheduling/Testings.cmake;0;;/root/repo/tests/runtime/Testings.cmake;32;include;/root/repo/tests/runtime/Testings.cmake;0;;/root/repo/tests/Testings.cmake;4;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[runtime/scheduling:locality:gd]=] "/usr/bin/mpiexec" "-n" "1" "runtime/scheduling/locality" "-n=16" "-i=4" "-b=64" "-t=2" "--" "--mca" "mca_sched" "gd")
+set_tests_properties([=[runtime/scheduling:locality:gd]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/runtime/scheduling/Testings.cmake;5;parsec_addtest_cmd;/root/repo/tests/runtime/scheduling/Testings.cmake;0;;/root/repo/tests/runtime/Testings.cmake;32;include;/root/repo/tests/runtime/Testings.cmake;0;;/root/repo/tests/Testings.cmake;4;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[runtime/scheduling:ip]=] "/usr/bin/mpiexec" "-n" "1" "runtime/scheduling/schedmicro" "-t" "10" "-l" "8" "-n" "512" "--" "--mca" "mca_sched" "ip")
+set_tests_properties([=[runtime/scheduling:ip]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/runtime/scheduling/Testings.cmake;2;parsec_addtest_cmd;/root/repo/tests/runtime/scheduling/Testings.cmake;0;;/root/repo/tests/runtime/Testings.cmake;32;include;/root/repo/tests/runtime/Testings.cmake;0;;/root/repo/tests/Testings.cmake;4;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[runtime/scheduling:stats:ip]=] "/usr/bin/mpiexec" "-n" "1" "runtime/scheduling/schedmicro" "-t" "2" "-l" "8" "-n" "512" "--" "--mca" "mca_sched" "ip" "--mca" "runtime_sched_stats" "1")
+set_tests_properties([=[runtime/scheduling:stats:ip]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/runtime/scheduling/Testings.cmake;3;parsec_addtest_cmd;/root/repo/tests/runtime/scheduling/Testings.cmake;0;;/root/repo/tests/runtime/Testings.cmake;32;include;/root/repo/tests/runtime/Testings.cmake;0;;/root/repo/tests/Testings.cmake;4;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[runtime/scheduling:locality:ip]=] "/usr/bin/mpiexec" "-n" "1" "runtime/scheduling/locality" "-n=16" "-i=4" "-b=64" "-t=2" "--" "--mca" "mca_sched" "ip")
+set_tests_properties([=[runtime/scheduling:locality:ip]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/runtime/scheduling/Testings.cmake;5;parsec_addtest_cmd;/root/repo/tests/runtime/scheduling/Testings.cmake;0;;/root/repo/tests/runtime/Testings.cmake;32;include;/root/repo/tests/runtime/Testings.cmake;0;;/root/repo/tests/Testings.cmake;4;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[runtime/scheduling:la]=] "/usr/bin/mpiexec" "-n" "1" "runtime/scheduling/schedmicro" "-t" "10" "-l" "8" "-n" "512" "--" "--mca" "mca_sched" "la")
+set_tests_properties([=[runtime/scheduling:la]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/runtime/scheduling/Testings.cmake;2;parsec_addtest_cmd;/root/repo/tests/runtime/scheduling/Testings.cmake;0;;/root/repo/tests/runtime/Testings.cmake;32;include;/root/repo/tests/runtime/Testings.cmake;0;;/root/repo/tests/Testings.cmake;4;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[runtime/scheduling:stats:la]=] "/usr/bin/mpiexec" "-n" "1" "runtime/scheduling/schedmicro" "-t" "2" "-l" "8" "-n" "512" "--" "--mca" "mca_sched" "la" "--mca" "runtime_sched_stats" "1")
+set_tests_properties([=[runtime/scheduling:stats:la]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/runtime/scheduling/Testings.cmake;3;parsec_addtest_cmd;/root/repo/tests/runtime/scheduling/Testings.cmake;0;;/root/repo/tests/runtime/Testings.cmake;32;include;/root/repo/tests/runtime/Testings.cmake;0;;/root/repo/tests/Testings.cmake;4;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[runtime/scheduling:locality:la]=] "/usr/bin/mpiexec" "-n" "1" "runtime/scheduling/locality" "-n=16" "-i=4" "-b=64" "-t=2" "--" "--mca" "mca_sched" "la")
+set_tests_properties([=[runtime/scheduling:locality:la]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/runtime/scheduling/Testings.cmake;5;parsec_addtest_cmd;/root/repo/tests/runtime/scheduling/Testings.cmake;0;;/root/repo/tests/runtime/Testings.cmake;32;include;/root/repo/tests/runtime/Testings.cmake;0;;/root/repo/tests/Testings.cmake;4;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[runtime/scheduling:lfq]=] "/usr/bin/mpiexec" "-n" "1" "runtime/scheduling/schedmicro" "-t" "10" "-l" "8" "-n" "512" "--" "--mca" "mca_sched" "lfq")
+set_tests_properties([=[runtime/scheduling:lfq]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/runtime/scheduling/Testings.cmake;2;parsec_addtest_cmd;/root/repo/tests/runtime/scheduling/Testings.cmake;0;;/root/repo/tests/runtime/Testings.cmake;32;include;/root/repo/tests/runtime/Testings.cmake;0;;/root/repo/tests/Testings.cmake;4;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[runtime/scheduling:stats:lfq]=] "/usr/bin/mpiexec" "-n" "1" "runtime/scheduling/schedmicro" "-t" "2" "-l" "8" "-n" "512" "--" "--mca" "mca_sched" "lfq" "--mca" "runtime_sched_stats" "1")
+set_tests_properties([=[runtime/scheduling:stats:lfq]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/runtime/scheduling/Testings.cmake;3;parsec_addtest_cmd;/root/repo/tests/runtime/scheduling/Testings.cmake;0;;/root/repo/tests/runtime/Testings.cmake;32;include;/root/repo/tests/runtime/Testings.cmake;0;;/root/repo/tests/Testings.cmake;4;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[runtime/scheduling:locality:lfq]=] "/usr/bin/mpiexec" "-n" "1" "runtime/scheduling/locality" "-n=16" "-i=4" "-b=64" "-t=2" "--" "--mca" "mca_sched" "lfq")
+set_tests_properties([=[runtime/scheduling:locality:lfq]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/runtime/scheduling/Testings.cmake;5;parsec_addtest_cmd;/root/repo/tests/runtime/scheduling/Testings.cmake;0;;/root/repo/tests/runtime/Testings.cmake;32;include;/root/repo/tests/runtime/Testings.cmake;0;;/root/repo/tests/Testings.cmake;4;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[runtime/scheduling:lhq]=] "/usr/bin/mpiexec" "-n" "1" "runtime/scheduling/schedmicro" "-t" "10" "-l" "8" "-n" "512" "--" "--mca" "mca_sched" "lhq")
+set_tests_properties([=[runtime/scheduling:lhq]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/runtime/scheduling/Testings.cmake;2;parsec_addtest_cmd;/root/repo/tests/runtime/scheduling/Testings.cmake;0;;/root/repo/tests/runtime/Testings.cmake;32;include;/root/repo/tests/runtime/Testings.cmake;0;;/root/repo/tests/Testings.cmake;4;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[runtime/scheduling:stats:lhq]=] "/usr/bin/mpiexec" "-n" "1" "runtime/scheduling/schedmicro" "-t" "2" "-l" "8" "-n" "512" "--" "--mca" "mca_sched" "lhq" "--mca" "runtime_sched_stats" "1")
+set_tests_properties([=[runtime/scheduling:stats:lhq]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/runtime/scheduling/Testings.cmake;3;parsec_addtest_cmd;/root/repo/tests/runtime/scheduling/Testings.cmake;0;;/root/repo/tests/runtime/Testings.cmake;32;include;/root/repo/tests/runtime/Testings.cmake;0;;/root/repo/tests/Testings.cmake;4;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[runtime/scheduling:locality:lhq]=] "/usr/bin/mpiexec" "-n" "1" "runtime/scheduling/locality" "-n=16" "-i=4" "-b=64" "-t=2" "--" "--mca" "mca_sched" "lhq")
+set_tests_properties([=[runtime/scheduling:locality:lhq]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/runtime/scheduling/Testings.cmake;5;parsec_addtest_cmd;/root/repo/tests/runtime/scheduling/Testings.cmake;0;;/root/repo/tests/runtime/Testings.cmake;32;include;/root/repo/tests/runtime/Testings.cmake;0;;/root/repo/tests/Testings.cmake;4;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[runtime/scheduling:ll]=] "/usr/bin/mpiexec" "-n" "1" "runtime/scheduling/schedmicro" "-t" "10" "-l" "8" "-n" "512" "--" "--mca" "mca_sched" "ll")
+set_tests_properties([=[runtime/scheduling:ll]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/runtime/scheduling/Testings.cmake;2;parsec_addtest_cmd;/root/repo/tests/runtime/scheduling/Testings.cmake;0;;/root/repo/tests/runtime/Testings.cmake;32;include;/root/repo/tests/runtime/Testings.cmake;0;;/root/repo/tests/Testings.cmake;4;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[runtime/scheduling:stats:ll]=] "/usr/bin/mpiexec" "-n" "1" "runtime/scheduling/schedmicro" "-t" "2" "-l" "8" "-n" "512" "--" "--mca" "mca_sched" "ll" "--mca" "runtime_sched_stats" "1")
+set_tests_properties([=[runtime/scheduling:stats:ll]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/runtime/scheduling/Testings.cmake;3;parsec_addtest_cmd;/root/repo/tests/runtime/scheduling/Testings.cmake;0;;/root/repo/tests/runtime/Testings.cmake;32;include;/root/repo/tests/runtime/Testings.cmake;0;;/root/repo/tests/Testings.cmake;4;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[runtime/scheduling:locality:ll]=] "/usr/bin/mpiexec" "-n" "1" "runtime/scheduling/locality" "-n=16" "-i=4" "-b=64" "-t=2" "--" "--mca" "mca_sched" "ll")
+set_tests_properties([=[runtime/scheduling:locality:ll]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/runtime/scheduling/Testings.cmake;5;parsec_addtest_cmd;/root/repo/tests/runtime/scheduling/Testings.cmake;0;;/root/repo/tests/runtime/Testings.cmake;32;include;/root/repo/tests/runtime/Testings.cmake;0;;/root/repo/tests/Testings.cmake;4;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[runtime/scheduling:llp]=] "/usr/bin/mpiexec" "-n" "1" "runtime/scheduling/schedmicro" "-t" "10" "-l" "8" "-n" "512" "--" "--mca" "mca_sched" "llp")
+set_tests_properties([=[runtime/scheduling:llp]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/runtime/scheduling/Testings.cmake;2;parsec_addtest_cmd;/root/repo/tests/runtime/scheduling/Testings.cmake;0;;/root/repo/tests/runtime/Testings.cmake;32;include;/root/repo/tests/runtime/Testings.cmake;0;;/root/repo/tests/Testings.cmake;4;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[runtime/scheduling:stats:llp]=] "/usr/bin/mpiexec" "-n" "1" "runtime/scheduling/schedmicro" "-t" "2" "-l" "8" "-n" "512" "--" "--mca" "mca_sched" "llp" "--mca" "runtime_sched_stats" "1")
+set_tests_properties([=[runtime/scheduling:stats:llp]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/runtime/scheduling/Testings.cmake;3;parsec_addtest_cmd;/root/repo/tests/runtime/scheduling/Testings.cmake;0;;/root/repo/tests/runtime/Testings.cmake;32;include;/root/repo/tests/runtime/Testings.cmake;0;;/root/repo/tests/Testings.cmake;4;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[runtime/scheduling:locality:llp]=] "/usr/bin/mpiexec" "-n" "1" "runtime/scheduling/locality" "-n=16" "-i=4" "-b=64" "-t=2" "--" "--mca" "mca_sched" "llp")
+set_tests_properties([=[runtime/scheduling:locality:llp]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/runtime/scheduling/Testings.cmake;5;parsec_addtest_cmd;/root/repo/tests/runtime/scheduling/Testings.cmake;0;;/root/repo/tests/runtime/Testings.cmake;32;include;/root/repo/tests/runtime/Testings.cmake;0;;/root/repo/tests/Testings.cmake;4;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[runtime/scheduling:ltq]=] "/usr/bin/mpiexec" "-n" "1" "runtime/scheduling/schedmicro" "-t" "10" "-l" "8" "-n" "512" "--" "--mca" "mca_sched" "ltq")
+set_tests_properties([=[runtime/scheduling:ltq]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/runtime/scheduling/Testings.cmake;2;parsec_addtest_cmd;/root/repo/tests/runtime/scheduling/Testings.cmake;0;;/root/repo/tests/runtime/Testings.cmake;32;include;/root/repo/tests/runtime/Testings.cmake;0;;/root/repo/tests/Testings.cmake;4;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[runtime/scheduling:stats:ltq]=] "/usr/bin/mpiexec" "-n" "1" "runtime/scheduling/schedmicro" "-t" "2" "-l" "8" "-n" "512" "--" "--mca" "mca_sched" "ltq" "--mca" "runtime_sched_stats" "1")
+set_tests_properties([=[runtime/scheduling:stats:ltq]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/runtime/scheduling/Testings.cmake;3;parsec_addtest_cmd;/root/repo/tests/runtime/scheduling/Testings.cmake;0;;/root/repo/tests/runtime/Testings.cmake;32;include;/root/repo/tests/runtime/Testings.cmake;0;;/root/repo/tests/Testings.cmake;4;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[runtime/scheduling:locality:ltq]=] "/usr/bin/mpiexec" "-n" "1" "runtime/scheduling/locality" "-n=16" "-i=4" "-b=64" "-t=2" "--" "--mca" "mca_sched" "ltq")
+set_tests_properties([=[runtime/scheduling:locality:ltq]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/runtime/scheduling/Testings.cmake;5;parsec_addtest_cmd;/root/repo/tests/runtime/scheduling/Testings.cmake;0;;/root/repo/tests/runtime/Testings.cmake;32;include;/root/repo/tests/runtime/Testings.cmake;0;;/root/repo/tests/Testings.cmake;4;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[runtime/scheduling:pbq]=] "/usr/bin/mpiexec" "-n" "1" "runtime/scheduling/schedmicro" "-t" "10" "-l" "8" "-n" "512" "--" "--mca" "mca_sched" "pbq")
+set_tests_properties([=[runtime/scheduling:pbq]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/runtime/scheduling/Testings.cmake;2;parsec_addtest_cmd;/root/repo/tests/runtime/scheduling/Testings.cmake;0;;/root/repo/tests/runtime/Testings.cmake;32;include;/root/repo/tests/runtime/Testings.cmake;0;;/root/repo/tests/Testings.cmake;4;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[runtime/scheduling:stats:pbq]=] "/usr/bin/mpiexec" "-n" "1" "runtime/scheduling/schedmicro" "-t" "2" "-l" "8" "-n" "512" "--" "--mca" "mca_sched" "pbq" "--mca" "runtime_sched_stats" "1")
+set_tests_properties([=[runtime/scheduling:stats:pbq]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/runtime/scheduling/Testings.cmake;3;parsec_addtest_cmd;/root/repo/tests/runtime/scheduling/Testings.cmake;0;;/root/repo/tests/runtime/Testings.cmake;32;include;/root/repo/tests/runtime/Testings.cmake;0;;/root/repo/tests/Testings.cmake;4;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[runtime/scheduling:locality:pbq]=] "/usr/bin/mpiexec" "-n" "1" "runtime/scheduling/locality" "-n=16" "-i=4" "-b=64" "-t=2" "--" "--mca" "mca_sched" "pbq")
+set_tests_properties([=[runtime/scheduling:locality:pbq]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/runtime/scheduling/Testings.cmake;5;parsec_addtest_cmd;/root/repo/tests/runtime/scheduling/Testings.cmake;0;;/root/repo/tests/runtime/Testings.cmake;32;include;/root/repo/tests/runtime/Testings.cmake;0;;/root/repo/tests/Testings.cmake;4;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[runtime/scheduling:rnd]=] "/usr/bin/mpiexec" "-n" "1" "runtime/scheduling/schedmicro" "-t" "10" "-l" "8" "-n" "512" "--" "--mca" "mca_sched" "rnd")
+set_tests_properties([=[runtime/scheduling:rnd]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/runtime/scheduling/Testings.cmake;2;parsec_addtest_cmd;/root/repo/tests/runtime/scheduling/Testings.cmake;0;;/root/repo/tests/runtime/Testings.cmake;32;include;/root/repo/tests/runtime/Testings.cmake;0;;/root/repo/tests/Testings.cmake;4;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[runtime/scheduling:stats:rnd]=] "/usr/bin/mpiexec" "-n" "1" "runtime/scheduling/schedmicro" "-t" "2" "-l" "8" "-n" "512" "--" "--mca" "mca_sched" "rnd" "--mca" "runtime_sched_stats" "1")
+set_tests_properties([=[runtime/scheduling:stats:rnd]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/runtime/scheduling/Testings.cmake;3;parsec_addtest_cmd;/root/repo/tests/runtime/scheduling/Testings.cmake;0;;/root/repo/tests/runtime/Testings.cmake;32;include;/root/repo/tests/runtime/Testings.cmake;0;;/root/repo/tests/Testings.cmake;4;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[runtime/scheduling:locality:rnd]=] "/usr/bin/mpiexec" "-n" "1" "runtime/scheduling/locality" "-n=16" "-i=4" "-b=64" "-t=2" "--" "--mca" "mca_sched" "rnd")
+set_tests_properties([=[runtime/scheduling:locality:rnd]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/runtime/scheduling/Testings.cmake;5;parsec_addtest_cmd;/root/repo/tests/runtime/scheduling/Testings.cmake;0;;/root/repo/tests/runtime/Testings.cmake;32;include;/root/repo/tests/runtime/Testings.cmake;0;;/root/repo/tests/Testings.cmake;4;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[runtime/scheduling:spq]=] "/usr/bin/mpiexec" "-n" "1" "runtime/scheduling/schedmicro" "-t" "10" "-l" "8" "-n" "512" "--" "--mca" "mca_sched" "spq")
+set_tests_properties([=[runtime/scheduling:spq]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/runtime/scheduling/Testings.cmake;2;parsec_addtest_cmd;/root/repo/tests/runtime/scheduling/Testings.cmake;0;;/root/repo/tests/runtime/Testings.cmake;32;include;/root/repo/tests/runtime/Testings.cmake;0;;/root/repo/tests/Testings.cmake;4;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[runtime/scheduling:stats:spq]=] "/usr/bin/mpiexec" "-n" "1" "runtime/scheduling/schedmicro" "-t" "2" "-l" "8" "-n" "512" "--" "--mca" "mca_sched" "spq" "--mca" "runtime_sched_stats" "1")
+set_tests_properties([=[runtime/scheduling:stats:spq]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/runtime/scheduling/Testings.cmake;3;parsec_addtest_cmd;/root/repo/tests/runtime/scheduling/Testings.cmake;0;;/root/repo/tests/runtime/Testings.cmake;32;include;/root/repo/tests/runtime/Testings.cmake;0;;/root/repo/tests/Testings.cmake;4;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[runtime/scheduling:locality:spq]=] "/usr/bin/mpiexec" "-n" "1" "runtime/scheduling/locality" "-n=16" "-i=4" "-b=64" "-t=2" "--" "--mca" "mca_sched" "spq")
+set_tests_properties([=[runtime/scheduling:locality:spq]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/runtime/scheduling/Testings.cmake;5;parsec_addtest_cmd;/root/repo/tests/runtime/scheduling/Testings.cmake;0;;/root/repo/tests/runtime/Testings.cmake;32;include;/root/repo/tests/runtime/Testings.cmake;0;;/root/repo/tests/Testings.cmake;4;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[runtime/scheduling:park]=] "/usr/bin/mpiexec" "-n" "1" "runtime/scheduling/schedmicro" "-t" "10" "-l" "8" "-n" "512" "--" "--mca" "runtime_idle_policy" "park" "--mca" "runtime_idle_stats" "1")
+set_tests_properties([=[runtime/scheduling:park]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/runtime/scheduling/Testings.cmake;7;parsec_addtest_cmd;/root/repo/tests/runtime/scheduling/Testings.cmake;0;;/root/repo/tests/runtime/Testings.cmake;32;include;/root/repo/tests/runtime/Testings.cmake;0;;/root/repo/tests/Testings.cmake;4;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[runtime/scheduling:mp:ap]=] "/usr/bin/mpiexec" "-n" "2" "runtime/scheduling/schedmicro" "-t" "10" "-l" "8" "-n" "512" "--" "--mca" "mca_sched" "ap")
+set_tests_properties([=[runtime/scheduling:mp:ap]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/runtime/scheduling/Testings.cmake;11;parsec_addtest_cmd;/root/repo/tests/runtime/scheduling/Testings.cmake;0;;/root/repo/tests/runtime/Testings.cmake;32;include;/root/repo/tests/runtime/Testings.cmake;0;;/root/repo/tests/Testings.cmake;4;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[runtime/scheduling:mp:gd]=] "/usr/bin/mpiexec" "-n" "2" "runtime/scheduling/schedmicro" "-t" "10" "-l" "8" "-n" "512" "--" "--mca" "mca_sched" "gd")
+set_tests_properties([=[runtime/scheduling:mp:gd]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/runtime/scheduling/Testings.cmake;11;parsec_addtest_cmd;/root/repo/tests/runtime/scheduling/Testings.cmake;0;;/root/repo/tests/runtime/Testings.cmake;32;include;/root/repo/tests/runtime/Testings.cmake;0;;/root/repo/tests/Testings.cmake;4;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[runtime/scheduling:mp:ip]=] "/usr/bin/mpiexec" "-n" "2" "runtime/scheduling/schedmicro" "-t" "10" "-l" "8" "-n" "512" "--" "--mca" "mca_sched" "ip")
+set_tests_properties([=[runtime/scheduling:mp:ip]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/runtime/scheduling/Testings.cmake;11;parsec_addtest_cmd;/root/repo/tests/runtime/scheduling/Testings.cmake;0;;/root/repo/tests/runtime/Testings.cmake;32;include;/root/repo/tests/runtime/Testings.cmake;0;;/root/repo/tests/Testings.cmake;4;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[runtime/scheduling:mp:la]=] "/usr/bin/mpiexec" "-n" "2" "runtime/scheduling/schedmicro" "-t" "10" "-l" "8" "-n" "512" "--" "--mca" "mca_sched" "la")
+set_tests_properties([=[runtime/scheduling:mp:la]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/runtime/scheduling/Testings.cmake;11;parsec_addtest_cmd;/root/repo/tests/runtime/scheduling/Testings.cmake;0;;/root/repo/tests/runtime/Testings.cmake;32;include;/root/repo/tests/runtime/Testings.cmake;0;;/root/repo/tests/Testings.cmake;4;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[runtime/scheduling:mp:lfq]=] "/usr/bin/mpiexec" "-n" "2" "runtime/scheduling/schedmicro" "-t" "10" "-l" "8" "-n" "512" "--" "--mca" "mca_sched" "lfq")
+set_tests_properties([=[runtime/scheduling:mp:lfq]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/runtime/scheduling/Testings.cmake;11;parsec_addtest_cmd;/root/repo/tests/runtime/scheduling/Testings.cmake;0;;/root/repo/tests/runtime/Testings.cmake;32;include;/root/repo/tests/runtime/Testings.cmake;0;;/root/repo/tests/Testings.cmake;4;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[runtime/scheduling:mp:lhq]=] "/usr/bin/mpiexec" "-n" "2" "runtime/scheduling/schedmicro" "-t" "10" "-l" "8" "-n" "512" "--" "--mca" "mca_sched" "lhq")
+set_tests_properties([=[runtime/scheduling:mp:lhq]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/runtime/scheduling/Testings.cmake;11;parsec_addtest_cmd;/root/repo/tests/runtime/scheduling/Testings.cmake;0;;/root/repo/tests/runtime/Testings.cmake;32;include;/root/repo/tests/runtime/Testings.cmake;0;;/root/repo/tests/Testings.cmake;4;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[runtime/scheduling:mp:ll]=] "/usr/bin/mpiexec" "-n" "2" "runtime/scheduling/schedmicro" "-t" "10" "-l" "8" "-n" "512" "--" "--mca" "mca_sched" "ll")
+set_tests_properties([=[runtime/scheduling:mp:ll]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/runtime/scheduling/Testings.cmake;11;parsec_addtest_cmd;/root/repo/tests/runtime/scheduling/Testings.cmake;0;;/root/repo/tests/runtime/Testings.cmake;32;include;/root/repo/tests/runtime/Testings.cmake;0;;/root/repo/tests/Testings.cmake;4;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[runtime/scheduling:mp:llp]=] "/usr/bin/mpiexec" "-n" "2" "runtime/scheduling/schedmicro" "-t" "10" "-l" "8" "-n" "512" "--" "--mca" "mca_sched" "llp")
+set_tests_properties([=[runtime/scheduling:mp:llp]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/runtime/scheduling/Testings.cmake;11;parsec_addtest_cmd;/root/repo/tests/runtime/scheduling/Testings.cmake;0;;/root/repo/tests/runtime/Testings.cmake;32;include;/root/repo/tests/runtime/Testings.cmake;0;;/root/repo/tests/Testings.cmake;4;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[runtime/scheduling:mp:ltq]=] "/usr/bin/mpiexec" "-n" "2" "runtime/scheduling/schedmicro" "-t" "10" "-l" "8" "-n" "512" "--" "--mca" "mca_sched" "ltq")
+set_tests_properties([=[runtime/scheduling:mp:ltq]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/runtime/scheduling/Testings.cmake;11;parsec_addtest_cmd;/root/repo/tests/runtime/scheduling/Testings.cmake;0;;/root/repo/tests/runtime/Testings.cmake;32;include;/root/repo/tests/runtime/Testings.cmake;0;;/root/repo/tests/Testings.cmake;4;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[runtime/scheduling:mp:pbq]=] "/usr/bin/mpiexec" "-n" "2" "runtime/scheduling/schedmicro" "-t" "10" "-l" "8" "-n" "512" "--" "--mca" "mca_sched" "pbq")
+set_tests_properties([=[runtime/scheduling:mp:pbq]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/runtime/scheduling/Testings.cmake;11;parsec_addtest_cmd;/root/repo/tests/runtime/scheduling/Testings.cmake;0;;/root/repo/tests/runtime/Testings.cmake;32;include;/root/repo/tests/runtime/Testings.cmake;0;;/root/repo/tests/Testings.cmake;4;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[runtime/scheduling:mp:rnd]=] "/usr/bin/mpiexec" "-n" "2" "runtime/scheduling/schedmicro" "-t" "10" "-l" "8" "-n" "512" "--" "--mca" "mca_sched" "rnd")
+set_tests_properties([=[runtime/scheduling:mp:rnd]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/runtime/scheduling/Testings.cmake;11;parsec_addtest_cmd;/root/repo/tests/runtime/scheduling/Testings.cmake;0;;/root/repo/tests/runtime/Testings.cmake;32;include;/root/repo/tests/runtime/Testings.cmake;0;;/root/repo/tests/Testings.cmake;4;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[runtime/scheduling:mp:spq]=] "/usr/bin/mpiexec" "-n" "2" "runtime/scheduling/schedmicro" "-t" "10" "-l" "8" "-n" "512" "--" "--mca" "mca_sched" "spq")
+set_tests_properties([=[runtime/scheduling:mp:spq]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/runtime/scheduling/Testings.cmake;11;parsec_addtest_cmd;/root/repo/tests/runtime/scheduling/Testings.cmake;0;;/root/repo/tests/runtime/Testings.cmake;32;include;/root/repo/tests/runtime/Testings.cmake;0;;/root/repo/tests/Testings.cmake;4;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[collections/reduce]=] "collections/reduce")
+set_tests_properties([=[collections/reduce]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/collections/Testings.cmake;2;parsec_addtest_cmd;/root/repo/tests/collections/Testings.cmake;0;;/root/repo/tests/Testings.cmake;5;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[collections/matrix_io]=] "collections/matrix_io")
+set_tests_properties([=[collections/matrix_io]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/collections/Testings.cmake;3;parsec_addtest_cmd;/root/repo/tests/collections/Testings.cmake;0;;/root/repo/tests/Testings.cmake;5;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[collections/matrix_io:mp]=] "/usr/bin/mpiexec" "-n" "3" "collections/matrix_io")
+set_tests_properties([=[collections/matrix_io:mp]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/collections/Testings.cmake;5;parsec_addtest_cmd;/root/repo/tests/collections/Testings.cmake;0;;/root/repo/tests/Testings.cmake;5;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[collections/replicated]=] "collections/replicated")
+set_tests_properties([=[collections/replicated]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/collections/Testings.cmake;7;parsec_addtest_cmd;/root/repo/tests/collections/Testings.cmake;0;;/root/repo/tests/Testings.cmake;5;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[collections/replicated:mp]=] "/usr/bin/mpiexec" "-n" "4" "collections/replicated" "-c" "2")
+set_tests_properties([=[collections/replicated:mp]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/collections/Testings.cmake;9;parsec_addtest_cmd;/root/repo/tests/collections/Testings.cmake;0;;/root/repo/tests/Testings.cmake;5;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[collections/replicated:mp:3d]=] "/usr/bin/mpiexec" "-n" "4" "collections/replicated" "-c" "4")
+set_tests_properties([=[collections/replicated:mp:3d]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/collections/Testings.cmake;10;parsec_addtest_cmd;/root/repo/tests/collections/Testings.cmake;0;;/root/repo/tests/Testings.cmake;5;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[collections/redistribute:mp]=] "/usr/bin/mpiexec" "-n" "8" "collections/redistribute/testing_redistribute" "-M" "2400" "-N" "2400" "-a" "2400" "-A" "2400" "-t" "300" "-T" "300" "-b" "200" "-B" "200" "-m" "2000" "-n" "2000" "-I" "30" "-J" "40" "-i" "100" "-j" "121" "-v" "-z" "-x" "-P" "2" "-Q" "4" "-p" "4" "-q" "2")
+set_tests_properties([=[collections/redistribute:mp]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/collections/Testings.cmake;14;parsec_addtest_cmd;/root/repo/tests/collections/Testings.cmake;0;;/root/repo/tests/Testings.cmake;5;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[collections/redistribute_random:mp]=] "/usr/bin/mpiexec" "-n" "8" "collections/redistribute/testing_redistribute_random" "-M" "2400" "-N" "2400" "-a" "2400" "-A" "2400" "-t" "300" "-T" "300" "-b" "200" "-B" "200" "-m" "2000" "-n" "2000" "-I" "30" "-J" "40" "-i" "100" "-j" "121" "-v" "-z" "-x" "-P" "2" "-Q" "4" "-p" "4" "-q" "2")
+set_tests_properties([=[collections/redistribute_random:mp]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/collections/Testings.cmake;15;parsec_addtest_cmd;/root/repo/tests/collections/Testings.cmake;0;;/root/repo/tests/Testings.cmake;5;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[collections/rebalance]=] "collections/redistribute/testing_rebalance")
+set_tests_properties([=[collections/rebalance]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/collections/Testings.cmake;21;parsec_addtest_cmd;/root/repo/tests/collections/Testings.cmake;0;;/root/repo/tests/Testings.cmake;5;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[collections/rebalance:mp]=] "/usr/bin/mpiexec" "-n" "3" "collections/redistribute/testing_rebalance")
+set_tests_properties([=[collections/rebalance:mp]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/collections/Testings.cmake;23;parsec_addtest_cmd;/root/repo/tests/collections/Testings.cmake;0;;/root/repo/tests/Testings.cmake;5;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[collections/reshape]=] "collections/reshape/reshape" "-N" "120" "-t" "9" "-c" "10")
+set_tests_properties([=[collections/reshape]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/collections/Testings.cmake;26;parsec_addtest_cmd;/root/repo/tests/collections/Testings.cmake;0;;/root/repo/tests/Testings.cmake;5;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[collections/reshape:mt]=] "collections/reshape/reshape" "-N" "120" "-t" "9" "-c" "10" "-m" "1")
+set_tests_properties([=[collections/reshape:mt]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/collections/Testings.cmake;27;parsec_addtest_cmd;/root/repo/tests/collections/Testings.cmake;0;;/root/repo/tests/Testings.cmake;5;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[collections/reshape:mp]=] "/usr/bin/mpiexec" "-n" "4" "collections/reshape/reshape" "-N" "120" "-t" "9" "-c" "10")
+set_tests_properties([=[collections/reshape:mp]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/collections/Testings.cmake;29;parsec_addtest_cmd;/root/repo/tests/collections/Testings.cmake;0;;/root/repo/tests/Testings.cmake;5;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[collections/reshape:mp:mt]=] "/usr/bin/mpiexec" "-n" "4" "collections/reshape/reshape" "-N" "120" "-t" "9" "-c" "10" "-m" "1")
+set_tests_properties([=[collections/reshape:mp:mt]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/collections/Testings.cmake;30;parsec_addtest_cmd;/root/repo/tests/collections/Testings.cmake;0;;/root/repo/tests/Testings.cmake;5;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[collections/reshape/input_single_copy]=] "collections/reshape/input_dep_reshape_single_copy" "-N" "12" "-t" "2" "-c" "2")
+set_tests_properties([=[collections/reshape/input_single_copy]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/collections/Testings.cmake;33;parsec_addtest_cmd;/root/repo/tests/collections/Testings.cmake;0;;/root/repo/tests/Testings.cmake;5;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[collections/reshape/input_single_copy:mt]=] "collections/reshape/input_dep_reshape_single_copy" "-N" "12" "-t" "2" "-c" "2" "-m" "1")
+set_tests_properties([=[collections/reshape/input_single_copy:mt]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/collections/Testings.cmake;34;parsec_addtest_cmd;/root/repo/tests/collections/Testings.cmake;0;;/root/repo/tests/Testings.cmake;5;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[collections/reshape/input_single_copy:mp]=] "/usr/bin/mpiexec" "-n" "4" "collections/reshape/input_dep_reshape_single_copy" "-N" "12" "-t" "2" "-c" "2")
+set_tests_properties([=[collections/reshape/input_single_copy:mp]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/collections/Testings.cmake;36;parsec_addtest_cmd;/root/repo/tests/collections/Testings.cmake;0;;/root/repo/tests/Testings.cmake;5;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[collections/reshape/input_single_copy:mp:mt]=] "/usr/bin/mpiexec" "-n" "4" "collections/reshape/input_dep_reshape_single_copy" "-N" "12" "-t" "2" "-c" "2" "-m" "1")
+set_tests_properties([=[collections/reshape/input_single_copy:mp:mt]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/collections/Testings.cmake;37;parsec_addtest_cmd;/root/repo/tests/collections/Testings.cmake;0;;/root/repo/tests/Testings.cmake;5;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[collections/reshape/remote_multiple_outs_same_pred_flow]=] "collections/reshape/remote_multiple_outs_same_pred_flow" "-N" "320" "-t" "9" "-c" "10" "--" "--mca" "runtime_comm_short_limit" "0")
+set_tests_properties([=[collections/reshape/remote_multiple_outs_same_pred_flow]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/collections/Testings.cmake;41;parsec_addtest_cmd;/root/repo/tests/collections/Testings.cmake;0;;/root/repo/tests/Testings.cmake;5;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[collections/reshape/remote_multiple_outs_same_pred_flow:mt]=] "collections/reshape/remote_multiple_outs_same_pred_flow" "-N" "320" "-t" "9" "-c" "10" "-m" "1" "--" "--mca" "runtime_comm_short_limit" "0")
+set_tests_properties([=[collections/reshape/remote_multiple_outs_same_pred_flow:mt]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/collections/Testings.cmake;42;parsec_addtest_cmd;/root/repo/tests/collections/Testings.cmake;0;;/root/repo/tests/Testings.cmake;5;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[collections/reshape/remote_multiple_outs_same_pred_flow:mp]=] "/usr/bin/mpiexec" "-n" "4" "collections/reshape/remote_multiple_outs_same_pred_flow" "-N" "320" "-t" "9" "-c" "10" "--" "--mca" "runtime_comm_short_limit" "0")
+set_tests_properties([=[collections/reshape/remote_multiple_outs_same_pred_flow:mp]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/collections/Testings.cmake;44;parsec_addtest_cmd;/root/repo/tests/collections/Testings.cmake;0;;/root/repo/tests/Testings.cmake;5;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[collections/reshape/remote_multiple_outs_same_pred_flow:mp:mt]=] "/usr/bin/mpiexec" "-n" "4" "collections/reshape/remote_multiple_outs_same_pred_flow" "-N" "320" "-t" "9" "-c" "10" "-m" "1" "--" "--mca" "runtime_comm_short_limit" "0")
+set_tests_properties([=[collections/reshape/remote_multiple_outs_same_pred_flow:mp:mt]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/collections/Testings.cmake;45;parsec_addtest_cmd;/root/repo/tests/collections/Testings.cmake;0;;/root/repo/tests/Testings.cmake;5;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[collections/reshape/avoidable]=] "collections/reshape/avoidable_reshape" "-N" "100" "-t" "2" "-c" "10")
+set_tests_properties([=[collections/reshape/avoidable]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/collections/Testings.cmake;48;parsec_addtest_cmd;/root/repo/tests/collections/Testings.cmake;0;;/root/repo/tests/Testings.cmake;5;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[collections/matrix/band]=] "/usr/bin/mpiexec" "-n" "8" "collections/two_dim_band/testing_band" "-N" "3200" "-T" "160" "-P" "4" "-s" "5" "-S" "10" "-p" "2" "-f" "2" "-F" "10" "-b" "2")
+set_tests_properties([=[collections/matrix/band]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/collections/Testings.cmake;51;parsec_addtest_cmd;/root/repo/tests/collections/Testings.cmake;0;;/root/repo/tests/Testings.cmake;5;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[dsl/ptg/ptgpp/output_NULL]=] "/root/repo/_debug_build/parsec/interfaces/ptg/ptg-compiler/parsec-ptgpp" "--noline" "-E" "-i" "/root/repo/tests/dsl/ptg/ptgpp/output_NULL.jdf" "-o" "output_NULL" "-f" "output_NULL")
+set_tests_properties([=[dsl/ptg/ptgpp/output_NULL]=] PROPERTIES  DEPENDS "parsec-ptgpp" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" PASS_REGULAR_EXPRESSION "NULL data only supported in IN dependencies." SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/dsl/ptg/ptgpp/Testings.cmake;6;parsec_addtest_cmd;/root/repo/tests/dsl/ptg/ptgpp/Testings.cmake;0;;/root/repo/tests/dsl/ptg/Testings.cmake;1;include;/root/repo/tests/dsl/ptg/Testings.cmake;0;;/root/repo/tests/Testings.cmake;6;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[dsl/ptg/ptgpp/output_NULL_true]=] "/root/repo/_debug_build/parsec/interfaces/ptg/ptg-compiler/parsec-ptgpp" "--noline" "-E" "-i" "/root/repo/tests/dsl/ptg/ptgpp/output_NULL_true.jdf" "-o" "output_NULL_true" "-f" "output_NULL_true")
+set_tests_properties([=[dsl/ptg/ptgpp/output_NULL_true]=] PROPERTIES  DEPENDS "parsec-ptgpp" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" PASS_REGULAR_EXPRESSION "NULL data only supported in IN dependencies." SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/dsl/ptg/ptgpp/Testings.cmake;9;parsec_addtest_cmd;/root/repo/tests/dsl/ptg/ptgpp/Testings.cmake;0;;/root/repo/tests/dsl/ptg/Testings.cmake;1;include;/root/repo/tests/dsl/ptg/Testings.cmake;0;;/root/repo/tests/Testings.cmake;6;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[dsl/ptg/ptgpp/output_NULL_false]=] "/root/repo/_debug_build/parsec/interfaces/ptg/ptg-compiler/parsec-ptgpp" "--noline" "-E" "-i" "/root/repo/tests/dsl/ptg/ptgpp/output_NULL_false.jdf" "-o" "output_NULL_false" "-f" "output_NULL_false")
+set_tests_properties([=[dsl/ptg/ptgpp/output_NULL_false]=] PROPERTIES  DEPENDS "parsec-ptgpp" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" PASS_REGULAR_EXPRESSION "NULL data only supported in IN dependencies." SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/dsl/ptg/ptgpp/Testings.cmake;12;parsec_addtest_cmd;/root/repo/tests/dsl/ptg/ptgpp/Testings.cmake;0;;/root/repo/tests/dsl/ptg/Testings.cmake;1;include;/root/repo/tests/dsl/ptg/Testings.cmake;0;;/root/repo/tests/Testings.cmake;6;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[dsl/ptg/ptgpp/output_NEW]=] "/root/repo/_debug_build/parsec/interfaces/ptg/ptg-compiler/parsec-ptgpp" "--noline" "-E" "-i" "/root/repo/tests/dsl/ptg/ptgpp/output_NEW.jdf" "-o" "output_NEW" "-f" "output_NEW")
+set_tests_properties([=[dsl/ptg/ptgpp/output_NEW]=] PROPERTIES  DEPENDS "parsec-ptgpp" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" PASS_REGULAR_EXPRESSION "Automatic data allocation with NEW only supported in IN dependencies." SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/dsl/ptg/ptgpp/Testings.cmake;23;parsec_addtest_cmd;/root/repo/tests/dsl/ptg/ptgpp/Testings.cmake;0;;/root/repo/tests/dsl/ptg/Testings.cmake;1;include;/root/repo/tests/dsl/ptg/Testings.cmake;0;;/root/repo/tests/Testings.cmake;6;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[dsl/ptg/ptgpp/output_NEW_true]=] "/root/repo/_debug_build/parsec/interfaces/ptg/ptg-compiler/parsec-ptgpp" "--noline" "-E" "-i" "/root/repo/tests/dsl/ptg/ptgpp/output_NEW_true.jdf" "-o" "output_NEW_true" "-f" "output_NEW_true")
+set_tests_properties([=[dsl/ptg/ptgpp/output_NEW_true]=] PROPERTIES  DEPENDS "parsec-ptgpp" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" PASS_REGULAR_EXPRESSION "Automatic data allocation with NEW only supported in IN dependencies." SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/dsl/ptg/ptgpp/Testings.cmake;26;parsec_addtest_cmd;/root/repo/tests/dsl/ptg/ptgpp/Testings.cmake;0;;/root/repo/tests/dsl/ptg/Testings.cmake;1;include;/root/repo/tests/dsl/ptg/Testings.cmake;0;;/root/repo/tests/Testings.cmake;6;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[dsl/ptg/ptgpp/output_NEW_false]=] "/root/repo/_debug_build/parsec/interfaces/ptg/ptg-compiler/parsec-ptgpp" "--noline" "-E" "-i" "/root/repo/tests/dsl/ptg/ptgpp/output_NEW_false.jdf" "-o" "output_NEW_false" "-f" "output_NEW_false")
+set_tests_properties([=[dsl/ptg/ptgpp/output_NEW_false]=] PROPERTIES  DEPENDS "parsec-ptgpp" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" PASS_REGULAR_EXPRESSION "Automatic data allocation with NEW only supported in IN dependencies." SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/dsl/ptg/ptgpp/Testings.cmake;29;parsec_addtest_cmd;/root/repo/tests/dsl/ptg/ptgpp/Testings.cmake;0;;/root/repo/tests/dsl/ptg/Testings.cmake;1;include;/root/repo/tests/dsl/ptg/Testings.cmake;0;;/root/repo/tests/Testings.cmake;6;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[dsl/ptg/ptgpp/forward_RW_NULL]=] "dsl/ptg/ptgpp/jdf_forward_RW_NULL")
+set_tests_properties([=[dsl/ptg/ptgpp/forward_RW_NULL]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" PASS_REGULAR_EXPRESSION "A NULL is forwarded" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/dsl/ptg/ptgpp/Testings.cmake;41;parsec_addtest_cmd;/root/repo/tests/dsl/ptg/ptgpp/Testings.cmake;0;;/root/repo/tests/dsl/ptg/Testings.cmake;1;include;/root/repo/tests/dsl/ptg/Testings.cmake;0;;/root/repo/tests/Testings.cmake;6;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[dsl/ptg/ptgpp/forward_READ_NULL]=] "dsl/ptg/ptgpp/jdf_forward_READ_NULL")
+set_tests_properties([=[dsl/ptg/ptgpp/forward_READ_NULL]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" PASS_REGULAR_EXPRESSION "A NULL is forwarded" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/dsl/ptg/ptgpp/Testings.cmake;42;parsec_addtest_cmd;/root/repo/tests/dsl/ptg/ptgpp/Testings.cmake;0;;/root/repo/tests/dsl/ptg/Testings.cmake;1;include;/root/repo/tests/dsl/ptg/Testings.cmake;0;;/root/repo/tests/Testings.cmake;6;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[dsl/ptg/ptgpp/write_check]=] "dsl/ptg/ptgpp/write_check")
+set_tests_properties([=[dsl/ptg/ptgpp/write_check]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/dsl/ptg/ptgpp/Testings.cmake;50;parsec_addtest_cmd;/root/repo/tests/dsl/ptg/ptgpp/Testings.cmake;0;;/root/repo/tests/dsl/ptg/Testings.cmake;1;include;/root/repo/tests/dsl/ptg/Testings.cmake;0;;/root/repo/tests/Testings.cmake;6;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[dsl/ptg/ptgpp/forward_RW_NULL:mp]=] "/usr/bin/mpiexec" "-n" "2" "dsl/ptg/ptgpp/jdf_forward_RW_NULL")
+set_tests_properties([=[dsl/ptg/ptgpp/forward_RW_NULL:mp]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" PASS_REGULAR_EXPRESSION "A NULL is forwarded" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/dsl/ptg/ptgpp/Testings.cmake;53;parsec_addtest_cmd;/root/repo/tests/dsl/ptg/ptgpp/Testings.cmake;0;;/root/repo/tests/dsl/ptg/Testings.cmake;1;include;/root/repo/tests/dsl/ptg/Testings.cmake;0;;/root/repo/tests/Testings.cmake;6;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[dsl/ptg/ptgpp/forward_READ_NULL:mp]=] "/usr/bin/mpiexec" "-n" "2" "dsl/ptg/ptgpp/jdf_forward_READ_NULL")
+set_tests_properties([=[dsl/ptg/ptgpp/forward_READ_NULL:mp]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" PASS_REGULAR_EXPRESSION "A NULL is forwarded" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/dsl/ptg/ptgpp/Testings.cmake;54;parsec_addtest_cmd;/root/repo/tests/dsl/ptg/ptgpp/Testings.cmake;0;;/root/repo/tests/dsl/ptg/Testings.cmake;1;include;/root/repo/tests/dsl/ptg/Testings.cmake;0;;/root/repo/tests/Testings.cmake;6;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[dsl/ptg/ptgpp/write_check:mp]=] "/usr/bin/mpiexec" "-n" "4" "dsl/ptg/ptgpp/write_check")
+set_tests_properties([=[dsl/ptg/ptgpp/write_check:mp]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/dsl/ptg/ptgpp/Testings.cmake;61;parsec_addtest_cmd;/root/repo/tests/dsl/ptg/ptgpp/Testings.cmake;0;;/root/repo/tests/dsl/ptg/Testings.cmake;1;include;/root/repo/tests/dsl/ptg/Testings.cmake;0;;/root/repo/tests/Testings.cmake;6;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[dsl/ptg/ptgpp/must_fail_too_many_in_deps]=] "/usr/bin/cmake" "--build" "." "--target" "must_fail_too_many_in_deps" "dsl/ptg/ptgpp/too_many_in_deps")
+set_tests_properties([=[dsl/ptg/ptgpp/must_fail_too_many_in_deps]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" WILL_FAIL "TRUE" WORKING_DIRECTORY "/root/repo/_debug_build/tests" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/dsl/ptg/ptgpp/Testings.cmake;69;parsec_addtest_cmd;/root/repo/tests/dsl/ptg/ptgpp/Testings.cmake;0;;/root/repo/tests/dsl/ptg/Testings.cmake;1;include;/root/repo/tests/dsl/ptg/Testings.cmake;0;;/root/repo/tests/Testings.cmake;6;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[dsl/ptg/ptgpp/must_fail_too_many_out_deps]=] "/usr/bin/cmake" "--build" "." "--target" "must_fail_too_many_out_deps" "dsl/ptg/ptgpp/too_many_out_deps")
+set_tests_properties([=[dsl/ptg/ptgpp/must_fail_too_many_out_deps]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" WILL_FAIL "TRUE" WORKING_DIRECTORY "/root/repo/_debug_build/tests" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/dsl/ptg/ptgpp/Testings.cmake;74;parsec_addtest_cmd;/root/repo/tests/dsl/ptg/ptgpp/Testings.cmake;0;;/root/repo/tests/dsl/ptg/Testings.cmake;1;include;/root/repo/tests/dsl/ptg/Testings.cmake;0;;/root/repo/tests/Testings.cmake;6;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[dsl/ptg/ptgpp/must_fail_too_many_read_flows]=] "/usr/bin/cmake" "--build" "." "--target" "must_fail_too_many_read_flows" "dsl/ptg/ptgpp/too_many_read_flows")
+set_tests_properties([=[dsl/ptg/ptgpp/must_fail_too_many_read_flows]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" WILL_FAIL "TRUE" WORKING_DIRECTORY "/root/repo/_debug_build/tests" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/dsl/ptg/ptgpp/Testings.cmake;79;parsec_addtest_cmd;/root/repo/tests/dsl/ptg/ptgpp/Testings.cmake;0;;/root/repo/tests/dsl/ptg/Testings.cmake;1;include;/root/repo/tests/dsl/ptg/Testings.cmake;0;;/root/repo/tests/Testings.cmake;6;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[dsl/ptg/ptgpp/must_fail_too_many_write_flows]=] "/usr/bin/cmake" "--build" "." "--target" "must_fail_too_many_write_flows" "dsl/ptg/ptgpp/too_many_write_flows")
+set_tests_properties([=[dsl/ptg/ptgpp/must_fail_too_many_write_flows]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" WILL_FAIL "TRUE" WORKING_DIRECTORY "/root/repo/_debug_build/tests" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/dsl/ptg/ptgpp/Testings.cmake;84;parsec_addtest_cmd;/root/repo/tests/dsl/ptg/ptgpp/Testings.cmake;0;;/root/repo/tests/dsl/ptg/Testings.cmake;1;include;/root/repo/tests/dsl/ptg/Testings.cmake;0;;/root/repo/tests/Testings.cmake;6;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[dsl/ptg/ptgpp/must_fail_too_many_local_vars]=] "/usr/bin/cmake" "--build" "." "--target" "must_fail_too_many_local_vars" "dsl/ptg/ptgpp/too_many_local_vars")
+set_tests_properties([=[dsl/ptg/ptgpp/must_fail_too_many_local_vars]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" WILL_FAIL "TRUE" WORKING_DIRECTORY "/root/repo/_debug_build/tests" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/dsl/ptg/ptgpp/Testings.cmake;89;parsec_addtest_cmd;/root/repo/tests/dsl/ptg/ptgpp/Testings.cmake;0;;/root/repo/tests/dsl/ptg/Testings.cmake;1;include;/root/repo/tests/dsl/ptg/Testings.cmake;0;;/root/repo/tests/Testings.cmake;6;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[dsl/ptg/user-defined-functions/udf]=] "dsl/ptg/user-defined-functions/udf" "-N" "100" "-n" "10")
+set_tests_properties([=[dsl/ptg/user-defined-functions/udf]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/dsl/ptg/user-defined-functions/Testings.cmake;3;parsec_addtest_cmd;/root/repo/tests/dsl/ptg/user-defined-functions/Testings.cmake;0;;/root/repo/tests/dsl/ptg/Testings.cmake;2;include;/root/repo/tests/dsl/ptg/Testings.cmake;0;;/root/repo/tests/Testings.cmake;6;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[dsl/ptg/branching/hashtable]=] "dsl/ptg/branching/branching_ht")
+set_tests_properties([=[dsl/ptg/branching/hashtable]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/dsl/ptg/branching/Testings.cmake;3;parsec_addtest_cmd;/root/repo/tests/dsl/ptg/branching/Testings.cmake;0;;/root/repo/tests/dsl/ptg/Testings.cmake;3;include;/root/repo/tests/dsl/ptg/Testings.cmake;0;;/root/repo/tests/Testings.cmake;6;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[dsl/ptg/branching/idxarray]=] "dsl/ptg/branching/branching_idxarr")
+set_tests_properties([=[dsl/ptg/branching/idxarray]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/dsl/ptg/branching/Testings.cmake;4;parsec_addtest_cmd;/root/repo/tests/dsl/ptg/branching/Testings.cmake;0;;/root/repo/tests/dsl/ptg/Testings.cmake;3;include;/root/repo/tests/dsl/ptg/Testings.cmake;0;;/root/repo/tests/Testings.cmake;6;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[dsl/ptg/multisize_bcast]=] "dsl/ptg/multisize_bcast/check_multisize_bcast")
+set_tests_properties([=[dsl/ptg/multisize_bcast]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/dsl/ptg/multisize_bcast/Testings.cmake;1;parsec_addtest_cmd;/root/repo/tests/dsl/ptg/multisize_bcast/Testings.cmake;0;;/root/repo/tests/dsl/ptg/Testings.cmake;4;include;/root/repo/tests/dsl/ptg/Testings.cmake;0;;/root/repo/tests/Testings.cmake;6;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[dsl/ptg/multisize_bcast:mp]=] "/usr/bin/mpiexec" "-n" "4" "dsl/ptg/multisize_bcast/check_multisize_bcast")
+set_tests_properties([=[dsl/ptg/multisize_bcast:mp]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/dsl/ptg/multisize_bcast/Testings.cmake;3;parsec_addtest_cmd;/root/repo/tests/dsl/ptg/multisize_bcast/Testings.cmake;0;;/root/repo/tests/dsl/ptg/Testings.cmake;4;include;/root/repo/tests/dsl/ptg/Testings.cmake;0;;/root/repo/tests/Testings.cmake;6;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[dsl/ptg/startup1]=] "dsl/ptg/startup" "-i=10" "-j=10" "-k=10" "-v=5")
+set_tests_properties([=[dsl/ptg/startup1]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/dsl/ptg/Testings.cmake;6;parsec_addtest_cmd;/root/repo/tests/dsl/ptg/Testings.cmake;0;;/root/repo/tests/Testings.cmake;6;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[dsl/ptg/startup2]=] "dsl/ptg/startup" "-i=10" "-j=20" "-k=30" "-v=5")
+set_tests_properties([=[dsl/ptg/startup2]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/dsl/ptg/Testings.cmake;7;parsec_addtest_cmd;/root/repo/tests/dsl/ptg/Testings.cmake;0;;/root/repo/tests/Testings.cmake;6;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[dsl/ptg/startup3]=] "dsl/ptg/startup" "-i=30" "-j=30" "-k=30" "-v=5")
+set_tests_properties([=[dsl/ptg/startup3]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/dsl/ptg/Testings.cmake;8;parsec_addtest_cmd;/root/repo/tests/dsl/ptg/Testings.cmake;0;;/root/repo/tests/Testings.cmake;6;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[dsl/ptg/strange]=] "dsl/ptg/strange")
+set_tests_properties([=[dsl/ptg/strange]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/dsl/ptg/Testings.cmake;9;parsec_addtest_cmd;/root/repo/tests/dsl/ptg/Testings.cmake;0;;/root/repo/tests/Testings.cmake;6;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[dsl/ptg/fusion]=] "dsl/ptg/fusion" "-i=64" "-k=1000")
+set_tests_properties([=[dsl/ptg/fusion]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/dsl/ptg/Testings.cmake;10;parsec_addtest_cmd;/root/repo/tests/dsl/ptg/Testings.cmake;0;;/root/repo/tests/Testings.cmake;6;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[dsl/ptg/fusion:mp]=] "/usr/bin/mpiexec" "-n" "2" "dsl/ptg/fusion" "-i=8" "-k=200" "-m")
+set_tests_properties([=[dsl/ptg/fusion:mp]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/dsl/ptg/Testings.cmake;12;parsec_addtest_cmd;/root/repo/tests/dsl/ptg/Testings.cmake;0;;/root/repo/tests/Testings.cmake;6;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[dsl/ptg/fusion:depth1]=] "dsl/ptg/fusion" "-i=64" "-k=200" "--" "--mca" "runtime_keep_highest_priority_task_depth" "1")
+set_tests_properties([=[dsl/ptg/fusion:depth1]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/dsl/ptg/Testings.cmake;14;parsec_addtest_cmd;/root/repo/tests/dsl/ptg/Testings.cmake;0;;/root/repo/tests/Testings.cmake;6;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[dsl/ptg/fusion:off]=] "dsl/ptg/fusion" "-i=64" "-k=200" "--" "--mca" "runtime_task_fusion" "0")
+set_tests_properties([=[dsl/ptg/fusion:off]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/dsl/ptg/Testings.cmake;15;parsec_addtest_cmd;/root/repo/tests/dsl/ptg/Testings.cmake;0;;/root/repo/tests/Testings.cmake;6;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[dsl/dtd/empty]=] "dsl/dtd/dtd_test_empty")
+set_tests_properties([=[dsl/dtd/empty]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/dsl/dtd/Testings.cmake;5;parsec_addtest_cmd;/root/repo/tests/dsl/dtd/Testings.cmake;0;;/root/repo/tests/Testings.cmake;7;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[dsl/dtd/task_generation]=] "dsl/dtd/dtd_test_task_generation")
+set_tests_properties([=[dsl/dtd/task_generation]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/dsl/dtd/Testings.cmake;6;parsec_addtest_cmd;/root/repo/tests/dsl/dtd/Testings.cmake;0;;/root/repo/tests/Testings.cmake;7;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[dsl/dtd/task_inserting_task]=] "dsl/dtd/dtd_test_task_inserting_task")
+set_tests_properties([=[dsl/dtd/task_inserting_task]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/dsl/dtd/Testings.cmake;7;parsec_addtest_cmd;/root/repo/tests/dsl/dtd/Testings.cmake;0;;/root/repo/tests/Testings.cmake;7;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[dsl/dtd/task_insertion]=] "dsl/dtd/dtd_test_task_insertion")
+set_tests_properties([=[dsl/dtd/task_insertion]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/dsl/dtd/Testings.cmake;8;parsec_addtest_cmd;/root/repo/tests/dsl/dtd/Testings.cmake;0;;/root/repo/tests/Testings.cmake;7;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[dsl/dtd/war]=] "dsl/dtd/dtd_test_war")
+set_tests_properties([=[dsl/dtd/war]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/dsl/dtd/Testings.cmake;9;parsec_addtest_cmd;/root/repo/tests/dsl/dtd/Testings.cmake;0;;/root/repo/tests/Testings.cmake;7;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[dsl/dtd/new_tile:cpu]=] "dsl/dtd/dtd_test_new_tile" "--mca" "device_cuda_enabled" "0")
+set_tests_properties([=[dsl/dtd/new_tile:cpu]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/dsl/dtd/Testings.cmake;10;parsec_addtest_cmd;/root/repo/tests/dsl/dtd/Testings.cmake;0;;/root/repo/tests/Testings.cmake;7;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[dsl/dtd/empty:mp]=] "/usr/bin/mpiexec" "-n" "2" "dsl/dtd/dtd_test_empty")
+set_tests_properties([=[dsl/dtd/empty:mp]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/dsl/dtd/Testings.cmake;19;parsec_addtest_cmd;/root/repo/tests/dsl/dtd/Testings.cmake;0;;/root/repo/tests/Testings.cmake;7;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[dsl/dtd/pingpong:mp]=] "/usr/bin/mpiexec" "-n" "2" "dsl/dtd/dtd_test_pingpong")
+set_tests_properties([=[dsl/dtd/pingpong:mp]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/dsl/dtd/Testings.cmake;20;parsec_addtest_cmd;/root/repo/tests/dsl/dtd/Testings.cmake;0;;/root/repo/tests/Testings.cmake;7;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[dsl/dtd/task_inserting_task:mp]=] "/usr/bin/mpiexec" "-n" "4" "dsl/dtd/dtd_test_task_inserting_task")
+set_tests_properties([=[dsl/dtd/task_inserting_task:mp]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/dsl/dtd/Testings.cmake;21;parsec_addtest_cmd;/root/repo/tests/dsl/dtd/Testings.cmake;0;;/root/repo/tests/Testings.cmake;7;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[dsl/dtd/task_insertion:mp]=] "/usr/bin/mpiexec" "-n" "4" "dsl/dtd/dtd_test_task_insertion")
+set_tests_properties([=[dsl/dtd/task_insertion:mp]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/dsl/dtd/Testings.cmake;22;parsec_addtest_cmd;/root/repo/tests/dsl/dtd/Testings.cmake;0;;/root/repo/tests/Testings.cmake;7;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[dsl/dtd/war:mp]=] "/usr/bin/mpiexec" "-n" "4" "dsl/dtd/dtd_test_war")
+set_tests_properties([=[dsl/dtd/war:mp]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/dsl/dtd/Testings.cmake;23;parsec_addtest_cmd;/root/repo/tests/dsl/dtd/Testings.cmake;0;;/root/repo/tests/Testings.cmake;7;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[dsl/dtd/interleave_actions:mp]=] "/usr/bin/mpiexec" "-n" "4" "dsl/dtd/dtd_test_interleave_actions")
+set_tests_properties([=[dsl/dtd/interleave_actions:mp]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/dsl/dtd/Testings.cmake;24;parsec_addtest_cmd;/root/repo/tests/dsl/dtd/Testings.cmake;0;;/root/repo/tests/Testings.cmake;7;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[dsl/dtd/allreduce:mp]=] "/usr/bin/mpiexec" "-n" "4" "dsl/dtd/dtd_test_allreduce")
+set_tests_properties([=[dsl/dtd/allreduce:mp]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/dsl/dtd/Testings.cmake;25;parsec_addtest_cmd;/root/repo/tests/dsl/dtd/Testings.cmake;0;;/root/repo/tests/Testings.cmake;7;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[dsl/dtd/new_tile:mp:cpu]=] "/usr/bin/mpiexec" "-n" "2" "dsl/dtd/dtd_test_new_tile" "--mca" "device_cuda_enabled" "0")
+set_tests_properties([=[dsl/dtd/new_tile:mp:cpu]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/dsl/dtd/Testings.cmake;26;parsec_addtest_cmd;/root/repo/tests/dsl/dtd/Testings.cmake;0;;/root/repo/tests/Testings.cmake;7;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[apps/haar_tree]=] "apps/haar_tree/project" "-x")
+set_tests_properties([=[apps/haar_tree]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/apps/haar_tree/Testings.cmake;1;parsec_addtest_cmd;/root/repo/tests/apps/haar_tree/Testings.cmake;0;;/root/repo/tests/apps/Testings.cmake;1;include;/root/repo/tests/apps/Testings.cmake;0;;/root/repo/tests/Testings.cmake;8;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[apps/haar_tree:mp]=] "/usr/bin/mpiexec" "-n" "4" "apps/haar_tree/project" "-x")
+set_tests_properties([=[apps/haar_tree:mp]=] PROPERTIES  DEPENDS "launch:mp" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/apps/haar_tree/Testings.cmake;3;parsec_addtest_cmd;/root/repo/tests/apps/haar_tree/Testings.cmake;0;;/root/repo/tests/apps/Testings.cmake;1;include;/root/repo/tests/apps/Testings.cmake;0;;/root/repo/tests/Testings.cmake;8;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[apps/merge_sort]=] "apps/merge_sort/merge_sort")
+set_tests_properties([=[apps/merge_sort]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/apps/merge_sort/Testings.cmake;1;parsec_addtest_cmd;/root/repo/tests/apps/merge_sort/Testings.cmake;0;;/root/repo/tests/apps/Testings.cmake;2;include;/root/repo/tests/apps/Testings.cmake;0;;/root/repo/tests/Testings.cmake;8;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[apps/merge_sort:mp]=] "/usr/bin/mpiexec" "-n" "4" "apps/merge_sort/merge_sort")
+set_tests_properties([=[apps/merge_sort:mp]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/apps/merge_sort/Testings.cmake;3;parsec_addtest_cmd;/root/repo/tests/apps/merge_sort/Testings.cmake;0;;/root/repo/tests/apps/Testings.cmake;2;include;/root/repo/tests/apps/Testings.cmake;0;;/root/repo/tests/Testings.cmake;8;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[apps/pingpong/bw_test:mp]=] "/usr/bin/mpiexec" "-n" "2" "apps/pingpong/bw_test" "-n" "20" "-f" "200" "-l" "64" "-c" "4" "--" "--mca" "runtime_comm_thread_multiple" "0")
+set_tests_properties([=[apps/pingpong/bw_test:mp]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/apps/pingpong/Testings.cmake;4;parsec_addtest_cmd;/root/repo/tests/apps/pingpong/Testings.cmake;0;;/root/repo/tests/apps/Testings.cmake;3;include;/root/repo/tests/apps/Testings.cmake;0;;/root/repo/tests/Testings.cmake;8;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[apps/pingpong/bw_test:mt:mp]=] "/usr/bin/mpiexec" "-n" "2" "apps/pingpong/bw_test" "-n" "20" "-f" "200" "-l" "64" "-c" "4" "--" "--mca" "runtime_comm_thread_multiple" "1" "--mca" "runtime_comm_mpi_shards" "4")
+set_tests_properties([=[apps/pingpong/bw_test:mt:mp]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/apps/pingpong/Testings.cmake;5;parsec_addtest_cmd;/root/repo/tests/apps/pingpong/Testings.cmake;0;;/root/repo/tests/apps/Testings.cmake;3;include;/root/repo/tests/apps/Testings.cmake;0;;/root/repo/tests/Testings.cmake;8;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[apps/pingpong/rtt:mp]=] "/usr/bin/mpiexec" "-n" "2" "apps/pingpong/rtt" "-n=200" "--" "--mca" "runtime_comm_thread_multiple" "0")
+set_tests_properties([=[apps/pingpong/rtt:mp]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/apps/pingpong/Testings.cmake;8;parsec_addtest_cmd;/root/repo/tests/apps/pingpong/Testings.cmake;0;;/root/repo/tests/apps/Testings.cmake;3;include;/root/repo/tests/apps/Testings.cmake;0;;/root/repo/tests/Testings.cmake;8;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[apps/pingpong/rtt:mt:mp]=] "/usr/bin/mpiexec" "-n" "2" "apps/pingpong/rtt" "-n=200" "--" "--mca" "runtime_comm_thread_multiple" "1")
+set_tests_properties([=[apps/pingpong/rtt:mt:mp]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/apps/pingpong/Testings.cmake;9;parsec_addtest_cmd;/root/repo/tests/apps/pingpong/Testings.cmake;0;;/root/repo/tests/apps/Testings.cmake;3;include;/root/repo/tests/apps/Testings.cmake;0;;/root/repo/tests/Testings.cmake;8;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[apps/pingpong/bw_test:rma:mp]=] "/usr/bin/mpiexec" "-n" "2" "apps/pingpong/bw_test" "-n" "100" "-f" "1" "-l" "65536" "--" "--mca" "runtime_comm_mpi_rma" "1")
+set_tests_properties([=[apps/pingpong/bw_test:rma:mp]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/apps/pingpong/Testings.cmake;11;parsec_addtest_cmd;/root/repo/tests/apps/pingpong/Testings.cmake;0;;/root/repo/tests/apps/Testings.cmake;3;include;/root/repo/tests/apps/Testings.cmake;0;;/root/repo/tests/Testings.cmake;8;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[apps/stencil]=] "apps/stencil/testing_stencil_1D" "-t" "100" "-T" "100" "-N" "1000" "-M" "1000" "-I" "10" "-R" "2" "-m" "1")
+set_tests_properties([=[apps/stencil]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/apps/stencil/Testings.cmake;1;parsec_addtest_cmd;/root/repo/tests/apps/stencil/Testings.cmake;0;;/root/repo/tests/apps/Testings.cmake;4;include;/root/repo/tests/apps/Testings.cmake;0;;/root/repo/tests/Testings.cmake;8;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[apps/stencil:la]=] "apps/stencil/testing_stencil_1D" "-t" "100" "-T" "100" "-N" "1000" "-M" "1000" "-I" "10" "-R" "2" "-m" "1" "--" "--mca" "mca_sched" "la")
+set_tests_properties([=[apps/stencil:la]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/apps/stencil/Testings.cmake;4;parsec_addtest_cmd;/root/repo/tests/apps/stencil/Testings.cmake;0;;/root/repo/tests/apps/Testings.cmake;4;include;/root/repo/tests/apps/Testings.cmake;0;;/root/repo/tests/Testings.cmake;8;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[apps/stencil:mp]=] "/usr/bin/mpiexec" "-n" "8" "apps/stencil/testing_stencil_1D" "-t" "100" "-T" "100" "-N" "1000" "-M" "1000" "-I" "10" "-R" "2" "-m" "1")
+set_tests_properties([=[apps/stencil:mp]=] PROPERTIES  DEPENDS "launch:mp" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/apps/stencil/Testings.cmake;6;parsec_addtest_cmd;/root/repo/tests/apps/stencil/Testings.cmake;0;;/root/repo/tests/apps/Testings.cmake;4;include;/root/repo/tests/apps/Testings.cmake;0;;/root/repo/tests/Testings.cmake;8;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+add_test([=[apps/stencil:ckpt:mp]=] "/usr/bin/mpiexec" "-n" "4" "apps/stencil/testing_stencil_1D" "-t" "100" "-T" "100" "-N" "1000" "-M" "1000" "-I" "20" "-R" "2" "-C" "5")
+set_tests_properties([=[apps/stencil:ckpt:mp]=] PROPERTIES  DEPENDS "parsec_build_tests_test" ENVIRONMENT "PARSEC_MCA_device_cuda_enabled=0;PARSEC_MCA_device_hip_enabled=0;PARSEC_MCA_device_level_zero_enabled=0;PARSEC_MCA_device_cuda_memory_use=10;PARSEC_MCA_device_hip_memory_use=10;PARSEC_MCA_device_level_zero_memory_use=10" SKIP_RETURN_CODE "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;67;add_test;/root/repo/tests/apps/stencil/Testings.cmake;11;parsec_addtest_cmd;/root/repo/tests/apps/stencil/Testings.cmake;0;;/root/repo/tests/apps/Testings.cmake;4;include;/root/repo/tests/apps/Testings.cmake;0;;/root/repo/tests/Testings.cmake;8;include;/root/repo/tests/Testings.cmake;0;;/root/repo/tests/CMakeLists.txt;100;include;/root/repo/tests/CMakeLists.txt;0;")
+subdirs("class")
+subdirs("api")
+subdirs("runtime")
+subdirs("dsl/ptg")
+subdirs("collections")
+subdirs("dsl/dtd")
+subdirs("apps")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compose.dir/compose.c.o"
+  "CMakeFiles/compose.dir/compose.c.o.d"
+  "compose"
+  "compose.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/compose.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
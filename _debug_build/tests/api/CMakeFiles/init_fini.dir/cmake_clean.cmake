@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/init_fini.dir/init_fini.c.o"
+  "CMakeFiles/init_fini.dir/init_fini.c.o.d"
+  "init_fini"
+  "init_fini.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/init_fini.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/operator.dir/operator.c.o"
+  "CMakeFiles/operator.dir/operator.c.o.d"
+  "operator"
+  "operator.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/operator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ptgpp_touch_ex.touch"
+  "touch.c"
+  "touch.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ptgpp_touch_ex.touch.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/touch_ex.dir/touch.c.o"
+  "CMakeFiles/touch_ex.dir/touch.c.o.d"
+  "CMakeFiles/touch_ex.dir/touch_ex.c.o"
+  "CMakeFiles/touch_ex.dir/touch_ex.c.o.d"
+  "touch_ex"
+  "touch_ex.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/touch_ex.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
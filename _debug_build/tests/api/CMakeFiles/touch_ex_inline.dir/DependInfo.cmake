@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/_debug_build/tests/api/touch.c" "tests/api/CMakeFiles/touch_ex_inline.dir/touch.c.o" "gcc" "tests/api/CMakeFiles/touch_ex_inline.dir/touch.c.o.d"
+  "/root/repo/tests/api/touch_ex.c" "tests/api/CMakeFiles/touch_ex_inline.dir/touch_ex.c.o" "gcc" "tests/api/CMakeFiles/touch_ex_inline.dir/touch_ex.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_debug_build/parsec/CMakeFiles/parsec.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "/root/repo/_debug_build/parsec/include/fortran")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/touch_ex_inline.dir/touch.c.o"
+  "CMakeFiles/touch_ex_inline.dir/touch.c.o.d"
+  "CMakeFiles/touch_ex_inline.dir/touch_ex.c.o"
+  "CMakeFiles/touch_ex_inline.dir/touch_ex.c.o.d"
+  "touch_ex_inline"
+  "touch_ex_inline.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/touch_ex_inline.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
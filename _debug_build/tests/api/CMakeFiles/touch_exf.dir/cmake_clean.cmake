@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/touch_exf.dir/touch.c.o"
+  "CMakeFiles/touch_exf.dir/touch.c.o.d"
+  "CMakeFiles/touch_exf.dir/touch_exf.F90.o"
+  "touch_exf"
+  "touch_exf.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C Fortran)
+  include(CMakeFiles/touch_exf.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ptgpp_taskpool_wait.ptg_tp"
+  "ptg_tp.c"
+  "ptg_tp.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ptgpp_taskpool_wait.ptg_tp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
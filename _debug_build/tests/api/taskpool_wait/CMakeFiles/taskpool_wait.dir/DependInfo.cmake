@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/api/taskpool_wait/dtd_tp.c" "tests/api/taskpool_wait/CMakeFiles/taskpool_wait.dir/dtd_tp.c.o" "gcc" "tests/api/taskpool_wait/CMakeFiles/taskpool_wait.dir/dtd_tp.c.o.d"
+  "/root/repo/tests/api/taskpool_wait/main.c" "tests/api/taskpool_wait/CMakeFiles/taskpool_wait.dir/main.c.o" "gcc" "tests/api/taskpool_wait/CMakeFiles/taskpool_wait.dir/main.c.o.d"
+  "/root/repo/_debug_build/tests/api/taskpool_wait/ptg_tp.c" "tests/api/taskpool_wait/CMakeFiles/taskpool_wait.dir/ptg_tp.c.o" "gcc" "tests/api/taskpool_wait/CMakeFiles/taskpool_wait.dir/ptg_tp.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_debug_build/parsec/CMakeFiles/parsec.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "/root/repo/_debug_build/parsec/include/fortran")
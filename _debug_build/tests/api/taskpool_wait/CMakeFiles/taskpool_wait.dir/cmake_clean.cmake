@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/taskpool_wait.dir/dtd_tp.c.o"
+  "CMakeFiles/taskpool_wait.dir/dtd_tp.c.o.d"
+  "CMakeFiles/taskpool_wait.dir/main.c.o"
+  "CMakeFiles/taskpool_wait.dir/main.c.o.d"
+  "CMakeFiles/taskpool_wait.dir/ptg_tp.c.o"
+  "CMakeFiles/taskpool_wait.dir/ptg_tp.c.o.d"
+  "taskpool_wait"
+  "taskpool_wait.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/taskpool_wait.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
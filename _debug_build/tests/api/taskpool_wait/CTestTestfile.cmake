@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/api/taskpool_wait
+# Build directory: /root/repo/_debug_build/tests/api/taskpool_wait
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
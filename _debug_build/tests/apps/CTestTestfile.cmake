@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/apps
+# Build directory: /root/repo/_debug_build/tests/apps
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("pingpong")
+subdirs("all2all")
+subdirs("generalized_reduction")
+subdirs("stencil")
+subdirs("merge_sort")
+subdirs("haar_tree")
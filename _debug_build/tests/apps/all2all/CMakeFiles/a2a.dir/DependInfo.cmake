@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/_debug_build/tests/apps/all2all/a2a.c" "tests/apps/all2all/CMakeFiles/a2a.dir/a2a.c.o" "gcc" "tests/apps/all2all/CMakeFiles/a2a.dir/a2a.c.o.d"
+  "/root/repo/tests/apps/all2all/a2a_data.c" "tests/apps/all2all/CMakeFiles/a2a.dir/a2a_data.c.o" "gcc" "tests/apps/all2all/CMakeFiles/a2a.dir/a2a_data.c.o.d"
+  "/root/repo/tests/apps/all2all/main.c" "tests/apps/all2all/CMakeFiles/a2a.dir/main.c.o" "gcc" "tests/apps/all2all/CMakeFiles/a2a.dir/main.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_debug_build/parsec/CMakeFiles/parsec.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "/root/repo/_debug_build/parsec/include/fortran")
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/a2a.dir/a2a.c.o"
+  "CMakeFiles/a2a.dir/a2a.c.o.d"
+  "CMakeFiles/a2a.dir/a2a_data.c.o"
+  "CMakeFiles/a2a.dir/a2a_data.c.o.d"
+  "CMakeFiles/a2a.dir/main.c.o"
+  "CMakeFiles/a2a.dir/main.c.o.d"
+  "a2a"
+  "a2a.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/a2a.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ptgpp_a2a.a2a"
+  "a2a.c"
+  "a2a.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ptgpp_a2a.a2a.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,5198 @@
+#include "parsec.h"
+#include "parsec/parsec_internal.h"
+#include "parsec/ayudame.h"
+#include "parsec/execution_stream.h"
+#include "parsec/parsec_binary_profile.h"
+#include "parsec/mca/device/device_gpu.h"
+#if defined(PARSEC_HAVE_DEV_CUDA_SUPPORT)
+#include "parsec/mca/device/cuda/device_cuda.h"
+#endif  /* defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) */
+#if defined(PARSEC_HAVE_DEV_HIP_SUPPORT)
+#include "parsec/mca/device/hip/device_hip.h"
+#endif  /* defined(PARSEC_HAVE_DEV_HIP_SUPPORT) */
+#if defined(_MSC_VER) || defined(__MINGW32__)
+#  include <malloc.h>
+#else
+#  include <alloca.h>
+#endif  /* defined(_MSC_VER) || defined(__MINGW32__) */
+
+#define PARSEC_a2a_NB_TASK_CLASSES 5
+#define PARSEC_a2a_NB_DATA 2
+
+typedef struct __parsec_a2a_internal_taskpool_s __parsec_a2a_internal_taskpool_t;
+struct parsec_a2a_internal_taskpool_s;
+
+/** Predeclarations of the parsec_task_class_t */
+static const parsec_task_class_t a2a_FANIN;
+static const parsec_task_class_t a2a_RECV;
+static const parsec_task_class_t a2a_SEND;
+static const parsec_task_class_t a2a_FANOUT;
+static const parsec_task_class_t a2a_READER_B;
+/** Predeclarations of the parameters */
+static const parsec_flow_t flow_of_a2a_FANIN_for_A;
+static const parsec_flow_t flow_of_a2a_FANIN_for_T;
+static const parsec_flow_t flow_of_a2a_RECV_for_A;
+static const parsec_flow_t flow_of_a2a_RECV_for_B;
+static const parsec_flow_t flow_of_a2a_RECV_for_T;
+static const parsec_flow_t flow_of_a2a_SEND_for_A;
+static const parsec_flow_t flow_of_a2a_FANOUT_for_A;
+static const parsec_flow_t flow_of_a2a_READER_B_for_B;
+/*
+ * Copyright (c) 2013-2022 The University of Tennessee and The University
+ *                         of Tennessee Research Foundation.  All rights
+ *                         reserved.
+ *
+ * @precisions normal z -> s d c
+ *
+ */
+
+#include "parsec/data_distribution.h"
+#include "parsec/data_dist/matrix/matrix.h"
+
+#if defined(PARSEC_HAVE_MPI)
+#include <mpi.h>
+#endif
+#include <stdio.h>
+
+int32_t always_zero()
+{
+    return 0;
+}
+
+int64_t always_one(void)
+{
+    return 1;
+}
+
+#define PARSEC_a2a_DEFAULT_ADT    (&__parsec_tp->super.arenas_datatypes[PARSEC_a2a_DEFAULT_ADT_IDX])
+#include "a2a.h"
+
+struct __parsec_a2a_internal_taskpool_s {
+ parsec_a2a_taskpool_t super;
+ volatile int32_t sync_point;
+ volatile int32_t initial_number_tasks;
+ parsec_task_t* startup_queue;
+  /* The ranges to compute the hash key */
+  int FANIN_r_min;
+  int FANIN_r_range;
+  int FANIN_t_min;
+  int FANIN_t_range;
+  int RECV_r_min;
+  int RECV_r_range;
+  int RECV_s_min;
+  int RECV_s_range;
+  int RECV_t_min;
+  int RECV_t_range;
+  int SEND_r_min;
+  int SEND_r_range;
+  int SEND_t_min;
+  int SEND_t_range;
+  int SEND_s_min;
+  int SEND_s_range;
+  int FANOUT_r_min;
+  int FANOUT_r_range;
+  int FANOUT_t_min;
+  int FANOUT_t_range;
+  int READER_B_r_min;
+  int READER_B_r_range;
+  int READER_B_t_min;
+  int READER_B_t_range;
+  /* The list of data repositories  SEND  FANOUT  READER_B */
+  data_repo_t* repositories[5];
+};
+
+#if defined(PARSEC_PROF_TRACE)
+#  if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+static int a2a_profiling_array[4*PARSEC_a2a_NB_TASK_CLASSES] = {-2}; /* 2 pairs (begin, end) per task, times two because each task class has an internal_init task */
+#  else /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+static int a2a_profiling_array[2*PARSEC_a2a_NB_TASK_CLASSES] = {-2}; /* 2 pairs (begin, end) per task */
+#  endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+#endif  /* defined(PARSEC_PROF_TRACE) */
+/* Globals */
+#define descA __parsec_tp->super._g_descA
+#define descB __parsec_tp->super._g_descB
+#define NR (__parsec_tp->super._g_NR)
+#define NT (__parsec_tp->super._g_NT)
+
+static inline int parsec_imin(int a, int b) { return (a <= b) ? a : b; };
+
+static inline int parsec_imax(int a, int b) { return (a >= b) ? a : b; };
+
+static inline int32_t a2a_READER_B_inline_c_expr1_line_47(const __parsec_a2a_internal_taskpool_t *__parsec_tp, const __parsec_a2a_READER_B_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task READER_B */
+  const int r = assignments->r.value; (void)r;
+  const int t = assignments->t.value; (void)t;
+
+  (void)r;  (void)t;
+
+ return always_zero(); 
+}
+
+static inline int32_t a2a_READER_B_inline_c_expr2_line_46(const __parsec_a2a_internal_taskpool_t *__parsec_tp, const __parsec_a2a_READER_B_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task READER_B */
+  const int r = assignments->r.value; (void)r;
+  const int t = assignments->t.value; (void)t;
+
+  (void)r;  (void)t;
+
+ return always_one(); 
+}
+
+static inline int32_t a2a_READER_B_inline_c_expr3_line_43(const __parsec_a2a_internal_taskpool_t *__parsec_tp, const __parsec_a2a_READER_B_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task READER_B */
+  const int r = assignments->r.value; (void)r;
+  const int t = assignments->t.value; (void)t;
+
+  (void)r;  (void)t;
+
+ return 0; 
+}
+
+static inline int32_t a2a_READER_B_inline_c_expr4_line_42(const __parsec_a2a_internal_taskpool_t *__parsec_tp, const __parsec_a2a_READER_B_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task READER_B */
+  const int r = assignments->r.value; (void)r;
+  const int t = assignments->t.value; (void)t;
+
+  (void)r;  (void)t;
+
+ return 1; 
+}
+
+/* Data Access Macros */
+#define data_of_descA(descA_d0, descA_d1)  (((parsec_data_collection_t*)__parsec_tp->super._g_descA)->data_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, (descA_d0), (descA_d1)))
+#define data_of_descB(descB_d0, descB_d1)  (((parsec_data_collection_t*)__parsec_tp->super._g_descB)->data_of((parsec_data_collection_t*)__parsec_tp->super._g_descB, (descB_d0), (descB_d1)))
+
+#define rank_of_descA(descA_d0, descA_d1)  (((parsec_data_collection_t*)__parsec_tp->super._g_descA)->rank_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, (descA_d0), (descA_d1)))
+#define rank_of_descB(descB_d0, descB_d1)  (((parsec_data_collection_t*)__parsec_tp->super._g_descB)->rank_of((parsec_data_collection_t*)__parsec_tp->super._g_descB, (descB_d0), (descB_d1)))
+
+/* Functions Predicates */
+#define FANIN_pred(r, t) (((parsec_data_collection_t*)(__parsec_tp->super._g_descB))->myrank == rank_of_descB(t, 0))
+#define RECV_pred(r, t, s) (((parsec_data_collection_t*)(__parsec_tp->super._g_descB))->myrank == rank_of_descB(t, 0))
+#define SEND_pred(r, t, s) (((parsec_data_collection_t*)(__parsec_tp->super._g_descA))->myrank == rank_of_descA(t, 0))
+#define FANOUT_pred(r, t) (((parsec_data_collection_t*)(__parsec_tp->super._g_descA))->myrank == rank_of_descA(t, 0))
+#define READER_B_pred(r, t) (((parsec_data_collection_t*)(__parsec_tp->super._g_descB))->myrank == rank_of_descB(t, 0))
+
+/* Data Repositories */
+#define FANIN_repo (__parsec_tp->repositories[4])
+#define RECV_repo (__parsec_tp->repositories[3])
+#define SEND_repo (__parsec_tp->repositories[2])
+#define FANOUT_repo (__parsec_tp->repositories[1])
+#define READER_B_repo (__parsec_tp->repositories[0])
+/* Release dependencies output macro */
+#if defined(PARSEC_DEBUG_NOISIER)
+#define RELEASE_DEP_OUTPUT(ES, DEPO, TASKO, DEPI, TASKI, RSRC, RDST, DATA)\
+  do { \
+    char tmp1[128], tmp2[128]; (void)tmp1; (void)tmp2;\
+    PARSEC_DEBUG_VERBOSE(20, parsec_debug_output, "thread %d VP %d explore deps from %s:%s to %s:%s (from rank %d to %d) base ptr %p",\
+           (NULL != (ES) ? (ES)->th_id : -1), (NULL != (ES) ? (ES)->virtual_process->vp_id : -1),\
+           DEPO, parsec_task_snprintf(tmp1, 128, (parsec_task_t*)(TASKO)),\
+           DEPI, parsec_task_snprintf(tmp2, 128, (parsec_task_t*)(TASKI)), (RSRC), (RDST), (DATA));\
+  } while(0)
+#define ACQUIRE_FLOW(TASKI, DEPI, FUNO, DEPO, LOCALS, PTR)\
+  do { \
+    char tmp1[128], tmp2[128]; (void)tmp1; (void)tmp2;\
+    PARSEC_DEBUG_VERBOSE(20, parsec_debug_output, "task %s acquires flow %s from %s %s data ptr %p",\
+           parsec_task_snprintf(tmp1, 128, (parsec_task_t*)(TASKI)), (DEPI),\
+           (DEPO), parsec_snprintf_assignments(tmp2, 128, (FUNO), (parsec_assignment_t*)(LOCALS)), (PTR));\
+  } while(0)
+#else
+#define RELEASE_DEP_OUTPUT(ES, DEPO, TASKO, DEPI, TASKI, RSRC, RDST, DATA)
+#define ACQUIRE_FLOW(TASKI, DEPI, TASKO, DEPO, LOCALS, PTR)
+#endif
+static inline parsec_key_t __jdf2c_make_key_FANIN(const parsec_taskpool_t *tp, const parsec_assignment_t *as)
+{
+  const __parsec_a2a_internal_taskpool_t *__parsec_tp = (const __parsec_a2a_internal_taskpool_t *)tp;
+  const __parsec_a2a_FANIN_parsec_assignment_t *assignment = (const __parsec_a2a_FANIN_parsec_assignment_t*)as;
+  uint64_t __parsec_id = 0;
+  __parsec_id += (assignment->r.value - __parsec_tp->FANIN_r_min);
+  __parsec_id += (assignment->t.value - __parsec_tp->FANIN_t_min) * __parsec_tp->FANIN_r_range;
+  return (parsec_key_t)__parsec_id;
+}
+static char *__jdf2c_key_fns_FANIN_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_a2a_internal_taskpool_t *__parsec_tp = (__parsec_a2a_internal_taskpool_t *)user_data;
+  int r = (__parsec_key) % __parsec_tp->FANIN_r_range + __parsec_tp->FANIN_r_min;
+  __parsec_key = __parsec_key / __parsec_tp->FANIN_r_range;
+  int t = (__parsec_key) % __parsec_tp->FANIN_t_range + __parsec_tp->FANIN_t_min;
+  __parsec_key = __parsec_key / __parsec_tp->FANIN_t_range;
+  snprintf(buffer, buffer_size, "FANIN(%d, %d)", r, t);
+  return buffer;
+}
+
+static parsec_key_fn_t __jdf2c_key_fns_FANIN = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = __jdf2c_key_fns_FANIN_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+static inline parsec_key_t __jdf2c_make_key_RECV(const parsec_taskpool_t *tp, const parsec_assignment_t *as)
+{
+  const __parsec_a2a_internal_taskpool_t *__parsec_tp = (const __parsec_a2a_internal_taskpool_t *)tp;
+  const __parsec_a2a_RECV_parsec_assignment_t *assignment = (const __parsec_a2a_RECV_parsec_assignment_t*)as;
+  uint64_t __parsec_id = 0;
+  __parsec_id += (assignment->r.value - __parsec_tp->RECV_r_min);
+  __parsec_id += (assignment->t.value - __parsec_tp->RECV_t_min) * __parsec_tp->RECV_r_range;
+  __parsec_id += (assignment->s.value - __parsec_tp->RECV_s_min) * __parsec_tp->RECV_r_range * __parsec_tp->RECV_t_range;
+  return (parsec_key_t)__parsec_id;
+}
+static char *__jdf2c_key_fns_RECV_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_a2a_internal_taskpool_t *__parsec_tp = (__parsec_a2a_internal_taskpool_t *)user_data;
+  int r = (__parsec_key) % __parsec_tp->RECV_r_range + __parsec_tp->RECV_r_min;
+  __parsec_key = __parsec_key / __parsec_tp->RECV_r_range;
+  int t = (__parsec_key) % __parsec_tp->RECV_t_range + __parsec_tp->RECV_t_min;
+  __parsec_key = __parsec_key / __parsec_tp->RECV_t_range;
+  int s = (__parsec_key) % __parsec_tp->RECV_s_range + __parsec_tp->RECV_s_min;
+  __parsec_key = __parsec_key / __parsec_tp->RECV_s_range;
+  snprintf(buffer, buffer_size, "RECV(%d, %d, %d)", r, t, s);
+  return buffer;
+}
+
+static parsec_key_fn_t __jdf2c_key_fns_RECV = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = __jdf2c_key_fns_RECV_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+static inline parsec_key_t __jdf2c_make_key_SEND(const parsec_taskpool_t *tp, const parsec_assignment_t *as)
+{
+  const __parsec_a2a_internal_taskpool_t *__parsec_tp = (const __parsec_a2a_internal_taskpool_t *)tp;
+  const __parsec_a2a_SEND_parsec_assignment_t *assignment = (const __parsec_a2a_SEND_parsec_assignment_t*)as;
+  uint64_t __parsec_id = 0;
+  __parsec_id += (assignment->r.value - __parsec_tp->SEND_r_min);
+  __parsec_id += (assignment->t.value - __parsec_tp->SEND_t_min) * __parsec_tp->SEND_r_range;
+  __parsec_id += (assignment->s.value - __parsec_tp->SEND_s_min) * __parsec_tp->SEND_r_range * __parsec_tp->SEND_t_range;
+  return (parsec_key_t)__parsec_id;
+}
+static char *__jdf2c_key_fns_SEND_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_a2a_internal_taskpool_t *__parsec_tp = (__parsec_a2a_internal_taskpool_t *)user_data;
+  int r = (__parsec_key) % __parsec_tp->SEND_r_range + __parsec_tp->SEND_r_min;
+  __parsec_key = __parsec_key / __parsec_tp->SEND_r_range;
+  int t = (__parsec_key) % __parsec_tp->SEND_t_range + __parsec_tp->SEND_t_min;
+  __parsec_key = __parsec_key / __parsec_tp->SEND_t_range;
+  int s = (__parsec_key) % __parsec_tp->SEND_s_range + __parsec_tp->SEND_s_min;
+  __parsec_key = __parsec_key / __parsec_tp->SEND_s_range;
+  snprintf(buffer, buffer_size, "SEND(%d, %d, %d)", r, t, s);
+  return buffer;
+}
+
+static parsec_key_fn_t __jdf2c_key_fns_SEND = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = __jdf2c_key_fns_SEND_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+static inline parsec_key_t __jdf2c_make_key_FANOUT(const parsec_taskpool_t *tp, const parsec_assignment_t *as)
+{
+  const __parsec_a2a_internal_taskpool_t *__parsec_tp = (const __parsec_a2a_internal_taskpool_t *)tp;
+  const __parsec_a2a_FANOUT_parsec_assignment_t *assignment = (const __parsec_a2a_FANOUT_parsec_assignment_t*)as;
+  uint64_t __parsec_id = 0;
+  __parsec_id += (assignment->r.value - __parsec_tp->FANOUT_r_min);
+  __parsec_id += (assignment->t.value - __parsec_tp->FANOUT_t_min) * __parsec_tp->FANOUT_r_range;
+  return (parsec_key_t)__parsec_id;
+}
+static char *__jdf2c_key_fns_FANOUT_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_a2a_internal_taskpool_t *__parsec_tp = (__parsec_a2a_internal_taskpool_t *)user_data;
+  int r = (__parsec_key) % __parsec_tp->FANOUT_r_range + __parsec_tp->FANOUT_r_min;
+  __parsec_key = __parsec_key / __parsec_tp->FANOUT_r_range;
+  int t = (__parsec_key) % __parsec_tp->FANOUT_t_range + __parsec_tp->FANOUT_t_min;
+  __parsec_key = __parsec_key / __parsec_tp->FANOUT_t_range;
+  snprintf(buffer, buffer_size, "FANOUT(%d, %d)", r, t);
+  return buffer;
+}
+
+static parsec_key_fn_t __jdf2c_key_fns_FANOUT = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = __jdf2c_key_fns_FANOUT_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+static inline parsec_key_t __jdf2c_make_key_READER_B(const parsec_taskpool_t *tp, const parsec_assignment_t *as)
+{
+  const __parsec_a2a_internal_taskpool_t *__parsec_tp = (const __parsec_a2a_internal_taskpool_t *)tp;
+  const __parsec_a2a_READER_B_parsec_assignment_t *assignment = (const __parsec_a2a_READER_B_parsec_assignment_t*)as;
+  uint64_t __parsec_id = 0;
+  __parsec_id += (assignment->r.value - __parsec_tp->READER_B_r_min);
+  __parsec_id += (assignment->t.value - __parsec_tp->READER_B_t_min) * __parsec_tp->READER_B_r_range;
+  return (parsec_key_t)__parsec_id;
+}
+static char *__jdf2c_key_fns_READER_B_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_a2a_internal_taskpool_t *__parsec_tp = (__parsec_a2a_internal_taskpool_t *)user_data;
+  int r = (__parsec_key) % __parsec_tp->READER_B_r_range + __parsec_tp->READER_B_r_min;
+  __parsec_key = __parsec_key / __parsec_tp->READER_B_r_range;
+  int t = (__parsec_key) % __parsec_tp->READER_B_t_range + __parsec_tp->READER_B_t_min;
+  __parsec_key = __parsec_key / __parsec_tp->READER_B_t_range;
+  snprintf(buffer, buffer_size, "READER_B(%d, %d)", r, t);
+  return buffer;
+}
+
+static parsec_key_fn_t __jdf2c_key_fns_READER_B = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = __jdf2c_key_fns_READER_B_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/******                                    FANIN                                      ******/
+
+static inline int32_t minexpr_of_symb_a2a_FANIN_r_fct(const __parsec_a2a_internal_taskpool_t *__parsec_tp, const __parsec_a2a_FANIN_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_a2a_FANIN_r = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_a2a_FANIN_r_fct }
+                   }
+};
+static inline int maxexpr_of_symb_a2a_FANIN_r_fct(const __parsec_a2a_internal_taskpool_t *__parsec_tp, const __parsec_a2a_FANIN_parsec_assignment_t *locals)
+{
+  const int r = locals->r.value; (void)r;
+  const int t = locals->t.value; (void)t;
+
+  (void)r;
+  (void)t;
+  (void)__parsec_tp; (void)locals;
+  return (NR - 1);
+}
+static const parsec_expr_t maxexpr_of_symb_a2a_FANIN_r = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_a2a_FANIN_r_fct }
+                   }
+};
+static const parsec_symbol_t symb_a2a_FANIN_r = { .name = "r", .context_index = 0, .min = &minexpr_of_symb_a2a_FANIN_r, .max = &maxexpr_of_symb_a2a_FANIN_r, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int32_t minexpr_of_symb_a2a_FANIN_t_fct(const __parsec_a2a_internal_taskpool_t *__parsec_tp, const __parsec_a2a_FANIN_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_a2a_FANIN_t = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_a2a_FANIN_t_fct }
+                   }
+};
+static inline int maxexpr_of_symb_a2a_FANIN_t_fct(const __parsec_a2a_internal_taskpool_t *__parsec_tp, const __parsec_a2a_FANIN_parsec_assignment_t *locals)
+{
+  const int r = locals->r.value; (void)r;
+  const int t = locals->t.value; (void)t;
+
+  (void)r;
+  (void)t;
+  (void)__parsec_tp; (void)locals;
+  return (NT - 1);
+}
+static const parsec_expr_t maxexpr_of_symb_a2a_FANIN_t = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_a2a_FANIN_t_fct }
+                   }
+};
+static const parsec_symbol_t symb_a2a_FANIN_t = { .name = "t", .context_index = 1, .min = &minexpr_of_symb_a2a_FANIN_t, .max = &maxexpr_of_symb_a2a_FANIN_t, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int affinity_of_a2a_FANIN(const __parsec_a2a_FANIN_task_t *this_task,
+                     parsec_data_ref_t *ref)
+{
+    const __parsec_a2a_internal_taskpool_t *__parsec_tp = (const __parsec_a2a_internal_taskpool_t*)this_task->taskpool;
+  const int r = this_task->locals.r.value; (void)r;
+  const int t = this_task->locals.t.value; (void)t;
+
+  /* Silent Warnings: should look into predicate to know what variables are usefull */
+  (void)r;
+  (void)t;
+  ref->dc = (parsec_data_collection_t *)__parsec_tp->super._g_descB;
+  /* Compute data key */
+  ref->key = ref->dc->data_key(ref->dc, t, 0);
+  return 1;
+}
+static const parsec_property_t properties_of_a2a_FANIN[1] = {
+  {.name = NULL, .expr = NULL}
+};
+static const parsec_dep_t flow_of_a2a_FANIN_for_A_dep1_atline_95 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 0, /* a2a_READER_B */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_a2a_READER_B_for_B,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_a2a_FANIN_for_A,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_a2a_FANIN_for_A = {
+  .name               = "A",
+  .sym_type           = PARSEC_SYM_IN,
+  .flow_flags         = PARSEC_FLOW_ACCESS_READ,
+  .flow_index         = 0,
+  .flow_datatype_mask = 0x0,
+  .dep_in     = { &flow_of_a2a_FANIN_for_A_dep1_atline_95 },
+  .dep_out    = { NULL }
+};
+
+static inline int ctl_gather_compute_for_dep_flow_of_a2a_FANIN_for_T_dep1_atline_96_fct(const __parsec_a2a_internal_taskpool_t *__parsec_tp, const __parsec_a2a_FANIN_parsec_assignment_t *assignments)
+{
+  int   __nb_found = 0;
+  __parsec_a2a_FANIN_parsec_assignment_t __jdf2c__tmp_locals = *assignments;
+  (void)__parsec_tp;
+  const int r = __jdf2c__tmp_locals.r.value; (void)r;
+  const int t = __jdf2c__tmp_locals.t.value; (void)t;
+  (void)r; (void)t;
+  int RECV_r = r;
+  (void)RECV_r;
+  int RECV_s = t;
+  (void)RECV_s;
+  {
+    int RECV_t;
+    for(RECV_t  = 0;
+        RECV_t <= (NT - 1);
+        RECV_t += 1) {
+      __nb_found++;
+    }
+  }
+  return __nb_found;
+}
+
+static const parsec_expr_t ctl_gather_compute_for_dep_flow_of_a2a_FANIN_for_T_dep1_atline_96 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)ctl_gather_compute_for_dep_flow_of_a2a_FANIN_for_T_dep1_atline_96_fct }
+                   }
+};
+
+static const parsec_dep_t flow_of_a2a_FANIN_for_T_dep1_atline_96 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = &ctl_gather_compute_for_dep_flow_of_a2a_FANIN_for_T_dep1_atline_96,
+  .task_class_id = 3, /* a2a_RECV */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_a2a_RECV_for_T,
+  .dep_index = 1,
+  .dep_datatype_index = 1,
+  .belongs_to = &flow_of_a2a_FANIN_for_T,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_a2a_FANIN_for_T = {
+  .name               = "T",
+  .sym_type           = PARSEC_SYM_IN,
+  .flow_flags         = PARSEC_FLOW_ACCESS_NONE,
+  .flow_index         = 1,
+  .flow_datatype_mask = 0x0,
+  .dep_in     = { &flow_of_a2a_FANIN_for_T_dep1_atline_96 },
+  .dep_out    = { NULL }
+};
+
+static void
+iterate_predecessors_of_a2a_FANIN(parsec_execution_stream_t *es, const __parsec_a2a_FANIN_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_a2a_internal_taskpool_t *__parsec_tp = (const __parsec_a2a_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_a2a_FANIN_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_a2a_FANIN_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int r = __jdf2c__tmp_locals.r.value; (void)r;
+  const int t = __jdf2c__tmp_locals.t.value; (void)t;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)r;  (void)t;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_descB(t, 0);
+#endif
+  if( action_mask & 0x1 ) {  /* Flow of data A [0] */
+    data.data   = this_task->data._f_A.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x1 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_a2a_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_a2a_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        __parsec_a2a_READER_B_task_t* ncc = (__parsec_a2a_READER_B_task_t*)&nc;
+    nc.task_class = __parsec_tp->super.super.task_classes_array[a2a_READER_B.task_class_id];
+      const int READER_B_r = r;
+      if( (READER_B_r >= (0)) && (READER_B_r <= ((NR - 1))) ) {
+        assert(&nc.locals[0].value == &ncc->locals.r.value);
+        ncc->locals.r.value = READER_B_r;
+        const int READER_B_t = t;
+        if( (READER_B_t >= (0)) && (READER_B_t <= ((NT - 1))) ) {
+          assert(&nc.locals[1].value == &ncc->locals.t.value);
+          ncc->locals.t.value = READER_B_t;
+#if defined(DISTRIBUTED)
+          rank_dst = rank_of_descB(ncc->locals.t.value, 0);
+          if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+            vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descB)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descB, ncc->locals.t.value, 0);
+          nc.priority = __parsec_tp->super.super.priority;
+          successor_repo = READER_B_repo;
+          successor_repo_key = __jdf2c_make_key_READER_B((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+        RELEASE_DEP_OUTPUT(es, "A", this_task, "B", &nc, rank_src, rank_dst, &data);
+        if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_a2a_FANIN_for_A_dep1_atline_95, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+          }
+        }
+  }
+  }
+  if( action_mask & 0x2 ) {  /* Flow of data T [1] */
+    data.data   = this_task->data._f_T.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x2 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  =   /* Control: always empty */ 0;
+    data.local.dst_count  =   /* Control: always empty */ 0;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = NULL;
+    data.remote.src_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.src_count  =   /* Control: always empty */ 0;
+    data.remote.dst_count  =   /* Control: always empty */ 0;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        __parsec_a2a_RECV_task_t* ncc = (__parsec_a2a_RECV_task_t*)&nc;
+    nc.task_class = __parsec_tp->super.super.task_classes_array[a2a_RECV.task_class_id];
+      const int RECV_r = r;
+      if( (RECV_r >= (0)) && (RECV_r <= ((NR - 1))) ) {
+        assert(&nc.locals[0].value == &ncc->locals.r.value);
+        ncc->locals.r.value = RECV_r;
+        int RECV_t;
+      for( RECV_t = 0;RECV_t <= (NT - 1); RECV_t+=1) {
+          if( (RECV_t >= (0)) && (RECV_t <= ((NT - 1))) ) {
+            assert(&nc.locals[1].value == &ncc->locals.t.value);
+            ncc->locals.t.value = RECV_t;
+            const int RECV_s = t;
+            if( (RECV_s >= (0)) && (RECV_s <= ((NT - 1))) ) {
+              assert(&nc.locals[2].value == &ncc->locals.s.value);
+              ncc->locals.s.value = RECV_s;
+#if defined(DISTRIBUTED)
+              rank_dst = rank_of_descB(ncc->locals.t.value, 0);
+              if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+                vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descB)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descB, ncc->locals.t.value, 0);
+              nc.priority = __parsec_tp->super.super.priority;
+              successor_repo = RECV_repo;
+              successor_repo_key = __jdf2c_make_key_RECV((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+            RELEASE_DEP_OUTPUT(es, "T", this_task, "T", &nc, rank_src, rank_dst, &data);
+            if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_a2a_FANIN_for_T_dep1_atline_96, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+              }
+            }
+          }
+        }
+  }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static int release_deps_of_a2a_FANIN(parsec_execution_stream_t *es, __parsec_a2a_FANIN_task_t *this_task, uint32_t action_mask, parsec_remote_deps_t *deps)
+{
+  PARSEC_PINS(es, RELEASE_DEPS_BEGIN, (parsec_task_t *)this_task);  const __parsec_a2a_internal_taskpool_t *__parsec_tp = (const __parsec_a2a_internal_taskpool_t *)this_task->taskpool;
+  parsec_release_dep_fct_arg_t arg;
+  int __vp_id;
+  int consume_local_repo = 0;
+  arg.action_mask = action_mask;
+  arg.output_entry = NULL;
+  arg.output_repo = NULL;
+#if defined(DISTRIBUTED)
+  arg.remote_deps = deps;
+#endif  /* defined(DISTRIBUTED) */
+  assert(NULL != es);
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS )    arg.ready_lists = alloca(sizeof(parsec_task_t *) * es->virtual_process->parsec_context->nb_vp);
+  else
+    arg.ready_lists = NULL;
+  for( __vp_id = 0; __vp_id < es->virtual_process->parsec_context->nb_vp; arg.ready_lists[__vp_id++] = NULL );
+  (void)__parsec_tp; (void)deps;
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_A.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_A.source_repo, this_task->data._f_A.source_repo_entry->ht_item.key );
+    }
+  }
+  consume_local_repo = (this_task->repo_entry != NULL);
+  /* No successors, don't call iterate_successors and don't release any local deps */
+      if (consume_local_repo) {
+         data_repo_entry_used_once( FANIN_repo, this_task->repo_entry->ht_item.key );
+      }
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_A.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_A.data_in);
+    }
+  }
+  PARSEC_PINS(es, RELEASE_DEPS_END, (parsec_task_t *)this_task);  return 0;
+}
+
+static int data_lookup_of_a2a_FANIN(parsec_execution_stream_t *es, __parsec_a2a_FANIN_task_t *this_task)
+{
+  const __parsec_a2a_internal_taskpool_t *__parsec_tp = (__parsec_a2a_internal_taskpool_t *)this_task->taskpool;
+  parsec_assignment_t generic_locals[MAX_PARAM_COUNT];  /* generic task locals */
+  int target_device = 0; (void)target_device;
+  (void)__parsec_tp; (void)generic_locals; (void)es;
+  parsec_data_copy_t *chunk = NULL;
+  data_repo_t        *reshape_repo  = NULL, *consumed_repo  = NULL;
+  data_repo_entry_t  *reshape_entry = NULL, *consumed_entry = NULL;
+  parsec_key_t        reshape_entry_key = 0, consumed_entry_key = 0;
+  uint8_t             consumed_flow_index;
+  parsec_dep_data_description_t data;
+  int ret;
+  (void)reshape_repo; (void)reshape_entry; (void)reshape_entry_key;
+  (void)consumed_repo; (void)consumed_entry; (void)consumed_entry_key;
+  (void)consumed_flow_index;
+  (void)chunk; (void)data; (void)ret;
+  const int r = this_task->locals.r.value; (void)r;
+  const int t = this_task->locals.t.value; (void)t;
+  if( NULL == this_task->repo_entry ){
+    this_task->repo_entry = data_repo_lookup_entry_and_create(es, FANIN_repo,                                       __jdf2c_make_key_FANIN((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    data_repo_entry_addto_usage_limit(FANIN_repo, this_task->repo_entry->ht_item.key, 1);    this_task->repo_entry ->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(this_task->repo_entry ->sim_exec_date == 0);
+    this_task->repo_entry ->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  /* The reshape repo is the current task repo. */  reshape_repo = FANIN_repo;
+  reshape_entry_key = __jdf2c_make_key_FANIN((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals) ;
+  reshape_entry = this_task->repo_entry;
+  /* Lookup the input data, and store them in the context if any */
+
+if(! this_task->data._f_A.fulfill ){ /* Flow A */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_A.data_out = NULL;  /* input only */
+  /* Flow A [0] dependency [0] from predecessor READER_B */
+  if( NULL == (chunk = this_task->data._f_A.data_in) ) {
+  /* No data set up by predecessor on this task input flow */
+__parsec_a2a_READER_B_parsec_assignment_t *target_locals = (__parsec_a2a_READER_B_parsec_assignment_t*)&generic_locals;
+  const int READER_Br = target_locals->r.value = r; (void)READER_Br;
+  const int READER_Bt = target_locals->t.value = t; (void)READER_Bt;
+    if( (reshape_entry != NULL) && (reshape_entry->data[0] != NULL) ){
+        /* Reshape promise set up on this task repo by predecessor */
+        consumed_repo = reshape_repo;
+        consumed_entry = reshape_entry;
+        consumed_entry_key = reshape_entry_key;
+        consumed_flow_index = 0;
+    }else{
+        /* Consume from predecessor's repo */
+        consumed_repo = READER_B_repo;
+        consumed_entry_key = __jdf2c_make_key_READER_B((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)target_locals) ;
+        consumed_entry = data_repo_lookup_entry( consumed_repo, consumed_entry_key );
+        consumed_flow_index = 0;
+    }
+    data.data   = NULL;
+    data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+        data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    ACQUIRE_FLOW(this_task, "A", &a2a_READER_B, "B", target_locals, chunk);
+    this_task->data._f_A.data_out = chunk;
+  } 
+  else {
+    /* Data set up by predecessor on this task input flow */
+    consumed_repo = this_task->data._f_A.source_repo;
+    consumed_entry = this_task->data._f_A.source_repo_entry;
+    consumed_entry_key = this_task->data._f_A.source_repo_entry->ht_item.key;
+    if( (reshape_entry != NULL) && (reshape_entry->data[0] != NULL) ){
+        /* Reshape promise set up on input by predecessor is on this task repo */
+        consumed_flow_index = 0;
+        assert( (this_task->data._f_A.source_repo == reshape_repo)
+             && (this_task->data._f_A.source_repo_entry == reshape_entry));
+    }else{
+        /* Reshape promise set up on input by predecessor is the predecesssor task repo */
+        consumed_flow_index = 0;
+    }
+    data.data   = NULL;
+    data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+        data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    this_task->data._f_A.data_out = parsec_data_get_copy(chunk->original, target_device);
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+    parsec_prof_grapher_data_input(chunk->original, (parsec_task_t*)this_task, &flow_of_a2a_FANIN_for_A, 0);
+#endif
+  }
+    this_task->data._f_A.data_in     = chunk;
+    this_task->data._f_A.source_repo       = consumed_repo;
+    this_task->data._f_A.source_repo_entry = consumed_entry;
+    this_task->data._f_A.fulfill = 1;
+}
+
+  /* T is a control flow */
+  this_task->data._f_T.data_in         = NULL;
+  this_task->data._f_T.data_out        = NULL;
+  this_task->data._f_T.source_repo       = NULL;
+  this_task->data._f_T.source_repo_entry = NULL;
+  /** Generate profiling information */
+#if defined(PARSEC_PROF_TRACE)
+  this_task->prof_info.desc = (parsec_data_collection_t*)__parsec_tp->super._g_descB;
+  this_task->prof_info.priority = this_task->priority;
+  this_task->prof_info.data_id   = ((parsec_data_collection_t*)__parsec_tp->super._g_descB)->data_key((parsec_data_collection_t*)__parsec_tp->super._g_descB, t, 0);
+  this_task->prof_info.task_class_id = this_task->task_class->task_class_id;
+  this_task->prof_info.task_return_code = -1;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int datatype_lookup_of_a2a_FANIN(parsec_execution_stream_t *es, const parsec_task_t *this_generic_task, const parsec_task_t *parent_task,
+              uint32_t* flow_mask, parsec_dep_data_description_t* data)
+{
+  const __parsec_a2a_FANIN_task_t *this_task = (__parsec_a2a_FANIN_task_t*)this_generic_task;
+  const __parsec_a2a_internal_taskpool_t *__parsec_tp = (__parsec_a2a_internal_taskpool_t *)this_task->taskpool;
+  (void)__parsec_tp; (void)es; (void)this_task; (void)data; (void)parent_task;
+  const int r = this_task->locals.r.value; (void)r;
+  const int t = this_task->locals.t.value; (void)t;
+  data->local.arena = data->remote.arena = NULL;
+  data->local.src_datatype  = data->local.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->local.src_count     = data->local.dst_count = 0;
+  data->local.src_displ     = data->local.dst_displ = 0;
+  data->data_future  = NULL;
+  if( (*flow_mask) & 0x80000000U ) { /* these are the input dependencies remote datatypes  */
+if( (*flow_mask) & 0x1U ) {  /* Flow A */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_a2a_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_a2a_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_a2a_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+    goto no_mask_match;
+  }
+
+  /* these are the output dependencies remote datatypes */
+ no_mask_match:
+  data->data                             = NULL;
+  data->remote.src_datatype = data->remote.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->remote.src_count    = data->remote.dst_count = 0;
+  data->remote.src_displ    = data->remote.dst_displ = 0;
+  data->data_future  = NULL;
+  (*flow_mask) = 0;  /* nothing left */
+  (void)r;  (void)t;
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+static int hook_of_a2a_FANIN(parsec_execution_stream_t *es, __parsec_a2a_FANIN_task_t *this_task)
+{
+  __parsec_a2a_internal_taskpool_t *__parsec_tp = (__parsec_a2a_internal_taskpool_t *)this_task->taskpool;
+  (void)es; (void)__parsec_tp;
+  const int r = this_task->locals.r.value; (void)r;
+  const int t = this_task->locals.t.value; (void)t;
+  (void)r;  (void)t;
+
+  /** Declare the variables that will hold the data, and all the accounting for each */
+  parsec_data_copy_t *_f_A = this_task->data._f_A.data_in;
+  void *A = PARSEC_DATA_COPY_GET_PTR(_f_A); (void)A;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    data_repo_entry_t *eA = this_task->data._f_A.source_repo_entry;
+    if( (NULL != eA) && (eA->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eA->sim_exec_date;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+  /** Cache Awareness Accounting */
+#if defined(PARSEC_CACHE_AWARENESS)
+  cache_buf_referenced(es->closest_cache, A);
+#endif /* PARSEC_CACHE_AWARENESS */
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                                  FANIN BODY                                  -----*/
+
+
+/*-----                              END OF FANIN BODY                                -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#endif  /*  defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+static int complete_hook_of_a2a_FANIN(parsec_execution_stream_t *es, __parsec_a2a_FANIN_task_t *this_task)
+{
+  const __parsec_a2a_internal_taskpool_t *__parsec_tp = (__parsec_a2a_internal_taskpool_t *)this_task->taskpool;
+#if defined(DISTRIBUTED)
+    const int r = this_task->locals.r.value; (void)r;
+  const int t = this_task->locals.t.value; (void)t;
+#endif  /* defined(DISTRIBUTED) */
+  (void)es; (void)__parsec_tp;
+parsec_data_t* data_t_desc = NULL; (void)data_t_desc;
+#if defined(DISTRIBUTED)
+  /** If not working on distributed, there is no risk that data is not in place */
+  (void)r;  (void)t;
+
+#endif /* DISTRIBUTED */
+#if defined(PARSEC_PROF_GRAPHER)
+  parsec_prof_grapher_task((parsec_task_t*)this_task, es->th_id, es->virtual_process->vp_id,
+     __jdf2c_key_fns_FANIN.key_hash(this_task->task_class->make_key( (parsec_taskpool_t*)this_task->taskpool, ((parsec_task_t*)this_task)->locals), NULL));
+#endif  /* defined(PARSEC_PROF_GRAPHER) */
+  release_deps_of_a2a_FANIN(es, this_task,
+      PARSEC_ACTION_RELEASE_REMOTE_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_REFS |
+      PARSEC_ACTION_RESHAPE_ON_RELEASE |
+      0x0,  /* mask of all dep_index */ 
+      NULL);
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static parsec_hook_return_t release_task_of_a2a_FANIN(parsec_execution_stream_t *es, parsec_task_t *this_task)
+{
+    const __parsec_a2a_internal_taskpool_t *__parsec_tp =
+        (const __parsec_a2a_internal_taskpool_t *)this_task->taskpool;
+    parsec_hash_table_t *ht = (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[4];
+    parsec_key_t key = this_task->task_class->make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals);
+    parsec_hashable_dependency_t *hash_dep = (parsec_hashable_dependency_t *)parsec_hash_table_remove(ht, key);
+    parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);
+    return parsec_release_task_to_mempool_update_nbtasks(es, this_task);
+}
+
+static char *a2a_a2a_FANIN_internal_init_deps_key_functions_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_a2a_internal_taskpool_t *__parsec_tp = (__parsec_a2a_internal_taskpool_t *)user_data;
+  int r = (__parsec_key) % __parsec_tp->FANIN_r_range + __parsec_tp->FANIN_r_min;
+  __parsec_key = __parsec_key / __parsec_tp->FANIN_r_range;
+  int t = (__parsec_key) % __parsec_tp->FANIN_t_range + __parsec_tp->FANIN_t_min;
+  __parsec_key = __parsec_key / __parsec_tp->FANIN_t_range;
+  snprintf(buffer, buffer_size, "FANIN(%d, %d)", r, t);
+  return buffer;
+}
+
+static parsec_key_fn_t a2a_a2a_FANIN_internal_init_deps_key_functions = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = a2a_a2a_FANIN_internal_init_deps_key_functions_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/* Needs: min-max count-tasks iterate */
+static int a2a_FANIN_internal_init(parsec_execution_stream_t * es, __parsec_a2a_FANIN_task_t * this_task)
+{
+  __parsec_a2a_internal_taskpool_t *__parsec_tp = (__parsec_a2a_internal_taskpool_t*)this_task->taskpool;
+  int32_t nb_tasks = 0, saved_nb_tasks = 0;
+int32_t __r_min = 0x7fffffff, __r_max = 0;int32_t __jdf2c_r_min = 0x7fffffff, __jdf2c_r_max = 0;int32_t __t_min = 0x7fffffff, __t_max = 0;int32_t __jdf2c_t_min = 0x7fffffff, __jdf2c_t_max = 0;  __parsec_a2a_FANIN_parsec_assignment_t assignments = {  .r.value = 0, .t.value = 0 };
+  int32_t  r,  t;
+  int32_t __jdf2c_r_start, __jdf2c_r_end, __jdf2c_r_inc;
+  int32_t __jdf2c_t_start, __jdf2c_t_end, __jdf2c_t_inc;
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+  PARSEC_PROFILING_TRACE(es->es_profile,
+                         this_task->taskpool->profiling_array[START_KEY(this_task->task_class->task_class_id)],
+                         0,
+                         this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    __jdf2c_r_start = 0;
+    __jdf2c_r_end = (NR - 1);
+    __jdf2c_r_inc = 1;
+    __r_min = parsec_imin(__jdf2c_r_start, __jdf2c_r_end);
+    __r_max = parsec_imax(__jdf2c_r_start, __jdf2c_r_end);
+    __jdf2c_r_min = parsec_imin(__jdf2c_r_min, __r_min);
+    __jdf2c_r_max = parsec_imax(__jdf2c_r_max, __r_max);
+    for(r =  __jdf2c_r_start;
+        r <= __jdf2c_r_end;
+        r += __jdf2c_r_inc) {
+    assignments.r.value = r;
+      __jdf2c_t_start = 0;
+      __jdf2c_t_end = (NT - 1);
+      __jdf2c_t_inc = 1;
+      __t_min = parsec_imin(__jdf2c_t_start, __jdf2c_t_end);
+      __t_max = parsec_imax(__jdf2c_t_start, __jdf2c_t_end);
+      __jdf2c_t_min = parsec_imin(__jdf2c_t_min, __t_min);
+      __jdf2c_t_max = parsec_imax(__jdf2c_t_max, __t_max);
+      for(t =  __jdf2c_t_start;
+          t <= __jdf2c_t_end;
+          t += __jdf2c_t_inc) {
+      assignments.t.value = t;
+      if( !FANIN_pred(r, t) ) continue;
+      nb_tasks++;
+    } /* Loop on normal range t */
+  } /* For loop of r */ 
+   if( 0 != nb_tasks ) {
+     (void)parsec_atomic_fetch_add_int32(&__parsec_tp->initial_number_tasks, nb_tasks);
+   }
+  /* Set the range variables for the collision-free hash-computation */
+  __parsec_tp->FANIN_r_min   = __jdf2c_r_min;
+  __parsec_tp->FANIN_r_range = (__jdf2c_r_max - __jdf2c_r_min) + 1;
+  __parsec_tp->FANIN_t_min   = __jdf2c_t_min;
+  __parsec_tp->FANIN_t_range = (__jdf2c_t_max - __jdf2c_t_min) + 1;
+  this_task->status = PARSEC_TASK_STATUS_COMPLETE;
+
+  PARSEC_AYU_REGISTER_TASK(&a2a_FANIN);
+  __parsec_tp->super.super.dependencies_array[4] = PARSEC_OBJ_NEW(parsec_hash_table_t);
+  parsec_hash_table_init(__parsec_tp->super.super.dependencies_array[4], offsetof(parsec_hashable_dependency_t, ht_item), 10, a2a_a2a_FANIN_internal_init_deps_key_functions, this_task->taskpool);
+  __parsec_tp->repositories[4] = data_repo_create_nothreadsafe(nb_tasks, __jdf2c_key_fns_FANIN, (parsec_taskpool_t*)__parsec_tp, 2);
+(void)saved_nb_tasks;
+(void)__r_min; (void)__r_max;(void)__t_min; (void)__t_max;  (void)__jdf2c_r_start; (void)__jdf2c_r_end; (void)__jdf2c_r_inc;  (void)__jdf2c_t_start; (void)__jdf2c_t_end; (void)__jdf2c_t_inc;  (void)assignments; (void)__parsec_tp; (void)es;
+  if(1 == parsec_atomic_fetch_dec_int32(&__parsec_tp->sync_point)) {
+    /* Last initialization task complete. Update the number of tasks. */
+    __parsec_tp->super.super.tdm.module->taskpool_addto_nb_tasks(&__parsec_tp->super.super, __parsec_tp->initial_number_tasks);
+    parsec_mfence();  /* write memory barrier to guarantee that the scheduler gets the correct number of tasks */
+    parsec_taskpool_enable((parsec_taskpool_t*)__parsec_tp, &__parsec_tp->startup_queue,
+                           (parsec_task_t*)this_task, es, __parsec_tp->super.super.nb_pending_actions);
+    __parsec_tp->super.super.tdm.module->taskpool_ready(&__parsec_tp->super.super);
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+    PARSEC_PROFILING_TRACE(es->es_profile,
+                           this_task->taskpool->profiling_array[2 * this_task->task_class->task_class_id + 1],
+                           0,
+                           this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    return PARSEC_HOOK_RETURN_DONE;
+  }
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static const __parsec_chore_t __a2a_FANIN_chores[] ={
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+    { .type     = PARSEC_DEV_CPU,
+      .evaluate = (parsec_evaluate_function_t*)NULL,
+      .hook     = (parsec_hook_t*)hook_of_a2a_FANIN },
+#endif  /* defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+    { .type     = PARSEC_DEV_NONE,
+      .evaluate = NULL,
+      .hook     = (parsec_hook_t*)NULL },  /* End marker */
+};
+
+static const parsec_task_class_t a2a_FANIN = {
+  .name = "FANIN",
+  .task_class_id = 4,
+  .nb_flows = 2,
+  .nb_parameters = 2,
+  .nb_locals = 2,
+  .task_class_type = PARSEC_TASK_CLASS_TYPE_PTG,
+  .params = { &symb_a2a_FANIN_r, &symb_a2a_FANIN_t, NULL },
+  .locals = { &symb_a2a_FANIN_r, &symb_a2a_FANIN_t, NULL },
+  .data_affinity = (parsec_data_ref_fn_t*)affinity_of_a2a_FANIN,
+  .initial_data = (parsec_data_ref_fn_t*)affinity_of_a2a_FANIN,
+  .final_data = (parsec_data_ref_fn_t*)affinity_of_a2a_FANIN,
+  .priority = NULL,
+  .properties = properties_of_a2a_FANIN,
+#if MAX_PARAM_COUNT < 1  /* number of read flows of FANIN */
+  #error Too many read flows for task FANIN
+#endif  /* MAX_PARAM_COUNT */
+#if MAX_PARAM_COUNT < 0  /* number of write flows of FANIN */
+  #error Too many write flows for task FANIN
+#endif  /* MAX_PARAM_COUNT */
+  .in = { &flow_of_a2a_FANIN_for_A, &flow_of_a2a_FANIN_for_T, NULL },
+  .out = { NULL },
+  .flags = 0x0|PARSEC_HAS_CTL_GATHER,
+  .dependencies_goal = 2,
+  .make_key = __jdf2c_make_key_FANIN,
+  .task_snprintf = parsec_task_snprintf,
+#if defined(PARSEC_PROF_TRACE)
+  .profile_info = &parsec_task_profile_info,
+#endif
+  .key_functions = &__jdf2c_key_fns_FANIN,
+  .fini = (parsec_hook_t*)NULL,
+  .incarnations = __a2a_FANIN_chores,
+  .find_deps = parsec_hash_find_deps,
+  .update_deps = parsec_update_deps_with_counter,
+  .iterate_successors = (parsec_traverse_function_t*)NULL,
+  .iterate_predecessors = (parsec_traverse_function_t*)iterate_predecessors_of_a2a_FANIN,
+  .release_deps = (parsec_release_deps_t*)release_deps_of_a2a_FANIN,
+  .prepare_output = (parsec_hook_t*)NULL,
+  .prepare_input = (parsec_hook_t*)data_lookup_of_a2a_FANIN,
+  .time_estimate = NULL,
+  .get_datatype = datatype_lookup_of_a2a_FANIN,
+  .complete_execution = (parsec_hook_t*)complete_hook_of_a2a_FANIN,
+  .release_task = &release_task_of_a2a_FANIN,
+#if defined(PARSEC_SIM)
+  .sim_cost_fct = (parsec_sim_cost_fct_t*)NULL,
+#endif
+};
+
+
+/******                                      RECV                                      ******/
+
+static inline int32_t minexpr_of_symb_a2a_RECV_r_fct(const __parsec_a2a_internal_taskpool_t *__parsec_tp, const __parsec_a2a_RECV_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_a2a_RECV_r = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_a2a_RECV_r_fct }
+                   }
+};
+static inline int maxexpr_of_symb_a2a_RECV_r_fct(const __parsec_a2a_internal_taskpool_t *__parsec_tp, const __parsec_a2a_RECV_parsec_assignment_t *locals)
+{
+  const int r = locals->r.value; (void)r;
+  const int t = locals->t.value; (void)t;
+  const int s = locals->s.value; (void)s;
+
+  (void)r;
+  (void)t;
+  (void)s;
+  (void)__parsec_tp; (void)locals;
+  return (NR - 1);
+}
+static const parsec_expr_t maxexpr_of_symb_a2a_RECV_r = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_a2a_RECV_r_fct }
+                   }
+};
+static const parsec_symbol_t symb_a2a_RECV_r = { .name = "r", .context_index = 0, .min = &minexpr_of_symb_a2a_RECV_r, .max = &maxexpr_of_symb_a2a_RECV_r, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int32_t minexpr_of_symb_a2a_RECV_t_fct(const __parsec_a2a_internal_taskpool_t *__parsec_tp, const __parsec_a2a_RECV_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_a2a_RECV_t = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_a2a_RECV_t_fct }
+                   }
+};
+static inline int maxexpr_of_symb_a2a_RECV_t_fct(const __parsec_a2a_internal_taskpool_t *__parsec_tp, const __parsec_a2a_RECV_parsec_assignment_t *locals)
+{
+  const int r = locals->r.value; (void)r;
+  const int t = locals->t.value; (void)t;
+  const int s = locals->s.value; (void)s;
+
+  (void)r;
+  (void)t;
+  (void)s;
+  (void)__parsec_tp; (void)locals;
+  return (NT - 1);
+}
+static const parsec_expr_t maxexpr_of_symb_a2a_RECV_t = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_a2a_RECV_t_fct }
+                   }
+};
+static const parsec_symbol_t symb_a2a_RECV_t = { .name = "t", .context_index = 1, .min = &minexpr_of_symb_a2a_RECV_t, .max = &maxexpr_of_symb_a2a_RECV_t, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int32_t minexpr_of_symb_a2a_RECV_s_fct(const __parsec_a2a_internal_taskpool_t *__parsec_tp, const __parsec_a2a_RECV_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_a2a_RECV_s = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_a2a_RECV_s_fct }
+                   }
+};
+static inline int maxexpr_of_symb_a2a_RECV_s_fct(const __parsec_a2a_internal_taskpool_t *__parsec_tp, const __parsec_a2a_RECV_parsec_assignment_t *locals)
+{
+  const int r = locals->r.value; (void)r;
+  const int t = locals->t.value; (void)t;
+  const int s = locals->s.value; (void)s;
+
+  (void)r;
+  (void)t;
+  (void)s;
+  (void)__parsec_tp; (void)locals;
+  return (NT - 1);
+}
+static const parsec_expr_t maxexpr_of_symb_a2a_RECV_s = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_a2a_RECV_s_fct }
+                   }
+};
+static const parsec_symbol_t symb_a2a_RECV_s = { .name = "s", .context_index = 2, .min = &minexpr_of_symb_a2a_RECV_s, .max = &maxexpr_of_symb_a2a_RECV_s, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int affinity_of_a2a_RECV(const __parsec_a2a_RECV_task_t *this_task,
+                     parsec_data_ref_t *ref)
+{
+    const __parsec_a2a_internal_taskpool_t *__parsec_tp = (const __parsec_a2a_internal_taskpool_t*)this_task->taskpool;
+  const int r = this_task->locals.r.value; (void)r;
+  const int t = this_task->locals.t.value; (void)t;
+  const int s = this_task->locals.s.value; (void)s;
+
+  /* Silent Warnings: should look into predicate to know what variables are usefull */
+  (void)r;
+  (void)t;
+  (void)s;
+  ref->dc = (parsec_data_collection_t *)__parsec_tp->super._g_descB;
+  /* Compute data key */
+  ref->key = ref->dc->data_key(ref->dc, t, 0);
+  return 1;
+}
+static const parsec_property_t properties_of_a2a_RECV[1] = {
+  {.name = NULL, .expr = NULL}
+};
+static const parsec_dep_t flow_of_a2a_RECV_for_A_dep1_atline_82 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 0, /* a2a_READER_B */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_a2a_READER_B_for_B,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_a2a_RECV_for_A,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_a2a_RECV_for_A = {
+  .name               = "A",
+  .sym_type           = PARSEC_SYM_IN,
+  .flow_flags         = PARSEC_FLOW_ACCESS_READ,
+  .flow_index         = 0,
+  .flow_datatype_mask = 0x0,
+  .dep_in     = { &flow_of_a2a_RECV_for_A_dep1_atline_82 },
+  .dep_out    = { NULL }
+};
+
+static const parsec_dep_t flow_of_a2a_RECV_for_B_dep1_atline_83 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 2, /* a2a_SEND */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_a2a_SEND_for_A,
+  .dep_index = 1,
+  .dep_datatype_index = 1,
+  .belongs_to = &flow_of_a2a_RECV_for_B,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_a2a_RECV_for_B = {
+  .name               = "B",
+  .sym_type           = PARSEC_SYM_IN,
+  .flow_flags         = PARSEC_FLOW_ACCESS_READ,
+  .flow_index         = 1,
+  .flow_datatype_mask = 0x0,
+  .dep_in     = { &flow_of_a2a_RECV_for_B_dep1_atline_83 },
+  .dep_out    = { NULL }
+};
+
+static const parsec_dep_t flow_of_a2a_RECV_for_T_dep1_atline_84 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 4, /* a2a_FANIN */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_a2a_FANIN_for_T,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_a2a_RECV_for_T,
+};
+#if MAX_DEP_OUT_COUNT < 1  /* number of output dependencies */
+    #error Too many output dependencies (supports up to MAX_DEP_OUT_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_OUT_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_a2a_RECV_for_T = {
+  .name               = "T",
+  .sym_type           = PARSEC_SYM_OUT,
+  .flow_flags         = PARSEC_FLOW_ACCESS_NONE,
+  .flow_index         = 2,
+  .flow_datatype_mask = 0x1,
+  .dep_in     = { NULL },
+  .dep_out    = { &flow_of_a2a_RECV_for_T_dep1_atline_84 }
+};
+
+static void
+iterate_successors_of_a2a_RECV(parsec_execution_stream_t *es, const __parsec_a2a_RECV_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_a2a_internal_taskpool_t *__parsec_tp = (const __parsec_a2a_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_a2a_RECV_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_a2a_RECV_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int r = __jdf2c__tmp_locals.r.value; (void)r;
+  const int t = __jdf2c__tmp_locals.t.value; (void)t;
+  const int s = __jdf2c__tmp_locals.s.value; (void)s;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)r;  (void)t;  (void)s;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_descB(t, 0);
+#endif
+  /* Flow of data A has only IN dependencies */
+  /* Flow of data B has only IN dependencies */
+  if( action_mask & 0x1 ) {  /* Flow of data T [2] */
+    data.data   = this_task->data._f_T.data_out;
+    data.data_future  = NULL;
+    if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  =   /* Control: always empty */ 0;
+    data.local.dst_count  =   /* Control: always empty */ 0;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = NULL;
+    data.remote.src_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.src_count  =   /* Control: always empty */ 0;
+    data.remote.dst_count  =   /* Control: always empty */ 0;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+       __parsec_a2a_FANIN_task_t* ncc = (__parsec_a2a_FANIN_task_t*)&nc;
+    nc.task_class = __parsec_tp->super.super.task_classes_array[a2a_FANIN.task_class_id];
+      const int FANIN_r = r;
+      if( (FANIN_r >= (0)) && (FANIN_r <= ((NR - 1))) ) {
+        assert(&nc.locals[0].value == &ncc->locals.r.value);
+        ncc->locals.r.value = FANIN_r;
+        const int FANIN_t = t;
+        if( (FANIN_t >= (0)) && (FANIN_t <= ((NT - 1))) ) {
+          assert(&nc.locals[1].value == &ncc->locals.t.value);
+          ncc->locals.t.value = FANIN_t;
+#if defined(DISTRIBUTED)
+          rank_dst = rank_of_descB(ncc->locals.t.value, 0);
+          if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+            vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descB)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descB, ncc->locals.t.value, 0);
+          nc.priority = __parsec_tp->super.super.priority;
+          successor_repo = FANIN_repo;
+          successor_repo_key = __jdf2c_make_key_FANIN((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+        RELEASE_DEP_OUTPUT(es, "T", this_task, "T", &nc, rank_src, rank_dst, &data);
+        if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_a2a_RECV_for_T_dep1_atline_84, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+          }
+        }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static void
+iterate_predecessors_of_a2a_RECV(parsec_execution_stream_t *es, const __parsec_a2a_RECV_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_a2a_internal_taskpool_t *__parsec_tp = (const __parsec_a2a_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_a2a_RECV_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_a2a_RECV_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int r = __jdf2c__tmp_locals.r.value; (void)r;
+  const int t = __jdf2c__tmp_locals.t.value; (void)t;
+  const int s = __jdf2c__tmp_locals.s.value; (void)s;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)r;  (void)t;  (void)s;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_descB(t, 0);
+#endif
+  if( action_mask & 0x1 ) {  /* Flow of data A [0] */
+    data.data   = this_task->data._f_A.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x1 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_a2a_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_a2a_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        __parsec_a2a_READER_B_task_t* ncc = (__parsec_a2a_READER_B_task_t*)&nc;
+    nc.task_class = __parsec_tp->super.super.task_classes_array[a2a_READER_B.task_class_id];
+      const int READER_B_r = r;
+      if( (READER_B_r >= (0)) && (READER_B_r <= ((NR - 1))) ) {
+        assert(&nc.locals[0].value == &ncc->locals.r.value);
+        ncc->locals.r.value = READER_B_r;
+        const int READER_B_t = t;
+        if( (READER_B_t >= (0)) && (READER_B_t <= ((NT - 1))) ) {
+          assert(&nc.locals[1].value == &ncc->locals.t.value);
+          ncc->locals.t.value = READER_B_t;
+#if defined(DISTRIBUTED)
+          rank_dst = rank_of_descB(ncc->locals.t.value, 0);
+          if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+            vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descB)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descB, ncc->locals.t.value, 0);
+          nc.priority = __parsec_tp->super.super.priority;
+          successor_repo = READER_B_repo;
+          successor_repo_key = __jdf2c_make_key_READER_B((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+        RELEASE_DEP_OUTPUT(es, "A", this_task, "B", &nc, rank_src, rank_dst, &data);
+        if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_a2a_RECV_for_A_dep1_atline_82, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+          }
+        }
+  }
+  }
+  if( action_mask & 0x2 ) {  /* Flow of data B [1] */
+    data.data   = this_task->data._f_B.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x2 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_a2a_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_a2a_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        __parsec_a2a_SEND_task_t* ncc = (__parsec_a2a_SEND_task_t*)&nc;
+    nc.task_class = __parsec_tp->super.super.task_classes_array[a2a_SEND.task_class_id];
+      const int SEND_r = r;
+      if( (SEND_r >= (0)) && (SEND_r <= ((NR - 1))) ) {
+        assert(&nc.locals[0].value == &ncc->locals.r.value);
+        ncc->locals.r.value = SEND_r;
+        const int SEND_t = t;
+        if( (SEND_t >= (0)) && (SEND_t <= ((NT - 1))) ) {
+          assert(&nc.locals[1].value == &ncc->locals.t.value);
+          ncc->locals.t.value = SEND_t;
+          const int SEND_s = s;
+          if( (SEND_s >= (0)) && (SEND_s <= ((NT - 1))) ) {
+            assert(&nc.locals[2].value == &ncc->locals.s.value);
+            ncc->locals.s.value = SEND_s;
+#if defined(DISTRIBUTED)
+            rank_dst = rank_of_descA(ncc->locals.t.value, 0);
+            if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+              vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, ncc->locals.t.value, 0);
+            nc.priority = __parsec_tp->super.super.priority;
+            successor_repo = SEND_repo;
+            successor_repo_key = __jdf2c_make_key_SEND((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+          RELEASE_DEP_OUTPUT(es, "B", this_task, "A", &nc, rank_src, rank_dst, &data);
+          if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_a2a_RECV_for_B_dep1_atline_83, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+            }
+          }
+        }
+  }
+  }
+  /* Flow of data T has only IN dependencies */
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static int release_deps_of_a2a_RECV(parsec_execution_stream_t *es, __parsec_a2a_RECV_task_t *this_task, uint32_t action_mask, parsec_remote_deps_t *deps)
+{
+  PARSEC_PINS(es, RELEASE_DEPS_BEGIN, (parsec_task_t *)this_task);  const __parsec_a2a_internal_taskpool_t *__parsec_tp = (const __parsec_a2a_internal_taskpool_t *)this_task->taskpool;
+  parsec_release_dep_fct_arg_t arg;
+  int __vp_id;
+  int consume_local_repo = 0;
+  arg.action_mask = action_mask;
+  arg.output_entry = NULL;
+  arg.output_repo = NULL;
+#if defined(DISTRIBUTED)
+  arg.remote_deps = deps;
+#endif  /* defined(DISTRIBUTED) */
+  assert(NULL != es);
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS )    arg.ready_lists = alloca(sizeof(parsec_task_t *) * es->virtual_process->parsec_context->nb_vp);
+  else
+    arg.ready_lists = NULL;
+  for( __vp_id = 0; __vp_id < es->virtual_process->parsec_context->nb_vp; arg.ready_lists[__vp_id++] = NULL );
+  (void)__parsec_tp; (void)deps;
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_A.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_A.source_repo, this_task->data._f_A.source_repo_entry->ht_item.key );
+    }
+    if( NULL != this_task->data._f_B.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_B.source_repo, this_task->data._f_B.source_repo_entry->ht_item.key );
+    }
+  }
+  consume_local_repo = (this_task->repo_entry != NULL);
+  arg.output_repo = RECV_repo;
+  arg.output_entry = this_task->repo_entry;
+  arg.output_usage = 0;
+  if( action_mask & (PARSEC_ACTION_RELEASE_LOCAL_DEPS | PARSEC_ACTION_GET_REPO_ENTRY) ) {
+    arg.output_entry = data_repo_lookup_entry_and_create( es, arg.output_repo, __jdf2c_make_key_RECV((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    arg.output_entry->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(arg.output_entry->sim_exec_date == 0);
+    arg.output_entry->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  if(action_mask & ( PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE ) ){
+    /* Generate the reshape promise for the outputs that need it */
+    iterate_successors_of_a2a_RECV(es, this_task, action_mask, parsec_set_up_reshape_promise, &arg);
+   }
+  iterate_successors_of_a2a_RECV(es, this_task, action_mask, parsec_release_dep_fct, &arg);
+
+#if defined(DISTRIBUTED)
+  if( (action_mask & PARSEC_ACTION_SEND_REMOTE_DEPS) && (NULL != arg.remote_deps)) {
+    parsec_remote_dep_activate(es, (parsec_task_t *)this_task, arg.remote_deps, arg.remote_deps->outgoing_mask);
+  }
+#endif
+
+  if(action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS) {
+    data_repo_entry_addto_usage_limit(RECV_repo, arg.output_entry->ht_item.key, arg.output_usage);
+    __parsec_schedule_vp(es, arg.ready_lists, 0);
+  }
+      if (consume_local_repo) {
+         data_repo_entry_used_once( RECV_repo, this_task->repo_entry->ht_item.key );
+      }
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_A.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_A.data_in);
+    }
+    if( NULL != this_task->data._f_B.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_B.data_in);
+    }
+  }
+  PARSEC_PINS(es, RELEASE_DEPS_END, (parsec_task_t *)this_task);  return 0;
+}
+
+static int data_lookup_of_a2a_RECV(parsec_execution_stream_t *es, __parsec_a2a_RECV_task_t *this_task)
+{
+  const __parsec_a2a_internal_taskpool_t *__parsec_tp = (__parsec_a2a_internal_taskpool_t *)this_task->taskpool;
+  parsec_assignment_t generic_locals[MAX_PARAM_COUNT];  /* generic task locals */
+  int target_device = 0; (void)target_device;
+  (void)__parsec_tp; (void)generic_locals; (void)es;
+  parsec_data_copy_t *chunk = NULL;
+  data_repo_t        *reshape_repo  = NULL, *consumed_repo  = NULL;
+  data_repo_entry_t  *reshape_entry = NULL, *consumed_entry = NULL;
+  parsec_key_t        reshape_entry_key = 0, consumed_entry_key = 0;
+  uint8_t             consumed_flow_index;
+  parsec_dep_data_description_t data;
+  int ret;
+  (void)reshape_repo; (void)reshape_entry; (void)reshape_entry_key;
+  (void)consumed_repo; (void)consumed_entry; (void)consumed_entry_key;
+  (void)consumed_flow_index;
+  (void)chunk; (void)data; (void)ret;
+  const int r = this_task->locals.r.value; (void)r;
+  const int t = this_task->locals.t.value; (void)t;
+  const int s = this_task->locals.s.value; (void)s;
+  if( NULL == this_task->repo_entry ){
+    this_task->repo_entry = data_repo_lookup_entry_and_create(es, RECV_repo,                                       __jdf2c_make_key_RECV((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    data_repo_entry_addto_usage_limit(RECV_repo, this_task->repo_entry->ht_item.key, 1);    this_task->repo_entry ->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(this_task->repo_entry ->sim_exec_date == 0);
+    this_task->repo_entry ->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  /* The reshape repo is the current task repo. */  reshape_repo = RECV_repo;
+  reshape_entry_key = __jdf2c_make_key_RECV((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals) ;
+  reshape_entry = this_task->repo_entry;
+  /* Lookup the input data, and store them in the context if any */
+
+if(! this_task->data._f_A.fulfill ){ /* Flow A */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_A.data_out = NULL;  /* input only */
+  /* Flow A [0] dependency [0] from predecessor READER_B */
+  if( NULL == (chunk = this_task->data._f_A.data_in) ) {
+  /* No data set up by predecessor on this task input flow */
+__parsec_a2a_READER_B_parsec_assignment_t *target_locals = (__parsec_a2a_READER_B_parsec_assignment_t*)&generic_locals;
+  const int READER_Br = target_locals->r.value = r; (void)READER_Br;
+  const int READER_Bt = target_locals->t.value = t; (void)READER_Bt;
+    if( (reshape_entry != NULL) && (reshape_entry->data[0] != NULL) ){
+        /* Reshape promise set up on this task repo by predecessor */
+        consumed_repo = reshape_repo;
+        consumed_entry = reshape_entry;
+        consumed_entry_key = reshape_entry_key;
+        consumed_flow_index = 0;
+    }else{
+        /* Consume from predecessor's repo */
+        consumed_repo = READER_B_repo;
+        consumed_entry_key = __jdf2c_make_key_READER_B((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)target_locals) ;
+        consumed_entry = data_repo_lookup_entry( consumed_repo, consumed_entry_key );
+        consumed_flow_index = 0;
+    }
+    data.data   = NULL;
+    data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+        data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    ACQUIRE_FLOW(this_task, "A", &a2a_READER_B, "B", target_locals, chunk);
+    this_task->data._f_A.data_out = chunk;
+  } 
+  else {
+    /* Data set up by predecessor on this task input flow */
+    consumed_repo = this_task->data._f_A.source_repo;
+    consumed_entry = this_task->data._f_A.source_repo_entry;
+    consumed_entry_key = this_task->data._f_A.source_repo_entry->ht_item.key;
+    if( (reshape_entry != NULL) && (reshape_entry->data[0] != NULL) ){
+        /* Reshape promise set up on input by predecessor is on this task repo */
+        consumed_flow_index = 0;
+        assert( (this_task->data._f_A.source_repo == reshape_repo)
+             && (this_task->data._f_A.source_repo_entry == reshape_entry));
+    }else{
+        /* Reshape promise set up on input by predecessor is the predecesssor task repo */
+        consumed_flow_index = 0;
+    }
+    data.data   = NULL;
+    data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+        data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    this_task->data._f_A.data_out = parsec_data_get_copy(chunk->original, target_device);
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+    parsec_prof_grapher_data_input(chunk->original, (parsec_task_t*)this_task, &flow_of_a2a_RECV_for_A, 0);
+#endif
+  }
+    this_task->data._f_A.data_in     = chunk;
+    this_task->data._f_A.source_repo       = consumed_repo;
+    this_task->data._f_A.source_repo_entry = consumed_entry;
+    if( this_task->data._f_A.source_repo_entry == this_task->repo_entry ){
+      /* in case we have consume from this task repo entry for the flow,
+       * it is cleaned up, avoiding having old stuff during release_deps_of
+       */
+      this_task->repo_entry->data[0] = NULL;
+    }
+    this_task->data._f_A.fulfill = 1;
+}
+
+
+if(! this_task->data._f_B.fulfill ){ /* Flow B */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_B.data_out = NULL;  /* input only */
+  /* Flow B [1] dependency [1] from predecessor SEND */
+  if( NULL == (chunk = this_task->data._f_B.data_in) ) {
+  /* No data set up by predecessor on this task input flow */
+__parsec_a2a_SEND_parsec_assignment_t *target_locals = (__parsec_a2a_SEND_parsec_assignment_t*)&generic_locals;
+  const int SENDr = target_locals->r.value = r; (void)SENDr;
+  const int SENDt = target_locals->t.value = t; (void)SENDt;
+  const int SENDs = target_locals->s.value = s; (void)SENDs;
+    if( (reshape_entry != NULL) && (reshape_entry->data[1] != NULL) ){
+        /* Reshape promise set up on this task repo by predecessor */
+        consumed_repo = reshape_repo;
+        consumed_entry = reshape_entry;
+        consumed_entry_key = reshape_entry_key;
+        consumed_flow_index = 1;
+    }else{
+        /* Consume from predecessor's repo */
+        consumed_repo = SEND_repo;
+        consumed_entry_key = __jdf2c_make_key_SEND((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)target_locals) ;
+        consumed_entry = data_repo_lookup_entry( consumed_repo, consumed_entry_key );
+        consumed_flow_index = 0;
+    }
+    data.data   = NULL;
+    data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+        data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 1, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    ACQUIRE_FLOW(this_task, "B", &a2a_SEND, "A", target_locals, chunk);
+    this_task->data._f_B.data_out = chunk;
+  } 
+  else {
+    /* Data set up by predecessor on this task input flow */
+    consumed_repo = this_task->data._f_B.source_repo;
+    consumed_entry = this_task->data._f_B.source_repo_entry;
+    consumed_entry_key = this_task->data._f_B.source_repo_entry->ht_item.key;
+    if( (reshape_entry != NULL) && (reshape_entry->data[1] != NULL) ){
+        /* Reshape promise set up on input by predecessor is on this task repo */
+        consumed_flow_index = 1;
+        assert( (this_task->data._f_B.source_repo == reshape_repo)
+             && (this_task->data._f_B.source_repo_entry == reshape_entry));
+    }else{
+        /* Reshape promise set up on input by predecessor is the predecesssor task repo */
+        consumed_flow_index = 0;
+    }
+    data.data   = NULL;
+    data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+        data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 1, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    this_task->data._f_B.data_out = parsec_data_get_copy(chunk->original, target_device);
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+    parsec_prof_grapher_data_input(chunk->original, (parsec_task_t*)this_task, &flow_of_a2a_RECV_for_B, 0);
+#endif
+  }
+    this_task->data._f_B.data_in     = chunk;
+    this_task->data._f_B.source_repo       = consumed_repo;
+    this_task->data._f_B.source_repo_entry = consumed_entry;
+    if( this_task->data._f_B.source_repo_entry == this_task->repo_entry ){
+      /* in case we have consume from this task repo entry for the flow,
+       * it is cleaned up, avoiding having old stuff during release_deps_of
+       */
+      this_task->repo_entry->data[1] = NULL;
+    }
+    this_task->data._f_B.fulfill = 1;
+}
+
+  /* T is a control flow */
+  this_task->data._f_T.data_in         = NULL;
+  this_task->data._f_T.data_out        = NULL;
+  this_task->data._f_T.source_repo       = NULL;
+  this_task->data._f_T.source_repo_entry = NULL;
+  /** Generate profiling information */
+#if defined(PARSEC_PROF_TRACE)
+  this_task->prof_info.desc = (parsec_data_collection_t*)__parsec_tp->super._g_descB;
+  this_task->prof_info.priority = this_task->priority;
+  this_task->prof_info.data_id   = ((parsec_data_collection_t*)__parsec_tp->super._g_descB)->data_key((parsec_data_collection_t*)__parsec_tp->super._g_descB, t, 0);
+  this_task->prof_info.task_class_id = this_task->task_class->task_class_id;
+  this_task->prof_info.task_return_code = -1;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int datatype_lookup_of_a2a_RECV(parsec_execution_stream_t *es, const parsec_task_t *this_generic_task, const parsec_task_t *parent_task,
+              uint32_t* flow_mask, parsec_dep_data_description_t* data)
+{
+  const __parsec_a2a_RECV_task_t *this_task = (__parsec_a2a_RECV_task_t*)this_generic_task;
+  const __parsec_a2a_internal_taskpool_t *__parsec_tp = (__parsec_a2a_internal_taskpool_t *)this_task->taskpool;
+  (void)__parsec_tp; (void)es; (void)this_task; (void)data; (void)parent_task;
+  const int r = this_task->locals.r.value; (void)r;
+  const int t = this_task->locals.t.value; (void)t;
+  const int s = this_task->locals.s.value; (void)s;
+  data->local.arena = data->remote.arena = NULL;
+  data->local.src_datatype  = data->local.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->local.src_count     = data->local.dst_count = 0;
+  data->local.src_displ     = data->local.dst_displ = 0;
+  data->data_future  = NULL;
+  if( (*flow_mask) & 0x80000000U ) { /* these are the input dependencies remote datatypes  */
+if( (*flow_mask) & 0x1U ) {  /* Flow A */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_a2a_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_a2a_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_a2a_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+if( (*flow_mask) & 0x2U ) {  /* Flow B */
+    if( ((*flow_mask) & 0x2U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_a2a_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_a2a_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_a2a_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x2U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x2U) */
+    goto no_mask_match;
+  }
+
+  /* these are the output dependencies remote datatypes */
+ no_mask_match:
+  data->data                             = NULL;
+  data->remote.src_datatype = data->remote.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->remote.src_count    = data->remote.dst_count = 0;
+  data->remote.src_displ    = data->remote.dst_displ = 0;
+  data->data_future  = NULL;
+  (*flow_mask) = 0;  /* nothing left */
+  (void)r;  (void)t;  (void)s;
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+static int hook_of_a2a_RECV(parsec_execution_stream_t *es, __parsec_a2a_RECV_task_t *this_task)
+{
+  __parsec_a2a_internal_taskpool_t *__parsec_tp = (__parsec_a2a_internal_taskpool_t *)this_task->taskpool;
+  (void)es; (void)__parsec_tp;
+  const int r = this_task->locals.r.value; (void)r;
+  const int t = this_task->locals.t.value; (void)t;
+  const int s = this_task->locals.s.value; (void)s;
+  (void)r;  (void)t;  (void)s;
+
+  /** Declare the variables that will hold the data, and all the accounting for each */
+  parsec_data_copy_t *_f_A = this_task->data._f_A.data_in;
+  void *A = PARSEC_DATA_COPY_GET_PTR(_f_A); (void)A;
+  parsec_data_copy_t *_f_B = this_task->data._f_B.data_in;
+  void *B = PARSEC_DATA_COPY_GET_PTR(_f_B); (void)B;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    data_repo_entry_t *eA = this_task->data._f_A.source_repo_entry;
+    if( (NULL != eA) && (eA->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eA->sim_exec_date;
+    data_repo_entry_t *eB = this_task->data._f_B.source_repo_entry;
+    if( (NULL != eB) && (eB->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eB->sim_exec_date;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+  /** Cache Awareness Accounting */
+#if defined(PARSEC_CACHE_AWARENESS)
+  cache_buf_referenced(es->closest_cache, A);
+  cache_buf_referenced(es->closest_cache, B);
+#endif /* PARSEC_CACHE_AWARENESS */
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                                  RECV BODY                                    -----*/
+
+
+/*-----                                END OF RECV BODY                                -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#endif  /*  defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+static int complete_hook_of_a2a_RECV(parsec_execution_stream_t *es, __parsec_a2a_RECV_task_t *this_task)
+{
+  const __parsec_a2a_internal_taskpool_t *__parsec_tp = (__parsec_a2a_internal_taskpool_t *)this_task->taskpool;
+#if defined(DISTRIBUTED)
+    const int r = this_task->locals.r.value; (void)r;
+  const int t = this_task->locals.t.value; (void)t;
+  const int s = this_task->locals.s.value; (void)s;
+#endif  /* defined(DISTRIBUTED) */
+  (void)es; (void)__parsec_tp;
+parsec_data_t* data_t_desc = NULL; (void)data_t_desc;
+#if defined(DISTRIBUTED)
+  /** If not working on distributed, there is no risk that data is not in place */
+  (void)r;  (void)t;  (void)s;
+
+#endif /* DISTRIBUTED */
+#if defined(PARSEC_PROF_GRAPHER)
+  parsec_prof_grapher_task((parsec_task_t*)this_task, es->th_id, es->virtual_process->vp_id,
+     __jdf2c_key_fns_RECV.key_hash(this_task->task_class->make_key( (parsec_taskpool_t*)this_task->taskpool, ((parsec_task_t*)this_task)->locals), NULL));
+#endif  /* defined(PARSEC_PROF_GRAPHER) */
+  release_deps_of_a2a_RECV(es, this_task,
+      PARSEC_ACTION_RELEASE_REMOTE_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_REFS |
+      PARSEC_ACTION_RESHAPE_ON_RELEASE |
+      0x1,  /* mask of all dep_index */ 
+      NULL);
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static parsec_hook_return_t release_task_of_a2a_RECV(parsec_execution_stream_t *es, parsec_task_t *this_task)
+{
+    const __parsec_a2a_internal_taskpool_t *__parsec_tp =
+        (const __parsec_a2a_internal_taskpool_t *)this_task->taskpool;
+    parsec_hash_table_t *ht = (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[3];
+    parsec_key_t key = this_task->task_class->make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals);
+    parsec_hashable_dependency_t *hash_dep = (parsec_hashable_dependency_t *)parsec_hash_table_remove(ht, key);
+    parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);
+    return parsec_release_task_to_mempool_update_nbtasks(es, this_task);
+}
+
+static char *a2a_a2a_RECV_internal_init_deps_key_functions_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_a2a_internal_taskpool_t *__parsec_tp = (__parsec_a2a_internal_taskpool_t *)user_data;
+  int r = (__parsec_key) % __parsec_tp->RECV_r_range + __parsec_tp->RECV_r_min;
+  __parsec_key = __parsec_key / __parsec_tp->RECV_r_range;
+  int t = (__parsec_key) % __parsec_tp->RECV_t_range + __parsec_tp->RECV_t_min;
+  __parsec_key = __parsec_key / __parsec_tp->RECV_t_range;
+  int s = (__parsec_key) % __parsec_tp->RECV_s_range + __parsec_tp->RECV_s_min;
+  __parsec_key = __parsec_key / __parsec_tp->RECV_s_range;
+  snprintf(buffer, buffer_size, "RECV(%d, %d, %d)", r, t, s);
+  return buffer;
+}
+
+static parsec_key_fn_t a2a_a2a_RECV_internal_init_deps_key_functions = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = a2a_a2a_RECV_internal_init_deps_key_functions_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/* Needs: min-max count-tasks iterate */
+static int a2a_RECV_internal_init(parsec_execution_stream_t * es, __parsec_a2a_RECV_task_t * this_task)
+{
+  __parsec_a2a_internal_taskpool_t *__parsec_tp = (__parsec_a2a_internal_taskpool_t*)this_task->taskpool;
+  int32_t nb_tasks = 0, saved_nb_tasks = 0;
+int32_t __r_min = 0x7fffffff, __r_max = 0;int32_t __jdf2c_r_min = 0x7fffffff, __jdf2c_r_max = 0;int32_t __t_min = 0x7fffffff, __t_max = 0;int32_t __jdf2c_t_min = 0x7fffffff, __jdf2c_t_max = 0;int32_t __s_min = 0x7fffffff, __s_max = 0;int32_t __jdf2c_s_min = 0x7fffffff, __jdf2c_s_max = 0;  __parsec_a2a_RECV_parsec_assignment_t assignments = {  .r.value = 0, .t.value = 0, .s.value = 0 };
+  int32_t  r,  t,  s;
+  int32_t __jdf2c_r_start, __jdf2c_r_end, __jdf2c_r_inc;
+  int32_t __jdf2c_t_start, __jdf2c_t_end, __jdf2c_t_inc;
+  int32_t __jdf2c_s_start, __jdf2c_s_end, __jdf2c_s_inc;
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+  PARSEC_PROFILING_TRACE(es->es_profile,
+                         this_task->taskpool->profiling_array[START_KEY(this_task->task_class->task_class_id)],
+                         0,
+                         this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    __jdf2c_r_start = 0;
+    __jdf2c_r_end = (NR - 1);
+    __jdf2c_r_inc = 1;
+    __r_min = parsec_imin(__jdf2c_r_start, __jdf2c_r_end);
+    __r_max = parsec_imax(__jdf2c_r_start, __jdf2c_r_end);
+    __jdf2c_r_min = parsec_imin(__jdf2c_r_min, __r_min);
+    __jdf2c_r_max = parsec_imax(__jdf2c_r_max, __r_max);
+    for(r =  __jdf2c_r_start;
+        r <= __jdf2c_r_end;
+        r += __jdf2c_r_inc) {
+    assignments.r.value = r;
+      __jdf2c_t_start = 0;
+      __jdf2c_t_end = (NT - 1);
+      __jdf2c_t_inc = 1;
+      __t_min = parsec_imin(__jdf2c_t_start, __jdf2c_t_end);
+      __t_max = parsec_imax(__jdf2c_t_start, __jdf2c_t_end);
+      __jdf2c_t_min = parsec_imin(__jdf2c_t_min, __t_min);
+      __jdf2c_t_max = parsec_imax(__jdf2c_t_max, __t_max);
+      for(t =  __jdf2c_t_start;
+          t <= __jdf2c_t_end;
+          t += __jdf2c_t_inc) {
+      assignments.t.value = t;
+        __jdf2c_s_start = 0;
+        __jdf2c_s_end = (NT - 1);
+        __jdf2c_s_inc = 1;
+        __s_min = parsec_imin(__jdf2c_s_start, __jdf2c_s_end);
+        __s_max = parsec_imax(__jdf2c_s_start, __jdf2c_s_end);
+        __jdf2c_s_min = parsec_imin(__jdf2c_s_min, __s_min);
+        __jdf2c_s_max = parsec_imax(__jdf2c_s_max, __s_max);
+        for(s =  __jdf2c_s_start;
+            s <= __jdf2c_s_end;
+            s += __jdf2c_s_inc) {
+        assignments.s.value = s;
+        if( !RECV_pred(r, t, s) ) continue;
+        nb_tasks++;
+      } /* Loop on normal range s */
+    } /* For loop of t */ 
+  } /* For loop of r */ 
+   if( 0 != nb_tasks ) {
+     (void)parsec_atomic_fetch_add_int32(&__parsec_tp->initial_number_tasks, nb_tasks);
+   }
+  /* Set the range variables for the collision-free hash-computation */
+  __parsec_tp->RECV_r_min   = __jdf2c_r_min;
+  __parsec_tp->RECV_r_range = (__jdf2c_r_max - __jdf2c_r_min) + 1;
+  __parsec_tp->RECV_t_min   = __jdf2c_t_min;
+  __parsec_tp->RECV_t_range = (__jdf2c_t_max - __jdf2c_t_min) + 1;
+  __parsec_tp->RECV_s_min   = __jdf2c_s_min;
+  __parsec_tp->RECV_s_range = (__jdf2c_s_max - __jdf2c_s_min) + 1;
+  this_task->status = PARSEC_TASK_STATUS_COMPLETE;
+
+  PARSEC_AYU_REGISTER_TASK(&a2a_RECV);
+  __parsec_tp->super.super.dependencies_array[3] = PARSEC_OBJ_NEW(parsec_hash_table_t);
+  parsec_hash_table_init(__parsec_tp->super.super.dependencies_array[3], offsetof(parsec_hashable_dependency_t, ht_item), 10, a2a_a2a_RECV_internal_init_deps_key_functions, this_task->taskpool);
+  __parsec_tp->repositories[3] = data_repo_create_nothreadsafe(nb_tasks, __jdf2c_key_fns_RECV, (parsec_taskpool_t*)__parsec_tp, 3);
+(void)saved_nb_tasks;
+(void)__r_min; (void)__r_max;(void)__t_min; (void)__t_max;(void)__s_min; (void)__s_max;  (void)__jdf2c_r_start; (void)__jdf2c_r_end; (void)__jdf2c_r_inc;  (void)__jdf2c_t_start; (void)__jdf2c_t_end; (void)__jdf2c_t_inc;  (void)__jdf2c_s_start; (void)__jdf2c_s_end; (void)__jdf2c_s_inc;  (void)assignments; (void)__parsec_tp; (void)es;
+  if(1 == parsec_atomic_fetch_dec_int32(&__parsec_tp->sync_point)) {
+    /* Last initialization task complete. Update the number of tasks. */
+    __parsec_tp->super.super.tdm.module->taskpool_addto_nb_tasks(&__parsec_tp->super.super, __parsec_tp->initial_number_tasks);
+    parsec_mfence();  /* write memory barrier to guarantee that the scheduler gets the correct number of tasks */
+    parsec_taskpool_enable((parsec_taskpool_t*)__parsec_tp, &__parsec_tp->startup_queue,
+                           (parsec_task_t*)this_task, es, __parsec_tp->super.super.nb_pending_actions);
+    __parsec_tp->super.super.tdm.module->taskpool_ready(&__parsec_tp->super.super);
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+    PARSEC_PROFILING_TRACE(es->es_profile,
+                           this_task->taskpool->profiling_array[2 * this_task->task_class->task_class_id + 1],
+                           0,
+                           this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    return PARSEC_HOOK_RETURN_DONE;
+  }
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static const __parsec_chore_t __a2a_RECV_chores[] ={
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+    { .type     = PARSEC_DEV_CPU,
+      .evaluate = (parsec_evaluate_function_t*)NULL,
+      .hook     = (parsec_hook_t*)hook_of_a2a_RECV },
+#endif  /* defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+    { .type     = PARSEC_DEV_NONE,
+      .evaluate = NULL,
+      .hook     = (parsec_hook_t*)NULL },  /* End marker */
+};
+
+static const parsec_task_class_t a2a_RECV = {
+  .name = "RECV",
+  .task_class_id = 3,
+  .nb_flows = 3,
+  .nb_parameters = 3,
+  .nb_locals = 3,
+  .task_class_type = PARSEC_TASK_CLASS_TYPE_PTG,
+  .params = { &symb_a2a_RECV_r, &symb_a2a_RECV_s, &symb_a2a_RECV_t, NULL },
+  .locals = { &symb_a2a_RECV_r, &symb_a2a_RECV_t, &symb_a2a_RECV_s, NULL },
+  .data_affinity = (parsec_data_ref_fn_t*)affinity_of_a2a_RECV,
+  .initial_data = (parsec_data_ref_fn_t*)affinity_of_a2a_RECV,
+  .final_data = (parsec_data_ref_fn_t*)affinity_of_a2a_RECV,
+  .priority = NULL,
+  .properties = properties_of_a2a_RECV,
+#if MAX_PARAM_COUNT < 2  /* number of read flows of RECV */
+  #error Too many read flows for task RECV
+#endif  /* MAX_PARAM_COUNT */
+#if MAX_PARAM_COUNT < 0  /* number of write flows of RECV */
+  #error Too many write flows for task RECV
+#endif  /* MAX_PARAM_COUNT */
+  .in = { &flow_of_a2a_RECV_for_A, &flow_of_a2a_RECV_for_B, NULL },
+  .out = { &flow_of_a2a_RECV_for_T, NULL },
+  .flags = 0x0 | PARSEC_USE_DEPS_MASK,
+  .dependencies_goal = 0x3,
+  .make_key = __jdf2c_make_key_RECV,
+  .task_snprintf = parsec_task_snprintf,
+#if defined(PARSEC_PROF_TRACE)
+  .profile_info = &parsec_task_profile_info,
+#endif
+  .key_functions = &__jdf2c_key_fns_RECV,
+  .fini = (parsec_hook_t*)NULL,
+  .incarnations = __a2a_RECV_chores,
+  .find_deps = parsec_hash_find_deps,
+  .update_deps = parsec_update_deps_with_mask,
+  .iterate_successors = (parsec_traverse_function_t*)iterate_successors_of_a2a_RECV,
+  .iterate_predecessors = (parsec_traverse_function_t*)iterate_predecessors_of_a2a_RECV,
+  .release_deps = (parsec_release_deps_t*)release_deps_of_a2a_RECV,
+  .prepare_output = (parsec_hook_t*)NULL,
+  .prepare_input = (parsec_hook_t*)data_lookup_of_a2a_RECV,
+  .time_estimate = NULL,
+  .get_datatype = datatype_lookup_of_a2a_RECV,
+  .complete_execution = (parsec_hook_t*)complete_hook_of_a2a_RECV,
+  .release_task = &release_task_of_a2a_RECV,
+#if defined(PARSEC_SIM)
+  .sim_cost_fct = (parsec_sim_cost_fct_t*)NULL,
+#endif
+};
+
+
+/******                                      SEND                                      ******/
+
+static inline int32_t minexpr_of_symb_a2a_SEND_r_fct(const __parsec_a2a_internal_taskpool_t *__parsec_tp, const __parsec_a2a_SEND_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_a2a_SEND_r = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_a2a_SEND_r_fct }
+                   }
+};
+static inline int maxexpr_of_symb_a2a_SEND_r_fct(const __parsec_a2a_internal_taskpool_t *__parsec_tp, const __parsec_a2a_SEND_parsec_assignment_t *locals)
+{
+  const int r = locals->r.value; (void)r;
+  const int t = locals->t.value; (void)t;
+  const int s = locals->s.value; (void)s;
+
+  (void)r;
+  (void)t;
+  (void)s;
+  (void)__parsec_tp; (void)locals;
+  return (NR - 1);
+}
+static const parsec_expr_t maxexpr_of_symb_a2a_SEND_r = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_a2a_SEND_r_fct }
+                   }
+};
+static const parsec_symbol_t symb_a2a_SEND_r = { .name = "r", .context_index = 0, .min = &minexpr_of_symb_a2a_SEND_r, .max = &maxexpr_of_symb_a2a_SEND_r, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int32_t minexpr_of_symb_a2a_SEND_t_fct(const __parsec_a2a_internal_taskpool_t *__parsec_tp, const __parsec_a2a_SEND_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_a2a_SEND_t = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_a2a_SEND_t_fct }
+                   }
+};
+static inline int maxexpr_of_symb_a2a_SEND_t_fct(const __parsec_a2a_internal_taskpool_t *__parsec_tp, const __parsec_a2a_SEND_parsec_assignment_t *locals)
+{
+  const int r = locals->r.value; (void)r;
+  const int t = locals->t.value; (void)t;
+  const int s = locals->s.value; (void)s;
+
+  (void)r;
+  (void)t;
+  (void)s;
+  (void)__parsec_tp; (void)locals;
+  return (NT - 1);
+}
+static const parsec_expr_t maxexpr_of_symb_a2a_SEND_t = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_a2a_SEND_t_fct }
+                   }
+};
+static const parsec_symbol_t symb_a2a_SEND_t = { .name = "t", .context_index = 1, .min = &minexpr_of_symb_a2a_SEND_t, .max = &maxexpr_of_symb_a2a_SEND_t, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int32_t minexpr_of_symb_a2a_SEND_s_fct(const __parsec_a2a_internal_taskpool_t *__parsec_tp, const __parsec_a2a_SEND_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_a2a_SEND_s = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_a2a_SEND_s_fct }
+                   }
+};
+static inline int maxexpr_of_symb_a2a_SEND_s_fct(const __parsec_a2a_internal_taskpool_t *__parsec_tp, const __parsec_a2a_SEND_parsec_assignment_t *locals)
+{
+  const int r = locals->r.value; (void)r;
+  const int t = locals->t.value; (void)t;
+  const int s = locals->s.value; (void)s;
+
+  (void)r;
+  (void)t;
+  (void)s;
+  (void)__parsec_tp; (void)locals;
+  return (NT - 1);
+}
+static const parsec_expr_t maxexpr_of_symb_a2a_SEND_s = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_a2a_SEND_s_fct }
+                   }
+};
+static const parsec_symbol_t symb_a2a_SEND_s = { .name = "s", .context_index = 2, .min = &minexpr_of_symb_a2a_SEND_s, .max = &maxexpr_of_symb_a2a_SEND_s, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int affinity_of_a2a_SEND(const __parsec_a2a_SEND_task_t *this_task,
+                     parsec_data_ref_t *ref)
+{
+    const __parsec_a2a_internal_taskpool_t *__parsec_tp = (const __parsec_a2a_internal_taskpool_t*)this_task->taskpool;
+  const int r = this_task->locals.r.value; (void)r;
+  const int t = this_task->locals.t.value; (void)t;
+  const int s = this_task->locals.s.value; (void)s;
+
+  /* Silent Warnings: should look into predicate to know what variables are usefull */
+  (void)r;
+  (void)t;
+  (void)s;
+  ref->dc = (parsec_data_collection_t *)__parsec_tp->super._g_descA;
+  /* Compute data key */
+  ref->key = ref->dc->data_key(ref->dc, t, 0);
+  return 1;
+}
+static const parsec_property_t properties_of_a2a_SEND[1] = {
+  {.name = NULL, .expr = NULL}
+};
+static const parsec_dep_t flow_of_a2a_SEND_for_A_dep1_atline_70 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 1, /* a2a_FANOUT */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_a2a_FANOUT_for_A,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_a2a_SEND_for_A,
+};
+static const parsec_dep_t flow_of_a2a_SEND_for_A_dep2_atline_71 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 3, /* a2a_RECV */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_a2a_RECV_for_B,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_a2a_SEND_for_A,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+#if MAX_DEP_OUT_COUNT < 1  /* number of output dependencies */
+    #error Too many output dependencies (supports up to MAX_DEP_OUT_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_OUT_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_a2a_SEND_for_A = {
+  .name               = "A",
+  .sym_type           = PARSEC_SYM_INOUT,
+  .flow_flags         = PARSEC_FLOW_ACCESS_READ,
+  .flow_index         = 0,
+  .flow_datatype_mask = 0x1,
+  .dep_in     = { &flow_of_a2a_SEND_for_A_dep1_atline_70 },
+  .dep_out    = { &flow_of_a2a_SEND_for_A_dep2_atline_71 }
+};
+
+static void
+iterate_successors_of_a2a_SEND(parsec_execution_stream_t *es, const __parsec_a2a_SEND_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_a2a_internal_taskpool_t *__parsec_tp = (const __parsec_a2a_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_a2a_SEND_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_a2a_SEND_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int r = __jdf2c__tmp_locals.r.value; (void)r;
+  const int t = __jdf2c__tmp_locals.t.value; (void)t;
+  const int s = __jdf2c__tmp_locals.s.value; (void)s;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)r;  (void)t;  (void)s;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_descA(t, 0);
+#endif
+  if( action_mask & 0x1 ) {  /* Flow of data A [0] */
+    data.data   = this_task->data._f_A.data_out;
+    data.data_future  = NULL;
+    if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_a2a_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_a2a_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+       __parsec_a2a_RECV_task_t* ncc = (__parsec_a2a_RECV_task_t*)&nc;
+    nc.task_class = __parsec_tp->super.super.task_classes_array[a2a_RECV.task_class_id];
+      const int RECV_r = r;
+      if( (RECV_r >= (0)) && (RECV_r <= ((NR - 1))) ) {
+        assert(&nc.locals[0].value == &ncc->locals.r.value);
+        ncc->locals.r.value = RECV_r;
+        const int RECV_t = t;
+        if( (RECV_t >= (0)) && (RECV_t <= ((NT - 1))) ) {
+          assert(&nc.locals[1].value == &ncc->locals.t.value);
+          ncc->locals.t.value = RECV_t;
+          const int RECV_s = s;
+          if( (RECV_s >= (0)) && (RECV_s <= ((NT - 1))) ) {
+            assert(&nc.locals[2].value == &ncc->locals.s.value);
+            ncc->locals.s.value = RECV_s;
+#if defined(DISTRIBUTED)
+            rank_dst = rank_of_descB(ncc->locals.t.value, 0);
+            if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+              vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descB)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descB, ncc->locals.t.value, 0);
+            nc.priority = __parsec_tp->super.super.priority;
+            successor_repo = RECV_repo;
+            successor_repo_key = __jdf2c_make_key_RECV((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+          RELEASE_DEP_OUTPUT(es, "A", this_task, "B", &nc, rank_src, rank_dst, &data);
+          if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_a2a_SEND_for_A_dep2_atline_71, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+            }
+          }
+        }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static void
+iterate_predecessors_of_a2a_SEND(parsec_execution_stream_t *es, const __parsec_a2a_SEND_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_a2a_internal_taskpool_t *__parsec_tp = (const __parsec_a2a_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_a2a_SEND_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_a2a_SEND_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int r = __jdf2c__tmp_locals.r.value; (void)r;
+  const int t = __jdf2c__tmp_locals.t.value; (void)t;
+  const int s = __jdf2c__tmp_locals.s.value; (void)s;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)r;  (void)t;  (void)s;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_descA(t, 0);
+#endif
+  if( action_mask & 0x1 ) {  /* Flow of data A [0] */
+    data.data   = this_task->data._f_A.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x1 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_a2a_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_a2a_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        __parsec_a2a_FANOUT_task_t* ncc = (__parsec_a2a_FANOUT_task_t*)&nc;
+    nc.task_class = __parsec_tp->super.super.task_classes_array[a2a_FANOUT.task_class_id];
+      const int FANOUT_r = r;
+      if( (FANOUT_r >= (0)) && (FANOUT_r <= ((NR - 1))) ) {
+        assert(&nc.locals[0].value == &ncc->locals.r.value);
+        ncc->locals.r.value = FANOUT_r;
+        const int FANOUT_t = t;
+        if( (FANOUT_t >= (0)) && (FANOUT_t <= ((NT - 1))) ) {
+          assert(&nc.locals[1].value == &ncc->locals.t.value);
+          ncc->locals.t.value = FANOUT_t;
+#if defined(DISTRIBUTED)
+          rank_dst = rank_of_descA(ncc->locals.t.value, 0);
+          if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+            vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, ncc->locals.t.value, 0);
+          nc.priority = __parsec_tp->super.super.priority;
+          successor_repo = FANOUT_repo;
+          successor_repo_key = __jdf2c_make_key_FANOUT((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+        RELEASE_DEP_OUTPUT(es, "A", this_task, "A", &nc, rank_src, rank_dst, &data);
+        if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_a2a_SEND_for_A_dep1_atline_70, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+          }
+        }
+  }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static int release_deps_of_a2a_SEND(parsec_execution_stream_t *es, __parsec_a2a_SEND_task_t *this_task, uint32_t action_mask, parsec_remote_deps_t *deps)
+{
+  PARSEC_PINS(es, RELEASE_DEPS_BEGIN, (parsec_task_t *)this_task);  const __parsec_a2a_internal_taskpool_t *__parsec_tp = (const __parsec_a2a_internal_taskpool_t *)this_task->taskpool;
+  parsec_release_dep_fct_arg_t arg;
+  int __vp_id;
+  int consume_local_repo = 0;
+  arg.action_mask = action_mask;
+  arg.output_entry = NULL;
+  arg.output_repo = NULL;
+#if defined(DISTRIBUTED)
+  arg.remote_deps = deps;
+#endif  /* defined(DISTRIBUTED) */
+  assert(NULL != es);
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS )    arg.ready_lists = alloca(sizeof(parsec_task_t *) * es->virtual_process->parsec_context->nb_vp);
+  else
+    arg.ready_lists = NULL;
+  for( __vp_id = 0; __vp_id < es->virtual_process->parsec_context->nb_vp; arg.ready_lists[__vp_id++] = NULL );
+  (void)__parsec_tp; (void)deps;
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_A.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_A.source_repo, this_task->data._f_A.source_repo_entry->ht_item.key );
+    }
+  }
+  consume_local_repo = (this_task->repo_entry != NULL);
+  arg.output_repo = SEND_repo;
+  arg.output_entry = this_task->repo_entry;
+  arg.output_usage = 0;
+  if( action_mask & (PARSEC_ACTION_RELEASE_LOCAL_DEPS | PARSEC_ACTION_GET_REPO_ENTRY) ) {
+    arg.output_entry = data_repo_lookup_entry_and_create( es, arg.output_repo, __jdf2c_make_key_SEND((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    arg.output_entry->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(arg.output_entry->sim_exec_date == 0);
+    arg.output_entry->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  if(action_mask & ( PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE ) ){
+    /* Generate the reshape promise for the outputs that need it */
+    iterate_successors_of_a2a_SEND(es, this_task, action_mask, parsec_set_up_reshape_promise, &arg);
+   }
+  iterate_successors_of_a2a_SEND(es, this_task, action_mask, parsec_release_dep_fct, &arg);
+
+#if defined(DISTRIBUTED)
+  if( (action_mask & PARSEC_ACTION_SEND_REMOTE_DEPS) && (NULL != arg.remote_deps)) {
+    parsec_remote_dep_activate(es, (parsec_task_t *)this_task, arg.remote_deps, arg.remote_deps->outgoing_mask);
+  }
+#endif
+
+  if(action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS) {
+    data_repo_entry_addto_usage_limit(SEND_repo, arg.output_entry->ht_item.key, arg.output_usage);
+    __parsec_schedule_vp(es, arg.ready_lists, 0);
+  }
+      if (consume_local_repo) {
+         data_repo_entry_used_once( SEND_repo, this_task->repo_entry->ht_item.key );
+      }
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_A.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_A.data_in);
+    }
+  }
+  PARSEC_PINS(es, RELEASE_DEPS_END, (parsec_task_t *)this_task);  return 0;
+}
+
+static int data_lookup_of_a2a_SEND(parsec_execution_stream_t *es, __parsec_a2a_SEND_task_t *this_task)
+{
+  const __parsec_a2a_internal_taskpool_t *__parsec_tp = (__parsec_a2a_internal_taskpool_t *)this_task->taskpool;
+  parsec_assignment_t generic_locals[MAX_PARAM_COUNT];  /* generic task locals */
+  int target_device = 0; (void)target_device;
+  (void)__parsec_tp; (void)generic_locals; (void)es;
+  parsec_data_copy_t *chunk = NULL;
+  data_repo_t        *reshape_repo  = NULL, *consumed_repo  = NULL;
+  data_repo_entry_t  *reshape_entry = NULL, *consumed_entry = NULL;
+  parsec_key_t        reshape_entry_key = 0, consumed_entry_key = 0;
+  uint8_t             consumed_flow_index;
+  parsec_dep_data_description_t data;
+  int ret;
+  (void)reshape_repo; (void)reshape_entry; (void)reshape_entry_key;
+  (void)consumed_repo; (void)consumed_entry; (void)consumed_entry_key;
+  (void)consumed_flow_index;
+  (void)chunk; (void)data; (void)ret;
+  const int r = this_task->locals.r.value; (void)r;
+  const int t = this_task->locals.t.value; (void)t;
+  const int s = this_task->locals.s.value; (void)s;
+  if( NULL == this_task->repo_entry ){
+    this_task->repo_entry = data_repo_lookup_entry_and_create(es, SEND_repo,                                       __jdf2c_make_key_SEND((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    data_repo_entry_addto_usage_limit(SEND_repo, this_task->repo_entry->ht_item.key, 1);    this_task->repo_entry ->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(this_task->repo_entry ->sim_exec_date == 0);
+    this_task->repo_entry ->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  /* The reshape repo is the current task repo. */  reshape_repo = SEND_repo;
+  reshape_entry_key = __jdf2c_make_key_SEND((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals) ;
+  reshape_entry = this_task->repo_entry;
+  /* Lookup the input data, and store them in the context if any */
+
+if(! this_task->data._f_A.fulfill ){ /* Flow A */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_A.data_out = NULL;  /* By default, if nothing matches */
+  /* Flow A [0] dependency [0] from predecessor FANOUT */
+  if( NULL == (chunk = this_task->data._f_A.data_in) ) {
+  /* No data set up by predecessor on this task input flow */
+__parsec_a2a_FANOUT_parsec_assignment_t *target_locals = (__parsec_a2a_FANOUT_parsec_assignment_t*)&generic_locals;
+  const int FANOUTr = target_locals->r.value = r; (void)FANOUTr;
+  const int FANOUTt = target_locals->t.value = t; (void)FANOUTt;
+    if( (reshape_entry != NULL) && (reshape_entry->data[0] != NULL) ){
+        /* Reshape promise set up on this task repo by predecessor */
+        consumed_repo = reshape_repo;
+        consumed_entry = reshape_entry;
+        consumed_entry_key = reshape_entry_key;
+        consumed_flow_index = 0;
+    }else{
+        /* Consume from predecessor's repo */
+        consumed_repo = FANOUT_repo;
+        consumed_entry_key = __jdf2c_make_key_FANOUT((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)target_locals) ;
+        consumed_entry = data_repo_lookup_entry( consumed_repo, consumed_entry_key );
+        consumed_flow_index = 0;
+    }
+    data.data   = NULL;
+    data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+        data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    ACQUIRE_FLOW(this_task, "A", &a2a_FANOUT, "A", target_locals, chunk);
+    this_task->data._f_A.data_out = chunk;
+  } 
+  else {
+    /* Data set up by predecessor on this task input flow */
+    consumed_repo = this_task->data._f_A.source_repo;
+    consumed_entry = this_task->data._f_A.source_repo_entry;
+    consumed_entry_key = this_task->data._f_A.source_repo_entry->ht_item.key;
+    if( (reshape_entry != NULL) && (reshape_entry->data[0] != NULL) ){
+        /* Reshape promise set up on input by predecessor is on this task repo */
+        consumed_flow_index = 0;
+        assert( (this_task->data._f_A.source_repo == reshape_repo)
+             && (this_task->data._f_A.source_repo_entry == reshape_entry));
+    }else{
+        /* Reshape promise set up on input by predecessor is the predecesssor task repo */
+        consumed_flow_index = 0;
+    }
+    data.data   = NULL;
+    data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+        data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    this_task->data._f_A.data_out = parsec_data_get_copy(chunk->original, target_device);
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+    parsec_prof_grapher_data_input(chunk->original, (parsec_task_t*)this_task, &flow_of_a2a_SEND_for_A, 0);
+#endif
+  }
+    this_task->data._f_A.data_in     = chunk;
+    this_task->data._f_A.source_repo       = consumed_repo;
+    this_task->data._f_A.source_repo_entry = consumed_entry;
+    if( this_task->data._f_A.source_repo_entry == this_task->repo_entry ){
+      /* in case we have consume from this task repo entry for the flow,
+       * it is cleaned up, avoiding having old stuff during release_deps_of
+       */
+      this_task->repo_entry->data[0] = NULL;
+    }
+    this_task->data._f_A.fulfill = 1;
+}
+
+  /** Generate profiling information */
+#if defined(PARSEC_PROF_TRACE)
+  this_task->prof_info.desc = (parsec_data_collection_t*)__parsec_tp->super._g_descA;
+  this_task->prof_info.priority = this_task->priority;
+  this_task->prof_info.data_id   = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->data_key((parsec_data_collection_t*)__parsec_tp->super._g_descA, t, 0);
+  this_task->prof_info.task_class_id = this_task->task_class->task_class_id;
+  this_task->prof_info.task_return_code = -1;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int datatype_lookup_of_a2a_SEND(parsec_execution_stream_t *es, const parsec_task_t *this_generic_task, const parsec_task_t *parent_task,
+              uint32_t* flow_mask, parsec_dep_data_description_t* data)
+{
+  const __parsec_a2a_SEND_task_t *this_task = (__parsec_a2a_SEND_task_t*)this_generic_task;
+  const __parsec_a2a_internal_taskpool_t *__parsec_tp = (__parsec_a2a_internal_taskpool_t *)this_task->taskpool;
+  (void)__parsec_tp; (void)es; (void)this_task; (void)data; (void)parent_task;
+  const int r = this_task->locals.r.value; (void)r;
+  const int t = this_task->locals.t.value; (void)t;
+  const int s = this_task->locals.s.value; (void)s;
+  data->local.arena = data->remote.arena = NULL;
+  data->local.src_datatype  = data->local.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->local.src_count     = data->local.dst_count = 0;
+  data->local.src_displ     = data->local.dst_displ = 0;
+  data->data_future  = NULL;
+  if( (*flow_mask) & 0x80000000U ) { /* these are the input dependencies remote datatypes  */
+if( (*flow_mask) & 0x1U ) {  /* Flow A */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_a2a_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_a2a_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_a2a_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+    goto no_mask_match;
+  }
+
+  /* these are the output dependencies remote datatypes */
+if( (*flow_mask) & 0x1U ) {  /* Flow A */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_a2a_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_a2a_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_a2a_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+ no_mask_match:
+  data->data                             = NULL;
+  data->remote.src_datatype = data->remote.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->remote.src_count    = data->remote.dst_count = 0;
+  data->remote.src_displ    = data->remote.dst_displ = 0;
+  data->data_future  = NULL;
+  (*flow_mask) = 0;  /* nothing left */
+  (void)r;  (void)t;  (void)s;
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+static int hook_of_a2a_SEND(parsec_execution_stream_t *es, __parsec_a2a_SEND_task_t *this_task)
+{
+  __parsec_a2a_internal_taskpool_t *__parsec_tp = (__parsec_a2a_internal_taskpool_t *)this_task->taskpool;
+  (void)es; (void)__parsec_tp;
+  const int r = this_task->locals.r.value; (void)r;
+  const int t = this_task->locals.t.value; (void)t;
+  const int s = this_task->locals.s.value; (void)s;
+  (void)r;  (void)t;  (void)s;
+
+  /** Declare the variables that will hold the data, and all the accounting for each */
+  parsec_data_copy_t *_f_A = this_task->data._f_A.data_in;
+  void *A = PARSEC_DATA_COPY_GET_PTR(_f_A); (void)A;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    data_repo_entry_t *eA = this_task->data._f_A.source_repo_entry;
+    if( (NULL != eA) && (eA->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eA->sim_exec_date;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+  /** Cache Awareness Accounting */
+#if defined(PARSEC_CACHE_AWARENESS)
+  cache_buf_referenced(es->closest_cache, A);
+#endif /* PARSEC_CACHE_AWARENESS */
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                                  SEND BODY                                    -----*/
+
+
+/*-----                                END OF SEND BODY                                -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#endif  /*  defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+static int complete_hook_of_a2a_SEND(parsec_execution_stream_t *es, __parsec_a2a_SEND_task_t *this_task)
+{
+  const __parsec_a2a_internal_taskpool_t *__parsec_tp = (__parsec_a2a_internal_taskpool_t *)this_task->taskpool;
+#if defined(DISTRIBUTED)
+    const int r = this_task->locals.r.value; (void)r;
+  const int t = this_task->locals.t.value; (void)t;
+  const int s = this_task->locals.s.value; (void)s;
+#endif  /* defined(DISTRIBUTED) */
+  (void)es; (void)__parsec_tp;
+parsec_data_t* data_t_desc = NULL; (void)data_t_desc;
+#if defined(DISTRIBUTED)
+  /** If not working on distributed, there is no risk that data is not in place */
+  (void)r;  (void)t;  (void)s;
+
+#endif /* DISTRIBUTED */
+#if defined(PARSEC_PROF_GRAPHER)
+  parsec_prof_grapher_task((parsec_task_t*)this_task, es->th_id, es->virtual_process->vp_id,
+     __jdf2c_key_fns_SEND.key_hash(this_task->task_class->make_key( (parsec_taskpool_t*)this_task->taskpool, ((parsec_task_t*)this_task)->locals), NULL));
+#endif  /* defined(PARSEC_PROF_GRAPHER) */
+  release_deps_of_a2a_SEND(es, this_task,
+      PARSEC_ACTION_RELEASE_REMOTE_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_REFS |
+      PARSEC_ACTION_RESHAPE_ON_RELEASE |
+      0x1,  /* mask of all dep_index */ 
+      NULL);
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static parsec_hook_return_t release_task_of_a2a_SEND(parsec_execution_stream_t *es, parsec_task_t *this_task)
+{
+    const __parsec_a2a_internal_taskpool_t *__parsec_tp =
+        (const __parsec_a2a_internal_taskpool_t *)this_task->taskpool;
+    parsec_hash_table_t *ht = (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[2];
+    parsec_key_t key = this_task->task_class->make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals);
+    parsec_hashable_dependency_t *hash_dep = (parsec_hashable_dependency_t *)parsec_hash_table_remove(ht, key);
+    parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);
+    return parsec_release_task_to_mempool_update_nbtasks(es, this_task);
+}
+
+static char *a2a_a2a_SEND_internal_init_deps_key_functions_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_a2a_internal_taskpool_t *__parsec_tp = (__parsec_a2a_internal_taskpool_t *)user_data;
+  int r = (__parsec_key) % __parsec_tp->SEND_r_range + __parsec_tp->SEND_r_min;
+  __parsec_key = __parsec_key / __parsec_tp->SEND_r_range;
+  int t = (__parsec_key) % __parsec_tp->SEND_t_range + __parsec_tp->SEND_t_min;
+  __parsec_key = __parsec_key / __parsec_tp->SEND_t_range;
+  int s = (__parsec_key) % __parsec_tp->SEND_s_range + __parsec_tp->SEND_s_min;
+  __parsec_key = __parsec_key / __parsec_tp->SEND_s_range;
+  snprintf(buffer, buffer_size, "SEND(%d, %d, %d)", r, t, s);
+  return buffer;
+}
+
+static parsec_key_fn_t a2a_a2a_SEND_internal_init_deps_key_functions = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = a2a_a2a_SEND_internal_init_deps_key_functions_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/* Needs: min-max count-tasks iterate */
+static int a2a_SEND_internal_init(parsec_execution_stream_t * es, __parsec_a2a_SEND_task_t * this_task)
+{
+  __parsec_a2a_internal_taskpool_t *__parsec_tp = (__parsec_a2a_internal_taskpool_t*)this_task->taskpool;
+  int32_t nb_tasks = 0, saved_nb_tasks = 0;
+int32_t __r_min = 0x7fffffff, __r_max = 0;int32_t __jdf2c_r_min = 0x7fffffff, __jdf2c_r_max = 0;int32_t __t_min = 0x7fffffff, __t_max = 0;int32_t __jdf2c_t_min = 0x7fffffff, __jdf2c_t_max = 0;int32_t __s_min = 0x7fffffff, __s_max = 0;int32_t __jdf2c_s_min = 0x7fffffff, __jdf2c_s_max = 0;  __parsec_a2a_SEND_parsec_assignment_t assignments = {  .r.value = 0, .t.value = 0, .s.value = 0 };
+  int32_t  r,  t,  s;
+  int32_t __jdf2c_r_start, __jdf2c_r_end, __jdf2c_r_inc;
+  int32_t __jdf2c_t_start, __jdf2c_t_end, __jdf2c_t_inc;
+  int32_t __jdf2c_s_start, __jdf2c_s_end, __jdf2c_s_inc;
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+  PARSEC_PROFILING_TRACE(es->es_profile,
+                         this_task->taskpool->profiling_array[START_KEY(this_task->task_class->task_class_id)],
+                         0,
+                         this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    __jdf2c_r_start = 0;
+    __jdf2c_r_end = (NR - 1);
+    __jdf2c_r_inc = 1;
+    __r_min = parsec_imin(__jdf2c_r_start, __jdf2c_r_end);
+    __r_max = parsec_imax(__jdf2c_r_start, __jdf2c_r_end);
+    __jdf2c_r_min = parsec_imin(__jdf2c_r_min, __r_min);
+    __jdf2c_r_max = parsec_imax(__jdf2c_r_max, __r_max);
+    for(r =  __jdf2c_r_start;
+        r <= __jdf2c_r_end;
+        r += __jdf2c_r_inc) {
+    assignments.r.value = r;
+      __jdf2c_t_start = 0;
+      __jdf2c_t_end = (NT - 1);
+      __jdf2c_t_inc = 1;
+      __t_min = parsec_imin(__jdf2c_t_start, __jdf2c_t_end);
+      __t_max = parsec_imax(__jdf2c_t_start, __jdf2c_t_end);
+      __jdf2c_t_min = parsec_imin(__jdf2c_t_min, __t_min);
+      __jdf2c_t_max = parsec_imax(__jdf2c_t_max, __t_max);
+      for(t =  __jdf2c_t_start;
+          t <= __jdf2c_t_end;
+          t += __jdf2c_t_inc) {
+      assignments.t.value = t;
+        __jdf2c_s_start = 0;
+        __jdf2c_s_end = (NT - 1);
+        __jdf2c_s_inc = 1;
+        __s_min = parsec_imin(__jdf2c_s_start, __jdf2c_s_end);
+        __s_max = parsec_imax(__jdf2c_s_start, __jdf2c_s_end);
+        __jdf2c_s_min = parsec_imin(__jdf2c_s_min, __s_min);
+        __jdf2c_s_max = parsec_imax(__jdf2c_s_max, __s_max);
+        for(s =  __jdf2c_s_start;
+            s <= __jdf2c_s_end;
+            s += __jdf2c_s_inc) {
+        assignments.s.value = s;
+        if( !SEND_pred(r, t, s) ) continue;
+        nb_tasks++;
+      } /* Loop on normal range s */
+    } /* For loop of t */ 
+  } /* For loop of r */ 
+   if( 0 != nb_tasks ) {
+     (void)parsec_atomic_fetch_add_int32(&__parsec_tp->initial_number_tasks, nb_tasks);
+   }
+  /* Set the range variables for the collision-free hash-computation */
+  __parsec_tp->SEND_r_min   = __jdf2c_r_min;
+  __parsec_tp->SEND_r_range = (__jdf2c_r_max - __jdf2c_r_min) + 1;
+  __parsec_tp->SEND_t_min   = __jdf2c_t_min;
+  __parsec_tp->SEND_t_range = (__jdf2c_t_max - __jdf2c_t_min) + 1;
+  __parsec_tp->SEND_s_min   = __jdf2c_s_min;
+  __parsec_tp->SEND_s_range = (__jdf2c_s_max - __jdf2c_s_min) + 1;
+  this_task->status = PARSEC_TASK_STATUS_COMPLETE;
+
+  PARSEC_AYU_REGISTER_TASK(&a2a_SEND);
+  __parsec_tp->super.super.dependencies_array[2] = PARSEC_OBJ_NEW(parsec_hash_table_t);
+  parsec_hash_table_init(__parsec_tp->super.super.dependencies_array[2], offsetof(parsec_hashable_dependency_t, ht_item), 10, a2a_a2a_SEND_internal_init_deps_key_functions, this_task->taskpool);
+  __parsec_tp->repositories[2] = data_repo_create_nothreadsafe(nb_tasks, __jdf2c_key_fns_SEND, (parsec_taskpool_t*)__parsec_tp, 1);
+(void)saved_nb_tasks;
+(void)__r_min; (void)__r_max;(void)__t_min; (void)__t_max;(void)__s_min; (void)__s_max;  (void)__jdf2c_r_start; (void)__jdf2c_r_end; (void)__jdf2c_r_inc;  (void)__jdf2c_t_start; (void)__jdf2c_t_end; (void)__jdf2c_t_inc;  (void)__jdf2c_s_start; (void)__jdf2c_s_end; (void)__jdf2c_s_inc;  (void)assignments; (void)__parsec_tp; (void)es;
+  if(1 == parsec_atomic_fetch_dec_int32(&__parsec_tp->sync_point)) {
+    /* Last initialization task complete. Update the number of tasks. */
+    __parsec_tp->super.super.tdm.module->taskpool_addto_nb_tasks(&__parsec_tp->super.super, __parsec_tp->initial_number_tasks);
+    parsec_mfence();  /* write memory barrier to guarantee that the scheduler gets the correct number of tasks */
+    parsec_taskpool_enable((parsec_taskpool_t*)__parsec_tp, &__parsec_tp->startup_queue,
+                           (parsec_task_t*)this_task, es, __parsec_tp->super.super.nb_pending_actions);
+    __parsec_tp->super.super.tdm.module->taskpool_ready(&__parsec_tp->super.super);
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+    PARSEC_PROFILING_TRACE(es->es_profile,
+                           this_task->taskpool->profiling_array[2 * this_task->task_class->task_class_id + 1],
+                           0,
+                           this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    return PARSEC_HOOK_RETURN_DONE;
+  }
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static const __parsec_chore_t __a2a_SEND_chores[] ={
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+    { .type     = PARSEC_DEV_CPU,
+      .evaluate = (parsec_evaluate_function_t*)NULL,
+      .hook     = (parsec_hook_t*)hook_of_a2a_SEND },
+#endif  /* defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+    { .type     = PARSEC_DEV_NONE,
+      .evaluate = NULL,
+      .hook     = (parsec_hook_t*)NULL },  /* End marker */
+};
+
+static const parsec_task_class_t a2a_SEND = {
+  .name = "SEND",
+  .task_class_id = 2,
+  .nb_flows = 1,
+  .nb_parameters = 3,
+  .nb_locals = 3,
+  .task_class_type = PARSEC_TASK_CLASS_TYPE_PTG,
+  .params = { &symb_a2a_SEND_r, &symb_a2a_SEND_t, &symb_a2a_SEND_s, NULL },
+  .locals = { &symb_a2a_SEND_r, &symb_a2a_SEND_t, &symb_a2a_SEND_s, NULL },
+  .data_affinity = (parsec_data_ref_fn_t*)affinity_of_a2a_SEND,
+  .initial_data = (parsec_data_ref_fn_t*)affinity_of_a2a_SEND,
+  .final_data = (parsec_data_ref_fn_t*)affinity_of_a2a_SEND,
+  .priority = NULL,
+  .properties = properties_of_a2a_SEND,
+#if MAX_PARAM_COUNT < 1  /* number of read flows of SEND */
+  #error Too many read flows for task SEND
+#endif  /* MAX_PARAM_COUNT */
+#if MAX_PARAM_COUNT < 0  /* number of write flows of SEND */
+  #error Too many write flows for task SEND
+#endif  /* MAX_PARAM_COUNT */
+  .in = { &flow_of_a2a_SEND_for_A, NULL },
+  .out = { &flow_of_a2a_SEND_for_A, NULL },
+  .flags = 0x0 | PARSEC_USE_DEPS_MASK,
+  .dependencies_goal = 0x1,
+  .make_key = __jdf2c_make_key_SEND,
+  .task_snprintf = parsec_task_snprintf,
+#if defined(PARSEC_PROF_TRACE)
+  .profile_info = &parsec_task_profile_info,
+#endif
+  .key_functions = &__jdf2c_key_fns_SEND,
+  .fini = (parsec_hook_t*)NULL,
+  .incarnations = __a2a_SEND_chores,
+  .find_deps = parsec_hash_find_deps,
+  .update_deps = parsec_update_deps_with_mask,
+  .iterate_successors = (parsec_traverse_function_t*)iterate_successors_of_a2a_SEND,
+  .iterate_predecessors = (parsec_traverse_function_t*)iterate_predecessors_of_a2a_SEND,
+  .release_deps = (parsec_release_deps_t*)release_deps_of_a2a_SEND,
+  .prepare_output = (parsec_hook_t*)NULL,
+  .prepare_input = (parsec_hook_t*)data_lookup_of_a2a_SEND,
+  .time_estimate = NULL,
+  .get_datatype = datatype_lookup_of_a2a_SEND,
+  .complete_execution = (parsec_hook_t*)complete_hook_of_a2a_SEND,
+  .release_task = &release_task_of_a2a_SEND,
+#if defined(PARSEC_SIM)
+  .sim_cost_fct = (parsec_sim_cost_fct_t*)NULL,
+#endif
+};
+
+
+/******                                    FANOUT                                    ******/
+
+static inline int32_t minexpr_of_symb_a2a_FANOUT_r_fct(const __parsec_a2a_internal_taskpool_t *__parsec_tp, const __parsec_a2a_FANOUT_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_a2a_FANOUT_r = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_a2a_FANOUT_r_fct }
+                   }
+};
+static inline int maxexpr_of_symb_a2a_FANOUT_r_fct(const __parsec_a2a_internal_taskpool_t *__parsec_tp, const __parsec_a2a_FANOUT_parsec_assignment_t *locals)
+{
+  const int r = locals->r.value; (void)r;
+  const int t = locals->t.value; (void)t;
+
+  (void)r;
+  (void)t;
+  (void)__parsec_tp; (void)locals;
+  return (NR - 1);
+}
+static const parsec_expr_t maxexpr_of_symb_a2a_FANOUT_r = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_a2a_FANOUT_r_fct }
+                   }
+};
+static const parsec_symbol_t symb_a2a_FANOUT_r = { .name = "r", .context_index = 0, .min = &minexpr_of_symb_a2a_FANOUT_r, .max = &maxexpr_of_symb_a2a_FANOUT_r, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int32_t minexpr_of_symb_a2a_FANOUT_t_fct(const __parsec_a2a_internal_taskpool_t *__parsec_tp, const __parsec_a2a_FANOUT_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_a2a_FANOUT_t = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_a2a_FANOUT_t_fct }
+                   }
+};
+static inline int maxexpr_of_symb_a2a_FANOUT_t_fct(const __parsec_a2a_internal_taskpool_t *__parsec_tp, const __parsec_a2a_FANOUT_parsec_assignment_t *locals)
+{
+  const int r = locals->r.value; (void)r;
+  const int t = locals->t.value; (void)t;
+
+  (void)r;
+  (void)t;
+  (void)__parsec_tp; (void)locals;
+  return (NT - 1);
+}
+static const parsec_expr_t maxexpr_of_symb_a2a_FANOUT_t = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_a2a_FANOUT_t_fct }
+                   }
+};
+static const parsec_symbol_t symb_a2a_FANOUT_t = { .name = "t", .context_index = 1, .min = &minexpr_of_symb_a2a_FANOUT_t, .max = &maxexpr_of_symb_a2a_FANOUT_t, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int affinity_of_a2a_FANOUT(const __parsec_a2a_FANOUT_task_t *this_task,
+                     parsec_data_ref_t *ref)
+{
+    const __parsec_a2a_internal_taskpool_t *__parsec_tp = (const __parsec_a2a_internal_taskpool_t*)this_task->taskpool;
+  const int r = this_task->locals.r.value; (void)r;
+  const int t = this_task->locals.t.value; (void)t;
+
+  /* Silent Warnings: should look into predicate to know what variables are usefull */
+  (void)r;
+  (void)t;
+  ref->dc = (parsec_data_collection_t *)__parsec_tp->super._g_descA;
+  /* Compute data key */
+  ref->key = ref->dc->data_key(ref->dc, t, 0);
+  return 1;
+}
+static const parsec_property_t properties_of_a2a_FANOUT[1] = {
+  {.name = NULL, .expr = NULL}
+};
+static inline int expr_of_cond_for_flow_of_a2a_FANOUT_for_A_dep1_atline_58_iftrue_fct(const __parsec_a2a_internal_taskpool_t *__parsec_tp, const __parsec_a2a_FANOUT_parsec_assignment_t *locals)
+{
+  const int r = locals->r.value;
+  const int t = locals->t.value; (void)t;
+
+  (void)r;
+  (void)t;
+  (void)__parsec_tp; (void)locals;
+  return (r) == (0);
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_a2a_FANOUT_for_A_dep1_atline_58_iftrue = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_a2a_FANOUT_for_A_dep1_atline_58_iftrue_fct }
+                   }
+};
+static parsec_data_t *flow_of_a2a_FANOUT_for_A_dep1_atline_58_direct_access(const __parsec_a2a_internal_taskpool_t *__parsec_tp, const __parsec_a2a_FANOUT_parsec_assignment_t *assignments)
+{
+  const int r = assignments->r.value; (void)r;
+  const int t = assignments->t.value; (void)t;
+
+  /* Silence Warnings: should look into parameters to know what variables are useful */
+  (void)r;
+  (void)t;
+  if( __parsec_tp->super.super.context->my_rank == (int32_t)rank_of_descA(t, 0) )
+    return data_of_descA(t, 0);
+  return NULL;
+}
+
+static const parsec_dep_t flow_of_a2a_FANOUT_for_A_dep1_atline_58_iftrue = {
+  .cond = &expr_of_cond_for_flow_of_a2a_FANOUT_for_A_dep1_atline_58_iftrue,  /* (r) == (0) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = PARSEC_LOCAL_DATA_TASK_CLASS_ID, /* a2a_descA */
+  .direct_data = (parsec_data_lookup_func_t)&flow_of_a2a_FANOUT_for_A_dep1_atline_58_direct_access,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_a2a_FANOUT_for_A,
+};
+static inline int expr_of_cond_for_flow_of_a2a_FANOUT_for_A_dep1_atline_58_iffalse_fct(const __parsec_a2a_internal_taskpool_t *__parsec_tp, const __parsec_a2a_FANOUT_parsec_assignment_t *locals)
+{
+  const int r = locals->r.value;
+  const int t = locals->t.value; (void)t;
+
+  (void)r;
+  (void)t;
+  (void)__parsec_tp; (void)locals;
+  return !((r) == (0));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_a2a_FANOUT_for_A_dep1_atline_58_iffalse = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_a2a_FANOUT_for_A_dep1_atline_58_iffalse_fct }
+                   }
+};
+static const parsec_dep_t flow_of_a2a_FANOUT_for_A_dep1_atline_58_iffalse = {
+  .cond = &expr_of_cond_for_flow_of_a2a_FANOUT_for_A_dep1_atline_58_iffalse,  /* !(r) == (0) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 1, /* a2a_FANOUT */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_a2a_FANOUT_for_A,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_a2a_FANOUT_for_A,
+};
+static const parsec_dep_t flow_of_a2a_FANOUT_for_A_dep2_atline_59 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 2, /* a2a_SEND */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_a2a_SEND_for_A,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_a2a_FANOUT_for_A,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+#if MAX_DEP_OUT_COUNT < 1  /* number of output dependencies */
+    #error Too many output dependencies (supports up to MAX_DEP_OUT_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_OUT_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_a2a_FANOUT_for_A = {
+  .name               = "A",
+  .sym_type           = PARSEC_SYM_INOUT,
+  .flow_flags         = PARSEC_FLOW_ACCESS_READ|PARSEC_FLOW_HAS_IN_DEPS,
+  .flow_index         = 0,
+  .flow_datatype_mask = 0x1,
+  .dep_in     = { &flow_of_a2a_FANOUT_for_A_dep1_atline_58_iftrue,
+ &flow_of_a2a_FANOUT_for_A_dep1_atline_58_iffalse },
+  .dep_out    = { &flow_of_a2a_FANOUT_for_A_dep2_atline_59 }
+};
+
+static void
+iterate_successors_of_a2a_FANOUT(parsec_execution_stream_t *es, const __parsec_a2a_FANOUT_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_a2a_internal_taskpool_t *__parsec_tp = (const __parsec_a2a_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_a2a_FANOUT_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_a2a_FANOUT_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int r = __jdf2c__tmp_locals.r.value; (void)r;
+  const int t = __jdf2c__tmp_locals.t.value; (void)t;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)r;  (void)t;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_descA(t, 0);
+#endif
+  if( action_mask & 0x1 ) {  /* Flow of data A [0] */
+    data.data   = this_task->data._f_A.data_out;
+    data.data_future  = NULL;
+    if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_a2a_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_a2a_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+       __parsec_a2a_SEND_task_t* ncc = (__parsec_a2a_SEND_task_t*)&nc;
+    nc.task_class = __parsec_tp->super.super.task_classes_array[a2a_SEND.task_class_id];
+      const int SEND_r = r;
+      if( (SEND_r >= (0)) && (SEND_r <= ((NR - 1))) ) {
+        assert(&nc.locals[0].value == &ncc->locals.r.value);
+        ncc->locals.r.value = SEND_r;
+        const int SEND_t = t;
+        if( (SEND_t >= (0)) && (SEND_t <= ((NT - 1))) ) {
+          assert(&nc.locals[1].value == &ncc->locals.t.value);
+          ncc->locals.t.value = SEND_t;
+          int SEND_s;
+        for( SEND_s = 0;SEND_s <= (NT - 1); SEND_s+=1) {
+            if( (SEND_s >= (0)) && (SEND_s <= ((NT - 1))) ) {
+              assert(&nc.locals[2].value == &ncc->locals.s.value);
+              ncc->locals.s.value = SEND_s;
+#if defined(DISTRIBUTED)
+              rank_dst = rank_of_descA(ncc->locals.t.value, 0);
+              if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+                vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, ncc->locals.t.value, 0);
+              nc.priority = __parsec_tp->super.super.priority;
+              successor_repo = SEND_repo;
+              successor_repo_key = __jdf2c_make_key_SEND((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+            RELEASE_DEP_OUTPUT(es, "A", this_task, "A", &nc, rank_src, rank_dst, &data);
+            if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_a2a_FANOUT_for_A_dep2_atline_59, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+              }
+            }
+          }
+        }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static void
+iterate_predecessors_of_a2a_FANOUT(parsec_execution_stream_t *es, const __parsec_a2a_FANOUT_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_a2a_internal_taskpool_t *__parsec_tp = (const __parsec_a2a_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_a2a_FANOUT_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_a2a_FANOUT_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int r = __jdf2c__tmp_locals.r.value; (void)r;
+  const int t = __jdf2c__tmp_locals.t.value; (void)t;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)r;  (void)t;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_descA(t, 0);
+#endif
+  if( action_mask & 0x1 ) {  /* Flow of data A [0] */
+    data.data   = this_task->data._f_A.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x1 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_a2a_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_a2a_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( !((r) == (0)) ) {
+      __parsec_a2a_FANOUT_task_t* ncc = (__parsec_a2a_FANOUT_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[a2a_FANOUT.task_class_id];
+        const int FANOUT_r = (r - 1);
+        if( (FANOUT_r >= (0)) && (FANOUT_r <= ((NR - 1))) ) {
+          assert(&nc.locals[0].value == &ncc->locals.r.value);
+          ncc->locals.r.value = FANOUT_r;
+          const int FANOUT_t = t;
+          if( (FANOUT_t >= (0)) && (FANOUT_t <= ((NT - 1))) ) {
+            assert(&nc.locals[1].value == &ncc->locals.t.value);
+            ncc->locals.t.value = FANOUT_t;
+#if defined(DISTRIBUTED)
+            rank_dst = rank_of_descA(ncc->locals.t.value, 0);
+            if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+              vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, ncc->locals.t.value, 0);
+            nc.priority = __parsec_tp->super.super.priority;
+            successor_repo = FANOUT_repo;
+            successor_repo_key = __jdf2c_make_key_FANOUT((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+          RELEASE_DEP_OUTPUT(es, "A", this_task, "A", &nc, rank_src, rank_dst, &data);
+          if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_a2a_FANOUT_for_A_dep1_atline_58_iffalse, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+            }
+          }
+    }
+  }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static int release_deps_of_a2a_FANOUT(parsec_execution_stream_t *es, __parsec_a2a_FANOUT_task_t *this_task, uint32_t action_mask, parsec_remote_deps_t *deps)
+{
+  PARSEC_PINS(es, RELEASE_DEPS_BEGIN, (parsec_task_t *)this_task);  const __parsec_a2a_internal_taskpool_t *__parsec_tp = (const __parsec_a2a_internal_taskpool_t *)this_task->taskpool;
+  parsec_release_dep_fct_arg_t arg;
+  int __vp_id;
+  int consume_local_repo = 0;
+  arg.action_mask = action_mask;
+  arg.output_entry = NULL;
+  arg.output_repo = NULL;
+#if defined(DISTRIBUTED)
+  arg.remote_deps = deps;
+#endif  /* defined(DISTRIBUTED) */
+  assert(NULL != es);
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS )    arg.ready_lists = alloca(sizeof(parsec_task_t *) * es->virtual_process->parsec_context->nb_vp);
+  else
+    arg.ready_lists = NULL;
+  for( __vp_id = 0; __vp_id < es->virtual_process->parsec_context->nb_vp; arg.ready_lists[__vp_id++] = NULL );
+  (void)__parsec_tp; (void)deps;
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_A.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_A.source_repo, this_task->data._f_A.source_repo_entry->ht_item.key );
+    }
+  }
+  consume_local_repo = (this_task->repo_entry != NULL);
+  arg.output_repo = FANOUT_repo;
+  arg.output_entry = this_task->repo_entry;
+  arg.output_usage = 0;
+  if( action_mask & (PARSEC_ACTION_RELEASE_LOCAL_DEPS | PARSEC_ACTION_GET_REPO_ENTRY) ) {
+    arg.output_entry = data_repo_lookup_entry_and_create( es, arg.output_repo, __jdf2c_make_key_FANOUT((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    arg.output_entry->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(arg.output_entry->sim_exec_date == 0);
+    arg.output_entry->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  if(action_mask & ( PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE ) ){
+    /* Generate the reshape promise for the outputs that need it */
+    iterate_successors_of_a2a_FANOUT(es, this_task, action_mask, parsec_set_up_reshape_promise, &arg);
+   }
+  iterate_successors_of_a2a_FANOUT(es, this_task, action_mask, parsec_release_dep_fct, &arg);
+
+#if defined(DISTRIBUTED)
+  if( (action_mask & PARSEC_ACTION_SEND_REMOTE_DEPS) && (NULL != arg.remote_deps)) {
+    parsec_remote_dep_activate(es, (parsec_task_t *)this_task, arg.remote_deps, arg.remote_deps->outgoing_mask);
+  }
+#endif
+
+  if(action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS) {
+    data_repo_entry_addto_usage_limit(FANOUT_repo, arg.output_entry->ht_item.key, arg.output_usage);
+    __parsec_schedule_vp(es, arg.ready_lists, 0);
+  }
+      if (consume_local_repo) {
+         data_repo_entry_used_once( FANOUT_repo, this_task->repo_entry->ht_item.key );
+      }
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_A.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_A.data_in);
+    }
+  }
+  PARSEC_PINS(es, RELEASE_DEPS_END, (parsec_task_t *)this_task);  return 0;
+}
+
+static int data_lookup_of_a2a_FANOUT(parsec_execution_stream_t *es, __parsec_a2a_FANOUT_task_t *this_task)
+{
+  const __parsec_a2a_internal_taskpool_t *__parsec_tp = (__parsec_a2a_internal_taskpool_t *)this_task->taskpool;
+  parsec_assignment_t generic_locals[MAX_PARAM_COUNT];  /* generic task locals */
+  int target_device = 0; (void)target_device;
+  (void)__parsec_tp; (void)generic_locals; (void)es;
+  parsec_data_copy_t *chunk = NULL;
+  data_repo_t        *reshape_repo  = NULL, *consumed_repo  = NULL;
+  data_repo_entry_t  *reshape_entry = NULL, *consumed_entry = NULL;
+  parsec_key_t        reshape_entry_key = 0, consumed_entry_key = 0;
+  uint8_t             consumed_flow_index;
+  parsec_dep_data_description_t data;
+  int ret;
+  (void)reshape_repo; (void)reshape_entry; (void)reshape_entry_key;
+  (void)consumed_repo; (void)consumed_entry; (void)consumed_entry_key;
+  (void)consumed_flow_index;
+  (void)chunk; (void)data; (void)ret;
+  const int r = this_task->locals.r.value; (void)r;
+  const int t = this_task->locals.t.value; (void)t;
+  if( NULL == this_task->repo_entry ){
+    this_task->repo_entry = data_repo_lookup_entry_and_create(es, FANOUT_repo,                                       __jdf2c_make_key_FANOUT((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    data_repo_entry_addto_usage_limit(FANOUT_repo, this_task->repo_entry->ht_item.key, 1);    this_task->repo_entry ->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(this_task->repo_entry ->sim_exec_date == 0);
+    this_task->repo_entry ->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  /* The reshape repo is the current task repo. */  reshape_repo = FANOUT_repo;
+  reshape_entry_key = __jdf2c_make_key_FANOUT((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals) ;
+  reshape_entry = this_task->repo_entry;
+  /* Lookup the input data, and store them in the context if any */
+
+if(! this_task->data._f_A.fulfill ){ /* Flow A */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_A.data_out = NULL;  /* By default, if nothing matches */
+    if( (r) == (0) ) {
+    /* Flow A [0] dependency [0] from memory descA */
+    if( NULL == (chunk = this_task->data._f_A.data_in) ) {
+    /* No data set up by predecessor on this task input flow */
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+    parsec_prof_grapher_data_input(data_of_descA(t, 0), (parsec_task_t*)this_task, &flow_of_a2a_FANOUT_for_A, 1);
+#endif
+      chunk = parsec_data_get_copy(data_of_descA(t, 0), target_device);
+      data.data = chunk;
+      data.data_future  = NULL;
+          data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      data.data_future   = NULL;
+      if( (ret = parsec_get_copy_reshape_from_desc(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      this_task->data._f_A.data_out = chunk;
+      PARSEC_OBJ_RETAIN(chunk);
+    } 
+    } else {
+    /* Flow A [0] dependency [0] from predecessor FANOUT */
+    if( NULL == (chunk = this_task->data._f_A.data_in) ) {
+    /* No data set up by predecessor on this task input flow */
+__parsec_a2a_FANOUT_parsec_assignment_t *target_locals = (__parsec_a2a_FANOUT_parsec_assignment_t*)&generic_locals;
+      const int FANOUTr = target_locals->r.value = (r - 1); (void)FANOUTr;
+      const int FANOUTt = target_locals->t.value = t; (void)FANOUTt;
+      if( (reshape_entry != NULL) && (reshape_entry->data[0] != NULL) ){
+          /* Reshape promise set up on this task repo by predecessor */
+          consumed_repo = reshape_repo;
+          consumed_entry = reshape_entry;
+          consumed_entry_key = reshape_entry_key;
+          consumed_flow_index = 0;
+      }else{
+          /* Consume from predecessor's repo */
+          consumed_repo = FANOUT_repo;
+          consumed_entry_key = __jdf2c_make_key_FANOUT((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)target_locals) ;
+          consumed_entry = data_repo_lookup_entry( consumed_repo, consumed_entry_key );
+          consumed_flow_index = 0;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      ACQUIRE_FLOW(this_task, "A", &a2a_FANOUT, "A", target_locals, chunk);
+      this_task->data._f_A.data_out = chunk;
+    } 
+    else {
+      /* Data set up by predecessor on this task input flow */
+      consumed_repo = this_task->data._f_A.source_repo;
+      consumed_entry = this_task->data._f_A.source_repo_entry;
+      consumed_entry_key = this_task->data._f_A.source_repo_entry->ht_item.key;
+      if( (reshape_entry != NULL) && (reshape_entry->data[0] != NULL) ){
+          /* Reshape promise set up on input by predecessor is on this task repo */
+          consumed_flow_index = 0;
+          assert( (this_task->data._f_A.source_repo == reshape_repo)
+               && (this_task->data._f_A.source_repo_entry == reshape_entry));
+      }else{
+          /* Reshape promise set up on input by predecessor is the predecesssor task repo */
+          consumed_flow_index = 0;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      this_task->data._f_A.data_out = parsec_data_get_copy(chunk->original, target_device);
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+      parsec_prof_grapher_data_input(chunk->original, (parsec_task_t*)this_task, &flow_of_a2a_FANOUT_for_A, 0);
+#endif
+    }
+    }
+    this_task->data._f_A.data_in     = chunk;
+    this_task->data._f_A.source_repo       = consumed_repo;
+    this_task->data._f_A.source_repo_entry = consumed_entry;
+    if( this_task->data._f_A.source_repo_entry == this_task->repo_entry ){
+      /* in case we have consume from this task repo entry for the flow,
+       * it is cleaned up, avoiding having old stuff during release_deps_of
+       */
+      this_task->repo_entry->data[0] = NULL;
+    }
+    this_task->data._f_A.fulfill = 1;
+}
+
+  /** Generate profiling information */
+#if defined(PARSEC_PROF_TRACE)
+  this_task->prof_info.desc = (parsec_data_collection_t*)__parsec_tp->super._g_descA;
+  this_task->prof_info.priority = this_task->priority;
+  this_task->prof_info.data_id   = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->data_key((parsec_data_collection_t*)__parsec_tp->super._g_descA, t, 0);
+  this_task->prof_info.task_class_id = this_task->task_class->task_class_id;
+  this_task->prof_info.task_return_code = -1;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int datatype_lookup_of_a2a_FANOUT(parsec_execution_stream_t *es, const parsec_task_t *this_generic_task, const parsec_task_t *parent_task,
+              uint32_t* flow_mask, parsec_dep_data_description_t* data)
+{
+  const __parsec_a2a_FANOUT_task_t *this_task = (__parsec_a2a_FANOUT_task_t*)this_generic_task;
+  const __parsec_a2a_internal_taskpool_t *__parsec_tp = (__parsec_a2a_internal_taskpool_t *)this_task->taskpool;
+  (void)__parsec_tp; (void)es; (void)this_task; (void)data; (void)parent_task;
+  const int r = this_task->locals.r.value; (void)r;
+  const int t = this_task->locals.t.value; (void)t;
+  data->local.arena = data->remote.arena = NULL;
+  data->local.src_datatype  = data->local.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->local.src_count     = data->local.dst_count = 0;
+  data->local.src_displ     = data->local.dst_displ = 0;
+  data->data_future  = NULL;
+  if( (*flow_mask) & 0x80000000U ) { /* these are the input dependencies remote datatypes  */
+if( (*flow_mask) & 0x1U ) {  /* Flow A */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_a2a_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_a2a_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_a2a_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+    goto no_mask_match;
+  }
+
+  /* these are the output dependencies remote datatypes */
+if( (*flow_mask) & 0x1U ) {  /* Flow A */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_a2a_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_a2a_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_a2a_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+ no_mask_match:
+  data->data                             = NULL;
+  data->remote.src_datatype = data->remote.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->remote.src_count    = data->remote.dst_count = 0;
+  data->remote.src_displ    = data->remote.dst_displ = 0;
+  data->data_future  = NULL;
+  (*flow_mask) = 0;  /* nothing left */
+  (void)r;  (void)t;
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+static int hook_of_a2a_FANOUT(parsec_execution_stream_t *es, __parsec_a2a_FANOUT_task_t *this_task)
+{
+  __parsec_a2a_internal_taskpool_t *__parsec_tp = (__parsec_a2a_internal_taskpool_t *)this_task->taskpool;
+  (void)es; (void)__parsec_tp;
+  const int r = this_task->locals.r.value; (void)r;
+  const int t = this_task->locals.t.value; (void)t;
+  (void)r;  (void)t;
+
+  /** Declare the variables that will hold the data, and all the accounting for each */
+  parsec_data_copy_t *_f_A = this_task->data._f_A.data_in;
+  void *A = PARSEC_DATA_COPY_GET_PTR(_f_A); (void)A;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    data_repo_entry_t *eA = this_task->data._f_A.source_repo_entry;
+    if( (NULL != eA) && (eA->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eA->sim_exec_date;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+  /** Cache Awareness Accounting */
+#if defined(PARSEC_CACHE_AWARENESS)
+  cache_buf_referenced(es->closest_cache, A);
+#endif /* PARSEC_CACHE_AWARENESS */
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                                  FANOUT BODY                                  -----*/
+
+
+/*-----                              END OF FANOUT BODY                              -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#endif  /*  defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+static int complete_hook_of_a2a_FANOUT(parsec_execution_stream_t *es, __parsec_a2a_FANOUT_task_t *this_task)
+{
+  const __parsec_a2a_internal_taskpool_t *__parsec_tp = (__parsec_a2a_internal_taskpool_t *)this_task->taskpool;
+#if defined(DISTRIBUTED)
+    const int r = this_task->locals.r.value; (void)r;
+  const int t = this_task->locals.t.value; (void)t;
+#endif  /* defined(DISTRIBUTED) */
+  (void)es; (void)__parsec_tp;
+parsec_data_t* data_t_desc = NULL; (void)data_t_desc;
+#if defined(DISTRIBUTED)
+  /** If not working on distributed, there is no risk that data is not in place */
+  (void)r;  (void)t;
+
+#endif /* DISTRIBUTED */
+#if defined(PARSEC_PROF_GRAPHER)
+  parsec_prof_grapher_task((parsec_task_t*)this_task, es->th_id, es->virtual_process->vp_id,
+     __jdf2c_key_fns_FANOUT.key_hash(this_task->task_class->make_key( (parsec_taskpool_t*)this_task->taskpool, ((parsec_task_t*)this_task)->locals), NULL));
+#endif  /* defined(PARSEC_PROF_GRAPHER) */
+  release_deps_of_a2a_FANOUT(es, this_task,
+      PARSEC_ACTION_RELEASE_REMOTE_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_REFS |
+      PARSEC_ACTION_RESHAPE_ON_RELEASE |
+      0x1,  /* mask of all dep_index */ 
+      NULL);
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static parsec_hook_return_t release_task_of_a2a_FANOUT(parsec_execution_stream_t *es, parsec_task_t *this_task)
+{
+    const __parsec_a2a_internal_taskpool_t *__parsec_tp =
+        (const __parsec_a2a_internal_taskpool_t *)this_task->taskpool;
+    parsec_hash_table_t *ht = (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[1];
+    parsec_key_t key = this_task->task_class->make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals);
+    parsec_hashable_dependency_t *hash_dep = (parsec_hashable_dependency_t *)parsec_hash_table_remove(ht, key);
+    parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);
+    return parsec_release_task_to_mempool_update_nbtasks(es, this_task);
+}
+
+static char *a2a_a2a_FANOUT_internal_init_deps_key_functions_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_a2a_internal_taskpool_t *__parsec_tp = (__parsec_a2a_internal_taskpool_t *)user_data;
+  int r = (__parsec_key) % __parsec_tp->FANOUT_r_range + __parsec_tp->FANOUT_r_min;
+  __parsec_key = __parsec_key / __parsec_tp->FANOUT_r_range;
+  int t = (__parsec_key) % __parsec_tp->FANOUT_t_range + __parsec_tp->FANOUT_t_min;
+  __parsec_key = __parsec_key / __parsec_tp->FANOUT_t_range;
+  snprintf(buffer, buffer_size, "FANOUT(%d, %d)", r, t);
+  return buffer;
+}
+
+static parsec_key_fn_t a2a_a2a_FANOUT_internal_init_deps_key_functions = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = a2a_a2a_FANOUT_internal_init_deps_key_functions_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/* Needs: min-max count-tasks iterate */
+static int a2a_FANOUT_internal_init(parsec_execution_stream_t * es, __parsec_a2a_FANOUT_task_t * this_task)
+{
+  __parsec_a2a_internal_taskpool_t *__parsec_tp = (__parsec_a2a_internal_taskpool_t*)this_task->taskpool;
+  int32_t nb_tasks = 0, saved_nb_tasks = 0;
+int32_t __r_min = 0x7fffffff, __r_max = 0;int32_t __jdf2c_r_min = 0x7fffffff, __jdf2c_r_max = 0;int32_t __t_min = 0x7fffffff, __t_max = 0;int32_t __jdf2c_t_min = 0x7fffffff, __jdf2c_t_max = 0;  __parsec_a2a_FANOUT_parsec_assignment_t assignments = {  .r.value = 0, .t.value = 0 };
+  int32_t  r,  t;
+  int32_t __jdf2c_r_start, __jdf2c_r_end, __jdf2c_r_inc;
+  int32_t __jdf2c_t_start, __jdf2c_t_end, __jdf2c_t_inc;
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+  PARSEC_PROFILING_TRACE(es->es_profile,
+                         this_task->taskpool->profiling_array[START_KEY(this_task->task_class->task_class_id)],
+                         0,
+                         this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    __jdf2c_r_start = 0;
+    __jdf2c_r_end = (NR - 1);
+    __jdf2c_r_inc = 1;
+    __r_min = parsec_imin(__jdf2c_r_start, __jdf2c_r_end);
+    __r_max = parsec_imax(__jdf2c_r_start, __jdf2c_r_end);
+    __jdf2c_r_min = parsec_imin(__jdf2c_r_min, __r_min);
+    __jdf2c_r_max = parsec_imax(__jdf2c_r_max, __r_max);
+    for(r =  __jdf2c_r_start;
+        r <= __jdf2c_r_end;
+        r += __jdf2c_r_inc) {
+    assignments.r.value = r;
+      __jdf2c_t_start = 0;
+      __jdf2c_t_end = (NT - 1);
+      __jdf2c_t_inc = 1;
+      __t_min = parsec_imin(__jdf2c_t_start, __jdf2c_t_end);
+      __t_max = parsec_imax(__jdf2c_t_start, __jdf2c_t_end);
+      __jdf2c_t_min = parsec_imin(__jdf2c_t_min, __t_min);
+      __jdf2c_t_max = parsec_imax(__jdf2c_t_max, __t_max);
+      for(t =  __jdf2c_t_start;
+          t <= __jdf2c_t_end;
+          t += __jdf2c_t_inc) {
+      assignments.t.value = t;
+      if( !FANOUT_pred(r, t) ) continue;
+      nb_tasks++;
+    } /* Loop on normal range t */
+  } /* For loop of r */ 
+   if( 0 != nb_tasks ) {
+     (void)parsec_atomic_fetch_add_int32(&__parsec_tp->initial_number_tasks, nb_tasks);
+   }
+  /* Set the range variables for the collision-free hash-computation */
+  __parsec_tp->FANOUT_r_min   = __jdf2c_r_min;
+  __parsec_tp->FANOUT_r_range = (__jdf2c_r_max - __jdf2c_r_min) + 1;
+  __parsec_tp->FANOUT_t_min   = __jdf2c_t_min;
+  __parsec_tp->FANOUT_t_range = (__jdf2c_t_max - __jdf2c_t_min) + 1;
+    do {
+      this_task->super.list_next = (parsec_list_item_t*)__parsec_tp->startup_queue;
+    } while(!parsec_atomic_cas_ptr(&__parsec_tp->startup_queue, (parsec_list_item_t*)this_task->super.list_next, this_task));
+    this_task->status = PARSEC_TASK_STATUS_HOOK;
+
+  PARSEC_AYU_REGISTER_TASK(&a2a_FANOUT);
+  __parsec_tp->super.super.dependencies_array[1] = PARSEC_OBJ_NEW(parsec_hash_table_t);
+  parsec_hash_table_init(__parsec_tp->super.super.dependencies_array[1], offsetof(parsec_hashable_dependency_t, ht_item), 10, a2a_a2a_FANOUT_internal_init_deps_key_functions, this_task->taskpool);
+  __parsec_tp->repositories[1] = data_repo_create_nothreadsafe(nb_tasks, __jdf2c_key_fns_FANOUT, (parsec_taskpool_t*)__parsec_tp, 1);
+(void)saved_nb_tasks;
+(void)__r_min; (void)__r_max;(void)__t_min; (void)__t_max;  (void)__jdf2c_r_start; (void)__jdf2c_r_end; (void)__jdf2c_r_inc;  (void)__jdf2c_t_start; (void)__jdf2c_t_end; (void)__jdf2c_t_inc;  (void)assignments; (void)__parsec_tp; (void)es;
+  if(1 == parsec_atomic_fetch_dec_int32(&__parsec_tp->sync_point)) {
+    /* Last initialization task complete. Update the number of tasks. */
+    __parsec_tp->super.super.tdm.module->taskpool_addto_nb_tasks(&__parsec_tp->super.super, __parsec_tp->initial_number_tasks);
+    parsec_mfence();  /* write memory barrier to guarantee that the scheduler gets the correct number of tasks */
+    parsec_taskpool_enable((parsec_taskpool_t*)__parsec_tp, &__parsec_tp->startup_queue,
+                           (parsec_task_t*)this_task, es, __parsec_tp->super.super.nb_pending_actions);
+    __parsec_tp->super.super.tdm.module->taskpool_ready(&__parsec_tp->super.super);
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+    PARSEC_PROFILING_TRACE(es->es_profile,
+                           this_task->taskpool->profiling_array[2 * this_task->task_class->task_class_id + 1],
+                           0,
+                           this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    if( 1 >= __parsec_tp->super.super.nb_pending_actions ) {
+        /* if no tasks will be generated let's prevent the runtime from calling the hook and instead go directly to complete the task */
+        this_task->status = PARSEC_TASK_STATUS_COMPLETE;
+    }
+    return PARSEC_HOOK_RETURN_DONE;
+  }
+  return PARSEC_HOOK_RETURN_ASYNC;
+}
+
+static int __jdf2c_startup_FANOUT(parsec_execution_stream_t * es, __parsec_a2a_FANOUT_task_t *this_task)
+{
+  __parsec_a2a_FANOUT_task_t* new_task;
+  __parsec_a2a_internal_taskpool_t* __parsec_tp = (__parsec_a2a_internal_taskpool_t*)this_task->taskpool;
+  parsec_context_t *context = __parsec_tp->super.super.context;
+  int vpid = 0, nb_tasks = 0;
+  size_t total_nb_tasks = 0;
+  parsec_list_item_t* pready_ring[context->nb_vp];
+  int restore_context = 0;
+  int r = this_task->locals.r.value;  /* retrieve value saved during the last iteration */
+  int t = this_task->locals.t.value;  /* retrieve value saved during the last iteration */
+  for(int _i = 0; _i < context->nb_vp; pready_ring[_i++] = NULL );
+  if( 0 != this_task->locals.reserved[0].value ) {
+    this_task->locals.reserved[0].value = 1; /* reset the submission process */
+    restore_context = 1;
+    goto restore_context_0;
+  }
+  this_task->locals.reserved[0].value = 1; /* a sane default value */
+  for(this_task->locals.r.value = r = 0;
+      this_task->locals.r.value <= (NR - 1);
+      this_task->locals.r.value += 1, r = this_task->locals.r.value) {
+    for(this_task->locals.t.value = t = 0;
+        this_task->locals.t.value <= (NT - 1);
+        this_task->locals.t.value += 1, t = this_task->locals.t.value) {
+      if( !FANOUT_pred(r, t) ) continue;
+  __parsec_a2a_FANOUT_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_a2a_FANOUT_parsec_assignment_t*)&this_task->locals;
+  (void)__jdf2c__tmp_locals;
+  if( (r) == (0) ) goto __jdf2c_done_check_flow;
+  continue; /* All other cases are not startup tasks */
+ __jdf2c_done_check_flow:
+      if( NULL != ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of ) {
+        vpid = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, t, 0);
+        assert(context->nb_vp >= vpid);
+      } else {
+        vpid = (vpid + 1) % context->nb_vp;  /* spread the initial joy */
+      }
+      new_task = (__parsec_a2a_FANOUT_task_t*)parsec_thread_mempool_allocate( context->virtual_processes[vpid]->execution_streams[0]->context_mempool );
+      PARSEC_OBJ_CONSTRUCT(new_task, parsec_task_t); /* construct called only when new, force-construct it again */
+      /* Copy only the valid elements from this_task to new_task one */
+      new_task->taskpool   = this_task->taskpool;
+      new_task->task_class = __parsec_tp->super.super.task_classes_array[a2a_FANOUT.task_class_id];
+      new_task->chore_mask   = PARSEC_DEV_ALL;
+      new_task->locals.r.value = this_task->locals.r.value;
+      new_task->locals.t.value = this_task->locals.t.value;
+      PARSEC_LIST_ITEM_SINGLETON(new_task);
+      new_task->priority = __parsec_tp->super.super.priority;
+      new_task->repo_entry = NULL;
+      new_task->data._f_A.source_repo_entry = NULL;
+      new_task->data._f_A.source_repo       = NULL;
+      new_task->data._f_A.data_in         = NULL;
+      new_task->data._f_A.data_out        = NULL;
+      new_task->data._f_A.fulfill         = 0;
+#if defined(PARSEC_DEBUG_NOISIER)
+      {
+        char tmp[128];
+        PARSEC_DEBUG_VERBOSE(10, parsec_debug_output, "Add startup task %s to vpid %d",
+               parsec_task_snprintf(tmp, 128, (parsec_task_t*)new_task), vpid);
+      }
+#endif
+      parsec_dependencies_mark_task_as_startup((parsec_task_t*)new_task, es);
+      pready_ring[vpid] = parsec_list_item_ring_push_sorted(pready_ring[vpid],
+                                                            (parsec_list_item_t*)new_task,
+                                                            parsec_execution_context_priority_comparator);
+      nb_tasks++;
+     restore_context_0:  /* we jump here just so that we have code after the label */
+      restore_context = 0;
+      (void)restore_context;
+      if( nb_tasks > this_task->locals.reserved[0].value ) {
+        if( (size_t)this_task->locals.reserved[0].value < parsec_task_startup_iter ) this_task->locals.reserved[0].value <<= 1;
+        __parsec_schedule_vp(es, (parsec_task_t**)pready_ring, 0);
+        total_nb_tasks += nb_tasks;
+        nb_tasks = 0;
+        if( total_nb_tasks > parsec_task_startup_chunk ) {  /* stop here and request to be rescheduled */
+          return PARSEC_HOOK_RETURN_AGAIN;
+        }
+      }
+    } /* Loop on normal range t */
+  } /* Loop on normal range r */
+  (void)vpid;
+  if( 0 != nb_tasks ) {
+    __parsec_schedule_vp(es, (parsec_task_t**)pready_ring, 0);
+    nb_tasks = 0;
+  }
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static const __parsec_chore_t __a2a_FANOUT_chores[] ={
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+    { .type     = PARSEC_DEV_CPU,
+      .evaluate = (parsec_evaluate_function_t*)NULL,
+      .hook     = (parsec_hook_t*)hook_of_a2a_FANOUT },
+#endif  /* defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+    { .type     = PARSEC_DEV_NONE,
+      .evaluate = NULL,
+      .hook     = (parsec_hook_t*)NULL },  /* End marker */
+};
+
+static const parsec_task_class_t a2a_FANOUT = {
+  .name = "FANOUT",
+  .task_class_id = 1,
+  .nb_flows = 1,
+  .nb_parameters = 2,
+  .nb_locals = 2,
+  .task_class_type = PARSEC_TASK_CLASS_TYPE_PTG,
+  .params = { &symb_a2a_FANOUT_r, &symb_a2a_FANOUT_t, NULL },
+  .locals = { &symb_a2a_FANOUT_r, &symb_a2a_FANOUT_t, NULL },
+  .data_affinity = (parsec_data_ref_fn_t*)affinity_of_a2a_FANOUT,
+  .initial_data = (parsec_data_ref_fn_t*)affinity_of_a2a_FANOUT,
+  .final_data = (parsec_data_ref_fn_t*)affinity_of_a2a_FANOUT,
+  .priority = NULL,
+  .properties = properties_of_a2a_FANOUT,
+#if MAX_PARAM_COUNT < 1  /* number of read flows of FANOUT */
+  #error Too many read flows for task FANOUT
+#endif  /* MAX_PARAM_COUNT */
+#if MAX_PARAM_COUNT < 0  /* number of write flows of FANOUT */
+  #error Too many write flows for task FANOUT
+#endif  /* MAX_PARAM_COUNT */
+  .in = { &flow_of_a2a_FANOUT_for_A, NULL },
+  .out = { &flow_of_a2a_FANOUT_for_A, NULL },
+  .flags = 0x0 | PARSEC_HAS_IN_IN_DEPENDENCIES | PARSEC_USE_DEPS_MASK,
+  .dependencies_goal = 0x1,
+  .make_key = __jdf2c_make_key_FANOUT,
+  .task_snprintf = parsec_task_snprintf,
+#if defined(PARSEC_PROF_TRACE)
+  .profile_info = &parsec_task_profile_info,
+#endif
+  .key_functions = &__jdf2c_key_fns_FANOUT,
+  .fini = (parsec_hook_t*)NULL,
+  .incarnations = __a2a_FANOUT_chores,
+  .find_deps = parsec_hash_find_deps,
+  .update_deps = parsec_update_deps_with_mask,
+  .iterate_successors = (parsec_traverse_function_t*)iterate_successors_of_a2a_FANOUT,
+  .iterate_predecessors = (parsec_traverse_function_t*)iterate_predecessors_of_a2a_FANOUT,
+  .release_deps = (parsec_release_deps_t*)release_deps_of_a2a_FANOUT,
+  .prepare_output = (parsec_hook_t*)NULL,
+  .prepare_input = (parsec_hook_t*)data_lookup_of_a2a_FANOUT,
+  .time_estimate = NULL,
+  .get_datatype = datatype_lookup_of_a2a_FANOUT,
+  .complete_execution = (parsec_hook_t*)complete_hook_of_a2a_FANOUT,
+  .release_task = &release_task_of_a2a_FANOUT,
+#if defined(PARSEC_SIM)
+  .sim_cost_fct = (parsec_sim_cost_fct_t*)NULL,
+#endif
+};
+
+
+/******                                    READER_B                                    ******/
+
+static inline int32_t minexpr_of_symb_a2a_READER_B_r_fct(const __parsec_a2a_internal_taskpool_t *__parsec_tp, const __parsec_a2a_READER_B_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_a2a_READER_B_r = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_a2a_READER_B_r_fct }
+                   }
+};
+static inline int maxexpr_of_symb_a2a_READER_B_r_fct(const __parsec_a2a_internal_taskpool_t *__parsec_tp, const __parsec_a2a_READER_B_parsec_assignment_t *locals)
+{
+  const int r = locals->r.value; (void)r;
+  const int t = locals->t.value; (void)t;
+
+  (void)r;
+  (void)t;
+  (void)__parsec_tp; (void)locals;
+  return (NR - 1);
+}
+static const parsec_expr_t maxexpr_of_symb_a2a_READER_B_r = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_a2a_READER_B_r_fct }
+                   }
+};
+static const parsec_symbol_t symb_a2a_READER_B_r = { .name = "r", .context_index = 0, .min = &minexpr_of_symb_a2a_READER_B_r, .max = &maxexpr_of_symb_a2a_READER_B_r, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int32_t minexpr_of_symb_a2a_READER_B_t_fct(const __parsec_a2a_internal_taskpool_t *__parsec_tp, const __parsec_a2a_READER_B_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_a2a_READER_B_t = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_a2a_READER_B_t_fct }
+                   }
+};
+static inline int maxexpr_of_symb_a2a_READER_B_t_fct(const __parsec_a2a_internal_taskpool_t *__parsec_tp, const __parsec_a2a_READER_B_parsec_assignment_t *locals)
+{
+  const int r = locals->r.value; (void)r;
+  const int t = locals->t.value; (void)t;
+
+  (void)r;
+  (void)t;
+  (void)__parsec_tp; (void)locals;
+  return (NT - 1);
+}
+static const parsec_expr_t maxexpr_of_symb_a2a_READER_B_t = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_a2a_READER_B_t_fct }
+                   }
+};
+static const parsec_symbol_t symb_a2a_READER_B_t = { .name = "t", .context_index = 1, .min = &minexpr_of_symb_a2a_READER_B_t, .max = &maxexpr_of_symb_a2a_READER_B_t, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int affinity_of_a2a_READER_B(const __parsec_a2a_READER_B_task_t *this_task,
+                     parsec_data_ref_t *ref)
+{
+    const __parsec_a2a_internal_taskpool_t *__parsec_tp = (const __parsec_a2a_internal_taskpool_t*)this_task->taskpool;
+  const int r = this_task->locals.r.value; (void)r;
+  const int t = this_task->locals.t.value; (void)t;
+
+  /* Silent Warnings: should look into predicate to know what variables are usefull */
+  (void)r;
+  (void)t;
+  ref->dc = (parsec_data_collection_t *)__parsec_tp->super._g_descB;
+  /* Compute data key */
+  ref->key = ref->dc->data_key(ref->dc, t, 0);
+  return 1;
+}
+static const parsec_property_t properties_of_a2a_READER_B[1] = {
+  {.name = NULL, .expr = NULL}
+};
+static inline int expr_of_cond_for_flow_of_a2a_READER_B_for_B_dep1_atline_42_iftrue_fct(const __parsec_a2a_internal_taskpool_t *__parsec_tp, const __parsec_a2a_READER_B_parsec_assignment_t *locals)
+{
+  const int r = locals->r.value;
+  const int t = locals->t.value; (void)t;
+
+  (void)r;
+  (void)t;
+  (void)__parsec_tp; (void)locals;
+  return (r) == (0);
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_a2a_READER_B_for_B_dep1_atline_42_iftrue = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_a2a_READER_B_for_B_dep1_atline_42_iftrue_fct }
+                   }
+};
+static parsec_data_t *flow_of_a2a_READER_B_for_B_dep1_atline_42_direct_access(const __parsec_a2a_internal_taskpool_t *__parsec_tp, const __parsec_a2a_READER_B_parsec_assignment_t *assignments)
+{
+  const int r = assignments->r.value; (void)r;
+  const int t = assignments->t.value; (void)t;
+
+  /* Silence Warnings: should look into parameters to know what variables are useful */
+  (void)r;
+  (void)t;
+  if( __parsec_tp->super.super.context->my_rank == (int32_t)rank_of_descB(t, 0) )
+    return data_of_descB(t, 0);
+  return NULL;
+}
+
+static const parsec_dep_t flow_of_a2a_READER_B_for_B_dep1_atline_42_iftrue = {
+  .cond = &expr_of_cond_for_flow_of_a2a_READER_B_for_B_dep1_atline_42_iftrue,  /* (r) == (0) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = PARSEC_LOCAL_DATA_TASK_CLASS_ID, /* a2a_descB */
+  .direct_data = (parsec_data_lookup_func_t)&flow_of_a2a_READER_B_for_B_dep1_atline_42_direct_access,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_a2a_READER_B_for_B,
+};
+static inline int expr_of_cond_for_flow_of_a2a_READER_B_for_B_dep1_atline_42_iffalse_fct(const __parsec_a2a_internal_taskpool_t *__parsec_tp, const __parsec_a2a_READER_B_parsec_assignment_t *locals)
+{
+  const int r = locals->r.value;
+  const int t = locals->t.value; (void)t;
+
+  (void)r;
+  (void)t;
+  (void)__parsec_tp; (void)locals;
+  return !((r) == (0));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_a2a_READER_B_for_B_dep1_atline_42_iffalse = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_a2a_READER_B_for_B_dep1_atline_42_iffalse_fct }
+                   }
+};
+static const parsec_dep_t flow_of_a2a_READER_B_for_B_dep1_atline_42_iffalse = {
+  .cond = &expr_of_cond_for_flow_of_a2a_READER_B_for_B_dep1_atline_42_iffalse,  /* !(r) == (0) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 0, /* a2a_READER_B */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_a2a_READER_B_for_B,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_a2a_READER_B_for_B,
+};
+static const parsec_dep_t flow_of_a2a_READER_B_for_B_dep2_atline_44 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 3, /* a2a_RECV */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_a2a_RECV_for_A,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_a2a_READER_B_for_B,
+};
+static const parsec_dep_t flow_of_a2a_READER_B_for_B_dep3_atline_46 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 4, /* a2a_FANIN */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_a2a_FANIN_for_A,
+  .dep_index = 1,
+  .dep_datatype_index = 1,
+  .belongs_to = &flow_of_a2a_READER_B_for_B,
+};
+static inline int expr_of_cond_for_flow_of_a2a_READER_B_for_B_dep4_atline_48_fct(const __parsec_a2a_internal_taskpool_t *__parsec_tp, const __parsec_a2a_READER_B_parsec_assignment_t *locals)
+{
+  const int r = locals->r.value; (void)r;
+  const int t = locals->t.value; (void)t;
+
+  (void)r;
+  (void)t;
+  (void)__parsec_tp; (void)locals;
+  return (r) != ((NR - 1));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_a2a_READER_B_for_B_dep4_atline_48 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_a2a_READER_B_for_B_dep4_atline_48_fct }
+                   }
+};
+static const parsec_dep_t flow_of_a2a_READER_B_for_B_dep4_atline_48 = {
+  .cond = &expr_of_cond_for_flow_of_a2a_READER_B_for_B_dep4_atline_48,  /* (r) != ((NR - 1)) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 0, /* a2a_READER_B */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_a2a_READER_B_for_B,
+  .dep_index = 2,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_a2a_READER_B_for_B,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+#if MAX_DEP_OUT_COUNT < 3  /* number of output dependencies */
+    #error Too many output dependencies (supports up to MAX_DEP_OUT_COUNT [=10] but found 3). Fix the code or recompile PaRSEC with a larger MAX_DEP_OUT_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_a2a_READER_B_for_B = {
+  .name               = "B",
+  .sym_type           = PARSEC_SYM_INOUT,
+  .flow_flags         = PARSEC_FLOW_ACCESS_READ|PARSEC_FLOW_HAS_IN_DEPS,
+  .flow_index         = 0,
+  .flow_datatype_mask = 0x3,
+  .dep_in     = { &flow_of_a2a_READER_B_for_B_dep1_atline_42_iftrue,
+ &flow_of_a2a_READER_B_for_B_dep1_atline_42_iffalse },
+  .dep_out    = { &flow_of_a2a_READER_B_for_B_dep2_atline_44,
+ &flow_of_a2a_READER_B_for_B_dep3_atline_46,
+ &flow_of_a2a_READER_B_for_B_dep4_atline_48 }
+};
+
+static void
+iterate_successors_of_a2a_READER_B(parsec_execution_stream_t *es, const __parsec_a2a_READER_B_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_a2a_internal_taskpool_t *__parsec_tp = (const __parsec_a2a_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_a2a_READER_B_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_a2a_READER_B_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int r = __jdf2c__tmp_locals.r.value; (void)r;
+  const int t = __jdf2c__tmp_locals.t.value; (void)t;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)r;  (void)t;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_descB(t, 0);
+#endif
+  if( action_mask & 0x7 ) {  /* Flow of data B [0] */
+    data.data   = this_task->data._f_B.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x1 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_a2a_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_a2a_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        __parsec_a2a_RECV_task_t* ncc = (__parsec_a2a_RECV_task_t*)&nc;
+    nc.task_class = __parsec_tp->super.super.task_classes_array[a2a_RECV.task_class_id];
+      const int RECV_r = r;
+      if( (RECV_r >= (0)) && (RECV_r <= ((NR - 1))) ) {
+        assert(&nc.locals[0].value == &ncc->locals.r.value);
+        ncc->locals.r.value = RECV_r;
+        const int RECV_t = t;
+        if( (RECV_t >= (0)) && (RECV_t <= ((NT - 1))) ) {
+          assert(&nc.locals[1].value == &ncc->locals.t.value);
+          ncc->locals.t.value = RECV_t;
+          int RECV_s;
+        for( RECV_s = 0;RECV_s <= (NT - 1); RECV_s+=1) {
+            if( (RECV_s >= (0)) && (RECV_s <= ((NT - 1))) ) {
+              assert(&nc.locals[2].value == &ncc->locals.s.value);
+              ncc->locals.s.value = RECV_s;
+#if defined(DISTRIBUTED)
+              rank_dst = rank_of_descB(ncc->locals.t.value, 0);
+              if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+                vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descB)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descB, ncc->locals.t.value, 0);
+              nc.priority = __parsec_tp->super.super.priority;
+              successor_repo = RECV_repo;
+              successor_repo_key = __jdf2c_make_key_RECV((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+            RELEASE_DEP_OUTPUT(es, "B", this_task, "A", &nc, rank_src, rank_dst, &data);
+            if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_a2a_READER_B_for_B_dep2_atline_44, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+              }
+            }
+          }
+        }
+  }
+  if( action_mask & 0x2 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_a2a_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_a2a_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = a2a_READER_B_inline_c_expr2_line_46(__parsec_tp, &__jdf2c__tmp_locals);
+    data.remote.dst_count  = a2a_READER_B_inline_c_expr2_line_46(__parsec_tp, &__jdf2c__tmp_locals);
+    data.remote.src_displ    = a2a_READER_B_inline_c_expr1_line_47(__parsec_tp, &__jdf2c__tmp_locals);
+    data.remote.dst_displ    = a2a_READER_B_inline_c_expr1_line_47(__parsec_tp, &__jdf2c__tmp_locals);
+  }
+        __parsec_a2a_FANIN_task_t* ncc = (__parsec_a2a_FANIN_task_t*)&nc;
+    nc.task_class = __parsec_tp->super.super.task_classes_array[a2a_FANIN.task_class_id];
+      const int FANIN_r = r;
+      if( (FANIN_r >= (0)) && (FANIN_r <= ((NR - 1))) ) {
+        assert(&nc.locals[0].value == &ncc->locals.r.value);
+        ncc->locals.r.value = FANIN_r;
+        const int FANIN_t = t;
+        if( (FANIN_t >= (0)) && (FANIN_t <= ((NT - 1))) ) {
+          assert(&nc.locals[1].value == &ncc->locals.t.value);
+          ncc->locals.t.value = FANIN_t;
+#if defined(DISTRIBUTED)
+          rank_dst = rank_of_descB(ncc->locals.t.value, 0);
+          if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+            vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descB)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descB, ncc->locals.t.value, 0);
+          nc.priority = __parsec_tp->super.super.priority;
+          successor_repo = FANIN_repo;
+          successor_repo_key = __jdf2c_make_key_FANIN((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+        RELEASE_DEP_OUTPUT(es, "B", this_task, "A", &nc, rank_src, rank_dst, &data);
+        if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_a2a_READER_B_for_B_dep3_atline_46, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+          }
+        }
+  }
+  if( action_mask & 0x4 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_a2a_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_a2a_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( (r) != ((NR - 1)) ) {
+      __parsec_a2a_READER_B_task_t* ncc = (__parsec_a2a_READER_B_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[a2a_READER_B.task_class_id];
+        const int READER_B_r = (r + 1);
+        if( (READER_B_r >= (0)) && (READER_B_r <= ((NR - 1))) ) {
+          assert(&nc.locals[0].value == &ncc->locals.r.value);
+          ncc->locals.r.value = READER_B_r;
+          const int READER_B_t = t;
+          if( (READER_B_t >= (0)) && (READER_B_t <= ((NT - 1))) ) {
+            assert(&nc.locals[1].value == &ncc->locals.t.value);
+            ncc->locals.t.value = READER_B_t;
+#if defined(DISTRIBUTED)
+            rank_dst = rank_of_descB(ncc->locals.t.value, 0);
+            if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+              vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descB)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descB, ncc->locals.t.value, 0);
+            nc.priority = __parsec_tp->super.super.priority;
+            successor_repo = READER_B_repo;
+            successor_repo_key = __jdf2c_make_key_READER_B((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+          RELEASE_DEP_OUTPUT(es, "B", this_task, "B", &nc, rank_src, rank_dst, &data);
+          if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_a2a_READER_B_for_B_dep4_atline_48, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+            }
+          }
+    }
+  }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static void
+iterate_predecessors_of_a2a_READER_B(parsec_execution_stream_t *es, const __parsec_a2a_READER_B_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_a2a_internal_taskpool_t *__parsec_tp = (const __parsec_a2a_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_a2a_READER_B_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_a2a_READER_B_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int r = __jdf2c__tmp_locals.r.value; (void)r;
+  const int t = __jdf2c__tmp_locals.t.value; (void)t;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)r;  (void)t;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_descB(t, 0);
+#endif
+  if( action_mask & 0x1 ) {  /* Flow of data B [0] */
+    data.data   = this_task->data._f_B.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x1 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_a2a_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_a2a_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = a2a_READER_B_inline_c_expr4_line_42(__parsec_tp, &__jdf2c__tmp_locals);
+    data.remote.dst_count  = a2a_READER_B_inline_c_expr4_line_42(__parsec_tp, &__jdf2c__tmp_locals);
+    data.remote.src_displ    = a2a_READER_B_inline_c_expr3_line_43(__parsec_tp, &__jdf2c__tmp_locals);
+    data.remote.dst_displ    = a2a_READER_B_inline_c_expr3_line_43(__parsec_tp, &__jdf2c__tmp_locals);
+  }
+        if( !((r) == (0)) ) {
+      __parsec_a2a_READER_B_task_t* ncc = (__parsec_a2a_READER_B_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[a2a_READER_B.task_class_id];
+        const int READER_B_r = (r - 1);
+        if( (READER_B_r >= (0)) && (READER_B_r <= ((NR - 1))) ) {
+          assert(&nc.locals[0].value == &ncc->locals.r.value);
+          ncc->locals.r.value = READER_B_r;
+          const int READER_B_t = t;
+          if( (READER_B_t >= (0)) && (READER_B_t <= ((NT - 1))) ) {
+            assert(&nc.locals[1].value == &ncc->locals.t.value);
+            ncc->locals.t.value = READER_B_t;
+#if defined(DISTRIBUTED)
+            rank_dst = rank_of_descB(ncc->locals.t.value, 0);
+            if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+              vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descB)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descB, ncc->locals.t.value, 0);
+            nc.priority = __parsec_tp->super.super.priority;
+            successor_repo = READER_B_repo;
+            successor_repo_key = __jdf2c_make_key_READER_B((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+          RELEASE_DEP_OUTPUT(es, "B", this_task, "B", &nc, rank_src, rank_dst, &data);
+          if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_a2a_READER_B_for_B_dep1_atline_42_iffalse, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+            }
+          }
+    }
+  }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static int release_deps_of_a2a_READER_B(parsec_execution_stream_t *es, __parsec_a2a_READER_B_task_t *this_task, uint32_t action_mask, parsec_remote_deps_t *deps)
+{
+  PARSEC_PINS(es, RELEASE_DEPS_BEGIN, (parsec_task_t *)this_task);  const __parsec_a2a_internal_taskpool_t *__parsec_tp = (const __parsec_a2a_internal_taskpool_t *)this_task->taskpool;
+  parsec_release_dep_fct_arg_t arg;
+  int __vp_id;
+  int consume_local_repo = 0;
+  arg.action_mask = action_mask;
+  arg.output_entry = NULL;
+  arg.output_repo = NULL;
+#if defined(DISTRIBUTED)
+  arg.remote_deps = deps;
+#endif  /* defined(DISTRIBUTED) */
+  assert(NULL != es);
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS )    arg.ready_lists = alloca(sizeof(parsec_task_t *) * es->virtual_process->parsec_context->nb_vp);
+  else
+    arg.ready_lists = NULL;
+  for( __vp_id = 0; __vp_id < es->virtual_process->parsec_context->nb_vp; arg.ready_lists[__vp_id++] = NULL );
+  (void)__parsec_tp; (void)deps;
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_B.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_B.source_repo, this_task->data._f_B.source_repo_entry->ht_item.key );
+    }
+  }
+  consume_local_repo = (this_task->repo_entry != NULL);
+  arg.output_repo = READER_B_repo;
+  arg.output_entry = this_task->repo_entry;
+  arg.output_usage = 0;
+  if( action_mask & (PARSEC_ACTION_RELEASE_LOCAL_DEPS | PARSEC_ACTION_GET_REPO_ENTRY) ) {
+    arg.output_entry = data_repo_lookup_entry_and_create( es, arg.output_repo, __jdf2c_make_key_READER_B((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    arg.output_entry->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(arg.output_entry->sim_exec_date == 0);
+    arg.output_entry->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  if(action_mask & ( PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE ) ){
+    /* Generate the reshape promise for the outputs that need it */
+    iterate_successors_of_a2a_READER_B(es, this_task, action_mask, parsec_set_up_reshape_promise, &arg);
+   }
+  iterate_successors_of_a2a_READER_B(es, this_task, action_mask, parsec_release_dep_fct, &arg);
+
+#if defined(DISTRIBUTED)
+  if( (action_mask & PARSEC_ACTION_SEND_REMOTE_DEPS) && (NULL != arg.remote_deps)) {
+    parsec_remote_dep_activate(es, (parsec_task_t *)this_task, arg.remote_deps, arg.remote_deps->outgoing_mask);
+  }
+#endif
+
+  if(action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS) {
+    data_repo_entry_addto_usage_limit(READER_B_repo, arg.output_entry->ht_item.key, arg.output_usage);
+    __parsec_schedule_vp(es, arg.ready_lists, 0);
+  }
+      if (consume_local_repo) {
+         data_repo_entry_used_once( READER_B_repo, this_task->repo_entry->ht_item.key );
+      }
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_B.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_B.data_in);
+    }
+  }
+  PARSEC_PINS(es, RELEASE_DEPS_END, (parsec_task_t *)this_task);  return 0;
+}
+
+static int data_lookup_of_a2a_READER_B(parsec_execution_stream_t *es, __parsec_a2a_READER_B_task_t *this_task)
+{
+  const __parsec_a2a_internal_taskpool_t *__parsec_tp = (__parsec_a2a_internal_taskpool_t *)this_task->taskpool;
+  parsec_assignment_t generic_locals[MAX_PARAM_COUNT];  /* generic task locals */
+  int target_device = 0; (void)target_device;
+  (void)__parsec_tp; (void)generic_locals; (void)es;
+  parsec_data_copy_t *chunk = NULL;
+  data_repo_t        *reshape_repo  = NULL, *consumed_repo  = NULL;
+  data_repo_entry_t  *reshape_entry = NULL, *consumed_entry = NULL;
+  parsec_key_t        reshape_entry_key = 0, consumed_entry_key = 0;
+  uint8_t             consumed_flow_index;
+  parsec_dep_data_description_t data;
+  int ret;
+  (void)reshape_repo; (void)reshape_entry; (void)reshape_entry_key;
+  (void)consumed_repo; (void)consumed_entry; (void)consumed_entry_key;
+  (void)consumed_flow_index;
+  (void)chunk; (void)data; (void)ret;
+  const int r = this_task->locals.r.value; (void)r;
+  const int t = this_task->locals.t.value; (void)t;
+  if( NULL == this_task->repo_entry ){
+    this_task->repo_entry = data_repo_lookup_entry_and_create(es, READER_B_repo,                                       __jdf2c_make_key_READER_B((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    data_repo_entry_addto_usage_limit(READER_B_repo, this_task->repo_entry->ht_item.key, 1);    this_task->repo_entry ->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(this_task->repo_entry ->sim_exec_date == 0);
+    this_task->repo_entry ->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  /* The reshape repo is the current task repo. */  reshape_repo = READER_B_repo;
+  reshape_entry_key = __jdf2c_make_key_READER_B((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals) ;
+  reshape_entry = this_task->repo_entry;
+  /* Lookup the input data, and store them in the context if any */
+
+if(! this_task->data._f_B.fulfill ){ /* Flow B */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_B.data_out = NULL;  /* By default, if nothing matches */
+    if( (r) == (0) ) {
+    /* Flow B [0] dependency [0] from memory descB */
+    if( NULL == (chunk = this_task->data._f_B.data_in) ) {
+    /* No data set up by predecessor on this task input flow */
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+    parsec_prof_grapher_data_input(data_of_descB(t, 0), (parsec_task_t*)this_task, &flow_of_a2a_READER_B_for_B, 1);
+#endif
+      chunk = parsec_data_get_copy(data_of_descB(t, 0), target_device);
+      data.data = chunk;
+      data.data_future  = NULL;
+          data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      data.data_future   = NULL;
+      if( (ret = parsec_get_copy_reshape_from_desc(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      this_task->data._f_B.data_out = chunk;
+      PARSEC_OBJ_RETAIN(chunk);
+    } 
+    } else {
+    /* Flow B [0] dependency [0] from predecessor READER_B */
+    if( NULL == (chunk = this_task->data._f_B.data_in) ) {
+    /* No data set up by predecessor on this task input flow */
+__parsec_a2a_READER_B_parsec_assignment_t *target_locals = (__parsec_a2a_READER_B_parsec_assignment_t*)&generic_locals;
+      const int READER_Br = target_locals->r.value = (r - 1); (void)READER_Br;
+      const int READER_Bt = target_locals->t.value = t; (void)READER_Bt;
+      if( (reshape_entry != NULL) && (reshape_entry->data[0] != NULL) ){
+          /* Reshape promise set up on this task repo by predecessor */
+          consumed_repo = reshape_repo;
+          consumed_entry = reshape_entry;
+          consumed_entry_key = reshape_entry_key;
+          consumed_flow_index = 0;
+      }else{
+          /* Consume from predecessor's repo */
+          consumed_repo = READER_B_repo;
+          consumed_entry_key = __jdf2c_make_key_READER_B((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)target_locals) ;
+          consumed_entry = data_repo_lookup_entry( consumed_repo, consumed_entry_key );
+          consumed_flow_index = 0;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      ACQUIRE_FLOW(this_task, "B", &a2a_READER_B, "B", target_locals, chunk);
+      this_task->data._f_B.data_out = chunk;
+    } 
+    else {
+      /* Data set up by predecessor on this task input flow */
+      consumed_repo = this_task->data._f_B.source_repo;
+      consumed_entry = this_task->data._f_B.source_repo_entry;
+      consumed_entry_key = this_task->data._f_B.source_repo_entry->ht_item.key;
+      if( (reshape_entry != NULL) && (reshape_entry->data[0] != NULL) ){
+          /* Reshape promise set up on input by predecessor is on this task repo */
+          consumed_flow_index = 0;
+          assert( (this_task->data._f_B.source_repo == reshape_repo)
+               && (this_task->data._f_B.source_repo_entry == reshape_entry));
+      }else{
+          /* Reshape promise set up on input by predecessor is the predecesssor task repo */
+          consumed_flow_index = 0;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      this_task->data._f_B.data_out = parsec_data_get_copy(chunk->original, target_device);
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+      parsec_prof_grapher_data_input(chunk->original, (parsec_task_t*)this_task, &flow_of_a2a_READER_B_for_B, 0);
+#endif
+    }
+    }
+    this_task->data._f_B.data_in     = chunk;
+    this_task->data._f_B.source_repo       = consumed_repo;
+    this_task->data._f_B.source_repo_entry = consumed_entry;
+    if( this_task->data._f_B.source_repo_entry == this_task->repo_entry ){
+      /* in case we have consume from this task repo entry for the flow,
+       * it is cleaned up, avoiding having old stuff during release_deps_of
+       */
+      this_task->repo_entry->data[0] = NULL;
+    }
+    this_task->data._f_B.fulfill = 1;
+}
+
+  /** Generate profiling information */
+#if defined(PARSEC_PROF_TRACE)
+  this_task->prof_info.desc = (parsec_data_collection_t*)__parsec_tp->super._g_descB;
+  this_task->prof_info.priority = this_task->priority;
+  this_task->prof_info.data_id   = ((parsec_data_collection_t*)__parsec_tp->super._g_descB)->data_key((parsec_data_collection_t*)__parsec_tp->super._g_descB, t, 0);
+  this_task->prof_info.task_class_id = this_task->task_class->task_class_id;
+  this_task->prof_info.task_return_code = -1;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int datatype_lookup_of_a2a_READER_B(parsec_execution_stream_t *es, const parsec_task_t *this_generic_task, const parsec_task_t *parent_task,
+              uint32_t* flow_mask, parsec_dep_data_description_t* data)
+{
+  const __parsec_a2a_READER_B_task_t *this_task = (__parsec_a2a_READER_B_task_t*)this_generic_task;
+  const __parsec_a2a_internal_taskpool_t *__parsec_tp = (__parsec_a2a_internal_taskpool_t *)this_task->taskpool;
+  (void)__parsec_tp; (void)es; (void)this_task; (void)data; (void)parent_task;
+  const int r = this_task->locals.r.value; (void)r;
+  const int t = this_task->locals.t.value; (void)t;
+  data->local.arena = data->remote.arena = NULL;
+  data->local.src_datatype  = data->local.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->local.src_count     = data->local.dst_count = 0;
+  data->local.src_displ     = data->local.dst_displ = 0;
+  data->data_future  = NULL;
+  if( (*flow_mask) & 0x80000000U ) { /* these are the input dependencies remote datatypes  */
+if( (*flow_mask) & 0x1U ) {  /* Flow B */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_a2a_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_a2a_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_a2a_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = a2a_READER_B_inline_c_expr4_line_42(__parsec_tp, &this_task->locals);
+    data->remote.dst_count  = a2a_READER_B_inline_c_expr4_line_42(__parsec_tp, &this_task->locals);
+    data->remote.src_displ    = a2a_READER_B_inline_c_expr3_line_43(__parsec_tp, &this_task->locals);
+    data->remote.dst_displ    = a2a_READER_B_inline_c_expr3_line_43(__parsec_tp, &this_task->locals);
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+    goto no_mask_match;
+  }
+
+  /* these are the output dependencies remote datatypes */
+if( (*flow_mask) & 0x7U ) {  /* Flow B */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_a2a_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_a2a_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_a2a_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+    if( ((*flow_mask) & 0x2U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_a2a_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_a2a_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_a2a_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = a2a_READER_B_inline_c_expr2_line_46(__parsec_tp, &this_task->locals);
+    data->remote.dst_count  = a2a_READER_B_inline_c_expr2_line_46(__parsec_tp, &this_task->locals);
+    data->remote.src_displ    = a2a_READER_B_inline_c_expr1_line_47(__parsec_tp, &this_task->locals);
+    data->remote.dst_displ    = a2a_READER_B_inline_c_expr1_line_47(__parsec_tp, &this_task->locals);
+      (*flow_mask) &= ~0x2U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+    if( ((*flow_mask) & 0x4U)
+ && ((r) != ((NR - 1))) ) {
+    data->remote.arena  =  PARSEC_a2a_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_a2a_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_a2a_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x4U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x7U) */
+ no_mask_match:
+  data->data                             = NULL;
+  data->remote.src_datatype = data->remote.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->remote.src_count    = data->remote.dst_count = 0;
+  data->remote.src_displ    = data->remote.dst_displ = 0;
+  data->data_future  = NULL;
+  (*flow_mask) = 0;  /* nothing left */
+  (void)r;  (void)t;
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+static int hook_of_a2a_READER_B(parsec_execution_stream_t *es, __parsec_a2a_READER_B_task_t *this_task)
+{
+  __parsec_a2a_internal_taskpool_t *__parsec_tp = (__parsec_a2a_internal_taskpool_t *)this_task->taskpool;
+  (void)es; (void)__parsec_tp;
+  const int r = this_task->locals.r.value; (void)r;
+  const int t = this_task->locals.t.value; (void)t;
+  (void)r;  (void)t;
+
+  /** Declare the variables that will hold the data, and all the accounting for each */
+  parsec_data_copy_t *_f_B = this_task->data._f_B.data_in;
+  void *B = PARSEC_DATA_COPY_GET_PTR(_f_B); (void)B;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    data_repo_entry_t *eB = this_task->data._f_B.source_repo_entry;
+    if( (NULL != eB) && (eB->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eB->sim_exec_date;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+  /** Cache Awareness Accounting */
+#if defined(PARSEC_CACHE_AWARENESS)
+  cache_buf_referenced(es->closest_cache, B);
+#endif /* PARSEC_CACHE_AWARENESS */
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                                READER_B BODY                                  -----*/
+
+
+/*-----                              END OF READER_B BODY                              -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#endif  /*  defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+static int complete_hook_of_a2a_READER_B(parsec_execution_stream_t *es, __parsec_a2a_READER_B_task_t *this_task)
+{
+  const __parsec_a2a_internal_taskpool_t *__parsec_tp = (__parsec_a2a_internal_taskpool_t *)this_task->taskpool;
+#if defined(DISTRIBUTED)
+    const int r = this_task->locals.r.value; (void)r;
+  const int t = this_task->locals.t.value; (void)t;
+#endif  /* defined(DISTRIBUTED) */
+  (void)es; (void)__parsec_tp;
+parsec_data_t* data_t_desc = NULL; (void)data_t_desc;
+#if defined(DISTRIBUTED)
+  /** If not working on distributed, there is no risk that data is not in place */
+  (void)r;  (void)t;
+
+#endif /* DISTRIBUTED */
+#if defined(PARSEC_PROF_GRAPHER)
+  parsec_prof_grapher_task((parsec_task_t*)this_task, es->th_id, es->virtual_process->vp_id,
+     __jdf2c_key_fns_READER_B.key_hash(this_task->task_class->make_key( (parsec_taskpool_t*)this_task->taskpool, ((parsec_task_t*)this_task)->locals), NULL));
+#endif  /* defined(PARSEC_PROF_GRAPHER) */
+  release_deps_of_a2a_READER_B(es, this_task,
+      PARSEC_ACTION_RELEASE_REMOTE_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_REFS |
+      PARSEC_ACTION_RESHAPE_ON_RELEASE |
+      0x7,  /* mask of all dep_index */ 
+      NULL);
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static parsec_hook_return_t release_task_of_a2a_READER_B(parsec_execution_stream_t *es, parsec_task_t *this_task)
+{
+    const __parsec_a2a_internal_taskpool_t *__parsec_tp =
+        (const __parsec_a2a_internal_taskpool_t *)this_task->taskpool;
+    parsec_hash_table_t *ht = (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[0];
+    parsec_key_t key = this_task->task_class->make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals);
+    parsec_hashable_dependency_t *hash_dep = (parsec_hashable_dependency_t *)parsec_hash_table_remove(ht, key);
+    parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);
+    return parsec_release_task_to_mempool_update_nbtasks(es, this_task);
+}
+
+static char *a2a_a2a_READER_B_internal_init_deps_key_functions_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_a2a_internal_taskpool_t *__parsec_tp = (__parsec_a2a_internal_taskpool_t *)user_data;
+  int r = (__parsec_key) % __parsec_tp->READER_B_r_range + __parsec_tp->READER_B_r_min;
+  __parsec_key = __parsec_key / __parsec_tp->READER_B_r_range;
+  int t = (__parsec_key) % __parsec_tp->READER_B_t_range + __parsec_tp->READER_B_t_min;
+  __parsec_key = __parsec_key / __parsec_tp->READER_B_t_range;
+  snprintf(buffer, buffer_size, "READER_B(%d, %d)", r, t);
+  return buffer;
+}
+
+static parsec_key_fn_t a2a_a2a_READER_B_internal_init_deps_key_functions = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = a2a_a2a_READER_B_internal_init_deps_key_functions_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/* Needs: min-max count-tasks iterate */
+static int a2a_READER_B_internal_init(parsec_execution_stream_t * es, __parsec_a2a_READER_B_task_t * this_task)
+{
+  __parsec_a2a_internal_taskpool_t *__parsec_tp = (__parsec_a2a_internal_taskpool_t*)this_task->taskpool;
+  int32_t nb_tasks = 0, saved_nb_tasks = 0;
+int32_t __r_min = 0x7fffffff, __r_max = 0;int32_t __jdf2c_r_min = 0x7fffffff, __jdf2c_r_max = 0;int32_t __t_min = 0x7fffffff, __t_max = 0;int32_t __jdf2c_t_min = 0x7fffffff, __jdf2c_t_max = 0;  __parsec_a2a_READER_B_parsec_assignment_t assignments = {  .r.value = 0, .t.value = 0 };
+  int32_t  r,  t;
+  int32_t __jdf2c_r_start, __jdf2c_r_end, __jdf2c_r_inc;
+  int32_t __jdf2c_t_start, __jdf2c_t_end, __jdf2c_t_inc;
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+  PARSEC_PROFILING_TRACE(es->es_profile,
+                         this_task->taskpool->profiling_array[START_KEY(this_task->task_class->task_class_id)],
+                         0,
+                         this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    __jdf2c_r_start = 0;
+    __jdf2c_r_end = (NR - 1);
+    __jdf2c_r_inc = 1;
+    __r_min = parsec_imin(__jdf2c_r_start, __jdf2c_r_end);
+    __r_max = parsec_imax(__jdf2c_r_start, __jdf2c_r_end);
+    __jdf2c_r_min = parsec_imin(__jdf2c_r_min, __r_min);
+    __jdf2c_r_max = parsec_imax(__jdf2c_r_max, __r_max);
+    for(r =  __jdf2c_r_start;
+        r <= __jdf2c_r_end;
+        r += __jdf2c_r_inc) {
+    assignments.r.value = r;
+      __jdf2c_t_start = 0;
+      __jdf2c_t_end = (NT - 1);
+      __jdf2c_t_inc = 1;
+      __t_min = parsec_imin(__jdf2c_t_start, __jdf2c_t_end);
+      __t_max = parsec_imax(__jdf2c_t_start, __jdf2c_t_end);
+      __jdf2c_t_min = parsec_imin(__jdf2c_t_min, __t_min);
+      __jdf2c_t_max = parsec_imax(__jdf2c_t_max, __t_max);
+      for(t =  __jdf2c_t_start;
+          t <= __jdf2c_t_end;
+          t += __jdf2c_t_inc) {
+      assignments.t.value = t;
+      if( !READER_B_pred(r, t) ) continue;
+      nb_tasks++;
+    } /* Loop on normal range t */
+  } /* For loop of r */ 
+   if( 0 != nb_tasks ) {
+     (void)parsec_atomic_fetch_add_int32(&__parsec_tp->initial_number_tasks, nb_tasks);
+   }
+  /* Set the range variables for the collision-free hash-computation */
+  __parsec_tp->READER_B_r_min   = __jdf2c_r_min;
+  __parsec_tp->READER_B_r_range = (__jdf2c_r_max - __jdf2c_r_min) + 1;
+  __parsec_tp->READER_B_t_min   = __jdf2c_t_min;
+  __parsec_tp->READER_B_t_range = (__jdf2c_t_max - __jdf2c_t_min) + 1;
+    do {
+      this_task->super.list_next = (parsec_list_item_t*)__parsec_tp->startup_queue;
+    } while(!parsec_atomic_cas_ptr(&__parsec_tp->startup_queue, (parsec_list_item_t*)this_task->super.list_next, this_task));
+    this_task->status = PARSEC_TASK_STATUS_HOOK;
+
+  PARSEC_AYU_REGISTER_TASK(&a2a_READER_B);
+  __parsec_tp->super.super.dependencies_array[0] = PARSEC_OBJ_NEW(parsec_hash_table_t);
+  parsec_hash_table_init(__parsec_tp->super.super.dependencies_array[0], offsetof(parsec_hashable_dependency_t, ht_item), 10, a2a_a2a_READER_B_internal_init_deps_key_functions, this_task->taskpool);
+  __parsec_tp->repositories[0] = data_repo_create_nothreadsafe(nb_tasks, __jdf2c_key_fns_READER_B, (parsec_taskpool_t*)__parsec_tp, 1);
+(void)saved_nb_tasks;
+(void)__r_min; (void)__r_max;(void)__t_min; (void)__t_max;  (void)__jdf2c_r_start; (void)__jdf2c_r_end; (void)__jdf2c_r_inc;  (void)__jdf2c_t_start; (void)__jdf2c_t_end; (void)__jdf2c_t_inc;  (void)assignments; (void)__parsec_tp; (void)es;
+  if(1 == parsec_atomic_fetch_dec_int32(&__parsec_tp->sync_point)) {
+    /* Last initialization task complete. Update the number of tasks. */
+    __parsec_tp->super.super.tdm.module->taskpool_addto_nb_tasks(&__parsec_tp->super.super, __parsec_tp->initial_number_tasks);
+    parsec_mfence();  /* write memory barrier to guarantee that the scheduler gets the correct number of tasks */
+    parsec_taskpool_enable((parsec_taskpool_t*)__parsec_tp, &__parsec_tp->startup_queue,
+                           (parsec_task_t*)this_task, es, __parsec_tp->super.super.nb_pending_actions);
+    __parsec_tp->super.super.tdm.module->taskpool_ready(&__parsec_tp->super.super);
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+    PARSEC_PROFILING_TRACE(es->es_profile,
+                           this_task->taskpool->profiling_array[2 * this_task->task_class->task_class_id + 1],
+                           0,
+                           this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    if( 1 >= __parsec_tp->super.super.nb_pending_actions ) {
+        /* if no tasks will be generated let's prevent the runtime from calling the hook and instead go directly to complete the task */
+        this_task->status = PARSEC_TASK_STATUS_COMPLETE;
+    }
+    return PARSEC_HOOK_RETURN_DONE;
+  }
+  return PARSEC_HOOK_RETURN_ASYNC;
+}
+
+static int __jdf2c_startup_READER_B(parsec_execution_stream_t * es, __parsec_a2a_READER_B_task_t *this_task)
+{
+  __parsec_a2a_READER_B_task_t* new_task;
+  __parsec_a2a_internal_taskpool_t* __parsec_tp = (__parsec_a2a_internal_taskpool_t*)this_task->taskpool;
+  parsec_context_t *context = __parsec_tp->super.super.context;
+  int vpid = 0, nb_tasks = 0;
+  size_t total_nb_tasks = 0;
+  parsec_list_item_t* pready_ring[context->nb_vp];
+  int restore_context = 0;
+  int r = this_task->locals.r.value;  /* retrieve value saved during the last iteration */
+  int t = this_task->locals.t.value;  /* retrieve value saved during the last iteration */
+  for(int _i = 0; _i < context->nb_vp; pready_ring[_i++] = NULL );
+  if( 0 != this_task->locals.reserved[0].value ) {
+    this_task->locals.reserved[0].value = 1; /* reset the submission process */
+    restore_context = 1;
+    goto restore_context_0;
+  }
+  this_task->locals.reserved[0].value = 1; /* a sane default value */
+  for(this_task->locals.r.value = r = 0;
+      this_task->locals.r.value <= (NR - 1);
+      this_task->locals.r.value += 1, r = this_task->locals.r.value) {
+    for(this_task->locals.t.value = t = 0;
+        this_task->locals.t.value <= (NT - 1);
+        this_task->locals.t.value += 1, t = this_task->locals.t.value) {
+      if( !READER_B_pred(r, t) ) continue;
+  __parsec_a2a_READER_B_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_a2a_READER_B_parsec_assignment_t*)&this_task->locals;
+  (void)__jdf2c__tmp_locals;
+  if( (r) == (0) ) goto __jdf2c_done_check_flow;
+  continue; /* All other cases are not startup tasks */
+ __jdf2c_done_check_flow:
+      if( NULL != ((parsec_data_collection_t*)__parsec_tp->super._g_descB)->vpid_of ) {
+        vpid = ((parsec_data_collection_t*)__parsec_tp->super._g_descB)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descB, t, 0);
+        assert(context->nb_vp >= vpid);
+      } else {
+        vpid = (vpid + 1) % context->nb_vp;  /* spread the initial joy */
+      }
+      new_task = (__parsec_a2a_READER_B_task_t*)parsec_thread_mempool_allocate( context->virtual_processes[vpid]->execution_streams[0]->context_mempool );
+      PARSEC_OBJ_CONSTRUCT(new_task, parsec_task_t); /* construct called only when new, force-construct it again */
+      /* Copy only the valid elements from this_task to new_task one */
+      new_task->taskpool   = this_task->taskpool;
+      new_task->task_class = __parsec_tp->super.super.task_classes_array[a2a_READER_B.task_class_id];
+      new_task->chore_mask   = PARSEC_DEV_ALL;
+      new_task->locals.r.value = this_task->locals.r.value;
+      new_task->locals.t.value = this_task->locals.t.value;
+      PARSEC_LIST_ITEM_SINGLETON(new_task);
+      new_task->priority = __parsec_tp->super.super.priority;
+      new_task->repo_entry = NULL;
+      new_task->data._f_B.source_repo_entry = NULL;
+      new_task->data._f_B.source_repo       = NULL;
+      new_task->data._f_B.data_in         = NULL;
+      new_task->data._f_B.data_out        = NULL;
+      new_task->data._f_B.fulfill         = 0;
+#if defined(PARSEC_DEBUG_NOISIER)
+      {
+        char tmp[128];
+        PARSEC_DEBUG_VERBOSE(10, parsec_debug_output, "Add startup task %s to vpid %d",
+               parsec_task_snprintf(tmp, 128, (parsec_task_t*)new_task), vpid);
+      }
+#endif
+      parsec_dependencies_mark_task_as_startup((parsec_task_t*)new_task, es);
+      pready_ring[vpid] = parsec_list_item_ring_push_sorted(pready_ring[vpid],
+                                                            (parsec_list_item_t*)new_task,
+                                                            parsec_execution_context_priority_comparator);
+      nb_tasks++;
+     restore_context_0:  /* we jump here just so that we have code after the label */
+      restore_context = 0;
+      (void)restore_context;
+      if( nb_tasks > this_task->locals.reserved[0].value ) {
+        if( (size_t)this_task->locals.reserved[0].value < parsec_task_startup_iter ) this_task->locals.reserved[0].value <<= 1;
+        __parsec_schedule_vp(es, (parsec_task_t**)pready_ring, 0);
+        total_nb_tasks += nb_tasks;
+        nb_tasks = 0;
+        if( total_nb_tasks > parsec_task_startup_chunk ) {  /* stop here and request to be rescheduled */
+          return PARSEC_HOOK_RETURN_AGAIN;
+        }
+      }
+    } /* Loop on normal range t */
+  } /* Loop on normal range r */
+  (void)vpid;
+  if( 0 != nb_tasks ) {
+    __parsec_schedule_vp(es, (parsec_task_t**)pready_ring, 0);
+    nb_tasks = 0;
+  }
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static const __parsec_chore_t __a2a_READER_B_chores[] ={
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+    { .type     = PARSEC_DEV_CPU,
+      .evaluate = (parsec_evaluate_function_t*)NULL,
+      .hook     = (parsec_hook_t*)hook_of_a2a_READER_B },
+#endif  /* defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+    { .type     = PARSEC_DEV_NONE,
+      .evaluate = NULL,
+      .hook     = (parsec_hook_t*)NULL },  /* End marker */
+};
+
+static const parsec_task_class_t a2a_READER_B = {
+  .name = "READER_B",
+  .task_class_id = 0,
+  .nb_flows = 1,
+  .nb_parameters = 2,
+  .nb_locals = 2,
+  .task_class_type = PARSEC_TASK_CLASS_TYPE_PTG,
+  .params = { &symb_a2a_READER_B_r, &symb_a2a_READER_B_t, NULL },
+  .locals = { &symb_a2a_READER_B_r, &symb_a2a_READER_B_t, NULL },
+  .data_affinity = (parsec_data_ref_fn_t*)affinity_of_a2a_READER_B,
+  .initial_data = (parsec_data_ref_fn_t*)affinity_of_a2a_READER_B,
+  .final_data = (parsec_data_ref_fn_t*)affinity_of_a2a_READER_B,
+  .priority = NULL,
+  .properties = properties_of_a2a_READER_B,
+#if MAX_PARAM_COUNT < 1  /* number of read flows of READER_B */
+  #error Too many read flows for task READER_B
+#endif  /* MAX_PARAM_COUNT */
+#if MAX_PARAM_COUNT < 0  /* number of write flows of READER_B */
+  #error Too many write flows for task READER_B
+#endif  /* MAX_PARAM_COUNT */
+  .in = { &flow_of_a2a_READER_B_for_B, NULL },
+  .out = { &flow_of_a2a_READER_B_for_B, NULL },
+  .flags = 0x0 | PARSEC_HAS_IN_IN_DEPENDENCIES | PARSEC_USE_DEPS_MASK,
+  .dependencies_goal = 0x1,
+  .make_key = __jdf2c_make_key_READER_B,
+  .task_snprintf = parsec_task_snprintf,
+#if defined(PARSEC_PROF_TRACE)
+  .profile_info = &parsec_task_profile_info,
+#endif
+  .key_functions = &__jdf2c_key_fns_READER_B,
+  .fini = (parsec_hook_t*)NULL,
+  .incarnations = __a2a_READER_B_chores,
+  .find_deps = parsec_hash_find_deps,
+  .update_deps = parsec_update_deps_with_mask,
+  .iterate_successors = (parsec_traverse_function_t*)iterate_successors_of_a2a_READER_B,
+  .iterate_predecessors = (parsec_traverse_function_t*)iterate_predecessors_of_a2a_READER_B,
+  .release_deps = (parsec_release_deps_t*)release_deps_of_a2a_READER_B,
+  .prepare_output = (parsec_hook_t*)NULL,
+  .prepare_input = (parsec_hook_t*)data_lookup_of_a2a_READER_B,
+  .time_estimate = NULL,
+  .get_datatype = datatype_lookup_of_a2a_READER_B,
+  .complete_execution = (parsec_hook_t*)complete_hook_of_a2a_READER_B,
+  .release_task = &release_task_of_a2a_READER_B,
+#if defined(PARSEC_SIM)
+  .sim_cost_fct = (parsec_sim_cost_fct_t*)NULL,
+#endif
+};
+
+
+static const parsec_task_class_t *a2a_task_classes[] = {
+  &a2a_READER_B,
+  &a2a_FANOUT,
+  &a2a_SEND,
+  &a2a_RECV,
+  &a2a_FANIN
+};
+
+static void a2a_startup(parsec_context_t *context, __parsec_a2a_internal_taskpool_t *__parsec_tp, parsec_list_item_t ** ready_tasks)
+{
+  uint32_t i, supported_dev = 0;
+ 
+  for( i = 0; i < parsec_nb_devices; i++ ) {
+    if( !(__parsec_tp->super.super.devices_index_mask & (1<<i)) ) continue;
+    parsec_device_module_t* device = parsec_mca_device_get(i);
+    parsec_data_collection_t* parsec_dc;
+ 
+    if(NULL == device) continue;
+    if(NULL != device->taskpool_register)
+      if( PARSEC_SUCCESS != device->taskpool_register(device, (parsec_taskpool_t*)__parsec_tp) ) {
+        parsec_debug_verbose(5, parsec_debug_output, "Device %s refused to register taskpool %p", device->name, __parsec_tp);
+        __parsec_tp->super.super.devices_index_mask &= ~(1 << device->device_index);
+        continue;
+      }
+    if(NULL != device->memory_register) {  /* Register all the data */
+      parsec_dc = (parsec_data_collection_t*)__parsec_tp->super._g_descA;
+      if( (NULL != parsec_dc->register_memory) &&
+          (PARSEC_SUCCESS != parsec_dc->register_memory(parsec_dc, device)) ) {
+        parsec_debug_verbose(3, parsec_debug_output, "Device %s refused to register memory for data %s (%p) from taskpool %p",
+                     device->name, parsec_dc->key_base, parsec_dc, __parsec_tp);
+        __parsec_tp->super.super.devices_index_mask &= ~(1 << device->device_index);
+      }
+      parsec_dc = (parsec_data_collection_t*)__parsec_tp->super._g_descB;
+      if( (NULL != parsec_dc->register_memory) &&
+          (PARSEC_SUCCESS != parsec_dc->register_memory(parsec_dc, device)) ) {
+        parsec_debug_verbose(3, parsec_debug_output, "Device %s refused to register memory for data %s (%p) from taskpool %p",
+                     device->name, parsec_dc->key_base, parsec_dc, __parsec_tp);
+        __parsec_tp->super.super.devices_index_mask &= ~(1 << device->device_index);
+      }
+    }
+    supported_dev |= device->type;
+  }
+  /* Remove all the chores without a backend device */
+  for( i = 0; i < PARSEC_a2a_NB_TASK_CLASSES; i++ ) {
+    parsec_task_class_t* tc = (parsec_task_class_t*)__parsec_tp->super.super.task_classes_array[i];
+    __parsec_chore_t* chores = (__parsec_chore_t*)tc->incarnations;
+    uint32_t idx = 0, j;
+    for( j = 0; PARSEC_DEV_NONE != chores[j].type; j++ ) {
+      if( !(supported_dev & chores[j].type) ) continue;
+      if( j != idx ) {
+        chores[idx] = chores[j];
+        parsec_debug_verbose(20, parsec_debug_output, "Device type %i disabled for function %s"
+, chores[j].type, tc->name);
+      }
+      idx++;
+    }
+    chores[idx].type     = PARSEC_DEV_NONE;
+    chores[idx].evaluate = NULL;
+    chores[idx].hook     = NULL;
+    /* Create the initialization tasks for each taskclass */
+    parsec_task_t* task = (parsec_task_t*)parsec_thread_mempool_allocate(context->virtual_processes[0]->execution_streams[0]->context_mempool);
+    PARSEC_OBJ_CONSTRUCT(task, parsec_task_t); /* construct called only when new, force-construct it again */
+    task->taskpool = (parsec_taskpool_t *)__parsec_tp;
+    task->chore_mask = PARSEC_DEV_CPU;
+    memset(&task->locals, 0, sizeof(parsec_assignment_t) * MAX_LOCAL_COUNT);
+    PARSEC_LIST_ITEM_SINGLETON(task);
+    task->priority = -1;
+    task->task_class = task->taskpool->task_classes_array[PARSEC_a2a_NB_TASK_CLASSES + i];
+    int where = i % context->nb_vp;
+    if( NULL == ready_tasks[where] ) ready_tasks[where] = &task->super;
+    else ready_tasks[where] = parsec_list_item_ring_push(ready_tasks[where], &task->super);
+  }
+}
+static void __parsec_a2a_internal_destructor( __parsec_a2a_internal_taskpool_t *__parsec_tp )
+{
+  uint32_t i;
+  parsec_taskpool_unregister( &__parsec_tp->super.super );
+  if(NULL != __parsec_tp->super.super.tdm.module) __parsec_tp->super.super.tdm.module->unmonitor_taskpool(&__parsec_tp->super.super);
+  for( i = 0; i < (uint32_t)(2 * __parsec_tp->super.super.nb_task_classes); i++ ) {  /* Extra startup function added at the end */
+    parsec_task_class_t* tc = (parsec_task_class_t*)__parsec_tp->super.super.task_classes_array[i];
+    free((void*)tc->incarnations);
+    free(tc);
+  }
+  free(__parsec_tp->super.super.task_classes_array); __parsec_tp->super.super.task_classes_array = NULL;
+  __parsec_tp->super.super.nb_task_classes = 0;
+
+  for(i = 0; i < (uint32_t)__parsec_tp->super.arenas_datatypes_size; i++) {
+    if( NULL != __parsec_tp->super.arenas_datatypes[i].arena ) {
+      PARSEC_OBJ_RELEASE(__parsec_tp->super.arenas_datatypes[i].arena);
+    }
+  }
+  /* Destroy the data repositories for this object */
+   data_repo_destroy_nothreadsafe(__parsec_tp->repositories[4]);  /* FANIN */
+   data_repo_destroy_nothreadsafe(__parsec_tp->repositories[3]);  /* RECV */
+   data_repo_destroy_nothreadsafe(__parsec_tp->repositories[2]);  /* SEND */
+   data_repo_destroy_nothreadsafe(__parsec_tp->repositories[1]);  /* FANOUT */
+   data_repo_destroy_nothreadsafe(__parsec_tp->repositories[0]);  /* READER_B */
+  /* Release the dependencies arrays for this object */
+  parsec_hash_table_fini( (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[4] );
+  PARSEC_OBJ_RELEASE(__parsec_tp->super.super.dependencies_array[4]);
+  __parsec_tp->super.super.dependencies_array[4] = NULL;
+  parsec_hash_table_fini( (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[3] );
+  PARSEC_OBJ_RELEASE(__parsec_tp->super.super.dependencies_array[3]);
+  __parsec_tp->super.super.dependencies_array[3] = NULL;
+  parsec_hash_table_fini( (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[2] );
+  PARSEC_OBJ_RELEASE(__parsec_tp->super.super.dependencies_array[2]);
+  __parsec_tp->super.super.dependencies_array[2] = NULL;
+  parsec_hash_table_fini( (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[1] );
+  PARSEC_OBJ_RELEASE(__parsec_tp->super.super.dependencies_array[1]);
+  __parsec_tp->super.super.dependencies_array[1] = NULL;
+  parsec_hash_table_fini( (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[0] );
+  PARSEC_OBJ_RELEASE(__parsec_tp->super.super.dependencies_array[0]);
+  __parsec_tp->super.super.dependencies_array[0] = NULL;
+  free( __parsec_tp->super.super.dependencies_array );
+  __parsec_tp->super.super.dependencies_array = NULL;
+  /* Unregister all the data */
+  uint32_t _i;
+  for( _i = 0; _i < parsec_nb_devices; _i++ ) {
+    parsec_device_module_t* device;
+    parsec_data_collection_t* parsec_dc;
+    if(!(__parsec_tp->super.super.devices_index_mask & (1 << _i))) continue;
+    if((NULL == (device = parsec_mca_device_get(_i))) || (NULL == device->memory_unregister)) continue;
+    parsec_dc = (parsec_data_collection_t*)__parsec_tp->super._g_descA;
+  if( NULL != parsec_dc->unregister_memory ) { (void)parsec_dc->unregister_memory(parsec_dc, device); };
+  parsec_dc = (parsec_data_collection_t*)__parsec_tp->super._g_descB;
+  if( NULL != parsec_dc->unregister_memory ) { (void)parsec_dc->unregister_memory(parsec_dc, device); };
+}
+  /* Unregister the taskpool from the devices */
+  for( i = 0; i < parsec_nb_devices; i++ ) {
+    if(!(__parsec_tp->super.super.devices_index_mask & (1 << i))) continue;
+    __parsec_tp->super.super.devices_index_mask ^= (1 << i);
+    parsec_device_module_t* device = parsec_mca_device_get(i);
+    if((NULL == device) || (NULL == device->taskpool_unregister)) continue;
+    if( PARSEC_SUCCESS != device->taskpool_unregister(device, &__parsec_tp->super.super) ) continue;
+  }
+  free(__parsec_tp->super.super.taskpool_name); __parsec_tp->super.super.taskpool_name = NULL;
+}
+
+void __parsec_a2a_internal_constructor(__parsec_a2a_internal_taskpool_t* __parsec_tp)
+{
+  parsec_task_class_t* tc;
+  uint32_t i, j;
+
+  __parsec_tp->super.super.nb_task_classes = PARSEC_a2a_NB_TASK_CLASSES;
+  __parsec_tp->super.super.devices_index_mask = PARSEC_DEVICES_ALL;
+  __parsec_tp->super.super.taskpool_name = strdup("a2a");
+  parsec_termdet_open_module(&__parsec_tp->super.super, "local");
+  __parsec_tp->super.super.tdm.module->monitor_taskpool(&__parsec_tp->super.super,
+                                                        parsec_taskpool_termination_detected);
+  __parsec_tp->super.super.update_nb_runtime_task = parsec_add_fetch_runtime_task;
+  __parsec_tp->super.super.dependencies_array = (void **)
+              calloc(__parsec_tp->super.super.nb_task_classes, sizeof(void*));
+  /* Twice the size to hold the startup tasks function_t */
+  __parsec_tp->super.super.task_classes_array = (const parsec_task_class_t**)
+              calloc((2 * PARSEC_a2a_NB_TASK_CLASSES + 1), sizeof(parsec_task_class_t*));
+  __parsec_tp->super.super.tdm.module->taskpool_addto_runtime_actions(&__parsec_tp->super.super, PARSEC_a2a_NB_TASK_CLASSES);  /* for the startup tasks */
+  __parsec_tp->super.super.taskpool_type = PARSEC_TASKPOOL_TYPE_PTG;
+  __parsec_tp->sync_point = __parsec_tp->super.super.nb_task_classes;
+  __parsec_tp->initial_number_tasks = 0;
+  __parsec_tp->startup_queue = NULL;
+  for( i = 0; i < __parsec_tp->super.super.nb_task_classes; i++ ) {
+    __parsec_tp->super.super.task_classes_array[i] = tc = malloc(sizeof(parsec_task_class_t));
+    memcpy(tc, a2a_task_classes[i], sizeof(parsec_task_class_t));
+    for( j = 0; PARSEC_DEV_NONE != tc->incarnations[j].type; j++);  /* compute the number of incarnations */
+    tc->incarnations = (__parsec_chore_t*)malloc((j+1) * sizeof(__parsec_chore_t));
+        memcpy((__parsec_chore_t*)tc->incarnations, a2a_task_classes[i]->incarnations, (j+1) * sizeof(__parsec_chore_t));
+
+    /* Add a placeholder for initialization and startup task */
+    __parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+i] = tc = (parsec_task_class_t*)malloc(sizeof(parsec_task_class_t));
+    memcpy(tc, (void*)&__parsec_generic_startup, sizeof(parsec_task_class_t));
+    tc->task_class_id = __parsec_tp->super.super.nb_task_classes + i;
+    tc->incarnations = (__parsec_chore_t*)malloc(2 * sizeof(__parsec_chore_t));
+    memcpy((__parsec_chore_t*)tc->incarnations, (void*)__parsec_generic_startup.incarnations, 2 * sizeof(__parsec_chore_t));
+    tc->release_task = parsec_release_task_to_mempool_and_count_as_runtime_tasks;
+  }
+  /* Startup task for FANIN */
+  tc = (parsec_task_class_t *)__parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+0];
+  tc->name = "Startup for FANIN";
+  tc->prepare_input = (parsec_hook_t*)a2a_FANIN_internal_init;
+  /* Startup task for RECV */
+  tc = (parsec_task_class_t *)__parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+1];
+  tc->name = "Startup for RECV";
+  tc->prepare_input = (parsec_hook_t*)a2a_RECV_internal_init;
+  /* Startup task for SEND */
+  tc = (parsec_task_class_t *)__parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+2];
+  tc->name = "Startup for SEND";
+  tc->prepare_input = (parsec_hook_t*)a2a_SEND_internal_init;
+  /* Startup task for FANOUT */
+  tc = (parsec_task_class_t *)__parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+3];
+  tc->name = "Startup for FANOUT";
+  tc->prepare_input = (parsec_hook_t*)a2a_FANOUT_internal_init;
+  ((__parsec_chore_t*)&tc->incarnations[0])->hook = (parsec_hook_t *)__jdf2c_startup_FANOUT;
+  /* Startup task for READER_B */
+  tc = (parsec_task_class_t *)__parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+4];
+  tc->name = "Startup for READER_B";
+  tc->prepare_input = (parsec_hook_t*)a2a_READER_B_internal_init;
+  ((__parsec_chore_t*)&tc->incarnations[0])->hook = (parsec_hook_t *)__jdf2c_startup_READER_B;
+  /* Compute the number of arenas_datatypes: */
+  /*   PARSEC_a2a_DEFAULT_ARENA  ->  0 */
+  __parsec_tp->super.arenas_datatypes_size = 1;
+  memset(&__parsec_tp->super.arenas_datatypes[0], 0, __parsec_tp->super.arenas_datatypes_size*sizeof(parsec_arena_datatype_t));
+  /* If profiling is enabled, the keys for profiling */
+#  if defined(PARSEC_PROF_TRACE)
+  __parsec_tp->super.super.profiling_array = a2a_profiling_array;
+  if( -2 == a2a_profiling_array[0] ) {
+    #if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+parsec_profiling_add_dictionary_keyword("a2a::FANIN::internal init", "fill:34D8D8",
+                                       0,
+                                       NULL,
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(a2a_FANIN.task_class_id  + PARSEC_a2a_NB_TASK_CLASSES)/* FANIN (internal init) start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(a2a_FANIN.task_class_id  + PARSEC_a2a_NB_TASK_CLASSES)/* FANIN (internal init) end key */]);
+#endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+parsec_profiling_add_dictionary_keyword("a2a::FANIN", "fill:CC2828",
+                                       sizeof(parsec_task_prof_info_t)+2*sizeof(parsec_assignment_t),
+                                       "dc_key{uint64_t};priority{int32_t};dc_dataid{uint32_t};tcid{uint32_t};trc{int32_t};r{int32_t};t{int32_t}",
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(a2a_FANIN.task_class_id) /* FANIN start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(a2a_FANIN.task_class_id) /* FANIN end key */]);
+
+    #if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+parsec_profiling_add_dictionary_keyword("a2a::RECV::internal init", "fill:5534D8",
+                                       0,
+                                       NULL,
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(a2a_RECV.task_class_id  + PARSEC_a2a_NB_TASK_CLASSES)/* RECV (internal init) start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(a2a_RECV.task_class_id  + PARSEC_a2a_NB_TASK_CLASSES)/* RECV (internal init) end key */]);
+#endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+parsec_profiling_add_dictionary_keyword("a2a::RECV", "fill:ABCC28",
+                                       sizeof(parsec_task_prof_info_t)+3*sizeof(parsec_assignment_t),
+                                       "dc_key{uint64_t};priority{int32_t};dc_dataid{uint32_t};tcid{uint32_t};trc{int32_t};r{int32_t};t{int32_t};s{int32_t}",
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(a2a_RECV.task_class_id) /* RECV start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(a2a_RECV.task_class_id) /* RECV end key */]);
+
+    #if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+parsec_profiling_add_dictionary_keyword("a2a::SEND::internal init", "fill:D83496",
+                                       0,
+                                       NULL,
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(a2a_SEND.task_class_id  + PARSEC_a2a_NB_TASK_CLASSES)/* SEND (internal init) start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(a2a_SEND.task_class_id  + PARSEC_a2a_NB_TASK_CLASSES)/* SEND (internal init) end key */]);
+#endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+parsec_profiling_add_dictionary_keyword("a2a::SEND", "fill:28CC6A",
+                                       sizeof(parsec_task_prof_info_t)+3*sizeof(parsec_assignment_t),
+                                       "dc_key{uint64_t};priority{int32_t};dc_dataid{uint32_t};tcid{uint32_t};trc{int32_t};r{int32_t};t{int32_t};s{int32_t}",
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(a2a_SEND.task_class_id) /* SEND start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(a2a_SEND.task_class_id) /* SEND end key */]);
+
+    #if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+parsec_profiling_add_dictionary_keyword("a2a::FANOUT::internal init", "fill:D89634",
+                                       0,
+                                       NULL,
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(a2a_FANOUT.task_class_id  + PARSEC_a2a_NB_TASK_CLASSES)/* FANOUT (internal init) start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(a2a_FANOUT.task_class_id  + PARSEC_a2a_NB_TASK_CLASSES)/* FANOUT (internal init) end key */]);
+#endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+parsec_profiling_add_dictionary_keyword("a2a::FANOUT", "fill:286ACC",
+                                       sizeof(parsec_task_prof_info_t)+2*sizeof(parsec_assignment_t),
+                                       "dc_key{uint64_t};priority{int32_t};dc_dataid{uint32_t};tcid{uint32_t};trc{int32_t};r{int32_t};t{int32_t}",
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(a2a_FANOUT.task_class_id) /* FANOUT start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(a2a_FANOUT.task_class_id) /* FANOUT end key */]);
+
+    #if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+parsec_profiling_add_dictionary_keyword("a2a::READER_B::internal init", "fill:55D834",
+                                       0,
+                                       NULL,
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(a2a_READER_B.task_class_id  + PARSEC_a2a_NB_TASK_CLASSES)/* READER_B (internal init) start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(a2a_READER_B.task_class_id  + PARSEC_a2a_NB_TASK_CLASSES)/* READER_B (internal init) end key */]);
+#endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+parsec_profiling_add_dictionary_keyword("a2a::READER_B", "fill:AB28CC",
+                                       sizeof(parsec_task_prof_info_t)+2*sizeof(parsec_assignment_t),
+                                       "dc_key{uint64_t};priority{int32_t};dc_dataid{uint32_t};tcid{uint32_t};trc{int32_t};r{int32_t};t{int32_t}",
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(a2a_READER_B.task_class_id) /* READER_B start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(a2a_READER_B.task_class_id) /* READER_B end key */]);
+
+  }
+#  endif /* defined(PARSEC_PROF_TRACE) */
+  __parsec_tp->super.super.repo_array = __parsec_tp->repositories;
+  __parsec_tp->super.super.startup_hook = (parsec_startup_fn_t)a2a_startup;
+  (void)parsec_taskpool_reserve_id((parsec_taskpool_t*)__parsec_tp);
+}
+
+  /** Generate class declaration and instance using the above constructor and destructor */
+  PARSEC_OBJ_CLASS_DECLARATION(__parsec_a2a_internal_taskpool_t);
+  PARSEC_OBJ_CLASS_INSTANCE(__parsec_a2a_internal_taskpool_t, parsec_a2a_taskpool_t,
+                            __parsec_a2a_internal_constructor, __parsec_a2a_internal_destructor);
+
+#undef descA
+#undef descB
+#undef NR
+#undef NT
+
+parsec_a2a_taskpool_t *parsec_a2a_new(parsec_tiled_matrix_t* descA /* data descA */, parsec_tiled_matrix_t* descB /* data descB */, int NR, int NT)
+{
+  __parsec_a2a_internal_taskpool_t *__parsec_tp = PARSEC_OBJ_NEW(__parsec_a2a_internal_taskpool_t);
+  /* Dump the hidden parameters with default values */
+
+  /* Now the Parameter-dependent structures: */
+  __parsec_tp->super._g_descA = descA;
+  __parsec_tp->super._g_descB = descB;
+  __parsec_tp->super._g_NR = NR;
+  __parsec_tp->super._g_NT = NT;
+  PARSEC_AYU_REGISTER_TASK(&a2a_FANIN);
+  PARSEC_AYU_REGISTER_TASK(&a2a_RECV);
+  PARSEC_AYU_REGISTER_TASK(&a2a_SEND);
+  PARSEC_AYU_REGISTER_TASK(&a2a_FANOUT);
+  PARSEC_AYU_REGISTER_TASK(&a2a_READER_B);
+  __parsec_tp->super.super.startup_hook = (parsec_startup_fn_t)a2a_startup;
+  (void)parsec_taskpool_reserve_id((parsec_taskpool_t*)__parsec_tp);
+/* Prevent warnings related to not used hidden global variables */
+;
+  return (parsec_a2a_taskpool_t*)__parsec_tp;
+}
+
+
+/**
+ * @param [IN] A    the data, already distributed and allocated
+ * @param [IN] size size of each local data element
+ * @param [IN] nb   number of iterations
+ *
+ * @return the parsec taskpool to schedule.
+ */
+parsec_taskpool_t *a2a_new(parsec_tiled_matrix_t *A, parsec_tiled_matrix_t *B, int size, int repeat)
+{
+    int worldsize;
+    parsec_a2a_taskpool_t *tp = NULL;
+    (void)size;
+
+#if defined(PARSEC_HAVE_MPI)
+    MPI_Comm_size(MPI_COMM_WORLD, &worldsize);
+#else
+    worldsize = 1;
+#endif
+
+    if( repeat <= 0 ) {
+        fprintf(stderr, "To work, A2A must do at least one exchange of at least one byte\n");
+        return (parsec_taskpool_t*)tp;
+    }
+
+    tp = parsec_a2a_new(A, B, repeat, worldsize);
+
+    parsec_add2arena_rect( &tp->arenas_datatypes[PARSEC_a2a_DEFAULT_ADT_IDX],
+                                  parsec_datatype_int32_t,
+                                  size, 1, size);
+
+
+
+    return (parsec_taskpool_t*)tp;
+}
+
+PARSEC_OBJ_CLASS_INSTANCE(parsec_a2a_taskpool_t, parsec_taskpool_t, NULL, NULL);
+
@@ -0,0 +1,187 @@
+#ifndef _a2a_h_
+#define _a2a_h_
+#include "parsec.h"
+#include "parsec/parsec_internal.h"
+#include "parsec/remote_dep.h"
+
+BEGIN_C_DECLS
+
+#define PARSEC_a2a_DEFAULT_ADT_IDX    0
+#define PARSEC_a2a_ADT_IDX_MAX       1
+typedef struct parsec_a2a_taskpool_s {
+  parsec_taskpool_t super;
+  /* The list of globals */
+  parsec_tiled_matrix_t* _g_descA /* data descA */;
+  parsec_tiled_matrix_t* _g_descB /* data descB */;
+  int _g_NR;
+  int _g_NT;
+  /* The array of datatypes (DEFAULT and co.) */
+  parsec_arena_datatype_t arenas_datatypes[PARSEC_a2a_ADT_IDX_MAX];
+  uint32_t arenas_datatypes_size;
+} parsec_a2a_taskpool_t;
+
+/** Beware that this object is not a superset of the internal object, and as a result
+ *  we should never create one directly. Instead we should rely on the creation of the
+ *  internal object (__parsec_a2a_taskpool_t).
+ */
+PARSEC_OBJ_CLASS_DECLARATION(parsec_a2a_taskpool_t);
+extern parsec_a2a_taskpool_t *parsec_a2a_new(parsec_tiled_matrix_t* _g_descA /* data descA */, parsec_tiled_matrix_t* _g_descB /* data descB */, int _g_NR, int _g_NT);
+
+#if MAX_LOCAL_COUNT < 2  /* number of parameters and locals FANIN */
+  #error Too many parameters and local variables (2 out of MAX_LOCAL_COUNT) for task FANIN
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_a2a_FANIN_assignment_s {
+  parsec_assignment_t r;
+  parsec_assignment_t t;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-2];
+} __parsec_a2a_FANIN_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 2  /* total number of flows for task FANIN */
+  #error Too many flows (2 out of MAX_PARAM_COUNT) for task FANIN
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_a2a_FANIN_data_s {
+  parsec_data_pair_t _f_A;
+  parsec_data_pair_t _f_T;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-2];
+} __parsec_a2a_FANIN_data_t;
+
+typedef struct __parsec_a2a_FANIN_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_a2a_FANIN_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_a2a_FANIN_data_s data;
+} __parsec_a2a_FANIN_task_t;
+
+
+#if MAX_LOCAL_COUNT < 3  /* number of parameters and locals RECV */
+  #error Too many parameters and local variables (3 out of MAX_LOCAL_COUNT) for task RECV
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_a2a_RECV_assignment_s {
+  parsec_assignment_t r;
+  parsec_assignment_t t;
+  parsec_assignment_t s;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-3];
+} __parsec_a2a_RECV_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 3  /* total number of flows for task RECV */
+  #error Too many flows (3 out of MAX_PARAM_COUNT) for task RECV
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_a2a_RECV_data_s {
+  parsec_data_pair_t _f_A;
+  parsec_data_pair_t _f_B;
+  parsec_data_pair_t _f_T;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-3];
+} __parsec_a2a_RECV_data_t;
+
+typedef struct __parsec_a2a_RECV_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_a2a_RECV_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_a2a_RECV_data_s data;
+} __parsec_a2a_RECV_task_t;
+
+
+#if MAX_LOCAL_COUNT < 3  /* number of parameters and locals SEND */
+  #error Too many parameters and local variables (3 out of MAX_LOCAL_COUNT) for task SEND
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_a2a_SEND_assignment_s {
+  parsec_assignment_t r;
+  parsec_assignment_t t;
+  parsec_assignment_t s;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-3];
+} __parsec_a2a_SEND_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 1  /* total number of flows for task SEND */
+  #error Too many flows (1 out of MAX_PARAM_COUNT) for task SEND
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_a2a_SEND_data_s {
+  parsec_data_pair_t _f_A;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-1];
+} __parsec_a2a_SEND_data_t;
+
+typedef struct __parsec_a2a_SEND_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_a2a_SEND_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_a2a_SEND_data_s data;
+} __parsec_a2a_SEND_task_t;
+
+
+#if MAX_LOCAL_COUNT < 2  /* number of parameters and locals FANOUT */
+  #error Too many parameters and local variables (2 out of MAX_LOCAL_COUNT) for task FANOUT
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_a2a_FANOUT_assignment_s {
+  parsec_assignment_t r;
+  parsec_assignment_t t;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-2];
+} __parsec_a2a_FANOUT_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 1  /* total number of flows for task FANOUT */
+  #error Too many flows (1 out of MAX_PARAM_COUNT) for task FANOUT
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_a2a_FANOUT_data_s {
+  parsec_data_pair_t _f_A;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-1];
+} __parsec_a2a_FANOUT_data_t;
+
+typedef struct __parsec_a2a_FANOUT_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_a2a_FANOUT_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_a2a_FANOUT_data_s data;
+} __parsec_a2a_FANOUT_task_t;
+
+
+#if MAX_LOCAL_COUNT < 2  /* number of parameters and locals READER_B */
+  #error Too many parameters and local variables (2 out of MAX_LOCAL_COUNT) for task READER_B
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_a2a_READER_B_assignment_s {
+  parsec_assignment_t r;
+  parsec_assignment_t t;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-2];
+} __parsec_a2a_READER_B_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 1  /* total number of flows for task READER_B */
+  #error Too many flows (1 out of MAX_PARAM_COUNT) for task READER_B
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_a2a_READER_B_data_s {
+  parsec_data_pair_t _f_B;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-1];
+} __parsec_a2a_READER_B_data_t;
+
+typedef struct __parsec_a2a_READER_B_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_a2a_READER_B_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_a2a_READER_B_data_s data;
+} __parsec_a2a_READER_B_task_t;
+
+
+END_C_DECLS
+
+#endif /* _a2a_h_ */ 
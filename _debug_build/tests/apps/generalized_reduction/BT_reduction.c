@@ -0,0 +1,5657 @@
+#include "parsec.h"
+#include "parsec/parsec_internal.h"
+#include "parsec/ayudame.h"
+#include "parsec/execution_stream.h"
+#include "parsec/parsec_binary_profile.h"
+#include "parsec/mca/device/device_gpu.h"
+#if defined(PARSEC_HAVE_DEV_CUDA_SUPPORT)
+#include "parsec/mca/device/cuda/device_cuda.h"
+#endif  /* defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) */
+#if defined(PARSEC_HAVE_DEV_HIP_SUPPORT)
+#include "parsec/mca/device/hip/device_hip.h"
+#endif  /* defined(PARSEC_HAVE_DEV_HIP_SUPPORT) */
+#if defined(_MSC_VER) || defined(__MINGW32__)
+#  include <malloc.h>
+#else
+#  include <alloca.h>
+#endif  /* defined(_MSC_VER) || defined(__MINGW32__) */
+
+#define PARSEC_BT_reduction_NB_TASK_CLASSES 4
+#define PARSEC_BT_reduction_NB_DATA 1
+
+typedef struct __parsec_BT_reduction_internal_taskpool_s __parsec_BT_reduction_internal_taskpool_t;
+struct parsec_BT_reduction_internal_taskpool_s;
+
+/** Predeclarations of the parsec_task_class_t */
+static const parsec_task_class_t BT_reduction_LINE_TERMINATOR;
+static const parsec_task_class_t BT_reduction_LINEAR_REDUC;
+static const parsec_task_class_t BT_reduction_BT_REDUC;
+static const parsec_task_class_t BT_reduction_REDUCTION;
+/** Predeclarations of the parameters */
+static const parsec_flow_t flow_of_BT_reduction_LINE_TERMINATOR_for_T;
+static const parsec_flow_t flow_of_BT_reduction_LINEAR_REDUC_for_C;
+static const parsec_flow_t flow_of_BT_reduction_LINEAR_REDUC_for_B;
+static const parsec_flow_t flow_of_BT_reduction_BT_REDUC_for_B;
+static const parsec_flow_t flow_of_BT_reduction_BT_REDUC_for_A;
+static const parsec_flow_t flow_of_BT_reduction_REDUCTION_for_A;
+/*
+ * Copyright (c) 2013-2022 The University of Tennessee and The University
+ *                         of Tennessee Research Foundation.  All rights
+ *                         reserved.
+ */
+#include "parsec/data_distribution.h"
+#include "parsec/data_dist/matrix/matrix.h"
+#include "parsec/data.h"
+#include "parsec/utils/mca_param.h"
+#include "parsec/arena.h"
+
+#define RED_OP(_A, _B) (_A + _B)
+#define TYPE(_X) INT(_X)
+
+#define INT(_X) ( (int *)(_X) )
+#define OFFSET(_X,_i) ( *(TYPE(_X)+(_i)) )
+#define REDUCE(_A, _B, _i) OFFSET(_B,_i) = RED_OP( OFFSET(_A,_i), OFFSET(_B,_i) )
+
+int compute_offset(int N, int t){
+    uint32_t i, cnt=0, offset=0;
+
+    for(i=0; i<8*sizeof(N); i++){
+        if( (1<<i)&N ){
+            cnt++;
+        }
+        if( cnt == (uint32_t)t )
+            return offset;
+
+        if( (1<<i)&N ){
+            offset += (1<<i);
+        }
+    }
+    assert(0);
+    return 0xffffffff;
+}
+
+int count_bits(int N){
+    uint32_t i, cnt=0;
+    for(i=0; i<8*sizeof(N); i++){
+        if( (1<<i)&N ){
+            cnt++;
+        }
+    }
+    return cnt;
+}
+
+int log_of_tree_size(int N, int t){
+    uint32_t i, cnt=0;
+    for(i=0; i<8*sizeof(N); i++){
+        if( (1<<i)&N ){
+            cnt++;
+        }
+        if( cnt == (uint32_t)t ) return i;
+    }
+    assert(0);
+    return 0xffffffff;
+}
+
+int index_to_tree(int N, int idx){
+    uint32_t i, cnt=0;
+    for(i=0; i<8*sizeof(N); i++){
+        if( (1<<i)&N ){
+            cnt++;
+            if( idx < (1<<i) )
+                return cnt;
+            else
+                idx -= (1<<i);
+        }
+    }
+    assert(0);
+    return 0xffffffff;
+}
+
+int global_to_local_index(int N, int idx){
+    uint32_t i;
+    for(i=0; i<8*sizeof(N); i++){
+        if( (1<<i)&N ){
+            if( idx < (1<<i) )
+                return idx;
+            else
+                idx -= (1<<i);
+        }
+    }
+    assert(0);
+    return 0xffffffff;
+}
+
+#define PARSEC_BT_reduction_DEFAULT_ADT    (&__parsec_tp->super.arenas_datatypes[PARSEC_BT_reduction_DEFAULT_ADT_IDX])
+#include "BT_reduction.h"
+
+struct __parsec_BT_reduction_internal_taskpool_s {
+ parsec_BT_reduction_taskpool_t super;
+ volatile int32_t sync_point;
+ volatile int32_t initial_number_tasks;
+ parsec_task_t* startup_queue;
+  /* The ranges to compute the hash key */
+  int LINE_TERMINATOR_j_min;
+  int LINE_TERMINATOR_j_range;
+  int LINEAR_REDUC_i_min;
+  int LINEAR_REDUC_i_range;
+  int BT_REDUC_t_min;
+  int BT_REDUC_t_range;
+  int BT_REDUC_s_min;
+  int BT_REDUC_s_range;
+  int BT_REDUC_i_min;
+  int BT_REDUC_i_range;
+  int REDUCTION_i_min;
+  int REDUCTION_i_range;
+  /* The list of data repositories  LINE_TERMINATOR  LINEAR_REDUC  BT_REDUC  REDUCTION */
+  data_repo_t* repositories[4];
+};
+
+#if defined(PARSEC_PROF_TRACE)
+#  if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+static int BT_reduction_profiling_array[4*PARSEC_BT_reduction_NB_TASK_CLASSES] = {-2}; /* 2 pairs (begin, end) per task, times two because each task class has an internal_init task */
+#  else /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+static int BT_reduction_profiling_array[2*PARSEC_BT_reduction_NB_TASK_CLASSES] = {-2}; /* 2 pairs (begin, end) per task */
+#  endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+#endif  /* defined(PARSEC_PROF_TRACE) */
+/* Globals */
+#define dataA __parsec_tp->super._g_dataA
+#define NB (__parsec_tp->super._g_NB)
+#define NT (__parsec_tp->super._g_NT)
+
+static inline int parsec_imin(int a, int b) { return (a <= b) ? a : b; };
+
+static inline int parsec_imax(int a, int b) { return (a >= b) ? a : b; };
+
+static inline int32_t BT_reduction_LINE_TERMINATOR_inline_c_expr1_line_194(const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp, const __parsec_BT_reduction_LINE_TERMINATOR_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task LINE_TERMINATOR */
+  const int j = assignments->j.value; (void)j;
+  const int tree_count = assignments->tree_count.value; (void)tree_count;
+  const int i = assignments->i.value; (void)i;
+  const int offset = assignments->offset.value; (void)offset;
+
+  (void)j;  (void)tree_count;  (void)i;  (void)offset;
+
+return compute_offset(NT, i); 
+}
+
+static inline int32_t BT_reduction_LINE_TERMINATOR_inline_c_expr2_line_192(const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp, const __parsec_BT_reduction_LINE_TERMINATOR_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task LINE_TERMINATOR */
+  const int j = assignments->j.value; (void)j;
+  const int tree_count = assignments->tree_count.value; (void)tree_count;
+  const int i = assignments->i.value; (void)i;
+  const int offset = assignments->offset.value; (void)offset;
+
+  (void)j;  (void)tree_count;  (void)i;  (void)offset;
+
+ return count_bits(NT); 
+}
+
+static inline int32_t BT_reduction_LINEAR_REDUC_inline_c_expr3_line_160(const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp, const __parsec_BT_reduction_LINEAR_REDUC_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task LINEAR_REDUC */
+  const int tree_count = assignments->tree_count.value; (void)tree_count;
+  const int i = assignments->i.value; (void)i;
+  const int sz = assignments->sz.value; (void)sz;
+  const int offset = assignments->offset.value; (void)offset;
+
+  (void)tree_count;  (void)i;  (void)sz;  (void)offset;
+
+return compute_offset(NT, i); 
+}
+
+static inline int32_t BT_reduction_LINEAR_REDUC_inline_c_expr4_line_159(const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp, const __parsec_BT_reduction_LINEAR_REDUC_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task LINEAR_REDUC */
+  const int tree_count = assignments->tree_count.value; (void)tree_count;
+  const int i = assignments->i.value; (void)i;
+  const int sz = assignments->sz.value; (void)sz;
+  const int offset = assignments->offset.value; (void)offset;
+
+  (void)tree_count;  (void)i;  (void)sz;  (void)offset;
+
+ return log_of_tree_size(NT, i); 
+}
+
+static inline int32_t BT_reduction_LINEAR_REDUC_inline_c_expr5_line_157(const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp, const __parsec_BT_reduction_LINEAR_REDUC_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task LINEAR_REDUC */
+  const int tree_count = assignments->tree_count.value; (void)tree_count;
+  const int i = assignments->i.value; (void)i;
+  const int sz = assignments->sz.value; (void)sz;
+  const int offset = assignments->offset.value; (void)offset;
+
+  (void)tree_count;  (void)i;  (void)sz;  (void)offset;
+
+ return count_bits(NT); 
+}
+
+static inline int32_t BT_reduction_BT_REDUC_inline_c_expr6_line_129(const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp, const __parsec_BT_reduction_BT_REDUC_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task BT_REDUC */
+  const int tree_count = assignments->tree_count.value; (void)tree_count;
+  const int t = assignments->t.value; (void)t;
+  const int sz = assignments->sz.value; (void)sz;
+  const int s = assignments->s.value; (void)s;
+  const int lvl = assignments->lvl.value; (void)lvl;
+  const int i = assignments->i.value; (void)i;
+  const int offset = assignments->offset.value; (void)offset;
+
+  (void)tree_count;  (void)t;  (void)sz;  (void)s;  (void)lvl;  (void)i;  (void)offset;
+
+return compute_offset(NT, t); 
+}
+
+static inline int32_t BT_reduction_BT_REDUC_inline_c_expr7_line_128(const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp, const __parsec_BT_reduction_BT_REDUC_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task BT_REDUC */
+  const int tree_count = assignments->tree_count.value; (void)tree_count;
+  const int t = assignments->t.value; (void)t;
+  const int sz = assignments->sz.value; (void)sz;
+  const int s = assignments->s.value; (void)s;
+  const int lvl = assignments->lvl.value; (void)lvl;
+  const int i = assignments->i.value; (void)i;
+  const int offset = assignments->offset.value; (void)offset;
+
+  (void)tree_count;  (void)t;  (void)sz;  (void)s;  (void)lvl;  (void)i;  (void)offset;
+
+ return (1<<lvl)-1; 
+}
+
+static inline int32_t BT_reduction_BT_REDUC_inline_c_expr8_line_125(const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp, const __parsec_BT_reduction_BT_REDUC_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task BT_REDUC */
+  const int tree_count = assignments->tree_count.value; (void)tree_count;
+  const int t = assignments->t.value; (void)t;
+  const int sz = assignments->sz.value; (void)sz;
+  const int s = assignments->s.value; (void)s;
+  const int lvl = assignments->lvl.value; (void)lvl;
+  const int i = assignments->i.value; (void)i;
+  const int offset = assignments->offset.value; (void)offset;
+
+  (void)tree_count;  (void)t;  (void)sz;  (void)s;  (void)lvl;  (void)i;  (void)offset;
+
+ return log_of_tree_size(NT, t); 
+}
+
+static inline int32_t BT_reduction_BT_REDUC_inline_c_expr9_line_123(const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp, const __parsec_BT_reduction_BT_REDUC_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task BT_REDUC */
+  const int tree_count = assignments->tree_count.value; (void)tree_count;
+  const int t = assignments->t.value; (void)t;
+  const int sz = assignments->sz.value; (void)sz;
+  const int s = assignments->s.value; (void)s;
+  const int lvl = assignments->lvl.value; (void)lvl;
+  const int i = assignments->i.value; (void)i;
+  const int offset = assignments->offset.value; (void)offset;
+
+  (void)tree_count;  (void)t;  (void)sz;  (void)s;  (void)lvl;  (void)i;  (void)offset;
+
+ return count_bits(NT); 
+}
+
+static inline int32_t BT_reduction_REDUCTION_inline_c_expr10_line_106(const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp, const __parsec_BT_reduction_REDUCTION_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task REDUCTION */
+  const int i = assignments->i.value; (void)i;
+  const int t = assignments->t.value; (void)t;
+  const int li = assignments->li.value; (void)li;
+  const int sz = assignments->sz.value; (void)sz;
+
+  (void)i;  (void)t;  (void)li;  (void)sz;
+
+ return log_of_tree_size(NT, t); 
+}
+
+static inline int32_t BT_reduction_REDUCTION_inline_c_expr11_line_105(const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp, const __parsec_BT_reduction_REDUCTION_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task REDUCTION */
+  const int i = assignments->i.value; (void)i;
+  const int t = assignments->t.value; (void)t;
+  const int li = assignments->li.value; (void)li;
+  const int sz = assignments->sz.value; (void)sz;
+
+  (void)i;  (void)t;  (void)li;  (void)sz;
+
+ return global_to_local_index(NT,i); 
+}
+
+static inline int32_t BT_reduction_REDUCTION_inline_c_expr12_line_104(const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp, const __parsec_BT_reduction_REDUCTION_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task REDUCTION */
+  const int i = assignments->i.value; (void)i;
+  const int t = assignments->t.value; (void)t;
+  const int li = assignments->li.value; (void)li;
+  const int sz = assignments->sz.value; (void)sz;
+
+  (void)i;  (void)t;  (void)li;  (void)sz;
+
+ return index_to_tree(NT,i); 
+}
+
+/* Data Access Macros */
+#define data_of_dataA(dataA_d0, dataA_d1)  (((parsec_data_collection_t*)__parsec_tp->super._g_dataA)->data_of((parsec_data_collection_t*)__parsec_tp->super._g_dataA, (dataA_d0), (dataA_d1)))
+
+#define rank_of_dataA(dataA_d0, dataA_d1)  (((parsec_data_collection_t*)__parsec_tp->super._g_dataA)->rank_of((parsec_data_collection_t*)__parsec_tp->super._g_dataA, (dataA_d0), (dataA_d1)))
+
+/* Functions Predicates */
+#define LINE_TERMINATOR_pred(j, tree_count, i, offset) (((parsec_data_collection_t*)(__parsec_tp->super._g_dataA))->myrank == rank_of_dataA(offset, 0))
+#define LINEAR_REDUC_pred(tree_count, i, sz, offset) (((parsec_data_collection_t*)(__parsec_tp->super._g_dataA))->myrank == rank_of_dataA(offset, 0))
+#define BT_REDUC_pred(tree_count, t, sz, s, lvl, i, offset) (((parsec_data_collection_t*)(__parsec_tp->super._g_dataA))->myrank == rank_of_dataA((offset + (i * 2)), 0))
+#define REDUCTION_pred(i, t, li, sz) (((parsec_data_collection_t*)(__parsec_tp->super._g_dataA))->myrank == rank_of_dataA(i, 0))
+
+/* Data Repositories */
+#define LINE_TERMINATOR_repo (__parsec_tp->repositories[3])
+#define LINEAR_REDUC_repo (__parsec_tp->repositories[2])
+#define BT_REDUC_repo (__parsec_tp->repositories[1])
+#define REDUCTION_repo (__parsec_tp->repositories[0])
+/* Release dependencies output macro */
+#if defined(PARSEC_DEBUG_NOISIER)
+#define RELEASE_DEP_OUTPUT(ES, DEPO, TASKO, DEPI, TASKI, RSRC, RDST, DATA)\
+  do { \
+    char tmp1[128], tmp2[128]; (void)tmp1; (void)tmp2;\
+    PARSEC_DEBUG_VERBOSE(20, parsec_debug_output, "thread %d VP %d explore deps from %s:%s to %s:%s (from rank %d to %d) base ptr %p",\
+           (NULL != (ES) ? (ES)->th_id : -1), (NULL != (ES) ? (ES)->virtual_process->vp_id : -1),\
+           DEPO, parsec_task_snprintf(tmp1, 128, (parsec_task_t*)(TASKO)),\
+           DEPI, parsec_task_snprintf(tmp2, 128, (parsec_task_t*)(TASKI)), (RSRC), (RDST), (DATA));\
+  } while(0)
+#define ACQUIRE_FLOW(TASKI, DEPI, FUNO, DEPO, LOCALS, PTR)\
+  do { \
+    char tmp1[128], tmp2[128]; (void)tmp1; (void)tmp2;\
+    PARSEC_DEBUG_VERBOSE(20, parsec_debug_output, "task %s acquires flow %s from %s %s data ptr %p",\
+           parsec_task_snprintf(tmp1, 128, (parsec_task_t*)(TASKI)), (DEPI),\
+           (DEPO), parsec_snprintf_assignments(tmp2, 128, (FUNO), (parsec_assignment_t*)(LOCALS)), (PTR));\
+  } while(0)
+#else
+#define RELEASE_DEP_OUTPUT(ES, DEPO, TASKO, DEPI, TASKI, RSRC, RDST, DATA)
+#define ACQUIRE_FLOW(TASKI, DEPI, TASKO, DEPO, LOCALS, PTR)
+#endif
+static inline parsec_key_t __jdf2c_make_key_LINE_TERMINATOR(const parsec_taskpool_t *tp, const parsec_assignment_t *as)
+{
+  const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp = (const __parsec_BT_reduction_internal_taskpool_t *)tp;
+  const __parsec_BT_reduction_LINE_TERMINATOR_parsec_assignment_t *assignment = (const __parsec_BT_reduction_LINE_TERMINATOR_parsec_assignment_t*)as;
+  uint64_t __parsec_id = 0;
+  __parsec_id += (assignment->j.value - __parsec_tp->LINE_TERMINATOR_j_min);
+  return (parsec_key_t)__parsec_id;
+}
+static char *__jdf2c_key_fns_LINE_TERMINATOR_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_BT_reduction_internal_taskpool_t *__parsec_tp = (__parsec_BT_reduction_internal_taskpool_t *)user_data;
+  __parsec_BT_reduction_LINE_TERMINATOR_parsec_assignment_t __jdf2c__assignments = {  .j.value = 0, .tree_count.value = 0, .i.value = 0, .offset.value = 0 };
+  int j = (__parsec_key) % __parsec_tp->LINE_TERMINATOR_j_range + __parsec_tp->LINE_TERMINATOR_j_min;
+  __parsec_key = __parsec_key / __parsec_tp->LINE_TERMINATOR_j_range;
+  __jdf2c__assignments.j.value = j;
+  int tree_count = BT_reduction_LINE_TERMINATOR_inline_c_expr2_line_192(__parsec_tp, &__jdf2c__assignments);
+  (void)tree_count;
+  __jdf2c__assignments.tree_count.value = tree_count;
+  int i = tree_count;
+  (void)i;
+  __jdf2c__assignments.i.value = i;
+  int offset = BT_reduction_LINE_TERMINATOR_inline_c_expr1_line_194(__parsec_tp, &__jdf2c__assignments);
+  (void)offset;
+  __jdf2c__assignments.offset.value = offset;
+  (void)__jdf2c__assignments;
+  snprintf(buffer, buffer_size, "LINE_TERMINATOR(%d)", j);
+  return buffer;
+}
+
+static parsec_key_fn_t __jdf2c_key_fns_LINE_TERMINATOR = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = __jdf2c_key_fns_LINE_TERMINATOR_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+static inline parsec_key_t __jdf2c_make_key_LINEAR_REDUC(const parsec_taskpool_t *tp, const parsec_assignment_t *as)
+{
+  const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp = (const __parsec_BT_reduction_internal_taskpool_t *)tp;
+  const __parsec_BT_reduction_LINEAR_REDUC_parsec_assignment_t *assignment = (const __parsec_BT_reduction_LINEAR_REDUC_parsec_assignment_t*)as;
+  uint64_t __parsec_id = 0;
+  __parsec_id += (assignment->i.value - __parsec_tp->LINEAR_REDUC_i_min);
+  return (parsec_key_t)__parsec_id;
+}
+static char *__jdf2c_key_fns_LINEAR_REDUC_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_BT_reduction_internal_taskpool_t *__parsec_tp = (__parsec_BT_reduction_internal_taskpool_t *)user_data;
+  __parsec_BT_reduction_LINEAR_REDUC_parsec_assignment_t __jdf2c__assignments = {  .tree_count.value = 0, .i.value = 0, .sz.value = 0, .offset.value = 0 };
+  int tree_count = BT_reduction_LINEAR_REDUC_inline_c_expr5_line_157(__parsec_tp, &__jdf2c__assignments);
+  (void)tree_count;
+  __jdf2c__assignments.tree_count.value = tree_count;
+  int i = (__parsec_key) % __parsec_tp->LINEAR_REDUC_i_range + __parsec_tp->LINEAR_REDUC_i_min;
+  __parsec_key = __parsec_key / __parsec_tp->LINEAR_REDUC_i_range;
+  __jdf2c__assignments.i.value = i;
+  int sz = BT_reduction_LINEAR_REDUC_inline_c_expr4_line_159(__parsec_tp, &__jdf2c__assignments);
+  (void)sz;
+  __jdf2c__assignments.sz.value = sz;
+  int offset = BT_reduction_LINEAR_REDUC_inline_c_expr3_line_160(__parsec_tp, &__jdf2c__assignments);
+  (void)offset;
+  __jdf2c__assignments.offset.value = offset;
+  (void)__jdf2c__assignments;
+  snprintf(buffer, buffer_size, "LINEAR_REDUC(%d)", i);
+  return buffer;
+}
+
+static parsec_key_fn_t __jdf2c_key_fns_LINEAR_REDUC = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = __jdf2c_key_fns_LINEAR_REDUC_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+static inline parsec_key_t __jdf2c_make_key_BT_REDUC(const parsec_taskpool_t *tp, const parsec_assignment_t *as)
+{
+  const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp = (const __parsec_BT_reduction_internal_taskpool_t *)tp;
+  const __parsec_BT_reduction_BT_REDUC_parsec_assignment_t *assignment = (const __parsec_BT_reduction_BT_REDUC_parsec_assignment_t*)as;
+  uint64_t __parsec_id = 0;
+  __parsec_id += (assignment->t.value - __parsec_tp->BT_REDUC_t_min);
+  __parsec_id += (assignment->s.value - __parsec_tp->BT_REDUC_s_min) * __parsec_tp->BT_REDUC_t_range;
+  __parsec_id += (assignment->i.value - __parsec_tp->BT_REDUC_i_min) * __parsec_tp->BT_REDUC_t_range * __parsec_tp->BT_REDUC_s_range;
+  return (parsec_key_t)__parsec_id;
+}
+static char *__jdf2c_key_fns_BT_REDUC_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_BT_reduction_internal_taskpool_t *__parsec_tp = (__parsec_BT_reduction_internal_taskpool_t *)user_data;
+  __parsec_BT_reduction_BT_REDUC_parsec_assignment_t __jdf2c__assignments = {  .tree_count.value = 0, .t.value = 0, .sz.value = 0, .s.value = 0, .lvl.value = 0, .i.value = 0, .offset.value = 0 };
+  int tree_count = BT_reduction_BT_REDUC_inline_c_expr9_line_123(__parsec_tp, &__jdf2c__assignments);
+  (void)tree_count;
+  __jdf2c__assignments.tree_count.value = tree_count;
+  int t = (__parsec_key) % __parsec_tp->BT_REDUC_t_range + __parsec_tp->BT_REDUC_t_min;
+  __parsec_key = __parsec_key / __parsec_tp->BT_REDUC_t_range;
+  __jdf2c__assignments.t.value = t;
+  int sz = BT_reduction_BT_REDUC_inline_c_expr8_line_125(__parsec_tp, &__jdf2c__assignments);
+  (void)sz;
+  __jdf2c__assignments.sz.value = sz;
+  int s = (__parsec_key) % __parsec_tp->BT_REDUC_s_range + __parsec_tp->BT_REDUC_s_min;
+  __parsec_key = __parsec_key / __parsec_tp->BT_REDUC_s_range;
+  __jdf2c__assignments.s.value = s;
+  int lvl = (sz - s);
+  (void)lvl;
+  __jdf2c__assignments.lvl.value = lvl;
+  int i = (__parsec_key) % __parsec_tp->BT_REDUC_i_range + __parsec_tp->BT_REDUC_i_min;
+  __parsec_key = __parsec_key / __parsec_tp->BT_REDUC_i_range;
+  __jdf2c__assignments.i.value = i;
+  int offset = BT_reduction_BT_REDUC_inline_c_expr6_line_129(__parsec_tp, &__jdf2c__assignments);
+  (void)offset;
+  __jdf2c__assignments.offset.value = offset;
+  (void)__jdf2c__assignments;
+  snprintf(buffer, buffer_size, "BT_REDUC(%d, %d, %d)", t, s, i);
+  return buffer;
+}
+
+static parsec_key_fn_t __jdf2c_key_fns_BT_REDUC = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = __jdf2c_key_fns_BT_REDUC_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+static inline parsec_key_t __jdf2c_make_key_REDUCTION(const parsec_taskpool_t *tp, const parsec_assignment_t *as)
+{
+  const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp = (const __parsec_BT_reduction_internal_taskpool_t *)tp;
+  const __parsec_BT_reduction_REDUCTION_parsec_assignment_t *assignment = (const __parsec_BT_reduction_REDUCTION_parsec_assignment_t*)as;
+  uint64_t __parsec_id = 0;
+  __parsec_id += (assignment->i.value - __parsec_tp->REDUCTION_i_min);
+  return (parsec_key_t)__parsec_id;
+}
+static char *__jdf2c_key_fns_REDUCTION_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_BT_reduction_internal_taskpool_t *__parsec_tp = (__parsec_BT_reduction_internal_taskpool_t *)user_data;
+  __parsec_BT_reduction_REDUCTION_parsec_assignment_t __jdf2c__assignments = {  .i.value = 0, .t.value = 0, .li.value = 0, .sz.value = 0 };
+  int i = (__parsec_key) % __parsec_tp->REDUCTION_i_range + __parsec_tp->REDUCTION_i_min;
+  __parsec_key = __parsec_key / __parsec_tp->REDUCTION_i_range;
+  __jdf2c__assignments.i.value = i;
+  int t = BT_reduction_REDUCTION_inline_c_expr12_line_104(__parsec_tp, &__jdf2c__assignments);
+  (void)t;
+  __jdf2c__assignments.t.value = t;
+  int li = BT_reduction_REDUCTION_inline_c_expr11_line_105(__parsec_tp, &__jdf2c__assignments);
+  (void)li;
+  __jdf2c__assignments.li.value = li;
+  int sz = BT_reduction_REDUCTION_inline_c_expr10_line_106(__parsec_tp, &__jdf2c__assignments);
+  (void)sz;
+  __jdf2c__assignments.sz.value = sz;
+  (void)__jdf2c__assignments;
+  snprintf(buffer, buffer_size, "REDUCTION(%d)", i);
+  return buffer;
+}
+
+static parsec_key_fn_t __jdf2c_key_fns_REDUCTION = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = __jdf2c_key_fns_REDUCTION_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/******                                LINE_TERMINATOR                                ******/
+
+static inline int32_t minexpr_of_symb_BT_reduction_LINE_TERMINATOR_j_fct(const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp, const __parsec_BT_reduction_LINE_TERMINATOR_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_BT_reduction_LINE_TERMINATOR_j = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_BT_reduction_LINE_TERMINATOR_j_fct }
+                   }
+};
+static inline int32_t maxexpr_of_symb_BT_reduction_LINE_TERMINATOR_j_fct(const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp, const __parsec_BT_reduction_LINE_TERMINATOR_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t maxexpr_of_symb_BT_reduction_LINE_TERMINATOR_j = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_BT_reduction_LINE_TERMINATOR_j_fct }
+                   }
+};
+static const parsec_symbol_t symb_BT_reduction_LINE_TERMINATOR_j = { .name = "j", .context_index = 0, .min = &minexpr_of_symb_BT_reduction_LINE_TERMINATOR_j, .max = &maxexpr_of_symb_BT_reduction_LINE_TERMINATOR_j, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int32_t expr_of_symb_BT_reduction_LINE_TERMINATOR_tree_count_fct(const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp, const __parsec_BT_reduction_LINE_TERMINATOR_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return BT_reduction_LINE_TERMINATOR_inline_c_expr2_line_192(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_BT_reduction_LINE_TERMINATOR_tree_count = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_BT_reduction_LINE_TERMINATOR_tree_count_fct }
+                   }
+};
+static const parsec_symbol_t symb_BT_reduction_LINE_TERMINATOR_tree_count = { .name = "tree_count", .context_index = 1, .min = &expr_of_symb_BT_reduction_LINE_TERMINATOR_tree_count, .max = &expr_of_symb_BT_reduction_LINE_TERMINATOR_tree_count, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int expr_of_symb_BT_reduction_LINE_TERMINATOR_i_fct(const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp, const __parsec_BT_reduction_LINE_TERMINATOR_parsec_assignment_t *locals)
+{
+  const int j = locals->j.value; (void)j;
+  const int tree_count = locals->tree_count.value;
+  const int i = locals->i.value; (void)i;
+  const int offset = locals->offset.value; (void)offset;
+
+  (void)j;
+  (void)tree_count;
+  (void)i;
+  (void)offset;
+  (void)__parsec_tp; (void)locals;
+  return tree_count;
+}
+static const parsec_expr_t expr_of_symb_BT_reduction_LINE_TERMINATOR_i = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_BT_reduction_LINE_TERMINATOR_i_fct }
+                   }
+};
+static const parsec_symbol_t symb_BT_reduction_LINE_TERMINATOR_i = { .name = "i", .context_index = 2, .min = &expr_of_symb_BT_reduction_LINE_TERMINATOR_i, .max = &expr_of_symb_BT_reduction_LINE_TERMINATOR_i, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_BT_reduction_LINE_TERMINATOR_offset_fct(const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp, const __parsec_BT_reduction_LINE_TERMINATOR_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return BT_reduction_LINE_TERMINATOR_inline_c_expr1_line_194(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_BT_reduction_LINE_TERMINATOR_offset = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_BT_reduction_LINE_TERMINATOR_offset_fct }
+                   }
+};
+static const parsec_symbol_t symb_BT_reduction_LINE_TERMINATOR_offset = { .name = "offset", .context_index = 3, .min = &expr_of_symb_BT_reduction_LINE_TERMINATOR_offset, .max = &expr_of_symb_BT_reduction_LINE_TERMINATOR_offset, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int affinity_of_BT_reduction_LINE_TERMINATOR(const __parsec_BT_reduction_LINE_TERMINATOR_task_t *this_task,
+                     parsec_data_ref_t *ref)
+{
+    const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp = (const __parsec_BT_reduction_internal_taskpool_t*)this_task->taskpool;
+  const int j = this_task->locals.j.value; (void)j;
+  const int tree_count = this_task->locals.tree_count.value; (void)tree_count;
+  const int i = this_task->locals.i.value; (void)i;
+  const int offset = this_task->locals.offset.value; (void)offset;
+
+  /* Silent Warnings: should look into predicate to know what variables are usefull */
+  (void)j;
+  (void)tree_count;
+  (void)i;
+  (void)offset;
+  ref->dc = (parsec_data_collection_t *)__parsec_tp->super._g_dataA;
+  /* Compute data key */
+  ref->key = ref->dc->data_key(ref->dc, offset, 0);
+  return 1;
+}
+static const parsec_property_t properties_of_BT_reduction_LINE_TERMINATOR[1] = {
+  {.name = NULL, .expr = NULL}
+};
+static const parsec_dep_t flow_of_BT_reduction_LINE_TERMINATOR_for_T_dep1_atline_198 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 2, /* BT_reduction_LINEAR_REDUC */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_BT_reduction_LINEAR_REDUC_for_B,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_BT_reduction_LINE_TERMINATOR_for_T,
+};
+#if MAX_DEP_OUT_COUNT < 1  /* number of output dependencies */
+    #error Too many output dependencies (supports up to MAX_DEP_OUT_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_OUT_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_BT_reduction_LINE_TERMINATOR_for_T = {
+  .name               = "T",
+  .sym_type           = PARSEC_SYM_OUT,
+  .flow_flags         = PARSEC_FLOW_ACCESS_WRITE,
+  .flow_index         = 0,
+  .flow_datatype_mask = 0x1,
+  .dep_in     = { NULL },
+  .dep_out    = { &flow_of_BT_reduction_LINE_TERMINATOR_for_T_dep1_atline_198 }
+};
+
+static void
+iterate_successors_of_BT_reduction_LINE_TERMINATOR(parsec_execution_stream_t *es, const __parsec_BT_reduction_LINE_TERMINATOR_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp = (const __parsec_BT_reduction_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_BT_reduction_LINE_TERMINATOR_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_BT_reduction_LINE_TERMINATOR_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int j = __jdf2c__tmp_locals.j.value; (void)j;
+  const int tree_count = __jdf2c__tmp_locals.tree_count.value; (void)tree_count;
+  const int i = __jdf2c__tmp_locals.i.value; (void)i;
+  const int offset = __jdf2c__tmp_locals.offset.value; (void)offset;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)j;  (void)tree_count;  (void)i;  (void)offset;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_dataA(offset, 0);
+#endif
+  if( action_mask & 0x1 ) {  /* Flow of data T [0] */
+    data.data   = this_task->data._f_T.data_out;
+    data.data_future  = NULL;
+    if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_BT_reduction_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_BT_reduction_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+       __parsec_BT_reduction_LINEAR_REDUC_task_t* ncc = (__parsec_BT_reduction_LINEAR_REDUC_task_t*)&nc;
+    nc.task_class = __parsec_tp->super.super.task_classes_array[BT_reduction_LINEAR_REDUC.task_class_id];
+      const int LINEAR_REDUC_tree_count = BT_reduction_LINEAR_REDUC_inline_c_expr5_line_157(__parsec_tp, &ncc->locals);
+      assert(&nc.locals[0].value == &ncc->locals.tree_count.value);
+      ncc->locals.tree_count.value = LINEAR_REDUC_tree_count;
+      const int LINEAR_REDUC_i = tree_count;
+      if( (LINEAR_REDUC_i >= (1)) && (LINEAR_REDUC_i <= (ncc->locals.tree_count.value)) ) {
+        assert(&nc.locals[1].value == &ncc->locals.i.value);
+        ncc->locals.i.value = LINEAR_REDUC_i;
+        const int LINEAR_REDUC_sz = BT_reduction_LINEAR_REDUC_inline_c_expr4_line_159(__parsec_tp, &ncc->locals);
+        assert(&nc.locals[2].value == &ncc->locals.sz.value);
+        ncc->locals.sz.value = LINEAR_REDUC_sz;
+        const int LINEAR_REDUC_offset = BT_reduction_LINEAR_REDUC_inline_c_expr3_line_160(__parsec_tp, &ncc->locals);
+        assert(&nc.locals[3].value == &ncc->locals.offset.value);
+        ncc->locals.offset.value = LINEAR_REDUC_offset;
+#if defined(DISTRIBUTED)
+        rank_dst = rank_of_dataA(ncc->locals.offset.value, 0);
+        if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+          vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_dataA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_dataA, ncc->locals.offset.value, 0);
+        nc.priority = __parsec_tp->super.super.priority;
+        successor_repo = LINEAR_REDUC_repo;
+        successor_repo_key = __jdf2c_make_key_LINEAR_REDUC((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+      RELEASE_DEP_OUTPUT(es, "T", this_task, "B", &nc, rank_src, rank_dst, &data);
+      if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_BT_reduction_LINE_TERMINATOR_for_T_dep1_atline_198, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+        }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static int release_deps_of_BT_reduction_LINE_TERMINATOR(parsec_execution_stream_t *es, __parsec_BT_reduction_LINE_TERMINATOR_task_t *this_task, uint32_t action_mask, parsec_remote_deps_t *deps)
+{
+  PARSEC_PINS(es, RELEASE_DEPS_BEGIN, (parsec_task_t *)this_task);  const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp = (const __parsec_BT_reduction_internal_taskpool_t *)this_task->taskpool;
+  parsec_release_dep_fct_arg_t arg;
+  int __vp_id;
+  int consume_local_repo = 0;
+  arg.action_mask = action_mask;
+  arg.output_entry = NULL;
+  arg.output_repo = NULL;
+#if defined(DISTRIBUTED)
+  arg.remote_deps = deps;
+#endif  /* defined(DISTRIBUTED) */
+  assert(NULL != es);
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS )    arg.ready_lists = alloca(sizeof(parsec_task_t *) * es->virtual_process->parsec_context->nb_vp);
+  else
+    arg.ready_lists = NULL;
+  for( __vp_id = 0; __vp_id < es->virtual_process->parsec_context->nb_vp; arg.ready_lists[__vp_id++] = NULL );
+  (void)__parsec_tp; (void)deps;
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_T.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_T.source_repo, this_task->data._f_T.source_repo_entry->ht_item.key );
+    }
+  }
+  consume_local_repo = (this_task->repo_entry != NULL);
+  arg.output_repo = LINE_TERMINATOR_repo;
+  arg.output_entry = this_task->repo_entry;
+  arg.output_usage = 0;
+  if( action_mask & (PARSEC_ACTION_RELEASE_LOCAL_DEPS | PARSEC_ACTION_GET_REPO_ENTRY) ) {
+    arg.output_entry = data_repo_lookup_entry_and_create( es, arg.output_repo, __jdf2c_make_key_LINE_TERMINATOR((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    arg.output_entry->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(arg.output_entry->sim_exec_date == 0);
+    arg.output_entry->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  if(action_mask & ( PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE ) ){
+    /* Generate the reshape promise for the outputs that need it */
+    iterate_successors_of_BT_reduction_LINE_TERMINATOR(es, this_task, action_mask, parsec_set_up_reshape_promise, &arg);
+   }
+  iterate_successors_of_BT_reduction_LINE_TERMINATOR(es, this_task, action_mask, parsec_release_dep_fct, &arg);
+
+#if defined(DISTRIBUTED)
+  if( (action_mask & PARSEC_ACTION_SEND_REMOTE_DEPS) && (NULL != arg.remote_deps)) {
+    parsec_remote_dep_activate(es, (parsec_task_t *)this_task, arg.remote_deps, arg.remote_deps->outgoing_mask);
+  }
+#endif
+
+  if(action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS) {
+    data_repo_entry_addto_usage_limit(LINE_TERMINATOR_repo, arg.output_entry->ht_item.key, arg.output_usage);
+    __parsec_schedule_vp(es, arg.ready_lists, 0);
+  }
+      if (consume_local_repo) {
+         data_repo_entry_used_once( LINE_TERMINATOR_repo, this_task->repo_entry->ht_item.key );
+      }
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_T.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_T.data_in);
+    }
+  }
+  PARSEC_PINS(es, RELEASE_DEPS_END, (parsec_task_t *)this_task);  return 0;
+}
+
+static int data_lookup_of_BT_reduction_LINE_TERMINATOR(parsec_execution_stream_t *es, __parsec_BT_reduction_LINE_TERMINATOR_task_t *this_task)
+{
+  const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp = (__parsec_BT_reduction_internal_taskpool_t *)this_task->taskpool;
+  parsec_assignment_t generic_locals[MAX_PARAM_COUNT];  /* generic task locals */
+  int target_device = 0; (void)target_device;
+  (void)__parsec_tp; (void)generic_locals; (void)es;
+  parsec_data_copy_t *chunk = NULL;
+  data_repo_t        *reshape_repo  = NULL, *consumed_repo  = NULL;
+  data_repo_entry_t  *reshape_entry = NULL, *consumed_entry = NULL;
+  parsec_key_t        reshape_entry_key = 0, consumed_entry_key = 0;
+  uint8_t             consumed_flow_index;
+  parsec_dep_data_description_t data;
+  int ret;
+  (void)reshape_repo; (void)reshape_entry; (void)reshape_entry_key;
+  (void)consumed_repo; (void)consumed_entry; (void)consumed_entry_key;
+  (void)consumed_flow_index;
+  (void)chunk; (void)data; (void)ret;
+  const int j = this_task->locals.j.value; (void)j;
+  const int tree_count = this_task->locals.tree_count.value; (void)tree_count;
+  const int i = this_task->locals.i.value; (void)i;
+  const int offset = this_task->locals.offset.value; (void)offset;
+  if( NULL == this_task->repo_entry ){
+    this_task->repo_entry = data_repo_lookup_entry_and_create(es, LINE_TERMINATOR_repo,                                       __jdf2c_make_key_LINE_TERMINATOR((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    data_repo_entry_addto_usage_limit(LINE_TERMINATOR_repo, this_task->repo_entry->ht_item.key, 1);    this_task->repo_entry ->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(this_task->repo_entry ->sim_exec_date == 0);
+    this_task->repo_entry ->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  /* The reshape repo is the current task repo. */  reshape_repo = LINE_TERMINATOR_repo;
+  reshape_entry_key = __jdf2c_make_key_LINE_TERMINATOR((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals) ;
+  reshape_entry = this_task->repo_entry;
+  /* Lookup the input data, and store them in the context if any */
+
+if(! this_task->data._f_T.fulfill ){ /* Flow T */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_T.data_out = NULL;  /* By default, if nothing matches */
+    /* Flow T [0] dependency [0] pure output data  */
+    if( NULL == (chunk = this_task->data._f_T.data_in) ) {
+       /* No data set up by predecessor */
+      chunk = parsec_arena_get_copy(PARSEC_BT_reduction_DEFAULT_ADT->arena, 1, target_device, PARSEC_BT_reduction_DEFAULT_ADT->opaque_dtt);
+      chunk->original->owner_device = target_device;
+      this_task->data._f_T.data_out = chunk;
+    }
+    this_task->data._f_T.data_in     = chunk;
+    this_task->data._f_T.source_repo       = consumed_repo;
+    this_task->data._f_T.source_repo_entry = consumed_entry;
+    if( this_task->data._f_T.source_repo_entry == this_task->repo_entry ){
+      /* in case we have consume from this task repo entry for the flow,
+       * it is cleaned up, avoiding having old stuff during release_deps_of
+       */
+      this_task->repo_entry->data[0] = NULL;
+    }
+    this_task->data._f_T.fulfill = 1;
+}
+
+  /** Generate profiling information */
+#if defined(PARSEC_PROF_TRACE)
+  this_task->prof_info.desc = (parsec_data_collection_t*)__parsec_tp->super._g_dataA;
+  this_task->prof_info.priority = this_task->priority;
+  this_task->prof_info.data_id   = ((parsec_data_collection_t*)__parsec_tp->super._g_dataA)->data_key((parsec_data_collection_t*)__parsec_tp->super._g_dataA, offset, 0);
+  this_task->prof_info.task_class_id = this_task->task_class->task_class_id;
+  this_task->prof_info.task_return_code = -1;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int datatype_lookup_of_BT_reduction_LINE_TERMINATOR(parsec_execution_stream_t *es, const parsec_task_t *this_generic_task, const parsec_task_t *parent_task,
+              uint32_t* flow_mask, parsec_dep_data_description_t* data)
+{
+  const __parsec_BT_reduction_LINE_TERMINATOR_task_t *this_task = (__parsec_BT_reduction_LINE_TERMINATOR_task_t*)this_generic_task;
+  const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp = (__parsec_BT_reduction_internal_taskpool_t *)this_task->taskpool;
+  (void)__parsec_tp; (void)es; (void)this_task; (void)data; (void)parent_task;
+  const int j = this_task->locals.j.value; (void)j;
+  const int tree_count = this_task->locals.tree_count.value; (void)tree_count;
+  const int i = this_task->locals.i.value; (void)i;
+  const int offset = this_task->locals.offset.value; (void)offset;
+  data->local.arena = data->remote.arena = NULL;
+  data->local.src_datatype  = data->local.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->local.src_count     = data->local.dst_count = 0;
+  data->local.src_displ     = data->local.dst_displ = 0;
+  data->data_future  = NULL;
+
+  /* these are the output dependencies remote datatypes */
+if( (*flow_mask) & 0x1U ) {  /* Flow T */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_BT_reduction_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_BT_reduction_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_BT_reduction_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+  data->data                             = NULL;
+  data->remote.src_datatype = data->remote.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->remote.src_count    = data->remote.dst_count = 0;
+  data->remote.src_displ    = data->remote.dst_displ = 0;
+  data->data_future  = NULL;
+  (*flow_mask) = 0;  /* nothing left */
+  (void)j;  (void)tree_count;  (void)i;  (void)offset;
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+static int hook_of_BT_reduction_LINE_TERMINATOR(parsec_execution_stream_t *es, __parsec_BT_reduction_LINE_TERMINATOR_task_t *this_task)
+{
+  __parsec_BT_reduction_internal_taskpool_t *__parsec_tp = (__parsec_BT_reduction_internal_taskpool_t *)this_task->taskpool;
+  (void)es; (void)__parsec_tp;
+  const int j = this_task->locals.j.value; (void)j;
+  const int tree_count = this_task->locals.tree_count.value; (void)tree_count;
+  const int i = this_task->locals.i.value; (void)i;
+  const int offset = this_task->locals.offset.value; (void)offset;
+  (void)j;  (void)tree_count;  (void)i;  (void)offset;
+
+  /** Declare the variables that will hold the data, and all the accounting for each */
+  parsec_data_copy_t *_f_T = this_task->data._f_T.data_in;
+  void *T = PARSEC_DATA_COPY_GET_PTR(_f_T); (void)T;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    data_repo_entry_t *eT = this_task->data._f_T.source_repo_entry;
+    if( (NULL != eT) && (eT->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eT->sim_exec_date;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+    if ( NULL != _f_T ) {
+#if defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) || defined(PARSEC_HAVE_DEV_HIP_SUPPORT)
+      parsec_data_transfer_ownership_to_copy( _f_T->original, 0 /* device */,
+                                           PARSEC_FLOW_ACCESS_WRITE);
+#endif  /* defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) || defined(PARSEC_HAVE_DEV_HIP_SUPPORT) */
+      _f_T->version++;  /* T */
+#if defined(PARSEC_DEBUG_NOISIER)
+      char tmp[128];
+      PARSEC_DEBUG_VERBOSE(10, parsec_debug_output,
+                           "Body of %s: change Data copy %p to version %d",
+                           parsec_task_snprintf(tmp, 128, (parsec_task_t*)(this_task)),
+                           _f_T, _f_T->version);
+#endif /* defined(PARSEC_DEBUG_NOISIER) */
+    }
+  /** Cache Awareness Accounting */
+#if defined(PARSEC_CACHE_AWARENESS)
+  cache_buf_referenced(es->closest_cache, T);
+#endif /* PARSEC_CACHE_AWARENESS */
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                              LINE_TERMINATOR BODY                              -----*/
+
+ /* nothing */
+
+
+/*-----                          END OF LINE_TERMINATOR BODY                          -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#endif  /*  defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+static int complete_hook_of_BT_reduction_LINE_TERMINATOR(parsec_execution_stream_t *es, __parsec_BT_reduction_LINE_TERMINATOR_task_t *this_task)
+{
+  const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp = (__parsec_BT_reduction_internal_taskpool_t *)this_task->taskpool;
+#if defined(DISTRIBUTED)
+    const int j = this_task->locals.j.value; (void)j;
+  const int tree_count = this_task->locals.tree_count.value; (void)tree_count;
+  const int i = this_task->locals.i.value; (void)i;
+  const int offset = this_task->locals.offset.value; (void)offset;
+#endif  /* defined(DISTRIBUTED) */
+  (void)es; (void)__parsec_tp;
+parsec_data_t* data_t_desc = NULL; (void)data_t_desc;
+#if defined(DISTRIBUTED)
+  /** If not working on distributed, there is no risk that data is not in place */
+  (void)j;  (void)tree_count;  (void)i;  (void)offset;
+
+#endif /* DISTRIBUTED */
+#if defined(PARSEC_PROF_GRAPHER)
+  parsec_prof_grapher_task((parsec_task_t*)this_task, es->th_id, es->virtual_process->vp_id,
+     __jdf2c_key_fns_LINE_TERMINATOR.key_hash(this_task->task_class->make_key( (parsec_taskpool_t*)this_task->taskpool, ((parsec_task_t*)this_task)->locals), NULL));
+#endif  /* defined(PARSEC_PROF_GRAPHER) */
+  release_deps_of_BT_reduction_LINE_TERMINATOR(es, this_task,
+      PARSEC_ACTION_RELEASE_REMOTE_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_REFS |
+      PARSEC_ACTION_RESHAPE_ON_RELEASE |
+      0x1,  /* mask of all dep_index */ 
+      NULL);
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static parsec_hook_return_t release_task_of_BT_reduction_LINE_TERMINATOR(parsec_execution_stream_t *es, parsec_task_t *this_task)
+{
+    const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp =
+        (const __parsec_BT_reduction_internal_taskpool_t *)this_task->taskpool;
+    parsec_hash_table_t *ht = (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[3];
+    parsec_key_t key = this_task->task_class->make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals);
+    parsec_hashable_dependency_t *hash_dep = (parsec_hashable_dependency_t *)parsec_hash_table_remove(ht, key);
+    parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);
+    return parsec_release_task_to_mempool_update_nbtasks(es, this_task);
+}
+
+static char *BT_reduction_BT_reduction_LINE_TERMINATOR_internal_init_deps_key_functions_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_BT_reduction_internal_taskpool_t *__parsec_tp = (__parsec_BT_reduction_internal_taskpool_t *)user_data;
+  __parsec_BT_reduction_LINE_TERMINATOR_parsec_assignment_t __jdf2c__assignments = {  .j.value = 0, .tree_count.value = 0, .i.value = 0, .offset.value = 0 };
+  int j = (__parsec_key) % __parsec_tp->LINE_TERMINATOR_j_range + __parsec_tp->LINE_TERMINATOR_j_min;
+  __parsec_key = __parsec_key / __parsec_tp->LINE_TERMINATOR_j_range;
+  __jdf2c__assignments.j.value = j;
+  int tree_count = BT_reduction_LINE_TERMINATOR_inline_c_expr2_line_192(__parsec_tp, &__jdf2c__assignments);
+  (void)tree_count;
+  __jdf2c__assignments.tree_count.value = tree_count;
+  int i = tree_count;
+  (void)i;
+  __jdf2c__assignments.i.value = i;
+  int offset = BT_reduction_LINE_TERMINATOR_inline_c_expr1_line_194(__parsec_tp, &__jdf2c__assignments);
+  (void)offset;
+  __jdf2c__assignments.offset.value = offset;
+  (void)__jdf2c__assignments;
+  snprintf(buffer, buffer_size, "LINE_TERMINATOR(%d)", j);
+  return buffer;
+}
+
+static parsec_key_fn_t BT_reduction_BT_reduction_LINE_TERMINATOR_internal_init_deps_key_functions = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = BT_reduction_BT_reduction_LINE_TERMINATOR_internal_init_deps_key_functions_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/* Needs: min-max count-tasks iterate */
+static int BT_reduction_LINE_TERMINATOR_internal_init(parsec_execution_stream_t * es, __parsec_BT_reduction_LINE_TERMINATOR_task_t * this_task)
+{
+  __parsec_BT_reduction_internal_taskpool_t *__parsec_tp = (__parsec_BT_reduction_internal_taskpool_t*)this_task->taskpool;
+  int32_t nb_tasks = 0, saved_nb_tasks = 0;
+int32_t __j_min = 0x7fffffff, __j_max = 0;int32_t __jdf2c_j_min = 0x7fffffff, __jdf2c_j_max = 0;  __parsec_BT_reduction_LINE_TERMINATOR_parsec_assignment_t assignments = {  .j.value = 0, .tree_count.value = 0, .i.value = 0, .offset.value = 0 };
+  int32_t  j,  tree_count,  i,  offset;
+  int32_t __jdf2c_j_start, __jdf2c_j_end, __jdf2c_j_inc;
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+  PARSEC_PROFILING_TRACE(es->es_profile,
+                         this_task->taskpool->profiling_array[START_KEY(this_task->task_class->task_class_id)],
+                         0,
+                         this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    __jdf2c_j_start = 0;
+    __jdf2c_j_end = 0;
+    __jdf2c_j_inc = 1;
+    __j_min = parsec_imin(__jdf2c_j_start, __jdf2c_j_end);
+    __j_max = parsec_imax(__jdf2c_j_start, __jdf2c_j_end);
+    __jdf2c_j_min = parsec_imin(__jdf2c_j_min, __j_min);
+    __jdf2c_j_max = parsec_imax(__jdf2c_j_max, __j_max);
+    for(j =  __jdf2c_j_start;
+        j <= __jdf2c_j_end;
+        j += __jdf2c_j_inc) {
+    assignments.j.value = j;
+  {  /* block for the non-range variable tree_count */
+      tree_count = BT_reduction_LINE_TERMINATOR_inline_c_expr2_line_192(__parsec_tp, &assignments);
+      assignments.tree_count.value = tree_count;
+    {  /* block for the non-range variable i */
+        i = tree_count;
+        assignments.i.value = i;
+      {  /* block for the non-range variable offset */
+          offset = BT_reduction_LINE_TERMINATOR_inline_c_expr1_line_194(__parsec_tp, &assignments);
+          assignments.offset.value = offset;
+          if( !LINE_TERMINATOR_pred(j, tree_count, i, offset) ) continue;
+          nb_tasks++;
+        } /* block for the non-range variable offset */ 
+      } /* block for the non-range variable i */ 
+    } /* block for the non-range variable tree_count */ 
+  } /* Loop on normal range j */
+   if( 0 != nb_tasks ) {
+     (void)parsec_atomic_fetch_add_int32(&__parsec_tp->initial_number_tasks, nb_tasks);
+   }
+  /* Set the range variables for the collision-free hash-computation */
+  __parsec_tp->LINE_TERMINATOR_j_min   = __jdf2c_j_min;
+  __parsec_tp->LINE_TERMINATOR_j_range = (__jdf2c_j_max - __jdf2c_j_min) + 1;
+    do {
+      this_task->super.list_next = (parsec_list_item_t*)__parsec_tp->startup_queue;
+    } while(!parsec_atomic_cas_ptr(&__parsec_tp->startup_queue, (parsec_list_item_t*)this_task->super.list_next, this_task));
+    this_task->status = PARSEC_TASK_STATUS_HOOK;
+
+  PARSEC_AYU_REGISTER_TASK(&BT_reduction_LINE_TERMINATOR);
+  __parsec_tp->super.super.dependencies_array[3] = PARSEC_OBJ_NEW(parsec_hash_table_t);
+  parsec_hash_table_init(__parsec_tp->super.super.dependencies_array[3], offsetof(parsec_hashable_dependency_t, ht_item), 10, BT_reduction_BT_reduction_LINE_TERMINATOR_internal_init_deps_key_functions, this_task->taskpool);
+  __parsec_tp->repositories[3] = data_repo_create_nothreadsafe(nb_tasks, __jdf2c_key_fns_LINE_TERMINATOR, (parsec_taskpool_t*)__parsec_tp, 1);
+(void)saved_nb_tasks;
+(void)__j_min; (void)__j_max;  (void)__jdf2c_j_start; (void)__jdf2c_j_end; (void)__jdf2c_j_inc;  (void)assignments; (void)__parsec_tp; (void)es;
+  if(1 == parsec_atomic_fetch_dec_int32(&__parsec_tp->sync_point)) {
+    /* Last initialization task complete. Update the number of tasks. */
+    __parsec_tp->super.super.tdm.module->taskpool_addto_nb_tasks(&__parsec_tp->super.super, __parsec_tp->initial_number_tasks);
+    parsec_mfence();  /* write memory barrier to guarantee that the scheduler gets the correct number of tasks */
+    parsec_taskpool_enable((parsec_taskpool_t*)__parsec_tp, &__parsec_tp->startup_queue,
+                           (parsec_task_t*)this_task, es, __parsec_tp->super.super.nb_pending_actions);
+    __parsec_tp->super.super.tdm.module->taskpool_ready(&__parsec_tp->super.super);
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+    PARSEC_PROFILING_TRACE(es->es_profile,
+                           this_task->taskpool->profiling_array[2 * this_task->task_class->task_class_id + 1],
+                           0,
+                           this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    if( 1 >= __parsec_tp->super.super.nb_pending_actions ) {
+        /* if no tasks will be generated let's prevent the runtime from calling the hook and instead go directly to complete the task */
+        this_task->status = PARSEC_TASK_STATUS_COMPLETE;
+    }
+    return PARSEC_HOOK_RETURN_DONE;
+  }
+  return PARSEC_HOOK_RETURN_ASYNC;
+}
+
+static int __jdf2c_startup_LINE_TERMINATOR(parsec_execution_stream_t * es, __parsec_BT_reduction_LINE_TERMINATOR_task_t *this_task)
+{
+  __parsec_BT_reduction_LINE_TERMINATOR_task_t* new_task;
+  __parsec_BT_reduction_internal_taskpool_t* __parsec_tp = (__parsec_BT_reduction_internal_taskpool_t*)this_task->taskpool;
+  parsec_context_t *context = __parsec_tp->super.super.context;
+  int vpid = 0, nb_tasks = 0;
+  size_t total_nb_tasks = 0;
+  parsec_list_item_t* pready_ring[context->nb_vp];
+  int restore_context = 0;
+  int j = this_task->locals.j.value;  /* retrieve value saved during the last iteration */
+  int tree_count = this_task->locals.tree_count.value;  /* retrieve value saved during the last iteration */
+  int i = this_task->locals.i.value;  /* retrieve value saved during the last iteration */
+  int offset = this_task->locals.offset.value;  /* retrieve value saved during the last iteration */
+  for(int _i = 0; _i < context->nb_vp; pready_ring[_i++] = NULL );
+  if( 0 != this_task->locals.reserved[0].value ) {
+    this_task->locals.reserved[0].value = 1; /* reset the submission process */
+    restore_context = 1;
+    goto restore_context_0;
+  }
+  this_task->locals.reserved[0].value = 1; /* a sane default value */
+  for(this_task->locals.j.value = j = 0;
+      this_task->locals.j.value <= 0;
+      this_task->locals.j.value += 1, j = this_task->locals.j.value) {
+    this_task->locals.tree_count.value = tree_count = BT_reduction_LINE_TERMINATOR_inline_c_expr2_line_192(__parsec_tp, &this_task->locals);
+    this_task->locals.i.value = i = tree_count;
+    this_task->locals.offset.value = offset = BT_reduction_LINE_TERMINATOR_inline_c_expr1_line_194(__parsec_tp, &this_task->locals);
+    if( !LINE_TERMINATOR_pred(j, tree_count, i, offset) ) continue;
+  __parsec_BT_reduction_LINE_TERMINATOR_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_BT_reduction_LINE_TERMINATOR_parsec_assignment_t*)&this_task->locals;
+  (void)__jdf2c__tmp_locals;
+    if( NULL != ((parsec_data_collection_t*)__parsec_tp->super._g_dataA)->vpid_of ) {
+      vpid = ((parsec_data_collection_t*)__parsec_tp->super._g_dataA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_dataA, offset, 0);
+      assert(context->nb_vp >= vpid);
+    } else {
+      vpid = (vpid + 1) % context->nb_vp;  /* spread the initial joy */
+    }
+    new_task = (__parsec_BT_reduction_LINE_TERMINATOR_task_t*)parsec_thread_mempool_allocate( context->virtual_processes[vpid]->execution_streams[0]->context_mempool );
+    PARSEC_OBJ_CONSTRUCT(new_task, parsec_task_t); /* construct called only when new, force-construct it again */
+    /* Copy only the valid elements from this_task to new_task one */
+    new_task->taskpool   = this_task->taskpool;
+    new_task->task_class = __parsec_tp->super.super.task_classes_array[BT_reduction_LINE_TERMINATOR.task_class_id];
+    new_task->chore_mask   = PARSEC_DEV_ALL;
+    new_task->locals.j.value = this_task->locals.j.value;
+    new_task->locals.tree_count.value = this_task->locals.tree_count.value;
+    new_task->locals.i.value = this_task->locals.i.value;
+    new_task->locals.offset.value = this_task->locals.offset.value;
+    PARSEC_LIST_ITEM_SINGLETON(new_task);
+    new_task->priority = __parsec_tp->super.super.priority;
+    new_task->repo_entry = NULL;
+    new_task->data._f_T.source_repo_entry = NULL;
+    new_task->data._f_T.source_repo       = NULL;
+    new_task->data._f_T.data_in         = NULL;
+    new_task->data._f_T.data_out        = NULL;
+    new_task->data._f_T.fulfill         = 0;
+#if defined(PARSEC_DEBUG_NOISIER)
+    {
+      char tmp[128];
+      PARSEC_DEBUG_VERBOSE(10, parsec_debug_output, "Add startup task %s to vpid %d",
+             parsec_task_snprintf(tmp, 128, (parsec_task_t*)new_task), vpid);
+    }
+#endif
+    parsec_dependencies_mark_task_as_startup((parsec_task_t*)new_task, es);
+    pready_ring[vpid] = parsec_list_item_ring_push_sorted(pready_ring[vpid],
+                                                          (parsec_list_item_t*)new_task,
+                                                          parsec_execution_context_priority_comparator);
+    nb_tasks++;
+   restore_context_0:  /* we jump here just so that we have code after the label */
+    restore_context = 0;
+    (void)restore_context;
+    if( nb_tasks > this_task->locals.reserved[0].value ) {
+      if( (size_t)this_task->locals.reserved[0].value < parsec_task_startup_iter ) this_task->locals.reserved[0].value <<= 1;
+      __parsec_schedule_vp(es, (parsec_task_t**)pready_ring, 0);
+      total_nb_tasks += nb_tasks;
+      nb_tasks = 0;
+      if( total_nb_tasks > parsec_task_startup_chunk ) {  /* stop here and request to be rescheduled */
+        return PARSEC_HOOK_RETURN_AGAIN;
+      }
+    }
+  } /* Loop on normal range j */
+  (void)vpid;
+  if( 0 != nb_tasks ) {
+    __parsec_schedule_vp(es, (parsec_task_t**)pready_ring, 0);
+    nb_tasks = 0;
+  }
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static const __parsec_chore_t __BT_reduction_LINE_TERMINATOR_chores[] ={
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+    { .type     = PARSEC_DEV_CPU,
+      .evaluate = (parsec_evaluate_function_t*)NULL,
+      .hook     = (parsec_hook_t*)hook_of_BT_reduction_LINE_TERMINATOR },
+#endif  /* defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+    { .type     = PARSEC_DEV_NONE,
+      .evaluate = NULL,
+      .hook     = (parsec_hook_t*)NULL },  /* End marker */
+};
+
+static const parsec_task_class_t BT_reduction_LINE_TERMINATOR = {
+  .name = "LINE_TERMINATOR",
+  .task_class_id = 3,
+  .nb_flows = 1,
+  .nb_parameters = 1,
+  .nb_locals = 4,
+  .task_class_type = PARSEC_TASK_CLASS_TYPE_PTG,
+  .params = { &symb_BT_reduction_LINE_TERMINATOR_j, NULL },
+  .locals = { &symb_BT_reduction_LINE_TERMINATOR_j, &symb_BT_reduction_LINE_TERMINATOR_tree_count, &symb_BT_reduction_LINE_TERMINATOR_i, &symb_BT_reduction_LINE_TERMINATOR_offset, NULL },
+  .data_affinity = (parsec_data_ref_fn_t*)affinity_of_BT_reduction_LINE_TERMINATOR,
+  .initial_data = (parsec_data_ref_fn_t*)affinity_of_BT_reduction_LINE_TERMINATOR,
+  .final_data = (parsec_data_ref_fn_t*)affinity_of_BT_reduction_LINE_TERMINATOR,
+  .priority = NULL,
+  .properties = properties_of_BT_reduction_LINE_TERMINATOR,
+#if MAX_PARAM_COUNT < 0  /* number of read flows of LINE_TERMINATOR */
+  #error Too many read flows for task LINE_TERMINATOR
+#endif  /* MAX_PARAM_COUNT */
+#if MAX_PARAM_COUNT < 1  /* number of write flows of LINE_TERMINATOR */
+  #error Too many write flows for task LINE_TERMINATOR
+#endif  /* MAX_PARAM_COUNT */
+  .in = { NULL },
+  .out = { &flow_of_BT_reduction_LINE_TERMINATOR_for_T, NULL },
+  .flags = 0x0 | PARSEC_USE_DEPS_MASK,
+  .dependencies_goal = 0x0,
+  .make_key = __jdf2c_make_key_LINE_TERMINATOR,
+  .task_snprintf = parsec_task_snprintf,
+#if defined(PARSEC_PROF_TRACE)
+  .profile_info = &parsec_task_profile_info,
+#endif
+  .key_functions = &__jdf2c_key_fns_LINE_TERMINATOR,
+  .fini = (parsec_hook_t*)NULL,
+  .incarnations = __BT_reduction_LINE_TERMINATOR_chores,
+  .find_deps = parsec_hash_find_deps,
+  .update_deps = parsec_update_deps_with_mask,
+  .iterate_successors = (parsec_traverse_function_t*)iterate_successors_of_BT_reduction_LINE_TERMINATOR,
+  .iterate_predecessors = (parsec_traverse_function_t*)NULL,
+  .release_deps = (parsec_release_deps_t*)release_deps_of_BT_reduction_LINE_TERMINATOR,
+  .prepare_output = (parsec_hook_t*)NULL,
+  .prepare_input = (parsec_hook_t*)data_lookup_of_BT_reduction_LINE_TERMINATOR,
+  .time_estimate = NULL,
+  .get_datatype = datatype_lookup_of_BT_reduction_LINE_TERMINATOR,
+  .complete_execution = (parsec_hook_t*)complete_hook_of_BT_reduction_LINE_TERMINATOR,
+  .release_task = &release_task_of_BT_reduction_LINE_TERMINATOR,
+#if defined(PARSEC_SIM)
+  .sim_cost_fct = (parsec_sim_cost_fct_t*)NULL,
+#endif
+};
+
+
+/******                                  LINEAR_REDUC                                  ******/
+
+static inline int32_t expr_of_symb_BT_reduction_LINEAR_REDUC_tree_count_fct(const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp, const __parsec_BT_reduction_LINEAR_REDUC_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return BT_reduction_LINEAR_REDUC_inline_c_expr5_line_157(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_BT_reduction_LINEAR_REDUC_tree_count = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_BT_reduction_LINEAR_REDUC_tree_count_fct }
+                   }
+};
+static const parsec_symbol_t symb_BT_reduction_LINEAR_REDUC_tree_count = { .name = "tree_count", .context_index = 0, .min = &expr_of_symb_BT_reduction_LINEAR_REDUC_tree_count, .max = &expr_of_symb_BT_reduction_LINEAR_REDUC_tree_count, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t minexpr_of_symb_BT_reduction_LINEAR_REDUC_i_fct(const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp, const __parsec_BT_reduction_LINEAR_REDUC_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 1;
+}
+static const parsec_expr_t minexpr_of_symb_BT_reduction_LINEAR_REDUC_i = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_BT_reduction_LINEAR_REDUC_i_fct }
+                   }
+};
+static inline int maxexpr_of_symb_BT_reduction_LINEAR_REDUC_i_fct(const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp, const __parsec_BT_reduction_LINEAR_REDUC_parsec_assignment_t *locals)
+{
+  const int tree_count = locals->tree_count.value;
+  const int i = locals->i.value; (void)i;
+  const int sz = locals->sz.value; (void)sz;
+  const int offset = locals->offset.value; (void)offset;
+
+  (void)tree_count;
+  (void)i;
+  (void)sz;
+  (void)offset;
+  (void)__parsec_tp; (void)locals;
+  return tree_count;
+}
+static const parsec_expr_t maxexpr_of_symb_BT_reduction_LINEAR_REDUC_i = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_BT_reduction_LINEAR_REDUC_i_fct }
+                   }
+};
+static const parsec_symbol_t symb_BT_reduction_LINEAR_REDUC_i = { .name = "i", .context_index = 1, .min = &minexpr_of_symb_BT_reduction_LINEAR_REDUC_i, .max = &maxexpr_of_symb_BT_reduction_LINEAR_REDUC_i, .cst_inc = 1, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_BT_reduction_LINEAR_REDUC_sz_fct(const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp, const __parsec_BT_reduction_LINEAR_REDUC_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return BT_reduction_LINEAR_REDUC_inline_c_expr4_line_159(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_BT_reduction_LINEAR_REDUC_sz = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_BT_reduction_LINEAR_REDUC_sz_fct }
+                   }
+};
+static const parsec_symbol_t symb_BT_reduction_LINEAR_REDUC_sz = { .name = "sz", .context_index = 2, .min = &expr_of_symb_BT_reduction_LINEAR_REDUC_sz, .max = &expr_of_symb_BT_reduction_LINEAR_REDUC_sz, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_BT_reduction_LINEAR_REDUC_offset_fct(const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp, const __parsec_BT_reduction_LINEAR_REDUC_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return BT_reduction_LINEAR_REDUC_inline_c_expr3_line_160(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_BT_reduction_LINEAR_REDUC_offset = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_BT_reduction_LINEAR_REDUC_offset_fct }
+                   }
+};
+static const parsec_symbol_t symb_BT_reduction_LINEAR_REDUC_offset = { .name = "offset", .context_index = 3, .min = &expr_of_symb_BT_reduction_LINEAR_REDUC_offset, .max = &expr_of_symb_BT_reduction_LINEAR_REDUC_offset, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int affinity_of_BT_reduction_LINEAR_REDUC(const __parsec_BT_reduction_LINEAR_REDUC_task_t *this_task,
+                     parsec_data_ref_t *ref)
+{
+    const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp = (const __parsec_BT_reduction_internal_taskpool_t*)this_task->taskpool;
+  const int tree_count = this_task->locals.tree_count.value; (void)tree_count;
+  const int i = this_task->locals.i.value; (void)i;
+  const int sz = this_task->locals.sz.value; (void)sz;
+  const int offset = this_task->locals.offset.value; (void)offset;
+
+  /* Silent Warnings: should look into predicate to know what variables are usefull */
+  (void)tree_count;
+  (void)i;
+  (void)sz;
+  (void)offset;
+  ref->dc = (parsec_data_collection_t *)__parsec_tp->super._g_dataA;
+  /* Compute data key */
+  ref->key = ref->dc->data_key(ref->dc, offset, 0);
+  return 1;
+}
+static const parsec_property_t properties_of_BT_reduction_LINEAR_REDUC[1] = {
+  {.name = NULL, .expr = NULL}
+};
+static inline int expr_of_cond_for_flow_of_BT_reduction_LINEAR_REDUC_for_C_dep1_atline_166_fct(const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp, const __parsec_BT_reduction_LINEAR_REDUC_parsec_assignment_t *locals)
+{
+  const int tree_count = locals->tree_count.value; (void)tree_count;
+  const int i = locals->i.value; (void)i;
+  const int sz = locals->sz.value;
+  const int offset = locals->offset.value; (void)offset;
+
+  (void)tree_count;
+  (void)i;
+  (void)sz;
+  (void)offset;
+  (void)__parsec_tp; (void)locals;
+  return (0) == (sz);
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_BT_reduction_LINEAR_REDUC_for_C_dep1_atline_166 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_BT_reduction_LINEAR_REDUC_for_C_dep1_atline_166_fct }
+                   }
+};
+static const parsec_dep_t flow_of_BT_reduction_LINEAR_REDUC_for_C_dep1_atline_166 = {
+  .cond = &expr_of_cond_for_flow_of_BT_reduction_LINEAR_REDUC_for_C_dep1_atline_166,  /* (0) == (sz) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 0, /* BT_reduction_REDUCTION */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_BT_reduction_REDUCTION_for_A,
+  .dep_index = 2,
+  .dep_datatype_index = 2,
+  .belongs_to = &flow_of_BT_reduction_LINEAR_REDUC_for_C,
+};
+static inline int expr_of_cond_for_flow_of_BT_reduction_LINEAR_REDUC_for_C_dep2_atline_167_fct(const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp, const __parsec_BT_reduction_LINEAR_REDUC_parsec_assignment_t *locals)
+{
+  const int tree_count = locals->tree_count.value; (void)tree_count;
+  const int i = locals->i.value; (void)i;
+  const int sz = locals->sz.value;
+  const int offset = locals->offset.value; (void)offset;
+
+  (void)tree_count;
+  (void)i;
+  (void)sz;
+  (void)offset;
+  (void)__parsec_tp; (void)locals;
+  return (0) < (sz);
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_BT_reduction_LINEAR_REDUC_for_C_dep2_atline_167 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_BT_reduction_LINEAR_REDUC_for_C_dep2_atline_167_fct }
+                   }
+};
+static const parsec_dep_t flow_of_BT_reduction_LINEAR_REDUC_for_C_dep2_atline_167 = {
+  .cond = &expr_of_cond_for_flow_of_BT_reduction_LINEAR_REDUC_for_C_dep2_atline_167,  /* (0) < (sz) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 1, /* BT_reduction_BT_REDUC */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_BT_reduction_BT_REDUC_for_B,
+  .dep_index = 3,
+  .dep_datatype_index = 2,
+  .belongs_to = &flow_of_BT_reduction_LINEAR_REDUC_for_C,
+};
+static inline int expr_of_cond_for_flow_of_BT_reduction_LINEAR_REDUC_for_C_dep3_atline_168_fct(const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp, const __parsec_BT_reduction_LINEAR_REDUC_parsec_assignment_t *locals)
+{
+  const int tree_count = locals->tree_count.value; (void)tree_count;
+  const int i = locals->i.value;
+  const int sz = locals->sz.value; (void)sz;
+  const int offset = locals->offset.value; (void)offset;
+
+  (void)tree_count;
+  (void)i;
+  (void)sz;
+  (void)offset;
+  (void)__parsec_tp; (void)locals;
+  return (1) < (i);
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_BT_reduction_LINEAR_REDUC_for_C_dep3_atline_168 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_BT_reduction_LINEAR_REDUC_for_C_dep3_atline_168_fct }
+                   }
+};
+static const parsec_dep_t flow_of_BT_reduction_LINEAR_REDUC_for_C_dep3_atline_168 = {
+  .cond = &expr_of_cond_for_flow_of_BT_reduction_LINEAR_REDUC_for_C_dep3_atline_168,  /* (1) < (i) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 2, /* BT_reduction_LINEAR_REDUC */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_BT_reduction_LINEAR_REDUC_for_B,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_BT_reduction_LINEAR_REDUC_for_C,
+};
+#if MAX_DEP_IN_COUNT < 2  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 2). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+#if MAX_DEP_OUT_COUNT < 1  /* number of output dependencies */
+    #error Too many output dependencies (supports up to MAX_DEP_OUT_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_OUT_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_BT_reduction_LINEAR_REDUC_for_C = {
+  .name               = "C",
+  .sym_type           = PARSEC_SYM_INOUT,
+  .flow_flags         = PARSEC_FLOW_ACCESS_RW,
+  .flow_index         = 0,
+  .flow_datatype_mask = 0x1,
+  .dep_in     = { &flow_of_BT_reduction_LINEAR_REDUC_for_C_dep1_atline_166,
+ &flow_of_BT_reduction_LINEAR_REDUC_for_C_dep2_atline_167 },
+  .dep_out    = { &flow_of_BT_reduction_LINEAR_REDUC_for_C_dep3_atline_168 }
+};
+
+static inline int expr_of_cond_for_flow_of_BT_reduction_LINEAR_REDUC_for_B_dep1_atline_164_fct(const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp, const __parsec_BT_reduction_LINEAR_REDUC_parsec_assignment_t *locals)
+{
+  const int tree_count = locals->tree_count.value; (void)tree_count;
+  const int i = locals->i.value; (void)i;
+  const int sz = locals->sz.value; (void)sz;
+  const int offset = locals->offset.value; (void)offset;
+
+  (void)tree_count;
+  (void)i;
+  (void)sz;
+  (void)offset;
+  (void)__parsec_tp; (void)locals;
+  return (tree_count) == (i);
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_BT_reduction_LINEAR_REDUC_for_B_dep1_atline_164 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_BT_reduction_LINEAR_REDUC_for_B_dep1_atline_164_fct }
+                   }
+};
+static const parsec_dep_t flow_of_BT_reduction_LINEAR_REDUC_for_B_dep1_atline_164 = {
+  .cond = &expr_of_cond_for_flow_of_BT_reduction_LINEAR_REDUC_for_B_dep1_atline_164,  /* (tree_count) == (i) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 3, /* BT_reduction_LINE_TERMINATOR */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_BT_reduction_LINE_TERMINATOR_for_T,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_BT_reduction_LINEAR_REDUC_for_B,
+};
+static inline int expr_of_cond_for_flow_of_BT_reduction_LINEAR_REDUC_for_B_dep2_atline_165_fct(const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp, const __parsec_BT_reduction_LINEAR_REDUC_parsec_assignment_t *locals)
+{
+  const int tree_count = locals->tree_count.value; (void)tree_count;
+  const int i = locals->i.value; (void)i;
+  const int sz = locals->sz.value; (void)sz;
+  const int offset = locals->offset.value; (void)offset;
+
+  (void)tree_count;
+  (void)i;
+  (void)sz;
+  (void)offset;
+  (void)__parsec_tp; (void)locals;
+  return (tree_count) > (i);
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_BT_reduction_LINEAR_REDUC_for_B_dep2_atline_165 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_BT_reduction_LINEAR_REDUC_for_B_dep2_atline_165_fct }
+                   }
+};
+static const parsec_dep_t flow_of_BT_reduction_LINEAR_REDUC_for_B_dep2_atline_165 = {
+  .cond = &expr_of_cond_for_flow_of_BT_reduction_LINEAR_REDUC_for_B_dep2_atline_165,  /* (tree_count) > (i) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 2, /* BT_reduction_LINEAR_REDUC */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_BT_reduction_LINEAR_REDUC_for_C,
+  .dep_index = 1,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_BT_reduction_LINEAR_REDUC_for_B,
+};
+#if MAX_DEP_IN_COUNT < 2  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 2). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_BT_reduction_LINEAR_REDUC_for_B = {
+  .name               = "B",
+  .sym_type           = PARSEC_SYM_IN,
+  .flow_flags         = PARSEC_FLOW_ACCESS_READ,
+  .flow_index         = 1,
+  .flow_datatype_mask = 0x0,
+  .dep_in     = { &flow_of_BT_reduction_LINEAR_REDUC_for_B_dep1_atline_164,
+ &flow_of_BT_reduction_LINEAR_REDUC_for_B_dep2_atline_165 },
+  .dep_out    = { NULL }
+};
+
+static void
+iterate_successors_of_BT_reduction_LINEAR_REDUC(parsec_execution_stream_t *es, const __parsec_BT_reduction_LINEAR_REDUC_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp = (const __parsec_BT_reduction_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_BT_reduction_LINEAR_REDUC_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_BT_reduction_LINEAR_REDUC_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int tree_count = __jdf2c__tmp_locals.tree_count.value; (void)tree_count;
+  const int i = __jdf2c__tmp_locals.i.value; (void)i;
+  const int sz = __jdf2c__tmp_locals.sz.value; (void)sz;
+  const int offset = __jdf2c__tmp_locals.offset.value; (void)offset;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)tree_count;  (void)i;  (void)sz;  (void)offset;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_dataA(offset, 0);
+#endif
+  if( action_mask & 0x1 ) {  /* Flow of data C [0] */
+    data.data   = this_task->data._f_C.data_out;
+    data.data_future  = NULL;
+    if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_BT_reduction_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_BT_reduction_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+       if( (1) < (i) ) {
+      __parsec_BT_reduction_LINEAR_REDUC_task_t* ncc = (__parsec_BT_reduction_LINEAR_REDUC_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[BT_reduction_LINEAR_REDUC.task_class_id];
+        const int LINEAR_REDUC_tree_count = BT_reduction_LINEAR_REDUC_inline_c_expr5_line_157(__parsec_tp, &ncc->locals);
+        assert(&nc.locals[0].value == &ncc->locals.tree_count.value);
+        ncc->locals.tree_count.value = LINEAR_REDUC_tree_count;
+        const int LINEAR_REDUC_i = (i - 1);
+        if( (LINEAR_REDUC_i >= (1)) && (LINEAR_REDUC_i <= (ncc->locals.tree_count.value)) ) {
+          assert(&nc.locals[1].value == &ncc->locals.i.value);
+          ncc->locals.i.value = LINEAR_REDUC_i;
+          const int LINEAR_REDUC_sz = BT_reduction_LINEAR_REDUC_inline_c_expr4_line_159(__parsec_tp, &ncc->locals);
+          assert(&nc.locals[2].value == &ncc->locals.sz.value);
+          ncc->locals.sz.value = LINEAR_REDUC_sz;
+          const int LINEAR_REDUC_offset = BT_reduction_LINEAR_REDUC_inline_c_expr3_line_160(__parsec_tp, &ncc->locals);
+          assert(&nc.locals[3].value == &ncc->locals.offset.value);
+          ncc->locals.offset.value = LINEAR_REDUC_offset;
+#if defined(DISTRIBUTED)
+          rank_dst = rank_of_dataA(ncc->locals.offset.value, 0);
+          if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+            vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_dataA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_dataA, ncc->locals.offset.value, 0);
+          nc.priority = __parsec_tp->super.super.priority;
+          successor_repo = LINEAR_REDUC_repo;
+          successor_repo_key = __jdf2c_make_key_LINEAR_REDUC((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+        RELEASE_DEP_OUTPUT(es, "C", this_task, "B", &nc, rank_src, rank_dst, &data);
+        if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_BT_reduction_LINEAR_REDUC_for_C_dep3_atline_168, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+          }
+    }
+  }
+  /* Flow of data B has only IN dependencies */
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static void
+iterate_predecessors_of_BT_reduction_LINEAR_REDUC(parsec_execution_stream_t *es, const __parsec_BT_reduction_LINEAR_REDUC_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp = (const __parsec_BT_reduction_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_BT_reduction_LINEAR_REDUC_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_BT_reduction_LINEAR_REDUC_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int tree_count = __jdf2c__tmp_locals.tree_count.value; (void)tree_count;
+  const int i = __jdf2c__tmp_locals.i.value; (void)i;
+  const int sz = __jdf2c__tmp_locals.sz.value; (void)sz;
+  const int offset = __jdf2c__tmp_locals.offset.value; (void)offset;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)tree_count;  (void)i;  (void)sz;  (void)offset;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_dataA(offset, 0);
+#endif
+  if( action_mask & 0xc ) {  /* Flow of data C [0] */
+    data.data   = this_task->data._f_C.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x4 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_BT_reduction_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_BT_reduction_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( (0) == (sz) ) {
+      __parsec_BT_reduction_REDUCTION_task_t* ncc = (__parsec_BT_reduction_REDUCTION_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[BT_reduction_REDUCTION.task_class_id];
+        const int REDUCTION_i = offset;
+        if( (REDUCTION_i >= (0)) && (REDUCTION_i <= ((NT - 1))) ) {
+          assert(&nc.locals[0].value == &ncc->locals.i.value);
+          ncc->locals.i.value = REDUCTION_i;
+          const int REDUCTION_t = BT_reduction_REDUCTION_inline_c_expr12_line_104(__parsec_tp, &ncc->locals);
+          assert(&nc.locals[1].value == &ncc->locals.t.value);
+          ncc->locals.t.value = REDUCTION_t;
+          const int REDUCTION_li = BT_reduction_REDUCTION_inline_c_expr11_line_105(__parsec_tp, &ncc->locals);
+          assert(&nc.locals[2].value == &ncc->locals.li.value);
+          ncc->locals.li.value = REDUCTION_li;
+          const int REDUCTION_sz = BT_reduction_REDUCTION_inline_c_expr10_line_106(__parsec_tp, &ncc->locals);
+          assert(&nc.locals[3].value == &ncc->locals.sz.value);
+          ncc->locals.sz.value = REDUCTION_sz;
+#if defined(DISTRIBUTED)
+          rank_dst = rank_of_dataA(ncc->locals.i.value, 0);
+          if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+            vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_dataA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_dataA, ncc->locals.i.value, 0);
+          nc.priority = __parsec_tp->super.super.priority;
+          successor_repo = NULL;
+          successor_repo_key = 0;
+        RELEASE_DEP_OUTPUT(es, "C", this_task, "A", &nc, rank_src, rank_dst, &data);
+        if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_BT_reduction_LINEAR_REDUC_for_C_dep1_atline_166, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+          }
+    }
+  }
+  if( action_mask & 0x8 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_BT_reduction_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_BT_reduction_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( (0) < (sz) ) {
+      __parsec_BT_reduction_BT_REDUC_task_t* ncc = (__parsec_BT_reduction_BT_REDUC_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[BT_reduction_BT_REDUC.task_class_id];
+        const int BT_REDUC_tree_count = BT_reduction_BT_REDUC_inline_c_expr9_line_123(__parsec_tp, &ncc->locals);
+        assert(&nc.locals[0].value == &ncc->locals.tree_count.value);
+        ncc->locals.tree_count.value = BT_REDUC_tree_count;
+        const int BT_REDUC_t = i;
+        if( (BT_REDUC_t >= (1)) && (BT_REDUC_t <= (ncc->locals.tree_count.value)) ) {
+          assert(&nc.locals[1].value == &ncc->locals.t.value);
+          ncc->locals.t.value = BT_REDUC_t;
+          const int BT_REDUC_sz = BT_reduction_BT_REDUC_inline_c_expr8_line_125(__parsec_tp, &ncc->locals);
+          assert(&nc.locals[2].value == &ncc->locals.sz.value);
+          ncc->locals.sz.value = BT_REDUC_sz;
+          const int BT_REDUC_s = sz;
+          if( (BT_REDUC_s >= (1)) && (BT_REDUC_s <= (ncc->locals.sz.value)) ) {
+            assert(&nc.locals[3].value == &ncc->locals.s.value);
+            ncc->locals.s.value = BT_REDUC_s;
+            const int BT_REDUC_lvl = (ncc->locals.sz.value - ncc->locals.s.value);
+            assert(&nc.locals[4].value == &ncc->locals.lvl.value);
+            ncc->locals.lvl.value = BT_REDUC_lvl;
+            const int BT_REDUC_i = 0;
+            if( (BT_REDUC_i >= (0)) && (BT_REDUC_i <= (BT_reduction_BT_REDUC_inline_c_expr7_line_128(__parsec_tp, &ncc->locals))) ) {
+              assert(&nc.locals[5].value == &ncc->locals.i.value);
+              ncc->locals.i.value = BT_REDUC_i;
+              const int BT_REDUC_offset = BT_reduction_BT_REDUC_inline_c_expr6_line_129(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[6].value == &ncc->locals.offset.value);
+              ncc->locals.offset.value = BT_REDUC_offset;
+#if defined(DISTRIBUTED)
+              rank_dst = rank_of_dataA((ncc->locals.offset.value + (ncc->locals.i.value * 2)), 0);
+              if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+                vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_dataA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_dataA, (ncc->locals.offset.value + (ncc->locals.i.value * 2)), 0);
+              nc.priority = __parsec_tp->super.super.priority;
+              successor_repo = BT_REDUC_repo;
+              successor_repo_key = __jdf2c_make_key_BT_REDUC((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+            RELEASE_DEP_OUTPUT(es, "C", this_task, "B", &nc, rank_src, rank_dst, &data);
+            if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_BT_reduction_LINEAR_REDUC_for_C_dep2_atline_167, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+              }
+            }
+          }
+    }
+  }
+  }
+  if( action_mask & 0x3 ) {  /* Flow of data B [1] */
+    data.data   = this_task->data._f_B.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x1 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_BT_reduction_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_BT_reduction_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( (tree_count) == (i) ) {
+      __parsec_BT_reduction_LINE_TERMINATOR_task_t* ncc = (__parsec_BT_reduction_LINE_TERMINATOR_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[BT_reduction_LINE_TERMINATOR.task_class_id];
+        const int LINE_TERMINATOR_j = 0;
+        if( (LINE_TERMINATOR_j >= (0)) && (LINE_TERMINATOR_j <= (0)) ) {
+          assert(&nc.locals[0].value == &ncc->locals.j.value);
+          ncc->locals.j.value = LINE_TERMINATOR_j;
+          const int LINE_TERMINATOR_tree_count = BT_reduction_LINE_TERMINATOR_inline_c_expr2_line_192(__parsec_tp, &ncc->locals);
+          assert(&nc.locals[1].value == &ncc->locals.tree_count.value);
+          ncc->locals.tree_count.value = LINE_TERMINATOR_tree_count;
+          const int LINE_TERMINATOR_i = ncc->locals.tree_count.value;
+          assert(&nc.locals[2].value == &ncc->locals.i.value);
+          ncc->locals.i.value = LINE_TERMINATOR_i;
+          const int LINE_TERMINATOR_offset = BT_reduction_LINE_TERMINATOR_inline_c_expr1_line_194(__parsec_tp, &ncc->locals);
+          assert(&nc.locals[3].value == &ncc->locals.offset.value);
+          ncc->locals.offset.value = LINE_TERMINATOR_offset;
+#if defined(DISTRIBUTED)
+          rank_dst = rank_of_dataA(ncc->locals.offset.value, 0);
+          if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+            vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_dataA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_dataA, ncc->locals.offset.value, 0);
+          nc.priority = __parsec_tp->super.super.priority;
+          successor_repo = NULL;
+          successor_repo_key = 0;
+        RELEASE_DEP_OUTPUT(es, "B", this_task, "T", &nc, rank_src, rank_dst, &data);
+        if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_BT_reduction_LINEAR_REDUC_for_B_dep1_atline_164, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+          }
+    }
+  }
+  if( action_mask & 0x2 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_BT_reduction_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_BT_reduction_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( (tree_count) > (i) ) {
+      __parsec_BT_reduction_LINEAR_REDUC_task_t* ncc = (__parsec_BT_reduction_LINEAR_REDUC_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[BT_reduction_LINEAR_REDUC.task_class_id];
+        const int LINEAR_REDUC_tree_count = BT_reduction_LINEAR_REDUC_inline_c_expr5_line_157(__parsec_tp, &ncc->locals);
+        assert(&nc.locals[0].value == &ncc->locals.tree_count.value);
+        ncc->locals.tree_count.value = LINEAR_REDUC_tree_count;
+        const int LINEAR_REDUC_i = (i + 1);
+        if( (LINEAR_REDUC_i >= (1)) && (LINEAR_REDUC_i <= (ncc->locals.tree_count.value)) ) {
+          assert(&nc.locals[1].value == &ncc->locals.i.value);
+          ncc->locals.i.value = LINEAR_REDUC_i;
+          const int LINEAR_REDUC_sz = BT_reduction_LINEAR_REDUC_inline_c_expr4_line_159(__parsec_tp, &ncc->locals);
+          assert(&nc.locals[2].value == &ncc->locals.sz.value);
+          ncc->locals.sz.value = LINEAR_REDUC_sz;
+          const int LINEAR_REDUC_offset = BT_reduction_LINEAR_REDUC_inline_c_expr3_line_160(__parsec_tp, &ncc->locals);
+          assert(&nc.locals[3].value == &ncc->locals.offset.value);
+          ncc->locals.offset.value = LINEAR_REDUC_offset;
+#if defined(DISTRIBUTED)
+          rank_dst = rank_of_dataA(ncc->locals.offset.value, 0);
+          if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+            vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_dataA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_dataA, ncc->locals.offset.value, 0);
+          nc.priority = __parsec_tp->super.super.priority;
+          successor_repo = LINEAR_REDUC_repo;
+          successor_repo_key = __jdf2c_make_key_LINEAR_REDUC((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+        RELEASE_DEP_OUTPUT(es, "B", this_task, "C", &nc, rank_src, rank_dst, &data);
+        if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_BT_reduction_LINEAR_REDUC_for_B_dep2_atline_165, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+          }
+    }
+  }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static int release_deps_of_BT_reduction_LINEAR_REDUC(parsec_execution_stream_t *es, __parsec_BT_reduction_LINEAR_REDUC_task_t *this_task, uint32_t action_mask, parsec_remote_deps_t *deps)
+{
+  PARSEC_PINS(es, RELEASE_DEPS_BEGIN, (parsec_task_t *)this_task);  const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp = (const __parsec_BT_reduction_internal_taskpool_t *)this_task->taskpool;
+  parsec_release_dep_fct_arg_t arg;
+  int __vp_id;
+  int consume_local_repo = 0;
+  arg.action_mask = action_mask;
+  arg.output_entry = NULL;
+  arg.output_repo = NULL;
+#if defined(DISTRIBUTED)
+  arg.remote_deps = deps;
+#endif  /* defined(DISTRIBUTED) */
+  assert(NULL != es);
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS )    arg.ready_lists = alloca(sizeof(parsec_task_t *) * es->virtual_process->parsec_context->nb_vp);
+  else
+    arg.ready_lists = NULL;
+  for( __vp_id = 0; __vp_id < es->virtual_process->parsec_context->nb_vp; arg.ready_lists[__vp_id++] = NULL );
+  (void)__parsec_tp; (void)deps;
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_C.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_C.source_repo, this_task->data._f_C.source_repo_entry->ht_item.key );
+    }
+    if( NULL != this_task->data._f_B.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_B.source_repo, this_task->data._f_B.source_repo_entry->ht_item.key );
+    }
+  }
+  consume_local_repo = (this_task->repo_entry != NULL);
+  arg.output_repo = LINEAR_REDUC_repo;
+  arg.output_entry = this_task->repo_entry;
+  arg.output_usage = 0;
+  if( action_mask & (PARSEC_ACTION_RELEASE_LOCAL_DEPS | PARSEC_ACTION_GET_REPO_ENTRY) ) {
+    arg.output_entry = data_repo_lookup_entry_and_create( es, arg.output_repo, __jdf2c_make_key_LINEAR_REDUC((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    arg.output_entry->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(arg.output_entry->sim_exec_date == 0);
+    arg.output_entry->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  if(action_mask & ( PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE ) ){
+    /* Generate the reshape promise for the outputs that need it */
+    iterate_successors_of_BT_reduction_LINEAR_REDUC(es, this_task, action_mask, parsec_set_up_reshape_promise, &arg);
+   }
+  iterate_successors_of_BT_reduction_LINEAR_REDUC(es, this_task, action_mask, parsec_release_dep_fct, &arg);
+
+#if defined(DISTRIBUTED)
+  if( (action_mask & PARSEC_ACTION_SEND_REMOTE_DEPS) && (NULL != arg.remote_deps)) {
+    parsec_remote_dep_activate(es, (parsec_task_t *)this_task, arg.remote_deps, arg.remote_deps->outgoing_mask);
+  }
+#endif
+
+  if(action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS) {
+    data_repo_entry_addto_usage_limit(LINEAR_REDUC_repo, arg.output_entry->ht_item.key, arg.output_usage);
+    __parsec_schedule_vp(es, arg.ready_lists, 0);
+  }
+      if (consume_local_repo) {
+         data_repo_entry_used_once( LINEAR_REDUC_repo, this_task->repo_entry->ht_item.key );
+      }
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_C.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_C.data_in);
+    }
+    if( NULL != this_task->data._f_B.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_B.data_in);
+    }
+  }
+  PARSEC_PINS(es, RELEASE_DEPS_END, (parsec_task_t *)this_task);  return 0;
+}
+
+static int data_lookup_of_BT_reduction_LINEAR_REDUC(parsec_execution_stream_t *es, __parsec_BT_reduction_LINEAR_REDUC_task_t *this_task)
+{
+  const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp = (__parsec_BT_reduction_internal_taskpool_t *)this_task->taskpool;
+  parsec_assignment_t generic_locals[MAX_PARAM_COUNT];  /* generic task locals */
+  int target_device = 0; (void)target_device;
+  (void)__parsec_tp; (void)generic_locals; (void)es;
+  parsec_data_copy_t *chunk = NULL;
+  data_repo_t        *reshape_repo  = NULL, *consumed_repo  = NULL;
+  data_repo_entry_t  *reshape_entry = NULL, *consumed_entry = NULL;
+  parsec_key_t        reshape_entry_key = 0, consumed_entry_key = 0;
+  uint8_t             consumed_flow_index;
+  parsec_dep_data_description_t data;
+  int ret;
+  (void)reshape_repo; (void)reshape_entry; (void)reshape_entry_key;
+  (void)consumed_repo; (void)consumed_entry; (void)consumed_entry_key;
+  (void)consumed_flow_index;
+  (void)chunk; (void)data; (void)ret;
+  const int tree_count = this_task->locals.tree_count.value; (void)tree_count;
+  const int i = this_task->locals.i.value; (void)i;
+  const int sz = this_task->locals.sz.value; (void)sz;
+  const int offset = this_task->locals.offset.value; (void)offset;
+  if( NULL == this_task->repo_entry ){
+    this_task->repo_entry = data_repo_lookup_entry_and_create(es, LINEAR_REDUC_repo,                                       __jdf2c_make_key_LINEAR_REDUC((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    data_repo_entry_addto_usage_limit(LINEAR_REDUC_repo, this_task->repo_entry->ht_item.key, 1);    this_task->repo_entry ->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(this_task->repo_entry ->sim_exec_date == 0);
+    this_task->repo_entry ->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  /* The reshape repo is the current task repo. */  reshape_repo = LINEAR_REDUC_repo;
+  reshape_entry_key = __jdf2c_make_key_LINEAR_REDUC((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals) ;
+  reshape_entry = this_task->repo_entry;
+  /* Lookup the input data, and store them in the context if any */
+
+if(! this_task->data._f_C.fulfill ){ /* Flow C */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_C.data_out = NULL;  /* By default, if nothing matches */
+    if( (0) == (sz) ) {
+    /* Flow C [0] dependency [2] from predecessor REDUCTION */
+    if( NULL == (chunk = this_task->data._f_C.data_in) ) {
+    /* No data set up by predecessor on this task input flow */
+__parsec_BT_reduction_REDUCTION_parsec_assignment_t *target_locals = (__parsec_BT_reduction_REDUCTION_parsec_assignment_t*)&generic_locals;
+      const int REDUCTIONi = target_locals->i.value = offset; (void)REDUCTIONi;
+      const int REDUCTIONt = target_locals->t.value = BT_reduction_REDUCTION_inline_c_expr12_line_104(__parsec_tp, target_locals); (void)REDUCTIONt;
+      const int REDUCTIONli = target_locals->li.value = BT_reduction_REDUCTION_inline_c_expr11_line_105(__parsec_tp, target_locals); (void)REDUCTIONli;
+      const int REDUCTIONsz = target_locals->sz.value = BT_reduction_REDUCTION_inline_c_expr10_line_106(__parsec_tp, target_locals); (void)REDUCTIONsz;
+      if( (reshape_entry != NULL) && (reshape_entry->data[0] != NULL) ){
+          /* Reshape promise set up on this task repo by predecessor */
+          consumed_repo = reshape_repo;
+          consumed_entry = reshape_entry;
+          consumed_entry_key = reshape_entry_key;
+          consumed_flow_index = 0;
+      }else{
+          /* Consume from predecessor's repo */
+          consumed_repo = REDUCTION_repo;
+          consumed_entry_key = __jdf2c_make_key_REDUCTION((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)target_locals) ;
+          consumed_entry = data_repo_lookup_entry( consumed_repo, consumed_entry_key );
+          consumed_flow_index = 0;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      ACQUIRE_FLOW(this_task, "C", &BT_reduction_REDUCTION, "A", target_locals, chunk);
+      this_task->data._f_C.data_out = chunk;
+    } 
+    else {
+      /* Data set up by predecessor on this task input flow */
+      consumed_repo = this_task->data._f_C.source_repo;
+      consumed_entry = this_task->data._f_C.source_repo_entry;
+      consumed_entry_key = this_task->data._f_C.source_repo_entry->ht_item.key;
+      if( (reshape_entry != NULL) && (reshape_entry->data[0] != NULL) ){
+          /* Reshape promise set up on input by predecessor is on this task repo */
+          consumed_flow_index = 0;
+          assert( (this_task->data._f_C.source_repo == reshape_repo)
+               && (this_task->data._f_C.source_repo_entry == reshape_entry));
+      }else{
+          /* Reshape promise set up on input by predecessor is the predecesssor task repo */
+          consumed_flow_index = 0;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      this_task->data._f_C.data_out = parsec_data_get_copy(chunk->original, target_device);
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+      parsec_prof_grapher_data_input(chunk->original, (parsec_task_t*)this_task, &flow_of_BT_reduction_LINEAR_REDUC_for_C, 0);
+#endif
+    }
+    }
+    else if( (0) < (sz) ) {
+    /* Flow C [0] dependency [3] from predecessor BT_REDUC */
+    if( NULL == (chunk = this_task->data._f_C.data_in) ) {
+    /* No data set up by predecessor on this task input flow */
+__parsec_BT_reduction_BT_REDUC_parsec_assignment_t *target_locals = (__parsec_BT_reduction_BT_REDUC_parsec_assignment_t*)&generic_locals;
+      const int BT_REDUCtree_count = target_locals->tree_count.value = BT_reduction_BT_REDUC_inline_c_expr9_line_123(__parsec_tp, target_locals); (void)BT_REDUCtree_count;
+      const int BT_REDUCt = target_locals->t.value = i; (void)BT_REDUCt;
+      const int BT_REDUCsz = target_locals->sz.value = BT_reduction_BT_REDUC_inline_c_expr8_line_125(__parsec_tp, target_locals); (void)BT_REDUCsz;
+      const int BT_REDUCs = target_locals->s.value = sz; (void)BT_REDUCs;
+      const int BT_REDUClvl = target_locals->lvl.value = (BT_REDUCsz - BT_REDUCs); (void)BT_REDUClvl;
+      const int BT_REDUCi = target_locals->i.value = 0; (void)BT_REDUCi;
+      const int BT_REDUCoffset = target_locals->offset.value = BT_reduction_BT_REDUC_inline_c_expr6_line_129(__parsec_tp, target_locals); (void)BT_REDUCoffset;
+      if( (reshape_entry != NULL) && (reshape_entry->data[0] != NULL) ){
+          /* Reshape promise set up on this task repo by predecessor */
+          consumed_repo = reshape_repo;
+          consumed_entry = reshape_entry;
+          consumed_entry_key = reshape_entry_key;
+          consumed_flow_index = 0;
+      }else{
+          /* Consume from predecessor's repo */
+          consumed_repo = BT_REDUC_repo;
+          consumed_entry_key = __jdf2c_make_key_BT_REDUC((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)target_locals) ;
+          consumed_entry = data_repo_lookup_entry( consumed_repo, consumed_entry_key );
+          consumed_flow_index = 0;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      ACQUIRE_FLOW(this_task, "C", &BT_reduction_BT_REDUC, "B", target_locals, chunk);
+      this_task->data._f_C.data_out = chunk;
+    } 
+    else {
+      /* Data set up by predecessor on this task input flow */
+      consumed_repo = this_task->data._f_C.source_repo;
+      consumed_entry = this_task->data._f_C.source_repo_entry;
+      consumed_entry_key = this_task->data._f_C.source_repo_entry->ht_item.key;
+      if( (reshape_entry != NULL) && (reshape_entry->data[0] != NULL) ){
+          /* Reshape promise set up on input by predecessor is on this task repo */
+          consumed_flow_index = 0;
+          assert( (this_task->data._f_C.source_repo == reshape_repo)
+               && (this_task->data._f_C.source_repo_entry == reshape_entry));
+      }else{
+          /* Reshape promise set up on input by predecessor is the predecesssor task repo */
+          consumed_flow_index = 0;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      this_task->data._f_C.data_out = parsec_data_get_copy(chunk->original, target_device);
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+      parsec_prof_grapher_data_input(chunk->original, (parsec_task_t*)this_task, &flow_of_BT_reduction_LINEAR_REDUC_for_C, 0);
+#endif
+    }
+    }
+    this_task->data._f_C.data_in     = chunk;
+    this_task->data._f_C.source_repo       = consumed_repo;
+    this_task->data._f_C.source_repo_entry = consumed_entry;
+    if( this_task->data._f_C.source_repo_entry == this_task->repo_entry ){
+      /* in case we have consume from this task repo entry for the flow,
+       * it is cleaned up, avoiding having old stuff during release_deps_of
+       */
+      this_task->repo_entry->data[0] = NULL;
+    }
+    this_task->data._f_C.fulfill = 1;
+}
+
+
+if(! this_task->data._f_B.fulfill ){ /* Flow B */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_B.data_out = NULL;  /* input only */
+    if( (tree_count) == (i) ) {
+    /* Flow B [1] dependency [0] from predecessor LINE_TERMINATOR */
+    if( NULL == (chunk = this_task->data._f_B.data_in) ) {
+    /* No data set up by predecessor on this task input flow */
+__parsec_BT_reduction_LINE_TERMINATOR_parsec_assignment_t *target_locals = (__parsec_BT_reduction_LINE_TERMINATOR_parsec_assignment_t*)&generic_locals;
+      const int LINE_TERMINATORj = target_locals->j.value = 0; (void)LINE_TERMINATORj;
+      const int LINE_TERMINATORtree_count = target_locals->tree_count.value = BT_reduction_LINE_TERMINATOR_inline_c_expr2_line_192(__parsec_tp, target_locals); (void)LINE_TERMINATORtree_count;
+      const int LINE_TERMINATORi = target_locals->i.value = LINE_TERMINATORtree_count; (void)LINE_TERMINATORi;
+      const int LINE_TERMINATORoffset = target_locals->offset.value = BT_reduction_LINE_TERMINATOR_inline_c_expr1_line_194(__parsec_tp, target_locals); (void)LINE_TERMINATORoffset;
+      if( (reshape_entry != NULL) && (reshape_entry->data[1] != NULL) ){
+          /* Reshape promise set up on this task repo by predecessor */
+          consumed_repo = reshape_repo;
+          consumed_entry = reshape_entry;
+          consumed_entry_key = reshape_entry_key;
+          consumed_flow_index = 1;
+      }else{
+          /* Consume from predecessor's repo */
+          consumed_repo = LINE_TERMINATOR_repo;
+          consumed_entry_key = __jdf2c_make_key_LINE_TERMINATOR((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)target_locals) ;
+          consumed_entry = data_repo_lookup_entry( consumed_repo, consumed_entry_key );
+          consumed_flow_index = 0;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 1, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      ACQUIRE_FLOW(this_task, "B", &BT_reduction_LINE_TERMINATOR, "T", target_locals, chunk);
+      this_task->data._f_B.data_out = chunk;
+    } 
+    else {
+      /* Data set up by predecessor on this task input flow */
+      consumed_repo = this_task->data._f_B.source_repo;
+      consumed_entry = this_task->data._f_B.source_repo_entry;
+      consumed_entry_key = this_task->data._f_B.source_repo_entry->ht_item.key;
+      if( (reshape_entry != NULL) && (reshape_entry->data[1] != NULL) ){
+          /* Reshape promise set up on input by predecessor is on this task repo */
+          consumed_flow_index = 1;
+          assert( (this_task->data._f_B.source_repo == reshape_repo)
+               && (this_task->data._f_B.source_repo_entry == reshape_entry));
+      }else{
+          /* Reshape promise set up on input by predecessor is the predecesssor task repo */
+          consumed_flow_index = 0;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 1, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      this_task->data._f_B.data_out = parsec_data_get_copy(chunk->original, target_device);
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+      parsec_prof_grapher_data_input(chunk->original, (parsec_task_t*)this_task, &flow_of_BT_reduction_LINEAR_REDUC_for_B, 0);
+#endif
+    }
+    }
+    else if( (tree_count) > (i) ) {
+    /* Flow B [1] dependency [1] from predecessor LINEAR_REDUC */
+    if( NULL == (chunk = this_task->data._f_B.data_in) ) {
+    /* No data set up by predecessor on this task input flow */
+__parsec_BT_reduction_LINEAR_REDUC_parsec_assignment_t *target_locals = (__parsec_BT_reduction_LINEAR_REDUC_parsec_assignment_t*)&generic_locals;
+      const int LINEAR_REDUCtree_count = target_locals->tree_count.value = BT_reduction_LINEAR_REDUC_inline_c_expr5_line_157(__parsec_tp, target_locals); (void)LINEAR_REDUCtree_count;
+      const int LINEAR_REDUCi = target_locals->i.value = (i + 1); (void)LINEAR_REDUCi;
+      const int LINEAR_REDUCsz = target_locals->sz.value = BT_reduction_LINEAR_REDUC_inline_c_expr4_line_159(__parsec_tp, target_locals); (void)LINEAR_REDUCsz;
+      const int LINEAR_REDUCoffset = target_locals->offset.value = BT_reduction_LINEAR_REDUC_inline_c_expr3_line_160(__parsec_tp, target_locals); (void)LINEAR_REDUCoffset;
+      if( (reshape_entry != NULL) && (reshape_entry->data[1] != NULL) ){
+          /* Reshape promise set up on this task repo by predecessor */
+          consumed_repo = reshape_repo;
+          consumed_entry = reshape_entry;
+          consumed_entry_key = reshape_entry_key;
+          consumed_flow_index = 1;
+      }else{
+          /* Consume from predecessor's repo */
+          consumed_repo = LINEAR_REDUC_repo;
+          consumed_entry_key = __jdf2c_make_key_LINEAR_REDUC((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)target_locals) ;
+          consumed_entry = data_repo_lookup_entry( consumed_repo, consumed_entry_key );
+          consumed_flow_index = 0;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 1, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      ACQUIRE_FLOW(this_task, "B", &BT_reduction_LINEAR_REDUC, "C", target_locals, chunk);
+      this_task->data._f_B.data_out = chunk;
+    } 
+    else {
+      /* Data set up by predecessor on this task input flow */
+      consumed_repo = this_task->data._f_B.source_repo;
+      consumed_entry = this_task->data._f_B.source_repo_entry;
+      consumed_entry_key = this_task->data._f_B.source_repo_entry->ht_item.key;
+      if( (reshape_entry != NULL) && (reshape_entry->data[1] != NULL) ){
+          /* Reshape promise set up on input by predecessor is on this task repo */
+          consumed_flow_index = 1;
+          assert( (this_task->data._f_B.source_repo == reshape_repo)
+               && (this_task->data._f_B.source_repo_entry == reshape_entry));
+      }else{
+          /* Reshape promise set up on input by predecessor is the predecesssor task repo */
+          consumed_flow_index = 0;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 1, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      this_task->data._f_B.data_out = parsec_data_get_copy(chunk->original, target_device);
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+      parsec_prof_grapher_data_input(chunk->original, (parsec_task_t*)this_task, &flow_of_BT_reduction_LINEAR_REDUC_for_B, 0);
+#endif
+    }
+    }
+    this_task->data._f_B.data_in     = chunk;
+    this_task->data._f_B.source_repo       = consumed_repo;
+    this_task->data._f_B.source_repo_entry = consumed_entry;
+    if( this_task->data._f_B.source_repo_entry == this_task->repo_entry ){
+      /* in case we have consume from this task repo entry for the flow,
+       * it is cleaned up, avoiding having old stuff during release_deps_of
+       */
+      this_task->repo_entry->data[1] = NULL;
+    }
+    this_task->data._f_B.fulfill = 1;
+}
+
+  /** Generate profiling information */
+#if defined(PARSEC_PROF_TRACE)
+  this_task->prof_info.desc = (parsec_data_collection_t*)__parsec_tp->super._g_dataA;
+  this_task->prof_info.priority = this_task->priority;
+  this_task->prof_info.data_id   = ((parsec_data_collection_t*)__parsec_tp->super._g_dataA)->data_key((parsec_data_collection_t*)__parsec_tp->super._g_dataA, offset, 0);
+  this_task->prof_info.task_class_id = this_task->task_class->task_class_id;
+  this_task->prof_info.task_return_code = -1;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int datatype_lookup_of_BT_reduction_LINEAR_REDUC(parsec_execution_stream_t *es, const parsec_task_t *this_generic_task, const parsec_task_t *parent_task,
+              uint32_t* flow_mask, parsec_dep_data_description_t* data)
+{
+  const __parsec_BT_reduction_LINEAR_REDUC_task_t *this_task = (__parsec_BT_reduction_LINEAR_REDUC_task_t*)this_generic_task;
+  const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp = (__parsec_BT_reduction_internal_taskpool_t *)this_task->taskpool;
+  (void)__parsec_tp; (void)es; (void)this_task; (void)data; (void)parent_task;
+  const int tree_count = this_task->locals.tree_count.value; (void)tree_count;
+  const int i = this_task->locals.i.value; (void)i;
+  const int sz = this_task->locals.sz.value; (void)sz;
+  const int offset = this_task->locals.offset.value; (void)offset;
+  data->local.arena = data->remote.arena = NULL;
+  data->local.src_datatype  = data->local.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->local.src_count     = data->local.dst_count = 0;
+  data->local.src_displ     = data->local.dst_displ = 0;
+  data->data_future  = NULL;
+  if( (*flow_mask) & 0x80000000U ) { /* these are the input dependencies remote datatypes  */
+if( (*flow_mask) & 0x1U ) {  /* Flow C */
+    if( ((*flow_mask) & 0x1U)
+ && ((0) == (sz) || (0) < (sz)) ) {
+    data->remote.arena  =  PARSEC_BT_reduction_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_BT_reduction_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_BT_reduction_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+if( (*flow_mask) & 0x2U ) {  /* Flow B */
+    if( ((*flow_mask) & 0x2U)
+ && ((tree_count) == (i) || (tree_count) > (i)) ) {
+    data->remote.arena  =  PARSEC_BT_reduction_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_BT_reduction_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_BT_reduction_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x2U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x2U) */
+    goto no_mask_match;
+  }
+
+  /* these are the output dependencies remote datatypes */
+if( (*flow_mask) & 0x1U ) {  /* Flow C */
+    if( ((*flow_mask) & 0x1U)
+ && ((1) < (i)) ) {
+    data->remote.arena  =  PARSEC_BT_reduction_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_BT_reduction_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_BT_reduction_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+ no_mask_match:
+  data->data                             = NULL;
+  data->remote.src_datatype = data->remote.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->remote.src_count    = data->remote.dst_count = 0;
+  data->remote.src_displ    = data->remote.dst_displ = 0;
+  data->data_future  = NULL;
+  (*flow_mask) = 0;  /* nothing left */
+  (void)tree_count;  (void)i;  (void)sz;  (void)offset;
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+static int hook_of_BT_reduction_LINEAR_REDUC(parsec_execution_stream_t *es, __parsec_BT_reduction_LINEAR_REDUC_task_t *this_task)
+{
+  __parsec_BT_reduction_internal_taskpool_t *__parsec_tp = (__parsec_BT_reduction_internal_taskpool_t *)this_task->taskpool;
+  (void)es; (void)__parsec_tp;
+  const int tree_count = this_task->locals.tree_count.value; (void)tree_count;
+  const int i = this_task->locals.i.value; (void)i;
+  const int sz = this_task->locals.sz.value; (void)sz;
+  const int offset = this_task->locals.offset.value; (void)offset;
+  (void)tree_count;  (void)i;  (void)sz;  (void)offset;
+
+  /** Declare the variables that will hold the data, and all the accounting for each */
+  parsec_data_copy_t *_f_C = this_task->data._f_C.data_in;
+  void *C = PARSEC_DATA_COPY_GET_PTR(_f_C); (void)C;
+  parsec_data_copy_t *_f_B = this_task->data._f_B.data_in;
+  void *B = PARSEC_DATA_COPY_GET_PTR(_f_B); (void)B;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    data_repo_entry_t *eC = this_task->data._f_C.source_repo_entry;
+    if( (NULL != eC) && (eC->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eC->sim_exec_date;
+    data_repo_entry_t *eB = this_task->data._f_B.source_repo_entry;
+    if( (NULL != eB) && (eB->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eB->sim_exec_date;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+    if ( NULL != _f_C ) {
+#if defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) || defined(PARSEC_HAVE_DEV_HIP_SUPPORT)
+      parsec_data_transfer_ownership_to_copy( _f_C->original, 0 /* device */,
+                                           PARSEC_FLOW_ACCESS_RW);
+#endif  /* defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) || defined(PARSEC_HAVE_DEV_HIP_SUPPORT) */
+      _f_C->version++;  /* C */
+#if defined(PARSEC_DEBUG_NOISIER)
+      char tmp[128];
+      PARSEC_DEBUG_VERBOSE(10, parsec_debug_output,
+                           "Body of %s: change Data copy %p to version %d",
+                           parsec_task_snprintf(tmp, 128, (parsec_task_t*)(this_task)),
+                           _f_C, _f_C->version);
+#endif /* defined(PARSEC_DEBUG_NOISIER) */
+    }
+  /** Cache Awareness Accounting */
+#if defined(PARSEC_CACHE_AWARENESS)
+  cache_buf_referenced(es->closest_cache, C);
+  cache_buf_referenced(es->closest_cache, B);
+#endif /* PARSEC_CACHE_AWARENESS */
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                              LINEAR_REDUC BODY                                -----*/
+
+  int j;
+
+  if( 1==i ){
+      assert(0==offset);
+  }
+
+  /* if this is the first task in the chain then "B" is bogus. Ignore it. */
+  if(tree_count!=i){
+      for(j=0; j<NB; j++){
+          REDUCE( B, C, j );
+      }
+  }
+
+  if( 1==i && 0==((__parsec_tp->super.super.context)->my_rank) ) printf("%d\n", *TYPE(C)); 
+
+
+/*-----                            END OF LINEAR_REDUC BODY                            -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#endif  /*  defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+static int complete_hook_of_BT_reduction_LINEAR_REDUC(parsec_execution_stream_t *es, __parsec_BT_reduction_LINEAR_REDUC_task_t *this_task)
+{
+  const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp = (__parsec_BT_reduction_internal_taskpool_t *)this_task->taskpool;
+#if defined(DISTRIBUTED)
+    const int tree_count = this_task->locals.tree_count.value; (void)tree_count;
+  const int i = this_task->locals.i.value; (void)i;
+  const int sz = this_task->locals.sz.value; (void)sz;
+  const int offset = this_task->locals.offset.value; (void)offset;
+#endif  /* defined(DISTRIBUTED) */
+  (void)es; (void)__parsec_tp;
+parsec_data_t* data_t_desc = NULL; (void)data_t_desc;
+#if defined(DISTRIBUTED)
+  /** If not working on distributed, there is no risk that data is not in place */
+  (void)tree_count;  (void)i;  (void)sz;  (void)offset;
+
+#endif /* DISTRIBUTED */
+#if defined(PARSEC_PROF_GRAPHER)
+  parsec_prof_grapher_task((parsec_task_t*)this_task, es->th_id, es->virtual_process->vp_id,
+     __jdf2c_key_fns_LINEAR_REDUC.key_hash(this_task->task_class->make_key( (parsec_taskpool_t*)this_task->taskpool, ((parsec_task_t*)this_task)->locals), NULL));
+#endif  /* defined(PARSEC_PROF_GRAPHER) */
+  release_deps_of_BT_reduction_LINEAR_REDUC(es, this_task,
+      PARSEC_ACTION_RELEASE_REMOTE_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_REFS |
+      PARSEC_ACTION_RESHAPE_ON_RELEASE |
+      0x1,  /* mask of all dep_index */ 
+      NULL);
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static parsec_hook_return_t release_task_of_BT_reduction_LINEAR_REDUC(parsec_execution_stream_t *es, parsec_task_t *this_task)
+{
+    const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp =
+        (const __parsec_BT_reduction_internal_taskpool_t *)this_task->taskpool;
+    parsec_hash_table_t *ht = (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[2];
+    parsec_key_t key = this_task->task_class->make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals);
+    parsec_hashable_dependency_t *hash_dep = (parsec_hashable_dependency_t *)parsec_hash_table_remove(ht, key);
+    parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);
+    return parsec_release_task_to_mempool_update_nbtasks(es, this_task);
+}
+
+static char *BT_reduction_BT_reduction_LINEAR_REDUC_internal_init_deps_key_functions_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_BT_reduction_internal_taskpool_t *__parsec_tp = (__parsec_BT_reduction_internal_taskpool_t *)user_data;
+  __parsec_BT_reduction_LINEAR_REDUC_parsec_assignment_t __jdf2c__assignments = {  .tree_count.value = 0, .i.value = 0, .sz.value = 0, .offset.value = 0 };
+  int tree_count = BT_reduction_LINEAR_REDUC_inline_c_expr5_line_157(__parsec_tp, &__jdf2c__assignments);
+  (void)tree_count;
+  __jdf2c__assignments.tree_count.value = tree_count;
+  int i = (__parsec_key) % __parsec_tp->LINEAR_REDUC_i_range + __parsec_tp->LINEAR_REDUC_i_min;
+  __parsec_key = __parsec_key / __parsec_tp->LINEAR_REDUC_i_range;
+  __jdf2c__assignments.i.value = i;
+  int sz = BT_reduction_LINEAR_REDUC_inline_c_expr4_line_159(__parsec_tp, &__jdf2c__assignments);
+  (void)sz;
+  __jdf2c__assignments.sz.value = sz;
+  int offset = BT_reduction_LINEAR_REDUC_inline_c_expr3_line_160(__parsec_tp, &__jdf2c__assignments);
+  (void)offset;
+  __jdf2c__assignments.offset.value = offset;
+  (void)__jdf2c__assignments;
+  snprintf(buffer, buffer_size, "LINEAR_REDUC(%d)", i);
+  return buffer;
+}
+
+static parsec_key_fn_t BT_reduction_BT_reduction_LINEAR_REDUC_internal_init_deps_key_functions = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = BT_reduction_BT_reduction_LINEAR_REDUC_internal_init_deps_key_functions_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/* Needs: min-max count-tasks iterate */
+static int BT_reduction_LINEAR_REDUC_internal_init(parsec_execution_stream_t * es, __parsec_BT_reduction_LINEAR_REDUC_task_t * this_task)
+{
+  __parsec_BT_reduction_internal_taskpool_t *__parsec_tp = (__parsec_BT_reduction_internal_taskpool_t*)this_task->taskpool;
+  int32_t nb_tasks = 0, saved_nb_tasks = 0;
+int32_t __i_min = 0x7fffffff, __i_max = 0;int32_t __jdf2c_i_min = 0x7fffffff, __jdf2c_i_max = 0;  __parsec_BT_reduction_LINEAR_REDUC_parsec_assignment_t assignments = {  .tree_count.value = 0, .i.value = 0, .sz.value = 0, .offset.value = 0 };
+  int32_t  tree_count,  i,  sz,  offset;
+  int32_t __jdf2c_i_start, __jdf2c_i_end, __jdf2c_i_inc;
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+  PARSEC_PROFILING_TRACE(es->es_profile,
+                         this_task->taskpool->profiling_array[START_KEY(this_task->task_class->task_class_id)],
+                         0,
+                         this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+{  /* block for the non-range variable tree_count */
+    tree_count = BT_reduction_LINEAR_REDUC_inline_c_expr5_line_157(__parsec_tp, &assignments);
+    assignments.tree_count.value = tree_count;
+      __jdf2c_i_start = 1;
+      __jdf2c_i_end = tree_count;
+      __jdf2c_i_inc = 1;
+      __i_min = parsec_imin(__jdf2c_i_start, __jdf2c_i_end);
+      __i_max = parsec_imax(__jdf2c_i_start, __jdf2c_i_end);
+      __jdf2c_i_min = parsec_imin(__jdf2c_i_min, __i_min);
+      __jdf2c_i_max = parsec_imax(__jdf2c_i_max, __i_max);
+      for(i =  __jdf2c_i_start;
+          i <= __jdf2c_i_end;
+          i += __jdf2c_i_inc) {
+      assignments.i.value = i;
+    {  /* block for the non-range variable sz */
+        sz = BT_reduction_LINEAR_REDUC_inline_c_expr4_line_159(__parsec_tp, &assignments);
+        assignments.sz.value = sz;
+      {  /* block for the non-range variable offset */
+          offset = BT_reduction_LINEAR_REDUC_inline_c_expr3_line_160(__parsec_tp, &assignments);
+          assignments.offset.value = offset;
+          if( !LINEAR_REDUC_pred(tree_count, i, sz, offset) ) continue;
+          nb_tasks++;
+        } /* block for the non-range variable offset */ 
+      } /* block for the non-range variable sz */ 
+    } /* Loop on normal range i */
+  } /* Non-range variable tree_count */ 
+   if( 0 != nb_tasks ) {
+     (void)parsec_atomic_fetch_add_int32(&__parsec_tp->initial_number_tasks, nb_tasks);
+   }
+  /* Set the range variables for the collision-free hash-computation */
+  __parsec_tp->LINEAR_REDUC_i_min   = __jdf2c_i_min;
+  __parsec_tp->LINEAR_REDUC_i_range = (__jdf2c_i_max - __jdf2c_i_min) + 1;
+  this_task->status = PARSEC_TASK_STATUS_COMPLETE;
+
+  PARSEC_AYU_REGISTER_TASK(&BT_reduction_LINEAR_REDUC);
+  __parsec_tp->super.super.dependencies_array[2] = PARSEC_OBJ_NEW(parsec_hash_table_t);
+  parsec_hash_table_init(__parsec_tp->super.super.dependencies_array[2], offsetof(parsec_hashable_dependency_t, ht_item), 10, BT_reduction_BT_reduction_LINEAR_REDUC_internal_init_deps_key_functions, this_task->taskpool);
+  __parsec_tp->repositories[2] = data_repo_create_nothreadsafe(nb_tasks, __jdf2c_key_fns_LINEAR_REDUC, (parsec_taskpool_t*)__parsec_tp, 2);
+(void)saved_nb_tasks;
+(void)__i_min; (void)__i_max;  (void)__jdf2c_i_start; (void)__jdf2c_i_end; (void)__jdf2c_i_inc;  (void)assignments; (void)__parsec_tp; (void)es;
+  if(1 == parsec_atomic_fetch_dec_int32(&__parsec_tp->sync_point)) {
+    /* Last initialization task complete. Update the number of tasks. */
+    __parsec_tp->super.super.tdm.module->taskpool_addto_nb_tasks(&__parsec_tp->super.super, __parsec_tp->initial_number_tasks);
+    parsec_mfence();  /* write memory barrier to guarantee that the scheduler gets the correct number of tasks */
+    parsec_taskpool_enable((parsec_taskpool_t*)__parsec_tp, &__parsec_tp->startup_queue,
+                           (parsec_task_t*)this_task, es, __parsec_tp->super.super.nb_pending_actions);
+    __parsec_tp->super.super.tdm.module->taskpool_ready(&__parsec_tp->super.super);
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+    PARSEC_PROFILING_TRACE(es->es_profile,
+                           this_task->taskpool->profiling_array[2 * this_task->task_class->task_class_id + 1],
+                           0,
+                           this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    return PARSEC_HOOK_RETURN_DONE;
+  }
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static const __parsec_chore_t __BT_reduction_LINEAR_REDUC_chores[] ={
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+    { .type     = PARSEC_DEV_CPU,
+      .evaluate = (parsec_evaluate_function_t*)NULL,
+      .hook     = (parsec_hook_t*)hook_of_BT_reduction_LINEAR_REDUC },
+#endif  /* defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+    { .type     = PARSEC_DEV_NONE,
+      .evaluate = NULL,
+      .hook     = (parsec_hook_t*)NULL },  /* End marker */
+};
+
+static const parsec_task_class_t BT_reduction_LINEAR_REDUC = {
+  .name = "LINEAR_REDUC",
+  .task_class_id = 2,
+  .nb_flows = 2,
+  .nb_parameters = 1,
+  .nb_locals = 4,
+  .task_class_type = PARSEC_TASK_CLASS_TYPE_PTG,
+  .params = { &symb_BT_reduction_LINEAR_REDUC_i, NULL },
+  .locals = { &symb_BT_reduction_LINEAR_REDUC_tree_count, &symb_BT_reduction_LINEAR_REDUC_i, &symb_BT_reduction_LINEAR_REDUC_sz, &symb_BT_reduction_LINEAR_REDUC_offset, NULL },
+  .data_affinity = (parsec_data_ref_fn_t*)affinity_of_BT_reduction_LINEAR_REDUC,
+  .initial_data = (parsec_data_ref_fn_t*)affinity_of_BT_reduction_LINEAR_REDUC,
+  .final_data = (parsec_data_ref_fn_t*)affinity_of_BT_reduction_LINEAR_REDUC,
+  .priority = NULL,
+  .properties = properties_of_BT_reduction_LINEAR_REDUC,
+#if MAX_PARAM_COUNT < 2  /* number of read flows of LINEAR_REDUC */
+  #error Too many read flows for task LINEAR_REDUC
+#endif  /* MAX_PARAM_COUNT */
+#if MAX_PARAM_COUNT < 1  /* number of write flows of LINEAR_REDUC */
+  #error Too many write flows for task LINEAR_REDUC
+#endif  /* MAX_PARAM_COUNT */
+  .in = { &flow_of_BT_reduction_LINEAR_REDUC_for_C, &flow_of_BT_reduction_LINEAR_REDUC_for_B, NULL },
+  .out = { &flow_of_BT_reduction_LINEAR_REDUC_for_C, NULL },
+  .flags = 0x0 | PARSEC_USE_DEPS_MASK,
+  .dependencies_goal = 0x3,
+  .make_key = __jdf2c_make_key_LINEAR_REDUC,
+  .task_snprintf = parsec_task_snprintf,
+#if defined(PARSEC_PROF_TRACE)
+  .profile_info = &parsec_task_profile_info,
+#endif
+  .key_functions = &__jdf2c_key_fns_LINEAR_REDUC,
+  .fini = (parsec_hook_t*)NULL,
+  .incarnations = __BT_reduction_LINEAR_REDUC_chores,
+  .find_deps = parsec_hash_find_deps,
+  .update_deps = parsec_update_deps_with_mask,
+  .iterate_successors = (parsec_traverse_function_t*)iterate_successors_of_BT_reduction_LINEAR_REDUC,
+  .iterate_predecessors = (parsec_traverse_function_t*)iterate_predecessors_of_BT_reduction_LINEAR_REDUC,
+  .release_deps = (parsec_release_deps_t*)release_deps_of_BT_reduction_LINEAR_REDUC,
+  .prepare_output = (parsec_hook_t*)NULL,
+  .prepare_input = (parsec_hook_t*)data_lookup_of_BT_reduction_LINEAR_REDUC,
+  .time_estimate = NULL,
+  .get_datatype = datatype_lookup_of_BT_reduction_LINEAR_REDUC,
+  .complete_execution = (parsec_hook_t*)complete_hook_of_BT_reduction_LINEAR_REDUC,
+  .release_task = &release_task_of_BT_reduction_LINEAR_REDUC,
+#if defined(PARSEC_SIM)
+  .sim_cost_fct = (parsec_sim_cost_fct_t*)NULL,
+#endif
+};
+
+
+/******                                    BT_REDUC                                    ******/
+
+static inline int32_t expr_of_symb_BT_reduction_BT_REDUC_tree_count_fct(const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp, const __parsec_BT_reduction_BT_REDUC_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return BT_reduction_BT_REDUC_inline_c_expr9_line_123(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_BT_reduction_BT_REDUC_tree_count = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_BT_reduction_BT_REDUC_tree_count_fct }
+                   }
+};
+static const parsec_symbol_t symb_BT_reduction_BT_REDUC_tree_count = { .name = "tree_count", .context_index = 0, .min = &expr_of_symb_BT_reduction_BT_REDUC_tree_count, .max = &expr_of_symb_BT_reduction_BT_REDUC_tree_count, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t minexpr_of_symb_BT_reduction_BT_REDUC_t_fct(const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp, const __parsec_BT_reduction_BT_REDUC_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 1;
+}
+static const parsec_expr_t minexpr_of_symb_BT_reduction_BT_REDUC_t = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_BT_reduction_BT_REDUC_t_fct }
+                   }
+};
+static inline int maxexpr_of_symb_BT_reduction_BT_REDUC_t_fct(const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp, const __parsec_BT_reduction_BT_REDUC_parsec_assignment_t *locals)
+{
+  const int tree_count = locals->tree_count.value;
+  const int t = locals->t.value; (void)t;
+  const int sz = locals->sz.value; (void)sz;
+  const int s = locals->s.value; (void)s;
+  const int lvl = locals->lvl.value; (void)lvl;
+  const int i = locals->i.value; (void)i;
+  const int offset = locals->offset.value; (void)offset;
+
+  (void)tree_count;
+  (void)t;
+  (void)sz;
+  (void)s;
+  (void)lvl;
+  (void)i;
+  (void)offset;
+  (void)__parsec_tp; (void)locals;
+  return tree_count;
+}
+static const parsec_expr_t maxexpr_of_symb_BT_reduction_BT_REDUC_t = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_BT_reduction_BT_REDUC_t_fct }
+                   }
+};
+static const parsec_symbol_t symb_BT_reduction_BT_REDUC_t = { .name = "t", .context_index = 1, .min = &minexpr_of_symb_BT_reduction_BT_REDUC_t, .max = &maxexpr_of_symb_BT_reduction_BT_REDUC_t, .cst_inc = 1, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_BT_reduction_BT_REDUC_sz_fct(const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp, const __parsec_BT_reduction_BT_REDUC_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return BT_reduction_BT_REDUC_inline_c_expr8_line_125(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_BT_reduction_BT_REDUC_sz = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_BT_reduction_BT_REDUC_sz_fct }
+                   }
+};
+static const parsec_symbol_t symb_BT_reduction_BT_REDUC_sz = { .name = "sz", .context_index = 2, .min = &expr_of_symb_BT_reduction_BT_REDUC_sz, .max = &expr_of_symb_BT_reduction_BT_REDUC_sz, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t minexpr_of_symb_BT_reduction_BT_REDUC_s_fct(const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp, const __parsec_BT_reduction_BT_REDUC_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 1;
+}
+static const parsec_expr_t minexpr_of_symb_BT_reduction_BT_REDUC_s = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_BT_reduction_BT_REDUC_s_fct }
+                   }
+};
+static inline int maxexpr_of_symb_BT_reduction_BT_REDUC_s_fct(const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp, const __parsec_BT_reduction_BT_REDUC_parsec_assignment_t *locals)
+{
+  const int tree_count = locals->tree_count.value; (void)tree_count;
+  const int t = locals->t.value; (void)t;
+  const int sz = locals->sz.value;
+  const int s = locals->s.value; (void)s;
+  const int lvl = locals->lvl.value; (void)lvl;
+  const int i = locals->i.value; (void)i;
+  const int offset = locals->offset.value; (void)offset;
+
+  (void)tree_count;
+  (void)t;
+  (void)sz;
+  (void)s;
+  (void)lvl;
+  (void)i;
+  (void)offset;
+  (void)__parsec_tp; (void)locals;
+  return sz;
+}
+static const parsec_expr_t maxexpr_of_symb_BT_reduction_BT_REDUC_s = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_BT_reduction_BT_REDUC_s_fct }
+                   }
+};
+static const parsec_symbol_t symb_BT_reduction_BT_REDUC_s = { .name = "s", .context_index = 3, .min = &minexpr_of_symb_BT_reduction_BT_REDUC_s, .max = &maxexpr_of_symb_BT_reduction_BT_REDUC_s, .cst_inc = 1, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int expr_of_symb_BT_reduction_BT_REDUC_lvl_fct(const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp, const __parsec_BT_reduction_BT_REDUC_parsec_assignment_t *locals)
+{
+  const int tree_count = locals->tree_count.value; (void)tree_count;
+  const int t = locals->t.value; (void)t;
+  const int sz = locals->sz.value; (void)sz;
+  const int s = locals->s.value; (void)s;
+  const int lvl = locals->lvl.value; (void)lvl;
+  const int i = locals->i.value; (void)i;
+  const int offset = locals->offset.value; (void)offset;
+
+  (void)tree_count;
+  (void)t;
+  (void)sz;
+  (void)s;
+  (void)lvl;
+  (void)i;
+  (void)offset;
+  (void)__parsec_tp; (void)locals;
+  return (sz - s);
+}
+static const parsec_expr_t expr_of_symb_BT_reduction_BT_REDUC_lvl = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_BT_reduction_BT_REDUC_lvl_fct }
+                   }
+};
+static const parsec_symbol_t symb_BT_reduction_BT_REDUC_lvl = { .name = "lvl", .context_index = 4, .min = &expr_of_symb_BT_reduction_BT_REDUC_lvl, .max = &expr_of_symb_BT_reduction_BT_REDUC_lvl, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t minexpr_of_symb_BT_reduction_BT_REDUC_i_fct(const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp, const __parsec_BT_reduction_BT_REDUC_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_BT_reduction_BT_REDUC_i = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_BT_reduction_BT_REDUC_i_fct }
+                   }
+};
+static inline int32_t maxexpr_of_symb_BT_reduction_BT_REDUC_i_fct(const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp, const __parsec_BT_reduction_BT_REDUC_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return BT_reduction_BT_REDUC_inline_c_expr7_line_128(__parsec_tp, locals);
+}
+static const parsec_expr_t maxexpr_of_symb_BT_reduction_BT_REDUC_i = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_BT_reduction_BT_REDUC_i_fct }
+                   }
+};
+static const parsec_symbol_t symb_BT_reduction_BT_REDUC_i = { .name = "i", .context_index = 5, .min = &minexpr_of_symb_BT_reduction_BT_REDUC_i, .max = &maxexpr_of_symb_BT_reduction_BT_REDUC_i, .cst_inc = 1, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_BT_reduction_BT_REDUC_offset_fct(const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp, const __parsec_BT_reduction_BT_REDUC_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return BT_reduction_BT_REDUC_inline_c_expr6_line_129(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_BT_reduction_BT_REDUC_offset = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_BT_reduction_BT_REDUC_offset_fct }
+                   }
+};
+static const parsec_symbol_t symb_BT_reduction_BT_REDUC_offset = { .name = "offset", .context_index = 6, .min = &expr_of_symb_BT_reduction_BT_REDUC_offset, .max = &expr_of_symb_BT_reduction_BT_REDUC_offset, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int affinity_of_BT_reduction_BT_REDUC(const __parsec_BT_reduction_BT_REDUC_task_t *this_task,
+                     parsec_data_ref_t *ref)
+{
+    const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp = (const __parsec_BT_reduction_internal_taskpool_t*)this_task->taskpool;
+  const int tree_count = this_task->locals.tree_count.value; (void)tree_count;
+  const int t = this_task->locals.t.value; (void)t;
+  const int sz = this_task->locals.sz.value; (void)sz;
+  const int s = this_task->locals.s.value; (void)s;
+  const int lvl = this_task->locals.lvl.value; (void)lvl;
+  const int i = this_task->locals.i.value; (void)i;
+  const int offset = this_task->locals.offset.value; (void)offset;
+
+  /* Silent Warnings: should look into predicate to know what variables are usefull */
+  (void)tree_count;
+  (void)t;
+  (void)sz;
+  (void)s;
+  (void)lvl;
+  (void)i;
+  (void)offset;
+  ref->dc = (parsec_data_collection_t *)__parsec_tp->super._g_dataA;
+  /* Compute data key */
+  ref->key = ref->dc->data_key(ref->dc, (offset + (i * 2)), 0);
+  return 1;
+}
+static const parsec_property_t properties_of_BT_reduction_BT_REDUC[1] = {
+  {.name = NULL, .expr = NULL}
+};
+static inline int expr_of_cond_for_flow_of_BT_reduction_BT_REDUC_for_B_dep1_atline_138_iftrue_fct(const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp, const __parsec_BT_reduction_BT_REDUC_parsec_assignment_t *locals)
+{
+  const int tree_count = locals->tree_count.value; (void)tree_count;
+  const int t = locals->t.value; (void)t;
+  const int sz = locals->sz.value; (void)sz;
+  const int s = locals->s.value;
+  const int lvl = locals->lvl.value; (void)lvl;
+  const int i = locals->i.value; (void)i;
+  const int offset = locals->offset.value; (void)offset;
+
+  (void)tree_count;
+  (void)t;
+  (void)sz;
+  (void)s;
+  (void)lvl;
+  (void)i;
+  (void)offset;
+  (void)__parsec_tp; (void)locals;
+  return (1) == (s);
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_BT_reduction_BT_REDUC_for_B_dep1_atline_138_iftrue = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_BT_reduction_BT_REDUC_for_B_dep1_atline_138_iftrue_fct }
+                   }
+};
+static const parsec_dep_t flow_of_BT_reduction_BT_REDUC_for_B_dep1_atline_138_iftrue = {
+  .cond = &expr_of_cond_for_flow_of_BT_reduction_BT_REDUC_for_B_dep1_atline_138_iftrue,  /* (1) == (s) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 0, /* BT_reduction_REDUCTION */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_BT_reduction_REDUCTION_for_A,
+  .dep_index = 1,
+  .dep_datatype_index = 1,
+  .belongs_to = &flow_of_BT_reduction_BT_REDUC_for_B,
+};
+static inline int expr_of_cond_for_flow_of_BT_reduction_BT_REDUC_for_B_dep1_atline_138_iffalse_fct(const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp, const __parsec_BT_reduction_BT_REDUC_parsec_assignment_t *locals)
+{
+  const int tree_count = locals->tree_count.value; (void)tree_count;
+  const int t = locals->t.value; (void)t;
+  const int sz = locals->sz.value; (void)sz;
+  const int s = locals->s.value;
+  const int lvl = locals->lvl.value; (void)lvl;
+  const int i = locals->i.value; (void)i;
+  const int offset = locals->offset.value; (void)offset;
+
+  (void)tree_count;
+  (void)t;
+  (void)sz;
+  (void)s;
+  (void)lvl;
+  (void)i;
+  (void)offset;
+  (void)__parsec_tp; (void)locals;
+  return !((1) == (s));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_BT_reduction_BT_REDUC_for_B_dep1_atline_138_iffalse = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_BT_reduction_BT_REDUC_for_B_dep1_atline_138_iffalse_fct }
+                   }
+};
+static const parsec_dep_t flow_of_BT_reduction_BT_REDUC_for_B_dep1_atline_138_iffalse = {
+  .cond = &expr_of_cond_for_flow_of_BT_reduction_BT_REDUC_for_B_dep1_atline_138_iffalse,  /* !(1) == (s) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 1, /* BT_reduction_BT_REDUC */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_BT_reduction_BT_REDUC_for_B,
+  .dep_index = 1,
+  .dep_datatype_index = 1,
+  .belongs_to = &flow_of_BT_reduction_BT_REDUC_for_B,
+};
+static inline int expr_of_cond_for_flow_of_BT_reduction_BT_REDUC_for_B_dep2_atline_139_fct(const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp, const __parsec_BT_reduction_BT_REDUC_parsec_assignment_t *locals)
+{
+  const int tree_count = locals->tree_count.value; (void)tree_count;
+  const int t = locals->t.value; (void)t;
+  const int sz = locals->sz.value; (void)sz;
+  const int s = locals->s.value; (void)s;
+  const int lvl = locals->lvl.value; (void)lvl;
+  const int i = locals->i.value; (void)i;
+  const int offset = locals->offset.value; (void)offset;
+
+  (void)tree_count;
+  (void)t;
+  (void)sz;
+  (void)s;
+  (void)lvl;
+  (void)i;
+  (void)offset;
+  (void)__parsec_tp; (void)locals;
+  return ((sz) != (s) && (0) == ((i % 2)));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_BT_reduction_BT_REDUC_for_B_dep2_atline_139 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_BT_reduction_BT_REDUC_for_B_dep2_atline_139_fct }
+                   }
+};
+static const parsec_dep_t flow_of_BT_reduction_BT_REDUC_for_B_dep2_atline_139 = {
+  .cond = &expr_of_cond_for_flow_of_BT_reduction_BT_REDUC_for_B_dep2_atline_139,  /* ((sz) != (s) && (0) == ((i % 2))) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 1, /* BT_reduction_BT_REDUC */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_BT_reduction_BT_REDUC_for_A,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_BT_reduction_BT_REDUC_for_B,
+};
+static inline int expr_of_cond_for_flow_of_BT_reduction_BT_REDUC_for_B_dep3_atline_140_fct(const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp, const __parsec_BT_reduction_BT_REDUC_parsec_assignment_t *locals)
+{
+  const int tree_count = locals->tree_count.value; (void)tree_count;
+  const int t = locals->t.value; (void)t;
+  const int sz = locals->sz.value; (void)sz;
+  const int s = locals->s.value; (void)s;
+  const int lvl = locals->lvl.value; (void)lvl;
+  const int i = locals->i.value; (void)i;
+  const int offset = locals->offset.value; (void)offset;
+
+  (void)tree_count;
+  (void)t;
+  (void)sz;
+  (void)s;
+  (void)lvl;
+  (void)i;
+  (void)offset;
+  (void)__parsec_tp; (void)locals;
+  return ((sz) != (s) && (0) != ((i % 2)));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_BT_reduction_BT_REDUC_for_B_dep3_atline_140 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_BT_reduction_BT_REDUC_for_B_dep3_atline_140_fct }
+                   }
+};
+static const parsec_dep_t flow_of_BT_reduction_BT_REDUC_for_B_dep3_atline_140 = {
+  .cond = &expr_of_cond_for_flow_of_BT_reduction_BT_REDUC_for_B_dep3_atline_140,  /* ((sz) != (s) && (0) != ((i % 2))) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 1, /* BT_reduction_BT_REDUC */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_BT_reduction_BT_REDUC_for_B,
+  .dep_index = 1,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_BT_reduction_BT_REDUC_for_B,
+};
+static inline int expr_of_cond_for_flow_of_BT_reduction_BT_REDUC_for_B_dep4_atline_141_fct(const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp, const __parsec_BT_reduction_BT_REDUC_parsec_assignment_t *locals)
+{
+  const int tree_count = locals->tree_count.value; (void)tree_count;
+  const int t = locals->t.value; (void)t;
+  const int sz = locals->sz.value; (void)sz;
+  const int s = locals->s.value; (void)s;
+  const int lvl = locals->lvl.value; (void)lvl;
+  const int i = locals->i.value; (void)i;
+  const int offset = locals->offset.value; (void)offset;
+
+  (void)tree_count;
+  (void)t;
+  (void)sz;
+  (void)s;
+  (void)lvl;
+  (void)i;
+  (void)offset;
+  (void)__parsec_tp; (void)locals;
+  return (sz) == (s);
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_BT_reduction_BT_REDUC_for_B_dep4_atline_141 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_BT_reduction_BT_REDUC_for_B_dep4_atline_141_fct }
+                   }
+};
+static const parsec_dep_t flow_of_BT_reduction_BT_REDUC_for_B_dep4_atline_141 = {
+  .cond = &expr_of_cond_for_flow_of_BT_reduction_BT_REDUC_for_B_dep4_atline_141,  /* (sz) == (s) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 2, /* BT_reduction_LINEAR_REDUC */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_BT_reduction_LINEAR_REDUC_for_C,
+  .dep_index = 2,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_BT_reduction_BT_REDUC_for_B,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+#if MAX_DEP_OUT_COUNT < 3  /* number of output dependencies */
+    #error Too many output dependencies (supports up to MAX_DEP_OUT_COUNT [=10] but found 3). Fix the code or recompile PaRSEC with a larger MAX_DEP_OUT_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_BT_reduction_BT_REDUC_for_B = {
+  .name               = "B",
+  .sym_type           = PARSEC_SYM_INOUT,
+  .flow_flags         = PARSEC_FLOW_ACCESS_RW,
+  .flow_index         = 0,
+  .flow_datatype_mask = 0x1,
+  .dep_in     = { &flow_of_BT_reduction_BT_REDUC_for_B_dep1_atline_138_iftrue,
+ &flow_of_BT_reduction_BT_REDUC_for_B_dep1_atline_138_iffalse },
+  .dep_out    = { &flow_of_BT_reduction_BT_REDUC_for_B_dep2_atline_139,
+ &flow_of_BT_reduction_BT_REDUC_for_B_dep3_atline_140,
+ &flow_of_BT_reduction_BT_REDUC_for_B_dep4_atline_141 }
+};
+
+static inline int expr_of_cond_for_flow_of_BT_reduction_BT_REDUC_for_A_dep1_atline_136_iftrue_fct(const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp, const __parsec_BT_reduction_BT_REDUC_parsec_assignment_t *locals)
+{
+  const int tree_count = locals->tree_count.value; (void)tree_count;
+  const int t = locals->t.value; (void)t;
+  const int sz = locals->sz.value; (void)sz;
+  const int s = locals->s.value;
+  const int lvl = locals->lvl.value; (void)lvl;
+  const int i = locals->i.value; (void)i;
+  const int offset = locals->offset.value; (void)offset;
+
+  (void)tree_count;
+  (void)t;
+  (void)sz;
+  (void)s;
+  (void)lvl;
+  (void)i;
+  (void)offset;
+  (void)__parsec_tp; (void)locals;
+  return (1) == (s);
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_BT_reduction_BT_REDUC_for_A_dep1_atline_136_iftrue = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_BT_reduction_BT_REDUC_for_A_dep1_atline_136_iftrue_fct }
+                   }
+};
+static const parsec_dep_t flow_of_BT_reduction_BT_REDUC_for_A_dep1_atline_136_iftrue = {
+  .cond = &expr_of_cond_for_flow_of_BT_reduction_BT_REDUC_for_A_dep1_atline_136_iftrue,  /* (1) == (s) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 0, /* BT_reduction_REDUCTION */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_BT_reduction_REDUCTION_for_A,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_BT_reduction_BT_REDUC_for_A,
+};
+static inline int expr_of_cond_for_flow_of_BT_reduction_BT_REDUC_for_A_dep1_atline_136_iffalse_fct(const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp, const __parsec_BT_reduction_BT_REDUC_parsec_assignment_t *locals)
+{
+  const int tree_count = locals->tree_count.value; (void)tree_count;
+  const int t = locals->t.value; (void)t;
+  const int sz = locals->sz.value; (void)sz;
+  const int s = locals->s.value;
+  const int lvl = locals->lvl.value; (void)lvl;
+  const int i = locals->i.value; (void)i;
+  const int offset = locals->offset.value; (void)offset;
+
+  (void)tree_count;
+  (void)t;
+  (void)sz;
+  (void)s;
+  (void)lvl;
+  (void)i;
+  (void)offset;
+  (void)__parsec_tp; (void)locals;
+  return !((1) == (s));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_BT_reduction_BT_REDUC_for_A_dep1_atline_136_iffalse = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_BT_reduction_BT_REDUC_for_A_dep1_atline_136_iffalse_fct }
+                   }
+};
+static const parsec_dep_t flow_of_BT_reduction_BT_REDUC_for_A_dep1_atline_136_iffalse = {
+  .cond = &expr_of_cond_for_flow_of_BT_reduction_BT_REDUC_for_A_dep1_atline_136_iffalse,  /* !(1) == (s) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 1, /* BT_reduction_BT_REDUC */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_BT_reduction_BT_REDUC_for_B,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_BT_reduction_BT_REDUC_for_A,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_BT_reduction_BT_REDUC_for_A = {
+  .name               = "A",
+  .sym_type           = PARSEC_SYM_IN,
+  .flow_flags         = PARSEC_FLOW_ACCESS_READ,
+  .flow_index         = 1,
+  .flow_datatype_mask = 0x0,
+  .dep_in     = { &flow_of_BT_reduction_BT_REDUC_for_A_dep1_atline_136_iftrue,
+ &flow_of_BT_reduction_BT_REDUC_for_A_dep1_atline_136_iffalse },
+  .dep_out    = { NULL }
+};
+
+static void
+iterate_successors_of_BT_reduction_BT_REDUC(parsec_execution_stream_t *es, const __parsec_BT_reduction_BT_REDUC_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp = (const __parsec_BT_reduction_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_BT_reduction_BT_REDUC_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_BT_reduction_BT_REDUC_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int tree_count = __jdf2c__tmp_locals.tree_count.value; (void)tree_count;
+  const int t = __jdf2c__tmp_locals.t.value; (void)t;
+  const int sz = __jdf2c__tmp_locals.sz.value; (void)sz;
+  const int s = __jdf2c__tmp_locals.s.value; (void)s;
+  const int lvl = __jdf2c__tmp_locals.lvl.value; (void)lvl;
+  const int i = __jdf2c__tmp_locals.i.value; (void)i;
+  const int offset = __jdf2c__tmp_locals.offset.value; (void)offset;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)tree_count;  (void)t;  (void)sz;  (void)s;  (void)lvl;  (void)i;  (void)offset;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_dataA((offset + (i * 2)), 0);
+#endif
+  if( action_mask & 0x7 ) {  /* Flow of data B [0] */
+    data.data   = this_task->data._f_B.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x1 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_BT_reduction_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_BT_reduction_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( ((sz) != (s) && (0) == ((i % 2))) ) {
+      __parsec_BT_reduction_BT_REDUC_task_t* ncc = (__parsec_BT_reduction_BT_REDUC_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[BT_reduction_BT_REDUC.task_class_id];
+        const int BT_REDUC_tree_count = BT_reduction_BT_REDUC_inline_c_expr9_line_123(__parsec_tp, &ncc->locals);
+        assert(&nc.locals[0].value == &ncc->locals.tree_count.value);
+        ncc->locals.tree_count.value = BT_REDUC_tree_count;
+        const int BT_REDUC_t = t;
+        if( (BT_REDUC_t >= (1)) && (BT_REDUC_t <= (ncc->locals.tree_count.value)) ) {
+          assert(&nc.locals[1].value == &ncc->locals.t.value);
+          ncc->locals.t.value = BT_REDUC_t;
+          const int BT_REDUC_sz = BT_reduction_BT_REDUC_inline_c_expr8_line_125(__parsec_tp, &ncc->locals);
+          assert(&nc.locals[2].value == &ncc->locals.sz.value);
+          ncc->locals.sz.value = BT_REDUC_sz;
+          const int BT_REDUC_s = (s + 1);
+          if( (BT_REDUC_s >= (1)) && (BT_REDUC_s <= (ncc->locals.sz.value)) ) {
+            assert(&nc.locals[3].value == &ncc->locals.s.value);
+            ncc->locals.s.value = BT_REDUC_s;
+            const int BT_REDUC_lvl = (ncc->locals.sz.value - ncc->locals.s.value);
+            assert(&nc.locals[4].value == &ncc->locals.lvl.value);
+            ncc->locals.lvl.value = BT_REDUC_lvl;
+            const int BT_REDUC_i = (i / 2);
+            if( (BT_REDUC_i >= (0)) && (BT_REDUC_i <= (BT_reduction_BT_REDUC_inline_c_expr7_line_128(__parsec_tp, &ncc->locals))) ) {
+              assert(&nc.locals[5].value == &ncc->locals.i.value);
+              ncc->locals.i.value = BT_REDUC_i;
+              const int BT_REDUC_offset = BT_reduction_BT_REDUC_inline_c_expr6_line_129(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[6].value == &ncc->locals.offset.value);
+              ncc->locals.offset.value = BT_REDUC_offset;
+#if defined(DISTRIBUTED)
+              rank_dst = rank_of_dataA((ncc->locals.offset.value + (ncc->locals.i.value * 2)), 0);
+              if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+                vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_dataA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_dataA, (ncc->locals.offset.value + (ncc->locals.i.value * 2)), 0);
+              nc.priority = __parsec_tp->super.super.priority;
+              successor_repo = BT_REDUC_repo;
+              successor_repo_key = __jdf2c_make_key_BT_REDUC((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+            RELEASE_DEP_OUTPUT(es, "B", this_task, "A", &nc, rank_src, rank_dst, &data);
+            if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_BT_reduction_BT_REDUC_for_B_dep2_atline_139, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+              }
+            }
+          }
+    }
+  }
+  if( action_mask & 0x2 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_BT_reduction_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_BT_reduction_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( ((sz) != (s) && (0) != ((i % 2))) ) {
+      __parsec_BT_reduction_BT_REDUC_task_t* ncc = (__parsec_BT_reduction_BT_REDUC_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[BT_reduction_BT_REDUC.task_class_id];
+        const int BT_REDUC_tree_count = BT_reduction_BT_REDUC_inline_c_expr9_line_123(__parsec_tp, &ncc->locals);
+        assert(&nc.locals[0].value == &ncc->locals.tree_count.value);
+        ncc->locals.tree_count.value = BT_REDUC_tree_count;
+        const int BT_REDUC_t = t;
+        if( (BT_REDUC_t >= (1)) && (BT_REDUC_t <= (ncc->locals.tree_count.value)) ) {
+          assert(&nc.locals[1].value == &ncc->locals.t.value);
+          ncc->locals.t.value = BT_REDUC_t;
+          const int BT_REDUC_sz = BT_reduction_BT_REDUC_inline_c_expr8_line_125(__parsec_tp, &ncc->locals);
+          assert(&nc.locals[2].value == &ncc->locals.sz.value);
+          ncc->locals.sz.value = BT_REDUC_sz;
+          const int BT_REDUC_s = (s + 1);
+          if( (BT_REDUC_s >= (1)) && (BT_REDUC_s <= (ncc->locals.sz.value)) ) {
+            assert(&nc.locals[3].value == &ncc->locals.s.value);
+            ncc->locals.s.value = BT_REDUC_s;
+            const int BT_REDUC_lvl = (ncc->locals.sz.value - ncc->locals.s.value);
+            assert(&nc.locals[4].value == &ncc->locals.lvl.value);
+            ncc->locals.lvl.value = BT_REDUC_lvl;
+            const int BT_REDUC_i = (i / 2);
+            if( (BT_REDUC_i >= (0)) && (BT_REDUC_i <= (BT_reduction_BT_REDUC_inline_c_expr7_line_128(__parsec_tp, &ncc->locals))) ) {
+              assert(&nc.locals[5].value == &ncc->locals.i.value);
+              ncc->locals.i.value = BT_REDUC_i;
+              const int BT_REDUC_offset = BT_reduction_BT_REDUC_inline_c_expr6_line_129(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[6].value == &ncc->locals.offset.value);
+              ncc->locals.offset.value = BT_REDUC_offset;
+#if defined(DISTRIBUTED)
+              rank_dst = rank_of_dataA((ncc->locals.offset.value + (ncc->locals.i.value * 2)), 0);
+              if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+                vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_dataA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_dataA, (ncc->locals.offset.value + (ncc->locals.i.value * 2)), 0);
+              nc.priority = __parsec_tp->super.super.priority;
+              successor_repo = BT_REDUC_repo;
+              successor_repo_key = __jdf2c_make_key_BT_REDUC((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+            RELEASE_DEP_OUTPUT(es, "B", this_task, "B", &nc, rank_src, rank_dst, &data);
+            if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_BT_reduction_BT_REDUC_for_B_dep3_atline_140, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+              }
+            }
+          }
+    }
+  }
+  if( action_mask & 0x4 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_BT_reduction_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_BT_reduction_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( (sz) == (s) ) {
+      __parsec_BT_reduction_LINEAR_REDUC_task_t* ncc = (__parsec_BT_reduction_LINEAR_REDUC_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[BT_reduction_LINEAR_REDUC.task_class_id];
+        const int LINEAR_REDUC_tree_count = BT_reduction_LINEAR_REDUC_inline_c_expr5_line_157(__parsec_tp, &ncc->locals);
+        assert(&nc.locals[0].value == &ncc->locals.tree_count.value);
+        ncc->locals.tree_count.value = LINEAR_REDUC_tree_count;
+        const int LINEAR_REDUC_i = t;
+        if( (LINEAR_REDUC_i >= (1)) && (LINEAR_REDUC_i <= (ncc->locals.tree_count.value)) ) {
+          assert(&nc.locals[1].value == &ncc->locals.i.value);
+          ncc->locals.i.value = LINEAR_REDUC_i;
+          const int LINEAR_REDUC_sz = BT_reduction_LINEAR_REDUC_inline_c_expr4_line_159(__parsec_tp, &ncc->locals);
+          assert(&nc.locals[2].value == &ncc->locals.sz.value);
+          ncc->locals.sz.value = LINEAR_REDUC_sz;
+          const int LINEAR_REDUC_offset = BT_reduction_LINEAR_REDUC_inline_c_expr3_line_160(__parsec_tp, &ncc->locals);
+          assert(&nc.locals[3].value == &ncc->locals.offset.value);
+          ncc->locals.offset.value = LINEAR_REDUC_offset;
+#if defined(DISTRIBUTED)
+          rank_dst = rank_of_dataA(ncc->locals.offset.value, 0);
+          if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+            vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_dataA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_dataA, ncc->locals.offset.value, 0);
+          nc.priority = __parsec_tp->super.super.priority;
+          successor_repo = LINEAR_REDUC_repo;
+          successor_repo_key = __jdf2c_make_key_LINEAR_REDUC((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+        RELEASE_DEP_OUTPUT(es, "B", this_task, "C", &nc, rank_src, rank_dst, &data);
+        if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_BT_reduction_BT_REDUC_for_B_dep4_atline_141, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+          }
+    }
+  }
+  }
+  /* Flow of data A has only IN dependencies */
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static void
+iterate_predecessors_of_BT_reduction_BT_REDUC(parsec_execution_stream_t *es, const __parsec_BT_reduction_BT_REDUC_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp = (const __parsec_BT_reduction_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_BT_reduction_BT_REDUC_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_BT_reduction_BT_REDUC_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int tree_count = __jdf2c__tmp_locals.tree_count.value; (void)tree_count;
+  const int t = __jdf2c__tmp_locals.t.value; (void)t;
+  const int sz = __jdf2c__tmp_locals.sz.value; (void)sz;
+  const int s = __jdf2c__tmp_locals.s.value; (void)s;
+  const int lvl = __jdf2c__tmp_locals.lvl.value; (void)lvl;
+  const int i = __jdf2c__tmp_locals.i.value; (void)i;
+  const int offset = __jdf2c__tmp_locals.offset.value; (void)offset;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)tree_count;  (void)t;  (void)sz;  (void)s;  (void)lvl;  (void)i;  (void)offset;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_dataA((offset + (i * 2)), 0);
+#endif
+  if( action_mask & 0x2 ) {  /* Flow of data B [0] */
+    data.data   = this_task->data._f_B.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x2 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_BT_reduction_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_BT_reduction_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( (1) == (s) ) {
+      __parsec_BT_reduction_REDUCTION_task_t* ncc = (__parsec_BT_reduction_REDUCTION_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[BT_reduction_REDUCTION.task_class_id];
+        const int REDUCTION_i = ((offset + (i * 2)) + 1);
+        if( (REDUCTION_i >= (0)) && (REDUCTION_i <= ((NT - 1))) ) {
+          assert(&nc.locals[0].value == &ncc->locals.i.value);
+          ncc->locals.i.value = REDUCTION_i;
+          const int REDUCTION_t = BT_reduction_REDUCTION_inline_c_expr12_line_104(__parsec_tp, &ncc->locals);
+          assert(&nc.locals[1].value == &ncc->locals.t.value);
+          ncc->locals.t.value = REDUCTION_t;
+          const int REDUCTION_li = BT_reduction_REDUCTION_inline_c_expr11_line_105(__parsec_tp, &ncc->locals);
+          assert(&nc.locals[2].value == &ncc->locals.li.value);
+          ncc->locals.li.value = REDUCTION_li;
+          const int REDUCTION_sz = BT_reduction_REDUCTION_inline_c_expr10_line_106(__parsec_tp, &ncc->locals);
+          assert(&nc.locals[3].value == &ncc->locals.sz.value);
+          ncc->locals.sz.value = REDUCTION_sz;
+#if defined(DISTRIBUTED)
+          rank_dst = rank_of_dataA(ncc->locals.i.value, 0);
+          if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+            vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_dataA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_dataA, ncc->locals.i.value, 0);
+          nc.priority = __parsec_tp->super.super.priority;
+          successor_repo = NULL;
+          successor_repo_key = 0;
+        RELEASE_DEP_OUTPUT(es, "B", this_task, "A", &nc, rank_src, rank_dst, &data);
+        if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_BT_reduction_BT_REDUC_for_B_dep1_atline_138_iftrue, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+          }
+    } else {
+      __parsec_BT_reduction_BT_REDUC_task_t* ncc = (__parsec_BT_reduction_BT_REDUC_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[BT_reduction_BT_REDUC.task_class_id];
+        const int BT_REDUC_tree_count = BT_reduction_BT_REDUC_inline_c_expr9_line_123(__parsec_tp, &ncc->locals);
+        assert(&nc.locals[0].value == &ncc->locals.tree_count.value);
+        ncc->locals.tree_count.value = BT_REDUC_tree_count;
+        const int BT_REDUC_t = t;
+        if( (BT_REDUC_t >= (1)) && (BT_REDUC_t <= (ncc->locals.tree_count.value)) ) {
+          assert(&nc.locals[1].value == &ncc->locals.t.value);
+          ncc->locals.t.value = BT_REDUC_t;
+          const int BT_REDUC_sz = BT_reduction_BT_REDUC_inline_c_expr8_line_125(__parsec_tp, &ncc->locals);
+          assert(&nc.locals[2].value == &ncc->locals.sz.value);
+          ncc->locals.sz.value = BT_REDUC_sz;
+          const int BT_REDUC_s = (s - 1);
+          if( (BT_REDUC_s >= (1)) && (BT_REDUC_s <= (ncc->locals.sz.value)) ) {
+            assert(&nc.locals[3].value == &ncc->locals.s.value);
+            ncc->locals.s.value = BT_REDUC_s;
+            const int BT_REDUC_lvl = (ncc->locals.sz.value - ncc->locals.s.value);
+            assert(&nc.locals[4].value == &ncc->locals.lvl.value);
+            ncc->locals.lvl.value = BT_REDUC_lvl;
+            const int BT_REDUC_i = ((i * 2) + 1);
+            if( (BT_REDUC_i >= (0)) && (BT_REDUC_i <= (BT_reduction_BT_REDUC_inline_c_expr7_line_128(__parsec_tp, &ncc->locals))) ) {
+              assert(&nc.locals[5].value == &ncc->locals.i.value);
+              ncc->locals.i.value = BT_REDUC_i;
+              const int BT_REDUC_offset = BT_reduction_BT_REDUC_inline_c_expr6_line_129(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[6].value == &ncc->locals.offset.value);
+              ncc->locals.offset.value = BT_REDUC_offset;
+#if defined(DISTRIBUTED)
+              rank_dst = rank_of_dataA((ncc->locals.offset.value + (ncc->locals.i.value * 2)), 0);
+              if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+                vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_dataA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_dataA, (ncc->locals.offset.value + (ncc->locals.i.value * 2)), 0);
+              nc.priority = __parsec_tp->super.super.priority;
+              successor_repo = BT_REDUC_repo;
+              successor_repo_key = __jdf2c_make_key_BT_REDUC((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+            RELEASE_DEP_OUTPUT(es, "B", this_task, "B", &nc, rank_src, rank_dst, &data);
+            if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_BT_reduction_BT_REDUC_for_B_dep1_atline_138_iffalse, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+              }
+            }
+          }
+    }
+  }
+  }
+  if( action_mask & 0x1 ) {  /* Flow of data A [1] */
+    data.data   = this_task->data._f_A.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x1 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_BT_reduction_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_BT_reduction_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( (1) == (s) ) {
+      __parsec_BT_reduction_REDUCTION_task_t* ncc = (__parsec_BT_reduction_REDUCTION_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[BT_reduction_REDUCTION.task_class_id];
+        const int REDUCTION_i = (offset + (i * 2));
+        if( (REDUCTION_i >= (0)) && (REDUCTION_i <= ((NT - 1))) ) {
+          assert(&nc.locals[0].value == &ncc->locals.i.value);
+          ncc->locals.i.value = REDUCTION_i;
+          const int REDUCTION_t = BT_reduction_REDUCTION_inline_c_expr12_line_104(__parsec_tp, &ncc->locals);
+          assert(&nc.locals[1].value == &ncc->locals.t.value);
+          ncc->locals.t.value = REDUCTION_t;
+          const int REDUCTION_li = BT_reduction_REDUCTION_inline_c_expr11_line_105(__parsec_tp, &ncc->locals);
+          assert(&nc.locals[2].value == &ncc->locals.li.value);
+          ncc->locals.li.value = REDUCTION_li;
+          const int REDUCTION_sz = BT_reduction_REDUCTION_inline_c_expr10_line_106(__parsec_tp, &ncc->locals);
+          assert(&nc.locals[3].value == &ncc->locals.sz.value);
+          ncc->locals.sz.value = REDUCTION_sz;
+#if defined(DISTRIBUTED)
+          rank_dst = rank_of_dataA(ncc->locals.i.value, 0);
+          if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+            vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_dataA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_dataA, ncc->locals.i.value, 0);
+          nc.priority = __parsec_tp->super.super.priority;
+          successor_repo = NULL;
+          successor_repo_key = 0;
+        RELEASE_DEP_OUTPUT(es, "A", this_task, "A", &nc, rank_src, rank_dst, &data);
+        if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_BT_reduction_BT_REDUC_for_A_dep1_atline_136_iftrue, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+          }
+    } else {
+      __parsec_BT_reduction_BT_REDUC_task_t* ncc = (__parsec_BT_reduction_BT_REDUC_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[BT_reduction_BT_REDUC.task_class_id];
+        const int BT_REDUC_tree_count = BT_reduction_BT_REDUC_inline_c_expr9_line_123(__parsec_tp, &ncc->locals);
+        assert(&nc.locals[0].value == &ncc->locals.tree_count.value);
+        ncc->locals.tree_count.value = BT_REDUC_tree_count;
+        const int BT_REDUC_t = t;
+        if( (BT_REDUC_t >= (1)) && (BT_REDUC_t <= (ncc->locals.tree_count.value)) ) {
+          assert(&nc.locals[1].value == &ncc->locals.t.value);
+          ncc->locals.t.value = BT_REDUC_t;
+          const int BT_REDUC_sz = BT_reduction_BT_REDUC_inline_c_expr8_line_125(__parsec_tp, &ncc->locals);
+          assert(&nc.locals[2].value == &ncc->locals.sz.value);
+          ncc->locals.sz.value = BT_REDUC_sz;
+          const int BT_REDUC_s = (s - 1);
+          if( (BT_REDUC_s >= (1)) && (BT_REDUC_s <= (ncc->locals.sz.value)) ) {
+            assert(&nc.locals[3].value == &ncc->locals.s.value);
+            ncc->locals.s.value = BT_REDUC_s;
+            const int BT_REDUC_lvl = (ncc->locals.sz.value - ncc->locals.s.value);
+            assert(&nc.locals[4].value == &ncc->locals.lvl.value);
+            ncc->locals.lvl.value = BT_REDUC_lvl;
+            const int BT_REDUC_i = (i * 2);
+            if( (BT_REDUC_i >= (0)) && (BT_REDUC_i <= (BT_reduction_BT_REDUC_inline_c_expr7_line_128(__parsec_tp, &ncc->locals))) ) {
+              assert(&nc.locals[5].value == &ncc->locals.i.value);
+              ncc->locals.i.value = BT_REDUC_i;
+              const int BT_REDUC_offset = BT_reduction_BT_REDUC_inline_c_expr6_line_129(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[6].value == &ncc->locals.offset.value);
+              ncc->locals.offset.value = BT_REDUC_offset;
+#if defined(DISTRIBUTED)
+              rank_dst = rank_of_dataA((ncc->locals.offset.value + (ncc->locals.i.value * 2)), 0);
+              if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+                vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_dataA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_dataA, (ncc->locals.offset.value + (ncc->locals.i.value * 2)), 0);
+              nc.priority = __parsec_tp->super.super.priority;
+              successor_repo = BT_REDUC_repo;
+              successor_repo_key = __jdf2c_make_key_BT_REDUC((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+            RELEASE_DEP_OUTPUT(es, "A", this_task, "B", &nc, rank_src, rank_dst, &data);
+            if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_BT_reduction_BT_REDUC_for_A_dep1_atline_136_iffalse, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+              }
+            }
+          }
+    }
+  }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static int release_deps_of_BT_reduction_BT_REDUC(parsec_execution_stream_t *es, __parsec_BT_reduction_BT_REDUC_task_t *this_task, uint32_t action_mask, parsec_remote_deps_t *deps)
+{
+  PARSEC_PINS(es, RELEASE_DEPS_BEGIN, (parsec_task_t *)this_task);  const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp = (const __parsec_BT_reduction_internal_taskpool_t *)this_task->taskpool;
+  parsec_release_dep_fct_arg_t arg;
+  int __vp_id;
+  int consume_local_repo = 0;
+  arg.action_mask = action_mask;
+  arg.output_entry = NULL;
+  arg.output_repo = NULL;
+#if defined(DISTRIBUTED)
+  arg.remote_deps = deps;
+#endif  /* defined(DISTRIBUTED) */
+  assert(NULL != es);
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS )    arg.ready_lists = alloca(sizeof(parsec_task_t *) * es->virtual_process->parsec_context->nb_vp);
+  else
+    arg.ready_lists = NULL;
+  for( __vp_id = 0; __vp_id < es->virtual_process->parsec_context->nb_vp; arg.ready_lists[__vp_id++] = NULL );
+  (void)__parsec_tp; (void)deps;
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_B.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_B.source_repo, this_task->data._f_B.source_repo_entry->ht_item.key );
+    }
+    if( NULL != this_task->data._f_A.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_A.source_repo, this_task->data._f_A.source_repo_entry->ht_item.key );
+    }
+  }
+  consume_local_repo = (this_task->repo_entry != NULL);
+  arg.output_repo = BT_REDUC_repo;
+  arg.output_entry = this_task->repo_entry;
+  arg.output_usage = 0;
+  if( action_mask & (PARSEC_ACTION_RELEASE_LOCAL_DEPS | PARSEC_ACTION_GET_REPO_ENTRY) ) {
+    arg.output_entry = data_repo_lookup_entry_and_create( es, arg.output_repo, __jdf2c_make_key_BT_REDUC((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    arg.output_entry->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(arg.output_entry->sim_exec_date == 0);
+    arg.output_entry->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  if(action_mask & ( PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE ) ){
+    /* Generate the reshape promise for the outputs that need it */
+    iterate_successors_of_BT_reduction_BT_REDUC(es, this_task, action_mask, parsec_set_up_reshape_promise, &arg);
+   }
+  iterate_successors_of_BT_reduction_BT_REDUC(es, this_task, action_mask, parsec_release_dep_fct, &arg);
+
+#if defined(DISTRIBUTED)
+  if( (action_mask & PARSEC_ACTION_SEND_REMOTE_DEPS) && (NULL != arg.remote_deps)) {
+    parsec_remote_dep_activate(es, (parsec_task_t *)this_task, arg.remote_deps, arg.remote_deps->outgoing_mask);
+  }
+#endif
+
+  if(action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS) {
+    data_repo_entry_addto_usage_limit(BT_REDUC_repo, arg.output_entry->ht_item.key, arg.output_usage);
+    __parsec_schedule_vp(es, arg.ready_lists, 0);
+  }
+      if (consume_local_repo) {
+         data_repo_entry_used_once( BT_REDUC_repo, this_task->repo_entry->ht_item.key );
+      }
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_B.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_B.data_in);
+    }
+    if( NULL != this_task->data._f_A.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_A.data_in);
+    }
+  }
+  PARSEC_PINS(es, RELEASE_DEPS_END, (parsec_task_t *)this_task);  return 0;
+}
+
+static int data_lookup_of_BT_reduction_BT_REDUC(parsec_execution_stream_t *es, __parsec_BT_reduction_BT_REDUC_task_t *this_task)
+{
+  const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp = (__parsec_BT_reduction_internal_taskpool_t *)this_task->taskpool;
+  parsec_assignment_t generic_locals[MAX_PARAM_COUNT];  /* generic task locals */
+  int target_device = 0; (void)target_device;
+  (void)__parsec_tp; (void)generic_locals; (void)es;
+  parsec_data_copy_t *chunk = NULL;
+  data_repo_t        *reshape_repo  = NULL, *consumed_repo  = NULL;
+  data_repo_entry_t  *reshape_entry = NULL, *consumed_entry = NULL;
+  parsec_key_t        reshape_entry_key = 0, consumed_entry_key = 0;
+  uint8_t             consumed_flow_index;
+  parsec_dep_data_description_t data;
+  int ret;
+  (void)reshape_repo; (void)reshape_entry; (void)reshape_entry_key;
+  (void)consumed_repo; (void)consumed_entry; (void)consumed_entry_key;
+  (void)consumed_flow_index;
+  (void)chunk; (void)data; (void)ret;
+  const int tree_count = this_task->locals.tree_count.value; (void)tree_count;
+  const int t = this_task->locals.t.value; (void)t;
+  const int sz = this_task->locals.sz.value; (void)sz;
+  const int s = this_task->locals.s.value; (void)s;
+  const int lvl = this_task->locals.lvl.value; (void)lvl;
+  const int i = this_task->locals.i.value; (void)i;
+  const int offset = this_task->locals.offset.value; (void)offset;
+  if( NULL == this_task->repo_entry ){
+    this_task->repo_entry = data_repo_lookup_entry_and_create(es, BT_REDUC_repo,                                       __jdf2c_make_key_BT_REDUC((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    data_repo_entry_addto_usage_limit(BT_REDUC_repo, this_task->repo_entry->ht_item.key, 1);    this_task->repo_entry ->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(this_task->repo_entry ->sim_exec_date == 0);
+    this_task->repo_entry ->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  /* The reshape repo is the current task repo. */  reshape_repo = BT_REDUC_repo;
+  reshape_entry_key = __jdf2c_make_key_BT_REDUC((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals) ;
+  reshape_entry = this_task->repo_entry;
+  /* Lookup the input data, and store them in the context if any */
+
+if(! this_task->data._f_B.fulfill ){ /* Flow B */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_B.data_out = NULL;  /* By default, if nothing matches */
+    if( (1) == (s) ) {
+    /* Flow B [0] dependency [1] from predecessor REDUCTION */
+    if( NULL == (chunk = this_task->data._f_B.data_in) ) {
+    /* No data set up by predecessor on this task input flow */
+__parsec_BT_reduction_REDUCTION_parsec_assignment_t *target_locals = (__parsec_BT_reduction_REDUCTION_parsec_assignment_t*)&generic_locals;
+      const int REDUCTIONi = target_locals->i.value = ((offset + (i * 2)) + 1); (void)REDUCTIONi;
+      const int REDUCTIONt = target_locals->t.value = BT_reduction_REDUCTION_inline_c_expr12_line_104(__parsec_tp, target_locals); (void)REDUCTIONt;
+      const int REDUCTIONli = target_locals->li.value = BT_reduction_REDUCTION_inline_c_expr11_line_105(__parsec_tp, target_locals); (void)REDUCTIONli;
+      const int REDUCTIONsz = target_locals->sz.value = BT_reduction_REDUCTION_inline_c_expr10_line_106(__parsec_tp, target_locals); (void)REDUCTIONsz;
+      if( (reshape_entry != NULL) && (reshape_entry->data[0] != NULL) ){
+          /* Reshape promise set up on this task repo by predecessor */
+          consumed_repo = reshape_repo;
+          consumed_entry = reshape_entry;
+          consumed_entry_key = reshape_entry_key;
+          consumed_flow_index = 0;
+      }else{
+          /* Consume from predecessor's repo */
+          consumed_repo = REDUCTION_repo;
+          consumed_entry_key = __jdf2c_make_key_REDUCTION((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)target_locals) ;
+          consumed_entry = data_repo_lookup_entry( consumed_repo, consumed_entry_key );
+          consumed_flow_index = 0;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      ACQUIRE_FLOW(this_task, "B", &BT_reduction_REDUCTION, "A", target_locals, chunk);
+      this_task->data._f_B.data_out = chunk;
+    } 
+    else {
+      /* Data set up by predecessor on this task input flow */
+      consumed_repo = this_task->data._f_B.source_repo;
+      consumed_entry = this_task->data._f_B.source_repo_entry;
+      consumed_entry_key = this_task->data._f_B.source_repo_entry->ht_item.key;
+      if( (reshape_entry != NULL) && (reshape_entry->data[0] != NULL) ){
+          /* Reshape promise set up on input by predecessor is on this task repo */
+          consumed_flow_index = 0;
+          assert( (this_task->data._f_B.source_repo == reshape_repo)
+               && (this_task->data._f_B.source_repo_entry == reshape_entry));
+      }else{
+          /* Reshape promise set up on input by predecessor is the predecesssor task repo */
+          consumed_flow_index = 0;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      this_task->data._f_B.data_out = parsec_data_get_copy(chunk->original, target_device);
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+      parsec_prof_grapher_data_input(chunk->original, (parsec_task_t*)this_task, &flow_of_BT_reduction_BT_REDUC_for_B, 0);
+#endif
+    }
+    } else {
+    /* Flow B [0] dependency [1] from predecessor BT_REDUC */
+    if( NULL == (chunk = this_task->data._f_B.data_in) ) {
+    /* No data set up by predecessor on this task input flow */
+__parsec_BT_reduction_BT_REDUC_parsec_assignment_t *target_locals = (__parsec_BT_reduction_BT_REDUC_parsec_assignment_t*)&generic_locals;
+      const int BT_REDUCtree_count = target_locals->tree_count.value = BT_reduction_BT_REDUC_inline_c_expr9_line_123(__parsec_tp, target_locals); (void)BT_REDUCtree_count;
+      const int BT_REDUCt = target_locals->t.value = t; (void)BT_REDUCt;
+      const int BT_REDUCsz = target_locals->sz.value = BT_reduction_BT_REDUC_inline_c_expr8_line_125(__parsec_tp, target_locals); (void)BT_REDUCsz;
+      const int BT_REDUCs = target_locals->s.value = (s - 1); (void)BT_REDUCs;
+      const int BT_REDUClvl = target_locals->lvl.value = (BT_REDUCsz - BT_REDUCs); (void)BT_REDUClvl;
+      const int BT_REDUCi = target_locals->i.value = ((i * 2) + 1); (void)BT_REDUCi;
+      const int BT_REDUCoffset = target_locals->offset.value = BT_reduction_BT_REDUC_inline_c_expr6_line_129(__parsec_tp, target_locals); (void)BT_REDUCoffset;
+      if( (reshape_entry != NULL) && (reshape_entry->data[0] != NULL) ){
+          /* Reshape promise set up on this task repo by predecessor */
+          consumed_repo = reshape_repo;
+          consumed_entry = reshape_entry;
+          consumed_entry_key = reshape_entry_key;
+          consumed_flow_index = 0;
+      }else{
+          /* Consume from predecessor's repo */
+          consumed_repo = BT_REDUC_repo;
+          consumed_entry_key = __jdf2c_make_key_BT_REDUC((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)target_locals) ;
+          consumed_entry = data_repo_lookup_entry( consumed_repo, consumed_entry_key );
+          consumed_flow_index = 0;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      ACQUIRE_FLOW(this_task, "B", &BT_reduction_BT_REDUC, "B", target_locals, chunk);
+      this_task->data._f_B.data_out = chunk;
+    } 
+    else {
+      /* Data set up by predecessor on this task input flow */
+      consumed_repo = this_task->data._f_B.source_repo;
+      consumed_entry = this_task->data._f_B.source_repo_entry;
+      consumed_entry_key = this_task->data._f_B.source_repo_entry->ht_item.key;
+      if( (reshape_entry != NULL) && (reshape_entry->data[0] != NULL) ){
+          /* Reshape promise set up on input by predecessor is on this task repo */
+          consumed_flow_index = 0;
+          assert( (this_task->data._f_B.source_repo == reshape_repo)
+               && (this_task->data._f_B.source_repo_entry == reshape_entry));
+      }else{
+          /* Reshape promise set up on input by predecessor is the predecesssor task repo */
+          consumed_flow_index = 0;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      this_task->data._f_B.data_out = parsec_data_get_copy(chunk->original, target_device);
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+      parsec_prof_grapher_data_input(chunk->original, (parsec_task_t*)this_task, &flow_of_BT_reduction_BT_REDUC_for_B, 0);
+#endif
+    }
+    }
+    this_task->data._f_B.data_in     = chunk;
+    this_task->data._f_B.source_repo       = consumed_repo;
+    this_task->data._f_B.source_repo_entry = consumed_entry;
+    if( this_task->data._f_B.source_repo_entry == this_task->repo_entry ){
+      /* in case we have consume from this task repo entry for the flow,
+       * it is cleaned up, avoiding having old stuff during release_deps_of
+       */
+      this_task->repo_entry->data[0] = NULL;
+    }
+    this_task->data._f_B.fulfill = 1;
+}
+
+
+if(! this_task->data._f_A.fulfill ){ /* Flow A */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_A.data_out = NULL;  /* input only */
+    if( (1) == (s) ) {
+    /* Flow A [1] dependency [0] from predecessor REDUCTION */
+    if( NULL == (chunk = this_task->data._f_A.data_in) ) {
+    /* No data set up by predecessor on this task input flow */
+__parsec_BT_reduction_REDUCTION_parsec_assignment_t *target_locals = (__parsec_BT_reduction_REDUCTION_parsec_assignment_t*)&generic_locals;
+      const int REDUCTIONi = target_locals->i.value = (offset + (i * 2)); (void)REDUCTIONi;
+      const int REDUCTIONt = target_locals->t.value = BT_reduction_REDUCTION_inline_c_expr12_line_104(__parsec_tp, target_locals); (void)REDUCTIONt;
+      const int REDUCTIONli = target_locals->li.value = BT_reduction_REDUCTION_inline_c_expr11_line_105(__parsec_tp, target_locals); (void)REDUCTIONli;
+      const int REDUCTIONsz = target_locals->sz.value = BT_reduction_REDUCTION_inline_c_expr10_line_106(__parsec_tp, target_locals); (void)REDUCTIONsz;
+      if( (reshape_entry != NULL) && (reshape_entry->data[1] != NULL) ){
+          /* Reshape promise set up on this task repo by predecessor */
+          consumed_repo = reshape_repo;
+          consumed_entry = reshape_entry;
+          consumed_entry_key = reshape_entry_key;
+          consumed_flow_index = 1;
+      }else{
+          /* Consume from predecessor's repo */
+          consumed_repo = REDUCTION_repo;
+          consumed_entry_key = __jdf2c_make_key_REDUCTION((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)target_locals) ;
+          consumed_entry = data_repo_lookup_entry( consumed_repo, consumed_entry_key );
+          consumed_flow_index = 0;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 1, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      ACQUIRE_FLOW(this_task, "A", &BT_reduction_REDUCTION, "A", target_locals, chunk);
+      this_task->data._f_A.data_out = chunk;
+    } 
+    else {
+      /* Data set up by predecessor on this task input flow */
+      consumed_repo = this_task->data._f_A.source_repo;
+      consumed_entry = this_task->data._f_A.source_repo_entry;
+      consumed_entry_key = this_task->data._f_A.source_repo_entry->ht_item.key;
+      if( (reshape_entry != NULL) && (reshape_entry->data[1] != NULL) ){
+          /* Reshape promise set up on input by predecessor is on this task repo */
+          consumed_flow_index = 1;
+          assert( (this_task->data._f_A.source_repo == reshape_repo)
+               && (this_task->data._f_A.source_repo_entry == reshape_entry));
+      }else{
+          /* Reshape promise set up on input by predecessor is the predecesssor task repo */
+          consumed_flow_index = 0;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 1, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      this_task->data._f_A.data_out = parsec_data_get_copy(chunk->original, target_device);
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+      parsec_prof_grapher_data_input(chunk->original, (parsec_task_t*)this_task, &flow_of_BT_reduction_BT_REDUC_for_A, 0);
+#endif
+    }
+    } else {
+    /* Flow A [1] dependency [0] from predecessor BT_REDUC */
+    if( NULL == (chunk = this_task->data._f_A.data_in) ) {
+    /* No data set up by predecessor on this task input flow */
+__parsec_BT_reduction_BT_REDUC_parsec_assignment_t *target_locals = (__parsec_BT_reduction_BT_REDUC_parsec_assignment_t*)&generic_locals;
+      const int BT_REDUCtree_count = target_locals->tree_count.value = BT_reduction_BT_REDUC_inline_c_expr9_line_123(__parsec_tp, target_locals); (void)BT_REDUCtree_count;
+      const int BT_REDUCt = target_locals->t.value = t; (void)BT_REDUCt;
+      const int BT_REDUCsz = target_locals->sz.value = BT_reduction_BT_REDUC_inline_c_expr8_line_125(__parsec_tp, target_locals); (void)BT_REDUCsz;
+      const int BT_REDUCs = target_locals->s.value = (s - 1); (void)BT_REDUCs;
+      const int BT_REDUClvl = target_locals->lvl.value = (BT_REDUCsz - BT_REDUCs); (void)BT_REDUClvl;
+      const int BT_REDUCi = target_locals->i.value = (i * 2); (void)BT_REDUCi;
+      const int BT_REDUCoffset = target_locals->offset.value = BT_reduction_BT_REDUC_inline_c_expr6_line_129(__parsec_tp, target_locals); (void)BT_REDUCoffset;
+      if( (reshape_entry != NULL) && (reshape_entry->data[1] != NULL) ){
+          /* Reshape promise set up on this task repo by predecessor */
+          consumed_repo = reshape_repo;
+          consumed_entry = reshape_entry;
+          consumed_entry_key = reshape_entry_key;
+          consumed_flow_index = 1;
+      }else{
+          /* Consume from predecessor's repo */
+          consumed_repo = BT_REDUC_repo;
+          consumed_entry_key = __jdf2c_make_key_BT_REDUC((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)target_locals) ;
+          consumed_entry = data_repo_lookup_entry( consumed_repo, consumed_entry_key );
+          consumed_flow_index = 0;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 1, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      ACQUIRE_FLOW(this_task, "A", &BT_reduction_BT_REDUC, "B", target_locals, chunk);
+      this_task->data._f_A.data_out = chunk;
+    } 
+    else {
+      /* Data set up by predecessor on this task input flow */
+      consumed_repo = this_task->data._f_A.source_repo;
+      consumed_entry = this_task->data._f_A.source_repo_entry;
+      consumed_entry_key = this_task->data._f_A.source_repo_entry->ht_item.key;
+      if( (reshape_entry != NULL) && (reshape_entry->data[1] != NULL) ){
+          /* Reshape promise set up on input by predecessor is on this task repo */
+          consumed_flow_index = 1;
+          assert( (this_task->data._f_A.source_repo == reshape_repo)
+               && (this_task->data._f_A.source_repo_entry == reshape_entry));
+      }else{
+          /* Reshape promise set up on input by predecessor is the predecesssor task repo */
+          consumed_flow_index = 0;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 1, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      this_task->data._f_A.data_out = parsec_data_get_copy(chunk->original, target_device);
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+      parsec_prof_grapher_data_input(chunk->original, (parsec_task_t*)this_task, &flow_of_BT_reduction_BT_REDUC_for_A, 0);
+#endif
+    }
+    }
+    this_task->data._f_A.data_in     = chunk;
+    this_task->data._f_A.source_repo       = consumed_repo;
+    this_task->data._f_A.source_repo_entry = consumed_entry;
+    if( this_task->data._f_A.source_repo_entry == this_task->repo_entry ){
+      /* in case we have consume from this task repo entry for the flow,
+       * it is cleaned up, avoiding having old stuff during release_deps_of
+       */
+      this_task->repo_entry->data[1] = NULL;
+    }
+    this_task->data._f_A.fulfill = 1;
+}
+
+  /** Generate profiling information */
+#if defined(PARSEC_PROF_TRACE)
+  this_task->prof_info.desc = (parsec_data_collection_t*)__parsec_tp->super._g_dataA;
+  this_task->prof_info.priority = this_task->priority;
+  this_task->prof_info.data_id   = ((parsec_data_collection_t*)__parsec_tp->super._g_dataA)->data_key((parsec_data_collection_t*)__parsec_tp->super._g_dataA, (offset + (i * 2)), 0);
+  this_task->prof_info.task_class_id = this_task->task_class->task_class_id;
+  this_task->prof_info.task_return_code = -1;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int datatype_lookup_of_BT_reduction_BT_REDUC(parsec_execution_stream_t *es, const parsec_task_t *this_generic_task, const parsec_task_t *parent_task,
+              uint32_t* flow_mask, parsec_dep_data_description_t* data)
+{
+  const __parsec_BT_reduction_BT_REDUC_task_t *this_task = (__parsec_BT_reduction_BT_REDUC_task_t*)this_generic_task;
+  const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp = (__parsec_BT_reduction_internal_taskpool_t *)this_task->taskpool;
+  (void)__parsec_tp; (void)es; (void)this_task; (void)data; (void)parent_task;
+  const int tree_count = this_task->locals.tree_count.value; (void)tree_count;
+  const int t = this_task->locals.t.value; (void)t;
+  const int sz = this_task->locals.sz.value; (void)sz;
+  const int s = this_task->locals.s.value; (void)s;
+  const int lvl = this_task->locals.lvl.value; (void)lvl;
+  const int i = this_task->locals.i.value; (void)i;
+  const int offset = this_task->locals.offset.value; (void)offset;
+  data->local.arena = data->remote.arena = NULL;
+  data->local.src_datatype  = data->local.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->local.src_count     = data->local.dst_count = 0;
+  data->local.src_displ     = data->local.dst_displ = 0;
+  data->data_future  = NULL;
+  if( (*flow_mask) & 0x80000000U ) { /* these are the input dependencies remote datatypes  */
+if( (*flow_mask) & 0x1U ) {  /* Flow B */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_BT_reduction_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_BT_reduction_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_BT_reduction_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+if( (*flow_mask) & 0x2U ) {  /* Flow A */
+    if( ((*flow_mask) & 0x2U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_BT_reduction_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_BT_reduction_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_BT_reduction_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x2U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x2U) */
+    goto no_mask_match;
+  }
+
+  /* these are the output dependencies remote datatypes */
+if( (*flow_mask) & 0x7U ) {  /* Flow B */
+    if( ((*flow_mask) & 0x7U)
+ && (((sz) != (s) && (0) == ((i % 2))) || ((sz) != (s) && (0) != ((i % 2))) || (sz) == (s)) ) {
+    data->remote.arena  =  PARSEC_BT_reduction_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_BT_reduction_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_BT_reduction_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x7U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x7U) */
+ no_mask_match:
+  data->data                             = NULL;
+  data->remote.src_datatype = data->remote.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->remote.src_count    = data->remote.dst_count = 0;
+  data->remote.src_displ    = data->remote.dst_displ = 0;
+  data->data_future  = NULL;
+  (*flow_mask) = 0;  /* nothing left */
+  (void)tree_count;  (void)t;  (void)sz;  (void)s;  (void)lvl;  (void)i;  (void)offset;
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+static int hook_of_BT_reduction_BT_REDUC(parsec_execution_stream_t *es, __parsec_BT_reduction_BT_REDUC_task_t *this_task)
+{
+  __parsec_BT_reduction_internal_taskpool_t *__parsec_tp = (__parsec_BT_reduction_internal_taskpool_t *)this_task->taskpool;
+  (void)es; (void)__parsec_tp;
+  const int tree_count = this_task->locals.tree_count.value; (void)tree_count;
+  const int t = this_task->locals.t.value; (void)t;
+  const int sz = this_task->locals.sz.value; (void)sz;
+  const int s = this_task->locals.s.value; (void)s;
+  const int lvl = this_task->locals.lvl.value; (void)lvl;
+  const int i = this_task->locals.i.value; (void)i;
+  const int offset = this_task->locals.offset.value; (void)offset;
+  (void)tree_count;  (void)t;  (void)sz;  (void)s;  (void)lvl;  (void)i;  (void)offset;
+
+  /** Declare the variables that will hold the data, and all the accounting for each */
+  parsec_data_copy_t *_f_B = this_task->data._f_B.data_in;
+  void *B = PARSEC_DATA_COPY_GET_PTR(_f_B); (void)B;
+  parsec_data_copy_t *_f_A = this_task->data._f_A.data_in;
+  void *A = PARSEC_DATA_COPY_GET_PTR(_f_A); (void)A;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    data_repo_entry_t *eB = this_task->data._f_B.source_repo_entry;
+    if( (NULL != eB) && (eB->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eB->sim_exec_date;
+    data_repo_entry_t *eA = this_task->data._f_A.source_repo_entry;
+    if( (NULL != eA) && (eA->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eA->sim_exec_date;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+    if ( NULL != _f_B ) {
+#if defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) || defined(PARSEC_HAVE_DEV_HIP_SUPPORT)
+      parsec_data_transfer_ownership_to_copy( _f_B->original, 0 /* device */,
+                                           PARSEC_FLOW_ACCESS_RW);
+#endif  /* defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) || defined(PARSEC_HAVE_DEV_HIP_SUPPORT) */
+      _f_B->version++;  /* B */
+#if defined(PARSEC_DEBUG_NOISIER)
+      char tmp[128];
+      PARSEC_DEBUG_VERBOSE(10, parsec_debug_output,
+                           "Body of %s: change Data copy %p to version %d",
+                           parsec_task_snprintf(tmp, 128, (parsec_task_t*)(this_task)),
+                           _f_B, _f_B->version);
+#endif /* defined(PARSEC_DEBUG_NOISIER) */
+    }
+  /** Cache Awareness Accounting */
+#if defined(PARSEC_CACHE_AWARENESS)
+  cache_buf_referenced(es->closest_cache, B);
+  cache_buf_referenced(es->closest_cache, A);
+#endif /* PARSEC_CACHE_AWARENESS */
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                                BT_REDUC BODY                                  -----*/
+
+  int j;
+
+  for(j=0; j<NB; j++){
+      REDUCE( A, B, j );
+  }
+
+
+/*-----                              END OF BT_REDUC BODY                              -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#endif  /*  defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+static int complete_hook_of_BT_reduction_BT_REDUC(parsec_execution_stream_t *es, __parsec_BT_reduction_BT_REDUC_task_t *this_task)
+{
+  const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp = (__parsec_BT_reduction_internal_taskpool_t *)this_task->taskpool;
+#if defined(DISTRIBUTED)
+    const int tree_count = this_task->locals.tree_count.value; (void)tree_count;
+  const int t = this_task->locals.t.value; (void)t;
+  const int sz = this_task->locals.sz.value; (void)sz;
+  const int s = this_task->locals.s.value; (void)s;
+  const int lvl = this_task->locals.lvl.value; (void)lvl;
+  const int i = this_task->locals.i.value; (void)i;
+  const int offset = this_task->locals.offset.value; (void)offset;
+#endif  /* defined(DISTRIBUTED) */
+  (void)es; (void)__parsec_tp;
+parsec_data_t* data_t_desc = NULL; (void)data_t_desc;
+#if defined(DISTRIBUTED)
+  /** If not working on distributed, there is no risk that data is not in place */
+  (void)tree_count;  (void)t;  (void)sz;  (void)s;  (void)lvl;  (void)i;  (void)offset;
+
+#endif /* DISTRIBUTED */
+#if defined(PARSEC_PROF_GRAPHER)
+  parsec_prof_grapher_task((parsec_task_t*)this_task, es->th_id, es->virtual_process->vp_id,
+     __jdf2c_key_fns_BT_REDUC.key_hash(this_task->task_class->make_key( (parsec_taskpool_t*)this_task->taskpool, ((parsec_task_t*)this_task)->locals), NULL));
+#endif  /* defined(PARSEC_PROF_GRAPHER) */
+  release_deps_of_BT_reduction_BT_REDUC(es, this_task,
+      PARSEC_ACTION_RELEASE_REMOTE_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_REFS |
+      PARSEC_ACTION_RESHAPE_ON_RELEASE |
+      0x7,  /* mask of all dep_index */ 
+      NULL);
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static parsec_hook_return_t release_task_of_BT_reduction_BT_REDUC(parsec_execution_stream_t *es, parsec_task_t *this_task)
+{
+    const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp =
+        (const __parsec_BT_reduction_internal_taskpool_t *)this_task->taskpool;
+    parsec_hash_table_t *ht = (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[1];
+    parsec_key_t key = this_task->task_class->make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals);
+    parsec_hashable_dependency_t *hash_dep = (parsec_hashable_dependency_t *)parsec_hash_table_remove(ht, key);
+    parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);
+    return parsec_release_task_to_mempool_update_nbtasks(es, this_task);
+}
+
+static char *BT_reduction_BT_reduction_BT_REDUC_internal_init_deps_key_functions_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_BT_reduction_internal_taskpool_t *__parsec_tp = (__parsec_BT_reduction_internal_taskpool_t *)user_data;
+  __parsec_BT_reduction_BT_REDUC_parsec_assignment_t __jdf2c__assignments = {  .tree_count.value = 0, .t.value = 0, .sz.value = 0, .s.value = 0, .lvl.value = 0, .i.value = 0, .offset.value = 0 };
+  int tree_count = BT_reduction_BT_REDUC_inline_c_expr9_line_123(__parsec_tp, &__jdf2c__assignments);
+  (void)tree_count;
+  __jdf2c__assignments.tree_count.value = tree_count;
+  int t = (__parsec_key) % __parsec_tp->BT_REDUC_t_range + __parsec_tp->BT_REDUC_t_min;
+  __parsec_key = __parsec_key / __parsec_tp->BT_REDUC_t_range;
+  __jdf2c__assignments.t.value = t;
+  int sz = BT_reduction_BT_REDUC_inline_c_expr8_line_125(__parsec_tp, &__jdf2c__assignments);
+  (void)sz;
+  __jdf2c__assignments.sz.value = sz;
+  int s = (__parsec_key) % __parsec_tp->BT_REDUC_s_range + __parsec_tp->BT_REDUC_s_min;
+  __parsec_key = __parsec_key / __parsec_tp->BT_REDUC_s_range;
+  __jdf2c__assignments.s.value = s;
+  int lvl = (sz - s);
+  (void)lvl;
+  __jdf2c__assignments.lvl.value = lvl;
+  int i = (__parsec_key) % __parsec_tp->BT_REDUC_i_range + __parsec_tp->BT_REDUC_i_min;
+  __parsec_key = __parsec_key / __parsec_tp->BT_REDUC_i_range;
+  __jdf2c__assignments.i.value = i;
+  int offset = BT_reduction_BT_REDUC_inline_c_expr6_line_129(__parsec_tp, &__jdf2c__assignments);
+  (void)offset;
+  __jdf2c__assignments.offset.value = offset;
+  (void)__jdf2c__assignments;
+  snprintf(buffer, buffer_size, "BT_REDUC(%d, %d, %d)", t, s, i);
+  return buffer;
+}
+
+static parsec_key_fn_t BT_reduction_BT_reduction_BT_REDUC_internal_init_deps_key_functions = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = BT_reduction_BT_reduction_BT_REDUC_internal_init_deps_key_functions_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/* Needs: min-max count-tasks iterate */
+static int BT_reduction_BT_REDUC_internal_init(parsec_execution_stream_t * es, __parsec_BT_reduction_BT_REDUC_task_t * this_task)
+{
+  __parsec_BT_reduction_internal_taskpool_t *__parsec_tp = (__parsec_BT_reduction_internal_taskpool_t*)this_task->taskpool;
+  int32_t nb_tasks = 0, saved_nb_tasks = 0;
+int32_t __t_min = 0x7fffffff, __t_max = 0;int32_t __jdf2c_t_min = 0x7fffffff, __jdf2c_t_max = 0;int32_t __s_min = 0x7fffffff, __s_max = 0;int32_t __jdf2c_s_min = 0x7fffffff, __jdf2c_s_max = 0;int32_t __i_min = 0x7fffffff, __i_max = 0;int32_t __jdf2c_i_min = 0x7fffffff, __jdf2c_i_max = 0;  __parsec_BT_reduction_BT_REDUC_parsec_assignment_t assignments = {  .tree_count.value = 0, .t.value = 0, .sz.value = 0, .s.value = 0, .lvl.value = 0, .i.value = 0, .offset.value = 0 };
+  int32_t  tree_count,  t,  sz,  s,  lvl,  i,  offset;
+  int32_t __jdf2c_t_start, __jdf2c_t_end, __jdf2c_t_inc;
+  int32_t __jdf2c_s_start, __jdf2c_s_end, __jdf2c_s_inc;
+  int32_t __jdf2c_i_start, __jdf2c_i_end, __jdf2c_i_inc;
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+  PARSEC_PROFILING_TRACE(es->es_profile,
+                         this_task->taskpool->profiling_array[START_KEY(this_task->task_class->task_class_id)],
+                         0,
+                         this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+{  /* block for the non-range variable tree_count */
+    tree_count = BT_reduction_BT_REDUC_inline_c_expr9_line_123(__parsec_tp, &assignments);
+    assignments.tree_count.value = tree_count;
+      __jdf2c_t_start = 1;
+      __jdf2c_t_end = tree_count;
+      __jdf2c_t_inc = 1;
+      __t_min = parsec_imin(__jdf2c_t_start, __jdf2c_t_end);
+      __t_max = parsec_imax(__jdf2c_t_start, __jdf2c_t_end);
+      __jdf2c_t_min = parsec_imin(__jdf2c_t_min, __t_min);
+      __jdf2c_t_max = parsec_imax(__jdf2c_t_max, __t_max);
+      for(t =  __jdf2c_t_start;
+          t <= __jdf2c_t_end;
+          t += __jdf2c_t_inc) {
+      assignments.t.value = t;
+    {  /* block for the non-range variable sz */
+        sz = BT_reduction_BT_REDUC_inline_c_expr8_line_125(__parsec_tp, &assignments);
+        assignments.sz.value = sz;
+          __jdf2c_s_start = 1;
+          __jdf2c_s_end = sz;
+          __jdf2c_s_inc = 1;
+          __s_min = parsec_imin(__jdf2c_s_start, __jdf2c_s_end);
+          __s_max = parsec_imax(__jdf2c_s_start, __jdf2c_s_end);
+          __jdf2c_s_min = parsec_imin(__jdf2c_s_min, __s_min);
+          __jdf2c_s_max = parsec_imax(__jdf2c_s_max, __s_max);
+          for(s =  __jdf2c_s_start;
+              s <= __jdf2c_s_end;
+              s += __jdf2c_s_inc) {
+          assignments.s.value = s;
+        {  /* block for the non-range variable lvl */
+            lvl = (sz - s);
+            assignments.lvl.value = lvl;
+              __jdf2c_i_start = 0;
+              __jdf2c_i_end = BT_reduction_BT_REDUC_inline_c_expr7_line_128(__parsec_tp, &assignments);
+              __jdf2c_i_inc = 1;
+              __i_min = parsec_imin(__jdf2c_i_start, __jdf2c_i_end);
+              __i_max = parsec_imax(__jdf2c_i_start, __jdf2c_i_end);
+              __jdf2c_i_min = parsec_imin(__jdf2c_i_min, __i_min);
+              __jdf2c_i_max = parsec_imax(__jdf2c_i_max, __i_max);
+              for(i =  __jdf2c_i_start;
+                  i <= __jdf2c_i_end;
+                  i += __jdf2c_i_inc) {
+              assignments.i.value = i;
+            {  /* block for the non-range variable offset */
+                offset = BT_reduction_BT_REDUC_inline_c_expr6_line_129(__parsec_tp, &assignments);
+                assignments.offset.value = offset;
+                if( !BT_REDUC_pred(tree_count, t, sz, s, lvl, i, offset) ) continue;
+                nb_tasks++;
+              } /* block for the non-range variable offset */ 
+            } /* Loop on normal range i */
+          } /* Non-range variable lvl */ 
+        } /* For loop of s */ 
+      } /* Non-range variable sz */ 
+    } /* For loop of t */ 
+  } /* Non-range variable tree_count */ 
+   if( 0 != nb_tasks ) {
+     (void)parsec_atomic_fetch_add_int32(&__parsec_tp->initial_number_tasks, nb_tasks);
+   }
+  /* Set the range variables for the collision-free hash-computation */
+  __parsec_tp->BT_REDUC_t_min   = __jdf2c_t_min;
+  __parsec_tp->BT_REDUC_t_range = (__jdf2c_t_max - __jdf2c_t_min) + 1;
+  __parsec_tp->BT_REDUC_s_min   = __jdf2c_s_min;
+  __parsec_tp->BT_REDUC_s_range = (__jdf2c_s_max - __jdf2c_s_min) + 1;
+  __parsec_tp->BT_REDUC_i_min   = __jdf2c_i_min;
+  __parsec_tp->BT_REDUC_i_range = (__jdf2c_i_max - __jdf2c_i_min) + 1;
+  this_task->status = PARSEC_TASK_STATUS_COMPLETE;
+
+  PARSEC_AYU_REGISTER_TASK(&BT_reduction_BT_REDUC);
+  __parsec_tp->super.super.dependencies_array[1] = PARSEC_OBJ_NEW(parsec_hash_table_t);
+  parsec_hash_table_init(__parsec_tp->super.super.dependencies_array[1], offsetof(parsec_hashable_dependency_t, ht_item), 10, BT_reduction_BT_reduction_BT_REDUC_internal_init_deps_key_functions, this_task->taskpool);
+  __parsec_tp->repositories[1] = data_repo_create_nothreadsafe(nb_tasks, __jdf2c_key_fns_BT_REDUC, (parsec_taskpool_t*)__parsec_tp, 2);
+(void)saved_nb_tasks;
+(void)__t_min; (void)__t_max;(void)__s_min; (void)__s_max;(void)__i_min; (void)__i_max;  (void)__jdf2c_t_start; (void)__jdf2c_t_end; (void)__jdf2c_t_inc;  (void)__jdf2c_s_start; (void)__jdf2c_s_end; (void)__jdf2c_s_inc;  (void)__jdf2c_i_start; (void)__jdf2c_i_end; (void)__jdf2c_i_inc;  (void)assignments; (void)__parsec_tp; (void)es;
+  if(1 == parsec_atomic_fetch_dec_int32(&__parsec_tp->sync_point)) {
+    /* Last initialization task complete. Update the number of tasks. */
+    __parsec_tp->super.super.tdm.module->taskpool_addto_nb_tasks(&__parsec_tp->super.super, __parsec_tp->initial_number_tasks);
+    parsec_mfence();  /* write memory barrier to guarantee that the scheduler gets the correct number of tasks */
+    parsec_taskpool_enable((parsec_taskpool_t*)__parsec_tp, &__parsec_tp->startup_queue,
+                           (parsec_task_t*)this_task, es, __parsec_tp->super.super.nb_pending_actions);
+    __parsec_tp->super.super.tdm.module->taskpool_ready(&__parsec_tp->super.super);
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+    PARSEC_PROFILING_TRACE(es->es_profile,
+                           this_task->taskpool->profiling_array[2 * this_task->task_class->task_class_id + 1],
+                           0,
+                           this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    return PARSEC_HOOK_RETURN_DONE;
+  }
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static const __parsec_chore_t __BT_reduction_BT_REDUC_chores[] ={
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+    { .type     = PARSEC_DEV_CPU,
+      .evaluate = (parsec_evaluate_function_t*)NULL,
+      .hook     = (parsec_hook_t*)hook_of_BT_reduction_BT_REDUC },
+#endif  /* defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+    { .type     = PARSEC_DEV_NONE,
+      .evaluate = NULL,
+      .hook     = (parsec_hook_t*)NULL },  /* End marker */
+};
+
+static const parsec_task_class_t BT_reduction_BT_REDUC = {
+  .name = "BT_REDUC",
+  .task_class_id = 1,
+  .nb_flows = 2,
+  .nb_parameters = 3,
+  .nb_locals = 7,
+  .task_class_type = PARSEC_TASK_CLASS_TYPE_PTG,
+  .params = { &symb_BT_reduction_BT_REDUC_t, &symb_BT_reduction_BT_REDUC_s, &symb_BT_reduction_BT_REDUC_i, NULL },
+  .locals = { &symb_BT_reduction_BT_REDUC_tree_count, &symb_BT_reduction_BT_REDUC_t, &symb_BT_reduction_BT_REDUC_sz, &symb_BT_reduction_BT_REDUC_s, &symb_BT_reduction_BT_REDUC_lvl, &symb_BT_reduction_BT_REDUC_i, &symb_BT_reduction_BT_REDUC_offset, NULL },
+  .data_affinity = (parsec_data_ref_fn_t*)affinity_of_BT_reduction_BT_REDUC,
+  .initial_data = (parsec_data_ref_fn_t*)affinity_of_BT_reduction_BT_REDUC,
+  .final_data = (parsec_data_ref_fn_t*)affinity_of_BT_reduction_BT_REDUC,
+  .priority = NULL,
+  .properties = properties_of_BT_reduction_BT_REDUC,
+#if MAX_PARAM_COUNT < 2  /* number of read flows of BT_REDUC */
+  #error Too many read flows for task BT_REDUC
+#endif  /* MAX_PARAM_COUNT */
+#if MAX_PARAM_COUNT < 1  /* number of write flows of BT_REDUC */
+  #error Too many write flows for task BT_REDUC
+#endif  /* MAX_PARAM_COUNT */
+  .in = { &flow_of_BT_reduction_BT_REDUC_for_B, &flow_of_BT_reduction_BT_REDUC_for_A, NULL },
+  .out = { &flow_of_BT_reduction_BT_REDUC_for_B, NULL },
+  .flags = 0x0 | PARSEC_USE_DEPS_MASK,
+  .dependencies_goal = 0x3,
+  .make_key = __jdf2c_make_key_BT_REDUC,
+  .task_snprintf = parsec_task_snprintf,
+#if defined(PARSEC_PROF_TRACE)
+  .profile_info = &parsec_task_profile_info,
+#endif
+  .key_functions = &__jdf2c_key_fns_BT_REDUC,
+  .fini = (parsec_hook_t*)NULL,
+  .incarnations = __BT_reduction_BT_REDUC_chores,
+  .find_deps = parsec_hash_find_deps,
+  .update_deps = parsec_update_deps_with_mask,
+  .iterate_successors = (parsec_traverse_function_t*)iterate_successors_of_BT_reduction_BT_REDUC,
+  .iterate_predecessors = (parsec_traverse_function_t*)iterate_predecessors_of_BT_reduction_BT_REDUC,
+  .release_deps = (parsec_release_deps_t*)release_deps_of_BT_reduction_BT_REDUC,
+  .prepare_output = (parsec_hook_t*)NULL,
+  .prepare_input = (parsec_hook_t*)data_lookup_of_BT_reduction_BT_REDUC,
+  .time_estimate = NULL,
+  .get_datatype = datatype_lookup_of_BT_reduction_BT_REDUC,
+  .complete_execution = (parsec_hook_t*)complete_hook_of_BT_reduction_BT_REDUC,
+  .release_task = &release_task_of_BT_reduction_BT_REDUC,
+#if defined(PARSEC_SIM)
+  .sim_cost_fct = (parsec_sim_cost_fct_t*)NULL,
+#endif
+};
+
+
+/******                                  REDUCTION                                    ******/
+
+static inline int32_t minexpr_of_symb_BT_reduction_REDUCTION_i_fct(const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp, const __parsec_BT_reduction_REDUCTION_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_BT_reduction_REDUCTION_i = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_BT_reduction_REDUCTION_i_fct }
+                   }
+};
+static inline int maxexpr_of_symb_BT_reduction_REDUCTION_i_fct(const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp, const __parsec_BT_reduction_REDUCTION_parsec_assignment_t *locals)
+{
+  const int i = locals->i.value; (void)i;
+  const int t = locals->t.value; (void)t;
+  const int li = locals->li.value; (void)li;
+  const int sz = locals->sz.value; (void)sz;
+
+  (void)i;
+  (void)t;
+  (void)li;
+  (void)sz;
+  (void)__parsec_tp; (void)locals;
+  return (NT - 1);
+}
+static const parsec_expr_t maxexpr_of_symb_BT_reduction_REDUCTION_i = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_BT_reduction_REDUCTION_i_fct }
+                   }
+};
+static const parsec_symbol_t symb_BT_reduction_REDUCTION_i = { .name = "i", .context_index = 0, .min = &minexpr_of_symb_BT_reduction_REDUCTION_i, .max = &maxexpr_of_symb_BT_reduction_REDUCTION_i, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int32_t expr_of_symb_BT_reduction_REDUCTION_t_fct(const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp, const __parsec_BT_reduction_REDUCTION_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return BT_reduction_REDUCTION_inline_c_expr12_line_104(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_BT_reduction_REDUCTION_t = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_BT_reduction_REDUCTION_t_fct }
+                   }
+};
+static const parsec_symbol_t symb_BT_reduction_REDUCTION_t = { .name = "t", .context_index = 1, .min = &expr_of_symb_BT_reduction_REDUCTION_t, .max = &expr_of_symb_BT_reduction_REDUCTION_t, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_BT_reduction_REDUCTION_li_fct(const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp, const __parsec_BT_reduction_REDUCTION_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return BT_reduction_REDUCTION_inline_c_expr11_line_105(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_BT_reduction_REDUCTION_li = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_BT_reduction_REDUCTION_li_fct }
+                   }
+};
+static const parsec_symbol_t symb_BT_reduction_REDUCTION_li = { .name = "li", .context_index = 2, .min = &expr_of_symb_BT_reduction_REDUCTION_li, .max = &expr_of_symb_BT_reduction_REDUCTION_li, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_BT_reduction_REDUCTION_sz_fct(const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp, const __parsec_BT_reduction_REDUCTION_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return BT_reduction_REDUCTION_inline_c_expr10_line_106(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_BT_reduction_REDUCTION_sz = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_BT_reduction_REDUCTION_sz_fct }
+                   }
+};
+static const parsec_symbol_t symb_BT_reduction_REDUCTION_sz = { .name = "sz", .context_index = 3, .min = &expr_of_symb_BT_reduction_REDUCTION_sz, .max = &expr_of_symb_BT_reduction_REDUCTION_sz, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int affinity_of_BT_reduction_REDUCTION(const __parsec_BT_reduction_REDUCTION_task_t *this_task,
+                     parsec_data_ref_t *ref)
+{
+    const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp = (const __parsec_BT_reduction_internal_taskpool_t*)this_task->taskpool;
+  const int i = this_task->locals.i.value; (void)i;
+  const int t = this_task->locals.t.value; (void)t;
+  const int li = this_task->locals.li.value; (void)li;
+  const int sz = this_task->locals.sz.value; (void)sz;
+
+  /* Silent Warnings: should look into predicate to know what variables are usefull */
+  (void)i;
+  (void)t;
+  (void)li;
+  (void)sz;
+  ref->dc = (parsec_data_collection_t *)__parsec_tp->super._g_dataA;
+  /* Compute data key */
+  ref->key = ref->dc->data_key(ref->dc, i, 0);
+  return 1;
+}
+static const parsec_property_t properties_of_BT_reduction_REDUCTION[1] = {
+  {.name = NULL, .expr = NULL}
+};
+static parsec_data_t *flow_of_BT_reduction_REDUCTION_for_A_dep1_atline_110_direct_access(const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp, const __parsec_BT_reduction_REDUCTION_parsec_assignment_t *assignments)
+{
+  const int i = assignments->i.value; (void)i;
+  const int t = assignments->t.value; (void)t;
+  const int li = assignments->li.value; (void)li;
+  const int sz = assignments->sz.value; (void)sz;
+
+  /* Silence Warnings: should look into parameters to know what variables are useful */
+  (void)i;
+  (void)t;
+  (void)li;
+  (void)sz;
+  if( __parsec_tp->super.super.context->my_rank == (int32_t)rank_of_dataA(i, 0) )
+    return data_of_dataA(i, 0);
+  return NULL;
+}
+
+static const parsec_dep_t flow_of_BT_reduction_REDUCTION_for_A_dep1_atline_110 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = PARSEC_LOCAL_DATA_TASK_CLASS_ID, /* BT_reduction_dataA */
+  .direct_data = (parsec_data_lookup_func_t)&flow_of_BT_reduction_REDUCTION_for_A_dep1_atline_110_direct_access,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_BT_reduction_REDUCTION_for_A,
+};
+static inline int expr_of_cond_for_flow_of_BT_reduction_REDUCTION_for_A_dep2_atline_111_fct(const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp, const __parsec_BT_reduction_REDUCTION_parsec_assignment_t *locals)
+{
+  const int i = locals->i.value; (void)i;
+  const int t = locals->t.value; (void)t;
+  const int li = locals->li.value; (void)li;
+  const int sz = locals->sz.value; (void)sz;
+
+  (void)i;
+  (void)t;
+  (void)li;
+  (void)sz;
+  (void)__parsec_tp; (void)locals;
+  return ((sz) > (0) && (0) == ((li % 2)));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_BT_reduction_REDUCTION_for_A_dep2_atline_111 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_BT_reduction_REDUCTION_for_A_dep2_atline_111_fct }
+                   }
+};
+static const parsec_dep_t flow_of_BT_reduction_REDUCTION_for_A_dep2_atline_111 = {
+  .cond = &expr_of_cond_for_flow_of_BT_reduction_REDUCTION_for_A_dep2_atline_111,  /* ((sz) > (0) && (0) == ((li % 2))) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 1, /* BT_reduction_BT_REDUC */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_BT_reduction_BT_REDUC_for_A,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_BT_reduction_REDUCTION_for_A,
+};
+static inline int expr_of_cond_for_flow_of_BT_reduction_REDUCTION_for_A_dep3_atline_112_fct(const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp, const __parsec_BT_reduction_REDUCTION_parsec_assignment_t *locals)
+{
+  const int i = locals->i.value; (void)i;
+  const int t = locals->t.value; (void)t;
+  const int li = locals->li.value; (void)li;
+  const int sz = locals->sz.value; (void)sz;
+
+  (void)i;
+  (void)t;
+  (void)li;
+  (void)sz;
+  (void)__parsec_tp; (void)locals;
+  return ((sz) > (0) && (0) != ((li % 2)));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_BT_reduction_REDUCTION_for_A_dep3_atline_112 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_BT_reduction_REDUCTION_for_A_dep3_atline_112_fct }
+                   }
+};
+static const parsec_dep_t flow_of_BT_reduction_REDUCTION_for_A_dep3_atline_112 = {
+  .cond = &expr_of_cond_for_flow_of_BT_reduction_REDUCTION_for_A_dep3_atline_112,  /* ((sz) > (0) && (0) != ((li % 2))) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 1, /* BT_reduction_BT_REDUC */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_BT_reduction_BT_REDUC_for_B,
+  .dep_index = 1,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_BT_reduction_REDUCTION_for_A,
+};
+static inline int expr_of_cond_for_flow_of_BT_reduction_REDUCTION_for_A_dep4_atline_113_fct(const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp, const __parsec_BT_reduction_REDUCTION_parsec_assignment_t *locals)
+{
+  const int i = locals->i.value; (void)i;
+  const int t = locals->t.value; (void)t;
+  const int li = locals->li.value; (void)li;
+  const int sz = locals->sz.value;
+
+  (void)i;
+  (void)t;
+  (void)li;
+  (void)sz;
+  (void)__parsec_tp; (void)locals;
+  return (sz) == (0);
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_BT_reduction_REDUCTION_for_A_dep4_atline_113 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_BT_reduction_REDUCTION_for_A_dep4_atline_113_fct }
+                   }
+};
+static const parsec_dep_t flow_of_BT_reduction_REDUCTION_for_A_dep4_atline_113 = {
+  .cond = &expr_of_cond_for_flow_of_BT_reduction_REDUCTION_for_A_dep4_atline_113,  /* (sz) == (0) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 2, /* BT_reduction_LINEAR_REDUC */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_BT_reduction_LINEAR_REDUC_for_C,
+  .dep_index = 2,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_BT_reduction_REDUCTION_for_A,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+#if MAX_DEP_OUT_COUNT < 3  /* number of output dependencies */
+    #error Too many output dependencies (supports up to MAX_DEP_OUT_COUNT [=10] but found 3). Fix the code or recompile PaRSEC with a larger MAX_DEP_OUT_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_BT_reduction_REDUCTION_for_A = {
+  .name               = "A",
+  .sym_type           = PARSEC_SYM_INOUT,
+  .flow_flags         = PARSEC_FLOW_ACCESS_RW|PARSEC_FLOW_HAS_IN_DEPS,
+  .flow_index         = 0,
+  .flow_datatype_mask = 0x1,
+  .dep_in     = { &flow_of_BT_reduction_REDUCTION_for_A_dep1_atline_110 },
+  .dep_out    = { &flow_of_BT_reduction_REDUCTION_for_A_dep2_atline_111,
+ &flow_of_BT_reduction_REDUCTION_for_A_dep3_atline_112,
+ &flow_of_BT_reduction_REDUCTION_for_A_dep4_atline_113 }
+};
+
+static void
+iterate_successors_of_BT_reduction_REDUCTION(parsec_execution_stream_t *es, const __parsec_BT_reduction_REDUCTION_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp = (const __parsec_BT_reduction_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_BT_reduction_REDUCTION_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_BT_reduction_REDUCTION_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int i = __jdf2c__tmp_locals.i.value; (void)i;
+  const int t = __jdf2c__tmp_locals.t.value; (void)t;
+  const int li = __jdf2c__tmp_locals.li.value; (void)li;
+  const int sz = __jdf2c__tmp_locals.sz.value; (void)sz;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)i;  (void)t;  (void)li;  (void)sz;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_dataA(i, 0);
+#endif
+  if( action_mask & 0x7 ) {  /* Flow of data A [0] */
+    data.data   = this_task->data._f_A.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x1 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_BT_reduction_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_BT_reduction_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( ((sz) > (0) && (0) == ((li % 2))) ) {
+      __parsec_BT_reduction_BT_REDUC_task_t* ncc = (__parsec_BT_reduction_BT_REDUC_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[BT_reduction_BT_REDUC.task_class_id];
+        const int BT_REDUC_tree_count = BT_reduction_BT_REDUC_inline_c_expr9_line_123(__parsec_tp, &ncc->locals);
+        assert(&nc.locals[0].value == &ncc->locals.tree_count.value);
+        ncc->locals.tree_count.value = BT_REDUC_tree_count;
+        const int BT_REDUC_t = t;
+        if( (BT_REDUC_t >= (1)) && (BT_REDUC_t <= (ncc->locals.tree_count.value)) ) {
+          assert(&nc.locals[1].value == &ncc->locals.t.value);
+          ncc->locals.t.value = BT_REDUC_t;
+          const int BT_REDUC_sz = BT_reduction_BT_REDUC_inline_c_expr8_line_125(__parsec_tp, &ncc->locals);
+          assert(&nc.locals[2].value == &ncc->locals.sz.value);
+          ncc->locals.sz.value = BT_REDUC_sz;
+          const int BT_REDUC_s = 1;
+          if( (BT_REDUC_s >= (1)) && (BT_REDUC_s <= (ncc->locals.sz.value)) ) {
+            assert(&nc.locals[3].value == &ncc->locals.s.value);
+            ncc->locals.s.value = BT_REDUC_s;
+            const int BT_REDUC_lvl = (ncc->locals.sz.value - ncc->locals.s.value);
+            assert(&nc.locals[4].value == &ncc->locals.lvl.value);
+            ncc->locals.lvl.value = BT_REDUC_lvl;
+            const int BT_REDUC_i = (li / 2);
+            if( (BT_REDUC_i >= (0)) && (BT_REDUC_i <= (BT_reduction_BT_REDUC_inline_c_expr7_line_128(__parsec_tp, &ncc->locals))) ) {
+              assert(&nc.locals[5].value == &ncc->locals.i.value);
+              ncc->locals.i.value = BT_REDUC_i;
+              const int BT_REDUC_offset = BT_reduction_BT_REDUC_inline_c_expr6_line_129(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[6].value == &ncc->locals.offset.value);
+              ncc->locals.offset.value = BT_REDUC_offset;
+#if defined(DISTRIBUTED)
+              rank_dst = rank_of_dataA((ncc->locals.offset.value + (ncc->locals.i.value * 2)), 0);
+              if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+                vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_dataA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_dataA, (ncc->locals.offset.value + (ncc->locals.i.value * 2)), 0);
+              nc.priority = __parsec_tp->super.super.priority;
+              successor_repo = BT_REDUC_repo;
+              successor_repo_key = __jdf2c_make_key_BT_REDUC((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+            RELEASE_DEP_OUTPUT(es, "A", this_task, "A", &nc, rank_src, rank_dst, &data);
+            if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_BT_reduction_REDUCTION_for_A_dep2_atline_111, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+              }
+            }
+          }
+    }
+  }
+  if( action_mask & 0x2 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_BT_reduction_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_BT_reduction_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( ((sz) > (0) && (0) != ((li % 2))) ) {
+      __parsec_BT_reduction_BT_REDUC_task_t* ncc = (__parsec_BT_reduction_BT_REDUC_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[BT_reduction_BT_REDUC.task_class_id];
+        const int BT_REDUC_tree_count = BT_reduction_BT_REDUC_inline_c_expr9_line_123(__parsec_tp, &ncc->locals);
+        assert(&nc.locals[0].value == &ncc->locals.tree_count.value);
+        ncc->locals.tree_count.value = BT_REDUC_tree_count;
+        const int BT_REDUC_t = t;
+        if( (BT_REDUC_t >= (1)) && (BT_REDUC_t <= (ncc->locals.tree_count.value)) ) {
+          assert(&nc.locals[1].value == &ncc->locals.t.value);
+          ncc->locals.t.value = BT_REDUC_t;
+          const int BT_REDUC_sz = BT_reduction_BT_REDUC_inline_c_expr8_line_125(__parsec_tp, &ncc->locals);
+          assert(&nc.locals[2].value == &ncc->locals.sz.value);
+          ncc->locals.sz.value = BT_REDUC_sz;
+          const int BT_REDUC_s = 1;
+          if( (BT_REDUC_s >= (1)) && (BT_REDUC_s <= (ncc->locals.sz.value)) ) {
+            assert(&nc.locals[3].value == &ncc->locals.s.value);
+            ncc->locals.s.value = BT_REDUC_s;
+            const int BT_REDUC_lvl = (ncc->locals.sz.value - ncc->locals.s.value);
+            assert(&nc.locals[4].value == &ncc->locals.lvl.value);
+            ncc->locals.lvl.value = BT_REDUC_lvl;
+            const int BT_REDUC_i = (li / 2);
+            if( (BT_REDUC_i >= (0)) && (BT_REDUC_i <= (BT_reduction_BT_REDUC_inline_c_expr7_line_128(__parsec_tp, &ncc->locals))) ) {
+              assert(&nc.locals[5].value == &ncc->locals.i.value);
+              ncc->locals.i.value = BT_REDUC_i;
+              const int BT_REDUC_offset = BT_reduction_BT_REDUC_inline_c_expr6_line_129(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[6].value == &ncc->locals.offset.value);
+              ncc->locals.offset.value = BT_REDUC_offset;
+#if defined(DISTRIBUTED)
+              rank_dst = rank_of_dataA((ncc->locals.offset.value + (ncc->locals.i.value * 2)), 0);
+              if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+                vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_dataA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_dataA, (ncc->locals.offset.value + (ncc->locals.i.value * 2)), 0);
+              nc.priority = __parsec_tp->super.super.priority;
+              successor_repo = BT_REDUC_repo;
+              successor_repo_key = __jdf2c_make_key_BT_REDUC((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+            RELEASE_DEP_OUTPUT(es, "A", this_task, "B", &nc, rank_src, rank_dst, &data);
+            if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_BT_reduction_REDUCTION_for_A_dep3_atline_112, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+              }
+            }
+          }
+    }
+  }
+  if( action_mask & 0x4 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_BT_reduction_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_BT_reduction_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( (sz) == (0) ) {
+      __parsec_BT_reduction_LINEAR_REDUC_task_t* ncc = (__parsec_BT_reduction_LINEAR_REDUC_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[BT_reduction_LINEAR_REDUC.task_class_id];
+        const int LINEAR_REDUC_tree_count = BT_reduction_LINEAR_REDUC_inline_c_expr5_line_157(__parsec_tp, &ncc->locals);
+        assert(&nc.locals[0].value == &ncc->locals.tree_count.value);
+        ncc->locals.tree_count.value = LINEAR_REDUC_tree_count;
+        const int LINEAR_REDUC_i = 1;
+        if( (LINEAR_REDUC_i >= (1)) && (LINEAR_REDUC_i <= (ncc->locals.tree_count.value)) ) {
+          assert(&nc.locals[1].value == &ncc->locals.i.value);
+          ncc->locals.i.value = LINEAR_REDUC_i;
+          const int LINEAR_REDUC_sz = BT_reduction_LINEAR_REDUC_inline_c_expr4_line_159(__parsec_tp, &ncc->locals);
+          assert(&nc.locals[2].value == &ncc->locals.sz.value);
+          ncc->locals.sz.value = LINEAR_REDUC_sz;
+          const int LINEAR_REDUC_offset = BT_reduction_LINEAR_REDUC_inline_c_expr3_line_160(__parsec_tp, &ncc->locals);
+          assert(&nc.locals[3].value == &ncc->locals.offset.value);
+          ncc->locals.offset.value = LINEAR_REDUC_offset;
+#if defined(DISTRIBUTED)
+          rank_dst = rank_of_dataA(ncc->locals.offset.value, 0);
+          if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+            vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_dataA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_dataA, ncc->locals.offset.value, 0);
+          nc.priority = __parsec_tp->super.super.priority;
+          successor_repo = LINEAR_REDUC_repo;
+          successor_repo_key = __jdf2c_make_key_LINEAR_REDUC((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+        RELEASE_DEP_OUTPUT(es, "A", this_task, "C", &nc, rank_src, rank_dst, &data);
+        if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_BT_reduction_REDUCTION_for_A_dep4_atline_113, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+          }
+    }
+  }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static int release_deps_of_BT_reduction_REDUCTION(parsec_execution_stream_t *es, __parsec_BT_reduction_REDUCTION_task_t *this_task, uint32_t action_mask, parsec_remote_deps_t *deps)
+{
+  PARSEC_PINS(es, RELEASE_DEPS_BEGIN, (parsec_task_t *)this_task);  const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp = (const __parsec_BT_reduction_internal_taskpool_t *)this_task->taskpool;
+  parsec_release_dep_fct_arg_t arg;
+  int __vp_id;
+  int consume_local_repo = 0;
+  arg.action_mask = action_mask;
+  arg.output_entry = NULL;
+  arg.output_repo = NULL;
+#if defined(DISTRIBUTED)
+  arg.remote_deps = deps;
+#endif  /* defined(DISTRIBUTED) */
+  assert(NULL != es);
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS )    arg.ready_lists = alloca(sizeof(parsec_task_t *) * es->virtual_process->parsec_context->nb_vp);
+  else
+    arg.ready_lists = NULL;
+  for( __vp_id = 0; __vp_id < es->virtual_process->parsec_context->nb_vp; arg.ready_lists[__vp_id++] = NULL );
+  (void)__parsec_tp; (void)deps;
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_A.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_A.source_repo, this_task->data._f_A.source_repo_entry->ht_item.key );
+    }
+  }
+  consume_local_repo = (this_task->repo_entry != NULL);
+  arg.output_repo = REDUCTION_repo;
+  arg.output_entry = this_task->repo_entry;
+  arg.output_usage = 0;
+  if( action_mask & (PARSEC_ACTION_RELEASE_LOCAL_DEPS | PARSEC_ACTION_GET_REPO_ENTRY) ) {
+    arg.output_entry = data_repo_lookup_entry_and_create( es, arg.output_repo, __jdf2c_make_key_REDUCTION((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    arg.output_entry->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(arg.output_entry->sim_exec_date == 0);
+    arg.output_entry->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  if(action_mask & ( PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE ) ){
+    /* Generate the reshape promise for the outputs that need it */
+    iterate_successors_of_BT_reduction_REDUCTION(es, this_task, action_mask, parsec_set_up_reshape_promise, &arg);
+   }
+  iterate_successors_of_BT_reduction_REDUCTION(es, this_task, action_mask, parsec_release_dep_fct, &arg);
+
+#if defined(DISTRIBUTED)
+  if( (action_mask & PARSEC_ACTION_SEND_REMOTE_DEPS) && (NULL != arg.remote_deps)) {
+    parsec_remote_dep_activate(es, (parsec_task_t *)this_task, arg.remote_deps, arg.remote_deps->outgoing_mask);
+  }
+#endif
+
+  if(action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS) {
+    data_repo_entry_addto_usage_limit(REDUCTION_repo, arg.output_entry->ht_item.key, arg.output_usage);
+    __parsec_schedule_vp(es, arg.ready_lists, 0);
+  }
+      if (consume_local_repo) {
+         data_repo_entry_used_once( REDUCTION_repo, this_task->repo_entry->ht_item.key );
+      }
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_A.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_A.data_in);
+    }
+  }
+  PARSEC_PINS(es, RELEASE_DEPS_END, (parsec_task_t *)this_task);  return 0;
+}
+
+static int data_lookup_of_BT_reduction_REDUCTION(parsec_execution_stream_t *es, __parsec_BT_reduction_REDUCTION_task_t *this_task)
+{
+  const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp = (__parsec_BT_reduction_internal_taskpool_t *)this_task->taskpool;
+  parsec_assignment_t generic_locals[MAX_PARAM_COUNT];  /* generic task locals */
+  int target_device = 0; (void)target_device;
+  (void)__parsec_tp; (void)generic_locals; (void)es;
+  parsec_data_copy_t *chunk = NULL;
+  data_repo_t        *reshape_repo  = NULL, *consumed_repo  = NULL;
+  data_repo_entry_t  *reshape_entry = NULL, *consumed_entry = NULL;
+  parsec_key_t        reshape_entry_key = 0, consumed_entry_key = 0;
+  uint8_t             consumed_flow_index;
+  parsec_dep_data_description_t data;
+  int ret;
+  (void)reshape_repo; (void)reshape_entry; (void)reshape_entry_key;
+  (void)consumed_repo; (void)consumed_entry; (void)consumed_entry_key;
+  (void)consumed_flow_index;
+  (void)chunk; (void)data; (void)ret;
+  const int i = this_task->locals.i.value; (void)i;
+  const int t = this_task->locals.t.value; (void)t;
+  const int li = this_task->locals.li.value; (void)li;
+  const int sz = this_task->locals.sz.value; (void)sz;
+  if( NULL == this_task->repo_entry ){
+    this_task->repo_entry = data_repo_lookup_entry_and_create(es, REDUCTION_repo,                                       __jdf2c_make_key_REDUCTION((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    data_repo_entry_addto_usage_limit(REDUCTION_repo, this_task->repo_entry->ht_item.key, 1);    this_task->repo_entry ->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(this_task->repo_entry ->sim_exec_date == 0);
+    this_task->repo_entry ->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  /* The reshape repo is the current task repo. */  reshape_repo = REDUCTION_repo;
+  reshape_entry_key = __jdf2c_make_key_REDUCTION((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals) ;
+  reshape_entry = this_task->repo_entry;
+  /* Lookup the input data, and store them in the context if any */
+
+if(! this_task->data._f_A.fulfill ){ /* Flow A */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_A.data_out = NULL;  /* By default, if nothing matches */
+  /* Flow A [0] dependency [0] from memory dataA */
+  if( NULL == (chunk = this_task->data._f_A.data_in) ) {
+  /* No data set up by predecessor on this task input flow */
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+  parsec_prof_grapher_data_input(data_of_dataA(i, 0), (parsec_task_t*)this_task, &flow_of_BT_reduction_REDUCTION_for_A, 1);
+#endif
+    chunk = parsec_data_get_copy(data_of_dataA(i, 0), target_device);
+    data.data = chunk;
+    data.data_future  = NULL;
+        data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.data_future   = NULL;
+    if( (ret = parsec_get_copy_reshape_from_desc(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    this_task->data._f_A.data_out = chunk;
+    PARSEC_OBJ_RETAIN(chunk);
+  } 
+    this_task->data._f_A.data_in     = chunk;
+    this_task->data._f_A.source_repo       = consumed_repo;
+    this_task->data._f_A.source_repo_entry = consumed_entry;
+    if( this_task->data._f_A.source_repo_entry == this_task->repo_entry ){
+      /* in case we have consume from this task repo entry for the flow,
+       * it is cleaned up, avoiding having old stuff during release_deps_of
+       */
+      this_task->repo_entry->data[0] = NULL;
+    }
+    this_task->data._f_A.fulfill = 1;
+}
+
+  /** Generate profiling information */
+#if defined(PARSEC_PROF_TRACE)
+  this_task->prof_info.desc = (parsec_data_collection_t*)__parsec_tp->super._g_dataA;
+  this_task->prof_info.priority = this_task->priority;
+  this_task->prof_info.data_id   = ((parsec_data_collection_t*)__parsec_tp->super._g_dataA)->data_key((parsec_data_collection_t*)__parsec_tp->super._g_dataA, i, 0);
+  this_task->prof_info.task_class_id = this_task->task_class->task_class_id;
+  this_task->prof_info.task_return_code = -1;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int datatype_lookup_of_BT_reduction_REDUCTION(parsec_execution_stream_t *es, const parsec_task_t *this_generic_task, const parsec_task_t *parent_task,
+              uint32_t* flow_mask, parsec_dep_data_description_t* data)
+{
+  const __parsec_BT_reduction_REDUCTION_task_t *this_task = (__parsec_BT_reduction_REDUCTION_task_t*)this_generic_task;
+  const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp = (__parsec_BT_reduction_internal_taskpool_t *)this_task->taskpool;
+  (void)__parsec_tp; (void)es; (void)this_task; (void)data; (void)parent_task;
+  const int i = this_task->locals.i.value; (void)i;
+  const int t = this_task->locals.t.value; (void)t;
+  const int li = this_task->locals.li.value; (void)li;
+  const int sz = this_task->locals.sz.value; (void)sz;
+  data->local.arena = data->remote.arena = NULL;
+  data->local.src_datatype  = data->local.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->local.src_count     = data->local.dst_count = 0;
+  data->local.src_displ     = data->local.dst_displ = 0;
+  data->data_future  = NULL;
+  if( (*flow_mask) & 0x80000000U ) { /* these are the input dependencies remote datatypes  */
+if( (*flow_mask) & 0x1U ) {  /* Flow A */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_BT_reduction_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_BT_reduction_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_BT_reduction_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+    goto no_mask_match;
+  }
+
+  /* these are the output dependencies remote datatypes */
+if( (*flow_mask) & 0x7U ) {  /* Flow A */
+    if( ((*flow_mask) & 0x7U)
+ && (((sz) > (0) && (0) == ((li % 2))) || ((sz) > (0) && (0) != ((li % 2))) || (sz) == (0)) ) {
+    data->remote.arena  =  PARSEC_BT_reduction_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_BT_reduction_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_BT_reduction_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x7U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x7U) */
+ no_mask_match:
+  data->data                             = NULL;
+  data->remote.src_datatype = data->remote.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->remote.src_count    = data->remote.dst_count = 0;
+  data->remote.src_displ    = data->remote.dst_displ = 0;
+  data->data_future  = NULL;
+  (*flow_mask) = 0;  /* nothing left */
+  (void)i;  (void)t;  (void)li;  (void)sz;
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+static int hook_of_BT_reduction_REDUCTION(parsec_execution_stream_t *es, __parsec_BT_reduction_REDUCTION_task_t *this_task)
+{
+  __parsec_BT_reduction_internal_taskpool_t *__parsec_tp = (__parsec_BT_reduction_internal_taskpool_t *)this_task->taskpool;
+  (void)es; (void)__parsec_tp;
+  const int i = this_task->locals.i.value; (void)i;
+  const int t = this_task->locals.t.value; (void)t;
+  const int li = this_task->locals.li.value; (void)li;
+  const int sz = this_task->locals.sz.value; (void)sz;
+  (void)i;  (void)t;  (void)li;  (void)sz;
+
+  /** Declare the variables that will hold the data, and all the accounting for each */
+  parsec_data_copy_t *_f_A = this_task->data._f_A.data_in;
+  void *A = PARSEC_DATA_COPY_GET_PTR(_f_A); (void)A;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    data_repo_entry_t *eA = this_task->data._f_A.source_repo_entry;
+    if( (NULL != eA) && (eA->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eA->sim_exec_date;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+    if ( NULL != _f_A ) {
+#if defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) || defined(PARSEC_HAVE_DEV_HIP_SUPPORT)
+      parsec_data_transfer_ownership_to_copy( _f_A->original, 0 /* device */,
+                                           PARSEC_FLOW_ACCESS_RW);
+#endif  /* defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) || defined(PARSEC_HAVE_DEV_HIP_SUPPORT) */
+      _f_A->version++;  /* A */
+#if defined(PARSEC_DEBUG_NOISIER)
+      char tmp[128];
+      PARSEC_DEBUG_VERBOSE(10, parsec_debug_output,
+                           "Body of %s: change Data copy %p to version %d",
+                           parsec_task_snprintf(tmp, 128, (parsec_task_t*)(this_task)),
+                           _f_A, _f_A->version);
+#endif /* defined(PARSEC_DEBUG_NOISIER) */
+    }
+  /** Cache Awareness Accounting */
+#if defined(PARSEC_CACHE_AWARENESS)
+  cache_buf_referenced(es->closest_cache, A);
+#endif /* PARSEC_CACHE_AWARENESS */
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                                REDUCTION BODY                                -----*/
+
+      *TYPE(A) = i;
+
+/*-----                            END OF REDUCTION BODY                              -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#endif  /*  defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+static int complete_hook_of_BT_reduction_REDUCTION(parsec_execution_stream_t *es, __parsec_BT_reduction_REDUCTION_task_t *this_task)
+{
+  const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp = (__parsec_BT_reduction_internal_taskpool_t *)this_task->taskpool;
+#if defined(DISTRIBUTED)
+    const int i = this_task->locals.i.value; (void)i;
+  const int t = this_task->locals.t.value; (void)t;
+  const int li = this_task->locals.li.value; (void)li;
+  const int sz = this_task->locals.sz.value; (void)sz;
+#endif  /* defined(DISTRIBUTED) */
+  (void)es; (void)__parsec_tp;
+parsec_data_t* data_t_desc = NULL; (void)data_t_desc;
+#if defined(DISTRIBUTED)
+  /** If not working on distributed, there is no risk that data is not in place */
+  (void)i;  (void)t;  (void)li;  (void)sz;
+
+#endif /* DISTRIBUTED */
+#if defined(PARSEC_PROF_GRAPHER)
+  parsec_prof_grapher_task((parsec_task_t*)this_task, es->th_id, es->virtual_process->vp_id,
+     __jdf2c_key_fns_REDUCTION.key_hash(this_task->task_class->make_key( (parsec_taskpool_t*)this_task->taskpool, ((parsec_task_t*)this_task)->locals), NULL));
+#endif  /* defined(PARSEC_PROF_GRAPHER) */
+  release_deps_of_BT_reduction_REDUCTION(es, this_task,
+      PARSEC_ACTION_RELEASE_REMOTE_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_REFS |
+      PARSEC_ACTION_RESHAPE_ON_RELEASE |
+      0x7,  /* mask of all dep_index */ 
+      NULL);
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static parsec_hook_return_t release_task_of_BT_reduction_REDUCTION(parsec_execution_stream_t *es, parsec_task_t *this_task)
+{
+    const __parsec_BT_reduction_internal_taskpool_t *__parsec_tp =
+        (const __parsec_BT_reduction_internal_taskpool_t *)this_task->taskpool;
+    parsec_hash_table_t *ht = (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[0];
+    parsec_key_t key = this_task->task_class->make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals);
+    parsec_hashable_dependency_t *hash_dep = (parsec_hashable_dependency_t *)parsec_hash_table_remove(ht, key);
+    parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);
+    return parsec_release_task_to_mempool_update_nbtasks(es, this_task);
+}
+
+static char *BT_reduction_BT_reduction_REDUCTION_internal_init_deps_key_functions_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_BT_reduction_internal_taskpool_t *__parsec_tp = (__parsec_BT_reduction_internal_taskpool_t *)user_data;
+  __parsec_BT_reduction_REDUCTION_parsec_assignment_t __jdf2c__assignments = {  .i.value = 0, .t.value = 0, .li.value = 0, .sz.value = 0 };
+  int i = (__parsec_key) % __parsec_tp->REDUCTION_i_range + __parsec_tp->REDUCTION_i_min;
+  __parsec_key = __parsec_key / __parsec_tp->REDUCTION_i_range;
+  __jdf2c__assignments.i.value = i;
+  int t = BT_reduction_REDUCTION_inline_c_expr12_line_104(__parsec_tp, &__jdf2c__assignments);
+  (void)t;
+  __jdf2c__assignments.t.value = t;
+  int li = BT_reduction_REDUCTION_inline_c_expr11_line_105(__parsec_tp, &__jdf2c__assignments);
+  (void)li;
+  __jdf2c__assignments.li.value = li;
+  int sz = BT_reduction_REDUCTION_inline_c_expr10_line_106(__parsec_tp, &__jdf2c__assignments);
+  (void)sz;
+  __jdf2c__assignments.sz.value = sz;
+  (void)__jdf2c__assignments;
+  snprintf(buffer, buffer_size, "REDUCTION(%d)", i);
+  return buffer;
+}
+
+static parsec_key_fn_t BT_reduction_BT_reduction_REDUCTION_internal_init_deps_key_functions = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = BT_reduction_BT_reduction_REDUCTION_internal_init_deps_key_functions_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/* Needs: min-max count-tasks iterate */
+static int BT_reduction_REDUCTION_internal_init(parsec_execution_stream_t * es, __parsec_BT_reduction_REDUCTION_task_t * this_task)
+{
+  __parsec_BT_reduction_internal_taskpool_t *__parsec_tp = (__parsec_BT_reduction_internal_taskpool_t*)this_task->taskpool;
+  int32_t nb_tasks = 0, saved_nb_tasks = 0;
+int32_t __i_min = 0x7fffffff, __i_max = 0;int32_t __jdf2c_i_min = 0x7fffffff, __jdf2c_i_max = 0;  __parsec_BT_reduction_REDUCTION_parsec_assignment_t assignments = {  .i.value = 0, .t.value = 0, .li.value = 0, .sz.value = 0 };
+  int32_t  i,  t,  li,  sz;
+  int32_t __jdf2c_i_start, __jdf2c_i_end, __jdf2c_i_inc;
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+  PARSEC_PROFILING_TRACE(es->es_profile,
+                         this_task->taskpool->profiling_array[START_KEY(this_task->task_class->task_class_id)],
+                         0,
+                         this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    __jdf2c_i_start = 0;
+    __jdf2c_i_end = (NT - 1);
+    __jdf2c_i_inc = 1;
+    __i_min = parsec_imin(__jdf2c_i_start, __jdf2c_i_end);
+    __i_max = parsec_imax(__jdf2c_i_start, __jdf2c_i_end);
+    __jdf2c_i_min = parsec_imin(__jdf2c_i_min, __i_min);
+    __jdf2c_i_max = parsec_imax(__jdf2c_i_max, __i_max);
+    for(i =  __jdf2c_i_start;
+        i <= __jdf2c_i_end;
+        i += __jdf2c_i_inc) {
+    assignments.i.value = i;
+  {  /* block for the non-range variable t */
+      t = BT_reduction_REDUCTION_inline_c_expr12_line_104(__parsec_tp, &assignments);
+      assignments.t.value = t;
+    {  /* block for the non-range variable li */
+        li = BT_reduction_REDUCTION_inline_c_expr11_line_105(__parsec_tp, &assignments);
+        assignments.li.value = li;
+      {  /* block for the non-range variable sz */
+          sz = BT_reduction_REDUCTION_inline_c_expr10_line_106(__parsec_tp, &assignments);
+          assignments.sz.value = sz;
+          if( !REDUCTION_pred(i, t, li, sz) ) continue;
+          nb_tasks++;
+        } /* block for the non-range variable sz */ 
+      } /* block for the non-range variable li */ 
+    } /* block for the non-range variable t */ 
+  } /* Loop on normal range i */
+   if( 0 != nb_tasks ) {
+     (void)parsec_atomic_fetch_add_int32(&__parsec_tp->initial_number_tasks, nb_tasks);
+   }
+  /* Set the range variables for the collision-free hash-computation */
+  __parsec_tp->REDUCTION_i_min   = __jdf2c_i_min;
+  __parsec_tp->REDUCTION_i_range = (__jdf2c_i_max - __jdf2c_i_min) + 1;
+    do {
+      this_task->super.list_next = (parsec_list_item_t*)__parsec_tp->startup_queue;
+    } while(!parsec_atomic_cas_ptr(&__parsec_tp->startup_queue, (parsec_list_item_t*)this_task->super.list_next, this_task));
+    this_task->status = PARSEC_TASK_STATUS_HOOK;
+
+  PARSEC_AYU_REGISTER_TASK(&BT_reduction_REDUCTION);
+  __parsec_tp->super.super.dependencies_array[0] = PARSEC_OBJ_NEW(parsec_hash_table_t);
+  parsec_hash_table_init(__parsec_tp->super.super.dependencies_array[0], offsetof(parsec_hashable_dependency_t, ht_item), 10, BT_reduction_BT_reduction_REDUCTION_internal_init_deps_key_functions, this_task->taskpool);
+  __parsec_tp->repositories[0] = data_repo_create_nothreadsafe(nb_tasks, __jdf2c_key_fns_REDUCTION, (parsec_taskpool_t*)__parsec_tp, 1);
+(void)saved_nb_tasks;
+(void)__i_min; (void)__i_max;  (void)__jdf2c_i_start; (void)__jdf2c_i_end; (void)__jdf2c_i_inc;  (void)assignments; (void)__parsec_tp; (void)es;
+  if(1 == parsec_atomic_fetch_dec_int32(&__parsec_tp->sync_point)) {
+    /* Last initialization task complete. Update the number of tasks. */
+    __parsec_tp->super.super.tdm.module->taskpool_addto_nb_tasks(&__parsec_tp->super.super, __parsec_tp->initial_number_tasks);
+    parsec_mfence();  /* write memory barrier to guarantee that the scheduler gets the correct number of tasks */
+    parsec_taskpool_enable((parsec_taskpool_t*)__parsec_tp, &__parsec_tp->startup_queue,
+                           (parsec_task_t*)this_task, es, __parsec_tp->super.super.nb_pending_actions);
+    __parsec_tp->super.super.tdm.module->taskpool_ready(&__parsec_tp->super.super);
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+    PARSEC_PROFILING_TRACE(es->es_profile,
+                           this_task->taskpool->profiling_array[2 * this_task->task_class->task_class_id + 1],
+                           0,
+                           this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    if( 1 >= __parsec_tp->super.super.nb_pending_actions ) {
+        /* if no tasks will be generated let's prevent the runtime from calling the hook and instead go directly to complete the task */
+        this_task->status = PARSEC_TASK_STATUS_COMPLETE;
+    }
+    return PARSEC_HOOK_RETURN_DONE;
+  }
+  return PARSEC_HOOK_RETURN_ASYNC;
+}
+
+static int __jdf2c_startup_REDUCTION(parsec_execution_stream_t * es, __parsec_BT_reduction_REDUCTION_task_t *this_task)
+{
+  __parsec_BT_reduction_REDUCTION_task_t* new_task;
+  __parsec_BT_reduction_internal_taskpool_t* __parsec_tp = (__parsec_BT_reduction_internal_taskpool_t*)this_task->taskpool;
+  parsec_context_t *context = __parsec_tp->super.super.context;
+  int vpid = 0, nb_tasks = 0;
+  size_t total_nb_tasks = 0;
+  parsec_list_item_t* pready_ring[context->nb_vp];
+  int restore_context = 0;
+  int i = this_task->locals.i.value;  /* retrieve value saved during the last iteration */
+  int t = this_task->locals.t.value;  /* retrieve value saved during the last iteration */
+  int li = this_task->locals.li.value;  /* retrieve value saved during the last iteration */
+  int sz = this_task->locals.sz.value;  /* retrieve value saved during the last iteration */
+  for(int _i = 0; _i < context->nb_vp; pready_ring[_i++] = NULL );
+  if( 0 != this_task->locals.reserved[0].value ) {
+    this_task->locals.reserved[0].value = 1; /* reset the submission process */
+    restore_context = 1;
+    goto restore_context_0;
+  }
+  this_task->locals.reserved[0].value = 1; /* a sane default value */
+  for(this_task->locals.i.value = i = 0;
+      this_task->locals.i.value <= (NT - 1);
+      this_task->locals.i.value += 1, i = this_task->locals.i.value) {
+    this_task->locals.t.value = t = BT_reduction_REDUCTION_inline_c_expr12_line_104(__parsec_tp, &this_task->locals);
+    this_task->locals.li.value = li = BT_reduction_REDUCTION_inline_c_expr11_line_105(__parsec_tp, &this_task->locals);
+    this_task->locals.sz.value = sz = BT_reduction_REDUCTION_inline_c_expr10_line_106(__parsec_tp, &this_task->locals);
+    if( !REDUCTION_pred(i, t, li, sz) ) continue;
+  __parsec_BT_reduction_REDUCTION_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_BT_reduction_REDUCTION_parsec_assignment_t*)&this_task->locals;
+  (void)__jdf2c__tmp_locals;
+  /* Flow for A is always a memory reference */
+    if( NULL != ((parsec_data_collection_t*)__parsec_tp->super._g_dataA)->vpid_of ) {
+      vpid = ((parsec_data_collection_t*)__parsec_tp->super._g_dataA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_dataA, i, 0);
+      assert(context->nb_vp >= vpid);
+    } else {
+      vpid = (vpid + 1) % context->nb_vp;  /* spread the initial joy */
+    }
+    new_task = (__parsec_BT_reduction_REDUCTION_task_t*)parsec_thread_mempool_allocate( context->virtual_processes[vpid]->execution_streams[0]->context_mempool );
+    PARSEC_OBJ_CONSTRUCT(new_task, parsec_task_t); /* construct called only when new, force-construct it again */
+    /* Copy only the valid elements from this_task to new_task one */
+    new_task->taskpool   = this_task->taskpool;
+    new_task->task_class = __parsec_tp->super.super.task_classes_array[BT_reduction_REDUCTION.task_class_id];
+    new_task->chore_mask   = PARSEC_DEV_ALL;
+    new_task->locals.i.value = this_task->locals.i.value;
+    new_task->locals.t.value = this_task->locals.t.value;
+    new_task->locals.li.value = this_task->locals.li.value;
+    new_task->locals.sz.value = this_task->locals.sz.value;
+    PARSEC_LIST_ITEM_SINGLETON(new_task);
+    new_task->priority = __parsec_tp->super.super.priority;
+    new_task->repo_entry = NULL;
+    new_task->data._f_A.source_repo_entry = NULL;
+    new_task->data._f_A.source_repo       = NULL;
+    new_task->data._f_A.data_in         = NULL;
+    new_task->data._f_A.data_out        = NULL;
+    new_task->data._f_A.fulfill         = 0;
+#if defined(PARSEC_DEBUG_NOISIER)
+    {
+      char tmp[128];
+      PARSEC_DEBUG_VERBOSE(10, parsec_debug_output, "Add startup task %s to vpid %d",
+             parsec_task_snprintf(tmp, 128, (parsec_task_t*)new_task), vpid);
+    }
+#endif
+    parsec_dependencies_mark_task_as_startup((parsec_task_t*)new_task, es);
+    pready_ring[vpid] = parsec_list_item_ring_push_sorted(pready_ring[vpid],
+                                                          (parsec_list_item_t*)new_task,
+                                                          parsec_execution_context_priority_comparator);
+    nb_tasks++;
+   restore_context_0:  /* we jump here just so that we have code after the label */
+    restore_context = 0;
+    (void)restore_context;
+    if( nb_tasks > this_task->locals.reserved[0].value ) {
+      if( (size_t)this_task->locals.reserved[0].value < parsec_task_startup_iter ) this_task->locals.reserved[0].value <<= 1;
+      __parsec_schedule_vp(es, (parsec_task_t**)pready_ring, 0);
+      total_nb_tasks += nb_tasks;
+      nb_tasks = 0;
+      if( total_nb_tasks > parsec_task_startup_chunk ) {  /* stop here and request to be rescheduled */
+        return PARSEC_HOOK_RETURN_AGAIN;
+      }
+    }
+  } /* Loop on normal range i */
+  (void)vpid;
+  if( 0 != nb_tasks ) {
+    __parsec_schedule_vp(es, (parsec_task_t**)pready_ring, 0);
+    nb_tasks = 0;
+  }
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static const __parsec_chore_t __BT_reduction_REDUCTION_chores[] ={
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+    { .type     = PARSEC_DEV_CPU,
+      .evaluate = (parsec_evaluate_function_t*)NULL,
+      .hook     = (parsec_hook_t*)hook_of_BT_reduction_REDUCTION },
+#endif  /* defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+    { .type     = PARSEC_DEV_NONE,
+      .evaluate = NULL,
+      .hook     = (parsec_hook_t*)NULL },  /* End marker */
+};
+
+static const parsec_task_class_t BT_reduction_REDUCTION = {
+  .name = "REDUCTION",
+  .task_class_id = 0,
+  .nb_flows = 1,
+  .nb_parameters = 1,
+  .nb_locals = 4,
+  .task_class_type = PARSEC_TASK_CLASS_TYPE_PTG,
+  .params = { &symb_BT_reduction_REDUCTION_i, NULL },
+  .locals = { &symb_BT_reduction_REDUCTION_i, &symb_BT_reduction_REDUCTION_t, &symb_BT_reduction_REDUCTION_li, &symb_BT_reduction_REDUCTION_sz, NULL },
+  .data_affinity = (parsec_data_ref_fn_t*)affinity_of_BT_reduction_REDUCTION,
+  .initial_data = (parsec_data_ref_fn_t*)affinity_of_BT_reduction_REDUCTION,
+  .final_data = (parsec_data_ref_fn_t*)affinity_of_BT_reduction_REDUCTION,
+  .priority = NULL,
+  .properties = properties_of_BT_reduction_REDUCTION,
+#if MAX_PARAM_COUNT < 1  /* number of read flows of REDUCTION */
+  #error Too many read flows for task REDUCTION
+#endif  /* MAX_PARAM_COUNT */
+#if MAX_PARAM_COUNT < 1  /* number of write flows of REDUCTION */
+  #error Too many write flows for task REDUCTION
+#endif  /* MAX_PARAM_COUNT */
+  .in = { &flow_of_BT_reduction_REDUCTION_for_A, NULL },
+  .out = { &flow_of_BT_reduction_REDUCTION_for_A, NULL },
+  .flags = 0x0 | PARSEC_HAS_IN_IN_DEPENDENCIES | PARSEC_USE_DEPS_MASK,
+  .dependencies_goal = 0x1,
+  .make_key = __jdf2c_make_key_REDUCTION,
+  .task_snprintf = parsec_task_snprintf,
+#if defined(PARSEC_PROF_TRACE)
+  .profile_info = &parsec_task_profile_info,
+#endif
+  .key_functions = &__jdf2c_key_fns_REDUCTION,
+  .fini = (parsec_hook_t*)NULL,
+  .incarnations = __BT_reduction_REDUCTION_chores,
+  .find_deps = parsec_hash_find_deps,
+  .update_deps = parsec_update_deps_with_mask,
+  .iterate_successors = (parsec_traverse_function_t*)iterate_successors_of_BT_reduction_REDUCTION,
+  .iterate_predecessors = (parsec_traverse_function_t*)NULL,
+  .release_deps = (parsec_release_deps_t*)release_deps_of_BT_reduction_REDUCTION,
+  .prepare_output = (parsec_hook_t*)NULL,
+  .prepare_input = (parsec_hook_t*)data_lookup_of_BT_reduction_REDUCTION,
+  .time_estimate = NULL,
+  .get_datatype = datatype_lookup_of_BT_reduction_REDUCTION,
+  .complete_execution = (parsec_hook_t*)complete_hook_of_BT_reduction_REDUCTION,
+  .release_task = &release_task_of_BT_reduction_REDUCTION,
+#if defined(PARSEC_SIM)
+  .sim_cost_fct = (parsec_sim_cost_fct_t*)NULL,
+#endif
+};
+
+
+static const parsec_task_class_t *BT_reduction_task_classes[] = {
+  &BT_reduction_REDUCTION,
+  &BT_reduction_BT_REDUC,
+  &BT_reduction_LINEAR_REDUC,
+  &BT_reduction_LINE_TERMINATOR
+};
+
+static void BT_reduction_startup(parsec_context_t *context, __parsec_BT_reduction_internal_taskpool_t *__parsec_tp, parsec_list_item_t ** ready_tasks)
+{
+  uint32_t i, supported_dev = 0;
+ 
+  for( i = 0; i < parsec_nb_devices; i++ ) {
+    if( !(__parsec_tp->super.super.devices_index_mask & (1<<i)) ) continue;
+    parsec_device_module_t* device = parsec_mca_device_get(i);
+    parsec_data_collection_t* parsec_dc;
+ 
+    if(NULL == device) continue;
+    if(NULL != device->taskpool_register)
+      if( PARSEC_SUCCESS != device->taskpool_register(device, (parsec_taskpool_t*)__parsec_tp) ) {
+        parsec_debug_verbose(5, parsec_debug_output, "Device %s refused to register taskpool %p", device->name, __parsec_tp);
+        __parsec_tp->super.super.devices_index_mask &= ~(1 << device->device_index);
+        continue;
+      }
+    if(NULL != device->memory_register) {  /* Register all the data */
+      parsec_dc = (parsec_data_collection_t*)__parsec_tp->super._g_dataA;
+      if( (NULL != parsec_dc->register_memory) &&
+          (PARSEC_SUCCESS != parsec_dc->register_memory(parsec_dc, device)) ) {
+        parsec_debug_verbose(3, parsec_debug_output, "Device %s refused to register memory for data %s (%p) from taskpool %p",
+                     device->name, parsec_dc->key_base, parsec_dc, __parsec_tp);
+        __parsec_tp->super.super.devices_index_mask &= ~(1 << device->device_index);
+      }
+    }
+    supported_dev |= device->type;
+  }
+  /* Remove all the chores without a backend device */
+  for( i = 0; i < PARSEC_BT_reduction_NB_TASK_CLASSES; i++ ) {
+    parsec_task_class_t* tc = (parsec_task_class_t*)__parsec_tp->super.super.task_classes_array[i];
+    __parsec_chore_t* chores = (__parsec_chore_t*)tc->incarnations;
+    uint32_t idx = 0, j;
+    for( j = 0; PARSEC_DEV_NONE != chores[j].type; j++ ) {
+      if( !(supported_dev & chores[j].type) ) continue;
+      if( j != idx ) {
+        chores[idx] = chores[j];
+        parsec_debug_verbose(20, parsec_debug_output, "Device type %i disabled for function %s"
+, chores[j].type, tc->name);
+      }
+      idx++;
+    }
+    chores[idx].type     = PARSEC_DEV_NONE;
+    chores[idx].evaluate = NULL;
+    chores[idx].hook     = NULL;
+    /* Create the initialization tasks for each taskclass */
+    parsec_task_t* task = (parsec_task_t*)parsec_thread_mempool_allocate(context->virtual_processes[0]->execution_streams[0]->context_mempool);
+    PARSEC_OBJ_CONSTRUCT(task, parsec_task_t); /* construct called only when new, force-construct it again */
+    task->taskpool = (parsec_taskpool_t *)__parsec_tp;
+    task->chore_mask = PARSEC_DEV_CPU;
+    memset(&task->locals, 0, sizeof(parsec_assignment_t) * MAX_LOCAL_COUNT);
+    PARSEC_LIST_ITEM_SINGLETON(task);
+    task->priority = -1;
+    task->task_class = task->taskpool->task_classes_array[PARSEC_BT_reduction_NB_TASK_CLASSES + i];
+    int where = i % context->nb_vp;
+    if( NULL == ready_tasks[where] ) ready_tasks[where] = &task->super;
+    else ready_tasks[where] = parsec_list_item_ring_push(ready_tasks[where], &task->super);
+  }
+}
+static void __parsec_BT_reduction_internal_destructor( __parsec_BT_reduction_internal_taskpool_t *__parsec_tp )
+{
+  uint32_t i;
+  parsec_taskpool_unregister( &__parsec_tp->super.super );
+  if(NULL != __parsec_tp->super.super.tdm.module) __parsec_tp->super.super.tdm.module->unmonitor_taskpool(&__parsec_tp->super.super);
+  for( i = 0; i < (uint32_t)(2 * __parsec_tp->super.super.nb_task_classes); i++ ) {  /* Extra startup function added at the end */
+    parsec_task_class_t* tc = (parsec_task_class_t*)__parsec_tp->super.super.task_classes_array[i];
+    free((void*)tc->incarnations);
+    free(tc);
+  }
+  free(__parsec_tp->super.super.task_classes_array); __parsec_tp->super.super.task_classes_array = NULL;
+  __parsec_tp->super.super.nb_task_classes = 0;
+
+  for(i = 0; i < (uint32_t)__parsec_tp->super.arenas_datatypes_size; i++) {
+    if( NULL != __parsec_tp->super.arenas_datatypes[i].arena ) {
+      PARSEC_OBJ_RELEASE(__parsec_tp->super.arenas_datatypes[i].arena);
+    }
+  }
+  /* Destroy the data repositories for this object */
+   data_repo_destroy_nothreadsafe(__parsec_tp->repositories[3]);  /* LINE_TERMINATOR */
+   data_repo_destroy_nothreadsafe(__parsec_tp->repositories[2]);  /* LINEAR_REDUC */
+   data_repo_destroy_nothreadsafe(__parsec_tp->repositories[1]);  /* BT_REDUC */
+   data_repo_destroy_nothreadsafe(__parsec_tp->repositories[0]);  /* REDUCTION */
+  /* Release the dependencies arrays for this object */
+  parsec_hash_table_fini( (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[3] );
+  PARSEC_OBJ_RELEASE(__parsec_tp->super.super.dependencies_array[3]);
+  __parsec_tp->super.super.dependencies_array[3] = NULL;
+  parsec_hash_table_fini( (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[2] );
+  PARSEC_OBJ_RELEASE(__parsec_tp->super.super.dependencies_array[2]);
+  __parsec_tp->super.super.dependencies_array[2] = NULL;
+  parsec_hash_table_fini( (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[1] );
+  PARSEC_OBJ_RELEASE(__parsec_tp->super.super.dependencies_array[1]);
+  __parsec_tp->super.super.dependencies_array[1] = NULL;
+  parsec_hash_table_fini( (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[0] );
+  PARSEC_OBJ_RELEASE(__parsec_tp->super.super.dependencies_array[0]);
+  __parsec_tp->super.super.dependencies_array[0] = NULL;
+  free( __parsec_tp->super.super.dependencies_array );
+  __parsec_tp->super.super.dependencies_array = NULL;
+  /* Unregister all the data */
+  uint32_t _i;
+  for( _i = 0; _i < parsec_nb_devices; _i++ ) {
+    parsec_device_module_t* device;
+    parsec_data_collection_t* parsec_dc;
+    if(!(__parsec_tp->super.super.devices_index_mask & (1 << _i))) continue;
+    if((NULL == (device = parsec_mca_device_get(_i))) || (NULL == device->memory_unregister)) continue;
+    parsec_dc = (parsec_data_collection_t*)__parsec_tp->super._g_dataA;
+  if( NULL != parsec_dc->unregister_memory ) { (void)parsec_dc->unregister_memory(parsec_dc, device); };
+}
+  /* Unregister the taskpool from the devices */
+  for( i = 0; i < parsec_nb_devices; i++ ) {
+    if(!(__parsec_tp->super.super.devices_index_mask & (1 << i))) continue;
+    __parsec_tp->super.super.devices_index_mask ^= (1 << i);
+    parsec_device_module_t* device = parsec_mca_device_get(i);
+    if((NULL == device) || (NULL == device->taskpool_unregister)) continue;
+    if( PARSEC_SUCCESS != device->taskpool_unregister(device, &__parsec_tp->super.super) ) continue;
+  }
+  free(__parsec_tp->super.super.taskpool_name); __parsec_tp->super.super.taskpool_name = NULL;
+}
+
+void __parsec_BT_reduction_internal_constructor(__parsec_BT_reduction_internal_taskpool_t* __parsec_tp)
+{
+  parsec_task_class_t* tc;
+  uint32_t i, j;
+
+  __parsec_tp->super.super.nb_task_classes = PARSEC_BT_reduction_NB_TASK_CLASSES;
+  __parsec_tp->super.super.devices_index_mask = PARSEC_DEVICES_ALL;
+  __parsec_tp->super.super.taskpool_name = strdup("BT_reduction");
+  parsec_termdet_open_module(&__parsec_tp->super.super, "local");
+  __parsec_tp->super.super.tdm.module->monitor_taskpool(&__parsec_tp->super.super,
+                                                        parsec_taskpool_termination_detected);
+  __parsec_tp->super.super.update_nb_runtime_task = parsec_add_fetch_runtime_task;
+  __parsec_tp->super.super.dependencies_array = (void **)
+              calloc(__parsec_tp->super.super.nb_task_classes, sizeof(void*));
+  /* Twice the size to hold the startup tasks function_t */
+  __parsec_tp->super.super.task_classes_array = (const parsec_task_class_t**)
+              calloc((2 * PARSEC_BT_reduction_NB_TASK_CLASSES + 1), sizeof(parsec_task_class_t*));
+  __parsec_tp->super.super.tdm.module->taskpool_addto_runtime_actions(&__parsec_tp->super.super, PARSEC_BT_reduction_NB_TASK_CLASSES);  /* for the startup tasks */
+  __parsec_tp->super.super.taskpool_type = PARSEC_TASKPOOL_TYPE_PTG;
+  __parsec_tp->sync_point = __parsec_tp->super.super.nb_task_classes;
+  __parsec_tp->initial_number_tasks = 0;
+  __parsec_tp->startup_queue = NULL;
+  for( i = 0; i < __parsec_tp->super.super.nb_task_classes; i++ ) {
+    __parsec_tp->super.super.task_classes_array[i] = tc = malloc(sizeof(parsec_task_class_t));
+    memcpy(tc, BT_reduction_task_classes[i], sizeof(parsec_task_class_t));
+    for( j = 0; PARSEC_DEV_NONE != tc->incarnations[j].type; j++);  /* compute the number of incarnations */
+    tc->incarnations = (__parsec_chore_t*)malloc((j+1) * sizeof(__parsec_chore_t));
+        memcpy((__parsec_chore_t*)tc->incarnations, BT_reduction_task_classes[i]->incarnations, (j+1) * sizeof(__parsec_chore_t));
+
+    /* Add a placeholder for initialization and startup task */
+    __parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+i] = tc = (parsec_task_class_t*)malloc(sizeof(parsec_task_class_t));
+    memcpy(tc, (void*)&__parsec_generic_startup, sizeof(parsec_task_class_t));
+    tc->task_class_id = __parsec_tp->super.super.nb_task_classes + i;
+    tc->incarnations = (__parsec_chore_t*)malloc(2 * sizeof(__parsec_chore_t));
+    memcpy((__parsec_chore_t*)tc->incarnations, (void*)__parsec_generic_startup.incarnations, 2 * sizeof(__parsec_chore_t));
+    tc->release_task = parsec_release_task_to_mempool_and_count_as_runtime_tasks;
+  }
+  /* Startup task for LINE_TERMINATOR */
+  tc = (parsec_task_class_t *)__parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+0];
+  tc->name = "Startup for LINE_TERMINATOR";
+  tc->prepare_input = (parsec_hook_t*)BT_reduction_LINE_TERMINATOR_internal_init;
+  ((__parsec_chore_t*)&tc->incarnations[0])->hook = (parsec_hook_t *)__jdf2c_startup_LINE_TERMINATOR;
+  /* Startup task for LINEAR_REDUC */
+  tc = (parsec_task_class_t *)__parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+1];
+  tc->name = "Startup for LINEAR_REDUC";
+  tc->prepare_input = (parsec_hook_t*)BT_reduction_LINEAR_REDUC_internal_init;
+  /* Startup task for BT_REDUC */
+  tc = (parsec_task_class_t *)__parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+2];
+  tc->name = "Startup for BT_REDUC";
+  tc->prepare_input = (parsec_hook_t*)BT_reduction_BT_REDUC_internal_init;
+  /* Startup task for REDUCTION */
+  tc = (parsec_task_class_t *)__parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+3];
+  tc->name = "Startup for REDUCTION";
+  tc->prepare_input = (parsec_hook_t*)BT_reduction_REDUCTION_internal_init;
+  ((__parsec_chore_t*)&tc->incarnations[0])->hook = (parsec_hook_t *)__jdf2c_startup_REDUCTION;
+  /* Compute the number of arenas_datatypes: */
+  /*   PARSEC_BT_reduction_DEFAULT_ARENA  ->  0 */
+  __parsec_tp->super.arenas_datatypes_size = 1;
+  memset(&__parsec_tp->super.arenas_datatypes[0], 0, __parsec_tp->super.arenas_datatypes_size*sizeof(parsec_arena_datatype_t));
+  /* If profiling is enabled, the keys for profiling */
+#  if defined(PARSEC_PROF_TRACE)
+  __parsec_tp->super.super.profiling_array = BT_reduction_profiling_array;
+  if( -2 == BT_reduction_profiling_array[0] ) {
+    #if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+parsec_profiling_add_dictionary_keyword("BT_reduction::LINE_TERMINATOR::internal init", "fill:34D8D8",
+                                       0,
+                                       NULL,
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(BT_reduction_LINE_TERMINATOR.task_class_id  + PARSEC_BT_reduction_NB_TASK_CLASSES)/* LINE_TERMINATOR (internal init) start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(BT_reduction_LINE_TERMINATOR.task_class_id  + PARSEC_BT_reduction_NB_TASK_CLASSES)/* LINE_TERMINATOR (internal init) end key */]);
+#endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+parsec_profiling_add_dictionary_keyword("BT_reduction::LINE_TERMINATOR", "fill:CC2828",
+                                       sizeof(parsec_task_prof_info_t)+4*sizeof(parsec_assignment_t),
+                                       "dc_key{uint64_t};priority{int32_t};dc_dataid{uint32_t};tcid{uint32_t};trc{int32_t};j{int32_t};tree_count{int32_t};i{int32_t};offset{int32_t}",
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(BT_reduction_LINE_TERMINATOR.task_class_id) /* LINE_TERMINATOR start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(BT_reduction_LINE_TERMINATOR.task_class_id) /* LINE_TERMINATOR end key */]);
+
+    #if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+parsec_profiling_add_dictionary_keyword("BT_reduction::LINEAR_REDUC::internal init", "fill:8634D8",
+                                       0,
+                                       NULL,
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(BT_reduction_LINEAR_REDUC.task_class_id  + PARSEC_BT_reduction_NB_TASK_CLASSES)/* LINEAR_REDUC (internal init) start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(BT_reduction_LINEAR_REDUC.task_class_id  + PARSEC_BT_reduction_NB_TASK_CLASSES)/* LINEAR_REDUC (internal init) end key */]);
+#endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+parsec_profiling_add_dictionary_keyword("BT_reduction::LINEAR_REDUC", "fill:7ACC28",
+                                       sizeof(parsec_task_prof_info_t)+4*sizeof(parsec_assignment_t),
+                                       "dc_key{uint64_t};priority{int32_t};dc_dataid{uint32_t};tcid{uint32_t};trc{int32_t};tree_count{int32_t};i{int32_t};sz{int32_t};offset{int32_t}",
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(BT_reduction_LINEAR_REDUC.task_class_id) /* LINEAR_REDUC start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(BT_reduction_LINEAR_REDUC.task_class_id) /* LINEAR_REDUC end key */]);
+
+    #if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+parsec_profiling_add_dictionary_keyword("BT_reduction::BT_REDUC::internal init", "fill:D83434",
+                                       0,
+                                       NULL,
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(BT_reduction_BT_REDUC.task_class_id  + PARSEC_BT_reduction_NB_TASK_CLASSES)/* BT_REDUC (internal init) start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(BT_reduction_BT_REDUC.task_class_id  + PARSEC_BT_reduction_NB_TASK_CLASSES)/* BT_REDUC (internal init) end key */]);
+#endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+parsec_profiling_add_dictionary_keyword("BT_reduction::BT_REDUC", "fill:28CCCC",
+                                       sizeof(parsec_task_prof_info_t)+7*sizeof(parsec_assignment_t),
+                                       "dc_key{uint64_t};priority{int32_t};dc_dataid{uint32_t};tcid{uint32_t};trc{int32_t};tree_count{int32_t};t{int32_t};sz{int32_t};s{int32_t};lvl{int32_t};i{int32_t};offset{int32_t}",
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(BT_reduction_BT_REDUC.task_class_id) /* BT_REDUC start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(BT_reduction_BT_REDUC.task_class_id) /* BT_REDUC end key */]);
+
+    #if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+parsec_profiling_add_dictionary_keyword("BT_reduction::REDUCTION::internal init", "fill:86D834",
+                                       0,
+                                       NULL,
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(BT_reduction_REDUCTION.task_class_id  + PARSEC_BT_reduction_NB_TASK_CLASSES)/* REDUCTION (internal init) start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(BT_reduction_REDUCTION.task_class_id  + PARSEC_BT_reduction_NB_TASK_CLASSES)/* REDUCTION (internal init) end key */]);
+#endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+parsec_profiling_add_dictionary_keyword("BT_reduction::REDUCTION", "fill:7A28CC",
+                                       sizeof(parsec_task_prof_info_t)+4*sizeof(parsec_assignment_t),
+                                       "dc_key{uint64_t};priority{int32_t};dc_dataid{uint32_t};tcid{uint32_t};trc{int32_t};i{int32_t};t{int32_t};li{int32_t};sz{int32_t}",
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(BT_reduction_REDUCTION.task_class_id) /* REDUCTION start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(BT_reduction_REDUCTION.task_class_id) /* REDUCTION end key */]);
+
+  }
+#  endif /* defined(PARSEC_PROF_TRACE) */
+  __parsec_tp->super.super.repo_array = __parsec_tp->repositories;
+  __parsec_tp->super.super.startup_hook = (parsec_startup_fn_t)BT_reduction_startup;
+  (void)parsec_taskpool_reserve_id((parsec_taskpool_t*)__parsec_tp);
+}
+
+  /** Generate class declaration and instance using the above constructor and destructor */
+  PARSEC_OBJ_CLASS_DECLARATION(__parsec_BT_reduction_internal_taskpool_t);
+  PARSEC_OBJ_CLASS_INSTANCE(__parsec_BT_reduction_internal_taskpool_t, parsec_BT_reduction_taskpool_t,
+                            __parsec_BT_reduction_internal_constructor, __parsec_BT_reduction_internal_destructor);
+
+#undef dataA
+#undef NB
+#undef NT
+
+parsec_BT_reduction_taskpool_t *parsec_BT_reduction_new(parsec_tiled_matrix_t * dataA /* data dataA */, int NB, int NT)
+{
+  __parsec_BT_reduction_internal_taskpool_t *__parsec_tp = PARSEC_OBJ_NEW(__parsec_BT_reduction_internal_taskpool_t);
+  /* Dump the hidden parameters with default values */
+
+  /* Now the Parameter-dependent structures: */
+  __parsec_tp->super._g_dataA = dataA;
+  __parsec_tp->super._g_NB = NB;
+  __parsec_tp->super._g_NT = NT;
+  PARSEC_AYU_REGISTER_TASK(&BT_reduction_LINE_TERMINATOR);
+  PARSEC_AYU_REGISTER_TASK(&BT_reduction_LINEAR_REDUC);
+  PARSEC_AYU_REGISTER_TASK(&BT_reduction_BT_REDUC);
+  PARSEC_AYU_REGISTER_TASK(&BT_reduction_REDUCTION);
+  __parsec_tp->super.super.startup_hook = (parsec_startup_fn_t)BT_reduction_startup;
+  (void)parsec_taskpool_reserve_id((parsec_taskpool_t*)__parsec_tp);
+/* Prevent warnings related to not used hidden global variables */
+;
+  return (parsec_BT_reduction_taskpool_t*)__parsec_tp;
+}
+
@@ -0,0 +1,164 @@
+#ifndef _BT_reduction_h_
+#define _BT_reduction_h_
+#include "parsec.h"
+#include "parsec/parsec_internal.h"
+#include "parsec/remote_dep.h"
+
+BEGIN_C_DECLS
+
+#define PARSEC_BT_reduction_DEFAULT_ADT_IDX    0
+#define PARSEC_BT_reduction_ADT_IDX_MAX       1
+typedef struct parsec_BT_reduction_taskpool_s {
+  parsec_taskpool_t super;
+  /* The list of globals */
+  parsec_tiled_matrix_t * _g_dataA /* data dataA */;
+  int _g_NB;
+  int _g_NT;
+  /* The array of datatypes (DEFAULT and co.) */
+  parsec_arena_datatype_t arenas_datatypes[PARSEC_BT_reduction_ADT_IDX_MAX];
+  uint32_t arenas_datatypes_size;
+} parsec_BT_reduction_taskpool_t;
+
+/** Beware that this object is not a superset of the internal object, and as a result
+ *  we should never create one directly. Instead we should rely on the creation of the
+ *  internal object (__parsec_BT_reduction_taskpool_t).
+ */
+PARSEC_OBJ_CLASS_DECLARATION(parsec_BT_reduction_taskpool_t);
+extern parsec_BT_reduction_taskpool_t *parsec_BT_reduction_new(parsec_tiled_matrix_t * _g_dataA /* data dataA */, int _g_NB, int _g_NT);
+
+#if MAX_LOCAL_COUNT < 4  /* number of parameters and locals LINE_TERMINATOR */
+  #error Too many parameters and local variables (4 out of MAX_LOCAL_COUNT) for task LINE_TERMINATOR
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_BT_reduction_LINE_TERMINATOR_assignment_s {
+  parsec_assignment_t j;
+  parsec_assignment_t tree_count;
+  parsec_assignment_t i;
+  parsec_assignment_t offset;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-4];
+} __parsec_BT_reduction_LINE_TERMINATOR_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 1  /* total number of flows for task LINE_TERMINATOR */
+  #error Too many flows (1 out of MAX_PARAM_COUNT) for task LINE_TERMINATOR
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_BT_reduction_LINE_TERMINATOR_data_s {
+  parsec_data_pair_t _f_T;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-1];
+} __parsec_BT_reduction_LINE_TERMINATOR_data_t;
+
+typedef struct __parsec_BT_reduction_LINE_TERMINATOR_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_BT_reduction_LINE_TERMINATOR_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_BT_reduction_LINE_TERMINATOR_data_s data;
+} __parsec_BT_reduction_LINE_TERMINATOR_task_t;
+
+
+#if MAX_LOCAL_COUNT < 4  /* number of parameters and locals LINEAR_REDUC */
+  #error Too many parameters and local variables (4 out of MAX_LOCAL_COUNT) for task LINEAR_REDUC
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_BT_reduction_LINEAR_REDUC_assignment_s {
+  parsec_assignment_t tree_count;
+  parsec_assignment_t i;
+  parsec_assignment_t sz;
+  parsec_assignment_t offset;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-4];
+} __parsec_BT_reduction_LINEAR_REDUC_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 2  /* total number of flows for task LINEAR_REDUC */
+  #error Too many flows (2 out of MAX_PARAM_COUNT) for task LINEAR_REDUC
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_BT_reduction_LINEAR_REDUC_data_s {
+  parsec_data_pair_t _f_C;
+  parsec_data_pair_t _f_B;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-2];
+} __parsec_BT_reduction_LINEAR_REDUC_data_t;
+
+typedef struct __parsec_BT_reduction_LINEAR_REDUC_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_BT_reduction_LINEAR_REDUC_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_BT_reduction_LINEAR_REDUC_data_s data;
+} __parsec_BT_reduction_LINEAR_REDUC_task_t;
+
+
+#if MAX_LOCAL_COUNT < 7  /* number of parameters and locals BT_REDUC */
+  #error Too many parameters and local variables (7 out of MAX_LOCAL_COUNT) for task BT_REDUC
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_BT_reduction_BT_REDUC_assignment_s {
+  parsec_assignment_t tree_count;
+  parsec_assignment_t t;
+  parsec_assignment_t sz;
+  parsec_assignment_t s;
+  parsec_assignment_t lvl;
+  parsec_assignment_t i;
+  parsec_assignment_t offset;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-7];
+} __parsec_BT_reduction_BT_REDUC_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 2  /* total number of flows for task BT_REDUC */
+  #error Too many flows (2 out of MAX_PARAM_COUNT) for task BT_REDUC
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_BT_reduction_BT_REDUC_data_s {
+  parsec_data_pair_t _f_B;
+  parsec_data_pair_t _f_A;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-2];
+} __parsec_BT_reduction_BT_REDUC_data_t;
+
+typedef struct __parsec_BT_reduction_BT_REDUC_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_BT_reduction_BT_REDUC_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_BT_reduction_BT_REDUC_data_s data;
+} __parsec_BT_reduction_BT_REDUC_task_t;
+
+
+#if MAX_LOCAL_COUNT < 4  /* number of parameters and locals REDUCTION */
+  #error Too many parameters and local variables (4 out of MAX_LOCAL_COUNT) for task REDUCTION
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_BT_reduction_REDUCTION_assignment_s {
+  parsec_assignment_t i;
+  parsec_assignment_t t;
+  parsec_assignment_t li;
+  parsec_assignment_t sz;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-4];
+} __parsec_BT_reduction_REDUCTION_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 1  /* total number of flows for task REDUCTION */
+  #error Too many flows (1 out of MAX_PARAM_COUNT) for task REDUCTION
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_BT_reduction_REDUCTION_data_s {
+  parsec_data_pair_t _f_A;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-1];
+} __parsec_BT_reduction_REDUCTION_data_t;
+
+typedef struct __parsec_BT_reduction_REDUCTION_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_BT_reduction_REDUCTION_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_BT_reduction_REDUCTION_data_s data;
+} __parsec_BT_reduction_REDUCTION_task_t;
+
+
+END_C_DECLS
+
+#endif /* _BT_reduction_h_ */ 
@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/_debug_build/tests/apps/generalized_reduction/BT_reduction.c" "tests/apps/generalized_reduction/CMakeFiles/BT_reduction.dir/BT_reduction.c.o" "gcc" "tests/apps/generalized_reduction/CMakeFiles/BT_reduction.dir/BT_reduction.c.o.d"
+  "/root/repo/tests/apps/generalized_reduction/BT_reduction_wrapper.c" "tests/apps/generalized_reduction/CMakeFiles/BT_reduction.dir/BT_reduction_wrapper.c.o" "gcc" "tests/apps/generalized_reduction/CMakeFiles/BT_reduction.dir/BT_reduction_wrapper.c.o.d"
+  "/root/repo/tests/apps/generalized_reduction/main.c" "tests/apps/generalized_reduction/CMakeFiles/BT_reduction.dir/main.c.o" "gcc" "tests/apps/generalized_reduction/CMakeFiles/BT_reduction.dir/main.c.o.d"
+  "/root/repo/tests/apps/generalized_reduction/reduc_data.c" "tests/apps/generalized_reduction/CMakeFiles/BT_reduction.dir/reduc_data.c.o" "gcc" "tests/apps/generalized_reduction/CMakeFiles/BT_reduction.dir/reduc_data.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_debug_build/parsec/CMakeFiles/parsec.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "/root/repo/_debug_build/parsec/include/fortran")
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "BT_reduction"
+  "BT_reduction.pdb"
+  "CMakeFiles/BT_reduction.dir/BT_reduction.c.o"
+  "CMakeFiles/BT_reduction.dir/BT_reduction.c.o.d"
+  "CMakeFiles/BT_reduction.dir/BT_reduction_wrapper.c.o"
+  "CMakeFiles/BT_reduction.dir/BT_reduction_wrapper.c.o.d"
+  "CMakeFiles/BT_reduction.dir/main.c.o"
+  "CMakeFiles/BT_reduction.dir/main.c.o.d"
+  "CMakeFiles/BT_reduction.dir/reduc_data.c.o"
+  "CMakeFiles/BT_reduction.dir/reduc_data.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/BT_reduction.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
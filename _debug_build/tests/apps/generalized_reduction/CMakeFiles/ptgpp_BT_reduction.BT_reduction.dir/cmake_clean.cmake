@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "BT_reduction.c"
+  "BT_reduction.h"
+  "CMakeFiles/ptgpp_BT_reduction.BT_reduction"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ptgpp_BT_reduction.BT_reduction.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/apps/haar_tree/main.c" "tests/apps/haar_tree/CMakeFiles/project.dir/main.c.o" "gcc" "tests/apps/haar_tree/CMakeFiles/project.dir/main.c.o.d"
+  "/root/repo/_debug_build/tests/apps/haar_tree/project.c" "tests/apps/haar_tree/CMakeFiles/project.dir/project.c.o" "gcc" "tests/apps/haar_tree/CMakeFiles/project.dir/project.c.o.d"
+  "/root/repo/tests/apps/haar_tree/tree_dist.c" "tests/apps/haar_tree/CMakeFiles/project.dir/tree_dist.c.o" "gcc" "tests/apps/haar_tree/CMakeFiles/project.dir/tree_dist.c.o.d"
+  "/root/repo/_debug_build/tests/apps/haar_tree/walk.c" "tests/apps/haar_tree/CMakeFiles/project.dir/walk.c.o" "gcc" "tests/apps/haar_tree/CMakeFiles/project.dir/walk.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_debug_build/parsec/CMakeFiles/parsec.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "/root/repo/_debug_build/parsec/include/fortran")
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/project.dir/main.c.o"
+  "CMakeFiles/project.dir/main.c.o.d"
+  "CMakeFiles/project.dir/project.c.o"
+  "CMakeFiles/project.dir/project.c.o.d"
+  "CMakeFiles/project.dir/tree_dist.c.o"
+  "CMakeFiles/project.dir/tree_dist.c.o.d"
+  "CMakeFiles/project.dir/walk.c.o"
+  "CMakeFiles/project.dir/walk.c.o.d"
+  "project"
+  "project.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/project.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/project_dyn.dir/main.c.o"
+  "CMakeFiles/project_dyn.dir/main.c.o.d"
+  "CMakeFiles/project_dyn.dir/project_dyn.c.o"
+  "CMakeFiles/project_dyn.dir/project_dyn.c.o.d"
+  "CMakeFiles/project_dyn.dir/tree_dist.c.o"
+  "CMakeFiles/project_dyn.dir/tree_dist.c.o.d"
+  "CMakeFiles/project_dyn.dir/walk.c.o"
+  "CMakeFiles/project_dyn.dir/walk.c.o.d"
+  "project_dyn"
+  "project_dyn.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/project_dyn.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
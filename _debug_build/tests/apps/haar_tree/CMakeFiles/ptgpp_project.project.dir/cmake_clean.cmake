@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ptgpp_project.project"
+  "project.c"
+  "project.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ptgpp_project.project.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ptgpp_project_dyn.project_dyn"
+  "project_dyn.c"
+  "project_dyn.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ptgpp_project_dyn.project_dyn.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ptgpp_project_dyn.walk"
+  "walk.c"
+  "walk.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ptgpp_project_dyn.walk.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
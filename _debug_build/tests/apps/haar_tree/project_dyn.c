@@ -0,0 +1,1268 @@
+#include "parsec.h"
+#include "parsec/parsec_internal.h"
+#include "parsec/ayudame.h"
+#include "parsec/execution_stream.h"
+#include "parsec/parsec_binary_profile.h"
+#include "parsec/mca/device/device_gpu.h"
+#if defined(PARSEC_HAVE_DEV_CUDA_SUPPORT)
+#include "parsec/mca/device/cuda/device_cuda.h"
+#endif  /* defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) */
+#if defined(PARSEC_HAVE_DEV_HIP_SUPPORT)
+#include "parsec/mca/device/hip/device_hip.h"
+#endif  /* defined(PARSEC_HAVE_DEV_HIP_SUPPORT) */
+#if defined(_MSC_VER) || defined(__MINGW32__)
+#  include <malloc.h>
+#else
+#  include <alloca.h>
+#endif  /* defined(_MSC_VER) || defined(__MINGW32__) */
+
+#define PARSEC_project_dyn_NB_TASK_CLASSES 1
+#define PARSEC_project_dyn_NB_DATA 1
+
+typedef struct __parsec_project_dyn_internal_taskpool_s __parsec_project_dyn_internal_taskpool_t;
+struct parsec_project_dyn_internal_taskpool_s;
+
+/** Predeclarations of the parsec_task_class_t */
+static const parsec_task_class_t project_dyn_PROJECT;
+/** Predeclarations of the parameters */
+static const parsec_flow_t flow_of_project_dyn_PROJECT_for_NODE;
+static const parsec_flow_t flow_of_project_dyn_PROJECT_for_RL;
+/*
+ * Copyright (c)      2022 The University of Tennessee and The University
+ *                         of Tennessee Research Foundation.  All rights
+ *                         reserved.
+ */
+
+#include "tree_dist.h"
+#include <math.h>
+#include "parsec/sys/atomic.h"
+
+#define L 10.0
+
+static double key_to_x(int n, int l)
+{
+  double scale = (2.0*L)*pow(2.0, -n);
+  return -L + scale * (0.5 + l);
+}
+
+static double func(double alpha, double x) {
+  return exp(-(x/alpha)*(x/alpha));
+}
+
+struct __parsec_project_dyn_PROJECT_task_s;
+
+static parsec_key_t project_dyn_make_key(const parsec_taskpool_t* __tp, const parsec_assignment_t *_as);
+
+static int my_project_dyn_startup(parsec_execution_stream_t * es,
+                              struct __parsec_project_dyn_PROJECT_task_s * this_task);
+#define PARSEC_project_dyn_DEFAULT_ADT    (&__parsec_tp->super.arenas_datatypes[PARSEC_project_dyn_DEFAULT_ADT_IDX])
+#include "project_dyn.h"
+
+struct __parsec_project_dyn_internal_taskpool_s {
+ parsec_project_dyn_taskpool_t super;
+ volatile int32_t sync_point;
+ volatile int32_t initial_number_tasks;
+ parsec_task_t* startup_queue;
+  /* The ranges to compute the hash key */
+  /* nothing for PROJECT as it gets a user-defined make_key */
+  /* The list of data repositories  PROJECT */
+  data_repo_t* repositories[1];
+};
+
+#if defined(PARSEC_PROF_TRACE)
+#  if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+static int project_dyn_profiling_array[4*PARSEC_project_dyn_NB_TASK_CLASSES] = {-2}; /* 2 pairs (begin, end) per task, times two because each task class has an internal_init task */
+#  else /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+static int project_dyn_profiling_array[2*PARSEC_project_dyn_NB_TASK_CLASSES] = {-2}; /* 2 pairs (begin, end) per task */
+#  endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+#endif  /* defined(PARSEC_PROF_TRACE) */
+/* Globals */
+#define treeA __parsec_tp->super._g_treeA
+#define NP (__parsec_tp->super._g_NP)
+#define fakeDesc (__parsec_tp->super._g_fakeDesc)
+#define thresh (__parsec_tp->super._g_thresh)
+#define verbose (__parsec_tp->super._g_verbose)
+#define alpha (__parsec_tp->super._g_alpha)
+
+static inline int parsec_imin(int a, int b) { return (a <= b) ? a : b; };
+
+static inline int parsec_imax(int a, int b) { return (a >= b) ? a : b; };
+
+/* Data Access Macros */
+#define data_of_treeA(treeA_d0, treeA_d1)  (((parsec_data_collection_t*)__parsec_tp->super._g_treeA)->data_of((parsec_data_collection_t*)__parsec_tp->super._g_treeA, (treeA_d0), (treeA_d1)))
+
+#define rank_of_treeA(treeA_d0, treeA_d1)  (((parsec_data_collection_t*)__parsec_tp->super._g_treeA)->rank_of((parsec_data_collection_t*)__parsec_tp->super._g_treeA, (treeA_d0), (treeA_d1)))
+
+/* Functions Predicates */
+#define PROJECT_pred(n, l, larger_than_thresh) (((parsec_data_collection_t*)(__parsec_tp->super._g_treeA))->myrank == rank_of_treeA(n, l))
+
+/* Data Repositories */
+#define PROJECT_repo (__parsec_tp->repositories[0])
+/* Release dependencies output macro */
+#if defined(PARSEC_DEBUG_NOISIER)
+#define RELEASE_DEP_OUTPUT(ES, DEPO, TASKO, DEPI, TASKI, RSRC, RDST, DATA)\
+  do { \
+    char tmp1[128], tmp2[128]; (void)tmp1; (void)tmp2;\
+    PARSEC_DEBUG_VERBOSE(20, parsec_debug_output, "thread %d VP %d explore deps from %s:%s to %s:%s (from rank %d to %d) base ptr %p",\
+           (NULL != (ES) ? (ES)->th_id : -1), (NULL != (ES) ? (ES)->virtual_process->vp_id : -1),\
+           DEPO, parsec_task_snprintf(tmp1, 128, (parsec_task_t*)(TASKO)),\
+           DEPI, parsec_task_snprintf(tmp2, 128, (parsec_task_t*)(TASKI)), (RSRC), (RDST), (DATA));\
+  } while(0)
+#define ACQUIRE_FLOW(TASKI, DEPI, FUNO, DEPO, LOCALS, PTR)\
+  do { \
+    char tmp1[128], tmp2[128]; (void)tmp1; (void)tmp2;\
+    PARSEC_DEBUG_VERBOSE(20, parsec_debug_output, "task %s acquires flow %s from %s %s data ptr %p",\
+           parsec_task_snprintf(tmp1, 128, (parsec_task_t*)(TASKI)), (DEPI),\
+           (DEPO), parsec_snprintf_assignments(tmp2, 128, (FUNO), (parsec_assignment_t*)(LOCALS)), (PTR));\
+  } while(0)
+#else
+#define RELEASE_DEP_OUTPUT(ES, DEPO, TASKO, DEPI, TASKI, RSRC, RDST, DATA)
+#define ACQUIRE_FLOW(TASKI, DEPI, TASKO, DEPO, LOCALS, PTR)
+#endif
+static char *__jdf2c_key_fns_PROJECT_key_print(char *buffer, size_t buffer_size, parsec_key_t k, void *user_data)
+{
+  (void)user_data;
+  snprintf(buffer, buffer_size, "(%llu)", (unsigned long long int)k);
+  return buffer;
+}
+
+static parsec_key_fn_t __jdf2c_key_fns_PROJECT = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = __jdf2c_key_fns_PROJECT_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/******                                    PROJECT                                    ******/
+
+static inline int32_t minexpr_of_symb_project_dyn_PROJECT_n_fct(const __parsec_project_dyn_internal_taskpool_t *__parsec_tp, const __parsec_project_dyn_PROJECT_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_project_dyn_PROJECT_n = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_project_dyn_PROJECT_n_fct }
+                   }
+};
+static inline int32_t maxexpr_of_symb_project_dyn_PROJECT_n_fct(const __parsec_project_dyn_internal_taskpool_t *__parsec_tp, const __parsec_project_dyn_PROJECT_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 31;
+}
+static const parsec_expr_t maxexpr_of_symb_project_dyn_PROJECT_n = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_project_dyn_PROJECT_n_fct }
+                   }
+};
+static const parsec_symbol_t symb_project_dyn_PROJECT_n = { .name = "n", .context_index = 0, .min = &minexpr_of_symb_project_dyn_PROJECT_n, .max = &maxexpr_of_symb_project_dyn_PROJECT_n, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int32_t minexpr_of_symb_project_dyn_PROJECT_l_fct(const __parsec_project_dyn_internal_taskpool_t *__parsec_tp, const __parsec_project_dyn_PROJECT_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_project_dyn_PROJECT_l = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_project_dyn_PROJECT_l_fct }
+                   }
+};
+static inline int maxexpr_of_symb_project_dyn_PROJECT_l_fct(const __parsec_project_dyn_internal_taskpool_t *__parsec_tp, const __parsec_project_dyn_PROJECT_parsec_assignment_t *locals)
+{
+  const int n = locals->n.value;
+  const int l = locals->l.value; (void)l;
+  const int larger_than_thresh = locals->larger_than_thresh.value; (void)larger_than_thresh;
+
+  (void)n;
+  (void)l;
+  (void)larger_than_thresh;
+  (void)__parsec_tp; (void)locals;
+  return (1 << n);
+}
+static const parsec_expr_t maxexpr_of_symb_project_dyn_PROJECT_l = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_project_dyn_PROJECT_l_fct }
+                   }
+};
+static const parsec_symbol_t symb_project_dyn_PROJECT_l = { .name = "l", .context_index = 1, .min = &minexpr_of_symb_project_dyn_PROJECT_l, .max = &maxexpr_of_symb_project_dyn_PROJECT_l, .cst_inc = 1, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_project_dyn_PROJECT_larger_than_thresh_fct(const __parsec_project_dyn_internal_taskpool_t *__parsec_tp, const __parsec_project_dyn_PROJECT_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 1;
+}
+static const parsec_expr_t expr_of_symb_project_dyn_PROJECT_larger_than_thresh = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_project_dyn_PROJECT_larger_than_thresh_fct }
+                   }
+};
+static const parsec_symbol_t symb_project_dyn_PROJECT_larger_than_thresh = { .name = "larger_than_thresh", .context_index = 2, .min = &expr_of_symb_project_dyn_PROJECT_larger_than_thresh, .max = &expr_of_symb_project_dyn_PROJECT_larger_than_thresh, .cst_inc = 0, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int affinity_of_project_dyn_PROJECT(const __parsec_project_dyn_PROJECT_task_t *this_task,
+                     parsec_data_ref_t *ref)
+{
+    const __parsec_project_dyn_internal_taskpool_t *__parsec_tp = (const __parsec_project_dyn_internal_taskpool_t*)this_task->taskpool;
+  const int n = this_task->locals.n.value; (void)n;
+  const int l = this_task->locals.l.value; (void)l;
+  const int larger_than_thresh = this_task->locals.larger_than_thresh.value; (void)larger_than_thresh;
+
+  /* Silent Warnings: should look into predicate to know what variables are usefull */
+  (void)n;
+  (void)l;
+  (void)larger_than_thresh;
+  ref->dc = (parsec_data_collection_t *)__parsec_tp->super._g_treeA;
+  /* Compute data key */
+  ref->key = ref->dc->data_key(ref->dc, n, l);
+  return 1;
+}
+static const parsec_property_t properties_of_project_dyn_PROJECT[1] = {
+  {.name = NULL, .expr = NULL}
+};
+static parsec_data_t *flow_of_project_dyn_PROJECT_for_NODE_dep2_atline_55_direct_access(const __parsec_project_dyn_internal_taskpool_t *__parsec_tp, const __parsec_project_dyn_PROJECT_parsec_assignment_t *assignments)
+{
+  const int n = assignments->n.value; (void)n;
+  const int l = assignments->l.value; (void)l;
+  const int larger_than_thresh = assignments->larger_than_thresh.value; (void)larger_than_thresh;
+
+  /* Silence Warnings: should look into parameters to know what variables are useful */
+  (void)n;
+  (void)l;
+  (void)larger_than_thresh;
+  if( __parsec_tp->super.super.context->my_rank == (int32_t)rank_of_treeA(n, l) )
+    return data_of_treeA(n, l);
+  return NULL;
+}
+
+static const parsec_dep_t flow_of_project_dyn_PROJECT_for_NODE_dep2_atline_55 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = PARSEC_LOCAL_DATA_TASK_CLASS_ID, /* project_dyn_treeA */
+  .direct_data = (parsec_data_lookup_func_t)&flow_of_project_dyn_PROJECT_for_NODE_dep2_atline_55_direct_access,
+  .flags = PARSEC_DEP_FINAL_WRITE_AS_IS,
+  .dep_index = 1,
+  .dep_datatype_index = 1,
+  .belongs_to = &flow_of_project_dyn_PROJECT_for_NODE,
+};
+#if MAX_DEP_OUT_COUNT < 1  /* number of output dependencies */
+    #error Too many output dependencies (supports up to MAX_DEP_OUT_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_OUT_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_project_dyn_PROJECT_for_NODE = {
+  .name               = "NODE",
+  .sym_type           = PARSEC_SYM_OUT,
+  .flow_flags         = PARSEC_FLOW_ACCESS_WRITE|PARSEC_FLOW_HAS_IN_DEPS,
+  .flow_index         = 0,
+  .flow_datatype_mask = 0x2,
+  .dep_in     = { NULL },
+  .dep_out    = { &flow_of_project_dyn_PROJECT_for_NODE_dep2_atline_55 }
+};
+
+static inline int expr_of_cond_for_flow_of_project_dyn_PROJECT_for_RL_dep1_atline_51_fct(const __parsec_project_dyn_internal_taskpool_t *__parsec_tp, const __parsec_project_dyn_PROJECT_parsec_assignment_t *locals)
+{
+  const int n = locals->n.value;
+  const int l = locals->l.value; (void)l;
+  const int larger_than_thresh = locals->larger_than_thresh.value; (void)larger_than_thresh;
+
+  (void)n;
+  (void)l;
+  (void)larger_than_thresh;
+  (void)__parsec_tp; (void)locals;
+  return (n) != (0);
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_project_dyn_PROJECT_for_RL_dep1_atline_51 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_project_dyn_PROJECT_for_RL_dep1_atline_51_fct }
+                   }
+};
+static const parsec_dep_t flow_of_project_dyn_PROJECT_for_RL_dep1_atline_51 = {
+  .cond = &expr_of_cond_for_flow_of_project_dyn_PROJECT_for_RL_dep1_atline_51,  /* (n) != (0) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 0, /* project_dyn_PROJECT */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_project_dyn_PROJECT_for_RL,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_project_dyn_PROJECT_for_RL,
+};
+static inline int expr_of_cond_for_flow_of_project_dyn_PROJECT_for_RL_dep2_atline_52_fct(const __parsec_project_dyn_internal_taskpool_t *__parsec_tp, const __parsec_project_dyn_PROJECT_parsec_assignment_t *locals)
+{
+  const int n = locals->n.value; (void)n;
+  const int l = locals->l.value; (void)l;
+  const int larger_than_thresh = locals->larger_than_thresh.value;
+
+  (void)n;
+  (void)l;
+  (void)larger_than_thresh;
+  (void)__parsec_tp; (void)locals;
+  return larger_than_thresh;
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_project_dyn_PROJECT_for_RL_dep2_atline_52 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_project_dyn_PROJECT_for_RL_dep2_atline_52_fct }
+                   }
+};
+static const parsec_dep_t flow_of_project_dyn_PROJECT_for_RL_dep2_atline_52 = {
+  .cond = &expr_of_cond_for_flow_of_project_dyn_PROJECT_for_RL_dep2_atline_52,  /* larger_than_thresh */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 0, /* project_dyn_PROJECT */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_project_dyn_PROJECT_for_RL,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_project_dyn_PROJECT_for_RL,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+#if MAX_DEP_OUT_COUNT < 1  /* number of output dependencies */
+    #error Too many output dependencies (supports up to MAX_DEP_OUT_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_OUT_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_project_dyn_PROJECT_for_RL = {
+  .name               = "RL",
+  .sym_type           = PARSEC_SYM_INOUT,
+  .flow_flags         = PARSEC_FLOW_ACCESS_NONE|PARSEC_FLOW_HAS_IN_DEPS,
+  .flow_index         = 1,
+  .flow_datatype_mask = 0x1,
+  .dep_in     = { &flow_of_project_dyn_PROJECT_for_RL_dep1_atline_51 },
+  .dep_out    = { &flow_of_project_dyn_PROJECT_for_RL_dep2_atline_52 }
+};
+
+static void
+iterate_successors_of_project_dyn_PROJECT(parsec_execution_stream_t *es, const __parsec_project_dyn_PROJECT_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_project_dyn_internal_taskpool_t *__parsec_tp = (const __parsec_project_dyn_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_project_dyn_PROJECT_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_project_dyn_PROJECT_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int n = __jdf2c__tmp_locals.n.value; (void)n;
+  const int l = __jdf2c__tmp_locals.l.value; (void)l;
+  const int larger_than_thresh = __jdf2c__tmp_locals.larger_than_thresh.value; (void)larger_than_thresh;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)n;  (void)l;  (void)larger_than_thresh;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_treeA(n, l);
+#endif
+  /* Flow of data NODE has only OUTPUT dependencies to Memory */
+  if( action_mask & 0x1 ) {  /* Flow of data RL [1] */
+    data.data   = this_task->data._f_RL.data_out;
+    data.data_future  = NULL;
+    if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  =   /* Control: always empty */ 0;
+    data.local.dst_count  =   /* Control: always empty */ 0;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = NULL;
+    data.remote.src_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.src_count  =   /* Control: always empty */ 0;
+    data.remote.dst_count  =   /* Control: always empty */ 0;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+       if( larger_than_thresh ) {
+      __parsec_project_dyn_PROJECT_task_t* ncc = (__parsec_project_dyn_PROJECT_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[project_dyn_PROJECT.task_class_id];
+        const int PROJECT_n = (n + 1);
+        if( (PROJECT_n >= (0)) && (PROJECT_n <= (31)) ) {
+          assert(&nc.locals[0].value == &ncc->locals.n.value);
+          ncc->locals.n.value = PROJECT_n;
+          int PROJECT_l;
+        for( PROJECT_l = (l * 2);PROJECT_l <= ((l * 2) + 1); PROJECT_l+=1) {
+            if( (PROJECT_l >= (0)) && (PROJECT_l <= ((1 << ncc->locals.n.value))) ) {
+              assert(&nc.locals[1].value == &ncc->locals.l.value);
+              ncc->locals.l.value = PROJECT_l;
+              const int PROJECT_larger_than_thresh = 1;
+              assert(&nc.locals[2].value == &ncc->locals.larger_than_thresh.value);
+              ncc->locals.larger_than_thresh.value = PROJECT_larger_than_thresh;
+#if defined(DISTRIBUTED)
+              rank_dst = rank_of_treeA(ncc->locals.n.value, ncc->locals.l.value);
+              if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+                vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_treeA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_treeA, ncc->locals.n.value, ncc->locals.l.value);
+              nc.priority = __parsec_tp->super.super.priority;
+              successor_repo = PROJECT_repo;
+              successor_repo_key = project_dyn_make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+            RELEASE_DEP_OUTPUT(es, "RL", this_task, "RL", &nc, rank_src, rank_dst, &data);
+            if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_project_dyn_PROJECT_for_RL_dep2_atline_52, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+              }
+            }
+          }
+    }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static void
+iterate_predecessors_of_project_dyn_PROJECT(parsec_execution_stream_t *es, const __parsec_project_dyn_PROJECT_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_project_dyn_internal_taskpool_t *__parsec_tp = (const __parsec_project_dyn_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_project_dyn_PROJECT_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_project_dyn_PROJECT_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int n = __jdf2c__tmp_locals.n.value; (void)n;
+  const int l = __jdf2c__tmp_locals.l.value; (void)l;
+  const int larger_than_thresh = __jdf2c__tmp_locals.larger_than_thresh.value; (void)larger_than_thresh;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)n;  (void)l;  (void)larger_than_thresh;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_treeA(n, l);
+#endif
+  /* Flow of data NODE has only IN dependencies */
+  if( action_mask & 0x1 ) {  /* Flow of data RL [1] */
+    data.data   = this_task->data._f_RL.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x1 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  =   /* Control: always empty */ 0;
+    data.local.dst_count  =   /* Control: always empty */ 0;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = NULL;
+    data.remote.src_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.src_count  =   /* Control: always empty */ 0;
+    data.remote.dst_count  =   /* Control: always empty */ 0;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( (n) != (0) ) {
+      __parsec_project_dyn_PROJECT_task_t* ncc = (__parsec_project_dyn_PROJECT_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[project_dyn_PROJECT.task_class_id];
+        const int PROJECT_n = (n - 1);
+        if( (PROJECT_n >= (0)) && (PROJECT_n <= (31)) ) {
+          assert(&nc.locals[0].value == &ncc->locals.n.value);
+          ncc->locals.n.value = PROJECT_n;
+          const int PROJECT_l = (l / 2);
+          if( (PROJECT_l >= (0)) && (PROJECT_l <= ((1 << ncc->locals.n.value))) ) {
+            assert(&nc.locals[1].value == &ncc->locals.l.value);
+            ncc->locals.l.value = PROJECT_l;
+            const int PROJECT_larger_than_thresh = 1;
+            assert(&nc.locals[2].value == &ncc->locals.larger_than_thresh.value);
+            ncc->locals.larger_than_thresh.value = PROJECT_larger_than_thresh;
+#if defined(DISTRIBUTED)
+            rank_dst = rank_of_treeA(ncc->locals.n.value, ncc->locals.l.value);
+            if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+              vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_treeA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_treeA, ncc->locals.n.value, ncc->locals.l.value);
+            nc.priority = __parsec_tp->super.super.priority;
+            successor_repo = PROJECT_repo;
+            successor_repo_key = project_dyn_make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+          RELEASE_DEP_OUTPUT(es, "RL", this_task, "RL", &nc, rank_src, rank_dst, &data);
+          if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_project_dyn_PROJECT_for_RL_dep1_atline_51, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+            }
+          }
+    }
+  }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static int release_deps_of_project_dyn_PROJECT(parsec_execution_stream_t *es, __parsec_project_dyn_PROJECT_task_t *this_task, uint32_t action_mask, parsec_remote_deps_t *deps)
+{
+  PARSEC_PINS(es, RELEASE_DEPS_BEGIN, (parsec_task_t *)this_task);  const __parsec_project_dyn_internal_taskpool_t *__parsec_tp = (const __parsec_project_dyn_internal_taskpool_t *)this_task->taskpool;
+  parsec_release_dep_fct_arg_t arg;
+  int __vp_id;
+  int consume_local_repo = 0;
+  arg.action_mask = action_mask;
+  arg.output_entry = NULL;
+  arg.output_repo = NULL;
+#if defined(DISTRIBUTED)
+  arg.remote_deps = deps;
+#endif  /* defined(DISTRIBUTED) */
+  assert(NULL != es);
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS )    arg.ready_lists = alloca(sizeof(parsec_task_t *) * es->virtual_process->parsec_context->nb_vp);
+  else
+    arg.ready_lists = NULL;
+  for( __vp_id = 0; __vp_id < es->virtual_process->parsec_context->nb_vp; arg.ready_lists[__vp_id++] = NULL );
+  (void)__parsec_tp; (void)deps;
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_NODE.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_NODE.source_repo, this_task->data._f_NODE.source_repo_entry->ht_item.key );
+    }
+  }
+  consume_local_repo = (this_task->repo_entry != NULL);
+  arg.output_repo = PROJECT_repo;
+  arg.output_entry = this_task->repo_entry;
+  arg.output_usage = 0;
+  if( action_mask & (PARSEC_ACTION_RELEASE_LOCAL_DEPS | PARSEC_ACTION_GET_REPO_ENTRY) ) {
+    arg.output_entry = data_repo_lookup_entry_and_create( es, arg.output_repo, project_dyn_make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    arg.output_entry->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(arg.output_entry->sim_exec_date == 0);
+    arg.output_entry->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  if(action_mask & ( PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE ) ){
+    /* Generate the reshape promise for the outputs that need it */
+    iterate_successors_of_project_dyn_PROJECT(es, this_task, action_mask, parsec_set_up_reshape_promise, &arg);
+   }
+  iterate_successors_of_project_dyn_PROJECT(es, this_task, action_mask, parsec_release_dep_fct, &arg);
+
+#if defined(DISTRIBUTED)
+  if( (action_mask & PARSEC_ACTION_SEND_REMOTE_DEPS) && (NULL != arg.remote_deps)) {
+    parsec_remote_dep_activate(es, (parsec_task_t *)this_task, arg.remote_deps, arg.remote_deps->outgoing_mask);
+  }
+#endif
+
+  if(action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS) {
+    data_repo_entry_addto_usage_limit(PROJECT_repo, arg.output_entry->ht_item.key, arg.output_usage);
+    __parsec_schedule_vp(es, arg.ready_lists, 0);
+  }
+      if (consume_local_repo) {
+         data_repo_entry_used_once( PROJECT_repo, this_task->repo_entry->ht_item.key );
+      }
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_NODE.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_NODE.data_in);
+    }
+  }
+  PARSEC_PINS(es, RELEASE_DEPS_END, (parsec_task_t *)this_task);  return 0;
+}
+
+static int data_lookup_of_project_dyn_PROJECT(parsec_execution_stream_t *es, __parsec_project_dyn_PROJECT_task_t *this_task)
+{
+  const __parsec_project_dyn_internal_taskpool_t *__parsec_tp = (__parsec_project_dyn_internal_taskpool_t *)this_task->taskpool;
+  parsec_assignment_t generic_locals[MAX_PARAM_COUNT];  /* generic task locals */
+  int target_device = 0; (void)target_device;
+  (void)__parsec_tp; (void)generic_locals; (void)es;
+  parsec_data_copy_t *chunk = NULL;
+  data_repo_t        *reshape_repo  = NULL, *consumed_repo  = NULL;
+  data_repo_entry_t  *reshape_entry = NULL, *consumed_entry = NULL;
+  parsec_key_t        reshape_entry_key = 0, consumed_entry_key = 0;
+  uint8_t             consumed_flow_index;
+  parsec_dep_data_description_t data;
+  int ret;
+  (void)reshape_repo; (void)reshape_entry; (void)reshape_entry_key;
+  (void)consumed_repo; (void)consumed_entry; (void)consumed_entry_key;
+  (void)consumed_flow_index;
+  (void)chunk; (void)data; (void)ret;
+  const int n = this_task->locals.n.value; (void)n;
+  const int l = this_task->locals.l.value; (void)l;
+  const int larger_than_thresh = this_task->locals.larger_than_thresh.value; (void)larger_than_thresh;
+  if( NULL == this_task->repo_entry ){
+    this_task->repo_entry = data_repo_lookup_entry_and_create(es, PROJECT_repo,                                       project_dyn_make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    data_repo_entry_addto_usage_limit(PROJECT_repo, this_task->repo_entry->ht_item.key, 1);    this_task->repo_entry ->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(this_task->repo_entry ->sim_exec_date == 0);
+    this_task->repo_entry ->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  /* The reshape repo is the current task repo. */  reshape_repo = PROJECT_repo;
+  reshape_entry_key = project_dyn_make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals) ;
+  reshape_entry = this_task->repo_entry;
+  /* Lookup the input data, and store them in the context if any */
+
+if(! this_task->data._f_NODE.fulfill ){ /* Flow NODE */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_NODE.data_out = NULL;  /* By default, if nothing matches */
+    /* Flow NODE [0] dependency [1] pure output data  */
+    if( NULL == (chunk = this_task->data._f_NODE.data_in) ) {
+       /* No data set up by predecessor */
+      chunk = parsec_arena_get_copy(PARSEC_project_dyn_DEFAULT_ADT->arena, 1, target_device, PARSEC_project_dyn_DEFAULT_ADT->opaque_dtt);
+      chunk->original->owner_device = target_device;
+      this_task->data._f_NODE.data_out = chunk;
+    }
+    this_task->data._f_NODE.data_in     = chunk;
+    this_task->data._f_NODE.source_repo       = consumed_repo;
+    this_task->data._f_NODE.source_repo_entry = consumed_entry;
+    if( this_task->data._f_NODE.source_repo_entry == this_task->repo_entry ){
+      /* in case we have consume from this task repo entry for the flow,
+       * it is cleaned up, avoiding having old stuff during release_deps_of
+       */
+      this_task->repo_entry->data[0] = NULL;
+    }
+    this_task->data._f_NODE.fulfill = 1;
+}
+
+  /* RL is a control flow */
+  this_task->data._f_RL.data_in         = NULL;
+  this_task->data._f_RL.data_out        = NULL;
+  this_task->data._f_RL.source_repo       = NULL;
+  this_task->data._f_RL.source_repo_entry = NULL;
+  /** Generate profiling information */
+#if defined(PARSEC_PROF_TRACE)
+  this_task->prof_info.desc = (parsec_data_collection_t*)__parsec_tp->super._g_treeA;
+  this_task->prof_info.priority = this_task->priority;
+  this_task->prof_info.data_id   = ((parsec_data_collection_t*)__parsec_tp->super._g_treeA)->data_key((parsec_data_collection_t*)__parsec_tp->super._g_treeA, n, l);
+  this_task->prof_info.task_class_id = this_task->task_class->task_class_id;
+  this_task->prof_info.task_return_code = -1;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int datatype_lookup_of_project_dyn_PROJECT(parsec_execution_stream_t *es, const parsec_task_t *this_generic_task, const parsec_task_t *parent_task,
+              uint32_t* flow_mask, parsec_dep_data_description_t* data)
+{
+  const __parsec_project_dyn_PROJECT_task_t *this_task = (__parsec_project_dyn_PROJECT_task_t*)this_generic_task;
+  const __parsec_project_dyn_internal_taskpool_t *__parsec_tp = (__parsec_project_dyn_internal_taskpool_t *)this_task->taskpool;
+  (void)__parsec_tp; (void)es; (void)this_task; (void)data; (void)parent_task;
+  const int n = this_task->locals.n.value; (void)n;
+  const int l = this_task->locals.l.value; (void)l;
+  const int larger_than_thresh = this_task->locals.larger_than_thresh.value; (void)larger_than_thresh;
+  data->local.arena = data->remote.arena = NULL;
+  data->local.src_datatype  = data->local.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->local.src_count     = data->local.dst_count = 0;
+  data->local.src_displ     = data->local.dst_displ = 0;
+  data->data_future  = NULL;
+  if( (*flow_mask) & 0x80000000U ) { /* these are the input dependencies remote datatypes  */
+if( (*flow_mask) & 0x1U ) {  /* Flow NODE */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_project_dyn_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_project_dyn_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_project_dyn_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+    goto no_mask_match;
+  }
+
+  /* these are the output dependencies remote datatypes */
+if( (*flow_mask) & 0x2U ) {  /* Flow NODE */
+    if( ((*flow_mask) & 0x2U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_project_dyn_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_project_dyn_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_project_dyn_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x2U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x2U) */
+ no_mask_match:
+  data->data                             = NULL;
+  data->remote.src_datatype = data->remote.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->remote.src_count    = data->remote.dst_count = 0;
+  data->remote.src_displ    = data->remote.dst_displ = 0;
+  data->data_future  = NULL;
+  (*flow_mask) = 0;  /* nothing left */
+  (void)n;  (void)l;  (void)larger_than_thresh;
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+static int hook_of_project_dyn_PROJECT(parsec_execution_stream_t *es, __parsec_project_dyn_PROJECT_task_t *this_task)
+{
+  __parsec_project_dyn_internal_taskpool_t *__parsec_tp = (__parsec_project_dyn_internal_taskpool_t *)this_task->taskpool;
+  (void)es; (void)__parsec_tp;
+  const int n = this_task->locals.n.value; (void)n;
+  const int l = this_task->locals.l.value; (void)l;
+  const int larger_than_thresh = this_task->locals.larger_than_thresh.value; (void)larger_than_thresh;
+  (void)n;  (void)l;  (void)larger_than_thresh;
+
+  /** Declare the variables that will hold the data, and all the accounting for each */
+  parsec_data_copy_t *_f_NODE = this_task->data._f_NODE.data_in;
+  void *NODE = PARSEC_DATA_COPY_GET_PTR(_f_NODE); (void)NODE;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    data_repo_entry_t *eNODE = this_task->data._f_NODE.source_repo_entry;
+    if( (NULL != eNODE) && (eNODE->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eNODE->sim_exec_date;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+    if ( NULL != _f_NODE ) {
+#if defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) || defined(PARSEC_HAVE_DEV_HIP_SUPPORT)
+      parsec_data_transfer_ownership_to_copy( _f_NODE->original, 0 /* device */,
+                                           PARSEC_FLOW_ACCESS_WRITE);
+#endif  /* defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) || defined(PARSEC_HAVE_DEV_HIP_SUPPORT) */
+      _f_NODE->version++;  /* NODE */
+#if defined(PARSEC_DEBUG_NOISIER)
+      char tmp[128];
+      PARSEC_DEBUG_VERBOSE(10, parsec_debug_output,
+                           "Body of %s: change Data copy %p to version %d",
+                           parsec_task_snprintf(tmp, 128, (parsec_task_t*)(this_task)),
+                           _f_NODE, _f_NODE->version);
+#endif /* defined(PARSEC_DEBUG_NOISIER) */
+    }
+  /** Cache Awareness Accounting */
+#if defined(PARSEC_CACHE_AWARENESS)
+  cache_buf_referenced(es->closest_cache, NODE);
+#endif /* PARSEC_CACHE_AWARENESS */
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                                  PROJECT BODY                                  -----*/
+
+{
+    double err;
+    double sl, sr;
+    double d;
+
+    sl = func(alpha, key_to_x(n+1, 2*l));
+    sr = func(alpha, key_to_x(n+1, 2*l+1));
+
+    d = 0.5 * (sl - sr);
+
+    err = fabs(d) * pow(2.0, -0.5 * n);
+
+    if ((n >= 8) && (err <= thresh)) {
+        this_task->locals.larger_than_thresh.value = 0;
+    } else {
+      node_t *node = (node_t*)NODE;
+
+      double sl, sr;
+
+      if( verbose > 0 ) {
+          int rank = (((parsec_data_collection_t*)treeA)->rank_of((parsec_data_collection_t*)treeA, n, l));
+          fprintf(stdout, "CREATE_NODE( %d , %d ) on rank %d\n", n, l, rank);
+      } 
+
+      sl = func(alpha, key_to_x(n+1, 2*l));
+      sr = func(alpha, key_to_x(n+1, 2*l+1));
+
+      node->s = 0.5 * (sl + sr);
+      node->d = 0.5 * (sl - sr);
+      // To tell parsec to keep the reference of these two data, so it shouldn't delete them
+      PARSEC_OBJ_RETAIN(_f_NODE);
+      tree_dist_insert_data(treeA, _f_NODE->original, n, l);
+    }   
+
+    if( verbose > 0 ) {
+        int rank = (((parsec_data_collection_t*)treeA)->rank_of((parsec_data_collection_t*)treeA, n, l));
+        fprintf(stderr, "PROJECT(%d, %d) on rank %d, err = %g, larger_than_thresh = %d\n", n, l, rank, err, this_task->locals.larger_than_thresh.value);
+    }
+
+}
+
+/*-----                              END OF PROJECT BODY                              -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#endif  /*  defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+static int complete_hook_of_project_dyn_PROJECT(parsec_execution_stream_t *es, __parsec_project_dyn_PROJECT_task_t *this_task)
+{
+  const __parsec_project_dyn_internal_taskpool_t *__parsec_tp = (__parsec_project_dyn_internal_taskpool_t *)this_task->taskpool;
+#if defined(DISTRIBUTED)
+    const int n = this_task->locals.n.value; (void)n;
+  const int l = this_task->locals.l.value; (void)l;
+  const int larger_than_thresh = this_task->locals.larger_than_thresh.value; (void)larger_than_thresh;
+#endif  /* defined(DISTRIBUTED) */
+  (void)es; (void)__parsec_tp;
+parsec_data_t* data_t_desc = NULL; (void)data_t_desc;
+#if defined(DISTRIBUTED)
+  /** If not working on distributed, there is no risk that data is not in place */
+  data_t_desc = data_of_treeA(n, l);
+  if( (NULL != this_task->data._f_NODE.data_out) && (this_task->data._f_NODE.data_out->original != data_t_desc) ) {
+    /* Writting back using remote_type */;
+    parsec_dep_data_description_t data;
+    data.data         = this_task->data._f_NODE.data_out;
+    data.local.arena        = NULL;
+    data.local.src_datatype = data.data->dtt;
+    data.local.src_count    = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_datatype = parsec_data_get_copy(data_t_desc, 0)->dtt;
+    data.local.dst_count    = 1;
+    data.local.dst_displ    = 0;
+    data.data_future  = NULL;
+    assert( data.local.src_count > 0 );
+    parsec_remote_dep_memcpy(es,
+                            this_task->taskpool,
+                            parsec_data_get_copy(data_of_treeA(n, l), 0),
+                            this_task->data._f_NODE.data_out, &data);
+  }
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+  parsec_prof_grapher_data_output((parsec_task_t*)this_task, data_of_treeA(n, l), &flow_of_project_dyn_PROJECT_for_NODE);
+#endif
+  (void)n;  (void)l;  (void)larger_than_thresh;
+
+#endif /* DISTRIBUTED */
+#if defined(PARSEC_PROF_GRAPHER)
+  parsec_prof_grapher_task((parsec_task_t*)this_task, es->th_id, es->virtual_process->vp_id,
+     __jdf2c_key_fns_PROJECT.key_hash(this_task->task_class->make_key( (parsec_taskpool_t*)this_task->taskpool, ((parsec_task_t*)this_task)->locals), NULL));
+#endif  /* defined(PARSEC_PROF_GRAPHER) */
+  release_deps_of_project_dyn_PROJECT(es, this_task,
+      PARSEC_ACTION_RELEASE_REMOTE_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_REFS |
+      PARSEC_ACTION_RESHAPE_ON_RELEASE |
+      0x3,  /* mask of all dep_index */ 
+      NULL);
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static parsec_hook_return_t release_task_of_project_dyn_PROJECT(parsec_execution_stream_t *es, parsec_task_t *this_task)
+{
+    const __parsec_project_dyn_internal_taskpool_t *__parsec_tp =
+        (const __parsec_project_dyn_internal_taskpool_t *)this_task->taskpool;
+    parsec_hash_table_t *ht = (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[0];
+    parsec_key_t key = this_task->task_class->make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals);
+    parsec_hashable_dependency_t *hash_dep = (parsec_hashable_dependency_t *)parsec_hash_table_remove(ht, key);
+    /* Must test for NULL, as user-provided startup tasks may not have a dep in the hash table */
+    if(NULL != hash_dep) parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);
+    return parsec_release_task_to_mempool_update_nbtasks(es, this_task);
+}
+
+static char *project_dyn_project_dyn_PROJECT_internal_init_deps_key_functions_key_print(char *buffer, size_t buffer_size, parsec_key_t k, void *user_data)
+{
+  (void)user_data;
+  snprintf(buffer, buffer_size, "(%llu)", (unsigned long long int)k);
+  return buffer;
+}
+
+static parsec_key_fn_t project_dyn_project_dyn_PROJECT_internal_init_deps_key_functions = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = project_dyn_project_dyn_PROJECT_internal_init_deps_key_functions_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/* Needs: - count-tasks iterate */
+static int project_dyn_PROJECT_internal_init(parsec_execution_stream_t * es, __parsec_project_dyn_PROJECT_task_t * this_task)
+{
+  __parsec_project_dyn_internal_taskpool_t *__parsec_tp = (__parsec_project_dyn_internal_taskpool_t*)this_task->taskpool;
+  int32_t nb_tasks = 0, saved_nb_tasks = 0;
+  __parsec_project_dyn_PROJECT_parsec_assignment_t assignments = {  .n.value = 0, .l.value = 0, .larger_than_thresh.value = 0 };
+  int32_t  n,  l,  larger_than_thresh;
+  int32_t __jdf2c_n_start, __jdf2c_n_end, __jdf2c_n_inc;
+  int32_t __jdf2c_l_start, __jdf2c_l_end, __jdf2c_l_inc;
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+  PARSEC_PROFILING_TRACE(es->es_profile,
+                         this_task->taskpool->profiling_array[START_KEY(this_task->task_class->task_class_id)],
+                         0,
+                         this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    __jdf2c_n_start = 0;
+    __jdf2c_n_end = 31;
+    __jdf2c_n_inc = 1;
+    for(n =  __jdf2c_n_start;
+        n <= __jdf2c_n_end;
+        n += __jdf2c_n_inc) {
+    assignments.n.value = n;
+      __jdf2c_l_start = 0;
+      __jdf2c_l_end = (1 << n);
+      __jdf2c_l_inc = 1;
+      for(l =  __jdf2c_l_start;
+          l <= __jdf2c_l_end;
+          l += __jdf2c_l_inc) {
+      assignments.l.value = l;
+    {  /* block for the non-range variable larger_than_thresh */
+        larger_than_thresh = 1;
+        assignments.larger_than_thresh.value = larger_than_thresh;
+        if( !PROJECT_pred(n, l, larger_than_thresh) ) continue;
+        nb_tasks++;
+      } /* block for the non-range variable larger_than_thresh */ 
+    } /* Loop on normal range l */
+  } /* For loop of n */ 
+   if( 0 != nb_tasks ) {
+     (void)parsec_atomic_fetch_add_int32(&__parsec_tp->initial_number_tasks, nb_tasks);
+   }
+    do {
+      this_task->super.list_next = (parsec_list_item_t*)__parsec_tp->startup_queue;
+    } while(!parsec_atomic_cas_ptr(&__parsec_tp->startup_queue, (parsec_list_item_t*)this_task->super.list_next, this_task));
+    this_task->status = PARSEC_TASK_STATUS_HOOK;
+
+  PARSEC_AYU_REGISTER_TASK(&project_dyn_PROJECT);
+  __parsec_tp->super.super.dependencies_array[0] = PARSEC_OBJ_NEW(parsec_hash_table_t);
+  parsec_hash_table_init(__parsec_tp->super.super.dependencies_array[0], offsetof(parsec_hashable_dependency_t, ht_item), 10, project_dyn_project_dyn_PROJECT_internal_init_deps_key_functions, this_task->taskpool);
+  __parsec_tp->repositories[0] = data_repo_create_nothreadsafe(nb_tasks, __jdf2c_key_fns_PROJECT, (parsec_taskpool_t*)__parsec_tp, 2);
+(void)saved_nb_tasks;
+  (void)__jdf2c_n_start; (void)__jdf2c_n_end; (void)__jdf2c_n_inc;  (void)__jdf2c_l_start; (void)__jdf2c_l_end; (void)__jdf2c_l_inc;  (void)assignments; (void)__parsec_tp; (void)es;
+  if(1 == parsec_atomic_fetch_dec_int32(&__parsec_tp->sync_point)) {
+    /* Last initialization task complete. Update the number of tasks. */
+    __parsec_tp->super.super.tdm.module->taskpool_addto_nb_tasks(&__parsec_tp->super.super, __parsec_tp->initial_number_tasks);
+    parsec_mfence();  /* write memory barrier to guarantee that the scheduler gets the correct number of tasks */
+    parsec_taskpool_enable((parsec_taskpool_t*)__parsec_tp, &__parsec_tp->startup_queue,
+                           (parsec_task_t*)this_task, es, __parsec_tp->super.super.nb_pending_actions);
+    __parsec_tp->super.super.tdm.module->taskpool_ready(&__parsec_tp->super.super);
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+    PARSEC_PROFILING_TRACE(es->es_profile,
+                           this_task->taskpool->profiling_array[2 * this_task->task_class->task_class_id + 1],
+                           0,
+                           this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    if( 1 >= __parsec_tp->super.super.nb_pending_actions ) {
+        /* if no tasks will be generated let's prevent the runtime from calling the hook and instead go directly to complete the task */
+        this_task->status = PARSEC_TASK_STATUS_COMPLETE;
+    }
+    return PARSEC_HOOK_RETURN_DONE;
+  }
+  return PARSEC_HOOK_RETURN_ASYNC;
+}
+
+static const __parsec_chore_t __project_dyn_PROJECT_chores[] ={
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+    { .type     = PARSEC_DEV_CPU,
+      .evaluate = (parsec_evaluate_function_t*)NULL,
+      .hook     = (parsec_hook_t*)hook_of_project_dyn_PROJECT },
+#endif  /* defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+    { .type     = PARSEC_DEV_NONE,
+      .evaluate = NULL,
+      .hook     = (parsec_hook_t*)NULL },  /* End marker */
+};
+
+static const parsec_task_class_t project_dyn_PROJECT = {
+  .name = "PROJECT",
+  .task_class_id = 0,
+  .nb_flows = 2,
+  .nb_parameters = 2,
+  .nb_locals = 3,
+  .task_class_type = PARSEC_TASK_CLASS_TYPE_PTG,
+  .params = { &symb_project_dyn_PROJECT_n, &symb_project_dyn_PROJECT_l, NULL },
+  .locals = { &symb_project_dyn_PROJECT_n, &symb_project_dyn_PROJECT_l, &symb_project_dyn_PROJECT_larger_than_thresh, NULL },
+  .data_affinity = (parsec_data_ref_fn_t*)affinity_of_project_dyn_PROJECT,
+  .initial_data = (parsec_data_ref_fn_t*)affinity_of_project_dyn_PROJECT,
+  .final_data = (parsec_data_ref_fn_t*)affinity_of_project_dyn_PROJECT,
+  .priority = NULL,
+  .properties = properties_of_project_dyn_PROJECT,
+#if MAX_PARAM_COUNT < 0  /* number of read flows of PROJECT */
+  #error Too many read flows for task PROJECT
+#endif  /* MAX_PARAM_COUNT */
+#if MAX_PARAM_COUNT < 1  /* number of write flows of PROJECT */
+  #error Too many write flows for task PROJECT
+#endif  /* MAX_PARAM_COUNT */
+  .in = { &flow_of_project_dyn_PROJECT_for_NODE, &flow_of_project_dyn_PROJECT_for_RL, NULL },
+  .out = { &flow_of_project_dyn_PROJECT_for_NODE, &flow_of_project_dyn_PROJECT_for_RL, NULL },
+  .flags = 0x0 | PARSEC_HAS_IN_IN_DEPENDENCIES | PARSEC_USE_DEPS_MASK,
+  .dependencies_goal = 0x3,
+  .make_key = project_dyn_make_key,
+  .task_snprintf = parsec_task_snprintf,
+#if defined(PARSEC_PROF_TRACE)
+  .profile_info = &parsec_task_profile_info,
+#endif
+  .key_functions = &__jdf2c_key_fns_PROJECT,
+  .fini = (parsec_hook_t*)NULL,
+  .incarnations = __project_dyn_PROJECT_chores,
+  .find_deps = parsec_hash_find_deps,
+  .update_deps = parsec_update_deps_with_mask,
+  .iterate_successors = (parsec_traverse_function_t*)iterate_successors_of_project_dyn_PROJECT,
+  .iterate_predecessors = (parsec_traverse_function_t*)iterate_predecessors_of_project_dyn_PROJECT,
+  .release_deps = (parsec_release_deps_t*)release_deps_of_project_dyn_PROJECT,
+  .prepare_output = (parsec_hook_t*)NULL,
+  .prepare_input = (parsec_hook_t*)data_lookup_of_project_dyn_PROJECT,
+  .time_estimate = NULL,
+  .get_datatype = datatype_lookup_of_project_dyn_PROJECT,
+  .complete_execution = (parsec_hook_t*)complete_hook_of_project_dyn_PROJECT,
+  .release_task = &release_task_of_project_dyn_PROJECT,
+#if defined(PARSEC_SIM)
+  .sim_cost_fct = (parsec_sim_cost_fct_t*)NULL,
+#endif
+};
+
+
+static const parsec_task_class_t *project_dyn_task_classes[] = {
+  &project_dyn_PROJECT
+};
+
+static void project_dyn_startup(parsec_context_t *context, __parsec_project_dyn_internal_taskpool_t *__parsec_tp, parsec_list_item_t ** ready_tasks)
+{
+  uint32_t i, supported_dev = 0;
+ 
+  for( i = 0; i < parsec_nb_devices; i++ ) {
+    if( !(__parsec_tp->super.super.devices_index_mask & (1<<i)) ) continue;
+    parsec_device_module_t* device = parsec_mca_device_get(i);
+    parsec_data_collection_t* parsec_dc;
+ 
+    if(NULL == device) continue;
+    if(NULL != device->taskpool_register)
+      if( PARSEC_SUCCESS != device->taskpool_register(device, (parsec_taskpool_t*)__parsec_tp) ) {
+        parsec_debug_verbose(5, parsec_debug_output, "Device %s refused to register taskpool %p", device->name, __parsec_tp);
+        __parsec_tp->super.super.devices_index_mask &= ~(1 << device->device_index);
+        continue;
+      }
+    if(NULL != device->memory_register) {  /* Register all the data */
+      parsec_dc = (parsec_data_collection_t*)__parsec_tp->super._g_treeA;
+      if( (NULL != parsec_dc->register_memory) &&
+          (PARSEC_SUCCESS != parsec_dc->register_memory(parsec_dc, device)) ) {
+        parsec_debug_verbose(3, parsec_debug_output, "Device %s refused to register memory for data %s (%p) from taskpool %p",
+                     device->name, parsec_dc->key_base, parsec_dc, __parsec_tp);
+        __parsec_tp->super.super.devices_index_mask &= ~(1 << device->device_index);
+      }
+    }
+    supported_dev |= device->type;
+  }
+  /* Remove all the chores without a backend device */
+  for( i = 0; i < PARSEC_project_dyn_NB_TASK_CLASSES; i++ ) {
+    parsec_task_class_t* tc = (parsec_task_class_t*)__parsec_tp->super.super.task_classes_array[i];
+    __parsec_chore_t* chores = (__parsec_chore_t*)tc->incarnations;
+    uint32_t idx = 0, j;
+    for( j = 0; PARSEC_DEV_NONE != chores[j].type; j++ ) {
+      if( !(supported_dev & chores[j].type) ) continue;
+      if( j != idx ) {
+        chores[idx] = chores[j];
+        parsec_debug_verbose(20, parsec_debug_output, "Device type %i disabled for function %s"
+, chores[j].type, tc->name);
+      }
+      idx++;
+    }
+    chores[idx].type     = PARSEC_DEV_NONE;
+    chores[idx].evaluate = NULL;
+    chores[idx].hook     = NULL;
+    /* Create the initialization tasks for each taskclass */
+    parsec_task_t* task = (parsec_task_t*)parsec_thread_mempool_allocate(context->virtual_processes[0]->execution_streams[0]->context_mempool);
+    PARSEC_OBJ_CONSTRUCT(task, parsec_task_t); /* construct called only when new, force-construct it again */
+    task->taskpool = (parsec_taskpool_t *)__parsec_tp;
+    task->chore_mask = PARSEC_DEV_CPU;
+    memset(&task->locals, 0, sizeof(parsec_assignment_t) * MAX_LOCAL_COUNT);
+    PARSEC_LIST_ITEM_SINGLETON(task);
+    task->priority = -1;
+    task->task_class = task->taskpool->task_classes_array[PARSEC_project_dyn_NB_TASK_CLASSES + i];
+    int where = i % context->nb_vp;
+    if( NULL == ready_tasks[where] ) ready_tasks[where] = &task->super;
+    else ready_tasks[where] = parsec_list_item_ring_push(ready_tasks[where], &task->super);
+  }
+}
+static void __parsec_project_dyn_internal_destructor( __parsec_project_dyn_internal_taskpool_t *__parsec_tp )
+{
+  uint32_t i;
+  parsec_taskpool_unregister( &__parsec_tp->super.super );
+  if(NULL != __parsec_tp->super.super.tdm.module) __parsec_tp->super.super.tdm.module->unmonitor_taskpool(&__parsec_tp->super.super);
+  for( i = 0; i < (uint32_t)(2 * __parsec_tp->super.super.nb_task_classes); i++ ) {  /* Extra startup function added at the end */
+    parsec_task_class_t* tc = (parsec_task_class_t*)__parsec_tp->super.super.task_classes_array[i];
+    free((void*)tc->incarnations);
+    free(tc);
+  }
+  free(__parsec_tp->super.super.task_classes_array); __parsec_tp->super.super.task_classes_array = NULL;
+  __parsec_tp->super.super.nb_task_classes = 0;
+
+  for(i = 0; i < (uint32_t)__parsec_tp->super.arenas_datatypes_size; i++) {
+    if( NULL != __parsec_tp->super.arenas_datatypes[i].arena ) {
+      PARSEC_OBJ_RELEASE(__parsec_tp->super.arenas_datatypes[i].arena);
+    }
+  }
+  /* Destroy the data repositories for this object */
+   data_repo_destroy_nothreadsafe(__parsec_tp->repositories[0]);  /* PROJECT */
+  /* Release the dependencies arrays for this object */
+  parsec_hash_table_fini( (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[0] );
+  PARSEC_OBJ_RELEASE(__parsec_tp->super.super.dependencies_array[0]);
+  __parsec_tp->super.super.dependencies_array[0] = NULL;
+  free( __parsec_tp->super.super.dependencies_array );
+  __parsec_tp->super.super.dependencies_array = NULL;
+  /* Unregister all the data */
+  uint32_t _i;
+  for( _i = 0; _i < parsec_nb_devices; _i++ ) {
+    parsec_device_module_t* device;
+    parsec_data_collection_t* parsec_dc;
+    if(!(__parsec_tp->super.super.devices_index_mask & (1 << _i))) continue;
+    if((NULL == (device = parsec_mca_device_get(_i))) || (NULL == device->memory_unregister)) continue;
+    parsec_dc = (parsec_data_collection_t*)__parsec_tp->super._g_treeA;
+  if( NULL != parsec_dc->unregister_memory ) { (void)parsec_dc->unregister_memory(parsec_dc, device); };
+}
+  /* Unregister the taskpool from the devices */
+  for( i = 0; i < parsec_nb_devices; i++ ) {
+    if(!(__parsec_tp->super.super.devices_index_mask & (1 << i))) continue;
+    __parsec_tp->super.super.devices_index_mask ^= (1 << i);
+    parsec_device_module_t* device = parsec_mca_device_get(i);
+    if((NULL == device) || (NULL == device->taskpool_unregister)) continue;
+    if( PARSEC_SUCCESS != device->taskpool_unregister(device, &__parsec_tp->super.super) ) continue;
+  }
+  free(__parsec_tp->super.super.taskpool_name); __parsec_tp->super.super.taskpool_name = NULL;
+}
+
+void __parsec_project_dyn_internal_constructor(__parsec_project_dyn_internal_taskpool_t* __parsec_tp)
+{
+  parsec_task_class_t* tc;
+  uint32_t i, j;
+
+  __parsec_tp->super.super.nb_task_classes = PARSEC_project_dyn_NB_TASK_CLASSES;
+  __parsec_tp->super.super.devices_index_mask = PARSEC_DEVICES_ALL;
+  __parsec_tp->super.super.taskpool_name = strdup("project_dyn");
+  parsec_termdet_open_module(&__parsec_tp->super.super, "local");
+  __parsec_tp->super.super.tdm.module->monitor_taskpool(&__parsec_tp->super.super,
+                                                        parsec_taskpool_termination_detected);
+  __parsec_tp->super.super.update_nb_runtime_task = parsec_add_fetch_runtime_task;
+  __parsec_tp->super.super.dependencies_array = (void **)
+              calloc(__parsec_tp->super.super.nb_task_classes, sizeof(void*));
+  /* Twice the size to hold the startup tasks function_t */
+  __parsec_tp->super.super.task_classes_array = (const parsec_task_class_t**)
+              calloc((2 * PARSEC_project_dyn_NB_TASK_CLASSES + 1), sizeof(parsec_task_class_t*));
+  __parsec_tp->super.super.tdm.module->taskpool_addto_runtime_actions(&__parsec_tp->super.super, PARSEC_project_dyn_NB_TASK_CLASSES);  /* for the startup tasks */
+  __parsec_tp->super.super.taskpool_type = PARSEC_TASKPOOL_TYPE_PTG;
+  __parsec_tp->sync_point = __parsec_tp->super.super.nb_task_classes;
+  __parsec_tp->initial_number_tasks = 0;
+  __parsec_tp->startup_queue = NULL;
+  for( i = 0; i < __parsec_tp->super.super.nb_task_classes; i++ ) {
+    __parsec_tp->super.super.task_classes_array[i] = tc = malloc(sizeof(parsec_task_class_t));
+    memcpy(tc, project_dyn_task_classes[i], sizeof(parsec_task_class_t));
+    for( j = 0; PARSEC_DEV_NONE != tc->incarnations[j].type; j++);  /* compute the number of incarnations */
+    tc->incarnations = (__parsec_chore_t*)malloc((j+1) * sizeof(__parsec_chore_t));
+        memcpy((__parsec_chore_t*)tc->incarnations, project_dyn_task_classes[i]->incarnations, (j+1) * sizeof(__parsec_chore_t));
+
+    /* Add a placeholder for initialization and startup task */
+    __parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+i] = tc = (parsec_task_class_t*)malloc(sizeof(parsec_task_class_t));
+    memcpy(tc, (void*)&__parsec_generic_startup, sizeof(parsec_task_class_t));
+    tc->task_class_id = __parsec_tp->super.super.nb_task_classes + i;
+    tc->incarnations = (__parsec_chore_t*)malloc(2 * sizeof(__parsec_chore_t));
+    memcpy((__parsec_chore_t*)tc->incarnations, (void*)__parsec_generic_startup.incarnations, 2 * sizeof(__parsec_chore_t));
+    tc->release_task = parsec_release_task_to_mempool_and_count_as_runtime_tasks;
+  }
+  /* Startup task for PROJECT */
+  tc = (parsec_task_class_t *)__parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+0];
+  tc->name = "Startup for PROJECT";
+  tc->prepare_input = (parsec_hook_t*)project_dyn_PROJECT_internal_init;
+  ((__parsec_chore_t*)&tc->incarnations[0])->hook = (parsec_hook_t *)my_project_dyn_startup;
+  /* Compute the number of arenas_datatypes: */
+  /*   PARSEC_project_dyn_DEFAULT_ARENA  ->  0 */
+  __parsec_tp->super.arenas_datatypes_size = 1;
+  memset(&__parsec_tp->super.arenas_datatypes[0], 0, __parsec_tp->super.arenas_datatypes_size*sizeof(parsec_arena_datatype_t));
+  /* If profiling is enabled, the keys for profiling */
+#  if defined(PARSEC_PROF_TRACE)
+  __parsec_tp->super.super.profiling_array = project_dyn_profiling_array;
+  if( -2 == project_dyn_profiling_array[0] ) {
+    #if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+parsec_profiling_add_dictionary_keyword("project_dyn::PROJECT::internal init", "fill:34D8D8",
+                                       0,
+                                       NULL,
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(project_dyn_PROJECT.task_class_id  + PARSEC_project_dyn_NB_TASK_CLASSES)/* PROJECT (internal init) start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(project_dyn_PROJECT.task_class_id  + PARSEC_project_dyn_NB_TASK_CLASSES)/* PROJECT (internal init) end key */]);
+#endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+parsec_profiling_add_dictionary_keyword("project_dyn::PROJECT", "fill:CC2828",
+                                       sizeof(parsec_task_prof_info_t)+3*sizeof(parsec_assignment_t),
+                                       "dc_key{uint64_t};priority{int32_t};dc_dataid{uint32_t};tcid{uint32_t};trc{int32_t};n{int32_t};l{int32_t};larger_than_thresh{int32_t}",
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(project_dyn_PROJECT.task_class_id) /* PROJECT start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(project_dyn_PROJECT.task_class_id) /* PROJECT end key */]);
+
+  }
+#  endif /* defined(PARSEC_PROF_TRACE) */
+  __parsec_tp->super.super.repo_array = __parsec_tp->repositories;
+  __parsec_tp->super.super.startup_hook = (parsec_startup_fn_t)project_dyn_startup;
+  (void)parsec_taskpool_reserve_id((parsec_taskpool_t*)__parsec_tp);
+}
+
+  /** Generate class declaration and instance using the above constructor and destructor */
+  PARSEC_OBJ_CLASS_DECLARATION(__parsec_project_dyn_internal_taskpool_t);
+  PARSEC_OBJ_CLASS_INSTANCE(__parsec_project_dyn_internal_taskpool_t, parsec_project_dyn_taskpool_t,
+                            __parsec_project_dyn_internal_constructor, __parsec_project_dyn_internal_destructor);
+
+#undef treeA
+#undef NP
+#undef fakeDesc
+#undef thresh
+#undef verbose
+#undef alpha
+
+parsec_project_dyn_taskpool_t *parsec_project_dyn_new(tree_dist_t * treeA /* data treeA */, int NP, parsec_data_collection_t * fakeDesc, double thresh, int verbose, double alpha)
+{
+  __parsec_project_dyn_internal_taskpool_t *__parsec_tp = PARSEC_OBJ_NEW(__parsec_project_dyn_internal_taskpool_t);
+  /* Dump the hidden parameters with default values */
+
+  /* Now the Parameter-dependent structures: */
+  __parsec_tp->super._g_treeA = treeA;
+  __parsec_tp->super._g_NP = NP;
+  __parsec_tp->super._g_fakeDesc = fakeDesc;
+  __parsec_tp->super._g_thresh = thresh;
+  __parsec_tp->super._g_verbose = verbose;
+  __parsec_tp->super._g_alpha = alpha;
+  PARSEC_AYU_REGISTER_TASK(&project_dyn_PROJECT);
+  __parsec_tp->super.super.startup_hook = (parsec_startup_fn_t)project_dyn_startup;
+  (void)parsec_taskpool_reserve_id((parsec_taskpool_t*)__parsec_tp);
+/* Prevent warnings related to not used hidden global variables */
+;
+  return (parsec_project_dyn_taskpool_t*)__parsec_tp;
+}
+
+
+static parsec_key_t project_dyn_make_key(const parsec_taskpool_t* __tp, const parsec_assignment_t *_as)
+{
+    (void)__tp;
+    const struct __parsec_project_dyn_PROJECT_assignment_s * assignments = (const struct __parsec_project_dyn_PROJECT_assignment_s *)_as;
+    return (parsec_key_t)(((uint64_t)assignments->n.value) << 32) | ((uint64_t)assignments->l.value);
+}
+
+static int my_project_dyn_startup(parsec_execution_stream_t * es, __parsec_project_dyn_PROJECT_task_t * this_task)
+{
+  __parsec_project_dyn_PROJECT_task_t *new_task;
+  parsec_data_copy_t *chunk = NULL;
+  __parsec_project_dyn_internal_taskpool_t *__tp = (__parsec_project_dyn_internal_taskpool_t *) this_task->taskpool;
+  int vpid = 0;
+  parsec_context_t *context = __tp->super.super.context;
+
+  if ( ((parsec_data_collection_t *)__tp->super._g_treeA)->myrank != 0)
+      return PARSEC_HOOK_RETURN_DONE;
+  if (NULL != ((parsec_data_collection_t *) __tp->super._g_treeA)->vpid_of) {
+      vpid = ((parsec_data_collection_t *) __tp->super._g_treeA)->vpid_of((parsec_data_collection_t *) __tp->super._g_treeA, 0, 0);
+      assert(context->nb_vp >= vpid);
+  }
+  new_task = (__parsec_project_dyn_PROJECT_task_t *) parsec_thread_mempool_allocate(context->virtual_processes[0]->execution_streams[0]->context_mempool);
+  new_task->status = PARSEC_TASK_STATUS_NONE;
+  new_task->taskpool = this_task->taskpool;
+  new_task->task_class = __tp->super.super.task_classes_array[project_dyn_PROJECT.task_class_id];
+  new_task->chore_mask = 1<<0;
+
+  new_task->locals.n.value = 0;
+  new_task->locals.l.value = 0;
+  new_task->locals.larger_than_thresh.value = 1;
+  new_task->data._f_RL.source_repo = NULL;
+  new_task->data._f_RL.source_repo_entry = NULL;
+  new_task->data._f_RL.data_in = NULL;
+  new_task->data._f_RL.data_out = NULL;
+  new_task->data._f_NODE.source_repo = NULL;
+  new_task->data._f_NODE.source_repo_entry = NULL;
+  chunk = parsec_arena_get_copy(__tp->super.arenas_datatypes[PARSEC_project_dyn_DEFAULT_ADT_IDX].arena, 1, 0, __tp->super.arenas_datatypes[PARSEC_project_dyn_DEFAULT_ADT_IDX].opaque_dtt);
+  chunk->original->owner_device = 0;
+  new_task->data._f_NODE.data_out = chunk;
+  new_task->data._f_NODE.data_in = chunk;
+  new_task->data._f_NODE.source_repo = NULL;
+  new_task->data._f_NODE.source_repo_entry = NULL;
+
+  new_task->priority = 1;
+
+  PARSEC_LIST_ITEM_SINGLETON(new_task);
+
+  /* It is the user-specific function responsibility to count tasks
+   * that it generates before scheduling them, knowing that 1 task is
+   * already scheduled... So, nothing to do here since we just added
+   * 1 task
+   */
+   parsec_atomic_fetch_add_int32(&__tp->initial_number_tasks, 1);
+  __parsec_schedule(es, (parsec_task_t *)new_task, 0);
+
+  (void)vpid;
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+PARSEC_OBJ_CLASS_INSTANCE(parsec_project_dyn_taskpool_t, parsec_taskpool_t, NULL, NULL);
+
@@ -0,0 +1,66 @@
+#ifndef _project_dyn_h_
+#define _project_dyn_h_
+#include "parsec.h"
+#include "parsec/parsec_internal.h"
+#include "parsec/remote_dep.h"
+
+BEGIN_C_DECLS
+
+#define PARSEC_project_dyn_DEFAULT_ADT_IDX    0
+#define PARSEC_project_dyn_ADT_IDX_MAX       1
+typedef struct parsec_project_dyn_taskpool_s {
+  parsec_taskpool_t super;
+  /* The list of globals */
+  tree_dist_t * _g_treeA /* data treeA */;
+  int _g_NP;
+  parsec_data_collection_t * _g_fakeDesc;
+  double _g_thresh;
+  int _g_verbose;
+  double _g_alpha;
+  /* The array of datatypes (DEFAULT and co.) */
+  parsec_arena_datatype_t arenas_datatypes[PARSEC_project_dyn_ADT_IDX_MAX];
+  uint32_t arenas_datatypes_size;
+} parsec_project_dyn_taskpool_t;
+
+/** Beware that this object is not a superset of the internal object, and as a result
+ *  we should never create one directly. Instead we should rely on the creation of the
+ *  internal object (__parsec_project_dyn_taskpool_t).
+ */
+PARSEC_OBJ_CLASS_DECLARATION(parsec_project_dyn_taskpool_t);
+extern parsec_project_dyn_taskpool_t *parsec_project_dyn_new(tree_dist_t * _g_treeA /* data treeA */, int _g_NP, parsec_data_collection_t * _g_fakeDesc, double _g_thresh, int _g_verbose, double _g_alpha);
+
+#if MAX_LOCAL_COUNT < 3  /* number of parameters and locals PROJECT */
+  #error Too many parameters and local variables (3 out of MAX_LOCAL_COUNT) for task PROJECT
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_project_dyn_PROJECT_assignment_s {
+  parsec_assignment_t n;
+  parsec_assignment_t l;
+  parsec_assignment_t larger_than_thresh;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-3];
+} __parsec_project_dyn_PROJECT_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 2  /* total number of flows for task PROJECT */
+  #error Too many flows (2 out of MAX_PARAM_COUNT) for task PROJECT
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_project_dyn_PROJECT_data_s {
+  parsec_data_pair_t _f_NODE;
+  parsec_data_pair_t _f_RL;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-2];
+} __parsec_project_dyn_PROJECT_data_t;
+
+typedef struct __parsec_project_dyn_PROJECT_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_project_dyn_PROJECT_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_project_dyn_PROJECT_data_s data;
+} __parsec_project_dyn_PROJECT_task_t;
+
+
+END_C_DECLS
+
+#endif /* _project_dyn_h_ */ 
@@ -0,0 +1,3824 @@
+#include "parsec.h"
+#include "parsec/parsec_internal.h"
+#include "parsec/ayudame.h"
+#include "parsec/execution_stream.h"
+#include "parsec/parsec_binary_profile.h"
+#include "parsec/mca/device/device_gpu.h"
+#if defined(PARSEC_HAVE_DEV_CUDA_SUPPORT)
+#include "parsec/mca/device/cuda/device_cuda.h"
+#endif  /* defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) */
+#if defined(PARSEC_HAVE_DEV_HIP_SUPPORT)
+#include "parsec/mca/device/hip/device_hip.h"
+#endif  /* defined(PARSEC_HAVE_DEV_HIP_SUPPORT) */
+#if defined(_MSC_VER) || defined(__MINGW32__)
+#  include <malloc.h>
+#else
+#  include <alloca.h>
+#endif  /* defined(_MSC_VER) || defined(__MINGW32__) */
+
+#define PARSEC_walk_NB_TASK_CLASSES 4
+#define PARSEC_walk_NB_DATA 2
+
+typedef struct __parsec_walk_internal_taskpool_s __parsec_walk_internal_taskpool_t;
+struct parsec_walk_internal_taskpool_s;
+
+/** Predeclarations of the parsec_task_class_t */
+static const parsec_task_class_t walk_DO_DOWN;
+static const parsec_task_class_t walk_DOWN;
+static const parsec_task_class_t walk_UP;
+static const parsec_task_class_t walk_BCAST_UP;
+/** Predeclarations of the parameters */
+static const parsec_flow_t flow_of_walk_DO_DOWN_for_NODE;
+static const parsec_flow_t flow_of_walk_DO_DOWN_for_RL;
+static const parsec_flow_t flow_of_walk_DOWN_for_RL;
+static const parsec_flow_t flow_of_walk_UP_for_NODE;
+static const parsec_flow_t flow_of_walk_UP_for_LEFT;
+static const parsec_flow_t flow_of_walk_UP_for_RIGHT;
+static const parsec_flow_t flow_of_walk_UP_for_RL;
+static const parsec_flow_t flow_of_walk_BCAST_UP_for_RL;
+/*
+ * Copyright (c) 2014-2022 The University of Tennessee and The University
+ *                         of Tennessee Research Foundation.  All rights
+ *                         reserved.
+ */
+#include "tree_dist.h"
+#include "parsec/sys/atomic.h"
+
+struct __parsec_walk_internal_taskpool_s;
+struct __parsec_walk_UP_assignment_s;
+struct __parsec_walk_DOWN_assignment_s;
+struct __parsec_walk_DO_DOWN_assignment_s;
+struct __parsec_walk_DOWN_task_s;
+
+static parsec_key_t up_make_key(const parsec_taskpool_t* __tp, const parsec_assignment_t *_as);
+static parsec_key_t down_make_key(const parsec_taskpool_t* __tp, const parsec_assignment_t *_as);
+static parsec_key_t do_down_make_key(const parsec_taskpool_t* __tp, const parsec_assignment_t *_as);
+static uint32_t undetermined_nb_tasks(struct __parsec_walk_internal_taskpool_s *__tp);
+
+static int my_walk_startup(parsec_execution_stream_t * es,
+                           struct __parsec_walk_DOWN_task_s * this_task);
+#include "walk_utils.h"
+#define PARSEC_walk_DEFAULT_ADT    (&__parsec_tp->super.arenas_datatypes[PARSEC_walk_DEFAULT_ADT_IDX])
+#include "walk.h"
+
+struct __parsec_walk_internal_taskpool_s {
+ parsec_walk_taskpool_t super;
+ volatile int32_t sync_point;
+ volatile int32_t initial_number_tasks;
+ parsec_task_t* startup_queue;
+  /* The ranges to compute the hash key */
+  /* nothing for DO_DOWN as it gets a user-defined make_key */
+  /* nothing for DOWN as it gets a user-defined make_key */
+  /* nothing for UP as it gets a user-defined make_key */
+  int BCAST_UP_rank_min;
+  int BCAST_UP_rank_range;
+  /* The list of data repositories  DO_DOWN */
+  data_repo_t* repositories[4];
+};
+
+#if defined(PARSEC_PROF_TRACE)
+#  if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+static int walk_profiling_array[4*PARSEC_walk_NB_TASK_CLASSES] = {-2}; /* 2 pairs (begin, end) per task, times two because each task class has an internal_init task */
+#  else /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+static int walk_profiling_array[2*PARSEC_walk_NB_TASK_CLASSES] = {-2}; /* 2 pairs (begin, end) per task */
+#  endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+#endif  /* defined(PARSEC_PROF_TRACE) */
+/* Globals */
+#define tree __parsec_tp->super._g_tree
+#define NP (__parsec_tp->super._g_NP)
+#define fakeDesc __parsec_tp->super._g_fakeDesc
+#define on_fct_param (__parsec_tp->super._g_on_fct_param)
+#define on_node_down (__parsec_tp->super._g_on_node_down)
+#define on_node_up (__parsec_tp->super._g_on_node_up)
+#define verbose (__parsec_tp->super._g_verbose)
+
+static inline int parsec_imin(int a, int b) { return (a <= b) ? a : b; };
+
+static inline int parsec_imax(int a, int b) { return (a >= b) ? a : b; };
+
+/* Data Access Macros */
+#define data_of_tree(tree_d0, tree_d1)  (((parsec_data_collection_t*)__parsec_tp->super._g_tree)->data_of((parsec_data_collection_t*)__parsec_tp->super._g_tree, (tree_d0), (tree_d1)))
+#define data_of_fakeDesc(fakeDesc_d0, fakeDesc_d1)  (((parsec_data_collection_t*)__parsec_tp->super._g_fakeDesc)->data_of((parsec_data_collection_t*)__parsec_tp->super._g_fakeDesc, (fakeDesc_d0), (fakeDesc_d1)))
+
+#define rank_of_tree(tree_d0, tree_d1)  (((parsec_data_collection_t*)__parsec_tp->super._g_tree)->rank_of((parsec_data_collection_t*)__parsec_tp->super._g_tree, (tree_d0), (tree_d1)))
+#define rank_of_fakeDesc(fakeDesc_d0, fakeDesc_d1)  (((parsec_data_collection_t*)__parsec_tp->super._g_fakeDesc)->rank_of((parsec_data_collection_t*)__parsec_tp->super._g_fakeDesc, (fakeDesc_d0), (fakeDesc_d1)))
+
+/* Functions Predicates */
+#define DO_DOWN_pred(n, l) (((parsec_data_collection_t*)(__parsec_tp->super._g_tree))->myrank == rank_of_tree(n, l))
+#define DOWN_pred(n, l, node_exists) (((parsec_data_collection_t*)(__parsec_tp->super._g_tree))->myrank == rank_of_tree(n, l))
+#define UP_pred(n, l) (((parsec_data_collection_t*)(__parsec_tp->super._g_tree))->myrank == rank_of_tree(n, l))
+#define BCAST_UP_pred(rank) (((parsec_data_collection_t*)(__parsec_tp->super._g_fakeDesc))->myrank == rank_of_fakeDesc(rank, rank))
+
+/* Data Repositories */
+#define DO_DOWN_repo (__parsec_tp->repositories[3])
+#define DOWN_repo (__parsec_tp->repositories[2])
+#define UP_repo (__parsec_tp->repositories[1])
+#define BCAST_UP_repo (__parsec_tp->repositories[0])
+/* Release dependencies output macro */
+#if defined(PARSEC_DEBUG_NOISIER)
+#define RELEASE_DEP_OUTPUT(ES, DEPO, TASKO, DEPI, TASKI, RSRC, RDST, DATA)\
+  do { \
+    char tmp1[128], tmp2[128]; (void)tmp1; (void)tmp2;\
+    PARSEC_DEBUG_VERBOSE(20, parsec_debug_output, "thread %d VP %d explore deps from %s:%s to %s:%s (from rank %d to %d) base ptr %p",\
+           (NULL != (ES) ? (ES)->th_id : -1), (NULL != (ES) ? (ES)->virtual_process->vp_id : -1),\
+           DEPO, parsec_task_snprintf(tmp1, 128, (parsec_task_t*)(TASKO)),\
+           DEPI, parsec_task_snprintf(tmp2, 128, (parsec_task_t*)(TASKI)), (RSRC), (RDST), (DATA));\
+  } while(0)
+#define ACQUIRE_FLOW(TASKI, DEPI, FUNO, DEPO, LOCALS, PTR)\
+  do { \
+    char tmp1[128], tmp2[128]; (void)tmp1; (void)tmp2;\
+    PARSEC_DEBUG_VERBOSE(20, parsec_debug_output, "task %s acquires flow %s from %s %s data ptr %p",\
+           parsec_task_snprintf(tmp1, 128, (parsec_task_t*)(TASKI)), (DEPI),\
+           (DEPO), parsec_snprintf_assignments(tmp2, 128, (FUNO), (parsec_assignment_t*)(LOCALS)), (PTR));\
+  } while(0)
+#else
+#define RELEASE_DEP_OUTPUT(ES, DEPO, TASKO, DEPI, TASKI, RSRC, RDST, DATA)
+#define ACQUIRE_FLOW(TASKI, DEPI, TASKO, DEPO, LOCALS, PTR)
+#endif
+static char *__jdf2c_key_fns_DO_DOWN_key_print(char *buffer, size_t buffer_size, parsec_key_t k, void *user_data)
+{
+  (void)user_data;
+  snprintf(buffer, buffer_size, "(%llu)", (unsigned long long int)k);
+  return buffer;
+}
+
+static parsec_key_fn_t __jdf2c_key_fns_DO_DOWN = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = __jdf2c_key_fns_DO_DOWN_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+static char *__jdf2c_key_fns_DOWN_key_print(char *buffer, size_t buffer_size, parsec_key_t k, void *user_data)
+{
+  (void)user_data;
+  snprintf(buffer, buffer_size, "(%llu)", (unsigned long long int)k);
+  return buffer;
+}
+
+static parsec_key_fn_t __jdf2c_key_fns_DOWN = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = __jdf2c_key_fns_DOWN_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+static char *__jdf2c_key_fns_UP_key_print(char *buffer, size_t buffer_size, parsec_key_t k, void *user_data)
+{
+  (void)user_data;
+  snprintf(buffer, buffer_size, "(%llu)", (unsigned long long int)k);
+  return buffer;
+}
+
+static parsec_key_fn_t __jdf2c_key_fns_UP = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = __jdf2c_key_fns_UP_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+static inline parsec_key_t __jdf2c_make_key_BCAST_UP(const parsec_taskpool_t *tp, const parsec_assignment_t *as)
+{
+  const __parsec_walk_internal_taskpool_t *__parsec_tp = (const __parsec_walk_internal_taskpool_t *)tp;
+  const __parsec_walk_BCAST_UP_parsec_assignment_t *assignment = (const __parsec_walk_BCAST_UP_parsec_assignment_t*)as;
+  uint64_t __parsec_id = 0;
+  __parsec_id += (assignment->rank.value - __parsec_tp->BCAST_UP_rank_min);
+  return (parsec_key_t)__parsec_id;
+}
+static char *__jdf2c_key_fns_BCAST_UP_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_walk_internal_taskpool_t *__parsec_tp = (__parsec_walk_internal_taskpool_t *)user_data;
+  int rank = (__parsec_key) % __parsec_tp->BCAST_UP_rank_range + __parsec_tp->BCAST_UP_rank_min;
+  __parsec_key = __parsec_key / __parsec_tp->BCAST_UP_rank_range;
+  snprintf(buffer, buffer_size, "BCAST_UP(%d)", rank);
+  return buffer;
+}
+
+static parsec_key_fn_t __jdf2c_key_fns_BCAST_UP = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = __jdf2c_key_fns_BCAST_UP_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/******                                    DO_DOWN                                    ******/
+
+static inline int32_t minexpr_of_symb_walk_DO_DOWN_n_fct(const __parsec_walk_internal_taskpool_t *__parsec_tp, const __parsec_walk_DO_DOWN_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_walk_DO_DOWN_n = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_walk_DO_DOWN_n_fct }
+                   }
+};
+static inline int32_t maxexpr_of_symb_walk_DO_DOWN_n_fct(const __parsec_walk_internal_taskpool_t *__parsec_tp, const __parsec_walk_DO_DOWN_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 31;
+}
+static const parsec_expr_t maxexpr_of_symb_walk_DO_DOWN_n = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_walk_DO_DOWN_n_fct }
+                   }
+};
+static const parsec_symbol_t symb_walk_DO_DOWN_n = { .name = "n", .context_index = 0, .min = &minexpr_of_symb_walk_DO_DOWN_n, .max = &maxexpr_of_symb_walk_DO_DOWN_n, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int32_t minexpr_of_symb_walk_DO_DOWN_l_fct(const __parsec_walk_internal_taskpool_t *__parsec_tp, const __parsec_walk_DO_DOWN_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_walk_DO_DOWN_l = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_walk_DO_DOWN_l_fct }
+                   }
+};
+static inline int maxexpr_of_symb_walk_DO_DOWN_l_fct(const __parsec_walk_internal_taskpool_t *__parsec_tp, const __parsec_walk_DO_DOWN_parsec_assignment_t *locals)
+{
+  const int n = locals->n.value;
+  const int l = locals->l.value; (void)l;
+
+  (void)n;
+  (void)l;
+  (void)__parsec_tp; (void)locals;
+  return (1 << n);
+}
+static const parsec_expr_t maxexpr_of_symb_walk_DO_DOWN_l = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_walk_DO_DOWN_l_fct }
+                   }
+};
+static const parsec_symbol_t symb_walk_DO_DOWN_l = { .name = "l", .context_index = 1, .min = &minexpr_of_symb_walk_DO_DOWN_l, .max = &maxexpr_of_symb_walk_DO_DOWN_l, .cst_inc = 1, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int affinity_of_walk_DO_DOWN(const __parsec_walk_DO_DOWN_task_t *this_task,
+                     parsec_data_ref_t *ref)
+{
+    const __parsec_walk_internal_taskpool_t *__parsec_tp = (const __parsec_walk_internal_taskpool_t*)this_task->taskpool;
+  const int n = this_task->locals.n.value; (void)n;
+  const int l = this_task->locals.l.value; (void)l;
+
+  /* Silent Warnings: should look into predicate to know what variables are usefull */
+  (void)n;
+  (void)l;
+  ref->dc = (parsec_data_collection_t *)__parsec_tp->super._g_tree;
+  /* Compute data key */
+  ref->key = ref->dc->data_key(ref->dc, n, l);
+  return 1;
+}
+static const parsec_property_t properties_of_walk_DO_DOWN[1] = {
+  {.name = NULL, .expr = NULL}
+};
+static parsec_data_t *flow_of_walk_DO_DOWN_for_NODE_dep1_atline_167_direct_access(const __parsec_walk_internal_taskpool_t *__parsec_tp, const __parsec_walk_DO_DOWN_parsec_assignment_t *assignments)
+{
+  const int n = assignments->n.value; (void)n;
+  const int l = assignments->l.value; (void)l;
+
+  /* Silence Warnings: should look into parameters to know what variables are useful */
+  (void)n;
+  (void)l;
+  if( __parsec_tp->super.super.context->my_rank == (int32_t)rank_of_tree(n, l) )
+    return data_of_tree(n, l);
+  return NULL;
+}
+
+static const parsec_dep_t flow_of_walk_DO_DOWN_for_NODE_dep1_atline_167 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = PARSEC_LOCAL_DATA_TASK_CLASS_ID, /* walk_tree */
+  .direct_data = (parsec_data_lookup_func_t)&flow_of_walk_DO_DOWN_for_NODE_dep1_atline_167_direct_access,
+  .dep_index = 1,
+  .dep_datatype_index = 1,
+  .belongs_to = &flow_of_walk_DO_DOWN_for_NODE,
+};
+static const parsec_dep_t flow_of_walk_DO_DOWN_for_NODE_dep2_atline_168 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 1, /* walk_UP */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_walk_UP_for_NODE,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_walk_DO_DOWN_for_NODE,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+#if MAX_DEP_OUT_COUNT < 1  /* number of output dependencies */
+    #error Too many output dependencies (supports up to MAX_DEP_OUT_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_OUT_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_walk_DO_DOWN_for_NODE = {
+  .name               = "NODE",
+  .sym_type           = PARSEC_SYM_INOUT,
+  .flow_flags         = PARSEC_FLOW_ACCESS_READ|PARSEC_FLOW_HAS_IN_DEPS,
+  .flow_index         = 0,
+  .flow_datatype_mask = 0x1,
+  .dep_in     = { &flow_of_walk_DO_DOWN_for_NODE_dep1_atline_167 },
+  .dep_out    = { &flow_of_walk_DO_DOWN_for_NODE_dep2_atline_168 }
+};
+
+static const parsec_dep_t flow_of_walk_DO_DOWN_for_RL_dep1_atline_166 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 2, /* walk_DOWN */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_walk_DOWN_for_RL,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_walk_DO_DOWN_for_RL,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_walk_DO_DOWN_for_RL = {
+  .name               = "RL",
+  .sym_type           = PARSEC_SYM_IN,
+  .flow_flags         = PARSEC_FLOW_ACCESS_NONE,
+  .flow_index         = 1,
+  .flow_datatype_mask = 0x0,
+  .dep_in     = { &flow_of_walk_DO_DOWN_for_RL_dep1_atline_166 },
+  .dep_out    = { NULL }
+};
+
+static void
+iterate_successors_of_walk_DO_DOWN(parsec_execution_stream_t *es, const __parsec_walk_DO_DOWN_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_walk_internal_taskpool_t *__parsec_tp = (const __parsec_walk_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_walk_DO_DOWN_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_walk_DO_DOWN_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int n = __jdf2c__tmp_locals.n.value; (void)n;
+  const int l = __jdf2c__tmp_locals.l.value; (void)l;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)n;  (void)l;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_tree(n, l);
+#endif
+  if( action_mask & 0x1 ) {  /* Flow of data NODE [0] */
+    data.data   = this_task->data._f_NODE.data_out;
+    data.data_future  = NULL;
+    if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_walk_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_walk_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+       __parsec_walk_UP_task_t* ncc = (__parsec_walk_UP_task_t*)&nc;
+    nc.task_class = __parsec_tp->super.super.task_classes_array[walk_UP.task_class_id];
+      const int UP_n = n;
+      if( (UP_n >= (0)) && (UP_n <= (31)) ) {
+        assert(&nc.locals[0].value == &ncc->locals.n.value);
+        ncc->locals.n.value = UP_n;
+        const int UP_l = l;
+        if( (UP_l >= (0)) && (UP_l <= ((1 << ncc->locals.n.value))) ) {
+          assert(&nc.locals[1].value == &ncc->locals.l.value);
+          ncc->locals.l.value = UP_l;
+#if defined(DISTRIBUTED)
+          rank_dst = rank_of_tree(ncc->locals.n.value, ncc->locals.l.value);
+          if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+            vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_tree)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_tree, ncc->locals.n.value, ncc->locals.l.value);
+          nc.priority = __parsec_tp->super.super.priority;
+          successor_repo = UP_repo;
+          successor_repo_key = up_make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+        RELEASE_DEP_OUTPUT(es, "NODE", this_task, "NODE", &nc, rank_src, rank_dst, &data);
+        if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_walk_DO_DOWN_for_NODE_dep2_atline_168, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+          }
+        }
+  }
+  /* Flow of data RL has only IN dependencies */
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static void
+iterate_predecessors_of_walk_DO_DOWN(parsec_execution_stream_t *es, const __parsec_walk_DO_DOWN_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_walk_internal_taskpool_t *__parsec_tp = (const __parsec_walk_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_walk_DO_DOWN_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_walk_DO_DOWN_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int n = __jdf2c__tmp_locals.n.value; (void)n;
+  const int l = __jdf2c__tmp_locals.l.value; (void)l;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)n;  (void)l;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_tree(n, l);
+#endif
+  /* Flow of data NODE has only OUTPUT dependencies to Memory */
+  if( action_mask & 0x1 ) {  /* Flow of data RL [1] */
+    data.data   = this_task->data._f_RL.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x1 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  =   /* Control: always empty */ 0;
+    data.local.dst_count  =   /* Control: always empty */ 0;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = NULL;
+    data.remote.src_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.src_count  =   /* Control: always empty */ 0;
+    data.remote.dst_count  =   /* Control: always empty */ 0;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        __parsec_walk_DOWN_task_t* ncc = (__parsec_walk_DOWN_task_t*)&nc;
+    nc.task_class = __parsec_tp->super.super.task_classes_array[walk_DOWN.task_class_id];
+      const int DOWN_n = n;
+      if( (DOWN_n >= (0)) && (DOWN_n <= (31)) ) {
+        assert(&nc.locals[0].value == &ncc->locals.n.value);
+        ncc->locals.n.value = DOWN_n;
+        const int DOWN_l = l;
+        if( (DOWN_l >= (0)) && (DOWN_l <= ((1 << ncc->locals.n.value))) ) {
+          assert(&nc.locals[1].value == &ncc->locals.l.value);
+          ncc->locals.l.value = DOWN_l;
+          const int DOWN_node_exists = 1;
+          assert(&nc.locals[2].value == &ncc->locals.node_exists.value);
+          ncc->locals.node_exists.value = DOWN_node_exists;
+#if defined(DISTRIBUTED)
+          rank_dst = rank_of_tree(ncc->locals.n.value, ncc->locals.l.value);
+          if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+            vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_tree)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_tree, ncc->locals.n.value, ncc->locals.l.value);
+          nc.priority = __parsec_tp->super.super.priority;
+          successor_repo = DOWN_repo;
+          successor_repo_key = down_make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+        RELEASE_DEP_OUTPUT(es, "RL", this_task, "RL", &nc, rank_src, rank_dst, &data);
+        if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_walk_DO_DOWN_for_RL_dep1_atline_166, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+          }
+        }
+  }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static int release_deps_of_walk_DO_DOWN(parsec_execution_stream_t *es, __parsec_walk_DO_DOWN_task_t *this_task, uint32_t action_mask, parsec_remote_deps_t *deps)
+{
+  PARSEC_PINS(es, RELEASE_DEPS_BEGIN, (parsec_task_t *)this_task);  const __parsec_walk_internal_taskpool_t *__parsec_tp = (const __parsec_walk_internal_taskpool_t *)this_task->taskpool;
+  parsec_release_dep_fct_arg_t arg;
+  int __vp_id;
+  int consume_local_repo = 0;
+  arg.action_mask = action_mask;
+  arg.output_entry = NULL;
+  arg.output_repo = NULL;
+#if defined(DISTRIBUTED)
+  arg.remote_deps = deps;
+#endif  /* defined(DISTRIBUTED) */
+  assert(NULL != es);
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS )    arg.ready_lists = alloca(sizeof(parsec_task_t *) * es->virtual_process->parsec_context->nb_vp);
+  else
+    arg.ready_lists = NULL;
+  for( __vp_id = 0; __vp_id < es->virtual_process->parsec_context->nb_vp; arg.ready_lists[__vp_id++] = NULL );
+  (void)__parsec_tp; (void)deps;
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_NODE.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_NODE.source_repo, this_task->data._f_NODE.source_repo_entry->ht_item.key );
+    }
+  }
+  consume_local_repo = (this_task->repo_entry != NULL);
+  arg.output_repo = DO_DOWN_repo;
+  arg.output_entry = this_task->repo_entry;
+  arg.output_usage = 0;
+  if( action_mask & (PARSEC_ACTION_RELEASE_LOCAL_DEPS | PARSEC_ACTION_GET_REPO_ENTRY) ) {
+    arg.output_entry = data_repo_lookup_entry_and_create( es, arg.output_repo, do_down_make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    arg.output_entry->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(arg.output_entry->sim_exec_date == 0);
+    arg.output_entry->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  if(action_mask & ( PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE ) ){
+    /* Generate the reshape promise for the outputs that need it */
+    iterate_successors_of_walk_DO_DOWN(es, this_task, action_mask, parsec_set_up_reshape_promise, &arg);
+   }
+  iterate_successors_of_walk_DO_DOWN(es, this_task, action_mask, parsec_release_dep_fct, &arg);
+
+#if defined(DISTRIBUTED)
+  if( (action_mask & PARSEC_ACTION_SEND_REMOTE_DEPS) && (NULL != arg.remote_deps)) {
+    parsec_remote_dep_activate(es, (parsec_task_t *)this_task, arg.remote_deps, arg.remote_deps->outgoing_mask);
+  }
+#endif
+
+  if(action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS) {
+    data_repo_entry_addto_usage_limit(DO_DOWN_repo, arg.output_entry->ht_item.key, arg.output_usage);
+    __parsec_schedule_vp(es, arg.ready_lists, 0);
+  }
+      if (consume_local_repo) {
+         data_repo_entry_used_once( DO_DOWN_repo, this_task->repo_entry->ht_item.key );
+      }
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_NODE.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_NODE.data_in);
+    }
+  }
+  PARSEC_PINS(es, RELEASE_DEPS_END, (parsec_task_t *)this_task);  return 0;
+}
+
+static int data_lookup_of_walk_DO_DOWN(parsec_execution_stream_t *es, __parsec_walk_DO_DOWN_task_t *this_task)
+{
+  const __parsec_walk_internal_taskpool_t *__parsec_tp = (__parsec_walk_internal_taskpool_t *)this_task->taskpool;
+  parsec_assignment_t generic_locals[MAX_PARAM_COUNT];  /* generic task locals */
+  int target_device = 0; (void)target_device;
+  (void)__parsec_tp; (void)generic_locals; (void)es;
+  parsec_data_copy_t *chunk = NULL;
+  data_repo_t        *reshape_repo  = NULL, *consumed_repo  = NULL;
+  data_repo_entry_t  *reshape_entry = NULL, *consumed_entry = NULL;
+  parsec_key_t        reshape_entry_key = 0, consumed_entry_key = 0;
+  uint8_t             consumed_flow_index;
+  parsec_dep_data_description_t data;
+  int ret;
+  (void)reshape_repo; (void)reshape_entry; (void)reshape_entry_key;
+  (void)consumed_repo; (void)consumed_entry; (void)consumed_entry_key;
+  (void)consumed_flow_index;
+  (void)chunk; (void)data; (void)ret;
+  const int n = this_task->locals.n.value; (void)n;
+  const int l = this_task->locals.l.value; (void)l;
+  if( NULL == this_task->repo_entry ){
+    this_task->repo_entry = data_repo_lookup_entry_and_create(es, DO_DOWN_repo,                                       do_down_make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    data_repo_entry_addto_usage_limit(DO_DOWN_repo, this_task->repo_entry->ht_item.key, 1);    this_task->repo_entry ->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(this_task->repo_entry ->sim_exec_date == 0);
+    this_task->repo_entry ->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  /* The reshape repo is the current task repo. */  reshape_repo = DO_DOWN_repo;
+  reshape_entry_key = do_down_make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals) ;
+  reshape_entry = this_task->repo_entry;
+  /* Lookup the input data, and store them in the context if any */
+
+if(! this_task->data._f_NODE.fulfill ){ /* Flow NODE */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_NODE.data_out = NULL;  /* By default, if nothing matches */
+  /* Flow NODE [0] dependency [1] from memory tree */
+  if( NULL == (chunk = this_task->data._f_NODE.data_in) ) {
+  /* No data set up by predecessor on this task input flow */
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+  parsec_prof_grapher_data_input(data_of_tree(n, l), (parsec_task_t*)this_task, &flow_of_walk_DO_DOWN_for_NODE, 1);
+#endif
+    chunk = parsec_data_get_copy(data_of_tree(n, l), target_device);
+    data.data = chunk;
+    data.data_future  = NULL;
+        data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.data_future   = NULL;
+    if( (ret = parsec_get_copy_reshape_from_desc(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    this_task->data._f_NODE.data_out = chunk;
+    PARSEC_OBJ_RETAIN(chunk);
+  } 
+    this_task->data._f_NODE.data_in     = chunk;
+    this_task->data._f_NODE.source_repo       = consumed_repo;
+    this_task->data._f_NODE.source_repo_entry = consumed_entry;
+    if( this_task->data._f_NODE.source_repo_entry == this_task->repo_entry ){
+      /* in case we have consume from this task repo entry for the flow,
+       * it is cleaned up, avoiding having old stuff during release_deps_of
+       */
+      this_task->repo_entry->data[0] = NULL;
+    }
+    this_task->data._f_NODE.fulfill = 1;
+}
+
+  /* RL is a control flow */
+  this_task->data._f_RL.data_in         = NULL;
+  this_task->data._f_RL.data_out        = NULL;
+  this_task->data._f_RL.source_repo       = NULL;
+  this_task->data._f_RL.source_repo_entry = NULL;
+  /** Generate profiling information */
+#if defined(PARSEC_PROF_TRACE)
+  this_task->prof_info.desc = (parsec_data_collection_t*)__parsec_tp->super._g_tree;
+  this_task->prof_info.priority = this_task->priority;
+  this_task->prof_info.data_id   = ((parsec_data_collection_t*)__parsec_tp->super._g_tree)->data_key((parsec_data_collection_t*)__parsec_tp->super._g_tree, n, l);
+  this_task->prof_info.task_class_id = this_task->task_class->task_class_id;
+  this_task->prof_info.task_return_code = -1;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int datatype_lookup_of_walk_DO_DOWN(parsec_execution_stream_t *es, const parsec_task_t *this_generic_task, const parsec_task_t *parent_task,
+              uint32_t* flow_mask, parsec_dep_data_description_t* data)
+{
+  const __parsec_walk_DO_DOWN_task_t *this_task = (__parsec_walk_DO_DOWN_task_t*)this_generic_task;
+  const __parsec_walk_internal_taskpool_t *__parsec_tp = (__parsec_walk_internal_taskpool_t *)this_task->taskpool;
+  (void)__parsec_tp; (void)es; (void)this_task; (void)data; (void)parent_task;
+  const int n = this_task->locals.n.value; (void)n;
+  const int l = this_task->locals.l.value; (void)l;
+  data->local.arena = data->remote.arena = NULL;
+  data->local.src_datatype  = data->local.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->local.src_count     = data->local.dst_count = 0;
+  data->local.src_displ     = data->local.dst_displ = 0;
+  data->data_future  = NULL;
+  if( (*flow_mask) & 0x80000000U ) { /* these are the input dependencies remote datatypes  */
+if( (*flow_mask) & 0x1U ) {  /* Flow NODE */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_walk_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_walk_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_walk_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+    goto no_mask_match;
+  }
+
+  /* these are the output dependencies remote datatypes */
+if( (*flow_mask) & 0x1U ) {  /* Flow NODE */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_walk_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_walk_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_walk_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+ no_mask_match:
+  data->data                             = NULL;
+  data->remote.src_datatype = data->remote.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->remote.src_count    = data->remote.dst_count = 0;
+  data->remote.src_displ    = data->remote.dst_displ = 0;
+  data->data_future  = NULL;
+  (*flow_mask) = 0;  /* nothing left */
+  (void)n;  (void)l;
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+static int hook_of_walk_DO_DOWN(parsec_execution_stream_t *es, __parsec_walk_DO_DOWN_task_t *this_task)
+{
+  __parsec_walk_internal_taskpool_t *__parsec_tp = (__parsec_walk_internal_taskpool_t *)this_task->taskpool;
+  (void)es; (void)__parsec_tp;
+  const int n = this_task->locals.n.value; (void)n;
+  const int l = this_task->locals.l.value; (void)l;
+  (void)n;  (void)l;
+
+  /** Declare the variables that will hold the data, and all the accounting for each */
+  parsec_data_copy_t *_f_NODE = this_task->data._f_NODE.data_in;
+  void *NODE = PARSEC_DATA_COPY_GET_PTR(_f_NODE); (void)NODE;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    data_repo_entry_t *eNODE = this_task->data._f_NODE.source_repo_entry;
+    if( (NULL != eNODE) && (eNODE->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eNODE->sim_exec_date;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+  /** Cache Awareness Accounting */
+#if defined(PARSEC_CACHE_AWARENESS)
+  cache_buf_referenced(es->closest_cache, NODE);
+#endif /* PARSEC_CACHE_AWARENESS */
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                                  DO_DOWN BODY                                  -----*/
+
+{
+    node_t *node = (node_t*)NODE;
+    if( verbose ) {
+        int rank = (((parsec_data_collection_t*)__parsec_tp->super._g_tree)->rank_of((parsec_data_collection_t*)__parsec_tp->super._g_tree, n, l));
+        fprintf(stderr, "CALLING DO_DOWN(%d, %d) on rank %d\n", n, l, rank);
+    }
+
+    if( NULL != on_node_down ) {
+        on_node_down(tree, node, n, l, on_fct_param);
+    }
+}
+
+/*-----                              END OF DO_DOWN BODY                              -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#endif  /*  defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+static int complete_hook_of_walk_DO_DOWN(parsec_execution_stream_t *es, __parsec_walk_DO_DOWN_task_t *this_task)
+{
+  const __parsec_walk_internal_taskpool_t *__parsec_tp = (__parsec_walk_internal_taskpool_t *)this_task->taskpool;
+#if defined(DISTRIBUTED)
+    const int n = this_task->locals.n.value; (void)n;
+  const int l = this_task->locals.l.value; (void)l;
+#endif  /* defined(DISTRIBUTED) */
+  (void)es; (void)__parsec_tp;
+parsec_data_t* data_t_desc = NULL; (void)data_t_desc;
+#if defined(DISTRIBUTED)
+  /** If not working on distributed, there is no risk that data is not in place */
+  (void)n;  (void)l;
+
+#endif /* DISTRIBUTED */
+#if defined(PARSEC_PROF_GRAPHER)
+  parsec_prof_grapher_task((parsec_task_t*)this_task, es->th_id, es->virtual_process->vp_id,
+     __jdf2c_key_fns_DO_DOWN.key_hash(this_task->task_class->make_key( (parsec_taskpool_t*)this_task->taskpool, ((parsec_task_t*)this_task)->locals), NULL));
+#endif  /* defined(PARSEC_PROF_GRAPHER) */
+  release_deps_of_walk_DO_DOWN(es, this_task,
+      PARSEC_ACTION_RELEASE_REMOTE_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_REFS |
+      PARSEC_ACTION_RESHAPE_ON_RELEASE |
+      0x1,  /* mask of all dep_index */ 
+      NULL);
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static parsec_hook_return_t release_task_of_walk_DO_DOWN(parsec_execution_stream_t *es, parsec_task_t *this_task)
+{
+    const __parsec_walk_internal_taskpool_t *__parsec_tp =
+        (const __parsec_walk_internal_taskpool_t *)this_task->taskpool;
+    parsec_hash_table_t *ht = (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[3];
+    parsec_key_t key = this_task->task_class->make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals);
+    parsec_hashable_dependency_t *hash_dep = (parsec_hashable_dependency_t *)parsec_hash_table_remove(ht, key);
+    parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);
+    if( (PARSEC_UNDETERMINED_NB_TASKS == __parsec_tp->super.super.nb_tasks) ||
+        (0 == __parsec_tp->super.super.nb_tasks) ||
+        (PARSEC_RUNTIME_RESERVED_NB_TASKS == __parsec_tp->super.super.nb_tasks) ) {
+        /* don't spend time counting */
+        return parsec_release_task_to_mempool(es, this_task);
+    }
+    return parsec_release_task_to_mempool_update_nbtasks(es, this_task);
+}
+
+static char *walk_walk_DO_DOWN_internal_init_deps_key_functions_key_print(char *buffer, size_t buffer_size, parsec_key_t k, void *user_data)
+{
+  (void)user_data;
+  snprintf(buffer, buffer_size, "(%llu)", (unsigned long long int)k);
+  return buffer;
+}
+
+static parsec_key_fn_t walk_walk_DO_DOWN_internal_init_deps_key_functions = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = walk_walk_DO_DOWN_internal_init_deps_key_functions_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/* Needs: - - - */
+static int walk_DO_DOWN_internal_init(parsec_execution_stream_t * es, __parsec_walk_DO_DOWN_task_t * this_task)
+{
+  __parsec_walk_internal_taskpool_t *__parsec_tp = (__parsec_walk_internal_taskpool_t*)this_task->taskpool;
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+  PARSEC_PROFILING_TRACE(es->es_profile,
+                         this_task->taskpool->profiling_array[START_KEY(this_task->task_class->task_class_id)],
+                         0,
+                         this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+  this_task->status = PARSEC_TASK_STATUS_COMPLETE;
+
+  PARSEC_AYU_REGISTER_TASK(&walk_DO_DOWN);
+  __parsec_tp->super.super.dependencies_array[3] = PARSEC_OBJ_NEW(parsec_hash_table_t);
+  parsec_hash_table_init(__parsec_tp->super.super.dependencies_array[3], offsetof(parsec_hashable_dependency_t, ht_item), 10, walk_walk_DO_DOWN_internal_init_deps_key_functions, this_task->taskpool);
+  __parsec_tp->repositories[3] = data_repo_create_nothreadsafe(PARSEC_DEFAULT_DATAREPO_HASH_LENGTH, __jdf2c_key_fns_DO_DOWN, (parsec_taskpool_t*)__parsec_tp, 2);
+   (void)__parsec_tp; (void)es;
+  if(1 == parsec_atomic_fetch_dec_int32(&__parsec_tp->sync_point)) {
+    /* Last initialization task complete. Update the number of tasks. */
+    __parsec_tp->super.super.tdm.module->taskpool_addto_nb_tasks(&__parsec_tp->super.super, undetermined_nb_tasks(__parsec_tp));
+    parsec_mfence();  /* write memory barrier to guarantee that the scheduler gets the correct number of tasks */
+    parsec_taskpool_enable((parsec_taskpool_t*)__parsec_tp, &__parsec_tp->startup_queue,
+                           (parsec_task_t*)this_task, es, __parsec_tp->super.super.nb_pending_actions);
+    __parsec_tp->super.super.tdm.module->taskpool_ready(&__parsec_tp->super.super);
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+    PARSEC_PROFILING_TRACE(es->es_profile,
+                           this_task->taskpool->profiling_array[2 * this_task->task_class->task_class_id + 1],
+                           0,
+                           this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    return PARSEC_HOOK_RETURN_DONE;
+  }
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static const __parsec_chore_t __walk_DO_DOWN_chores[] ={
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+    { .type     = PARSEC_DEV_CPU,
+      .evaluate = (parsec_evaluate_function_t*)NULL,
+      .hook     = (parsec_hook_t*)hook_of_walk_DO_DOWN },
+#endif  /* defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+    { .type     = PARSEC_DEV_NONE,
+      .evaluate = NULL,
+      .hook     = (parsec_hook_t*)NULL },  /* End marker */
+};
+
+static const parsec_task_class_t walk_DO_DOWN = {
+  .name = "DO_DOWN",
+  .task_class_id = 3,
+  .nb_flows = 2,
+  .nb_parameters = 2,
+  .nb_locals = 2,
+  .task_class_type = PARSEC_TASK_CLASS_TYPE_PTG,
+  .params = { &symb_walk_DO_DOWN_n, &symb_walk_DO_DOWN_l, NULL },
+  .locals = { &symb_walk_DO_DOWN_n, &symb_walk_DO_DOWN_l, NULL },
+  .data_affinity = (parsec_data_ref_fn_t*)affinity_of_walk_DO_DOWN,
+  .initial_data = (parsec_data_ref_fn_t*)affinity_of_walk_DO_DOWN,
+  .final_data = (parsec_data_ref_fn_t*)affinity_of_walk_DO_DOWN,
+  .priority = NULL,
+  .properties = properties_of_walk_DO_DOWN,
+#if MAX_PARAM_COUNT < 1  /* number of read flows of DO_DOWN */
+  #error Too many read flows for task DO_DOWN
+#endif  /* MAX_PARAM_COUNT */
+#if MAX_PARAM_COUNT < 0  /* number of write flows of DO_DOWN */
+  #error Too many write flows for task DO_DOWN
+#endif  /* MAX_PARAM_COUNT */
+  .in = { &flow_of_walk_DO_DOWN_for_NODE, &flow_of_walk_DO_DOWN_for_RL, NULL },
+  .out = { &flow_of_walk_DO_DOWN_for_NODE, NULL },
+  .flags = 0x0 | PARSEC_HAS_IN_IN_DEPENDENCIES | PARSEC_USE_DEPS_MASK,
+  .dependencies_goal = 0x3,
+  .make_key = do_down_make_key,
+  .task_snprintf = parsec_task_snprintf,
+#if defined(PARSEC_PROF_TRACE)
+  .profile_info = &parsec_task_profile_info,
+#endif
+  .key_functions = &__jdf2c_key_fns_DO_DOWN,
+  .fini = (parsec_hook_t*)NULL,
+  .incarnations = __walk_DO_DOWN_chores,
+  .find_deps = parsec_hash_find_deps,
+  .update_deps = parsec_update_deps_with_mask,
+  .iterate_successors = (parsec_traverse_function_t*)iterate_successors_of_walk_DO_DOWN,
+  .iterate_predecessors = (parsec_traverse_function_t*)iterate_predecessors_of_walk_DO_DOWN,
+  .release_deps = (parsec_release_deps_t*)release_deps_of_walk_DO_DOWN,
+  .prepare_output = (parsec_hook_t*)NULL,
+  .prepare_input = (parsec_hook_t*)data_lookup_of_walk_DO_DOWN,
+  .time_estimate = NULL,
+  .get_datatype = datatype_lookup_of_walk_DO_DOWN,
+  .complete_execution = (parsec_hook_t*)complete_hook_of_walk_DO_DOWN,
+  .release_task = &release_task_of_walk_DO_DOWN,
+#if defined(PARSEC_SIM)
+  .sim_cost_fct = (parsec_sim_cost_fct_t*)NULL,
+#endif
+};
+
+
+/******                                      DOWN                                      ******/
+
+static inline int32_t minexpr_of_symb_walk_DOWN_n_fct(const __parsec_walk_internal_taskpool_t *__parsec_tp, const __parsec_walk_DOWN_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_walk_DOWN_n = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_walk_DOWN_n_fct }
+                   }
+};
+static inline int32_t maxexpr_of_symb_walk_DOWN_n_fct(const __parsec_walk_internal_taskpool_t *__parsec_tp, const __parsec_walk_DOWN_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 31;
+}
+static const parsec_expr_t maxexpr_of_symb_walk_DOWN_n = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_walk_DOWN_n_fct }
+                   }
+};
+static const parsec_symbol_t symb_walk_DOWN_n = { .name = "n", .context_index = 0, .min = &minexpr_of_symb_walk_DOWN_n, .max = &maxexpr_of_symb_walk_DOWN_n, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int32_t minexpr_of_symb_walk_DOWN_l_fct(const __parsec_walk_internal_taskpool_t *__parsec_tp, const __parsec_walk_DOWN_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_walk_DOWN_l = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_walk_DOWN_l_fct }
+                   }
+};
+static inline int maxexpr_of_symb_walk_DOWN_l_fct(const __parsec_walk_internal_taskpool_t *__parsec_tp, const __parsec_walk_DOWN_parsec_assignment_t *locals)
+{
+  const int n = locals->n.value;
+  const int l = locals->l.value; (void)l;
+  const int node_exists = locals->node_exists.value; (void)node_exists;
+
+  (void)n;
+  (void)l;
+  (void)node_exists;
+  (void)__parsec_tp; (void)locals;
+  return (1 << n);
+}
+static const parsec_expr_t maxexpr_of_symb_walk_DOWN_l = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_walk_DOWN_l_fct }
+                   }
+};
+static const parsec_symbol_t symb_walk_DOWN_l = { .name = "l", .context_index = 1, .min = &minexpr_of_symb_walk_DOWN_l, .max = &maxexpr_of_symb_walk_DOWN_l, .cst_inc = 1, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_walk_DOWN_node_exists_fct(const __parsec_walk_internal_taskpool_t *__parsec_tp, const __parsec_walk_DOWN_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 1;
+}
+static const parsec_expr_t expr_of_symb_walk_DOWN_node_exists = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_walk_DOWN_node_exists_fct }
+                   }
+};
+static const parsec_symbol_t symb_walk_DOWN_node_exists = { .name = "node_exists", .context_index = 2, .min = &expr_of_symb_walk_DOWN_node_exists, .max = &expr_of_symb_walk_DOWN_node_exists, .cst_inc = 0, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int affinity_of_walk_DOWN(const __parsec_walk_DOWN_task_t *this_task,
+                     parsec_data_ref_t *ref)
+{
+    const __parsec_walk_internal_taskpool_t *__parsec_tp = (const __parsec_walk_internal_taskpool_t*)this_task->taskpool;
+  const int n = this_task->locals.n.value; (void)n;
+  const int l = this_task->locals.l.value; (void)l;
+  const int node_exists = this_task->locals.node_exists.value; (void)node_exists;
+
+  /* Silent Warnings: should look into predicate to know what variables are usefull */
+  (void)n;
+  (void)l;
+  (void)node_exists;
+  ref->dc = (parsec_data_collection_t *)__parsec_tp->super._g_tree;
+  /* Compute data key */
+  ref->key = ref->dc->data_key(ref->dc, n, l);
+  return 1;
+}
+static const parsec_property_t properties_of_walk_DOWN[1] = {
+  {.name = NULL, .expr = NULL}
+};
+static inline int expr_of_cond_for_flow_of_walk_DOWN_for_RL_dep1_atline_135_fct(const __parsec_walk_internal_taskpool_t *__parsec_tp, const __parsec_walk_DOWN_parsec_assignment_t *locals)
+{
+  const int n = locals->n.value;
+  const int l = locals->l.value; (void)l;
+  const int node_exists = locals->node_exists.value; (void)node_exists;
+
+  (void)n;
+  (void)l;
+  (void)node_exists;
+  (void)__parsec_tp; (void)locals;
+  return (n) > (0);
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_walk_DOWN_for_RL_dep1_atline_135 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_walk_DOWN_for_RL_dep1_atline_135_fct }
+                   }
+};
+static const parsec_dep_t flow_of_walk_DOWN_for_RL_dep1_atline_135 = {
+  .cond = &expr_of_cond_for_flow_of_walk_DOWN_for_RL_dep1_atline_135,  /* (n) > (0) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 2, /* walk_DOWN */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_walk_DOWN_for_RL,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_walk_DOWN_for_RL,
+};
+static inline int expr_of_cond_for_flow_of_walk_DOWN_for_RL_dep2_atline_136_fct(const __parsec_walk_internal_taskpool_t *__parsec_tp, const __parsec_walk_DOWN_parsec_assignment_t *locals)
+{
+  const int n = locals->n.value; (void)n;
+  const int l = locals->l.value; (void)l;
+  const int node_exists = locals->node_exists.value;
+
+  (void)n;
+  (void)l;
+  (void)node_exists;
+  (void)__parsec_tp; (void)locals;
+  return node_exists;
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_walk_DOWN_for_RL_dep2_atline_136 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_walk_DOWN_for_RL_dep2_atline_136_fct }
+                   }
+};
+static const parsec_dep_t flow_of_walk_DOWN_for_RL_dep2_atline_136 = {
+  .cond = &expr_of_cond_for_flow_of_walk_DOWN_for_RL_dep2_atline_136,  /* node_exists */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 2, /* walk_DOWN */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_walk_DOWN_for_RL,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_walk_DOWN_for_RL,
+};
+static inline int expr_of_cond_for_flow_of_walk_DOWN_for_RL_dep3_atline_137_fct(const __parsec_walk_internal_taskpool_t *__parsec_tp, const __parsec_walk_DOWN_parsec_assignment_t *locals)
+{
+  const int n = locals->n.value; (void)n;
+  const int l = locals->l.value; (void)l;
+  const int node_exists = locals->node_exists.value;
+
+  (void)n;
+  (void)l;
+  (void)node_exists;
+  (void)__parsec_tp; (void)locals;
+  return node_exists;
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_walk_DOWN_for_RL_dep3_atline_137 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_walk_DOWN_for_RL_dep3_atline_137_fct }
+                   }
+};
+static const parsec_dep_t flow_of_walk_DOWN_for_RL_dep3_atline_137 = {
+  .cond = &expr_of_cond_for_flow_of_walk_DOWN_for_RL_dep3_atline_137,  /* node_exists */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 2, /* walk_DOWN */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_walk_DOWN_for_RL,
+  .dep_index = 1,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_walk_DOWN_for_RL,
+};
+static inline int expr_of_cond_for_flow_of_walk_DOWN_for_RL_dep4_atline_138_fct(const __parsec_walk_internal_taskpool_t *__parsec_tp, const __parsec_walk_DOWN_parsec_assignment_t *locals)
+{
+  const int n = locals->n.value; (void)n;
+  const int l = locals->l.value; (void)l;
+  const int node_exists = locals->node_exists.value;
+
+  (void)n;
+  (void)l;
+  (void)node_exists;
+  (void)__parsec_tp; (void)locals;
+  return node_exists;
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_walk_DOWN_for_RL_dep4_atline_138 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_walk_DOWN_for_RL_dep4_atline_138_fct }
+                   }
+};
+static const parsec_dep_t flow_of_walk_DOWN_for_RL_dep4_atline_138 = {
+  .cond = &expr_of_cond_for_flow_of_walk_DOWN_for_RL_dep4_atline_138,  /* node_exists */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 3, /* walk_DO_DOWN */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_walk_DO_DOWN_for_RL,
+  .dep_index = 2,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_walk_DOWN_for_RL,
+};
+static inline int expr_of_cond_for_flow_of_walk_DOWN_for_RL_dep5_atline_139_fct(const __parsec_walk_internal_taskpool_t *__parsec_tp, const __parsec_walk_DOWN_parsec_assignment_t *locals)
+{
+  const int n = locals->n.value; (void)n;
+  const int l = locals->l.value; (void)l;
+  const int node_exists = locals->node_exists.value; (void)node_exists;
+
+  (void)n;
+  (void)l;
+  (void)node_exists;
+  (void)__parsec_tp; (void)locals;
+  return (!(node_exists) && ((l % 2)) == (0));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_walk_DOWN_for_RL_dep5_atline_139 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_walk_DOWN_for_RL_dep5_atline_139_fct }
+                   }
+};
+static const parsec_dep_t flow_of_walk_DOWN_for_RL_dep5_atline_139 = {
+  .cond = &expr_of_cond_for_flow_of_walk_DOWN_for_RL_dep5_atline_139,  /* (!(node_exists) && ((l % 2)) == (0)) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 1, /* walk_UP */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_walk_UP_for_LEFT,
+  .dep_index = 3,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_walk_DOWN_for_RL,
+};
+static inline int expr_of_cond_for_flow_of_walk_DOWN_for_RL_dep6_atline_140_fct(const __parsec_walk_internal_taskpool_t *__parsec_tp, const __parsec_walk_DOWN_parsec_assignment_t *locals)
+{
+  const int n = locals->n.value; (void)n;
+  const int l = locals->l.value; (void)l;
+  const int node_exists = locals->node_exists.value; (void)node_exists;
+
+  (void)n;
+  (void)l;
+  (void)node_exists;
+  (void)__parsec_tp; (void)locals;
+  return (!(node_exists) && ((l % 2)) == (1));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_walk_DOWN_for_RL_dep6_atline_140 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_walk_DOWN_for_RL_dep6_atline_140_fct }
+                   }
+};
+static const parsec_dep_t flow_of_walk_DOWN_for_RL_dep6_atline_140 = {
+  .cond = &expr_of_cond_for_flow_of_walk_DOWN_for_RL_dep6_atline_140,  /* (!(node_exists) && ((l % 2)) == (1)) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 1, /* walk_UP */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_walk_UP_for_RIGHT,
+  .dep_index = 4,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_walk_DOWN_for_RL,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+#if MAX_DEP_OUT_COUNT < 5  /* number of output dependencies */
+    #error Too many output dependencies (supports up to MAX_DEP_OUT_COUNT [=10] but found 5). Fix the code or recompile PaRSEC with a larger MAX_DEP_OUT_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_walk_DOWN_for_RL = {
+  .name               = "RL",
+  .sym_type           = PARSEC_SYM_INOUT,
+  .flow_flags         = PARSEC_FLOW_ACCESS_NONE|PARSEC_FLOW_HAS_IN_DEPS,
+  .flow_index         = 0,
+  .flow_datatype_mask = 0x1,
+  .dep_in     = { &flow_of_walk_DOWN_for_RL_dep1_atline_135 },
+  .dep_out    = { &flow_of_walk_DOWN_for_RL_dep2_atline_136,
+ &flow_of_walk_DOWN_for_RL_dep3_atline_137,
+ &flow_of_walk_DOWN_for_RL_dep4_atline_138,
+ &flow_of_walk_DOWN_for_RL_dep5_atline_139,
+ &flow_of_walk_DOWN_for_RL_dep6_atline_140 }
+};
+
+static void
+iterate_successors_of_walk_DOWN(parsec_execution_stream_t *es, const __parsec_walk_DOWN_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_walk_internal_taskpool_t *__parsec_tp = (const __parsec_walk_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_walk_DOWN_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_walk_DOWN_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int n = __jdf2c__tmp_locals.n.value; (void)n;
+  const int l = __jdf2c__tmp_locals.l.value; (void)l;
+  const int node_exists = __jdf2c__tmp_locals.node_exists.value; (void)node_exists;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)n;  (void)l;  (void)node_exists;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_tree(n, l);
+#endif
+  if( action_mask & 0x1f ) {  /* Flow of data RL [0] */
+    data.data   = this_task->data._f_RL.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x1 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  =   /* Control: always empty */ 0;
+    data.local.dst_count  =   /* Control: always empty */ 0;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = NULL;
+    data.remote.src_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.src_count  =   /* Control: always empty */ 0;
+    data.remote.dst_count  =   /* Control: always empty */ 0;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( node_exists ) {
+      __parsec_walk_DOWN_task_t* ncc = (__parsec_walk_DOWN_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[walk_DOWN.task_class_id];
+        const int DOWN_n = (n + 1);
+        if( (DOWN_n >= (0)) && (DOWN_n <= (31)) ) {
+          assert(&nc.locals[0].value == &ncc->locals.n.value);
+          ncc->locals.n.value = DOWN_n;
+          const int DOWN_l = (2 * l);
+          if( (DOWN_l >= (0)) && (DOWN_l <= ((1 << ncc->locals.n.value))) ) {
+            assert(&nc.locals[1].value == &ncc->locals.l.value);
+            ncc->locals.l.value = DOWN_l;
+            const int DOWN_node_exists = 1;
+            assert(&nc.locals[2].value == &ncc->locals.node_exists.value);
+            ncc->locals.node_exists.value = DOWN_node_exists;
+#if defined(DISTRIBUTED)
+            rank_dst = rank_of_tree(ncc->locals.n.value, ncc->locals.l.value);
+            if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+              vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_tree)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_tree, ncc->locals.n.value, ncc->locals.l.value);
+            nc.priority = __parsec_tp->super.super.priority;
+            successor_repo = DOWN_repo;
+            successor_repo_key = down_make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+          RELEASE_DEP_OUTPUT(es, "RL", this_task, "RL", &nc, rank_src, rank_dst, &data);
+          if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_walk_DOWN_for_RL_dep2_atline_136, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+            }
+          }
+    }
+  }
+  if( action_mask & 0x2 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  =   /* Control: always empty */ 0;
+    data.local.dst_count  =   /* Control: always empty */ 0;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = NULL;
+    data.remote.src_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.src_count  =   /* Control: always empty */ 0;
+    data.remote.dst_count  =   /* Control: always empty */ 0;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( node_exists ) {
+      __parsec_walk_DOWN_task_t* ncc = (__parsec_walk_DOWN_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[walk_DOWN.task_class_id];
+        const int DOWN_n = (n + 1);
+        if( (DOWN_n >= (0)) && (DOWN_n <= (31)) ) {
+          assert(&nc.locals[0].value == &ncc->locals.n.value);
+          ncc->locals.n.value = DOWN_n;
+          const int DOWN_l = ((2 * l) + 1);
+          if( (DOWN_l >= (0)) && (DOWN_l <= ((1 << ncc->locals.n.value))) ) {
+            assert(&nc.locals[1].value == &ncc->locals.l.value);
+            ncc->locals.l.value = DOWN_l;
+            const int DOWN_node_exists = 1;
+            assert(&nc.locals[2].value == &ncc->locals.node_exists.value);
+            ncc->locals.node_exists.value = DOWN_node_exists;
+#if defined(DISTRIBUTED)
+            rank_dst = rank_of_tree(ncc->locals.n.value, ncc->locals.l.value);
+            if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+              vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_tree)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_tree, ncc->locals.n.value, ncc->locals.l.value);
+            nc.priority = __parsec_tp->super.super.priority;
+            successor_repo = DOWN_repo;
+            successor_repo_key = down_make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+          RELEASE_DEP_OUTPUT(es, "RL", this_task, "RL", &nc, rank_src, rank_dst, &data);
+          if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_walk_DOWN_for_RL_dep3_atline_137, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+            }
+          }
+    }
+  }
+  if( action_mask & 0x4 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  =   /* Control: always empty */ 0;
+    data.local.dst_count  =   /* Control: always empty */ 0;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = NULL;
+    data.remote.src_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.src_count  =   /* Control: always empty */ 0;
+    data.remote.dst_count  =   /* Control: always empty */ 0;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( node_exists ) {
+      __parsec_walk_DO_DOWN_task_t* ncc = (__parsec_walk_DO_DOWN_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[walk_DO_DOWN.task_class_id];
+        const int DO_DOWN_n = n;
+        if( (DO_DOWN_n >= (0)) && (DO_DOWN_n <= (31)) ) {
+          assert(&nc.locals[0].value == &ncc->locals.n.value);
+          ncc->locals.n.value = DO_DOWN_n;
+          const int DO_DOWN_l = l;
+          if( (DO_DOWN_l >= (0)) && (DO_DOWN_l <= ((1 << ncc->locals.n.value))) ) {
+            assert(&nc.locals[1].value == &ncc->locals.l.value);
+            ncc->locals.l.value = DO_DOWN_l;
+#if defined(DISTRIBUTED)
+            rank_dst = rank_of_tree(ncc->locals.n.value, ncc->locals.l.value);
+            if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+              vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_tree)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_tree, ncc->locals.n.value, ncc->locals.l.value);
+            nc.priority = __parsec_tp->super.super.priority;
+            successor_repo = DO_DOWN_repo;
+            successor_repo_key = do_down_make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+          RELEASE_DEP_OUTPUT(es, "RL", this_task, "RL", &nc, rank_src, rank_dst, &data);
+          if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_walk_DOWN_for_RL_dep4_atline_138, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+            }
+          }
+    }
+  }
+  if( action_mask & 0x8 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  =   /* Control: always empty */ 0;
+    data.local.dst_count  =   /* Control: always empty */ 0;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = NULL;
+    data.remote.src_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.src_count  =   /* Control: always empty */ 0;
+    data.remote.dst_count  =   /* Control: always empty */ 0;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( (!(node_exists) && ((l % 2)) == (0)) ) {
+      __parsec_walk_UP_task_t* ncc = (__parsec_walk_UP_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[walk_UP.task_class_id];
+        const int UP_n = (n - 1);
+        if( (UP_n >= (0)) && (UP_n <= (31)) ) {
+          assert(&nc.locals[0].value == &ncc->locals.n.value);
+          ncc->locals.n.value = UP_n;
+          const int UP_l = (l / 2);
+          if( (UP_l >= (0)) && (UP_l <= ((1 << ncc->locals.n.value))) ) {
+            assert(&nc.locals[1].value == &ncc->locals.l.value);
+            ncc->locals.l.value = UP_l;
+#if defined(DISTRIBUTED)
+            rank_dst = rank_of_tree(ncc->locals.n.value, ncc->locals.l.value);
+            if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+              vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_tree)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_tree, ncc->locals.n.value, ncc->locals.l.value);
+            nc.priority = __parsec_tp->super.super.priority;
+            successor_repo = UP_repo;
+            successor_repo_key = up_make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+          RELEASE_DEP_OUTPUT(es, "RL", this_task, "LEFT", &nc, rank_src, rank_dst, &data);
+          if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_walk_DOWN_for_RL_dep5_atline_139, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+            }
+          }
+    }
+  }
+  if( action_mask & 0x10 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  =   /* Control: always empty */ 0;
+    data.local.dst_count  =   /* Control: always empty */ 0;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = NULL;
+    data.remote.src_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.src_count  =   /* Control: always empty */ 0;
+    data.remote.dst_count  =   /* Control: always empty */ 0;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( (!(node_exists) && ((l % 2)) == (1)) ) {
+      __parsec_walk_UP_task_t* ncc = (__parsec_walk_UP_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[walk_UP.task_class_id];
+        const int UP_n = (n - 1);
+        if( (UP_n >= (0)) && (UP_n <= (31)) ) {
+          assert(&nc.locals[0].value == &ncc->locals.n.value);
+          ncc->locals.n.value = UP_n;
+          const int UP_l = (l / 2);
+          if( (UP_l >= (0)) && (UP_l <= ((1 << ncc->locals.n.value))) ) {
+            assert(&nc.locals[1].value == &ncc->locals.l.value);
+            ncc->locals.l.value = UP_l;
+#if defined(DISTRIBUTED)
+            rank_dst = rank_of_tree(ncc->locals.n.value, ncc->locals.l.value);
+            if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+              vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_tree)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_tree, ncc->locals.n.value, ncc->locals.l.value);
+            nc.priority = __parsec_tp->super.super.priority;
+            successor_repo = UP_repo;
+            successor_repo_key = up_make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+          RELEASE_DEP_OUTPUT(es, "RL", this_task, "RIGHT", &nc, rank_src, rank_dst, &data);
+          if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_walk_DOWN_for_RL_dep6_atline_140, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+            }
+          }
+    }
+  }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static void
+iterate_predecessors_of_walk_DOWN(parsec_execution_stream_t *es, const __parsec_walk_DOWN_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_walk_internal_taskpool_t *__parsec_tp = (const __parsec_walk_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_walk_DOWN_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_walk_DOWN_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int n = __jdf2c__tmp_locals.n.value; (void)n;
+  const int l = __jdf2c__tmp_locals.l.value; (void)l;
+  const int node_exists = __jdf2c__tmp_locals.node_exists.value; (void)node_exists;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)n;  (void)l;  (void)node_exists;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_tree(n, l);
+#endif
+  if( action_mask & 0x1 ) {  /* Flow of data RL [0] */
+    data.data   = this_task->data._f_RL.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x1 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  =   /* Control: always empty */ 0;
+    data.local.dst_count  =   /* Control: always empty */ 0;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = NULL;
+    data.remote.src_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.src_count  =   /* Control: always empty */ 0;
+    data.remote.dst_count  =   /* Control: always empty */ 0;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( (n) > (0) ) {
+      __parsec_walk_DOWN_task_t* ncc = (__parsec_walk_DOWN_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[walk_DOWN.task_class_id];
+        const int DOWN_n = (n - 1);
+        if( (DOWN_n >= (0)) && (DOWN_n <= (31)) ) {
+          assert(&nc.locals[0].value == &ncc->locals.n.value);
+          ncc->locals.n.value = DOWN_n;
+          const int DOWN_l = (l / 2);
+          if( (DOWN_l >= (0)) && (DOWN_l <= ((1 << ncc->locals.n.value))) ) {
+            assert(&nc.locals[1].value == &ncc->locals.l.value);
+            ncc->locals.l.value = DOWN_l;
+            const int DOWN_node_exists = 1;
+            assert(&nc.locals[2].value == &ncc->locals.node_exists.value);
+            ncc->locals.node_exists.value = DOWN_node_exists;
+#if defined(DISTRIBUTED)
+            rank_dst = rank_of_tree(ncc->locals.n.value, ncc->locals.l.value);
+            if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+              vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_tree)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_tree, ncc->locals.n.value, ncc->locals.l.value);
+            nc.priority = __parsec_tp->super.super.priority;
+            successor_repo = DOWN_repo;
+            successor_repo_key = down_make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+          RELEASE_DEP_OUTPUT(es, "RL", this_task, "RL", &nc, rank_src, rank_dst, &data);
+          if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_walk_DOWN_for_RL_dep1_atline_135, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+            }
+          }
+    }
+  }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static int release_deps_of_walk_DOWN(parsec_execution_stream_t *es, __parsec_walk_DOWN_task_t *this_task, uint32_t action_mask, parsec_remote_deps_t *deps)
+{
+  PARSEC_PINS(es, RELEASE_DEPS_BEGIN, (parsec_task_t *)this_task);  const __parsec_walk_internal_taskpool_t *__parsec_tp = (const __parsec_walk_internal_taskpool_t *)this_task->taskpool;
+  parsec_release_dep_fct_arg_t arg;
+  int __vp_id;
+  int consume_local_repo = 0;
+  arg.action_mask = action_mask;
+  arg.output_entry = NULL;
+  arg.output_repo = NULL;
+#if defined(DISTRIBUTED)
+  arg.remote_deps = deps;
+#endif  /* defined(DISTRIBUTED) */
+  assert(NULL != es);
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS )    arg.ready_lists = alloca(sizeof(parsec_task_t *) * es->virtual_process->parsec_context->nb_vp);
+  else
+    arg.ready_lists = NULL;
+  for( __vp_id = 0; __vp_id < es->virtual_process->parsec_context->nb_vp; arg.ready_lists[__vp_id++] = NULL );
+  (void)__parsec_tp; (void)deps;
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+  }
+  consume_local_repo = (this_task->repo_entry != NULL);
+  arg.output_repo = DOWN_repo;
+  arg.output_entry = this_task->repo_entry;
+  arg.output_usage = 0;
+  if( action_mask & (PARSEC_ACTION_RELEASE_LOCAL_DEPS | PARSEC_ACTION_GET_REPO_ENTRY) ) {
+    arg.output_entry = data_repo_lookup_entry_and_create( es, arg.output_repo, down_make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    arg.output_entry->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(arg.output_entry->sim_exec_date == 0);
+    arg.output_entry->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  if(action_mask & ( PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE ) ){
+    /* Generate the reshape promise for the outputs that need it */
+    iterate_successors_of_walk_DOWN(es, this_task, action_mask, parsec_set_up_reshape_promise, &arg);
+   }
+  iterate_successors_of_walk_DOWN(es, this_task, action_mask, parsec_release_dep_fct, &arg);
+
+#if defined(DISTRIBUTED)
+  if( (action_mask & PARSEC_ACTION_SEND_REMOTE_DEPS) && (NULL != arg.remote_deps)) {
+    parsec_remote_dep_activate(es, (parsec_task_t *)this_task, arg.remote_deps, arg.remote_deps->outgoing_mask);
+  }
+#endif
+
+  if(action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS) {
+    data_repo_entry_addto_usage_limit(DOWN_repo, arg.output_entry->ht_item.key, arg.output_usage);
+    __parsec_schedule_vp(es, arg.ready_lists, 0);
+  }
+      if (consume_local_repo) {
+         data_repo_entry_used_once( DOWN_repo, this_task->repo_entry->ht_item.key );
+      }
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+  }
+  PARSEC_PINS(es, RELEASE_DEPS_END, (parsec_task_t *)this_task);  return 0;
+}
+
+static int data_lookup_of_walk_DOWN(parsec_execution_stream_t *es, __parsec_walk_DOWN_task_t *this_task)
+{
+  const __parsec_walk_internal_taskpool_t *__parsec_tp = (__parsec_walk_internal_taskpool_t *)this_task->taskpool;
+  parsec_assignment_t generic_locals[MAX_PARAM_COUNT];  /* generic task locals */
+  int target_device = 0; (void)target_device;
+  (void)__parsec_tp; (void)generic_locals; (void)es;
+  parsec_data_copy_t *chunk = NULL;
+  data_repo_t        *reshape_repo  = NULL, *consumed_repo  = NULL;
+  data_repo_entry_t  *reshape_entry = NULL, *consumed_entry = NULL;
+  parsec_key_t        reshape_entry_key = 0, consumed_entry_key = 0;
+  uint8_t             consumed_flow_index;
+  parsec_dep_data_description_t data;
+  int ret;
+  (void)reshape_repo; (void)reshape_entry; (void)reshape_entry_key;
+  (void)consumed_repo; (void)consumed_entry; (void)consumed_entry_key;
+  (void)consumed_flow_index;
+  (void)chunk; (void)data; (void)ret;
+  const int n = this_task->locals.n.value; (void)n;
+  const int l = this_task->locals.l.value; (void)l;
+  const int node_exists = this_task->locals.node_exists.value; (void)node_exists;
+  if( NULL == this_task->repo_entry ){
+    this_task->repo_entry = data_repo_lookup_entry_and_create(es, DOWN_repo,                                       down_make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    data_repo_entry_addto_usage_limit(DOWN_repo, this_task->repo_entry->ht_item.key, 1);    this_task->repo_entry ->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(this_task->repo_entry ->sim_exec_date == 0);
+    this_task->repo_entry ->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  /* The reshape repo is the current task repo. */  reshape_repo = DOWN_repo;
+  reshape_entry_key = down_make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals) ;
+  reshape_entry = this_task->repo_entry;
+  /* Lookup the input data, and store them in the context if any */
+  /* RL is a control flow */
+  this_task->data._f_RL.data_in         = NULL;
+  this_task->data._f_RL.data_out        = NULL;
+  this_task->data._f_RL.source_repo       = NULL;
+  this_task->data._f_RL.source_repo_entry = NULL;
+  /** Generate profiling information */
+#if defined(PARSEC_PROF_TRACE)
+  this_task->prof_info.desc = (parsec_data_collection_t*)__parsec_tp->super._g_tree;
+  this_task->prof_info.priority = this_task->priority;
+  this_task->prof_info.data_id   = ((parsec_data_collection_t*)__parsec_tp->super._g_tree)->data_key((parsec_data_collection_t*)__parsec_tp->super._g_tree, n, l);
+  this_task->prof_info.task_class_id = this_task->task_class->task_class_id;
+  this_task->prof_info.task_return_code = -1;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int datatype_lookup_of_walk_DOWN(parsec_execution_stream_t *es, const parsec_task_t *this_generic_task, const parsec_task_t *parent_task,
+              uint32_t* flow_mask, parsec_dep_data_description_t* data)
+{
+  const __parsec_walk_DOWN_task_t *this_task = (__parsec_walk_DOWN_task_t*)this_generic_task;
+  const __parsec_walk_internal_taskpool_t *__parsec_tp = (__parsec_walk_internal_taskpool_t *)this_task->taskpool;
+  (void)__parsec_tp; (void)es; (void)this_task; (void)data; (void)parent_task;
+  const int n = this_task->locals.n.value; (void)n;
+  const int l = this_task->locals.l.value; (void)l;
+  const int node_exists = this_task->locals.node_exists.value; (void)node_exists;
+  data->local.arena = data->remote.arena = NULL;
+  data->local.src_datatype  = data->local.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->local.src_count     = data->local.dst_count = 0;
+  data->local.src_displ     = data->local.dst_displ = 0;
+  data->data_future  = NULL;
+
+  /* these are the output dependencies remote datatypes */
+  data->data                             = NULL;
+  data->remote.src_datatype = data->remote.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->remote.src_count    = data->remote.dst_count = 0;
+  data->remote.src_displ    = data->remote.dst_displ = 0;
+  data->data_future  = NULL;
+  (*flow_mask) = 0;  /* nothing left */
+  (void)n;  (void)l;  (void)node_exists;
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+static int hook_of_walk_DOWN(parsec_execution_stream_t *es, __parsec_walk_DOWN_task_t *this_task)
+{
+  __parsec_walk_internal_taskpool_t *__parsec_tp = (__parsec_walk_internal_taskpool_t *)this_task->taskpool;
+  (void)es; (void)__parsec_tp;
+  const int n = this_task->locals.n.value; (void)n;
+  const int l = this_task->locals.l.value; (void)l;
+  const int node_exists = this_task->locals.node_exists.value; (void)node_exists;
+  (void)n;  (void)l;  (void)node_exists;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                                  DOWN BODY                                    -----*/
+
+{
+    if( verbose ) {
+        int rank = (((parsec_data_collection_t*)__parsec_tp->super._g_tree)->rank_of((parsec_data_collection_t*)__parsec_tp->super._g_tree, n, l));
+        fprintf(stderr, "CALLING DOWN(%d, %d) on rank %d\n", n, l, rank);
+    }
+
+    if( !tree_dist_has_node(tree, n, l) ) {
+        if( verbose ) {
+            int rank = (((parsec_data_collection_t*)__parsec_tp->super._g_tree)->rank_of((parsec_data_collection_t*)__parsec_tp->super._g_tree, n, l));
+            fprintf(stderr, "Node (%d, %d) does not exist on rank %d\n", n, l, rank);
+        }
+        this_task->locals.node_exists.value = 0;
+    }
+}
+
+/*-----                                END OF DOWN BODY                                -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#endif  /*  defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+static int complete_hook_of_walk_DOWN(parsec_execution_stream_t *es, __parsec_walk_DOWN_task_t *this_task)
+{
+  const __parsec_walk_internal_taskpool_t *__parsec_tp = (__parsec_walk_internal_taskpool_t *)this_task->taskpool;
+#if defined(DISTRIBUTED)
+    const int n = this_task->locals.n.value; (void)n;
+  const int l = this_task->locals.l.value; (void)l;
+  const int node_exists = this_task->locals.node_exists.value; (void)node_exists;
+#endif  /* defined(DISTRIBUTED) */
+  (void)es; (void)__parsec_tp;
+parsec_data_t* data_t_desc = NULL; (void)data_t_desc;
+#if defined(DISTRIBUTED)
+  /** If not working on distributed, there is no risk that data is not in place */
+  (void)n;  (void)l;  (void)node_exists;
+
+#endif /* DISTRIBUTED */
+#if defined(PARSEC_PROF_GRAPHER)
+  parsec_prof_grapher_task((parsec_task_t*)this_task, es->th_id, es->virtual_process->vp_id,
+     __jdf2c_key_fns_DOWN.key_hash(this_task->task_class->make_key( (parsec_taskpool_t*)this_task->taskpool, ((parsec_task_t*)this_task)->locals), NULL));
+#endif  /* defined(PARSEC_PROF_GRAPHER) */
+  release_deps_of_walk_DOWN(es, this_task,
+      PARSEC_ACTION_RELEASE_REMOTE_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_REFS |
+      PARSEC_ACTION_RESHAPE_ON_RELEASE |
+      0x1f,  /* mask of all dep_index */ 
+      NULL);
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static parsec_hook_return_t release_task_of_walk_DOWN(parsec_execution_stream_t *es, parsec_task_t *this_task)
+{
+    const __parsec_walk_internal_taskpool_t *__parsec_tp =
+        (const __parsec_walk_internal_taskpool_t *)this_task->taskpool;
+    parsec_hash_table_t *ht = (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[2];
+    parsec_key_t key = this_task->task_class->make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals);
+    parsec_hashable_dependency_t *hash_dep = (parsec_hashable_dependency_t *)parsec_hash_table_remove(ht, key);
+    /* Must test for NULL, as user-provided startup tasks may not have a dep in the hash table */
+    if(NULL != hash_dep) parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);
+    if( (PARSEC_UNDETERMINED_NB_TASKS == __parsec_tp->super.super.nb_tasks) ||
+        (0 == __parsec_tp->super.super.nb_tasks) ||
+        (PARSEC_RUNTIME_RESERVED_NB_TASKS == __parsec_tp->super.super.nb_tasks) ) {
+        /* don't spend time counting */
+        return parsec_release_task_to_mempool(es, this_task);
+    }
+    return parsec_release_task_to_mempool_update_nbtasks(es, this_task);
+}
+
+static char *walk_walk_DOWN_internal_init_deps_key_functions_key_print(char *buffer, size_t buffer_size, parsec_key_t k, void *user_data)
+{
+  (void)user_data;
+  snprintf(buffer, buffer_size, "(%llu)", (unsigned long long int)k);
+  return buffer;
+}
+
+static parsec_key_fn_t walk_walk_DOWN_internal_init_deps_key_functions = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = walk_walk_DOWN_internal_init_deps_key_functions_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/* Needs: - - - */
+static int walk_DOWN_internal_init(parsec_execution_stream_t * es, __parsec_walk_DOWN_task_t * this_task)
+{
+  __parsec_walk_internal_taskpool_t *__parsec_tp = (__parsec_walk_internal_taskpool_t*)this_task->taskpool;
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+  PARSEC_PROFILING_TRACE(es->es_profile,
+                         this_task->taskpool->profiling_array[START_KEY(this_task->task_class->task_class_id)],
+                         0,
+                         this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    do {
+      this_task->super.list_next = (parsec_list_item_t*)__parsec_tp->startup_queue;
+    } while(!parsec_atomic_cas_ptr(&__parsec_tp->startup_queue, (parsec_list_item_t*)this_task->super.list_next, this_task));
+    this_task->status = PARSEC_TASK_STATUS_HOOK;
+
+  PARSEC_AYU_REGISTER_TASK(&walk_DOWN);
+  __parsec_tp->super.super.dependencies_array[2] = PARSEC_OBJ_NEW(parsec_hash_table_t);
+  parsec_hash_table_init(__parsec_tp->super.super.dependencies_array[2], offsetof(parsec_hashable_dependency_t, ht_item), 10, walk_walk_DOWN_internal_init_deps_key_functions, this_task->taskpool);
+  __parsec_tp->repositories[2] = data_repo_create_nothreadsafe(PARSEC_DEFAULT_DATAREPO_HASH_LENGTH, __jdf2c_key_fns_DOWN, (parsec_taskpool_t*)__parsec_tp, 1);
+   (void)__parsec_tp; (void)es;
+  if(1 == parsec_atomic_fetch_dec_int32(&__parsec_tp->sync_point)) {
+    /* Last initialization task complete. Update the number of tasks. */
+    __parsec_tp->super.super.tdm.module->taskpool_addto_nb_tasks(&__parsec_tp->super.super, undetermined_nb_tasks(__parsec_tp));
+    parsec_mfence();  /* write memory barrier to guarantee that the scheduler gets the correct number of tasks */
+    parsec_taskpool_enable((parsec_taskpool_t*)__parsec_tp, &__parsec_tp->startup_queue,
+                           (parsec_task_t*)this_task, es, __parsec_tp->super.super.nb_pending_actions);
+    __parsec_tp->super.super.tdm.module->taskpool_ready(&__parsec_tp->super.super);
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+    PARSEC_PROFILING_TRACE(es->es_profile,
+                           this_task->taskpool->profiling_array[2 * this_task->task_class->task_class_id + 1],
+                           0,
+                           this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    if( 1 >= __parsec_tp->super.super.nb_pending_actions ) {
+        /* if no tasks will be generated let's prevent the runtime from calling the hook and instead go directly to complete the task */
+        this_task->status = PARSEC_TASK_STATUS_COMPLETE;
+    }
+    return PARSEC_HOOK_RETURN_DONE;
+  }
+  return PARSEC_HOOK_RETURN_ASYNC;
+}
+
+static const __parsec_chore_t __walk_DOWN_chores[] ={
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+    { .type     = PARSEC_DEV_CPU,
+      .evaluate = (parsec_evaluate_function_t*)NULL,
+      .hook     = (parsec_hook_t*)hook_of_walk_DOWN },
+#endif  /* defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+    { .type     = PARSEC_DEV_NONE,
+      .evaluate = NULL,
+      .hook     = (parsec_hook_t*)NULL },  /* End marker */
+};
+
+static const parsec_task_class_t walk_DOWN = {
+  .name = "DOWN",
+  .task_class_id = 2,
+  .nb_flows = 1,
+  .nb_parameters = 2,
+  .nb_locals = 3,
+  .task_class_type = PARSEC_TASK_CLASS_TYPE_PTG,
+  .params = { &symb_walk_DOWN_n, &symb_walk_DOWN_l, NULL },
+  .locals = { &symb_walk_DOWN_n, &symb_walk_DOWN_l, &symb_walk_DOWN_node_exists, NULL },
+  .data_affinity = (parsec_data_ref_fn_t*)affinity_of_walk_DOWN,
+  .initial_data = (parsec_data_ref_fn_t*)affinity_of_walk_DOWN,
+  .final_data = (parsec_data_ref_fn_t*)affinity_of_walk_DOWN,
+  .priority = NULL,
+  .properties = properties_of_walk_DOWN,
+#if MAX_PARAM_COUNT < 0  /* number of read flows of DOWN */
+  #error Too many read flows for task DOWN
+#endif  /* MAX_PARAM_COUNT */
+#if MAX_PARAM_COUNT < 0  /* number of write flows of DOWN */
+  #error Too many write flows for task DOWN
+#endif  /* MAX_PARAM_COUNT */
+  .in = { &flow_of_walk_DOWN_for_RL, NULL },
+  .out = { &flow_of_walk_DOWN_for_RL, NULL },
+  .flags = 0x0 | PARSEC_HAS_IN_IN_DEPENDENCIES | PARSEC_USE_DEPS_MASK,
+  .dependencies_goal = 0x1,
+  .make_key = down_make_key,
+  .task_snprintf = parsec_task_snprintf,
+#if defined(PARSEC_PROF_TRACE)
+  .profile_info = &parsec_task_profile_info,
+#endif
+  .key_functions = &__jdf2c_key_fns_DOWN,
+  .fini = (parsec_hook_t*)NULL,
+  .incarnations = __walk_DOWN_chores,
+  .find_deps = parsec_hash_find_deps,
+  .update_deps = parsec_update_deps_with_mask,
+  .iterate_successors = (parsec_traverse_function_t*)iterate_successors_of_walk_DOWN,
+  .iterate_predecessors = (parsec_traverse_function_t*)iterate_predecessors_of_walk_DOWN,
+  .release_deps = (parsec_release_deps_t*)release_deps_of_walk_DOWN,
+  .prepare_output = (parsec_hook_t*)NULL,
+  .prepare_input = (parsec_hook_t*)data_lookup_of_walk_DOWN,
+  .time_estimate = NULL,
+  .get_datatype = datatype_lookup_of_walk_DOWN,
+  .complete_execution = (parsec_hook_t*)complete_hook_of_walk_DOWN,
+  .release_task = &release_task_of_walk_DOWN,
+#if defined(PARSEC_SIM)
+  .sim_cost_fct = (parsec_sim_cost_fct_t*)NULL,
+#endif
+};
+
+
+/******                                      UP                                      ******/
+
+static inline int32_t minexpr_of_symb_walk_UP_n_fct(const __parsec_walk_internal_taskpool_t *__parsec_tp, const __parsec_walk_UP_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_walk_UP_n = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_walk_UP_n_fct }
+                   }
+};
+static inline int32_t maxexpr_of_symb_walk_UP_n_fct(const __parsec_walk_internal_taskpool_t *__parsec_tp, const __parsec_walk_UP_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 31;
+}
+static const parsec_expr_t maxexpr_of_symb_walk_UP_n = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_walk_UP_n_fct }
+                   }
+};
+static const parsec_symbol_t symb_walk_UP_n = { .name = "n", .context_index = 0, .min = &minexpr_of_symb_walk_UP_n, .max = &maxexpr_of_symb_walk_UP_n, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int32_t minexpr_of_symb_walk_UP_l_fct(const __parsec_walk_internal_taskpool_t *__parsec_tp, const __parsec_walk_UP_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_walk_UP_l = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_walk_UP_l_fct }
+                   }
+};
+static inline int maxexpr_of_symb_walk_UP_l_fct(const __parsec_walk_internal_taskpool_t *__parsec_tp, const __parsec_walk_UP_parsec_assignment_t *locals)
+{
+  const int n = locals->n.value;
+  const int l = locals->l.value; (void)l;
+
+  (void)n;
+  (void)l;
+  (void)__parsec_tp; (void)locals;
+  return (1 << n);
+}
+static const parsec_expr_t maxexpr_of_symb_walk_UP_l = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_walk_UP_l_fct }
+                   }
+};
+static const parsec_symbol_t symb_walk_UP_l = { .name = "l", .context_index = 1, .min = &minexpr_of_symb_walk_UP_l, .max = &maxexpr_of_symb_walk_UP_l, .cst_inc = 1, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int affinity_of_walk_UP(const __parsec_walk_UP_task_t *this_task,
+                     parsec_data_ref_t *ref)
+{
+    const __parsec_walk_internal_taskpool_t *__parsec_tp = (const __parsec_walk_internal_taskpool_t*)this_task->taskpool;
+  const int n = this_task->locals.n.value; (void)n;
+  const int l = this_task->locals.l.value; (void)l;
+
+  /* Silent Warnings: should look into predicate to know what variables are usefull */
+  (void)n;
+  (void)l;
+  ref->dc = (parsec_data_collection_t *)__parsec_tp->super._g_tree;
+  /* Compute data key */
+  ref->key = ref->dc->data_key(ref->dc, n, l);
+  return 1;
+}
+static const parsec_property_t properties_of_walk_UP[1] = {
+  {.name = NULL, .expr = NULL}
+};
+static const parsec_dep_t flow_of_walk_UP_for_NODE_dep1_atline_93 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 3, /* walk_DO_DOWN */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_walk_DO_DOWN_for_NODE,
+  .dep_index = 2,
+  .dep_datatype_index = 2,
+  .belongs_to = &flow_of_walk_UP_for_NODE,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_walk_UP_for_NODE = {
+  .name               = "NODE",
+  .sym_type           = PARSEC_SYM_IN,
+  .flow_flags         = PARSEC_FLOW_ACCESS_READ,
+  .flow_index         = 0,
+  .flow_datatype_mask = 0x0,
+  .dep_in     = { &flow_of_walk_UP_for_NODE_dep1_atline_93 },
+  .dep_out    = { NULL }
+};
+
+static inline int32_t expr_of_cond_for_flow_of_walk_UP_for_LEFT_dep1_atline_79_iftrue_fct(const __parsec_walk_internal_taskpool_t *__parsec_tp, const __parsec_walk_UP_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 1;
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_walk_UP_for_LEFT_dep1_atline_79_iftrue = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_walk_UP_for_LEFT_dep1_atline_79_iftrue_fct }
+                   }
+};
+static const parsec_dep_t flow_of_walk_UP_for_LEFT_dep1_atline_79_iftrue = {
+  .cond = &expr_of_cond_for_flow_of_walk_UP_for_LEFT_dep1_atline_79_iftrue,  /* 1 */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 1, /* walk_UP */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_walk_UP_for_RL,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_walk_UP_for_LEFT,
+};
+static inline int expr_of_cond_for_flow_of_walk_UP_for_LEFT_dep1_atline_79_iffalse_fct(const __parsec_walk_internal_taskpool_t *__parsec_tp, const __parsec_walk_UP_parsec_assignment_t *locals)
+{
+
+
+;
+  (void)__parsec_tp; (void)locals;
+  return !(1);
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_walk_UP_for_LEFT_dep1_atline_79_iffalse = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_walk_UP_for_LEFT_dep1_atline_79_iffalse_fct }
+                   }
+};
+static const parsec_dep_t flow_of_walk_UP_for_LEFT_dep1_atline_79_iffalse = {
+  .cond = &expr_of_cond_for_flow_of_walk_UP_for_LEFT_dep1_atline_79_iffalse,  /* !1 */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 2, /* walk_DOWN */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_walk_DOWN_for_RL,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_walk_UP_for_LEFT,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_walk_UP_for_LEFT = {
+  .name               = "LEFT",
+  .sym_type           = PARSEC_SYM_IN,
+  .flow_flags         = PARSEC_FLOW_ACCESS_NONE,
+  .flow_index         = 1,
+  .flow_datatype_mask = 0x0,
+  .dep_in     = { &flow_of_walk_UP_for_LEFT_dep1_atline_79_iftrue,
+ &flow_of_walk_UP_for_LEFT_dep1_atline_79_iffalse },
+  .dep_out    = { NULL }
+};
+
+static inline int32_t expr_of_cond_for_flow_of_walk_UP_for_RIGHT_dep1_atline_84_iftrue_fct(const __parsec_walk_internal_taskpool_t *__parsec_tp, const __parsec_walk_UP_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 1;
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_walk_UP_for_RIGHT_dep1_atline_84_iftrue = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_walk_UP_for_RIGHT_dep1_atline_84_iftrue_fct }
+                   }
+};
+static const parsec_dep_t flow_of_walk_UP_for_RIGHT_dep1_atline_84_iftrue = {
+  .cond = &expr_of_cond_for_flow_of_walk_UP_for_RIGHT_dep1_atline_84_iftrue,  /* 1 */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 1, /* walk_UP */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_walk_UP_for_RL,
+  .dep_index = 1,
+  .dep_datatype_index = 1,
+  .belongs_to = &flow_of_walk_UP_for_RIGHT,
+};
+static inline int expr_of_cond_for_flow_of_walk_UP_for_RIGHT_dep1_atline_84_iffalse_fct(const __parsec_walk_internal_taskpool_t *__parsec_tp, const __parsec_walk_UP_parsec_assignment_t *locals)
+{
+
+
+;
+  (void)__parsec_tp; (void)locals;
+  return !(1);
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_walk_UP_for_RIGHT_dep1_atline_84_iffalse = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_walk_UP_for_RIGHT_dep1_atline_84_iffalse_fct }
+                   }
+};
+static const parsec_dep_t flow_of_walk_UP_for_RIGHT_dep1_atline_84_iffalse = {
+  .cond = &expr_of_cond_for_flow_of_walk_UP_for_RIGHT_dep1_atline_84_iffalse,  /* !1 */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 2, /* walk_DOWN */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_walk_DOWN_for_RL,
+  .dep_index = 1,
+  .dep_datatype_index = 1,
+  .belongs_to = &flow_of_walk_UP_for_RIGHT,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_walk_UP_for_RIGHT = {
+  .name               = "RIGHT",
+  .sym_type           = PARSEC_SYM_IN,
+  .flow_flags         = PARSEC_FLOW_ACCESS_NONE,
+  .flow_index         = 2,
+  .flow_datatype_mask = 0x0,
+  .dep_in     = { &flow_of_walk_UP_for_RIGHT_dep1_atline_84_iftrue,
+ &flow_of_walk_UP_for_RIGHT_dep1_atline_84_iffalse },
+  .dep_out    = { NULL }
+};
+
+static inline int expr_of_cond_for_flow_of_walk_UP_for_RL_dep1_atline_89_fct(const __parsec_walk_internal_taskpool_t *__parsec_tp, const __parsec_walk_UP_parsec_assignment_t *locals)
+{
+  const int n = locals->n.value; (void)n;
+  const int l = locals->l.value; (void)l;
+
+  (void)n;
+  (void)l;
+  (void)__parsec_tp; (void)locals;
+  return (((l % 2)) == (0) && (n) > (0));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_walk_UP_for_RL_dep1_atline_89 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_walk_UP_for_RL_dep1_atline_89_fct }
+                   }
+};
+static const parsec_dep_t flow_of_walk_UP_for_RL_dep1_atline_89 = {
+  .cond = &expr_of_cond_for_flow_of_walk_UP_for_RL_dep1_atline_89,  /* (((l % 2)) == (0) && (n) > (0)) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 1, /* walk_UP */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_walk_UP_for_LEFT,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_walk_UP_for_RL,
+};
+static inline int expr_of_cond_for_flow_of_walk_UP_for_RL_dep2_atline_90_fct(const __parsec_walk_internal_taskpool_t *__parsec_tp, const __parsec_walk_UP_parsec_assignment_t *locals)
+{
+  const int n = locals->n.value; (void)n;
+  const int l = locals->l.value; (void)l;
+
+  (void)n;
+  (void)l;
+  (void)__parsec_tp; (void)locals;
+  return (((l % 2)) == (1) && (n) > (0));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_walk_UP_for_RL_dep2_atline_90 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_walk_UP_for_RL_dep2_atline_90_fct }
+                   }
+};
+static const parsec_dep_t flow_of_walk_UP_for_RL_dep2_atline_90 = {
+  .cond = &expr_of_cond_for_flow_of_walk_UP_for_RL_dep2_atline_90,  /* (((l % 2)) == (1) && (n) > (0)) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 1, /* walk_UP */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_walk_UP_for_RIGHT,
+  .dep_index = 1,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_walk_UP_for_RL,
+};
+static inline int expr_of_cond_for_flow_of_walk_UP_for_RL_dep3_atline_91_fct(const __parsec_walk_internal_taskpool_t *__parsec_tp, const __parsec_walk_UP_parsec_assignment_t *locals)
+{
+  const int n = locals->n.value;
+  const int l = locals->l.value; (void)l;
+
+  (void)n;
+  (void)l;
+  (void)__parsec_tp; (void)locals;
+  return (n) == (0);
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_walk_UP_for_RL_dep3_atline_91 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_walk_UP_for_RL_dep3_atline_91_fct }
+                   }
+};
+static const parsec_dep_t flow_of_walk_UP_for_RL_dep3_atline_91 = {
+  .cond = &expr_of_cond_for_flow_of_walk_UP_for_RL_dep3_atline_91,  /* (n) == (0) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 0, /* walk_BCAST_UP */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_walk_BCAST_UP_for_RL,
+  .dep_index = 2,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_walk_UP_for_RL,
+};
+#if MAX_DEP_OUT_COUNT < 3  /* number of output dependencies */
+    #error Too many output dependencies (supports up to MAX_DEP_OUT_COUNT [=10] but found 3). Fix the code or recompile PaRSEC with a larger MAX_DEP_OUT_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_walk_UP_for_RL = {
+  .name               = "RL",
+  .sym_type           = PARSEC_SYM_OUT,
+  .flow_flags         = PARSEC_FLOW_ACCESS_NONE,
+  .flow_index         = 3,
+  .flow_datatype_mask = 0x1,
+  .dep_in     = { NULL },
+  .dep_out    = { &flow_of_walk_UP_for_RL_dep1_atline_89,
+ &flow_of_walk_UP_for_RL_dep2_atline_90,
+ &flow_of_walk_UP_for_RL_dep3_atline_91 }
+};
+
+static void
+iterate_successors_of_walk_UP(parsec_execution_stream_t *es, const __parsec_walk_UP_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_walk_internal_taskpool_t *__parsec_tp = (const __parsec_walk_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_walk_UP_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_walk_UP_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int n = __jdf2c__tmp_locals.n.value; (void)n;
+  const int l = __jdf2c__tmp_locals.l.value; (void)l;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)n;  (void)l;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_tree(n, l);
+#endif
+  /* Flow of data NODE has only IN dependencies */
+  /* Flow of data LEFT has only IN dependencies */
+  /* Flow of data RIGHT has only IN dependencies */
+  if( action_mask & 0x7 ) {  /* Flow of data RL [3] */
+    data.data   = this_task->data._f_RL.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x1 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  =   /* Control: always empty */ 0;
+    data.local.dst_count  =   /* Control: always empty */ 0;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = NULL;
+    data.remote.src_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.src_count  =   /* Control: always empty */ 0;
+    data.remote.dst_count  =   /* Control: always empty */ 0;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( (((l % 2)) == (0) && (n) > (0)) ) {
+      __parsec_walk_UP_task_t* ncc = (__parsec_walk_UP_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[walk_UP.task_class_id];
+        const int UP_n = (n - 1);
+        if( (UP_n >= (0)) && (UP_n <= (31)) ) {
+          assert(&nc.locals[0].value == &ncc->locals.n.value);
+          ncc->locals.n.value = UP_n;
+          const int UP_l = (l / 2);
+          if( (UP_l >= (0)) && (UP_l <= ((1 << ncc->locals.n.value))) ) {
+            assert(&nc.locals[1].value == &ncc->locals.l.value);
+            ncc->locals.l.value = UP_l;
+#if defined(DISTRIBUTED)
+            rank_dst = rank_of_tree(ncc->locals.n.value, ncc->locals.l.value);
+            if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+              vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_tree)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_tree, ncc->locals.n.value, ncc->locals.l.value);
+            nc.priority = __parsec_tp->super.super.priority;
+            successor_repo = UP_repo;
+            successor_repo_key = up_make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+          RELEASE_DEP_OUTPUT(es, "RL", this_task, "LEFT", &nc, rank_src, rank_dst, &data);
+          if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_walk_UP_for_RL_dep1_atline_89, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+            }
+          }
+    }
+  }
+  if( action_mask & 0x2 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  =   /* Control: always empty */ 0;
+    data.local.dst_count  =   /* Control: always empty */ 0;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = NULL;
+    data.remote.src_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.src_count  =   /* Control: always empty */ 0;
+    data.remote.dst_count  =   /* Control: always empty */ 0;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( (((l % 2)) == (1) && (n) > (0)) ) {
+      __parsec_walk_UP_task_t* ncc = (__parsec_walk_UP_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[walk_UP.task_class_id];
+        const int UP_n = (n - 1);
+        if( (UP_n >= (0)) && (UP_n <= (31)) ) {
+          assert(&nc.locals[0].value == &ncc->locals.n.value);
+          ncc->locals.n.value = UP_n;
+          const int UP_l = (l / 2);
+          if( (UP_l >= (0)) && (UP_l <= ((1 << ncc->locals.n.value))) ) {
+            assert(&nc.locals[1].value == &ncc->locals.l.value);
+            ncc->locals.l.value = UP_l;
+#if defined(DISTRIBUTED)
+            rank_dst = rank_of_tree(ncc->locals.n.value, ncc->locals.l.value);
+            if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+              vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_tree)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_tree, ncc->locals.n.value, ncc->locals.l.value);
+            nc.priority = __parsec_tp->super.super.priority;
+            successor_repo = UP_repo;
+            successor_repo_key = up_make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+          RELEASE_DEP_OUTPUT(es, "RL", this_task, "RIGHT", &nc, rank_src, rank_dst, &data);
+          if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_walk_UP_for_RL_dep2_atline_90, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+            }
+          }
+    }
+  }
+  if( action_mask & 0x4 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  =   /* Control: always empty */ 0;
+    data.local.dst_count  =   /* Control: always empty */ 0;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = NULL;
+    data.remote.src_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.src_count  =   /* Control: always empty */ 0;
+    data.remote.dst_count  =   /* Control: always empty */ 0;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( (n) == (0) ) {
+      __parsec_walk_BCAST_UP_task_t* ncc = (__parsec_walk_BCAST_UP_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[walk_BCAST_UP.task_class_id];
+        int BCAST_UP_rank;
+      for( BCAST_UP_rank = 0;BCAST_UP_rank <= (NP - 1); BCAST_UP_rank+=1) {
+          if( (BCAST_UP_rank >= (0)) && (BCAST_UP_rank <= ((NP - 1))) ) {
+            assert(&nc.locals[0].value == &ncc->locals.rank.value);
+            ncc->locals.rank.value = BCAST_UP_rank;
+#if defined(DISTRIBUTED)
+            rank_dst = rank_of_fakeDesc(ncc->locals.rank.value, ncc->locals.rank.value);
+            if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+              vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_fakeDesc)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_fakeDesc, ncc->locals.rank.value, ncc->locals.rank.value);
+            nc.priority = __parsec_tp->super.super.priority;
+            successor_repo = BCAST_UP_repo;
+            successor_repo_key = __jdf2c_make_key_BCAST_UP((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+          RELEASE_DEP_OUTPUT(es, "RL", this_task, "RL", &nc, rank_src, rank_dst, &data);
+          if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_walk_UP_for_RL_dep3_atline_91, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+            }
+          }
+    }
+  }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static void
+iterate_predecessors_of_walk_UP(parsec_execution_stream_t *es, const __parsec_walk_UP_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_walk_internal_taskpool_t *__parsec_tp = (const __parsec_walk_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_walk_UP_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_walk_UP_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int n = __jdf2c__tmp_locals.n.value; (void)n;
+  const int l = __jdf2c__tmp_locals.l.value; (void)l;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)n;  (void)l;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_tree(n, l);
+#endif
+  if( action_mask & 0x4 ) {  /* Flow of data NODE [0] */
+    data.data   = this_task->data._f_NODE.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x4 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_walk_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_walk_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        __parsec_walk_DO_DOWN_task_t* ncc = (__parsec_walk_DO_DOWN_task_t*)&nc;
+    nc.task_class = __parsec_tp->super.super.task_classes_array[walk_DO_DOWN.task_class_id];
+      const int DO_DOWN_n = n;
+      if( (DO_DOWN_n >= (0)) && (DO_DOWN_n <= (31)) ) {
+        assert(&nc.locals[0].value == &ncc->locals.n.value);
+        ncc->locals.n.value = DO_DOWN_n;
+        const int DO_DOWN_l = l;
+        if( (DO_DOWN_l >= (0)) && (DO_DOWN_l <= ((1 << ncc->locals.n.value))) ) {
+          assert(&nc.locals[1].value == &ncc->locals.l.value);
+          ncc->locals.l.value = DO_DOWN_l;
+#if defined(DISTRIBUTED)
+          rank_dst = rank_of_tree(ncc->locals.n.value, ncc->locals.l.value);
+          if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+            vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_tree)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_tree, ncc->locals.n.value, ncc->locals.l.value);
+          nc.priority = __parsec_tp->super.super.priority;
+          successor_repo = DO_DOWN_repo;
+          successor_repo_key = do_down_make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+        RELEASE_DEP_OUTPUT(es, "NODE", this_task, "NODE", &nc, rank_src, rank_dst, &data);
+        if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_walk_UP_for_NODE_dep1_atline_93, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+          }
+        }
+  }
+  }
+  if( action_mask & 0x1 ) {  /* Flow of data LEFT [1] */
+    data.data   = this_task->data._f_LEFT.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x1 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  =   /* Control: always empty */ 0;
+    data.local.dst_count  =   /* Control: always empty */ 0;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = NULL;
+    data.remote.src_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.src_count  =   /* Control: always empty */ 0;
+    data.remote.dst_count  =   /* Control: always empty */ 0;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( 1 ) {
+      __parsec_walk_UP_task_t* ncc = (__parsec_walk_UP_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[walk_UP.task_class_id];
+        const int UP_n = (n + 1);
+        if( (UP_n >= (0)) && (UP_n <= (31)) ) {
+          assert(&nc.locals[0].value == &ncc->locals.n.value);
+          ncc->locals.n.value = UP_n;
+          const int UP_l = (2 * l);
+          if( (UP_l >= (0)) && (UP_l <= ((1 << ncc->locals.n.value))) ) {
+            assert(&nc.locals[1].value == &ncc->locals.l.value);
+            ncc->locals.l.value = UP_l;
+#if defined(DISTRIBUTED)
+            rank_dst = rank_of_tree(ncc->locals.n.value, ncc->locals.l.value);
+            if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+              vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_tree)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_tree, ncc->locals.n.value, ncc->locals.l.value);
+            nc.priority = __parsec_tp->super.super.priority;
+            successor_repo = UP_repo;
+            successor_repo_key = up_make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+          RELEASE_DEP_OUTPUT(es, "LEFT", this_task, "RL", &nc, rank_src, rank_dst, &data);
+          if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_walk_UP_for_LEFT_dep1_atline_79_iftrue, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+            }
+          }
+    } else {
+      __parsec_walk_DOWN_task_t* ncc = (__parsec_walk_DOWN_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[walk_DOWN.task_class_id];
+        const int DOWN_n = (n + 1);
+        if( (DOWN_n >= (0)) && (DOWN_n <= (31)) ) {
+          assert(&nc.locals[0].value == &ncc->locals.n.value);
+          ncc->locals.n.value = DOWN_n;
+          const int DOWN_l = (2 * l);
+          if( (DOWN_l >= (0)) && (DOWN_l <= ((1 << ncc->locals.n.value))) ) {
+            assert(&nc.locals[1].value == &ncc->locals.l.value);
+            ncc->locals.l.value = DOWN_l;
+            const int DOWN_node_exists = 1;
+            assert(&nc.locals[2].value == &ncc->locals.node_exists.value);
+            ncc->locals.node_exists.value = DOWN_node_exists;
+#if defined(DISTRIBUTED)
+            rank_dst = rank_of_tree(ncc->locals.n.value, ncc->locals.l.value);
+            if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+              vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_tree)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_tree, ncc->locals.n.value, ncc->locals.l.value);
+            nc.priority = __parsec_tp->super.super.priority;
+            successor_repo = DOWN_repo;
+            successor_repo_key = down_make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+          RELEASE_DEP_OUTPUT(es, "LEFT", this_task, "RL", &nc, rank_src, rank_dst, &data);
+          if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_walk_UP_for_LEFT_dep1_atline_79_iffalse, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+            }
+          }
+    }
+  }
+  }
+  if( action_mask & 0x2 ) {  /* Flow of data RIGHT [2] */
+    data.data   = this_task->data._f_RIGHT.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x2 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  =   /* Control: always empty */ 0;
+    data.local.dst_count  =   /* Control: always empty */ 0;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = NULL;
+    data.remote.src_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.src_count  =   /* Control: always empty */ 0;
+    data.remote.dst_count  =   /* Control: always empty */ 0;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( 1 ) {
+      __parsec_walk_UP_task_t* ncc = (__parsec_walk_UP_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[walk_UP.task_class_id];
+        const int UP_n = (n + 1);
+        if( (UP_n >= (0)) && (UP_n <= (31)) ) {
+          assert(&nc.locals[0].value == &ncc->locals.n.value);
+          ncc->locals.n.value = UP_n;
+          const int UP_l = ((2 * l) + 1);
+          if( (UP_l >= (0)) && (UP_l <= ((1 << ncc->locals.n.value))) ) {
+            assert(&nc.locals[1].value == &ncc->locals.l.value);
+            ncc->locals.l.value = UP_l;
+#if defined(DISTRIBUTED)
+            rank_dst = rank_of_tree(ncc->locals.n.value, ncc->locals.l.value);
+            if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+              vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_tree)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_tree, ncc->locals.n.value, ncc->locals.l.value);
+            nc.priority = __parsec_tp->super.super.priority;
+            successor_repo = UP_repo;
+            successor_repo_key = up_make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+          RELEASE_DEP_OUTPUT(es, "RIGHT", this_task, "RL", &nc, rank_src, rank_dst, &data);
+          if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_walk_UP_for_RIGHT_dep1_atline_84_iftrue, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+            }
+          }
+    } else {
+      __parsec_walk_DOWN_task_t* ncc = (__parsec_walk_DOWN_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[walk_DOWN.task_class_id];
+        const int DOWN_n = (n + 1);
+        if( (DOWN_n >= (0)) && (DOWN_n <= (31)) ) {
+          assert(&nc.locals[0].value == &ncc->locals.n.value);
+          ncc->locals.n.value = DOWN_n;
+          const int DOWN_l = ((2 * l) + 1);
+          if( (DOWN_l >= (0)) && (DOWN_l <= ((1 << ncc->locals.n.value))) ) {
+            assert(&nc.locals[1].value == &ncc->locals.l.value);
+            ncc->locals.l.value = DOWN_l;
+            const int DOWN_node_exists = 1;
+            assert(&nc.locals[2].value == &ncc->locals.node_exists.value);
+            ncc->locals.node_exists.value = DOWN_node_exists;
+#if defined(DISTRIBUTED)
+            rank_dst = rank_of_tree(ncc->locals.n.value, ncc->locals.l.value);
+            if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+              vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_tree)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_tree, ncc->locals.n.value, ncc->locals.l.value);
+            nc.priority = __parsec_tp->super.super.priority;
+            successor_repo = DOWN_repo;
+            successor_repo_key = down_make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+          RELEASE_DEP_OUTPUT(es, "RIGHT", this_task, "RL", &nc, rank_src, rank_dst, &data);
+          if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_walk_UP_for_RIGHT_dep1_atline_84_iffalse, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+            }
+          }
+    }
+  }
+  }
+  /* Flow of data RL has only IN dependencies */
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static int release_deps_of_walk_UP(parsec_execution_stream_t *es, __parsec_walk_UP_task_t *this_task, uint32_t action_mask, parsec_remote_deps_t *deps)
+{
+  PARSEC_PINS(es, RELEASE_DEPS_BEGIN, (parsec_task_t *)this_task);  const __parsec_walk_internal_taskpool_t *__parsec_tp = (const __parsec_walk_internal_taskpool_t *)this_task->taskpool;
+  parsec_release_dep_fct_arg_t arg;
+  int __vp_id;
+  int consume_local_repo = 0;
+  arg.action_mask = action_mask;
+  arg.output_entry = NULL;
+  arg.output_repo = NULL;
+#if defined(DISTRIBUTED)
+  arg.remote_deps = deps;
+#endif  /* defined(DISTRIBUTED) */
+  assert(NULL != es);
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS )    arg.ready_lists = alloca(sizeof(parsec_task_t *) * es->virtual_process->parsec_context->nb_vp);
+  else
+    arg.ready_lists = NULL;
+  for( __vp_id = 0; __vp_id < es->virtual_process->parsec_context->nb_vp; arg.ready_lists[__vp_id++] = NULL );
+  (void)__parsec_tp; (void)deps;
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_NODE.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_NODE.source_repo, this_task->data._f_NODE.source_repo_entry->ht_item.key );
+    }
+  }
+  consume_local_repo = (this_task->repo_entry != NULL);
+  arg.output_repo = UP_repo;
+  arg.output_entry = this_task->repo_entry;
+  arg.output_usage = 0;
+  if( action_mask & (PARSEC_ACTION_RELEASE_LOCAL_DEPS | PARSEC_ACTION_GET_REPO_ENTRY) ) {
+    arg.output_entry = data_repo_lookup_entry_and_create( es, arg.output_repo, up_make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    arg.output_entry->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(arg.output_entry->sim_exec_date == 0);
+    arg.output_entry->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  if(action_mask & ( PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE ) ){
+    /* Generate the reshape promise for the outputs that need it */
+    iterate_successors_of_walk_UP(es, this_task, action_mask, parsec_set_up_reshape_promise, &arg);
+   }
+  iterate_successors_of_walk_UP(es, this_task, action_mask, parsec_release_dep_fct, &arg);
+
+#if defined(DISTRIBUTED)
+  if( (action_mask & PARSEC_ACTION_SEND_REMOTE_DEPS) && (NULL != arg.remote_deps)) {
+    parsec_remote_dep_activate(es, (parsec_task_t *)this_task, arg.remote_deps, arg.remote_deps->outgoing_mask);
+  }
+#endif
+
+  if(action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS) {
+    data_repo_entry_addto_usage_limit(UP_repo, arg.output_entry->ht_item.key, arg.output_usage);
+    __parsec_schedule_vp(es, arg.ready_lists, 0);
+  }
+      if (consume_local_repo) {
+         data_repo_entry_used_once( UP_repo, this_task->repo_entry->ht_item.key );
+      }
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_NODE.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_NODE.data_in);
+    }
+  }
+  PARSEC_PINS(es, RELEASE_DEPS_END, (parsec_task_t *)this_task);  return 0;
+}
+
+static int data_lookup_of_walk_UP(parsec_execution_stream_t *es, __parsec_walk_UP_task_t *this_task)
+{
+  const __parsec_walk_internal_taskpool_t *__parsec_tp = (__parsec_walk_internal_taskpool_t *)this_task->taskpool;
+  parsec_assignment_t generic_locals[MAX_PARAM_COUNT];  /* generic task locals */
+  int target_device = 0; (void)target_device;
+  (void)__parsec_tp; (void)generic_locals; (void)es;
+  parsec_data_copy_t *chunk = NULL;
+  data_repo_t        *reshape_repo  = NULL, *consumed_repo  = NULL;
+  data_repo_entry_t  *reshape_entry = NULL, *consumed_entry = NULL;
+  parsec_key_t        reshape_entry_key = 0, consumed_entry_key = 0;
+  uint8_t             consumed_flow_index;
+  parsec_dep_data_description_t data;
+  int ret;
+  (void)reshape_repo; (void)reshape_entry; (void)reshape_entry_key;
+  (void)consumed_repo; (void)consumed_entry; (void)consumed_entry_key;
+  (void)consumed_flow_index;
+  (void)chunk; (void)data; (void)ret;
+  const int n = this_task->locals.n.value; (void)n;
+  const int l = this_task->locals.l.value; (void)l;
+  if( NULL == this_task->repo_entry ){
+    this_task->repo_entry = data_repo_lookup_entry_and_create(es, UP_repo,                                       up_make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    data_repo_entry_addto_usage_limit(UP_repo, this_task->repo_entry->ht_item.key, 1);    this_task->repo_entry ->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(this_task->repo_entry ->sim_exec_date == 0);
+    this_task->repo_entry ->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  /* The reshape repo is the current task repo. */  reshape_repo = UP_repo;
+  reshape_entry_key = up_make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals) ;
+  reshape_entry = this_task->repo_entry;
+  /* Lookup the input data, and store them in the context if any */
+
+if(! this_task->data._f_NODE.fulfill ){ /* Flow NODE */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_NODE.data_out = NULL;  /* input only */
+  /* Flow NODE [0] dependency [2] from predecessor DO_DOWN */
+  if( NULL == (chunk = this_task->data._f_NODE.data_in) ) {
+  /* No data set up by predecessor on this task input flow */
+__parsec_walk_DO_DOWN_parsec_assignment_t *target_locals = (__parsec_walk_DO_DOWN_parsec_assignment_t*)&generic_locals;
+  const int DO_DOWNn = target_locals->n.value = n; (void)DO_DOWNn;
+  const int DO_DOWNl = target_locals->l.value = l; (void)DO_DOWNl;
+    if( (reshape_entry != NULL) && (reshape_entry->data[0] != NULL) ){
+        /* Reshape promise set up on this task repo by predecessor */
+        consumed_repo = reshape_repo;
+        consumed_entry = reshape_entry;
+        consumed_entry_key = reshape_entry_key;
+        consumed_flow_index = 0;
+    }else{
+        /* Consume from predecessor's repo */
+        consumed_repo = DO_DOWN_repo;
+        consumed_entry_key = do_down_make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)target_locals) ;
+        consumed_entry = data_repo_lookup_entry( consumed_repo, consumed_entry_key );
+        consumed_flow_index = 0;
+    }
+    data.data   = NULL;
+    data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+        data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    ACQUIRE_FLOW(this_task, "NODE", &walk_DO_DOWN, "NODE", target_locals, chunk);
+    this_task->data._f_NODE.data_out = chunk;
+  } 
+  else {
+    /* Data set up by predecessor on this task input flow */
+    consumed_repo = this_task->data._f_NODE.source_repo;
+    consumed_entry = this_task->data._f_NODE.source_repo_entry;
+    consumed_entry_key = this_task->data._f_NODE.source_repo_entry->ht_item.key;
+    if( (reshape_entry != NULL) && (reshape_entry->data[0] != NULL) ){
+        /* Reshape promise set up on input by predecessor is on this task repo */
+        consumed_flow_index = 0;
+        assert( (this_task->data._f_NODE.source_repo == reshape_repo)
+             && (this_task->data._f_NODE.source_repo_entry == reshape_entry));
+    }else{
+        /* Reshape promise set up on input by predecessor is the predecesssor task repo */
+        consumed_flow_index = 0;
+    }
+    data.data   = NULL;
+    data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+        data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    this_task->data._f_NODE.data_out = parsec_data_get_copy(chunk->original, target_device);
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+    parsec_prof_grapher_data_input(chunk->original, (parsec_task_t*)this_task, &flow_of_walk_UP_for_NODE, 0);
+#endif
+  }
+    this_task->data._f_NODE.data_in     = chunk;
+    this_task->data._f_NODE.source_repo       = consumed_repo;
+    this_task->data._f_NODE.source_repo_entry = consumed_entry;
+    if( this_task->data._f_NODE.source_repo_entry == this_task->repo_entry ){
+      /* in case we have consume from this task repo entry for the flow,
+       * it is cleaned up, avoiding having old stuff during release_deps_of
+       */
+      this_task->repo_entry->data[0] = NULL;
+    }
+    this_task->data._f_NODE.fulfill = 1;
+}
+
+  /* LEFT is a control flow */
+  this_task->data._f_LEFT.data_in         = NULL;
+  this_task->data._f_LEFT.data_out        = NULL;
+  this_task->data._f_LEFT.source_repo       = NULL;
+  this_task->data._f_LEFT.source_repo_entry = NULL;
+  /* RIGHT is a control flow */
+  this_task->data._f_RIGHT.data_in         = NULL;
+  this_task->data._f_RIGHT.data_out        = NULL;
+  this_task->data._f_RIGHT.source_repo       = NULL;
+  this_task->data._f_RIGHT.source_repo_entry = NULL;
+  /* RL is a control flow */
+  this_task->data._f_RL.data_in         = NULL;
+  this_task->data._f_RL.data_out        = NULL;
+  this_task->data._f_RL.source_repo       = NULL;
+  this_task->data._f_RL.source_repo_entry = NULL;
+  /** Generate profiling information */
+#if defined(PARSEC_PROF_TRACE)
+  this_task->prof_info.desc = (parsec_data_collection_t*)__parsec_tp->super._g_tree;
+  this_task->prof_info.priority = this_task->priority;
+  this_task->prof_info.data_id   = ((parsec_data_collection_t*)__parsec_tp->super._g_tree)->data_key((parsec_data_collection_t*)__parsec_tp->super._g_tree, n, l);
+  this_task->prof_info.task_class_id = this_task->task_class->task_class_id;
+  this_task->prof_info.task_return_code = -1;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int datatype_lookup_of_walk_UP(parsec_execution_stream_t *es, const parsec_task_t *this_generic_task, const parsec_task_t *parent_task,
+              uint32_t* flow_mask, parsec_dep_data_description_t* data)
+{
+  const __parsec_walk_UP_task_t *this_task = (__parsec_walk_UP_task_t*)this_generic_task;
+  const __parsec_walk_internal_taskpool_t *__parsec_tp = (__parsec_walk_internal_taskpool_t *)this_task->taskpool;
+  (void)__parsec_tp; (void)es; (void)this_task; (void)data; (void)parent_task;
+  const int n = this_task->locals.n.value; (void)n;
+  const int l = this_task->locals.l.value; (void)l;
+  data->local.arena = data->remote.arena = NULL;
+  data->local.src_datatype  = data->local.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->local.src_count     = data->local.dst_count = 0;
+  data->local.src_displ     = data->local.dst_displ = 0;
+  data->data_future  = NULL;
+  if( (*flow_mask) & 0x80000000U ) { /* these are the input dependencies remote datatypes  */
+if( (*flow_mask) & 0x1U ) {  /* Flow NODE */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_walk_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_walk_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_walk_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+    goto no_mask_match;
+  }
+
+  /* these are the output dependencies remote datatypes */
+ no_mask_match:
+  data->data                             = NULL;
+  data->remote.src_datatype = data->remote.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->remote.src_count    = data->remote.dst_count = 0;
+  data->remote.src_displ    = data->remote.dst_displ = 0;
+  data->data_future  = NULL;
+  (*flow_mask) = 0;  /* nothing left */
+  (void)n;  (void)l;
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+static int hook_of_walk_UP(parsec_execution_stream_t *es, __parsec_walk_UP_task_t *this_task)
+{
+  __parsec_walk_internal_taskpool_t *__parsec_tp = (__parsec_walk_internal_taskpool_t *)this_task->taskpool;
+  (void)es; (void)__parsec_tp;
+  const int n = this_task->locals.n.value; (void)n;
+  const int l = this_task->locals.l.value; (void)l;
+  (void)n;  (void)l;
+
+  /** Declare the variables that will hold the data, and all the accounting for each */
+  parsec_data_copy_t *_f_NODE = this_task->data._f_NODE.data_in;
+  void *NODE = PARSEC_DATA_COPY_GET_PTR(_f_NODE); (void)NODE;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    data_repo_entry_t *eNODE = this_task->data._f_NODE.source_repo_entry;
+    if( (NULL != eNODE) && (eNODE->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eNODE->sim_exec_date;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+  /** Cache Awareness Accounting */
+#if defined(PARSEC_CACHE_AWARENESS)
+  cache_buf_referenced(es->closest_cache, NODE);
+#endif /* PARSEC_CACHE_AWARENESS */
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                                    UP BODY                                    -----*/
+
+{
+    /* The root node has to delete all remaining tasks*/
+    node_t *node = (node_t*)NODE;
+    if( verbose ) {
+        int rank = (((parsec_data_collection_t*)__parsec_tp->super._g_tree)->rank_of((parsec_data_collection_t*)__parsec_tp->super._g_tree, n, l));
+        fprintf(stderr, "CALLING UP(%d, %d) on rank %d\n", n, l, rank);
+    }
+    if( NULL != on_node_up ) {
+        on_node_up(tree, node, n, l, on_fct_param);
+    }
+}
+
+/*-----                                END OF UP BODY                                -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#endif  /*  defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+static int complete_hook_of_walk_UP(parsec_execution_stream_t *es, __parsec_walk_UP_task_t *this_task)
+{
+  const __parsec_walk_internal_taskpool_t *__parsec_tp = (__parsec_walk_internal_taskpool_t *)this_task->taskpool;
+#if defined(DISTRIBUTED)
+    const int n = this_task->locals.n.value; (void)n;
+  const int l = this_task->locals.l.value; (void)l;
+#endif  /* defined(DISTRIBUTED) */
+  (void)es; (void)__parsec_tp;
+parsec_data_t* data_t_desc = NULL; (void)data_t_desc;
+#if defined(DISTRIBUTED)
+  /** If not working on distributed, there is no risk that data is not in place */
+  (void)n;  (void)l;
+
+#endif /* DISTRIBUTED */
+#if defined(PARSEC_PROF_GRAPHER)
+  parsec_prof_grapher_task((parsec_task_t*)this_task, es->th_id, es->virtual_process->vp_id,
+     __jdf2c_key_fns_UP.key_hash(this_task->task_class->make_key( (parsec_taskpool_t*)this_task->taskpool, ((parsec_task_t*)this_task)->locals), NULL));
+#endif  /* defined(PARSEC_PROF_GRAPHER) */
+  release_deps_of_walk_UP(es, this_task,
+      PARSEC_ACTION_RELEASE_REMOTE_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_REFS |
+      PARSEC_ACTION_RESHAPE_ON_RELEASE |
+      0x7,  /* mask of all dep_index */ 
+      NULL);
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static parsec_hook_return_t release_task_of_walk_UP(parsec_execution_stream_t *es, parsec_task_t *this_task)
+{
+    const __parsec_walk_internal_taskpool_t *__parsec_tp =
+        (const __parsec_walk_internal_taskpool_t *)this_task->taskpool;
+    parsec_hash_table_t *ht = (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[1];
+    parsec_key_t key = this_task->task_class->make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals);
+    parsec_hashable_dependency_t *hash_dep = (parsec_hashable_dependency_t *)parsec_hash_table_remove(ht, key);
+    parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);
+    if( (PARSEC_UNDETERMINED_NB_TASKS == __parsec_tp->super.super.nb_tasks) ||
+        (0 == __parsec_tp->super.super.nb_tasks) ||
+        (PARSEC_RUNTIME_RESERVED_NB_TASKS == __parsec_tp->super.super.nb_tasks) ) {
+        /* don't spend time counting */
+        return parsec_release_task_to_mempool(es, this_task);
+    }
+    return parsec_release_task_to_mempool_update_nbtasks(es, this_task);
+}
+
+static char *walk_walk_UP_internal_init_deps_key_functions_key_print(char *buffer, size_t buffer_size, parsec_key_t k, void *user_data)
+{
+  (void)user_data;
+  snprintf(buffer, buffer_size, "(%llu)", (unsigned long long int)k);
+  return buffer;
+}
+
+static parsec_key_fn_t walk_walk_UP_internal_init_deps_key_functions = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = walk_walk_UP_internal_init_deps_key_functions_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/* Needs: - - - */
+static int walk_UP_internal_init(parsec_execution_stream_t * es, __parsec_walk_UP_task_t * this_task)
+{
+  __parsec_walk_internal_taskpool_t *__parsec_tp = (__parsec_walk_internal_taskpool_t*)this_task->taskpool;
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+  PARSEC_PROFILING_TRACE(es->es_profile,
+                         this_task->taskpool->profiling_array[START_KEY(this_task->task_class->task_class_id)],
+                         0,
+                         this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+  this_task->status = PARSEC_TASK_STATUS_COMPLETE;
+
+  PARSEC_AYU_REGISTER_TASK(&walk_UP);
+  __parsec_tp->super.super.dependencies_array[1] = PARSEC_OBJ_NEW(parsec_hash_table_t);
+  parsec_hash_table_init(__parsec_tp->super.super.dependencies_array[1], offsetof(parsec_hashable_dependency_t, ht_item), 10, walk_walk_UP_internal_init_deps_key_functions, this_task->taskpool);
+  __parsec_tp->repositories[1] = data_repo_create_nothreadsafe(PARSEC_DEFAULT_DATAREPO_HASH_LENGTH, __jdf2c_key_fns_UP, (parsec_taskpool_t*)__parsec_tp, 4);
+   (void)__parsec_tp; (void)es;
+  if(1 == parsec_atomic_fetch_dec_int32(&__parsec_tp->sync_point)) {
+    /* Last initialization task complete. Update the number of tasks. */
+    __parsec_tp->super.super.tdm.module->taskpool_addto_nb_tasks(&__parsec_tp->super.super, undetermined_nb_tasks(__parsec_tp));
+    parsec_mfence();  /* write memory barrier to guarantee that the scheduler gets the correct number of tasks */
+    parsec_taskpool_enable((parsec_taskpool_t*)__parsec_tp, &__parsec_tp->startup_queue,
+                           (parsec_task_t*)this_task, es, __parsec_tp->super.super.nb_pending_actions);
+    __parsec_tp->super.super.tdm.module->taskpool_ready(&__parsec_tp->super.super);
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+    PARSEC_PROFILING_TRACE(es->es_profile,
+                           this_task->taskpool->profiling_array[2 * this_task->task_class->task_class_id + 1],
+                           0,
+                           this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    return PARSEC_HOOK_RETURN_DONE;
+  }
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static const __parsec_chore_t __walk_UP_chores[] ={
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+    { .type     = PARSEC_DEV_CPU,
+      .evaluate = (parsec_evaluate_function_t*)NULL,
+      .hook     = (parsec_hook_t*)hook_of_walk_UP },
+#endif  /* defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+    { .type     = PARSEC_DEV_NONE,
+      .evaluate = NULL,
+      .hook     = (parsec_hook_t*)NULL },  /* End marker */
+};
+
+static const parsec_task_class_t walk_UP = {
+  .name = "UP",
+  .task_class_id = 1,
+  .nb_flows = 4,
+  .nb_parameters = 2,
+  .nb_locals = 2,
+  .task_class_type = PARSEC_TASK_CLASS_TYPE_PTG,
+  .params = { &symb_walk_UP_n, &symb_walk_UP_l, NULL },
+  .locals = { &symb_walk_UP_n, &symb_walk_UP_l, NULL },
+  .data_affinity = (parsec_data_ref_fn_t*)affinity_of_walk_UP,
+  .initial_data = (parsec_data_ref_fn_t*)affinity_of_walk_UP,
+  .final_data = (parsec_data_ref_fn_t*)affinity_of_walk_UP,
+  .priority = NULL,
+  .properties = properties_of_walk_UP,
+#if MAX_PARAM_COUNT < 1  /* number of read flows of UP */
+  #error Too many read flows for task UP
+#endif  /* MAX_PARAM_COUNT */
+#if MAX_PARAM_COUNT < 0  /* number of write flows of UP */
+  #error Too many write flows for task UP
+#endif  /* MAX_PARAM_COUNT */
+  .in = { &flow_of_walk_UP_for_NODE, &flow_of_walk_UP_for_LEFT, &flow_of_walk_UP_for_RIGHT, NULL },
+  .out = { &flow_of_walk_UP_for_RL, NULL },
+  .flags = 0x0 | PARSEC_USE_DEPS_MASK,
+  .dependencies_goal = 0x7,
+  .make_key = up_make_key,
+  .task_snprintf = parsec_task_snprintf,
+#if defined(PARSEC_PROF_TRACE)
+  .profile_info = &parsec_task_profile_info,
+#endif
+  .key_functions = &__jdf2c_key_fns_UP,
+  .fini = (parsec_hook_t*)NULL,
+  .incarnations = __walk_UP_chores,
+  .find_deps = parsec_hash_find_deps,
+  .update_deps = parsec_update_deps_with_mask,
+  .iterate_successors = (parsec_traverse_function_t*)iterate_successors_of_walk_UP,
+  .iterate_predecessors = (parsec_traverse_function_t*)iterate_predecessors_of_walk_UP,
+  .release_deps = (parsec_release_deps_t*)release_deps_of_walk_UP,
+  .prepare_output = (parsec_hook_t*)NULL,
+  .prepare_input = (parsec_hook_t*)data_lookup_of_walk_UP,
+  .time_estimate = NULL,
+  .get_datatype = datatype_lookup_of_walk_UP,
+  .complete_execution = (parsec_hook_t*)complete_hook_of_walk_UP,
+  .release_task = &release_task_of_walk_UP,
+#if defined(PARSEC_SIM)
+  .sim_cost_fct = (parsec_sim_cost_fct_t*)NULL,
+#endif
+};
+
+
+/******                                    BCAST_UP                                    ******/
+
+static inline int32_t minexpr_of_symb_walk_BCAST_UP_rank_fct(const __parsec_walk_internal_taskpool_t *__parsec_tp, const __parsec_walk_BCAST_UP_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_walk_BCAST_UP_rank = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_walk_BCAST_UP_rank_fct }
+                   }
+};
+static inline int maxexpr_of_symb_walk_BCAST_UP_rank_fct(const __parsec_walk_internal_taskpool_t *__parsec_tp, const __parsec_walk_BCAST_UP_parsec_assignment_t *locals)
+{
+  const int rank = locals->rank.value; (void)rank;
+
+  (void)rank;
+  (void)__parsec_tp; (void)locals;
+  return (NP - 1);
+}
+static const parsec_expr_t maxexpr_of_symb_walk_BCAST_UP_rank = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_walk_BCAST_UP_rank_fct }
+                   }
+};
+static const parsec_symbol_t symb_walk_BCAST_UP_rank = { .name = "rank", .context_index = 0, .min = &minexpr_of_symb_walk_BCAST_UP_rank, .max = &maxexpr_of_symb_walk_BCAST_UP_rank, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int affinity_of_walk_BCAST_UP(const __parsec_walk_BCAST_UP_task_t *this_task,
+                     parsec_data_ref_t *ref)
+{
+    const __parsec_walk_internal_taskpool_t *__parsec_tp = (const __parsec_walk_internal_taskpool_t*)this_task->taskpool;
+  const int rank = this_task->locals.rank.value; (void)rank;
+
+  /* Silent Warnings: should look into predicate to know what variables are usefull */
+  (void)rank;
+  ref->dc = (parsec_data_collection_t *)__parsec_tp->super._g_fakeDesc;
+  /* Compute data key */
+  ref->key = ref->dc->data_key(ref->dc, rank, rank);
+  return 1;
+}
+static const parsec_property_t properties_of_walk_BCAST_UP[1] = {
+  {.name = NULL, .expr = NULL}
+};
+static const parsec_dep_t flow_of_walk_BCAST_UP_for_RL_dep1_atline_43 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 1, /* walk_UP */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_walk_UP_for_RL,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_walk_BCAST_UP_for_RL,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_walk_BCAST_UP_for_RL = {
+  .name               = "RL",
+  .sym_type           = PARSEC_SYM_IN,
+  .flow_flags         = PARSEC_FLOW_ACCESS_NONE,
+  .flow_index         = 0,
+  .flow_datatype_mask = 0x0,
+  .dep_in     = { &flow_of_walk_BCAST_UP_for_RL_dep1_atline_43 },
+  .dep_out    = { NULL }
+};
+
+static void
+iterate_predecessors_of_walk_BCAST_UP(parsec_execution_stream_t *es, const __parsec_walk_BCAST_UP_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_walk_internal_taskpool_t *__parsec_tp = (const __parsec_walk_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_walk_BCAST_UP_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_walk_BCAST_UP_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int rank = __jdf2c__tmp_locals.rank.value; (void)rank;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)rank;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_fakeDesc(rank, rank);
+#endif
+  if( action_mask & 0x1 ) {  /* Flow of data RL [0] */
+    data.data   = this_task->data._f_RL.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x1 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  =   /* Control: always empty */ 0;
+    data.local.dst_count  =   /* Control: always empty */ 0;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = NULL;
+    data.remote.src_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.src_count  =   /* Control: always empty */ 0;
+    data.remote.dst_count  =   /* Control: always empty */ 0;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        __parsec_walk_UP_task_t* ncc = (__parsec_walk_UP_task_t*)&nc;
+    nc.task_class = __parsec_tp->super.super.task_classes_array[walk_UP.task_class_id];
+      const int UP_n = 0;
+      if( (UP_n >= (0)) && (UP_n <= (31)) ) {
+        assert(&nc.locals[0].value == &ncc->locals.n.value);
+        ncc->locals.n.value = UP_n;
+        const int UP_l = 0;
+        if( (UP_l >= (0)) && (UP_l <= ((1 << ncc->locals.n.value))) ) {
+          assert(&nc.locals[1].value == &ncc->locals.l.value);
+          ncc->locals.l.value = UP_l;
+#if defined(DISTRIBUTED)
+          rank_dst = rank_of_tree(ncc->locals.n.value, ncc->locals.l.value);
+          if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+            vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_tree)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_tree, ncc->locals.n.value, ncc->locals.l.value);
+          nc.priority = __parsec_tp->super.super.priority;
+          successor_repo = UP_repo;
+          successor_repo_key = up_make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+        RELEASE_DEP_OUTPUT(es, "RL", this_task, "RL", &nc, rank_src, rank_dst, &data);
+        if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_walk_BCAST_UP_for_RL_dep1_atline_43, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+          }
+        }
+  }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static int release_deps_of_walk_BCAST_UP(parsec_execution_stream_t *es, __parsec_walk_BCAST_UP_task_t *this_task, uint32_t action_mask, parsec_remote_deps_t *deps)
+{
+  PARSEC_PINS(es, RELEASE_DEPS_BEGIN, (parsec_task_t *)this_task);  const __parsec_walk_internal_taskpool_t *__parsec_tp = (const __parsec_walk_internal_taskpool_t *)this_task->taskpool;
+  parsec_release_dep_fct_arg_t arg;
+  int __vp_id;
+  int consume_local_repo = 0;
+  arg.action_mask = action_mask;
+  arg.output_entry = NULL;
+  arg.output_repo = NULL;
+#if defined(DISTRIBUTED)
+  arg.remote_deps = deps;
+#endif  /* defined(DISTRIBUTED) */
+  assert(NULL != es);
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS )    arg.ready_lists = alloca(sizeof(parsec_task_t *) * es->virtual_process->parsec_context->nb_vp);
+  else
+    arg.ready_lists = NULL;
+  for( __vp_id = 0; __vp_id < es->virtual_process->parsec_context->nb_vp; arg.ready_lists[__vp_id++] = NULL );
+  (void)__parsec_tp; (void)deps;
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+  }
+  consume_local_repo = (this_task->repo_entry != NULL);
+  /* No successors, don't call iterate_successors and don't release any local deps */
+      if (consume_local_repo) {
+         data_repo_entry_used_once( BCAST_UP_repo, this_task->repo_entry->ht_item.key );
+      }
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+  }
+  PARSEC_PINS(es, RELEASE_DEPS_END, (parsec_task_t *)this_task);  return 0;
+}
+
+static int data_lookup_of_walk_BCAST_UP(parsec_execution_stream_t *es, __parsec_walk_BCAST_UP_task_t *this_task)
+{
+  const __parsec_walk_internal_taskpool_t *__parsec_tp = (__parsec_walk_internal_taskpool_t *)this_task->taskpool;
+  parsec_assignment_t generic_locals[MAX_PARAM_COUNT];  /* generic task locals */
+  int target_device = 0; (void)target_device;
+  (void)__parsec_tp; (void)generic_locals; (void)es;
+  parsec_data_copy_t *chunk = NULL;
+  data_repo_t        *reshape_repo  = NULL, *consumed_repo  = NULL;
+  data_repo_entry_t  *reshape_entry = NULL, *consumed_entry = NULL;
+  parsec_key_t        reshape_entry_key = 0, consumed_entry_key = 0;
+  uint8_t             consumed_flow_index;
+  parsec_dep_data_description_t data;
+  int ret;
+  (void)reshape_repo; (void)reshape_entry; (void)reshape_entry_key;
+  (void)consumed_repo; (void)consumed_entry; (void)consumed_entry_key;
+  (void)consumed_flow_index;
+  (void)chunk; (void)data; (void)ret;
+  const int rank = this_task->locals.rank.value; (void)rank;
+  if( NULL == this_task->repo_entry ){
+    this_task->repo_entry = data_repo_lookup_entry_and_create(es, BCAST_UP_repo,                                       __jdf2c_make_key_BCAST_UP((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    data_repo_entry_addto_usage_limit(BCAST_UP_repo, this_task->repo_entry->ht_item.key, 1);    this_task->repo_entry ->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(this_task->repo_entry ->sim_exec_date == 0);
+    this_task->repo_entry ->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  /* The reshape repo is the current task repo. */  reshape_repo = BCAST_UP_repo;
+  reshape_entry_key = __jdf2c_make_key_BCAST_UP((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals) ;
+  reshape_entry = this_task->repo_entry;
+  /* Lookup the input data, and store them in the context if any */
+  /* RL is a control flow */
+  this_task->data._f_RL.data_in         = NULL;
+  this_task->data._f_RL.data_out        = NULL;
+  this_task->data._f_RL.source_repo       = NULL;
+  this_task->data._f_RL.source_repo_entry = NULL;
+  /** Generate profiling information */
+#if defined(PARSEC_PROF_TRACE)
+  this_task->prof_info.desc = (parsec_data_collection_t*)__parsec_tp->super._g_fakeDesc;
+  this_task->prof_info.priority = this_task->priority;
+  this_task->prof_info.data_id   = ((parsec_data_collection_t*)__parsec_tp->super._g_fakeDesc)->data_key((parsec_data_collection_t*)__parsec_tp->super._g_fakeDesc, rank, rank);
+  this_task->prof_info.task_class_id = this_task->task_class->task_class_id;
+  this_task->prof_info.task_return_code = -1;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int datatype_lookup_of_walk_BCAST_UP(parsec_execution_stream_t *es, const parsec_task_t *this_generic_task, const parsec_task_t *parent_task,
+              uint32_t* flow_mask, parsec_dep_data_description_t* data)
+{
+  const __parsec_walk_BCAST_UP_task_t *this_task = (__parsec_walk_BCAST_UP_task_t*)this_generic_task;
+  const __parsec_walk_internal_taskpool_t *__parsec_tp = (__parsec_walk_internal_taskpool_t *)this_task->taskpool;
+  (void)__parsec_tp; (void)es; (void)this_task; (void)data; (void)parent_task;
+  const int rank = this_task->locals.rank.value; (void)rank;
+  data->local.arena = data->remote.arena = NULL;
+  data->local.src_datatype  = data->local.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->local.src_count     = data->local.dst_count = 0;
+  data->local.src_displ     = data->local.dst_displ = 0;
+  data->data_future  = NULL;
+
+  /* these are the output dependencies remote datatypes */
+  data->data                             = NULL;
+  data->remote.src_datatype = data->remote.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->remote.src_count    = data->remote.dst_count = 0;
+  data->remote.src_displ    = data->remote.dst_displ = 0;
+  data->data_future  = NULL;
+  (*flow_mask) = 0;  /* nothing left */
+  (void)rank;
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+static int hook_of_walk_BCAST_UP(parsec_execution_stream_t *es, __parsec_walk_BCAST_UP_task_t *this_task)
+{
+  __parsec_walk_internal_taskpool_t *__parsec_tp = (__parsec_walk_internal_taskpool_t *)this_task->taskpool;
+  (void)es; (void)__parsec_tp;
+  const int rank = this_task->locals.rank.value; (void)rank;
+  (void)rank;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                                BCAST_UP BODY                                  -----*/
+
+{
+    __parsec_tp->super.super.tdm.module->taskpool_set_nb_tasks(&__parsec_tp->super.super, 0); /** We are now DONE ! **/
+    if( verbose ) {
+        fprintf(stderr, "Rank %d in BCAST_UP\n", rank);
+    }
+}
+
+/*-----                              END OF BCAST_UP BODY                              -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#endif  /*  defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+static int complete_hook_of_walk_BCAST_UP(parsec_execution_stream_t *es, __parsec_walk_BCAST_UP_task_t *this_task)
+{
+  const __parsec_walk_internal_taskpool_t *__parsec_tp = (__parsec_walk_internal_taskpool_t *)this_task->taskpool;
+#if defined(DISTRIBUTED)
+    const int rank = this_task->locals.rank.value; (void)rank;
+#endif  /* defined(DISTRIBUTED) */
+  (void)es; (void)__parsec_tp;
+parsec_data_t* data_t_desc = NULL; (void)data_t_desc;
+#if defined(DISTRIBUTED)
+  /** If not working on distributed, there is no risk that data is not in place */
+  (void)rank;
+
+#endif /* DISTRIBUTED */
+#if defined(PARSEC_PROF_GRAPHER)
+  parsec_prof_grapher_task((parsec_task_t*)this_task, es->th_id, es->virtual_process->vp_id,
+     __jdf2c_key_fns_BCAST_UP.key_hash(this_task->task_class->make_key( (parsec_taskpool_t*)this_task->taskpool, ((parsec_task_t*)this_task)->locals), NULL));
+#endif  /* defined(PARSEC_PROF_GRAPHER) */
+  release_deps_of_walk_BCAST_UP(es, this_task,
+      PARSEC_ACTION_RELEASE_REMOTE_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_REFS |
+      PARSEC_ACTION_RESHAPE_ON_RELEASE |
+      0x0,  /* mask of all dep_index */ 
+      NULL);
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static parsec_hook_return_t release_task_of_walk_BCAST_UP(parsec_execution_stream_t *es, parsec_task_t *this_task)
+{
+    const __parsec_walk_internal_taskpool_t *__parsec_tp =
+        (const __parsec_walk_internal_taskpool_t *)this_task->taskpool;
+    parsec_hash_table_t *ht = (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[0];
+    parsec_key_t key = this_task->task_class->make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals);
+    parsec_hashable_dependency_t *hash_dep = (parsec_hashable_dependency_t *)parsec_hash_table_remove(ht, key);
+    parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);
+    if( (PARSEC_UNDETERMINED_NB_TASKS == __parsec_tp->super.super.nb_tasks) ||
+        (0 == __parsec_tp->super.super.nb_tasks) ||
+        (PARSEC_RUNTIME_RESERVED_NB_TASKS == __parsec_tp->super.super.nb_tasks) ) {
+        /* don't spend time counting */
+        return parsec_release_task_to_mempool(es, this_task);
+    }
+    return parsec_release_task_to_mempool_update_nbtasks(es, this_task);
+}
+
+static char *walk_walk_BCAST_UP_internal_init_deps_key_functions_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_walk_internal_taskpool_t *__parsec_tp = (__parsec_walk_internal_taskpool_t *)user_data;
+  int rank = (__parsec_key) % __parsec_tp->BCAST_UP_rank_range + __parsec_tp->BCAST_UP_rank_min;
+  __parsec_key = __parsec_key / __parsec_tp->BCAST_UP_rank_range;
+  snprintf(buffer, buffer_size, "BCAST_UP(%d)", rank);
+  return buffer;
+}
+
+static parsec_key_fn_t walk_walk_BCAST_UP_internal_init_deps_key_functions = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = walk_walk_BCAST_UP_internal_init_deps_key_functions_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/* Needs: min-max - iterate */
+static int walk_BCAST_UP_internal_init(parsec_execution_stream_t * es, __parsec_walk_BCAST_UP_task_t * this_task)
+{
+  __parsec_walk_internal_taskpool_t *__parsec_tp = (__parsec_walk_internal_taskpool_t*)this_task->taskpool;
+int32_t __rank_min = 0x7fffffff, __rank_max = 0;int32_t __jdf2c_rank_min = 0x7fffffff, __jdf2c_rank_max = 0;  __parsec_walk_BCAST_UP_parsec_assignment_t assignments = {  .rank.value = 0 };
+  int32_t  rank;
+  int32_t __jdf2c_rank_start, __jdf2c_rank_end, __jdf2c_rank_inc;
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+  PARSEC_PROFILING_TRACE(es->es_profile,
+                         this_task->taskpool->profiling_array[START_KEY(this_task->task_class->task_class_id)],
+                         0,
+                         this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    __jdf2c_rank_start = 0;
+    __jdf2c_rank_end = (NP - 1);
+    __jdf2c_rank_inc = 1;
+    __rank_min = parsec_imin(__jdf2c_rank_start, __jdf2c_rank_end);
+    __rank_max = parsec_imax(__jdf2c_rank_start, __jdf2c_rank_end);
+    __jdf2c_rank_min = parsec_imin(__jdf2c_rank_min, __rank_min);
+    __jdf2c_rank_max = parsec_imax(__jdf2c_rank_max, __rank_max);
+    for(rank =  __jdf2c_rank_start;
+        rank <= __jdf2c_rank_end;
+        rank += __jdf2c_rank_inc) {
+    assignments.rank.value = rank;
+    if( !BCAST_UP_pred(rank) ) continue;
+  } /* Loop on normal range rank */
+  /* Set the range variables for the collision-free hash-computation */
+  __parsec_tp->BCAST_UP_rank_min   = __jdf2c_rank_min;
+  __parsec_tp->BCAST_UP_rank_range = (__jdf2c_rank_max - __jdf2c_rank_min) + 1;
+  this_task->status = PARSEC_TASK_STATUS_COMPLETE;
+
+  PARSEC_AYU_REGISTER_TASK(&walk_BCAST_UP);
+  __parsec_tp->super.super.dependencies_array[0] = PARSEC_OBJ_NEW(parsec_hash_table_t);
+  parsec_hash_table_init(__parsec_tp->super.super.dependencies_array[0], offsetof(parsec_hashable_dependency_t, ht_item), 10, walk_walk_BCAST_UP_internal_init_deps_key_functions, this_task->taskpool);
+  __parsec_tp->repositories[0] = data_repo_create_nothreadsafe(PARSEC_DEFAULT_DATAREPO_HASH_LENGTH, __jdf2c_key_fns_BCAST_UP, (parsec_taskpool_t*)__parsec_tp, 1);
+(void)__rank_min; (void)__rank_max;  (void)__jdf2c_rank_start; (void)__jdf2c_rank_end; (void)__jdf2c_rank_inc;  (void)assignments; (void)__parsec_tp; (void)es;
+  if(1 == parsec_atomic_fetch_dec_int32(&__parsec_tp->sync_point)) {
+    /* Last initialization task complete. Update the number of tasks. */
+    __parsec_tp->super.super.tdm.module->taskpool_addto_nb_tasks(&__parsec_tp->super.super, undetermined_nb_tasks(__parsec_tp));
+    parsec_mfence();  /* write memory barrier to guarantee that the scheduler gets the correct number of tasks */
+    parsec_taskpool_enable((parsec_taskpool_t*)__parsec_tp, &__parsec_tp->startup_queue,
+                           (parsec_task_t*)this_task, es, __parsec_tp->super.super.nb_pending_actions);
+    __parsec_tp->super.super.tdm.module->taskpool_ready(&__parsec_tp->super.super);
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+    PARSEC_PROFILING_TRACE(es->es_profile,
+                           this_task->taskpool->profiling_array[2 * this_task->task_class->task_class_id + 1],
+                           0,
+                           this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    return PARSEC_HOOK_RETURN_DONE;
+  }
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static const __parsec_chore_t __walk_BCAST_UP_chores[] ={
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+    { .type     = PARSEC_DEV_CPU,
+      .evaluate = (parsec_evaluate_function_t*)NULL,
+      .hook     = (parsec_hook_t*)hook_of_walk_BCAST_UP },
+#endif  /* defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+    { .type     = PARSEC_DEV_NONE,
+      .evaluate = NULL,
+      .hook     = (parsec_hook_t*)NULL },  /* End marker */
+};
+
+static const parsec_task_class_t walk_BCAST_UP = {
+  .name = "BCAST_UP",
+  .task_class_id = 0,
+  .nb_flows = 1,
+  .nb_parameters = 1,
+  .nb_locals = 1,
+  .task_class_type = PARSEC_TASK_CLASS_TYPE_PTG,
+  .params = { &symb_walk_BCAST_UP_rank, NULL },
+  .locals = { &symb_walk_BCAST_UP_rank, NULL },
+  .data_affinity = (parsec_data_ref_fn_t*)affinity_of_walk_BCAST_UP,
+  .initial_data = (parsec_data_ref_fn_t*)affinity_of_walk_BCAST_UP,
+  .final_data = (parsec_data_ref_fn_t*)affinity_of_walk_BCAST_UP,
+  .priority = NULL,
+  .properties = properties_of_walk_BCAST_UP,
+#if MAX_PARAM_COUNT < 0  /* number of read flows of BCAST_UP */
+  #error Too many read flows for task BCAST_UP
+#endif  /* MAX_PARAM_COUNT */
+#if MAX_PARAM_COUNT < 0  /* number of write flows of BCAST_UP */
+  #error Too many write flows for task BCAST_UP
+#endif  /* MAX_PARAM_COUNT */
+  .in = { &flow_of_walk_BCAST_UP_for_RL, NULL },
+  .out = { NULL },
+  .flags = 0x0 | PARSEC_USE_DEPS_MASK,
+  .dependencies_goal = 0x1,
+  .make_key = __jdf2c_make_key_BCAST_UP,
+  .task_snprintf = parsec_task_snprintf,
+#if defined(PARSEC_PROF_TRACE)
+  .profile_info = &parsec_task_profile_info,
+#endif
+  .key_functions = &__jdf2c_key_fns_BCAST_UP,
+  .fini = (parsec_hook_t*)NULL,
+  .incarnations = __walk_BCAST_UP_chores,
+  .find_deps = parsec_hash_find_deps,
+  .update_deps = parsec_update_deps_with_mask,
+  .iterate_successors = (parsec_traverse_function_t*)NULL,
+  .iterate_predecessors = (parsec_traverse_function_t*)iterate_predecessors_of_walk_BCAST_UP,
+  .release_deps = (parsec_release_deps_t*)release_deps_of_walk_BCAST_UP,
+  .prepare_output = (parsec_hook_t*)NULL,
+  .prepare_input = (parsec_hook_t*)data_lookup_of_walk_BCAST_UP,
+  .time_estimate = NULL,
+  .get_datatype = datatype_lookup_of_walk_BCAST_UP,
+  .complete_execution = (parsec_hook_t*)complete_hook_of_walk_BCAST_UP,
+  .release_task = &release_task_of_walk_BCAST_UP,
+#if defined(PARSEC_SIM)
+  .sim_cost_fct = (parsec_sim_cost_fct_t*)NULL,
+#endif
+};
+
+
+static const parsec_task_class_t *walk_task_classes[] = {
+  &walk_BCAST_UP,
+  &walk_UP,
+  &walk_DOWN,
+  &walk_DO_DOWN
+};
+
+static void walk_startup(parsec_context_t *context, __parsec_walk_internal_taskpool_t *__parsec_tp, parsec_list_item_t ** ready_tasks)
+{
+  uint32_t i, supported_dev = 0;
+ 
+  for( i = 0; i < parsec_nb_devices; i++ ) {
+    if( !(__parsec_tp->super.super.devices_index_mask & (1<<i)) ) continue;
+    parsec_device_module_t* device = parsec_mca_device_get(i);
+    parsec_data_collection_t* parsec_dc;
+ 
+    if(NULL == device) continue;
+    if(NULL != device->taskpool_register)
+      if( PARSEC_SUCCESS != device->taskpool_register(device, (parsec_taskpool_t*)__parsec_tp) ) {
+        parsec_debug_verbose(5, parsec_debug_output, "Device %s refused to register taskpool %p", device->name, __parsec_tp);
+        __parsec_tp->super.super.devices_index_mask &= ~(1 << device->device_index);
+        continue;
+      }
+    if(NULL != device->memory_register) {  /* Register all the data */
+      parsec_dc = (parsec_data_collection_t*)__parsec_tp->super._g_tree;
+      if( (NULL != parsec_dc->register_memory) &&
+          (PARSEC_SUCCESS != parsec_dc->register_memory(parsec_dc, device)) ) {
+        parsec_debug_verbose(3, parsec_debug_output, "Device %s refused to register memory for data %s (%p) from taskpool %p",
+                     device->name, parsec_dc->key_base, parsec_dc, __parsec_tp);
+        __parsec_tp->super.super.devices_index_mask &= ~(1 << device->device_index);
+      }
+      parsec_dc = (parsec_data_collection_t*)__parsec_tp->super._g_fakeDesc;
+      if( (NULL != parsec_dc->register_memory) &&
+          (PARSEC_SUCCESS != parsec_dc->register_memory(parsec_dc, device)) ) {
+        parsec_debug_verbose(3, parsec_debug_output, "Device %s refused to register memory for data %s (%p) from taskpool %p",
+                     device->name, parsec_dc->key_base, parsec_dc, __parsec_tp);
+        __parsec_tp->super.super.devices_index_mask &= ~(1 << device->device_index);
+      }
+    }
+    supported_dev |= device->type;
+  }
+  /* Remove all the chores without a backend device */
+  for( i = 0; i < PARSEC_walk_NB_TASK_CLASSES; i++ ) {
+    parsec_task_class_t* tc = (parsec_task_class_t*)__parsec_tp->super.super.task_classes_array[i];
+    __parsec_chore_t* chores = (__parsec_chore_t*)tc->incarnations;
+    uint32_t idx = 0, j;
+    for( j = 0; PARSEC_DEV_NONE != chores[j].type; j++ ) {
+      if( !(supported_dev & chores[j].type) ) continue;
+      if( j != idx ) {
+        chores[idx] = chores[j];
+        parsec_debug_verbose(20, parsec_debug_output, "Device type %i disabled for function %s"
+, chores[j].type, tc->name);
+      }
+      idx++;
+    }
+    chores[idx].type     = PARSEC_DEV_NONE;
+    chores[idx].evaluate = NULL;
+    chores[idx].hook     = NULL;
+    /* Create the initialization tasks for each taskclass */
+    parsec_task_t* task = (parsec_task_t*)parsec_thread_mempool_allocate(context->virtual_processes[0]->execution_streams[0]->context_mempool);
+    PARSEC_OBJ_CONSTRUCT(task, parsec_task_t); /* construct called only when new, force-construct it again */
+    task->taskpool = (parsec_taskpool_t *)__parsec_tp;
+    task->chore_mask = PARSEC_DEV_CPU;
+    memset(&task->locals, 0, sizeof(parsec_assignment_t) * MAX_LOCAL_COUNT);
+    PARSEC_LIST_ITEM_SINGLETON(task);
+    task->priority = -1;
+    task->task_class = task->taskpool->task_classes_array[PARSEC_walk_NB_TASK_CLASSES + i];
+    int where = i % context->nb_vp;
+    if( NULL == ready_tasks[where] ) ready_tasks[where] = &task->super;
+    else ready_tasks[where] = parsec_list_item_ring_push(ready_tasks[where], &task->super);
+  }
+}
+static void __parsec_walk_internal_destructor( __parsec_walk_internal_taskpool_t *__parsec_tp )
+{
+  uint32_t i;
+  parsec_taskpool_unregister( &__parsec_tp->super.super );
+  if(NULL != __parsec_tp->super.super.tdm.module) __parsec_tp->super.super.tdm.module->unmonitor_taskpool(&__parsec_tp->super.super);
+  for( i = 0; i < (uint32_t)(2 * __parsec_tp->super.super.nb_task_classes); i++ ) {  /* Extra startup function added at the end */
+    parsec_task_class_t* tc = (parsec_task_class_t*)__parsec_tp->super.super.task_classes_array[i];
+    free((void*)tc->incarnations);
+    free(tc);
+  }
+  free(__parsec_tp->super.super.task_classes_array); __parsec_tp->super.super.task_classes_array = NULL;
+  __parsec_tp->super.super.nb_task_classes = 0;
+
+  for(i = 0; i < (uint32_t)__parsec_tp->super.arenas_datatypes_size; i++) {
+    if( NULL != __parsec_tp->super.arenas_datatypes[i].arena ) {
+      PARSEC_OBJ_RELEASE(__parsec_tp->super.arenas_datatypes[i].arena);
+    }
+  }
+  /* Destroy the data repositories for this object */
+   data_repo_destroy_nothreadsafe(__parsec_tp->repositories[3]);  /* DO_DOWN */
+   data_repo_destroy_nothreadsafe(__parsec_tp->repositories[2]);  /* DOWN */
+   data_repo_destroy_nothreadsafe(__parsec_tp->repositories[1]);  /* UP */
+   data_repo_destroy_nothreadsafe(__parsec_tp->repositories[0]);  /* BCAST_UP */
+  /* Release the dependencies arrays for this object */
+  parsec_hash_table_fini( (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[3] );
+  PARSEC_OBJ_RELEASE(__parsec_tp->super.super.dependencies_array[3]);
+  __parsec_tp->super.super.dependencies_array[3] = NULL;
+  parsec_hash_table_fini( (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[2] );
+  PARSEC_OBJ_RELEASE(__parsec_tp->super.super.dependencies_array[2]);
+  __parsec_tp->super.super.dependencies_array[2] = NULL;
+  parsec_hash_table_fini( (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[1] );
+  PARSEC_OBJ_RELEASE(__parsec_tp->super.super.dependencies_array[1]);
+  __parsec_tp->super.super.dependencies_array[1] = NULL;
+  parsec_hash_table_fini( (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[0] );
+  PARSEC_OBJ_RELEASE(__parsec_tp->super.super.dependencies_array[0]);
+  __parsec_tp->super.super.dependencies_array[0] = NULL;
+  free( __parsec_tp->super.super.dependencies_array );
+  __parsec_tp->super.super.dependencies_array = NULL;
+  /* Unregister all the data */
+  uint32_t _i;
+  for( _i = 0; _i < parsec_nb_devices; _i++ ) {
+    parsec_device_module_t* device;
+    parsec_data_collection_t* parsec_dc;
+    if(!(__parsec_tp->super.super.devices_index_mask & (1 << _i))) continue;
+    if((NULL == (device = parsec_mca_device_get(_i))) || (NULL == device->memory_unregister)) continue;
+    parsec_dc = (parsec_data_collection_t*)__parsec_tp->super._g_tree;
+  if( NULL != parsec_dc->unregister_memory ) { (void)parsec_dc->unregister_memory(parsec_dc, device); };
+  parsec_dc = (parsec_data_collection_t*)__parsec_tp->super._g_fakeDesc;
+  if( NULL != parsec_dc->unregister_memory ) { (void)parsec_dc->unregister_memory(parsec_dc, device); };
+}
+  /* Unregister the taskpool from the devices */
+  for( i = 0; i < parsec_nb_devices; i++ ) {
+    if(!(__parsec_tp->super.super.devices_index_mask & (1 << i))) continue;
+    __parsec_tp->super.super.devices_index_mask ^= (1 << i);
+    parsec_device_module_t* device = parsec_mca_device_get(i);
+    if((NULL == device) || (NULL == device->taskpool_unregister)) continue;
+    if( PARSEC_SUCCESS != device->taskpool_unregister(device, &__parsec_tp->super.super) ) continue;
+  }
+  free(__parsec_tp->super.super.taskpool_name); __parsec_tp->super.super.taskpool_name = NULL;
+}
+
+void __parsec_walk_internal_constructor(__parsec_walk_internal_taskpool_t* __parsec_tp)
+{
+  parsec_task_class_t* tc;
+  uint32_t i, j;
+
+  __parsec_tp->super.super.nb_task_classes = PARSEC_walk_NB_TASK_CLASSES;
+  __parsec_tp->super.super.devices_index_mask = PARSEC_DEVICES_ALL;
+  __parsec_tp->super.super.taskpool_name = strdup("walk");
+  parsec_termdet_open_module(&__parsec_tp->super.super, "local");
+  __parsec_tp->super.super.tdm.module->monitor_taskpool(&__parsec_tp->super.super,
+                                                        parsec_taskpool_termination_detected);
+  __parsec_tp->super.super.update_nb_runtime_task = parsec_add_fetch_runtime_task;
+  __parsec_tp->super.super.dependencies_array = (void **)
+              calloc(__parsec_tp->super.super.nb_task_classes, sizeof(void*));
+  /* Twice the size to hold the startup tasks function_t */
+  __parsec_tp->super.super.task_classes_array = (const parsec_task_class_t**)
+              calloc((2 * PARSEC_walk_NB_TASK_CLASSES + 1), sizeof(parsec_task_class_t*));
+  __parsec_tp->super.super.tdm.module->taskpool_addto_runtime_actions(&__parsec_tp->super.super, PARSEC_walk_NB_TASK_CLASSES);  /* for the startup tasks */
+  __parsec_tp->super.super.taskpool_type = PARSEC_TASKPOOL_TYPE_PTG;
+  __parsec_tp->sync_point = __parsec_tp->super.super.nb_task_classes;
+  __parsec_tp->initial_number_tasks = 0;
+  __parsec_tp->startup_queue = NULL;
+  for( i = 0; i < __parsec_tp->super.super.nb_task_classes; i++ ) {
+    __parsec_tp->super.super.task_classes_array[i] = tc = malloc(sizeof(parsec_task_class_t));
+    memcpy(tc, walk_task_classes[i], sizeof(parsec_task_class_t));
+    for( j = 0; PARSEC_DEV_NONE != tc->incarnations[j].type; j++);  /* compute the number of incarnations */
+    tc->incarnations = (__parsec_chore_t*)malloc((j+1) * sizeof(__parsec_chore_t));
+        memcpy((__parsec_chore_t*)tc->incarnations, walk_task_classes[i]->incarnations, (j+1) * sizeof(__parsec_chore_t));
+
+    /* Add a placeholder for initialization and startup task */
+    __parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+i] = tc = (parsec_task_class_t*)malloc(sizeof(parsec_task_class_t));
+    memcpy(tc, (void*)&__parsec_generic_startup, sizeof(parsec_task_class_t));
+    tc->task_class_id = __parsec_tp->super.super.nb_task_classes + i;
+    tc->incarnations = (__parsec_chore_t*)malloc(2 * sizeof(__parsec_chore_t));
+    memcpy((__parsec_chore_t*)tc->incarnations, (void*)__parsec_generic_startup.incarnations, 2 * sizeof(__parsec_chore_t));
+    tc->release_task = parsec_release_task_to_mempool_and_count_as_runtime_tasks;
+  }
+  /* Startup task for DO_DOWN */
+  tc = (parsec_task_class_t *)__parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+0];
+  tc->name = "Startup for DO_DOWN";
+  tc->prepare_input = (parsec_hook_t*)walk_DO_DOWN_internal_init;
+  /* Startup task for DOWN */
+  tc = (parsec_task_class_t *)__parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+1];
+  tc->name = "Startup for DOWN";
+  tc->prepare_input = (parsec_hook_t*)walk_DOWN_internal_init;
+  ((__parsec_chore_t*)&tc->incarnations[0])->hook = (parsec_hook_t *)my_walk_startup;
+  /* Startup task for UP */
+  tc = (parsec_task_class_t *)__parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+2];
+  tc->name = "Startup for UP";
+  tc->prepare_input = (parsec_hook_t*)walk_UP_internal_init;
+  /* Startup task for BCAST_UP */
+  tc = (parsec_task_class_t *)__parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+3];
+  tc->name = "Startup for BCAST_UP";
+  tc->prepare_input = (parsec_hook_t*)walk_BCAST_UP_internal_init;
+  /* Compute the number of arenas_datatypes: */
+  /*   PARSEC_walk_DEFAULT_ARENA  ->  0 */
+  __parsec_tp->super.arenas_datatypes_size = 1;
+  memset(&__parsec_tp->super.arenas_datatypes[0], 0, __parsec_tp->super.arenas_datatypes_size*sizeof(parsec_arena_datatype_t));
+  /* If profiling is enabled, the keys for profiling */
+#  if defined(PARSEC_PROF_TRACE)
+  __parsec_tp->super.super.profiling_array = walk_profiling_array;
+  if( -2 == walk_profiling_array[0] ) {
+    #if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+parsec_profiling_add_dictionary_keyword("walk::DO_DOWN::internal init", "fill:34D8D8",
+                                       0,
+                                       NULL,
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(walk_DO_DOWN.task_class_id  + PARSEC_walk_NB_TASK_CLASSES)/* DO_DOWN (internal init) start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(walk_DO_DOWN.task_class_id  + PARSEC_walk_NB_TASK_CLASSES)/* DO_DOWN (internal init) end key */]);
+#endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+parsec_profiling_add_dictionary_keyword("walk::DO_DOWN", "fill:CC2828",
+                                       sizeof(parsec_task_prof_info_t)+2*sizeof(parsec_assignment_t),
+                                       "dc_key{uint64_t};priority{int32_t};dc_dataid{uint32_t};tcid{uint32_t};trc{int32_t};n{int32_t};l{int32_t}",
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(walk_DO_DOWN.task_class_id) /* DO_DOWN start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(walk_DO_DOWN.task_class_id) /* DO_DOWN end key */]);
+
+    #if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+parsec_profiling_add_dictionary_keyword("walk::DOWN::internal init", "fill:8634D8",
+                                       0,
+                                       NULL,
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(walk_DOWN.task_class_id  + PARSEC_walk_NB_TASK_CLASSES)/* DOWN (internal init) start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(walk_DOWN.task_class_id  + PARSEC_walk_NB_TASK_CLASSES)/* DOWN (internal init) end key */]);
+#endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+parsec_profiling_add_dictionary_keyword("walk::DOWN", "fill:7ACC28",
+                                       sizeof(parsec_task_prof_info_t)+3*sizeof(parsec_assignment_t),
+                                       "dc_key{uint64_t};priority{int32_t};dc_dataid{uint32_t};tcid{uint32_t};trc{int32_t};n{int32_t};l{int32_t};node_exists{int32_t}",
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(walk_DOWN.task_class_id) /* DOWN start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(walk_DOWN.task_class_id) /* DOWN end key */]);
+
+    #if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+parsec_profiling_add_dictionary_keyword("walk::UP::internal init", "fill:D83434",
+                                       0,
+                                       NULL,
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(walk_UP.task_class_id  + PARSEC_walk_NB_TASK_CLASSES)/* UP (internal init) start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(walk_UP.task_class_id  + PARSEC_walk_NB_TASK_CLASSES)/* UP (internal init) end key */]);
+#endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+parsec_profiling_add_dictionary_keyword("walk::UP", "fill:28CCCC",
+                                       sizeof(parsec_task_prof_info_t)+2*sizeof(parsec_assignment_t),
+                                       "dc_key{uint64_t};priority{int32_t};dc_dataid{uint32_t};tcid{uint32_t};trc{int32_t};n{int32_t};l{int32_t}",
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(walk_UP.task_class_id) /* UP start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(walk_UP.task_class_id) /* UP end key */]);
+
+    #if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+parsec_profiling_add_dictionary_keyword("walk::BCAST_UP::internal init", "fill:86D834",
+                                       0,
+                                       NULL,
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(walk_BCAST_UP.task_class_id  + PARSEC_walk_NB_TASK_CLASSES)/* BCAST_UP (internal init) start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(walk_BCAST_UP.task_class_id  + PARSEC_walk_NB_TASK_CLASSES)/* BCAST_UP (internal init) end key */]);
+#endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+parsec_profiling_add_dictionary_keyword("walk::BCAST_UP", "fill:7A28CC",
+                                       sizeof(parsec_task_prof_info_t)+1*sizeof(parsec_assignment_t),
+                                       "dc_key{uint64_t};priority{int32_t};dc_dataid{uint32_t};tcid{uint32_t};trc{int32_t};rank{int32_t}",
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(walk_BCAST_UP.task_class_id) /* BCAST_UP start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(walk_BCAST_UP.task_class_id) /* BCAST_UP end key */]);
+
+  }
+#  endif /* defined(PARSEC_PROF_TRACE) */
+  __parsec_tp->super.super.repo_array = __parsec_tp->repositories;
+  __parsec_tp->super.super.startup_hook = (parsec_startup_fn_t)walk_startup;
+  (void)parsec_taskpool_reserve_id((parsec_taskpool_t*)__parsec_tp);
+}
+
+  /** Generate class declaration and instance using the above constructor and destructor */
+  PARSEC_OBJ_CLASS_DECLARATION(__parsec_walk_internal_taskpool_t);
+  PARSEC_OBJ_CLASS_INSTANCE(__parsec_walk_internal_taskpool_t, parsec_walk_taskpool_t,
+                            __parsec_walk_internal_constructor, __parsec_walk_internal_destructor);
+
+#undef tree
+#undef NP
+#undef fakeDesc
+#undef on_fct_param
+#undef on_node_down
+#undef on_node_up
+#undef verbose
+
+parsec_walk_taskpool_t *parsec_walk_new(tree_dist_t * tree /* data tree */, int NP, parsec_data_collection_t * fakeDesc /* data fakeDesc */, void* on_fct_param, walk_fn_t on_node_down, walk_fn_t on_node_up, int verbose)
+{
+  __parsec_walk_internal_taskpool_t *__parsec_tp = PARSEC_OBJ_NEW(__parsec_walk_internal_taskpool_t);
+  /* Dump the hidden parameters with default values */
+
+  /* Now the Parameter-dependent structures: */
+  __parsec_tp->super._g_tree = tree;
+  __parsec_tp->super._g_NP = NP;
+  __parsec_tp->super._g_fakeDesc = fakeDesc;
+  __parsec_tp->super._g_on_fct_param = on_fct_param;
+  __parsec_tp->super._g_on_node_down = on_node_down;
+  __parsec_tp->super._g_on_node_up = on_node_up;
+  __parsec_tp->super._g_verbose = verbose;
+  PARSEC_AYU_REGISTER_TASK(&walk_DO_DOWN);
+  PARSEC_AYU_REGISTER_TASK(&walk_DOWN);
+  PARSEC_AYU_REGISTER_TASK(&walk_UP);
+  PARSEC_AYU_REGISTER_TASK(&walk_BCAST_UP);
+  __parsec_tp->super.super.startup_hook = (parsec_startup_fn_t)walk_startup;
+  (void)parsec_taskpool_reserve_id((parsec_taskpool_t*)__parsec_tp);
+/* Prevent warnings related to not used hidden global variables */
+;
+  return (parsec_walk_taskpool_t*)__parsec_tp;
+}
+
+
+static uint64_t my_simple_tree_hash(int n, int l)
+{
+    return (((uint64_t)n) << 32) | ((uint64_t)l);
+}
+
+static parsec_key_t up_make_key(const parsec_taskpool_t* __tp, const parsec_assignment_t *_as)
+{
+    const struct __parsec_walk_UP_assignment_s * assignments = (const struct __parsec_walk_UP_assignment_s *)_as;
+    (void)__tp;
+    return (parsec_key_t)my_simple_tree_hash(assignments->n.value, assignments->l.value);
+}
+
+static parsec_key_t down_make_key(const parsec_taskpool_t* __tp, const parsec_assignment_t *_as)
+{
+    const struct __parsec_walk_DOWN_assignment_s * assignments = (const struct __parsec_walk_DOWN_assignment_s *)_as;
+    (void)__tp;
+    return (parsec_key_t)my_simple_tree_hash(assignments->n.value, assignments->l.value);
+}
+
+static parsec_key_t do_down_make_key(const parsec_taskpool_t* __tp, const parsec_assignment_t *_as)
+{
+    const struct __parsec_walk_DO_DOWN_assignment_s * assignments = (struct __parsec_walk_DO_DOWN_assignment_s *)_as;
+    (void)__tp;
+    return (parsec_key_t)my_simple_tree_hash(assignments->n.value, assignments->l.value);
+}
+
+static uint32_t undetermined_nb_tasks(struct __parsec_walk_internal_taskpool_s *__tp)
+{
+    (void)__tp;
+    return PARSEC_UNDETERMINED_NB_TASKS;
+}
+
+static int my_walk_startup(parsec_execution_stream_t * es, __parsec_walk_DOWN_task_t * this_task)
+{
+  __parsec_walk_DOWN_task_t *new_task;
+  __parsec_walk_internal_taskpool_t *__tp = (__parsec_walk_internal_taskpool_t *) this_task->taskpool;
+  int vpid = 0;
+  parsec_context_t *context = __tp->super.super.context;
+
+  if ( ((parsec_data_collection_t *)__tp->super._g_tree)->myrank != 0)
+      return PARSEC_HOOK_RETURN_DONE;
+  if (NULL != ((parsec_data_collection_t *) __tp->super._g_tree)->vpid_of) {
+      vpid = ((parsec_data_collection_t *) __tp->super._g_tree)->vpid_of((parsec_data_collection_t *) __tp->super._g_tree, 0, 0);
+      (void)vpid;
+      assert(context->nb_vp >= vpid);
+  }
+  new_task = (__parsec_walk_DOWN_task_t *) parsec_thread_mempool_allocate(context->virtual_processes[0]->execution_streams[0]->context_mempool);
+  new_task->status = PARSEC_TASK_STATUS_NONE;
+  new_task->taskpool = this_task->taskpool;
+  new_task->task_class = __tp->super.super.task_classes_array[walk_DOWN.task_class_id];
+  new_task->chore_mask = PARSEC_DEV_ALL;
+
+  new_task->locals.n.value = 0;
+  new_task->locals.l.value = 0;
+  new_task->locals.node_exists.value = 1;
+
+  new_task->priority = 1;
+  new_task->repo_entry = NULL;
+
+  new_task->data._f_RL.source_repo = NULL;
+  new_task->data._f_RL.source_repo_entry = NULL;
+  new_task->data._f_RL.data_in = NULL;
+  new_task->data._f_RL.data_out = NULL;
+  new_task->data._f_RL.fulfill = 0;
+
+  PARSEC_LIST_ITEM_SINGLETON(new_task);
+  __parsec_schedule(es, (parsec_task_t *)new_task, 0);
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+PARSEC_OBJ_CLASS_INSTANCE(parsec_walk_taskpool_t, parsec_taskpool_t, NULL, NULL);
+
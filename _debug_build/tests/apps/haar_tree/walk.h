@@ -0,0 +1,159 @@
+#ifndef _walk_h_
+#define _walk_h_
+#include "parsec.h"
+#include "parsec/parsec_internal.h"
+#include "parsec/remote_dep.h"
+
+BEGIN_C_DECLS
+
+#define PARSEC_walk_DEFAULT_ADT_IDX    0
+#define PARSEC_walk_ADT_IDX_MAX       1
+typedef struct parsec_walk_taskpool_s {
+  parsec_taskpool_t super;
+  /* The list of globals */
+  tree_dist_t * _g_tree /* data tree */;
+  int _g_NP;
+  parsec_data_collection_t * _g_fakeDesc /* data fakeDesc */;
+  void* _g_on_fct_param;
+  walk_fn_t _g_on_node_down;
+  walk_fn_t _g_on_node_up;
+  int _g_verbose;
+  /* The array of datatypes (DEFAULT and co.) */
+  parsec_arena_datatype_t arenas_datatypes[PARSEC_walk_ADT_IDX_MAX];
+  uint32_t arenas_datatypes_size;
+} parsec_walk_taskpool_t;
+
+/** Beware that this object is not a superset of the internal object, and as a result
+ *  we should never create one directly. Instead we should rely on the creation of the
+ *  internal object (__parsec_walk_taskpool_t).
+ */
+PARSEC_OBJ_CLASS_DECLARATION(parsec_walk_taskpool_t);
+extern parsec_walk_taskpool_t *parsec_walk_new(tree_dist_t * _g_tree /* data tree */, int _g_NP, parsec_data_collection_t * _g_fakeDesc /* data fakeDesc */, void* _g_on_fct_param, walk_fn_t _g_on_node_down, walk_fn_t _g_on_node_up, int _g_verbose);
+
+#if MAX_LOCAL_COUNT < 2  /* number of parameters and locals DO_DOWN */
+  #error Too many parameters and local variables (2 out of MAX_LOCAL_COUNT) for task DO_DOWN
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_walk_DO_DOWN_assignment_s {
+  parsec_assignment_t n;
+  parsec_assignment_t l;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-2];
+} __parsec_walk_DO_DOWN_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 2  /* total number of flows for task DO_DOWN */
+  #error Too many flows (2 out of MAX_PARAM_COUNT) for task DO_DOWN
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_walk_DO_DOWN_data_s {
+  parsec_data_pair_t _f_NODE;
+  parsec_data_pair_t _f_RL;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-2];
+} __parsec_walk_DO_DOWN_data_t;
+
+typedef struct __parsec_walk_DO_DOWN_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_walk_DO_DOWN_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_walk_DO_DOWN_data_s data;
+} __parsec_walk_DO_DOWN_task_t;
+
+
+#if MAX_LOCAL_COUNT < 3  /* number of parameters and locals DOWN */
+  #error Too many parameters and local variables (3 out of MAX_LOCAL_COUNT) for task DOWN
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_walk_DOWN_assignment_s {
+  parsec_assignment_t n;
+  parsec_assignment_t l;
+  parsec_assignment_t node_exists;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-3];
+} __parsec_walk_DOWN_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 1  /* total number of flows for task DOWN */
+  #error Too many flows (1 out of MAX_PARAM_COUNT) for task DOWN
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_walk_DOWN_data_s {
+  parsec_data_pair_t _f_RL;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-1];
+} __parsec_walk_DOWN_data_t;
+
+typedef struct __parsec_walk_DOWN_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_walk_DOWN_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_walk_DOWN_data_s data;
+} __parsec_walk_DOWN_task_t;
+
+
+#if MAX_LOCAL_COUNT < 2  /* number of parameters and locals UP */
+  #error Too many parameters and local variables (2 out of MAX_LOCAL_COUNT) for task UP
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_walk_UP_assignment_s {
+  parsec_assignment_t n;
+  parsec_assignment_t l;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-2];
+} __parsec_walk_UP_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 4  /* total number of flows for task UP */
+  #error Too many flows (4 out of MAX_PARAM_COUNT) for task UP
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_walk_UP_data_s {
+  parsec_data_pair_t _f_NODE;
+  parsec_data_pair_t _f_LEFT;
+  parsec_data_pair_t _f_RIGHT;
+  parsec_data_pair_t _f_RL;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-4];
+} __parsec_walk_UP_data_t;
+
+typedef struct __parsec_walk_UP_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_walk_UP_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_walk_UP_data_s data;
+} __parsec_walk_UP_task_t;
+
+
+#if MAX_LOCAL_COUNT < 1  /* number of parameters and locals BCAST_UP */
+  #error Too many parameters and local variables (1 out of MAX_LOCAL_COUNT) for task BCAST_UP
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_walk_BCAST_UP_assignment_s {
+  parsec_assignment_t rank;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-1];
+} __parsec_walk_BCAST_UP_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 1  /* total number of flows for task BCAST_UP */
+  #error Too many flows (1 out of MAX_PARAM_COUNT) for task BCAST_UP
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_walk_BCAST_UP_data_s {
+  parsec_data_pair_t _f_RL;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-1];
+} __parsec_walk_BCAST_UP_data_t;
+
+typedef struct __parsec_walk_BCAST_UP_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_walk_BCAST_UP_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_walk_BCAST_UP_data_s data;
+} __parsec_walk_BCAST_UP_task_t;
+
+
+END_C_DECLS
+
+#endif /* _walk_h_ */ 
@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/apps/merge_sort/main.c" "tests/apps/merge_sort/CMakeFiles/merge_sort.dir/main.c.o" "gcc" "tests/apps/merge_sort/CMakeFiles/merge_sort.dir/main.c.o.d"
+  "/root/repo/_debug_build/tests/apps/merge_sort/merge_sort.c" "tests/apps/merge_sort/CMakeFiles/merge_sort.dir/merge_sort.c.o" "gcc" "tests/apps/merge_sort/CMakeFiles/merge_sort.dir/merge_sort.c.o.d"
+  "/root/repo/tests/apps/merge_sort/merge_sort_wrapper.c" "tests/apps/merge_sort/CMakeFiles/merge_sort.dir/merge_sort_wrapper.c.o" "gcc" "tests/apps/merge_sort/CMakeFiles/merge_sort.dir/merge_sort_wrapper.c.o.d"
+  "/root/repo/tests/apps/merge_sort/sort_data.c" "tests/apps/merge_sort/CMakeFiles/merge_sort.dir/sort_data.c.o" "gcc" "tests/apps/merge_sort/CMakeFiles/merge_sort.dir/sort_data.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_debug_build/parsec/CMakeFiles/parsec.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "/root/repo/_debug_build/parsec/include/fortran")
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/merge_sort.dir/main.c.o"
+  "CMakeFiles/merge_sort.dir/main.c.o.d"
+  "CMakeFiles/merge_sort.dir/merge_sort.c.o"
+  "CMakeFiles/merge_sort.dir/merge_sort.c.o.d"
+  "CMakeFiles/merge_sort.dir/merge_sort_wrapper.c.o"
+  "CMakeFiles/merge_sort.dir/merge_sort_wrapper.c.o.d"
+  "CMakeFiles/merge_sort.dir/sort_data.c.o"
+  "CMakeFiles/merge_sort.dir/sort_data.c.o.d"
+  "merge_sort"
+  "merge_sort.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/merge_sort.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
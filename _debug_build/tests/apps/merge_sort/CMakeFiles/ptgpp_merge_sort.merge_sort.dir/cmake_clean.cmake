@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ptgpp_merge_sort.merge_sort"
+  "merge_sort.c"
+  "merge_sort.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ptgpp_merge_sort.merge_sort.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
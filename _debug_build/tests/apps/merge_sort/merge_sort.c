@@ -0,0 +1,4648 @@
+#include "parsec.h"
+#include "parsec/parsec_internal.h"
+#include "parsec/ayudame.h"
+#include "parsec/execution_stream.h"
+#include "parsec/parsec_binary_profile.h"
+#include "parsec/mca/device/device_gpu.h"
+#if defined(PARSEC_HAVE_DEV_CUDA_SUPPORT)
+#include "parsec/mca/device/cuda/device_cuda.h"
+#endif  /* defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) */
+#if defined(PARSEC_HAVE_DEV_HIP_SUPPORT)
+#include "parsec/mca/device/hip/device_hip.h"
+#endif  /* defined(PARSEC_HAVE_DEV_HIP_SUPPORT) */
+#if defined(_MSC_VER) || defined(__MINGW32__)
+#  include <malloc.h>
+#else
+#  include <alloca.h>
+#endif  /* defined(_MSC_VER) || defined(__MINGW32__) */
+
+#define PARSEC_merge_sort_NB_TASK_CLASSES 4
+#define PARSEC_merge_sort_NB_DATA 1
+
+typedef struct __parsec_merge_sort_internal_taskpool_s __parsec_merge_sort_internal_taskpool_t;
+struct parsec_merge_sort_internal_taskpool_s;
+
+/** Predeclarations of the parsec_task_class_t */
+static const parsec_task_class_t merge_sort_RESULT;
+static const parsec_task_class_t merge_sort_REDUCE;
+static const parsec_task_class_t merge_sort_SORT;
+static const parsec_task_class_t merge_sort_INIT_DATA;
+/** Predeclarations of the parameters */
+static const parsec_flow_t flow_of_merge_sort_RESULT_for_C;
+static const parsec_flow_t flow_of_merge_sort_REDUCE_for_C;
+static const parsec_flow_t flow_of_merge_sort_REDUCE_for_A;
+static const parsec_flow_t flow_of_merge_sort_REDUCE_for_B;
+static const parsec_flow_t flow_of_merge_sort_SORT_for_A;
+static const parsec_flow_t flow_of_merge_sort_INIT_DATA_for_A;
+/*
+ * Copyright (c) 2013-2022 The University of Tennessee and The University
+ *                         of Tennessee Research Foundation.  All rights
+ *                         reserved.
+ */
+#include "parsec/data_distribution.h"
+#include "parsec/data_dist/matrix/matrix.h"
+#include "parsec/data.h"
+#include "parsec/utils/mca_param.h"
+#include "parsec/arena.h"
+#include <stdlib.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+#define SWAP(_x, _y) {int t = _x; _x = _y; _y = t;}
+#define SET(_a,_b,_c,_d,_e, _A) {_A[0]=_a; _A[1]=_b; _A[2]=_c; _A[3]=_d; _A[4]=_e;}
+
+int sort_5(int *elems){
+    int a,b,c,d,e;
+
+    a = elems[0];
+    b = elems[1];
+    c = elems[2];
+    d = elems[3];
+    e = elems[4];
+
+    if(b > a){ // a>=b
+        SWAP(a,b);
+    }
+
+    if(d > c){ // c>=d
+        SWAP(c,d);
+    }
+
+    if(c > a){ // a>=c>=d
+        /* if "c>a" then we had c>a>=b, so after the swaps we will have a>c>=d */
+        SWAP(a,c);
+        SWAP(b,d);
+    }
+
+    if(e > c){
+        if(e > a){ // e,a,c,d
+            if(b > c){     // e,a,b,c,d *
+                // we know that "max{a,c}>b" already
+                SET(e,a,b,c,d, elems);
+                return 0;
+            }else{
+                if(b > d){ // e,a,c,b,d **
+                    SET(e,a,c,b,d, elems);
+                    return 1;
+                }else{     // e,a,c,d,b **
+                    SET(e,a,c,d,b, elems);
+                    return 2;
+                }
+            }
+        }else{ // a,e,c,d
+            if(b > c){
+                if(b > e){ // a,b,e,c,d **
+                    SET(a,b,e,c,d, elems);
+                    return 3;
+                }else{     // a,e,b,c,d **
+                    SET(a,e,b,c,d, elems);
+                    return 4;
+                }
+            }else{
+                if(b > d){ // a,e,c,b,d **
+                    SET(a,e,c,b,d, elems);
+                    return 5;
+                }else{     // a,e,c,d,b **
+                    SET(a,e,c,d,b, elems);
+                    return 6;
+                }
+            }
+        }
+    }else{
+        if(e > d){ // a,c,e,d
+            if(b > e){
+                if(b > c){ // a,b,c,e,d **
+                    SET(a,b,c,e,d, elems);
+                    return 7;
+                }else{     // a,c,b,e,d **
+                    SET(a,c,b,e,d, elems);
+                    return 8;
+                }
+            }else{
+                if(b > d){ // a,c,e,b,d **
+                    SET(a,c,e,b,d, elems);
+                    return 9;
+                }else{     // a,c,e,d,b **
+                    SET(a,c,e,d,b, elems);
+                    return 10;
+                }
+            }
+        }else{ // a,c,d,e
+            if(b > d){
+                if(b > c){ // a,b,c,d,e
+                    SET(a,b,c,d,e, elems);
+                    return 11;
+                }else{     // a,c,b,d,e
+                    SET(a,c,b,d,e, elems);
+                    return 12;
+                }
+            }else{
+                if(b > e){ // a,c,d,b,e
+                    SET(a,c,d,b,e, elems);
+                    return 13;
+                }else{     // a,c,d,e,b
+                    SET(a,c,d,e,b, elems);
+                    return 14;
+                }
+            }
+        }
+    }
+    return -1;
+}
+
+/* functions needed for the reduction */
+size_t tree_height(int NT){
+    size_t i;
+    for(i=0; i<8*sizeof(NT); i++){
+        if( (1<<i) >= NT )
+            return i;
+    }
+    assert(0);
+    return 0;
+}
+
+int tree_width_at_level(int lvl, int NT){
+    int w,i;
+
+    w = NT;
+    for(i=0; i<lvl; i++){
+        w = (w+1)/2;
+    }
+
+    return w;
+}
+
+int compute_cleanup_size(int lvl, int NB, int NT){
+    int w,j,nxt_size;
+
+    w = NT;
+    nxt_size = NB;
+    for(j=0; j<lvl; j++){
+        if( 0 == w%2 )
+            nxt_size += NB*(1<<j);
+
+        w = (w+1)/2;
+    }
+
+    return nxt_size;
+
+}
+
+int compute_data_size(int lvl, int i, int NB, int NT){
+    int w;
+    w = tree_width_at_level(lvl, NT);
+
+    if( lvl < 0 )
+        return NB;
+
+    /* This can happen and it's not an error, as long as the caller does not use the result */
+    if( i > w-1 )
+        return -1;
+
+    if( i == w-1 ){
+        return compute_cleanup_size(lvl, NB, NT);
+    }else{
+        return NB*(1<<lvl);
+    }
+}
+
+#define MY_TYPE parsec_datatype_int_t
+#define PARSEC_merge_sort_DEFAULT_ADT    (&__parsec_tp->super.arenas_datatypes[PARSEC_merge_sort_DEFAULT_ADT_IDX])
+#include "merge_sort.h"
+
+struct __parsec_merge_sort_internal_taskpool_s {
+ parsec_merge_sort_taskpool_t super;
+ volatile int32_t sync_point;
+ volatile int32_t initial_number_tasks;
+ parsec_task_t* startup_queue;
+  /* The ranges to compute the hash key */
+  int RESULT_j_min;
+  int RESULT_j_range;
+  int REDUCE_lvl_min;
+  int REDUCE_lvl_range;
+  int REDUCE_i_min;
+  int REDUCE_i_range;
+  int SORT_i_min;
+  int SORT_i_range;
+  int INIT_DATA_i_min;
+  int INIT_DATA_i_range;
+  /* The list of data repositories  REDUCE  SORT  INIT_DATA */
+  data_repo_t* repositories[4];
+};
+
+#if defined(PARSEC_PROF_TRACE)
+#  if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+static int merge_sort_profiling_array[4*PARSEC_merge_sort_NB_TASK_CLASSES] = {-2}; /* 2 pairs (begin, end) per task, times two because each task class has an internal_init task */
+#  else /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+static int merge_sort_profiling_array[2*PARSEC_merge_sort_NB_TASK_CLASSES] = {-2}; /* 2 pairs (begin, end) per task */
+#  endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+#endif  /* defined(PARSEC_PROF_TRACE) */
+/* Globals */
+#define dataA __parsec_tp->super._g_dataA
+#define NB (__parsec_tp->super._g_NB)
+#define NT (__parsec_tp->super._g_NT)
+
+static inline int parsec_imin(int a, int b) { return (a <= b) ? a : b; };
+
+static inline int parsec_imax(int a, int b) { return (a >= b) ? a : b; };
+
+static inline int32_t merge_sort_RESULT_inline_c_expr1_line_292(const __parsec_merge_sort_internal_taskpool_t *__parsec_tp, const __parsec_merge_sort_RESULT_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task RESULT */
+  const int j = assignments->j.value; (void)j;
+  const int h = assignments->h.value; (void)h;
+
+  (void)j;  (void)h;
+
+ return tree_height(NT); 
+}
+
+static inline int32_t merge_sort_REDUCE_inline_c_expr2_line_241(const __parsec_merge_sort_internal_taskpool_t *__parsec_tp, const __parsec_merge_sort_REDUCE_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task REDUCE */
+  const int h = assignments->h.value; (void)h;
+  const int lvl = assignments->lvl.value; (void)lvl;
+  const int width = assignments->width.value; (void)width;
+  const int i = assignments->i.value; (void)i;
+  const int prnt_width = assignments->prnt_width.value; (void)prnt_width;
+  const int A_data_size = assignments->A_data_size.value; (void)A_data_size;
+  const int B_data_size = assignments->B_data_size.value; (void)B_data_size;
+  const int data_size = assignments->data_size.value; (void)data_size;
+
+  (void)h;  (void)lvl;  (void)width;  (void)i;  (void)prnt_width;  (void)A_data_size;  (void)B_data_size;  (void)data_size;
+
+ return compute_data_size(lvl, i, NB, NT); 
+}
+
+static inline int32_t merge_sort_REDUCE_inline_c_expr3_line_239(const __parsec_merge_sort_internal_taskpool_t *__parsec_tp, const __parsec_merge_sort_REDUCE_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task REDUCE */
+  const int h = assignments->h.value; (void)h;
+  const int lvl = assignments->lvl.value; (void)lvl;
+  const int width = assignments->width.value; (void)width;
+  const int i = assignments->i.value; (void)i;
+  const int prnt_width = assignments->prnt_width.value; (void)prnt_width;
+  const int A_data_size = assignments->A_data_size.value; (void)A_data_size;
+  const int B_data_size = assignments->B_data_size.value; (void)B_data_size;
+  const int data_size = assignments->data_size.value; (void)data_size;
+
+  (void)h;  (void)lvl;  (void)width;  (void)i;  (void)prnt_width;  (void)A_data_size;  (void)B_data_size;  (void)data_size;
+
+ return compute_data_size(lvl-1, 2*i+1, NB, NT); 
+}
+
+static inline int32_t merge_sort_REDUCE_inline_c_expr4_line_237(const __parsec_merge_sort_internal_taskpool_t *__parsec_tp, const __parsec_merge_sort_REDUCE_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task REDUCE */
+  const int h = assignments->h.value; (void)h;
+  const int lvl = assignments->lvl.value; (void)lvl;
+  const int width = assignments->width.value; (void)width;
+  const int i = assignments->i.value; (void)i;
+  const int prnt_width = assignments->prnt_width.value; (void)prnt_width;
+  const int A_data_size = assignments->A_data_size.value; (void)A_data_size;
+  const int B_data_size = assignments->B_data_size.value; (void)B_data_size;
+  const int data_size = assignments->data_size.value; (void)data_size;
+
+  (void)h;  (void)lvl;  (void)width;  (void)i;  (void)prnt_width;  (void)A_data_size;  (void)B_data_size;  (void)data_size;
+
+ return compute_data_size(lvl-1, 2*i,   NB, NT); 
+}
+
+static inline int32_t merge_sort_REDUCE_inline_c_expr5_line_235(const __parsec_merge_sort_internal_taskpool_t *__parsec_tp, const __parsec_merge_sort_REDUCE_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task REDUCE */
+  const int h = assignments->h.value; (void)h;
+  const int lvl = assignments->lvl.value; (void)lvl;
+  const int width = assignments->width.value; (void)width;
+  const int i = assignments->i.value; (void)i;
+  const int prnt_width = assignments->prnt_width.value; (void)prnt_width;
+  const int A_data_size = assignments->A_data_size.value; (void)A_data_size;
+  const int B_data_size = assignments->B_data_size.value; (void)B_data_size;
+  const int data_size = assignments->data_size.value; (void)data_size;
+
+  (void)h;  (void)lvl;  (void)width;  (void)i;  (void)prnt_width;  (void)A_data_size;  (void)B_data_size;  (void)data_size;
+
+ return tree_width_at_level(lvl-1, NT); 
+}
+
+static inline int32_t merge_sort_REDUCE_inline_c_expr6_line_232(const __parsec_merge_sort_internal_taskpool_t *__parsec_tp, const __parsec_merge_sort_REDUCE_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task REDUCE */
+  const int h = assignments->h.value; (void)h;
+  const int lvl = assignments->lvl.value; (void)lvl;
+  const int width = assignments->width.value; (void)width;
+  const int i = assignments->i.value; (void)i;
+  const int prnt_width = assignments->prnt_width.value; (void)prnt_width;
+  const int A_data_size = assignments->A_data_size.value; (void)A_data_size;
+  const int B_data_size = assignments->B_data_size.value; (void)B_data_size;
+  const int data_size = assignments->data_size.value; (void)data_size;
+
+  (void)h;  (void)lvl;  (void)width;  (void)i;  (void)prnt_width;  (void)A_data_size;  (void)B_data_size;  (void)data_size;
+
+ return tree_width_at_level(lvl, NT); 
+}
+
+static inline int32_t merge_sort_REDUCE_inline_c_expr7_line_230(const __parsec_merge_sort_internal_taskpool_t *__parsec_tp, const __parsec_merge_sort_REDUCE_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task REDUCE */
+  const int h = assignments->h.value; (void)h;
+  const int lvl = assignments->lvl.value; (void)lvl;
+  const int width = assignments->width.value; (void)width;
+  const int i = assignments->i.value; (void)i;
+  const int prnt_width = assignments->prnt_width.value; (void)prnt_width;
+  const int A_data_size = assignments->A_data_size.value; (void)A_data_size;
+  const int B_data_size = assignments->B_data_size.value; (void)B_data_size;
+  const int data_size = assignments->data_size.value; (void)data_size;
+
+  (void)h;  (void)lvl;  (void)width;  (void)i;  (void)prnt_width;  (void)A_data_size;  (void)B_data_size;  (void)data_size;
+
+ return tree_height(NT); 
+}
+
+/* Data Access Macros */
+#define data_of_dataA(dataA_d0, dataA_d1)  (((parsec_data_collection_t*)__parsec_tp->super._g_dataA)->data_of((parsec_data_collection_t*)__parsec_tp->super._g_dataA, (dataA_d0), (dataA_d1)))
+
+#define rank_of_dataA(dataA_d0, dataA_d1)  (((parsec_data_collection_t*)__parsec_tp->super._g_dataA)->rank_of((parsec_data_collection_t*)__parsec_tp->super._g_dataA, (dataA_d0), (dataA_d1)))
+
+/* Functions Predicates */
+#define RESULT_pred(j, h) (((parsec_data_collection_t*)(__parsec_tp->super._g_dataA))->myrank == rank_of_dataA(0, 0))
+#define REDUCE_pred(h, lvl, width, i, prnt_width, A_data_size, B_data_size, data_size) (((parsec_data_collection_t*)(__parsec_tp->super._g_dataA))->myrank == rank_of_dataA(i, 0))
+#define SORT_pred(i) (((parsec_data_collection_t*)(__parsec_tp->super._g_dataA))->myrank == rank_of_dataA(i, 0))
+#define INIT_DATA_pred(i) (((parsec_data_collection_t*)(__parsec_tp->super._g_dataA))->myrank == rank_of_dataA(i, 0))
+
+/* Data Repositories */
+#define RESULT_repo (__parsec_tp->repositories[3])
+#define REDUCE_repo (__parsec_tp->repositories[2])
+#define SORT_repo (__parsec_tp->repositories[1])
+#define INIT_DATA_repo (__parsec_tp->repositories[0])
+/* Release dependencies output macro */
+#if defined(PARSEC_DEBUG_NOISIER)
+#define RELEASE_DEP_OUTPUT(ES, DEPO, TASKO, DEPI, TASKI, RSRC, RDST, DATA)\
+  do { \
+    char tmp1[128], tmp2[128]; (void)tmp1; (void)tmp2;\
+    PARSEC_DEBUG_VERBOSE(20, parsec_debug_output, "thread %d VP %d explore deps from %s:%s to %s:%s (from rank %d to %d) base ptr %p",\
+           (NULL != (ES) ? (ES)->th_id : -1), (NULL != (ES) ? (ES)->virtual_process->vp_id : -1),\
+           DEPO, parsec_task_snprintf(tmp1, 128, (parsec_task_t*)(TASKO)),\
+           DEPI, parsec_task_snprintf(tmp2, 128, (parsec_task_t*)(TASKI)), (RSRC), (RDST), (DATA));\
+  } while(0)
+#define ACQUIRE_FLOW(TASKI, DEPI, FUNO, DEPO, LOCALS, PTR)\
+  do { \
+    char tmp1[128], tmp2[128]; (void)tmp1; (void)tmp2;\
+    PARSEC_DEBUG_VERBOSE(20, parsec_debug_output, "task %s acquires flow %s from %s %s data ptr %p",\
+           parsec_task_snprintf(tmp1, 128, (parsec_task_t*)(TASKI)), (DEPI),\
+           (DEPO), parsec_snprintf_assignments(tmp2, 128, (FUNO), (parsec_assignment_t*)(LOCALS)), (PTR));\
+  } while(0)
+#else
+#define RELEASE_DEP_OUTPUT(ES, DEPO, TASKO, DEPI, TASKI, RSRC, RDST, DATA)
+#define ACQUIRE_FLOW(TASKI, DEPI, TASKO, DEPO, LOCALS, PTR)
+#endif
+static inline parsec_key_t __jdf2c_make_key_RESULT(const parsec_taskpool_t *tp, const parsec_assignment_t *as)
+{
+  const __parsec_merge_sort_internal_taskpool_t *__parsec_tp = (const __parsec_merge_sort_internal_taskpool_t *)tp;
+  const __parsec_merge_sort_RESULT_parsec_assignment_t *assignment = (const __parsec_merge_sort_RESULT_parsec_assignment_t*)as;
+  uint64_t __parsec_id = 0;
+  __parsec_id += (assignment->j.value - __parsec_tp->RESULT_j_min);
+  return (parsec_key_t)__parsec_id;
+}
+static char *__jdf2c_key_fns_RESULT_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_merge_sort_internal_taskpool_t *__parsec_tp = (__parsec_merge_sort_internal_taskpool_t *)user_data;
+  __parsec_merge_sort_RESULT_parsec_assignment_t __jdf2c__assignments = {  .j.value = 0, .h.value = 0 };
+  int j = (__parsec_key) % __parsec_tp->RESULT_j_range + __parsec_tp->RESULT_j_min;
+  __parsec_key = __parsec_key / __parsec_tp->RESULT_j_range;
+  __jdf2c__assignments.j.value = j;
+  int h = merge_sort_RESULT_inline_c_expr1_line_292(__parsec_tp, &__jdf2c__assignments);
+  (void)h;
+  __jdf2c__assignments.h.value = h;
+  (void)__jdf2c__assignments;
+  snprintf(buffer, buffer_size, "RESULT(%d)", j);
+  return buffer;
+}
+
+static parsec_key_fn_t __jdf2c_key_fns_RESULT = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = __jdf2c_key_fns_RESULT_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+static inline parsec_key_t __jdf2c_make_key_REDUCE(const parsec_taskpool_t *tp, const parsec_assignment_t *as)
+{
+  const __parsec_merge_sort_internal_taskpool_t *__parsec_tp = (const __parsec_merge_sort_internal_taskpool_t *)tp;
+  const __parsec_merge_sort_REDUCE_parsec_assignment_t *assignment = (const __parsec_merge_sort_REDUCE_parsec_assignment_t*)as;
+  uint64_t __parsec_id = 0;
+  __parsec_id += (assignment->lvl.value - __parsec_tp->REDUCE_lvl_min);
+  __parsec_id += (assignment->i.value - __parsec_tp->REDUCE_i_min) * __parsec_tp->REDUCE_lvl_range;
+  return (parsec_key_t)__parsec_id;
+}
+static char *__jdf2c_key_fns_REDUCE_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_merge_sort_internal_taskpool_t *__parsec_tp = (__parsec_merge_sort_internal_taskpool_t *)user_data;
+  __parsec_merge_sort_REDUCE_parsec_assignment_t __jdf2c__assignments = {  .h.value = 0, .lvl.value = 0, .width.value = 0, .i.value = 0, .prnt_width.value = 0, .A_data_size.value = 0, .B_data_size.value = 0, .data_size.value = 0 };
+  int h = merge_sort_REDUCE_inline_c_expr7_line_230(__parsec_tp, &__jdf2c__assignments);
+  (void)h;
+  __jdf2c__assignments.h.value = h;
+  int lvl = (__parsec_key) % __parsec_tp->REDUCE_lvl_range + __parsec_tp->REDUCE_lvl_min;
+  __parsec_key = __parsec_key / __parsec_tp->REDUCE_lvl_range;
+  __jdf2c__assignments.lvl.value = lvl;
+  int width = merge_sort_REDUCE_inline_c_expr6_line_232(__parsec_tp, &__jdf2c__assignments);
+  (void)width;
+  __jdf2c__assignments.width.value = width;
+  int i = (__parsec_key) % __parsec_tp->REDUCE_i_range + __parsec_tp->REDUCE_i_min;
+  __parsec_key = __parsec_key / __parsec_tp->REDUCE_i_range;
+  __jdf2c__assignments.i.value = i;
+  int prnt_width = merge_sort_REDUCE_inline_c_expr5_line_235(__parsec_tp, &__jdf2c__assignments);
+  (void)prnt_width;
+  __jdf2c__assignments.prnt_width.value = prnt_width;
+  int A_data_size = merge_sort_REDUCE_inline_c_expr4_line_237(__parsec_tp, &__jdf2c__assignments);
+  (void)A_data_size;
+  __jdf2c__assignments.A_data_size.value = A_data_size;
+  int B_data_size = merge_sort_REDUCE_inline_c_expr3_line_239(__parsec_tp, &__jdf2c__assignments);
+  (void)B_data_size;
+  __jdf2c__assignments.B_data_size.value = B_data_size;
+  int data_size = merge_sort_REDUCE_inline_c_expr2_line_241(__parsec_tp, &__jdf2c__assignments);
+  (void)data_size;
+  __jdf2c__assignments.data_size.value = data_size;
+  (void)__jdf2c__assignments;
+  snprintf(buffer, buffer_size, "REDUCE(%d, %d)", lvl, i);
+  return buffer;
+}
+
+static parsec_key_fn_t __jdf2c_key_fns_REDUCE = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = __jdf2c_key_fns_REDUCE_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+static inline parsec_key_t __jdf2c_make_key_SORT(const parsec_taskpool_t *tp, const parsec_assignment_t *as)
+{
+  const __parsec_merge_sort_internal_taskpool_t *__parsec_tp = (const __parsec_merge_sort_internal_taskpool_t *)tp;
+  const __parsec_merge_sort_SORT_parsec_assignment_t *assignment = (const __parsec_merge_sort_SORT_parsec_assignment_t*)as;
+  uint64_t __parsec_id = 0;
+  __parsec_id += (assignment->i.value - __parsec_tp->SORT_i_min);
+  return (parsec_key_t)__parsec_id;
+}
+static char *__jdf2c_key_fns_SORT_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_merge_sort_internal_taskpool_t *__parsec_tp = (__parsec_merge_sort_internal_taskpool_t *)user_data;
+  int i = (__parsec_key) % __parsec_tp->SORT_i_range + __parsec_tp->SORT_i_min;
+  __parsec_key = __parsec_key / __parsec_tp->SORT_i_range;
+  snprintf(buffer, buffer_size, "SORT(%d)", i);
+  return buffer;
+}
+
+static parsec_key_fn_t __jdf2c_key_fns_SORT = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = __jdf2c_key_fns_SORT_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+static inline parsec_key_t __jdf2c_make_key_INIT_DATA(const parsec_taskpool_t *tp, const parsec_assignment_t *as)
+{
+  const __parsec_merge_sort_internal_taskpool_t *__parsec_tp = (const __parsec_merge_sort_internal_taskpool_t *)tp;
+  const __parsec_merge_sort_INIT_DATA_parsec_assignment_t *assignment = (const __parsec_merge_sort_INIT_DATA_parsec_assignment_t*)as;
+  uint64_t __parsec_id = 0;
+  __parsec_id += (assignment->i.value - __parsec_tp->INIT_DATA_i_min);
+  return (parsec_key_t)__parsec_id;
+}
+static char *__jdf2c_key_fns_INIT_DATA_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_merge_sort_internal_taskpool_t *__parsec_tp = (__parsec_merge_sort_internal_taskpool_t *)user_data;
+  int i = (__parsec_key) % __parsec_tp->INIT_DATA_i_range + __parsec_tp->INIT_DATA_i_min;
+  __parsec_key = __parsec_key / __parsec_tp->INIT_DATA_i_range;
+  snprintf(buffer, buffer_size, "INIT_DATA(%d)", i);
+  return buffer;
+}
+
+static parsec_key_fn_t __jdf2c_key_fns_INIT_DATA = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = __jdf2c_key_fns_INIT_DATA_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/******                                    RESULT                                    ******/
+
+static inline int32_t minexpr_of_symb_merge_sort_RESULT_j_fct(const __parsec_merge_sort_internal_taskpool_t *__parsec_tp, const __parsec_merge_sort_RESULT_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_merge_sort_RESULT_j = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_merge_sort_RESULT_j_fct }
+                   }
+};
+static inline int32_t maxexpr_of_symb_merge_sort_RESULT_j_fct(const __parsec_merge_sort_internal_taskpool_t *__parsec_tp, const __parsec_merge_sort_RESULT_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t maxexpr_of_symb_merge_sort_RESULT_j = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_merge_sort_RESULT_j_fct }
+                   }
+};
+static const parsec_symbol_t symb_merge_sort_RESULT_j = { .name = "j", .context_index = 0, .min = &minexpr_of_symb_merge_sort_RESULT_j, .max = &maxexpr_of_symb_merge_sort_RESULT_j, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int32_t expr_of_symb_merge_sort_RESULT_h_fct(const __parsec_merge_sort_internal_taskpool_t *__parsec_tp, const __parsec_merge_sort_RESULT_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return merge_sort_RESULT_inline_c_expr1_line_292(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_merge_sort_RESULT_h = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_merge_sort_RESULT_h_fct }
+                   }
+};
+static const parsec_symbol_t symb_merge_sort_RESULT_h = { .name = "h", .context_index = 1, .min = &expr_of_symb_merge_sort_RESULT_h, .max = &expr_of_symb_merge_sort_RESULT_h, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int affinity_of_merge_sort_RESULT(const __parsec_merge_sort_RESULT_task_t *this_task,
+                     parsec_data_ref_t *ref)
+{
+    const __parsec_merge_sort_internal_taskpool_t *__parsec_tp = (const __parsec_merge_sort_internal_taskpool_t*)this_task->taskpool;
+  const int j = this_task->locals.j.value; (void)j;
+  const int h = this_task->locals.h.value; (void)h;
+
+  /* Silent Warnings: should look into predicate to know what variables are usefull */
+  (void)j;
+  (void)h;
+  ref->dc = (parsec_data_collection_t *)__parsec_tp->super._g_dataA;
+  /* Compute data key */
+  ref->key = ref->dc->data_key(ref->dc, 0, 0);
+  return 1;
+}
+static const parsec_property_t properties_of_merge_sort_RESULT[1] = {
+  {.name = NULL, .expr = NULL}
+};
+static const parsec_dep_t flow_of_merge_sort_RESULT_for_C_dep1_atline_296 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 2, /* merge_sort_REDUCE */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_merge_sort_REDUCE_for_C,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_merge_sort_RESULT_for_C,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_merge_sort_RESULT_for_C = {
+  .name               = "C",
+  .sym_type           = PARSEC_SYM_IN,
+  .flow_flags         = PARSEC_FLOW_ACCESS_READ,
+  .flow_index         = 0,
+  .flow_datatype_mask = 0x0,
+  .dep_in     = { &flow_of_merge_sort_RESULT_for_C_dep1_atline_296 },
+  .dep_out    = { NULL }
+};
+
+static void
+iterate_predecessors_of_merge_sort_RESULT(parsec_execution_stream_t *es, const __parsec_merge_sort_RESULT_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_merge_sort_internal_taskpool_t *__parsec_tp = (const __parsec_merge_sort_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_merge_sort_RESULT_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_merge_sort_RESULT_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int j = __jdf2c__tmp_locals.j.value; (void)j;
+  const int h = __jdf2c__tmp_locals.h.value; (void)h;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)j;  (void)h;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_dataA(0, 0);
+#endif
+  if( action_mask & 0x1 ) {  /* Flow of data C [0] */
+    data.data   = this_task->data._f_C.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x1 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_merge_sort_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_merge_sort_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        __parsec_merge_sort_REDUCE_task_t* ncc = (__parsec_merge_sort_REDUCE_task_t*)&nc;
+    nc.task_class = __parsec_tp->super.super.task_classes_array[merge_sort_REDUCE.task_class_id];
+      const int REDUCE_h = merge_sort_REDUCE_inline_c_expr7_line_230(__parsec_tp, &ncc->locals);
+      assert(&nc.locals[0].value == &ncc->locals.h.value);
+      ncc->locals.h.value = REDUCE_h;
+      const int REDUCE_lvl = h;
+      if( (REDUCE_lvl >= (0)) && (REDUCE_lvl <= (ncc->locals.h.value)) ) {
+        assert(&nc.locals[1].value == &ncc->locals.lvl.value);
+        ncc->locals.lvl.value = REDUCE_lvl;
+        const int REDUCE_width = merge_sort_REDUCE_inline_c_expr6_line_232(__parsec_tp, &ncc->locals);
+        assert(&nc.locals[2].value == &ncc->locals.width.value);
+        ncc->locals.width.value = REDUCE_width;
+        const int REDUCE_i = 0;
+        if( (REDUCE_i >= (0)) && (REDUCE_i <= ((ncc->locals.width.value - 1))) ) {
+          assert(&nc.locals[3].value == &ncc->locals.i.value);
+          ncc->locals.i.value = REDUCE_i;
+          const int REDUCE_prnt_width = merge_sort_REDUCE_inline_c_expr5_line_235(__parsec_tp, &ncc->locals);
+          assert(&nc.locals[4].value == &ncc->locals.prnt_width.value);
+          ncc->locals.prnt_width.value = REDUCE_prnt_width;
+          const int REDUCE_A_data_size = merge_sort_REDUCE_inline_c_expr4_line_237(__parsec_tp, &ncc->locals);
+          assert(&nc.locals[5].value == &ncc->locals.A_data_size.value);
+          ncc->locals.A_data_size.value = REDUCE_A_data_size;
+          const int REDUCE_B_data_size = merge_sort_REDUCE_inline_c_expr3_line_239(__parsec_tp, &ncc->locals);
+          assert(&nc.locals[6].value == &ncc->locals.B_data_size.value);
+          ncc->locals.B_data_size.value = REDUCE_B_data_size;
+          const int REDUCE_data_size = merge_sort_REDUCE_inline_c_expr2_line_241(__parsec_tp, &ncc->locals);
+          assert(&nc.locals[7].value == &ncc->locals.data_size.value);
+          ncc->locals.data_size.value = REDUCE_data_size;
+#if defined(DISTRIBUTED)
+          rank_dst = rank_of_dataA(ncc->locals.i.value, 0);
+          if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+            vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_dataA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_dataA, ncc->locals.i.value, 0);
+          nc.priority = __parsec_tp->super.super.priority;
+          successor_repo = REDUCE_repo;
+          successor_repo_key = __jdf2c_make_key_REDUCE((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+        RELEASE_DEP_OUTPUT(es, "C", this_task, "C", &nc, rank_src, rank_dst, &data);
+        if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_merge_sort_RESULT_for_C_dep1_atline_296, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+          }
+        }
+  }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static int release_deps_of_merge_sort_RESULT(parsec_execution_stream_t *es, __parsec_merge_sort_RESULT_task_t *this_task, uint32_t action_mask, parsec_remote_deps_t *deps)
+{
+  PARSEC_PINS(es, RELEASE_DEPS_BEGIN, (parsec_task_t *)this_task);  const __parsec_merge_sort_internal_taskpool_t *__parsec_tp = (const __parsec_merge_sort_internal_taskpool_t *)this_task->taskpool;
+  parsec_release_dep_fct_arg_t arg;
+  int __vp_id;
+  int consume_local_repo = 0;
+  arg.action_mask = action_mask;
+  arg.output_entry = NULL;
+  arg.output_repo = NULL;
+#if defined(DISTRIBUTED)
+  arg.remote_deps = deps;
+#endif  /* defined(DISTRIBUTED) */
+  assert(NULL != es);
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS )    arg.ready_lists = alloca(sizeof(parsec_task_t *) * es->virtual_process->parsec_context->nb_vp);
+  else
+    arg.ready_lists = NULL;
+  for( __vp_id = 0; __vp_id < es->virtual_process->parsec_context->nb_vp; arg.ready_lists[__vp_id++] = NULL );
+  (void)__parsec_tp; (void)deps;
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_C.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_C.source_repo, this_task->data._f_C.source_repo_entry->ht_item.key );
+    }
+  }
+  consume_local_repo = (this_task->repo_entry != NULL);
+  /* No successors, don't call iterate_successors and don't release any local deps */
+      if (consume_local_repo) {
+         data_repo_entry_used_once( RESULT_repo, this_task->repo_entry->ht_item.key );
+      }
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_C.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_C.data_in);
+    }
+  }
+  PARSEC_PINS(es, RELEASE_DEPS_END, (parsec_task_t *)this_task);  return 0;
+}
+
+static int data_lookup_of_merge_sort_RESULT(parsec_execution_stream_t *es, __parsec_merge_sort_RESULT_task_t *this_task)
+{
+  const __parsec_merge_sort_internal_taskpool_t *__parsec_tp = (__parsec_merge_sort_internal_taskpool_t *)this_task->taskpool;
+  parsec_assignment_t generic_locals[MAX_PARAM_COUNT];  /* generic task locals */
+  int target_device = 0; (void)target_device;
+  (void)__parsec_tp; (void)generic_locals; (void)es;
+  parsec_data_copy_t *chunk = NULL;
+  data_repo_t        *reshape_repo  = NULL, *consumed_repo  = NULL;
+  data_repo_entry_t  *reshape_entry = NULL, *consumed_entry = NULL;
+  parsec_key_t        reshape_entry_key = 0, consumed_entry_key = 0;
+  uint8_t             consumed_flow_index;
+  parsec_dep_data_description_t data;
+  int ret;
+  (void)reshape_repo; (void)reshape_entry; (void)reshape_entry_key;
+  (void)consumed_repo; (void)consumed_entry; (void)consumed_entry_key;
+  (void)consumed_flow_index;
+  (void)chunk; (void)data; (void)ret;
+  const int j = this_task->locals.j.value; (void)j;
+  const int h = this_task->locals.h.value; (void)h;
+  if( NULL == this_task->repo_entry ){
+    this_task->repo_entry = data_repo_lookup_entry_and_create(es, RESULT_repo,                                       __jdf2c_make_key_RESULT((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    data_repo_entry_addto_usage_limit(RESULT_repo, this_task->repo_entry->ht_item.key, 1);    this_task->repo_entry ->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(this_task->repo_entry ->sim_exec_date == 0);
+    this_task->repo_entry ->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  /* The reshape repo is the current task repo. */  reshape_repo = RESULT_repo;
+  reshape_entry_key = __jdf2c_make_key_RESULT((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals) ;
+  reshape_entry = this_task->repo_entry;
+  /* Lookup the input data, and store them in the context if any */
+
+if(! this_task->data._f_C.fulfill ){ /* Flow C */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_C.data_out = NULL;  /* input only */
+  /* Flow C [0] dependency [0] from predecessor REDUCE */
+  if( NULL == (chunk = this_task->data._f_C.data_in) ) {
+  /* No data set up by predecessor on this task input flow */
+__parsec_merge_sort_REDUCE_parsec_assignment_t *target_locals = (__parsec_merge_sort_REDUCE_parsec_assignment_t*)&generic_locals;
+  const int REDUCEh = target_locals->h.value = merge_sort_REDUCE_inline_c_expr7_line_230(__parsec_tp, target_locals); (void)REDUCEh;
+  const int REDUCElvl = target_locals->lvl.value = h; (void)REDUCElvl;
+  const int REDUCEwidth = target_locals->width.value = merge_sort_REDUCE_inline_c_expr6_line_232(__parsec_tp, target_locals); (void)REDUCEwidth;
+  const int REDUCEi = target_locals->i.value = 0; (void)REDUCEi;
+  const int REDUCEprnt_width = target_locals->prnt_width.value = merge_sort_REDUCE_inline_c_expr5_line_235(__parsec_tp, target_locals); (void)REDUCEprnt_width;
+  const int REDUCEA_data_size = target_locals->A_data_size.value = merge_sort_REDUCE_inline_c_expr4_line_237(__parsec_tp, target_locals); (void)REDUCEA_data_size;
+  const int REDUCEB_data_size = target_locals->B_data_size.value = merge_sort_REDUCE_inline_c_expr3_line_239(__parsec_tp, target_locals); (void)REDUCEB_data_size;
+  const int REDUCEdata_size = target_locals->data_size.value = merge_sort_REDUCE_inline_c_expr2_line_241(__parsec_tp, target_locals); (void)REDUCEdata_size;
+    if( (reshape_entry != NULL) && (reshape_entry->data[0] != NULL) ){
+        /* Reshape promise set up on this task repo by predecessor */
+        consumed_repo = reshape_repo;
+        consumed_entry = reshape_entry;
+        consumed_entry_key = reshape_entry_key;
+        consumed_flow_index = 0;
+    }else{
+        /* Consume from predecessor's repo */
+        consumed_repo = REDUCE_repo;
+        consumed_entry_key = __jdf2c_make_key_REDUCE((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)target_locals) ;
+        consumed_entry = data_repo_lookup_entry( consumed_repo, consumed_entry_key );
+        consumed_flow_index = 0;
+    }
+    data.data   = NULL;
+    data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+        data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    ACQUIRE_FLOW(this_task, "C", &merge_sort_REDUCE, "C", target_locals, chunk);
+    this_task->data._f_C.data_out = chunk;
+  } 
+  else {
+    /* Data set up by predecessor on this task input flow */
+    consumed_repo = this_task->data._f_C.source_repo;
+    consumed_entry = this_task->data._f_C.source_repo_entry;
+    consumed_entry_key = this_task->data._f_C.source_repo_entry->ht_item.key;
+    if( (reshape_entry != NULL) && (reshape_entry->data[0] != NULL) ){
+        /* Reshape promise set up on input by predecessor is on this task repo */
+        consumed_flow_index = 0;
+        assert( (this_task->data._f_C.source_repo == reshape_repo)
+             && (this_task->data._f_C.source_repo_entry == reshape_entry));
+    }else{
+        /* Reshape promise set up on input by predecessor is the predecesssor task repo */
+        consumed_flow_index = 0;
+    }
+    data.data   = NULL;
+    data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+        data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    this_task->data._f_C.data_out = parsec_data_get_copy(chunk->original, target_device);
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+    parsec_prof_grapher_data_input(chunk->original, (parsec_task_t*)this_task, &flow_of_merge_sort_RESULT_for_C, 0);
+#endif
+  }
+    this_task->data._f_C.data_in     = chunk;
+    this_task->data._f_C.source_repo       = consumed_repo;
+    this_task->data._f_C.source_repo_entry = consumed_entry;
+    this_task->data._f_C.fulfill = 1;
+}
+
+  /** Generate profiling information */
+#if defined(PARSEC_PROF_TRACE)
+  this_task->prof_info.desc = (parsec_data_collection_t*)__parsec_tp->super._g_dataA;
+  this_task->prof_info.priority = this_task->priority;
+  this_task->prof_info.data_id   = ((parsec_data_collection_t*)__parsec_tp->super._g_dataA)->data_key((parsec_data_collection_t*)__parsec_tp->super._g_dataA, 0, 0);
+  this_task->prof_info.task_class_id = this_task->task_class->task_class_id;
+  this_task->prof_info.task_return_code = -1;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int datatype_lookup_of_merge_sort_RESULT(parsec_execution_stream_t *es, const parsec_task_t *this_generic_task, const parsec_task_t *parent_task,
+              uint32_t* flow_mask, parsec_dep_data_description_t* data)
+{
+  const __parsec_merge_sort_RESULT_task_t *this_task = (__parsec_merge_sort_RESULT_task_t*)this_generic_task;
+  const __parsec_merge_sort_internal_taskpool_t *__parsec_tp = (__parsec_merge_sort_internal_taskpool_t *)this_task->taskpool;
+  (void)__parsec_tp; (void)es; (void)this_task; (void)data; (void)parent_task;
+  const int j = this_task->locals.j.value; (void)j;
+  const int h = this_task->locals.h.value; (void)h;
+  data->local.arena = data->remote.arena = NULL;
+  data->local.src_datatype  = data->local.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->local.src_count     = data->local.dst_count = 0;
+  data->local.src_displ     = data->local.dst_displ = 0;
+  data->data_future  = NULL;
+  if( (*flow_mask) & 0x80000000U ) { /* these are the input dependencies remote datatypes  */
+if( (*flow_mask) & 0x1U ) {  /* Flow C */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_merge_sort_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_merge_sort_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_merge_sort_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+    goto no_mask_match;
+  }
+
+  /* these are the output dependencies remote datatypes */
+ no_mask_match:
+  data->data                             = NULL;
+  data->remote.src_datatype = data->remote.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->remote.src_count    = data->remote.dst_count = 0;
+  data->remote.src_displ    = data->remote.dst_displ = 0;
+  data->data_future  = NULL;
+  (*flow_mask) = 0;  /* nothing left */
+  (void)j;  (void)h;
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+static int hook_of_merge_sort_RESULT(parsec_execution_stream_t *es, __parsec_merge_sort_RESULT_task_t *this_task)
+{
+  __parsec_merge_sort_internal_taskpool_t *__parsec_tp = (__parsec_merge_sort_internal_taskpool_t *)this_task->taskpool;
+  (void)es; (void)__parsec_tp;
+  const int j = this_task->locals.j.value; (void)j;
+  const int h = this_task->locals.h.value; (void)h;
+  (void)j;  (void)h;
+
+  /** Declare the variables that will hold the data, and all the accounting for each */
+  parsec_data_copy_t *_f_C = this_task->data._f_C.data_in;
+  void *C = PARSEC_DATA_COPY_GET_PTR(_f_C); (void)C;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    data_repo_entry_t *eC = this_task->data._f_C.source_repo_entry;
+    if( (NULL != eC) && (eC->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eC->sim_exec_date;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+  /** Cache Awareness Accounting */
+#if defined(PARSEC_CACHE_AWARENESS)
+  cache_buf_referenced(es->closest_cache, C);
+#endif /* PARSEC_CACHE_AWARENESS */
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                                  RESULT BODY                                  -----*/
+
+  int jc;
+  int *Cptr = (int *)C;
+
+  if( 0==((__parsec_tp->super.super.context)->my_rank) ){
+      for(jc=0; jc<NT*NB; jc++){
+          printf("%d\n",Cptr[jc]);
+      }
+  }
+
+/*-----                              END OF RESULT BODY                              -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#endif  /*  defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+static int complete_hook_of_merge_sort_RESULT(parsec_execution_stream_t *es, __parsec_merge_sort_RESULT_task_t *this_task)
+{
+  const __parsec_merge_sort_internal_taskpool_t *__parsec_tp = (__parsec_merge_sort_internal_taskpool_t *)this_task->taskpool;
+#if defined(DISTRIBUTED)
+    const int j = this_task->locals.j.value; (void)j;
+  const int h = this_task->locals.h.value; (void)h;
+#endif  /* defined(DISTRIBUTED) */
+  (void)es; (void)__parsec_tp;
+parsec_data_t* data_t_desc = NULL; (void)data_t_desc;
+#if defined(DISTRIBUTED)
+  /** If not working on distributed, there is no risk that data is not in place */
+  (void)j;  (void)h;
+
+#endif /* DISTRIBUTED */
+#if defined(PARSEC_PROF_GRAPHER)
+  parsec_prof_grapher_task((parsec_task_t*)this_task, es->th_id, es->virtual_process->vp_id,
+     __jdf2c_key_fns_RESULT.key_hash(this_task->task_class->make_key( (parsec_taskpool_t*)this_task->taskpool, ((parsec_task_t*)this_task)->locals), NULL));
+#endif  /* defined(PARSEC_PROF_GRAPHER) */
+  release_deps_of_merge_sort_RESULT(es, this_task,
+      PARSEC_ACTION_RELEASE_REMOTE_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_REFS |
+      PARSEC_ACTION_RESHAPE_ON_RELEASE |
+      0x0,  /* mask of all dep_index */ 
+      NULL);
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static parsec_hook_return_t release_task_of_merge_sort_RESULT(parsec_execution_stream_t *es, parsec_task_t *this_task)
+{
+    const __parsec_merge_sort_internal_taskpool_t *__parsec_tp =
+        (const __parsec_merge_sort_internal_taskpool_t *)this_task->taskpool;
+    parsec_hash_table_t *ht = (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[3];
+    parsec_key_t key = this_task->task_class->make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals);
+    parsec_hashable_dependency_t *hash_dep = (parsec_hashable_dependency_t *)parsec_hash_table_remove(ht, key);
+    parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);
+    return parsec_release_task_to_mempool_update_nbtasks(es, this_task);
+}
+
+static char *merge_sort_merge_sort_RESULT_internal_init_deps_key_functions_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_merge_sort_internal_taskpool_t *__parsec_tp = (__parsec_merge_sort_internal_taskpool_t *)user_data;
+  __parsec_merge_sort_RESULT_parsec_assignment_t __jdf2c__assignments = {  .j.value = 0, .h.value = 0 };
+  int j = (__parsec_key) % __parsec_tp->RESULT_j_range + __parsec_tp->RESULT_j_min;
+  __parsec_key = __parsec_key / __parsec_tp->RESULT_j_range;
+  __jdf2c__assignments.j.value = j;
+  int h = merge_sort_RESULT_inline_c_expr1_line_292(__parsec_tp, &__jdf2c__assignments);
+  (void)h;
+  __jdf2c__assignments.h.value = h;
+  (void)__jdf2c__assignments;
+  snprintf(buffer, buffer_size, "RESULT(%d)", j);
+  return buffer;
+}
+
+static parsec_key_fn_t merge_sort_merge_sort_RESULT_internal_init_deps_key_functions = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = merge_sort_merge_sort_RESULT_internal_init_deps_key_functions_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/* Needs: min-max count-tasks iterate */
+static int merge_sort_RESULT_internal_init(parsec_execution_stream_t * es, __parsec_merge_sort_RESULT_task_t * this_task)
+{
+  __parsec_merge_sort_internal_taskpool_t *__parsec_tp = (__parsec_merge_sort_internal_taskpool_t*)this_task->taskpool;
+  int32_t nb_tasks = 0, saved_nb_tasks = 0;
+int32_t __j_min = 0x7fffffff, __j_max = 0;int32_t __jdf2c_j_min = 0x7fffffff, __jdf2c_j_max = 0;  __parsec_merge_sort_RESULT_parsec_assignment_t assignments = {  .j.value = 0, .h.value = 0 };
+  int32_t  j,  h;
+  int32_t __jdf2c_j_start, __jdf2c_j_end, __jdf2c_j_inc;
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+  PARSEC_PROFILING_TRACE(es->es_profile,
+                         this_task->taskpool->profiling_array[START_KEY(this_task->task_class->task_class_id)],
+                         0,
+                         this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    __jdf2c_j_start = 0;
+    __jdf2c_j_end = 0;
+    __jdf2c_j_inc = 1;
+    __j_min = parsec_imin(__jdf2c_j_start, __jdf2c_j_end);
+    __j_max = parsec_imax(__jdf2c_j_start, __jdf2c_j_end);
+    __jdf2c_j_min = parsec_imin(__jdf2c_j_min, __j_min);
+    __jdf2c_j_max = parsec_imax(__jdf2c_j_max, __j_max);
+    for(j =  __jdf2c_j_start;
+        j <= __jdf2c_j_end;
+        j += __jdf2c_j_inc) {
+    assignments.j.value = j;
+  {  /* block for the non-range variable h */
+      h = merge_sort_RESULT_inline_c_expr1_line_292(__parsec_tp, &assignments);
+      assignments.h.value = h;
+      if( !RESULT_pred(j, h) ) continue;
+      nb_tasks++;
+    } /* block for the non-range variable h */ 
+  } /* Loop on normal range j */
+   if( 0 != nb_tasks ) {
+     (void)parsec_atomic_fetch_add_int32(&__parsec_tp->initial_number_tasks, nb_tasks);
+   }
+  /* Set the range variables for the collision-free hash-computation */
+  __parsec_tp->RESULT_j_min   = __jdf2c_j_min;
+  __parsec_tp->RESULT_j_range = (__jdf2c_j_max - __jdf2c_j_min) + 1;
+  this_task->status = PARSEC_TASK_STATUS_COMPLETE;
+
+  PARSEC_AYU_REGISTER_TASK(&merge_sort_RESULT);
+  __parsec_tp->super.super.dependencies_array[3] = PARSEC_OBJ_NEW(parsec_hash_table_t);
+  parsec_hash_table_init(__parsec_tp->super.super.dependencies_array[3], offsetof(parsec_hashable_dependency_t, ht_item), 10, merge_sort_merge_sort_RESULT_internal_init_deps_key_functions, this_task->taskpool);
+  __parsec_tp->repositories[3] = data_repo_create_nothreadsafe(nb_tasks, __jdf2c_key_fns_RESULT, (parsec_taskpool_t*)__parsec_tp, 1);
+(void)saved_nb_tasks;
+(void)__j_min; (void)__j_max;  (void)__jdf2c_j_start; (void)__jdf2c_j_end; (void)__jdf2c_j_inc;  (void)assignments; (void)__parsec_tp; (void)es;
+  if(1 == parsec_atomic_fetch_dec_int32(&__parsec_tp->sync_point)) {
+    /* Last initialization task complete. Update the number of tasks. */
+    __parsec_tp->super.super.tdm.module->taskpool_addto_nb_tasks(&__parsec_tp->super.super, __parsec_tp->initial_number_tasks);
+    parsec_mfence();  /* write memory barrier to guarantee that the scheduler gets the correct number of tasks */
+    parsec_taskpool_enable((parsec_taskpool_t*)__parsec_tp, &__parsec_tp->startup_queue,
+                           (parsec_task_t*)this_task, es, __parsec_tp->super.super.nb_pending_actions);
+    __parsec_tp->super.super.tdm.module->taskpool_ready(&__parsec_tp->super.super);
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+    PARSEC_PROFILING_TRACE(es->es_profile,
+                           this_task->taskpool->profiling_array[2 * this_task->task_class->task_class_id + 1],
+                           0,
+                           this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    return PARSEC_HOOK_RETURN_DONE;
+  }
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static const __parsec_chore_t __merge_sort_RESULT_chores[] ={
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+    { .type     = PARSEC_DEV_CPU,
+      .evaluate = (parsec_evaluate_function_t*)NULL,
+      .hook     = (parsec_hook_t*)hook_of_merge_sort_RESULT },
+#endif  /* defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+    { .type     = PARSEC_DEV_NONE,
+      .evaluate = NULL,
+      .hook     = (parsec_hook_t*)NULL },  /* End marker */
+};
+
+static const parsec_task_class_t merge_sort_RESULT = {
+  .name = "RESULT",
+  .task_class_id = 3,
+  .nb_flows = 1,
+  .nb_parameters = 1,
+  .nb_locals = 2,
+  .task_class_type = PARSEC_TASK_CLASS_TYPE_PTG,
+  .params = { &symb_merge_sort_RESULT_j, NULL },
+  .locals = { &symb_merge_sort_RESULT_j, &symb_merge_sort_RESULT_h, NULL },
+  .data_affinity = (parsec_data_ref_fn_t*)affinity_of_merge_sort_RESULT,
+  .initial_data = (parsec_data_ref_fn_t*)affinity_of_merge_sort_RESULT,
+  .final_data = (parsec_data_ref_fn_t*)affinity_of_merge_sort_RESULT,
+  .priority = NULL,
+  .properties = properties_of_merge_sort_RESULT,
+#if MAX_PARAM_COUNT < 1  /* number of read flows of RESULT */
+  #error Too many read flows for task RESULT
+#endif  /* MAX_PARAM_COUNT */
+#if MAX_PARAM_COUNT < 0  /* number of write flows of RESULT */
+  #error Too many write flows for task RESULT
+#endif  /* MAX_PARAM_COUNT */
+  .in = { &flow_of_merge_sort_RESULT_for_C, NULL },
+  .out = { NULL },
+  .flags = 0x0 | PARSEC_USE_DEPS_MASK,
+  .dependencies_goal = 0x1,
+  .make_key = __jdf2c_make_key_RESULT,
+  .task_snprintf = parsec_task_snprintf,
+#if defined(PARSEC_PROF_TRACE)
+  .profile_info = &parsec_task_profile_info,
+#endif
+  .key_functions = &__jdf2c_key_fns_RESULT,
+  .fini = (parsec_hook_t*)NULL,
+  .incarnations = __merge_sort_RESULT_chores,
+  .find_deps = parsec_hash_find_deps,
+  .update_deps = parsec_update_deps_with_mask,
+  .iterate_successors = (parsec_traverse_function_t*)NULL,
+  .iterate_predecessors = (parsec_traverse_function_t*)iterate_predecessors_of_merge_sort_RESULT,
+  .release_deps = (parsec_release_deps_t*)release_deps_of_merge_sort_RESULT,
+  .prepare_output = (parsec_hook_t*)NULL,
+  .prepare_input = (parsec_hook_t*)data_lookup_of_merge_sort_RESULT,
+  .time_estimate = NULL,
+  .get_datatype = datatype_lookup_of_merge_sort_RESULT,
+  .complete_execution = (parsec_hook_t*)complete_hook_of_merge_sort_RESULT,
+  .release_task = &release_task_of_merge_sort_RESULT,
+#if defined(PARSEC_SIM)
+  .sim_cost_fct = (parsec_sim_cost_fct_t*)NULL,
+#endif
+};
+
+
+/******                                    REDUCE                                    ******/
+
+static inline int32_t expr_of_symb_merge_sort_REDUCE_h_fct(const __parsec_merge_sort_internal_taskpool_t *__parsec_tp, const __parsec_merge_sort_REDUCE_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return merge_sort_REDUCE_inline_c_expr7_line_230(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_merge_sort_REDUCE_h = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_merge_sort_REDUCE_h_fct }
+                   }
+};
+static const parsec_symbol_t symb_merge_sort_REDUCE_h = { .name = "h", .context_index = 0, .min = &expr_of_symb_merge_sort_REDUCE_h, .max = &expr_of_symb_merge_sort_REDUCE_h, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t minexpr_of_symb_merge_sort_REDUCE_lvl_fct(const __parsec_merge_sort_internal_taskpool_t *__parsec_tp, const __parsec_merge_sort_REDUCE_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_merge_sort_REDUCE_lvl = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_merge_sort_REDUCE_lvl_fct }
+                   }
+};
+static inline int maxexpr_of_symb_merge_sort_REDUCE_lvl_fct(const __parsec_merge_sort_internal_taskpool_t *__parsec_tp, const __parsec_merge_sort_REDUCE_parsec_assignment_t *locals)
+{
+  const int h = locals->h.value;
+  const int lvl = locals->lvl.value; (void)lvl;
+  const int width = locals->width.value; (void)width;
+  const int i = locals->i.value; (void)i;
+  const int prnt_width = locals->prnt_width.value; (void)prnt_width;
+  const int A_data_size = locals->A_data_size.value; (void)A_data_size;
+  const int B_data_size = locals->B_data_size.value; (void)B_data_size;
+  const int data_size = locals->data_size.value; (void)data_size;
+
+  (void)h;
+  (void)lvl;
+  (void)width;
+  (void)i;
+  (void)prnt_width;
+  (void)A_data_size;
+  (void)B_data_size;
+  (void)data_size;
+  (void)__parsec_tp; (void)locals;
+  return h;
+}
+static const parsec_expr_t maxexpr_of_symb_merge_sort_REDUCE_lvl = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_merge_sort_REDUCE_lvl_fct }
+                   }
+};
+static const parsec_symbol_t symb_merge_sort_REDUCE_lvl = { .name = "lvl", .context_index = 1, .min = &minexpr_of_symb_merge_sort_REDUCE_lvl, .max = &maxexpr_of_symb_merge_sort_REDUCE_lvl, .cst_inc = 1, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_merge_sort_REDUCE_width_fct(const __parsec_merge_sort_internal_taskpool_t *__parsec_tp, const __parsec_merge_sort_REDUCE_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return merge_sort_REDUCE_inline_c_expr6_line_232(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_merge_sort_REDUCE_width = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_merge_sort_REDUCE_width_fct }
+                   }
+};
+static const parsec_symbol_t symb_merge_sort_REDUCE_width = { .name = "width", .context_index = 2, .min = &expr_of_symb_merge_sort_REDUCE_width, .max = &expr_of_symb_merge_sort_REDUCE_width, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t minexpr_of_symb_merge_sort_REDUCE_i_fct(const __parsec_merge_sort_internal_taskpool_t *__parsec_tp, const __parsec_merge_sort_REDUCE_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_merge_sort_REDUCE_i = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_merge_sort_REDUCE_i_fct }
+                   }
+};
+static inline int maxexpr_of_symb_merge_sort_REDUCE_i_fct(const __parsec_merge_sort_internal_taskpool_t *__parsec_tp, const __parsec_merge_sort_REDUCE_parsec_assignment_t *locals)
+{
+  const int h = locals->h.value; (void)h;
+  const int lvl = locals->lvl.value; (void)lvl;
+  const int width = locals->width.value;
+  const int i = locals->i.value; (void)i;
+  const int prnt_width = locals->prnt_width.value; (void)prnt_width;
+  const int A_data_size = locals->A_data_size.value; (void)A_data_size;
+  const int B_data_size = locals->B_data_size.value; (void)B_data_size;
+  const int data_size = locals->data_size.value; (void)data_size;
+
+  (void)h;
+  (void)lvl;
+  (void)width;
+  (void)i;
+  (void)prnt_width;
+  (void)A_data_size;
+  (void)B_data_size;
+  (void)data_size;
+  (void)__parsec_tp; (void)locals;
+  return (width - 1);
+}
+static const parsec_expr_t maxexpr_of_symb_merge_sort_REDUCE_i = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_merge_sort_REDUCE_i_fct }
+                   }
+};
+static const parsec_symbol_t symb_merge_sort_REDUCE_i = { .name = "i", .context_index = 3, .min = &minexpr_of_symb_merge_sort_REDUCE_i, .max = &maxexpr_of_symb_merge_sort_REDUCE_i, .cst_inc = 1, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_merge_sort_REDUCE_prnt_width_fct(const __parsec_merge_sort_internal_taskpool_t *__parsec_tp, const __parsec_merge_sort_REDUCE_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return merge_sort_REDUCE_inline_c_expr5_line_235(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_merge_sort_REDUCE_prnt_width = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_merge_sort_REDUCE_prnt_width_fct }
+                   }
+};
+static const parsec_symbol_t symb_merge_sort_REDUCE_prnt_width = { .name = "prnt_width", .context_index = 4, .min = &expr_of_symb_merge_sort_REDUCE_prnt_width, .max = &expr_of_symb_merge_sort_REDUCE_prnt_width, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_merge_sort_REDUCE_A_data_size_fct(const __parsec_merge_sort_internal_taskpool_t *__parsec_tp, const __parsec_merge_sort_REDUCE_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return merge_sort_REDUCE_inline_c_expr4_line_237(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_merge_sort_REDUCE_A_data_size = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_merge_sort_REDUCE_A_data_size_fct }
+                   }
+};
+static const parsec_symbol_t symb_merge_sort_REDUCE_A_data_size = { .name = "A_data_size", .context_index = 5, .min = &expr_of_symb_merge_sort_REDUCE_A_data_size, .max = &expr_of_symb_merge_sort_REDUCE_A_data_size, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_merge_sort_REDUCE_B_data_size_fct(const __parsec_merge_sort_internal_taskpool_t *__parsec_tp, const __parsec_merge_sort_REDUCE_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return merge_sort_REDUCE_inline_c_expr3_line_239(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_merge_sort_REDUCE_B_data_size = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_merge_sort_REDUCE_B_data_size_fct }
+                   }
+};
+static const parsec_symbol_t symb_merge_sort_REDUCE_B_data_size = { .name = "B_data_size", .context_index = 6, .min = &expr_of_symb_merge_sort_REDUCE_B_data_size, .max = &expr_of_symb_merge_sort_REDUCE_B_data_size, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_merge_sort_REDUCE_data_size_fct(const __parsec_merge_sort_internal_taskpool_t *__parsec_tp, const __parsec_merge_sort_REDUCE_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return merge_sort_REDUCE_inline_c_expr2_line_241(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_merge_sort_REDUCE_data_size = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_merge_sort_REDUCE_data_size_fct }
+                   }
+};
+static const parsec_symbol_t symb_merge_sort_REDUCE_data_size = { .name = "data_size", .context_index = 7, .min = &expr_of_symb_merge_sort_REDUCE_data_size, .max = &expr_of_symb_merge_sort_REDUCE_data_size, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int affinity_of_merge_sort_REDUCE(const __parsec_merge_sort_REDUCE_task_t *this_task,
+                     parsec_data_ref_t *ref)
+{
+    const __parsec_merge_sort_internal_taskpool_t *__parsec_tp = (const __parsec_merge_sort_internal_taskpool_t*)this_task->taskpool;
+  const int h = this_task->locals.h.value; (void)h;
+  const int lvl = this_task->locals.lvl.value; (void)lvl;
+  const int width = this_task->locals.width.value; (void)width;
+  const int i = this_task->locals.i.value; (void)i;
+  const int prnt_width = this_task->locals.prnt_width.value; (void)prnt_width;
+  const int A_data_size = this_task->locals.A_data_size.value; (void)A_data_size;
+  const int B_data_size = this_task->locals.B_data_size.value; (void)B_data_size;
+  const int data_size = this_task->locals.data_size.value; (void)data_size;
+
+  /* Silent Warnings: should look into predicate to know what variables are usefull */
+  (void)h;
+  (void)lvl;
+  (void)width;
+  (void)i;
+  (void)prnt_width;
+  (void)A_data_size;
+  (void)B_data_size;
+  (void)data_size;
+  ref->dc = (parsec_data_collection_t *)__parsec_tp->super._g_dataA;
+  /* Compute data key */
+  ref->key = ref->dc->data_key(ref->dc, i, 0);
+  return 1;
+}
+static const parsec_property_t properties_of_merge_sort_REDUCE[1] = {
+  {.name = NULL, .expr = NULL}
+};
+static inline int expr_of_cond_for_flow_of_merge_sort_REDUCE_for_C_dep1_atline_252_fct(const __parsec_merge_sort_internal_taskpool_t *__parsec_tp, const __parsec_merge_sort_REDUCE_parsec_assignment_t *locals)
+{
+  const int h = locals->h.value; (void)h;
+  const int lvl = locals->lvl.value; (void)lvl;
+  const int width = locals->width.value; (void)width;
+  const int i = locals->i.value; (void)i;
+  const int prnt_width = locals->prnt_width.value; (void)prnt_width;
+  const int A_data_size = locals->A_data_size.value; (void)A_data_size;
+  const int B_data_size = locals->B_data_size.value; (void)B_data_size;
+  const int data_size = locals->data_size.value; (void)data_size;
+
+  (void)h;
+  (void)lvl;
+  (void)width;
+  (void)i;
+  (void)prnt_width;
+  (void)A_data_size;
+  (void)B_data_size;
+  (void)data_size;
+  (void)__parsec_tp; (void)locals;
+  return ((lvl) < (h) && (0) == ((i % 2)));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_merge_sort_REDUCE_for_C_dep1_atline_252 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_merge_sort_REDUCE_for_C_dep1_atline_252_fct }
+                   }
+};
+static const parsec_dep_t flow_of_merge_sort_REDUCE_for_C_dep1_atline_252 = {
+  .cond = &expr_of_cond_for_flow_of_merge_sort_REDUCE_for_C_dep1_atline_252,  /* ((lvl) < (h) && (0) == ((i % 2))) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 2, /* merge_sort_REDUCE */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_merge_sort_REDUCE_for_A,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_merge_sort_REDUCE_for_C,
+};
+static inline int expr_of_cond_for_flow_of_merge_sort_REDUCE_for_C_dep2_atline_253_fct(const __parsec_merge_sort_internal_taskpool_t *__parsec_tp, const __parsec_merge_sort_REDUCE_parsec_assignment_t *locals)
+{
+  const int h = locals->h.value; (void)h;
+  const int lvl = locals->lvl.value; (void)lvl;
+  const int width = locals->width.value; (void)width;
+  const int i = locals->i.value; (void)i;
+  const int prnt_width = locals->prnt_width.value; (void)prnt_width;
+  const int A_data_size = locals->A_data_size.value; (void)A_data_size;
+  const int B_data_size = locals->B_data_size.value; (void)B_data_size;
+  const int data_size = locals->data_size.value; (void)data_size;
+
+  (void)h;
+  (void)lvl;
+  (void)width;
+  (void)i;
+  (void)prnt_width;
+  (void)A_data_size;
+  (void)B_data_size;
+  (void)data_size;
+  (void)__parsec_tp; (void)locals;
+  return ((lvl) < (h) && (0) != ((i % 2)));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_merge_sort_REDUCE_for_C_dep2_atline_253 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_merge_sort_REDUCE_for_C_dep2_atline_253_fct }
+                   }
+};
+static const parsec_dep_t flow_of_merge_sort_REDUCE_for_C_dep2_atline_253 = {
+  .cond = &expr_of_cond_for_flow_of_merge_sort_REDUCE_for_C_dep2_atline_253,  /* ((lvl) < (h) && (0) != ((i % 2))) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 2, /* merge_sort_REDUCE */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_merge_sort_REDUCE_for_B,
+  .dep_index = 1,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_merge_sort_REDUCE_for_C,
+};
+static inline int expr_of_cond_for_flow_of_merge_sort_REDUCE_for_C_dep3_atline_254_fct(const __parsec_merge_sort_internal_taskpool_t *__parsec_tp, const __parsec_merge_sort_REDUCE_parsec_assignment_t *locals)
+{
+  const int h = locals->h.value; (void)h;
+  const int lvl = locals->lvl.value; (void)lvl;
+  const int width = locals->width.value; (void)width;
+  const int i = locals->i.value; (void)i;
+  const int prnt_width = locals->prnt_width.value; (void)prnt_width;
+  const int A_data_size = locals->A_data_size.value; (void)A_data_size;
+  const int B_data_size = locals->B_data_size.value; (void)B_data_size;
+  const int data_size = locals->data_size.value; (void)data_size;
+
+  (void)h;
+  (void)lvl;
+  (void)width;
+  (void)i;
+  (void)prnt_width;
+  (void)A_data_size;
+  (void)B_data_size;
+  (void)data_size;
+  (void)__parsec_tp; (void)locals;
+  return (lvl) == (h);
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_merge_sort_REDUCE_for_C_dep3_atline_254 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_merge_sort_REDUCE_for_C_dep3_atline_254_fct }
+                   }
+};
+static const parsec_dep_t flow_of_merge_sort_REDUCE_for_C_dep3_atline_254 = {
+  .cond = &expr_of_cond_for_flow_of_merge_sort_REDUCE_for_C_dep3_atline_254,  /* (lvl) == (h) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 3, /* merge_sort_RESULT */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_merge_sort_RESULT_for_C,
+  .dep_index = 2,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_merge_sort_REDUCE_for_C,
+};
+#if MAX_DEP_OUT_COUNT < 3  /* number of output dependencies */
+    #error Too many output dependencies (supports up to MAX_DEP_OUT_COUNT [=10] but found 3). Fix the code or recompile PaRSEC with a larger MAX_DEP_OUT_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_merge_sort_REDUCE_for_C = {
+  .name               = "C",
+  .sym_type           = PARSEC_SYM_OUT,
+  .flow_flags         = PARSEC_FLOW_ACCESS_WRITE,
+  .flow_index         = 0,
+  .flow_datatype_mask = 0x1,
+  .dep_in     = { NULL },
+  .dep_out    = { &flow_of_merge_sort_REDUCE_for_C_dep1_atline_252,
+ &flow_of_merge_sort_REDUCE_for_C_dep2_atline_253,
+ &flow_of_merge_sort_REDUCE_for_C_dep3_atline_254 }
+};
+
+static inline int expr_of_cond_for_flow_of_merge_sort_REDUCE_for_A_dep1_atline_245_fct(const __parsec_merge_sort_internal_taskpool_t *__parsec_tp, const __parsec_merge_sort_REDUCE_parsec_assignment_t *locals)
+{
+  const int h = locals->h.value; (void)h;
+  const int lvl = locals->lvl.value;
+  const int width = locals->width.value; (void)width;
+  const int i = locals->i.value; (void)i;
+  const int prnt_width = locals->prnt_width.value; (void)prnt_width;
+  const int A_data_size = locals->A_data_size.value; (void)A_data_size;
+  const int B_data_size = locals->B_data_size.value; (void)B_data_size;
+  const int data_size = locals->data_size.value; (void)data_size;
+
+  (void)h;
+  (void)lvl;
+  (void)width;
+  (void)i;
+  (void)prnt_width;
+  (void)A_data_size;
+  (void)B_data_size;
+  (void)data_size;
+  (void)__parsec_tp; (void)locals;
+  return (lvl) == (0);
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_merge_sort_REDUCE_for_A_dep1_atline_245 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_merge_sort_REDUCE_for_A_dep1_atline_245_fct }
+                   }
+};
+static const parsec_dep_t flow_of_merge_sort_REDUCE_for_A_dep1_atline_245 = {
+  .cond = &expr_of_cond_for_flow_of_merge_sort_REDUCE_for_A_dep1_atline_245,  /* (lvl) == (0) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 1, /* merge_sort_SORT */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_merge_sort_SORT_for_A,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_merge_sort_REDUCE_for_A,
+};
+static inline int expr_of_cond_for_flow_of_merge_sort_REDUCE_for_A_dep2_atline_246_fct(const __parsec_merge_sort_internal_taskpool_t *__parsec_tp, const __parsec_merge_sort_REDUCE_parsec_assignment_t *locals)
+{
+  const int h = locals->h.value; (void)h;
+  const int lvl = locals->lvl.value;
+  const int width = locals->width.value; (void)width;
+  const int i = locals->i.value; (void)i;
+  const int prnt_width = locals->prnt_width.value; (void)prnt_width;
+  const int A_data_size = locals->A_data_size.value; (void)A_data_size;
+  const int B_data_size = locals->B_data_size.value; (void)B_data_size;
+  const int data_size = locals->data_size.value; (void)data_size;
+
+  (void)h;
+  (void)lvl;
+  (void)width;
+  (void)i;
+  (void)prnt_width;
+  (void)A_data_size;
+  (void)B_data_size;
+  (void)data_size;
+  (void)__parsec_tp; (void)locals;
+  return (lvl) > (0);
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_merge_sort_REDUCE_for_A_dep2_atline_246 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_merge_sort_REDUCE_for_A_dep2_atline_246_fct }
+                   }
+};
+static const parsec_dep_t flow_of_merge_sort_REDUCE_for_A_dep2_atline_246 = {
+  .cond = &expr_of_cond_for_flow_of_merge_sort_REDUCE_for_A_dep2_atline_246,  /* (lvl) > (0) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 2, /* merge_sort_REDUCE */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_merge_sort_REDUCE_for_C,
+  .dep_index = 1,
+  .dep_datatype_index = 1,
+  .belongs_to = &flow_of_merge_sort_REDUCE_for_A,
+};
+#if MAX_DEP_IN_COUNT < 2  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 2). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_merge_sort_REDUCE_for_A = {
+  .name               = "A",
+  .sym_type           = PARSEC_SYM_IN,
+  .flow_flags         = PARSEC_FLOW_ACCESS_READ,
+  .flow_index         = 1,
+  .flow_datatype_mask = 0x0,
+  .dep_in     = { &flow_of_merge_sort_REDUCE_for_A_dep1_atline_245,
+ &flow_of_merge_sort_REDUCE_for_A_dep2_atline_246 },
+  .dep_out    = { NULL }
+};
+
+static inline int expr_of_cond_for_flow_of_merge_sort_REDUCE_for_B_dep1_atline_248_fct(const __parsec_merge_sort_internal_taskpool_t *__parsec_tp, const __parsec_merge_sort_REDUCE_parsec_assignment_t *locals)
+{
+  const int h = locals->h.value; (void)h;
+  const int lvl = locals->lvl.value;
+  const int width = locals->width.value; (void)width;
+  const int i = locals->i.value; (void)i;
+  const int prnt_width = locals->prnt_width.value; (void)prnt_width;
+  const int A_data_size = locals->A_data_size.value; (void)A_data_size;
+  const int B_data_size = locals->B_data_size.value; (void)B_data_size;
+  const int data_size = locals->data_size.value; (void)data_size;
+
+  (void)h;
+  (void)lvl;
+  (void)width;
+  (void)i;
+  (void)prnt_width;
+  (void)A_data_size;
+  (void)B_data_size;
+  (void)data_size;
+  (void)__parsec_tp; (void)locals;
+  return (lvl) == (0);
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_merge_sort_REDUCE_for_B_dep1_atline_248 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_merge_sort_REDUCE_for_B_dep1_atline_248_fct }
+                   }
+};
+static const parsec_dep_t flow_of_merge_sort_REDUCE_for_B_dep1_atline_248 = {
+  .cond = &expr_of_cond_for_flow_of_merge_sort_REDUCE_for_B_dep1_atline_248,  /* (lvl) == (0) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = PARSEC_LOCAL_DATA_TASK_CLASS_ID, /* merge_sort___parsec_null_type */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .dep_index = 2,
+  .dep_datatype_index = 2,
+  .belongs_to = &flow_of_merge_sort_REDUCE_for_B,
+};
+static inline int expr_of_cond_for_flow_of_merge_sort_REDUCE_for_B_dep2_atline_249_fct(const __parsec_merge_sort_internal_taskpool_t *__parsec_tp, const __parsec_merge_sort_REDUCE_parsec_assignment_t *locals)
+{
+  const int h = locals->h.value; (void)h;
+  const int lvl = locals->lvl.value; (void)lvl;
+  const int width = locals->width.value; (void)width;
+  const int i = locals->i.value; (void)i;
+  const int prnt_width = locals->prnt_width.value; (void)prnt_width;
+  const int A_data_size = locals->A_data_size.value; (void)A_data_size;
+  const int B_data_size = locals->B_data_size.value; (void)B_data_size;
+  const int data_size = locals->data_size.value; (void)data_size;
+
+  (void)h;
+  (void)lvl;
+  (void)width;
+  (void)i;
+  (void)prnt_width;
+  (void)A_data_size;
+  (void)B_data_size;
+  (void)data_size;
+  (void)__parsec_tp; (void)locals;
+  return ((lvl) > (0) && ((prnt_width - 1)) <= ((i * 2)));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_merge_sort_REDUCE_for_B_dep2_atline_249 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_merge_sort_REDUCE_for_B_dep2_atline_249_fct }
+                   }
+};
+static const parsec_dep_t flow_of_merge_sort_REDUCE_for_B_dep2_atline_249 = {
+  .cond = &expr_of_cond_for_flow_of_merge_sort_REDUCE_for_B_dep2_atline_249,  /* ((lvl) > (0) && ((prnt_width - 1)) <= ((i * 2))) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = PARSEC_LOCAL_DATA_TASK_CLASS_ID, /* merge_sort___parsec_null_type */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .dep_index = 3,
+  .dep_datatype_index = 2,
+  .belongs_to = &flow_of_merge_sort_REDUCE_for_B,
+};
+static inline int expr_of_cond_for_flow_of_merge_sort_REDUCE_for_B_dep3_atline_250_fct(const __parsec_merge_sort_internal_taskpool_t *__parsec_tp, const __parsec_merge_sort_REDUCE_parsec_assignment_t *locals)
+{
+  const int h = locals->h.value; (void)h;
+  const int lvl = locals->lvl.value; (void)lvl;
+  const int width = locals->width.value; (void)width;
+  const int i = locals->i.value; (void)i;
+  const int prnt_width = locals->prnt_width.value; (void)prnt_width;
+  const int A_data_size = locals->A_data_size.value; (void)A_data_size;
+  const int B_data_size = locals->B_data_size.value; (void)B_data_size;
+  const int data_size = locals->data_size.value; (void)data_size;
+
+  (void)h;
+  (void)lvl;
+  (void)width;
+  (void)i;
+  (void)prnt_width;
+  (void)A_data_size;
+  (void)B_data_size;
+  (void)data_size;
+  (void)__parsec_tp; (void)locals;
+  return ((lvl) > (0) && ((prnt_width - 1)) > ((i * 2)));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_merge_sort_REDUCE_for_B_dep3_atline_250 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_merge_sort_REDUCE_for_B_dep3_atline_250_fct }
+                   }
+};
+static const parsec_dep_t flow_of_merge_sort_REDUCE_for_B_dep3_atline_250 = {
+  .cond = &expr_of_cond_for_flow_of_merge_sort_REDUCE_for_B_dep3_atline_250,  /* ((lvl) > (0) && ((prnt_width - 1)) > ((i * 2))) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 2, /* merge_sort_REDUCE */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_merge_sort_REDUCE_for_C,
+  .dep_index = 4,
+  .dep_datatype_index = 4,
+  .belongs_to = &flow_of_merge_sort_REDUCE_for_B,
+};
+#if MAX_DEP_IN_COUNT < 3  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 3). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_merge_sort_REDUCE_for_B = {
+  .name               = "B",
+  .sym_type           = PARSEC_SYM_IN,
+  .flow_flags         = PARSEC_FLOW_ACCESS_READ|PARSEC_FLOW_HAS_IN_DEPS,
+  .flow_index         = 2,
+  .flow_datatype_mask = 0x0,
+  .dep_in     = { &flow_of_merge_sort_REDUCE_for_B_dep1_atline_248,
+ &flow_of_merge_sort_REDUCE_for_B_dep2_atline_249,
+ &flow_of_merge_sort_REDUCE_for_B_dep3_atline_250 },
+  .dep_out    = { NULL }
+};
+
+static void
+iterate_successors_of_merge_sort_REDUCE(parsec_execution_stream_t *es, const __parsec_merge_sort_REDUCE_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_merge_sort_internal_taskpool_t *__parsec_tp = (const __parsec_merge_sort_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_merge_sort_REDUCE_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_merge_sort_REDUCE_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int h = __jdf2c__tmp_locals.h.value; (void)h;
+  const int lvl = __jdf2c__tmp_locals.lvl.value; (void)lvl;
+  const int width = __jdf2c__tmp_locals.width.value; (void)width;
+  const int i = __jdf2c__tmp_locals.i.value; (void)i;
+  const int prnt_width = __jdf2c__tmp_locals.prnt_width.value; (void)prnt_width;
+  const int A_data_size = __jdf2c__tmp_locals.A_data_size.value; (void)A_data_size;
+  const int B_data_size = __jdf2c__tmp_locals.B_data_size.value; (void)B_data_size;
+  const int data_size = __jdf2c__tmp_locals.data_size.value; (void)data_size;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)h;  (void)lvl;  (void)width;  (void)i;  (void)prnt_width;  (void)A_data_size;  (void)B_data_size;  (void)data_size;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_dataA(i, 0);
+#endif
+  if( action_mask & 0x7 ) {  /* Flow of data C [0] */
+    data.data   = this_task->data._f_C.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x1 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_merge_sort_DEFAULT_ADT->arena;
+    data.local.src_datatype = MY_TYPE;
+    data.local.dst_datatype = MY_TYPE;
+    data.local.src_count  = data_size;
+    data.local.dst_count  = data_size;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_merge_sort_DEFAULT_ADT->arena;
+    data.remote.src_datatype = MY_TYPE;
+    data.remote.dst_datatype = MY_TYPE;
+    data.remote.src_count  = data_size;
+    data.remote.dst_count  = data_size;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( ((lvl) < (h) && (0) == ((i % 2))) ) {
+      __parsec_merge_sort_REDUCE_task_t* ncc = (__parsec_merge_sort_REDUCE_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[merge_sort_REDUCE.task_class_id];
+        const int REDUCE_h = merge_sort_REDUCE_inline_c_expr7_line_230(__parsec_tp, &ncc->locals);
+        assert(&nc.locals[0].value == &ncc->locals.h.value);
+        ncc->locals.h.value = REDUCE_h;
+        const int REDUCE_lvl = (lvl + 1);
+        if( (REDUCE_lvl >= (0)) && (REDUCE_lvl <= (ncc->locals.h.value)) ) {
+          assert(&nc.locals[1].value == &ncc->locals.lvl.value);
+          ncc->locals.lvl.value = REDUCE_lvl;
+          const int REDUCE_width = merge_sort_REDUCE_inline_c_expr6_line_232(__parsec_tp, &ncc->locals);
+          assert(&nc.locals[2].value == &ncc->locals.width.value);
+          ncc->locals.width.value = REDUCE_width;
+          const int REDUCE_i = (i / 2);
+          if( (REDUCE_i >= (0)) && (REDUCE_i <= ((ncc->locals.width.value - 1))) ) {
+            assert(&nc.locals[3].value == &ncc->locals.i.value);
+            ncc->locals.i.value = REDUCE_i;
+            const int REDUCE_prnt_width = merge_sort_REDUCE_inline_c_expr5_line_235(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[4].value == &ncc->locals.prnt_width.value);
+            ncc->locals.prnt_width.value = REDUCE_prnt_width;
+            const int REDUCE_A_data_size = merge_sort_REDUCE_inline_c_expr4_line_237(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[5].value == &ncc->locals.A_data_size.value);
+            ncc->locals.A_data_size.value = REDUCE_A_data_size;
+            const int REDUCE_B_data_size = merge_sort_REDUCE_inline_c_expr3_line_239(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[6].value == &ncc->locals.B_data_size.value);
+            ncc->locals.B_data_size.value = REDUCE_B_data_size;
+            const int REDUCE_data_size = merge_sort_REDUCE_inline_c_expr2_line_241(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[7].value == &ncc->locals.data_size.value);
+            ncc->locals.data_size.value = REDUCE_data_size;
+#if defined(DISTRIBUTED)
+            rank_dst = rank_of_dataA(ncc->locals.i.value, 0);
+            if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+              vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_dataA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_dataA, ncc->locals.i.value, 0);
+            nc.priority = __parsec_tp->super.super.priority;
+            successor_repo = REDUCE_repo;
+            successor_repo_key = __jdf2c_make_key_REDUCE((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+          RELEASE_DEP_OUTPUT(es, "C", this_task, "A", &nc, rank_src, rank_dst, &data);
+          if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_merge_sort_REDUCE_for_C_dep1_atline_252, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+            }
+          }
+    }
+  }
+  if( action_mask & 0x2 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_merge_sort_DEFAULT_ADT->arena;
+    data.local.src_datatype = MY_TYPE;
+    data.local.dst_datatype = MY_TYPE;
+    data.local.src_count  = data_size;
+    data.local.dst_count  = data_size;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_merge_sort_DEFAULT_ADT->arena;
+    data.remote.src_datatype = MY_TYPE;
+    data.remote.dst_datatype = MY_TYPE;
+    data.remote.src_count  = data_size;
+    data.remote.dst_count  = data_size;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( ((lvl) < (h) && (0) != ((i % 2))) ) {
+      __parsec_merge_sort_REDUCE_task_t* ncc = (__parsec_merge_sort_REDUCE_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[merge_sort_REDUCE.task_class_id];
+        const int REDUCE_h = merge_sort_REDUCE_inline_c_expr7_line_230(__parsec_tp, &ncc->locals);
+        assert(&nc.locals[0].value == &ncc->locals.h.value);
+        ncc->locals.h.value = REDUCE_h;
+        const int REDUCE_lvl = (lvl + 1);
+        if( (REDUCE_lvl >= (0)) && (REDUCE_lvl <= (ncc->locals.h.value)) ) {
+          assert(&nc.locals[1].value == &ncc->locals.lvl.value);
+          ncc->locals.lvl.value = REDUCE_lvl;
+          const int REDUCE_width = merge_sort_REDUCE_inline_c_expr6_line_232(__parsec_tp, &ncc->locals);
+          assert(&nc.locals[2].value == &ncc->locals.width.value);
+          ncc->locals.width.value = REDUCE_width;
+          const int REDUCE_i = (i / 2);
+          if( (REDUCE_i >= (0)) && (REDUCE_i <= ((ncc->locals.width.value - 1))) ) {
+            assert(&nc.locals[3].value == &ncc->locals.i.value);
+            ncc->locals.i.value = REDUCE_i;
+            const int REDUCE_prnt_width = merge_sort_REDUCE_inline_c_expr5_line_235(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[4].value == &ncc->locals.prnt_width.value);
+            ncc->locals.prnt_width.value = REDUCE_prnt_width;
+            const int REDUCE_A_data_size = merge_sort_REDUCE_inline_c_expr4_line_237(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[5].value == &ncc->locals.A_data_size.value);
+            ncc->locals.A_data_size.value = REDUCE_A_data_size;
+            const int REDUCE_B_data_size = merge_sort_REDUCE_inline_c_expr3_line_239(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[6].value == &ncc->locals.B_data_size.value);
+            ncc->locals.B_data_size.value = REDUCE_B_data_size;
+            const int REDUCE_data_size = merge_sort_REDUCE_inline_c_expr2_line_241(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[7].value == &ncc->locals.data_size.value);
+            ncc->locals.data_size.value = REDUCE_data_size;
+#if defined(DISTRIBUTED)
+            rank_dst = rank_of_dataA(ncc->locals.i.value, 0);
+            if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+              vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_dataA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_dataA, ncc->locals.i.value, 0);
+            nc.priority = __parsec_tp->super.super.priority;
+            successor_repo = REDUCE_repo;
+            successor_repo_key = __jdf2c_make_key_REDUCE((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+          RELEASE_DEP_OUTPUT(es, "C", this_task, "B", &nc, rank_src, rank_dst, &data);
+          if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_merge_sort_REDUCE_for_C_dep2_atline_253, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+            }
+          }
+    }
+  }
+  if( action_mask & 0x4 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_merge_sort_DEFAULT_ADT->arena;
+    data.local.src_datatype = MY_TYPE;
+    data.local.dst_datatype = MY_TYPE;
+    data.local.src_count  = data_size;
+    data.local.dst_count  = data_size;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_merge_sort_DEFAULT_ADT->arena;
+    data.remote.src_datatype = MY_TYPE;
+    data.remote.dst_datatype = MY_TYPE;
+    data.remote.src_count  = data_size;
+    data.remote.dst_count  = data_size;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( (lvl) == (h) ) {
+      __parsec_merge_sort_RESULT_task_t* ncc = (__parsec_merge_sort_RESULT_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[merge_sort_RESULT.task_class_id];
+        const int RESULT_j = 0;
+        if( (RESULT_j >= (0)) && (RESULT_j <= (0)) ) {
+          assert(&nc.locals[0].value == &ncc->locals.j.value);
+          ncc->locals.j.value = RESULT_j;
+          const int RESULT_h = merge_sort_RESULT_inline_c_expr1_line_292(__parsec_tp, &ncc->locals);
+          assert(&nc.locals[1].value == &ncc->locals.h.value);
+          ncc->locals.h.value = RESULT_h;
+#if defined(DISTRIBUTED)
+          rank_dst = rank_of_dataA(0, 0);
+          if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+            vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_dataA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_dataA, 0, 0);
+          nc.priority = __parsec_tp->super.super.priority;
+          successor_repo = RESULT_repo;
+          successor_repo_key = __jdf2c_make_key_RESULT((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+        RELEASE_DEP_OUTPUT(es, "C", this_task, "C", &nc, rank_src, rank_dst, &data);
+        if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_merge_sort_REDUCE_for_C_dep3_atline_254, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+          }
+    }
+  }
+  }
+  /* Flow of data A has only IN dependencies */
+  /* Flow of data B has only IN dependencies */
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static void
+iterate_predecessors_of_merge_sort_REDUCE(parsec_execution_stream_t *es, const __parsec_merge_sort_REDUCE_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_merge_sort_internal_taskpool_t *__parsec_tp = (const __parsec_merge_sort_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_merge_sort_REDUCE_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_merge_sort_REDUCE_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int h = __jdf2c__tmp_locals.h.value; (void)h;
+  const int lvl = __jdf2c__tmp_locals.lvl.value; (void)lvl;
+  const int width = __jdf2c__tmp_locals.width.value; (void)width;
+  const int i = __jdf2c__tmp_locals.i.value; (void)i;
+  const int prnt_width = __jdf2c__tmp_locals.prnt_width.value; (void)prnt_width;
+  const int A_data_size = __jdf2c__tmp_locals.A_data_size.value; (void)A_data_size;
+  const int B_data_size = __jdf2c__tmp_locals.B_data_size.value; (void)B_data_size;
+  const int data_size = __jdf2c__tmp_locals.data_size.value; (void)data_size;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)h;  (void)lvl;  (void)width;  (void)i;  (void)prnt_width;  (void)A_data_size;  (void)B_data_size;  (void)data_size;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_dataA(i, 0);
+#endif
+  /* Flow of data C has only IN dependencies */
+  if( action_mask & 0x3 ) {  /* Flow of data A [1] */
+    data.data   = this_task->data._f_A.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x1 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_merge_sort_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_merge_sort_DEFAULT_ADT->arena;
+    data.remote.src_datatype = MY_TYPE;
+    data.remote.dst_datatype = MY_TYPE;
+    data.remote.src_count  = NB;
+    data.remote.dst_count  = NB;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( (lvl) == (0) ) {
+      __parsec_merge_sort_SORT_task_t* ncc = (__parsec_merge_sort_SORT_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[merge_sort_SORT.task_class_id];
+        const int SORT_i = i;
+        if( (SORT_i >= (0)) && (SORT_i <= ((NT - 1))) ) {
+          assert(&nc.locals[0].value == &ncc->locals.i.value);
+          ncc->locals.i.value = SORT_i;
+#if defined(DISTRIBUTED)
+          rank_dst = rank_of_dataA(ncc->locals.i.value, 0);
+          if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+            vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_dataA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_dataA, ncc->locals.i.value, 0);
+          nc.priority = __parsec_tp->super.super.priority;
+          successor_repo = SORT_repo;
+          successor_repo_key = __jdf2c_make_key_SORT((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+        RELEASE_DEP_OUTPUT(es, "A", this_task, "A", &nc, rank_src, rank_dst, &data);
+        if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_merge_sort_REDUCE_for_A_dep1_atline_245, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+          }
+    }
+  }
+  if( action_mask & 0x2 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_merge_sort_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_merge_sort_DEFAULT_ADT->arena;
+    data.remote.src_datatype = MY_TYPE;
+    data.remote.dst_datatype = MY_TYPE;
+    data.remote.src_count  = A_data_size;
+    data.remote.dst_count  = A_data_size;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( (lvl) > (0) ) {
+      __parsec_merge_sort_REDUCE_task_t* ncc = (__parsec_merge_sort_REDUCE_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[merge_sort_REDUCE.task_class_id];
+        const int REDUCE_h = merge_sort_REDUCE_inline_c_expr7_line_230(__parsec_tp, &ncc->locals);
+        assert(&nc.locals[0].value == &ncc->locals.h.value);
+        ncc->locals.h.value = REDUCE_h;
+        const int REDUCE_lvl = (lvl - 1);
+        if( (REDUCE_lvl >= (0)) && (REDUCE_lvl <= (ncc->locals.h.value)) ) {
+          assert(&nc.locals[1].value == &ncc->locals.lvl.value);
+          ncc->locals.lvl.value = REDUCE_lvl;
+          const int REDUCE_width = merge_sort_REDUCE_inline_c_expr6_line_232(__parsec_tp, &ncc->locals);
+          assert(&nc.locals[2].value == &ncc->locals.width.value);
+          ncc->locals.width.value = REDUCE_width;
+          const int REDUCE_i = (i * 2);
+          if( (REDUCE_i >= (0)) && (REDUCE_i <= ((ncc->locals.width.value - 1))) ) {
+            assert(&nc.locals[3].value == &ncc->locals.i.value);
+            ncc->locals.i.value = REDUCE_i;
+            const int REDUCE_prnt_width = merge_sort_REDUCE_inline_c_expr5_line_235(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[4].value == &ncc->locals.prnt_width.value);
+            ncc->locals.prnt_width.value = REDUCE_prnt_width;
+            const int REDUCE_A_data_size = merge_sort_REDUCE_inline_c_expr4_line_237(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[5].value == &ncc->locals.A_data_size.value);
+            ncc->locals.A_data_size.value = REDUCE_A_data_size;
+            const int REDUCE_B_data_size = merge_sort_REDUCE_inline_c_expr3_line_239(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[6].value == &ncc->locals.B_data_size.value);
+            ncc->locals.B_data_size.value = REDUCE_B_data_size;
+            const int REDUCE_data_size = merge_sort_REDUCE_inline_c_expr2_line_241(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[7].value == &ncc->locals.data_size.value);
+            ncc->locals.data_size.value = REDUCE_data_size;
+#if defined(DISTRIBUTED)
+            rank_dst = rank_of_dataA(ncc->locals.i.value, 0);
+            if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+              vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_dataA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_dataA, ncc->locals.i.value, 0);
+            nc.priority = __parsec_tp->super.super.priority;
+            successor_repo = REDUCE_repo;
+            successor_repo_key = __jdf2c_make_key_REDUCE((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+          RELEASE_DEP_OUTPUT(es, "A", this_task, "C", &nc, rank_src, rank_dst, &data);
+          if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_merge_sort_REDUCE_for_A_dep2_atline_246, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+            }
+          }
+    }
+  }
+  }
+  if( action_mask & 0x1c ) {  /* Flow of data B [2] */
+    data.data   = this_task->data._f_B.data_out;
+    data.data_future  = NULL;
+    /* action_mask & 0x4 goes to data __parsec_null_type() */
+    /* action_mask & 0x8 goes to data __parsec_null_type() */
+  if( action_mask & 0x10 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_merge_sort_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_merge_sort_DEFAULT_ADT->arena;
+    data.remote.src_datatype = MY_TYPE;
+    data.remote.dst_datatype = MY_TYPE;
+    data.remote.src_count  = B_data_size;
+    data.remote.dst_count  = B_data_size;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( ((lvl) > (0) && ((prnt_width - 1)) > ((i * 2))) ) {
+      __parsec_merge_sort_REDUCE_task_t* ncc = (__parsec_merge_sort_REDUCE_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[merge_sort_REDUCE.task_class_id];
+        const int REDUCE_h = merge_sort_REDUCE_inline_c_expr7_line_230(__parsec_tp, &ncc->locals);
+        assert(&nc.locals[0].value == &ncc->locals.h.value);
+        ncc->locals.h.value = REDUCE_h;
+        const int REDUCE_lvl = (lvl - 1);
+        if( (REDUCE_lvl >= (0)) && (REDUCE_lvl <= (ncc->locals.h.value)) ) {
+          assert(&nc.locals[1].value == &ncc->locals.lvl.value);
+          ncc->locals.lvl.value = REDUCE_lvl;
+          const int REDUCE_width = merge_sort_REDUCE_inline_c_expr6_line_232(__parsec_tp, &ncc->locals);
+          assert(&nc.locals[2].value == &ncc->locals.width.value);
+          ncc->locals.width.value = REDUCE_width;
+          const int REDUCE_i = ((i * 2) + 1);
+          if( (REDUCE_i >= (0)) && (REDUCE_i <= ((ncc->locals.width.value - 1))) ) {
+            assert(&nc.locals[3].value == &ncc->locals.i.value);
+            ncc->locals.i.value = REDUCE_i;
+            const int REDUCE_prnt_width = merge_sort_REDUCE_inline_c_expr5_line_235(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[4].value == &ncc->locals.prnt_width.value);
+            ncc->locals.prnt_width.value = REDUCE_prnt_width;
+            const int REDUCE_A_data_size = merge_sort_REDUCE_inline_c_expr4_line_237(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[5].value == &ncc->locals.A_data_size.value);
+            ncc->locals.A_data_size.value = REDUCE_A_data_size;
+            const int REDUCE_B_data_size = merge_sort_REDUCE_inline_c_expr3_line_239(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[6].value == &ncc->locals.B_data_size.value);
+            ncc->locals.B_data_size.value = REDUCE_B_data_size;
+            const int REDUCE_data_size = merge_sort_REDUCE_inline_c_expr2_line_241(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[7].value == &ncc->locals.data_size.value);
+            ncc->locals.data_size.value = REDUCE_data_size;
+#if defined(DISTRIBUTED)
+            rank_dst = rank_of_dataA(ncc->locals.i.value, 0);
+            if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+              vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_dataA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_dataA, ncc->locals.i.value, 0);
+            nc.priority = __parsec_tp->super.super.priority;
+            successor_repo = REDUCE_repo;
+            successor_repo_key = __jdf2c_make_key_REDUCE((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+          RELEASE_DEP_OUTPUT(es, "B", this_task, "C", &nc, rank_src, rank_dst, &data);
+          if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_merge_sort_REDUCE_for_B_dep3_atline_250, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+            }
+          }
+    }
+  }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static int release_deps_of_merge_sort_REDUCE(parsec_execution_stream_t *es, __parsec_merge_sort_REDUCE_task_t *this_task, uint32_t action_mask, parsec_remote_deps_t *deps)
+{
+  PARSEC_PINS(es, RELEASE_DEPS_BEGIN, (parsec_task_t *)this_task);  const __parsec_merge_sort_internal_taskpool_t *__parsec_tp = (const __parsec_merge_sort_internal_taskpool_t *)this_task->taskpool;
+  parsec_release_dep_fct_arg_t arg;
+  int __vp_id;
+  int consume_local_repo = 0;
+  arg.action_mask = action_mask;
+  arg.output_entry = NULL;
+  arg.output_repo = NULL;
+#if defined(DISTRIBUTED)
+  arg.remote_deps = deps;
+#endif  /* defined(DISTRIBUTED) */
+  assert(NULL != es);
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS )    arg.ready_lists = alloca(sizeof(parsec_task_t *) * es->virtual_process->parsec_context->nb_vp);
+  else
+    arg.ready_lists = NULL;
+  for( __vp_id = 0; __vp_id < es->virtual_process->parsec_context->nb_vp; arg.ready_lists[__vp_id++] = NULL );
+  (void)__parsec_tp; (void)deps;
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_C.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_C.source_repo, this_task->data._f_C.source_repo_entry->ht_item.key );
+    }
+    if( NULL != this_task->data._f_A.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_A.source_repo, this_task->data._f_A.source_repo_entry->ht_item.key );
+    }
+    if( NULL != this_task->data._f_B.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_B.source_repo, this_task->data._f_B.source_repo_entry->ht_item.key );
+    }
+  }
+  consume_local_repo = (this_task->repo_entry != NULL);
+  arg.output_repo = REDUCE_repo;
+  arg.output_entry = this_task->repo_entry;
+  arg.output_usage = 0;
+  if( action_mask & (PARSEC_ACTION_RELEASE_LOCAL_DEPS | PARSEC_ACTION_GET_REPO_ENTRY) ) {
+    arg.output_entry = data_repo_lookup_entry_and_create( es, arg.output_repo, __jdf2c_make_key_REDUCE((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    arg.output_entry->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(arg.output_entry->sim_exec_date == 0);
+    arg.output_entry->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  if(action_mask & ( PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE ) ){
+    /* Generate the reshape promise for the outputs that need it */
+    iterate_successors_of_merge_sort_REDUCE(es, this_task, action_mask, parsec_set_up_reshape_promise, &arg);
+   }
+  iterate_successors_of_merge_sort_REDUCE(es, this_task, action_mask, parsec_release_dep_fct, &arg);
+
+#if defined(DISTRIBUTED)
+  if( (action_mask & PARSEC_ACTION_SEND_REMOTE_DEPS) && (NULL != arg.remote_deps)) {
+    parsec_remote_dep_activate(es, (parsec_task_t *)this_task, arg.remote_deps, arg.remote_deps->outgoing_mask);
+  }
+#endif
+
+  if(action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS) {
+    data_repo_entry_addto_usage_limit(REDUCE_repo, arg.output_entry->ht_item.key, arg.output_usage);
+    __parsec_schedule_vp(es, arg.ready_lists, 0);
+  }
+      if (consume_local_repo) {
+         data_repo_entry_used_once( REDUCE_repo, this_task->repo_entry->ht_item.key );
+      }
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_C.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_C.data_in);
+    }
+    if( NULL != this_task->data._f_A.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_A.data_in);
+    }
+    if( NULL != this_task->data._f_B.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_B.data_in);
+    }
+  }
+  PARSEC_PINS(es, RELEASE_DEPS_END, (parsec_task_t *)this_task);  return 0;
+}
+
+static int data_lookup_of_merge_sort_REDUCE(parsec_execution_stream_t *es, __parsec_merge_sort_REDUCE_task_t *this_task)
+{
+  const __parsec_merge_sort_internal_taskpool_t *__parsec_tp = (__parsec_merge_sort_internal_taskpool_t *)this_task->taskpool;
+  parsec_assignment_t generic_locals[MAX_PARAM_COUNT];  /* generic task locals */
+  int target_device = 0; (void)target_device;
+  (void)__parsec_tp; (void)generic_locals; (void)es;
+  parsec_data_copy_t *chunk = NULL;
+  data_repo_t        *reshape_repo  = NULL, *consumed_repo  = NULL;
+  data_repo_entry_t  *reshape_entry = NULL, *consumed_entry = NULL;
+  parsec_key_t        reshape_entry_key = 0, consumed_entry_key = 0;
+  uint8_t             consumed_flow_index;
+  parsec_dep_data_description_t data;
+  int ret;
+  (void)reshape_repo; (void)reshape_entry; (void)reshape_entry_key;
+  (void)consumed_repo; (void)consumed_entry; (void)consumed_entry_key;
+  (void)consumed_flow_index;
+  (void)chunk; (void)data; (void)ret;
+  const int h = this_task->locals.h.value; (void)h;
+  const int lvl = this_task->locals.lvl.value; (void)lvl;
+  const int width = this_task->locals.width.value; (void)width;
+  const int i = this_task->locals.i.value; (void)i;
+  const int prnt_width = this_task->locals.prnt_width.value; (void)prnt_width;
+  const int A_data_size = this_task->locals.A_data_size.value; (void)A_data_size;
+  const int B_data_size = this_task->locals.B_data_size.value; (void)B_data_size;
+  const int data_size = this_task->locals.data_size.value; (void)data_size;
+  if( NULL == this_task->repo_entry ){
+    this_task->repo_entry = data_repo_lookup_entry_and_create(es, REDUCE_repo,                                       __jdf2c_make_key_REDUCE((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    data_repo_entry_addto_usage_limit(REDUCE_repo, this_task->repo_entry->ht_item.key, 1);    this_task->repo_entry ->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(this_task->repo_entry ->sim_exec_date == 0);
+    this_task->repo_entry ->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  /* The reshape repo is the current task repo. */  reshape_repo = REDUCE_repo;
+  reshape_entry_key = __jdf2c_make_key_REDUCE((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals) ;
+  reshape_entry = this_task->repo_entry;
+  /* Lookup the input data, and store them in the context if any */
+
+if(! this_task->data._f_C.fulfill ){ /* Flow C */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_C.data_out = NULL;  /* By default, if nothing matches */
+    if( ((lvl) < (h) && (0) == ((i % 2))) ) {
+    /* Flow C [0] dependency [0] pure output data  */
+    if( NULL == (chunk = this_task->data._f_C.data_in) ) {
+       /* No data set up by predecessor */
+      chunk = parsec_arena_get_copy(PARSEC_merge_sort_DEFAULT_ADT->arena, data_size, target_device, MY_TYPE);
+      chunk->original->owner_device = target_device;
+      this_task->data._f_C.data_out = chunk;
+    }
+    }
+    else if( ((lvl) < (h) && (0) != ((i % 2))) ) {
+    /* Flow C [0] dependency [1] pure output data  */
+    if( NULL == (chunk = this_task->data._f_C.data_in) ) {
+       /* No data set up by predecessor */
+      chunk = parsec_arena_get_copy(PARSEC_merge_sort_DEFAULT_ADT->arena, data_size, target_device, MY_TYPE);
+      chunk->original->owner_device = target_device;
+      this_task->data._f_C.data_out = chunk;
+    }
+    }
+    else if( (lvl) == (h) ) {
+    /* Flow C [0] dependency [2] pure output data  */
+    if( NULL == (chunk = this_task->data._f_C.data_in) ) {
+       /* No data set up by predecessor */
+      chunk = parsec_arena_get_copy(PARSEC_merge_sort_DEFAULT_ADT->arena, data_size, target_device, MY_TYPE);
+      chunk->original->owner_device = target_device;
+      this_task->data._f_C.data_out = chunk;
+    }
+    }
+    this_task->data._f_C.data_in     = chunk;
+    this_task->data._f_C.source_repo       = consumed_repo;
+    this_task->data._f_C.source_repo_entry = consumed_entry;
+    if( this_task->data._f_C.source_repo_entry == this_task->repo_entry ){
+      /* in case we have consume from this task repo entry for the flow,
+       * it is cleaned up, avoiding having old stuff during release_deps_of
+       */
+      this_task->repo_entry->data[0] = NULL;
+    }
+    this_task->data._f_C.fulfill = 1;
+}
+
+
+if(! this_task->data._f_A.fulfill ){ /* Flow A */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_A.data_out = NULL;  /* input only */
+    if( (lvl) == (0) ) {
+    /* Flow A [1] dependency [0] from predecessor SORT */
+    if( NULL == (chunk = this_task->data._f_A.data_in) ) {
+    /* No data set up by predecessor on this task input flow */
+__parsec_merge_sort_SORT_parsec_assignment_t *target_locals = (__parsec_merge_sort_SORT_parsec_assignment_t*)&generic_locals;
+      const int SORTi = target_locals->i.value = i; (void)SORTi;
+      if( (reshape_entry != NULL) && (reshape_entry->data[1] != NULL) ){
+          /* Reshape promise set up on this task repo by predecessor */
+          consumed_repo = reshape_repo;
+          consumed_entry = reshape_entry;
+          consumed_entry_key = reshape_entry_key;
+          consumed_flow_index = 1;
+      }else{
+          /* Consume from predecessor's repo */
+          consumed_repo = SORT_repo;
+          consumed_entry_key = __jdf2c_make_key_SORT((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)target_locals) ;
+          consumed_entry = data_repo_lookup_entry( consumed_repo, consumed_entry_key );
+          consumed_flow_index = 0;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 1, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      ACQUIRE_FLOW(this_task, "A", &merge_sort_SORT, "A", target_locals, chunk);
+      this_task->data._f_A.data_out = chunk;
+    } 
+    else {
+      /* Data set up by predecessor on this task input flow */
+      consumed_repo = this_task->data._f_A.source_repo;
+      consumed_entry = this_task->data._f_A.source_repo_entry;
+      consumed_entry_key = this_task->data._f_A.source_repo_entry->ht_item.key;
+      if( (reshape_entry != NULL) && (reshape_entry->data[1] != NULL) ){
+          /* Reshape promise set up on input by predecessor is on this task repo */
+          consumed_flow_index = 1;
+          assert( (this_task->data._f_A.source_repo == reshape_repo)
+               && (this_task->data._f_A.source_repo_entry == reshape_entry));
+      }else{
+          /* Reshape promise set up on input by predecessor is the predecesssor task repo */
+          consumed_flow_index = 0;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 1, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      this_task->data._f_A.data_out = parsec_data_get_copy(chunk->original, target_device);
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+      parsec_prof_grapher_data_input(chunk->original, (parsec_task_t*)this_task, &flow_of_merge_sort_REDUCE_for_A, 0);
+#endif
+    }
+    }
+    else if( (lvl) > (0) ) {
+    /* Flow A [1] dependency [1] from predecessor REDUCE */
+    if( NULL == (chunk = this_task->data._f_A.data_in) ) {
+    /* No data set up by predecessor on this task input flow */
+__parsec_merge_sort_REDUCE_parsec_assignment_t *target_locals = (__parsec_merge_sort_REDUCE_parsec_assignment_t*)&generic_locals;
+      const int REDUCEh = target_locals->h.value = merge_sort_REDUCE_inline_c_expr7_line_230(__parsec_tp, target_locals); (void)REDUCEh;
+      const int REDUCElvl = target_locals->lvl.value = (lvl - 1); (void)REDUCElvl;
+      const int REDUCEwidth = target_locals->width.value = merge_sort_REDUCE_inline_c_expr6_line_232(__parsec_tp, target_locals); (void)REDUCEwidth;
+      const int REDUCEi = target_locals->i.value = (i * 2); (void)REDUCEi;
+      const int REDUCEprnt_width = target_locals->prnt_width.value = merge_sort_REDUCE_inline_c_expr5_line_235(__parsec_tp, target_locals); (void)REDUCEprnt_width;
+      const int REDUCEA_data_size = target_locals->A_data_size.value = merge_sort_REDUCE_inline_c_expr4_line_237(__parsec_tp, target_locals); (void)REDUCEA_data_size;
+      const int REDUCEB_data_size = target_locals->B_data_size.value = merge_sort_REDUCE_inline_c_expr3_line_239(__parsec_tp, target_locals); (void)REDUCEB_data_size;
+      const int REDUCEdata_size = target_locals->data_size.value = merge_sort_REDUCE_inline_c_expr2_line_241(__parsec_tp, target_locals); (void)REDUCEdata_size;
+      if( (reshape_entry != NULL) && (reshape_entry->data[1] != NULL) ){
+          /* Reshape promise set up on this task repo by predecessor */
+          consumed_repo = reshape_repo;
+          consumed_entry = reshape_entry;
+          consumed_entry_key = reshape_entry_key;
+          consumed_flow_index = 1;
+      }else{
+          /* Consume from predecessor's repo */
+          consumed_repo = REDUCE_repo;
+          consumed_entry_key = __jdf2c_make_key_REDUCE((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)target_locals) ;
+          consumed_entry = data_repo_lookup_entry( consumed_repo, consumed_entry_key );
+          consumed_flow_index = 0;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 1, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      ACQUIRE_FLOW(this_task, "A", &merge_sort_REDUCE, "C", target_locals, chunk);
+      this_task->data._f_A.data_out = chunk;
+    } 
+    else {
+      /* Data set up by predecessor on this task input flow */
+      consumed_repo = this_task->data._f_A.source_repo;
+      consumed_entry = this_task->data._f_A.source_repo_entry;
+      consumed_entry_key = this_task->data._f_A.source_repo_entry->ht_item.key;
+      if( (reshape_entry != NULL) && (reshape_entry->data[1] != NULL) ){
+          /* Reshape promise set up on input by predecessor is on this task repo */
+          consumed_flow_index = 1;
+          assert( (this_task->data._f_A.source_repo == reshape_repo)
+               && (this_task->data._f_A.source_repo_entry == reshape_entry));
+      }else{
+          /* Reshape promise set up on input by predecessor is the predecesssor task repo */
+          consumed_flow_index = 0;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 1, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      this_task->data._f_A.data_out = parsec_data_get_copy(chunk->original, target_device);
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+      parsec_prof_grapher_data_input(chunk->original, (parsec_task_t*)this_task, &flow_of_merge_sort_REDUCE_for_A, 0);
+#endif
+    }
+    }
+    this_task->data._f_A.data_in     = chunk;
+    this_task->data._f_A.source_repo       = consumed_repo;
+    this_task->data._f_A.source_repo_entry = consumed_entry;
+    if( this_task->data._f_A.source_repo_entry == this_task->repo_entry ){
+      /* in case we have consume from this task repo entry for the flow,
+       * it is cleaned up, avoiding having old stuff during release_deps_of
+       */
+      this_task->repo_entry->data[1] = NULL;
+    }
+    this_task->data._f_A.fulfill = 1;
+}
+
+
+if(! this_task->data._f_B.fulfill ){ /* Flow B */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_B.data_out = NULL;  /* input only */
+    if( (lvl) == (0) ) {
+    /* Flow B [2] dependency [2] from memory NEW or NULL data */
+    if( NULL == (chunk = this_task->data._f_B.data_in) ) {
+    /* No data set up by predecessor on this task input flow */
+    } 
+    }
+    else if( ((lvl) > (0) && ((prnt_width - 1)) <= ((i * 2))) ) {
+    /* Flow B [2] dependency [3] from memory NEW or NULL data */
+    if( NULL == (chunk = this_task->data._f_B.data_in) ) {
+    /* No data set up by predecessor on this task input flow */
+    } 
+    }
+    else if( ((lvl) > (0) && ((prnt_width - 1)) > ((i * 2))) ) {
+    /* Flow B [2] dependency [4] from predecessor REDUCE */
+    if( NULL == (chunk = this_task->data._f_B.data_in) ) {
+    /* No data set up by predecessor on this task input flow */
+__parsec_merge_sort_REDUCE_parsec_assignment_t *target_locals = (__parsec_merge_sort_REDUCE_parsec_assignment_t*)&generic_locals;
+      const int REDUCEh = target_locals->h.value = merge_sort_REDUCE_inline_c_expr7_line_230(__parsec_tp, target_locals); (void)REDUCEh;
+      const int REDUCElvl = target_locals->lvl.value = (lvl - 1); (void)REDUCElvl;
+      const int REDUCEwidth = target_locals->width.value = merge_sort_REDUCE_inline_c_expr6_line_232(__parsec_tp, target_locals); (void)REDUCEwidth;
+      const int REDUCEi = target_locals->i.value = ((i * 2) + 1); (void)REDUCEi;
+      const int REDUCEprnt_width = target_locals->prnt_width.value = merge_sort_REDUCE_inline_c_expr5_line_235(__parsec_tp, target_locals); (void)REDUCEprnt_width;
+      const int REDUCEA_data_size = target_locals->A_data_size.value = merge_sort_REDUCE_inline_c_expr4_line_237(__parsec_tp, target_locals); (void)REDUCEA_data_size;
+      const int REDUCEB_data_size = target_locals->B_data_size.value = merge_sort_REDUCE_inline_c_expr3_line_239(__parsec_tp, target_locals); (void)REDUCEB_data_size;
+      const int REDUCEdata_size = target_locals->data_size.value = merge_sort_REDUCE_inline_c_expr2_line_241(__parsec_tp, target_locals); (void)REDUCEdata_size;
+      if( (reshape_entry != NULL) && (reshape_entry->data[2] != NULL) ){
+          /* Reshape promise set up on this task repo by predecessor */
+          consumed_repo = reshape_repo;
+          consumed_entry = reshape_entry;
+          consumed_entry_key = reshape_entry_key;
+          consumed_flow_index = 2;
+      }else{
+          /* Consume from predecessor's repo */
+          consumed_repo = REDUCE_repo;
+          consumed_entry_key = __jdf2c_make_key_REDUCE((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)target_locals) ;
+          consumed_entry = data_repo_lookup_entry( consumed_repo, consumed_entry_key );
+          consumed_flow_index = 0;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 2, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      ACQUIRE_FLOW(this_task, "B", &merge_sort_REDUCE, "C", target_locals, chunk);
+      this_task->data._f_B.data_out = chunk;
+    } 
+    else {
+      /* Data set up by predecessor on this task input flow */
+      consumed_repo = this_task->data._f_B.source_repo;
+      consumed_entry = this_task->data._f_B.source_repo_entry;
+      consumed_entry_key = this_task->data._f_B.source_repo_entry->ht_item.key;
+      if( (reshape_entry != NULL) && (reshape_entry->data[2] != NULL) ){
+          /* Reshape promise set up on input by predecessor is on this task repo */
+          consumed_flow_index = 2;
+          assert( (this_task->data._f_B.source_repo == reshape_repo)
+               && (this_task->data._f_B.source_repo_entry == reshape_entry));
+      }else{
+          /* Reshape promise set up on input by predecessor is the predecesssor task repo */
+          consumed_flow_index = 0;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 2, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      this_task->data._f_B.data_out = parsec_data_get_copy(chunk->original, target_device);
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+      parsec_prof_grapher_data_input(chunk->original, (parsec_task_t*)this_task, &flow_of_merge_sort_REDUCE_for_B, 0);
+#endif
+    }
+    }
+    this_task->data._f_B.data_in     = chunk;
+    this_task->data._f_B.source_repo       = consumed_repo;
+    this_task->data._f_B.source_repo_entry = consumed_entry;
+    if( this_task->data._f_B.source_repo_entry == this_task->repo_entry ){
+      /* in case we have consume from this task repo entry for the flow,
+       * it is cleaned up, avoiding having old stuff during release_deps_of
+       */
+      this_task->repo_entry->data[2] = NULL;
+    }
+    this_task->data._f_B.fulfill = 1;
+}
+
+  /** Generate profiling information */
+#if defined(PARSEC_PROF_TRACE)
+  this_task->prof_info.desc = (parsec_data_collection_t*)__parsec_tp->super._g_dataA;
+  this_task->prof_info.priority = this_task->priority;
+  this_task->prof_info.data_id   = ((parsec_data_collection_t*)__parsec_tp->super._g_dataA)->data_key((parsec_data_collection_t*)__parsec_tp->super._g_dataA, i, 0);
+  this_task->prof_info.task_class_id = this_task->task_class->task_class_id;
+  this_task->prof_info.task_return_code = -1;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int datatype_lookup_of_merge_sort_REDUCE(parsec_execution_stream_t *es, const parsec_task_t *this_generic_task, const parsec_task_t *parent_task,
+              uint32_t* flow_mask, parsec_dep_data_description_t* data)
+{
+  const __parsec_merge_sort_REDUCE_task_t *this_task = (__parsec_merge_sort_REDUCE_task_t*)this_generic_task;
+  const __parsec_merge_sort_internal_taskpool_t *__parsec_tp = (__parsec_merge_sort_internal_taskpool_t *)this_task->taskpool;
+  (void)__parsec_tp; (void)es; (void)this_task; (void)data; (void)parent_task;
+  const int h = this_task->locals.h.value; (void)h;
+  const int lvl = this_task->locals.lvl.value; (void)lvl;
+  const int width = this_task->locals.width.value; (void)width;
+  const int i = this_task->locals.i.value; (void)i;
+  const int prnt_width = this_task->locals.prnt_width.value; (void)prnt_width;
+  const int A_data_size = this_task->locals.A_data_size.value; (void)A_data_size;
+  const int B_data_size = this_task->locals.B_data_size.value; (void)B_data_size;
+  const int data_size = this_task->locals.data_size.value; (void)data_size;
+  data->local.arena = data->remote.arena = NULL;
+  data->local.src_datatype  = data->local.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->local.src_count     = data->local.dst_count = 0;
+  data->local.src_displ     = data->local.dst_displ = 0;
+  data->data_future  = NULL;
+  if( (*flow_mask) & 0x80000000U ) { /* these are the input dependencies remote datatypes  */
+if( (*flow_mask) & 0x2U ) {  /* Flow A */
+    if( ((*flow_mask) & 0x2U)
+ && ((lvl) == (0)) ) {
+    data->remote.arena  =  PARSEC_merge_sort_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = MY_TYPE;
+    data->remote.dst_datatype = MY_TYPE;
+    data->remote.src_count  = NB;
+    data->remote.dst_count  = NB;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x2U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+    if( ((*flow_mask) & 0x2U)
+ && ((lvl) > (0)) ) {
+    data->remote.arena  =  PARSEC_merge_sort_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = MY_TYPE;
+    data->remote.dst_datatype = MY_TYPE;
+    data->remote.src_count  = A_data_size;
+    data->remote.dst_count  = A_data_size;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x2U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x2U) */
+if( (*flow_mask) & 0x4U ) {  /* Flow B */
+    if( ((*flow_mask) & 0x4U)
+ && ((lvl) == (0) || ((lvl) > (0) && ((prnt_width - 1)) <= ((i * 2)))) ) {
+    data->remote.arena  =  PARSEC_merge_sort_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_merge_sort_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_merge_sort_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x4U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+    if( ((*flow_mask) & 0x4U)
+ && (((lvl) > (0) && ((prnt_width - 1)) > ((i * 2)))) ) {
+    data->remote.arena  =  PARSEC_merge_sort_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = MY_TYPE;
+    data->remote.dst_datatype = MY_TYPE;
+    data->remote.src_count  = B_data_size;
+    data->remote.dst_count  = B_data_size;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x4U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x4U) */
+    goto no_mask_match;
+  }
+
+  /* these are the output dependencies remote datatypes */
+if( (*flow_mask) & 0x7U ) {  /* Flow C */
+    if( ((*flow_mask) & 0x7U)
+ && (((lvl) < (h) && (0) == ((i % 2))) || ((lvl) < (h) && (0) != ((i % 2))) || (lvl) == (h)) ) {
+    data->remote.arena  =  PARSEC_merge_sort_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = MY_TYPE;
+    data->remote.dst_datatype = MY_TYPE;
+    data->remote.src_count  = data_size;
+    data->remote.dst_count  = data_size;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x7U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x7U) */
+ no_mask_match:
+  data->data                             = NULL;
+  data->remote.src_datatype = data->remote.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->remote.src_count    = data->remote.dst_count = 0;
+  data->remote.src_displ    = data->remote.dst_displ = 0;
+  data->data_future  = NULL;
+  (*flow_mask) = 0;  /* nothing left */
+  (void)h;  (void)lvl;  (void)width;  (void)i;  (void)prnt_width;  (void)A_data_size;  (void)B_data_size;  (void)data_size;
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+static int hook_of_merge_sort_REDUCE(parsec_execution_stream_t *es, __parsec_merge_sort_REDUCE_task_t *this_task)
+{
+  __parsec_merge_sort_internal_taskpool_t *__parsec_tp = (__parsec_merge_sort_internal_taskpool_t *)this_task->taskpool;
+  (void)es; (void)__parsec_tp;
+  const int h = this_task->locals.h.value; (void)h;
+  const int lvl = this_task->locals.lvl.value; (void)lvl;
+  const int width = this_task->locals.width.value; (void)width;
+  const int i = this_task->locals.i.value; (void)i;
+  const int prnt_width = this_task->locals.prnt_width.value; (void)prnt_width;
+  const int A_data_size = this_task->locals.A_data_size.value; (void)A_data_size;
+  const int B_data_size = this_task->locals.B_data_size.value; (void)B_data_size;
+  const int data_size = this_task->locals.data_size.value; (void)data_size;
+  (void)h;  (void)lvl;  (void)width;  (void)i;  (void)prnt_width;  (void)A_data_size;  (void)B_data_size;  (void)data_size;
+
+  /** Declare the variables that will hold the data, and all the accounting for each */
+  parsec_data_copy_t *_f_C = this_task->data._f_C.data_in;
+  void *C = PARSEC_DATA_COPY_GET_PTR(_f_C); (void)C;
+  parsec_data_copy_t *_f_A = this_task->data._f_A.data_in;
+  void *A = PARSEC_DATA_COPY_GET_PTR(_f_A); (void)A;
+  parsec_data_copy_t *_f_B = this_task->data._f_B.data_in;
+  void *B = PARSEC_DATA_COPY_GET_PTR(_f_B); (void)B;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    data_repo_entry_t *eC = this_task->data._f_C.source_repo_entry;
+    if( (NULL != eC) && (eC->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eC->sim_exec_date;
+    data_repo_entry_t *eA = this_task->data._f_A.source_repo_entry;
+    if( (NULL != eA) && (eA->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eA->sim_exec_date;
+    data_repo_entry_t *eB = this_task->data._f_B.source_repo_entry;
+    if( (NULL != eB) && (eB->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eB->sim_exec_date;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+    if ( NULL != _f_C ) {
+#if defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) || defined(PARSEC_HAVE_DEV_HIP_SUPPORT)
+      parsec_data_transfer_ownership_to_copy( _f_C->original, 0 /* device */,
+                                           PARSEC_FLOW_ACCESS_WRITE);
+#endif  /* defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) || defined(PARSEC_HAVE_DEV_HIP_SUPPORT) */
+      _f_C->version++;  /* C */
+#if defined(PARSEC_DEBUG_NOISIER)
+      char tmp[128];
+      PARSEC_DEBUG_VERBOSE(10, parsec_debug_output,
+                           "Body of %s: change Data copy %p to version %d",
+                           parsec_task_snprintf(tmp, 128, (parsec_task_t*)(this_task)),
+                           _f_C, _f_C->version);
+#endif /* defined(PARSEC_DEBUG_NOISIER) */
+    }
+  /** Cache Awareness Accounting */
+#if defined(PARSEC_CACHE_AWARENESS)
+  cache_buf_referenced(es->closest_cache, C);
+  cache_buf_referenced(es->closest_cache, A);
+  cache_buf_referenced(es->closest_cache, B);
+#endif /* PARSEC_CACHE_AWARENESS */
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                                  REDUCE BODY                                  -----*/
+
+
+  int *Aptr, *Cptr;
+  Aptr = (int *)A;
+  Cptr = (int *)C;
+
+  // If there was no B
+  if( (lvl==0) || ((lvl>0) && (prnt_width-1<=i*2)) ){
+      assert(A_data_size == data_size);
+      memcpy(Cptr, Aptr, data_size*sizeof(int));
+  }else{
+      int jc,ja,jb;
+      int *Bptr;
+      Bptr = (int *)B;
+
+      ja=jb=0;
+      for(jc=0; jc<data_size; jc++){
+          if( (ja < A_data_size) && ((Aptr[ja] > Bptr[jb]) || (jb == B_data_size)) ){
+              Cptr[jc] = Aptr[ja];
+              ja++;
+          }else{
+              Cptr[jc] = Bptr[jb];
+              jb++;
+          }
+      }
+      assert( (ja==A_data_size) && (jb==B_data_size) && ((A_data_size+B_data_size) == data_size) );
+  }
+
+
+/*-----                              END OF REDUCE BODY                              -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#endif  /*  defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+static int complete_hook_of_merge_sort_REDUCE(parsec_execution_stream_t *es, __parsec_merge_sort_REDUCE_task_t *this_task)
+{
+  const __parsec_merge_sort_internal_taskpool_t *__parsec_tp = (__parsec_merge_sort_internal_taskpool_t *)this_task->taskpool;
+#if defined(DISTRIBUTED)
+    const int h = this_task->locals.h.value; (void)h;
+  const int lvl = this_task->locals.lvl.value; (void)lvl;
+  const int width = this_task->locals.width.value; (void)width;
+  const int i = this_task->locals.i.value; (void)i;
+  const int prnt_width = this_task->locals.prnt_width.value; (void)prnt_width;
+  const int A_data_size = this_task->locals.A_data_size.value; (void)A_data_size;
+  const int B_data_size = this_task->locals.B_data_size.value; (void)B_data_size;
+  const int data_size = this_task->locals.data_size.value; (void)data_size;
+#endif  /* defined(DISTRIBUTED) */
+  (void)es; (void)__parsec_tp;
+parsec_data_t* data_t_desc = NULL; (void)data_t_desc;
+#if defined(DISTRIBUTED)
+  /** If not working on distributed, there is no risk that data is not in place */
+  (void)h;  (void)lvl;  (void)width;  (void)i;  (void)prnt_width;  (void)A_data_size;  (void)B_data_size;  (void)data_size;
+
+#endif /* DISTRIBUTED */
+#if defined(PARSEC_PROF_GRAPHER)
+  parsec_prof_grapher_task((parsec_task_t*)this_task, es->th_id, es->virtual_process->vp_id,
+     __jdf2c_key_fns_REDUCE.key_hash(this_task->task_class->make_key( (parsec_taskpool_t*)this_task->taskpool, ((parsec_task_t*)this_task)->locals), NULL));
+#endif  /* defined(PARSEC_PROF_GRAPHER) */
+  release_deps_of_merge_sort_REDUCE(es, this_task,
+      PARSEC_ACTION_RELEASE_REMOTE_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_REFS |
+      PARSEC_ACTION_RESHAPE_ON_RELEASE |
+      0x7,  /* mask of all dep_index */ 
+      NULL);
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static parsec_hook_return_t release_task_of_merge_sort_REDUCE(parsec_execution_stream_t *es, parsec_task_t *this_task)
+{
+    const __parsec_merge_sort_internal_taskpool_t *__parsec_tp =
+        (const __parsec_merge_sort_internal_taskpool_t *)this_task->taskpool;
+    parsec_hash_table_t *ht = (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[2];
+    parsec_key_t key = this_task->task_class->make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals);
+    parsec_hashable_dependency_t *hash_dep = (parsec_hashable_dependency_t *)parsec_hash_table_remove(ht, key);
+    parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);
+    return parsec_release_task_to_mempool_update_nbtasks(es, this_task);
+}
+
+static char *merge_sort_merge_sort_REDUCE_internal_init_deps_key_functions_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_merge_sort_internal_taskpool_t *__parsec_tp = (__parsec_merge_sort_internal_taskpool_t *)user_data;
+  __parsec_merge_sort_REDUCE_parsec_assignment_t __jdf2c__assignments = {  .h.value = 0, .lvl.value = 0, .width.value = 0, .i.value = 0, .prnt_width.value = 0, .A_data_size.value = 0, .B_data_size.value = 0, .data_size.value = 0 };
+  int h = merge_sort_REDUCE_inline_c_expr7_line_230(__parsec_tp, &__jdf2c__assignments);
+  (void)h;
+  __jdf2c__assignments.h.value = h;
+  int lvl = (__parsec_key) % __parsec_tp->REDUCE_lvl_range + __parsec_tp->REDUCE_lvl_min;
+  __parsec_key = __parsec_key / __parsec_tp->REDUCE_lvl_range;
+  __jdf2c__assignments.lvl.value = lvl;
+  int width = merge_sort_REDUCE_inline_c_expr6_line_232(__parsec_tp, &__jdf2c__assignments);
+  (void)width;
+  __jdf2c__assignments.width.value = width;
+  int i = (__parsec_key) % __parsec_tp->REDUCE_i_range + __parsec_tp->REDUCE_i_min;
+  __parsec_key = __parsec_key / __parsec_tp->REDUCE_i_range;
+  __jdf2c__assignments.i.value = i;
+  int prnt_width = merge_sort_REDUCE_inline_c_expr5_line_235(__parsec_tp, &__jdf2c__assignments);
+  (void)prnt_width;
+  __jdf2c__assignments.prnt_width.value = prnt_width;
+  int A_data_size = merge_sort_REDUCE_inline_c_expr4_line_237(__parsec_tp, &__jdf2c__assignments);
+  (void)A_data_size;
+  __jdf2c__assignments.A_data_size.value = A_data_size;
+  int B_data_size = merge_sort_REDUCE_inline_c_expr3_line_239(__parsec_tp, &__jdf2c__assignments);
+  (void)B_data_size;
+  __jdf2c__assignments.B_data_size.value = B_data_size;
+  int data_size = merge_sort_REDUCE_inline_c_expr2_line_241(__parsec_tp, &__jdf2c__assignments);
+  (void)data_size;
+  __jdf2c__assignments.data_size.value = data_size;
+  (void)__jdf2c__assignments;
+  snprintf(buffer, buffer_size, "REDUCE(%d, %d)", lvl, i);
+  return buffer;
+}
+
+static parsec_key_fn_t merge_sort_merge_sort_REDUCE_internal_init_deps_key_functions = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = merge_sort_merge_sort_REDUCE_internal_init_deps_key_functions_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/* Needs: min-max count-tasks iterate */
+static int merge_sort_REDUCE_internal_init(parsec_execution_stream_t * es, __parsec_merge_sort_REDUCE_task_t * this_task)
+{
+  __parsec_merge_sort_internal_taskpool_t *__parsec_tp = (__parsec_merge_sort_internal_taskpool_t*)this_task->taskpool;
+  int32_t nb_tasks = 0, saved_nb_tasks = 0;
+int32_t __lvl_min = 0x7fffffff, __lvl_max = 0;int32_t __jdf2c_lvl_min = 0x7fffffff, __jdf2c_lvl_max = 0;int32_t __i_min = 0x7fffffff, __i_max = 0;int32_t __jdf2c_i_min = 0x7fffffff, __jdf2c_i_max = 0;  __parsec_merge_sort_REDUCE_parsec_assignment_t assignments = {  .h.value = 0, .lvl.value = 0, .width.value = 0, .i.value = 0, .prnt_width.value = 0, .A_data_size.value = 0, .B_data_size.value = 0, .data_size.value = 0 };
+  int32_t  h,  lvl,  width,  i,  prnt_width,  A_data_size,  B_data_size,  data_size;
+  int32_t __jdf2c_lvl_start, __jdf2c_lvl_end, __jdf2c_lvl_inc;
+  int32_t __jdf2c_i_start, __jdf2c_i_end, __jdf2c_i_inc;
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+  PARSEC_PROFILING_TRACE(es->es_profile,
+                         this_task->taskpool->profiling_array[START_KEY(this_task->task_class->task_class_id)],
+                         0,
+                         this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+{  /* block for the non-range variable h */
+    h = merge_sort_REDUCE_inline_c_expr7_line_230(__parsec_tp, &assignments);
+    assignments.h.value = h;
+      __jdf2c_lvl_start = 0;
+      __jdf2c_lvl_end = h;
+      __jdf2c_lvl_inc = 1;
+      __lvl_min = parsec_imin(__jdf2c_lvl_start, __jdf2c_lvl_end);
+      __lvl_max = parsec_imax(__jdf2c_lvl_start, __jdf2c_lvl_end);
+      __jdf2c_lvl_min = parsec_imin(__jdf2c_lvl_min, __lvl_min);
+      __jdf2c_lvl_max = parsec_imax(__jdf2c_lvl_max, __lvl_max);
+      for(lvl =  __jdf2c_lvl_start;
+          lvl <= __jdf2c_lvl_end;
+          lvl += __jdf2c_lvl_inc) {
+      assignments.lvl.value = lvl;
+    {  /* block for the non-range variable width */
+        width = merge_sort_REDUCE_inline_c_expr6_line_232(__parsec_tp, &assignments);
+        assignments.width.value = width;
+          __jdf2c_i_start = 0;
+          __jdf2c_i_end = (width - 1);
+          __jdf2c_i_inc = 1;
+          __i_min = parsec_imin(__jdf2c_i_start, __jdf2c_i_end);
+          __i_max = parsec_imax(__jdf2c_i_start, __jdf2c_i_end);
+          __jdf2c_i_min = parsec_imin(__jdf2c_i_min, __i_min);
+          __jdf2c_i_max = parsec_imax(__jdf2c_i_max, __i_max);
+          for(i =  __jdf2c_i_start;
+              i <= __jdf2c_i_end;
+              i += __jdf2c_i_inc) {
+          assignments.i.value = i;
+        {  /* block for the non-range variable prnt_width */
+            prnt_width = merge_sort_REDUCE_inline_c_expr5_line_235(__parsec_tp, &assignments);
+            assignments.prnt_width.value = prnt_width;
+          {  /* block for the non-range variable A_data_size */
+              A_data_size = merge_sort_REDUCE_inline_c_expr4_line_237(__parsec_tp, &assignments);
+              assignments.A_data_size.value = A_data_size;
+            {  /* block for the non-range variable B_data_size */
+                B_data_size = merge_sort_REDUCE_inline_c_expr3_line_239(__parsec_tp, &assignments);
+                assignments.B_data_size.value = B_data_size;
+              {  /* block for the non-range variable data_size */
+                  data_size = merge_sort_REDUCE_inline_c_expr2_line_241(__parsec_tp, &assignments);
+                  assignments.data_size.value = data_size;
+                  if( !REDUCE_pred(h, lvl, width, i, prnt_width, A_data_size, B_data_size, data_size) ) continue;
+                  nb_tasks++;
+                } /* block for the non-range variable data_size */ 
+              } /* block for the non-range variable B_data_size */ 
+            } /* block for the non-range variable A_data_size */ 
+          } /* block for the non-range variable prnt_width */ 
+        } /* Loop on normal range i */
+      } /* Non-range variable width */ 
+    } /* For loop of lvl */ 
+  } /* Non-range variable h */ 
+   if( 0 != nb_tasks ) {
+     (void)parsec_atomic_fetch_add_int32(&__parsec_tp->initial_number_tasks, nb_tasks);
+   }
+  /* Set the range variables for the collision-free hash-computation */
+  __parsec_tp->REDUCE_lvl_min   = __jdf2c_lvl_min;
+  __parsec_tp->REDUCE_lvl_range = (__jdf2c_lvl_max - __jdf2c_lvl_min) + 1;
+  __parsec_tp->REDUCE_i_min   = __jdf2c_i_min;
+  __parsec_tp->REDUCE_i_range = (__jdf2c_i_max - __jdf2c_i_min) + 1;
+  this_task->status = PARSEC_TASK_STATUS_COMPLETE;
+
+  PARSEC_AYU_REGISTER_TASK(&merge_sort_REDUCE);
+  __parsec_tp->super.super.dependencies_array[2] = PARSEC_OBJ_NEW(parsec_hash_table_t);
+  parsec_hash_table_init(__parsec_tp->super.super.dependencies_array[2], offsetof(parsec_hashable_dependency_t, ht_item), 10, merge_sort_merge_sort_REDUCE_internal_init_deps_key_functions, this_task->taskpool);
+  __parsec_tp->repositories[2] = data_repo_create_nothreadsafe(nb_tasks, __jdf2c_key_fns_REDUCE, (parsec_taskpool_t*)__parsec_tp, 3);
+(void)saved_nb_tasks;
+(void)__lvl_min; (void)__lvl_max;(void)__i_min; (void)__i_max;  (void)__jdf2c_lvl_start; (void)__jdf2c_lvl_end; (void)__jdf2c_lvl_inc;  (void)__jdf2c_i_start; (void)__jdf2c_i_end; (void)__jdf2c_i_inc;  (void)assignments; (void)__parsec_tp; (void)es;
+  if(1 == parsec_atomic_fetch_dec_int32(&__parsec_tp->sync_point)) {
+    /* Last initialization task complete. Update the number of tasks. */
+    __parsec_tp->super.super.tdm.module->taskpool_addto_nb_tasks(&__parsec_tp->super.super, __parsec_tp->initial_number_tasks);
+    parsec_mfence();  /* write memory barrier to guarantee that the scheduler gets the correct number of tasks */
+    parsec_taskpool_enable((parsec_taskpool_t*)__parsec_tp, &__parsec_tp->startup_queue,
+                           (parsec_task_t*)this_task, es, __parsec_tp->super.super.nb_pending_actions);
+    __parsec_tp->super.super.tdm.module->taskpool_ready(&__parsec_tp->super.super);
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+    PARSEC_PROFILING_TRACE(es->es_profile,
+                           this_task->taskpool->profiling_array[2 * this_task->task_class->task_class_id + 1],
+                           0,
+                           this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    return PARSEC_HOOK_RETURN_DONE;
+  }
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static const __parsec_chore_t __merge_sort_REDUCE_chores[] ={
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+    { .type     = PARSEC_DEV_CPU,
+      .evaluate = (parsec_evaluate_function_t*)NULL,
+      .hook     = (parsec_hook_t*)hook_of_merge_sort_REDUCE },
+#endif  /* defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+    { .type     = PARSEC_DEV_NONE,
+      .evaluate = NULL,
+      .hook     = (parsec_hook_t*)NULL },  /* End marker */
+};
+
+static const parsec_task_class_t merge_sort_REDUCE = {
+  .name = "REDUCE",
+  .task_class_id = 2,
+  .nb_flows = 3,
+  .nb_parameters = 2,
+  .nb_locals = 8,
+  .task_class_type = PARSEC_TASK_CLASS_TYPE_PTG,
+  .params = { &symb_merge_sort_REDUCE_lvl, &symb_merge_sort_REDUCE_i, NULL },
+  .locals = { &symb_merge_sort_REDUCE_h, &symb_merge_sort_REDUCE_lvl, &symb_merge_sort_REDUCE_width, &symb_merge_sort_REDUCE_i, &symb_merge_sort_REDUCE_prnt_width, &symb_merge_sort_REDUCE_A_data_size, &symb_merge_sort_REDUCE_B_data_size, &symb_merge_sort_REDUCE_data_size, NULL },
+  .data_affinity = (parsec_data_ref_fn_t*)affinity_of_merge_sort_REDUCE,
+  .initial_data = (parsec_data_ref_fn_t*)affinity_of_merge_sort_REDUCE,
+  .final_data = (parsec_data_ref_fn_t*)affinity_of_merge_sort_REDUCE,
+  .priority = NULL,
+  .properties = properties_of_merge_sort_REDUCE,
+#if MAX_PARAM_COUNT < 2  /* number of read flows of REDUCE */
+  #error Too many read flows for task REDUCE
+#endif  /* MAX_PARAM_COUNT */
+#if MAX_PARAM_COUNT < 1  /* number of write flows of REDUCE */
+  #error Too many write flows for task REDUCE
+#endif  /* MAX_PARAM_COUNT */
+  .in = { &flow_of_merge_sort_REDUCE_for_A, &flow_of_merge_sort_REDUCE_for_B, NULL },
+  .out = { &flow_of_merge_sort_REDUCE_for_C, NULL },
+  .flags = 0x0 | PARSEC_HAS_IN_IN_DEPENDENCIES | PARSEC_USE_DEPS_MASK,
+  .dependencies_goal = 0x6,
+  .make_key = __jdf2c_make_key_REDUCE,
+  .task_snprintf = parsec_task_snprintf,
+#if defined(PARSEC_PROF_TRACE)
+  .profile_info = &parsec_task_profile_info,
+#endif
+  .key_functions = &__jdf2c_key_fns_REDUCE,
+  .fini = (parsec_hook_t*)NULL,
+  .incarnations = __merge_sort_REDUCE_chores,
+  .find_deps = parsec_hash_find_deps,
+  .update_deps = parsec_update_deps_with_mask,
+  .iterate_successors = (parsec_traverse_function_t*)iterate_successors_of_merge_sort_REDUCE,
+  .iterate_predecessors = (parsec_traverse_function_t*)iterate_predecessors_of_merge_sort_REDUCE,
+  .release_deps = (parsec_release_deps_t*)release_deps_of_merge_sort_REDUCE,
+  .prepare_output = (parsec_hook_t*)NULL,
+  .prepare_input = (parsec_hook_t*)data_lookup_of_merge_sort_REDUCE,
+  .time_estimate = NULL,
+  .get_datatype = datatype_lookup_of_merge_sort_REDUCE,
+  .complete_execution = (parsec_hook_t*)complete_hook_of_merge_sort_REDUCE,
+  .release_task = &release_task_of_merge_sort_REDUCE,
+#if defined(PARSEC_SIM)
+  .sim_cost_fct = (parsec_sim_cost_fct_t*)NULL,
+#endif
+};
+
+
+/******                                      SORT                                      ******/
+
+static inline int32_t minexpr_of_symb_merge_sort_SORT_i_fct(const __parsec_merge_sort_internal_taskpool_t *__parsec_tp, const __parsec_merge_sort_SORT_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_merge_sort_SORT_i = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_merge_sort_SORT_i_fct }
+                   }
+};
+static inline int maxexpr_of_symb_merge_sort_SORT_i_fct(const __parsec_merge_sort_internal_taskpool_t *__parsec_tp, const __parsec_merge_sort_SORT_parsec_assignment_t *locals)
+{
+  const int i = locals->i.value; (void)i;
+
+  (void)i;
+  (void)__parsec_tp; (void)locals;
+  return (NT - 1);
+}
+static const parsec_expr_t maxexpr_of_symb_merge_sort_SORT_i = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_merge_sort_SORT_i_fct }
+                   }
+};
+static const parsec_symbol_t symb_merge_sort_SORT_i = { .name = "i", .context_index = 0, .min = &minexpr_of_symb_merge_sort_SORT_i, .max = &maxexpr_of_symb_merge_sort_SORT_i, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int affinity_of_merge_sort_SORT(const __parsec_merge_sort_SORT_task_t *this_task,
+                     parsec_data_ref_t *ref)
+{
+    const __parsec_merge_sort_internal_taskpool_t *__parsec_tp = (const __parsec_merge_sort_internal_taskpool_t*)this_task->taskpool;
+  const int i = this_task->locals.i.value; (void)i;
+
+  /* Silent Warnings: should look into predicate to know what variables are usefull */
+  (void)i;
+  ref->dc = (parsec_data_collection_t *)__parsec_tp->super._g_dataA;
+  /* Compute data key */
+  ref->key = ref->dc->data_key(ref->dc, i, 0);
+  return 1;
+}
+static const parsec_property_t properties_of_merge_sort_SORT[1] = {
+  {.name = NULL, .expr = NULL}
+};
+static const parsec_dep_t flow_of_merge_sort_SORT_for_A_dep1_atline_212 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 0, /* merge_sort_INIT_DATA */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_merge_sort_INIT_DATA_for_A,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_merge_sort_SORT_for_A,
+};
+static const parsec_dep_t flow_of_merge_sort_SORT_for_A_dep2_atline_213 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 2, /* merge_sort_REDUCE */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_merge_sort_REDUCE_for_A,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_merge_sort_SORT_for_A,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+#if MAX_DEP_OUT_COUNT < 1  /* number of output dependencies */
+    #error Too many output dependencies (supports up to MAX_DEP_OUT_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_OUT_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_merge_sort_SORT_for_A = {
+  .name               = "A",
+  .sym_type           = PARSEC_SYM_INOUT,
+  .flow_flags         = PARSEC_FLOW_ACCESS_RW,
+  .flow_index         = 0,
+  .flow_datatype_mask = 0x1,
+  .dep_in     = { &flow_of_merge_sort_SORT_for_A_dep1_atline_212 },
+  .dep_out    = { &flow_of_merge_sort_SORT_for_A_dep2_atline_213 }
+};
+
+static void
+iterate_successors_of_merge_sort_SORT(parsec_execution_stream_t *es, const __parsec_merge_sort_SORT_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_merge_sort_internal_taskpool_t *__parsec_tp = (const __parsec_merge_sort_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_merge_sort_SORT_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_merge_sort_SORT_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int i = __jdf2c__tmp_locals.i.value; (void)i;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)i;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_dataA(i, 0);
+#endif
+  if( action_mask & 0x1 ) {  /* Flow of data A [0] */
+    data.data   = this_task->data._f_A.data_out;
+    data.data_future  = NULL;
+    if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_merge_sort_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_merge_sort_DEFAULT_ADT->arena;
+    data.remote.src_datatype = MY_TYPE;
+    data.remote.dst_datatype = MY_TYPE;
+    data.remote.src_count  = NB;
+    data.remote.dst_count  = NB;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+       __parsec_merge_sort_REDUCE_task_t* ncc = (__parsec_merge_sort_REDUCE_task_t*)&nc;
+    nc.task_class = __parsec_tp->super.super.task_classes_array[merge_sort_REDUCE.task_class_id];
+      const int REDUCE_h = merge_sort_REDUCE_inline_c_expr7_line_230(__parsec_tp, &ncc->locals);
+      assert(&nc.locals[0].value == &ncc->locals.h.value);
+      ncc->locals.h.value = REDUCE_h;
+      const int REDUCE_lvl = 0;
+      if( (REDUCE_lvl >= (0)) && (REDUCE_lvl <= (ncc->locals.h.value)) ) {
+        assert(&nc.locals[1].value == &ncc->locals.lvl.value);
+        ncc->locals.lvl.value = REDUCE_lvl;
+        const int REDUCE_width = merge_sort_REDUCE_inline_c_expr6_line_232(__parsec_tp, &ncc->locals);
+        assert(&nc.locals[2].value == &ncc->locals.width.value);
+        ncc->locals.width.value = REDUCE_width;
+        const int REDUCE_i = i;
+        if( (REDUCE_i >= (0)) && (REDUCE_i <= ((ncc->locals.width.value - 1))) ) {
+          assert(&nc.locals[3].value == &ncc->locals.i.value);
+          ncc->locals.i.value = REDUCE_i;
+          const int REDUCE_prnt_width = merge_sort_REDUCE_inline_c_expr5_line_235(__parsec_tp, &ncc->locals);
+          assert(&nc.locals[4].value == &ncc->locals.prnt_width.value);
+          ncc->locals.prnt_width.value = REDUCE_prnt_width;
+          const int REDUCE_A_data_size = merge_sort_REDUCE_inline_c_expr4_line_237(__parsec_tp, &ncc->locals);
+          assert(&nc.locals[5].value == &ncc->locals.A_data_size.value);
+          ncc->locals.A_data_size.value = REDUCE_A_data_size;
+          const int REDUCE_B_data_size = merge_sort_REDUCE_inline_c_expr3_line_239(__parsec_tp, &ncc->locals);
+          assert(&nc.locals[6].value == &ncc->locals.B_data_size.value);
+          ncc->locals.B_data_size.value = REDUCE_B_data_size;
+          const int REDUCE_data_size = merge_sort_REDUCE_inline_c_expr2_line_241(__parsec_tp, &ncc->locals);
+          assert(&nc.locals[7].value == &ncc->locals.data_size.value);
+          ncc->locals.data_size.value = REDUCE_data_size;
+#if defined(DISTRIBUTED)
+          rank_dst = rank_of_dataA(ncc->locals.i.value, 0);
+          if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+            vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_dataA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_dataA, ncc->locals.i.value, 0);
+          nc.priority = __parsec_tp->super.super.priority;
+          successor_repo = REDUCE_repo;
+          successor_repo_key = __jdf2c_make_key_REDUCE((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+        RELEASE_DEP_OUTPUT(es, "A", this_task, "A", &nc, rank_src, rank_dst, &data);
+        if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_merge_sort_SORT_for_A_dep2_atline_213, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+          }
+        }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static void
+iterate_predecessors_of_merge_sort_SORT(parsec_execution_stream_t *es, const __parsec_merge_sort_SORT_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_merge_sort_internal_taskpool_t *__parsec_tp = (const __parsec_merge_sort_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_merge_sort_SORT_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_merge_sort_SORT_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int i = __jdf2c__tmp_locals.i.value; (void)i;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)i;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_dataA(i, 0);
+#endif
+  if( action_mask & 0x1 ) {  /* Flow of data A [0] */
+    data.data   = this_task->data._f_A.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x1 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_merge_sort_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_merge_sort_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        __parsec_merge_sort_INIT_DATA_task_t* ncc = (__parsec_merge_sort_INIT_DATA_task_t*)&nc;
+    nc.task_class = __parsec_tp->super.super.task_classes_array[merge_sort_INIT_DATA.task_class_id];
+      const int INIT_DATA_i = i;
+      if( (INIT_DATA_i >= (0)) && (INIT_DATA_i <= ((NT - 1))) ) {
+        assert(&nc.locals[0].value == &ncc->locals.i.value);
+        ncc->locals.i.value = INIT_DATA_i;
+#if defined(DISTRIBUTED)
+        rank_dst = rank_of_dataA(ncc->locals.i.value, 0);
+        if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+          vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_dataA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_dataA, ncc->locals.i.value, 0);
+        nc.priority = __parsec_tp->super.super.priority;
+        successor_repo = NULL;
+        successor_repo_key = 0;
+      RELEASE_DEP_OUTPUT(es, "A", this_task, "A", &nc, rank_src, rank_dst, &data);
+      if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_merge_sort_SORT_for_A_dep1_atline_212, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+        }
+  }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static int release_deps_of_merge_sort_SORT(parsec_execution_stream_t *es, __parsec_merge_sort_SORT_task_t *this_task, uint32_t action_mask, parsec_remote_deps_t *deps)
+{
+  PARSEC_PINS(es, RELEASE_DEPS_BEGIN, (parsec_task_t *)this_task);  const __parsec_merge_sort_internal_taskpool_t *__parsec_tp = (const __parsec_merge_sort_internal_taskpool_t *)this_task->taskpool;
+  parsec_release_dep_fct_arg_t arg;
+  int __vp_id;
+  int consume_local_repo = 0;
+  arg.action_mask = action_mask;
+  arg.output_entry = NULL;
+  arg.output_repo = NULL;
+#if defined(DISTRIBUTED)
+  arg.remote_deps = deps;
+#endif  /* defined(DISTRIBUTED) */
+  assert(NULL != es);
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS )    arg.ready_lists = alloca(sizeof(parsec_task_t *) * es->virtual_process->parsec_context->nb_vp);
+  else
+    arg.ready_lists = NULL;
+  for( __vp_id = 0; __vp_id < es->virtual_process->parsec_context->nb_vp; arg.ready_lists[__vp_id++] = NULL );
+  (void)__parsec_tp; (void)deps;
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_A.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_A.source_repo, this_task->data._f_A.source_repo_entry->ht_item.key );
+    }
+  }
+  consume_local_repo = (this_task->repo_entry != NULL);
+  arg.output_repo = SORT_repo;
+  arg.output_entry = this_task->repo_entry;
+  arg.output_usage = 0;
+  if( action_mask & (PARSEC_ACTION_RELEASE_LOCAL_DEPS | PARSEC_ACTION_GET_REPO_ENTRY) ) {
+    arg.output_entry = data_repo_lookup_entry_and_create( es, arg.output_repo, __jdf2c_make_key_SORT((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    arg.output_entry->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(arg.output_entry->sim_exec_date == 0);
+    arg.output_entry->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  if(action_mask & ( PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE ) ){
+    /* Generate the reshape promise for the outputs that need it */
+    iterate_successors_of_merge_sort_SORT(es, this_task, action_mask, parsec_set_up_reshape_promise, &arg);
+   }
+  iterate_successors_of_merge_sort_SORT(es, this_task, action_mask, parsec_release_dep_fct, &arg);
+
+#if defined(DISTRIBUTED)
+  if( (action_mask & PARSEC_ACTION_SEND_REMOTE_DEPS) && (NULL != arg.remote_deps)) {
+    parsec_remote_dep_activate(es, (parsec_task_t *)this_task, arg.remote_deps, arg.remote_deps->outgoing_mask);
+  }
+#endif
+
+  if(action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS) {
+    data_repo_entry_addto_usage_limit(SORT_repo, arg.output_entry->ht_item.key, arg.output_usage);
+    __parsec_schedule_vp(es, arg.ready_lists, 0);
+  }
+      if (consume_local_repo) {
+         data_repo_entry_used_once( SORT_repo, this_task->repo_entry->ht_item.key );
+      }
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_A.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_A.data_in);
+    }
+  }
+  PARSEC_PINS(es, RELEASE_DEPS_END, (parsec_task_t *)this_task);  return 0;
+}
+
+static int data_lookup_of_merge_sort_SORT(parsec_execution_stream_t *es, __parsec_merge_sort_SORT_task_t *this_task)
+{
+  const __parsec_merge_sort_internal_taskpool_t *__parsec_tp = (__parsec_merge_sort_internal_taskpool_t *)this_task->taskpool;
+  parsec_assignment_t generic_locals[MAX_PARAM_COUNT];  /* generic task locals */
+  int target_device = 0; (void)target_device;
+  (void)__parsec_tp; (void)generic_locals; (void)es;
+  parsec_data_copy_t *chunk = NULL;
+  data_repo_t        *reshape_repo  = NULL, *consumed_repo  = NULL;
+  data_repo_entry_t  *reshape_entry = NULL, *consumed_entry = NULL;
+  parsec_key_t        reshape_entry_key = 0, consumed_entry_key = 0;
+  uint8_t             consumed_flow_index;
+  parsec_dep_data_description_t data;
+  int ret;
+  (void)reshape_repo; (void)reshape_entry; (void)reshape_entry_key;
+  (void)consumed_repo; (void)consumed_entry; (void)consumed_entry_key;
+  (void)consumed_flow_index;
+  (void)chunk; (void)data; (void)ret;
+  const int i = this_task->locals.i.value; (void)i;
+  if( NULL == this_task->repo_entry ){
+    this_task->repo_entry = data_repo_lookup_entry_and_create(es, SORT_repo,                                       __jdf2c_make_key_SORT((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    data_repo_entry_addto_usage_limit(SORT_repo, this_task->repo_entry->ht_item.key, 1);    this_task->repo_entry ->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(this_task->repo_entry ->sim_exec_date == 0);
+    this_task->repo_entry ->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  /* The reshape repo is the current task repo. */  reshape_repo = SORT_repo;
+  reshape_entry_key = __jdf2c_make_key_SORT((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals) ;
+  reshape_entry = this_task->repo_entry;
+  /* Lookup the input data, and store them in the context if any */
+
+if(! this_task->data._f_A.fulfill ){ /* Flow A */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_A.data_out = NULL;  /* By default, if nothing matches */
+  /* Flow A [0] dependency [0] from predecessor INIT_DATA */
+  if( NULL == (chunk = this_task->data._f_A.data_in) ) {
+  /* No data set up by predecessor on this task input flow */
+__parsec_merge_sort_INIT_DATA_parsec_assignment_t *target_locals = (__parsec_merge_sort_INIT_DATA_parsec_assignment_t*)&generic_locals;
+  const int INIT_DATAi = target_locals->i.value = i; (void)INIT_DATAi;
+    if( (reshape_entry != NULL) && (reshape_entry->data[0] != NULL) ){
+        /* Reshape promise set up on this task repo by predecessor */
+        consumed_repo = reshape_repo;
+        consumed_entry = reshape_entry;
+        consumed_entry_key = reshape_entry_key;
+        consumed_flow_index = 0;
+    }else{
+        /* Consume from predecessor's repo */
+        consumed_repo = INIT_DATA_repo;
+        consumed_entry_key = __jdf2c_make_key_INIT_DATA((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)target_locals) ;
+        consumed_entry = data_repo_lookup_entry( consumed_repo, consumed_entry_key );
+        consumed_flow_index = 0;
+    }
+    data.data   = NULL;
+    data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+        data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    ACQUIRE_FLOW(this_task, "A", &merge_sort_INIT_DATA, "A", target_locals, chunk);
+    this_task->data._f_A.data_out = chunk;
+  } 
+  else {
+    /* Data set up by predecessor on this task input flow */
+    consumed_repo = this_task->data._f_A.source_repo;
+    consumed_entry = this_task->data._f_A.source_repo_entry;
+    consumed_entry_key = this_task->data._f_A.source_repo_entry->ht_item.key;
+    if( (reshape_entry != NULL) && (reshape_entry->data[0] != NULL) ){
+        /* Reshape promise set up on input by predecessor is on this task repo */
+        consumed_flow_index = 0;
+        assert( (this_task->data._f_A.source_repo == reshape_repo)
+             && (this_task->data._f_A.source_repo_entry == reshape_entry));
+    }else{
+        /* Reshape promise set up on input by predecessor is the predecesssor task repo */
+        consumed_flow_index = 0;
+    }
+    data.data   = NULL;
+    data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+        data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    this_task->data._f_A.data_out = parsec_data_get_copy(chunk->original, target_device);
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+    parsec_prof_grapher_data_input(chunk->original, (parsec_task_t*)this_task, &flow_of_merge_sort_SORT_for_A, 0);
+#endif
+  }
+    this_task->data._f_A.data_in     = chunk;
+    this_task->data._f_A.source_repo       = consumed_repo;
+    this_task->data._f_A.source_repo_entry = consumed_entry;
+    if( this_task->data._f_A.source_repo_entry == this_task->repo_entry ){
+      /* in case we have consume from this task repo entry for the flow,
+       * it is cleaned up, avoiding having old stuff during release_deps_of
+       */
+      this_task->repo_entry->data[0] = NULL;
+    }
+    this_task->data._f_A.fulfill = 1;
+}
+
+  /** Generate profiling information */
+#if defined(PARSEC_PROF_TRACE)
+  this_task->prof_info.desc = (parsec_data_collection_t*)__parsec_tp->super._g_dataA;
+  this_task->prof_info.priority = this_task->priority;
+  this_task->prof_info.data_id   = ((parsec_data_collection_t*)__parsec_tp->super._g_dataA)->data_key((parsec_data_collection_t*)__parsec_tp->super._g_dataA, i, 0);
+  this_task->prof_info.task_class_id = this_task->task_class->task_class_id;
+  this_task->prof_info.task_return_code = -1;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int datatype_lookup_of_merge_sort_SORT(parsec_execution_stream_t *es, const parsec_task_t *this_generic_task, const parsec_task_t *parent_task,
+              uint32_t* flow_mask, parsec_dep_data_description_t* data)
+{
+  const __parsec_merge_sort_SORT_task_t *this_task = (__parsec_merge_sort_SORT_task_t*)this_generic_task;
+  const __parsec_merge_sort_internal_taskpool_t *__parsec_tp = (__parsec_merge_sort_internal_taskpool_t *)this_task->taskpool;
+  (void)__parsec_tp; (void)es; (void)this_task; (void)data; (void)parent_task;
+  const int i = this_task->locals.i.value; (void)i;
+  data->local.arena = data->remote.arena = NULL;
+  data->local.src_datatype  = data->local.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->local.src_count     = data->local.dst_count = 0;
+  data->local.src_displ     = data->local.dst_displ = 0;
+  data->data_future  = NULL;
+  if( (*flow_mask) & 0x80000000U ) { /* these are the input dependencies remote datatypes  */
+if( (*flow_mask) & 0x1U ) {  /* Flow A */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_merge_sort_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_merge_sort_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_merge_sort_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+    goto no_mask_match;
+  }
+
+  /* these are the output dependencies remote datatypes */
+if( (*flow_mask) & 0x1U ) {  /* Flow A */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_merge_sort_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = MY_TYPE;
+    data->remote.dst_datatype = MY_TYPE;
+    data->remote.src_count  = NB;
+    data->remote.dst_count  = NB;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+ no_mask_match:
+  data->data                             = NULL;
+  data->remote.src_datatype = data->remote.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->remote.src_count    = data->remote.dst_count = 0;
+  data->remote.src_displ    = data->remote.dst_displ = 0;
+  data->data_future  = NULL;
+  (*flow_mask) = 0;  /* nothing left */
+  (void)i;
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+static int hook_of_merge_sort_SORT(parsec_execution_stream_t *es, __parsec_merge_sort_SORT_task_t *this_task)
+{
+  __parsec_merge_sort_internal_taskpool_t *__parsec_tp = (__parsec_merge_sort_internal_taskpool_t *)this_task->taskpool;
+  (void)es; (void)__parsec_tp;
+  const int i = this_task->locals.i.value; (void)i;
+  (void)i;
+
+  /** Declare the variables that will hold the data, and all the accounting for each */
+  parsec_data_copy_t *_f_A = this_task->data._f_A.data_in;
+  void *A = PARSEC_DATA_COPY_GET_PTR(_f_A); (void)A;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    data_repo_entry_t *eA = this_task->data._f_A.source_repo_entry;
+    if( (NULL != eA) && (eA->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eA->sim_exec_date;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+    if ( NULL != _f_A ) {
+#if defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) || defined(PARSEC_HAVE_DEV_HIP_SUPPORT)
+      parsec_data_transfer_ownership_to_copy( _f_A->original, 0 /* device */,
+                                           PARSEC_FLOW_ACCESS_RW);
+#endif  /* defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) || defined(PARSEC_HAVE_DEV_HIP_SUPPORT) */
+      _f_A->version++;  /* A */
+#if defined(PARSEC_DEBUG_NOISIER)
+      char tmp[128];
+      PARSEC_DEBUG_VERBOSE(10, parsec_debug_output,
+                           "Body of %s: change Data copy %p to version %d",
+                           parsec_task_snprintf(tmp, 128, (parsec_task_t*)(this_task)),
+                           _f_A, _f_A->version);
+#endif /* defined(PARSEC_DEBUG_NOISIER) */
+    }
+  /** Cache Awareness Accounting */
+#if defined(PARSEC_CACHE_AWARENESS)
+  cache_buf_referenced(es->closest_cache, A);
+#endif /* PARSEC_CACHE_AWARENESS */
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                                  SORT BODY                                    -----*/
+
+   int type;
+
+   type = sort_5((int *)A);
+   assert( type >= 0 ); (void)type;
+
+
+/*-----                                END OF SORT BODY                                -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#endif  /*  defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+static int complete_hook_of_merge_sort_SORT(parsec_execution_stream_t *es, __parsec_merge_sort_SORT_task_t *this_task)
+{
+  const __parsec_merge_sort_internal_taskpool_t *__parsec_tp = (__parsec_merge_sort_internal_taskpool_t *)this_task->taskpool;
+#if defined(DISTRIBUTED)
+    const int i = this_task->locals.i.value; (void)i;
+#endif  /* defined(DISTRIBUTED) */
+  (void)es; (void)__parsec_tp;
+parsec_data_t* data_t_desc = NULL; (void)data_t_desc;
+#if defined(DISTRIBUTED)
+  /** If not working on distributed, there is no risk that data is not in place */
+  (void)i;
+
+#endif /* DISTRIBUTED */
+#if defined(PARSEC_PROF_GRAPHER)
+  parsec_prof_grapher_task((parsec_task_t*)this_task, es->th_id, es->virtual_process->vp_id,
+     __jdf2c_key_fns_SORT.key_hash(this_task->task_class->make_key( (parsec_taskpool_t*)this_task->taskpool, ((parsec_task_t*)this_task)->locals), NULL));
+#endif  /* defined(PARSEC_PROF_GRAPHER) */
+  release_deps_of_merge_sort_SORT(es, this_task,
+      PARSEC_ACTION_RELEASE_REMOTE_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_REFS |
+      PARSEC_ACTION_RESHAPE_ON_RELEASE |
+      0x1,  /* mask of all dep_index */ 
+      NULL);
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static parsec_hook_return_t release_task_of_merge_sort_SORT(parsec_execution_stream_t *es, parsec_task_t *this_task)
+{
+    const __parsec_merge_sort_internal_taskpool_t *__parsec_tp =
+        (const __parsec_merge_sort_internal_taskpool_t *)this_task->taskpool;
+    parsec_hash_table_t *ht = (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[1];
+    parsec_key_t key = this_task->task_class->make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals);
+    parsec_hashable_dependency_t *hash_dep = (parsec_hashable_dependency_t *)parsec_hash_table_remove(ht, key);
+    parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);
+    return parsec_release_task_to_mempool_update_nbtasks(es, this_task);
+}
+
+static char *merge_sort_merge_sort_SORT_internal_init_deps_key_functions_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_merge_sort_internal_taskpool_t *__parsec_tp = (__parsec_merge_sort_internal_taskpool_t *)user_data;
+  int i = (__parsec_key) % __parsec_tp->SORT_i_range + __parsec_tp->SORT_i_min;
+  __parsec_key = __parsec_key / __parsec_tp->SORT_i_range;
+  snprintf(buffer, buffer_size, "SORT(%d)", i);
+  return buffer;
+}
+
+static parsec_key_fn_t merge_sort_merge_sort_SORT_internal_init_deps_key_functions = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = merge_sort_merge_sort_SORT_internal_init_deps_key_functions_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/* Needs: min-max count-tasks iterate */
+static int merge_sort_SORT_internal_init(parsec_execution_stream_t * es, __parsec_merge_sort_SORT_task_t * this_task)
+{
+  __parsec_merge_sort_internal_taskpool_t *__parsec_tp = (__parsec_merge_sort_internal_taskpool_t*)this_task->taskpool;
+  int32_t nb_tasks = 0, saved_nb_tasks = 0;
+int32_t __i_min = 0x7fffffff, __i_max = 0;int32_t __jdf2c_i_min = 0x7fffffff, __jdf2c_i_max = 0;  __parsec_merge_sort_SORT_parsec_assignment_t assignments = {  .i.value = 0 };
+  int32_t  i;
+  int32_t __jdf2c_i_start, __jdf2c_i_end, __jdf2c_i_inc;
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+  PARSEC_PROFILING_TRACE(es->es_profile,
+                         this_task->taskpool->profiling_array[START_KEY(this_task->task_class->task_class_id)],
+                         0,
+                         this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    __jdf2c_i_start = 0;
+    __jdf2c_i_end = (NT - 1);
+    __jdf2c_i_inc = 1;
+    __i_min = parsec_imin(__jdf2c_i_start, __jdf2c_i_end);
+    __i_max = parsec_imax(__jdf2c_i_start, __jdf2c_i_end);
+    __jdf2c_i_min = parsec_imin(__jdf2c_i_min, __i_min);
+    __jdf2c_i_max = parsec_imax(__jdf2c_i_max, __i_max);
+    for(i =  __jdf2c_i_start;
+        i <= __jdf2c_i_end;
+        i += __jdf2c_i_inc) {
+    assignments.i.value = i;
+    if( !SORT_pred(i) ) continue;
+    nb_tasks++;
+  } /* Loop on normal range i */
+   if( 0 != nb_tasks ) {
+     (void)parsec_atomic_fetch_add_int32(&__parsec_tp->initial_number_tasks, nb_tasks);
+   }
+  /* Set the range variables for the collision-free hash-computation */
+  __parsec_tp->SORT_i_min   = __jdf2c_i_min;
+  __parsec_tp->SORT_i_range = (__jdf2c_i_max - __jdf2c_i_min) + 1;
+  this_task->status = PARSEC_TASK_STATUS_COMPLETE;
+
+  PARSEC_AYU_REGISTER_TASK(&merge_sort_SORT);
+  __parsec_tp->super.super.dependencies_array[1] = PARSEC_OBJ_NEW(parsec_hash_table_t);
+  parsec_hash_table_init(__parsec_tp->super.super.dependencies_array[1], offsetof(parsec_hashable_dependency_t, ht_item), 10, merge_sort_merge_sort_SORT_internal_init_deps_key_functions, this_task->taskpool);
+  __parsec_tp->repositories[1] = data_repo_create_nothreadsafe(nb_tasks, __jdf2c_key_fns_SORT, (parsec_taskpool_t*)__parsec_tp, 1);
+(void)saved_nb_tasks;
+(void)__i_min; (void)__i_max;  (void)__jdf2c_i_start; (void)__jdf2c_i_end; (void)__jdf2c_i_inc;  (void)assignments; (void)__parsec_tp; (void)es;
+  if(1 == parsec_atomic_fetch_dec_int32(&__parsec_tp->sync_point)) {
+    /* Last initialization task complete. Update the number of tasks. */
+    __parsec_tp->super.super.tdm.module->taskpool_addto_nb_tasks(&__parsec_tp->super.super, __parsec_tp->initial_number_tasks);
+    parsec_mfence();  /* write memory barrier to guarantee that the scheduler gets the correct number of tasks */
+    parsec_taskpool_enable((parsec_taskpool_t*)__parsec_tp, &__parsec_tp->startup_queue,
+                           (parsec_task_t*)this_task, es, __parsec_tp->super.super.nb_pending_actions);
+    __parsec_tp->super.super.tdm.module->taskpool_ready(&__parsec_tp->super.super);
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+    PARSEC_PROFILING_TRACE(es->es_profile,
+                           this_task->taskpool->profiling_array[2 * this_task->task_class->task_class_id + 1],
+                           0,
+                           this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    return PARSEC_HOOK_RETURN_DONE;
+  }
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static const __parsec_chore_t __merge_sort_SORT_chores[] ={
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+    { .type     = PARSEC_DEV_CPU,
+      .evaluate = (parsec_evaluate_function_t*)NULL,
+      .hook     = (parsec_hook_t*)hook_of_merge_sort_SORT },
+#endif  /* defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+    { .type     = PARSEC_DEV_NONE,
+      .evaluate = NULL,
+      .hook     = (parsec_hook_t*)NULL },  /* End marker */
+};
+
+static const parsec_task_class_t merge_sort_SORT = {
+  .name = "SORT",
+  .task_class_id = 1,
+  .nb_flows = 1,
+  .nb_parameters = 1,
+  .nb_locals = 1,
+  .task_class_type = PARSEC_TASK_CLASS_TYPE_PTG,
+  .params = { &symb_merge_sort_SORT_i, NULL },
+  .locals = { &symb_merge_sort_SORT_i, NULL },
+  .data_affinity = (parsec_data_ref_fn_t*)affinity_of_merge_sort_SORT,
+  .initial_data = (parsec_data_ref_fn_t*)affinity_of_merge_sort_SORT,
+  .final_data = (parsec_data_ref_fn_t*)affinity_of_merge_sort_SORT,
+  .priority = NULL,
+  .properties = properties_of_merge_sort_SORT,
+#if MAX_PARAM_COUNT < 1  /* number of read flows of SORT */
+  #error Too many read flows for task SORT
+#endif  /* MAX_PARAM_COUNT */
+#if MAX_PARAM_COUNT < 1  /* number of write flows of SORT */
+  #error Too many write flows for task SORT
+#endif  /* MAX_PARAM_COUNT */
+  .in = { &flow_of_merge_sort_SORT_for_A, NULL },
+  .out = { &flow_of_merge_sort_SORT_for_A, NULL },
+  .flags = 0x0 | PARSEC_USE_DEPS_MASK,
+  .dependencies_goal = 0x1,
+  .make_key = __jdf2c_make_key_SORT,
+  .task_snprintf = parsec_task_snprintf,
+#if defined(PARSEC_PROF_TRACE)
+  .profile_info = &parsec_task_profile_info,
+#endif
+  .key_functions = &__jdf2c_key_fns_SORT,
+  .fini = (parsec_hook_t*)NULL,
+  .incarnations = __merge_sort_SORT_chores,
+  .find_deps = parsec_hash_find_deps,
+  .update_deps = parsec_update_deps_with_mask,
+  .iterate_successors = (parsec_traverse_function_t*)iterate_successors_of_merge_sort_SORT,
+  .iterate_predecessors = (parsec_traverse_function_t*)iterate_predecessors_of_merge_sort_SORT,
+  .release_deps = (parsec_release_deps_t*)release_deps_of_merge_sort_SORT,
+  .prepare_output = (parsec_hook_t*)NULL,
+  .prepare_input = (parsec_hook_t*)data_lookup_of_merge_sort_SORT,
+  .time_estimate = NULL,
+  .get_datatype = datatype_lookup_of_merge_sort_SORT,
+  .complete_execution = (parsec_hook_t*)complete_hook_of_merge_sort_SORT,
+  .release_task = &release_task_of_merge_sort_SORT,
+#if defined(PARSEC_SIM)
+  .sim_cost_fct = (parsec_sim_cost_fct_t*)NULL,
+#endif
+};
+
+
+/******                                  INIT_DATA                                    ******/
+
+static inline int32_t minexpr_of_symb_merge_sort_INIT_DATA_i_fct(const __parsec_merge_sort_internal_taskpool_t *__parsec_tp, const __parsec_merge_sort_INIT_DATA_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_merge_sort_INIT_DATA_i = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_merge_sort_INIT_DATA_i_fct }
+                   }
+};
+static inline int maxexpr_of_symb_merge_sort_INIT_DATA_i_fct(const __parsec_merge_sort_internal_taskpool_t *__parsec_tp, const __parsec_merge_sort_INIT_DATA_parsec_assignment_t *locals)
+{
+  const int i = locals->i.value; (void)i;
+
+  (void)i;
+  (void)__parsec_tp; (void)locals;
+  return (NT - 1);
+}
+static const parsec_expr_t maxexpr_of_symb_merge_sort_INIT_DATA_i = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_merge_sort_INIT_DATA_i_fct }
+                   }
+};
+static const parsec_symbol_t symb_merge_sort_INIT_DATA_i = { .name = "i", .context_index = 0, .min = &minexpr_of_symb_merge_sort_INIT_DATA_i, .max = &maxexpr_of_symb_merge_sort_INIT_DATA_i, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int affinity_of_merge_sort_INIT_DATA(const __parsec_merge_sort_INIT_DATA_task_t *this_task,
+                     parsec_data_ref_t *ref)
+{
+    const __parsec_merge_sort_internal_taskpool_t *__parsec_tp = (const __parsec_merge_sort_internal_taskpool_t*)this_task->taskpool;
+  const int i = this_task->locals.i.value; (void)i;
+
+  /* Silent Warnings: should look into predicate to know what variables are usefull */
+  (void)i;
+  ref->dc = (parsec_data_collection_t *)__parsec_tp->super._g_dataA;
+  /* Compute data key */
+  ref->key = ref->dc->data_key(ref->dc, i, 0);
+  return 1;
+}
+static const parsec_property_t properties_of_merge_sort_INIT_DATA[1] = {
+  {.name = NULL, .expr = NULL}
+};
+static parsec_data_t *flow_of_merge_sort_INIT_DATA_for_A_dep1_atline_189_direct_access(const __parsec_merge_sort_internal_taskpool_t *__parsec_tp, const __parsec_merge_sort_INIT_DATA_parsec_assignment_t *assignments)
+{
+  const int i = assignments->i.value; (void)i;
+
+  /* Silence Warnings: should look into parameters to know what variables are useful */
+  (void)i;
+  if( __parsec_tp->super.super.context->my_rank == (int32_t)rank_of_dataA(i, 0) )
+    return data_of_dataA(i, 0);
+  return NULL;
+}
+
+static const parsec_dep_t flow_of_merge_sort_INIT_DATA_for_A_dep1_atline_189 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = PARSEC_LOCAL_DATA_TASK_CLASS_ID, /* merge_sort_dataA */
+  .direct_data = (parsec_data_lookup_func_t)&flow_of_merge_sort_INIT_DATA_for_A_dep1_atline_189_direct_access,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_merge_sort_INIT_DATA_for_A,
+};
+static const parsec_dep_t flow_of_merge_sort_INIT_DATA_for_A_dep2_atline_190 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 1, /* merge_sort_SORT */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_merge_sort_SORT_for_A,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_merge_sort_INIT_DATA_for_A,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+#if MAX_DEP_OUT_COUNT < 1  /* number of output dependencies */
+    #error Too many output dependencies (supports up to MAX_DEP_OUT_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_OUT_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_merge_sort_INIT_DATA_for_A = {
+  .name               = "A",
+  .sym_type           = PARSEC_SYM_INOUT,
+  .flow_flags         = PARSEC_FLOW_ACCESS_RW|PARSEC_FLOW_HAS_IN_DEPS,
+  .flow_index         = 0,
+  .flow_datatype_mask = 0x1,
+  .dep_in     = { &flow_of_merge_sort_INIT_DATA_for_A_dep1_atline_189 },
+  .dep_out    = { &flow_of_merge_sort_INIT_DATA_for_A_dep2_atline_190 }
+};
+
+static void
+iterate_successors_of_merge_sort_INIT_DATA(parsec_execution_stream_t *es, const __parsec_merge_sort_INIT_DATA_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_merge_sort_internal_taskpool_t *__parsec_tp = (const __parsec_merge_sort_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_merge_sort_INIT_DATA_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_merge_sort_INIT_DATA_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int i = __jdf2c__tmp_locals.i.value; (void)i;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)i;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_dataA(i, 0);
+#endif
+  if( action_mask & 0x1 ) {  /* Flow of data A [0] */
+    data.data   = this_task->data._f_A.data_out;
+    data.data_future  = NULL;
+    if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_merge_sort_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_merge_sort_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+       __parsec_merge_sort_SORT_task_t* ncc = (__parsec_merge_sort_SORT_task_t*)&nc;
+    nc.task_class = __parsec_tp->super.super.task_classes_array[merge_sort_SORT.task_class_id];
+      const int SORT_i = i;
+      if( (SORT_i >= (0)) && (SORT_i <= ((NT - 1))) ) {
+        assert(&nc.locals[0].value == &ncc->locals.i.value);
+        ncc->locals.i.value = SORT_i;
+#if defined(DISTRIBUTED)
+        rank_dst = rank_of_dataA(ncc->locals.i.value, 0);
+        if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+          vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_dataA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_dataA, ncc->locals.i.value, 0);
+        nc.priority = __parsec_tp->super.super.priority;
+        successor_repo = SORT_repo;
+        successor_repo_key = __jdf2c_make_key_SORT((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+      RELEASE_DEP_OUTPUT(es, "A", this_task, "A", &nc, rank_src, rank_dst, &data);
+      if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_merge_sort_INIT_DATA_for_A_dep2_atline_190, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+        }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static int release_deps_of_merge_sort_INIT_DATA(parsec_execution_stream_t *es, __parsec_merge_sort_INIT_DATA_task_t *this_task, uint32_t action_mask, parsec_remote_deps_t *deps)
+{
+  PARSEC_PINS(es, RELEASE_DEPS_BEGIN, (parsec_task_t *)this_task);  const __parsec_merge_sort_internal_taskpool_t *__parsec_tp = (const __parsec_merge_sort_internal_taskpool_t *)this_task->taskpool;
+  parsec_release_dep_fct_arg_t arg;
+  int __vp_id;
+  int consume_local_repo = 0;
+  arg.action_mask = action_mask;
+  arg.output_entry = NULL;
+  arg.output_repo = NULL;
+#if defined(DISTRIBUTED)
+  arg.remote_deps = deps;
+#endif  /* defined(DISTRIBUTED) */
+  assert(NULL != es);
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS )    arg.ready_lists = alloca(sizeof(parsec_task_t *) * es->virtual_process->parsec_context->nb_vp);
+  else
+    arg.ready_lists = NULL;
+  for( __vp_id = 0; __vp_id < es->virtual_process->parsec_context->nb_vp; arg.ready_lists[__vp_id++] = NULL );
+  (void)__parsec_tp; (void)deps;
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_A.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_A.source_repo, this_task->data._f_A.source_repo_entry->ht_item.key );
+    }
+  }
+  consume_local_repo = (this_task->repo_entry != NULL);
+  arg.output_repo = INIT_DATA_repo;
+  arg.output_entry = this_task->repo_entry;
+  arg.output_usage = 0;
+  if( action_mask & (PARSEC_ACTION_RELEASE_LOCAL_DEPS | PARSEC_ACTION_GET_REPO_ENTRY) ) {
+    arg.output_entry = data_repo_lookup_entry_and_create( es, arg.output_repo, __jdf2c_make_key_INIT_DATA((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    arg.output_entry->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(arg.output_entry->sim_exec_date == 0);
+    arg.output_entry->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  if(action_mask & ( PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE ) ){
+    /* Generate the reshape promise for the outputs that need it */
+    iterate_successors_of_merge_sort_INIT_DATA(es, this_task, action_mask, parsec_set_up_reshape_promise, &arg);
+   }
+  iterate_successors_of_merge_sort_INIT_DATA(es, this_task, action_mask, parsec_release_dep_fct, &arg);
+
+#if defined(DISTRIBUTED)
+  if( (action_mask & PARSEC_ACTION_SEND_REMOTE_DEPS) && (NULL != arg.remote_deps)) {
+    parsec_remote_dep_activate(es, (parsec_task_t *)this_task, arg.remote_deps, arg.remote_deps->outgoing_mask);
+  }
+#endif
+
+  if(action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS) {
+    data_repo_entry_addto_usage_limit(INIT_DATA_repo, arg.output_entry->ht_item.key, arg.output_usage);
+    __parsec_schedule_vp(es, arg.ready_lists, 0);
+  }
+      if (consume_local_repo) {
+         data_repo_entry_used_once( INIT_DATA_repo, this_task->repo_entry->ht_item.key );
+      }
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_A.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_A.data_in);
+    }
+  }
+  PARSEC_PINS(es, RELEASE_DEPS_END, (parsec_task_t *)this_task);  return 0;
+}
+
+static int data_lookup_of_merge_sort_INIT_DATA(parsec_execution_stream_t *es, __parsec_merge_sort_INIT_DATA_task_t *this_task)
+{
+  const __parsec_merge_sort_internal_taskpool_t *__parsec_tp = (__parsec_merge_sort_internal_taskpool_t *)this_task->taskpool;
+  parsec_assignment_t generic_locals[MAX_PARAM_COUNT];  /* generic task locals */
+  int target_device = 0; (void)target_device;
+  (void)__parsec_tp; (void)generic_locals; (void)es;
+  parsec_data_copy_t *chunk = NULL;
+  data_repo_t        *reshape_repo  = NULL, *consumed_repo  = NULL;
+  data_repo_entry_t  *reshape_entry = NULL, *consumed_entry = NULL;
+  parsec_key_t        reshape_entry_key = 0, consumed_entry_key = 0;
+  uint8_t             consumed_flow_index;
+  parsec_dep_data_description_t data;
+  int ret;
+  (void)reshape_repo; (void)reshape_entry; (void)reshape_entry_key;
+  (void)consumed_repo; (void)consumed_entry; (void)consumed_entry_key;
+  (void)consumed_flow_index;
+  (void)chunk; (void)data; (void)ret;
+  const int i = this_task->locals.i.value; (void)i;
+  if( NULL == this_task->repo_entry ){
+    this_task->repo_entry = data_repo_lookup_entry_and_create(es, INIT_DATA_repo,                                       __jdf2c_make_key_INIT_DATA((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    data_repo_entry_addto_usage_limit(INIT_DATA_repo, this_task->repo_entry->ht_item.key, 1);    this_task->repo_entry ->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(this_task->repo_entry ->sim_exec_date == 0);
+    this_task->repo_entry ->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  /* The reshape repo is the current task repo. */  reshape_repo = INIT_DATA_repo;
+  reshape_entry_key = __jdf2c_make_key_INIT_DATA((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals) ;
+  reshape_entry = this_task->repo_entry;
+  /* Lookup the input data, and store them in the context if any */
+
+if(! this_task->data._f_A.fulfill ){ /* Flow A */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_A.data_out = NULL;  /* By default, if nothing matches */
+  /* Flow A [0] dependency [0] from memory dataA */
+  if( NULL == (chunk = this_task->data._f_A.data_in) ) {
+  /* No data set up by predecessor on this task input flow */
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+  parsec_prof_grapher_data_input(data_of_dataA(i, 0), (parsec_task_t*)this_task, &flow_of_merge_sort_INIT_DATA_for_A, 1);
+#endif
+    chunk = parsec_data_get_copy(data_of_dataA(i, 0), target_device);
+    data.data = chunk;
+    data.data_future  = NULL;
+        data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.data_future   = NULL;
+    if( (ret = parsec_get_copy_reshape_from_desc(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    this_task->data._f_A.data_out = chunk;
+    PARSEC_OBJ_RETAIN(chunk);
+  } 
+    this_task->data._f_A.data_in     = chunk;
+    this_task->data._f_A.source_repo       = consumed_repo;
+    this_task->data._f_A.source_repo_entry = consumed_entry;
+    if( this_task->data._f_A.source_repo_entry == this_task->repo_entry ){
+      /* in case we have consume from this task repo entry for the flow,
+       * it is cleaned up, avoiding having old stuff during release_deps_of
+       */
+      this_task->repo_entry->data[0] = NULL;
+    }
+    this_task->data._f_A.fulfill = 1;
+}
+
+  /** Generate profiling information */
+#if defined(PARSEC_PROF_TRACE)
+  this_task->prof_info.desc = (parsec_data_collection_t*)__parsec_tp->super._g_dataA;
+  this_task->prof_info.priority = this_task->priority;
+  this_task->prof_info.data_id   = ((parsec_data_collection_t*)__parsec_tp->super._g_dataA)->data_key((parsec_data_collection_t*)__parsec_tp->super._g_dataA, i, 0);
+  this_task->prof_info.task_class_id = this_task->task_class->task_class_id;
+  this_task->prof_info.task_return_code = -1;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int datatype_lookup_of_merge_sort_INIT_DATA(parsec_execution_stream_t *es, const parsec_task_t *this_generic_task, const parsec_task_t *parent_task,
+              uint32_t* flow_mask, parsec_dep_data_description_t* data)
+{
+  const __parsec_merge_sort_INIT_DATA_task_t *this_task = (__parsec_merge_sort_INIT_DATA_task_t*)this_generic_task;
+  const __parsec_merge_sort_internal_taskpool_t *__parsec_tp = (__parsec_merge_sort_internal_taskpool_t *)this_task->taskpool;
+  (void)__parsec_tp; (void)es; (void)this_task; (void)data; (void)parent_task;
+  const int i = this_task->locals.i.value; (void)i;
+  data->local.arena = data->remote.arena = NULL;
+  data->local.src_datatype  = data->local.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->local.src_count     = data->local.dst_count = 0;
+  data->local.src_displ     = data->local.dst_displ = 0;
+  data->data_future  = NULL;
+  if( (*flow_mask) & 0x80000000U ) { /* these are the input dependencies remote datatypes  */
+if( (*flow_mask) & 0x1U ) {  /* Flow A */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_merge_sort_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_merge_sort_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_merge_sort_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+    goto no_mask_match;
+  }
+
+  /* these are the output dependencies remote datatypes */
+if( (*flow_mask) & 0x1U ) {  /* Flow A */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_merge_sort_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_merge_sort_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_merge_sort_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+ no_mask_match:
+  data->data                             = NULL;
+  data->remote.src_datatype = data->remote.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->remote.src_count    = data->remote.dst_count = 0;
+  data->remote.src_displ    = data->remote.dst_displ = 0;
+  data->data_future  = NULL;
+  (*flow_mask) = 0;  /* nothing left */
+  (void)i;
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+static int hook_of_merge_sort_INIT_DATA(parsec_execution_stream_t *es, __parsec_merge_sort_INIT_DATA_task_t *this_task)
+{
+  __parsec_merge_sort_internal_taskpool_t *__parsec_tp = (__parsec_merge_sort_internal_taskpool_t *)this_task->taskpool;
+  (void)es; (void)__parsec_tp;
+  const int i = this_task->locals.i.value; (void)i;
+  (void)i;
+
+  /** Declare the variables that will hold the data, and all the accounting for each */
+  parsec_data_copy_t *_f_A = this_task->data._f_A.data_in;
+  void *A = PARSEC_DATA_COPY_GET_PTR(_f_A); (void)A;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    data_repo_entry_t *eA = this_task->data._f_A.source_repo_entry;
+    if( (NULL != eA) && (eA->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eA->sim_exec_date;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+    if ( NULL != _f_A ) {
+#if defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) || defined(PARSEC_HAVE_DEV_HIP_SUPPORT)
+      parsec_data_transfer_ownership_to_copy( _f_A->original, 0 /* device */,
+                                           PARSEC_FLOW_ACCESS_RW);
+#endif  /* defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) || defined(PARSEC_HAVE_DEV_HIP_SUPPORT) */
+      _f_A->version++;  /* A */
+#if defined(PARSEC_DEBUG_NOISIER)
+      char tmp[128];
+      PARSEC_DEBUG_VERBOSE(10, parsec_debug_output,
+                           "Body of %s: change Data copy %p to version %d",
+                           parsec_task_snprintf(tmp, 128, (parsec_task_t*)(this_task)),
+                           _f_A, _f_A->version);
+#endif /* defined(PARSEC_DEBUG_NOISIER) */
+    }
+  /** Cache Awareness Accounting */
+#if defined(PARSEC_CACHE_AWARENESS)
+  cache_buf_referenced(es->closest_cache, A);
+#endif /* PARSEC_CACHE_AWARENESS */
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                                INIT_DATA BODY                                -----*/
+
+   int rank=(__parsec_tp->super.super.context)->my_rank;
+   pid_t pid = getpid();
+
+   for(int j=0; j<5; j++){
+       *(((int *)A)+j) = rank*10 + pid/100 + random()%1048576;
+   }
+
+
+/*-----                            END OF INIT_DATA BODY                              -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#endif  /*  defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+static int complete_hook_of_merge_sort_INIT_DATA(parsec_execution_stream_t *es, __parsec_merge_sort_INIT_DATA_task_t *this_task)
+{
+  const __parsec_merge_sort_internal_taskpool_t *__parsec_tp = (__parsec_merge_sort_internal_taskpool_t *)this_task->taskpool;
+#if defined(DISTRIBUTED)
+    const int i = this_task->locals.i.value; (void)i;
+#endif  /* defined(DISTRIBUTED) */
+  (void)es; (void)__parsec_tp;
+parsec_data_t* data_t_desc = NULL; (void)data_t_desc;
+#if defined(DISTRIBUTED)
+  /** If not working on distributed, there is no risk that data is not in place */
+  (void)i;
+
+#endif /* DISTRIBUTED */
+#if defined(PARSEC_PROF_GRAPHER)
+  parsec_prof_grapher_task((parsec_task_t*)this_task, es->th_id, es->virtual_process->vp_id,
+     __jdf2c_key_fns_INIT_DATA.key_hash(this_task->task_class->make_key( (parsec_taskpool_t*)this_task->taskpool, ((parsec_task_t*)this_task)->locals), NULL));
+#endif  /* defined(PARSEC_PROF_GRAPHER) */
+  release_deps_of_merge_sort_INIT_DATA(es, this_task,
+      PARSEC_ACTION_RELEASE_REMOTE_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_REFS |
+      PARSEC_ACTION_RESHAPE_ON_RELEASE |
+      0x1,  /* mask of all dep_index */ 
+      NULL);
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static parsec_hook_return_t release_task_of_merge_sort_INIT_DATA(parsec_execution_stream_t *es, parsec_task_t *this_task)
+{
+    const __parsec_merge_sort_internal_taskpool_t *__parsec_tp =
+        (const __parsec_merge_sort_internal_taskpool_t *)this_task->taskpool;
+    parsec_hash_table_t *ht = (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[0];
+    parsec_key_t key = this_task->task_class->make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals);
+    parsec_hashable_dependency_t *hash_dep = (parsec_hashable_dependency_t *)parsec_hash_table_remove(ht, key);
+    parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);
+    return parsec_release_task_to_mempool_update_nbtasks(es, this_task);
+}
+
+static char *merge_sort_merge_sort_INIT_DATA_internal_init_deps_key_functions_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_merge_sort_internal_taskpool_t *__parsec_tp = (__parsec_merge_sort_internal_taskpool_t *)user_data;
+  int i = (__parsec_key) % __parsec_tp->INIT_DATA_i_range + __parsec_tp->INIT_DATA_i_min;
+  __parsec_key = __parsec_key / __parsec_tp->INIT_DATA_i_range;
+  snprintf(buffer, buffer_size, "INIT_DATA(%d)", i);
+  return buffer;
+}
+
+static parsec_key_fn_t merge_sort_merge_sort_INIT_DATA_internal_init_deps_key_functions = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = merge_sort_merge_sort_INIT_DATA_internal_init_deps_key_functions_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/* Needs: min-max count-tasks iterate */
+static int merge_sort_INIT_DATA_internal_init(parsec_execution_stream_t * es, __parsec_merge_sort_INIT_DATA_task_t * this_task)
+{
+  __parsec_merge_sort_internal_taskpool_t *__parsec_tp = (__parsec_merge_sort_internal_taskpool_t*)this_task->taskpool;
+  int32_t nb_tasks = 0, saved_nb_tasks = 0;
+int32_t __i_min = 0x7fffffff, __i_max = 0;int32_t __jdf2c_i_min = 0x7fffffff, __jdf2c_i_max = 0;  __parsec_merge_sort_INIT_DATA_parsec_assignment_t assignments = {  .i.value = 0 };
+  int32_t  i;
+  int32_t __jdf2c_i_start, __jdf2c_i_end, __jdf2c_i_inc;
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+  PARSEC_PROFILING_TRACE(es->es_profile,
+                         this_task->taskpool->profiling_array[START_KEY(this_task->task_class->task_class_id)],
+                         0,
+                         this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    __jdf2c_i_start = 0;
+    __jdf2c_i_end = (NT - 1);
+    __jdf2c_i_inc = 1;
+    __i_min = parsec_imin(__jdf2c_i_start, __jdf2c_i_end);
+    __i_max = parsec_imax(__jdf2c_i_start, __jdf2c_i_end);
+    __jdf2c_i_min = parsec_imin(__jdf2c_i_min, __i_min);
+    __jdf2c_i_max = parsec_imax(__jdf2c_i_max, __i_max);
+    for(i =  __jdf2c_i_start;
+        i <= __jdf2c_i_end;
+        i += __jdf2c_i_inc) {
+    assignments.i.value = i;
+    if( !INIT_DATA_pred(i) ) continue;
+    nb_tasks++;
+  } /* Loop on normal range i */
+   if( 0 != nb_tasks ) {
+     (void)parsec_atomic_fetch_add_int32(&__parsec_tp->initial_number_tasks, nb_tasks);
+   }
+  /* Set the range variables for the collision-free hash-computation */
+  __parsec_tp->INIT_DATA_i_min   = __jdf2c_i_min;
+  __parsec_tp->INIT_DATA_i_range = (__jdf2c_i_max - __jdf2c_i_min) + 1;
+    do {
+      this_task->super.list_next = (parsec_list_item_t*)__parsec_tp->startup_queue;
+    } while(!parsec_atomic_cas_ptr(&__parsec_tp->startup_queue, (parsec_list_item_t*)this_task->super.list_next, this_task));
+    this_task->status = PARSEC_TASK_STATUS_HOOK;
+
+  PARSEC_AYU_REGISTER_TASK(&merge_sort_INIT_DATA);
+  __parsec_tp->super.super.dependencies_array[0] = PARSEC_OBJ_NEW(parsec_hash_table_t);
+  parsec_hash_table_init(__parsec_tp->super.super.dependencies_array[0], offsetof(parsec_hashable_dependency_t, ht_item), 10, merge_sort_merge_sort_INIT_DATA_internal_init_deps_key_functions, this_task->taskpool);
+  __parsec_tp->repositories[0] = data_repo_create_nothreadsafe(nb_tasks, __jdf2c_key_fns_INIT_DATA, (parsec_taskpool_t*)__parsec_tp, 1);
+(void)saved_nb_tasks;
+(void)__i_min; (void)__i_max;  (void)__jdf2c_i_start; (void)__jdf2c_i_end; (void)__jdf2c_i_inc;  (void)assignments; (void)__parsec_tp; (void)es;
+  if(1 == parsec_atomic_fetch_dec_int32(&__parsec_tp->sync_point)) {
+    /* Last initialization task complete. Update the number of tasks. */
+    __parsec_tp->super.super.tdm.module->taskpool_addto_nb_tasks(&__parsec_tp->super.super, __parsec_tp->initial_number_tasks);
+    parsec_mfence();  /* write memory barrier to guarantee that the scheduler gets the correct number of tasks */
+    parsec_taskpool_enable((parsec_taskpool_t*)__parsec_tp, &__parsec_tp->startup_queue,
+                           (parsec_task_t*)this_task, es, __parsec_tp->super.super.nb_pending_actions);
+    __parsec_tp->super.super.tdm.module->taskpool_ready(&__parsec_tp->super.super);
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+    PARSEC_PROFILING_TRACE(es->es_profile,
+                           this_task->taskpool->profiling_array[2 * this_task->task_class->task_class_id + 1],
+                           0,
+                           this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    if( 1 >= __parsec_tp->super.super.nb_pending_actions ) {
+        /* if no tasks will be generated let's prevent the runtime from calling the hook and instead go directly to complete the task */
+        this_task->status = PARSEC_TASK_STATUS_COMPLETE;
+    }
+    return PARSEC_HOOK_RETURN_DONE;
+  }
+  return PARSEC_HOOK_RETURN_ASYNC;
+}
+
+static int __jdf2c_startup_INIT_DATA(parsec_execution_stream_t * es, __parsec_merge_sort_INIT_DATA_task_t *this_task)
+{
+  __parsec_merge_sort_INIT_DATA_task_t* new_task;
+  __parsec_merge_sort_internal_taskpool_t* __parsec_tp = (__parsec_merge_sort_internal_taskpool_t*)this_task->taskpool;
+  parsec_context_t *context = __parsec_tp->super.super.context;
+  int vpid = 0, nb_tasks = 0;
+  size_t total_nb_tasks = 0;
+  parsec_list_item_t* pready_ring[context->nb_vp];
+  int restore_context = 0;
+  int i = this_task->locals.i.value;  /* retrieve value saved during the last iteration */
+  for(int _i = 0; _i < context->nb_vp; pready_ring[_i++] = NULL );
+  if( 0 != this_task->locals.reserved[0].value ) {
+    this_task->locals.reserved[0].value = 1; /* reset the submission process */
+    restore_context = 1;
+    goto restore_context_0;
+  }
+  this_task->locals.reserved[0].value = 1; /* a sane default value */
+  for(this_task->locals.i.value = i = 0;
+      this_task->locals.i.value <= (NT - 1);
+      this_task->locals.i.value += 1, i = this_task->locals.i.value) {
+    if( !INIT_DATA_pred(i) ) continue;
+  __parsec_merge_sort_INIT_DATA_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_merge_sort_INIT_DATA_parsec_assignment_t*)&this_task->locals;
+  (void)__jdf2c__tmp_locals;
+  /* Flow for A is always a memory reference */
+    if( NULL != ((parsec_data_collection_t*)__parsec_tp->super._g_dataA)->vpid_of ) {
+      vpid = ((parsec_data_collection_t*)__parsec_tp->super._g_dataA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_dataA, i, 0);
+      assert(context->nb_vp >= vpid);
+    } else {
+      vpid = (vpid + 1) % context->nb_vp;  /* spread the initial joy */
+    }
+    new_task = (__parsec_merge_sort_INIT_DATA_task_t*)parsec_thread_mempool_allocate( context->virtual_processes[vpid]->execution_streams[0]->context_mempool );
+    PARSEC_OBJ_CONSTRUCT(new_task, parsec_task_t); /* construct called only when new, force-construct it again */
+    /* Copy only the valid elements from this_task to new_task one */
+    new_task->taskpool   = this_task->taskpool;
+    new_task->task_class = __parsec_tp->super.super.task_classes_array[merge_sort_INIT_DATA.task_class_id];
+    new_task->chore_mask   = PARSEC_DEV_ALL;
+    new_task->locals.i.value = this_task->locals.i.value;
+    PARSEC_LIST_ITEM_SINGLETON(new_task);
+    new_task->priority = __parsec_tp->super.super.priority;
+    new_task->repo_entry = NULL;
+    new_task->data._f_A.source_repo_entry = NULL;
+    new_task->data._f_A.source_repo       = NULL;
+    new_task->data._f_A.data_in         = NULL;
+    new_task->data._f_A.data_out        = NULL;
+    new_task->data._f_A.fulfill         = 0;
+#if defined(PARSEC_DEBUG_NOISIER)
+    {
+      char tmp[128];
+      PARSEC_DEBUG_VERBOSE(10, parsec_debug_output, "Add startup task %s to vpid %d",
+             parsec_task_snprintf(tmp, 128, (parsec_task_t*)new_task), vpid);
+    }
+#endif
+    parsec_dependencies_mark_task_as_startup((parsec_task_t*)new_task, es);
+    pready_ring[vpid] = parsec_list_item_ring_push_sorted(pready_ring[vpid],
+                                                          (parsec_list_item_t*)new_task,
+                                                          parsec_execution_context_priority_comparator);
+    nb_tasks++;
+   restore_context_0:  /* we jump here just so that we have code after the label */
+    restore_context = 0;
+    (void)restore_context;
+    if( nb_tasks > this_task->locals.reserved[0].value ) {
+      if( (size_t)this_task->locals.reserved[0].value < parsec_task_startup_iter ) this_task->locals.reserved[0].value <<= 1;
+      __parsec_schedule_vp(es, (parsec_task_t**)pready_ring, 0);
+      total_nb_tasks += nb_tasks;
+      nb_tasks = 0;
+      if( total_nb_tasks > parsec_task_startup_chunk ) {  /* stop here and request to be rescheduled */
+        return PARSEC_HOOK_RETURN_AGAIN;
+      }
+    }
+  } /* Loop on normal range i */
+  (void)vpid;
+  if( 0 != nb_tasks ) {
+    __parsec_schedule_vp(es, (parsec_task_t**)pready_ring, 0);
+    nb_tasks = 0;
+  }
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static const __parsec_chore_t __merge_sort_INIT_DATA_chores[] ={
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+    { .type     = PARSEC_DEV_CPU,
+      .evaluate = (parsec_evaluate_function_t*)NULL,
+      .hook     = (parsec_hook_t*)hook_of_merge_sort_INIT_DATA },
+#endif  /* defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+    { .type     = PARSEC_DEV_NONE,
+      .evaluate = NULL,
+      .hook     = (parsec_hook_t*)NULL },  /* End marker */
+};
+
+static const parsec_task_class_t merge_sort_INIT_DATA = {
+  .name = "INIT_DATA",
+  .task_class_id = 0,
+  .nb_flows = 1,
+  .nb_parameters = 1,
+  .nb_locals = 1,
+  .task_class_type = PARSEC_TASK_CLASS_TYPE_PTG,
+  .params = { &symb_merge_sort_INIT_DATA_i, NULL },
+  .locals = { &symb_merge_sort_INIT_DATA_i, NULL },
+  .data_affinity = (parsec_data_ref_fn_t*)affinity_of_merge_sort_INIT_DATA,
+  .initial_data = (parsec_data_ref_fn_t*)affinity_of_merge_sort_INIT_DATA,
+  .final_data = (parsec_data_ref_fn_t*)affinity_of_merge_sort_INIT_DATA,
+  .priority = NULL,
+  .properties = properties_of_merge_sort_INIT_DATA,
+#if MAX_PARAM_COUNT < 1  /* number of read flows of INIT_DATA */
+  #error Too many read flows for task INIT_DATA
+#endif  /* MAX_PARAM_COUNT */
+#if MAX_PARAM_COUNT < 1  /* number of write flows of INIT_DATA */
+  #error Too many write flows for task INIT_DATA
+#endif  /* MAX_PARAM_COUNT */
+  .in = { &flow_of_merge_sort_INIT_DATA_for_A, NULL },
+  .out = { &flow_of_merge_sort_INIT_DATA_for_A, NULL },
+  .flags = 0x0 | PARSEC_HAS_IN_IN_DEPENDENCIES | PARSEC_USE_DEPS_MASK,
+  .dependencies_goal = 0x1,
+  .make_key = __jdf2c_make_key_INIT_DATA,
+  .task_snprintf = parsec_task_snprintf,
+#if defined(PARSEC_PROF_TRACE)
+  .profile_info = &parsec_task_profile_info,
+#endif
+  .key_functions = &__jdf2c_key_fns_INIT_DATA,
+  .fini = (parsec_hook_t*)NULL,
+  .incarnations = __merge_sort_INIT_DATA_chores,
+  .find_deps = parsec_hash_find_deps,
+  .update_deps = parsec_update_deps_with_mask,
+  .iterate_successors = (parsec_traverse_function_t*)iterate_successors_of_merge_sort_INIT_DATA,
+  .iterate_predecessors = (parsec_traverse_function_t*)NULL,
+  .release_deps = (parsec_release_deps_t*)release_deps_of_merge_sort_INIT_DATA,
+  .prepare_output = (parsec_hook_t*)NULL,
+  .prepare_input = (parsec_hook_t*)data_lookup_of_merge_sort_INIT_DATA,
+  .time_estimate = NULL,
+  .get_datatype = datatype_lookup_of_merge_sort_INIT_DATA,
+  .complete_execution = (parsec_hook_t*)complete_hook_of_merge_sort_INIT_DATA,
+  .release_task = &release_task_of_merge_sort_INIT_DATA,
+#if defined(PARSEC_SIM)
+  .sim_cost_fct = (parsec_sim_cost_fct_t*)NULL,
+#endif
+};
+
+
+static const parsec_task_class_t *merge_sort_task_classes[] = {
+  &merge_sort_INIT_DATA,
+  &merge_sort_SORT,
+  &merge_sort_REDUCE,
+  &merge_sort_RESULT
+};
+
+static void merge_sort_startup(parsec_context_t *context, __parsec_merge_sort_internal_taskpool_t *__parsec_tp, parsec_list_item_t ** ready_tasks)
+{
+  uint32_t i, supported_dev = 0;
+ 
+  for( i = 0; i < parsec_nb_devices; i++ ) {
+    if( !(__parsec_tp->super.super.devices_index_mask & (1<<i)) ) continue;
+    parsec_device_module_t* device = parsec_mca_device_get(i);
+    parsec_data_collection_t* parsec_dc;
+ 
+    if(NULL == device) continue;
+    if(NULL != device->taskpool_register)
+      if( PARSEC_SUCCESS != device->taskpool_register(device, (parsec_taskpool_t*)__parsec_tp) ) {
+        parsec_debug_verbose(5, parsec_debug_output, "Device %s refused to register taskpool %p", device->name, __parsec_tp);
+        __parsec_tp->super.super.devices_index_mask &= ~(1 << device->device_index);
+        continue;
+      }
+    if(NULL != device->memory_register) {  /* Register all the data */
+      parsec_dc = (parsec_data_collection_t*)__parsec_tp->super._g_dataA;
+      if( (NULL != parsec_dc->register_memory) &&
+          (PARSEC_SUCCESS != parsec_dc->register_memory(parsec_dc, device)) ) {
+        parsec_debug_verbose(3, parsec_debug_output, "Device %s refused to register memory for data %s (%p) from taskpool %p",
+                     device->name, parsec_dc->key_base, parsec_dc, __parsec_tp);
+        __parsec_tp->super.super.devices_index_mask &= ~(1 << device->device_index);
+      }
+    }
+    supported_dev |= device->type;
+  }
+  /* Remove all the chores without a backend device */
+  for( i = 0; i < PARSEC_merge_sort_NB_TASK_CLASSES; i++ ) {
+    parsec_task_class_t* tc = (parsec_task_class_t*)__parsec_tp->super.super.task_classes_array[i];
+    __parsec_chore_t* chores = (__parsec_chore_t*)tc->incarnations;
+    uint32_t idx = 0, j;
+    for( j = 0; PARSEC_DEV_NONE != chores[j].type; j++ ) {
+      if( !(supported_dev & chores[j].type) ) continue;
+      if( j != idx ) {
+        chores[idx] = chores[j];
+        parsec_debug_verbose(20, parsec_debug_output, "Device type %i disabled for function %s"
+, chores[j].type, tc->name);
+      }
+      idx++;
+    }
+    chores[idx].type     = PARSEC_DEV_NONE;
+    chores[idx].evaluate = NULL;
+    chores[idx].hook     = NULL;
+    /* Create the initialization tasks for each taskclass */
+    parsec_task_t* task = (parsec_task_t*)parsec_thread_mempool_allocate(context->virtual_processes[0]->execution_streams[0]->context_mempool);
+    PARSEC_OBJ_CONSTRUCT(task, parsec_task_t); /* construct called only when new, force-construct it again */
+    task->taskpool = (parsec_taskpool_t *)__parsec_tp;
+    task->chore_mask = PARSEC_DEV_CPU;
+    memset(&task->locals, 0, sizeof(parsec_assignment_t) * MAX_LOCAL_COUNT);
+    PARSEC_LIST_ITEM_SINGLETON(task);
+    task->priority = -1;
+    task->task_class = task->taskpool->task_classes_array[PARSEC_merge_sort_NB_TASK_CLASSES + i];
+    int where = i % context->nb_vp;
+    if( NULL == ready_tasks[where] ) ready_tasks[where] = &task->super;
+    else ready_tasks[where] = parsec_list_item_ring_push(ready_tasks[where], &task->super);
+  }
+}
+static void __parsec_merge_sort_internal_destructor( __parsec_merge_sort_internal_taskpool_t *__parsec_tp )
+{
+  uint32_t i;
+  parsec_taskpool_unregister( &__parsec_tp->super.super );
+  if(NULL != __parsec_tp->super.super.tdm.module) __parsec_tp->super.super.tdm.module->unmonitor_taskpool(&__parsec_tp->super.super);
+  for( i = 0; i < (uint32_t)(2 * __parsec_tp->super.super.nb_task_classes); i++ ) {  /* Extra startup function added at the end */
+    parsec_task_class_t* tc = (parsec_task_class_t*)__parsec_tp->super.super.task_classes_array[i];
+    free((void*)tc->incarnations);
+    free(tc);
+  }
+  free(__parsec_tp->super.super.task_classes_array); __parsec_tp->super.super.task_classes_array = NULL;
+  __parsec_tp->super.super.nb_task_classes = 0;
+
+  for(i = 0; i < (uint32_t)__parsec_tp->super.arenas_datatypes_size; i++) {
+    if( NULL != __parsec_tp->super.arenas_datatypes[i].arena ) {
+      PARSEC_OBJ_RELEASE(__parsec_tp->super.arenas_datatypes[i].arena);
+    }
+  }
+  /* Destroy the data repositories for this object */
+   data_repo_destroy_nothreadsafe(__parsec_tp->repositories[3]);  /* RESULT */
+   data_repo_destroy_nothreadsafe(__parsec_tp->repositories[2]);  /* REDUCE */
+   data_repo_destroy_nothreadsafe(__parsec_tp->repositories[1]);  /* SORT */
+   data_repo_destroy_nothreadsafe(__parsec_tp->repositories[0]);  /* INIT_DATA */
+  /* Release the dependencies arrays for this object */
+  parsec_hash_table_fini( (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[3] );
+  PARSEC_OBJ_RELEASE(__parsec_tp->super.super.dependencies_array[3]);
+  __parsec_tp->super.super.dependencies_array[3] = NULL;
+  parsec_hash_table_fini( (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[2] );
+  PARSEC_OBJ_RELEASE(__parsec_tp->super.super.dependencies_array[2]);
+  __parsec_tp->super.super.dependencies_array[2] = NULL;
+  parsec_hash_table_fini( (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[1] );
+  PARSEC_OBJ_RELEASE(__parsec_tp->super.super.dependencies_array[1]);
+  __parsec_tp->super.super.dependencies_array[1] = NULL;
+  parsec_hash_table_fini( (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[0] );
+  PARSEC_OBJ_RELEASE(__parsec_tp->super.super.dependencies_array[0]);
+  __parsec_tp->super.super.dependencies_array[0] = NULL;
+  free( __parsec_tp->super.super.dependencies_array );
+  __parsec_tp->super.super.dependencies_array = NULL;
+  /* Unregister all the data */
+  uint32_t _i;
+  for( _i = 0; _i < parsec_nb_devices; _i++ ) {
+    parsec_device_module_t* device;
+    parsec_data_collection_t* parsec_dc;
+    if(!(__parsec_tp->super.super.devices_index_mask & (1 << _i))) continue;
+    if((NULL == (device = parsec_mca_device_get(_i))) || (NULL == device->memory_unregister)) continue;
+    parsec_dc = (parsec_data_collection_t*)__parsec_tp->super._g_dataA;
+  if( NULL != parsec_dc->unregister_memory ) { (void)parsec_dc->unregister_memory(parsec_dc, device); };
+}
+  /* Unregister the taskpool from the devices */
+  for( i = 0; i < parsec_nb_devices; i++ ) {
+    if(!(__parsec_tp->super.super.devices_index_mask & (1 << i))) continue;
+    __parsec_tp->super.super.devices_index_mask ^= (1 << i);
+    parsec_device_module_t* device = parsec_mca_device_get(i);
+    if((NULL == device) || (NULL == device->taskpool_unregister)) continue;
+    if( PARSEC_SUCCESS != device->taskpool_unregister(device, &__parsec_tp->super.super) ) continue;
+  }
+  free(__parsec_tp->super.super.taskpool_name); __parsec_tp->super.super.taskpool_name = NULL;
+}
+
+void __parsec_merge_sort_internal_constructor(__parsec_merge_sort_internal_taskpool_t* __parsec_tp)
+{
+  parsec_task_class_t* tc;
+  uint32_t i, j;
+
+  __parsec_tp->super.super.nb_task_classes = PARSEC_merge_sort_NB_TASK_CLASSES;
+  __parsec_tp->super.super.devices_index_mask = PARSEC_DEVICES_ALL;
+  __parsec_tp->super.super.taskpool_name = strdup("merge_sort");
+  parsec_termdet_open_module(&__parsec_tp->super.super, "local");
+  __parsec_tp->super.super.tdm.module->monitor_taskpool(&__parsec_tp->super.super,
+                                                        parsec_taskpool_termination_detected);
+  __parsec_tp->super.super.update_nb_runtime_task = parsec_add_fetch_runtime_task;
+  __parsec_tp->super.super.dependencies_array = (void **)
+              calloc(__parsec_tp->super.super.nb_task_classes, sizeof(void*));
+  /* Twice the size to hold the startup tasks function_t */
+  __parsec_tp->super.super.task_classes_array = (const parsec_task_class_t**)
+              calloc((2 * PARSEC_merge_sort_NB_TASK_CLASSES + 1), sizeof(parsec_task_class_t*));
+  __parsec_tp->super.super.tdm.module->taskpool_addto_runtime_actions(&__parsec_tp->super.super, PARSEC_merge_sort_NB_TASK_CLASSES);  /* for the startup tasks */
+  __parsec_tp->super.super.taskpool_type = PARSEC_TASKPOOL_TYPE_PTG;
+  __parsec_tp->sync_point = __parsec_tp->super.super.nb_task_classes;
+  __parsec_tp->initial_number_tasks = 0;
+  __parsec_tp->startup_queue = NULL;
+  for( i = 0; i < __parsec_tp->super.super.nb_task_classes; i++ ) {
+    __parsec_tp->super.super.task_classes_array[i] = tc = malloc(sizeof(parsec_task_class_t));
+    memcpy(tc, merge_sort_task_classes[i], sizeof(parsec_task_class_t));
+    for( j = 0; PARSEC_DEV_NONE != tc->incarnations[j].type; j++);  /* compute the number of incarnations */
+    tc->incarnations = (__parsec_chore_t*)malloc((j+1) * sizeof(__parsec_chore_t));
+        memcpy((__parsec_chore_t*)tc->incarnations, merge_sort_task_classes[i]->incarnations, (j+1) * sizeof(__parsec_chore_t));
+
+    /* Add a placeholder for initialization and startup task */
+    __parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+i] = tc = (parsec_task_class_t*)malloc(sizeof(parsec_task_class_t));
+    memcpy(tc, (void*)&__parsec_generic_startup, sizeof(parsec_task_class_t));
+    tc->task_class_id = __parsec_tp->super.super.nb_task_classes + i;
+    tc->incarnations = (__parsec_chore_t*)malloc(2 * sizeof(__parsec_chore_t));
+    memcpy((__parsec_chore_t*)tc->incarnations, (void*)__parsec_generic_startup.incarnations, 2 * sizeof(__parsec_chore_t));
+    tc->release_task = parsec_release_task_to_mempool_and_count_as_runtime_tasks;
+  }
+  /* Startup task for RESULT */
+  tc = (parsec_task_class_t *)__parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+0];
+  tc->name = "Startup for RESULT";
+  tc->prepare_input = (parsec_hook_t*)merge_sort_RESULT_internal_init;
+  /* Startup task for REDUCE */
+  tc = (parsec_task_class_t *)__parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+1];
+  tc->name = "Startup for REDUCE";
+  tc->prepare_input = (parsec_hook_t*)merge_sort_REDUCE_internal_init;
+  /* Startup task for SORT */
+  tc = (parsec_task_class_t *)__parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+2];
+  tc->name = "Startup for SORT";
+  tc->prepare_input = (parsec_hook_t*)merge_sort_SORT_internal_init;
+  /* Startup task for INIT_DATA */
+  tc = (parsec_task_class_t *)__parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+3];
+  tc->name = "Startup for INIT_DATA";
+  tc->prepare_input = (parsec_hook_t*)merge_sort_INIT_DATA_internal_init;
+  ((__parsec_chore_t*)&tc->incarnations[0])->hook = (parsec_hook_t *)__jdf2c_startup_INIT_DATA;
+  /* Compute the number of arenas_datatypes: */
+  /*   PARSEC_merge_sort_DEFAULT_ARENA  ->  0 */
+  __parsec_tp->super.arenas_datatypes_size = 1;
+  memset(&__parsec_tp->super.arenas_datatypes[0], 0, __parsec_tp->super.arenas_datatypes_size*sizeof(parsec_arena_datatype_t));
+  /* If profiling is enabled, the keys for profiling */
+#  if defined(PARSEC_PROF_TRACE)
+  __parsec_tp->super.super.profiling_array = merge_sort_profiling_array;
+  if( -2 == merge_sort_profiling_array[0] ) {
+    #if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+parsec_profiling_add_dictionary_keyword("merge_sort::RESULT::internal init", "fill:34D8D8",
+                                       0,
+                                       NULL,
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(merge_sort_RESULT.task_class_id  + PARSEC_merge_sort_NB_TASK_CLASSES)/* RESULT (internal init) start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(merge_sort_RESULT.task_class_id  + PARSEC_merge_sort_NB_TASK_CLASSES)/* RESULT (internal init) end key */]);
+#endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+parsec_profiling_add_dictionary_keyword("merge_sort::RESULT", "fill:CC2828",
+                                       sizeof(parsec_task_prof_info_t)+2*sizeof(parsec_assignment_t),
+                                       "dc_key{uint64_t};priority{int32_t};dc_dataid{uint32_t};tcid{uint32_t};trc{int32_t};j{int32_t};h{int32_t}",
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(merge_sort_RESULT.task_class_id) /* RESULT start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(merge_sort_RESULT.task_class_id) /* RESULT end key */]);
+
+    #if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+parsec_profiling_add_dictionary_keyword("merge_sort::REDUCE::internal init", "fill:8634D8",
+                                       0,
+                                       NULL,
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(merge_sort_REDUCE.task_class_id  + PARSEC_merge_sort_NB_TASK_CLASSES)/* REDUCE (internal init) start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(merge_sort_REDUCE.task_class_id  + PARSEC_merge_sort_NB_TASK_CLASSES)/* REDUCE (internal init) end key */]);
+#endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+parsec_profiling_add_dictionary_keyword("merge_sort::REDUCE", "fill:7ACC28",
+                                       sizeof(parsec_task_prof_info_t)+8*sizeof(parsec_assignment_t),
+                                       "dc_key{uint64_t};priority{int32_t};dc_dataid{uint32_t};tcid{uint32_t};trc{int32_t};h{int32_t};lvl{int32_t};width{int32_t};i{int32_t};prnt_width{int32_t};A_data_size{int32_t};B_data_size{int32_t};data_size{int32_t}",
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(merge_sort_REDUCE.task_class_id) /* REDUCE start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(merge_sort_REDUCE.task_class_id) /* REDUCE end key */]);
+
+    #if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+parsec_profiling_add_dictionary_keyword("merge_sort::SORT::internal init", "fill:D83434",
+                                       0,
+                                       NULL,
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(merge_sort_SORT.task_class_id  + PARSEC_merge_sort_NB_TASK_CLASSES)/* SORT (internal init) start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(merge_sort_SORT.task_class_id  + PARSEC_merge_sort_NB_TASK_CLASSES)/* SORT (internal init) end key */]);
+#endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+parsec_profiling_add_dictionary_keyword("merge_sort::SORT", "fill:28CCCC",
+                                       sizeof(parsec_task_prof_info_t)+1*sizeof(parsec_assignment_t),
+                                       "dc_key{uint64_t};priority{int32_t};dc_dataid{uint32_t};tcid{uint32_t};trc{int32_t};i{int32_t}",
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(merge_sort_SORT.task_class_id) /* SORT start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(merge_sort_SORT.task_class_id) /* SORT end key */]);
+
+    #if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+parsec_profiling_add_dictionary_keyword("merge_sort::INIT_DATA::internal init", "fill:86D834",
+                                       0,
+                                       NULL,
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(merge_sort_INIT_DATA.task_class_id  + PARSEC_merge_sort_NB_TASK_CLASSES)/* INIT_DATA (internal init) start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(merge_sort_INIT_DATA.task_class_id  + PARSEC_merge_sort_NB_TASK_CLASSES)/* INIT_DATA (internal init) end key */]);
+#endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+parsec_profiling_add_dictionary_keyword("merge_sort::INIT_DATA", "fill:7A28CC",
+                                       sizeof(parsec_task_prof_info_t)+1*sizeof(parsec_assignment_t),
+                                       "dc_key{uint64_t};priority{int32_t};dc_dataid{uint32_t};tcid{uint32_t};trc{int32_t};i{int32_t}",
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(merge_sort_INIT_DATA.task_class_id) /* INIT_DATA start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(merge_sort_INIT_DATA.task_class_id) /* INIT_DATA end key */]);
+
+  }
+#  endif /* defined(PARSEC_PROF_TRACE) */
+  __parsec_tp->super.super.repo_array = __parsec_tp->repositories;
+  __parsec_tp->super.super.startup_hook = (parsec_startup_fn_t)merge_sort_startup;
+  (void)parsec_taskpool_reserve_id((parsec_taskpool_t*)__parsec_tp);
+}
+
+  /** Generate class declaration and instance using the above constructor and destructor */
+  PARSEC_OBJ_CLASS_DECLARATION(__parsec_merge_sort_internal_taskpool_t);
+  PARSEC_OBJ_CLASS_INSTANCE(__parsec_merge_sort_internal_taskpool_t, parsec_merge_sort_taskpool_t,
+                            __parsec_merge_sort_internal_constructor, __parsec_merge_sort_internal_destructor);
+
+#undef dataA
+#undef NB
+#undef NT
+
+parsec_merge_sort_taskpool_t *parsec_merge_sort_new(parsec_tiled_matrix_t * dataA /* data dataA */, int NB, int NT)
+{
+  __parsec_merge_sort_internal_taskpool_t *__parsec_tp = PARSEC_OBJ_NEW(__parsec_merge_sort_internal_taskpool_t);
+  /* Dump the hidden parameters with default values */
+
+  /* Now the Parameter-dependent structures: */
+  __parsec_tp->super._g_dataA = dataA;
+  __parsec_tp->super._g_NB = NB;
+  __parsec_tp->super._g_NT = NT;
+  PARSEC_AYU_REGISTER_TASK(&merge_sort_RESULT);
+  PARSEC_AYU_REGISTER_TASK(&merge_sort_REDUCE);
+  PARSEC_AYU_REGISTER_TASK(&merge_sort_SORT);
+  PARSEC_AYU_REGISTER_TASK(&merge_sort_INIT_DATA);
+  __parsec_tp->super.super.startup_hook = (parsec_startup_fn_t)merge_sort_startup;
+  (void)parsec_taskpool_reserve_id((parsec_taskpool_t*)__parsec_tp);
+/* Prevent warnings related to not used hidden global variables */
+;
+  return (parsec_merge_sort_taskpool_t*)__parsec_tp;
+}
+
+PARSEC_OBJ_CLASS_INSTANCE(parsec_merge_sort_taskpool_t, parsec_taskpool_t, NULL, NULL);
+
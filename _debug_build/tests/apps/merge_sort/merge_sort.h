@@ -0,0 +1,157 @@
+#ifndef _merge_sort_h_
+#define _merge_sort_h_
+#include "parsec.h"
+#include "parsec/parsec_internal.h"
+#include "parsec/remote_dep.h"
+
+BEGIN_C_DECLS
+
+#define PARSEC_merge_sort_DEFAULT_ADT_IDX    0
+#define PARSEC_merge_sort_ADT_IDX_MAX       1
+typedef struct parsec_merge_sort_taskpool_s {
+  parsec_taskpool_t super;
+  /* The list of globals */
+  parsec_tiled_matrix_t * _g_dataA /* data dataA */;
+  int _g_NB;
+  int _g_NT;
+  /* The array of datatypes (DEFAULT and co.) */
+  parsec_arena_datatype_t arenas_datatypes[PARSEC_merge_sort_ADT_IDX_MAX];
+  uint32_t arenas_datatypes_size;
+} parsec_merge_sort_taskpool_t;
+
+/** Beware that this object is not a superset of the internal object, and as a result
+ *  we should never create one directly. Instead we should rely on the creation of the
+ *  internal object (__parsec_merge_sort_taskpool_t).
+ */
+PARSEC_OBJ_CLASS_DECLARATION(parsec_merge_sort_taskpool_t);
+extern parsec_merge_sort_taskpool_t *parsec_merge_sort_new(parsec_tiled_matrix_t * _g_dataA /* data dataA */, int _g_NB, int _g_NT);
+
+#if MAX_LOCAL_COUNT < 2  /* number of parameters and locals RESULT */
+  #error Too many parameters and local variables (2 out of MAX_LOCAL_COUNT) for task RESULT
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_merge_sort_RESULT_assignment_s {
+  parsec_assignment_t j;
+  parsec_assignment_t h;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-2];
+} __parsec_merge_sort_RESULT_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 1  /* total number of flows for task RESULT */
+  #error Too many flows (1 out of MAX_PARAM_COUNT) for task RESULT
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_merge_sort_RESULT_data_s {
+  parsec_data_pair_t _f_C;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-1];
+} __parsec_merge_sort_RESULT_data_t;
+
+typedef struct __parsec_merge_sort_RESULT_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_merge_sort_RESULT_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_merge_sort_RESULT_data_s data;
+} __parsec_merge_sort_RESULT_task_t;
+
+
+#if MAX_LOCAL_COUNT < 8  /* number of parameters and locals REDUCE */
+  #error Too many parameters and local variables (8 out of MAX_LOCAL_COUNT) for task REDUCE
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_merge_sort_REDUCE_assignment_s {
+  parsec_assignment_t h;
+  parsec_assignment_t lvl;
+  parsec_assignment_t width;
+  parsec_assignment_t i;
+  parsec_assignment_t prnt_width;
+  parsec_assignment_t A_data_size;
+  parsec_assignment_t B_data_size;
+  parsec_assignment_t data_size;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-8];
+} __parsec_merge_sort_REDUCE_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 3  /* total number of flows for task REDUCE */
+  #error Too many flows (3 out of MAX_PARAM_COUNT) for task REDUCE
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_merge_sort_REDUCE_data_s {
+  parsec_data_pair_t _f_C;
+  parsec_data_pair_t _f_A;
+  parsec_data_pair_t _f_B;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-3];
+} __parsec_merge_sort_REDUCE_data_t;
+
+typedef struct __parsec_merge_sort_REDUCE_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_merge_sort_REDUCE_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_merge_sort_REDUCE_data_s data;
+} __parsec_merge_sort_REDUCE_task_t;
+
+
+#if MAX_LOCAL_COUNT < 1  /* number of parameters and locals SORT */
+  #error Too many parameters and local variables (1 out of MAX_LOCAL_COUNT) for task SORT
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_merge_sort_SORT_assignment_s {
+  parsec_assignment_t i;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-1];
+} __parsec_merge_sort_SORT_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 1  /* total number of flows for task SORT */
+  #error Too many flows (1 out of MAX_PARAM_COUNT) for task SORT
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_merge_sort_SORT_data_s {
+  parsec_data_pair_t _f_A;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-1];
+} __parsec_merge_sort_SORT_data_t;
+
+typedef struct __parsec_merge_sort_SORT_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_merge_sort_SORT_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_merge_sort_SORT_data_s data;
+} __parsec_merge_sort_SORT_task_t;
+
+
+#if MAX_LOCAL_COUNT < 1  /* number of parameters and locals INIT_DATA */
+  #error Too many parameters and local variables (1 out of MAX_LOCAL_COUNT) for task INIT_DATA
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_merge_sort_INIT_DATA_assignment_s {
+  parsec_assignment_t i;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-1];
+} __parsec_merge_sort_INIT_DATA_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 1  /* total number of flows for task INIT_DATA */
+  #error Too many flows (1 out of MAX_PARAM_COUNT) for task INIT_DATA
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_merge_sort_INIT_DATA_data_s {
+  parsec_data_pair_t _f_A;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-1];
+} __parsec_merge_sort_INIT_DATA_data_t;
+
+typedef struct __parsec_merge_sort_INIT_DATA_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_merge_sort_INIT_DATA_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_merge_sort_INIT_DATA_data_s data;
+} __parsec_merge_sort_INIT_DATA_task_t;
+
+
+END_C_DECLS
+
+#endif /* _merge_sort_h_ */ 
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bw_test.dir/bandwidth.c.o"
+  "CMakeFiles/bw_test.dir/bandwidth.c.o.d"
+  "bw_test"
+  "bw_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/bw_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ptgpp_bw_test.bandwidth"
+  "bandwidth.c"
+  "bandwidth.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ptgpp_bw_test.bandwidth.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
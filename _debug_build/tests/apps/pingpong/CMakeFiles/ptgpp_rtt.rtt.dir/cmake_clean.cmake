@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ptgpp_rtt.rtt"
+  "rtt.c"
+  "rtt.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ptgpp_rtt.rtt.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
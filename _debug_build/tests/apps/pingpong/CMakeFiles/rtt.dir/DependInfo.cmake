@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/apps/pingpong/main.c" "tests/apps/pingpong/CMakeFiles/rtt.dir/main.c.o" "gcc" "tests/apps/pingpong/CMakeFiles/rtt.dir/main.c.o.d"
+  "/root/repo/_debug_build/tests/apps/pingpong/rtt.c" "tests/apps/pingpong/CMakeFiles/rtt.dir/rtt.c.o" "gcc" "tests/apps/pingpong/CMakeFiles/rtt.dir/rtt.c.o.d"
+  "/root/repo/tests/apps/pingpong/rtt_data.c" "tests/apps/pingpong/CMakeFiles/rtt.dir/rtt_data.c.o" "gcc" "tests/apps/pingpong/CMakeFiles/rtt.dir/rtt_data.c.o.d"
+  "/root/repo/tests/apps/pingpong/rtt_wrapper.c" "tests/apps/pingpong/CMakeFiles/rtt.dir/rtt_wrapper.c.o" "gcc" "tests/apps/pingpong/CMakeFiles/rtt.dir/rtt_wrapper.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_debug_build/parsec/CMakeFiles/parsec.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "/root/repo/_debug_build/parsec/include/fortran")
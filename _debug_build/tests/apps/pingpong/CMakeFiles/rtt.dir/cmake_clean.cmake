@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rtt.dir/main.c.o"
+  "CMakeFiles/rtt.dir/main.c.o.d"
+  "CMakeFiles/rtt.dir/rtt.c.o"
+  "CMakeFiles/rtt.dir/rtt.c.o.d"
+  "CMakeFiles/rtt.dir/rtt_data.c.o"
+  "CMakeFiles/rtt.dir/rtt_data.c.o.d"
+  "CMakeFiles/rtt.dir/rtt_wrapper.c.o"
+  "CMakeFiles/rtt.dir/rtt_wrapper.c.o.d"
+  "rtt"
+  "rtt.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/rtt.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,3129 @@
+#include "parsec.h"
+#include "parsec/parsec_internal.h"
+#include "parsec/ayudame.h"
+#include "parsec/execution_stream.h"
+#include "parsec/parsec_binary_profile.h"
+#include "parsec/mca/device/device_gpu.h"
+#if defined(PARSEC_HAVE_DEV_CUDA_SUPPORT)
+#include "parsec/mca/device/cuda/device_cuda.h"
+#endif  /* defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) */
+#if defined(PARSEC_HAVE_DEV_HIP_SUPPORT)
+#include "parsec/mca/device/hip/device_hip.h"
+#endif  /* defined(PARSEC_HAVE_DEV_HIP_SUPPORT) */
+#if defined(_MSC_VER) || defined(__MINGW32__)
+#  include <malloc.h>
+#else
+#  include <alloca.h>
+#endif  /* defined(_MSC_VER) || defined(__MINGW32__) */
+
+#define PARSEC_bandwidth_NB_TASK_CLASSES 3
+#define PARSEC_bandwidth_NB_DATA 2
+
+typedef struct __parsec_bandwidth_internal_taskpool_s __parsec_bandwidth_internal_taskpool_t;
+struct parsec_bandwidth_internal_taskpool_s;
+
+/** Predeclarations of the parsec_task_class_t */
+static const parsec_task_class_t bandwidth_PONG;
+static const parsec_task_class_t bandwidth_PING;
+static const parsec_task_class_t bandwidth_SYNC;
+/** Predeclarations of the parameters */
+static const parsec_flow_t flow_of_bandwidth_PONG_for_T;
+static const parsec_flow_t flow_of_bandwidth_PONG_for_C;
+static const parsec_flow_t flow_of_bandwidth_PING_for_T;
+static const parsec_flow_t flow_of_bandwidth_PING_for_C;
+static const parsec_flow_t flow_of_bandwidth_SYNC_for_C;
+/*
+ * Copyright (c) 2019-2021 The University of Tennessee and The University
+ *                         of Tennessee Research Foundation. All rights
+ *                         reserved.
+ */
+
+/* includes parsec headers */
+#include <parsec.h>
+#include <parsec/data_dist/matrix/two_dim_rectangle_cyclic.h>
+#include <parsec/data_dist/matrix/matrix.h>
+
+/* system and io */
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/time.h>
+
+#if defined(PARSEC_HAVE_MPI)
+#include <mpi.h>
+#endif
+
+#define PARSEC_bandwidth_DEFAULT_ADT    (&__parsec_tp->super.arenas_datatypes[PARSEC_bandwidth_DEFAULT_ADT_IDX])
+#include "bandwidth.h"
+
+struct __parsec_bandwidth_internal_taskpool_s {
+ parsec_bandwidth_taskpool_t super;
+ volatile int32_t sync_point;
+ volatile int32_t initial_number_tasks;
+ parsec_task_t* startup_queue;
+  /* The ranges to compute the hash key */
+  int PONG_t_min;
+  int PONG_t_range;
+  int PONG_f_min;
+  int PONG_f_range;
+  int PING_t_min;
+  int PING_t_range;
+  int PING_f_min;
+  int PING_f_range;
+  int SYNC_t_min;
+  int SYNC_t_range;
+  /* The list of data repositories  PONG  PING */
+  data_repo_t* repositories[3];
+};
+
+#if defined(PARSEC_PROF_TRACE)
+#  if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+static int bandwidth_profiling_array[4*PARSEC_bandwidth_NB_TASK_CLASSES] = {-2}; /* 2 pairs (begin, end) per task, times two because each task class has an internal_init task */
+#  else /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+static int bandwidth_profiling_array[2*PARSEC_bandwidth_NB_TASK_CLASSES] = {-2}; /* 2 pairs (begin, end) per task */
+#  endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+#endif  /* defined(PARSEC_PROF_TRACE) */
+/* Globals */
+#define descA __parsec_tp->super._g_descA
+#define Disk __parsec_tp->super._g_Disk
+#define loops (__parsec_tp->super._g_loops)
+#define frags (__parsec_tp->super._g_frags)
+#define ws (__parsec_tp->super._g_ws)
+
+static inline int parsec_imin(int a, int b) { return (a <= b) ? a : b; };
+
+static inline int parsec_imax(int a, int b) { return (a >= b) ? a : b; };
+
+/* Data Access Macros */
+#define data_of_descA(descA_d0, descA_d1)  (((parsec_data_collection_t*)__parsec_tp->super._g_descA)->data_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, (descA_d0), (descA_d1)))
+#define data_of_Disk(Disk_d0, Disk_d1)  (((parsec_data_collection_t*)__parsec_tp->super._g_Disk)->data_of((parsec_data_collection_t*)__parsec_tp->super._g_Disk, (Disk_d0), (Disk_d1)))
+
+#define rank_of_descA(descA_d0, descA_d1)  (((parsec_data_collection_t*)__parsec_tp->super._g_descA)->rank_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, (descA_d0), (descA_d1)))
+#define rank_of_Disk(Disk_d0, Disk_d1)  (((parsec_data_collection_t*)__parsec_tp->super._g_Disk)->rank_of((parsec_data_collection_t*)__parsec_tp->super._g_Disk, (Disk_d0), (Disk_d1)))
+
+/* Functions Predicates */
+#define PONG_pred(t, f) (((parsec_data_collection_t*)(__parsec_tp->super._g_Disk))->myrank == rank_of_Disk(0, ((t + 1) % ws)))
+#define PING_pred(t, f) (((parsec_data_collection_t*)(__parsec_tp->super._g_Disk))->myrank == rank_of_Disk(0, (t % ws)))
+#define SYNC_pred(t) (((parsec_data_collection_t*)(__parsec_tp->super._g_Disk))->myrank == rank_of_Disk(0, (t % ws)))
+
+/* Data Repositories */
+#define PONG_repo (__parsec_tp->repositories[2])
+#define PING_repo (__parsec_tp->repositories[1])
+#define SYNC_repo (__parsec_tp->repositories[0])
+/* Release dependencies output macro */
+#if defined(PARSEC_DEBUG_NOISIER)
+#define RELEASE_DEP_OUTPUT(ES, DEPO, TASKO, DEPI, TASKI, RSRC, RDST, DATA)\
+  do { \
+    char tmp1[128], tmp2[128]; (void)tmp1; (void)tmp2;\
+    PARSEC_DEBUG_VERBOSE(20, parsec_debug_output, "thread %d VP %d explore deps from %s:%s to %s:%s (from rank %d to %d) base ptr %p",\
+           (NULL != (ES) ? (ES)->th_id : -1), (NULL != (ES) ? (ES)->virtual_process->vp_id : -1),\
+           DEPO, parsec_task_snprintf(tmp1, 128, (parsec_task_t*)(TASKO)),\
+           DEPI, parsec_task_snprintf(tmp2, 128, (parsec_task_t*)(TASKI)), (RSRC), (RDST), (DATA));\
+  } while(0)
+#define ACQUIRE_FLOW(TASKI, DEPI, FUNO, DEPO, LOCALS, PTR)\
+  do { \
+    char tmp1[128], tmp2[128]; (void)tmp1; (void)tmp2;\
+    PARSEC_DEBUG_VERBOSE(20, parsec_debug_output, "task %s acquires flow %s from %s %s data ptr %p",\
+           parsec_task_snprintf(tmp1, 128, (parsec_task_t*)(TASKI)), (DEPI),\
+           (DEPO), parsec_snprintf_assignments(tmp2, 128, (FUNO), (parsec_assignment_t*)(LOCALS)), (PTR));\
+  } while(0)
+#else
+#define RELEASE_DEP_OUTPUT(ES, DEPO, TASKO, DEPI, TASKI, RSRC, RDST, DATA)
+#define ACQUIRE_FLOW(TASKI, DEPI, TASKO, DEPO, LOCALS, PTR)
+#endif
+static inline parsec_key_t __jdf2c_make_key_PONG(const parsec_taskpool_t *tp, const parsec_assignment_t *as)
+{
+  const __parsec_bandwidth_internal_taskpool_t *__parsec_tp = (const __parsec_bandwidth_internal_taskpool_t *)tp;
+  const __parsec_bandwidth_PONG_parsec_assignment_t *assignment = (const __parsec_bandwidth_PONG_parsec_assignment_t*)as;
+  uint64_t __parsec_id = 0;
+  __parsec_id += (assignment->t.value - __parsec_tp->PONG_t_min);
+  __parsec_id += (assignment->f.value - __parsec_tp->PONG_f_min) * __parsec_tp->PONG_t_range;
+  return (parsec_key_t)__parsec_id;
+}
+static char *__jdf2c_key_fns_PONG_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_bandwidth_internal_taskpool_t *__parsec_tp = (__parsec_bandwidth_internal_taskpool_t *)user_data;
+  int t = (__parsec_key) % __parsec_tp->PONG_t_range + __parsec_tp->PONG_t_min;
+  __parsec_key = __parsec_key / __parsec_tp->PONG_t_range;
+  int f = (__parsec_key) % __parsec_tp->PONG_f_range + __parsec_tp->PONG_f_min;
+  __parsec_key = __parsec_key / __parsec_tp->PONG_f_range;
+  snprintf(buffer, buffer_size, "PONG(%d, %d)", t, f);
+  return buffer;
+}
+
+static parsec_key_fn_t __jdf2c_key_fns_PONG = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = __jdf2c_key_fns_PONG_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+static inline parsec_key_t __jdf2c_make_key_PING(const parsec_taskpool_t *tp, const parsec_assignment_t *as)
+{
+  const __parsec_bandwidth_internal_taskpool_t *__parsec_tp = (const __parsec_bandwidth_internal_taskpool_t *)tp;
+  const __parsec_bandwidth_PING_parsec_assignment_t *assignment = (const __parsec_bandwidth_PING_parsec_assignment_t*)as;
+  uint64_t __parsec_id = 0;
+  __parsec_id += (assignment->t.value - __parsec_tp->PING_t_min);
+  __parsec_id += (assignment->f.value - __parsec_tp->PING_f_min) * __parsec_tp->PING_t_range;
+  return (parsec_key_t)__parsec_id;
+}
+static char *__jdf2c_key_fns_PING_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_bandwidth_internal_taskpool_t *__parsec_tp = (__parsec_bandwidth_internal_taskpool_t *)user_data;
+  int t = (__parsec_key) % __parsec_tp->PING_t_range + __parsec_tp->PING_t_min;
+  __parsec_key = __parsec_key / __parsec_tp->PING_t_range;
+  int f = (__parsec_key) % __parsec_tp->PING_f_range + __parsec_tp->PING_f_min;
+  __parsec_key = __parsec_key / __parsec_tp->PING_f_range;
+  snprintf(buffer, buffer_size, "PING(%d, %d)", t, f);
+  return buffer;
+}
+
+static parsec_key_fn_t __jdf2c_key_fns_PING = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = __jdf2c_key_fns_PING_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+static inline parsec_key_t __jdf2c_make_key_SYNC(const parsec_taskpool_t *tp, const parsec_assignment_t *as)
+{
+  const __parsec_bandwidth_internal_taskpool_t *__parsec_tp = (const __parsec_bandwidth_internal_taskpool_t *)tp;
+  const __parsec_bandwidth_SYNC_parsec_assignment_t *assignment = (const __parsec_bandwidth_SYNC_parsec_assignment_t*)as;
+  uint64_t __parsec_id = 0;
+  __parsec_id += (assignment->t.value - __parsec_tp->SYNC_t_min);
+  return (parsec_key_t)__parsec_id;
+}
+static char *__jdf2c_key_fns_SYNC_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_bandwidth_internal_taskpool_t *__parsec_tp = (__parsec_bandwidth_internal_taskpool_t *)user_data;
+  int t = (__parsec_key) % __parsec_tp->SYNC_t_range + __parsec_tp->SYNC_t_min;
+  __parsec_key = __parsec_key / __parsec_tp->SYNC_t_range;
+  snprintf(buffer, buffer_size, "SYNC(%d)", t);
+  return buffer;
+}
+
+static parsec_key_fn_t __jdf2c_key_fns_SYNC = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = __jdf2c_key_fns_SYNC_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/******                                      PONG                                      ******/
+
+static inline int32_t minexpr_of_symb_bandwidth_PONG_t_fct(const __parsec_bandwidth_internal_taskpool_t *__parsec_tp, const __parsec_bandwidth_PONG_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_bandwidth_PONG_t = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_bandwidth_PONG_t_fct }
+                   }
+};
+static inline int maxexpr_of_symb_bandwidth_PONG_t_fct(const __parsec_bandwidth_internal_taskpool_t *__parsec_tp, const __parsec_bandwidth_PONG_parsec_assignment_t *locals)
+{
+  const int t = locals->t.value; (void)t;
+  const int f = locals->f.value; (void)f;
+
+  (void)t;
+  (void)f;
+  (void)__parsec_tp; (void)locals;
+  return (loops - 1);
+}
+static const parsec_expr_t maxexpr_of_symb_bandwidth_PONG_t = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_bandwidth_PONG_t_fct }
+                   }
+};
+static const parsec_symbol_t symb_bandwidth_PONG_t = { .name = "t", .context_index = 0, .min = &minexpr_of_symb_bandwidth_PONG_t, .max = &maxexpr_of_symb_bandwidth_PONG_t, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int32_t minexpr_of_symb_bandwidth_PONG_f_fct(const __parsec_bandwidth_internal_taskpool_t *__parsec_tp, const __parsec_bandwidth_PONG_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_bandwidth_PONG_f = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_bandwidth_PONG_f_fct }
+                   }
+};
+static inline int maxexpr_of_symb_bandwidth_PONG_f_fct(const __parsec_bandwidth_internal_taskpool_t *__parsec_tp, const __parsec_bandwidth_PONG_parsec_assignment_t *locals)
+{
+  const int t = locals->t.value; (void)t;
+  const int f = locals->f.value; (void)f;
+
+  (void)t;
+  (void)f;
+  (void)__parsec_tp; (void)locals;
+  return (frags - 1);
+}
+static const parsec_expr_t maxexpr_of_symb_bandwidth_PONG_f = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_bandwidth_PONG_f_fct }
+                   }
+};
+static const parsec_symbol_t symb_bandwidth_PONG_f = { .name = "f", .context_index = 1, .min = &minexpr_of_symb_bandwidth_PONG_f, .max = &maxexpr_of_symb_bandwidth_PONG_f, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int affinity_of_bandwidth_PONG(const __parsec_bandwidth_PONG_task_t *this_task,
+                     parsec_data_ref_t *ref)
+{
+    const __parsec_bandwidth_internal_taskpool_t *__parsec_tp = (const __parsec_bandwidth_internal_taskpool_t*)this_task->taskpool;
+  const int t = this_task->locals.t.value; (void)t;
+  const int f = this_task->locals.f.value; (void)f;
+
+  /* Silent Warnings: should look into predicate to know what variables are usefull */
+  (void)t;
+  (void)f;
+  ref->dc = (parsec_data_collection_t *)__parsec_tp->super._g_Disk;
+  /* Compute data key */
+  ref->key = ref->dc->data_key(ref->dc, 0, ((t + 1) % ws));
+  return 1;
+}
+static const parsec_property_t properties_of_bandwidth_PONG[1] = {
+  {.name = NULL, .expr = NULL}
+};
+static const parsec_dep_t flow_of_bandwidth_PONG_for_T_dep1_atline_65 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 1, /* bandwidth_PING */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_bandwidth_PING_for_T,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_bandwidth_PONG_for_T,
+};
+static inline int expr_of_cond_for_flow_of_bandwidth_PONG_for_T_dep2_atline_66_fct(const __parsec_bandwidth_internal_taskpool_t *__parsec_tp, const __parsec_bandwidth_PONG_parsec_assignment_t *locals)
+{
+  const int t = locals->t.value; (void)t;
+  const int f = locals->f.value; (void)f;
+
+  (void)t;
+  (void)f;
+  (void)__parsec_tp; (void)locals;
+  return (t) < ((loops - 1));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_bandwidth_PONG_for_T_dep2_atline_66 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_bandwidth_PONG_for_T_dep2_atline_66_fct }
+                   }
+};
+static const parsec_dep_t flow_of_bandwidth_PONG_for_T_dep2_atline_66 = {
+  .cond = &expr_of_cond_for_flow_of_bandwidth_PONG_for_T_dep2_atline_66,  /* (t) < ((loops - 1)) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 1, /* bandwidth_PING */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_bandwidth_PING_for_T,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_bandwidth_PONG_for_T,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+#if MAX_DEP_OUT_COUNT < 1  /* number of output dependencies */
+    #error Too many output dependencies (supports up to MAX_DEP_OUT_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_OUT_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_bandwidth_PONG_for_T = {
+  .name               = "T",
+  .sym_type           = PARSEC_SYM_INOUT,
+  .flow_flags         = PARSEC_FLOW_ACCESS_RW,
+  .flow_index         = 0,
+  .flow_datatype_mask = 0x1,
+  .dep_in     = { &flow_of_bandwidth_PONG_for_T_dep1_atline_65 },
+  .dep_out    = { &flow_of_bandwidth_PONG_for_T_dep2_atline_66 }
+};
+
+static const parsec_dep_t flow_of_bandwidth_PONG_for_C_dep1_atline_67 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 0, /* bandwidth_SYNC */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_bandwidth_SYNC_for_C,
+  .dep_index = 1,
+  .dep_datatype_index = 1,
+  .belongs_to = &flow_of_bandwidth_PONG_for_C,
+};
+#if MAX_DEP_OUT_COUNT < 1  /* number of output dependencies */
+    #error Too many output dependencies (supports up to MAX_DEP_OUT_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_OUT_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_bandwidth_PONG_for_C = {
+  .name               = "C",
+  .sym_type           = PARSEC_SYM_OUT,
+  .flow_flags         = PARSEC_FLOW_ACCESS_NONE,
+  .flow_index         = 1,
+  .flow_datatype_mask = 0x2,
+  .dep_in     = { NULL },
+  .dep_out    = { &flow_of_bandwidth_PONG_for_C_dep1_atline_67 }
+};
+
+static void
+iterate_successors_of_bandwidth_PONG(parsec_execution_stream_t *es, const __parsec_bandwidth_PONG_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_bandwidth_internal_taskpool_t *__parsec_tp = (const __parsec_bandwidth_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_bandwidth_PONG_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_bandwidth_PONG_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int t = __jdf2c__tmp_locals.t.value; (void)t;
+  const int f = __jdf2c__tmp_locals.f.value; (void)f;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)t;  (void)f;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_Disk(0, ((t + 1) % ws));
+#endif
+  if( action_mask & 0x1 ) {  /* Flow of data T [0] */
+    data.data   = this_task->data._f_T.data_out;
+    data.data_future  = NULL;
+    if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_bandwidth_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_bandwidth_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+       if( (t) < ((loops - 1)) ) {
+      __parsec_bandwidth_PING_task_t* ncc = (__parsec_bandwidth_PING_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[bandwidth_PING.task_class_id];
+        const int PING_t = (t + 1);
+        if( (PING_t >= (0)) && (PING_t <= ((loops - 1))) ) {
+          assert(&nc.locals[0].value == &ncc->locals.t.value);
+          ncc->locals.t.value = PING_t;
+          const int PING_f = f;
+          if( (PING_f >= (0)) && (PING_f <= ((frags - 1))) ) {
+            assert(&nc.locals[1].value == &ncc->locals.f.value);
+            ncc->locals.f.value = PING_f;
+#if defined(DISTRIBUTED)
+            rank_dst = rank_of_Disk(0, (ncc->locals.t.value % ws));
+            if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+              vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_Disk)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_Disk, 0, (ncc->locals.t.value % ws));
+            nc.priority = __parsec_tp->super.super.priority;
+            successor_repo = PING_repo;
+            successor_repo_key = __jdf2c_make_key_PING((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+          RELEASE_DEP_OUTPUT(es, "T", this_task, "T", &nc, rank_src, rank_dst, &data);
+          if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_bandwidth_PONG_for_T_dep2_atline_66, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+            }
+          }
+    }
+  }
+  if( action_mask & 0x2 ) {  /* Flow of data C [1] */
+    data.data   = this_task->data._f_C.data_out;
+    data.data_future  = NULL;
+    if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  =   /* Control: always empty */ 0;
+    data.local.dst_count  =   /* Control: always empty */ 0;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = NULL;
+    data.remote.src_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.src_count  =   /* Control: always empty */ 0;
+    data.remote.dst_count  =   /* Control: always empty */ 0;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+       __parsec_bandwidth_SYNC_task_t* ncc = (__parsec_bandwidth_SYNC_task_t*)&nc;
+    nc.task_class = __parsec_tp->super.super.task_classes_array[bandwidth_SYNC.task_class_id];
+      const int SYNC_t = (t + 1);
+      if( (SYNC_t >= (0)) && (SYNC_t <= ((loops - 1))) ) {
+        assert(&nc.locals[0].value == &ncc->locals.t.value);
+        ncc->locals.t.value = SYNC_t;
+#if defined(DISTRIBUTED)
+        rank_dst = rank_of_Disk(0, (ncc->locals.t.value % ws));
+        if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+          vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_Disk)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_Disk, 0, (ncc->locals.t.value % ws));
+        nc.priority = __parsec_tp->super.super.priority;
+        successor_repo = SYNC_repo;
+        successor_repo_key = __jdf2c_make_key_SYNC((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+      RELEASE_DEP_OUTPUT(es, "C", this_task, "C", &nc, rank_src, rank_dst, &data);
+      if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_bandwidth_PONG_for_C_dep1_atline_67, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+        }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static void
+iterate_predecessors_of_bandwidth_PONG(parsec_execution_stream_t *es, const __parsec_bandwidth_PONG_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_bandwidth_internal_taskpool_t *__parsec_tp = (const __parsec_bandwidth_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_bandwidth_PONG_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_bandwidth_PONG_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int t = __jdf2c__tmp_locals.t.value; (void)t;
+  const int f = __jdf2c__tmp_locals.f.value; (void)f;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)t;  (void)f;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_Disk(0, ((t + 1) % ws));
+#endif
+  if( action_mask & 0x1 ) {  /* Flow of data T [0] */
+    data.data   = this_task->data._f_T.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x1 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_bandwidth_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_bandwidth_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        __parsec_bandwidth_PING_task_t* ncc = (__parsec_bandwidth_PING_task_t*)&nc;
+    nc.task_class = __parsec_tp->super.super.task_classes_array[bandwidth_PING.task_class_id];
+      const int PING_t = t;
+      if( (PING_t >= (0)) && (PING_t <= ((loops - 1))) ) {
+        assert(&nc.locals[0].value == &ncc->locals.t.value);
+        ncc->locals.t.value = PING_t;
+        const int PING_f = f;
+        if( (PING_f >= (0)) && (PING_f <= ((frags - 1))) ) {
+          assert(&nc.locals[1].value == &ncc->locals.f.value);
+          ncc->locals.f.value = PING_f;
+#if defined(DISTRIBUTED)
+          rank_dst = rank_of_Disk(0, (ncc->locals.t.value % ws));
+          if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+            vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_Disk)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_Disk, 0, (ncc->locals.t.value % ws));
+          nc.priority = __parsec_tp->super.super.priority;
+          successor_repo = PING_repo;
+          successor_repo_key = __jdf2c_make_key_PING((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+        RELEASE_DEP_OUTPUT(es, "T", this_task, "T", &nc, rank_src, rank_dst, &data);
+        if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_bandwidth_PONG_for_T_dep1_atline_65, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+          }
+        }
+  }
+  }
+  /* Flow of data C has only IN dependencies */
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static int release_deps_of_bandwidth_PONG(parsec_execution_stream_t *es, __parsec_bandwidth_PONG_task_t *this_task, uint32_t action_mask, parsec_remote_deps_t *deps)
+{
+  PARSEC_PINS(es, RELEASE_DEPS_BEGIN, (parsec_task_t *)this_task);  const __parsec_bandwidth_internal_taskpool_t *__parsec_tp = (const __parsec_bandwidth_internal_taskpool_t *)this_task->taskpool;
+  parsec_release_dep_fct_arg_t arg;
+  int __vp_id;
+  int consume_local_repo = 0;
+  arg.action_mask = action_mask;
+  arg.output_entry = NULL;
+  arg.output_repo = NULL;
+#if defined(DISTRIBUTED)
+  arg.remote_deps = deps;
+#endif  /* defined(DISTRIBUTED) */
+  assert(NULL != es);
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS )    arg.ready_lists = alloca(sizeof(parsec_task_t *) * es->virtual_process->parsec_context->nb_vp);
+  else
+    arg.ready_lists = NULL;
+  for( __vp_id = 0; __vp_id < es->virtual_process->parsec_context->nb_vp; arg.ready_lists[__vp_id++] = NULL );
+  (void)__parsec_tp; (void)deps;
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_T.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_T.source_repo, this_task->data._f_T.source_repo_entry->ht_item.key );
+    }
+  }
+  consume_local_repo = (this_task->repo_entry != NULL);
+  arg.output_repo = PONG_repo;
+  arg.output_entry = this_task->repo_entry;
+  arg.output_usage = 0;
+  if( action_mask & (PARSEC_ACTION_RELEASE_LOCAL_DEPS | PARSEC_ACTION_GET_REPO_ENTRY) ) {
+    arg.output_entry = data_repo_lookup_entry_and_create( es, arg.output_repo, __jdf2c_make_key_PONG((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    arg.output_entry->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(arg.output_entry->sim_exec_date == 0);
+    arg.output_entry->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  if(action_mask & ( PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE ) ){
+    /* Generate the reshape promise for the outputs that need it */
+    iterate_successors_of_bandwidth_PONG(es, this_task, action_mask, parsec_set_up_reshape_promise, &arg);
+   }
+  iterate_successors_of_bandwidth_PONG(es, this_task, action_mask, parsec_release_dep_fct, &arg);
+
+#if defined(DISTRIBUTED)
+  if( (action_mask & PARSEC_ACTION_SEND_REMOTE_DEPS) && (NULL != arg.remote_deps)) {
+    parsec_remote_dep_activate(es, (parsec_task_t *)this_task, arg.remote_deps, arg.remote_deps->outgoing_mask);
+  }
+#endif
+
+  if(action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS) {
+    data_repo_entry_addto_usage_limit(PONG_repo, arg.output_entry->ht_item.key, arg.output_usage);
+    __parsec_schedule_vp(es, arg.ready_lists, 0);
+  }
+      if (consume_local_repo) {
+         data_repo_entry_used_once( PONG_repo, this_task->repo_entry->ht_item.key );
+      }
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_T.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_T.data_in);
+    }
+  }
+  PARSEC_PINS(es, RELEASE_DEPS_END, (parsec_task_t *)this_task);  return 0;
+}
+
+static int data_lookup_of_bandwidth_PONG(parsec_execution_stream_t *es, __parsec_bandwidth_PONG_task_t *this_task)
+{
+  const __parsec_bandwidth_internal_taskpool_t *__parsec_tp = (__parsec_bandwidth_internal_taskpool_t *)this_task->taskpool;
+  parsec_assignment_t generic_locals[MAX_PARAM_COUNT];  /* generic task locals */
+  int target_device = 0; (void)target_device;
+  (void)__parsec_tp; (void)generic_locals; (void)es;
+  parsec_data_copy_t *chunk = NULL;
+  data_repo_t        *reshape_repo  = NULL, *consumed_repo  = NULL;
+  data_repo_entry_t  *reshape_entry = NULL, *consumed_entry = NULL;
+  parsec_key_t        reshape_entry_key = 0, consumed_entry_key = 0;
+  uint8_t             consumed_flow_index;
+  parsec_dep_data_description_t data;
+  int ret;
+  (void)reshape_repo; (void)reshape_entry; (void)reshape_entry_key;
+  (void)consumed_repo; (void)consumed_entry; (void)consumed_entry_key;
+  (void)consumed_flow_index;
+  (void)chunk; (void)data; (void)ret;
+  const int t = this_task->locals.t.value; (void)t;
+  const int f = this_task->locals.f.value; (void)f;
+  if( NULL == this_task->repo_entry ){
+    this_task->repo_entry = data_repo_lookup_entry_and_create(es, PONG_repo,                                       __jdf2c_make_key_PONG((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    data_repo_entry_addto_usage_limit(PONG_repo, this_task->repo_entry->ht_item.key, 1);    this_task->repo_entry ->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(this_task->repo_entry ->sim_exec_date == 0);
+    this_task->repo_entry ->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  /* The reshape repo is the current task repo. */  reshape_repo = PONG_repo;
+  reshape_entry_key = __jdf2c_make_key_PONG((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals) ;
+  reshape_entry = this_task->repo_entry;
+  /* Lookup the input data, and store them in the context if any */
+
+if(! this_task->data._f_T.fulfill ){ /* Flow T */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_T.data_out = NULL;  /* By default, if nothing matches */
+  /* Flow T [0] dependency [0] from predecessor PING */
+  if( NULL == (chunk = this_task->data._f_T.data_in) ) {
+  /* No data set up by predecessor on this task input flow */
+__parsec_bandwidth_PING_parsec_assignment_t *target_locals = (__parsec_bandwidth_PING_parsec_assignment_t*)&generic_locals;
+  const int PINGt = target_locals->t.value = t; (void)PINGt;
+  const int PINGf = target_locals->f.value = f; (void)PINGf;
+    if( (reshape_entry != NULL) && (reshape_entry->data[0] != NULL) ){
+        /* Reshape promise set up on this task repo by predecessor */
+        consumed_repo = reshape_repo;
+        consumed_entry = reshape_entry;
+        consumed_entry_key = reshape_entry_key;
+        consumed_flow_index = 0;
+    }else{
+        /* Consume from predecessor's repo */
+        consumed_repo = PING_repo;
+        consumed_entry_key = __jdf2c_make_key_PING((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)target_locals) ;
+        consumed_entry = data_repo_lookup_entry( consumed_repo, consumed_entry_key );
+        consumed_flow_index = 0;
+    }
+    data.data   = NULL;
+    data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+        data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    ACQUIRE_FLOW(this_task, "T", &bandwidth_PING, "T", target_locals, chunk);
+    this_task->data._f_T.data_out = chunk;
+  } 
+  else {
+    /* Data set up by predecessor on this task input flow */
+    consumed_repo = this_task->data._f_T.source_repo;
+    consumed_entry = this_task->data._f_T.source_repo_entry;
+    consumed_entry_key = this_task->data._f_T.source_repo_entry->ht_item.key;
+    if( (reshape_entry != NULL) && (reshape_entry->data[0] != NULL) ){
+        /* Reshape promise set up on input by predecessor is on this task repo */
+        consumed_flow_index = 0;
+        assert( (this_task->data._f_T.source_repo == reshape_repo)
+             && (this_task->data._f_T.source_repo_entry == reshape_entry));
+    }else{
+        /* Reshape promise set up on input by predecessor is the predecesssor task repo */
+        consumed_flow_index = 0;
+    }
+    data.data   = NULL;
+    data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+        data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    this_task->data._f_T.data_out = parsec_data_get_copy(chunk->original, target_device);
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+    parsec_prof_grapher_data_input(chunk->original, (parsec_task_t*)this_task, &flow_of_bandwidth_PONG_for_T, 0);
+#endif
+  }
+    this_task->data._f_T.data_in     = chunk;
+    this_task->data._f_T.source_repo       = consumed_repo;
+    this_task->data._f_T.source_repo_entry = consumed_entry;
+    if( this_task->data._f_T.source_repo_entry == this_task->repo_entry ){
+      /* in case we have consume from this task repo entry for the flow,
+       * it is cleaned up, avoiding having old stuff during release_deps_of
+       */
+      this_task->repo_entry->data[0] = NULL;
+    }
+    this_task->data._f_T.fulfill = 1;
+}
+
+  /* C is a control flow */
+  this_task->data._f_C.data_in         = NULL;
+  this_task->data._f_C.data_out        = NULL;
+  this_task->data._f_C.source_repo       = NULL;
+  this_task->data._f_C.source_repo_entry = NULL;
+  /** Generate profiling information */
+#if defined(PARSEC_PROF_TRACE)
+  this_task->prof_info.desc = (parsec_data_collection_t*)__parsec_tp->super._g_Disk;
+  this_task->prof_info.priority = this_task->priority;
+  this_task->prof_info.data_id   = ((parsec_data_collection_t*)__parsec_tp->super._g_Disk)->data_key((parsec_data_collection_t*)__parsec_tp->super._g_Disk, 0, ((t + 1) % ws));
+  this_task->prof_info.task_class_id = this_task->task_class->task_class_id;
+  this_task->prof_info.task_return_code = -1;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int datatype_lookup_of_bandwidth_PONG(parsec_execution_stream_t *es, const parsec_task_t *this_generic_task, const parsec_task_t *parent_task,
+              uint32_t* flow_mask, parsec_dep_data_description_t* data)
+{
+  const __parsec_bandwidth_PONG_task_t *this_task = (__parsec_bandwidth_PONG_task_t*)this_generic_task;
+  const __parsec_bandwidth_internal_taskpool_t *__parsec_tp = (__parsec_bandwidth_internal_taskpool_t *)this_task->taskpool;
+  (void)__parsec_tp; (void)es; (void)this_task; (void)data; (void)parent_task;
+  const int t = this_task->locals.t.value; (void)t;
+  const int f = this_task->locals.f.value; (void)f;
+  data->local.arena = data->remote.arena = NULL;
+  data->local.src_datatype  = data->local.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->local.src_count     = data->local.dst_count = 0;
+  data->local.src_displ     = data->local.dst_displ = 0;
+  data->data_future  = NULL;
+  if( (*flow_mask) & 0x80000000U ) { /* these are the input dependencies remote datatypes  */
+if( (*flow_mask) & 0x1U ) {  /* Flow T */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_bandwidth_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_bandwidth_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_bandwidth_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+    goto no_mask_match;
+  }
+
+  /* these are the output dependencies remote datatypes */
+if( (*flow_mask) & 0x1U ) {  /* Flow T */
+    if( ((*flow_mask) & 0x1U)
+ && ((t) < ((loops - 1))) ) {
+    data->remote.arena  =  PARSEC_bandwidth_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_bandwidth_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_bandwidth_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+ no_mask_match:
+  data->data                             = NULL;
+  data->remote.src_datatype = data->remote.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->remote.src_count    = data->remote.dst_count = 0;
+  data->remote.src_displ    = data->remote.dst_displ = 0;
+  data->data_future  = NULL;
+  (*flow_mask) = 0;  /* nothing left */
+  (void)t;  (void)f;
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+static int hook_of_bandwidth_PONG(parsec_execution_stream_t *es, __parsec_bandwidth_PONG_task_t *this_task)
+{
+  __parsec_bandwidth_internal_taskpool_t *__parsec_tp = (__parsec_bandwidth_internal_taskpool_t *)this_task->taskpool;
+  (void)es; (void)__parsec_tp;
+  const int t = this_task->locals.t.value; (void)t;
+  const int f = this_task->locals.f.value; (void)f;
+  (void)t;  (void)f;
+
+  /** Declare the variables that will hold the data, and all the accounting for each */
+  parsec_data_copy_t *_f_T = this_task->data._f_T.data_in;
+  void *T = PARSEC_DATA_COPY_GET_PTR(_f_T); (void)T;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    data_repo_entry_t *eT = this_task->data._f_T.source_repo_entry;
+    if( (NULL != eT) && (eT->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eT->sim_exec_date;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+    if ( NULL != _f_T ) {
+#if defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) || defined(PARSEC_HAVE_DEV_HIP_SUPPORT)
+      parsec_data_transfer_ownership_to_copy( _f_T->original, 0 /* device */,
+                                           PARSEC_FLOW_ACCESS_RW);
+#endif  /* defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) || defined(PARSEC_HAVE_DEV_HIP_SUPPORT) */
+      _f_T->version++;  /* T */
+#if defined(PARSEC_DEBUG_NOISIER)
+      char tmp[128];
+      PARSEC_DEBUG_VERBOSE(10, parsec_debug_output,
+                           "Body of %s: change Data copy %p to version %d",
+                           parsec_task_snprintf(tmp, 128, (parsec_task_t*)(this_task)),
+                           _f_T, _f_T->version);
+#endif /* defined(PARSEC_DEBUG_NOISIER) */
+    }
+  /** Cache Awareness Accounting */
+#if defined(PARSEC_CACHE_AWARENESS)
+  cache_buf_referenced(es->closest_cache, T);
+#endif /* PARSEC_CACHE_AWARENESS */
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                                  PONG BODY                                    -----*/
+
+
+
+/*-----                                END OF PONG BODY                                -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#endif  /*  defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+static int complete_hook_of_bandwidth_PONG(parsec_execution_stream_t *es, __parsec_bandwidth_PONG_task_t *this_task)
+{
+  const __parsec_bandwidth_internal_taskpool_t *__parsec_tp = (__parsec_bandwidth_internal_taskpool_t *)this_task->taskpool;
+#if defined(DISTRIBUTED)
+    const int t = this_task->locals.t.value; (void)t;
+  const int f = this_task->locals.f.value; (void)f;
+#endif  /* defined(DISTRIBUTED) */
+  (void)es; (void)__parsec_tp;
+parsec_data_t* data_t_desc = NULL; (void)data_t_desc;
+#if defined(DISTRIBUTED)
+  /** If not working on distributed, there is no risk that data is not in place */
+  (void)t;  (void)f;
+
+#endif /* DISTRIBUTED */
+#if defined(PARSEC_PROF_GRAPHER)
+  parsec_prof_grapher_task((parsec_task_t*)this_task, es->th_id, es->virtual_process->vp_id,
+     __jdf2c_key_fns_PONG.key_hash(this_task->task_class->make_key( (parsec_taskpool_t*)this_task->taskpool, ((parsec_task_t*)this_task)->locals), NULL));
+#endif  /* defined(PARSEC_PROF_GRAPHER) */
+  release_deps_of_bandwidth_PONG(es, this_task,
+      PARSEC_ACTION_RELEASE_REMOTE_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_REFS |
+      PARSEC_ACTION_RESHAPE_ON_RELEASE |
+      0x3,  /* mask of all dep_index */ 
+      NULL);
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static parsec_hook_return_t release_task_of_bandwidth_PONG(parsec_execution_stream_t *es, parsec_task_t *this_task)
+{
+    const __parsec_bandwidth_internal_taskpool_t *__parsec_tp =
+        (const __parsec_bandwidth_internal_taskpool_t *)this_task->taskpool;
+    parsec_hash_table_t *ht = (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[2];
+    parsec_key_t key = this_task->task_class->make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals);
+    parsec_hashable_dependency_t *hash_dep = (parsec_hashable_dependency_t *)parsec_hash_table_remove(ht, key);
+    parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);
+    return parsec_release_task_to_mempool_update_nbtasks(es, this_task);
+}
+
+static char *bandwidth_bandwidth_PONG_internal_init_deps_key_functions_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_bandwidth_internal_taskpool_t *__parsec_tp = (__parsec_bandwidth_internal_taskpool_t *)user_data;
+  int t = (__parsec_key) % __parsec_tp->PONG_t_range + __parsec_tp->PONG_t_min;
+  __parsec_key = __parsec_key / __parsec_tp->PONG_t_range;
+  int f = (__parsec_key) % __parsec_tp->PONG_f_range + __parsec_tp->PONG_f_min;
+  __parsec_key = __parsec_key / __parsec_tp->PONG_f_range;
+  snprintf(buffer, buffer_size, "PONG(%d, %d)", t, f);
+  return buffer;
+}
+
+static parsec_key_fn_t bandwidth_bandwidth_PONG_internal_init_deps_key_functions = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = bandwidth_bandwidth_PONG_internal_init_deps_key_functions_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/* Needs: min-max count-tasks iterate */
+static int bandwidth_PONG_internal_init(parsec_execution_stream_t * es, __parsec_bandwidth_PONG_task_t * this_task)
+{
+  __parsec_bandwidth_internal_taskpool_t *__parsec_tp = (__parsec_bandwidth_internal_taskpool_t*)this_task->taskpool;
+  int32_t nb_tasks = 0, saved_nb_tasks = 0;
+int32_t __t_min = 0x7fffffff, __t_max = 0;int32_t __jdf2c_t_min = 0x7fffffff, __jdf2c_t_max = 0;int32_t __f_min = 0x7fffffff, __f_max = 0;int32_t __jdf2c_f_min = 0x7fffffff, __jdf2c_f_max = 0;  __parsec_bandwidth_PONG_parsec_assignment_t assignments = {  .t.value = 0, .f.value = 0 };
+  int32_t  t,  f;
+  int32_t __jdf2c_t_start, __jdf2c_t_end, __jdf2c_t_inc;
+  int32_t __jdf2c_f_start, __jdf2c_f_end, __jdf2c_f_inc;
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+  PARSEC_PROFILING_TRACE(es->es_profile,
+                         this_task->taskpool->profiling_array[START_KEY(this_task->task_class->task_class_id)],
+                         0,
+                         this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    __jdf2c_t_start = 0;
+    __jdf2c_t_end = (loops - 1);
+    __jdf2c_t_inc = 1;
+    __t_min = parsec_imin(__jdf2c_t_start, __jdf2c_t_end);
+    __t_max = parsec_imax(__jdf2c_t_start, __jdf2c_t_end);
+    __jdf2c_t_min = parsec_imin(__jdf2c_t_min, __t_min);
+    __jdf2c_t_max = parsec_imax(__jdf2c_t_max, __t_max);
+    for(t =  __jdf2c_t_start;
+        t <= __jdf2c_t_end;
+        t += __jdf2c_t_inc) {
+    assignments.t.value = t;
+      __jdf2c_f_start = 0;
+      __jdf2c_f_end = (frags - 1);
+      __jdf2c_f_inc = 1;
+      __f_min = parsec_imin(__jdf2c_f_start, __jdf2c_f_end);
+      __f_max = parsec_imax(__jdf2c_f_start, __jdf2c_f_end);
+      __jdf2c_f_min = parsec_imin(__jdf2c_f_min, __f_min);
+      __jdf2c_f_max = parsec_imax(__jdf2c_f_max, __f_max);
+      for(f =  __jdf2c_f_start;
+          f <= __jdf2c_f_end;
+          f += __jdf2c_f_inc) {
+      assignments.f.value = f;
+      if( !PONG_pred(t, f) ) continue;
+      nb_tasks++;
+    } /* Loop on normal range f */
+  } /* For loop of t */ 
+   if( 0 != nb_tasks ) {
+     (void)parsec_atomic_fetch_add_int32(&__parsec_tp->initial_number_tasks, nb_tasks);
+   }
+  /* Set the range variables for the collision-free hash-computation */
+  __parsec_tp->PONG_t_min   = __jdf2c_t_min;
+  __parsec_tp->PONG_t_range = (__jdf2c_t_max - __jdf2c_t_min) + 1;
+  __parsec_tp->PONG_f_min   = __jdf2c_f_min;
+  __parsec_tp->PONG_f_range = (__jdf2c_f_max - __jdf2c_f_min) + 1;
+  this_task->status = PARSEC_TASK_STATUS_COMPLETE;
+
+  PARSEC_AYU_REGISTER_TASK(&bandwidth_PONG);
+  __parsec_tp->super.super.dependencies_array[2] = PARSEC_OBJ_NEW(parsec_hash_table_t);
+  parsec_hash_table_init(__parsec_tp->super.super.dependencies_array[2], offsetof(parsec_hashable_dependency_t, ht_item), 10, bandwidth_bandwidth_PONG_internal_init_deps_key_functions, this_task->taskpool);
+  __parsec_tp->repositories[2] = data_repo_create_nothreadsafe(nb_tasks, __jdf2c_key_fns_PONG, (parsec_taskpool_t*)__parsec_tp, 2);
+(void)saved_nb_tasks;
+(void)__t_min; (void)__t_max;(void)__f_min; (void)__f_max;  (void)__jdf2c_t_start; (void)__jdf2c_t_end; (void)__jdf2c_t_inc;  (void)__jdf2c_f_start; (void)__jdf2c_f_end; (void)__jdf2c_f_inc;  (void)assignments; (void)__parsec_tp; (void)es;
+  if(1 == parsec_atomic_fetch_dec_int32(&__parsec_tp->sync_point)) {
+    /* Last initialization task complete. Update the number of tasks. */
+    __parsec_tp->super.super.tdm.module->taskpool_addto_nb_tasks(&__parsec_tp->super.super, __parsec_tp->initial_number_tasks);
+    parsec_mfence();  /* write memory barrier to guarantee that the scheduler gets the correct number of tasks */
+    parsec_taskpool_enable((parsec_taskpool_t*)__parsec_tp, &__parsec_tp->startup_queue,
+                           (parsec_task_t*)this_task, es, __parsec_tp->super.super.nb_pending_actions);
+    __parsec_tp->super.super.tdm.module->taskpool_ready(&__parsec_tp->super.super);
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+    PARSEC_PROFILING_TRACE(es->es_profile,
+                           this_task->taskpool->profiling_array[2 * this_task->task_class->task_class_id + 1],
+                           0,
+                           this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    return PARSEC_HOOK_RETURN_DONE;
+  }
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static const __parsec_chore_t __bandwidth_PONG_chores[] ={
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+    { .type     = PARSEC_DEV_CPU,
+      .evaluate = (parsec_evaluate_function_t*)NULL,
+      .hook     = (parsec_hook_t*)hook_of_bandwidth_PONG },
+#endif  /* defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+    { .type     = PARSEC_DEV_NONE,
+      .evaluate = NULL,
+      .hook     = (parsec_hook_t*)NULL },  /* End marker */
+};
+
+static const parsec_task_class_t bandwidth_PONG = {
+  .name = "PONG",
+  .task_class_id = 2,
+  .nb_flows = 2,
+  .nb_parameters = 2,
+  .nb_locals = 2,
+  .task_class_type = PARSEC_TASK_CLASS_TYPE_PTG,
+  .params = { &symb_bandwidth_PONG_t, &symb_bandwidth_PONG_f, NULL },
+  .locals = { &symb_bandwidth_PONG_t, &symb_bandwidth_PONG_f, NULL },
+  .data_affinity = (parsec_data_ref_fn_t*)affinity_of_bandwidth_PONG,
+  .initial_data = (parsec_data_ref_fn_t*)affinity_of_bandwidth_PONG,
+  .final_data = (parsec_data_ref_fn_t*)affinity_of_bandwidth_PONG,
+  .priority = NULL,
+  .properties = properties_of_bandwidth_PONG,
+#if MAX_PARAM_COUNT < 1  /* number of read flows of PONG */
+  #error Too many read flows for task PONG
+#endif  /* MAX_PARAM_COUNT */
+#if MAX_PARAM_COUNT < 1  /* number of write flows of PONG */
+  #error Too many write flows for task PONG
+#endif  /* MAX_PARAM_COUNT */
+  .in = { &flow_of_bandwidth_PONG_for_T, NULL },
+  .out = { &flow_of_bandwidth_PONG_for_T, &flow_of_bandwidth_PONG_for_C, NULL },
+  .flags = 0x0 | PARSEC_USE_DEPS_MASK,
+  .dependencies_goal = 0x1,
+  .make_key = __jdf2c_make_key_PONG,
+  .task_snprintf = parsec_task_snprintf,
+#if defined(PARSEC_PROF_TRACE)
+  .profile_info = &parsec_task_profile_info,
+#endif
+  .key_functions = &__jdf2c_key_fns_PONG,
+  .fini = (parsec_hook_t*)NULL,
+  .incarnations = __bandwidth_PONG_chores,
+  .find_deps = parsec_hash_find_deps,
+  .update_deps = parsec_update_deps_with_mask,
+  .iterate_successors = (parsec_traverse_function_t*)iterate_successors_of_bandwidth_PONG,
+  .iterate_predecessors = (parsec_traverse_function_t*)iterate_predecessors_of_bandwidth_PONG,
+  .release_deps = (parsec_release_deps_t*)release_deps_of_bandwidth_PONG,
+  .prepare_output = (parsec_hook_t*)NULL,
+  .prepare_input = (parsec_hook_t*)data_lookup_of_bandwidth_PONG,
+  .time_estimate = NULL,
+  .get_datatype = datatype_lookup_of_bandwidth_PONG,
+  .complete_execution = (parsec_hook_t*)complete_hook_of_bandwidth_PONG,
+  .release_task = &release_task_of_bandwidth_PONG,
+#if defined(PARSEC_SIM)
+  .sim_cost_fct = (parsec_sim_cost_fct_t*)NULL,
+#endif
+};
+
+
+/******                                      PING                                      ******/
+
+static inline int32_t minexpr_of_symb_bandwidth_PING_t_fct(const __parsec_bandwidth_internal_taskpool_t *__parsec_tp, const __parsec_bandwidth_PING_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_bandwidth_PING_t = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_bandwidth_PING_t_fct }
+                   }
+};
+static inline int maxexpr_of_symb_bandwidth_PING_t_fct(const __parsec_bandwidth_internal_taskpool_t *__parsec_tp, const __parsec_bandwidth_PING_parsec_assignment_t *locals)
+{
+  const int t = locals->t.value; (void)t;
+  const int f = locals->f.value; (void)f;
+
+  (void)t;
+  (void)f;
+  (void)__parsec_tp; (void)locals;
+  return (loops - 1);
+}
+static const parsec_expr_t maxexpr_of_symb_bandwidth_PING_t = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_bandwidth_PING_t_fct }
+                   }
+};
+static const parsec_symbol_t symb_bandwidth_PING_t = { .name = "t", .context_index = 0, .min = &minexpr_of_symb_bandwidth_PING_t, .max = &maxexpr_of_symb_bandwidth_PING_t, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int32_t minexpr_of_symb_bandwidth_PING_f_fct(const __parsec_bandwidth_internal_taskpool_t *__parsec_tp, const __parsec_bandwidth_PING_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_bandwidth_PING_f = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_bandwidth_PING_f_fct }
+                   }
+};
+static inline int maxexpr_of_symb_bandwidth_PING_f_fct(const __parsec_bandwidth_internal_taskpool_t *__parsec_tp, const __parsec_bandwidth_PING_parsec_assignment_t *locals)
+{
+  const int t = locals->t.value; (void)t;
+  const int f = locals->f.value; (void)f;
+
+  (void)t;
+  (void)f;
+  (void)__parsec_tp; (void)locals;
+  return (frags - 1);
+}
+static const parsec_expr_t maxexpr_of_symb_bandwidth_PING_f = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_bandwidth_PING_f_fct }
+                   }
+};
+static const parsec_symbol_t symb_bandwidth_PING_f = { .name = "f", .context_index = 1, .min = &minexpr_of_symb_bandwidth_PING_f, .max = &maxexpr_of_symb_bandwidth_PING_f, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int affinity_of_bandwidth_PING(const __parsec_bandwidth_PING_task_t *this_task,
+                     parsec_data_ref_t *ref)
+{
+    const __parsec_bandwidth_internal_taskpool_t *__parsec_tp = (const __parsec_bandwidth_internal_taskpool_t*)this_task->taskpool;
+  const int t = this_task->locals.t.value; (void)t;
+  const int f = this_task->locals.f.value; (void)f;
+
+  /* Silent Warnings: should look into predicate to know what variables are usefull */
+  (void)t;
+  (void)f;
+  ref->dc = (parsec_data_collection_t *)__parsec_tp->super._g_Disk;
+  /* Compute data key */
+  ref->key = ref->dc->data_key(ref->dc, 0, (t % ws));
+  return 1;
+}
+static const parsec_property_t properties_of_bandwidth_PING[1] = {
+  {.name = NULL, .expr = NULL}
+};
+static inline int expr_of_cond_for_flow_of_bandwidth_PING_for_T_dep1_atline_50_iftrue_fct(const __parsec_bandwidth_internal_taskpool_t *__parsec_tp, const __parsec_bandwidth_PING_parsec_assignment_t *locals)
+{
+  const int t = locals->t.value;
+  const int f = locals->f.value; (void)f;
+
+  (void)t;
+  (void)f;
+  (void)__parsec_tp; (void)locals;
+  return (t) == (0);
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_bandwidth_PING_for_T_dep1_atline_50_iftrue = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_bandwidth_PING_for_T_dep1_atline_50_iftrue_fct }
+                   }
+};
+static parsec_data_t *flow_of_bandwidth_PING_for_T_dep1_atline_50_direct_access(const __parsec_bandwidth_internal_taskpool_t *__parsec_tp, const __parsec_bandwidth_PING_parsec_assignment_t *assignments)
+{
+  const int t = assignments->t.value; (void)t;
+  const int f = assignments->f.value; (void)f;
+
+  /* Silence Warnings: should look into parameters to know what variables are useful */
+  (void)t;
+  (void)f;
+  if( __parsec_tp->super.super.context->my_rank == (int32_t)rank_of_descA(f, 0) )
+    return data_of_descA(f, 0);
+  return NULL;
+}
+
+static const parsec_dep_t flow_of_bandwidth_PING_for_T_dep1_atline_50_iftrue = {
+  .cond = &expr_of_cond_for_flow_of_bandwidth_PING_for_T_dep1_atline_50_iftrue,  /* (t) == (0) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = PARSEC_LOCAL_DATA_TASK_CLASS_ID, /* bandwidth_descA */
+  .direct_data = (parsec_data_lookup_func_t)&flow_of_bandwidth_PING_for_T_dep1_atline_50_direct_access,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_bandwidth_PING_for_T,
+};
+static inline int expr_of_cond_for_flow_of_bandwidth_PING_for_T_dep1_atline_50_iffalse_fct(const __parsec_bandwidth_internal_taskpool_t *__parsec_tp, const __parsec_bandwidth_PING_parsec_assignment_t *locals)
+{
+  const int t = locals->t.value;
+  const int f = locals->f.value; (void)f;
+
+  (void)t;
+  (void)f;
+  (void)__parsec_tp; (void)locals;
+  return !((t) == (0));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_bandwidth_PING_for_T_dep1_atline_50_iffalse = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_bandwidth_PING_for_T_dep1_atline_50_iffalse_fct }
+                   }
+};
+static const parsec_dep_t flow_of_bandwidth_PING_for_T_dep1_atline_50_iffalse = {
+  .cond = &expr_of_cond_for_flow_of_bandwidth_PING_for_T_dep1_atline_50_iffalse,  /* !(t) == (0) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 2, /* bandwidth_PONG */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_bandwidth_PONG_for_T,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_bandwidth_PING_for_T,
+};
+static const parsec_dep_t flow_of_bandwidth_PING_for_T_dep2_atline_51 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 2, /* bandwidth_PONG */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_bandwidth_PONG_for_T,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_bandwidth_PING_for_T,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+#if MAX_DEP_OUT_COUNT < 1  /* number of output dependencies */
+    #error Too many output dependencies (supports up to MAX_DEP_OUT_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_OUT_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_bandwidth_PING_for_T = {
+  .name               = "T",
+  .sym_type           = PARSEC_SYM_INOUT,
+  .flow_flags         = PARSEC_FLOW_ACCESS_RW|PARSEC_FLOW_HAS_IN_DEPS,
+  .flow_index         = 0,
+  .flow_datatype_mask = 0x1,
+  .dep_in     = { &flow_of_bandwidth_PING_for_T_dep1_atline_50_iftrue,
+ &flow_of_bandwidth_PING_for_T_dep1_atline_50_iffalse },
+  .dep_out    = { &flow_of_bandwidth_PING_for_T_dep2_atline_51 }
+};
+
+static const parsec_dep_t flow_of_bandwidth_PING_for_C_dep1_atline_52 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 0, /* bandwidth_SYNC */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_bandwidth_SYNC_for_C,
+  .dep_index = 1,
+  .dep_datatype_index = 1,
+  .belongs_to = &flow_of_bandwidth_PING_for_C,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_bandwidth_PING_for_C = {
+  .name               = "C",
+  .sym_type           = PARSEC_SYM_IN,
+  .flow_flags         = PARSEC_FLOW_ACCESS_NONE,
+  .flow_index         = 1,
+  .flow_datatype_mask = 0x0,
+  .dep_in     = { &flow_of_bandwidth_PING_for_C_dep1_atline_52 },
+  .dep_out    = { NULL }
+};
+
+static void
+iterate_successors_of_bandwidth_PING(parsec_execution_stream_t *es, const __parsec_bandwidth_PING_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_bandwidth_internal_taskpool_t *__parsec_tp = (const __parsec_bandwidth_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_bandwidth_PING_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_bandwidth_PING_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int t = __jdf2c__tmp_locals.t.value; (void)t;
+  const int f = __jdf2c__tmp_locals.f.value; (void)f;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)t;  (void)f;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_Disk(0, (t % ws));
+#endif
+  if( action_mask & 0x1 ) {  /* Flow of data T [0] */
+    data.data   = this_task->data._f_T.data_out;
+    data.data_future  = NULL;
+    if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_bandwidth_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_bandwidth_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+       __parsec_bandwidth_PONG_task_t* ncc = (__parsec_bandwidth_PONG_task_t*)&nc;
+    nc.task_class = __parsec_tp->super.super.task_classes_array[bandwidth_PONG.task_class_id];
+      const int PONG_t = t;
+      if( (PONG_t >= (0)) && (PONG_t <= ((loops - 1))) ) {
+        assert(&nc.locals[0].value == &ncc->locals.t.value);
+        ncc->locals.t.value = PONG_t;
+        const int PONG_f = f;
+        if( (PONG_f >= (0)) && (PONG_f <= ((frags - 1))) ) {
+          assert(&nc.locals[1].value == &ncc->locals.f.value);
+          ncc->locals.f.value = PONG_f;
+#if defined(DISTRIBUTED)
+          rank_dst = rank_of_Disk(0, ((ncc->locals.t.value + 1) % ws));
+          if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+            vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_Disk)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_Disk, 0, ((ncc->locals.t.value + 1) % ws));
+          nc.priority = __parsec_tp->super.super.priority;
+          successor_repo = PONG_repo;
+          successor_repo_key = __jdf2c_make_key_PONG((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+        RELEASE_DEP_OUTPUT(es, "T", this_task, "T", &nc, rank_src, rank_dst, &data);
+        if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_bandwidth_PING_for_T_dep2_atline_51, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+          }
+        }
+  }
+  /* Flow of data C has only IN dependencies */
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static void
+iterate_predecessors_of_bandwidth_PING(parsec_execution_stream_t *es, const __parsec_bandwidth_PING_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_bandwidth_internal_taskpool_t *__parsec_tp = (const __parsec_bandwidth_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_bandwidth_PING_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_bandwidth_PING_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int t = __jdf2c__tmp_locals.t.value; (void)t;
+  const int f = __jdf2c__tmp_locals.f.value; (void)f;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)t;  (void)f;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_Disk(0, (t % ws));
+#endif
+  if( action_mask & 0x1 ) {  /* Flow of data T [0] */
+    data.data   = this_task->data._f_T.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x1 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_bandwidth_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_bandwidth_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( !((t) == (0)) ) {
+      __parsec_bandwidth_PONG_task_t* ncc = (__parsec_bandwidth_PONG_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[bandwidth_PONG.task_class_id];
+        const int PONG_t = (t - 1);
+        if( (PONG_t >= (0)) && (PONG_t <= ((loops - 1))) ) {
+          assert(&nc.locals[0].value == &ncc->locals.t.value);
+          ncc->locals.t.value = PONG_t;
+          const int PONG_f = f;
+          if( (PONG_f >= (0)) && (PONG_f <= ((frags - 1))) ) {
+            assert(&nc.locals[1].value == &ncc->locals.f.value);
+            ncc->locals.f.value = PONG_f;
+#if defined(DISTRIBUTED)
+            rank_dst = rank_of_Disk(0, ((ncc->locals.t.value + 1) % ws));
+            if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+              vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_Disk)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_Disk, 0, ((ncc->locals.t.value + 1) % ws));
+            nc.priority = __parsec_tp->super.super.priority;
+            successor_repo = PONG_repo;
+            successor_repo_key = __jdf2c_make_key_PONG((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+          RELEASE_DEP_OUTPUT(es, "T", this_task, "T", &nc, rank_src, rank_dst, &data);
+          if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_bandwidth_PING_for_T_dep1_atline_50_iffalse, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+            }
+          }
+    }
+  }
+  }
+  if( action_mask & 0x2 ) {  /* Flow of data C [1] */
+    data.data   = this_task->data._f_C.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x2 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  =   /* Control: always empty */ 0;
+    data.local.dst_count  =   /* Control: always empty */ 0;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = NULL;
+    data.remote.src_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.src_count  =   /* Control: always empty */ 0;
+    data.remote.dst_count  =   /* Control: always empty */ 0;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        __parsec_bandwidth_SYNC_task_t* ncc = (__parsec_bandwidth_SYNC_task_t*)&nc;
+    nc.task_class = __parsec_tp->super.super.task_classes_array[bandwidth_SYNC.task_class_id];
+      const int SYNC_t = t;
+      if( (SYNC_t >= (0)) && (SYNC_t <= ((loops - 1))) ) {
+        assert(&nc.locals[0].value == &ncc->locals.t.value);
+        ncc->locals.t.value = SYNC_t;
+#if defined(DISTRIBUTED)
+        rank_dst = rank_of_Disk(0, (ncc->locals.t.value % ws));
+        if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+          vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_Disk)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_Disk, 0, (ncc->locals.t.value % ws));
+        nc.priority = __parsec_tp->super.super.priority;
+        successor_repo = SYNC_repo;
+        successor_repo_key = __jdf2c_make_key_SYNC((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+      RELEASE_DEP_OUTPUT(es, "C", this_task, "C", &nc, rank_src, rank_dst, &data);
+      if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_bandwidth_PING_for_C_dep1_atline_52, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+        }
+  }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static int release_deps_of_bandwidth_PING(parsec_execution_stream_t *es, __parsec_bandwidth_PING_task_t *this_task, uint32_t action_mask, parsec_remote_deps_t *deps)
+{
+  PARSEC_PINS(es, RELEASE_DEPS_BEGIN, (parsec_task_t *)this_task);  const __parsec_bandwidth_internal_taskpool_t *__parsec_tp = (const __parsec_bandwidth_internal_taskpool_t *)this_task->taskpool;
+  parsec_release_dep_fct_arg_t arg;
+  int __vp_id;
+  int consume_local_repo = 0;
+  arg.action_mask = action_mask;
+  arg.output_entry = NULL;
+  arg.output_repo = NULL;
+#if defined(DISTRIBUTED)
+  arg.remote_deps = deps;
+#endif  /* defined(DISTRIBUTED) */
+  assert(NULL != es);
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS )    arg.ready_lists = alloca(sizeof(parsec_task_t *) * es->virtual_process->parsec_context->nb_vp);
+  else
+    arg.ready_lists = NULL;
+  for( __vp_id = 0; __vp_id < es->virtual_process->parsec_context->nb_vp; arg.ready_lists[__vp_id++] = NULL );
+  (void)__parsec_tp; (void)deps;
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_T.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_T.source_repo, this_task->data._f_T.source_repo_entry->ht_item.key );
+    }
+  }
+  consume_local_repo = (this_task->repo_entry != NULL);
+  arg.output_repo = PING_repo;
+  arg.output_entry = this_task->repo_entry;
+  arg.output_usage = 0;
+  if( action_mask & (PARSEC_ACTION_RELEASE_LOCAL_DEPS | PARSEC_ACTION_GET_REPO_ENTRY) ) {
+    arg.output_entry = data_repo_lookup_entry_and_create( es, arg.output_repo, __jdf2c_make_key_PING((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    arg.output_entry->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(arg.output_entry->sim_exec_date == 0);
+    arg.output_entry->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  if(action_mask & ( PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE ) ){
+    /* Generate the reshape promise for the outputs that need it */
+    iterate_successors_of_bandwidth_PING(es, this_task, action_mask, parsec_set_up_reshape_promise, &arg);
+   }
+  iterate_successors_of_bandwidth_PING(es, this_task, action_mask, parsec_release_dep_fct, &arg);
+
+#if defined(DISTRIBUTED)
+  if( (action_mask & PARSEC_ACTION_SEND_REMOTE_DEPS) && (NULL != arg.remote_deps)) {
+    parsec_remote_dep_activate(es, (parsec_task_t *)this_task, arg.remote_deps, arg.remote_deps->outgoing_mask);
+  }
+#endif
+
+  if(action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS) {
+    data_repo_entry_addto_usage_limit(PING_repo, arg.output_entry->ht_item.key, arg.output_usage);
+    __parsec_schedule_vp(es, arg.ready_lists, 0);
+  }
+      if (consume_local_repo) {
+         data_repo_entry_used_once( PING_repo, this_task->repo_entry->ht_item.key );
+      }
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_T.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_T.data_in);
+    }
+  }
+  PARSEC_PINS(es, RELEASE_DEPS_END, (parsec_task_t *)this_task);  return 0;
+}
+
+static int data_lookup_of_bandwidth_PING(parsec_execution_stream_t *es, __parsec_bandwidth_PING_task_t *this_task)
+{
+  const __parsec_bandwidth_internal_taskpool_t *__parsec_tp = (__parsec_bandwidth_internal_taskpool_t *)this_task->taskpool;
+  parsec_assignment_t generic_locals[MAX_PARAM_COUNT];  /* generic task locals */
+  int target_device = 0; (void)target_device;
+  (void)__parsec_tp; (void)generic_locals; (void)es;
+  parsec_data_copy_t *chunk = NULL;
+  data_repo_t        *reshape_repo  = NULL, *consumed_repo  = NULL;
+  data_repo_entry_t  *reshape_entry = NULL, *consumed_entry = NULL;
+  parsec_key_t        reshape_entry_key = 0, consumed_entry_key = 0;
+  uint8_t             consumed_flow_index;
+  parsec_dep_data_description_t data;
+  int ret;
+  (void)reshape_repo; (void)reshape_entry; (void)reshape_entry_key;
+  (void)consumed_repo; (void)consumed_entry; (void)consumed_entry_key;
+  (void)consumed_flow_index;
+  (void)chunk; (void)data; (void)ret;
+  const int t = this_task->locals.t.value; (void)t;
+  const int f = this_task->locals.f.value; (void)f;
+  if( NULL == this_task->repo_entry ){
+    this_task->repo_entry = data_repo_lookup_entry_and_create(es, PING_repo,                                       __jdf2c_make_key_PING((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    data_repo_entry_addto_usage_limit(PING_repo, this_task->repo_entry->ht_item.key, 1);    this_task->repo_entry ->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(this_task->repo_entry ->sim_exec_date == 0);
+    this_task->repo_entry ->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  /* The reshape repo is the current task repo. */  reshape_repo = PING_repo;
+  reshape_entry_key = __jdf2c_make_key_PING((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals) ;
+  reshape_entry = this_task->repo_entry;
+  /* Lookup the input data, and store them in the context if any */
+
+if(! this_task->data._f_T.fulfill ){ /* Flow T */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_T.data_out = NULL;  /* By default, if nothing matches */
+    if( (t) == (0) ) {
+    /* Flow T [0] dependency [0] from memory descA */
+    if( NULL == (chunk = this_task->data._f_T.data_in) ) {
+    /* No data set up by predecessor on this task input flow */
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+    parsec_prof_grapher_data_input(data_of_descA(f, 0), (parsec_task_t*)this_task, &flow_of_bandwidth_PING_for_T, 1);
+#endif
+      chunk = parsec_data_get_copy(data_of_descA(f, 0), target_device);
+      data.data = chunk;
+      data.data_future  = NULL;
+          data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      data.data_future   = NULL;
+      if( (ret = parsec_get_copy_reshape_from_desc(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      this_task->data._f_T.data_out = chunk;
+      PARSEC_OBJ_RETAIN(chunk);
+    } 
+    } else {
+    /* Flow T [0] dependency [0] from predecessor PONG */
+    if( NULL == (chunk = this_task->data._f_T.data_in) ) {
+    /* No data set up by predecessor on this task input flow */
+__parsec_bandwidth_PONG_parsec_assignment_t *target_locals = (__parsec_bandwidth_PONG_parsec_assignment_t*)&generic_locals;
+      const int PONGt = target_locals->t.value = (t - 1); (void)PONGt;
+      const int PONGf = target_locals->f.value = f; (void)PONGf;
+      if( (reshape_entry != NULL) && (reshape_entry->data[0] != NULL) ){
+          /* Reshape promise set up on this task repo by predecessor */
+          consumed_repo = reshape_repo;
+          consumed_entry = reshape_entry;
+          consumed_entry_key = reshape_entry_key;
+          consumed_flow_index = 0;
+      }else{
+          /* Consume from predecessor's repo */
+          consumed_repo = PONG_repo;
+          consumed_entry_key = __jdf2c_make_key_PONG((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)target_locals) ;
+          consumed_entry = data_repo_lookup_entry( consumed_repo, consumed_entry_key );
+          consumed_flow_index = 0;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      ACQUIRE_FLOW(this_task, "T", &bandwidth_PONG, "T", target_locals, chunk);
+      this_task->data._f_T.data_out = chunk;
+    } 
+    else {
+      /* Data set up by predecessor on this task input flow */
+      consumed_repo = this_task->data._f_T.source_repo;
+      consumed_entry = this_task->data._f_T.source_repo_entry;
+      consumed_entry_key = this_task->data._f_T.source_repo_entry->ht_item.key;
+      if( (reshape_entry != NULL) && (reshape_entry->data[0] != NULL) ){
+          /* Reshape promise set up on input by predecessor is on this task repo */
+          consumed_flow_index = 0;
+          assert( (this_task->data._f_T.source_repo == reshape_repo)
+               && (this_task->data._f_T.source_repo_entry == reshape_entry));
+      }else{
+          /* Reshape promise set up on input by predecessor is the predecesssor task repo */
+          consumed_flow_index = 0;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      this_task->data._f_T.data_out = parsec_data_get_copy(chunk->original, target_device);
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+      parsec_prof_grapher_data_input(chunk->original, (parsec_task_t*)this_task, &flow_of_bandwidth_PING_for_T, 0);
+#endif
+    }
+    }
+    this_task->data._f_T.data_in     = chunk;
+    this_task->data._f_T.source_repo       = consumed_repo;
+    this_task->data._f_T.source_repo_entry = consumed_entry;
+    if( this_task->data._f_T.source_repo_entry == this_task->repo_entry ){
+      /* in case we have consume from this task repo entry for the flow,
+       * it is cleaned up, avoiding having old stuff during release_deps_of
+       */
+      this_task->repo_entry->data[0] = NULL;
+    }
+    this_task->data._f_T.fulfill = 1;
+}
+
+  /* C is a control flow */
+  this_task->data._f_C.data_in         = NULL;
+  this_task->data._f_C.data_out        = NULL;
+  this_task->data._f_C.source_repo       = NULL;
+  this_task->data._f_C.source_repo_entry = NULL;
+  /** Generate profiling information */
+#if defined(PARSEC_PROF_TRACE)
+  this_task->prof_info.desc = (parsec_data_collection_t*)__parsec_tp->super._g_Disk;
+  this_task->prof_info.priority = this_task->priority;
+  this_task->prof_info.data_id   = ((parsec_data_collection_t*)__parsec_tp->super._g_Disk)->data_key((parsec_data_collection_t*)__parsec_tp->super._g_Disk, 0, (t % ws));
+  this_task->prof_info.task_class_id = this_task->task_class->task_class_id;
+  this_task->prof_info.task_return_code = -1;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int datatype_lookup_of_bandwidth_PING(parsec_execution_stream_t *es, const parsec_task_t *this_generic_task, const parsec_task_t *parent_task,
+              uint32_t* flow_mask, parsec_dep_data_description_t* data)
+{
+  const __parsec_bandwidth_PING_task_t *this_task = (__parsec_bandwidth_PING_task_t*)this_generic_task;
+  const __parsec_bandwidth_internal_taskpool_t *__parsec_tp = (__parsec_bandwidth_internal_taskpool_t *)this_task->taskpool;
+  (void)__parsec_tp; (void)es; (void)this_task; (void)data; (void)parent_task;
+  const int t = this_task->locals.t.value; (void)t;
+  const int f = this_task->locals.f.value; (void)f;
+  data->local.arena = data->remote.arena = NULL;
+  data->local.src_datatype  = data->local.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->local.src_count     = data->local.dst_count = 0;
+  data->local.src_displ     = data->local.dst_displ = 0;
+  data->data_future  = NULL;
+  if( (*flow_mask) & 0x80000000U ) { /* these are the input dependencies remote datatypes  */
+if( (*flow_mask) & 0x1U ) {  /* Flow T */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_bandwidth_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_bandwidth_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_bandwidth_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+    goto no_mask_match;
+  }
+
+  /* these are the output dependencies remote datatypes */
+if( (*flow_mask) & 0x1U ) {  /* Flow T */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_bandwidth_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_bandwidth_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_bandwidth_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+ no_mask_match:
+  data->data                             = NULL;
+  data->remote.src_datatype = data->remote.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->remote.src_count    = data->remote.dst_count = 0;
+  data->remote.src_displ    = data->remote.dst_displ = 0;
+  data->data_future  = NULL;
+  (*flow_mask) = 0;  /* nothing left */
+  (void)t;  (void)f;
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+static int hook_of_bandwidth_PING(parsec_execution_stream_t *es, __parsec_bandwidth_PING_task_t *this_task)
+{
+  __parsec_bandwidth_internal_taskpool_t *__parsec_tp = (__parsec_bandwidth_internal_taskpool_t *)this_task->taskpool;
+  (void)es; (void)__parsec_tp;
+  const int t = this_task->locals.t.value; (void)t;
+  const int f = this_task->locals.f.value; (void)f;
+  (void)t;  (void)f;
+
+  /** Declare the variables that will hold the data, and all the accounting for each */
+  parsec_data_copy_t *_f_T = this_task->data._f_T.data_in;
+  void *T = PARSEC_DATA_COPY_GET_PTR(_f_T); (void)T;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    data_repo_entry_t *eT = this_task->data._f_T.source_repo_entry;
+    if( (NULL != eT) && (eT->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eT->sim_exec_date;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+    if ( NULL != _f_T ) {
+#if defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) || defined(PARSEC_HAVE_DEV_HIP_SUPPORT)
+      parsec_data_transfer_ownership_to_copy( _f_T->original, 0 /* device */,
+                                           PARSEC_FLOW_ACCESS_RW);
+#endif  /* defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) || defined(PARSEC_HAVE_DEV_HIP_SUPPORT) */
+      _f_T->version++;  /* T */
+#if defined(PARSEC_DEBUG_NOISIER)
+      char tmp[128];
+      PARSEC_DEBUG_VERBOSE(10, parsec_debug_output,
+                           "Body of %s: change Data copy %p to version %d",
+                           parsec_task_snprintf(tmp, 128, (parsec_task_t*)(this_task)),
+                           _f_T, _f_T->version);
+#endif /* defined(PARSEC_DEBUG_NOISIER) */
+    }
+  /** Cache Awareness Accounting */
+#if defined(PARSEC_CACHE_AWARENESS)
+  cache_buf_referenced(es->closest_cache, T);
+#endif /* PARSEC_CACHE_AWARENESS */
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                                  PING BODY                                    -----*/
+
+
+
+/*-----                                END OF PING BODY                                -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#endif  /*  defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+static int complete_hook_of_bandwidth_PING(parsec_execution_stream_t *es, __parsec_bandwidth_PING_task_t *this_task)
+{
+  const __parsec_bandwidth_internal_taskpool_t *__parsec_tp = (__parsec_bandwidth_internal_taskpool_t *)this_task->taskpool;
+#if defined(DISTRIBUTED)
+    const int t = this_task->locals.t.value; (void)t;
+  const int f = this_task->locals.f.value; (void)f;
+#endif  /* defined(DISTRIBUTED) */
+  (void)es; (void)__parsec_tp;
+parsec_data_t* data_t_desc = NULL; (void)data_t_desc;
+#if defined(DISTRIBUTED)
+  /** If not working on distributed, there is no risk that data is not in place */
+  (void)t;  (void)f;
+
+#endif /* DISTRIBUTED */
+#if defined(PARSEC_PROF_GRAPHER)
+  parsec_prof_grapher_task((parsec_task_t*)this_task, es->th_id, es->virtual_process->vp_id,
+     __jdf2c_key_fns_PING.key_hash(this_task->task_class->make_key( (parsec_taskpool_t*)this_task->taskpool, ((parsec_task_t*)this_task)->locals), NULL));
+#endif  /* defined(PARSEC_PROF_GRAPHER) */
+  release_deps_of_bandwidth_PING(es, this_task,
+      PARSEC_ACTION_RELEASE_REMOTE_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_REFS |
+      PARSEC_ACTION_RESHAPE_ON_RELEASE |
+      0x1,  /* mask of all dep_index */ 
+      NULL);
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static parsec_hook_return_t release_task_of_bandwidth_PING(parsec_execution_stream_t *es, parsec_task_t *this_task)
+{
+    const __parsec_bandwidth_internal_taskpool_t *__parsec_tp =
+        (const __parsec_bandwidth_internal_taskpool_t *)this_task->taskpool;
+    parsec_hash_table_t *ht = (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[1];
+    parsec_key_t key = this_task->task_class->make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals);
+    parsec_hashable_dependency_t *hash_dep = (parsec_hashable_dependency_t *)parsec_hash_table_remove(ht, key);
+    parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);
+    return parsec_release_task_to_mempool_update_nbtasks(es, this_task);
+}
+
+static char *bandwidth_bandwidth_PING_internal_init_deps_key_functions_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_bandwidth_internal_taskpool_t *__parsec_tp = (__parsec_bandwidth_internal_taskpool_t *)user_data;
+  int t = (__parsec_key) % __parsec_tp->PING_t_range + __parsec_tp->PING_t_min;
+  __parsec_key = __parsec_key / __parsec_tp->PING_t_range;
+  int f = (__parsec_key) % __parsec_tp->PING_f_range + __parsec_tp->PING_f_min;
+  __parsec_key = __parsec_key / __parsec_tp->PING_f_range;
+  snprintf(buffer, buffer_size, "PING(%d, %d)", t, f);
+  return buffer;
+}
+
+static parsec_key_fn_t bandwidth_bandwidth_PING_internal_init_deps_key_functions = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = bandwidth_bandwidth_PING_internal_init_deps_key_functions_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/* Needs: min-max count-tasks iterate */
+static int bandwidth_PING_internal_init(parsec_execution_stream_t * es, __parsec_bandwidth_PING_task_t * this_task)
+{
+  __parsec_bandwidth_internal_taskpool_t *__parsec_tp = (__parsec_bandwidth_internal_taskpool_t*)this_task->taskpool;
+  int32_t nb_tasks = 0, saved_nb_tasks = 0;
+int32_t __t_min = 0x7fffffff, __t_max = 0;int32_t __jdf2c_t_min = 0x7fffffff, __jdf2c_t_max = 0;int32_t __f_min = 0x7fffffff, __f_max = 0;int32_t __jdf2c_f_min = 0x7fffffff, __jdf2c_f_max = 0;  __parsec_bandwidth_PING_parsec_assignment_t assignments = {  .t.value = 0, .f.value = 0 };
+  int32_t  t,  f;
+  int32_t __jdf2c_t_start, __jdf2c_t_end, __jdf2c_t_inc;
+  int32_t __jdf2c_f_start, __jdf2c_f_end, __jdf2c_f_inc;
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+  PARSEC_PROFILING_TRACE(es->es_profile,
+                         this_task->taskpool->profiling_array[START_KEY(this_task->task_class->task_class_id)],
+                         0,
+                         this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    __jdf2c_t_start = 0;
+    __jdf2c_t_end = (loops - 1);
+    __jdf2c_t_inc = 1;
+    __t_min = parsec_imin(__jdf2c_t_start, __jdf2c_t_end);
+    __t_max = parsec_imax(__jdf2c_t_start, __jdf2c_t_end);
+    __jdf2c_t_min = parsec_imin(__jdf2c_t_min, __t_min);
+    __jdf2c_t_max = parsec_imax(__jdf2c_t_max, __t_max);
+    for(t =  __jdf2c_t_start;
+        t <= __jdf2c_t_end;
+        t += __jdf2c_t_inc) {
+    assignments.t.value = t;
+      __jdf2c_f_start = 0;
+      __jdf2c_f_end = (frags - 1);
+      __jdf2c_f_inc = 1;
+      __f_min = parsec_imin(__jdf2c_f_start, __jdf2c_f_end);
+      __f_max = parsec_imax(__jdf2c_f_start, __jdf2c_f_end);
+      __jdf2c_f_min = parsec_imin(__jdf2c_f_min, __f_min);
+      __jdf2c_f_max = parsec_imax(__jdf2c_f_max, __f_max);
+      for(f =  __jdf2c_f_start;
+          f <= __jdf2c_f_end;
+          f += __jdf2c_f_inc) {
+      assignments.f.value = f;
+      if( !PING_pred(t, f) ) continue;
+      nb_tasks++;
+    } /* Loop on normal range f */
+  } /* For loop of t */ 
+   if( 0 != nb_tasks ) {
+     (void)parsec_atomic_fetch_add_int32(&__parsec_tp->initial_number_tasks, nb_tasks);
+   }
+  /* Set the range variables for the collision-free hash-computation */
+  __parsec_tp->PING_t_min   = __jdf2c_t_min;
+  __parsec_tp->PING_t_range = (__jdf2c_t_max - __jdf2c_t_min) + 1;
+  __parsec_tp->PING_f_min   = __jdf2c_f_min;
+  __parsec_tp->PING_f_range = (__jdf2c_f_max - __jdf2c_f_min) + 1;
+  this_task->status = PARSEC_TASK_STATUS_COMPLETE;
+
+  PARSEC_AYU_REGISTER_TASK(&bandwidth_PING);
+  __parsec_tp->super.super.dependencies_array[1] = PARSEC_OBJ_NEW(parsec_hash_table_t);
+  parsec_hash_table_init(__parsec_tp->super.super.dependencies_array[1], offsetof(parsec_hashable_dependency_t, ht_item), 10, bandwidth_bandwidth_PING_internal_init_deps_key_functions, this_task->taskpool);
+  __parsec_tp->repositories[1] = data_repo_create_nothreadsafe(nb_tasks, __jdf2c_key_fns_PING, (parsec_taskpool_t*)__parsec_tp, 2);
+(void)saved_nb_tasks;
+(void)__t_min; (void)__t_max;(void)__f_min; (void)__f_max;  (void)__jdf2c_t_start; (void)__jdf2c_t_end; (void)__jdf2c_t_inc;  (void)__jdf2c_f_start; (void)__jdf2c_f_end; (void)__jdf2c_f_inc;  (void)assignments; (void)__parsec_tp; (void)es;
+  if(1 == parsec_atomic_fetch_dec_int32(&__parsec_tp->sync_point)) {
+    /* Last initialization task complete. Update the number of tasks. */
+    __parsec_tp->super.super.tdm.module->taskpool_addto_nb_tasks(&__parsec_tp->super.super, __parsec_tp->initial_number_tasks);
+    parsec_mfence();  /* write memory barrier to guarantee that the scheduler gets the correct number of tasks */
+    parsec_taskpool_enable((parsec_taskpool_t*)__parsec_tp, &__parsec_tp->startup_queue,
+                           (parsec_task_t*)this_task, es, __parsec_tp->super.super.nb_pending_actions);
+    __parsec_tp->super.super.tdm.module->taskpool_ready(&__parsec_tp->super.super);
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+    PARSEC_PROFILING_TRACE(es->es_profile,
+                           this_task->taskpool->profiling_array[2 * this_task->task_class->task_class_id + 1],
+                           0,
+                           this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    return PARSEC_HOOK_RETURN_DONE;
+  }
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static const __parsec_chore_t __bandwidth_PING_chores[] ={
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+    { .type     = PARSEC_DEV_CPU,
+      .evaluate = (parsec_evaluate_function_t*)NULL,
+      .hook     = (parsec_hook_t*)hook_of_bandwidth_PING },
+#endif  /* defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+    { .type     = PARSEC_DEV_NONE,
+      .evaluate = NULL,
+      .hook     = (parsec_hook_t*)NULL },  /* End marker */
+};
+
+static const parsec_task_class_t bandwidth_PING = {
+  .name = "PING",
+  .task_class_id = 1,
+  .nb_flows = 2,
+  .nb_parameters = 2,
+  .nb_locals = 2,
+  .task_class_type = PARSEC_TASK_CLASS_TYPE_PTG,
+  .params = { &symb_bandwidth_PING_t, &symb_bandwidth_PING_f, NULL },
+  .locals = { &symb_bandwidth_PING_t, &symb_bandwidth_PING_f, NULL },
+  .data_affinity = (parsec_data_ref_fn_t*)affinity_of_bandwidth_PING,
+  .initial_data = (parsec_data_ref_fn_t*)affinity_of_bandwidth_PING,
+  .final_data = (parsec_data_ref_fn_t*)affinity_of_bandwidth_PING,
+  .priority = NULL,
+  .properties = properties_of_bandwidth_PING,
+#if MAX_PARAM_COUNT < 1  /* number of read flows of PING */
+  #error Too many read flows for task PING
+#endif  /* MAX_PARAM_COUNT */
+#if MAX_PARAM_COUNT < 1  /* number of write flows of PING */
+  #error Too many write flows for task PING
+#endif  /* MAX_PARAM_COUNT */
+  .in = { &flow_of_bandwidth_PING_for_T, &flow_of_bandwidth_PING_for_C, NULL },
+  .out = { &flow_of_bandwidth_PING_for_T, NULL },
+  .flags = 0x0 | PARSEC_HAS_IN_IN_DEPENDENCIES | PARSEC_USE_DEPS_MASK,
+  .dependencies_goal = 0x3,
+  .make_key = __jdf2c_make_key_PING,
+  .task_snprintf = parsec_task_snprintf,
+#if defined(PARSEC_PROF_TRACE)
+  .profile_info = &parsec_task_profile_info,
+#endif
+  .key_functions = &__jdf2c_key_fns_PING,
+  .fini = (parsec_hook_t*)NULL,
+  .incarnations = __bandwidth_PING_chores,
+  .find_deps = parsec_hash_find_deps,
+  .update_deps = parsec_update_deps_with_mask,
+  .iterate_successors = (parsec_traverse_function_t*)iterate_successors_of_bandwidth_PING,
+  .iterate_predecessors = (parsec_traverse_function_t*)iterate_predecessors_of_bandwidth_PING,
+  .release_deps = (parsec_release_deps_t*)release_deps_of_bandwidth_PING,
+  .prepare_output = (parsec_hook_t*)NULL,
+  .prepare_input = (parsec_hook_t*)data_lookup_of_bandwidth_PING,
+  .time_estimate = NULL,
+  .get_datatype = datatype_lookup_of_bandwidth_PING,
+  .complete_execution = (parsec_hook_t*)complete_hook_of_bandwidth_PING,
+  .release_task = &release_task_of_bandwidth_PING,
+#if defined(PARSEC_SIM)
+  .sim_cost_fct = (parsec_sim_cost_fct_t*)NULL,
+#endif
+};
+
+
+/******                                      SYNC                                      ******/
+
+static inline int32_t minexpr_of_symb_bandwidth_SYNC_t_fct(const __parsec_bandwidth_internal_taskpool_t *__parsec_tp, const __parsec_bandwidth_SYNC_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_bandwidth_SYNC_t = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_bandwidth_SYNC_t_fct }
+                   }
+};
+static inline int maxexpr_of_symb_bandwidth_SYNC_t_fct(const __parsec_bandwidth_internal_taskpool_t *__parsec_tp, const __parsec_bandwidth_SYNC_parsec_assignment_t *locals)
+{
+  const int t = locals->t.value; (void)t;
+
+  (void)t;
+  (void)__parsec_tp; (void)locals;
+  return (loops - 1);
+}
+static const parsec_expr_t maxexpr_of_symb_bandwidth_SYNC_t = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_bandwidth_SYNC_t_fct }
+                   }
+};
+static const parsec_symbol_t symb_bandwidth_SYNC_t = { .name = "t", .context_index = 0, .min = &minexpr_of_symb_bandwidth_SYNC_t, .max = &maxexpr_of_symb_bandwidth_SYNC_t, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int affinity_of_bandwidth_SYNC(const __parsec_bandwidth_SYNC_task_t *this_task,
+                     parsec_data_ref_t *ref)
+{
+    const __parsec_bandwidth_internal_taskpool_t *__parsec_tp = (const __parsec_bandwidth_internal_taskpool_t*)this_task->taskpool;
+  const int t = this_task->locals.t.value; (void)t;
+
+  /* Silent Warnings: should look into predicate to know what variables are usefull */
+  (void)t;
+  ref->dc = (parsec_data_collection_t *)__parsec_tp->super._g_Disk;
+  /* Compute data key */
+  ref->key = ref->dc->data_key(ref->dc, 0, (t % ws));
+  return 1;
+}
+static const parsec_property_t properties_of_bandwidth_SYNC[1] = {
+  {.name = NULL, .expr = NULL}
+};
+static inline int expr_of_cond_for_flow_of_bandwidth_SYNC_for_C_dep1_atline_38_fct(const __parsec_bandwidth_internal_taskpool_t *__parsec_tp, const __parsec_bandwidth_SYNC_parsec_assignment_t *locals)
+{
+  const int t = locals->t.value;
+
+  (void)t;
+  (void)__parsec_tp; (void)locals;
+  return (t) > (0);
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_bandwidth_SYNC_for_C_dep1_atline_38 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_bandwidth_SYNC_for_C_dep1_atline_38_fct }
+                   }
+};
+static inline int ctl_gather_compute_for_dep_flow_of_bandwidth_SYNC_for_C_dep1_atline_38_fct(const __parsec_bandwidth_internal_taskpool_t *__parsec_tp, const __parsec_bandwidth_SYNC_parsec_assignment_t *assignments)
+{
+  int   __nb_found = 0;
+  __parsec_bandwidth_SYNC_parsec_assignment_t __jdf2c__tmp_locals = *assignments;
+  (void)__parsec_tp;
+  const int t = __jdf2c__tmp_locals.t.value; (void)t;
+  (void)t;
+  int PONG_t = (t - 1);
+  (void)PONG_t;
+  {
+    int PONG_f;
+    for(PONG_f  = 0;
+        PONG_f <= (frags - 1);
+        PONG_f += 1) {
+      __nb_found++;
+    }
+  }
+  return __nb_found;
+}
+
+static const parsec_expr_t ctl_gather_compute_for_dep_flow_of_bandwidth_SYNC_for_C_dep1_atline_38 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)ctl_gather_compute_for_dep_flow_of_bandwidth_SYNC_for_C_dep1_atline_38_fct }
+                   }
+};
+
+static const parsec_dep_t flow_of_bandwidth_SYNC_for_C_dep1_atline_38 = {
+  .cond = &expr_of_cond_for_flow_of_bandwidth_SYNC_for_C_dep1_atline_38,  /* (t) > (0) */
+  .ctl_gather_nb = &ctl_gather_compute_for_dep_flow_of_bandwidth_SYNC_for_C_dep1_atline_38,
+  .task_class_id = 2, /* bandwidth_PONG */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_bandwidth_PONG_for_C,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_bandwidth_SYNC_for_C,
+};
+static const parsec_dep_t flow_of_bandwidth_SYNC_for_C_dep2_atline_37 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 1, /* bandwidth_PING */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_bandwidth_PING_for_C,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_bandwidth_SYNC_for_C,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+#if MAX_DEP_OUT_COUNT < 1  /* number of output dependencies */
+    #error Too many output dependencies (supports up to MAX_DEP_OUT_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_OUT_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_bandwidth_SYNC_for_C = {
+  .name               = "C",
+  .sym_type           = PARSEC_SYM_INOUT,
+  .flow_flags         = PARSEC_FLOW_ACCESS_NONE|PARSEC_FLOW_HAS_IN_DEPS,
+  .flow_index         = 0,
+  .flow_datatype_mask = 0x1,
+  .dep_in     = { &flow_of_bandwidth_SYNC_for_C_dep1_atline_38 },
+  .dep_out    = { &flow_of_bandwidth_SYNC_for_C_dep2_atline_37 }
+};
+
+static void
+iterate_successors_of_bandwidth_SYNC(parsec_execution_stream_t *es, const __parsec_bandwidth_SYNC_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_bandwidth_internal_taskpool_t *__parsec_tp = (const __parsec_bandwidth_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_bandwidth_SYNC_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_bandwidth_SYNC_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int t = __jdf2c__tmp_locals.t.value; (void)t;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)t;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_Disk(0, (t % ws));
+#endif
+  if( action_mask & 0x1 ) {  /* Flow of data C [0] */
+    data.data   = this_task->data._f_C.data_out;
+    data.data_future  = NULL;
+    if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  =   /* Control: always empty */ 0;
+    data.local.dst_count  =   /* Control: always empty */ 0;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = NULL;
+    data.remote.src_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.src_count  =   /* Control: always empty */ 0;
+    data.remote.dst_count  =   /* Control: always empty */ 0;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+       __parsec_bandwidth_PING_task_t* ncc = (__parsec_bandwidth_PING_task_t*)&nc;
+    nc.task_class = __parsec_tp->super.super.task_classes_array[bandwidth_PING.task_class_id];
+      const int PING_t = t;
+      if( (PING_t >= (0)) && (PING_t <= ((loops - 1))) ) {
+        assert(&nc.locals[0].value == &ncc->locals.t.value);
+        ncc->locals.t.value = PING_t;
+        int PING_f;
+      for( PING_f = 0;PING_f <= (frags - 1); PING_f+=1) {
+          if( (PING_f >= (0)) && (PING_f <= ((frags - 1))) ) {
+            assert(&nc.locals[1].value == &ncc->locals.f.value);
+            ncc->locals.f.value = PING_f;
+#if defined(DISTRIBUTED)
+            rank_dst = rank_of_Disk(0, (ncc->locals.t.value % ws));
+            if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+              vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_Disk)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_Disk, 0, (ncc->locals.t.value % ws));
+            nc.priority = __parsec_tp->super.super.priority;
+            successor_repo = PING_repo;
+            successor_repo_key = __jdf2c_make_key_PING((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+          RELEASE_DEP_OUTPUT(es, "C", this_task, "C", &nc, rank_src, rank_dst, &data);
+          if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_bandwidth_SYNC_for_C_dep2_atline_37, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+            }
+          }
+        }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static void
+iterate_predecessors_of_bandwidth_SYNC(parsec_execution_stream_t *es, const __parsec_bandwidth_SYNC_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_bandwidth_internal_taskpool_t *__parsec_tp = (const __parsec_bandwidth_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_bandwidth_SYNC_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_bandwidth_SYNC_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int t = __jdf2c__tmp_locals.t.value; (void)t;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)t;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_Disk(0, (t % ws));
+#endif
+  if( action_mask & 0x1 ) {  /* Flow of data C [0] */
+    data.data   = this_task->data._f_C.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x1 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  =   /* Control: always empty */ 0;
+    data.local.dst_count  =   /* Control: always empty */ 0;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = NULL;
+    data.remote.src_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.src_count  =   /* Control: always empty */ 0;
+    data.remote.dst_count  =   /* Control: always empty */ 0;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( (t) > (0) ) {
+      __parsec_bandwidth_PONG_task_t* ncc = (__parsec_bandwidth_PONG_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[bandwidth_PONG.task_class_id];
+        const int PONG_t = (t - 1);
+        if( (PONG_t >= (0)) && (PONG_t <= ((loops - 1))) ) {
+          assert(&nc.locals[0].value == &ncc->locals.t.value);
+          ncc->locals.t.value = PONG_t;
+          int PONG_f;
+        for( PONG_f = 0;PONG_f <= (frags - 1); PONG_f+=1) {
+            if( (PONG_f >= (0)) && (PONG_f <= ((frags - 1))) ) {
+              assert(&nc.locals[1].value == &ncc->locals.f.value);
+              ncc->locals.f.value = PONG_f;
+#if defined(DISTRIBUTED)
+              rank_dst = rank_of_Disk(0, ((ncc->locals.t.value + 1) % ws));
+              if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+                vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_Disk)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_Disk, 0, ((ncc->locals.t.value + 1) % ws));
+              nc.priority = __parsec_tp->super.super.priority;
+              successor_repo = PONG_repo;
+              successor_repo_key = __jdf2c_make_key_PONG((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+            RELEASE_DEP_OUTPUT(es, "C", this_task, "C", &nc, rank_src, rank_dst, &data);
+            if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_bandwidth_SYNC_for_C_dep1_atline_38, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+              }
+            }
+          }
+    }
+  }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static int release_deps_of_bandwidth_SYNC(parsec_execution_stream_t *es, __parsec_bandwidth_SYNC_task_t *this_task, uint32_t action_mask, parsec_remote_deps_t *deps)
+{
+  PARSEC_PINS(es, RELEASE_DEPS_BEGIN, (parsec_task_t *)this_task);  const __parsec_bandwidth_internal_taskpool_t *__parsec_tp = (const __parsec_bandwidth_internal_taskpool_t *)this_task->taskpool;
+  parsec_release_dep_fct_arg_t arg;
+  int __vp_id;
+  int consume_local_repo = 0;
+  arg.action_mask = action_mask;
+  arg.output_entry = NULL;
+  arg.output_repo = NULL;
+#if defined(DISTRIBUTED)
+  arg.remote_deps = deps;
+#endif  /* defined(DISTRIBUTED) */
+  assert(NULL != es);
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS )    arg.ready_lists = alloca(sizeof(parsec_task_t *) * es->virtual_process->parsec_context->nb_vp);
+  else
+    arg.ready_lists = NULL;
+  for( __vp_id = 0; __vp_id < es->virtual_process->parsec_context->nb_vp; arg.ready_lists[__vp_id++] = NULL );
+  (void)__parsec_tp; (void)deps;
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+  }
+  consume_local_repo = (this_task->repo_entry != NULL);
+  arg.output_repo = SYNC_repo;
+  arg.output_entry = this_task->repo_entry;
+  arg.output_usage = 0;
+  if( action_mask & (PARSEC_ACTION_RELEASE_LOCAL_DEPS | PARSEC_ACTION_GET_REPO_ENTRY) ) {
+    arg.output_entry = data_repo_lookup_entry_and_create( es, arg.output_repo, __jdf2c_make_key_SYNC((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    arg.output_entry->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(arg.output_entry->sim_exec_date == 0);
+    arg.output_entry->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  if(action_mask & ( PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE ) ){
+    /* Generate the reshape promise for the outputs that need it */
+    iterate_successors_of_bandwidth_SYNC(es, this_task, action_mask, parsec_set_up_reshape_promise, &arg);
+   }
+  iterate_successors_of_bandwidth_SYNC(es, this_task, action_mask, parsec_release_dep_fct, &arg);
+
+#if defined(DISTRIBUTED)
+  if( (action_mask & PARSEC_ACTION_SEND_REMOTE_DEPS) && (NULL != arg.remote_deps)) {
+    parsec_remote_dep_activate(es, (parsec_task_t *)this_task, arg.remote_deps, arg.remote_deps->outgoing_mask);
+  }
+#endif
+
+  if(action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS) {
+    data_repo_entry_addto_usage_limit(SYNC_repo, arg.output_entry->ht_item.key, arg.output_usage);
+    __parsec_schedule_vp(es, arg.ready_lists, 0);
+  }
+      if (consume_local_repo) {
+         data_repo_entry_used_once( SYNC_repo, this_task->repo_entry->ht_item.key );
+      }
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+  }
+  PARSEC_PINS(es, RELEASE_DEPS_END, (parsec_task_t *)this_task);  return 0;
+}
+
+static int data_lookup_of_bandwidth_SYNC(parsec_execution_stream_t *es, __parsec_bandwidth_SYNC_task_t *this_task)
+{
+  const __parsec_bandwidth_internal_taskpool_t *__parsec_tp = (__parsec_bandwidth_internal_taskpool_t *)this_task->taskpool;
+  parsec_assignment_t generic_locals[MAX_PARAM_COUNT];  /* generic task locals */
+  int target_device = 0; (void)target_device;
+  (void)__parsec_tp; (void)generic_locals; (void)es;
+  parsec_data_copy_t *chunk = NULL;
+  data_repo_t        *reshape_repo  = NULL, *consumed_repo  = NULL;
+  data_repo_entry_t  *reshape_entry = NULL, *consumed_entry = NULL;
+  parsec_key_t        reshape_entry_key = 0, consumed_entry_key = 0;
+  uint8_t             consumed_flow_index;
+  parsec_dep_data_description_t data;
+  int ret;
+  (void)reshape_repo; (void)reshape_entry; (void)reshape_entry_key;
+  (void)consumed_repo; (void)consumed_entry; (void)consumed_entry_key;
+  (void)consumed_flow_index;
+  (void)chunk; (void)data; (void)ret;
+  const int t = this_task->locals.t.value; (void)t;
+  if( NULL == this_task->repo_entry ){
+    this_task->repo_entry = data_repo_lookup_entry_and_create(es, SYNC_repo,                                       __jdf2c_make_key_SYNC((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    data_repo_entry_addto_usage_limit(SYNC_repo, this_task->repo_entry->ht_item.key, 1);    this_task->repo_entry ->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(this_task->repo_entry ->sim_exec_date == 0);
+    this_task->repo_entry ->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  /* The reshape repo is the current task repo. */  reshape_repo = SYNC_repo;
+  reshape_entry_key = __jdf2c_make_key_SYNC((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals) ;
+  reshape_entry = this_task->repo_entry;
+  /* Lookup the input data, and store them in the context if any */
+  /* C is a control flow */
+  this_task->data._f_C.data_in         = NULL;
+  this_task->data._f_C.data_out        = NULL;
+  this_task->data._f_C.source_repo       = NULL;
+  this_task->data._f_C.source_repo_entry = NULL;
+  /** Generate profiling information */
+#if defined(PARSEC_PROF_TRACE)
+  this_task->prof_info.desc = (parsec_data_collection_t*)__parsec_tp->super._g_Disk;
+  this_task->prof_info.priority = this_task->priority;
+  this_task->prof_info.data_id   = ((parsec_data_collection_t*)__parsec_tp->super._g_Disk)->data_key((parsec_data_collection_t*)__parsec_tp->super._g_Disk, 0, (t % ws));
+  this_task->prof_info.task_class_id = this_task->task_class->task_class_id;
+  this_task->prof_info.task_return_code = -1;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int datatype_lookup_of_bandwidth_SYNC(parsec_execution_stream_t *es, const parsec_task_t *this_generic_task, const parsec_task_t *parent_task,
+              uint32_t* flow_mask, parsec_dep_data_description_t* data)
+{
+  const __parsec_bandwidth_SYNC_task_t *this_task = (__parsec_bandwidth_SYNC_task_t*)this_generic_task;
+  const __parsec_bandwidth_internal_taskpool_t *__parsec_tp = (__parsec_bandwidth_internal_taskpool_t *)this_task->taskpool;
+  (void)__parsec_tp; (void)es; (void)this_task; (void)data; (void)parent_task;
+  const int t = this_task->locals.t.value; (void)t;
+  data->local.arena = data->remote.arena = NULL;
+  data->local.src_datatype  = data->local.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->local.src_count     = data->local.dst_count = 0;
+  data->local.src_displ     = data->local.dst_displ = 0;
+  data->data_future  = NULL;
+
+  /* these are the output dependencies remote datatypes */
+  data->data                             = NULL;
+  data->remote.src_datatype = data->remote.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->remote.src_count    = data->remote.dst_count = 0;
+  data->remote.src_displ    = data->remote.dst_displ = 0;
+  data->data_future  = NULL;
+  (*flow_mask) = 0;  /* nothing left */
+  (void)t;
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+static int hook_of_bandwidth_SYNC(parsec_execution_stream_t *es, __parsec_bandwidth_SYNC_task_t *this_task)
+{
+  __parsec_bandwidth_internal_taskpool_t *__parsec_tp = (__parsec_bandwidth_internal_taskpool_t *)this_task->taskpool;
+  (void)es; (void)__parsec_tp;
+  const int t = this_task->locals.t.value; (void)t;
+  (void)t;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                                  SYNC BODY                                    -----*/
+
+
+
+/*-----                                END OF SYNC BODY                                -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#endif  /*  defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+static int complete_hook_of_bandwidth_SYNC(parsec_execution_stream_t *es, __parsec_bandwidth_SYNC_task_t *this_task)
+{
+  const __parsec_bandwidth_internal_taskpool_t *__parsec_tp = (__parsec_bandwidth_internal_taskpool_t *)this_task->taskpool;
+#if defined(DISTRIBUTED)
+    const int t = this_task->locals.t.value; (void)t;
+#endif  /* defined(DISTRIBUTED) */
+  (void)es; (void)__parsec_tp;
+parsec_data_t* data_t_desc = NULL; (void)data_t_desc;
+#if defined(DISTRIBUTED)
+  /** If not working on distributed, there is no risk that data is not in place */
+  (void)t;
+
+#endif /* DISTRIBUTED */
+#if defined(PARSEC_PROF_GRAPHER)
+  parsec_prof_grapher_task((parsec_task_t*)this_task, es->th_id, es->virtual_process->vp_id,
+     __jdf2c_key_fns_SYNC.key_hash(this_task->task_class->make_key( (parsec_taskpool_t*)this_task->taskpool, ((parsec_task_t*)this_task)->locals), NULL));
+#endif  /* defined(PARSEC_PROF_GRAPHER) */
+  release_deps_of_bandwidth_SYNC(es, this_task,
+      PARSEC_ACTION_RELEASE_REMOTE_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_REFS |
+      PARSEC_ACTION_RESHAPE_ON_RELEASE |
+      0x1,  /* mask of all dep_index */ 
+      NULL);
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static parsec_hook_return_t release_task_of_bandwidth_SYNC(parsec_execution_stream_t *es, parsec_task_t *this_task)
+{
+    const __parsec_bandwidth_internal_taskpool_t *__parsec_tp =
+        (const __parsec_bandwidth_internal_taskpool_t *)this_task->taskpool;
+    parsec_hash_table_t *ht = (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[0];
+    parsec_key_t key = this_task->task_class->make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals);
+    parsec_hashable_dependency_t *hash_dep = (parsec_hashable_dependency_t *)parsec_hash_table_remove(ht, key);
+    parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);
+    return parsec_release_task_to_mempool_update_nbtasks(es, this_task);
+}
+
+static char *bandwidth_bandwidth_SYNC_internal_init_deps_key_functions_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_bandwidth_internal_taskpool_t *__parsec_tp = (__parsec_bandwidth_internal_taskpool_t *)user_data;
+  int t = (__parsec_key) % __parsec_tp->SYNC_t_range + __parsec_tp->SYNC_t_min;
+  __parsec_key = __parsec_key / __parsec_tp->SYNC_t_range;
+  snprintf(buffer, buffer_size, "SYNC(%d)", t);
+  return buffer;
+}
+
+static parsec_key_fn_t bandwidth_bandwidth_SYNC_internal_init_deps_key_functions = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = bandwidth_bandwidth_SYNC_internal_init_deps_key_functions_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/* Needs: min-max count-tasks iterate */
+static int bandwidth_SYNC_internal_init(parsec_execution_stream_t * es, __parsec_bandwidth_SYNC_task_t * this_task)
+{
+  __parsec_bandwidth_internal_taskpool_t *__parsec_tp = (__parsec_bandwidth_internal_taskpool_t*)this_task->taskpool;
+  int32_t nb_tasks = 0, saved_nb_tasks = 0;
+int32_t __t_min = 0x7fffffff, __t_max = 0;int32_t __jdf2c_t_min = 0x7fffffff, __jdf2c_t_max = 0;  __parsec_bandwidth_SYNC_parsec_assignment_t assignments = {  .t.value = 0 };
+  int32_t  t;
+  int32_t __jdf2c_t_start, __jdf2c_t_end, __jdf2c_t_inc;
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+  PARSEC_PROFILING_TRACE(es->es_profile,
+                         this_task->taskpool->profiling_array[START_KEY(this_task->task_class->task_class_id)],
+                         0,
+                         this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    __jdf2c_t_start = 0;
+    __jdf2c_t_end = (loops - 1);
+    __jdf2c_t_inc = 1;
+    __t_min = parsec_imin(__jdf2c_t_start, __jdf2c_t_end);
+    __t_max = parsec_imax(__jdf2c_t_start, __jdf2c_t_end);
+    __jdf2c_t_min = parsec_imin(__jdf2c_t_min, __t_min);
+    __jdf2c_t_max = parsec_imax(__jdf2c_t_max, __t_max);
+    for(t =  __jdf2c_t_start;
+        t <= __jdf2c_t_end;
+        t += __jdf2c_t_inc) {
+    assignments.t.value = t;
+    if( !SYNC_pred(t) ) continue;
+    nb_tasks++;
+  } /* Loop on normal range t */
+   if( 0 != nb_tasks ) {
+     (void)parsec_atomic_fetch_add_int32(&__parsec_tp->initial_number_tasks, nb_tasks);
+   }
+  /* Set the range variables for the collision-free hash-computation */
+  __parsec_tp->SYNC_t_min   = __jdf2c_t_min;
+  __parsec_tp->SYNC_t_range = (__jdf2c_t_max - __jdf2c_t_min) + 1;
+    do {
+      this_task->super.list_next = (parsec_list_item_t*)__parsec_tp->startup_queue;
+    } while(!parsec_atomic_cas_ptr(&__parsec_tp->startup_queue, (parsec_list_item_t*)this_task->super.list_next, this_task));
+    this_task->status = PARSEC_TASK_STATUS_HOOK;
+
+  PARSEC_AYU_REGISTER_TASK(&bandwidth_SYNC);
+  __parsec_tp->super.super.dependencies_array[0] = PARSEC_OBJ_NEW(parsec_hash_table_t);
+  parsec_hash_table_init(__parsec_tp->super.super.dependencies_array[0], offsetof(parsec_hashable_dependency_t, ht_item), 10, bandwidth_bandwidth_SYNC_internal_init_deps_key_functions, this_task->taskpool);
+  __parsec_tp->repositories[0] = data_repo_create_nothreadsafe(nb_tasks, __jdf2c_key_fns_SYNC, (parsec_taskpool_t*)__parsec_tp, 1);
+(void)saved_nb_tasks;
+(void)__t_min; (void)__t_max;  (void)__jdf2c_t_start; (void)__jdf2c_t_end; (void)__jdf2c_t_inc;  (void)assignments; (void)__parsec_tp; (void)es;
+  if(1 == parsec_atomic_fetch_dec_int32(&__parsec_tp->sync_point)) {
+    /* Last initialization task complete. Update the number of tasks. */
+    __parsec_tp->super.super.tdm.module->taskpool_addto_nb_tasks(&__parsec_tp->super.super, __parsec_tp->initial_number_tasks);
+    parsec_mfence();  /* write memory barrier to guarantee that the scheduler gets the correct number of tasks */
+    parsec_taskpool_enable((parsec_taskpool_t*)__parsec_tp, &__parsec_tp->startup_queue,
+                           (parsec_task_t*)this_task, es, __parsec_tp->super.super.nb_pending_actions);
+    __parsec_tp->super.super.tdm.module->taskpool_ready(&__parsec_tp->super.super);
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+    PARSEC_PROFILING_TRACE(es->es_profile,
+                           this_task->taskpool->profiling_array[2 * this_task->task_class->task_class_id + 1],
+                           0,
+                           this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    if( 1 >= __parsec_tp->super.super.nb_pending_actions ) {
+        /* if no tasks will be generated let's prevent the runtime from calling the hook and instead go directly to complete the task */
+        this_task->status = PARSEC_TASK_STATUS_COMPLETE;
+    }
+    return PARSEC_HOOK_RETURN_DONE;
+  }
+  return PARSEC_HOOK_RETURN_ASYNC;
+}
+
+static int __jdf2c_startup_SYNC(parsec_execution_stream_t * es, __parsec_bandwidth_SYNC_task_t *this_task)
+{
+  __parsec_bandwidth_SYNC_task_t* new_task;
+  __parsec_bandwidth_internal_taskpool_t* __parsec_tp = (__parsec_bandwidth_internal_taskpool_t*)this_task->taskpool;
+  parsec_context_t *context = __parsec_tp->super.super.context;
+  int vpid = 0, nb_tasks = 0;
+  size_t total_nb_tasks = 0;
+  parsec_list_item_t* pready_ring[context->nb_vp];
+  int restore_context = 0;
+  int t = this_task->locals.t.value;  /* retrieve value saved during the last iteration */
+  for(int _i = 0; _i < context->nb_vp; pready_ring[_i++] = NULL );
+  if( 0 != this_task->locals.reserved[0].value ) {
+    this_task->locals.reserved[0].value = 1; /* reset the submission process */
+    restore_context = 1;
+    goto restore_context_0;
+  }
+  this_task->locals.reserved[0].value = 1; /* a sane default value */
+  for(this_task->locals.t.value = t = 0;
+      this_task->locals.t.value <= (loops - 1);
+      this_task->locals.t.value += 1, t = this_task->locals.t.value) {
+    if( !SYNC_pred(t) ) continue;
+  __parsec_bandwidth_SYNC_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_bandwidth_SYNC_parsec_assignment_t*)&this_task->locals;
+  (void)__jdf2c__tmp_locals;
+  if( (t) > (0) ) continue; /* C PONG() is not a memory reference for flow C */
+    if( NULL != ((parsec_data_collection_t*)__parsec_tp->super._g_Disk)->vpid_of ) {
+      vpid = ((parsec_data_collection_t*)__parsec_tp->super._g_Disk)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_Disk, 0, (t % ws));
+      assert(context->nb_vp >= vpid);
+    } else {
+      vpid = (vpid + 1) % context->nb_vp;  /* spread the initial joy */
+    }
+    new_task = (__parsec_bandwidth_SYNC_task_t*)parsec_thread_mempool_allocate( context->virtual_processes[vpid]->execution_streams[0]->context_mempool );
+    PARSEC_OBJ_CONSTRUCT(new_task, parsec_task_t); /* construct called only when new, force-construct it again */
+    /* Copy only the valid elements from this_task to new_task one */
+    new_task->taskpool   = this_task->taskpool;
+    new_task->task_class = __parsec_tp->super.super.task_classes_array[bandwidth_SYNC.task_class_id];
+    new_task->chore_mask   = PARSEC_DEV_ALL;
+    new_task->locals.t.value = this_task->locals.t.value;
+    PARSEC_LIST_ITEM_SINGLETON(new_task);
+    new_task->priority = __parsec_tp->super.super.priority;
+    new_task->repo_entry = NULL;
+    new_task->data._f_C.source_repo_entry = NULL;
+    new_task->data._f_C.source_repo       = NULL;
+    new_task->data._f_C.data_in         = NULL;
+    new_task->data._f_C.data_out        = NULL;
+    new_task->data._f_C.fulfill         = 0;
+#if defined(PARSEC_DEBUG_NOISIER)
+    {
+      char tmp[128];
+      PARSEC_DEBUG_VERBOSE(10, parsec_debug_output, "Add startup task %s to vpid %d",
+             parsec_task_snprintf(tmp, 128, (parsec_task_t*)new_task), vpid);
+    }
+#endif
+    parsec_dependencies_mark_task_as_startup((parsec_task_t*)new_task, es);
+    pready_ring[vpid] = parsec_list_item_ring_push_sorted(pready_ring[vpid],
+                                                          (parsec_list_item_t*)new_task,
+                                                          parsec_execution_context_priority_comparator);
+    nb_tasks++;
+   restore_context_0:  /* we jump here just so that we have code after the label */
+    restore_context = 0;
+    (void)restore_context;
+    if( nb_tasks > this_task->locals.reserved[0].value ) {
+      if( (size_t)this_task->locals.reserved[0].value < parsec_task_startup_iter ) this_task->locals.reserved[0].value <<= 1;
+      __parsec_schedule_vp(es, (parsec_task_t**)pready_ring, 0);
+      total_nb_tasks += nb_tasks;
+      nb_tasks = 0;
+      if( total_nb_tasks > parsec_task_startup_chunk ) {  /* stop here and request to be rescheduled */
+        return PARSEC_HOOK_RETURN_AGAIN;
+      }
+    }
+  } /* Loop on normal range t */
+  (void)vpid;
+  if( 0 != nb_tasks ) {
+    __parsec_schedule_vp(es, (parsec_task_t**)pready_ring, 0);
+    nb_tasks = 0;
+  }
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static const __parsec_chore_t __bandwidth_SYNC_chores[] ={
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+    { .type     = PARSEC_DEV_CPU,
+      .evaluate = (parsec_evaluate_function_t*)NULL,
+      .hook     = (parsec_hook_t*)hook_of_bandwidth_SYNC },
+#endif  /* defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+    { .type     = PARSEC_DEV_NONE,
+      .evaluate = NULL,
+      .hook     = (parsec_hook_t*)NULL },  /* End marker */
+};
+
+static const parsec_task_class_t bandwidth_SYNC = {
+  .name = "SYNC",
+  .task_class_id = 0,
+  .nb_flows = 1,
+  .nb_parameters = 1,
+  .nb_locals = 1,
+  .task_class_type = PARSEC_TASK_CLASS_TYPE_PTG,
+  .params = { &symb_bandwidth_SYNC_t, NULL },
+  .locals = { &symb_bandwidth_SYNC_t, NULL },
+  .data_affinity = (parsec_data_ref_fn_t*)affinity_of_bandwidth_SYNC,
+  .initial_data = (parsec_data_ref_fn_t*)affinity_of_bandwidth_SYNC,
+  .final_data = (parsec_data_ref_fn_t*)affinity_of_bandwidth_SYNC,
+  .priority = NULL,
+  .properties = properties_of_bandwidth_SYNC,
+#if MAX_PARAM_COUNT < 0  /* number of read flows of SYNC */
+  #error Too many read flows for task SYNC
+#endif  /* MAX_PARAM_COUNT */
+#if MAX_PARAM_COUNT < 0  /* number of write flows of SYNC */
+  #error Too many write flows for task SYNC
+#endif  /* MAX_PARAM_COUNT */
+  .in = { &flow_of_bandwidth_SYNC_for_C, NULL },
+  .out = { &flow_of_bandwidth_SYNC_for_C, NULL },
+  .flags = 0x0 | PARSEC_HAS_IN_IN_DEPENDENCIES|PARSEC_HAS_CTL_GATHER,
+  .dependencies_goal = 1,
+  .make_key = __jdf2c_make_key_SYNC,
+  .task_snprintf = parsec_task_snprintf,
+#if defined(PARSEC_PROF_TRACE)
+  .profile_info = &parsec_task_profile_info,
+#endif
+  .key_functions = &__jdf2c_key_fns_SYNC,
+  .fini = (parsec_hook_t*)NULL,
+  .incarnations = __bandwidth_SYNC_chores,
+  .find_deps = parsec_hash_find_deps,
+  .update_deps = parsec_update_deps_with_counter,
+  .iterate_successors = (parsec_traverse_function_t*)iterate_successors_of_bandwidth_SYNC,
+  .iterate_predecessors = (parsec_traverse_function_t*)iterate_predecessors_of_bandwidth_SYNC,
+  .release_deps = (parsec_release_deps_t*)release_deps_of_bandwidth_SYNC,
+  .prepare_output = (parsec_hook_t*)NULL,
+  .prepare_input = (parsec_hook_t*)data_lookup_of_bandwidth_SYNC,
+  .time_estimate = NULL,
+  .get_datatype = datatype_lookup_of_bandwidth_SYNC,
+  .complete_execution = (parsec_hook_t*)complete_hook_of_bandwidth_SYNC,
+  .release_task = &release_task_of_bandwidth_SYNC,
+#if defined(PARSEC_SIM)
+  .sim_cost_fct = (parsec_sim_cost_fct_t*)NULL,
+#endif
+};
+
+
+static const parsec_task_class_t *bandwidth_task_classes[] = {
+  &bandwidth_SYNC,
+  &bandwidth_PING,
+  &bandwidth_PONG
+};
+
+static void bandwidth_startup(parsec_context_t *context, __parsec_bandwidth_internal_taskpool_t *__parsec_tp, parsec_list_item_t ** ready_tasks)
+{
+  uint32_t i, supported_dev = 0;
+ 
+  for( i = 0; i < parsec_nb_devices; i++ ) {
+    if( !(__parsec_tp->super.super.devices_index_mask & (1<<i)) ) continue;
+    parsec_device_module_t* device = parsec_mca_device_get(i);
+    parsec_data_collection_t* parsec_dc;
+ 
+    if(NULL == device) continue;
+    if(NULL != device->taskpool_register)
+      if( PARSEC_SUCCESS != device->taskpool_register(device, (parsec_taskpool_t*)__parsec_tp) ) {
+        parsec_debug_verbose(5, parsec_debug_output, "Device %s refused to register taskpool %p", device->name, __parsec_tp);
+        __parsec_tp->super.super.devices_index_mask &= ~(1 << device->device_index);
+        continue;
+      }
+    if(NULL != device->memory_register) {  /* Register all the data */
+      parsec_dc = (parsec_data_collection_t*)__parsec_tp->super._g_descA;
+      if( (NULL != parsec_dc->register_memory) &&
+          (PARSEC_SUCCESS != parsec_dc->register_memory(parsec_dc, device)) ) {
+        parsec_debug_verbose(3, parsec_debug_output, "Device %s refused to register memory for data %s (%p) from taskpool %p",
+                     device->name, parsec_dc->key_base, parsec_dc, __parsec_tp);
+        __parsec_tp->super.super.devices_index_mask &= ~(1 << device->device_index);
+      }
+      parsec_dc = (parsec_data_collection_t*)__parsec_tp->super._g_Disk;
+      if( (NULL != parsec_dc->register_memory) &&
+          (PARSEC_SUCCESS != parsec_dc->register_memory(parsec_dc, device)) ) {
+        parsec_debug_verbose(3, parsec_debug_output, "Device %s refused to register memory for data %s (%p) from taskpool %p",
+                     device->name, parsec_dc->key_base, parsec_dc, __parsec_tp);
+        __parsec_tp->super.super.devices_index_mask &= ~(1 << device->device_index);
+      }
+    }
+    supported_dev |= device->type;
+  }
+  /* Remove all the chores without a backend device */
+  for( i = 0; i < PARSEC_bandwidth_NB_TASK_CLASSES; i++ ) {
+    parsec_task_class_t* tc = (parsec_task_class_t*)__parsec_tp->super.super.task_classes_array[i];
+    __parsec_chore_t* chores = (__parsec_chore_t*)tc->incarnations;
+    uint32_t idx = 0, j;
+    for( j = 0; PARSEC_DEV_NONE != chores[j].type; j++ ) {
+      if( !(supported_dev & chores[j].type) ) continue;
+      if( j != idx ) {
+        chores[idx] = chores[j];
+        parsec_debug_verbose(20, parsec_debug_output, "Device type %i disabled for function %s"
+, chores[j].type, tc->name);
+      }
+      idx++;
+    }
+    chores[idx].type     = PARSEC_DEV_NONE;
+    chores[idx].evaluate = NULL;
+    chores[idx].hook     = NULL;
+    /* Create the initialization tasks for each taskclass */
+    parsec_task_t* task = (parsec_task_t*)parsec_thread_mempool_allocate(context->virtual_processes[0]->execution_streams[0]->context_mempool);
+    PARSEC_OBJ_CONSTRUCT(task, parsec_task_t); /* construct called only when new, force-construct it again */
+    task->taskpool = (parsec_taskpool_t *)__parsec_tp;
+    task->chore_mask = PARSEC_DEV_CPU;
+    memset(&task->locals, 0, sizeof(parsec_assignment_t) * MAX_LOCAL_COUNT);
+    PARSEC_LIST_ITEM_SINGLETON(task);
+    task->priority = -1;
+    task->task_class = task->taskpool->task_classes_array[PARSEC_bandwidth_NB_TASK_CLASSES + i];
+    int where = i % context->nb_vp;
+    if( NULL == ready_tasks[where] ) ready_tasks[where] = &task->super;
+    else ready_tasks[where] = parsec_list_item_ring_push(ready_tasks[where], &task->super);
+  }
+}
+static void __parsec_bandwidth_internal_destructor( __parsec_bandwidth_internal_taskpool_t *__parsec_tp )
+{
+  uint32_t i;
+  parsec_taskpool_unregister( &__parsec_tp->super.super );
+  if(NULL != __parsec_tp->super.super.tdm.module) __parsec_tp->super.super.tdm.module->unmonitor_taskpool(&__parsec_tp->super.super);
+  for( i = 0; i < (uint32_t)(2 * __parsec_tp->super.super.nb_task_classes); i++ ) {  /* Extra startup function added at the end */
+    parsec_task_class_t* tc = (parsec_task_class_t*)__parsec_tp->super.super.task_classes_array[i];
+    free((void*)tc->incarnations);
+    free(tc);
+  }
+  free(__parsec_tp->super.super.task_classes_array); __parsec_tp->super.super.task_classes_array = NULL;
+  __parsec_tp->super.super.nb_task_classes = 0;
+
+  for(i = 0; i < (uint32_t)__parsec_tp->super.arenas_datatypes_size; i++) {
+    if( NULL != __parsec_tp->super.arenas_datatypes[i].arena ) {
+      PARSEC_OBJ_RELEASE(__parsec_tp->super.arenas_datatypes[i].arena);
+    }
+  }
+  /* Destroy the data repositories for this object */
+   data_repo_destroy_nothreadsafe(__parsec_tp->repositories[2]);  /* PONG */
+   data_repo_destroy_nothreadsafe(__parsec_tp->repositories[1]);  /* PING */
+   data_repo_destroy_nothreadsafe(__parsec_tp->repositories[0]);  /* SYNC */
+  /* Release the dependencies arrays for this object */
+  parsec_hash_table_fini( (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[2] );
+  PARSEC_OBJ_RELEASE(__parsec_tp->super.super.dependencies_array[2]);
+  __parsec_tp->super.super.dependencies_array[2] = NULL;
+  parsec_hash_table_fini( (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[1] );
+  PARSEC_OBJ_RELEASE(__parsec_tp->super.super.dependencies_array[1]);
+  __parsec_tp->super.super.dependencies_array[1] = NULL;
+  parsec_hash_table_fini( (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[0] );
+  PARSEC_OBJ_RELEASE(__parsec_tp->super.super.dependencies_array[0]);
+  __parsec_tp->super.super.dependencies_array[0] = NULL;
+  free( __parsec_tp->super.super.dependencies_array );
+  __parsec_tp->super.super.dependencies_array = NULL;
+  /* Unregister all the data */
+  uint32_t _i;
+  for( _i = 0; _i < parsec_nb_devices; _i++ ) {
+    parsec_device_module_t* device;
+    parsec_data_collection_t* parsec_dc;
+    if(!(__parsec_tp->super.super.devices_index_mask & (1 << _i))) continue;
+    if((NULL == (device = parsec_mca_device_get(_i))) || (NULL == device->memory_unregister)) continue;
+    parsec_dc = (parsec_data_collection_t*)__parsec_tp->super._g_descA;
+  if( NULL != parsec_dc->unregister_memory ) { (void)parsec_dc->unregister_memory(parsec_dc, device); };
+  parsec_dc = (parsec_data_collection_t*)__parsec_tp->super._g_Disk;
+  if( NULL != parsec_dc->unregister_memory ) { (void)parsec_dc->unregister_memory(parsec_dc, device); };
+}
+  /* Unregister the taskpool from the devices */
+  for( i = 0; i < parsec_nb_devices; i++ ) {
+    if(!(__parsec_tp->super.super.devices_index_mask & (1 << i))) continue;
+    __parsec_tp->super.super.devices_index_mask ^= (1 << i);
+    parsec_device_module_t* device = parsec_mca_device_get(i);
+    if((NULL == device) || (NULL == device->taskpool_unregister)) continue;
+    if( PARSEC_SUCCESS != device->taskpool_unregister(device, &__parsec_tp->super.super) ) continue;
+  }
+  free(__parsec_tp->super.super.taskpool_name); __parsec_tp->super.super.taskpool_name = NULL;
+}
+
+void __parsec_bandwidth_internal_constructor(__parsec_bandwidth_internal_taskpool_t* __parsec_tp)
+{
+  parsec_task_class_t* tc;
+  uint32_t i, j;
+
+  __parsec_tp->super.super.nb_task_classes = PARSEC_bandwidth_NB_TASK_CLASSES;
+  __parsec_tp->super.super.devices_index_mask = PARSEC_DEVICES_ALL;
+  __parsec_tp->super.super.taskpool_name = strdup("bandwidth");
+  parsec_termdet_open_module(&__parsec_tp->super.super, "local");
+  __parsec_tp->super.super.tdm.module->monitor_taskpool(&__parsec_tp->super.super,
+                                                        parsec_taskpool_termination_detected);
+  __parsec_tp->super.super.update_nb_runtime_task = parsec_add_fetch_runtime_task;
+  __parsec_tp->super.super.dependencies_array = (void **)
+              calloc(__parsec_tp->super.super.nb_task_classes, sizeof(void*));
+  /* Twice the size to hold the startup tasks function_t */
+  __parsec_tp->super.super.task_classes_array = (const parsec_task_class_t**)
+              calloc((2 * PARSEC_bandwidth_NB_TASK_CLASSES + 1), sizeof(parsec_task_class_t*));
+  __parsec_tp->super.super.tdm.module->taskpool_addto_runtime_actions(&__parsec_tp->super.super, PARSEC_bandwidth_NB_TASK_CLASSES);  /* for the startup tasks */
+  __parsec_tp->super.super.taskpool_type = PARSEC_TASKPOOL_TYPE_PTG;
+  __parsec_tp->sync_point = __parsec_tp->super.super.nb_task_classes;
+  __parsec_tp->initial_number_tasks = 0;
+  __parsec_tp->startup_queue = NULL;
+  for( i = 0; i < __parsec_tp->super.super.nb_task_classes; i++ ) {
+    __parsec_tp->super.super.task_classes_array[i] = tc = malloc(sizeof(parsec_task_class_t));
+    memcpy(tc, bandwidth_task_classes[i], sizeof(parsec_task_class_t));
+    for( j = 0; PARSEC_DEV_NONE != tc->incarnations[j].type; j++);  /* compute the number of incarnations */
+    tc->incarnations = (__parsec_chore_t*)malloc((j+1) * sizeof(__parsec_chore_t));
+        memcpy((__parsec_chore_t*)tc->incarnations, bandwidth_task_classes[i]->incarnations, (j+1) * sizeof(__parsec_chore_t));
+
+    /* Add a placeholder for initialization and startup task */
+    __parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+i] = tc = (parsec_task_class_t*)malloc(sizeof(parsec_task_class_t));
+    memcpy(tc, (void*)&__parsec_generic_startup, sizeof(parsec_task_class_t));
+    tc->task_class_id = __parsec_tp->super.super.nb_task_classes + i;
+    tc->incarnations = (__parsec_chore_t*)malloc(2 * sizeof(__parsec_chore_t));
+    memcpy((__parsec_chore_t*)tc->incarnations, (void*)__parsec_generic_startup.incarnations, 2 * sizeof(__parsec_chore_t));
+    tc->release_task = parsec_release_task_to_mempool_and_count_as_runtime_tasks;
+  }
+  /* Startup task for PONG */
+  tc = (parsec_task_class_t *)__parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+0];
+  tc->name = "Startup for PONG";
+  tc->prepare_input = (parsec_hook_t*)bandwidth_PONG_internal_init;
+  /* Startup task for PING */
+  tc = (parsec_task_class_t *)__parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+1];
+  tc->name = "Startup for PING";
+  tc->prepare_input = (parsec_hook_t*)bandwidth_PING_internal_init;
+  /* Startup task for SYNC */
+  tc = (parsec_task_class_t *)__parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+2];
+  tc->name = "Startup for SYNC";
+  tc->prepare_input = (parsec_hook_t*)bandwidth_SYNC_internal_init;
+  ((__parsec_chore_t*)&tc->incarnations[0])->hook = (parsec_hook_t *)__jdf2c_startup_SYNC;
+  /* Compute the number of arenas_datatypes: */
+  /*   PARSEC_bandwidth_DEFAULT_ARENA  ->  0 */
+  __parsec_tp->super.arenas_datatypes_size = 1;
+  memset(&__parsec_tp->super.arenas_datatypes[0], 0, __parsec_tp->super.arenas_datatypes_size*sizeof(parsec_arena_datatype_t));
+  /* If profiling is enabled, the keys for profiling */
+#  if defined(PARSEC_PROF_TRACE)
+  __parsec_tp->super.super.profiling_array = bandwidth_profiling_array;
+  if( -2 == bandwidth_profiling_array[0] ) {
+    #if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+parsec_profiling_add_dictionary_keyword("bandwidth::PONG::internal init", "fill:34D8D8",
+                                       0,
+                                       NULL,
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(bandwidth_PONG.task_class_id  + PARSEC_bandwidth_NB_TASK_CLASSES)/* PONG (internal init) start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(bandwidth_PONG.task_class_id  + PARSEC_bandwidth_NB_TASK_CLASSES)/* PONG (internal init) end key */]);
+#endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+parsec_profiling_add_dictionary_keyword("bandwidth::PONG", "fill:CC2828",
+                                       sizeof(parsec_task_prof_info_t)+2*sizeof(parsec_assignment_t),
+                                       "dc_key{uint64_t};priority{int32_t};dc_dataid{uint32_t};tcid{uint32_t};trc{int32_t};t{int32_t};f{int32_t}",
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(bandwidth_PONG.task_class_id) /* PONG start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(bandwidth_PONG.task_class_id) /* PONG end key */]);
+
+    #if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+parsec_profiling_add_dictionary_keyword("bandwidth::PING::internal init", "fill:D834D8",
+                                       0,
+                                       NULL,
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(bandwidth_PING.task_class_id  + PARSEC_bandwidth_NB_TASK_CLASSES)/* PING (internal init) start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(bandwidth_PING.task_class_id  + PARSEC_bandwidth_NB_TASK_CLASSES)/* PING (internal init) end key */]);
+#endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+parsec_profiling_add_dictionary_keyword("bandwidth::PING", "fill:28CC28",
+                                       sizeof(parsec_task_prof_info_t)+2*sizeof(parsec_assignment_t),
+                                       "dc_key{uint64_t};priority{int32_t};dc_dataid{uint32_t};tcid{uint32_t};trc{int32_t};t{int32_t};f{int32_t}",
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(bandwidth_PING.task_class_id) /* PING start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(bandwidth_PING.task_class_id) /* PING end key */]);
+
+    #if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+parsec_profiling_add_dictionary_keyword("bandwidth::SYNC::internal init", "fill:D8D834",
+                                       0,
+                                       NULL,
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(bandwidth_SYNC.task_class_id  + PARSEC_bandwidth_NB_TASK_CLASSES)/* SYNC (internal init) start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(bandwidth_SYNC.task_class_id  + PARSEC_bandwidth_NB_TASK_CLASSES)/* SYNC (internal init) end key */]);
+#endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+parsec_profiling_add_dictionary_keyword("bandwidth::SYNC", "fill:2828CC",
+                                       sizeof(parsec_task_prof_info_t)+1*sizeof(parsec_assignment_t),
+                                       "dc_key{uint64_t};priority{int32_t};dc_dataid{uint32_t};tcid{uint32_t};trc{int32_t};t{int32_t}",
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(bandwidth_SYNC.task_class_id) /* SYNC start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(bandwidth_SYNC.task_class_id) /* SYNC end key */]);
+
+  }
+#  endif /* defined(PARSEC_PROF_TRACE) */
+  __parsec_tp->super.super.repo_array = __parsec_tp->repositories;
+  __parsec_tp->super.super.startup_hook = (parsec_startup_fn_t)bandwidth_startup;
+  (void)parsec_taskpool_reserve_id((parsec_taskpool_t*)__parsec_tp);
+}
+
+  /** Generate class declaration and instance using the above constructor and destructor */
+  PARSEC_OBJ_CLASS_DECLARATION(__parsec_bandwidth_internal_taskpool_t);
+  PARSEC_OBJ_CLASS_INSTANCE(__parsec_bandwidth_internal_taskpool_t, parsec_bandwidth_taskpool_t,
+                            __parsec_bandwidth_internal_constructor, __parsec_bandwidth_internal_destructor);
+
+#undef descA
+#undef Disk
+#undef loops
+#undef frags
+#undef ws
+
+parsec_bandwidth_taskpool_t *parsec_bandwidth_new(parsec_tiled_matrix_t* descA /* data descA */, parsec_tiled_matrix_t* Disk /* data Disk */, int loops, int frags, int ws)
+{
+  __parsec_bandwidth_internal_taskpool_t *__parsec_tp = PARSEC_OBJ_NEW(__parsec_bandwidth_internal_taskpool_t);
+  /* Dump the hidden parameters with default values */
+
+  /* Now the Parameter-dependent structures: */
+  __parsec_tp->super._g_descA = descA;
+  __parsec_tp->super._g_Disk = Disk;
+  __parsec_tp->super._g_loops = loops;
+  __parsec_tp->super._g_frags = frags;
+  __parsec_tp->super._g_ws = ws;
+  PARSEC_AYU_REGISTER_TASK(&bandwidth_PONG);
+  PARSEC_AYU_REGISTER_TASK(&bandwidth_PING);
+  PARSEC_AYU_REGISTER_TASK(&bandwidth_SYNC);
+  __parsec_tp->super.super.startup_hook = (parsec_startup_fn_t)bandwidth_startup;
+  (void)parsec_taskpool_reserve_id((parsec_taskpool_t*)__parsec_tp);
+/* Prevent warnings related to not used hidden global variables */
+;
+  return (parsec_bandwidth_taskpool_t*)__parsec_tp;
+}
+
+
+/**
+ * @brief bandwidth,  no-blocking 
+ *
+ * @param [in] dcA: data 
+ * @param [in] Disk: distribution 
+ * @param [in] loops: loops of bandwidth 
+ * @param [in] frags: fragments
+ * @param [in] ws: number of process
+ * @param [in] size: number of doubles
+ */
+parsec_taskpool_t*
+parsec_bandwidth_New(parsec_tiled_matrix_t *dcA,
+                    parsec_tiled_matrix_t *Disk,
+                    int loops, int frags, int ws, int size)
+{
+  parsec_taskpool_t* bandwidth_taskpool;
+  parsec_bandwidth_taskpool_t* taskpool = NULL;
+
+  if( loops < 1 || frags < 1 || size < 1) {
+    fprintf(stderr, "loops/frags/size should not smaller than 1\n");
+    exit(1);
+  }
+
+  taskpool = parsec_bandwidth_new(dcA, Disk, loops, frags, ws); 
+  bandwidth_taskpool = (parsec_taskpool_t*)taskpool;
+
+  parsec_add2arena( &taskpool->arenas_datatypes[PARSEC_bandwidth_DEFAULT_ADT_IDX],
+                           parsec_datatype_double_t, PARSEC_MATRIX_FULL,
+                           1, 1, size, 1,
+                           PARSEC_ARENA_ALIGNMENT_SSE, -1 );
+
+  return bandwidth_taskpool;
+}
+
+/**
+ * @param [inout] the parsec object to destroy
+*/
+void parsec_bandwidth_Destruct(parsec_taskpool_t *taskpool)
+{
+  parsec_bandwidth_taskpool_t *bandwidth_taskpool = (parsec_bandwidth_taskpool_t *)taskpool;
+  parsec_del2arena(&bandwidth_taskpool->arenas_datatypes[PARSEC_bandwidth_DEFAULT_ADT_IDX]);
+  parsec_taskpool_free(taskpool);
+}
+
+/**
+ * @brief bandwidth 
+ * 
+ * @param [in] dcA: data 
+ * @param [in] Disk: distribution 
+ * @param [in] loops: loops of bandwidth
+ * @param [in] frags: fragments
+ * @param [in] ws: number of process 
+ * @param [in] size: number of doubles
+ */
+int parsec_bandwidth(parsec_context_t *parsec,
+                    parsec_tiled_matrix_t *dcA,
+                    parsec_tiled_matrix_t *Disk,
+                    int loops, int frags, int ws, int size)
+{
+  parsec_taskpool_t *parsec_bandwidth = NULL;
+
+  parsec_bandwidth = parsec_bandwidth_New(dcA, Disk, loops, frags, ws, size);
+
+  if( parsec_bandwidth != NULL ){
+      parsec_enqueue(parsec, parsec_bandwidth);
+      parsec_context_start(parsec);
+      parsec_context_wait(parsec);
+      parsec_bandwidth_Destruct(parsec_bandwidth);
+  }
+
+  return 0;
+}
+
+int main(int argc, char *argv[])
+{
+    parsec_context_t* parsec;
+    parsec_taskpool_t* bandwidth_taskpool;
+    parsec_bandwidth_taskpool_t* taskpool = NULL;
+    int rank, nodes, ch, i;
+    int pargc = 0;
+    char **pargv = NULL;
+    struct timeval tstart, tend;
+    double t, bw;
+
+    /* Default */
+    int loops = 100;
+    int frags = 60;
+    int size = 1024;
+    int cores = 1;
+    int nb_runs = 1;
+
+#if defined(PARSEC_HAVE_MPI)
+    {
+        int provided;
+        MPI_Init_thread(&argc, &argv, MPI_THREAD_MULTIPLE, &provided);
+    }
+    MPI_Comm_size(MPI_COMM_WORLD, &nodes);
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#else
+    nodes = 1;
+    rank = 0;
+#endif
+
+    while ((ch = getopt(argc, argv, "n:f:l:c:h:e:")) != -1) {
+        switch (ch) {
+            case 'n': loops = atoi(optarg); break;
+            case 'f': frags = atoi(optarg); break;
+            case 'l': size = atoi(optarg) / sizeof(double); break;
+            case 'e': nb_runs = atoi(optarg); break;
+            case 'c': cores = atoi(optarg); break;
+            case '?': case 'h': default:
+                fprintf(stderr,
+                        "-n : loops of bandwidth(default: 100)\n"
+                        "-f : frags, number of fragments (default: 60)\n"
+                        "-l : size, size of message (default: 1024 * sizeof(double))\n"
+                        "-c : number of cores used (default: 1)\n"
+                        "-e : number of runs (default: 1)\n"
+                        "\n");
+                 exit(1);
+        }
+    }
+
+    for(i = 1; i < argc; i++) {
+        if( strcmp(argv[i], "--") == 0 ) {
+            pargc = argc - i;
+            pargv = argv + i;
+            break;
+        }
+    }
+    /* Initialize PaRSEC */
+    parsec = parsec_init(cores, &pargc, &pargv);
+
+    if( NULL == parsec ) {
+        /* Failed to correctly initialize. In a correct scenario report
+         * upstream, but in this particular case bail out.
+         */
+        exit(-1);
+    }
+
+    /* If the number of cores has not been defined as a parameter earlier
+     * update it with the default parameter computed in parsec_init. */
+    if(cores <= 0)
+    {
+        int p, nb_total_comp_threads = 0;
+        for(p = 0; p < parsec->nb_vp; p++) {
+            nb_total_comp_threads += parsec->virtual_processes[p]->nb_cores;
+        }
+        cores = nb_total_comp_threads;
+    }
+
+    /* initializing matrix structure */
+    parsec_matrix_block_cyclic_t dcA;
+    parsec_matrix_block_cyclic_init(&dcA, PARSEC_MATRIX_DOUBLE, PARSEC_MATRIX_TILE,
+                              rank, 1, size, frags, size, 0, 0,
+                              frags, size,
+                              1, nodes, 1, 1, 0, 0);
+    dcA.mat = parsec_data_allocate((size_t)dcA.super.nb_local_tiles *
+                                   (size_t)dcA.super.bsiz *
+                                   (size_t)parsec_datadist_getsizeoftype(dcA.super.mtype));
+    parsec_data_collection_set_key((parsec_data_collection_t*)&dcA, "dcA");
+
+    parsec_matrix_block_cyclic_t Disk;
+    parsec_matrix_block_cyclic_init(&Disk, PARSEC_MATRIX_DOUBLE, PARSEC_MATRIX_TILE,
+                              rank, 1, 1, 1, nodes, 0, 0,
+                              1, nodes,
+                              1, nodes, 1, 1, 0, 0);
+    parsec_data_collection_set_key((parsec_data_collection_t*)&Disk, "Disk");
+
+    for(i = 0; i < nb_runs; i++) {
+        /* bandwidth */
+        taskpool = parsec_bandwidth_new((parsec_tiled_matrix_t *)&dcA,
+                                       (parsec_tiled_matrix_t *)&Disk,
+                                       loops, frags, nodes);
+
+        bandwidth_taskpool = (parsec_taskpool_t*)taskpool;
+
+        parsec_add2arena( &taskpool->arenas_datatypes[PARSEC_bandwidth_DEFAULT_ADT_IDX],
+                                 parsec_datatype_double_t, PARSEC_MATRIX_FULL,
+                                 1, 1, size, 1,
+                                 PARSEC_ARENA_ALIGNMENT_SSE, -1 );
+
+        /* Time start */
+#if defined(PARSEC_HAVE_MPI)
+        MPI_Barrier(MPI_COMM_WORLD);
+#endif  /* defined(PARSEC_HAVE_MPI) */
+        gettimeofday(&tstart, NULL);
+
+        parsec_context_add_taskpool(parsec, bandwidth_taskpool);
+        parsec_context_start(parsec);
+        parsec_context_wait(parsec);
+
+        /* Time end */
+#if defined(PARSEC_HAVE_MPI)
+        MPI_Barrier(MPI_COMM_WORLD);
+#endif  /* defined(PARSEC_HAVE_MPI) */
+        gettimeofday(&tend, NULL);
+
+        if( 0 == rank ) {
+            t = (tend.tv_sec - tstart.tv_sec) * 1000000.0 + (tend.tv_usec - tstart.tv_usec);
+            bw = ((double)loops * (double)frags * (double)size) / t * 1000.0 * 1000.0 / (1000.0 * 1000.0 * 1000.0) * sizeof(double) * 8;
+            printf("%d %d %zu %08.4g %4.8g GB/s %4.8g msg/s\n", loops, frags, size*sizeof(double), t / 1000000.0, bw,
+                   (double)loops * (double)frags / t * 1000000.0);
+        }
+
+        parsec_bandwidth_Destruct(bandwidth_taskpool);
+    }
+
+    parsec_tiled_matrix_destroy((parsec_tiled_matrix_t*)&dcA);
+    parsec_tiled_matrix_destroy((parsec_tiled_matrix_t*)&Disk);
+
+    /* Clean up parsec*/
+    parsec_fini(&parsec);
+
+#ifdef PARSEC_HAVE_MPI
+    MPI_Finalize();
+#endif
+
+    return 0;
+}
+
+PARSEC_OBJ_CLASS_INSTANCE(parsec_bandwidth_taskpool_t, parsec_taskpool_t, NULL, NULL);
+
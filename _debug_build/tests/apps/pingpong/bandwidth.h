@@ -0,0 +1,124 @@
+#ifndef _bandwidth_h_
+#define _bandwidth_h_
+#include "parsec.h"
+#include "parsec/parsec_internal.h"
+#include "parsec/remote_dep.h"
+
+BEGIN_C_DECLS
+
+#define PARSEC_bandwidth_DEFAULT_ADT_IDX    0
+#define PARSEC_bandwidth_ADT_IDX_MAX       1
+typedef struct parsec_bandwidth_taskpool_s {
+  parsec_taskpool_t super;
+  /* The list of globals */
+  parsec_tiled_matrix_t* _g_descA /* data descA */;
+  parsec_tiled_matrix_t* _g_Disk /* data Disk */;
+  int _g_loops;
+  int _g_frags;
+  int _g_ws;
+  /* The array of datatypes (DEFAULT and co.) */
+  parsec_arena_datatype_t arenas_datatypes[PARSEC_bandwidth_ADT_IDX_MAX];
+  uint32_t arenas_datatypes_size;
+} parsec_bandwidth_taskpool_t;
+
+/** Beware that this object is not a superset of the internal object, and as a result
+ *  we should never create one directly. Instead we should rely on the creation of the
+ *  internal object (__parsec_bandwidth_taskpool_t).
+ */
+PARSEC_OBJ_CLASS_DECLARATION(parsec_bandwidth_taskpool_t);
+extern parsec_bandwidth_taskpool_t *parsec_bandwidth_new(parsec_tiled_matrix_t* _g_descA /* data descA */, parsec_tiled_matrix_t* _g_Disk /* data Disk */, int _g_loops, int _g_frags, int _g_ws);
+
+#if MAX_LOCAL_COUNT < 2  /* number of parameters and locals PONG */
+  #error Too many parameters and local variables (2 out of MAX_LOCAL_COUNT) for task PONG
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_bandwidth_PONG_assignment_s {
+  parsec_assignment_t t;
+  parsec_assignment_t f;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-2];
+} __parsec_bandwidth_PONG_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 2  /* total number of flows for task PONG */
+  #error Too many flows (2 out of MAX_PARAM_COUNT) for task PONG
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_bandwidth_PONG_data_s {
+  parsec_data_pair_t _f_T;
+  parsec_data_pair_t _f_C;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-2];
+} __parsec_bandwidth_PONG_data_t;
+
+typedef struct __parsec_bandwidth_PONG_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_bandwidth_PONG_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_bandwidth_PONG_data_s data;
+} __parsec_bandwidth_PONG_task_t;
+
+
+#if MAX_LOCAL_COUNT < 2  /* number of parameters and locals PING */
+  #error Too many parameters and local variables (2 out of MAX_LOCAL_COUNT) for task PING
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_bandwidth_PING_assignment_s {
+  parsec_assignment_t t;
+  parsec_assignment_t f;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-2];
+} __parsec_bandwidth_PING_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 2  /* total number of flows for task PING */
+  #error Too many flows (2 out of MAX_PARAM_COUNT) for task PING
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_bandwidth_PING_data_s {
+  parsec_data_pair_t _f_T;
+  parsec_data_pair_t _f_C;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-2];
+} __parsec_bandwidth_PING_data_t;
+
+typedef struct __parsec_bandwidth_PING_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_bandwidth_PING_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_bandwidth_PING_data_s data;
+} __parsec_bandwidth_PING_task_t;
+
+
+#if MAX_LOCAL_COUNT < 1  /* number of parameters and locals SYNC */
+  #error Too many parameters and local variables (1 out of MAX_LOCAL_COUNT) for task SYNC
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_bandwidth_SYNC_assignment_s {
+  parsec_assignment_t t;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-1];
+} __parsec_bandwidth_SYNC_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 1  /* total number of flows for task SYNC */
+  #error Too many flows (1 out of MAX_PARAM_COUNT) for task SYNC
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_bandwidth_SYNC_data_s {
+  parsec_data_pair_t _f_C;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-1];
+} __parsec_bandwidth_SYNC_data_t;
+
+typedef struct __parsec_bandwidth_SYNC_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_bandwidth_SYNC_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_bandwidth_SYNC_data_s data;
+} __parsec_bandwidth_SYNC_task_t;
+
+
+END_C_DECLS
+
+#endif /* _bandwidth_h_ */ 
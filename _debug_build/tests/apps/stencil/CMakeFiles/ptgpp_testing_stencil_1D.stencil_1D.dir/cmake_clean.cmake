@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ptgpp_testing_stencil_1D.stencil_1D"
+  "stencil_1D.c"
+  "stencil_1D.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ptgpp_testing_stencil_1D.stencil_1D.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
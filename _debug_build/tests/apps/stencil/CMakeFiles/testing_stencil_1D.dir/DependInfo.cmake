@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/_debug_build/tests/apps/stencil/stencil_1D.c" "tests/apps/stencil/CMakeFiles/testing_stencil_1D.dir/stencil_1D.c.o" "gcc" "tests/apps/stencil/CMakeFiles/testing_stencil_1D.dir/stencil_1D.c.o.d"
+  "/root/repo/tests/apps/stencil/stencil_internal.c" "tests/apps/stencil/CMakeFiles/testing_stencil_1D.dir/stencil_internal.c.o" "gcc" "tests/apps/stencil/CMakeFiles/testing_stencil_1D.dir/stencil_internal.c.o.d"
+  "/root/repo/tests/apps/stencil/testing_stencil_1D.c" "tests/apps/stencil/CMakeFiles/testing_stencil_1D.dir/testing_stencil_1D.c.o" "gcc" "tests/apps/stencil/CMakeFiles/testing_stencil_1D.dir/testing_stencil_1D.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_debug_build/parsec/CMakeFiles/parsec.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "/root/repo/_debug_build/parsec/include/fortran")
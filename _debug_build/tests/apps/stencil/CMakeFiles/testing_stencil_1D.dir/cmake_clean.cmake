@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testing_stencil_1D.dir/stencil_1D.c.o"
+  "CMakeFiles/testing_stencil_1D.dir/stencil_1D.c.o.d"
+  "CMakeFiles/testing_stencil_1D.dir/stencil_internal.c.o"
+  "CMakeFiles/testing_stencil_1D.dir/stencil_internal.c.o.d"
+  "CMakeFiles/testing_stencil_1D.dir/testing_stencil_1D.c.o"
+  "CMakeFiles/testing_stencil_1D.dir/testing_stencil_1D.c.o.d"
+  "testing_stencil_1D"
+  "testing_stencil_1D.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/testing_stencil_1D.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
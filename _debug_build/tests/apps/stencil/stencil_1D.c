@@ -0,0 +1,2564 @@
+#include "parsec.h"
+#include "parsec/parsec_internal.h"
+#include "parsec/ayudame.h"
+#include "parsec/execution_stream.h"
+#include "parsec/parsec_binary_profile.h"
+#include "parsec/mca/device/device_gpu.h"
+#if defined(PARSEC_HAVE_DEV_CUDA_SUPPORT)
+#include "parsec/mca/device/cuda/device_cuda.h"
+#endif  /* defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) */
+#if defined(PARSEC_HAVE_DEV_HIP_SUPPORT)
+#include "parsec/mca/device/hip/device_hip.h"
+#endif  /* defined(PARSEC_HAVE_DEV_HIP_SUPPORT) */
+#if defined(_MSC_VER) || defined(__MINGW32__)
+#  include <malloc.h>
+#else
+#  include <alloca.h>
+#endif  /* defined(_MSC_VER) || defined(__MINGW32__) */
+
+#define PARSEC_stencil_1D_NB_TASK_CLASSES 1
+#define PARSEC_stencil_1D_NB_DATA 1
+
+typedef struct __parsec_stencil_1D_internal_taskpool_s __parsec_stencil_1D_internal_taskpool_t;
+struct parsec_stencil_1D_internal_taskpool_s;
+
+/** Predeclarations of the parsec_task_class_t */
+static const parsec_task_class_t stencil_1D_task;
+/** Predeclarations of the parameters */
+static const parsec_flow_t flow_of_stencil_1D_task_for_A;
+static const parsec_flow_t flow_of_stencil_1D_task_for_AL;
+static const parsec_flow_t flow_of_stencil_1D_task_for_AR;
+static const parsec_flow_t flow_of_stencil_1D_task_for_A0;
+/*
+ * Copyright (c) 2019-2024 The University of Tennessee and The University
+ *                         of Tennessee Research Foundation. All rights
+ *                         reserved.
+ */
+#include "stencil_internal.h"
+
+/* Automatically check datatype */
+const int sizeof_datatype = sizeof(DTYPE);
+
+/**
+ * @brief stencil_1D copy data to ghost region
+ *
+ * @param [out] A0: output data
+ * @param [in] AL: left input data
+ * @param [in] AR: right input data
+ * @param [in] MB: row tile size
+ * @param [in] NB: column tile size
+ * @param [in] myrank: my rank
+ * @param [in] rank_L: rank of left neighbor
+ * @param [in] rank_R: rank of right neighbor
+ * @param [in] R: radius of ghost region
+ * @param [in] n: column index
+ * @param [in] n_max: max column index
+ */
+static void CORE_copydata_stencil_1D(DTYPE *A0, DTYPE *AL, DTYPE *AR, int MB,
+                                  int NB, int myrank, int rank_L, int rank_R,
+                                  int R, int n, int n_max) {
+    int disp_AL, disp_AR, disp_A0;
+
+    /* Displacement of AL */
+    if( myrank == rank_L ) {
+        disp_AL = MB * (NB - 2 * R);
+    } else {
+        disp_AL = 0;
+    }
+
+    /* Copy AL to left ghost region of A0 */
+    if( n > 0 ) {
+        memcpy((void *)A0, (void *)(AL+disp_AL), MB*R*sizeof(DTYPE));
+    }
+
+    /* Displacement of AR */
+    if( myrank == rank_R ) {
+        disp_AR = MB * R;
+    } else {
+        disp_AR = 0;
+    }
+
+    /* Displacement of right ghost region of A0 */
+    disp_A0 = MB * (NB - R);
+
+    /* Copy AR to right ghost region of A0 */
+    if( n < n_max ) {
+        memcpy((void *)(A0+disp_A0), (void *)(AR+disp_AR), MB*R*sizeof(DTYPE));
+    }
+}
+
+#define PARSEC_stencil_1D_DEFAULT_ADT    (&__parsec_tp->super.arenas_datatypes[PARSEC_stencil_1D_DEFAULT_ADT_IDX])
+#define PARSEC_stencil_1D_LR_ADT    (&__parsec_tp->super.arenas_datatypes[PARSEC_stencil_1D_LR_ADT_IDX])
+#define PARSEC_stencil_1D_FULL_ADT    (&__parsec_tp->super.arenas_datatypes[PARSEC_stencil_1D_FULL_ADT_IDX])
+#include "stencil_1D.h"
+
+struct __parsec_stencil_1D_internal_taskpool_s {
+ parsec_stencil_1D_taskpool_t super;
+ volatile int32_t sync_point;
+ volatile int32_t initial_number_tasks;
+ parsec_task_t* startup_queue;
+  /* The ranges to compute the hash key */
+  int task_t_min;
+  int task_t_range;
+  int task_n_min;
+  int task_n_range;
+  /* The list of data repositories  task */
+  data_repo_t* repositories[1];
+};
+
+#if defined(PARSEC_PROF_TRACE)
+#  if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+static int stencil_1D_profiling_array[4*PARSEC_stencil_1D_NB_TASK_CLASSES] = {-2}; /* 2 pairs (begin, end) per task, times two because each task class has an internal_init task */
+#  else /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+static int stencil_1D_profiling_array[2*PARSEC_stencil_1D_NB_TASK_CLASSES] = {-2}; /* 2 pairs (begin, end) per task */
+#  endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+#endif  /* defined(PARSEC_PROF_TRACE) */
+/* Globals */
+#define descA __parsec_tp->super._g_descA
+#define iter (__parsec_tp->super._g_iter)
+#define R (__parsec_tp->super._g_R)
+
+static inline int parsec_imin(int a, int b) { return (a <= b) ? a : b; };
+
+static inline int parsec_imax(int a, int b) { return (a >= b) ? a : b; };
+
+static inline int32_t stencil_1D_task_inline_c_expr1_line_92(const __parsec_stencil_1D_internal_taskpool_t *__parsec_tp, const __parsec_stencil_1D_task_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task task */
+  const int t = assignments->t.value; (void)t;
+  const int m = assignments->m.value; (void)m;
+  const int n = assignments->n.value; (void)n;
+  const int myrank = assignments->myrank.value; (void)myrank;
+  const int rank_L = assignments->rank_L.value; (void)rank_L;
+  const int rank_R = assignments->rank_R.value; (void)rank_R;
+
+  (void)t;  (void)m;  (void)n;  (void)myrank;  (void)rank_L;  (void)rank_R;
+
+ return sizeof_datatype*descA->mb*(descA->nb-2*R); 
+}
+
+static inline int32_t stencil_1D_task_inline_c_expr2_line_91(const __parsec_stencil_1D_internal_taskpool_t *__parsec_tp, const __parsec_stencil_1D_task_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task task */
+  const int t = assignments->t.value; (void)t;
+  const int m = assignments->m.value; (void)m;
+  const int n = assignments->n.value; (void)n;
+  const int myrank = assignments->myrank.value; (void)myrank;
+  const int rank_L = assignments->rank_L.value; (void)rank_L;
+  const int rank_R = assignments->rank_R.value; (void)rank_R;
+
+  (void)t;  (void)m;  (void)n;  (void)myrank;  (void)rank_L;  (void)rank_R;
+
+ return sizeof_datatype*descA->mb*R; 
+}
+
+static inline int32_t stencil_1D_task_inline_c_expr3_line_79(const __parsec_stencil_1D_internal_taskpool_t *__parsec_tp, const __parsec_stencil_1D_task_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task task */
+  const int t = assignments->t.value; (void)t;
+  const int m = assignments->m.value; (void)m;
+  const int n = assignments->n.value; (void)n;
+  const int myrank = assignments->myrank.value; (void)myrank;
+  const int rank_L = assignments->rank_L.value; (void)rank_L;
+  const int rank_R = assignments->rank_R.value; (void)rank_R;
+
+  (void)t;  (void)m;  (void)n;  (void)myrank;  (void)rank_L;  (void)rank_R;
+
+ return rank_neighbor(descA, 0, n+1, descA->lmt-1, descA->lnt-1); 
+}
+
+static inline int32_t stencil_1D_task_inline_c_expr4_line_78(const __parsec_stencil_1D_internal_taskpool_t *__parsec_tp, const __parsec_stencil_1D_task_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task task */
+  const int t = assignments->t.value; (void)t;
+  const int m = assignments->m.value; (void)m;
+  const int n = assignments->n.value; (void)n;
+  const int myrank = assignments->myrank.value; (void)myrank;
+  const int rank_L = assignments->rank_L.value; (void)rank_L;
+  const int rank_R = assignments->rank_R.value; (void)rank_R;
+
+  (void)t;  (void)m;  (void)n;  (void)myrank;  (void)rank_L;  (void)rank_R;
+
+ return rank_neighbor(descA, 0, n-1, descA->lmt-1, descA->lnt-1); 
+}
+
+/* Data Access Macros */
+#define data_of_descA(descA_d0, descA_d1)  (((parsec_data_collection_t*)__parsec_tp->super._g_descA)->data_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, (descA_d0), (descA_d1)))
+
+#define rank_of_descA(descA_d0, descA_d1)  (((parsec_data_collection_t*)__parsec_tp->super._g_descA)->rank_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, (descA_d0), (descA_d1)))
+
+/* Functions Predicates */
+#define task_pred(t, m, n, myrank, rank_L, rank_R) (((parsec_data_collection_t*)(__parsec_tp->super._g_descA))->myrank == rank_of_descA(m, n))
+
+/* Data Repositories */
+#define task_repo (__parsec_tp->repositories[0])
+/* Release dependencies output macro */
+#if defined(PARSEC_DEBUG_NOISIER)
+#define RELEASE_DEP_OUTPUT(ES, DEPO, TASKO, DEPI, TASKI, RSRC, RDST, DATA)\
+  do { \
+    char tmp1[128], tmp2[128]; (void)tmp1; (void)tmp2;\
+    PARSEC_DEBUG_VERBOSE(20, parsec_debug_output, "thread %d VP %d explore deps from %s:%s to %s:%s (from rank %d to %d) base ptr %p",\
+           (NULL != (ES) ? (ES)->th_id : -1), (NULL != (ES) ? (ES)->virtual_process->vp_id : -1),\
+           DEPO, parsec_task_snprintf(tmp1, 128, (parsec_task_t*)(TASKO)),\
+           DEPI, parsec_task_snprintf(tmp2, 128, (parsec_task_t*)(TASKI)), (RSRC), (RDST), (DATA));\
+  } while(0)
+#define ACQUIRE_FLOW(TASKI, DEPI, FUNO, DEPO, LOCALS, PTR)\
+  do { \
+    char tmp1[128], tmp2[128]; (void)tmp1; (void)tmp2;\
+    PARSEC_DEBUG_VERBOSE(20, parsec_debug_output, "task %s acquires flow %s from %s %s data ptr %p",\
+           parsec_task_snprintf(tmp1, 128, (parsec_task_t*)(TASKI)), (DEPI),\
+           (DEPO), parsec_snprintf_assignments(tmp2, 128, (FUNO), (parsec_assignment_t*)(LOCALS)), (PTR));\
+  } while(0)
+#else
+#define RELEASE_DEP_OUTPUT(ES, DEPO, TASKO, DEPI, TASKI, RSRC, RDST, DATA)
+#define ACQUIRE_FLOW(TASKI, DEPI, TASKO, DEPO, LOCALS, PTR)
+#endif
+static inline parsec_key_t __jdf2c_make_key_task(const parsec_taskpool_t *tp, const parsec_assignment_t *as)
+{
+  const __parsec_stencil_1D_internal_taskpool_t *__parsec_tp = (const __parsec_stencil_1D_internal_taskpool_t *)tp;
+  const __parsec_stencil_1D_task_parsec_assignment_t *assignment = (const __parsec_stencil_1D_task_parsec_assignment_t*)as;
+  uint64_t __parsec_id = 0;
+  __parsec_id += (assignment->t.value - __parsec_tp->task_t_min);
+  __parsec_id += (assignment->n.value - __parsec_tp->task_n_min) * __parsec_tp->task_t_range;
+  return (parsec_key_t)__parsec_id;
+}
+static char *__jdf2c_key_fns_task_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_stencil_1D_internal_taskpool_t *__parsec_tp = (__parsec_stencil_1D_internal_taskpool_t *)user_data;
+  __parsec_stencil_1D_task_parsec_assignment_t __jdf2c__assignments = {  .t.value = 0, .m.value = 0, .n.value = 0, .myrank.value = 0, .rank_L.value = 0, .rank_R.value = 0 };
+  int t = (__parsec_key) % __parsec_tp->task_t_range + __parsec_tp->task_t_min;
+  __parsec_key = __parsec_key / __parsec_tp->task_t_range;
+  __jdf2c__assignments.t.value = t;
+  int m = (t % descA->lmt);
+  (void)m;
+  __jdf2c__assignments.m.value = m;
+  int n = (__parsec_key) % __parsec_tp->task_n_range + __parsec_tp->task_n_min;
+  __parsec_key = __parsec_key / __parsec_tp->task_n_range;
+  __jdf2c__assignments.n.value = n;
+  int myrank = descA->super.myrank;
+  (void)myrank;
+  __jdf2c__assignments.myrank.value = myrank;
+  int rank_L = stencil_1D_task_inline_c_expr4_line_78(__parsec_tp, &__jdf2c__assignments);
+  (void)rank_L;
+  __jdf2c__assignments.rank_L.value = rank_L;
+  int rank_R = stencil_1D_task_inline_c_expr3_line_79(__parsec_tp, &__jdf2c__assignments);
+  (void)rank_R;
+  __jdf2c__assignments.rank_R.value = rank_R;
+  (void)__jdf2c__assignments;
+  snprintf(buffer, buffer_size, "task(%d, %d)", t, n);
+  return buffer;
+}
+
+static parsec_key_fn_t __jdf2c_key_fns_task = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = __jdf2c_key_fns_task_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/******                                      task                                      ******/
+
+static inline int32_t minexpr_of_symb_stencil_1D_task_t_fct(const __parsec_stencil_1D_internal_taskpool_t *__parsec_tp, const __parsec_stencil_1D_task_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_stencil_1D_task_t = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_stencil_1D_task_t_fct }
+                   }
+};
+static inline int maxexpr_of_symb_stencil_1D_task_t_fct(const __parsec_stencil_1D_internal_taskpool_t *__parsec_tp, const __parsec_stencil_1D_task_parsec_assignment_t *locals)
+{
+  const int t = locals->t.value; (void)t;
+  const int m = locals->m.value; (void)m;
+  const int n = locals->n.value; (void)n;
+  const int myrank = locals->myrank.value; (void)myrank;
+  const int rank_L = locals->rank_L.value; (void)rank_L;
+  const int rank_R = locals->rank_R.value; (void)rank_R;
+
+  (void)t;
+  (void)m;
+  (void)n;
+  (void)myrank;
+  (void)rank_L;
+  (void)rank_R;
+  (void)__parsec_tp; (void)locals;
+  return iter;
+}
+static const parsec_expr_t maxexpr_of_symb_stencil_1D_task_t = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_stencil_1D_task_t_fct }
+                   }
+};
+static const parsec_symbol_t symb_stencil_1D_task_t = { .name = "t", .context_index = 0, .min = &minexpr_of_symb_stencil_1D_task_t, .max = &maxexpr_of_symb_stencil_1D_task_t, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int expr_of_symb_stencil_1D_task_m_fct(const __parsec_stencil_1D_internal_taskpool_t *__parsec_tp, const __parsec_stencil_1D_task_parsec_assignment_t *locals)
+{
+  const int t = locals->t.value; (void)t;
+  const int m = locals->m.value; (void)m;
+  const int n = locals->n.value; (void)n;
+  const int myrank = locals->myrank.value; (void)myrank;
+  const int rank_L = locals->rank_L.value; (void)rank_L;
+  const int rank_R = locals->rank_R.value; (void)rank_R;
+
+  (void)t;
+  (void)m;
+  (void)n;
+  (void)myrank;
+  (void)rank_L;
+  (void)rank_R;
+  (void)__parsec_tp; (void)locals;
+  return (t % descA->lmt);
+}
+static const parsec_expr_t expr_of_symb_stencil_1D_task_m = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_stencil_1D_task_m_fct }
+                   }
+};
+static const parsec_symbol_t symb_stencil_1D_task_m = { .name = "m", .context_index = 1, .min = &expr_of_symb_stencil_1D_task_m, .max = &expr_of_symb_stencil_1D_task_m, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t minexpr_of_symb_stencil_1D_task_n_fct(const __parsec_stencil_1D_internal_taskpool_t *__parsec_tp, const __parsec_stencil_1D_task_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_stencil_1D_task_n = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_stencil_1D_task_n_fct }
+                   }
+};
+static inline int maxexpr_of_symb_stencil_1D_task_n_fct(const __parsec_stencil_1D_internal_taskpool_t *__parsec_tp, const __parsec_stencil_1D_task_parsec_assignment_t *locals)
+{
+  const int t = locals->t.value; (void)t;
+  const int m = locals->m.value; (void)m;
+  const int n = locals->n.value; (void)n;
+  const int myrank = locals->myrank.value; (void)myrank;
+  const int rank_L = locals->rank_L.value; (void)rank_L;
+  const int rank_R = locals->rank_R.value; (void)rank_R;
+
+  (void)t;
+  (void)m;
+  (void)n;
+  (void)myrank;
+  (void)rank_L;
+  (void)rank_R;
+  (void)__parsec_tp; (void)locals;
+  return (descA->lnt - 1);
+}
+static const parsec_expr_t maxexpr_of_symb_stencil_1D_task_n = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_stencil_1D_task_n_fct }
+                   }
+};
+static const parsec_symbol_t symb_stencil_1D_task_n = { .name = "n", .context_index = 2, .min = &minexpr_of_symb_stencil_1D_task_n, .max = &maxexpr_of_symb_stencil_1D_task_n, .cst_inc = 1, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int expr_of_symb_stencil_1D_task_myrank_fct(const __parsec_stencil_1D_internal_taskpool_t *__parsec_tp, const __parsec_stencil_1D_task_parsec_assignment_t *locals)
+{
+  const int t = locals->t.value; (void)t;
+  const int m = locals->m.value; (void)m;
+  const int n = locals->n.value; (void)n;
+  const int myrank = locals->myrank.value; (void)myrank;
+  const int rank_L = locals->rank_L.value; (void)rank_L;
+  const int rank_R = locals->rank_R.value; (void)rank_R;
+
+  (void)t;
+  (void)m;
+  (void)n;
+  (void)myrank;
+  (void)rank_L;
+  (void)rank_R;
+  (void)__parsec_tp; (void)locals;
+  return descA->super.myrank;
+}
+static const parsec_expr_t expr_of_symb_stencil_1D_task_myrank = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_stencil_1D_task_myrank_fct }
+                   }
+};
+static const parsec_symbol_t symb_stencil_1D_task_myrank = { .name = "myrank", .context_index = 3, .min = &expr_of_symb_stencil_1D_task_myrank, .max = &expr_of_symb_stencil_1D_task_myrank, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_stencil_1D_task_rank_L_fct(const __parsec_stencil_1D_internal_taskpool_t *__parsec_tp, const __parsec_stencil_1D_task_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return stencil_1D_task_inline_c_expr4_line_78(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_stencil_1D_task_rank_L = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_stencil_1D_task_rank_L_fct }
+                   }
+};
+static const parsec_symbol_t symb_stencil_1D_task_rank_L = { .name = "rank_L", .context_index = 4, .min = &expr_of_symb_stencil_1D_task_rank_L, .max = &expr_of_symb_stencil_1D_task_rank_L, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_stencil_1D_task_rank_R_fct(const __parsec_stencil_1D_internal_taskpool_t *__parsec_tp, const __parsec_stencil_1D_task_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return stencil_1D_task_inline_c_expr3_line_79(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_stencil_1D_task_rank_R = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_stencil_1D_task_rank_R_fct }
+                   }
+};
+static const parsec_symbol_t symb_stencil_1D_task_rank_R = { .name = "rank_R", .context_index = 5, .min = &expr_of_symb_stencil_1D_task_rank_R, .max = &expr_of_symb_stencil_1D_task_rank_R, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int affinity_of_stencil_1D_task(const __parsec_stencil_1D_task_task_t *this_task,
+                     parsec_data_ref_t *ref)
+{
+    const __parsec_stencil_1D_internal_taskpool_t *__parsec_tp = (const __parsec_stencil_1D_internal_taskpool_t*)this_task->taskpool;
+  const int t = this_task->locals.t.value; (void)t;
+  const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+  const int myrank = this_task->locals.myrank.value; (void)myrank;
+  const int rank_L = this_task->locals.rank_L.value; (void)rank_L;
+  const int rank_R = this_task->locals.rank_R.value; (void)rank_R;
+
+  /* Silent Warnings: should look into predicate to know what variables are usefull */
+  (void)t;
+  (void)m;
+  (void)n;
+  (void)myrank;
+  (void)rank_L;
+  (void)rank_R;
+  ref->dc = (parsec_data_collection_t *)__parsec_tp->super._g_descA;
+  /* Compute data key */
+  ref->key = ref->dc->data_key(ref->dc, m, n);
+  return 1;
+}
+static const parsec_property_t properties_of_stencil_1D_task[1] = {
+  {.name = NULL, .expr = NULL}
+};
+static parsec_data_t *flow_of_stencil_1D_task_for_A_dep1_atline_89_direct_access(const __parsec_stencil_1D_internal_taskpool_t *__parsec_tp, const __parsec_stencil_1D_task_parsec_assignment_t *assignments)
+{
+  const int t = assignments->t.value; (void)t;
+  const int m = assignments->m.value; (void)m;
+  const int n = assignments->n.value; (void)n;
+  const int myrank = assignments->myrank.value; (void)myrank;
+  const int rank_L = assignments->rank_L.value; (void)rank_L;
+  const int rank_R = assignments->rank_R.value; (void)rank_R;
+
+  /* Silence Warnings: should look into parameters to know what variables are useful */
+  (void)t;
+  (void)m;
+  (void)n;
+  (void)myrank;
+  (void)rank_L;
+  (void)rank_R;
+  if( __parsec_tp->super.super.context->my_rank == (int32_t)rank_of_descA(m, n) )
+    return data_of_descA(m, n);
+  return NULL;
+}
+
+static const parsec_dep_t flow_of_stencil_1D_task_for_A_dep1_atline_89 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = PARSEC_LOCAL_DATA_TASK_CLASS_ID, /* stencil_1D_descA */
+  .direct_data = (parsec_data_lookup_func_t)&flow_of_stencil_1D_task_for_A_dep1_atline_89_direct_access,
+  .dep_index = 3,
+  .dep_datatype_index = 3,
+  .belongs_to = &flow_of_stencil_1D_task_for_A,
+};
+static inline int expr_of_cond_for_flow_of_stencil_1D_task_for_A_dep2_atline_90_fct(const __parsec_stencil_1D_internal_taskpool_t *__parsec_tp, const __parsec_stencil_1D_task_parsec_assignment_t *locals)
+{
+  const int t = locals->t.value; (void)t;
+  const int m = locals->m.value; (void)m;
+  const int n = locals->n.value; (void)n;
+  const int myrank = locals->myrank.value; (void)myrank;
+  const int rank_L = locals->rank_L.value; (void)rank_L;
+  const int rank_R = locals->rank_R.value; (void)rank_R;
+
+  (void)t;
+  (void)m;
+  (void)n;
+  (void)myrank;
+  (void)rank_L;
+  (void)rank_R;
+  (void)__parsec_tp; (void)locals;
+  return (t) < (iter);
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_stencil_1D_task_for_A_dep2_atline_90 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_stencil_1D_task_for_A_dep2_atline_90_fct }
+                   }
+};
+static const parsec_dep_t flow_of_stencil_1D_task_for_A_dep2_atline_90 = {
+  .cond = &expr_of_cond_for_flow_of_stencil_1D_task_for_A_dep2_atline_90,  /* (t) < (iter) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 0, /* stencil_1D_task */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_stencil_1D_task_for_A0,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_stencil_1D_task_for_A,
+};
+static inline int expr_of_cond_for_flow_of_stencil_1D_task_for_A_dep3_atline_91_fct(const __parsec_stencil_1D_internal_taskpool_t *__parsec_tp, const __parsec_stencil_1D_task_parsec_assignment_t *locals)
+{
+  const int t = locals->t.value; (void)t;
+  const int m = locals->m.value; (void)m;
+  const int n = locals->n.value; (void)n;
+  const int myrank = locals->myrank.value; (void)myrank;
+  const int rank_L = locals->rank_L.value; (void)rank_L;
+  const int rank_R = locals->rank_R.value; (void)rank_R;
+
+  (void)t;
+  (void)m;
+  (void)n;
+  (void)myrank;
+  (void)rank_L;
+  (void)rank_R;
+  (void)__parsec_tp; (void)locals;
+  return ((t) < (iter) && (n) > (0));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_stencil_1D_task_for_A_dep3_atline_91 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_stencil_1D_task_for_A_dep3_atline_91_fct }
+                   }
+};
+static const parsec_dep_t flow_of_stencil_1D_task_for_A_dep3_atline_91 = {
+  .cond = &expr_of_cond_for_flow_of_stencil_1D_task_for_A_dep3_atline_91,  /* ((t) < (iter) && (n) > (0)) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 0, /* stencil_1D_task */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_stencil_1D_task_for_AR,
+  .dep_index = 1,
+  .dep_datatype_index = 1,
+  .belongs_to = &flow_of_stencil_1D_task_for_A,
+};
+static inline int expr_of_cond_for_flow_of_stencil_1D_task_for_A_dep4_atline_92_fct(const __parsec_stencil_1D_internal_taskpool_t *__parsec_tp, const __parsec_stencil_1D_task_parsec_assignment_t *locals)
+{
+  const int t = locals->t.value; (void)t;
+  const int m = locals->m.value; (void)m;
+  const int n = locals->n.value; (void)n;
+  const int myrank = locals->myrank.value; (void)myrank;
+  const int rank_L = locals->rank_L.value; (void)rank_L;
+  const int rank_R = locals->rank_R.value; (void)rank_R;
+
+  (void)t;
+  (void)m;
+  (void)n;
+  (void)myrank;
+  (void)rank_L;
+  (void)rank_R;
+  (void)__parsec_tp; (void)locals;
+  return ((t) < (iter) && (n) < ((descA->lnt - 1)));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_stencil_1D_task_for_A_dep4_atline_92 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_stencil_1D_task_for_A_dep4_atline_92_fct }
+                   }
+};
+static const parsec_dep_t flow_of_stencil_1D_task_for_A_dep4_atline_92 = {
+  .cond = &expr_of_cond_for_flow_of_stencil_1D_task_for_A_dep4_atline_92,  /* ((t) < (iter) && (n) < ((descA->lnt - 1))) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 0, /* stencil_1D_task */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_stencil_1D_task_for_AL,
+  .dep_index = 2,
+  .dep_datatype_index = 2,
+  .belongs_to = &flow_of_stencil_1D_task_for_A,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+#if MAX_DEP_OUT_COUNT < 3  /* number of output dependencies */
+    #error Too many output dependencies (supports up to MAX_DEP_OUT_COUNT [=10] but found 3). Fix the code or recompile PaRSEC with a larger MAX_DEP_OUT_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_stencil_1D_task_for_A = {
+  .name               = "A",
+  .sym_type           = PARSEC_SYM_INOUT,
+  .flow_flags         = PARSEC_FLOW_ACCESS_RW|PARSEC_FLOW_HAS_IN_DEPS,
+  .flow_index         = 0,
+  .flow_datatype_mask = 0x7,
+  .dep_in     = { &flow_of_stencil_1D_task_for_A_dep1_atline_89 },
+  .dep_out    = { &flow_of_stencil_1D_task_for_A_dep2_atline_90,
+ &flow_of_stencil_1D_task_for_A_dep3_atline_91,
+ &flow_of_stencil_1D_task_for_A_dep4_atline_92 }
+};
+
+static inline int expr_of_cond_for_flow_of_stencil_1D_task_for_AL_dep1_atline_83_iftrue_fct(const __parsec_stencil_1D_internal_taskpool_t *__parsec_tp, const __parsec_stencil_1D_task_parsec_assignment_t *locals)
+{
+  const int t = locals->t.value; (void)t;
+  const int m = locals->m.value; (void)m;
+  const int n = locals->n.value; (void)n;
+  const int myrank = locals->myrank.value; (void)myrank;
+  const int rank_L = locals->rank_L.value; (void)rank_L;
+  const int rank_R = locals->rank_R.value; (void)rank_R;
+
+  (void)t;
+  (void)m;
+  (void)n;
+  (void)myrank;
+  (void)rank_L;
+  (void)rank_R;
+  (void)__parsec_tp; (void)locals;
+  return ((t) > (0) && (n) > (0));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_stencil_1D_task_for_AL_dep1_atline_83_iftrue = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_stencil_1D_task_for_AL_dep1_atline_83_iftrue_fct }
+                   }
+};
+static const parsec_dep_t flow_of_stencil_1D_task_for_AL_dep1_atline_83_iftrue = {
+  .cond = &expr_of_cond_for_flow_of_stencil_1D_task_for_AL_dep1_atline_83_iftrue,  /* ((t) > (0) && (n) > (0)) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 0, /* stencil_1D_task */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_stencil_1D_task_for_A,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_stencil_1D_task_for_AL,
+};
+static inline int expr_of_cond_for_flow_of_stencil_1D_task_for_AL_dep1_atline_83_iffalse_fct(const __parsec_stencil_1D_internal_taskpool_t *__parsec_tp, const __parsec_stencil_1D_task_parsec_assignment_t *locals)
+{
+  const int t = locals->t.value; (void)t;
+  const int m = locals->m.value; (void)m;
+  const int n = locals->n.value; (void)n;
+  const int myrank = locals->myrank.value; (void)myrank;
+  const int rank_L = locals->rank_L.value; (void)rank_L;
+  const int rank_R = locals->rank_R.value; (void)rank_R;
+
+  (void)t;
+  (void)m;
+  (void)n;
+  (void)myrank;
+  (void)rank_L;
+  (void)rank_R;
+  (void)__parsec_tp; (void)locals;
+  return !(((t) > (0) && (n) > (0)));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_stencil_1D_task_for_AL_dep1_atline_83_iffalse = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_stencil_1D_task_for_AL_dep1_atline_83_iffalse_fct }
+                   }
+};
+static const parsec_dep_t flow_of_stencil_1D_task_for_AL_dep1_atline_83_iffalse = {
+  .cond = &expr_of_cond_for_flow_of_stencil_1D_task_for_AL_dep1_atline_83_iffalse,  /* !((t) > (0) && (n) > (0)) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = PARSEC_LOCAL_DATA_TASK_CLASS_ID, /* stencil_1D___parsec_null_type */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_stencil_1D_task_for_AL,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_stencil_1D_task_for_AL = {
+  .name               = "AL",
+  .sym_type           = PARSEC_SYM_IN,
+  .flow_flags         = PARSEC_FLOW_ACCESS_READ|PARSEC_FLOW_HAS_IN_DEPS,
+  .flow_index         = 1,
+  .flow_datatype_mask = 0x0,
+  .dep_in     = { &flow_of_stencil_1D_task_for_AL_dep1_atline_83_iftrue,
+ &flow_of_stencil_1D_task_for_AL_dep1_atline_83_iffalse },
+  .dep_out    = { NULL }
+};
+
+static inline int expr_of_cond_for_flow_of_stencil_1D_task_for_AR_dep1_atline_85_iftrue_fct(const __parsec_stencil_1D_internal_taskpool_t *__parsec_tp, const __parsec_stencil_1D_task_parsec_assignment_t *locals)
+{
+  const int t = locals->t.value; (void)t;
+  const int m = locals->m.value; (void)m;
+  const int n = locals->n.value; (void)n;
+  const int myrank = locals->myrank.value; (void)myrank;
+  const int rank_L = locals->rank_L.value; (void)rank_L;
+  const int rank_R = locals->rank_R.value; (void)rank_R;
+
+  (void)t;
+  (void)m;
+  (void)n;
+  (void)myrank;
+  (void)rank_L;
+  (void)rank_R;
+  (void)__parsec_tp; (void)locals;
+  return ((t) > (0) && (n) < ((descA->lnt - 1)));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_stencil_1D_task_for_AR_dep1_atline_85_iftrue = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_stencil_1D_task_for_AR_dep1_atline_85_iftrue_fct }
+                   }
+};
+static const parsec_dep_t flow_of_stencil_1D_task_for_AR_dep1_atline_85_iftrue = {
+  .cond = &expr_of_cond_for_flow_of_stencil_1D_task_for_AR_dep1_atline_85_iftrue,  /* ((t) > (0) && (n) < ((descA->lnt - 1))) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 0, /* stencil_1D_task */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_stencil_1D_task_for_A,
+  .dep_index = 1,
+  .dep_datatype_index = 1,
+  .belongs_to = &flow_of_stencil_1D_task_for_AR,
+};
+static inline int expr_of_cond_for_flow_of_stencil_1D_task_for_AR_dep1_atline_85_iffalse_fct(const __parsec_stencil_1D_internal_taskpool_t *__parsec_tp, const __parsec_stencil_1D_task_parsec_assignment_t *locals)
+{
+  const int t = locals->t.value; (void)t;
+  const int m = locals->m.value; (void)m;
+  const int n = locals->n.value; (void)n;
+  const int myrank = locals->myrank.value; (void)myrank;
+  const int rank_L = locals->rank_L.value; (void)rank_L;
+  const int rank_R = locals->rank_R.value; (void)rank_R;
+
+  (void)t;
+  (void)m;
+  (void)n;
+  (void)myrank;
+  (void)rank_L;
+  (void)rank_R;
+  (void)__parsec_tp; (void)locals;
+  return !(((t) > (0) && (n) < ((descA->lnt - 1))));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_stencil_1D_task_for_AR_dep1_atline_85_iffalse = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_stencil_1D_task_for_AR_dep1_atline_85_iffalse_fct }
+                   }
+};
+static const parsec_dep_t flow_of_stencil_1D_task_for_AR_dep1_atline_85_iffalse = {
+  .cond = &expr_of_cond_for_flow_of_stencil_1D_task_for_AR_dep1_atline_85_iffalse,  /* !((t) > (0) && (n) < ((descA->lnt - 1))) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = PARSEC_LOCAL_DATA_TASK_CLASS_ID, /* stencil_1D___parsec_null_type */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .dep_index = 1,
+  .dep_datatype_index = 1,
+  .belongs_to = &flow_of_stencil_1D_task_for_AR,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_stencil_1D_task_for_AR = {
+  .name               = "AR",
+  .sym_type           = PARSEC_SYM_IN,
+  .flow_flags         = PARSEC_FLOW_ACCESS_READ|PARSEC_FLOW_HAS_IN_DEPS,
+  .flow_index         = 2,
+  .flow_datatype_mask = 0x0,
+  .dep_in     = { &flow_of_stencil_1D_task_for_AR_dep1_atline_85_iftrue,
+ &flow_of_stencil_1D_task_for_AR_dep1_atline_85_iffalse },
+  .dep_out    = { NULL }
+};
+
+static inline int expr_of_cond_for_flow_of_stencil_1D_task_for_A0_dep1_atline_87_iftrue_fct(const __parsec_stencil_1D_internal_taskpool_t *__parsec_tp, const __parsec_stencil_1D_task_parsec_assignment_t *locals)
+{
+  const int t = locals->t.value;
+  const int m = locals->m.value; (void)m;
+  const int n = locals->n.value; (void)n;
+  const int myrank = locals->myrank.value; (void)myrank;
+  const int rank_L = locals->rank_L.value; (void)rank_L;
+  const int rank_R = locals->rank_R.value; (void)rank_R;
+
+  (void)t;
+  (void)m;
+  (void)n;
+  (void)myrank;
+  (void)rank_L;
+  (void)rank_R;
+  (void)__parsec_tp; (void)locals;
+  return (t) > (0);
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_stencil_1D_task_for_A0_dep1_atline_87_iftrue = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_stencil_1D_task_for_A0_dep1_atline_87_iftrue_fct }
+                   }
+};
+static const parsec_dep_t flow_of_stencil_1D_task_for_A0_dep1_atline_87_iftrue = {
+  .cond = &expr_of_cond_for_flow_of_stencil_1D_task_for_A0_dep1_atline_87_iftrue,  /* (t) > (0) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 0, /* stencil_1D_task */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_stencil_1D_task_for_A,
+  .dep_index = 2,
+  .dep_datatype_index = 2,
+  .belongs_to = &flow_of_stencil_1D_task_for_A0,
+};
+static inline int expr_of_cond_for_flow_of_stencil_1D_task_for_A0_dep1_atline_87_iffalse_fct(const __parsec_stencil_1D_internal_taskpool_t *__parsec_tp, const __parsec_stencil_1D_task_parsec_assignment_t *locals)
+{
+  const int t = locals->t.value;
+  const int m = locals->m.value; (void)m;
+  const int n = locals->n.value; (void)n;
+  const int myrank = locals->myrank.value; (void)myrank;
+  const int rank_L = locals->rank_L.value; (void)rank_L;
+  const int rank_R = locals->rank_R.value; (void)rank_R;
+
+  (void)t;
+  (void)m;
+  (void)n;
+  (void)myrank;
+  (void)rank_L;
+  (void)rank_R;
+  (void)__parsec_tp; (void)locals;
+  return !((t) > (0));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_stencil_1D_task_for_A0_dep1_atline_87_iffalse = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_stencil_1D_task_for_A0_dep1_atline_87_iffalse_fct }
+                   }
+};
+static const parsec_dep_t flow_of_stencil_1D_task_for_A0_dep1_atline_87_iffalse = {
+  .cond = &expr_of_cond_for_flow_of_stencil_1D_task_for_A0_dep1_atline_87_iffalse,  /* !(t) > (0) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = PARSEC_LOCAL_DATA_TASK_CLASS_ID, /* stencil_1D___parsec_null_type */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .dep_index = 2,
+  .dep_datatype_index = 2,
+  .belongs_to = &flow_of_stencil_1D_task_for_A0,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_stencil_1D_task_for_A0 = {
+  .name               = "A0",
+  .sym_type           = PARSEC_SYM_IN,
+  .flow_flags         = PARSEC_FLOW_ACCESS_READ|PARSEC_FLOW_HAS_IN_DEPS,
+  .flow_index         = 3,
+  .flow_datatype_mask = 0x0,
+  .dep_in     = { &flow_of_stencil_1D_task_for_A0_dep1_atline_87_iftrue,
+ &flow_of_stencil_1D_task_for_A0_dep1_atline_87_iffalse },
+  .dep_out    = { NULL }
+};
+
+static void
+iterate_successors_of_stencil_1D_task(parsec_execution_stream_t *es, const __parsec_stencil_1D_task_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_stencil_1D_internal_taskpool_t *__parsec_tp = (const __parsec_stencil_1D_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_stencil_1D_task_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_stencil_1D_task_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int t = __jdf2c__tmp_locals.t.value; (void)t;
+  const int m = __jdf2c__tmp_locals.m.value; (void)m;
+  const int n = __jdf2c__tmp_locals.n.value; (void)n;
+  const int myrank = __jdf2c__tmp_locals.myrank.value; (void)myrank;
+  const int rank_L = __jdf2c__tmp_locals.rank_L.value; (void)rank_L;
+  const int rank_R = __jdf2c__tmp_locals.rank_R.value; (void)rank_R;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)t;  (void)m;  (void)n;  (void)myrank;  (void)rank_L;  (void)rank_R;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_descA(m, n);
+#endif
+  if( action_mask & 0x7 ) {  /* Flow of data A [0] */
+    data.data   = this_task->data._f_A.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x1 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_stencil_1D_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_stencil_1D_FULL_ADT->arena;
+    data.remote.src_datatype = PARSEC_stencil_1D_FULL_ADT->opaque_dtt;
+    data.remote.dst_datatype = PARSEC_stencil_1D_FULL_ADT->opaque_dtt;
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( (t) < (iter) ) {
+      __parsec_stencil_1D_task_task_t* ncc = (__parsec_stencil_1D_task_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[stencil_1D_task.task_class_id];
+        const int task_t = (t + 1);
+        if( (task_t >= (0)) && (task_t <= (iter)) ) {
+          assert(&nc.locals[0].value == &ncc->locals.t.value);
+          ncc->locals.t.value = task_t;
+          const int task_m = (ncc->locals.t.value % descA->lmt);
+          assert(&nc.locals[1].value == &ncc->locals.m.value);
+          ncc->locals.m.value = task_m;
+          const int task_n = n;
+          if( (task_n >= (0)) && (task_n <= ((descA->lnt - 1))) ) {
+            assert(&nc.locals[2].value == &ncc->locals.n.value);
+            ncc->locals.n.value = task_n;
+            const int task_myrank = descA->super.myrank;
+            assert(&nc.locals[3].value == &ncc->locals.myrank.value);
+            ncc->locals.myrank.value = task_myrank;
+            const int task_rank_L = stencil_1D_task_inline_c_expr4_line_78(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[4].value == &ncc->locals.rank_L.value);
+            ncc->locals.rank_L.value = task_rank_L;
+            const int task_rank_R = stencil_1D_task_inline_c_expr3_line_79(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[5].value == &ncc->locals.rank_R.value);
+            ncc->locals.rank_R.value = task_rank_R;
+#if defined(DISTRIBUTED)
+            rank_dst = rank_of_descA(ncc->locals.m.value, ncc->locals.n.value);
+            if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+              vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, ncc->locals.m.value, ncc->locals.n.value);
+            nc.priority = __parsec_tp->super.super.priority;
+            successor_repo = task_repo;
+            successor_repo_key = __jdf2c_make_key_task((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+          RELEASE_DEP_OUTPUT(es, "A", this_task, "A0", &nc, rank_src, rank_dst, &data);
+          if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_stencil_1D_task_for_A_dep2_atline_90, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+            }
+          }
+    }
+  }
+  if( action_mask & 0x2 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_stencil_1D_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_stencil_1D_LR_ADT->arena;
+    data.remote.src_datatype = PARSEC_stencil_1D_LR_ADT->opaque_dtt;
+    data.remote.dst_datatype = PARSEC_stencil_1D_LR_ADT->opaque_dtt;
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = stencil_1D_task_inline_c_expr2_line_91(__parsec_tp, &__jdf2c__tmp_locals);
+    data.remote.dst_displ    = stencil_1D_task_inline_c_expr2_line_91(__parsec_tp, &__jdf2c__tmp_locals);
+  }
+        if( ((t) < (iter) && (n) > (0)) ) {
+      __parsec_stencil_1D_task_task_t* ncc = (__parsec_stencil_1D_task_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[stencil_1D_task.task_class_id];
+        const int task_t = (t + 1);
+        if( (task_t >= (0)) && (task_t <= (iter)) ) {
+          assert(&nc.locals[0].value == &ncc->locals.t.value);
+          ncc->locals.t.value = task_t;
+          const int task_m = (ncc->locals.t.value % descA->lmt);
+          assert(&nc.locals[1].value == &ncc->locals.m.value);
+          ncc->locals.m.value = task_m;
+          const int task_n = (n - 1);
+          if( (task_n >= (0)) && (task_n <= ((descA->lnt - 1))) ) {
+            assert(&nc.locals[2].value == &ncc->locals.n.value);
+            ncc->locals.n.value = task_n;
+            const int task_myrank = descA->super.myrank;
+            assert(&nc.locals[3].value == &ncc->locals.myrank.value);
+            ncc->locals.myrank.value = task_myrank;
+            const int task_rank_L = stencil_1D_task_inline_c_expr4_line_78(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[4].value == &ncc->locals.rank_L.value);
+            ncc->locals.rank_L.value = task_rank_L;
+            const int task_rank_R = stencil_1D_task_inline_c_expr3_line_79(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[5].value == &ncc->locals.rank_R.value);
+            ncc->locals.rank_R.value = task_rank_R;
+#if defined(DISTRIBUTED)
+            rank_dst = rank_of_descA(ncc->locals.m.value, ncc->locals.n.value);
+            if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+              vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, ncc->locals.m.value, ncc->locals.n.value);
+            nc.priority = __parsec_tp->super.super.priority;
+            successor_repo = task_repo;
+            successor_repo_key = __jdf2c_make_key_task((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+          RELEASE_DEP_OUTPUT(es, "A", this_task, "AR", &nc, rank_src, rank_dst, &data);
+          if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_stencil_1D_task_for_A_dep3_atline_91, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+            }
+          }
+    }
+  }
+  if( action_mask & 0x4 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_stencil_1D_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_stencil_1D_LR_ADT->arena;
+    data.remote.src_datatype = PARSEC_stencil_1D_LR_ADT->opaque_dtt;
+    data.remote.dst_datatype = PARSEC_stencil_1D_LR_ADT->opaque_dtt;
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = stencil_1D_task_inline_c_expr1_line_92(__parsec_tp, &__jdf2c__tmp_locals);
+    data.remote.dst_displ    = stencil_1D_task_inline_c_expr1_line_92(__parsec_tp, &__jdf2c__tmp_locals);
+  }
+        if( ((t) < (iter) && (n) < ((descA->lnt - 1))) ) {
+      __parsec_stencil_1D_task_task_t* ncc = (__parsec_stencil_1D_task_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[stencil_1D_task.task_class_id];
+        const int task_t = (t + 1);
+        if( (task_t >= (0)) && (task_t <= (iter)) ) {
+          assert(&nc.locals[0].value == &ncc->locals.t.value);
+          ncc->locals.t.value = task_t;
+          const int task_m = (ncc->locals.t.value % descA->lmt);
+          assert(&nc.locals[1].value == &ncc->locals.m.value);
+          ncc->locals.m.value = task_m;
+          const int task_n = (n + 1);
+          if( (task_n >= (0)) && (task_n <= ((descA->lnt - 1))) ) {
+            assert(&nc.locals[2].value == &ncc->locals.n.value);
+            ncc->locals.n.value = task_n;
+            const int task_myrank = descA->super.myrank;
+            assert(&nc.locals[3].value == &ncc->locals.myrank.value);
+            ncc->locals.myrank.value = task_myrank;
+            const int task_rank_L = stencil_1D_task_inline_c_expr4_line_78(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[4].value == &ncc->locals.rank_L.value);
+            ncc->locals.rank_L.value = task_rank_L;
+            const int task_rank_R = stencil_1D_task_inline_c_expr3_line_79(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[5].value == &ncc->locals.rank_R.value);
+            ncc->locals.rank_R.value = task_rank_R;
+#if defined(DISTRIBUTED)
+            rank_dst = rank_of_descA(ncc->locals.m.value, ncc->locals.n.value);
+            if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+              vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, ncc->locals.m.value, ncc->locals.n.value);
+            nc.priority = __parsec_tp->super.super.priority;
+            successor_repo = task_repo;
+            successor_repo_key = __jdf2c_make_key_task((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+          RELEASE_DEP_OUTPUT(es, "A", this_task, "AL", &nc, rank_src, rank_dst, &data);
+          if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_stencil_1D_task_for_A_dep4_atline_92, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+            }
+          }
+    }
+  }
+  }
+  /* Flow of data AL has only IN dependencies */
+  /* Flow of data AR has only IN dependencies */
+  /* Flow of data A0 has only IN dependencies */
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static void
+iterate_predecessors_of_stencil_1D_task(parsec_execution_stream_t *es, const __parsec_stencil_1D_task_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_stencil_1D_internal_taskpool_t *__parsec_tp = (const __parsec_stencil_1D_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_stencil_1D_task_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_stencil_1D_task_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int t = __jdf2c__tmp_locals.t.value; (void)t;
+  const int m = __jdf2c__tmp_locals.m.value; (void)m;
+  const int n = __jdf2c__tmp_locals.n.value; (void)n;
+  const int myrank = __jdf2c__tmp_locals.myrank.value; (void)myrank;
+  const int rank_L = __jdf2c__tmp_locals.rank_L.value; (void)rank_L;
+  const int rank_R = __jdf2c__tmp_locals.rank_R.value; (void)rank_R;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)t;  (void)m;  (void)n;  (void)myrank;  (void)rank_L;  (void)rank_R;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_descA(m, n);
+#endif
+  /* Flow of data A has only OUTPUT dependencies to Memory */
+  if( action_mask & 0x1 ) {  /* Flow of data AL [1] */
+    data.data   = this_task->data._f_AL.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x1 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_stencil_1D_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_stencil_1D_LR_ADT->arena;
+    data.remote.src_datatype = PARSEC_stencil_1D_LR_ADT->opaque_dtt;
+    data.remote.dst_datatype = PARSEC_stencil_1D_LR_ADT->opaque_dtt;
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( ((t) > (0) && (n) > (0)) ) {
+      __parsec_stencil_1D_task_task_t* ncc = (__parsec_stencil_1D_task_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[stencil_1D_task.task_class_id];
+        const int task_t = (t - 1);
+        if( (task_t >= (0)) && (task_t <= (iter)) ) {
+          assert(&nc.locals[0].value == &ncc->locals.t.value);
+          ncc->locals.t.value = task_t;
+          const int task_m = (ncc->locals.t.value % descA->lmt);
+          assert(&nc.locals[1].value == &ncc->locals.m.value);
+          ncc->locals.m.value = task_m;
+          const int task_n = (n - 1);
+          if( (task_n >= (0)) && (task_n <= ((descA->lnt - 1))) ) {
+            assert(&nc.locals[2].value == &ncc->locals.n.value);
+            ncc->locals.n.value = task_n;
+            const int task_myrank = descA->super.myrank;
+            assert(&nc.locals[3].value == &ncc->locals.myrank.value);
+            ncc->locals.myrank.value = task_myrank;
+            const int task_rank_L = stencil_1D_task_inline_c_expr4_line_78(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[4].value == &ncc->locals.rank_L.value);
+            ncc->locals.rank_L.value = task_rank_L;
+            const int task_rank_R = stencil_1D_task_inline_c_expr3_line_79(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[5].value == &ncc->locals.rank_R.value);
+            ncc->locals.rank_R.value = task_rank_R;
+#if defined(DISTRIBUTED)
+            rank_dst = rank_of_descA(ncc->locals.m.value, ncc->locals.n.value);
+            if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+              vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, ncc->locals.m.value, ncc->locals.n.value);
+            nc.priority = __parsec_tp->super.super.priority;
+            successor_repo = task_repo;
+            successor_repo_key = __jdf2c_make_key_task((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+          RELEASE_DEP_OUTPUT(es, "AL", this_task, "A", &nc, rank_src, rank_dst, &data);
+          if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_stencil_1D_task_for_AL_dep1_atline_83_iftrue, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+            }
+          }
+    }
+  }
+  }
+  if( action_mask & 0x2 ) {  /* Flow of data AR [2] */
+    data.data   = this_task->data._f_AR.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x2 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_stencil_1D_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_stencil_1D_LR_ADT->arena;
+    data.remote.src_datatype = PARSEC_stencil_1D_LR_ADT->opaque_dtt;
+    data.remote.dst_datatype = PARSEC_stencil_1D_LR_ADT->opaque_dtt;
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( ((t) > (0) && (n) < ((descA->lnt - 1))) ) {
+      __parsec_stencil_1D_task_task_t* ncc = (__parsec_stencil_1D_task_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[stencil_1D_task.task_class_id];
+        const int task_t = (t - 1);
+        if( (task_t >= (0)) && (task_t <= (iter)) ) {
+          assert(&nc.locals[0].value == &ncc->locals.t.value);
+          ncc->locals.t.value = task_t;
+          const int task_m = (ncc->locals.t.value % descA->lmt);
+          assert(&nc.locals[1].value == &ncc->locals.m.value);
+          ncc->locals.m.value = task_m;
+          const int task_n = (n + 1);
+          if( (task_n >= (0)) && (task_n <= ((descA->lnt - 1))) ) {
+            assert(&nc.locals[2].value == &ncc->locals.n.value);
+            ncc->locals.n.value = task_n;
+            const int task_myrank = descA->super.myrank;
+            assert(&nc.locals[3].value == &ncc->locals.myrank.value);
+            ncc->locals.myrank.value = task_myrank;
+            const int task_rank_L = stencil_1D_task_inline_c_expr4_line_78(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[4].value == &ncc->locals.rank_L.value);
+            ncc->locals.rank_L.value = task_rank_L;
+            const int task_rank_R = stencil_1D_task_inline_c_expr3_line_79(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[5].value == &ncc->locals.rank_R.value);
+            ncc->locals.rank_R.value = task_rank_R;
+#if defined(DISTRIBUTED)
+            rank_dst = rank_of_descA(ncc->locals.m.value, ncc->locals.n.value);
+            if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+              vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, ncc->locals.m.value, ncc->locals.n.value);
+            nc.priority = __parsec_tp->super.super.priority;
+            successor_repo = task_repo;
+            successor_repo_key = __jdf2c_make_key_task((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+          RELEASE_DEP_OUTPUT(es, "AR", this_task, "A", &nc, rank_src, rank_dst, &data);
+          if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_stencil_1D_task_for_AR_dep1_atline_85_iftrue, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+            }
+          }
+    }
+  }
+  }
+  if( action_mask & 0x4 ) {  /* Flow of data A0 [3] */
+    data.data   = this_task->data._f_A0.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x4 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_stencil_1D_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_stencil_1D_FULL_ADT->arena;
+    data.remote.src_datatype = PARSEC_stencil_1D_FULL_ADT->opaque_dtt;
+    data.remote.dst_datatype = PARSEC_stencil_1D_FULL_ADT->opaque_dtt;
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( (t) > (0) ) {
+      __parsec_stencil_1D_task_task_t* ncc = (__parsec_stencil_1D_task_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[stencil_1D_task.task_class_id];
+        const int task_t = (t - 1);
+        if( (task_t >= (0)) && (task_t <= (iter)) ) {
+          assert(&nc.locals[0].value == &ncc->locals.t.value);
+          ncc->locals.t.value = task_t;
+          const int task_m = (ncc->locals.t.value % descA->lmt);
+          assert(&nc.locals[1].value == &ncc->locals.m.value);
+          ncc->locals.m.value = task_m;
+          const int task_n = n;
+          if( (task_n >= (0)) && (task_n <= ((descA->lnt - 1))) ) {
+            assert(&nc.locals[2].value == &ncc->locals.n.value);
+            ncc->locals.n.value = task_n;
+            const int task_myrank = descA->super.myrank;
+            assert(&nc.locals[3].value == &ncc->locals.myrank.value);
+            ncc->locals.myrank.value = task_myrank;
+            const int task_rank_L = stencil_1D_task_inline_c_expr4_line_78(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[4].value == &ncc->locals.rank_L.value);
+            ncc->locals.rank_L.value = task_rank_L;
+            const int task_rank_R = stencil_1D_task_inline_c_expr3_line_79(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[5].value == &ncc->locals.rank_R.value);
+            ncc->locals.rank_R.value = task_rank_R;
+#if defined(DISTRIBUTED)
+            rank_dst = rank_of_descA(ncc->locals.m.value, ncc->locals.n.value);
+            if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+              vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, ncc->locals.m.value, ncc->locals.n.value);
+            nc.priority = __parsec_tp->super.super.priority;
+            successor_repo = task_repo;
+            successor_repo_key = __jdf2c_make_key_task((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+          RELEASE_DEP_OUTPUT(es, "A0", this_task, "A", &nc, rank_src, rank_dst, &data);
+          if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_stencil_1D_task_for_A0_dep1_atline_87_iftrue, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+            }
+          }
+    }
+  }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static int release_deps_of_stencil_1D_task(parsec_execution_stream_t *es, __parsec_stencil_1D_task_task_t *this_task, uint32_t action_mask, parsec_remote_deps_t *deps)
+{
+  PARSEC_PINS(es, RELEASE_DEPS_BEGIN, (parsec_task_t *)this_task);  const __parsec_stencil_1D_internal_taskpool_t *__parsec_tp = (const __parsec_stencil_1D_internal_taskpool_t *)this_task->taskpool;
+  parsec_release_dep_fct_arg_t arg;
+  int __vp_id;
+  int consume_local_repo = 0;
+  arg.action_mask = action_mask;
+  arg.output_entry = NULL;
+  arg.output_repo = NULL;
+#if defined(DISTRIBUTED)
+  arg.remote_deps = deps;
+#endif  /* defined(DISTRIBUTED) */
+  assert(NULL != es);
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS )    arg.ready_lists = alloca(sizeof(parsec_task_t *) * es->virtual_process->parsec_context->nb_vp);
+  else
+    arg.ready_lists = NULL;
+  for( __vp_id = 0; __vp_id < es->virtual_process->parsec_context->nb_vp; arg.ready_lists[__vp_id++] = NULL );
+  (void)__parsec_tp; (void)deps;
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_A.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_A.source_repo, this_task->data._f_A.source_repo_entry->ht_item.key );
+    }
+    if( NULL != this_task->data._f_AL.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_AL.source_repo, this_task->data._f_AL.source_repo_entry->ht_item.key );
+    }
+    if( NULL != this_task->data._f_AR.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_AR.source_repo, this_task->data._f_AR.source_repo_entry->ht_item.key );
+    }
+    if( NULL != this_task->data._f_A0.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_A0.source_repo, this_task->data._f_A0.source_repo_entry->ht_item.key );
+    }
+  }
+  consume_local_repo = (this_task->repo_entry != NULL);
+  arg.output_repo = task_repo;
+  arg.output_entry = this_task->repo_entry;
+  arg.output_usage = 0;
+  if( action_mask & (PARSEC_ACTION_RELEASE_LOCAL_DEPS | PARSEC_ACTION_GET_REPO_ENTRY) ) {
+    arg.output_entry = data_repo_lookup_entry_and_create( es, arg.output_repo, __jdf2c_make_key_task((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    arg.output_entry->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(arg.output_entry->sim_exec_date == 0);
+    arg.output_entry->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  if(action_mask & ( PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE ) ){
+    /* Generate the reshape promise for the outputs that need it */
+    iterate_successors_of_stencil_1D_task(es, this_task, action_mask, parsec_set_up_reshape_promise, &arg);
+   }
+  iterate_successors_of_stencil_1D_task(es, this_task, action_mask, parsec_release_dep_fct, &arg);
+
+#if defined(DISTRIBUTED)
+  if( (action_mask & PARSEC_ACTION_SEND_REMOTE_DEPS) && (NULL != arg.remote_deps)) {
+    parsec_remote_dep_activate(es, (parsec_task_t *)this_task, arg.remote_deps, arg.remote_deps->outgoing_mask);
+  }
+#endif
+
+  if(action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS) {
+    data_repo_entry_addto_usage_limit(task_repo, arg.output_entry->ht_item.key, arg.output_usage);
+    __parsec_schedule_vp(es, arg.ready_lists, 0);
+  }
+      if (consume_local_repo) {
+         data_repo_entry_used_once( task_repo, this_task->repo_entry->ht_item.key );
+      }
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_A.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_A.data_in);
+    }
+    if( NULL != this_task->data._f_AL.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_AL.data_in);
+    }
+    if( NULL != this_task->data._f_AR.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_AR.data_in);
+    }
+    if( NULL != this_task->data._f_A0.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_A0.data_in);
+    }
+  }
+  PARSEC_PINS(es, RELEASE_DEPS_END, (parsec_task_t *)this_task);  return 0;
+}
+
+static int data_lookup_of_stencil_1D_task(parsec_execution_stream_t *es, __parsec_stencil_1D_task_task_t *this_task)
+{
+  const __parsec_stencil_1D_internal_taskpool_t *__parsec_tp = (__parsec_stencil_1D_internal_taskpool_t *)this_task->taskpool;
+  parsec_assignment_t generic_locals[MAX_PARAM_COUNT];  /* generic task locals */
+  int target_device = 0; (void)target_device;
+  (void)__parsec_tp; (void)generic_locals; (void)es;
+  parsec_data_copy_t *chunk = NULL;
+  data_repo_t        *reshape_repo  = NULL, *consumed_repo  = NULL;
+  data_repo_entry_t  *reshape_entry = NULL, *consumed_entry = NULL;
+  parsec_key_t        reshape_entry_key = 0, consumed_entry_key = 0;
+  uint8_t             consumed_flow_index;
+  parsec_dep_data_description_t data;
+  int ret;
+  (void)reshape_repo; (void)reshape_entry; (void)reshape_entry_key;
+  (void)consumed_repo; (void)consumed_entry; (void)consumed_entry_key;
+  (void)consumed_flow_index;
+  (void)chunk; (void)data; (void)ret;
+  const int t = this_task->locals.t.value; (void)t;
+  const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+  const int myrank = this_task->locals.myrank.value; (void)myrank;
+  const int rank_L = this_task->locals.rank_L.value; (void)rank_L;
+  const int rank_R = this_task->locals.rank_R.value; (void)rank_R;
+  if( NULL == this_task->repo_entry ){
+    this_task->repo_entry = data_repo_lookup_entry_and_create(es, task_repo,                                       __jdf2c_make_key_task((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    data_repo_entry_addto_usage_limit(task_repo, this_task->repo_entry->ht_item.key, 1);    this_task->repo_entry ->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(this_task->repo_entry ->sim_exec_date == 0);
+    this_task->repo_entry ->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  /* The reshape repo is the current task repo. */  reshape_repo = task_repo;
+  reshape_entry_key = __jdf2c_make_key_task((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals) ;
+  reshape_entry = this_task->repo_entry;
+  /* Lookup the input data, and store them in the context if any */
+
+if(! this_task->data._f_A.fulfill ){ /* Flow A */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_A.data_out = NULL;  /* By default, if nothing matches */
+  /* Flow A [0] dependency [3] from memory descA */
+  if( NULL == (chunk = this_task->data._f_A.data_in) ) {
+  /* No data set up by predecessor on this task input flow */
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+  parsec_prof_grapher_data_input(data_of_descA(m, n), (parsec_task_t*)this_task, &flow_of_stencil_1D_task_for_A, 1);
+#endif
+    chunk = parsec_data_get_copy(data_of_descA(m, n), target_device);
+    data.data = chunk;
+    data.data_future  = NULL;
+        data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.data_future   = NULL;
+    if( (ret = parsec_get_copy_reshape_from_desc(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    this_task->data._f_A.data_out = chunk;
+    PARSEC_OBJ_RETAIN(chunk);
+  } 
+    this_task->data._f_A.data_in     = chunk;
+    this_task->data._f_A.source_repo       = consumed_repo;
+    this_task->data._f_A.source_repo_entry = consumed_entry;
+    if( this_task->data._f_A.source_repo_entry == this_task->repo_entry ){
+      /* in case we have consume from this task repo entry for the flow,
+       * it is cleaned up, avoiding having old stuff during release_deps_of
+       */
+      this_task->repo_entry->data[0] = NULL;
+    }
+    this_task->data._f_A.fulfill = 1;
+}
+
+
+if(! this_task->data._f_AL.fulfill ){ /* Flow AL */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_AL.data_out = NULL;  /* input only */
+    if( ((t) > (0) && (n) > (0)) ) {
+    /* Flow AL [1] dependency [0] from predecessor task */
+    if( NULL == (chunk = this_task->data._f_AL.data_in) ) {
+    /* No data set up by predecessor on this task input flow */
+__parsec_stencil_1D_task_parsec_assignment_t *target_locals = (__parsec_stencil_1D_task_parsec_assignment_t*)&generic_locals;
+      const int taskt = target_locals->t.value = (t - 1); (void)taskt;
+      const int taskm = target_locals->m.value = (taskt % descA->lmt); (void)taskm;
+      const int taskn = target_locals->n.value = (n - 1); (void)taskn;
+      const int taskmyrank = target_locals->myrank.value = descA->super.myrank; (void)taskmyrank;
+      const int taskrank_L = target_locals->rank_L.value = stencil_1D_task_inline_c_expr4_line_78(__parsec_tp, target_locals); (void)taskrank_L;
+      const int taskrank_R = target_locals->rank_R.value = stencil_1D_task_inline_c_expr3_line_79(__parsec_tp, target_locals); (void)taskrank_R;
+      if( (reshape_entry != NULL) && (reshape_entry->data[1] != NULL) ){
+          /* Reshape promise set up on this task repo by predecessor */
+          consumed_repo = reshape_repo;
+          consumed_entry = reshape_entry;
+          consumed_entry_key = reshape_entry_key;
+          consumed_flow_index = 1;
+      }else{
+          /* Consume from predecessor's repo */
+          consumed_repo = task_repo;
+          consumed_entry_key = __jdf2c_make_key_task((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)target_locals) ;
+          consumed_entry = data_repo_lookup_entry( consumed_repo, consumed_entry_key );
+          consumed_flow_index = 0;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 1, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      ACQUIRE_FLOW(this_task, "AL", &stencil_1D_task, "A", target_locals, chunk);
+      this_task->data._f_AL.data_out = chunk;
+    } 
+    else {
+      /* Data set up by predecessor on this task input flow */
+      consumed_repo = this_task->data._f_AL.source_repo;
+      consumed_entry = this_task->data._f_AL.source_repo_entry;
+      consumed_entry_key = this_task->data._f_AL.source_repo_entry->ht_item.key;
+      if( (reshape_entry != NULL) && (reshape_entry->data[1] != NULL) ){
+          /* Reshape promise set up on input by predecessor is on this task repo */
+          consumed_flow_index = 1;
+          assert( (this_task->data._f_AL.source_repo == reshape_repo)
+               && (this_task->data._f_AL.source_repo_entry == reshape_entry));
+      }else{
+          /* Reshape promise set up on input by predecessor is the predecesssor task repo */
+          consumed_flow_index = 0;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 1, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      this_task->data._f_AL.data_out = parsec_data_get_copy(chunk->original, target_device);
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+      parsec_prof_grapher_data_input(chunk->original, (parsec_task_t*)this_task, &flow_of_stencil_1D_task_for_AL, 0);
+#endif
+    }
+    } else {
+    /* Flow AL [1] dependency [0] from memory NEW or NULL data */
+    if( NULL == (chunk = this_task->data._f_AL.data_in) ) {
+    /* No data set up by predecessor on this task input flow */
+    } 
+    }
+    this_task->data._f_AL.data_in     = chunk;
+    this_task->data._f_AL.source_repo       = consumed_repo;
+    this_task->data._f_AL.source_repo_entry = consumed_entry;
+    if( this_task->data._f_AL.source_repo_entry == this_task->repo_entry ){
+      /* in case we have consume from this task repo entry for the flow,
+       * it is cleaned up, avoiding having old stuff during release_deps_of
+       */
+      this_task->repo_entry->data[1] = NULL;
+    }
+    this_task->data._f_AL.fulfill = 1;
+}
+
+
+if(! this_task->data._f_AR.fulfill ){ /* Flow AR */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_AR.data_out = NULL;  /* input only */
+    if( ((t) > (0) && (n) < ((descA->lnt - 1))) ) {
+    /* Flow AR [2] dependency [1] from predecessor task */
+    if( NULL == (chunk = this_task->data._f_AR.data_in) ) {
+    /* No data set up by predecessor on this task input flow */
+__parsec_stencil_1D_task_parsec_assignment_t *target_locals = (__parsec_stencil_1D_task_parsec_assignment_t*)&generic_locals;
+      const int taskt = target_locals->t.value = (t - 1); (void)taskt;
+      const int taskm = target_locals->m.value = (taskt % descA->lmt); (void)taskm;
+      const int taskn = target_locals->n.value = (n + 1); (void)taskn;
+      const int taskmyrank = target_locals->myrank.value = descA->super.myrank; (void)taskmyrank;
+      const int taskrank_L = target_locals->rank_L.value = stencil_1D_task_inline_c_expr4_line_78(__parsec_tp, target_locals); (void)taskrank_L;
+      const int taskrank_R = target_locals->rank_R.value = stencil_1D_task_inline_c_expr3_line_79(__parsec_tp, target_locals); (void)taskrank_R;
+      if( (reshape_entry != NULL) && (reshape_entry->data[2] != NULL) ){
+          /* Reshape promise set up on this task repo by predecessor */
+          consumed_repo = reshape_repo;
+          consumed_entry = reshape_entry;
+          consumed_entry_key = reshape_entry_key;
+          consumed_flow_index = 2;
+      }else{
+          /* Consume from predecessor's repo */
+          consumed_repo = task_repo;
+          consumed_entry_key = __jdf2c_make_key_task((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)target_locals) ;
+          consumed_entry = data_repo_lookup_entry( consumed_repo, consumed_entry_key );
+          consumed_flow_index = 0;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 2, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      ACQUIRE_FLOW(this_task, "AR", &stencil_1D_task, "A", target_locals, chunk);
+      this_task->data._f_AR.data_out = chunk;
+    } 
+    else {
+      /* Data set up by predecessor on this task input flow */
+      consumed_repo = this_task->data._f_AR.source_repo;
+      consumed_entry = this_task->data._f_AR.source_repo_entry;
+      consumed_entry_key = this_task->data._f_AR.source_repo_entry->ht_item.key;
+      if( (reshape_entry != NULL) && (reshape_entry->data[2] != NULL) ){
+          /* Reshape promise set up on input by predecessor is on this task repo */
+          consumed_flow_index = 2;
+          assert( (this_task->data._f_AR.source_repo == reshape_repo)
+               && (this_task->data._f_AR.source_repo_entry == reshape_entry));
+      }else{
+          /* Reshape promise set up on input by predecessor is the predecesssor task repo */
+          consumed_flow_index = 0;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 2, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      this_task->data._f_AR.data_out = parsec_data_get_copy(chunk->original, target_device);
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+      parsec_prof_grapher_data_input(chunk->original, (parsec_task_t*)this_task, &flow_of_stencil_1D_task_for_AR, 0);
+#endif
+    }
+    } else {
+    /* Flow AR [2] dependency [1] from memory NEW or NULL data */
+    if( NULL == (chunk = this_task->data._f_AR.data_in) ) {
+    /* No data set up by predecessor on this task input flow */
+    } 
+    }
+    this_task->data._f_AR.data_in     = chunk;
+    this_task->data._f_AR.source_repo       = consumed_repo;
+    this_task->data._f_AR.source_repo_entry = consumed_entry;
+    if( this_task->data._f_AR.source_repo_entry == this_task->repo_entry ){
+      /* in case we have consume from this task repo entry for the flow,
+       * it is cleaned up, avoiding having old stuff during release_deps_of
+       */
+      this_task->repo_entry->data[2] = NULL;
+    }
+    this_task->data._f_AR.fulfill = 1;
+}
+
+
+if(! this_task->data._f_A0.fulfill ){ /* Flow A0 */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_A0.data_out = NULL;  /* input only */
+    if( (t) > (0) ) {
+    /* Flow A0 [3] dependency [2] from predecessor task */
+    if( NULL == (chunk = this_task->data._f_A0.data_in) ) {
+    /* No data set up by predecessor on this task input flow */
+__parsec_stencil_1D_task_parsec_assignment_t *target_locals = (__parsec_stencil_1D_task_parsec_assignment_t*)&generic_locals;
+      const int taskt = target_locals->t.value = (t - 1); (void)taskt;
+      const int taskm = target_locals->m.value = (taskt % descA->lmt); (void)taskm;
+      const int taskn = target_locals->n.value = n; (void)taskn;
+      const int taskmyrank = target_locals->myrank.value = descA->super.myrank; (void)taskmyrank;
+      const int taskrank_L = target_locals->rank_L.value = stencil_1D_task_inline_c_expr4_line_78(__parsec_tp, target_locals); (void)taskrank_L;
+      const int taskrank_R = target_locals->rank_R.value = stencil_1D_task_inline_c_expr3_line_79(__parsec_tp, target_locals); (void)taskrank_R;
+      if( (reshape_entry != NULL) && (reshape_entry->data[3] != NULL) ){
+          /* Reshape promise set up on this task repo by predecessor */
+          consumed_repo = reshape_repo;
+          consumed_entry = reshape_entry;
+          consumed_entry_key = reshape_entry_key;
+          consumed_flow_index = 3;
+      }else{
+          /* Consume from predecessor's repo */
+          consumed_repo = task_repo;
+          consumed_entry_key = __jdf2c_make_key_task((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)target_locals) ;
+          consumed_entry = data_repo_lookup_entry( consumed_repo, consumed_entry_key );
+          consumed_flow_index = 0;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 3, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      ACQUIRE_FLOW(this_task, "A0", &stencil_1D_task, "A", target_locals, chunk);
+      this_task->data._f_A0.data_out = chunk;
+    } 
+    else {
+      /* Data set up by predecessor on this task input flow */
+      consumed_repo = this_task->data._f_A0.source_repo;
+      consumed_entry = this_task->data._f_A0.source_repo_entry;
+      consumed_entry_key = this_task->data._f_A0.source_repo_entry->ht_item.key;
+      if( (reshape_entry != NULL) && (reshape_entry->data[3] != NULL) ){
+          /* Reshape promise set up on input by predecessor is on this task repo */
+          consumed_flow_index = 3;
+          assert( (this_task->data._f_A0.source_repo == reshape_repo)
+               && (this_task->data._f_A0.source_repo_entry == reshape_entry));
+      }else{
+          /* Reshape promise set up on input by predecessor is the predecesssor task repo */
+          consumed_flow_index = 0;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 3, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      this_task->data._f_A0.data_out = parsec_data_get_copy(chunk->original, target_device);
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+      parsec_prof_grapher_data_input(chunk->original, (parsec_task_t*)this_task, &flow_of_stencil_1D_task_for_A0, 0);
+#endif
+    }
+    } else {
+    /* Flow A0 [3] dependency [2] from memory NEW or NULL data */
+    if( NULL == (chunk = this_task->data._f_A0.data_in) ) {
+    /* No data set up by predecessor on this task input flow */
+    } 
+    }
+    this_task->data._f_A0.data_in     = chunk;
+    this_task->data._f_A0.source_repo       = consumed_repo;
+    this_task->data._f_A0.source_repo_entry = consumed_entry;
+    if( this_task->data._f_A0.source_repo_entry == this_task->repo_entry ){
+      /* in case we have consume from this task repo entry for the flow,
+       * it is cleaned up, avoiding having old stuff during release_deps_of
+       */
+      this_task->repo_entry->data[3] = NULL;
+    }
+    this_task->data._f_A0.fulfill = 1;
+}
+
+  /** Generate profiling information */
+#if defined(PARSEC_PROF_TRACE)
+  this_task->prof_info.desc = (parsec_data_collection_t*)__parsec_tp->super._g_descA;
+  this_task->prof_info.priority = this_task->priority;
+  this_task->prof_info.data_id   = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->data_key((parsec_data_collection_t*)__parsec_tp->super._g_descA, m, n);
+  this_task->prof_info.task_class_id = this_task->task_class->task_class_id;
+  this_task->prof_info.task_return_code = -1;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int datatype_lookup_of_stencil_1D_task(parsec_execution_stream_t *es, const parsec_task_t *this_generic_task, const parsec_task_t *parent_task,
+              uint32_t* flow_mask, parsec_dep_data_description_t* data)
+{
+  const __parsec_stencil_1D_task_task_t *this_task = (__parsec_stencil_1D_task_task_t*)this_generic_task;
+  const __parsec_stencil_1D_internal_taskpool_t *__parsec_tp = (__parsec_stencil_1D_internal_taskpool_t *)this_task->taskpool;
+  (void)__parsec_tp; (void)es; (void)this_task; (void)data; (void)parent_task;
+  const int t = this_task->locals.t.value; (void)t;
+  const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+  const int myrank = this_task->locals.myrank.value; (void)myrank;
+  const int rank_L = this_task->locals.rank_L.value; (void)rank_L;
+  const int rank_R = this_task->locals.rank_R.value; (void)rank_R;
+  data->local.arena = data->remote.arena = NULL;
+  data->local.src_datatype  = data->local.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->local.src_count     = data->local.dst_count = 0;
+  data->local.src_displ     = data->local.dst_displ = 0;
+  data->data_future  = NULL;
+  if( (*flow_mask) & 0x80000000U ) { /* these are the input dependencies remote datatypes  */
+if( (*flow_mask) & 0x1U ) {  /* Flow A */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_stencil_1D_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_stencil_1D_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_stencil_1D_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+if( (*flow_mask) & 0x2U ) {  /* Flow AL */
+    if( ((*flow_mask) & 0x2U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_stencil_1D_LR_ADT->arena ;
+    data->remote.src_datatype = PARSEC_stencil_1D_LR_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_stencil_1D_LR_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x2U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x2U) */
+if( (*flow_mask) & 0x4U ) {  /* Flow AR */
+    if( ((*flow_mask) & 0x4U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_stencil_1D_LR_ADT->arena ;
+    data->remote.src_datatype = PARSEC_stencil_1D_LR_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_stencil_1D_LR_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x4U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x4U) */
+if( (*flow_mask) & 0x8U ) {  /* Flow A0 */
+    if( ((*flow_mask) & 0x8U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_stencil_1D_FULL_ADT->arena ;
+    data->remote.src_datatype = PARSEC_stencil_1D_FULL_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_stencil_1D_FULL_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x8U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x8U) */
+    goto no_mask_match;
+  }
+
+  /* these are the output dependencies remote datatypes */
+if( (*flow_mask) & 0x7U ) {  /* Flow A */
+    if( ((*flow_mask) & 0x1U)
+ && ((t) < (iter)) ) {
+    data->remote.arena  =  PARSEC_stencil_1D_FULL_ADT->arena ;
+    data->remote.src_datatype = PARSEC_stencil_1D_FULL_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_stencil_1D_FULL_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+    if( ((*flow_mask) & 0x2U)
+ && (((t) < (iter) && (n) > (0))) ) {
+    data->remote.arena  =  PARSEC_stencil_1D_LR_ADT->arena ;
+    data->remote.src_datatype = PARSEC_stencil_1D_LR_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_stencil_1D_LR_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = stencil_1D_task_inline_c_expr2_line_91(__parsec_tp, &this_task->locals);
+    data->remote.dst_displ    = stencil_1D_task_inline_c_expr2_line_91(__parsec_tp, &this_task->locals);
+      (*flow_mask) &= ~0x2U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+    if( ((*flow_mask) & 0x4U)
+ && (((t) < (iter) && (n) < ((descA->lnt - 1)))) ) {
+    data->remote.arena  =  PARSEC_stencil_1D_LR_ADT->arena ;
+    data->remote.src_datatype = PARSEC_stencil_1D_LR_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_stencil_1D_LR_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = stencil_1D_task_inline_c_expr1_line_92(__parsec_tp, &this_task->locals);
+    data->remote.dst_displ    = stencil_1D_task_inline_c_expr1_line_92(__parsec_tp, &this_task->locals);
+      (*flow_mask) &= ~0x4U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x7U) */
+ no_mask_match:
+  data->data                             = NULL;
+  data->remote.src_datatype = data->remote.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->remote.src_count    = data->remote.dst_count = 0;
+  data->remote.src_displ    = data->remote.dst_displ = 0;
+  data->data_future  = NULL;
+  (*flow_mask) = 0;  /* nothing left */
+  (void)t;  (void)m;  (void)n;  (void)myrank;  (void)rank_L;  (void)rank_R;
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+static int hook_of_stencil_1D_task(parsec_execution_stream_t *es, __parsec_stencil_1D_task_task_t *this_task)
+{
+  __parsec_stencil_1D_internal_taskpool_t *__parsec_tp = (__parsec_stencil_1D_internal_taskpool_t *)this_task->taskpool;
+  (void)es; (void)__parsec_tp;
+  const int t = this_task->locals.t.value; (void)t;
+  const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+  const int myrank = this_task->locals.myrank.value; (void)myrank;
+  const int rank_L = this_task->locals.rank_L.value; (void)rank_L;
+  const int rank_R = this_task->locals.rank_R.value; (void)rank_R;
+  (void)t;  (void)m;  (void)n;  (void)myrank;  (void)rank_L;  (void)rank_R;
+
+  /** Declare the variables that will hold the data, and all the accounting for each */
+  parsec_data_copy_t *_f_A = this_task->data._f_A.data_in;
+  void *A = PARSEC_DATA_COPY_GET_PTR(_f_A); (void)A;
+  parsec_data_copy_t *_f_AL = this_task->data._f_AL.data_in;
+  void *AL = PARSEC_DATA_COPY_GET_PTR(_f_AL); (void)AL;
+  parsec_data_copy_t *_f_AR = this_task->data._f_AR.data_in;
+  void *AR = PARSEC_DATA_COPY_GET_PTR(_f_AR); (void)AR;
+  parsec_data_copy_t *_f_A0 = this_task->data._f_A0.data_in;
+  void *A0 = PARSEC_DATA_COPY_GET_PTR(_f_A0); (void)A0;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    data_repo_entry_t *eA = this_task->data._f_A.source_repo_entry;
+    if( (NULL != eA) && (eA->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eA->sim_exec_date;
+    data_repo_entry_t *eAL = this_task->data._f_AL.source_repo_entry;
+    if( (NULL != eAL) && (eAL->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eAL->sim_exec_date;
+    data_repo_entry_t *eAR = this_task->data._f_AR.source_repo_entry;
+    if( (NULL != eAR) && (eAR->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eAR->sim_exec_date;
+    data_repo_entry_t *eA0 = this_task->data._f_A0.source_repo_entry;
+    if( (NULL != eA0) && (eA0->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eA0->sim_exec_date;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+    if ( NULL != _f_A ) {
+#if defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) || defined(PARSEC_HAVE_DEV_HIP_SUPPORT)
+      parsec_data_transfer_ownership_to_copy( _f_A->original, 0 /* device */,
+                                           PARSEC_FLOW_ACCESS_RW);
+#endif  /* defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) || defined(PARSEC_HAVE_DEV_HIP_SUPPORT) */
+      _f_A->version++;  /* A */
+#if defined(PARSEC_DEBUG_NOISIER)
+      char tmp[128];
+      PARSEC_DEBUG_VERBOSE(10, parsec_debug_output,
+                           "Body of %s: change Data copy %p to version %d",
+                           parsec_task_snprintf(tmp, 128, (parsec_task_t*)(this_task)),
+                           _f_A, _f_A->version);
+#endif /* defined(PARSEC_DEBUG_NOISIER) */
+    }
+  /** Cache Awareness Accounting */
+#if defined(PARSEC_CACHE_AWARENESS)
+  cache_buf_referenced(es->closest_cache, A);
+  cache_buf_referenced(es->closest_cache, AL);
+  cache_buf_referenced(es->closest_cache, AR);
+  cache_buf_referenced(es->closest_cache, A0);
+#endif /* PARSEC_CACHE_AWARENESS */
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                                  task BODY                                    -----*/
+
+{
+    int nb = (n == descA->lnt-1) ? parsec_imin(descA->nb, descA->ln-(descA->lnt-1)*descA->nb): descA->nb;
+    if( t > 0 ) {
+        CORE_copydata_stencil_1D(A0, AL, AR, descA->mb, descA->nb, myrank, rank_L, rank_R, R, n, descA->lnt-1);
+        CORE_stencil_1D(A, A0, weight_1D, descA->mb, nb, descA->mb, R);
+    }
+}
+
+/*-----                                END OF task BODY                                -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#endif  /*  defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+static int complete_hook_of_stencil_1D_task(parsec_execution_stream_t *es, __parsec_stencil_1D_task_task_t *this_task)
+{
+  const __parsec_stencil_1D_internal_taskpool_t *__parsec_tp = (__parsec_stencil_1D_internal_taskpool_t *)this_task->taskpool;
+#if defined(DISTRIBUTED)
+    const int t = this_task->locals.t.value; (void)t;
+  const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+  const int myrank = this_task->locals.myrank.value; (void)myrank;
+  const int rank_L = this_task->locals.rank_L.value; (void)rank_L;
+  const int rank_R = this_task->locals.rank_R.value; (void)rank_R;
+#endif  /* defined(DISTRIBUTED) */
+  (void)es; (void)__parsec_tp;
+parsec_data_t* data_t_desc = NULL; (void)data_t_desc;
+#if defined(DISTRIBUTED)
+  /** If not working on distributed, there is no risk that data is not in place */
+  (void)t;  (void)m;  (void)n;  (void)myrank;  (void)rank_L;  (void)rank_R;
+
+#endif /* DISTRIBUTED */
+#if defined(PARSEC_PROF_GRAPHER)
+  parsec_prof_grapher_task((parsec_task_t*)this_task, es->th_id, es->virtual_process->vp_id,
+     __jdf2c_key_fns_task.key_hash(this_task->task_class->make_key( (parsec_taskpool_t*)this_task->taskpool, ((parsec_task_t*)this_task)->locals), NULL));
+#endif  /* defined(PARSEC_PROF_GRAPHER) */
+  release_deps_of_stencil_1D_task(es, this_task,
+      PARSEC_ACTION_RELEASE_REMOTE_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_REFS |
+      PARSEC_ACTION_RESHAPE_ON_RELEASE |
+      0x7,  /* mask of all dep_index */ 
+      NULL);
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static parsec_hook_return_t release_task_of_stencil_1D_task(parsec_execution_stream_t *es, parsec_task_t *this_task)
+{
+    const __parsec_stencil_1D_internal_taskpool_t *__parsec_tp =
+        (const __parsec_stencil_1D_internal_taskpool_t *)this_task->taskpool;
+    parsec_hash_table_t *ht = (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[0];
+    parsec_key_t key = this_task->task_class->make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals);
+    parsec_hashable_dependency_t *hash_dep = (parsec_hashable_dependency_t *)parsec_hash_table_remove(ht, key);
+    parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);
+    return parsec_release_task_to_mempool_update_nbtasks(es, this_task);
+}
+
+static char *stencil_1D_stencil_1D_task_internal_init_deps_key_functions_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_stencil_1D_internal_taskpool_t *__parsec_tp = (__parsec_stencil_1D_internal_taskpool_t *)user_data;
+  __parsec_stencil_1D_task_parsec_assignment_t __jdf2c__assignments = {  .t.value = 0, .m.value = 0, .n.value = 0, .myrank.value = 0, .rank_L.value = 0, .rank_R.value = 0 };
+  int t = (__parsec_key) % __parsec_tp->task_t_range + __parsec_tp->task_t_min;
+  __parsec_key = __parsec_key / __parsec_tp->task_t_range;
+  __jdf2c__assignments.t.value = t;
+  int m = (t % descA->lmt);
+  (void)m;
+  __jdf2c__assignments.m.value = m;
+  int n = (__parsec_key) % __parsec_tp->task_n_range + __parsec_tp->task_n_min;
+  __parsec_key = __parsec_key / __parsec_tp->task_n_range;
+  __jdf2c__assignments.n.value = n;
+  int myrank = descA->super.myrank;
+  (void)myrank;
+  __jdf2c__assignments.myrank.value = myrank;
+  int rank_L = stencil_1D_task_inline_c_expr4_line_78(__parsec_tp, &__jdf2c__assignments);
+  (void)rank_L;
+  __jdf2c__assignments.rank_L.value = rank_L;
+  int rank_R = stencil_1D_task_inline_c_expr3_line_79(__parsec_tp, &__jdf2c__assignments);
+  (void)rank_R;
+  __jdf2c__assignments.rank_R.value = rank_R;
+  (void)__jdf2c__assignments;
+  snprintf(buffer, buffer_size, "task(%d, %d)", t, n);
+  return buffer;
+}
+
+static parsec_key_fn_t stencil_1D_stencil_1D_task_internal_init_deps_key_functions = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = stencil_1D_stencil_1D_task_internal_init_deps_key_functions_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/* Needs: min-max count-tasks iterate */
+static int stencil_1D_task_internal_init(parsec_execution_stream_t * es, __parsec_stencil_1D_task_task_t * this_task)
+{
+  __parsec_stencil_1D_internal_taskpool_t *__parsec_tp = (__parsec_stencil_1D_internal_taskpool_t*)this_task->taskpool;
+  int32_t nb_tasks = 0, saved_nb_tasks = 0;
+int32_t __t_min = 0x7fffffff, __t_max = 0;int32_t __jdf2c_t_min = 0x7fffffff, __jdf2c_t_max = 0;int32_t __n_min = 0x7fffffff, __n_max = 0;int32_t __jdf2c_n_min = 0x7fffffff, __jdf2c_n_max = 0;  __parsec_stencil_1D_task_parsec_assignment_t assignments = {  .t.value = 0, .m.value = 0, .n.value = 0, .myrank.value = 0, .rank_L.value = 0, .rank_R.value = 0 };
+  int32_t  t,  m,  n,  myrank,  rank_L,  rank_R;
+  int32_t __jdf2c_t_start, __jdf2c_t_end, __jdf2c_t_inc;
+  int32_t __jdf2c_n_start, __jdf2c_n_end, __jdf2c_n_inc;
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+  PARSEC_PROFILING_TRACE(es->es_profile,
+                         this_task->taskpool->profiling_array[START_KEY(this_task->task_class->task_class_id)],
+                         0,
+                         this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    __jdf2c_t_start = 0;
+    __jdf2c_t_end = iter;
+    __jdf2c_t_inc = 1;
+    __t_min = parsec_imin(__jdf2c_t_start, __jdf2c_t_end);
+    __t_max = parsec_imax(__jdf2c_t_start, __jdf2c_t_end);
+    __jdf2c_t_min = parsec_imin(__jdf2c_t_min, __t_min);
+    __jdf2c_t_max = parsec_imax(__jdf2c_t_max, __t_max);
+    for(t =  __jdf2c_t_start;
+        t <= __jdf2c_t_end;
+        t += __jdf2c_t_inc) {
+    assignments.t.value = t;
+  {  /* block for the non-range variable m */
+      m = (t % descA->lmt);
+      assignments.m.value = m;
+        __jdf2c_n_start = 0;
+        __jdf2c_n_end = (descA->lnt - 1);
+        __jdf2c_n_inc = 1;
+        __n_min = parsec_imin(__jdf2c_n_start, __jdf2c_n_end);
+        __n_max = parsec_imax(__jdf2c_n_start, __jdf2c_n_end);
+        __jdf2c_n_min = parsec_imin(__jdf2c_n_min, __n_min);
+        __jdf2c_n_max = parsec_imax(__jdf2c_n_max, __n_max);
+        for(n =  __jdf2c_n_start;
+            n <= __jdf2c_n_end;
+            n += __jdf2c_n_inc) {
+        assignments.n.value = n;
+      {  /* block for the non-range variable myrank */
+          myrank = descA->super.myrank;
+          assignments.myrank.value = myrank;
+        {  /* block for the non-range variable rank_L */
+            rank_L = stencil_1D_task_inline_c_expr4_line_78(__parsec_tp, &assignments);
+            assignments.rank_L.value = rank_L;
+          {  /* block for the non-range variable rank_R */
+              rank_R = stencil_1D_task_inline_c_expr3_line_79(__parsec_tp, &assignments);
+              assignments.rank_R.value = rank_R;
+              if( !task_pred(t, m, n, myrank, rank_L, rank_R) ) continue;
+              nb_tasks++;
+            } /* block for the non-range variable rank_R */ 
+          } /* block for the non-range variable rank_L */ 
+        } /* block for the non-range variable myrank */ 
+      } /* Loop on normal range n */
+    } /* Non-range variable m */ 
+  } /* For loop of t */ 
+   if( 0 != nb_tasks ) {
+     (void)parsec_atomic_fetch_add_int32(&__parsec_tp->initial_number_tasks, nb_tasks);
+   }
+  /* Set the range variables for the collision-free hash-computation */
+  __parsec_tp->task_t_min   = __jdf2c_t_min;
+  __parsec_tp->task_t_range = (__jdf2c_t_max - __jdf2c_t_min) + 1;
+  __parsec_tp->task_n_min   = __jdf2c_n_min;
+  __parsec_tp->task_n_range = (__jdf2c_n_max - __jdf2c_n_min) + 1;
+    do {
+      this_task->super.list_next = (parsec_list_item_t*)__parsec_tp->startup_queue;
+    } while(!parsec_atomic_cas_ptr(&__parsec_tp->startup_queue, (parsec_list_item_t*)this_task->super.list_next, this_task));
+    this_task->status = PARSEC_TASK_STATUS_HOOK;
+
+  PARSEC_AYU_REGISTER_TASK(&stencil_1D_task);
+  __parsec_tp->super.super.dependencies_array[0] = PARSEC_OBJ_NEW(parsec_hash_table_t);
+  parsec_hash_table_init(__parsec_tp->super.super.dependencies_array[0], offsetof(parsec_hashable_dependency_t, ht_item), 10, stencil_1D_stencil_1D_task_internal_init_deps_key_functions, this_task->taskpool);
+  __parsec_tp->repositories[0] = data_repo_create_nothreadsafe(nb_tasks, __jdf2c_key_fns_task, (parsec_taskpool_t*)__parsec_tp, 4);
+(void)saved_nb_tasks;
+(void)__t_min; (void)__t_max;(void)__n_min; (void)__n_max;  (void)__jdf2c_t_start; (void)__jdf2c_t_end; (void)__jdf2c_t_inc;  (void)__jdf2c_n_start; (void)__jdf2c_n_end; (void)__jdf2c_n_inc;  (void)assignments; (void)__parsec_tp; (void)es;
+  if(1 == parsec_atomic_fetch_dec_int32(&__parsec_tp->sync_point)) {
+    /* Last initialization task complete. Update the number of tasks. */
+    __parsec_tp->super.super.tdm.module->taskpool_addto_nb_tasks(&__parsec_tp->super.super, __parsec_tp->initial_number_tasks);
+    parsec_mfence();  /* write memory barrier to guarantee that the scheduler gets the correct number of tasks */
+    parsec_taskpool_enable((parsec_taskpool_t*)__parsec_tp, &__parsec_tp->startup_queue,
+                           (parsec_task_t*)this_task, es, __parsec_tp->super.super.nb_pending_actions);
+    __parsec_tp->super.super.tdm.module->taskpool_ready(&__parsec_tp->super.super);
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+    PARSEC_PROFILING_TRACE(es->es_profile,
+                           this_task->taskpool->profiling_array[2 * this_task->task_class->task_class_id + 1],
+                           0,
+                           this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    if( 1 >= __parsec_tp->super.super.nb_pending_actions ) {
+        /* if no tasks will be generated let's prevent the runtime from calling the hook and instead go directly to complete the task */
+        this_task->status = PARSEC_TASK_STATUS_COMPLETE;
+    }
+    return PARSEC_HOOK_RETURN_DONE;
+  }
+  return PARSEC_HOOK_RETURN_ASYNC;
+}
+
+static int __jdf2c_startup_task(parsec_execution_stream_t * es, __parsec_stencil_1D_task_task_t *this_task)
+{
+  __parsec_stencil_1D_task_task_t* new_task;
+  __parsec_stencil_1D_internal_taskpool_t* __parsec_tp = (__parsec_stencil_1D_internal_taskpool_t*)this_task->taskpool;
+  parsec_context_t *context = __parsec_tp->super.super.context;
+  int vpid = 0, nb_tasks = 0;
+  size_t total_nb_tasks = 0;
+  parsec_list_item_t* pready_ring[context->nb_vp];
+  int restore_context = 0;
+  int t = this_task->locals.t.value;  /* retrieve value saved during the last iteration */
+  int m = this_task->locals.m.value;  /* retrieve value saved during the last iteration */
+  int n = this_task->locals.n.value;  /* retrieve value saved during the last iteration */
+  int myrank = this_task->locals.myrank.value;  /* retrieve value saved during the last iteration */
+  int rank_L = this_task->locals.rank_L.value;  /* retrieve value saved during the last iteration */
+  int rank_R = this_task->locals.rank_R.value;  /* retrieve value saved during the last iteration */
+  for(int _i = 0; _i < context->nb_vp; pready_ring[_i++] = NULL );
+  if( 0 != this_task->locals.reserved[0].value ) {
+    this_task->locals.reserved[0].value = 1; /* reset the submission process */
+    restore_context = 1;
+    goto restore_context_0;
+  }
+  this_task->locals.reserved[0].value = 1; /* a sane default value */
+  for(this_task->locals.t.value = t = 0;
+      this_task->locals.t.value <= iter;
+      this_task->locals.t.value += 1, t = this_task->locals.t.value) {
+    this_task->locals.m.value = m = (t % descA->lmt);
+    for(this_task->locals.n.value = n = 0;
+        this_task->locals.n.value <= (descA->lnt - 1);
+        this_task->locals.n.value += 1, n = this_task->locals.n.value) {
+      this_task->locals.myrank.value = myrank = descA->super.myrank;
+      this_task->locals.rank_L.value = rank_L = stencil_1D_task_inline_c_expr4_line_78(__parsec_tp, &this_task->locals);
+      this_task->locals.rank_R.value = rank_R = stencil_1D_task_inline_c_expr3_line_79(__parsec_tp, &this_task->locals);
+      if( !task_pred(t, m, n, myrank, rank_L, rank_R) ) continue;
+  __parsec_stencil_1D_task_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_stencil_1D_task_parsec_assignment_t*)&this_task->locals;
+  (void)__jdf2c__tmp_locals;
+  /* Flow for A is always a memory reference */
+  if( !(((t) > (0) && (n) > (0))) ) goto AR_check_flow;
+  continue; /* All other cases are not startup tasks */
+ AR_check_flow:
+  if( !(((t) > (0) && (n) < ((descA->lnt - 1)))) ) goto A0_check_flow;
+  continue; /* All other cases are not startup tasks */
+ A0_check_flow:
+  if( !((t) > (0)) ) goto __jdf2c_done_check_flow;
+  continue; /* All other cases are not startup tasks */
+ __jdf2c_done_check_flow:
+      if( NULL != ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of ) {
+        vpid = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, m, n);
+        assert(context->nb_vp >= vpid);
+      } else {
+        vpid = (vpid + 1) % context->nb_vp;  /* spread the initial joy */
+      }
+      new_task = (__parsec_stencil_1D_task_task_t*)parsec_thread_mempool_allocate( context->virtual_processes[vpid]->execution_streams[0]->context_mempool );
+      PARSEC_OBJ_CONSTRUCT(new_task, parsec_task_t); /* construct called only when new, force-construct it again */
+      /* Copy only the valid elements from this_task to new_task one */
+      new_task->taskpool   = this_task->taskpool;
+      new_task->task_class = __parsec_tp->super.super.task_classes_array[stencil_1D_task.task_class_id];
+      new_task->chore_mask   = PARSEC_DEV_ALL;
+      new_task->locals.t.value = this_task->locals.t.value;
+      new_task->locals.m.value = this_task->locals.m.value;
+      new_task->locals.n.value = this_task->locals.n.value;
+      new_task->locals.myrank.value = this_task->locals.myrank.value;
+      new_task->locals.rank_L.value = this_task->locals.rank_L.value;
+      new_task->locals.rank_R.value = this_task->locals.rank_R.value;
+      PARSEC_LIST_ITEM_SINGLETON(new_task);
+      new_task->priority = __parsec_tp->super.super.priority;
+      new_task->repo_entry = NULL;
+      new_task->data._f_A.source_repo_entry = NULL;
+      new_task->data._f_A.source_repo       = NULL;
+      new_task->data._f_A.data_in         = NULL;
+      new_task->data._f_A.data_out        = NULL;
+      new_task->data._f_A.fulfill         = 0;
+      new_task->data._f_AL.source_repo_entry = NULL;
+      new_task->data._f_AL.source_repo       = NULL;
+      new_task->data._f_AL.data_in         = NULL;
+      new_task->data._f_AL.data_out        = NULL;
+      new_task->data._f_AL.fulfill         = 0;
+      new_task->data._f_AR.source_repo_entry = NULL;
+      new_task->data._f_AR.source_repo       = NULL;
+      new_task->data._f_AR.data_in         = NULL;
+      new_task->data._f_AR.data_out        = NULL;
+      new_task->data._f_AR.fulfill         = 0;
+      new_task->data._f_A0.source_repo_entry = NULL;
+      new_task->data._f_A0.source_repo       = NULL;
+      new_task->data._f_A0.data_in         = NULL;
+      new_task->data._f_A0.data_out        = NULL;
+      new_task->data._f_A0.fulfill         = 0;
+#if defined(PARSEC_DEBUG_NOISIER)
+      {
+        char tmp[128];
+        PARSEC_DEBUG_VERBOSE(10, parsec_debug_output, "Add startup task %s to vpid %d",
+               parsec_task_snprintf(tmp, 128, (parsec_task_t*)new_task), vpid);
+      }
+#endif
+      parsec_dependencies_mark_task_as_startup((parsec_task_t*)new_task, es);
+      pready_ring[vpid] = parsec_list_item_ring_push_sorted(pready_ring[vpid],
+                                                            (parsec_list_item_t*)new_task,
+                                                            parsec_execution_context_priority_comparator);
+      nb_tasks++;
+     restore_context_0:  /* we jump here just so that we have code after the label */
+      restore_context = 0;
+      (void)restore_context;
+      if( nb_tasks > this_task->locals.reserved[0].value ) {
+        if( (size_t)this_task->locals.reserved[0].value < parsec_task_startup_iter ) this_task->locals.reserved[0].value <<= 1;
+        __parsec_schedule_vp(es, (parsec_task_t**)pready_ring, 0);
+        total_nb_tasks += nb_tasks;
+        nb_tasks = 0;
+        if( total_nb_tasks > parsec_task_startup_chunk ) {  /* stop here and request to be rescheduled */
+          return PARSEC_HOOK_RETURN_AGAIN;
+        }
+      }
+    } /* Loop on normal range n */
+  } /* Loop on normal range t */
+  (void)vpid;
+  if( 0 != nb_tasks ) {
+    __parsec_schedule_vp(es, (parsec_task_t**)pready_ring, 0);
+    nb_tasks = 0;
+  }
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static const __parsec_chore_t __stencil_1D_task_chores[] ={
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+    { .type     = PARSEC_DEV_CPU,
+      .evaluate = (parsec_evaluate_function_t*)NULL,
+      .hook     = (parsec_hook_t*)hook_of_stencil_1D_task },
+#endif  /* defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+    { .type     = PARSEC_DEV_NONE,
+      .evaluate = NULL,
+      .hook     = (parsec_hook_t*)NULL },  /* End marker */
+};
+
+static const parsec_task_class_t stencil_1D_task = {
+  .name = "task",
+  .task_class_id = 0,
+  .nb_flows = 4,
+  .nb_parameters = 2,
+  .nb_locals = 6,
+  .task_class_type = PARSEC_TASK_CLASS_TYPE_PTG,
+  .params = { &symb_stencil_1D_task_t, &symb_stencil_1D_task_n, NULL },
+  .locals = { &symb_stencil_1D_task_t, &symb_stencil_1D_task_m, &symb_stencil_1D_task_n, &symb_stencil_1D_task_myrank, &symb_stencil_1D_task_rank_L, &symb_stencil_1D_task_rank_R, NULL },
+  .data_affinity = (parsec_data_ref_fn_t*)affinity_of_stencil_1D_task,
+  .initial_data = (parsec_data_ref_fn_t*)affinity_of_stencil_1D_task,
+  .final_data = (parsec_data_ref_fn_t*)affinity_of_stencil_1D_task,
+  .priority = NULL,
+  .properties = properties_of_stencil_1D_task,
+#if MAX_PARAM_COUNT < 4  /* number of read flows of task */
+  #error Too many read flows for task task
+#endif  /* MAX_PARAM_COUNT */
+#if MAX_PARAM_COUNT < 1  /* number of write flows of task */
+  #error Too many write flows for task task
+#endif  /* MAX_PARAM_COUNT */
+  .in = { &flow_of_stencil_1D_task_for_A, &flow_of_stencil_1D_task_for_AL, &flow_of_stencil_1D_task_for_AR, &flow_of_stencil_1D_task_for_A0, NULL },
+  .out = { &flow_of_stencil_1D_task_for_A, NULL },
+  .flags = 0x0 | PARSEC_HAS_IN_IN_DEPENDENCIES | PARSEC_USE_DEPS_MASK,
+  .dependencies_goal = 0xf,
+  .make_key = __jdf2c_make_key_task,
+  .task_snprintf = parsec_task_snprintf,
+#if defined(PARSEC_PROF_TRACE)
+  .profile_info = &parsec_task_profile_info,
+#endif
+  .key_functions = &__jdf2c_key_fns_task,
+  .fini = (parsec_hook_t*)NULL,
+  .incarnations = __stencil_1D_task_chores,
+  .find_deps = parsec_hash_find_deps,
+  .update_deps = parsec_update_deps_with_mask,
+  .iterate_successors = (parsec_traverse_function_t*)iterate_successors_of_stencil_1D_task,
+  .iterate_predecessors = (parsec_traverse_function_t*)iterate_predecessors_of_stencil_1D_task,
+  .release_deps = (parsec_release_deps_t*)release_deps_of_stencil_1D_task,
+  .prepare_output = (parsec_hook_t*)NULL,
+  .prepare_input = (parsec_hook_t*)data_lookup_of_stencil_1D_task,
+  .time_estimate = NULL,
+  .get_datatype = datatype_lookup_of_stencil_1D_task,
+  .complete_execution = (parsec_hook_t*)complete_hook_of_stencil_1D_task,
+  .release_task = &release_task_of_stencil_1D_task,
+#if defined(PARSEC_SIM)
+  .sim_cost_fct = (parsec_sim_cost_fct_t*)NULL,
+#endif
+};
+
+
+static const parsec_task_class_t *stencil_1D_task_classes[] = {
+  &stencil_1D_task
+};
+
+static void stencil_1D_startup(parsec_context_t *context, __parsec_stencil_1D_internal_taskpool_t *__parsec_tp, parsec_list_item_t ** ready_tasks)
+{
+  uint32_t i, supported_dev = 0;
+ 
+  for( i = 0; i < parsec_nb_devices; i++ ) {
+    if( !(__parsec_tp->super.super.devices_index_mask & (1<<i)) ) continue;
+    parsec_device_module_t* device = parsec_mca_device_get(i);
+    parsec_data_collection_t* parsec_dc;
+ 
+    if(NULL == device) continue;
+    if(NULL != device->taskpool_register)
+      if( PARSEC_SUCCESS != device->taskpool_register(device, (parsec_taskpool_t*)__parsec_tp) ) {
+        parsec_debug_verbose(5, parsec_debug_output, "Device %s refused to register taskpool %p", device->name, __parsec_tp);
+        __parsec_tp->super.super.devices_index_mask &= ~(1 << device->device_index);
+        continue;
+      }
+    if(NULL != device->memory_register) {  /* Register all the data */
+      parsec_dc = (parsec_data_collection_t*)__parsec_tp->super._g_descA;
+      if( (NULL != parsec_dc->register_memory) &&
+          (PARSEC_SUCCESS != parsec_dc->register_memory(parsec_dc, device)) ) {
+        parsec_debug_verbose(3, parsec_debug_output, "Device %s refused to register memory for data %s (%p) from taskpool %p",
+                     device->name, parsec_dc->key_base, parsec_dc, __parsec_tp);
+        __parsec_tp->super.super.devices_index_mask &= ~(1 << device->device_index);
+      }
+    }
+    supported_dev |= device->type;
+  }
+  /* Remove all the chores without a backend device */
+  for( i = 0; i < PARSEC_stencil_1D_NB_TASK_CLASSES; i++ ) {
+    parsec_task_class_t* tc = (parsec_task_class_t*)__parsec_tp->super.super.task_classes_array[i];
+    __parsec_chore_t* chores = (__parsec_chore_t*)tc->incarnations;
+    uint32_t idx = 0, j;
+    for( j = 0; PARSEC_DEV_NONE != chores[j].type; j++ ) {
+      if( !(supported_dev & chores[j].type) ) continue;
+      if( j != idx ) {
+        chores[idx] = chores[j];
+        parsec_debug_verbose(20, parsec_debug_output, "Device type %i disabled for function %s"
+, chores[j].type, tc->name);
+      }
+      idx++;
+    }
+    chores[idx].type     = PARSEC_DEV_NONE;
+    chores[idx].evaluate = NULL;
+    chores[idx].hook     = NULL;
+    /* Create the initialization tasks for each taskclass */
+    parsec_task_t* task = (parsec_task_t*)parsec_thread_mempool_allocate(context->virtual_processes[0]->execution_streams[0]->context_mempool);
+    PARSEC_OBJ_CONSTRUCT(task, parsec_task_t); /* construct called only when new, force-construct it again */
+    task->taskpool = (parsec_taskpool_t *)__parsec_tp;
+    task->chore_mask = PARSEC_DEV_CPU;
+    memset(&task->locals, 0, sizeof(parsec_assignment_t) * MAX_LOCAL_COUNT);
+    PARSEC_LIST_ITEM_SINGLETON(task);
+    task->priority = -1;
+    task->task_class = task->taskpool->task_classes_array[PARSEC_stencil_1D_NB_TASK_CLASSES + i];
+    int where = i % context->nb_vp;
+    if( NULL == ready_tasks[where] ) ready_tasks[where] = &task->super;
+    else ready_tasks[where] = parsec_list_item_ring_push(ready_tasks[where], &task->super);
+  }
+}
+static void __parsec_stencil_1D_internal_destructor( __parsec_stencil_1D_internal_taskpool_t *__parsec_tp )
+{
+  uint32_t i;
+  parsec_taskpool_unregister( &__parsec_tp->super.super );
+  if(NULL != __parsec_tp->super.super.tdm.module) __parsec_tp->super.super.tdm.module->unmonitor_taskpool(&__parsec_tp->super.super);
+  for( i = 0; i < (uint32_t)(2 * __parsec_tp->super.super.nb_task_classes); i++ ) {  /* Extra startup function added at the end */
+    parsec_task_class_t* tc = (parsec_task_class_t*)__parsec_tp->super.super.task_classes_array[i];
+    free((void*)tc->incarnations);
+    free(tc);
+  }
+  free(__parsec_tp->super.super.task_classes_array); __parsec_tp->super.super.task_classes_array = NULL;
+  __parsec_tp->super.super.nb_task_classes = 0;
+
+  for(i = 0; i < (uint32_t)__parsec_tp->super.arenas_datatypes_size; i++) {
+    if( NULL != __parsec_tp->super.arenas_datatypes[i].arena ) {
+      PARSEC_OBJ_RELEASE(__parsec_tp->super.arenas_datatypes[i].arena);
+    }
+  }
+  /* Destroy the data repositories for this object */
+   data_repo_destroy_nothreadsafe(__parsec_tp->repositories[0]);  /* task */
+  /* Release the dependencies arrays for this object */
+  parsec_hash_table_fini( (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[0] );
+  PARSEC_OBJ_RELEASE(__parsec_tp->super.super.dependencies_array[0]);
+  __parsec_tp->super.super.dependencies_array[0] = NULL;
+  free( __parsec_tp->super.super.dependencies_array );
+  __parsec_tp->super.super.dependencies_array = NULL;
+  /* Unregister all the data */
+  uint32_t _i;
+  for( _i = 0; _i < parsec_nb_devices; _i++ ) {
+    parsec_device_module_t* device;
+    parsec_data_collection_t* parsec_dc;
+    if(!(__parsec_tp->super.super.devices_index_mask & (1 << _i))) continue;
+    if((NULL == (device = parsec_mca_device_get(_i))) || (NULL == device->memory_unregister)) continue;
+    parsec_dc = (parsec_data_collection_t*)__parsec_tp->super._g_descA;
+  if( NULL != parsec_dc->unregister_memory ) { (void)parsec_dc->unregister_memory(parsec_dc, device); };
+}
+  /* Unregister the taskpool from the devices */
+  for( i = 0; i < parsec_nb_devices; i++ ) {
+    if(!(__parsec_tp->super.super.devices_index_mask & (1 << i))) continue;
+    __parsec_tp->super.super.devices_index_mask ^= (1 << i);
+    parsec_device_module_t* device = parsec_mca_device_get(i);
+    if((NULL == device) || (NULL == device->taskpool_unregister)) continue;
+    if( PARSEC_SUCCESS != device->taskpool_unregister(device, &__parsec_tp->super.super) ) continue;
+  }
+  free(__parsec_tp->super.super.taskpool_name); __parsec_tp->super.super.taskpool_name = NULL;
+}
+
+void __parsec_stencil_1D_internal_constructor(__parsec_stencil_1D_internal_taskpool_t* __parsec_tp)
+{
+  parsec_task_class_t* tc;
+  uint32_t i, j;
+
+  __parsec_tp->super.super.nb_task_classes = PARSEC_stencil_1D_NB_TASK_CLASSES;
+  __parsec_tp->super.super.devices_index_mask = PARSEC_DEVICES_ALL;
+  __parsec_tp->super.super.taskpool_name = strdup("stencil_1D");
+  parsec_termdet_open_module(&__parsec_tp->super.super, "local");
+  __parsec_tp->super.super.tdm.module->monitor_taskpool(&__parsec_tp->super.super,
+                                                        parsec_taskpool_termination_detected);
+  __parsec_tp->super.super.update_nb_runtime_task = parsec_add_fetch_runtime_task;
+  __parsec_tp->super.super.dependencies_array = (void **)
+              calloc(__parsec_tp->super.super.nb_task_classes, sizeof(void*));
+  /* Twice the size to hold the startup tasks function_t */
+  __parsec_tp->super.super.task_classes_array = (const parsec_task_class_t**)
+              calloc((2 * PARSEC_stencil_1D_NB_TASK_CLASSES + 1), sizeof(parsec_task_class_t*));
+  __parsec_tp->super.super.tdm.module->taskpool_addto_runtime_actions(&__parsec_tp->super.super, PARSEC_stencil_1D_NB_TASK_CLASSES);  /* for the startup tasks */
+  __parsec_tp->super.super.taskpool_type = PARSEC_TASKPOOL_TYPE_PTG;
+  __parsec_tp->sync_point = __parsec_tp->super.super.nb_task_classes;
+  __parsec_tp->initial_number_tasks = 0;
+  __parsec_tp->startup_queue = NULL;
+  for( i = 0; i < __parsec_tp->super.super.nb_task_classes; i++ ) {
+    __parsec_tp->super.super.task_classes_array[i] = tc = malloc(sizeof(parsec_task_class_t));
+    memcpy(tc, stencil_1D_task_classes[i], sizeof(parsec_task_class_t));
+    for( j = 0; PARSEC_DEV_NONE != tc->incarnations[j].type; j++);  /* compute the number of incarnations */
+    tc->incarnations = (__parsec_chore_t*)malloc((j+1) * sizeof(__parsec_chore_t));
+        memcpy((__parsec_chore_t*)tc->incarnations, stencil_1D_task_classes[i]->incarnations, (j+1) * sizeof(__parsec_chore_t));
+
+    /* Add a placeholder for initialization and startup task */
+    __parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+i] = tc = (parsec_task_class_t*)malloc(sizeof(parsec_task_class_t));
+    memcpy(tc, (void*)&__parsec_generic_startup, sizeof(parsec_task_class_t));
+    tc->task_class_id = __parsec_tp->super.super.nb_task_classes + i;
+    tc->incarnations = (__parsec_chore_t*)malloc(2 * sizeof(__parsec_chore_t));
+    memcpy((__parsec_chore_t*)tc->incarnations, (void*)__parsec_generic_startup.incarnations, 2 * sizeof(__parsec_chore_t));
+    tc->release_task = parsec_release_task_to_mempool_and_count_as_runtime_tasks;
+  }
+  /* Startup task for task */
+  tc = (parsec_task_class_t *)__parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+0];
+  tc->name = "Startup for task";
+  tc->prepare_input = (parsec_hook_t*)stencil_1D_task_internal_init;
+  ((__parsec_chore_t*)&tc->incarnations[0])->hook = (parsec_hook_t *)__jdf2c_startup_task;
+  /* Compute the number of arenas_datatypes: */
+  /*   PARSEC_stencil_1D_DEFAULT_ARENA  ->  0 */
+  /*   PARSEC_stencil_1D_LR_ARENA  ->  1 */
+  /*   PARSEC_stencil_1D_FULL_ARENA  ->  2 */
+  __parsec_tp->super.arenas_datatypes_size = 3;
+  memset(&__parsec_tp->super.arenas_datatypes[0], 0, __parsec_tp->super.arenas_datatypes_size*sizeof(parsec_arena_datatype_t));
+  /* If profiling is enabled, the keys for profiling */
+#  if defined(PARSEC_PROF_TRACE)
+  __parsec_tp->super.super.profiling_array = stencil_1D_profiling_array;
+  if( -2 == stencil_1D_profiling_array[0] ) {
+    #if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+parsec_profiling_add_dictionary_keyword("stencil_1D::task::internal init", "fill:34D8D8",
+                                       0,
+                                       NULL,
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(stencil_1D_task.task_class_id  + PARSEC_stencil_1D_NB_TASK_CLASSES)/* task (internal init) start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(stencil_1D_task.task_class_id  + PARSEC_stencil_1D_NB_TASK_CLASSES)/* task (internal init) end key */]);
+#endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+parsec_profiling_add_dictionary_keyword("stencil_1D::task", "fill:CC2828",
+                                       sizeof(parsec_task_prof_info_t)+6*sizeof(parsec_assignment_t),
+                                       "dc_key{uint64_t};priority{int32_t};dc_dataid{uint32_t};tcid{uint32_t};trc{int32_t};t{int32_t};m{int32_t};n{int32_t};myrank{int32_t};rank_L{int32_t};rank_R{int32_t}",
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(stencil_1D_task.task_class_id) /* task start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(stencil_1D_task.task_class_id) /* task end key */]);
+
+  }
+#  endif /* defined(PARSEC_PROF_TRACE) */
+  __parsec_tp->super.super.repo_array = __parsec_tp->repositories;
+  __parsec_tp->super.super.startup_hook = (parsec_startup_fn_t)stencil_1D_startup;
+  (void)parsec_taskpool_reserve_id((parsec_taskpool_t*)__parsec_tp);
+}
+
+  /** Generate class declaration and instance using the above constructor and destructor */
+  PARSEC_OBJ_CLASS_DECLARATION(__parsec_stencil_1D_internal_taskpool_t);
+  PARSEC_OBJ_CLASS_INSTANCE(__parsec_stencil_1D_internal_taskpool_t, parsec_stencil_1D_taskpool_t,
+                            __parsec_stencil_1D_internal_constructor, __parsec_stencil_1D_internal_destructor);
+
+#undef descA
+#undef iter
+#undef R
+
+parsec_stencil_1D_taskpool_t *parsec_stencil_1D_new(parsec_tiled_matrix_t* descA /* data descA */, int iter, int R)
+{
+  __parsec_stencil_1D_internal_taskpool_t *__parsec_tp = PARSEC_OBJ_NEW(__parsec_stencil_1D_internal_taskpool_t);
+  /* Dump the hidden parameters with default values */
+
+  /* Now the Parameter-dependent structures: */
+  __parsec_tp->super._g_descA = descA;
+  __parsec_tp->super._g_iter = iter;
+  __parsec_tp->super._g_R = R;
+  PARSEC_AYU_REGISTER_TASK(&stencil_1D_task);
+  __parsec_tp->super.super.startup_hook = (parsec_startup_fn_t)stencil_1D_startup;
+  (void)parsec_taskpool_reserve_id((parsec_taskpool_t*)__parsec_tp);
+/* Prevent warnings related to not used hidden global variables */
+;
+  return (parsec_stencil_1D_taskpool_t*)__parsec_tp;
+}
+
+
+/**
+ * @brief Stencil 1D, no-blocking
+ *
+ * @param [inout] dcA: the data, already distributed and allocated
+ * @param [in] iter: iterations
+ * @param [in] R: radius
+ */
+parsec_taskpool_t*
+parsec_stencil_1D_New(parsec_tiled_matrix_t *dcA, int iter, int R)
+{
+  parsec_taskpool_t* stencil_1D_taskpool;
+  parsec_stencil_1D_taskpool_t* taskpool = NULL;
+
+  if( R < 1 ) {
+    fprintf(stderr, "Radius R should be bigger than 0\n");
+    exit(1);
+  }
+
+  if( dcA->nb < 3 * R ) {
+    fprintf(stderr, "Radius R should not be bigger than NB\n");
+    exit(1);
+  }
+
+  if( ((parsec_matrix_block_cyclic_t *)dcA)->grid.rows != 1 ) {
+    fprintf(stderr, "\n Row in Process grid should be 1 "
+                    "to make all buffers local\n\n");
+    exit(1);
+  }
+
+  taskpool = parsec_stencil_1D_new(dcA, iter, R);
+  stencil_1D_taskpool = (parsec_taskpool_t*)taskpool;
+
+  parsec_add2arena( &taskpool->arenas_datatypes[PARSEC_stencil_1D_FULL_ADT_IDX],
+                           MY_TYPE, PARSEC_MATRIX_FULL,
+                           1, dcA->mb, dcA->nb, dcA->mb,
+                           PARSEC_ARENA_ALIGNMENT_SSE, -1 );
+
+  parsec_add2arena( &taskpool->arenas_datatypes[PARSEC_stencil_1D_LR_ADT_IDX],
+                           MY_TYPE, PARSEC_MATRIX_FULL,
+                           1, dcA->mb, R, dcA->mb,
+                           PARSEC_ARENA_ALIGNMENT_SSE, -1 );
+
+  return stencil_1D_taskpool;
+}
+
+/**
+ * @param [inout] the parsec object to destroy
+*/
+void parsec_stencil_1D_Destruct(parsec_taskpool_t *taskpool)
+{
+  parsec_stencil_1D_taskpool_t *stencil_1D_taskpool = (parsec_stencil_1D_taskpool_t *)taskpool;
+  parsec_del2arena(&stencil_1D_taskpool->arenas_datatypes[PARSEC_stencil_1D_FULL_ADT_IDX]);
+  parsec_del2arena(&stencil_1D_taskpool->arenas_datatypes[PARSEC_stencil_1D_LR_ADT_IDX]);
+  parsec_taskpool_free(taskpool);
+}
+
+/**
+ * @brief Stencil 1D
+ *
+ * @param [inout] dcA: the data, already distributed and allocated
+ * @param [in] iter: iterations
+ * @param [in] R: radius
+ */
+int parsec_stencil_1D(parsec_context_t *parsec,
+                      parsec_tiled_matrix_t *A,
+                      int iter, int R)
+{
+  parsec_taskpool_t *parsec_stencil_1D = NULL;
+
+  parsec_stencil_1D = parsec_stencil_1D_New(A, iter, R);
+
+  if( parsec_stencil_1D != NULL ){
+      parsec_enqueue(parsec, parsec_stencil_1D);
+      parsec_context_start(parsec);
+      parsec_context_wait(parsec);
+      parsec_stencil_1D_Destruct(parsec_stencil_1D);
+  }
+
+  return 0;
+}
+
+PARSEC_OBJ_CLASS_INSTANCE(parsec_stencil_1D_taskpool_t, parsec_taskpool_t, NULL, NULL);
+
@@ -0,0 +1,70 @@
+#ifndef _stencil_1D_h_
+#define _stencil_1D_h_
+#include "parsec.h"
+#include "parsec/parsec_internal.h"
+#include "parsec/remote_dep.h"
+
+BEGIN_C_DECLS
+
+#define PARSEC_stencil_1D_DEFAULT_ADT_IDX    0
+#define PARSEC_stencil_1D_LR_ADT_IDX    1
+#define PARSEC_stencil_1D_FULL_ADT_IDX    2
+#define PARSEC_stencil_1D_ADT_IDX_MAX       3
+typedef struct parsec_stencil_1D_taskpool_s {
+  parsec_taskpool_t super;
+  /* The list of globals */
+  parsec_tiled_matrix_t* _g_descA /* data descA */;
+  int _g_iter;
+  int _g_R;
+  /* The array of datatypes (DEFAULT,LR,FULL and co.) */
+  parsec_arena_datatype_t arenas_datatypes[PARSEC_stencil_1D_ADT_IDX_MAX];
+  uint32_t arenas_datatypes_size;
+} parsec_stencil_1D_taskpool_t;
+
+/** Beware that this object is not a superset of the internal object, and as a result
+ *  we should never create one directly. Instead we should rely on the creation of the
+ *  internal object (__parsec_stencil_1D_taskpool_t).
+ */
+PARSEC_OBJ_CLASS_DECLARATION(parsec_stencil_1D_taskpool_t);
+extern parsec_stencil_1D_taskpool_t *parsec_stencil_1D_new(parsec_tiled_matrix_t* _g_descA /* data descA */, int _g_iter, int _g_R);
+
+#if MAX_LOCAL_COUNT < 6  /* number of parameters and locals task */
+  #error Too many parameters and local variables (6 out of MAX_LOCAL_COUNT) for task task
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_stencil_1D_task_assignment_s {
+  parsec_assignment_t t;
+  parsec_assignment_t m;
+  parsec_assignment_t n;
+  parsec_assignment_t myrank;
+  parsec_assignment_t rank_L;
+  parsec_assignment_t rank_R;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-6];
+} __parsec_stencil_1D_task_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 4  /* total number of flows for task task */
+  #error Too many flows (4 out of MAX_PARAM_COUNT) for task task
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_stencil_1D_task_data_s {
+  parsec_data_pair_t _f_A;
+  parsec_data_pair_t _f_AL;
+  parsec_data_pair_t _f_AR;
+  parsec_data_pair_t _f_A0;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-4];
+} __parsec_stencil_1D_task_data_t;
+
+typedef struct __parsec_stencil_1D_task_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_stencil_1D_task_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_stencil_1D_task_data_s data;
+} __parsec_stencil_1D_task_task_t;
+
+
+END_C_DECLS
+
+#endif /* _stencil_1D_h_ */ 
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/atomics.dir/atomics.c.o"
+  "CMakeFiles/atomics.dir/atomics.c.o.d"
+  "atomics"
+  "atomics.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/atomics.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
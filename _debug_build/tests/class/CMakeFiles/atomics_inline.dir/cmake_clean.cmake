@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/atomics_inline.dir/atomics.c.o"
+  "CMakeFiles/atomics_inline.dir/atomics.c.o.d"
+  "atomics_inline"
+  "atomics_inline.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/atomics_inline.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
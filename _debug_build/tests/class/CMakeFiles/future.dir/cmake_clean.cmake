@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/future.dir/future.c.o"
+  "CMakeFiles/future.dir/future.c.o.d"
+  "future"
+  "future.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/future.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/future_datacopy.dir/future_datacopy.c.o"
+  "CMakeFiles/future_datacopy.dir/future_datacopy.c.o.d"
+  "future_datacopy"
+  "future_datacopy.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/future_datacopy.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hash.dir/hash.c.o"
+  "CMakeFiles/hash.dir/hash.c.o.d"
+  "hash"
+  "hash.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hash.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
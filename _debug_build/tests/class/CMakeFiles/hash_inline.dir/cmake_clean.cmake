@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hash_inline.dir/hash.c.o"
+  "CMakeFiles/hash_inline.dir/hash.c.o.d"
+  "hash_inline"
+  "hash_inline.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hash_inline.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
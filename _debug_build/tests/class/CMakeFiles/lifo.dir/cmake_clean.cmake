@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/lifo.dir/lifo.c.o"
+  "CMakeFiles/lifo.dir/lifo.c.o.d"
+  "lifo"
+  "lifo.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/lifo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/lifo_inline.dir/lifo.c.o"
+  "CMakeFiles/lifo_inline.dir/lifo.c.o.d"
+  "lifo_inline"
+  "lifo_inline.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/lifo_inline.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/list.dir/list.c.o"
+  "CMakeFiles/list.dir/list.c.o.d"
+  "list"
+  "list.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/list.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/list_inline.dir/list.c.o"
+  "CMakeFiles/list_inline.dir/list.c.o.d"
+  "list_inline"
+  "list_inline.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/list_inline.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mpmc_ring.dir/mpmc_ring.c.o"
+  "CMakeFiles/mpmc_ring.dir/mpmc_ring.c.o.d"
+  "mpmc_ring"
+  "mpmc_ring.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mpmc_ring.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rwlock.dir/rwlock.c.o"
+  "CMakeFiles/rwlock.dir/rwlock.c.o.d"
+  "rwlock"
+  "rwlock.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/rwlock.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
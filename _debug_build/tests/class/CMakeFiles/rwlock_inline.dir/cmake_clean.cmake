@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rwlock_inline.dir/rwlock.c.o"
+  "CMakeFiles/rwlock_inline.dir/rwlock.c.o.d"
+  "rwlock_inline"
+  "rwlock_inline.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/rwlock_inline.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
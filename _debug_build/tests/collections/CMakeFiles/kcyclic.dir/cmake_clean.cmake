@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kcyclic.dir/kcyclic.c.o"
+  "CMakeFiles/kcyclic.dir/kcyclic.c.o.d"
+  "kcyclic"
+  "kcyclic.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/kcyclic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
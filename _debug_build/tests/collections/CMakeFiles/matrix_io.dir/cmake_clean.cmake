@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/matrix_io.dir/matrix_io.c.o"
+  "CMakeFiles/matrix_io.dir/matrix_io.c.o.d"
+  "matrix_io"
+  "matrix_io.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/matrix_io.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
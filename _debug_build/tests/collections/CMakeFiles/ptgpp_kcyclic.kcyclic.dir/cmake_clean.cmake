@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ptgpp_kcyclic.kcyclic"
+  "kcyclic.c"
+  "kcyclic.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ptgpp_kcyclic.kcyclic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
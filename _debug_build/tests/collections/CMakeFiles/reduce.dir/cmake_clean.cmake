@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/reduce.dir/reduce.c.o"
+  "CMakeFiles/reduce.dir/reduce.c.o.d"
+  "reduce"
+  "reduce.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/reduce.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
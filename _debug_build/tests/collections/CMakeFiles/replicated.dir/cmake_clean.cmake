@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/replicated.dir/replicated.c.o"
+  "CMakeFiles/replicated.dir/replicated.c.o.d"
+  "replicated"
+  "replicated.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/replicated.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
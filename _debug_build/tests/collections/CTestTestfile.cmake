@@ -0,0 +1,9 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/collections
+# Build directory: /root/repo/_debug_build/tests/collections
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("two_dim_band")
+subdirs("redistribute")
+subdirs("reshape")
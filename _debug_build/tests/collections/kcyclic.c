@@ -0,0 +1,4602 @@
+#include "parsec.h"
+#include "parsec/parsec_internal.h"
+#include "parsec/ayudame.h"
+#include "parsec/execution_stream.h"
+#include "parsec/parsec_binary_profile.h"
+#include "parsec/mca/device/device_gpu.h"
+#if defined(PARSEC_HAVE_DEV_CUDA_SUPPORT)
+#include "parsec/mca/device/cuda/device_cuda.h"
+#endif  /* defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) */
+#if defined(PARSEC_HAVE_DEV_HIP_SUPPORT)
+#include "parsec/mca/device/hip/device_hip.h"
+#endif  /* defined(PARSEC_HAVE_DEV_HIP_SUPPORT) */
+#if defined(_MSC_VER) || defined(__MINGW32__)
+#  include <malloc.h>
+#else
+#  include <alloca.h>
+#endif  /* defined(_MSC_VER) || defined(__MINGW32__) */
+
+#define PARSEC_kcyclic_NB_TASK_CLASSES 4
+#define PARSEC_kcyclic_NB_DATA 3
+
+typedef struct __parsec_kcyclic_internal_taskpool_s __parsec_kcyclic_internal_taskpool_t;
+struct parsec_kcyclic_internal_taskpool_s;
+
+/** Predeclarations of the parsec_task_class_t */
+static const parsec_task_class_t kcyclic_COMPARE;
+static const parsec_task_class_t kcyclic_READ_VA;
+static const parsec_task_class_t kcyclic_FILL_CA;
+static const parsec_task_class_t kcyclic_FILL_A;
+/** Predeclarations of the parameters */
+static const parsec_flow_t flow_of_kcyclic_COMPARE_for_A;
+static const parsec_flow_t flow_of_kcyclic_COMPARE_for_CA;
+static const parsec_flow_t flow_of_kcyclic_COMPARE_for_VA;
+static const parsec_flow_t flow_of_kcyclic_READ_VA_for_VA;
+static const parsec_flow_t flow_of_kcyclic_READ_VA_for_C;
+static const parsec_flow_t flow_of_kcyclic_FILL_CA_for_CA;
+static const parsec_flow_t flow_of_kcyclic_FILL_A_for_A;
+static const parsec_flow_t flow_of_kcyclic_FILL_A_for_C;
+/*
+ * Copyright (c) 2019-2022 The University of Tennessee and The University
+ *                         of Tennessee Research Foundation.  All rights
+ *                         reserved.
+ */
+
+#include "parsec.h"
+#include "parsec/data_distribution.h"
+#include "parsec/data_dist/matrix/two_dim_rectangle_cyclic.h"
+#include <sys/time.h>
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#if defined(PARSEC_HAVE_MPI)
+#include <mpi.h>
+#endif
+
+#define TYPE  PARSEC_MATRIX_INTEGER
+parsec_taskpool_t* kcyclic_taskpool(parsec_matrix_block_cyclic_t* A,
+                                    parsec_matrix_block_cyclic_t* VA,
+                                    parsec_matrix_block_cyclic_t* CA);
+
+int main( int argc, char** argv )
+{
+    parsec_context_t* parsec;
+    parsec_taskpool_t* tp;
+    int nodes = 1, rank = 0, p = 1,
+        n = 9, mb = 3, nb = 1, kp = 2, kq = 2;
+    parsec_matrix_block_cyclic_t descA;
+    parsec_matrix_block_cyclic_t viewA;
+    parsec_matrix_block_cyclic_t descCA;
+    int rc;
+
+#if defined(PARSEC_HAVE_MPI)
+    int required = MPI_THREAD_MULTIPLE, provided = 0;
+    MPI_Init_thread(&argc, &argv, required, &provided);
+    MPI_Comm_size(MPI_COMM_WORLD, &nodes);
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#endif
+
+    parsec = parsec_init(1, &argc, &argv);
+    if( NULL == parsec ) {
+        exit(-2);
+    }
+    n *= nodes; /* scale it */
+    p = sqrt(nodes);
+
+    /* Create a copy of A with (standard) 2D-cyclic */
+    parsec_matrix_block_cyclic_init( &descA, TYPE, PARSEC_MATRIX_TILE,
+                               rank,
+                               mb, nb , n, n,
+                               0, 0, n, n,
+                               p, nodes/p, 1, 1, 0, 0);
+    descA.mat = parsec_data_allocate( descA.super.nb_local_tiles *
+                                     descA.super.bsiz *
+                                     parsec_datadist_getsizeoftype(TYPE) );
+
+    /* Create a copy of A with physical 2D-k-cyclic distribution */
+    parsec_matrix_block_cyclic_init( &descCA, TYPE, PARSEC_MATRIX_TILE,
+                               rank,
+                               mb, nb, n, n,
+                               0, 0, n, n,
+                               p, nodes/p, kp, kq, 0, 0);
+    descCA.mat = parsec_data_allocate( descCA.super.nb_local_tiles *
+                                        descCA.super.bsiz *
+                                        parsec_datadist_getsizeoftype(TYPE) );
+
+    /* Create a view of A in (pseudo) k-cyclic order;
+     * This is not a copy of A! It uses the same descA.mat.
+     * This is not in the same order as the physical k-cyclic descCA! */
+    parsec_matrix_block_cyclic_kview( &viewA, &descA, kp, kq);
+
+    /* Now, run the test... */
+    if(rank == 0) {
+        printf("Running the k-cyclicity test; NP=%d, P=%d, KCyclic=%d\n"
+               "  A is a normal 2D cyclic matrix\n"
+               "  CA is a copy of A with a k-cyclic distribution\n"
+               "  VA is a view of A with a reordered (pseudo k-cyclic) access order\n",
+               nodes, p, kp);
+    }
+    tp = kcyclic_taskpool(&descA, &viewA, &descCA);
+
+    rc = parsec_context_add_taskpool( parsec, tp );
+    PARSEC_CHECK_ERROR(rc, "parsec_context_add_taskpool");
+
+    rc = parsec_context_start(parsec);
+    PARSEC_CHECK_ERROR(rc, "parsec_context_start");
+
+    rc = parsec_context_wait(parsec);
+    PARSEC_CHECK_ERROR(rc, "parsec_context_wait");
+
+    parsec_fini( &parsec);
+
+    free(descA.mat);
+    free(descCA.mat);
+
+#if defined(PARSEC_HAVE_MPI)
+    MPI_Finalize();
+#endif
+    return 0;
+}
+
+
+
+#define PARSEC_kcyclic_DEFAULT_ADT    (&__parsec_tp->super.arenas_datatypes[PARSEC_kcyclic_DEFAULT_ADT_IDX])
+#include "kcyclic.h"
+
+struct __parsec_kcyclic_internal_taskpool_s {
+ parsec_kcyclic_taskpool_t super;
+ volatile int32_t sync_point;
+ volatile int32_t initial_number_tasks;
+ parsec_task_t* startup_queue;
+  /* The ranges to compute the hash key */
+  int COMPARE_M_min;
+  int COMPARE_M_range;
+  int COMPARE_N_min;
+  int COMPARE_N_range;
+  int READ_VA_M_min;
+  int READ_VA_M_range;
+  int READ_VA_N_min;
+  int READ_VA_N_range;
+  int FILL_CA_M_min;
+  int FILL_CA_M_range;
+  int FILL_CA_N_min;
+  int FILL_CA_N_range;
+  int FILL_A_M_min;
+  int FILL_A_M_range;
+  int FILL_A_N_min;
+  int FILL_A_N_range;
+  /* The list of data repositories  READ_VA  FILL_CA  FILL_A */
+  data_repo_t* repositories[4];
+};
+
+#if defined(PARSEC_PROF_TRACE)
+#  if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+static int kcyclic_profiling_array[4*PARSEC_kcyclic_NB_TASK_CLASSES] = {-2}; /* 2 pairs (begin, end) per task, times two because each task class has an internal_init task */
+#  else /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+static int kcyclic_profiling_array[2*PARSEC_kcyclic_NB_TASK_CLASSES] = {-2}; /* 2 pairs (begin, end) per task */
+#  endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+#endif  /* defined(PARSEC_PROF_TRACE) */
+/* Globals */
+#define dA __parsec_tp->super._g_dA
+#define dVA __parsec_tp->super._g_dVA
+#define dCA __parsec_tp->super._g_dCA
+#define MT (__parsec_tp->super._g_MT)
+#define NT (__parsec_tp->super._g_NT)
+
+static inline int parsec_imin(int a, int b) { return (a <= b) ? a : b; };
+
+static inline int parsec_imax(int a, int b) { return (a >= b) ? a : b; };
+
+/* Data Access Macros */
+#define data_of_dVA(dVA_d0, dVA_d1)  (((parsec_data_collection_t*)__parsec_tp->super._g_dVA)->data_of((parsec_data_collection_t*)__parsec_tp->super._g_dVA, (dVA_d0), (dVA_d1)))
+#define data_of_dCA(dCA_d0, dCA_d1)  (((parsec_data_collection_t*)__parsec_tp->super._g_dCA)->data_of((parsec_data_collection_t*)__parsec_tp->super._g_dCA, (dCA_d0), (dCA_d1)))
+#define data_of_dA(dA_d0, dA_d1)  (((parsec_data_collection_t*)__parsec_tp->super._g_dA)->data_of((parsec_data_collection_t*)__parsec_tp->super._g_dA, (dA_d0), (dA_d1)))
+
+#define rank_of_dVA(dVA_d0, dVA_d1)  (((parsec_data_collection_t*)__parsec_tp->super._g_dVA)->rank_of((parsec_data_collection_t*)__parsec_tp->super._g_dVA, (dVA_d0), (dVA_d1)))
+#define rank_of_dCA(dCA_d0, dCA_d1)  (((parsec_data_collection_t*)__parsec_tp->super._g_dCA)->rank_of((parsec_data_collection_t*)__parsec_tp->super._g_dCA, (dCA_d0), (dCA_d1)))
+#define rank_of_dA(dA_d0, dA_d1)  (((parsec_data_collection_t*)__parsec_tp->super._g_dA)->rank_of((parsec_data_collection_t*)__parsec_tp->super._g_dA, (dA_d0), (dA_d1)))
+
+/* Functions Predicates */
+#define COMPARE_pred(M, N) (((parsec_data_collection_t*)(__parsec_tp->super._g_dA))->myrank == rank_of_dA(M, N))
+#define READ_VA_pred(M, N) (((parsec_data_collection_t*)(__parsec_tp->super._g_dVA))->myrank == rank_of_dVA(M, N))
+#define FILL_CA_pred(M, N) (((parsec_data_collection_t*)(__parsec_tp->super._g_dCA))->myrank == rank_of_dCA(M, N))
+#define FILL_A_pred(M, N) (((parsec_data_collection_t*)(__parsec_tp->super._g_dA))->myrank == rank_of_dA(M, N))
+
+/* Data Repositories */
+#define COMPARE_repo (__parsec_tp->repositories[3])
+#define READ_VA_repo (__parsec_tp->repositories[2])
+#define FILL_CA_repo (__parsec_tp->repositories[1])
+#define FILL_A_repo (__parsec_tp->repositories[0])
+/* Release dependencies output macro */
+#if defined(PARSEC_DEBUG_NOISIER)
+#define RELEASE_DEP_OUTPUT(ES, DEPO, TASKO, DEPI, TASKI, RSRC, RDST, DATA)\
+  do { \
+    char tmp1[128], tmp2[128]; (void)tmp1; (void)tmp2;\
+    PARSEC_DEBUG_VERBOSE(20, parsec_debug_output, "thread %d VP %d explore deps from %s:%s to %s:%s (from rank %d to %d) base ptr %p",\
+           (NULL != (ES) ? (ES)->th_id : -1), (NULL != (ES) ? (ES)->virtual_process->vp_id : -1),\
+           DEPO, parsec_task_snprintf(tmp1, 128, (parsec_task_t*)(TASKO)),\
+           DEPI, parsec_task_snprintf(tmp2, 128, (parsec_task_t*)(TASKI)), (RSRC), (RDST), (DATA));\
+  } while(0)
+#define ACQUIRE_FLOW(TASKI, DEPI, FUNO, DEPO, LOCALS, PTR)\
+  do { \
+    char tmp1[128], tmp2[128]; (void)tmp1; (void)tmp2;\
+    PARSEC_DEBUG_VERBOSE(20, parsec_debug_output, "task %s acquires flow %s from %s %s data ptr %p",\
+           parsec_task_snprintf(tmp1, 128, (parsec_task_t*)(TASKI)), (DEPI),\
+           (DEPO), parsec_snprintf_assignments(tmp2, 128, (FUNO), (parsec_assignment_t*)(LOCALS)), (PTR));\
+  } while(0)
+#else
+#define RELEASE_DEP_OUTPUT(ES, DEPO, TASKO, DEPI, TASKI, RSRC, RDST, DATA)
+#define ACQUIRE_FLOW(TASKI, DEPI, TASKO, DEPO, LOCALS, PTR)
+#endif
+static inline parsec_key_t __jdf2c_make_key_COMPARE(const parsec_taskpool_t *tp, const parsec_assignment_t *as)
+{
+  const __parsec_kcyclic_internal_taskpool_t *__parsec_tp = (const __parsec_kcyclic_internal_taskpool_t *)tp;
+  const __parsec_kcyclic_COMPARE_parsec_assignment_t *assignment = (const __parsec_kcyclic_COMPARE_parsec_assignment_t*)as;
+  uint64_t __parsec_id = 0;
+  __parsec_id += (assignment->M.value - __parsec_tp->COMPARE_M_min);
+  __parsec_id += (assignment->N.value - __parsec_tp->COMPARE_N_min) * __parsec_tp->COMPARE_M_range;
+  return (parsec_key_t)__parsec_id;
+}
+static char *__jdf2c_key_fns_COMPARE_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_kcyclic_internal_taskpool_t *__parsec_tp = (__parsec_kcyclic_internal_taskpool_t *)user_data;
+  int M = (__parsec_key) % __parsec_tp->COMPARE_M_range + __parsec_tp->COMPARE_M_min;
+  __parsec_key = __parsec_key / __parsec_tp->COMPARE_M_range;
+  int N = (__parsec_key) % __parsec_tp->COMPARE_N_range + __parsec_tp->COMPARE_N_min;
+  __parsec_key = __parsec_key / __parsec_tp->COMPARE_N_range;
+  snprintf(buffer, buffer_size, "COMPARE(%d, %d)", M, N);
+  return buffer;
+}
+
+static parsec_key_fn_t __jdf2c_key_fns_COMPARE = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = __jdf2c_key_fns_COMPARE_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+static inline parsec_key_t __jdf2c_make_key_READ_VA(const parsec_taskpool_t *tp, const parsec_assignment_t *as)
+{
+  const __parsec_kcyclic_internal_taskpool_t *__parsec_tp = (const __parsec_kcyclic_internal_taskpool_t *)tp;
+  const __parsec_kcyclic_READ_VA_parsec_assignment_t *assignment = (const __parsec_kcyclic_READ_VA_parsec_assignment_t*)as;
+  uint64_t __parsec_id = 0;
+  __parsec_id += (assignment->M.value - __parsec_tp->READ_VA_M_min);
+  __parsec_id += (assignment->N.value - __parsec_tp->READ_VA_N_min) * __parsec_tp->READ_VA_M_range;
+  return (parsec_key_t)__parsec_id;
+}
+static char *__jdf2c_key_fns_READ_VA_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_kcyclic_internal_taskpool_t *__parsec_tp = (__parsec_kcyclic_internal_taskpool_t *)user_data;
+  int M = (__parsec_key) % __parsec_tp->READ_VA_M_range + __parsec_tp->READ_VA_M_min;
+  __parsec_key = __parsec_key / __parsec_tp->READ_VA_M_range;
+  int N = (__parsec_key) % __parsec_tp->READ_VA_N_range + __parsec_tp->READ_VA_N_min;
+  __parsec_key = __parsec_key / __parsec_tp->READ_VA_N_range;
+  snprintf(buffer, buffer_size, "READ_VA(%d, %d)", M, N);
+  return buffer;
+}
+
+static parsec_key_fn_t __jdf2c_key_fns_READ_VA = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = __jdf2c_key_fns_READ_VA_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+static inline parsec_key_t __jdf2c_make_key_FILL_CA(const parsec_taskpool_t *tp, const parsec_assignment_t *as)
+{
+  const __parsec_kcyclic_internal_taskpool_t *__parsec_tp = (const __parsec_kcyclic_internal_taskpool_t *)tp;
+  const __parsec_kcyclic_FILL_CA_parsec_assignment_t *assignment = (const __parsec_kcyclic_FILL_CA_parsec_assignment_t*)as;
+  uint64_t __parsec_id = 0;
+  __parsec_id += (assignment->M.value - __parsec_tp->FILL_CA_M_min);
+  __parsec_id += (assignment->N.value - __parsec_tp->FILL_CA_N_min) * __parsec_tp->FILL_CA_M_range;
+  return (parsec_key_t)__parsec_id;
+}
+static char *__jdf2c_key_fns_FILL_CA_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_kcyclic_internal_taskpool_t *__parsec_tp = (__parsec_kcyclic_internal_taskpool_t *)user_data;
+  int M = (__parsec_key) % __parsec_tp->FILL_CA_M_range + __parsec_tp->FILL_CA_M_min;
+  __parsec_key = __parsec_key / __parsec_tp->FILL_CA_M_range;
+  int N = (__parsec_key) % __parsec_tp->FILL_CA_N_range + __parsec_tp->FILL_CA_N_min;
+  __parsec_key = __parsec_key / __parsec_tp->FILL_CA_N_range;
+  snprintf(buffer, buffer_size, "FILL_CA(%d, %d)", M, N);
+  return buffer;
+}
+
+static parsec_key_fn_t __jdf2c_key_fns_FILL_CA = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = __jdf2c_key_fns_FILL_CA_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+static inline parsec_key_t __jdf2c_make_key_FILL_A(const parsec_taskpool_t *tp, const parsec_assignment_t *as)
+{
+  const __parsec_kcyclic_internal_taskpool_t *__parsec_tp = (const __parsec_kcyclic_internal_taskpool_t *)tp;
+  const __parsec_kcyclic_FILL_A_parsec_assignment_t *assignment = (const __parsec_kcyclic_FILL_A_parsec_assignment_t*)as;
+  uint64_t __parsec_id = 0;
+  __parsec_id += (assignment->M.value - __parsec_tp->FILL_A_M_min);
+  __parsec_id += (assignment->N.value - __parsec_tp->FILL_A_N_min) * __parsec_tp->FILL_A_M_range;
+  return (parsec_key_t)__parsec_id;
+}
+static char *__jdf2c_key_fns_FILL_A_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_kcyclic_internal_taskpool_t *__parsec_tp = (__parsec_kcyclic_internal_taskpool_t *)user_data;
+  int M = (__parsec_key) % __parsec_tp->FILL_A_M_range + __parsec_tp->FILL_A_M_min;
+  __parsec_key = __parsec_key / __parsec_tp->FILL_A_M_range;
+  int N = (__parsec_key) % __parsec_tp->FILL_A_N_range + __parsec_tp->FILL_A_N_min;
+  __parsec_key = __parsec_key / __parsec_tp->FILL_A_N_range;
+  snprintf(buffer, buffer_size, "FILL_A(%d, %d)", M, N);
+  return buffer;
+}
+
+static parsec_key_fn_t __jdf2c_key_fns_FILL_A = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = __jdf2c_key_fns_FILL_A_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/******                                    COMPARE                                    ******/
+
+static inline int32_t minexpr_of_symb_kcyclic_COMPARE_M_fct(const __parsec_kcyclic_internal_taskpool_t *__parsec_tp, const __parsec_kcyclic_COMPARE_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_kcyclic_COMPARE_M = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_kcyclic_COMPARE_M_fct }
+                   }
+};
+static inline int maxexpr_of_symb_kcyclic_COMPARE_M_fct(const __parsec_kcyclic_internal_taskpool_t *__parsec_tp, const __parsec_kcyclic_COMPARE_parsec_assignment_t *locals)
+{
+  const int M = locals->M.value; (void)M;
+  const int N = locals->N.value; (void)N;
+
+  (void)M;
+  (void)N;
+  (void)__parsec_tp; (void)locals;
+  return MT;
+}
+static const parsec_expr_t maxexpr_of_symb_kcyclic_COMPARE_M = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_kcyclic_COMPARE_M_fct }
+                   }
+};
+static const parsec_symbol_t symb_kcyclic_COMPARE_M = { .name = "M", .context_index = 0, .min = &minexpr_of_symb_kcyclic_COMPARE_M, .max = &maxexpr_of_symb_kcyclic_COMPARE_M, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int32_t minexpr_of_symb_kcyclic_COMPARE_N_fct(const __parsec_kcyclic_internal_taskpool_t *__parsec_tp, const __parsec_kcyclic_COMPARE_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_kcyclic_COMPARE_N = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_kcyclic_COMPARE_N_fct }
+                   }
+};
+static inline int maxexpr_of_symb_kcyclic_COMPARE_N_fct(const __parsec_kcyclic_internal_taskpool_t *__parsec_tp, const __parsec_kcyclic_COMPARE_parsec_assignment_t *locals)
+{
+  const int M = locals->M.value; (void)M;
+  const int N = locals->N.value; (void)N;
+
+  (void)M;
+  (void)N;
+  (void)__parsec_tp; (void)locals;
+  return NT;
+}
+static const parsec_expr_t maxexpr_of_symb_kcyclic_COMPARE_N = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_kcyclic_COMPARE_N_fct }
+                   }
+};
+static const parsec_symbol_t symb_kcyclic_COMPARE_N = { .name = "N", .context_index = 1, .min = &minexpr_of_symb_kcyclic_COMPARE_N, .max = &maxexpr_of_symb_kcyclic_COMPARE_N, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int affinity_of_kcyclic_COMPARE(const __parsec_kcyclic_COMPARE_task_t *this_task,
+                     parsec_data_ref_t *ref)
+{
+    const __parsec_kcyclic_internal_taskpool_t *__parsec_tp = (const __parsec_kcyclic_internal_taskpool_t*)this_task->taskpool;
+  const int M = this_task->locals.M.value; (void)M;
+  const int N = this_task->locals.N.value; (void)N;
+
+  /* Silent Warnings: should look into predicate to know what variables are usefull */
+  (void)M;
+  (void)N;
+  ref->dc = (parsec_data_collection_t *)__parsec_tp->super._g_dA;
+  /* Compute data key */
+  ref->key = ref->dc->data_key(ref->dc, M, N);
+  return 1;
+}
+static const parsec_property_t properties_of_kcyclic_COMPARE[1] = {
+  {.name = NULL, .expr = NULL}
+};
+static const parsec_dep_t flow_of_kcyclic_COMPARE_for_A_dep1_atline_184 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 0, /* kcyclic_FILL_A */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_kcyclic_FILL_A_for_A,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_kcyclic_COMPARE_for_A,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_kcyclic_COMPARE_for_A = {
+  .name               = "A",
+  .sym_type           = PARSEC_SYM_IN,
+  .flow_flags         = PARSEC_FLOW_ACCESS_READ,
+  .flow_index         = 0,
+  .flow_datatype_mask = 0x0,
+  .dep_in     = { &flow_of_kcyclic_COMPARE_for_A_dep1_atline_184 },
+  .dep_out    = { NULL }
+};
+
+static const parsec_dep_t flow_of_kcyclic_COMPARE_for_CA_dep1_atline_185 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 1, /* kcyclic_FILL_CA */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_kcyclic_FILL_CA_for_CA,
+  .dep_index = 1,
+  .dep_datatype_index = 1,
+  .belongs_to = &flow_of_kcyclic_COMPARE_for_CA,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_kcyclic_COMPARE_for_CA = {
+  .name               = "CA",
+  .sym_type           = PARSEC_SYM_IN,
+  .flow_flags         = PARSEC_FLOW_ACCESS_READ,
+  .flow_index         = 1,
+  .flow_datatype_mask = 0x0,
+  .dep_in     = { &flow_of_kcyclic_COMPARE_for_CA_dep1_atline_185 },
+  .dep_out    = { NULL }
+};
+
+static const parsec_dep_t flow_of_kcyclic_COMPARE_for_VA_dep1_atline_186 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 2, /* kcyclic_READ_VA */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_kcyclic_READ_VA_for_VA,
+  .dep_index = 2,
+  .dep_datatype_index = 2,
+  .belongs_to = &flow_of_kcyclic_COMPARE_for_VA,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_kcyclic_COMPARE_for_VA = {
+  .name               = "VA",
+  .sym_type           = PARSEC_SYM_IN,
+  .flow_flags         = PARSEC_FLOW_ACCESS_READ,
+  .flow_index         = 2,
+  .flow_datatype_mask = 0x0,
+  .dep_in     = { &flow_of_kcyclic_COMPARE_for_VA_dep1_atline_186 },
+  .dep_out    = { NULL }
+};
+
+static void
+iterate_predecessors_of_kcyclic_COMPARE(parsec_execution_stream_t *es, const __parsec_kcyclic_COMPARE_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_kcyclic_internal_taskpool_t *__parsec_tp = (const __parsec_kcyclic_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_kcyclic_COMPARE_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_kcyclic_COMPARE_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int M = __jdf2c__tmp_locals.M.value; (void)M;
+  const int N = __jdf2c__tmp_locals.N.value; (void)N;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)M;  (void)N;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_dA(M, N);
+#endif
+  if( action_mask & 0x1 ) {  /* Flow of data A [0] */
+    data.data   = this_task->data._f_A.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x1 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_kcyclic_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_kcyclic_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        __parsec_kcyclic_FILL_A_task_t* ncc = (__parsec_kcyclic_FILL_A_task_t*)&nc;
+    nc.task_class = __parsec_tp->super.super.task_classes_array[kcyclic_FILL_A.task_class_id];
+      const int FILL_A_M = M;
+      if( (FILL_A_M >= (0)) && (FILL_A_M <= (MT)) ) {
+        assert(&nc.locals[0].value == &ncc->locals.M.value);
+        ncc->locals.M.value = FILL_A_M;
+        const int FILL_A_N = N;
+        if( (FILL_A_N >= (0)) && (FILL_A_N <= (NT)) ) {
+          assert(&nc.locals[1].value == &ncc->locals.N.value);
+          ncc->locals.N.value = FILL_A_N;
+#if defined(DISTRIBUTED)
+          rank_dst = rank_of_dA(ncc->locals.M.value, ncc->locals.N.value);
+          if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+            vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_dA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_dA, ncc->locals.M.value, ncc->locals.N.value);
+          nc.priority = __parsec_tp->super.super.priority;
+          successor_repo = FILL_A_repo;
+          successor_repo_key = __jdf2c_make_key_FILL_A((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+        RELEASE_DEP_OUTPUT(es, "A", this_task, "A", &nc, rank_src, rank_dst, &data);
+        if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_kcyclic_COMPARE_for_A_dep1_atline_184, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+          }
+        }
+  }
+  }
+  if( action_mask & 0x2 ) {  /* Flow of data CA [1] */
+    data.data   = this_task->data._f_CA.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x2 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_kcyclic_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_kcyclic_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        __parsec_kcyclic_FILL_CA_task_t* ncc = (__parsec_kcyclic_FILL_CA_task_t*)&nc;
+    nc.task_class = __parsec_tp->super.super.task_classes_array[kcyclic_FILL_CA.task_class_id];
+      const int FILL_CA_M = M;
+      if( (FILL_CA_M >= (0)) && (FILL_CA_M <= (MT)) ) {
+        assert(&nc.locals[0].value == &ncc->locals.M.value);
+        ncc->locals.M.value = FILL_CA_M;
+        const int FILL_CA_N = N;
+        if( (FILL_CA_N >= (0)) && (FILL_CA_N <= (NT)) ) {
+          assert(&nc.locals[1].value == &ncc->locals.N.value);
+          ncc->locals.N.value = FILL_CA_N;
+#if defined(DISTRIBUTED)
+          rank_dst = rank_of_dCA(ncc->locals.M.value, ncc->locals.N.value);
+          if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+            vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_dCA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_dCA, ncc->locals.M.value, ncc->locals.N.value);
+          nc.priority = __parsec_tp->super.super.priority;
+          successor_repo = NULL;
+          successor_repo_key = 0;
+        RELEASE_DEP_OUTPUT(es, "CA", this_task, "CA", &nc, rank_src, rank_dst, &data);
+        if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_kcyclic_COMPARE_for_CA_dep1_atline_185, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+          }
+        }
+  }
+  }
+  if( action_mask & 0x4 ) {  /* Flow of data VA [2] */
+    data.data   = this_task->data._f_VA.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x4 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_kcyclic_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_kcyclic_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        __parsec_kcyclic_READ_VA_task_t* ncc = (__parsec_kcyclic_READ_VA_task_t*)&nc;
+    nc.task_class = __parsec_tp->super.super.task_classes_array[kcyclic_READ_VA.task_class_id];
+      const int READ_VA_M = M;
+      if( (READ_VA_M >= (0)) && (READ_VA_M <= (MT)) ) {
+        assert(&nc.locals[0].value == &ncc->locals.M.value);
+        ncc->locals.M.value = READ_VA_M;
+        const int READ_VA_N = N;
+        if( (READ_VA_N >= (0)) && (READ_VA_N <= (NT)) ) {
+          assert(&nc.locals[1].value == &ncc->locals.N.value);
+          ncc->locals.N.value = READ_VA_N;
+#if defined(DISTRIBUTED)
+          rank_dst = rank_of_dVA(ncc->locals.M.value, ncc->locals.N.value);
+          if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+            vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_dVA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_dVA, ncc->locals.M.value, ncc->locals.N.value);
+          nc.priority = __parsec_tp->super.super.priority;
+          successor_repo = READ_VA_repo;
+          successor_repo_key = __jdf2c_make_key_READ_VA((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+        RELEASE_DEP_OUTPUT(es, "VA", this_task, "VA", &nc, rank_src, rank_dst, &data);
+        if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_kcyclic_COMPARE_for_VA_dep1_atline_186, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+          }
+        }
+  }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static int release_deps_of_kcyclic_COMPARE(parsec_execution_stream_t *es, __parsec_kcyclic_COMPARE_task_t *this_task, uint32_t action_mask, parsec_remote_deps_t *deps)
+{
+  PARSEC_PINS(es, RELEASE_DEPS_BEGIN, (parsec_task_t *)this_task);  const __parsec_kcyclic_internal_taskpool_t *__parsec_tp = (const __parsec_kcyclic_internal_taskpool_t *)this_task->taskpool;
+  parsec_release_dep_fct_arg_t arg;
+  int __vp_id;
+  int consume_local_repo = 0;
+  arg.action_mask = action_mask;
+  arg.output_entry = NULL;
+  arg.output_repo = NULL;
+#if defined(DISTRIBUTED)
+  arg.remote_deps = deps;
+#endif  /* defined(DISTRIBUTED) */
+  assert(NULL != es);
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS )    arg.ready_lists = alloca(sizeof(parsec_task_t *) * es->virtual_process->parsec_context->nb_vp);
+  else
+    arg.ready_lists = NULL;
+  for( __vp_id = 0; __vp_id < es->virtual_process->parsec_context->nb_vp; arg.ready_lists[__vp_id++] = NULL );
+  (void)__parsec_tp; (void)deps;
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_A.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_A.source_repo, this_task->data._f_A.source_repo_entry->ht_item.key );
+    }
+    if( NULL != this_task->data._f_CA.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_CA.source_repo, this_task->data._f_CA.source_repo_entry->ht_item.key );
+    }
+    if( NULL != this_task->data._f_VA.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_VA.source_repo, this_task->data._f_VA.source_repo_entry->ht_item.key );
+    }
+  }
+  consume_local_repo = (this_task->repo_entry != NULL);
+  /* No successors, don't call iterate_successors and don't release any local deps */
+      if (consume_local_repo) {
+         data_repo_entry_used_once( COMPARE_repo, this_task->repo_entry->ht_item.key );
+      }
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_A.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_A.data_in);
+    }
+    if( NULL != this_task->data._f_CA.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_CA.data_in);
+    }
+    if( NULL != this_task->data._f_VA.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_VA.data_in);
+    }
+  }
+  PARSEC_PINS(es, RELEASE_DEPS_END, (parsec_task_t *)this_task);  return 0;
+}
+
+static int data_lookup_of_kcyclic_COMPARE(parsec_execution_stream_t *es, __parsec_kcyclic_COMPARE_task_t *this_task)
+{
+  const __parsec_kcyclic_internal_taskpool_t *__parsec_tp = (__parsec_kcyclic_internal_taskpool_t *)this_task->taskpool;
+  parsec_assignment_t generic_locals[MAX_PARAM_COUNT];  /* generic task locals */
+  int target_device = 0; (void)target_device;
+  (void)__parsec_tp; (void)generic_locals; (void)es;
+  parsec_data_copy_t *chunk = NULL;
+  data_repo_t        *reshape_repo  = NULL, *consumed_repo  = NULL;
+  data_repo_entry_t  *reshape_entry = NULL, *consumed_entry = NULL;
+  parsec_key_t        reshape_entry_key = 0, consumed_entry_key = 0;
+  uint8_t             consumed_flow_index;
+  parsec_dep_data_description_t data;
+  int ret;
+  (void)reshape_repo; (void)reshape_entry; (void)reshape_entry_key;
+  (void)consumed_repo; (void)consumed_entry; (void)consumed_entry_key;
+  (void)consumed_flow_index;
+  (void)chunk; (void)data; (void)ret;
+  const int M = this_task->locals.M.value; (void)M;
+  const int N = this_task->locals.N.value; (void)N;
+  if( NULL == this_task->repo_entry ){
+    this_task->repo_entry = data_repo_lookup_entry_and_create(es, COMPARE_repo,                                       __jdf2c_make_key_COMPARE((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    data_repo_entry_addto_usage_limit(COMPARE_repo, this_task->repo_entry->ht_item.key, 1);    this_task->repo_entry ->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(this_task->repo_entry ->sim_exec_date == 0);
+    this_task->repo_entry ->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  /* The reshape repo is the current task repo. */  reshape_repo = COMPARE_repo;
+  reshape_entry_key = __jdf2c_make_key_COMPARE((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals) ;
+  reshape_entry = this_task->repo_entry;
+  /* Lookup the input data, and store them in the context if any */
+
+if(! this_task->data._f_A.fulfill ){ /* Flow A */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_A.data_out = NULL;  /* input only */
+  /* Flow A [0] dependency [0] from predecessor FILL_A */
+  if( NULL == (chunk = this_task->data._f_A.data_in) ) {
+  /* No data set up by predecessor on this task input flow */
+__parsec_kcyclic_FILL_A_parsec_assignment_t *target_locals = (__parsec_kcyclic_FILL_A_parsec_assignment_t*)&generic_locals;
+  const int FILL_AM = target_locals->M.value = M; (void)FILL_AM;
+  const int FILL_AN = target_locals->N.value = N; (void)FILL_AN;
+    if( (reshape_entry != NULL) && (reshape_entry->data[0] != NULL) ){
+        /* Reshape promise set up on this task repo by predecessor */
+        consumed_repo = reshape_repo;
+        consumed_entry = reshape_entry;
+        consumed_entry_key = reshape_entry_key;
+        consumed_flow_index = 0;
+    }else{
+        /* Consume from predecessor's repo */
+        consumed_repo = FILL_A_repo;
+        consumed_entry_key = __jdf2c_make_key_FILL_A((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)target_locals) ;
+        consumed_entry = data_repo_lookup_entry( consumed_repo, consumed_entry_key );
+        consumed_flow_index = 0;
+    }
+    data.data   = NULL;
+    data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+        data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    ACQUIRE_FLOW(this_task, "A", &kcyclic_FILL_A, "A", target_locals, chunk);
+    this_task->data._f_A.data_out = chunk;
+  } 
+  else {
+    /* Data set up by predecessor on this task input flow */
+    consumed_repo = this_task->data._f_A.source_repo;
+    consumed_entry = this_task->data._f_A.source_repo_entry;
+    consumed_entry_key = this_task->data._f_A.source_repo_entry->ht_item.key;
+    if( (reshape_entry != NULL) && (reshape_entry->data[0] != NULL) ){
+        /* Reshape promise set up on input by predecessor is on this task repo */
+        consumed_flow_index = 0;
+        assert( (this_task->data._f_A.source_repo == reshape_repo)
+             && (this_task->data._f_A.source_repo_entry == reshape_entry));
+    }else{
+        /* Reshape promise set up on input by predecessor is the predecesssor task repo */
+        consumed_flow_index = 0;
+    }
+    data.data   = NULL;
+    data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+        data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    this_task->data._f_A.data_out = parsec_data_get_copy(chunk->original, target_device);
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+    parsec_prof_grapher_data_input(chunk->original, (parsec_task_t*)this_task, &flow_of_kcyclic_COMPARE_for_A, 0);
+#endif
+  }
+    this_task->data._f_A.data_in     = chunk;
+    this_task->data._f_A.source_repo       = consumed_repo;
+    this_task->data._f_A.source_repo_entry = consumed_entry;
+    this_task->data._f_A.fulfill = 1;
+}
+
+
+if(! this_task->data._f_CA.fulfill ){ /* Flow CA */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_CA.data_out = NULL;  /* input only */
+  /* Flow CA [1] dependency [1] from predecessor FILL_CA */
+  if( NULL == (chunk = this_task->data._f_CA.data_in) ) {
+  /* No data set up by predecessor on this task input flow */
+__parsec_kcyclic_FILL_CA_parsec_assignment_t *target_locals = (__parsec_kcyclic_FILL_CA_parsec_assignment_t*)&generic_locals;
+  const int FILL_CAM = target_locals->M.value = M; (void)FILL_CAM;
+  const int FILL_CAN = target_locals->N.value = N; (void)FILL_CAN;
+    if( (reshape_entry != NULL) && (reshape_entry->data[1] != NULL) ){
+        /* Reshape promise set up on this task repo by predecessor */
+        consumed_repo = reshape_repo;
+        consumed_entry = reshape_entry;
+        consumed_entry_key = reshape_entry_key;
+        consumed_flow_index = 1;
+    }else{
+        /* Consume from predecessor's repo */
+        consumed_repo = FILL_CA_repo;
+        consumed_entry_key = __jdf2c_make_key_FILL_CA((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)target_locals) ;
+        consumed_entry = data_repo_lookup_entry( consumed_repo, consumed_entry_key );
+        consumed_flow_index = 0;
+    }
+    data.data   = NULL;
+    data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+        data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 1, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    ACQUIRE_FLOW(this_task, "CA", &kcyclic_FILL_CA, "CA", target_locals, chunk);
+    this_task->data._f_CA.data_out = chunk;
+  } 
+  else {
+    /* Data set up by predecessor on this task input flow */
+    consumed_repo = this_task->data._f_CA.source_repo;
+    consumed_entry = this_task->data._f_CA.source_repo_entry;
+    consumed_entry_key = this_task->data._f_CA.source_repo_entry->ht_item.key;
+    if( (reshape_entry != NULL) && (reshape_entry->data[1] != NULL) ){
+        /* Reshape promise set up on input by predecessor is on this task repo */
+        consumed_flow_index = 1;
+        assert( (this_task->data._f_CA.source_repo == reshape_repo)
+             && (this_task->data._f_CA.source_repo_entry == reshape_entry));
+    }else{
+        /* Reshape promise set up on input by predecessor is the predecesssor task repo */
+        consumed_flow_index = 0;
+    }
+    data.data   = NULL;
+    data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+        data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 1, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    this_task->data._f_CA.data_out = parsec_data_get_copy(chunk->original, target_device);
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+    parsec_prof_grapher_data_input(chunk->original, (parsec_task_t*)this_task, &flow_of_kcyclic_COMPARE_for_CA, 0);
+#endif
+  }
+    this_task->data._f_CA.data_in     = chunk;
+    this_task->data._f_CA.source_repo       = consumed_repo;
+    this_task->data._f_CA.source_repo_entry = consumed_entry;
+    this_task->data._f_CA.fulfill = 1;
+}
+
+
+if(! this_task->data._f_VA.fulfill ){ /* Flow VA */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_VA.data_out = NULL;  /* input only */
+  /* Flow VA [2] dependency [2] from predecessor READ_VA */
+  if( NULL == (chunk = this_task->data._f_VA.data_in) ) {
+  /* No data set up by predecessor on this task input flow */
+__parsec_kcyclic_READ_VA_parsec_assignment_t *target_locals = (__parsec_kcyclic_READ_VA_parsec_assignment_t*)&generic_locals;
+  const int READ_VAM = target_locals->M.value = M; (void)READ_VAM;
+  const int READ_VAN = target_locals->N.value = N; (void)READ_VAN;
+    if( (reshape_entry != NULL) && (reshape_entry->data[2] != NULL) ){
+        /* Reshape promise set up on this task repo by predecessor */
+        consumed_repo = reshape_repo;
+        consumed_entry = reshape_entry;
+        consumed_entry_key = reshape_entry_key;
+        consumed_flow_index = 2;
+    }else{
+        /* Consume from predecessor's repo */
+        consumed_repo = READ_VA_repo;
+        consumed_entry_key = __jdf2c_make_key_READ_VA((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)target_locals) ;
+        consumed_entry = data_repo_lookup_entry( consumed_repo, consumed_entry_key );
+        consumed_flow_index = 0;
+    }
+    data.data   = NULL;
+    data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+        data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 2, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    ACQUIRE_FLOW(this_task, "VA", &kcyclic_READ_VA, "VA", target_locals, chunk);
+    this_task->data._f_VA.data_out = chunk;
+  } 
+  else {
+    /* Data set up by predecessor on this task input flow */
+    consumed_repo = this_task->data._f_VA.source_repo;
+    consumed_entry = this_task->data._f_VA.source_repo_entry;
+    consumed_entry_key = this_task->data._f_VA.source_repo_entry->ht_item.key;
+    if( (reshape_entry != NULL) && (reshape_entry->data[2] != NULL) ){
+        /* Reshape promise set up on input by predecessor is on this task repo */
+        consumed_flow_index = 2;
+        assert( (this_task->data._f_VA.source_repo == reshape_repo)
+             && (this_task->data._f_VA.source_repo_entry == reshape_entry));
+    }else{
+        /* Reshape promise set up on input by predecessor is the predecesssor task repo */
+        consumed_flow_index = 0;
+    }
+    data.data   = NULL;
+    data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+        data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 2, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    this_task->data._f_VA.data_out = parsec_data_get_copy(chunk->original, target_device);
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+    parsec_prof_grapher_data_input(chunk->original, (parsec_task_t*)this_task, &flow_of_kcyclic_COMPARE_for_VA, 0);
+#endif
+  }
+    this_task->data._f_VA.data_in     = chunk;
+    this_task->data._f_VA.source_repo       = consumed_repo;
+    this_task->data._f_VA.source_repo_entry = consumed_entry;
+    this_task->data._f_VA.fulfill = 1;
+}
+
+  /** Generate profiling information */
+#if defined(PARSEC_PROF_TRACE)
+  this_task->prof_info.desc = (parsec_data_collection_t*)__parsec_tp->super._g_dA;
+  this_task->prof_info.priority = this_task->priority;
+  this_task->prof_info.data_id   = ((parsec_data_collection_t*)__parsec_tp->super._g_dA)->data_key((parsec_data_collection_t*)__parsec_tp->super._g_dA, M, N);
+  this_task->prof_info.task_class_id = this_task->task_class->task_class_id;
+  this_task->prof_info.task_return_code = -1;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int datatype_lookup_of_kcyclic_COMPARE(parsec_execution_stream_t *es, const parsec_task_t *this_generic_task, const parsec_task_t *parent_task,
+              uint32_t* flow_mask, parsec_dep_data_description_t* data)
+{
+  const __parsec_kcyclic_COMPARE_task_t *this_task = (__parsec_kcyclic_COMPARE_task_t*)this_generic_task;
+  const __parsec_kcyclic_internal_taskpool_t *__parsec_tp = (__parsec_kcyclic_internal_taskpool_t *)this_task->taskpool;
+  (void)__parsec_tp; (void)es; (void)this_task; (void)data; (void)parent_task;
+  const int M = this_task->locals.M.value; (void)M;
+  const int N = this_task->locals.N.value; (void)N;
+  data->local.arena = data->remote.arena = NULL;
+  data->local.src_datatype  = data->local.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->local.src_count     = data->local.dst_count = 0;
+  data->local.src_displ     = data->local.dst_displ = 0;
+  data->data_future  = NULL;
+  if( (*flow_mask) & 0x80000000U ) { /* these are the input dependencies remote datatypes  */
+if( (*flow_mask) & 0x1U ) {  /* Flow A */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_kcyclic_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_kcyclic_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_kcyclic_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+if( (*flow_mask) & 0x2U ) {  /* Flow CA */
+    if( ((*flow_mask) & 0x2U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_kcyclic_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_kcyclic_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_kcyclic_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x2U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x2U) */
+if( (*flow_mask) & 0x4U ) {  /* Flow VA */
+    if( ((*flow_mask) & 0x4U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_kcyclic_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_kcyclic_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_kcyclic_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x4U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x4U) */
+    goto no_mask_match;
+  }
+
+  /* these are the output dependencies remote datatypes */
+ no_mask_match:
+  data->data                             = NULL;
+  data->remote.src_datatype = data->remote.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->remote.src_count    = data->remote.dst_count = 0;
+  data->remote.src_displ    = data->remote.dst_displ = 0;
+  data->data_future  = NULL;
+  (*flow_mask) = 0;  /* nothing left */
+  (void)M;  (void)N;
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+static int hook_of_kcyclic_COMPARE(parsec_execution_stream_t *es, __parsec_kcyclic_COMPARE_task_t *this_task)
+{
+  __parsec_kcyclic_internal_taskpool_t *__parsec_tp = (__parsec_kcyclic_internal_taskpool_t *)this_task->taskpool;
+  (void)es; (void)__parsec_tp;
+  const int M = this_task->locals.M.value; (void)M;
+  const int N = this_task->locals.N.value; (void)N;
+  (void)M;  (void)N;
+
+  /** Declare the variables that will hold the data, and all the accounting for each */
+  parsec_data_copy_t *_f_A = this_task->data._f_A.data_in;
+  void *A = PARSEC_DATA_COPY_GET_PTR(_f_A); (void)A;
+  parsec_data_copy_t *_f_CA = this_task->data._f_CA.data_in;
+  void *CA = PARSEC_DATA_COPY_GET_PTR(_f_CA); (void)CA;
+  parsec_data_copy_t *_f_VA = this_task->data._f_VA.data_in;
+  void *VA = PARSEC_DATA_COPY_GET_PTR(_f_VA); (void)VA;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    data_repo_entry_t *eA = this_task->data._f_A.source_repo_entry;
+    if( (NULL != eA) && (eA->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eA->sim_exec_date;
+    data_repo_entry_t *eCA = this_task->data._f_CA.source_repo_entry;
+    if( (NULL != eCA) && (eCA->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eCA->sim_exec_date;
+    data_repo_entry_t *eVA = this_task->data._f_VA.source_repo_entry;
+    if( (NULL != eVA) && (eVA->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eVA->sim_exec_date;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+  /** Cache Awareness Accounting */
+#if defined(PARSEC_CACHE_AWARENESS)
+  cache_buf_referenced(es->closest_cache, A);
+  cache_buf_referenced(es->closest_cache, CA);
+  cache_buf_referenced(es->closest_cache, VA);
+#endif /* PARSEC_CACHE_AWARENESS */
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                                  COMPARE BODY                                  -----*/
+
+    int *a = A, *ca = CA, *va = VA;
+    const char *errorkcyclic = "ERROR: A and CA content different!";
+    const char *errorview    = "ERROR: VA is not a permutation of A!";
+    const char *noerror      = "";
+    const char *error = noerror;
+
+    if(a[0] != ca[0] || a[1] != ca[1]) error = errorkcyclic;
+    parsec_data_collection_t* dc = &dA->super.super;
+    if(va[2] != (int)dc->rank_of(dc, va[0], va[1])) error = errorview;
+    printf("M=%02d, N=%02d\tA=%02d,%02d@%02d\tCA=%02d,%02d@%02d\tVA=%02d,%02d@%02d\t%s\n", M, N,
+            a[0], a[1], a[2],
+            ca[0], ca[1], ca[2],
+            va[0], va[1], va[2],
+            error);
+
+/*-----                              END OF COMPARE BODY                              -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#endif  /*  defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+static int complete_hook_of_kcyclic_COMPARE(parsec_execution_stream_t *es, __parsec_kcyclic_COMPARE_task_t *this_task)
+{
+  const __parsec_kcyclic_internal_taskpool_t *__parsec_tp = (__parsec_kcyclic_internal_taskpool_t *)this_task->taskpool;
+#if defined(DISTRIBUTED)
+    const int M = this_task->locals.M.value; (void)M;
+  const int N = this_task->locals.N.value; (void)N;
+#endif  /* defined(DISTRIBUTED) */
+  (void)es; (void)__parsec_tp;
+parsec_data_t* data_t_desc = NULL; (void)data_t_desc;
+#if defined(DISTRIBUTED)
+  /** If not working on distributed, there is no risk that data is not in place */
+  (void)M;  (void)N;
+
+#endif /* DISTRIBUTED */
+#if defined(PARSEC_PROF_GRAPHER)
+  parsec_prof_grapher_task((parsec_task_t*)this_task, es->th_id, es->virtual_process->vp_id,
+     __jdf2c_key_fns_COMPARE.key_hash(this_task->task_class->make_key( (parsec_taskpool_t*)this_task->taskpool, ((parsec_task_t*)this_task)->locals), NULL));
+#endif  /* defined(PARSEC_PROF_GRAPHER) */
+  release_deps_of_kcyclic_COMPARE(es, this_task,
+      PARSEC_ACTION_RELEASE_REMOTE_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_REFS |
+      PARSEC_ACTION_RESHAPE_ON_RELEASE |
+      0x0,  /* mask of all dep_index */ 
+      NULL);
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static parsec_hook_return_t release_task_of_kcyclic_COMPARE(parsec_execution_stream_t *es, parsec_task_t *this_task)
+{
+    const __parsec_kcyclic_internal_taskpool_t *__parsec_tp =
+        (const __parsec_kcyclic_internal_taskpool_t *)this_task->taskpool;
+    parsec_hash_table_t *ht = (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[3];
+    parsec_key_t key = this_task->task_class->make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals);
+    parsec_hashable_dependency_t *hash_dep = (parsec_hashable_dependency_t *)parsec_hash_table_remove(ht, key);
+    parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);
+    return parsec_release_task_to_mempool_update_nbtasks(es, this_task);
+}
+
+static char *kcyclic_kcyclic_COMPARE_internal_init_deps_key_functions_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_kcyclic_internal_taskpool_t *__parsec_tp = (__parsec_kcyclic_internal_taskpool_t *)user_data;
+  int M = (__parsec_key) % __parsec_tp->COMPARE_M_range + __parsec_tp->COMPARE_M_min;
+  __parsec_key = __parsec_key / __parsec_tp->COMPARE_M_range;
+  int N = (__parsec_key) % __parsec_tp->COMPARE_N_range + __parsec_tp->COMPARE_N_min;
+  __parsec_key = __parsec_key / __parsec_tp->COMPARE_N_range;
+  snprintf(buffer, buffer_size, "COMPARE(%d, %d)", M, N);
+  return buffer;
+}
+
+static parsec_key_fn_t kcyclic_kcyclic_COMPARE_internal_init_deps_key_functions = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = kcyclic_kcyclic_COMPARE_internal_init_deps_key_functions_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/* Needs: min-max count-tasks iterate */
+static int kcyclic_COMPARE_internal_init(parsec_execution_stream_t * es, __parsec_kcyclic_COMPARE_task_t * this_task)
+{
+  __parsec_kcyclic_internal_taskpool_t *__parsec_tp = (__parsec_kcyclic_internal_taskpool_t*)this_task->taskpool;
+  int32_t nb_tasks = 0, saved_nb_tasks = 0;
+int32_t __M_min = 0x7fffffff, __M_max = 0;int32_t __jdf2c_M_min = 0x7fffffff, __jdf2c_M_max = 0;int32_t __N_min = 0x7fffffff, __N_max = 0;int32_t __jdf2c_N_min = 0x7fffffff, __jdf2c_N_max = 0;  __parsec_kcyclic_COMPARE_parsec_assignment_t assignments = {  .M.value = 0, .N.value = 0 };
+  int32_t  M,  N;
+  int32_t __jdf2c_M_start, __jdf2c_M_end, __jdf2c_M_inc;
+  int32_t __jdf2c_N_start, __jdf2c_N_end, __jdf2c_N_inc;
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+  PARSEC_PROFILING_TRACE(es->es_profile,
+                         this_task->taskpool->profiling_array[START_KEY(this_task->task_class->task_class_id)],
+                         0,
+                         this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    __jdf2c_M_start = 0;
+    __jdf2c_M_end = MT;
+    __jdf2c_M_inc = 1;
+    __M_min = parsec_imin(__jdf2c_M_start, __jdf2c_M_end);
+    __M_max = parsec_imax(__jdf2c_M_start, __jdf2c_M_end);
+    __jdf2c_M_min = parsec_imin(__jdf2c_M_min, __M_min);
+    __jdf2c_M_max = parsec_imax(__jdf2c_M_max, __M_max);
+    for(M =  __jdf2c_M_start;
+        M <= __jdf2c_M_end;
+        M += __jdf2c_M_inc) {
+    assignments.M.value = M;
+      __jdf2c_N_start = 0;
+      __jdf2c_N_end = NT;
+      __jdf2c_N_inc = 1;
+      __N_min = parsec_imin(__jdf2c_N_start, __jdf2c_N_end);
+      __N_max = parsec_imax(__jdf2c_N_start, __jdf2c_N_end);
+      __jdf2c_N_min = parsec_imin(__jdf2c_N_min, __N_min);
+      __jdf2c_N_max = parsec_imax(__jdf2c_N_max, __N_max);
+      for(N =  __jdf2c_N_start;
+          N <= __jdf2c_N_end;
+          N += __jdf2c_N_inc) {
+      assignments.N.value = N;
+      if( !COMPARE_pred(M, N) ) continue;
+      nb_tasks++;
+    } /* Loop on normal range N */
+  } /* For loop of M */ 
+   if( 0 != nb_tasks ) {
+     (void)parsec_atomic_fetch_add_int32(&__parsec_tp->initial_number_tasks, nb_tasks);
+   }
+  /* Set the range variables for the collision-free hash-computation */
+  __parsec_tp->COMPARE_M_min   = __jdf2c_M_min;
+  __parsec_tp->COMPARE_M_range = (__jdf2c_M_max - __jdf2c_M_min) + 1;
+  __parsec_tp->COMPARE_N_min   = __jdf2c_N_min;
+  __parsec_tp->COMPARE_N_range = (__jdf2c_N_max - __jdf2c_N_min) + 1;
+  this_task->status = PARSEC_TASK_STATUS_COMPLETE;
+
+  PARSEC_AYU_REGISTER_TASK(&kcyclic_COMPARE);
+  __parsec_tp->super.super.dependencies_array[3] = PARSEC_OBJ_NEW(parsec_hash_table_t);
+  parsec_hash_table_init(__parsec_tp->super.super.dependencies_array[3], offsetof(parsec_hashable_dependency_t, ht_item), 10, kcyclic_kcyclic_COMPARE_internal_init_deps_key_functions, this_task->taskpool);
+  __parsec_tp->repositories[3] = data_repo_create_nothreadsafe(nb_tasks, __jdf2c_key_fns_COMPARE, (parsec_taskpool_t*)__parsec_tp, 3);
+(void)saved_nb_tasks;
+(void)__M_min; (void)__M_max;(void)__N_min; (void)__N_max;  (void)__jdf2c_M_start; (void)__jdf2c_M_end; (void)__jdf2c_M_inc;  (void)__jdf2c_N_start; (void)__jdf2c_N_end; (void)__jdf2c_N_inc;  (void)assignments; (void)__parsec_tp; (void)es;
+  if(1 == parsec_atomic_fetch_dec_int32(&__parsec_tp->sync_point)) {
+    /* Last initialization task complete. Update the number of tasks. */
+    __parsec_tp->super.super.tdm.module->taskpool_addto_nb_tasks(&__parsec_tp->super.super, __parsec_tp->initial_number_tasks);
+    parsec_mfence();  /* write memory barrier to guarantee that the scheduler gets the correct number of tasks */
+    parsec_taskpool_enable((parsec_taskpool_t*)__parsec_tp, &__parsec_tp->startup_queue,
+                           (parsec_task_t*)this_task, es, __parsec_tp->super.super.nb_pending_actions);
+    __parsec_tp->super.super.tdm.module->taskpool_ready(&__parsec_tp->super.super);
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+    PARSEC_PROFILING_TRACE(es->es_profile,
+                           this_task->taskpool->profiling_array[2 * this_task->task_class->task_class_id + 1],
+                           0,
+                           this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    return PARSEC_HOOK_RETURN_DONE;
+  }
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static const __parsec_chore_t __kcyclic_COMPARE_chores[] ={
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+    { .type     = PARSEC_DEV_CPU,
+      .evaluate = (parsec_evaluate_function_t*)NULL,
+      .hook     = (parsec_hook_t*)hook_of_kcyclic_COMPARE },
+#endif  /* defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+    { .type     = PARSEC_DEV_NONE,
+      .evaluate = NULL,
+      .hook     = (parsec_hook_t*)NULL },  /* End marker */
+};
+
+static const parsec_task_class_t kcyclic_COMPARE = {
+  .name = "COMPARE",
+  .task_class_id = 3,
+  .nb_flows = 3,
+  .nb_parameters = 2,
+  .nb_locals = 2,
+  .task_class_type = PARSEC_TASK_CLASS_TYPE_PTG,
+  .params = { &symb_kcyclic_COMPARE_M, &symb_kcyclic_COMPARE_N, NULL },
+  .locals = { &symb_kcyclic_COMPARE_M, &symb_kcyclic_COMPARE_N, NULL },
+  .data_affinity = (parsec_data_ref_fn_t*)affinity_of_kcyclic_COMPARE,
+  .initial_data = (parsec_data_ref_fn_t*)affinity_of_kcyclic_COMPARE,
+  .final_data = (parsec_data_ref_fn_t*)affinity_of_kcyclic_COMPARE,
+  .priority = NULL,
+  .properties = properties_of_kcyclic_COMPARE,
+#if MAX_PARAM_COUNT < 3  /* number of read flows of COMPARE */
+  #error Too many read flows for task COMPARE
+#endif  /* MAX_PARAM_COUNT */
+#if MAX_PARAM_COUNT < 0  /* number of write flows of COMPARE */
+  #error Too many write flows for task COMPARE
+#endif  /* MAX_PARAM_COUNT */
+  .in = { &flow_of_kcyclic_COMPARE_for_A, &flow_of_kcyclic_COMPARE_for_CA, &flow_of_kcyclic_COMPARE_for_VA, NULL },
+  .out = { NULL },
+  .flags = 0x0 | PARSEC_USE_DEPS_MASK,
+  .dependencies_goal = 0x7,
+  .make_key = __jdf2c_make_key_COMPARE,
+  .task_snprintf = parsec_task_snprintf,
+#if defined(PARSEC_PROF_TRACE)
+  .profile_info = &parsec_task_profile_info,
+#endif
+  .key_functions = &__jdf2c_key_fns_COMPARE,
+  .fini = (parsec_hook_t*)NULL,
+  .incarnations = __kcyclic_COMPARE_chores,
+  .find_deps = parsec_hash_find_deps,
+  .update_deps = parsec_update_deps_with_mask,
+  .iterate_successors = (parsec_traverse_function_t*)NULL,
+  .iterate_predecessors = (parsec_traverse_function_t*)iterate_predecessors_of_kcyclic_COMPARE,
+  .release_deps = (parsec_release_deps_t*)release_deps_of_kcyclic_COMPARE,
+  .prepare_output = (parsec_hook_t*)NULL,
+  .prepare_input = (parsec_hook_t*)data_lookup_of_kcyclic_COMPARE,
+  .time_estimate = NULL,
+  .get_datatype = datatype_lookup_of_kcyclic_COMPARE,
+  .complete_execution = (parsec_hook_t*)complete_hook_of_kcyclic_COMPARE,
+  .release_task = &release_task_of_kcyclic_COMPARE,
+#if defined(PARSEC_SIM)
+  .sim_cost_fct = (parsec_sim_cost_fct_t*)NULL,
+#endif
+};
+
+
+/******                                    READ_VA                                    ******/
+
+static inline int32_t minexpr_of_symb_kcyclic_READ_VA_M_fct(const __parsec_kcyclic_internal_taskpool_t *__parsec_tp, const __parsec_kcyclic_READ_VA_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_kcyclic_READ_VA_M = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_kcyclic_READ_VA_M_fct }
+                   }
+};
+static inline int maxexpr_of_symb_kcyclic_READ_VA_M_fct(const __parsec_kcyclic_internal_taskpool_t *__parsec_tp, const __parsec_kcyclic_READ_VA_parsec_assignment_t *locals)
+{
+  const int M = locals->M.value; (void)M;
+  const int N = locals->N.value; (void)N;
+
+  (void)M;
+  (void)N;
+  (void)__parsec_tp; (void)locals;
+  return MT;
+}
+static const parsec_expr_t maxexpr_of_symb_kcyclic_READ_VA_M = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_kcyclic_READ_VA_M_fct }
+                   }
+};
+static const parsec_symbol_t symb_kcyclic_READ_VA_M = { .name = "M", .context_index = 0, .min = &minexpr_of_symb_kcyclic_READ_VA_M, .max = &maxexpr_of_symb_kcyclic_READ_VA_M, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int32_t minexpr_of_symb_kcyclic_READ_VA_N_fct(const __parsec_kcyclic_internal_taskpool_t *__parsec_tp, const __parsec_kcyclic_READ_VA_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_kcyclic_READ_VA_N = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_kcyclic_READ_VA_N_fct }
+                   }
+};
+static inline int maxexpr_of_symb_kcyclic_READ_VA_N_fct(const __parsec_kcyclic_internal_taskpool_t *__parsec_tp, const __parsec_kcyclic_READ_VA_parsec_assignment_t *locals)
+{
+  const int M = locals->M.value; (void)M;
+  const int N = locals->N.value; (void)N;
+
+  (void)M;
+  (void)N;
+  (void)__parsec_tp; (void)locals;
+  return NT;
+}
+static const parsec_expr_t maxexpr_of_symb_kcyclic_READ_VA_N = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_kcyclic_READ_VA_N_fct }
+                   }
+};
+static const parsec_symbol_t symb_kcyclic_READ_VA_N = { .name = "N", .context_index = 1, .min = &minexpr_of_symb_kcyclic_READ_VA_N, .max = &maxexpr_of_symb_kcyclic_READ_VA_N, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int affinity_of_kcyclic_READ_VA(const __parsec_kcyclic_READ_VA_task_t *this_task,
+                     parsec_data_ref_t *ref)
+{
+    const __parsec_kcyclic_internal_taskpool_t *__parsec_tp = (const __parsec_kcyclic_internal_taskpool_t*)this_task->taskpool;
+  const int M = this_task->locals.M.value; (void)M;
+  const int N = this_task->locals.N.value; (void)N;
+
+  /* Silent Warnings: should look into predicate to know what variables are usefull */
+  (void)M;
+  (void)N;
+  ref->dc = (parsec_data_collection_t *)__parsec_tp->super._g_dVA;
+  /* Compute data key */
+  ref->key = ref->dc->data_key(ref->dc, M, N);
+  return 1;
+}
+static const parsec_property_t properties_of_kcyclic_READ_VA[1] = {
+  {.name = NULL, .expr = NULL}
+};
+static parsec_data_t *flow_of_kcyclic_READ_VA_for_VA_dep1_atline_158_direct_access(const __parsec_kcyclic_internal_taskpool_t *__parsec_tp, const __parsec_kcyclic_READ_VA_parsec_assignment_t *assignments)
+{
+  const int M = assignments->M.value; (void)M;
+  const int N = assignments->N.value; (void)N;
+
+  /* Silence Warnings: should look into parameters to know what variables are useful */
+  (void)M;
+  (void)N;
+  if( __parsec_tp->super.super.context->my_rank == (int32_t)rank_of_dVA(M, N) )
+    return data_of_dVA(M, N);
+  return NULL;
+}
+
+static const parsec_dep_t flow_of_kcyclic_READ_VA_for_VA_dep1_atline_158 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = PARSEC_LOCAL_DATA_TASK_CLASS_ID, /* kcyclic_dVA */
+  .direct_data = (parsec_data_lookup_func_t)&flow_of_kcyclic_READ_VA_for_VA_dep1_atline_158_direct_access,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_kcyclic_READ_VA_for_VA,
+};
+static const parsec_dep_t flow_of_kcyclic_READ_VA_for_VA_dep2_atline_159 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 3, /* kcyclic_COMPARE */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_kcyclic_COMPARE_for_VA,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_kcyclic_READ_VA_for_VA,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+#if MAX_DEP_OUT_COUNT < 1  /* number of output dependencies */
+    #error Too many output dependencies (supports up to MAX_DEP_OUT_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_OUT_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_kcyclic_READ_VA_for_VA = {
+  .name               = "VA",
+  .sym_type           = PARSEC_SYM_INOUT,
+  .flow_flags         = PARSEC_FLOW_ACCESS_READ|PARSEC_FLOW_HAS_IN_DEPS,
+  .flow_index         = 0,
+  .flow_datatype_mask = 0x1,
+  .dep_in     = { &flow_of_kcyclic_READ_VA_for_VA_dep1_atline_158 },
+  .dep_out    = { &flow_of_kcyclic_READ_VA_for_VA_dep2_atline_159 }
+};
+
+static inline int expr_of_cond_for_flow_of_kcyclic_READ_VA_for_C_dep1_atline_167_fct(const __parsec_kcyclic_internal_taskpool_t *__parsec_tp, const __parsec_kcyclic_READ_VA_parsec_assignment_t *locals)
+{
+  const int M = locals->M.value; (void)M;
+  const int N = locals->N.value; (void)N;
+
+  (void)M;
+  (void)N;
+  (void)__parsec_tp; (void)locals;
+  return ((M) == (0) && (N) == (0));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_kcyclic_READ_VA_for_C_dep1_atline_167 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_kcyclic_READ_VA_for_C_dep1_atline_167_fct }
+                   }
+};
+static inline int ctl_gather_compute_for_dep_flow_of_kcyclic_READ_VA_for_C_dep1_atline_167_fct(const __parsec_kcyclic_internal_taskpool_t *__parsec_tp, const __parsec_kcyclic_READ_VA_parsec_assignment_t *assignments)
+{
+  int   __nb_found = 0;
+  __parsec_kcyclic_READ_VA_parsec_assignment_t __jdf2c__tmp_locals = *assignments;
+  (void)__parsec_tp;
+  const int M = __jdf2c__tmp_locals.M.value; (void)M;
+  const int N = __jdf2c__tmp_locals.N.value; (void)N;
+  (void)M; (void)N;
+  int FILL_A_M = 0;
+  (void)FILL_A_M;
+  {
+    int FILL_A_N;
+    for(FILL_A_N  = 0;
+        FILL_A_N <= NT;
+        FILL_A_N += 1) {
+      __nb_found++;
+    }
+  }
+  return __nb_found;
+}
+
+static const parsec_expr_t ctl_gather_compute_for_dep_flow_of_kcyclic_READ_VA_for_C_dep1_atline_167 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)ctl_gather_compute_for_dep_flow_of_kcyclic_READ_VA_for_C_dep1_atline_167_fct }
+                   }
+};
+
+static const parsec_dep_t flow_of_kcyclic_READ_VA_for_C_dep1_atline_167 = {
+  .cond = &expr_of_cond_for_flow_of_kcyclic_READ_VA_for_C_dep1_atline_167,  /* ((M) == (0) && (N) == (0)) */
+  .ctl_gather_nb = &ctl_gather_compute_for_dep_flow_of_kcyclic_READ_VA_for_C_dep1_atline_167,
+  .task_class_id = 0, /* kcyclic_FILL_A */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_kcyclic_FILL_A_for_C,
+  .dep_index = 1,
+  .dep_datatype_index = 1,
+  .belongs_to = &flow_of_kcyclic_READ_VA_for_C,
+};
+static inline int expr_of_cond_for_flow_of_kcyclic_READ_VA_for_C_dep2_atline_170_fct(const __parsec_kcyclic_internal_taskpool_t *__parsec_tp, const __parsec_kcyclic_READ_VA_parsec_assignment_t *locals)
+{
+  const int M = locals->M.value; (void)M;
+  const int N = locals->N.value; (void)N;
+
+  (void)M;
+  (void)N;
+  (void)__parsec_tp; (void)locals;
+  return ((M) == (0) && (N) != (0));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_kcyclic_READ_VA_for_C_dep2_atline_170 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_kcyclic_READ_VA_for_C_dep2_atline_170_fct }
+                   }
+};
+static const parsec_dep_t flow_of_kcyclic_READ_VA_for_C_dep2_atline_170 = {
+  .cond = &expr_of_cond_for_flow_of_kcyclic_READ_VA_for_C_dep2_atline_170,  /* ((M) == (0) && (N) != (0)) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 2, /* kcyclic_READ_VA */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_kcyclic_READ_VA_for_C,
+  .dep_index = 2,
+  .dep_datatype_index = 1,
+  .belongs_to = &flow_of_kcyclic_READ_VA_for_C,
+};
+static inline int expr_of_cond_for_flow_of_kcyclic_READ_VA_for_C_dep3_atline_173_fct(const __parsec_kcyclic_internal_taskpool_t *__parsec_tp, const __parsec_kcyclic_READ_VA_parsec_assignment_t *locals)
+{
+  const int M = locals->M.value;
+  const int N = locals->N.value; (void)N;
+
+  (void)M;
+  (void)N;
+  (void)__parsec_tp; (void)locals;
+  return (M) != (0);
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_kcyclic_READ_VA_for_C_dep3_atline_173 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_kcyclic_READ_VA_for_C_dep3_atline_173_fct }
+                   }
+};
+static const parsec_dep_t flow_of_kcyclic_READ_VA_for_C_dep3_atline_173 = {
+  .cond = &expr_of_cond_for_flow_of_kcyclic_READ_VA_for_C_dep3_atline_173,  /* (M) != (0) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 2, /* kcyclic_READ_VA */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_kcyclic_READ_VA_for_C,
+  .dep_index = 3,
+  .dep_datatype_index = 1,
+  .belongs_to = &flow_of_kcyclic_READ_VA_for_C,
+};
+static inline int expr_of_cond_for_flow_of_kcyclic_READ_VA_for_C_dep4_atline_169_fct(const __parsec_kcyclic_internal_taskpool_t *__parsec_tp, const __parsec_kcyclic_READ_VA_parsec_assignment_t *locals)
+{
+  const int M = locals->M.value; (void)M;
+  const int N = locals->N.value; (void)N;
+
+  (void)M;
+  (void)N;
+  (void)__parsec_tp; (void)locals;
+  return ((M) == (0) && (N) == (0));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_kcyclic_READ_VA_for_C_dep4_atline_169 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_kcyclic_READ_VA_for_C_dep4_atline_169_fct }
+                   }
+};
+static const parsec_dep_t flow_of_kcyclic_READ_VA_for_C_dep4_atline_169 = {
+  .cond = &expr_of_cond_for_flow_of_kcyclic_READ_VA_for_C_dep4_atline_169,  /* ((M) == (0) && (N) == (0)) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 2, /* kcyclic_READ_VA */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_kcyclic_READ_VA_for_C,
+  .dep_index = 1,
+  .dep_datatype_index = 1,
+  .belongs_to = &flow_of_kcyclic_READ_VA_for_C,
+};
+static inline int expr_of_cond_for_flow_of_kcyclic_READ_VA_for_C_dep5_atline_172_fct(const __parsec_kcyclic_internal_taskpool_t *__parsec_tp, const __parsec_kcyclic_READ_VA_parsec_assignment_t *locals)
+{
+  const int M = locals->M.value;
+  const int N = locals->N.value; (void)N;
+
+  (void)M;
+  (void)N;
+  (void)__parsec_tp; (void)locals;
+  return (M) == (0);
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_kcyclic_READ_VA_for_C_dep5_atline_172 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_kcyclic_READ_VA_for_C_dep5_atline_172_fct }
+                   }
+};
+static const parsec_dep_t flow_of_kcyclic_READ_VA_for_C_dep5_atline_172 = {
+  .cond = &expr_of_cond_for_flow_of_kcyclic_READ_VA_for_C_dep5_atline_172,  /* (M) == (0) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 2, /* kcyclic_READ_VA */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_kcyclic_READ_VA_for_C,
+  .dep_index = 2,
+  .dep_datatype_index = 1,
+  .belongs_to = &flow_of_kcyclic_READ_VA_for_C,
+};
+#if MAX_DEP_IN_COUNT < 3  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 3). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+#if MAX_DEP_OUT_COUNT < 2  /* number of output dependencies */
+    #error Too many output dependencies (supports up to MAX_DEP_OUT_COUNT [=10] but found 2). Fix the code or recompile PaRSEC with a larger MAX_DEP_OUT_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_kcyclic_READ_VA_for_C = {
+  .name               = "C",
+  .sym_type           = PARSEC_SYM_INOUT,
+  .flow_flags         = PARSEC_FLOW_ACCESS_NONE|PARSEC_FLOW_HAS_IN_DEPS,
+  .flow_index         = 1,
+  .flow_datatype_mask = 0x2,
+  .dep_in     = { &flow_of_kcyclic_READ_VA_for_C_dep1_atline_167,
+ &flow_of_kcyclic_READ_VA_for_C_dep2_atline_170,
+ &flow_of_kcyclic_READ_VA_for_C_dep3_atline_173 },
+  .dep_out    = { &flow_of_kcyclic_READ_VA_for_C_dep4_atline_169,
+ &flow_of_kcyclic_READ_VA_for_C_dep5_atline_172 }
+};
+
+static void
+iterate_successors_of_kcyclic_READ_VA(parsec_execution_stream_t *es, const __parsec_kcyclic_READ_VA_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_kcyclic_internal_taskpool_t *__parsec_tp = (const __parsec_kcyclic_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_kcyclic_READ_VA_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_kcyclic_READ_VA_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int M = __jdf2c__tmp_locals.M.value; (void)M;
+  const int N = __jdf2c__tmp_locals.N.value; (void)N;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)M;  (void)N;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_dVA(M, N);
+#endif
+  if( action_mask & 0x1 ) {  /* Flow of data VA [0] */
+    data.data   = this_task->data._f_VA.data_out;
+    data.data_future  = NULL;
+    if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_kcyclic_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_kcyclic_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+       __parsec_kcyclic_COMPARE_task_t* ncc = (__parsec_kcyclic_COMPARE_task_t*)&nc;
+    nc.task_class = __parsec_tp->super.super.task_classes_array[kcyclic_COMPARE.task_class_id];
+      const int COMPARE_M = M;
+      if( (COMPARE_M >= (0)) && (COMPARE_M <= (MT)) ) {
+        assert(&nc.locals[0].value == &ncc->locals.M.value);
+        ncc->locals.M.value = COMPARE_M;
+        const int COMPARE_N = N;
+        if( (COMPARE_N >= (0)) && (COMPARE_N <= (NT)) ) {
+          assert(&nc.locals[1].value == &ncc->locals.N.value);
+          ncc->locals.N.value = COMPARE_N;
+#if defined(DISTRIBUTED)
+          rank_dst = rank_of_dA(ncc->locals.M.value, ncc->locals.N.value);
+          if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+            vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_dA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_dA, ncc->locals.M.value, ncc->locals.N.value);
+          nc.priority = __parsec_tp->super.super.priority;
+          successor_repo = COMPARE_repo;
+          successor_repo_key = __jdf2c_make_key_COMPARE((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+        RELEASE_DEP_OUTPUT(es, "VA", this_task, "VA", &nc, rank_src, rank_dst, &data);
+        if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_kcyclic_READ_VA_for_VA_dep2_atline_159, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+          }
+        }
+  }
+  if( action_mask & 0x6 ) {  /* Flow of data C [1] */
+    data.data   = this_task->data._f_C.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x2 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  =   /* Control: always empty */ 0;
+    data.local.dst_count  =   /* Control: always empty */ 0;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = NULL;
+    data.remote.src_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.src_count  =   /* Control: always empty */ 0;
+    data.remote.dst_count  =   /* Control: always empty */ 0;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( ((M) == (0) && (N) == (0)) ) {
+      __parsec_kcyclic_READ_VA_task_t* ncc = (__parsec_kcyclic_READ_VA_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[kcyclic_READ_VA.task_class_id];
+        const int READ_VA_M = 0;
+        if( (READ_VA_M >= (0)) && (READ_VA_M <= (MT)) ) {
+          assert(&nc.locals[0].value == &ncc->locals.M.value);
+          ncc->locals.M.value = READ_VA_M;
+          int READ_VA_N;
+        for( READ_VA_N = 1;READ_VA_N <= NT; READ_VA_N+=1) {
+            if( (READ_VA_N >= (0)) && (READ_VA_N <= (NT)) ) {
+              assert(&nc.locals[1].value == &ncc->locals.N.value);
+              ncc->locals.N.value = READ_VA_N;
+#if defined(DISTRIBUTED)
+              rank_dst = rank_of_dVA(ncc->locals.M.value, ncc->locals.N.value);
+              if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+                vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_dVA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_dVA, ncc->locals.M.value, ncc->locals.N.value);
+              nc.priority = __parsec_tp->super.super.priority;
+              successor_repo = READ_VA_repo;
+              successor_repo_key = __jdf2c_make_key_READ_VA((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+            RELEASE_DEP_OUTPUT(es, "C", this_task, "C", &nc, rank_src, rank_dst, &data);
+            if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_kcyclic_READ_VA_for_C_dep4_atline_169, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+              }
+            }
+          }
+    }
+  }
+  if( action_mask & 0x4 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  =   /* Control: always empty */ 0;
+    data.local.dst_count  =   /* Control: always empty */ 0;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = NULL;
+    data.remote.src_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.src_count  =   /* Control: always empty */ 0;
+    data.remote.dst_count  =   /* Control: always empty */ 0;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( (M) == (0) ) {
+      __parsec_kcyclic_READ_VA_task_t* ncc = (__parsec_kcyclic_READ_VA_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[kcyclic_READ_VA.task_class_id];
+        int READ_VA_M;
+      for( READ_VA_M = 1;READ_VA_M <= MT; READ_VA_M+=1) {
+          if( (READ_VA_M >= (0)) && (READ_VA_M <= (MT)) ) {
+            assert(&nc.locals[0].value == &ncc->locals.M.value);
+            ncc->locals.M.value = READ_VA_M;
+            const int READ_VA_N = N;
+            if( (READ_VA_N >= (0)) && (READ_VA_N <= (NT)) ) {
+              assert(&nc.locals[1].value == &ncc->locals.N.value);
+              ncc->locals.N.value = READ_VA_N;
+#if defined(DISTRIBUTED)
+              rank_dst = rank_of_dVA(ncc->locals.M.value, ncc->locals.N.value);
+              if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+                vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_dVA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_dVA, ncc->locals.M.value, ncc->locals.N.value);
+              nc.priority = __parsec_tp->super.super.priority;
+              successor_repo = READ_VA_repo;
+              successor_repo_key = __jdf2c_make_key_READ_VA((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+            RELEASE_DEP_OUTPUT(es, "C", this_task, "C", &nc, rank_src, rank_dst, &data);
+            if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_kcyclic_READ_VA_for_C_dep5_atline_172, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+              }
+            }
+          }
+    }
+  }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static void
+iterate_predecessors_of_kcyclic_READ_VA(parsec_execution_stream_t *es, const __parsec_kcyclic_READ_VA_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_kcyclic_internal_taskpool_t *__parsec_tp = (const __parsec_kcyclic_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_kcyclic_READ_VA_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_kcyclic_READ_VA_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int M = __jdf2c__tmp_locals.M.value; (void)M;
+  const int N = __jdf2c__tmp_locals.N.value; (void)N;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)M;  (void)N;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_dVA(M, N);
+#endif
+  /* Flow of data VA has only OUTPUT dependencies to Memory */
+  if( action_mask & 0xe ) {  /* Flow of data C [1] */
+    data.data   = this_task->data._f_C.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x2 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  =   /* Control: always empty */ 0;
+    data.local.dst_count  =   /* Control: always empty */ 0;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = NULL;
+    data.remote.src_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.src_count  =   /* Control: always empty */ 0;
+    data.remote.dst_count  =   /* Control: always empty */ 0;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( ((M) == (0) && (N) == (0)) ) {
+      __parsec_kcyclic_FILL_A_task_t* ncc = (__parsec_kcyclic_FILL_A_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[kcyclic_FILL_A.task_class_id];
+        const int FILL_A_M = 0;
+        if( (FILL_A_M >= (0)) && (FILL_A_M <= (MT)) ) {
+          assert(&nc.locals[0].value == &ncc->locals.M.value);
+          ncc->locals.M.value = FILL_A_M;
+          int FILL_A_N;
+        for( FILL_A_N = 0;FILL_A_N <= NT; FILL_A_N+=1) {
+            if( (FILL_A_N >= (0)) && (FILL_A_N <= (NT)) ) {
+              assert(&nc.locals[1].value == &ncc->locals.N.value);
+              ncc->locals.N.value = FILL_A_N;
+#if defined(DISTRIBUTED)
+              rank_dst = rank_of_dA(ncc->locals.M.value, ncc->locals.N.value);
+              if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+                vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_dA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_dA, ncc->locals.M.value, ncc->locals.N.value);
+              nc.priority = __parsec_tp->super.super.priority;
+              successor_repo = FILL_A_repo;
+              successor_repo_key = __jdf2c_make_key_FILL_A((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+            RELEASE_DEP_OUTPUT(es, "C", this_task, "C", &nc, rank_src, rank_dst, &data);
+            if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_kcyclic_READ_VA_for_C_dep1_atline_167, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+              }
+            }
+          }
+    }
+  }
+  if( action_mask & 0x4 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  =   /* Control: always empty */ 0;
+    data.local.dst_count  =   /* Control: always empty */ 0;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = NULL;
+    data.remote.src_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.src_count  =   /* Control: always empty */ 0;
+    data.remote.dst_count  =   /* Control: always empty */ 0;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( ((M) == (0) && (N) != (0)) ) {
+      __parsec_kcyclic_READ_VA_task_t* ncc = (__parsec_kcyclic_READ_VA_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[kcyclic_READ_VA.task_class_id];
+        const int READ_VA_M = 0;
+        if( (READ_VA_M >= (0)) && (READ_VA_M <= (MT)) ) {
+          assert(&nc.locals[0].value == &ncc->locals.M.value);
+          ncc->locals.M.value = READ_VA_M;
+          const int READ_VA_N = 0;
+          if( (READ_VA_N >= (0)) && (READ_VA_N <= (NT)) ) {
+            assert(&nc.locals[1].value == &ncc->locals.N.value);
+            ncc->locals.N.value = READ_VA_N;
+#if defined(DISTRIBUTED)
+            rank_dst = rank_of_dVA(ncc->locals.M.value, ncc->locals.N.value);
+            if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+              vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_dVA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_dVA, ncc->locals.M.value, ncc->locals.N.value);
+            nc.priority = __parsec_tp->super.super.priority;
+            successor_repo = READ_VA_repo;
+            successor_repo_key = __jdf2c_make_key_READ_VA((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+          RELEASE_DEP_OUTPUT(es, "C", this_task, "C", &nc, rank_src, rank_dst, &data);
+          if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_kcyclic_READ_VA_for_C_dep2_atline_170, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+            }
+          }
+    }
+  }
+  if( action_mask & 0x8 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  =   /* Control: always empty */ 0;
+    data.local.dst_count  =   /* Control: always empty */ 0;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = NULL;
+    data.remote.src_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.src_count  =   /* Control: always empty */ 0;
+    data.remote.dst_count  =   /* Control: always empty */ 0;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( (M) != (0) ) {
+      __parsec_kcyclic_READ_VA_task_t* ncc = (__parsec_kcyclic_READ_VA_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[kcyclic_READ_VA.task_class_id];
+        const int READ_VA_M = 0;
+        if( (READ_VA_M >= (0)) && (READ_VA_M <= (MT)) ) {
+          assert(&nc.locals[0].value == &ncc->locals.M.value);
+          ncc->locals.M.value = READ_VA_M;
+          const int READ_VA_N = N;
+          if( (READ_VA_N >= (0)) && (READ_VA_N <= (NT)) ) {
+            assert(&nc.locals[1].value == &ncc->locals.N.value);
+            ncc->locals.N.value = READ_VA_N;
+#if defined(DISTRIBUTED)
+            rank_dst = rank_of_dVA(ncc->locals.M.value, ncc->locals.N.value);
+            if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+              vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_dVA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_dVA, ncc->locals.M.value, ncc->locals.N.value);
+            nc.priority = __parsec_tp->super.super.priority;
+            successor_repo = READ_VA_repo;
+            successor_repo_key = __jdf2c_make_key_READ_VA((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+          RELEASE_DEP_OUTPUT(es, "C", this_task, "C", &nc, rank_src, rank_dst, &data);
+          if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_kcyclic_READ_VA_for_C_dep3_atline_173, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+            }
+          }
+    }
+  }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static int release_deps_of_kcyclic_READ_VA(parsec_execution_stream_t *es, __parsec_kcyclic_READ_VA_task_t *this_task, uint32_t action_mask, parsec_remote_deps_t *deps)
+{
+  PARSEC_PINS(es, RELEASE_DEPS_BEGIN, (parsec_task_t *)this_task);  const __parsec_kcyclic_internal_taskpool_t *__parsec_tp = (const __parsec_kcyclic_internal_taskpool_t *)this_task->taskpool;
+  parsec_release_dep_fct_arg_t arg;
+  int __vp_id;
+  int consume_local_repo = 0;
+  arg.action_mask = action_mask;
+  arg.output_entry = NULL;
+  arg.output_repo = NULL;
+#if defined(DISTRIBUTED)
+  arg.remote_deps = deps;
+#endif  /* defined(DISTRIBUTED) */
+  assert(NULL != es);
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS )    arg.ready_lists = alloca(sizeof(parsec_task_t *) * es->virtual_process->parsec_context->nb_vp);
+  else
+    arg.ready_lists = NULL;
+  for( __vp_id = 0; __vp_id < es->virtual_process->parsec_context->nb_vp; arg.ready_lists[__vp_id++] = NULL );
+  (void)__parsec_tp; (void)deps;
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_VA.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_VA.source_repo, this_task->data._f_VA.source_repo_entry->ht_item.key );
+    }
+  }
+  consume_local_repo = (this_task->repo_entry != NULL);
+  arg.output_repo = READ_VA_repo;
+  arg.output_entry = this_task->repo_entry;
+  arg.output_usage = 0;
+  if( action_mask & (PARSEC_ACTION_RELEASE_LOCAL_DEPS | PARSEC_ACTION_GET_REPO_ENTRY) ) {
+    arg.output_entry = data_repo_lookup_entry_and_create( es, arg.output_repo, __jdf2c_make_key_READ_VA((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    arg.output_entry->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(arg.output_entry->sim_exec_date == 0);
+    arg.output_entry->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  if(action_mask & ( PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE ) ){
+    /* Generate the reshape promise for the outputs that need it */
+    iterate_successors_of_kcyclic_READ_VA(es, this_task, action_mask, parsec_set_up_reshape_promise, &arg);
+   }
+  iterate_successors_of_kcyclic_READ_VA(es, this_task, action_mask, parsec_release_dep_fct, &arg);
+
+#if defined(DISTRIBUTED)
+  if( (action_mask & PARSEC_ACTION_SEND_REMOTE_DEPS) && (NULL != arg.remote_deps)) {
+    parsec_remote_dep_activate(es, (parsec_task_t *)this_task, arg.remote_deps, arg.remote_deps->outgoing_mask);
+  }
+#endif
+
+  if(action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS) {
+    data_repo_entry_addto_usage_limit(READ_VA_repo, arg.output_entry->ht_item.key, arg.output_usage);
+    __parsec_schedule_vp(es, arg.ready_lists, 0);
+  }
+      if (consume_local_repo) {
+         data_repo_entry_used_once( READ_VA_repo, this_task->repo_entry->ht_item.key );
+      }
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_VA.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_VA.data_in);
+    }
+  }
+  PARSEC_PINS(es, RELEASE_DEPS_END, (parsec_task_t *)this_task);  return 0;
+}
+
+static int data_lookup_of_kcyclic_READ_VA(parsec_execution_stream_t *es, __parsec_kcyclic_READ_VA_task_t *this_task)
+{
+  const __parsec_kcyclic_internal_taskpool_t *__parsec_tp = (__parsec_kcyclic_internal_taskpool_t *)this_task->taskpool;
+  parsec_assignment_t generic_locals[MAX_PARAM_COUNT];  /* generic task locals */
+  int target_device = 0; (void)target_device;
+  (void)__parsec_tp; (void)generic_locals; (void)es;
+  parsec_data_copy_t *chunk = NULL;
+  data_repo_t        *reshape_repo  = NULL, *consumed_repo  = NULL;
+  data_repo_entry_t  *reshape_entry = NULL, *consumed_entry = NULL;
+  parsec_key_t        reshape_entry_key = 0, consumed_entry_key = 0;
+  uint8_t             consumed_flow_index;
+  parsec_dep_data_description_t data;
+  int ret;
+  (void)reshape_repo; (void)reshape_entry; (void)reshape_entry_key;
+  (void)consumed_repo; (void)consumed_entry; (void)consumed_entry_key;
+  (void)consumed_flow_index;
+  (void)chunk; (void)data; (void)ret;
+  const int M = this_task->locals.M.value; (void)M;
+  const int N = this_task->locals.N.value; (void)N;
+  if( NULL == this_task->repo_entry ){
+    this_task->repo_entry = data_repo_lookup_entry_and_create(es, READ_VA_repo,                                       __jdf2c_make_key_READ_VA((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    data_repo_entry_addto_usage_limit(READ_VA_repo, this_task->repo_entry->ht_item.key, 1);    this_task->repo_entry ->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(this_task->repo_entry ->sim_exec_date == 0);
+    this_task->repo_entry ->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  /* The reshape repo is the current task repo. */  reshape_repo = READ_VA_repo;
+  reshape_entry_key = __jdf2c_make_key_READ_VA((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals) ;
+  reshape_entry = this_task->repo_entry;
+  /* Lookup the input data, and store them in the context if any */
+
+if(! this_task->data._f_VA.fulfill ){ /* Flow VA */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_VA.data_out = NULL;  /* By default, if nothing matches */
+  /* Flow VA [0] dependency [0] from memory dVA */
+  if( NULL == (chunk = this_task->data._f_VA.data_in) ) {
+  /* No data set up by predecessor on this task input flow */
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+  parsec_prof_grapher_data_input(data_of_dVA(M, N), (parsec_task_t*)this_task, &flow_of_kcyclic_READ_VA_for_VA, 1);
+#endif
+    chunk = parsec_data_get_copy(data_of_dVA(M, N), target_device);
+    data.data = chunk;
+    data.data_future  = NULL;
+        data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.data_future   = NULL;
+    if( (ret = parsec_get_copy_reshape_from_desc(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    this_task->data._f_VA.data_out = chunk;
+    PARSEC_OBJ_RETAIN(chunk);
+  } 
+    this_task->data._f_VA.data_in     = chunk;
+    this_task->data._f_VA.source_repo       = consumed_repo;
+    this_task->data._f_VA.source_repo_entry = consumed_entry;
+    if( this_task->data._f_VA.source_repo_entry == this_task->repo_entry ){
+      /* in case we have consume from this task repo entry for the flow,
+       * it is cleaned up, avoiding having old stuff during release_deps_of
+       */
+      this_task->repo_entry->data[0] = NULL;
+    }
+    this_task->data._f_VA.fulfill = 1;
+}
+
+  /* C is a control flow */
+  this_task->data._f_C.data_in         = NULL;
+  this_task->data._f_C.data_out        = NULL;
+  this_task->data._f_C.source_repo       = NULL;
+  this_task->data._f_C.source_repo_entry = NULL;
+  /** Generate profiling information */
+#if defined(PARSEC_PROF_TRACE)
+  this_task->prof_info.desc = (parsec_data_collection_t*)__parsec_tp->super._g_dVA;
+  this_task->prof_info.priority = this_task->priority;
+  this_task->prof_info.data_id   = ((parsec_data_collection_t*)__parsec_tp->super._g_dVA)->data_key((parsec_data_collection_t*)__parsec_tp->super._g_dVA, M, N);
+  this_task->prof_info.task_class_id = this_task->task_class->task_class_id;
+  this_task->prof_info.task_return_code = -1;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int datatype_lookup_of_kcyclic_READ_VA(parsec_execution_stream_t *es, const parsec_task_t *this_generic_task, const parsec_task_t *parent_task,
+              uint32_t* flow_mask, parsec_dep_data_description_t* data)
+{
+  const __parsec_kcyclic_READ_VA_task_t *this_task = (__parsec_kcyclic_READ_VA_task_t*)this_generic_task;
+  const __parsec_kcyclic_internal_taskpool_t *__parsec_tp = (__parsec_kcyclic_internal_taskpool_t *)this_task->taskpool;
+  (void)__parsec_tp; (void)es; (void)this_task; (void)data; (void)parent_task;
+  const int M = this_task->locals.M.value; (void)M;
+  const int N = this_task->locals.N.value; (void)N;
+  data->local.arena = data->remote.arena = NULL;
+  data->local.src_datatype  = data->local.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->local.src_count     = data->local.dst_count = 0;
+  data->local.src_displ     = data->local.dst_displ = 0;
+  data->data_future  = NULL;
+  if( (*flow_mask) & 0x80000000U ) { /* these are the input dependencies remote datatypes  */
+if( (*flow_mask) & 0x1U ) {  /* Flow VA */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_kcyclic_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_kcyclic_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_kcyclic_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+    goto no_mask_match;
+  }
+
+  /* these are the output dependencies remote datatypes */
+if( (*flow_mask) & 0x1U ) {  /* Flow VA */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_kcyclic_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_kcyclic_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_kcyclic_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+ no_mask_match:
+  data->data                             = NULL;
+  data->remote.src_datatype = data->remote.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->remote.src_count    = data->remote.dst_count = 0;
+  data->remote.src_displ    = data->remote.dst_displ = 0;
+  data->data_future  = NULL;
+  (*flow_mask) = 0;  /* nothing left */
+  (void)M;  (void)N;
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+static int hook_of_kcyclic_READ_VA(parsec_execution_stream_t *es, __parsec_kcyclic_READ_VA_task_t *this_task)
+{
+  __parsec_kcyclic_internal_taskpool_t *__parsec_tp = (__parsec_kcyclic_internal_taskpool_t *)this_task->taskpool;
+  (void)es; (void)__parsec_tp;
+  const int M = this_task->locals.M.value; (void)M;
+  const int N = this_task->locals.N.value; (void)N;
+  (void)M;  (void)N;
+
+  /** Declare the variables that will hold the data, and all the accounting for each */
+  parsec_data_copy_t *_f_VA = this_task->data._f_VA.data_in;
+  void *VA = PARSEC_DATA_COPY_GET_PTR(_f_VA); (void)VA;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    data_repo_entry_t *eVA = this_task->data._f_VA.source_repo_entry;
+    if( (NULL != eVA) && (eVA->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eVA->sim_exec_date;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+  /** Cache Awareness Accounting */
+#if defined(PARSEC_CACHE_AWARENESS)
+  cache_buf_referenced(es->closest_cache, VA);
+#endif /* PARSEC_CACHE_AWARENESS */
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                                  READ_VA BODY                                  -----*/
+
+/*nothing*/
+
+/*-----                              END OF READ_VA BODY                              -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#endif  /*  defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+static int complete_hook_of_kcyclic_READ_VA(parsec_execution_stream_t *es, __parsec_kcyclic_READ_VA_task_t *this_task)
+{
+  const __parsec_kcyclic_internal_taskpool_t *__parsec_tp = (__parsec_kcyclic_internal_taskpool_t *)this_task->taskpool;
+#if defined(DISTRIBUTED)
+    const int M = this_task->locals.M.value; (void)M;
+  const int N = this_task->locals.N.value; (void)N;
+#endif  /* defined(DISTRIBUTED) */
+  (void)es; (void)__parsec_tp;
+parsec_data_t* data_t_desc = NULL; (void)data_t_desc;
+#if defined(DISTRIBUTED)
+  /** If not working on distributed, there is no risk that data is not in place */
+  (void)M;  (void)N;
+
+#endif /* DISTRIBUTED */
+#if defined(PARSEC_PROF_GRAPHER)
+  parsec_prof_grapher_task((parsec_task_t*)this_task, es->th_id, es->virtual_process->vp_id,
+     __jdf2c_key_fns_READ_VA.key_hash(this_task->task_class->make_key( (parsec_taskpool_t*)this_task->taskpool, ((parsec_task_t*)this_task)->locals), NULL));
+#endif  /* defined(PARSEC_PROF_GRAPHER) */
+  release_deps_of_kcyclic_READ_VA(es, this_task,
+      PARSEC_ACTION_RELEASE_REMOTE_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_REFS |
+      PARSEC_ACTION_RESHAPE_ON_RELEASE |
+      0x7,  /* mask of all dep_index */ 
+      NULL);
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static parsec_hook_return_t release_task_of_kcyclic_READ_VA(parsec_execution_stream_t *es, parsec_task_t *this_task)
+{
+    const __parsec_kcyclic_internal_taskpool_t *__parsec_tp =
+        (const __parsec_kcyclic_internal_taskpool_t *)this_task->taskpool;
+    parsec_hash_table_t *ht = (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[2];
+    parsec_key_t key = this_task->task_class->make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals);
+    parsec_hashable_dependency_t *hash_dep = (parsec_hashable_dependency_t *)parsec_hash_table_remove(ht, key);
+    parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);
+    return parsec_release_task_to_mempool_update_nbtasks(es, this_task);
+}
+
+static char *kcyclic_kcyclic_READ_VA_internal_init_deps_key_functions_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_kcyclic_internal_taskpool_t *__parsec_tp = (__parsec_kcyclic_internal_taskpool_t *)user_data;
+  int M = (__parsec_key) % __parsec_tp->READ_VA_M_range + __parsec_tp->READ_VA_M_min;
+  __parsec_key = __parsec_key / __parsec_tp->READ_VA_M_range;
+  int N = (__parsec_key) % __parsec_tp->READ_VA_N_range + __parsec_tp->READ_VA_N_min;
+  __parsec_key = __parsec_key / __parsec_tp->READ_VA_N_range;
+  snprintf(buffer, buffer_size, "READ_VA(%d, %d)", M, N);
+  return buffer;
+}
+
+static parsec_key_fn_t kcyclic_kcyclic_READ_VA_internal_init_deps_key_functions = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = kcyclic_kcyclic_READ_VA_internal_init_deps_key_functions_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/* Needs: min-max count-tasks iterate */
+static int kcyclic_READ_VA_internal_init(parsec_execution_stream_t * es, __parsec_kcyclic_READ_VA_task_t * this_task)
+{
+  __parsec_kcyclic_internal_taskpool_t *__parsec_tp = (__parsec_kcyclic_internal_taskpool_t*)this_task->taskpool;
+  int32_t nb_tasks = 0, saved_nb_tasks = 0;
+int32_t __M_min = 0x7fffffff, __M_max = 0;int32_t __jdf2c_M_min = 0x7fffffff, __jdf2c_M_max = 0;int32_t __N_min = 0x7fffffff, __N_max = 0;int32_t __jdf2c_N_min = 0x7fffffff, __jdf2c_N_max = 0;  __parsec_kcyclic_READ_VA_parsec_assignment_t assignments = {  .M.value = 0, .N.value = 0 };
+  int32_t  M,  N;
+  int32_t __jdf2c_M_start, __jdf2c_M_end, __jdf2c_M_inc;
+  int32_t __jdf2c_N_start, __jdf2c_N_end, __jdf2c_N_inc;
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+  PARSEC_PROFILING_TRACE(es->es_profile,
+                         this_task->taskpool->profiling_array[START_KEY(this_task->task_class->task_class_id)],
+                         0,
+                         this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    __jdf2c_M_start = 0;
+    __jdf2c_M_end = MT;
+    __jdf2c_M_inc = 1;
+    __M_min = parsec_imin(__jdf2c_M_start, __jdf2c_M_end);
+    __M_max = parsec_imax(__jdf2c_M_start, __jdf2c_M_end);
+    __jdf2c_M_min = parsec_imin(__jdf2c_M_min, __M_min);
+    __jdf2c_M_max = parsec_imax(__jdf2c_M_max, __M_max);
+    for(M =  __jdf2c_M_start;
+        M <= __jdf2c_M_end;
+        M += __jdf2c_M_inc) {
+    assignments.M.value = M;
+      __jdf2c_N_start = 0;
+      __jdf2c_N_end = NT;
+      __jdf2c_N_inc = 1;
+      __N_min = parsec_imin(__jdf2c_N_start, __jdf2c_N_end);
+      __N_max = parsec_imax(__jdf2c_N_start, __jdf2c_N_end);
+      __jdf2c_N_min = parsec_imin(__jdf2c_N_min, __N_min);
+      __jdf2c_N_max = parsec_imax(__jdf2c_N_max, __N_max);
+      for(N =  __jdf2c_N_start;
+          N <= __jdf2c_N_end;
+          N += __jdf2c_N_inc) {
+      assignments.N.value = N;
+      if( !READ_VA_pred(M, N) ) continue;
+      nb_tasks++;
+    } /* Loop on normal range N */
+  } /* For loop of M */ 
+   if( 0 != nb_tasks ) {
+     (void)parsec_atomic_fetch_add_int32(&__parsec_tp->initial_number_tasks, nb_tasks);
+   }
+  /* Set the range variables for the collision-free hash-computation */
+  __parsec_tp->READ_VA_M_min   = __jdf2c_M_min;
+  __parsec_tp->READ_VA_M_range = (__jdf2c_M_max - __jdf2c_M_min) + 1;
+  __parsec_tp->READ_VA_N_min   = __jdf2c_N_min;
+  __parsec_tp->READ_VA_N_range = (__jdf2c_N_max - __jdf2c_N_min) + 1;
+    do {
+      this_task->super.list_next = (parsec_list_item_t*)__parsec_tp->startup_queue;
+    } while(!parsec_atomic_cas_ptr(&__parsec_tp->startup_queue, (parsec_list_item_t*)this_task->super.list_next, this_task));
+    this_task->status = PARSEC_TASK_STATUS_HOOK;
+
+  PARSEC_AYU_REGISTER_TASK(&kcyclic_READ_VA);
+  __parsec_tp->super.super.dependencies_array[2] = PARSEC_OBJ_NEW(parsec_hash_table_t);
+  parsec_hash_table_init(__parsec_tp->super.super.dependencies_array[2], offsetof(parsec_hashable_dependency_t, ht_item), 10, kcyclic_kcyclic_READ_VA_internal_init_deps_key_functions, this_task->taskpool);
+  __parsec_tp->repositories[2] = data_repo_create_nothreadsafe(nb_tasks, __jdf2c_key_fns_READ_VA, (parsec_taskpool_t*)__parsec_tp, 2);
+(void)saved_nb_tasks;
+(void)__M_min; (void)__M_max;(void)__N_min; (void)__N_max;  (void)__jdf2c_M_start; (void)__jdf2c_M_end; (void)__jdf2c_M_inc;  (void)__jdf2c_N_start; (void)__jdf2c_N_end; (void)__jdf2c_N_inc;  (void)assignments; (void)__parsec_tp; (void)es;
+  if(1 == parsec_atomic_fetch_dec_int32(&__parsec_tp->sync_point)) {
+    /* Last initialization task complete. Update the number of tasks. */
+    __parsec_tp->super.super.tdm.module->taskpool_addto_nb_tasks(&__parsec_tp->super.super, __parsec_tp->initial_number_tasks);
+    parsec_mfence();  /* write memory barrier to guarantee that the scheduler gets the correct number of tasks */
+    parsec_taskpool_enable((parsec_taskpool_t*)__parsec_tp, &__parsec_tp->startup_queue,
+                           (parsec_task_t*)this_task, es, __parsec_tp->super.super.nb_pending_actions);
+    __parsec_tp->super.super.tdm.module->taskpool_ready(&__parsec_tp->super.super);
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+    PARSEC_PROFILING_TRACE(es->es_profile,
+                           this_task->taskpool->profiling_array[2 * this_task->task_class->task_class_id + 1],
+                           0,
+                           this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    if( 1 >= __parsec_tp->super.super.nb_pending_actions ) {
+        /* if no tasks will be generated let's prevent the runtime from calling the hook and instead go directly to complete the task */
+        this_task->status = PARSEC_TASK_STATUS_COMPLETE;
+    }
+    return PARSEC_HOOK_RETURN_DONE;
+  }
+  return PARSEC_HOOK_RETURN_ASYNC;
+}
+
+static int __jdf2c_startup_READ_VA(parsec_execution_stream_t * es, __parsec_kcyclic_READ_VA_task_t *this_task)
+{
+  __parsec_kcyclic_READ_VA_task_t* new_task;
+  __parsec_kcyclic_internal_taskpool_t* __parsec_tp = (__parsec_kcyclic_internal_taskpool_t*)this_task->taskpool;
+  parsec_context_t *context = __parsec_tp->super.super.context;
+  int vpid = 0, nb_tasks = 0;
+  size_t total_nb_tasks = 0;
+  parsec_list_item_t* pready_ring[context->nb_vp];
+  int restore_context = 0;
+  int M = this_task->locals.M.value;  /* retrieve value saved during the last iteration */
+  int N = this_task->locals.N.value;  /* retrieve value saved during the last iteration */
+  for(int _i = 0; _i < context->nb_vp; pready_ring[_i++] = NULL );
+  if( 0 != this_task->locals.reserved[0].value ) {
+    this_task->locals.reserved[0].value = 1; /* reset the submission process */
+    restore_context = 1;
+    goto restore_context_0;
+  }
+  this_task->locals.reserved[0].value = 1; /* a sane default value */
+  for(this_task->locals.M.value = M = 0;
+      this_task->locals.M.value <= MT;
+      this_task->locals.M.value += 1, M = this_task->locals.M.value) {
+    for(this_task->locals.N.value = N = 0;
+        this_task->locals.N.value <= NT;
+        this_task->locals.N.value += 1, N = this_task->locals.N.value) {
+      if( !READ_VA_pred(M, N) ) continue;
+  __parsec_kcyclic_READ_VA_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_kcyclic_READ_VA_parsec_assignment_t*)&this_task->locals;
+  (void)__jdf2c__tmp_locals;
+  /* Flow for VA is always a memory reference */
+  if( ((M) == (0) && (N) == (0)) ) continue; /* C FILL_A() is not a memory reference for flow C */
+  if( ((M) == (0) && (N) != (0)) ) continue; /* C READ_VA() is not a memory reference for flow C */
+  if( (M) != (0) ) continue; /* C READ_VA() is not a memory reference for flow C */
+      if( NULL != ((parsec_data_collection_t*)__parsec_tp->super._g_dVA)->vpid_of ) {
+        vpid = ((parsec_data_collection_t*)__parsec_tp->super._g_dVA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_dVA, M, N);
+        assert(context->nb_vp >= vpid);
+      } else {
+        vpid = (vpid + 1) % context->nb_vp;  /* spread the initial joy */
+      }
+      new_task = (__parsec_kcyclic_READ_VA_task_t*)parsec_thread_mempool_allocate( context->virtual_processes[vpid]->execution_streams[0]->context_mempool );
+      PARSEC_OBJ_CONSTRUCT(new_task, parsec_task_t); /* construct called only when new, force-construct it again */
+      /* Copy only the valid elements from this_task to new_task one */
+      new_task->taskpool   = this_task->taskpool;
+      new_task->task_class = __parsec_tp->super.super.task_classes_array[kcyclic_READ_VA.task_class_id];
+      new_task->chore_mask   = PARSEC_DEV_ALL;
+      new_task->locals.M.value = this_task->locals.M.value;
+      new_task->locals.N.value = this_task->locals.N.value;
+      PARSEC_LIST_ITEM_SINGLETON(new_task);
+      new_task->priority = __parsec_tp->super.super.priority;
+      new_task->repo_entry = NULL;
+      new_task->data._f_VA.source_repo_entry = NULL;
+      new_task->data._f_VA.source_repo       = NULL;
+      new_task->data._f_VA.data_in         = NULL;
+      new_task->data._f_VA.data_out        = NULL;
+      new_task->data._f_VA.fulfill         = 0;
+      new_task->data._f_C.source_repo_entry = NULL;
+      new_task->data._f_C.source_repo       = NULL;
+      new_task->data._f_C.data_in         = NULL;
+      new_task->data._f_C.data_out        = NULL;
+      new_task->data._f_C.fulfill         = 0;
+#if defined(PARSEC_DEBUG_NOISIER)
+      {
+        char tmp[128];
+        PARSEC_DEBUG_VERBOSE(10, parsec_debug_output, "Add startup task %s to vpid %d",
+               parsec_task_snprintf(tmp, 128, (parsec_task_t*)new_task), vpid);
+      }
+#endif
+      parsec_dependencies_mark_task_as_startup((parsec_task_t*)new_task, es);
+      pready_ring[vpid] = parsec_list_item_ring_push_sorted(pready_ring[vpid],
+                                                            (parsec_list_item_t*)new_task,
+                                                            parsec_execution_context_priority_comparator);
+      nb_tasks++;
+     restore_context_0:  /* we jump here just so that we have code after the label */
+      restore_context = 0;
+      (void)restore_context;
+      if( nb_tasks > this_task->locals.reserved[0].value ) {
+        if( (size_t)this_task->locals.reserved[0].value < parsec_task_startup_iter ) this_task->locals.reserved[0].value <<= 1;
+        __parsec_schedule_vp(es, (parsec_task_t**)pready_ring, 0);
+        total_nb_tasks += nb_tasks;
+        nb_tasks = 0;
+        if( total_nb_tasks > parsec_task_startup_chunk ) {  /* stop here and request to be rescheduled */
+          return PARSEC_HOOK_RETURN_AGAIN;
+        }
+      }
+    } /* Loop on normal range N */
+  } /* Loop on normal range M */
+  (void)vpid;
+  if( 0 != nb_tasks ) {
+    __parsec_schedule_vp(es, (parsec_task_t**)pready_ring, 0);
+    nb_tasks = 0;
+  }
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static const __parsec_chore_t __kcyclic_READ_VA_chores[] ={
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+    { .type     = PARSEC_DEV_CPU,
+      .evaluate = (parsec_evaluate_function_t*)NULL,
+      .hook     = (parsec_hook_t*)hook_of_kcyclic_READ_VA },
+#endif  /* defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+    { .type     = PARSEC_DEV_NONE,
+      .evaluate = NULL,
+      .hook     = (parsec_hook_t*)NULL },  /* End marker */
+};
+
+static const parsec_task_class_t kcyclic_READ_VA = {
+  .name = "READ_VA",
+  .task_class_id = 2,
+  .nb_flows = 2,
+  .nb_parameters = 2,
+  .nb_locals = 2,
+  .task_class_type = PARSEC_TASK_CLASS_TYPE_PTG,
+  .params = { &symb_kcyclic_READ_VA_M, &symb_kcyclic_READ_VA_N, NULL },
+  .locals = { &symb_kcyclic_READ_VA_M, &symb_kcyclic_READ_VA_N, NULL },
+  .data_affinity = (parsec_data_ref_fn_t*)affinity_of_kcyclic_READ_VA,
+  .initial_data = (parsec_data_ref_fn_t*)affinity_of_kcyclic_READ_VA,
+  .final_data = (parsec_data_ref_fn_t*)affinity_of_kcyclic_READ_VA,
+  .priority = NULL,
+  .properties = properties_of_kcyclic_READ_VA,
+#if MAX_PARAM_COUNT < 1  /* number of read flows of READ_VA */
+  #error Too many read flows for task READ_VA
+#endif  /* MAX_PARAM_COUNT */
+#if MAX_PARAM_COUNT < 0  /* number of write flows of READ_VA */
+  #error Too many write flows for task READ_VA
+#endif  /* MAX_PARAM_COUNT */
+  .in = { &flow_of_kcyclic_READ_VA_for_VA, &flow_of_kcyclic_READ_VA_for_C, NULL },
+  .out = { &flow_of_kcyclic_READ_VA_for_VA, &flow_of_kcyclic_READ_VA_for_C, NULL },
+  .flags = 0x0 | PARSEC_HAS_IN_IN_DEPENDENCIES|PARSEC_HAS_CTL_GATHER,
+  .dependencies_goal = 2,
+  .make_key = __jdf2c_make_key_READ_VA,
+  .task_snprintf = parsec_task_snprintf,
+#if defined(PARSEC_PROF_TRACE)
+  .profile_info = &parsec_task_profile_info,
+#endif
+  .key_functions = &__jdf2c_key_fns_READ_VA,
+  .fini = (parsec_hook_t*)NULL,
+  .incarnations = __kcyclic_READ_VA_chores,
+  .find_deps = parsec_hash_find_deps,
+  .update_deps = parsec_update_deps_with_counter,
+  .iterate_successors = (parsec_traverse_function_t*)iterate_successors_of_kcyclic_READ_VA,
+  .iterate_predecessors = (parsec_traverse_function_t*)iterate_predecessors_of_kcyclic_READ_VA,
+  .release_deps = (parsec_release_deps_t*)release_deps_of_kcyclic_READ_VA,
+  .prepare_output = (parsec_hook_t*)NULL,
+  .prepare_input = (parsec_hook_t*)data_lookup_of_kcyclic_READ_VA,
+  .time_estimate = NULL,
+  .get_datatype = datatype_lookup_of_kcyclic_READ_VA,
+  .complete_execution = (parsec_hook_t*)complete_hook_of_kcyclic_READ_VA,
+  .release_task = &release_task_of_kcyclic_READ_VA,
+#if defined(PARSEC_SIM)
+  .sim_cost_fct = (parsec_sim_cost_fct_t*)NULL,
+#endif
+};
+
+
+/******                                    FILL_CA                                    ******/
+
+static inline int32_t minexpr_of_symb_kcyclic_FILL_CA_M_fct(const __parsec_kcyclic_internal_taskpool_t *__parsec_tp, const __parsec_kcyclic_FILL_CA_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_kcyclic_FILL_CA_M = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_kcyclic_FILL_CA_M_fct }
+                   }
+};
+static inline int maxexpr_of_symb_kcyclic_FILL_CA_M_fct(const __parsec_kcyclic_internal_taskpool_t *__parsec_tp, const __parsec_kcyclic_FILL_CA_parsec_assignment_t *locals)
+{
+  const int M = locals->M.value; (void)M;
+  const int N = locals->N.value; (void)N;
+
+  (void)M;
+  (void)N;
+  (void)__parsec_tp; (void)locals;
+  return MT;
+}
+static const parsec_expr_t maxexpr_of_symb_kcyclic_FILL_CA_M = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_kcyclic_FILL_CA_M_fct }
+                   }
+};
+static const parsec_symbol_t symb_kcyclic_FILL_CA_M = { .name = "M", .context_index = 0, .min = &minexpr_of_symb_kcyclic_FILL_CA_M, .max = &maxexpr_of_symb_kcyclic_FILL_CA_M, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int32_t minexpr_of_symb_kcyclic_FILL_CA_N_fct(const __parsec_kcyclic_internal_taskpool_t *__parsec_tp, const __parsec_kcyclic_FILL_CA_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_kcyclic_FILL_CA_N = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_kcyclic_FILL_CA_N_fct }
+                   }
+};
+static inline int maxexpr_of_symb_kcyclic_FILL_CA_N_fct(const __parsec_kcyclic_internal_taskpool_t *__parsec_tp, const __parsec_kcyclic_FILL_CA_parsec_assignment_t *locals)
+{
+  const int M = locals->M.value; (void)M;
+  const int N = locals->N.value; (void)N;
+
+  (void)M;
+  (void)N;
+  (void)__parsec_tp; (void)locals;
+  return NT;
+}
+static const parsec_expr_t maxexpr_of_symb_kcyclic_FILL_CA_N = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_kcyclic_FILL_CA_N_fct }
+                   }
+};
+static const parsec_symbol_t symb_kcyclic_FILL_CA_N = { .name = "N", .context_index = 1, .min = &minexpr_of_symb_kcyclic_FILL_CA_N, .max = &maxexpr_of_symb_kcyclic_FILL_CA_N, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int affinity_of_kcyclic_FILL_CA(const __parsec_kcyclic_FILL_CA_task_t *this_task,
+                     parsec_data_ref_t *ref)
+{
+    const __parsec_kcyclic_internal_taskpool_t *__parsec_tp = (const __parsec_kcyclic_internal_taskpool_t*)this_task->taskpool;
+  const int M = this_task->locals.M.value; (void)M;
+  const int N = this_task->locals.N.value; (void)N;
+
+  /* Silent Warnings: should look into predicate to know what variables are usefull */
+  (void)M;
+  (void)N;
+  ref->dc = (parsec_data_collection_t *)__parsec_tp->super._g_dCA;
+  /* Compute data key */
+  ref->key = ref->dc->data_key(ref->dc, M, N);
+  return 1;
+}
+static const parsec_property_t properties_of_kcyclic_FILL_CA[1] = {
+  {.name = NULL, .expr = NULL}
+};
+static parsec_data_t *flow_of_kcyclic_FILL_CA_for_CA_dep1_atline_141_direct_access(const __parsec_kcyclic_internal_taskpool_t *__parsec_tp, const __parsec_kcyclic_FILL_CA_parsec_assignment_t *assignments)
+{
+  const int M = assignments->M.value; (void)M;
+  const int N = assignments->N.value; (void)N;
+
+  /* Silence Warnings: should look into parameters to know what variables are useful */
+  (void)M;
+  (void)N;
+  if( __parsec_tp->super.super.context->my_rank == (int32_t)rank_of_dCA(M, N) )
+    return data_of_dCA(M, N);
+  return NULL;
+}
+
+static const parsec_dep_t flow_of_kcyclic_FILL_CA_for_CA_dep1_atline_141 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = PARSEC_LOCAL_DATA_TASK_CLASS_ID, /* kcyclic_dCA */
+  .direct_data = (parsec_data_lookup_func_t)&flow_of_kcyclic_FILL_CA_for_CA_dep1_atline_141_direct_access,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_kcyclic_FILL_CA_for_CA,
+};
+static const parsec_dep_t flow_of_kcyclic_FILL_CA_for_CA_dep2_atline_142 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 3, /* kcyclic_COMPARE */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_kcyclic_COMPARE_for_CA,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_kcyclic_FILL_CA_for_CA,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+#if MAX_DEP_OUT_COUNT < 1  /* number of output dependencies */
+    #error Too many output dependencies (supports up to MAX_DEP_OUT_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_OUT_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_kcyclic_FILL_CA_for_CA = {
+  .name               = "CA",
+  .sym_type           = PARSEC_SYM_INOUT,
+  .flow_flags         = PARSEC_FLOW_ACCESS_RW|PARSEC_FLOW_HAS_IN_DEPS,
+  .flow_index         = 0,
+  .flow_datatype_mask = 0x1,
+  .dep_in     = { &flow_of_kcyclic_FILL_CA_for_CA_dep1_atline_141 },
+  .dep_out    = { &flow_of_kcyclic_FILL_CA_for_CA_dep2_atline_142 }
+};
+
+static void
+iterate_successors_of_kcyclic_FILL_CA(parsec_execution_stream_t *es, const __parsec_kcyclic_FILL_CA_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_kcyclic_internal_taskpool_t *__parsec_tp = (const __parsec_kcyclic_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_kcyclic_FILL_CA_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_kcyclic_FILL_CA_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int M = __jdf2c__tmp_locals.M.value; (void)M;
+  const int N = __jdf2c__tmp_locals.N.value; (void)N;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)M;  (void)N;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_dCA(M, N);
+#endif
+  if( action_mask & 0x1 ) {  /* Flow of data CA [0] */
+    data.data   = this_task->data._f_CA.data_out;
+    data.data_future  = NULL;
+    if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_kcyclic_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_kcyclic_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+       __parsec_kcyclic_COMPARE_task_t* ncc = (__parsec_kcyclic_COMPARE_task_t*)&nc;
+    nc.task_class = __parsec_tp->super.super.task_classes_array[kcyclic_COMPARE.task_class_id];
+      const int COMPARE_M = M;
+      if( (COMPARE_M >= (0)) && (COMPARE_M <= (MT)) ) {
+        assert(&nc.locals[0].value == &ncc->locals.M.value);
+        ncc->locals.M.value = COMPARE_M;
+        const int COMPARE_N = N;
+        if( (COMPARE_N >= (0)) && (COMPARE_N <= (NT)) ) {
+          assert(&nc.locals[1].value == &ncc->locals.N.value);
+          ncc->locals.N.value = COMPARE_N;
+#if defined(DISTRIBUTED)
+          rank_dst = rank_of_dA(ncc->locals.M.value, ncc->locals.N.value);
+          if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+            vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_dA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_dA, ncc->locals.M.value, ncc->locals.N.value);
+          nc.priority = __parsec_tp->super.super.priority;
+          successor_repo = COMPARE_repo;
+          successor_repo_key = __jdf2c_make_key_COMPARE((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+        RELEASE_DEP_OUTPUT(es, "CA", this_task, "CA", &nc, rank_src, rank_dst, &data);
+        if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_kcyclic_FILL_CA_for_CA_dep2_atline_142, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+          }
+        }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static int release_deps_of_kcyclic_FILL_CA(parsec_execution_stream_t *es, __parsec_kcyclic_FILL_CA_task_t *this_task, uint32_t action_mask, parsec_remote_deps_t *deps)
+{
+  PARSEC_PINS(es, RELEASE_DEPS_BEGIN, (parsec_task_t *)this_task);  const __parsec_kcyclic_internal_taskpool_t *__parsec_tp = (const __parsec_kcyclic_internal_taskpool_t *)this_task->taskpool;
+  parsec_release_dep_fct_arg_t arg;
+  int __vp_id;
+  int consume_local_repo = 0;
+  arg.action_mask = action_mask;
+  arg.output_entry = NULL;
+  arg.output_repo = NULL;
+#if defined(DISTRIBUTED)
+  arg.remote_deps = deps;
+#endif  /* defined(DISTRIBUTED) */
+  assert(NULL != es);
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS )    arg.ready_lists = alloca(sizeof(parsec_task_t *) * es->virtual_process->parsec_context->nb_vp);
+  else
+    arg.ready_lists = NULL;
+  for( __vp_id = 0; __vp_id < es->virtual_process->parsec_context->nb_vp; arg.ready_lists[__vp_id++] = NULL );
+  (void)__parsec_tp; (void)deps;
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_CA.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_CA.source_repo, this_task->data._f_CA.source_repo_entry->ht_item.key );
+    }
+  }
+  consume_local_repo = (this_task->repo_entry != NULL);
+  arg.output_repo = FILL_CA_repo;
+  arg.output_entry = this_task->repo_entry;
+  arg.output_usage = 0;
+  if( action_mask & (PARSEC_ACTION_RELEASE_LOCAL_DEPS | PARSEC_ACTION_GET_REPO_ENTRY) ) {
+    arg.output_entry = data_repo_lookup_entry_and_create( es, arg.output_repo, __jdf2c_make_key_FILL_CA((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    arg.output_entry->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(arg.output_entry->sim_exec_date == 0);
+    arg.output_entry->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  if(action_mask & ( PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE ) ){
+    /* Generate the reshape promise for the outputs that need it */
+    iterate_successors_of_kcyclic_FILL_CA(es, this_task, action_mask, parsec_set_up_reshape_promise, &arg);
+   }
+  iterate_successors_of_kcyclic_FILL_CA(es, this_task, action_mask, parsec_release_dep_fct, &arg);
+
+#if defined(DISTRIBUTED)
+  if( (action_mask & PARSEC_ACTION_SEND_REMOTE_DEPS) && (NULL != arg.remote_deps)) {
+    parsec_remote_dep_activate(es, (parsec_task_t *)this_task, arg.remote_deps, arg.remote_deps->outgoing_mask);
+  }
+#endif
+
+  if(action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS) {
+    data_repo_entry_addto_usage_limit(FILL_CA_repo, arg.output_entry->ht_item.key, arg.output_usage);
+    __parsec_schedule_vp(es, arg.ready_lists, 0);
+  }
+      if (consume_local_repo) {
+         data_repo_entry_used_once( FILL_CA_repo, this_task->repo_entry->ht_item.key );
+      }
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_CA.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_CA.data_in);
+    }
+  }
+  PARSEC_PINS(es, RELEASE_DEPS_END, (parsec_task_t *)this_task);  return 0;
+}
+
+static int data_lookup_of_kcyclic_FILL_CA(parsec_execution_stream_t *es, __parsec_kcyclic_FILL_CA_task_t *this_task)
+{
+  const __parsec_kcyclic_internal_taskpool_t *__parsec_tp = (__parsec_kcyclic_internal_taskpool_t *)this_task->taskpool;
+  parsec_assignment_t generic_locals[MAX_PARAM_COUNT];  /* generic task locals */
+  int target_device = 0; (void)target_device;
+  (void)__parsec_tp; (void)generic_locals; (void)es;
+  parsec_data_copy_t *chunk = NULL;
+  data_repo_t        *reshape_repo  = NULL, *consumed_repo  = NULL;
+  data_repo_entry_t  *reshape_entry = NULL, *consumed_entry = NULL;
+  parsec_key_t        reshape_entry_key = 0, consumed_entry_key = 0;
+  uint8_t             consumed_flow_index;
+  parsec_dep_data_description_t data;
+  int ret;
+  (void)reshape_repo; (void)reshape_entry; (void)reshape_entry_key;
+  (void)consumed_repo; (void)consumed_entry; (void)consumed_entry_key;
+  (void)consumed_flow_index;
+  (void)chunk; (void)data; (void)ret;
+  const int M = this_task->locals.M.value; (void)M;
+  const int N = this_task->locals.N.value; (void)N;
+  if( NULL == this_task->repo_entry ){
+    this_task->repo_entry = data_repo_lookup_entry_and_create(es, FILL_CA_repo,                                       __jdf2c_make_key_FILL_CA((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    data_repo_entry_addto_usage_limit(FILL_CA_repo, this_task->repo_entry->ht_item.key, 1);    this_task->repo_entry ->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(this_task->repo_entry ->sim_exec_date == 0);
+    this_task->repo_entry ->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  /* The reshape repo is the current task repo. */  reshape_repo = FILL_CA_repo;
+  reshape_entry_key = __jdf2c_make_key_FILL_CA((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals) ;
+  reshape_entry = this_task->repo_entry;
+  /* Lookup the input data, and store them in the context if any */
+
+if(! this_task->data._f_CA.fulfill ){ /* Flow CA */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_CA.data_out = NULL;  /* By default, if nothing matches */
+  /* Flow CA [0] dependency [0] from memory dCA */
+  if( NULL == (chunk = this_task->data._f_CA.data_in) ) {
+  /* No data set up by predecessor on this task input flow */
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+  parsec_prof_grapher_data_input(data_of_dCA(M, N), (parsec_task_t*)this_task, &flow_of_kcyclic_FILL_CA_for_CA, 1);
+#endif
+    chunk = parsec_data_get_copy(data_of_dCA(M, N), target_device);
+    data.data = chunk;
+    data.data_future  = NULL;
+        data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.data_future   = NULL;
+    if( (ret = parsec_get_copy_reshape_from_desc(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    this_task->data._f_CA.data_out = chunk;
+    PARSEC_OBJ_RETAIN(chunk);
+  } 
+    this_task->data._f_CA.data_in     = chunk;
+    this_task->data._f_CA.source_repo       = consumed_repo;
+    this_task->data._f_CA.source_repo_entry = consumed_entry;
+    if( this_task->data._f_CA.source_repo_entry == this_task->repo_entry ){
+      /* in case we have consume from this task repo entry for the flow,
+       * it is cleaned up, avoiding having old stuff during release_deps_of
+       */
+      this_task->repo_entry->data[0] = NULL;
+    }
+    this_task->data._f_CA.fulfill = 1;
+}
+
+  /** Generate profiling information */
+#if defined(PARSEC_PROF_TRACE)
+  this_task->prof_info.desc = (parsec_data_collection_t*)__parsec_tp->super._g_dCA;
+  this_task->prof_info.priority = this_task->priority;
+  this_task->prof_info.data_id   = ((parsec_data_collection_t*)__parsec_tp->super._g_dCA)->data_key((parsec_data_collection_t*)__parsec_tp->super._g_dCA, M, N);
+  this_task->prof_info.task_class_id = this_task->task_class->task_class_id;
+  this_task->prof_info.task_return_code = -1;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int datatype_lookup_of_kcyclic_FILL_CA(parsec_execution_stream_t *es, const parsec_task_t *this_generic_task, const parsec_task_t *parent_task,
+              uint32_t* flow_mask, parsec_dep_data_description_t* data)
+{
+  const __parsec_kcyclic_FILL_CA_task_t *this_task = (__parsec_kcyclic_FILL_CA_task_t*)this_generic_task;
+  const __parsec_kcyclic_internal_taskpool_t *__parsec_tp = (__parsec_kcyclic_internal_taskpool_t *)this_task->taskpool;
+  (void)__parsec_tp; (void)es; (void)this_task; (void)data; (void)parent_task;
+  const int M = this_task->locals.M.value; (void)M;
+  const int N = this_task->locals.N.value; (void)N;
+  data->local.arena = data->remote.arena = NULL;
+  data->local.src_datatype  = data->local.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->local.src_count     = data->local.dst_count = 0;
+  data->local.src_displ     = data->local.dst_displ = 0;
+  data->data_future  = NULL;
+  if( (*flow_mask) & 0x80000000U ) { /* these are the input dependencies remote datatypes  */
+if( (*flow_mask) & 0x1U ) {  /* Flow CA */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_kcyclic_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_kcyclic_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_kcyclic_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+    goto no_mask_match;
+  }
+
+  /* these are the output dependencies remote datatypes */
+if( (*flow_mask) & 0x1U ) {  /* Flow CA */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_kcyclic_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_kcyclic_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_kcyclic_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+ no_mask_match:
+  data->data                             = NULL;
+  data->remote.src_datatype = data->remote.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->remote.src_count    = data->remote.dst_count = 0;
+  data->remote.src_displ    = data->remote.dst_displ = 0;
+  data->data_future  = NULL;
+  (*flow_mask) = 0;  /* nothing left */
+  (void)M;  (void)N;
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+static int hook_of_kcyclic_FILL_CA(parsec_execution_stream_t *es, __parsec_kcyclic_FILL_CA_task_t *this_task)
+{
+  __parsec_kcyclic_internal_taskpool_t *__parsec_tp = (__parsec_kcyclic_internal_taskpool_t *)this_task->taskpool;
+  (void)es; (void)__parsec_tp;
+  const int M = this_task->locals.M.value; (void)M;
+  const int N = this_task->locals.N.value; (void)N;
+  (void)M;  (void)N;
+
+  /** Declare the variables that will hold the data, and all the accounting for each */
+  parsec_data_copy_t *_f_CA = this_task->data._f_CA.data_in;
+  void *CA = PARSEC_DATA_COPY_GET_PTR(_f_CA); (void)CA;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    data_repo_entry_t *eCA = this_task->data._f_CA.source_repo_entry;
+    if( (NULL != eCA) && (eCA->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eCA->sim_exec_date;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+    if ( NULL != _f_CA ) {
+#if defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) || defined(PARSEC_HAVE_DEV_HIP_SUPPORT)
+      parsec_data_transfer_ownership_to_copy( _f_CA->original, 0 /* device */,
+                                           PARSEC_FLOW_ACCESS_RW);
+#endif  /* defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) || defined(PARSEC_HAVE_DEV_HIP_SUPPORT) */
+      _f_CA->version++;  /* CA */
+#if defined(PARSEC_DEBUG_NOISIER)
+      char tmp[128];
+      PARSEC_DEBUG_VERBOSE(10, parsec_debug_output,
+                           "Body of %s: change Data copy %p to version %d",
+                           parsec_task_snprintf(tmp, 128, (parsec_task_t*)(this_task)),
+                           _f_CA, _f_CA->version);
+#endif /* defined(PARSEC_DEBUG_NOISIER) */
+    }
+  /** Cache Awareness Accounting */
+#if defined(PARSEC_CACHE_AWARENESS)
+  cache_buf_referenced(es->closest_cache, CA);
+#endif /* PARSEC_CACHE_AWARENESS */
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                                  FILL_CA BODY                                  -----*/
+
+    int *ca = CA;
+    parsec_data_collection_t* dc = &dCA->super.super;
+    ca[0] = M;
+    ca[1] = N;
+    ca[2] = dc->rank_of(dc, M, N);
+
+/*-----                              END OF FILL_CA BODY                              -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#endif  /*  defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+static int complete_hook_of_kcyclic_FILL_CA(parsec_execution_stream_t *es, __parsec_kcyclic_FILL_CA_task_t *this_task)
+{
+  const __parsec_kcyclic_internal_taskpool_t *__parsec_tp = (__parsec_kcyclic_internal_taskpool_t *)this_task->taskpool;
+#if defined(DISTRIBUTED)
+    const int M = this_task->locals.M.value; (void)M;
+  const int N = this_task->locals.N.value; (void)N;
+#endif  /* defined(DISTRIBUTED) */
+  (void)es; (void)__parsec_tp;
+parsec_data_t* data_t_desc = NULL; (void)data_t_desc;
+#if defined(DISTRIBUTED)
+  /** If not working on distributed, there is no risk that data is not in place */
+  (void)M;  (void)N;
+
+#endif /* DISTRIBUTED */
+#if defined(PARSEC_PROF_GRAPHER)
+  parsec_prof_grapher_task((parsec_task_t*)this_task, es->th_id, es->virtual_process->vp_id,
+     __jdf2c_key_fns_FILL_CA.key_hash(this_task->task_class->make_key( (parsec_taskpool_t*)this_task->taskpool, ((parsec_task_t*)this_task)->locals), NULL));
+#endif  /* defined(PARSEC_PROF_GRAPHER) */
+  release_deps_of_kcyclic_FILL_CA(es, this_task,
+      PARSEC_ACTION_RELEASE_REMOTE_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_REFS |
+      PARSEC_ACTION_RESHAPE_ON_RELEASE |
+      0x1,  /* mask of all dep_index */ 
+      NULL);
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static parsec_hook_return_t release_task_of_kcyclic_FILL_CA(parsec_execution_stream_t *es, parsec_task_t *this_task)
+{
+    const __parsec_kcyclic_internal_taskpool_t *__parsec_tp =
+        (const __parsec_kcyclic_internal_taskpool_t *)this_task->taskpool;
+    parsec_hash_table_t *ht = (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[1];
+    parsec_key_t key = this_task->task_class->make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals);
+    parsec_hashable_dependency_t *hash_dep = (parsec_hashable_dependency_t *)parsec_hash_table_remove(ht, key);
+    parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);
+    return parsec_release_task_to_mempool_update_nbtasks(es, this_task);
+}
+
+static char *kcyclic_kcyclic_FILL_CA_internal_init_deps_key_functions_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_kcyclic_internal_taskpool_t *__parsec_tp = (__parsec_kcyclic_internal_taskpool_t *)user_data;
+  int M = (__parsec_key) % __parsec_tp->FILL_CA_M_range + __parsec_tp->FILL_CA_M_min;
+  __parsec_key = __parsec_key / __parsec_tp->FILL_CA_M_range;
+  int N = (__parsec_key) % __parsec_tp->FILL_CA_N_range + __parsec_tp->FILL_CA_N_min;
+  __parsec_key = __parsec_key / __parsec_tp->FILL_CA_N_range;
+  snprintf(buffer, buffer_size, "FILL_CA(%d, %d)", M, N);
+  return buffer;
+}
+
+static parsec_key_fn_t kcyclic_kcyclic_FILL_CA_internal_init_deps_key_functions = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = kcyclic_kcyclic_FILL_CA_internal_init_deps_key_functions_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/* Needs: min-max count-tasks iterate */
+static int kcyclic_FILL_CA_internal_init(parsec_execution_stream_t * es, __parsec_kcyclic_FILL_CA_task_t * this_task)
+{
+  __parsec_kcyclic_internal_taskpool_t *__parsec_tp = (__parsec_kcyclic_internal_taskpool_t*)this_task->taskpool;
+  int32_t nb_tasks = 0, saved_nb_tasks = 0;
+int32_t __M_min = 0x7fffffff, __M_max = 0;int32_t __jdf2c_M_min = 0x7fffffff, __jdf2c_M_max = 0;int32_t __N_min = 0x7fffffff, __N_max = 0;int32_t __jdf2c_N_min = 0x7fffffff, __jdf2c_N_max = 0;  __parsec_kcyclic_FILL_CA_parsec_assignment_t assignments = {  .M.value = 0, .N.value = 0 };
+  int32_t  M,  N;
+  int32_t __jdf2c_M_start, __jdf2c_M_end, __jdf2c_M_inc;
+  int32_t __jdf2c_N_start, __jdf2c_N_end, __jdf2c_N_inc;
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+  PARSEC_PROFILING_TRACE(es->es_profile,
+                         this_task->taskpool->profiling_array[START_KEY(this_task->task_class->task_class_id)],
+                         0,
+                         this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    __jdf2c_M_start = 0;
+    __jdf2c_M_end = MT;
+    __jdf2c_M_inc = 1;
+    __M_min = parsec_imin(__jdf2c_M_start, __jdf2c_M_end);
+    __M_max = parsec_imax(__jdf2c_M_start, __jdf2c_M_end);
+    __jdf2c_M_min = parsec_imin(__jdf2c_M_min, __M_min);
+    __jdf2c_M_max = parsec_imax(__jdf2c_M_max, __M_max);
+    for(M =  __jdf2c_M_start;
+        M <= __jdf2c_M_end;
+        M += __jdf2c_M_inc) {
+    assignments.M.value = M;
+      __jdf2c_N_start = 0;
+      __jdf2c_N_end = NT;
+      __jdf2c_N_inc = 1;
+      __N_min = parsec_imin(__jdf2c_N_start, __jdf2c_N_end);
+      __N_max = parsec_imax(__jdf2c_N_start, __jdf2c_N_end);
+      __jdf2c_N_min = parsec_imin(__jdf2c_N_min, __N_min);
+      __jdf2c_N_max = parsec_imax(__jdf2c_N_max, __N_max);
+      for(N =  __jdf2c_N_start;
+          N <= __jdf2c_N_end;
+          N += __jdf2c_N_inc) {
+      assignments.N.value = N;
+      if( !FILL_CA_pred(M, N) ) continue;
+      nb_tasks++;
+    } /* Loop on normal range N */
+  } /* For loop of M */ 
+   if( 0 != nb_tasks ) {
+     (void)parsec_atomic_fetch_add_int32(&__parsec_tp->initial_number_tasks, nb_tasks);
+   }
+  /* Set the range variables for the collision-free hash-computation */
+  __parsec_tp->FILL_CA_M_min   = __jdf2c_M_min;
+  __parsec_tp->FILL_CA_M_range = (__jdf2c_M_max - __jdf2c_M_min) + 1;
+  __parsec_tp->FILL_CA_N_min   = __jdf2c_N_min;
+  __parsec_tp->FILL_CA_N_range = (__jdf2c_N_max - __jdf2c_N_min) + 1;
+    do {
+      this_task->super.list_next = (parsec_list_item_t*)__parsec_tp->startup_queue;
+    } while(!parsec_atomic_cas_ptr(&__parsec_tp->startup_queue, (parsec_list_item_t*)this_task->super.list_next, this_task));
+    this_task->status = PARSEC_TASK_STATUS_HOOK;
+
+  PARSEC_AYU_REGISTER_TASK(&kcyclic_FILL_CA);
+  __parsec_tp->super.super.dependencies_array[1] = PARSEC_OBJ_NEW(parsec_hash_table_t);
+  parsec_hash_table_init(__parsec_tp->super.super.dependencies_array[1], offsetof(parsec_hashable_dependency_t, ht_item), 10, kcyclic_kcyclic_FILL_CA_internal_init_deps_key_functions, this_task->taskpool);
+  __parsec_tp->repositories[1] = data_repo_create_nothreadsafe(nb_tasks, __jdf2c_key_fns_FILL_CA, (parsec_taskpool_t*)__parsec_tp, 1);
+(void)saved_nb_tasks;
+(void)__M_min; (void)__M_max;(void)__N_min; (void)__N_max;  (void)__jdf2c_M_start; (void)__jdf2c_M_end; (void)__jdf2c_M_inc;  (void)__jdf2c_N_start; (void)__jdf2c_N_end; (void)__jdf2c_N_inc;  (void)assignments; (void)__parsec_tp; (void)es;
+  if(1 == parsec_atomic_fetch_dec_int32(&__parsec_tp->sync_point)) {
+    /* Last initialization task complete. Update the number of tasks. */
+    __parsec_tp->super.super.tdm.module->taskpool_addto_nb_tasks(&__parsec_tp->super.super, __parsec_tp->initial_number_tasks);
+    parsec_mfence();  /* write memory barrier to guarantee that the scheduler gets the correct number of tasks */
+    parsec_taskpool_enable((parsec_taskpool_t*)__parsec_tp, &__parsec_tp->startup_queue,
+                           (parsec_task_t*)this_task, es, __parsec_tp->super.super.nb_pending_actions);
+    __parsec_tp->super.super.tdm.module->taskpool_ready(&__parsec_tp->super.super);
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+    PARSEC_PROFILING_TRACE(es->es_profile,
+                           this_task->taskpool->profiling_array[2 * this_task->task_class->task_class_id + 1],
+                           0,
+                           this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    if( 1 >= __parsec_tp->super.super.nb_pending_actions ) {
+        /* if no tasks will be generated let's prevent the runtime from calling the hook and instead go directly to complete the task */
+        this_task->status = PARSEC_TASK_STATUS_COMPLETE;
+    }
+    return PARSEC_HOOK_RETURN_DONE;
+  }
+  return PARSEC_HOOK_RETURN_ASYNC;
+}
+
+static int __jdf2c_startup_FILL_CA(parsec_execution_stream_t * es, __parsec_kcyclic_FILL_CA_task_t *this_task)
+{
+  __parsec_kcyclic_FILL_CA_task_t* new_task;
+  __parsec_kcyclic_internal_taskpool_t* __parsec_tp = (__parsec_kcyclic_internal_taskpool_t*)this_task->taskpool;
+  parsec_context_t *context = __parsec_tp->super.super.context;
+  int vpid = 0, nb_tasks = 0;
+  size_t total_nb_tasks = 0;
+  parsec_list_item_t* pready_ring[context->nb_vp];
+  int restore_context = 0;
+  int M = this_task->locals.M.value;  /* retrieve value saved during the last iteration */
+  int N = this_task->locals.N.value;  /* retrieve value saved during the last iteration */
+  for(int _i = 0; _i < context->nb_vp; pready_ring[_i++] = NULL );
+  if( 0 != this_task->locals.reserved[0].value ) {
+    this_task->locals.reserved[0].value = 1; /* reset the submission process */
+    restore_context = 1;
+    goto restore_context_0;
+  }
+  this_task->locals.reserved[0].value = 1; /* a sane default value */
+  for(this_task->locals.M.value = M = 0;
+      this_task->locals.M.value <= MT;
+      this_task->locals.M.value += 1, M = this_task->locals.M.value) {
+    for(this_task->locals.N.value = N = 0;
+        this_task->locals.N.value <= NT;
+        this_task->locals.N.value += 1, N = this_task->locals.N.value) {
+      if( !FILL_CA_pred(M, N) ) continue;
+  __parsec_kcyclic_FILL_CA_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_kcyclic_FILL_CA_parsec_assignment_t*)&this_task->locals;
+  (void)__jdf2c__tmp_locals;
+  /* Flow for CA is always a memory reference */
+      if( NULL != ((parsec_data_collection_t*)__parsec_tp->super._g_dCA)->vpid_of ) {
+        vpid = ((parsec_data_collection_t*)__parsec_tp->super._g_dCA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_dCA, M, N);
+        assert(context->nb_vp >= vpid);
+      } else {
+        vpid = (vpid + 1) % context->nb_vp;  /* spread the initial joy */
+      }
+      new_task = (__parsec_kcyclic_FILL_CA_task_t*)parsec_thread_mempool_allocate( context->virtual_processes[vpid]->execution_streams[0]->context_mempool );
+      PARSEC_OBJ_CONSTRUCT(new_task, parsec_task_t); /* construct called only when new, force-construct it again */
+      /* Copy only the valid elements from this_task to new_task one */
+      new_task->taskpool   = this_task->taskpool;
+      new_task->task_class = __parsec_tp->super.super.task_classes_array[kcyclic_FILL_CA.task_class_id];
+      new_task->chore_mask   = PARSEC_DEV_ALL;
+      new_task->locals.M.value = this_task->locals.M.value;
+      new_task->locals.N.value = this_task->locals.N.value;
+      PARSEC_LIST_ITEM_SINGLETON(new_task);
+      new_task->priority = __parsec_tp->super.super.priority;
+      new_task->repo_entry = NULL;
+      new_task->data._f_CA.source_repo_entry = NULL;
+      new_task->data._f_CA.source_repo       = NULL;
+      new_task->data._f_CA.data_in         = NULL;
+      new_task->data._f_CA.data_out        = NULL;
+      new_task->data._f_CA.fulfill         = 0;
+#if defined(PARSEC_DEBUG_NOISIER)
+      {
+        char tmp[128];
+        PARSEC_DEBUG_VERBOSE(10, parsec_debug_output, "Add startup task %s to vpid %d",
+               parsec_task_snprintf(tmp, 128, (parsec_task_t*)new_task), vpid);
+      }
+#endif
+      parsec_dependencies_mark_task_as_startup((parsec_task_t*)new_task, es);
+      pready_ring[vpid] = parsec_list_item_ring_push_sorted(pready_ring[vpid],
+                                                            (parsec_list_item_t*)new_task,
+                                                            parsec_execution_context_priority_comparator);
+      nb_tasks++;
+     restore_context_0:  /* we jump here just so that we have code after the label */
+      restore_context = 0;
+      (void)restore_context;
+      if( nb_tasks > this_task->locals.reserved[0].value ) {
+        if( (size_t)this_task->locals.reserved[0].value < parsec_task_startup_iter ) this_task->locals.reserved[0].value <<= 1;
+        __parsec_schedule_vp(es, (parsec_task_t**)pready_ring, 0);
+        total_nb_tasks += nb_tasks;
+        nb_tasks = 0;
+        if( total_nb_tasks > parsec_task_startup_chunk ) {  /* stop here and request to be rescheduled */
+          return PARSEC_HOOK_RETURN_AGAIN;
+        }
+      }
+    } /* Loop on normal range N */
+  } /* Loop on normal range M */
+  (void)vpid;
+  if( 0 != nb_tasks ) {
+    __parsec_schedule_vp(es, (parsec_task_t**)pready_ring, 0);
+    nb_tasks = 0;
+  }
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static const __parsec_chore_t __kcyclic_FILL_CA_chores[] ={
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+    { .type     = PARSEC_DEV_CPU,
+      .evaluate = (parsec_evaluate_function_t*)NULL,
+      .hook     = (parsec_hook_t*)hook_of_kcyclic_FILL_CA },
+#endif  /* defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+    { .type     = PARSEC_DEV_NONE,
+      .evaluate = NULL,
+      .hook     = (parsec_hook_t*)NULL },  /* End marker */
+};
+
+static const parsec_task_class_t kcyclic_FILL_CA = {
+  .name = "FILL_CA",
+  .task_class_id = 1,
+  .nb_flows = 1,
+  .nb_parameters = 2,
+  .nb_locals = 2,
+  .task_class_type = PARSEC_TASK_CLASS_TYPE_PTG,
+  .params = { &symb_kcyclic_FILL_CA_M, &symb_kcyclic_FILL_CA_N, NULL },
+  .locals = { &symb_kcyclic_FILL_CA_M, &symb_kcyclic_FILL_CA_N, NULL },
+  .data_affinity = (parsec_data_ref_fn_t*)affinity_of_kcyclic_FILL_CA,
+  .initial_data = (parsec_data_ref_fn_t*)affinity_of_kcyclic_FILL_CA,
+  .final_data = (parsec_data_ref_fn_t*)affinity_of_kcyclic_FILL_CA,
+  .priority = NULL,
+  .properties = properties_of_kcyclic_FILL_CA,
+#if MAX_PARAM_COUNT < 1  /* number of read flows of FILL_CA */
+  #error Too many read flows for task FILL_CA
+#endif  /* MAX_PARAM_COUNT */
+#if MAX_PARAM_COUNT < 1  /* number of write flows of FILL_CA */
+  #error Too many write flows for task FILL_CA
+#endif  /* MAX_PARAM_COUNT */
+  .in = { &flow_of_kcyclic_FILL_CA_for_CA, NULL },
+  .out = { &flow_of_kcyclic_FILL_CA_for_CA, NULL },
+  .flags = 0x0 | PARSEC_HAS_IN_IN_DEPENDENCIES | PARSEC_USE_DEPS_MASK,
+  .dependencies_goal = 0x1,
+  .make_key = __jdf2c_make_key_FILL_CA,
+  .task_snprintf = parsec_task_snprintf,
+#if defined(PARSEC_PROF_TRACE)
+  .profile_info = &parsec_task_profile_info,
+#endif
+  .key_functions = &__jdf2c_key_fns_FILL_CA,
+  .fini = (parsec_hook_t*)NULL,
+  .incarnations = __kcyclic_FILL_CA_chores,
+  .find_deps = parsec_hash_find_deps,
+  .update_deps = parsec_update_deps_with_mask,
+  .iterate_successors = (parsec_traverse_function_t*)iterate_successors_of_kcyclic_FILL_CA,
+  .iterate_predecessors = (parsec_traverse_function_t*)NULL,
+  .release_deps = (parsec_release_deps_t*)release_deps_of_kcyclic_FILL_CA,
+  .prepare_output = (parsec_hook_t*)NULL,
+  .prepare_input = (parsec_hook_t*)data_lookup_of_kcyclic_FILL_CA,
+  .time_estimate = NULL,
+  .get_datatype = datatype_lookup_of_kcyclic_FILL_CA,
+  .complete_execution = (parsec_hook_t*)complete_hook_of_kcyclic_FILL_CA,
+  .release_task = &release_task_of_kcyclic_FILL_CA,
+#if defined(PARSEC_SIM)
+  .sim_cost_fct = (parsec_sim_cost_fct_t*)NULL,
+#endif
+};
+
+
+/******                                    FILL_A                                    ******/
+
+static inline int32_t minexpr_of_symb_kcyclic_FILL_A_M_fct(const __parsec_kcyclic_internal_taskpool_t *__parsec_tp, const __parsec_kcyclic_FILL_A_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_kcyclic_FILL_A_M = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_kcyclic_FILL_A_M_fct }
+                   }
+};
+static inline int maxexpr_of_symb_kcyclic_FILL_A_M_fct(const __parsec_kcyclic_internal_taskpool_t *__parsec_tp, const __parsec_kcyclic_FILL_A_parsec_assignment_t *locals)
+{
+  const int M = locals->M.value; (void)M;
+  const int N = locals->N.value; (void)N;
+
+  (void)M;
+  (void)N;
+  (void)__parsec_tp; (void)locals;
+  return MT;
+}
+static const parsec_expr_t maxexpr_of_symb_kcyclic_FILL_A_M = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_kcyclic_FILL_A_M_fct }
+                   }
+};
+static const parsec_symbol_t symb_kcyclic_FILL_A_M = { .name = "M", .context_index = 0, .min = &minexpr_of_symb_kcyclic_FILL_A_M, .max = &maxexpr_of_symb_kcyclic_FILL_A_M, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int32_t minexpr_of_symb_kcyclic_FILL_A_N_fct(const __parsec_kcyclic_internal_taskpool_t *__parsec_tp, const __parsec_kcyclic_FILL_A_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_kcyclic_FILL_A_N = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_kcyclic_FILL_A_N_fct }
+                   }
+};
+static inline int maxexpr_of_symb_kcyclic_FILL_A_N_fct(const __parsec_kcyclic_internal_taskpool_t *__parsec_tp, const __parsec_kcyclic_FILL_A_parsec_assignment_t *locals)
+{
+  const int M = locals->M.value; (void)M;
+  const int N = locals->N.value; (void)N;
+
+  (void)M;
+  (void)N;
+  (void)__parsec_tp; (void)locals;
+  return NT;
+}
+static const parsec_expr_t maxexpr_of_symb_kcyclic_FILL_A_N = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_kcyclic_FILL_A_N_fct }
+                   }
+};
+static const parsec_symbol_t symb_kcyclic_FILL_A_N = { .name = "N", .context_index = 1, .min = &minexpr_of_symb_kcyclic_FILL_A_N, .max = &maxexpr_of_symb_kcyclic_FILL_A_N, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int affinity_of_kcyclic_FILL_A(const __parsec_kcyclic_FILL_A_task_t *this_task,
+                     parsec_data_ref_t *ref)
+{
+    const __parsec_kcyclic_internal_taskpool_t *__parsec_tp = (const __parsec_kcyclic_internal_taskpool_t*)this_task->taskpool;
+  const int M = this_task->locals.M.value; (void)M;
+  const int N = this_task->locals.N.value; (void)N;
+
+  /* Silent Warnings: should look into predicate to know what variables are usefull */
+  (void)M;
+  (void)N;
+  ref->dc = (parsec_data_collection_t *)__parsec_tp->super._g_dA;
+  /* Compute data key */
+  ref->key = ref->dc->data_key(ref->dc, M, N);
+  return 1;
+}
+static const parsec_property_t properties_of_kcyclic_FILL_A[1] = {
+  {.name = NULL, .expr = NULL}
+};
+static parsec_data_t *flow_of_kcyclic_FILL_A_for_A_dep1_atline_119_direct_access(const __parsec_kcyclic_internal_taskpool_t *__parsec_tp, const __parsec_kcyclic_FILL_A_parsec_assignment_t *assignments)
+{
+  const int M = assignments->M.value; (void)M;
+  const int N = assignments->N.value; (void)N;
+
+  /* Silence Warnings: should look into parameters to know what variables are useful */
+  (void)M;
+  (void)N;
+  if( __parsec_tp->super.super.context->my_rank == (int32_t)rank_of_dA(M, N) )
+    return data_of_dA(M, N);
+  return NULL;
+}
+
+static const parsec_dep_t flow_of_kcyclic_FILL_A_for_A_dep1_atline_119 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = PARSEC_LOCAL_DATA_TASK_CLASS_ID, /* kcyclic_dA */
+  .direct_data = (parsec_data_lookup_func_t)&flow_of_kcyclic_FILL_A_for_A_dep1_atline_119_direct_access,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_kcyclic_FILL_A_for_A,
+};
+static const parsec_dep_t flow_of_kcyclic_FILL_A_for_A_dep2_atline_120 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 3, /* kcyclic_COMPARE */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_kcyclic_COMPARE_for_A,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_kcyclic_FILL_A_for_A,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+#if MAX_DEP_OUT_COUNT < 1  /* number of output dependencies */
+    #error Too many output dependencies (supports up to MAX_DEP_OUT_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_OUT_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_kcyclic_FILL_A_for_A = {
+  .name               = "A",
+  .sym_type           = PARSEC_SYM_INOUT,
+  .flow_flags         = PARSEC_FLOW_ACCESS_RW|PARSEC_FLOW_HAS_IN_DEPS,
+  .flow_index         = 0,
+  .flow_datatype_mask = 0x1,
+  .dep_in     = { &flow_of_kcyclic_FILL_A_for_A_dep1_atline_119 },
+  .dep_out    = { &flow_of_kcyclic_FILL_A_for_A_dep2_atline_120 }
+};
+
+static inline int expr_of_cond_for_flow_of_kcyclic_FILL_A_for_C_dep1_atline_124_fct(const __parsec_kcyclic_internal_taskpool_t *__parsec_tp, const __parsec_kcyclic_FILL_A_parsec_assignment_t *locals)
+{
+  const int M = locals->M.value;
+  const int N = locals->N.value; (void)N;
+
+  (void)M;
+  (void)N;
+  (void)__parsec_tp; (void)locals;
+  return (M) == (0);
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_kcyclic_FILL_A_for_C_dep1_atline_124 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_kcyclic_FILL_A_for_C_dep1_atline_124_fct }
+                   }
+};
+static inline int ctl_gather_compute_for_dep_flow_of_kcyclic_FILL_A_for_C_dep1_atline_124_fct(const __parsec_kcyclic_internal_taskpool_t *__parsec_tp, const __parsec_kcyclic_FILL_A_parsec_assignment_t *assignments)
+{
+  int   __nb_found = 0;
+  __parsec_kcyclic_FILL_A_parsec_assignment_t __jdf2c__tmp_locals = *assignments;
+  (void)__parsec_tp;
+  const int M = __jdf2c__tmp_locals.M.value; (void)M;
+  const int N = __jdf2c__tmp_locals.N.value; (void)N;
+  (void)M; (void)N;
+  {
+    int FILL_A_M;
+    for(FILL_A_M  = 1;
+        FILL_A_M <= MT;
+        FILL_A_M += 1) {
+      int FILL_A_N = N;
+      (void)FILL_A_N;
+      __nb_found++;
+    }
+  }
+  return __nb_found;
+}
+
+static const parsec_expr_t ctl_gather_compute_for_dep_flow_of_kcyclic_FILL_A_for_C_dep1_atline_124 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)ctl_gather_compute_for_dep_flow_of_kcyclic_FILL_A_for_C_dep1_atline_124_fct }
+                   }
+};
+
+static const parsec_dep_t flow_of_kcyclic_FILL_A_for_C_dep1_atline_124 = {
+  .cond = &expr_of_cond_for_flow_of_kcyclic_FILL_A_for_C_dep1_atline_124,  /* (M) == (0) */
+  .ctl_gather_nb = &ctl_gather_compute_for_dep_flow_of_kcyclic_FILL_A_for_C_dep1_atline_124,
+  .task_class_id = 0, /* kcyclic_FILL_A */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_kcyclic_FILL_A_for_C,
+  .dep_index = 1,
+  .dep_datatype_index = 1,
+  .belongs_to = &flow_of_kcyclic_FILL_A_for_C,
+};
+static inline int expr_of_cond_for_flow_of_kcyclic_FILL_A_for_C_dep2_atline_125_fct(const __parsec_kcyclic_internal_taskpool_t *__parsec_tp, const __parsec_kcyclic_FILL_A_parsec_assignment_t *locals)
+{
+  const int M = locals->M.value;
+  const int N = locals->N.value; (void)N;
+
+  (void)M;
+  (void)N;
+  (void)__parsec_tp; (void)locals;
+  return (M) != (0);
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_kcyclic_FILL_A_for_C_dep2_atline_125 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_kcyclic_FILL_A_for_C_dep2_atline_125_fct }
+                   }
+};
+static const parsec_dep_t flow_of_kcyclic_FILL_A_for_C_dep2_atline_125 = {
+  .cond = &expr_of_cond_for_flow_of_kcyclic_FILL_A_for_C_dep2_atline_125,  /* (M) != (0) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 0, /* kcyclic_FILL_A */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_kcyclic_FILL_A_for_C,
+  .dep_index = 1,
+  .dep_datatype_index = 1,
+  .belongs_to = &flow_of_kcyclic_FILL_A_for_C,
+};
+static inline int expr_of_cond_for_flow_of_kcyclic_FILL_A_for_C_dep3_atline_126_fct(const __parsec_kcyclic_internal_taskpool_t *__parsec_tp, const __parsec_kcyclic_FILL_A_parsec_assignment_t *locals)
+{
+  const int M = locals->M.value;
+  const int N = locals->N.value; (void)N;
+
+  (void)M;
+  (void)N;
+  (void)__parsec_tp; (void)locals;
+  return (M) == (0);
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_kcyclic_FILL_A_for_C_dep3_atline_126 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_kcyclic_FILL_A_for_C_dep3_atline_126_fct }
+                   }
+};
+static const parsec_dep_t flow_of_kcyclic_FILL_A_for_C_dep3_atline_126 = {
+  .cond = &expr_of_cond_for_flow_of_kcyclic_FILL_A_for_C_dep3_atline_126,  /* (M) == (0) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 2, /* kcyclic_READ_VA */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_kcyclic_READ_VA_for_C,
+  .dep_index = 2,
+  .dep_datatype_index = 1,
+  .belongs_to = &flow_of_kcyclic_FILL_A_for_C,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+#if MAX_DEP_OUT_COUNT < 2  /* number of output dependencies */
+    #error Too many output dependencies (supports up to MAX_DEP_OUT_COUNT [=10] but found 2). Fix the code or recompile PaRSEC with a larger MAX_DEP_OUT_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_kcyclic_FILL_A_for_C = {
+  .name               = "C",
+  .sym_type           = PARSEC_SYM_INOUT,
+  .flow_flags         = PARSEC_FLOW_ACCESS_NONE|PARSEC_FLOW_HAS_IN_DEPS,
+  .flow_index         = 1,
+  .flow_datatype_mask = 0x2,
+  .dep_in     = { &flow_of_kcyclic_FILL_A_for_C_dep1_atline_124 },
+  .dep_out    = { &flow_of_kcyclic_FILL_A_for_C_dep2_atline_125,
+ &flow_of_kcyclic_FILL_A_for_C_dep3_atline_126 }
+};
+
+static void
+iterate_successors_of_kcyclic_FILL_A(parsec_execution_stream_t *es, const __parsec_kcyclic_FILL_A_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_kcyclic_internal_taskpool_t *__parsec_tp = (const __parsec_kcyclic_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_kcyclic_FILL_A_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_kcyclic_FILL_A_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int M = __jdf2c__tmp_locals.M.value; (void)M;
+  const int N = __jdf2c__tmp_locals.N.value; (void)N;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)M;  (void)N;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_dA(M, N);
+#endif
+  if( action_mask & 0x1 ) {  /* Flow of data A [0] */
+    data.data   = this_task->data._f_A.data_out;
+    data.data_future  = NULL;
+    if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_kcyclic_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_kcyclic_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+       __parsec_kcyclic_COMPARE_task_t* ncc = (__parsec_kcyclic_COMPARE_task_t*)&nc;
+    nc.task_class = __parsec_tp->super.super.task_classes_array[kcyclic_COMPARE.task_class_id];
+      const int COMPARE_M = M;
+      if( (COMPARE_M >= (0)) && (COMPARE_M <= (MT)) ) {
+        assert(&nc.locals[0].value == &ncc->locals.M.value);
+        ncc->locals.M.value = COMPARE_M;
+        const int COMPARE_N = N;
+        if( (COMPARE_N >= (0)) && (COMPARE_N <= (NT)) ) {
+          assert(&nc.locals[1].value == &ncc->locals.N.value);
+          ncc->locals.N.value = COMPARE_N;
+#if defined(DISTRIBUTED)
+          rank_dst = rank_of_dA(ncc->locals.M.value, ncc->locals.N.value);
+          if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+            vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_dA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_dA, ncc->locals.M.value, ncc->locals.N.value);
+          nc.priority = __parsec_tp->super.super.priority;
+          successor_repo = COMPARE_repo;
+          successor_repo_key = __jdf2c_make_key_COMPARE((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+        RELEASE_DEP_OUTPUT(es, "A", this_task, "A", &nc, rank_src, rank_dst, &data);
+        if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_kcyclic_FILL_A_for_A_dep2_atline_120, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+          }
+        }
+  }
+  if( action_mask & 0x6 ) {  /* Flow of data C [1] */
+    data.data   = this_task->data._f_C.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x2 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  =   /* Control: always empty */ 0;
+    data.local.dst_count  =   /* Control: always empty */ 0;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = NULL;
+    data.remote.src_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.src_count  =   /* Control: always empty */ 0;
+    data.remote.dst_count  =   /* Control: always empty */ 0;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( (M) != (0) ) {
+      __parsec_kcyclic_FILL_A_task_t* ncc = (__parsec_kcyclic_FILL_A_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[kcyclic_FILL_A.task_class_id];
+        const int FILL_A_M = 0;
+        if( (FILL_A_M >= (0)) && (FILL_A_M <= (MT)) ) {
+          assert(&nc.locals[0].value == &ncc->locals.M.value);
+          ncc->locals.M.value = FILL_A_M;
+          const int FILL_A_N = N;
+          if( (FILL_A_N >= (0)) && (FILL_A_N <= (NT)) ) {
+            assert(&nc.locals[1].value == &ncc->locals.N.value);
+            ncc->locals.N.value = FILL_A_N;
+#if defined(DISTRIBUTED)
+            rank_dst = rank_of_dA(ncc->locals.M.value, ncc->locals.N.value);
+            if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+              vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_dA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_dA, ncc->locals.M.value, ncc->locals.N.value);
+            nc.priority = __parsec_tp->super.super.priority;
+            successor_repo = FILL_A_repo;
+            successor_repo_key = __jdf2c_make_key_FILL_A((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+          RELEASE_DEP_OUTPUT(es, "C", this_task, "C", &nc, rank_src, rank_dst, &data);
+          if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_kcyclic_FILL_A_for_C_dep2_atline_125, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+            }
+          }
+    }
+  }
+  if( action_mask & 0x4 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  =   /* Control: always empty */ 0;
+    data.local.dst_count  =   /* Control: always empty */ 0;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = NULL;
+    data.remote.src_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.src_count  =   /* Control: always empty */ 0;
+    data.remote.dst_count  =   /* Control: always empty */ 0;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( (M) == (0) ) {
+      __parsec_kcyclic_READ_VA_task_t* ncc = (__parsec_kcyclic_READ_VA_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[kcyclic_READ_VA.task_class_id];
+        const int READ_VA_M = 0;
+        if( (READ_VA_M >= (0)) && (READ_VA_M <= (MT)) ) {
+          assert(&nc.locals[0].value == &ncc->locals.M.value);
+          ncc->locals.M.value = READ_VA_M;
+          const int READ_VA_N = 0;
+          if( (READ_VA_N >= (0)) && (READ_VA_N <= (NT)) ) {
+            assert(&nc.locals[1].value == &ncc->locals.N.value);
+            ncc->locals.N.value = READ_VA_N;
+#if defined(DISTRIBUTED)
+            rank_dst = rank_of_dVA(ncc->locals.M.value, ncc->locals.N.value);
+            if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+              vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_dVA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_dVA, ncc->locals.M.value, ncc->locals.N.value);
+            nc.priority = __parsec_tp->super.super.priority;
+            successor_repo = READ_VA_repo;
+            successor_repo_key = __jdf2c_make_key_READ_VA((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+          RELEASE_DEP_OUTPUT(es, "C", this_task, "C", &nc, rank_src, rank_dst, &data);
+          if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_kcyclic_FILL_A_for_C_dep3_atline_126, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+            }
+          }
+    }
+  }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static void
+iterate_predecessors_of_kcyclic_FILL_A(parsec_execution_stream_t *es, const __parsec_kcyclic_FILL_A_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_kcyclic_internal_taskpool_t *__parsec_tp = (const __parsec_kcyclic_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_kcyclic_FILL_A_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_kcyclic_FILL_A_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int M = __jdf2c__tmp_locals.M.value; (void)M;
+  const int N = __jdf2c__tmp_locals.N.value; (void)N;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)M;  (void)N;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_dA(M, N);
+#endif
+  /* Flow of data A has only OUTPUT dependencies to Memory */
+  if( action_mask & 0x2 ) {  /* Flow of data C [1] */
+    data.data   = this_task->data._f_C.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x2 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  =   /* Control: always empty */ 0;
+    data.local.dst_count  =   /* Control: always empty */ 0;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = NULL;
+    data.remote.src_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.src_count  =   /* Control: always empty */ 0;
+    data.remote.dst_count  =   /* Control: always empty */ 0;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( (M) == (0) ) {
+      __parsec_kcyclic_FILL_A_task_t* ncc = (__parsec_kcyclic_FILL_A_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[kcyclic_FILL_A.task_class_id];
+        int FILL_A_M;
+      for( FILL_A_M = 1;FILL_A_M <= MT; FILL_A_M+=1) {
+          if( (FILL_A_M >= (0)) && (FILL_A_M <= (MT)) ) {
+            assert(&nc.locals[0].value == &ncc->locals.M.value);
+            ncc->locals.M.value = FILL_A_M;
+            const int FILL_A_N = N;
+            if( (FILL_A_N >= (0)) && (FILL_A_N <= (NT)) ) {
+              assert(&nc.locals[1].value == &ncc->locals.N.value);
+              ncc->locals.N.value = FILL_A_N;
+#if defined(DISTRIBUTED)
+              rank_dst = rank_of_dA(ncc->locals.M.value, ncc->locals.N.value);
+              if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+                vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_dA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_dA, ncc->locals.M.value, ncc->locals.N.value);
+              nc.priority = __parsec_tp->super.super.priority;
+              successor_repo = FILL_A_repo;
+              successor_repo_key = __jdf2c_make_key_FILL_A((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+            RELEASE_DEP_OUTPUT(es, "C", this_task, "C", &nc, rank_src, rank_dst, &data);
+            if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_kcyclic_FILL_A_for_C_dep1_atline_124, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+              }
+            }
+          }
+    }
+  }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static int release_deps_of_kcyclic_FILL_A(parsec_execution_stream_t *es, __parsec_kcyclic_FILL_A_task_t *this_task, uint32_t action_mask, parsec_remote_deps_t *deps)
+{
+  PARSEC_PINS(es, RELEASE_DEPS_BEGIN, (parsec_task_t *)this_task);  const __parsec_kcyclic_internal_taskpool_t *__parsec_tp = (const __parsec_kcyclic_internal_taskpool_t *)this_task->taskpool;
+  parsec_release_dep_fct_arg_t arg;
+  int __vp_id;
+  int consume_local_repo = 0;
+  arg.action_mask = action_mask;
+  arg.output_entry = NULL;
+  arg.output_repo = NULL;
+#if defined(DISTRIBUTED)
+  arg.remote_deps = deps;
+#endif  /* defined(DISTRIBUTED) */
+  assert(NULL != es);
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS )    arg.ready_lists = alloca(sizeof(parsec_task_t *) * es->virtual_process->parsec_context->nb_vp);
+  else
+    arg.ready_lists = NULL;
+  for( __vp_id = 0; __vp_id < es->virtual_process->parsec_context->nb_vp; arg.ready_lists[__vp_id++] = NULL );
+  (void)__parsec_tp; (void)deps;
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_A.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_A.source_repo, this_task->data._f_A.source_repo_entry->ht_item.key );
+    }
+  }
+  consume_local_repo = (this_task->repo_entry != NULL);
+  arg.output_repo = FILL_A_repo;
+  arg.output_entry = this_task->repo_entry;
+  arg.output_usage = 0;
+  if( action_mask & (PARSEC_ACTION_RELEASE_LOCAL_DEPS | PARSEC_ACTION_GET_REPO_ENTRY) ) {
+    arg.output_entry = data_repo_lookup_entry_and_create( es, arg.output_repo, __jdf2c_make_key_FILL_A((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    arg.output_entry->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(arg.output_entry->sim_exec_date == 0);
+    arg.output_entry->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  if(action_mask & ( PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE ) ){
+    /* Generate the reshape promise for the outputs that need it */
+    iterate_successors_of_kcyclic_FILL_A(es, this_task, action_mask, parsec_set_up_reshape_promise, &arg);
+   }
+  iterate_successors_of_kcyclic_FILL_A(es, this_task, action_mask, parsec_release_dep_fct, &arg);
+
+#if defined(DISTRIBUTED)
+  if( (action_mask & PARSEC_ACTION_SEND_REMOTE_DEPS) && (NULL != arg.remote_deps)) {
+    parsec_remote_dep_activate(es, (parsec_task_t *)this_task, arg.remote_deps, arg.remote_deps->outgoing_mask);
+  }
+#endif
+
+  if(action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS) {
+    data_repo_entry_addto_usage_limit(FILL_A_repo, arg.output_entry->ht_item.key, arg.output_usage);
+    __parsec_schedule_vp(es, arg.ready_lists, 0);
+  }
+      if (consume_local_repo) {
+         data_repo_entry_used_once( FILL_A_repo, this_task->repo_entry->ht_item.key );
+      }
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_A.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_A.data_in);
+    }
+  }
+  PARSEC_PINS(es, RELEASE_DEPS_END, (parsec_task_t *)this_task);  return 0;
+}
+
+static int data_lookup_of_kcyclic_FILL_A(parsec_execution_stream_t *es, __parsec_kcyclic_FILL_A_task_t *this_task)
+{
+  const __parsec_kcyclic_internal_taskpool_t *__parsec_tp = (__parsec_kcyclic_internal_taskpool_t *)this_task->taskpool;
+  parsec_assignment_t generic_locals[MAX_PARAM_COUNT];  /* generic task locals */
+  int target_device = 0; (void)target_device;
+  (void)__parsec_tp; (void)generic_locals; (void)es;
+  parsec_data_copy_t *chunk = NULL;
+  data_repo_t        *reshape_repo  = NULL, *consumed_repo  = NULL;
+  data_repo_entry_t  *reshape_entry = NULL, *consumed_entry = NULL;
+  parsec_key_t        reshape_entry_key = 0, consumed_entry_key = 0;
+  uint8_t             consumed_flow_index;
+  parsec_dep_data_description_t data;
+  int ret;
+  (void)reshape_repo; (void)reshape_entry; (void)reshape_entry_key;
+  (void)consumed_repo; (void)consumed_entry; (void)consumed_entry_key;
+  (void)consumed_flow_index;
+  (void)chunk; (void)data; (void)ret;
+  const int M = this_task->locals.M.value; (void)M;
+  const int N = this_task->locals.N.value; (void)N;
+  if( NULL == this_task->repo_entry ){
+    this_task->repo_entry = data_repo_lookup_entry_and_create(es, FILL_A_repo,                                       __jdf2c_make_key_FILL_A((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    data_repo_entry_addto_usage_limit(FILL_A_repo, this_task->repo_entry->ht_item.key, 1);    this_task->repo_entry ->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(this_task->repo_entry ->sim_exec_date == 0);
+    this_task->repo_entry ->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  /* The reshape repo is the current task repo. */  reshape_repo = FILL_A_repo;
+  reshape_entry_key = __jdf2c_make_key_FILL_A((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals) ;
+  reshape_entry = this_task->repo_entry;
+  /* Lookup the input data, and store them in the context if any */
+
+if(! this_task->data._f_A.fulfill ){ /* Flow A */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_A.data_out = NULL;  /* By default, if nothing matches */
+  /* Flow A [0] dependency [0] from memory dA */
+  if( NULL == (chunk = this_task->data._f_A.data_in) ) {
+  /* No data set up by predecessor on this task input flow */
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+  parsec_prof_grapher_data_input(data_of_dA(M, N), (parsec_task_t*)this_task, &flow_of_kcyclic_FILL_A_for_A, 1);
+#endif
+    chunk = parsec_data_get_copy(data_of_dA(M, N), target_device);
+    data.data = chunk;
+    data.data_future  = NULL;
+        data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.data_future   = NULL;
+    if( (ret = parsec_get_copy_reshape_from_desc(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    this_task->data._f_A.data_out = chunk;
+    PARSEC_OBJ_RETAIN(chunk);
+  } 
+    this_task->data._f_A.data_in     = chunk;
+    this_task->data._f_A.source_repo       = consumed_repo;
+    this_task->data._f_A.source_repo_entry = consumed_entry;
+    if( this_task->data._f_A.source_repo_entry == this_task->repo_entry ){
+      /* in case we have consume from this task repo entry for the flow,
+       * it is cleaned up, avoiding having old stuff during release_deps_of
+       */
+      this_task->repo_entry->data[0] = NULL;
+    }
+    this_task->data._f_A.fulfill = 1;
+}
+
+  /* C is a control flow */
+  this_task->data._f_C.data_in         = NULL;
+  this_task->data._f_C.data_out        = NULL;
+  this_task->data._f_C.source_repo       = NULL;
+  this_task->data._f_C.source_repo_entry = NULL;
+  /** Generate profiling information */
+#if defined(PARSEC_PROF_TRACE)
+  this_task->prof_info.desc = (parsec_data_collection_t*)__parsec_tp->super._g_dA;
+  this_task->prof_info.priority = this_task->priority;
+  this_task->prof_info.data_id   = ((parsec_data_collection_t*)__parsec_tp->super._g_dA)->data_key((parsec_data_collection_t*)__parsec_tp->super._g_dA, M, N);
+  this_task->prof_info.task_class_id = this_task->task_class->task_class_id;
+  this_task->prof_info.task_return_code = -1;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int datatype_lookup_of_kcyclic_FILL_A(parsec_execution_stream_t *es, const parsec_task_t *this_generic_task, const parsec_task_t *parent_task,
+              uint32_t* flow_mask, parsec_dep_data_description_t* data)
+{
+  const __parsec_kcyclic_FILL_A_task_t *this_task = (__parsec_kcyclic_FILL_A_task_t*)this_generic_task;
+  const __parsec_kcyclic_internal_taskpool_t *__parsec_tp = (__parsec_kcyclic_internal_taskpool_t *)this_task->taskpool;
+  (void)__parsec_tp; (void)es; (void)this_task; (void)data; (void)parent_task;
+  const int M = this_task->locals.M.value; (void)M;
+  const int N = this_task->locals.N.value; (void)N;
+  data->local.arena = data->remote.arena = NULL;
+  data->local.src_datatype  = data->local.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->local.src_count     = data->local.dst_count = 0;
+  data->local.src_displ     = data->local.dst_displ = 0;
+  data->data_future  = NULL;
+  if( (*flow_mask) & 0x80000000U ) { /* these are the input dependencies remote datatypes  */
+if( (*flow_mask) & 0x1U ) {  /* Flow A */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_kcyclic_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_kcyclic_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_kcyclic_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+    goto no_mask_match;
+  }
+
+  /* these are the output dependencies remote datatypes */
+if( (*flow_mask) & 0x1U ) {  /* Flow A */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_kcyclic_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_kcyclic_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_kcyclic_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+ no_mask_match:
+  data->data                             = NULL;
+  data->remote.src_datatype = data->remote.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->remote.src_count    = data->remote.dst_count = 0;
+  data->remote.src_displ    = data->remote.dst_displ = 0;
+  data->data_future  = NULL;
+  (*flow_mask) = 0;  /* nothing left */
+  (void)M;  (void)N;
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+static int hook_of_kcyclic_FILL_A(parsec_execution_stream_t *es, __parsec_kcyclic_FILL_A_task_t *this_task)
+{
+  __parsec_kcyclic_internal_taskpool_t *__parsec_tp = (__parsec_kcyclic_internal_taskpool_t *)this_task->taskpool;
+  (void)es; (void)__parsec_tp;
+  const int M = this_task->locals.M.value; (void)M;
+  const int N = this_task->locals.N.value; (void)N;
+  (void)M;  (void)N;
+
+  /** Declare the variables that will hold the data, and all the accounting for each */
+  parsec_data_copy_t *_f_A = this_task->data._f_A.data_in;
+  void *A = PARSEC_DATA_COPY_GET_PTR(_f_A); (void)A;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    data_repo_entry_t *eA = this_task->data._f_A.source_repo_entry;
+    if( (NULL != eA) && (eA->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eA->sim_exec_date;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+    if ( NULL != _f_A ) {
+#if defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) || defined(PARSEC_HAVE_DEV_HIP_SUPPORT)
+      parsec_data_transfer_ownership_to_copy( _f_A->original, 0 /* device */,
+                                           PARSEC_FLOW_ACCESS_RW);
+#endif  /* defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) || defined(PARSEC_HAVE_DEV_HIP_SUPPORT) */
+      _f_A->version++;  /* A */
+#if defined(PARSEC_DEBUG_NOISIER)
+      char tmp[128];
+      PARSEC_DEBUG_VERBOSE(10, parsec_debug_output,
+                           "Body of %s: change Data copy %p to version %d",
+                           parsec_task_snprintf(tmp, 128, (parsec_task_t*)(this_task)),
+                           _f_A, _f_A->version);
+#endif /* defined(PARSEC_DEBUG_NOISIER) */
+    }
+  /** Cache Awareness Accounting */
+#if defined(PARSEC_CACHE_AWARENESS)
+  cache_buf_referenced(es->closest_cache, A);
+#endif /* PARSEC_CACHE_AWARENESS */
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                                  FILL_A BODY                                  -----*/
+
+    int *a = A;
+    parsec_data_collection_t* dc = &dA->super.super;
+    a[0] = M;
+    a[1] = N;
+    a[2] = dc->rank_of(dc, M, N);
+
+/*-----                              END OF FILL_A BODY                              -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#endif  /*  defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+static int complete_hook_of_kcyclic_FILL_A(parsec_execution_stream_t *es, __parsec_kcyclic_FILL_A_task_t *this_task)
+{
+  const __parsec_kcyclic_internal_taskpool_t *__parsec_tp = (__parsec_kcyclic_internal_taskpool_t *)this_task->taskpool;
+#if defined(DISTRIBUTED)
+    const int M = this_task->locals.M.value; (void)M;
+  const int N = this_task->locals.N.value; (void)N;
+#endif  /* defined(DISTRIBUTED) */
+  (void)es; (void)__parsec_tp;
+parsec_data_t* data_t_desc = NULL; (void)data_t_desc;
+#if defined(DISTRIBUTED)
+  /** If not working on distributed, there is no risk that data is not in place */
+  (void)M;  (void)N;
+
+#endif /* DISTRIBUTED */
+#if defined(PARSEC_PROF_GRAPHER)
+  parsec_prof_grapher_task((parsec_task_t*)this_task, es->th_id, es->virtual_process->vp_id,
+     __jdf2c_key_fns_FILL_A.key_hash(this_task->task_class->make_key( (parsec_taskpool_t*)this_task->taskpool, ((parsec_task_t*)this_task)->locals), NULL));
+#endif  /* defined(PARSEC_PROF_GRAPHER) */
+  release_deps_of_kcyclic_FILL_A(es, this_task,
+      PARSEC_ACTION_RELEASE_REMOTE_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_REFS |
+      PARSEC_ACTION_RESHAPE_ON_RELEASE |
+      0x7,  /* mask of all dep_index */ 
+      NULL);
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static parsec_hook_return_t release_task_of_kcyclic_FILL_A(parsec_execution_stream_t *es, parsec_task_t *this_task)
+{
+    const __parsec_kcyclic_internal_taskpool_t *__parsec_tp =
+        (const __parsec_kcyclic_internal_taskpool_t *)this_task->taskpool;
+    parsec_hash_table_t *ht = (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[0];
+    parsec_key_t key = this_task->task_class->make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals);
+    parsec_hashable_dependency_t *hash_dep = (parsec_hashable_dependency_t *)parsec_hash_table_remove(ht, key);
+    parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);
+    return parsec_release_task_to_mempool_update_nbtasks(es, this_task);
+}
+
+static char *kcyclic_kcyclic_FILL_A_internal_init_deps_key_functions_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_kcyclic_internal_taskpool_t *__parsec_tp = (__parsec_kcyclic_internal_taskpool_t *)user_data;
+  int M = (__parsec_key) % __parsec_tp->FILL_A_M_range + __parsec_tp->FILL_A_M_min;
+  __parsec_key = __parsec_key / __parsec_tp->FILL_A_M_range;
+  int N = (__parsec_key) % __parsec_tp->FILL_A_N_range + __parsec_tp->FILL_A_N_min;
+  __parsec_key = __parsec_key / __parsec_tp->FILL_A_N_range;
+  snprintf(buffer, buffer_size, "FILL_A(%d, %d)", M, N);
+  return buffer;
+}
+
+static parsec_key_fn_t kcyclic_kcyclic_FILL_A_internal_init_deps_key_functions = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = kcyclic_kcyclic_FILL_A_internal_init_deps_key_functions_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/* Needs: min-max count-tasks iterate */
+static int kcyclic_FILL_A_internal_init(parsec_execution_stream_t * es, __parsec_kcyclic_FILL_A_task_t * this_task)
+{
+  __parsec_kcyclic_internal_taskpool_t *__parsec_tp = (__parsec_kcyclic_internal_taskpool_t*)this_task->taskpool;
+  int32_t nb_tasks = 0, saved_nb_tasks = 0;
+int32_t __M_min = 0x7fffffff, __M_max = 0;int32_t __jdf2c_M_min = 0x7fffffff, __jdf2c_M_max = 0;int32_t __N_min = 0x7fffffff, __N_max = 0;int32_t __jdf2c_N_min = 0x7fffffff, __jdf2c_N_max = 0;  __parsec_kcyclic_FILL_A_parsec_assignment_t assignments = {  .M.value = 0, .N.value = 0 };
+  int32_t  M,  N;
+  int32_t __jdf2c_M_start, __jdf2c_M_end, __jdf2c_M_inc;
+  int32_t __jdf2c_N_start, __jdf2c_N_end, __jdf2c_N_inc;
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+  PARSEC_PROFILING_TRACE(es->es_profile,
+                         this_task->taskpool->profiling_array[START_KEY(this_task->task_class->task_class_id)],
+                         0,
+                         this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    __jdf2c_M_start = 0;
+    __jdf2c_M_end = MT;
+    __jdf2c_M_inc = 1;
+    __M_min = parsec_imin(__jdf2c_M_start, __jdf2c_M_end);
+    __M_max = parsec_imax(__jdf2c_M_start, __jdf2c_M_end);
+    __jdf2c_M_min = parsec_imin(__jdf2c_M_min, __M_min);
+    __jdf2c_M_max = parsec_imax(__jdf2c_M_max, __M_max);
+    for(M =  __jdf2c_M_start;
+        M <= __jdf2c_M_end;
+        M += __jdf2c_M_inc) {
+    assignments.M.value = M;
+      __jdf2c_N_start = 0;
+      __jdf2c_N_end = NT;
+      __jdf2c_N_inc = 1;
+      __N_min = parsec_imin(__jdf2c_N_start, __jdf2c_N_end);
+      __N_max = parsec_imax(__jdf2c_N_start, __jdf2c_N_end);
+      __jdf2c_N_min = parsec_imin(__jdf2c_N_min, __N_min);
+      __jdf2c_N_max = parsec_imax(__jdf2c_N_max, __N_max);
+      for(N =  __jdf2c_N_start;
+          N <= __jdf2c_N_end;
+          N += __jdf2c_N_inc) {
+      assignments.N.value = N;
+      if( !FILL_A_pred(M, N) ) continue;
+      nb_tasks++;
+    } /* Loop on normal range N */
+  } /* For loop of M */ 
+   if( 0 != nb_tasks ) {
+     (void)parsec_atomic_fetch_add_int32(&__parsec_tp->initial_number_tasks, nb_tasks);
+   }
+  /* Set the range variables for the collision-free hash-computation */
+  __parsec_tp->FILL_A_M_min   = __jdf2c_M_min;
+  __parsec_tp->FILL_A_M_range = (__jdf2c_M_max - __jdf2c_M_min) + 1;
+  __parsec_tp->FILL_A_N_min   = __jdf2c_N_min;
+  __parsec_tp->FILL_A_N_range = (__jdf2c_N_max - __jdf2c_N_min) + 1;
+    do {
+      this_task->super.list_next = (parsec_list_item_t*)__parsec_tp->startup_queue;
+    } while(!parsec_atomic_cas_ptr(&__parsec_tp->startup_queue, (parsec_list_item_t*)this_task->super.list_next, this_task));
+    this_task->status = PARSEC_TASK_STATUS_HOOK;
+
+  PARSEC_AYU_REGISTER_TASK(&kcyclic_FILL_A);
+  __parsec_tp->super.super.dependencies_array[0] = PARSEC_OBJ_NEW(parsec_hash_table_t);
+  parsec_hash_table_init(__parsec_tp->super.super.dependencies_array[0], offsetof(parsec_hashable_dependency_t, ht_item), 10, kcyclic_kcyclic_FILL_A_internal_init_deps_key_functions, this_task->taskpool);
+  __parsec_tp->repositories[0] = data_repo_create_nothreadsafe(nb_tasks, __jdf2c_key_fns_FILL_A, (parsec_taskpool_t*)__parsec_tp, 2);
+(void)saved_nb_tasks;
+(void)__M_min; (void)__M_max;(void)__N_min; (void)__N_max;  (void)__jdf2c_M_start; (void)__jdf2c_M_end; (void)__jdf2c_M_inc;  (void)__jdf2c_N_start; (void)__jdf2c_N_end; (void)__jdf2c_N_inc;  (void)assignments; (void)__parsec_tp; (void)es;
+  if(1 == parsec_atomic_fetch_dec_int32(&__parsec_tp->sync_point)) {
+    /* Last initialization task complete. Update the number of tasks. */
+    __parsec_tp->super.super.tdm.module->taskpool_addto_nb_tasks(&__parsec_tp->super.super, __parsec_tp->initial_number_tasks);
+    parsec_mfence();  /* write memory barrier to guarantee that the scheduler gets the correct number of tasks */
+    parsec_taskpool_enable((parsec_taskpool_t*)__parsec_tp, &__parsec_tp->startup_queue,
+                           (parsec_task_t*)this_task, es, __parsec_tp->super.super.nb_pending_actions);
+    __parsec_tp->super.super.tdm.module->taskpool_ready(&__parsec_tp->super.super);
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+    PARSEC_PROFILING_TRACE(es->es_profile,
+                           this_task->taskpool->profiling_array[2 * this_task->task_class->task_class_id + 1],
+                           0,
+                           this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    if( 1 >= __parsec_tp->super.super.nb_pending_actions ) {
+        /* if no tasks will be generated let's prevent the runtime from calling the hook and instead go directly to complete the task */
+        this_task->status = PARSEC_TASK_STATUS_COMPLETE;
+    }
+    return PARSEC_HOOK_RETURN_DONE;
+  }
+  return PARSEC_HOOK_RETURN_ASYNC;
+}
+
+static int __jdf2c_startup_FILL_A(parsec_execution_stream_t * es, __parsec_kcyclic_FILL_A_task_t *this_task)
+{
+  __parsec_kcyclic_FILL_A_task_t* new_task;
+  __parsec_kcyclic_internal_taskpool_t* __parsec_tp = (__parsec_kcyclic_internal_taskpool_t*)this_task->taskpool;
+  parsec_context_t *context = __parsec_tp->super.super.context;
+  int vpid = 0, nb_tasks = 0;
+  size_t total_nb_tasks = 0;
+  parsec_list_item_t* pready_ring[context->nb_vp];
+  int restore_context = 0;
+  int M = this_task->locals.M.value;  /* retrieve value saved during the last iteration */
+  int N = this_task->locals.N.value;  /* retrieve value saved during the last iteration */
+  for(int _i = 0; _i < context->nb_vp; pready_ring[_i++] = NULL );
+  if( 0 != this_task->locals.reserved[0].value ) {
+    this_task->locals.reserved[0].value = 1; /* reset the submission process */
+    restore_context = 1;
+    goto restore_context_0;
+  }
+  this_task->locals.reserved[0].value = 1; /* a sane default value */
+  for(this_task->locals.M.value = M = 0;
+      this_task->locals.M.value <= MT;
+      this_task->locals.M.value += 1, M = this_task->locals.M.value) {
+    for(this_task->locals.N.value = N = 0;
+        this_task->locals.N.value <= NT;
+        this_task->locals.N.value += 1, N = this_task->locals.N.value) {
+      if( !FILL_A_pred(M, N) ) continue;
+  __parsec_kcyclic_FILL_A_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_kcyclic_FILL_A_parsec_assignment_t*)&this_task->locals;
+  (void)__jdf2c__tmp_locals;
+  /* Flow for A is always a memory reference */
+  if( (M) == (0) ) continue; /* C FILL_A() is not a memory reference for flow C */
+      if( NULL != ((parsec_data_collection_t*)__parsec_tp->super._g_dA)->vpid_of ) {
+        vpid = ((parsec_data_collection_t*)__parsec_tp->super._g_dA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_dA, M, N);
+        assert(context->nb_vp >= vpid);
+      } else {
+        vpid = (vpid + 1) % context->nb_vp;  /* spread the initial joy */
+      }
+      new_task = (__parsec_kcyclic_FILL_A_task_t*)parsec_thread_mempool_allocate( context->virtual_processes[vpid]->execution_streams[0]->context_mempool );
+      PARSEC_OBJ_CONSTRUCT(new_task, parsec_task_t); /* construct called only when new, force-construct it again */
+      /* Copy only the valid elements from this_task to new_task one */
+      new_task->taskpool   = this_task->taskpool;
+      new_task->task_class = __parsec_tp->super.super.task_classes_array[kcyclic_FILL_A.task_class_id];
+      new_task->chore_mask   = PARSEC_DEV_ALL;
+      new_task->locals.M.value = this_task->locals.M.value;
+      new_task->locals.N.value = this_task->locals.N.value;
+      PARSEC_LIST_ITEM_SINGLETON(new_task);
+      new_task->priority = __parsec_tp->super.super.priority;
+      new_task->repo_entry = NULL;
+      new_task->data._f_A.source_repo_entry = NULL;
+      new_task->data._f_A.source_repo       = NULL;
+      new_task->data._f_A.data_in         = NULL;
+      new_task->data._f_A.data_out        = NULL;
+      new_task->data._f_A.fulfill         = 0;
+      new_task->data._f_C.source_repo_entry = NULL;
+      new_task->data._f_C.source_repo       = NULL;
+      new_task->data._f_C.data_in         = NULL;
+      new_task->data._f_C.data_out        = NULL;
+      new_task->data._f_C.fulfill         = 0;
+#if defined(PARSEC_DEBUG_NOISIER)
+      {
+        char tmp[128];
+        PARSEC_DEBUG_VERBOSE(10, parsec_debug_output, "Add startup task %s to vpid %d",
+               parsec_task_snprintf(tmp, 128, (parsec_task_t*)new_task), vpid);
+      }
+#endif
+      parsec_dependencies_mark_task_as_startup((parsec_task_t*)new_task, es);
+      pready_ring[vpid] = parsec_list_item_ring_push_sorted(pready_ring[vpid],
+                                                            (parsec_list_item_t*)new_task,
+                                                            parsec_execution_context_priority_comparator);
+      nb_tasks++;
+     restore_context_0:  /* we jump here just so that we have code after the label */
+      restore_context = 0;
+      (void)restore_context;
+      if( nb_tasks > this_task->locals.reserved[0].value ) {
+        if( (size_t)this_task->locals.reserved[0].value < parsec_task_startup_iter ) this_task->locals.reserved[0].value <<= 1;
+        __parsec_schedule_vp(es, (parsec_task_t**)pready_ring, 0);
+        total_nb_tasks += nb_tasks;
+        nb_tasks = 0;
+        if( total_nb_tasks > parsec_task_startup_chunk ) {  /* stop here and request to be rescheduled */
+          return PARSEC_HOOK_RETURN_AGAIN;
+        }
+      }
+    } /* Loop on normal range N */
+  } /* Loop on normal range M */
+  (void)vpid;
+  if( 0 != nb_tasks ) {
+    __parsec_schedule_vp(es, (parsec_task_t**)pready_ring, 0);
+    nb_tasks = 0;
+  }
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static const __parsec_chore_t __kcyclic_FILL_A_chores[] ={
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+    { .type     = PARSEC_DEV_CPU,
+      .evaluate = (parsec_evaluate_function_t*)NULL,
+      .hook     = (parsec_hook_t*)hook_of_kcyclic_FILL_A },
+#endif  /* defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+    { .type     = PARSEC_DEV_NONE,
+      .evaluate = NULL,
+      .hook     = (parsec_hook_t*)NULL },  /* End marker */
+};
+
+static const parsec_task_class_t kcyclic_FILL_A = {
+  .name = "FILL_A",
+  .task_class_id = 0,
+  .nb_flows = 2,
+  .nb_parameters = 2,
+  .nb_locals = 2,
+  .task_class_type = PARSEC_TASK_CLASS_TYPE_PTG,
+  .params = { &symb_kcyclic_FILL_A_M, &symb_kcyclic_FILL_A_N, NULL },
+  .locals = { &symb_kcyclic_FILL_A_M, &symb_kcyclic_FILL_A_N, NULL },
+  .data_affinity = (parsec_data_ref_fn_t*)affinity_of_kcyclic_FILL_A,
+  .initial_data = (parsec_data_ref_fn_t*)affinity_of_kcyclic_FILL_A,
+  .final_data = (parsec_data_ref_fn_t*)affinity_of_kcyclic_FILL_A,
+  .priority = NULL,
+  .properties = properties_of_kcyclic_FILL_A,
+#if MAX_PARAM_COUNT < 1  /* number of read flows of FILL_A */
+  #error Too many read flows for task FILL_A
+#endif  /* MAX_PARAM_COUNT */
+#if MAX_PARAM_COUNT < 1  /* number of write flows of FILL_A */
+  #error Too many write flows for task FILL_A
+#endif  /* MAX_PARAM_COUNT */
+  .in = { &flow_of_kcyclic_FILL_A_for_A, &flow_of_kcyclic_FILL_A_for_C, NULL },
+  .out = { &flow_of_kcyclic_FILL_A_for_A, &flow_of_kcyclic_FILL_A_for_C, NULL },
+  .flags = 0x0 | PARSEC_HAS_IN_IN_DEPENDENCIES|PARSEC_HAS_CTL_GATHER,
+  .dependencies_goal = 2,
+  .make_key = __jdf2c_make_key_FILL_A,
+  .task_snprintf = parsec_task_snprintf,
+#if defined(PARSEC_PROF_TRACE)
+  .profile_info = &parsec_task_profile_info,
+#endif
+  .key_functions = &__jdf2c_key_fns_FILL_A,
+  .fini = (parsec_hook_t*)NULL,
+  .incarnations = __kcyclic_FILL_A_chores,
+  .find_deps = parsec_hash_find_deps,
+  .update_deps = parsec_update_deps_with_counter,
+  .iterate_successors = (parsec_traverse_function_t*)iterate_successors_of_kcyclic_FILL_A,
+  .iterate_predecessors = (parsec_traverse_function_t*)iterate_predecessors_of_kcyclic_FILL_A,
+  .release_deps = (parsec_release_deps_t*)release_deps_of_kcyclic_FILL_A,
+  .prepare_output = (parsec_hook_t*)NULL,
+  .prepare_input = (parsec_hook_t*)data_lookup_of_kcyclic_FILL_A,
+  .time_estimate = NULL,
+  .get_datatype = datatype_lookup_of_kcyclic_FILL_A,
+  .complete_execution = (parsec_hook_t*)complete_hook_of_kcyclic_FILL_A,
+  .release_task = &release_task_of_kcyclic_FILL_A,
+#if defined(PARSEC_SIM)
+  .sim_cost_fct = (parsec_sim_cost_fct_t*)NULL,
+#endif
+};
+
+
+static const parsec_task_class_t *kcyclic_task_classes[] = {
+  &kcyclic_FILL_A,
+  &kcyclic_FILL_CA,
+  &kcyclic_READ_VA,
+  &kcyclic_COMPARE
+};
+
+static void kcyclic_startup(parsec_context_t *context, __parsec_kcyclic_internal_taskpool_t *__parsec_tp, parsec_list_item_t ** ready_tasks)
+{
+  uint32_t i, supported_dev = 0;
+ 
+  for( i = 0; i < parsec_nb_devices; i++ ) {
+    if( !(__parsec_tp->super.super.devices_index_mask & (1<<i)) ) continue;
+    parsec_device_module_t* device = parsec_mca_device_get(i);
+    parsec_data_collection_t* parsec_dc;
+ 
+    if(NULL == device) continue;
+    if(NULL != device->taskpool_register)
+      if( PARSEC_SUCCESS != device->taskpool_register(device, (parsec_taskpool_t*)__parsec_tp) ) {
+        parsec_debug_verbose(5, parsec_debug_output, "Device %s refused to register taskpool %p", device->name, __parsec_tp);
+        __parsec_tp->super.super.devices_index_mask &= ~(1 << device->device_index);
+        continue;
+      }
+    if(NULL != device->memory_register) {  /* Register all the data */
+      parsec_dc = (parsec_data_collection_t*)__parsec_tp->super._g_dA;
+      if( (NULL != parsec_dc->register_memory) &&
+          (PARSEC_SUCCESS != parsec_dc->register_memory(parsec_dc, device)) ) {
+        parsec_debug_verbose(3, parsec_debug_output, "Device %s refused to register memory for data %s (%p) from taskpool %p",
+                     device->name, parsec_dc->key_base, parsec_dc, __parsec_tp);
+        __parsec_tp->super.super.devices_index_mask &= ~(1 << device->device_index);
+      }
+      parsec_dc = (parsec_data_collection_t*)__parsec_tp->super._g_dVA;
+      if( (NULL != parsec_dc->register_memory) &&
+          (PARSEC_SUCCESS != parsec_dc->register_memory(parsec_dc, device)) ) {
+        parsec_debug_verbose(3, parsec_debug_output, "Device %s refused to register memory for data %s (%p) from taskpool %p",
+                     device->name, parsec_dc->key_base, parsec_dc, __parsec_tp);
+        __parsec_tp->super.super.devices_index_mask &= ~(1 << device->device_index);
+      }
+      parsec_dc = (parsec_data_collection_t*)__parsec_tp->super._g_dCA;
+      if( (NULL != parsec_dc->register_memory) &&
+          (PARSEC_SUCCESS != parsec_dc->register_memory(parsec_dc, device)) ) {
+        parsec_debug_verbose(3, parsec_debug_output, "Device %s refused to register memory for data %s (%p) from taskpool %p",
+                     device->name, parsec_dc->key_base, parsec_dc, __parsec_tp);
+        __parsec_tp->super.super.devices_index_mask &= ~(1 << device->device_index);
+      }
+    }
+    supported_dev |= device->type;
+  }
+  /* Remove all the chores without a backend device */
+  for( i = 0; i < PARSEC_kcyclic_NB_TASK_CLASSES; i++ ) {
+    parsec_task_class_t* tc = (parsec_task_class_t*)__parsec_tp->super.super.task_classes_array[i];
+    __parsec_chore_t* chores = (__parsec_chore_t*)tc->incarnations;
+    uint32_t idx = 0, j;
+    for( j = 0; PARSEC_DEV_NONE != chores[j].type; j++ ) {
+      if( !(supported_dev & chores[j].type) ) continue;
+      if( j != idx ) {
+        chores[idx] = chores[j];
+        parsec_debug_verbose(20, parsec_debug_output, "Device type %i disabled for function %s"
+, chores[j].type, tc->name);
+      }
+      idx++;
+    }
+    chores[idx].type     = PARSEC_DEV_NONE;
+    chores[idx].evaluate = NULL;
+    chores[idx].hook     = NULL;
+    /* Create the initialization tasks for each taskclass */
+    parsec_task_t* task = (parsec_task_t*)parsec_thread_mempool_allocate(context->virtual_processes[0]->execution_streams[0]->context_mempool);
+    PARSEC_OBJ_CONSTRUCT(task, parsec_task_t); /* construct called only when new, force-construct it again */
+    task->taskpool = (parsec_taskpool_t *)__parsec_tp;
+    task->chore_mask = PARSEC_DEV_CPU;
+    memset(&task->locals, 0, sizeof(parsec_assignment_t) * MAX_LOCAL_COUNT);
+    PARSEC_LIST_ITEM_SINGLETON(task);
+    task->priority = -1;
+    task->task_class = task->taskpool->task_classes_array[PARSEC_kcyclic_NB_TASK_CLASSES + i];
+    int where = i % context->nb_vp;
+    if( NULL == ready_tasks[where] ) ready_tasks[where] = &task->super;
+    else ready_tasks[where] = parsec_list_item_ring_push(ready_tasks[where], &task->super);
+  }
+}
+static void __parsec_kcyclic_internal_destructor( __parsec_kcyclic_internal_taskpool_t *__parsec_tp )
+{
+  uint32_t i;
+  parsec_taskpool_unregister( &__parsec_tp->super.super );
+  if(NULL != __parsec_tp->super.super.tdm.module) __parsec_tp->super.super.tdm.module->unmonitor_taskpool(&__parsec_tp->super.super);
+  for( i = 0; i < (uint32_t)(2 * __parsec_tp->super.super.nb_task_classes); i++ ) {  /* Extra startup function added at the end */
+    parsec_task_class_t* tc = (parsec_task_class_t*)__parsec_tp->super.super.task_classes_array[i];
+    free((void*)tc->incarnations);
+    free(tc);
+  }
+  free(__parsec_tp->super.super.task_classes_array); __parsec_tp->super.super.task_classes_array = NULL;
+  __parsec_tp->super.super.nb_task_classes = 0;
+
+  for(i = 0; i < (uint32_t)__parsec_tp->super.arenas_datatypes_size; i++) {
+    if( NULL != __parsec_tp->super.arenas_datatypes[i].arena ) {
+      PARSEC_OBJ_RELEASE(__parsec_tp->super.arenas_datatypes[i].arena);
+    }
+  }
+  /* Destroy the data repositories for this object */
+   data_repo_destroy_nothreadsafe(__parsec_tp->repositories[3]);  /* COMPARE */
+   data_repo_destroy_nothreadsafe(__parsec_tp->repositories[2]);  /* READ_VA */
+   data_repo_destroy_nothreadsafe(__parsec_tp->repositories[1]);  /* FILL_CA */
+   data_repo_destroy_nothreadsafe(__parsec_tp->repositories[0]);  /* FILL_A */
+  /* Release the dependencies arrays for this object */
+  parsec_hash_table_fini( (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[3] );
+  PARSEC_OBJ_RELEASE(__parsec_tp->super.super.dependencies_array[3]);
+  __parsec_tp->super.super.dependencies_array[3] = NULL;
+  parsec_hash_table_fini( (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[2] );
+  PARSEC_OBJ_RELEASE(__parsec_tp->super.super.dependencies_array[2]);
+  __parsec_tp->super.super.dependencies_array[2] = NULL;
+  parsec_hash_table_fini( (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[1] );
+  PARSEC_OBJ_RELEASE(__parsec_tp->super.super.dependencies_array[1]);
+  __parsec_tp->super.super.dependencies_array[1] = NULL;
+  parsec_hash_table_fini( (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[0] );
+  PARSEC_OBJ_RELEASE(__parsec_tp->super.super.dependencies_array[0]);
+  __parsec_tp->super.super.dependencies_array[0] = NULL;
+  free( __parsec_tp->super.super.dependencies_array );
+  __parsec_tp->super.super.dependencies_array = NULL;
+  /* Unregister all the data */
+  uint32_t _i;
+  for( _i = 0; _i < parsec_nb_devices; _i++ ) {
+    parsec_device_module_t* device;
+    parsec_data_collection_t* parsec_dc;
+    if(!(__parsec_tp->super.super.devices_index_mask & (1 << _i))) continue;
+    if((NULL == (device = parsec_mca_device_get(_i))) || (NULL == device->memory_unregister)) continue;
+    parsec_dc = (parsec_data_collection_t*)__parsec_tp->super._g_dA;
+  if( NULL != parsec_dc->unregister_memory ) { (void)parsec_dc->unregister_memory(parsec_dc, device); };
+  parsec_dc = (parsec_data_collection_t*)__parsec_tp->super._g_dVA;
+  if( NULL != parsec_dc->unregister_memory ) { (void)parsec_dc->unregister_memory(parsec_dc, device); };
+  parsec_dc = (parsec_data_collection_t*)__parsec_tp->super._g_dCA;
+  if( NULL != parsec_dc->unregister_memory ) { (void)parsec_dc->unregister_memory(parsec_dc, device); };
+}
+  /* Unregister the taskpool from the devices */
+  for( i = 0; i < parsec_nb_devices; i++ ) {
+    if(!(__parsec_tp->super.super.devices_index_mask & (1 << i))) continue;
+    __parsec_tp->super.super.devices_index_mask ^= (1 << i);
+    parsec_device_module_t* device = parsec_mca_device_get(i);
+    if((NULL == device) || (NULL == device->taskpool_unregister)) continue;
+    if( PARSEC_SUCCESS != device->taskpool_unregister(device, &__parsec_tp->super.super) ) continue;
+  }
+  free(__parsec_tp->super.super.taskpool_name); __parsec_tp->super.super.taskpool_name = NULL;
+}
+
+void __parsec_kcyclic_internal_constructor(__parsec_kcyclic_internal_taskpool_t* __parsec_tp)
+{
+  parsec_task_class_t* tc;
+  uint32_t i, j;
+
+  __parsec_tp->super.super.nb_task_classes = PARSEC_kcyclic_NB_TASK_CLASSES;
+  __parsec_tp->super.super.devices_index_mask = PARSEC_DEVICES_ALL;
+  __parsec_tp->super.super.taskpool_name = strdup("kcyclic");
+  parsec_termdet_open_module(&__parsec_tp->super.super, "local");
+  __parsec_tp->super.super.tdm.module->monitor_taskpool(&__parsec_tp->super.super,
+                                                        parsec_taskpool_termination_detected);
+  __parsec_tp->super.super.update_nb_runtime_task = parsec_add_fetch_runtime_task;
+  __parsec_tp->super.super.dependencies_array = (void **)
+              calloc(__parsec_tp->super.super.nb_task_classes, sizeof(void*));
+  /* Twice the size to hold the startup tasks function_t */
+  __parsec_tp->super.super.task_classes_array = (const parsec_task_class_t**)
+              calloc((2 * PARSEC_kcyclic_NB_TASK_CLASSES + 1), sizeof(parsec_task_class_t*));
+  __parsec_tp->super.super.tdm.module->taskpool_addto_runtime_actions(&__parsec_tp->super.super, PARSEC_kcyclic_NB_TASK_CLASSES);  /* for the startup tasks */
+  __parsec_tp->super.super.taskpool_type = PARSEC_TASKPOOL_TYPE_PTG;
+  __parsec_tp->sync_point = __parsec_tp->super.super.nb_task_classes;
+  __parsec_tp->initial_number_tasks = 0;
+  __parsec_tp->startup_queue = NULL;
+  for( i = 0; i < __parsec_tp->super.super.nb_task_classes; i++ ) {
+    __parsec_tp->super.super.task_classes_array[i] = tc = malloc(sizeof(parsec_task_class_t));
+    memcpy(tc, kcyclic_task_classes[i], sizeof(parsec_task_class_t));
+    for( j = 0; PARSEC_DEV_NONE != tc->incarnations[j].type; j++);  /* compute the number of incarnations */
+    tc->incarnations = (__parsec_chore_t*)malloc((j+1) * sizeof(__parsec_chore_t));
+        memcpy((__parsec_chore_t*)tc->incarnations, kcyclic_task_classes[i]->incarnations, (j+1) * sizeof(__parsec_chore_t));
+
+    /* Add a placeholder for initialization and startup task */
+    __parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+i] = tc = (parsec_task_class_t*)malloc(sizeof(parsec_task_class_t));
+    memcpy(tc, (void*)&__parsec_generic_startup, sizeof(parsec_task_class_t));
+    tc->task_class_id = __parsec_tp->super.super.nb_task_classes + i;
+    tc->incarnations = (__parsec_chore_t*)malloc(2 * sizeof(__parsec_chore_t));
+    memcpy((__parsec_chore_t*)tc->incarnations, (void*)__parsec_generic_startup.incarnations, 2 * sizeof(__parsec_chore_t));
+    tc->release_task = parsec_release_task_to_mempool_and_count_as_runtime_tasks;
+  }
+  /* Startup task for COMPARE */
+  tc = (parsec_task_class_t *)__parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+0];
+  tc->name = "Startup for COMPARE";
+  tc->prepare_input = (parsec_hook_t*)kcyclic_COMPARE_internal_init;
+  /* Startup task for READ_VA */
+  tc = (parsec_task_class_t *)__parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+1];
+  tc->name = "Startup for READ_VA";
+  tc->prepare_input = (parsec_hook_t*)kcyclic_READ_VA_internal_init;
+  ((__parsec_chore_t*)&tc->incarnations[0])->hook = (parsec_hook_t *)__jdf2c_startup_READ_VA;
+  /* Startup task for FILL_CA */
+  tc = (parsec_task_class_t *)__parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+2];
+  tc->name = "Startup for FILL_CA";
+  tc->prepare_input = (parsec_hook_t*)kcyclic_FILL_CA_internal_init;
+  ((__parsec_chore_t*)&tc->incarnations[0])->hook = (parsec_hook_t *)__jdf2c_startup_FILL_CA;
+  /* Startup task for FILL_A */
+  tc = (parsec_task_class_t *)__parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+3];
+  tc->name = "Startup for FILL_A";
+  tc->prepare_input = (parsec_hook_t*)kcyclic_FILL_A_internal_init;
+  ((__parsec_chore_t*)&tc->incarnations[0])->hook = (parsec_hook_t *)__jdf2c_startup_FILL_A;
+  /* Compute the number of arenas_datatypes: */
+  /*   PARSEC_kcyclic_DEFAULT_ARENA  ->  0 */
+  __parsec_tp->super.arenas_datatypes_size = 1;
+  memset(&__parsec_tp->super.arenas_datatypes[0], 0, __parsec_tp->super.arenas_datatypes_size*sizeof(parsec_arena_datatype_t));
+  /* If profiling is enabled, the keys for profiling */
+#  if defined(PARSEC_PROF_TRACE)
+  __parsec_tp->super.super.profiling_array = kcyclic_profiling_array;
+  if( -2 == kcyclic_profiling_array[0] ) {
+    #if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+parsec_profiling_add_dictionary_keyword("kcyclic::COMPARE::internal init", "fill:34D8D8",
+                                       0,
+                                       NULL,
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(kcyclic_COMPARE.task_class_id  + PARSEC_kcyclic_NB_TASK_CLASSES)/* COMPARE (internal init) start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(kcyclic_COMPARE.task_class_id  + PARSEC_kcyclic_NB_TASK_CLASSES)/* COMPARE (internal init) end key */]);
+#endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+parsec_profiling_add_dictionary_keyword("kcyclic::COMPARE", "fill:CC2828",
+                                       sizeof(parsec_task_prof_info_t)+2*sizeof(parsec_assignment_t),
+                                       "dc_key{uint64_t};priority{int32_t};dc_dataid{uint32_t};tcid{uint32_t};trc{int32_t};M{int32_t};N{int32_t}",
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(kcyclic_COMPARE.task_class_id) /* COMPARE start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(kcyclic_COMPARE.task_class_id) /* COMPARE end key */]);
+
+    #if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+parsec_profiling_add_dictionary_keyword("kcyclic::READ_VA::internal init", "fill:8634D8",
+                                       0,
+                                       NULL,
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(kcyclic_READ_VA.task_class_id  + PARSEC_kcyclic_NB_TASK_CLASSES)/* READ_VA (internal init) start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(kcyclic_READ_VA.task_class_id  + PARSEC_kcyclic_NB_TASK_CLASSES)/* READ_VA (internal init) end key */]);
+#endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+parsec_profiling_add_dictionary_keyword("kcyclic::READ_VA", "fill:7ACC28",
+                                       sizeof(parsec_task_prof_info_t)+2*sizeof(parsec_assignment_t),
+                                       "dc_key{uint64_t};priority{int32_t};dc_dataid{uint32_t};tcid{uint32_t};trc{int32_t};M{int32_t};N{int32_t}",
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(kcyclic_READ_VA.task_class_id) /* READ_VA start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(kcyclic_READ_VA.task_class_id) /* READ_VA end key */]);
+
+    #if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+parsec_profiling_add_dictionary_keyword("kcyclic::FILL_CA::internal init", "fill:D83434",
+                                       0,
+                                       NULL,
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(kcyclic_FILL_CA.task_class_id  + PARSEC_kcyclic_NB_TASK_CLASSES)/* FILL_CA (internal init) start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(kcyclic_FILL_CA.task_class_id  + PARSEC_kcyclic_NB_TASK_CLASSES)/* FILL_CA (internal init) end key */]);
+#endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+parsec_profiling_add_dictionary_keyword("kcyclic::FILL_CA", "fill:28CCCC",
+                                       sizeof(parsec_task_prof_info_t)+2*sizeof(parsec_assignment_t),
+                                       "dc_key{uint64_t};priority{int32_t};dc_dataid{uint32_t};tcid{uint32_t};trc{int32_t};M{int32_t};N{int32_t}",
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(kcyclic_FILL_CA.task_class_id) /* FILL_CA start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(kcyclic_FILL_CA.task_class_id) /* FILL_CA end key */]);
+
+    #if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+parsec_profiling_add_dictionary_keyword("kcyclic::FILL_A::internal init", "fill:86D834",
+                                       0,
+                                       NULL,
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(kcyclic_FILL_A.task_class_id  + PARSEC_kcyclic_NB_TASK_CLASSES)/* FILL_A (internal init) start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(kcyclic_FILL_A.task_class_id  + PARSEC_kcyclic_NB_TASK_CLASSES)/* FILL_A (internal init) end key */]);
+#endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+parsec_profiling_add_dictionary_keyword("kcyclic::FILL_A", "fill:7A28CC",
+                                       sizeof(parsec_task_prof_info_t)+2*sizeof(parsec_assignment_t),
+                                       "dc_key{uint64_t};priority{int32_t};dc_dataid{uint32_t};tcid{uint32_t};trc{int32_t};M{int32_t};N{int32_t}",
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(kcyclic_FILL_A.task_class_id) /* FILL_A start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(kcyclic_FILL_A.task_class_id) /* FILL_A end key */]);
+
+  }
+#  endif /* defined(PARSEC_PROF_TRACE) */
+  __parsec_tp->super.super.repo_array = __parsec_tp->repositories;
+  __parsec_tp->super.super.startup_hook = (parsec_startup_fn_t)kcyclic_startup;
+  (void)parsec_taskpool_reserve_id((parsec_taskpool_t*)__parsec_tp);
+}
+
+  /** Generate class declaration and instance using the above constructor and destructor */
+  PARSEC_OBJ_CLASS_DECLARATION(__parsec_kcyclic_internal_taskpool_t);
+  PARSEC_OBJ_CLASS_INSTANCE(__parsec_kcyclic_internal_taskpool_t, parsec_kcyclic_taskpool_t,
+                            __parsec_kcyclic_internal_constructor, __parsec_kcyclic_internal_destructor);
+
+#undef dA
+#undef dVA
+#undef dCA
+#undef MT
+#undef NT
+
+parsec_kcyclic_taskpool_t *parsec_kcyclic_new(parsec_matrix_block_cyclic_t* dA /* data dA */, parsec_matrix_block_cyclic_t* dVA /* data dVA */, parsec_matrix_block_cyclic_t* dCA /* data dCA */)
+{
+  __parsec_kcyclic_internal_taskpool_t *__parsec_tp = PARSEC_OBJ_NEW(__parsec_kcyclic_internal_taskpool_t);
+  /* Dump the hidden parameters with default values */
+  int MT;
+  int NT;
+  /* Now the Parameter-dependent structures: */
+  __parsec_tp->super._g_dA = dA;
+  __parsec_tp->super._g_dVA = dVA;
+  __parsec_tp->super._g_dCA = dCA;
+  __parsec_tp->super._g_MT = MT = dA->super.mt-1;
+  __parsec_tp->super._g_NT = NT = dA->super.nt-1;
+  PARSEC_AYU_REGISTER_TASK(&kcyclic_COMPARE);
+  PARSEC_AYU_REGISTER_TASK(&kcyclic_READ_VA);
+  PARSEC_AYU_REGISTER_TASK(&kcyclic_FILL_CA);
+  PARSEC_AYU_REGISTER_TASK(&kcyclic_FILL_A);
+  __parsec_tp->super.super.startup_hook = (parsec_startup_fn_t)kcyclic_startup;
+  (void)parsec_taskpool_reserve_id((parsec_taskpool_t*)__parsec_tp);
+/* Prevent warnings related to not used hidden global variables */
+  (void)MT;  (void)NT;
+  return (parsec_kcyclic_taskpool_t*)__parsec_tp;
+}
+
+
+parsec_taskpool_t* kcyclic_taskpool(parsec_matrix_block_cyclic_t* A,
+                                    parsec_matrix_block_cyclic_t* VA,
+                                    parsec_matrix_block_cyclic_t* CA)
+{
+    parsec_kcyclic_taskpool_t* tp;
+    parsec_datatype_t dt;
+
+    tp = parsec_kcyclic_new(A, VA, CA);
+    assert( NULL != tp );
+
+    parsec_translate_matrix_type(TYPE, &dt);
+    parsec_add2arena_rect( &tp->arenas_datatypes[PARSEC_kcyclic_DEFAULT_ADT_IDX],
+                                  dt, A->super.mb, A->super.nb, A->super.mb);
+
+    return &tp->super;
+}
+
+
+PARSEC_OBJ_CLASS_INSTANCE(parsec_kcyclic_taskpool_t, parsec_taskpool_t, NULL, NULL);
+
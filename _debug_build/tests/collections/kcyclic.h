@@ -0,0 +1,157 @@
+#ifndef _kcyclic_h_
+#define _kcyclic_h_
+#include "parsec.h"
+#include "parsec/parsec_internal.h"
+#include "parsec/remote_dep.h"
+
+BEGIN_C_DECLS
+
+#define PARSEC_kcyclic_DEFAULT_ADT_IDX    0
+#define PARSEC_kcyclic_ADT_IDX_MAX       1
+typedef struct parsec_kcyclic_taskpool_s {
+  parsec_taskpool_t super;
+  /* The list of globals */
+  parsec_matrix_block_cyclic_t* _g_dA /* data dA */;
+  parsec_matrix_block_cyclic_t* _g_dVA /* data dVA */;
+  parsec_matrix_block_cyclic_t* _g_dCA /* data dCA */;
+  int _g_MT;
+  int _g_NT;
+  /* The array of datatypes (DEFAULT and co.) */
+  parsec_arena_datatype_t arenas_datatypes[PARSEC_kcyclic_ADT_IDX_MAX];
+  uint32_t arenas_datatypes_size;
+} parsec_kcyclic_taskpool_t;
+
+/** Beware that this object is not a superset of the internal object, and as a result
+ *  we should never create one directly. Instead we should rely on the creation of the
+ *  internal object (__parsec_kcyclic_taskpool_t).
+ */
+PARSEC_OBJ_CLASS_DECLARATION(parsec_kcyclic_taskpool_t);
+extern parsec_kcyclic_taskpool_t *parsec_kcyclic_new(parsec_matrix_block_cyclic_t* _g_dA /* data dA */, parsec_matrix_block_cyclic_t* _g_dVA /* data dVA */, parsec_matrix_block_cyclic_t* _g_dCA /* data dCA */);
+
+#if MAX_LOCAL_COUNT < 2  /* number of parameters and locals COMPARE */
+  #error Too many parameters and local variables (2 out of MAX_LOCAL_COUNT) for task COMPARE
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_kcyclic_COMPARE_assignment_s {
+  parsec_assignment_t M;
+  parsec_assignment_t N;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-2];
+} __parsec_kcyclic_COMPARE_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 3  /* total number of flows for task COMPARE */
+  #error Too many flows (3 out of MAX_PARAM_COUNT) for task COMPARE
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_kcyclic_COMPARE_data_s {
+  parsec_data_pair_t _f_A;
+  parsec_data_pair_t _f_CA;
+  parsec_data_pair_t _f_VA;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-3];
+} __parsec_kcyclic_COMPARE_data_t;
+
+typedef struct __parsec_kcyclic_COMPARE_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_kcyclic_COMPARE_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_kcyclic_COMPARE_data_s data;
+} __parsec_kcyclic_COMPARE_task_t;
+
+
+#if MAX_LOCAL_COUNT < 2  /* number of parameters and locals READ_VA */
+  #error Too many parameters and local variables (2 out of MAX_LOCAL_COUNT) for task READ_VA
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_kcyclic_READ_VA_assignment_s {
+  parsec_assignment_t M;
+  parsec_assignment_t N;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-2];
+} __parsec_kcyclic_READ_VA_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 2  /* total number of flows for task READ_VA */
+  #error Too many flows (2 out of MAX_PARAM_COUNT) for task READ_VA
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_kcyclic_READ_VA_data_s {
+  parsec_data_pair_t _f_VA;
+  parsec_data_pair_t _f_C;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-2];
+} __parsec_kcyclic_READ_VA_data_t;
+
+typedef struct __parsec_kcyclic_READ_VA_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_kcyclic_READ_VA_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_kcyclic_READ_VA_data_s data;
+} __parsec_kcyclic_READ_VA_task_t;
+
+
+#if MAX_LOCAL_COUNT < 2  /* number of parameters and locals FILL_CA */
+  #error Too many parameters and local variables (2 out of MAX_LOCAL_COUNT) for task FILL_CA
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_kcyclic_FILL_CA_assignment_s {
+  parsec_assignment_t M;
+  parsec_assignment_t N;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-2];
+} __parsec_kcyclic_FILL_CA_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 1  /* total number of flows for task FILL_CA */
+  #error Too many flows (1 out of MAX_PARAM_COUNT) for task FILL_CA
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_kcyclic_FILL_CA_data_s {
+  parsec_data_pair_t _f_CA;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-1];
+} __parsec_kcyclic_FILL_CA_data_t;
+
+typedef struct __parsec_kcyclic_FILL_CA_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_kcyclic_FILL_CA_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_kcyclic_FILL_CA_data_s data;
+} __parsec_kcyclic_FILL_CA_task_t;
+
+
+#if MAX_LOCAL_COUNT < 2  /* number of parameters and locals FILL_A */
+  #error Too many parameters and local variables (2 out of MAX_LOCAL_COUNT) for task FILL_A
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_kcyclic_FILL_A_assignment_s {
+  parsec_assignment_t M;
+  parsec_assignment_t N;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-2];
+} __parsec_kcyclic_FILL_A_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 2  /* total number of flows for task FILL_A */
+  #error Too many flows (2 out of MAX_PARAM_COUNT) for task FILL_A
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_kcyclic_FILL_A_data_s {
+  parsec_data_pair_t _f_A;
+  parsec_data_pair_t _f_C;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-2];
+} __parsec_kcyclic_FILL_A_data_t;
+
+typedef struct __parsec_kcyclic_FILL_A_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_kcyclic_FILL_A_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_kcyclic_FILL_A_data_s data;
+} __parsec_kcyclic_FILL_A_task_t;
+
+
+END_C_DECLS
+
+#endif /* _kcyclic_h_ */ 
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ptgpp_testing_redistribute.redistribute_bound"
+  "redistribute_bound.c"
+  "redistribute_bound.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ptgpp_testing_redistribute.redistribute_bound.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ptgpp_testing_redistribute.redistribute_check"
+  "redistribute_check.c"
+  "redistribute_check.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ptgpp_testing_redistribute.redistribute_check.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
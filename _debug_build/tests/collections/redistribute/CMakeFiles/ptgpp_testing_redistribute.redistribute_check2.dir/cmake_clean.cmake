@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ptgpp_testing_redistribute.redistribute_check2"
+  "redistribute_check2.c"
+  "redistribute_check2.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ptgpp_testing_redistribute.redistribute_check2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
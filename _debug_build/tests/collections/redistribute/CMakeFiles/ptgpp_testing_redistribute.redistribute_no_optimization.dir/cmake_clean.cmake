@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ptgpp_testing_redistribute.redistribute_no_optimization"
+  "redistribute_no_optimization.c"
+  "redistribute_no_optimization.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ptgpp_testing_redistribute.redistribute_no_optimization.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testing_rebalance.dir/testing_rebalance.c.o"
+  "CMakeFiles/testing_rebalance.dir/testing_rebalance.c.o.d"
+  "testing_rebalance"
+  "testing_rebalance.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/testing_rebalance.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
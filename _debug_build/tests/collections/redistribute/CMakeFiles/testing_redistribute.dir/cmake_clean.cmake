@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testing_redistribute.dir/common.c.o"
+  "CMakeFiles/testing_redistribute.dir/common.c.o.d"
+  "CMakeFiles/testing_redistribute.dir/redistribute_bound.c.o"
+  "CMakeFiles/testing_redistribute.dir/redistribute_bound.c.o.d"
+  "CMakeFiles/testing_redistribute.dir/redistribute_check.c.o"
+  "CMakeFiles/testing_redistribute.dir/redistribute_check.c.o.d"
+  "CMakeFiles/testing_redistribute.dir/redistribute_check2.c.o"
+  "CMakeFiles/testing_redistribute.dir/redistribute_check2.c.o.d"
+  "CMakeFiles/testing_redistribute.dir/redistribute_no_optimization.c.o"
+  "CMakeFiles/testing_redistribute.dir/redistribute_no_optimization.c.o.d"
+  "CMakeFiles/testing_redistribute.dir/testing_redistribute.c.o"
+  "CMakeFiles/testing_redistribute.dir/testing_redistribute.c.o.d"
+  "testing_redistribute"
+  "testing_redistribute.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/testing_redistribute.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/collections/redistribute/common.c" "tests/collections/redistribute/CMakeFiles/testing_redistribute_random.dir/common.c.o" "gcc" "tests/collections/redistribute/CMakeFiles/testing_redistribute_random.dir/common.c.o.d"
+  "/root/repo/_debug_build/tests/collections/redistribute/redistribute_bound.c" "tests/collections/redistribute/CMakeFiles/testing_redistribute_random.dir/redistribute_bound.c.o" "gcc" "tests/collections/redistribute/CMakeFiles/testing_redistribute_random.dir/redistribute_bound.c.o.d"
+  "/root/repo/_debug_build/tests/collections/redistribute/redistribute_check.c" "tests/collections/redistribute/CMakeFiles/testing_redistribute_random.dir/redistribute_check.c.o" "gcc" "tests/collections/redistribute/CMakeFiles/testing_redistribute_random.dir/redistribute_check.c.o.d"
+  "/root/repo/_debug_build/tests/collections/redistribute/redistribute_check2.c" "tests/collections/redistribute/CMakeFiles/testing_redistribute_random.dir/redistribute_check2.c.o" "gcc" "tests/collections/redistribute/CMakeFiles/testing_redistribute_random.dir/redistribute_check2.c.o.d"
+  "/root/repo/_debug_build/tests/collections/redistribute/redistribute_no_optimization.c" "tests/collections/redistribute/CMakeFiles/testing_redistribute_random.dir/redistribute_no_optimization.c.o" "gcc" "tests/collections/redistribute/CMakeFiles/testing_redistribute_random.dir/redistribute_no_optimization.c.o.d"
+  "/root/repo/tests/collections/redistribute/testing_redistribute_random.c" "tests/collections/redistribute/CMakeFiles/testing_redistribute_random.dir/testing_redistribute_random.c.o" "gcc" "tests/collections/redistribute/CMakeFiles/testing_redistribute_random.dir/testing_redistribute_random.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_debug_build/parsec/CMakeFiles/parsec.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "/root/repo/_debug_build/parsec/include/fortran")
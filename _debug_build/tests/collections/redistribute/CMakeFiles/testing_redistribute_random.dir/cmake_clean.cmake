@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testing_redistribute_random.dir/common.c.o"
+  "CMakeFiles/testing_redistribute_random.dir/common.c.o.d"
+  "CMakeFiles/testing_redistribute_random.dir/redistribute_bound.c.o"
+  "CMakeFiles/testing_redistribute_random.dir/redistribute_bound.c.o.d"
+  "CMakeFiles/testing_redistribute_random.dir/redistribute_check.c.o"
+  "CMakeFiles/testing_redistribute_random.dir/redistribute_check.c.o.d"
+  "CMakeFiles/testing_redistribute_random.dir/redistribute_check2.c.o"
+  "CMakeFiles/testing_redistribute_random.dir/redistribute_check2.c.o.d"
+  "CMakeFiles/testing_redistribute_random.dir/redistribute_no_optimization.c.o"
+  "CMakeFiles/testing_redistribute_random.dir/redistribute_no_optimization.c.o.d"
+  "CMakeFiles/testing_redistribute_random.dir/testing_redistribute_random.c.o"
+  "CMakeFiles/testing_redistribute_random.dir/testing_redistribute_random.c.o.d"
+  "testing_redistribute_random"
+  "testing_redistribute_random.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/testing_redistribute_random.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,4340 @@
+#include "parsec.h"
+#include "parsec/parsec_internal.h"
+#include "parsec/ayudame.h"
+#include "parsec/execution_stream.h"
+#include "parsec/parsec_binary_profile.h"
+#include "parsec/mca/device/device_gpu.h"
+#if defined(PARSEC_HAVE_DEV_CUDA_SUPPORT)
+#include "parsec/mca/device/cuda/device_cuda.h"
+#endif  /* defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) */
+#if defined(PARSEC_HAVE_DEV_HIP_SUPPORT)
+#include "parsec/mca/device/hip/device_hip.h"
+#endif  /* defined(PARSEC_HAVE_DEV_HIP_SUPPORT) */
+#if defined(_MSC_VER) || defined(__MINGW32__)
+#  include <malloc.h>
+#else
+#  include <alloca.h>
+#endif  /* defined(_MSC_VER) || defined(__MINGW32__) */
+
+#define PARSEC_redistribute_bound_NB_TASK_CLASSES 2
+#define PARSEC_redistribute_bound_NB_DATA 2
+
+typedef struct __parsec_redistribute_bound_internal_taskpool_s __parsec_redistribute_bound_internal_taskpool_t;
+struct parsec_redistribute_bound_internal_taskpool_s;
+
+/** Predeclarations of the parsec_task_class_t */
+static const parsec_task_class_t redistribute_bound_Receive;
+static const parsec_task_class_t redistribute_bound_Send;
+/** Predeclarations of the parameters */
+/*
+ * Copyright (c) 2017-2021 The University of Tennessee and The University
+ *                         of Tennessee Research Foundation. All rights
+ *                         reserved.
+ *
+ */
+#include "redistribute_test.h"
+
+/**
+ * @brief CORE function, compute message size copied remote 
+ *
+ * @param [in] TL_row: row size of Top Left (NW)
+ * @param [in] TL_col: column size of Top Left (NW)
+ * @param [in] BR_row: row size of Bottom Right (SE)
+ * @param [in] BR_col: column size of Bottom Right (SE)
+ * @param [in] mb_Y_INNER: row tile size of Y, not including ghost region
+ * @param [in] nb_Y_INNER: column tile size of Y, not including ghost region
+ * @param [in] m_Y: row tile index of Y
+ * @param [in] n_Y: column tile index of Y
+ * @param [in] m_Y_start: row tile start index of Y
+ * @param [in] m_Y_end: row tile end index of Y
+ * @param [in] n_Y_start: column tile start index of Y
+ * @param [in] n_Y_end: column tile end index of Y
+ * @param [in] tid: thread id 
+ */
+
+void CORE_redistribute_bound(int TL_row, int TL_col, int BR_row, int BR_col, int mb_Y_INNER,
+                              int nb_Y_INNER, int m_Y, int n_Y, int m_Y_start, int m_Y_end,
+                              int n_Y_start, int n_Y_end, int tid, long long int *sum_remote,
+                              long long int *sum_remote_rank)
+{
+    if( m_Y == m_Y_start ){
+        if( n_Y == n_Y_start ){                                    /* North west corner */
+            sum_remote[tid] += TL_row * TL_col;
+            sum_remote_rank[tid] += TL_row * TL_col;
+        }
+        else if( (n_Y > n_Y_start) && (n_Y < n_Y_end) ){           /* North bar*/
+            sum_remote[tid] += TL_row * nb_Y_INNER;
+            sum_remote_rank[tid] += TL_row * nb_Y_INNER;
+        }
+        else if( (n_Y == n_Y_end) && (n_Y_start != n_Y_end) ){     /* North east corner */
+            sum_remote[tid] += TL_row * BR_col;
+            sum_remote_rank[tid] += TL_row * BR_col;
+        }
+    }
+
+    else if( (m_Y > m_Y_start) && (m_Y < m_Y_end) ){
+        if( n_Y == n_Y_start ){                                    /* West bar*/
+            sum_remote[tid] += mb_Y_INNER * TL_col;
+            sum_remote_rank[tid] += mb_Y_INNER * TL_col;
+        }
+        else if( (n_Y > n_Y_start) && (n_Y < n_Y_end) ){           /* Inner tile*/
+            sum_remote[tid] += mb_Y_INNER * nb_Y_INNER;
+            sum_remote_rank[tid] += mb_Y_INNER * nb_Y_INNER;
+        }
+        else if( (n_Y == n_Y_end) && (n_Y_start != n_Y_end) ){     /* East bar*/
+            sum_remote[tid] += mb_Y_INNER * BR_col;
+            sum_remote_rank[tid] += mb_Y_INNER * BR_col;
+        }
+    }
+
+    else if( (m_Y == m_Y_end) && (m_Y_start != m_Y_end) ){
+        if( n_Y == n_Y_start ){                                    /* South west corner */
+            sum_remote[tid] += BR_row * TL_col;
+            sum_remote_rank[tid] += BR_row * TL_col;
+        }
+        else if( (n_Y > n_Y_start) && (n_Y < n_Y_end) ){           /* South bar*/
+            sum_remote[tid] += BR_row * nb_Y_INNER;
+            sum_remote_rank[tid] += BR_row * nb_Y_INNER;
+        }
+        else if( (n_Y == n_Y_end) && (n_Y_start != n_Y_end) ){     /* South east corner */
+            sum_remote[tid] += BR_row * BR_col;
+            sum_remote_rank[tid] += BR_row * BR_col;
+        }
+    }
+}
+
+#include "redistribute_bound.h"
+
+struct __parsec_redistribute_bound_internal_taskpool_s {
+ parsec_redistribute_bound_taskpool_t super;
+ volatile int32_t sync_point;
+ volatile int32_t initial_number_tasks;
+ parsec_task_t* startup_queue;
+  /* The ranges to compute the hash key */
+  int Receive_m_Y_min;
+  int Receive_m_Y_range;
+  int Receive_n_Y_min;
+  int Receive_n_Y_range;
+  int Receive_m_T_min;
+  int Receive_m_T_range;
+  int Receive_n_T_min;
+  int Receive_n_T_range;
+  int Send_m_Y_min;
+  int Send_m_Y_range;
+  int Send_n_Y_min;
+  int Send_n_Y_range;
+  int Send_m_T_min;
+  int Send_m_T_range;
+  int Send_n_T_min;
+  int Send_n_T_range;
+  /* The list of data repositories */
+  data_repo_t* repositories[2];
+};
+
+#if defined(PARSEC_PROF_TRACE)
+#  if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+static int redistribute_bound_profiling_array[4*PARSEC_redistribute_bound_NB_TASK_CLASSES] = {-2}; /* 2 pairs (begin, end) per task, times two because each task class has an internal_init task */
+#  else /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+static int redistribute_bound_profiling_array[2*PARSEC_redistribute_bound_NB_TASK_CLASSES] = {-2}; /* 2 pairs (begin, end) per task */
+#  endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+#endif  /* defined(PARSEC_PROF_TRACE) */
+/* Globals */
+#define descY __parsec_tp->super._g_descY
+#define descT __parsec_tp->super._g_descT
+#define size_row (__parsec_tp->super._g_size_row)
+#define size_col (__parsec_tp->super._g_size_col)
+#define disi_Y (__parsec_tp->super._g_disi_Y)
+#define disj_Y (__parsec_tp->super._g_disj_Y)
+#define disi_T (__parsec_tp->super._g_disi_T)
+#define disj_T (__parsec_tp->super._g_disj_T)
+#define R (__parsec_tp->super._g_R)
+#define sum_remote (__parsec_tp->super._g_sum_remote)
+#define sum_local (__parsec_tp->super._g_sum_local)
+#define sum_remote_rank_send (__parsec_tp->super._g_sum_remote_rank_send)
+#define sum_remote_rank_receive (__parsec_tp->super._g_sum_remote_rank_receive)
+#define sum_local_rank (__parsec_tp->super._g_sum_local_rank)
+#define sum_nb_message_remote (__parsec_tp->super._g_sum_nb_message_remote)
+#define sum_nb_message_local (__parsec_tp->super._g_sum_nb_message_local)
+#define mb_Y_INNER (__parsec_tp->super._g_mb_Y_INNER)
+#define nb_Y_INNER (__parsec_tp->super._g_nb_Y_INNER)
+#define mb_T_INNER (__parsec_tp->super._g_mb_T_INNER)
+#define nb_T_INNER (__parsec_tp->super._g_nb_T_INNER)
+#define m_Y_START (__parsec_tp->super._g_m_Y_START)
+#define n_Y_START (__parsec_tp->super._g_n_Y_START)
+#define m_Y_END (__parsec_tp->super._g_m_Y_END)
+#define n_Y_END (__parsec_tp->super._g_n_Y_END)
+#define m_T_START (__parsec_tp->super._g_m_T_START)
+#define n_T_START (__parsec_tp->super._g_n_T_START)
+#define m_T_END (__parsec_tp->super._g_m_T_END)
+#define n_T_END (__parsec_tp->super._g_n_T_END)
+
+static inline int parsec_imin(int a, int b) { return (a <= b) ? a : b; };
+
+static inline int parsec_imax(int a, int b) { return (a >= b) ? a : b; };
+
+static inline int32_t redistribute_bound_Receive_inline_c_expr1_line_206(const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_bound_Receive_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Receive */
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int mb_T_inner = assignments->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = assignments->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = assignments->i_start.value; (void)i_start;
+  const int j_start = assignments->j_start.value; (void)j_start;
+  const int m_Y_start = assignments->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = assignments->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = assignments->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = assignments->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = assignments->m_Y.value; (void)m_Y;
+  const int n_Y = assignments->n_Y.value; (void)n_Y;
+  const int TL_row = assignments->TL_row.value; (void)TL_row;
+  const int TL_col = assignments->TL_col.value; (void)TL_col;
+  const int BR_row = assignments->BR_row.value; (void)BR_row;
+  const int BR_col = assignments->BR_col.value; (void)BR_col;
+  const int rank_Y = assignments->rank_Y.value; (void)rank_Y;
+  const int rank_T = assignments->rank_T.value; (void)rank_T;
+
+  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)i_start;  (void)j_start;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;  (void)m_Y;  (void)n_Y;  (void)TL_row;  (void)TL_col;  (void)BR_row;  (void)BR_col;  (void)rank_Y;  (void)rank_T;
+
+ return descT->super.rank_of(&descT->super, m_T, n_T); 
+}
+
+static inline int32_t redistribute_bound_Receive_inline_c_expr2_line_205(const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_bound_Receive_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Receive */
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int mb_T_inner = assignments->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = assignments->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = assignments->i_start.value; (void)i_start;
+  const int j_start = assignments->j_start.value; (void)j_start;
+  const int m_Y_start = assignments->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = assignments->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = assignments->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = assignments->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = assignments->m_Y.value; (void)m_Y;
+  const int n_Y = assignments->n_Y.value; (void)n_Y;
+  const int TL_row = assignments->TL_row.value; (void)TL_row;
+  const int TL_col = assignments->TL_col.value; (void)TL_col;
+  const int BR_row = assignments->BR_row.value; (void)BR_row;
+  const int BR_col = assignments->BR_col.value; (void)BR_col;
+  const int rank_Y = assignments->rank_Y.value; (void)rank_Y;
+  const int rank_T = assignments->rank_T.value; (void)rank_T;
+
+  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)i_start;  (void)j_start;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;  (void)m_Y;  (void)n_Y;  (void)TL_row;  (void)TL_col;  (void)BR_row;  (void)BR_col;  (void)rank_Y;  (void)rank_T;
+
+ return descY->super.rank_of(&descY->super, m_Y, n_Y); 
+}
+
+static inline int32_t redistribute_bound_Receive_inline_c_expr3_line_201(const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_bound_Receive_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Receive */
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int mb_T_inner = assignments->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = assignments->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = assignments->i_start.value; (void)i_start;
+  const int j_start = assignments->j_start.value; (void)j_start;
+  const int m_Y_start = assignments->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = assignments->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = assignments->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = assignments->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = assignments->m_Y.value; (void)m_Y;
+  const int n_Y = assignments->n_Y.value; (void)n_Y;
+  const int TL_row = assignments->TL_row.value; (void)TL_row;
+  const int TL_col = assignments->TL_col.value; (void)TL_col;
+  const int BR_row = assignments->BR_row.value; (void)BR_row;
+  const int BR_col = assignments->BR_col.value; (void)BR_col;
+  const int rank_Y = assignments->rank_Y.value; (void)rank_Y;
+  const int rank_T = assignments->rank_T.value; (void)rank_T;
+
+  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)i_start;  (void)j_start;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;  (void)m_Y;  (void)n_Y;  (void)TL_row;  (void)TL_col;  (void)BR_row;  (void)BR_col;  (void)rank_Y;  (void)rank_T;
+
+ return parsec_imin(nb_T_inner, nb_Y_INNER-j_start); 
+}
+
+static inline int32_t redistribute_bound_Receive_inline_c_expr4_line_200(const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_bound_Receive_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Receive */
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int mb_T_inner = assignments->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = assignments->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = assignments->i_start.value; (void)i_start;
+  const int j_start = assignments->j_start.value; (void)j_start;
+  const int m_Y_start = assignments->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = assignments->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = assignments->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = assignments->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = assignments->m_Y.value; (void)m_Y;
+  const int n_Y = assignments->n_Y.value; (void)n_Y;
+  const int TL_row = assignments->TL_row.value; (void)TL_row;
+  const int TL_col = assignments->TL_col.value; (void)TL_col;
+  const int BR_row = assignments->BR_row.value; (void)BR_row;
+  const int BR_col = assignments->BR_col.value; (void)BR_col;
+  const int rank_Y = assignments->rank_Y.value; (void)rank_Y;
+  const int rank_T = assignments->rank_T.value; (void)rank_T;
+
+  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)i_start;  (void)j_start;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;  (void)m_Y;  (void)n_Y;  (void)TL_row;  (void)TL_col;  (void)BR_row;  (void)BR_col;  (void)rank_Y;  (void)rank_T;
+
+ return parsec_imin(mb_T_inner, mb_Y_INNER-i_start); 
+}
+
+static inline int32_t redistribute_bound_Receive_inline_c_expr5_line_195(const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_bound_Receive_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Receive */
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int mb_T_inner = assignments->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = assignments->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = assignments->i_start.value; (void)i_start;
+  const int j_start = assignments->j_start.value; (void)j_start;
+  const int m_Y_start = assignments->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = assignments->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = assignments->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = assignments->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = assignments->m_Y.value; (void)m_Y;
+  const int n_Y = assignments->n_Y.value; (void)n_Y;
+  const int TL_row = assignments->TL_row.value; (void)TL_row;
+  const int TL_col = assignments->TL_col.value; (void)TL_col;
+  const int BR_row = assignments->BR_row.value; (void)BR_row;
+  const int BR_col = assignments->BR_col.value; (void)BR_col;
+  const int rank_Y = assignments->rank_Y.value; (void)rank_Y;
+  const int rank_T = assignments->rank_T.value; (void)rank_T;
+
+  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)i_start;  (void)j_start;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;  (void)m_Y;  (void)n_Y;  (void)TL_row;  (void)TL_col;  (void)BR_row;  (void)BR_col;  (void)rank_Y;  (void)rank_T;
+
+ return ((n_T == n_T_START)? (disj_Y+nb_T_inner-1)/nb_Y_INNER: (((n_T-n_T_START)*nb_T_INNER-disj_T%nb_T_INNER)+disj_Y+nb_T_inner-1)/nb_Y_INNER); 
+}
+
+static inline int32_t redistribute_bound_Receive_inline_c_expr6_line_194(const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_bound_Receive_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Receive */
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int mb_T_inner = assignments->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = assignments->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = assignments->i_start.value; (void)i_start;
+  const int j_start = assignments->j_start.value; (void)j_start;
+  const int m_Y_start = assignments->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = assignments->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = assignments->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = assignments->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = assignments->m_Y.value; (void)m_Y;
+  const int n_Y = assignments->n_Y.value; (void)n_Y;
+  const int TL_row = assignments->TL_row.value; (void)TL_row;
+  const int TL_col = assignments->TL_col.value; (void)TL_col;
+  const int BR_row = assignments->BR_row.value; (void)BR_row;
+  const int BR_col = assignments->BR_col.value; (void)BR_col;
+  const int rank_Y = assignments->rank_Y.value; (void)rank_Y;
+  const int rank_T = assignments->rank_T.value; (void)rank_T;
+
+  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)i_start;  (void)j_start;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;  (void)m_Y;  (void)n_Y;  (void)TL_row;  (void)TL_col;  (void)BR_row;  (void)BR_col;  (void)rank_Y;  (void)rank_T;
+
+ return ((m_T == m_T_START)? (disi_Y+mb_T_inner-1)/mb_Y_INNER: (((m_T-m_T_START)*mb_T_INNER-disi_T%mb_T_INNER)+disi_Y+mb_T_inner-1)/mb_Y_INNER); 
+}
+
+static inline int32_t redistribute_bound_Receive_inline_c_expr7_line_193(const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_bound_Receive_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Receive */
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int mb_T_inner = assignments->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = assignments->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = assignments->i_start.value; (void)i_start;
+  const int j_start = assignments->j_start.value; (void)j_start;
+  const int m_Y_start = assignments->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = assignments->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = assignments->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = assignments->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = assignments->m_Y.value; (void)m_Y;
+  const int n_Y = assignments->n_Y.value; (void)n_Y;
+  const int TL_row = assignments->TL_row.value; (void)TL_row;
+  const int TL_col = assignments->TL_col.value; (void)TL_col;
+  const int BR_row = assignments->BR_row.value; (void)BR_row;
+  const int BR_col = assignments->BR_col.value; (void)BR_col;
+  const int rank_Y = assignments->rank_Y.value; (void)rank_Y;
+  const int rank_T = assignments->rank_T.value; (void)rank_T;
+
+  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)i_start;  (void)j_start;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;  (void)m_Y;  (void)n_Y;  (void)TL_row;  (void)TL_col;  (void)BR_row;  (void)BR_col;  (void)rank_Y;  (void)rank_T;
+
+ return ((n_T == n_T_START)? disj_Y/nb_Y_INNER: (((n_T-n_T_START)*nb_T_INNER-disj_T%nb_T_INNER)+disj_Y)/nb_Y_INNER); 
+}
+
+static inline int32_t redistribute_bound_Receive_inline_c_expr8_line_192(const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_bound_Receive_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Receive */
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int mb_T_inner = assignments->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = assignments->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = assignments->i_start.value; (void)i_start;
+  const int j_start = assignments->j_start.value; (void)j_start;
+  const int m_Y_start = assignments->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = assignments->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = assignments->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = assignments->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = assignments->m_Y.value; (void)m_Y;
+  const int n_Y = assignments->n_Y.value; (void)n_Y;
+  const int TL_row = assignments->TL_row.value; (void)TL_row;
+  const int TL_col = assignments->TL_col.value; (void)TL_col;
+  const int BR_row = assignments->BR_row.value; (void)BR_row;
+  const int BR_col = assignments->BR_col.value; (void)BR_col;
+  const int rank_Y = assignments->rank_Y.value; (void)rank_Y;
+  const int rank_T = assignments->rank_T.value; (void)rank_T;
+
+  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)i_start;  (void)j_start;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;  (void)m_Y;  (void)n_Y;  (void)TL_row;  (void)TL_col;  (void)BR_row;  (void)BR_col;  (void)rank_Y;  (void)rank_T;
+
+ return ((m_T == m_T_START)? disi_Y/mb_Y_INNER: (((m_T-m_T_START)*mb_T_INNER-disi_T%mb_T_INNER)+disi_Y)/mb_Y_INNER); 
+}
+
+static inline int32_t redistribute_bound_Receive_inline_c_expr9_line_190(const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_bound_Receive_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Receive */
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int mb_T_inner = assignments->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = assignments->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = assignments->i_start.value; (void)i_start;
+  const int j_start = assignments->j_start.value; (void)j_start;
+  const int m_Y_start = assignments->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = assignments->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = assignments->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = assignments->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = assignments->m_Y.value; (void)m_Y;
+  const int n_Y = assignments->n_Y.value; (void)n_Y;
+  const int TL_row = assignments->TL_row.value; (void)TL_row;
+  const int TL_col = assignments->TL_col.value; (void)TL_col;
+  const int BR_row = assignments->BR_row.value; (void)BR_row;
+  const int BR_col = assignments->BR_col.value; (void)BR_col;
+  const int rank_Y = assignments->rank_Y.value; (void)rank_Y;
+  const int rank_T = assignments->rank_T.value; (void)rank_T;
+
+  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)i_start;  (void)j_start;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;  (void)m_Y;  (void)n_Y;  (void)TL_row;  (void)TL_col;  (void)BR_row;  (void)BR_col;  (void)rank_Y;  (void)rank_T;
+
+ return ((n_T == n_T_START)? disj_Y%nb_Y_INNER: (((n_T-n_T_START)*nb_T_INNER-disj_T%nb_T_INNER)+disj_Y)%nb_Y_INNER); 
+}
+
+static inline int32_t redistribute_bound_Receive_inline_c_expr10_line_189(const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_bound_Receive_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Receive */
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int mb_T_inner = assignments->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = assignments->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = assignments->i_start.value; (void)i_start;
+  const int j_start = assignments->j_start.value; (void)j_start;
+  const int m_Y_start = assignments->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = assignments->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = assignments->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = assignments->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = assignments->m_Y.value; (void)m_Y;
+  const int n_Y = assignments->n_Y.value; (void)n_Y;
+  const int TL_row = assignments->TL_row.value; (void)TL_row;
+  const int TL_col = assignments->TL_col.value; (void)TL_col;
+  const int BR_row = assignments->BR_row.value; (void)BR_row;
+  const int BR_col = assignments->BR_col.value; (void)BR_col;
+  const int rank_Y = assignments->rank_Y.value; (void)rank_Y;
+  const int rank_T = assignments->rank_T.value; (void)rank_T;
+
+  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)i_start;  (void)j_start;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;  (void)m_Y;  (void)n_Y;  (void)TL_row;  (void)TL_col;  (void)BR_row;  (void)BR_col;  (void)rank_Y;  (void)rank_T;
+
+ return ((m_T == m_T_START)? disi_Y%mb_Y_INNER: (((m_T-m_T_START)*mb_T_INNER-disi_T%mb_T_INNER)+disi_Y)%mb_Y_INNER); 
+}
+
+static inline int32_t redistribute_bound_Receive_inline_c_expr11_line_187(const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_bound_Receive_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Receive */
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int mb_T_inner = assignments->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = assignments->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = assignments->i_start.value; (void)i_start;
+  const int j_start = assignments->j_start.value; (void)j_start;
+  const int m_Y_start = assignments->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = assignments->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = assignments->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = assignments->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = assignments->m_Y.value; (void)m_Y;
+  const int n_Y = assignments->n_Y.value; (void)n_Y;
+  const int TL_row = assignments->TL_row.value; (void)TL_row;
+  const int TL_col = assignments->TL_col.value; (void)TL_col;
+  const int BR_row = assignments->BR_row.value; (void)BR_row;
+  const int BR_col = assignments->BR_col.value; (void)BR_col;
+  const int rank_Y = assignments->rank_Y.value; (void)rank_Y;
+  const int rank_T = assignments->rank_T.value; (void)rank_T;
+
+  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)i_start;  (void)j_start;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;  (void)m_Y;  (void)n_Y;  (void)TL_row;  (void)TL_col;  (void)BR_row;  (void)BR_col;  (void)rank_Y;  (void)rank_T;
+
+ return getsize(n_T, n_T_START, n_T_END, nb_T_INNER, size_col, disj_T%nb_T_INNER); 
+}
+
+static inline int32_t redistribute_bound_Receive_inline_c_expr12_line_186(const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_bound_Receive_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Receive */
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int mb_T_inner = assignments->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = assignments->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = assignments->i_start.value; (void)i_start;
+  const int j_start = assignments->j_start.value; (void)j_start;
+  const int m_Y_start = assignments->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = assignments->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = assignments->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = assignments->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = assignments->m_Y.value; (void)m_Y;
+  const int n_Y = assignments->n_Y.value; (void)n_Y;
+  const int TL_row = assignments->TL_row.value; (void)TL_row;
+  const int TL_col = assignments->TL_col.value; (void)TL_col;
+  const int BR_row = assignments->BR_row.value; (void)BR_row;
+  const int BR_col = assignments->BR_col.value; (void)BR_col;
+  const int rank_Y = assignments->rank_Y.value; (void)rank_Y;
+  const int rank_T = assignments->rank_T.value; (void)rank_T;
+
+  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)i_start;  (void)j_start;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;  (void)m_Y;  (void)n_Y;  (void)TL_row;  (void)TL_col;  (void)BR_row;  (void)BR_col;  (void)rank_Y;  (void)rank_T;
+
+ return getsize(m_T, m_T_START, m_T_END, mb_T_INNER, size_row, disi_T%mb_T_INNER); 
+}
+
+static inline int32_t redistribute_bound_Send_inline_c_expr13_line_155(const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_bound_Send_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Send */
+  const int m_Y = assignments->m_Y.value; (void)m_Y;
+  const int n_Y = assignments->n_Y.value; (void)n_Y;
+  const int mb_Y_inner = assignments->mb_Y_inner.value; (void)mb_Y_inner;
+  const int nb_Y_inner = assignments->nb_Y_inner.value; (void)nb_Y_inner;
+  const int i_start = assignments->i_start.value; (void)i_start;
+  const int j_start = assignments->j_start.value; (void)j_start;
+  const int m_T_start = assignments->m_T_start.value; (void)m_T_start;
+  const int n_T_start = assignments->n_T_start.value; (void)n_T_start;
+  const int m_T_end = assignments->m_T_end.value; (void)m_T_end;
+  const int n_T_end = assignments->n_T_end.value; (void)n_T_end;
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int TL_row = assignments->TL_row.value; (void)TL_row;
+  const int TL_col = assignments->TL_col.value; (void)TL_col;
+  const int BR_row = assignments->BR_row.value; (void)BR_row;
+  const int BR_col = assignments->BR_col.value; (void)BR_col;
+  const int rank_Y = assignments->rank_Y.value; (void)rank_Y;
+  const int rank_T = assignments->rank_T.value; (void)rank_T;
+
+  (void)m_Y;  (void)n_Y;  (void)mb_Y_inner;  (void)nb_Y_inner;  (void)i_start;  (void)j_start;  (void)m_T_start;  (void)n_T_start;  (void)m_T_end;  (void)n_T_end;  (void)m_T;  (void)n_T;  (void)TL_row;  (void)TL_col;  (void)BR_row;  (void)BR_col;  (void)rank_Y;  (void)rank_T;
+
+ return descT->super.rank_of(&descT->super, m_T, n_T); 
+}
+
+static inline int32_t redistribute_bound_Send_inline_c_expr14_line_154(const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_bound_Send_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Send */
+  const int m_Y = assignments->m_Y.value; (void)m_Y;
+  const int n_Y = assignments->n_Y.value; (void)n_Y;
+  const int mb_Y_inner = assignments->mb_Y_inner.value; (void)mb_Y_inner;
+  const int nb_Y_inner = assignments->nb_Y_inner.value; (void)nb_Y_inner;
+  const int i_start = assignments->i_start.value; (void)i_start;
+  const int j_start = assignments->j_start.value; (void)j_start;
+  const int m_T_start = assignments->m_T_start.value; (void)m_T_start;
+  const int n_T_start = assignments->n_T_start.value; (void)n_T_start;
+  const int m_T_end = assignments->m_T_end.value; (void)m_T_end;
+  const int n_T_end = assignments->n_T_end.value; (void)n_T_end;
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int TL_row = assignments->TL_row.value; (void)TL_row;
+  const int TL_col = assignments->TL_col.value; (void)TL_col;
+  const int BR_row = assignments->BR_row.value; (void)BR_row;
+  const int BR_col = assignments->BR_col.value; (void)BR_col;
+  const int rank_Y = assignments->rank_Y.value; (void)rank_Y;
+  const int rank_T = assignments->rank_T.value; (void)rank_T;
+
+  (void)m_Y;  (void)n_Y;  (void)mb_Y_inner;  (void)nb_Y_inner;  (void)i_start;  (void)j_start;  (void)m_T_start;  (void)n_T_start;  (void)m_T_end;  (void)n_T_end;  (void)m_T;  (void)n_T;  (void)TL_row;  (void)TL_col;  (void)BR_row;  (void)BR_col;  (void)rank_Y;  (void)rank_T;
+
+ return descY->super.rank_of(&descY->super, m_Y, n_Y); 
+}
+
+static inline int32_t redistribute_bound_Send_inline_c_expr15_line_150(const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_bound_Send_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Send */
+  const int m_Y = assignments->m_Y.value; (void)m_Y;
+  const int n_Y = assignments->n_Y.value; (void)n_Y;
+  const int mb_Y_inner = assignments->mb_Y_inner.value; (void)mb_Y_inner;
+  const int nb_Y_inner = assignments->nb_Y_inner.value; (void)nb_Y_inner;
+  const int i_start = assignments->i_start.value; (void)i_start;
+  const int j_start = assignments->j_start.value; (void)j_start;
+  const int m_T_start = assignments->m_T_start.value; (void)m_T_start;
+  const int n_T_start = assignments->n_T_start.value; (void)n_T_start;
+  const int m_T_end = assignments->m_T_end.value; (void)m_T_end;
+  const int n_T_end = assignments->n_T_end.value; (void)n_T_end;
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int TL_row = assignments->TL_row.value; (void)TL_row;
+  const int TL_col = assignments->TL_col.value; (void)TL_col;
+  const int BR_row = assignments->BR_row.value; (void)BR_row;
+  const int BR_col = assignments->BR_col.value; (void)BR_col;
+  const int rank_Y = assignments->rank_Y.value; (void)rank_Y;
+  const int rank_T = assignments->rank_T.value; (void)rank_T;
+
+  (void)m_Y;  (void)n_Y;  (void)mb_Y_inner;  (void)nb_Y_inner;  (void)i_start;  (void)j_start;  (void)m_T_start;  (void)n_T_start;  (void)m_T_end;  (void)n_T_end;  (void)m_T;  (void)n_T;  (void)TL_row;  (void)TL_col;  (void)BR_row;  (void)BR_col;  (void)rank_Y;  (void)rank_T;
+
+ return parsec_imin(nb_Y_inner, nb_T_INNER-j_start); 
+}
+
+static inline int32_t redistribute_bound_Send_inline_c_expr16_line_149(const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_bound_Send_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Send */
+  const int m_Y = assignments->m_Y.value; (void)m_Y;
+  const int n_Y = assignments->n_Y.value; (void)n_Y;
+  const int mb_Y_inner = assignments->mb_Y_inner.value; (void)mb_Y_inner;
+  const int nb_Y_inner = assignments->nb_Y_inner.value; (void)nb_Y_inner;
+  const int i_start = assignments->i_start.value; (void)i_start;
+  const int j_start = assignments->j_start.value; (void)j_start;
+  const int m_T_start = assignments->m_T_start.value; (void)m_T_start;
+  const int n_T_start = assignments->n_T_start.value; (void)n_T_start;
+  const int m_T_end = assignments->m_T_end.value; (void)m_T_end;
+  const int n_T_end = assignments->n_T_end.value; (void)n_T_end;
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int TL_row = assignments->TL_row.value; (void)TL_row;
+  const int TL_col = assignments->TL_col.value; (void)TL_col;
+  const int BR_row = assignments->BR_row.value; (void)BR_row;
+  const int BR_col = assignments->BR_col.value; (void)BR_col;
+  const int rank_Y = assignments->rank_Y.value; (void)rank_Y;
+  const int rank_T = assignments->rank_T.value; (void)rank_T;
+
+  (void)m_Y;  (void)n_Y;  (void)mb_Y_inner;  (void)nb_Y_inner;  (void)i_start;  (void)j_start;  (void)m_T_start;  (void)n_T_start;  (void)m_T_end;  (void)n_T_end;  (void)m_T;  (void)n_T;  (void)TL_row;  (void)TL_col;  (void)BR_row;  (void)BR_col;  (void)rank_Y;  (void)rank_T;
+
+ return parsec_imin(mb_Y_inner, mb_T_INNER-i_start); 
+}
+
+static inline int32_t redistribute_bound_Send_inline_c_expr17_line_144(const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_bound_Send_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Send */
+  const int m_Y = assignments->m_Y.value; (void)m_Y;
+  const int n_Y = assignments->n_Y.value; (void)n_Y;
+  const int mb_Y_inner = assignments->mb_Y_inner.value; (void)mb_Y_inner;
+  const int nb_Y_inner = assignments->nb_Y_inner.value; (void)nb_Y_inner;
+  const int i_start = assignments->i_start.value; (void)i_start;
+  const int j_start = assignments->j_start.value; (void)j_start;
+  const int m_T_start = assignments->m_T_start.value; (void)m_T_start;
+  const int n_T_start = assignments->n_T_start.value; (void)n_T_start;
+  const int m_T_end = assignments->m_T_end.value; (void)m_T_end;
+  const int n_T_end = assignments->n_T_end.value; (void)n_T_end;
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int TL_row = assignments->TL_row.value; (void)TL_row;
+  const int TL_col = assignments->TL_col.value; (void)TL_col;
+  const int BR_row = assignments->BR_row.value; (void)BR_row;
+  const int BR_col = assignments->BR_col.value; (void)BR_col;
+  const int rank_Y = assignments->rank_Y.value; (void)rank_Y;
+  const int rank_T = assignments->rank_T.value; (void)rank_T;
+
+  (void)m_Y;  (void)n_Y;  (void)mb_Y_inner;  (void)nb_Y_inner;  (void)i_start;  (void)j_start;  (void)m_T_start;  (void)n_T_start;  (void)m_T_end;  (void)n_T_end;  (void)m_T;  (void)n_T;  (void)TL_row;  (void)TL_col;  (void)BR_row;  (void)BR_col;  (void)rank_Y;  (void)rank_T;
+
+ return ((n_Y == n_Y_START)? (disj_T+nb_Y_inner-1)/nb_T_INNER: (((n_Y-n_Y_START)*nb_Y_INNER-disj_Y%nb_Y_INNER)+disj_T+nb_Y_inner-1)/nb_T_INNER); 
+}
+
+static inline int32_t redistribute_bound_Send_inline_c_expr18_line_143(const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_bound_Send_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Send */
+  const int m_Y = assignments->m_Y.value; (void)m_Y;
+  const int n_Y = assignments->n_Y.value; (void)n_Y;
+  const int mb_Y_inner = assignments->mb_Y_inner.value; (void)mb_Y_inner;
+  const int nb_Y_inner = assignments->nb_Y_inner.value; (void)nb_Y_inner;
+  const int i_start = assignments->i_start.value; (void)i_start;
+  const int j_start = assignments->j_start.value; (void)j_start;
+  const int m_T_start = assignments->m_T_start.value; (void)m_T_start;
+  const int n_T_start = assignments->n_T_start.value; (void)n_T_start;
+  const int m_T_end = assignments->m_T_end.value; (void)m_T_end;
+  const int n_T_end = assignments->n_T_end.value; (void)n_T_end;
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int TL_row = assignments->TL_row.value; (void)TL_row;
+  const int TL_col = assignments->TL_col.value; (void)TL_col;
+  const int BR_row = assignments->BR_row.value; (void)BR_row;
+  const int BR_col = assignments->BR_col.value; (void)BR_col;
+  const int rank_Y = assignments->rank_Y.value; (void)rank_Y;
+  const int rank_T = assignments->rank_T.value; (void)rank_T;
+
+  (void)m_Y;  (void)n_Y;  (void)mb_Y_inner;  (void)nb_Y_inner;  (void)i_start;  (void)j_start;  (void)m_T_start;  (void)n_T_start;  (void)m_T_end;  (void)n_T_end;  (void)m_T;  (void)n_T;  (void)TL_row;  (void)TL_col;  (void)BR_row;  (void)BR_col;  (void)rank_Y;  (void)rank_T;
+
+ return ((m_Y == m_Y_START)? (disi_T+mb_Y_inner-1)/mb_T_INNER: (((m_Y-m_Y_START)*mb_Y_INNER-disi_Y%mb_Y_INNER)+disi_T+mb_Y_inner-1)/mb_T_INNER); 
+}
+
+static inline int32_t redistribute_bound_Send_inline_c_expr19_line_141(const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_bound_Send_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Send */
+  const int m_Y = assignments->m_Y.value; (void)m_Y;
+  const int n_Y = assignments->n_Y.value; (void)n_Y;
+  const int mb_Y_inner = assignments->mb_Y_inner.value; (void)mb_Y_inner;
+  const int nb_Y_inner = assignments->nb_Y_inner.value; (void)nb_Y_inner;
+  const int i_start = assignments->i_start.value; (void)i_start;
+  const int j_start = assignments->j_start.value; (void)j_start;
+  const int m_T_start = assignments->m_T_start.value; (void)m_T_start;
+  const int n_T_start = assignments->n_T_start.value; (void)n_T_start;
+  const int m_T_end = assignments->m_T_end.value; (void)m_T_end;
+  const int n_T_end = assignments->n_T_end.value; (void)n_T_end;
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int TL_row = assignments->TL_row.value; (void)TL_row;
+  const int TL_col = assignments->TL_col.value; (void)TL_col;
+  const int BR_row = assignments->BR_row.value; (void)BR_row;
+  const int BR_col = assignments->BR_col.value; (void)BR_col;
+  const int rank_Y = assignments->rank_Y.value; (void)rank_Y;
+  const int rank_T = assignments->rank_T.value; (void)rank_T;
+
+  (void)m_Y;  (void)n_Y;  (void)mb_Y_inner;  (void)nb_Y_inner;  (void)i_start;  (void)j_start;  (void)m_T_start;  (void)n_T_start;  (void)m_T_end;  (void)n_T_end;  (void)m_T;  (void)n_T;  (void)TL_row;  (void)TL_col;  (void)BR_row;  (void)BR_col;  (void)rank_Y;  (void)rank_T;
+
+ return ((n_Y == n_Y_START)? disj_T/nb_T_INNER: (((n_Y-n_Y_START)*nb_Y_INNER-disj_Y%nb_Y_INNER)+disj_T)/nb_T_INNER); 
+}
+
+static inline int32_t redistribute_bound_Send_inline_c_expr20_line_140(const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_bound_Send_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Send */
+  const int m_Y = assignments->m_Y.value; (void)m_Y;
+  const int n_Y = assignments->n_Y.value; (void)n_Y;
+  const int mb_Y_inner = assignments->mb_Y_inner.value; (void)mb_Y_inner;
+  const int nb_Y_inner = assignments->nb_Y_inner.value; (void)nb_Y_inner;
+  const int i_start = assignments->i_start.value; (void)i_start;
+  const int j_start = assignments->j_start.value; (void)j_start;
+  const int m_T_start = assignments->m_T_start.value; (void)m_T_start;
+  const int n_T_start = assignments->n_T_start.value; (void)n_T_start;
+  const int m_T_end = assignments->m_T_end.value; (void)m_T_end;
+  const int n_T_end = assignments->n_T_end.value; (void)n_T_end;
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int TL_row = assignments->TL_row.value; (void)TL_row;
+  const int TL_col = assignments->TL_col.value; (void)TL_col;
+  const int BR_row = assignments->BR_row.value; (void)BR_row;
+  const int BR_col = assignments->BR_col.value; (void)BR_col;
+  const int rank_Y = assignments->rank_Y.value; (void)rank_Y;
+  const int rank_T = assignments->rank_T.value; (void)rank_T;
+
+  (void)m_Y;  (void)n_Y;  (void)mb_Y_inner;  (void)nb_Y_inner;  (void)i_start;  (void)j_start;  (void)m_T_start;  (void)n_T_start;  (void)m_T_end;  (void)n_T_end;  (void)m_T;  (void)n_T;  (void)TL_row;  (void)TL_col;  (void)BR_row;  (void)BR_col;  (void)rank_Y;  (void)rank_T;
+
+ return ((m_Y == m_Y_START)? disi_T/mb_T_INNER: (((m_Y-m_Y_START)*mb_Y_INNER-disi_Y%mb_Y_INNER)+disi_T)/mb_T_INNER); 
+}
+
+static inline int32_t redistribute_bound_Send_inline_c_expr21_line_138(const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_bound_Send_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Send */
+  const int m_Y = assignments->m_Y.value; (void)m_Y;
+  const int n_Y = assignments->n_Y.value; (void)n_Y;
+  const int mb_Y_inner = assignments->mb_Y_inner.value; (void)mb_Y_inner;
+  const int nb_Y_inner = assignments->nb_Y_inner.value; (void)nb_Y_inner;
+  const int i_start = assignments->i_start.value; (void)i_start;
+  const int j_start = assignments->j_start.value; (void)j_start;
+  const int m_T_start = assignments->m_T_start.value; (void)m_T_start;
+  const int n_T_start = assignments->n_T_start.value; (void)n_T_start;
+  const int m_T_end = assignments->m_T_end.value; (void)m_T_end;
+  const int n_T_end = assignments->n_T_end.value; (void)n_T_end;
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int TL_row = assignments->TL_row.value; (void)TL_row;
+  const int TL_col = assignments->TL_col.value; (void)TL_col;
+  const int BR_row = assignments->BR_row.value; (void)BR_row;
+  const int BR_col = assignments->BR_col.value; (void)BR_col;
+  const int rank_Y = assignments->rank_Y.value; (void)rank_Y;
+  const int rank_T = assignments->rank_T.value; (void)rank_T;
+
+  (void)m_Y;  (void)n_Y;  (void)mb_Y_inner;  (void)nb_Y_inner;  (void)i_start;  (void)j_start;  (void)m_T_start;  (void)n_T_start;  (void)m_T_end;  (void)n_T_end;  (void)m_T;  (void)n_T;  (void)TL_row;  (void)TL_col;  (void)BR_row;  (void)BR_col;  (void)rank_Y;  (void)rank_T;
+
+ return ((n_Y == n_Y_START)? disj_T%nb_T_INNER: (((n_Y-n_Y_START)*nb_Y_INNER-disj_Y%nb_Y_INNER)+disj_T)%nb_T_INNER); 
+}
+
+static inline int32_t redistribute_bound_Send_inline_c_expr22_line_137(const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_bound_Send_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Send */
+  const int m_Y = assignments->m_Y.value; (void)m_Y;
+  const int n_Y = assignments->n_Y.value; (void)n_Y;
+  const int mb_Y_inner = assignments->mb_Y_inner.value; (void)mb_Y_inner;
+  const int nb_Y_inner = assignments->nb_Y_inner.value; (void)nb_Y_inner;
+  const int i_start = assignments->i_start.value; (void)i_start;
+  const int j_start = assignments->j_start.value; (void)j_start;
+  const int m_T_start = assignments->m_T_start.value; (void)m_T_start;
+  const int n_T_start = assignments->n_T_start.value; (void)n_T_start;
+  const int m_T_end = assignments->m_T_end.value; (void)m_T_end;
+  const int n_T_end = assignments->n_T_end.value; (void)n_T_end;
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int TL_row = assignments->TL_row.value; (void)TL_row;
+  const int TL_col = assignments->TL_col.value; (void)TL_col;
+  const int BR_row = assignments->BR_row.value; (void)BR_row;
+  const int BR_col = assignments->BR_col.value; (void)BR_col;
+  const int rank_Y = assignments->rank_Y.value; (void)rank_Y;
+  const int rank_T = assignments->rank_T.value; (void)rank_T;
+
+  (void)m_Y;  (void)n_Y;  (void)mb_Y_inner;  (void)nb_Y_inner;  (void)i_start;  (void)j_start;  (void)m_T_start;  (void)n_T_start;  (void)m_T_end;  (void)n_T_end;  (void)m_T;  (void)n_T;  (void)TL_row;  (void)TL_col;  (void)BR_row;  (void)BR_col;  (void)rank_Y;  (void)rank_T;
+
+ return ((m_Y == m_Y_START)? disi_T%mb_T_INNER: (((m_Y-m_Y_START)*mb_Y_INNER-disi_Y%mb_Y_INNER)+disi_T)%mb_T_INNER); 
+}
+
+static inline int32_t redistribute_bound_Send_inline_c_expr23_line_135(const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_bound_Send_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Send */
+  const int m_Y = assignments->m_Y.value; (void)m_Y;
+  const int n_Y = assignments->n_Y.value; (void)n_Y;
+  const int mb_Y_inner = assignments->mb_Y_inner.value; (void)mb_Y_inner;
+  const int nb_Y_inner = assignments->nb_Y_inner.value; (void)nb_Y_inner;
+  const int i_start = assignments->i_start.value; (void)i_start;
+  const int j_start = assignments->j_start.value; (void)j_start;
+  const int m_T_start = assignments->m_T_start.value; (void)m_T_start;
+  const int n_T_start = assignments->n_T_start.value; (void)n_T_start;
+  const int m_T_end = assignments->m_T_end.value; (void)m_T_end;
+  const int n_T_end = assignments->n_T_end.value; (void)n_T_end;
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int TL_row = assignments->TL_row.value; (void)TL_row;
+  const int TL_col = assignments->TL_col.value; (void)TL_col;
+  const int BR_row = assignments->BR_row.value; (void)BR_row;
+  const int BR_col = assignments->BR_col.value; (void)BR_col;
+  const int rank_Y = assignments->rank_Y.value; (void)rank_Y;
+  const int rank_T = assignments->rank_T.value; (void)rank_T;
+
+  (void)m_Y;  (void)n_Y;  (void)mb_Y_inner;  (void)nb_Y_inner;  (void)i_start;  (void)j_start;  (void)m_T_start;  (void)n_T_start;  (void)m_T_end;  (void)n_T_end;  (void)m_T;  (void)n_T;  (void)TL_row;  (void)TL_col;  (void)BR_row;  (void)BR_col;  (void)rank_Y;  (void)rank_T;
+
+ return getsize(n_Y, n_Y_START, n_Y_END, nb_Y_INNER, size_col, disj_Y%nb_Y_INNER); 
+}
+
+static inline int32_t redistribute_bound_Send_inline_c_expr24_line_134(const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_bound_Send_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Send */
+  const int m_Y = assignments->m_Y.value; (void)m_Y;
+  const int n_Y = assignments->n_Y.value; (void)n_Y;
+  const int mb_Y_inner = assignments->mb_Y_inner.value; (void)mb_Y_inner;
+  const int nb_Y_inner = assignments->nb_Y_inner.value; (void)nb_Y_inner;
+  const int i_start = assignments->i_start.value; (void)i_start;
+  const int j_start = assignments->j_start.value; (void)j_start;
+  const int m_T_start = assignments->m_T_start.value; (void)m_T_start;
+  const int n_T_start = assignments->n_T_start.value; (void)n_T_start;
+  const int m_T_end = assignments->m_T_end.value; (void)m_T_end;
+  const int n_T_end = assignments->n_T_end.value; (void)n_T_end;
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int TL_row = assignments->TL_row.value; (void)TL_row;
+  const int TL_col = assignments->TL_col.value; (void)TL_col;
+  const int BR_row = assignments->BR_row.value; (void)BR_row;
+  const int BR_col = assignments->BR_col.value; (void)BR_col;
+  const int rank_Y = assignments->rank_Y.value; (void)rank_Y;
+  const int rank_T = assignments->rank_T.value; (void)rank_T;
+
+  (void)m_Y;  (void)n_Y;  (void)mb_Y_inner;  (void)nb_Y_inner;  (void)i_start;  (void)j_start;  (void)m_T_start;  (void)n_T_start;  (void)m_T_end;  (void)n_T_end;  (void)m_T;  (void)n_T;  (void)TL_row;  (void)TL_col;  (void)BR_row;  (void)BR_col;  (void)rank_Y;  (void)rank_T;
+
+ return getsize(m_Y, m_Y_START, m_Y_END, mb_Y_INNER, size_row, disi_Y%mb_Y_INNER); 
+}
+
+/* Data Access Macros */
+#define data_of_descT(descT_d0, descT_d1)  (((parsec_data_collection_t*)__parsec_tp->super._g_descT)->data_of((parsec_data_collection_t*)__parsec_tp->super._g_descT, (descT_d0), (descT_d1)))
+#define data_of_descY(descY_d0, descY_d1)  (((parsec_data_collection_t*)__parsec_tp->super._g_descY)->data_of((parsec_data_collection_t*)__parsec_tp->super._g_descY, (descY_d0), (descY_d1)))
+
+#define rank_of_descT(descT_d0, descT_d1)  (((parsec_data_collection_t*)__parsec_tp->super._g_descT)->rank_of((parsec_data_collection_t*)__parsec_tp->super._g_descT, (descT_d0), (descT_d1)))
+#define rank_of_descY(descY_d0, descY_d1)  (((parsec_data_collection_t*)__parsec_tp->super._g_descY)->rank_of((parsec_data_collection_t*)__parsec_tp->super._g_descY, (descY_d0), (descY_d1)))
+
+/* Functions Predicates */
+#define Receive_pred(m_T, n_T, mb_T_inner, nb_T_inner, i_start, j_start, m_Y_start, n_Y_start, m_Y_end, n_Y_end, m_Y, n_Y, TL_row, TL_col, BR_row, BR_col, rank_Y, rank_T) (((parsec_data_collection_t*)(__parsec_tp->super._g_descT))->myrank == rank_of_descT(m_T, n_T))
+#define Send_pred(m_Y, n_Y, mb_Y_inner, nb_Y_inner, i_start, j_start, m_T_start, n_T_start, m_T_end, n_T_end, m_T, n_T, TL_row, TL_col, BR_row, BR_col, rank_Y, rank_T) (((parsec_data_collection_t*)(__parsec_tp->super._g_descY))->myrank == rank_of_descY(m_Y, n_Y))
+
+/* Data Repositories */
+#define Receive_repo (__parsec_tp->repositories[1])
+#define Send_repo (__parsec_tp->repositories[0])
+/* Release dependencies output macro */
+#if defined(PARSEC_DEBUG_NOISIER)
+#define RELEASE_DEP_OUTPUT(ES, DEPO, TASKO, DEPI, TASKI, RSRC, RDST, DATA)\
+  do { \
+    char tmp1[128], tmp2[128]; (void)tmp1; (void)tmp2;\
+    PARSEC_DEBUG_VERBOSE(20, parsec_debug_output, "thread %d VP %d explore deps from %s:%s to %s:%s (from rank %d to %d) base ptr %p",\
+           (NULL != (ES) ? (ES)->th_id : -1), (NULL != (ES) ? (ES)->virtual_process->vp_id : -1),\
+           DEPO, parsec_task_snprintf(tmp1, 128, (parsec_task_t*)(TASKO)),\
+           DEPI, parsec_task_snprintf(tmp2, 128, (parsec_task_t*)(TASKI)), (RSRC), (RDST), (DATA));\
+  } while(0)
+#define ACQUIRE_FLOW(TASKI, DEPI, FUNO, DEPO, LOCALS, PTR)\
+  do { \
+    char tmp1[128], tmp2[128]; (void)tmp1; (void)tmp2;\
+    PARSEC_DEBUG_VERBOSE(20, parsec_debug_output, "task %s acquires flow %s from %s %s data ptr %p",\
+           parsec_task_snprintf(tmp1, 128, (parsec_task_t*)(TASKI)), (DEPI),\
+           (DEPO), parsec_snprintf_assignments(tmp2, 128, (FUNO), (parsec_assignment_t*)(LOCALS)), (PTR));\
+  } while(0)
+#else
+#define RELEASE_DEP_OUTPUT(ES, DEPO, TASKO, DEPI, TASKI, RSRC, RDST, DATA)
+#define ACQUIRE_FLOW(TASKI, DEPI, TASKO, DEPO, LOCALS, PTR)
+#endif
+static inline parsec_key_t __jdf2c_make_key_Receive(const parsec_taskpool_t *tp, const parsec_assignment_t *as)
+{
+  const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp = (const __parsec_redistribute_bound_internal_taskpool_t *)tp;
+  const __parsec_redistribute_bound_Receive_parsec_assignment_t *assignment = (const __parsec_redistribute_bound_Receive_parsec_assignment_t*)as;
+  uint64_t __parsec_id = 0;
+  __parsec_id += (assignment->m_T.value - __parsec_tp->Receive_m_T_min);
+  __parsec_id += (assignment->n_T.value - __parsec_tp->Receive_n_T_min) * __parsec_tp->Receive_m_T_range;
+  __parsec_id += (assignment->m_Y.value - __parsec_tp->Receive_m_Y_min) * __parsec_tp->Receive_m_T_range * __parsec_tp->Receive_n_T_range;
+  __parsec_id += (assignment->n_Y.value - __parsec_tp->Receive_n_Y_min) * __parsec_tp->Receive_m_T_range * __parsec_tp->Receive_n_T_range * __parsec_tp->Receive_m_Y_range;
+  return (parsec_key_t)__parsec_id;
+}
+static char *__jdf2c_key_fns_Receive_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_bound_internal_taskpool_t *)user_data;
+  __parsec_redistribute_bound_Receive_parsec_assignment_t __jdf2c__assignments = {  .m_T.value = 0, .n_T.value = 0, .mb_T_inner.value = 0, .nb_T_inner.value = 0, .i_start.value = 0, .j_start.value = 0, .m_Y_start.value = 0, .n_Y_start.value = 0, .m_Y_end.value = 0, .n_Y_end.value = 0, .m_Y.value = 0, .n_Y.value = 0, .TL_row.value = 0, .TL_col.value = 0, .BR_row.value = 0, .BR_col.value = 0, .rank_Y.value = 0, .rank_T.value = 0 };
+  int m_T = (__parsec_key) % __parsec_tp->Receive_m_T_range + __parsec_tp->Receive_m_T_min;
+  __parsec_key = __parsec_key / __parsec_tp->Receive_m_T_range;
+  __jdf2c__assignments.m_T.value = m_T;
+  int n_T = (__parsec_key) % __parsec_tp->Receive_n_T_range + __parsec_tp->Receive_n_T_min;
+  __parsec_key = __parsec_key / __parsec_tp->Receive_n_T_range;
+  __jdf2c__assignments.n_T.value = n_T;
+  int mb_T_inner = redistribute_bound_Receive_inline_c_expr12_line_186(__parsec_tp, &__jdf2c__assignments);
+  (void)mb_T_inner;
+  __jdf2c__assignments.mb_T_inner.value = mb_T_inner;
+  int nb_T_inner = redistribute_bound_Receive_inline_c_expr11_line_187(__parsec_tp, &__jdf2c__assignments);
+  (void)nb_T_inner;
+  __jdf2c__assignments.nb_T_inner.value = nb_T_inner;
+  int i_start = redistribute_bound_Receive_inline_c_expr10_line_189(__parsec_tp, &__jdf2c__assignments);
+  (void)i_start;
+  __jdf2c__assignments.i_start.value = i_start;
+  int j_start = redistribute_bound_Receive_inline_c_expr9_line_190(__parsec_tp, &__jdf2c__assignments);
+  (void)j_start;
+  __jdf2c__assignments.j_start.value = j_start;
+  int m_Y_start = redistribute_bound_Receive_inline_c_expr8_line_192(__parsec_tp, &__jdf2c__assignments);
+  (void)m_Y_start;
+  __jdf2c__assignments.m_Y_start.value = m_Y_start;
+  int n_Y_start = redistribute_bound_Receive_inline_c_expr7_line_193(__parsec_tp, &__jdf2c__assignments);
+  (void)n_Y_start;
+  __jdf2c__assignments.n_Y_start.value = n_Y_start;
+  int m_Y_end = redistribute_bound_Receive_inline_c_expr6_line_194(__parsec_tp, &__jdf2c__assignments);
+  (void)m_Y_end;
+  __jdf2c__assignments.m_Y_end.value = m_Y_end;
+  int n_Y_end = redistribute_bound_Receive_inline_c_expr5_line_195(__parsec_tp, &__jdf2c__assignments);
+  (void)n_Y_end;
+  __jdf2c__assignments.n_Y_end.value = n_Y_end;
+  int m_Y = (__parsec_key) % __parsec_tp->Receive_m_Y_range + __parsec_tp->Receive_m_Y_min;
+  __parsec_key = __parsec_key / __parsec_tp->Receive_m_Y_range;
+  __jdf2c__assignments.m_Y.value = m_Y;
+  int n_Y = (__parsec_key) % __parsec_tp->Receive_n_Y_range + __parsec_tp->Receive_n_Y_min;
+  __parsec_key = __parsec_key / __parsec_tp->Receive_n_Y_range;
+  __jdf2c__assignments.n_Y.value = n_Y;
+  int TL_row = redistribute_bound_Receive_inline_c_expr4_line_200(__parsec_tp, &__jdf2c__assignments);
+  (void)TL_row;
+  __jdf2c__assignments.TL_row.value = TL_row;
+  int TL_col = redistribute_bound_Receive_inline_c_expr3_line_201(__parsec_tp, &__jdf2c__assignments);
+  (void)TL_col;
+  __jdf2c__assignments.TL_col.value = TL_col;
+  int BR_row = ((((i_start + mb_T_inner) - 1) % mb_Y_INNER) + 1);
+  (void)BR_row;
+  __jdf2c__assignments.BR_row.value = BR_row;
+  int BR_col = ((((j_start + nb_T_inner) - 1) % nb_Y_INNER) + 1);
+  (void)BR_col;
+  __jdf2c__assignments.BR_col.value = BR_col;
+  int rank_Y = redistribute_bound_Receive_inline_c_expr2_line_205(__parsec_tp, &__jdf2c__assignments);
+  (void)rank_Y;
+  __jdf2c__assignments.rank_Y.value = rank_Y;
+  int rank_T = redistribute_bound_Receive_inline_c_expr1_line_206(__parsec_tp, &__jdf2c__assignments);
+  (void)rank_T;
+  __jdf2c__assignments.rank_T.value = rank_T;
+  (void)__jdf2c__assignments;
+  snprintf(buffer, buffer_size, "Receive(%d, %d, %d, %d)", m_T, n_T, m_Y, n_Y);
+  return buffer;
+}
+
+static parsec_key_fn_t __jdf2c_key_fns_Receive = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = __jdf2c_key_fns_Receive_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+static inline parsec_key_t __jdf2c_make_key_Send(const parsec_taskpool_t *tp, const parsec_assignment_t *as)
+{
+  const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp = (const __parsec_redistribute_bound_internal_taskpool_t *)tp;
+  const __parsec_redistribute_bound_Send_parsec_assignment_t *assignment = (const __parsec_redistribute_bound_Send_parsec_assignment_t*)as;
+  uint64_t __parsec_id = 0;
+  __parsec_id += (assignment->m_Y.value - __parsec_tp->Send_m_Y_min);
+  __parsec_id += (assignment->n_Y.value - __parsec_tp->Send_n_Y_min) * __parsec_tp->Send_m_Y_range;
+  __parsec_id += (assignment->m_T.value - __parsec_tp->Send_m_T_min) * __parsec_tp->Send_m_Y_range * __parsec_tp->Send_n_Y_range;
+  __parsec_id += (assignment->n_T.value - __parsec_tp->Send_n_T_min) * __parsec_tp->Send_m_Y_range * __parsec_tp->Send_n_Y_range * __parsec_tp->Send_m_T_range;
+  return (parsec_key_t)__parsec_id;
+}
+static char *__jdf2c_key_fns_Send_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_bound_internal_taskpool_t *)user_data;
+  __parsec_redistribute_bound_Send_parsec_assignment_t __jdf2c__assignments = {  .m_Y.value = 0, .n_Y.value = 0, .mb_Y_inner.value = 0, .nb_Y_inner.value = 0, .i_start.value = 0, .j_start.value = 0, .m_T_start.value = 0, .n_T_start.value = 0, .m_T_end.value = 0, .n_T_end.value = 0, .m_T.value = 0, .n_T.value = 0, .TL_row.value = 0, .TL_col.value = 0, .BR_row.value = 0, .BR_col.value = 0, .rank_Y.value = 0, .rank_T.value = 0 };
+  int m_Y = (__parsec_key) % __parsec_tp->Send_m_Y_range + __parsec_tp->Send_m_Y_min;
+  __parsec_key = __parsec_key / __parsec_tp->Send_m_Y_range;
+  __jdf2c__assignments.m_Y.value = m_Y;
+  int n_Y = (__parsec_key) % __parsec_tp->Send_n_Y_range + __parsec_tp->Send_n_Y_min;
+  __parsec_key = __parsec_key / __parsec_tp->Send_n_Y_range;
+  __jdf2c__assignments.n_Y.value = n_Y;
+  int mb_Y_inner = redistribute_bound_Send_inline_c_expr24_line_134(__parsec_tp, &__jdf2c__assignments);
+  (void)mb_Y_inner;
+  __jdf2c__assignments.mb_Y_inner.value = mb_Y_inner;
+  int nb_Y_inner = redistribute_bound_Send_inline_c_expr23_line_135(__parsec_tp, &__jdf2c__assignments);
+  (void)nb_Y_inner;
+  __jdf2c__assignments.nb_Y_inner.value = nb_Y_inner;
+  int i_start = redistribute_bound_Send_inline_c_expr22_line_137(__parsec_tp, &__jdf2c__assignments);
+  (void)i_start;
+  __jdf2c__assignments.i_start.value = i_start;
+  int j_start = redistribute_bound_Send_inline_c_expr21_line_138(__parsec_tp, &__jdf2c__assignments);
+  (void)j_start;
+  __jdf2c__assignments.j_start.value = j_start;
+  int m_T_start = redistribute_bound_Send_inline_c_expr20_line_140(__parsec_tp, &__jdf2c__assignments);
+  (void)m_T_start;
+  __jdf2c__assignments.m_T_start.value = m_T_start;
+  int n_T_start = redistribute_bound_Send_inline_c_expr19_line_141(__parsec_tp, &__jdf2c__assignments);
+  (void)n_T_start;
+  __jdf2c__assignments.n_T_start.value = n_T_start;
+  int m_T_end = redistribute_bound_Send_inline_c_expr18_line_143(__parsec_tp, &__jdf2c__assignments);
+  (void)m_T_end;
+  __jdf2c__assignments.m_T_end.value = m_T_end;
+  int n_T_end = redistribute_bound_Send_inline_c_expr17_line_144(__parsec_tp, &__jdf2c__assignments);
+  (void)n_T_end;
+  __jdf2c__assignments.n_T_end.value = n_T_end;
+  int m_T = (__parsec_key) % __parsec_tp->Send_m_T_range + __parsec_tp->Send_m_T_min;
+  __parsec_key = __parsec_key / __parsec_tp->Send_m_T_range;
+  __jdf2c__assignments.m_T.value = m_T;
+  int n_T = (__parsec_key) % __parsec_tp->Send_n_T_range + __parsec_tp->Send_n_T_min;
+  __parsec_key = __parsec_key / __parsec_tp->Send_n_T_range;
+  __jdf2c__assignments.n_T.value = n_T;
+  int TL_row = redistribute_bound_Send_inline_c_expr16_line_149(__parsec_tp, &__jdf2c__assignments);
+  (void)TL_row;
+  __jdf2c__assignments.TL_row.value = TL_row;
+  int TL_col = redistribute_bound_Send_inline_c_expr15_line_150(__parsec_tp, &__jdf2c__assignments);
+  (void)TL_col;
+  __jdf2c__assignments.TL_col.value = TL_col;
+  int BR_row = ((((i_start + mb_Y_inner) - 1) % mb_T_INNER) + 1);
+  (void)BR_row;
+  __jdf2c__assignments.BR_row.value = BR_row;
+  int BR_col = ((((j_start + nb_Y_inner) - 1) % nb_T_INNER) + 1);
+  (void)BR_col;
+  __jdf2c__assignments.BR_col.value = BR_col;
+  int rank_Y = redistribute_bound_Send_inline_c_expr14_line_154(__parsec_tp, &__jdf2c__assignments);
+  (void)rank_Y;
+  __jdf2c__assignments.rank_Y.value = rank_Y;
+  int rank_T = redistribute_bound_Send_inline_c_expr13_line_155(__parsec_tp, &__jdf2c__assignments);
+  (void)rank_T;
+  __jdf2c__assignments.rank_T.value = rank_T;
+  (void)__jdf2c__assignments;
+  snprintf(buffer, buffer_size, "Send(%d, %d, %d, %d)", m_Y, n_Y, m_T, n_T);
+  return buffer;
+}
+
+static parsec_key_fn_t __jdf2c_key_fns_Send = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = __jdf2c_key_fns_Send_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/******                                    Receive                                    ******/
+
+static inline int minexpr_of_symb_redistribute_bound_Receive_m_T_fct(const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_bound_Receive_parsec_assignment_t *locals)
+{
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int mb_T_inner = locals->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = locals->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int m_Y_start = locals->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = locals->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = locals->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = locals->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+  const int TL_row = locals->TL_row.value; (void)TL_row;
+  const int TL_col = locals->TL_col.value; (void)TL_col;
+  const int BR_row = locals->BR_row.value; (void)BR_row;
+  const int BR_col = locals->BR_col.value; (void)BR_col;
+  const int rank_Y = locals->rank_Y.value; (void)rank_Y;
+  const int rank_T = locals->rank_T.value; (void)rank_T;
+
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)i_start;
+  (void)j_start;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)m_Y;
+  (void)n_Y;
+  (void)TL_row;
+  (void)TL_col;
+  (void)BR_row;
+  (void)BR_col;
+  (void)rank_Y;
+  (void)rank_T;
+  (void)__parsec_tp; (void)locals;
+  return m_T_START;
+}
+static const parsec_expr_t minexpr_of_symb_redistribute_bound_Receive_m_T = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_redistribute_bound_Receive_m_T_fct }
+                   }
+};
+static inline int maxexpr_of_symb_redistribute_bound_Receive_m_T_fct(const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_bound_Receive_parsec_assignment_t *locals)
+{
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int mb_T_inner = locals->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = locals->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int m_Y_start = locals->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = locals->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = locals->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = locals->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+  const int TL_row = locals->TL_row.value; (void)TL_row;
+  const int TL_col = locals->TL_col.value; (void)TL_col;
+  const int BR_row = locals->BR_row.value; (void)BR_row;
+  const int BR_col = locals->BR_col.value; (void)BR_col;
+  const int rank_Y = locals->rank_Y.value; (void)rank_Y;
+  const int rank_T = locals->rank_T.value; (void)rank_T;
+
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)i_start;
+  (void)j_start;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)m_Y;
+  (void)n_Y;
+  (void)TL_row;
+  (void)TL_col;
+  (void)BR_row;
+  (void)BR_col;
+  (void)rank_Y;
+  (void)rank_T;
+  (void)__parsec_tp; (void)locals;
+  return m_T_END;
+}
+static const parsec_expr_t maxexpr_of_symb_redistribute_bound_Receive_m_T = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_redistribute_bound_Receive_m_T_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_bound_Receive_m_T = { .name = "m_T", .context_index = 0, .min = &minexpr_of_symb_redistribute_bound_Receive_m_T, .max = &maxexpr_of_symb_redistribute_bound_Receive_m_T, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int minexpr_of_symb_redistribute_bound_Receive_n_T_fct(const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_bound_Receive_parsec_assignment_t *locals)
+{
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int mb_T_inner = locals->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = locals->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int m_Y_start = locals->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = locals->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = locals->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = locals->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+  const int TL_row = locals->TL_row.value; (void)TL_row;
+  const int TL_col = locals->TL_col.value; (void)TL_col;
+  const int BR_row = locals->BR_row.value; (void)BR_row;
+  const int BR_col = locals->BR_col.value; (void)BR_col;
+  const int rank_Y = locals->rank_Y.value; (void)rank_Y;
+  const int rank_T = locals->rank_T.value; (void)rank_T;
+
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)i_start;
+  (void)j_start;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)m_Y;
+  (void)n_Y;
+  (void)TL_row;
+  (void)TL_col;
+  (void)BR_row;
+  (void)BR_col;
+  (void)rank_Y;
+  (void)rank_T;
+  (void)__parsec_tp; (void)locals;
+  return n_T_START;
+}
+static const parsec_expr_t minexpr_of_symb_redistribute_bound_Receive_n_T = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_redistribute_bound_Receive_n_T_fct }
+                   }
+};
+static inline int maxexpr_of_symb_redistribute_bound_Receive_n_T_fct(const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_bound_Receive_parsec_assignment_t *locals)
+{
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int mb_T_inner = locals->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = locals->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int m_Y_start = locals->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = locals->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = locals->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = locals->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+  const int TL_row = locals->TL_row.value; (void)TL_row;
+  const int TL_col = locals->TL_col.value; (void)TL_col;
+  const int BR_row = locals->BR_row.value; (void)BR_row;
+  const int BR_col = locals->BR_col.value; (void)BR_col;
+  const int rank_Y = locals->rank_Y.value; (void)rank_Y;
+  const int rank_T = locals->rank_T.value; (void)rank_T;
+
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)i_start;
+  (void)j_start;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)m_Y;
+  (void)n_Y;
+  (void)TL_row;
+  (void)TL_col;
+  (void)BR_row;
+  (void)BR_col;
+  (void)rank_Y;
+  (void)rank_T;
+  (void)__parsec_tp; (void)locals;
+  return n_T_END;
+}
+static const parsec_expr_t maxexpr_of_symb_redistribute_bound_Receive_n_T = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_redistribute_bound_Receive_n_T_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_bound_Receive_n_T = { .name = "n_T", .context_index = 1, .min = &minexpr_of_symb_redistribute_bound_Receive_n_T, .max = &maxexpr_of_symb_redistribute_bound_Receive_n_T, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int32_t expr_of_symb_redistribute_bound_Receive_mb_T_inner_fct(const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_bound_Receive_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_bound_Receive_inline_c_expr12_line_186(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_redistribute_bound_Receive_mb_T_inner = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_bound_Receive_mb_T_inner_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_bound_Receive_mb_T_inner = { .name = "mb_T_inner", .context_index = 2, .min = &expr_of_symb_redistribute_bound_Receive_mb_T_inner, .max = &expr_of_symb_redistribute_bound_Receive_mb_T_inner, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_redistribute_bound_Receive_nb_T_inner_fct(const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_bound_Receive_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_bound_Receive_inline_c_expr11_line_187(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_redistribute_bound_Receive_nb_T_inner = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_bound_Receive_nb_T_inner_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_bound_Receive_nb_T_inner = { .name = "nb_T_inner", .context_index = 3, .min = &expr_of_symb_redistribute_bound_Receive_nb_T_inner, .max = &expr_of_symb_redistribute_bound_Receive_nb_T_inner, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_redistribute_bound_Receive_i_start_fct(const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_bound_Receive_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_bound_Receive_inline_c_expr10_line_189(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_redistribute_bound_Receive_i_start = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_bound_Receive_i_start_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_bound_Receive_i_start = { .name = "i_start", .context_index = 4, .min = &expr_of_symb_redistribute_bound_Receive_i_start, .max = &expr_of_symb_redistribute_bound_Receive_i_start, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_redistribute_bound_Receive_j_start_fct(const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_bound_Receive_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_bound_Receive_inline_c_expr9_line_190(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_redistribute_bound_Receive_j_start = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_bound_Receive_j_start_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_bound_Receive_j_start = { .name = "j_start", .context_index = 5, .min = &expr_of_symb_redistribute_bound_Receive_j_start, .max = &expr_of_symb_redistribute_bound_Receive_j_start, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_redistribute_bound_Receive_m_Y_start_fct(const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_bound_Receive_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_bound_Receive_inline_c_expr8_line_192(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_redistribute_bound_Receive_m_Y_start = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_bound_Receive_m_Y_start_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_bound_Receive_m_Y_start = { .name = "m_Y_start", .context_index = 6, .min = &expr_of_symb_redistribute_bound_Receive_m_Y_start, .max = &expr_of_symb_redistribute_bound_Receive_m_Y_start, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_redistribute_bound_Receive_n_Y_start_fct(const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_bound_Receive_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_bound_Receive_inline_c_expr7_line_193(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_redistribute_bound_Receive_n_Y_start = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_bound_Receive_n_Y_start_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_bound_Receive_n_Y_start = { .name = "n_Y_start", .context_index = 7, .min = &expr_of_symb_redistribute_bound_Receive_n_Y_start, .max = &expr_of_symb_redistribute_bound_Receive_n_Y_start, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_redistribute_bound_Receive_m_Y_end_fct(const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_bound_Receive_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_bound_Receive_inline_c_expr6_line_194(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_redistribute_bound_Receive_m_Y_end = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_bound_Receive_m_Y_end_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_bound_Receive_m_Y_end = { .name = "m_Y_end", .context_index = 8, .min = &expr_of_symb_redistribute_bound_Receive_m_Y_end, .max = &expr_of_symb_redistribute_bound_Receive_m_Y_end, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_redistribute_bound_Receive_n_Y_end_fct(const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_bound_Receive_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_bound_Receive_inline_c_expr5_line_195(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_redistribute_bound_Receive_n_Y_end = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_bound_Receive_n_Y_end_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_bound_Receive_n_Y_end = { .name = "n_Y_end", .context_index = 9, .min = &expr_of_symb_redistribute_bound_Receive_n_Y_end, .max = &expr_of_symb_redistribute_bound_Receive_n_Y_end, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int minexpr_of_symb_redistribute_bound_Receive_m_Y_fct(const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_bound_Receive_parsec_assignment_t *locals)
+{
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int mb_T_inner = locals->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = locals->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int m_Y_start = locals->m_Y_start.value;
+  const int n_Y_start = locals->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = locals->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = locals->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+  const int TL_row = locals->TL_row.value; (void)TL_row;
+  const int TL_col = locals->TL_col.value; (void)TL_col;
+  const int BR_row = locals->BR_row.value; (void)BR_row;
+  const int BR_col = locals->BR_col.value; (void)BR_col;
+  const int rank_Y = locals->rank_Y.value; (void)rank_Y;
+  const int rank_T = locals->rank_T.value; (void)rank_T;
+
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)i_start;
+  (void)j_start;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)m_Y;
+  (void)n_Y;
+  (void)TL_row;
+  (void)TL_col;
+  (void)BR_row;
+  (void)BR_col;
+  (void)rank_Y;
+  (void)rank_T;
+  (void)__parsec_tp; (void)locals;
+  return m_Y_start;
+}
+static const parsec_expr_t minexpr_of_symb_redistribute_bound_Receive_m_Y = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_redistribute_bound_Receive_m_Y_fct }
+                   }
+};
+static inline int maxexpr_of_symb_redistribute_bound_Receive_m_Y_fct(const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_bound_Receive_parsec_assignment_t *locals)
+{
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int mb_T_inner = locals->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = locals->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int m_Y_start = locals->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = locals->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = locals->m_Y_end.value;
+  const int n_Y_end = locals->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+  const int TL_row = locals->TL_row.value; (void)TL_row;
+  const int TL_col = locals->TL_col.value; (void)TL_col;
+  const int BR_row = locals->BR_row.value; (void)BR_row;
+  const int BR_col = locals->BR_col.value; (void)BR_col;
+  const int rank_Y = locals->rank_Y.value; (void)rank_Y;
+  const int rank_T = locals->rank_T.value; (void)rank_T;
+
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)i_start;
+  (void)j_start;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)m_Y;
+  (void)n_Y;
+  (void)TL_row;
+  (void)TL_col;
+  (void)BR_row;
+  (void)BR_col;
+  (void)rank_Y;
+  (void)rank_T;
+  (void)__parsec_tp; (void)locals;
+  return m_Y_end;
+}
+static const parsec_expr_t maxexpr_of_symb_redistribute_bound_Receive_m_Y = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_redistribute_bound_Receive_m_Y_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_bound_Receive_m_Y = { .name = "m_Y", .context_index = 10, .min = &minexpr_of_symb_redistribute_bound_Receive_m_Y, .max = &maxexpr_of_symb_redistribute_bound_Receive_m_Y, .cst_inc = 1, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int minexpr_of_symb_redistribute_bound_Receive_n_Y_fct(const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_bound_Receive_parsec_assignment_t *locals)
+{
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int mb_T_inner = locals->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = locals->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int m_Y_start = locals->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = locals->n_Y_start.value;
+  const int m_Y_end = locals->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = locals->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+  const int TL_row = locals->TL_row.value; (void)TL_row;
+  const int TL_col = locals->TL_col.value; (void)TL_col;
+  const int BR_row = locals->BR_row.value; (void)BR_row;
+  const int BR_col = locals->BR_col.value; (void)BR_col;
+  const int rank_Y = locals->rank_Y.value; (void)rank_Y;
+  const int rank_T = locals->rank_T.value; (void)rank_T;
+
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)i_start;
+  (void)j_start;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)m_Y;
+  (void)n_Y;
+  (void)TL_row;
+  (void)TL_col;
+  (void)BR_row;
+  (void)BR_col;
+  (void)rank_Y;
+  (void)rank_T;
+  (void)__parsec_tp; (void)locals;
+  return n_Y_start;
+}
+static const parsec_expr_t minexpr_of_symb_redistribute_bound_Receive_n_Y = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_redistribute_bound_Receive_n_Y_fct }
+                   }
+};
+static inline int maxexpr_of_symb_redistribute_bound_Receive_n_Y_fct(const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_bound_Receive_parsec_assignment_t *locals)
+{
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int mb_T_inner = locals->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = locals->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int m_Y_start = locals->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = locals->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = locals->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = locals->n_Y_end.value;
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+  const int TL_row = locals->TL_row.value; (void)TL_row;
+  const int TL_col = locals->TL_col.value; (void)TL_col;
+  const int BR_row = locals->BR_row.value; (void)BR_row;
+  const int BR_col = locals->BR_col.value; (void)BR_col;
+  const int rank_Y = locals->rank_Y.value; (void)rank_Y;
+  const int rank_T = locals->rank_T.value; (void)rank_T;
+
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)i_start;
+  (void)j_start;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)m_Y;
+  (void)n_Y;
+  (void)TL_row;
+  (void)TL_col;
+  (void)BR_row;
+  (void)BR_col;
+  (void)rank_Y;
+  (void)rank_T;
+  (void)__parsec_tp; (void)locals;
+  return n_Y_end;
+}
+static const parsec_expr_t maxexpr_of_symb_redistribute_bound_Receive_n_Y = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_redistribute_bound_Receive_n_Y_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_bound_Receive_n_Y = { .name = "n_Y", .context_index = 11, .min = &minexpr_of_symb_redistribute_bound_Receive_n_Y, .max = &maxexpr_of_symb_redistribute_bound_Receive_n_Y, .cst_inc = 1, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_redistribute_bound_Receive_TL_row_fct(const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_bound_Receive_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_bound_Receive_inline_c_expr4_line_200(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_redistribute_bound_Receive_TL_row = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_bound_Receive_TL_row_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_bound_Receive_TL_row = { .name = "TL_row", .context_index = 12, .min = &expr_of_symb_redistribute_bound_Receive_TL_row, .max = &expr_of_symb_redistribute_bound_Receive_TL_row, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_redistribute_bound_Receive_TL_col_fct(const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_bound_Receive_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_bound_Receive_inline_c_expr3_line_201(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_redistribute_bound_Receive_TL_col = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_bound_Receive_TL_col_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_bound_Receive_TL_col = { .name = "TL_col", .context_index = 13, .min = &expr_of_symb_redistribute_bound_Receive_TL_col, .max = &expr_of_symb_redistribute_bound_Receive_TL_col, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int expr_of_symb_redistribute_bound_Receive_BR_row_fct(const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_bound_Receive_parsec_assignment_t *locals)
+{
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int mb_T_inner = locals->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = locals->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int m_Y_start = locals->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = locals->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = locals->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = locals->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+  const int TL_row = locals->TL_row.value; (void)TL_row;
+  const int TL_col = locals->TL_col.value; (void)TL_col;
+  const int BR_row = locals->BR_row.value; (void)BR_row;
+  const int BR_col = locals->BR_col.value; (void)BR_col;
+  const int rank_Y = locals->rank_Y.value; (void)rank_Y;
+  const int rank_T = locals->rank_T.value; (void)rank_T;
+
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)i_start;
+  (void)j_start;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)m_Y;
+  (void)n_Y;
+  (void)TL_row;
+  (void)TL_col;
+  (void)BR_row;
+  (void)BR_col;
+  (void)rank_Y;
+  (void)rank_T;
+  (void)__parsec_tp; (void)locals;
+  return ((((i_start + mb_T_inner) - 1) % mb_Y_INNER) + 1);
+}
+static const parsec_expr_t expr_of_symb_redistribute_bound_Receive_BR_row = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_bound_Receive_BR_row_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_bound_Receive_BR_row = { .name = "BR_row", .context_index = 14, .min = &expr_of_symb_redistribute_bound_Receive_BR_row, .max = &expr_of_symb_redistribute_bound_Receive_BR_row, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int expr_of_symb_redistribute_bound_Receive_BR_col_fct(const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_bound_Receive_parsec_assignment_t *locals)
+{
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int mb_T_inner = locals->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = locals->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int m_Y_start = locals->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = locals->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = locals->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = locals->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+  const int TL_row = locals->TL_row.value; (void)TL_row;
+  const int TL_col = locals->TL_col.value; (void)TL_col;
+  const int BR_row = locals->BR_row.value; (void)BR_row;
+  const int BR_col = locals->BR_col.value; (void)BR_col;
+  const int rank_Y = locals->rank_Y.value; (void)rank_Y;
+  const int rank_T = locals->rank_T.value; (void)rank_T;
+
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)i_start;
+  (void)j_start;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)m_Y;
+  (void)n_Y;
+  (void)TL_row;
+  (void)TL_col;
+  (void)BR_row;
+  (void)BR_col;
+  (void)rank_Y;
+  (void)rank_T;
+  (void)__parsec_tp; (void)locals;
+  return ((((j_start + nb_T_inner) - 1) % nb_Y_INNER) + 1);
+}
+static const parsec_expr_t expr_of_symb_redistribute_bound_Receive_BR_col = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_bound_Receive_BR_col_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_bound_Receive_BR_col = { .name = "BR_col", .context_index = 15, .min = &expr_of_symb_redistribute_bound_Receive_BR_col, .max = &expr_of_symb_redistribute_bound_Receive_BR_col, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_redistribute_bound_Receive_rank_Y_fct(const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_bound_Receive_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_bound_Receive_inline_c_expr2_line_205(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_redistribute_bound_Receive_rank_Y = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_bound_Receive_rank_Y_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_bound_Receive_rank_Y = { .name = "rank_Y", .context_index = 16, .min = &expr_of_symb_redistribute_bound_Receive_rank_Y, .max = &expr_of_symb_redistribute_bound_Receive_rank_Y, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_redistribute_bound_Receive_rank_T_fct(const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_bound_Receive_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_bound_Receive_inline_c_expr1_line_206(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_redistribute_bound_Receive_rank_T = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_bound_Receive_rank_T_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_bound_Receive_rank_T = { .name = "rank_T", .context_index = 17, .min = &expr_of_symb_redistribute_bound_Receive_rank_T, .max = &expr_of_symb_redistribute_bound_Receive_rank_T, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int affinity_of_redistribute_bound_Receive(const __parsec_redistribute_bound_Receive_task_t *this_task,
+                     parsec_data_ref_t *ref)
+{
+    const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp = (const __parsec_redistribute_bound_internal_taskpool_t*)this_task->taskpool;
+  const int m_T = this_task->locals.m_T.value; (void)m_T;
+  const int n_T = this_task->locals.n_T.value; (void)n_T;
+  const int mb_T_inner = this_task->locals.mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = this_task->locals.nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = this_task->locals.i_start.value; (void)i_start;
+  const int j_start = this_task->locals.j_start.value; (void)j_start;
+  const int m_Y_start = this_task->locals.m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = this_task->locals.n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = this_task->locals.m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = this_task->locals.n_Y_end.value; (void)n_Y_end;
+  const int m_Y = this_task->locals.m_Y.value; (void)m_Y;
+  const int n_Y = this_task->locals.n_Y.value; (void)n_Y;
+  const int TL_row = this_task->locals.TL_row.value; (void)TL_row;
+  const int TL_col = this_task->locals.TL_col.value; (void)TL_col;
+  const int BR_row = this_task->locals.BR_row.value; (void)BR_row;
+  const int BR_col = this_task->locals.BR_col.value; (void)BR_col;
+  const int rank_Y = this_task->locals.rank_Y.value; (void)rank_Y;
+  const int rank_T = this_task->locals.rank_T.value; (void)rank_T;
+
+  /* Silent Warnings: should look into predicate to know what variables are usefull */
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)i_start;
+  (void)j_start;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)m_Y;
+  (void)n_Y;
+  (void)TL_row;
+  (void)TL_col;
+  (void)BR_row;
+  (void)BR_col;
+  (void)rank_Y;
+  (void)rank_T;
+  ref->dc = (parsec_data_collection_t *)__parsec_tp->super._g_descT;
+  /* Compute data key */
+  ref->key = ref->dc->data_key(ref->dc, m_T, n_T);
+  return 1;
+}
+static const parsec_property_t properties_of_redistribute_bound_Receive[1] = {
+  {.name = NULL, .expr = NULL}
+};
+static int release_deps_of_redistribute_bound_Receive(parsec_execution_stream_t *es, __parsec_redistribute_bound_Receive_task_t *this_task, uint32_t action_mask, parsec_remote_deps_t *deps)
+{
+  PARSEC_PINS(es, RELEASE_DEPS_BEGIN, (parsec_task_t *)this_task);  const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp = (const __parsec_redistribute_bound_internal_taskpool_t *)this_task->taskpool;
+  parsec_release_dep_fct_arg_t arg;
+  int __vp_id;
+  int consume_local_repo = 0;
+  arg.action_mask = action_mask;
+  arg.output_entry = NULL;
+  arg.output_repo = NULL;
+#if defined(DISTRIBUTED)
+  arg.remote_deps = deps;
+#endif  /* defined(DISTRIBUTED) */
+  assert(NULL != es);
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS )    arg.ready_lists = alloca(sizeof(parsec_task_t *) * es->virtual_process->parsec_context->nb_vp);
+  else
+    arg.ready_lists = NULL;
+  for( __vp_id = 0; __vp_id < es->virtual_process->parsec_context->nb_vp; arg.ready_lists[__vp_id++] = NULL );
+  (void)__parsec_tp; (void)deps;
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+  }
+  consume_local_repo = (this_task->repo_entry != NULL);
+  /* No successors, don't call iterate_successors and don't release any local deps */
+      if (consume_local_repo) {
+         data_repo_entry_used_once( Receive_repo, this_task->repo_entry->ht_item.key );
+      }
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+  }
+  PARSEC_PINS(es, RELEASE_DEPS_END, (parsec_task_t *)this_task);  return 0;
+}
+
+static int data_lookup_of_redistribute_bound_Receive(parsec_execution_stream_t *es, __parsec_redistribute_bound_Receive_task_t *this_task)
+{
+  const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_bound_internal_taskpool_t *)this_task->taskpool;
+  parsec_assignment_t generic_locals[MAX_PARAM_COUNT];  /* generic task locals */
+  int target_device = 0; (void)target_device;
+  (void)__parsec_tp; (void)generic_locals; (void)es;
+  parsec_data_copy_t *chunk = NULL;
+  data_repo_t        *reshape_repo  = NULL, *consumed_repo  = NULL;
+  data_repo_entry_t  *reshape_entry = NULL, *consumed_entry = NULL;
+  parsec_key_t        reshape_entry_key = 0, consumed_entry_key = 0;
+  uint8_t             consumed_flow_index;
+  parsec_dep_data_description_t data;
+  int ret;
+  (void)reshape_repo; (void)reshape_entry; (void)reshape_entry_key;
+  (void)consumed_repo; (void)consumed_entry; (void)consumed_entry_key;
+  (void)consumed_flow_index;
+  (void)chunk; (void)data; (void)ret;
+  const int m_T = this_task->locals.m_T.value; (void)m_T;
+  const int n_T = this_task->locals.n_T.value; (void)n_T;
+  const int mb_T_inner = this_task->locals.mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = this_task->locals.nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = this_task->locals.i_start.value; (void)i_start;
+  const int j_start = this_task->locals.j_start.value; (void)j_start;
+  const int m_Y_start = this_task->locals.m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = this_task->locals.n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = this_task->locals.m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = this_task->locals.n_Y_end.value; (void)n_Y_end;
+  const int m_Y = this_task->locals.m_Y.value; (void)m_Y;
+  const int n_Y = this_task->locals.n_Y.value; (void)n_Y;
+  const int TL_row = this_task->locals.TL_row.value; (void)TL_row;
+  const int TL_col = this_task->locals.TL_col.value; (void)TL_col;
+  const int BR_row = this_task->locals.BR_row.value; (void)BR_row;
+  const int BR_col = this_task->locals.BR_col.value; (void)BR_col;
+  const int rank_Y = this_task->locals.rank_Y.value; (void)rank_Y;
+  const int rank_T = this_task->locals.rank_T.value; (void)rank_T;
+  if( NULL == this_task->repo_entry ){
+    this_task->repo_entry = data_repo_lookup_entry_and_create(es, Receive_repo,                                       __jdf2c_make_key_Receive((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    data_repo_entry_addto_usage_limit(Receive_repo, this_task->repo_entry->ht_item.key, 1);    this_task->repo_entry ->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(this_task->repo_entry ->sim_exec_date == 0);
+    this_task->repo_entry ->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  /* The reshape repo is the current task repo. */  reshape_repo = Receive_repo;
+  reshape_entry_key = __jdf2c_make_key_Receive((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals) ;
+  reshape_entry = this_task->repo_entry;
+  /* Lookup the input data, and store them in the context if any */
+  /** Generate profiling information */
+#if defined(PARSEC_PROF_TRACE)
+  this_task->prof_info.desc = (parsec_data_collection_t*)__parsec_tp->super._g_descT;
+  this_task->prof_info.priority = this_task->priority;
+  this_task->prof_info.data_id   = ((parsec_data_collection_t*)__parsec_tp->super._g_descT)->data_key((parsec_data_collection_t*)__parsec_tp->super._g_descT, m_T, n_T);
+  this_task->prof_info.task_class_id = this_task->task_class->task_class_id;
+  this_task->prof_info.task_return_code = -1;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int datatype_lookup_of_redistribute_bound_Receive(parsec_execution_stream_t *es, const parsec_task_t *this_generic_task, const parsec_task_t *parent_task,
+              uint32_t* flow_mask, parsec_dep_data_description_t* data)
+{
+  const __parsec_redistribute_bound_Receive_task_t *this_task = (__parsec_redistribute_bound_Receive_task_t*)this_generic_task;
+  const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_bound_internal_taskpool_t *)this_task->taskpool;
+  (void)__parsec_tp; (void)es; (void)this_task; (void)data; (void)parent_task;
+  const int m_T = this_task->locals.m_T.value; (void)m_T;
+  const int n_T = this_task->locals.n_T.value; (void)n_T;
+  const int mb_T_inner = this_task->locals.mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = this_task->locals.nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = this_task->locals.i_start.value; (void)i_start;
+  const int j_start = this_task->locals.j_start.value; (void)j_start;
+  const int m_Y_start = this_task->locals.m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = this_task->locals.n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = this_task->locals.m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = this_task->locals.n_Y_end.value; (void)n_Y_end;
+  const int m_Y = this_task->locals.m_Y.value; (void)m_Y;
+  const int n_Y = this_task->locals.n_Y.value; (void)n_Y;
+  const int TL_row = this_task->locals.TL_row.value; (void)TL_row;
+  const int TL_col = this_task->locals.TL_col.value; (void)TL_col;
+  const int BR_row = this_task->locals.BR_row.value; (void)BR_row;
+  const int BR_col = this_task->locals.BR_col.value; (void)BR_col;
+  const int rank_Y = this_task->locals.rank_Y.value; (void)rank_Y;
+  const int rank_T = this_task->locals.rank_T.value; (void)rank_T;
+  data->local.arena = data->remote.arena = NULL;
+  data->local.src_datatype  = data->local.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->local.src_count     = data->local.dst_count = 0;
+  data->local.src_displ     = data->local.dst_displ = 0;
+  data->data_future  = NULL;
+
+  /* these are the output dependencies remote datatypes */
+  data->data                             = NULL;
+  data->remote.src_datatype = data->remote.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->remote.src_count    = data->remote.dst_count = 0;
+  data->remote.src_displ    = data->remote.dst_displ = 0;
+  data->data_future  = NULL;
+  (*flow_mask) = 0;  /* nothing left */
+  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)i_start;  (void)j_start;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;  (void)m_Y;  (void)n_Y;  (void)TL_row;  (void)TL_col;  (void)BR_row;  (void)BR_col;  (void)rank_Y;  (void)rank_T;
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+static int hook_of_redistribute_bound_Receive(parsec_execution_stream_t *es, __parsec_redistribute_bound_Receive_task_t *this_task)
+{
+  __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_bound_internal_taskpool_t *)this_task->taskpool;
+  (void)es; (void)__parsec_tp;
+  const int m_T = this_task->locals.m_T.value; (void)m_T;
+  const int n_T = this_task->locals.n_T.value; (void)n_T;
+  const int mb_T_inner = this_task->locals.mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = this_task->locals.nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = this_task->locals.i_start.value; (void)i_start;
+  const int j_start = this_task->locals.j_start.value; (void)j_start;
+  const int m_Y_start = this_task->locals.m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = this_task->locals.n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = this_task->locals.m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = this_task->locals.n_Y_end.value; (void)n_Y_end;
+  const int m_Y = this_task->locals.m_Y.value; (void)m_Y;
+  const int n_Y = this_task->locals.n_Y.value; (void)n_Y;
+  const int TL_row = this_task->locals.TL_row.value; (void)TL_row;
+  const int TL_col = this_task->locals.TL_col.value; (void)TL_col;
+  const int BR_row = this_task->locals.BR_row.value; (void)BR_row;
+  const int BR_col = this_task->locals.BR_col.value; (void)BR_col;
+  const int rank_Y = this_task->locals.rank_Y.value; (void)rank_Y;
+  const int rank_T = this_task->locals.rank_T.value; (void)rank_T;
+  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)i_start;  (void)j_start;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;  (void)m_Y;  (void)n_Y;  (void)TL_row;  (void)TL_col;  (void)BR_row;  (void)BR_col;  (void)rank_Y;  (void)rank_T;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                                  Receive BODY                                  -----*/
+
+{
+    int tid = es->th_id;
+    if( rank_Y != rank_T ) {
+        sum_nb_message_remote[tid]++;
+        CORE_redistribute_bound(TL_row, TL_col, BR_row, BR_col, mb_Y_INNER, nb_Y_INNER, m_Y,
+                                 n_Y, m_Y_start, m_Y_end, n_Y_start, n_Y_end, tid, sum_remote,
+                                 sum_remote_rank_receive);
+    } else {
+        sum_nb_message_local[tid]++;
+    }
+}
+
+/*-----                              END OF Receive BODY                              -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#endif  /*  defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+static int complete_hook_of_redistribute_bound_Receive(parsec_execution_stream_t *es, __parsec_redistribute_bound_Receive_task_t *this_task)
+{
+  const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_bound_internal_taskpool_t *)this_task->taskpool;
+#if defined(DISTRIBUTED)
+    const int m_T = this_task->locals.m_T.value; (void)m_T;
+  const int n_T = this_task->locals.n_T.value; (void)n_T;
+  const int mb_T_inner = this_task->locals.mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = this_task->locals.nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = this_task->locals.i_start.value; (void)i_start;
+  const int j_start = this_task->locals.j_start.value; (void)j_start;
+  const int m_Y_start = this_task->locals.m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = this_task->locals.n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = this_task->locals.m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = this_task->locals.n_Y_end.value; (void)n_Y_end;
+  const int m_Y = this_task->locals.m_Y.value; (void)m_Y;
+  const int n_Y = this_task->locals.n_Y.value; (void)n_Y;
+  const int TL_row = this_task->locals.TL_row.value; (void)TL_row;
+  const int TL_col = this_task->locals.TL_col.value; (void)TL_col;
+  const int BR_row = this_task->locals.BR_row.value; (void)BR_row;
+  const int BR_col = this_task->locals.BR_col.value; (void)BR_col;
+  const int rank_Y = this_task->locals.rank_Y.value; (void)rank_Y;
+  const int rank_T = this_task->locals.rank_T.value; (void)rank_T;
+#endif  /* defined(DISTRIBUTED) */
+  (void)es; (void)__parsec_tp;
+parsec_data_t* data_t_desc = NULL; (void)data_t_desc;
+#if defined(DISTRIBUTED)
+  /** If not working on distributed, there is no risk that data is not in place */
+  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)i_start;  (void)j_start;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;  (void)m_Y;  (void)n_Y;  (void)TL_row;  (void)TL_col;  (void)BR_row;  (void)BR_col;  (void)rank_Y;  (void)rank_T;
+
+#endif /* DISTRIBUTED */
+#if defined(PARSEC_PROF_GRAPHER)
+  parsec_prof_grapher_task((parsec_task_t*)this_task, es->th_id, es->virtual_process->vp_id,
+     __jdf2c_key_fns_Receive.key_hash(this_task->task_class->make_key( (parsec_taskpool_t*)this_task->taskpool, ((parsec_task_t*)this_task)->locals), NULL));
+#endif  /* defined(PARSEC_PROF_GRAPHER) */
+  release_deps_of_redistribute_bound_Receive(es, this_task,
+      PARSEC_ACTION_RELEASE_REMOTE_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_REFS |
+      PARSEC_ACTION_RESHAPE_ON_RELEASE |
+      0x0,  /* mask of all dep_index */ 
+      NULL);
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static parsec_hook_return_t release_task_of_redistribute_bound_Receive(parsec_execution_stream_t *es, parsec_task_t *this_task)
+{
+    const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp =
+        (const __parsec_redistribute_bound_internal_taskpool_t *)this_task->taskpool;
+    parsec_hash_table_t *ht = (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[1];
+    parsec_key_t key = this_task->task_class->make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals);
+    parsec_hashable_dependency_t *hash_dep = (parsec_hashable_dependency_t *)parsec_hash_table_remove(ht, key);
+    parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);
+    return parsec_release_task_to_mempool_update_nbtasks(es, this_task);
+}
+
+static char *redistribute_bound_redistribute_bound_Receive_internal_init_deps_key_functions_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_bound_internal_taskpool_t *)user_data;
+  __parsec_redistribute_bound_Receive_parsec_assignment_t __jdf2c__assignments = {  .m_T.value = 0, .n_T.value = 0, .mb_T_inner.value = 0, .nb_T_inner.value = 0, .i_start.value = 0, .j_start.value = 0, .m_Y_start.value = 0, .n_Y_start.value = 0, .m_Y_end.value = 0, .n_Y_end.value = 0, .m_Y.value = 0, .n_Y.value = 0, .TL_row.value = 0, .TL_col.value = 0, .BR_row.value = 0, .BR_col.value = 0, .rank_Y.value = 0, .rank_T.value = 0 };
+  int m_T = (__parsec_key) % __parsec_tp->Receive_m_T_range + __parsec_tp->Receive_m_T_min;
+  __parsec_key = __parsec_key / __parsec_tp->Receive_m_T_range;
+  __jdf2c__assignments.m_T.value = m_T;
+  int n_T = (__parsec_key) % __parsec_tp->Receive_n_T_range + __parsec_tp->Receive_n_T_min;
+  __parsec_key = __parsec_key / __parsec_tp->Receive_n_T_range;
+  __jdf2c__assignments.n_T.value = n_T;
+  int mb_T_inner = redistribute_bound_Receive_inline_c_expr12_line_186(__parsec_tp, &__jdf2c__assignments);
+  (void)mb_T_inner;
+  __jdf2c__assignments.mb_T_inner.value = mb_T_inner;
+  int nb_T_inner = redistribute_bound_Receive_inline_c_expr11_line_187(__parsec_tp, &__jdf2c__assignments);
+  (void)nb_T_inner;
+  __jdf2c__assignments.nb_T_inner.value = nb_T_inner;
+  int i_start = redistribute_bound_Receive_inline_c_expr10_line_189(__parsec_tp, &__jdf2c__assignments);
+  (void)i_start;
+  __jdf2c__assignments.i_start.value = i_start;
+  int j_start = redistribute_bound_Receive_inline_c_expr9_line_190(__parsec_tp, &__jdf2c__assignments);
+  (void)j_start;
+  __jdf2c__assignments.j_start.value = j_start;
+  int m_Y_start = redistribute_bound_Receive_inline_c_expr8_line_192(__parsec_tp, &__jdf2c__assignments);
+  (void)m_Y_start;
+  __jdf2c__assignments.m_Y_start.value = m_Y_start;
+  int n_Y_start = redistribute_bound_Receive_inline_c_expr7_line_193(__parsec_tp, &__jdf2c__assignments);
+  (void)n_Y_start;
+  __jdf2c__assignments.n_Y_start.value = n_Y_start;
+  int m_Y_end = redistribute_bound_Receive_inline_c_expr6_line_194(__parsec_tp, &__jdf2c__assignments);
+  (void)m_Y_end;
+  __jdf2c__assignments.m_Y_end.value = m_Y_end;
+  int n_Y_end = redistribute_bound_Receive_inline_c_expr5_line_195(__parsec_tp, &__jdf2c__assignments);
+  (void)n_Y_end;
+  __jdf2c__assignments.n_Y_end.value = n_Y_end;
+  int m_Y = (__parsec_key) % __parsec_tp->Receive_m_Y_range + __parsec_tp->Receive_m_Y_min;
+  __parsec_key = __parsec_key / __parsec_tp->Receive_m_Y_range;
+  __jdf2c__assignments.m_Y.value = m_Y;
+  int n_Y = (__parsec_key) % __parsec_tp->Receive_n_Y_range + __parsec_tp->Receive_n_Y_min;
+  __parsec_key = __parsec_key / __parsec_tp->Receive_n_Y_range;
+  __jdf2c__assignments.n_Y.value = n_Y;
+  int TL_row = redistribute_bound_Receive_inline_c_expr4_line_200(__parsec_tp, &__jdf2c__assignments);
+  (void)TL_row;
+  __jdf2c__assignments.TL_row.value = TL_row;
+  int TL_col = redistribute_bound_Receive_inline_c_expr3_line_201(__parsec_tp, &__jdf2c__assignments);
+  (void)TL_col;
+  __jdf2c__assignments.TL_col.value = TL_col;
+  int BR_row = ((((i_start + mb_T_inner) - 1) % mb_Y_INNER) + 1);
+  (void)BR_row;
+  __jdf2c__assignments.BR_row.value = BR_row;
+  int BR_col = ((((j_start + nb_T_inner) - 1) % nb_Y_INNER) + 1);
+  (void)BR_col;
+  __jdf2c__assignments.BR_col.value = BR_col;
+  int rank_Y = redistribute_bound_Receive_inline_c_expr2_line_205(__parsec_tp, &__jdf2c__assignments);
+  (void)rank_Y;
+  __jdf2c__assignments.rank_Y.value = rank_Y;
+  int rank_T = redistribute_bound_Receive_inline_c_expr1_line_206(__parsec_tp, &__jdf2c__assignments);
+  (void)rank_T;
+  __jdf2c__assignments.rank_T.value = rank_T;
+  (void)__jdf2c__assignments;
+  snprintf(buffer, buffer_size, "Receive(%d, %d, %d, %d)", m_T, n_T, m_Y, n_Y);
+  return buffer;
+}
+
+static parsec_key_fn_t redistribute_bound_redistribute_bound_Receive_internal_init_deps_key_functions = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = redistribute_bound_redistribute_bound_Receive_internal_init_deps_key_functions_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/* Needs: min-max count-tasks iterate */
+static int redistribute_bound_Receive_internal_init(parsec_execution_stream_t * es, __parsec_redistribute_bound_Receive_task_t * this_task)
+{
+  __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_bound_internal_taskpool_t*)this_task->taskpool;
+  int32_t nb_tasks = 0, saved_nb_tasks = 0;
+int32_t __m_T_min = 0x7fffffff, __m_T_max = 0;int32_t __jdf2c_m_T_min = 0x7fffffff, __jdf2c_m_T_max = 0;int32_t __n_T_min = 0x7fffffff, __n_T_max = 0;int32_t __jdf2c_n_T_min = 0x7fffffff, __jdf2c_n_T_max = 0;int32_t __m_Y_min = 0x7fffffff, __m_Y_max = 0;int32_t __jdf2c_m_Y_min = 0x7fffffff, __jdf2c_m_Y_max = 0;int32_t __n_Y_min = 0x7fffffff, __n_Y_max = 0;int32_t __jdf2c_n_Y_min = 0x7fffffff, __jdf2c_n_Y_max = 0;  __parsec_redistribute_bound_Receive_parsec_assignment_t assignments = {  .m_T.value = 0, .n_T.value = 0, .mb_T_inner.value = 0, .nb_T_inner.value = 0, .i_start.value = 0, .j_start.value = 0, .m_Y_start.value = 0, .n_Y_start.value = 0, .m_Y_end.value = 0, .n_Y_end.value = 0, .m_Y.value = 0, .n_Y.value = 0, .TL_row.value = 0, .TL_col.value = 0, .BR_row.value = 0, .BR_col.value = 0, .rank_Y.value = 0, .rank_T.value = 0 };
+  int32_t  m_T,  n_T,  mb_T_inner,  nb_T_inner,  i_start,  j_start,  m_Y_start,  n_Y_start,  m_Y_end,  n_Y_end,  m_Y,  n_Y,  TL_row,  TL_col,  BR_row,  BR_col,  rank_Y,  rank_T;
+  int32_t __jdf2c_m_T_start, __jdf2c_m_T_end, __jdf2c_m_T_inc;
+  int32_t __jdf2c_n_T_start, __jdf2c_n_T_end, __jdf2c_n_T_inc;
+  int32_t __jdf2c_m_Y_start, __jdf2c_m_Y_end, __jdf2c_m_Y_inc;
+  int32_t __jdf2c_n_Y_start, __jdf2c_n_Y_end, __jdf2c_n_Y_inc;
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+  PARSEC_PROFILING_TRACE(es->es_profile,
+                         this_task->taskpool->profiling_array[START_KEY(this_task->task_class->task_class_id)],
+                         0,
+                         this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    __jdf2c_m_T_start = m_T_START;
+    __jdf2c_m_T_end = m_T_END;
+    __jdf2c_m_T_inc = 1;
+    __m_T_min = parsec_imin(__jdf2c_m_T_start, __jdf2c_m_T_end);
+    __m_T_max = parsec_imax(__jdf2c_m_T_start, __jdf2c_m_T_end);
+    __jdf2c_m_T_min = parsec_imin(__jdf2c_m_T_min, __m_T_min);
+    __jdf2c_m_T_max = parsec_imax(__jdf2c_m_T_max, __m_T_max);
+    for(m_T =  __jdf2c_m_T_start;
+        m_T <= __jdf2c_m_T_end;
+        m_T += __jdf2c_m_T_inc) {
+    assignments.m_T.value = m_T;
+      __jdf2c_n_T_start = n_T_START;
+      __jdf2c_n_T_end = n_T_END;
+      __jdf2c_n_T_inc = 1;
+      __n_T_min = parsec_imin(__jdf2c_n_T_start, __jdf2c_n_T_end);
+      __n_T_max = parsec_imax(__jdf2c_n_T_start, __jdf2c_n_T_end);
+      __jdf2c_n_T_min = parsec_imin(__jdf2c_n_T_min, __n_T_min);
+      __jdf2c_n_T_max = parsec_imax(__jdf2c_n_T_max, __n_T_max);
+      for(n_T =  __jdf2c_n_T_start;
+          n_T <= __jdf2c_n_T_end;
+          n_T += __jdf2c_n_T_inc) {
+      assignments.n_T.value = n_T;
+    {  /* block for the non-range variable mb_T_inner */
+        mb_T_inner = redistribute_bound_Receive_inline_c_expr12_line_186(__parsec_tp, &assignments);
+        assignments.mb_T_inner.value = mb_T_inner;
+      {  /* block for the non-range variable nb_T_inner */
+          nb_T_inner = redistribute_bound_Receive_inline_c_expr11_line_187(__parsec_tp, &assignments);
+          assignments.nb_T_inner.value = nb_T_inner;
+        {  /* block for the non-range variable i_start */
+            i_start = redistribute_bound_Receive_inline_c_expr10_line_189(__parsec_tp, &assignments);
+            assignments.i_start.value = i_start;
+          {  /* block for the non-range variable j_start */
+              j_start = redistribute_bound_Receive_inline_c_expr9_line_190(__parsec_tp, &assignments);
+              assignments.j_start.value = j_start;
+            {  /* block for the non-range variable m_Y_start */
+                m_Y_start = redistribute_bound_Receive_inline_c_expr8_line_192(__parsec_tp, &assignments);
+                assignments.m_Y_start.value = m_Y_start;
+              {  /* block for the non-range variable n_Y_start */
+                  n_Y_start = redistribute_bound_Receive_inline_c_expr7_line_193(__parsec_tp, &assignments);
+                  assignments.n_Y_start.value = n_Y_start;
+                {  /* block for the non-range variable m_Y_end */
+                    m_Y_end = redistribute_bound_Receive_inline_c_expr6_line_194(__parsec_tp, &assignments);
+                    assignments.m_Y_end.value = m_Y_end;
+                  {  /* block for the non-range variable n_Y_end */
+                      n_Y_end = redistribute_bound_Receive_inline_c_expr5_line_195(__parsec_tp, &assignments);
+                      assignments.n_Y_end.value = n_Y_end;
+                        __jdf2c_m_Y_start = m_Y_start;
+                        __jdf2c_m_Y_end = m_Y_end;
+                        __jdf2c_m_Y_inc = 1;
+                        __m_Y_min = parsec_imin(__jdf2c_m_Y_start, __jdf2c_m_Y_end);
+                        __m_Y_max = parsec_imax(__jdf2c_m_Y_start, __jdf2c_m_Y_end);
+                        __jdf2c_m_Y_min = parsec_imin(__jdf2c_m_Y_min, __m_Y_min);
+                        __jdf2c_m_Y_max = parsec_imax(__jdf2c_m_Y_max, __m_Y_max);
+                        for(m_Y =  __jdf2c_m_Y_start;
+                            m_Y <= __jdf2c_m_Y_end;
+                            m_Y += __jdf2c_m_Y_inc) {
+                        assignments.m_Y.value = m_Y;
+                          __jdf2c_n_Y_start = n_Y_start;
+                          __jdf2c_n_Y_end = n_Y_end;
+                          __jdf2c_n_Y_inc = 1;
+                          __n_Y_min = parsec_imin(__jdf2c_n_Y_start, __jdf2c_n_Y_end);
+                          __n_Y_max = parsec_imax(__jdf2c_n_Y_start, __jdf2c_n_Y_end);
+                          __jdf2c_n_Y_min = parsec_imin(__jdf2c_n_Y_min, __n_Y_min);
+                          __jdf2c_n_Y_max = parsec_imax(__jdf2c_n_Y_max, __n_Y_max);
+                          for(n_Y =  __jdf2c_n_Y_start;
+                              n_Y <= __jdf2c_n_Y_end;
+                              n_Y += __jdf2c_n_Y_inc) {
+                          assignments.n_Y.value = n_Y;
+                        {  /* block for the non-range variable TL_row */
+                            TL_row = redistribute_bound_Receive_inline_c_expr4_line_200(__parsec_tp, &assignments);
+                            assignments.TL_row.value = TL_row;
+                          {  /* block for the non-range variable TL_col */
+                              TL_col = redistribute_bound_Receive_inline_c_expr3_line_201(__parsec_tp, &assignments);
+                              assignments.TL_col.value = TL_col;
+                            {  /* block for the non-range variable BR_row */
+                                BR_row = ((((i_start + mb_T_inner) - 1) % mb_Y_INNER) + 1);
+                                assignments.BR_row.value = BR_row;
+                              {  /* block for the non-range variable BR_col */
+                                  BR_col = ((((j_start + nb_T_inner) - 1) % nb_Y_INNER) + 1);
+                                  assignments.BR_col.value = BR_col;
+                                {  /* block for the non-range variable rank_Y */
+                                    rank_Y = redistribute_bound_Receive_inline_c_expr2_line_205(__parsec_tp, &assignments);
+                                    assignments.rank_Y.value = rank_Y;
+                                  {  /* block for the non-range variable rank_T */
+                                      rank_T = redistribute_bound_Receive_inline_c_expr1_line_206(__parsec_tp, &assignments);
+                                      assignments.rank_T.value = rank_T;
+                                      if( !Receive_pred(m_T, n_T, mb_T_inner, nb_T_inner, i_start, j_start, m_Y_start, n_Y_start, m_Y_end, n_Y_end, m_Y, n_Y, TL_row, TL_col, BR_row, BR_col, rank_Y, rank_T) ) continue;
+                                      nb_tasks++;
+                                    } /* block for the non-range variable rank_T */ 
+                                  } /* block for the non-range variable rank_Y */ 
+                                } /* block for the non-range variable BR_col */ 
+                              } /* block for the non-range variable BR_row */ 
+                            } /* block for the non-range variable TL_col */ 
+                          } /* block for the non-range variable TL_row */ 
+                        } /* Loop on normal range n_Y */
+                      } /* For loop of m_Y */ 
+                    } /* Non-range variable n_Y_end */ 
+                  } /* Non-range variable m_Y_end */ 
+                } /* Non-range variable n_Y_start */ 
+              } /* Non-range variable m_Y_start */ 
+            } /* Non-range variable j_start */ 
+          } /* Non-range variable i_start */ 
+        } /* Non-range variable nb_T_inner */ 
+      } /* Non-range variable mb_T_inner */ 
+    } /* For loop of n_T */ 
+  } /* For loop of m_T */ 
+   if( 0 != nb_tasks ) {
+     (void)parsec_atomic_fetch_add_int32(&__parsec_tp->initial_number_tasks, nb_tasks);
+   }
+  /* Set the range variables for the collision-free hash-computation */
+  __parsec_tp->Receive_m_T_min   = __jdf2c_m_T_min;
+  __parsec_tp->Receive_m_T_range = (__jdf2c_m_T_max - __jdf2c_m_T_min) + 1;
+  __parsec_tp->Receive_n_T_min   = __jdf2c_n_T_min;
+  __parsec_tp->Receive_n_T_range = (__jdf2c_n_T_max - __jdf2c_n_T_min) + 1;
+  __parsec_tp->Receive_m_Y_min   = __jdf2c_m_Y_min;
+  __parsec_tp->Receive_m_Y_range = (__jdf2c_m_Y_max - __jdf2c_m_Y_min) + 1;
+  __parsec_tp->Receive_n_Y_min   = __jdf2c_n_Y_min;
+  __parsec_tp->Receive_n_Y_range = (__jdf2c_n_Y_max - __jdf2c_n_Y_min) + 1;
+    do {
+      this_task->super.list_next = (parsec_list_item_t*)__parsec_tp->startup_queue;
+    } while(!parsec_atomic_cas_ptr(&__parsec_tp->startup_queue, (parsec_list_item_t*)this_task->super.list_next, this_task));
+    this_task->status = PARSEC_TASK_STATUS_HOOK;
+
+  PARSEC_AYU_REGISTER_TASK(&redistribute_bound_Receive);
+  __parsec_tp->super.super.dependencies_array[1] = PARSEC_OBJ_NEW(parsec_hash_table_t);
+  parsec_hash_table_init(__parsec_tp->super.super.dependencies_array[1], offsetof(parsec_hashable_dependency_t, ht_item), 10, redistribute_bound_redistribute_bound_Receive_internal_init_deps_key_functions, this_task->taskpool);
+  __parsec_tp->repositories[1] = data_repo_create_nothreadsafe(nb_tasks, __jdf2c_key_fns_Receive, (parsec_taskpool_t*)__parsec_tp, 0);
+(void)saved_nb_tasks;
+(void)__m_T_min; (void)__m_T_max;(void)__n_T_min; (void)__n_T_max;(void)__m_Y_min; (void)__m_Y_max;(void)__n_Y_min; (void)__n_Y_max;  (void)__jdf2c_m_T_start; (void)__jdf2c_m_T_end; (void)__jdf2c_m_T_inc;  (void)__jdf2c_n_T_start; (void)__jdf2c_n_T_end; (void)__jdf2c_n_T_inc;  (void)__jdf2c_m_Y_start; (void)__jdf2c_m_Y_end; (void)__jdf2c_m_Y_inc;  (void)__jdf2c_n_Y_start; (void)__jdf2c_n_Y_end; (void)__jdf2c_n_Y_inc;  (void)assignments; (void)__parsec_tp; (void)es;
+  if(1 == parsec_atomic_fetch_dec_int32(&__parsec_tp->sync_point)) {
+    /* Last initialization task complete. Update the number of tasks. */
+    __parsec_tp->super.super.tdm.module->taskpool_addto_nb_tasks(&__parsec_tp->super.super, __parsec_tp->initial_number_tasks);
+    parsec_mfence();  /* write memory barrier to guarantee that the scheduler gets the correct number of tasks */
+    parsec_taskpool_enable((parsec_taskpool_t*)__parsec_tp, &__parsec_tp->startup_queue,
+                           (parsec_task_t*)this_task, es, __parsec_tp->super.super.nb_pending_actions);
+    __parsec_tp->super.super.tdm.module->taskpool_ready(&__parsec_tp->super.super);
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+    PARSEC_PROFILING_TRACE(es->es_profile,
+                           this_task->taskpool->profiling_array[2 * this_task->task_class->task_class_id + 1],
+                           0,
+                           this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    if( 1 >= __parsec_tp->super.super.nb_pending_actions ) {
+        /* if no tasks will be generated let's prevent the runtime from calling the hook and instead go directly to complete the task */
+        this_task->status = PARSEC_TASK_STATUS_COMPLETE;
+    }
+    return PARSEC_HOOK_RETURN_DONE;
+  }
+  return PARSEC_HOOK_RETURN_ASYNC;
+}
+
+static int __jdf2c_startup_Receive(parsec_execution_stream_t * es, __parsec_redistribute_bound_Receive_task_t *this_task)
+{
+  __parsec_redistribute_bound_Receive_task_t* new_task;
+  __parsec_redistribute_bound_internal_taskpool_t* __parsec_tp = (__parsec_redistribute_bound_internal_taskpool_t*)this_task->taskpool;
+  parsec_context_t *context = __parsec_tp->super.super.context;
+  int vpid = 0, nb_tasks = 0;
+  size_t total_nb_tasks = 0;
+  parsec_list_item_t* pready_ring[context->nb_vp];
+  int restore_context = 0;
+  int m_T = this_task->locals.m_T.value;  /* retrieve value saved during the last iteration */
+  int n_T = this_task->locals.n_T.value;  /* retrieve value saved during the last iteration */
+  int mb_T_inner = this_task->locals.mb_T_inner.value;  /* retrieve value saved during the last iteration */
+  int nb_T_inner = this_task->locals.nb_T_inner.value;  /* retrieve value saved during the last iteration */
+  int i_start = this_task->locals.i_start.value;  /* retrieve value saved during the last iteration */
+  int j_start = this_task->locals.j_start.value;  /* retrieve value saved during the last iteration */
+  int m_Y_start = this_task->locals.m_Y_start.value;  /* retrieve value saved during the last iteration */
+  int n_Y_start = this_task->locals.n_Y_start.value;  /* retrieve value saved during the last iteration */
+  int m_Y_end = this_task->locals.m_Y_end.value;  /* retrieve value saved during the last iteration */
+  int n_Y_end = this_task->locals.n_Y_end.value;  /* retrieve value saved during the last iteration */
+  int m_Y = this_task->locals.m_Y.value;  /* retrieve value saved during the last iteration */
+  int n_Y = this_task->locals.n_Y.value;  /* retrieve value saved during the last iteration */
+  int TL_row = this_task->locals.TL_row.value;  /* retrieve value saved during the last iteration */
+  int TL_col = this_task->locals.TL_col.value;  /* retrieve value saved during the last iteration */
+  int BR_row = this_task->locals.BR_row.value;  /* retrieve value saved during the last iteration */
+  int BR_col = this_task->locals.BR_col.value;  /* retrieve value saved during the last iteration */
+  int rank_Y = this_task->locals.rank_Y.value;  /* retrieve value saved during the last iteration */
+  int rank_T = this_task->locals.rank_T.value;  /* retrieve value saved during the last iteration */
+  for(int _i = 0; _i < context->nb_vp; pready_ring[_i++] = NULL );
+  if( 0 != this_task->locals.reserved[0].value ) {
+    this_task->locals.reserved[0].value = 1; /* reset the submission process */
+    restore_context = 1;
+    goto restore_context_0;
+  }
+  this_task->locals.reserved[0].value = 1; /* a sane default value */
+  for(this_task->locals.m_T.value = m_T = m_T_START;
+      this_task->locals.m_T.value <= m_T_END;
+      this_task->locals.m_T.value += 1, m_T = this_task->locals.m_T.value) {
+    for(this_task->locals.n_T.value = n_T = n_T_START;
+        this_task->locals.n_T.value <= n_T_END;
+        this_task->locals.n_T.value += 1, n_T = this_task->locals.n_T.value) {
+      this_task->locals.mb_T_inner.value = mb_T_inner = redistribute_bound_Receive_inline_c_expr12_line_186(__parsec_tp, &this_task->locals);
+      this_task->locals.nb_T_inner.value = nb_T_inner = redistribute_bound_Receive_inline_c_expr11_line_187(__parsec_tp, &this_task->locals);
+      this_task->locals.i_start.value = i_start = redistribute_bound_Receive_inline_c_expr10_line_189(__parsec_tp, &this_task->locals);
+      this_task->locals.j_start.value = j_start = redistribute_bound_Receive_inline_c_expr9_line_190(__parsec_tp, &this_task->locals);
+      this_task->locals.m_Y_start.value = m_Y_start = redistribute_bound_Receive_inline_c_expr8_line_192(__parsec_tp, &this_task->locals);
+      this_task->locals.n_Y_start.value = n_Y_start = redistribute_bound_Receive_inline_c_expr7_line_193(__parsec_tp, &this_task->locals);
+      this_task->locals.m_Y_end.value = m_Y_end = redistribute_bound_Receive_inline_c_expr6_line_194(__parsec_tp, &this_task->locals);
+      this_task->locals.n_Y_end.value = n_Y_end = redistribute_bound_Receive_inline_c_expr5_line_195(__parsec_tp, &this_task->locals);
+      for(this_task->locals.m_Y.value = m_Y = m_Y_start;
+          this_task->locals.m_Y.value <= m_Y_end;
+          this_task->locals.m_Y.value += 1, m_Y = this_task->locals.m_Y.value) {
+        for(this_task->locals.n_Y.value = n_Y = n_Y_start;
+            this_task->locals.n_Y.value <= n_Y_end;
+            this_task->locals.n_Y.value += 1, n_Y = this_task->locals.n_Y.value) {
+          this_task->locals.TL_row.value = TL_row = redistribute_bound_Receive_inline_c_expr4_line_200(__parsec_tp, &this_task->locals);
+          this_task->locals.TL_col.value = TL_col = redistribute_bound_Receive_inline_c_expr3_line_201(__parsec_tp, &this_task->locals);
+          this_task->locals.BR_row.value = BR_row = ((((i_start + mb_T_inner) - 1) % mb_Y_INNER) + 1);
+          this_task->locals.BR_col.value = BR_col = ((((j_start + nb_T_inner) - 1) % nb_Y_INNER) + 1);
+          this_task->locals.rank_Y.value = rank_Y = redistribute_bound_Receive_inline_c_expr2_line_205(__parsec_tp, &this_task->locals);
+          this_task->locals.rank_T.value = rank_T = redistribute_bound_Receive_inline_c_expr1_line_206(__parsec_tp, &this_task->locals);
+          if( !Receive_pred(m_T, n_T, mb_T_inner, nb_T_inner, i_start, j_start, m_Y_start, n_Y_start, m_Y_end, n_Y_end, m_Y, n_Y, TL_row, TL_col, BR_row, BR_col, rank_Y, rank_T) ) continue;
+  __parsec_redistribute_bound_Receive_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_redistribute_bound_Receive_parsec_assignment_t*)&this_task->locals;
+  (void)__jdf2c__tmp_locals;
+          if( NULL != ((parsec_data_collection_t*)__parsec_tp->super._g_descT)->vpid_of ) {
+            vpid = ((parsec_data_collection_t*)__parsec_tp->super._g_descT)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descT, m_T, n_T);
+            assert(context->nb_vp >= vpid);
+          } else {
+            vpid = (vpid + 1) % context->nb_vp;  /* spread the initial joy */
+          }
+          new_task = (__parsec_redistribute_bound_Receive_task_t*)parsec_thread_mempool_allocate( context->virtual_processes[vpid]->execution_streams[0]->context_mempool );
+          PARSEC_OBJ_CONSTRUCT(new_task, parsec_task_t); /* construct called only when new, force-construct it again */
+          /* Copy only the valid elements from this_task to new_task one */
+          new_task->taskpool   = this_task->taskpool;
+          new_task->task_class = __parsec_tp->super.super.task_classes_array[redistribute_bound_Receive.task_class_id];
+          new_task->chore_mask   = PARSEC_DEV_ALL;
+          new_task->locals.m_T.value = this_task->locals.m_T.value;
+          new_task->locals.n_T.value = this_task->locals.n_T.value;
+          new_task->locals.mb_T_inner.value = this_task->locals.mb_T_inner.value;
+          new_task->locals.nb_T_inner.value = this_task->locals.nb_T_inner.value;
+          new_task->locals.i_start.value = this_task->locals.i_start.value;
+          new_task->locals.j_start.value = this_task->locals.j_start.value;
+          new_task->locals.m_Y_start.value = this_task->locals.m_Y_start.value;
+          new_task->locals.n_Y_start.value = this_task->locals.n_Y_start.value;
+          new_task->locals.m_Y_end.value = this_task->locals.m_Y_end.value;
+          new_task->locals.n_Y_end.value = this_task->locals.n_Y_end.value;
+          new_task->locals.m_Y.value = this_task->locals.m_Y.value;
+          new_task->locals.n_Y.value = this_task->locals.n_Y.value;
+          new_task->locals.TL_row.value = this_task->locals.TL_row.value;
+          new_task->locals.TL_col.value = this_task->locals.TL_col.value;
+          new_task->locals.BR_row.value = this_task->locals.BR_row.value;
+          new_task->locals.BR_col.value = this_task->locals.BR_col.value;
+          new_task->locals.rank_Y.value = this_task->locals.rank_Y.value;
+          new_task->locals.rank_T.value = this_task->locals.rank_T.value;
+          PARSEC_LIST_ITEM_SINGLETON(new_task);
+          new_task->priority = __parsec_tp->super.super.priority;
+          new_task->repo_entry = NULL;
+#if defined(PARSEC_DEBUG_NOISIER)
+          {
+            char tmp[128];
+            PARSEC_DEBUG_VERBOSE(10, parsec_debug_output, "Add startup task %s to vpid %d",
+                   parsec_task_snprintf(tmp, 128, (parsec_task_t*)new_task), vpid);
+          }
+#endif
+          parsec_dependencies_mark_task_as_startup((parsec_task_t*)new_task, es);
+          pready_ring[vpid] = parsec_list_item_ring_push_sorted(pready_ring[vpid],
+                                                                (parsec_list_item_t*)new_task,
+                                                                parsec_execution_context_priority_comparator);
+          nb_tasks++;
+         restore_context_0:  /* we jump here just so that we have code after the label */
+          restore_context = 0;
+          (void)restore_context;
+          if( nb_tasks > this_task->locals.reserved[0].value ) {
+            if( (size_t)this_task->locals.reserved[0].value < parsec_task_startup_iter ) this_task->locals.reserved[0].value <<= 1;
+            __parsec_schedule_vp(es, (parsec_task_t**)pready_ring, 0);
+            total_nb_tasks += nb_tasks;
+            nb_tasks = 0;
+            if( total_nb_tasks > parsec_task_startup_chunk ) {  /* stop here and request to be rescheduled */
+              return PARSEC_HOOK_RETURN_AGAIN;
+            }
+          }
+        } /* Loop on normal range n_Y */
+      } /* Loop on normal range m_Y */
+    } /* Loop on normal range n_T */
+  } /* Loop on normal range m_T */
+  (void)vpid;
+  if( 0 != nb_tasks ) {
+    __parsec_schedule_vp(es, (parsec_task_t**)pready_ring, 0);
+    nb_tasks = 0;
+  }
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static const __parsec_chore_t __redistribute_bound_Receive_chores[] ={
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+    { .type     = PARSEC_DEV_CPU,
+      .evaluate = (parsec_evaluate_function_t*)NULL,
+      .hook     = (parsec_hook_t*)hook_of_redistribute_bound_Receive },
+#endif  /* defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+    { .type     = PARSEC_DEV_NONE,
+      .evaluate = NULL,
+      .hook     = (parsec_hook_t*)NULL },  /* End marker */
+};
+
+static const parsec_task_class_t redistribute_bound_Receive = {
+  .name = "Receive",
+  .task_class_id = 1,
+  .nb_flows = 0,
+  .nb_parameters = 4,
+  .nb_locals = 18,
+  .task_class_type = PARSEC_TASK_CLASS_TYPE_PTG,
+  .params = { &symb_redistribute_bound_Receive_m_Y, &symb_redistribute_bound_Receive_n_Y, &symb_redistribute_bound_Receive_m_T, &symb_redistribute_bound_Receive_n_T, NULL },
+  .locals = { &symb_redistribute_bound_Receive_m_T, &symb_redistribute_bound_Receive_n_T, &symb_redistribute_bound_Receive_mb_T_inner, &symb_redistribute_bound_Receive_nb_T_inner, &symb_redistribute_bound_Receive_i_start, &symb_redistribute_bound_Receive_j_start, &symb_redistribute_bound_Receive_m_Y_start, &symb_redistribute_bound_Receive_n_Y_start, &symb_redistribute_bound_Receive_m_Y_end, &symb_redistribute_bound_Receive_n_Y_end, &symb_redistribute_bound_Receive_m_Y, &symb_redistribute_bound_Receive_n_Y, &symb_redistribute_bound_Receive_TL_row, &symb_redistribute_bound_Receive_TL_col, &symb_redistribute_bound_Receive_BR_row, &symb_redistribute_bound_Receive_BR_col, &symb_redistribute_bound_Receive_rank_Y, &symb_redistribute_bound_Receive_rank_T, NULL },
+  .data_affinity = (parsec_data_ref_fn_t*)affinity_of_redistribute_bound_Receive,
+  .initial_data = (parsec_data_ref_fn_t*)affinity_of_redistribute_bound_Receive,
+  .final_data = (parsec_data_ref_fn_t*)affinity_of_redistribute_bound_Receive,
+  .priority = NULL,
+  .properties = properties_of_redistribute_bound_Receive,
+#if MAX_PARAM_COUNT < 0  /* number of read flows of Receive */
+  #error Too many read flows for task Receive
+#endif  /* MAX_PARAM_COUNT */
+#if MAX_PARAM_COUNT < 0  /* number of write flows of Receive */
+  #error Too many write flows for task Receive
+#endif  /* MAX_PARAM_COUNT */
+  .in = { NULL },
+  .out = { NULL },
+  .flags = 0x0 | PARSEC_USE_DEPS_MASK,
+  .dependencies_goal = 0x0,
+  .make_key = __jdf2c_make_key_Receive,
+  .task_snprintf = parsec_task_snprintf,
+#if defined(PARSEC_PROF_TRACE)
+  .profile_info = &parsec_task_profile_info,
+#endif
+  .key_functions = &__jdf2c_key_fns_Receive,
+  .fini = (parsec_hook_t*)NULL,
+  .incarnations = __redistribute_bound_Receive_chores,
+  .find_deps = parsec_hash_find_deps,
+  .update_deps = parsec_update_deps_with_mask,
+  .iterate_successors = (parsec_traverse_function_t*)NULL,
+  .iterate_predecessors = (parsec_traverse_function_t*)NULL,
+  .release_deps = (parsec_release_deps_t*)release_deps_of_redistribute_bound_Receive,
+  .prepare_output = (parsec_hook_t*)NULL,
+  .prepare_input = (parsec_hook_t*)data_lookup_of_redistribute_bound_Receive,
+  .time_estimate = NULL,
+  .get_datatype = datatype_lookup_of_redistribute_bound_Receive,
+  .complete_execution = (parsec_hook_t*)complete_hook_of_redistribute_bound_Receive,
+  .release_task = &release_task_of_redistribute_bound_Receive,
+#if defined(PARSEC_SIM)
+  .sim_cost_fct = (parsec_sim_cost_fct_t*)NULL,
+#endif
+};
+
+
+/******                                      Send                                      ******/
+
+static inline int minexpr_of_symb_redistribute_bound_Send_m_Y_fct(const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_bound_Send_parsec_assignment_t *locals)
+{
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+  const int mb_Y_inner = locals->mb_Y_inner.value; (void)mb_Y_inner;
+  const int nb_Y_inner = locals->nb_Y_inner.value; (void)nb_Y_inner;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int m_T_start = locals->m_T_start.value; (void)m_T_start;
+  const int n_T_start = locals->n_T_start.value; (void)n_T_start;
+  const int m_T_end = locals->m_T_end.value; (void)m_T_end;
+  const int n_T_end = locals->n_T_end.value; (void)n_T_end;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int TL_row = locals->TL_row.value; (void)TL_row;
+  const int TL_col = locals->TL_col.value; (void)TL_col;
+  const int BR_row = locals->BR_row.value; (void)BR_row;
+  const int BR_col = locals->BR_col.value; (void)BR_col;
+  const int rank_Y = locals->rank_Y.value; (void)rank_Y;
+  const int rank_T = locals->rank_T.value; (void)rank_T;
+
+  (void)m_Y;
+  (void)n_Y;
+  (void)mb_Y_inner;
+  (void)nb_Y_inner;
+  (void)i_start;
+  (void)j_start;
+  (void)m_T_start;
+  (void)n_T_start;
+  (void)m_T_end;
+  (void)n_T_end;
+  (void)m_T;
+  (void)n_T;
+  (void)TL_row;
+  (void)TL_col;
+  (void)BR_row;
+  (void)BR_col;
+  (void)rank_Y;
+  (void)rank_T;
+  (void)__parsec_tp; (void)locals;
+  return m_Y_START;
+}
+static const parsec_expr_t minexpr_of_symb_redistribute_bound_Send_m_Y = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_redistribute_bound_Send_m_Y_fct }
+                   }
+};
+static inline int maxexpr_of_symb_redistribute_bound_Send_m_Y_fct(const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_bound_Send_parsec_assignment_t *locals)
+{
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+  const int mb_Y_inner = locals->mb_Y_inner.value; (void)mb_Y_inner;
+  const int nb_Y_inner = locals->nb_Y_inner.value; (void)nb_Y_inner;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int m_T_start = locals->m_T_start.value; (void)m_T_start;
+  const int n_T_start = locals->n_T_start.value; (void)n_T_start;
+  const int m_T_end = locals->m_T_end.value; (void)m_T_end;
+  const int n_T_end = locals->n_T_end.value; (void)n_T_end;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int TL_row = locals->TL_row.value; (void)TL_row;
+  const int TL_col = locals->TL_col.value; (void)TL_col;
+  const int BR_row = locals->BR_row.value; (void)BR_row;
+  const int BR_col = locals->BR_col.value; (void)BR_col;
+  const int rank_Y = locals->rank_Y.value; (void)rank_Y;
+  const int rank_T = locals->rank_T.value; (void)rank_T;
+
+  (void)m_Y;
+  (void)n_Y;
+  (void)mb_Y_inner;
+  (void)nb_Y_inner;
+  (void)i_start;
+  (void)j_start;
+  (void)m_T_start;
+  (void)n_T_start;
+  (void)m_T_end;
+  (void)n_T_end;
+  (void)m_T;
+  (void)n_T;
+  (void)TL_row;
+  (void)TL_col;
+  (void)BR_row;
+  (void)BR_col;
+  (void)rank_Y;
+  (void)rank_T;
+  (void)__parsec_tp; (void)locals;
+  return m_Y_END;
+}
+static const parsec_expr_t maxexpr_of_symb_redistribute_bound_Send_m_Y = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_redistribute_bound_Send_m_Y_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_bound_Send_m_Y = { .name = "m_Y", .context_index = 0, .min = &minexpr_of_symb_redistribute_bound_Send_m_Y, .max = &maxexpr_of_symb_redistribute_bound_Send_m_Y, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int minexpr_of_symb_redistribute_bound_Send_n_Y_fct(const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_bound_Send_parsec_assignment_t *locals)
+{
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+  const int mb_Y_inner = locals->mb_Y_inner.value; (void)mb_Y_inner;
+  const int nb_Y_inner = locals->nb_Y_inner.value; (void)nb_Y_inner;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int m_T_start = locals->m_T_start.value; (void)m_T_start;
+  const int n_T_start = locals->n_T_start.value; (void)n_T_start;
+  const int m_T_end = locals->m_T_end.value; (void)m_T_end;
+  const int n_T_end = locals->n_T_end.value; (void)n_T_end;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int TL_row = locals->TL_row.value; (void)TL_row;
+  const int TL_col = locals->TL_col.value; (void)TL_col;
+  const int BR_row = locals->BR_row.value; (void)BR_row;
+  const int BR_col = locals->BR_col.value; (void)BR_col;
+  const int rank_Y = locals->rank_Y.value; (void)rank_Y;
+  const int rank_T = locals->rank_T.value; (void)rank_T;
+
+  (void)m_Y;
+  (void)n_Y;
+  (void)mb_Y_inner;
+  (void)nb_Y_inner;
+  (void)i_start;
+  (void)j_start;
+  (void)m_T_start;
+  (void)n_T_start;
+  (void)m_T_end;
+  (void)n_T_end;
+  (void)m_T;
+  (void)n_T;
+  (void)TL_row;
+  (void)TL_col;
+  (void)BR_row;
+  (void)BR_col;
+  (void)rank_Y;
+  (void)rank_T;
+  (void)__parsec_tp; (void)locals;
+  return n_Y_START;
+}
+static const parsec_expr_t minexpr_of_symb_redistribute_bound_Send_n_Y = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_redistribute_bound_Send_n_Y_fct }
+                   }
+};
+static inline int maxexpr_of_symb_redistribute_bound_Send_n_Y_fct(const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_bound_Send_parsec_assignment_t *locals)
+{
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+  const int mb_Y_inner = locals->mb_Y_inner.value; (void)mb_Y_inner;
+  const int nb_Y_inner = locals->nb_Y_inner.value; (void)nb_Y_inner;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int m_T_start = locals->m_T_start.value; (void)m_T_start;
+  const int n_T_start = locals->n_T_start.value; (void)n_T_start;
+  const int m_T_end = locals->m_T_end.value; (void)m_T_end;
+  const int n_T_end = locals->n_T_end.value; (void)n_T_end;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int TL_row = locals->TL_row.value; (void)TL_row;
+  const int TL_col = locals->TL_col.value; (void)TL_col;
+  const int BR_row = locals->BR_row.value; (void)BR_row;
+  const int BR_col = locals->BR_col.value; (void)BR_col;
+  const int rank_Y = locals->rank_Y.value; (void)rank_Y;
+  const int rank_T = locals->rank_T.value; (void)rank_T;
+
+  (void)m_Y;
+  (void)n_Y;
+  (void)mb_Y_inner;
+  (void)nb_Y_inner;
+  (void)i_start;
+  (void)j_start;
+  (void)m_T_start;
+  (void)n_T_start;
+  (void)m_T_end;
+  (void)n_T_end;
+  (void)m_T;
+  (void)n_T;
+  (void)TL_row;
+  (void)TL_col;
+  (void)BR_row;
+  (void)BR_col;
+  (void)rank_Y;
+  (void)rank_T;
+  (void)__parsec_tp; (void)locals;
+  return n_Y_END;
+}
+static const parsec_expr_t maxexpr_of_symb_redistribute_bound_Send_n_Y = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_redistribute_bound_Send_n_Y_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_bound_Send_n_Y = { .name = "n_Y", .context_index = 1, .min = &minexpr_of_symb_redistribute_bound_Send_n_Y, .max = &maxexpr_of_symb_redistribute_bound_Send_n_Y, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int32_t expr_of_symb_redistribute_bound_Send_mb_Y_inner_fct(const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_bound_Send_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_bound_Send_inline_c_expr24_line_134(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_redistribute_bound_Send_mb_Y_inner = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_bound_Send_mb_Y_inner_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_bound_Send_mb_Y_inner = { .name = "mb_Y_inner", .context_index = 2, .min = &expr_of_symb_redistribute_bound_Send_mb_Y_inner, .max = &expr_of_symb_redistribute_bound_Send_mb_Y_inner, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_redistribute_bound_Send_nb_Y_inner_fct(const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_bound_Send_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_bound_Send_inline_c_expr23_line_135(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_redistribute_bound_Send_nb_Y_inner = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_bound_Send_nb_Y_inner_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_bound_Send_nb_Y_inner = { .name = "nb_Y_inner", .context_index = 3, .min = &expr_of_symb_redistribute_bound_Send_nb_Y_inner, .max = &expr_of_symb_redistribute_bound_Send_nb_Y_inner, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_redistribute_bound_Send_i_start_fct(const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_bound_Send_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_bound_Send_inline_c_expr22_line_137(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_redistribute_bound_Send_i_start = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_bound_Send_i_start_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_bound_Send_i_start = { .name = "i_start", .context_index = 4, .min = &expr_of_symb_redistribute_bound_Send_i_start, .max = &expr_of_symb_redistribute_bound_Send_i_start, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_redistribute_bound_Send_j_start_fct(const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_bound_Send_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_bound_Send_inline_c_expr21_line_138(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_redistribute_bound_Send_j_start = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_bound_Send_j_start_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_bound_Send_j_start = { .name = "j_start", .context_index = 5, .min = &expr_of_symb_redistribute_bound_Send_j_start, .max = &expr_of_symb_redistribute_bound_Send_j_start, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_redistribute_bound_Send_m_T_start_fct(const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_bound_Send_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_bound_Send_inline_c_expr20_line_140(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_redistribute_bound_Send_m_T_start = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_bound_Send_m_T_start_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_bound_Send_m_T_start = { .name = "m_T_start", .context_index = 6, .min = &expr_of_symb_redistribute_bound_Send_m_T_start, .max = &expr_of_symb_redistribute_bound_Send_m_T_start, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_redistribute_bound_Send_n_T_start_fct(const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_bound_Send_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_bound_Send_inline_c_expr19_line_141(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_redistribute_bound_Send_n_T_start = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_bound_Send_n_T_start_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_bound_Send_n_T_start = { .name = "n_T_start", .context_index = 7, .min = &expr_of_symb_redistribute_bound_Send_n_T_start, .max = &expr_of_symb_redistribute_bound_Send_n_T_start, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_redistribute_bound_Send_m_T_end_fct(const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_bound_Send_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_bound_Send_inline_c_expr18_line_143(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_redistribute_bound_Send_m_T_end = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_bound_Send_m_T_end_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_bound_Send_m_T_end = { .name = "m_T_end", .context_index = 8, .min = &expr_of_symb_redistribute_bound_Send_m_T_end, .max = &expr_of_symb_redistribute_bound_Send_m_T_end, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_redistribute_bound_Send_n_T_end_fct(const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_bound_Send_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_bound_Send_inline_c_expr17_line_144(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_redistribute_bound_Send_n_T_end = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_bound_Send_n_T_end_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_bound_Send_n_T_end = { .name = "n_T_end", .context_index = 9, .min = &expr_of_symb_redistribute_bound_Send_n_T_end, .max = &expr_of_symb_redistribute_bound_Send_n_T_end, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int minexpr_of_symb_redistribute_bound_Send_m_T_fct(const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_bound_Send_parsec_assignment_t *locals)
+{
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+  const int mb_Y_inner = locals->mb_Y_inner.value; (void)mb_Y_inner;
+  const int nb_Y_inner = locals->nb_Y_inner.value; (void)nb_Y_inner;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int m_T_start = locals->m_T_start.value;
+  const int n_T_start = locals->n_T_start.value; (void)n_T_start;
+  const int m_T_end = locals->m_T_end.value; (void)m_T_end;
+  const int n_T_end = locals->n_T_end.value; (void)n_T_end;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int TL_row = locals->TL_row.value; (void)TL_row;
+  const int TL_col = locals->TL_col.value; (void)TL_col;
+  const int BR_row = locals->BR_row.value; (void)BR_row;
+  const int BR_col = locals->BR_col.value; (void)BR_col;
+  const int rank_Y = locals->rank_Y.value; (void)rank_Y;
+  const int rank_T = locals->rank_T.value; (void)rank_T;
+
+  (void)m_Y;
+  (void)n_Y;
+  (void)mb_Y_inner;
+  (void)nb_Y_inner;
+  (void)i_start;
+  (void)j_start;
+  (void)m_T_start;
+  (void)n_T_start;
+  (void)m_T_end;
+  (void)n_T_end;
+  (void)m_T;
+  (void)n_T;
+  (void)TL_row;
+  (void)TL_col;
+  (void)BR_row;
+  (void)BR_col;
+  (void)rank_Y;
+  (void)rank_T;
+  (void)__parsec_tp; (void)locals;
+  return m_T_start;
+}
+static const parsec_expr_t minexpr_of_symb_redistribute_bound_Send_m_T = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_redistribute_bound_Send_m_T_fct }
+                   }
+};
+static inline int maxexpr_of_symb_redistribute_bound_Send_m_T_fct(const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_bound_Send_parsec_assignment_t *locals)
+{
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+  const int mb_Y_inner = locals->mb_Y_inner.value; (void)mb_Y_inner;
+  const int nb_Y_inner = locals->nb_Y_inner.value; (void)nb_Y_inner;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int m_T_start = locals->m_T_start.value; (void)m_T_start;
+  const int n_T_start = locals->n_T_start.value; (void)n_T_start;
+  const int m_T_end = locals->m_T_end.value;
+  const int n_T_end = locals->n_T_end.value; (void)n_T_end;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int TL_row = locals->TL_row.value; (void)TL_row;
+  const int TL_col = locals->TL_col.value; (void)TL_col;
+  const int BR_row = locals->BR_row.value; (void)BR_row;
+  const int BR_col = locals->BR_col.value; (void)BR_col;
+  const int rank_Y = locals->rank_Y.value; (void)rank_Y;
+  const int rank_T = locals->rank_T.value; (void)rank_T;
+
+  (void)m_Y;
+  (void)n_Y;
+  (void)mb_Y_inner;
+  (void)nb_Y_inner;
+  (void)i_start;
+  (void)j_start;
+  (void)m_T_start;
+  (void)n_T_start;
+  (void)m_T_end;
+  (void)n_T_end;
+  (void)m_T;
+  (void)n_T;
+  (void)TL_row;
+  (void)TL_col;
+  (void)BR_row;
+  (void)BR_col;
+  (void)rank_Y;
+  (void)rank_T;
+  (void)__parsec_tp; (void)locals;
+  return m_T_end;
+}
+static const parsec_expr_t maxexpr_of_symb_redistribute_bound_Send_m_T = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_redistribute_bound_Send_m_T_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_bound_Send_m_T = { .name = "m_T", .context_index = 10, .min = &minexpr_of_symb_redistribute_bound_Send_m_T, .max = &maxexpr_of_symb_redistribute_bound_Send_m_T, .cst_inc = 1, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int minexpr_of_symb_redistribute_bound_Send_n_T_fct(const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_bound_Send_parsec_assignment_t *locals)
+{
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+  const int mb_Y_inner = locals->mb_Y_inner.value; (void)mb_Y_inner;
+  const int nb_Y_inner = locals->nb_Y_inner.value; (void)nb_Y_inner;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int m_T_start = locals->m_T_start.value; (void)m_T_start;
+  const int n_T_start = locals->n_T_start.value;
+  const int m_T_end = locals->m_T_end.value; (void)m_T_end;
+  const int n_T_end = locals->n_T_end.value; (void)n_T_end;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int TL_row = locals->TL_row.value; (void)TL_row;
+  const int TL_col = locals->TL_col.value; (void)TL_col;
+  const int BR_row = locals->BR_row.value; (void)BR_row;
+  const int BR_col = locals->BR_col.value; (void)BR_col;
+  const int rank_Y = locals->rank_Y.value; (void)rank_Y;
+  const int rank_T = locals->rank_T.value; (void)rank_T;
+
+  (void)m_Y;
+  (void)n_Y;
+  (void)mb_Y_inner;
+  (void)nb_Y_inner;
+  (void)i_start;
+  (void)j_start;
+  (void)m_T_start;
+  (void)n_T_start;
+  (void)m_T_end;
+  (void)n_T_end;
+  (void)m_T;
+  (void)n_T;
+  (void)TL_row;
+  (void)TL_col;
+  (void)BR_row;
+  (void)BR_col;
+  (void)rank_Y;
+  (void)rank_T;
+  (void)__parsec_tp; (void)locals;
+  return n_T_start;
+}
+static const parsec_expr_t minexpr_of_symb_redistribute_bound_Send_n_T = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_redistribute_bound_Send_n_T_fct }
+                   }
+};
+static inline int maxexpr_of_symb_redistribute_bound_Send_n_T_fct(const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_bound_Send_parsec_assignment_t *locals)
+{
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+  const int mb_Y_inner = locals->mb_Y_inner.value; (void)mb_Y_inner;
+  const int nb_Y_inner = locals->nb_Y_inner.value; (void)nb_Y_inner;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int m_T_start = locals->m_T_start.value; (void)m_T_start;
+  const int n_T_start = locals->n_T_start.value; (void)n_T_start;
+  const int m_T_end = locals->m_T_end.value; (void)m_T_end;
+  const int n_T_end = locals->n_T_end.value;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int TL_row = locals->TL_row.value; (void)TL_row;
+  const int TL_col = locals->TL_col.value; (void)TL_col;
+  const int BR_row = locals->BR_row.value; (void)BR_row;
+  const int BR_col = locals->BR_col.value; (void)BR_col;
+  const int rank_Y = locals->rank_Y.value; (void)rank_Y;
+  const int rank_T = locals->rank_T.value; (void)rank_T;
+
+  (void)m_Y;
+  (void)n_Y;
+  (void)mb_Y_inner;
+  (void)nb_Y_inner;
+  (void)i_start;
+  (void)j_start;
+  (void)m_T_start;
+  (void)n_T_start;
+  (void)m_T_end;
+  (void)n_T_end;
+  (void)m_T;
+  (void)n_T;
+  (void)TL_row;
+  (void)TL_col;
+  (void)BR_row;
+  (void)BR_col;
+  (void)rank_Y;
+  (void)rank_T;
+  (void)__parsec_tp; (void)locals;
+  return n_T_end;
+}
+static const parsec_expr_t maxexpr_of_symb_redistribute_bound_Send_n_T = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_redistribute_bound_Send_n_T_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_bound_Send_n_T = { .name = "n_T", .context_index = 11, .min = &minexpr_of_symb_redistribute_bound_Send_n_T, .max = &maxexpr_of_symb_redistribute_bound_Send_n_T, .cst_inc = 1, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_redistribute_bound_Send_TL_row_fct(const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_bound_Send_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_bound_Send_inline_c_expr16_line_149(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_redistribute_bound_Send_TL_row = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_bound_Send_TL_row_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_bound_Send_TL_row = { .name = "TL_row", .context_index = 12, .min = &expr_of_symb_redistribute_bound_Send_TL_row, .max = &expr_of_symb_redistribute_bound_Send_TL_row, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_redistribute_bound_Send_TL_col_fct(const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_bound_Send_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_bound_Send_inline_c_expr15_line_150(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_redistribute_bound_Send_TL_col = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_bound_Send_TL_col_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_bound_Send_TL_col = { .name = "TL_col", .context_index = 13, .min = &expr_of_symb_redistribute_bound_Send_TL_col, .max = &expr_of_symb_redistribute_bound_Send_TL_col, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int expr_of_symb_redistribute_bound_Send_BR_row_fct(const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_bound_Send_parsec_assignment_t *locals)
+{
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+  const int mb_Y_inner = locals->mb_Y_inner.value; (void)mb_Y_inner;
+  const int nb_Y_inner = locals->nb_Y_inner.value; (void)nb_Y_inner;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int m_T_start = locals->m_T_start.value; (void)m_T_start;
+  const int n_T_start = locals->n_T_start.value; (void)n_T_start;
+  const int m_T_end = locals->m_T_end.value; (void)m_T_end;
+  const int n_T_end = locals->n_T_end.value; (void)n_T_end;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int TL_row = locals->TL_row.value; (void)TL_row;
+  const int TL_col = locals->TL_col.value; (void)TL_col;
+  const int BR_row = locals->BR_row.value; (void)BR_row;
+  const int BR_col = locals->BR_col.value; (void)BR_col;
+  const int rank_Y = locals->rank_Y.value; (void)rank_Y;
+  const int rank_T = locals->rank_T.value; (void)rank_T;
+
+  (void)m_Y;
+  (void)n_Y;
+  (void)mb_Y_inner;
+  (void)nb_Y_inner;
+  (void)i_start;
+  (void)j_start;
+  (void)m_T_start;
+  (void)n_T_start;
+  (void)m_T_end;
+  (void)n_T_end;
+  (void)m_T;
+  (void)n_T;
+  (void)TL_row;
+  (void)TL_col;
+  (void)BR_row;
+  (void)BR_col;
+  (void)rank_Y;
+  (void)rank_T;
+  (void)__parsec_tp; (void)locals;
+  return ((((i_start + mb_Y_inner) - 1) % mb_T_INNER) + 1);
+}
+static const parsec_expr_t expr_of_symb_redistribute_bound_Send_BR_row = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_bound_Send_BR_row_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_bound_Send_BR_row = { .name = "BR_row", .context_index = 14, .min = &expr_of_symb_redistribute_bound_Send_BR_row, .max = &expr_of_symb_redistribute_bound_Send_BR_row, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int expr_of_symb_redistribute_bound_Send_BR_col_fct(const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_bound_Send_parsec_assignment_t *locals)
+{
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+  const int mb_Y_inner = locals->mb_Y_inner.value; (void)mb_Y_inner;
+  const int nb_Y_inner = locals->nb_Y_inner.value; (void)nb_Y_inner;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int m_T_start = locals->m_T_start.value; (void)m_T_start;
+  const int n_T_start = locals->n_T_start.value; (void)n_T_start;
+  const int m_T_end = locals->m_T_end.value; (void)m_T_end;
+  const int n_T_end = locals->n_T_end.value; (void)n_T_end;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int TL_row = locals->TL_row.value; (void)TL_row;
+  const int TL_col = locals->TL_col.value; (void)TL_col;
+  const int BR_row = locals->BR_row.value; (void)BR_row;
+  const int BR_col = locals->BR_col.value; (void)BR_col;
+  const int rank_Y = locals->rank_Y.value; (void)rank_Y;
+  const int rank_T = locals->rank_T.value; (void)rank_T;
+
+  (void)m_Y;
+  (void)n_Y;
+  (void)mb_Y_inner;
+  (void)nb_Y_inner;
+  (void)i_start;
+  (void)j_start;
+  (void)m_T_start;
+  (void)n_T_start;
+  (void)m_T_end;
+  (void)n_T_end;
+  (void)m_T;
+  (void)n_T;
+  (void)TL_row;
+  (void)TL_col;
+  (void)BR_row;
+  (void)BR_col;
+  (void)rank_Y;
+  (void)rank_T;
+  (void)__parsec_tp; (void)locals;
+  return ((((j_start + nb_Y_inner) - 1) % nb_T_INNER) + 1);
+}
+static const parsec_expr_t expr_of_symb_redistribute_bound_Send_BR_col = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_bound_Send_BR_col_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_bound_Send_BR_col = { .name = "BR_col", .context_index = 15, .min = &expr_of_symb_redistribute_bound_Send_BR_col, .max = &expr_of_symb_redistribute_bound_Send_BR_col, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_redistribute_bound_Send_rank_Y_fct(const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_bound_Send_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_bound_Send_inline_c_expr14_line_154(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_redistribute_bound_Send_rank_Y = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_bound_Send_rank_Y_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_bound_Send_rank_Y = { .name = "rank_Y", .context_index = 16, .min = &expr_of_symb_redistribute_bound_Send_rank_Y, .max = &expr_of_symb_redistribute_bound_Send_rank_Y, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_redistribute_bound_Send_rank_T_fct(const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_bound_Send_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_bound_Send_inline_c_expr13_line_155(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_redistribute_bound_Send_rank_T = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_bound_Send_rank_T_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_bound_Send_rank_T = { .name = "rank_T", .context_index = 17, .min = &expr_of_symb_redistribute_bound_Send_rank_T, .max = &expr_of_symb_redistribute_bound_Send_rank_T, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int affinity_of_redistribute_bound_Send(const __parsec_redistribute_bound_Send_task_t *this_task,
+                     parsec_data_ref_t *ref)
+{
+    const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp = (const __parsec_redistribute_bound_internal_taskpool_t*)this_task->taskpool;
+  const int m_Y = this_task->locals.m_Y.value; (void)m_Y;
+  const int n_Y = this_task->locals.n_Y.value; (void)n_Y;
+  const int mb_Y_inner = this_task->locals.mb_Y_inner.value; (void)mb_Y_inner;
+  const int nb_Y_inner = this_task->locals.nb_Y_inner.value; (void)nb_Y_inner;
+  const int i_start = this_task->locals.i_start.value; (void)i_start;
+  const int j_start = this_task->locals.j_start.value; (void)j_start;
+  const int m_T_start = this_task->locals.m_T_start.value; (void)m_T_start;
+  const int n_T_start = this_task->locals.n_T_start.value; (void)n_T_start;
+  const int m_T_end = this_task->locals.m_T_end.value; (void)m_T_end;
+  const int n_T_end = this_task->locals.n_T_end.value; (void)n_T_end;
+  const int m_T = this_task->locals.m_T.value; (void)m_T;
+  const int n_T = this_task->locals.n_T.value; (void)n_T;
+  const int TL_row = this_task->locals.TL_row.value; (void)TL_row;
+  const int TL_col = this_task->locals.TL_col.value; (void)TL_col;
+  const int BR_row = this_task->locals.BR_row.value; (void)BR_row;
+  const int BR_col = this_task->locals.BR_col.value; (void)BR_col;
+  const int rank_Y = this_task->locals.rank_Y.value; (void)rank_Y;
+  const int rank_T = this_task->locals.rank_T.value; (void)rank_T;
+
+  /* Silent Warnings: should look into predicate to know what variables are usefull */
+  (void)m_Y;
+  (void)n_Y;
+  (void)mb_Y_inner;
+  (void)nb_Y_inner;
+  (void)i_start;
+  (void)j_start;
+  (void)m_T_start;
+  (void)n_T_start;
+  (void)m_T_end;
+  (void)n_T_end;
+  (void)m_T;
+  (void)n_T;
+  (void)TL_row;
+  (void)TL_col;
+  (void)BR_row;
+  (void)BR_col;
+  (void)rank_Y;
+  (void)rank_T;
+  ref->dc = (parsec_data_collection_t *)__parsec_tp->super._g_descY;
+  /* Compute data key */
+  ref->key = ref->dc->data_key(ref->dc, m_Y, n_Y);
+  return 1;
+}
+static const parsec_property_t properties_of_redistribute_bound_Send[1] = {
+  {.name = NULL, .expr = NULL}
+};
+static int release_deps_of_redistribute_bound_Send(parsec_execution_stream_t *es, __parsec_redistribute_bound_Send_task_t *this_task, uint32_t action_mask, parsec_remote_deps_t *deps)
+{
+  PARSEC_PINS(es, RELEASE_DEPS_BEGIN, (parsec_task_t *)this_task);  const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp = (const __parsec_redistribute_bound_internal_taskpool_t *)this_task->taskpool;
+  parsec_release_dep_fct_arg_t arg;
+  int __vp_id;
+  int consume_local_repo = 0;
+  arg.action_mask = action_mask;
+  arg.output_entry = NULL;
+  arg.output_repo = NULL;
+#if defined(DISTRIBUTED)
+  arg.remote_deps = deps;
+#endif  /* defined(DISTRIBUTED) */
+  assert(NULL != es);
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS )    arg.ready_lists = alloca(sizeof(parsec_task_t *) * es->virtual_process->parsec_context->nb_vp);
+  else
+    arg.ready_lists = NULL;
+  for( __vp_id = 0; __vp_id < es->virtual_process->parsec_context->nb_vp; arg.ready_lists[__vp_id++] = NULL );
+  (void)__parsec_tp; (void)deps;
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+  }
+  consume_local_repo = (this_task->repo_entry != NULL);
+  /* No successors, don't call iterate_successors and don't release any local deps */
+      if (consume_local_repo) {
+         data_repo_entry_used_once( Send_repo, this_task->repo_entry->ht_item.key );
+      }
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+  }
+  PARSEC_PINS(es, RELEASE_DEPS_END, (parsec_task_t *)this_task);  return 0;
+}
+
+static int data_lookup_of_redistribute_bound_Send(parsec_execution_stream_t *es, __parsec_redistribute_bound_Send_task_t *this_task)
+{
+  const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_bound_internal_taskpool_t *)this_task->taskpool;
+  parsec_assignment_t generic_locals[MAX_PARAM_COUNT];  /* generic task locals */
+  int target_device = 0; (void)target_device;
+  (void)__parsec_tp; (void)generic_locals; (void)es;
+  parsec_data_copy_t *chunk = NULL;
+  data_repo_t        *reshape_repo  = NULL, *consumed_repo  = NULL;
+  data_repo_entry_t  *reshape_entry = NULL, *consumed_entry = NULL;
+  parsec_key_t        reshape_entry_key = 0, consumed_entry_key = 0;
+  uint8_t             consumed_flow_index;
+  parsec_dep_data_description_t data;
+  int ret;
+  (void)reshape_repo; (void)reshape_entry; (void)reshape_entry_key;
+  (void)consumed_repo; (void)consumed_entry; (void)consumed_entry_key;
+  (void)consumed_flow_index;
+  (void)chunk; (void)data; (void)ret;
+  const int m_Y = this_task->locals.m_Y.value; (void)m_Y;
+  const int n_Y = this_task->locals.n_Y.value; (void)n_Y;
+  const int mb_Y_inner = this_task->locals.mb_Y_inner.value; (void)mb_Y_inner;
+  const int nb_Y_inner = this_task->locals.nb_Y_inner.value; (void)nb_Y_inner;
+  const int i_start = this_task->locals.i_start.value; (void)i_start;
+  const int j_start = this_task->locals.j_start.value; (void)j_start;
+  const int m_T_start = this_task->locals.m_T_start.value; (void)m_T_start;
+  const int n_T_start = this_task->locals.n_T_start.value; (void)n_T_start;
+  const int m_T_end = this_task->locals.m_T_end.value; (void)m_T_end;
+  const int n_T_end = this_task->locals.n_T_end.value; (void)n_T_end;
+  const int m_T = this_task->locals.m_T.value; (void)m_T;
+  const int n_T = this_task->locals.n_T.value; (void)n_T;
+  const int TL_row = this_task->locals.TL_row.value; (void)TL_row;
+  const int TL_col = this_task->locals.TL_col.value; (void)TL_col;
+  const int BR_row = this_task->locals.BR_row.value; (void)BR_row;
+  const int BR_col = this_task->locals.BR_col.value; (void)BR_col;
+  const int rank_Y = this_task->locals.rank_Y.value; (void)rank_Y;
+  const int rank_T = this_task->locals.rank_T.value; (void)rank_T;
+  if( NULL == this_task->repo_entry ){
+    this_task->repo_entry = data_repo_lookup_entry_and_create(es, Send_repo,                                       __jdf2c_make_key_Send((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    data_repo_entry_addto_usage_limit(Send_repo, this_task->repo_entry->ht_item.key, 1);    this_task->repo_entry ->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(this_task->repo_entry ->sim_exec_date == 0);
+    this_task->repo_entry ->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  /* The reshape repo is the current task repo. */  reshape_repo = Send_repo;
+  reshape_entry_key = __jdf2c_make_key_Send((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals) ;
+  reshape_entry = this_task->repo_entry;
+  /* Lookup the input data, and store them in the context if any */
+  /** Generate profiling information */
+#if defined(PARSEC_PROF_TRACE)
+  this_task->prof_info.desc = (parsec_data_collection_t*)__parsec_tp->super._g_descY;
+  this_task->prof_info.priority = this_task->priority;
+  this_task->prof_info.data_id   = ((parsec_data_collection_t*)__parsec_tp->super._g_descY)->data_key((parsec_data_collection_t*)__parsec_tp->super._g_descY, m_Y, n_Y);
+  this_task->prof_info.task_class_id = this_task->task_class->task_class_id;
+  this_task->prof_info.task_return_code = -1;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int datatype_lookup_of_redistribute_bound_Send(parsec_execution_stream_t *es, const parsec_task_t *this_generic_task, const parsec_task_t *parent_task,
+              uint32_t* flow_mask, parsec_dep_data_description_t* data)
+{
+  const __parsec_redistribute_bound_Send_task_t *this_task = (__parsec_redistribute_bound_Send_task_t*)this_generic_task;
+  const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_bound_internal_taskpool_t *)this_task->taskpool;
+  (void)__parsec_tp; (void)es; (void)this_task; (void)data; (void)parent_task;
+  const int m_Y = this_task->locals.m_Y.value; (void)m_Y;
+  const int n_Y = this_task->locals.n_Y.value; (void)n_Y;
+  const int mb_Y_inner = this_task->locals.mb_Y_inner.value; (void)mb_Y_inner;
+  const int nb_Y_inner = this_task->locals.nb_Y_inner.value; (void)nb_Y_inner;
+  const int i_start = this_task->locals.i_start.value; (void)i_start;
+  const int j_start = this_task->locals.j_start.value; (void)j_start;
+  const int m_T_start = this_task->locals.m_T_start.value; (void)m_T_start;
+  const int n_T_start = this_task->locals.n_T_start.value; (void)n_T_start;
+  const int m_T_end = this_task->locals.m_T_end.value; (void)m_T_end;
+  const int n_T_end = this_task->locals.n_T_end.value; (void)n_T_end;
+  const int m_T = this_task->locals.m_T.value; (void)m_T;
+  const int n_T = this_task->locals.n_T.value; (void)n_T;
+  const int TL_row = this_task->locals.TL_row.value; (void)TL_row;
+  const int TL_col = this_task->locals.TL_col.value; (void)TL_col;
+  const int BR_row = this_task->locals.BR_row.value; (void)BR_row;
+  const int BR_col = this_task->locals.BR_col.value; (void)BR_col;
+  const int rank_Y = this_task->locals.rank_Y.value; (void)rank_Y;
+  const int rank_T = this_task->locals.rank_T.value; (void)rank_T;
+  data->local.arena = data->remote.arena = NULL;
+  data->local.src_datatype  = data->local.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->local.src_count     = data->local.dst_count = 0;
+  data->local.src_displ     = data->local.dst_displ = 0;
+  data->data_future  = NULL;
+
+  /* these are the output dependencies remote datatypes */
+  data->data                             = NULL;
+  data->remote.src_datatype = data->remote.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->remote.src_count    = data->remote.dst_count = 0;
+  data->remote.src_displ    = data->remote.dst_displ = 0;
+  data->data_future  = NULL;
+  (*flow_mask) = 0;  /* nothing left */
+  (void)m_Y;  (void)n_Y;  (void)mb_Y_inner;  (void)nb_Y_inner;  (void)i_start;  (void)j_start;  (void)m_T_start;  (void)n_T_start;  (void)m_T_end;  (void)n_T_end;  (void)m_T;  (void)n_T;  (void)TL_row;  (void)TL_col;  (void)BR_row;  (void)BR_col;  (void)rank_Y;  (void)rank_T;
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+static int hook_of_redistribute_bound_Send(parsec_execution_stream_t *es, __parsec_redistribute_bound_Send_task_t *this_task)
+{
+  __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_bound_internal_taskpool_t *)this_task->taskpool;
+  (void)es; (void)__parsec_tp;
+  const int m_Y = this_task->locals.m_Y.value; (void)m_Y;
+  const int n_Y = this_task->locals.n_Y.value; (void)n_Y;
+  const int mb_Y_inner = this_task->locals.mb_Y_inner.value; (void)mb_Y_inner;
+  const int nb_Y_inner = this_task->locals.nb_Y_inner.value; (void)nb_Y_inner;
+  const int i_start = this_task->locals.i_start.value; (void)i_start;
+  const int j_start = this_task->locals.j_start.value; (void)j_start;
+  const int m_T_start = this_task->locals.m_T_start.value; (void)m_T_start;
+  const int n_T_start = this_task->locals.n_T_start.value; (void)n_T_start;
+  const int m_T_end = this_task->locals.m_T_end.value; (void)m_T_end;
+  const int n_T_end = this_task->locals.n_T_end.value; (void)n_T_end;
+  const int m_T = this_task->locals.m_T.value; (void)m_T;
+  const int n_T = this_task->locals.n_T.value; (void)n_T;
+  const int TL_row = this_task->locals.TL_row.value; (void)TL_row;
+  const int TL_col = this_task->locals.TL_col.value; (void)TL_col;
+  const int BR_row = this_task->locals.BR_row.value; (void)BR_row;
+  const int BR_col = this_task->locals.BR_col.value; (void)BR_col;
+  const int rank_Y = this_task->locals.rank_Y.value; (void)rank_Y;
+  const int rank_T = this_task->locals.rank_T.value; (void)rank_T;
+  (void)m_Y;  (void)n_Y;  (void)mb_Y_inner;  (void)nb_Y_inner;  (void)i_start;  (void)j_start;  (void)m_T_start;  (void)n_T_start;  (void)m_T_end;  (void)n_T_end;  (void)m_T;  (void)n_T;  (void)TL_row;  (void)TL_col;  (void)BR_row;  (void)BR_col;  (void)rank_Y;  (void)rank_T;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                                  Send BODY                                    -----*/
+
+{
+    int tid = es->th_id;
+    if( rank_Y != rank_T )
+        CORE_redistribute_bound(TL_row, TL_col, BR_row, BR_col, mb_T_INNER, nb_T_INNER, m_T,
+                                 n_T, m_T_start, m_T_end, n_T_start, n_T_end, tid, sum_remote,
+                                 sum_remote_rank_send);
+    else
+        CORE_redistribute_bound(TL_row, TL_col, BR_row, BR_col, mb_T_INNER, nb_T_INNER, m_T,
+                                 n_T, m_T_start, m_T_end, n_T_start, n_T_end, tid, sum_local,
+                                 sum_local_rank);
+}
+
+/*-----                                END OF Send BODY                                -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#endif  /*  defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+static int complete_hook_of_redistribute_bound_Send(parsec_execution_stream_t *es, __parsec_redistribute_bound_Send_task_t *this_task)
+{
+  const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_bound_internal_taskpool_t *)this_task->taskpool;
+#if defined(DISTRIBUTED)
+    const int m_Y = this_task->locals.m_Y.value; (void)m_Y;
+  const int n_Y = this_task->locals.n_Y.value; (void)n_Y;
+  const int mb_Y_inner = this_task->locals.mb_Y_inner.value; (void)mb_Y_inner;
+  const int nb_Y_inner = this_task->locals.nb_Y_inner.value; (void)nb_Y_inner;
+  const int i_start = this_task->locals.i_start.value; (void)i_start;
+  const int j_start = this_task->locals.j_start.value; (void)j_start;
+  const int m_T_start = this_task->locals.m_T_start.value; (void)m_T_start;
+  const int n_T_start = this_task->locals.n_T_start.value; (void)n_T_start;
+  const int m_T_end = this_task->locals.m_T_end.value; (void)m_T_end;
+  const int n_T_end = this_task->locals.n_T_end.value; (void)n_T_end;
+  const int m_T = this_task->locals.m_T.value; (void)m_T;
+  const int n_T = this_task->locals.n_T.value; (void)n_T;
+  const int TL_row = this_task->locals.TL_row.value; (void)TL_row;
+  const int TL_col = this_task->locals.TL_col.value; (void)TL_col;
+  const int BR_row = this_task->locals.BR_row.value; (void)BR_row;
+  const int BR_col = this_task->locals.BR_col.value; (void)BR_col;
+  const int rank_Y = this_task->locals.rank_Y.value; (void)rank_Y;
+  const int rank_T = this_task->locals.rank_T.value; (void)rank_T;
+#endif  /* defined(DISTRIBUTED) */
+  (void)es; (void)__parsec_tp;
+parsec_data_t* data_t_desc = NULL; (void)data_t_desc;
+#if defined(DISTRIBUTED)
+  /** If not working on distributed, there is no risk that data is not in place */
+  (void)m_Y;  (void)n_Y;  (void)mb_Y_inner;  (void)nb_Y_inner;  (void)i_start;  (void)j_start;  (void)m_T_start;  (void)n_T_start;  (void)m_T_end;  (void)n_T_end;  (void)m_T;  (void)n_T;  (void)TL_row;  (void)TL_col;  (void)BR_row;  (void)BR_col;  (void)rank_Y;  (void)rank_T;
+
+#endif /* DISTRIBUTED */
+#if defined(PARSEC_PROF_GRAPHER)
+  parsec_prof_grapher_task((parsec_task_t*)this_task, es->th_id, es->virtual_process->vp_id,
+     __jdf2c_key_fns_Send.key_hash(this_task->task_class->make_key( (parsec_taskpool_t*)this_task->taskpool, ((parsec_task_t*)this_task)->locals), NULL));
+#endif  /* defined(PARSEC_PROF_GRAPHER) */
+  release_deps_of_redistribute_bound_Send(es, this_task,
+      PARSEC_ACTION_RELEASE_REMOTE_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_REFS |
+      PARSEC_ACTION_RESHAPE_ON_RELEASE |
+      0x0,  /* mask of all dep_index */ 
+      NULL);
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static parsec_hook_return_t release_task_of_redistribute_bound_Send(parsec_execution_stream_t *es, parsec_task_t *this_task)
+{
+    const __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp =
+        (const __parsec_redistribute_bound_internal_taskpool_t *)this_task->taskpool;
+    parsec_hash_table_t *ht = (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[0];
+    parsec_key_t key = this_task->task_class->make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals);
+    parsec_hashable_dependency_t *hash_dep = (parsec_hashable_dependency_t *)parsec_hash_table_remove(ht, key);
+    parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);
+    return parsec_release_task_to_mempool_update_nbtasks(es, this_task);
+}
+
+static char *redistribute_bound_redistribute_bound_Send_internal_init_deps_key_functions_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_bound_internal_taskpool_t *)user_data;
+  __parsec_redistribute_bound_Send_parsec_assignment_t __jdf2c__assignments = {  .m_Y.value = 0, .n_Y.value = 0, .mb_Y_inner.value = 0, .nb_Y_inner.value = 0, .i_start.value = 0, .j_start.value = 0, .m_T_start.value = 0, .n_T_start.value = 0, .m_T_end.value = 0, .n_T_end.value = 0, .m_T.value = 0, .n_T.value = 0, .TL_row.value = 0, .TL_col.value = 0, .BR_row.value = 0, .BR_col.value = 0, .rank_Y.value = 0, .rank_T.value = 0 };
+  int m_Y = (__parsec_key) % __parsec_tp->Send_m_Y_range + __parsec_tp->Send_m_Y_min;
+  __parsec_key = __parsec_key / __parsec_tp->Send_m_Y_range;
+  __jdf2c__assignments.m_Y.value = m_Y;
+  int n_Y = (__parsec_key) % __parsec_tp->Send_n_Y_range + __parsec_tp->Send_n_Y_min;
+  __parsec_key = __parsec_key / __parsec_tp->Send_n_Y_range;
+  __jdf2c__assignments.n_Y.value = n_Y;
+  int mb_Y_inner = redistribute_bound_Send_inline_c_expr24_line_134(__parsec_tp, &__jdf2c__assignments);
+  (void)mb_Y_inner;
+  __jdf2c__assignments.mb_Y_inner.value = mb_Y_inner;
+  int nb_Y_inner = redistribute_bound_Send_inline_c_expr23_line_135(__parsec_tp, &__jdf2c__assignments);
+  (void)nb_Y_inner;
+  __jdf2c__assignments.nb_Y_inner.value = nb_Y_inner;
+  int i_start = redistribute_bound_Send_inline_c_expr22_line_137(__parsec_tp, &__jdf2c__assignments);
+  (void)i_start;
+  __jdf2c__assignments.i_start.value = i_start;
+  int j_start = redistribute_bound_Send_inline_c_expr21_line_138(__parsec_tp, &__jdf2c__assignments);
+  (void)j_start;
+  __jdf2c__assignments.j_start.value = j_start;
+  int m_T_start = redistribute_bound_Send_inline_c_expr20_line_140(__parsec_tp, &__jdf2c__assignments);
+  (void)m_T_start;
+  __jdf2c__assignments.m_T_start.value = m_T_start;
+  int n_T_start = redistribute_bound_Send_inline_c_expr19_line_141(__parsec_tp, &__jdf2c__assignments);
+  (void)n_T_start;
+  __jdf2c__assignments.n_T_start.value = n_T_start;
+  int m_T_end = redistribute_bound_Send_inline_c_expr18_line_143(__parsec_tp, &__jdf2c__assignments);
+  (void)m_T_end;
+  __jdf2c__assignments.m_T_end.value = m_T_end;
+  int n_T_end = redistribute_bound_Send_inline_c_expr17_line_144(__parsec_tp, &__jdf2c__assignments);
+  (void)n_T_end;
+  __jdf2c__assignments.n_T_end.value = n_T_end;
+  int m_T = (__parsec_key) % __parsec_tp->Send_m_T_range + __parsec_tp->Send_m_T_min;
+  __parsec_key = __parsec_key / __parsec_tp->Send_m_T_range;
+  __jdf2c__assignments.m_T.value = m_T;
+  int n_T = (__parsec_key) % __parsec_tp->Send_n_T_range + __parsec_tp->Send_n_T_min;
+  __parsec_key = __parsec_key / __parsec_tp->Send_n_T_range;
+  __jdf2c__assignments.n_T.value = n_T;
+  int TL_row = redistribute_bound_Send_inline_c_expr16_line_149(__parsec_tp, &__jdf2c__assignments);
+  (void)TL_row;
+  __jdf2c__assignments.TL_row.value = TL_row;
+  int TL_col = redistribute_bound_Send_inline_c_expr15_line_150(__parsec_tp, &__jdf2c__assignments);
+  (void)TL_col;
+  __jdf2c__assignments.TL_col.value = TL_col;
+  int BR_row = ((((i_start + mb_Y_inner) - 1) % mb_T_INNER) + 1);
+  (void)BR_row;
+  __jdf2c__assignments.BR_row.value = BR_row;
+  int BR_col = ((((j_start + nb_Y_inner) - 1) % nb_T_INNER) + 1);
+  (void)BR_col;
+  __jdf2c__assignments.BR_col.value = BR_col;
+  int rank_Y = redistribute_bound_Send_inline_c_expr14_line_154(__parsec_tp, &__jdf2c__assignments);
+  (void)rank_Y;
+  __jdf2c__assignments.rank_Y.value = rank_Y;
+  int rank_T = redistribute_bound_Send_inline_c_expr13_line_155(__parsec_tp, &__jdf2c__assignments);
+  (void)rank_T;
+  __jdf2c__assignments.rank_T.value = rank_T;
+  (void)__jdf2c__assignments;
+  snprintf(buffer, buffer_size, "Send(%d, %d, %d, %d)", m_Y, n_Y, m_T, n_T);
+  return buffer;
+}
+
+static parsec_key_fn_t redistribute_bound_redistribute_bound_Send_internal_init_deps_key_functions = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = redistribute_bound_redistribute_bound_Send_internal_init_deps_key_functions_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/* Needs: min-max count-tasks iterate */
+static int redistribute_bound_Send_internal_init(parsec_execution_stream_t * es, __parsec_redistribute_bound_Send_task_t * this_task)
+{
+  __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_bound_internal_taskpool_t*)this_task->taskpool;
+  int32_t nb_tasks = 0, saved_nb_tasks = 0;
+int32_t __m_Y_min = 0x7fffffff, __m_Y_max = 0;int32_t __jdf2c_m_Y_min = 0x7fffffff, __jdf2c_m_Y_max = 0;int32_t __n_Y_min = 0x7fffffff, __n_Y_max = 0;int32_t __jdf2c_n_Y_min = 0x7fffffff, __jdf2c_n_Y_max = 0;int32_t __m_T_min = 0x7fffffff, __m_T_max = 0;int32_t __jdf2c_m_T_min = 0x7fffffff, __jdf2c_m_T_max = 0;int32_t __n_T_min = 0x7fffffff, __n_T_max = 0;int32_t __jdf2c_n_T_min = 0x7fffffff, __jdf2c_n_T_max = 0;  __parsec_redistribute_bound_Send_parsec_assignment_t assignments = {  .m_Y.value = 0, .n_Y.value = 0, .mb_Y_inner.value = 0, .nb_Y_inner.value = 0, .i_start.value = 0, .j_start.value = 0, .m_T_start.value = 0, .n_T_start.value = 0, .m_T_end.value = 0, .n_T_end.value = 0, .m_T.value = 0, .n_T.value = 0, .TL_row.value = 0, .TL_col.value = 0, .BR_row.value = 0, .BR_col.value = 0, .rank_Y.value = 0, .rank_T.value = 0 };
+  int32_t  m_Y,  n_Y,  mb_Y_inner,  nb_Y_inner,  i_start,  j_start,  m_T_start,  n_T_start,  m_T_end,  n_T_end,  m_T,  n_T,  TL_row,  TL_col,  BR_row,  BR_col,  rank_Y,  rank_T;
+  int32_t __jdf2c_m_Y_start, __jdf2c_m_Y_end, __jdf2c_m_Y_inc;
+  int32_t __jdf2c_n_Y_start, __jdf2c_n_Y_end, __jdf2c_n_Y_inc;
+  int32_t __jdf2c_m_T_start, __jdf2c_m_T_end, __jdf2c_m_T_inc;
+  int32_t __jdf2c_n_T_start, __jdf2c_n_T_end, __jdf2c_n_T_inc;
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+  PARSEC_PROFILING_TRACE(es->es_profile,
+                         this_task->taskpool->profiling_array[START_KEY(this_task->task_class->task_class_id)],
+                         0,
+                         this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    __jdf2c_m_Y_start = m_Y_START;
+    __jdf2c_m_Y_end = m_Y_END;
+    __jdf2c_m_Y_inc = 1;
+    __m_Y_min = parsec_imin(__jdf2c_m_Y_start, __jdf2c_m_Y_end);
+    __m_Y_max = parsec_imax(__jdf2c_m_Y_start, __jdf2c_m_Y_end);
+    __jdf2c_m_Y_min = parsec_imin(__jdf2c_m_Y_min, __m_Y_min);
+    __jdf2c_m_Y_max = parsec_imax(__jdf2c_m_Y_max, __m_Y_max);
+    for(m_Y =  __jdf2c_m_Y_start;
+        m_Y <= __jdf2c_m_Y_end;
+        m_Y += __jdf2c_m_Y_inc) {
+    assignments.m_Y.value = m_Y;
+      __jdf2c_n_Y_start = n_Y_START;
+      __jdf2c_n_Y_end = n_Y_END;
+      __jdf2c_n_Y_inc = 1;
+      __n_Y_min = parsec_imin(__jdf2c_n_Y_start, __jdf2c_n_Y_end);
+      __n_Y_max = parsec_imax(__jdf2c_n_Y_start, __jdf2c_n_Y_end);
+      __jdf2c_n_Y_min = parsec_imin(__jdf2c_n_Y_min, __n_Y_min);
+      __jdf2c_n_Y_max = parsec_imax(__jdf2c_n_Y_max, __n_Y_max);
+      for(n_Y =  __jdf2c_n_Y_start;
+          n_Y <= __jdf2c_n_Y_end;
+          n_Y += __jdf2c_n_Y_inc) {
+      assignments.n_Y.value = n_Y;
+    {  /* block for the non-range variable mb_Y_inner */
+        mb_Y_inner = redistribute_bound_Send_inline_c_expr24_line_134(__parsec_tp, &assignments);
+        assignments.mb_Y_inner.value = mb_Y_inner;
+      {  /* block for the non-range variable nb_Y_inner */
+          nb_Y_inner = redistribute_bound_Send_inline_c_expr23_line_135(__parsec_tp, &assignments);
+          assignments.nb_Y_inner.value = nb_Y_inner;
+        {  /* block for the non-range variable i_start */
+            i_start = redistribute_bound_Send_inline_c_expr22_line_137(__parsec_tp, &assignments);
+            assignments.i_start.value = i_start;
+          {  /* block for the non-range variable j_start */
+              j_start = redistribute_bound_Send_inline_c_expr21_line_138(__parsec_tp, &assignments);
+              assignments.j_start.value = j_start;
+            {  /* block for the non-range variable m_T_start */
+                m_T_start = redistribute_bound_Send_inline_c_expr20_line_140(__parsec_tp, &assignments);
+                assignments.m_T_start.value = m_T_start;
+              {  /* block for the non-range variable n_T_start */
+                  n_T_start = redistribute_bound_Send_inline_c_expr19_line_141(__parsec_tp, &assignments);
+                  assignments.n_T_start.value = n_T_start;
+                {  /* block for the non-range variable m_T_end */
+                    m_T_end = redistribute_bound_Send_inline_c_expr18_line_143(__parsec_tp, &assignments);
+                    assignments.m_T_end.value = m_T_end;
+                  {  /* block for the non-range variable n_T_end */
+                      n_T_end = redistribute_bound_Send_inline_c_expr17_line_144(__parsec_tp, &assignments);
+                      assignments.n_T_end.value = n_T_end;
+                        __jdf2c_m_T_start = m_T_start;
+                        __jdf2c_m_T_end = m_T_end;
+                        __jdf2c_m_T_inc = 1;
+                        __m_T_min = parsec_imin(__jdf2c_m_T_start, __jdf2c_m_T_end);
+                        __m_T_max = parsec_imax(__jdf2c_m_T_start, __jdf2c_m_T_end);
+                        __jdf2c_m_T_min = parsec_imin(__jdf2c_m_T_min, __m_T_min);
+                        __jdf2c_m_T_max = parsec_imax(__jdf2c_m_T_max, __m_T_max);
+                        for(m_T =  __jdf2c_m_T_start;
+                            m_T <= __jdf2c_m_T_end;
+                            m_T += __jdf2c_m_T_inc) {
+                        assignments.m_T.value = m_T;
+                          __jdf2c_n_T_start = n_T_start;
+                          __jdf2c_n_T_end = n_T_end;
+                          __jdf2c_n_T_inc = 1;
+                          __n_T_min = parsec_imin(__jdf2c_n_T_start, __jdf2c_n_T_end);
+                          __n_T_max = parsec_imax(__jdf2c_n_T_start, __jdf2c_n_T_end);
+                          __jdf2c_n_T_min = parsec_imin(__jdf2c_n_T_min, __n_T_min);
+                          __jdf2c_n_T_max = parsec_imax(__jdf2c_n_T_max, __n_T_max);
+                          for(n_T =  __jdf2c_n_T_start;
+                              n_T <= __jdf2c_n_T_end;
+                              n_T += __jdf2c_n_T_inc) {
+                          assignments.n_T.value = n_T;
+                        {  /* block for the non-range variable TL_row */
+                            TL_row = redistribute_bound_Send_inline_c_expr16_line_149(__parsec_tp, &assignments);
+                            assignments.TL_row.value = TL_row;
+                          {  /* block for the non-range variable TL_col */
+                              TL_col = redistribute_bound_Send_inline_c_expr15_line_150(__parsec_tp, &assignments);
+                              assignments.TL_col.value = TL_col;
+                            {  /* block for the non-range variable BR_row */
+                                BR_row = ((((i_start + mb_Y_inner) - 1) % mb_T_INNER) + 1);
+                                assignments.BR_row.value = BR_row;
+                              {  /* block for the non-range variable BR_col */
+                                  BR_col = ((((j_start + nb_Y_inner) - 1) % nb_T_INNER) + 1);
+                                  assignments.BR_col.value = BR_col;
+                                {  /* block for the non-range variable rank_Y */
+                                    rank_Y = redistribute_bound_Send_inline_c_expr14_line_154(__parsec_tp, &assignments);
+                                    assignments.rank_Y.value = rank_Y;
+                                  {  /* block for the non-range variable rank_T */
+                                      rank_T = redistribute_bound_Send_inline_c_expr13_line_155(__parsec_tp, &assignments);
+                                      assignments.rank_T.value = rank_T;
+                                      if( !Send_pred(m_Y, n_Y, mb_Y_inner, nb_Y_inner, i_start, j_start, m_T_start, n_T_start, m_T_end, n_T_end, m_T, n_T, TL_row, TL_col, BR_row, BR_col, rank_Y, rank_T) ) continue;
+                                      nb_tasks++;
+                                    } /* block for the non-range variable rank_T */ 
+                                  } /* block for the non-range variable rank_Y */ 
+                                } /* block for the non-range variable BR_col */ 
+                              } /* block for the non-range variable BR_row */ 
+                            } /* block for the non-range variable TL_col */ 
+                          } /* block for the non-range variable TL_row */ 
+                        } /* Loop on normal range n_T */
+                      } /* For loop of m_T */ 
+                    } /* Non-range variable n_T_end */ 
+                  } /* Non-range variable m_T_end */ 
+                } /* Non-range variable n_T_start */ 
+              } /* Non-range variable m_T_start */ 
+            } /* Non-range variable j_start */ 
+          } /* Non-range variable i_start */ 
+        } /* Non-range variable nb_Y_inner */ 
+      } /* Non-range variable mb_Y_inner */ 
+    } /* For loop of n_Y */ 
+  } /* For loop of m_Y */ 
+   if( 0 != nb_tasks ) {
+     (void)parsec_atomic_fetch_add_int32(&__parsec_tp->initial_number_tasks, nb_tasks);
+   }
+  /* Set the range variables for the collision-free hash-computation */
+  __parsec_tp->Send_m_Y_min   = __jdf2c_m_Y_min;
+  __parsec_tp->Send_m_Y_range = (__jdf2c_m_Y_max - __jdf2c_m_Y_min) + 1;
+  __parsec_tp->Send_n_Y_min   = __jdf2c_n_Y_min;
+  __parsec_tp->Send_n_Y_range = (__jdf2c_n_Y_max - __jdf2c_n_Y_min) + 1;
+  __parsec_tp->Send_m_T_min   = __jdf2c_m_T_min;
+  __parsec_tp->Send_m_T_range = (__jdf2c_m_T_max - __jdf2c_m_T_min) + 1;
+  __parsec_tp->Send_n_T_min   = __jdf2c_n_T_min;
+  __parsec_tp->Send_n_T_range = (__jdf2c_n_T_max - __jdf2c_n_T_min) + 1;
+    do {
+      this_task->super.list_next = (parsec_list_item_t*)__parsec_tp->startup_queue;
+    } while(!parsec_atomic_cas_ptr(&__parsec_tp->startup_queue, (parsec_list_item_t*)this_task->super.list_next, this_task));
+    this_task->status = PARSEC_TASK_STATUS_HOOK;
+
+  PARSEC_AYU_REGISTER_TASK(&redistribute_bound_Send);
+  __parsec_tp->super.super.dependencies_array[0] = PARSEC_OBJ_NEW(parsec_hash_table_t);
+  parsec_hash_table_init(__parsec_tp->super.super.dependencies_array[0], offsetof(parsec_hashable_dependency_t, ht_item), 10, redistribute_bound_redistribute_bound_Send_internal_init_deps_key_functions, this_task->taskpool);
+  __parsec_tp->repositories[0] = data_repo_create_nothreadsafe(nb_tasks, __jdf2c_key_fns_Send, (parsec_taskpool_t*)__parsec_tp, 0);
+(void)saved_nb_tasks;
+(void)__m_Y_min; (void)__m_Y_max;(void)__n_Y_min; (void)__n_Y_max;(void)__m_T_min; (void)__m_T_max;(void)__n_T_min; (void)__n_T_max;  (void)__jdf2c_m_Y_start; (void)__jdf2c_m_Y_end; (void)__jdf2c_m_Y_inc;  (void)__jdf2c_n_Y_start; (void)__jdf2c_n_Y_end; (void)__jdf2c_n_Y_inc;  (void)__jdf2c_m_T_start; (void)__jdf2c_m_T_end; (void)__jdf2c_m_T_inc;  (void)__jdf2c_n_T_start; (void)__jdf2c_n_T_end; (void)__jdf2c_n_T_inc;  (void)assignments; (void)__parsec_tp; (void)es;
+  if(1 == parsec_atomic_fetch_dec_int32(&__parsec_tp->sync_point)) {
+    /* Last initialization task complete. Update the number of tasks. */
+    __parsec_tp->super.super.tdm.module->taskpool_addto_nb_tasks(&__parsec_tp->super.super, __parsec_tp->initial_number_tasks);
+    parsec_mfence();  /* write memory barrier to guarantee that the scheduler gets the correct number of tasks */
+    parsec_taskpool_enable((parsec_taskpool_t*)__parsec_tp, &__parsec_tp->startup_queue,
+                           (parsec_task_t*)this_task, es, __parsec_tp->super.super.nb_pending_actions);
+    __parsec_tp->super.super.tdm.module->taskpool_ready(&__parsec_tp->super.super);
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+    PARSEC_PROFILING_TRACE(es->es_profile,
+                           this_task->taskpool->profiling_array[2 * this_task->task_class->task_class_id + 1],
+                           0,
+                           this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    if( 1 >= __parsec_tp->super.super.nb_pending_actions ) {
+        /* if no tasks will be generated let's prevent the runtime from calling the hook and instead go directly to complete the task */
+        this_task->status = PARSEC_TASK_STATUS_COMPLETE;
+    }
+    return PARSEC_HOOK_RETURN_DONE;
+  }
+  return PARSEC_HOOK_RETURN_ASYNC;
+}
+
+static int __jdf2c_startup_Send(parsec_execution_stream_t * es, __parsec_redistribute_bound_Send_task_t *this_task)
+{
+  __parsec_redistribute_bound_Send_task_t* new_task;
+  __parsec_redistribute_bound_internal_taskpool_t* __parsec_tp = (__parsec_redistribute_bound_internal_taskpool_t*)this_task->taskpool;
+  parsec_context_t *context = __parsec_tp->super.super.context;
+  int vpid = 0, nb_tasks = 0;
+  size_t total_nb_tasks = 0;
+  parsec_list_item_t* pready_ring[context->nb_vp];
+  int restore_context = 0;
+  int m_Y = this_task->locals.m_Y.value;  /* retrieve value saved during the last iteration */
+  int n_Y = this_task->locals.n_Y.value;  /* retrieve value saved during the last iteration */
+  int mb_Y_inner = this_task->locals.mb_Y_inner.value;  /* retrieve value saved during the last iteration */
+  int nb_Y_inner = this_task->locals.nb_Y_inner.value;  /* retrieve value saved during the last iteration */
+  int i_start = this_task->locals.i_start.value;  /* retrieve value saved during the last iteration */
+  int j_start = this_task->locals.j_start.value;  /* retrieve value saved during the last iteration */
+  int m_T_start = this_task->locals.m_T_start.value;  /* retrieve value saved during the last iteration */
+  int n_T_start = this_task->locals.n_T_start.value;  /* retrieve value saved during the last iteration */
+  int m_T_end = this_task->locals.m_T_end.value;  /* retrieve value saved during the last iteration */
+  int n_T_end = this_task->locals.n_T_end.value;  /* retrieve value saved during the last iteration */
+  int m_T = this_task->locals.m_T.value;  /* retrieve value saved during the last iteration */
+  int n_T = this_task->locals.n_T.value;  /* retrieve value saved during the last iteration */
+  int TL_row = this_task->locals.TL_row.value;  /* retrieve value saved during the last iteration */
+  int TL_col = this_task->locals.TL_col.value;  /* retrieve value saved during the last iteration */
+  int BR_row = this_task->locals.BR_row.value;  /* retrieve value saved during the last iteration */
+  int BR_col = this_task->locals.BR_col.value;  /* retrieve value saved during the last iteration */
+  int rank_Y = this_task->locals.rank_Y.value;  /* retrieve value saved during the last iteration */
+  int rank_T = this_task->locals.rank_T.value;  /* retrieve value saved during the last iteration */
+  for(int _i = 0; _i < context->nb_vp; pready_ring[_i++] = NULL );
+  if( 0 != this_task->locals.reserved[0].value ) {
+    this_task->locals.reserved[0].value = 1; /* reset the submission process */
+    restore_context = 1;
+    goto restore_context_0;
+  }
+  this_task->locals.reserved[0].value = 1; /* a sane default value */
+  for(this_task->locals.m_Y.value = m_Y = m_Y_START;
+      this_task->locals.m_Y.value <= m_Y_END;
+      this_task->locals.m_Y.value += 1, m_Y = this_task->locals.m_Y.value) {
+    for(this_task->locals.n_Y.value = n_Y = n_Y_START;
+        this_task->locals.n_Y.value <= n_Y_END;
+        this_task->locals.n_Y.value += 1, n_Y = this_task->locals.n_Y.value) {
+      this_task->locals.mb_Y_inner.value = mb_Y_inner = redistribute_bound_Send_inline_c_expr24_line_134(__parsec_tp, &this_task->locals);
+      this_task->locals.nb_Y_inner.value = nb_Y_inner = redistribute_bound_Send_inline_c_expr23_line_135(__parsec_tp, &this_task->locals);
+      this_task->locals.i_start.value = i_start = redistribute_bound_Send_inline_c_expr22_line_137(__parsec_tp, &this_task->locals);
+      this_task->locals.j_start.value = j_start = redistribute_bound_Send_inline_c_expr21_line_138(__parsec_tp, &this_task->locals);
+      this_task->locals.m_T_start.value = m_T_start = redistribute_bound_Send_inline_c_expr20_line_140(__parsec_tp, &this_task->locals);
+      this_task->locals.n_T_start.value = n_T_start = redistribute_bound_Send_inline_c_expr19_line_141(__parsec_tp, &this_task->locals);
+      this_task->locals.m_T_end.value = m_T_end = redistribute_bound_Send_inline_c_expr18_line_143(__parsec_tp, &this_task->locals);
+      this_task->locals.n_T_end.value = n_T_end = redistribute_bound_Send_inline_c_expr17_line_144(__parsec_tp, &this_task->locals);
+      for(this_task->locals.m_T.value = m_T = m_T_start;
+          this_task->locals.m_T.value <= m_T_end;
+          this_task->locals.m_T.value += 1, m_T = this_task->locals.m_T.value) {
+        for(this_task->locals.n_T.value = n_T = n_T_start;
+            this_task->locals.n_T.value <= n_T_end;
+            this_task->locals.n_T.value += 1, n_T = this_task->locals.n_T.value) {
+          this_task->locals.TL_row.value = TL_row = redistribute_bound_Send_inline_c_expr16_line_149(__parsec_tp, &this_task->locals);
+          this_task->locals.TL_col.value = TL_col = redistribute_bound_Send_inline_c_expr15_line_150(__parsec_tp, &this_task->locals);
+          this_task->locals.BR_row.value = BR_row = ((((i_start + mb_Y_inner) - 1) % mb_T_INNER) + 1);
+          this_task->locals.BR_col.value = BR_col = ((((j_start + nb_Y_inner) - 1) % nb_T_INNER) + 1);
+          this_task->locals.rank_Y.value = rank_Y = redistribute_bound_Send_inline_c_expr14_line_154(__parsec_tp, &this_task->locals);
+          this_task->locals.rank_T.value = rank_T = redistribute_bound_Send_inline_c_expr13_line_155(__parsec_tp, &this_task->locals);
+          if( !Send_pred(m_Y, n_Y, mb_Y_inner, nb_Y_inner, i_start, j_start, m_T_start, n_T_start, m_T_end, n_T_end, m_T, n_T, TL_row, TL_col, BR_row, BR_col, rank_Y, rank_T) ) continue;
+  __parsec_redistribute_bound_Send_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_redistribute_bound_Send_parsec_assignment_t*)&this_task->locals;
+  (void)__jdf2c__tmp_locals;
+          if( NULL != ((parsec_data_collection_t*)__parsec_tp->super._g_descY)->vpid_of ) {
+            vpid = ((parsec_data_collection_t*)__parsec_tp->super._g_descY)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descY, m_Y, n_Y);
+            assert(context->nb_vp >= vpid);
+          } else {
+            vpid = (vpid + 1) % context->nb_vp;  /* spread the initial joy */
+          }
+          new_task = (__parsec_redistribute_bound_Send_task_t*)parsec_thread_mempool_allocate( context->virtual_processes[vpid]->execution_streams[0]->context_mempool );
+          PARSEC_OBJ_CONSTRUCT(new_task, parsec_task_t); /* construct called only when new, force-construct it again */
+          /* Copy only the valid elements from this_task to new_task one */
+          new_task->taskpool   = this_task->taskpool;
+          new_task->task_class = __parsec_tp->super.super.task_classes_array[redistribute_bound_Send.task_class_id];
+          new_task->chore_mask   = PARSEC_DEV_ALL;
+          new_task->locals.m_Y.value = this_task->locals.m_Y.value;
+          new_task->locals.n_Y.value = this_task->locals.n_Y.value;
+          new_task->locals.mb_Y_inner.value = this_task->locals.mb_Y_inner.value;
+          new_task->locals.nb_Y_inner.value = this_task->locals.nb_Y_inner.value;
+          new_task->locals.i_start.value = this_task->locals.i_start.value;
+          new_task->locals.j_start.value = this_task->locals.j_start.value;
+          new_task->locals.m_T_start.value = this_task->locals.m_T_start.value;
+          new_task->locals.n_T_start.value = this_task->locals.n_T_start.value;
+          new_task->locals.m_T_end.value = this_task->locals.m_T_end.value;
+          new_task->locals.n_T_end.value = this_task->locals.n_T_end.value;
+          new_task->locals.m_T.value = this_task->locals.m_T.value;
+          new_task->locals.n_T.value = this_task->locals.n_T.value;
+          new_task->locals.TL_row.value = this_task->locals.TL_row.value;
+          new_task->locals.TL_col.value = this_task->locals.TL_col.value;
+          new_task->locals.BR_row.value = this_task->locals.BR_row.value;
+          new_task->locals.BR_col.value = this_task->locals.BR_col.value;
+          new_task->locals.rank_Y.value = this_task->locals.rank_Y.value;
+          new_task->locals.rank_T.value = this_task->locals.rank_T.value;
+          PARSEC_LIST_ITEM_SINGLETON(new_task);
+          new_task->priority = __parsec_tp->super.super.priority;
+          new_task->repo_entry = NULL;
+#if defined(PARSEC_DEBUG_NOISIER)
+          {
+            char tmp[128];
+            PARSEC_DEBUG_VERBOSE(10, parsec_debug_output, "Add startup task %s to vpid %d",
+                   parsec_task_snprintf(tmp, 128, (parsec_task_t*)new_task), vpid);
+          }
+#endif
+          parsec_dependencies_mark_task_as_startup((parsec_task_t*)new_task, es);
+          pready_ring[vpid] = parsec_list_item_ring_push_sorted(pready_ring[vpid],
+                                                                (parsec_list_item_t*)new_task,
+                                                                parsec_execution_context_priority_comparator);
+          nb_tasks++;
+         restore_context_0:  /* we jump here just so that we have code after the label */
+          restore_context = 0;
+          (void)restore_context;
+          if( nb_tasks > this_task->locals.reserved[0].value ) {
+            if( (size_t)this_task->locals.reserved[0].value < parsec_task_startup_iter ) this_task->locals.reserved[0].value <<= 1;
+            __parsec_schedule_vp(es, (parsec_task_t**)pready_ring, 0);
+            total_nb_tasks += nb_tasks;
+            nb_tasks = 0;
+            if( total_nb_tasks > parsec_task_startup_chunk ) {  /* stop here and request to be rescheduled */
+              return PARSEC_HOOK_RETURN_AGAIN;
+            }
+          }
+        } /* Loop on normal range n_T */
+      } /* Loop on normal range m_T */
+    } /* Loop on normal range n_Y */
+  } /* Loop on normal range m_Y */
+  (void)vpid;
+  if( 0 != nb_tasks ) {
+    __parsec_schedule_vp(es, (parsec_task_t**)pready_ring, 0);
+    nb_tasks = 0;
+  }
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static const __parsec_chore_t __redistribute_bound_Send_chores[] ={
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+    { .type     = PARSEC_DEV_CPU,
+      .evaluate = (parsec_evaluate_function_t*)NULL,
+      .hook     = (parsec_hook_t*)hook_of_redistribute_bound_Send },
+#endif  /* defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+    { .type     = PARSEC_DEV_NONE,
+      .evaluate = NULL,
+      .hook     = (parsec_hook_t*)NULL },  /* End marker */
+};
+
+static const parsec_task_class_t redistribute_bound_Send = {
+  .name = "Send",
+  .task_class_id = 0,
+  .nb_flows = 0,
+  .nb_parameters = 4,
+  .nb_locals = 18,
+  .task_class_type = PARSEC_TASK_CLASS_TYPE_PTG,
+  .params = { &symb_redistribute_bound_Send_m_Y, &symb_redistribute_bound_Send_n_Y, &symb_redistribute_bound_Send_m_T, &symb_redistribute_bound_Send_n_T, NULL },
+  .locals = { &symb_redistribute_bound_Send_m_Y, &symb_redistribute_bound_Send_n_Y, &symb_redistribute_bound_Send_mb_Y_inner, &symb_redistribute_bound_Send_nb_Y_inner, &symb_redistribute_bound_Send_i_start, &symb_redistribute_bound_Send_j_start, &symb_redistribute_bound_Send_m_T_start, &symb_redistribute_bound_Send_n_T_start, &symb_redistribute_bound_Send_m_T_end, &symb_redistribute_bound_Send_n_T_end, &symb_redistribute_bound_Send_m_T, &symb_redistribute_bound_Send_n_T, &symb_redistribute_bound_Send_TL_row, &symb_redistribute_bound_Send_TL_col, &symb_redistribute_bound_Send_BR_row, &symb_redistribute_bound_Send_BR_col, &symb_redistribute_bound_Send_rank_Y, &symb_redistribute_bound_Send_rank_T, NULL },
+  .data_affinity = (parsec_data_ref_fn_t*)affinity_of_redistribute_bound_Send,
+  .initial_data = (parsec_data_ref_fn_t*)affinity_of_redistribute_bound_Send,
+  .final_data = (parsec_data_ref_fn_t*)affinity_of_redistribute_bound_Send,
+  .priority = NULL,
+  .properties = properties_of_redistribute_bound_Send,
+#if MAX_PARAM_COUNT < 0  /* number of read flows of Send */
+  #error Too many read flows for task Send
+#endif  /* MAX_PARAM_COUNT */
+#if MAX_PARAM_COUNT < 0  /* number of write flows of Send */
+  #error Too many write flows for task Send
+#endif  /* MAX_PARAM_COUNT */
+  .in = { NULL },
+  .out = { NULL },
+  .flags = 0x0 | PARSEC_USE_DEPS_MASK,
+  .dependencies_goal = 0x0,
+  .make_key = __jdf2c_make_key_Send,
+  .task_snprintf = parsec_task_snprintf,
+#if defined(PARSEC_PROF_TRACE)
+  .profile_info = &parsec_task_profile_info,
+#endif
+  .key_functions = &__jdf2c_key_fns_Send,
+  .fini = (parsec_hook_t*)NULL,
+  .incarnations = __redistribute_bound_Send_chores,
+  .find_deps = parsec_hash_find_deps,
+  .update_deps = parsec_update_deps_with_mask,
+  .iterate_successors = (parsec_traverse_function_t*)NULL,
+  .iterate_predecessors = (parsec_traverse_function_t*)NULL,
+  .release_deps = (parsec_release_deps_t*)release_deps_of_redistribute_bound_Send,
+  .prepare_output = (parsec_hook_t*)NULL,
+  .prepare_input = (parsec_hook_t*)data_lookup_of_redistribute_bound_Send,
+  .time_estimate = NULL,
+  .get_datatype = datatype_lookup_of_redistribute_bound_Send,
+  .complete_execution = (parsec_hook_t*)complete_hook_of_redistribute_bound_Send,
+  .release_task = &release_task_of_redistribute_bound_Send,
+#if defined(PARSEC_SIM)
+  .sim_cost_fct = (parsec_sim_cost_fct_t*)NULL,
+#endif
+};
+
+
+static const parsec_task_class_t *redistribute_bound_task_classes[] = {
+  &redistribute_bound_Send,
+  &redistribute_bound_Receive
+};
+
+static void redistribute_bound_startup(parsec_context_t *context, __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp, parsec_list_item_t ** ready_tasks)
+{
+  uint32_t i, supported_dev = 0;
+ 
+  for( i = 0; i < parsec_nb_devices; i++ ) {
+    if( !(__parsec_tp->super.super.devices_index_mask & (1<<i)) ) continue;
+    parsec_device_module_t* device = parsec_mca_device_get(i);
+    parsec_data_collection_t* parsec_dc;
+ 
+    if(NULL == device) continue;
+    if(NULL != device->taskpool_register)
+      if( PARSEC_SUCCESS != device->taskpool_register(device, (parsec_taskpool_t*)__parsec_tp) ) {
+        parsec_debug_verbose(5, parsec_debug_output, "Device %s refused to register taskpool %p", device->name, __parsec_tp);
+        __parsec_tp->super.super.devices_index_mask &= ~(1 << device->device_index);
+        continue;
+      }
+    if(NULL != device->memory_register) {  /* Register all the data */
+      parsec_dc = (parsec_data_collection_t*)__parsec_tp->super._g_descY;
+      if( (NULL != parsec_dc->register_memory) &&
+          (PARSEC_SUCCESS != parsec_dc->register_memory(parsec_dc, device)) ) {
+        parsec_debug_verbose(3, parsec_debug_output, "Device %s refused to register memory for data %s (%p) from taskpool %p",
+                     device->name, parsec_dc->key_base, parsec_dc, __parsec_tp);
+        __parsec_tp->super.super.devices_index_mask &= ~(1 << device->device_index);
+      }
+      parsec_dc = (parsec_data_collection_t*)__parsec_tp->super._g_descT;
+      if( (NULL != parsec_dc->register_memory) &&
+          (PARSEC_SUCCESS != parsec_dc->register_memory(parsec_dc, device)) ) {
+        parsec_debug_verbose(3, parsec_debug_output, "Device %s refused to register memory for data %s (%p) from taskpool %p",
+                     device->name, parsec_dc->key_base, parsec_dc, __parsec_tp);
+        __parsec_tp->super.super.devices_index_mask &= ~(1 << device->device_index);
+      }
+    }
+    supported_dev |= device->type;
+  }
+  /* Remove all the chores without a backend device */
+  for( i = 0; i < PARSEC_redistribute_bound_NB_TASK_CLASSES; i++ ) {
+    parsec_task_class_t* tc = (parsec_task_class_t*)__parsec_tp->super.super.task_classes_array[i];
+    __parsec_chore_t* chores = (__parsec_chore_t*)tc->incarnations;
+    uint32_t idx = 0, j;
+    for( j = 0; PARSEC_DEV_NONE != chores[j].type; j++ ) {
+      if( !(supported_dev & chores[j].type) ) continue;
+      if( j != idx ) {
+        chores[idx] = chores[j];
+        parsec_debug_verbose(20, parsec_debug_output, "Device type %i disabled for function %s"
+, chores[j].type, tc->name);
+      }
+      idx++;
+    }
+    chores[idx].type     = PARSEC_DEV_NONE;
+    chores[idx].evaluate = NULL;
+    chores[idx].hook     = NULL;
+    /* Create the initialization tasks for each taskclass */
+    parsec_task_t* task = (parsec_task_t*)parsec_thread_mempool_allocate(context->virtual_processes[0]->execution_streams[0]->context_mempool);
+    PARSEC_OBJ_CONSTRUCT(task, parsec_task_t); /* construct called only when new, force-construct it again */
+    task->taskpool = (parsec_taskpool_t *)__parsec_tp;
+    task->chore_mask = PARSEC_DEV_CPU;
+    memset(&task->locals, 0, sizeof(parsec_assignment_t) * MAX_LOCAL_COUNT);
+    PARSEC_LIST_ITEM_SINGLETON(task);
+    task->priority = -1;
+    task->task_class = task->taskpool->task_classes_array[PARSEC_redistribute_bound_NB_TASK_CLASSES + i];
+    int where = i % context->nb_vp;
+    if( NULL == ready_tasks[where] ) ready_tasks[where] = &task->super;
+    else ready_tasks[where] = parsec_list_item_ring_push(ready_tasks[where], &task->super);
+  }
+}
+static void __parsec_redistribute_bound_internal_destructor( __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp )
+{
+  uint32_t i;
+  parsec_taskpool_unregister( &__parsec_tp->super.super );
+  if(NULL != __parsec_tp->super.super.tdm.module) __parsec_tp->super.super.tdm.module->unmonitor_taskpool(&__parsec_tp->super.super);
+  for( i = 0; i < (uint32_t)(2 * __parsec_tp->super.super.nb_task_classes); i++ ) {  /* Extra startup function added at the end */
+    parsec_task_class_t* tc = (parsec_task_class_t*)__parsec_tp->super.super.task_classes_array[i];
+    free((void*)tc->incarnations);
+    free(tc);
+  }
+  free(__parsec_tp->super.super.task_classes_array); __parsec_tp->super.super.task_classes_array = NULL;
+  __parsec_tp->super.super.nb_task_classes = 0;
+
+  for(i = 0; i < (uint32_t)__parsec_tp->super.arenas_datatypes_size; i++) {
+    if( NULL != __parsec_tp->super.arenas_datatypes[i].arena ) {
+      PARSEC_OBJ_RELEASE(__parsec_tp->super.arenas_datatypes[i].arena);
+    }
+  }
+  /* Destroy the data repositories for this object */
+   data_repo_destroy_nothreadsafe(__parsec_tp->repositories[1]);  /* Receive */
+   data_repo_destroy_nothreadsafe(__parsec_tp->repositories[0]);  /* Send */
+  /* Release the dependencies arrays for this object */
+  parsec_hash_table_fini( (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[1] );
+  PARSEC_OBJ_RELEASE(__parsec_tp->super.super.dependencies_array[1]);
+  __parsec_tp->super.super.dependencies_array[1] = NULL;
+  parsec_hash_table_fini( (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[0] );
+  PARSEC_OBJ_RELEASE(__parsec_tp->super.super.dependencies_array[0]);
+  __parsec_tp->super.super.dependencies_array[0] = NULL;
+  free( __parsec_tp->super.super.dependencies_array );
+  __parsec_tp->super.super.dependencies_array = NULL;
+  /* Unregister all the data */
+  uint32_t _i;
+  for( _i = 0; _i < parsec_nb_devices; _i++ ) {
+    parsec_device_module_t* device;
+    parsec_data_collection_t* parsec_dc;
+    if(!(__parsec_tp->super.super.devices_index_mask & (1 << _i))) continue;
+    if((NULL == (device = parsec_mca_device_get(_i))) || (NULL == device->memory_unregister)) continue;
+    parsec_dc = (parsec_data_collection_t*)__parsec_tp->super._g_descY;
+  if( NULL != parsec_dc->unregister_memory ) { (void)parsec_dc->unregister_memory(parsec_dc, device); };
+  parsec_dc = (parsec_data_collection_t*)__parsec_tp->super._g_descT;
+  if( NULL != parsec_dc->unregister_memory ) { (void)parsec_dc->unregister_memory(parsec_dc, device); };
+}
+  /* Unregister the taskpool from the devices */
+  for( i = 0; i < parsec_nb_devices; i++ ) {
+    if(!(__parsec_tp->super.super.devices_index_mask & (1 << i))) continue;
+    __parsec_tp->super.super.devices_index_mask ^= (1 << i);
+    parsec_device_module_t* device = parsec_mca_device_get(i);
+    if((NULL == device) || (NULL == device->taskpool_unregister)) continue;
+    if( PARSEC_SUCCESS != device->taskpool_unregister(device, &__parsec_tp->super.super) ) continue;
+  }
+  free(__parsec_tp->super.super.taskpool_name); __parsec_tp->super.super.taskpool_name = NULL;
+}
+
+void __parsec_redistribute_bound_internal_constructor(__parsec_redistribute_bound_internal_taskpool_t* __parsec_tp)
+{
+  parsec_task_class_t* tc;
+  uint32_t i, j;
+
+  __parsec_tp->super.super.nb_task_classes = PARSEC_redistribute_bound_NB_TASK_CLASSES;
+  __parsec_tp->super.super.devices_index_mask = PARSEC_DEVICES_ALL;
+  __parsec_tp->super.super.taskpool_name = strdup("redistribute_bound");
+  parsec_termdet_open_module(&__parsec_tp->super.super, "local");
+  __parsec_tp->super.super.tdm.module->monitor_taskpool(&__parsec_tp->super.super,
+                                                        parsec_taskpool_termination_detected);
+  __parsec_tp->super.super.update_nb_runtime_task = parsec_add_fetch_runtime_task;
+  __parsec_tp->super.super.dependencies_array = (void **)
+              calloc(__parsec_tp->super.super.nb_task_classes, sizeof(void*));
+  /* Twice the size to hold the startup tasks function_t */
+  __parsec_tp->super.super.task_classes_array = (const parsec_task_class_t**)
+              calloc((2 * PARSEC_redistribute_bound_NB_TASK_CLASSES + 1), sizeof(parsec_task_class_t*));
+  __parsec_tp->super.super.tdm.module->taskpool_addto_runtime_actions(&__parsec_tp->super.super, PARSEC_redistribute_bound_NB_TASK_CLASSES);  /* for the startup tasks */
+  __parsec_tp->super.super.taskpool_type = PARSEC_TASKPOOL_TYPE_PTG;
+  __parsec_tp->sync_point = __parsec_tp->super.super.nb_task_classes;
+  __parsec_tp->initial_number_tasks = 0;
+  __parsec_tp->startup_queue = NULL;
+  for( i = 0; i < __parsec_tp->super.super.nb_task_classes; i++ ) {
+    __parsec_tp->super.super.task_classes_array[i] = tc = malloc(sizeof(parsec_task_class_t));
+    memcpy(tc, redistribute_bound_task_classes[i], sizeof(parsec_task_class_t));
+    for( j = 0; PARSEC_DEV_NONE != tc->incarnations[j].type; j++);  /* compute the number of incarnations */
+    tc->incarnations = (__parsec_chore_t*)malloc((j+1) * sizeof(__parsec_chore_t));
+        memcpy((__parsec_chore_t*)tc->incarnations, redistribute_bound_task_classes[i]->incarnations, (j+1) * sizeof(__parsec_chore_t));
+
+    /* Add a placeholder for initialization and startup task */
+    __parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+i] = tc = (parsec_task_class_t*)malloc(sizeof(parsec_task_class_t));
+    memcpy(tc, (void*)&__parsec_generic_startup, sizeof(parsec_task_class_t));
+    tc->task_class_id = __parsec_tp->super.super.nb_task_classes + i;
+    tc->incarnations = (__parsec_chore_t*)malloc(2 * sizeof(__parsec_chore_t));
+    memcpy((__parsec_chore_t*)tc->incarnations, (void*)__parsec_generic_startup.incarnations, 2 * sizeof(__parsec_chore_t));
+    tc->release_task = parsec_release_task_to_mempool_and_count_as_runtime_tasks;
+  }
+  /* Startup task for Receive */
+  tc = (parsec_task_class_t *)__parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+0];
+  tc->name = "Startup for Receive";
+  tc->prepare_input = (parsec_hook_t*)redistribute_bound_Receive_internal_init;
+  ((__parsec_chore_t*)&tc->incarnations[0])->hook = (parsec_hook_t *)__jdf2c_startup_Receive;
+  /* Startup task for Send */
+  tc = (parsec_task_class_t *)__parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+1];
+  tc->name = "Startup for Send";
+  tc->prepare_input = (parsec_hook_t*)redistribute_bound_Send_internal_init;
+  ((__parsec_chore_t*)&tc->incarnations[0])->hook = (parsec_hook_t *)__jdf2c_startup_Send;
+  /* Compute the number of arenas_datatypes: */
+  __parsec_tp->super.arenas_datatypes_size = 0;
+  memset(&__parsec_tp->super.arenas_datatypes[0], 0, __parsec_tp->super.arenas_datatypes_size*sizeof(parsec_arena_datatype_t));
+  /* If profiling is enabled, the keys for profiling */
+#  if defined(PARSEC_PROF_TRACE)
+  __parsec_tp->super.super.profiling_array = redistribute_bound_profiling_array;
+  if( -2 == redistribute_bound_profiling_array[0] ) {
+    #if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+parsec_profiling_add_dictionary_keyword("redistribute_bound::Receive::internal init", "fill:34D8D8",
+                                       0,
+                                       NULL,
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(redistribute_bound_Receive.task_class_id  + PARSEC_redistribute_bound_NB_TASK_CLASSES)/* Receive (internal init) start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(redistribute_bound_Receive.task_class_id  + PARSEC_redistribute_bound_NB_TASK_CLASSES)/* Receive (internal init) end key */]);
+#endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+parsec_profiling_add_dictionary_keyword("redistribute_bound::Receive", "fill:CC2828",
+                                       sizeof(parsec_task_prof_info_t)+18*sizeof(parsec_assignment_t),
+                                       "dc_key{uint64_t};priority{int32_t};dc_dataid{uint32_t};tcid{uint32_t};trc{int32_t};m_T{int32_t};n_T{int32_t};mb_T_inner{int32_t};nb_T_inner{int32_t};i_start{int32_t};j_start{int32_t};m_Y_start{int32_t};n_Y_start{int32_t};m_Y_end{int32_t};n_Y_end{int32_t};m_Y{int32_t};n_Y{int32_t};TL_row{int32_t};TL_col{int32_t};BR_row{int32_t};BR_col{int32_t};rank_Y{int32_t};rank_T{int32_t}",
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(redistribute_bound_Receive.task_class_id) /* Receive start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(redistribute_bound_Receive.task_class_id) /* Receive end key */]);
+
+    #if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+parsec_profiling_add_dictionary_keyword("redistribute_bound::Send::internal init", "fill:D83434",
+                                       0,
+                                       NULL,
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(redistribute_bound_Send.task_class_id  + PARSEC_redistribute_bound_NB_TASK_CLASSES)/* Send (internal init) start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(redistribute_bound_Send.task_class_id  + PARSEC_redistribute_bound_NB_TASK_CLASSES)/* Send (internal init) end key */]);
+#endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+parsec_profiling_add_dictionary_keyword("redistribute_bound::Send", "fill:28CCCC",
+                                       sizeof(parsec_task_prof_info_t)+18*sizeof(parsec_assignment_t),
+                                       "dc_key{uint64_t};priority{int32_t};dc_dataid{uint32_t};tcid{uint32_t};trc{int32_t};m_Y{int32_t};n_Y{int32_t};mb_Y_inner{int32_t};nb_Y_inner{int32_t};i_start{int32_t};j_start{int32_t};m_T_start{int32_t};n_T_start{int32_t};m_T_end{int32_t};n_T_end{int32_t};m_T{int32_t};n_T{int32_t};TL_row{int32_t};TL_col{int32_t};BR_row{int32_t};BR_col{int32_t};rank_Y{int32_t};rank_T{int32_t}",
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(redistribute_bound_Send.task_class_id) /* Send start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(redistribute_bound_Send.task_class_id) /* Send end key */]);
+
+  }
+#  endif /* defined(PARSEC_PROF_TRACE) */
+  __parsec_tp->super.super.repo_array = __parsec_tp->repositories;
+  __parsec_tp->super.super.startup_hook = (parsec_startup_fn_t)redistribute_bound_startup;
+  (void)parsec_taskpool_reserve_id((parsec_taskpool_t*)__parsec_tp);
+}
+
+  /** Generate class declaration and instance using the above constructor and destructor */
+  PARSEC_OBJ_CLASS_DECLARATION(__parsec_redistribute_bound_internal_taskpool_t);
+  PARSEC_OBJ_CLASS_INSTANCE(__parsec_redistribute_bound_internal_taskpool_t, parsec_redistribute_bound_taskpool_t,
+                            __parsec_redistribute_bound_internal_constructor, __parsec_redistribute_bound_internal_destructor);
+
+#undef descY
+#undef descT
+#undef size_row
+#undef size_col
+#undef disi_Y
+#undef disj_Y
+#undef disi_T
+#undef disj_T
+#undef R
+#undef sum_remote
+#undef sum_local
+#undef sum_remote_rank_send
+#undef sum_remote_rank_receive
+#undef sum_local_rank
+#undef sum_nb_message_remote
+#undef sum_nb_message_local
+#undef mb_Y_INNER
+#undef nb_Y_INNER
+#undef mb_T_INNER
+#undef nb_T_INNER
+#undef m_Y_START
+#undef n_Y_START
+#undef m_Y_END
+#undef n_Y_END
+#undef m_T_START
+#undef n_T_START
+#undef m_T_END
+#undef n_T_END
+
+parsec_redistribute_bound_taskpool_t *parsec_redistribute_bound_new(parsec_tiled_matrix_t* descY /* data descY */, parsec_tiled_matrix_t* descT /* data descT */, int size_row, int size_col, int disi_Y, int disj_Y, int disi_T, int disj_T, int R, long long int * sum_remote, long long int * sum_local, long long int * sum_remote_rank_send, long long int * sum_remote_rank_receive, long long int * sum_local_rank, long long int * sum_nb_message_remote, long long int * sum_nb_message_local)
+{
+  __parsec_redistribute_bound_internal_taskpool_t *__parsec_tp = PARSEC_OBJ_NEW(__parsec_redistribute_bound_internal_taskpool_t);
+  /* Dump the hidden parameters with default values */
+  int mb_Y_INNER;
+  int nb_Y_INNER;
+  int mb_T_INNER;
+  int nb_T_INNER;
+  int m_Y_START;
+  int n_Y_START;
+  int m_Y_END;
+  int n_Y_END;
+  int m_T_START;
+  int n_T_START;
+  int m_T_END;
+  int n_T_END;
+  /* Now the Parameter-dependent structures: */
+  __parsec_tp->super._g_descY = descY;
+  __parsec_tp->super._g_descT = descT;
+  __parsec_tp->super._g_size_row = size_row;
+  __parsec_tp->super._g_size_col = size_col;
+  __parsec_tp->super._g_disi_Y = disi_Y;
+  __parsec_tp->super._g_disj_Y = disj_Y;
+  __parsec_tp->super._g_disi_T = disi_T;
+  __parsec_tp->super._g_disj_T = disj_T;
+  __parsec_tp->super._g_R = R;
+  __parsec_tp->super._g_sum_remote = sum_remote;
+  __parsec_tp->super._g_sum_local = sum_local;
+  __parsec_tp->super._g_sum_remote_rank_send = sum_remote_rank_send;
+  __parsec_tp->super._g_sum_remote_rank_receive = sum_remote_rank_receive;
+  __parsec_tp->super._g_sum_local_rank = sum_local_rank;
+  __parsec_tp->super._g_sum_nb_message_remote = sum_nb_message_remote;
+  __parsec_tp->super._g_sum_nb_message_local = sum_nb_message_local;
+  __parsec_tp->super._g_mb_Y_INNER = mb_Y_INNER = descY->mb-2*R;
+  __parsec_tp->super._g_nb_Y_INNER = nb_Y_INNER = descY->nb-2*R;
+  __parsec_tp->super._g_mb_T_INNER = mb_T_INNER = descT->mb-2*R;
+  __parsec_tp->super._g_nb_T_INNER = nb_T_INNER = descT->nb-2*R;
+  __parsec_tp->super._g_m_Y_START = m_Y_START = disi_Y/mb_Y_INNER;
+  __parsec_tp->super._g_n_Y_START = n_Y_START = disj_Y/nb_Y_INNER;
+  __parsec_tp->super._g_m_Y_END = m_Y_END = (size_row+disi_Y-1)/mb_Y_INNER;
+  __parsec_tp->super._g_n_Y_END = n_Y_END = (size_col+disj_Y-1)/nb_Y_INNER;
+  __parsec_tp->super._g_m_T_START = m_T_START = disi_T/mb_T_INNER;
+  __parsec_tp->super._g_n_T_START = n_T_START = disj_T/nb_T_INNER;
+  __parsec_tp->super._g_m_T_END = m_T_END = (size_row+disi_T-1)/mb_T_INNER;
+  __parsec_tp->super._g_n_T_END = n_T_END = (size_col+disj_T-1)/nb_T_INNER;
+  PARSEC_AYU_REGISTER_TASK(&redistribute_bound_Receive);
+  PARSEC_AYU_REGISTER_TASK(&redistribute_bound_Send);
+  __parsec_tp->super.super.startup_hook = (parsec_startup_fn_t)redistribute_bound_startup;
+  (void)parsec_taskpool_reserve_id((parsec_taskpool_t*)__parsec_tp);
+/* Prevent warnings related to not used hidden global variables */
+  (void)mb_Y_INNER;  (void)nb_Y_INNER;  (void)mb_T_INNER;  (void)nb_T_INNER;  (void)m_Y_START;  (void)n_Y_START;  (void)m_Y_END;  (void)n_Y_END;  (void)m_T_START;  (void)n_T_START;  (void)m_T_END;  (void)n_T_END;
+  return (parsec_redistribute_bound_taskpool_t*)__parsec_tp;
+}
+
+
+/**
+ * @brief New function for redistribuiton_remote 
+ * 
+ * @param [in] Y: the data, already distributed and allocated
+ * @param [in] T: the data, redistributed and allocated
+ * @param [in] size_row: row size of submatrix 
+ * @param [in] size_col: column size of submatrix
+ * @param [in] disi_Y: row displacement
+ * @param [in] disj_Y: column displacement
+ * @param [in] R: radius of ghost region 
+ * @return the parsec object to schedule.
+ */
+parsec_taskpool_t* 
+parsec_redistribute_bound_New(parsec_tiled_matrix_t *Y, 
+                               parsec_tiled_matrix_t *T, 
+                               int size_row, int size_col,
+                               int disi_Y, int disj_Y,
+                               int disi_T, int disj_T, int R,
+                               long long int *sum_remote,
+                               long long int *sum_local,
+                               long long int *sum_remote_rank_send,
+                               long long int *sum_remote_rank_receive,
+                               long long int *sum_local_rank,
+                               long long int *sum_nb_message_remote,
+                               long long int *sum_nb_message_local)
+{
+    parsec_taskpool_t* redistribute_bound_taskpool;
+    parsec_redistribute_bound_taskpool_t* taskpool = NULL;
+
+    taskpool = parsec_redistribute_bound_new(Y, T, size_row, size_col,
+                                     disi_Y, disj_Y, disi_T, disj_T, R,
+                                     sum_remote, sum_local, sum_remote_rank_send,
+                                     sum_remote_rank_receive, sum_local_rank,
+                                     sum_nb_message_remote, sum_nb_message_local);
+
+    redistribute_bound_taskpool = (parsec_taskpool_t*)taskpool;
+
+    return redistribute_bound_taskpool;
+}
+
+/**
+ * @brief Calculate time bound of communication (based on data that is remote)
+ * 
+ * @param [in] dcY: source distribution, already distributed and allocated
+ * @param [in] dcT: target distribution, redistributed and allocated
+ * @param [in] size_row: row size of submatrix 
+ * @param [in] size_col: column size of submatrix
+ * @param [in] disi_Y: row displacement in dcY 
+ * @param [in] disj_Y: column displacement in dcY 
+ * @param [out]: Time Bound 
+ */
+double* parsec_redistribute_bound(parsec_context_t *parsec, 
+                                 parsec_tiled_matrix_t *dcY, 
+                                 parsec_tiled_matrix_t *dcT, 
+                                 int size_row, int size_col,
+                                 int disi_Y, int disj_Y,
+                                 int disi_T, int disj_T)
+{
+    parsec_taskpool_t *parsec_redistribute_bound_ptg = NULL;
+    double* results = (double *)calloc(8, sizeof(double));
+
+    /* R will be used for padding tiles like in AMR,
+     * here for a normal redistribution problem, R is set to 0.
+     */
+    int R = 0;
+
+    if( size_row < 1 || size_col < 1 ) {
+        if( 0 == dcY->super.myrank )
+            fprintf(stderr, "ERROR: Submatrix size should be bigger than 1\n");
+        exit(1);
+    }
+
+    if( disi_Y < 0 || disj_Y < 0 ) {
+        if( 0 == dcY->super.myrank )
+            fprintf(stderr, "ERROR: Source displacement should not be negative\n");
+        exit(1);
+    }
+
+    if( disi_T < 0 || disj_T < 0 ) {
+        if( 0 == dcY->super.myrank )
+            fprintf(stderr, "ERROR: Target displacement should not be negative\n");
+        exit(1);
+    }
+
+    if( R < 0 ) {
+        if( 0 == dcY->super.myrank )
+            fprintf(stderr, "ERROR: R should not be negative\n");
+        exit(1);
+    }
+
+    if( (disi_Y+size_row > dcY->lmt*(dcY->mb-2*R))
+        || (disj_Y+size_col > dcY->lnt*(dcY->nb-2*R)) ){
+        if( 0 == dcY->super.myrank )
+            fprintf(stderr, "ERROR: Submatrix exceed SOURCE size\n");
+        exit(1);
+    }
+
+    if( (disi_T+size_row > dcT->lmt*(dcT->mb-2*R))
+        || (disj_T+size_col > dcT->lnt*(dcT->nb-2*R)) ){
+        if( 0 == dcY->super.myrank )
+            fprintf(stderr, "ERROR: Submatrix exceed TARGET size\n");
+        exit(1);
+    }
+
+    /* Used for computing message size that is remote */
+    int world_size;
+    MPI_Comm_size(MPI_COMM_WORLD, &world_size);
+
+    /* Make sure only 1 vp */
+    assert(parsec->nb_vp == 1);
+    int nb_threads = parsec->virtual_processes[0]->nb_cores;
+
+    long long int *sum_remote = (long long int *)calloc(nb_threads, sizeof(long long int));
+    long long int *sum_local = (long long int *)calloc(nb_threads, sizeof(long long int));
+    long long int *sum_remote_rank_send = (long long int *)calloc(nb_threads, sizeof(long long int));
+    long long int *sum_remote_rank_receive = (long long int *)calloc(nb_threads, sizeof(long long int));
+    long long int *sum_local_rank = (long long int *)calloc(nb_threads, sizeof(long long int));
+    long long int *sum_nb_message_remote = (long long int *)calloc(nb_threads, sizeof(long long int));
+    long long int *sum_nb_message_local = (long long int *)calloc(nb_threads, sizeof(long long int));
+
+    parsec_redistribute_bound_ptg = parsec_redistribute_bound_New(
+                                dcY, dcT, size_row, size_col, disi_Y,
+                                disj_Y, disi_T, disj_T, R, sum_remote,
+                                sum_local, sum_remote_rank_send,
+                                sum_remote_rank_receive, sum_local_rank,
+                                sum_nb_message_remote, sum_nb_message_local);
+
+    parsec_context_add_taskpool(parsec, parsec_redistribute_bound_ptg);
+    parsec_context_start(parsec);
+    parsec_context_wait(parsec);
+    parsec_taskpool_free(parsec_redistribute_bound_ptg);
+
+    /* Reduce value in shared-memory */ 
+    for(int i = 1; i < nb_threads; i++) {
+        sum_remote[0] += sum_remote[i];
+        sum_local[0] += sum_local[i];
+        sum_remote_rank_send[0] += sum_remote_rank_send[i];
+        sum_remote_rank_receive[0] += sum_remote_rank_receive[i];
+        sum_local_rank[0] += sum_local_rank[i];
+        sum_nb_message_remote[0] += sum_nb_message_remote[i];
+        sum_nb_message_local[0] += sum_nb_message_local[i];
+    }
+
+    long long int total_remote = 0LL;
+    long long int total_local = 0LL;
+    long long int total_nb_message_remote = 0LL;
+    long long int total_nb_message_local = 0LL;
+    long long int *total_remote_rank_send = (long long int *)calloc(world_size, sizeof(long long int));
+    long long int *total_remote_rank_receive = (long long int *)calloc(world_size, sizeof(long long int));
+    long long int *total_local_rank = (long long int *)calloc(world_size, sizeof(long long int));
+    long long int sum_remote_rank = sum_remote_rank_send[0] + sum_remote_rank_receive[0];
+    long long int *total_remote_rank = (long long int *)calloc(world_size, sizeof(long long int));
+
+    MPI_Barrier( MPI_COMM_WORLD );
+    MPI_Allreduce(&sum_remote[0], &total_remote, 1, MPI_LONG_LONG_INT, MPI_SUM, MPI_COMM_WORLD);
+    MPI_Allreduce(&sum_local[0], &total_local, 1, MPI_LONG_LONG_INT, MPI_SUM, MPI_COMM_WORLD);
+    MPI_Allreduce(&sum_nb_message_remote[0], &total_nb_message_remote, 1, MPI_LONG_LONG_INT, MPI_SUM, MPI_COMM_WORLD);
+    MPI_Allreduce(&sum_nb_message_local[0], &total_nb_message_local, 1, MPI_LONG_LONG_INT, MPI_SUM, MPI_COMM_WORLD);
+    MPI_Allgather( &sum_remote_rank_send[0], 1, MPI_LONG_LONG_INT, total_remote_rank_send, 1, MPI_LONG_LONG_INT, MPI_COMM_WORLD);
+    MPI_Allgather( &sum_remote_rank_receive[0], 1, MPI_LONG_LONG_INT, total_remote_rank_receive, 1, MPI_LONG_LONG_INT, MPI_COMM_WORLD);
+    MPI_Allgather( &sum_local_rank[0], 1, MPI_LONG_LONG_INT, total_local_rank, 1, MPI_LONG_LONG_INT, MPI_COMM_WORLD);
+    MPI_Allgather( &sum_remote_rank, 1, MPI_LONG_LONG_INT, total_remote_rank, 1, MPI_LONG_LONG_INT, MPI_COMM_WORLD);
+    MPI_Barrier( MPI_COMM_WORLD );
+
+    /* Get max(send, receive) for all processes */
+    int save_rank_send = 0, save_rank_receive = 0, save_rank = 0;
+    for(int i = 1; i < world_size; i++) {
+        if( total_remote_rank_send[0] < total_remote_rank_send[i] ) {
+            total_remote_rank_send[0] = total_remote_rank_send[i]; 
+            save_rank_send = i;
+        }
+
+        if( total_remote_rank_receive[0] < total_remote_rank_receive[i] ) {
+            total_remote_rank_receive[0] = total_remote_rank_receive[i];
+            save_rank_receive = i;
+        }
+
+        if( total_remote_rank[0] < total_remote_rank[i] )
+            total_remote_rank[0] = total_remote_rank[i];
+    }
+
+    if( total_remote_rank_send[0] >= total_remote_rank_receive[0] )
+       save_rank = save_rank_send;
+    else
+       save_rank = save_rank_receive;
+
+    results[7] = 8.0 * total_local_rank[save_rank] * sizeof(DTYPE);
+
+    for(int i = 1; i < world_size; i++) {
+        if( total_local_rank[0] < total_local_rank[i] )
+            total_local_rank[0] = total_local_rank[i];
+    }
+
+    /* Check calculate corretness */
+    assert( (long long int)size_row * size_col == total_remote / 2 + total_local );   
+
+    results[0] = 8.0 * total_remote / 2 * sizeof(DTYPE);
+    results[1] = 8.0 * total_local * sizeof(DTYPE);
+    results[2] = 8.0 * fmax(total_remote_rank_send[0], total_remote_rank_receive[0]) * sizeof(DTYPE);
+    results[3] = 8.0 * total_local_rank[0] * sizeof(DTYPE);
+    results[4] = (double)total_nb_message_remote;
+    results[5] = (double)total_nb_message_local;
+    results[6] = 8.0 * total_remote_rank[0] * sizeof(DTYPE);
+
+#if defined(PARSEC_DEBUG_NOISIER)
+    if( 0 == (unsigned int)dcY->super.myrank ) { 
+        /* Total message remote */
+        printf("\nTotal remote message: %.10e bits\n", results[0]);
+
+        /* Total message local */
+        printf("Total local message: %.10e bits\n", results[1]);
+
+        /* max(send_or_recieve message remote of each rank) */
+        printf("Max send/receive remote memssage for each rank: %.10e bits\n", results[2]);
+
+        /* max(message local of each rank) */
+        printf("Max local memssage for each rank: %.10e bits\n", results[3]);
+
+        /* Total number of message remote */ 
+        printf("Total remote number of message: %.0lf\n", results[4]);
+
+        /* Total number of message local */
+        printf("Total local number of message: %.0lf\n\n", results[5]);
+
+        /* max(message remote of each rank) */
+        printf("Total remote number of message: %.0lf\n\n", results[6]);
+    }
+#endif
+
+    return results;
+}
+
+PARSEC_OBJ_CLASS_INSTANCE(parsec_redistribute_bound_taskpool_t, parsec_taskpool_t, NULL, NULL);
+
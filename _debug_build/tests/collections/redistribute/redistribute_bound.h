@@ -0,0 +1,147 @@
+#ifndef _redistribute_bound_h_
+#define _redistribute_bound_h_
+#include "parsec.h"
+#include "parsec/parsec_internal.h"
+#include "parsec/remote_dep.h"
+
+BEGIN_C_DECLS
+
+#define PARSEC_redistribute_bound_ADT_IDX_MAX       0
+typedef struct parsec_redistribute_bound_taskpool_s {
+  parsec_taskpool_t super;
+  /* The list of globals */
+  parsec_tiled_matrix_t* _g_descY /* data descY */;
+  parsec_tiled_matrix_t* _g_descT /* data descT */;
+  int _g_size_row;
+  int _g_size_col;
+  int _g_disi_Y;
+  int _g_disj_Y;
+  int _g_disi_T;
+  int _g_disj_T;
+  int _g_R;
+  long long int * _g_sum_remote;
+  long long int * _g_sum_local;
+  long long int * _g_sum_remote_rank_send;
+  long long int * _g_sum_remote_rank_receive;
+  long long int * _g_sum_local_rank;
+  long long int * _g_sum_nb_message_remote;
+  long long int * _g_sum_nb_message_local;
+  int _g_mb_Y_INNER;
+  int _g_nb_Y_INNER;
+  int _g_mb_T_INNER;
+  int _g_nb_T_INNER;
+  int _g_m_Y_START;
+  int _g_n_Y_START;
+  int _g_m_Y_END;
+  int _g_n_Y_END;
+  int _g_m_T_START;
+  int _g_n_T_START;
+  int _g_m_T_END;
+  int _g_n_T_END;
+  /* The array of datatypes ( and co.) */
+  parsec_arena_datatype_t arenas_datatypes[PARSEC_redistribute_bound_ADT_IDX_MAX];
+  uint32_t arenas_datatypes_size;
+} parsec_redistribute_bound_taskpool_t;
+
+/** Beware that this object is not a superset of the internal object, and as a result
+ *  we should never create one directly. Instead we should rely on the creation of the
+ *  internal object (__parsec_redistribute_bound_taskpool_t).
+ */
+PARSEC_OBJ_CLASS_DECLARATION(parsec_redistribute_bound_taskpool_t);
+extern parsec_redistribute_bound_taskpool_t *parsec_redistribute_bound_new(parsec_tiled_matrix_t* _g_descY /* data descY */, parsec_tiled_matrix_t* _g_descT /* data descT */, int _g_size_row, int _g_size_col, int _g_disi_Y, int _g_disj_Y, int _g_disi_T, int _g_disj_T, int _g_R, long long int * _g_sum_remote, long long int * _g_sum_local, long long int * _g_sum_remote_rank_send, long long int * _g_sum_remote_rank_receive, long long int * _g_sum_local_rank, long long int * _g_sum_nb_message_remote, long long int * _g_sum_nb_message_local);
+
+#if MAX_LOCAL_COUNT < 18  /* number of parameters and locals Receive */
+  #error Too many parameters and local variables (18 out of MAX_LOCAL_COUNT) for task Receive
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_redistribute_bound_Receive_assignment_s {
+  parsec_assignment_t m_T;
+  parsec_assignment_t n_T;
+  parsec_assignment_t mb_T_inner;
+  parsec_assignment_t nb_T_inner;
+  parsec_assignment_t i_start;
+  parsec_assignment_t j_start;
+  parsec_assignment_t m_Y_start;
+  parsec_assignment_t n_Y_start;
+  parsec_assignment_t m_Y_end;
+  parsec_assignment_t n_Y_end;
+  parsec_assignment_t m_Y;
+  parsec_assignment_t n_Y;
+  parsec_assignment_t TL_row;
+  parsec_assignment_t TL_col;
+  parsec_assignment_t BR_row;
+  parsec_assignment_t BR_col;
+  parsec_assignment_t rank_Y;
+  parsec_assignment_t rank_T;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-18];
+} __parsec_redistribute_bound_Receive_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 0  /* total number of flows for task Receive */
+  #error Too many flows (0 out of MAX_PARAM_COUNT) for task Receive
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_redistribute_bound_Receive_data_s {
+;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-0];
+} __parsec_redistribute_bound_Receive_data_t;
+
+typedef struct __parsec_redistribute_bound_Receive_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_redistribute_bound_Receive_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_redistribute_bound_Receive_data_s data;
+} __parsec_redistribute_bound_Receive_task_t;
+
+
+#if MAX_LOCAL_COUNT < 18  /* number of parameters and locals Send */
+  #error Too many parameters and local variables (18 out of MAX_LOCAL_COUNT) for task Send
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_redistribute_bound_Send_assignment_s {
+  parsec_assignment_t m_Y;
+  parsec_assignment_t n_Y;
+  parsec_assignment_t mb_Y_inner;
+  parsec_assignment_t nb_Y_inner;
+  parsec_assignment_t i_start;
+  parsec_assignment_t j_start;
+  parsec_assignment_t m_T_start;
+  parsec_assignment_t n_T_start;
+  parsec_assignment_t m_T_end;
+  parsec_assignment_t n_T_end;
+  parsec_assignment_t m_T;
+  parsec_assignment_t n_T;
+  parsec_assignment_t TL_row;
+  parsec_assignment_t TL_col;
+  parsec_assignment_t BR_row;
+  parsec_assignment_t BR_col;
+  parsec_assignment_t rank_Y;
+  parsec_assignment_t rank_T;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-18];
+} __parsec_redistribute_bound_Send_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 0  /* total number of flows for task Send */
+  #error Too many flows (0 out of MAX_PARAM_COUNT) for task Send
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_redistribute_bound_Send_data_s {
+;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-0];
+} __parsec_redistribute_bound_Send_data_t;
+
+typedef struct __parsec_redistribute_bound_Send_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_redistribute_bound_Send_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_redistribute_bound_Send_data_s data;
+} __parsec_redistribute_bound_Send_task_t;
+
+
+END_C_DECLS
+
+#endif /* _redistribute_bound_h_ */ 
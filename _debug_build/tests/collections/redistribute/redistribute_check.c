@@ -0,0 +1,6159 @@
+#include "parsec.h"
+#include "parsec/parsec_internal.h"
+#include "parsec/ayudame.h"
+#include "parsec/execution_stream.h"
+#include "parsec/parsec_binary_profile.h"
+#include "parsec/mca/device/device_gpu.h"
+#if defined(PARSEC_HAVE_DEV_CUDA_SUPPORT)
+#include "parsec/mca/device/cuda/device_cuda.h"
+#endif  /* defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) */
+#if defined(PARSEC_HAVE_DEV_HIP_SUPPORT)
+#include "parsec/mca/device/hip/device_hip.h"
+#endif  /* defined(PARSEC_HAVE_DEV_HIP_SUPPORT) */
+#if defined(_MSC_VER) || defined(__MINGW32__)
+#  include <malloc.h>
+#else
+#  include <alloca.h>
+#endif  /* defined(_MSC_VER) || defined(__MINGW32__) */
+
+#define PARSEC_redistribute_check_NB_TASK_CLASSES 4
+#define PARSEC_redistribute_check_NB_DATA 2
+
+typedef struct __parsec_redistribute_check_internal_taskpool_s __parsec_redistribute_check_internal_taskpool_t;
+struct parsec_redistribute_check_internal_taskpool_s;
+
+/** Predeclarations of the parsec_task_class_t */
+static const parsec_task_class_t redistribute_check_Get_T;
+static const parsec_task_class_t redistribute_check_Send_T;
+static const parsec_task_class_t redistribute_check_Get_Y;
+static const parsec_task_class_t redistribute_check_Send_Y;
+/** Predeclarations of the parameters */
+static const parsec_flow_t flow_of_redistribute_check_Get_T_for_T;
+static const parsec_flow_t flow_of_redistribute_check_Get_T_for_ctl;
+static const parsec_flow_t flow_of_redistribute_check_Send_T_for_T;
+static const parsec_flow_t flow_of_redistribute_check_Send_T_for_ctl;
+static const parsec_flow_t flow_of_redistribute_check_Get_Y_for_Y;
+static const parsec_flow_t flow_of_redistribute_check_Get_Y_for_ctl;
+static const parsec_flow_t flow_of_redistribute_check_Send_Y_for_Y;
+static const parsec_flow_t flow_of_redistribute_check_Send_Y_for_ctl;
+/*
+ * Copyright (c) 2017-2021 The University of Tennessee and The University
+ *                         of Tennessee Research Foundation. All rights
+ *                         reserved.
+ */
+#include "redistribute_test.h"
+
+/** @brief Global, used to compare results */
+extern DTYPE *Y_g, *T_g;
+
+#define PARSEC_redistribute_check_ORIGIN_ADT    (&__parsec_tp->super.arenas_datatypes[PARSEC_redistribute_check_ORIGIN_ADT_IDX])
+#define PARSEC_redistribute_check_DEFAULT_ADT    (&__parsec_tp->super.arenas_datatypes[PARSEC_redistribute_check_DEFAULT_ADT_IDX])
+#define PARSEC_redistribute_check_TARGET_ADT    (&__parsec_tp->super.arenas_datatypes[PARSEC_redistribute_check_TARGET_ADT_IDX])
+#include "redistribute_check.h"
+
+struct __parsec_redistribute_check_internal_taskpool_s {
+ parsec_redistribute_check_taskpool_t super;
+ volatile int32_t sync_point;
+ volatile int32_t initial_number_tasks;
+ parsec_task_t* startup_queue;
+  /* The ranges to compute the hash key */
+  int Get_T_m_min;
+  int Get_T_m_range;
+  int Get_T_n_min;
+  int Get_T_n_range;
+  int Get_T_batch_col_min;
+  int Get_T_batch_col_range;
+  int Send_T_m_min;
+  int Send_T_m_range;
+  int Send_T_n_min;
+  int Send_T_n_range;
+  int Send_T_batch_col_min;
+  int Send_T_batch_col_range;
+  int Get_Y_m_min;
+  int Get_Y_m_range;
+  int Get_Y_n_min;
+  int Get_Y_n_range;
+  int Get_Y_batch_col_min;
+  int Get_Y_batch_col_range;
+  int Send_Y_m_min;
+  int Send_Y_m_range;
+  int Send_Y_n_min;
+  int Send_Y_n_range;
+  int Send_Y_batch_col_min;
+  int Send_Y_batch_col_range;
+  /* The list of data repositories  Send_T  Send_Y */
+  data_repo_t* repositories[4];
+};
+
+#if defined(PARSEC_PROF_TRACE)
+#  if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+static int redistribute_check_profiling_array[4*PARSEC_redistribute_check_NB_TASK_CLASSES] = {-2}; /* 2 pairs (begin, end) per task, times two because each task class has an internal_init task */
+#  else /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+static int redistribute_check_profiling_array[2*PARSEC_redistribute_check_NB_TASK_CLASSES] = {-2}; /* 2 pairs (begin, end) per task */
+#  endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+#endif  /* defined(PARSEC_PROF_TRACE) */
+/* Globals */
+#define descY __parsec_tp->super._g_descY
+#define descT __parsec_tp->super._g_descT
+#define size_row (__parsec_tp->super._g_size_row)
+#define size_col (__parsec_tp->super._g_size_col)
+#define disi_Y (__parsec_tp->super._g_disi_Y)
+#define disj_Y (__parsec_tp->super._g_disj_Y)
+#define disi_T (__parsec_tp->super._g_disi_T)
+#define disj_T (__parsec_tp->super._g_disj_T)
+#define R (__parsec_tp->super._g_R)
+#define num_col_Y (__parsec_tp->super._g_num_col_Y)
+#define num_col_T (__parsec_tp->super._g_num_col_T)
+#define NY (__parsec_tp->super._g_NY)
+#define NT (__parsec_tp->super._g_NT)
+
+static inline int parsec_imin(int a, int b) { return (a <= b) ? a : b; };
+
+static inline int parsec_imax(int a, int b) { return (a >= b) ? a : b; };
+
+static inline int32_t redistribute_check_Get_T_inline_c_expr1_line_144(const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_check_Get_T_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Get_T */
+  const int batch_col = assignments->batch_col.value; (void)batch_col;
+  const int m_start = assignments->m_start.value; (void)m_start;
+  const int m_end = assignments->m_end.value; (void)m_end;
+  const int n_start = assignments->n_start.value; (void)n_start;
+  const int n_end = assignments->n_end.value; (void)n_end;
+  const int m = assignments->m.value; (void)m;
+  const int n = assignments->n.value; (void)n;
+  const int i_start = assignments->i_start.value; (void)i_start;
+  const int i_end = assignments->i_end.value; (void)i_end;
+  const int j_start = assignments->j_start.value; (void)j_start;
+  const int j_end = assignments->j_end.value; (void)j_end;
+
+  (void)batch_col;  (void)m_start;  (void)m_end;  (void)n_start;  (void)n_end;  (void)m;  (void)n;  (void)i_start;  (void)i_end;  (void)j_start;  (void)j_end;
+
+ return parsec_imin((batch_col+1)*num_col_T+n_start-1, n_end); 
+}
+
+static inline int32_t redistribute_check_Get_T_inline_c_expr2_line_144(const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_check_Get_T_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Get_T */
+  const int batch_col = assignments->batch_col.value; (void)batch_col;
+  const int m_start = assignments->m_start.value; (void)m_start;
+  const int m_end = assignments->m_end.value; (void)m_end;
+  const int n_start = assignments->n_start.value; (void)n_start;
+  const int n_end = assignments->n_end.value; (void)n_end;
+  const int m = assignments->m.value; (void)m;
+  const int n = assignments->n.value; (void)n;
+  const int i_start = assignments->i_start.value; (void)i_start;
+  const int i_end = assignments->i_end.value; (void)i_end;
+  const int j_start = assignments->j_start.value; (void)j_start;
+  const int j_end = assignments->j_end.value; (void)j_end;
+
+  (void)batch_col;  (void)m_start;  (void)m_end;  (void)n_start;  (void)n_end;  (void)m;  (void)n;  (void)i_start;  (void)i_end;  (void)j_start;  (void)j_end;
+
+ return batch_col*num_col_T+n_start; 
+}
+
+static inline int32_t redistribute_check_Send_T_inline_c_expr3_line_116(const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_check_Send_T_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Send_T */
+  const int batch_col = assignments->batch_col.value; (void)batch_col;
+  const int m_start = assignments->m_start.value; (void)m_start;
+  const int m_end = assignments->m_end.value; (void)m_end;
+  const int n_start = assignments->n_start.value; (void)n_start;
+  const int n_end = assignments->n_end.value; (void)n_end;
+  const int m = assignments->m.value; (void)m;
+  const int n = assignments->n.value; (void)n;
+
+  (void)batch_col;  (void)m_start;  (void)m_end;  (void)n_start;  (void)n_end;  (void)m;  (void)n;
+
+ return parsec_imin((batch_col+1)*num_col_T+n_start-1, n_end); 
+}
+
+static inline int32_t redistribute_check_Send_T_inline_c_expr4_line_116(const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_check_Send_T_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Send_T */
+  const int batch_col = assignments->batch_col.value; (void)batch_col;
+  const int m_start = assignments->m_start.value; (void)m_start;
+  const int m_end = assignments->m_end.value; (void)m_end;
+  const int n_start = assignments->n_start.value; (void)n_start;
+  const int n_end = assignments->n_end.value; (void)n_end;
+  const int m = assignments->m.value; (void)m;
+  const int n = assignments->n.value; (void)n;
+
+  (void)batch_col;  (void)m_start;  (void)m_end;  (void)n_start;  (void)n_end;  (void)m;  (void)n;
+
+ return batch_col*num_col_T+n_start; 
+}
+
+static inline int32_t redistribute_check_Get_Y_inline_c_expr5_line_80(const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_check_Get_Y_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Get_Y */
+  const int batch_col = assignments->batch_col.value; (void)batch_col;
+  const int m_start = assignments->m_start.value; (void)m_start;
+  const int m_end = assignments->m_end.value; (void)m_end;
+  const int n_start = assignments->n_start.value; (void)n_start;
+  const int n_end = assignments->n_end.value; (void)n_end;
+  const int m = assignments->m.value; (void)m;
+  const int n = assignments->n.value; (void)n;
+  const int i_start = assignments->i_start.value; (void)i_start;
+  const int i_end = assignments->i_end.value; (void)i_end;
+  const int j_start = assignments->j_start.value; (void)j_start;
+  const int j_end = assignments->j_end.value; (void)j_end;
+
+  (void)batch_col;  (void)m_start;  (void)m_end;  (void)n_start;  (void)n_end;  (void)m;  (void)n;  (void)i_start;  (void)i_end;  (void)j_start;  (void)j_end;
+
+ return parsec_imin((batch_col+1)*num_col_Y+n_start-1, n_end); 
+}
+
+static inline int32_t redistribute_check_Get_Y_inline_c_expr6_line_80(const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_check_Get_Y_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Get_Y */
+  const int batch_col = assignments->batch_col.value; (void)batch_col;
+  const int m_start = assignments->m_start.value; (void)m_start;
+  const int m_end = assignments->m_end.value; (void)m_end;
+  const int n_start = assignments->n_start.value; (void)n_start;
+  const int n_end = assignments->n_end.value; (void)n_end;
+  const int m = assignments->m.value; (void)m;
+  const int n = assignments->n.value; (void)n;
+  const int i_start = assignments->i_start.value; (void)i_start;
+  const int i_end = assignments->i_end.value; (void)i_end;
+  const int j_start = assignments->j_start.value; (void)j_start;
+  const int j_end = assignments->j_end.value; (void)j_end;
+
+  (void)batch_col;  (void)m_start;  (void)m_end;  (void)n_start;  (void)n_end;  (void)m;  (void)n;  (void)i_start;  (void)i_end;  (void)j_start;  (void)j_end;
+
+ return batch_col*num_col_Y+n_start; 
+}
+
+static inline int32_t redistribute_check_Send_Y_inline_c_expr7_line_52(const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_check_Send_Y_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Send_Y */
+  const int batch_col = assignments->batch_col.value; (void)batch_col;
+  const int m_start = assignments->m_start.value; (void)m_start;
+  const int m_end = assignments->m_end.value; (void)m_end;
+  const int n_start = assignments->n_start.value; (void)n_start;
+  const int n_end = assignments->n_end.value; (void)n_end;
+  const int m = assignments->m.value; (void)m;
+  const int n = assignments->n.value; (void)n;
+
+  (void)batch_col;  (void)m_start;  (void)m_end;  (void)n_start;  (void)n_end;  (void)m;  (void)n;
+
+ return parsec_imin((batch_col+1)*num_col_Y+n_start-1, n_end); 
+}
+
+static inline int32_t redistribute_check_Send_Y_inline_c_expr8_line_52(const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_check_Send_Y_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Send_Y */
+  const int batch_col = assignments->batch_col.value; (void)batch_col;
+  const int m_start = assignments->m_start.value; (void)m_start;
+  const int m_end = assignments->m_end.value; (void)m_end;
+  const int n_start = assignments->n_start.value; (void)n_start;
+  const int n_end = assignments->n_end.value; (void)n_end;
+  const int m = assignments->m.value; (void)m;
+  const int n = assignments->n.value; (void)n;
+
+  (void)batch_col;  (void)m_start;  (void)m_end;  (void)n_start;  (void)n_end;  (void)m;  (void)n;
+
+ return batch_col*num_col_Y+n_start; 
+}
+
+/* Data Access Macros */
+#define data_of_descT(descT_d0, descT_d1)  (((parsec_data_collection_t*)__parsec_tp->super._g_descT)->data_of((parsec_data_collection_t*)__parsec_tp->super._g_descT, (descT_d0), (descT_d1)))
+#define data_of_descY(descY_d0, descY_d1)  (((parsec_data_collection_t*)__parsec_tp->super._g_descY)->data_of((parsec_data_collection_t*)__parsec_tp->super._g_descY, (descY_d0), (descY_d1)))
+
+#define rank_of_descT(descT_d0, descT_d1)  (((parsec_data_collection_t*)__parsec_tp->super._g_descT)->rank_of((parsec_data_collection_t*)__parsec_tp->super._g_descT, (descT_d0), (descT_d1)))
+#define rank_of_descY(descY_d0, descY_d1)  (((parsec_data_collection_t*)__parsec_tp->super._g_descY)->rank_of((parsec_data_collection_t*)__parsec_tp->super._g_descY, (descY_d0), (descY_d1)))
+
+/* Functions Predicates */
+#define Get_T_pred(batch_col, m_start, m_end, n_start, n_end, m, n, i_start, i_end, j_start, j_end) (((parsec_data_collection_t*)(__parsec_tp->super._g_descY))->myrank == rank_of_descY(0, 0))
+#define Send_T_pred(batch_col, m_start, m_end, n_start, n_end, m, n) (((parsec_data_collection_t*)(__parsec_tp->super._g_descT))->myrank == rank_of_descT(m, n))
+#define Get_Y_pred(batch_col, m_start, m_end, n_start, n_end, m, n, i_start, i_end, j_start, j_end) (((parsec_data_collection_t*)(__parsec_tp->super._g_descY))->myrank == rank_of_descY(0, 0))
+#define Send_Y_pred(batch_col, m_start, m_end, n_start, n_end, m, n) (((parsec_data_collection_t*)(__parsec_tp->super._g_descY))->myrank == rank_of_descY(m, n))
+
+/* Data Repositories */
+#define Get_T_repo (__parsec_tp->repositories[3])
+#define Send_T_repo (__parsec_tp->repositories[2])
+#define Get_Y_repo (__parsec_tp->repositories[1])
+#define Send_Y_repo (__parsec_tp->repositories[0])
+/* Release dependencies output macro */
+#if defined(PARSEC_DEBUG_NOISIER)
+#define RELEASE_DEP_OUTPUT(ES, DEPO, TASKO, DEPI, TASKI, RSRC, RDST, DATA)\
+  do { \
+    char tmp1[128], tmp2[128]; (void)tmp1; (void)tmp2;\
+    PARSEC_DEBUG_VERBOSE(20, parsec_debug_output, "thread %d VP %d explore deps from %s:%s to %s:%s (from rank %d to %d) base ptr %p",\
+           (NULL != (ES) ? (ES)->th_id : -1), (NULL != (ES) ? (ES)->virtual_process->vp_id : -1),\
+           DEPO, parsec_task_snprintf(tmp1, 128, (parsec_task_t*)(TASKO)),\
+           DEPI, parsec_task_snprintf(tmp2, 128, (parsec_task_t*)(TASKI)), (RSRC), (RDST), (DATA));\
+  } while(0)
+#define ACQUIRE_FLOW(TASKI, DEPI, FUNO, DEPO, LOCALS, PTR)\
+  do { \
+    char tmp1[128], tmp2[128]; (void)tmp1; (void)tmp2;\
+    PARSEC_DEBUG_VERBOSE(20, parsec_debug_output, "task %s acquires flow %s from %s %s data ptr %p",\
+           parsec_task_snprintf(tmp1, 128, (parsec_task_t*)(TASKI)), (DEPI),\
+           (DEPO), parsec_snprintf_assignments(tmp2, 128, (FUNO), (parsec_assignment_t*)(LOCALS)), (PTR));\
+  } while(0)
+#else
+#define RELEASE_DEP_OUTPUT(ES, DEPO, TASKO, DEPI, TASKI, RSRC, RDST, DATA)
+#define ACQUIRE_FLOW(TASKI, DEPI, TASKO, DEPO, LOCALS, PTR)
+#endif
+static inline parsec_key_t __jdf2c_make_key_Get_T(const parsec_taskpool_t *tp, const parsec_assignment_t *as)
+{
+  const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp = (const __parsec_redistribute_check_internal_taskpool_t *)tp;
+  const __parsec_redistribute_check_Get_T_parsec_assignment_t *assignment = (const __parsec_redistribute_check_Get_T_parsec_assignment_t*)as;
+  uint64_t __parsec_id = 0;
+  __parsec_id += (assignment->batch_col.value - __parsec_tp->Get_T_batch_col_min);
+  __parsec_id += (assignment->m.value - __parsec_tp->Get_T_m_min) * __parsec_tp->Get_T_batch_col_range;
+  __parsec_id += (assignment->n.value - __parsec_tp->Get_T_n_min) * __parsec_tp->Get_T_batch_col_range * __parsec_tp->Get_T_m_range;
+  return (parsec_key_t)__parsec_id;
+}
+static char *__jdf2c_key_fns_Get_T_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_redistribute_check_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_check_internal_taskpool_t *)user_data;
+  __parsec_redistribute_check_Get_T_parsec_assignment_t __jdf2c__assignments = {  .batch_col.value = 0, .m_start.value = 0, .m_end.value = 0, .n_start.value = 0, .n_end.value = 0, .m.value = 0, .n.value = 0, .i_start.value = 0, .i_end.value = 0, .j_start.value = 0, .j_end.value = 0 };
+  int batch_col = (__parsec_key) % __parsec_tp->Get_T_batch_col_range + __parsec_tp->Get_T_batch_col_min;
+  __parsec_key = __parsec_key / __parsec_tp->Get_T_batch_col_range;
+  __jdf2c__assignments.batch_col.value = batch_col;
+  int m_start = (disi_T / (descT->mb - (2 * R)));
+  (void)m_start;
+  __jdf2c__assignments.m_start.value = m_start;
+  int m_end = (((disi_T + size_row) - 1) / (descT->mb - (2 * R)));
+  (void)m_end;
+  __jdf2c__assignments.m_end.value = m_end;
+  int n_start = (disj_T / (descT->nb - (2 * R)));
+  (void)n_start;
+  __jdf2c__assignments.n_start.value = n_start;
+  int n_end = (((disj_T + size_col) - 1) / (descT->nb - (2 * R)));
+  (void)n_end;
+  __jdf2c__assignments.n_end.value = n_end;
+  int m = (__parsec_key) % __parsec_tp->Get_T_m_range + __parsec_tp->Get_T_m_min;
+  __parsec_key = __parsec_key / __parsec_tp->Get_T_m_range;
+  __jdf2c__assignments.m.value = m;
+  int n = (__parsec_key) % __parsec_tp->Get_T_n_range + __parsec_tp->Get_T_n_min;
+  __parsec_key = __parsec_key / __parsec_tp->Get_T_n_range;
+  __jdf2c__assignments.n.value = n;
+  int i_start = (disi_T % (descT->mb - (2 * R)));
+  (void)i_start;
+  __jdf2c__assignments.i_start.value = i_start;
+  int i_end = (((disi_T + size_row) - 1) % (descT->mb - (2 * R)));
+  (void)i_end;
+  __jdf2c__assignments.i_end.value = i_end;
+  int j_start = (disj_T % (descT->nb - (2 * R)));
+  (void)j_start;
+  __jdf2c__assignments.j_start.value = j_start;
+  int j_end = (((disj_T + size_col) - 1) % (descT->nb - (2 * R)));
+  (void)j_end;
+  __jdf2c__assignments.j_end.value = j_end;
+  (void)__jdf2c__assignments;
+  snprintf(buffer, buffer_size, "Get_T(%d, %d, %d)", batch_col, m, n);
+  return buffer;
+}
+
+static parsec_key_fn_t __jdf2c_key_fns_Get_T = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = __jdf2c_key_fns_Get_T_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+static inline parsec_key_t __jdf2c_make_key_Send_T(const parsec_taskpool_t *tp, const parsec_assignment_t *as)
+{
+  const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp = (const __parsec_redistribute_check_internal_taskpool_t *)tp;
+  const __parsec_redistribute_check_Send_T_parsec_assignment_t *assignment = (const __parsec_redistribute_check_Send_T_parsec_assignment_t*)as;
+  uint64_t __parsec_id = 0;
+  __parsec_id += (assignment->batch_col.value - __parsec_tp->Send_T_batch_col_min);
+  __parsec_id += (assignment->m.value - __parsec_tp->Send_T_m_min) * __parsec_tp->Send_T_batch_col_range;
+  __parsec_id += (assignment->n.value - __parsec_tp->Send_T_n_min) * __parsec_tp->Send_T_batch_col_range * __parsec_tp->Send_T_m_range;
+  return (parsec_key_t)__parsec_id;
+}
+static char *__jdf2c_key_fns_Send_T_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_redistribute_check_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_check_internal_taskpool_t *)user_data;
+  __parsec_redistribute_check_Send_T_parsec_assignment_t __jdf2c__assignments = {  .batch_col.value = 0, .m_start.value = 0, .m_end.value = 0, .n_start.value = 0, .n_end.value = 0, .m.value = 0, .n.value = 0 };
+  int batch_col = (__parsec_key) % __parsec_tp->Send_T_batch_col_range + __parsec_tp->Send_T_batch_col_min;
+  __parsec_key = __parsec_key / __parsec_tp->Send_T_batch_col_range;
+  __jdf2c__assignments.batch_col.value = batch_col;
+  int m_start = (disi_T / (descT->mb - (2 * R)));
+  (void)m_start;
+  __jdf2c__assignments.m_start.value = m_start;
+  int m_end = (((disi_T + size_row) - 1) / (descT->mb - (2 * R)));
+  (void)m_end;
+  __jdf2c__assignments.m_end.value = m_end;
+  int n_start = (disj_T / (descT->nb - (2 * R)));
+  (void)n_start;
+  __jdf2c__assignments.n_start.value = n_start;
+  int n_end = (((disj_T + size_col) - 1) / (descT->nb - (2 * R)));
+  (void)n_end;
+  __jdf2c__assignments.n_end.value = n_end;
+  int m = (__parsec_key) % __parsec_tp->Send_T_m_range + __parsec_tp->Send_T_m_min;
+  __parsec_key = __parsec_key / __parsec_tp->Send_T_m_range;
+  __jdf2c__assignments.m.value = m;
+  int n = (__parsec_key) % __parsec_tp->Send_T_n_range + __parsec_tp->Send_T_n_min;
+  __parsec_key = __parsec_key / __parsec_tp->Send_T_n_range;
+  __jdf2c__assignments.n.value = n;
+  (void)__jdf2c__assignments;
+  snprintf(buffer, buffer_size, "Send_T(%d, %d, %d)", batch_col, m, n);
+  return buffer;
+}
+
+static parsec_key_fn_t __jdf2c_key_fns_Send_T = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = __jdf2c_key_fns_Send_T_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+static inline parsec_key_t __jdf2c_make_key_Get_Y(const parsec_taskpool_t *tp, const parsec_assignment_t *as)
+{
+  const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp = (const __parsec_redistribute_check_internal_taskpool_t *)tp;
+  const __parsec_redistribute_check_Get_Y_parsec_assignment_t *assignment = (const __parsec_redistribute_check_Get_Y_parsec_assignment_t*)as;
+  uint64_t __parsec_id = 0;
+  __parsec_id += (assignment->batch_col.value - __parsec_tp->Get_Y_batch_col_min);
+  __parsec_id += (assignment->m.value - __parsec_tp->Get_Y_m_min) * __parsec_tp->Get_Y_batch_col_range;
+  __parsec_id += (assignment->n.value - __parsec_tp->Get_Y_n_min) * __parsec_tp->Get_Y_batch_col_range * __parsec_tp->Get_Y_m_range;
+  return (parsec_key_t)__parsec_id;
+}
+static char *__jdf2c_key_fns_Get_Y_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_redistribute_check_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_check_internal_taskpool_t *)user_data;
+  __parsec_redistribute_check_Get_Y_parsec_assignment_t __jdf2c__assignments = {  .batch_col.value = 0, .m_start.value = 0, .m_end.value = 0, .n_start.value = 0, .n_end.value = 0, .m.value = 0, .n.value = 0, .i_start.value = 0, .i_end.value = 0, .j_start.value = 0, .j_end.value = 0 };
+  int batch_col = (__parsec_key) % __parsec_tp->Get_Y_batch_col_range + __parsec_tp->Get_Y_batch_col_min;
+  __parsec_key = __parsec_key / __parsec_tp->Get_Y_batch_col_range;
+  __jdf2c__assignments.batch_col.value = batch_col;
+  int m_start = (disi_Y / (descY->mb - (2 * R)));
+  (void)m_start;
+  __jdf2c__assignments.m_start.value = m_start;
+  int m_end = (((disi_Y + size_row) - 1) / (descY->mb - (2 * R)));
+  (void)m_end;
+  __jdf2c__assignments.m_end.value = m_end;
+  int n_start = (disj_Y / (descY->nb - (2 * R)));
+  (void)n_start;
+  __jdf2c__assignments.n_start.value = n_start;
+  int n_end = (((disj_Y + size_col) - 1) / (descY->nb - (2 * R)));
+  (void)n_end;
+  __jdf2c__assignments.n_end.value = n_end;
+  int m = (__parsec_key) % __parsec_tp->Get_Y_m_range + __parsec_tp->Get_Y_m_min;
+  __parsec_key = __parsec_key / __parsec_tp->Get_Y_m_range;
+  __jdf2c__assignments.m.value = m;
+  int n = (__parsec_key) % __parsec_tp->Get_Y_n_range + __parsec_tp->Get_Y_n_min;
+  __parsec_key = __parsec_key / __parsec_tp->Get_Y_n_range;
+  __jdf2c__assignments.n.value = n;
+  int i_start = (disi_Y % (descY->mb - (2 * R)));
+  (void)i_start;
+  __jdf2c__assignments.i_start.value = i_start;
+  int i_end = (((disi_Y + size_row) - 1) % (descY->mb - (2 * R)));
+  (void)i_end;
+  __jdf2c__assignments.i_end.value = i_end;
+  int j_start = (disj_Y % (descY->nb - (2 * R)));
+  (void)j_start;
+  __jdf2c__assignments.j_start.value = j_start;
+  int j_end = (((disj_Y + size_col) - 1) % (descY->nb - (2 * R)));
+  (void)j_end;
+  __jdf2c__assignments.j_end.value = j_end;
+  (void)__jdf2c__assignments;
+  snprintf(buffer, buffer_size, "Get_Y(%d, %d, %d)", batch_col, m, n);
+  return buffer;
+}
+
+static parsec_key_fn_t __jdf2c_key_fns_Get_Y = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = __jdf2c_key_fns_Get_Y_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+static inline parsec_key_t __jdf2c_make_key_Send_Y(const parsec_taskpool_t *tp, const parsec_assignment_t *as)
+{
+  const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp = (const __parsec_redistribute_check_internal_taskpool_t *)tp;
+  const __parsec_redistribute_check_Send_Y_parsec_assignment_t *assignment = (const __parsec_redistribute_check_Send_Y_parsec_assignment_t*)as;
+  uint64_t __parsec_id = 0;
+  __parsec_id += (assignment->batch_col.value - __parsec_tp->Send_Y_batch_col_min);
+  __parsec_id += (assignment->m.value - __parsec_tp->Send_Y_m_min) * __parsec_tp->Send_Y_batch_col_range;
+  __parsec_id += (assignment->n.value - __parsec_tp->Send_Y_n_min) * __parsec_tp->Send_Y_batch_col_range * __parsec_tp->Send_Y_m_range;
+  return (parsec_key_t)__parsec_id;
+}
+static char *__jdf2c_key_fns_Send_Y_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_redistribute_check_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_check_internal_taskpool_t *)user_data;
+  __parsec_redistribute_check_Send_Y_parsec_assignment_t __jdf2c__assignments = {  .batch_col.value = 0, .m_start.value = 0, .m_end.value = 0, .n_start.value = 0, .n_end.value = 0, .m.value = 0, .n.value = 0 };
+  int batch_col = (__parsec_key) % __parsec_tp->Send_Y_batch_col_range + __parsec_tp->Send_Y_batch_col_min;
+  __parsec_key = __parsec_key / __parsec_tp->Send_Y_batch_col_range;
+  __jdf2c__assignments.batch_col.value = batch_col;
+  int m_start = (disi_Y / (descY->mb - (2 * R)));
+  (void)m_start;
+  __jdf2c__assignments.m_start.value = m_start;
+  int m_end = (((disi_Y + size_row) - 1) / (descY->mb - (2 * R)));
+  (void)m_end;
+  __jdf2c__assignments.m_end.value = m_end;
+  int n_start = (disj_Y / (descY->nb - (2 * R)));
+  (void)n_start;
+  __jdf2c__assignments.n_start.value = n_start;
+  int n_end = (((disj_Y + size_col) - 1) / (descY->nb - (2 * R)));
+  (void)n_end;
+  __jdf2c__assignments.n_end.value = n_end;
+  int m = (__parsec_key) % __parsec_tp->Send_Y_m_range + __parsec_tp->Send_Y_m_min;
+  __parsec_key = __parsec_key / __parsec_tp->Send_Y_m_range;
+  __jdf2c__assignments.m.value = m;
+  int n = (__parsec_key) % __parsec_tp->Send_Y_n_range + __parsec_tp->Send_Y_n_min;
+  __parsec_key = __parsec_key / __parsec_tp->Send_Y_n_range;
+  __jdf2c__assignments.n.value = n;
+  (void)__jdf2c__assignments;
+  snprintf(buffer, buffer_size, "Send_Y(%d, %d, %d)", batch_col, m, n);
+  return buffer;
+}
+
+static parsec_key_fn_t __jdf2c_key_fns_Send_Y = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = __jdf2c_key_fns_Send_Y_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/******                                    Get_T                                      ******/
+
+static inline int32_t minexpr_of_symb_redistribute_check_Get_T_batch_col_fct(const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_check_Get_T_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_redistribute_check_Get_T_batch_col = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_redistribute_check_Get_T_batch_col_fct }
+                   }
+};
+static inline int maxexpr_of_symb_redistribute_check_Get_T_batch_col_fct(const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_check_Get_T_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_start = locals->m_start.value; (void)m_start;
+  const int m_end = locals->m_end.value; (void)m_end;
+  const int n_start = locals->n_start.value; (void)n_start;
+  const int n_end = locals->n_end.value; (void)n_end;
+  const int m = locals->m.value; (void)m;
+  const int n = locals->n.value; (void)n;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int i_end = locals->i_end.value; (void)i_end;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int j_end = locals->j_end.value; (void)j_end;
+
+  (void)batch_col;
+  (void)m_start;
+  (void)m_end;
+  (void)n_start;
+  (void)n_end;
+  (void)m;
+  (void)n;
+  (void)i_start;
+  (void)i_end;
+  (void)j_start;
+  (void)j_end;
+  (void)__parsec_tp; (void)locals;
+  return (NT - 1);
+}
+static const parsec_expr_t maxexpr_of_symb_redistribute_check_Get_T_batch_col = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_redistribute_check_Get_T_batch_col_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_check_Get_T_batch_col = { .name = "batch_col", .context_index = 0, .min = &minexpr_of_symb_redistribute_check_Get_T_batch_col, .max = &maxexpr_of_symb_redistribute_check_Get_T_batch_col, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int expr_of_symb_redistribute_check_Get_T_m_start_fct(const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_check_Get_T_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_start = locals->m_start.value; (void)m_start;
+  const int m_end = locals->m_end.value; (void)m_end;
+  const int n_start = locals->n_start.value; (void)n_start;
+  const int n_end = locals->n_end.value; (void)n_end;
+  const int m = locals->m.value; (void)m;
+  const int n = locals->n.value; (void)n;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int i_end = locals->i_end.value; (void)i_end;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int j_end = locals->j_end.value; (void)j_end;
+
+  (void)batch_col;
+  (void)m_start;
+  (void)m_end;
+  (void)n_start;
+  (void)n_end;
+  (void)m;
+  (void)n;
+  (void)i_start;
+  (void)i_end;
+  (void)j_start;
+  (void)j_end;
+  (void)__parsec_tp; (void)locals;
+  return (disi_T / (descT->mb - (2 * R)));
+}
+static const parsec_expr_t expr_of_symb_redistribute_check_Get_T_m_start = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_check_Get_T_m_start_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_check_Get_T_m_start = { .name = "m_start", .context_index = 1, .min = &expr_of_symb_redistribute_check_Get_T_m_start, .max = &expr_of_symb_redistribute_check_Get_T_m_start, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int expr_of_symb_redistribute_check_Get_T_m_end_fct(const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_check_Get_T_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_start = locals->m_start.value; (void)m_start;
+  const int m_end = locals->m_end.value; (void)m_end;
+  const int n_start = locals->n_start.value; (void)n_start;
+  const int n_end = locals->n_end.value; (void)n_end;
+  const int m = locals->m.value; (void)m;
+  const int n = locals->n.value; (void)n;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int i_end = locals->i_end.value; (void)i_end;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int j_end = locals->j_end.value; (void)j_end;
+
+  (void)batch_col;
+  (void)m_start;
+  (void)m_end;
+  (void)n_start;
+  (void)n_end;
+  (void)m;
+  (void)n;
+  (void)i_start;
+  (void)i_end;
+  (void)j_start;
+  (void)j_end;
+  (void)__parsec_tp; (void)locals;
+  return (((disi_T + size_row) - 1) / (descT->mb - (2 * R)));
+}
+static const parsec_expr_t expr_of_symb_redistribute_check_Get_T_m_end = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_check_Get_T_m_end_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_check_Get_T_m_end = { .name = "m_end", .context_index = 2, .min = &expr_of_symb_redistribute_check_Get_T_m_end, .max = &expr_of_symb_redistribute_check_Get_T_m_end, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int expr_of_symb_redistribute_check_Get_T_n_start_fct(const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_check_Get_T_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_start = locals->m_start.value; (void)m_start;
+  const int m_end = locals->m_end.value; (void)m_end;
+  const int n_start = locals->n_start.value; (void)n_start;
+  const int n_end = locals->n_end.value; (void)n_end;
+  const int m = locals->m.value; (void)m;
+  const int n = locals->n.value; (void)n;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int i_end = locals->i_end.value; (void)i_end;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int j_end = locals->j_end.value; (void)j_end;
+
+  (void)batch_col;
+  (void)m_start;
+  (void)m_end;
+  (void)n_start;
+  (void)n_end;
+  (void)m;
+  (void)n;
+  (void)i_start;
+  (void)i_end;
+  (void)j_start;
+  (void)j_end;
+  (void)__parsec_tp; (void)locals;
+  return (disj_T / (descT->nb - (2 * R)));
+}
+static const parsec_expr_t expr_of_symb_redistribute_check_Get_T_n_start = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_check_Get_T_n_start_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_check_Get_T_n_start = { .name = "n_start", .context_index = 3, .min = &expr_of_symb_redistribute_check_Get_T_n_start, .max = &expr_of_symb_redistribute_check_Get_T_n_start, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int expr_of_symb_redistribute_check_Get_T_n_end_fct(const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_check_Get_T_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_start = locals->m_start.value; (void)m_start;
+  const int m_end = locals->m_end.value; (void)m_end;
+  const int n_start = locals->n_start.value; (void)n_start;
+  const int n_end = locals->n_end.value; (void)n_end;
+  const int m = locals->m.value; (void)m;
+  const int n = locals->n.value; (void)n;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int i_end = locals->i_end.value; (void)i_end;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int j_end = locals->j_end.value; (void)j_end;
+
+  (void)batch_col;
+  (void)m_start;
+  (void)m_end;
+  (void)n_start;
+  (void)n_end;
+  (void)m;
+  (void)n;
+  (void)i_start;
+  (void)i_end;
+  (void)j_start;
+  (void)j_end;
+  (void)__parsec_tp; (void)locals;
+  return (((disj_T + size_col) - 1) / (descT->nb - (2 * R)));
+}
+static const parsec_expr_t expr_of_symb_redistribute_check_Get_T_n_end = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_check_Get_T_n_end_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_check_Get_T_n_end = { .name = "n_end", .context_index = 4, .min = &expr_of_symb_redistribute_check_Get_T_n_end, .max = &expr_of_symb_redistribute_check_Get_T_n_end, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int minexpr_of_symb_redistribute_check_Get_T_m_fct(const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_check_Get_T_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_start = locals->m_start.value;
+  const int m_end = locals->m_end.value; (void)m_end;
+  const int n_start = locals->n_start.value; (void)n_start;
+  const int n_end = locals->n_end.value; (void)n_end;
+  const int m = locals->m.value; (void)m;
+  const int n = locals->n.value; (void)n;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int i_end = locals->i_end.value; (void)i_end;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int j_end = locals->j_end.value; (void)j_end;
+
+  (void)batch_col;
+  (void)m_start;
+  (void)m_end;
+  (void)n_start;
+  (void)n_end;
+  (void)m;
+  (void)n;
+  (void)i_start;
+  (void)i_end;
+  (void)j_start;
+  (void)j_end;
+  (void)__parsec_tp; (void)locals;
+  return m_start;
+}
+static const parsec_expr_t minexpr_of_symb_redistribute_check_Get_T_m = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_redistribute_check_Get_T_m_fct }
+                   }
+};
+static inline int maxexpr_of_symb_redistribute_check_Get_T_m_fct(const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_check_Get_T_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_start = locals->m_start.value; (void)m_start;
+  const int m_end = locals->m_end.value;
+  const int n_start = locals->n_start.value; (void)n_start;
+  const int n_end = locals->n_end.value; (void)n_end;
+  const int m = locals->m.value; (void)m;
+  const int n = locals->n.value; (void)n;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int i_end = locals->i_end.value; (void)i_end;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int j_end = locals->j_end.value; (void)j_end;
+
+  (void)batch_col;
+  (void)m_start;
+  (void)m_end;
+  (void)n_start;
+  (void)n_end;
+  (void)m;
+  (void)n;
+  (void)i_start;
+  (void)i_end;
+  (void)j_start;
+  (void)j_end;
+  (void)__parsec_tp; (void)locals;
+  return m_end;
+}
+static const parsec_expr_t maxexpr_of_symb_redistribute_check_Get_T_m = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_redistribute_check_Get_T_m_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_check_Get_T_m = { .name = "m", .context_index = 5, .min = &minexpr_of_symb_redistribute_check_Get_T_m, .max = &maxexpr_of_symb_redistribute_check_Get_T_m, .cst_inc = 1, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t minexpr_of_symb_redistribute_check_Get_T_n_fct(const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_check_Get_T_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_check_Get_T_inline_c_expr2_line_144(__parsec_tp, locals);
+}
+static const parsec_expr_t minexpr_of_symb_redistribute_check_Get_T_n = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_redistribute_check_Get_T_n_fct }
+                   }
+};
+static inline int32_t maxexpr_of_symb_redistribute_check_Get_T_n_fct(const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_check_Get_T_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_check_Get_T_inline_c_expr1_line_144(__parsec_tp, locals);
+}
+static const parsec_expr_t maxexpr_of_symb_redistribute_check_Get_T_n = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_redistribute_check_Get_T_n_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_check_Get_T_n = { .name = "n", .context_index = 6, .min = &minexpr_of_symb_redistribute_check_Get_T_n, .max = &maxexpr_of_symb_redistribute_check_Get_T_n, .cst_inc = 1, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int expr_of_symb_redistribute_check_Get_T_i_start_fct(const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_check_Get_T_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_start = locals->m_start.value; (void)m_start;
+  const int m_end = locals->m_end.value; (void)m_end;
+  const int n_start = locals->n_start.value; (void)n_start;
+  const int n_end = locals->n_end.value; (void)n_end;
+  const int m = locals->m.value; (void)m;
+  const int n = locals->n.value; (void)n;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int i_end = locals->i_end.value; (void)i_end;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int j_end = locals->j_end.value; (void)j_end;
+
+  (void)batch_col;
+  (void)m_start;
+  (void)m_end;
+  (void)n_start;
+  (void)n_end;
+  (void)m;
+  (void)n;
+  (void)i_start;
+  (void)i_end;
+  (void)j_start;
+  (void)j_end;
+  (void)__parsec_tp; (void)locals;
+  return (disi_T % (descT->mb - (2 * R)));
+}
+static const parsec_expr_t expr_of_symb_redistribute_check_Get_T_i_start = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_check_Get_T_i_start_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_check_Get_T_i_start = { .name = "i_start", .context_index = 7, .min = &expr_of_symb_redistribute_check_Get_T_i_start, .max = &expr_of_symb_redistribute_check_Get_T_i_start, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int expr_of_symb_redistribute_check_Get_T_i_end_fct(const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_check_Get_T_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_start = locals->m_start.value; (void)m_start;
+  const int m_end = locals->m_end.value; (void)m_end;
+  const int n_start = locals->n_start.value; (void)n_start;
+  const int n_end = locals->n_end.value; (void)n_end;
+  const int m = locals->m.value; (void)m;
+  const int n = locals->n.value; (void)n;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int i_end = locals->i_end.value; (void)i_end;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int j_end = locals->j_end.value; (void)j_end;
+
+  (void)batch_col;
+  (void)m_start;
+  (void)m_end;
+  (void)n_start;
+  (void)n_end;
+  (void)m;
+  (void)n;
+  (void)i_start;
+  (void)i_end;
+  (void)j_start;
+  (void)j_end;
+  (void)__parsec_tp; (void)locals;
+  return (((disi_T + size_row) - 1) % (descT->mb - (2 * R)));
+}
+static const parsec_expr_t expr_of_symb_redistribute_check_Get_T_i_end = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_check_Get_T_i_end_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_check_Get_T_i_end = { .name = "i_end", .context_index = 8, .min = &expr_of_symb_redistribute_check_Get_T_i_end, .max = &expr_of_symb_redistribute_check_Get_T_i_end, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int expr_of_symb_redistribute_check_Get_T_j_start_fct(const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_check_Get_T_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_start = locals->m_start.value; (void)m_start;
+  const int m_end = locals->m_end.value; (void)m_end;
+  const int n_start = locals->n_start.value; (void)n_start;
+  const int n_end = locals->n_end.value; (void)n_end;
+  const int m = locals->m.value; (void)m;
+  const int n = locals->n.value; (void)n;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int i_end = locals->i_end.value; (void)i_end;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int j_end = locals->j_end.value; (void)j_end;
+
+  (void)batch_col;
+  (void)m_start;
+  (void)m_end;
+  (void)n_start;
+  (void)n_end;
+  (void)m;
+  (void)n;
+  (void)i_start;
+  (void)i_end;
+  (void)j_start;
+  (void)j_end;
+  (void)__parsec_tp; (void)locals;
+  return (disj_T % (descT->nb - (2 * R)));
+}
+static const parsec_expr_t expr_of_symb_redistribute_check_Get_T_j_start = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_check_Get_T_j_start_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_check_Get_T_j_start = { .name = "j_start", .context_index = 9, .min = &expr_of_symb_redistribute_check_Get_T_j_start, .max = &expr_of_symb_redistribute_check_Get_T_j_start, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int expr_of_symb_redistribute_check_Get_T_j_end_fct(const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_check_Get_T_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_start = locals->m_start.value; (void)m_start;
+  const int m_end = locals->m_end.value; (void)m_end;
+  const int n_start = locals->n_start.value; (void)n_start;
+  const int n_end = locals->n_end.value; (void)n_end;
+  const int m = locals->m.value; (void)m;
+  const int n = locals->n.value; (void)n;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int i_end = locals->i_end.value; (void)i_end;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int j_end = locals->j_end.value; (void)j_end;
+
+  (void)batch_col;
+  (void)m_start;
+  (void)m_end;
+  (void)n_start;
+  (void)n_end;
+  (void)m;
+  (void)n;
+  (void)i_start;
+  (void)i_end;
+  (void)j_start;
+  (void)j_end;
+  (void)__parsec_tp; (void)locals;
+  return (((disj_T + size_col) - 1) % (descT->nb - (2 * R)));
+}
+static const parsec_expr_t expr_of_symb_redistribute_check_Get_T_j_end = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_check_Get_T_j_end_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_check_Get_T_j_end = { .name = "j_end", .context_index = 10, .min = &expr_of_symb_redistribute_check_Get_T_j_end, .max = &expr_of_symb_redistribute_check_Get_T_j_end, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int affinity_of_redistribute_check_Get_T(const __parsec_redistribute_check_Get_T_task_t *this_task,
+                     parsec_data_ref_t *ref)
+{
+    const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp = (const __parsec_redistribute_check_internal_taskpool_t*)this_task->taskpool;
+  const int batch_col = this_task->locals.batch_col.value; (void)batch_col;
+  const int m_start = this_task->locals.m_start.value; (void)m_start;
+  const int m_end = this_task->locals.m_end.value; (void)m_end;
+  const int n_start = this_task->locals.n_start.value; (void)n_start;
+  const int n_end = this_task->locals.n_end.value; (void)n_end;
+  const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+  const int i_start = this_task->locals.i_start.value; (void)i_start;
+  const int i_end = this_task->locals.i_end.value; (void)i_end;
+  const int j_start = this_task->locals.j_start.value; (void)j_start;
+  const int j_end = this_task->locals.j_end.value; (void)j_end;
+
+  /* Silent Warnings: should look into predicate to know what variables are usefull */
+  (void)batch_col;
+  (void)m_start;
+  (void)m_end;
+  (void)n_start;
+  (void)n_end;
+  (void)m;
+  (void)n;
+  (void)i_start;
+  (void)i_end;
+  (void)j_start;
+  (void)j_end;
+  ref->dc = (parsec_data_collection_t *)__parsec_tp->super._g_descY;
+  /* Compute data key */
+  ref->key = ref->dc->data_key(ref->dc, 0, 0);
+  return 1;
+}
+static const parsec_property_t properties_of_redistribute_check_Get_T[1] = {
+  {.name = NULL, .expr = NULL}
+};
+static const parsec_dep_t flow_of_redistribute_check_Get_T_for_T_dep1_atline_154 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 2, /* redistribute_check_Send_T */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_redistribute_check_Send_T_for_T,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_redistribute_check_Get_T_for_T,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_redistribute_check_Get_T_for_T = {
+  .name               = "T",
+  .sym_type           = PARSEC_SYM_IN,
+  .flow_flags         = PARSEC_FLOW_ACCESS_READ,
+  .flow_index         = 0,
+  .flow_datatype_mask = 0x0,
+  .dep_in     = { &flow_of_redistribute_check_Get_T_for_T_dep1_atline_154 },
+  .dep_out    = { NULL }
+};
+
+static inline int expr_of_cond_for_flow_of_redistribute_check_Get_T_for_ctl_dep1_atline_156_fct(const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_check_Get_T_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_start = locals->m_start.value; (void)m_start;
+  const int m_end = locals->m_end.value; (void)m_end;
+  const int n_start = locals->n_start.value; (void)n_start;
+  const int n_end = locals->n_end.value; (void)n_end;
+  const int m = locals->m.value; (void)m;
+  const int n = locals->n.value; (void)n;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int i_end = locals->i_end.value; (void)i_end;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int j_end = locals->j_end.value; (void)j_end;
+
+  (void)batch_col;
+  (void)m_start;
+  (void)m_end;
+  (void)n_start;
+  (void)n_end;
+  (void)m;
+  (void)n;
+  (void)i_start;
+  (void)i_end;
+  (void)j_start;
+  (void)j_end;
+  (void)__parsec_tp; (void)locals;
+  return (batch_col) < ((NT - 1));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_redistribute_check_Get_T_for_ctl_dep1_atline_156 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_redistribute_check_Get_T_for_ctl_dep1_atline_156_fct }
+                   }
+};
+static const parsec_dep_t flow_of_redistribute_check_Get_T_for_ctl_dep1_atline_156 = {
+  .cond = &expr_of_cond_for_flow_of_redistribute_check_Get_T_for_ctl_dep1_atline_156,  /* (batch_col) < ((NT - 1)) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 2, /* redistribute_check_Send_T */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_redistribute_check_Send_T_for_ctl,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_redistribute_check_Get_T_for_ctl,
+};
+#if MAX_DEP_OUT_COUNT < 1  /* number of output dependencies */
+    #error Too many output dependencies (supports up to MAX_DEP_OUT_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_OUT_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_redistribute_check_Get_T_for_ctl = {
+  .name               = "ctl",
+  .sym_type           = PARSEC_SYM_OUT,
+  .flow_flags         = PARSEC_FLOW_ACCESS_NONE,
+  .flow_index         = 1,
+  .flow_datatype_mask = 0x1,
+  .dep_in     = { NULL },
+  .dep_out    = { &flow_of_redistribute_check_Get_T_for_ctl_dep1_atline_156 }
+};
+
+static void
+iterate_successors_of_redistribute_check_Get_T(parsec_execution_stream_t *es, const __parsec_redistribute_check_Get_T_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp = (const __parsec_redistribute_check_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_redistribute_check_Get_T_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_redistribute_check_Get_T_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int batch_col = __jdf2c__tmp_locals.batch_col.value; (void)batch_col;
+  const int m_start = __jdf2c__tmp_locals.m_start.value; (void)m_start;
+  const int m_end = __jdf2c__tmp_locals.m_end.value; (void)m_end;
+  const int n_start = __jdf2c__tmp_locals.n_start.value; (void)n_start;
+  const int n_end = __jdf2c__tmp_locals.n_end.value; (void)n_end;
+  const int m = __jdf2c__tmp_locals.m.value; (void)m;
+  const int n = __jdf2c__tmp_locals.n.value; (void)n;
+  const int i_start = __jdf2c__tmp_locals.i_start.value; (void)i_start;
+  const int i_end = __jdf2c__tmp_locals.i_end.value; (void)i_end;
+  const int j_start = __jdf2c__tmp_locals.j_start.value; (void)j_start;
+  const int j_end = __jdf2c__tmp_locals.j_end.value; (void)j_end;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)batch_col;  (void)m_start;  (void)m_end;  (void)n_start;  (void)n_end;  (void)m;  (void)n;  (void)i_start;  (void)i_end;  (void)j_start;  (void)j_end;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_descY(0, 0);
+#endif
+  /* Flow of data T has only IN dependencies */
+  if( action_mask & 0x1 ) {  /* Flow of data ctl [1] */
+    data.data   = this_task->data._f_ctl.data_out;
+    data.data_future  = NULL;
+    if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  =   /* Control: always empty */ 0;
+    data.local.dst_count  =   /* Control: always empty */ 0;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = NULL;
+    data.remote.src_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.src_count  =   /* Control: always empty */ 0;
+    data.remote.dst_count  =   /* Control: always empty */ 0;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+       if( (batch_col) < ((NT - 1)) ) {
+      __parsec_redistribute_check_Send_T_task_t* ncc = (__parsec_redistribute_check_Send_T_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[redistribute_check_Send_T.task_class_id];
+        const int Send_T_batch_col = (batch_col + 1);
+        if( (Send_T_batch_col >= (0)) && (Send_T_batch_col <= ((NT - 1))) ) {
+          assert(&nc.locals[0].value == &ncc->locals.batch_col.value);
+          ncc->locals.batch_col.value = Send_T_batch_col;
+          const int Send_T_m_start = (disi_T / (descT->mb - (2 * R)));
+          assert(&nc.locals[1].value == &ncc->locals.m_start.value);
+          ncc->locals.m_start.value = Send_T_m_start;
+          const int Send_T_m_end = (((disi_T + size_row) - 1) / (descT->mb - (2 * R)));
+          assert(&nc.locals[2].value == &ncc->locals.m_end.value);
+          ncc->locals.m_end.value = Send_T_m_end;
+          const int Send_T_n_start = (disj_T / (descT->nb - (2 * R)));
+          assert(&nc.locals[3].value == &ncc->locals.n_start.value);
+          ncc->locals.n_start.value = Send_T_n_start;
+          const int Send_T_n_end = (((disj_T + size_col) - 1) / (descT->nb - (2 * R)));
+          assert(&nc.locals[4].value == &ncc->locals.n_end.value);
+          ncc->locals.n_end.value = Send_T_n_end;
+          const int Send_T_m = m;
+          if( (Send_T_m >= (ncc->locals.m_start.value)) && (Send_T_m <= (ncc->locals.m_end.value)) ) {
+            assert(&nc.locals[5].value == &ncc->locals.m.value);
+            ncc->locals.m.value = Send_T_m;
+            const int Send_T_n = (n + num_col_T);
+            if( (Send_T_n >= (redistribute_check_Send_T_inline_c_expr4_line_116(__parsec_tp, &ncc->locals))) && (Send_T_n <= (redistribute_check_Send_T_inline_c_expr3_line_116(__parsec_tp, &ncc->locals))) ) {
+              assert(&nc.locals[6].value == &ncc->locals.n.value);
+              ncc->locals.n.value = Send_T_n;
+#if defined(DISTRIBUTED)
+              rank_dst = rank_of_descT(ncc->locals.m.value, ncc->locals.n.value);
+              if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+                vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descT)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descT, ncc->locals.m.value, ncc->locals.n.value);
+              nc.priority = __parsec_tp->super.super.priority;
+              successor_repo = Send_T_repo;
+              successor_repo_key = __jdf2c_make_key_Send_T((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+            RELEASE_DEP_OUTPUT(es, "ctl", this_task, "ctl", &nc, rank_src, rank_dst, &data);
+            if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_redistribute_check_Get_T_for_ctl_dep1_atline_156, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+              }
+            }
+          }
+    }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static void
+iterate_predecessors_of_redistribute_check_Get_T(parsec_execution_stream_t *es, const __parsec_redistribute_check_Get_T_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp = (const __parsec_redistribute_check_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_redistribute_check_Get_T_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_redistribute_check_Get_T_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int batch_col = __jdf2c__tmp_locals.batch_col.value; (void)batch_col;
+  const int m_start = __jdf2c__tmp_locals.m_start.value; (void)m_start;
+  const int m_end = __jdf2c__tmp_locals.m_end.value; (void)m_end;
+  const int n_start = __jdf2c__tmp_locals.n_start.value; (void)n_start;
+  const int n_end = __jdf2c__tmp_locals.n_end.value; (void)n_end;
+  const int m = __jdf2c__tmp_locals.m.value; (void)m;
+  const int n = __jdf2c__tmp_locals.n.value; (void)n;
+  const int i_start = __jdf2c__tmp_locals.i_start.value; (void)i_start;
+  const int i_end = __jdf2c__tmp_locals.i_end.value; (void)i_end;
+  const int j_start = __jdf2c__tmp_locals.j_start.value; (void)j_start;
+  const int j_end = __jdf2c__tmp_locals.j_end.value; (void)j_end;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)batch_col;  (void)m_start;  (void)m_end;  (void)n_start;  (void)n_end;  (void)m;  (void)n;  (void)i_start;  (void)i_end;  (void)j_start;  (void)j_end;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_descY(0, 0);
+#endif
+  if( action_mask & 0x1 ) {  /* Flow of data T [0] */
+    data.data   = this_task->data._f_T.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x1 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_redistribute_check_TARGET_ADT->arena;
+    data.local.src_datatype = PARSEC_redistribute_check_TARGET_ADT->opaque_dtt;
+    data.local.dst_datatype = PARSEC_redistribute_check_TARGET_ADT->opaque_dtt;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_redistribute_check_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        __parsec_redistribute_check_Send_T_task_t* ncc = (__parsec_redistribute_check_Send_T_task_t*)&nc;
+    nc.task_class = __parsec_tp->super.super.task_classes_array[redistribute_check_Send_T.task_class_id];
+      const int Send_T_batch_col = batch_col;
+      if( (Send_T_batch_col >= (0)) && (Send_T_batch_col <= ((NT - 1))) ) {
+        assert(&nc.locals[0].value == &ncc->locals.batch_col.value);
+        ncc->locals.batch_col.value = Send_T_batch_col;
+        const int Send_T_m_start = (disi_T / (descT->mb - (2 * R)));
+        assert(&nc.locals[1].value == &ncc->locals.m_start.value);
+        ncc->locals.m_start.value = Send_T_m_start;
+        const int Send_T_m_end = (((disi_T + size_row) - 1) / (descT->mb - (2 * R)));
+        assert(&nc.locals[2].value == &ncc->locals.m_end.value);
+        ncc->locals.m_end.value = Send_T_m_end;
+        const int Send_T_n_start = (disj_T / (descT->nb - (2 * R)));
+        assert(&nc.locals[3].value == &ncc->locals.n_start.value);
+        ncc->locals.n_start.value = Send_T_n_start;
+        const int Send_T_n_end = (((disj_T + size_col) - 1) / (descT->nb - (2 * R)));
+        assert(&nc.locals[4].value == &ncc->locals.n_end.value);
+        ncc->locals.n_end.value = Send_T_n_end;
+        const int Send_T_m = m;
+        if( (Send_T_m >= (ncc->locals.m_start.value)) && (Send_T_m <= (ncc->locals.m_end.value)) ) {
+          assert(&nc.locals[5].value == &ncc->locals.m.value);
+          ncc->locals.m.value = Send_T_m;
+          const int Send_T_n = n;
+          if( (Send_T_n >= (redistribute_check_Send_T_inline_c_expr4_line_116(__parsec_tp, &ncc->locals))) && (Send_T_n <= (redistribute_check_Send_T_inline_c_expr3_line_116(__parsec_tp, &ncc->locals))) ) {
+            assert(&nc.locals[6].value == &ncc->locals.n.value);
+            ncc->locals.n.value = Send_T_n;
+#if defined(DISTRIBUTED)
+            rank_dst = rank_of_descT(ncc->locals.m.value, ncc->locals.n.value);
+            if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+              vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descT)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descT, ncc->locals.m.value, ncc->locals.n.value);
+            nc.priority = __parsec_tp->super.super.priority;
+            successor_repo = Send_T_repo;
+            successor_repo_key = __jdf2c_make_key_Send_T((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+          RELEASE_DEP_OUTPUT(es, "T", this_task, "T", &nc, rank_src, rank_dst, &data);
+          if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_redistribute_check_Get_T_for_T_dep1_atline_154, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+            }
+          }
+        }
+  }
+  }
+  /* Flow of data ctl has only IN dependencies */
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static int release_deps_of_redistribute_check_Get_T(parsec_execution_stream_t *es, __parsec_redistribute_check_Get_T_task_t *this_task, uint32_t action_mask, parsec_remote_deps_t *deps)
+{
+  PARSEC_PINS(es, RELEASE_DEPS_BEGIN, (parsec_task_t *)this_task);  const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp = (const __parsec_redistribute_check_internal_taskpool_t *)this_task->taskpool;
+  parsec_release_dep_fct_arg_t arg;
+  int __vp_id;
+  int consume_local_repo = 0;
+  arg.action_mask = action_mask;
+  arg.output_entry = NULL;
+  arg.output_repo = NULL;
+#if defined(DISTRIBUTED)
+  arg.remote_deps = deps;
+#endif  /* defined(DISTRIBUTED) */
+  assert(NULL != es);
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS )    arg.ready_lists = alloca(sizeof(parsec_task_t *) * es->virtual_process->parsec_context->nb_vp);
+  else
+    arg.ready_lists = NULL;
+  for( __vp_id = 0; __vp_id < es->virtual_process->parsec_context->nb_vp; arg.ready_lists[__vp_id++] = NULL );
+  (void)__parsec_tp; (void)deps;
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_T.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_T.source_repo, this_task->data._f_T.source_repo_entry->ht_item.key );
+    }
+  }
+  consume_local_repo = (this_task->repo_entry != NULL);
+  arg.output_repo = Get_T_repo;
+  arg.output_entry = this_task->repo_entry;
+  arg.output_usage = 0;
+  if( action_mask & (PARSEC_ACTION_RELEASE_LOCAL_DEPS | PARSEC_ACTION_GET_REPO_ENTRY) ) {
+    arg.output_entry = data_repo_lookup_entry_and_create( es, arg.output_repo, __jdf2c_make_key_Get_T((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    arg.output_entry->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(arg.output_entry->sim_exec_date == 0);
+    arg.output_entry->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  if(action_mask & ( PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE ) ){
+    /* Generate the reshape promise for the outputs that need it */
+    iterate_successors_of_redistribute_check_Get_T(es, this_task, action_mask, parsec_set_up_reshape_promise, &arg);
+   }
+  iterate_successors_of_redistribute_check_Get_T(es, this_task, action_mask, parsec_release_dep_fct, &arg);
+
+#if defined(DISTRIBUTED)
+  if( (action_mask & PARSEC_ACTION_SEND_REMOTE_DEPS) && (NULL != arg.remote_deps)) {
+    parsec_remote_dep_activate(es, (parsec_task_t *)this_task, arg.remote_deps, arg.remote_deps->outgoing_mask);
+  }
+#endif
+
+  if(action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS) {
+    data_repo_entry_addto_usage_limit(Get_T_repo, arg.output_entry->ht_item.key, arg.output_usage);
+    __parsec_schedule_vp(es, arg.ready_lists, 0);
+  }
+      if (consume_local_repo) {
+         data_repo_entry_used_once( Get_T_repo, this_task->repo_entry->ht_item.key );
+      }
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_T.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_T.data_in);
+    }
+  }
+  PARSEC_PINS(es, RELEASE_DEPS_END, (parsec_task_t *)this_task);  return 0;
+}
+
+static int data_lookup_of_redistribute_check_Get_T(parsec_execution_stream_t *es, __parsec_redistribute_check_Get_T_task_t *this_task)
+{
+  const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_check_internal_taskpool_t *)this_task->taskpool;
+  parsec_assignment_t generic_locals[MAX_PARAM_COUNT];  /* generic task locals */
+  int target_device = 0; (void)target_device;
+  (void)__parsec_tp; (void)generic_locals; (void)es;
+  parsec_data_copy_t *chunk = NULL;
+  data_repo_t        *reshape_repo  = NULL, *consumed_repo  = NULL;
+  data_repo_entry_t  *reshape_entry = NULL, *consumed_entry = NULL;
+  parsec_key_t        reshape_entry_key = 0, consumed_entry_key = 0;
+  uint8_t             consumed_flow_index;
+  parsec_dep_data_description_t data;
+  int ret;
+  (void)reshape_repo; (void)reshape_entry; (void)reshape_entry_key;
+  (void)consumed_repo; (void)consumed_entry; (void)consumed_entry_key;
+  (void)consumed_flow_index;
+  (void)chunk; (void)data; (void)ret;
+  const int batch_col = this_task->locals.batch_col.value; (void)batch_col;
+  const int m_start = this_task->locals.m_start.value; (void)m_start;
+  const int m_end = this_task->locals.m_end.value; (void)m_end;
+  const int n_start = this_task->locals.n_start.value; (void)n_start;
+  const int n_end = this_task->locals.n_end.value; (void)n_end;
+  const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+  const int i_start = this_task->locals.i_start.value; (void)i_start;
+  const int i_end = this_task->locals.i_end.value; (void)i_end;
+  const int j_start = this_task->locals.j_start.value; (void)j_start;
+  const int j_end = this_task->locals.j_end.value; (void)j_end;
+  if( NULL == this_task->repo_entry ){
+    this_task->repo_entry = data_repo_lookup_entry_and_create(es, Get_T_repo,                                       __jdf2c_make_key_Get_T((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    data_repo_entry_addto_usage_limit(Get_T_repo, this_task->repo_entry->ht_item.key, 1);    this_task->repo_entry ->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(this_task->repo_entry ->sim_exec_date == 0);
+    this_task->repo_entry ->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  /* The reshape repo is the current task repo. */  reshape_repo = Get_T_repo;
+  reshape_entry_key = __jdf2c_make_key_Get_T((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals) ;
+  reshape_entry = this_task->repo_entry;
+  /* Lookup the input data, and store them in the context if any */
+
+if(! this_task->data._f_T.fulfill ){ /* Flow T */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_T.data_out = NULL;  /* input only */
+  /* Flow T [0] dependency [0] from predecessor Send_T */
+  if( NULL == (chunk = this_task->data._f_T.data_in) ) {
+  /* No data set up by predecessor on this task input flow */
+__parsec_redistribute_check_Send_T_parsec_assignment_t *target_locals = (__parsec_redistribute_check_Send_T_parsec_assignment_t*)&generic_locals;
+  const int Send_Tbatch_col = target_locals->batch_col.value = batch_col; (void)Send_Tbatch_col;
+  const int Send_Tm_start = target_locals->m_start.value = (disi_T / (descT->mb - (2 * R))); (void)Send_Tm_start;
+  const int Send_Tm_end = target_locals->m_end.value = (((disi_T + size_row) - 1) / (descT->mb - (2 * R))); (void)Send_Tm_end;
+  const int Send_Tn_start = target_locals->n_start.value = (disj_T / (descT->nb - (2 * R))); (void)Send_Tn_start;
+  const int Send_Tn_end = target_locals->n_end.value = (((disj_T + size_col) - 1) / (descT->nb - (2 * R))); (void)Send_Tn_end;
+  const int Send_Tm = target_locals->m.value = m; (void)Send_Tm;
+  const int Send_Tn = target_locals->n.value = n; (void)Send_Tn;
+    if( (reshape_entry != NULL) && (reshape_entry->data[0] != NULL) ){
+        /* Reshape promise set up on this task repo by predecessor */
+        consumed_repo = reshape_repo;
+        consumed_entry = reshape_entry;
+        consumed_entry_key = reshape_entry_key;
+        consumed_flow_index = 0;
+    }else{
+        /* Consume from predecessor's repo */
+        consumed_repo = Send_T_repo;
+        consumed_entry_key = __jdf2c_make_key_Send_T((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)target_locals) ;
+        consumed_entry = data_repo_lookup_entry( consumed_repo, consumed_entry_key );
+        consumed_flow_index = 0;
+    }
+    data.data   = NULL;
+    data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+        data.local.arena  = PARSEC_redistribute_check_TARGET_ADT->arena;
+    data.local.src_datatype = PARSEC_redistribute_check_TARGET_ADT->opaque_dtt;
+    data.local.dst_datatype = PARSEC_redistribute_check_TARGET_ADT->opaque_dtt;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    ACQUIRE_FLOW(this_task, "T", &redistribute_check_Send_T, "T", target_locals, chunk);
+    this_task->data._f_T.data_out = chunk;
+  } 
+  else {
+    /* Data set up by predecessor on this task input flow */
+    consumed_repo = this_task->data._f_T.source_repo;
+    consumed_entry = this_task->data._f_T.source_repo_entry;
+    consumed_entry_key = this_task->data._f_T.source_repo_entry->ht_item.key;
+    if( (reshape_entry != NULL) && (reshape_entry->data[0] != NULL) ){
+        /* Reshape promise set up on input by predecessor is on this task repo */
+        consumed_flow_index = 0;
+        assert( (this_task->data._f_T.source_repo == reshape_repo)
+             && (this_task->data._f_T.source_repo_entry == reshape_entry));
+    }else{
+        /* Reshape promise set up on input by predecessor is the predecesssor task repo */
+        consumed_flow_index = 0;
+    }
+    data.data   = NULL;
+    data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+        data.local.arena  = PARSEC_redistribute_check_TARGET_ADT->arena;
+    data.local.src_datatype = PARSEC_redistribute_check_TARGET_ADT->opaque_dtt;
+    data.local.dst_datatype = PARSEC_redistribute_check_TARGET_ADT->opaque_dtt;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    this_task->data._f_T.data_out = parsec_data_get_copy(chunk->original, target_device);
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+    parsec_prof_grapher_data_input(chunk->original, (parsec_task_t*)this_task, &flow_of_redistribute_check_Get_T_for_T, 0);
+#endif
+  }
+    this_task->data._f_T.data_in     = chunk;
+    this_task->data._f_T.source_repo       = consumed_repo;
+    this_task->data._f_T.source_repo_entry = consumed_entry;
+    if( this_task->data._f_T.source_repo_entry == this_task->repo_entry ){
+      /* in case we have consume from this task repo entry for the flow,
+       * it is cleaned up, avoiding having old stuff during release_deps_of
+       */
+      this_task->repo_entry->data[0] = NULL;
+    }
+    this_task->data._f_T.fulfill = 1;
+}
+
+  /* ctl is a control flow */
+  this_task->data._f_ctl.data_in         = NULL;
+  this_task->data._f_ctl.data_out        = NULL;
+  this_task->data._f_ctl.source_repo       = NULL;
+  this_task->data._f_ctl.source_repo_entry = NULL;
+  /** Generate profiling information */
+#if defined(PARSEC_PROF_TRACE)
+  this_task->prof_info.desc = (parsec_data_collection_t*)__parsec_tp->super._g_descY;
+  this_task->prof_info.priority = this_task->priority;
+  this_task->prof_info.data_id   = ((parsec_data_collection_t*)__parsec_tp->super._g_descY)->data_key((parsec_data_collection_t*)__parsec_tp->super._g_descY, 0, 0);
+  this_task->prof_info.task_class_id = this_task->task_class->task_class_id;
+  this_task->prof_info.task_return_code = -1;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int datatype_lookup_of_redistribute_check_Get_T(parsec_execution_stream_t *es, const parsec_task_t *this_generic_task, const parsec_task_t *parent_task,
+              uint32_t* flow_mask, parsec_dep_data_description_t* data)
+{
+  const __parsec_redistribute_check_Get_T_task_t *this_task = (__parsec_redistribute_check_Get_T_task_t*)this_generic_task;
+  const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_check_internal_taskpool_t *)this_task->taskpool;
+  (void)__parsec_tp; (void)es; (void)this_task; (void)data; (void)parent_task;
+  const int batch_col = this_task->locals.batch_col.value; (void)batch_col;
+  const int m_start = this_task->locals.m_start.value; (void)m_start;
+  const int m_end = this_task->locals.m_end.value; (void)m_end;
+  const int n_start = this_task->locals.n_start.value; (void)n_start;
+  const int n_end = this_task->locals.n_end.value; (void)n_end;
+  const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+  const int i_start = this_task->locals.i_start.value; (void)i_start;
+  const int i_end = this_task->locals.i_end.value; (void)i_end;
+  const int j_start = this_task->locals.j_start.value; (void)j_start;
+  const int j_end = this_task->locals.j_end.value; (void)j_end;
+  data->local.arena = data->remote.arena = NULL;
+  data->local.src_datatype  = data->local.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->local.src_count     = data->local.dst_count = 0;
+  data->local.src_displ     = data->local.dst_displ = 0;
+  data->data_future  = NULL;
+  if( (*flow_mask) & 0x80000000U ) { /* these are the input dependencies remote datatypes  */
+if( (*flow_mask) & 0x1U ) {  /* Flow T */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_redistribute_check_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_redistribute_check_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_redistribute_check_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+    goto no_mask_match;
+  }
+
+  /* these are the output dependencies remote datatypes */
+ no_mask_match:
+  data->data                             = NULL;
+  data->remote.src_datatype = data->remote.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->remote.src_count    = data->remote.dst_count = 0;
+  data->remote.src_displ    = data->remote.dst_displ = 0;
+  data->data_future  = NULL;
+  (*flow_mask) = 0;  /* nothing left */
+  (void)batch_col;  (void)m_start;  (void)m_end;  (void)n_start;  (void)n_end;  (void)m;  (void)n;  (void)i_start;  (void)i_end;  (void)j_start;  (void)j_end;
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+static int hook_of_redistribute_check_Get_T(parsec_execution_stream_t *es, __parsec_redistribute_check_Get_T_task_t *this_task)
+{
+  __parsec_redistribute_check_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_check_internal_taskpool_t *)this_task->taskpool;
+  (void)es; (void)__parsec_tp;
+  const int batch_col = this_task->locals.batch_col.value; (void)batch_col;
+  const int m_start = this_task->locals.m_start.value; (void)m_start;
+  const int m_end = this_task->locals.m_end.value; (void)m_end;
+  const int n_start = this_task->locals.n_start.value; (void)n_start;
+  const int n_end = this_task->locals.n_end.value; (void)n_end;
+  const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+  const int i_start = this_task->locals.i_start.value; (void)i_start;
+  const int i_end = this_task->locals.i_end.value; (void)i_end;
+  const int j_start = this_task->locals.j_start.value; (void)j_start;
+  const int j_end = this_task->locals.j_end.value; (void)j_end;
+  (void)batch_col;  (void)m_start;  (void)m_end;  (void)n_start;  (void)n_end;  (void)m;  (void)n;  (void)i_start;  (void)i_end;  (void)j_start;  (void)j_end;
+
+  /** Declare the variables that will hold the data, and all the accounting for each */
+  parsec_data_copy_t *_f_T = this_task->data._f_T.data_in;
+  void *T = PARSEC_DATA_COPY_GET_PTR(_f_T); (void)T;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    data_repo_entry_t *eT = this_task->data._f_T.source_repo_entry;
+    if( (NULL != eT) && (eT->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eT->sim_exec_date;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+  /** Cache Awareness Accounting */
+#if defined(PARSEC_CACHE_AWARENESS)
+  cache_buf_referenced(es->closest_cache, T);
+#endif /* PARSEC_CACHE_AWARENESS */
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                                  Get_T BODY                                  -----*/
+
+{
+    CORE_redistribute_dtd(T_g, T, descT->mb, descT->nb, m, n, m_start, m_end, n_start, n_end,
+                            i_start, i_end, j_start, j_end, size_row, size_row, size_col, R, 0, 0);
+}
+
+/*-----                              END OF Get_T BODY                                -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#endif  /*  defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+static int complete_hook_of_redistribute_check_Get_T(parsec_execution_stream_t *es, __parsec_redistribute_check_Get_T_task_t *this_task)
+{
+  const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_check_internal_taskpool_t *)this_task->taskpool;
+#if defined(DISTRIBUTED)
+    const int batch_col = this_task->locals.batch_col.value; (void)batch_col;
+  const int m_start = this_task->locals.m_start.value; (void)m_start;
+  const int m_end = this_task->locals.m_end.value; (void)m_end;
+  const int n_start = this_task->locals.n_start.value; (void)n_start;
+  const int n_end = this_task->locals.n_end.value; (void)n_end;
+  const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+  const int i_start = this_task->locals.i_start.value; (void)i_start;
+  const int i_end = this_task->locals.i_end.value; (void)i_end;
+  const int j_start = this_task->locals.j_start.value; (void)j_start;
+  const int j_end = this_task->locals.j_end.value; (void)j_end;
+#endif  /* defined(DISTRIBUTED) */
+  (void)es; (void)__parsec_tp;
+parsec_data_t* data_t_desc = NULL; (void)data_t_desc;
+#if defined(DISTRIBUTED)
+  /** If not working on distributed, there is no risk that data is not in place */
+  (void)batch_col;  (void)m_start;  (void)m_end;  (void)n_start;  (void)n_end;  (void)m;  (void)n;  (void)i_start;  (void)i_end;  (void)j_start;  (void)j_end;
+
+#endif /* DISTRIBUTED */
+#if defined(PARSEC_PROF_GRAPHER)
+  parsec_prof_grapher_task((parsec_task_t*)this_task, es->th_id, es->virtual_process->vp_id,
+     __jdf2c_key_fns_Get_T.key_hash(this_task->task_class->make_key( (parsec_taskpool_t*)this_task->taskpool, ((parsec_task_t*)this_task)->locals), NULL));
+#endif  /* defined(PARSEC_PROF_GRAPHER) */
+  release_deps_of_redistribute_check_Get_T(es, this_task,
+      PARSEC_ACTION_RELEASE_REMOTE_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_REFS |
+      PARSEC_ACTION_RESHAPE_ON_RELEASE |
+      0x1,  /* mask of all dep_index */ 
+      NULL);
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static parsec_hook_return_t release_task_of_redistribute_check_Get_T(parsec_execution_stream_t *es, parsec_task_t *this_task)
+{
+    const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp =
+        (const __parsec_redistribute_check_internal_taskpool_t *)this_task->taskpool;
+    parsec_hash_table_t *ht = (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[3];
+    parsec_key_t key = this_task->task_class->make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals);
+    parsec_hashable_dependency_t *hash_dep = (parsec_hashable_dependency_t *)parsec_hash_table_remove(ht, key);
+    parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);
+    return parsec_release_task_to_mempool_update_nbtasks(es, this_task);
+}
+
+static char *redistribute_check_redistribute_check_Get_T_internal_init_deps_key_functions_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_redistribute_check_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_check_internal_taskpool_t *)user_data;
+  __parsec_redistribute_check_Get_T_parsec_assignment_t __jdf2c__assignments = {  .batch_col.value = 0, .m_start.value = 0, .m_end.value = 0, .n_start.value = 0, .n_end.value = 0, .m.value = 0, .n.value = 0, .i_start.value = 0, .i_end.value = 0, .j_start.value = 0, .j_end.value = 0 };
+  int batch_col = (__parsec_key) % __parsec_tp->Get_T_batch_col_range + __parsec_tp->Get_T_batch_col_min;
+  __parsec_key = __parsec_key / __parsec_tp->Get_T_batch_col_range;
+  __jdf2c__assignments.batch_col.value = batch_col;
+  int m_start = (disi_T / (descT->mb - (2 * R)));
+  (void)m_start;
+  __jdf2c__assignments.m_start.value = m_start;
+  int m_end = (((disi_T + size_row) - 1) / (descT->mb - (2 * R)));
+  (void)m_end;
+  __jdf2c__assignments.m_end.value = m_end;
+  int n_start = (disj_T / (descT->nb - (2 * R)));
+  (void)n_start;
+  __jdf2c__assignments.n_start.value = n_start;
+  int n_end = (((disj_T + size_col) - 1) / (descT->nb - (2 * R)));
+  (void)n_end;
+  __jdf2c__assignments.n_end.value = n_end;
+  int m = (__parsec_key) % __parsec_tp->Get_T_m_range + __parsec_tp->Get_T_m_min;
+  __parsec_key = __parsec_key / __parsec_tp->Get_T_m_range;
+  __jdf2c__assignments.m.value = m;
+  int n = (__parsec_key) % __parsec_tp->Get_T_n_range + __parsec_tp->Get_T_n_min;
+  __parsec_key = __parsec_key / __parsec_tp->Get_T_n_range;
+  __jdf2c__assignments.n.value = n;
+  int i_start = (disi_T % (descT->mb - (2 * R)));
+  (void)i_start;
+  __jdf2c__assignments.i_start.value = i_start;
+  int i_end = (((disi_T + size_row) - 1) % (descT->mb - (2 * R)));
+  (void)i_end;
+  __jdf2c__assignments.i_end.value = i_end;
+  int j_start = (disj_T % (descT->nb - (2 * R)));
+  (void)j_start;
+  __jdf2c__assignments.j_start.value = j_start;
+  int j_end = (((disj_T + size_col) - 1) % (descT->nb - (2 * R)));
+  (void)j_end;
+  __jdf2c__assignments.j_end.value = j_end;
+  (void)__jdf2c__assignments;
+  snprintf(buffer, buffer_size, "Get_T(%d, %d, %d)", batch_col, m, n);
+  return buffer;
+}
+
+static parsec_key_fn_t redistribute_check_redistribute_check_Get_T_internal_init_deps_key_functions = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = redistribute_check_redistribute_check_Get_T_internal_init_deps_key_functions_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/* Needs: min-max count-tasks iterate */
+static int redistribute_check_Get_T_internal_init(parsec_execution_stream_t * es, __parsec_redistribute_check_Get_T_task_t * this_task)
+{
+  __parsec_redistribute_check_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_check_internal_taskpool_t*)this_task->taskpool;
+  int32_t nb_tasks = 0, saved_nb_tasks = 0;
+int32_t __batch_col_min = 0x7fffffff, __batch_col_max = 0;int32_t __jdf2c_batch_col_min = 0x7fffffff, __jdf2c_batch_col_max = 0;int32_t __m_min = 0x7fffffff, __m_max = 0;int32_t __jdf2c_m_min = 0x7fffffff, __jdf2c_m_max = 0;int32_t __n_min = 0x7fffffff, __n_max = 0;int32_t __jdf2c_n_min = 0x7fffffff, __jdf2c_n_max = 0;  __parsec_redistribute_check_Get_T_parsec_assignment_t assignments = {  .batch_col.value = 0, .m_start.value = 0, .m_end.value = 0, .n_start.value = 0, .n_end.value = 0, .m.value = 0, .n.value = 0, .i_start.value = 0, .i_end.value = 0, .j_start.value = 0, .j_end.value = 0 };
+  int32_t  batch_col,  m_start,  m_end,  n_start,  n_end,  m,  n,  i_start,  i_end,  j_start,  j_end;
+  int32_t __jdf2c_batch_col_start, __jdf2c_batch_col_end, __jdf2c_batch_col_inc;
+  int32_t __jdf2c_m_start, __jdf2c_m_end, __jdf2c_m_inc;
+  int32_t __jdf2c_n_start, __jdf2c_n_end, __jdf2c_n_inc;
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+  PARSEC_PROFILING_TRACE(es->es_profile,
+                         this_task->taskpool->profiling_array[START_KEY(this_task->task_class->task_class_id)],
+                         0,
+                         this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    __jdf2c_batch_col_start = 0;
+    __jdf2c_batch_col_end = (NT - 1);
+    __jdf2c_batch_col_inc = 1;
+    __batch_col_min = parsec_imin(__jdf2c_batch_col_start, __jdf2c_batch_col_end);
+    __batch_col_max = parsec_imax(__jdf2c_batch_col_start, __jdf2c_batch_col_end);
+    __jdf2c_batch_col_min = parsec_imin(__jdf2c_batch_col_min, __batch_col_min);
+    __jdf2c_batch_col_max = parsec_imax(__jdf2c_batch_col_max, __batch_col_max);
+    for(batch_col =  __jdf2c_batch_col_start;
+        batch_col <= __jdf2c_batch_col_end;
+        batch_col += __jdf2c_batch_col_inc) {
+    assignments.batch_col.value = batch_col;
+  {  /* block for the non-range variable m_start */
+      m_start = (disi_T / (descT->mb - (2 * R)));
+      assignments.m_start.value = m_start;
+    {  /* block for the non-range variable m_end */
+        m_end = (((disi_T + size_row) - 1) / (descT->mb - (2 * R)));
+        assignments.m_end.value = m_end;
+      {  /* block for the non-range variable n_start */
+          n_start = (disj_T / (descT->nb - (2 * R)));
+          assignments.n_start.value = n_start;
+        {  /* block for the non-range variable n_end */
+            n_end = (((disj_T + size_col) - 1) / (descT->nb - (2 * R)));
+            assignments.n_end.value = n_end;
+              __jdf2c_m_start = m_start;
+              __jdf2c_m_end = m_end;
+              __jdf2c_m_inc = 1;
+              __m_min = parsec_imin(__jdf2c_m_start, __jdf2c_m_end);
+              __m_max = parsec_imax(__jdf2c_m_start, __jdf2c_m_end);
+              __jdf2c_m_min = parsec_imin(__jdf2c_m_min, __m_min);
+              __jdf2c_m_max = parsec_imax(__jdf2c_m_max, __m_max);
+              for(m =  __jdf2c_m_start;
+                  m <= __jdf2c_m_end;
+                  m += __jdf2c_m_inc) {
+              assignments.m.value = m;
+                __jdf2c_n_start = redistribute_check_Get_T_inline_c_expr2_line_144(__parsec_tp, &assignments);
+                __jdf2c_n_end = redistribute_check_Get_T_inline_c_expr1_line_144(__parsec_tp, &assignments);
+                __jdf2c_n_inc = 1;
+                __n_min = parsec_imin(__jdf2c_n_start, __jdf2c_n_end);
+                __n_max = parsec_imax(__jdf2c_n_start, __jdf2c_n_end);
+                __jdf2c_n_min = parsec_imin(__jdf2c_n_min, __n_min);
+                __jdf2c_n_max = parsec_imax(__jdf2c_n_max, __n_max);
+                for(n =  __jdf2c_n_start;
+                    n <= __jdf2c_n_end;
+                    n += __jdf2c_n_inc) {
+                assignments.n.value = n;
+              {  /* block for the non-range variable i_start */
+                  i_start = (disi_T % (descT->mb - (2 * R)));
+                  assignments.i_start.value = i_start;
+                {  /* block for the non-range variable i_end */
+                    i_end = (((disi_T + size_row) - 1) % (descT->mb - (2 * R)));
+                    assignments.i_end.value = i_end;
+                  {  /* block for the non-range variable j_start */
+                      j_start = (disj_T % (descT->nb - (2 * R)));
+                      assignments.j_start.value = j_start;
+                    {  /* block for the non-range variable j_end */
+                        j_end = (((disj_T + size_col) - 1) % (descT->nb - (2 * R)));
+                        assignments.j_end.value = j_end;
+                        if( !Get_T_pred(batch_col, m_start, m_end, n_start, n_end, m, n, i_start, i_end, j_start, j_end) ) continue;
+                        nb_tasks++;
+                      } /* block for the non-range variable j_end */ 
+                    } /* block for the non-range variable j_start */ 
+                  } /* block for the non-range variable i_end */ 
+                } /* block for the non-range variable i_start */ 
+              } /* Loop on normal range n */
+            } /* For loop of m */ 
+          } /* Non-range variable n_end */ 
+        } /* Non-range variable n_start */ 
+      } /* Non-range variable m_end */ 
+    } /* Non-range variable m_start */ 
+  } /* For loop of batch_col */ 
+   if( 0 != nb_tasks ) {
+     (void)parsec_atomic_fetch_add_int32(&__parsec_tp->initial_number_tasks, nb_tasks);
+   }
+  /* Set the range variables for the collision-free hash-computation */
+  __parsec_tp->Get_T_batch_col_min   = __jdf2c_batch_col_min;
+  __parsec_tp->Get_T_batch_col_range = (__jdf2c_batch_col_max - __jdf2c_batch_col_min) + 1;
+  __parsec_tp->Get_T_m_min   = __jdf2c_m_min;
+  __parsec_tp->Get_T_m_range = (__jdf2c_m_max - __jdf2c_m_min) + 1;
+  __parsec_tp->Get_T_n_min   = __jdf2c_n_min;
+  __parsec_tp->Get_T_n_range = (__jdf2c_n_max - __jdf2c_n_min) + 1;
+  this_task->status = PARSEC_TASK_STATUS_COMPLETE;
+
+  PARSEC_AYU_REGISTER_TASK(&redistribute_check_Get_T);
+  __parsec_tp->super.super.dependencies_array[3] = PARSEC_OBJ_NEW(parsec_hash_table_t);
+  parsec_hash_table_init(__parsec_tp->super.super.dependencies_array[3], offsetof(parsec_hashable_dependency_t, ht_item), 10, redistribute_check_redistribute_check_Get_T_internal_init_deps_key_functions, this_task->taskpool);
+  __parsec_tp->repositories[3] = data_repo_create_nothreadsafe(nb_tasks, __jdf2c_key_fns_Get_T, (parsec_taskpool_t*)__parsec_tp, 2);
+(void)saved_nb_tasks;
+(void)__batch_col_min; (void)__batch_col_max;(void)__m_min; (void)__m_max;(void)__n_min; (void)__n_max;  (void)__jdf2c_batch_col_start; (void)__jdf2c_batch_col_end; (void)__jdf2c_batch_col_inc;  (void)__jdf2c_m_start; (void)__jdf2c_m_end; (void)__jdf2c_m_inc;  (void)__jdf2c_n_start; (void)__jdf2c_n_end; (void)__jdf2c_n_inc;  (void)assignments; (void)__parsec_tp; (void)es;
+  if(1 == parsec_atomic_fetch_dec_int32(&__parsec_tp->sync_point)) {
+    /* Last initialization task complete. Update the number of tasks. */
+    __parsec_tp->super.super.tdm.module->taskpool_addto_nb_tasks(&__parsec_tp->super.super, __parsec_tp->initial_number_tasks);
+    parsec_mfence();  /* write memory barrier to guarantee that the scheduler gets the correct number of tasks */
+    parsec_taskpool_enable((parsec_taskpool_t*)__parsec_tp, &__parsec_tp->startup_queue,
+                           (parsec_task_t*)this_task, es, __parsec_tp->super.super.nb_pending_actions);
+    __parsec_tp->super.super.tdm.module->taskpool_ready(&__parsec_tp->super.super);
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+    PARSEC_PROFILING_TRACE(es->es_profile,
+                           this_task->taskpool->profiling_array[2 * this_task->task_class->task_class_id + 1],
+                           0,
+                           this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    return PARSEC_HOOK_RETURN_DONE;
+  }
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static const __parsec_chore_t __redistribute_check_Get_T_chores[] ={
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+    { .type     = PARSEC_DEV_CPU,
+      .evaluate = (parsec_evaluate_function_t*)NULL,
+      .hook     = (parsec_hook_t*)hook_of_redistribute_check_Get_T },
+#endif  /* defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+    { .type     = PARSEC_DEV_NONE,
+      .evaluate = NULL,
+      .hook     = (parsec_hook_t*)NULL },  /* End marker */
+};
+
+static const parsec_task_class_t redistribute_check_Get_T = {
+  .name = "Get_T",
+  .task_class_id = 3,
+  .nb_flows = 2,
+  .nb_parameters = 3,
+  .nb_locals = 11,
+  .task_class_type = PARSEC_TASK_CLASS_TYPE_PTG,
+  .params = { &symb_redistribute_check_Get_T_m, &symb_redistribute_check_Get_T_n, &symb_redistribute_check_Get_T_batch_col, NULL },
+  .locals = { &symb_redistribute_check_Get_T_batch_col, &symb_redistribute_check_Get_T_m_start, &symb_redistribute_check_Get_T_m_end, &symb_redistribute_check_Get_T_n_start, &symb_redistribute_check_Get_T_n_end, &symb_redistribute_check_Get_T_m, &symb_redistribute_check_Get_T_n, &symb_redistribute_check_Get_T_i_start, &symb_redistribute_check_Get_T_i_end, &symb_redistribute_check_Get_T_j_start, &symb_redistribute_check_Get_T_j_end, NULL },
+  .data_affinity = (parsec_data_ref_fn_t*)affinity_of_redistribute_check_Get_T,
+  .initial_data = (parsec_data_ref_fn_t*)affinity_of_redistribute_check_Get_T,
+  .final_data = (parsec_data_ref_fn_t*)affinity_of_redistribute_check_Get_T,
+  .priority = NULL,
+  .properties = properties_of_redistribute_check_Get_T,
+#if MAX_PARAM_COUNT < 1  /* number of read flows of Get_T */
+  #error Too many read flows for task Get_T
+#endif  /* MAX_PARAM_COUNT */
+#if MAX_PARAM_COUNT < 0  /* number of write flows of Get_T */
+  #error Too many write flows for task Get_T
+#endif  /* MAX_PARAM_COUNT */
+  .in = { &flow_of_redistribute_check_Get_T_for_T, NULL },
+  .out = { &flow_of_redistribute_check_Get_T_for_ctl, NULL },
+  .flags = 0x0 | PARSEC_USE_DEPS_MASK,
+  .dependencies_goal = 0x1,
+  .make_key = __jdf2c_make_key_Get_T,
+  .task_snprintf = parsec_task_snprintf,
+#if defined(PARSEC_PROF_TRACE)
+  .profile_info = &parsec_task_profile_info,
+#endif
+  .key_functions = &__jdf2c_key_fns_Get_T,
+  .fini = (parsec_hook_t*)NULL,
+  .incarnations = __redistribute_check_Get_T_chores,
+  .find_deps = parsec_hash_find_deps,
+  .update_deps = parsec_update_deps_with_mask,
+  .iterate_successors = (parsec_traverse_function_t*)iterate_successors_of_redistribute_check_Get_T,
+  .iterate_predecessors = (parsec_traverse_function_t*)iterate_predecessors_of_redistribute_check_Get_T,
+  .release_deps = (parsec_release_deps_t*)release_deps_of_redistribute_check_Get_T,
+  .prepare_output = (parsec_hook_t*)NULL,
+  .prepare_input = (parsec_hook_t*)data_lookup_of_redistribute_check_Get_T,
+  .time_estimate = NULL,
+  .get_datatype = datatype_lookup_of_redistribute_check_Get_T,
+  .complete_execution = (parsec_hook_t*)complete_hook_of_redistribute_check_Get_T,
+  .release_task = &release_task_of_redistribute_check_Get_T,
+#if defined(PARSEC_SIM)
+  .sim_cost_fct = (parsec_sim_cost_fct_t*)NULL,
+#endif
+};
+
+
+/******                                    Send_T                                    ******/
+
+static inline int32_t minexpr_of_symb_redistribute_check_Send_T_batch_col_fct(const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_check_Send_T_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_redistribute_check_Send_T_batch_col = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_redistribute_check_Send_T_batch_col_fct }
+                   }
+};
+static inline int maxexpr_of_symb_redistribute_check_Send_T_batch_col_fct(const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_check_Send_T_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_start = locals->m_start.value; (void)m_start;
+  const int m_end = locals->m_end.value; (void)m_end;
+  const int n_start = locals->n_start.value; (void)n_start;
+  const int n_end = locals->n_end.value; (void)n_end;
+  const int m = locals->m.value; (void)m;
+  const int n = locals->n.value; (void)n;
+
+  (void)batch_col;
+  (void)m_start;
+  (void)m_end;
+  (void)n_start;
+  (void)n_end;
+  (void)m;
+  (void)n;
+  (void)__parsec_tp; (void)locals;
+  return (NT - 1);
+}
+static const parsec_expr_t maxexpr_of_symb_redistribute_check_Send_T_batch_col = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_redistribute_check_Send_T_batch_col_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_check_Send_T_batch_col = { .name = "batch_col", .context_index = 0, .min = &minexpr_of_symb_redistribute_check_Send_T_batch_col, .max = &maxexpr_of_symb_redistribute_check_Send_T_batch_col, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int expr_of_symb_redistribute_check_Send_T_m_start_fct(const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_check_Send_T_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_start = locals->m_start.value; (void)m_start;
+  const int m_end = locals->m_end.value; (void)m_end;
+  const int n_start = locals->n_start.value; (void)n_start;
+  const int n_end = locals->n_end.value; (void)n_end;
+  const int m = locals->m.value; (void)m;
+  const int n = locals->n.value; (void)n;
+
+  (void)batch_col;
+  (void)m_start;
+  (void)m_end;
+  (void)n_start;
+  (void)n_end;
+  (void)m;
+  (void)n;
+  (void)__parsec_tp; (void)locals;
+  return (disi_T / (descT->mb - (2 * R)));
+}
+static const parsec_expr_t expr_of_symb_redistribute_check_Send_T_m_start = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_check_Send_T_m_start_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_check_Send_T_m_start = { .name = "m_start", .context_index = 1, .min = &expr_of_symb_redistribute_check_Send_T_m_start, .max = &expr_of_symb_redistribute_check_Send_T_m_start, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int expr_of_symb_redistribute_check_Send_T_m_end_fct(const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_check_Send_T_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_start = locals->m_start.value; (void)m_start;
+  const int m_end = locals->m_end.value; (void)m_end;
+  const int n_start = locals->n_start.value; (void)n_start;
+  const int n_end = locals->n_end.value; (void)n_end;
+  const int m = locals->m.value; (void)m;
+  const int n = locals->n.value; (void)n;
+
+  (void)batch_col;
+  (void)m_start;
+  (void)m_end;
+  (void)n_start;
+  (void)n_end;
+  (void)m;
+  (void)n;
+  (void)__parsec_tp; (void)locals;
+  return (((disi_T + size_row) - 1) / (descT->mb - (2 * R)));
+}
+static const parsec_expr_t expr_of_symb_redistribute_check_Send_T_m_end = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_check_Send_T_m_end_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_check_Send_T_m_end = { .name = "m_end", .context_index = 2, .min = &expr_of_symb_redistribute_check_Send_T_m_end, .max = &expr_of_symb_redistribute_check_Send_T_m_end, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int expr_of_symb_redistribute_check_Send_T_n_start_fct(const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_check_Send_T_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_start = locals->m_start.value; (void)m_start;
+  const int m_end = locals->m_end.value; (void)m_end;
+  const int n_start = locals->n_start.value; (void)n_start;
+  const int n_end = locals->n_end.value; (void)n_end;
+  const int m = locals->m.value; (void)m;
+  const int n = locals->n.value; (void)n;
+
+  (void)batch_col;
+  (void)m_start;
+  (void)m_end;
+  (void)n_start;
+  (void)n_end;
+  (void)m;
+  (void)n;
+  (void)__parsec_tp; (void)locals;
+  return (disj_T / (descT->nb - (2 * R)));
+}
+static const parsec_expr_t expr_of_symb_redistribute_check_Send_T_n_start = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_check_Send_T_n_start_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_check_Send_T_n_start = { .name = "n_start", .context_index = 3, .min = &expr_of_symb_redistribute_check_Send_T_n_start, .max = &expr_of_symb_redistribute_check_Send_T_n_start, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int expr_of_symb_redistribute_check_Send_T_n_end_fct(const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_check_Send_T_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_start = locals->m_start.value; (void)m_start;
+  const int m_end = locals->m_end.value; (void)m_end;
+  const int n_start = locals->n_start.value; (void)n_start;
+  const int n_end = locals->n_end.value; (void)n_end;
+  const int m = locals->m.value; (void)m;
+  const int n = locals->n.value; (void)n;
+
+  (void)batch_col;
+  (void)m_start;
+  (void)m_end;
+  (void)n_start;
+  (void)n_end;
+  (void)m;
+  (void)n;
+  (void)__parsec_tp; (void)locals;
+  return (((disj_T + size_col) - 1) / (descT->nb - (2 * R)));
+}
+static const parsec_expr_t expr_of_symb_redistribute_check_Send_T_n_end = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_check_Send_T_n_end_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_check_Send_T_n_end = { .name = "n_end", .context_index = 4, .min = &expr_of_symb_redistribute_check_Send_T_n_end, .max = &expr_of_symb_redistribute_check_Send_T_n_end, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int minexpr_of_symb_redistribute_check_Send_T_m_fct(const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_check_Send_T_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_start = locals->m_start.value;
+  const int m_end = locals->m_end.value; (void)m_end;
+  const int n_start = locals->n_start.value; (void)n_start;
+  const int n_end = locals->n_end.value; (void)n_end;
+  const int m = locals->m.value; (void)m;
+  const int n = locals->n.value; (void)n;
+
+  (void)batch_col;
+  (void)m_start;
+  (void)m_end;
+  (void)n_start;
+  (void)n_end;
+  (void)m;
+  (void)n;
+  (void)__parsec_tp; (void)locals;
+  return m_start;
+}
+static const parsec_expr_t minexpr_of_symb_redistribute_check_Send_T_m = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_redistribute_check_Send_T_m_fct }
+                   }
+};
+static inline int maxexpr_of_symb_redistribute_check_Send_T_m_fct(const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_check_Send_T_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_start = locals->m_start.value; (void)m_start;
+  const int m_end = locals->m_end.value;
+  const int n_start = locals->n_start.value; (void)n_start;
+  const int n_end = locals->n_end.value; (void)n_end;
+  const int m = locals->m.value; (void)m;
+  const int n = locals->n.value; (void)n;
+
+  (void)batch_col;
+  (void)m_start;
+  (void)m_end;
+  (void)n_start;
+  (void)n_end;
+  (void)m;
+  (void)n;
+  (void)__parsec_tp; (void)locals;
+  return m_end;
+}
+static const parsec_expr_t maxexpr_of_symb_redistribute_check_Send_T_m = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_redistribute_check_Send_T_m_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_check_Send_T_m = { .name = "m", .context_index = 5, .min = &minexpr_of_symb_redistribute_check_Send_T_m, .max = &maxexpr_of_symb_redistribute_check_Send_T_m, .cst_inc = 1, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t minexpr_of_symb_redistribute_check_Send_T_n_fct(const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_check_Send_T_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_check_Send_T_inline_c_expr4_line_116(__parsec_tp, locals);
+}
+static const parsec_expr_t minexpr_of_symb_redistribute_check_Send_T_n = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_redistribute_check_Send_T_n_fct }
+                   }
+};
+static inline int32_t maxexpr_of_symb_redistribute_check_Send_T_n_fct(const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_check_Send_T_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_check_Send_T_inline_c_expr3_line_116(__parsec_tp, locals);
+}
+static const parsec_expr_t maxexpr_of_symb_redistribute_check_Send_T_n = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_redistribute_check_Send_T_n_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_check_Send_T_n = { .name = "n", .context_index = 6, .min = &minexpr_of_symb_redistribute_check_Send_T_n, .max = &maxexpr_of_symb_redistribute_check_Send_T_n, .cst_inc = 1, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int affinity_of_redistribute_check_Send_T(const __parsec_redistribute_check_Send_T_task_t *this_task,
+                     parsec_data_ref_t *ref)
+{
+    const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp = (const __parsec_redistribute_check_internal_taskpool_t*)this_task->taskpool;
+  const int batch_col = this_task->locals.batch_col.value; (void)batch_col;
+  const int m_start = this_task->locals.m_start.value; (void)m_start;
+  const int m_end = this_task->locals.m_end.value; (void)m_end;
+  const int n_start = this_task->locals.n_start.value; (void)n_start;
+  const int n_end = this_task->locals.n_end.value; (void)n_end;
+  const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+
+  /* Silent Warnings: should look into predicate to know what variables are usefull */
+  (void)batch_col;
+  (void)m_start;
+  (void)m_end;
+  (void)n_start;
+  (void)n_end;
+  (void)m;
+  (void)n;
+  ref->dc = (parsec_data_collection_t *)__parsec_tp->super._g_descT;
+  /* Compute data key */
+  ref->key = ref->dc->data_key(ref->dc, m, n);
+  return 1;
+}
+static const parsec_property_t properties_of_redistribute_check_Send_T[1] = {
+  {.name = NULL, .expr = NULL}
+};
+static parsec_data_t *flow_of_redistribute_check_Send_T_for_T_dep1_atline_120_direct_access(const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_check_Send_T_parsec_assignment_t *assignments)
+{
+  const int batch_col = assignments->batch_col.value; (void)batch_col;
+  const int m_start = assignments->m_start.value; (void)m_start;
+  const int m_end = assignments->m_end.value; (void)m_end;
+  const int n_start = assignments->n_start.value; (void)n_start;
+  const int n_end = assignments->n_end.value; (void)n_end;
+  const int m = assignments->m.value; (void)m;
+  const int n = assignments->n.value; (void)n;
+
+  /* Silence Warnings: should look into parameters to know what variables are useful */
+  (void)batch_col;
+  (void)m_start;
+  (void)m_end;
+  (void)n_start;
+  (void)n_end;
+  (void)m;
+  (void)n;
+  if( __parsec_tp->super.super.context->my_rank == (int32_t)rank_of_descT(m, n) )
+    return data_of_descT(m, n);
+  return NULL;
+}
+
+static const parsec_dep_t flow_of_redistribute_check_Send_T_for_T_dep1_atline_120 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = PARSEC_LOCAL_DATA_TASK_CLASS_ID, /* redistribute_check_descT */
+  .direct_data = (parsec_data_lookup_func_t)&flow_of_redistribute_check_Send_T_for_T_dep1_atline_120_direct_access,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_redistribute_check_Send_T_for_T,
+};
+static const parsec_dep_t flow_of_redistribute_check_Send_T_for_T_dep2_atline_121 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 3, /* redistribute_check_Get_T */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_redistribute_check_Get_T_for_T,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_redistribute_check_Send_T_for_T,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+#if MAX_DEP_OUT_COUNT < 1  /* number of output dependencies */
+    #error Too many output dependencies (supports up to MAX_DEP_OUT_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_OUT_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_redistribute_check_Send_T_for_T = {
+  .name               = "T",
+  .sym_type           = PARSEC_SYM_INOUT,
+  .flow_flags         = PARSEC_FLOW_ACCESS_READ|PARSEC_FLOW_HAS_IN_DEPS,
+  .flow_index         = 0,
+  .flow_datatype_mask = 0x1,
+  .dep_in     = { &flow_of_redistribute_check_Send_T_for_T_dep1_atline_120 },
+  .dep_out    = { &flow_of_redistribute_check_Send_T_for_T_dep2_atline_121 }
+};
+
+static inline int expr_of_cond_for_flow_of_redistribute_check_Send_T_for_ctl_dep1_atline_123_fct(const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_check_Send_T_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value;
+  const int m_start = locals->m_start.value; (void)m_start;
+  const int m_end = locals->m_end.value; (void)m_end;
+  const int n_start = locals->n_start.value; (void)n_start;
+  const int n_end = locals->n_end.value; (void)n_end;
+  const int m = locals->m.value; (void)m;
+  const int n = locals->n.value; (void)n;
+
+  (void)batch_col;
+  (void)m_start;
+  (void)m_end;
+  (void)n_start;
+  (void)n_end;
+  (void)m;
+  (void)n;
+  (void)__parsec_tp; (void)locals;
+  return (batch_col) > (0);
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_redistribute_check_Send_T_for_ctl_dep1_atline_123 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_redistribute_check_Send_T_for_ctl_dep1_atline_123_fct }
+                   }
+};
+static const parsec_dep_t flow_of_redistribute_check_Send_T_for_ctl_dep1_atline_123 = {
+  .cond = &expr_of_cond_for_flow_of_redistribute_check_Send_T_for_ctl_dep1_atline_123,  /* (batch_col) > (0) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 3, /* redistribute_check_Get_T */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_redistribute_check_Get_T_for_ctl,
+  .dep_index = 1,
+  .dep_datatype_index = 1,
+  .belongs_to = &flow_of_redistribute_check_Send_T_for_ctl,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_redistribute_check_Send_T_for_ctl = {
+  .name               = "ctl",
+  .sym_type           = PARSEC_SYM_IN,
+  .flow_flags         = PARSEC_FLOW_ACCESS_NONE|PARSEC_FLOW_HAS_IN_DEPS,
+  .flow_index         = 1,
+  .flow_datatype_mask = 0x0,
+  .dep_in     = { &flow_of_redistribute_check_Send_T_for_ctl_dep1_atline_123 },
+  .dep_out    = { NULL }
+};
+
+static void
+iterate_successors_of_redistribute_check_Send_T(parsec_execution_stream_t *es, const __parsec_redistribute_check_Send_T_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp = (const __parsec_redistribute_check_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_redistribute_check_Send_T_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_redistribute_check_Send_T_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int batch_col = __jdf2c__tmp_locals.batch_col.value; (void)batch_col;
+  const int m_start = __jdf2c__tmp_locals.m_start.value; (void)m_start;
+  const int m_end = __jdf2c__tmp_locals.m_end.value; (void)m_end;
+  const int n_start = __jdf2c__tmp_locals.n_start.value; (void)n_start;
+  const int n_end = __jdf2c__tmp_locals.n_end.value; (void)n_end;
+  const int m = __jdf2c__tmp_locals.m.value; (void)m;
+  const int n = __jdf2c__tmp_locals.n.value; (void)n;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)batch_col;  (void)m_start;  (void)m_end;  (void)n_start;  (void)n_end;  (void)m;  (void)n;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_descT(m, n);
+#endif
+  if( action_mask & 0x1 ) {  /* Flow of data T [0] */
+    data.data   = this_task->data._f_T.data_out;
+    data.data_future  = NULL;
+    if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_redistribute_check_TARGET_ADT->arena;
+    data.local.src_datatype = PARSEC_redistribute_check_TARGET_ADT->opaque_dtt;
+    data.local.dst_datatype = PARSEC_redistribute_check_TARGET_ADT->opaque_dtt;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_redistribute_check_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+       __parsec_redistribute_check_Get_T_task_t* ncc = (__parsec_redistribute_check_Get_T_task_t*)&nc;
+    nc.task_class = __parsec_tp->super.super.task_classes_array[redistribute_check_Get_T.task_class_id];
+      const int Get_T_batch_col = batch_col;
+      if( (Get_T_batch_col >= (0)) && (Get_T_batch_col <= ((NT - 1))) ) {
+        assert(&nc.locals[0].value == &ncc->locals.batch_col.value);
+        ncc->locals.batch_col.value = Get_T_batch_col;
+        const int Get_T_m_start = (disi_T / (descT->mb - (2 * R)));
+        assert(&nc.locals[1].value == &ncc->locals.m_start.value);
+        ncc->locals.m_start.value = Get_T_m_start;
+        const int Get_T_m_end = (((disi_T + size_row) - 1) / (descT->mb - (2 * R)));
+        assert(&nc.locals[2].value == &ncc->locals.m_end.value);
+        ncc->locals.m_end.value = Get_T_m_end;
+        const int Get_T_n_start = (disj_T / (descT->nb - (2 * R)));
+        assert(&nc.locals[3].value == &ncc->locals.n_start.value);
+        ncc->locals.n_start.value = Get_T_n_start;
+        const int Get_T_n_end = (((disj_T + size_col) - 1) / (descT->nb - (2 * R)));
+        assert(&nc.locals[4].value == &ncc->locals.n_end.value);
+        ncc->locals.n_end.value = Get_T_n_end;
+        const int Get_T_m = m;
+        if( (Get_T_m >= (ncc->locals.m_start.value)) && (Get_T_m <= (ncc->locals.m_end.value)) ) {
+          assert(&nc.locals[5].value == &ncc->locals.m.value);
+          ncc->locals.m.value = Get_T_m;
+          const int Get_T_n = n;
+          if( (Get_T_n >= (redistribute_check_Get_T_inline_c_expr2_line_144(__parsec_tp, &ncc->locals))) && (Get_T_n <= (redistribute_check_Get_T_inline_c_expr1_line_144(__parsec_tp, &ncc->locals))) ) {
+            assert(&nc.locals[6].value == &ncc->locals.n.value);
+            ncc->locals.n.value = Get_T_n;
+            const int Get_T_i_start = (disi_T % (descT->mb - (2 * R)));
+            assert(&nc.locals[7].value == &ncc->locals.i_start.value);
+            ncc->locals.i_start.value = Get_T_i_start;
+            const int Get_T_i_end = (((disi_T + size_row) - 1) % (descT->mb - (2 * R)));
+            assert(&nc.locals[8].value == &ncc->locals.i_end.value);
+            ncc->locals.i_end.value = Get_T_i_end;
+            const int Get_T_j_start = (disj_T % (descT->nb - (2 * R)));
+            assert(&nc.locals[9].value == &ncc->locals.j_start.value);
+            ncc->locals.j_start.value = Get_T_j_start;
+            const int Get_T_j_end = (((disj_T + size_col) - 1) % (descT->nb - (2 * R)));
+            assert(&nc.locals[10].value == &ncc->locals.j_end.value);
+            ncc->locals.j_end.value = Get_T_j_end;
+#if defined(DISTRIBUTED)
+            rank_dst = rank_of_descY(0, 0);
+            if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+              vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descY)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descY, 0, 0);
+            nc.priority = __parsec_tp->super.super.priority;
+            successor_repo = Get_T_repo;
+            successor_repo_key = __jdf2c_make_key_Get_T((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+          RELEASE_DEP_OUTPUT(es, "T", this_task, "T", &nc, rank_src, rank_dst, &data);
+          if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_redistribute_check_Send_T_for_T_dep2_atline_121, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+            }
+          }
+        }
+  }
+  /* Flow of data ctl has only IN dependencies */
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static void
+iterate_predecessors_of_redistribute_check_Send_T(parsec_execution_stream_t *es, const __parsec_redistribute_check_Send_T_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp = (const __parsec_redistribute_check_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_redistribute_check_Send_T_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_redistribute_check_Send_T_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int batch_col = __jdf2c__tmp_locals.batch_col.value; (void)batch_col;
+  const int m_start = __jdf2c__tmp_locals.m_start.value; (void)m_start;
+  const int m_end = __jdf2c__tmp_locals.m_end.value; (void)m_end;
+  const int n_start = __jdf2c__tmp_locals.n_start.value; (void)n_start;
+  const int n_end = __jdf2c__tmp_locals.n_end.value; (void)n_end;
+  const int m = __jdf2c__tmp_locals.m.value; (void)m;
+  const int n = __jdf2c__tmp_locals.n.value; (void)n;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)batch_col;  (void)m_start;  (void)m_end;  (void)n_start;  (void)n_end;  (void)m;  (void)n;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_descT(m, n);
+#endif
+  /* Flow of data T has only OUTPUT dependencies to Memory */
+  if( action_mask & 0x2 ) {  /* Flow of data ctl [1] */
+    data.data   = this_task->data._f_ctl.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x2 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  =   /* Control: always empty */ 0;
+    data.local.dst_count  =   /* Control: always empty */ 0;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = NULL;
+    data.remote.src_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.src_count  =   /* Control: always empty */ 0;
+    data.remote.dst_count  =   /* Control: always empty */ 0;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( (batch_col) > (0) ) {
+      __parsec_redistribute_check_Get_T_task_t* ncc = (__parsec_redistribute_check_Get_T_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[redistribute_check_Get_T.task_class_id];
+        const int Get_T_batch_col = (batch_col - 1);
+        if( (Get_T_batch_col >= (0)) && (Get_T_batch_col <= ((NT - 1))) ) {
+          assert(&nc.locals[0].value == &ncc->locals.batch_col.value);
+          ncc->locals.batch_col.value = Get_T_batch_col;
+          const int Get_T_m_start = (disi_T / (descT->mb - (2 * R)));
+          assert(&nc.locals[1].value == &ncc->locals.m_start.value);
+          ncc->locals.m_start.value = Get_T_m_start;
+          const int Get_T_m_end = (((disi_T + size_row) - 1) / (descT->mb - (2 * R)));
+          assert(&nc.locals[2].value == &ncc->locals.m_end.value);
+          ncc->locals.m_end.value = Get_T_m_end;
+          const int Get_T_n_start = (disj_T / (descT->nb - (2 * R)));
+          assert(&nc.locals[3].value == &ncc->locals.n_start.value);
+          ncc->locals.n_start.value = Get_T_n_start;
+          const int Get_T_n_end = (((disj_T + size_col) - 1) / (descT->nb - (2 * R)));
+          assert(&nc.locals[4].value == &ncc->locals.n_end.value);
+          ncc->locals.n_end.value = Get_T_n_end;
+          const int Get_T_m = m;
+          if( (Get_T_m >= (ncc->locals.m_start.value)) && (Get_T_m <= (ncc->locals.m_end.value)) ) {
+            assert(&nc.locals[5].value == &ncc->locals.m.value);
+            ncc->locals.m.value = Get_T_m;
+            const int Get_T_n = (n - num_col_T);
+            if( (Get_T_n >= (redistribute_check_Get_T_inline_c_expr2_line_144(__parsec_tp, &ncc->locals))) && (Get_T_n <= (redistribute_check_Get_T_inline_c_expr1_line_144(__parsec_tp, &ncc->locals))) ) {
+              assert(&nc.locals[6].value == &ncc->locals.n.value);
+              ncc->locals.n.value = Get_T_n;
+              const int Get_T_i_start = (disi_T % (descT->mb - (2 * R)));
+              assert(&nc.locals[7].value == &ncc->locals.i_start.value);
+              ncc->locals.i_start.value = Get_T_i_start;
+              const int Get_T_i_end = (((disi_T + size_row) - 1) % (descT->mb - (2 * R)));
+              assert(&nc.locals[8].value == &ncc->locals.i_end.value);
+              ncc->locals.i_end.value = Get_T_i_end;
+              const int Get_T_j_start = (disj_T % (descT->nb - (2 * R)));
+              assert(&nc.locals[9].value == &ncc->locals.j_start.value);
+              ncc->locals.j_start.value = Get_T_j_start;
+              const int Get_T_j_end = (((disj_T + size_col) - 1) % (descT->nb - (2 * R)));
+              assert(&nc.locals[10].value == &ncc->locals.j_end.value);
+              ncc->locals.j_end.value = Get_T_j_end;
+#if defined(DISTRIBUTED)
+              rank_dst = rank_of_descY(0, 0);
+              if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+                vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descY)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descY, 0, 0);
+              nc.priority = __parsec_tp->super.super.priority;
+              successor_repo = Get_T_repo;
+              successor_repo_key = __jdf2c_make_key_Get_T((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+            RELEASE_DEP_OUTPUT(es, "ctl", this_task, "ctl", &nc, rank_src, rank_dst, &data);
+            if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_redistribute_check_Send_T_for_ctl_dep1_atline_123, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+              }
+            }
+          }
+    }
+  }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static int release_deps_of_redistribute_check_Send_T(parsec_execution_stream_t *es, __parsec_redistribute_check_Send_T_task_t *this_task, uint32_t action_mask, parsec_remote_deps_t *deps)
+{
+  PARSEC_PINS(es, RELEASE_DEPS_BEGIN, (parsec_task_t *)this_task);  const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp = (const __parsec_redistribute_check_internal_taskpool_t *)this_task->taskpool;
+  parsec_release_dep_fct_arg_t arg;
+  int __vp_id;
+  int consume_local_repo = 0;
+  arg.action_mask = action_mask;
+  arg.output_entry = NULL;
+  arg.output_repo = NULL;
+#if defined(DISTRIBUTED)
+  arg.remote_deps = deps;
+#endif  /* defined(DISTRIBUTED) */
+  assert(NULL != es);
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS )    arg.ready_lists = alloca(sizeof(parsec_task_t *) * es->virtual_process->parsec_context->nb_vp);
+  else
+    arg.ready_lists = NULL;
+  for( __vp_id = 0; __vp_id < es->virtual_process->parsec_context->nb_vp; arg.ready_lists[__vp_id++] = NULL );
+  (void)__parsec_tp; (void)deps;
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_T.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_T.source_repo, this_task->data._f_T.source_repo_entry->ht_item.key );
+    }
+  }
+  consume_local_repo = (this_task->repo_entry != NULL);
+  arg.output_repo = Send_T_repo;
+  arg.output_entry = this_task->repo_entry;
+  arg.output_usage = 0;
+  if( action_mask & (PARSEC_ACTION_RELEASE_LOCAL_DEPS | PARSEC_ACTION_GET_REPO_ENTRY) ) {
+    arg.output_entry = data_repo_lookup_entry_and_create( es, arg.output_repo, __jdf2c_make_key_Send_T((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    arg.output_entry->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(arg.output_entry->sim_exec_date == 0);
+    arg.output_entry->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  if(action_mask & ( PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE ) ){
+    /* Generate the reshape promise for the outputs that need it */
+    iterate_successors_of_redistribute_check_Send_T(es, this_task, action_mask, parsec_set_up_reshape_promise, &arg);
+   }
+  iterate_successors_of_redistribute_check_Send_T(es, this_task, action_mask, parsec_release_dep_fct, &arg);
+
+#if defined(DISTRIBUTED)
+  if( (action_mask & PARSEC_ACTION_SEND_REMOTE_DEPS) && (NULL != arg.remote_deps)) {
+    parsec_remote_dep_activate(es, (parsec_task_t *)this_task, arg.remote_deps, arg.remote_deps->outgoing_mask);
+  }
+#endif
+
+  if(action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS) {
+    data_repo_entry_addto_usage_limit(Send_T_repo, arg.output_entry->ht_item.key, arg.output_usage);
+    __parsec_schedule_vp(es, arg.ready_lists, 0);
+  }
+      if (consume_local_repo) {
+         data_repo_entry_used_once( Send_T_repo, this_task->repo_entry->ht_item.key );
+      }
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_T.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_T.data_in);
+    }
+  }
+  PARSEC_PINS(es, RELEASE_DEPS_END, (parsec_task_t *)this_task);  return 0;
+}
+
+static int data_lookup_of_redistribute_check_Send_T(parsec_execution_stream_t *es, __parsec_redistribute_check_Send_T_task_t *this_task)
+{
+  const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_check_internal_taskpool_t *)this_task->taskpool;
+  parsec_assignment_t generic_locals[MAX_PARAM_COUNT];  /* generic task locals */
+  int target_device = 0; (void)target_device;
+  (void)__parsec_tp; (void)generic_locals; (void)es;
+  parsec_data_copy_t *chunk = NULL;
+  data_repo_t        *reshape_repo  = NULL, *consumed_repo  = NULL;
+  data_repo_entry_t  *reshape_entry = NULL, *consumed_entry = NULL;
+  parsec_key_t        reshape_entry_key = 0, consumed_entry_key = 0;
+  uint8_t             consumed_flow_index;
+  parsec_dep_data_description_t data;
+  int ret;
+  (void)reshape_repo; (void)reshape_entry; (void)reshape_entry_key;
+  (void)consumed_repo; (void)consumed_entry; (void)consumed_entry_key;
+  (void)consumed_flow_index;
+  (void)chunk; (void)data; (void)ret;
+  const int batch_col = this_task->locals.batch_col.value; (void)batch_col;
+  const int m_start = this_task->locals.m_start.value; (void)m_start;
+  const int m_end = this_task->locals.m_end.value; (void)m_end;
+  const int n_start = this_task->locals.n_start.value; (void)n_start;
+  const int n_end = this_task->locals.n_end.value; (void)n_end;
+  const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+  if( NULL == this_task->repo_entry ){
+    this_task->repo_entry = data_repo_lookup_entry_and_create(es, Send_T_repo,                                       __jdf2c_make_key_Send_T((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    data_repo_entry_addto_usage_limit(Send_T_repo, this_task->repo_entry->ht_item.key, 1);    this_task->repo_entry ->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(this_task->repo_entry ->sim_exec_date == 0);
+    this_task->repo_entry ->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  /* The reshape repo is the current task repo. */  reshape_repo = Send_T_repo;
+  reshape_entry_key = __jdf2c_make_key_Send_T((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals) ;
+  reshape_entry = this_task->repo_entry;
+  /* Lookup the input data, and store them in the context if any */
+
+if(! this_task->data._f_T.fulfill ){ /* Flow T */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_T.data_out = NULL;  /* By default, if nothing matches */
+  /* Flow T [0] dependency [0] from memory descT */
+  if( NULL == (chunk = this_task->data._f_T.data_in) ) {
+  /* No data set up by predecessor on this task input flow */
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+  parsec_prof_grapher_data_input(data_of_descT(m, n), (parsec_task_t*)this_task, &flow_of_redistribute_check_Send_T_for_T, 1);
+#endif
+    chunk = parsec_data_get_copy(data_of_descT(m, n), target_device);
+    data.data = chunk;
+    data.data_future  = NULL;
+        data.local.arena  = PARSEC_redistribute_check_TARGET_ADT->arena;
+    data.local.src_datatype = data.data->dtt;
+    data.local.dst_datatype = PARSEC_redistribute_check_TARGET_ADT->opaque_dtt;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.data_future   = NULL;
+    if( (ret = parsec_get_copy_reshape_from_desc(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    this_task->data._f_T.data_out = chunk;
+    PARSEC_OBJ_RETAIN(chunk);
+  } 
+    this_task->data._f_T.data_in     = chunk;
+    this_task->data._f_T.source_repo       = consumed_repo;
+    this_task->data._f_T.source_repo_entry = consumed_entry;
+    if( this_task->data._f_T.source_repo_entry == this_task->repo_entry ){
+      /* in case we have consume from this task repo entry for the flow,
+       * it is cleaned up, avoiding having old stuff during release_deps_of
+       */
+      this_task->repo_entry->data[0] = NULL;
+    }
+    this_task->data._f_T.fulfill = 1;
+}
+
+  /* ctl is a control flow */
+  this_task->data._f_ctl.data_in         = NULL;
+  this_task->data._f_ctl.data_out        = NULL;
+  this_task->data._f_ctl.source_repo       = NULL;
+  this_task->data._f_ctl.source_repo_entry = NULL;
+  /** Generate profiling information */
+#if defined(PARSEC_PROF_TRACE)
+  this_task->prof_info.desc = (parsec_data_collection_t*)__parsec_tp->super._g_descT;
+  this_task->prof_info.priority = this_task->priority;
+  this_task->prof_info.data_id   = ((parsec_data_collection_t*)__parsec_tp->super._g_descT)->data_key((parsec_data_collection_t*)__parsec_tp->super._g_descT, m, n);
+  this_task->prof_info.task_class_id = this_task->task_class->task_class_id;
+  this_task->prof_info.task_return_code = -1;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int datatype_lookup_of_redistribute_check_Send_T(parsec_execution_stream_t *es, const parsec_task_t *this_generic_task, const parsec_task_t *parent_task,
+              uint32_t* flow_mask, parsec_dep_data_description_t* data)
+{
+  const __parsec_redistribute_check_Send_T_task_t *this_task = (__parsec_redistribute_check_Send_T_task_t*)this_generic_task;
+  const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_check_internal_taskpool_t *)this_task->taskpool;
+  (void)__parsec_tp; (void)es; (void)this_task; (void)data; (void)parent_task;
+  const int batch_col = this_task->locals.batch_col.value; (void)batch_col;
+  const int m_start = this_task->locals.m_start.value; (void)m_start;
+  const int m_end = this_task->locals.m_end.value; (void)m_end;
+  const int n_start = this_task->locals.n_start.value; (void)n_start;
+  const int n_end = this_task->locals.n_end.value; (void)n_end;
+  const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+  data->local.arena = data->remote.arena = NULL;
+  data->local.src_datatype  = data->local.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->local.src_count     = data->local.dst_count = 0;
+  data->local.src_displ     = data->local.dst_displ = 0;
+  data->data_future  = NULL;
+  if( (*flow_mask) & 0x80000000U ) { /* these are the input dependencies remote datatypes  */
+if( (*flow_mask) & 0x1U ) {  /* Flow T */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_redistribute_check_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_redistribute_check_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_redistribute_check_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+    goto no_mask_match;
+  }
+
+  /* these are the output dependencies remote datatypes */
+if( (*flow_mask) & 0x1U ) {  /* Flow T */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_redistribute_check_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_redistribute_check_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_redistribute_check_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+ no_mask_match:
+  data->data                             = NULL;
+  data->remote.src_datatype = data->remote.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->remote.src_count    = data->remote.dst_count = 0;
+  data->remote.src_displ    = data->remote.dst_displ = 0;
+  data->data_future  = NULL;
+  (*flow_mask) = 0;  /* nothing left */
+  (void)batch_col;  (void)m_start;  (void)m_end;  (void)n_start;  (void)n_end;  (void)m;  (void)n;
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+static int hook_of_redistribute_check_Send_T(parsec_execution_stream_t *es, __parsec_redistribute_check_Send_T_task_t *this_task)
+{
+  __parsec_redistribute_check_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_check_internal_taskpool_t *)this_task->taskpool;
+  (void)es; (void)__parsec_tp;
+  const int batch_col = this_task->locals.batch_col.value; (void)batch_col;
+  const int m_start = this_task->locals.m_start.value; (void)m_start;
+  const int m_end = this_task->locals.m_end.value; (void)m_end;
+  const int n_start = this_task->locals.n_start.value; (void)n_start;
+  const int n_end = this_task->locals.n_end.value; (void)n_end;
+  const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+  (void)batch_col;  (void)m_start;  (void)m_end;  (void)n_start;  (void)n_end;  (void)m;  (void)n;
+
+  /** Declare the variables that will hold the data, and all the accounting for each */
+  parsec_data_copy_t *_f_T = this_task->data._f_T.data_in;
+  void *T = PARSEC_DATA_COPY_GET_PTR(_f_T); (void)T;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    data_repo_entry_t *eT = this_task->data._f_T.source_repo_entry;
+    if( (NULL != eT) && (eT->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eT->sim_exec_date;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+  /** Cache Awareness Accounting */
+#if defined(PARSEC_CACHE_AWARENESS)
+  cache_buf_referenced(es->closest_cache, T);
+#endif /* PARSEC_CACHE_AWARENESS */
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                                  Send_T BODY                                  -----*/
+
+{
+}
+
+/*-----                              END OF Send_T BODY                              -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#endif  /*  defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+static int complete_hook_of_redistribute_check_Send_T(parsec_execution_stream_t *es, __parsec_redistribute_check_Send_T_task_t *this_task)
+{
+  const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_check_internal_taskpool_t *)this_task->taskpool;
+#if defined(DISTRIBUTED)
+    const int batch_col = this_task->locals.batch_col.value; (void)batch_col;
+  const int m_start = this_task->locals.m_start.value; (void)m_start;
+  const int m_end = this_task->locals.m_end.value; (void)m_end;
+  const int n_start = this_task->locals.n_start.value; (void)n_start;
+  const int n_end = this_task->locals.n_end.value; (void)n_end;
+  const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+#endif  /* defined(DISTRIBUTED) */
+  (void)es; (void)__parsec_tp;
+parsec_data_t* data_t_desc = NULL; (void)data_t_desc;
+#if defined(DISTRIBUTED)
+  /** If not working on distributed, there is no risk that data is not in place */
+  (void)batch_col;  (void)m_start;  (void)m_end;  (void)n_start;  (void)n_end;  (void)m;  (void)n;
+
+#endif /* DISTRIBUTED */
+#if defined(PARSEC_PROF_GRAPHER)
+  parsec_prof_grapher_task((parsec_task_t*)this_task, es->th_id, es->virtual_process->vp_id,
+     __jdf2c_key_fns_Send_T.key_hash(this_task->task_class->make_key( (parsec_taskpool_t*)this_task->taskpool, ((parsec_task_t*)this_task)->locals), NULL));
+#endif  /* defined(PARSEC_PROF_GRAPHER) */
+  release_deps_of_redistribute_check_Send_T(es, this_task,
+      PARSEC_ACTION_RELEASE_REMOTE_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_REFS |
+      PARSEC_ACTION_RESHAPE_ON_RELEASE |
+      0x1,  /* mask of all dep_index */ 
+      NULL);
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static parsec_hook_return_t release_task_of_redistribute_check_Send_T(parsec_execution_stream_t *es, parsec_task_t *this_task)
+{
+    const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp =
+        (const __parsec_redistribute_check_internal_taskpool_t *)this_task->taskpool;
+    parsec_hash_table_t *ht = (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[2];
+    parsec_key_t key = this_task->task_class->make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals);
+    parsec_hashable_dependency_t *hash_dep = (parsec_hashable_dependency_t *)parsec_hash_table_remove(ht, key);
+    parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);
+    return parsec_release_task_to_mempool_update_nbtasks(es, this_task);
+}
+
+static char *redistribute_check_redistribute_check_Send_T_internal_init_deps_key_functions_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_redistribute_check_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_check_internal_taskpool_t *)user_data;
+  __parsec_redistribute_check_Send_T_parsec_assignment_t __jdf2c__assignments = {  .batch_col.value = 0, .m_start.value = 0, .m_end.value = 0, .n_start.value = 0, .n_end.value = 0, .m.value = 0, .n.value = 0 };
+  int batch_col = (__parsec_key) % __parsec_tp->Send_T_batch_col_range + __parsec_tp->Send_T_batch_col_min;
+  __parsec_key = __parsec_key / __parsec_tp->Send_T_batch_col_range;
+  __jdf2c__assignments.batch_col.value = batch_col;
+  int m_start = (disi_T / (descT->mb - (2 * R)));
+  (void)m_start;
+  __jdf2c__assignments.m_start.value = m_start;
+  int m_end = (((disi_T + size_row) - 1) / (descT->mb - (2 * R)));
+  (void)m_end;
+  __jdf2c__assignments.m_end.value = m_end;
+  int n_start = (disj_T / (descT->nb - (2 * R)));
+  (void)n_start;
+  __jdf2c__assignments.n_start.value = n_start;
+  int n_end = (((disj_T + size_col) - 1) / (descT->nb - (2 * R)));
+  (void)n_end;
+  __jdf2c__assignments.n_end.value = n_end;
+  int m = (__parsec_key) % __parsec_tp->Send_T_m_range + __parsec_tp->Send_T_m_min;
+  __parsec_key = __parsec_key / __parsec_tp->Send_T_m_range;
+  __jdf2c__assignments.m.value = m;
+  int n = (__parsec_key) % __parsec_tp->Send_T_n_range + __parsec_tp->Send_T_n_min;
+  __parsec_key = __parsec_key / __parsec_tp->Send_T_n_range;
+  __jdf2c__assignments.n.value = n;
+  (void)__jdf2c__assignments;
+  snprintf(buffer, buffer_size, "Send_T(%d, %d, %d)", batch_col, m, n);
+  return buffer;
+}
+
+static parsec_key_fn_t redistribute_check_redistribute_check_Send_T_internal_init_deps_key_functions = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = redistribute_check_redistribute_check_Send_T_internal_init_deps_key_functions_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/* Needs: min-max count-tasks iterate */
+static int redistribute_check_Send_T_internal_init(parsec_execution_stream_t * es, __parsec_redistribute_check_Send_T_task_t * this_task)
+{
+  __parsec_redistribute_check_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_check_internal_taskpool_t*)this_task->taskpool;
+  int32_t nb_tasks = 0, saved_nb_tasks = 0;
+int32_t __batch_col_min = 0x7fffffff, __batch_col_max = 0;int32_t __jdf2c_batch_col_min = 0x7fffffff, __jdf2c_batch_col_max = 0;int32_t __m_min = 0x7fffffff, __m_max = 0;int32_t __jdf2c_m_min = 0x7fffffff, __jdf2c_m_max = 0;int32_t __n_min = 0x7fffffff, __n_max = 0;int32_t __jdf2c_n_min = 0x7fffffff, __jdf2c_n_max = 0;  __parsec_redistribute_check_Send_T_parsec_assignment_t assignments = {  .batch_col.value = 0, .m_start.value = 0, .m_end.value = 0, .n_start.value = 0, .n_end.value = 0, .m.value = 0, .n.value = 0 };
+  int32_t  batch_col,  m_start,  m_end,  n_start,  n_end,  m,  n;
+  int32_t __jdf2c_batch_col_start, __jdf2c_batch_col_end, __jdf2c_batch_col_inc;
+  int32_t __jdf2c_m_start, __jdf2c_m_end, __jdf2c_m_inc;
+  int32_t __jdf2c_n_start, __jdf2c_n_end, __jdf2c_n_inc;
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+  PARSEC_PROFILING_TRACE(es->es_profile,
+                         this_task->taskpool->profiling_array[START_KEY(this_task->task_class->task_class_id)],
+                         0,
+                         this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    __jdf2c_batch_col_start = 0;
+    __jdf2c_batch_col_end = (NT - 1);
+    __jdf2c_batch_col_inc = 1;
+    __batch_col_min = parsec_imin(__jdf2c_batch_col_start, __jdf2c_batch_col_end);
+    __batch_col_max = parsec_imax(__jdf2c_batch_col_start, __jdf2c_batch_col_end);
+    __jdf2c_batch_col_min = parsec_imin(__jdf2c_batch_col_min, __batch_col_min);
+    __jdf2c_batch_col_max = parsec_imax(__jdf2c_batch_col_max, __batch_col_max);
+    for(batch_col =  __jdf2c_batch_col_start;
+        batch_col <= __jdf2c_batch_col_end;
+        batch_col += __jdf2c_batch_col_inc) {
+    assignments.batch_col.value = batch_col;
+  {  /* block for the non-range variable m_start */
+      m_start = (disi_T / (descT->mb - (2 * R)));
+      assignments.m_start.value = m_start;
+    {  /* block for the non-range variable m_end */
+        m_end = (((disi_T + size_row) - 1) / (descT->mb - (2 * R)));
+        assignments.m_end.value = m_end;
+      {  /* block for the non-range variable n_start */
+          n_start = (disj_T / (descT->nb - (2 * R)));
+          assignments.n_start.value = n_start;
+        {  /* block for the non-range variable n_end */
+            n_end = (((disj_T + size_col) - 1) / (descT->nb - (2 * R)));
+            assignments.n_end.value = n_end;
+              __jdf2c_m_start = m_start;
+              __jdf2c_m_end = m_end;
+              __jdf2c_m_inc = 1;
+              __m_min = parsec_imin(__jdf2c_m_start, __jdf2c_m_end);
+              __m_max = parsec_imax(__jdf2c_m_start, __jdf2c_m_end);
+              __jdf2c_m_min = parsec_imin(__jdf2c_m_min, __m_min);
+              __jdf2c_m_max = parsec_imax(__jdf2c_m_max, __m_max);
+              for(m =  __jdf2c_m_start;
+                  m <= __jdf2c_m_end;
+                  m += __jdf2c_m_inc) {
+              assignments.m.value = m;
+                __jdf2c_n_start = redistribute_check_Send_T_inline_c_expr4_line_116(__parsec_tp, &assignments);
+                __jdf2c_n_end = redistribute_check_Send_T_inline_c_expr3_line_116(__parsec_tp, &assignments);
+                __jdf2c_n_inc = 1;
+                __n_min = parsec_imin(__jdf2c_n_start, __jdf2c_n_end);
+                __n_max = parsec_imax(__jdf2c_n_start, __jdf2c_n_end);
+                __jdf2c_n_min = parsec_imin(__jdf2c_n_min, __n_min);
+                __jdf2c_n_max = parsec_imax(__jdf2c_n_max, __n_max);
+                for(n =  __jdf2c_n_start;
+                    n <= __jdf2c_n_end;
+                    n += __jdf2c_n_inc) {
+                assignments.n.value = n;
+                if( !Send_T_pred(batch_col, m_start, m_end, n_start, n_end, m, n) ) continue;
+                nb_tasks++;
+              } /* Loop on normal range n */
+            } /* For loop of m */ 
+          } /* Non-range variable n_end */ 
+        } /* Non-range variable n_start */ 
+      } /* Non-range variable m_end */ 
+    } /* Non-range variable m_start */ 
+  } /* For loop of batch_col */ 
+   if( 0 != nb_tasks ) {
+     (void)parsec_atomic_fetch_add_int32(&__parsec_tp->initial_number_tasks, nb_tasks);
+   }
+  /* Set the range variables for the collision-free hash-computation */
+  __parsec_tp->Send_T_batch_col_min   = __jdf2c_batch_col_min;
+  __parsec_tp->Send_T_batch_col_range = (__jdf2c_batch_col_max - __jdf2c_batch_col_min) + 1;
+  __parsec_tp->Send_T_m_min   = __jdf2c_m_min;
+  __parsec_tp->Send_T_m_range = (__jdf2c_m_max - __jdf2c_m_min) + 1;
+  __parsec_tp->Send_T_n_min   = __jdf2c_n_min;
+  __parsec_tp->Send_T_n_range = (__jdf2c_n_max - __jdf2c_n_min) + 1;
+    do {
+      this_task->super.list_next = (parsec_list_item_t*)__parsec_tp->startup_queue;
+    } while(!parsec_atomic_cas_ptr(&__parsec_tp->startup_queue, (parsec_list_item_t*)this_task->super.list_next, this_task));
+    this_task->status = PARSEC_TASK_STATUS_HOOK;
+
+  PARSEC_AYU_REGISTER_TASK(&redistribute_check_Send_T);
+  __parsec_tp->super.super.dependencies_array[2] = PARSEC_OBJ_NEW(parsec_hash_table_t);
+  parsec_hash_table_init(__parsec_tp->super.super.dependencies_array[2], offsetof(parsec_hashable_dependency_t, ht_item), 10, redistribute_check_redistribute_check_Send_T_internal_init_deps_key_functions, this_task->taskpool);
+  __parsec_tp->repositories[2] = data_repo_create_nothreadsafe(nb_tasks, __jdf2c_key_fns_Send_T, (parsec_taskpool_t*)__parsec_tp, 2);
+(void)saved_nb_tasks;
+(void)__batch_col_min; (void)__batch_col_max;(void)__m_min; (void)__m_max;(void)__n_min; (void)__n_max;  (void)__jdf2c_batch_col_start; (void)__jdf2c_batch_col_end; (void)__jdf2c_batch_col_inc;  (void)__jdf2c_m_start; (void)__jdf2c_m_end; (void)__jdf2c_m_inc;  (void)__jdf2c_n_start; (void)__jdf2c_n_end; (void)__jdf2c_n_inc;  (void)assignments; (void)__parsec_tp; (void)es;
+  if(1 == parsec_atomic_fetch_dec_int32(&__parsec_tp->sync_point)) {
+    /* Last initialization task complete. Update the number of tasks. */
+    __parsec_tp->super.super.tdm.module->taskpool_addto_nb_tasks(&__parsec_tp->super.super, __parsec_tp->initial_number_tasks);
+    parsec_mfence();  /* write memory barrier to guarantee that the scheduler gets the correct number of tasks */
+    parsec_taskpool_enable((parsec_taskpool_t*)__parsec_tp, &__parsec_tp->startup_queue,
+                           (parsec_task_t*)this_task, es, __parsec_tp->super.super.nb_pending_actions);
+    __parsec_tp->super.super.tdm.module->taskpool_ready(&__parsec_tp->super.super);
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+    PARSEC_PROFILING_TRACE(es->es_profile,
+                           this_task->taskpool->profiling_array[2 * this_task->task_class->task_class_id + 1],
+                           0,
+                           this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    if( 1 >= __parsec_tp->super.super.nb_pending_actions ) {
+        /* if no tasks will be generated let's prevent the runtime from calling the hook and instead go directly to complete the task */
+        this_task->status = PARSEC_TASK_STATUS_COMPLETE;
+    }
+    return PARSEC_HOOK_RETURN_DONE;
+  }
+  return PARSEC_HOOK_RETURN_ASYNC;
+}
+
+static int __jdf2c_startup_Send_T(parsec_execution_stream_t * es, __parsec_redistribute_check_Send_T_task_t *this_task)
+{
+  __parsec_redistribute_check_Send_T_task_t* new_task;
+  __parsec_redistribute_check_internal_taskpool_t* __parsec_tp = (__parsec_redistribute_check_internal_taskpool_t*)this_task->taskpool;
+  parsec_context_t *context = __parsec_tp->super.super.context;
+  int vpid = 0, nb_tasks = 0;
+  size_t total_nb_tasks = 0;
+  parsec_list_item_t* pready_ring[context->nb_vp];
+  int restore_context = 0;
+  int batch_col = this_task->locals.batch_col.value;  /* retrieve value saved during the last iteration */
+  int m_start = this_task->locals.m_start.value;  /* retrieve value saved during the last iteration */
+  int m_end = this_task->locals.m_end.value;  /* retrieve value saved during the last iteration */
+  int n_start = this_task->locals.n_start.value;  /* retrieve value saved during the last iteration */
+  int n_end = this_task->locals.n_end.value;  /* retrieve value saved during the last iteration */
+  int m = this_task->locals.m.value;  /* retrieve value saved during the last iteration */
+  int n = this_task->locals.n.value;  /* retrieve value saved during the last iteration */
+  for(int _i = 0; _i < context->nb_vp; pready_ring[_i++] = NULL );
+  if( 0 != this_task->locals.reserved[0].value ) {
+    this_task->locals.reserved[0].value = 1; /* reset the submission process */
+    restore_context = 1;
+    goto restore_context_0;
+  }
+  this_task->locals.reserved[0].value = 1; /* a sane default value */
+  for(this_task->locals.batch_col.value = batch_col = 0;
+      this_task->locals.batch_col.value <= (NT - 1);
+      this_task->locals.batch_col.value += 1, batch_col = this_task->locals.batch_col.value) {
+    this_task->locals.m_start.value = m_start = (disi_T / (descT->mb - (2 * R)));
+    this_task->locals.m_end.value = m_end = (((disi_T + size_row) - 1) / (descT->mb - (2 * R)));
+    this_task->locals.n_start.value = n_start = (disj_T / (descT->nb - (2 * R)));
+    this_task->locals.n_end.value = n_end = (((disj_T + size_col) - 1) / (descT->nb - (2 * R)));
+    for(this_task->locals.m.value = m = m_start;
+        this_task->locals.m.value <= m_end;
+        this_task->locals.m.value += 1, m = this_task->locals.m.value) {
+      for(this_task->locals.n.value = n = redistribute_check_Send_T_inline_c_expr4_line_116(__parsec_tp, &this_task->locals);
+          this_task->locals.n.value <= redistribute_check_Send_T_inline_c_expr3_line_116(__parsec_tp, &this_task->locals);
+          this_task->locals.n.value += 1, n = this_task->locals.n.value) {
+        if( !Send_T_pred(batch_col, m_start, m_end, n_start, n_end, m, n) ) continue;
+  __parsec_redistribute_check_Send_T_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_redistribute_check_Send_T_parsec_assignment_t*)&this_task->locals;
+  (void)__jdf2c__tmp_locals;
+  /* Flow for T is always a memory reference */
+  if( (batch_col) > (0) ) continue; /* ctl Get_T() is not a memory reference for flow ctl */
+        if( NULL != ((parsec_data_collection_t*)__parsec_tp->super._g_descT)->vpid_of ) {
+          vpid = ((parsec_data_collection_t*)__parsec_tp->super._g_descT)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descT, m, n);
+          assert(context->nb_vp >= vpid);
+        } else {
+          vpid = (vpid + 1) % context->nb_vp;  /* spread the initial joy */
+        }
+        new_task = (__parsec_redistribute_check_Send_T_task_t*)parsec_thread_mempool_allocate( context->virtual_processes[vpid]->execution_streams[0]->context_mempool );
+        PARSEC_OBJ_CONSTRUCT(new_task, parsec_task_t); /* construct called only when new, force-construct it again */
+        /* Copy only the valid elements from this_task to new_task one */
+        new_task->taskpool   = this_task->taskpool;
+        new_task->task_class = __parsec_tp->super.super.task_classes_array[redistribute_check_Send_T.task_class_id];
+        new_task->chore_mask   = PARSEC_DEV_ALL;
+        new_task->locals.batch_col.value = this_task->locals.batch_col.value;
+        new_task->locals.m_start.value = this_task->locals.m_start.value;
+        new_task->locals.m_end.value = this_task->locals.m_end.value;
+        new_task->locals.n_start.value = this_task->locals.n_start.value;
+        new_task->locals.n_end.value = this_task->locals.n_end.value;
+        new_task->locals.m.value = this_task->locals.m.value;
+        new_task->locals.n.value = this_task->locals.n.value;
+        PARSEC_LIST_ITEM_SINGLETON(new_task);
+        new_task->priority = __parsec_tp->super.super.priority;
+        new_task->repo_entry = NULL;
+        new_task->data._f_T.source_repo_entry = NULL;
+        new_task->data._f_T.source_repo       = NULL;
+        new_task->data._f_T.data_in         = NULL;
+        new_task->data._f_T.data_out        = NULL;
+        new_task->data._f_T.fulfill         = 0;
+        new_task->data._f_ctl.source_repo_entry = NULL;
+        new_task->data._f_ctl.source_repo       = NULL;
+        new_task->data._f_ctl.data_in         = NULL;
+        new_task->data._f_ctl.data_out        = NULL;
+        new_task->data._f_ctl.fulfill         = 0;
+#if defined(PARSEC_DEBUG_NOISIER)
+        {
+          char tmp[128];
+          PARSEC_DEBUG_VERBOSE(10, parsec_debug_output, "Add startup task %s to vpid %d",
+                 parsec_task_snprintf(tmp, 128, (parsec_task_t*)new_task), vpid);
+        }
+#endif
+        parsec_dependencies_mark_task_as_startup((parsec_task_t*)new_task, es);
+        pready_ring[vpid] = parsec_list_item_ring_push_sorted(pready_ring[vpid],
+                                                              (parsec_list_item_t*)new_task,
+                                                              parsec_execution_context_priority_comparator);
+        nb_tasks++;
+       restore_context_0:  /* we jump here just so that we have code after the label */
+        restore_context = 0;
+        (void)restore_context;
+        if( nb_tasks > this_task->locals.reserved[0].value ) {
+          if( (size_t)this_task->locals.reserved[0].value < parsec_task_startup_iter ) this_task->locals.reserved[0].value <<= 1;
+          __parsec_schedule_vp(es, (parsec_task_t**)pready_ring, 0);
+          total_nb_tasks += nb_tasks;
+          nb_tasks = 0;
+          if( total_nb_tasks > parsec_task_startup_chunk ) {  /* stop here and request to be rescheduled */
+            return PARSEC_HOOK_RETURN_AGAIN;
+          }
+        }
+      } /* Loop on normal range n */
+    } /* Loop on normal range m */
+  } /* Loop on normal range batch_col */
+  (void)vpid;
+  if( 0 != nb_tasks ) {
+    __parsec_schedule_vp(es, (parsec_task_t**)pready_ring, 0);
+    nb_tasks = 0;
+  }
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static const __parsec_chore_t __redistribute_check_Send_T_chores[] ={
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+    { .type     = PARSEC_DEV_CPU,
+      .evaluate = (parsec_evaluate_function_t*)NULL,
+      .hook     = (parsec_hook_t*)hook_of_redistribute_check_Send_T },
+#endif  /* defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+    { .type     = PARSEC_DEV_NONE,
+      .evaluate = NULL,
+      .hook     = (parsec_hook_t*)NULL },  /* End marker */
+};
+
+static const parsec_task_class_t redistribute_check_Send_T = {
+  .name = "Send_T",
+  .task_class_id = 2,
+  .nb_flows = 2,
+  .nb_parameters = 3,
+  .nb_locals = 7,
+  .task_class_type = PARSEC_TASK_CLASS_TYPE_PTG,
+  .params = { &symb_redistribute_check_Send_T_m, &symb_redistribute_check_Send_T_n, &symb_redistribute_check_Send_T_batch_col, NULL },
+  .locals = { &symb_redistribute_check_Send_T_batch_col, &symb_redistribute_check_Send_T_m_start, &symb_redistribute_check_Send_T_m_end, &symb_redistribute_check_Send_T_n_start, &symb_redistribute_check_Send_T_n_end, &symb_redistribute_check_Send_T_m, &symb_redistribute_check_Send_T_n, NULL },
+  .data_affinity = (parsec_data_ref_fn_t*)affinity_of_redistribute_check_Send_T,
+  .initial_data = (parsec_data_ref_fn_t*)affinity_of_redistribute_check_Send_T,
+  .final_data = (parsec_data_ref_fn_t*)affinity_of_redistribute_check_Send_T,
+  .priority = NULL,
+  .properties = properties_of_redistribute_check_Send_T,
+#if MAX_PARAM_COUNT < 1  /* number of read flows of Send_T */
+  #error Too many read flows for task Send_T
+#endif  /* MAX_PARAM_COUNT */
+#if MAX_PARAM_COUNT < 0  /* number of write flows of Send_T */
+  #error Too many write flows for task Send_T
+#endif  /* MAX_PARAM_COUNT */
+  .in = { &flow_of_redistribute_check_Send_T_for_T, &flow_of_redistribute_check_Send_T_for_ctl, NULL },
+  .out = { &flow_of_redistribute_check_Send_T_for_T, NULL },
+  .flags = 0x0 | PARSEC_HAS_IN_IN_DEPENDENCIES | PARSEC_USE_DEPS_MASK,
+  .dependencies_goal = 0x3,
+  .make_key = __jdf2c_make_key_Send_T,
+  .task_snprintf = parsec_task_snprintf,
+#if defined(PARSEC_PROF_TRACE)
+  .profile_info = &parsec_task_profile_info,
+#endif
+  .key_functions = &__jdf2c_key_fns_Send_T,
+  .fini = (parsec_hook_t*)NULL,
+  .incarnations = __redistribute_check_Send_T_chores,
+  .find_deps = parsec_hash_find_deps,
+  .update_deps = parsec_update_deps_with_mask,
+  .iterate_successors = (parsec_traverse_function_t*)iterate_successors_of_redistribute_check_Send_T,
+  .iterate_predecessors = (parsec_traverse_function_t*)iterate_predecessors_of_redistribute_check_Send_T,
+  .release_deps = (parsec_release_deps_t*)release_deps_of_redistribute_check_Send_T,
+  .prepare_output = (parsec_hook_t*)NULL,
+  .prepare_input = (parsec_hook_t*)data_lookup_of_redistribute_check_Send_T,
+  .time_estimate = NULL,
+  .get_datatype = datatype_lookup_of_redistribute_check_Send_T,
+  .complete_execution = (parsec_hook_t*)complete_hook_of_redistribute_check_Send_T,
+  .release_task = &release_task_of_redistribute_check_Send_T,
+#if defined(PARSEC_SIM)
+  .sim_cost_fct = (parsec_sim_cost_fct_t*)NULL,
+#endif
+};
+
+
+/******                                    Get_Y                                      ******/
+
+static inline int32_t minexpr_of_symb_redistribute_check_Get_Y_batch_col_fct(const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_check_Get_Y_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_redistribute_check_Get_Y_batch_col = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_redistribute_check_Get_Y_batch_col_fct }
+                   }
+};
+static inline int maxexpr_of_symb_redistribute_check_Get_Y_batch_col_fct(const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_check_Get_Y_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_start = locals->m_start.value; (void)m_start;
+  const int m_end = locals->m_end.value; (void)m_end;
+  const int n_start = locals->n_start.value; (void)n_start;
+  const int n_end = locals->n_end.value; (void)n_end;
+  const int m = locals->m.value; (void)m;
+  const int n = locals->n.value; (void)n;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int i_end = locals->i_end.value; (void)i_end;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int j_end = locals->j_end.value; (void)j_end;
+
+  (void)batch_col;
+  (void)m_start;
+  (void)m_end;
+  (void)n_start;
+  (void)n_end;
+  (void)m;
+  (void)n;
+  (void)i_start;
+  (void)i_end;
+  (void)j_start;
+  (void)j_end;
+  (void)__parsec_tp; (void)locals;
+  return (NY - 1);
+}
+static const parsec_expr_t maxexpr_of_symb_redistribute_check_Get_Y_batch_col = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_redistribute_check_Get_Y_batch_col_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_check_Get_Y_batch_col = { .name = "batch_col", .context_index = 0, .min = &minexpr_of_symb_redistribute_check_Get_Y_batch_col, .max = &maxexpr_of_symb_redistribute_check_Get_Y_batch_col, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int expr_of_symb_redistribute_check_Get_Y_m_start_fct(const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_check_Get_Y_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_start = locals->m_start.value; (void)m_start;
+  const int m_end = locals->m_end.value; (void)m_end;
+  const int n_start = locals->n_start.value; (void)n_start;
+  const int n_end = locals->n_end.value; (void)n_end;
+  const int m = locals->m.value; (void)m;
+  const int n = locals->n.value; (void)n;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int i_end = locals->i_end.value; (void)i_end;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int j_end = locals->j_end.value; (void)j_end;
+
+  (void)batch_col;
+  (void)m_start;
+  (void)m_end;
+  (void)n_start;
+  (void)n_end;
+  (void)m;
+  (void)n;
+  (void)i_start;
+  (void)i_end;
+  (void)j_start;
+  (void)j_end;
+  (void)__parsec_tp; (void)locals;
+  return (disi_Y / (descY->mb - (2 * R)));
+}
+static const parsec_expr_t expr_of_symb_redistribute_check_Get_Y_m_start = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_check_Get_Y_m_start_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_check_Get_Y_m_start = { .name = "m_start", .context_index = 1, .min = &expr_of_symb_redistribute_check_Get_Y_m_start, .max = &expr_of_symb_redistribute_check_Get_Y_m_start, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int expr_of_symb_redistribute_check_Get_Y_m_end_fct(const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_check_Get_Y_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_start = locals->m_start.value; (void)m_start;
+  const int m_end = locals->m_end.value; (void)m_end;
+  const int n_start = locals->n_start.value; (void)n_start;
+  const int n_end = locals->n_end.value; (void)n_end;
+  const int m = locals->m.value; (void)m;
+  const int n = locals->n.value; (void)n;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int i_end = locals->i_end.value; (void)i_end;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int j_end = locals->j_end.value; (void)j_end;
+
+  (void)batch_col;
+  (void)m_start;
+  (void)m_end;
+  (void)n_start;
+  (void)n_end;
+  (void)m;
+  (void)n;
+  (void)i_start;
+  (void)i_end;
+  (void)j_start;
+  (void)j_end;
+  (void)__parsec_tp; (void)locals;
+  return (((disi_Y + size_row) - 1) / (descY->mb - (2 * R)));
+}
+static const parsec_expr_t expr_of_symb_redistribute_check_Get_Y_m_end = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_check_Get_Y_m_end_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_check_Get_Y_m_end = { .name = "m_end", .context_index = 2, .min = &expr_of_symb_redistribute_check_Get_Y_m_end, .max = &expr_of_symb_redistribute_check_Get_Y_m_end, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int expr_of_symb_redistribute_check_Get_Y_n_start_fct(const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_check_Get_Y_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_start = locals->m_start.value; (void)m_start;
+  const int m_end = locals->m_end.value; (void)m_end;
+  const int n_start = locals->n_start.value; (void)n_start;
+  const int n_end = locals->n_end.value; (void)n_end;
+  const int m = locals->m.value; (void)m;
+  const int n = locals->n.value; (void)n;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int i_end = locals->i_end.value; (void)i_end;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int j_end = locals->j_end.value; (void)j_end;
+
+  (void)batch_col;
+  (void)m_start;
+  (void)m_end;
+  (void)n_start;
+  (void)n_end;
+  (void)m;
+  (void)n;
+  (void)i_start;
+  (void)i_end;
+  (void)j_start;
+  (void)j_end;
+  (void)__parsec_tp; (void)locals;
+  return (disj_Y / (descY->nb - (2 * R)));
+}
+static const parsec_expr_t expr_of_symb_redistribute_check_Get_Y_n_start = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_check_Get_Y_n_start_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_check_Get_Y_n_start = { .name = "n_start", .context_index = 3, .min = &expr_of_symb_redistribute_check_Get_Y_n_start, .max = &expr_of_symb_redistribute_check_Get_Y_n_start, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int expr_of_symb_redistribute_check_Get_Y_n_end_fct(const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_check_Get_Y_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_start = locals->m_start.value; (void)m_start;
+  const int m_end = locals->m_end.value; (void)m_end;
+  const int n_start = locals->n_start.value; (void)n_start;
+  const int n_end = locals->n_end.value; (void)n_end;
+  const int m = locals->m.value; (void)m;
+  const int n = locals->n.value; (void)n;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int i_end = locals->i_end.value; (void)i_end;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int j_end = locals->j_end.value; (void)j_end;
+
+  (void)batch_col;
+  (void)m_start;
+  (void)m_end;
+  (void)n_start;
+  (void)n_end;
+  (void)m;
+  (void)n;
+  (void)i_start;
+  (void)i_end;
+  (void)j_start;
+  (void)j_end;
+  (void)__parsec_tp; (void)locals;
+  return (((disj_Y + size_col) - 1) / (descY->nb - (2 * R)));
+}
+static const parsec_expr_t expr_of_symb_redistribute_check_Get_Y_n_end = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_check_Get_Y_n_end_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_check_Get_Y_n_end = { .name = "n_end", .context_index = 4, .min = &expr_of_symb_redistribute_check_Get_Y_n_end, .max = &expr_of_symb_redistribute_check_Get_Y_n_end, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int minexpr_of_symb_redistribute_check_Get_Y_m_fct(const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_check_Get_Y_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_start = locals->m_start.value;
+  const int m_end = locals->m_end.value; (void)m_end;
+  const int n_start = locals->n_start.value; (void)n_start;
+  const int n_end = locals->n_end.value; (void)n_end;
+  const int m = locals->m.value; (void)m;
+  const int n = locals->n.value; (void)n;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int i_end = locals->i_end.value; (void)i_end;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int j_end = locals->j_end.value; (void)j_end;
+
+  (void)batch_col;
+  (void)m_start;
+  (void)m_end;
+  (void)n_start;
+  (void)n_end;
+  (void)m;
+  (void)n;
+  (void)i_start;
+  (void)i_end;
+  (void)j_start;
+  (void)j_end;
+  (void)__parsec_tp; (void)locals;
+  return m_start;
+}
+static const parsec_expr_t minexpr_of_symb_redistribute_check_Get_Y_m = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_redistribute_check_Get_Y_m_fct }
+                   }
+};
+static inline int maxexpr_of_symb_redistribute_check_Get_Y_m_fct(const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_check_Get_Y_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_start = locals->m_start.value; (void)m_start;
+  const int m_end = locals->m_end.value;
+  const int n_start = locals->n_start.value; (void)n_start;
+  const int n_end = locals->n_end.value; (void)n_end;
+  const int m = locals->m.value; (void)m;
+  const int n = locals->n.value; (void)n;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int i_end = locals->i_end.value; (void)i_end;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int j_end = locals->j_end.value; (void)j_end;
+
+  (void)batch_col;
+  (void)m_start;
+  (void)m_end;
+  (void)n_start;
+  (void)n_end;
+  (void)m;
+  (void)n;
+  (void)i_start;
+  (void)i_end;
+  (void)j_start;
+  (void)j_end;
+  (void)__parsec_tp; (void)locals;
+  return m_end;
+}
+static const parsec_expr_t maxexpr_of_symb_redistribute_check_Get_Y_m = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_redistribute_check_Get_Y_m_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_check_Get_Y_m = { .name = "m", .context_index = 5, .min = &minexpr_of_symb_redistribute_check_Get_Y_m, .max = &maxexpr_of_symb_redistribute_check_Get_Y_m, .cst_inc = 1, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t minexpr_of_symb_redistribute_check_Get_Y_n_fct(const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_check_Get_Y_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_check_Get_Y_inline_c_expr6_line_80(__parsec_tp, locals);
+}
+static const parsec_expr_t minexpr_of_symb_redistribute_check_Get_Y_n = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_redistribute_check_Get_Y_n_fct }
+                   }
+};
+static inline int32_t maxexpr_of_symb_redistribute_check_Get_Y_n_fct(const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_check_Get_Y_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_check_Get_Y_inline_c_expr5_line_80(__parsec_tp, locals);
+}
+static const parsec_expr_t maxexpr_of_symb_redistribute_check_Get_Y_n = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_redistribute_check_Get_Y_n_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_check_Get_Y_n = { .name = "n", .context_index = 6, .min = &minexpr_of_symb_redistribute_check_Get_Y_n, .max = &maxexpr_of_symb_redistribute_check_Get_Y_n, .cst_inc = 1, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int expr_of_symb_redistribute_check_Get_Y_i_start_fct(const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_check_Get_Y_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_start = locals->m_start.value; (void)m_start;
+  const int m_end = locals->m_end.value; (void)m_end;
+  const int n_start = locals->n_start.value; (void)n_start;
+  const int n_end = locals->n_end.value; (void)n_end;
+  const int m = locals->m.value; (void)m;
+  const int n = locals->n.value; (void)n;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int i_end = locals->i_end.value; (void)i_end;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int j_end = locals->j_end.value; (void)j_end;
+
+  (void)batch_col;
+  (void)m_start;
+  (void)m_end;
+  (void)n_start;
+  (void)n_end;
+  (void)m;
+  (void)n;
+  (void)i_start;
+  (void)i_end;
+  (void)j_start;
+  (void)j_end;
+  (void)__parsec_tp; (void)locals;
+  return (disi_Y % (descY->mb - (2 * R)));
+}
+static const parsec_expr_t expr_of_symb_redistribute_check_Get_Y_i_start = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_check_Get_Y_i_start_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_check_Get_Y_i_start = { .name = "i_start", .context_index = 7, .min = &expr_of_symb_redistribute_check_Get_Y_i_start, .max = &expr_of_symb_redistribute_check_Get_Y_i_start, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int expr_of_symb_redistribute_check_Get_Y_i_end_fct(const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_check_Get_Y_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_start = locals->m_start.value; (void)m_start;
+  const int m_end = locals->m_end.value; (void)m_end;
+  const int n_start = locals->n_start.value; (void)n_start;
+  const int n_end = locals->n_end.value; (void)n_end;
+  const int m = locals->m.value; (void)m;
+  const int n = locals->n.value; (void)n;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int i_end = locals->i_end.value; (void)i_end;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int j_end = locals->j_end.value; (void)j_end;
+
+  (void)batch_col;
+  (void)m_start;
+  (void)m_end;
+  (void)n_start;
+  (void)n_end;
+  (void)m;
+  (void)n;
+  (void)i_start;
+  (void)i_end;
+  (void)j_start;
+  (void)j_end;
+  (void)__parsec_tp; (void)locals;
+  return (((disi_Y + size_row) - 1) % (descY->mb - (2 * R)));
+}
+static const parsec_expr_t expr_of_symb_redistribute_check_Get_Y_i_end = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_check_Get_Y_i_end_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_check_Get_Y_i_end = { .name = "i_end", .context_index = 8, .min = &expr_of_symb_redistribute_check_Get_Y_i_end, .max = &expr_of_symb_redistribute_check_Get_Y_i_end, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int expr_of_symb_redistribute_check_Get_Y_j_start_fct(const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_check_Get_Y_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_start = locals->m_start.value; (void)m_start;
+  const int m_end = locals->m_end.value; (void)m_end;
+  const int n_start = locals->n_start.value; (void)n_start;
+  const int n_end = locals->n_end.value; (void)n_end;
+  const int m = locals->m.value; (void)m;
+  const int n = locals->n.value; (void)n;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int i_end = locals->i_end.value; (void)i_end;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int j_end = locals->j_end.value; (void)j_end;
+
+  (void)batch_col;
+  (void)m_start;
+  (void)m_end;
+  (void)n_start;
+  (void)n_end;
+  (void)m;
+  (void)n;
+  (void)i_start;
+  (void)i_end;
+  (void)j_start;
+  (void)j_end;
+  (void)__parsec_tp; (void)locals;
+  return (disj_Y % (descY->nb - (2 * R)));
+}
+static const parsec_expr_t expr_of_symb_redistribute_check_Get_Y_j_start = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_check_Get_Y_j_start_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_check_Get_Y_j_start = { .name = "j_start", .context_index = 9, .min = &expr_of_symb_redistribute_check_Get_Y_j_start, .max = &expr_of_symb_redistribute_check_Get_Y_j_start, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int expr_of_symb_redistribute_check_Get_Y_j_end_fct(const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_check_Get_Y_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_start = locals->m_start.value; (void)m_start;
+  const int m_end = locals->m_end.value; (void)m_end;
+  const int n_start = locals->n_start.value; (void)n_start;
+  const int n_end = locals->n_end.value; (void)n_end;
+  const int m = locals->m.value; (void)m;
+  const int n = locals->n.value; (void)n;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int i_end = locals->i_end.value; (void)i_end;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int j_end = locals->j_end.value; (void)j_end;
+
+  (void)batch_col;
+  (void)m_start;
+  (void)m_end;
+  (void)n_start;
+  (void)n_end;
+  (void)m;
+  (void)n;
+  (void)i_start;
+  (void)i_end;
+  (void)j_start;
+  (void)j_end;
+  (void)__parsec_tp; (void)locals;
+  return (((disj_Y + size_col) - 1) % (descY->nb - (2 * R)));
+}
+static const parsec_expr_t expr_of_symb_redistribute_check_Get_Y_j_end = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_check_Get_Y_j_end_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_check_Get_Y_j_end = { .name = "j_end", .context_index = 10, .min = &expr_of_symb_redistribute_check_Get_Y_j_end, .max = &expr_of_symb_redistribute_check_Get_Y_j_end, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int affinity_of_redistribute_check_Get_Y(const __parsec_redistribute_check_Get_Y_task_t *this_task,
+                     parsec_data_ref_t *ref)
+{
+    const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp = (const __parsec_redistribute_check_internal_taskpool_t*)this_task->taskpool;
+  const int batch_col = this_task->locals.batch_col.value; (void)batch_col;
+  const int m_start = this_task->locals.m_start.value; (void)m_start;
+  const int m_end = this_task->locals.m_end.value; (void)m_end;
+  const int n_start = this_task->locals.n_start.value; (void)n_start;
+  const int n_end = this_task->locals.n_end.value; (void)n_end;
+  const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+  const int i_start = this_task->locals.i_start.value; (void)i_start;
+  const int i_end = this_task->locals.i_end.value; (void)i_end;
+  const int j_start = this_task->locals.j_start.value; (void)j_start;
+  const int j_end = this_task->locals.j_end.value; (void)j_end;
+
+  /* Silent Warnings: should look into predicate to know what variables are usefull */
+  (void)batch_col;
+  (void)m_start;
+  (void)m_end;
+  (void)n_start;
+  (void)n_end;
+  (void)m;
+  (void)n;
+  (void)i_start;
+  (void)i_end;
+  (void)j_start;
+  (void)j_end;
+  ref->dc = (parsec_data_collection_t *)__parsec_tp->super._g_descY;
+  /* Compute data key */
+  ref->key = ref->dc->data_key(ref->dc, 0, 0);
+  return 1;
+}
+static const parsec_property_t properties_of_redistribute_check_Get_Y[1] = {
+  {.name = NULL, .expr = NULL}
+};
+static const parsec_dep_t flow_of_redistribute_check_Get_Y_for_Y_dep1_atline_90 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 0, /* redistribute_check_Send_Y */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_redistribute_check_Send_Y_for_Y,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_redistribute_check_Get_Y_for_Y,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_redistribute_check_Get_Y_for_Y = {
+  .name               = "Y",
+  .sym_type           = PARSEC_SYM_IN,
+  .flow_flags         = PARSEC_FLOW_ACCESS_READ,
+  .flow_index         = 0,
+  .flow_datatype_mask = 0x0,
+  .dep_in     = { &flow_of_redistribute_check_Get_Y_for_Y_dep1_atline_90 },
+  .dep_out    = { NULL }
+};
+
+static inline int expr_of_cond_for_flow_of_redistribute_check_Get_Y_for_ctl_dep1_atline_92_fct(const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_check_Get_Y_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_start = locals->m_start.value; (void)m_start;
+  const int m_end = locals->m_end.value; (void)m_end;
+  const int n_start = locals->n_start.value; (void)n_start;
+  const int n_end = locals->n_end.value; (void)n_end;
+  const int m = locals->m.value; (void)m;
+  const int n = locals->n.value; (void)n;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int i_end = locals->i_end.value; (void)i_end;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int j_end = locals->j_end.value; (void)j_end;
+
+  (void)batch_col;
+  (void)m_start;
+  (void)m_end;
+  (void)n_start;
+  (void)n_end;
+  (void)m;
+  (void)n;
+  (void)i_start;
+  (void)i_end;
+  (void)j_start;
+  (void)j_end;
+  (void)__parsec_tp; (void)locals;
+  return (batch_col) < ((NY - 1));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_redistribute_check_Get_Y_for_ctl_dep1_atline_92 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_redistribute_check_Get_Y_for_ctl_dep1_atline_92_fct }
+                   }
+};
+static const parsec_dep_t flow_of_redistribute_check_Get_Y_for_ctl_dep1_atline_92 = {
+  .cond = &expr_of_cond_for_flow_of_redistribute_check_Get_Y_for_ctl_dep1_atline_92,  /* (batch_col) < ((NY - 1)) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 0, /* redistribute_check_Send_Y */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_redistribute_check_Send_Y_for_ctl,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_redistribute_check_Get_Y_for_ctl,
+};
+#if MAX_DEP_OUT_COUNT < 1  /* number of output dependencies */
+    #error Too many output dependencies (supports up to MAX_DEP_OUT_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_OUT_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_redistribute_check_Get_Y_for_ctl = {
+  .name               = "ctl",
+  .sym_type           = PARSEC_SYM_OUT,
+  .flow_flags         = PARSEC_FLOW_ACCESS_NONE,
+  .flow_index         = 1,
+  .flow_datatype_mask = 0x1,
+  .dep_in     = { NULL },
+  .dep_out    = { &flow_of_redistribute_check_Get_Y_for_ctl_dep1_atline_92 }
+};
+
+static void
+iterate_successors_of_redistribute_check_Get_Y(parsec_execution_stream_t *es, const __parsec_redistribute_check_Get_Y_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp = (const __parsec_redistribute_check_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_redistribute_check_Get_Y_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_redistribute_check_Get_Y_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int batch_col = __jdf2c__tmp_locals.batch_col.value; (void)batch_col;
+  const int m_start = __jdf2c__tmp_locals.m_start.value; (void)m_start;
+  const int m_end = __jdf2c__tmp_locals.m_end.value; (void)m_end;
+  const int n_start = __jdf2c__tmp_locals.n_start.value; (void)n_start;
+  const int n_end = __jdf2c__tmp_locals.n_end.value; (void)n_end;
+  const int m = __jdf2c__tmp_locals.m.value; (void)m;
+  const int n = __jdf2c__tmp_locals.n.value; (void)n;
+  const int i_start = __jdf2c__tmp_locals.i_start.value; (void)i_start;
+  const int i_end = __jdf2c__tmp_locals.i_end.value; (void)i_end;
+  const int j_start = __jdf2c__tmp_locals.j_start.value; (void)j_start;
+  const int j_end = __jdf2c__tmp_locals.j_end.value; (void)j_end;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)batch_col;  (void)m_start;  (void)m_end;  (void)n_start;  (void)n_end;  (void)m;  (void)n;  (void)i_start;  (void)i_end;  (void)j_start;  (void)j_end;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_descY(0, 0);
+#endif
+  /* Flow of data Y has only IN dependencies */
+  if( action_mask & 0x1 ) {  /* Flow of data ctl [1] */
+    data.data   = this_task->data._f_ctl.data_out;
+    data.data_future  = NULL;
+    if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  =   /* Control: always empty */ 0;
+    data.local.dst_count  =   /* Control: always empty */ 0;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = NULL;
+    data.remote.src_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.src_count  =   /* Control: always empty */ 0;
+    data.remote.dst_count  =   /* Control: always empty */ 0;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+       if( (batch_col) < ((NY - 1)) ) {
+      __parsec_redistribute_check_Send_Y_task_t* ncc = (__parsec_redistribute_check_Send_Y_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[redistribute_check_Send_Y.task_class_id];
+        const int Send_Y_batch_col = (batch_col + 1);
+        if( (Send_Y_batch_col >= (0)) && (Send_Y_batch_col <= ((NY - 1))) ) {
+          assert(&nc.locals[0].value == &ncc->locals.batch_col.value);
+          ncc->locals.batch_col.value = Send_Y_batch_col;
+          const int Send_Y_m_start = (disi_Y / (descY->mb - (2 * R)));
+          assert(&nc.locals[1].value == &ncc->locals.m_start.value);
+          ncc->locals.m_start.value = Send_Y_m_start;
+          const int Send_Y_m_end = (((disi_Y + size_row) - 1) / (descY->mb - (2 * R)));
+          assert(&nc.locals[2].value == &ncc->locals.m_end.value);
+          ncc->locals.m_end.value = Send_Y_m_end;
+          const int Send_Y_n_start = (disj_Y / (descY->nb - (2 * R)));
+          assert(&nc.locals[3].value == &ncc->locals.n_start.value);
+          ncc->locals.n_start.value = Send_Y_n_start;
+          const int Send_Y_n_end = (((disj_Y + size_col) - 1) / (descY->nb - (2 * R)));
+          assert(&nc.locals[4].value == &ncc->locals.n_end.value);
+          ncc->locals.n_end.value = Send_Y_n_end;
+          const int Send_Y_m = m;
+          if( (Send_Y_m >= (ncc->locals.m_start.value)) && (Send_Y_m <= (ncc->locals.m_end.value)) ) {
+            assert(&nc.locals[5].value == &ncc->locals.m.value);
+            ncc->locals.m.value = Send_Y_m;
+            const int Send_Y_n = (n + num_col_Y);
+            if( (Send_Y_n >= (redistribute_check_Send_Y_inline_c_expr8_line_52(__parsec_tp, &ncc->locals))) && (Send_Y_n <= (redistribute_check_Send_Y_inline_c_expr7_line_52(__parsec_tp, &ncc->locals))) ) {
+              assert(&nc.locals[6].value == &ncc->locals.n.value);
+              ncc->locals.n.value = Send_Y_n;
+#if defined(DISTRIBUTED)
+              rank_dst = rank_of_descY(ncc->locals.m.value, ncc->locals.n.value);
+              if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+                vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descY)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descY, ncc->locals.m.value, ncc->locals.n.value);
+              nc.priority = __parsec_tp->super.super.priority;
+              successor_repo = Send_Y_repo;
+              successor_repo_key = __jdf2c_make_key_Send_Y((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+            RELEASE_DEP_OUTPUT(es, "ctl", this_task, "ctl", &nc, rank_src, rank_dst, &data);
+            if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_redistribute_check_Get_Y_for_ctl_dep1_atline_92, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+              }
+            }
+          }
+    }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static void
+iterate_predecessors_of_redistribute_check_Get_Y(parsec_execution_stream_t *es, const __parsec_redistribute_check_Get_Y_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp = (const __parsec_redistribute_check_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_redistribute_check_Get_Y_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_redistribute_check_Get_Y_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int batch_col = __jdf2c__tmp_locals.batch_col.value; (void)batch_col;
+  const int m_start = __jdf2c__tmp_locals.m_start.value; (void)m_start;
+  const int m_end = __jdf2c__tmp_locals.m_end.value; (void)m_end;
+  const int n_start = __jdf2c__tmp_locals.n_start.value; (void)n_start;
+  const int n_end = __jdf2c__tmp_locals.n_end.value; (void)n_end;
+  const int m = __jdf2c__tmp_locals.m.value; (void)m;
+  const int n = __jdf2c__tmp_locals.n.value; (void)n;
+  const int i_start = __jdf2c__tmp_locals.i_start.value; (void)i_start;
+  const int i_end = __jdf2c__tmp_locals.i_end.value; (void)i_end;
+  const int j_start = __jdf2c__tmp_locals.j_start.value; (void)j_start;
+  const int j_end = __jdf2c__tmp_locals.j_end.value; (void)j_end;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)batch_col;  (void)m_start;  (void)m_end;  (void)n_start;  (void)n_end;  (void)m;  (void)n;  (void)i_start;  (void)i_end;  (void)j_start;  (void)j_end;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_descY(0, 0);
+#endif
+  if( action_mask & 0x1 ) {  /* Flow of data Y [0] */
+    data.data   = this_task->data._f_Y.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x1 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_redistribute_check_ORIGIN_ADT->arena;
+    data.local.src_datatype = PARSEC_redistribute_check_ORIGIN_ADT->opaque_dtt;
+    data.local.dst_datatype = PARSEC_redistribute_check_ORIGIN_ADT->opaque_dtt;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_redistribute_check_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        __parsec_redistribute_check_Send_Y_task_t* ncc = (__parsec_redistribute_check_Send_Y_task_t*)&nc;
+    nc.task_class = __parsec_tp->super.super.task_classes_array[redistribute_check_Send_Y.task_class_id];
+      const int Send_Y_batch_col = batch_col;
+      if( (Send_Y_batch_col >= (0)) && (Send_Y_batch_col <= ((NY - 1))) ) {
+        assert(&nc.locals[0].value == &ncc->locals.batch_col.value);
+        ncc->locals.batch_col.value = Send_Y_batch_col;
+        const int Send_Y_m_start = (disi_Y / (descY->mb - (2 * R)));
+        assert(&nc.locals[1].value == &ncc->locals.m_start.value);
+        ncc->locals.m_start.value = Send_Y_m_start;
+        const int Send_Y_m_end = (((disi_Y + size_row) - 1) / (descY->mb - (2 * R)));
+        assert(&nc.locals[2].value == &ncc->locals.m_end.value);
+        ncc->locals.m_end.value = Send_Y_m_end;
+        const int Send_Y_n_start = (disj_Y / (descY->nb - (2 * R)));
+        assert(&nc.locals[3].value == &ncc->locals.n_start.value);
+        ncc->locals.n_start.value = Send_Y_n_start;
+        const int Send_Y_n_end = (((disj_Y + size_col) - 1) / (descY->nb - (2 * R)));
+        assert(&nc.locals[4].value == &ncc->locals.n_end.value);
+        ncc->locals.n_end.value = Send_Y_n_end;
+        const int Send_Y_m = m;
+        if( (Send_Y_m >= (ncc->locals.m_start.value)) && (Send_Y_m <= (ncc->locals.m_end.value)) ) {
+          assert(&nc.locals[5].value == &ncc->locals.m.value);
+          ncc->locals.m.value = Send_Y_m;
+          const int Send_Y_n = n;
+          if( (Send_Y_n >= (redistribute_check_Send_Y_inline_c_expr8_line_52(__parsec_tp, &ncc->locals))) && (Send_Y_n <= (redistribute_check_Send_Y_inline_c_expr7_line_52(__parsec_tp, &ncc->locals))) ) {
+            assert(&nc.locals[6].value == &ncc->locals.n.value);
+            ncc->locals.n.value = Send_Y_n;
+#if defined(DISTRIBUTED)
+            rank_dst = rank_of_descY(ncc->locals.m.value, ncc->locals.n.value);
+            if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+              vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descY)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descY, ncc->locals.m.value, ncc->locals.n.value);
+            nc.priority = __parsec_tp->super.super.priority;
+            successor_repo = Send_Y_repo;
+            successor_repo_key = __jdf2c_make_key_Send_Y((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+          RELEASE_DEP_OUTPUT(es, "Y", this_task, "Y", &nc, rank_src, rank_dst, &data);
+          if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_redistribute_check_Get_Y_for_Y_dep1_atline_90, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+            }
+          }
+        }
+  }
+  }
+  /* Flow of data ctl has only IN dependencies */
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static int release_deps_of_redistribute_check_Get_Y(parsec_execution_stream_t *es, __parsec_redistribute_check_Get_Y_task_t *this_task, uint32_t action_mask, parsec_remote_deps_t *deps)
+{
+  PARSEC_PINS(es, RELEASE_DEPS_BEGIN, (parsec_task_t *)this_task);  const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp = (const __parsec_redistribute_check_internal_taskpool_t *)this_task->taskpool;
+  parsec_release_dep_fct_arg_t arg;
+  int __vp_id;
+  int consume_local_repo = 0;
+  arg.action_mask = action_mask;
+  arg.output_entry = NULL;
+  arg.output_repo = NULL;
+#if defined(DISTRIBUTED)
+  arg.remote_deps = deps;
+#endif  /* defined(DISTRIBUTED) */
+  assert(NULL != es);
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS )    arg.ready_lists = alloca(sizeof(parsec_task_t *) * es->virtual_process->parsec_context->nb_vp);
+  else
+    arg.ready_lists = NULL;
+  for( __vp_id = 0; __vp_id < es->virtual_process->parsec_context->nb_vp; arg.ready_lists[__vp_id++] = NULL );
+  (void)__parsec_tp; (void)deps;
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_Y.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_Y.source_repo, this_task->data._f_Y.source_repo_entry->ht_item.key );
+    }
+  }
+  consume_local_repo = (this_task->repo_entry != NULL);
+  arg.output_repo = Get_Y_repo;
+  arg.output_entry = this_task->repo_entry;
+  arg.output_usage = 0;
+  if( action_mask & (PARSEC_ACTION_RELEASE_LOCAL_DEPS | PARSEC_ACTION_GET_REPO_ENTRY) ) {
+    arg.output_entry = data_repo_lookup_entry_and_create( es, arg.output_repo, __jdf2c_make_key_Get_Y((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    arg.output_entry->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(arg.output_entry->sim_exec_date == 0);
+    arg.output_entry->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  if(action_mask & ( PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE ) ){
+    /* Generate the reshape promise for the outputs that need it */
+    iterate_successors_of_redistribute_check_Get_Y(es, this_task, action_mask, parsec_set_up_reshape_promise, &arg);
+   }
+  iterate_successors_of_redistribute_check_Get_Y(es, this_task, action_mask, parsec_release_dep_fct, &arg);
+
+#if defined(DISTRIBUTED)
+  if( (action_mask & PARSEC_ACTION_SEND_REMOTE_DEPS) && (NULL != arg.remote_deps)) {
+    parsec_remote_dep_activate(es, (parsec_task_t *)this_task, arg.remote_deps, arg.remote_deps->outgoing_mask);
+  }
+#endif
+
+  if(action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS) {
+    data_repo_entry_addto_usage_limit(Get_Y_repo, arg.output_entry->ht_item.key, arg.output_usage);
+    __parsec_schedule_vp(es, arg.ready_lists, 0);
+  }
+      if (consume_local_repo) {
+         data_repo_entry_used_once( Get_Y_repo, this_task->repo_entry->ht_item.key );
+      }
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_Y.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_Y.data_in);
+    }
+  }
+  PARSEC_PINS(es, RELEASE_DEPS_END, (parsec_task_t *)this_task);  return 0;
+}
+
+static int data_lookup_of_redistribute_check_Get_Y(parsec_execution_stream_t *es, __parsec_redistribute_check_Get_Y_task_t *this_task)
+{
+  const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_check_internal_taskpool_t *)this_task->taskpool;
+  parsec_assignment_t generic_locals[MAX_PARAM_COUNT];  /* generic task locals */
+  int target_device = 0; (void)target_device;
+  (void)__parsec_tp; (void)generic_locals; (void)es;
+  parsec_data_copy_t *chunk = NULL;
+  data_repo_t        *reshape_repo  = NULL, *consumed_repo  = NULL;
+  data_repo_entry_t  *reshape_entry = NULL, *consumed_entry = NULL;
+  parsec_key_t        reshape_entry_key = 0, consumed_entry_key = 0;
+  uint8_t             consumed_flow_index;
+  parsec_dep_data_description_t data;
+  int ret;
+  (void)reshape_repo; (void)reshape_entry; (void)reshape_entry_key;
+  (void)consumed_repo; (void)consumed_entry; (void)consumed_entry_key;
+  (void)consumed_flow_index;
+  (void)chunk; (void)data; (void)ret;
+  const int batch_col = this_task->locals.batch_col.value; (void)batch_col;
+  const int m_start = this_task->locals.m_start.value; (void)m_start;
+  const int m_end = this_task->locals.m_end.value; (void)m_end;
+  const int n_start = this_task->locals.n_start.value; (void)n_start;
+  const int n_end = this_task->locals.n_end.value; (void)n_end;
+  const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+  const int i_start = this_task->locals.i_start.value; (void)i_start;
+  const int i_end = this_task->locals.i_end.value; (void)i_end;
+  const int j_start = this_task->locals.j_start.value; (void)j_start;
+  const int j_end = this_task->locals.j_end.value; (void)j_end;
+  if( NULL == this_task->repo_entry ){
+    this_task->repo_entry = data_repo_lookup_entry_and_create(es, Get_Y_repo,                                       __jdf2c_make_key_Get_Y((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    data_repo_entry_addto_usage_limit(Get_Y_repo, this_task->repo_entry->ht_item.key, 1);    this_task->repo_entry ->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(this_task->repo_entry ->sim_exec_date == 0);
+    this_task->repo_entry ->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  /* The reshape repo is the current task repo. */  reshape_repo = Get_Y_repo;
+  reshape_entry_key = __jdf2c_make_key_Get_Y((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals) ;
+  reshape_entry = this_task->repo_entry;
+  /* Lookup the input data, and store them in the context if any */
+
+if(! this_task->data._f_Y.fulfill ){ /* Flow Y */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_Y.data_out = NULL;  /* input only */
+  /* Flow Y [0] dependency [0] from predecessor Send_Y */
+  if( NULL == (chunk = this_task->data._f_Y.data_in) ) {
+  /* No data set up by predecessor on this task input flow */
+__parsec_redistribute_check_Send_Y_parsec_assignment_t *target_locals = (__parsec_redistribute_check_Send_Y_parsec_assignment_t*)&generic_locals;
+  const int Send_Ybatch_col = target_locals->batch_col.value = batch_col; (void)Send_Ybatch_col;
+  const int Send_Ym_start = target_locals->m_start.value = (disi_Y / (descY->mb - (2 * R))); (void)Send_Ym_start;
+  const int Send_Ym_end = target_locals->m_end.value = (((disi_Y + size_row) - 1) / (descY->mb - (2 * R))); (void)Send_Ym_end;
+  const int Send_Yn_start = target_locals->n_start.value = (disj_Y / (descY->nb - (2 * R))); (void)Send_Yn_start;
+  const int Send_Yn_end = target_locals->n_end.value = (((disj_Y + size_col) - 1) / (descY->nb - (2 * R))); (void)Send_Yn_end;
+  const int Send_Ym = target_locals->m.value = m; (void)Send_Ym;
+  const int Send_Yn = target_locals->n.value = n; (void)Send_Yn;
+    if( (reshape_entry != NULL) && (reshape_entry->data[0] != NULL) ){
+        /* Reshape promise set up on this task repo by predecessor */
+        consumed_repo = reshape_repo;
+        consumed_entry = reshape_entry;
+        consumed_entry_key = reshape_entry_key;
+        consumed_flow_index = 0;
+    }else{
+        /* Consume from predecessor's repo */
+        consumed_repo = Send_Y_repo;
+        consumed_entry_key = __jdf2c_make_key_Send_Y((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)target_locals) ;
+        consumed_entry = data_repo_lookup_entry( consumed_repo, consumed_entry_key );
+        consumed_flow_index = 0;
+    }
+    data.data   = NULL;
+    data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+        data.local.arena  = PARSEC_redistribute_check_ORIGIN_ADT->arena;
+    data.local.src_datatype = PARSEC_redistribute_check_ORIGIN_ADT->opaque_dtt;
+    data.local.dst_datatype = PARSEC_redistribute_check_ORIGIN_ADT->opaque_dtt;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    ACQUIRE_FLOW(this_task, "Y", &redistribute_check_Send_Y, "Y", target_locals, chunk);
+    this_task->data._f_Y.data_out = chunk;
+  } 
+  else {
+    /* Data set up by predecessor on this task input flow */
+    consumed_repo = this_task->data._f_Y.source_repo;
+    consumed_entry = this_task->data._f_Y.source_repo_entry;
+    consumed_entry_key = this_task->data._f_Y.source_repo_entry->ht_item.key;
+    if( (reshape_entry != NULL) && (reshape_entry->data[0] != NULL) ){
+        /* Reshape promise set up on input by predecessor is on this task repo */
+        consumed_flow_index = 0;
+        assert( (this_task->data._f_Y.source_repo == reshape_repo)
+             && (this_task->data._f_Y.source_repo_entry == reshape_entry));
+    }else{
+        /* Reshape promise set up on input by predecessor is the predecesssor task repo */
+        consumed_flow_index = 0;
+    }
+    data.data   = NULL;
+    data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+        data.local.arena  = PARSEC_redistribute_check_ORIGIN_ADT->arena;
+    data.local.src_datatype = PARSEC_redistribute_check_ORIGIN_ADT->opaque_dtt;
+    data.local.dst_datatype = PARSEC_redistribute_check_ORIGIN_ADT->opaque_dtt;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    this_task->data._f_Y.data_out = parsec_data_get_copy(chunk->original, target_device);
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+    parsec_prof_grapher_data_input(chunk->original, (parsec_task_t*)this_task, &flow_of_redistribute_check_Get_Y_for_Y, 0);
+#endif
+  }
+    this_task->data._f_Y.data_in     = chunk;
+    this_task->data._f_Y.source_repo       = consumed_repo;
+    this_task->data._f_Y.source_repo_entry = consumed_entry;
+    if( this_task->data._f_Y.source_repo_entry == this_task->repo_entry ){
+      /* in case we have consume from this task repo entry for the flow,
+       * it is cleaned up, avoiding having old stuff during release_deps_of
+       */
+      this_task->repo_entry->data[0] = NULL;
+    }
+    this_task->data._f_Y.fulfill = 1;
+}
+
+  /* ctl is a control flow */
+  this_task->data._f_ctl.data_in         = NULL;
+  this_task->data._f_ctl.data_out        = NULL;
+  this_task->data._f_ctl.source_repo       = NULL;
+  this_task->data._f_ctl.source_repo_entry = NULL;
+  /** Generate profiling information */
+#if defined(PARSEC_PROF_TRACE)
+  this_task->prof_info.desc = (parsec_data_collection_t*)__parsec_tp->super._g_descY;
+  this_task->prof_info.priority = this_task->priority;
+  this_task->prof_info.data_id   = ((parsec_data_collection_t*)__parsec_tp->super._g_descY)->data_key((parsec_data_collection_t*)__parsec_tp->super._g_descY, 0, 0);
+  this_task->prof_info.task_class_id = this_task->task_class->task_class_id;
+  this_task->prof_info.task_return_code = -1;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int datatype_lookup_of_redistribute_check_Get_Y(parsec_execution_stream_t *es, const parsec_task_t *this_generic_task, const parsec_task_t *parent_task,
+              uint32_t* flow_mask, parsec_dep_data_description_t* data)
+{
+  const __parsec_redistribute_check_Get_Y_task_t *this_task = (__parsec_redistribute_check_Get_Y_task_t*)this_generic_task;
+  const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_check_internal_taskpool_t *)this_task->taskpool;
+  (void)__parsec_tp; (void)es; (void)this_task; (void)data; (void)parent_task;
+  const int batch_col = this_task->locals.batch_col.value; (void)batch_col;
+  const int m_start = this_task->locals.m_start.value; (void)m_start;
+  const int m_end = this_task->locals.m_end.value; (void)m_end;
+  const int n_start = this_task->locals.n_start.value; (void)n_start;
+  const int n_end = this_task->locals.n_end.value; (void)n_end;
+  const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+  const int i_start = this_task->locals.i_start.value; (void)i_start;
+  const int i_end = this_task->locals.i_end.value; (void)i_end;
+  const int j_start = this_task->locals.j_start.value; (void)j_start;
+  const int j_end = this_task->locals.j_end.value; (void)j_end;
+  data->local.arena = data->remote.arena = NULL;
+  data->local.src_datatype  = data->local.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->local.src_count     = data->local.dst_count = 0;
+  data->local.src_displ     = data->local.dst_displ = 0;
+  data->data_future  = NULL;
+  if( (*flow_mask) & 0x80000000U ) { /* these are the input dependencies remote datatypes  */
+if( (*flow_mask) & 0x1U ) {  /* Flow Y */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_redistribute_check_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_redistribute_check_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_redistribute_check_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+    goto no_mask_match;
+  }
+
+  /* these are the output dependencies remote datatypes */
+ no_mask_match:
+  data->data                             = NULL;
+  data->remote.src_datatype = data->remote.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->remote.src_count    = data->remote.dst_count = 0;
+  data->remote.src_displ    = data->remote.dst_displ = 0;
+  data->data_future  = NULL;
+  (*flow_mask) = 0;  /* nothing left */
+  (void)batch_col;  (void)m_start;  (void)m_end;  (void)n_start;  (void)n_end;  (void)m;  (void)n;  (void)i_start;  (void)i_end;  (void)j_start;  (void)j_end;
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+static int hook_of_redistribute_check_Get_Y(parsec_execution_stream_t *es, __parsec_redistribute_check_Get_Y_task_t *this_task)
+{
+  __parsec_redistribute_check_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_check_internal_taskpool_t *)this_task->taskpool;
+  (void)es; (void)__parsec_tp;
+  const int batch_col = this_task->locals.batch_col.value; (void)batch_col;
+  const int m_start = this_task->locals.m_start.value; (void)m_start;
+  const int m_end = this_task->locals.m_end.value; (void)m_end;
+  const int n_start = this_task->locals.n_start.value; (void)n_start;
+  const int n_end = this_task->locals.n_end.value; (void)n_end;
+  const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+  const int i_start = this_task->locals.i_start.value; (void)i_start;
+  const int i_end = this_task->locals.i_end.value; (void)i_end;
+  const int j_start = this_task->locals.j_start.value; (void)j_start;
+  const int j_end = this_task->locals.j_end.value; (void)j_end;
+  (void)batch_col;  (void)m_start;  (void)m_end;  (void)n_start;  (void)n_end;  (void)m;  (void)n;  (void)i_start;  (void)i_end;  (void)j_start;  (void)j_end;
+
+  /** Declare the variables that will hold the data, and all the accounting for each */
+  parsec_data_copy_t *_f_Y = this_task->data._f_Y.data_in;
+  void *Y = PARSEC_DATA_COPY_GET_PTR(_f_Y); (void)Y;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    data_repo_entry_t *eY = this_task->data._f_Y.source_repo_entry;
+    if( (NULL != eY) && (eY->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eY->sim_exec_date;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+  /** Cache Awareness Accounting */
+#if defined(PARSEC_CACHE_AWARENESS)
+  cache_buf_referenced(es->closest_cache, Y);
+#endif /* PARSEC_CACHE_AWARENESS */
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                                  Get_Y BODY                                  -----*/
+
+{
+    CORE_redistribute_dtd(Y_g, Y, descY->mb, descY->nb, m, n, m_start, m_end, n_start, n_end,
+                            i_start, i_end, j_start, j_end, size_row, size_row, size_col, R, 0, 0);
+}
+
+/*-----                              END OF Get_Y BODY                                -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#endif  /*  defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+static int complete_hook_of_redistribute_check_Get_Y(parsec_execution_stream_t *es, __parsec_redistribute_check_Get_Y_task_t *this_task)
+{
+  const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_check_internal_taskpool_t *)this_task->taskpool;
+#if defined(DISTRIBUTED)
+    const int batch_col = this_task->locals.batch_col.value; (void)batch_col;
+  const int m_start = this_task->locals.m_start.value; (void)m_start;
+  const int m_end = this_task->locals.m_end.value; (void)m_end;
+  const int n_start = this_task->locals.n_start.value; (void)n_start;
+  const int n_end = this_task->locals.n_end.value; (void)n_end;
+  const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+  const int i_start = this_task->locals.i_start.value; (void)i_start;
+  const int i_end = this_task->locals.i_end.value; (void)i_end;
+  const int j_start = this_task->locals.j_start.value; (void)j_start;
+  const int j_end = this_task->locals.j_end.value; (void)j_end;
+#endif  /* defined(DISTRIBUTED) */
+  (void)es; (void)__parsec_tp;
+parsec_data_t* data_t_desc = NULL; (void)data_t_desc;
+#if defined(DISTRIBUTED)
+  /** If not working on distributed, there is no risk that data is not in place */
+  (void)batch_col;  (void)m_start;  (void)m_end;  (void)n_start;  (void)n_end;  (void)m;  (void)n;  (void)i_start;  (void)i_end;  (void)j_start;  (void)j_end;
+
+#endif /* DISTRIBUTED */
+#if defined(PARSEC_PROF_GRAPHER)
+  parsec_prof_grapher_task((parsec_task_t*)this_task, es->th_id, es->virtual_process->vp_id,
+     __jdf2c_key_fns_Get_Y.key_hash(this_task->task_class->make_key( (parsec_taskpool_t*)this_task->taskpool, ((parsec_task_t*)this_task)->locals), NULL));
+#endif  /* defined(PARSEC_PROF_GRAPHER) */
+  release_deps_of_redistribute_check_Get_Y(es, this_task,
+      PARSEC_ACTION_RELEASE_REMOTE_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_REFS |
+      PARSEC_ACTION_RESHAPE_ON_RELEASE |
+      0x1,  /* mask of all dep_index */ 
+      NULL);
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static parsec_hook_return_t release_task_of_redistribute_check_Get_Y(parsec_execution_stream_t *es, parsec_task_t *this_task)
+{
+    const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp =
+        (const __parsec_redistribute_check_internal_taskpool_t *)this_task->taskpool;
+    parsec_hash_table_t *ht = (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[1];
+    parsec_key_t key = this_task->task_class->make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals);
+    parsec_hashable_dependency_t *hash_dep = (parsec_hashable_dependency_t *)parsec_hash_table_remove(ht, key);
+    parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);
+    return parsec_release_task_to_mempool_update_nbtasks(es, this_task);
+}
+
+static char *redistribute_check_redistribute_check_Get_Y_internal_init_deps_key_functions_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_redistribute_check_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_check_internal_taskpool_t *)user_data;
+  __parsec_redistribute_check_Get_Y_parsec_assignment_t __jdf2c__assignments = {  .batch_col.value = 0, .m_start.value = 0, .m_end.value = 0, .n_start.value = 0, .n_end.value = 0, .m.value = 0, .n.value = 0, .i_start.value = 0, .i_end.value = 0, .j_start.value = 0, .j_end.value = 0 };
+  int batch_col = (__parsec_key) % __parsec_tp->Get_Y_batch_col_range + __parsec_tp->Get_Y_batch_col_min;
+  __parsec_key = __parsec_key / __parsec_tp->Get_Y_batch_col_range;
+  __jdf2c__assignments.batch_col.value = batch_col;
+  int m_start = (disi_Y / (descY->mb - (2 * R)));
+  (void)m_start;
+  __jdf2c__assignments.m_start.value = m_start;
+  int m_end = (((disi_Y + size_row) - 1) / (descY->mb - (2 * R)));
+  (void)m_end;
+  __jdf2c__assignments.m_end.value = m_end;
+  int n_start = (disj_Y / (descY->nb - (2 * R)));
+  (void)n_start;
+  __jdf2c__assignments.n_start.value = n_start;
+  int n_end = (((disj_Y + size_col) - 1) / (descY->nb - (2 * R)));
+  (void)n_end;
+  __jdf2c__assignments.n_end.value = n_end;
+  int m = (__parsec_key) % __parsec_tp->Get_Y_m_range + __parsec_tp->Get_Y_m_min;
+  __parsec_key = __parsec_key / __parsec_tp->Get_Y_m_range;
+  __jdf2c__assignments.m.value = m;
+  int n = (__parsec_key) % __parsec_tp->Get_Y_n_range + __parsec_tp->Get_Y_n_min;
+  __parsec_key = __parsec_key / __parsec_tp->Get_Y_n_range;
+  __jdf2c__assignments.n.value = n;
+  int i_start = (disi_Y % (descY->mb - (2 * R)));
+  (void)i_start;
+  __jdf2c__assignments.i_start.value = i_start;
+  int i_end = (((disi_Y + size_row) - 1) % (descY->mb - (2 * R)));
+  (void)i_end;
+  __jdf2c__assignments.i_end.value = i_end;
+  int j_start = (disj_Y % (descY->nb - (2 * R)));
+  (void)j_start;
+  __jdf2c__assignments.j_start.value = j_start;
+  int j_end = (((disj_Y + size_col) - 1) % (descY->nb - (2 * R)));
+  (void)j_end;
+  __jdf2c__assignments.j_end.value = j_end;
+  (void)__jdf2c__assignments;
+  snprintf(buffer, buffer_size, "Get_Y(%d, %d, %d)", batch_col, m, n);
+  return buffer;
+}
+
+static parsec_key_fn_t redistribute_check_redistribute_check_Get_Y_internal_init_deps_key_functions = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = redistribute_check_redistribute_check_Get_Y_internal_init_deps_key_functions_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/* Needs: min-max count-tasks iterate */
+static int redistribute_check_Get_Y_internal_init(parsec_execution_stream_t * es, __parsec_redistribute_check_Get_Y_task_t * this_task)
+{
+  __parsec_redistribute_check_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_check_internal_taskpool_t*)this_task->taskpool;
+  int32_t nb_tasks = 0, saved_nb_tasks = 0;
+int32_t __batch_col_min = 0x7fffffff, __batch_col_max = 0;int32_t __jdf2c_batch_col_min = 0x7fffffff, __jdf2c_batch_col_max = 0;int32_t __m_min = 0x7fffffff, __m_max = 0;int32_t __jdf2c_m_min = 0x7fffffff, __jdf2c_m_max = 0;int32_t __n_min = 0x7fffffff, __n_max = 0;int32_t __jdf2c_n_min = 0x7fffffff, __jdf2c_n_max = 0;  __parsec_redistribute_check_Get_Y_parsec_assignment_t assignments = {  .batch_col.value = 0, .m_start.value = 0, .m_end.value = 0, .n_start.value = 0, .n_end.value = 0, .m.value = 0, .n.value = 0, .i_start.value = 0, .i_end.value = 0, .j_start.value = 0, .j_end.value = 0 };
+  int32_t  batch_col,  m_start,  m_end,  n_start,  n_end,  m,  n,  i_start,  i_end,  j_start,  j_end;
+  int32_t __jdf2c_batch_col_start, __jdf2c_batch_col_end, __jdf2c_batch_col_inc;
+  int32_t __jdf2c_m_start, __jdf2c_m_end, __jdf2c_m_inc;
+  int32_t __jdf2c_n_start, __jdf2c_n_end, __jdf2c_n_inc;
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+  PARSEC_PROFILING_TRACE(es->es_profile,
+                         this_task->taskpool->profiling_array[START_KEY(this_task->task_class->task_class_id)],
+                         0,
+                         this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    __jdf2c_batch_col_start = 0;
+    __jdf2c_batch_col_end = (NY - 1);
+    __jdf2c_batch_col_inc = 1;
+    __batch_col_min = parsec_imin(__jdf2c_batch_col_start, __jdf2c_batch_col_end);
+    __batch_col_max = parsec_imax(__jdf2c_batch_col_start, __jdf2c_batch_col_end);
+    __jdf2c_batch_col_min = parsec_imin(__jdf2c_batch_col_min, __batch_col_min);
+    __jdf2c_batch_col_max = parsec_imax(__jdf2c_batch_col_max, __batch_col_max);
+    for(batch_col =  __jdf2c_batch_col_start;
+        batch_col <= __jdf2c_batch_col_end;
+        batch_col += __jdf2c_batch_col_inc) {
+    assignments.batch_col.value = batch_col;
+  {  /* block for the non-range variable m_start */
+      m_start = (disi_Y / (descY->mb - (2 * R)));
+      assignments.m_start.value = m_start;
+    {  /* block for the non-range variable m_end */
+        m_end = (((disi_Y + size_row) - 1) / (descY->mb - (2 * R)));
+        assignments.m_end.value = m_end;
+      {  /* block for the non-range variable n_start */
+          n_start = (disj_Y / (descY->nb - (2 * R)));
+          assignments.n_start.value = n_start;
+        {  /* block for the non-range variable n_end */
+            n_end = (((disj_Y + size_col) - 1) / (descY->nb - (2 * R)));
+            assignments.n_end.value = n_end;
+              __jdf2c_m_start = m_start;
+              __jdf2c_m_end = m_end;
+              __jdf2c_m_inc = 1;
+              __m_min = parsec_imin(__jdf2c_m_start, __jdf2c_m_end);
+              __m_max = parsec_imax(__jdf2c_m_start, __jdf2c_m_end);
+              __jdf2c_m_min = parsec_imin(__jdf2c_m_min, __m_min);
+              __jdf2c_m_max = parsec_imax(__jdf2c_m_max, __m_max);
+              for(m =  __jdf2c_m_start;
+                  m <= __jdf2c_m_end;
+                  m += __jdf2c_m_inc) {
+              assignments.m.value = m;
+                __jdf2c_n_start = redistribute_check_Get_Y_inline_c_expr6_line_80(__parsec_tp, &assignments);
+                __jdf2c_n_end = redistribute_check_Get_Y_inline_c_expr5_line_80(__parsec_tp, &assignments);
+                __jdf2c_n_inc = 1;
+                __n_min = parsec_imin(__jdf2c_n_start, __jdf2c_n_end);
+                __n_max = parsec_imax(__jdf2c_n_start, __jdf2c_n_end);
+                __jdf2c_n_min = parsec_imin(__jdf2c_n_min, __n_min);
+                __jdf2c_n_max = parsec_imax(__jdf2c_n_max, __n_max);
+                for(n =  __jdf2c_n_start;
+                    n <= __jdf2c_n_end;
+                    n += __jdf2c_n_inc) {
+                assignments.n.value = n;
+              {  /* block for the non-range variable i_start */
+                  i_start = (disi_Y % (descY->mb - (2 * R)));
+                  assignments.i_start.value = i_start;
+                {  /* block for the non-range variable i_end */
+                    i_end = (((disi_Y + size_row) - 1) % (descY->mb - (2 * R)));
+                    assignments.i_end.value = i_end;
+                  {  /* block for the non-range variable j_start */
+                      j_start = (disj_Y % (descY->nb - (2 * R)));
+                      assignments.j_start.value = j_start;
+                    {  /* block for the non-range variable j_end */
+                        j_end = (((disj_Y + size_col) - 1) % (descY->nb - (2 * R)));
+                        assignments.j_end.value = j_end;
+                        if( !Get_Y_pred(batch_col, m_start, m_end, n_start, n_end, m, n, i_start, i_end, j_start, j_end) ) continue;
+                        nb_tasks++;
+                      } /* block for the non-range variable j_end */ 
+                    } /* block for the non-range variable j_start */ 
+                  } /* block for the non-range variable i_end */ 
+                } /* block for the non-range variable i_start */ 
+              } /* Loop on normal range n */
+            } /* For loop of m */ 
+          } /* Non-range variable n_end */ 
+        } /* Non-range variable n_start */ 
+      } /* Non-range variable m_end */ 
+    } /* Non-range variable m_start */ 
+  } /* For loop of batch_col */ 
+   if( 0 != nb_tasks ) {
+     (void)parsec_atomic_fetch_add_int32(&__parsec_tp->initial_number_tasks, nb_tasks);
+   }
+  /* Set the range variables for the collision-free hash-computation */
+  __parsec_tp->Get_Y_batch_col_min   = __jdf2c_batch_col_min;
+  __parsec_tp->Get_Y_batch_col_range = (__jdf2c_batch_col_max - __jdf2c_batch_col_min) + 1;
+  __parsec_tp->Get_Y_m_min   = __jdf2c_m_min;
+  __parsec_tp->Get_Y_m_range = (__jdf2c_m_max - __jdf2c_m_min) + 1;
+  __parsec_tp->Get_Y_n_min   = __jdf2c_n_min;
+  __parsec_tp->Get_Y_n_range = (__jdf2c_n_max - __jdf2c_n_min) + 1;
+  this_task->status = PARSEC_TASK_STATUS_COMPLETE;
+
+  PARSEC_AYU_REGISTER_TASK(&redistribute_check_Get_Y);
+  __parsec_tp->super.super.dependencies_array[1] = PARSEC_OBJ_NEW(parsec_hash_table_t);
+  parsec_hash_table_init(__parsec_tp->super.super.dependencies_array[1], offsetof(parsec_hashable_dependency_t, ht_item), 10, redistribute_check_redistribute_check_Get_Y_internal_init_deps_key_functions, this_task->taskpool);
+  __parsec_tp->repositories[1] = data_repo_create_nothreadsafe(nb_tasks, __jdf2c_key_fns_Get_Y, (parsec_taskpool_t*)__parsec_tp, 2);
+(void)saved_nb_tasks;
+(void)__batch_col_min; (void)__batch_col_max;(void)__m_min; (void)__m_max;(void)__n_min; (void)__n_max;  (void)__jdf2c_batch_col_start; (void)__jdf2c_batch_col_end; (void)__jdf2c_batch_col_inc;  (void)__jdf2c_m_start; (void)__jdf2c_m_end; (void)__jdf2c_m_inc;  (void)__jdf2c_n_start; (void)__jdf2c_n_end; (void)__jdf2c_n_inc;  (void)assignments; (void)__parsec_tp; (void)es;
+  if(1 == parsec_atomic_fetch_dec_int32(&__parsec_tp->sync_point)) {
+    /* Last initialization task complete. Update the number of tasks. */
+    __parsec_tp->super.super.tdm.module->taskpool_addto_nb_tasks(&__parsec_tp->super.super, __parsec_tp->initial_number_tasks);
+    parsec_mfence();  /* write memory barrier to guarantee that the scheduler gets the correct number of tasks */
+    parsec_taskpool_enable((parsec_taskpool_t*)__parsec_tp, &__parsec_tp->startup_queue,
+                           (parsec_task_t*)this_task, es, __parsec_tp->super.super.nb_pending_actions);
+    __parsec_tp->super.super.tdm.module->taskpool_ready(&__parsec_tp->super.super);
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+    PARSEC_PROFILING_TRACE(es->es_profile,
+                           this_task->taskpool->profiling_array[2 * this_task->task_class->task_class_id + 1],
+                           0,
+                           this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    return PARSEC_HOOK_RETURN_DONE;
+  }
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static const __parsec_chore_t __redistribute_check_Get_Y_chores[] ={
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+    { .type     = PARSEC_DEV_CPU,
+      .evaluate = (parsec_evaluate_function_t*)NULL,
+      .hook     = (parsec_hook_t*)hook_of_redistribute_check_Get_Y },
+#endif  /* defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+    { .type     = PARSEC_DEV_NONE,
+      .evaluate = NULL,
+      .hook     = (parsec_hook_t*)NULL },  /* End marker */
+};
+
+static const parsec_task_class_t redistribute_check_Get_Y = {
+  .name = "Get_Y",
+  .task_class_id = 1,
+  .nb_flows = 2,
+  .nb_parameters = 3,
+  .nb_locals = 11,
+  .task_class_type = PARSEC_TASK_CLASS_TYPE_PTG,
+  .params = { &symb_redistribute_check_Get_Y_m, &symb_redistribute_check_Get_Y_n, &symb_redistribute_check_Get_Y_batch_col, NULL },
+  .locals = { &symb_redistribute_check_Get_Y_batch_col, &symb_redistribute_check_Get_Y_m_start, &symb_redistribute_check_Get_Y_m_end, &symb_redistribute_check_Get_Y_n_start, &symb_redistribute_check_Get_Y_n_end, &symb_redistribute_check_Get_Y_m, &symb_redistribute_check_Get_Y_n, &symb_redistribute_check_Get_Y_i_start, &symb_redistribute_check_Get_Y_i_end, &symb_redistribute_check_Get_Y_j_start, &symb_redistribute_check_Get_Y_j_end, NULL },
+  .data_affinity = (parsec_data_ref_fn_t*)affinity_of_redistribute_check_Get_Y,
+  .initial_data = (parsec_data_ref_fn_t*)affinity_of_redistribute_check_Get_Y,
+  .final_data = (parsec_data_ref_fn_t*)affinity_of_redistribute_check_Get_Y,
+  .priority = NULL,
+  .properties = properties_of_redistribute_check_Get_Y,
+#if MAX_PARAM_COUNT < 1  /* number of read flows of Get_Y */
+  #error Too many read flows for task Get_Y
+#endif  /* MAX_PARAM_COUNT */
+#if MAX_PARAM_COUNT < 0  /* number of write flows of Get_Y */
+  #error Too many write flows for task Get_Y
+#endif  /* MAX_PARAM_COUNT */
+  .in = { &flow_of_redistribute_check_Get_Y_for_Y, NULL },
+  .out = { &flow_of_redistribute_check_Get_Y_for_ctl, NULL },
+  .flags = 0x0 | PARSEC_USE_DEPS_MASK,
+  .dependencies_goal = 0x1,
+  .make_key = __jdf2c_make_key_Get_Y,
+  .task_snprintf = parsec_task_snprintf,
+#if defined(PARSEC_PROF_TRACE)
+  .profile_info = &parsec_task_profile_info,
+#endif
+  .key_functions = &__jdf2c_key_fns_Get_Y,
+  .fini = (parsec_hook_t*)NULL,
+  .incarnations = __redistribute_check_Get_Y_chores,
+  .find_deps = parsec_hash_find_deps,
+  .update_deps = parsec_update_deps_with_mask,
+  .iterate_successors = (parsec_traverse_function_t*)iterate_successors_of_redistribute_check_Get_Y,
+  .iterate_predecessors = (parsec_traverse_function_t*)iterate_predecessors_of_redistribute_check_Get_Y,
+  .release_deps = (parsec_release_deps_t*)release_deps_of_redistribute_check_Get_Y,
+  .prepare_output = (parsec_hook_t*)NULL,
+  .prepare_input = (parsec_hook_t*)data_lookup_of_redistribute_check_Get_Y,
+  .time_estimate = NULL,
+  .get_datatype = datatype_lookup_of_redistribute_check_Get_Y,
+  .complete_execution = (parsec_hook_t*)complete_hook_of_redistribute_check_Get_Y,
+  .release_task = &release_task_of_redistribute_check_Get_Y,
+#if defined(PARSEC_SIM)
+  .sim_cost_fct = (parsec_sim_cost_fct_t*)NULL,
+#endif
+};
+
+
+/******                                    Send_Y                                    ******/
+
+static inline int32_t minexpr_of_symb_redistribute_check_Send_Y_batch_col_fct(const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_check_Send_Y_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_redistribute_check_Send_Y_batch_col = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_redistribute_check_Send_Y_batch_col_fct }
+                   }
+};
+static inline int maxexpr_of_symb_redistribute_check_Send_Y_batch_col_fct(const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_check_Send_Y_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_start = locals->m_start.value; (void)m_start;
+  const int m_end = locals->m_end.value; (void)m_end;
+  const int n_start = locals->n_start.value; (void)n_start;
+  const int n_end = locals->n_end.value; (void)n_end;
+  const int m = locals->m.value; (void)m;
+  const int n = locals->n.value; (void)n;
+
+  (void)batch_col;
+  (void)m_start;
+  (void)m_end;
+  (void)n_start;
+  (void)n_end;
+  (void)m;
+  (void)n;
+  (void)__parsec_tp; (void)locals;
+  return (NY - 1);
+}
+static const parsec_expr_t maxexpr_of_symb_redistribute_check_Send_Y_batch_col = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_redistribute_check_Send_Y_batch_col_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_check_Send_Y_batch_col = { .name = "batch_col", .context_index = 0, .min = &minexpr_of_symb_redistribute_check_Send_Y_batch_col, .max = &maxexpr_of_symb_redistribute_check_Send_Y_batch_col, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int expr_of_symb_redistribute_check_Send_Y_m_start_fct(const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_check_Send_Y_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_start = locals->m_start.value; (void)m_start;
+  const int m_end = locals->m_end.value; (void)m_end;
+  const int n_start = locals->n_start.value; (void)n_start;
+  const int n_end = locals->n_end.value; (void)n_end;
+  const int m = locals->m.value; (void)m;
+  const int n = locals->n.value; (void)n;
+
+  (void)batch_col;
+  (void)m_start;
+  (void)m_end;
+  (void)n_start;
+  (void)n_end;
+  (void)m;
+  (void)n;
+  (void)__parsec_tp; (void)locals;
+  return (disi_Y / (descY->mb - (2 * R)));
+}
+static const parsec_expr_t expr_of_symb_redistribute_check_Send_Y_m_start = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_check_Send_Y_m_start_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_check_Send_Y_m_start = { .name = "m_start", .context_index = 1, .min = &expr_of_symb_redistribute_check_Send_Y_m_start, .max = &expr_of_symb_redistribute_check_Send_Y_m_start, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int expr_of_symb_redistribute_check_Send_Y_m_end_fct(const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_check_Send_Y_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_start = locals->m_start.value; (void)m_start;
+  const int m_end = locals->m_end.value; (void)m_end;
+  const int n_start = locals->n_start.value; (void)n_start;
+  const int n_end = locals->n_end.value; (void)n_end;
+  const int m = locals->m.value; (void)m;
+  const int n = locals->n.value; (void)n;
+
+  (void)batch_col;
+  (void)m_start;
+  (void)m_end;
+  (void)n_start;
+  (void)n_end;
+  (void)m;
+  (void)n;
+  (void)__parsec_tp; (void)locals;
+  return (((disi_Y + size_row) - 1) / (descY->mb - (2 * R)));
+}
+static const parsec_expr_t expr_of_symb_redistribute_check_Send_Y_m_end = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_check_Send_Y_m_end_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_check_Send_Y_m_end = { .name = "m_end", .context_index = 2, .min = &expr_of_symb_redistribute_check_Send_Y_m_end, .max = &expr_of_symb_redistribute_check_Send_Y_m_end, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int expr_of_symb_redistribute_check_Send_Y_n_start_fct(const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_check_Send_Y_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_start = locals->m_start.value; (void)m_start;
+  const int m_end = locals->m_end.value; (void)m_end;
+  const int n_start = locals->n_start.value; (void)n_start;
+  const int n_end = locals->n_end.value; (void)n_end;
+  const int m = locals->m.value; (void)m;
+  const int n = locals->n.value; (void)n;
+
+  (void)batch_col;
+  (void)m_start;
+  (void)m_end;
+  (void)n_start;
+  (void)n_end;
+  (void)m;
+  (void)n;
+  (void)__parsec_tp; (void)locals;
+  return (disj_Y / (descY->nb - (2 * R)));
+}
+static const parsec_expr_t expr_of_symb_redistribute_check_Send_Y_n_start = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_check_Send_Y_n_start_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_check_Send_Y_n_start = { .name = "n_start", .context_index = 3, .min = &expr_of_symb_redistribute_check_Send_Y_n_start, .max = &expr_of_symb_redistribute_check_Send_Y_n_start, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int expr_of_symb_redistribute_check_Send_Y_n_end_fct(const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_check_Send_Y_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_start = locals->m_start.value; (void)m_start;
+  const int m_end = locals->m_end.value; (void)m_end;
+  const int n_start = locals->n_start.value; (void)n_start;
+  const int n_end = locals->n_end.value; (void)n_end;
+  const int m = locals->m.value; (void)m;
+  const int n = locals->n.value; (void)n;
+
+  (void)batch_col;
+  (void)m_start;
+  (void)m_end;
+  (void)n_start;
+  (void)n_end;
+  (void)m;
+  (void)n;
+  (void)__parsec_tp; (void)locals;
+  return (((disj_Y + size_col) - 1) / (descY->nb - (2 * R)));
+}
+static const parsec_expr_t expr_of_symb_redistribute_check_Send_Y_n_end = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_check_Send_Y_n_end_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_check_Send_Y_n_end = { .name = "n_end", .context_index = 4, .min = &expr_of_symb_redistribute_check_Send_Y_n_end, .max = &expr_of_symb_redistribute_check_Send_Y_n_end, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int minexpr_of_symb_redistribute_check_Send_Y_m_fct(const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_check_Send_Y_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_start = locals->m_start.value;
+  const int m_end = locals->m_end.value; (void)m_end;
+  const int n_start = locals->n_start.value; (void)n_start;
+  const int n_end = locals->n_end.value; (void)n_end;
+  const int m = locals->m.value; (void)m;
+  const int n = locals->n.value; (void)n;
+
+  (void)batch_col;
+  (void)m_start;
+  (void)m_end;
+  (void)n_start;
+  (void)n_end;
+  (void)m;
+  (void)n;
+  (void)__parsec_tp; (void)locals;
+  return m_start;
+}
+static const parsec_expr_t minexpr_of_symb_redistribute_check_Send_Y_m = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_redistribute_check_Send_Y_m_fct }
+                   }
+};
+static inline int maxexpr_of_symb_redistribute_check_Send_Y_m_fct(const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_check_Send_Y_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_start = locals->m_start.value; (void)m_start;
+  const int m_end = locals->m_end.value;
+  const int n_start = locals->n_start.value; (void)n_start;
+  const int n_end = locals->n_end.value; (void)n_end;
+  const int m = locals->m.value; (void)m;
+  const int n = locals->n.value; (void)n;
+
+  (void)batch_col;
+  (void)m_start;
+  (void)m_end;
+  (void)n_start;
+  (void)n_end;
+  (void)m;
+  (void)n;
+  (void)__parsec_tp; (void)locals;
+  return m_end;
+}
+static const parsec_expr_t maxexpr_of_symb_redistribute_check_Send_Y_m = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_redistribute_check_Send_Y_m_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_check_Send_Y_m = { .name = "m", .context_index = 5, .min = &minexpr_of_symb_redistribute_check_Send_Y_m, .max = &maxexpr_of_symb_redistribute_check_Send_Y_m, .cst_inc = 1, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t minexpr_of_symb_redistribute_check_Send_Y_n_fct(const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_check_Send_Y_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_check_Send_Y_inline_c_expr8_line_52(__parsec_tp, locals);
+}
+static const parsec_expr_t minexpr_of_symb_redistribute_check_Send_Y_n = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_redistribute_check_Send_Y_n_fct }
+                   }
+};
+static inline int32_t maxexpr_of_symb_redistribute_check_Send_Y_n_fct(const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_check_Send_Y_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_check_Send_Y_inline_c_expr7_line_52(__parsec_tp, locals);
+}
+static const parsec_expr_t maxexpr_of_symb_redistribute_check_Send_Y_n = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_redistribute_check_Send_Y_n_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_check_Send_Y_n = { .name = "n", .context_index = 6, .min = &minexpr_of_symb_redistribute_check_Send_Y_n, .max = &maxexpr_of_symb_redistribute_check_Send_Y_n, .cst_inc = 1, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int affinity_of_redistribute_check_Send_Y(const __parsec_redistribute_check_Send_Y_task_t *this_task,
+                     parsec_data_ref_t *ref)
+{
+    const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp = (const __parsec_redistribute_check_internal_taskpool_t*)this_task->taskpool;
+  const int batch_col = this_task->locals.batch_col.value; (void)batch_col;
+  const int m_start = this_task->locals.m_start.value; (void)m_start;
+  const int m_end = this_task->locals.m_end.value; (void)m_end;
+  const int n_start = this_task->locals.n_start.value; (void)n_start;
+  const int n_end = this_task->locals.n_end.value; (void)n_end;
+  const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+
+  /* Silent Warnings: should look into predicate to know what variables are usefull */
+  (void)batch_col;
+  (void)m_start;
+  (void)m_end;
+  (void)n_start;
+  (void)n_end;
+  (void)m;
+  (void)n;
+  ref->dc = (parsec_data_collection_t *)__parsec_tp->super._g_descY;
+  /* Compute data key */
+  ref->key = ref->dc->data_key(ref->dc, m, n);
+  return 1;
+}
+static const parsec_property_t properties_of_redistribute_check_Send_Y[1] = {
+  {.name = NULL, .expr = NULL}
+};
+static parsec_data_t *flow_of_redistribute_check_Send_Y_for_Y_dep1_atline_56_direct_access(const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_check_Send_Y_parsec_assignment_t *assignments)
+{
+  const int batch_col = assignments->batch_col.value; (void)batch_col;
+  const int m_start = assignments->m_start.value; (void)m_start;
+  const int m_end = assignments->m_end.value; (void)m_end;
+  const int n_start = assignments->n_start.value; (void)n_start;
+  const int n_end = assignments->n_end.value; (void)n_end;
+  const int m = assignments->m.value; (void)m;
+  const int n = assignments->n.value; (void)n;
+
+  /* Silence Warnings: should look into parameters to know what variables are useful */
+  (void)batch_col;
+  (void)m_start;
+  (void)m_end;
+  (void)n_start;
+  (void)n_end;
+  (void)m;
+  (void)n;
+  if( __parsec_tp->super.super.context->my_rank == (int32_t)rank_of_descY(m, n) )
+    return data_of_descY(m, n);
+  return NULL;
+}
+
+static const parsec_dep_t flow_of_redistribute_check_Send_Y_for_Y_dep1_atline_56 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = PARSEC_LOCAL_DATA_TASK_CLASS_ID, /* redistribute_check_descY */
+  .direct_data = (parsec_data_lookup_func_t)&flow_of_redistribute_check_Send_Y_for_Y_dep1_atline_56_direct_access,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_redistribute_check_Send_Y_for_Y,
+};
+static const parsec_dep_t flow_of_redistribute_check_Send_Y_for_Y_dep2_atline_57 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 1, /* redistribute_check_Get_Y */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_redistribute_check_Get_Y_for_Y,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_redistribute_check_Send_Y_for_Y,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+#if MAX_DEP_OUT_COUNT < 1  /* number of output dependencies */
+    #error Too many output dependencies (supports up to MAX_DEP_OUT_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_OUT_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_redistribute_check_Send_Y_for_Y = {
+  .name               = "Y",
+  .sym_type           = PARSEC_SYM_INOUT,
+  .flow_flags         = PARSEC_FLOW_ACCESS_READ|PARSEC_FLOW_HAS_IN_DEPS,
+  .flow_index         = 0,
+  .flow_datatype_mask = 0x1,
+  .dep_in     = { &flow_of_redistribute_check_Send_Y_for_Y_dep1_atline_56 },
+  .dep_out    = { &flow_of_redistribute_check_Send_Y_for_Y_dep2_atline_57 }
+};
+
+static inline int expr_of_cond_for_flow_of_redistribute_check_Send_Y_for_ctl_dep1_atline_59_fct(const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_check_Send_Y_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value;
+  const int m_start = locals->m_start.value; (void)m_start;
+  const int m_end = locals->m_end.value; (void)m_end;
+  const int n_start = locals->n_start.value; (void)n_start;
+  const int n_end = locals->n_end.value; (void)n_end;
+  const int m = locals->m.value; (void)m;
+  const int n = locals->n.value; (void)n;
+
+  (void)batch_col;
+  (void)m_start;
+  (void)m_end;
+  (void)n_start;
+  (void)n_end;
+  (void)m;
+  (void)n;
+  (void)__parsec_tp; (void)locals;
+  return (batch_col) > (0);
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_redistribute_check_Send_Y_for_ctl_dep1_atline_59 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_redistribute_check_Send_Y_for_ctl_dep1_atline_59_fct }
+                   }
+};
+static const parsec_dep_t flow_of_redistribute_check_Send_Y_for_ctl_dep1_atline_59 = {
+  .cond = &expr_of_cond_for_flow_of_redistribute_check_Send_Y_for_ctl_dep1_atline_59,  /* (batch_col) > (0) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 1, /* redistribute_check_Get_Y */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_redistribute_check_Get_Y_for_ctl,
+  .dep_index = 1,
+  .dep_datatype_index = 1,
+  .belongs_to = &flow_of_redistribute_check_Send_Y_for_ctl,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_redistribute_check_Send_Y_for_ctl = {
+  .name               = "ctl",
+  .sym_type           = PARSEC_SYM_IN,
+  .flow_flags         = PARSEC_FLOW_ACCESS_NONE|PARSEC_FLOW_HAS_IN_DEPS,
+  .flow_index         = 1,
+  .flow_datatype_mask = 0x0,
+  .dep_in     = { &flow_of_redistribute_check_Send_Y_for_ctl_dep1_atline_59 },
+  .dep_out    = { NULL }
+};
+
+static void
+iterate_successors_of_redistribute_check_Send_Y(parsec_execution_stream_t *es, const __parsec_redistribute_check_Send_Y_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp = (const __parsec_redistribute_check_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_redistribute_check_Send_Y_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_redistribute_check_Send_Y_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int batch_col = __jdf2c__tmp_locals.batch_col.value; (void)batch_col;
+  const int m_start = __jdf2c__tmp_locals.m_start.value; (void)m_start;
+  const int m_end = __jdf2c__tmp_locals.m_end.value; (void)m_end;
+  const int n_start = __jdf2c__tmp_locals.n_start.value; (void)n_start;
+  const int n_end = __jdf2c__tmp_locals.n_end.value; (void)n_end;
+  const int m = __jdf2c__tmp_locals.m.value; (void)m;
+  const int n = __jdf2c__tmp_locals.n.value; (void)n;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)batch_col;  (void)m_start;  (void)m_end;  (void)n_start;  (void)n_end;  (void)m;  (void)n;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_descY(m, n);
+#endif
+  if( action_mask & 0x1 ) {  /* Flow of data Y [0] */
+    data.data   = this_task->data._f_Y.data_out;
+    data.data_future  = NULL;
+    if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_redistribute_check_ORIGIN_ADT->arena;
+    data.local.src_datatype = PARSEC_redistribute_check_ORIGIN_ADT->opaque_dtt;
+    data.local.dst_datatype = PARSEC_redistribute_check_ORIGIN_ADT->opaque_dtt;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_redistribute_check_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+       __parsec_redistribute_check_Get_Y_task_t* ncc = (__parsec_redistribute_check_Get_Y_task_t*)&nc;
+    nc.task_class = __parsec_tp->super.super.task_classes_array[redistribute_check_Get_Y.task_class_id];
+      const int Get_Y_batch_col = batch_col;
+      if( (Get_Y_batch_col >= (0)) && (Get_Y_batch_col <= ((NY - 1))) ) {
+        assert(&nc.locals[0].value == &ncc->locals.batch_col.value);
+        ncc->locals.batch_col.value = Get_Y_batch_col;
+        const int Get_Y_m_start = (disi_Y / (descY->mb - (2 * R)));
+        assert(&nc.locals[1].value == &ncc->locals.m_start.value);
+        ncc->locals.m_start.value = Get_Y_m_start;
+        const int Get_Y_m_end = (((disi_Y + size_row) - 1) / (descY->mb - (2 * R)));
+        assert(&nc.locals[2].value == &ncc->locals.m_end.value);
+        ncc->locals.m_end.value = Get_Y_m_end;
+        const int Get_Y_n_start = (disj_Y / (descY->nb - (2 * R)));
+        assert(&nc.locals[3].value == &ncc->locals.n_start.value);
+        ncc->locals.n_start.value = Get_Y_n_start;
+        const int Get_Y_n_end = (((disj_Y + size_col) - 1) / (descY->nb - (2 * R)));
+        assert(&nc.locals[4].value == &ncc->locals.n_end.value);
+        ncc->locals.n_end.value = Get_Y_n_end;
+        const int Get_Y_m = m;
+        if( (Get_Y_m >= (ncc->locals.m_start.value)) && (Get_Y_m <= (ncc->locals.m_end.value)) ) {
+          assert(&nc.locals[5].value == &ncc->locals.m.value);
+          ncc->locals.m.value = Get_Y_m;
+          const int Get_Y_n = n;
+          if( (Get_Y_n >= (redistribute_check_Get_Y_inline_c_expr6_line_80(__parsec_tp, &ncc->locals))) && (Get_Y_n <= (redistribute_check_Get_Y_inline_c_expr5_line_80(__parsec_tp, &ncc->locals))) ) {
+            assert(&nc.locals[6].value == &ncc->locals.n.value);
+            ncc->locals.n.value = Get_Y_n;
+            const int Get_Y_i_start = (disi_Y % (descY->mb - (2 * R)));
+            assert(&nc.locals[7].value == &ncc->locals.i_start.value);
+            ncc->locals.i_start.value = Get_Y_i_start;
+            const int Get_Y_i_end = (((disi_Y + size_row) - 1) % (descY->mb - (2 * R)));
+            assert(&nc.locals[8].value == &ncc->locals.i_end.value);
+            ncc->locals.i_end.value = Get_Y_i_end;
+            const int Get_Y_j_start = (disj_Y % (descY->nb - (2 * R)));
+            assert(&nc.locals[9].value == &ncc->locals.j_start.value);
+            ncc->locals.j_start.value = Get_Y_j_start;
+            const int Get_Y_j_end = (((disj_Y + size_col) - 1) % (descY->nb - (2 * R)));
+            assert(&nc.locals[10].value == &ncc->locals.j_end.value);
+            ncc->locals.j_end.value = Get_Y_j_end;
+#if defined(DISTRIBUTED)
+            rank_dst = rank_of_descY(0, 0);
+            if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+              vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descY)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descY, 0, 0);
+            nc.priority = __parsec_tp->super.super.priority;
+            successor_repo = Get_Y_repo;
+            successor_repo_key = __jdf2c_make_key_Get_Y((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+          RELEASE_DEP_OUTPUT(es, "Y", this_task, "Y", &nc, rank_src, rank_dst, &data);
+          if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_redistribute_check_Send_Y_for_Y_dep2_atline_57, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+            }
+          }
+        }
+  }
+  /* Flow of data ctl has only IN dependencies */
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static void
+iterate_predecessors_of_redistribute_check_Send_Y(parsec_execution_stream_t *es, const __parsec_redistribute_check_Send_Y_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp = (const __parsec_redistribute_check_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_redistribute_check_Send_Y_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_redistribute_check_Send_Y_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int batch_col = __jdf2c__tmp_locals.batch_col.value; (void)batch_col;
+  const int m_start = __jdf2c__tmp_locals.m_start.value; (void)m_start;
+  const int m_end = __jdf2c__tmp_locals.m_end.value; (void)m_end;
+  const int n_start = __jdf2c__tmp_locals.n_start.value; (void)n_start;
+  const int n_end = __jdf2c__tmp_locals.n_end.value; (void)n_end;
+  const int m = __jdf2c__tmp_locals.m.value; (void)m;
+  const int n = __jdf2c__tmp_locals.n.value; (void)n;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)batch_col;  (void)m_start;  (void)m_end;  (void)n_start;  (void)n_end;  (void)m;  (void)n;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_descY(m, n);
+#endif
+  /* Flow of data Y has only OUTPUT dependencies to Memory */
+  if( action_mask & 0x2 ) {  /* Flow of data ctl [1] */
+    data.data   = this_task->data._f_ctl.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x2 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  =   /* Control: always empty */ 0;
+    data.local.dst_count  =   /* Control: always empty */ 0;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = NULL;
+    data.remote.src_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.src_count  =   /* Control: always empty */ 0;
+    data.remote.dst_count  =   /* Control: always empty */ 0;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( (batch_col) > (0) ) {
+      __parsec_redistribute_check_Get_Y_task_t* ncc = (__parsec_redistribute_check_Get_Y_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[redistribute_check_Get_Y.task_class_id];
+        const int Get_Y_batch_col = (batch_col - 1);
+        if( (Get_Y_batch_col >= (0)) && (Get_Y_batch_col <= ((NY - 1))) ) {
+          assert(&nc.locals[0].value == &ncc->locals.batch_col.value);
+          ncc->locals.batch_col.value = Get_Y_batch_col;
+          const int Get_Y_m_start = (disi_Y / (descY->mb - (2 * R)));
+          assert(&nc.locals[1].value == &ncc->locals.m_start.value);
+          ncc->locals.m_start.value = Get_Y_m_start;
+          const int Get_Y_m_end = (((disi_Y + size_row) - 1) / (descY->mb - (2 * R)));
+          assert(&nc.locals[2].value == &ncc->locals.m_end.value);
+          ncc->locals.m_end.value = Get_Y_m_end;
+          const int Get_Y_n_start = (disj_Y / (descY->nb - (2 * R)));
+          assert(&nc.locals[3].value == &ncc->locals.n_start.value);
+          ncc->locals.n_start.value = Get_Y_n_start;
+          const int Get_Y_n_end = (((disj_Y + size_col) - 1) / (descY->nb - (2 * R)));
+          assert(&nc.locals[4].value == &ncc->locals.n_end.value);
+          ncc->locals.n_end.value = Get_Y_n_end;
+          const int Get_Y_m = m;
+          if( (Get_Y_m >= (ncc->locals.m_start.value)) && (Get_Y_m <= (ncc->locals.m_end.value)) ) {
+            assert(&nc.locals[5].value == &ncc->locals.m.value);
+            ncc->locals.m.value = Get_Y_m;
+            const int Get_Y_n = (n - num_col_Y);
+            if( (Get_Y_n >= (redistribute_check_Get_Y_inline_c_expr6_line_80(__parsec_tp, &ncc->locals))) && (Get_Y_n <= (redistribute_check_Get_Y_inline_c_expr5_line_80(__parsec_tp, &ncc->locals))) ) {
+              assert(&nc.locals[6].value == &ncc->locals.n.value);
+              ncc->locals.n.value = Get_Y_n;
+              const int Get_Y_i_start = (disi_Y % (descY->mb - (2 * R)));
+              assert(&nc.locals[7].value == &ncc->locals.i_start.value);
+              ncc->locals.i_start.value = Get_Y_i_start;
+              const int Get_Y_i_end = (((disi_Y + size_row) - 1) % (descY->mb - (2 * R)));
+              assert(&nc.locals[8].value == &ncc->locals.i_end.value);
+              ncc->locals.i_end.value = Get_Y_i_end;
+              const int Get_Y_j_start = (disj_Y % (descY->nb - (2 * R)));
+              assert(&nc.locals[9].value == &ncc->locals.j_start.value);
+              ncc->locals.j_start.value = Get_Y_j_start;
+              const int Get_Y_j_end = (((disj_Y + size_col) - 1) % (descY->nb - (2 * R)));
+              assert(&nc.locals[10].value == &ncc->locals.j_end.value);
+              ncc->locals.j_end.value = Get_Y_j_end;
+#if defined(DISTRIBUTED)
+              rank_dst = rank_of_descY(0, 0);
+              if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+                vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descY)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descY, 0, 0);
+              nc.priority = __parsec_tp->super.super.priority;
+              successor_repo = Get_Y_repo;
+              successor_repo_key = __jdf2c_make_key_Get_Y((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+            RELEASE_DEP_OUTPUT(es, "ctl", this_task, "ctl", &nc, rank_src, rank_dst, &data);
+            if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_redistribute_check_Send_Y_for_ctl_dep1_atline_59, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+              }
+            }
+          }
+    }
+  }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static int release_deps_of_redistribute_check_Send_Y(parsec_execution_stream_t *es, __parsec_redistribute_check_Send_Y_task_t *this_task, uint32_t action_mask, parsec_remote_deps_t *deps)
+{
+  PARSEC_PINS(es, RELEASE_DEPS_BEGIN, (parsec_task_t *)this_task);  const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp = (const __parsec_redistribute_check_internal_taskpool_t *)this_task->taskpool;
+  parsec_release_dep_fct_arg_t arg;
+  int __vp_id;
+  int consume_local_repo = 0;
+  arg.action_mask = action_mask;
+  arg.output_entry = NULL;
+  arg.output_repo = NULL;
+#if defined(DISTRIBUTED)
+  arg.remote_deps = deps;
+#endif  /* defined(DISTRIBUTED) */
+  assert(NULL != es);
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS )    arg.ready_lists = alloca(sizeof(parsec_task_t *) * es->virtual_process->parsec_context->nb_vp);
+  else
+    arg.ready_lists = NULL;
+  for( __vp_id = 0; __vp_id < es->virtual_process->parsec_context->nb_vp; arg.ready_lists[__vp_id++] = NULL );
+  (void)__parsec_tp; (void)deps;
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_Y.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_Y.source_repo, this_task->data._f_Y.source_repo_entry->ht_item.key );
+    }
+  }
+  consume_local_repo = (this_task->repo_entry != NULL);
+  arg.output_repo = Send_Y_repo;
+  arg.output_entry = this_task->repo_entry;
+  arg.output_usage = 0;
+  if( action_mask & (PARSEC_ACTION_RELEASE_LOCAL_DEPS | PARSEC_ACTION_GET_REPO_ENTRY) ) {
+    arg.output_entry = data_repo_lookup_entry_and_create( es, arg.output_repo, __jdf2c_make_key_Send_Y((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    arg.output_entry->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(arg.output_entry->sim_exec_date == 0);
+    arg.output_entry->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  if(action_mask & ( PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE ) ){
+    /* Generate the reshape promise for the outputs that need it */
+    iterate_successors_of_redistribute_check_Send_Y(es, this_task, action_mask, parsec_set_up_reshape_promise, &arg);
+   }
+  iterate_successors_of_redistribute_check_Send_Y(es, this_task, action_mask, parsec_release_dep_fct, &arg);
+
+#if defined(DISTRIBUTED)
+  if( (action_mask & PARSEC_ACTION_SEND_REMOTE_DEPS) && (NULL != arg.remote_deps)) {
+    parsec_remote_dep_activate(es, (parsec_task_t *)this_task, arg.remote_deps, arg.remote_deps->outgoing_mask);
+  }
+#endif
+
+  if(action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS) {
+    data_repo_entry_addto_usage_limit(Send_Y_repo, arg.output_entry->ht_item.key, arg.output_usage);
+    __parsec_schedule_vp(es, arg.ready_lists, 0);
+  }
+      if (consume_local_repo) {
+         data_repo_entry_used_once( Send_Y_repo, this_task->repo_entry->ht_item.key );
+      }
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_Y.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_Y.data_in);
+    }
+  }
+  PARSEC_PINS(es, RELEASE_DEPS_END, (parsec_task_t *)this_task);  return 0;
+}
+
+static int data_lookup_of_redistribute_check_Send_Y(parsec_execution_stream_t *es, __parsec_redistribute_check_Send_Y_task_t *this_task)
+{
+  const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_check_internal_taskpool_t *)this_task->taskpool;
+  parsec_assignment_t generic_locals[MAX_PARAM_COUNT];  /* generic task locals */
+  int target_device = 0; (void)target_device;
+  (void)__parsec_tp; (void)generic_locals; (void)es;
+  parsec_data_copy_t *chunk = NULL;
+  data_repo_t        *reshape_repo  = NULL, *consumed_repo  = NULL;
+  data_repo_entry_t  *reshape_entry = NULL, *consumed_entry = NULL;
+  parsec_key_t        reshape_entry_key = 0, consumed_entry_key = 0;
+  uint8_t             consumed_flow_index;
+  parsec_dep_data_description_t data;
+  int ret;
+  (void)reshape_repo; (void)reshape_entry; (void)reshape_entry_key;
+  (void)consumed_repo; (void)consumed_entry; (void)consumed_entry_key;
+  (void)consumed_flow_index;
+  (void)chunk; (void)data; (void)ret;
+  const int batch_col = this_task->locals.batch_col.value; (void)batch_col;
+  const int m_start = this_task->locals.m_start.value; (void)m_start;
+  const int m_end = this_task->locals.m_end.value; (void)m_end;
+  const int n_start = this_task->locals.n_start.value; (void)n_start;
+  const int n_end = this_task->locals.n_end.value; (void)n_end;
+  const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+  if( NULL == this_task->repo_entry ){
+    this_task->repo_entry = data_repo_lookup_entry_and_create(es, Send_Y_repo,                                       __jdf2c_make_key_Send_Y((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    data_repo_entry_addto_usage_limit(Send_Y_repo, this_task->repo_entry->ht_item.key, 1);    this_task->repo_entry ->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(this_task->repo_entry ->sim_exec_date == 0);
+    this_task->repo_entry ->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  /* The reshape repo is the current task repo. */  reshape_repo = Send_Y_repo;
+  reshape_entry_key = __jdf2c_make_key_Send_Y((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals) ;
+  reshape_entry = this_task->repo_entry;
+  /* Lookup the input data, and store them in the context if any */
+
+if(! this_task->data._f_Y.fulfill ){ /* Flow Y */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_Y.data_out = NULL;  /* By default, if nothing matches */
+  /* Flow Y [0] dependency [0] from memory descY */
+  if( NULL == (chunk = this_task->data._f_Y.data_in) ) {
+  /* No data set up by predecessor on this task input flow */
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+  parsec_prof_grapher_data_input(data_of_descY(m, n), (parsec_task_t*)this_task, &flow_of_redistribute_check_Send_Y_for_Y, 1);
+#endif
+    chunk = parsec_data_get_copy(data_of_descY(m, n), target_device);
+    data.data = chunk;
+    data.data_future  = NULL;
+        data.local.arena  = PARSEC_redistribute_check_ORIGIN_ADT->arena;
+    data.local.src_datatype = data.data->dtt;
+    data.local.dst_datatype = PARSEC_redistribute_check_ORIGIN_ADT->opaque_dtt;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.data_future   = NULL;
+    if( (ret = parsec_get_copy_reshape_from_desc(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    this_task->data._f_Y.data_out = chunk;
+    PARSEC_OBJ_RETAIN(chunk);
+  } 
+    this_task->data._f_Y.data_in     = chunk;
+    this_task->data._f_Y.source_repo       = consumed_repo;
+    this_task->data._f_Y.source_repo_entry = consumed_entry;
+    if( this_task->data._f_Y.source_repo_entry == this_task->repo_entry ){
+      /* in case we have consume from this task repo entry for the flow,
+       * it is cleaned up, avoiding having old stuff during release_deps_of
+       */
+      this_task->repo_entry->data[0] = NULL;
+    }
+    this_task->data._f_Y.fulfill = 1;
+}
+
+  /* ctl is a control flow */
+  this_task->data._f_ctl.data_in         = NULL;
+  this_task->data._f_ctl.data_out        = NULL;
+  this_task->data._f_ctl.source_repo       = NULL;
+  this_task->data._f_ctl.source_repo_entry = NULL;
+  /** Generate profiling information */
+#if defined(PARSEC_PROF_TRACE)
+  this_task->prof_info.desc = (parsec_data_collection_t*)__parsec_tp->super._g_descY;
+  this_task->prof_info.priority = this_task->priority;
+  this_task->prof_info.data_id   = ((parsec_data_collection_t*)__parsec_tp->super._g_descY)->data_key((parsec_data_collection_t*)__parsec_tp->super._g_descY, m, n);
+  this_task->prof_info.task_class_id = this_task->task_class->task_class_id;
+  this_task->prof_info.task_return_code = -1;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int datatype_lookup_of_redistribute_check_Send_Y(parsec_execution_stream_t *es, const parsec_task_t *this_generic_task, const parsec_task_t *parent_task,
+              uint32_t* flow_mask, parsec_dep_data_description_t* data)
+{
+  const __parsec_redistribute_check_Send_Y_task_t *this_task = (__parsec_redistribute_check_Send_Y_task_t*)this_generic_task;
+  const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_check_internal_taskpool_t *)this_task->taskpool;
+  (void)__parsec_tp; (void)es; (void)this_task; (void)data; (void)parent_task;
+  const int batch_col = this_task->locals.batch_col.value; (void)batch_col;
+  const int m_start = this_task->locals.m_start.value; (void)m_start;
+  const int m_end = this_task->locals.m_end.value; (void)m_end;
+  const int n_start = this_task->locals.n_start.value; (void)n_start;
+  const int n_end = this_task->locals.n_end.value; (void)n_end;
+  const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+  data->local.arena = data->remote.arena = NULL;
+  data->local.src_datatype  = data->local.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->local.src_count     = data->local.dst_count = 0;
+  data->local.src_displ     = data->local.dst_displ = 0;
+  data->data_future  = NULL;
+  if( (*flow_mask) & 0x80000000U ) { /* these are the input dependencies remote datatypes  */
+if( (*flow_mask) & 0x1U ) {  /* Flow Y */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_redistribute_check_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_redistribute_check_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_redistribute_check_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+    goto no_mask_match;
+  }
+
+  /* these are the output dependencies remote datatypes */
+if( (*flow_mask) & 0x1U ) {  /* Flow Y */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_redistribute_check_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_redistribute_check_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_redistribute_check_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+ no_mask_match:
+  data->data                             = NULL;
+  data->remote.src_datatype = data->remote.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->remote.src_count    = data->remote.dst_count = 0;
+  data->remote.src_displ    = data->remote.dst_displ = 0;
+  data->data_future  = NULL;
+  (*flow_mask) = 0;  /* nothing left */
+  (void)batch_col;  (void)m_start;  (void)m_end;  (void)n_start;  (void)n_end;  (void)m;  (void)n;
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+static int hook_of_redistribute_check_Send_Y(parsec_execution_stream_t *es, __parsec_redistribute_check_Send_Y_task_t *this_task)
+{
+  __parsec_redistribute_check_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_check_internal_taskpool_t *)this_task->taskpool;
+  (void)es; (void)__parsec_tp;
+  const int batch_col = this_task->locals.batch_col.value; (void)batch_col;
+  const int m_start = this_task->locals.m_start.value; (void)m_start;
+  const int m_end = this_task->locals.m_end.value; (void)m_end;
+  const int n_start = this_task->locals.n_start.value; (void)n_start;
+  const int n_end = this_task->locals.n_end.value; (void)n_end;
+  const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+  (void)batch_col;  (void)m_start;  (void)m_end;  (void)n_start;  (void)n_end;  (void)m;  (void)n;
+
+  /** Declare the variables that will hold the data, and all the accounting for each */
+  parsec_data_copy_t *_f_Y = this_task->data._f_Y.data_in;
+  void *Y = PARSEC_DATA_COPY_GET_PTR(_f_Y); (void)Y;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    data_repo_entry_t *eY = this_task->data._f_Y.source_repo_entry;
+    if( (NULL != eY) && (eY->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eY->sim_exec_date;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+  /** Cache Awareness Accounting */
+#if defined(PARSEC_CACHE_AWARENESS)
+  cache_buf_referenced(es->closest_cache, Y);
+#endif /* PARSEC_CACHE_AWARENESS */
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                                  Send_Y BODY                                  -----*/
+
+{
+}
+
+/*-----                              END OF Send_Y BODY                              -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#endif  /*  defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+static int complete_hook_of_redistribute_check_Send_Y(parsec_execution_stream_t *es, __parsec_redistribute_check_Send_Y_task_t *this_task)
+{
+  const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_check_internal_taskpool_t *)this_task->taskpool;
+#if defined(DISTRIBUTED)
+    const int batch_col = this_task->locals.batch_col.value; (void)batch_col;
+  const int m_start = this_task->locals.m_start.value; (void)m_start;
+  const int m_end = this_task->locals.m_end.value; (void)m_end;
+  const int n_start = this_task->locals.n_start.value; (void)n_start;
+  const int n_end = this_task->locals.n_end.value; (void)n_end;
+  const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+#endif  /* defined(DISTRIBUTED) */
+  (void)es; (void)__parsec_tp;
+parsec_data_t* data_t_desc = NULL; (void)data_t_desc;
+#if defined(DISTRIBUTED)
+  /** If not working on distributed, there is no risk that data is not in place */
+  (void)batch_col;  (void)m_start;  (void)m_end;  (void)n_start;  (void)n_end;  (void)m;  (void)n;
+
+#endif /* DISTRIBUTED */
+#if defined(PARSEC_PROF_GRAPHER)
+  parsec_prof_grapher_task((parsec_task_t*)this_task, es->th_id, es->virtual_process->vp_id,
+     __jdf2c_key_fns_Send_Y.key_hash(this_task->task_class->make_key( (parsec_taskpool_t*)this_task->taskpool, ((parsec_task_t*)this_task)->locals), NULL));
+#endif  /* defined(PARSEC_PROF_GRAPHER) */
+  release_deps_of_redistribute_check_Send_Y(es, this_task,
+      PARSEC_ACTION_RELEASE_REMOTE_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_REFS |
+      PARSEC_ACTION_RESHAPE_ON_RELEASE |
+      0x1,  /* mask of all dep_index */ 
+      NULL);
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static parsec_hook_return_t release_task_of_redistribute_check_Send_Y(parsec_execution_stream_t *es, parsec_task_t *this_task)
+{
+    const __parsec_redistribute_check_internal_taskpool_t *__parsec_tp =
+        (const __parsec_redistribute_check_internal_taskpool_t *)this_task->taskpool;
+    parsec_hash_table_t *ht = (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[0];
+    parsec_key_t key = this_task->task_class->make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals);
+    parsec_hashable_dependency_t *hash_dep = (parsec_hashable_dependency_t *)parsec_hash_table_remove(ht, key);
+    parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);
+    return parsec_release_task_to_mempool_update_nbtasks(es, this_task);
+}
+
+static char *redistribute_check_redistribute_check_Send_Y_internal_init_deps_key_functions_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_redistribute_check_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_check_internal_taskpool_t *)user_data;
+  __parsec_redistribute_check_Send_Y_parsec_assignment_t __jdf2c__assignments = {  .batch_col.value = 0, .m_start.value = 0, .m_end.value = 0, .n_start.value = 0, .n_end.value = 0, .m.value = 0, .n.value = 0 };
+  int batch_col = (__parsec_key) % __parsec_tp->Send_Y_batch_col_range + __parsec_tp->Send_Y_batch_col_min;
+  __parsec_key = __parsec_key / __parsec_tp->Send_Y_batch_col_range;
+  __jdf2c__assignments.batch_col.value = batch_col;
+  int m_start = (disi_Y / (descY->mb - (2 * R)));
+  (void)m_start;
+  __jdf2c__assignments.m_start.value = m_start;
+  int m_end = (((disi_Y + size_row) - 1) / (descY->mb - (2 * R)));
+  (void)m_end;
+  __jdf2c__assignments.m_end.value = m_end;
+  int n_start = (disj_Y / (descY->nb - (2 * R)));
+  (void)n_start;
+  __jdf2c__assignments.n_start.value = n_start;
+  int n_end = (((disj_Y + size_col) - 1) / (descY->nb - (2 * R)));
+  (void)n_end;
+  __jdf2c__assignments.n_end.value = n_end;
+  int m = (__parsec_key) % __parsec_tp->Send_Y_m_range + __parsec_tp->Send_Y_m_min;
+  __parsec_key = __parsec_key / __parsec_tp->Send_Y_m_range;
+  __jdf2c__assignments.m.value = m;
+  int n = (__parsec_key) % __parsec_tp->Send_Y_n_range + __parsec_tp->Send_Y_n_min;
+  __parsec_key = __parsec_key / __parsec_tp->Send_Y_n_range;
+  __jdf2c__assignments.n.value = n;
+  (void)__jdf2c__assignments;
+  snprintf(buffer, buffer_size, "Send_Y(%d, %d, %d)", batch_col, m, n);
+  return buffer;
+}
+
+static parsec_key_fn_t redistribute_check_redistribute_check_Send_Y_internal_init_deps_key_functions = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = redistribute_check_redistribute_check_Send_Y_internal_init_deps_key_functions_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/* Needs: min-max count-tasks iterate */
+static int redistribute_check_Send_Y_internal_init(parsec_execution_stream_t * es, __parsec_redistribute_check_Send_Y_task_t * this_task)
+{
+  __parsec_redistribute_check_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_check_internal_taskpool_t*)this_task->taskpool;
+  int32_t nb_tasks = 0, saved_nb_tasks = 0;
+int32_t __batch_col_min = 0x7fffffff, __batch_col_max = 0;int32_t __jdf2c_batch_col_min = 0x7fffffff, __jdf2c_batch_col_max = 0;int32_t __m_min = 0x7fffffff, __m_max = 0;int32_t __jdf2c_m_min = 0x7fffffff, __jdf2c_m_max = 0;int32_t __n_min = 0x7fffffff, __n_max = 0;int32_t __jdf2c_n_min = 0x7fffffff, __jdf2c_n_max = 0;  __parsec_redistribute_check_Send_Y_parsec_assignment_t assignments = {  .batch_col.value = 0, .m_start.value = 0, .m_end.value = 0, .n_start.value = 0, .n_end.value = 0, .m.value = 0, .n.value = 0 };
+  int32_t  batch_col,  m_start,  m_end,  n_start,  n_end,  m,  n;
+  int32_t __jdf2c_batch_col_start, __jdf2c_batch_col_end, __jdf2c_batch_col_inc;
+  int32_t __jdf2c_m_start, __jdf2c_m_end, __jdf2c_m_inc;
+  int32_t __jdf2c_n_start, __jdf2c_n_end, __jdf2c_n_inc;
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+  PARSEC_PROFILING_TRACE(es->es_profile,
+                         this_task->taskpool->profiling_array[START_KEY(this_task->task_class->task_class_id)],
+                         0,
+                         this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    __jdf2c_batch_col_start = 0;
+    __jdf2c_batch_col_end = (NY - 1);
+    __jdf2c_batch_col_inc = 1;
+    __batch_col_min = parsec_imin(__jdf2c_batch_col_start, __jdf2c_batch_col_end);
+    __batch_col_max = parsec_imax(__jdf2c_batch_col_start, __jdf2c_batch_col_end);
+    __jdf2c_batch_col_min = parsec_imin(__jdf2c_batch_col_min, __batch_col_min);
+    __jdf2c_batch_col_max = parsec_imax(__jdf2c_batch_col_max, __batch_col_max);
+    for(batch_col =  __jdf2c_batch_col_start;
+        batch_col <= __jdf2c_batch_col_end;
+        batch_col += __jdf2c_batch_col_inc) {
+    assignments.batch_col.value = batch_col;
+  {  /* block for the non-range variable m_start */
+      m_start = (disi_Y / (descY->mb - (2 * R)));
+      assignments.m_start.value = m_start;
+    {  /* block for the non-range variable m_end */
+        m_end = (((disi_Y + size_row) - 1) / (descY->mb - (2 * R)));
+        assignments.m_end.value = m_end;
+      {  /* block for the non-range variable n_start */
+          n_start = (disj_Y / (descY->nb - (2 * R)));
+          assignments.n_start.value = n_start;
+        {  /* block for the non-range variable n_end */
+            n_end = (((disj_Y + size_col) - 1) / (descY->nb - (2 * R)));
+            assignments.n_end.value = n_end;
+              __jdf2c_m_start = m_start;
+              __jdf2c_m_end = m_end;
+              __jdf2c_m_inc = 1;
+              __m_min = parsec_imin(__jdf2c_m_start, __jdf2c_m_end);
+              __m_max = parsec_imax(__jdf2c_m_start, __jdf2c_m_end);
+              __jdf2c_m_min = parsec_imin(__jdf2c_m_min, __m_min);
+              __jdf2c_m_max = parsec_imax(__jdf2c_m_max, __m_max);
+              for(m =  __jdf2c_m_start;
+                  m <= __jdf2c_m_end;
+                  m += __jdf2c_m_inc) {
+              assignments.m.value = m;
+                __jdf2c_n_start = redistribute_check_Send_Y_inline_c_expr8_line_52(__parsec_tp, &assignments);
+                __jdf2c_n_end = redistribute_check_Send_Y_inline_c_expr7_line_52(__parsec_tp, &assignments);
+                __jdf2c_n_inc = 1;
+                __n_min = parsec_imin(__jdf2c_n_start, __jdf2c_n_end);
+                __n_max = parsec_imax(__jdf2c_n_start, __jdf2c_n_end);
+                __jdf2c_n_min = parsec_imin(__jdf2c_n_min, __n_min);
+                __jdf2c_n_max = parsec_imax(__jdf2c_n_max, __n_max);
+                for(n =  __jdf2c_n_start;
+                    n <= __jdf2c_n_end;
+                    n += __jdf2c_n_inc) {
+                assignments.n.value = n;
+                if( !Send_Y_pred(batch_col, m_start, m_end, n_start, n_end, m, n) ) continue;
+                nb_tasks++;
+              } /* Loop on normal range n */
+            } /* For loop of m */ 
+          } /* Non-range variable n_end */ 
+        } /* Non-range variable n_start */ 
+      } /* Non-range variable m_end */ 
+    } /* Non-range variable m_start */ 
+  } /* For loop of batch_col */ 
+   if( 0 != nb_tasks ) {
+     (void)parsec_atomic_fetch_add_int32(&__parsec_tp->initial_number_tasks, nb_tasks);
+   }
+  /* Set the range variables for the collision-free hash-computation */
+  __parsec_tp->Send_Y_batch_col_min   = __jdf2c_batch_col_min;
+  __parsec_tp->Send_Y_batch_col_range = (__jdf2c_batch_col_max - __jdf2c_batch_col_min) + 1;
+  __parsec_tp->Send_Y_m_min   = __jdf2c_m_min;
+  __parsec_tp->Send_Y_m_range = (__jdf2c_m_max - __jdf2c_m_min) + 1;
+  __parsec_tp->Send_Y_n_min   = __jdf2c_n_min;
+  __parsec_tp->Send_Y_n_range = (__jdf2c_n_max - __jdf2c_n_min) + 1;
+    do {
+      this_task->super.list_next = (parsec_list_item_t*)__parsec_tp->startup_queue;
+    } while(!parsec_atomic_cas_ptr(&__parsec_tp->startup_queue, (parsec_list_item_t*)this_task->super.list_next, this_task));
+    this_task->status = PARSEC_TASK_STATUS_HOOK;
+
+  PARSEC_AYU_REGISTER_TASK(&redistribute_check_Send_Y);
+  __parsec_tp->super.super.dependencies_array[0] = PARSEC_OBJ_NEW(parsec_hash_table_t);
+  parsec_hash_table_init(__parsec_tp->super.super.dependencies_array[0], offsetof(parsec_hashable_dependency_t, ht_item), 10, redistribute_check_redistribute_check_Send_Y_internal_init_deps_key_functions, this_task->taskpool);
+  __parsec_tp->repositories[0] = data_repo_create_nothreadsafe(nb_tasks, __jdf2c_key_fns_Send_Y, (parsec_taskpool_t*)__parsec_tp, 2);
+(void)saved_nb_tasks;
+(void)__batch_col_min; (void)__batch_col_max;(void)__m_min; (void)__m_max;(void)__n_min; (void)__n_max;  (void)__jdf2c_batch_col_start; (void)__jdf2c_batch_col_end; (void)__jdf2c_batch_col_inc;  (void)__jdf2c_m_start; (void)__jdf2c_m_end; (void)__jdf2c_m_inc;  (void)__jdf2c_n_start; (void)__jdf2c_n_end; (void)__jdf2c_n_inc;  (void)assignments; (void)__parsec_tp; (void)es;
+  if(1 == parsec_atomic_fetch_dec_int32(&__parsec_tp->sync_point)) {
+    /* Last initialization task complete. Update the number of tasks. */
+    __parsec_tp->super.super.tdm.module->taskpool_addto_nb_tasks(&__parsec_tp->super.super, __parsec_tp->initial_number_tasks);
+    parsec_mfence();  /* write memory barrier to guarantee that the scheduler gets the correct number of tasks */
+    parsec_taskpool_enable((parsec_taskpool_t*)__parsec_tp, &__parsec_tp->startup_queue,
+                           (parsec_task_t*)this_task, es, __parsec_tp->super.super.nb_pending_actions);
+    __parsec_tp->super.super.tdm.module->taskpool_ready(&__parsec_tp->super.super);
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+    PARSEC_PROFILING_TRACE(es->es_profile,
+                           this_task->taskpool->profiling_array[2 * this_task->task_class->task_class_id + 1],
+                           0,
+                           this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    if( 1 >= __parsec_tp->super.super.nb_pending_actions ) {
+        /* if no tasks will be generated let's prevent the runtime from calling the hook and instead go directly to complete the task */
+        this_task->status = PARSEC_TASK_STATUS_COMPLETE;
+    }
+    return PARSEC_HOOK_RETURN_DONE;
+  }
+  return PARSEC_HOOK_RETURN_ASYNC;
+}
+
+static int __jdf2c_startup_Send_Y(parsec_execution_stream_t * es, __parsec_redistribute_check_Send_Y_task_t *this_task)
+{
+  __parsec_redistribute_check_Send_Y_task_t* new_task;
+  __parsec_redistribute_check_internal_taskpool_t* __parsec_tp = (__parsec_redistribute_check_internal_taskpool_t*)this_task->taskpool;
+  parsec_context_t *context = __parsec_tp->super.super.context;
+  int vpid = 0, nb_tasks = 0;
+  size_t total_nb_tasks = 0;
+  parsec_list_item_t* pready_ring[context->nb_vp];
+  int restore_context = 0;
+  int batch_col = this_task->locals.batch_col.value;  /* retrieve value saved during the last iteration */
+  int m_start = this_task->locals.m_start.value;  /* retrieve value saved during the last iteration */
+  int m_end = this_task->locals.m_end.value;  /* retrieve value saved during the last iteration */
+  int n_start = this_task->locals.n_start.value;  /* retrieve value saved during the last iteration */
+  int n_end = this_task->locals.n_end.value;  /* retrieve value saved during the last iteration */
+  int m = this_task->locals.m.value;  /* retrieve value saved during the last iteration */
+  int n = this_task->locals.n.value;  /* retrieve value saved during the last iteration */
+  for(int _i = 0; _i < context->nb_vp; pready_ring[_i++] = NULL );
+  if( 0 != this_task->locals.reserved[0].value ) {
+    this_task->locals.reserved[0].value = 1; /* reset the submission process */
+    restore_context = 1;
+    goto restore_context_0;
+  }
+  this_task->locals.reserved[0].value = 1; /* a sane default value */
+  for(this_task->locals.batch_col.value = batch_col = 0;
+      this_task->locals.batch_col.value <= (NY - 1);
+      this_task->locals.batch_col.value += 1, batch_col = this_task->locals.batch_col.value) {
+    this_task->locals.m_start.value = m_start = (disi_Y / (descY->mb - (2 * R)));
+    this_task->locals.m_end.value = m_end = (((disi_Y + size_row) - 1) / (descY->mb - (2 * R)));
+    this_task->locals.n_start.value = n_start = (disj_Y / (descY->nb - (2 * R)));
+    this_task->locals.n_end.value = n_end = (((disj_Y + size_col) - 1) / (descY->nb - (2 * R)));
+    for(this_task->locals.m.value = m = m_start;
+        this_task->locals.m.value <= m_end;
+        this_task->locals.m.value += 1, m = this_task->locals.m.value) {
+      for(this_task->locals.n.value = n = redistribute_check_Send_Y_inline_c_expr8_line_52(__parsec_tp, &this_task->locals);
+          this_task->locals.n.value <= redistribute_check_Send_Y_inline_c_expr7_line_52(__parsec_tp, &this_task->locals);
+          this_task->locals.n.value += 1, n = this_task->locals.n.value) {
+        if( !Send_Y_pred(batch_col, m_start, m_end, n_start, n_end, m, n) ) continue;
+  __parsec_redistribute_check_Send_Y_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_redistribute_check_Send_Y_parsec_assignment_t*)&this_task->locals;
+  (void)__jdf2c__tmp_locals;
+  /* Flow for Y is always a memory reference */
+  if( (batch_col) > (0) ) continue; /* ctl Get_Y() is not a memory reference for flow ctl */
+        if( NULL != ((parsec_data_collection_t*)__parsec_tp->super._g_descY)->vpid_of ) {
+          vpid = ((parsec_data_collection_t*)__parsec_tp->super._g_descY)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descY, m, n);
+          assert(context->nb_vp >= vpid);
+        } else {
+          vpid = (vpid + 1) % context->nb_vp;  /* spread the initial joy */
+        }
+        new_task = (__parsec_redistribute_check_Send_Y_task_t*)parsec_thread_mempool_allocate( context->virtual_processes[vpid]->execution_streams[0]->context_mempool );
+        PARSEC_OBJ_CONSTRUCT(new_task, parsec_task_t); /* construct called only when new, force-construct it again */
+        /* Copy only the valid elements from this_task to new_task one */
+        new_task->taskpool   = this_task->taskpool;
+        new_task->task_class = __parsec_tp->super.super.task_classes_array[redistribute_check_Send_Y.task_class_id];
+        new_task->chore_mask   = PARSEC_DEV_ALL;
+        new_task->locals.batch_col.value = this_task->locals.batch_col.value;
+        new_task->locals.m_start.value = this_task->locals.m_start.value;
+        new_task->locals.m_end.value = this_task->locals.m_end.value;
+        new_task->locals.n_start.value = this_task->locals.n_start.value;
+        new_task->locals.n_end.value = this_task->locals.n_end.value;
+        new_task->locals.m.value = this_task->locals.m.value;
+        new_task->locals.n.value = this_task->locals.n.value;
+        PARSEC_LIST_ITEM_SINGLETON(new_task);
+        new_task->priority = __parsec_tp->super.super.priority;
+        new_task->repo_entry = NULL;
+        new_task->data._f_Y.source_repo_entry = NULL;
+        new_task->data._f_Y.source_repo       = NULL;
+        new_task->data._f_Y.data_in         = NULL;
+        new_task->data._f_Y.data_out        = NULL;
+        new_task->data._f_Y.fulfill         = 0;
+        new_task->data._f_ctl.source_repo_entry = NULL;
+        new_task->data._f_ctl.source_repo       = NULL;
+        new_task->data._f_ctl.data_in         = NULL;
+        new_task->data._f_ctl.data_out        = NULL;
+        new_task->data._f_ctl.fulfill         = 0;
+#if defined(PARSEC_DEBUG_NOISIER)
+        {
+          char tmp[128];
+          PARSEC_DEBUG_VERBOSE(10, parsec_debug_output, "Add startup task %s to vpid %d",
+                 parsec_task_snprintf(tmp, 128, (parsec_task_t*)new_task), vpid);
+        }
+#endif
+        parsec_dependencies_mark_task_as_startup((parsec_task_t*)new_task, es);
+        pready_ring[vpid] = parsec_list_item_ring_push_sorted(pready_ring[vpid],
+                                                              (parsec_list_item_t*)new_task,
+                                                              parsec_execution_context_priority_comparator);
+        nb_tasks++;
+       restore_context_0:  /* we jump here just so that we have code after the label */
+        restore_context = 0;
+        (void)restore_context;
+        if( nb_tasks > this_task->locals.reserved[0].value ) {
+          if( (size_t)this_task->locals.reserved[0].value < parsec_task_startup_iter ) this_task->locals.reserved[0].value <<= 1;
+          __parsec_schedule_vp(es, (parsec_task_t**)pready_ring, 0);
+          total_nb_tasks += nb_tasks;
+          nb_tasks = 0;
+          if( total_nb_tasks > parsec_task_startup_chunk ) {  /* stop here and request to be rescheduled */
+            return PARSEC_HOOK_RETURN_AGAIN;
+          }
+        }
+      } /* Loop on normal range n */
+    } /* Loop on normal range m */
+  } /* Loop on normal range batch_col */
+  (void)vpid;
+  if( 0 != nb_tasks ) {
+    __parsec_schedule_vp(es, (parsec_task_t**)pready_ring, 0);
+    nb_tasks = 0;
+  }
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static const __parsec_chore_t __redistribute_check_Send_Y_chores[] ={
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+    { .type     = PARSEC_DEV_CPU,
+      .evaluate = (parsec_evaluate_function_t*)NULL,
+      .hook     = (parsec_hook_t*)hook_of_redistribute_check_Send_Y },
+#endif  /* defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+    { .type     = PARSEC_DEV_NONE,
+      .evaluate = NULL,
+      .hook     = (parsec_hook_t*)NULL },  /* End marker */
+};
+
+static const parsec_task_class_t redistribute_check_Send_Y = {
+  .name = "Send_Y",
+  .task_class_id = 0,
+  .nb_flows = 2,
+  .nb_parameters = 3,
+  .nb_locals = 7,
+  .task_class_type = PARSEC_TASK_CLASS_TYPE_PTG,
+  .params = { &symb_redistribute_check_Send_Y_m, &symb_redistribute_check_Send_Y_n, &symb_redistribute_check_Send_Y_batch_col, NULL },
+  .locals = { &symb_redistribute_check_Send_Y_batch_col, &symb_redistribute_check_Send_Y_m_start, &symb_redistribute_check_Send_Y_m_end, &symb_redistribute_check_Send_Y_n_start, &symb_redistribute_check_Send_Y_n_end, &symb_redistribute_check_Send_Y_m, &symb_redistribute_check_Send_Y_n, NULL },
+  .data_affinity = (parsec_data_ref_fn_t*)affinity_of_redistribute_check_Send_Y,
+  .initial_data = (parsec_data_ref_fn_t*)affinity_of_redistribute_check_Send_Y,
+  .final_data = (parsec_data_ref_fn_t*)affinity_of_redistribute_check_Send_Y,
+  .priority = NULL,
+  .properties = properties_of_redistribute_check_Send_Y,
+#if MAX_PARAM_COUNT < 1  /* number of read flows of Send_Y */
+  #error Too many read flows for task Send_Y
+#endif  /* MAX_PARAM_COUNT */
+#if MAX_PARAM_COUNT < 0  /* number of write flows of Send_Y */
+  #error Too many write flows for task Send_Y
+#endif  /* MAX_PARAM_COUNT */
+  .in = { &flow_of_redistribute_check_Send_Y_for_Y, &flow_of_redistribute_check_Send_Y_for_ctl, NULL },
+  .out = { &flow_of_redistribute_check_Send_Y_for_Y, NULL },
+  .flags = 0x0 | PARSEC_HAS_IN_IN_DEPENDENCIES | PARSEC_USE_DEPS_MASK,
+  .dependencies_goal = 0x3,
+  .make_key = __jdf2c_make_key_Send_Y,
+  .task_snprintf = parsec_task_snprintf,
+#if defined(PARSEC_PROF_TRACE)
+  .profile_info = &parsec_task_profile_info,
+#endif
+  .key_functions = &__jdf2c_key_fns_Send_Y,
+  .fini = (parsec_hook_t*)NULL,
+  .incarnations = __redistribute_check_Send_Y_chores,
+  .find_deps = parsec_hash_find_deps,
+  .update_deps = parsec_update_deps_with_mask,
+  .iterate_successors = (parsec_traverse_function_t*)iterate_successors_of_redistribute_check_Send_Y,
+  .iterate_predecessors = (parsec_traverse_function_t*)iterate_predecessors_of_redistribute_check_Send_Y,
+  .release_deps = (parsec_release_deps_t*)release_deps_of_redistribute_check_Send_Y,
+  .prepare_output = (parsec_hook_t*)NULL,
+  .prepare_input = (parsec_hook_t*)data_lookup_of_redistribute_check_Send_Y,
+  .time_estimate = NULL,
+  .get_datatype = datatype_lookup_of_redistribute_check_Send_Y,
+  .complete_execution = (parsec_hook_t*)complete_hook_of_redistribute_check_Send_Y,
+  .release_task = &release_task_of_redistribute_check_Send_Y,
+#if defined(PARSEC_SIM)
+  .sim_cost_fct = (parsec_sim_cost_fct_t*)NULL,
+#endif
+};
+
+
+static const parsec_task_class_t *redistribute_check_task_classes[] = {
+  &redistribute_check_Send_Y,
+  &redistribute_check_Get_Y,
+  &redistribute_check_Send_T,
+  &redistribute_check_Get_T
+};
+
+static void redistribute_check_startup(parsec_context_t *context, __parsec_redistribute_check_internal_taskpool_t *__parsec_tp, parsec_list_item_t ** ready_tasks)
+{
+  uint32_t i, supported_dev = 0;
+ 
+  for( i = 0; i < parsec_nb_devices; i++ ) {
+    if( !(__parsec_tp->super.super.devices_index_mask & (1<<i)) ) continue;
+    parsec_device_module_t* device = parsec_mca_device_get(i);
+    parsec_data_collection_t* parsec_dc;
+ 
+    if(NULL == device) continue;
+    if(NULL != device->taskpool_register)
+      if( PARSEC_SUCCESS != device->taskpool_register(device, (parsec_taskpool_t*)__parsec_tp) ) {
+        parsec_debug_verbose(5, parsec_debug_output, "Device %s refused to register taskpool %p", device->name, __parsec_tp);
+        __parsec_tp->super.super.devices_index_mask &= ~(1 << device->device_index);
+        continue;
+      }
+    if(NULL != device->memory_register) {  /* Register all the data */
+      parsec_dc = (parsec_data_collection_t*)__parsec_tp->super._g_descY;
+      if( (NULL != parsec_dc->register_memory) &&
+          (PARSEC_SUCCESS != parsec_dc->register_memory(parsec_dc, device)) ) {
+        parsec_debug_verbose(3, parsec_debug_output, "Device %s refused to register memory for data %s (%p) from taskpool %p",
+                     device->name, parsec_dc->key_base, parsec_dc, __parsec_tp);
+        __parsec_tp->super.super.devices_index_mask &= ~(1 << device->device_index);
+      }
+      parsec_dc = (parsec_data_collection_t*)__parsec_tp->super._g_descT;
+      if( (NULL != parsec_dc->register_memory) &&
+          (PARSEC_SUCCESS != parsec_dc->register_memory(parsec_dc, device)) ) {
+        parsec_debug_verbose(3, parsec_debug_output, "Device %s refused to register memory for data %s (%p) from taskpool %p",
+                     device->name, parsec_dc->key_base, parsec_dc, __parsec_tp);
+        __parsec_tp->super.super.devices_index_mask &= ~(1 << device->device_index);
+      }
+    }
+    supported_dev |= device->type;
+  }
+  /* Remove all the chores without a backend device */
+  for( i = 0; i < PARSEC_redistribute_check_NB_TASK_CLASSES; i++ ) {
+    parsec_task_class_t* tc = (parsec_task_class_t*)__parsec_tp->super.super.task_classes_array[i];
+    __parsec_chore_t* chores = (__parsec_chore_t*)tc->incarnations;
+    uint32_t idx = 0, j;
+    for( j = 0; PARSEC_DEV_NONE != chores[j].type; j++ ) {
+      if( !(supported_dev & chores[j].type) ) continue;
+      if( j != idx ) {
+        chores[idx] = chores[j];
+        parsec_debug_verbose(20, parsec_debug_output, "Device type %i disabled for function %s"
+, chores[j].type, tc->name);
+      }
+      idx++;
+    }
+    chores[idx].type     = PARSEC_DEV_NONE;
+    chores[idx].evaluate = NULL;
+    chores[idx].hook     = NULL;
+    /* Create the initialization tasks for each taskclass */
+    parsec_task_t* task = (parsec_task_t*)parsec_thread_mempool_allocate(context->virtual_processes[0]->execution_streams[0]->context_mempool);
+    PARSEC_OBJ_CONSTRUCT(task, parsec_task_t); /* construct called only when new, force-construct it again */
+    task->taskpool = (parsec_taskpool_t *)__parsec_tp;
+    task->chore_mask = PARSEC_DEV_CPU;
+    memset(&task->locals, 0, sizeof(parsec_assignment_t) * MAX_LOCAL_COUNT);
+    PARSEC_LIST_ITEM_SINGLETON(task);
+    task->priority = -1;
+    task->task_class = task->taskpool->task_classes_array[PARSEC_redistribute_check_NB_TASK_CLASSES + i];
+    int where = i % context->nb_vp;
+    if( NULL == ready_tasks[where] ) ready_tasks[where] = &task->super;
+    else ready_tasks[where] = parsec_list_item_ring_push(ready_tasks[where], &task->super);
+  }
+}
+static void __parsec_redistribute_check_internal_destructor( __parsec_redistribute_check_internal_taskpool_t *__parsec_tp )
+{
+  uint32_t i;
+  parsec_taskpool_unregister( &__parsec_tp->super.super );
+  if(NULL != __parsec_tp->super.super.tdm.module) __parsec_tp->super.super.tdm.module->unmonitor_taskpool(&__parsec_tp->super.super);
+  for( i = 0; i < (uint32_t)(2 * __parsec_tp->super.super.nb_task_classes); i++ ) {  /* Extra startup function added at the end */
+    parsec_task_class_t* tc = (parsec_task_class_t*)__parsec_tp->super.super.task_classes_array[i];
+    free((void*)tc->incarnations);
+    free(tc);
+  }
+  free(__parsec_tp->super.super.task_classes_array); __parsec_tp->super.super.task_classes_array = NULL;
+  __parsec_tp->super.super.nb_task_classes = 0;
+
+  for(i = 0; i < (uint32_t)__parsec_tp->super.arenas_datatypes_size; i++) {
+    if( NULL != __parsec_tp->super.arenas_datatypes[i].arena ) {
+      PARSEC_OBJ_RELEASE(__parsec_tp->super.arenas_datatypes[i].arena);
+    }
+  }
+  /* Destroy the data repositories for this object */
+   data_repo_destroy_nothreadsafe(__parsec_tp->repositories[3]);  /* Get_T */
+   data_repo_destroy_nothreadsafe(__parsec_tp->repositories[2]);  /* Send_T */
+   data_repo_destroy_nothreadsafe(__parsec_tp->repositories[1]);  /* Get_Y */
+   data_repo_destroy_nothreadsafe(__parsec_tp->repositories[0]);  /* Send_Y */
+  /* Release the dependencies arrays for this object */
+  parsec_hash_table_fini( (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[3] );
+  PARSEC_OBJ_RELEASE(__parsec_tp->super.super.dependencies_array[3]);
+  __parsec_tp->super.super.dependencies_array[3] = NULL;
+  parsec_hash_table_fini( (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[2] );
+  PARSEC_OBJ_RELEASE(__parsec_tp->super.super.dependencies_array[2]);
+  __parsec_tp->super.super.dependencies_array[2] = NULL;
+  parsec_hash_table_fini( (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[1] );
+  PARSEC_OBJ_RELEASE(__parsec_tp->super.super.dependencies_array[1]);
+  __parsec_tp->super.super.dependencies_array[1] = NULL;
+  parsec_hash_table_fini( (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[0] );
+  PARSEC_OBJ_RELEASE(__parsec_tp->super.super.dependencies_array[0]);
+  __parsec_tp->super.super.dependencies_array[0] = NULL;
+  free( __parsec_tp->super.super.dependencies_array );
+  __parsec_tp->super.super.dependencies_array = NULL;
+  /* Unregister all the data */
+  uint32_t _i;
+  for( _i = 0; _i < parsec_nb_devices; _i++ ) {
+    parsec_device_module_t* device;
+    parsec_data_collection_t* parsec_dc;
+    if(!(__parsec_tp->super.super.devices_index_mask & (1 << _i))) continue;
+    if((NULL == (device = parsec_mca_device_get(_i))) || (NULL == device->memory_unregister)) continue;
+    parsec_dc = (parsec_data_collection_t*)__parsec_tp->super._g_descY;
+  if( NULL != parsec_dc->unregister_memory ) { (void)parsec_dc->unregister_memory(parsec_dc, device); };
+  parsec_dc = (parsec_data_collection_t*)__parsec_tp->super._g_descT;
+  if( NULL != parsec_dc->unregister_memory ) { (void)parsec_dc->unregister_memory(parsec_dc, device); };
+}
+  /* Unregister the taskpool from the devices */
+  for( i = 0; i < parsec_nb_devices; i++ ) {
+    if(!(__parsec_tp->super.super.devices_index_mask & (1 << i))) continue;
+    __parsec_tp->super.super.devices_index_mask ^= (1 << i);
+    parsec_device_module_t* device = parsec_mca_device_get(i);
+    if((NULL == device) || (NULL == device->taskpool_unregister)) continue;
+    if( PARSEC_SUCCESS != device->taskpool_unregister(device, &__parsec_tp->super.super) ) continue;
+  }
+  free(__parsec_tp->super.super.taskpool_name); __parsec_tp->super.super.taskpool_name = NULL;
+}
+
+void __parsec_redistribute_check_internal_constructor(__parsec_redistribute_check_internal_taskpool_t* __parsec_tp)
+{
+  parsec_task_class_t* tc;
+  uint32_t i, j;
+
+  __parsec_tp->super.super.nb_task_classes = PARSEC_redistribute_check_NB_TASK_CLASSES;
+  __parsec_tp->super.super.devices_index_mask = PARSEC_DEVICES_ALL;
+  __parsec_tp->super.super.taskpool_name = strdup("redistribute_check");
+  parsec_termdet_open_module(&__parsec_tp->super.super, "local");
+  __parsec_tp->super.super.tdm.module->monitor_taskpool(&__parsec_tp->super.super,
+                                                        parsec_taskpool_termination_detected);
+  __parsec_tp->super.super.update_nb_runtime_task = parsec_add_fetch_runtime_task;
+  __parsec_tp->super.super.dependencies_array = (void **)
+              calloc(__parsec_tp->super.super.nb_task_classes, sizeof(void*));
+  /* Twice the size to hold the startup tasks function_t */
+  __parsec_tp->super.super.task_classes_array = (const parsec_task_class_t**)
+              calloc((2 * PARSEC_redistribute_check_NB_TASK_CLASSES + 1), sizeof(parsec_task_class_t*));
+  __parsec_tp->super.super.tdm.module->taskpool_addto_runtime_actions(&__parsec_tp->super.super, PARSEC_redistribute_check_NB_TASK_CLASSES);  /* for the startup tasks */
+  __parsec_tp->super.super.taskpool_type = PARSEC_TASKPOOL_TYPE_PTG;
+  __parsec_tp->sync_point = __parsec_tp->super.super.nb_task_classes;
+  __parsec_tp->initial_number_tasks = 0;
+  __parsec_tp->startup_queue = NULL;
+  for( i = 0; i < __parsec_tp->super.super.nb_task_classes; i++ ) {
+    __parsec_tp->super.super.task_classes_array[i] = tc = malloc(sizeof(parsec_task_class_t));
+    memcpy(tc, redistribute_check_task_classes[i], sizeof(parsec_task_class_t));
+    for( j = 0; PARSEC_DEV_NONE != tc->incarnations[j].type; j++);  /* compute the number of incarnations */
+    tc->incarnations = (__parsec_chore_t*)malloc((j+1) * sizeof(__parsec_chore_t));
+        memcpy((__parsec_chore_t*)tc->incarnations, redistribute_check_task_classes[i]->incarnations, (j+1) * sizeof(__parsec_chore_t));
+
+    /* Add a placeholder for initialization and startup task */
+    __parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+i] = tc = (parsec_task_class_t*)malloc(sizeof(parsec_task_class_t));
+    memcpy(tc, (void*)&__parsec_generic_startup, sizeof(parsec_task_class_t));
+    tc->task_class_id = __parsec_tp->super.super.nb_task_classes + i;
+    tc->incarnations = (__parsec_chore_t*)malloc(2 * sizeof(__parsec_chore_t));
+    memcpy((__parsec_chore_t*)tc->incarnations, (void*)__parsec_generic_startup.incarnations, 2 * sizeof(__parsec_chore_t));
+    tc->release_task = parsec_release_task_to_mempool_and_count_as_runtime_tasks;
+  }
+  /* Startup task for Get_T */
+  tc = (parsec_task_class_t *)__parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+0];
+  tc->name = "Startup for Get_T";
+  tc->prepare_input = (parsec_hook_t*)redistribute_check_Get_T_internal_init;
+  /* Startup task for Send_T */
+  tc = (parsec_task_class_t *)__parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+1];
+  tc->name = "Startup for Send_T";
+  tc->prepare_input = (parsec_hook_t*)redistribute_check_Send_T_internal_init;
+  ((__parsec_chore_t*)&tc->incarnations[0])->hook = (parsec_hook_t *)__jdf2c_startup_Send_T;
+  /* Startup task for Get_Y */
+  tc = (parsec_task_class_t *)__parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+2];
+  tc->name = "Startup for Get_Y";
+  tc->prepare_input = (parsec_hook_t*)redistribute_check_Get_Y_internal_init;
+  /* Startup task for Send_Y */
+  tc = (parsec_task_class_t *)__parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+3];
+  tc->name = "Startup for Send_Y";
+  tc->prepare_input = (parsec_hook_t*)redistribute_check_Send_Y_internal_init;
+  ((__parsec_chore_t*)&tc->incarnations[0])->hook = (parsec_hook_t *)__jdf2c_startup_Send_Y;
+  /* Compute the number of arenas_datatypes: */
+  /*   PARSEC_redistribute_check_ORIGIN_ARENA  ->  0 */
+  /*   PARSEC_redistribute_check_DEFAULT_ARENA  ->  1 */
+  /*   PARSEC_redistribute_check_TARGET_ARENA  ->  2 */
+  __parsec_tp->super.arenas_datatypes_size = 3;
+  memset(&__parsec_tp->super.arenas_datatypes[0], 0, __parsec_tp->super.arenas_datatypes_size*sizeof(parsec_arena_datatype_t));
+  /* If profiling is enabled, the keys for profiling */
+#  if defined(PARSEC_PROF_TRACE)
+  __parsec_tp->super.super.profiling_array = redistribute_check_profiling_array;
+  if( -2 == redistribute_check_profiling_array[0] ) {
+    #if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+parsec_profiling_add_dictionary_keyword("redistribute_check::Get_T::internal init", "fill:34D8D8",
+                                       0,
+                                       NULL,
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(redistribute_check_Get_T.task_class_id  + PARSEC_redistribute_check_NB_TASK_CLASSES)/* Get_T (internal init) start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(redistribute_check_Get_T.task_class_id  + PARSEC_redistribute_check_NB_TASK_CLASSES)/* Get_T (internal init) end key */]);
+#endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+parsec_profiling_add_dictionary_keyword("redistribute_check::Get_T", "fill:CC2828",
+                                       sizeof(parsec_task_prof_info_t)+11*sizeof(parsec_assignment_t),
+                                       "dc_key{uint64_t};priority{int32_t};dc_dataid{uint32_t};tcid{uint32_t};trc{int32_t};batch_col{int32_t};m_start{int32_t};m_end{int32_t};n_start{int32_t};n_end{int32_t};m{int32_t};n{int32_t};i_start{int32_t};i_end{int32_t};j_start{int32_t};j_end{int32_t}",
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(redistribute_check_Get_T.task_class_id) /* Get_T start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(redistribute_check_Get_T.task_class_id) /* Get_T end key */]);
+
+    #if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+parsec_profiling_add_dictionary_keyword("redistribute_check::Send_T::internal init", "fill:8634D8",
+                                       0,
+                                       NULL,
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(redistribute_check_Send_T.task_class_id  + PARSEC_redistribute_check_NB_TASK_CLASSES)/* Send_T (internal init) start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(redistribute_check_Send_T.task_class_id  + PARSEC_redistribute_check_NB_TASK_CLASSES)/* Send_T (internal init) end key */]);
+#endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+parsec_profiling_add_dictionary_keyword("redistribute_check::Send_T", "fill:7ACC28",
+                                       sizeof(parsec_task_prof_info_t)+7*sizeof(parsec_assignment_t),
+                                       "dc_key{uint64_t};priority{int32_t};dc_dataid{uint32_t};tcid{uint32_t};trc{int32_t};batch_col{int32_t};m_start{int32_t};m_end{int32_t};n_start{int32_t};n_end{int32_t};m{int32_t};n{int32_t}",
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(redistribute_check_Send_T.task_class_id) /* Send_T start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(redistribute_check_Send_T.task_class_id) /* Send_T end key */]);
+
+    #if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+parsec_profiling_add_dictionary_keyword("redistribute_check::Get_Y::internal init", "fill:D83434",
+                                       0,
+                                       NULL,
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(redistribute_check_Get_Y.task_class_id  + PARSEC_redistribute_check_NB_TASK_CLASSES)/* Get_Y (internal init) start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(redistribute_check_Get_Y.task_class_id  + PARSEC_redistribute_check_NB_TASK_CLASSES)/* Get_Y (internal init) end key */]);
+#endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+parsec_profiling_add_dictionary_keyword("redistribute_check::Get_Y", "fill:28CCCC",
+                                       sizeof(parsec_task_prof_info_t)+11*sizeof(parsec_assignment_t),
+                                       "dc_key{uint64_t};priority{int32_t};dc_dataid{uint32_t};tcid{uint32_t};trc{int32_t};batch_col{int32_t};m_start{int32_t};m_end{int32_t};n_start{int32_t};n_end{int32_t};m{int32_t};n{int32_t};i_start{int32_t};i_end{int32_t};j_start{int32_t};j_end{int32_t}",
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(redistribute_check_Get_Y.task_class_id) /* Get_Y start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(redistribute_check_Get_Y.task_class_id) /* Get_Y end key */]);
+
+    #if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+parsec_profiling_add_dictionary_keyword("redistribute_check::Send_Y::internal init", "fill:86D834",
+                                       0,
+                                       NULL,
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(redistribute_check_Send_Y.task_class_id  + PARSEC_redistribute_check_NB_TASK_CLASSES)/* Send_Y (internal init) start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(redistribute_check_Send_Y.task_class_id  + PARSEC_redistribute_check_NB_TASK_CLASSES)/* Send_Y (internal init) end key */]);
+#endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+parsec_profiling_add_dictionary_keyword("redistribute_check::Send_Y", "fill:7A28CC",
+                                       sizeof(parsec_task_prof_info_t)+7*sizeof(parsec_assignment_t),
+                                       "dc_key{uint64_t};priority{int32_t};dc_dataid{uint32_t};tcid{uint32_t};trc{int32_t};batch_col{int32_t};m_start{int32_t};m_end{int32_t};n_start{int32_t};n_end{int32_t};m{int32_t};n{int32_t}",
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(redistribute_check_Send_Y.task_class_id) /* Send_Y start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(redistribute_check_Send_Y.task_class_id) /* Send_Y end key */]);
+
+  }
+#  endif /* defined(PARSEC_PROF_TRACE) */
+  __parsec_tp->super.super.repo_array = __parsec_tp->repositories;
+  __parsec_tp->super.super.startup_hook = (parsec_startup_fn_t)redistribute_check_startup;
+  (void)parsec_taskpool_reserve_id((parsec_taskpool_t*)__parsec_tp);
+}
+
+  /** Generate class declaration and instance using the above constructor and destructor */
+  PARSEC_OBJ_CLASS_DECLARATION(__parsec_redistribute_check_internal_taskpool_t);
+  PARSEC_OBJ_CLASS_INSTANCE(__parsec_redistribute_check_internal_taskpool_t, parsec_redistribute_check_taskpool_t,
+                            __parsec_redistribute_check_internal_constructor, __parsec_redistribute_check_internal_destructor);
+
+#undef descY
+#undef descT
+#undef size_row
+#undef size_col
+#undef disi_Y
+#undef disj_Y
+#undef disi_T
+#undef disj_T
+#undef R
+#undef num_col_Y
+#undef num_col_T
+#undef NY
+#undef NT
+
+parsec_redistribute_check_taskpool_t *parsec_redistribute_check_new(parsec_tiled_matrix_t* descY /* data descY */, parsec_tiled_matrix_t* descT /* data descT */, int size_row, int size_col, int disi_Y, int disj_Y, int disi_T, int disj_T, int R)
+{
+  __parsec_redistribute_check_internal_taskpool_t *__parsec_tp = PARSEC_OBJ_NEW(__parsec_redistribute_check_internal_taskpool_t);
+  /* Dump the hidden parameters with default values */
+  int num_col_Y;
+  int num_col_T;
+  int NY;
+  int NT;
+  /* Now the Parameter-dependent structures: */
+  __parsec_tp->super._g_descY = descY;
+  __parsec_tp->super._g_descT = descT;
+  __parsec_tp->super._g_size_row = size_row;
+  __parsec_tp->super._g_size_col = size_col;
+  __parsec_tp->super._g_disi_Y = disi_Y;
+  __parsec_tp->super._g_disj_Y = disj_Y;
+  __parsec_tp->super._g_disi_T = disi_T;
+  __parsec_tp->super._g_disj_T = disj_T;
+  __parsec_tp->super._g_R = R;
+  __parsec_tp->super._g_num_col_Y = num_col_Y = descY->lnt;
+  __parsec_tp->super._g_num_col_T = num_col_T = descT->lnt;
+  __parsec_tp->super._g_NY = NY = (1);
+  __parsec_tp->super._g_NT = NT = (1);
+  PARSEC_AYU_REGISTER_TASK(&redistribute_check_Get_T);
+  PARSEC_AYU_REGISTER_TASK(&redistribute_check_Send_T);
+  PARSEC_AYU_REGISTER_TASK(&redistribute_check_Get_Y);
+  PARSEC_AYU_REGISTER_TASK(&redistribute_check_Send_Y);
+  __parsec_tp->super.super.startup_hook = (parsec_startup_fn_t)redistribute_check_startup;
+  (void)parsec_taskpool_reserve_id((parsec_taskpool_t*)__parsec_tp);
+/* Prevent warnings related to not used hidden global variables */
+  (void)num_col_Y;  (void)num_col_T;  (void)NY;  (void)NT;
+  return (parsec_redistribute_check_taskpool_t*)__parsec_tp;
+}
+
+
+/** @brief Global, used to compare result */
+DTYPE *Y_g, *T_g;
+
+/**
+ * @brief New function
+ *
+ * @param [in] Y: the data, already distributed and allocated
+ * @param [in] T: the data, redistributed and allocated
+ * @param [in] size_row: row size of submatrix to be checked
+ * @param [in] size_col: column size of submatrix to be checked
+ * @param [in] disi_Y: row displacement of submatrix in Y
+ * @param [in] disj_Y: column displacement of submatrix in Y
+ * @param [in] disi_T: row displacement of submatrix in T
+ * @param [in] disj_T: column displacement of submatrix in T
+ * @param [in] R: radius of ghost region
+ * @return the parsec object to schedule.
+ */
+parsec_taskpool_t*
+parsec_redistribute_check_New(parsec_tiled_matrix_t *Y,
+                                parsec_tiled_matrix_t *T,
+                                int size_row, int size_col,
+                                int disi_Y, int disj_Y,
+                                int disi_T, int disj_T, int R)
+{
+    parsec_taskpool_t* redistribute_check_taskpool;
+    parsec_redistribute_check_taskpool_t* taskpool = NULL;
+
+    taskpool = parsec_redistribute_check_new(Y, T, size_row, size_col, disi_Y, disj_Y, disi_T, disj_T, R);
+    redistribute_check_taskpool = (parsec_taskpool_t*)taskpool;
+
+    parsec_add2arena(&taskpool->arenas_datatypes[PARSEC_redistribute_check_ORIGIN_ADT_IDX],
+                            MY_TYPE, PARSEC_MATRIX_FULL,
+                            1, Y->mb, Y->nb, Y->mb,
+                            PARSEC_ARENA_ALIGNMENT_SSE, -1 );
+
+    parsec_add2arena(&taskpool->arenas_datatypes[PARSEC_redistribute_check_TARGET_ADT_IDX],
+                            MY_TYPE, PARSEC_MATRIX_FULL,
+                            1, T->mb, T->nb, T->mb,
+                            PARSEC_ARENA_ALIGNMENT_SSE, -1 );
+
+    return redistribute_check_taskpool;
+}
+
+static void
+__parsec_taskpool_redistribute_check_destructor(parsec_redistribute_check_taskpool_t *redistribute_check_taskpool)
+{
+    parsec_del2arena(&redistribute_check_taskpool->arenas_datatypes[PARSEC_redistribute_check_ORIGIN_ADT_IDX]);
+    parsec_del2arena(&redistribute_check_taskpool->arenas_datatypes[PARSEC_redistribute_check_TARGET_ADT_IDX]);
+}
+
+PARSEC_OBJ_CLASS_INSTANCE(parsec_redistribute_check_taskpool_t, parsec_taskpool_t,
+                          NULL, __parsec_taskpool_redistribute_check_destructor);
+
+/**
+ * @brief Check result
+ *
+ * @details
+ * Check whether value of submatrix in dcY and in dcT are
+ * the same, not including the ghost region.
+ *
+ * @param [in] dcY: the data, already distributed and allocated
+ * @param [in] dcT: the data, already distributed and allocated
+ * @param [in] size_row: row size of submatrix to be checked
+ * @param [in] size_col: column size of submatrix to be checked
+ * @param [in] disi_Y: row displacement of submatrix in Y
+ * @param [in] disj_Y: column displacement of submatrix in Y
+ * @param [in] disi_T: row displacement of submatrix in T
+ * @param [in] disj_T: column displacement of submatrix in T
+ * @param [in] R: radius of ghost region around tiles
+ * @return 0 if they are the same, and print "Redistribute
+ * Result is CORRECT", otherwise print the first detected
+ * location and values where values are different.
+ */
+int parsec_redistribute_check(parsec_context_t *parsec,
+                                parsec_tiled_matrix_t *dcY,
+                                parsec_tiled_matrix_t *dcT,
+                                int size_row, int size_col,
+                                int disi_Y, int disj_Y,
+                                int disi_T, int disj_T)
+{
+    parsec_taskpool_t *parsec_redistribute_check = NULL;
+    int num_col_Y = dcY->lnt;
+    int num_col_T = dcT->lnt;
+
+    /* R will be used for padding tiles like in AMR,
+     * here for a normal redistribution problem, R is set to 0.
+     */
+    int R = 0;
+
+    int mb_Y_inner = dcY->mb - 2 * R;
+    int nb_Y_inner = dcY->nb - 2 * R;
+    int mb_T_inner = dcT->mb - 2 * R;
+    int nb_T_inner = dcT->nb - 2 * R;
+
+    int row_Y = dcY->lmt * mb_Y_inner;
+    int col_Y = dcY->lnt * nb_Y_inner;
+    int row_T = dcT->lmt * mb_T_inner;
+    int col_T = dcT->lnt * nb_T_inner;
+
+    int n_Y_start = disj_Y / nb_Y_inner;
+    int n_Y_end = (disj_Y+size_col-1) / nb_Y_inner;
+
+    int n_T_start = disj_T / nb_T_inner;
+    int n_T_end = (disj_T+size_col-1) / nb_T_inner;
+
+    int lnt_Y = n_Y_end - n_Y_start + 1;
+    int lnt_T = n_T_end - n_T_start + 1;
+
+    /* Check distribution, and detarmine batch size,
+     * how many tile columns exist at the same time */
+    if( dcY->dtype & parsec_matrix_tabular_type ) {
+        num_col_Y = parsec_imin( ceil(size_col/dcY->nb), dcY->super.nodes );
+    } else if( dcY->dtype & parsec_matrix_block_cyclic_type ) {
+        num_col_Y = ((parsec_matrix_block_cyclic_t *)dcY)->grid.cols * ((parsec_matrix_block_cyclic_t *)dcY)->grid.kcols;
+    } else {
+        fprintf(stderr, "Only support parsec_matrix_block_cyclic_type and parsec_matrix_tabular_type\n");
+        exit(1);
+    }
+
+    if( dcT->dtype & parsec_matrix_tabular_type ) {
+        num_col_T = parsec_imin( ceil(size_col/dcT->nb), dcT->super.nodes );
+    } else if( dcT->dtype & parsec_matrix_block_cyclic_type ) {
+        num_col_T = ((parsec_matrix_block_cyclic_t *)dcT)->grid.cols * ((parsec_matrix_block_cyclic_t *)dcT)->grid.kcols;
+    } else {
+        fprintf(stderr, "Only support parsec_matrix_block_cyclic_type and parsec_matrix_tabular_type\n");
+        exit(1);
+    }
+
+    int NY = ceil((double)lnt_Y/num_col_Y);
+    int NT = ceil((double)lnt_T/num_col_T);
+
+    /* Check variables validation */
+    if( (disi_Y + size_row > row_Y) || (disj_Y + size_col > col_Y) ){
+	if( 0 == dcY->super.myrank )
+            fprintf(stderr, "ERROR: Submatrix exceed Y size\n");
+        exit(1);
+    }
+
+    if( (disi_T + size_row > row_T) || (disj_T + size_col > col_T) ){
+	if( 0 == dcY->super.myrank )
+            fprintf(stderr, "ERROR: Submatrix exceed T size\n");
+        exit(1);
+    }
+
+    if( size_row < 1 || size_col < 1 ) {
+	if( 0 == dcY->super.myrank )
+            fprintf(stderr, "ERROR: Submatrix size should be bigger than 1\n");
+        exit(1);
+    }
+
+    if( disi_Y < 0 || disj_Y < 0 ) {
+	if( 0 == dcY->super.myrank )
+            fprintf(stderr, "ERROR: Source (dcY) displacement should not be negative\n");
+        exit(1);
+    }
+
+    if( disi_T < 0 || disj_T < 0 ) {
+	if( 0 == dcY->super.myrank )
+            fprintf(stderr, "ERROR: Target (dcT) displacement should not be negative\n");
+        exit(1);
+    }
+
+    if( R < 0 ) {
+	if( 0 == dcY->super.myrank )
+            fprintf(stderr, "ERROR: R should not be negative\n");
+        exit(1);
+    }
+
+    /* Allocate memory for global array */
+    if( (unsigned int)dcY->super.myrank == dcY->super.rank_of(&dcY->super, 0, 0) ){
+	Y_g = (DTYPE *)calloc(size_row*size_col, sizeof(DTYPE));
+	T_g = (DTYPE *)calloc(size_row*size_col, sizeof(DTYPE));
+    }
+
+    MPI_Barrier(MPI_COMM_WORLD);
+
+    parsec_redistribute_check = parsec_redistribute_check_New(
+                                  (parsec_tiled_matrix_t *)dcY,
+                                  (parsec_tiled_matrix_t *)dcT,
+                                  size_row, size_col, disi_Y, disj_Y,
+                                  disi_T, disj_T, R);
+
+    ((parsec_redistribute_check_taskpool_t *)parsec_redistribute_check)->_g_num_col_Y = num_col_Y;
+    ((parsec_redistribute_check_taskpool_t *)parsec_redistribute_check)->_g_NY = NY;
+
+    ((parsec_redistribute_check_taskpool_t *)parsec_redistribute_check)->_g_num_col_T = num_col_T;
+    ((parsec_redistribute_check_taskpool_t *)parsec_redistribute_check)->_g_NT = NT;
+
+    parsec_context_add_taskpool(parsec, parsec_redistribute_check);
+    parsec_context_start(parsec);
+    parsec_context_wait(parsec);
+    parsec_taskpool_free(parsec_redistribute_check);
+
+    /* Check result and print the first detected location where values are different */
+    if( (unsigned int)dcY->super.myrank == dcY->super.rank_of(&dcY->super, 0, 0) ){
+
+	for(int j = 0; j < size_col; j++){
+	    for(int i = 0; i < size_row; i++){
+		if(Y_g[j*size_row+i] != T_g[j*size_row+i]){
+		    fprintf(stderr, "ERROR: In Y: (%d, %d) in tile (%d, %d): vaule %lf\n",
+		 	    (i+disi_Y)%mb_Y_inner, (j+disj_Y)%nb_Y_inner, (i+disi_Y)/mb_Y_inner,
+                            (j+disj_Y)/nb_Y_inner, Y_g[j*size_row+i]);
+		    fprintf(stderr, "ERROR: In T: (%d, %d) in tile (%d, %d): vaule %lf\n",
+		 	    (i+disi_T)%mb_T_inner, (j+disj_T)%nb_T_inner, (i+disi_T)/mb_T_inner,
+                            (j+disj_T)/nb_T_inner, T_g[j*size_row+i]);
+
+                    /* Free memory */
+                    free(Y_g);
+                    free(T_g);
+
+		    return PARSEC_ERROR;
+		}
+            }
+	}
+
+        /* Free memory */
+        free(Y_g);
+        free(T_g);
+
+        printf("\nRedistribute Result is CORRECT!\n\n");
+    }
+
+    return 0;
+}
+
@@ -0,0 +1,195 @@
+#ifndef _redistribute_check_h_
+#define _redistribute_check_h_
+#include "parsec.h"
+#include "parsec/parsec_internal.h"
+#include "parsec/remote_dep.h"
+
+BEGIN_C_DECLS
+
+#define PARSEC_redistribute_check_ORIGIN_ADT_IDX    0
+#define PARSEC_redistribute_check_DEFAULT_ADT_IDX    1
+#define PARSEC_redistribute_check_TARGET_ADT_IDX    2
+#define PARSEC_redistribute_check_ADT_IDX_MAX       3
+typedef struct parsec_redistribute_check_taskpool_s {
+  parsec_taskpool_t super;
+  /* The list of globals */
+  parsec_tiled_matrix_t* _g_descY /* data descY */;
+  parsec_tiled_matrix_t* _g_descT /* data descT */;
+  int _g_size_row;
+  int _g_size_col;
+  int _g_disi_Y;
+  int _g_disj_Y;
+  int _g_disi_T;
+  int _g_disj_T;
+  int _g_R;
+  int _g_num_col_Y;
+  int _g_num_col_T;
+  int _g_NY;
+  int _g_NT;
+  /* The array of datatypes (ORIGIN,DEFAULT,TARGET and co.) */
+  parsec_arena_datatype_t arenas_datatypes[PARSEC_redistribute_check_ADT_IDX_MAX];
+  uint32_t arenas_datatypes_size;
+} parsec_redistribute_check_taskpool_t;
+
+/** Beware that this object is not a superset of the internal object, and as a result
+ *  we should never create one directly. Instead we should rely on the creation of the
+ *  internal object (__parsec_redistribute_check_taskpool_t).
+ */
+PARSEC_OBJ_CLASS_DECLARATION(parsec_redistribute_check_taskpool_t);
+extern parsec_redistribute_check_taskpool_t *parsec_redistribute_check_new(parsec_tiled_matrix_t* _g_descY /* data descY */, parsec_tiled_matrix_t* _g_descT /* data descT */, int _g_size_row, int _g_size_col, int _g_disi_Y, int _g_disj_Y, int _g_disi_T, int _g_disj_T, int _g_R);
+
+#if MAX_LOCAL_COUNT < 11  /* number of parameters and locals Get_T */
+  #error Too many parameters and local variables (11 out of MAX_LOCAL_COUNT) for task Get_T
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_redistribute_check_Get_T_assignment_s {
+  parsec_assignment_t batch_col;
+  parsec_assignment_t m_start;
+  parsec_assignment_t m_end;
+  parsec_assignment_t n_start;
+  parsec_assignment_t n_end;
+  parsec_assignment_t m;
+  parsec_assignment_t n;
+  parsec_assignment_t i_start;
+  parsec_assignment_t i_end;
+  parsec_assignment_t j_start;
+  parsec_assignment_t j_end;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-11];
+} __parsec_redistribute_check_Get_T_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 2  /* total number of flows for task Get_T */
+  #error Too many flows (2 out of MAX_PARAM_COUNT) for task Get_T
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_redistribute_check_Get_T_data_s {
+  parsec_data_pair_t _f_T;
+  parsec_data_pair_t _f_ctl;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-2];
+} __parsec_redistribute_check_Get_T_data_t;
+
+typedef struct __parsec_redistribute_check_Get_T_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_redistribute_check_Get_T_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_redistribute_check_Get_T_data_s data;
+} __parsec_redistribute_check_Get_T_task_t;
+
+
+#if MAX_LOCAL_COUNT < 7  /* number of parameters and locals Send_T */
+  #error Too many parameters and local variables (7 out of MAX_LOCAL_COUNT) for task Send_T
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_redistribute_check_Send_T_assignment_s {
+  parsec_assignment_t batch_col;
+  parsec_assignment_t m_start;
+  parsec_assignment_t m_end;
+  parsec_assignment_t n_start;
+  parsec_assignment_t n_end;
+  parsec_assignment_t m;
+  parsec_assignment_t n;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-7];
+} __parsec_redistribute_check_Send_T_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 2  /* total number of flows for task Send_T */
+  #error Too many flows (2 out of MAX_PARAM_COUNT) for task Send_T
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_redistribute_check_Send_T_data_s {
+  parsec_data_pair_t _f_T;
+  parsec_data_pair_t _f_ctl;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-2];
+} __parsec_redistribute_check_Send_T_data_t;
+
+typedef struct __parsec_redistribute_check_Send_T_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_redistribute_check_Send_T_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_redistribute_check_Send_T_data_s data;
+} __parsec_redistribute_check_Send_T_task_t;
+
+
+#if MAX_LOCAL_COUNT < 11  /* number of parameters and locals Get_Y */
+  #error Too many parameters and local variables (11 out of MAX_LOCAL_COUNT) for task Get_Y
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_redistribute_check_Get_Y_assignment_s {
+  parsec_assignment_t batch_col;
+  parsec_assignment_t m_start;
+  parsec_assignment_t m_end;
+  parsec_assignment_t n_start;
+  parsec_assignment_t n_end;
+  parsec_assignment_t m;
+  parsec_assignment_t n;
+  parsec_assignment_t i_start;
+  parsec_assignment_t i_end;
+  parsec_assignment_t j_start;
+  parsec_assignment_t j_end;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-11];
+} __parsec_redistribute_check_Get_Y_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 2  /* total number of flows for task Get_Y */
+  #error Too many flows (2 out of MAX_PARAM_COUNT) for task Get_Y
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_redistribute_check_Get_Y_data_s {
+  parsec_data_pair_t _f_Y;
+  parsec_data_pair_t _f_ctl;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-2];
+} __parsec_redistribute_check_Get_Y_data_t;
+
+typedef struct __parsec_redistribute_check_Get_Y_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_redistribute_check_Get_Y_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_redistribute_check_Get_Y_data_s data;
+} __parsec_redistribute_check_Get_Y_task_t;
+
+
+#if MAX_LOCAL_COUNT < 7  /* number of parameters and locals Send_Y */
+  #error Too many parameters and local variables (7 out of MAX_LOCAL_COUNT) for task Send_Y
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_redistribute_check_Send_Y_assignment_s {
+  parsec_assignment_t batch_col;
+  parsec_assignment_t m_start;
+  parsec_assignment_t m_end;
+  parsec_assignment_t n_start;
+  parsec_assignment_t n_end;
+  parsec_assignment_t m;
+  parsec_assignment_t n;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-7];
+} __parsec_redistribute_check_Send_Y_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 2  /* total number of flows for task Send_Y */
+  #error Too many flows (2 out of MAX_PARAM_COUNT) for task Send_Y
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_redistribute_check_Send_Y_data_s {
+  parsec_data_pair_t _f_Y;
+  parsec_data_pair_t _f_ctl;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-2];
+} __parsec_redistribute_check_Send_Y_data_t;
+
+typedef struct __parsec_redistribute_check_Send_Y_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_redistribute_check_Send_Y_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_redistribute_check_Send_Y_data_s data;
+} __parsec_redistribute_check_Send_Y_task_t;
+
+
+END_C_DECLS
+
+#endif /* _redistribute_check_h_ */ 
@@ -0,0 +1,12626 @@
+#include "parsec.h"
+#include "parsec/parsec_internal.h"
+#include "parsec/ayudame.h"
+#include "parsec/execution_stream.h"
+#include "parsec/parsec_binary_profile.h"
+#include "parsec/mca/device/device_gpu.h"
+#if defined(PARSEC_HAVE_DEV_CUDA_SUPPORT)
+#include "parsec/mca/device/cuda/device_cuda.h"
+#endif  /* defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) */
+#if defined(PARSEC_HAVE_DEV_HIP_SUPPORT)
+#include "parsec/mca/device/hip/device_hip.h"
+#endif  /* defined(PARSEC_HAVE_DEV_HIP_SUPPORT) */
+#if defined(_MSC_VER) || defined(__MINGW32__)
+#  include <malloc.h>
+#else
+#  include <alloca.h>
+#endif  /* defined(_MSC_VER) || defined(__MINGW32__) */
+
+#define PARSEC_redistribute_no_optimization_NB_TASK_CLASSES 4
+#define PARSEC_redistribute_no_optimization_NB_DATA 2
+
+typedef struct __parsec_redistribute_no_optimization_internal_taskpool_s __parsec_redistribute_no_optimization_internal_taskpool_t;
+struct parsec_redistribute_no_optimization_internal_taskpool_s;
+
+/** Predeclarations of the parsec_task_class_t */
+static const parsec_task_class_t redistribute_no_optimization_Receive;
+static const parsec_task_class_t redistribute_no_optimization_Update;
+static const parsec_task_class_t redistribute_no_optimization_Send;
+static const parsec_task_class_t redistribute_no_optimization_Init;
+/** Predeclarations of the parameters */
+static const parsec_flow_t flow_of_redistribute_no_optimization_Receive_for_T;
+static const parsec_flow_t flow_of_redistribute_no_optimization_Receive_for_ctl1;
+static const parsec_flow_t flow_of_redistribute_no_optimization_Receive_for_ctl2;
+static const parsec_flow_t flow_of_redistribute_no_optimization_Update_for_T;
+static const parsec_flow_t flow_of_redistribute_no_optimization_Update_for_NW;
+static const parsec_flow_t flow_of_redistribute_no_optimization_Update_for_NE;
+static const parsec_flow_t flow_of_redistribute_no_optimization_Update_for_SW;
+static const parsec_flow_t flow_of_redistribute_no_optimization_Update_for_SE;
+static const parsec_flow_t flow_of_redistribute_no_optimization_Update_for_N;
+static const parsec_flow_t flow_of_redistribute_no_optimization_Update_for_S;
+static const parsec_flow_t flow_of_redistribute_no_optimization_Update_for_W;
+static const parsec_flow_t flow_of_redistribute_no_optimization_Update_for_E;
+static const parsec_flow_t flow_of_redistribute_no_optimization_Update_for_I;
+static const parsec_flow_t flow_of_redistribute_no_optimization_Update_for_ctl;
+static const parsec_flow_t flow_of_redistribute_no_optimization_Send_for_Y;
+static const parsec_flow_t flow_of_redistribute_no_optimization_Send_for_ctl;
+static const parsec_flow_t flow_of_redistribute_no_optimization_Init_for_T;
+/*
+ * Copyright (c) 2017-2021 The University of Tennessee and The University
+ *                         of Tennessee Research Foundation. All rights
+ *                         reserved.
+ *
+ */
+#include "redistribute_test.h"
+
+/**
+ * @brief CORE function, update piece data to T
+ *
+ * @param [out] T: target data
+ * @param [in] NW: North West part
+ * @param [in] NE: North East part
+ * @param [in] SW: South West part
+ * @param [in] SE: South East part
+ * @param [in] N: North part in T, but dimension based on Y
+ * @param [in] S: South part in T, but dimension based on Y
+ * @param [in] W: West part in T, but dimension based on Y
+ * @param [in] E: East part in T, but dimension based on Y
+ * @param [in] I: Inner part in T, but dimension based on Y
+ * @param [in] R: radius of ghost region
+ * @param [in] TL_row: row size of Top Left (NW)
+ * @param [in] TL_col: column size of Top Left (NW)
+ * @param [in] BR_row: row size of Bottom Right (SE)
+ * @param [in] BR_col: column size of Bottom Right (SE)
+ * @param [in] m_Y_start: row tile start index of Y
+ * @param [in] m_Y_end: row tile end index of Y
+ * @param [in] n_Y_start: column tile start index of Y
+ * @param [in] n_Y_end: column tile end index of Y
+ * @param [in] m_Y: row tile index of Y
+ * @param [in] n_Y: column tile index of Y
+ * @param [in] i_start: row start displacement of T in Y
+ * @param [in] j_start: column start displacement of T in Y
+ * @param [in] mb_T: row tile size of T, always be descT->mb
+ * @param [in] mb_Y_INNER: row tile size of Y, not including ghost region
+ * @param [in] nb_Y_INNER: column tile size of Y, not including ghost region
+ * @param [in] offset_row: row offset in T
+ * @param [in] offset_col: col offset in T
+ */
+static void
+CORE_redistribute_no_optimization_update(DTYPE *T, DTYPE *NW, DTYPE *NE, DTYPE *SW, DTYPE *SE, DTYPE *N, DTYPE *S,
+                         DTYPE *W, DTYPE *E, DTYPE *I, int R, int TL_row, int TL_col, int BR_row,
+                         int BR_col, int m_Y_start, int m_Y_end, int n_Y_start, int n_Y_end, int m_Y,
+                         int n_Y, int i_start, int j_start, int mb_T, int mb_Y_INNER, int nb_Y_INNER,
+                         int offset_row, int offset_col)
+{
+    int i_start_T, j_start_T;
+    int mb_Y = mb_Y_INNER + 2 * R;
+
+    if( m_Y == m_Y_start ){
+        /* North west corner */
+        if( n_Y == n_Y_start ){
+            i_start_T = offset_row;
+            j_start_T = offset_col;
+	    MOVE_SUBMATRIX(TL_row, TL_col, NW, i_start+R, j_start+R, mb_Y, T, i_start_T, j_start_T, mb_T);
+        }
+        /* North bar*/
+        else if( (n_Y > n_Y_start) && (n_Y < n_Y_end) ){
+            i_start_T = offset_row;
+            j_start_T = offset_col + TL_col + (n_Y - n_Y_start - 1) * nb_Y_INNER;
+	    MOVE_SUBMATRIX(TL_row, nb_Y_INNER, N, i_start+R, R, mb_Y, T, i_start_T, j_start_T, mb_T);
+        }
+        /* North east corner */
+        else if( (n_Y == n_Y_end) && (n_Y_start != n_Y_end) ){
+            i_start_T = offset_row;
+            j_start_T = offset_col + TL_col + (n_Y_end - n_Y_start - 1) * nb_Y_INNER;
+	    MOVE_SUBMATRIX(TL_row, BR_col, NE, i_start+R, R, mb_Y, T, i_start_T, j_start_T, mb_T);
+        }
+    }
+
+    else if( (m_Y > m_Y_start) && (m_Y < m_Y_end) ){
+        /* West bar*/
+        if( n_Y == n_Y_start ){
+            i_start_T = offset_row + TL_row + (m_Y - m_Y_start - 1) * mb_Y_INNER;
+            j_start_T = offset_col;
+	    MOVE_SUBMATRIX(mb_Y_INNER, TL_col, W, R, j_start+R, mb_Y, T, i_start_T, j_start_T, mb_T);
+        }
+        /* Inner tile*/
+        else if( (n_Y > n_Y_start) && (n_Y < n_Y_end) ){
+            i_start_T = offset_row + TL_row + (m_Y - m_Y_start - 1) * mb_Y_INNER;
+            j_start_T = offset_col + TL_col + (n_Y - n_Y_start - 1) * nb_Y_INNER;
+	    MOVE_SUBMATRIX(mb_Y_INNER, nb_Y_INNER, I, R, R, mb_Y, T, i_start_T, j_start_T, mb_T);
+        }
+        /* East bar*/
+        else if( (n_Y == n_Y_end) && (n_Y_start != n_Y_end) ){
+            i_start_T = offset_row + TL_row + (m_Y - m_Y_start - 1) * mb_Y_INNER;
+            j_start_T = offset_col + TL_col + (n_Y_end - n_Y_start - 1) * nb_Y_INNER;
+	    MOVE_SUBMATRIX(mb_Y_INNER, BR_col, E, R, R, mb_Y, T, i_start_T, j_start_T, mb_T);
+        }
+    }
+
+    else if( (m_Y == m_Y_end) && (m_Y_start != m_Y_end) ){
+        /* South west corner */
+        if( n_Y == n_Y_start ){
+            i_start_T = offset_row + TL_row + (m_Y_end - m_Y_start - 1) * mb_Y_INNER;
+            j_start_T = offset_col;
+	    MOVE_SUBMATRIX(BR_row, TL_col, SW, R, j_start+R, mb_Y, T, i_start_T, j_start_T, mb_T);
+        }
+        /* South bar*/
+        else if( (n_Y > n_Y_start) && (n_Y < n_Y_end) ){
+            i_start_T = offset_row + TL_row + (m_Y_end - m_Y_start - 1) * mb_Y_INNER;
+            j_start_T = offset_col + TL_col + (n_Y - n_Y_start - 1) * nb_Y_INNER;
+	    MOVE_SUBMATRIX(BR_row, nb_Y_INNER, S, R, R, mb_Y, T, i_start_T, j_start_T, mb_T);
+        }
+        /* South east corner */
+        else if( (n_Y == n_Y_end) && (n_Y_start != n_Y_end) ){
+            i_start_T = offset_row + TL_row + (m_Y_end - m_Y_start - 1) * mb_Y_INNER;
+            j_start_T = offset_col + TL_col + (n_Y_end - n_Y_start - 1) * nb_Y_INNER;
+	    MOVE_SUBMATRIX(BR_row, BR_col, SE, R, R, mb_Y, T, i_start_T, j_start_T, mb_T);
+        }
+    }
+}
+
+#define PARSEC_redistribute_no_optimization_TARGET_ADT    (&__parsec_tp->super.arenas_datatypes[PARSEC_redistribute_no_optimization_TARGET_ADT_IDX])
+#define PARSEC_redistribute_no_optimization_DEFAULT_ADT    (&__parsec_tp->super.arenas_datatypes[PARSEC_redistribute_no_optimization_DEFAULT_ADT_IDX])
+#define PARSEC_redistribute_no_optimization_SOURCE_ADT    (&__parsec_tp->super.arenas_datatypes[PARSEC_redistribute_no_optimization_SOURCE_ADT_IDX])
+#include "redistribute_no_optimization.h"
+
+struct __parsec_redistribute_no_optimization_internal_taskpool_s {
+ parsec_redistribute_no_optimization_taskpool_t super;
+ volatile int32_t sync_point;
+ volatile int32_t initial_number_tasks;
+ parsec_task_t* startup_queue;
+  /* The ranges to compute the hash key */
+  int Receive_m_T_min;
+  int Receive_m_T_range;
+  int Receive_n_T_min;
+  int Receive_n_T_range;
+  int Receive_batch_col_min;
+  int Receive_batch_col_range;
+  int Update_m_Y_min;
+  int Update_m_Y_range;
+  int Update_n_Y_min;
+  int Update_n_Y_range;
+  int Update_m_T_min;
+  int Update_m_T_range;
+  int Update_n_T_min;
+  int Update_n_T_range;
+  int Update_batch_col_min;
+  int Update_batch_col_range;
+  int Send_m_Y_min;
+  int Send_m_Y_range;
+  int Send_n_Y_min;
+  int Send_n_Y_range;
+  int Send_m_T_min;
+  int Send_m_T_range;
+  int Send_n_T_min;
+  int Send_n_T_range;
+  int Send_batch_col_min;
+  int Send_batch_col_range;
+  int Init_m_T_min;
+  int Init_m_T_range;
+  int Init_n_T_min;
+  int Init_n_T_range;
+  int Init_batch_col_min;
+  int Init_batch_col_range;
+  /* The list of data repositories  Receive  Send  Init */
+  data_repo_t* repositories[4];
+};
+
+#if defined(PARSEC_PROF_TRACE)
+#  if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+static int redistribute_no_optimization_profiling_array[4*PARSEC_redistribute_no_optimization_NB_TASK_CLASSES] = {-2}; /* 2 pairs (begin, end) per task, times two because each task class has an internal_init task */
+#  else /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+static int redistribute_no_optimization_profiling_array[2*PARSEC_redistribute_no_optimization_NB_TASK_CLASSES] = {-2}; /* 2 pairs (begin, end) per task */
+#  endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+#endif  /* defined(PARSEC_PROF_TRACE) */
+/* Globals */
+#define descY __parsec_tp->super._g_descY
+#define descT __parsec_tp->super._g_descT
+#define size_row (__parsec_tp->super._g_size_row)
+#define size_col (__parsec_tp->super._g_size_col)
+#define disi_Y (__parsec_tp->super._g_disi_Y)
+#define disj_Y (__parsec_tp->super._g_disj_Y)
+#define disi_T (__parsec_tp->super._g_disi_T)
+#define disj_T (__parsec_tp->super._g_disj_T)
+#define R (__parsec_tp->super._g_R)
+#define mb_Y_INNER (__parsec_tp->super._g_mb_Y_INNER)
+#define nb_Y_INNER (__parsec_tp->super._g_nb_Y_INNER)
+#define mb_T_INNER (__parsec_tp->super._g_mb_T_INNER)
+#define nb_T_INNER (__parsec_tp->super._g_nb_T_INNER)
+#define m_T_START (__parsec_tp->super._g_m_T_START)
+#define n_T_START (__parsec_tp->super._g_n_T_START)
+#define m_T_END (__parsec_tp->super._g_m_T_END)
+#define n_T_END (__parsec_tp->super._g_n_T_END)
+#define num_col (__parsec_tp->super._g_num_col)
+#define NT (__parsec_tp->super._g_NT)
+
+static inline int parsec_imin(int a, int b) { return (a <= b) ? a : b; };
+
+static inline int parsec_imax(int a, int b) { return (a >= b) ? a : b; };
+
+static inline int32_t redistribute_no_optimization_Receive_inline_c_expr1_line_331(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Receive_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Receive */
+  const int batch_col = assignments->batch_col.value; (void)batch_col;
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int mb_T_inner = assignments->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = assignments->nb_T_inner.value; (void)nb_T_inner;
+  const int nb_T_inner_next = assignments->nb_T_inner_next.value; (void)nb_T_inner_next;
+  const int sizei_T = assignments->sizei_T.value; (void)sizei_T;
+  const int sizej_T = assignments->sizej_T.value; (void)sizej_T;
+  const int i_start = assignments->i_start.value; (void)i_start;
+  const int j_start = assignments->j_start.value; (void)j_start;
+  const int m_Y_start = assignments->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = assignments->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = assignments->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = assignments->n_Y_end.value; (void)n_Y_end;
+  const int n_Y_start_next = assignments->n_Y_start_next.value; (void)n_Y_start_next;
+  const int n_Y_end_next = assignments->n_Y_end_next.value; (void)n_Y_end_next;
+
+  (void)batch_col;  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)nb_T_inner_next;  (void)sizei_T;  (void)sizej_T;  (void)i_start;  (void)j_start;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;  (void)n_Y_start_next;  (void)n_Y_end_next;
+
+ return ((n_T == n_T_START)? (disj_Y+nb_T_inner-1)/nb_Y_INNER: (sizej_T+disj_Y+nb_T_inner-1)/nb_Y_INNER); 
+}
+
+static inline int32_t redistribute_no_optimization_Receive_inline_c_expr2_line_330(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Receive_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Receive */
+  const int batch_col = assignments->batch_col.value; (void)batch_col;
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int mb_T_inner = assignments->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = assignments->nb_T_inner.value; (void)nb_T_inner;
+  const int nb_T_inner_next = assignments->nb_T_inner_next.value; (void)nb_T_inner_next;
+  const int sizei_T = assignments->sizei_T.value; (void)sizei_T;
+  const int sizej_T = assignments->sizej_T.value; (void)sizej_T;
+  const int i_start = assignments->i_start.value; (void)i_start;
+  const int j_start = assignments->j_start.value; (void)j_start;
+  const int m_Y_start = assignments->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = assignments->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = assignments->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = assignments->n_Y_end.value; (void)n_Y_end;
+  const int n_Y_start_next = assignments->n_Y_start_next.value; (void)n_Y_start_next;
+  const int n_Y_end_next = assignments->n_Y_end_next.value; (void)n_Y_end_next;
+
+  (void)batch_col;  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)nb_T_inner_next;  (void)sizei_T;  (void)sizej_T;  (void)i_start;  (void)j_start;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;  (void)n_Y_start_next;  (void)n_Y_end_next;
+
+ return ((m_T == m_T_START)? (disi_Y+mb_T_inner-1)/mb_Y_INNER: (sizei_T+disi_Y+mb_T_inner-1)/mb_Y_INNER); 
+}
+
+static inline int32_t redistribute_no_optimization_Receive_inline_c_expr3_line_329(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Receive_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Receive */
+  const int batch_col = assignments->batch_col.value; (void)batch_col;
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int mb_T_inner = assignments->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = assignments->nb_T_inner.value; (void)nb_T_inner;
+  const int nb_T_inner_next = assignments->nb_T_inner_next.value; (void)nb_T_inner_next;
+  const int sizei_T = assignments->sizei_T.value; (void)sizei_T;
+  const int sizej_T = assignments->sizej_T.value; (void)sizej_T;
+  const int i_start = assignments->i_start.value; (void)i_start;
+  const int j_start = assignments->j_start.value; (void)j_start;
+  const int m_Y_start = assignments->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = assignments->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = assignments->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = assignments->n_Y_end.value; (void)n_Y_end;
+  const int n_Y_start_next = assignments->n_Y_start_next.value; (void)n_Y_start_next;
+  const int n_Y_end_next = assignments->n_Y_end_next.value; (void)n_Y_end_next;
+
+  (void)batch_col;  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)nb_T_inner_next;  (void)sizei_T;  (void)sizej_T;  (void)i_start;  (void)j_start;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;  (void)n_Y_start_next;  (void)n_Y_end_next;
+
+ return ((n_T == n_T_START)? disj_Y/nb_Y_INNER: (sizej_T+disj_Y)/nb_Y_INNER); 
+}
+
+static inline int32_t redistribute_no_optimization_Receive_inline_c_expr4_line_328(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Receive_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Receive */
+  const int batch_col = assignments->batch_col.value; (void)batch_col;
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int mb_T_inner = assignments->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = assignments->nb_T_inner.value; (void)nb_T_inner;
+  const int nb_T_inner_next = assignments->nb_T_inner_next.value; (void)nb_T_inner_next;
+  const int sizei_T = assignments->sizei_T.value; (void)sizei_T;
+  const int sizej_T = assignments->sizej_T.value; (void)sizej_T;
+  const int i_start = assignments->i_start.value; (void)i_start;
+  const int j_start = assignments->j_start.value; (void)j_start;
+  const int m_Y_start = assignments->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = assignments->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = assignments->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = assignments->n_Y_end.value; (void)n_Y_end;
+  const int n_Y_start_next = assignments->n_Y_start_next.value; (void)n_Y_start_next;
+  const int n_Y_end_next = assignments->n_Y_end_next.value; (void)n_Y_end_next;
+
+  (void)batch_col;  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)nb_T_inner_next;  (void)sizei_T;  (void)sizej_T;  (void)i_start;  (void)j_start;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;  (void)n_Y_start_next;  (void)n_Y_end_next;
+
+ return ((m_T == m_T_START)? disi_Y/mb_Y_INNER: (sizei_T+disi_Y)/mb_Y_INNER); 
+}
+
+static inline int32_t redistribute_no_optimization_Receive_inline_c_expr5_line_326(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Receive_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Receive */
+  const int batch_col = assignments->batch_col.value; (void)batch_col;
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int mb_T_inner = assignments->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = assignments->nb_T_inner.value; (void)nb_T_inner;
+  const int nb_T_inner_next = assignments->nb_T_inner_next.value; (void)nb_T_inner_next;
+  const int sizei_T = assignments->sizei_T.value; (void)sizei_T;
+  const int sizej_T = assignments->sizej_T.value; (void)sizej_T;
+  const int i_start = assignments->i_start.value; (void)i_start;
+  const int j_start = assignments->j_start.value; (void)j_start;
+  const int m_Y_start = assignments->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = assignments->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = assignments->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = assignments->n_Y_end.value; (void)n_Y_end;
+  const int n_Y_start_next = assignments->n_Y_start_next.value; (void)n_Y_start_next;
+  const int n_Y_end_next = assignments->n_Y_end_next.value; (void)n_Y_end_next;
+
+  (void)batch_col;  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)nb_T_inner_next;  (void)sizei_T;  (void)sizej_T;  (void)i_start;  (void)j_start;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;  (void)n_Y_start_next;  (void)n_Y_end_next;
+
+ return ((n_T == n_T_START)? disj_Y%nb_Y_INNER: (sizej_T+disj_Y)%nb_Y_INNER); 
+}
+
+static inline int32_t redistribute_no_optimization_Receive_inline_c_expr6_line_325(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Receive_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Receive */
+  const int batch_col = assignments->batch_col.value; (void)batch_col;
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int mb_T_inner = assignments->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = assignments->nb_T_inner.value; (void)nb_T_inner;
+  const int nb_T_inner_next = assignments->nb_T_inner_next.value; (void)nb_T_inner_next;
+  const int sizei_T = assignments->sizei_T.value; (void)sizei_T;
+  const int sizej_T = assignments->sizej_T.value; (void)sizej_T;
+  const int i_start = assignments->i_start.value; (void)i_start;
+  const int j_start = assignments->j_start.value; (void)j_start;
+  const int m_Y_start = assignments->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = assignments->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = assignments->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = assignments->n_Y_end.value; (void)n_Y_end;
+  const int n_Y_start_next = assignments->n_Y_start_next.value; (void)n_Y_start_next;
+  const int n_Y_end_next = assignments->n_Y_end_next.value; (void)n_Y_end_next;
+
+  (void)batch_col;  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)nb_T_inner_next;  (void)sizei_T;  (void)sizej_T;  (void)i_start;  (void)j_start;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;  (void)n_Y_start_next;  (void)n_Y_end_next;
+
+ return ((m_T == m_T_START)? disi_Y%mb_Y_INNER: (sizei_T+disi_Y)%mb_Y_INNER); 
+}
+
+static inline int32_t redistribute_no_optimization_Receive_inline_c_expr7_line_320(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Receive_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Receive */
+  const int batch_col = assignments->batch_col.value; (void)batch_col;
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int mb_T_inner = assignments->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = assignments->nb_T_inner.value; (void)nb_T_inner;
+  const int nb_T_inner_next = assignments->nb_T_inner_next.value; (void)nb_T_inner_next;
+  const int sizei_T = assignments->sizei_T.value; (void)sizei_T;
+  const int sizej_T = assignments->sizej_T.value; (void)sizej_T;
+  const int i_start = assignments->i_start.value; (void)i_start;
+  const int j_start = assignments->j_start.value; (void)j_start;
+  const int m_Y_start = assignments->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = assignments->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = assignments->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = assignments->n_Y_end.value; (void)n_Y_end;
+  const int n_Y_start_next = assignments->n_Y_start_next.value; (void)n_Y_start_next;
+  const int n_Y_end_next = assignments->n_Y_end_next.value; (void)n_Y_end_next;
+
+  (void)batch_col;  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)nb_T_inner_next;  (void)sizei_T;  (void)sizej_T;  (void)i_start;  (void)j_start;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;  (void)n_Y_start_next;  (void)n_Y_end_next;
+
+ return getsize(n_T+num_col, n_T_START, n_T_END, nb_T_INNER, size_col, disj_T%nb_T_INNER); 
+}
+
+static inline int32_t redistribute_no_optimization_Receive_inline_c_expr8_line_318(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Receive_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Receive */
+  const int batch_col = assignments->batch_col.value; (void)batch_col;
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int mb_T_inner = assignments->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = assignments->nb_T_inner.value; (void)nb_T_inner;
+  const int nb_T_inner_next = assignments->nb_T_inner_next.value; (void)nb_T_inner_next;
+  const int sizei_T = assignments->sizei_T.value; (void)sizei_T;
+  const int sizej_T = assignments->sizej_T.value; (void)sizej_T;
+  const int i_start = assignments->i_start.value; (void)i_start;
+  const int j_start = assignments->j_start.value; (void)j_start;
+  const int m_Y_start = assignments->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = assignments->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = assignments->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = assignments->n_Y_end.value; (void)n_Y_end;
+  const int n_Y_start_next = assignments->n_Y_start_next.value; (void)n_Y_start_next;
+  const int n_Y_end_next = assignments->n_Y_end_next.value; (void)n_Y_end_next;
+
+  (void)batch_col;  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)nb_T_inner_next;  (void)sizei_T;  (void)sizej_T;  (void)i_start;  (void)j_start;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;  (void)n_Y_start_next;  (void)n_Y_end_next;
+
+ return getsize(n_T, n_T_START, n_T_END, nb_T_INNER, size_col, disj_T%nb_T_INNER); 
+}
+
+static inline int32_t redistribute_no_optimization_Receive_inline_c_expr9_line_317(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Receive_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Receive */
+  const int batch_col = assignments->batch_col.value; (void)batch_col;
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int mb_T_inner = assignments->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = assignments->nb_T_inner.value; (void)nb_T_inner;
+  const int nb_T_inner_next = assignments->nb_T_inner_next.value; (void)nb_T_inner_next;
+  const int sizei_T = assignments->sizei_T.value; (void)sizei_T;
+  const int sizej_T = assignments->sizej_T.value; (void)sizej_T;
+  const int i_start = assignments->i_start.value; (void)i_start;
+  const int j_start = assignments->j_start.value; (void)j_start;
+  const int m_Y_start = assignments->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = assignments->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = assignments->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = assignments->n_Y_end.value; (void)n_Y_end;
+  const int n_Y_start_next = assignments->n_Y_start_next.value; (void)n_Y_start_next;
+  const int n_Y_end_next = assignments->n_Y_end_next.value; (void)n_Y_end_next;
+
+  (void)batch_col;  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)nb_T_inner_next;  (void)sizei_T;  (void)sizej_T;  (void)i_start;  (void)j_start;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;  (void)n_Y_start_next;  (void)n_Y_end_next;
+
+ return getsize(m_T, m_T_START, m_T_END, mb_T_INNER, size_row, disi_T%mb_T_INNER); 
+}
+
+static inline int32_t redistribute_no_optimization_Receive_inline_c_expr10_line_315(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Receive_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Receive */
+  const int batch_col = assignments->batch_col.value; (void)batch_col;
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int mb_T_inner = assignments->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = assignments->nb_T_inner.value; (void)nb_T_inner;
+  const int nb_T_inner_next = assignments->nb_T_inner_next.value; (void)nb_T_inner_next;
+  const int sizei_T = assignments->sizei_T.value; (void)sizei_T;
+  const int sizej_T = assignments->sizej_T.value; (void)sizej_T;
+  const int i_start = assignments->i_start.value; (void)i_start;
+  const int j_start = assignments->j_start.value; (void)j_start;
+  const int m_Y_start = assignments->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = assignments->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = assignments->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = assignments->n_Y_end.value; (void)n_Y_end;
+  const int n_Y_start_next = assignments->n_Y_start_next.value; (void)n_Y_start_next;
+  const int n_Y_end_next = assignments->n_Y_end_next.value; (void)n_Y_end_next;
+
+  (void)batch_col;  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)nb_T_inner_next;  (void)sizei_T;  (void)sizej_T;  (void)i_start;  (void)j_start;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;  (void)n_Y_start_next;  (void)n_Y_end_next;
+
+ return parsec_imin((batch_col+1)*num_col+n_T_START-1, n_T_END); 
+}
+
+static inline int32_t redistribute_no_optimization_Receive_inline_c_expr11_line_315(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Receive_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Receive */
+  const int batch_col = assignments->batch_col.value; (void)batch_col;
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int mb_T_inner = assignments->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = assignments->nb_T_inner.value; (void)nb_T_inner;
+  const int nb_T_inner_next = assignments->nb_T_inner_next.value; (void)nb_T_inner_next;
+  const int sizei_T = assignments->sizei_T.value; (void)sizei_T;
+  const int sizej_T = assignments->sizej_T.value; (void)sizej_T;
+  const int i_start = assignments->i_start.value; (void)i_start;
+  const int j_start = assignments->j_start.value; (void)j_start;
+  const int m_Y_start = assignments->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = assignments->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = assignments->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = assignments->n_Y_end.value; (void)n_Y_end;
+  const int n_Y_start_next = assignments->n_Y_start_next.value; (void)n_Y_start_next;
+  const int n_Y_end_next = assignments->n_Y_end_next.value; (void)n_Y_end_next;
+
+  (void)batch_col;  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)nb_T_inner_next;  (void)sizei_T;  (void)sizej_T;  (void)i_start;  (void)j_start;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;  (void)n_Y_start_next;  (void)n_Y_end_next;
+
+ return batch_col*num_col+n_T_START; 
+}
+
+static inline int32_t redistribute_no_optimization_Update_inline_c_expr12_line_266(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Update_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Update */
+  const int batch_col = assignments->batch_col.value; (void)batch_col;
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int mb_T_inner = assignments->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = assignments->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = assignments->i_start.value; (void)i_start;
+  const int j_start = assignments->j_start.value; (void)j_start;
+  const int m_Y_start = assignments->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = assignments->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = assignments->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = assignments->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = assignments->m_Y.value; (void)m_Y;
+  const int n_Y = assignments->n_Y.value; (void)n_Y;
+  const int TL_row = assignments->TL_row.value; (void)TL_row;
+  const int TL_col = assignments->TL_col.value; (void)TL_col;
+  const int BR_row = assignments->BR_row.value; (void)BR_row;
+  const int BR_col = assignments->BR_col.value; (void)BR_col;
+
+  (void)batch_col;  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)i_start;  (void)j_start;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;  (void)m_Y;  (void)n_Y;  (void)TL_row;  (void)TL_col;  (void)BR_row;  (void)BR_col;
+
+ return parsec_imin(nb_T_inner, nb_Y_INNER-j_start); 
+}
+
+static inline int32_t redistribute_no_optimization_Update_inline_c_expr13_line_265(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Update_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Update */
+  const int batch_col = assignments->batch_col.value; (void)batch_col;
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int mb_T_inner = assignments->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = assignments->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = assignments->i_start.value; (void)i_start;
+  const int j_start = assignments->j_start.value; (void)j_start;
+  const int m_Y_start = assignments->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = assignments->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = assignments->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = assignments->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = assignments->m_Y.value; (void)m_Y;
+  const int n_Y = assignments->n_Y.value; (void)n_Y;
+  const int TL_row = assignments->TL_row.value; (void)TL_row;
+  const int TL_col = assignments->TL_col.value; (void)TL_col;
+  const int BR_row = assignments->BR_row.value; (void)BR_row;
+  const int BR_col = assignments->BR_col.value; (void)BR_col;
+
+  (void)batch_col;  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)i_start;  (void)j_start;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;  (void)m_Y;  (void)n_Y;  (void)TL_row;  (void)TL_col;  (void)BR_row;  (void)BR_col;
+
+ return parsec_imin(mb_T_inner, mb_Y_INNER-i_start); 
+}
+
+static inline int32_t redistribute_no_optimization_Update_inline_c_expr14_line_260(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Update_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Update */
+  const int batch_col = assignments->batch_col.value; (void)batch_col;
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int mb_T_inner = assignments->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = assignments->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = assignments->i_start.value; (void)i_start;
+  const int j_start = assignments->j_start.value; (void)j_start;
+  const int m_Y_start = assignments->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = assignments->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = assignments->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = assignments->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = assignments->m_Y.value; (void)m_Y;
+  const int n_Y = assignments->n_Y.value; (void)n_Y;
+  const int TL_row = assignments->TL_row.value; (void)TL_row;
+  const int TL_col = assignments->TL_col.value; (void)TL_col;
+  const int BR_row = assignments->BR_row.value; (void)BR_row;
+  const int BR_col = assignments->BR_col.value; (void)BR_col;
+
+  (void)batch_col;  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)i_start;  (void)j_start;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;  (void)m_Y;  (void)n_Y;  (void)TL_row;  (void)TL_col;  (void)BR_row;  (void)BR_col;
+
+ return ((n_T == n_T_START)? (disj_Y+nb_T_inner-1)/nb_Y_INNER: (((n_T-n_T_START)*nb_T_INNER-disj_T%nb_T_INNER)+disj_Y+nb_T_inner-1)/nb_Y_INNER); 
+}
+
+static inline int32_t redistribute_no_optimization_Update_inline_c_expr15_line_259(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Update_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Update */
+  const int batch_col = assignments->batch_col.value; (void)batch_col;
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int mb_T_inner = assignments->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = assignments->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = assignments->i_start.value; (void)i_start;
+  const int j_start = assignments->j_start.value; (void)j_start;
+  const int m_Y_start = assignments->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = assignments->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = assignments->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = assignments->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = assignments->m_Y.value; (void)m_Y;
+  const int n_Y = assignments->n_Y.value; (void)n_Y;
+  const int TL_row = assignments->TL_row.value; (void)TL_row;
+  const int TL_col = assignments->TL_col.value; (void)TL_col;
+  const int BR_row = assignments->BR_row.value; (void)BR_row;
+  const int BR_col = assignments->BR_col.value; (void)BR_col;
+
+  (void)batch_col;  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)i_start;  (void)j_start;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;  (void)m_Y;  (void)n_Y;  (void)TL_row;  (void)TL_col;  (void)BR_row;  (void)BR_col;
+
+ return ((m_T == m_T_START)? (disi_Y+mb_T_inner-1)/mb_Y_INNER: (((m_T-m_T_START)*mb_T_INNER-disi_T%mb_T_INNER)+disi_Y+mb_T_inner-1)/mb_Y_INNER); 
+}
+
+static inline int32_t redistribute_no_optimization_Update_inline_c_expr16_line_258(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Update_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Update */
+  const int batch_col = assignments->batch_col.value; (void)batch_col;
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int mb_T_inner = assignments->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = assignments->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = assignments->i_start.value; (void)i_start;
+  const int j_start = assignments->j_start.value; (void)j_start;
+  const int m_Y_start = assignments->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = assignments->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = assignments->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = assignments->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = assignments->m_Y.value; (void)m_Y;
+  const int n_Y = assignments->n_Y.value; (void)n_Y;
+  const int TL_row = assignments->TL_row.value; (void)TL_row;
+  const int TL_col = assignments->TL_col.value; (void)TL_col;
+  const int BR_row = assignments->BR_row.value; (void)BR_row;
+  const int BR_col = assignments->BR_col.value; (void)BR_col;
+
+  (void)batch_col;  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)i_start;  (void)j_start;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;  (void)m_Y;  (void)n_Y;  (void)TL_row;  (void)TL_col;  (void)BR_row;  (void)BR_col;
+
+ return ((n_T == n_T_START)? disj_Y/nb_Y_INNER: (((n_T-n_T_START)*nb_T_INNER-disj_T%nb_T_INNER)+disj_Y)/nb_Y_INNER); 
+}
+
+static inline int32_t redistribute_no_optimization_Update_inline_c_expr17_line_257(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Update_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Update */
+  const int batch_col = assignments->batch_col.value; (void)batch_col;
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int mb_T_inner = assignments->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = assignments->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = assignments->i_start.value; (void)i_start;
+  const int j_start = assignments->j_start.value; (void)j_start;
+  const int m_Y_start = assignments->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = assignments->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = assignments->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = assignments->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = assignments->m_Y.value; (void)m_Y;
+  const int n_Y = assignments->n_Y.value; (void)n_Y;
+  const int TL_row = assignments->TL_row.value; (void)TL_row;
+  const int TL_col = assignments->TL_col.value; (void)TL_col;
+  const int BR_row = assignments->BR_row.value; (void)BR_row;
+  const int BR_col = assignments->BR_col.value; (void)BR_col;
+
+  (void)batch_col;  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)i_start;  (void)j_start;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;  (void)m_Y;  (void)n_Y;  (void)TL_row;  (void)TL_col;  (void)BR_row;  (void)BR_col;
+
+ return ((m_T == m_T_START)? disi_Y/mb_Y_INNER: (((m_T-m_T_START)*mb_T_INNER-disi_T%mb_T_INNER)+disi_Y)/mb_Y_INNER); 
+}
+
+static inline int32_t redistribute_no_optimization_Update_inline_c_expr18_line_255(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Update_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Update */
+  const int batch_col = assignments->batch_col.value; (void)batch_col;
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int mb_T_inner = assignments->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = assignments->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = assignments->i_start.value; (void)i_start;
+  const int j_start = assignments->j_start.value; (void)j_start;
+  const int m_Y_start = assignments->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = assignments->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = assignments->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = assignments->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = assignments->m_Y.value; (void)m_Y;
+  const int n_Y = assignments->n_Y.value; (void)n_Y;
+  const int TL_row = assignments->TL_row.value; (void)TL_row;
+  const int TL_col = assignments->TL_col.value; (void)TL_col;
+  const int BR_row = assignments->BR_row.value; (void)BR_row;
+  const int BR_col = assignments->BR_col.value; (void)BR_col;
+
+  (void)batch_col;  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)i_start;  (void)j_start;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;  (void)m_Y;  (void)n_Y;  (void)TL_row;  (void)TL_col;  (void)BR_row;  (void)BR_col;
+
+ return ((n_T == n_T_START)? disj_Y%nb_Y_INNER: (((n_T-n_T_START)*nb_T_INNER-disj_T%nb_T_INNER)+disj_Y)%nb_Y_INNER); 
+}
+
+static inline int32_t redistribute_no_optimization_Update_inline_c_expr19_line_254(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Update_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Update */
+  const int batch_col = assignments->batch_col.value; (void)batch_col;
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int mb_T_inner = assignments->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = assignments->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = assignments->i_start.value; (void)i_start;
+  const int j_start = assignments->j_start.value; (void)j_start;
+  const int m_Y_start = assignments->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = assignments->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = assignments->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = assignments->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = assignments->m_Y.value; (void)m_Y;
+  const int n_Y = assignments->n_Y.value; (void)n_Y;
+  const int TL_row = assignments->TL_row.value; (void)TL_row;
+  const int TL_col = assignments->TL_col.value; (void)TL_col;
+  const int BR_row = assignments->BR_row.value; (void)BR_row;
+  const int BR_col = assignments->BR_col.value; (void)BR_col;
+
+  (void)batch_col;  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)i_start;  (void)j_start;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;  (void)m_Y;  (void)n_Y;  (void)TL_row;  (void)TL_col;  (void)BR_row;  (void)BR_col;
+
+ return ((m_T == m_T_START)? disi_Y%mb_Y_INNER: (((m_T-m_T_START)*mb_T_INNER-disi_T%mb_T_INNER)+disi_Y)%mb_Y_INNER); 
+}
+
+static inline int32_t redistribute_no_optimization_Update_inline_c_expr20_line_252(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Update_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Update */
+  const int batch_col = assignments->batch_col.value; (void)batch_col;
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int mb_T_inner = assignments->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = assignments->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = assignments->i_start.value; (void)i_start;
+  const int j_start = assignments->j_start.value; (void)j_start;
+  const int m_Y_start = assignments->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = assignments->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = assignments->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = assignments->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = assignments->m_Y.value; (void)m_Y;
+  const int n_Y = assignments->n_Y.value; (void)n_Y;
+  const int TL_row = assignments->TL_row.value; (void)TL_row;
+  const int TL_col = assignments->TL_col.value; (void)TL_col;
+  const int BR_row = assignments->BR_row.value; (void)BR_row;
+  const int BR_col = assignments->BR_col.value; (void)BR_col;
+
+  (void)batch_col;  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)i_start;  (void)j_start;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;  (void)m_Y;  (void)n_Y;  (void)TL_row;  (void)TL_col;  (void)BR_row;  (void)BR_col;
+
+ return getsize(n_T, n_T_START, n_T_END, nb_T_INNER, size_col, disj_T%nb_T_INNER); 
+}
+
+static inline int32_t redistribute_no_optimization_Update_inline_c_expr21_line_251(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Update_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Update */
+  const int batch_col = assignments->batch_col.value; (void)batch_col;
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int mb_T_inner = assignments->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = assignments->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = assignments->i_start.value; (void)i_start;
+  const int j_start = assignments->j_start.value; (void)j_start;
+  const int m_Y_start = assignments->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = assignments->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = assignments->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = assignments->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = assignments->m_Y.value; (void)m_Y;
+  const int n_Y = assignments->n_Y.value; (void)n_Y;
+  const int TL_row = assignments->TL_row.value; (void)TL_row;
+  const int TL_col = assignments->TL_col.value; (void)TL_col;
+  const int BR_row = assignments->BR_row.value; (void)BR_row;
+  const int BR_col = assignments->BR_col.value; (void)BR_col;
+
+  (void)batch_col;  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)i_start;  (void)j_start;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;  (void)m_Y;  (void)n_Y;  (void)TL_row;  (void)TL_col;  (void)BR_row;  (void)BR_col;
+
+ return getsize(m_T, m_T_START, m_T_END, mb_T_INNER, size_row, disi_T%mb_T_INNER); 
+}
+
+static inline int32_t redistribute_no_optimization_Update_inline_c_expr22_line_249(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Update_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Update */
+  const int batch_col = assignments->batch_col.value; (void)batch_col;
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int mb_T_inner = assignments->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = assignments->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = assignments->i_start.value; (void)i_start;
+  const int j_start = assignments->j_start.value; (void)j_start;
+  const int m_Y_start = assignments->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = assignments->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = assignments->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = assignments->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = assignments->m_Y.value; (void)m_Y;
+  const int n_Y = assignments->n_Y.value; (void)n_Y;
+  const int TL_row = assignments->TL_row.value; (void)TL_row;
+  const int TL_col = assignments->TL_col.value; (void)TL_col;
+  const int BR_row = assignments->BR_row.value; (void)BR_row;
+  const int BR_col = assignments->BR_col.value; (void)BR_col;
+
+  (void)batch_col;  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)i_start;  (void)j_start;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;  (void)m_Y;  (void)n_Y;  (void)TL_row;  (void)TL_col;  (void)BR_row;  (void)BR_col;
+
+ return parsec_imin((batch_col+1)*num_col+n_T_START-1, n_T_END); 
+}
+
+static inline int32_t redistribute_no_optimization_Update_inline_c_expr23_line_249(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Update_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Update */
+  const int batch_col = assignments->batch_col.value; (void)batch_col;
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int mb_T_inner = assignments->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = assignments->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = assignments->i_start.value; (void)i_start;
+  const int j_start = assignments->j_start.value; (void)j_start;
+  const int m_Y_start = assignments->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = assignments->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = assignments->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = assignments->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = assignments->m_Y.value; (void)m_Y;
+  const int n_Y = assignments->n_Y.value; (void)n_Y;
+  const int TL_row = assignments->TL_row.value; (void)TL_row;
+  const int TL_col = assignments->TL_col.value; (void)TL_col;
+  const int BR_row = assignments->BR_row.value; (void)BR_row;
+  const int BR_col = assignments->BR_col.value; (void)BR_col;
+
+  (void)batch_col;  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)i_start;  (void)j_start;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;  (void)m_Y;  (void)n_Y;  (void)TL_row;  (void)TL_col;  (void)BR_row;  (void)BR_col;
+
+ return batch_col*num_col+n_T_START; 
+}
+
+static inline int32_t redistribute_no_optimization_Send_inline_c_expr24_line_213(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Send_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Send */
+  const int batch_col = assignments->batch_col.value; (void)batch_col;
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int mb_T_inner = assignments->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = assignments->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = assignments->i_start.value; (void)i_start;
+  const int j_start = assignments->j_start.value; (void)j_start;
+  const int m_Y_start = assignments->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = assignments->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = assignments->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = assignments->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = assignments->m_Y.value; (void)m_Y;
+  const int n_Y = assignments->n_Y.value; (void)n_Y;
+
+  (void)batch_col;  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)i_start;  (void)j_start;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;  (void)m_Y;  (void)n_Y;
+
+ return ((n_T == n_T_START)? (disj_Y+nb_T_inner-1)/nb_Y_INNER: (((n_T-n_T_START)*nb_T_INNER-disj_T%nb_T_INNER)+disj_Y+nb_T_inner-1)/nb_Y_INNER); 
+}
+
+static inline int32_t redistribute_no_optimization_Send_inline_c_expr25_line_212(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Send_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Send */
+  const int batch_col = assignments->batch_col.value; (void)batch_col;
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int mb_T_inner = assignments->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = assignments->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = assignments->i_start.value; (void)i_start;
+  const int j_start = assignments->j_start.value; (void)j_start;
+  const int m_Y_start = assignments->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = assignments->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = assignments->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = assignments->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = assignments->m_Y.value; (void)m_Y;
+  const int n_Y = assignments->n_Y.value; (void)n_Y;
+
+  (void)batch_col;  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)i_start;  (void)j_start;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;  (void)m_Y;  (void)n_Y;
+
+ return ((m_T == m_T_START)? (disi_Y+mb_T_inner-1)/mb_Y_INNER: (((m_T-m_T_START)*mb_T_INNER-disi_T%mb_T_INNER)+disi_Y+mb_T_inner-1)/mb_Y_INNER); 
+}
+
+static inline int32_t redistribute_no_optimization_Send_inline_c_expr26_line_211(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Send_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Send */
+  const int batch_col = assignments->batch_col.value; (void)batch_col;
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int mb_T_inner = assignments->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = assignments->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = assignments->i_start.value; (void)i_start;
+  const int j_start = assignments->j_start.value; (void)j_start;
+  const int m_Y_start = assignments->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = assignments->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = assignments->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = assignments->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = assignments->m_Y.value; (void)m_Y;
+  const int n_Y = assignments->n_Y.value; (void)n_Y;
+
+  (void)batch_col;  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)i_start;  (void)j_start;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;  (void)m_Y;  (void)n_Y;
+
+ return ((n_T == n_T_START)? disj_Y/nb_Y_INNER: (((n_T-n_T_START)*nb_T_INNER-disj_T%nb_T_INNER)+disj_Y)/nb_Y_INNER); 
+}
+
+static inline int32_t redistribute_no_optimization_Send_inline_c_expr27_line_210(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Send_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Send */
+  const int batch_col = assignments->batch_col.value; (void)batch_col;
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int mb_T_inner = assignments->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = assignments->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = assignments->i_start.value; (void)i_start;
+  const int j_start = assignments->j_start.value; (void)j_start;
+  const int m_Y_start = assignments->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = assignments->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = assignments->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = assignments->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = assignments->m_Y.value; (void)m_Y;
+  const int n_Y = assignments->n_Y.value; (void)n_Y;
+
+  (void)batch_col;  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)i_start;  (void)j_start;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;  (void)m_Y;  (void)n_Y;
+
+ return ((m_T == m_T_START)? disi_Y/mb_Y_INNER: (((m_T-m_T_START)*mb_T_INNER-disi_T%mb_T_INNER)+disi_Y)/mb_Y_INNER); 
+}
+
+static inline int32_t redistribute_no_optimization_Send_inline_c_expr28_line_208(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Send_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Send */
+  const int batch_col = assignments->batch_col.value; (void)batch_col;
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int mb_T_inner = assignments->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = assignments->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = assignments->i_start.value; (void)i_start;
+  const int j_start = assignments->j_start.value; (void)j_start;
+  const int m_Y_start = assignments->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = assignments->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = assignments->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = assignments->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = assignments->m_Y.value; (void)m_Y;
+  const int n_Y = assignments->n_Y.value; (void)n_Y;
+
+  (void)batch_col;  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)i_start;  (void)j_start;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;  (void)m_Y;  (void)n_Y;
+
+ return ((n_T == n_T_START)? disj_Y%nb_Y_INNER: (((n_T-n_T_START)*nb_T_INNER-disj_T%nb_T_INNER)+disj_Y)%nb_Y_INNER); 
+}
+
+static inline int32_t redistribute_no_optimization_Send_inline_c_expr29_line_207(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Send_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Send */
+  const int batch_col = assignments->batch_col.value; (void)batch_col;
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int mb_T_inner = assignments->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = assignments->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = assignments->i_start.value; (void)i_start;
+  const int j_start = assignments->j_start.value; (void)j_start;
+  const int m_Y_start = assignments->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = assignments->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = assignments->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = assignments->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = assignments->m_Y.value; (void)m_Y;
+  const int n_Y = assignments->n_Y.value; (void)n_Y;
+
+  (void)batch_col;  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)i_start;  (void)j_start;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;  (void)m_Y;  (void)n_Y;
+
+ return ((m_T == m_T_START)? disi_Y%mb_Y_INNER: (((m_T-m_T_START)*mb_T_INNER-disi_T%mb_T_INNER)+disi_Y)%mb_Y_INNER); 
+}
+
+static inline int32_t redistribute_no_optimization_Send_inline_c_expr30_line_205(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Send_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Send */
+  const int batch_col = assignments->batch_col.value; (void)batch_col;
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int mb_T_inner = assignments->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = assignments->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = assignments->i_start.value; (void)i_start;
+  const int j_start = assignments->j_start.value; (void)j_start;
+  const int m_Y_start = assignments->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = assignments->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = assignments->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = assignments->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = assignments->m_Y.value; (void)m_Y;
+  const int n_Y = assignments->n_Y.value; (void)n_Y;
+
+  (void)batch_col;  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)i_start;  (void)j_start;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;  (void)m_Y;  (void)n_Y;
+
+ return getsize(n_T, n_T_START, n_T_END, nb_T_INNER, size_col, disj_T%nb_T_INNER); 
+}
+
+static inline int32_t redistribute_no_optimization_Send_inline_c_expr31_line_204(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Send_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Send */
+  const int batch_col = assignments->batch_col.value; (void)batch_col;
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int mb_T_inner = assignments->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = assignments->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = assignments->i_start.value; (void)i_start;
+  const int j_start = assignments->j_start.value; (void)j_start;
+  const int m_Y_start = assignments->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = assignments->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = assignments->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = assignments->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = assignments->m_Y.value; (void)m_Y;
+  const int n_Y = assignments->n_Y.value; (void)n_Y;
+
+  (void)batch_col;  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)i_start;  (void)j_start;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;  (void)m_Y;  (void)n_Y;
+
+ return getsize(m_T, m_T_START, m_T_END, mb_T_INNER, size_row, disi_T%mb_T_INNER); 
+}
+
+static inline int32_t redistribute_no_optimization_Send_inline_c_expr32_line_202(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Send_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Send */
+  const int batch_col = assignments->batch_col.value; (void)batch_col;
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int mb_T_inner = assignments->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = assignments->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = assignments->i_start.value; (void)i_start;
+  const int j_start = assignments->j_start.value; (void)j_start;
+  const int m_Y_start = assignments->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = assignments->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = assignments->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = assignments->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = assignments->m_Y.value; (void)m_Y;
+  const int n_Y = assignments->n_Y.value; (void)n_Y;
+
+  (void)batch_col;  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)i_start;  (void)j_start;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;  (void)m_Y;  (void)n_Y;
+
+ return parsec_imin((batch_col+1)*num_col+n_T_START-1, n_T_END); 
+}
+
+static inline int32_t redistribute_no_optimization_Send_inline_c_expr33_line_202(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Send_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Send */
+  const int batch_col = assignments->batch_col.value; (void)batch_col;
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int mb_T_inner = assignments->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = assignments->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = assignments->i_start.value; (void)i_start;
+  const int j_start = assignments->j_start.value; (void)j_start;
+  const int m_Y_start = assignments->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = assignments->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = assignments->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = assignments->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = assignments->m_Y.value; (void)m_Y;
+  const int n_Y = assignments->n_Y.value; (void)n_Y;
+
+  (void)batch_col;  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)i_start;  (void)j_start;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;  (void)m_Y;  (void)n_Y;
+
+ return batch_col*num_col+n_T_START; 
+}
+
+static inline int32_t redistribute_no_optimization_Init_inline_c_expr34_line_177(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Init_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Init */
+  const int batch_col = assignments->batch_col.value; (void)batch_col;
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int mb_T_inner = assignments->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = assignments->nb_T_inner.value; (void)nb_T_inner;
+  const int sizei_T = assignments->sizei_T.value; (void)sizei_T;
+  const int sizej_T = assignments->sizej_T.value; (void)sizej_T;
+  const int m_Y_start = assignments->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = assignments->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = assignments->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = assignments->n_Y_end.value; (void)n_Y_end;
+
+  (void)batch_col;  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)sizei_T;  (void)sizej_T;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;
+
+ return ((n_T == n_T_START)? (disj_Y+nb_T_inner-1)/nb_Y_INNER: (sizej_T+disj_Y+nb_T_inner-1)/nb_Y_INNER); 
+}
+
+static inline int32_t redistribute_no_optimization_Init_inline_c_expr35_line_176(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Init_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Init */
+  const int batch_col = assignments->batch_col.value; (void)batch_col;
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int mb_T_inner = assignments->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = assignments->nb_T_inner.value; (void)nb_T_inner;
+  const int sizei_T = assignments->sizei_T.value; (void)sizei_T;
+  const int sizej_T = assignments->sizej_T.value; (void)sizej_T;
+  const int m_Y_start = assignments->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = assignments->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = assignments->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = assignments->n_Y_end.value; (void)n_Y_end;
+
+  (void)batch_col;  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)sizei_T;  (void)sizej_T;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;
+
+ return ((m_T == m_T_START)? (disi_Y+mb_T_inner-1)/mb_Y_INNER: (sizei_T+disi_Y+mb_T_inner-1)/mb_Y_INNER); 
+}
+
+static inline int32_t redistribute_no_optimization_Init_inline_c_expr36_line_175(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Init_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Init */
+  const int batch_col = assignments->batch_col.value; (void)batch_col;
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int mb_T_inner = assignments->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = assignments->nb_T_inner.value; (void)nb_T_inner;
+  const int sizei_T = assignments->sizei_T.value; (void)sizei_T;
+  const int sizej_T = assignments->sizej_T.value; (void)sizej_T;
+  const int m_Y_start = assignments->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = assignments->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = assignments->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = assignments->n_Y_end.value; (void)n_Y_end;
+
+  (void)batch_col;  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)sizei_T;  (void)sizej_T;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;
+
+ return ((n_T == n_T_START)? disj_Y/nb_Y_INNER: (sizej_T+disj_Y)/nb_Y_INNER); 
+}
+
+static inline int32_t redistribute_no_optimization_Init_inline_c_expr37_line_174(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Init_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Init */
+  const int batch_col = assignments->batch_col.value; (void)batch_col;
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int mb_T_inner = assignments->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = assignments->nb_T_inner.value; (void)nb_T_inner;
+  const int sizei_T = assignments->sizei_T.value; (void)sizei_T;
+  const int sizej_T = assignments->sizej_T.value; (void)sizej_T;
+  const int m_Y_start = assignments->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = assignments->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = assignments->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = assignments->n_Y_end.value; (void)n_Y_end;
+
+  (void)batch_col;  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)sizei_T;  (void)sizej_T;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;
+
+ return ((m_T == m_T_START)? disi_Y/mb_Y_INNER: (sizei_T+disi_Y)/mb_Y_INNER); 
+}
+
+static inline int32_t redistribute_no_optimization_Init_inline_c_expr38_line_169(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Init_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Init */
+  const int batch_col = assignments->batch_col.value; (void)batch_col;
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int mb_T_inner = assignments->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = assignments->nb_T_inner.value; (void)nb_T_inner;
+  const int sizei_T = assignments->sizei_T.value; (void)sizei_T;
+  const int sizej_T = assignments->sizej_T.value; (void)sizej_T;
+  const int m_Y_start = assignments->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = assignments->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = assignments->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = assignments->n_Y_end.value; (void)n_Y_end;
+
+  (void)batch_col;  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)sizei_T;  (void)sizej_T;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;
+
+ return getsize(n_T, n_T_START, n_T_END, nb_T_INNER, size_col, disj_T%nb_T_INNER); 
+}
+
+static inline int32_t redistribute_no_optimization_Init_inline_c_expr39_line_168(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Init_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Init */
+  const int batch_col = assignments->batch_col.value; (void)batch_col;
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int mb_T_inner = assignments->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = assignments->nb_T_inner.value; (void)nb_T_inner;
+  const int sizei_T = assignments->sizei_T.value; (void)sizei_T;
+  const int sizej_T = assignments->sizej_T.value; (void)sizej_T;
+  const int m_Y_start = assignments->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = assignments->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = assignments->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = assignments->n_Y_end.value; (void)n_Y_end;
+
+  (void)batch_col;  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)sizei_T;  (void)sizej_T;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;
+
+ return getsize(m_T, m_T_START, m_T_END, mb_T_INNER, size_row, disi_T%mb_T_INNER); 
+}
+
+static inline int32_t redistribute_no_optimization_Init_inline_c_expr40_line_166(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Init_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Init */
+  const int batch_col = assignments->batch_col.value; (void)batch_col;
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int mb_T_inner = assignments->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = assignments->nb_T_inner.value; (void)nb_T_inner;
+  const int sizei_T = assignments->sizei_T.value; (void)sizei_T;
+  const int sizej_T = assignments->sizej_T.value; (void)sizej_T;
+  const int m_Y_start = assignments->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = assignments->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = assignments->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = assignments->n_Y_end.value; (void)n_Y_end;
+
+  (void)batch_col;  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)sizei_T;  (void)sizej_T;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;
+
+ return parsec_imin((batch_col+1)*num_col+n_T_START-1, n_T_END); 
+}
+
+static inline int32_t redistribute_no_optimization_Init_inline_c_expr41_line_166(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Init_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task Init */
+  const int batch_col = assignments->batch_col.value; (void)batch_col;
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int mb_T_inner = assignments->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = assignments->nb_T_inner.value; (void)nb_T_inner;
+  const int sizei_T = assignments->sizei_T.value; (void)sizei_T;
+  const int sizej_T = assignments->sizej_T.value; (void)sizej_T;
+  const int m_Y_start = assignments->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = assignments->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = assignments->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = assignments->n_Y_end.value; (void)n_Y_end;
+
+  (void)batch_col;  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)sizei_T;  (void)sizej_T;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;
+
+ return batch_col*num_col+n_T_START; 
+}
+
+/* Data Access Macros */
+#define data_of_descY(descY_d0, descY_d1)  (((parsec_data_collection_t*)__parsec_tp->super._g_descY)->data_of((parsec_data_collection_t*)__parsec_tp->super._g_descY, (descY_d0), (descY_d1)))
+#define data_of_descT(descT_d0, descT_d1)  (((parsec_data_collection_t*)__parsec_tp->super._g_descT)->data_of((parsec_data_collection_t*)__parsec_tp->super._g_descT, (descT_d0), (descT_d1)))
+
+#define rank_of_descY(descY_d0, descY_d1)  (((parsec_data_collection_t*)__parsec_tp->super._g_descY)->rank_of((parsec_data_collection_t*)__parsec_tp->super._g_descY, (descY_d0), (descY_d1)))
+#define rank_of_descT(descT_d0, descT_d1)  (((parsec_data_collection_t*)__parsec_tp->super._g_descT)->rank_of((parsec_data_collection_t*)__parsec_tp->super._g_descT, (descT_d0), (descT_d1)))
+
+/* Functions Predicates */
+#define Receive_pred(batch_col, m_T, n_T, mb_T_inner, nb_T_inner, nb_T_inner_next, sizei_T, sizej_T, i_start, j_start, m_Y_start, n_Y_start, m_Y_end, n_Y_end, n_Y_start_next, n_Y_end_next) (((parsec_data_collection_t*)(__parsec_tp->super._g_descT))->myrank == rank_of_descT(m_T, n_T))
+#define Update_pred(batch_col, m_T, n_T, mb_T_inner, nb_T_inner, i_start, j_start, m_Y_start, n_Y_start, m_Y_end, n_Y_end, m_Y, n_Y, TL_row, TL_col, BR_row, BR_col) (((parsec_data_collection_t*)(__parsec_tp->super._g_descT))->myrank == rank_of_descT(m_T, n_T))
+#define Send_pred(batch_col, m_T, n_T, mb_T_inner, nb_T_inner, i_start, j_start, m_Y_start, n_Y_start, m_Y_end, n_Y_end, m_Y, n_Y) (((parsec_data_collection_t*)(__parsec_tp->super._g_descY))->myrank == rank_of_descY(m_Y, n_Y))
+#define Init_pred(batch_col, m_T, n_T, mb_T_inner, nb_T_inner, sizei_T, sizej_T, m_Y_start, n_Y_start, m_Y_end, n_Y_end) (((parsec_data_collection_t*)(__parsec_tp->super._g_descT))->myrank == rank_of_descT(m_T, n_T))
+
+/* Data Repositories */
+#define Receive_repo (__parsec_tp->repositories[3])
+#define Update_repo (__parsec_tp->repositories[2])
+#define Send_repo (__parsec_tp->repositories[1])
+#define Init_repo (__parsec_tp->repositories[0])
+/* Release dependencies output macro */
+#if defined(PARSEC_DEBUG_NOISIER)
+#define RELEASE_DEP_OUTPUT(ES, DEPO, TASKO, DEPI, TASKI, RSRC, RDST, DATA)\
+  do { \
+    char tmp1[128], tmp2[128]; (void)tmp1; (void)tmp2;\
+    PARSEC_DEBUG_VERBOSE(20, parsec_debug_output, "thread %d VP %d explore deps from %s:%s to %s:%s (from rank %d to %d) base ptr %p",\
+           (NULL != (ES) ? (ES)->th_id : -1), (NULL != (ES) ? (ES)->virtual_process->vp_id : -1),\
+           DEPO, parsec_task_snprintf(tmp1, 128, (parsec_task_t*)(TASKO)),\
+           DEPI, parsec_task_snprintf(tmp2, 128, (parsec_task_t*)(TASKI)), (RSRC), (RDST), (DATA));\
+  } while(0)
+#define ACQUIRE_FLOW(TASKI, DEPI, FUNO, DEPO, LOCALS, PTR)\
+  do { \
+    char tmp1[128], tmp2[128]; (void)tmp1; (void)tmp2;\
+    PARSEC_DEBUG_VERBOSE(20, parsec_debug_output, "task %s acquires flow %s from %s %s data ptr %p",\
+           parsec_task_snprintf(tmp1, 128, (parsec_task_t*)(TASKI)), (DEPI),\
+           (DEPO), parsec_snprintf_assignments(tmp2, 128, (FUNO), (parsec_assignment_t*)(LOCALS)), (PTR));\
+  } while(0)
+#else
+#define RELEASE_DEP_OUTPUT(ES, DEPO, TASKO, DEPI, TASKI, RSRC, RDST, DATA)
+#define ACQUIRE_FLOW(TASKI, DEPI, TASKO, DEPO, LOCALS, PTR)
+#endif
+static inline parsec_key_t __jdf2c_make_key_Receive(const parsec_taskpool_t *tp, const parsec_assignment_t *as)
+{
+  const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp = (const __parsec_redistribute_no_optimization_internal_taskpool_t *)tp;
+  const __parsec_redistribute_no_optimization_Receive_parsec_assignment_t *assignment = (const __parsec_redistribute_no_optimization_Receive_parsec_assignment_t*)as;
+  uint64_t __parsec_id = 0;
+  __parsec_id += (assignment->batch_col.value - __parsec_tp->Receive_batch_col_min);
+  __parsec_id += (assignment->m_T.value - __parsec_tp->Receive_m_T_min) * __parsec_tp->Receive_batch_col_range;
+  __parsec_id += (assignment->n_T.value - __parsec_tp->Receive_n_T_min) * __parsec_tp->Receive_batch_col_range * __parsec_tp->Receive_m_T_range;
+  return (parsec_key_t)__parsec_id;
+}
+static char *__jdf2c_key_fns_Receive_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_no_optimization_internal_taskpool_t *)user_data;
+  __parsec_redistribute_no_optimization_Receive_parsec_assignment_t __jdf2c__assignments = {  .batch_col.value = 0, .m_T.value = 0, .n_T.value = 0, .mb_T_inner.value = 0, .nb_T_inner.value = 0, .nb_T_inner_next.value = 0, .sizei_T.value = 0, .sizej_T.value = 0, .i_start.value = 0, .j_start.value = 0, .m_Y_start.value = 0, .n_Y_start.value = 0, .m_Y_end.value = 0, .n_Y_end.value = 0, .n_Y_start_next.value = 0, .n_Y_end_next.value = 0 };
+  int batch_col = (__parsec_key) % __parsec_tp->Receive_batch_col_range + __parsec_tp->Receive_batch_col_min;
+  __parsec_key = __parsec_key / __parsec_tp->Receive_batch_col_range;
+  __jdf2c__assignments.batch_col.value = batch_col;
+  int m_T = (__parsec_key) % __parsec_tp->Receive_m_T_range + __parsec_tp->Receive_m_T_min;
+  __parsec_key = __parsec_key / __parsec_tp->Receive_m_T_range;
+  __jdf2c__assignments.m_T.value = m_T;
+  int n_T = (__parsec_key) % __parsec_tp->Receive_n_T_range + __parsec_tp->Receive_n_T_min;
+  __parsec_key = __parsec_key / __parsec_tp->Receive_n_T_range;
+  __jdf2c__assignments.n_T.value = n_T;
+  int mb_T_inner = redistribute_no_optimization_Receive_inline_c_expr9_line_317(__parsec_tp, &__jdf2c__assignments);
+  (void)mb_T_inner;
+  __jdf2c__assignments.mb_T_inner.value = mb_T_inner;
+  int nb_T_inner = redistribute_no_optimization_Receive_inline_c_expr8_line_318(__parsec_tp, &__jdf2c__assignments);
+  (void)nb_T_inner;
+  __jdf2c__assignments.nb_T_inner.value = nb_T_inner;
+  int nb_T_inner_next = redistribute_no_optimization_Receive_inline_c_expr7_line_320(__parsec_tp, &__jdf2c__assignments);
+  (void)nb_T_inner_next;
+  __jdf2c__assignments.nb_T_inner_next.value = nb_T_inner_next;
+  int sizei_T = (((m_T - m_T_START) * mb_T_INNER) - (disi_T % mb_T_INNER));
+  (void)sizei_T;
+  __jdf2c__assignments.sizei_T.value = sizei_T;
+  int sizej_T = (((n_T - n_T_START) * nb_T_INNER) - (disj_T % nb_T_INNER));
+  (void)sizej_T;
+  __jdf2c__assignments.sizej_T.value = sizej_T;
+  int i_start = redistribute_no_optimization_Receive_inline_c_expr6_line_325(__parsec_tp, &__jdf2c__assignments);
+  (void)i_start;
+  __jdf2c__assignments.i_start.value = i_start;
+  int j_start = redistribute_no_optimization_Receive_inline_c_expr5_line_326(__parsec_tp, &__jdf2c__assignments);
+  (void)j_start;
+  __jdf2c__assignments.j_start.value = j_start;
+  int m_Y_start = redistribute_no_optimization_Receive_inline_c_expr4_line_328(__parsec_tp, &__jdf2c__assignments);
+  (void)m_Y_start;
+  __jdf2c__assignments.m_Y_start.value = m_Y_start;
+  int n_Y_start = redistribute_no_optimization_Receive_inline_c_expr3_line_329(__parsec_tp, &__jdf2c__assignments);
+  (void)n_Y_start;
+  __jdf2c__assignments.n_Y_start.value = n_Y_start;
+  int m_Y_end = redistribute_no_optimization_Receive_inline_c_expr2_line_330(__parsec_tp, &__jdf2c__assignments);
+  (void)m_Y_end;
+  __jdf2c__assignments.m_Y_end.value = m_Y_end;
+  int n_Y_end = redistribute_no_optimization_Receive_inline_c_expr1_line_331(__parsec_tp, &__jdf2c__assignments);
+  (void)n_Y_end;
+  __jdf2c__assignments.n_Y_end.value = n_Y_end;
+  int n_Y_start_next = ((((((n_T - n_T_START) + num_col) * nb_T_INNER) - (disj_T % nb_T_INNER)) + disj_Y) / nb_Y_INNER);
+  (void)n_Y_start_next;
+  __jdf2c__assignments.n_Y_start_next.value = n_Y_start_next;
+  int n_Y_end_next = ((((((((n_T - n_T_START) + num_col) * nb_T_INNER) - (disj_T % nb_T_INNER)) + disj_Y) + nb_T_inner_next) - 1) / nb_Y_INNER);
+  (void)n_Y_end_next;
+  __jdf2c__assignments.n_Y_end_next.value = n_Y_end_next;
+  (void)__jdf2c__assignments;
+  snprintf(buffer, buffer_size, "Receive(%d, %d, %d)", batch_col, m_T, n_T);
+  return buffer;
+}
+
+static parsec_key_fn_t __jdf2c_key_fns_Receive = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = __jdf2c_key_fns_Receive_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+static inline parsec_key_t __jdf2c_make_key_Update(const parsec_taskpool_t *tp, const parsec_assignment_t *as)
+{
+  const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp = (const __parsec_redistribute_no_optimization_internal_taskpool_t *)tp;
+  const __parsec_redistribute_no_optimization_Update_parsec_assignment_t *assignment = (const __parsec_redistribute_no_optimization_Update_parsec_assignment_t*)as;
+  uint64_t __parsec_id = 0;
+  __parsec_id += (assignment->batch_col.value - __parsec_tp->Update_batch_col_min);
+  __parsec_id += (assignment->m_T.value - __parsec_tp->Update_m_T_min) * __parsec_tp->Update_batch_col_range;
+  __parsec_id += (assignment->n_T.value - __parsec_tp->Update_n_T_min) * __parsec_tp->Update_batch_col_range * __parsec_tp->Update_m_T_range;
+  __parsec_id += (assignment->m_Y.value - __parsec_tp->Update_m_Y_min) * __parsec_tp->Update_batch_col_range * __parsec_tp->Update_m_T_range * __parsec_tp->Update_n_T_range;
+  __parsec_id += (assignment->n_Y.value - __parsec_tp->Update_n_Y_min) * __parsec_tp->Update_batch_col_range * __parsec_tp->Update_m_T_range * __parsec_tp->Update_n_T_range * __parsec_tp->Update_m_Y_range;
+  return (parsec_key_t)__parsec_id;
+}
+static char *__jdf2c_key_fns_Update_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_no_optimization_internal_taskpool_t *)user_data;
+  __parsec_redistribute_no_optimization_Update_parsec_assignment_t __jdf2c__assignments = {  .batch_col.value = 0, .m_T.value = 0, .n_T.value = 0, .mb_T_inner.value = 0, .nb_T_inner.value = 0, .i_start.value = 0, .j_start.value = 0, .m_Y_start.value = 0, .n_Y_start.value = 0, .m_Y_end.value = 0, .n_Y_end.value = 0, .m_Y.value = 0, .n_Y.value = 0, .TL_row.value = 0, .TL_col.value = 0, .BR_row.value = 0, .BR_col.value = 0 };
+  int batch_col = (__parsec_key) % __parsec_tp->Update_batch_col_range + __parsec_tp->Update_batch_col_min;
+  __parsec_key = __parsec_key / __parsec_tp->Update_batch_col_range;
+  __jdf2c__assignments.batch_col.value = batch_col;
+  int m_T = (__parsec_key) % __parsec_tp->Update_m_T_range + __parsec_tp->Update_m_T_min;
+  __parsec_key = __parsec_key / __parsec_tp->Update_m_T_range;
+  __jdf2c__assignments.m_T.value = m_T;
+  int n_T = (__parsec_key) % __parsec_tp->Update_n_T_range + __parsec_tp->Update_n_T_min;
+  __parsec_key = __parsec_key / __parsec_tp->Update_n_T_range;
+  __jdf2c__assignments.n_T.value = n_T;
+  int mb_T_inner = redistribute_no_optimization_Update_inline_c_expr21_line_251(__parsec_tp, &__jdf2c__assignments);
+  (void)mb_T_inner;
+  __jdf2c__assignments.mb_T_inner.value = mb_T_inner;
+  int nb_T_inner = redistribute_no_optimization_Update_inline_c_expr20_line_252(__parsec_tp, &__jdf2c__assignments);
+  (void)nb_T_inner;
+  __jdf2c__assignments.nb_T_inner.value = nb_T_inner;
+  int i_start = redistribute_no_optimization_Update_inline_c_expr19_line_254(__parsec_tp, &__jdf2c__assignments);
+  (void)i_start;
+  __jdf2c__assignments.i_start.value = i_start;
+  int j_start = redistribute_no_optimization_Update_inline_c_expr18_line_255(__parsec_tp, &__jdf2c__assignments);
+  (void)j_start;
+  __jdf2c__assignments.j_start.value = j_start;
+  int m_Y_start = redistribute_no_optimization_Update_inline_c_expr17_line_257(__parsec_tp, &__jdf2c__assignments);
+  (void)m_Y_start;
+  __jdf2c__assignments.m_Y_start.value = m_Y_start;
+  int n_Y_start = redistribute_no_optimization_Update_inline_c_expr16_line_258(__parsec_tp, &__jdf2c__assignments);
+  (void)n_Y_start;
+  __jdf2c__assignments.n_Y_start.value = n_Y_start;
+  int m_Y_end = redistribute_no_optimization_Update_inline_c_expr15_line_259(__parsec_tp, &__jdf2c__assignments);
+  (void)m_Y_end;
+  __jdf2c__assignments.m_Y_end.value = m_Y_end;
+  int n_Y_end = redistribute_no_optimization_Update_inline_c_expr14_line_260(__parsec_tp, &__jdf2c__assignments);
+  (void)n_Y_end;
+  __jdf2c__assignments.n_Y_end.value = n_Y_end;
+  int m_Y = (__parsec_key) % __parsec_tp->Update_m_Y_range + __parsec_tp->Update_m_Y_min;
+  __parsec_key = __parsec_key / __parsec_tp->Update_m_Y_range;
+  __jdf2c__assignments.m_Y.value = m_Y;
+  int n_Y = (__parsec_key) % __parsec_tp->Update_n_Y_range + __parsec_tp->Update_n_Y_min;
+  __parsec_key = __parsec_key / __parsec_tp->Update_n_Y_range;
+  __jdf2c__assignments.n_Y.value = n_Y;
+  int TL_row = redistribute_no_optimization_Update_inline_c_expr13_line_265(__parsec_tp, &__jdf2c__assignments);
+  (void)TL_row;
+  __jdf2c__assignments.TL_row.value = TL_row;
+  int TL_col = redistribute_no_optimization_Update_inline_c_expr12_line_266(__parsec_tp, &__jdf2c__assignments);
+  (void)TL_col;
+  __jdf2c__assignments.TL_col.value = TL_col;
+  int BR_row = ((((i_start + mb_T_inner) - 1) % mb_Y_INNER) + 1);
+  (void)BR_row;
+  __jdf2c__assignments.BR_row.value = BR_row;
+  int BR_col = ((((j_start + nb_T_inner) - 1) % nb_Y_INNER) + 1);
+  (void)BR_col;
+  __jdf2c__assignments.BR_col.value = BR_col;
+  (void)__jdf2c__assignments;
+  snprintf(buffer, buffer_size, "Update(%d, %d, %d, %d, %d)", batch_col, m_T, n_T, m_Y, n_Y);
+  return buffer;
+}
+
+static parsec_key_fn_t __jdf2c_key_fns_Update = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = __jdf2c_key_fns_Update_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+static inline parsec_key_t __jdf2c_make_key_Send(const parsec_taskpool_t *tp, const parsec_assignment_t *as)
+{
+  const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp = (const __parsec_redistribute_no_optimization_internal_taskpool_t *)tp;
+  const __parsec_redistribute_no_optimization_Send_parsec_assignment_t *assignment = (const __parsec_redistribute_no_optimization_Send_parsec_assignment_t*)as;
+  uint64_t __parsec_id = 0;
+  __parsec_id += (assignment->batch_col.value - __parsec_tp->Send_batch_col_min);
+  __parsec_id += (assignment->m_T.value - __parsec_tp->Send_m_T_min) * __parsec_tp->Send_batch_col_range;
+  __parsec_id += (assignment->n_T.value - __parsec_tp->Send_n_T_min) * __parsec_tp->Send_batch_col_range * __parsec_tp->Send_m_T_range;
+  __parsec_id += (assignment->m_Y.value - __parsec_tp->Send_m_Y_min) * __parsec_tp->Send_batch_col_range * __parsec_tp->Send_m_T_range * __parsec_tp->Send_n_T_range;
+  __parsec_id += (assignment->n_Y.value - __parsec_tp->Send_n_Y_min) * __parsec_tp->Send_batch_col_range * __parsec_tp->Send_m_T_range * __parsec_tp->Send_n_T_range * __parsec_tp->Send_m_Y_range;
+  return (parsec_key_t)__parsec_id;
+}
+static char *__jdf2c_key_fns_Send_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_no_optimization_internal_taskpool_t *)user_data;
+  __parsec_redistribute_no_optimization_Send_parsec_assignment_t __jdf2c__assignments = {  .batch_col.value = 0, .m_T.value = 0, .n_T.value = 0, .mb_T_inner.value = 0, .nb_T_inner.value = 0, .i_start.value = 0, .j_start.value = 0, .m_Y_start.value = 0, .n_Y_start.value = 0, .m_Y_end.value = 0, .n_Y_end.value = 0, .m_Y.value = 0, .n_Y.value = 0 };
+  int batch_col = (__parsec_key) % __parsec_tp->Send_batch_col_range + __parsec_tp->Send_batch_col_min;
+  __parsec_key = __parsec_key / __parsec_tp->Send_batch_col_range;
+  __jdf2c__assignments.batch_col.value = batch_col;
+  int m_T = (__parsec_key) % __parsec_tp->Send_m_T_range + __parsec_tp->Send_m_T_min;
+  __parsec_key = __parsec_key / __parsec_tp->Send_m_T_range;
+  __jdf2c__assignments.m_T.value = m_T;
+  int n_T = (__parsec_key) % __parsec_tp->Send_n_T_range + __parsec_tp->Send_n_T_min;
+  __parsec_key = __parsec_key / __parsec_tp->Send_n_T_range;
+  __jdf2c__assignments.n_T.value = n_T;
+  int mb_T_inner = redistribute_no_optimization_Send_inline_c_expr31_line_204(__parsec_tp, &__jdf2c__assignments);
+  (void)mb_T_inner;
+  __jdf2c__assignments.mb_T_inner.value = mb_T_inner;
+  int nb_T_inner = redistribute_no_optimization_Send_inline_c_expr30_line_205(__parsec_tp, &__jdf2c__assignments);
+  (void)nb_T_inner;
+  __jdf2c__assignments.nb_T_inner.value = nb_T_inner;
+  int i_start = redistribute_no_optimization_Send_inline_c_expr29_line_207(__parsec_tp, &__jdf2c__assignments);
+  (void)i_start;
+  __jdf2c__assignments.i_start.value = i_start;
+  int j_start = redistribute_no_optimization_Send_inline_c_expr28_line_208(__parsec_tp, &__jdf2c__assignments);
+  (void)j_start;
+  __jdf2c__assignments.j_start.value = j_start;
+  int m_Y_start = redistribute_no_optimization_Send_inline_c_expr27_line_210(__parsec_tp, &__jdf2c__assignments);
+  (void)m_Y_start;
+  __jdf2c__assignments.m_Y_start.value = m_Y_start;
+  int n_Y_start = redistribute_no_optimization_Send_inline_c_expr26_line_211(__parsec_tp, &__jdf2c__assignments);
+  (void)n_Y_start;
+  __jdf2c__assignments.n_Y_start.value = n_Y_start;
+  int m_Y_end = redistribute_no_optimization_Send_inline_c_expr25_line_212(__parsec_tp, &__jdf2c__assignments);
+  (void)m_Y_end;
+  __jdf2c__assignments.m_Y_end.value = m_Y_end;
+  int n_Y_end = redistribute_no_optimization_Send_inline_c_expr24_line_213(__parsec_tp, &__jdf2c__assignments);
+  (void)n_Y_end;
+  __jdf2c__assignments.n_Y_end.value = n_Y_end;
+  int m_Y = (__parsec_key) % __parsec_tp->Send_m_Y_range + __parsec_tp->Send_m_Y_min;
+  __parsec_key = __parsec_key / __parsec_tp->Send_m_Y_range;
+  __jdf2c__assignments.m_Y.value = m_Y;
+  int n_Y = (__parsec_key) % __parsec_tp->Send_n_Y_range + __parsec_tp->Send_n_Y_min;
+  __parsec_key = __parsec_key / __parsec_tp->Send_n_Y_range;
+  __jdf2c__assignments.n_Y.value = n_Y;
+  (void)__jdf2c__assignments;
+  snprintf(buffer, buffer_size, "Send(%d, %d, %d, %d, %d)", batch_col, m_T, n_T, m_Y, n_Y);
+  return buffer;
+}
+
+static parsec_key_fn_t __jdf2c_key_fns_Send = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = __jdf2c_key_fns_Send_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+static inline parsec_key_t __jdf2c_make_key_Init(const parsec_taskpool_t *tp, const parsec_assignment_t *as)
+{
+  const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp = (const __parsec_redistribute_no_optimization_internal_taskpool_t *)tp;
+  const __parsec_redistribute_no_optimization_Init_parsec_assignment_t *assignment = (const __parsec_redistribute_no_optimization_Init_parsec_assignment_t*)as;
+  uint64_t __parsec_id = 0;
+  __parsec_id += (assignment->batch_col.value - __parsec_tp->Init_batch_col_min);
+  __parsec_id += (assignment->m_T.value - __parsec_tp->Init_m_T_min) * __parsec_tp->Init_batch_col_range;
+  __parsec_id += (assignment->n_T.value - __parsec_tp->Init_n_T_min) * __parsec_tp->Init_batch_col_range * __parsec_tp->Init_m_T_range;
+  return (parsec_key_t)__parsec_id;
+}
+static char *__jdf2c_key_fns_Init_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_no_optimization_internal_taskpool_t *)user_data;
+  __parsec_redistribute_no_optimization_Init_parsec_assignment_t __jdf2c__assignments = {  .batch_col.value = 0, .m_T.value = 0, .n_T.value = 0, .mb_T_inner.value = 0, .nb_T_inner.value = 0, .sizei_T.value = 0, .sizej_T.value = 0, .m_Y_start.value = 0, .n_Y_start.value = 0, .m_Y_end.value = 0, .n_Y_end.value = 0 };
+  int batch_col = (__parsec_key) % __parsec_tp->Init_batch_col_range + __parsec_tp->Init_batch_col_min;
+  __parsec_key = __parsec_key / __parsec_tp->Init_batch_col_range;
+  __jdf2c__assignments.batch_col.value = batch_col;
+  int m_T = (__parsec_key) % __parsec_tp->Init_m_T_range + __parsec_tp->Init_m_T_min;
+  __parsec_key = __parsec_key / __parsec_tp->Init_m_T_range;
+  __jdf2c__assignments.m_T.value = m_T;
+  int n_T = (__parsec_key) % __parsec_tp->Init_n_T_range + __parsec_tp->Init_n_T_min;
+  __parsec_key = __parsec_key / __parsec_tp->Init_n_T_range;
+  __jdf2c__assignments.n_T.value = n_T;
+  int mb_T_inner = redistribute_no_optimization_Init_inline_c_expr39_line_168(__parsec_tp, &__jdf2c__assignments);
+  (void)mb_T_inner;
+  __jdf2c__assignments.mb_T_inner.value = mb_T_inner;
+  int nb_T_inner = redistribute_no_optimization_Init_inline_c_expr38_line_169(__parsec_tp, &__jdf2c__assignments);
+  (void)nb_T_inner;
+  __jdf2c__assignments.nb_T_inner.value = nb_T_inner;
+  int sizei_T = (((m_T - m_T_START) * mb_T_INNER) - (disi_T % mb_T_INNER));
+  (void)sizei_T;
+  __jdf2c__assignments.sizei_T.value = sizei_T;
+  int sizej_T = (((n_T - n_T_START) * nb_T_INNER) - (disj_T % nb_T_INNER));
+  (void)sizej_T;
+  __jdf2c__assignments.sizej_T.value = sizej_T;
+  int m_Y_start = redistribute_no_optimization_Init_inline_c_expr37_line_174(__parsec_tp, &__jdf2c__assignments);
+  (void)m_Y_start;
+  __jdf2c__assignments.m_Y_start.value = m_Y_start;
+  int n_Y_start = redistribute_no_optimization_Init_inline_c_expr36_line_175(__parsec_tp, &__jdf2c__assignments);
+  (void)n_Y_start;
+  __jdf2c__assignments.n_Y_start.value = n_Y_start;
+  int m_Y_end = redistribute_no_optimization_Init_inline_c_expr35_line_176(__parsec_tp, &__jdf2c__assignments);
+  (void)m_Y_end;
+  __jdf2c__assignments.m_Y_end.value = m_Y_end;
+  int n_Y_end = redistribute_no_optimization_Init_inline_c_expr34_line_177(__parsec_tp, &__jdf2c__assignments);
+  (void)n_Y_end;
+  __jdf2c__assignments.n_Y_end.value = n_Y_end;
+  (void)__jdf2c__assignments;
+  snprintf(buffer, buffer_size, "Init(%d, %d, %d)", batch_col, m_T, n_T);
+  return buffer;
+}
+
+static parsec_key_fn_t __jdf2c_key_fns_Init = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = __jdf2c_key_fns_Init_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/******                                    Receive                                    ******/
+
+static inline int32_t minexpr_of_symb_redistribute_no_optimization_Receive_batch_col_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Receive_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_redistribute_no_optimization_Receive_batch_col = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_redistribute_no_optimization_Receive_batch_col_fct }
+                   }
+};
+static inline int maxexpr_of_symb_redistribute_no_optimization_Receive_batch_col_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Receive_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int mb_T_inner = locals->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = locals->nb_T_inner.value; (void)nb_T_inner;
+  const int nb_T_inner_next = locals->nb_T_inner_next.value; (void)nb_T_inner_next;
+  const int sizei_T = locals->sizei_T.value; (void)sizei_T;
+  const int sizej_T = locals->sizej_T.value; (void)sizej_T;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int m_Y_start = locals->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = locals->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = locals->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = locals->n_Y_end.value; (void)n_Y_end;
+  const int n_Y_start_next = locals->n_Y_start_next.value; (void)n_Y_start_next;
+  const int n_Y_end_next = locals->n_Y_end_next.value; (void)n_Y_end_next;
+
+  (void)batch_col;
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)nb_T_inner_next;
+  (void)sizei_T;
+  (void)sizej_T;
+  (void)i_start;
+  (void)j_start;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)n_Y_start_next;
+  (void)n_Y_end_next;
+  (void)__parsec_tp; (void)locals;
+  return NT;
+}
+static const parsec_expr_t maxexpr_of_symb_redistribute_no_optimization_Receive_batch_col = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_redistribute_no_optimization_Receive_batch_col_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_no_optimization_Receive_batch_col = { .name = "batch_col", .context_index = 0, .min = &minexpr_of_symb_redistribute_no_optimization_Receive_batch_col, .max = &maxexpr_of_symb_redistribute_no_optimization_Receive_batch_col, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int minexpr_of_symb_redistribute_no_optimization_Receive_m_T_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Receive_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int mb_T_inner = locals->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = locals->nb_T_inner.value; (void)nb_T_inner;
+  const int nb_T_inner_next = locals->nb_T_inner_next.value; (void)nb_T_inner_next;
+  const int sizei_T = locals->sizei_T.value; (void)sizei_T;
+  const int sizej_T = locals->sizej_T.value; (void)sizej_T;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int m_Y_start = locals->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = locals->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = locals->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = locals->n_Y_end.value; (void)n_Y_end;
+  const int n_Y_start_next = locals->n_Y_start_next.value; (void)n_Y_start_next;
+  const int n_Y_end_next = locals->n_Y_end_next.value; (void)n_Y_end_next;
+
+  (void)batch_col;
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)nb_T_inner_next;
+  (void)sizei_T;
+  (void)sizej_T;
+  (void)i_start;
+  (void)j_start;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)n_Y_start_next;
+  (void)n_Y_end_next;
+  (void)__parsec_tp; (void)locals;
+  return m_T_START;
+}
+static const parsec_expr_t minexpr_of_symb_redistribute_no_optimization_Receive_m_T = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_redistribute_no_optimization_Receive_m_T_fct }
+                   }
+};
+static inline int maxexpr_of_symb_redistribute_no_optimization_Receive_m_T_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Receive_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int mb_T_inner = locals->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = locals->nb_T_inner.value; (void)nb_T_inner;
+  const int nb_T_inner_next = locals->nb_T_inner_next.value; (void)nb_T_inner_next;
+  const int sizei_T = locals->sizei_T.value; (void)sizei_T;
+  const int sizej_T = locals->sizej_T.value; (void)sizej_T;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int m_Y_start = locals->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = locals->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = locals->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = locals->n_Y_end.value; (void)n_Y_end;
+  const int n_Y_start_next = locals->n_Y_start_next.value; (void)n_Y_start_next;
+  const int n_Y_end_next = locals->n_Y_end_next.value; (void)n_Y_end_next;
+
+  (void)batch_col;
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)nb_T_inner_next;
+  (void)sizei_T;
+  (void)sizej_T;
+  (void)i_start;
+  (void)j_start;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)n_Y_start_next;
+  (void)n_Y_end_next;
+  (void)__parsec_tp; (void)locals;
+  return m_T_END;
+}
+static const parsec_expr_t maxexpr_of_symb_redistribute_no_optimization_Receive_m_T = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_redistribute_no_optimization_Receive_m_T_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_no_optimization_Receive_m_T = { .name = "m_T", .context_index = 1, .min = &minexpr_of_symb_redistribute_no_optimization_Receive_m_T, .max = &maxexpr_of_symb_redistribute_no_optimization_Receive_m_T, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int32_t minexpr_of_symb_redistribute_no_optimization_Receive_n_T_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Receive_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_no_optimization_Receive_inline_c_expr11_line_315(__parsec_tp, locals);
+}
+static const parsec_expr_t minexpr_of_symb_redistribute_no_optimization_Receive_n_T = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_redistribute_no_optimization_Receive_n_T_fct }
+                   }
+};
+static inline int32_t maxexpr_of_symb_redistribute_no_optimization_Receive_n_T_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Receive_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_no_optimization_Receive_inline_c_expr10_line_315(__parsec_tp, locals);
+}
+static const parsec_expr_t maxexpr_of_symb_redistribute_no_optimization_Receive_n_T = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_redistribute_no_optimization_Receive_n_T_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_no_optimization_Receive_n_T = { .name = "n_T", .context_index = 2, .min = &minexpr_of_symb_redistribute_no_optimization_Receive_n_T, .max = &maxexpr_of_symb_redistribute_no_optimization_Receive_n_T, .cst_inc = 1, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_redistribute_no_optimization_Receive_mb_T_inner_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Receive_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_no_optimization_Receive_inline_c_expr9_line_317(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_redistribute_no_optimization_Receive_mb_T_inner = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_no_optimization_Receive_mb_T_inner_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_no_optimization_Receive_mb_T_inner = { .name = "mb_T_inner", .context_index = 3, .min = &expr_of_symb_redistribute_no_optimization_Receive_mb_T_inner, .max = &expr_of_symb_redistribute_no_optimization_Receive_mb_T_inner, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_redistribute_no_optimization_Receive_nb_T_inner_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Receive_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_no_optimization_Receive_inline_c_expr8_line_318(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_redistribute_no_optimization_Receive_nb_T_inner = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_no_optimization_Receive_nb_T_inner_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_no_optimization_Receive_nb_T_inner = { .name = "nb_T_inner", .context_index = 4, .min = &expr_of_symb_redistribute_no_optimization_Receive_nb_T_inner, .max = &expr_of_symb_redistribute_no_optimization_Receive_nb_T_inner, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_redistribute_no_optimization_Receive_nb_T_inner_next_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Receive_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_no_optimization_Receive_inline_c_expr7_line_320(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_redistribute_no_optimization_Receive_nb_T_inner_next = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_no_optimization_Receive_nb_T_inner_next_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_no_optimization_Receive_nb_T_inner_next = { .name = "nb_T_inner_next", .context_index = 5, .min = &expr_of_symb_redistribute_no_optimization_Receive_nb_T_inner_next, .max = &expr_of_symb_redistribute_no_optimization_Receive_nb_T_inner_next, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int expr_of_symb_redistribute_no_optimization_Receive_sizei_T_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Receive_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int mb_T_inner = locals->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = locals->nb_T_inner.value; (void)nb_T_inner;
+  const int nb_T_inner_next = locals->nb_T_inner_next.value; (void)nb_T_inner_next;
+  const int sizei_T = locals->sizei_T.value; (void)sizei_T;
+  const int sizej_T = locals->sizej_T.value; (void)sizej_T;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int m_Y_start = locals->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = locals->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = locals->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = locals->n_Y_end.value; (void)n_Y_end;
+  const int n_Y_start_next = locals->n_Y_start_next.value; (void)n_Y_start_next;
+  const int n_Y_end_next = locals->n_Y_end_next.value; (void)n_Y_end_next;
+
+  (void)batch_col;
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)nb_T_inner_next;
+  (void)sizei_T;
+  (void)sizej_T;
+  (void)i_start;
+  (void)j_start;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)n_Y_start_next;
+  (void)n_Y_end_next;
+  (void)__parsec_tp; (void)locals;
+  return (((m_T - m_T_START) * mb_T_INNER) - (disi_T % mb_T_INNER));
+}
+static const parsec_expr_t expr_of_symb_redistribute_no_optimization_Receive_sizei_T = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_no_optimization_Receive_sizei_T_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_no_optimization_Receive_sizei_T = { .name = "sizei_T", .context_index = 6, .min = &expr_of_symb_redistribute_no_optimization_Receive_sizei_T, .max = &expr_of_symb_redistribute_no_optimization_Receive_sizei_T, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int expr_of_symb_redistribute_no_optimization_Receive_sizej_T_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Receive_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int mb_T_inner = locals->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = locals->nb_T_inner.value; (void)nb_T_inner;
+  const int nb_T_inner_next = locals->nb_T_inner_next.value; (void)nb_T_inner_next;
+  const int sizei_T = locals->sizei_T.value; (void)sizei_T;
+  const int sizej_T = locals->sizej_T.value; (void)sizej_T;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int m_Y_start = locals->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = locals->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = locals->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = locals->n_Y_end.value; (void)n_Y_end;
+  const int n_Y_start_next = locals->n_Y_start_next.value; (void)n_Y_start_next;
+  const int n_Y_end_next = locals->n_Y_end_next.value; (void)n_Y_end_next;
+
+  (void)batch_col;
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)nb_T_inner_next;
+  (void)sizei_T;
+  (void)sizej_T;
+  (void)i_start;
+  (void)j_start;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)n_Y_start_next;
+  (void)n_Y_end_next;
+  (void)__parsec_tp; (void)locals;
+  return (((n_T - n_T_START) * nb_T_INNER) - (disj_T % nb_T_INNER));
+}
+static const parsec_expr_t expr_of_symb_redistribute_no_optimization_Receive_sizej_T = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_no_optimization_Receive_sizej_T_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_no_optimization_Receive_sizej_T = { .name = "sizej_T", .context_index = 7, .min = &expr_of_symb_redistribute_no_optimization_Receive_sizej_T, .max = &expr_of_symb_redistribute_no_optimization_Receive_sizej_T, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_redistribute_no_optimization_Receive_i_start_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Receive_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_no_optimization_Receive_inline_c_expr6_line_325(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_redistribute_no_optimization_Receive_i_start = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_no_optimization_Receive_i_start_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_no_optimization_Receive_i_start = { .name = "i_start", .context_index = 8, .min = &expr_of_symb_redistribute_no_optimization_Receive_i_start, .max = &expr_of_symb_redistribute_no_optimization_Receive_i_start, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_redistribute_no_optimization_Receive_j_start_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Receive_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_no_optimization_Receive_inline_c_expr5_line_326(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_redistribute_no_optimization_Receive_j_start = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_no_optimization_Receive_j_start_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_no_optimization_Receive_j_start = { .name = "j_start", .context_index = 9, .min = &expr_of_symb_redistribute_no_optimization_Receive_j_start, .max = &expr_of_symb_redistribute_no_optimization_Receive_j_start, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_redistribute_no_optimization_Receive_m_Y_start_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Receive_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_no_optimization_Receive_inline_c_expr4_line_328(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_redistribute_no_optimization_Receive_m_Y_start = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_no_optimization_Receive_m_Y_start_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_no_optimization_Receive_m_Y_start = { .name = "m_Y_start", .context_index = 10, .min = &expr_of_symb_redistribute_no_optimization_Receive_m_Y_start, .max = &expr_of_symb_redistribute_no_optimization_Receive_m_Y_start, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_redistribute_no_optimization_Receive_n_Y_start_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Receive_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_no_optimization_Receive_inline_c_expr3_line_329(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_redistribute_no_optimization_Receive_n_Y_start = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_no_optimization_Receive_n_Y_start_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_no_optimization_Receive_n_Y_start = { .name = "n_Y_start", .context_index = 11, .min = &expr_of_symb_redistribute_no_optimization_Receive_n_Y_start, .max = &expr_of_symb_redistribute_no_optimization_Receive_n_Y_start, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_redistribute_no_optimization_Receive_m_Y_end_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Receive_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_no_optimization_Receive_inline_c_expr2_line_330(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_redistribute_no_optimization_Receive_m_Y_end = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_no_optimization_Receive_m_Y_end_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_no_optimization_Receive_m_Y_end = { .name = "m_Y_end", .context_index = 12, .min = &expr_of_symb_redistribute_no_optimization_Receive_m_Y_end, .max = &expr_of_symb_redistribute_no_optimization_Receive_m_Y_end, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_redistribute_no_optimization_Receive_n_Y_end_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Receive_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_no_optimization_Receive_inline_c_expr1_line_331(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_redistribute_no_optimization_Receive_n_Y_end = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_no_optimization_Receive_n_Y_end_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_no_optimization_Receive_n_Y_end = { .name = "n_Y_end", .context_index = 13, .min = &expr_of_symb_redistribute_no_optimization_Receive_n_Y_end, .max = &expr_of_symb_redistribute_no_optimization_Receive_n_Y_end, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int expr_of_symb_redistribute_no_optimization_Receive_n_Y_start_next_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Receive_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int mb_T_inner = locals->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = locals->nb_T_inner.value; (void)nb_T_inner;
+  const int nb_T_inner_next = locals->nb_T_inner_next.value; (void)nb_T_inner_next;
+  const int sizei_T = locals->sizei_T.value; (void)sizei_T;
+  const int sizej_T = locals->sizej_T.value; (void)sizej_T;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int m_Y_start = locals->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = locals->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = locals->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = locals->n_Y_end.value; (void)n_Y_end;
+  const int n_Y_start_next = locals->n_Y_start_next.value; (void)n_Y_start_next;
+  const int n_Y_end_next = locals->n_Y_end_next.value; (void)n_Y_end_next;
+
+  (void)batch_col;
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)nb_T_inner_next;
+  (void)sizei_T;
+  (void)sizej_T;
+  (void)i_start;
+  (void)j_start;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)n_Y_start_next;
+  (void)n_Y_end_next;
+  (void)__parsec_tp; (void)locals;
+  return ((((((n_T - n_T_START) + num_col) * nb_T_INNER) - (disj_T % nb_T_INNER)) + disj_Y) / nb_Y_INNER);
+}
+static const parsec_expr_t expr_of_symb_redistribute_no_optimization_Receive_n_Y_start_next = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_no_optimization_Receive_n_Y_start_next_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_no_optimization_Receive_n_Y_start_next = { .name = "n_Y_start_next", .context_index = 14, .min = &expr_of_symb_redistribute_no_optimization_Receive_n_Y_start_next, .max = &expr_of_symb_redistribute_no_optimization_Receive_n_Y_start_next, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int expr_of_symb_redistribute_no_optimization_Receive_n_Y_end_next_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Receive_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int mb_T_inner = locals->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = locals->nb_T_inner.value; (void)nb_T_inner;
+  const int nb_T_inner_next = locals->nb_T_inner_next.value; (void)nb_T_inner_next;
+  const int sizei_T = locals->sizei_T.value; (void)sizei_T;
+  const int sizej_T = locals->sizej_T.value; (void)sizej_T;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int m_Y_start = locals->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = locals->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = locals->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = locals->n_Y_end.value; (void)n_Y_end;
+  const int n_Y_start_next = locals->n_Y_start_next.value; (void)n_Y_start_next;
+  const int n_Y_end_next = locals->n_Y_end_next.value; (void)n_Y_end_next;
+
+  (void)batch_col;
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)nb_T_inner_next;
+  (void)sizei_T;
+  (void)sizej_T;
+  (void)i_start;
+  (void)j_start;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)n_Y_start_next;
+  (void)n_Y_end_next;
+  (void)__parsec_tp; (void)locals;
+  return ((((((((n_T - n_T_START) + num_col) * nb_T_INNER) - (disj_T % nb_T_INNER)) + disj_Y) + nb_T_inner_next) - 1) / nb_Y_INNER);
+}
+static const parsec_expr_t expr_of_symb_redistribute_no_optimization_Receive_n_Y_end_next = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_no_optimization_Receive_n_Y_end_next_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_no_optimization_Receive_n_Y_end_next = { .name = "n_Y_end_next", .context_index = 15, .min = &expr_of_symb_redistribute_no_optimization_Receive_n_Y_end_next, .max = &expr_of_symb_redistribute_no_optimization_Receive_n_Y_end_next, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int affinity_of_redistribute_no_optimization_Receive(const __parsec_redistribute_no_optimization_Receive_task_t *this_task,
+                     parsec_data_ref_t *ref)
+{
+    const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp = (const __parsec_redistribute_no_optimization_internal_taskpool_t*)this_task->taskpool;
+  const int batch_col = this_task->locals.batch_col.value; (void)batch_col;
+  const int m_T = this_task->locals.m_T.value; (void)m_T;
+  const int n_T = this_task->locals.n_T.value; (void)n_T;
+  const int mb_T_inner = this_task->locals.mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = this_task->locals.nb_T_inner.value; (void)nb_T_inner;
+  const int nb_T_inner_next = this_task->locals.nb_T_inner_next.value; (void)nb_T_inner_next;
+  const int sizei_T = this_task->locals.sizei_T.value; (void)sizei_T;
+  const int sizej_T = this_task->locals.sizej_T.value; (void)sizej_T;
+  const int i_start = this_task->locals.i_start.value; (void)i_start;
+  const int j_start = this_task->locals.j_start.value; (void)j_start;
+  const int m_Y_start = this_task->locals.m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = this_task->locals.n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = this_task->locals.m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = this_task->locals.n_Y_end.value; (void)n_Y_end;
+  const int n_Y_start_next = this_task->locals.n_Y_start_next.value; (void)n_Y_start_next;
+  const int n_Y_end_next = this_task->locals.n_Y_end_next.value; (void)n_Y_end_next;
+
+  /* Silent Warnings: should look into predicate to know what variables are usefull */
+  (void)batch_col;
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)nb_T_inner_next;
+  (void)sizei_T;
+  (void)sizej_T;
+  (void)i_start;
+  (void)j_start;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)n_Y_start_next;
+  (void)n_Y_end_next;
+  ref->dc = (parsec_data_collection_t *)__parsec_tp->super._g_descT;
+  /* Compute data key */
+  ref->key = ref->dc->data_key(ref->dc, m_T, n_T);
+  return 1;
+}
+static const parsec_property_t properties_of_redistribute_no_optimization_Receive[1] = {
+  {.name = NULL, .expr = NULL}
+};
+static const parsec_dep_t flow_of_redistribute_no_optimization_Receive_for_T_dep1_atline_338 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 0, /* redistribute_no_optimization_Init */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_redistribute_no_optimization_Init_for_T,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_redistribute_no_optimization_Receive_for_T,
+};
+static parsec_data_t *flow_of_redistribute_no_optimization_Receive_for_T_dep2_atline_339_direct_access(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Receive_parsec_assignment_t *assignments)
+{
+  const int batch_col = assignments->batch_col.value; (void)batch_col;
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int mb_T_inner = assignments->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = assignments->nb_T_inner.value; (void)nb_T_inner;
+  const int nb_T_inner_next = assignments->nb_T_inner_next.value; (void)nb_T_inner_next;
+  const int sizei_T = assignments->sizei_T.value; (void)sizei_T;
+  const int sizej_T = assignments->sizej_T.value; (void)sizej_T;
+  const int i_start = assignments->i_start.value; (void)i_start;
+  const int j_start = assignments->j_start.value; (void)j_start;
+  const int m_Y_start = assignments->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = assignments->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = assignments->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = assignments->n_Y_end.value; (void)n_Y_end;
+  const int n_Y_start_next = assignments->n_Y_start_next.value; (void)n_Y_start_next;
+  const int n_Y_end_next = assignments->n_Y_end_next.value; (void)n_Y_end_next;
+
+  /* Silence Warnings: should look into parameters to know what variables are useful */
+  (void)batch_col;
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)nb_T_inner_next;
+  (void)sizei_T;
+  (void)sizej_T;
+  (void)i_start;
+  (void)j_start;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)n_Y_start_next;
+  (void)n_Y_end_next;
+  if( __parsec_tp->super.super.context->my_rank == (int32_t)rank_of_descT(m_T, n_T) )
+    return data_of_descT(m_T, n_T);
+  return NULL;
+}
+
+static const parsec_dep_t flow_of_redistribute_no_optimization_Receive_for_T_dep2_atline_339 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = PARSEC_LOCAL_DATA_TASK_CLASS_ID, /* redistribute_no_optimization_descT */
+  .direct_data = (parsec_data_lookup_func_t)&flow_of_redistribute_no_optimization_Receive_for_T_dep2_atline_339_direct_access,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_redistribute_no_optimization_Receive_for_T,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+#if MAX_DEP_OUT_COUNT < 1  /* number of output dependencies */
+    #error Too many output dependencies (supports up to MAX_DEP_OUT_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_OUT_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_redistribute_no_optimization_Receive_for_T = {
+  .name               = "T",
+  .sym_type           = PARSEC_SYM_INOUT,
+  .flow_flags         = PARSEC_FLOW_ACCESS_RW,
+  .flow_index         = 0,
+  .flow_datatype_mask = 0x1,
+  .dep_in     = { &flow_of_redistribute_no_optimization_Receive_for_T_dep1_atline_338 },
+  .dep_out    = { &flow_of_redistribute_no_optimization_Receive_for_T_dep2_atline_339 }
+};
+
+static inline int ctl_gather_compute_for_dep_flow_of_redistribute_no_optimization_Receive_for_ctl1_dep1_atline_341_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Receive_parsec_assignment_t *assignments)
+{
+  int   __nb_found = 0;
+  __parsec_redistribute_no_optimization_Receive_parsec_assignment_t __jdf2c__tmp_locals = *assignments;
+  (void)__parsec_tp;
+  const int batch_col = __jdf2c__tmp_locals.batch_col.value; (void)batch_col;
+  const int m_T = __jdf2c__tmp_locals.m_T.value; (void)m_T;
+  const int n_T = __jdf2c__tmp_locals.n_T.value; (void)n_T;
+  const int mb_T_inner = __jdf2c__tmp_locals.mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = __jdf2c__tmp_locals.nb_T_inner.value; (void)nb_T_inner;
+  const int nb_T_inner_next = __jdf2c__tmp_locals.nb_T_inner_next.value; (void)nb_T_inner_next;
+  const int sizei_T = __jdf2c__tmp_locals.sizei_T.value; (void)sizei_T;
+  const int sizej_T = __jdf2c__tmp_locals.sizej_T.value; (void)sizej_T;
+  const int i_start = __jdf2c__tmp_locals.i_start.value; (void)i_start;
+  const int j_start = __jdf2c__tmp_locals.j_start.value; (void)j_start;
+  const int m_Y_start = __jdf2c__tmp_locals.m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = __jdf2c__tmp_locals.n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = __jdf2c__tmp_locals.m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = __jdf2c__tmp_locals.n_Y_end.value; (void)n_Y_end;
+  const int n_Y_start_next = __jdf2c__tmp_locals.n_Y_start_next.value; (void)n_Y_start_next;
+  const int n_Y_end_next = __jdf2c__tmp_locals.n_Y_end_next.value; (void)n_Y_end_next;
+  (void)batch_col; (void)m_T; (void)n_T; (void)mb_T_inner; (void)nb_T_inner; (void)nb_T_inner_next; (void)sizei_T; (void)sizej_T; (void)i_start; (void)j_start; (void)m_Y_start; (void)n_Y_start; (void)m_Y_end; (void)n_Y_end; (void)n_Y_start_next; (void)n_Y_end_next;
+  {
+    int Update_m_Y;
+    for(Update_m_Y  = m_Y_start;
+        Update_m_Y <= m_Y_end;
+        Update_m_Y += 1) {
+      {
+        int Update_n_Y;
+        for(Update_n_Y  = n_Y_start;
+            Update_n_Y <= n_Y_end;
+            Update_n_Y += 1) {
+          int Update_m_T = m_T;
+          (void)Update_m_T;
+          int Update_n_T = n_T;
+          (void)Update_n_T;
+          int Update_batch_col = batch_col;
+          (void)Update_batch_col;
+          __nb_found++;
+        }
+      }
+    }
+  }
+  return __nb_found;
+}
+
+static const parsec_expr_t ctl_gather_compute_for_dep_flow_of_redistribute_no_optimization_Receive_for_ctl1_dep1_atline_341 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)ctl_gather_compute_for_dep_flow_of_redistribute_no_optimization_Receive_for_ctl1_dep1_atline_341_fct }
+                   }
+};
+
+static const parsec_dep_t flow_of_redistribute_no_optimization_Receive_for_ctl1_dep1_atline_341 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = &ctl_gather_compute_for_dep_flow_of_redistribute_no_optimization_Receive_for_ctl1_dep1_atline_341,
+  .task_class_id = 2, /* redistribute_no_optimization_Update */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_redistribute_no_optimization_Update_for_ctl,
+  .dep_index = 1,
+  .dep_datatype_index = 1,
+  .belongs_to = &flow_of_redistribute_no_optimization_Receive_for_ctl1,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_redistribute_no_optimization_Receive_for_ctl1 = {
+  .name               = "ctl1",
+  .sym_type           = PARSEC_SYM_IN,
+  .flow_flags         = PARSEC_FLOW_ACCESS_NONE,
+  .flow_index         = 1,
+  .flow_datatype_mask = 0x0,
+  .dep_in     = { &flow_of_redistribute_no_optimization_Receive_for_ctl1_dep1_atline_341 },
+  .dep_out    = { NULL }
+};
+
+static inline int expr_of_cond_for_flow_of_redistribute_no_optimization_Receive_for_ctl2_dep1_atline_343_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Receive_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int mb_T_inner = locals->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = locals->nb_T_inner.value; (void)nb_T_inner;
+  const int nb_T_inner_next = locals->nb_T_inner_next.value; (void)nb_T_inner_next;
+  const int sizei_T = locals->sizei_T.value; (void)sizei_T;
+  const int sizej_T = locals->sizej_T.value; (void)sizej_T;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int m_Y_start = locals->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = locals->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = locals->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = locals->n_Y_end.value; (void)n_Y_end;
+  const int n_Y_start_next = locals->n_Y_start_next.value; (void)n_Y_start_next;
+  const int n_Y_end_next = locals->n_Y_end_next.value; (void)n_Y_end_next;
+
+  (void)batch_col;
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)nb_T_inner_next;
+  (void)sizei_T;
+  (void)sizej_T;
+  (void)i_start;
+  (void)j_start;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)n_Y_start_next;
+  (void)n_Y_end_next;
+  (void)__parsec_tp; (void)locals;
+  return (batch_col) < (NT);
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_redistribute_no_optimization_Receive_for_ctl2_dep1_atline_343 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_redistribute_no_optimization_Receive_for_ctl2_dep1_atline_343_fct }
+                   }
+};
+static const parsec_dep_t flow_of_redistribute_no_optimization_Receive_for_ctl2_dep1_atline_343 = {
+  .cond = &expr_of_cond_for_flow_of_redistribute_no_optimization_Receive_for_ctl2_dep1_atline_343,  /* (batch_col) < (NT) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 1, /* redistribute_no_optimization_Send */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_redistribute_no_optimization_Send_for_ctl,
+  .dep_index = 1,
+  .dep_datatype_index = 1,
+  .belongs_to = &flow_of_redistribute_no_optimization_Receive_for_ctl2,
+};
+#if MAX_DEP_OUT_COUNT < 1  /* number of output dependencies */
+    #error Too many output dependencies (supports up to MAX_DEP_OUT_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_OUT_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_redistribute_no_optimization_Receive_for_ctl2 = {
+  .name               = "ctl2",
+  .sym_type           = PARSEC_SYM_OUT,
+  .flow_flags         = PARSEC_FLOW_ACCESS_NONE,
+  .flow_index         = 2,
+  .flow_datatype_mask = 0x2,
+  .dep_in     = { NULL },
+  .dep_out    = { &flow_of_redistribute_no_optimization_Receive_for_ctl2_dep1_atline_343 }
+};
+
+static void
+iterate_successors_of_redistribute_no_optimization_Receive(parsec_execution_stream_t *es, const __parsec_redistribute_no_optimization_Receive_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp = (const __parsec_redistribute_no_optimization_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_redistribute_no_optimization_Receive_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_redistribute_no_optimization_Receive_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int batch_col = __jdf2c__tmp_locals.batch_col.value; (void)batch_col;
+  const int m_T = __jdf2c__tmp_locals.m_T.value; (void)m_T;
+  const int n_T = __jdf2c__tmp_locals.n_T.value; (void)n_T;
+  const int mb_T_inner = __jdf2c__tmp_locals.mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = __jdf2c__tmp_locals.nb_T_inner.value; (void)nb_T_inner;
+  const int nb_T_inner_next = __jdf2c__tmp_locals.nb_T_inner_next.value; (void)nb_T_inner_next;
+  const int sizei_T = __jdf2c__tmp_locals.sizei_T.value; (void)sizei_T;
+  const int sizej_T = __jdf2c__tmp_locals.sizej_T.value; (void)sizej_T;
+  const int i_start = __jdf2c__tmp_locals.i_start.value; (void)i_start;
+  const int j_start = __jdf2c__tmp_locals.j_start.value; (void)j_start;
+  const int m_Y_start = __jdf2c__tmp_locals.m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = __jdf2c__tmp_locals.n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = __jdf2c__tmp_locals.m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = __jdf2c__tmp_locals.n_Y_end.value; (void)n_Y_end;
+  const int n_Y_start_next = __jdf2c__tmp_locals.n_Y_start_next.value; (void)n_Y_start_next;
+  const int n_Y_end_next = __jdf2c__tmp_locals.n_Y_end_next.value; (void)n_Y_end_next;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)batch_col;  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)nb_T_inner_next;  (void)sizei_T;  (void)sizej_T;  (void)i_start;  (void)j_start;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;  (void)n_Y_start_next;  (void)n_Y_end_next;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_descT(m_T, n_T);
+#endif
+  /* Flow of data T has only OUTPUT dependencies to Memory */
+  /* Flow of data ctl1 has only IN dependencies */
+  if( action_mask & 0x2 ) {  /* Flow of data ctl2 [2] */
+    data.data   = this_task->data._f_ctl2.data_out;
+    data.data_future  = NULL;
+    if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  =   /* Control: always empty */ 0;
+    data.local.dst_count  =   /* Control: always empty */ 0;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = NULL;
+    data.remote.src_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.src_count  =   /* Control: always empty */ 0;
+    data.remote.dst_count  =   /* Control: always empty */ 0;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+       if( (batch_col) < (NT) ) {
+      __parsec_redistribute_no_optimization_Send_task_t* ncc = (__parsec_redistribute_no_optimization_Send_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[redistribute_no_optimization_Send.task_class_id];
+        const int Send_batch_col = (batch_col + 1);
+        if( (Send_batch_col >= (0)) && (Send_batch_col <= (NT)) ) {
+          assert(&nc.locals[0].value == &ncc->locals.batch_col.value);
+          ncc->locals.batch_col.value = Send_batch_col;
+          const int Send_m_T = m_T;
+          if( (Send_m_T >= (m_T_START)) && (Send_m_T <= (m_T_END)) ) {
+            assert(&nc.locals[1].value == &ncc->locals.m_T.value);
+            ncc->locals.m_T.value = Send_m_T;
+            const int Send_n_T = (n_T + num_col);
+            if( (Send_n_T >= (redistribute_no_optimization_Send_inline_c_expr33_line_202(__parsec_tp, &ncc->locals))) && (Send_n_T <= (redistribute_no_optimization_Send_inline_c_expr32_line_202(__parsec_tp, &ncc->locals))) ) {
+              assert(&nc.locals[2].value == &ncc->locals.n_T.value);
+              ncc->locals.n_T.value = Send_n_T;
+              const int Send_mb_T_inner = redistribute_no_optimization_Send_inline_c_expr31_line_204(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[3].value == &ncc->locals.mb_T_inner.value);
+              ncc->locals.mb_T_inner.value = Send_mb_T_inner;
+              const int Send_nb_T_inner = redistribute_no_optimization_Send_inline_c_expr30_line_205(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[4].value == &ncc->locals.nb_T_inner.value);
+              ncc->locals.nb_T_inner.value = Send_nb_T_inner;
+              const int Send_i_start = redistribute_no_optimization_Send_inline_c_expr29_line_207(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[5].value == &ncc->locals.i_start.value);
+              ncc->locals.i_start.value = Send_i_start;
+              const int Send_j_start = redistribute_no_optimization_Send_inline_c_expr28_line_208(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[6].value == &ncc->locals.j_start.value);
+              ncc->locals.j_start.value = Send_j_start;
+              const int Send_m_Y_start = redistribute_no_optimization_Send_inline_c_expr27_line_210(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[7].value == &ncc->locals.m_Y_start.value);
+              ncc->locals.m_Y_start.value = Send_m_Y_start;
+              const int Send_n_Y_start = redistribute_no_optimization_Send_inline_c_expr26_line_211(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[8].value == &ncc->locals.n_Y_start.value);
+              ncc->locals.n_Y_start.value = Send_n_Y_start;
+              const int Send_m_Y_end = redistribute_no_optimization_Send_inline_c_expr25_line_212(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[9].value == &ncc->locals.m_Y_end.value);
+              ncc->locals.m_Y_end.value = Send_m_Y_end;
+              const int Send_n_Y_end = redistribute_no_optimization_Send_inline_c_expr24_line_213(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[10].value == &ncc->locals.n_Y_end.value);
+              ncc->locals.n_Y_end.value = Send_n_Y_end;
+              int Send_m_Y;
+            for( Send_m_Y = m_Y_start;Send_m_Y <= m_Y_end; Send_m_Y+=1) {
+                if( (Send_m_Y >= (ncc->locals.m_Y_start.value)) && (Send_m_Y <= (ncc->locals.m_Y_end.value)) ) {
+                  assert(&nc.locals[11].value == &ncc->locals.m_Y.value);
+                  ncc->locals.m_Y.value = Send_m_Y;
+                  int Send_n_Y;
+                for( Send_n_Y = n_Y_start_next;Send_n_Y <= n_Y_end_next; Send_n_Y+=1) {
+                    if( (Send_n_Y >= (ncc->locals.n_Y_start.value)) && (Send_n_Y <= (ncc->locals.n_Y_end.value)) ) {
+                      assert(&nc.locals[12].value == &ncc->locals.n_Y.value);
+                      ncc->locals.n_Y.value = Send_n_Y;
+#if defined(DISTRIBUTED)
+                      rank_dst = rank_of_descY(ncc->locals.m_Y.value, ncc->locals.n_Y.value);
+                      if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+                        vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descY)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descY, ncc->locals.m_Y.value, ncc->locals.n_Y.value);
+                      nc.priority = __parsec_tp->super.super.priority;
+                      successor_repo = Send_repo;
+                      successor_repo_key = __jdf2c_make_key_Send((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+                    RELEASE_DEP_OUTPUT(es, "ctl2", this_task, "ctl", &nc, rank_src, rank_dst, &data);
+                    if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_redistribute_no_optimization_Receive_for_ctl2_dep1_atline_343, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+                      }
+                    }
+                  }
+                }
+              }
+            }
+          }
+    }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static void
+iterate_predecessors_of_redistribute_no_optimization_Receive(parsec_execution_stream_t *es, const __parsec_redistribute_no_optimization_Receive_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp = (const __parsec_redistribute_no_optimization_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_redistribute_no_optimization_Receive_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_redistribute_no_optimization_Receive_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int batch_col = __jdf2c__tmp_locals.batch_col.value; (void)batch_col;
+  const int m_T = __jdf2c__tmp_locals.m_T.value; (void)m_T;
+  const int n_T = __jdf2c__tmp_locals.n_T.value; (void)n_T;
+  const int mb_T_inner = __jdf2c__tmp_locals.mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = __jdf2c__tmp_locals.nb_T_inner.value; (void)nb_T_inner;
+  const int nb_T_inner_next = __jdf2c__tmp_locals.nb_T_inner_next.value; (void)nb_T_inner_next;
+  const int sizei_T = __jdf2c__tmp_locals.sizei_T.value; (void)sizei_T;
+  const int sizej_T = __jdf2c__tmp_locals.sizej_T.value; (void)sizej_T;
+  const int i_start = __jdf2c__tmp_locals.i_start.value; (void)i_start;
+  const int j_start = __jdf2c__tmp_locals.j_start.value; (void)j_start;
+  const int m_Y_start = __jdf2c__tmp_locals.m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = __jdf2c__tmp_locals.n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = __jdf2c__tmp_locals.m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = __jdf2c__tmp_locals.n_Y_end.value; (void)n_Y_end;
+  const int n_Y_start_next = __jdf2c__tmp_locals.n_Y_start_next.value; (void)n_Y_start_next;
+  const int n_Y_end_next = __jdf2c__tmp_locals.n_Y_end_next.value; (void)n_Y_end_next;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)batch_col;  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)nb_T_inner_next;  (void)sizei_T;  (void)sizej_T;  (void)i_start;  (void)j_start;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;  (void)n_Y_start_next;  (void)n_Y_end_next;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_descT(m_T, n_T);
+#endif
+  if( action_mask & 0x1 ) {  /* Flow of data T [0] */
+    data.data   = this_task->data._f_T.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x1 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_redistribute_no_optimization_TARGET_ADT->arena;
+    data.local.src_datatype = PARSEC_redistribute_no_optimization_TARGET_ADT->opaque_dtt;
+    data.local.dst_datatype = PARSEC_redistribute_no_optimization_TARGET_ADT->opaque_dtt;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_redistribute_no_optimization_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        __parsec_redistribute_no_optimization_Init_task_t* ncc = (__parsec_redistribute_no_optimization_Init_task_t*)&nc;
+    nc.task_class = __parsec_tp->super.super.task_classes_array[redistribute_no_optimization_Init.task_class_id];
+      const int Init_batch_col = batch_col;
+      if( (Init_batch_col >= (0)) && (Init_batch_col <= (NT)) ) {
+        assert(&nc.locals[0].value == &ncc->locals.batch_col.value);
+        ncc->locals.batch_col.value = Init_batch_col;
+        const int Init_m_T = m_T;
+        if( (Init_m_T >= (m_T_START)) && (Init_m_T <= (m_T_END)) ) {
+          assert(&nc.locals[1].value == &ncc->locals.m_T.value);
+          ncc->locals.m_T.value = Init_m_T;
+          const int Init_n_T = n_T;
+          if( (Init_n_T >= (redistribute_no_optimization_Init_inline_c_expr41_line_166(__parsec_tp, &ncc->locals))) && (Init_n_T <= (redistribute_no_optimization_Init_inline_c_expr40_line_166(__parsec_tp, &ncc->locals))) ) {
+            assert(&nc.locals[2].value == &ncc->locals.n_T.value);
+            ncc->locals.n_T.value = Init_n_T;
+            const int Init_mb_T_inner = redistribute_no_optimization_Init_inline_c_expr39_line_168(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[3].value == &ncc->locals.mb_T_inner.value);
+            ncc->locals.mb_T_inner.value = Init_mb_T_inner;
+            const int Init_nb_T_inner = redistribute_no_optimization_Init_inline_c_expr38_line_169(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[4].value == &ncc->locals.nb_T_inner.value);
+            ncc->locals.nb_T_inner.value = Init_nb_T_inner;
+            const int Init_sizei_T = (((ncc->locals.m_T.value - m_T_START) * mb_T_INNER) - (disi_T % mb_T_INNER));
+            assert(&nc.locals[5].value == &ncc->locals.sizei_T.value);
+            ncc->locals.sizei_T.value = Init_sizei_T;
+            const int Init_sizej_T = (((ncc->locals.n_T.value - n_T_START) * nb_T_INNER) - (disj_T % nb_T_INNER));
+            assert(&nc.locals[6].value == &ncc->locals.sizej_T.value);
+            ncc->locals.sizej_T.value = Init_sizej_T;
+            const int Init_m_Y_start = redistribute_no_optimization_Init_inline_c_expr37_line_174(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[7].value == &ncc->locals.m_Y_start.value);
+            ncc->locals.m_Y_start.value = Init_m_Y_start;
+            const int Init_n_Y_start = redistribute_no_optimization_Init_inline_c_expr36_line_175(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[8].value == &ncc->locals.n_Y_start.value);
+            ncc->locals.n_Y_start.value = Init_n_Y_start;
+            const int Init_m_Y_end = redistribute_no_optimization_Init_inline_c_expr35_line_176(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[9].value == &ncc->locals.m_Y_end.value);
+            ncc->locals.m_Y_end.value = Init_m_Y_end;
+            const int Init_n_Y_end = redistribute_no_optimization_Init_inline_c_expr34_line_177(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[10].value == &ncc->locals.n_Y_end.value);
+            ncc->locals.n_Y_end.value = Init_n_Y_end;
+#if defined(DISTRIBUTED)
+            rank_dst = rank_of_descT(ncc->locals.m_T.value, ncc->locals.n_T.value);
+            if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+              vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descT)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descT, ncc->locals.m_T.value, ncc->locals.n_T.value);
+            nc.priority = __parsec_tp->super.super.priority;
+            successor_repo = NULL;
+            successor_repo_key = 0;
+          RELEASE_DEP_OUTPUT(es, "T", this_task, "T", &nc, rank_src, rank_dst, &data);
+          if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_redistribute_no_optimization_Receive_for_T_dep1_atline_338, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+            }
+          }
+        }
+  }
+  }
+  if( action_mask & 0x2 ) {  /* Flow of data ctl1 [1] */
+    data.data   = this_task->data._f_ctl1.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x2 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  =   /* Control: always empty */ 0;
+    data.local.dst_count  =   /* Control: always empty */ 0;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = NULL;
+    data.remote.src_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.src_count  =   /* Control: always empty */ 0;
+    data.remote.dst_count  =   /* Control: always empty */ 0;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        __parsec_redistribute_no_optimization_Update_task_t* ncc = (__parsec_redistribute_no_optimization_Update_task_t*)&nc;
+    nc.task_class = __parsec_tp->super.super.task_classes_array[redistribute_no_optimization_Update.task_class_id];
+      const int Update_batch_col = batch_col;
+      if( (Update_batch_col >= (0)) && (Update_batch_col <= (NT)) ) {
+        assert(&nc.locals[0].value == &ncc->locals.batch_col.value);
+        ncc->locals.batch_col.value = Update_batch_col;
+        const int Update_m_T = m_T;
+        if( (Update_m_T >= (m_T_START)) && (Update_m_T <= (m_T_END)) ) {
+          assert(&nc.locals[1].value == &ncc->locals.m_T.value);
+          ncc->locals.m_T.value = Update_m_T;
+          const int Update_n_T = n_T;
+          if( (Update_n_T >= (redistribute_no_optimization_Update_inline_c_expr23_line_249(__parsec_tp, &ncc->locals))) && (Update_n_T <= (redistribute_no_optimization_Update_inline_c_expr22_line_249(__parsec_tp, &ncc->locals))) ) {
+            assert(&nc.locals[2].value == &ncc->locals.n_T.value);
+            ncc->locals.n_T.value = Update_n_T;
+            const int Update_mb_T_inner = redistribute_no_optimization_Update_inline_c_expr21_line_251(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[3].value == &ncc->locals.mb_T_inner.value);
+            ncc->locals.mb_T_inner.value = Update_mb_T_inner;
+            const int Update_nb_T_inner = redistribute_no_optimization_Update_inline_c_expr20_line_252(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[4].value == &ncc->locals.nb_T_inner.value);
+            ncc->locals.nb_T_inner.value = Update_nb_T_inner;
+            const int Update_i_start = redistribute_no_optimization_Update_inline_c_expr19_line_254(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[5].value == &ncc->locals.i_start.value);
+            ncc->locals.i_start.value = Update_i_start;
+            const int Update_j_start = redistribute_no_optimization_Update_inline_c_expr18_line_255(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[6].value == &ncc->locals.j_start.value);
+            ncc->locals.j_start.value = Update_j_start;
+            const int Update_m_Y_start = redistribute_no_optimization_Update_inline_c_expr17_line_257(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[7].value == &ncc->locals.m_Y_start.value);
+            ncc->locals.m_Y_start.value = Update_m_Y_start;
+            const int Update_n_Y_start = redistribute_no_optimization_Update_inline_c_expr16_line_258(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[8].value == &ncc->locals.n_Y_start.value);
+            ncc->locals.n_Y_start.value = Update_n_Y_start;
+            const int Update_m_Y_end = redistribute_no_optimization_Update_inline_c_expr15_line_259(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[9].value == &ncc->locals.m_Y_end.value);
+            ncc->locals.m_Y_end.value = Update_m_Y_end;
+            const int Update_n_Y_end = redistribute_no_optimization_Update_inline_c_expr14_line_260(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[10].value == &ncc->locals.n_Y_end.value);
+            ncc->locals.n_Y_end.value = Update_n_Y_end;
+            int Update_m_Y;
+          for( Update_m_Y = m_Y_start;Update_m_Y <= m_Y_end; Update_m_Y+=1) {
+              if( (Update_m_Y >= (ncc->locals.m_Y_start.value)) && (Update_m_Y <= (ncc->locals.m_Y_end.value)) ) {
+                assert(&nc.locals[11].value == &ncc->locals.m_Y.value);
+                ncc->locals.m_Y.value = Update_m_Y;
+                int Update_n_Y;
+              for( Update_n_Y = n_Y_start;Update_n_Y <= n_Y_end; Update_n_Y+=1) {
+                  if( (Update_n_Y >= (ncc->locals.n_Y_start.value)) && (Update_n_Y <= (ncc->locals.n_Y_end.value)) ) {
+                    assert(&nc.locals[12].value == &ncc->locals.n_Y.value);
+                    ncc->locals.n_Y.value = Update_n_Y;
+                    const int Update_TL_row = redistribute_no_optimization_Update_inline_c_expr13_line_265(__parsec_tp, &ncc->locals);
+                    assert(&nc.locals[13].value == &ncc->locals.TL_row.value);
+                    ncc->locals.TL_row.value = Update_TL_row;
+                    const int Update_TL_col = redistribute_no_optimization_Update_inline_c_expr12_line_266(__parsec_tp, &ncc->locals);
+                    assert(&nc.locals[14].value == &ncc->locals.TL_col.value);
+                    ncc->locals.TL_col.value = Update_TL_col;
+                    const int Update_BR_row = ((((ncc->locals.i_start.value + ncc->locals.mb_T_inner.value) - 1) % mb_Y_INNER) + 1);
+                    assert(&nc.locals[15].value == &ncc->locals.BR_row.value);
+                    ncc->locals.BR_row.value = Update_BR_row;
+                    const int Update_BR_col = ((((ncc->locals.j_start.value + ncc->locals.nb_T_inner.value) - 1) % nb_Y_INNER) + 1);
+                    assert(&nc.locals[16].value == &ncc->locals.BR_col.value);
+                    ncc->locals.BR_col.value = Update_BR_col;
+#if defined(DISTRIBUTED)
+                    rank_dst = rank_of_descT(ncc->locals.m_T.value, ncc->locals.n_T.value);
+                    if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+                      vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descT)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descT, ncc->locals.m_T.value, ncc->locals.n_T.value);
+                    nc.priority = __parsec_tp->super.super.priority;
+                    successor_repo = Update_repo;
+                    successor_repo_key = __jdf2c_make_key_Update((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+                  RELEASE_DEP_OUTPUT(es, "ctl1", this_task, "ctl", &nc, rank_src, rank_dst, &data);
+                  if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_redistribute_no_optimization_Receive_for_ctl1_dep1_atline_341, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+                    }
+                  }
+                }
+              }
+            }
+          }
+        }
+  }
+  }
+  /* Flow of data ctl2 has only IN dependencies */
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static int release_deps_of_redistribute_no_optimization_Receive(parsec_execution_stream_t *es, __parsec_redistribute_no_optimization_Receive_task_t *this_task, uint32_t action_mask, parsec_remote_deps_t *deps)
+{
+  PARSEC_PINS(es, RELEASE_DEPS_BEGIN, (parsec_task_t *)this_task);  const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp = (const __parsec_redistribute_no_optimization_internal_taskpool_t *)this_task->taskpool;
+  parsec_release_dep_fct_arg_t arg;
+  int __vp_id;
+  int consume_local_repo = 0;
+  arg.action_mask = action_mask;
+  arg.output_entry = NULL;
+  arg.output_repo = NULL;
+#if defined(DISTRIBUTED)
+  arg.remote_deps = deps;
+#endif  /* defined(DISTRIBUTED) */
+  assert(NULL != es);
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS )    arg.ready_lists = alloca(sizeof(parsec_task_t *) * es->virtual_process->parsec_context->nb_vp);
+  else
+    arg.ready_lists = NULL;
+  for( __vp_id = 0; __vp_id < es->virtual_process->parsec_context->nb_vp; arg.ready_lists[__vp_id++] = NULL );
+  (void)__parsec_tp; (void)deps;
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_T.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_T.source_repo, this_task->data._f_T.source_repo_entry->ht_item.key );
+    }
+  }
+  consume_local_repo = (this_task->repo_entry != NULL);
+  arg.output_repo = Receive_repo;
+  arg.output_entry = this_task->repo_entry;
+  arg.output_usage = 0;
+  if( action_mask & (PARSEC_ACTION_RELEASE_LOCAL_DEPS | PARSEC_ACTION_GET_REPO_ENTRY) ) {
+    arg.output_entry = data_repo_lookup_entry_and_create( es, arg.output_repo, __jdf2c_make_key_Receive((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    arg.output_entry->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(arg.output_entry->sim_exec_date == 0);
+    arg.output_entry->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  if(action_mask & ( PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE ) ){
+    /* Generate the reshape promise for the outputs that need it */
+    iterate_successors_of_redistribute_no_optimization_Receive(es, this_task, action_mask, parsec_set_up_reshape_promise, &arg);
+   }
+  iterate_successors_of_redistribute_no_optimization_Receive(es, this_task, action_mask, parsec_release_dep_fct, &arg);
+
+#if defined(DISTRIBUTED)
+  if( (action_mask & PARSEC_ACTION_SEND_REMOTE_DEPS) && (NULL != arg.remote_deps)) {
+    parsec_remote_dep_activate(es, (parsec_task_t *)this_task, arg.remote_deps, arg.remote_deps->outgoing_mask);
+  }
+#endif
+
+  if(action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS) {
+    data_repo_entry_addto_usage_limit(Receive_repo, arg.output_entry->ht_item.key, arg.output_usage);
+    __parsec_schedule_vp(es, arg.ready_lists, 0);
+  }
+      if (consume_local_repo) {
+         data_repo_entry_used_once( Receive_repo, this_task->repo_entry->ht_item.key );
+      }
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_T.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_T.data_in);
+    }
+  }
+  PARSEC_PINS(es, RELEASE_DEPS_END, (parsec_task_t *)this_task);  return 0;
+}
+
+static int data_lookup_of_redistribute_no_optimization_Receive(parsec_execution_stream_t *es, __parsec_redistribute_no_optimization_Receive_task_t *this_task)
+{
+  const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_no_optimization_internal_taskpool_t *)this_task->taskpool;
+  parsec_assignment_t generic_locals[MAX_PARAM_COUNT];  /* generic task locals */
+  int target_device = 0; (void)target_device;
+  (void)__parsec_tp; (void)generic_locals; (void)es;
+  parsec_data_copy_t *chunk = NULL;
+  data_repo_t        *reshape_repo  = NULL, *consumed_repo  = NULL;
+  data_repo_entry_t  *reshape_entry = NULL, *consumed_entry = NULL;
+  parsec_key_t        reshape_entry_key = 0, consumed_entry_key = 0;
+  uint8_t             consumed_flow_index;
+  parsec_dep_data_description_t data;
+  int ret;
+  (void)reshape_repo; (void)reshape_entry; (void)reshape_entry_key;
+  (void)consumed_repo; (void)consumed_entry; (void)consumed_entry_key;
+  (void)consumed_flow_index;
+  (void)chunk; (void)data; (void)ret;
+  const int batch_col = this_task->locals.batch_col.value; (void)batch_col;
+  const int m_T = this_task->locals.m_T.value; (void)m_T;
+  const int n_T = this_task->locals.n_T.value; (void)n_T;
+  const int mb_T_inner = this_task->locals.mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = this_task->locals.nb_T_inner.value; (void)nb_T_inner;
+  const int nb_T_inner_next = this_task->locals.nb_T_inner_next.value; (void)nb_T_inner_next;
+  const int sizei_T = this_task->locals.sizei_T.value; (void)sizei_T;
+  const int sizej_T = this_task->locals.sizej_T.value; (void)sizej_T;
+  const int i_start = this_task->locals.i_start.value; (void)i_start;
+  const int j_start = this_task->locals.j_start.value; (void)j_start;
+  const int m_Y_start = this_task->locals.m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = this_task->locals.n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = this_task->locals.m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = this_task->locals.n_Y_end.value; (void)n_Y_end;
+  const int n_Y_start_next = this_task->locals.n_Y_start_next.value; (void)n_Y_start_next;
+  const int n_Y_end_next = this_task->locals.n_Y_end_next.value; (void)n_Y_end_next;
+  if( NULL == this_task->repo_entry ){
+    this_task->repo_entry = data_repo_lookup_entry_and_create(es, Receive_repo,                                       __jdf2c_make_key_Receive((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    data_repo_entry_addto_usage_limit(Receive_repo, this_task->repo_entry->ht_item.key, 1);    this_task->repo_entry ->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(this_task->repo_entry ->sim_exec_date == 0);
+    this_task->repo_entry ->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  /* The reshape repo is the current task repo. */  reshape_repo = Receive_repo;
+  reshape_entry_key = __jdf2c_make_key_Receive((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals) ;
+  reshape_entry = this_task->repo_entry;
+  /* Lookup the input data, and store them in the context if any */
+
+if(! this_task->data._f_T.fulfill ){ /* Flow T */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_T.data_out = NULL;  /* By default, if nothing matches */
+  /* Flow T [0] dependency [0] from predecessor Init */
+  if( NULL == (chunk = this_task->data._f_T.data_in) ) {
+  /* No data set up by predecessor on this task input flow */
+__parsec_redistribute_no_optimization_Init_parsec_assignment_t *target_locals = (__parsec_redistribute_no_optimization_Init_parsec_assignment_t*)&generic_locals;
+  const int Initbatch_col = target_locals->batch_col.value = batch_col; (void)Initbatch_col;
+  const int Initm_T = target_locals->m_T.value = m_T; (void)Initm_T;
+  const int Initn_T = target_locals->n_T.value = n_T; (void)Initn_T;
+  const int Initmb_T_inner = target_locals->mb_T_inner.value = redistribute_no_optimization_Init_inline_c_expr39_line_168(__parsec_tp, target_locals); (void)Initmb_T_inner;
+  const int Initnb_T_inner = target_locals->nb_T_inner.value = redistribute_no_optimization_Init_inline_c_expr38_line_169(__parsec_tp, target_locals); (void)Initnb_T_inner;
+  const int Initsizei_T = target_locals->sizei_T.value = (((Initm_T - m_T_START) * mb_T_INNER) - (disi_T % mb_T_INNER)); (void)Initsizei_T;
+  const int Initsizej_T = target_locals->sizej_T.value = (((Initn_T - n_T_START) * nb_T_INNER) - (disj_T % nb_T_INNER)); (void)Initsizej_T;
+  const int Initm_Y_start = target_locals->m_Y_start.value = redistribute_no_optimization_Init_inline_c_expr37_line_174(__parsec_tp, target_locals); (void)Initm_Y_start;
+  const int Initn_Y_start = target_locals->n_Y_start.value = redistribute_no_optimization_Init_inline_c_expr36_line_175(__parsec_tp, target_locals); (void)Initn_Y_start;
+  const int Initm_Y_end = target_locals->m_Y_end.value = redistribute_no_optimization_Init_inline_c_expr35_line_176(__parsec_tp, target_locals); (void)Initm_Y_end;
+  const int Initn_Y_end = target_locals->n_Y_end.value = redistribute_no_optimization_Init_inline_c_expr34_line_177(__parsec_tp, target_locals); (void)Initn_Y_end;
+    if( (reshape_entry != NULL) && (reshape_entry->data[0] != NULL) ){
+        /* Reshape promise set up on this task repo by predecessor */
+        consumed_repo = reshape_repo;
+        consumed_entry = reshape_entry;
+        consumed_entry_key = reshape_entry_key;
+        consumed_flow_index = 0;
+    }else{
+        /* Consume from predecessor's repo */
+        consumed_repo = Init_repo;
+        consumed_entry_key = __jdf2c_make_key_Init((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)target_locals) ;
+        consumed_entry = data_repo_lookup_entry( consumed_repo, consumed_entry_key );
+        consumed_flow_index = 0;
+    }
+    data.data   = NULL;
+    data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+        data.local.arena  = PARSEC_redistribute_no_optimization_TARGET_ADT->arena;
+    data.local.src_datatype = PARSEC_redistribute_no_optimization_TARGET_ADT->opaque_dtt;
+    data.local.dst_datatype = PARSEC_redistribute_no_optimization_TARGET_ADT->opaque_dtt;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    ACQUIRE_FLOW(this_task, "T", &redistribute_no_optimization_Init, "T", target_locals, chunk);
+    this_task->data._f_T.data_out = chunk;
+  } 
+  else {
+    /* Data set up by predecessor on this task input flow */
+    consumed_repo = this_task->data._f_T.source_repo;
+    consumed_entry = this_task->data._f_T.source_repo_entry;
+    consumed_entry_key = this_task->data._f_T.source_repo_entry->ht_item.key;
+    if( (reshape_entry != NULL) && (reshape_entry->data[0] != NULL) ){
+        /* Reshape promise set up on input by predecessor is on this task repo */
+        consumed_flow_index = 0;
+        assert( (this_task->data._f_T.source_repo == reshape_repo)
+             && (this_task->data._f_T.source_repo_entry == reshape_entry));
+    }else{
+        /* Reshape promise set up on input by predecessor is the predecesssor task repo */
+        consumed_flow_index = 0;
+    }
+    data.data   = NULL;
+    data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+        data.local.arena  = PARSEC_redistribute_no_optimization_TARGET_ADT->arena;
+    data.local.src_datatype = PARSEC_redistribute_no_optimization_TARGET_ADT->opaque_dtt;
+    data.local.dst_datatype = PARSEC_redistribute_no_optimization_TARGET_ADT->opaque_dtt;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    this_task->data._f_T.data_out = parsec_data_get_copy(chunk->original, target_device);
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+    parsec_prof_grapher_data_input(chunk->original, (parsec_task_t*)this_task, &flow_of_redistribute_no_optimization_Receive_for_T, 0);
+#endif
+  }
+    this_task->data._f_T.data_in     = chunk;
+    this_task->data._f_T.source_repo       = consumed_repo;
+    this_task->data._f_T.source_repo_entry = consumed_entry;
+    if( this_task->data._f_T.source_repo_entry == this_task->repo_entry ){
+      /* in case we have consume from this task repo entry for the flow,
+       * it is cleaned up, avoiding having old stuff during release_deps_of
+       */
+      this_task->repo_entry->data[0] = NULL;
+    }
+    this_task->data._f_T.fulfill = 1;
+}
+
+  /* ctl1 is a control flow */
+  this_task->data._f_ctl1.data_in         = NULL;
+  this_task->data._f_ctl1.data_out        = NULL;
+  this_task->data._f_ctl1.source_repo       = NULL;
+  this_task->data._f_ctl1.source_repo_entry = NULL;
+  /* ctl2 is a control flow */
+  this_task->data._f_ctl2.data_in         = NULL;
+  this_task->data._f_ctl2.data_out        = NULL;
+  this_task->data._f_ctl2.source_repo       = NULL;
+  this_task->data._f_ctl2.source_repo_entry = NULL;
+  /** Generate profiling information */
+#if defined(PARSEC_PROF_TRACE)
+  this_task->prof_info.desc = (parsec_data_collection_t*)__parsec_tp->super._g_descT;
+  this_task->prof_info.priority = this_task->priority;
+  this_task->prof_info.data_id   = ((parsec_data_collection_t*)__parsec_tp->super._g_descT)->data_key((parsec_data_collection_t*)__parsec_tp->super._g_descT, m_T, n_T);
+  this_task->prof_info.task_class_id = this_task->task_class->task_class_id;
+  this_task->prof_info.task_return_code = -1;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int datatype_lookup_of_redistribute_no_optimization_Receive(parsec_execution_stream_t *es, const parsec_task_t *this_generic_task, const parsec_task_t *parent_task,
+              uint32_t* flow_mask, parsec_dep_data_description_t* data)
+{
+  const __parsec_redistribute_no_optimization_Receive_task_t *this_task = (__parsec_redistribute_no_optimization_Receive_task_t*)this_generic_task;
+  const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_no_optimization_internal_taskpool_t *)this_task->taskpool;
+  (void)__parsec_tp; (void)es; (void)this_task; (void)data; (void)parent_task;
+  const int batch_col = this_task->locals.batch_col.value; (void)batch_col;
+  const int m_T = this_task->locals.m_T.value; (void)m_T;
+  const int n_T = this_task->locals.n_T.value; (void)n_T;
+  const int mb_T_inner = this_task->locals.mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = this_task->locals.nb_T_inner.value; (void)nb_T_inner;
+  const int nb_T_inner_next = this_task->locals.nb_T_inner_next.value; (void)nb_T_inner_next;
+  const int sizei_T = this_task->locals.sizei_T.value; (void)sizei_T;
+  const int sizej_T = this_task->locals.sizej_T.value; (void)sizej_T;
+  const int i_start = this_task->locals.i_start.value; (void)i_start;
+  const int j_start = this_task->locals.j_start.value; (void)j_start;
+  const int m_Y_start = this_task->locals.m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = this_task->locals.n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = this_task->locals.m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = this_task->locals.n_Y_end.value; (void)n_Y_end;
+  const int n_Y_start_next = this_task->locals.n_Y_start_next.value; (void)n_Y_start_next;
+  const int n_Y_end_next = this_task->locals.n_Y_end_next.value; (void)n_Y_end_next;
+  data->local.arena = data->remote.arena = NULL;
+  data->local.src_datatype  = data->local.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->local.src_count     = data->local.dst_count = 0;
+  data->local.src_displ     = data->local.dst_displ = 0;
+  data->data_future  = NULL;
+  if( (*flow_mask) & 0x80000000U ) { /* these are the input dependencies remote datatypes  */
+if( (*flow_mask) & 0x1U ) {  /* Flow T */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_redistribute_no_optimization_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_redistribute_no_optimization_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_redistribute_no_optimization_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+    goto no_mask_match;
+  }
+
+  /* these are the output dependencies remote datatypes */
+if( (*flow_mask) & 0x1U ) {  /* Flow T */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_redistribute_no_optimization_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_redistribute_no_optimization_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_redistribute_no_optimization_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+ no_mask_match:
+  data->data                             = NULL;
+  data->remote.src_datatype = data->remote.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->remote.src_count    = data->remote.dst_count = 0;
+  data->remote.src_displ    = data->remote.dst_displ = 0;
+  data->data_future  = NULL;
+  (*flow_mask) = 0;  /* nothing left */
+  (void)batch_col;  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)nb_T_inner_next;  (void)sizei_T;  (void)sizej_T;  (void)i_start;  (void)j_start;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;  (void)n_Y_start_next;  (void)n_Y_end_next;
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+static int hook_of_redistribute_no_optimization_Receive(parsec_execution_stream_t *es, __parsec_redistribute_no_optimization_Receive_task_t *this_task)
+{
+  __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_no_optimization_internal_taskpool_t *)this_task->taskpool;
+  (void)es; (void)__parsec_tp;
+  const int batch_col = this_task->locals.batch_col.value; (void)batch_col;
+  const int m_T = this_task->locals.m_T.value; (void)m_T;
+  const int n_T = this_task->locals.n_T.value; (void)n_T;
+  const int mb_T_inner = this_task->locals.mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = this_task->locals.nb_T_inner.value; (void)nb_T_inner;
+  const int nb_T_inner_next = this_task->locals.nb_T_inner_next.value; (void)nb_T_inner_next;
+  const int sizei_T = this_task->locals.sizei_T.value; (void)sizei_T;
+  const int sizej_T = this_task->locals.sizej_T.value; (void)sizej_T;
+  const int i_start = this_task->locals.i_start.value; (void)i_start;
+  const int j_start = this_task->locals.j_start.value; (void)j_start;
+  const int m_Y_start = this_task->locals.m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = this_task->locals.n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = this_task->locals.m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = this_task->locals.n_Y_end.value; (void)n_Y_end;
+  const int n_Y_start_next = this_task->locals.n_Y_start_next.value; (void)n_Y_start_next;
+  const int n_Y_end_next = this_task->locals.n_Y_end_next.value; (void)n_Y_end_next;
+  (void)batch_col;  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)nb_T_inner_next;  (void)sizei_T;  (void)sizej_T;  (void)i_start;  (void)j_start;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;  (void)n_Y_start_next;  (void)n_Y_end_next;
+
+  /** Declare the variables that will hold the data, and all the accounting for each */
+  parsec_data_copy_t *_f_T = this_task->data._f_T.data_in;
+  void *T = PARSEC_DATA_COPY_GET_PTR(_f_T); (void)T;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    data_repo_entry_t *eT = this_task->data._f_T.source_repo_entry;
+    if( (NULL != eT) && (eT->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eT->sim_exec_date;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+    if ( NULL != _f_T ) {
+#if defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) || defined(PARSEC_HAVE_DEV_HIP_SUPPORT)
+      parsec_data_transfer_ownership_to_copy( _f_T->original, 0 /* device */,
+                                           PARSEC_FLOW_ACCESS_RW);
+#endif  /* defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) || defined(PARSEC_HAVE_DEV_HIP_SUPPORT) */
+      _f_T->version++;  /* T */
+#if defined(PARSEC_DEBUG_NOISIER)
+      char tmp[128];
+      PARSEC_DEBUG_VERBOSE(10, parsec_debug_output,
+                           "Body of %s: change Data copy %p to version %d",
+                           parsec_task_snprintf(tmp, 128, (parsec_task_t*)(this_task)),
+                           _f_T, _f_T->version);
+#endif /* defined(PARSEC_DEBUG_NOISIER) */
+    }
+  /** Cache Awareness Accounting */
+#if defined(PARSEC_CACHE_AWARENESS)
+  cache_buf_referenced(es->closest_cache, T);
+#endif /* PARSEC_CACHE_AWARENESS */
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                                  Receive BODY                                  -----*/
+
+{
+
+}
+
+/*-----                              END OF Receive BODY                              -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#endif  /*  defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+static int complete_hook_of_redistribute_no_optimization_Receive(parsec_execution_stream_t *es, __parsec_redistribute_no_optimization_Receive_task_t *this_task)
+{
+  const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_no_optimization_internal_taskpool_t *)this_task->taskpool;
+#if defined(DISTRIBUTED)
+    const int batch_col = this_task->locals.batch_col.value; (void)batch_col;
+  const int m_T = this_task->locals.m_T.value; (void)m_T;
+  const int n_T = this_task->locals.n_T.value; (void)n_T;
+  const int mb_T_inner = this_task->locals.mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = this_task->locals.nb_T_inner.value; (void)nb_T_inner;
+  const int nb_T_inner_next = this_task->locals.nb_T_inner_next.value; (void)nb_T_inner_next;
+  const int sizei_T = this_task->locals.sizei_T.value; (void)sizei_T;
+  const int sizej_T = this_task->locals.sizej_T.value; (void)sizej_T;
+  const int i_start = this_task->locals.i_start.value; (void)i_start;
+  const int j_start = this_task->locals.j_start.value; (void)j_start;
+  const int m_Y_start = this_task->locals.m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = this_task->locals.n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = this_task->locals.m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = this_task->locals.n_Y_end.value; (void)n_Y_end;
+  const int n_Y_start_next = this_task->locals.n_Y_start_next.value; (void)n_Y_start_next;
+  const int n_Y_end_next = this_task->locals.n_Y_end_next.value; (void)n_Y_end_next;
+#endif  /* defined(DISTRIBUTED) */
+  (void)es; (void)__parsec_tp;
+parsec_data_t* data_t_desc = NULL; (void)data_t_desc;
+#if defined(DISTRIBUTED)
+  /** If not working on distributed, there is no risk that data is not in place */
+  data_t_desc = data_of_descT(m_T, n_T);
+  if( (NULL != this_task->data._f_T.data_out) && (this_task->data._f_T.data_out->original != data_t_desc) ) {
+    /* Writting back using remote_type */;
+    parsec_dep_data_description_t data;
+    data.data         = this_task->data._f_T.data_out;
+    data.local.arena        = NULL;
+    data.local.src_datatype = PARSEC_redistribute_no_optimization_TARGET_ADT->opaque_dtt;
+    data.local.src_count    = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_datatype = parsec_data_get_copy(data_t_desc, 0)->dtt;
+    data.local.dst_count    = 1;
+    data.local.dst_displ    = 0;
+    data.data_future  = NULL;
+    assert( data.local.src_count > 0 );
+    parsec_remote_dep_memcpy(es,
+                            this_task->taskpool,
+                            parsec_data_get_copy(data_of_descT(m_T, n_T), 0),
+                            this_task->data._f_T.data_out, &data);
+  }
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+  parsec_prof_grapher_data_output((parsec_task_t*)this_task, data_of_descT(m_T, n_T), &flow_of_redistribute_no_optimization_Receive_for_T);
+#endif
+  (void)batch_col;  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)nb_T_inner_next;  (void)sizei_T;  (void)sizej_T;  (void)i_start;  (void)j_start;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;  (void)n_Y_start_next;  (void)n_Y_end_next;
+
+#endif /* DISTRIBUTED */
+#if defined(PARSEC_PROF_GRAPHER)
+  parsec_prof_grapher_task((parsec_task_t*)this_task, es->th_id, es->virtual_process->vp_id,
+     __jdf2c_key_fns_Receive.key_hash(this_task->task_class->make_key( (parsec_taskpool_t*)this_task->taskpool, ((parsec_task_t*)this_task)->locals), NULL));
+#endif  /* defined(PARSEC_PROF_GRAPHER) */
+  release_deps_of_redistribute_no_optimization_Receive(es, this_task,
+      PARSEC_ACTION_RELEASE_REMOTE_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_REFS |
+      PARSEC_ACTION_RESHAPE_ON_RELEASE |
+      0x3,  /* mask of all dep_index */ 
+      NULL);
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static parsec_hook_return_t release_task_of_redistribute_no_optimization_Receive(parsec_execution_stream_t *es, parsec_task_t *this_task)
+{
+    const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp =
+        (const __parsec_redistribute_no_optimization_internal_taskpool_t *)this_task->taskpool;
+    parsec_hash_table_t *ht = (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[3];
+    parsec_key_t key = this_task->task_class->make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals);
+    parsec_hashable_dependency_t *hash_dep = (parsec_hashable_dependency_t *)parsec_hash_table_remove(ht, key);
+    parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);
+    return parsec_release_task_to_mempool_update_nbtasks(es, this_task);
+}
+
+static char *redistribute_no_optimization_redistribute_no_optimization_Receive_internal_init_deps_key_functions_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_no_optimization_internal_taskpool_t *)user_data;
+  __parsec_redistribute_no_optimization_Receive_parsec_assignment_t __jdf2c__assignments = {  .batch_col.value = 0, .m_T.value = 0, .n_T.value = 0, .mb_T_inner.value = 0, .nb_T_inner.value = 0, .nb_T_inner_next.value = 0, .sizei_T.value = 0, .sizej_T.value = 0, .i_start.value = 0, .j_start.value = 0, .m_Y_start.value = 0, .n_Y_start.value = 0, .m_Y_end.value = 0, .n_Y_end.value = 0, .n_Y_start_next.value = 0, .n_Y_end_next.value = 0 };
+  int batch_col = (__parsec_key) % __parsec_tp->Receive_batch_col_range + __parsec_tp->Receive_batch_col_min;
+  __parsec_key = __parsec_key / __parsec_tp->Receive_batch_col_range;
+  __jdf2c__assignments.batch_col.value = batch_col;
+  int m_T = (__parsec_key) % __parsec_tp->Receive_m_T_range + __parsec_tp->Receive_m_T_min;
+  __parsec_key = __parsec_key / __parsec_tp->Receive_m_T_range;
+  __jdf2c__assignments.m_T.value = m_T;
+  int n_T = (__parsec_key) % __parsec_tp->Receive_n_T_range + __parsec_tp->Receive_n_T_min;
+  __parsec_key = __parsec_key / __parsec_tp->Receive_n_T_range;
+  __jdf2c__assignments.n_T.value = n_T;
+  int mb_T_inner = redistribute_no_optimization_Receive_inline_c_expr9_line_317(__parsec_tp, &__jdf2c__assignments);
+  (void)mb_T_inner;
+  __jdf2c__assignments.mb_T_inner.value = mb_T_inner;
+  int nb_T_inner = redistribute_no_optimization_Receive_inline_c_expr8_line_318(__parsec_tp, &__jdf2c__assignments);
+  (void)nb_T_inner;
+  __jdf2c__assignments.nb_T_inner.value = nb_T_inner;
+  int nb_T_inner_next = redistribute_no_optimization_Receive_inline_c_expr7_line_320(__parsec_tp, &__jdf2c__assignments);
+  (void)nb_T_inner_next;
+  __jdf2c__assignments.nb_T_inner_next.value = nb_T_inner_next;
+  int sizei_T = (((m_T - m_T_START) * mb_T_INNER) - (disi_T % mb_T_INNER));
+  (void)sizei_T;
+  __jdf2c__assignments.sizei_T.value = sizei_T;
+  int sizej_T = (((n_T - n_T_START) * nb_T_INNER) - (disj_T % nb_T_INNER));
+  (void)sizej_T;
+  __jdf2c__assignments.sizej_T.value = sizej_T;
+  int i_start = redistribute_no_optimization_Receive_inline_c_expr6_line_325(__parsec_tp, &__jdf2c__assignments);
+  (void)i_start;
+  __jdf2c__assignments.i_start.value = i_start;
+  int j_start = redistribute_no_optimization_Receive_inline_c_expr5_line_326(__parsec_tp, &__jdf2c__assignments);
+  (void)j_start;
+  __jdf2c__assignments.j_start.value = j_start;
+  int m_Y_start = redistribute_no_optimization_Receive_inline_c_expr4_line_328(__parsec_tp, &__jdf2c__assignments);
+  (void)m_Y_start;
+  __jdf2c__assignments.m_Y_start.value = m_Y_start;
+  int n_Y_start = redistribute_no_optimization_Receive_inline_c_expr3_line_329(__parsec_tp, &__jdf2c__assignments);
+  (void)n_Y_start;
+  __jdf2c__assignments.n_Y_start.value = n_Y_start;
+  int m_Y_end = redistribute_no_optimization_Receive_inline_c_expr2_line_330(__parsec_tp, &__jdf2c__assignments);
+  (void)m_Y_end;
+  __jdf2c__assignments.m_Y_end.value = m_Y_end;
+  int n_Y_end = redistribute_no_optimization_Receive_inline_c_expr1_line_331(__parsec_tp, &__jdf2c__assignments);
+  (void)n_Y_end;
+  __jdf2c__assignments.n_Y_end.value = n_Y_end;
+  int n_Y_start_next = ((((((n_T - n_T_START) + num_col) * nb_T_INNER) - (disj_T % nb_T_INNER)) + disj_Y) / nb_Y_INNER);
+  (void)n_Y_start_next;
+  __jdf2c__assignments.n_Y_start_next.value = n_Y_start_next;
+  int n_Y_end_next = ((((((((n_T - n_T_START) + num_col) * nb_T_INNER) - (disj_T % nb_T_INNER)) + disj_Y) + nb_T_inner_next) - 1) / nb_Y_INNER);
+  (void)n_Y_end_next;
+  __jdf2c__assignments.n_Y_end_next.value = n_Y_end_next;
+  (void)__jdf2c__assignments;
+  snprintf(buffer, buffer_size, "Receive(%d, %d, %d)", batch_col, m_T, n_T);
+  return buffer;
+}
+
+static parsec_key_fn_t redistribute_no_optimization_redistribute_no_optimization_Receive_internal_init_deps_key_functions = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = redistribute_no_optimization_redistribute_no_optimization_Receive_internal_init_deps_key_functions_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/* Needs: min-max count-tasks iterate */
+static int redistribute_no_optimization_Receive_internal_init(parsec_execution_stream_t * es, __parsec_redistribute_no_optimization_Receive_task_t * this_task)
+{
+  __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_no_optimization_internal_taskpool_t*)this_task->taskpool;
+  int32_t nb_tasks = 0, saved_nb_tasks = 0;
+int32_t __batch_col_min = 0x7fffffff, __batch_col_max = 0;int32_t __jdf2c_batch_col_min = 0x7fffffff, __jdf2c_batch_col_max = 0;int32_t __m_T_min = 0x7fffffff, __m_T_max = 0;int32_t __jdf2c_m_T_min = 0x7fffffff, __jdf2c_m_T_max = 0;int32_t __n_T_min = 0x7fffffff, __n_T_max = 0;int32_t __jdf2c_n_T_min = 0x7fffffff, __jdf2c_n_T_max = 0;  __parsec_redistribute_no_optimization_Receive_parsec_assignment_t assignments = {  .batch_col.value = 0, .m_T.value = 0, .n_T.value = 0, .mb_T_inner.value = 0, .nb_T_inner.value = 0, .nb_T_inner_next.value = 0, .sizei_T.value = 0, .sizej_T.value = 0, .i_start.value = 0, .j_start.value = 0, .m_Y_start.value = 0, .n_Y_start.value = 0, .m_Y_end.value = 0, .n_Y_end.value = 0, .n_Y_start_next.value = 0, .n_Y_end_next.value = 0 };
+  int32_t  batch_col,  m_T,  n_T,  mb_T_inner,  nb_T_inner,  nb_T_inner_next,  sizei_T,  sizej_T,  i_start,  j_start,  m_Y_start,  n_Y_start,  m_Y_end,  n_Y_end,  n_Y_start_next,  n_Y_end_next;
+  int32_t __jdf2c_batch_col_start, __jdf2c_batch_col_end, __jdf2c_batch_col_inc;
+  int32_t __jdf2c_m_T_start, __jdf2c_m_T_end, __jdf2c_m_T_inc;
+  int32_t __jdf2c_n_T_start, __jdf2c_n_T_end, __jdf2c_n_T_inc;
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+  PARSEC_PROFILING_TRACE(es->es_profile,
+                         this_task->taskpool->profiling_array[START_KEY(this_task->task_class->task_class_id)],
+                         0,
+                         this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    __jdf2c_batch_col_start = 0;
+    __jdf2c_batch_col_end = NT;
+    __jdf2c_batch_col_inc = 1;
+    __batch_col_min = parsec_imin(__jdf2c_batch_col_start, __jdf2c_batch_col_end);
+    __batch_col_max = parsec_imax(__jdf2c_batch_col_start, __jdf2c_batch_col_end);
+    __jdf2c_batch_col_min = parsec_imin(__jdf2c_batch_col_min, __batch_col_min);
+    __jdf2c_batch_col_max = parsec_imax(__jdf2c_batch_col_max, __batch_col_max);
+    for(batch_col =  __jdf2c_batch_col_start;
+        batch_col <= __jdf2c_batch_col_end;
+        batch_col += __jdf2c_batch_col_inc) {
+    assignments.batch_col.value = batch_col;
+      __jdf2c_m_T_start = m_T_START;
+      __jdf2c_m_T_end = m_T_END;
+      __jdf2c_m_T_inc = 1;
+      __m_T_min = parsec_imin(__jdf2c_m_T_start, __jdf2c_m_T_end);
+      __m_T_max = parsec_imax(__jdf2c_m_T_start, __jdf2c_m_T_end);
+      __jdf2c_m_T_min = parsec_imin(__jdf2c_m_T_min, __m_T_min);
+      __jdf2c_m_T_max = parsec_imax(__jdf2c_m_T_max, __m_T_max);
+      for(m_T =  __jdf2c_m_T_start;
+          m_T <= __jdf2c_m_T_end;
+          m_T += __jdf2c_m_T_inc) {
+      assignments.m_T.value = m_T;
+        __jdf2c_n_T_start = redistribute_no_optimization_Receive_inline_c_expr11_line_315(__parsec_tp, &assignments);
+        __jdf2c_n_T_end = redistribute_no_optimization_Receive_inline_c_expr10_line_315(__parsec_tp, &assignments);
+        __jdf2c_n_T_inc = 1;
+        __n_T_min = parsec_imin(__jdf2c_n_T_start, __jdf2c_n_T_end);
+        __n_T_max = parsec_imax(__jdf2c_n_T_start, __jdf2c_n_T_end);
+        __jdf2c_n_T_min = parsec_imin(__jdf2c_n_T_min, __n_T_min);
+        __jdf2c_n_T_max = parsec_imax(__jdf2c_n_T_max, __n_T_max);
+        for(n_T =  __jdf2c_n_T_start;
+            n_T <= __jdf2c_n_T_end;
+            n_T += __jdf2c_n_T_inc) {
+        assignments.n_T.value = n_T;
+      {  /* block for the non-range variable mb_T_inner */
+          mb_T_inner = redistribute_no_optimization_Receive_inline_c_expr9_line_317(__parsec_tp, &assignments);
+          assignments.mb_T_inner.value = mb_T_inner;
+        {  /* block for the non-range variable nb_T_inner */
+            nb_T_inner = redistribute_no_optimization_Receive_inline_c_expr8_line_318(__parsec_tp, &assignments);
+            assignments.nb_T_inner.value = nb_T_inner;
+          {  /* block for the non-range variable nb_T_inner_next */
+              nb_T_inner_next = redistribute_no_optimization_Receive_inline_c_expr7_line_320(__parsec_tp, &assignments);
+              assignments.nb_T_inner_next.value = nb_T_inner_next;
+            {  /* block for the non-range variable sizei_T */
+                sizei_T = (((m_T - m_T_START) * mb_T_INNER) - (disi_T % mb_T_INNER));
+                assignments.sizei_T.value = sizei_T;
+              {  /* block for the non-range variable sizej_T */
+                  sizej_T = (((n_T - n_T_START) * nb_T_INNER) - (disj_T % nb_T_INNER));
+                  assignments.sizej_T.value = sizej_T;
+                {  /* block for the non-range variable i_start */
+                    i_start = redistribute_no_optimization_Receive_inline_c_expr6_line_325(__parsec_tp, &assignments);
+                    assignments.i_start.value = i_start;
+                  {  /* block for the non-range variable j_start */
+                      j_start = redistribute_no_optimization_Receive_inline_c_expr5_line_326(__parsec_tp, &assignments);
+                      assignments.j_start.value = j_start;
+                    {  /* block for the non-range variable m_Y_start */
+                        m_Y_start = redistribute_no_optimization_Receive_inline_c_expr4_line_328(__parsec_tp, &assignments);
+                        assignments.m_Y_start.value = m_Y_start;
+                      {  /* block for the non-range variable n_Y_start */
+                          n_Y_start = redistribute_no_optimization_Receive_inline_c_expr3_line_329(__parsec_tp, &assignments);
+                          assignments.n_Y_start.value = n_Y_start;
+                        {  /* block for the non-range variable m_Y_end */
+                            m_Y_end = redistribute_no_optimization_Receive_inline_c_expr2_line_330(__parsec_tp, &assignments);
+                            assignments.m_Y_end.value = m_Y_end;
+                          {  /* block for the non-range variable n_Y_end */
+                              n_Y_end = redistribute_no_optimization_Receive_inline_c_expr1_line_331(__parsec_tp, &assignments);
+                              assignments.n_Y_end.value = n_Y_end;
+                            {  /* block for the non-range variable n_Y_start_next */
+                                n_Y_start_next = ((((((n_T - n_T_START) + num_col) * nb_T_INNER) - (disj_T % nb_T_INNER)) + disj_Y) / nb_Y_INNER);
+                                assignments.n_Y_start_next.value = n_Y_start_next;
+                              {  /* block for the non-range variable n_Y_end_next */
+                                  n_Y_end_next = ((((((((n_T - n_T_START) + num_col) * nb_T_INNER) - (disj_T % nb_T_INNER)) + disj_Y) + nb_T_inner_next) - 1) / nb_Y_INNER);
+                                  assignments.n_Y_end_next.value = n_Y_end_next;
+                                  if( !Receive_pred(batch_col, m_T, n_T, mb_T_inner, nb_T_inner, nb_T_inner_next, sizei_T, sizej_T, i_start, j_start, m_Y_start, n_Y_start, m_Y_end, n_Y_end, n_Y_start_next, n_Y_end_next) ) continue;
+                                  nb_tasks++;
+                                } /* block for the non-range variable n_Y_end_next */ 
+                              } /* block for the non-range variable n_Y_start_next */ 
+                            } /* block for the non-range variable n_Y_end */ 
+                          } /* block for the non-range variable m_Y_end */ 
+                        } /* block for the non-range variable n_Y_start */ 
+                      } /* block for the non-range variable m_Y_start */ 
+                    } /* block for the non-range variable j_start */ 
+                  } /* block for the non-range variable i_start */ 
+                } /* block for the non-range variable sizej_T */ 
+              } /* block for the non-range variable sizei_T */ 
+            } /* block for the non-range variable nb_T_inner_next */ 
+          } /* block for the non-range variable nb_T_inner */ 
+        } /* block for the non-range variable mb_T_inner */ 
+      } /* Loop on normal range n_T */
+    } /* For loop of m_T */ 
+  } /* For loop of batch_col */ 
+   if( 0 != nb_tasks ) {
+     (void)parsec_atomic_fetch_add_int32(&__parsec_tp->initial_number_tasks, nb_tasks);
+   }
+  /* Set the range variables for the collision-free hash-computation */
+  __parsec_tp->Receive_batch_col_min   = __jdf2c_batch_col_min;
+  __parsec_tp->Receive_batch_col_range = (__jdf2c_batch_col_max - __jdf2c_batch_col_min) + 1;
+  __parsec_tp->Receive_m_T_min   = __jdf2c_m_T_min;
+  __parsec_tp->Receive_m_T_range = (__jdf2c_m_T_max - __jdf2c_m_T_min) + 1;
+  __parsec_tp->Receive_n_T_min   = __jdf2c_n_T_min;
+  __parsec_tp->Receive_n_T_range = (__jdf2c_n_T_max - __jdf2c_n_T_min) + 1;
+  this_task->status = PARSEC_TASK_STATUS_COMPLETE;
+
+  PARSEC_AYU_REGISTER_TASK(&redistribute_no_optimization_Receive);
+  __parsec_tp->super.super.dependencies_array[3] = PARSEC_OBJ_NEW(parsec_hash_table_t);
+  parsec_hash_table_init(__parsec_tp->super.super.dependencies_array[3], offsetof(parsec_hashable_dependency_t, ht_item), 10, redistribute_no_optimization_redistribute_no_optimization_Receive_internal_init_deps_key_functions, this_task->taskpool);
+  __parsec_tp->repositories[3] = data_repo_create_nothreadsafe(nb_tasks, __jdf2c_key_fns_Receive, (parsec_taskpool_t*)__parsec_tp, 3);
+(void)saved_nb_tasks;
+(void)__batch_col_min; (void)__batch_col_max;(void)__m_T_min; (void)__m_T_max;(void)__n_T_min; (void)__n_T_max;  (void)__jdf2c_batch_col_start; (void)__jdf2c_batch_col_end; (void)__jdf2c_batch_col_inc;  (void)__jdf2c_m_T_start; (void)__jdf2c_m_T_end; (void)__jdf2c_m_T_inc;  (void)__jdf2c_n_T_start; (void)__jdf2c_n_T_end; (void)__jdf2c_n_T_inc;  (void)assignments; (void)__parsec_tp; (void)es;
+  if(1 == parsec_atomic_fetch_dec_int32(&__parsec_tp->sync_point)) {
+    /* Last initialization task complete. Update the number of tasks. */
+    __parsec_tp->super.super.tdm.module->taskpool_addto_nb_tasks(&__parsec_tp->super.super, __parsec_tp->initial_number_tasks);
+    parsec_mfence();  /* write memory barrier to guarantee that the scheduler gets the correct number of tasks */
+    parsec_taskpool_enable((parsec_taskpool_t*)__parsec_tp, &__parsec_tp->startup_queue,
+                           (parsec_task_t*)this_task, es, __parsec_tp->super.super.nb_pending_actions);
+    __parsec_tp->super.super.tdm.module->taskpool_ready(&__parsec_tp->super.super);
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+    PARSEC_PROFILING_TRACE(es->es_profile,
+                           this_task->taskpool->profiling_array[2 * this_task->task_class->task_class_id + 1],
+                           0,
+                           this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    return PARSEC_HOOK_RETURN_DONE;
+  }
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static const __parsec_chore_t __redistribute_no_optimization_Receive_chores[] ={
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+    { .type     = PARSEC_DEV_CPU,
+      .evaluate = (parsec_evaluate_function_t*)NULL,
+      .hook     = (parsec_hook_t*)hook_of_redistribute_no_optimization_Receive },
+#endif  /* defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+    { .type     = PARSEC_DEV_NONE,
+      .evaluate = NULL,
+      .hook     = (parsec_hook_t*)NULL },  /* End marker */
+};
+
+static const parsec_task_class_t redistribute_no_optimization_Receive = {
+  .name = "Receive",
+  .task_class_id = 3,
+  .nb_flows = 3,
+  .nb_parameters = 3,
+  .nb_locals = 16,
+  .task_class_type = PARSEC_TASK_CLASS_TYPE_PTG,
+  .params = { &symb_redistribute_no_optimization_Receive_m_T, &symb_redistribute_no_optimization_Receive_n_T, &symb_redistribute_no_optimization_Receive_batch_col, NULL },
+  .locals = { &symb_redistribute_no_optimization_Receive_batch_col, &symb_redistribute_no_optimization_Receive_m_T, &symb_redistribute_no_optimization_Receive_n_T, &symb_redistribute_no_optimization_Receive_mb_T_inner, &symb_redistribute_no_optimization_Receive_nb_T_inner, &symb_redistribute_no_optimization_Receive_nb_T_inner_next, &symb_redistribute_no_optimization_Receive_sizei_T, &symb_redistribute_no_optimization_Receive_sizej_T, &symb_redistribute_no_optimization_Receive_i_start, &symb_redistribute_no_optimization_Receive_j_start, &symb_redistribute_no_optimization_Receive_m_Y_start, &symb_redistribute_no_optimization_Receive_n_Y_start, &symb_redistribute_no_optimization_Receive_m_Y_end, &symb_redistribute_no_optimization_Receive_n_Y_end, &symb_redistribute_no_optimization_Receive_n_Y_start_next, &symb_redistribute_no_optimization_Receive_n_Y_end_next, NULL },
+  .data_affinity = (parsec_data_ref_fn_t*)affinity_of_redistribute_no_optimization_Receive,
+  .initial_data = (parsec_data_ref_fn_t*)affinity_of_redistribute_no_optimization_Receive,
+  .final_data = (parsec_data_ref_fn_t*)affinity_of_redistribute_no_optimization_Receive,
+  .priority = NULL,
+  .properties = properties_of_redistribute_no_optimization_Receive,
+#if MAX_PARAM_COUNT < 1  /* number of read flows of Receive */
+  #error Too many read flows for task Receive
+#endif  /* MAX_PARAM_COUNT */
+#if MAX_PARAM_COUNT < 1  /* number of write flows of Receive */
+  #error Too many write flows for task Receive
+#endif  /* MAX_PARAM_COUNT */
+  .in = { &flow_of_redistribute_no_optimization_Receive_for_T, &flow_of_redistribute_no_optimization_Receive_for_ctl1, NULL },
+  .out = { &flow_of_redistribute_no_optimization_Receive_for_T, &flow_of_redistribute_no_optimization_Receive_for_ctl2, NULL },
+  .flags = 0x0|PARSEC_HAS_CTL_GATHER,
+  .dependencies_goal = 2,
+  .make_key = __jdf2c_make_key_Receive,
+  .task_snprintf = parsec_task_snprintf,
+#if defined(PARSEC_PROF_TRACE)
+  .profile_info = &parsec_task_profile_info,
+#endif
+  .key_functions = &__jdf2c_key_fns_Receive,
+  .fini = (parsec_hook_t*)NULL,
+  .incarnations = __redistribute_no_optimization_Receive_chores,
+  .find_deps = parsec_hash_find_deps,
+  .update_deps = parsec_update_deps_with_counter,
+  .iterate_successors = (parsec_traverse_function_t*)iterate_successors_of_redistribute_no_optimization_Receive,
+  .iterate_predecessors = (parsec_traverse_function_t*)iterate_predecessors_of_redistribute_no_optimization_Receive,
+  .release_deps = (parsec_release_deps_t*)release_deps_of_redistribute_no_optimization_Receive,
+  .prepare_output = (parsec_hook_t*)NULL,
+  .prepare_input = (parsec_hook_t*)data_lookup_of_redistribute_no_optimization_Receive,
+  .time_estimate = NULL,
+  .get_datatype = datatype_lookup_of_redistribute_no_optimization_Receive,
+  .complete_execution = (parsec_hook_t*)complete_hook_of_redistribute_no_optimization_Receive,
+  .release_task = &release_task_of_redistribute_no_optimization_Receive,
+#if defined(PARSEC_SIM)
+  .sim_cost_fct = (parsec_sim_cost_fct_t*)NULL,
+#endif
+};
+
+
+/******                                    Update                                    ******/
+
+static inline int32_t minexpr_of_symb_redistribute_no_optimization_Update_batch_col_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Update_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_redistribute_no_optimization_Update_batch_col = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_redistribute_no_optimization_Update_batch_col_fct }
+                   }
+};
+static inline int maxexpr_of_symb_redistribute_no_optimization_Update_batch_col_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Update_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int mb_T_inner = locals->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = locals->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int m_Y_start = locals->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = locals->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = locals->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = locals->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+  const int TL_row = locals->TL_row.value; (void)TL_row;
+  const int TL_col = locals->TL_col.value; (void)TL_col;
+  const int BR_row = locals->BR_row.value; (void)BR_row;
+  const int BR_col = locals->BR_col.value; (void)BR_col;
+
+  (void)batch_col;
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)i_start;
+  (void)j_start;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)m_Y;
+  (void)n_Y;
+  (void)TL_row;
+  (void)TL_col;
+  (void)BR_row;
+  (void)BR_col;
+  (void)__parsec_tp; (void)locals;
+  return NT;
+}
+static const parsec_expr_t maxexpr_of_symb_redistribute_no_optimization_Update_batch_col = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_redistribute_no_optimization_Update_batch_col_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_no_optimization_Update_batch_col = { .name = "batch_col", .context_index = 0, .min = &minexpr_of_symb_redistribute_no_optimization_Update_batch_col, .max = &maxexpr_of_symb_redistribute_no_optimization_Update_batch_col, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int minexpr_of_symb_redistribute_no_optimization_Update_m_T_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Update_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int mb_T_inner = locals->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = locals->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int m_Y_start = locals->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = locals->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = locals->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = locals->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+  const int TL_row = locals->TL_row.value; (void)TL_row;
+  const int TL_col = locals->TL_col.value; (void)TL_col;
+  const int BR_row = locals->BR_row.value; (void)BR_row;
+  const int BR_col = locals->BR_col.value; (void)BR_col;
+
+  (void)batch_col;
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)i_start;
+  (void)j_start;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)m_Y;
+  (void)n_Y;
+  (void)TL_row;
+  (void)TL_col;
+  (void)BR_row;
+  (void)BR_col;
+  (void)__parsec_tp; (void)locals;
+  return m_T_START;
+}
+static const parsec_expr_t minexpr_of_symb_redistribute_no_optimization_Update_m_T = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_redistribute_no_optimization_Update_m_T_fct }
+                   }
+};
+static inline int maxexpr_of_symb_redistribute_no_optimization_Update_m_T_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Update_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int mb_T_inner = locals->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = locals->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int m_Y_start = locals->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = locals->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = locals->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = locals->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+  const int TL_row = locals->TL_row.value; (void)TL_row;
+  const int TL_col = locals->TL_col.value; (void)TL_col;
+  const int BR_row = locals->BR_row.value; (void)BR_row;
+  const int BR_col = locals->BR_col.value; (void)BR_col;
+
+  (void)batch_col;
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)i_start;
+  (void)j_start;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)m_Y;
+  (void)n_Y;
+  (void)TL_row;
+  (void)TL_col;
+  (void)BR_row;
+  (void)BR_col;
+  (void)__parsec_tp; (void)locals;
+  return m_T_END;
+}
+static const parsec_expr_t maxexpr_of_symb_redistribute_no_optimization_Update_m_T = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_redistribute_no_optimization_Update_m_T_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_no_optimization_Update_m_T = { .name = "m_T", .context_index = 1, .min = &minexpr_of_symb_redistribute_no_optimization_Update_m_T, .max = &maxexpr_of_symb_redistribute_no_optimization_Update_m_T, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int32_t minexpr_of_symb_redistribute_no_optimization_Update_n_T_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Update_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_no_optimization_Update_inline_c_expr23_line_249(__parsec_tp, locals);
+}
+static const parsec_expr_t minexpr_of_symb_redistribute_no_optimization_Update_n_T = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_redistribute_no_optimization_Update_n_T_fct }
+                   }
+};
+static inline int32_t maxexpr_of_symb_redistribute_no_optimization_Update_n_T_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Update_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_no_optimization_Update_inline_c_expr22_line_249(__parsec_tp, locals);
+}
+static const parsec_expr_t maxexpr_of_symb_redistribute_no_optimization_Update_n_T = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_redistribute_no_optimization_Update_n_T_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_no_optimization_Update_n_T = { .name = "n_T", .context_index = 2, .min = &minexpr_of_symb_redistribute_no_optimization_Update_n_T, .max = &maxexpr_of_symb_redistribute_no_optimization_Update_n_T, .cst_inc = 1, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_redistribute_no_optimization_Update_mb_T_inner_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Update_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_no_optimization_Update_inline_c_expr21_line_251(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_redistribute_no_optimization_Update_mb_T_inner = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_no_optimization_Update_mb_T_inner_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_no_optimization_Update_mb_T_inner = { .name = "mb_T_inner", .context_index = 3, .min = &expr_of_symb_redistribute_no_optimization_Update_mb_T_inner, .max = &expr_of_symb_redistribute_no_optimization_Update_mb_T_inner, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_redistribute_no_optimization_Update_nb_T_inner_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Update_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_no_optimization_Update_inline_c_expr20_line_252(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_redistribute_no_optimization_Update_nb_T_inner = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_no_optimization_Update_nb_T_inner_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_no_optimization_Update_nb_T_inner = { .name = "nb_T_inner", .context_index = 4, .min = &expr_of_symb_redistribute_no_optimization_Update_nb_T_inner, .max = &expr_of_symb_redistribute_no_optimization_Update_nb_T_inner, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_redistribute_no_optimization_Update_i_start_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Update_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_no_optimization_Update_inline_c_expr19_line_254(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_redistribute_no_optimization_Update_i_start = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_no_optimization_Update_i_start_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_no_optimization_Update_i_start = { .name = "i_start", .context_index = 5, .min = &expr_of_symb_redistribute_no_optimization_Update_i_start, .max = &expr_of_symb_redistribute_no_optimization_Update_i_start, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_redistribute_no_optimization_Update_j_start_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Update_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_no_optimization_Update_inline_c_expr18_line_255(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_redistribute_no_optimization_Update_j_start = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_no_optimization_Update_j_start_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_no_optimization_Update_j_start = { .name = "j_start", .context_index = 6, .min = &expr_of_symb_redistribute_no_optimization_Update_j_start, .max = &expr_of_symb_redistribute_no_optimization_Update_j_start, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_redistribute_no_optimization_Update_m_Y_start_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Update_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_no_optimization_Update_inline_c_expr17_line_257(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_redistribute_no_optimization_Update_m_Y_start = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_no_optimization_Update_m_Y_start_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_no_optimization_Update_m_Y_start = { .name = "m_Y_start", .context_index = 7, .min = &expr_of_symb_redistribute_no_optimization_Update_m_Y_start, .max = &expr_of_symb_redistribute_no_optimization_Update_m_Y_start, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_redistribute_no_optimization_Update_n_Y_start_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Update_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_no_optimization_Update_inline_c_expr16_line_258(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_redistribute_no_optimization_Update_n_Y_start = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_no_optimization_Update_n_Y_start_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_no_optimization_Update_n_Y_start = { .name = "n_Y_start", .context_index = 8, .min = &expr_of_symb_redistribute_no_optimization_Update_n_Y_start, .max = &expr_of_symb_redistribute_no_optimization_Update_n_Y_start, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_redistribute_no_optimization_Update_m_Y_end_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Update_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_no_optimization_Update_inline_c_expr15_line_259(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_redistribute_no_optimization_Update_m_Y_end = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_no_optimization_Update_m_Y_end_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_no_optimization_Update_m_Y_end = { .name = "m_Y_end", .context_index = 9, .min = &expr_of_symb_redistribute_no_optimization_Update_m_Y_end, .max = &expr_of_symb_redistribute_no_optimization_Update_m_Y_end, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_redistribute_no_optimization_Update_n_Y_end_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Update_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_no_optimization_Update_inline_c_expr14_line_260(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_redistribute_no_optimization_Update_n_Y_end = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_no_optimization_Update_n_Y_end_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_no_optimization_Update_n_Y_end = { .name = "n_Y_end", .context_index = 10, .min = &expr_of_symb_redistribute_no_optimization_Update_n_Y_end, .max = &expr_of_symb_redistribute_no_optimization_Update_n_Y_end, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int minexpr_of_symb_redistribute_no_optimization_Update_m_Y_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Update_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int mb_T_inner = locals->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = locals->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int m_Y_start = locals->m_Y_start.value;
+  const int n_Y_start = locals->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = locals->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = locals->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+  const int TL_row = locals->TL_row.value; (void)TL_row;
+  const int TL_col = locals->TL_col.value; (void)TL_col;
+  const int BR_row = locals->BR_row.value; (void)BR_row;
+  const int BR_col = locals->BR_col.value; (void)BR_col;
+
+  (void)batch_col;
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)i_start;
+  (void)j_start;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)m_Y;
+  (void)n_Y;
+  (void)TL_row;
+  (void)TL_col;
+  (void)BR_row;
+  (void)BR_col;
+  (void)__parsec_tp; (void)locals;
+  return m_Y_start;
+}
+static const parsec_expr_t minexpr_of_symb_redistribute_no_optimization_Update_m_Y = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_redistribute_no_optimization_Update_m_Y_fct }
+                   }
+};
+static inline int maxexpr_of_symb_redistribute_no_optimization_Update_m_Y_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Update_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int mb_T_inner = locals->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = locals->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int m_Y_start = locals->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = locals->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = locals->m_Y_end.value;
+  const int n_Y_end = locals->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+  const int TL_row = locals->TL_row.value; (void)TL_row;
+  const int TL_col = locals->TL_col.value; (void)TL_col;
+  const int BR_row = locals->BR_row.value; (void)BR_row;
+  const int BR_col = locals->BR_col.value; (void)BR_col;
+
+  (void)batch_col;
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)i_start;
+  (void)j_start;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)m_Y;
+  (void)n_Y;
+  (void)TL_row;
+  (void)TL_col;
+  (void)BR_row;
+  (void)BR_col;
+  (void)__parsec_tp; (void)locals;
+  return m_Y_end;
+}
+static const parsec_expr_t maxexpr_of_symb_redistribute_no_optimization_Update_m_Y = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_redistribute_no_optimization_Update_m_Y_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_no_optimization_Update_m_Y = { .name = "m_Y", .context_index = 11, .min = &minexpr_of_symb_redistribute_no_optimization_Update_m_Y, .max = &maxexpr_of_symb_redistribute_no_optimization_Update_m_Y, .cst_inc = 1, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int minexpr_of_symb_redistribute_no_optimization_Update_n_Y_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Update_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int mb_T_inner = locals->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = locals->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int m_Y_start = locals->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = locals->n_Y_start.value;
+  const int m_Y_end = locals->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = locals->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+  const int TL_row = locals->TL_row.value; (void)TL_row;
+  const int TL_col = locals->TL_col.value; (void)TL_col;
+  const int BR_row = locals->BR_row.value; (void)BR_row;
+  const int BR_col = locals->BR_col.value; (void)BR_col;
+
+  (void)batch_col;
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)i_start;
+  (void)j_start;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)m_Y;
+  (void)n_Y;
+  (void)TL_row;
+  (void)TL_col;
+  (void)BR_row;
+  (void)BR_col;
+  (void)__parsec_tp; (void)locals;
+  return n_Y_start;
+}
+static const parsec_expr_t minexpr_of_symb_redistribute_no_optimization_Update_n_Y = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_redistribute_no_optimization_Update_n_Y_fct }
+                   }
+};
+static inline int maxexpr_of_symb_redistribute_no_optimization_Update_n_Y_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Update_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int mb_T_inner = locals->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = locals->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int m_Y_start = locals->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = locals->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = locals->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = locals->n_Y_end.value;
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+  const int TL_row = locals->TL_row.value; (void)TL_row;
+  const int TL_col = locals->TL_col.value; (void)TL_col;
+  const int BR_row = locals->BR_row.value; (void)BR_row;
+  const int BR_col = locals->BR_col.value; (void)BR_col;
+
+  (void)batch_col;
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)i_start;
+  (void)j_start;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)m_Y;
+  (void)n_Y;
+  (void)TL_row;
+  (void)TL_col;
+  (void)BR_row;
+  (void)BR_col;
+  (void)__parsec_tp; (void)locals;
+  return n_Y_end;
+}
+static const parsec_expr_t maxexpr_of_symb_redistribute_no_optimization_Update_n_Y = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_redistribute_no_optimization_Update_n_Y_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_no_optimization_Update_n_Y = { .name = "n_Y", .context_index = 12, .min = &minexpr_of_symb_redistribute_no_optimization_Update_n_Y, .max = &maxexpr_of_symb_redistribute_no_optimization_Update_n_Y, .cst_inc = 1, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_redistribute_no_optimization_Update_TL_row_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Update_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_no_optimization_Update_inline_c_expr13_line_265(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_redistribute_no_optimization_Update_TL_row = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_no_optimization_Update_TL_row_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_no_optimization_Update_TL_row = { .name = "TL_row", .context_index = 13, .min = &expr_of_symb_redistribute_no_optimization_Update_TL_row, .max = &expr_of_symb_redistribute_no_optimization_Update_TL_row, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_redistribute_no_optimization_Update_TL_col_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Update_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_no_optimization_Update_inline_c_expr12_line_266(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_redistribute_no_optimization_Update_TL_col = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_no_optimization_Update_TL_col_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_no_optimization_Update_TL_col = { .name = "TL_col", .context_index = 14, .min = &expr_of_symb_redistribute_no_optimization_Update_TL_col, .max = &expr_of_symb_redistribute_no_optimization_Update_TL_col, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int expr_of_symb_redistribute_no_optimization_Update_BR_row_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Update_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int mb_T_inner = locals->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = locals->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int m_Y_start = locals->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = locals->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = locals->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = locals->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+  const int TL_row = locals->TL_row.value; (void)TL_row;
+  const int TL_col = locals->TL_col.value; (void)TL_col;
+  const int BR_row = locals->BR_row.value; (void)BR_row;
+  const int BR_col = locals->BR_col.value; (void)BR_col;
+
+  (void)batch_col;
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)i_start;
+  (void)j_start;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)m_Y;
+  (void)n_Y;
+  (void)TL_row;
+  (void)TL_col;
+  (void)BR_row;
+  (void)BR_col;
+  (void)__parsec_tp; (void)locals;
+  return ((((i_start + mb_T_inner) - 1) % mb_Y_INNER) + 1);
+}
+static const parsec_expr_t expr_of_symb_redistribute_no_optimization_Update_BR_row = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_no_optimization_Update_BR_row_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_no_optimization_Update_BR_row = { .name = "BR_row", .context_index = 15, .min = &expr_of_symb_redistribute_no_optimization_Update_BR_row, .max = &expr_of_symb_redistribute_no_optimization_Update_BR_row, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int expr_of_symb_redistribute_no_optimization_Update_BR_col_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Update_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int mb_T_inner = locals->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = locals->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int m_Y_start = locals->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = locals->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = locals->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = locals->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+  const int TL_row = locals->TL_row.value; (void)TL_row;
+  const int TL_col = locals->TL_col.value; (void)TL_col;
+  const int BR_row = locals->BR_row.value; (void)BR_row;
+  const int BR_col = locals->BR_col.value; (void)BR_col;
+
+  (void)batch_col;
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)i_start;
+  (void)j_start;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)m_Y;
+  (void)n_Y;
+  (void)TL_row;
+  (void)TL_col;
+  (void)BR_row;
+  (void)BR_col;
+  (void)__parsec_tp; (void)locals;
+  return ((((j_start + nb_T_inner) - 1) % nb_Y_INNER) + 1);
+}
+static const parsec_expr_t expr_of_symb_redistribute_no_optimization_Update_BR_col = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_no_optimization_Update_BR_col_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_no_optimization_Update_BR_col = { .name = "BR_col", .context_index = 16, .min = &expr_of_symb_redistribute_no_optimization_Update_BR_col, .max = &expr_of_symb_redistribute_no_optimization_Update_BR_col, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int affinity_of_redistribute_no_optimization_Update(const __parsec_redistribute_no_optimization_Update_task_t *this_task,
+                     parsec_data_ref_t *ref)
+{
+    const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp = (const __parsec_redistribute_no_optimization_internal_taskpool_t*)this_task->taskpool;
+  const int batch_col = this_task->locals.batch_col.value; (void)batch_col;
+  const int m_T = this_task->locals.m_T.value; (void)m_T;
+  const int n_T = this_task->locals.n_T.value; (void)n_T;
+  const int mb_T_inner = this_task->locals.mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = this_task->locals.nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = this_task->locals.i_start.value; (void)i_start;
+  const int j_start = this_task->locals.j_start.value; (void)j_start;
+  const int m_Y_start = this_task->locals.m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = this_task->locals.n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = this_task->locals.m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = this_task->locals.n_Y_end.value; (void)n_Y_end;
+  const int m_Y = this_task->locals.m_Y.value; (void)m_Y;
+  const int n_Y = this_task->locals.n_Y.value; (void)n_Y;
+  const int TL_row = this_task->locals.TL_row.value; (void)TL_row;
+  const int TL_col = this_task->locals.TL_col.value; (void)TL_col;
+  const int BR_row = this_task->locals.BR_row.value; (void)BR_row;
+  const int BR_col = this_task->locals.BR_col.value; (void)BR_col;
+
+  /* Silent Warnings: should look into predicate to know what variables are usefull */
+  (void)batch_col;
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)i_start;
+  (void)j_start;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)m_Y;
+  (void)n_Y;
+  (void)TL_row;
+  (void)TL_col;
+  (void)BR_row;
+  (void)BR_col;
+  ref->dc = (parsec_data_collection_t *)__parsec_tp->super._g_descT;
+  /* Compute data key */
+  ref->key = ref->dc->data_key(ref->dc, m_T, n_T);
+  return 1;
+}
+static const parsec_property_t properties_of_redistribute_no_optimization_Update[1] = {
+  {.name = NULL, .expr = NULL}
+};
+static const parsec_dep_t flow_of_redistribute_no_optimization_Update_for_T_dep1_atline_272 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 0, /* redistribute_no_optimization_Init */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_redistribute_no_optimization_Init_for_T,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_redistribute_no_optimization_Update_for_T,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_redistribute_no_optimization_Update_for_T = {
+  .name               = "T",
+  .sym_type           = PARSEC_SYM_IN,
+  .flow_flags         = PARSEC_FLOW_ACCESS_READ,
+  .flow_index         = 0,
+  .flow_datatype_mask = 0x0,
+  .dep_in     = { &flow_of_redistribute_no_optimization_Update_for_T_dep1_atline_272 },
+  .dep_out    = { NULL }
+};
+
+static inline int expr_of_cond_for_flow_of_redistribute_no_optimization_Update_for_NW_dep1_atline_274_iftrue_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Update_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int mb_T_inner = locals->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = locals->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int m_Y_start = locals->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = locals->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = locals->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = locals->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+  const int TL_row = locals->TL_row.value; (void)TL_row;
+  const int TL_col = locals->TL_col.value; (void)TL_col;
+  const int BR_row = locals->BR_row.value; (void)BR_row;
+  const int BR_col = locals->BR_col.value; (void)BR_col;
+
+  (void)batch_col;
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)i_start;
+  (void)j_start;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)m_Y;
+  (void)n_Y;
+  (void)TL_row;
+  (void)TL_col;
+  (void)BR_row;
+  (void)BR_col;
+  (void)__parsec_tp; (void)locals;
+  return ((m_Y) == (m_Y_start) && (n_Y) == (n_Y_start));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_redistribute_no_optimization_Update_for_NW_dep1_atline_274_iftrue = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_redistribute_no_optimization_Update_for_NW_dep1_atline_274_iftrue_fct }
+                   }
+};
+static const parsec_dep_t flow_of_redistribute_no_optimization_Update_for_NW_dep1_atline_274_iftrue = {
+  .cond = &expr_of_cond_for_flow_of_redistribute_no_optimization_Update_for_NW_dep1_atline_274_iftrue,  /* ((m_Y) == (m_Y_start) && (n_Y) == (n_Y_start)) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 1, /* redistribute_no_optimization_Send */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_redistribute_no_optimization_Send_for_Y,
+  .dep_index = 1,
+  .dep_datatype_index = 1,
+  .belongs_to = &flow_of_redistribute_no_optimization_Update_for_NW,
+};
+static inline int expr_of_cond_for_flow_of_redistribute_no_optimization_Update_for_NW_dep1_atline_274_iffalse_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Update_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int mb_T_inner = locals->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = locals->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int m_Y_start = locals->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = locals->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = locals->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = locals->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+  const int TL_row = locals->TL_row.value; (void)TL_row;
+  const int TL_col = locals->TL_col.value; (void)TL_col;
+  const int BR_row = locals->BR_row.value; (void)BR_row;
+  const int BR_col = locals->BR_col.value; (void)BR_col;
+
+  (void)batch_col;
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)i_start;
+  (void)j_start;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)m_Y;
+  (void)n_Y;
+  (void)TL_row;
+  (void)TL_col;
+  (void)BR_row;
+  (void)BR_col;
+  (void)__parsec_tp; (void)locals;
+  return !(((m_Y) == (m_Y_start) && (n_Y) == (n_Y_start)));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_redistribute_no_optimization_Update_for_NW_dep1_atline_274_iffalse = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_redistribute_no_optimization_Update_for_NW_dep1_atline_274_iffalse_fct }
+                   }
+};
+static const parsec_dep_t flow_of_redistribute_no_optimization_Update_for_NW_dep1_atline_274_iffalse = {
+  .cond = &expr_of_cond_for_flow_of_redistribute_no_optimization_Update_for_NW_dep1_atline_274_iffalse,  /* !((m_Y) == (m_Y_start) && (n_Y) == (n_Y_start)) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = PARSEC_LOCAL_DATA_TASK_CLASS_ID, /* redistribute_no_optimization___parsec_null_type */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .dep_index = 1,
+  .dep_datatype_index = 1,
+  .belongs_to = &flow_of_redistribute_no_optimization_Update_for_NW,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_redistribute_no_optimization_Update_for_NW = {
+  .name               = "NW",
+  .sym_type           = PARSEC_SYM_IN,
+  .flow_flags         = PARSEC_FLOW_ACCESS_READ|PARSEC_FLOW_HAS_IN_DEPS,
+  .flow_index         = 1,
+  .flow_datatype_mask = 0x0,
+  .dep_in     = { &flow_of_redistribute_no_optimization_Update_for_NW_dep1_atline_274_iftrue,
+ &flow_of_redistribute_no_optimization_Update_for_NW_dep1_atline_274_iffalse },
+  .dep_out    = { NULL }
+};
+
+static inline int expr_of_cond_for_flow_of_redistribute_no_optimization_Update_for_NE_dep1_atline_276_iftrue_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Update_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int mb_T_inner = locals->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = locals->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int m_Y_start = locals->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = locals->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = locals->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = locals->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+  const int TL_row = locals->TL_row.value; (void)TL_row;
+  const int TL_col = locals->TL_col.value; (void)TL_col;
+  const int BR_row = locals->BR_row.value; (void)BR_row;
+  const int BR_col = locals->BR_col.value; (void)BR_col;
+
+  (void)batch_col;
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)i_start;
+  (void)j_start;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)m_Y;
+  (void)n_Y;
+  (void)TL_row;
+  (void)TL_col;
+  (void)BR_row;
+  (void)BR_col;
+  (void)__parsec_tp; (void)locals;
+  return (((m_Y) == (m_Y_start) && (n_Y) == (n_Y_end)) && (n_Y_start) != (n_Y_end));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_redistribute_no_optimization_Update_for_NE_dep1_atline_276_iftrue = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_redistribute_no_optimization_Update_for_NE_dep1_atline_276_iftrue_fct }
+                   }
+};
+static const parsec_dep_t flow_of_redistribute_no_optimization_Update_for_NE_dep1_atline_276_iftrue = {
+  .cond = &expr_of_cond_for_flow_of_redistribute_no_optimization_Update_for_NE_dep1_atline_276_iftrue,  /* (((m_Y) == (m_Y_start) && (n_Y) == (n_Y_end)) && (n_Y_start) != (n_Y_end)) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 1, /* redistribute_no_optimization_Send */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_redistribute_no_optimization_Send_for_Y,
+  .dep_index = 2,
+  .dep_datatype_index = 2,
+  .belongs_to = &flow_of_redistribute_no_optimization_Update_for_NE,
+};
+static inline int expr_of_cond_for_flow_of_redistribute_no_optimization_Update_for_NE_dep1_atline_276_iffalse_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Update_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int mb_T_inner = locals->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = locals->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int m_Y_start = locals->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = locals->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = locals->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = locals->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+  const int TL_row = locals->TL_row.value; (void)TL_row;
+  const int TL_col = locals->TL_col.value; (void)TL_col;
+  const int BR_row = locals->BR_row.value; (void)BR_row;
+  const int BR_col = locals->BR_col.value; (void)BR_col;
+
+  (void)batch_col;
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)i_start;
+  (void)j_start;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)m_Y;
+  (void)n_Y;
+  (void)TL_row;
+  (void)TL_col;
+  (void)BR_row;
+  (void)BR_col;
+  (void)__parsec_tp; (void)locals;
+  return !((((m_Y) == (m_Y_start) && (n_Y) == (n_Y_end)) && (n_Y_start) != (n_Y_end)));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_redistribute_no_optimization_Update_for_NE_dep1_atline_276_iffalse = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_redistribute_no_optimization_Update_for_NE_dep1_atline_276_iffalse_fct }
+                   }
+};
+static const parsec_dep_t flow_of_redistribute_no_optimization_Update_for_NE_dep1_atline_276_iffalse = {
+  .cond = &expr_of_cond_for_flow_of_redistribute_no_optimization_Update_for_NE_dep1_atline_276_iffalse,  /* !(((m_Y) == (m_Y_start) && (n_Y) == (n_Y_end)) && (n_Y_start) != (n_Y_end)) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = PARSEC_LOCAL_DATA_TASK_CLASS_ID, /* redistribute_no_optimization___parsec_null_type */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .dep_index = 2,
+  .dep_datatype_index = 2,
+  .belongs_to = &flow_of_redistribute_no_optimization_Update_for_NE,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_redistribute_no_optimization_Update_for_NE = {
+  .name               = "NE",
+  .sym_type           = PARSEC_SYM_IN,
+  .flow_flags         = PARSEC_FLOW_ACCESS_READ|PARSEC_FLOW_HAS_IN_DEPS,
+  .flow_index         = 2,
+  .flow_datatype_mask = 0x0,
+  .dep_in     = { &flow_of_redistribute_no_optimization_Update_for_NE_dep1_atline_276_iftrue,
+ &flow_of_redistribute_no_optimization_Update_for_NE_dep1_atline_276_iffalse },
+  .dep_out    = { NULL }
+};
+
+static inline int expr_of_cond_for_flow_of_redistribute_no_optimization_Update_for_SW_dep1_atline_278_iftrue_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Update_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int mb_T_inner = locals->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = locals->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int m_Y_start = locals->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = locals->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = locals->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = locals->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+  const int TL_row = locals->TL_row.value; (void)TL_row;
+  const int TL_col = locals->TL_col.value; (void)TL_col;
+  const int BR_row = locals->BR_row.value; (void)BR_row;
+  const int BR_col = locals->BR_col.value; (void)BR_col;
+
+  (void)batch_col;
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)i_start;
+  (void)j_start;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)m_Y;
+  (void)n_Y;
+  (void)TL_row;
+  (void)TL_col;
+  (void)BR_row;
+  (void)BR_col;
+  (void)__parsec_tp; (void)locals;
+  return (((m_Y) == (m_Y_end) && (n_Y) == (n_Y_start)) && (m_Y_start) != (m_Y_end));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_redistribute_no_optimization_Update_for_SW_dep1_atline_278_iftrue = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_redistribute_no_optimization_Update_for_SW_dep1_atline_278_iftrue_fct }
+                   }
+};
+static const parsec_dep_t flow_of_redistribute_no_optimization_Update_for_SW_dep1_atline_278_iftrue = {
+  .cond = &expr_of_cond_for_flow_of_redistribute_no_optimization_Update_for_SW_dep1_atline_278_iftrue,  /* (((m_Y) == (m_Y_end) && (n_Y) == (n_Y_start)) && (m_Y_start) != (m_Y_end)) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 1, /* redistribute_no_optimization_Send */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_redistribute_no_optimization_Send_for_Y,
+  .dep_index = 3,
+  .dep_datatype_index = 3,
+  .belongs_to = &flow_of_redistribute_no_optimization_Update_for_SW,
+};
+static inline int expr_of_cond_for_flow_of_redistribute_no_optimization_Update_for_SW_dep1_atline_278_iffalse_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Update_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int mb_T_inner = locals->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = locals->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int m_Y_start = locals->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = locals->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = locals->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = locals->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+  const int TL_row = locals->TL_row.value; (void)TL_row;
+  const int TL_col = locals->TL_col.value; (void)TL_col;
+  const int BR_row = locals->BR_row.value; (void)BR_row;
+  const int BR_col = locals->BR_col.value; (void)BR_col;
+
+  (void)batch_col;
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)i_start;
+  (void)j_start;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)m_Y;
+  (void)n_Y;
+  (void)TL_row;
+  (void)TL_col;
+  (void)BR_row;
+  (void)BR_col;
+  (void)__parsec_tp; (void)locals;
+  return !((((m_Y) == (m_Y_end) && (n_Y) == (n_Y_start)) && (m_Y_start) != (m_Y_end)));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_redistribute_no_optimization_Update_for_SW_dep1_atline_278_iffalse = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_redistribute_no_optimization_Update_for_SW_dep1_atline_278_iffalse_fct }
+                   }
+};
+static const parsec_dep_t flow_of_redistribute_no_optimization_Update_for_SW_dep1_atline_278_iffalse = {
+  .cond = &expr_of_cond_for_flow_of_redistribute_no_optimization_Update_for_SW_dep1_atline_278_iffalse,  /* !(((m_Y) == (m_Y_end) && (n_Y) == (n_Y_start)) && (m_Y_start) != (m_Y_end)) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = PARSEC_LOCAL_DATA_TASK_CLASS_ID, /* redistribute_no_optimization___parsec_null_type */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .dep_index = 3,
+  .dep_datatype_index = 3,
+  .belongs_to = &flow_of_redistribute_no_optimization_Update_for_SW,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_redistribute_no_optimization_Update_for_SW = {
+  .name               = "SW",
+  .sym_type           = PARSEC_SYM_IN,
+  .flow_flags         = PARSEC_FLOW_ACCESS_READ|PARSEC_FLOW_HAS_IN_DEPS,
+  .flow_index         = 3,
+  .flow_datatype_mask = 0x0,
+  .dep_in     = { &flow_of_redistribute_no_optimization_Update_for_SW_dep1_atline_278_iftrue,
+ &flow_of_redistribute_no_optimization_Update_for_SW_dep1_atline_278_iffalse },
+  .dep_out    = { NULL }
+};
+
+static inline int expr_of_cond_for_flow_of_redistribute_no_optimization_Update_for_SE_dep1_atline_280_iftrue_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Update_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int mb_T_inner = locals->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = locals->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int m_Y_start = locals->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = locals->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = locals->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = locals->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+  const int TL_row = locals->TL_row.value; (void)TL_row;
+  const int TL_col = locals->TL_col.value; (void)TL_col;
+  const int BR_row = locals->BR_row.value; (void)BR_row;
+  const int BR_col = locals->BR_col.value; (void)BR_col;
+
+  (void)batch_col;
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)i_start;
+  (void)j_start;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)m_Y;
+  (void)n_Y;
+  (void)TL_row;
+  (void)TL_col;
+  (void)BR_row;
+  (void)BR_col;
+  (void)__parsec_tp; (void)locals;
+  return ((((m_Y) == (m_Y_end) && (n_Y) == (n_Y_end)) && (m_Y_start) != (m_Y_end)) && (n_Y_start) != (n_Y_end));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_redistribute_no_optimization_Update_for_SE_dep1_atline_280_iftrue = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_redistribute_no_optimization_Update_for_SE_dep1_atline_280_iftrue_fct }
+                   }
+};
+static const parsec_dep_t flow_of_redistribute_no_optimization_Update_for_SE_dep1_atline_280_iftrue = {
+  .cond = &expr_of_cond_for_flow_of_redistribute_no_optimization_Update_for_SE_dep1_atline_280_iftrue,  /* ((((m_Y) == (m_Y_end) && (n_Y) == (n_Y_end)) && (m_Y_start) != (m_Y_end)) && (n_Y_start) != (n_Y_end)) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 1, /* redistribute_no_optimization_Send */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_redistribute_no_optimization_Send_for_Y,
+  .dep_index = 4,
+  .dep_datatype_index = 4,
+  .belongs_to = &flow_of_redistribute_no_optimization_Update_for_SE,
+};
+static inline int expr_of_cond_for_flow_of_redistribute_no_optimization_Update_for_SE_dep1_atline_280_iffalse_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Update_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int mb_T_inner = locals->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = locals->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int m_Y_start = locals->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = locals->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = locals->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = locals->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+  const int TL_row = locals->TL_row.value; (void)TL_row;
+  const int TL_col = locals->TL_col.value; (void)TL_col;
+  const int BR_row = locals->BR_row.value; (void)BR_row;
+  const int BR_col = locals->BR_col.value; (void)BR_col;
+
+  (void)batch_col;
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)i_start;
+  (void)j_start;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)m_Y;
+  (void)n_Y;
+  (void)TL_row;
+  (void)TL_col;
+  (void)BR_row;
+  (void)BR_col;
+  (void)__parsec_tp; (void)locals;
+  return !(((((m_Y) == (m_Y_end) && (n_Y) == (n_Y_end)) && (m_Y_start) != (m_Y_end)) && (n_Y_start) != (n_Y_end)));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_redistribute_no_optimization_Update_for_SE_dep1_atline_280_iffalse = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_redistribute_no_optimization_Update_for_SE_dep1_atline_280_iffalse_fct }
+                   }
+};
+static const parsec_dep_t flow_of_redistribute_no_optimization_Update_for_SE_dep1_atline_280_iffalse = {
+  .cond = &expr_of_cond_for_flow_of_redistribute_no_optimization_Update_for_SE_dep1_atline_280_iffalse,  /* !((((m_Y) == (m_Y_end) && (n_Y) == (n_Y_end)) && (m_Y_start) != (m_Y_end)) && (n_Y_start) != (n_Y_end)) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = PARSEC_LOCAL_DATA_TASK_CLASS_ID, /* redistribute_no_optimization___parsec_null_type */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .dep_index = 4,
+  .dep_datatype_index = 4,
+  .belongs_to = &flow_of_redistribute_no_optimization_Update_for_SE,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_redistribute_no_optimization_Update_for_SE = {
+  .name               = "SE",
+  .sym_type           = PARSEC_SYM_IN,
+  .flow_flags         = PARSEC_FLOW_ACCESS_READ|PARSEC_FLOW_HAS_IN_DEPS,
+  .flow_index         = 4,
+  .flow_datatype_mask = 0x0,
+  .dep_in     = { &flow_of_redistribute_no_optimization_Update_for_SE_dep1_atline_280_iftrue,
+ &flow_of_redistribute_no_optimization_Update_for_SE_dep1_atline_280_iffalse },
+  .dep_out    = { NULL }
+};
+
+static inline int expr_of_cond_for_flow_of_redistribute_no_optimization_Update_for_N_dep1_atline_282_iftrue_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Update_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int mb_T_inner = locals->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = locals->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int m_Y_start = locals->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = locals->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = locals->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = locals->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+  const int TL_row = locals->TL_row.value; (void)TL_row;
+  const int TL_col = locals->TL_col.value; (void)TL_col;
+  const int BR_row = locals->BR_row.value; (void)BR_row;
+  const int BR_col = locals->BR_col.value; (void)BR_col;
+
+  (void)batch_col;
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)i_start;
+  (void)j_start;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)m_Y;
+  (void)n_Y;
+  (void)TL_row;
+  (void)TL_col;
+  (void)BR_row;
+  (void)BR_col;
+  (void)__parsec_tp; (void)locals;
+  return (((m_Y) == (m_Y_start) && (n_Y) > (n_Y_start)) && (n_Y) < (n_Y_end));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_redistribute_no_optimization_Update_for_N_dep1_atline_282_iftrue = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_redistribute_no_optimization_Update_for_N_dep1_atline_282_iftrue_fct }
+                   }
+};
+static const parsec_dep_t flow_of_redistribute_no_optimization_Update_for_N_dep1_atline_282_iftrue = {
+  .cond = &expr_of_cond_for_flow_of_redistribute_no_optimization_Update_for_N_dep1_atline_282_iftrue,  /* (((m_Y) == (m_Y_start) && (n_Y) > (n_Y_start)) && (n_Y) < (n_Y_end)) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 1, /* redistribute_no_optimization_Send */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_redistribute_no_optimization_Send_for_Y,
+  .dep_index = 5,
+  .dep_datatype_index = 5,
+  .belongs_to = &flow_of_redistribute_no_optimization_Update_for_N,
+};
+static inline int expr_of_cond_for_flow_of_redistribute_no_optimization_Update_for_N_dep1_atline_282_iffalse_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Update_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int mb_T_inner = locals->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = locals->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int m_Y_start = locals->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = locals->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = locals->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = locals->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+  const int TL_row = locals->TL_row.value; (void)TL_row;
+  const int TL_col = locals->TL_col.value; (void)TL_col;
+  const int BR_row = locals->BR_row.value; (void)BR_row;
+  const int BR_col = locals->BR_col.value; (void)BR_col;
+
+  (void)batch_col;
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)i_start;
+  (void)j_start;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)m_Y;
+  (void)n_Y;
+  (void)TL_row;
+  (void)TL_col;
+  (void)BR_row;
+  (void)BR_col;
+  (void)__parsec_tp; (void)locals;
+  return !((((m_Y) == (m_Y_start) && (n_Y) > (n_Y_start)) && (n_Y) < (n_Y_end)));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_redistribute_no_optimization_Update_for_N_dep1_atline_282_iffalse = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_redistribute_no_optimization_Update_for_N_dep1_atline_282_iffalse_fct }
+                   }
+};
+static const parsec_dep_t flow_of_redistribute_no_optimization_Update_for_N_dep1_atline_282_iffalse = {
+  .cond = &expr_of_cond_for_flow_of_redistribute_no_optimization_Update_for_N_dep1_atline_282_iffalse,  /* !(((m_Y) == (m_Y_start) && (n_Y) > (n_Y_start)) && (n_Y) < (n_Y_end)) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = PARSEC_LOCAL_DATA_TASK_CLASS_ID, /* redistribute_no_optimization___parsec_null_type */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .dep_index = 5,
+  .dep_datatype_index = 5,
+  .belongs_to = &flow_of_redistribute_no_optimization_Update_for_N,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_redistribute_no_optimization_Update_for_N = {
+  .name               = "N",
+  .sym_type           = PARSEC_SYM_IN,
+  .flow_flags         = PARSEC_FLOW_ACCESS_READ|PARSEC_FLOW_HAS_IN_DEPS,
+  .flow_index         = 5,
+  .flow_datatype_mask = 0x0,
+  .dep_in     = { &flow_of_redistribute_no_optimization_Update_for_N_dep1_atline_282_iftrue,
+ &flow_of_redistribute_no_optimization_Update_for_N_dep1_atline_282_iffalse },
+  .dep_out    = { NULL }
+};
+
+static inline int expr_of_cond_for_flow_of_redistribute_no_optimization_Update_for_S_dep1_atline_284_iftrue_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Update_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int mb_T_inner = locals->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = locals->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int m_Y_start = locals->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = locals->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = locals->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = locals->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+  const int TL_row = locals->TL_row.value; (void)TL_row;
+  const int TL_col = locals->TL_col.value; (void)TL_col;
+  const int BR_row = locals->BR_row.value; (void)BR_row;
+  const int BR_col = locals->BR_col.value; (void)BR_col;
+
+  (void)batch_col;
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)i_start;
+  (void)j_start;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)m_Y;
+  (void)n_Y;
+  (void)TL_row;
+  (void)TL_col;
+  (void)BR_row;
+  (void)BR_col;
+  (void)__parsec_tp; (void)locals;
+  return ((((m_Y) == (m_Y_end) && (m_Y_start) != (m_Y_end)) && (n_Y) > (n_Y_start)) && (n_Y) < (n_Y_end));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_redistribute_no_optimization_Update_for_S_dep1_atline_284_iftrue = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_redistribute_no_optimization_Update_for_S_dep1_atline_284_iftrue_fct }
+                   }
+};
+static const parsec_dep_t flow_of_redistribute_no_optimization_Update_for_S_dep1_atline_284_iftrue = {
+  .cond = &expr_of_cond_for_flow_of_redistribute_no_optimization_Update_for_S_dep1_atline_284_iftrue,  /* ((((m_Y) == (m_Y_end) && (m_Y_start) != (m_Y_end)) && (n_Y) > (n_Y_start)) && (n_Y) < (n_Y_end)) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 1, /* redistribute_no_optimization_Send */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_redistribute_no_optimization_Send_for_Y,
+  .dep_index = 6,
+  .dep_datatype_index = 6,
+  .belongs_to = &flow_of_redistribute_no_optimization_Update_for_S,
+};
+static inline int expr_of_cond_for_flow_of_redistribute_no_optimization_Update_for_S_dep1_atline_284_iffalse_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Update_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int mb_T_inner = locals->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = locals->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int m_Y_start = locals->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = locals->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = locals->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = locals->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+  const int TL_row = locals->TL_row.value; (void)TL_row;
+  const int TL_col = locals->TL_col.value; (void)TL_col;
+  const int BR_row = locals->BR_row.value; (void)BR_row;
+  const int BR_col = locals->BR_col.value; (void)BR_col;
+
+  (void)batch_col;
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)i_start;
+  (void)j_start;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)m_Y;
+  (void)n_Y;
+  (void)TL_row;
+  (void)TL_col;
+  (void)BR_row;
+  (void)BR_col;
+  (void)__parsec_tp; (void)locals;
+  return !(((((m_Y) == (m_Y_end) && (m_Y_start) != (m_Y_end)) && (n_Y) > (n_Y_start)) && (n_Y) < (n_Y_end)));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_redistribute_no_optimization_Update_for_S_dep1_atline_284_iffalse = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_redistribute_no_optimization_Update_for_S_dep1_atline_284_iffalse_fct }
+                   }
+};
+static const parsec_dep_t flow_of_redistribute_no_optimization_Update_for_S_dep1_atline_284_iffalse = {
+  .cond = &expr_of_cond_for_flow_of_redistribute_no_optimization_Update_for_S_dep1_atline_284_iffalse,  /* !((((m_Y) == (m_Y_end) && (m_Y_start) != (m_Y_end)) && (n_Y) > (n_Y_start)) && (n_Y) < (n_Y_end)) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = PARSEC_LOCAL_DATA_TASK_CLASS_ID, /* redistribute_no_optimization___parsec_null_type */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .dep_index = 6,
+  .dep_datatype_index = 6,
+  .belongs_to = &flow_of_redistribute_no_optimization_Update_for_S,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_redistribute_no_optimization_Update_for_S = {
+  .name               = "S",
+  .sym_type           = PARSEC_SYM_IN,
+  .flow_flags         = PARSEC_FLOW_ACCESS_READ|PARSEC_FLOW_HAS_IN_DEPS,
+  .flow_index         = 6,
+  .flow_datatype_mask = 0x0,
+  .dep_in     = { &flow_of_redistribute_no_optimization_Update_for_S_dep1_atline_284_iftrue,
+ &flow_of_redistribute_no_optimization_Update_for_S_dep1_atline_284_iffalse },
+  .dep_out    = { NULL }
+};
+
+static inline int expr_of_cond_for_flow_of_redistribute_no_optimization_Update_for_W_dep1_atline_286_iftrue_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Update_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int mb_T_inner = locals->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = locals->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int m_Y_start = locals->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = locals->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = locals->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = locals->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+  const int TL_row = locals->TL_row.value; (void)TL_row;
+  const int TL_col = locals->TL_col.value; (void)TL_col;
+  const int BR_row = locals->BR_row.value; (void)BR_row;
+  const int BR_col = locals->BR_col.value; (void)BR_col;
+
+  (void)batch_col;
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)i_start;
+  (void)j_start;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)m_Y;
+  (void)n_Y;
+  (void)TL_row;
+  (void)TL_col;
+  (void)BR_row;
+  (void)BR_col;
+  (void)__parsec_tp; (void)locals;
+  return (((n_Y) == (n_Y_start) && (m_Y) > (m_Y_start)) && (m_Y) < (m_Y_end));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_redistribute_no_optimization_Update_for_W_dep1_atline_286_iftrue = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_redistribute_no_optimization_Update_for_W_dep1_atline_286_iftrue_fct }
+                   }
+};
+static const parsec_dep_t flow_of_redistribute_no_optimization_Update_for_W_dep1_atline_286_iftrue = {
+  .cond = &expr_of_cond_for_flow_of_redistribute_no_optimization_Update_for_W_dep1_atline_286_iftrue,  /* (((n_Y) == (n_Y_start) && (m_Y) > (m_Y_start)) && (m_Y) < (m_Y_end)) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 1, /* redistribute_no_optimization_Send */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_redistribute_no_optimization_Send_for_Y,
+  .dep_index = 7,
+  .dep_datatype_index = 7,
+  .belongs_to = &flow_of_redistribute_no_optimization_Update_for_W,
+};
+static inline int expr_of_cond_for_flow_of_redistribute_no_optimization_Update_for_W_dep1_atline_286_iffalse_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Update_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int mb_T_inner = locals->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = locals->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int m_Y_start = locals->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = locals->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = locals->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = locals->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+  const int TL_row = locals->TL_row.value; (void)TL_row;
+  const int TL_col = locals->TL_col.value; (void)TL_col;
+  const int BR_row = locals->BR_row.value; (void)BR_row;
+  const int BR_col = locals->BR_col.value; (void)BR_col;
+
+  (void)batch_col;
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)i_start;
+  (void)j_start;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)m_Y;
+  (void)n_Y;
+  (void)TL_row;
+  (void)TL_col;
+  (void)BR_row;
+  (void)BR_col;
+  (void)__parsec_tp; (void)locals;
+  return !((((n_Y) == (n_Y_start) && (m_Y) > (m_Y_start)) && (m_Y) < (m_Y_end)));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_redistribute_no_optimization_Update_for_W_dep1_atline_286_iffalse = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_redistribute_no_optimization_Update_for_W_dep1_atline_286_iffalse_fct }
+                   }
+};
+static const parsec_dep_t flow_of_redistribute_no_optimization_Update_for_W_dep1_atline_286_iffalse = {
+  .cond = &expr_of_cond_for_flow_of_redistribute_no_optimization_Update_for_W_dep1_atline_286_iffalse,  /* !(((n_Y) == (n_Y_start) && (m_Y) > (m_Y_start)) && (m_Y) < (m_Y_end)) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = PARSEC_LOCAL_DATA_TASK_CLASS_ID, /* redistribute_no_optimization___parsec_null_type */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .dep_index = 7,
+  .dep_datatype_index = 7,
+  .belongs_to = &flow_of_redistribute_no_optimization_Update_for_W,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_redistribute_no_optimization_Update_for_W = {
+  .name               = "W",
+  .sym_type           = PARSEC_SYM_IN,
+  .flow_flags         = PARSEC_FLOW_ACCESS_READ|PARSEC_FLOW_HAS_IN_DEPS,
+  .flow_index         = 7,
+  .flow_datatype_mask = 0x0,
+  .dep_in     = { &flow_of_redistribute_no_optimization_Update_for_W_dep1_atline_286_iftrue,
+ &flow_of_redistribute_no_optimization_Update_for_W_dep1_atline_286_iffalse },
+  .dep_out    = { NULL }
+};
+
+static inline int expr_of_cond_for_flow_of_redistribute_no_optimization_Update_for_E_dep1_atline_288_iftrue_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Update_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int mb_T_inner = locals->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = locals->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int m_Y_start = locals->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = locals->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = locals->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = locals->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+  const int TL_row = locals->TL_row.value; (void)TL_row;
+  const int TL_col = locals->TL_col.value; (void)TL_col;
+  const int BR_row = locals->BR_row.value; (void)BR_row;
+  const int BR_col = locals->BR_col.value; (void)BR_col;
+
+  (void)batch_col;
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)i_start;
+  (void)j_start;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)m_Y;
+  (void)n_Y;
+  (void)TL_row;
+  (void)TL_col;
+  (void)BR_row;
+  (void)BR_col;
+  (void)__parsec_tp; (void)locals;
+  return ((((n_Y) == (n_Y_end) && (n_Y_start) != (n_Y_end)) && (m_Y) > (m_Y_start)) && (m_Y) < (m_Y_end));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_redistribute_no_optimization_Update_for_E_dep1_atline_288_iftrue = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_redistribute_no_optimization_Update_for_E_dep1_atline_288_iftrue_fct }
+                   }
+};
+static const parsec_dep_t flow_of_redistribute_no_optimization_Update_for_E_dep1_atline_288_iftrue = {
+  .cond = &expr_of_cond_for_flow_of_redistribute_no_optimization_Update_for_E_dep1_atline_288_iftrue,  /* ((((n_Y) == (n_Y_end) && (n_Y_start) != (n_Y_end)) && (m_Y) > (m_Y_start)) && (m_Y) < (m_Y_end)) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 1, /* redistribute_no_optimization_Send */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_redistribute_no_optimization_Send_for_Y,
+  .dep_index = 8,
+  .dep_datatype_index = 8,
+  .belongs_to = &flow_of_redistribute_no_optimization_Update_for_E,
+};
+static inline int expr_of_cond_for_flow_of_redistribute_no_optimization_Update_for_E_dep1_atline_288_iffalse_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Update_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int mb_T_inner = locals->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = locals->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int m_Y_start = locals->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = locals->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = locals->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = locals->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+  const int TL_row = locals->TL_row.value; (void)TL_row;
+  const int TL_col = locals->TL_col.value; (void)TL_col;
+  const int BR_row = locals->BR_row.value; (void)BR_row;
+  const int BR_col = locals->BR_col.value; (void)BR_col;
+
+  (void)batch_col;
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)i_start;
+  (void)j_start;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)m_Y;
+  (void)n_Y;
+  (void)TL_row;
+  (void)TL_col;
+  (void)BR_row;
+  (void)BR_col;
+  (void)__parsec_tp; (void)locals;
+  return !(((((n_Y) == (n_Y_end) && (n_Y_start) != (n_Y_end)) && (m_Y) > (m_Y_start)) && (m_Y) < (m_Y_end)));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_redistribute_no_optimization_Update_for_E_dep1_atline_288_iffalse = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_redistribute_no_optimization_Update_for_E_dep1_atline_288_iffalse_fct }
+                   }
+};
+static const parsec_dep_t flow_of_redistribute_no_optimization_Update_for_E_dep1_atline_288_iffalse = {
+  .cond = &expr_of_cond_for_flow_of_redistribute_no_optimization_Update_for_E_dep1_atline_288_iffalse,  /* !((((n_Y) == (n_Y_end) && (n_Y_start) != (n_Y_end)) && (m_Y) > (m_Y_start)) && (m_Y) < (m_Y_end)) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = PARSEC_LOCAL_DATA_TASK_CLASS_ID, /* redistribute_no_optimization___parsec_null_type */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .dep_index = 8,
+  .dep_datatype_index = 8,
+  .belongs_to = &flow_of_redistribute_no_optimization_Update_for_E,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_redistribute_no_optimization_Update_for_E = {
+  .name               = "E",
+  .sym_type           = PARSEC_SYM_IN,
+  .flow_flags         = PARSEC_FLOW_ACCESS_READ|PARSEC_FLOW_HAS_IN_DEPS,
+  .flow_index         = 8,
+  .flow_datatype_mask = 0x0,
+  .dep_in     = { &flow_of_redistribute_no_optimization_Update_for_E_dep1_atline_288_iftrue,
+ &flow_of_redistribute_no_optimization_Update_for_E_dep1_atline_288_iffalse },
+  .dep_out    = { NULL }
+};
+
+static inline int expr_of_cond_for_flow_of_redistribute_no_optimization_Update_for_I_dep1_atline_290_iftrue_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Update_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int mb_T_inner = locals->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = locals->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int m_Y_start = locals->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = locals->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = locals->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = locals->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+  const int TL_row = locals->TL_row.value; (void)TL_row;
+  const int TL_col = locals->TL_col.value; (void)TL_col;
+  const int BR_row = locals->BR_row.value; (void)BR_row;
+  const int BR_col = locals->BR_col.value; (void)BR_col;
+
+  (void)batch_col;
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)i_start;
+  (void)j_start;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)m_Y;
+  (void)n_Y;
+  (void)TL_row;
+  (void)TL_col;
+  (void)BR_row;
+  (void)BR_col;
+  (void)__parsec_tp; (void)locals;
+  return ((((m_Y) > (m_Y_start) && (m_Y) < (m_Y_end)) && (n_Y) > (n_Y_start)) && (n_Y) < (n_Y_end));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_redistribute_no_optimization_Update_for_I_dep1_atline_290_iftrue = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_redistribute_no_optimization_Update_for_I_dep1_atline_290_iftrue_fct }
+                   }
+};
+static const parsec_dep_t flow_of_redistribute_no_optimization_Update_for_I_dep1_atline_290_iftrue = {
+  .cond = &expr_of_cond_for_flow_of_redistribute_no_optimization_Update_for_I_dep1_atline_290_iftrue,  /* ((((m_Y) > (m_Y_start) && (m_Y) < (m_Y_end)) && (n_Y) > (n_Y_start)) && (n_Y) < (n_Y_end)) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 1, /* redistribute_no_optimization_Send */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_redistribute_no_optimization_Send_for_Y,
+  .dep_index = 9,
+  .dep_datatype_index = 9,
+  .belongs_to = &flow_of_redistribute_no_optimization_Update_for_I,
+};
+static inline int expr_of_cond_for_flow_of_redistribute_no_optimization_Update_for_I_dep1_atline_290_iffalse_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Update_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int mb_T_inner = locals->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = locals->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int m_Y_start = locals->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = locals->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = locals->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = locals->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+  const int TL_row = locals->TL_row.value; (void)TL_row;
+  const int TL_col = locals->TL_col.value; (void)TL_col;
+  const int BR_row = locals->BR_row.value; (void)BR_row;
+  const int BR_col = locals->BR_col.value; (void)BR_col;
+
+  (void)batch_col;
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)i_start;
+  (void)j_start;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)m_Y;
+  (void)n_Y;
+  (void)TL_row;
+  (void)TL_col;
+  (void)BR_row;
+  (void)BR_col;
+  (void)__parsec_tp; (void)locals;
+  return !(((((m_Y) > (m_Y_start) && (m_Y) < (m_Y_end)) && (n_Y) > (n_Y_start)) && (n_Y) < (n_Y_end)));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_redistribute_no_optimization_Update_for_I_dep1_atline_290_iffalse = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_redistribute_no_optimization_Update_for_I_dep1_atline_290_iffalse_fct }
+                   }
+};
+static const parsec_dep_t flow_of_redistribute_no_optimization_Update_for_I_dep1_atline_290_iffalse = {
+  .cond = &expr_of_cond_for_flow_of_redistribute_no_optimization_Update_for_I_dep1_atline_290_iffalse,  /* !((((m_Y) > (m_Y_start) && (m_Y) < (m_Y_end)) && (n_Y) > (n_Y_start)) && (n_Y) < (n_Y_end)) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = PARSEC_LOCAL_DATA_TASK_CLASS_ID, /* redistribute_no_optimization___parsec_null_type */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .dep_index = 9,
+  .dep_datatype_index = 9,
+  .belongs_to = &flow_of_redistribute_no_optimization_Update_for_I,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_redistribute_no_optimization_Update_for_I = {
+  .name               = "I",
+  .sym_type           = PARSEC_SYM_IN,
+  .flow_flags         = PARSEC_FLOW_ACCESS_READ|PARSEC_FLOW_HAS_IN_DEPS,
+  .flow_index         = 9,
+  .flow_datatype_mask = 0x0,
+  .dep_in     = { &flow_of_redistribute_no_optimization_Update_for_I_dep1_atline_290_iftrue,
+ &flow_of_redistribute_no_optimization_Update_for_I_dep1_atline_290_iffalse },
+  .dep_out    = { NULL }
+};
+
+static const parsec_dep_t flow_of_redistribute_no_optimization_Update_for_ctl_dep1_atline_292 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 3, /* redistribute_no_optimization_Receive */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_redistribute_no_optimization_Receive_for_ctl1,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_redistribute_no_optimization_Update_for_ctl,
+};
+#if MAX_DEP_OUT_COUNT < 1  /* number of output dependencies */
+    #error Too many output dependencies (supports up to MAX_DEP_OUT_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_OUT_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_redistribute_no_optimization_Update_for_ctl = {
+  .name               = "ctl",
+  .sym_type           = PARSEC_SYM_OUT,
+  .flow_flags         = PARSEC_FLOW_ACCESS_NONE,
+  .flow_index         = 10,
+  .flow_datatype_mask = 0x1,
+  .dep_in     = { NULL },
+  .dep_out    = { &flow_of_redistribute_no_optimization_Update_for_ctl_dep1_atline_292 }
+};
+
+static void
+iterate_successors_of_redistribute_no_optimization_Update(parsec_execution_stream_t *es, const __parsec_redistribute_no_optimization_Update_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp = (const __parsec_redistribute_no_optimization_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_redistribute_no_optimization_Update_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_redistribute_no_optimization_Update_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int batch_col = __jdf2c__tmp_locals.batch_col.value; (void)batch_col;
+  const int m_T = __jdf2c__tmp_locals.m_T.value; (void)m_T;
+  const int n_T = __jdf2c__tmp_locals.n_T.value; (void)n_T;
+  const int mb_T_inner = __jdf2c__tmp_locals.mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = __jdf2c__tmp_locals.nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = __jdf2c__tmp_locals.i_start.value; (void)i_start;
+  const int j_start = __jdf2c__tmp_locals.j_start.value; (void)j_start;
+  const int m_Y_start = __jdf2c__tmp_locals.m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = __jdf2c__tmp_locals.n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = __jdf2c__tmp_locals.m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = __jdf2c__tmp_locals.n_Y_end.value; (void)n_Y_end;
+  const int m_Y = __jdf2c__tmp_locals.m_Y.value; (void)m_Y;
+  const int n_Y = __jdf2c__tmp_locals.n_Y.value; (void)n_Y;
+  const int TL_row = __jdf2c__tmp_locals.TL_row.value; (void)TL_row;
+  const int TL_col = __jdf2c__tmp_locals.TL_col.value; (void)TL_col;
+  const int BR_row = __jdf2c__tmp_locals.BR_row.value; (void)BR_row;
+  const int BR_col = __jdf2c__tmp_locals.BR_col.value; (void)BR_col;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)batch_col;  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)i_start;  (void)j_start;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;  (void)m_Y;  (void)n_Y;  (void)TL_row;  (void)TL_col;  (void)BR_row;  (void)BR_col;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_descT(m_T, n_T);
+#endif
+  /* Flow of data T has only IN dependencies */
+  /* Flow of data NW has only IN dependencies */
+  /* Flow of data NE has only IN dependencies */
+  /* Flow of data SW has only IN dependencies */
+  /* Flow of data SE has only IN dependencies */
+  /* Flow of data N has only IN dependencies */
+  /* Flow of data S has only IN dependencies */
+  /* Flow of data W has only IN dependencies */
+  /* Flow of data E has only IN dependencies */
+  /* Flow of data I has only IN dependencies */
+  if( action_mask & 0x1 ) {  /* Flow of data ctl [10] */
+    data.data   = this_task->data._f_ctl.data_out;
+    data.data_future  = NULL;
+    if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  =   /* Control: always empty */ 0;
+    data.local.dst_count  =   /* Control: always empty */ 0;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = NULL;
+    data.remote.src_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.src_count  =   /* Control: always empty */ 0;
+    data.remote.dst_count  =   /* Control: always empty */ 0;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+       __parsec_redistribute_no_optimization_Receive_task_t* ncc = (__parsec_redistribute_no_optimization_Receive_task_t*)&nc;
+    nc.task_class = __parsec_tp->super.super.task_classes_array[redistribute_no_optimization_Receive.task_class_id];
+      const int Receive_batch_col = batch_col;
+      if( (Receive_batch_col >= (0)) && (Receive_batch_col <= (NT)) ) {
+        assert(&nc.locals[0].value == &ncc->locals.batch_col.value);
+        ncc->locals.batch_col.value = Receive_batch_col;
+        const int Receive_m_T = m_T;
+        if( (Receive_m_T >= (m_T_START)) && (Receive_m_T <= (m_T_END)) ) {
+          assert(&nc.locals[1].value == &ncc->locals.m_T.value);
+          ncc->locals.m_T.value = Receive_m_T;
+          const int Receive_n_T = n_T;
+          if( (Receive_n_T >= (redistribute_no_optimization_Receive_inline_c_expr11_line_315(__parsec_tp, &ncc->locals))) && (Receive_n_T <= (redistribute_no_optimization_Receive_inline_c_expr10_line_315(__parsec_tp, &ncc->locals))) ) {
+            assert(&nc.locals[2].value == &ncc->locals.n_T.value);
+            ncc->locals.n_T.value = Receive_n_T;
+            const int Receive_mb_T_inner = redistribute_no_optimization_Receive_inline_c_expr9_line_317(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[3].value == &ncc->locals.mb_T_inner.value);
+            ncc->locals.mb_T_inner.value = Receive_mb_T_inner;
+            const int Receive_nb_T_inner = redistribute_no_optimization_Receive_inline_c_expr8_line_318(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[4].value == &ncc->locals.nb_T_inner.value);
+            ncc->locals.nb_T_inner.value = Receive_nb_T_inner;
+            const int Receive_nb_T_inner_next = redistribute_no_optimization_Receive_inline_c_expr7_line_320(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[5].value == &ncc->locals.nb_T_inner_next.value);
+            ncc->locals.nb_T_inner_next.value = Receive_nb_T_inner_next;
+            const int Receive_sizei_T = (((ncc->locals.m_T.value - m_T_START) * mb_T_INNER) - (disi_T % mb_T_INNER));
+            assert(&nc.locals[6].value == &ncc->locals.sizei_T.value);
+            ncc->locals.sizei_T.value = Receive_sizei_T;
+            const int Receive_sizej_T = (((ncc->locals.n_T.value - n_T_START) * nb_T_INNER) - (disj_T % nb_T_INNER));
+            assert(&nc.locals[7].value == &ncc->locals.sizej_T.value);
+            ncc->locals.sizej_T.value = Receive_sizej_T;
+            const int Receive_i_start = redistribute_no_optimization_Receive_inline_c_expr6_line_325(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[8].value == &ncc->locals.i_start.value);
+            ncc->locals.i_start.value = Receive_i_start;
+            const int Receive_j_start = redistribute_no_optimization_Receive_inline_c_expr5_line_326(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[9].value == &ncc->locals.j_start.value);
+            ncc->locals.j_start.value = Receive_j_start;
+            const int Receive_m_Y_start = redistribute_no_optimization_Receive_inline_c_expr4_line_328(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[10].value == &ncc->locals.m_Y_start.value);
+            ncc->locals.m_Y_start.value = Receive_m_Y_start;
+            const int Receive_n_Y_start = redistribute_no_optimization_Receive_inline_c_expr3_line_329(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[11].value == &ncc->locals.n_Y_start.value);
+            ncc->locals.n_Y_start.value = Receive_n_Y_start;
+            const int Receive_m_Y_end = redistribute_no_optimization_Receive_inline_c_expr2_line_330(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[12].value == &ncc->locals.m_Y_end.value);
+            ncc->locals.m_Y_end.value = Receive_m_Y_end;
+            const int Receive_n_Y_end = redistribute_no_optimization_Receive_inline_c_expr1_line_331(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[13].value == &ncc->locals.n_Y_end.value);
+            ncc->locals.n_Y_end.value = Receive_n_Y_end;
+            const int Receive_n_Y_start_next = ((((((ncc->locals.n_T.value - n_T_START) + num_col) * nb_T_INNER) - (disj_T % nb_T_INNER)) + disj_Y) / nb_Y_INNER);
+            assert(&nc.locals[14].value == &ncc->locals.n_Y_start_next.value);
+            ncc->locals.n_Y_start_next.value = Receive_n_Y_start_next;
+            const int Receive_n_Y_end_next = ((((((((ncc->locals.n_T.value - n_T_START) + num_col) * nb_T_INNER) - (disj_T % nb_T_INNER)) + disj_Y) + ncc->locals.nb_T_inner_next.value) - 1) / nb_Y_INNER);
+            assert(&nc.locals[15].value == &ncc->locals.n_Y_end_next.value);
+            ncc->locals.n_Y_end_next.value = Receive_n_Y_end_next;
+#if defined(DISTRIBUTED)
+            rank_dst = rank_of_descT(ncc->locals.m_T.value, ncc->locals.n_T.value);
+            if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+              vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descT)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descT, ncc->locals.m_T.value, ncc->locals.n_T.value);
+            nc.priority = __parsec_tp->super.super.priority;
+            successor_repo = Receive_repo;
+            successor_repo_key = __jdf2c_make_key_Receive((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+          RELEASE_DEP_OUTPUT(es, "ctl", this_task, "ctl1", &nc, rank_src, rank_dst, &data);
+          if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_redistribute_no_optimization_Update_for_ctl_dep1_atline_292, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+            }
+          }
+        }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static void
+iterate_predecessors_of_redistribute_no_optimization_Update(parsec_execution_stream_t *es, const __parsec_redistribute_no_optimization_Update_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp = (const __parsec_redistribute_no_optimization_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_redistribute_no_optimization_Update_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_redistribute_no_optimization_Update_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int batch_col = __jdf2c__tmp_locals.batch_col.value; (void)batch_col;
+  const int m_T = __jdf2c__tmp_locals.m_T.value; (void)m_T;
+  const int n_T = __jdf2c__tmp_locals.n_T.value; (void)n_T;
+  const int mb_T_inner = __jdf2c__tmp_locals.mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = __jdf2c__tmp_locals.nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = __jdf2c__tmp_locals.i_start.value; (void)i_start;
+  const int j_start = __jdf2c__tmp_locals.j_start.value; (void)j_start;
+  const int m_Y_start = __jdf2c__tmp_locals.m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = __jdf2c__tmp_locals.n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = __jdf2c__tmp_locals.m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = __jdf2c__tmp_locals.n_Y_end.value; (void)n_Y_end;
+  const int m_Y = __jdf2c__tmp_locals.m_Y.value; (void)m_Y;
+  const int n_Y = __jdf2c__tmp_locals.n_Y.value; (void)n_Y;
+  const int TL_row = __jdf2c__tmp_locals.TL_row.value; (void)TL_row;
+  const int TL_col = __jdf2c__tmp_locals.TL_col.value; (void)TL_col;
+  const int BR_row = __jdf2c__tmp_locals.BR_row.value; (void)BR_row;
+  const int BR_col = __jdf2c__tmp_locals.BR_col.value; (void)BR_col;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)batch_col;  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)i_start;  (void)j_start;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;  (void)m_Y;  (void)n_Y;  (void)TL_row;  (void)TL_col;  (void)BR_row;  (void)BR_col;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_descT(m_T, n_T);
+#endif
+  if( action_mask & 0x1 ) {  /* Flow of data T [0] */
+    data.data   = this_task->data._f_T.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x1 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_redistribute_no_optimization_TARGET_ADT->arena;
+    data.local.src_datatype = PARSEC_redistribute_no_optimization_TARGET_ADT->opaque_dtt;
+    data.local.dst_datatype = PARSEC_redistribute_no_optimization_TARGET_ADT->opaque_dtt;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_redistribute_no_optimization_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        __parsec_redistribute_no_optimization_Init_task_t* ncc = (__parsec_redistribute_no_optimization_Init_task_t*)&nc;
+    nc.task_class = __parsec_tp->super.super.task_classes_array[redistribute_no_optimization_Init.task_class_id];
+      const int Init_batch_col = batch_col;
+      if( (Init_batch_col >= (0)) && (Init_batch_col <= (NT)) ) {
+        assert(&nc.locals[0].value == &ncc->locals.batch_col.value);
+        ncc->locals.batch_col.value = Init_batch_col;
+        const int Init_m_T = m_T;
+        if( (Init_m_T >= (m_T_START)) && (Init_m_T <= (m_T_END)) ) {
+          assert(&nc.locals[1].value == &ncc->locals.m_T.value);
+          ncc->locals.m_T.value = Init_m_T;
+          const int Init_n_T = n_T;
+          if( (Init_n_T >= (redistribute_no_optimization_Init_inline_c_expr41_line_166(__parsec_tp, &ncc->locals))) && (Init_n_T <= (redistribute_no_optimization_Init_inline_c_expr40_line_166(__parsec_tp, &ncc->locals))) ) {
+            assert(&nc.locals[2].value == &ncc->locals.n_T.value);
+            ncc->locals.n_T.value = Init_n_T;
+            const int Init_mb_T_inner = redistribute_no_optimization_Init_inline_c_expr39_line_168(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[3].value == &ncc->locals.mb_T_inner.value);
+            ncc->locals.mb_T_inner.value = Init_mb_T_inner;
+            const int Init_nb_T_inner = redistribute_no_optimization_Init_inline_c_expr38_line_169(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[4].value == &ncc->locals.nb_T_inner.value);
+            ncc->locals.nb_T_inner.value = Init_nb_T_inner;
+            const int Init_sizei_T = (((ncc->locals.m_T.value - m_T_START) * mb_T_INNER) - (disi_T % mb_T_INNER));
+            assert(&nc.locals[5].value == &ncc->locals.sizei_T.value);
+            ncc->locals.sizei_T.value = Init_sizei_T;
+            const int Init_sizej_T = (((ncc->locals.n_T.value - n_T_START) * nb_T_INNER) - (disj_T % nb_T_INNER));
+            assert(&nc.locals[6].value == &ncc->locals.sizej_T.value);
+            ncc->locals.sizej_T.value = Init_sizej_T;
+            const int Init_m_Y_start = redistribute_no_optimization_Init_inline_c_expr37_line_174(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[7].value == &ncc->locals.m_Y_start.value);
+            ncc->locals.m_Y_start.value = Init_m_Y_start;
+            const int Init_n_Y_start = redistribute_no_optimization_Init_inline_c_expr36_line_175(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[8].value == &ncc->locals.n_Y_start.value);
+            ncc->locals.n_Y_start.value = Init_n_Y_start;
+            const int Init_m_Y_end = redistribute_no_optimization_Init_inline_c_expr35_line_176(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[9].value == &ncc->locals.m_Y_end.value);
+            ncc->locals.m_Y_end.value = Init_m_Y_end;
+            const int Init_n_Y_end = redistribute_no_optimization_Init_inline_c_expr34_line_177(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[10].value == &ncc->locals.n_Y_end.value);
+            ncc->locals.n_Y_end.value = Init_n_Y_end;
+#if defined(DISTRIBUTED)
+            rank_dst = rank_of_descT(ncc->locals.m_T.value, ncc->locals.n_T.value);
+            if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+              vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descT)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descT, ncc->locals.m_T.value, ncc->locals.n_T.value);
+            nc.priority = __parsec_tp->super.super.priority;
+            successor_repo = NULL;
+            successor_repo_key = 0;
+          RELEASE_DEP_OUTPUT(es, "T", this_task, "T", &nc, rank_src, rank_dst, &data);
+          if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_redistribute_no_optimization_Update_for_T_dep1_atline_272, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+            }
+          }
+        }
+  }
+  }
+  if( action_mask & 0x2 ) {  /* Flow of data NW [1] */
+    data.data   = this_task->data._f_NW.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x2 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_redistribute_no_optimization_SOURCE_ADT->arena;
+    data.local.src_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.dst_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_redistribute_no_optimization_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( ((m_Y) == (m_Y_start) && (n_Y) == (n_Y_start)) ) {
+      __parsec_redistribute_no_optimization_Send_task_t* ncc = (__parsec_redistribute_no_optimization_Send_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[redistribute_no_optimization_Send.task_class_id];
+        const int Send_batch_col = batch_col;
+        if( (Send_batch_col >= (0)) && (Send_batch_col <= (NT)) ) {
+          assert(&nc.locals[0].value == &ncc->locals.batch_col.value);
+          ncc->locals.batch_col.value = Send_batch_col;
+          const int Send_m_T = m_T;
+          if( (Send_m_T >= (m_T_START)) && (Send_m_T <= (m_T_END)) ) {
+            assert(&nc.locals[1].value == &ncc->locals.m_T.value);
+            ncc->locals.m_T.value = Send_m_T;
+            const int Send_n_T = n_T;
+            if( (Send_n_T >= (redistribute_no_optimization_Send_inline_c_expr33_line_202(__parsec_tp, &ncc->locals))) && (Send_n_T <= (redistribute_no_optimization_Send_inline_c_expr32_line_202(__parsec_tp, &ncc->locals))) ) {
+              assert(&nc.locals[2].value == &ncc->locals.n_T.value);
+              ncc->locals.n_T.value = Send_n_T;
+              const int Send_mb_T_inner = redistribute_no_optimization_Send_inline_c_expr31_line_204(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[3].value == &ncc->locals.mb_T_inner.value);
+              ncc->locals.mb_T_inner.value = Send_mb_T_inner;
+              const int Send_nb_T_inner = redistribute_no_optimization_Send_inline_c_expr30_line_205(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[4].value == &ncc->locals.nb_T_inner.value);
+              ncc->locals.nb_T_inner.value = Send_nb_T_inner;
+              const int Send_i_start = redistribute_no_optimization_Send_inline_c_expr29_line_207(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[5].value == &ncc->locals.i_start.value);
+              ncc->locals.i_start.value = Send_i_start;
+              const int Send_j_start = redistribute_no_optimization_Send_inline_c_expr28_line_208(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[6].value == &ncc->locals.j_start.value);
+              ncc->locals.j_start.value = Send_j_start;
+              const int Send_m_Y_start = redistribute_no_optimization_Send_inline_c_expr27_line_210(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[7].value == &ncc->locals.m_Y_start.value);
+              ncc->locals.m_Y_start.value = Send_m_Y_start;
+              const int Send_n_Y_start = redistribute_no_optimization_Send_inline_c_expr26_line_211(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[8].value == &ncc->locals.n_Y_start.value);
+              ncc->locals.n_Y_start.value = Send_n_Y_start;
+              const int Send_m_Y_end = redistribute_no_optimization_Send_inline_c_expr25_line_212(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[9].value == &ncc->locals.m_Y_end.value);
+              ncc->locals.m_Y_end.value = Send_m_Y_end;
+              const int Send_n_Y_end = redistribute_no_optimization_Send_inline_c_expr24_line_213(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[10].value == &ncc->locals.n_Y_end.value);
+              ncc->locals.n_Y_end.value = Send_n_Y_end;
+              const int Send_m_Y = m_Y;
+              if( (Send_m_Y >= (ncc->locals.m_Y_start.value)) && (Send_m_Y <= (ncc->locals.m_Y_end.value)) ) {
+                assert(&nc.locals[11].value == &ncc->locals.m_Y.value);
+                ncc->locals.m_Y.value = Send_m_Y;
+                const int Send_n_Y = n_Y;
+                if( (Send_n_Y >= (ncc->locals.n_Y_start.value)) && (Send_n_Y <= (ncc->locals.n_Y_end.value)) ) {
+                  assert(&nc.locals[12].value == &ncc->locals.n_Y.value);
+                  ncc->locals.n_Y.value = Send_n_Y;
+#if defined(DISTRIBUTED)
+                  rank_dst = rank_of_descY(ncc->locals.m_Y.value, ncc->locals.n_Y.value);
+                  if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+                    vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descY)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descY, ncc->locals.m_Y.value, ncc->locals.n_Y.value);
+                  nc.priority = __parsec_tp->super.super.priority;
+                  successor_repo = Send_repo;
+                  successor_repo_key = __jdf2c_make_key_Send((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+                RELEASE_DEP_OUTPUT(es, "NW", this_task, "Y", &nc, rank_src, rank_dst, &data);
+                if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_redistribute_no_optimization_Update_for_NW_dep1_atline_274_iftrue, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+                  }
+                }
+              }
+            }
+          }
+    }
+  }
+  }
+  if( action_mask & 0x4 ) {  /* Flow of data NE [2] */
+    data.data   = this_task->data._f_NE.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x4 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_redistribute_no_optimization_SOURCE_ADT->arena;
+    data.local.src_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.dst_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_redistribute_no_optimization_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( (((m_Y) == (m_Y_start) && (n_Y) == (n_Y_end)) && (n_Y_start) != (n_Y_end)) ) {
+      __parsec_redistribute_no_optimization_Send_task_t* ncc = (__parsec_redistribute_no_optimization_Send_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[redistribute_no_optimization_Send.task_class_id];
+        const int Send_batch_col = batch_col;
+        if( (Send_batch_col >= (0)) && (Send_batch_col <= (NT)) ) {
+          assert(&nc.locals[0].value == &ncc->locals.batch_col.value);
+          ncc->locals.batch_col.value = Send_batch_col;
+          const int Send_m_T = m_T;
+          if( (Send_m_T >= (m_T_START)) && (Send_m_T <= (m_T_END)) ) {
+            assert(&nc.locals[1].value == &ncc->locals.m_T.value);
+            ncc->locals.m_T.value = Send_m_T;
+            const int Send_n_T = n_T;
+            if( (Send_n_T >= (redistribute_no_optimization_Send_inline_c_expr33_line_202(__parsec_tp, &ncc->locals))) && (Send_n_T <= (redistribute_no_optimization_Send_inline_c_expr32_line_202(__parsec_tp, &ncc->locals))) ) {
+              assert(&nc.locals[2].value == &ncc->locals.n_T.value);
+              ncc->locals.n_T.value = Send_n_T;
+              const int Send_mb_T_inner = redistribute_no_optimization_Send_inline_c_expr31_line_204(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[3].value == &ncc->locals.mb_T_inner.value);
+              ncc->locals.mb_T_inner.value = Send_mb_T_inner;
+              const int Send_nb_T_inner = redistribute_no_optimization_Send_inline_c_expr30_line_205(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[4].value == &ncc->locals.nb_T_inner.value);
+              ncc->locals.nb_T_inner.value = Send_nb_T_inner;
+              const int Send_i_start = redistribute_no_optimization_Send_inline_c_expr29_line_207(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[5].value == &ncc->locals.i_start.value);
+              ncc->locals.i_start.value = Send_i_start;
+              const int Send_j_start = redistribute_no_optimization_Send_inline_c_expr28_line_208(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[6].value == &ncc->locals.j_start.value);
+              ncc->locals.j_start.value = Send_j_start;
+              const int Send_m_Y_start = redistribute_no_optimization_Send_inline_c_expr27_line_210(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[7].value == &ncc->locals.m_Y_start.value);
+              ncc->locals.m_Y_start.value = Send_m_Y_start;
+              const int Send_n_Y_start = redistribute_no_optimization_Send_inline_c_expr26_line_211(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[8].value == &ncc->locals.n_Y_start.value);
+              ncc->locals.n_Y_start.value = Send_n_Y_start;
+              const int Send_m_Y_end = redistribute_no_optimization_Send_inline_c_expr25_line_212(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[9].value == &ncc->locals.m_Y_end.value);
+              ncc->locals.m_Y_end.value = Send_m_Y_end;
+              const int Send_n_Y_end = redistribute_no_optimization_Send_inline_c_expr24_line_213(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[10].value == &ncc->locals.n_Y_end.value);
+              ncc->locals.n_Y_end.value = Send_n_Y_end;
+              const int Send_m_Y = m_Y;
+              if( (Send_m_Y >= (ncc->locals.m_Y_start.value)) && (Send_m_Y <= (ncc->locals.m_Y_end.value)) ) {
+                assert(&nc.locals[11].value == &ncc->locals.m_Y.value);
+                ncc->locals.m_Y.value = Send_m_Y;
+                const int Send_n_Y = n_Y;
+                if( (Send_n_Y >= (ncc->locals.n_Y_start.value)) && (Send_n_Y <= (ncc->locals.n_Y_end.value)) ) {
+                  assert(&nc.locals[12].value == &ncc->locals.n_Y.value);
+                  ncc->locals.n_Y.value = Send_n_Y;
+#if defined(DISTRIBUTED)
+                  rank_dst = rank_of_descY(ncc->locals.m_Y.value, ncc->locals.n_Y.value);
+                  if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+                    vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descY)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descY, ncc->locals.m_Y.value, ncc->locals.n_Y.value);
+                  nc.priority = __parsec_tp->super.super.priority;
+                  successor_repo = Send_repo;
+                  successor_repo_key = __jdf2c_make_key_Send((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+                RELEASE_DEP_OUTPUT(es, "NE", this_task, "Y", &nc, rank_src, rank_dst, &data);
+                if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_redistribute_no_optimization_Update_for_NE_dep1_atline_276_iftrue, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+                  }
+                }
+              }
+            }
+          }
+    }
+  }
+  }
+  if( action_mask & 0x8 ) {  /* Flow of data SW [3] */
+    data.data   = this_task->data._f_SW.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x8 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_redistribute_no_optimization_SOURCE_ADT->arena;
+    data.local.src_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.dst_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_redistribute_no_optimization_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( (((m_Y) == (m_Y_end) && (n_Y) == (n_Y_start)) && (m_Y_start) != (m_Y_end)) ) {
+      __parsec_redistribute_no_optimization_Send_task_t* ncc = (__parsec_redistribute_no_optimization_Send_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[redistribute_no_optimization_Send.task_class_id];
+        const int Send_batch_col = batch_col;
+        if( (Send_batch_col >= (0)) && (Send_batch_col <= (NT)) ) {
+          assert(&nc.locals[0].value == &ncc->locals.batch_col.value);
+          ncc->locals.batch_col.value = Send_batch_col;
+          const int Send_m_T = m_T;
+          if( (Send_m_T >= (m_T_START)) && (Send_m_T <= (m_T_END)) ) {
+            assert(&nc.locals[1].value == &ncc->locals.m_T.value);
+            ncc->locals.m_T.value = Send_m_T;
+            const int Send_n_T = n_T;
+            if( (Send_n_T >= (redistribute_no_optimization_Send_inline_c_expr33_line_202(__parsec_tp, &ncc->locals))) && (Send_n_T <= (redistribute_no_optimization_Send_inline_c_expr32_line_202(__parsec_tp, &ncc->locals))) ) {
+              assert(&nc.locals[2].value == &ncc->locals.n_T.value);
+              ncc->locals.n_T.value = Send_n_T;
+              const int Send_mb_T_inner = redistribute_no_optimization_Send_inline_c_expr31_line_204(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[3].value == &ncc->locals.mb_T_inner.value);
+              ncc->locals.mb_T_inner.value = Send_mb_T_inner;
+              const int Send_nb_T_inner = redistribute_no_optimization_Send_inline_c_expr30_line_205(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[4].value == &ncc->locals.nb_T_inner.value);
+              ncc->locals.nb_T_inner.value = Send_nb_T_inner;
+              const int Send_i_start = redistribute_no_optimization_Send_inline_c_expr29_line_207(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[5].value == &ncc->locals.i_start.value);
+              ncc->locals.i_start.value = Send_i_start;
+              const int Send_j_start = redistribute_no_optimization_Send_inline_c_expr28_line_208(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[6].value == &ncc->locals.j_start.value);
+              ncc->locals.j_start.value = Send_j_start;
+              const int Send_m_Y_start = redistribute_no_optimization_Send_inline_c_expr27_line_210(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[7].value == &ncc->locals.m_Y_start.value);
+              ncc->locals.m_Y_start.value = Send_m_Y_start;
+              const int Send_n_Y_start = redistribute_no_optimization_Send_inline_c_expr26_line_211(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[8].value == &ncc->locals.n_Y_start.value);
+              ncc->locals.n_Y_start.value = Send_n_Y_start;
+              const int Send_m_Y_end = redistribute_no_optimization_Send_inline_c_expr25_line_212(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[9].value == &ncc->locals.m_Y_end.value);
+              ncc->locals.m_Y_end.value = Send_m_Y_end;
+              const int Send_n_Y_end = redistribute_no_optimization_Send_inline_c_expr24_line_213(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[10].value == &ncc->locals.n_Y_end.value);
+              ncc->locals.n_Y_end.value = Send_n_Y_end;
+              const int Send_m_Y = m_Y;
+              if( (Send_m_Y >= (ncc->locals.m_Y_start.value)) && (Send_m_Y <= (ncc->locals.m_Y_end.value)) ) {
+                assert(&nc.locals[11].value == &ncc->locals.m_Y.value);
+                ncc->locals.m_Y.value = Send_m_Y;
+                const int Send_n_Y = n_Y;
+                if( (Send_n_Y >= (ncc->locals.n_Y_start.value)) && (Send_n_Y <= (ncc->locals.n_Y_end.value)) ) {
+                  assert(&nc.locals[12].value == &ncc->locals.n_Y.value);
+                  ncc->locals.n_Y.value = Send_n_Y;
+#if defined(DISTRIBUTED)
+                  rank_dst = rank_of_descY(ncc->locals.m_Y.value, ncc->locals.n_Y.value);
+                  if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+                    vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descY)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descY, ncc->locals.m_Y.value, ncc->locals.n_Y.value);
+                  nc.priority = __parsec_tp->super.super.priority;
+                  successor_repo = Send_repo;
+                  successor_repo_key = __jdf2c_make_key_Send((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+                RELEASE_DEP_OUTPUT(es, "SW", this_task, "Y", &nc, rank_src, rank_dst, &data);
+                if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_redistribute_no_optimization_Update_for_SW_dep1_atline_278_iftrue, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+                  }
+                }
+              }
+            }
+          }
+    }
+  }
+  }
+  if( action_mask & 0x10 ) {  /* Flow of data SE [4] */
+    data.data   = this_task->data._f_SE.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x10 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_redistribute_no_optimization_SOURCE_ADT->arena;
+    data.local.src_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.dst_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_redistribute_no_optimization_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( ((((m_Y) == (m_Y_end) && (n_Y) == (n_Y_end)) && (m_Y_start) != (m_Y_end)) && (n_Y_start) != (n_Y_end)) ) {
+      __parsec_redistribute_no_optimization_Send_task_t* ncc = (__parsec_redistribute_no_optimization_Send_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[redistribute_no_optimization_Send.task_class_id];
+        const int Send_batch_col = batch_col;
+        if( (Send_batch_col >= (0)) && (Send_batch_col <= (NT)) ) {
+          assert(&nc.locals[0].value == &ncc->locals.batch_col.value);
+          ncc->locals.batch_col.value = Send_batch_col;
+          const int Send_m_T = m_T;
+          if( (Send_m_T >= (m_T_START)) && (Send_m_T <= (m_T_END)) ) {
+            assert(&nc.locals[1].value == &ncc->locals.m_T.value);
+            ncc->locals.m_T.value = Send_m_T;
+            const int Send_n_T = n_T;
+            if( (Send_n_T >= (redistribute_no_optimization_Send_inline_c_expr33_line_202(__parsec_tp, &ncc->locals))) && (Send_n_T <= (redistribute_no_optimization_Send_inline_c_expr32_line_202(__parsec_tp, &ncc->locals))) ) {
+              assert(&nc.locals[2].value == &ncc->locals.n_T.value);
+              ncc->locals.n_T.value = Send_n_T;
+              const int Send_mb_T_inner = redistribute_no_optimization_Send_inline_c_expr31_line_204(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[3].value == &ncc->locals.mb_T_inner.value);
+              ncc->locals.mb_T_inner.value = Send_mb_T_inner;
+              const int Send_nb_T_inner = redistribute_no_optimization_Send_inline_c_expr30_line_205(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[4].value == &ncc->locals.nb_T_inner.value);
+              ncc->locals.nb_T_inner.value = Send_nb_T_inner;
+              const int Send_i_start = redistribute_no_optimization_Send_inline_c_expr29_line_207(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[5].value == &ncc->locals.i_start.value);
+              ncc->locals.i_start.value = Send_i_start;
+              const int Send_j_start = redistribute_no_optimization_Send_inline_c_expr28_line_208(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[6].value == &ncc->locals.j_start.value);
+              ncc->locals.j_start.value = Send_j_start;
+              const int Send_m_Y_start = redistribute_no_optimization_Send_inline_c_expr27_line_210(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[7].value == &ncc->locals.m_Y_start.value);
+              ncc->locals.m_Y_start.value = Send_m_Y_start;
+              const int Send_n_Y_start = redistribute_no_optimization_Send_inline_c_expr26_line_211(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[8].value == &ncc->locals.n_Y_start.value);
+              ncc->locals.n_Y_start.value = Send_n_Y_start;
+              const int Send_m_Y_end = redistribute_no_optimization_Send_inline_c_expr25_line_212(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[9].value == &ncc->locals.m_Y_end.value);
+              ncc->locals.m_Y_end.value = Send_m_Y_end;
+              const int Send_n_Y_end = redistribute_no_optimization_Send_inline_c_expr24_line_213(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[10].value == &ncc->locals.n_Y_end.value);
+              ncc->locals.n_Y_end.value = Send_n_Y_end;
+              const int Send_m_Y = m_Y;
+              if( (Send_m_Y >= (ncc->locals.m_Y_start.value)) && (Send_m_Y <= (ncc->locals.m_Y_end.value)) ) {
+                assert(&nc.locals[11].value == &ncc->locals.m_Y.value);
+                ncc->locals.m_Y.value = Send_m_Y;
+                const int Send_n_Y = n_Y;
+                if( (Send_n_Y >= (ncc->locals.n_Y_start.value)) && (Send_n_Y <= (ncc->locals.n_Y_end.value)) ) {
+                  assert(&nc.locals[12].value == &ncc->locals.n_Y.value);
+                  ncc->locals.n_Y.value = Send_n_Y;
+#if defined(DISTRIBUTED)
+                  rank_dst = rank_of_descY(ncc->locals.m_Y.value, ncc->locals.n_Y.value);
+                  if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+                    vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descY)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descY, ncc->locals.m_Y.value, ncc->locals.n_Y.value);
+                  nc.priority = __parsec_tp->super.super.priority;
+                  successor_repo = Send_repo;
+                  successor_repo_key = __jdf2c_make_key_Send((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+                RELEASE_DEP_OUTPUT(es, "SE", this_task, "Y", &nc, rank_src, rank_dst, &data);
+                if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_redistribute_no_optimization_Update_for_SE_dep1_atline_280_iftrue, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+                  }
+                }
+              }
+            }
+          }
+    }
+  }
+  }
+  if( action_mask & 0x20 ) {  /* Flow of data N [5] */
+    data.data   = this_task->data._f_N.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x20 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_redistribute_no_optimization_SOURCE_ADT->arena;
+    data.local.src_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.dst_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_redistribute_no_optimization_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( (((m_Y) == (m_Y_start) && (n_Y) > (n_Y_start)) && (n_Y) < (n_Y_end)) ) {
+      __parsec_redistribute_no_optimization_Send_task_t* ncc = (__parsec_redistribute_no_optimization_Send_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[redistribute_no_optimization_Send.task_class_id];
+        const int Send_batch_col = batch_col;
+        if( (Send_batch_col >= (0)) && (Send_batch_col <= (NT)) ) {
+          assert(&nc.locals[0].value == &ncc->locals.batch_col.value);
+          ncc->locals.batch_col.value = Send_batch_col;
+          const int Send_m_T = m_T;
+          if( (Send_m_T >= (m_T_START)) && (Send_m_T <= (m_T_END)) ) {
+            assert(&nc.locals[1].value == &ncc->locals.m_T.value);
+            ncc->locals.m_T.value = Send_m_T;
+            const int Send_n_T = n_T;
+            if( (Send_n_T >= (redistribute_no_optimization_Send_inline_c_expr33_line_202(__parsec_tp, &ncc->locals))) && (Send_n_T <= (redistribute_no_optimization_Send_inline_c_expr32_line_202(__parsec_tp, &ncc->locals))) ) {
+              assert(&nc.locals[2].value == &ncc->locals.n_T.value);
+              ncc->locals.n_T.value = Send_n_T;
+              const int Send_mb_T_inner = redistribute_no_optimization_Send_inline_c_expr31_line_204(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[3].value == &ncc->locals.mb_T_inner.value);
+              ncc->locals.mb_T_inner.value = Send_mb_T_inner;
+              const int Send_nb_T_inner = redistribute_no_optimization_Send_inline_c_expr30_line_205(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[4].value == &ncc->locals.nb_T_inner.value);
+              ncc->locals.nb_T_inner.value = Send_nb_T_inner;
+              const int Send_i_start = redistribute_no_optimization_Send_inline_c_expr29_line_207(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[5].value == &ncc->locals.i_start.value);
+              ncc->locals.i_start.value = Send_i_start;
+              const int Send_j_start = redistribute_no_optimization_Send_inline_c_expr28_line_208(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[6].value == &ncc->locals.j_start.value);
+              ncc->locals.j_start.value = Send_j_start;
+              const int Send_m_Y_start = redistribute_no_optimization_Send_inline_c_expr27_line_210(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[7].value == &ncc->locals.m_Y_start.value);
+              ncc->locals.m_Y_start.value = Send_m_Y_start;
+              const int Send_n_Y_start = redistribute_no_optimization_Send_inline_c_expr26_line_211(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[8].value == &ncc->locals.n_Y_start.value);
+              ncc->locals.n_Y_start.value = Send_n_Y_start;
+              const int Send_m_Y_end = redistribute_no_optimization_Send_inline_c_expr25_line_212(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[9].value == &ncc->locals.m_Y_end.value);
+              ncc->locals.m_Y_end.value = Send_m_Y_end;
+              const int Send_n_Y_end = redistribute_no_optimization_Send_inline_c_expr24_line_213(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[10].value == &ncc->locals.n_Y_end.value);
+              ncc->locals.n_Y_end.value = Send_n_Y_end;
+              const int Send_m_Y = m_Y;
+              if( (Send_m_Y >= (ncc->locals.m_Y_start.value)) && (Send_m_Y <= (ncc->locals.m_Y_end.value)) ) {
+                assert(&nc.locals[11].value == &ncc->locals.m_Y.value);
+                ncc->locals.m_Y.value = Send_m_Y;
+                const int Send_n_Y = n_Y;
+                if( (Send_n_Y >= (ncc->locals.n_Y_start.value)) && (Send_n_Y <= (ncc->locals.n_Y_end.value)) ) {
+                  assert(&nc.locals[12].value == &ncc->locals.n_Y.value);
+                  ncc->locals.n_Y.value = Send_n_Y;
+#if defined(DISTRIBUTED)
+                  rank_dst = rank_of_descY(ncc->locals.m_Y.value, ncc->locals.n_Y.value);
+                  if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+                    vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descY)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descY, ncc->locals.m_Y.value, ncc->locals.n_Y.value);
+                  nc.priority = __parsec_tp->super.super.priority;
+                  successor_repo = Send_repo;
+                  successor_repo_key = __jdf2c_make_key_Send((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+                RELEASE_DEP_OUTPUT(es, "N", this_task, "Y", &nc, rank_src, rank_dst, &data);
+                if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_redistribute_no_optimization_Update_for_N_dep1_atline_282_iftrue, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+                  }
+                }
+              }
+            }
+          }
+    }
+  }
+  }
+  if( action_mask & 0x40 ) {  /* Flow of data S [6] */
+    data.data   = this_task->data._f_S.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x40 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_redistribute_no_optimization_SOURCE_ADT->arena;
+    data.local.src_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.dst_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_redistribute_no_optimization_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( ((((m_Y) == (m_Y_end) && (m_Y_start) != (m_Y_end)) && (n_Y) > (n_Y_start)) && (n_Y) < (n_Y_end)) ) {
+      __parsec_redistribute_no_optimization_Send_task_t* ncc = (__parsec_redistribute_no_optimization_Send_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[redistribute_no_optimization_Send.task_class_id];
+        const int Send_batch_col = batch_col;
+        if( (Send_batch_col >= (0)) && (Send_batch_col <= (NT)) ) {
+          assert(&nc.locals[0].value == &ncc->locals.batch_col.value);
+          ncc->locals.batch_col.value = Send_batch_col;
+          const int Send_m_T = m_T;
+          if( (Send_m_T >= (m_T_START)) && (Send_m_T <= (m_T_END)) ) {
+            assert(&nc.locals[1].value == &ncc->locals.m_T.value);
+            ncc->locals.m_T.value = Send_m_T;
+            const int Send_n_T = n_T;
+            if( (Send_n_T >= (redistribute_no_optimization_Send_inline_c_expr33_line_202(__parsec_tp, &ncc->locals))) && (Send_n_T <= (redistribute_no_optimization_Send_inline_c_expr32_line_202(__parsec_tp, &ncc->locals))) ) {
+              assert(&nc.locals[2].value == &ncc->locals.n_T.value);
+              ncc->locals.n_T.value = Send_n_T;
+              const int Send_mb_T_inner = redistribute_no_optimization_Send_inline_c_expr31_line_204(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[3].value == &ncc->locals.mb_T_inner.value);
+              ncc->locals.mb_T_inner.value = Send_mb_T_inner;
+              const int Send_nb_T_inner = redistribute_no_optimization_Send_inline_c_expr30_line_205(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[4].value == &ncc->locals.nb_T_inner.value);
+              ncc->locals.nb_T_inner.value = Send_nb_T_inner;
+              const int Send_i_start = redistribute_no_optimization_Send_inline_c_expr29_line_207(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[5].value == &ncc->locals.i_start.value);
+              ncc->locals.i_start.value = Send_i_start;
+              const int Send_j_start = redistribute_no_optimization_Send_inline_c_expr28_line_208(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[6].value == &ncc->locals.j_start.value);
+              ncc->locals.j_start.value = Send_j_start;
+              const int Send_m_Y_start = redistribute_no_optimization_Send_inline_c_expr27_line_210(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[7].value == &ncc->locals.m_Y_start.value);
+              ncc->locals.m_Y_start.value = Send_m_Y_start;
+              const int Send_n_Y_start = redistribute_no_optimization_Send_inline_c_expr26_line_211(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[8].value == &ncc->locals.n_Y_start.value);
+              ncc->locals.n_Y_start.value = Send_n_Y_start;
+              const int Send_m_Y_end = redistribute_no_optimization_Send_inline_c_expr25_line_212(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[9].value == &ncc->locals.m_Y_end.value);
+              ncc->locals.m_Y_end.value = Send_m_Y_end;
+              const int Send_n_Y_end = redistribute_no_optimization_Send_inline_c_expr24_line_213(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[10].value == &ncc->locals.n_Y_end.value);
+              ncc->locals.n_Y_end.value = Send_n_Y_end;
+              const int Send_m_Y = m_Y;
+              if( (Send_m_Y >= (ncc->locals.m_Y_start.value)) && (Send_m_Y <= (ncc->locals.m_Y_end.value)) ) {
+                assert(&nc.locals[11].value == &ncc->locals.m_Y.value);
+                ncc->locals.m_Y.value = Send_m_Y;
+                const int Send_n_Y = n_Y;
+                if( (Send_n_Y >= (ncc->locals.n_Y_start.value)) && (Send_n_Y <= (ncc->locals.n_Y_end.value)) ) {
+                  assert(&nc.locals[12].value == &ncc->locals.n_Y.value);
+                  ncc->locals.n_Y.value = Send_n_Y;
+#if defined(DISTRIBUTED)
+                  rank_dst = rank_of_descY(ncc->locals.m_Y.value, ncc->locals.n_Y.value);
+                  if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+                    vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descY)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descY, ncc->locals.m_Y.value, ncc->locals.n_Y.value);
+                  nc.priority = __parsec_tp->super.super.priority;
+                  successor_repo = Send_repo;
+                  successor_repo_key = __jdf2c_make_key_Send((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+                RELEASE_DEP_OUTPUT(es, "S", this_task, "Y", &nc, rank_src, rank_dst, &data);
+                if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_redistribute_no_optimization_Update_for_S_dep1_atline_284_iftrue, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+                  }
+                }
+              }
+            }
+          }
+    }
+  }
+  }
+  if( action_mask & 0x80 ) {  /* Flow of data W [7] */
+    data.data   = this_task->data._f_W.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x80 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_redistribute_no_optimization_SOURCE_ADT->arena;
+    data.local.src_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.dst_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_redistribute_no_optimization_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( (((n_Y) == (n_Y_start) && (m_Y) > (m_Y_start)) && (m_Y) < (m_Y_end)) ) {
+      __parsec_redistribute_no_optimization_Send_task_t* ncc = (__parsec_redistribute_no_optimization_Send_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[redistribute_no_optimization_Send.task_class_id];
+        const int Send_batch_col = batch_col;
+        if( (Send_batch_col >= (0)) && (Send_batch_col <= (NT)) ) {
+          assert(&nc.locals[0].value == &ncc->locals.batch_col.value);
+          ncc->locals.batch_col.value = Send_batch_col;
+          const int Send_m_T = m_T;
+          if( (Send_m_T >= (m_T_START)) && (Send_m_T <= (m_T_END)) ) {
+            assert(&nc.locals[1].value == &ncc->locals.m_T.value);
+            ncc->locals.m_T.value = Send_m_T;
+            const int Send_n_T = n_T;
+            if( (Send_n_T >= (redistribute_no_optimization_Send_inline_c_expr33_line_202(__parsec_tp, &ncc->locals))) && (Send_n_T <= (redistribute_no_optimization_Send_inline_c_expr32_line_202(__parsec_tp, &ncc->locals))) ) {
+              assert(&nc.locals[2].value == &ncc->locals.n_T.value);
+              ncc->locals.n_T.value = Send_n_T;
+              const int Send_mb_T_inner = redistribute_no_optimization_Send_inline_c_expr31_line_204(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[3].value == &ncc->locals.mb_T_inner.value);
+              ncc->locals.mb_T_inner.value = Send_mb_T_inner;
+              const int Send_nb_T_inner = redistribute_no_optimization_Send_inline_c_expr30_line_205(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[4].value == &ncc->locals.nb_T_inner.value);
+              ncc->locals.nb_T_inner.value = Send_nb_T_inner;
+              const int Send_i_start = redistribute_no_optimization_Send_inline_c_expr29_line_207(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[5].value == &ncc->locals.i_start.value);
+              ncc->locals.i_start.value = Send_i_start;
+              const int Send_j_start = redistribute_no_optimization_Send_inline_c_expr28_line_208(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[6].value == &ncc->locals.j_start.value);
+              ncc->locals.j_start.value = Send_j_start;
+              const int Send_m_Y_start = redistribute_no_optimization_Send_inline_c_expr27_line_210(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[7].value == &ncc->locals.m_Y_start.value);
+              ncc->locals.m_Y_start.value = Send_m_Y_start;
+              const int Send_n_Y_start = redistribute_no_optimization_Send_inline_c_expr26_line_211(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[8].value == &ncc->locals.n_Y_start.value);
+              ncc->locals.n_Y_start.value = Send_n_Y_start;
+              const int Send_m_Y_end = redistribute_no_optimization_Send_inline_c_expr25_line_212(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[9].value == &ncc->locals.m_Y_end.value);
+              ncc->locals.m_Y_end.value = Send_m_Y_end;
+              const int Send_n_Y_end = redistribute_no_optimization_Send_inline_c_expr24_line_213(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[10].value == &ncc->locals.n_Y_end.value);
+              ncc->locals.n_Y_end.value = Send_n_Y_end;
+              const int Send_m_Y = m_Y;
+              if( (Send_m_Y >= (ncc->locals.m_Y_start.value)) && (Send_m_Y <= (ncc->locals.m_Y_end.value)) ) {
+                assert(&nc.locals[11].value == &ncc->locals.m_Y.value);
+                ncc->locals.m_Y.value = Send_m_Y;
+                const int Send_n_Y = n_Y;
+                if( (Send_n_Y >= (ncc->locals.n_Y_start.value)) && (Send_n_Y <= (ncc->locals.n_Y_end.value)) ) {
+                  assert(&nc.locals[12].value == &ncc->locals.n_Y.value);
+                  ncc->locals.n_Y.value = Send_n_Y;
+#if defined(DISTRIBUTED)
+                  rank_dst = rank_of_descY(ncc->locals.m_Y.value, ncc->locals.n_Y.value);
+                  if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+                    vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descY)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descY, ncc->locals.m_Y.value, ncc->locals.n_Y.value);
+                  nc.priority = __parsec_tp->super.super.priority;
+                  successor_repo = Send_repo;
+                  successor_repo_key = __jdf2c_make_key_Send((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+                RELEASE_DEP_OUTPUT(es, "W", this_task, "Y", &nc, rank_src, rank_dst, &data);
+                if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_redistribute_no_optimization_Update_for_W_dep1_atline_286_iftrue, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+                  }
+                }
+              }
+            }
+          }
+    }
+  }
+  }
+  if( action_mask & 0x100 ) {  /* Flow of data E [8] */
+    data.data   = this_task->data._f_E.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x100 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_redistribute_no_optimization_SOURCE_ADT->arena;
+    data.local.src_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.dst_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_redistribute_no_optimization_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( ((((n_Y) == (n_Y_end) && (n_Y_start) != (n_Y_end)) && (m_Y) > (m_Y_start)) && (m_Y) < (m_Y_end)) ) {
+      __parsec_redistribute_no_optimization_Send_task_t* ncc = (__parsec_redistribute_no_optimization_Send_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[redistribute_no_optimization_Send.task_class_id];
+        const int Send_batch_col = batch_col;
+        if( (Send_batch_col >= (0)) && (Send_batch_col <= (NT)) ) {
+          assert(&nc.locals[0].value == &ncc->locals.batch_col.value);
+          ncc->locals.batch_col.value = Send_batch_col;
+          const int Send_m_T = m_T;
+          if( (Send_m_T >= (m_T_START)) && (Send_m_T <= (m_T_END)) ) {
+            assert(&nc.locals[1].value == &ncc->locals.m_T.value);
+            ncc->locals.m_T.value = Send_m_T;
+            const int Send_n_T = n_T;
+            if( (Send_n_T >= (redistribute_no_optimization_Send_inline_c_expr33_line_202(__parsec_tp, &ncc->locals))) && (Send_n_T <= (redistribute_no_optimization_Send_inline_c_expr32_line_202(__parsec_tp, &ncc->locals))) ) {
+              assert(&nc.locals[2].value == &ncc->locals.n_T.value);
+              ncc->locals.n_T.value = Send_n_T;
+              const int Send_mb_T_inner = redistribute_no_optimization_Send_inline_c_expr31_line_204(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[3].value == &ncc->locals.mb_T_inner.value);
+              ncc->locals.mb_T_inner.value = Send_mb_T_inner;
+              const int Send_nb_T_inner = redistribute_no_optimization_Send_inline_c_expr30_line_205(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[4].value == &ncc->locals.nb_T_inner.value);
+              ncc->locals.nb_T_inner.value = Send_nb_T_inner;
+              const int Send_i_start = redistribute_no_optimization_Send_inline_c_expr29_line_207(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[5].value == &ncc->locals.i_start.value);
+              ncc->locals.i_start.value = Send_i_start;
+              const int Send_j_start = redistribute_no_optimization_Send_inline_c_expr28_line_208(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[6].value == &ncc->locals.j_start.value);
+              ncc->locals.j_start.value = Send_j_start;
+              const int Send_m_Y_start = redistribute_no_optimization_Send_inline_c_expr27_line_210(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[7].value == &ncc->locals.m_Y_start.value);
+              ncc->locals.m_Y_start.value = Send_m_Y_start;
+              const int Send_n_Y_start = redistribute_no_optimization_Send_inline_c_expr26_line_211(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[8].value == &ncc->locals.n_Y_start.value);
+              ncc->locals.n_Y_start.value = Send_n_Y_start;
+              const int Send_m_Y_end = redistribute_no_optimization_Send_inline_c_expr25_line_212(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[9].value == &ncc->locals.m_Y_end.value);
+              ncc->locals.m_Y_end.value = Send_m_Y_end;
+              const int Send_n_Y_end = redistribute_no_optimization_Send_inline_c_expr24_line_213(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[10].value == &ncc->locals.n_Y_end.value);
+              ncc->locals.n_Y_end.value = Send_n_Y_end;
+              const int Send_m_Y = m_Y;
+              if( (Send_m_Y >= (ncc->locals.m_Y_start.value)) && (Send_m_Y <= (ncc->locals.m_Y_end.value)) ) {
+                assert(&nc.locals[11].value == &ncc->locals.m_Y.value);
+                ncc->locals.m_Y.value = Send_m_Y;
+                const int Send_n_Y = n_Y;
+                if( (Send_n_Y >= (ncc->locals.n_Y_start.value)) && (Send_n_Y <= (ncc->locals.n_Y_end.value)) ) {
+                  assert(&nc.locals[12].value == &ncc->locals.n_Y.value);
+                  ncc->locals.n_Y.value = Send_n_Y;
+#if defined(DISTRIBUTED)
+                  rank_dst = rank_of_descY(ncc->locals.m_Y.value, ncc->locals.n_Y.value);
+                  if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+                    vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descY)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descY, ncc->locals.m_Y.value, ncc->locals.n_Y.value);
+                  nc.priority = __parsec_tp->super.super.priority;
+                  successor_repo = Send_repo;
+                  successor_repo_key = __jdf2c_make_key_Send((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+                RELEASE_DEP_OUTPUT(es, "E", this_task, "Y", &nc, rank_src, rank_dst, &data);
+                if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_redistribute_no_optimization_Update_for_E_dep1_atline_288_iftrue, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+                  }
+                }
+              }
+            }
+          }
+    }
+  }
+  }
+  if( action_mask & 0x200 ) {  /* Flow of data I [9] */
+    data.data   = this_task->data._f_I.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x200 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_redistribute_no_optimization_SOURCE_ADT->arena;
+    data.local.src_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.dst_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_redistribute_no_optimization_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( ((((m_Y) > (m_Y_start) && (m_Y) < (m_Y_end)) && (n_Y) > (n_Y_start)) && (n_Y) < (n_Y_end)) ) {
+      __parsec_redistribute_no_optimization_Send_task_t* ncc = (__parsec_redistribute_no_optimization_Send_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[redistribute_no_optimization_Send.task_class_id];
+        const int Send_batch_col = batch_col;
+        if( (Send_batch_col >= (0)) && (Send_batch_col <= (NT)) ) {
+          assert(&nc.locals[0].value == &ncc->locals.batch_col.value);
+          ncc->locals.batch_col.value = Send_batch_col;
+          const int Send_m_T = m_T;
+          if( (Send_m_T >= (m_T_START)) && (Send_m_T <= (m_T_END)) ) {
+            assert(&nc.locals[1].value == &ncc->locals.m_T.value);
+            ncc->locals.m_T.value = Send_m_T;
+            const int Send_n_T = n_T;
+            if( (Send_n_T >= (redistribute_no_optimization_Send_inline_c_expr33_line_202(__parsec_tp, &ncc->locals))) && (Send_n_T <= (redistribute_no_optimization_Send_inline_c_expr32_line_202(__parsec_tp, &ncc->locals))) ) {
+              assert(&nc.locals[2].value == &ncc->locals.n_T.value);
+              ncc->locals.n_T.value = Send_n_T;
+              const int Send_mb_T_inner = redistribute_no_optimization_Send_inline_c_expr31_line_204(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[3].value == &ncc->locals.mb_T_inner.value);
+              ncc->locals.mb_T_inner.value = Send_mb_T_inner;
+              const int Send_nb_T_inner = redistribute_no_optimization_Send_inline_c_expr30_line_205(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[4].value == &ncc->locals.nb_T_inner.value);
+              ncc->locals.nb_T_inner.value = Send_nb_T_inner;
+              const int Send_i_start = redistribute_no_optimization_Send_inline_c_expr29_line_207(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[5].value == &ncc->locals.i_start.value);
+              ncc->locals.i_start.value = Send_i_start;
+              const int Send_j_start = redistribute_no_optimization_Send_inline_c_expr28_line_208(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[6].value == &ncc->locals.j_start.value);
+              ncc->locals.j_start.value = Send_j_start;
+              const int Send_m_Y_start = redistribute_no_optimization_Send_inline_c_expr27_line_210(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[7].value == &ncc->locals.m_Y_start.value);
+              ncc->locals.m_Y_start.value = Send_m_Y_start;
+              const int Send_n_Y_start = redistribute_no_optimization_Send_inline_c_expr26_line_211(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[8].value == &ncc->locals.n_Y_start.value);
+              ncc->locals.n_Y_start.value = Send_n_Y_start;
+              const int Send_m_Y_end = redistribute_no_optimization_Send_inline_c_expr25_line_212(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[9].value == &ncc->locals.m_Y_end.value);
+              ncc->locals.m_Y_end.value = Send_m_Y_end;
+              const int Send_n_Y_end = redistribute_no_optimization_Send_inline_c_expr24_line_213(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[10].value == &ncc->locals.n_Y_end.value);
+              ncc->locals.n_Y_end.value = Send_n_Y_end;
+              const int Send_m_Y = m_Y;
+              if( (Send_m_Y >= (ncc->locals.m_Y_start.value)) && (Send_m_Y <= (ncc->locals.m_Y_end.value)) ) {
+                assert(&nc.locals[11].value == &ncc->locals.m_Y.value);
+                ncc->locals.m_Y.value = Send_m_Y;
+                const int Send_n_Y = n_Y;
+                if( (Send_n_Y >= (ncc->locals.n_Y_start.value)) && (Send_n_Y <= (ncc->locals.n_Y_end.value)) ) {
+                  assert(&nc.locals[12].value == &ncc->locals.n_Y.value);
+                  ncc->locals.n_Y.value = Send_n_Y;
+#if defined(DISTRIBUTED)
+                  rank_dst = rank_of_descY(ncc->locals.m_Y.value, ncc->locals.n_Y.value);
+                  if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+                    vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descY)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descY, ncc->locals.m_Y.value, ncc->locals.n_Y.value);
+                  nc.priority = __parsec_tp->super.super.priority;
+                  successor_repo = Send_repo;
+                  successor_repo_key = __jdf2c_make_key_Send((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+                RELEASE_DEP_OUTPUT(es, "I", this_task, "Y", &nc, rank_src, rank_dst, &data);
+                if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_redistribute_no_optimization_Update_for_I_dep1_atline_290_iftrue, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+                  }
+                }
+              }
+            }
+          }
+    }
+  }
+  }
+  /* Flow of data ctl has only IN dependencies */
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static int release_deps_of_redistribute_no_optimization_Update(parsec_execution_stream_t *es, __parsec_redistribute_no_optimization_Update_task_t *this_task, uint32_t action_mask, parsec_remote_deps_t *deps)
+{
+  PARSEC_PINS(es, RELEASE_DEPS_BEGIN, (parsec_task_t *)this_task);  const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp = (const __parsec_redistribute_no_optimization_internal_taskpool_t *)this_task->taskpool;
+  parsec_release_dep_fct_arg_t arg;
+  int __vp_id;
+  int consume_local_repo = 0;
+  arg.action_mask = action_mask;
+  arg.output_entry = NULL;
+  arg.output_repo = NULL;
+#if defined(DISTRIBUTED)
+  arg.remote_deps = deps;
+#endif  /* defined(DISTRIBUTED) */
+  assert(NULL != es);
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS )    arg.ready_lists = alloca(sizeof(parsec_task_t *) * es->virtual_process->parsec_context->nb_vp);
+  else
+    arg.ready_lists = NULL;
+  for( __vp_id = 0; __vp_id < es->virtual_process->parsec_context->nb_vp; arg.ready_lists[__vp_id++] = NULL );
+  (void)__parsec_tp; (void)deps;
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_T.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_T.source_repo, this_task->data._f_T.source_repo_entry->ht_item.key );
+    }
+    if( NULL != this_task->data._f_NW.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_NW.source_repo, this_task->data._f_NW.source_repo_entry->ht_item.key );
+    }
+    if( NULL != this_task->data._f_NE.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_NE.source_repo, this_task->data._f_NE.source_repo_entry->ht_item.key );
+    }
+    if( NULL != this_task->data._f_SW.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_SW.source_repo, this_task->data._f_SW.source_repo_entry->ht_item.key );
+    }
+    if( NULL != this_task->data._f_SE.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_SE.source_repo, this_task->data._f_SE.source_repo_entry->ht_item.key );
+    }
+    if( NULL != this_task->data._f_N.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_N.source_repo, this_task->data._f_N.source_repo_entry->ht_item.key );
+    }
+    if( NULL != this_task->data._f_S.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_S.source_repo, this_task->data._f_S.source_repo_entry->ht_item.key );
+    }
+    if( NULL != this_task->data._f_W.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_W.source_repo, this_task->data._f_W.source_repo_entry->ht_item.key );
+    }
+    if( NULL != this_task->data._f_E.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_E.source_repo, this_task->data._f_E.source_repo_entry->ht_item.key );
+    }
+    if( NULL != this_task->data._f_I.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_I.source_repo, this_task->data._f_I.source_repo_entry->ht_item.key );
+    }
+  }
+  consume_local_repo = (this_task->repo_entry != NULL);
+  arg.output_repo = Update_repo;
+  arg.output_entry = this_task->repo_entry;
+  arg.output_usage = 0;
+  if( action_mask & (PARSEC_ACTION_RELEASE_LOCAL_DEPS | PARSEC_ACTION_GET_REPO_ENTRY) ) {
+    arg.output_entry = data_repo_lookup_entry_and_create( es, arg.output_repo, __jdf2c_make_key_Update((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    arg.output_entry->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(arg.output_entry->sim_exec_date == 0);
+    arg.output_entry->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  if(action_mask & ( PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE ) ){
+    /* Generate the reshape promise for the outputs that need it */
+    iterate_successors_of_redistribute_no_optimization_Update(es, this_task, action_mask, parsec_set_up_reshape_promise, &arg);
+   }
+  iterate_successors_of_redistribute_no_optimization_Update(es, this_task, action_mask, parsec_release_dep_fct, &arg);
+
+#if defined(DISTRIBUTED)
+  if( (action_mask & PARSEC_ACTION_SEND_REMOTE_DEPS) && (NULL != arg.remote_deps)) {
+    parsec_remote_dep_activate(es, (parsec_task_t *)this_task, arg.remote_deps, arg.remote_deps->outgoing_mask);
+  }
+#endif
+
+  if(action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS) {
+    data_repo_entry_addto_usage_limit(Update_repo, arg.output_entry->ht_item.key, arg.output_usage);
+    __parsec_schedule_vp(es, arg.ready_lists, 0);
+  }
+      if (consume_local_repo) {
+         data_repo_entry_used_once( Update_repo, this_task->repo_entry->ht_item.key );
+      }
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_T.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_T.data_in);
+    }
+    if( NULL != this_task->data._f_NW.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_NW.data_in);
+    }
+    if( NULL != this_task->data._f_NE.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_NE.data_in);
+    }
+    if( NULL != this_task->data._f_SW.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_SW.data_in);
+    }
+    if( NULL != this_task->data._f_SE.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_SE.data_in);
+    }
+    if( NULL != this_task->data._f_N.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_N.data_in);
+    }
+    if( NULL != this_task->data._f_S.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_S.data_in);
+    }
+    if( NULL != this_task->data._f_W.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_W.data_in);
+    }
+    if( NULL != this_task->data._f_E.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_E.data_in);
+    }
+    if( NULL != this_task->data._f_I.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_I.data_in);
+    }
+  }
+  PARSEC_PINS(es, RELEASE_DEPS_END, (parsec_task_t *)this_task);  return 0;
+}
+
+static int data_lookup_of_redistribute_no_optimization_Update(parsec_execution_stream_t *es, __parsec_redistribute_no_optimization_Update_task_t *this_task)
+{
+  const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_no_optimization_internal_taskpool_t *)this_task->taskpool;
+  parsec_assignment_t generic_locals[MAX_PARAM_COUNT];  /* generic task locals */
+  int target_device = 0; (void)target_device;
+  (void)__parsec_tp; (void)generic_locals; (void)es;
+  parsec_data_copy_t *chunk = NULL;
+  data_repo_t        *reshape_repo  = NULL, *consumed_repo  = NULL;
+  data_repo_entry_t  *reshape_entry = NULL, *consumed_entry = NULL;
+  parsec_key_t        reshape_entry_key = 0, consumed_entry_key = 0;
+  uint8_t             consumed_flow_index;
+  parsec_dep_data_description_t data;
+  int ret;
+  (void)reshape_repo; (void)reshape_entry; (void)reshape_entry_key;
+  (void)consumed_repo; (void)consumed_entry; (void)consumed_entry_key;
+  (void)consumed_flow_index;
+  (void)chunk; (void)data; (void)ret;
+  const int batch_col = this_task->locals.batch_col.value; (void)batch_col;
+  const int m_T = this_task->locals.m_T.value; (void)m_T;
+  const int n_T = this_task->locals.n_T.value; (void)n_T;
+  const int mb_T_inner = this_task->locals.mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = this_task->locals.nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = this_task->locals.i_start.value; (void)i_start;
+  const int j_start = this_task->locals.j_start.value; (void)j_start;
+  const int m_Y_start = this_task->locals.m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = this_task->locals.n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = this_task->locals.m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = this_task->locals.n_Y_end.value; (void)n_Y_end;
+  const int m_Y = this_task->locals.m_Y.value; (void)m_Y;
+  const int n_Y = this_task->locals.n_Y.value; (void)n_Y;
+  const int TL_row = this_task->locals.TL_row.value; (void)TL_row;
+  const int TL_col = this_task->locals.TL_col.value; (void)TL_col;
+  const int BR_row = this_task->locals.BR_row.value; (void)BR_row;
+  const int BR_col = this_task->locals.BR_col.value; (void)BR_col;
+  if( NULL == this_task->repo_entry ){
+    this_task->repo_entry = data_repo_lookup_entry_and_create(es, Update_repo,                                       __jdf2c_make_key_Update((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    data_repo_entry_addto_usage_limit(Update_repo, this_task->repo_entry->ht_item.key, 1);    this_task->repo_entry ->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(this_task->repo_entry ->sim_exec_date == 0);
+    this_task->repo_entry ->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  /* The reshape repo is the current task repo. */  reshape_repo = Update_repo;
+  reshape_entry_key = __jdf2c_make_key_Update((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals) ;
+  reshape_entry = this_task->repo_entry;
+  /* Lookup the input data, and store them in the context if any */
+
+if(! this_task->data._f_T.fulfill ){ /* Flow T */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_T.data_out = NULL;  /* input only */
+  /* Flow T [0] dependency [0] from predecessor Init */
+  if( NULL == (chunk = this_task->data._f_T.data_in) ) {
+  /* No data set up by predecessor on this task input flow */
+__parsec_redistribute_no_optimization_Init_parsec_assignment_t *target_locals = (__parsec_redistribute_no_optimization_Init_parsec_assignment_t*)&generic_locals;
+  const int Initbatch_col = target_locals->batch_col.value = batch_col; (void)Initbatch_col;
+  const int Initm_T = target_locals->m_T.value = m_T; (void)Initm_T;
+  const int Initn_T = target_locals->n_T.value = n_T; (void)Initn_T;
+  const int Initmb_T_inner = target_locals->mb_T_inner.value = redistribute_no_optimization_Init_inline_c_expr39_line_168(__parsec_tp, target_locals); (void)Initmb_T_inner;
+  const int Initnb_T_inner = target_locals->nb_T_inner.value = redistribute_no_optimization_Init_inline_c_expr38_line_169(__parsec_tp, target_locals); (void)Initnb_T_inner;
+  const int Initsizei_T = target_locals->sizei_T.value = (((Initm_T - m_T_START) * mb_T_INNER) - (disi_T % mb_T_INNER)); (void)Initsizei_T;
+  const int Initsizej_T = target_locals->sizej_T.value = (((Initn_T - n_T_START) * nb_T_INNER) - (disj_T % nb_T_INNER)); (void)Initsizej_T;
+  const int Initm_Y_start = target_locals->m_Y_start.value = redistribute_no_optimization_Init_inline_c_expr37_line_174(__parsec_tp, target_locals); (void)Initm_Y_start;
+  const int Initn_Y_start = target_locals->n_Y_start.value = redistribute_no_optimization_Init_inline_c_expr36_line_175(__parsec_tp, target_locals); (void)Initn_Y_start;
+  const int Initm_Y_end = target_locals->m_Y_end.value = redistribute_no_optimization_Init_inline_c_expr35_line_176(__parsec_tp, target_locals); (void)Initm_Y_end;
+  const int Initn_Y_end = target_locals->n_Y_end.value = redistribute_no_optimization_Init_inline_c_expr34_line_177(__parsec_tp, target_locals); (void)Initn_Y_end;
+    if( (reshape_entry != NULL) && (reshape_entry->data[0] != NULL) ){
+        /* Reshape promise set up on this task repo by predecessor */
+        consumed_repo = reshape_repo;
+        consumed_entry = reshape_entry;
+        consumed_entry_key = reshape_entry_key;
+        consumed_flow_index = 0;
+    }else{
+        /* Consume from predecessor's repo */
+        consumed_repo = Init_repo;
+        consumed_entry_key = __jdf2c_make_key_Init((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)target_locals) ;
+        consumed_entry = data_repo_lookup_entry( consumed_repo, consumed_entry_key );
+        consumed_flow_index = 0;
+    }
+    data.data   = NULL;
+    data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+        data.local.arena  = PARSEC_redistribute_no_optimization_TARGET_ADT->arena;
+    data.local.src_datatype = PARSEC_redistribute_no_optimization_TARGET_ADT->opaque_dtt;
+    data.local.dst_datatype = PARSEC_redistribute_no_optimization_TARGET_ADT->opaque_dtt;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    ACQUIRE_FLOW(this_task, "T", &redistribute_no_optimization_Init, "T", target_locals, chunk);
+    this_task->data._f_T.data_out = chunk;
+  } 
+  else {
+    /* Data set up by predecessor on this task input flow */
+    consumed_repo = this_task->data._f_T.source_repo;
+    consumed_entry = this_task->data._f_T.source_repo_entry;
+    consumed_entry_key = this_task->data._f_T.source_repo_entry->ht_item.key;
+    if( (reshape_entry != NULL) && (reshape_entry->data[0] != NULL) ){
+        /* Reshape promise set up on input by predecessor is on this task repo */
+        consumed_flow_index = 0;
+        assert( (this_task->data._f_T.source_repo == reshape_repo)
+             && (this_task->data._f_T.source_repo_entry == reshape_entry));
+    }else{
+        /* Reshape promise set up on input by predecessor is the predecesssor task repo */
+        consumed_flow_index = 0;
+    }
+    data.data   = NULL;
+    data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+        data.local.arena  = PARSEC_redistribute_no_optimization_TARGET_ADT->arena;
+    data.local.src_datatype = PARSEC_redistribute_no_optimization_TARGET_ADT->opaque_dtt;
+    data.local.dst_datatype = PARSEC_redistribute_no_optimization_TARGET_ADT->opaque_dtt;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    this_task->data._f_T.data_out = parsec_data_get_copy(chunk->original, target_device);
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+    parsec_prof_grapher_data_input(chunk->original, (parsec_task_t*)this_task, &flow_of_redistribute_no_optimization_Update_for_T, 0);
+#endif
+  }
+    this_task->data._f_T.data_in     = chunk;
+    this_task->data._f_T.source_repo       = consumed_repo;
+    this_task->data._f_T.source_repo_entry = consumed_entry;
+    if( this_task->data._f_T.source_repo_entry == this_task->repo_entry ){
+      /* in case we have consume from this task repo entry for the flow,
+       * it is cleaned up, avoiding having old stuff during release_deps_of
+       */
+      this_task->repo_entry->data[0] = NULL;
+    }
+    this_task->data._f_T.fulfill = 1;
+}
+
+
+if(! this_task->data._f_NW.fulfill ){ /* Flow NW */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_NW.data_out = NULL;  /* input only */
+    if( ((m_Y) == (m_Y_start) && (n_Y) == (n_Y_start)) ) {
+    /* Flow NW [1] dependency [1] from predecessor Send */
+    if( NULL == (chunk = this_task->data._f_NW.data_in) ) {
+    /* No data set up by predecessor on this task input flow */
+__parsec_redistribute_no_optimization_Send_parsec_assignment_t *target_locals = (__parsec_redistribute_no_optimization_Send_parsec_assignment_t*)&generic_locals;
+      const int Sendbatch_col = target_locals->batch_col.value = batch_col; (void)Sendbatch_col;
+      const int Sendm_T = target_locals->m_T.value = m_T; (void)Sendm_T;
+      const int Sendn_T = target_locals->n_T.value = n_T; (void)Sendn_T;
+      const int Sendmb_T_inner = target_locals->mb_T_inner.value = redistribute_no_optimization_Send_inline_c_expr31_line_204(__parsec_tp, target_locals); (void)Sendmb_T_inner;
+      const int Sendnb_T_inner = target_locals->nb_T_inner.value = redistribute_no_optimization_Send_inline_c_expr30_line_205(__parsec_tp, target_locals); (void)Sendnb_T_inner;
+      const int Sendi_start = target_locals->i_start.value = redistribute_no_optimization_Send_inline_c_expr29_line_207(__parsec_tp, target_locals); (void)Sendi_start;
+      const int Sendj_start = target_locals->j_start.value = redistribute_no_optimization_Send_inline_c_expr28_line_208(__parsec_tp, target_locals); (void)Sendj_start;
+      const int Sendm_Y_start = target_locals->m_Y_start.value = redistribute_no_optimization_Send_inline_c_expr27_line_210(__parsec_tp, target_locals); (void)Sendm_Y_start;
+      const int Sendn_Y_start = target_locals->n_Y_start.value = redistribute_no_optimization_Send_inline_c_expr26_line_211(__parsec_tp, target_locals); (void)Sendn_Y_start;
+      const int Sendm_Y_end = target_locals->m_Y_end.value = redistribute_no_optimization_Send_inline_c_expr25_line_212(__parsec_tp, target_locals); (void)Sendm_Y_end;
+      const int Sendn_Y_end = target_locals->n_Y_end.value = redistribute_no_optimization_Send_inline_c_expr24_line_213(__parsec_tp, target_locals); (void)Sendn_Y_end;
+      const int Sendm_Y = target_locals->m_Y.value = m_Y; (void)Sendm_Y;
+      const int Sendn_Y = target_locals->n_Y.value = n_Y; (void)Sendn_Y;
+      if( (reshape_entry != NULL) && (reshape_entry->data[1] != NULL) ){
+          /* Reshape promise set up on this task repo by predecessor */
+          consumed_repo = reshape_repo;
+          consumed_entry = reshape_entry;
+          consumed_entry_key = reshape_entry_key;
+          consumed_flow_index = 1;
+      }else{
+          /* Consume from predecessor's repo */
+          consumed_repo = Send_repo;
+          consumed_entry_key = __jdf2c_make_key_Send((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)target_locals) ;
+          consumed_entry = data_repo_lookup_entry( consumed_repo, consumed_entry_key );
+          consumed_flow_index = 0;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = PARSEC_redistribute_no_optimization_SOURCE_ADT->arena;
+    data.local.src_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.dst_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 1, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      ACQUIRE_FLOW(this_task, "NW", &redistribute_no_optimization_Send, "Y", target_locals, chunk);
+      this_task->data._f_NW.data_out = chunk;
+    } 
+    else {
+      /* Data set up by predecessor on this task input flow */
+      consumed_repo = this_task->data._f_NW.source_repo;
+      consumed_entry = this_task->data._f_NW.source_repo_entry;
+      consumed_entry_key = this_task->data._f_NW.source_repo_entry->ht_item.key;
+      if( (reshape_entry != NULL) && (reshape_entry->data[1] != NULL) ){
+          /* Reshape promise set up on input by predecessor is on this task repo */
+          consumed_flow_index = 1;
+          assert( (this_task->data._f_NW.source_repo == reshape_repo)
+               && (this_task->data._f_NW.source_repo_entry == reshape_entry));
+      }else{
+          /* Reshape promise set up on input by predecessor is the predecesssor task repo */
+          consumed_flow_index = 0;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = PARSEC_redistribute_no_optimization_SOURCE_ADT->arena;
+    data.local.src_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.dst_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 1, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      this_task->data._f_NW.data_out = parsec_data_get_copy(chunk->original, target_device);
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+      parsec_prof_grapher_data_input(chunk->original, (parsec_task_t*)this_task, &flow_of_redistribute_no_optimization_Update_for_NW, 0);
+#endif
+    }
+    } else {
+    /* Flow NW [1] dependency [1] from memory NEW or NULL data */
+    if( NULL == (chunk = this_task->data._f_NW.data_in) ) {
+    /* No data set up by predecessor on this task input flow */
+    } 
+    }
+    this_task->data._f_NW.data_in     = chunk;
+    this_task->data._f_NW.source_repo       = consumed_repo;
+    this_task->data._f_NW.source_repo_entry = consumed_entry;
+    if( this_task->data._f_NW.source_repo_entry == this_task->repo_entry ){
+      /* in case we have consume from this task repo entry for the flow,
+       * it is cleaned up, avoiding having old stuff during release_deps_of
+       */
+      this_task->repo_entry->data[1] = NULL;
+    }
+    this_task->data._f_NW.fulfill = 1;
+}
+
+
+if(! this_task->data._f_NE.fulfill ){ /* Flow NE */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_NE.data_out = NULL;  /* input only */
+    if( (((m_Y) == (m_Y_start) && (n_Y) == (n_Y_end)) && (n_Y_start) != (n_Y_end)) ) {
+    /* Flow NE [2] dependency [2] from predecessor Send */
+    if( NULL == (chunk = this_task->data._f_NE.data_in) ) {
+    /* No data set up by predecessor on this task input flow */
+__parsec_redistribute_no_optimization_Send_parsec_assignment_t *target_locals = (__parsec_redistribute_no_optimization_Send_parsec_assignment_t*)&generic_locals;
+      const int Sendbatch_col = target_locals->batch_col.value = batch_col; (void)Sendbatch_col;
+      const int Sendm_T = target_locals->m_T.value = m_T; (void)Sendm_T;
+      const int Sendn_T = target_locals->n_T.value = n_T; (void)Sendn_T;
+      const int Sendmb_T_inner = target_locals->mb_T_inner.value = redistribute_no_optimization_Send_inline_c_expr31_line_204(__parsec_tp, target_locals); (void)Sendmb_T_inner;
+      const int Sendnb_T_inner = target_locals->nb_T_inner.value = redistribute_no_optimization_Send_inline_c_expr30_line_205(__parsec_tp, target_locals); (void)Sendnb_T_inner;
+      const int Sendi_start = target_locals->i_start.value = redistribute_no_optimization_Send_inline_c_expr29_line_207(__parsec_tp, target_locals); (void)Sendi_start;
+      const int Sendj_start = target_locals->j_start.value = redistribute_no_optimization_Send_inline_c_expr28_line_208(__parsec_tp, target_locals); (void)Sendj_start;
+      const int Sendm_Y_start = target_locals->m_Y_start.value = redistribute_no_optimization_Send_inline_c_expr27_line_210(__parsec_tp, target_locals); (void)Sendm_Y_start;
+      const int Sendn_Y_start = target_locals->n_Y_start.value = redistribute_no_optimization_Send_inline_c_expr26_line_211(__parsec_tp, target_locals); (void)Sendn_Y_start;
+      const int Sendm_Y_end = target_locals->m_Y_end.value = redistribute_no_optimization_Send_inline_c_expr25_line_212(__parsec_tp, target_locals); (void)Sendm_Y_end;
+      const int Sendn_Y_end = target_locals->n_Y_end.value = redistribute_no_optimization_Send_inline_c_expr24_line_213(__parsec_tp, target_locals); (void)Sendn_Y_end;
+      const int Sendm_Y = target_locals->m_Y.value = m_Y; (void)Sendm_Y;
+      const int Sendn_Y = target_locals->n_Y.value = n_Y; (void)Sendn_Y;
+      if( (reshape_entry != NULL) && (reshape_entry->data[2] != NULL) ){
+          /* Reshape promise set up on this task repo by predecessor */
+          consumed_repo = reshape_repo;
+          consumed_entry = reshape_entry;
+          consumed_entry_key = reshape_entry_key;
+          consumed_flow_index = 2;
+      }else{
+          /* Consume from predecessor's repo */
+          consumed_repo = Send_repo;
+          consumed_entry_key = __jdf2c_make_key_Send((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)target_locals) ;
+          consumed_entry = data_repo_lookup_entry( consumed_repo, consumed_entry_key );
+          consumed_flow_index = 0;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = PARSEC_redistribute_no_optimization_SOURCE_ADT->arena;
+    data.local.src_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.dst_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 2, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      ACQUIRE_FLOW(this_task, "NE", &redistribute_no_optimization_Send, "Y", target_locals, chunk);
+      this_task->data._f_NE.data_out = chunk;
+    } 
+    else {
+      /* Data set up by predecessor on this task input flow */
+      consumed_repo = this_task->data._f_NE.source_repo;
+      consumed_entry = this_task->data._f_NE.source_repo_entry;
+      consumed_entry_key = this_task->data._f_NE.source_repo_entry->ht_item.key;
+      if( (reshape_entry != NULL) && (reshape_entry->data[2] != NULL) ){
+          /* Reshape promise set up on input by predecessor is on this task repo */
+          consumed_flow_index = 2;
+          assert( (this_task->data._f_NE.source_repo == reshape_repo)
+               && (this_task->data._f_NE.source_repo_entry == reshape_entry));
+      }else{
+          /* Reshape promise set up on input by predecessor is the predecesssor task repo */
+          consumed_flow_index = 0;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = PARSEC_redistribute_no_optimization_SOURCE_ADT->arena;
+    data.local.src_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.dst_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 2, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      this_task->data._f_NE.data_out = parsec_data_get_copy(chunk->original, target_device);
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+      parsec_prof_grapher_data_input(chunk->original, (parsec_task_t*)this_task, &flow_of_redistribute_no_optimization_Update_for_NE, 0);
+#endif
+    }
+    } else {
+    /* Flow NE [2] dependency [2] from memory NEW or NULL data */
+    if( NULL == (chunk = this_task->data._f_NE.data_in) ) {
+    /* No data set up by predecessor on this task input flow */
+    } 
+    }
+    this_task->data._f_NE.data_in     = chunk;
+    this_task->data._f_NE.source_repo       = consumed_repo;
+    this_task->data._f_NE.source_repo_entry = consumed_entry;
+    if( this_task->data._f_NE.source_repo_entry == this_task->repo_entry ){
+      /* in case we have consume from this task repo entry for the flow,
+       * it is cleaned up, avoiding having old stuff during release_deps_of
+       */
+      this_task->repo_entry->data[2] = NULL;
+    }
+    this_task->data._f_NE.fulfill = 1;
+}
+
+
+if(! this_task->data._f_SW.fulfill ){ /* Flow SW */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_SW.data_out = NULL;  /* input only */
+    if( (((m_Y) == (m_Y_end) && (n_Y) == (n_Y_start)) && (m_Y_start) != (m_Y_end)) ) {
+    /* Flow SW [3] dependency [3] from predecessor Send */
+    if( NULL == (chunk = this_task->data._f_SW.data_in) ) {
+    /* No data set up by predecessor on this task input flow */
+__parsec_redistribute_no_optimization_Send_parsec_assignment_t *target_locals = (__parsec_redistribute_no_optimization_Send_parsec_assignment_t*)&generic_locals;
+      const int Sendbatch_col = target_locals->batch_col.value = batch_col; (void)Sendbatch_col;
+      const int Sendm_T = target_locals->m_T.value = m_T; (void)Sendm_T;
+      const int Sendn_T = target_locals->n_T.value = n_T; (void)Sendn_T;
+      const int Sendmb_T_inner = target_locals->mb_T_inner.value = redistribute_no_optimization_Send_inline_c_expr31_line_204(__parsec_tp, target_locals); (void)Sendmb_T_inner;
+      const int Sendnb_T_inner = target_locals->nb_T_inner.value = redistribute_no_optimization_Send_inline_c_expr30_line_205(__parsec_tp, target_locals); (void)Sendnb_T_inner;
+      const int Sendi_start = target_locals->i_start.value = redistribute_no_optimization_Send_inline_c_expr29_line_207(__parsec_tp, target_locals); (void)Sendi_start;
+      const int Sendj_start = target_locals->j_start.value = redistribute_no_optimization_Send_inline_c_expr28_line_208(__parsec_tp, target_locals); (void)Sendj_start;
+      const int Sendm_Y_start = target_locals->m_Y_start.value = redistribute_no_optimization_Send_inline_c_expr27_line_210(__parsec_tp, target_locals); (void)Sendm_Y_start;
+      const int Sendn_Y_start = target_locals->n_Y_start.value = redistribute_no_optimization_Send_inline_c_expr26_line_211(__parsec_tp, target_locals); (void)Sendn_Y_start;
+      const int Sendm_Y_end = target_locals->m_Y_end.value = redistribute_no_optimization_Send_inline_c_expr25_line_212(__parsec_tp, target_locals); (void)Sendm_Y_end;
+      const int Sendn_Y_end = target_locals->n_Y_end.value = redistribute_no_optimization_Send_inline_c_expr24_line_213(__parsec_tp, target_locals); (void)Sendn_Y_end;
+      const int Sendm_Y = target_locals->m_Y.value = m_Y; (void)Sendm_Y;
+      const int Sendn_Y = target_locals->n_Y.value = n_Y; (void)Sendn_Y;
+      if( (reshape_entry != NULL) && (reshape_entry->data[3] != NULL) ){
+          /* Reshape promise set up on this task repo by predecessor */
+          consumed_repo = reshape_repo;
+          consumed_entry = reshape_entry;
+          consumed_entry_key = reshape_entry_key;
+          consumed_flow_index = 3;
+      }else{
+          /* Consume from predecessor's repo */
+          consumed_repo = Send_repo;
+          consumed_entry_key = __jdf2c_make_key_Send((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)target_locals) ;
+          consumed_entry = data_repo_lookup_entry( consumed_repo, consumed_entry_key );
+          consumed_flow_index = 0;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = PARSEC_redistribute_no_optimization_SOURCE_ADT->arena;
+    data.local.src_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.dst_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 3, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      ACQUIRE_FLOW(this_task, "SW", &redistribute_no_optimization_Send, "Y", target_locals, chunk);
+      this_task->data._f_SW.data_out = chunk;
+    } 
+    else {
+      /* Data set up by predecessor on this task input flow */
+      consumed_repo = this_task->data._f_SW.source_repo;
+      consumed_entry = this_task->data._f_SW.source_repo_entry;
+      consumed_entry_key = this_task->data._f_SW.source_repo_entry->ht_item.key;
+      if( (reshape_entry != NULL) && (reshape_entry->data[3] != NULL) ){
+          /* Reshape promise set up on input by predecessor is on this task repo */
+          consumed_flow_index = 3;
+          assert( (this_task->data._f_SW.source_repo == reshape_repo)
+               && (this_task->data._f_SW.source_repo_entry == reshape_entry));
+      }else{
+          /* Reshape promise set up on input by predecessor is the predecesssor task repo */
+          consumed_flow_index = 0;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = PARSEC_redistribute_no_optimization_SOURCE_ADT->arena;
+    data.local.src_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.dst_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 3, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      this_task->data._f_SW.data_out = parsec_data_get_copy(chunk->original, target_device);
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+      parsec_prof_grapher_data_input(chunk->original, (parsec_task_t*)this_task, &flow_of_redistribute_no_optimization_Update_for_SW, 0);
+#endif
+    }
+    } else {
+    /* Flow SW [3] dependency [3] from memory NEW or NULL data */
+    if( NULL == (chunk = this_task->data._f_SW.data_in) ) {
+    /* No data set up by predecessor on this task input flow */
+    } 
+    }
+    this_task->data._f_SW.data_in     = chunk;
+    this_task->data._f_SW.source_repo       = consumed_repo;
+    this_task->data._f_SW.source_repo_entry = consumed_entry;
+    if( this_task->data._f_SW.source_repo_entry == this_task->repo_entry ){
+      /* in case we have consume from this task repo entry for the flow,
+       * it is cleaned up, avoiding having old stuff during release_deps_of
+       */
+      this_task->repo_entry->data[3] = NULL;
+    }
+    this_task->data._f_SW.fulfill = 1;
+}
+
+
+if(! this_task->data._f_SE.fulfill ){ /* Flow SE */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_SE.data_out = NULL;  /* input only */
+    if( ((((m_Y) == (m_Y_end) && (n_Y) == (n_Y_end)) && (m_Y_start) != (m_Y_end)) && (n_Y_start) != (n_Y_end)) ) {
+    /* Flow SE [4] dependency [4] from predecessor Send */
+    if( NULL == (chunk = this_task->data._f_SE.data_in) ) {
+    /* No data set up by predecessor on this task input flow */
+__parsec_redistribute_no_optimization_Send_parsec_assignment_t *target_locals = (__parsec_redistribute_no_optimization_Send_parsec_assignment_t*)&generic_locals;
+      const int Sendbatch_col = target_locals->batch_col.value = batch_col; (void)Sendbatch_col;
+      const int Sendm_T = target_locals->m_T.value = m_T; (void)Sendm_T;
+      const int Sendn_T = target_locals->n_T.value = n_T; (void)Sendn_T;
+      const int Sendmb_T_inner = target_locals->mb_T_inner.value = redistribute_no_optimization_Send_inline_c_expr31_line_204(__parsec_tp, target_locals); (void)Sendmb_T_inner;
+      const int Sendnb_T_inner = target_locals->nb_T_inner.value = redistribute_no_optimization_Send_inline_c_expr30_line_205(__parsec_tp, target_locals); (void)Sendnb_T_inner;
+      const int Sendi_start = target_locals->i_start.value = redistribute_no_optimization_Send_inline_c_expr29_line_207(__parsec_tp, target_locals); (void)Sendi_start;
+      const int Sendj_start = target_locals->j_start.value = redistribute_no_optimization_Send_inline_c_expr28_line_208(__parsec_tp, target_locals); (void)Sendj_start;
+      const int Sendm_Y_start = target_locals->m_Y_start.value = redistribute_no_optimization_Send_inline_c_expr27_line_210(__parsec_tp, target_locals); (void)Sendm_Y_start;
+      const int Sendn_Y_start = target_locals->n_Y_start.value = redistribute_no_optimization_Send_inline_c_expr26_line_211(__parsec_tp, target_locals); (void)Sendn_Y_start;
+      const int Sendm_Y_end = target_locals->m_Y_end.value = redistribute_no_optimization_Send_inline_c_expr25_line_212(__parsec_tp, target_locals); (void)Sendm_Y_end;
+      const int Sendn_Y_end = target_locals->n_Y_end.value = redistribute_no_optimization_Send_inline_c_expr24_line_213(__parsec_tp, target_locals); (void)Sendn_Y_end;
+      const int Sendm_Y = target_locals->m_Y.value = m_Y; (void)Sendm_Y;
+      const int Sendn_Y = target_locals->n_Y.value = n_Y; (void)Sendn_Y;
+      if( (reshape_entry != NULL) && (reshape_entry->data[4] != NULL) ){
+          /* Reshape promise set up on this task repo by predecessor */
+          consumed_repo = reshape_repo;
+          consumed_entry = reshape_entry;
+          consumed_entry_key = reshape_entry_key;
+          consumed_flow_index = 4;
+      }else{
+          /* Consume from predecessor's repo */
+          consumed_repo = Send_repo;
+          consumed_entry_key = __jdf2c_make_key_Send((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)target_locals) ;
+          consumed_entry = data_repo_lookup_entry( consumed_repo, consumed_entry_key );
+          consumed_flow_index = 0;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = PARSEC_redistribute_no_optimization_SOURCE_ADT->arena;
+    data.local.src_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.dst_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 4, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      ACQUIRE_FLOW(this_task, "SE", &redistribute_no_optimization_Send, "Y", target_locals, chunk);
+      this_task->data._f_SE.data_out = chunk;
+    } 
+    else {
+      /* Data set up by predecessor on this task input flow */
+      consumed_repo = this_task->data._f_SE.source_repo;
+      consumed_entry = this_task->data._f_SE.source_repo_entry;
+      consumed_entry_key = this_task->data._f_SE.source_repo_entry->ht_item.key;
+      if( (reshape_entry != NULL) && (reshape_entry->data[4] != NULL) ){
+          /* Reshape promise set up on input by predecessor is on this task repo */
+          consumed_flow_index = 4;
+          assert( (this_task->data._f_SE.source_repo == reshape_repo)
+               && (this_task->data._f_SE.source_repo_entry == reshape_entry));
+      }else{
+          /* Reshape promise set up on input by predecessor is the predecesssor task repo */
+          consumed_flow_index = 0;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = PARSEC_redistribute_no_optimization_SOURCE_ADT->arena;
+    data.local.src_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.dst_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 4, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      this_task->data._f_SE.data_out = parsec_data_get_copy(chunk->original, target_device);
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+      parsec_prof_grapher_data_input(chunk->original, (parsec_task_t*)this_task, &flow_of_redistribute_no_optimization_Update_for_SE, 0);
+#endif
+    }
+    } else {
+    /* Flow SE [4] dependency [4] from memory NEW or NULL data */
+    if( NULL == (chunk = this_task->data._f_SE.data_in) ) {
+    /* No data set up by predecessor on this task input flow */
+    } 
+    }
+    this_task->data._f_SE.data_in     = chunk;
+    this_task->data._f_SE.source_repo       = consumed_repo;
+    this_task->data._f_SE.source_repo_entry = consumed_entry;
+    if( this_task->data._f_SE.source_repo_entry == this_task->repo_entry ){
+      /* in case we have consume from this task repo entry for the flow,
+       * it is cleaned up, avoiding having old stuff during release_deps_of
+       */
+      this_task->repo_entry->data[4] = NULL;
+    }
+    this_task->data._f_SE.fulfill = 1;
+}
+
+
+if(! this_task->data._f_N.fulfill ){ /* Flow N */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_N.data_out = NULL;  /* input only */
+    if( (((m_Y) == (m_Y_start) && (n_Y) > (n_Y_start)) && (n_Y) < (n_Y_end)) ) {
+    /* Flow N [5] dependency [5] from predecessor Send */
+    if( NULL == (chunk = this_task->data._f_N.data_in) ) {
+    /* No data set up by predecessor on this task input flow */
+__parsec_redistribute_no_optimization_Send_parsec_assignment_t *target_locals = (__parsec_redistribute_no_optimization_Send_parsec_assignment_t*)&generic_locals;
+      const int Sendbatch_col = target_locals->batch_col.value = batch_col; (void)Sendbatch_col;
+      const int Sendm_T = target_locals->m_T.value = m_T; (void)Sendm_T;
+      const int Sendn_T = target_locals->n_T.value = n_T; (void)Sendn_T;
+      const int Sendmb_T_inner = target_locals->mb_T_inner.value = redistribute_no_optimization_Send_inline_c_expr31_line_204(__parsec_tp, target_locals); (void)Sendmb_T_inner;
+      const int Sendnb_T_inner = target_locals->nb_T_inner.value = redistribute_no_optimization_Send_inline_c_expr30_line_205(__parsec_tp, target_locals); (void)Sendnb_T_inner;
+      const int Sendi_start = target_locals->i_start.value = redistribute_no_optimization_Send_inline_c_expr29_line_207(__parsec_tp, target_locals); (void)Sendi_start;
+      const int Sendj_start = target_locals->j_start.value = redistribute_no_optimization_Send_inline_c_expr28_line_208(__parsec_tp, target_locals); (void)Sendj_start;
+      const int Sendm_Y_start = target_locals->m_Y_start.value = redistribute_no_optimization_Send_inline_c_expr27_line_210(__parsec_tp, target_locals); (void)Sendm_Y_start;
+      const int Sendn_Y_start = target_locals->n_Y_start.value = redistribute_no_optimization_Send_inline_c_expr26_line_211(__parsec_tp, target_locals); (void)Sendn_Y_start;
+      const int Sendm_Y_end = target_locals->m_Y_end.value = redistribute_no_optimization_Send_inline_c_expr25_line_212(__parsec_tp, target_locals); (void)Sendm_Y_end;
+      const int Sendn_Y_end = target_locals->n_Y_end.value = redistribute_no_optimization_Send_inline_c_expr24_line_213(__parsec_tp, target_locals); (void)Sendn_Y_end;
+      const int Sendm_Y = target_locals->m_Y.value = m_Y; (void)Sendm_Y;
+      const int Sendn_Y = target_locals->n_Y.value = n_Y; (void)Sendn_Y;
+      if( (reshape_entry != NULL) && (reshape_entry->data[5] != NULL) ){
+          /* Reshape promise set up on this task repo by predecessor */
+          consumed_repo = reshape_repo;
+          consumed_entry = reshape_entry;
+          consumed_entry_key = reshape_entry_key;
+          consumed_flow_index = 5;
+      }else{
+          /* Consume from predecessor's repo */
+          consumed_repo = Send_repo;
+          consumed_entry_key = __jdf2c_make_key_Send((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)target_locals) ;
+          consumed_entry = data_repo_lookup_entry( consumed_repo, consumed_entry_key );
+          consumed_flow_index = 0;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = PARSEC_redistribute_no_optimization_SOURCE_ADT->arena;
+    data.local.src_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.dst_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 5, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      ACQUIRE_FLOW(this_task, "N", &redistribute_no_optimization_Send, "Y", target_locals, chunk);
+      this_task->data._f_N.data_out = chunk;
+    } 
+    else {
+      /* Data set up by predecessor on this task input flow */
+      consumed_repo = this_task->data._f_N.source_repo;
+      consumed_entry = this_task->data._f_N.source_repo_entry;
+      consumed_entry_key = this_task->data._f_N.source_repo_entry->ht_item.key;
+      if( (reshape_entry != NULL) && (reshape_entry->data[5] != NULL) ){
+          /* Reshape promise set up on input by predecessor is on this task repo */
+          consumed_flow_index = 5;
+          assert( (this_task->data._f_N.source_repo == reshape_repo)
+               && (this_task->data._f_N.source_repo_entry == reshape_entry));
+      }else{
+          /* Reshape promise set up on input by predecessor is the predecesssor task repo */
+          consumed_flow_index = 0;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = PARSEC_redistribute_no_optimization_SOURCE_ADT->arena;
+    data.local.src_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.dst_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 5, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      this_task->data._f_N.data_out = parsec_data_get_copy(chunk->original, target_device);
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+      parsec_prof_grapher_data_input(chunk->original, (parsec_task_t*)this_task, &flow_of_redistribute_no_optimization_Update_for_N, 0);
+#endif
+    }
+    } else {
+    /* Flow N [5] dependency [5] from memory NEW or NULL data */
+    if( NULL == (chunk = this_task->data._f_N.data_in) ) {
+    /* No data set up by predecessor on this task input flow */
+    } 
+    }
+    this_task->data._f_N.data_in     = chunk;
+    this_task->data._f_N.source_repo       = consumed_repo;
+    this_task->data._f_N.source_repo_entry = consumed_entry;
+    if( this_task->data._f_N.source_repo_entry == this_task->repo_entry ){
+      /* in case we have consume from this task repo entry for the flow,
+       * it is cleaned up, avoiding having old stuff during release_deps_of
+       */
+      this_task->repo_entry->data[5] = NULL;
+    }
+    this_task->data._f_N.fulfill = 1;
+}
+
+
+if(! this_task->data._f_S.fulfill ){ /* Flow S */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_S.data_out = NULL;  /* input only */
+    if( ((((m_Y) == (m_Y_end) && (m_Y_start) != (m_Y_end)) && (n_Y) > (n_Y_start)) && (n_Y) < (n_Y_end)) ) {
+    /* Flow S [6] dependency [6] from predecessor Send */
+    if( NULL == (chunk = this_task->data._f_S.data_in) ) {
+    /* No data set up by predecessor on this task input flow */
+__parsec_redistribute_no_optimization_Send_parsec_assignment_t *target_locals = (__parsec_redistribute_no_optimization_Send_parsec_assignment_t*)&generic_locals;
+      const int Sendbatch_col = target_locals->batch_col.value = batch_col; (void)Sendbatch_col;
+      const int Sendm_T = target_locals->m_T.value = m_T; (void)Sendm_T;
+      const int Sendn_T = target_locals->n_T.value = n_T; (void)Sendn_T;
+      const int Sendmb_T_inner = target_locals->mb_T_inner.value = redistribute_no_optimization_Send_inline_c_expr31_line_204(__parsec_tp, target_locals); (void)Sendmb_T_inner;
+      const int Sendnb_T_inner = target_locals->nb_T_inner.value = redistribute_no_optimization_Send_inline_c_expr30_line_205(__parsec_tp, target_locals); (void)Sendnb_T_inner;
+      const int Sendi_start = target_locals->i_start.value = redistribute_no_optimization_Send_inline_c_expr29_line_207(__parsec_tp, target_locals); (void)Sendi_start;
+      const int Sendj_start = target_locals->j_start.value = redistribute_no_optimization_Send_inline_c_expr28_line_208(__parsec_tp, target_locals); (void)Sendj_start;
+      const int Sendm_Y_start = target_locals->m_Y_start.value = redistribute_no_optimization_Send_inline_c_expr27_line_210(__parsec_tp, target_locals); (void)Sendm_Y_start;
+      const int Sendn_Y_start = target_locals->n_Y_start.value = redistribute_no_optimization_Send_inline_c_expr26_line_211(__parsec_tp, target_locals); (void)Sendn_Y_start;
+      const int Sendm_Y_end = target_locals->m_Y_end.value = redistribute_no_optimization_Send_inline_c_expr25_line_212(__parsec_tp, target_locals); (void)Sendm_Y_end;
+      const int Sendn_Y_end = target_locals->n_Y_end.value = redistribute_no_optimization_Send_inline_c_expr24_line_213(__parsec_tp, target_locals); (void)Sendn_Y_end;
+      const int Sendm_Y = target_locals->m_Y.value = m_Y; (void)Sendm_Y;
+      const int Sendn_Y = target_locals->n_Y.value = n_Y; (void)Sendn_Y;
+      if( (reshape_entry != NULL) && (reshape_entry->data[6] != NULL) ){
+          /* Reshape promise set up on this task repo by predecessor */
+          consumed_repo = reshape_repo;
+          consumed_entry = reshape_entry;
+          consumed_entry_key = reshape_entry_key;
+          consumed_flow_index = 6;
+      }else{
+          /* Consume from predecessor's repo */
+          consumed_repo = Send_repo;
+          consumed_entry_key = __jdf2c_make_key_Send((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)target_locals) ;
+          consumed_entry = data_repo_lookup_entry( consumed_repo, consumed_entry_key );
+          consumed_flow_index = 0;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = PARSEC_redistribute_no_optimization_SOURCE_ADT->arena;
+    data.local.src_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.dst_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 6, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      ACQUIRE_FLOW(this_task, "S", &redistribute_no_optimization_Send, "Y", target_locals, chunk);
+      this_task->data._f_S.data_out = chunk;
+    } 
+    else {
+      /* Data set up by predecessor on this task input flow */
+      consumed_repo = this_task->data._f_S.source_repo;
+      consumed_entry = this_task->data._f_S.source_repo_entry;
+      consumed_entry_key = this_task->data._f_S.source_repo_entry->ht_item.key;
+      if( (reshape_entry != NULL) && (reshape_entry->data[6] != NULL) ){
+          /* Reshape promise set up on input by predecessor is on this task repo */
+          consumed_flow_index = 6;
+          assert( (this_task->data._f_S.source_repo == reshape_repo)
+               && (this_task->data._f_S.source_repo_entry == reshape_entry));
+      }else{
+          /* Reshape promise set up on input by predecessor is the predecesssor task repo */
+          consumed_flow_index = 0;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = PARSEC_redistribute_no_optimization_SOURCE_ADT->arena;
+    data.local.src_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.dst_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 6, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      this_task->data._f_S.data_out = parsec_data_get_copy(chunk->original, target_device);
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+      parsec_prof_grapher_data_input(chunk->original, (parsec_task_t*)this_task, &flow_of_redistribute_no_optimization_Update_for_S, 0);
+#endif
+    }
+    } else {
+    /* Flow S [6] dependency [6] from memory NEW or NULL data */
+    if( NULL == (chunk = this_task->data._f_S.data_in) ) {
+    /* No data set up by predecessor on this task input flow */
+    } 
+    }
+    this_task->data._f_S.data_in     = chunk;
+    this_task->data._f_S.source_repo       = consumed_repo;
+    this_task->data._f_S.source_repo_entry = consumed_entry;
+    if( this_task->data._f_S.source_repo_entry == this_task->repo_entry ){
+      /* in case we have consume from this task repo entry for the flow,
+       * it is cleaned up, avoiding having old stuff during release_deps_of
+       */
+      this_task->repo_entry->data[6] = NULL;
+    }
+    this_task->data._f_S.fulfill = 1;
+}
+
+
+if(! this_task->data._f_W.fulfill ){ /* Flow W */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_W.data_out = NULL;  /* input only */
+    if( (((n_Y) == (n_Y_start) && (m_Y) > (m_Y_start)) && (m_Y) < (m_Y_end)) ) {
+    /* Flow W [7] dependency [7] from predecessor Send */
+    if( NULL == (chunk = this_task->data._f_W.data_in) ) {
+    /* No data set up by predecessor on this task input flow */
+__parsec_redistribute_no_optimization_Send_parsec_assignment_t *target_locals = (__parsec_redistribute_no_optimization_Send_parsec_assignment_t*)&generic_locals;
+      const int Sendbatch_col = target_locals->batch_col.value = batch_col; (void)Sendbatch_col;
+      const int Sendm_T = target_locals->m_T.value = m_T; (void)Sendm_T;
+      const int Sendn_T = target_locals->n_T.value = n_T; (void)Sendn_T;
+      const int Sendmb_T_inner = target_locals->mb_T_inner.value = redistribute_no_optimization_Send_inline_c_expr31_line_204(__parsec_tp, target_locals); (void)Sendmb_T_inner;
+      const int Sendnb_T_inner = target_locals->nb_T_inner.value = redistribute_no_optimization_Send_inline_c_expr30_line_205(__parsec_tp, target_locals); (void)Sendnb_T_inner;
+      const int Sendi_start = target_locals->i_start.value = redistribute_no_optimization_Send_inline_c_expr29_line_207(__parsec_tp, target_locals); (void)Sendi_start;
+      const int Sendj_start = target_locals->j_start.value = redistribute_no_optimization_Send_inline_c_expr28_line_208(__parsec_tp, target_locals); (void)Sendj_start;
+      const int Sendm_Y_start = target_locals->m_Y_start.value = redistribute_no_optimization_Send_inline_c_expr27_line_210(__parsec_tp, target_locals); (void)Sendm_Y_start;
+      const int Sendn_Y_start = target_locals->n_Y_start.value = redistribute_no_optimization_Send_inline_c_expr26_line_211(__parsec_tp, target_locals); (void)Sendn_Y_start;
+      const int Sendm_Y_end = target_locals->m_Y_end.value = redistribute_no_optimization_Send_inline_c_expr25_line_212(__parsec_tp, target_locals); (void)Sendm_Y_end;
+      const int Sendn_Y_end = target_locals->n_Y_end.value = redistribute_no_optimization_Send_inline_c_expr24_line_213(__parsec_tp, target_locals); (void)Sendn_Y_end;
+      const int Sendm_Y = target_locals->m_Y.value = m_Y; (void)Sendm_Y;
+      const int Sendn_Y = target_locals->n_Y.value = n_Y; (void)Sendn_Y;
+      if( (reshape_entry != NULL) && (reshape_entry->data[7] != NULL) ){
+          /* Reshape promise set up on this task repo by predecessor */
+          consumed_repo = reshape_repo;
+          consumed_entry = reshape_entry;
+          consumed_entry_key = reshape_entry_key;
+          consumed_flow_index = 7;
+      }else{
+          /* Consume from predecessor's repo */
+          consumed_repo = Send_repo;
+          consumed_entry_key = __jdf2c_make_key_Send((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)target_locals) ;
+          consumed_entry = data_repo_lookup_entry( consumed_repo, consumed_entry_key );
+          consumed_flow_index = 0;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = PARSEC_redistribute_no_optimization_SOURCE_ADT->arena;
+    data.local.src_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.dst_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 7, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      ACQUIRE_FLOW(this_task, "W", &redistribute_no_optimization_Send, "Y", target_locals, chunk);
+      this_task->data._f_W.data_out = chunk;
+    } 
+    else {
+      /* Data set up by predecessor on this task input flow */
+      consumed_repo = this_task->data._f_W.source_repo;
+      consumed_entry = this_task->data._f_W.source_repo_entry;
+      consumed_entry_key = this_task->data._f_W.source_repo_entry->ht_item.key;
+      if( (reshape_entry != NULL) && (reshape_entry->data[7] != NULL) ){
+          /* Reshape promise set up on input by predecessor is on this task repo */
+          consumed_flow_index = 7;
+          assert( (this_task->data._f_W.source_repo == reshape_repo)
+               && (this_task->data._f_W.source_repo_entry == reshape_entry));
+      }else{
+          /* Reshape promise set up on input by predecessor is the predecesssor task repo */
+          consumed_flow_index = 0;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = PARSEC_redistribute_no_optimization_SOURCE_ADT->arena;
+    data.local.src_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.dst_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 7, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      this_task->data._f_W.data_out = parsec_data_get_copy(chunk->original, target_device);
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+      parsec_prof_grapher_data_input(chunk->original, (parsec_task_t*)this_task, &flow_of_redistribute_no_optimization_Update_for_W, 0);
+#endif
+    }
+    } else {
+    /* Flow W [7] dependency [7] from memory NEW or NULL data */
+    if( NULL == (chunk = this_task->data._f_W.data_in) ) {
+    /* No data set up by predecessor on this task input flow */
+    } 
+    }
+    this_task->data._f_W.data_in     = chunk;
+    this_task->data._f_W.source_repo       = consumed_repo;
+    this_task->data._f_W.source_repo_entry = consumed_entry;
+    if( this_task->data._f_W.source_repo_entry == this_task->repo_entry ){
+      /* in case we have consume from this task repo entry for the flow,
+       * it is cleaned up, avoiding having old stuff during release_deps_of
+       */
+      this_task->repo_entry->data[7] = NULL;
+    }
+    this_task->data._f_W.fulfill = 1;
+}
+
+
+if(! this_task->data._f_E.fulfill ){ /* Flow E */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_E.data_out = NULL;  /* input only */
+    if( ((((n_Y) == (n_Y_end) && (n_Y_start) != (n_Y_end)) && (m_Y) > (m_Y_start)) && (m_Y) < (m_Y_end)) ) {
+    /* Flow E [8] dependency [8] from predecessor Send */
+    if( NULL == (chunk = this_task->data._f_E.data_in) ) {
+    /* No data set up by predecessor on this task input flow */
+__parsec_redistribute_no_optimization_Send_parsec_assignment_t *target_locals = (__parsec_redistribute_no_optimization_Send_parsec_assignment_t*)&generic_locals;
+      const int Sendbatch_col = target_locals->batch_col.value = batch_col; (void)Sendbatch_col;
+      const int Sendm_T = target_locals->m_T.value = m_T; (void)Sendm_T;
+      const int Sendn_T = target_locals->n_T.value = n_T; (void)Sendn_T;
+      const int Sendmb_T_inner = target_locals->mb_T_inner.value = redistribute_no_optimization_Send_inline_c_expr31_line_204(__parsec_tp, target_locals); (void)Sendmb_T_inner;
+      const int Sendnb_T_inner = target_locals->nb_T_inner.value = redistribute_no_optimization_Send_inline_c_expr30_line_205(__parsec_tp, target_locals); (void)Sendnb_T_inner;
+      const int Sendi_start = target_locals->i_start.value = redistribute_no_optimization_Send_inline_c_expr29_line_207(__parsec_tp, target_locals); (void)Sendi_start;
+      const int Sendj_start = target_locals->j_start.value = redistribute_no_optimization_Send_inline_c_expr28_line_208(__parsec_tp, target_locals); (void)Sendj_start;
+      const int Sendm_Y_start = target_locals->m_Y_start.value = redistribute_no_optimization_Send_inline_c_expr27_line_210(__parsec_tp, target_locals); (void)Sendm_Y_start;
+      const int Sendn_Y_start = target_locals->n_Y_start.value = redistribute_no_optimization_Send_inline_c_expr26_line_211(__parsec_tp, target_locals); (void)Sendn_Y_start;
+      const int Sendm_Y_end = target_locals->m_Y_end.value = redistribute_no_optimization_Send_inline_c_expr25_line_212(__parsec_tp, target_locals); (void)Sendm_Y_end;
+      const int Sendn_Y_end = target_locals->n_Y_end.value = redistribute_no_optimization_Send_inline_c_expr24_line_213(__parsec_tp, target_locals); (void)Sendn_Y_end;
+      const int Sendm_Y = target_locals->m_Y.value = m_Y; (void)Sendm_Y;
+      const int Sendn_Y = target_locals->n_Y.value = n_Y; (void)Sendn_Y;
+      if( (reshape_entry != NULL) && (reshape_entry->data[8] != NULL) ){
+          /* Reshape promise set up on this task repo by predecessor */
+          consumed_repo = reshape_repo;
+          consumed_entry = reshape_entry;
+          consumed_entry_key = reshape_entry_key;
+          consumed_flow_index = 8;
+      }else{
+          /* Consume from predecessor's repo */
+          consumed_repo = Send_repo;
+          consumed_entry_key = __jdf2c_make_key_Send((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)target_locals) ;
+          consumed_entry = data_repo_lookup_entry( consumed_repo, consumed_entry_key );
+          consumed_flow_index = 0;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = PARSEC_redistribute_no_optimization_SOURCE_ADT->arena;
+    data.local.src_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.dst_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 8, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      ACQUIRE_FLOW(this_task, "E", &redistribute_no_optimization_Send, "Y", target_locals, chunk);
+      this_task->data._f_E.data_out = chunk;
+    } 
+    else {
+      /* Data set up by predecessor on this task input flow */
+      consumed_repo = this_task->data._f_E.source_repo;
+      consumed_entry = this_task->data._f_E.source_repo_entry;
+      consumed_entry_key = this_task->data._f_E.source_repo_entry->ht_item.key;
+      if( (reshape_entry != NULL) && (reshape_entry->data[8] != NULL) ){
+          /* Reshape promise set up on input by predecessor is on this task repo */
+          consumed_flow_index = 8;
+          assert( (this_task->data._f_E.source_repo == reshape_repo)
+               && (this_task->data._f_E.source_repo_entry == reshape_entry));
+      }else{
+          /* Reshape promise set up on input by predecessor is the predecesssor task repo */
+          consumed_flow_index = 0;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = PARSEC_redistribute_no_optimization_SOURCE_ADT->arena;
+    data.local.src_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.dst_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 8, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      this_task->data._f_E.data_out = parsec_data_get_copy(chunk->original, target_device);
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+      parsec_prof_grapher_data_input(chunk->original, (parsec_task_t*)this_task, &flow_of_redistribute_no_optimization_Update_for_E, 0);
+#endif
+    }
+    } else {
+    /* Flow E [8] dependency [8] from memory NEW or NULL data */
+    if( NULL == (chunk = this_task->data._f_E.data_in) ) {
+    /* No data set up by predecessor on this task input flow */
+    } 
+    }
+    this_task->data._f_E.data_in     = chunk;
+    this_task->data._f_E.source_repo       = consumed_repo;
+    this_task->data._f_E.source_repo_entry = consumed_entry;
+    if( this_task->data._f_E.source_repo_entry == this_task->repo_entry ){
+      /* in case we have consume from this task repo entry for the flow,
+       * it is cleaned up, avoiding having old stuff during release_deps_of
+       */
+      this_task->repo_entry->data[8] = NULL;
+    }
+    this_task->data._f_E.fulfill = 1;
+}
+
+
+if(! this_task->data._f_I.fulfill ){ /* Flow I */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_I.data_out = NULL;  /* input only */
+    if( ((((m_Y) > (m_Y_start) && (m_Y) < (m_Y_end)) && (n_Y) > (n_Y_start)) && (n_Y) < (n_Y_end)) ) {
+    /* Flow I [9] dependency [9] from predecessor Send */
+    if( NULL == (chunk = this_task->data._f_I.data_in) ) {
+    /* No data set up by predecessor on this task input flow */
+__parsec_redistribute_no_optimization_Send_parsec_assignment_t *target_locals = (__parsec_redistribute_no_optimization_Send_parsec_assignment_t*)&generic_locals;
+      const int Sendbatch_col = target_locals->batch_col.value = batch_col; (void)Sendbatch_col;
+      const int Sendm_T = target_locals->m_T.value = m_T; (void)Sendm_T;
+      const int Sendn_T = target_locals->n_T.value = n_T; (void)Sendn_T;
+      const int Sendmb_T_inner = target_locals->mb_T_inner.value = redistribute_no_optimization_Send_inline_c_expr31_line_204(__parsec_tp, target_locals); (void)Sendmb_T_inner;
+      const int Sendnb_T_inner = target_locals->nb_T_inner.value = redistribute_no_optimization_Send_inline_c_expr30_line_205(__parsec_tp, target_locals); (void)Sendnb_T_inner;
+      const int Sendi_start = target_locals->i_start.value = redistribute_no_optimization_Send_inline_c_expr29_line_207(__parsec_tp, target_locals); (void)Sendi_start;
+      const int Sendj_start = target_locals->j_start.value = redistribute_no_optimization_Send_inline_c_expr28_line_208(__parsec_tp, target_locals); (void)Sendj_start;
+      const int Sendm_Y_start = target_locals->m_Y_start.value = redistribute_no_optimization_Send_inline_c_expr27_line_210(__parsec_tp, target_locals); (void)Sendm_Y_start;
+      const int Sendn_Y_start = target_locals->n_Y_start.value = redistribute_no_optimization_Send_inline_c_expr26_line_211(__parsec_tp, target_locals); (void)Sendn_Y_start;
+      const int Sendm_Y_end = target_locals->m_Y_end.value = redistribute_no_optimization_Send_inline_c_expr25_line_212(__parsec_tp, target_locals); (void)Sendm_Y_end;
+      const int Sendn_Y_end = target_locals->n_Y_end.value = redistribute_no_optimization_Send_inline_c_expr24_line_213(__parsec_tp, target_locals); (void)Sendn_Y_end;
+      const int Sendm_Y = target_locals->m_Y.value = m_Y; (void)Sendm_Y;
+      const int Sendn_Y = target_locals->n_Y.value = n_Y; (void)Sendn_Y;
+      if( (reshape_entry != NULL) && (reshape_entry->data[9] != NULL) ){
+          /* Reshape promise set up on this task repo by predecessor */
+          consumed_repo = reshape_repo;
+          consumed_entry = reshape_entry;
+          consumed_entry_key = reshape_entry_key;
+          consumed_flow_index = 9;
+      }else{
+          /* Consume from predecessor's repo */
+          consumed_repo = Send_repo;
+          consumed_entry_key = __jdf2c_make_key_Send((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)target_locals) ;
+          consumed_entry = data_repo_lookup_entry( consumed_repo, consumed_entry_key );
+          consumed_flow_index = 0;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = PARSEC_redistribute_no_optimization_SOURCE_ADT->arena;
+    data.local.src_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.dst_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 9, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      ACQUIRE_FLOW(this_task, "I", &redistribute_no_optimization_Send, "Y", target_locals, chunk);
+      this_task->data._f_I.data_out = chunk;
+    } 
+    else {
+      /* Data set up by predecessor on this task input flow */
+      consumed_repo = this_task->data._f_I.source_repo;
+      consumed_entry = this_task->data._f_I.source_repo_entry;
+      consumed_entry_key = this_task->data._f_I.source_repo_entry->ht_item.key;
+      if( (reshape_entry != NULL) && (reshape_entry->data[9] != NULL) ){
+          /* Reshape promise set up on input by predecessor is on this task repo */
+          consumed_flow_index = 9;
+          assert( (this_task->data._f_I.source_repo == reshape_repo)
+               && (this_task->data._f_I.source_repo_entry == reshape_entry));
+      }else{
+          /* Reshape promise set up on input by predecessor is the predecesssor task repo */
+          consumed_flow_index = 0;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = PARSEC_redistribute_no_optimization_SOURCE_ADT->arena;
+    data.local.src_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.dst_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 9, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      this_task->data._f_I.data_out = parsec_data_get_copy(chunk->original, target_device);
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+      parsec_prof_grapher_data_input(chunk->original, (parsec_task_t*)this_task, &flow_of_redistribute_no_optimization_Update_for_I, 0);
+#endif
+    }
+    } else {
+    /* Flow I [9] dependency [9] from memory NEW or NULL data */
+    if( NULL == (chunk = this_task->data._f_I.data_in) ) {
+    /* No data set up by predecessor on this task input flow */
+    } 
+    }
+    this_task->data._f_I.data_in     = chunk;
+    this_task->data._f_I.source_repo       = consumed_repo;
+    this_task->data._f_I.source_repo_entry = consumed_entry;
+    if( this_task->data._f_I.source_repo_entry == this_task->repo_entry ){
+      /* in case we have consume from this task repo entry for the flow,
+       * it is cleaned up, avoiding having old stuff during release_deps_of
+       */
+      this_task->repo_entry->data[9] = NULL;
+    }
+    this_task->data._f_I.fulfill = 1;
+}
+
+  /* ctl is a control flow */
+  this_task->data._f_ctl.data_in         = NULL;
+  this_task->data._f_ctl.data_out        = NULL;
+  this_task->data._f_ctl.source_repo       = NULL;
+  this_task->data._f_ctl.source_repo_entry = NULL;
+  /** Generate profiling information */
+#if defined(PARSEC_PROF_TRACE)
+  this_task->prof_info.desc = (parsec_data_collection_t*)__parsec_tp->super._g_descT;
+  this_task->prof_info.priority = this_task->priority;
+  this_task->prof_info.data_id   = ((parsec_data_collection_t*)__parsec_tp->super._g_descT)->data_key((parsec_data_collection_t*)__parsec_tp->super._g_descT, m_T, n_T);
+  this_task->prof_info.task_class_id = this_task->task_class->task_class_id;
+  this_task->prof_info.task_return_code = -1;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int datatype_lookup_of_redistribute_no_optimization_Update(parsec_execution_stream_t *es, const parsec_task_t *this_generic_task, const parsec_task_t *parent_task,
+              uint32_t* flow_mask, parsec_dep_data_description_t* data)
+{
+  const __parsec_redistribute_no_optimization_Update_task_t *this_task = (__parsec_redistribute_no_optimization_Update_task_t*)this_generic_task;
+  const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_no_optimization_internal_taskpool_t *)this_task->taskpool;
+  (void)__parsec_tp; (void)es; (void)this_task; (void)data; (void)parent_task;
+  const int batch_col = this_task->locals.batch_col.value; (void)batch_col;
+  const int m_T = this_task->locals.m_T.value; (void)m_T;
+  const int n_T = this_task->locals.n_T.value; (void)n_T;
+  const int mb_T_inner = this_task->locals.mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = this_task->locals.nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = this_task->locals.i_start.value; (void)i_start;
+  const int j_start = this_task->locals.j_start.value; (void)j_start;
+  const int m_Y_start = this_task->locals.m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = this_task->locals.n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = this_task->locals.m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = this_task->locals.n_Y_end.value; (void)n_Y_end;
+  const int m_Y = this_task->locals.m_Y.value; (void)m_Y;
+  const int n_Y = this_task->locals.n_Y.value; (void)n_Y;
+  const int TL_row = this_task->locals.TL_row.value; (void)TL_row;
+  const int TL_col = this_task->locals.TL_col.value; (void)TL_col;
+  const int BR_row = this_task->locals.BR_row.value; (void)BR_row;
+  const int BR_col = this_task->locals.BR_col.value; (void)BR_col;
+  data->local.arena = data->remote.arena = NULL;
+  data->local.src_datatype  = data->local.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->local.src_count     = data->local.dst_count = 0;
+  data->local.src_displ     = data->local.dst_displ = 0;
+  data->data_future  = NULL;
+  if( (*flow_mask) & 0x80000000U ) { /* these are the input dependencies remote datatypes  */
+if( (*flow_mask) & 0x1U ) {  /* Flow T */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_redistribute_no_optimization_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_redistribute_no_optimization_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_redistribute_no_optimization_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+if( (*flow_mask) & 0x2U ) {  /* Flow NW */
+    if( ((*flow_mask) & 0x2U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_redistribute_no_optimization_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_redistribute_no_optimization_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_redistribute_no_optimization_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x2U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x2U) */
+if( (*flow_mask) & 0x4U ) {  /* Flow NE */
+    if( ((*flow_mask) & 0x4U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_redistribute_no_optimization_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_redistribute_no_optimization_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_redistribute_no_optimization_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x4U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x4U) */
+if( (*flow_mask) & 0x8U ) {  /* Flow SW */
+    if( ((*flow_mask) & 0x8U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_redistribute_no_optimization_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_redistribute_no_optimization_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_redistribute_no_optimization_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x8U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x8U) */
+if( (*flow_mask) & 0x10U ) {  /* Flow SE */
+    if( ((*flow_mask) & 0x10U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_redistribute_no_optimization_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_redistribute_no_optimization_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_redistribute_no_optimization_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x10U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x10U) */
+if( (*flow_mask) & 0x20U ) {  /* Flow N */
+    if( ((*flow_mask) & 0x20U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_redistribute_no_optimization_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_redistribute_no_optimization_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_redistribute_no_optimization_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x20U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x20U) */
+if( (*flow_mask) & 0x40U ) {  /* Flow S */
+    if( ((*flow_mask) & 0x40U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_redistribute_no_optimization_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_redistribute_no_optimization_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_redistribute_no_optimization_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x40U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x40U) */
+if( (*flow_mask) & 0x80U ) {  /* Flow W */
+    if( ((*flow_mask) & 0x80U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_redistribute_no_optimization_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_redistribute_no_optimization_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_redistribute_no_optimization_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x80U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x80U) */
+if( (*flow_mask) & 0x100U ) {  /* Flow E */
+    if( ((*flow_mask) & 0x100U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_redistribute_no_optimization_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_redistribute_no_optimization_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_redistribute_no_optimization_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x100U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x100U) */
+if( (*flow_mask) & 0x200U ) {  /* Flow I */
+    if( ((*flow_mask) & 0x200U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_redistribute_no_optimization_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_redistribute_no_optimization_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_redistribute_no_optimization_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x200U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x200U) */
+    goto no_mask_match;
+  }
+
+  /* these are the output dependencies remote datatypes */
+ no_mask_match:
+  data->data                             = NULL;
+  data->remote.src_datatype = data->remote.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->remote.src_count    = data->remote.dst_count = 0;
+  data->remote.src_displ    = data->remote.dst_displ = 0;
+  data->data_future  = NULL;
+  (*flow_mask) = 0;  /* nothing left */
+  (void)batch_col;  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)i_start;  (void)j_start;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;  (void)m_Y;  (void)n_Y;  (void)TL_row;  (void)TL_col;  (void)BR_row;  (void)BR_col;
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+static int hook_of_redistribute_no_optimization_Update(parsec_execution_stream_t *es, __parsec_redistribute_no_optimization_Update_task_t *this_task)
+{
+  __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_no_optimization_internal_taskpool_t *)this_task->taskpool;
+  (void)es; (void)__parsec_tp;
+  const int batch_col = this_task->locals.batch_col.value; (void)batch_col;
+  const int m_T = this_task->locals.m_T.value; (void)m_T;
+  const int n_T = this_task->locals.n_T.value; (void)n_T;
+  const int mb_T_inner = this_task->locals.mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = this_task->locals.nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = this_task->locals.i_start.value; (void)i_start;
+  const int j_start = this_task->locals.j_start.value; (void)j_start;
+  const int m_Y_start = this_task->locals.m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = this_task->locals.n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = this_task->locals.m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = this_task->locals.n_Y_end.value; (void)n_Y_end;
+  const int m_Y = this_task->locals.m_Y.value; (void)m_Y;
+  const int n_Y = this_task->locals.n_Y.value; (void)n_Y;
+  const int TL_row = this_task->locals.TL_row.value; (void)TL_row;
+  const int TL_col = this_task->locals.TL_col.value; (void)TL_col;
+  const int BR_row = this_task->locals.BR_row.value; (void)BR_row;
+  const int BR_col = this_task->locals.BR_col.value; (void)BR_col;
+  (void)batch_col;  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)i_start;  (void)j_start;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;  (void)m_Y;  (void)n_Y;  (void)TL_row;  (void)TL_col;  (void)BR_row;  (void)BR_col;
+
+  /** Declare the variables that will hold the data, and all the accounting for each */
+  parsec_data_copy_t *_f_T = this_task->data._f_T.data_in;
+  void *T = PARSEC_DATA_COPY_GET_PTR(_f_T); (void)T;
+  parsec_data_copy_t *_f_NW = this_task->data._f_NW.data_in;
+  void *NW = PARSEC_DATA_COPY_GET_PTR(_f_NW); (void)NW;
+  parsec_data_copy_t *_f_NE = this_task->data._f_NE.data_in;
+  void *NE = PARSEC_DATA_COPY_GET_PTR(_f_NE); (void)NE;
+  parsec_data_copy_t *_f_SW = this_task->data._f_SW.data_in;
+  void *SW = PARSEC_DATA_COPY_GET_PTR(_f_SW); (void)SW;
+  parsec_data_copy_t *_f_SE = this_task->data._f_SE.data_in;
+  void *SE = PARSEC_DATA_COPY_GET_PTR(_f_SE); (void)SE;
+  parsec_data_copy_t *_f_N = this_task->data._f_N.data_in;
+  void *N = PARSEC_DATA_COPY_GET_PTR(_f_N); (void)N;
+  parsec_data_copy_t *_f_S = this_task->data._f_S.data_in;
+  void *S = PARSEC_DATA_COPY_GET_PTR(_f_S); (void)S;
+  parsec_data_copy_t *_f_W = this_task->data._f_W.data_in;
+  void *W = PARSEC_DATA_COPY_GET_PTR(_f_W); (void)W;
+  parsec_data_copy_t *_f_E = this_task->data._f_E.data_in;
+  void *E = PARSEC_DATA_COPY_GET_PTR(_f_E); (void)E;
+  parsec_data_copy_t *_f_I = this_task->data._f_I.data_in;
+  void *I = PARSEC_DATA_COPY_GET_PTR(_f_I); (void)I;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    data_repo_entry_t *eT = this_task->data._f_T.source_repo_entry;
+    if( (NULL != eT) && (eT->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eT->sim_exec_date;
+    data_repo_entry_t *eNW = this_task->data._f_NW.source_repo_entry;
+    if( (NULL != eNW) && (eNW->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eNW->sim_exec_date;
+    data_repo_entry_t *eNE = this_task->data._f_NE.source_repo_entry;
+    if( (NULL != eNE) && (eNE->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eNE->sim_exec_date;
+    data_repo_entry_t *eSW = this_task->data._f_SW.source_repo_entry;
+    if( (NULL != eSW) && (eSW->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eSW->sim_exec_date;
+    data_repo_entry_t *eSE = this_task->data._f_SE.source_repo_entry;
+    if( (NULL != eSE) && (eSE->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eSE->sim_exec_date;
+    data_repo_entry_t *eN = this_task->data._f_N.source_repo_entry;
+    if( (NULL != eN) && (eN->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eN->sim_exec_date;
+    data_repo_entry_t *eS = this_task->data._f_S.source_repo_entry;
+    if( (NULL != eS) && (eS->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eS->sim_exec_date;
+    data_repo_entry_t *eW = this_task->data._f_W.source_repo_entry;
+    if( (NULL != eW) && (eW->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eW->sim_exec_date;
+    data_repo_entry_t *eE = this_task->data._f_E.source_repo_entry;
+    if( (NULL != eE) && (eE->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eE->sim_exec_date;
+    data_repo_entry_t *eI = this_task->data._f_I.source_repo_entry;
+    if( (NULL != eI) && (eI->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eI->sim_exec_date;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+  /** Cache Awareness Accounting */
+#if defined(PARSEC_CACHE_AWARENESS)
+  cache_buf_referenced(es->closest_cache, T);
+  cache_buf_referenced(es->closest_cache, NW);
+  cache_buf_referenced(es->closest_cache, NE);
+  cache_buf_referenced(es->closest_cache, SW);
+  cache_buf_referenced(es->closest_cache, SE);
+  cache_buf_referenced(es->closest_cache, N);
+  cache_buf_referenced(es->closest_cache, S);
+  cache_buf_referenced(es->closest_cache, W);
+  cache_buf_referenced(es->closest_cache, E);
+  cache_buf_referenced(es->closest_cache, I);
+#endif /* PARSEC_CACHE_AWARENESS */
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                                  Update BODY                                  -----*/
+
+{
+    int offset_row = (m_T == m_T_START)? disi_T % mb_T_INNER + R: R;
+    int offset_col = (n_T == n_T_START)? disj_T % nb_T_INNER + R: R;
+
+    CORE_redistribute_no_optimization_update(T, NW, NE, SW, SE, N, S, W, E, I, R, TL_row, TL_col, BR_row, BR_col, m_Y_start, m_Y_end, n_Y_start,
+                               n_Y_end, m_Y, n_Y, i_start, j_start, descT->mb, mb_Y_INNER, nb_Y_INNER, offset_row, offset_col);
+}
+
+/*-----                              END OF Update BODY                              -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#endif  /*  defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+static int complete_hook_of_redistribute_no_optimization_Update(parsec_execution_stream_t *es, __parsec_redistribute_no_optimization_Update_task_t *this_task)
+{
+  const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_no_optimization_internal_taskpool_t *)this_task->taskpool;
+#if defined(DISTRIBUTED)
+    const int batch_col = this_task->locals.batch_col.value; (void)batch_col;
+  const int m_T = this_task->locals.m_T.value; (void)m_T;
+  const int n_T = this_task->locals.n_T.value; (void)n_T;
+  const int mb_T_inner = this_task->locals.mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = this_task->locals.nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = this_task->locals.i_start.value; (void)i_start;
+  const int j_start = this_task->locals.j_start.value; (void)j_start;
+  const int m_Y_start = this_task->locals.m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = this_task->locals.n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = this_task->locals.m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = this_task->locals.n_Y_end.value; (void)n_Y_end;
+  const int m_Y = this_task->locals.m_Y.value; (void)m_Y;
+  const int n_Y = this_task->locals.n_Y.value; (void)n_Y;
+  const int TL_row = this_task->locals.TL_row.value; (void)TL_row;
+  const int TL_col = this_task->locals.TL_col.value; (void)TL_col;
+  const int BR_row = this_task->locals.BR_row.value; (void)BR_row;
+  const int BR_col = this_task->locals.BR_col.value; (void)BR_col;
+#endif  /* defined(DISTRIBUTED) */
+  (void)es; (void)__parsec_tp;
+parsec_data_t* data_t_desc = NULL; (void)data_t_desc;
+#if defined(DISTRIBUTED)
+  /** If not working on distributed, there is no risk that data is not in place */
+  (void)batch_col;  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)i_start;  (void)j_start;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;  (void)m_Y;  (void)n_Y;  (void)TL_row;  (void)TL_col;  (void)BR_row;  (void)BR_col;
+
+#endif /* DISTRIBUTED */
+#if defined(PARSEC_PROF_GRAPHER)
+  parsec_prof_grapher_task((parsec_task_t*)this_task, es->th_id, es->virtual_process->vp_id,
+     __jdf2c_key_fns_Update.key_hash(this_task->task_class->make_key( (parsec_taskpool_t*)this_task->taskpool, ((parsec_task_t*)this_task)->locals), NULL));
+#endif  /* defined(PARSEC_PROF_GRAPHER) */
+  release_deps_of_redistribute_no_optimization_Update(es, this_task,
+      PARSEC_ACTION_RELEASE_REMOTE_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_REFS |
+      PARSEC_ACTION_RESHAPE_ON_RELEASE |
+      0x1,  /* mask of all dep_index */ 
+      NULL);
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static parsec_hook_return_t release_task_of_redistribute_no_optimization_Update(parsec_execution_stream_t *es, parsec_task_t *this_task)
+{
+    const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp =
+        (const __parsec_redistribute_no_optimization_internal_taskpool_t *)this_task->taskpool;
+    parsec_hash_table_t *ht = (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[2];
+    parsec_key_t key = this_task->task_class->make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals);
+    parsec_hashable_dependency_t *hash_dep = (parsec_hashable_dependency_t *)parsec_hash_table_remove(ht, key);
+    parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);
+    return parsec_release_task_to_mempool_update_nbtasks(es, this_task);
+}
+
+static char *redistribute_no_optimization_redistribute_no_optimization_Update_internal_init_deps_key_functions_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_no_optimization_internal_taskpool_t *)user_data;
+  __parsec_redistribute_no_optimization_Update_parsec_assignment_t __jdf2c__assignments = {  .batch_col.value = 0, .m_T.value = 0, .n_T.value = 0, .mb_T_inner.value = 0, .nb_T_inner.value = 0, .i_start.value = 0, .j_start.value = 0, .m_Y_start.value = 0, .n_Y_start.value = 0, .m_Y_end.value = 0, .n_Y_end.value = 0, .m_Y.value = 0, .n_Y.value = 0, .TL_row.value = 0, .TL_col.value = 0, .BR_row.value = 0, .BR_col.value = 0 };
+  int batch_col = (__parsec_key) % __parsec_tp->Update_batch_col_range + __parsec_tp->Update_batch_col_min;
+  __parsec_key = __parsec_key / __parsec_tp->Update_batch_col_range;
+  __jdf2c__assignments.batch_col.value = batch_col;
+  int m_T = (__parsec_key) % __parsec_tp->Update_m_T_range + __parsec_tp->Update_m_T_min;
+  __parsec_key = __parsec_key / __parsec_tp->Update_m_T_range;
+  __jdf2c__assignments.m_T.value = m_T;
+  int n_T = (__parsec_key) % __parsec_tp->Update_n_T_range + __parsec_tp->Update_n_T_min;
+  __parsec_key = __parsec_key / __parsec_tp->Update_n_T_range;
+  __jdf2c__assignments.n_T.value = n_T;
+  int mb_T_inner = redistribute_no_optimization_Update_inline_c_expr21_line_251(__parsec_tp, &__jdf2c__assignments);
+  (void)mb_T_inner;
+  __jdf2c__assignments.mb_T_inner.value = mb_T_inner;
+  int nb_T_inner = redistribute_no_optimization_Update_inline_c_expr20_line_252(__parsec_tp, &__jdf2c__assignments);
+  (void)nb_T_inner;
+  __jdf2c__assignments.nb_T_inner.value = nb_T_inner;
+  int i_start = redistribute_no_optimization_Update_inline_c_expr19_line_254(__parsec_tp, &__jdf2c__assignments);
+  (void)i_start;
+  __jdf2c__assignments.i_start.value = i_start;
+  int j_start = redistribute_no_optimization_Update_inline_c_expr18_line_255(__parsec_tp, &__jdf2c__assignments);
+  (void)j_start;
+  __jdf2c__assignments.j_start.value = j_start;
+  int m_Y_start = redistribute_no_optimization_Update_inline_c_expr17_line_257(__parsec_tp, &__jdf2c__assignments);
+  (void)m_Y_start;
+  __jdf2c__assignments.m_Y_start.value = m_Y_start;
+  int n_Y_start = redistribute_no_optimization_Update_inline_c_expr16_line_258(__parsec_tp, &__jdf2c__assignments);
+  (void)n_Y_start;
+  __jdf2c__assignments.n_Y_start.value = n_Y_start;
+  int m_Y_end = redistribute_no_optimization_Update_inline_c_expr15_line_259(__parsec_tp, &__jdf2c__assignments);
+  (void)m_Y_end;
+  __jdf2c__assignments.m_Y_end.value = m_Y_end;
+  int n_Y_end = redistribute_no_optimization_Update_inline_c_expr14_line_260(__parsec_tp, &__jdf2c__assignments);
+  (void)n_Y_end;
+  __jdf2c__assignments.n_Y_end.value = n_Y_end;
+  int m_Y = (__parsec_key) % __parsec_tp->Update_m_Y_range + __parsec_tp->Update_m_Y_min;
+  __parsec_key = __parsec_key / __parsec_tp->Update_m_Y_range;
+  __jdf2c__assignments.m_Y.value = m_Y;
+  int n_Y = (__parsec_key) % __parsec_tp->Update_n_Y_range + __parsec_tp->Update_n_Y_min;
+  __parsec_key = __parsec_key / __parsec_tp->Update_n_Y_range;
+  __jdf2c__assignments.n_Y.value = n_Y;
+  int TL_row = redistribute_no_optimization_Update_inline_c_expr13_line_265(__parsec_tp, &__jdf2c__assignments);
+  (void)TL_row;
+  __jdf2c__assignments.TL_row.value = TL_row;
+  int TL_col = redistribute_no_optimization_Update_inline_c_expr12_line_266(__parsec_tp, &__jdf2c__assignments);
+  (void)TL_col;
+  __jdf2c__assignments.TL_col.value = TL_col;
+  int BR_row = ((((i_start + mb_T_inner) - 1) % mb_Y_INNER) + 1);
+  (void)BR_row;
+  __jdf2c__assignments.BR_row.value = BR_row;
+  int BR_col = ((((j_start + nb_T_inner) - 1) % nb_Y_INNER) + 1);
+  (void)BR_col;
+  __jdf2c__assignments.BR_col.value = BR_col;
+  (void)__jdf2c__assignments;
+  snprintf(buffer, buffer_size, "Update(%d, %d, %d, %d, %d)", batch_col, m_T, n_T, m_Y, n_Y);
+  return buffer;
+}
+
+static parsec_key_fn_t redistribute_no_optimization_redistribute_no_optimization_Update_internal_init_deps_key_functions = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = redistribute_no_optimization_redistribute_no_optimization_Update_internal_init_deps_key_functions_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/* Needs: min-max count-tasks iterate */
+static int redistribute_no_optimization_Update_internal_init(parsec_execution_stream_t * es, __parsec_redistribute_no_optimization_Update_task_t * this_task)
+{
+  __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_no_optimization_internal_taskpool_t*)this_task->taskpool;
+  int32_t nb_tasks = 0, saved_nb_tasks = 0;
+int32_t __batch_col_min = 0x7fffffff, __batch_col_max = 0;int32_t __jdf2c_batch_col_min = 0x7fffffff, __jdf2c_batch_col_max = 0;int32_t __m_T_min = 0x7fffffff, __m_T_max = 0;int32_t __jdf2c_m_T_min = 0x7fffffff, __jdf2c_m_T_max = 0;int32_t __n_T_min = 0x7fffffff, __n_T_max = 0;int32_t __jdf2c_n_T_min = 0x7fffffff, __jdf2c_n_T_max = 0;int32_t __m_Y_min = 0x7fffffff, __m_Y_max = 0;int32_t __jdf2c_m_Y_min = 0x7fffffff, __jdf2c_m_Y_max = 0;int32_t __n_Y_min = 0x7fffffff, __n_Y_max = 0;int32_t __jdf2c_n_Y_min = 0x7fffffff, __jdf2c_n_Y_max = 0;  __parsec_redistribute_no_optimization_Update_parsec_assignment_t assignments = {  .batch_col.value = 0, .m_T.value = 0, .n_T.value = 0, .mb_T_inner.value = 0, .nb_T_inner.value = 0, .i_start.value = 0, .j_start.value = 0, .m_Y_start.value = 0, .n_Y_start.value = 0, .m_Y_end.value = 0, .n_Y_end.value = 0, .m_Y.value = 0, .n_Y.value = 0, .TL_row.value = 0, .TL_col.value = 0, .BR_row.value = 0, .BR_col.value = 0 };
+  int32_t  batch_col,  m_T,  n_T,  mb_T_inner,  nb_T_inner,  i_start,  j_start,  m_Y_start,  n_Y_start,  m_Y_end,  n_Y_end,  m_Y,  n_Y,  TL_row,  TL_col,  BR_row,  BR_col;
+  int32_t __jdf2c_batch_col_start, __jdf2c_batch_col_end, __jdf2c_batch_col_inc;
+  int32_t __jdf2c_m_T_start, __jdf2c_m_T_end, __jdf2c_m_T_inc;
+  int32_t __jdf2c_n_T_start, __jdf2c_n_T_end, __jdf2c_n_T_inc;
+  int32_t __jdf2c_m_Y_start, __jdf2c_m_Y_end, __jdf2c_m_Y_inc;
+  int32_t __jdf2c_n_Y_start, __jdf2c_n_Y_end, __jdf2c_n_Y_inc;
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+  PARSEC_PROFILING_TRACE(es->es_profile,
+                         this_task->taskpool->profiling_array[START_KEY(this_task->task_class->task_class_id)],
+                         0,
+                         this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    __jdf2c_batch_col_start = 0;
+    __jdf2c_batch_col_end = NT;
+    __jdf2c_batch_col_inc = 1;
+    __batch_col_min = parsec_imin(__jdf2c_batch_col_start, __jdf2c_batch_col_end);
+    __batch_col_max = parsec_imax(__jdf2c_batch_col_start, __jdf2c_batch_col_end);
+    __jdf2c_batch_col_min = parsec_imin(__jdf2c_batch_col_min, __batch_col_min);
+    __jdf2c_batch_col_max = parsec_imax(__jdf2c_batch_col_max, __batch_col_max);
+    for(batch_col =  __jdf2c_batch_col_start;
+        batch_col <= __jdf2c_batch_col_end;
+        batch_col += __jdf2c_batch_col_inc) {
+    assignments.batch_col.value = batch_col;
+      __jdf2c_m_T_start = m_T_START;
+      __jdf2c_m_T_end = m_T_END;
+      __jdf2c_m_T_inc = 1;
+      __m_T_min = parsec_imin(__jdf2c_m_T_start, __jdf2c_m_T_end);
+      __m_T_max = parsec_imax(__jdf2c_m_T_start, __jdf2c_m_T_end);
+      __jdf2c_m_T_min = parsec_imin(__jdf2c_m_T_min, __m_T_min);
+      __jdf2c_m_T_max = parsec_imax(__jdf2c_m_T_max, __m_T_max);
+      for(m_T =  __jdf2c_m_T_start;
+          m_T <= __jdf2c_m_T_end;
+          m_T += __jdf2c_m_T_inc) {
+      assignments.m_T.value = m_T;
+        __jdf2c_n_T_start = redistribute_no_optimization_Update_inline_c_expr23_line_249(__parsec_tp, &assignments);
+        __jdf2c_n_T_end = redistribute_no_optimization_Update_inline_c_expr22_line_249(__parsec_tp, &assignments);
+        __jdf2c_n_T_inc = 1;
+        __n_T_min = parsec_imin(__jdf2c_n_T_start, __jdf2c_n_T_end);
+        __n_T_max = parsec_imax(__jdf2c_n_T_start, __jdf2c_n_T_end);
+        __jdf2c_n_T_min = parsec_imin(__jdf2c_n_T_min, __n_T_min);
+        __jdf2c_n_T_max = parsec_imax(__jdf2c_n_T_max, __n_T_max);
+        for(n_T =  __jdf2c_n_T_start;
+            n_T <= __jdf2c_n_T_end;
+            n_T += __jdf2c_n_T_inc) {
+        assignments.n_T.value = n_T;
+      {  /* block for the non-range variable mb_T_inner */
+          mb_T_inner = redistribute_no_optimization_Update_inline_c_expr21_line_251(__parsec_tp, &assignments);
+          assignments.mb_T_inner.value = mb_T_inner;
+        {  /* block for the non-range variable nb_T_inner */
+            nb_T_inner = redistribute_no_optimization_Update_inline_c_expr20_line_252(__parsec_tp, &assignments);
+            assignments.nb_T_inner.value = nb_T_inner;
+          {  /* block for the non-range variable i_start */
+              i_start = redistribute_no_optimization_Update_inline_c_expr19_line_254(__parsec_tp, &assignments);
+              assignments.i_start.value = i_start;
+            {  /* block for the non-range variable j_start */
+                j_start = redistribute_no_optimization_Update_inline_c_expr18_line_255(__parsec_tp, &assignments);
+                assignments.j_start.value = j_start;
+              {  /* block for the non-range variable m_Y_start */
+                  m_Y_start = redistribute_no_optimization_Update_inline_c_expr17_line_257(__parsec_tp, &assignments);
+                  assignments.m_Y_start.value = m_Y_start;
+                {  /* block for the non-range variable n_Y_start */
+                    n_Y_start = redistribute_no_optimization_Update_inline_c_expr16_line_258(__parsec_tp, &assignments);
+                    assignments.n_Y_start.value = n_Y_start;
+                  {  /* block for the non-range variable m_Y_end */
+                      m_Y_end = redistribute_no_optimization_Update_inline_c_expr15_line_259(__parsec_tp, &assignments);
+                      assignments.m_Y_end.value = m_Y_end;
+                    {  /* block for the non-range variable n_Y_end */
+                        n_Y_end = redistribute_no_optimization_Update_inline_c_expr14_line_260(__parsec_tp, &assignments);
+                        assignments.n_Y_end.value = n_Y_end;
+                          __jdf2c_m_Y_start = m_Y_start;
+                          __jdf2c_m_Y_end = m_Y_end;
+                          __jdf2c_m_Y_inc = 1;
+                          __m_Y_min = parsec_imin(__jdf2c_m_Y_start, __jdf2c_m_Y_end);
+                          __m_Y_max = parsec_imax(__jdf2c_m_Y_start, __jdf2c_m_Y_end);
+                          __jdf2c_m_Y_min = parsec_imin(__jdf2c_m_Y_min, __m_Y_min);
+                          __jdf2c_m_Y_max = parsec_imax(__jdf2c_m_Y_max, __m_Y_max);
+                          for(m_Y =  __jdf2c_m_Y_start;
+                              m_Y <= __jdf2c_m_Y_end;
+                              m_Y += __jdf2c_m_Y_inc) {
+                          assignments.m_Y.value = m_Y;
+                            __jdf2c_n_Y_start = n_Y_start;
+                            __jdf2c_n_Y_end = n_Y_end;
+                            __jdf2c_n_Y_inc = 1;
+                            __n_Y_min = parsec_imin(__jdf2c_n_Y_start, __jdf2c_n_Y_end);
+                            __n_Y_max = parsec_imax(__jdf2c_n_Y_start, __jdf2c_n_Y_end);
+                            __jdf2c_n_Y_min = parsec_imin(__jdf2c_n_Y_min, __n_Y_min);
+                            __jdf2c_n_Y_max = parsec_imax(__jdf2c_n_Y_max, __n_Y_max);
+                            for(n_Y =  __jdf2c_n_Y_start;
+                                n_Y <= __jdf2c_n_Y_end;
+                                n_Y += __jdf2c_n_Y_inc) {
+                            assignments.n_Y.value = n_Y;
+                          {  /* block for the non-range variable TL_row */
+                              TL_row = redistribute_no_optimization_Update_inline_c_expr13_line_265(__parsec_tp, &assignments);
+                              assignments.TL_row.value = TL_row;
+                            {  /* block for the non-range variable TL_col */
+                                TL_col = redistribute_no_optimization_Update_inline_c_expr12_line_266(__parsec_tp, &assignments);
+                                assignments.TL_col.value = TL_col;
+                              {  /* block for the non-range variable BR_row */
+                                  BR_row = ((((i_start + mb_T_inner) - 1) % mb_Y_INNER) + 1);
+                                  assignments.BR_row.value = BR_row;
+                                {  /* block for the non-range variable BR_col */
+                                    BR_col = ((((j_start + nb_T_inner) - 1) % nb_Y_INNER) + 1);
+                                    assignments.BR_col.value = BR_col;
+                                    if( !Update_pred(batch_col, m_T, n_T, mb_T_inner, nb_T_inner, i_start, j_start, m_Y_start, n_Y_start, m_Y_end, n_Y_end, m_Y, n_Y, TL_row, TL_col, BR_row, BR_col) ) continue;
+                                    nb_tasks++;
+                                  } /* block for the non-range variable BR_col */ 
+                                } /* block for the non-range variable BR_row */ 
+                              } /* block for the non-range variable TL_col */ 
+                            } /* block for the non-range variable TL_row */ 
+                          } /* Loop on normal range n_Y */
+                        } /* For loop of m_Y */ 
+                      } /* Non-range variable n_Y_end */ 
+                    } /* Non-range variable m_Y_end */ 
+                  } /* Non-range variable n_Y_start */ 
+                } /* Non-range variable m_Y_start */ 
+              } /* Non-range variable j_start */ 
+            } /* Non-range variable i_start */ 
+          } /* Non-range variable nb_T_inner */ 
+        } /* Non-range variable mb_T_inner */ 
+      } /* For loop of n_T */ 
+    } /* For loop of m_T */ 
+  } /* For loop of batch_col */ 
+   if( 0 != nb_tasks ) {
+     (void)parsec_atomic_fetch_add_int32(&__parsec_tp->initial_number_tasks, nb_tasks);
+   }
+  /* Set the range variables for the collision-free hash-computation */
+  __parsec_tp->Update_batch_col_min   = __jdf2c_batch_col_min;
+  __parsec_tp->Update_batch_col_range = (__jdf2c_batch_col_max - __jdf2c_batch_col_min) + 1;
+  __parsec_tp->Update_m_T_min   = __jdf2c_m_T_min;
+  __parsec_tp->Update_m_T_range = (__jdf2c_m_T_max - __jdf2c_m_T_min) + 1;
+  __parsec_tp->Update_n_T_min   = __jdf2c_n_T_min;
+  __parsec_tp->Update_n_T_range = (__jdf2c_n_T_max - __jdf2c_n_T_min) + 1;
+  __parsec_tp->Update_m_Y_min   = __jdf2c_m_Y_min;
+  __parsec_tp->Update_m_Y_range = (__jdf2c_m_Y_max - __jdf2c_m_Y_min) + 1;
+  __parsec_tp->Update_n_Y_min   = __jdf2c_n_Y_min;
+  __parsec_tp->Update_n_Y_range = (__jdf2c_n_Y_max - __jdf2c_n_Y_min) + 1;
+  this_task->status = PARSEC_TASK_STATUS_COMPLETE;
+
+  PARSEC_AYU_REGISTER_TASK(&redistribute_no_optimization_Update);
+  __parsec_tp->super.super.dependencies_array[2] = PARSEC_OBJ_NEW(parsec_hash_table_t);
+  parsec_hash_table_init(__parsec_tp->super.super.dependencies_array[2], offsetof(parsec_hashable_dependency_t, ht_item), 10, redistribute_no_optimization_redistribute_no_optimization_Update_internal_init_deps_key_functions, this_task->taskpool);
+  __parsec_tp->repositories[2] = data_repo_create_nothreadsafe(nb_tasks, __jdf2c_key_fns_Update, (parsec_taskpool_t*)__parsec_tp, 11);
+(void)saved_nb_tasks;
+(void)__batch_col_min; (void)__batch_col_max;(void)__m_T_min; (void)__m_T_max;(void)__n_T_min; (void)__n_T_max;(void)__m_Y_min; (void)__m_Y_max;(void)__n_Y_min; (void)__n_Y_max;  (void)__jdf2c_batch_col_start; (void)__jdf2c_batch_col_end; (void)__jdf2c_batch_col_inc;  (void)__jdf2c_m_T_start; (void)__jdf2c_m_T_end; (void)__jdf2c_m_T_inc;  (void)__jdf2c_n_T_start; (void)__jdf2c_n_T_end; (void)__jdf2c_n_T_inc;  (void)__jdf2c_m_Y_start; (void)__jdf2c_m_Y_end; (void)__jdf2c_m_Y_inc;  (void)__jdf2c_n_Y_start; (void)__jdf2c_n_Y_end; (void)__jdf2c_n_Y_inc;  (void)assignments; (void)__parsec_tp; (void)es;
+  if(1 == parsec_atomic_fetch_dec_int32(&__parsec_tp->sync_point)) {
+    /* Last initialization task complete. Update the number of tasks. */
+    __parsec_tp->super.super.tdm.module->taskpool_addto_nb_tasks(&__parsec_tp->super.super, __parsec_tp->initial_number_tasks);
+    parsec_mfence();  /* write memory barrier to guarantee that the scheduler gets the correct number of tasks */
+    parsec_taskpool_enable((parsec_taskpool_t*)__parsec_tp, &__parsec_tp->startup_queue,
+                           (parsec_task_t*)this_task, es, __parsec_tp->super.super.nb_pending_actions);
+    __parsec_tp->super.super.tdm.module->taskpool_ready(&__parsec_tp->super.super);
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+    PARSEC_PROFILING_TRACE(es->es_profile,
+                           this_task->taskpool->profiling_array[2 * this_task->task_class->task_class_id + 1],
+                           0,
+                           this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    return PARSEC_HOOK_RETURN_DONE;
+  }
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static const __parsec_chore_t __redistribute_no_optimization_Update_chores[] ={
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+    { .type     = PARSEC_DEV_CPU,
+      .evaluate = (parsec_evaluate_function_t*)NULL,
+      .hook     = (parsec_hook_t*)hook_of_redistribute_no_optimization_Update },
+#endif  /* defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+    { .type     = PARSEC_DEV_NONE,
+      .evaluate = NULL,
+      .hook     = (parsec_hook_t*)NULL },  /* End marker */
+};
+
+static const parsec_task_class_t redistribute_no_optimization_Update = {
+  .name = "Update",
+  .task_class_id = 2,
+  .nb_flows = 11,
+  .nb_parameters = 5,
+  .nb_locals = 17,
+  .task_class_type = PARSEC_TASK_CLASS_TYPE_PTG,
+  .params = { &symb_redistribute_no_optimization_Update_m_Y, &symb_redistribute_no_optimization_Update_n_Y, &symb_redistribute_no_optimization_Update_m_T, &symb_redistribute_no_optimization_Update_n_T, &symb_redistribute_no_optimization_Update_batch_col, NULL },
+  .locals = { &symb_redistribute_no_optimization_Update_batch_col, &symb_redistribute_no_optimization_Update_m_T, &symb_redistribute_no_optimization_Update_n_T, &symb_redistribute_no_optimization_Update_mb_T_inner, &symb_redistribute_no_optimization_Update_nb_T_inner, &symb_redistribute_no_optimization_Update_i_start, &symb_redistribute_no_optimization_Update_j_start, &symb_redistribute_no_optimization_Update_m_Y_start, &symb_redistribute_no_optimization_Update_n_Y_start, &symb_redistribute_no_optimization_Update_m_Y_end, &symb_redistribute_no_optimization_Update_n_Y_end, &symb_redistribute_no_optimization_Update_m_Y, &symb_redistribute_no_optimization_Update_n_Y, &symb_redistribute_no_optimization_Update_TL_row, &symb_redistribute_no_optimization_Update_TL_col, &symb_redistribute_no_optimization_Update_BR_row, &symb_redistribute_no_optimization_Update_BR_col, NULL },
+  .data_affinity = (parsec_data_ref_fn_t*)affinity_of_redistribute_no_optimization_Update,
+  .initial_data = (parsec_data_ref_fn_t*)affinity_of_redistribute_no_optimization_Update,
+  .final_data = (parsec_data_ref_fn_t*)affinity_of_redistribute_no_optimization_Update,
+  .priority = NULL,
+  .properties = properties_of_redistribute_no_optimization_Update,
+#if MAX_PARAM_COUNT < 10  /* number of read flows of Update */
+  #error Too many read flows for task Update
+#endif  /* MAX_PARAM_COUNT */
+#if MAX_PARAM_COUNT < 0  /* number of write flows of Update */
+  #error Too many write flows for task Update
+#endif  /* MAX_PARAM_COUNT */
+  .in = { &flow_of_redistribute_no_optimization_Update_for_T, &flow_of_redistribute_no_optimization_Update_for_NW, &flow_of_redistribute_no_optimization_Update_for_NE, &flow_of_redistribute_no_optimization_Update_for_SW, &flow_of_redistribute_no_optimization_Update_for_SE, &flow_of_redistribute_no_optimization_Update_for_N, &flow_of_redistribute_no_optimization_Update_for_S, &flow_of_redistribute_no_optimization_Update_for_W, &flow_of_redistribute_no_optimization_Update_for_E, &flow_of_redistribute_no_optimization_Update_for_I, NULL },
+  .out = { &flow_of_redistribute_no_optimization_Update_for_ctl, NULL },
+  .flags = 0x0 | PARSEC_HAS_IN_IN_DEPENDENCIES | PARSEC_USE_DEPS_MASK,
+  .dependencies_goal = 0x3ff,
+  .make_key = __jdf2c_make_key_Update,
+  .task_snprintf = parsec_task_snprintf,
+#if defined(PARSEC_PROF_TRACE)
+  .profile_info = &parsec_task_profile_info,
+#endif
+  .key_functions = &__jdf2c_key_fns_Update,
+  .fini = (parsec_hook_t*)NULL,
+  .incarnations = __redistribute_no_optimization_Update_chores,
+  .find_deps = parsec_hash_find_deps,
+  .update_deps = parsec_update_deps_with_mask,
+  .iterate_successors = (parsec_traverse_function_t*)iterate_successors_of_redistribute_no_optimization_Update,
+  .iterate_predecessors = (parsec_traverse_function_t*)iterate_predecessors_of_redistribute_no_optimization_Update,
+  .release_deps = (parsec_release_deps_t*)release_deps_of_redistribute_no_optimization_Update,
+  .prepare_output = (parsec_hook_t*)NULL,
+  .prepare_input = (parsec_hook_t*)data_lookup_of_redistribute_no_optimization_Update,
+  .time_estimate = NULL,
+  .get_datatype = datatype_lookup_of_redistribute_no_optimization_Update,
+  .complete_execution = (parsec_hook_t*)complete_hook_of_redistribute_no_optimization_Update,
+  .release_task = &release_task_of_redistribute_no_optimization_Update,
+#if defined(PARSEC_SIM)
+  .sim_cost_fct = (parsec_sim_cost_fct_t*)NULL,
+#endif
+};
+
+
+/******                                      Send                                      ******/
+
+static inline int32_t minexpr_of_symb_redistribute_no_optimization_Send_batch_col_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Send_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_redistribute_no_optimization_Send_batch_col = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_redistribute_no_optimization_Send_batch_col_fct }
+                   }
+};
+static inline int maxexpr_of_symb_redistribute_no_optimization_Send_batch_col_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Send_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int mb_T_inner = locals->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = locals->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int m_Y_start = locals->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = locals->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = locals->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = locals->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+
+  (void)batch_col;
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)i_start;
+  (void)j_start;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)m_Y;
+  (void)n_Y;
+  (void)__parsec_tp; (void)locals;
+  return NT;
+}
+static const parsec_expr_t maxexpr_of_symb_redistribute_no_optimization_Send_batch_col = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_redistribute_no_optimization_Send_batch_col_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_no_optimization_Send_batch_col = { .name = "batch_col", .context_index = 0, .min = &minexpr_of_symb_redistribute_no_optimization_Send_batch_col, .max = &maxexpr_of_symb_redistribute_no_optimization_Send_batch_col, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int minexpr_of_symb_redistribute_no_optimization_Send_m_T_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Send_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int mb_T_inner = locals->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = locals->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int m_Y_start = locals->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = locals->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = locals->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = locals->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+
+  (void)batch_col;
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)i_start;
+  (void)j_start;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)m_Y;
+  (void)n_Y;
+  (void)__parsec_tp; (void)locals;
+  return m_T_START;
+}
+static const parsec_expr_t minexpr_of_symb_redistribute_no_optimization_Send_m_T = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_redistribute_no_optimization_Send_m_T_fct }
+                   }
+};
+static inline int maxexpr_of_symb_redistribute_no_optimization_Send_m_T_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Send_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int mb_T_inner = locals->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = locals->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int m_Y_start = locals->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = locals->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = locals->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = locals->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+
+  (void)batch_col;
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)i_start;
+  (void)j_start;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)m_Y;
+  (void)n_Y;
+  (void)__parsec_tp; (void)locals;
+  return m_T_END;
+}
+static const parsec_expr_t maxexpr_of_symb_redistribute_no_optimization_Send_m_T = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_redistribute_no_optimization_Send_m_T_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_no_optimization_Send_m_T = { .name = "m_T", .context_index = 1, .min = &minexpr_of_symb_redistribute_no_optimization_Send_m_T, .max = &maxexpr_of_symb_redistribute_no_optimization_Send_m_T, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int32_t minexpr_of_symb_redistribute_no_optimization_Send_n_T_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Send_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_no_optimization_Send_inline_c_expr33_line_202(__parsec_tp, locals);
+}
+static const parsec_expr_t minexpr_of_symb_redistribute_no_optimization_Send_n_T = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_redistribute_no_optimization_Send_n_T_fct }
+                   }
+};
+static inline int32_t maxexpr_of_symb_redistribute_no_optimization_Send_n_T_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Send_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_no_optimization_Send_inline_c_expr32_line_202(__parsec_tp, locals);
+}
+static const parsec_expr_t maxexpr_of_symb_redistribute_no_optimization_Send_n_T = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_redistribute_no_optimization_Send_n_T_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_no_optimization_Send_n_T = { .name = "n_T", .context_index = 2, .min = &minexpr_of_symb_redistribute_no_optimization_Send_n_T, .max = &maxexpr_of_symb_redistribute_no_optimization_Send_n_T, .cst_inc = 1, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_redistribute_no_optimization_Send_mb_T_inner_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Send_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_no_optimization_Send_inline_c_expr31_line_204(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_redistribute_no_optimization_Send_mb_T_inner = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_no_optimization_Send_mb_T_inner_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_no_optimization_Send_mb_T_inner = { .name = "mb_T_inner", .context_index = 3, .min = &expr_of_symb_redistribute_no_optimization_Send_mb_T_inner, .max = &expr_of_symb_redistribute_no_optimization_Send_mb_T_inner, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_redistribute_no_optimization_Send_nb_T_inner_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Send_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_no_optimization_Send_inline_c_expr30_line_205(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_redistribute_no_optimization_Send_nb_T_inner = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_no_optimization_Send_nb_T_inner_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_no_optimization_Send_nb_T_inner = { .name = "nb_T_inner", .context_index = 4, .min = &expr_of_symb_redistribute_no_optimization_Send_nb_T_inner, .max = &expr_of_symb_redistribute_no_optimization_Send_nb_T_inner, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_redistribute_no_optimization_Send_i_start_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Send_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_no_optimization_Send_inline_c_expr29_line_207(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_redistribute_no_optimization_Send_i_start = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_no_optimization_Send_i_start_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_no_optimization_Send_i_start = { .name = "i_start", .context_index = 5, .min = &expr_of_symb_redistribute_no_optimization_Send_i_start, .max = &expr_of_symb_redistribute_no_optimization_Send_i_start, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_redistribute_no_optimization_Send_j_start_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Send_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_no_optimization_Send_inline_c_expr28_line_208(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_redistribute_no_optimization_Send_j_start = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_no_optimization_Send_j_start_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_no_optimization_Send_j_start = { .name = "j_start", .context_index = 6, .min = &expr_of_symb_redistribute_no_optimization_Send_j_start, .max = &expr_of_symb_redistribute_no_optimization_Send_j_start, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_redistribute_no_optimization_Send_m_Y_start_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Send_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_no_optimization_Send_inline_c_expr27_line_210(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_redistribute_no_optimization_Send_m_Y_start = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_no_optimization_Send_m_Y_start_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_no_optimization_Send_m_Y_start = { .name = "m_Y_start", .context_index = 7, .min = &expr_of_symb_redistribute_no_optimization_Send_m_Y_start, .max = &expr_of_symb_redistribute_no_optimization_Send_m_Y_start, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_redistribute_no_optimization_Send_n_Y_start_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Send_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_no_optimization_Send_inline_c_expr26_line_211(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_redistribute_no_optimization_Send_n_Y_start = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_no_optimization_Send_n_Y_start_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_no_optimization_Send_n_Y_start = { .name = "n_Y_start", .context_index = 8, .min = &expr_of_symb_redistribute_no_optimization_Send_n_Y_start, .max = &expr_of_symb_redistribute_no_optimization_Send_n_Y_start, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_redistribute_no_optimization_Send_m_Y_end_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Send_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_no_optimization_Send_inline_c_expr25_line_212(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_redistribute_no_optimization_Send_m_Y_end = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_no_optimization_Send_m_Y_end_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_no_optimization_Send_m_Y_end = { .name = "m_Y_end", .context_index = 9, .min = &expr_of_symb_redistribute_no_optimization_Send_m_Y_end, .max = &expr_of_symb_redistribute_no_optimization_Send_m_Y_end, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_redistribute_no_optimization_Send_n_Y_end_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Send_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_no_optimization_Send_inline_c_expr24_line_213(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_redistribute_no_optimization_Send_n_Y_end = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_no_optimization_Send_n_Y_end_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_no_optimization_Send_n_Y_end = { .name = "n_Y_end", .context_index = 10, .min = &expr_of_symb_redistribute_no_optimization_Send_n_Y_end, .max = &expr_of_symb_redistribute_no_optimization_Send_n_Y_end, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int minexpr_of_symb_redistribute_no_optimization_Send_m_Y_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Send_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int mb_T_inner = locals->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = locals->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int m_Y_start = locals->m_Y_start.value;
+  const int n_Y_start = locals->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = locals->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = locals->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+
+  (void)batch_col;
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)i_start;
+  (void)j_start;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)m_Y;
+  (void)n_Y;
+  (void)__parsec_tp; (void)locals;
+  return m_Y_start;
+}
+static const parsec_expr_t minexpr_of_symb_redistribute_no_optimization_Send_m_Y = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_redistribute_no_optimization_Send_m_Y_fct }
+                   }
+};
+static inline int maxexpr_of_symb_redistribute_no_optimization_Send_m_Y_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Send_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int mb_T_inner = locals->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = locals->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int m_Y_start = locals->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = locals->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = locals->m_Y_end.value;
+  const int n_Y_end = locals->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+
+  (void)batch_col;
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)i_start;
+  (void)j_start;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)m_Y;
+  (void)n_Y;
+  (void)__parsec_tp; (void)locals;
+  return m_Y_end;
+}
+static const parsec_expr_t maxexpr_of_symb_redistribute_no_optimization_Send_m_Y = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_redistribute_no_optimization_Send_m_Y_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_no_optimization_Send_m_Y = { .name = "m_Y", .context_index = 11, .min = &minexpr_of_symb_redistribute_no_optimization_Send_m_Y, .max = &maxexpr_of_symb_redistribute_no_optimization_Send_m_Y, .cst_inc = 1, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int minexpr_of_symb_redistribute_no_optimization_Send_n_Y_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Send_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int mb_T_inner = locals->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = locals->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int m_Y_start = locals->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = locals->n_Y_start.value;
+  const int m_Y_end = locals->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = locals->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+
+  (void)batch_col;
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)i_start;
+  (void)j_start;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)m_Y;
+  (void)n_Y;
+  (void)__parsec_tp; (void)locals;
+  return n_Y_start;
+}
+static const parsec_expr_t minexpr_of_symb_redistribute_no_optimization_Send_n_Y = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_redistribute_no_optimization_Send_n_Y_fct }
+                   }
+};
+static inline int maxexpr_of_symb_redistribute_no_optimization_Send_n_Y_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Send_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int mb_T_inner = locals->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = locals->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int m_Y_start = locals->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = locals->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = locals->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = locals->n_Y_end.value;
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+
+  (void)batch_col;
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)i_start;
+  (void)j_start;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)m_Y;
+  (void)n_Y;
+  (void)__parsec_tp; (void)locals;
+  return n_Y_end;
+}
+static const parsec_expr_t maxexpr_of_symb_redistribute_no_optimization_Send_n_Y = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_redistribute_no_optimization_Send_n_Y_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_no_optimization_Send_n_Y = { .name = "n_Y", .context_index = 12, .min = &minexpr_of_symb_redistribute_no_optimization_Send_n_Y, .max = &maxexpr_of_symb_redistribute_no_optimization_Send_n_Y, .cst_inc = 1, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int affinity_of_redistribute_no_optimization_Send(const __parsec_redistribute_no_optimization_Send_task_t *this_task,
+                     parsec_data_ref_t *ref)
+{
+    const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp = (const __parsec_redistribute_no_optimization_internal_taskpool_t*)this_task->taskpool;
+  const int batch_col = this_task->locals.batch_col.value; (void)batch_col;
+  const int m_T = this_task->locals.m_T.value; (void)m_T;
+  const int n_T = this_task->locals.n_T.value; (void)n_T;
+  const int mb_T_inner = this_task->locals.mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = this_task->locals.nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = this_task->locals.i_start.value; (void)i_start;
+  const int j_start = this_task->locals.j_start.value; (void)j_start;
+  const int m_Y_start = this_task->locals.m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = this_task->locals.n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = this_task->locals.m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = this_task->locals.n_Y_end.value; (void)n_Y_end;
+  const int m_Y = this_task->locals.m_Y.value; (void)m_Y;
+  const int n_Y = this_task->locals.n_Y.value; (void)n_Y;
+
+  /* Silent Warnings: should look into predicate to know what variables are usefull */
+  (void)batch_col;
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)i_start;
+  (void)j_start;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)m_Y;
+  (void)n_Y;
+  ref->dc = (parsec_data_collection_t *)__parsec_tp->super._g_descY;
+  /* Compute data key */
+  ref->key = ref->dc->data_key(ref->dc, m_Y, n_Y);
+  return 1;
+}
+static const parsec_property_t properties_of_redistribute_no_optimization_Send[1] = {
+  {.name = NULL, .expr = NULL}
+};
+static parsec_data_t *flow_of_redistribute_no_optimization_Send_for_Y_dep1_atline_220_direct_access(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Send_parsec_assignment_t *assignments)
+{
+  const int batch_col = assignments->batch_col.value; (void)batch_col;
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int mb_T_inner = assignments->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = assignments->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = assignments->i_start.value; (void)i_start;
+  const int j_start = assignments->j_start.value; (void)j_start;
+  const int m_Y_start = assignments->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = assignments->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = assignments->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = assignments->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = assignments->m_Y.value; (void)m_Y;
+  const int n_Y = assignments->n_Y.value; (void)n_Y;
+
+  /* Silence Warnings: should look into parameters to know what variables are useful */
+  (void)batch_col;
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)i_start;
+  (void)j_start;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)m_Y;
+  (void)n_Y;
+  if( __parsec_tp->super.super.context->my_rank == (int32_t)rank_of_descY(m_Y, n_Y) )
+    return data_of_descY(m_Y, n_Y);
+  return NULL;
+}
+
+static const parsec_dep_t flow_of_redistribute_no_optimization_Send_for_Y_dep1_atline_220 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = PARSEC_LOCAL_DATA_TASK_CLASS_ID, /* redistribute_no_optimization_descY */
+  .direct_data = (parsec_data_lookup_func_t)&flow_of_redistribute_no_optimization_Send_for_Y_dep1_atline_220_direct_access,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_redistribute_no_optimization_Send_for_Y,
+};
+static inline int expr_of_cond_for_flow_of_redistribute_no_optimization_Send_for_Y_dep2_atline_221_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Send_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int mb_T_inner = locals->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = locals->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int m_Y_start = locals->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = locals->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = locals->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = locals->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+
+  (void)batch_col;
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)i_start;
+  (void)j_start;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)m_Y;
+  (void)n_Y;
+  (void)__parsec_tp; (void)locals;
+  return ((m_Y) == (m_Y_start) && (n_Y) == (n_Y_start));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_redistribute_no_optimization_Send_for_Y_dep2_atline_221 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_redistribute_no_optimization_Send_for_Y_dep2_atline_221_fct }
+                   }
+};
+static const parsec_dep_t flow_of_redistribute_no_optimization_Send_for_Y_dep2_atline_221 = {
+  .cond = &expr_of_cond_for_flow_of_redistribute_no_optimization_Send_for_Y_dep2_atline_221,  /* ((m_Y) == (m_Y_start) && (n_Y) == (n_Y_start)) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 2, /* redistribute_no_optimization_Update */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_redistribute_no_optimization_Update_for_NW,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_redistribute_no_optimization_Send_for_Y,
+};
+static inline int expr_of_cond_for_flow_of_redistribute_no_optimization_Send_for_Y_dep3_atline_222_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Send_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int mb_T_inner = locals->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = locals->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int m_Y_start = locals->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = locals->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = locals->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = locals->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+
+  (void)batch_col;
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)i_start;
+  (void)j_start;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)m_Y;
+  (void)n_Y;
+  (void)__parsec_tp; (void)locals;
+  return (((m_Y) == (m_Y_start) && (n_Y) == (n_Y_end)) && (n_Y_start) != (n_Y_end));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_redistribute_no_optimization_Send_for_Y_dep3_atline_222 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_redistribute_no_optimization_Send_for_Y_dep3_atline_222_fct }
+                   }
+};
+static const parsec_dep_t flow_of_redistribute_no_optimization_Send_for_Y_dep3_atline_222 = {
+  .cond = &expr_of_cond_for_flow_of_redistribute_no_optimization_Send_for_Y_dep3_atline_222,  /* (((m_Y) == (m_Y_start) && (n_Y) == (n_Y_end)) && (n_Y_start) != (n_Y_end)) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 2, /* redistribute_no_optimization_Update */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_redistribute_no_optimization_Update_for_NE,
+  .dep_index = 1,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_redistribute_no_optimization_Send_for_Y,
+};
+static inline int expr_of_cond_for_flow_of_redistribute_no_optimization_Send_for_Y_dep4_atline_223_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Send_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int mb_T_inner = locals->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = locals->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int m_Y_start = locals->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = locals->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = locals->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = locals->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+
+  (void)batch_col;
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)i_start;
+  (void)j_start;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)m_Y;
+  (void)n_Y;
+  (void)__parsec_tp; (void)locals;
+  return (((m_Y) == (m_Y_end) && (n_Y) == (n_Y_start)) && (m_Y_start) != (m_Y_end));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_redistribute_no_optimization_Send_for_Y_dep4_atline_223 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_redistribute_no_optimization_Send_for_Y_dep4_atline_223_fct }
+                   }
+};
+static const parsec_dep_t flow_of_redistribute_no_optimization_Send_for_Y_dep4_atline_223 = {
+  .cond = &expr_of_cond_for_flow_of_redistribute_no_optimization_Send_for_Y_dep4_atline_223,  /* (((m_Y) == (m_Y_end) && (n_Y) == (n_Y_start)) && (m_Y_start) != (m_Y_end)) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 2, /* redistribute_no_optimization_Update */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_redistribute_no_optimization_Update_for_SW,
+  .dep_index = 2,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_redistribute_no_optimization_Send_for_Y,
+};
+static inline int expr_of_cond_for_flow_of_redistribute_no_optimization_Send_for_Y_dep5_atline_224_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Send_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int mb_T_inner = locals->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = locals->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int m_Y_start = locals->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = locals->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = locals->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = locals->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+
+  (void)batch_col;
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)i_start;
+  (void)j_start;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)m_Y;
+  (void)n_Y;
+  (void)__parsec_tp; (void)locals;
+  return ((((m_Y) == (m_Y_end) && (n_Y) == (n_Y_end)) && (m_Y_start) != (m_Y_end)) && (n_Y_start) != (n_Y_end));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_redistribute_no_optimization_Send_for_Y_dep5_atline_224 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_redistribute_no_optimization_Send_for_Y_dep5_atline_224_fct }
+                   }
+};
+static const parsec_dep_t flow_of_redistribute_no_optimization_Send_for_Y_dep5_atline_224 = {
+  .cond = &expr_of_cond_for_flow_of_redistribute_no_optimization_Send_for_Y_dep5_atline_224,  /* ((((m_Y) == (m_Y_end) && (n_Y) == (n_Y_end)) && (m_Y_start) != (m_Y_end)) && (n_Y_start) != (n_Y_end)) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 2, /* redistribute_no_optimization_Update */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_redistribute_no_optimization_Update_for_SE,
+  .dep_index = 3,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_redistribute_no_optimization_Send_for_Y,
+};
+static inline int expr_of_cond_for_flow_of_redistribute_no_optimization_Send_for_Y_dep6_atline_225_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Send_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int mb_T_inner = locals->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = locals->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int m_Y_start = locals->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = locals->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = locals->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = locals->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+
+  (void)batch_col;
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)i_start;
+  (void)j_start;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)m_Y;
+  (void)n_Y;
+  (void)__parsec_tp; (void)locals;
+  return (((m_Y) == (m_Y_start) && (n_Y) > (n_Y_start)) && (n_Y) < (n_Y_end));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_redistribute_no_optimization_Send_for_Y_dep6_atline_225 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_redistribute_no_optimization_Send_for_Y_dep6_atline_225_fct }
+                   }
+};
+static const parsec_dep_t flow_of_redistribute_no_optimization_Send_for_Y_dep6_atline_225 = {
+  .cond = &expr_of_cond_for_flow_of_redistribute_no_optimization_Send_for_Y_dep6_atline_225,  /* (((m_Y) == (m_Y_start) && (n_Y) > (n_Y_start)) && (n_Y) < (n_Y_end)) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 2, /* redistribute_no_optimization_Update */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_redistribute_no_optimization_Update_for_N,
+  .dep_index = 4,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_redistribute_no_optimization_Send_for_Y,
+};
+static inline int expr_of_cond_for_flow_of_redistribute_no_optimization_Send_for_Y_dep7_atline_226_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Send_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int mb_T_inner = locals->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = locals->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int m_Y_start = locals->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = locals->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = locals->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = locals->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+
+  (void)batch_col;
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)i_start;
+  (void)j_start;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)m_Y;
+  (void)n_Y;
+  (void)__parsec_tp; (void)locals;
+  return ((((m_Y) == (m_Y_end) && (m_Y_start) != (m_Y_end)) && (n_Y) > (n_Y_start)) && (n_Y) < (n_Y_end));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_redistribute_no_optimization_Send_for_Y_dep7_atline_226 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_redistribute_no_optimization_Send_for_Y_dep7_atline_226_fct }
+                   }
+};
+static const parsec_dep_t flow_of_redistribute_no_optimization_Send_for_Y_dep7_atline_226 = {
+  .cond = &expr_of_cond_for_flow_of_redistribute_no_optimization_Send_for_Y_dep7_atline_226,  /* ((((m_Y) == (m_Y_end) && (m_Y_start) != (m_Y_end)) && (n_Y) > (n_Y_start)) && (n_Y) < (n_Y_end)) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 2, /* redistribute_no_optimization_Update */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_redistribute_no_optimization_Update_for_S,
+  .dep_index = 5,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_redistribute_no_optimization_Send_for_Y,
+};
+static inline int expr_of_cond_for_flow_of_redistribute_no_optimization_Send_for_Y_dep8_atline_227_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Send_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int mb_T_inner = locals->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = locals->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int m_Y_start = locals->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = locals->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = locals->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = locals->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+
+  (void)batch_col;
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)i_start;
+  (void)j_start;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)m_Y;
+  (void)n_Y;
+  (void)__parsec_tp; (void)locals;
+  return (((n_Y) == (n_Y_start) && (m_Y) > (m_Y_start)) && (m_Y) < (m_Y_end));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_redistribute_no_optimization_Send_for_Y_dep8_atline_227 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_redistribute_no_optimization_Send_for_Y_dep8_atline_227_fct }
+                   }
+};
+static const parsec_dep_t flow_of_redistribute_no_optimization_Send_for_Y_dep8_atline_227 = {
+  .cond = &expr_of_cond_for_flow_of_redistribute_no_optimization_Send_for_Y_dep8_atline_227,  /* (((n_Y) == (n_Y_start) && (m_Y) > (m_Y_start)) && (m_Y) < (m_Y_end)) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 2, /* redistribute_no_optimization_Update */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_redistribute_no_optimization_Update_for_W,
+  .dep_index = 6,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_redistribute_no_optimization_Send_for_Y,
+};
+static inline int expr_of_cond_for_flow_of_redistribute_no_optimization_Send_for_Y_dep9_atline_228_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Send_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int mb_T_inner = locals->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = locals->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int m_Y_start = locals->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = locals->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = locals->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = locals->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+
+  (void)batch_col;
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)i_start;
+  (void)j_start;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)m_Y;
+  (void)n_Y;
+  (void)__parsec_tp; (void)locals;
+  return ((((n_Y) == (n_Y_end) && (n_Y_start) != (n_Y_end)) && (m_Y) > (m_Y_start)) && (m_Y) < (m_Y_end));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_redistribute_no_optimization_Send_for_Y_dep9_atline_228 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_redistribute_no_optimization_Send_for_Y_dep9_atline_228_fct }
+                   }
+};
+static const parsec_dep_t flow_of_redistribute_no_optimization_Send_for_Y_dep9_atline_228 = {
+  .cond = &expr_of_cond_for_flow_of_redistribute_no_optimization_Send_for_Y_dep9_atline_228,  /* ((((n_Y) == (n_Y_end) && (n_Y_start) != (n_Y_end)) && (m_Y) > (m_Y_start)) && (m_Y) < (m_Y_end)) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 2, /* redistribute_no_optimization_Update */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_redistribute_no_optimization_Update_for_E,
+  .dep_index = 7,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_redistribute_no_optimization_Send_for_Y,
+};
+static inline int expr_of_cond_for_flow_of_redistribute_no_optimization_Send_for_Y_dep10_atline_229_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Send_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int mb_T_inner = locals->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = locals->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int m_Y_start = locals->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = locals->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = locals->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = locals->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+
+  (void)batch_col;
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)i_start;
+  (void)j_start;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)m_Y;
+  (void)n_Y;
+  (void)__parsec_tp; (void)locals;
+  return ((((m_Y) > (m_Y_start) && (m_Y) < (m_Y_end)) && (n_Y) > (n_Y_start)) && (n_Y) < (n_Y_end));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_redistribute_no_optimization_Send_for_Y_dep10_atline_229 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_redistribute_no_optimization_Send_for_Y_dep10_atline_229_fct }
+                   }
+};
+static const parsec_dep_t flow_of_redistribute_no_optimization_Send_for_Y_dep10_atline_229 = {
+  .cond = &expr_of_cond_for_flow_of_redistribute_no_optimization_Send_for_Y_dep10_atline_229,  /* ((((m_Y) > (m_Y_start) && (m_Y) < (m_Y_end)) && (n_Y) > (n_Y_start)) && (n_Y) < (n_Y_end)) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 2, /* redistribute_no_optimization_Update */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_redistribute_no_optimization_Update_for_I,
+  .dep_index = 8,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_redistribute_no_optimization_Send_for_Y,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+#if MAX_DEP_OUT_COUNT < 9  /* number of output dependencies */
+    #error Too many output dependencies (supports up to MAX_DEP_OUT_COUNT [=10] but found 9). Fix the code or recompile PaRSEC with a larger MAX_DEP_OUT_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_redistribute_no_optimization_Send_for_Y = {
+  .name               = "Y",
+  .sym_type           = PARSEC_SYM_INOUT,
+  .flow_flags         = PARSEC_FLOW_ACCESS_READ|PARSEC_FLOW_HAS_IN_DEPS,
+  .flow_index         = 0,
+  .flow_datatype_mask = 0x1,
+  .dep_in     = { &flow_of_redistribute_no_optimization_Send_for_Y_dep1_atline_220 },
+  .dep_out    = { &flow_of_redistribute_no_optimization_Send_for_Y_dep2_atline_221,
+ &flow_of_redistribute_no_optimization_Send_for_Y_dep3_atline_222,
+ &flow_of_redistribute_no_optimization_Send_for_Y_dep4_atline_223,
+ &flow_of_redistribute_no_optimization_Send_for_Y_dep5_atline_224,
+ &flow_of_redistribute_no_optimization_Send_for_Y_dep6_atline_225,
+ &flow_of_redistribute_no_optimization_Send_for_Y_dep7_atline_226,
+ &flow_of_redistribute_no_optimization_Send_for_Y_dep8_atline_227,
+ &flow_of_redistribute_no_optimization_Send_for_Y_dep9_atline_228,
+ &flow_of_redistribute_no_optimization_Send_for_Y_dep10_atline_229 }
+};
+
+static inline int expr_of_cond_for_flow_of_redistribute_no_optimization_Send_for_ctl_dep1_atline_231_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Send_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int mb_T_inner = locals->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = locals->nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = locals->i_start.value; (void)i_start;
+  const int j_start = locals->j_start.value; (void)j_start;
+  const int m_Y_start = locals->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = locals->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = locals->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = locals->n_Y_end.value; (void)n_Y_end;
+  const int m_Y = locals->m_Y.value; (void)m_Y;
+  const int n_Y = locals->n_Y.value; (void)n_Y;
+
+  (void)batch_col;
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)i_start;
+  (void)j_start;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)m_Y;
+  (void)n_Y;
+  (void)__parsec_tp; (void)locals;
+  return (batch_col) > (0);
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_redistribute_no_optimization_Send_for_ctl_dep1_atline_231 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_redistribute_no_optimization_Send_for_ctl_dep1_atline_231_fct }
+                   }
+};
+static const parsec_dep_t flow_of_redistribute_no_optimization_Send_for_ctl_dep1_atline_231 = {
+  .cond = &expr_of_cond_for_flow_of_redistribute_no_optimization_Send_for_ctl_dep1_atline_231,  /* (batch_col) > (0) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 3, /* redistribute_no_optimization_Receive */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_redistribute_no_optimization_Receive_for_ctl2,
+  .dep_index = 1,
+  .dep_datatype_index = 1,
+  .belongs_to = &flow_of_redistribute_no_optimization_Send_for_ctl,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_redistribute_no_optimization_Send_for_ctl = {
+  .name               = "ctl",
+  .sym_type           = PARSEC_SYM_IN,
+  .flow_flags         = PARSEC_FLOW_ACCESS_NONE|PARSEC_FLOW_HAS_IN_DEPS,
+  .flow_index         = 1,
+  .flow_datatype_mask = 0x0,
+  .dep_in     = { &flow_of_redistribute_no_optimization_Send_for_ctl_dep1_atline_231 },
+  .dep_out    = { NULL }
+};
+
+static void
+iterate_successors_of_redistribute_no_optimization_Send(parsec_execution_stream_t *es, const __parsec_redistribute_no_optimization_Send_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp = (const __parsec_redistribute_no_optimization_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_redistribute_no_optimization_Send_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_redistribute_no_optimization_Send_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int batch_col = __jdf2c__tmp_locals.batch_col.value; (void)batch_col;
+  const int m_T = __jdf2c__tmp_locals.m_T.value; (void)m_T;
+  const int n_T = __jdf2c__tmp_locals.n_T.value; (void)n_T;
+  const int mb_T_inner = __jdf2c__tmp_locals.mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = __jdf2c__tmp_locals.nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = __jdf2c__tmp_locals.i_start.value; (void)i_start;
+  const int j_start = __jdf2c__tmp_locals.j_start.value; (void)j_start;
+  const int m_Y_start = __jdf2c__tmp_locals.m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = __jdf2c__tmp_locals.n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = __jdf2c__tmp_locals.m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = __jdf2c__tmp_locals.n_Y_end.value; (void)n_Y_end;
+  const int m_Y = __jdf2c__tmp_locals.m_Y.value; (void)m_Y;
+  const int n_Y = __jdf2c__tmp_locals.n_Y.value; (void)n_Y;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)batch_col;  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)i_start;  (void)j_start;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;  (void)m_Y;  (void)n_Y;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_descY(m_Y, n_Y);
+#endif
+  if( action_mask & 0x1ff ) {  /* Flow of data Y [0] */
+    data.data   = this_task->data._f_Y.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x1 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_redistribute_no_optimization_SOURCE_ADT->arena;
+    data.local.src_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.dst_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_redistribute_no_optimization_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( ((m_Y) == (m_Y_start) && (n_Y) == (n_Y_start)) ) {
+      __parsec_redistribute_no_optimization_Update_task_t* ncc = (__parsec_redistribute_no_optimization_Update_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[redistribute_no_optimization_Update.task_class_id];
+        const int Update_batch_col = batch_col;
+        if( (Update_batch_col >= (0)) && (Update_batch_col <= (NT)) ) {
+          assert(&nc.locals[0].value == &ncc->locals.batch_col.value);
+          ncc->locals.batch_col.value = Update_batch_col;
+          const int Update_m_T = m_T;
+          if( (Update_m_T >= (m_T_START)) && (Update_m_T <= (m_T_END)) ) {
+            assert(&nc.locals[1].value == &ncc->locals.m_T.value);
+            ncc->locals.m_T.value = Update_m_T;
+            const int Update_n_T = n_T;
+            if( (Update_n_T >= (redistribute_no_optimization_Update_inline_c_expr23_line_249(__parsec_tp, &ncc->locals))) && (Update_n_T <= (redistribute_no_optimization_Update_inline_c_expr22_line_249(__parsec_tp, &ncc->locals))) ) {
+              assert(&nc.locals[2].value == &ncc->locals.n_T.value);
+              ncc->locals.n_T.value = Update_n_T;
+              const int Update_mb_T_inner = redistribute_no_optimization_Update_inline_c_expr21_line_251(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[3].value == &ncc->locals.mb_T_inner.value);
+              ncc->locals.mb_T_inner.value = Update_mb_T_inner;
+              const int Update_nb_T_inner = redistribute_no_optimization_Update_inline_c_expr20_line_252(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[4].value == &ncc->locals.nb_T_inner.value);
+              ncc->locals.nb_T_inner.value = Update_nb_T_inner;
+              const int Update_i_start = redistribute_no_optimization_Update_inline_c_expr19_line_254(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[5].value == &ncc->locals.i_start.value);
+              ncc->locals.i_start.value = Update_i_start;
+              const int Update_j_start = redistribute_no_optimization_Update_inline_c_expr18_line_255(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[6].value == &ncc->locals.j_start.value);
+              ncc->locals.j_start.value = Update_j_start;
+              const int Update_m_Y_start = redistribute_no_optimization_Update_inline_c_expr17_line_257(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[7].value == &ncc->locals.m_Y_start.value);
+              ncc->locals.m_Y_start.value = Update_m_Y_start;
+              const int Update_n_Y_start = redistribute_no_optimization_Update_inline_c_expr16_line_258(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[8].value == &ncc->locals.n_Y_start.value);
+              ncc->locals.n_Y_start.value = Update_n_Y_start;
+              const int Update_m_Y_end = redistribute_no_optimization_Update_inline_c_expr15_line_259(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[9].value == &ncc->locals.m_Y_end.value);
+              ncc->locals.m_Y_end.value = Update_m_Y_end;
+              const int Update_n_Y_end = redistribute_no_optimization_Update_inline_c_expr14_line_260(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[10].value == &ncc->locals.n_Y_end.value);
+              ncc->locals.n_Y_end.value = Update_n_Y_end;
+              const int Update_m_Y = m_Y;
+              if( (Update_m_Y >= (ncc->locals.m_Y_start.value)) && (Update_m_Y <= (ncc->locals.m_Y_end.value)) ) {
+                assert(&nc.locals[11].value == &ncc->locals.m_Y.value);
+                ncc->locals.m_Y.value = Update_m_Y;
+                const int Update_n_Y = n_Y;
+                if( (Update_n_Y >= (ncc->locals.n_Y_start.value)) && (Update_n_Y <= (ncc->locals.n_Y_end.value)) ) {
+                  assert(&nc.locals[12].value == &ncc->locals.n_Y.value);
+                  ncc->locals.n_Y.value = Update_n_Y;
+                  const int Update_TL_row = redistribute_no_optimization_Update_inline_c_expr13_line_265(__parsec_tp, &ncc->locals);
+                  assert(&nc.locals[13].value == &ncc->locals.TL_row.value);
+                  ncc->locals.TL_row.value = Update_TL_row;
+                  const int Update_TL_col = redistribute_no_optimization_Update_inline_c_expr12_line_266(__parsec_tp, &ncc->locals);
+                  assert(&nc.locals[14].value == &ncc->locals.TL_col.value);
+                  ncc->locals.TL_col.value = Update_TL_col;
+                  const int Update_BR_row = ((((ncc->locals.i_start.value + ncc->locals.mb_T_inner.value) - 1) % mb_Y_INNER) + 1);
+                  assert(&nc.locals[15].value == &ncc->locals.BR_row.value);
+                  ncc->locals.BR_row.value = Update_BR_row;
+                  const int Update_BR_col = ((((ncc->locals.j_start.value + ncc->locals.nb_T_inner.value) - 1) % nb_Y_INNER) + 1);
+                  assert(&nc.locals[16].value == &ncc->locals.BR_col.value);
+                  ncc->locals.BR_col.value = Update_BR_col;
+#if defined(DISTRIBUTED)
+                  rank_dst = rank_of_descT(ncc->locals.m_T.value, ncc->locals.n_T.value);
+                  if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+                    vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descT)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descT, ncc->locals.m_T.value, ncc->locals.n_T.value);
+                  nc.priority = __parsec_tp->super.super.priority;
+                  successor_repo = Update_repo;
+                  successor_repo_key = __jdf2c_make_key_Update((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+                RELEASE_DEP_OUTPUT(es, "Y", this_task, "NW", &nc, rank_src, rank_dst, &data);
+                if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_redistribute_no_optimization_Send_for_Y_dep2_atline_221, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+                  }
+                }
+              }
+            }
+          }
+    }
+  }
+  if( action_mask & 0x2 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_redistribute_no_optimization_SOURCE_ADT->arena;
+    data.local.src_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.dst_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_redistribute_no_optimization_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( (((m_Y) == (m_Y_start) && (n_Y) == (n_Y_end)) && (n_Y_start) != (n_Y_end)) ) {
+      __parsec_redistribute_no_optimization_Update_task_t* ncc = (__parsec_redistribute_no_optimization_Update_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[redistribute_no_optimization_Update.task_class_id];
+        const int Update_batch_col = batch_col;
+        if( (Update_batch_col >= (0)) && (Update_batch_col <= (NT)) ) {
+          assert(&nc.locals[0].value == &ncc->locals.batch_col.value);
+          ncc->locals.batch_col.value = Update_batch_col;
+          const int Update_m_T = m_T;
+          if( (Update_m_T >= (m_T_START)) && (Update_m_T <= (m_T_END)) ) {
+            assert(&nc.locals[1].value == &ncc->locals.m_T.value);
+            ncc->locals.m_T.value = Update_m_T;
+            const int Update_n_T = n_T;
+            if( (Update_n_T >= (redistribute_no_optimization_Update_inline_c_expr23_line_249(__parsec_tp, &ncc->locals))) && (Update_n_T <= (redistribute_no_optimization_Update_inline_c_expr22_line_249(__parsec_tp, &ncc->locals))) ) {
+              assert(&nc.locals[2].value == &ncc->locals.n_T.value);
+              ncc->locals.n_T.value = Update_n_T;
+              const int Update_mb_T_inner = redistribute_no_optimization_Update_inline_c_expr21_line_251(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[3].value == &ncc->locals.mb_T_inner.value);
+              ncc->locals.mb_T_inner.value = Update_mb_T_inner;
+              const int Update_nb_T_inner = redistribute_no_optimization_Update_inline_c_expr20_line_252(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[4].value == &ncc->locals.nb_T_inner.value);
+              ncc->locals.nb_T_inner.value = Update_nb_T_inner;
+              const int Update_i_start = redistribute_no_optimization_Update_inline_c_expr19_line_254(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[5].value == &ncc->locals.i_start.value);
+              ncc->locals.i_start.value = Update_i_start;
+              const int Update_j_start = redistribute_no_optimization_Update_inline_c_expr18_line_255(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[6].value == &ncc->locals.j_start.value);
+              ncc->locals.j_start.value = Update_j_start;
+              const int Update_m_Y_start = redistribute_no_optimization_Update_inline_c_expr17_line_257(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[7].value == &ncc->locals.m_Y_start.value);
+              ncc->locals.m_Y_start.value = Update_m_Y_start;
+              const int Update_n_Y_start = redistribute_no_optimization_Update_inline_c_expr16_line_258(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[8].value == &ncc->locals.n_Y_start.value);
+              ncc->locals.n_Y_start.value = Update_n_Y_start;
+              const int Update_m_Y_end = redistribute_no_optimization_Update_inline_c_expr15_line_259(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[9].value == &ncc->locals.m_Y_end.value);
+              ncc->locals.m_Y_end.value = Update_m_Y_end;
+              const int Update_n_Y_end = redistribute_no_optimization_Update_inline_c_expr14_line_260(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[10].value == &ncc->locals.n_Y_end.value);
+              ncc->locals.n_Y_end.value = Update_n_Y_end;
+              const int Update_m_Y = m_Y;
+              if( (Update_m_Y >= (ncc->locals.m_Y_start.value)) && (Update_m_Y <= (ncc->locals.m_Y_end.value)) ) {
+                assert(&nc.locals[11].value == &ncc->locals.m_Y.value);
+                ncc->locals.m_Y.value = Update_m_Y;
+                const int Update_n_Y = n_Y;
+                if( (Update_n_Y >= (ncc->locals.n_Y_start.value)) && (Update_n_Y <= (ncc->locals.n_Y_end.value)) ) {
+                  assert(&nc.locals[12].value == &ncc->locals.n_Y.value);
+                  ncc->locals.n_Y.value = Update_n_Y;
+                  const int Update_TL_row = redistribute_no_optimization_Update_inline_c_expr13_line_265(__parsec_tp, &ncc->locals);
+                  assert(&nc.locals[13].value == &ncc->locals.TL_row.value);
+                  ncc->locals.TL_row.value = Update_TL_row;
+                  const int Update_TL_col = redistribute_no_optimization_Update_inline_c_expr12_line_266(__parsec_tp, &ncc->locals);
+                  assert(&nc.locals[14].value == &ncc->locals.TL_col.value);
+                  ncc->locals.TL_col.value = Update_TL_col;
+                  const int Update_BR_row = ((((ncc->locals.i_start.value + ncc->locals.mb_T_inner.value) - 1) % mb_Y_INNER) + 1);
+                  assert(&nc.locals[15].value == &ncc->locals.BR_row.value);
+                  ncc->locals.BR_row.value = Update_BR_row;
+                  const int Update_BR_col = ((((ncc->locals.j_start.value + ncc->locals.nb_T_inner.value) - 1) % nb_Y_INNER) + 1);
+                  assert(&nc.locals[16].value == &ncc->locals.BR_col.value);
+                  ncc->locals.BR_col.value = Update_BR_col;
+#if defined(DISTRIBUTED)
+                  rank_dst = rank_of_descT(ncc->locals.m_T.value, ncc->locals.n_T.value);
+                  if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+                    vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descT)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descT, ncc->locals.m_T.value, ncc->locals.n_T.value);
+                  nc.priority = __parsec_tp->super.super.priority;
+                  successor_repo = Update_repo;
+                  successor_repo_key = __jdf2c_make_key_Update((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+                RELEASE_DEP_OUTPUT(es, "Y", this_task, "NE", &nc, rank_src, rank_dst, &data);
+                if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_redistribute_no_optimization_Send_for_Y_dep3_atline_222, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+                  }
+                }
+              }
+            }
+          }
+    }
+  }
+  if( action_mask & 0x4 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_redistribute_no_optimization_SOURCE_ADT->arena;
+    data.local.src_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.dst_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_redistribute_no_optimization_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( (((m_Y) == (m_Y_end) && (n_Y) == (n_Y_start)) && (m_Y_start) != (m_Y_end)) ) {
+      __parsec_redistribute_no_optimization_Update_task_t* ncc = (__parsec_redistribute_no_optimization_Update_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[redistribute_no_optimization_Update.task_class_id];
+        const int Update_batch_col = batch_col;
+        if( (Update_batch_col >= (0)) && (Update_batch_col <= (NT)) ) {
+          assert(&nc.locals[0].value == &ncc->locals.batch_col.value);
+          ncc->locals.batch_col.value = Update_batch_col;
+          const int Update_m_T = m_T;
+          if( (Update_m_T >= (m_T_START)) && (Update_m_T <= (m_T_END)) ) {
+            assert(&nc.locals[1].value == &ncc->locals.m_T.value);
+            ncc->locals.m_T.value = Update_m_T;
+            const int Update_n_T = n_T;
+            if( (Update_n_T >= (redistribute_no_optimization_Update_inline_c_expr23_line_249(__parsec_tp, &ncc->locals))) && (Update_n_T <= (redistribute_no_optimization_Update_inline_c_expr22_line_249(__parsec_tp, &ncc->locals))) ) {
+              assert(&nc.locals[2].value == &ncc->locals.n_T.value);
+              ncc->locals.n_T.value = Update_n_T;
+              const int Update_mb_T_inner = redistribute_no_optimization_Update_inline_c_expr21_line_251(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[3].value == &ncc->locals.mb_T_inner.value);
+              ncc->locals.mb_T_inner.value = Update_mb_T_inner;
+              const int Update_nb_T_inner = redistribute_no_optimization_Update_inline_c_expr20_line_252(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[4].value == &ncc->locals.nb_T_inner.value);
+              ncc->locals.nb_T_inner.value = Update_nb_T_inner;
+              const int Update_i_start = redistribute_no_optimization_Update_inline_c_expr19_line_254(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[5].value == &ncc->locals.i_start.value);
+              ncc->locals.i_start.value = Update_i_start;
+              const int Update_j_start = redistribute_no_optimization_Update_inline_c_expr18_line_255(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[6].value == &ncc->locals.j_start.value);
+              ncc->locals.j_start.value = Update_j_start;
+              const int Update_m_Y_start = redistribute_no_optimization_Update_inline_c_expr17_line_257(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[7].value == &ncc->locals.m_Y_start.value);
+              ncc->locals.m_Y_start.value = Update_m_Y_start;
+              const int Update_n_Y_start = redistribute_no_optimization_Update_inline_c_expr16_line_258(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[8].value == &ncc->locals.n_Y_start.value);
+              ncc->locals.n_Y_start.value = Update_n_Y_start;
+              const int Update_m_Y_end = redistribute_no_optimization_Update_inline_c_expr15_line_259(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[9].value == &ncc->locals.m_Y_end.value);
+              ncc->locals.m_Y_end.value = Update_m_Y_end;
+              const int Update_n_Y_end = redistribute_no_optimization_Update_inline_c_expr14_line_260(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[10].value == &ncc->locals.n_Y_end.value);
+              ncc->locals.n_Y_end.value = Update_n_Y_end;
+              const int Update_m_Y = m_Y;
+              if( (Update_m_Y >= (ncc->locals.m_Y_start.value)) && (Update_m_Y <= (ncc->locals.m_Y_end.value)) ) {
+                assert(&nc.locals[11].value == &ncc->locals.m_Y.value);
+                ncc->locals.m_Y.value = Update_m_Y;
+                const int Update_n_Y = n_Y;
+                if( (Update_n_Y >= (ncc->locals.n_Y_start.value)) && (Update_n_Y <= (ncc->locals.n_Y_end.value)) ) {
+                  assert(&nc.locals[12].value == &ncc->locals.n_Y.value);
+                  ncc->locals.n_Y.value = Update_n_Y;
+                  const int Update_TL_row = redistribute_no_optimization_Update_inline_c_expr13_line_265(__parsec_tp, &ncc->locals);
+                  assert(&nc.locals[13].value == &ncc->locals.TL_row.value);
+                  ncc->locals.TL_row.value = Update_TL_row;
+                  const int Update_TL_col = redistribute_no_optimization_Update_inline_c_expr12_line_266(__parsec_tp, &ncc->locals);
+                  assert(&nc.locals[14].value == &ncc->locals.TL_col.value);
+                  ncc->locals.TL_col.value = Update_TL_col;
+                  const int Update_BR_row = ((((ncc->locals.i_start.value + ncc->locals.mb_T_inner.value) - 1) % mb_Y_INNER) + 1);
+                  assert(&nc.locals[15].value == &ncc->locals.BR_row.value);
+                  ncc->locals.BR_row.value = Update_BR_row;
+                  const int Update_BR_col = ((((ncc->locals.j_start.value + ncc->locals.nb_T_inner.value) - 1) % nb_Y_INNER) + 1);
+                  assert(&nc.locals[16].value == &ncc->locals.BR_col.value);
+                  ncc->locals.BR_col.value = Update_BR_col;
+#if defined(DISTRIBUTED)
+                  rank_dst = rank_of_descT(ncc->locals.m_T.value, ncc->locals.n_T.value);
+                  if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+                    vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descT)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descT, ncc->locals.m_T.value, ncc->locals.n_T.value);
+                  nc.priority = __parsec_tp->super.super.priority;
+                  successor_repo = Update_repo;
+                  successor_repo_key = __jdf2c_make_key_Update((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+                RELEASE_DEP_OUTPUT(es, "Y", this_task, "SW", &nc, rank_src, rank_dst, &data);
+                if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_redistribute_no_optimization_Send_for_Y_dep4_atline_223, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+                  }
+                }
+              }
+            }
+          }
+    }
+  }
+  if( action_mask & 0x8 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_redistribute_no_optimization_SOURCE_ADT->arena;
+    data.local.src_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.dst_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_redistribute_no_optimization_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( ((((m_Y) == (m_Y_end) && (n_Y) == (n_Y_end)) && (m_Y_start) != (m_Y_end)) && (n_Y_start) != (n_Y_end)) ) {
+      __parsec_redistribute_no_optimization_Update_task_t* ncc = (__parsec_redistribute_no_optimization_Update_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[redistribute_no_optimization_Update.task_class_id];
+        const int Update_batch_col = batch_col;
+        if( (Update_batch_col >= (0)) && (Update_batch_col <= (NT)) ) {
+          assert(&nc.locals[0].value == &ncc->locals.batch_col.value);
+          ncc->locals.batch_col.value = Update_batch_col;
+          const int Update_m_T = m_T;
+          if( (Update_m_T >= (m_T_START)) && (Update_m_T <= (m_T_END)) ) {
+            assert(&nc.locals[1].value == &ncc->locals.m_T.value);
+            ncc->locals.m_T.value = Update_m_T;
+            const int Update_n_T = n_T;
+            if( (Update_n_T >= (redistribute_no_optimization_Update_inline_c_expr23_line_249(__parsec_tp, &ncc->locals))) && (Update_n_T <= (redistribute_no_optimization_Update_inline_c_expr22_line_249(__parsec_tp, &ncc->locals))) ) {
+              assert(&nc.locals[2].value == &ncc->locals.n_T.value);
+              ncc->locals.n_T.value = Update_n_T;
+              const int Update_mb_T_inner = redistribute_no_optimization_Update_inline_c_expr21_line_251(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[3].value == &ncc->locals.mb_T_inner.value);
+              ncc->locals.mb_T_inner.value = Update_mb_T_inner;
+              const int Update_nb_T_inner = redistribute_no_optimization_Update_inline_c_expr20_line_252(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[4].value == &ncc->locals.nb_T_inner.value);
+              ncc->locals.nb_T_inner.value = Update_nb_T_inner;
+              const int Update_i_start = redistribute_no_optimization_Update_inline_c_expr19_line_254(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[5].value == &ncc->locals.i_start.value);
+              ncc->locals.i_start.value = Update_i_start;
+              const int Update_j_start = redistribute_no_optimization_Update_inline_c_expr18_line_255(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[6].value == &ncc->locals.j_start.value);
+              ncc->locals.j_start.value = Update_j_start;
+              const int Update_m_Y_start = redistribute_no_optimization_Update_inline_c_expr17_line_257(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[7].value == &ncc->locals.m_Y_start.value);
+              ncc->locals.m_Y_start.value = Update_m_Y_start;
+              const int Update_n_Y_start = redistribute_no_optimization_Update_inline_c_expr16_line_258(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[8].value == &ncc->locals.n_Y_start.value);
+              ncc->locals.n_Y_start.value = Update_n_Y_start;
+              const int Update_m_Y_end = redistribute_no_optimization_Update_inline_c_expr15_line_259(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[9].value == &ncc->locals.m_Y_end.value);
+              ncc->locals.m_Y_end.value = Update_m_Y_end;
+              const int Update_n_Y_end = redistribute_no_optimization_Update_inline_c_expr14_line_260(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[10].value == &ncc->locals.n_Y_end.value);
+              ncc->locals.n_Y_end.value = Update_n_Y_end;
+              const int Update_m_Y = m_Y;
+              if( (Update_m_Y >= (ncc->locals.m_Y_start.value)) && (Update_m_Y <= (ncc->locals.m_Y_end.value)) ) {
+                assert(&nc.locals[11].value == &ncc->locals.m_Y.value);
+                ncc->locals.m_Y.value = Update_m_Y;
+                const int Update_n_Y = n_Y;
+                if( (Update_n_Y >= (ncc->locals.n_Y_start.value)) && (Update_n_Y <= (ncc->locals.n_Y_end.value)) ) {
+                  assert(&nc.locals[12].value == &ncc->locals.n_Y.value);
+                  ncc->locals.n_Y.value = Update_n_Y;
+                  const int Update_TL_row = redistribute_no_optimization_Update_inline_c_expr13_line_265(__parsec_tp, &ncc->locals);
+                  assert(&nc.locals[13].value == &ncc->locals.TL_row.value);
+                  ncc->locals.TL_row.value = Update_TL_row;
+                  const int Update_TL_col = redistribute_no_optimization_Update_inline_c_expr12_line_266(__parsec_tp, &ncc->locals);
+                  assert(&nc.locals[14].value == &ncc->locals.TL_col.value);
+                  ncc->locals.TL_col.value = Update_TL_col;
+                  const int Update_BR_row = ((((ncc->locals.i_start.value + ncc->locals.mb_T_inner.value) - 1) % mb_Y_INNER) + 1);
+                  assert(&nc.locals[15].value == &ncc->locals.BR_row.value);
+                  ncc->locals.BR_row.value = Update_BR_row;
+                  const int Update_BR_col = ((((ncc->locals.j_start.value + ncc->locals.nb_T_inner.value) - 1) % nb_Y_INNER) + 1);
+                  assert(&nc.locals[16].value == &ncc->locals.BR_col.value);
+                  ncc->locals.BR_col.value = Update_BR_col;
+#if defined(DISTRIBUTED)
+                  rank_dst = rank_of_descT(ncc->locals.m_T.value, ncc->locals.n_T.value);
+                  if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+                    vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descT)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descT, ncc->locals.m_T.value, ncc->locals.n_T.value);
+                  nc.priority = __parsec_tp->super.super.priority;
+                  successor_repo = Update_repo;
+                  successor_repo_key = __jdf2c_make_key_Update((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+                RELEASE_DEP_OUTPUT(es, "Y", this_task, "SE", &nc, rank_src, rank_dst, &data);
+                if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_redistribute_no_optimization_Send_for_Y_dep5_atline_224, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+                  }
+                }
+              }
+            }
+          }
+    }
+  }
+  if( action_mask & 0x10 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_redistribute_no_optimization_SOURCE_ADT->arena;
+    data.local.src_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.dst_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_redistribute_no_optimization_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( (((m_Y) == (m_Y_start) && (n_Y) > (n_Y_start)) && (n_Y) < (n_Y_end)) ) {
+      __parsec_redistribute_no_optimization_Update_task_t* ncc = (__parsec_redistribute_no_optimization_Update_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[redistribute_no_optimization_Update.task_class_id];
+        const int Update_batch_col = batch_col;
+        if( (Update_batch_col >= (0)) && (Update_batch_col <= (NT)) ) {
+          assert(&nc.locals[0].value == &ncc->locals.batch_col.value);
+          ncc->locals.batch_col.value = Update_batch_col;
+          const int Update_m_T = m_T;
+          if( (Update_m_T >= (m_T_START)) && (Update_m_T <= (m_T_END)) ) {
+            assert(&nc.locals[1].value == &ncc->locals.m_T.value);
+            ncc->locals.m_T.value = Update_m_T;
+            const int Update_n_T = n_T;
+            if( (Update_n_T >= (redistribute_no_optimization_Update_inline_c_expr23_line_249(__parsec_tp, &ncc->locals))) && (Update_n_T <= (redistribute_no_optimization_Update_inline_c_expr22_line_249(__parsec_tp, &ncc->locals))) ) {
+              assert(&nc.locals[2].value == &ncc->locals.n_T.value);
+              ncc->locals.n_T.value = Update_n_T;
+              const int Update_mb_T_inner = redistribute_no_optimization_Update_inline_c_expr21_line_251(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[3].value == &ncc->locals.mb_T_inner.value);
+              ncc->locals.mb_T_inner.value = Update_mb_T_inner;
+              const int Update_nb_T_inner = redistribute_no_optimization_Update_inline_c_expr20_line_252(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[4].value == &ncc->locals.nb_T_inner.value);
+              ncc->locals.nb_T_inner.value = Update_nb_T_inner;
+              const int Update_i_start = redistribute_no_optimization_Update_inline_c_expr19_line_254(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[5].value == &ncc->locals.i_start.value);
+              ncc->locals.i_start.value = Update_i_start;
+              const int Update_j_start = redistribute_no_optimization_Update_inline_c_expr18_line_255(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[6].value == &ncc->locals.j_start.value);
+              ncc->locals.j_start.value = Update_j_start;
+              const int Update_m_Y_start = redistribute_no_optimization_Update_inline_c_expr17_line_257(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[7].value == &ncc->locals.m_Y_start.value);
+              ncc->locals.m_Y_start.value = Update_m_Y_start;
+              const int Update_n_Y_start = redistribute_no_optimization_Update_inline_c_expr16_line_258(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[8].value == &ncc->locals.n_Y_start.value);
+              ncc->locals.n_Y_start.value = Update_n_Y_start;
+              const int Update_m_Y_end = redistribute_no_optimization_Update_inline_c_expr15_line_259(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[9].value == &ncc->locals.m_Y_end.value);
+              ncc->locals.m_Y_end.value = Update_m_Y_end;
+              const int Update_n_Y_end = redistribute_no_optimization_Update_inline_c_expr14_line_260(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[10].value == &ncc->locals.n_Y_end.value);
+              ncc->locals.n_Y_end.value = Update_n_Y_end;
+              const int Update_m_Y = m_Y;
+              if( (Update_m_Y >= (ncc->locals.m_Y_start.value)) && (Update_m_Y <= (ncc->locals.m_Y_end.value)) ) {
+                assert(&nc.locals[11].value == &ncc->locals.m_Y.value);
+                ncc->locals.m_Y.value = Update_m_Y;
+                const int Update_n_Y = n_Y;
+                if( (Update_n_Y >= (ncc->locals.n_Y_start.value)) && (Update_n_Y <= (ncc->locals.n_Y_end.value)) ) {
+                  assert(&nc.locals[12].value == &ncc->locals.n_Y.value);
+                  ncc->locals.n_Y.value = Update_n_Y;
+                  const int Update_TL_row = redistribute_no_optimization_Update_inline_c_expr13_line_265(__parsec_tp, &ncc->locals);
+                  assert(&nc.locals[13].value == &ncc->locals.TL_row.value);
+                  ncc->locals.TL_row.value = Update_TL_row;
+                  const int Update_TL_col = redistribute_no_optimization_Update_inline_c_expr12_line_266(__parsec_tp, &ncc->locals);
+                  assert(&nc.locals[14].value == &ncc->locals.TL_col.value);
+                  ncc->locals.TL_col.value = Update_TL_col;
+                  const int Update_BR_row = ((((ncc->locals.i_start.value + ncc->locals.mb_T_inner.value) - 1) % mb_Y_INNER) + 1);
+                  assert(&nc.locals[15].value == &ncc->locals.BR_row.value);
+                  ncc->locals.BR_row.value = Update_BR_row;
+                  const int Update_BR_col = ((((ncc->locals.j_start.value + ncc->locals.nb_T_inner.value) - 1) % nb_Y_INNER) + 1);
+                  assert(&nc.locals[16].value == &ncc->locals.BR_col.value);
+                  ncc->locals.BR_col.value = Update_BR_col;
+#if defined(DISTRIBUTED)
+                  rank_dst = rank_of_descT(ncc->locals.m_T.value, ncc->locals.n_T.value);
+                  if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+                    vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descT)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descT, ncc->locals.m_T.value, ncc->locals.n_T.value);
+                  nc.priority = __parsec_tp->super.super.priority;
+                  successor_repo = Update_repo;
+                  successor_repo_key = __jdf2c_make_key_Update((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+                RELEASE_DEP_OUTPUT(es, "Y", this_task, "N", &nc, rank_src, rank_dst, &data);
+                if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_redistribute_no_optimization_Send_for_Y_dep6_atline_225, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+                  }
+                }
+              }
+            }
+          }
+    }
+  }
+  if( action_mask & 0x20 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_redistribute_no_optimization_SOURCE_ADT->arena;
+    data.local.src_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.dst_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_redistribute_no_optimization_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( ((((m_Y) == (m_Y_end) && (m_Y_start) != (m_Y_end)) && (n_Y) > (n_Y_start)) && (n_Y) < (n_Y_end)) ) {
+      __parsec_redistribute_no_optimization_Update_task_t* ncc = (__parsec_redistribute_no_optimization_Update_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[redistribute_no_optimization_Update.task_class_id];
+        const int Update_batch_col = batch_col;
+        if( (Update_batch_col >= (0)) && (Update_batch_col <= (NT)) ) {
+          assert(&nc.locals[0].value == &ncc->locals.batch_col.value);
+          ncc->locals.batch_col.value = Update_batch_col;
+          const int Update_m_T = m_T;
+          if( (Update_m_T >= (m_T_START)) && (Update_m_T <= (m_T_END)) ) {
+            assert(&nc.locals[1].value == &ncc->locals.m_T.value);
+            ncc->locals.m_T.value = Update_m_T;
+            const int Update_n_T = n_T;
+            if( (Update_n_T >= (redistribute_no_optimization_Update_inline_c_expr23_line_249(__parsec_tp, &ncc->locals))) && (Update_n_T <= (redistribute_no_optimization_Update_inline_c_expr22_line_249(__parsec_tp, &ncc->locals))) ) {
+              assert(&nc.locals[2].value == &ncc->locals.n_T.value);
+              ncc->locals.n_T.value = Update_n_T;
+              const int Update_mb_T_inner = redistribute_no_optimization_Update_inline_c_expr21_line_251(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[3].value == &ncc->locals.mb_T_inner.value);
+              ncc->locals.mb_T_inner.value = Update_mb_T_inner;
+              const int Update_nb_T_inner = redistribute_no_optimization_Update_inline_c_expr20_line_252(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[4].value == &ncc->locals.nb_T_inner.value);
+              ncc->locals.nb_T_inner.value = Update_nb_T_inner;
+              const int Update_i_start = redistribute_no_optimization_Update_inline_c_expr19_line_254(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[5].value == &ncc->locals.i_start.value);
+              ncc->locals.i_start.value = Update_i_start;
+              const int Update_j_start = redistribute_no_optimization_Update_inline_c_expr18_line_255(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[6].value == &ncc->locals.j_start.value);
+              ncc->locals.j_start.value = Update_j_start;
+              const int Update_m_Y_start = redistribute_no_optimization_Update_inline_c_expr17_line_257(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[7].value == &ncc->locals.m_Y_start.value);
+              ncc->locals.m_Y_start.value = Update_m_Y_start;
+              const int Update_n_Y_start = redistribute_no_optimization_Update_inline_c_expr16_line_258(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[8].value == &ncc->locals.n_Y_start.value);
+              ncc->locals.n_Y_start.value = Update_n_Y_start;
+              const int Update_m_Y_end = redistribute_no_optimization_Update_inline_c_expr15_line_259(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[9].value == &ncc->locals.m_Y_end.value);
+              ncc->locals.m_Y_end.value = Update_m_Y_end;
+              const int Update_n_Y_end = redistribute_no_optimization_Update_inline_c_expr14_line_260(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[10].value == &ncc->locals.n_Y_end.value);
+              ncc->locals.n_Y_end.value = Update_n_Y_end;
+              const int Update_m_Y = m_Y;
+              if( (Update_m_Y >= (ncc->locals.m_Y_start.value)) && (Update_m_Y <= (ncc->locals.m_Y_end.value)) ) {
+                assert(&nc.locals[11].value == &ncc->locals.m_Y.value);
+                ncc->locals.m_Y.value = Update_m_Y;
+                const int Update_n_Y = n_Y;
+                if( (Update_n_Y >= (ncc->locals.n_Y_start.value)) && (Update_n_Y <= (ncc->locals.n_Y_end.value)) ) {
+                  assert(&nc.locals[12].value == &ncc->locals.n_Y.value);
+                  ncc->locals.n_Y.value = Update_n_Y;
+                  const int Update_TL_row = redistribute_no_optimization_Update_inline_c_expr13_line_265(__parsec_tp, &ncc->locals);
+                  assert(&nc.locals[13].value == &ncc->locals.TL_row.value);
+                  ncc->locals.TL_row.value = Update_TL_row;
+                  const int Update_TL_col = redistribute_no_optimization_Update_inline_c_expr12_line_266(__parsec_tp, &ncc->locals);
+                  assert(&nc.locals[14].value == &ncc->locals.TL_col.value);
+                  ncc->locals.TL_col.value = Update_TL_col;
+                  const int Update_BR_row = ((((ncc->locals.i_start.value + ncc->locals.mb_T_inner.value) - 1) % mb_Y_INNER) + 1);
+                  assert(&nc.locals[15].value == &ncc->locals.BR_row.value);
+                  ncc->locals.BR_row.value = Update_BR_row;
+                  const int Update_BR_col = ((((ncc->locals.j_start.value + ncc->locals.nb_T_inner.value) - 1) % nb_Y_INNER) + 1);
+                  assert(&nc.locals[16].value == &ncc->locals.BR_col.value);
+                  ncc->locals.BR_col.value = Update_BR_col;
+#if defined(DISTRIBUTED)
+                  rank_dst = rank_of_descT(ncc->locals.m_T.value, ncc->locals.n_T.value);
+                  if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+                    vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descT)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descT, ncc->locals.m_T.value, ncc->locals.n_T.value);
+                  nc.priority = __parsec_tp->super.super.priority;
+                  successor_repo = Update_repo;
+                  successor_repo_key = __jdf2c_make_key_Update((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+                RELEASE_DEP_OUTPUT(es, "Y", this_task, "S", &nc, rank_src, rank_dst, &data);
+                if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_redistribute_no_optimization_Send_for_Y_dep7_atline_226, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+                  }
+                }
+              }
+            }
+          }
+    }
+  }
+  if( action_mask & 0x40 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_redistribute_no_optimization_SOURCE_ADT->arena;
+    data.local.src_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.dst_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_redistribute_no_optimization_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( (((n_Y) == (n_Y_start) && (m_Y) > (m_Y_start)) && (m_Y) < (m_Y_end)) ) {
+      __parsec_redistribute_no_optimization_Update_task_t* ncc = (__parsec_redistribute_no_optimization_Update_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[redistribute_no_optimization_Update.task_class_id];
+        const int Update_batch_col = batch_col;
+        if( (Update_batch_col >= (0)) && (Update_batch_col <= (NT)) ) {
+          assert(&nc.locals[0].value == &ncc->locals.batch_col.value);
+          ncc->locals.batch_col.value = Update_batch_col;
+          const int Update_m_T = m_T;
+          if( (Update_m_T >= (m_T_START)) && (Update_m_T <= (m_T_END)) ) {
+            assert(&nc.locals[1].value == &ncc->locals.m_T.value);
+            ncc->locals.m_T.value = Update_m_T;
+            const int Update_n_T = n_T;
+            if( (Update_n_T >= (redistribute_no_optimization_Update_inline_c_expr23_line_249(__parsec_tp, &ncc->locals))) && (Update_n_T <= (redistribute_no_optimization_Update_inline_c_expr22_line_249(__parsec_tp, &ncc->locals))) ) {
+              assert(&nc.locals[2].value == &ncc->locals.n_T.value);
+              ncc->locals.n_T.value = Update_n_T;
+              const int Update_mb_T_inner = redistribute_no_optimization_Update_inline_c_expr21_line_251(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[3].value == &ncc->locals.mb_T_inner.value);
+              ncc->locals.mb_T_inner.value = Update_mb_T_inner;
+              const int Update_nb_T_inner = redistribute_no_optimization_Update_inline_c_expr20_line_252(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[4].value == &ncc->locals.nb_T_inner.value);
+              ncc->locals.nb_T_inner.value = Update_nb_T_inner;
+              const int Update_i_start = redistribute_no_optimization_Update_inline_c_expr19_line_254(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[5].value == &ncc->locals.i_start.value);
+              ncc->locals.i_start.value = Update_i_start;
+              const int Update_j_start = redistribute_no_optimization_Update_inline_c_expr18_line_255(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[6].value == &ncc->locals.j_start.value);
+              ncc->locals.j_start.value = Update_j_start;
+              const int Update_m_Y_start = redistribute_no_optimization_Update_inline_c_expr17_line_257(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[7].value == &ncc->locals.m_Y_start.value);
+              ncc->locals.m_Y_start.value = Update_m_Y_start;
+              const int Update_n_Y_start = redistribute_no_optimization_Update_inline_c_expr16_line_258(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[8].value == &ncc->locals.n_Y_start.value);
+              ncc->locals.n_Y_start.value = Update_n_Y_start;
+              const int Update_m_Y_end = redistribute_no_optimization_Update_inline_c_expr15_line_259(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[9].value == &ncc->locals.m_Y_end.value);
+              ncc->locals.m_Y_end.value = Update_m_Y_end;
+              const int Update_n_Y_end = redistribute_no_optimization_Update_inline_c_expr14_line_260(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[10].value == &ncc->locals.n_Y_end.value);
+              ncc->locals.n_Y_end.value = Update_n_Y_end;
+              const int Update_m_Y = m_Y;
+              if( (Update_m_Y >= (ncc->locals.m_Y_start.value)) && (Update_m_Y <= (ncc->locals.m_Y_end.value)) ) {
+                assert(&nc.locals[11].value == &ncc->locals.m_Y.value);
+                ncc->locals.m_Y.value = Update_m_Y;
+                const int Update_n_Y = n_Y;
+                if( (Update_n_Y >= (ncc->locals.n_Y_start.value)) && (Update_n_Y <= (ncc->locals.n_Y_end.value)) ) {
+                  assert(&nc.locals[12].value == &ncc->locals.n_Y.value);
+                  ncc->locals.n_Y.value = Update_n_Y;
+                  const int Update_TL_row = redistribute_no_optimization_Update_inline_c_expr13_line_265(__parsec_tp, &ncc->locals);
+                  assert(&nc.locals[13].value == &ncc->locals.TL_row.value);
+                  ncc->locals.TL_row.value = Update_TL_row;
+                  const int Update_TL_col = redistribute_no_optimization_Update_inline_c_expr12_line_266(__parsec_tp, &ncc->locals);
+                  assert(&nc.locals[14].value == &ncc->locals.TL_col.value);
+                  ncc->locals.TL_col.value = Update_TL_col;
+                  const int Update_BR_row = ((((ncc->locals.i_start.value + ncc->locals.mb_T_inner.value) - 1) % mb_Y_INNER) + 1);
+                  assert(&nc.locals[15].value == &ncc->locals.BR_row.value);
+                  ncc->locals.BR_row.value = Update_BR_row;
+                  const int Update_BR_col = ((((ncc->locals.j_start.value + ncc->locals.nb_T_inner.value) - 1) % nb_Y_INNER) + 1);
+                  assert(&nc.locals[16].value == &ncc->locals.BR_col.value);
+                  ncc->locals.BR_col.value = Update_BR_col;
+#if defined(DISTRIBUTED)
+                  rank_dst = rank_of_descT(ncc->locals.m_T.value, ncc->locals.n_T.value);
+                  if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+                    vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descT)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descT, ncc->locals.m_T.value, ncc->locals.n_T.value);
+                  nc.priority = __parsec_tp->super.super.priority;
+                  successor_repo = Update_repo;
+                  successor_repo_key = __jdf2c_make_key_Update((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+                RELEASE_DEP_OUTPUT(es, "Y", this_task, "W", &nc, rank_src, rank_dst, &data);
+                if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_redistribute_no_optimization_Send_for_Y_dep8_atline_227, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+                  }
+                }
+              }
+            }
+          }
+    }
+  }
+  if( action_mask & 0x80 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_redistribute_no_optimization_SOURCE_ADT->arena;
+    data.local.src_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.dst_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_redistribute_no_optimization_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( ((((n_Y) == (n_Y_end) && (n_Y_start) != (n_Y_end)) && (m_Y) > (m_Y_start)) && (m_Y) < (m_Y_end)) ) {
+      __parsec_redistribute_no_optimization_Update_task_t* ncc = (__parsec_redistribute_no_optimization_Update_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[redistribute_no_optimization_Update.task_class_id];
+        const int Update_batch_col = batch_col;
+        if( (Update_batch_col >= (0)) && (Update_batch_col <= (NT)) ) {
+          assert(&nc.locals[0].value == &ncc->locals.batch_col.value);
+          ncc->locals.batch_col.value = Update_batch_col;
+          const int Update_m_T = m_T;
+          if( (Update_m_T >= (m_T_START)) && (Update_m_T <= (m_T_END)) ) {
+            assert(&nc.locals[1].value == &ncc->locals.m_T.value);
+            ncc->locals.m_T.value = Update_m_T;
+            const int Update_n_T = n_T;
+            if( (Update_n_T >= (redistribute_no_optimization_Update_inline_c_expr23_line_249(__parsec_tp, &ncc->locals))) && (Update_n_T <= (redistribute_no_optimization_Update_inline_c_expr22_line_249(__parsec_tp, &ncc->locals))) ) {
+              assert(&nc.locals[2].value == &ncc->locals.n_T.value);
+              ncc->locals.n_T.value = Update_n_T;
+              const int Update_mb_T_inner = redistribute_no_optimization_Update_inline_c_expr21_line_251(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[3].value == &ncc->locals.mb_T_inner.value);
+              ncc->locals.mb_T_inner.value = Update_mb_T_inner;
+              const int Update_nb_T_inner = redistribute_no_optimization_Update_inline_c_expr20_line_252(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[4].value == &ncc->locals.nb_T_inner.value);
+              ncc->locals.nb_T_inner.value = Update_nb_T_inner;
+              const int Update_i_start = redistribute_no_optimization_Update_inline_c_expr19_line_254(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[5].value == &ncc->locals.i_start.value);
+              ncc->locals.i_start.value = Update_i_start;
+              const int Update_j_start = redistribute_no_optimization_Update_inline_c_expr18_line_255(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[6].value == &ncc->locals.j_start.value);
+              ncc->locals.j_start.value = Update_j_start;
+              const int Update_m_Y_start = redistribute_no_optimization_Update_inline_c_expr17_line_257(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[7].value == &ncc->locals.m_Y_start.value);
+              ncc->locals.m_Y_start.value = Update_m_Y_start;
+              const int Update_n_Y_start = redistribute_no_optimization_Update_inline_c_expr16_line_258(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[8].value == &ncc->locals.n_Y_start.value);
+              ncc->locals.n_Y_start.value = Update_n_Y_start;
+              const int Update_m_Y_end = redistribute_no_optimization_Update_inline_c_expr15_line_259(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[9].value == &ncc->locals.m_Y_end.value);
+              ncc->locals.m_Y_end.value = Update_m_Y_end;
+              const int Update_n_Y_end = redistribute_no_optimization_Update_inline_c_expr14_line_260(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[10].value == &ncc->locals.n_Y_end.value);
+              ncc->locals.n_Y_end.value = Update_n_Y_end;
+              const int Update_m_Y = m_Y;
+              if( (Update_m_Y >= (ncc->locals.m_Y_start.value)) && (Update_m_Y <= (ncc->locals.m_Y_end.value)) ) {
+                assert(&nc.locals[11].value == &ncc->locals.m_Y.value);
+                ncc->locals.m_Y.value = Update_m_Y;
+                const int Update_n_Y = n_Y;
+                if( (Update_n_Y >= (ncc->locals.n_Y_start.value)) && (Update_n_Y <= (ncc->locals.n_Y_end.value)) ) {
+                  assert(&nc.locals[12].value == &ncc->locals.n_Y.value);
+                  ncc->locals.n_Y.value = Update_n_Y;
+                  const int Update_TL_row = redistribute_no_optimization_Update_inline_c_expr13_line_265(__parsec_tp, &ncc->locals);
+                  assert(&nc.locals[13].value == &ncc->locals.TL_row.value);
+                  ncc->locals.TL_row.value = Update_TL_row;
+                  const int Update_TL_col = redistribute_no_optimization_Update_inline_c_expr12_line_266(__parsec_tp, &ncc->locals);
+                  assert(&nc.locals[14].value == &ncc->locals.TL_col.value);
+                  ncc->locals.TL_col.value = Update_TL_col;
+                  const int Update_BR_row = ((((ncc->locals.i_start.value + ncc->locals.mb_T_inner.value) - 1) % mb_Y_INNER) + 1);
+                  assert(&nc.locals[15].value == &ncc->locals.BR_row.value);
+                  ncc->locals.BR_row.value = Update_BR_row;
+                  const int Update_BR_col = ((((ncc->locals.j_start.value + ncc->locals.nb_T_inner.value) - 1) % nb_Y_INNER) + 1);
+                  assert(&nc.locals[16].value == &ncc->locals.BR_col.value);
+                  ncc->locals.BR_col.value = Update_BR_col;
+#if defined(DISTRIBUTED)
+                  rank_dst = rank_of_descT(ncc->locals.m_T.value, ncc->locals.n_T.value);
+                  if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+                    vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descT)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descT, ncc->locals.m_T.value, ncc->locals.n_T.value);
+                  nc.priority = __parsec_tp->super.super.priority;
+                  successor_repo = Update_repo;
+                  successor_repo_key = __jdf2c_make_key_Update((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+                RELEASE_DEP_OUTPUT(es, "Y", this_task, "E", &nc, rank_src, rank_dst, &data);
+                if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_redistribute_no_optimization_Send_for_Y_dep9_atline_228, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+                  }
+                }
+              }
+            }
+          }
+    }
+  }
+  if( action_mask & 0x100 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_redistribute_no_optimization_SOURCE_ADT->arena;
+    data.local.src_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.dst_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_redistribute_no_optimization_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( ((((m_Y) > (m_Y_start) && (m_Y) < (m_Y_end)) && (n_Y) > (n_Y_start)) && (n_Y) < (n_Y_end)) ) {
+      __parsec_redistribute_no_optimization_Update_task_t* ncc = (__parsec_redistribute_no_optimization_Update_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[redistribute_no_optimization_Update.task_class_id];
+        const int Update_batch_col = batch_col;
+        if( (Update_batch_col >= (0)) && (Update_batch_col <= (NT)) ) {
+          assert(&nc.locals[0].value == &ncc->locals.batch_col.value);
+          ncc->locals.batch_col.value = Update_batch_col;
+          const int Update_m_T = m_T;
+          if( (Update_m_T >= (m_T_START)) && (Update_m_T <= (m_T_END)) ) {
+            assert(&nc.locals[1].value == &ncc->locals.m_T.value);
+            ncc->locals.m_T.value = Update_m_T;
+            const int Update_n_T = n_T;
+            if( (Update_n_T >= (redistribute_no_optimization_Update_inline_c_expr23_line_249(__parsec_tp, &ncc->locals))) && (Update_n_T <= (redistribute_no_optimization_Update_inline_c_expr22_line_249(__parsec_tp, &ncc->locals))) ) {
+              assert(&nc.locals[2].value == &ncc->locals.n_T.value);
+              ncc->locals.n_T.value = Update_n_T;
+              const int Update_mb_T_inner = redistribute_no_optimization_Update_inline_c_expr21_line_251(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[3].value == &ncc->locals.mb_T_inner.value);
+              ncc->locals.mb_T_inner.value = Update_mb_T_inner;
+              const int Update_nb_T_inner = redistribute_no_optimization_Update_inline_c_expr20_line_252(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[4].value == &ncc->locals.nb_T_inner.value);
+              ncc->locals.nb_T_inner.value = Update_nb_T_inner;
+              const int Update_i_start = redistribute_no_optimization_Update_inline_c_expr19_line_254(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[5].value == &ncc->locals.i_start.value);
+              ncc->locals.i_start.value = Update_i_start;
+              const int Update_j_start = redistribute_no_optimization_Update_inline_c_expr18_line_255(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[6].value == &ncc->locals.j_start.value);
+              ncc->locals.j_start.value = Update_j_start;
+              const int Update_m_Y_start = redistribute_no_optimization_Update_inline_c_expr17_line_257(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[7].value == &ncc->locals.m_Y_start.value);
+              ncc->locals.m_Y_start.value = Update_m_Y_start;
+              const int Update_n_Y_start = redistribute_no_optimization_Update_inline_c_expr16_line_258(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[8].value == &ncc->locals.n_Y_start.value);
+              ncc->locals.n_Y_start.value = Update_n_Y_start;
+              const int Update_m_Y_end = redistribute_no_optimization_Update_inline_c_expr15_line_259(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[9].value == &ncc->locals.m_Y_end.value);
+              ncc->locals.m_Y_end.value = Update_m_Y_end;
+              const int Update_n_Y_end = redistribute_no_optimization_Update_inline_c_expr14_line_260(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[10].value == &ncc->locals.n_Y_end.value);
+              ncc->locals.n_Y_end.value = Update_n_Y_end;
+              const int Update_m_Y = m_Y;
+              if( (Update_m_Y >= (ncc->locals.m_Y_start.value)) && (Update_m_Y <= (ncc->locals.m_Y_end.value)) ) {
+                assert(&nc.locals[11].value == &ncc->locals.m_Y.value);
+                ncc->locals.m_Y.value = Update_m_Y;
+                const int Update_n_Y = n_Y;
+                if( (Update_n_Y >= (ncc->locals.n_Y_start.value)) && (Update_n_Y <= (ncc->locals.n_Y_end.value)) ) {
+                  assert(&nc.locals[12].value == &ncc->locals.n_Y.value);
+                  ncc->locals.n_Y.value = Update_n_Y;
+                  const int Update_TL_row = redistribute_no_optimization_Update_inline_c_expr13_line_265(__parsec_tp, &ncc->locals);
+                  assert(&nc.locals[13].value == &ncc->locals.TL_row.value);
+                  ncc->locals.TL_row.value = Update_TL_row;
+                  const int Update_TL_col = redistribute_no_optimization_Update_inline_c_expr12_line_266(__parsec_tp, &ncc->locals);
+                  assert(&nc.locals[14].value == &ncc->locals.TL_col.value);
+                  ncc->locals.TL_col.value = Update_TL_col;
+                  const int Update_BR_row = ((((ncc->locals.i_start.value + ncc->locals.mb_T_inner.value) - 1) % mb_Y_INNER) + 1);
+                  assert(&nc.locals[15].value == &ncc->locals.BR_row.value);
+                  ncc->locals.BR_row.value = Update_BR_row;
+                  const int Update_BR_col = ((((ncc->locals.j_start.value + ncc->locals.nb_T_inner.value) - 1) % nb_Y_INNER) + 1);
+                  assert(&nc.locals[16].value == &ncc->locals.BR_col.value);
+                  ncc->locals.BR_col.value = Update_BR_col;
+#if defined(DISTRIBUTED)
+                  rank_dst = rank_of_descT(ncc->locals.m_T.value, ncc->locals.n_T.value);
+                  if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+                    vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descT)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descT, ncc->locals.m_T.value, ncc->locals.n_T.value);
+                  nc.priority = __parsec_tp->super.super.priority;
+                  successor_repo = Update_repo;
+                  successor_repo_key = __jdf2c_make_key_Update((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+                RELEASE_DEP_OUTPUT(es, "Y", this_task, "I", &nc, rank_src, rank_dst, &data);
+                if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_redistribute_no_optimization_Send_for_Y_dep10_atline_229, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+                  }
+                }
+              }
+            }
+          }
+    }
+  }
+  }
+  /* Flow of data ctl has only IN dependencies */
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static void
+iterate_predecessors_of_redistribute_no_optimization_Send(parsec_execution_stream_t *es, const __parsec_redistribute_no_optimization_Send_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp = (const __parsec_redistribute_no_optimization_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_redistribute_no_optimization_Send_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_redistribute_no_optimization_Send_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int batch_col = __jdf2c__tmp_locals.batch_col.value; (void)batch_col;
+  const int m_T = __jdf2c__tmp_locals.m_T.value; (void)m_T;
+  const int n_T = __jdf2c__tmp_locals.n_T.value; (void)n_T;
+  const int mb_T_inner = __jdf2c__tmp_locals.mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = __jdf2c__tmp_locals.nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = __jdf2c__tmp_locals.i_start.value; (void)i_start;
+  const int j_start = __jdf2c__tmp_locals.j_start.value; (void)j_start;
+  const int m_Y_start = __jdf2c__tmp_locals.m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = __jdf2c__tmp_locals.n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = __jdf2c__tmp_locals.m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = __jdf2c__tmp_locals.n_Y_end.value; (void)n_Y_end;
+  const int m_Y = __jdf2c__tmp_locals.m_Y.value; (void)m_Y;
+  const int n_Y = __jdf2c__tmp_locals.n_Y.value; (void)n_Y;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)batch_col;  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)i_start;  (void)j_start;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;  (void)m_Y;  (void)n_Y;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_descY(m_Y, n_Y);
+#endif
+  /* Flow of data Y has only OUTPUT dependencies to Memory */
+  if( action_mask & 0x2 ) {  /* Flow of data ctl [1] */
+    data.data   = this_task->data._f_ctl.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x2 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  =   /* Control: always empty */ 0;
+    data.local.dst_count  =   /* Control: always empty */ 0;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = NULL;
+    data.remote.src_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.src_count  =   /* Control: always empty */ 0;
+    data.remote.dst_count  =   /* Control: always empty */ 0;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( (batch_col) > (0) ) {
+      __parsec_redistribute_no_optimization_Receive_task_t* ncc = (__parsec_redistribute_no_optimization_Receive_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[redistribute_no_optimization_Receive.task_class_id];
+        const int Receive_batch_col = (batch_col - 1);
+        if( (Receive_batch_col >= (0)) && (Receive_batch_col <= (NT)) ) {
+          assert(&nc.locals[0].value == &ncc->locals.batch_col.value);
+          ncc->locals.batch_col.value = Receive_batch_col;
+          const int Receive_m_T = m_T;
+          if( (Receive_m_T >= (m_T_START)) && (Receive_m_T <= (m_T_END)) ) {
+            assert(&nc.locals[1].value == &ncc->locals.m_T.value);
+            ncc->locals.m_T.value = Receive_m_T;
+            const int Receive_n_T = (n_T - num_col);
+            if( (Receive_n_T >= (redistribute_no_optimization_Receive_inline_c_expr11_line_315(__parsec_tp, &ncc->locals))) && (Receive_n_T <= (redistribute_no_optimization_Receive_inline_c_expr10_line_315(__parsec_tp, &ncc->locals))) ) {
+              assert(&nc.locals[2].value == &ncc->locals.n_T.value);
+              ncc->locals.n_T.value = Receive_n_T;
+              const int Receive_mb_T_inner = redistribute_no_optimization_Receive_inline_c_expr9_line_317(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[3].value == &ncc->locals.mb_T_inner.value);
+              ncc->locals.mb_T_inner.value = Receive_mb_T_inner;
+              const int Receive_nb_T_inner = redistribute_no_optimization_Receive_inline_c_expr8_line_318(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[4].value == &ncc->locals.nb_T_inner.value);
+              ncc->locals.nb_T_inner.value = Receive_nb_T_inner;
+              const int Receive_nb_T_inner_next = redistribute_no_optimization_Receive_inline_c_expr7_line_320(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[5].value == &ncc->locals.nb_T_inner_next.value);
+              ncc->locals.nb_T_inner_next.value = Receive_nb_T_inner_next;
+              const int Receive_sizei_T = (((ncc->locals.m_T.value - m_T_START) * mb_T_INNER) - (disi_T % mb_T_INNER));
+              assert(&nc.locals[6].value == &ncc->locals.sizei_T.value);
+              ncc->locals.sizei_T.value = Receive_sizei_T;
+              const int Receive_sizej_T = (((ncc->locals.n_T.value - n_T_START) * nb_T_INNER) - (disj_T % nb_T_INNER));
+              assert(&nc.locals[7].value == &ncc->locals.sizej_T.value);
+              ncc->locals.sizej_T.value = Receive_sizej_T;
+              const int Receive_i_start = redistribute_no_optimization_Receive_inline_c_expr6_line_325(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[8].value == &ncc->locals.i_start.value);
+              ncc->locals.i_start.value = Receive_i_start;
+              const int Receive_j_start = redistribute_no_optimization_Receive_inline_c_expr5_line_326(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[9].value == &ncc->locals.j_start.value);
+              ncc->locals.j_start.value = Receive_j_start;
+              const int Receive_m_Y_start = redistribute_no_optimization_Receive_inline_c_expr4_line_328(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[10].value == &ncc->locals.m_Y_start.value);
+              ncc->locals.m_Y_start.value = Receive_m_Y_start;
+              const int Receive_n_Y_start = redistribute_no_optimization_Receive_inline_c_expr3_line_329(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[11].value == &ncc->locals.n_Y_start.value);
+              ncc->locals.n_Y_start.value = Receive_n_Y_start;
+              const int Receive_m_Y_end = redistribute_no_optimization_Receive_inline_c_expr2_line_330(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[12].value == &ncc->locals.m_Y_end.value);
+              ncc->locals.m_Y_end.value = Receive_m_Y_end;
+              const int Receive_n_Y_end = redistribute_no_optimization_Receive_inline_c_expr1_line_331(__parsec_tp, &ncc->locals);
+              assert(&nc.locals[13].value == &ncc->locals.n_Y_end.value);
+              ncc->locals.n_Y_end.value = Receive_n_Y_end;
+              const int Receive_n_Y_start_next = ((((((ncc->locals.n_T.value - n_T_START) + num_col) * nb_T_INNER) - (disj_T % nb_T_INNER)) + disj_Y) / nb_Y_INNER);
+              assert(&nc.locals[14].value == &ncc->locals.n_Y_start_next.value);
+              ncc->locals.n_Y_start_next.value = Receive_n_Y_start_next;
+              const int Receive_n_Y_end_next = ((((((((ncc->locals.n_T.value - n_T_START) + num_col) * nb_T_INNER) - (disj_T % nb_T_INNER)) + disj_Y) + ncc->locals.nb_T_inner_next.value) - 1) / nb_Y_INNER);
+              assert(&nc.locals[15].value == &ncc->locals.n_Y_end_next.value);
+              ncc->locals.n_Y_end_next.value = Receive_n_Y_end_next;
+#if defined(DISTRIBUTED)
+              rank_dst = rank_of_descT(ncc->locals.m_T.value, ncc->locals.n_T.value);
+              if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+                vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descT)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descT, ncc->locals.m_T.value, ncc->locals.n_T.value);
+              nc.priority = __parsec_tp->super.super.priority;
+              successor_repo = Receive_repo;
+              successor_repo_key = __jdf2c_make_key_Receive((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+            RELEASE_DEP_OUTPUT(es, "ctl", this_task, "ctl2", &nc, rank_src, rank_dst, &data);
+            if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_redistribute_no_optimization_Send_for_ctl_dep1_atline_231, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+              }
+            }
+          }
+    }
+  }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static int release_deps_of_redistribute_no_optimization_Send(parsec_execution_stream_t *es, __parsec_redistribute_no_optimization_Send_task_t *this_task, uint32_t action_mask, parsec_remote_deps_t *deps)
+{
+  PARSEC_PINS(es, RELEASE_DEPS_BEGIN, (parsec_task_t *)this_task);  const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp = (const __parsec_redistribute_no_optimization_internal_taskpool_t *)this_task->taskpool;
+  parsec_release_dep_fct_arg_t arg;
+  int __vp_id;
+  int consume_local_repo = 0;
+  arg.action_mask = action_mask;
+  arg.output_entry = NULL;
+  arg.output_repo = NULL;
+#if defined(DISTRIBUTED)
+  arg.remote_deps = deps;
+#endif  /* defined(DISTRIBUTED) */
+  assert(NULL != es);
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS )    arg.ready_lists = alloca(sizeof(parsec_task_t *) * es->virtual_process->parsec_context->nb_vp);
+  else
+    arg.ready_lists = NULL;
+  for( __vp_id = 0; __vp_id < es->virtual_process->parsec_context->nb_vp; arg.ready_lists[__vp_id++] = NULL );
+  (void)__parsec_tp; (void)deps;
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_Y.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_Y.source_repo, this_task->data._f_Y.source_repo_entry->ht_item.key );
+    }
+  }
+  consume_local_repo = (this_task->repo_entry != NULL);
+  arg.output_repo = Send_repo;
+  arg.output_entry = this_task->repo_entry;
+  arg.output_usage = 0;
+  if( action_mask & (PARSEC_ACTION_RELEASE_LOCAL_DEPS | PARSEC_ACTION_GET_REPO_ENTRY) ) {
+    arg.output_entry = data_repo_lookup_entry_and_create( es, arg.output_repo, __jdf2c_make_key_Send((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    arg.output_entry->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(arg.output_entry->sim_exec_date == 0);
+    arg.output_entry->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  if(action_mask & ( PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE ) ){
+    /* Generate the reshape promise for the outputs that need it */
+    iterate_successors_of_redistribute_no_optimization_Send(es, this_task, action_mask, parsec_set_up_reshape_promise, &arg);
+   }
+  iterate_successors_of_redistribute_no_optimization_Send(es, this_task, action_mask, parsec_release_dep_fct, &arg);
+
+#if defined(DISTRIBUTED)
+  if( (action_mask & PARSEC_ACTION_SEND_REMOTE_DEPS) && (NULL != arg.remote_deps)) {
+    parsec_remote_dep_activate(es, (parsec_task_t *)this_task, arg.remote_deps, arg.remote_deps->outgoing_mask);
+  }
+#endif
+
+  if(action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS) {
+    data_repo_entry_addto_usage_limit(Send_repo, arg.output_entry->ht_item.key, arg.output_usage);
+    __parsec_schedule_vp(es, arg.ready_lists, 0);
+  }
+      if (consume_local_repo) {
+         data_repo_entry_used_once( Send_repo, this_task->repo_entry->ht_item.key );
+      }
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_Y.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_Y.data_in);
+    }
+  }
+  PARSEC_PINS(es, RELEASE_DEPS_END, (parsec_task_t *)this_task);  return 0;
+}
+
+static int data_lookup_of_redistribute_no_optimization_Send(parsec_execution_stream_t *es, __parsec_redistribute_no_optimization_Send_task_t *this_task)
+{
+  const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_no_optimization_internal_taskpool_t *)this_task->taskpool;
+  parsec_assignment_t generic_locals[MAX_PARAM_COUNT];  /* generic task locals */
+  int target_device = 0; (void)target_device;
+  (void)__parsec_tp; (void)generic_locals; (void)es;
+  parsec_data_copy_t *chunk = NULL;
+  data_repo_t        *reshape_repo  = NULL, *consumed_repo  = NULL;
+  data_repo_entry_t  *reshape_entry = NULL, *consumed_entry = NULL;
+  parsec_key_t        reshape_entry_key = 0, consumed_entry_key = 0;
+  uint8_t             consumed_flow_index;
+  parsec_dep_data_description_t data;
+  int ret;
+  (void)reshape_repo; (void)reshape_entry; (void)reshape_entry_key;
+  (void)consumed_repo; (void)consumed_entry; (void)consumed_entry_key;
+  (void)consumed_flow_index;
+  (void)chunk; (void)data; (void)ret;
+  const int batch_col = this_task->locals.batch_col.value; (void)batch_col;
+  const int m_T = this_task->locals.m_T.value; (void)m_T;
+  const int n_T = this_task->locals.n_T.value; (void)n_T;
+  const int mb_T_inner = this_task->locals.mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = this_task->locals.nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = this_task->locals.i_start.value; (void)i_start;
+  const int j_start = this_task->locals.j_start.value; (void)j_start;
+  const int m_Y_start = this_task->locals.m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = this_task->locals.n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = this_task->locals.m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = this_task->locals.n_Y_end.value; (void)n_Y_end;
+  const int m_Y = this_task->locals.m_Y.value; (void)m_Y;
+  const int n_Y = this_task->locals.n_Y.value; (void)n_Y;
+  if( NULL == this_task->repo_entry ){
+    this_task->repo_entry = data_repo_lookup_entry_and_create(es, Send_repo,                                       __jdf2c_make_key_Send((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    data_repo_entry_addto_usage_limit(Send_repo, this_task->repo_entry->ht_item.key, 1);    this_task->repo_entry ->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(this_task->repo_entry ->sim_exec_date == 0);
+    this_task->repo_entry ->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  /* The reshape repo is the current task repo. */  reshape_repo = Send_repo;
+  reshape_entry_key = __jdf2c_make_key_Send((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals) ;
+  reshape_entry = this_task->repo_entry;
+  /* Lookup the input data, and store them in the context if any */
+
+if(! this_task->data._f_Y.fulfill ){ /* Flow Y */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_Y.data_out = NULL;  /* By default, if nothing matches */
+  /* Flow Y [0] dependency [0] from memory descY */
+  if( NULL == (chunk = this_task->data._f_Y.data_in) ) {
+  /* No data set up by predecessor on this task input flow */
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+  parsec_prof_grapher_data_input(data_of_descY(m_Y, n_Y), (parsec_task_t*)this_task, &flow_of_redistribute_no_optimization_Send_for_Y, 1);
+#endif
+    chunk = parsec_data_get_copy(data_of_descY(m_Y, n_Y), target_device);
+    data.data = chunk;
+    data.data_future  = NULL;
+        data.local.arena  = PARSEC_redistribute_no_optimization_SOURCE_ADT->arena;
+    data.local.src_datatype = data.data->dtt;
+    data.local.dst_datatype = PARSEC_redistribute_no_optimization_SOURCE_ADT->opaque_dtt;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.data_future   = NULL;
+    if( (ret = parsec_get_copy_reshape_from_desc(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    this_task->data._f_Y.data_out = chunk;
+    PARSEC_OBJ_RETAIN(chunk);
+  } 
+    this_task->data._f_Y.data_in     = chunk;
+    this_task->data._f_Y.source_repo       = consumed_repo;
+    this_task->data._f_Y.source_repo_entry = consumed_entry;
+    if( this_task->data._f_Y.source_repo_entry == this_task->repo_entry ){
+      /* in case we have consume from this task repo entry for the flow,
+       * it is cleaned up, avoiding having old stuff during release_deps_of
+       */
+      this_task->repo_entry->data[0] = NULL;
+    }
+    this_task->data._f_Y.fulfill = 1;
+}
+
+  /* ctl is a control flow */
+  this_task->data._f_ctl.data_in         = NULL;
+  this_task->data._f_ctl.data_out        = NULL;
+  this_task->data._f_ctl.source_repo       = NULL;
+  this_task->data._f_ctl.source_repo_entry = NULL;
+  /** Generate profiling information */
+#if defined(PARSEC_PROF_TRACE)
+  this_task->prof_info.desc = (parsec_data_collection_t*)__parsec_tp->super._g_descY;
+  this_task->prof_info.priority = this_task->priority;
+  this_task->prof_info.data_id   = ((parsec_data_collection_t*)__parsec_tp->super._g_descY)->data_key((parsec_data_collection_t*)__parsec_tp->super._g_descY, m_Y, n_Y);
+  this_task->prof_info.task_class_id = this_task->task_class->task_class_id;
+  this_task->prof_info.task_return_code = -1;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int datatype_lookup_of_redistribute_no_optimization_Send(parsec_execution_stream_t *es, const parsec_task_t *this_generic_task, const parsec_task_t *parent_task,
+              uint32_t* flow_mask, parsec_dep_data_description_t* data)
+{
+  const __parsec_redistribute_no_optimization_Send_task_t *this_task = (__parsec_redistribute_no_optimization_Send_task_t*)this_generic_task;
+  const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_no_optimization_internal_taskpool_t *)this_task->taskpool;
+  (void)__parsec_tp; (void)es; (void)this_task; (void)data; (void)parent_task;
+  const int batch_col = this_task->locals.batch_col.value; (void)batch_col;
+  const int m_T = this_task->locals.m_T.value; (void)m_T;
+  const int n_T = this_task->locals.n_T.value; (void)n_T;
+  const int mb_T_inner = this_task->locals.mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = this_task->locals.nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = this_task->locals.i_start.value; (void)i_start;
+  const int j_start = this_task->locals.j_start.value; (void)j_start;
+  const int m_Y_start = this_task->locals.m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = this_task->locals.n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = this_task->locals.m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = this_task->locals.n_Y_end.value; (void)n_Y_end;
+  const int m_Y = this_task->locals.m_Y.value; (void)m_Y;
+  const int n_Y = this_task->locals.n_Y.value; (void)n_Y;
+  data->local.arena = data->remote.arena = NULL;
+  data->local.src_datatype  = data->local.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->local.src_count     = data->local.dst_count = 0;
+  data->local.src_displ     = data->local.dst_displ = 0;
+  data->data_future  = NULL;
+  if( (*flow_mask) & 0x80000000U ) { /* these are the input dependencies remote datatypes  */
+if( (*flow_mask) & 0x1U ) {  /* Flow Y */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_redistribute_no_optimization_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_redistribute_no_optimization_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_redistribute_no_optimization_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+    goto no_mask_match;
+  }
+
+  /* these are the output dependencies remote datatypes */
+if( (*flow_mask) & 0x1ffU ) {  /* Flow Y */
+    if( ((*flow_mask) & 0x1ffU)
+ && (((m_Y) == (m_Y_start) && (n_Y) == (n_Y_start)) || (((m_Y) == (m_Y_start) && (n_Y) == (n_Y_end)) && (n_Y_start) != (n_Y_end)) || (((m_Y) == (m_Y_end) && (n_Y) == (n_Y_start)) && (m_Y_start) != (m_Y_end)) || ((((m_Y) == (m_Y_end) && (n_Y) == (n_Y_end)) && (m_Y_start) != (m_Y_end)) && (n_Y_start) != (n_Y_end)) || (((m_Y) == (m_Y_start) && (n_Y) > (n_Y_start)) && (n_Y) < (n_Y_end)) || ((((m_Y) == (m_Y_end) && (m_Y_start) != (m_Y_end)) && (n_Y) > (n_Y_start)) && (n_Y) < (n_Y_end)) || (((n_Y) == (n_Y_start) && (m_Y) > (m_Y_start)) && (m_Y) < (m_Y_end)) || ((((n_Y) == (n_Y_end) && (n_Y_start) != (n_Y_end)) && (m_Y) > (m_Y_start)) && (m_Y) < (m_Y_end)) || ((((m_Y) > (m_Y_start) && (m_Y) < (m_Y_end)) && (n_Y) > (n_Y_start)) && (n_Y) < (n_Y_end))) ) {
+    data->remote.arena  =  PARSEC_redistribute_no_optimization_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_redistribute_no_optimization_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_redistribute_no_optimization_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1ffU;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1ffU) */
+ no_mask_match:
+  data->data                             = NULL;
+  data->remote.src_datatype = data->remote.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->remote.src_count    = data->remote.dst_count = 0;
+  data->remote.src_displ    = data->remote.dst_displ = 0;
+  data->data_future  = NULL;
+  (*flow_mask) = 0;  /* nothing left */
+  (void)batch_col;  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)i_start;  (void)j_start;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;  (void)m_Y;  (void)n_Y;
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+static int hook_of_redistribute_no_optimization_Send(parsec_execution_stream_t *es, __parsec_redistribute_no_optimization_Send_task_t *this_task)
+{
+  __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_no_optimization_internal_taskpool_t *)this_task->taskpool;
+  (void)es; (void)__parsec_tp;
+  const int batch_col = this_task->locals.batch_col.value; (void)batch_col;
+  const int m_T = this_task->locals.m_T.value; (void)m_T;
+  const int n_T = this_task->locals.n_T.value; (void)n_T;
+  const int mb_T_inner = this_task->locals.mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = this_task->locals.nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = this_task->locals.i_start.value; (void)i_start;
+  const int j_start = this_task->locals.j_start.value; (void)j_start;
+  const int m_Y_start = this_task->locals.m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = this_task->locals.n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = this_task->locals.m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = this_task->locals.n_Y_end.value; (void)n_Y_end;
+  const int m_Y = this_task->locals.m_Y.value; (void)m_Y;
+  const int n_Y = this_task->locals.n_Y.value; (void)n_Y;
+  (void)batch_col;  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)i_start;  (void)j_start;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;  (void)m_Y;  (void)n_Y;
+
+  /** Declare the variables that will hold the data, and all the accounting for each */
+  parsec_data_copy_t *_f_Y = this_task->data._f_Y.data_in;
+  void *Y = PARSEC_DATA_COPY_GET_PTR(_f_Y); (void)Y;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    data_repo_entry_t *eY = this_task->data._f_Y.source_repo_entry;
+    if( (NULL != eY) && (eY->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eY->sim_exec_date;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+  /** Cache Awareness Accounting */
+#if defined(PARSEC_CACHE_AWARENESS)
+  cache_buf_referenced(es->closest_cache, Y);
+#endif /* PARSEC_CACHE_AWARENESS */
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                                  Send BODY                                    -----*/
+
+{
+}
+
+/*-----                                END OF Send BODY                                -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#endif  /*  defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+static int complete_hook_of_redistribute_no_optimization_Send(parsec_execution_stream_t *es, __parsec_redistribute_no_optimization_Send_task_t *this_task)
+{
+  const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_no_optimization_internal_taskpool_t *)this_task->taskpool;
+#if defined(DISTRIBUTED)
+    const int batch_col = this_task->locals.batch_col.value; (void)batch_col;
+  const int m_T = this_task->locals.m_T.value; (void)m_T;
+  const int n_T = this_task->locals.n_T.value; (void)n_T;
+  const int mb_T_inner = this_task->locals.mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = this_task->locals.nb_T_inner.value; (void)nb_T_inner;
+  const int i_start = this_task->locals.i_start.value; (void)i_start;
+  const int j_start = this_task->locals.j_start.value; (void)j_start;
+  const int m_Y_start = this_task->locals.m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = this_task->locals.n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = this_task->locals.m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = this_task->locals.n_Y_end.value; (void)n_Y_end;
+  const int m_Y = this_task->locals.m_Y.value; (void)m_Y;
+  const int n_Y = this_task->locals.n_Y.value; (void)n_Y;
+#endif  /* defined(DISTRIBUTED) */
+  (void)es; (void)__parsec_tp;
+parsec_data_t* data_t_desc = NULL; (void)data_t_desc;
+#if defined(DISTRIBUTED)
+  /** If not working on distributed, there is no risk that data is not in place */
+  (void)batch_col;  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)i_start;  (void)j_start;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;  (void)m_Y;  (void)n_Y;
+
+#endif /* DISTRIBUTED */
+#if defined(PARSEC_PROF_GRAPHER)
+  parsec_prof_grapher_task((parsec_task_t*)this_task, es->th_id, es->virtual_process->vp_id,
+     __jdf2c_key_fns_Send.key_hash(this_task->task_class->make_key( (parsec_taskpool_t*)this_task->taskpool, ((parsec_task_t*)this_task)->locals), NULL));
+#endif  /* defined(PARSEC_PROF_GRAPHER) */
+  release_deps_of_redistribute_no_optimization_Send(es, this_task,
+      PARSEC_ACTION_RELEASE_REMOTE_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_REFS |
+      PARSEC_ACTION_RESHAPE_ON_RELEASE |
+      0x1ff,  /* mask of all dep_index */ 
+      NULL);
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static parsec_hook_return_t release_task_of_redistribute_no_optimization_Send(parsec_execution_stream_t *es, parsec_task_t *this_task)
+{
+    const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp =
+        (const __parsec_redistribute_no_optimization_internal_taskpool_t *)this_task->taskpool;
+    parsec_hash_table_t *ht = (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[1];
+    parsec_key_t key = this_task->task_class->make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals);
+    parsec_hashable_dependency_t *hash_dep = (parsec_hashable_dependency_t *)parsec_hash_table_remove(ht, key);
+    parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);
+    return parsec_release_task_to_mempool_update_nbtasks(es, this_task);
+}
+
+static char *redistribute_no_optimization_redistribute_no_optimization_Send_internal_init_deps_key_functions_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_no_optimization_internal_taskpool_t *)user_data;
+  __parsec_redistribute_no_optimization_Send_parsec_assignment_t __jdf2c__assignments = {  .batch_col.value = 0, .m_T.value = 0, .n_T.value = 0, .mb_T_inner.value = 0, .nb_T_inner.value = 0, .i_start.value = 0, .j_start.value = 0, .m_Y_start.value = 0, .n_Y_start.value = 0, .m_Y_end.value = 0, .n_Y_end.value = 0, .m_Y.value = 0, .n_Y.value = 0 };
+  int batch_col = (__parsec_key) % __parsec_tp->Send_batch_col_range + __parsec_tp->Send_batch_col_min;
+  __parsec_key = __parsec_key / __parsec_tp->Send_batch_col_range;
+  __jdf2c__assignments.batch_col.value = batch_col;
+  int m_T = (__parsec_key) % __parsec_tp->Send_m_T_range + __parsec_tp->Send_m_T_min;
+  __parsec_key = __parsec_key / __parsec_tp->Send_m_T_range;
+  __jdf2c__assignments.m_T.value = m_T;
+  int n_T = (__parsec_key) % __parsec_tp->Send_n_T_range + __parsec_tp->Send_n_T_min;
+  __parsec_key = __parsec_key / __parsec_tp->Send_n_T_range;
+  __jdf2c__assignments.n_T.value = n_T;
+  int mb_T_inner = redistribute_no_optimization_Send_inline_c_expr31_line_204(__parsec_tp, &__jdf2c__assignments);
+  (void)mb_T_inner;
+  __jdf2c__assignments.mb_T_inner.value = mb_T_inner;
+  int nb_T_inner = redistribute_no_optimization_Send_inline_c_expr30_line_205(__parsec_tp, &__jdf2c__assignments);
+  (void)nb_T_inner;
+  __jdf2c__assignments.nb_T_inner.value = nb_T_inner;
+  int i_start = redistribute_no_optimization_Send_inline_c_expr29_line_207(__parsec_tp, &__jdf2c__assignments);
+  (void)i_start;
+  __jdf2c__assignments.i_start.value = i_start;
+  int j_start = redistribute_no_optimization_Send_inline_c_expr28_line_208(__parsec_tp, &__jdf2c__assignments);
+  (void)j_start;
+  __jdf2c__assignments.j_start.value = j_start;
+  int m_Y_start = redistribute_no_optimization_Send_inline_c_expr27_line_210(__parsec_tp, &__jdf2c__assignments);
+  (void)m_Y_start;
+  __jdf2c__assignments.m_Y_start.value = m_Y_start;
+  int n_Y_start = redistribute_no_optimization_Send_inline_c_expr26_line_211(__parsec_tp, &__jdf2c__assignments);
+  (void)n_Y_start;
+  __jdf2c__assignments.n_Y_start.value = n_Y_start;
+  int m_Y_end = redistribute_no_optimization_Send_inline_c_expr25_line_212(__parsec_tp, &__jdf2c__assignments);
+  (void)m_Y_end;
+  __jdf2c__assignments.m_Y_end.value = m_Y_end;
+  int n_Y_end = redistribute_no_optimization_Send_inline_c_expr24_line_213(__parsec_tp, &__jdf2c__assignments);
+  (void)n_Y_end;
+  __jdf2c__assignments.n_Y_end.value = n_Y_end;
+  int m_Y = (__parsec_key) % __parsec_tp->Send_m_Y_range + __parsec_tp->Send_m_Y_min;
+  __parsec_key = __parsec_key / __parsec_tp->Send_m_Y_range;
+  __jdf2c__assignments.m_Y.value = m_Y;
+  int n_Y = (__parsec_key) % __parsec_tp->Send_n_Y_range + __parsec_tp->Send_n_Y_min;
+  __parsec_key = __parsec_key / __parsec_tp->Send_n_Y_range;
+  __jdf2c__assignments.n_Y.value = n_Y;
+  (void)__jdf2c__assignments;
+  snprintf(buffer, buffer_size, "Send(%d, %d, %d, %d, %d)", batch_col, m_T, n_T, m_Y, n_Y);
+  return buffer;
+}
+
+static parsec_key_fn_t redistribute_no_optimization_redistribute_no_optimization_Send_internal_init_deps_key_functions = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = redistribute_no_optimization_redistribute_no_optimization_Send_internal_init_deps_key_functions_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/* Needs: min-max count-tasks iterate */
+static int redistribute_no_optimization_Send_internal_init(parsec_execution_stream_t * es, __parsec_redistribute_no_optimization_Send_task_t * this_task)
+{
+  __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_no_optimization_internal_taskpool_t*)this_task->taskpool;
+  int32_t nb_tasks = 0, saved_nb_tasks = 0;
+int32_t __batch_col_min = 0x7fffffff, __batch_col_max = 0;int32_t __jdf2c_batch_col_min = 0x7fffffff, __jdf2c_batch_col_max = 0;int32_t __m_T_min = 0x7fffffff, __m_T_max = 0;int32_t __jdf2c_m_T_min = 0x7fffffff, __jdf2c_m_T_max = 0;int32_t __n_T_min = 0x7fffffff, __n_T_max = 0;int32_t __jdf2c_n_T_min = 0x7fffffff, __jdf2c_n_T_max = 0;int32_t __m_Y_min = 0x7fffffff, __m_Y_max = 0;int32_t __jdf2c_m_Y_min = 0x7fffffff, __jdf2c_m_Y_max = 0;int32_t __n_Y_min = 0x7fffffff, __n_Y_max = 0;int32_t __jdf2c_n_Y_min = 0x7fffffff, __jdf2c_n_Y_max = 0;  __parsec_redistribute_no_optimization_Send_parsec_assignment_t assignments = {  .batch_col.value = 0, .m_T.value = 0, .n_T.value = 0, .mb_T_inner.value = 0, .nb_T_inner.value = 0, .i_start.value = 0, .j_start.value = 0, .m_Y_start.value = 0, .n_Y_start.value = 0, .m_Y_end.value = 0, .n_Y_end.value = 0, .m_Y.value = 0, .n_Y.value = 0 };
+  int32_t  batch_col,  m_T,  n_T,  mb_T_inner,  nb_T_inner,  i_start,  j_start,  m_Y_start,  n_Y_start,  m_Y_end,  n_Y_end,  m_Y,  n_Y;
+  int32_t __jdf2c_batch_col_start, __jdf2c_batch_col_end, __jdf2c_batch_col_inc;
+  int32_t __jdf2c_m_T_start, __jdf2c_m_T_end, __jdf2c_m_T_inc;
+  int32_t __jdf2c_n_T_start, __jdf2c_n_T_end, __jdf2c_n_T_inc;
+  int32_t __jdf2c_m_Y_start, __jdf2c_m_Y_end, __jdf2c_m_Y_inc;
+  int32_t __jdf2c_n_Y_start, __jdf2c_n_Y_end, __jdf2c_n_Y_inc;
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+  PARSEC_PROFILING_TRACE(es->es_profile,
+                         this_task->taskpool->profiling_array[START_KEY(this_task->task_class->task_class_id)],
+                         0,
+                         this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    __jdf2c_batch_col_start = 0;
+    __jdf2c_batch_col_end = NT;
+    __jdf2c_batch_col_inc = 1;
+    __batch_col_min = parsec_imin(__jdf2c_batch_col_start, __jdf2c_batch_col_end);
+    __batch_col_max = parsec_imax(__jdf2c_batch_col_start, __jdf2c_batch_col_end);
+    __jdf2c_batch_col_min = parsec_imin(__jdf2c_batch_col_min, __batch_col_min);
+    __jdf2c_batch_col_max = parsec_imax(__jdf2c_batch_col_max, __batch_col_max);
+    for(batch_col =  __jdf2c_batch_col_start;
+        batch_col <= __jdf2c_batch_col_end;
+        batch_col += __jdf2c_batch_col_inc) {
+    assignments.batch_col.value = batch_col;
+      __jdf2c_m_T_start = m_T_START;
+      __jdf2c_m_T_end = m_T_END;
+      __jdf2c_m_T_inc = 1;
+      __m_T_min = parsec_imin(__jdf2c_m_T_start, __jdf2c_m_T_end);
+      __m_T_max = parsec_imax(__jdf2c_m_T_start, __jdf2c_m_T_end);
+      __jdf2c_m_T_min = parsec_imin(__jdf2c_m_T_min, __m_T_min);
+      __jdf2c_m_T_max = parsec_imax(__jdf2c_m_T_max, __m_T_max);
+      for(m_T =  __jdf2c_m_T_start;
+          m_T <= __jdf2c_m_T_end;
+          m_T += __jdf2c_m_T_inc) {
+      assignments.m_T.value = m_T;
+        __jdf2c_n_T_start = redistribute_no_optimization_Send_inline_c_expr33_line_202(__parsec_tp, &assignments);
+        __jdf2c_n_T_end = redistribute_no_optimization_Send_inline_c_expr32_line_202(__parsec_tp, &assignments);
+        __jdf2c_n_T_inc = 1;
+        __n_T_min = parsec_imin(__jdf2c_n_T_start, __jdf2c_n_T_end);
+        __n_T_max = parsec_imax(__jdf2c_n_T_start, __jdf2c_n_T_end);
+        __jdf2c_n_T_min = parsec_imin(__jdf2c_n_T_min, __n_T_min);
+        __jdf2c_n_T_max = parsec_imax(__jdf2c_n_T_max, __n_T_max);
+        for(n_T =  __jdf2c_n_T_start;
+            n_T <= __jdf2c_n_T_end;
+            n_T += __jdf2c_n_T_inc) {
+        assignments.n_T.value = n_T;
+      {  /* block for the non-range variable mb_T_inner */
+          mb_T_inner = redistribute_no_optimization_Send_inline_c_expr31_line_204(__parsec_tp, &assignments);
+          assignments.mb_T_inner.value = mb_T_inner;
+        {  /* block for the non-range variable nb_T_inner */
+            nb_T_inner = redistribute_no_optimization_Send_inline_c_expr30_line_205(__parsec_tp, &assignments);
+            assignments.nb_T_inner.value = nb_T_inner;
+          {  /* block for the non-range variable i_start */
+              i_start = redistribute_no_optimization_Send_inline_c_expr29_line_207(__parsec_tp, &assignments);
+              assignments.i_start.value = i_start;
+            {  /* block for the non-range variable j_start */
+                j_start = redistribute_no_optimization_Send_inline_c_expr28_line_208(__parsec_tp, &assignments);
+                assignments.j_start.value = j_start;
+              {  /* block for the non-range variable m_Y_start */
+                  m_Y_start = redistribute_no_optimization_Send_inline_c_expr27_line_210(__parsec_tp, &assignments);
+                  assignments.m_Y_start.value = m_Y_start;
+                {  /* block for the non-range variable n_Y_start */
+                    n_Y_start = redistribute_no_optimization_Send_inline_c_expr26_line_211(__parsec_tp, &assignments);
+                    assignments.n_Y_start.value = n_Y_start;
+                  {  /* block for the non-range variable m_Y_end */
+                      m_Y_end = redistribute_no_optimization_Send_inline_c_expr25_line_212(__parsec_tp, &assignments);
+                      assignments.m_Y_end.value = m_Y_end;
+                    {  /* block for the non-range variable n_Y_end */
+                        n_Y_end = redistribute_no_optimization_Send_inline_c_expr24_line_213(__parsec_tp, &assignments);
+                        assignments.n_Y_end.value = n_Y_end;
+                          __jdf2c_m_Y_start = m_Y_start;
+                          __jdf2c_m_Y_end = m_Y_end;
+                          __jdf2c_m_Y_inc = 1;
+                          __m_Y_min = parsec_imin(__jdf2c_m_Y_start, __jdf2c_m_Y_end);
+                          __m_Y_max = parsec_imax(__jdf2c_m_Y_start, __jdf2c_m_Y_end);
+                          __jdf2c_m_Y_min = parsec_imin(__jdf2c_m_Y_min, __m_Y_min);
+                          __jdf2c_m_Y_max = parsec_imax(__jdf2c_m_Y_max, __m_Y_max);
+                          for(m_Y =  __jdf2c_m_Y_start;
+                              m_Y <= __jdf2c_m_Y_end;
+                              m_Y += __jdf2c_m_Y_inc) {
+                          assignments.m_Y.value = m_Y;
+                            __jdf2c_n_Y_start = n_Y_start;
+                            __jdf2c_n_Y_end = n_Y_end;
+                            __jdf2c_n_Y_inc = 1;
+                            __n_Y_min = parsec_imin(__jdf2c_n_Y_start, __jdf2c_n_Y_end);
+                            __n_Y_max = parsec_imax(__jdf2c_n_Y_start, __jdf2c_n_Y_end);
+                            __jdf2c_n_Y_min = parsec_imin(__jdf2c_n_Y_min, __n_Y_min);
+                            __jdf2c_n_Y_max = parsec_imax(__jdf2c_n_Y_max, __n_Y_max);
+                            for(n_Y =  __jdf2c_n_Y_start;
+                                n_Y <= __jdf2c_n_Y_end;
+                                n_Y += __jdf2c_n_Y_inc) {
+                            assignments.n_Y.value = n_Y;
+                            if( !Send_pred(batch_col, m_T, n_T, mb_T_inner, nb_T_inner, i_start, j_start, m_Y_start, n_Y_start, m_Y_end, n_Y_end, m_Y, n_Y) ) continue;
+                            nb_tasks++;
+                          } /* Loop on normal range n_Y */
+                        } /* For loop of m_Y */ 
+                      } /* Non-range variable n_Y_end */ 
+                    } /* Non-range variable m_Y_end */ 
+                  } /* Non-range variable n_Y_start */ 
+                } /* Non-range variable m_Y_start */ 
+              } /* Non-range variable j_start */ 
+            } /* Non-range variable i_start */ 
+          } /* Non-range variable nb_T_inner */ 
+        } /* Non-range variable mb_T_inner */ 
+      } /* For loop of n_T */ 
+    } /* For loop of m_T */ 
+  } /* For loop of batch_col */ 
+   if( 0 != nb_tasks ) {
+     (void)parsec_atomic_fetch_add_int32(&__parsec_tp->initial_number_tasks, nb_tasks);
+   }
+  /* Set the range variables for the collision-free hash-computation */
+  __parsec_tp->Send_batch_col_min   = __jdf2c_batch_col_min;
+  __parsec_tp->Send_batch_col_range = (__jdf2c_batch_col_max - __jdf2c_batch_col_min) + 1;
+  __parsec_tp->Send_m_T_min   = __jdf2c_m_T_min;
+  __parsec_tp->Send_m_T_range = (__jdf2c_m_T_max - __jdf2c_m_T_min) + 1;
+  __parsec_tp->Send_n_T_min   = __jdf2c_n_T_min;
+  __parsec_tp->Send_n_T_range = (__jdf2c_n_T_max - __jdf2c_n_T_min) + 1;
+  __parsec_tp->Send_m_Y_min   = __jdf2c_m_Y_min;
+  __parsec_tp->Send_m_Y_range = (__jdf2c_m_Y_max - __jdf2c_m_Y_min) + 1;
+  __parsec_tp->Send_n_Y_min   = __jdf2c_n_Y_min;
+  __parsec_tp->Send_n_Y_range = (__jdf2c_n_Y_max - __jdf2c_n_Y_min) + 1;
+    do {
+      this_task->super.list_next = (parsec_list_item_t*)__parsec_tp->startup_queue;
+    } while(!parsec_atomic_cas_ptr(&__parsec_tp->startup_queue, (parsec_list_item_t*)this_task->super.list_next, this_task));
+    this_task->status = PARSEC_TASK_STATUS_HOOK;
+
+  PARSEC_AYU_REGISTER_TASK(&redistribute_no_optimization_Send);
+  __parsec_tp->super.super.dependencies_array[1] = PARSEC_OBJ_NEW(parsec_hash_table_t);
+  parsec_hash_table_init(__parsec_tp->super.super.dependencies_array[1], offsetof(parsec_hashable_dependency_t, ht_item), 10, redistribute_no_optimization_redistribute_no_optimization_Send_internal_init_deps_key_functions, this_task->taskpool);
+  __parsec_tp->repositories[1] = data_repo_create_nothreadsafe(nb_tasks, __jdf2c_key_fns_Send, (parsec_taskpool_t*)__parsec_tp, 2);
+(void)saved_nb_tasks;
+(void)__batch_col_min; (void)__batch_col_max;(void)__m_T_min; (void)__m_T_max;(void)__n_T_min; (void)__n_T_max;(void)__m_Y_min; (void)__m_Y_max;(void)__n_Y_min; (void)__n_Y_max;  (void)__jdf2c_batch_col_start; (void)__jdf2c_batch_col_end; (void)__jdf2c_batch_col_inc;  (void)__jdf2c_m_T_start; (void)__jdf2c_m_T_end; (void)__jdf2c_m_T_inc;  (void)__jdf2c_n_T_start; (void)__jdf2c_n_T_end; (void)__jdf2c_n_T_inc;  (void)__jdf2c_m_Y_start; (void)__jdf2c_m_Y_end; (void)__jdf2c_m_Y_inc;  (void)__jdf2c_n_Y_start; (void)__jdf2c_n_Y_end; (void)__jdf2c_n_Y_inc;  (void)assignments; (void)__parsec_tp; (void)es;
+  if(1 == parsec_atomic_fetch_dec_int32(&__parsec_tp->sync_point)) {
+    /* Last initialization task complete. Update the number of tasks. */
+    __parsec_tp->super.super.tdm.module->taskpool_addto_nb_tasks(&__parsec_tp->super.super, __parsec_tp->initial_number_tasks);
+    parsec_mfence();  /* write memory barrier to guarantee that the scheduler gets the correct number of tasks */
+    parsec_taskpool_enable((parsec_taskpool_t*)__parsec_tp, &__parsec_tp->startup_queue,
+                           (parsec_task_t*)this_task, es, __parsec_tp->super.super.nb_pending_actions);
+    __parsec_tp->super.super.tdm.module->taskpool_ready(&__parsec_tp->super.super);
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+    PARSEC_PROFILING_TRACE(es->es_profile,
+                           this_task->taskpool->profiling_array[2 * this_task->task_class->task_class_id + 1],
+                           0,
+                           this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    if( 1 >= __parsec_tp->super.super.nb_pending_actions ) {
+        /* if no tasks will be generated let's prevent the runtime from calling the hook and instead go directly to complete the task */
+        this_task->status = PARSEC_TASK_STATUS_COMPLETE;
+    }
+    return PARSEC_HOOK_RETURN_DONE;
+  }
+  return PARSEC_HOOK_RETURN_ASYNC;
+}
+
+static int __jdf2c_startup_Send(parsec_execution_stream_t * es, __parsec_redistribute_no_optimization_Send_task_t *this_task)
+{
+  __parsec_redistribute_no_optimization_Send_task_t* new_task;
+  __parsec_redistribute_no_optimization_internal_taskpool_t* __parsec_tp = (__parsec_redistribute_no_optimization_internal_taskpool_t*)this_task->taskpool;
+  parsec_context_t *context = __parsec_tp->super.super.context;
+  int vpid = 0, nb_tasks = 0;
+  size_t total_nb_tasks = 0;
+  parsec_list_item_t* pready_ring[context->nb_vp];
+  int restore_context = 0;
+  int batch_col = this_task->locals.batch_col.value;  /* retrieve value saved during the last iteration */
+  int m_T = this_task->locals.m_T.value;  /* retrieve value saved during the last iteration */
+  int n_T = this_task->locals.n_T.value;  /* retrieve value saved during the last iteration */
+  int mb_T_inner = this_task->locals.mb_T_inner.value;  /* retrieve value saved during the last iteration */
+  int nb_T_inner = this_task->locals.nb_T_inner.value;  /* retrieve value saved during the last iteration */
+  int i_start = this_task->locals.i_start.value;  /* retrieve value saved during the last iteration */
+  int j_start = this_task->locals.j_start.value;  /* retrieve value saved during the last iteration */
+  int m_Y_start = this_task->locals.m_Y_start.value;  /* retrieve value saved during the last iteration */
+  int n_Y_start = this_task->locals.n_Y_start.value;  /* retrieve value saved during the last iteration */
+  int m_Y_end = this_task->locals.m_Y_end.value;  /* retrieve value saved during the last iteration */
+  int n_Y_end = this_task->locals.n_Y_end.value;  /* retrieve value saved during the last iteration */
+  int m_Y = this_task->locals.m_Y.value;  /* retrieve value saved during the last iteration */
+  int n_Y = this_task->locals.n_Y.value;  /* retrieve value saved during the last iteration */
+  for(int _i = 0; _i < context->nb_vp; pready_ring[_i++] = NULL );
+  if( 0 != this_task->locals.reserved[0].value ) {
+    this_task->locals.reserved[0].value = 1; /* reset the submission process */
+    restore_context = 1;
+    goto restore_context_0;
+  }
+  this_task->locals.reserved[0].value = 1; /* a sane default value */
+  for(this_task->locals.batch_col.value = batch_col = 0;
+      this_task->locals.batch_col.value <= NT;
+      this_task->locals.batch_col.value += 1, batch_col = this_task->locals.batch_col.value) {
+    for(this_task->locals.m_T.value = m_T = m_T_START;
+        this_task->locals.m_T.value <= m_T_END;
+        this_task->locals.m_T.value += 1, m_T = this_task->locals.m_T.value) {
+      for(this_task->locals.n_T.value = n_T = redistribute_no_optimization_Send_inline_c_expr33_line_202(__parsec_tp, &this_task->locals);
+          this_task->locals.n_T.value <= redistribute_no_optimization_Send_inline_c_expr32_line_202(__parsec_tp, &this_task->locals);
+          this_task->locals.n_T.value += 1, n_T = this_task->locals.n_T.value) {
+        this_task->locals.mb_T_inner.value = mb_T_inner = redistribute_no_optimization_Send_inline_c_expr31_line_204(__parsec_tp, &this_task->locals);
+        this_task->locals.nb_T_inner.value = nb_T_inner = redistribute_no_optimization_Send_inline_c_expr30_line_205(__parsec_tp, &this_task->locals);
+        this_task->locals.i_start.value = i_start = redistribute_no_optimization_Send_inline_c_expr29_line_207(__parsec_tp, &this_task->locals);
+        this_task->locals.j_start.value = j_start = redistribute_no_optimization_Send_inline_c_expr28_line_208(__parsec_tp, &this_task->locals);
+        this_task->locals.m_Y_start.value = m_Y_start = redistribute_no_optimization_Send_inline_c_expr27_line_210(__parsec_tp, &this_task->locals);
+        this_task->locals.n_Y_start.value = n_Y_start = redistribute_no_optimization_Send_inline_c_expr26_line_211(__parsec_tp, &this_task->locals);
+        this_task->locals.m_Y_end.value = m_Y_end = redistribute_no_optimization_Send_inline_c_expr25_line_212(__parsec_tp, &this_task->locals);
+        this_task->locals.n_Y_end.value = n_Y_end = redistribute_no_optimization_Send_inline_c_expr24_line_213(__parsec_tp, &this_task->locals);
+        for(this_task->locals.m_Y.value = m_Y = m_Y_start;
+            this_task->locals.m_Y.value <= m_Y_end;
+            this_task->locals.m_Y.value += 1, m_Y = this_task->locals.m_Y.value) {
+          for(this_task->locals.n_Y.value = n_Y = n_Y_start;
+              this_task->locals.n_Y.value <= n_Y_end;
+              this_task->locals.n_Y.value += 1, n_Y = this_task->locals.n_Y.value) {
+            if( !Send_pred(batch_col, m_T, n_T, mb_T_inner, nb_T_inner, i_start, j_start, m_Y_start, n_Y_start, m_Y_end, n_Y_end, m_Y, n_Y) ) continue;
+  __parsec_redistribute_no_optimization_Send_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_redistribute_no_optimization_Send_parsec_assignment_t*)&this_task->locals;
+  (void)__jdf2c__tmp_locals;
+  /* Flow for Y is always a memory reference */
+  if( (batch_col) > (0) ) continue; /* ctl2 Receive() is not a memory reference for flow ctl */
+            if( NULL != ((parsec_data_collection_t*)__parsec_tp->super._g_descY)->vpid_of ) {
+              vpid = ((parsec_data_collection_t*)__parsec_tp->super._g_descY)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descY, m_Y, n_Y);
+              assert(context->nb_vp >= vpid);
+            } else {
+              vpid = (vpid + 1) % context->nb_vp;  /* spread the initial joy */
+            }
+            new_task = (__parsec_redistribute_no_optimization_Send_task_t*)parsec_thread_mempool_allocate( context->virtual_processes[vpid]->execution_streams[0]->context_mempool );
+            PARSEC_OBJ_CONSTRUCT(new_task, parsec_task_t); /* construct called only when new, force-construct it again */
+            /* Copy only the valid elements from this_task to new_task one */
+            new_task->taskpool   = this_task->taskpool;
+            new_task->task_class = __parsec_tp->super.super.task_classes_array[redistribute_no_optimization_Send.task_class_id];
+            new_task->chore_mask   = PARSEC_DEV_ALL;
+            new_task->locals.batch_col.value = this_task->locals.batch_col.value;
+            new_task->locals.m_T.value = this_task->locals.m_T.value;
+            new_task->locals.n_T.value = this_task->locals.n_T.value;
+            new_task->locals.mb_T_inner.value = this_task->locals.mb_T_inner.value;
+            new_task->locals.nb_T_inner.value = this_task->locals.nb_T_inner.value;
+            new_task->locals.i_start.value = this_task->locals.i_start.value;
+            new_task->locals.j_start.value = this_task->locals.j_start.value;
+            new_task->locals.m_Y_start.value = this_task->locals.m_Y_start.value;
+            new_task->locals.n_Y_start.value = this_task->locals.n_Y_start.value;
+            new_task->locals.m_Y_end.value = this_task->locals.m_Y_end.value;
+            new_task->locals.n_Y_end.value = this_task->locals.n_Y_end.value;
+            new_task->locals.m_Y.value = this_task->locals.m_Y.value;
+            new_task->locals.n_Y.value = this_task->locals.n_Y.value;
+            PARSEC_LIST_ITEM_SINGLETON(new_task);
+            new_task->priority = __parsec_tp->super.super.priority;
+            new_task->repo_entry = NULL;
+            new_task->data._f_Y.source_repo_entry = NULL;
+            new_task->data._f_Y.source_repo       = NULL;
+            new_task->data._f_Y.data_in         = NULL;
+            new_task->data._f_Y.data_out        = NULL;
+            new_task->data._f_Y.fulfill         = 0;
+            new_task->data._f_ctl.source_repo_entry = NULL;
+            new_task->data._f_ctl.source_repo       = NULL;
+            new_task->data._f_ctl.data_in         = NULL;
+            new_task->data._f_ctl.data_out        = NULL;
+            new_task->data._f_ctl.fulfill         = 0;
+#if defined(PARSEC_DEBUG_NOISIER)
+            {
+              char tmp[128];
+              PARSEC_DEBUG_VERBOSE(10, parsec_debug_output, "Add startup task %s to vpid %d",
+                     parsec_task_snprintf(tmp, 128, (parsec_task_t*)new_task), vpid);
+            }
+#endif
+            parsec_dependencies_mark_task_as_startup((parsec_task_t*)new_task, es);
+            pready_ring[vpid] = parsec_list_item_ring_push_sorted(pready_ring[vpid],
+                                                                  (parsec_list_item_t*)new_task,
+                                                                  parsec_execution_context_priority_comparator);
+            nb_tasks++;
+           restore_context_0:  /* we jump here just so that we have code after the label */
+            restore_context = 0;
+            (void)restore_context;
+            if( nb_tasks > this_task->locals.reserved[0].value ) {
+              if( (size_t)this_task->locals.reserved[0].value < parsec_task_startup_iter ) this_task->locals.reserved[0].value <<= 1;
+              __parsec_schedule_vp(es, (parsec_task_t**)pready_ring, 0);
+              total_nb_tasks += nb_tasks;
+              nb_tasks = 0;
+              if( total_nb_tasks > parsec_task_startup_chunk ) {  /* stop here and request to be rescheduled */
+                return PARSEC_HOOK_RETURN_AGAIN;
+              }
+            }
+          } /* Loop on normal range n_Y */
+        } /* Loop on normal range m_Y */
+      } /* Loop on normal range n_T */
+    } /* Loop on normal range m_T */
+  } /* Loop on normal range batch_col */
+  (void)vpid;
+  if( 0 != nb_tasks ) {
+    __parsec_schedule_vp(es, (parsec_task_t**)pready_ring, 0);
+    nb_tasks = 0;
+  }
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static const __parsec_chore_t __redistribute_no_optimization_Send_chores[] ={
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+    { .type     = PARSEC_DEV_CPU,
+      .evaluate = (parsec_evaluate_function_t*)NULL,
+      .hook     = (parsec_hook_t*)hook_of_redistribute_no_optimization_Send },
+#endif  /* defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+    { .type     = PARSEC_DEV_NONE,
+      .evaluate = NULL,
+      .hook     = (parsec_hook_t*)NULL },  /* End marker */
+};
+
+static const parsec_task_class_t redistribute_no_optimization_Send = {
+  .name = "Send",
+  .task_class_id = 1,
+  .nb_flows = 2,
+  .nb_parameters = 5,
+  .nb_locals = 13,
+  .task_class_type = PARSEC_TASK_CLASS_TYPE_PTG,
+  .params = { &symb_redistribute_no_optimization_Send_m_Y, &symb_redistribute_no_optimization_Send_n_Y, &symb_redistribute_no_optimization_Send_m_T, &symb_redistribute_no_optimization_Send_n_T, &symb_redistribute_no_optimization_Send_batch_col, NULL },
+  .locals = { &symb_redistribute_no_optimization_Send_batch_col, &symb_redistribute_no_optimization_Send_m_T, &symb_redistribute_no_optimization_Send_n_T, &symb_redistribute_no_optimization_Send_mb_T_inner, &symb_redistribute_no_optimization_Send_nb_T_inner, &symb_redistribute_no_optimization_Send_i_start, &symb_redistribute_no_optimization_Send_j_start, &symb_redistribute_no_optimization_Send_m_Y_start, &symb_redistribute_no_optimization_Send_n_Y_start, &symb_redistribute_no_optimization_Send_m_Y_end, &symb_redistribute_no_optimization_Send_n_Y_end, &symb_redistribute_no_optimization_Send_m_Y, &symb_redistribute_no_optimization_Send_n_Y, NULL },
+  .data_affinity = (parsec_data_ref_fn_t*)affinity_of_redistribute_no_optimization_Send,
+  .initial_data = (parsec_data_ref_fn_t*)affinity_of_redistribute_no_optimization_Send,
+  .final_data = (parsec_data_ref_fn_t*)affinity_of_redistribute_no_optimization_Send,
+  .priority = NULL,
+  .properties = properties_of_redistribute_no_optimization_Send,
+#if MAX_PARAM_COUNT < 1  /* number of read flows of Send */
+  #error Too many read flows for task Send
+#endif  /* MAX_PARAM_COUNT */
+#if MAX_PARAM_COUNT < 0  /* number of write flows of Send */
+  #error Too many write flows for task Send
+#endif  /* MAX_PARAM_COUNT */
+  .in = { &flow_of_redistribute_no_optimization_Send_for_Y, &flow_of_redistribute_no_optimization_Send_for_ctl, NULL },
+  .out = { &flow_of_redistribute_no_optimization_Send_for_Y, NULL },
+  .flags = 0x0 | PARSEC_HAS_IN_IN_DEPENDENCIES | PARSEC_USE_DEPS_MASK,
+  .dependencies_goal = 0x3,
+  .make_key = __jdf2c_make_key_Send,
+  .task_snprintf = parsec_task_snprintf,
+#if defined(PARSEC_PROF_TRACE)
+  .profile_info = &parsec_task_profile_info,
+#endif
+  .key_functions = &__jdf2c_key_fns_Send,
+  .fini = (parsec_hook_t*)NULL,
+  .incarnations = __redistribute_no_optimization_Send_chores,
+  .find_deps = parsec_hash_find_deps,
+  .update_deps = parsec_update_deps_with_mask,
+  .iterate_successors = (parsec_traverse_function_t*)iterate_successors_of_redistribute_no_optimization_Send,
+  .iterate_predecessors = (parsec_traverse_function_t*)iterate_predecessors_of_redistribute_no_optimization_Send,
+  .release_deps = (parsec_release_deps_t*)release_deps_of_redistribute_no_optimization_Send,
+  .prepare_output = (parsec_hook_t*)NULL,
+  .prepare_input = (parsec_hook_t*)data_lookup_of_redistribute_no_optimization_Send,
+  .time_estimate = NULL,
+  .get_datatype = datatype_lookup_of_redistribute_no_optimization_Send,
+  .complete_execution = (parsec_hook_t*)complete_hook_of_redistribute_no_optimization_Send,
+  .release_task = &release_task_of_redistribute_no_optimization_Send,
+#if defined(PARSEC_SIM)
+  .sim_cost_fct = (parsec_sim_cost_fct_t*)NULL,
+#endif
+};
+
+
+/******                                      Init                                      ******/
+
+static inline int32_t minexpr_of_symb_redistribute_no_optimization_Init_batch_col_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Init_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_redistribute_no_optimization_Init_batch_col = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_redistribute_no_optimization_Init_batch_col_fct }
+                   }
+};
+static inline int maxexpr_of_symb_redistribute_no_optimization_Init_batch_col_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Init_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int mb_T_inner = locals->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = locals->nb_T_inner.value; (void)nb_T_inner;
+  const int sizei_T = locals->sizei_T.value; (void)sizei_T;
+  const int sizej_T = locals->sizej_T.value; (void)sizej_T;
+  const int m_Y_start = locals->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = locals->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = locals->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = locals->n_Y_end.value; (void)n_Y_end;
+
+  (void)batch_col;
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)sizei_T;
+  (void)sizej_T;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)__parsec_tp; (void)locals;
+  return NT;
+}
+static const parsec_expr_t maxexpr_of_symb_redistribute_no_optimization_Init_batch_col = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_redistribute_no_optimization_Init_batch_col_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_no_optimization_Init_batch_col = { .name = "batch_col", .context_index = 0, .min = &minexpr_of_symb_redistribute_no_optimization_Init_batch_col, .max = &maxexpr_of_symb_redistribute_no_optimization_Init_batch_col, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int minexpr_of_symb_redistribute_no_optimization_Init_m_T_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Init_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int mb_T_inner = locals->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = locals->nb_T_inner.value; (void)nb_T_inner;
+  const int sizei_T = locals->sizei_T.value; (void)sizei_T;
+  const int sizej_T = locals->sizej_T.value; (void)sizej_T;
+  const int m_Y_start = locals->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = locals->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = locals->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = locals->n_Y_end.value; (void)n_Y_end;
+
+  (void)batch_col;
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)sizei_T;
+  (void)sizej_T;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)__parsec_tp; (void)locals;
+  return m_T_START;
+}
+static const parsec_expr_t minexpr_of_symb_redistribute_no_optimization_Init_m_T = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_redistribute_no_optimization_Init_m_T_fct }
+                   }
+};
+static inline int maxexpr_of_symb_redistribute_no_optimization_Init_m_T_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Init_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int mb_T_inner = locals->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = locals->nb_T_inner.value; (void)nb_T_inner;
+  const int sizei_T = locals->sizei_T.value; (void)sizei_T;
+  const int sizej_T = locals->sizej_T.value; (void)sizej_T;
+  const int m_Y_start = locals->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = locals->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = locals->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = locals->n_Y_end.value; (void)n_Y_end;
+
+  (void)batch_col;
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)sizei_T;
+  (void)sizej_T;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)__parsec_tp; (void)locals;
+  return m_T_END;
+}
+static const parsec_expr_t maxexpr_of_symb_redistribute_no_optimization_Init_m_T = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_redistribute_no_optimization_Init_m_T_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_no_optimization_Init_m_T = { .name = "m_T", .context_index = 1, .min = &minexpr_of_symb_redistribute_no_optimization_Init_m_T, .max = &maxexpr_of_symb_redistribute_no_optimization_Init_m_T, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int32_t minexpr_of_symb_redistribute_no_optimization_Init_n_T_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Init_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_no_optimization_Init_inline_c_expr41_line_166(__parsec_tp, locals);
+}
+static const parsec_expr_t minexpr_of_symb_redistribute_no_optimization_Init_n_T = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_redistribute_no_optimization_Init_n_T_fct }
+                   }
+};
+static inline int32_t maxexpr_of_symb_redistribute_no_optimization_Init_n_T_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Init_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_no_optimization_Init_inline_c_expr40_line_166(__parsec_tp, locals);
+}
+static const parsec_expr_t maxexpr_of_symb_redistribute_no_optimization_Init_n_T = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_redistribute_no_optimization_Init_n_T_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_no_optimization_Init_n_T = { .name = "n_T", .context_index = 2, .min = &minexpr_of_symb_redistribute_no_optimization_Init_n_T, .max = &maxexpr_of_symb_redistribute_no_optimization_Init_n_T, .cst_inc = 1, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_redistribute_no_optimization_Init_mb_T_inner_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Init_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_no_optimization_Init_inline_c_expr39_line_168(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_redistribute_no_optimization_Init_mb_T_inner = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_no_optimization_Init_mb_T_inner_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_no_optimization_Init_mb_T_inner = { .name = "mb_T_inner", .context_index = 3, .min = &expr_of_symb_redistribute_no_optimization_Init_mb_T_inner, .max = &expr_of_symb_redistribute_no_optimization_Init_mb_T_inner, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_redistribute_no_optimization_Init_nb_T_inner_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Init_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_no_optimization_Init_inline_c_expr38_line_169(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_redistribute_no_optimization_Init_nb_T_inner = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_no_optimization_Init_nb_T_inner_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_no_optimization_Init_nb_T_inner = { .name = "nb_T_inner", .context_index = 4, .min = &expr_of_symb_redistribute_no_optimization_Init_nb_T_inner, .max = &expr_of_symb_redistribute_no_optimization_Init_nb_T_inner, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int expr_of_symb_redistribute_no_optimization_Init_sizei_T_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Init_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int mb_T_inner = locals->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = locals->nb_T_inner.value; (void)nb_T_inner;
+  const int sizei_T = locals->sizei_T.value; (void)sizei_T;
+  const int sizej_T = locals->sizej_T.value; (void)sizej_T;
+  const int m_Y_start = locals->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = locals->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = locals->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = locals->n_Y_end.value; (void)n_Y_end;
+
+  (void)batch_col;
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)sizei_T;
+  (void)sizej_T;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)__parsec_tp; (void)locals;
+  return (((m_T - m_T_START) * mb_T_INNER) - (disi_T % mb_T_INNER));
+}
+static const parsec_expr_t expr_of_symb_redistribute_no_optimization_Init_sizei_T = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_no_optimization_Init_sizei_T_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_no_optimization_Init_sizei_T = { .name = "sizei_T", .context_index = 5, .min = &expr_of_symb_redistribute_no_optimization_Init_sizei_T, .max = &expr_of_symb_redistribute_no_optimization_Init_sizei_T, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int expr_of_symb_redistribute_no_optimization_Init_sizej_T_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Init_parsec_assignment_t *locals)
+{
+  const int batch_col = locals->batch_col.value; (void)batch_col;
+  const int m_T = locals->m_T.value; (void)m_T;
+  const int n_T = locals->n_T.value; (void)n_T;
+  const int mb_T_inner = locals->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = locals->nb_T_inner.value; (void)nb_T_inner;
+  const int sizei_T = locals->sizei_T.value; (void)sizei_T;
+  const int sizej_T = locals->sizej_T.value; (void)sizej_T;
+  const int m_Y_start = locals->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = locals->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = locals->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = locals->n_Y_end.value; (void)n_Y_end;
+
+  (void)batch_col;
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)sizei_T;
+  (void)sizej_T;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  (void)__parsec_tp; (void)locals;
+  return (((n_T - n_T_START) * nb_T_INNER) - (disj_T % nb_T_INNER));
+}
+static const parsec_expr_t expr_of_symb_redistribute_no_optimization_Init_sizej_T = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_no_optimization_Init_sizej_T_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_no_optimization_Init_sizej_T = { .name = "sizej_T", .context_index = 6, .min = &expr_of_symb_redistribute_no_optimization_Init_sizej_T, .max = &expr_of_symb_redistribute_no_optimization_Init_sizej_T, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_redistribute_no_optimization_Init_m_Y_start_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Init_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_no_optimization_Init_inline_c_expr37_line_174(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_redistribute_no_optimization_Init_m_Y_start = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_no_optimization_Init_m_Y_start_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_no_optimization_Init_m_Y_start = { .name = "m_Y_start", .context_index = 7, .min = &expr_of_symb_redistribute_no_optimization_Init_m_Y_start, .max = &expr_of_symb_redistribute_no_optimization_Init_m_Y_start, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_redistribute_no_optimization_Init_n_Y_start_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Init_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_no_optimization_Init_inline_c_expr36_line_175(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_redistribute_no_optimization_Init_n_Y_start = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_no_optimization_Init_n_Y_start_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_no_optimization_Init_n_Y_start = { .name = "n_Y_start", .context_index = 8, .min = &expr_of_symb_redistribute_no_optimization_Init_n_Y_start, .max = &expr_of_symb_redistribute_no_optimization_Init_n_Y_start, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_redistribute_no_optimization_Init_m_Y_end_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Init_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_no_optimization_Init_inline_c_expr35_line_176(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_redistribute_no_optimization_Init_m_Y_end = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_no_optimization_Init_m_Y_end_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_no_optimization_Init_m_Y_end = { .name = "m_Y_end", .context_index = 9, .min = &expr_of_symb_redistribute_no_optimization_Init_m_Y_end, .max = &expr_of_symb_redistribute_no_optimization_Init_m_Y_end, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_redistribute_no_optimization_Init_n_Y_end_fct(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Init_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return redistribute_no_optimization_Init_inline_c_expr34_line_177(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_redistribute_no_optimization_Init_n_Y_end = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_redistribute_no_optimization_Init_n_Y_end_fct }
+                   }
+};
+static const parsec_symbol_t symb_redistribute_no_optimization_Init_n_Y_end = { .name = "n_Y_end", .context_index = 10, .min = &expr_of_symb_redistribute_no_optimization_Init_n_Y_end, .max = &expr_of_symb_redistribute_no_optimization_Init_n_Y_end, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int affinity_of_redistribute_no_optimization_Init(const __parsec_redistribute_no_optimization_Init_task_t *this_task,
+                     parsec_data_ref_t *ref)
+{
+    const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp = (const __parsec_redistribute_no_optimization_internal_taskpool_t*)this_task->taskpool;
+  const int batch_col = this_task->locals.batch_col.value; (void)batch_col;
+  const int m_T = this_task->locals.m_T.value; (void)m_T;
+  const int n_T = this_task->locals.n_T.value; (void)n_T;
+  const int mb_T_inner = this_task->locals.mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = this_task->locals.nb_T_inner.value; (void)nb_T_inner;
+  const int sizei_T = this_task->locals.sizei_T.value; (void)sizei_T;
+  const int sizej_T = this_task->locals.sizej_T.value; (void)sizej_T;
+  const int m_Y_start = this_task->locals.m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = this_task->locals.n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = this_task->locals.m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = this_task->locals.n_Y_end.value; (void)n_Y_end;
+
+  /* Silent Warnings: should look into predicate to know what variables are usefull */
+  (void)batch_col;
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)sizei_T;
+  (void)sizej_T;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  ref->dc = (parsec_data_collection_t *)__parsec_tp->super._g_descT;
+  /* Compute data key */
+  ref->key = ref->dc->data_key(ref->dc, m_T, n_T);
+  return 1;
+}
+static const parsec_property_t properties_of_redistribute_no_optimization_Init[1] = {
+  {.name = NULL, .expr = NULL}
+};
+static parsec_data_t *flow_of_redistribute_no_optimization_Init_for_T_dep1_atline_181_direct_access(const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, const __parsec_redistribute_no_optimization_Init_parsec_assignment_t *assignments)
+{
+  const int batch_col = assignments->batch_col.value; (void)batch_col;
+  const int m_T = assignments->m_T.value; (void)m_T;
+  const int n_T = assignments->n_T.value; (void)n_T;
+  const int mb_T_inner = assignments->mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = assignments->nb_T_inner.value; (void)nb_T_inner;
+  const int sizei_T = assignments->sizei_T.value; (void)sizei_T;
+  const int sizej_T = assignments->sizej_T.value; (void)sizej_T;
+  const int m_Y_start = assignments->m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = assignments->n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = assignments->m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = assignments->n_Y_end.value; (void)n_Y_end;
+
+  /* Silence Warnings: should look into parameters to know what variables are useful */
+  (void)batch_col;
+  (void)m_T;
+  (void)n_T;
+  (void)mb_T_inner;
+  (void)nb_T_inner;
+  (void)sizei_T;
+  (void)sizej_T;
+  (void)m_Y_start;
+  (void)n_Y_start;
+  (void)m_Y_end;
+  (void)n_Y_end;
+  if( __parsec_tp->super.super.context->my_rank == (int32_t)rank_of_descT(m_T, n_T) )
+    return data_of_descT(m_T, n_T);
+  return NULL;
+}
+
+static const parsec_dep_t flow_of_redistribute_no_optimization_Init_for_T_dep1_atline_181 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = PARSEC_LOCAL_DATA_TASK_CLASS_ID, /* redistribute_no_optimization_descT */
+  .direct_data = (parsec_data_lookup_func_t)&flow_of_redistribute_no_optimization_Init_for_T_dep1_atline_181_direct_access,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_redistribute_no_optimization_Init_for_T,
+};
+static const parsec_dep_t flow_of_redistribute_no_optimization_Init_for_T_dep2_atline_182 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 2, /* redistribute_no_optimization_Update */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_redistribute_no_optimization_Update_for_T,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_redistribute_no_optimization_Init_for_T,
+};
+static const parsec_dep_t flow_of_redistribute_no_optimization_Init_for_T_dep3_atline_183 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 3, /* redistribute_no_optimization_Receive */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_redistribute_no_optimization_Receive_for_T,
+  .dep_index = 1,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_redistribute_no_optimization_Init_for_T,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+#if MAX_DEP_OUT_COUNT < 2  /* number of output dependencies */
+    #error Too many output dependencies (supports up to MAX_DEP_OUT_COUNT [=10] but found 2). Fix the code or recompile PaRSEC with a larger MAX_DEP_OUT_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_redistribute_no_optimization_Init_for_T = {
+  .name               = "T",
+  .sym_type           = PARSEC_SYM_INOUT,
+  .flow_flags         = PARSEC_FLOW_ACCESS_RW|PARSEC_FLOW_HAS_IN_DEPS,
+  .flow_index         = 0,
+  .flow_datatype_mask = 0x1,
+  .dep_in     = { &flow_of_redistribute_no_optimization_Init_for_T_dep1_atline_181 },
+  .dep_out    = { &flow_of_redistribute_no_optimization_Init_for_T_dep2_atline_182,
+ &flow_of_redistribute_no_optimization_Init_for_T_dep3_atline_183 }
+};
+
+static void
+iterate_successors_of_redistribute_no_optimization_Init(parsec_execution_stream_t *es, const __parsec_redistribute_no_optimization_Init_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp = (const __parsec_redistribute_no_optimization_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_redistribute_no_optimization_Init_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_redistribute_no_optimization_Init_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int batch_col = __jdf2c__tmp_locals.batch_col.value; (void)batch_col;
+  const int m_T = __jdf2c__tmp_locals.m_T.value; (void)m_T;
+  const int n_T = __jdf2c__tmp_locals.n_T.value; (void)n_T;
+  const int mb_T_inner = __jdf2c__tmp_locals.mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = __jdf2c__tmp_locals.nb_T_inner.value; (void)nb_T_inner;
+  const int sizei_T = __jdf2c__tmp_locals.sizei_T.value; (void)sizei_T;
+  const int sizej_T = __jdf2c__tmp_locals.sizej_T.value; (void)sizej_T;
+  const int m_Y_start = __jdf2c__tmp_locals.m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = __jdf2c__tmp_locals.n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = __jdf2c__tmp_locals.m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = __jdf2c__tmp_locals.n_Y_end.value; (void)n_Y_end;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)batch_col;  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)sizei_T;  (void)sizej_T;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_descT(m_T, n_T);
+#endif
+  if( action_mask & 0x3 ) {  /* Flow of data T [0] */
+    data.data   = this_task->data._f_T.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x1 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_redistribute_no_optimization_TARGET_ADT->arena;
+    data.local.src_datatype = PARSEC_redistribute_no_optimization_TARGET_ADT->opaque_dtt;
+    data.local.dst_datatype = PARSEC_redistribute_no_optimization_TARGET_ADT->opaque_dtt;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_redistribute_no_optimization_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        __parsec_redistribute_no_optimization_Update_task_t* ncc = (__parsec_redistribute_no_optimization_Update_task_t*)&nc;
+    nc.task_class = __parsec_tp->super.super.task_classes_array[redistribute_no_optimization_Update.task_class_id];
+      const int Update_batch_col = batch_col;
+      if( (Update_batch_col >= (0)) && (Update_batch_col <= (NT)) ) {
+        assert(&nc.locals[0].value == &ncc->locals.batch_col.value);
+        ncc->locals.batch_col.value = Update_batch_col;
+        const int Update_m_T = m_T;
+        if( (Update_m_T >= (m_T_START)) && (Update_m_T <= (m_T_END)) ) {
+          assert(&nc.locals[1].value == &ncc->locals.m_T.value);
+          ncc->locals.m_T.value = Update_m_T;
+          const int Update_n_T = n_T;
+          if( (Update_n_T >= (redistribute_no_optimization_Update_inline_c_expr23_line_249(__parsec_tp, &ncc->locals))) && (Update_n_T <= (redistribute_no_optimization_Update_inline_c_expr22_line_249(__parsec_tp, &ncc->locals))) ) {
+            assert(&nc.locals[2].value == &ncc->locals.n_T.value);
+            ncc->locals.n_T.value = Update_n_T;
+            const int Update_mb_T_inner = redistribute_no_optimization_Update_inline_c_expr21_line_251(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[3].value == &ncc->locals.mb_T_inner.value);
+            ncc->locals.mb_T_inner.value = Update_mb_T_inner;
+            const int Update_nb_T_inner = redistribute_no_optimization_Update_inline_c_expr20_line_252(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[4].value == &ncc->locals.nb_T_inner.value);
+            ncc->locals.nb_T_inner.value = Update_nb_T_inner;
+            const int Update_i_start = redistribute_no_optimization_Update_inline_c_expr19_line_254(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[5].value == &ncc->locals.i_start.value);
+            ncc->locals.i_start.value = Update_i_start;
+            const int Update_j_start = redistribute_no_optimization_Update_inline_c_expr18_line_255(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[6].value == &ncc->locals.j_start.value);
+            ncc->locals.j_start.value = Update_j_start;
+            const int Update_m_Y_start = redistribute_no_optimization_Update_inline_c_expr17_line_257(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[7].value == &ncc->locals.m_Y_start.value);
+            ncc->locals.m_Y_start.value = Update_m_Y_start;
+            const int Update_n_Y_start = redistribute_no_optimization_Update_inline_c_expr16_line_258(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[8].value == &ncc->locals.n_Y_start.value);
+            ncc->locals.n_Y_start.value = Update_n_Y_start;
+            const int Update_m_Y_end = redistribute_no_optimization_Update_inline_c_expr15_line_259(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[9].value == &ncc->locals.m_Y_end.value);
+            ncc->locals.m_Y_end.value = Update_m_Y_end;
+            const int Update_n_Y_end = redistribute_no_optimization_Update_inline_c_expr14_line_260(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[10].value == &ncc->locals.n_Y_end.value);
+            ncc->locals.n_Y_end.value = Update_n_Y_end;
+            int Update_m_Y;
+          for( Update_m_Y = m_Y_start;Update_m_Y <= m_Y_end; Update_m_Y+=1) {
+              if( (Update_m_Y >= (ncc->locals.m_Y_start.value)) && (Update_m_Y <= (ncc->locals.m_Y_end.value)) ) {
+                assert(&nc.locals[11].value == &ncc->locals.m_Y.value);
+                ncc->locals.m_Y.value = Update_m_Y;
+                int Update_n_Y;
+              for( Update_n_Y = n_Y_start;Update_n_Y <= n_Y_end; Update_n_Y+=1) {
+                  if( (Update_n_Y >= (ncc->locals.n_Y_start.value)) && (Update_n_Y <= (ncc->locals.n_Y_end.value)) ) {
+                    assert(&nc.locals[12].value == &ncc->locals.n_Y.value);
+                    ncc->locals.n_Y.value = Update_n_Y;
+                    const int Update_TL_row = redistribute_no_optimization_Update_inline_c_expr13_line_265(__parsec_tp, &ncc->locals);
+                    assert(&nc.locals[13].value == &ncc->locals.TL_row.value);
+                    ncc->locals.TL_row.value = Update_TL_row;
+                    const int Update_TL_col = redistribute_no_optimization_Update_inline_c_expr12_line_266(__parsec_tp, &ncc->locals);
+                    assert(&nc.locals[14].value == &ncc->locals.TL_col.value);
+                    ncc->locals.TL_col.value = Update_TL_col;
+                    const int Update_BR_row = ((((ncc->locals.i_start.value + ncc->locals.mb_T_inner.value) - 1) % mb_Y_INNER) + 1);
+                    assert(&nc.locals[15].value == &ncc->locals.BR_row.value);
+                    ncc->locals.BR_row.value = Update_BR_row;
+                    const int Update_BR_col = ((((ncc->locals.j_start.value + ncc->locals.nb_T_inner.value) - 1) % nb_Y_INNER) + 1);
+                    assert(&nc.locals[16].value == &ncc->locals.BR_col.value);
+                    ncc->locals.BR_col.value = Update_BR_col;
+#if defined(DISTRIBUTED)
+                    rank_dst = rank_of_descT(ncc->locals.m_T.value, ncc->locals.n_T.value);
+                    if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+                      vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descT)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descT, ncc->locals.m_T.value, ncc->locals.n_T.value);
+                    nc.priority = __parsec_tp->super.super.priority;
+                    successor_repo = Update_repo;
+                    successor_repo_key = __jdf2c_make_key_Update((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+                  RELEASE_DEP_OUTPUT(es, "T", this_task, "T", &nc, rank_src, rank_dst, &data);
+                  if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_redistribute_no_optimization_Init_for_T_dep2_atline_182, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+                    }
+                  }
+                }
+              }
+            }
+          }
+        }
+  }
+  if( action_mask & 0x2 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_redistribute_no_optimization_TARGET_ADT->arena;
+    data.local.src_datatype = PARSEC_redistribute_no_optimization_TARGET_ADT->opaque_dtt;
+    data.local.dst_datatype = PARSEC_redistribute_no_optimization_TARGET_ADT->opaque_dtt;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_redistribute_no_optimization_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        __parsec_redistribute_no_optimization_Receive_task_t* ncc = (__parsec_redistribute_no_optimization_Receive_task_t*)&nc;
+    nc.task_class = __parsec_tp->super.super.task_classes_array[redistribute_no_optimization_Receive.task_class_id];
+      const int Receive_batch_col = batch_col;
+      if( (Receive_batch_col >= (0)) && (Receive_batch_col <= (NT)) ) {
+        assert(&nc.locals[0].value == &ncc->locals.batch_col.value);
+        ncc->locals.batch_col.value = Receive_batch_col;
+        const int Receive_m_T = m_T;
+        if( (Receive_m_T >= (m_T_START)) && (Receive_m_T <= (m_T_END)) ) {
+          assert(&nc.locals[1].value == &ncc->locals.m_T.value);
+          ncc->locals.m_T.value = Receive_m_T;
+          const int Receive_n_T = n_T;
+          if( (Receive_n_T >= (redistribute_no_optimization_Receive_inline_c_expr11_line_315(__parsec_tp, &ncc->locals))) && (Receive_n_T <= (redistribute_no_optimization_Receive_inline_c_expr10_line_315(__parsec_tp, &ncc->locals))) ) {
+            assert(&nc.locals[2].value == &ncc->locals.n_T.value);
+            ncc->locals.n_T.value = Receive_n_T;
+            const int Receive_mb_T_inner = redistribute_no_optimization_Receive_inline_c_expr9_line_317(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[3].value == &ncc->locals.mb_T_inner.value);
+            ncc->locals.mb_T_inner.value = Receive_mb_T_inner;
+            const int Receive_nb_T_inner = redistribute_no_optimization_Receive_inline_c_expr8_line_318(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[4].value == &ncc->locals.nb_T_inner.value);
+            ncc->locals.nb_T_inner.value = Receive_nb_T_inner;
+            const int Receive_nb_T_inner_next = redistribute_no_optimization_Receive_inline_c_expr7_line_320(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[5].value == &ncc->locals.nb_T_inner_next.value);
+            ncc->locals.nb_T_inner_next.value = Receive_nb_T_inner_next;
+            const int Receive_sizei_T = (((ncc->locals.m_T.value - m_T_START) * mb_T_INNER) - (disi_T % mb_T_INNER));
+            assert(&nc.locals[6].value == &ncc->locals.sizei_T.value);
+            ncc->locals.sizei_T.value = Receive_sizei_T;
+            const int Receive_sizej_T = (((ncc->locals.n_T.value - n_T_START) * nb_T_INNER) - (disj_T % nb_T_INNER));
+            assert(&nc.locals[7].value == &ncc->locals.sizej_T.value);
+            ncc->locals.sizej_T.value = Receive_sizej_T;
+            const int Receive_i_start = redistribute_no_optimization_Receive_inline_c_expr6_line_325(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[8].value == &ncc->locals.i_start.value);
+            ncc->locals.i_start.value = Receive_i_start;
+            const int Receive_j_start = redistribute_no_optimization_Receive_inline_c_expr5_line_326(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[9].value == &ncc->locals.j_start.value);
+            ncc->locals.j_start.value = Receive_j_start;
+            const int Receive_m_Y_start = redistribute_no_optimization_Receive_inline_c_expr4_line_328(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[10].value == &ncc->locals.m_Y_start.value);
+            ncc->locals.m_Y_start.value = Receive_m_Y_start;
+            const int Receive_n_Y_start = redistribute_no_optimization_Receive_inline_c_expr3_line_329(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[11].value == &ncc->locals.n_Y_start.value);
+            ncc->locals.n_Y_start.value = Receive_n_Y_start;
+            const int Receive_m_Y_end = redistribute_no_optimization_Receive_inline_c_expr2_line_330(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[12].value == &ncc->locals.m_Y_end.value);
+            ncc->locals.m_Y_end.value = Receive_m_Y_end;
+            const int Receive_n_Y_end = redistribute_no_optimization_Receive_inline_c_expr1_line_331(__parsec_tp, &ncc->locals);
+            assert(&nc.locals[13].value == &ncc->locals.n_Y_end.value);
+            ncc->locals.n_Y_end.value = Receive_n_Y_end;
+            const int Receive_n_Y_start_next = ((((((ncc->locals.n_T.value - n_T_START) + num_col) * nb_T_INNER) - (disj_T % nb_T_INNER)) + disj_Y) / nb_Y_INNER);
+            assert(&nc.locals[14].value == &ncc->locals.n_Y_start_next.value);
+            ncc->locals.n_Y_start_next.value = Receive_n_Y_start_next;
+            const int Receive_n_Y_end_next = ((((((((ncc->locals.n_T.value - n_T_START) + num_col) * nb_T_INNER) - (disj_T % nb_T_INNER)) + disj_Y) + ncc->locals.nb_T_inner_next.value) - 1) / nb_Y_INNER);
+            assert(&nc.locals[15].value == &ncc->locals.n_Y_end_next.value);
+            ncc->locals.n_Y_end_next.value = Receive_n_Y_end_next;
+#if defined(DISTRIBUTED)
+            rank_dst = rank_of_descT(ncc->locals.m_T.value, ncc->locals.n_T.value);
+            if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+              vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descT)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descT, ncc->locals.m_T.value, ncc->locals.n_T.value);
+            nc.priority = __parsec_tp->super.super.priority;
+            successor_repo = Receive_repo;
+            successor_repo_key = __jdf2c_make_key_Receive((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+          RELEASE_DEP_OUTPUT(es, "T", this_task, "T", &nc, rank_src, rank_dst, &data);
+          if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_redistribute_no_optimization_Init_for_T_dep3_atline_183, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+            }
+          }
+        }
+  }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static int release_deps_of_redistribute_no_optimization_Init(parsec_execution_stream_t *es, __parsec_redistribute_no_optimization_Init_task_t *this_task, uint32_t action_mask, parsec_remote_deps_t *deps)
+{
+  PARSEC_PINS(es, RELEASE_DEPS_BEGIN, (parsec_task_t *)this_task);  const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp = (const __parsec_redistribute_no_optimization_internal_taskpool_t *)this_task->taskpool;
+  parsec_release_dep_fct_arg_t arg;
+  int __vp_id;
+  int consume_local_repo = 0;
+  arg.action_mask = action_mask;
+  arg.output_entry = NULL;
+  arg.output_repo = NULL;
+#if defined(DISTRIBUTED)
+  arg.remote_deps = deps;
+#endif  /* defined(DISTRIBUTED) */
+  assert(NULL != es);
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS )    arg.ready_lists = alloca(sizeof(parsec_task_t *) * es->virtual_process->parsec_context->nb_vp);
+  else
+    arg.ready_lists = NULL;
+  for( __vp_id = 0; __vp_id < es->virtual_process->parsec_context->nb_vp; arg.ready_lists[__vp_id++] = NULL );
+  (void)__parsec_tp; (void)deps;
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_T.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_T.source_repo, this_task->data._f_T.source_repo_entry->ht_item.key );
+    }
+  }
+  consume_local_repo = (this_task->repo_entry != NULL);
+  arg.output_repo = Init_repo;
+  arg.output_entry = this_task->repo_entry;
+  arg.output_usage = 0;
+  if( action_mask & (PARSEC_ACTION_RELEASE_LOCAL_DEPS | PARSEC_ACTION_GET_REPO_ENTRY) ) {
+    arg.output_entry = data_repo_lookup_entry_and_create( es, arg.output_repo, __jdf2c_make_key_Init((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    arg.output_entry->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(arg.output_entry->sim_exec_date == 0);
+    arg.output_entry->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  if(action_mask & ( PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE ) ){
+    /* Generate the reshape promise for the outputs that need it */
+    iterate_successors_of_redistribute_no_optimization_Init(es, this_task, action_mask, parsec_set_up_reshape_promise, &arg);
+   }
+  iterate_successors_of_redistribute_no_optimization_Init(es, this_task, action_mask, parsec_release_dep_fct, &arg);
+
+#if defined(DISTRIBUTED)
+  if( (action_mask & PARSEC_ACTION_SEND_REMOTE_DEPS) && (NULL != arg.remote_deps)) {
+    parsec_remote_dep_activate(es, (parsec_task_t *)this_task, arg.remote_deps, arg.remote_deps->outgoing_mask);
+  }
+#endif
+
+  if(action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS) {
+    data_repo_entry_addto_usage_limit(Init_repo, arg.output_entry->ht_item.key, arg.output_usage);
+    __parsec_schedule_vp(es, arg.ready_lists, 0);
+  }
+      if (consume_local_repo) {
+         data_repo_entry_used_once( Init_repo, this_task->repo_entry->ht_item.key );
+      }
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_T.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_T.data_in);
+    }
+  }
+  PARSEC_PINS(es, RELEASE_DEPS_END, (parsec_task_t *)this_task);  return 0;
+}
+
+static int data_lookup_of_redistribute_no_optimization_Init(parsec_execution_stream_t *es, __parsec_redistribute_no_optimization_Init_task_t *this_task)
+{
+  const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_no_optimization_internal_taskpool_t *)this_task->taskpool;
+  parsec_assignment_t generic_locals[MAX_PARAM_COUNT];  /* generic task locals */
+  int target_device = 0; (void)target_device;
+  (void)__parsec_tp; (void)generic_locals; (void)es;
+  parsec_data_copy_t *chunk = NULL;
+  data_repo_t        *reshape_repo  = NULL, *consumed_repo  = NULL;
+  data_repo_entry_t  *reshape_entry = NULL, *consumed_entry = NULL;
+  parsec_key_t        reshape_entry_key = 0, consumed_entry_key = 0;
+  uint8_t             consumed_flow_index;
+  parsec_dep_data_description_t data;
+  int ret;
+  (void)reshape_repo; (void)reshape_entry; (void)reshape_entry_key;
+  (void)consumed_repo; (void)consumed_entry; (void)consumed_entry_key;
+  (void)consumed_flow_index;
+  (void)chunk; (void)data; (void)ret;
+  const int batch_col = this_task->locals.batch_col.value; (void)batch_col;
+  const int m_T = this_task->locals.m_T.value; (void)m_T;
+  const int n_T = this_task->locals.n_T.value; (void)n_T;
+  const int mb_T_inner = this_task->locals.mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = this_task->locals.nb_T_inner.value; (void)nb_T_inner;
+  const int sizei_T = this_task->locals.sizei_T.value; (void)sizei_T;
+  const int sizej_T = this_task->locals.sizej_T.value; (void)sizej_T;
+  const int m_Y_start = this_task->locals.m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = this_task->locals.n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = this_task->locals.m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = this_task->locals.n_Y_end.value; (void)n_Y_end;
+  if( NULL == this_task->repo_entry ){
+    this_task->repo_entry = data_repo_lookup_entry_and_create(es, Init_repo,                                       __jdf2c_make_key_Init((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    data_repo_entry_addto_usage_limit(Init_repo, this_task->repo_entry->ht_item.key, 1);    this_task->repo_entry ->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(this_task->repo_entry ->sim_exec_date == 0);
+    this_task->repo_entry ->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  /* The reshape repo is the current task repo. */  reshape_repo = Init_repo;
+  reshape_entry_key = __jdf2c_make_key_Init((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals) ;
+  reshape_entry = this_task->repo_entry;
+  /* Lookup the input data, and store them in the context if any */
+
+if(! this_task->data._f_T.fulfill ){ /* Flow T */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_T.data_out = NULL;  /* By default, if nothing matches */
+  /* Flow T [0] dependency [0] from memory descT */
+  if( NULL == (chunk = this_task->data._f_T.data_in) ) {
+  /* No data set up by predecessor on this task input flow */
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+  parsec_prof_grapher_data_input(data_of_descT(m_T, n_T), (parsec_task_t*)this_task, &flow_of_redistribute_no_optimization_Init_for_T, 1);
+#endif
+    chunk = parsec_data_get_copy(data_of_descT(m_T, n_T), target_device);
+    data.data = chunk;
+    data.data_future  = NULL;
+        data.local.arena  = PARSEC_redistribute_no_optimization_TARGET_ADT->arena;
+    data.local.src_datatype = data.data->dtt;
+    data.local.dst_datatype = PARSEC_redistribute_no_optimization_TARGET_ADT->opaque_dtt;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.data_future   = NULL;
+    if( (ret = parsec_get_copy_reshape_from_desc(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    this_task->data._f_T.data_out = chunk;
+    PARSEC_OBJ_RETAIN(chunk);
+  } 
+    this_task->data._f_T.data_in     = chunk;
+    this_task->data._f_T.source_repo       = consumed_repo;
+    this_task->data._f_T.source_repo_entry = consumed_entry;
+    if( this_task->data._f_T.source_repo_entry == this_task->repo_entry ){
+      /* in case we have consume from this task repo entry for the flow,
+       * it is cleaned up, avoiding having old stuff during release_deps_of
+       */
+      this_task->repo_entry->data[0] = NULL;
+    }
+    this_task->data._f_T.fulfill = 1;
+}
+
+  /** Generate profiling information */
+#if defined(PARSEC_PROF_TRACE)
+  this_task->prof_info.desc = (parsec_data_collection_t*)__parsec_tp->super._g_descT;
+  this_task->prof_info.priority = this_task->priority;
+  this_task->prof_info.data_id   = ((parsec_data_collection_t*)__parsec_tp->super._g_descT)->data_key((parsec_data_collection_t*)__parsec_tp->super._g_descT, m_T, n_T);
+  this_task->prof_info.task_class_id = this_task->task_class->task_class_id;
+  this_task->prof_info.task_return_code = -1;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int datatype_lookup_of_redistribute_no_optimization_Init(parsec_execution_stream_t *es, const parsec_task_t *this_generic_task, const parsec_task_t *parent_task,
+              uint32_t* flow_mask, parsec_dep_data_description_t* data)
+{
+  const __parsec_redistribute_no_optimization_Init_task_t *this_task = (__parsec_redistribute_no_optimization_Init_task_t*)this_generic_task;
+  const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_no_optimization_internal_taskpool_t *)this_task->taskpool;
+  (void)__parsec_tp; (void)es; (void)this_task; (void)data; (void)parent_task;
+  const int batch_col = this_task->locals.batch_col.value; (void)batch_col;
+  const int m_T = this_task->locals.m_T.value; (void)m_T;
+  const int n_T = this_task->locals.n_T.value; (void)n_T;
+  const int mb_T_inner = this_task->locals.mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = this_task->locals.nb_T_inner.value; (void)nb_T_inner;
+  const int sizei_T = this_task->locals.sizei_T.value; (void)sizei_T;
+  const int sizej_T = this_task->locals.sizej_T.value; (void)sizej_T;
+  const int m_Y_start = this_task->locals.m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = this_task->locals.n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = this_task->locals.m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = this_task->locals.n_Y_end.value; (void)n_Y_end;
+  data->local.arena = data->remote.arena = NULL;
+  data->local.src_datatype  = data->local.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->local.src_count     = data->local.dst_count = 0;
+  data->local.src_displ     = data->local.dst_displ = 0;
+  data->data_future  = NULL;
+  if( (*flow_mask) & 0x80000000U ) { /* these are the input dependencies remote datatypes  */
+if( (*flow_mask) & 0x1U ) {  /* Flow T */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_redistribute_no_optimization_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_redistribute_no_optimization_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_redistribute_no_optimization_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+    goto no_mask_match;
+  }
+
+  /* these are the output dependencies remote datatypes */
+if( (*flow_mask) & 0x3U ) {  /* Flow T */
+    if( ((*flow_mask) & 0x3U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_redistribute_no_optimization_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_redistribute_no_optimization_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_redistribute_no_optimization_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x3U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x3U) */
+ no_mask_match:
+  data->data                             = NULL;
+  data->remote.src_datatype = data->remote.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->remote.src_count    = data->remote.dst_count = 0;
+  data->remote.src_displ    = data->remote.dst_displ = 0;
+  data->data_future  = NULL;
+  (*flow_mask) = 0;  /* nothing left */
+  (void)batch_col;  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)sizei_T;  (void)sizej_T;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+static int hook_of_redistribute_no_optimization_Init(parsec_execution_stream_t *es, __parsec_redistribute_no_optimization_Init_task_t *this_task)
+{
+  __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_no_optimization_internal_taskpool_t *)this_task->taskpool;
+  (void)es; (void)__parsec_tp;
+  const int batch_col = this_task->locals.batch_col.value; (void)batch_col;
+  const int m_T = this_task->locals.m_T.value; (void)m_T;
+  const int n_T = this_task->locals.n_T.value; (void)n_T;
+  const int mb_T_inner = this_task->locals.mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = this_task->locals.nb_T_inner.value; (void)nb_T_inner;
+  const int sizei_T = this_task->locals.sizei_T.value; (void)sizei_T;
+  const int sizej_T = this_task->locals.sizej_T.value; (void)sizej_T;
+  const int m_Y_start = this_task->locals.m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = this_task->locals.n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = this_task->locals.m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = this_task->locals.n_Y_end.value; (void)n_Y_end;
+  (void)batch_col;  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)sizei_T;  (void)sizej_T;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;
+
+  /** Declare the variables that will hold the data, and all the accounting for each */
+  parsec_data_copy_t *_f_T = this_task->data._f_T.data_in;
+  void *T = PARSEC_DATA_COPY_GET_PTR(_f_T); (void)T;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    data_repo_entry_t *eT = this_task->data._f_T.source_repo_entry;
+    if( (NULL != eT) && (eT->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eT->sim_exec_date;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+    if ( NULL != _f_T ) {
+#if defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) || defined(PARSEC_HAVE_DEV_HIP_SUPPORT)
+      parsec_data_transfer_ownership_to_copy( _f_T->original, 0 /* device */,
+                                           PARSEC_FLOW_ACCESS_RW);
+#endif  /* defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) || defined(PARSEC_HAVE_DEV_HIP_SUPPORT) */
+      _f_T->version++;  /* T */
+#if defined(PARSEC_DEBUG_NOISIER)
+      char tmp[128];
+      PARSEC_DEBUG_VERBOSE(10, parsec_debug_output,
+                           "Body of %s: change Data copy %p to version %d",
+                           parsec_task_snprintf(tmp, 128, (parsec_task_t*)(this_task)),
+                           _f_T, _f_T->version);
+#endif /* defined(PARSEC_DEBUG_NOISIER) */
+    }
+  /** Cache Awareness Accounting */
+#if defined(PARSEC_CACHE_AWARENESS)
+  cache_buf_referenced(es->closest_cache, T);
+#endif /* PARSEC_CACHE_AWARENESS */
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                                  Init BODY                                    -----*/
+
+{
+
+}
+
+/*-----                                END OF Init BODY                                -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#endif  /*  defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+static int complete_hook_of_redistribute_no_optimization_Init(parsec_execution_stream_t *es, __parsec_redistribute_no_optimization_Init_task_t *this_task)
+{
+  const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_no_optimization_internal_taskpool_t *)this_task->taskpool;
+#if defined(DISTRIBUTED)
+    const int batch_col = this_task->locals.batch_col.value; (void)batch_col;
+  const int m_T = this_task->locals.m_T.value; (void)m_T;
+  const int n_T = this_task->locals.n_T.value; (void)n_T;
+  const int mb_T_inner = this_task->locals.mb_T_inner.value; (void)mb_T_inner;
+  const int nb_T_inner = this_task->locals.nb_T_inner.value; (void)nb_T_inner;
+  const int sizei_T = this_task->locals.sizei_T.value; (void)sizei_T;
+  const int sizej_T = this_task->locals.sizej_T.value; (void)sizej_T;
+  const int m_Y_start = this_task->locals.m_Y_start.value; (void)m_Y_start;
+  const int n_Y_start = this_task->locals.n_Y_start.value; (void)n_Y_start;
+  const int m_Y_end = this_task->locals.m_Y_end.value; (void)m_Y_end;
+  const int n_Y_end = this_task->locals.n_Y_end.value; (void)n_Y_end;
+#endif  /* defined(DISTRIBUTED) */
+  (void)es; (void)__parsec_tp;
+parsec_data_t* data_t_desc = NULL; (void)data_t_desc;
+#if defined(DISTRIBUTED)
+  /** If not working on distributed, there is no risk that data is not in place */
+  (void)batch_col;  (void)m_T;  (void)n_T;  (void)mb_T_inner;  (void)nb_T_inner;  (void)sizei_T;  (void)sizej_T;  (void)m_Y_start;  (void)n_Y_start;  (void)m_Y_end;  (void)n_Y_end;
+
+#endif /* DISTRIBUTED */
+#if defined(PARSEC_PROF_GRAPHER)
+  parsec_prof_grapher_task((parsec_task_t*)this_task, es->th_id, es->virtual_process->vp_id,
+     __jdf2c_key_fns_Init.key_hash(this_task->task_class->make_key( (parsec_taskpool_t*)this_task->taskpool, ((parsec_task_t*)this_task)->locals), NULL));
+#endif  /* defined(PARSEC_PROF_GRAPHER) */
+  release_deps_of_redistribute_no_optimization_Init(es, this_task,
+      PARSEC_ACTION_RELEASE_REMOTE_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_REFS |
+      PARSEC_ACTION_RESHAPE_ON_RELEASE |
+      0x3,  /* mask of all dep_index */ 
+      NULL);
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static parsec_hook_return_t release_task_of_redistribute_no_optimization_Init(parsec_execution_stream_t *es, parsec_task_t *this_task)
+{
+    const __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp =
+        (const __parsec_redistribute_no_optimization_internal_taskpool_t *)this_task->taskpool;
+    parsec_hash_table_t *ht = (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[0];
+    parsec_key_t key = this_task->task_class->make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals);
+    parsec_hashable_dependency_t *hash_dep = (parsec_hashable_dependency_t *)parsec_hash_table_remove(ht, key);
+    parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);
+    return parsec_release_task_to_mempool_update_nbtasks(es, this_task);
+}
+
+static char *redistribute_no_optimization_redistribute_no_optimization_Init_internal_init_deps_key_functions_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_no_optimization_internal_taskpool_t *)user_data;
+  __parsec_redistribute_no_optimization_Init_parsec_assignment_t __jdf2c__assignments = {  .batch_col.value = 0, .m_T.value = 0, .n_T.value = 0, .mb_T_inner.value = 0, .nb_T_inner.value = 0, .sizei_T.value = 0, .sizej_T.value = 0, .m_Y_start.value = 0, .n_Y_start.value = 0, .m_Y_end.value = 0, .n_Y_end.value = 0 };
+  int batch_col = (__parsec_key) % __parsec_tp->Init_batch_col_range + __parsec_tp->Init_batch_col_min;
+  __parsec_key = __parsec_key / __parsec_tp->Init_batch_col_range;
+  __jdf2c__assignments.batch_col.value = batch_col;
+  int m_T = (__parsec_key) % __parsec_tp->Init_m_T_range + __parsec_tp->Init_m_T_min;
+  __parsec_key = __parsec_key / __parsec_tp->Init_m_T_range;
+  __jdf2c__assignments.m_T.value = m_T;
+  int n_T = (__parsec_key) % __parsec_tp->Init_n_T_range + __parsec_tp->Init_n_T_min;
+  __parsec_key = __parsec_key / __parsec_tp->Init_n_T_range;
+  __jdf2c__assignments.n_T.value = n_T;
+  int mb_T_inner = redistribute_no_optimization_Init_inline_c_expr39_line_168(__parsec_tp, &__jdf2c__assignments);
+  (void)mb_T_inner;
+  __jdf2c__assignments.mb_T_inner.value = mb_T_inner;
+  int nb_T_inner = redistribute_no_optimization_Init_inline_c_expr38_line_169(__parsec_tp, &__jdf2c__assignments);
+  (void)nb_T_inner;
+  __jdf2c__assignments.nb_T_inner.value = nb_T_inner;
+  int sizei_T = (((m_T - m_T_START) * mb_T_INNER) - (disi_T % mb_T_INNER));
+  (void)sizei_T;
+  __jdf2c__assignments.sizei_T.value = sizei_T;
+  int sizej_T = (((n_T - n_T_START) * nb_T_INNER) - (disj_T % nb_T_INNER));
+  (void)sizej_T;
+  __jdf2c__assignments.sizej_T.value = sizej_T;
+  int m_Y_start = redistribute_no_optimization_Init_inline_c_expr37_line_174(__parsec_tp, &__jdf2c__assignments);
+  (void)m_Y_start;
+  __jdf2c__assignments.m_Y_start.value = m_Y_start;
+  int n_Y_start = redistribute_no_optimization_Init_inline_c_expr36_line_175(__parsec_tp, &__jdf2c__assignments);
+  (void)n_Y_start;
+  __jdf2c__assignments.n_Y_start.value = n_Y_start;
+  int m_Y_end = redistribute_no_optimization_Init_inline_c_expr35_line_176(__parsec_tp, &__jdf2c__assignments);
+  (void)m_Y_end;
+  __jdf2c__assignments.m_Y_end.value = m_Y_end;
+  int n_Y_end = redistribute_no_optimization_Init_inline_c_expr34_line_177(__parsec_tp, &__jdf2c__assignments);
+  (void)n_Y_end;
+  __jdf2c__assignments.n_Y_end.value = n_Y_end;
+  (void)__jdf2c__assignments;
+  snprintf(buffer, buffer_size, "Init(%d, %d, %d)", batch_col, m_T, n_T);
+  return buffer;
+}
+
+static parsec_key_fn_t redistribute_no_optimization_redistribute_no_optimization_Init_internal_init_deps_key_functions = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = redistribute_no_optimization_redistribute_no_optimization_Init_internal_init_deps_key_functions_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/* Needs: min-max count-tasks iterate */
+static int redistribute_no_optimization_Init_internal_init(parsec_execution_stream_t * es, __parsec_redistribute_no_optimization_Init_task_t * this_task)
+{
+  __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp = (__parsec_redistribute_no_optimization_internal_taskpool_t*)this_task->taskpool;
+  int32_t nb_tasks = 0, saved_nb_tasks = 0;
+int32_t __batch_col_min = 0x7fffffff, __batch_col_max = 0;int32_t __jdf2c_batch_col_min = 0x7fffffff, __jdf2c_batch_col_max = 0;int32_t __m_T_min = 0x7fffffff, __m_T_max = 0;int32_t __jdf2c_m_T_min = 0x7fffffff, __jdf2c_m_T_max = 0;int32_t __n_T_min = 0x7fffffff, __n_T_max = 0;int32_t __jdf2c_n_T_min = 0x7fffffff, __jdf2c_n_T_max = 0;  __parsec_redistribute_no_optimization_Init_parsec_assignment_t assignments = {  .batch_col.value = 0, .m_T.value = 0, .n_T.value = 0, .mb_T_inner.value = 0, .nb_T_inner.value = 0, .sizei_T.value = 0, .sizej_T.value = 0, .m_Y_start.value = 0, .n_Y_start.value = 0, .m_Y_end.value = 0, .n_Y_end.value = 0 };
+  int32_t  batch_col,  m_T,  n_T,  mb_T_inner,  nb_T_inner,  sizei_T,  sizej_T,  m_Y_start,  n_Y_start,  m_Y_end,  n_Y_end;
+  int32_t __jdf2c_batch_col_start, __jdf2c_batch_col_end, __jdf2c_batch_col_inc;
+  int32_t __jdf2c_m_T_start, __jdf2c_m_T_end, __jdf2c_m_T_inc;
+  int32_t __jdf2c_n_T_start, __jdf2c_n_T_end, __jdf2c_n_T_inc;
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+  PARSEC_PROFILING_TRACE(es->es_profile,
+                         this_task->taskpool->profiling_array[START_KEY(this_task->task_class->task_class_id)],
+                         0,
+                         this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    __jdf2c_batch_col_start = 0;
+    __jdf2c_batch_col_end = NT;
+    __jdf2c_batch_col_inc = 1;
+    __batch_col_min = parsec_imin(__jdf2c_batch_col_start, __jdf2c_batch_col_end);
+    __batch_col_max = parsec_imax(__jdf2c_batch_col_start, __jdf2c_batch_col_end);
+    __jdf2c_batch_col_min = parsec_imin(__jdf2c_batch_col_min, __batch_col_min);
+    __jdf2c_batch_col_max = parsec_imax(__jdf2c_batch_col_max, __batch_col_max);
+    for(batch_col =  __jdf2c_batch_col_start;
+        batch_col <= __jdf2c_batch_col_end;
+        batch_col += __jdf2c_batch_col_inc) {
+    assignments.batch_col.value = batch_col;
+      __jdf2c_m_T_start = m_T_START;
+      __jdf2c_m_T_end = m_T_END;
+      __jdf2c_m_T_inc = 1;
+      __m_T_min = parsec_imin(__jdf2c_m_T_start, __jdf2c_m_T_end);
+      __m_T_max = parsec_imax(__jdf2c_m_T_start, __jdf2c_m_T_end);
+      __jdf2c_m_T_min = parsec_imin(__jdf2c_m_T_min, __m_T_min);
+      __jdf2c_m_T_max = parsec_imax(__jdf2c_m_T_max, __m_T_max);
+      for(m_T =  __jdf2c_m_T_start;
+          m_T <= __jdf2c_m_T_end;
+          m_T += __jdf2c_m_T_inc) {
+      assignments.m_T.value = m_T;
+        __jdf2c_n_T_start = redistribute_no_optimization_Init_inline_c_expr41_line_166(__parsec_tp, &assignments);
+        __jdf2c_n_T_end = redistribute_no_optimization_Init_inline_c_expr40_line_166(__parsec_tp, &assignments);
+        __jdf2c_n_T_inc = 1;
+        __n_T_min = parsec_imin(__jdf2c_n_T_start, __jdf2c_n_T_end);
+        __n_T_max = parsec_imax(__jdf2c_n_T_start, __jdf2c_n_T_end);
+        __jdf2c_n_T_min = parsec_imin(__jdf2c_n_T_min, __n_T_min);
+        __jdf2c_n_T_max = parsec_imax(__jdf2c_n_T_max, __n_T_max);
+        for(n_T =  __jdf2c_n_T_start;
+            n_T <= __jdf2c_n_T_end;
+            n_T += __jdf2c_n_T_inc) {
+        assignments.n_T.value = n_T;
+      {  /* block for the non-range variable mb_T_inner */
+          mb_T_inner = redistribute_no_optimization_Init_inline_c_expr39_line_168(__parsec_tp, &assignments);
+          assignments.mb_T_inner.value = mb_T_inner;
+        {  /* block for the non-range variable nb_T_inner */
+            nb_T_inner = redistribute_no_optimization_Init_inline_c_expr38_line_169(__parsec_tp, &assignments);
+            assignments.nb_T_inner.value = nb_T_inner;
+          {  /* block for the non-range variable sizei_T */
+              sizei_T = (((m_T - m_T_START) * mb_T_INNER) - (disi_T % mb_T_INNER));
+              assignments.sizei_T.value = sizei_T;
+            {  /* block for the non-range variable sizej_T */
+                sizej_T = (((n_T - n_T_START) * nb_T_INNER) - (disj_T % nb_T_INNER));
+                assignments.sizej_T.value = sizej_T;
+              {  /* block for the non-range variable m_Y_start */
+                  m_Y_start = redistribute_no_optimization_Init_inline_c_expr37_line_174(__parsec_tp, &assignments);
+                  assignments.m_Y_start.value = m_Y_start;
+                {  /* block for the non-range variable n_Y_start */
+                    n_Y_start = redistribute_no_optimization_Init_inline_c_expr36_line_175(__parsec_tp, &assignments);
+                    assignments.n_Y_start.value = n_Y_start;
+                  {  /* block for the non-range variable m_Y_end */
+                      m_Y_end = redistribute_no_optimization_Init_inline_c_expr35_line_176(__parsec_tp, &assignments);
+                      assignments.m_Y_end.value = m_Y_end;
+                    {  /* block for the non-range variable n_Y_end */
+                        n_Y_end = redistribute_no_optimization_Init_inline_c_expr34_line_177(__parsec_tp, &assignments);
+                        assignments.n_Y_end.value = n_Y_end;
+                        if( !Init_pred(batch_col, m_T, n_T, mb_T_inner, nb_T_inner, sizei_T, sizej_T, m_Y_start, n_Y_start, m_Y_end, n_Y_end) ) continue;
+                        nb_tasks++;
+                      } /* block for the non-range variable n_Y_end */ 
+                    } /* block for the non-range variable m_Y_end */ 
+                  } /* block for the non-range variable n_Y_start */ 
+                } /* block for the non-range variable m_Y_start */ 
+              } /* block for the non-range variable sizej_T */ 
+            } /* block for the non-range variable sizei_T */ 
+          } /* block for the non-range variable nb_T_inner */ 
+        } /* block for the non-range variable mb_T_inner */ 
+      } /* Loop on normal range n_T */
+    } /* For loop of m_T */ 
+  } /* For loop of batch_col */ 
+   if( 0 != nb_tasks ) {
+     (void)parsec_atomic_fetch_add_int32(&__parsec_tp->initial_number_tasks, nb_tasks);
+   }
+  /* Set the range variables for the collision-free hash-computation */
+  __parsec_tp->Init_batch_col_min   = __jdf2c_batch_col_min;
+  __parsec_tp->Init_batch_col_range = (__jdf2c_batch_col_max - __jdf2c_batch_col_min) + 1;
+  __parsec_tp->Init_m_T_min   = __jdf2c_m_T_min;
+  __parsec_tp->Init_m_T_range = (__jdf2c_m_T_max - __jdf2c_m_T_min) + 1;
+  __parsec_tp->Init_n_T_min   = __jdf2c_n_T_min;
+  __parsec_tp->Init_n_T_range = (__jdf2c_n_T_max - __jdf2c_n_T_min) + 1;
+    do {
+      this_task->super.list_next = (parsec_list_item_t*)__parsec_tp->startup_queue;
+    } while(!parsec_atomic_cas_ptr(&__parsec_tp->startup_queue, (parsec_list_item_t*)this_task->super.list_next, this_task));
+    this_task->status = PARSEC_TASK_STATUS_HOOK;
+
+  PARSEC_AYU_REGISTER_TASK(&redistribute_no_optimization_Init);
+  __parsec_tp->super.super.dependencies_array[0] = PARSEC_OBJ_NEW(parsec_hash_table_t);
+  parsec_hash_table_init(__parsec_tp->super.super.dependencies_array[0], offsetof(parsec_hashable_dependency_t, ht_item), 10, redistribute_no_optimization_redistribute_no_optimization_Init_internal_init_deps_key_functions, this_task->taskpool);
+  __parsec_tp->repositories[0] = data_repo_create_nothreadsafe(nb_tasks, __jdf2c_key_fns_Init, (parsec_taskpool_t*)__parsec_tp, 1);
+(void)saved_nb_tasks;
+(void)__batch_col_min; (void)__batch_col_max;(void)__m_T_min; (void)__m_T_max;(void)__n_T_min; (void)__n_T_max;  (void)__jdf2c_batch_col_start; (void)__jdf2c_batch_col_end; (void)__jdf2c_batch_col_inc;  (void)__jdf2c_m_T_start; (void)__jdf2c_m_T_end; (void)__jdf2c_m_T_inc;  (void)__jdf2c_n_T_start; (void)__jdf2c_n_T_end; (void)__jdf2c_n_T_inc;  (void)assignments; (void)__parsec_tp; (void)es;
+  if(1 == parsec_atomic_fetch_dec_int32(&__parsec_tp->sync_point)) {
+    /* Last initialization task complete. Update the number of tasks. */
+    __parsec_tp->super.super.tdm.module->taskpool_addto_nb_tasks(&__parsec_tp->super.super, __parsec_tp->initial_number_tasks);
+    parsec_mfence();  /* write memory barrier to guarantee that the scheduler gets the correct number of tasks */
+    parsec_taskpool_enable((parsec_taskpool_t*)__parsec_tp, &__parsec_tp->startup_queue,
+                           (parsec_task_t*)this_task, es, __parsec_tp->super.super.nb_pending_actions);
+    __parsec_tp->super.super.tdm.module->taskpool_ready(&__parsec_tp->super.super);
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+    PARSEC_PROFILING_TRACE(es->es_profile,
+                           this_task->taskpool->profiling_array[2 * this_task->task_class->task_class_id + 1],
+                           0,
+                           this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    if( 1 >= __parsec_tp->super.super.nb_pending_actions ) {
+        /* if no tasks will be generated let's prevent the runtime from calling the hook and instead go directly to complete the task */
+        this_task->status = PARSEC_TASK_STATUS_COMPLETE;
+    }
+    return PARSEC_HOOK_RETURN_DONE;
+  }
+  return PARSEC_HOOK_RETURN_ASYNC;
+}
+
+static int __jdf2c_startup_Init(parsec_execution_stream_t * es, __parsec_redistribute_no_optimization_Init_task_t *this_task)
+{
+  __parsec_redistribute_no_optimization_Init_task_t* new_task;
+  __parsec_redistribute_no_optimization_internal_taskpool_t* __parsec_tp = (__parsec_redistribute_no_optimization_internal_taskpool_t*)this_task->taskpool;
+  parsec_context_t *context = __parsec_tp->super.super.context;
+  int vpid = 0, nb_tasks = 0;
+  size_t total_nb_tasks = 0;
+  parsec_list_item_t* pready_ring[context->nb_vp];
+  int restore_context = 0;
+  int batch_col = this_task->locals.batch_col.value;  /* retrieve value saved during the last iteration */
+  int m_T = this_task->locals.m_T.value;  /* retrieve value saved during the last iteration */
+  int n_T = this_task->locals.n_T.value;  /* retrieve value saved during the last iteration */
+  int mb_T_inner = this_task->locals.mb_T_inner.value;  /* retrieve value saved during the last iteration */
+  int nb_T_inner = this_task->locals.nb_T_inner.value;  /* retrieve value saved during the last iteration */
+  int sizei_T = this_task->locals.sizei_T.value;  /* retrieve value saved during the last iteration */
+  int sizej_T = this_task->locals.sizej_T.value;  /* retrieve value saved during the last iteration */
+  int m_Y_start = this_task->locals.m_Y_start.value;  /* retrieve value saved during the last iteration */
+  int n_Y_start = this_task->locals.n_Y_start.value;  /* retrieve value saved during the last iteration */
+  int m_Y_end = this_task->locals.m_Y_end.value;  /* retrieve value saved during the last iteration */
+  int n_Y_end = this_task->locals.n_Y_end.value;  /* retrieve value saved during the last iteration */
+  for(int _i = 0; _i < context->nb_vp; pready_ring[_i++] = NULL );
+  if( 0 != this_task->locals.reserved[0].value ) {
+    this_task->locals.reserved[0].value = 1; /* reset the submission process */
+    restore_context = 1;
+    goto restore_context_0;
+  }
+  this_task->locals.reserved[0].value = 1; /* a sane default value */
+  for(this_task->locals.batch_col.value = batch_col = 0;
+      this_task->locals.batch_col.value <= NT;
+      this_task->locals.batch_col.value += 1, batch_col = this_task->locals.batch_col.value) {
+    for(this_task->locals.m_T.value = m_T = m_T_START;
+        this_task->locals.m_T.value <= m_T_END;
+        this_task->locals.m_T.value += 1, m_T = this_task->locals.m_T.value) {
+      for(this_task->locals.n_T.value = n_T = redistribute_no_optimization_Init_inline_c_expr41_line_166(__parsec_tp, &this_task->locals);
+          this_task->locals.n_T.value <= redistribute_no_optimization_Init_inline_c_expr40_line_166(__parsec_tp, &this_task->locals);
+          this_task->locals.n_T.value += 1, n_T = this_task->locals.n_T.value) {
+        this_task->locals.mb_T_inner.value = mb_T_inner = redistribute_no_optimization_Init_inline_c_expr39_line_168(__parsec_tp, &this_task->locals);
+        this_task->locals.nb_T_inner.value = nb_T_inner = redistribute_no_optimization_Init_inline_c_expr38_line_169(__parsec_tp, &this_task->locals);
+        this_task->locals.sizei_T.value = sizei_T = (((m_T - m_T_START) * mb_T_INNER) - (disi_T % mb_T_INNER));
+        this_task->locals.sizej_T.value = sizej_T = (((n_T - n_T_START) * nb_T_INNER) - (disj_T % nb_T_INNER));
+        this_task->locals.m_Y_start.value = m_Y_start = redistribute_no_optimization_Init_inline_c_expr37_line_174(__parsec_tp, &this_task->locals);
+        this_task->locals.n_Y_start.value = n_Y_start = redistribute_no_optimization_Init_inline_c_expr36_line_175(__parsec_tp, &this_task->locals);
+        this_task->locals.m_Y_end.value = m_Y_end = redistribute_no_optimization_Init_inline_c_expr35_line_176(__parsec_tp, &this_task->locals);
+        this_task->locals.n_Y_end.value = n_Y_end = redistribute_no_optimization_Init_inline_c_expr34_line_177(__parsec_tp, &this_task->locals);
+        if( !Init_pred(batch_col, m_T, n_T, mb_T_inner, nb_T_inner, sizei_T, sizej_T, m_Y_start, n_Y_start, m_Y_end, n_Y_end) ) continue;
+  __parsec_redistribute_no_optimization_Init_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_redistribute_no_optimization_Init_parsec_assignment_t*)&this_task->locals;
+  (void)__jdf2c__tmp_locals;
+  /* Flow for T is always a memory reference */
+        if( NULL != ((parsec_data_collection_t*)__parsec_tp->super._g_descT)->vpid_of ) {
+          vpid = ((parsec_data_collection_t*)__parsec_tp->super._g_descT)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descT, m_T, n_T);
+          assert(context->nb_vp >= vpid);
+        } else {
+          vpid = (vpid + 1) % context->nb_vp;  /* spread the initial joy */
+        }
+        new_task = (__parsec_redistribute_no_optimization_Init_task_t*)parsec_thread_mempool_allocate( context->virtual_processes[vpid]->execution_streams[0]->context_mempool );
+        PARSEC_OBJ_CONSTRUCT(new_task, parsec_task_t); /* construct called only when new, force-construct it again */
+        /* Copy only the valid elements from this_task to new_task one */
+        new_task->taskpool   = this_task->taskpool;
+        new_task->task_class = __parsec_tp->super.super.task_classes_array[redistribute_no_optimization_Init.task_class_id];
+        new_task->chore_mask   = PARSEC_DEV_ALL;
+        new_task->locals.batch_col.value = this_task->locals.batch_col.value;
+        new_task->locals.m_T.value = this_task->locals.m_T.value;
+        new_task->locals.n_T.value = this_task->locals.n_T.value;
+        new_task->locals.mb_T_inner.value = this_task->locals.mb_T_inner.value;
+        new_task->locals.nb_T_inner.value = this_task->locals.nb_T_inner.value;
+        new_task->locals.sizei_T.value = this_task->locals.sizei_T.value;
+        new_task->locals.sizej_T.value = this_task->locals.sizej_T.value;
+        new_task->locals.m_Y_start.value = this_task->locals.m_Y_start.value;
+        new_task->locals.n_Y_start.value = this_task->locals.n_Y_start.value;
+        new_task->locals.m_Y_end.value = this_task->locals.m_Y_end.value;
+        new_task->locals.n_Y_end.value = this_task->locals.n_Y_end.value;
+        PARSEC_LIST_ITEM_SINGLETON(new_task);
+        new_task->priority = __parsec_tp->super.super.priority;
+        new_task->repo_entry = NULL;
+        new_task->data._f_T.source_repo_entry = NULL;
+        new_task->data._f_T.source_repo       = NULL;
+        new_task->data._f_T.data_in         = NULL;
+        new_task->data._f_T.data_out        = NULL;
+        new_task->data._f_T.fulfill         = 0;
+#if defined(PARSEC_DEBUG_NOISIER)
+        {
+          char tmp[128];
+          PARSEC_DEBUG_VERBOSE(10, parsec_debug_output, "Add startup task %s to vpid %d",
+                 parsec_task_snprintf(tmp, 128, (parsec_task_t*)new_task), vpid);
+        }
+#endif
+        parsec_dependencies_mark_task_as_startup((parsec_task_t*)new_task, es);
+        pready_ring[vpid] = parsec_list_item_ring_push_sorted(pready_ring[vpid],
+                                                              (parsec_list_item_t*)new_task,
+                                                              parsec_execution_context_priority_comparator);
+        nb_tasks++;
+       restore_context_0:  /* we jump here just so that we have code after the label */
+        restore_context = 0;
+        (void)restore_context;
+        if( nb_tasks > this_task->locals.reserved[0].value ) {
+          if( (size_t)this_task->locals.reserved[0].value < parsec_task_startup_iter ) this_task->locals.reserved[0].value <<= 1;
+          __parsec_schedule_vp(es, (parsec_task_t**)pready_ring, 0);
+          total_nb_tasks += nb_tasks;
+          nb_tasks = 0;
+          if( total_nb_tasks > parsec_task_startup_chunk ) {  /* stop here and request to be rescheduled */
+            return PARSEC_HOOK_RETURN_AGAIN;
+          }
+        }
+      } /* Loop on normal range n_T */
+    } /* Loop on normal range m_T */
+  } /* Loop on normal range batch_col */
+  (void)vpid;
+  if( 0 != nb_tasks ) {
+    __parsec_schedule_vp(es, (parsec_task_t**)pready_ring, 0);
+    nb_tasks = 0;
+  }
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static const __parsec_chore_t __redistribute_no_optimization_Init_chores[] ={
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+    { .type     = PARSEC_DEV_CPU,
+      .evaluate = (parsec_evaluate_function_t*)NULL,
+      .hook     = (parsec_hook_t*)hook_of_redistribute_no_optimization_Init },
+#endif  /* defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+    { .type     = PARSEC_DEV_NONE,
+      .evaluate = NULL,
+      .hook     = (parsec_hook_t*)NULL },  /* End marker */
+};
+
+static const parsec_task_class_t redistribute_no_optimization_Init = {
+  .name = "Init",
+  .task_class_id = 0,
+  .nb_flows = 1,
+  .nb_parameters = 3,
+  .nb_locals = 11,
+  .task_class_type = PARSEC_TASK_CLASS_TYPE_PTG,
+  .params = { &symb_redistribute_no_optimization_Init_m_T, &symb_redistribute_no_optimization_Init_n_T, &symb_redistribute_no_optimization_Init_batch_col, NULL },
+  .locals = { &symb_redistribute_no_optimization_Init_batch_col, &symb_redistribute_no_optimization_Init_m_T, &symb_redistribute_no_optimization_Init_n_T, &symb_redistribute_no_optimization_Init_mb_T_inner, &symb_redistribute_no_optimization_Init_nb_T_inner, &symb_redistribute_no_optimization_Init_sizei_T, &symb_redistribute_no_optimization_Init_sizej_T, &symb_redistribute_no_optimization_Init_m_Y_start, &symb_redistribute_no_optimization_Init_n_Y_start, &symb_redistribute_no_optimization_Init_m_Y_end, &symb_redistribute_no_optimization_Init_n_Y_end, NULL },
+  .data_affinity = (parsec_data_ref_fn_t*)affinity_of_redistribute_no_optimization_Init,
+  .initial_data = (parsec_data_ref_fn_t*)affinity_of_redistribute_no_optimization_Init,
+  .final_data = (parsec_data_ref_fn_t*)affinity_of_redistribute_no_optimization_Init,
+  .priority = NULL,
+  .properties = properties_of_redistribute_no_optimization_Init,
+#if MAX_PARAM_COUNT < 1  /* number of read flows of Init */
+  #error Too many read flows for task Init
+#endif  /* MAX_PARAM_COUNT */
+#if MAX_PARAM_COUNT < 1  /* number of write flows of Init */
+  #error Too many write flows for task Init
+#endif  /* MAX_PARAM_COUNT */
+  .in = { &flow_of_redistribute_no_optimization_Init_for_T, NULL },
+  .out = { &flow_of_redistribute_no_optimization_Init_for_T, NULL },
+  .flags = 0x0 | PARSEC_HAS_IN_IN_DEPENDENCIES | PARSEC_USE_DEPS_MASK,
+  .dependencies_goal = 0x1,
+  .make_key = __jdf2c_make_key_Init,
+  .task_snprintf = parsec_task_snprintf,
+#if defined(PARSEC_PROF_TRACE)
+  .profile_info = &parsec_task_profile_info,
+#endif
+  .key_functions = &__jdf2c_key_fns_Init,
+  .fini = (parsec_hook_t*)NULL,
+  .incarnations = __redistribute_no_optimization_Init_chores,
+  .find_deps = parsec_hash_find_deps,
+  .update_deps = parsec_update_deps_with_mask,
+  .iterate_successors = (parsec_traverse_function_t*)iterate_successors_of_redistribute_no_optimization_Init,
+  .iterate_predecessors = (parsec_traverse_function_t*)NULL,
+  .release_deps = (parsec_release_deps_t*)release_deps_of_redistribute_no_optimization_Init,
+  .prepare_output = (parsec_hook_t*)NULL,
+  .prepare_input = (parsec_hook_t*)data_lookup_of_redistribute_no_optimization_Init,
+  .time_estimate = NULL,
+  .get_datatype = datatype_lookup_of_redistribute_no_optimization_Init,
+  .complete_execution = (parsec_hook_t*)complete_hook_of_redistribute_no_optimization_Init,
+  .release_task = &release_task_of_redistribute_no_optimization_Init,
+#if defined(PARSEC_SIM)
+  .sim_cost_fct = (parsec_sim_cost_fct_t*)NULL,
+#endif
+};
+
+
+static const parsec_task_class_t *redistribute_no_optimization_task_classes[] = {
+  &redistribute_no_optimization_Init,
+  &redistribute_no_optimization_Send,
+  &redistribute_no_optimization_Update,
+  &redistribute_no_optimization_Receive
+};
+
+static void redistribute_no_optimization_startup(parsec_context_t *context, __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp, parsec_list_item_t ** ready_tasks)
+{
+  uint32_t i, supported_dev = 0;
+ 
+  for( i = 0; i < parsec_nb_devices; i++ ) {
+    if( !(__parsec_tp->super.super.devices_index_mask & (1<<i)) ) continue;
+    parsec_device_module_t* device = parsec_mca_device_get(i);
+    parsec_data_collection_t* parsec_dc;
+ 
+    if(NULL == device) continue;
+    if(NULL != device->taskpool_register)
+      if( PARSEC_SUCCESS != device->taskpool_register(device, (parsec_taskpool_t*)__parsec_tp) ) {
+        parsec_debug_verbose(5, parsec_debug_output, "Device %s refused to register taskpool %p", device->name, __parsec_tp);
+        __parsec_tp->super.super.devices_index_mask &= ~(1 << device->device_index);
+        continue;
+      }
+    if(NULL != device->memory_register) {  /* Register all the data */
+      parsec_dc = (parsec_data_collection_t*)__parsec_tp->super._g_descY;
+      if( (NULL != parsec_dc->register_memory) &&
+          (PARSEC_SUCCESS != parsec_dc->register_memory(parsec_dc, device)) ) {
+        parsec_debug_verbose(3, parsec_debug_output, "Device %s refused to register memory for data %s (%p) from taskpool %p",
+                     device->name, parsec_dc->key_base, parsec_dc, __parsec_tp);
+        __parsec_tp->super.super.devices_index_mask &= ~(1 << device->device_index);
+      }
+      parsec_dc = (parsec_data_collection_t*)__parsec_tp->super._g_descT;
+      if( (NULL != parsec_dc->register_memory) &&
+          (PARSEC_SUCCESS != parsec_dc->register_memory(parsec_dc, device)) ) {
+        parsec_debug_verbose(3, parsec_debug_output, "Device %s refused to register memory for data %s (%p) from taskpool %p",
+                     device->name, parsec_dc->key_base, parsec_dc, __parsec_tp);
+        __parsec_tp->super.super.devices_index_mask &= ~(1 << device->device_index);
+      }
+    }
+    supported_dev |= device->type;
+  }
+  /* Remove all the chores without a backend device */
+  for( i = 0; i < PARSEC_redistribute_no_optimization_NB_TASK_CLASSES; i++ ) {
+    parsec_task_class_t* tc = (parsec_task_class_t*)__parsec_tp->super.super.task_classes_array[i];
+    __parsec_chore_t* chores = (__parsec_chore_t*)tc->incarnations;
+    uint32_t idx = 0, j;
+    for( j = 0; PARSEC_DEV_NONE != chores[j].type; j++ ) {
+      if( !(supported_dev & chores[j].type) ) continue;
+      if( j != idx ) {
+        chores[idx] = chores[j];
+        parsec_debug_verbose(20, parsec_debug_output, "Device type %i disabled for function %s"
+, chores[j].type, tc->name);
+      }
+      idx++;
+    }
+    chores[idx].type     = PARSEC_DEV_NONE;
+    chores[idx].evaluate = NULL;
+    chores[idx].hook     = NULL;
+    /* Create the initialization tasks for each taskclass */
+    parsec_task_t* task = (parsec_task_t*)parsec_thread_mempool_allocate(context->virtual_processes[0]->execution_streams[0]->context_mempool);
+    PARSEC_OBJ_CONSTRUCT(task, parsec_task_t); /* construct called only when new, force-construct it again */
+    task->taskpool = (parsec_taskpool_t *)__parsec_tp;
+    task->chore_mask = PARSEC_DEV_CPU;
+    memset(&task->locals, 0, sizeof(parsec_assignment_t) * MAX_LOCAL_COUNT);
+    PARSEC_LIST_ITEM_SINGLETON(task);
+    task->priority = -1;
+    task->task_class = task->taskpool->task_classes_array[PARSEC_redistribute_no_optimization_NB_TASK_CLASSES + i];
+    int where = i % context->nb_vp;
+    if( NULL == ready_tasks[where] ) ready_tasks[where] = &task->super;
+    else ready_tasks[where] = parsec_list_item_ring_push(ready_tasks[where], &task->super);
+  }
+}
+static void __parsec_redistribute_no_optimization_internal_destructor( __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp )
+{
+  uint32_t i;
+  parsec_taskpool_unregister( &__parsec_tp->super.super );
+  if(NULL != __parsec_tp->super.super.tdm.module) __parsec_tp->super.super.tdm.module->unmonitor_taskpool(&__parsec_tp->super.super);
+  for( i = 0; i < (uint32_t)(2 * __parsec_tp->super.super.nb_task_classes); i++ ) {  /* Extra startup function added at the end */
+    parsec_task_class_t* tc = (parsec_task_class_t*)__parsec_tp->super.super.task_classes_array[i];
+    free((void*)tc->incarnations);
+    free(tc);
+  }
+  free(__parsec_tp->super.super.task_classes_array); __parsec_tp->super.super.task_classes_array = NULL;
+  __parsec_tp->super.super.nb_task_classes = 0;
+
+  for(i = 0; i < (uint32_t)__parsec_tp->super.arenas_datatypes_size; i++) {
+    if( NULL != __parsec_tp->super.arenas_datatypes[i].arena ) {
+      PARSEC_OBJ_RELEASE(__parsec_tp->super.arenas_datatypes[i].arena);
+    }
+  }
+  /* Destroy the data repositories for this object */
+   data_repo_destroy_nothreadsafe(__parsec_tp->repositories[3]);  /* Receive */
+   data_repo_destroy_nothreadsafe(__parsec_tp->repositories[2]);  /* Update */
+   data_repo_destroy_nothreadsafe(__parsec_tp->repositories[1]);  /* Send */
+   data_repo_destroy_nothreadsafe(__parsec_tp->repositories[0]);  /* Init */
+  /* Release the dependencies arrays for this object */
+  parsec_hash_table_fini( (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[3] );
+  PARSEC_OBJ_RELEASE(__parsec_tp->super.super.dependencies_array[3]);
+  __parsec_tp->super.super.dependencies_array[3] = NULL;
+  parsec_hash_table_fini( (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[2] );
+  PARSEC_OBJ_RELEASE(__parsec_tp->super.super.dependencies_array[2]);
+  __parsec_tp->super.super.dependencies_array[2] = NULL;
+  parsec_hash_table_fini( (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[1] );
+  PARSEC_OBJ_RELEASE(__parsec_tp->super.super.dependencies_array[1]);
+  __parsec_tp->super.super.dependencies_array[1] = NULL;
+  parsec_hash_table_fini( (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[0] );
+  PARSEC_OBJ_RELEASE(__parsec_tp->super.super.dependencies_array[0]);
+  __parsec_tp->super.super.dependencies_array[0] = NULL;
+  free( __parsec_tp->super.super.dependencies_array );
+  __parsec_tp->super.super.dependencies_array = NULL;
+  /* Unregister all the data */
+  uint32_t _i;
+  for( _i = 0; _i < parsec_nb_devices; _i++ ) {
+    parsec_device_module_t* device;
+    parsec_data_collection_t* parsec_dc;
+    if(!(__parsec_tp->super.super.devices_index_mask & (1 << _i))) continue;
+    if((NULL == (device = parsec_mca_device_get(_i))) || (NULL == device->memory_unregister)) continue;
+    parsec_dc = (parsec_data_collection_t*)__parsec_tp->super._g_descY;
+  if( NULL != parsec_dc->unregister_memory ) { (void)parsec_dc->unregister_memory(parsec_dc, device); };
+  parsec_dc = (parsec_data_collection_t*)__parsec_tp->super._g_descT;
+  if( NULL != parsec_dc->unregister_memory ) { (void)parsec_dc->unregister_memory(parsec_dc, device); };
+}
+  /* Unregister the taskpool from the devices */
+  for( i = 0; i < parsec_nb_devices; i++ ) {
+    if(!(__parsec_tp->super.super.devices_index_mask & (1 << i))) continue;
+    __parsec_tp->super.super.devices_index_mask ^= (1 << i);
+    parsec_device_module_t* device = parsec_mca_device_get(i);
+    if((NULL == device) || (NULL == device->taskpool_unregister)) continue;
+    if( PARSEC_SUCCESS != device->taskpool_unregister(device, &__parsec_tp->super.super) ) continue;
+  }
+  free(__parsec_tp->super.super.taskpool_name); __parsec_tp->super.super.taskpool_name = NULL;
+}
+
+void __parsec_redistribute_no_optimization_internal_constructor(__parsec_redistribute_no_optimization_internal_taskpool_t* __parsec_tp)
+{
+  parsec_task_class_t* tc;
+  uint32_t i, j;
+
+  __parsec_tp->super.super.nb_task_classes = PARSEC_redistribute_no_optimization_NB_TASK_CLASSES;
+  __parsec_tp->super.super.devices_index_mask = PARSEC_DEVICES_ALL;
+  __parsec_tp->super.super.taskpool_name = strdup("redistribute_no_optimization");
+  parsec_termdet_open_module(&__parsec_tp->super.super, "local");
+  __parsec_tp->super.super.tdm.module->monitor_taskpool(&__parsec_tp->super.super,
+                                                        parsec_taskpool_termination_detected);
+  __parsec_tp->super.super.update_nb_runtime_task = parsec_add_fetch_runtime_task;
+  __parsec_tp->super.super.dependencies_array = (void **)
+              calloc(__parsec_tp->super.super.nb_task_classes, sizeof(void*));
+  /* Twice the size to hold the startup tasks function_t */
+  __parsec_tp->super.super.task_classes_array = (const parsec_task_class_t**)
+              calloc((2 * PARSEC_redistribute_no_optimization_NB_TASK_CLASSES + 1), sizeof(parsec_task_class_t*));
+  __parsec_tp->super.super.tdm.module->taskpool_addto_runtime_actions(&__parsec_tp->super.super, PARSEC_redistribute_no_optimization_NB_TASK_CLASSES);  /* for the startup tasks */
+  __parsec_tp->super.super.taskpool_type = PARSEC_TASKPOOL_TYPE_PTG;
+  __parsec_tp->sync_point = __parsec_tp->super.super.nb_task_classes;
+  __parsec_tp->initial_number_tasks = 0;
+  __parsec_tp->startup_queue = NULL;
+  for( i = 0; i < __parsec_tp->super.super.nb_task_classes; i++ ) {
+    __parsec_tp->super.super.task_classes_array[i] = tc = malloc(sizeof(parsec_task_class_t));
+    memcpy(tc, redistribute_no_optimization_task_classes[i], sizeof(parsec_task_class_t));
+    for( j = 0; PARSEC_DEV_NONE != tc->incarnations[j].type; j++);  /* compute the number of incarnations */
+    tc->incarnations = (__parsec_chore_t*)malloc((j+1) * sizeof(__parsec_chore_t));
+        memcpy((__parsec_chore_t*)tc->incarnations, redistribute_no_optimization_task_classes[i]->incarnations, (j+1) * sizeof(__parsec_chore_t));
+
+    /* Add a placeholder for initialization and startup task */
+    __parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+i] = tc = (parsec_task_class_t*)malloc(sizeof(parsec_task_class_t));
+    memcpy(tc, (void*)&__parsec_generic_startup, sizeof(parsec_task_class_t));
+    tc->task_class_id = __parsec_tp->super.super.nb_task_classes + i;
+    tc->incarnations = (__parsec_chore_t*)malloc(2 * sizeof(__parsec_chore_t));
+    memcpy((__parsec_chore_t*)tc->incarnations, (void*)__parsec_generic_startup.incarnations, 2 * sizeof(__parsec_chore_t));
+    tc->release_task = parsec_release_task_to_mempool_and_count_as_runtime_tasks;
+  }
+  /* Startup task for Receive */
+  tc = (parsec_task_class_t *)__parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+0];
+  tc->name = "Startup for Receive";
+  tc->prepare_input = (parsec_hook_t*)redistribute_no_optimization_Receive_internal_init;
+  /* Startup task for Update */
+  tc = (parsec_task_class_t *)__parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+1];
+  tc->name = "Startup for Update";
+  tc->prepare_input = (parsec_hook_t*)redistribute_no_optimization_Update_internal_init;
+  /* Startup task for Send */
+  tc = (parsec_task_class_t *)__parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+2];
+  tc->name = "Startup for Send";
+  tc->prepare_input = (parsec_hook_t*)redistribute_no_optimization_Send_internal_init;
+  ((__parsec_chore_t*)&tc->incarnations[0])->hook = (parsec_hook_t *)__jdf2c_startup_Send;
+  /* Startup task for Init */
+  tc = (parsec_task_class_t *)__parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+3];
+  tc->name = "Startup for Init";
+  tc->prepare_input = (parsec_hook_t*)redistribute_no_optimization_Init_internal_init;
+  ((__parsec_chore_t*)&tc->incarnations[0])->hook = (parsec_hook_t *)__jdf2c_startup_Init;
+  /* Compute the number of arenas_datatypes: */
+  /*   PARSEC_redistribute_no_optimization_TARGET_ARENA  ->  0 */
+  /*   PARSEC_redistribute_no_optimization_DEFAULT_ARENA  ->  1 */
+  /*   PARSEC_redistribute_no_optimization_SOURCE_ARENA  ->  2 */
+  __parsec_tp->super.arenas_datatypes_size = 3;
+  memset(&__parsec_tp->super.arenas_datatypes[0], 0, __parsec_tp->super.arenas_datatypes_size*sizeof(parsec_arena_datatype_t));
+  /* If profiling is enabled, the keys for profiling */
+#  if defined(PARSEC_PROF_TRACE)
+  __parsec_tp->super.super.profiling_array = redistribute_no_optimization_profiling_array;
+  if( -2 == redistribute_no_optimization_profiling_array[0] ) {
+    #if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+parsec_profiling_add_dictionary_keyword("redistribute_no_optimization::Receive::internal init", "fill:34D8D8",
+                                       0,
+                                       NULL,
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(redistribute_no_optimization_Receive.task_class_id  + PARSEC_redistribute_no_optimization_NB_TASK_CLASSES)/* Receive (internal init) start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(redistribute_no_optimization_Receive.task_class_id  + PARSEC_redistribute_no_optimization_NB_TASK_CLASSES)/* Receive (internal init) end key */]);
+#endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+parsec_profiling_add_dictionary_keyword("redistribute_no_optimization::Receive", "fill:CC2828",
+                                       sizeof(parsec_task_prof_info_t)+16*sizeof(parsec_assignment_t),
+                                       "dc_key{uint64_t};priority{int32_t};dc_dataid{uint32_t};tcid{uint32_t};trc{int32_t};batch_col{int32_t};m_T{int32_t};n_T{int32_t};mb_T_inner{int32_t};nb_T_inner{int32_t};nb_T_inner_next{int32_t};sizei_T{int32_t};sizej_T{int32_t};i_start{int32_t};j_start{int32_t};m_Y_start{int32_t};n_Y_start{int32_t};m_Y_end{int32_t};n_Y_end{int32_t};n_Y_start_next{int32_t};n_Y_end_next{int32_t}",
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(redistribute_no_optimization_Receive.task_class_id) /* Receive start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(redistribute_no_optimization_Receive.task_class_id) /* Receive end key */]);
+
+    #if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+parsec_profiling_add_dictionary_keyword("redistribute_no_optimization::Update::internal init", "fill:8634D8",
+                                       0,
+                                       NULL,
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(redistribute_no_optimization_Update.task_class_id  + PARSEC_redistribute_no_optimization_NB_TASK_CLASSES)/* Update (internal init) start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(redistribute_no_optimization_Update.task_class_id  + PARSEC_redistribute_no_optimization_NB_TASK_CLASSES)/* Update (internal init) end key */]);
+#endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+parsec_profiling_add_dictionary_keyword("redistribute_no_optimization::Update", "fill:7ACC28",
+                                       sizeof(parsec_task_prof_info_t)+17*sizeof(parsec_assignment_t),
+                                       "dc_key{uint64_t};priority{int32_t};dc_dataid{uint32_t};tcid{uint32_t};trc{int32_t};batch_col{int32_t};m_T{int32_t};n_T{int32_t};mb_T_inner{int32_t};nb_T_inner{int32_t};i_start{int32_t};j_start{int32_t};m_Y_start{int32_t};n_Y_start{int32_t};m_Y_end{int32_t};n_Y_end{int32_t};m_Y{int32_t};n_Y{int32_t};TL_row{int32_t};TL_col{int32_t};BR_row{int32_t};BR_col{int32_t}",
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(redistribute_no_optimization_Update.task_class_id) /* Update start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(redistribute_no_optimization_Update.task_class_id) /* Update end key */]);
+
+    #if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+parsec_profiling_add_dictionary_keyword("redistribute_no_optimization::Send::internal init", "fill:D83434",
+                                       0,
+                                       NULL,
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(redistribute_no_optimization_Send.task_class_id  + PARSEC_redistribute_no_optimization_NB_TASK_CLASSES)/* Send (internal init) start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(redistribute_no_optimization_Send.task_class_id  + PARSEC_redistribute_no_optimization_NB_TASK_CLASSES)/* Send (internal init) end key */]);
+#endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+parsec_profiling_add_dictionary_keyword("redistribute_no_optimization::Send", "fill:28CCCC",
+                                       sizeof(parsec_task_prof_info_t)+13*sizeof(parsec_assignment_t),
+                                       "dc_key{uint64_t};priority{int32_t};dc_dataid{uint32_t};tcid{uint32_t};trc{int32_t};batch_col{int32_t};m_T{int32_t};n_T{int32_t};mb_T_inner{int32_t};nb_T_inner{int32_t};i_start{int32_t};j_start{int32_t};m_Y_start{int32_t};n_Y_start{int32_t};m_Y_end{int32_t};n_Y_end{int32_t};m_Y{int32_t};n_Y{int32_t}",
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(redistribute_no_optimization_Send.task_class_id) /* Send start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(redistribute_no_optimization_Send.task_class_id) /* Send end key */]);
+
+    #if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+parsec_profiling_add_dictionary_keyword("redistribute_no_optimization::Init::internal init", "fill:86D834",
+                                       0,
+                                       NULL,
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(redistribute_no_optimization_Init.task_class_id  + PARSEC_redistribute_no_optimization_NB_TASK_CLASSES)/* Init (internal init) start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(redistribute_no_optimization_Init.task_class_id  + PARSEC_redistribute_no_optimization_NB_TASK_CLASSES)/* Init (internal init) end key */]);
+#endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+parsec_profiling_add_dictionary_keyword("redistribute_no_optimization::Init", "fill:7A28CC",
+                                       sizeof(parsec_task_prof_info_t)+11*sizeof(parsec_assignment_t),
+                                       "dc_key{uint64_t};priority{int32_t};dc_dataid{uint32_t};tcid{uint32_t};trc{int32_t};batch_col{int32_t};m_T{int32_t};n_T{int32_t};mb_T_inner{int32_t};nb_T_inner{int32_t};sizei_T{int32_t};sizej_T{int32_t};m_Y_start{int32_t};n_Y_start{int32_t};m_Y_end{int32_t};n_Y_end{int32_t}",
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(redistribute_no_optimization_Init.task_class_id) /* Init start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(redistribute_no_optimization_Init.task_class_id) /* Init end key */]);
+
+  }
+#  endif /* defined(PARSEC_PROF_TRACE) */
+  __parsec_tp->super.super.repo_array = __parsec_tp->repositories;
+  __parsec_tp->super.super.startup_hook = (parsec_startup_fn_t)redistribute_no_optimization_startup;
+  (void)parsec_taskpool_reserve_id((parsec_taskpool_t*)__parsec_tp);
+}
+
+  /** Generate class declaration and instance using the above constructor and destructor */
+  PARSEC_OBJ_CLASS_DECLARATION(__parsec_redistribute_no_optimization_internal_taskpool_t);
+  PARSEC_OBJ_CLASS_INSTANCE(__parsec_redistribute_no_optimization_internal_taskpool_t, parsec_redistribute_no_optimization_taskpool_t,
+                            __parsec_redistribute_no_optimization_internal_constructor, __parsec_redistribute_no_optimization_internal_destructor);
+
+#undef descY
+#undef descT
+#undef size_row
+#undef size_col
+#undef disi_Y
+#undef disj_Y
+#undef disi_T
+#undef disj_T
+#undef R
+#undef mb_Y_INNER
+#undef nb_Y_INNER
+#undef mb_T_INNER
+#undef nb_T_INNER
+#undef m_T_START
+#undef n_T_START
+#undef m_T_END
+#undef n_T_END
+#undef num_col
+#undef NT
+
+parsec_redistribute_no_optimization_taskpool_t *parsec_redistribute_no_optimization_new(parsec_tiled_matrix_t* descY /* data descY */, parsec_tiled_matrix_t* descT /* data descT */, int size_row, int size_col, int disi_Y, int disj_Y, int disi_T, int disj_T, int R)
+{
+  __parsec_redistribute_no_optimization_internal_taskpool_t *__parsec_tp = PARSEC_OBJ_NEW(__parsec_redistribute_no_optimization_internal_taskpool_t);
+  /* Dump the hidden parameters with default values */
+  int mb_Y_INNER;
+  int nb_Y_INNER;
+  int mb_T_INNER;
+  int nb_T_INNER;
+  int m_T_START;
+  int n_T_START;
+  int m_T_END;
+  int n_T_END;
+  int num_col;
+  int NT;
+  /* Now the Parameter-dependent structures: */
+  __parsec_tp->super._g_descY = descY;
+  __parsec_tp->super._g_descT = descT;
+  __parsec_tp->super._g_size_row = size_row;
+  __parsec_tp->super._g_size_col = size_col;
+  __parsec_tp->super._g_disi_Y = disi_Y;
+  __parsec_tp->super._g_disj_Y = disj_Y;
+  __parsec_tp->super._g_disi_T = disi_T;
+  __parsec_tp->super._g_disj_T = disj_T;
+  __parsec_tp->super._g_R = R;
+  __parsec_tp->super._g_mb_Y_INNER = mb_Y_INNER = descY->mb-2*R;
+  __parsec_tp->super._g_nb_Y_INNER = nb_Y_INNER = descY->nb-2*R;
+  __parsec_tp->super._g_mb_T_INNER = mb_T_INNER = descT->mb-2*R;
+  __parsec_tp->super._g_nb_T_INNER = nb_T_INNER = descT->nb-2*R;
+  __parsec_tp->super._g_m_T_START = m_T_START = disi_T/mb_T_INNER;
+  __parsec_tp->super._g_n_T_START = n_T_START = disj_T/nb_T_INNER;
+  __parsec_tp->super._g_m_T_END = m_T_END = (size_row+disi_T-1)/mb_T_INNER;
+  __parsec_tp->super._g_n_T_END = n_T_END = (size_col+disj_T-1)/nb_T_INNER;
+  __parsec_tp->super._g_num_col = num_col = 16;
+  __parsec_tp->super._g_NT = NT = (n_T_END-n_T_START)/num_col;
+  PARSEC_AYU_REGISTER_TASK(&redistribute_no_optimization_Receive);
+  PARSEC_AYU_REGISTER_TASK(&redistribute_no_optimization_Update);
+  PARSEC_AYU_REGISTER_TASK(&redistribute_no_optimization_Send);
+  PARSEC_AYU_REGISTER_TASK(&redistribute_no_optimization_Init);
+  __parsec_tp->super.super.startup_hook = (parsec_startup_fn_t)redistribute_no_optimization_startup;
+  (void)parsec_taskpool_reserve_id((parsec_taskpool_t*)__parsec_tp);
+/* Prevent warnings related to not used hidden global variables */
+  (void)mb_Y_INNER;  (void)nb_Y_INNER;  (void)mb_T_INNER;  (void)nb_T_INNER;  (void)m_T_START;  (void)n_T_START;  (void)m_T_END;  (void)n_T_END;  (void)num_col;  (void)NT;
+  return (parsec_redistribute_no_optimization_taskpool_t*)__parsec_tp;
+}
+
+
+/**
+ * @brief New function for redistribute_no_optimization
+ *
+ * @param [in] dcY: the data, already distributed and allocated
+ * @param [out] dcT: the data, redistribute_no_optimizationd and allocated
+ * @param [in] size_row: row size to be redistribute_no_optimizationd
+ * @param [in] size_col: column size to be redistribute_no_optimizationd
+ * @param [in] disi_Y: row displacement in dcY
+ * @param [in] disj_Y: column displacement in dcY
+ * @param [in] disi_T: row displacement in dcT
+ * @param [in] disj_T: column displacement in dcT
+ * @return the parsec object to schedule.
+ */
+parsec_taskpool_t*
+parsec_redistribute_no_optimization_New(parsec_tiled_matrix_t *dcY,
+                        parsec_tiled_matrix_t *dcT,
+                        int size_row, int size_col,
+                        int disi_Y, int disj_Y,
+                        int disi_T, int disj_T)
+{
+    parsec_taskpool_t* redistribute_no_optimization_taskpool;
+
+    if( size_row < 1 || size_col < 1 ) {
+        if( 0 == dcY->super.myrank )
+            fprintf(stderr, "ERROR: Submatrix size should be bigger than 1\n");
+        exit(1);
+    }
+
+    if( disi_Y < 0 || disj_Y < 0 ) {
+        if( 0 == dcY->super.myrank )
+            fprintf(stderr, "ERROR: Source displacement should not be negative\n");
+        exit(1);
+    }
+
+    if( disi_T < 0 || disj_T < 0 ) {
+        if( 0 == dcY->super.myrank )
+            fprintf(stderr, "ERROR: Target displacement should not be negative\n");
+        exit(1);
+    }
+
+    if( (disi_Y+size_row > dcY->lmt*dcY->mb)
+        || (disj_Y+size_col > dcY->lnt*dcY->nb) ){
+        if( 0 == dcY->super.myrank )
+            fprintf(stderr, "ERROR: Submatrix exceed SOURCE size\n");
+        exit(1);
+    }
+
+    if( (disi_T+size_row > dcT->lmt*dcT->mb)
+        || (disj_T+size_col > dcT->lnt*dcT->nb) ){
+        if( 0 == dcY->super.myrank )
+            fprintf(stderr, "ERROR: Submatrix exceed TARGET size\n");
+        exit(1);
+    }
+
+    parsec_redistribute_no_optimization_taskpool_t* taskpool = NULL;
+    /* new taskpool */
+    taskpool = parsec_redistribute_no_optimization_new(dcY, dcT, size_row, size_col, disi_Y, disj_Y, disi_T, disj_T, 0);
+    redistribute_no_optimization_taskpool = (parsec_taskpool_t*)taskpool;
+
+    /* Check distribution, and detarmine batch size: num_col */
+    if( (dcY->dtype & parsec_matrix_tabular_type) && (dcT->dtype & parsec_matrix_tabular_type) ) {
+        taskpool->_g_num_col = parsec_imin( ceil(size_col/dcY->nb), dcY->super.nodes );
+    } else if( (dcY->dtype & parsec_matrix_tabular_type) && (dcT->dtype & parsec_matrix_block_cyclic_type) ) {
+        taskpool->_g_num_col = ((parsec_matrix_block_cyclic_t *)dcT)->grid.cols * ((parsec_matrix_block_cyclic_t *)dcT)->grid.kcols;
+    } else if( (dcY->dtype & parsec_matrix_block_cyclic_type) && (dcT->dtype & parsec_matrix_tabular_type) ) {
+        taskpool->_g_num_col = ((parsec_matrix_block_cyclic_t *)dcY)->grid.cols * ((parsec_matrix_block_cyclic_t *)dcY)->grid.kcols;
+    } else if( (dcY->dtype & parsec_matrix_block_cyclic_type) && (dcT->dtype & parsec_matrix_block_cyclic_type) ) {
+        taskpool->_g_num_col = parsec_imax( ((parsec_matrix_block_cyclic_t *)dcY)->grid.cols * ((parsec_matrix_block_cyclic_t *)dcY)->grid.kcols, ((parsec_matrix_block_cyclic_t *)dcT)->grid.cols * ((parsec_matrix_block_cyclic_t *)dcT)->grid.kcols );
+    } else {
+        fprintf(stderr, "Only support parsec_matrix_block_cyclic_type and parsec_matrix_tabular_type\n");
+        exit(1);
+    }
+
+    /* Calculate NT, need to update !!! */
+    int n_T_START = disj_T / dcT->nb;
+    int n_T_END = (size_col+disj_T-1) / dcT->nb;
+    taskpool->_g_NT = (n_T_END-n_T_START)/taskpool->_g_num_col;
+
+    parsec_add2arena(&taskpool->arenas_datatypes[PARSEC_redistribute_no_optimization_TARGET_ADT_IDX],
+                                MY_TYPE, PARSEC_MATRIX_FULL,
+                                1, dcT->mb, dcT->nb, dcT->mb,
+                                PARSEC_ARENA_ALIGNMENT_SSE, -1 );
+
+    parsec_add2arena(&taskpool->arenas_datatypes[PARSEC_redistribute_no_optimization_SOURCE_ADT_IDX],
+		    MY_TYPE, PARSEC_MATRIX_FULL,
+		    1, dcY->mb, dcY->nb, dcY->mb,
+		    PARSEC_ARENA_ALIGNMENT_SSE, -1 );
+
+    return redistribute_no_optimization_taskpool;
+}
+
+/**
+ * @param [inout] the parsec object to destroy
+ */
+static void
+__parsec_taskpool_redistribute_no_optimization_destructor(parsec_redistribute_no_optimization_taskpool_t *redistribute_no_optimization_taskpool)
+{
+    parsec_del2arena(&redistribute_no_optimization_taskpool->arenas_datatypes[PARSEC_redistribute_no_optimization_TARGET_ADT_IDX]);
+    parsec_del2arena(&redistribute_no_optimization_taskpool->arenas_datatypes[PARSEC_redistribute_no_optimization_SOURCE_ADT_IDX]);
+}
+
+PARSEC_OBJ_CLASS_INSTANCE(parsec_redistribute_no_optimization_taskpool_t, parsec_taskpool_t,
+                          NULL, __parsec_taskpool_redistribute_no_optimization_destructor);
+
+/**
+ * @brief Redistribute dcY to dcT in PTG: no optimization of varible size
+ *
+ * @param [in] dcY: source distribution, already distributed and allocated
+ * @param [out] dcT: target distribution, redistribute_no_optimizationd and allocated
+ * @param [in] size_row: row size to be redistribute_no_optimizationd
+ * @param [in] size_col: column size to be redistribute_no_optimizationd
+ * @param [in] disi_Y: row displacement in dcY
+ * @param [in] disj_Y: column displacement in dcY
+ * @param [in] disi_T: row displacement in dcT
+ * @param [in] disj_T: column displacement in dcT
+ */
+int parsec_redistribute_no_optimization(parsec_context_t *parsec,
+                        parsec_tiled_matrix_t *dcY,
+                        parsec_tiled_matrix_t *dcT,
+                        int size_row, int size_col,
+                        int disi_Y, int disj_Y,
+                        int disi_T, int disj_T)
+{
+    parsec_taskpool_t *parsec_redistribute_no_optimization_ptg = NULL;
+
+    parsec_redistribute_no_optimization_ptg = parsec_redistribute_no_optimization_New(
+                              dcY, dcT, size_row, size_col, disi_Y,
+                              disj_Y, disi_T, disj_T);
+
+    if( NULL != parsec_redistribute_no_optimization_ptg ){
+        parsec_context_add_taskpool(parsec, parsec_redistribute_no_optimization_ptg);
+        parsec_context_start(parsec);
+        parsec_context_wait(parsec);
+        parsec_taskpool_free(parsec_redistribute_no_optimization_ptg);
+    }
+
+    return 0;
+}
+
@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/_debug_build/tests/collections/reshape/avoidable_reshape.c" "tests/collections/reshape/CMakeFiles/avoidable_reshape.dir/avoidable_reshape.c.o" "gcc" "tests/collections/reshape/CMakeFiles/avoidable_reshape.dir/avoidable_reshape.c.o.d"
+  "/root/repo/tests/collections/reshape/common.c" "tests/collections/reshape/CMakeFiles/avoidable_reshape.dir/common.c.o" "gcc" "tests/collections/reshape/CMakeFiles/avoidable_reshape.dir/common.c.o.d"
+  "/root/repo/_debug_build/tests/collections/reshape/local_reuse_reshape.c" "tests/collections/reshape/CMakeFiles/avoidable_reshape.dir/local_reuse_reshape.c.o" "gcc" "tests/collections/reshape/CMakeFiles/avoidable_reshape.dir/local_reuse_reshape.c.o.d"
+  "/root/repo/tests/collections/reshape/testing_avoidable_reshape.c" "tests/collections/reshape/CMakeFiles/avoidable_reshape.dir/testing_avoidable_reshape.c.o" "gcc" "tests/collections/reshape/CMakeFiles/avoidable_reshape.dir/testing_avoidable_reshape.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_debug_build/parsec/CMakeFiles/parsec.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "/root/repo/_debug_build/parsec/include/fortran")
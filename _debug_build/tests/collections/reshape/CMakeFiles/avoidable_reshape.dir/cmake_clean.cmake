@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/avoidable_reshape.dir/avoidable_reshape.c.o"
+  "CMakeFiles/avoidable_reshape.dir/avoidable_reshape.c.o.d"
+  "CMakeFiles/avoidable_reshape.dir/common.c.o"
+  "CMakeFiles/avoidable_reshape.dir/common.c.o.d"
+  "CMakeFiles/avoidable_reshape.dir/local_reuse_reshape.c.o"
+  "CMakeFiles/avoidable_reshape.dir/local_reuse_reshape.c.o.d"
+  "CMakeFiles/avoidable_reshape.dir/testing_avoidable_reshape.c.o"
+  "CMakeFiles/avoidable_reshape.dir/testing_avoidable_reshape.c.o.d"
+  "avoidable_reshape"
+  "avoidable_reshape.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/avoidable_reshape.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
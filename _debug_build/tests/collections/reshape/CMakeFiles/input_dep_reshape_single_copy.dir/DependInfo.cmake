@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/collections/reshape/common.c" "tests/collections/reshape/CMakeFiles/input_dep_reshape_single_copy.dir/common.c.o" "gcc" "tests/collections/reshape/CMakeFiles/input_dep_reshape_single_copy.dir/common.c.o.d"
+  "/root/repo/_debug_build/tests/collections/reshape/input_dep_single_copy_reshape.c" "tests/collections/reshape/CMakeFiles/input_dep_reshape_single_copy.dir/input_dep_single_copy_reshape.c.o" "gcc" "tests/collections/reshape/CMakeFiles/input_dep_reshape_single_copy.dir/input_dep_single_copy_reshape.c.o.d"
+  "/root/repo/tests/collections/reshape/testing_input_dep_reshape_single_copy.c" "tests/collections/reshape/CMakeFiles/input_dep_reshape_single_copy.dir/testing_input_dep_reshape_single_copy.c.o" "gcc" "tests/collections/reshape/CMakeFiles/input_dep_reshape_single_copy.dir/testing_input_dep_reshape_single_copy.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_debug_build/parsec/CMakeFiles/parsec.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "/root/repo/_debug_build/parsec/include/fortran")
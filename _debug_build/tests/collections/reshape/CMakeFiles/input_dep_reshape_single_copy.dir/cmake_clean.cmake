@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/input_dep_reshape_single_copy.dir/common.c.o"
+  "CMakeFiles/input_dep_reshape_single_copy.dir/common.c.o.d"
+  "CMakeFiles/input_dep_reshape_single_copy.dir/input_dep_single_copy_reshape.c.o"
+  "CMakeFiles/input_dep_reshape_single_copy.dir/input_dep_single_copy_reshape.c.o.d"
+  "CMakeFiles/input_dep_reshape_single_copy.dir/testing_input_dep_reshape_single_copy.c.o"
+  "CMakeFiles/input_dep_reshape_single_copy.dir/testing_input_dep_reshape_single_copy.c.o.d"
+  "input_dep_reshape_single_copy"
+  "input_dep_reshape_single_copy.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/input_dep_reshape_single_copy.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
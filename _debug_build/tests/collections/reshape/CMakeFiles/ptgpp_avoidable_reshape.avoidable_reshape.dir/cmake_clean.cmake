@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ptgpp_avoidable_reshape.avoidable_reshape"
+  "avoidable_reshape.c"
+  "avoidable_reshape.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ptgpp_avoidable_reshape.avoidable_reshape.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ptgpp_input_dep_reshape_single_copy.input_dep_single_copy_reshape"
+  "input_dep_single_copy_reshape.c"
+  "input_dep_single_copy_reshape.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ptgpp_input_dep_reshape_single_copy.input_dep_single_copy_reshape.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,2 @@
+# CMAKE generated file: DO NOT EDIT!
+# Timestamp file for custom commands dependencies management for ptgpp_input_dep_reshape_single_copy.input_dep_single_copy_reshape.
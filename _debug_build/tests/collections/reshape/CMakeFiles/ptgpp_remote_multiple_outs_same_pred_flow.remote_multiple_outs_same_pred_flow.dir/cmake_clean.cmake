@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ptgpp_remote_multiple_outs_same_pred_flow.remote_multiple_outs_same_pred_flow"
+  "remote_multiple_outs_same_pred_flow.c"
+  "remote_multiple_outs_same_pred_flow.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ptgpp_remote_multiple_outs_same_pred_flow.remote_multiple_outs_same_pred_flow.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,2 @@
+# CMAKE generated file: DO NOT EDIT!
+# Timestamp file for custom commands dependencies management for ptgpp_remote_multiple_outs_same_pred_flow.remote_multiple_outs_same_pred_flow_multiple_deps.
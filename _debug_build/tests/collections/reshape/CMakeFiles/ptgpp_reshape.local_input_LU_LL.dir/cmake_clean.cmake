@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ptgpp_reshape.local_input_LU_LL"
+  "local_input_LU_LL.c"
+  "local_input_LU_LL.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ptgpp_reshape.local_input_LU_LL.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
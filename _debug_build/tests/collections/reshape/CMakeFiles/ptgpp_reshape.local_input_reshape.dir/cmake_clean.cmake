@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ptgpp_reshape.local_input_reshape"
+  "local_input_reshape.c"
+  "local_input_reshape.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ptgpp_reshape.local_input_reshape.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ptgpp_reshape.local_view_reshape"
+  "local_view_reshape.c"
+  "local_view_reshape.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ptgpp_reshape.local_view_reshape.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
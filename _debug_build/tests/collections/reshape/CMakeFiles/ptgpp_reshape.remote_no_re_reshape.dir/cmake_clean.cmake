@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ptgpp_reshape.remote_no_re_reshape"
+  "remote_no_re_reshape.c"
+  "remote_no_re_reshape.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ptgpp_reshape.remote_no_re_reshape.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ptgpp_reshape.remote_read_reshape"
+  "remote_read_reshape.c"
+  "remote_read_reshape.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ptgpp_reshape.remote_read_reshape.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/remote_multiple_outs_same_pred_flow.dir/common.c.o"
+  "CMakeFiles/remote_multiple_outs_same_pred_flow.dir/common.c.o.d"
+  "CMakeFiles/remote_multiple_outs_same_pred_flow.dir/remote_multiple_outs_same_pred_flow.c.o"
+  "CMakeFiles/remote_multiple_outs_same_pred_flow.dir/remote_multiple_outs_same_pred_flow.c.o.d"
+  "CMakeFiles/remote_multiple_outs_same_pred_flow.dir/remote_multiple_outs_same_pred_flow_multiple_deps.c.o"
+  "CMakeFiles/remote_multiple_outs_same_pred_flow.dir/remote_multiple_outs_same_pred_flow_multiple_deps.c.o.d"
+  "CMakeFiles/remote_multiple_outs_same_pred_flow.dir/testing_remote_multiple_outs_same_pred_flow.c.o"
+  "CMakeFiles/remote_multiple_outs_same_pred_flow.dir/testing_remote_multiple_outs_same_pred_flow.c.o.d"
+  "remote_multiple_outs_same_pred_flow"
+  "remote_multiple_outs_same_pred_flow.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/remote_multiple_outs_same_pred_flow.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
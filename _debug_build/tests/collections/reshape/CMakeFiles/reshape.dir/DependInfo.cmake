@@ -0,0 +1,29 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/collections/reshape/common.c" "tests/collections/reshape/CMakeFiles/reshape.dir/common.c.o" "gcc" "tests/collections/reshape/CMakeFiles/reshape.dir/common.c.o.d"
+  "/root/repo/_debug_build/tests/collections/reshape/local_input_LU_LL.c" "tests/collections/reshape/CMakeFiles/reshape.dir/local_input_LU_LL.c.o" "gcc" "tests/collections/reshape/CMakeFiles/reshape.dir/local_input_LU_LL.c.o.d"
+  "/root/repo/_debug_build/tests/collections/reshape/local_input_reshape.c" "tests/collections/reshape/CMakeFiles/reshape.dir/local_input_reshape.c.o" "gcc" "tests/collections/reshape/CMakeFiles/reshape.dir/local_input_reshape.c.o.d"
+  "/root/repo/_debug_build/tests/collections/reshape/local_no_reshape.c" "tests/collections/reshape/CMakeFiles/reshape.dir/local_no_reshape.c.o" "gcc" "tests/collections/reshape/CMakeFiles/reshape.dir/local_no_reshape.c.o.d"
+  "/root/repo/_debug_build/tests/collections/reshape/local_output_reshape.c" "tests/collections/reshape/CMakeFiles/reshape.dir/local_output_reshape.c.o" "gcc" "tests/collections/reshape/CMakeFiles/reshape.dir/local_output_reshape.c.o.d"
+  "/root/repo/_debug_build/tests/collections/reshape/local_read_reshape.c" "tests/collections/reshape/CMakeFiles/reshape.dir/local_read_reshape.c.o" "gcc" "tests/collections/reshape/CMakeFiles/reshape.dir/local_read_reshape.c.o.d"
+  "/root/repo/_debug_build/tests/collections/reshape/local_view_reshape.c" "tests/collections/reshape/CMakeFiles/reshape.dir/local_view_reshape.c.o" "gcc" "tests/collections/reshape/CMakeFiles/reshape.dir/local_view_reshape.c.o.d"
+  "/root/repo/_debug_build/tests/collections/reshape/remote_no_re_reshape.c" "tests/collections/reshape/CMakeFiles/reshape.dir/remote_no_re_reshape.c.o" "gcc" "tests/collections/reshape/CMakeFiles/reshape.dir/remote_no_re_reshape.c.o.d"
+  "/root/repo/_debug_build/tests/collections/reshape/remote_read_reshape.c" "tests/collections/reshape/CMakeFiles/reshape.dir/remote_read_reshape.c.o" "gcc" "tests/collections/reshape/CMakeFiles/reshape.dir/remote_read_reshape.c.o.d"
+  "/root/repo/tests/collections/reshape/testing_reshape.c" "tests/collections/reshape/CMakeFiles/reshape.dir/testing_reshape.c.o" "gcc" "tests/collections/reshape/CMakeFiles/reshape.dir/testing_reshape.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_debug_build/parsec/CMakeFiles/parsec.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "/root/repo/_debug_build/parsec/include/fortran")
@@ -0,0 +1,29 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/reshape.dir/common.c.o"
+  "CMakeFiles/reshape.dir/common.c.o.d"
+  "CMakeFiles/reshape.dir/local_input_LU_LL.c.o"
+  "CMakeFiles/reshape.dir/local_input_LU_LL.c.o.d"
+  "CMakeFiles/reshape.dir/local_input_reshape.c.o"
+  "CMakeFiles/reshape.dir/local_input_reshape.c.o.d"
+  "CMakeFiles/reshape.dir/local_no_reshape.c.o"
+  "CMakeFiles/reshape.dir/local_no_reshape.c.o.d"
+  "CMakeFiles/reshape.dir/local_output_reshape.c.o"
+  "CMakeFiles/reshape.dir/local_output_reshape.c.o.d"
+  "CMakeFiles/reshape.dir/local_read_reshape.c.o"
+  "CMakeFiles/reshape.dir/local_read_reshape.c.o.d"
+  "CMakeFiles/reshape.dir/local_view_reshape.c.o"
+  "CMakeFiles/reshape.dir/local_view_reshape.c.o.d"
+  "CMakeFiles/reshape.dir/remote_no_re_reshape.c.o"
+  "CMakeFiles/reshape.dir/remote_no_re_reshape.c.o.d"
+  "CMakeFiles/reshape.dir/remote_read_reshape.c.o"
+  "CMakeFiles/reshape.dir/remote_read_reshape.c.o.d"
+  "CMakeFiles/reshape.dir/testing_reshape.c.o"
+  "CMakeFiles/reshape.dir/testing_reshape.c.o.d"
+  "reshape"
+  "reshape.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/reshape.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,92 @@
+#ifndef _local_view_reshape_h_
+#define _local_view_reshape_h_
+#include "parsec.h"
+#include "parsec/parsec_internal.h"
+#include "parsec/remote_dep.h"
+
+BEGIN_C_DECLS
+
+#define PARSEC_local_view_reshape_DEFAULT_ADT_IDX    0
+#define PARSEC_local_view_reshape_LOWER_TILE_ADT_IDX    1
+#define PARSEC_local_view_reshape_ADT_IDX_MAX       2
+typedef struct parsec_local_view_reshape_taskpool_s {
+  parsec_taskpool_t super;
+  /* The list of globals */
+  parsec_tiled_matrix_t* _g_descA /* data descA */;
+  parsec_tiled_matrix_t* _g_descB /* data descB */;
+  /* The array of datatypes (DEFAULT,LOWER_TILE and co.) */
+  parsec_arena_datatype_t arenas_datatypes[PARSEC_local_view_reshape_ADT_IDX_MAX];
+  uint32_t arenas_datatypes_size;
+} parsec_local_view_reshape_taskpool_t;
+
+/** Beware that this object is not a superset of the internal object, and as a result
+ *  we should never create one directly. Instead we should rely on the creation of the
+ *  internal object (__parsec_local_view_reshape_taskpool_t).
+ */
+PARSEC_OBJ_CLASS_DECLARATION(parsec_local_view_reshape_taskpool_t);
+extern parsec_local_view_reshape_taskpool_t *parsec_local_view_reshape_new(parsec_tiled_matrix_t* _g_descA /* data descA */, parsec_tiled_matrix_t* _g_descB /* data descB */);
+
+#if MAX_LOCAL_COUNT < 2  /* number of parameters and locals COPY_A */
+  #error Too many parameters and local variables (2 out of MAX_LOCAL_COUNT) for task COPY_A
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_local_view_reshape_COPY_A_assignment_s {
+  parsec_assignment_t m;
+  parsec_assignment_t k;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-2];
+} __parsec_local_view_reshape_COPY_A_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 2  /* total number of flows for task COPY_A */
+  #error Too many flows (2 out of MAX_PARAM_COUNT) for task COPY_A
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_local_view_reshape_COPY_A_data_s {
+  parsec_data_pair_t _f_B;
+  parsec_data_pair_t _f_A;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-2];
+} __parsec_local_view_reshape_COPY_A_data_t;
+
+typedef struct __parsec_local_view_reshape_COPY_A_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_local_view_reshape_COPY_A_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_local_view_reshape_COPY_A_data_s data;
+} __parsec_local_view_reshape_COPY_A_task_t;
+
+
+#if MAX_LOCAL_COUNT < 2  /* number of parameters and locals READ_A */
+  #error Too many parameters and local variables (2 out of MAX_LOCAL_COUNT) for task READ_A
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_local_view_reshape_READ_A_assignment_s {
+  parsec_assignment_t m;
+  parsec_assignment_t k;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-2];
+} __parsec_local_view_reshape_READ_A_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 1  /* total number of flows for task READ_A */
+  #error Too many flows (1 out of MAX_PARAM_COUNT) for task READ_A
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_local_view_reshape_READ_A_data_s {
+  parsec_data_pair_t _f_A;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-1];
+} __parsec_local_view_reshape_READ_A_data_t;
+
+typedef struct __parsec_local_view_reshape_READ_A_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_local_view_reshape_READ_A_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_local_view_reshape_READ_A_data_s data;
+} __parsec_local_view_reshape_READ_A_task_t;
+
+
+END_C_DECLS
+
+#endif /* _local_view_reshape_h_ */ 
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ptgpp_testing_band.two_dim_band"
+  "two_dim_band.c"
+  "two_dim_band.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ptgpp_testing_band.two_dim_band.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ptgpp_testing_band.two_dim_band_free"
+  "two_dim_band_free.c"
+  "two_dim_band_free.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ptgpp_testing_band.two_dim_band_free.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/collections/two_dim_band/main.c" "tests/collections/two_dim_band/CMakeFiles/testing_band.dir/main.c.o" "gcc" "tests/collections/two_dim_band/CMakeFiles/testing_band.dir/main.c.o.d"
+  "/root/repo/_debug_build/tests/collections/two_dim_band/two_dim_band.c" "tests/collections/two_dim_band/CMakeFiles/testing_band.dir/two_dim_band.c.o" "gcc" "tests/collections/two_dim_band/CMakeFiles/testing_band.dir/two_dim_band.c.o.d"
+  "/root/repo/_debug_build/tests/collections/two_dim_band/two_dim_band_free.c" "tests/collections/two_dim_band/CMakeFiles/testing_band.dir/two_dim_band_free.c.o" "gcc" "tests/collections/two_dim_band/CMakeFiles/testing_band.dir/two_dim_band_free.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_debug_build/parsec/CMakeFiles/parsec.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "/root/repo/_debug_build/parsec/include/fortran")
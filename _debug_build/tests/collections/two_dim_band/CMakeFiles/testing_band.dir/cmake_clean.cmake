@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testing_band.dir/main.c.o"
+  "CMakeFiles/testing_band.dir/main.c.o.d"
+  "CMakeFiles/testing_band.dir/two_dim_band.c.o"
+  "CMakeFiles/testing_band.dir/two_dim_band.c.o.d"
+  "CMakeFiles/testing_band.dir/two_dim_band_free.c.o"
+  "CMakeFiles/testing_band.dir/two_dim_band_free.c.o.d"
+  "testing_band"
+  "testing_band.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/testing_band.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
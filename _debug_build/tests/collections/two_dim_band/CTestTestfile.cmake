@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/collections/two_dim_band
+# Build directory: /root/repo/_debug_build/tests/collections/two_dim_band
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
@@ -0,0 +1,5019 @@
+#include "parsec.h"
+#include "parsec/parsec_internal.h"
+#include "parsec/ayudame.h"
+#include "parsec/execution_stream.h"
+#include "parsec/parsec_binary_profile.h"
+#include "parsec/mca/device/device_gpu.h"
+#if defined(PARSEC_HAVE_DEV_CUDA_SUPPORT)
+#include "parsec/mca/device/cuda/device_cuda.h"
+#endif  /* defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) */
+#if defined(PARSEC_HAVE_DEV_HIP_SUPPORT)
+#include "parsec/mca/device/hip/device_hip.h"
+#endif  /* defined(PARSEC_HAVE_DEV_HIP_SUPPORT) */
+#if defined(_MSC_VER) || defined(__MINGW32__)
+#  include <malloc.h>
+#else
+#  include <alloca.h>
+#endif  /* defined(_MSC_VER) || defined(__MINGW32__) */
+
+#define PARSEC_two_dim_band_NB_TASK_CLASSES 6
+#define PARSEC_two_dim_band_NB_DATA 1
+
+typedef struct __parsec_two_dim_band_internal_taskpool_s __parsec_two_dim_band_internal_taskpool_t;
+struct parsec_two_dim_band_internal_taskpool_s;
+
+/** Predeclarations of the parsec_task_class_t */
+static const parsec_task_class_t two_dim_band_D_Init;
+static const parsec_task_class_t two_dim_band_D_Allocate;
+static const parsec_task_class_t two_dim_band_U_Init;
+static const parsec_task_class_t two_dim_band_U_Allocate;
+static const parsec_task_class_t two_dim_band_L_Init;
+static const parsec_task_class_t two_dim_band_L_Allocate;
+/** Predeclarations of the parameters */
+static const parsec_flow_t flow_of_two_dim_band_D_Init_for_Y;
+static const parsec_flow_t flow_of_two_dim_band_D_Init_for_ctl;
+static const parsec_flow_t flow_of_two_dim_band_D_Allocate_for_Y;
+static const parsec_flow_t flow_of_two_dim_band_D_Allocate_for_ctl;
+static const parsec_flow_t flow_of_two_dim_band_U_Init_for_Y;
+static const parsec_flow_t flow_of_two_dim_band_U_Init_for_ctl;
+static const parsec_flow_t flow_of_two_dim_band_U_Allocate_for_Y;
+static const parsec_flow_t flow_of_two_dim_band_U_Allocate_for_ctl;
+static const parsec_flow_t flow_of_two_dim_band_L_Init_for_Y;
+static const parsec_flow_t flow_of_two_dim_band_L_Init_for_ctl;
+static const parsec_flow_t flow_of_two_dim_band_L_Allocate_for_Y;
+static const parsec_flow_t flow_of_two_dim_band_L_Allocate_for_ctl;
+/*
+ * Copyright (c) 2017-2021 The University of Tennessee and The University
+ *                         of Tennessee Research Foundation. All rights
+ *                         reserved.
+ */
+#include "parsec/data_dist/matrix/matrix.h"
+#include "two_dim_band_test.h"
+
+/* Print rank for each tile */
+static int print_rank = 0;
+
+/**
+ * @brief Define kernel of tile_matrix init
+ *
+ * @param [inout] Y:  inout data
+ * @param [in] mb: row tile size
+ * @param [in] nb: column tile size
+ */
+void CORE_two_dim_band(double* Y, int mb, int nb){
+    for(int j = 0; j < nb; j++)
+        for(int i = 0; i < mb; i++)
+            Y[j*mb+i] = (i+1) * 10 + j + 1;
+}
+
+#define PARSEC_two_dim_band_DEFAULT_ADT    (&__parsec_tp->super.arenas_datatypes[PARSEC_two_dim_band_DEFAULT_ADT_IDX])
+#include "two_dim_band.h"
+
+struct __parsec_two_dim_band_internal_taskpool_s {
+ parsec_two_dim_band_taskpool_t super;
+ volatile int32_t sync_point;
+ volatile int32_t initial_number_tasks;
+ parsec_task_t* startup_queue;
+  /* The ranges to compute the hash key */
+  int D_Init_m_min;
+  int D_Init_m_range;
+  int D_Allocate_m_min;
+  int D_Allocate_m_range;
+  int U_Init_m_min;
+  int U_Init_m_range;
+  int U_Init_n_min;
+  int U_Init_n_range;
+  int U_Allocate_m_min;
+  int U_Allocate_m_range;
+  int U_Allocate_n_min;
+  int U_Allocate_n_range;
+  int L_Init_m_min;
+  int L_Init_m_range;
+  int L_Init_n_min;
+  int L_Init_n_range;
+  int L_Allocate_m_min;
+  int L_Allocate_m_range;
+  int L_Allocate_n_min;
+  int L_Allocate_n_range;
+  /* The list of data repositories  D_Init  D_Allocate  U_Init  U_Allocate  L_Init  L_Allocate */
+  data_repo_t* repositories[6];
+};
+
+#if defined(PARSEC_PROF_TRACE)
+#  if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+static int two_dim_band_profiling_array[4*PARSEC_two_dim_band_NB_TASK_CLASSES] = {-2}; /* 2 pairs (begin, end) per task, times two because each task class has an internal_init task */
+#  else /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+static int two_dim_band_profiling_array[2*PARSEC_two_dim_band_NB_TASK_CLASSES] = {-2}; /* 2 pairs (begin, end) per task */
+#  endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+#endif  /* defined(PARSEC_PROF_TRACE) */
+/* Globals */
+#define descY __parsec_tp->super._g_descY
+#define uplo (__parsec_tp->super._g_uplo)
+#define matrix_upper (__parsec_tp->super._g_matrix_upper)
+#define matrix_lower (__parsec_tp->super._g_matrix_lower)
+
+static inline int parsec_imin(int a, int b) { return (a <= b) ? a : b; };
+
+static inline int parsec_imax(int a, int b) { return (a >= b) ? a : b; };
+
+/* Data Access Macros */
+#define data_of_descY(descY_d0, descY_d1)  (((parsec_data_collection_t*)__parsec_tp->super._g_descY)->data_of((parsec_data_collection_t*)__parsec_tp->super._g_descY, (descY_d0), (descY_d1)))
+
+#define rank_of_descY(descY_d0, descY_d1)  (((parsec_data_collection_t*)__parsec_tp->super._g_descY)->rank_of((parsec_data_collection_t*)__parsec_tp->super._g_descY, (descY_d0), (descY_d1)))
+
+/* Functions Predicates */
+#define D_Init_pred(m) (((parsec_data_collection_t*)(__parsec_tp->super._g_descY))->myrank == rank_of_descY(m, m))
+#define D_Allocate_pred(m) (((parsec_data_collection_t*)(__parsec_tp->super._g_descY))->myrank == rank_of_descY(m, m))
+#define U_Init_pred(m, n) (((parsec_data_collection_t*)(__parsec_tp->super._g_descY))->myrank == rank_of_descY(m, n))
+#define U_Allocate_pred(m, n) (((parsec_data_collection_t*)(__parsec_tp->super._g_descY))->myrank == rank_of_descY(m, n))
+#define L_Init_pred(m, n) (((parsec_data_collection_t*)(__parsec_tp->super._g_descY))->myrank == rank_of_descY(m, n))
+#define L_Allocate_pred(m, n) (((parsec_data_collection_t*)(__parsec_tp->super._g_descY))->myrank == rank_of_descY(m, n))
+
+/* Data Repositories */
+#define D_Init_repo (__parsec_tp->repositories[5])
+#define D_Allocate_repo (__parsec_tp->repositories[4])
+#define U_Init_repo (__parsec_tp->repositories[3])
+#define U_Allocate_repo (__parsec_tp->repositories[2])
+#define L_Init_repo (__parsec_tp->repositories[1])
+#define L_Allocate_repo (__parsec_tp->repositories[0])
+/* Release dependencies output macro */
+#if defined(PARSEC_DEBUG_NOISIER)
+#define RELEASE_DEP_OUTPUT(ES, DEPO, TASKO, DEPI, TASKI, RSRC, RDST, DATA)\
+  do { \
+    char tmp1[128], tmp2[128]; (void)tmp1; (void)tmp2;\
+    PARSEC_DEBUG_VERBOSE(20, parsec_debug_output, "thread %d VP %d explore deps from %s:%s to %s:%s (from rank %d to %d) base ptr %p",\
+           (NULL != (ES) ? (ES)->th_id : -1), (NULL != (ES) ? (ES)->virtual_process->vp_id : -1),\
+           DEPO, parsec_task_snprintf(tmp1, 128, (parsec_task_t*)(TASKO)),\
+           DEPI, parsec_task_snprintf(tmp2, 128, (parsec_task_t*)(TASKI)), (RSRC), (RDST), (DATA));\
+  } while(0)
+#define ACQUIRE_FLOW(TASKI, DEPI, FUNO, DEPO, LOCALS, PTR)\
+  do { \
+    char tmp1[128], tmp2[128]; (void)tmp1; (void)tmp2;\
+    PARSEC_DEBUG_VERBOSE(20, parsec_debug_output, "task %s acquires flow %s from %s %s data ptr %p",\
+           parsec_task_snprintf(tmp1, 128, (parsec_task_t*)(TASKI)), (DEPI),\
+           (DEPO), parsec_snprintf_assignments(tmp2, 128, (FUNO), (parsec_assignment_t*)(LOCALS)), (PTR));\
+  } while(0)
+#else
+#define RELEASE_DEP_OUTPUT(ES, DEPO, TASKO, DEPI, TASKI, RSRC, RDST, DATA)
+#define ACQUIRE_FLOW(TASKI, DEPI, TASKO, DEPO, LOCALS, PTR)
+#endif
+static inline parsec_key_t __jdf2c_make_key_D_Init(const parsec_taskpool_t *tp, const parsec_assignment_t *as)
+{
+  const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp = (const __parsec_two_dim_band_internal_taskpool_t *)tp;
+  const __parsec_two_dim_band_D_Init_parsec_assignment_t *assignment = (const __parsec_two_dim_band_D_Init_parsec_assignment_t*)as;
+  uint64_t __parsec_id = 0;
+  __parsec_id += (assignment->m.value - __parsec_tp->D_Init_m_min);
+  return (parsec_key_t)__parsec_id;
+}
+static char *__jdf2c_key_fns_D_Init_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_two_dim_band_internal_taskpool_t *__parsec_tp = (__parsec_two_dim_band_internal_taskpool_t *)user_data;
+  int m = (__parsec_key) % __parsec_tp->D_Init_m_range + __parsec_tp->D_Init_m_min;
+  __parsec_key = __parsec_key / __parsec_tp->D_Init_m_range;
+  snprintf(buffer, buffer_size, "D_Init(%d)", m);
+  return buffer;
+}
+
+static parsec_key_fn_t __jdf2c_key_fns_D_Init = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = __jdf2c_key_fns_D_Init_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+static inline parsec_key_t __jdf2c_make_key_D_Allocate(const parsec_taskpool_t *tp, const parsec_assignment_t *as)
+{
+  const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp = (const __parsec_two_dim_band_internal_taskpool_t *)tp;
+  const __parsec_two_dim_band_D_Allocate_parsec_assignment_t *assignment = (const __parsec_two_dim_band_D_Allocate_parsec_assignment_t*)as;
+  uint64_t __parsec_id = 0;
+  __parsec_id += (assignment->m.value - __parsec_tp->D_Allocate_m_min);
+  return (parsec_key_t)__parsec_id;
+}
+static char *__jdf2c_key_fns_D_Allocate_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_two_dim_band_internal_taskpool_t *__parsec_tp = (__parsec_two_dim_band_internal_taskpool_t *)user_data;
+  int m = (__parsec_key) % __parsec_tp->D_Allocate_m_range + __parsec_tp->D_Allocate_m_min;
+  __parsec_key = __parsec_key / __parsec_tp->D_Allocate_m_range;
+  snprintf(buffer, buffer_size, "D_Allocate(%d)", m);
+  return buffer;
+}
+
+static parsec_key_fn_t __jdf2c_key_fns_D_Allocate = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = __jdf2c_key_fns_D_Allocate_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+static inline parsec_key_t __jdf2c_make_key_U_Init(const parsec_taskpool_t *tp, const parsec_assignment_t *as)
+{
+  const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp = (const __parsec_two_dim_band_internal_taskpool_t *)tp;
+  const __parsec_two_dim_band_U_Init_parsec_assignment_t *assignment = (const __parsec_two_dim_band_U_Init_parsec_assignment_t*)as;
+  uint64_t __parsec_id = 0;
+  __parsec_id += (assignment->m.value - __parsec_tp->U_Init_m_min);
+  __parsec_id += (assignment->n.value - __parsec_tp->U_Init_n_min) * __parsec_tp->U_Init_m_range;
+  return (parsec_key_t)__parsec_id;
+}
+static char *__jdf2c_key_fns_U_Init_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_two_dim_band_internal_taskpool_t *__parsec_tp = (__parsec_two_dim_band_internal_taskpool_t *)user_data;
+  int m = (__parsec_key) % __parsec_tp->U_Init_m_range + __parsec_tp->U_Init_m_min;
+  __parsec_key = __parsec_key / __parsec_tp->U_Init_m_range;
+  int n = (__parsec_key) % __parsec_tp->U_Init_n_range + __parsec_tp->U_Init_n_min;
+  __parsec_key = __parsec_key / __parsec_tp->U_Init_n_range;
+  snprintf(buffer, buffer_size, "U_Init(%d, %d)", m, n);
+  return buffer;
+}
+
+static parsec_key_fn_t __jdf2c_key_fns_U_Init = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = __jdf2c_key_fns_U_Init_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+static inline parsec_key_t __jdf2c_make_key_U_Allocate(const parsec_taskpool_t *tp, const parsec_assignment_t *as)
+{
+  const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp = (const __parsec_two_dim_band_internal_taskpool_t *)tp;
+  const __parsec_two_dim_band_U_Allocate_parsec_assignment_t *assignment = (const __parsec_two_dim_band_U_Allocate_parsec_assignment_t*)as;
+  uint64_t __parsec_id = 0;
+  __parsec_id += (assignment->m.value - __parsec_tp->U_Allocate_m_min);
+  __parsec_id += (assignment->n.value - __parsec_tp->U_Allocate_n_min) * __parsec_tp->U_Allocate_m_range;
+  return (parsec_key_t)__parsec_id;
+}
+static char *__jdf2c_key_fns_U_Allocate_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_two_dim_band_internal_taskpool_t *__parsec_tp = (__parsec_two_dim_band_internal_taskpool_t *)user_data;
+  int m = (__parsec_key) % __parsec_tp->U_Allocate_m_range + __parsec_tp->U_Allocate_m_min;
+  __parsec_key = __parsec_key / __parsec_tp->U_Allocate_m_range;
+  int n = (__parsec_key) % __parsec_tp->U_Allocate_n_range + __parsec_tp->U_Allocate_n_min;
+  __parsec_key = __parsec_key / __parsec_tp->U_Allocate_n_range;
+  snprintf(buffer, buffer_size, "U_Allocate(%d, %d)", m, n);
+  return buffer;
+}
+
+static parsec_key_fn_t __jdf2c_key_fns_U_Allocate = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = __jdf2c_key_fns_U_Allocate_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+static inline parsec_key_t __jdf2c_make_key_L_Init(const parsec_taskpool_t *tp, const parsec_assignment_t *as)
+{
+  const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp = (const __parsec_two_dim_band_internal_taskpool_t *)tp;
+  const __parsec_two_dim_band_L_Init_parsec_assignment_t *assignment = (const __parsec_two_dim_band_L_Init_parsec_assignment_t*)as;
+  uint64_t __parsec_id = 0;
+  __parsec_id += (assignment->m.value - __parsec_tp->L_Init_m_min);
+  __parsec_id += (assignment->n.value - __parsec_tp->L_Init_n_min) * __parsec_tp->L_Init_m_range;
+  return (parsec_key_t)__parsec_id;
+}
+static char *__jdf2c_key_fns_L_Init_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_two_dim_band_internal_taskpool_t *__parsec_tp = (__parsec_two_dim_band_internal_taskpool_t *)user_data;
+  int m = (__parsec_key) % __parsec_tp->L_Init_m_range + __parsec_tp->L_Init_m_min;
+  __parsec_key = __parsec_key / __parsec_tp->L_Init_m_range;
+  int n = (__parsec_key) % __parsec_tp->L_Init_n_range + __parsec_tp->L_Init_n_min;
+  __parsec_key = __parsec_key / __parsec_tp->L_Init_n_range;
+  snprintf(buffer, buffer_size, "L_Init(%d, %d)", m, n);
+  return buffer;
+}
+
+static parsec_key_fn_t __jdf2c_key_fns_L_Init = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = __jdf2c_key_fns_L_Init_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+static inline parsec_key_t __jdf2c_make_key_L_Allocate(const parsec_taskpool_t *tp, const parsec_assignment_t *as)
+{
+  const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp = (const __parsec_two_dim_band_internal_taskpool_t *)tp;
+  const __parsec_two_dim_band_L_Allocate_parsec_assignment_t *assignment = (const __parsec_two_dim_band_L_Allocate_parsec_assignment_t*)as;
+  uint64_t __parsec_id = 0;
+  __parsec_id += (assignment->m.value - __parsec_tp->L_Allocate_m_min);
+  __parsec_id += (assignment->n.value - __parsec_tp->L_Allocate_n_min) * __parsec_tp->L_Allocate_m_range;
+  return (parsec_key_t)__parsec_id;
+}
+static char *__jdf2c_key_fns_L_Allocate_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_two_dim_band_internal_taskpool_t *__parsec_tp = (__parsec_two_dim_band_internal_taskpool_t *)user_data;
+  int m = (__parsec_key) % __parsec_tp->L_Allocate_m_range + __parsec_tp->L_Allocate_m_min;
+  __parsec_key = __parsec_key / __parsec_tp->L_Allocate_m_range;
+  int n = (__parsec_key) % __parsec_tp->L_Allocate_n_range + __parsec_tp->L_Allocate_n_min;
+  __parsec_key = __parsec_key / __parsec_tp->L_Allocate_n_range;
+  snprintf(buffer, buffer_size, "L_Allocate(%d, %d)", m, n);
+  return buffer;
+}
+
+static parsec_key_fn_t __jdf2c_key_fns_L_Allocate = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = __jdf2c_key_fns_L_Allocate_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/******                                    D_Init                                    ******/
+
+static inline int32_t minexpr_of_symb_two_dim_band_D_Init_m_fct(const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp, const __parsec_two_dim_band_D_Init_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_two_dim_band_D_Init_m = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_two_dim_band_D_Init_m_fct }
+                   }
+};
+static inline int maxexpr_of_symb_two_dim_band_D_Init_m_fct(const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp, const __parsec_two_dim_band_D_Init_parsec_assignment_t *locals)
+{
+  const int m = locals->m.value; (void)m;
+
+  (void)m;
+  (void)__parsec_tp; (void)locals;
+  return (descY->lmt - 1);
+}
+static const parsec_expr_t maxexpr_of_symb_two_dim_band_D_Init_m = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_two_dim_band_D_Init_m_fct }
+                   }
+};
+static const parsec_symbol_t symb_two_dim_band_D_Init_m = { .name = "m", .context_index = 0, .min = &minexpr_of_symb_two_dim_band_D_Init_m, .max = &maxexpr_of_symb_two_dim_band_D_Init_m, .cst_inc = 1, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int affinity_of_two_dim_band_D_Init(const __parsec_two_dim_band_D_Init_task_t *this_task,
+                     parsec_data_ref_t *ref)
+{
+    const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp = (const __parsec_two_dim_band_internal_taskpool_t*)this_task->taskpool;
+  const int m = this_task->locals.m.value; (void)m;
+
+  /* Silent Warnings: should look into predicate to know what variables are usefull */
+  (void)m;
+  ref->dc = (parsec_data_collection_t *)__parsec_tp->super._g_descY;
+  /* Compute data key */
+  ref->key = ref->dc->data_key(ref->dc, m, m);
+  return 1;
+}
+static const parsec_property_t properties_of_two_dim_band_D_Init[1] = {
+  {.name = NULL, .expr = NULL}
+};
+static parsec_data_t *flow_of_two_dim_band_D_Init_for_Y_dep1_atline_178_direct_access(const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp, const __parsec_two_dim_band_D_Init_parsec_assignment_t *assignments)
+{
+  const int m = assignments->m.value; (void)m;
+
+  /* Silence Warnings: should look into parameters to know what variables are useful */
+  (void)m;
+  if( __parsec_tp->super.super.context->my_rank == (int32_t)rank_of_descY(m, m) )
+    return data_of_descY(m, m);
+  return NULL;
+}
+
+static const parsec_dep_t flow_of_two_dim_band_D_Init_for_Y_dep1_atline_178 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = PARSEC_LOCAL_DATA_TASK_CLASS_ID, /* two_dim_band_descY */
+  .direct_data = (parsec_data_lookup_func_t)&flow_of_two_dim_band_D_Init_for_Y_dep1_atline_178_direct_access,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_two_dim_band_D_Init_for_Y,
+};
+static parsec_data_t *flow_of_two_dim_band_D_Init_for_Y_dep2_atline_179_direct_access(const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp, const __parsec_two_dim_band_D_Init_parsec_assignment_t *assignments)
+{
+  const int m = assignments->m.value; (void)m;
+
+  /* Silence Warnings: should look into parameters to know what variables are useful */
+  (void)m;
+  if( __parsec_tp->super.super.context->my_rank == (int32_t)rank_of_descY(m, m) )
+    return data_of_descY(m, m);
+  return NULL;
+}
+
+static const parsec_dep_t flow_of_two_dim_band_D_Init_for_Y_dep2_atline_179 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = PARSEC_LOCAL_DATA_TASK_CLASS_ID, /* two_dim_band_descY */
+  .direct_data = (parsec_data_lookup_func_t)&flow_of_two_dim_band_D_Init_for_Y_dep2_atline_179_direct_access,
+  .flags = PARSEC_DEP_FINAL_WRITE_AS_IS,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_two_dim_band_D_Init_for_Y,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+#if MAX_DEP_OUT_COUNT < 1  /* number of output dependencies */
+    #error Too many output dependencies (supports up to MAX_DEP_OUT_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_OUT_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_two_dim_band_D_Init_for_Y = {
+  .name               = "Y",
+  .sym_type           = PARSEC_SYM_INOUT,
+  .flow_flags         = PARSEC_FLOW_ACCESS_RW|PARSEC_FLOW_HAS_IN_DEPS,
+  .flow_index         = 0,
+  .flow_datatype_mask = 0x1,
+  .dep_in     = { &flow_of_two_dim_band_D_Init_for_Y_dep1_atline_178 },
+  .dep_out    = { &flow_of_two_dim_band_D_Init_for_Y_dep2_atline_179 }
+};
+
+static const parsec_dep_t flow_of_two_dim_band_D_Init_for_ctl_dep1_atline_181 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 4, /* two_dim_band_D_Allocate */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_two_dim_band_D_Allocate_for_ctl,
+  .dep_index = 1,
+  .dep_datatype_index = 1,
+  .belongs_to = &flow_of_two_dim_band_D_Init_for_ctl,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_two_dim_band_D_Init_for_ctl = {
+  .name               = "ctl",
+  .sym_type           = PARSEC_SYM_IN,
+  .flow_flags         = PARSEC_FLOW_ACCESS_NONE,
+  .flow_index         = 1,
+  .flow_datatype_mask = 0x0,
+  .dep_in     = { &flow_of_two_dim_band_D_Init_for_ctl_dep1_atline_181 },
+  .dep_out    = { NULL }
+};
+
+static void
+iterate_predecessors_of_two_dim_band_D_Init(parsec_execution_stream_t *es, const __parsec_two_dim_band_D_Init_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp = (const __parsec_two_dim_band_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_two_dim_band_D_Init_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_two_dim_band_D_Init_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int m = __jdf2c__tmp_locals.m.value; (void)m;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)m;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_descY(m, m);
+#endif
+  /* Flow of data Y has only OUTPUT dependencies to Memory */
+  if( action_mask & 0x2 ) {  /* Flow of data ctl [1] */
+    data.data   = this_task->data._f_ctl.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x2 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  =   /* Control: always empty */ 0;
+    data.local.dst_count  =   /* Control: always empty */ 0;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = NULL;
+    data.remote.src_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.src_count  =   /* Control: always empty */ 0;
+    data.remote.dst_count  =   /* Control: always empty */ 0;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        __parsec_two_dim_band_D_Allocate_task_t* ncc = (__parsec_two_dim_band_D_Allocate_task_t*)&nc;
+    nc.task_class = __parsec_tp->super.super.task_classes_array[two_dim_band_D_Allocate.task_class_id];
+      const int D_Allocate_m = m;
+      if( (D_Allocate_m >= (0)) && (D_Allocate_m <= ((descY->lmt - 1))) ) {
+        assert(&nc.locals[0].value == &ncc->locals.m.value);
+        ncc->locals.m.value = D_Allocate_m;
+#if defined(DISTRIBUTED)
+        rank_dst = rank_of_descY(ncc->locals.m.value, ncc->locals.m.value);
+        if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+          vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descY)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descY, ncc->locals.m.value, ncc->locals.m.value);
+        nc.priority = __parsec_tp->super.super.priority;
+        successor_repo = NULL;
+        successor_repo_key = 0;
+      RELEASE_DEP_OUTPUT(es, "ctl", this_task, "ctl", &nc, rank_src, rank_dst, &data);
+      if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_two_dim_band_D_Init_for_ctl_dep1_atline_181, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+        }
+  }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static int release_deps_of_two_dim_band_D_Init(parsec_execution_stream_t *es, __parsec_two_dim_band_D_Init_task_t *this_task, uint32_t action_mask, parsec_remote_deps_t *deps)
+{
+  PARSEC_PINS(es, RELEASE_DEPS_BEGIN, (parsec_task_t *)this_task);  const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp = (const __parsec_two_dim_band_internal_taskpool_t *)this_task->taskpool;
+  parsec_release_dep_fct_arg_t arg;
+  int __vp_id;
+  int consume_local_repo = 0;
+  arg.action_mask = action_mask;
+  arg.output_entry = NULL;
+  arg.output_repo = NULL;
+#if defined(DISTRIBUTED)
+  arg.remote_deps = deps;
+#endif  /* defined(DISTRIBUTED) */
+  assert(NULL != es);
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS )    arg.ready_lists = alloca(sizeof(parsec_task_t *) * es->virtual_process->parsec_context->nb_vp);
+  else
+    arg.ready_lists = NULL;
+  for( __vp_id = 0; __vp_id < es->virtual_process->parsec_context->nb_vp; arg.ready_lists[__vp_id++] = NULL );
+  (void)__parsec_tp; (void)deps;
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_Y.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_Y.source_repo, this_task->data._f_Y.source_repo_entry->ht_item.key );
+    }
+  }
+  consume_local_repo = (this_task->repo_entry != NULL);
+  /* No successors, don't call iterate_successors and don't release any local deps */
+      if (consume_local_repo) {
+         data_repo_entry_used_once( D_Init_repo, this_task->repo_entry->ht_item.key );
+      }
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_Y.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_Y.data_in);
+    }
+  }
+  PARSEC_PINS(es, RELEASE_DEPS_END, (parsec_task_t *)this_task);  return 0;
+}
+
+static int data_lookup_of_two_dim_band_D_Init(parsec_execution_stream_t *es, __parsec_two_dim_band_D_Init_task_t *this_task)
+{
+  const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp = (__parsec_two_dim_band_internal_taskpool_t *)this_task->taskpool;
+  parsec_assignment_t generic_locals[MAX_PARAM_COUNT];  /* generic task locals */
+  int target_device = 0; (void)target_device;
+  (void)__parsec_tp; (void)generic_locals; (void)es;
+  parsec_data_copy_t *chunk = NULL;
+  data_repo_t        *reshape_repo  = NULL, *consumed_repo  = NULL;
+  data_repo_entry_t  *reshape_entry = NULL, *consumed_entry = NULL;
+  parsec_key_t        reshape_entry_key = 0, consumed_entry_key = 0;
+  uint8_t             consumed_flow_index;
+  parsec_dep_data_description_t data;
+  int ret;
+  (void)reshape_repo; (void)reshape_entry; (void)reshape_entry_key;
+  (void)consumed_repo; (void)consumed_entry; (void)consumed_entry_key;
+  (void)consumed_flow_index;
+  (void)chunk; (void)data; (void)ret;
+  const int m = this_task->locals.m.value; (void)m;
+  if( NULL == this_task->repo_entry ){
+    this_task->repo_entry = data_repo_lookup_entry_and_create(es, D_Init_repo,                                       __jdf2c_make_key_D_Init((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    data_repo_entry_addto_usage_limit(D_Init_repo, this_task->repo_entry->ht_item.key, 1);    this_task->repo_entry ->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(this_task->repo_entry ->sim_exec_date == 0);
+    this_task->repo_entry ->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  /* The reshape repo is the current task repo. */  reshape_repo = D_Init_repo;
+  reshape_entry_key = __jdf2c_make_key_D_Init((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals) ;
+  reshape_entry = this_task->repo_entry;
+  /* Lookup the input data, and store them in the context if any */
+
+if(! this_task->data._f_Y.fulfill ){ /* Flow Y */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_Y.data_out = NULL;  /* By default, if nothing matches */
+  /* Flow Y [0] dependency [0] from memory descY */
+  if( NULL == (chunk = this_task->data._f_Y.data_in) ) {
+  /* No data set up by predecessor on this task input flow */
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+  parsec_prof_grapher_data_input(data_of_descY(m, m), (parsec_task_t*)this_task, &flow_of_two_dim_band_D_Init_for_Y, 1);
+#endif
+    chunk = parsec_data_get_copy(data_of_descY(m, m), target_device);
+    data.data = chunk;
+    data.data_future  = NULL;
+        data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.data_future   = NULL;
+    if( (ret = parsec_get_copy_reshape_from_desc(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    this_task->data._f_Y.data_out = chunk;
+    PARSEC_OBJ_RETAIN(chunk);
+  } 
+    this_task->data._f_Y.data_in     = chunk;
+    this_task->data._f_Y.source_repo       = consumed_repo;
+    this_task->data._f_Y.source_repo_entry = consumed_entry;
+    this_task->data._f_Y.fulfill = 1;
+}
+
+  /* ctl is a control flow */
+  this_task->data._f_ctl.data_in         = NULL;
+  this_task->data._f_ctl.data_out        = NULL;
+  this_task->data._f_ctl.source_repo       = NULL;
+  this_task->data._f_ctl.source_repo_entry = NULL;
+  /** Generate profiling information */
+#if defined(PARSEC_PROF_TRACE)
+  this_task->prof_info.desc = (parsec_data_collection_t*)__parsec_tp->super._g_descY;
+  this_task->prof_info.priority = this_task->priority;
+  this_task->prof_info.data_id   = ((parsec_data_collection_t*)__parsec_tp->super._g_descY)->data_key((parsec_data_collection_t*)__parsec_tp->super._g_descY, m, m);
+  this_task->prof_info.task_class_id = this_task->task_class->task_class_id;
+  this_task->prof_info.task_return_code = -1;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int datatype_lookup_of_two_dim_band_D_Init(parsec_execution_stream_t *es, const parsec_task_t *this_generic_task, const parsec_task_t *parent_task,
+              uint32_t* flow_mask, parsec_dep_data_description_t* data)
+{
+  const __parsec_two_dim_band_D_Init_task_t *this_task = (__parsec_two_dim_band_D_Init_task_t*)this_generic_task;
+  const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp = (__parsec_two_dim_band_internal_taskpool_t *)this_task->taskpool;
+  (void)__parsec_tp; (void)es; (void)this_task; (void)data; (void)parent_task;
+  const int m = this_task->locals.m.value; (void)m;
+  data->local.arena = data->remote.arena = NULL;
+  data->local.src_datatype  = data->local.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->local.src_count     = data->local.dst_count = 0;
+  data->local.src_displ     = data->local.dst_displ = 0;
+  data->data_future  = NULL;
+  if( (*flow_mask) & 0x80000000U ) { /* these are the input dependencies remote datatypes  */
+if( (*flow_mask) & 0x1U ) {  /* Flow Y */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_two_dim_band_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_two_dim_band_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_two_dim_band_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+    goto no_mask_match;
+  }
+
+  /* these are the output dependencies remote datatypes */
+if( (*flow_mask) & 0x1U ) {  /* Flow Y */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_two_dim_band_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_two_dim_band_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_two_dim_band_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+ no_mask_match:
+  data->data                             = NULL;
+  data->remote.src_datatype = data->remote.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->remote.src_count    = data->remote.dst_count = 0;
+  data->remote.src_displ    = data->remote.dst_displ = 0;
+  data->data_future  = NULL;
+  (*flow_mask) = 0;  /* nothing left */
+  (void)m;
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+static int hook_of_two_dim_band_D_Init(parsec_execution_stream_t *es, __parsec_two_dim_band_D_Init_task_t *this_task)
+{
+  __parsec_two_dim_band_internal_taskpool_t *__parsec_tp = (__parsec_two_dim_band_internal_taskpool_t *)this_task->taskpool;
+  (void)es; (void)__parsec_tp;
+  const int m = this_task->locals.m.value; (void)m;
+  (void)m;
+
+  /** Declare the variables that will hold the data, and all the accounting for each */
+  parsec_data_copy_t *_f_Y = this_task->data._f_Y.data_in;
+  void *Y = PARSEC_DATA_COPY_GET_PTR(_f_Y); (void)Y;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    data_repo_entry_t *eY = this_task->data._f_Y.source_repo_entry;
+    if( (NULL != eY) && (eY->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eY->sim_exec_date;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+    if ( NULL != _f_Y ) {
+#if defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) || defined(PARSEC_HAVE_DEV_HIP_SUPPORT)
+      parsec_data_transfer_ownership_to_copy( _f_Y->original, 0 /* device */,
+                                           PARSEC_FLOW_ACCESS_RW);
+#endif  /* defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) || defined(PARSEC_HAVE_DEV_HIP_SUPPORT) */
+      _f_Y->version++;  /* Y */
+#if defined(PARSEC_DEBUG_NOISIER)
+      char tmp[128];
+      PARSEC_DEBUG_VERBOSE(10, parsec_debug_output,
+                           "Body of %s: change Data copy %p to version %d",
+                           parsec_task_snprintf(tmp, 128, (parsec_task_t*)(this_task)),
+                           _f_Y, _f_Y->version);
+#endif /* defined(PARSEC_DEBUG_NOISIER) */
+    }
+  /** Cache Awareness Accounting */
+#if defined(PARSEC_CACHE_AWARENESS)
+  cache_buf_referenced(es->closest_cache, Y);
+#endif /* PARSEC_CACHE_AWARENESS */
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                                  D_Init BODY                                  -----*/
+
+{
+    CORE_two_dim_band(Y, descY->mb, descY->nb);
+    if( print_rank ) printf("rank_D %d %d : %d %d\n", m, m, descY->super.myrank, descY->super.rank_of(&descY->super, m, m ));
+}
+
+/*-----                              END OF D_Init BODY                              -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#endif  /*  defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+static int complete_hook_of_two_dim_band_D_Init(parsec_execution_stream_t *es, __parsec_two_dim_band_D_Init_task_t *this_task)
+{
+  const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp = (__parsec_two_dim_band_internal_taskpool_t *)this_task->taskpool;
+#if defined(DISTRIBUTED)
+    const int m = this_task->locals.m.value; (void)m;
+#endif  /* defined(DISTRIBUTED) */
+  (void)es; (void)__parsec_tp;
+parsec_data_t* data_t_desc = NULL; (void)data_t_desc;
+#if defined(DISTRIBUTED)
+  /** If not working on distributed, there is no risk that data is not in place */
+  data_t_desc = data_of_descY(m, m);
+  if( (NULL != this_task->data._f_Y.data_out) && (this_task->data._f_Y.data_out->original != data_t_desc) ) {
+    /* Writting back using remote_type */;
+    parsec_dep_data_description_t data;
+    data.data         = this_task->data._f_Y.data_out;
+    data.local.arena        = NULL;
+    data.local.src_datatype = data.data->dtt;
+    data.local.src_count    = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_datatype = parsec_data_get_copy(data_t_desc, 0)->dtt;
+    data.local.dst_count    = 1;
+    data.local.dst_displ    = 0;
+    data.data_future  = NULL;
+    assert( data.local.src_count > 0 );
+    parsec_remote_dep_memcpy(es,
+                            this_task->taskpool,
+                            parsec_data_get_copy(data_of_descY(m, m), 0),
+                            this_task->data._f_Y.data_out, &data);
+  }
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+  parsec_prof_grapher_data_output((parsec_task_t*)this_task, data_of_descY(m, m), &flow_of_two_dim_band_D_Init_for_Y);
+#endif
+  (void)m;
+
+#endif /* DISTRIBUTED */
+#if defined(PARSEC_PROF_GRAPHER)
+  parsec_prof_grapher_task((parsec_task_t*)this_task, es->th_id, es->virtual_process->vp_id,
+     __jdf2c_key_fns_D_Init.key_hash(this_task->task_class->make_key( (parsec_taskpool_t*)this_task->taskpool, ((parsec_task_t*)this_task)->locals), NULL));
+#endif  /* defined(PARSEC_PROF_GRAPHER) */
+  release_deps_of_two_dim_band_D_Init(es, this_task,
+      PARSEC_ACTION_RELEASE_REMOTE_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_REFS |
+      PARSEC_ACTION_RESHAPE_ON_RELEASE |
+      0x1,  /* mask of all dep_index */ 
+      NULL);
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static parsec_hook_return_t release_task_of_two_dim_band_D_Init(parsec_execution_stream_t *es, parsec_task_t *this_task)
+{
+    const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp =
+        (const __parsec_two_dim_band_internal_taskpool_t *)this_task->taskpool;
+    parsec_hash_table_t *ht = (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[5];
+    parsec_key_t key = this_task->task_class->make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals);
+    parsec_hashable_dependency_t *hash_dep = (parsec_hashable_dependency_t *)parsec_hash_table_remove(ht, key);
+    parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);
+    return parsec_release_task_to_mempool_update_nbtasks(es, this_task);
+}
+
+static char *two_dim_band_two_dim_band_D_Init_internal_init_deps_key_functions_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_two_dim_band_internal_taskpool_t *__parsec_tp = (__parsec_two_dim_band_internal_taskpool_t *)user_data;
+  int m = (__parsec_key) % __parsec_tp->D_Init_m_range + __parsec_tp->D_Init_m_min;
+  __parsec_key = __parsec_key / __parsec_tp->D_Init_m_range;
+  snprintf(buffer, buffer_size, "D_Init(%d)", m);
+  return buffer;
+}
+
+static parsec_key_fn_t two_dim_band_two_dim_band_D_Init_internal_init_deps_key_functions = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = two_dim_band_two_dim_band_D_Init_internal_init_deps_key_functions_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/* Needs: min-max count-tasks iterate */
+static int two_dim_band_D_Init_internal_init(parsec_execution_stream_t * es, __parsec_two_dim_band_D_Init_task_t * this_task)
+{
+  __parsec_two_dim_band_internal_taskpool_t *__parsec_tp = (__parsec_two_dim_band_internal_taskpool_t*)this_task->taskpool;
+  int32_t nb_tasks = 0, saved_nb_tasks = 0;
+int32_t __m_min = 0x7fffffff, __m_max = 0;int32_t __jdf2c_m_min = 0x7fffffff, __jdf2c_m_max = 0;  __parsec_two_dim_band_D_Init_parsec_assignment_t assignments = {  .m.value = 0 };
+  int32_t  m;
+  int32_t __jdf2c_m_start, __jdf2c_m_end, __jdf2c_m_inc;
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+  PARSEC_PROFILING_TRACE(es->es_profile,
+                         this_task->taskpool->profiling_array[START_KEY(this_task->task_class->task_class_id)],
+                         0,
+                         this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    __jdf2c_m_start = 0;
+    __jdf2c_m_end = (descY->lmt - 1);
+    __jdf2c_m_inc = 1;
+    __m_min = parsec_imin(__jdf2c_m_start, __jdf2c_m_end);
+    __m_max = parsec_imax(__jdf2c_m_start, __jdf2c_m_end);
+    __jdf2c_m_min = parsec_imin(__jdf2c_m_min, __m_min);
+    __jdf2c_m_max = parsec_imax(__jdf2c_m_max, __m_max);
+    for(m =  __jdf2c_m_start;
+        m <= __jdf2c_m_end;
+        m += __jdf2c_m_inc) {
+    assignments.m.value = m;
+    if( !D_Init_pred(m) ) continue;
+    nb_tasks++;
+  } /* Loop on normal range m */
+   if( 0 != nb_tasks ) {
+     (void)parsec_atomic_fetch_add_int32(&__parsec_tp->initial_number_tasks, nb_tasks);
+   }
+  /* Set the range variables for the collision-free hash-computation */
+  __parsec_tp->D_Init_m_min   = __jdf2c_m_min;
+  __parsec_tp->D_Init_m_range = (__jdf2c_m_max - __jdf2c_m_min) + 1;
+  this_task->status = PARSEC_TASK_STATUS_COMPLETE;
+
+  PARSEC_AYU_REGISTER_TASK(&two_dim_band_D_Init);
+  __parsec_tp->super.super.dependencies_array[5] = PARSEC_OBJ_NEW(parsec_hash_table_t);
+  parsec_hash_table_init(__parsec_tp->super.super.dependencies_array[5], offsetof(parsec_hashable_dependency_t, ht_item), 10, two_dim_band_two_dim_band_D_Init_internal_init_deps_key_functions, this_task->taskpool);
+  __parsec_tp->repositories[5] = data_repo_create_nothreadsafe(nb_tasks, __jdf2c_key_fns_D_Init, (parsec_taskpool_t*)__parsec_tp, 2);
+(void)saved_nb_tasks;
+(void)__m_min; (void)__m_max;  (void)__jdf2c_m_start; (void)__jdf2c_m_end; (void)__jdf2c_m_inc;  (void)assignments; (void)__parsec_tp; (void)es;
+  if(1 == parsec_atomic_fetch_dec_int32(&__parsec_tp->sync_point)) {
+    /* Last initialization task complete. Update the number of tasks. */
+    __parsec_tp->super.super.tdm.module->taskpool_addto_nb_tasks(&__parsec_tp->super.super, __parsec_tp->initial_number_tasks);
+    parsec_mfence();  /* write memory barrier to guarantee that the scheduler gets the correct number of tasks */
+    parsec_taskpool_enable((parsec_taskpool_t*)__parsec_tp, &__parsec_tp->startup_queue,
+                           (parsec_task_t*)this_task, es, __parsec_tp->super.super.nb_pending_actions);
+    __parsec_tp->super.super.tdm.module->taskpool_ready(&__parsec_tp->super.super);
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+    PARSEC_PROFILING_TRACE(es->es_profile,
+                           this_task->taskpool->profiling_array[2 * this_task->task_class->task_class_id + 1],
+                           0,
+                           this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    return PARSEC_HOOK_RETURN_DONE;
+  }
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static const __parsec_chore_t __two_dim_band_D_Init_chores[] ={
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+    { .type     = PARSEC_DEV_CPU,
+      .evaluate = (parsec_evaluate_function_t*)NULL,
+      .hook     = (parsec_hook_t*)hook_of_two_dim_band_D_Init },
+#endif  /* defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+    { .type     = PARSEC_DEV_NONE,
+      .evaluate = NULL,
+      .hook     = (parsec_hook_t*)NULL },  /* End marker */
+};
+
+static const parsec_task_class_t two_dim_band_D_Init = {
+  .name = "D_Init",
+  .task_class_id = 5,
+  .nb_flows = 2,
+  .nb_parameters = 1,
+  .nb_locals = 1,
+  .task_class_type = PARSEC_TASK_CLASS_TYPE_PTG,
+  .params = { &symb_two_dim_band_D_Init_m, NULL },
+  .locals = { &symb_two_dim_band_D_Init_m, NULL },
+  .data_affinity = (parsec_data_ref_fn_t*)affinity_of_two_dim_band_D_Init,
+  .initial_data = (parsec_data_ref_fn_t*)affinity_of_two_dim_band_D_Init,
+  .final_data = (parsec_data_ref_fn_t*)affinity_of_two_dim_band_D_Init,
+  .priority = NULL,
+  .properties = properties_of_two_dim_band_D_Init,
+#if MAX_PARAM_COUNT < 1  /* number of read flows of D_Init */
+  #error Too many read flows for task D_Init
+#endif  /* MAX_PARAM_COUNT */
+#if MAX_PARAM_COUNT < 1  /* number of write flows of D_Init */
+  #error Too many write flows for task D_Init
+#endif  /* MAX_PARAM_COUNT */
+  .in = { &flow_of_two_dim_band_D_Init_for_Y, &flow_of_two_dim_band_D_Init_for_ctl, NULL },
+  .out = { &flow_of_two_dim_band_D_Init_for_Y, NULL },
+  .flags = 0x0 | PARSEC_HAS_IN_IN_DEPENDENCIES | PARSEC_USE_DEPS_MASK,
+  .dependencies_goal = 0x3,
+  .make_key = __jdf2c_make_key_D_Init,
+  .task_snprintf = parsec_task_snprintf,
+#if defined(PARSEC_PROF_TRACE)
+  .profile_info = &parsec_task_profile_info,
+#endif
+  .key_functions = &__jdf2c_key_fns_D_Init,
+  .fini = (parsec_hook_t*)NULL,
+  .incarnations = __two_dim_band_D_Init_chores,
+  .find_deps = parsec_hash_find_deps,
+  .update_deps = parsec_update_deps_with_mask,
+  .iterate_successors = (parsec_traverse_function_t*)NULL,
+  .iterate_predecessors = (parsec_traverse_function_t*)iterate_predecessors_of_two_dim_band_D_Init,
+  .release_deps = (parsec_release_deps_t*)release_deps_of_two_dim_band_D_Init,
+  .prepare_output = (parsec_hook_t*)NULL,
+  .prepare_input = (parsec_hook_t*)data_lookup_of_two_dim_band_D_Init,
+  .time_estimate = NULL,
+  .get_datatype = datatype_lookup_of_two_dim_band_D_Init,
+  .complete_execution = (parsec_hook_t*)complete_hook_of_two_dim_band_D_Init,
+  .release_task = &release_task_of_two_dim_band_D_Init,
+#if defined(PARSEC_SIM)
+  .sim_cost_fct = (parsec_sim_cost_fct_t*)NULL,
+#endif
+};
+
+
+/******                                  D_Allocate                                  ******/
+
+static inline int32_t minexpr_of_symb_two_dim_band_D_Allocate_m_fct(const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp, const __parsec_two_dim_band_D_Allocate_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_two_dim_band_D_Allocate_m = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_two_dim_band_D_Allocate_m_fct }
+                   }
+};
+static inline int maxexpr_of_symb_two_dim_band_D_Allocate_m_fct(const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp, const __parsec_two_dim_band_D_Allocate_parsec_assignment_t *locals)
+{
+  const int m = locals->m.value; (void)m;
+
+  (void)m;
+  (void)__parsec_tp; (void)locals;
+  return (descY->lmt - 1);
+}
+static const parsec_expr_t maxexpr_of_symb_two_dim_band_D_Allocate_m = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_two_dim_band_D_Allocate_m_fct }
+                   }
+};
+static const parsec_symbol_t symb_two_dim_band_D_Allocate_m = { .name = "m", .context_index = 0, .min = &minexpr_of_symb_two_dim_band_D_Allocate_m, .max = &maxexpr_of_symb_two_dim_band_D_Allocate_m, .cst_inc = 1, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int affinity_of_two_dim_band_D_Allocate(const __parsec_two_dim_band_D_Allocate_task_t *this_task,
+                     parsec_data_ref_t *ref)
+{
+    const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp = (const __parsec_two_dim_band_internal_taskpool_t*)this_task->taskpool;
+  const int m = this_task->locals.m.value; (void)m;
+
+  /* Silent Warnings: should look into predicate to know what variables are usefull */
+  (void)m;
+  ref->dc = (parsec_data_collection_t *)__parsec_tp->super._g_descY;
+  /* Compute data key */
+  ref->key = ref->dc->data_key(ref->dc, m, m);
+  return 1;
+}
+static const parsec_property_t properties_of_two_dim_band_D_Allocate[1] = {
+  {.name = NULL, .expr = NULL}
+};
+static const parsec_dep_t flow_of_two_dim_band_D_Allocate_for_Y_dep1_atline_151 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = PARSEC_LOCAL_DATA_TASK_CLASS_ID, /* two_dim_band___parsec_null_type */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_two_dim_band_D_Allocate_for_Y,
+};
+static parsec_data_t *flow_of_two_dim_band_D_Allocate_for_Y_dep2_atline_152_direct_access(const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp, const __parsec_two_dim_band_D_Allocate_parsec_assignment_t *assignments)
+{
+  const int m = assignments->m.value; (void)m;
+
+  /* Silence Warnings: should look into parameters to know what variables are useful */
+  (void)m;
+  if( __parsec_tp->super.super.context->my_rank == (int32_t)rank_of_descY(m, m) )
+    return data_of_descY(m, m);
+  return NULL;
+}
+
+static const parsec_dep_t flow_of_two_dim_band_D_Allocate_for_Y_dep2_atline_152 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = PARSEC_LOCAL_DATA_TASK_CLASS_ID, /* two_dim_band_descY */
+  .direct_data = (parsec_data_lookup_func_t)&flow_of_two_dim_band_D_Allocate_for_Y_dep2_atline_152_direct_access,
+  .flags = PARSEC_DEP_FINAL_WRITE_AS_IS,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_two_dim_band_D_Allocate_for_Y,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+#if MAX_DEP_OUT_COUNT < 1  /* number of output dependencies */
+    #error Too many output dependencies (supports up to MAX_DEP_OUT_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_OUT_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_two_dim_band_D_Allocate_for_Y = {
+  .name               = "Y",
+  .sym_type           = PARSEC_SYM_INOUT,
+  .flow_flags         = PARSEC_FLOW_ACCESS_RW|PARSEC_FLOW_HAS_IN_DEPS,
+  .flow_index         = 0,
+  .flow_datatype_mask = 0x1,
+  .dep_in     = { &flow_of_two_dim_band_D_Allocate_for_Y_dep1_atline_151 },
+  .dep_out    = { &flow_of_two_dim_band_D_Allocate_for_Y_dep2_atline_152 }
+};
+
+static const parsec_dep_t flow_of_two_dim_band_D_Allocate_for_ctl_dep1_atline_154 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 5, /* two_dim_band_D_Init */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_two_dim_band_D_Init_for_ctl,
+  .dep_index = 1,
+  .dep_datatype_index = 1,
+  .belongs_to = &flow_of_two_dim_band_D_Allocate_for_ctl,
+};
+#if MAX_DEP_OUT_COUNT < 1  /* number of output dependencies */
+    #error Too many output dependencies (supports up to MAX_DEP_OUT_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_OUT_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_two_dim_band_D_Allocate_for_ctl = {
+  .name               = "ctl",
+  .sym_type           = PARSEC_SYM_OUT,
+  .flow_flags         = PARSEC_FLOW_ACCESS_NONE,
+  .flow_index         = 1,
+  .flow_datatype_mask = 0x2,
+  .dep_in     = { NULL },
+  .dep_out    = { &flow_of_two_dim_band_D_Allocate_for_ctl_dep1_atline_154 }
+};
+
+static void
+iterate_successors_of_two_dim_band_D_Allocate(parsec_execution_stream_t *es, const __parsec_two_dim_band_D_Allocate_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp = (const __parsec_two_dim_band_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_two_dim_band_D_Allocate_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_two_dim_band_D_Allocate_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int m = __jdf2c__tmp_locals.m.value; (void)m;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)m;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_descY(m, m);
+#endif
+  /* Flow of data Y has only OUTPUT dependencies to Memory */
+  if( action_mask & 0x2 ) {  /* Flow of data ctl [1] */
+    data.data   = this_task->data._f_ctl.data_out;
+    data.data_future  = NULL;
+    if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  =   /* Control: always empty */ 0;
+    data.local.dst_count  =   /* Control: always empty */ 0;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = NULL;
+    data.remote.src_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.src_count  =   /* Control: always empty */ 0;
+    data.remote.dst_count  =   /* Control: always empty */ 0;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+       __parsec_two_dim_band_D_Init_task_t* ncc = (__parsec_two_dim_band_D_Init_task_t*)&nc;
+    nc.task_class = __parsec_tp->super.super.task_classes_array[two_dim_band_D_Init.task_class_id];
+      const int D_Init_m = m;
+      if( (D_Init_m >= (0)) && (D_Init_m <= ((descY->lmt - 1))) ) {
+        assert(&nc.locals[0].value == &ncc->locals.m.value);
+        ncc->locals.m.value = D_Init_m;
+#if defined(DISTRIBUTED)
+        rank_dst = rank_of_descY(ncc->locals.m.value, ncc->locals.m.value);
+        if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+          vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descY)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descY, ncc->locals.m.value, ncc->locals.m.value);
+        nc.priority = __parsec_tp->super.super.priority;
+        successor_repo = D_Init_repo;
+        successor_repo_key = __jdf2c_make_key_D_Init((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+      RELEASE_DEP_OUTPUT(es, "ctl", this_task, "ctl", &nc, rank_src, rank_dst, &data);
+      if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_two_dim_band_D_Allocate_for_ctl_dep1_atline_154, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+        }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static int release_deps_of_two_dim_band_D_Allocate(parsec_execution_stream_t *es, __parsec_two_dim_band_D_Allocate_task_t *this_task, uint32_t action_mask, parsec_remote_deps_t *deps)
+{
+  PARSEC_PINS(es, RELEASE_DEPS_BEGIN, (parsec_task_t *)this_task);  const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp = (const __parsec_two_dim_band_internal_taskpool_t *)this_task->taskpool;
+  parsec_release_dep_fct_arg_t arg;
+  int __vp_id;
+  int consume_local_repo = 0;
+  arg.action_mask = action_mask;
+  arg.output_entry = NULL;
+  arg.output_repo = NULL;
+#if defined(DISTRIBUTED)
+  arg.remote_deps = deps;
+#endif  /* defined(DISTRIBUTED) */
+  assert(NULL != es);
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS )    arg.ready_lists = alloca(sizeof(parsec_task_t *) * es->virtual_process->parsec_context->nb_vp);
+  else
+    arg.ready_lists = NULL;
+  for( __vp_id = 0; __vp_id < es->virtual_process->parsec_context->nb_vp; arg.ready_lists[__vp_id++] = NULL );
+  (void)__parsec_tp; (void)deps;
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_Y.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_Y.source_repo, this_task->data._f_Y.source_repo_entry->ht_item.key );
+    }
+  }
+  consume_local_repo = (this_task->repo_entry != NULL);
+  arg.output_repo = D_Allocate_repo;
+  arg.output_entry = this_task->repo_entry;
+  arg.output_usage = 0;
+  if( action_mask & (PARSEC_ACTION_RELEASE_LOCAL_DEPS | PARSEC_ACTION_GET_REPO_ENTRY) ) {
+    arg.output_entry = data_repo_lookup_entry_and_create( es, arg.output_repo, __jdf2c_make_key_D_Allocate((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    arg.output_entry->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(arg.output_entry->sim_exec_date == 0);
+    arg.output_entry->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  if(action_mask & ( PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE ) ){
+    /* Generate the reshape promise for the outputs that need it */
+    iterate_successors_of_two_dim_band_D_Allocate(es, this_task, action_mask, parsec_set_up_reshape_promise, &arg);
+   }
+  iterate_successors_of_two_dim_band_D_Allocate(es, this_task, action_mask, parsec_release_dep_fct, &arg);
+
+#if defined(DISTRIBUTED)
+  if( (action_mask & PARSEC_ACTION_SEND_REMOTE_DEPS) && (NULL != arg.remote_deps)) {
+    parsec_remote_dep_activate(es, (parsec_task_t *)this_task, arg.remote_deps, arg.remote_deps->outgoing_mask);
+  }
+#endif
+
+  if(action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS) {
+    data_repo_entry_addto_usage_limit(D_Allocate_repo, arg.output_entry->ht_item.key, arg.output_usage);
+    __parsec_schedule_vp(es, arg.ready_lists, 0);
+  }
+      if (consume_local_repo) {
+         data_repo_entry_used_once( D_Allocate_repo, this_task->repo_entry->ht_item.key );
+      }
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_Y.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_Y.data_in);
+    }
+  }
+  PARSEC_PINS(es, RELEASE_DEPS_END, (parsec_task_t *)this_task);  return 0;
+}
+
+static int data_lookup_of_two_dim_band_D_Allocate(parsec_execution_stream_t *es, __parsec_two_dim_band_D_Allocate_task_t *this_task)
+{
+  const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp = (__parsec_two_dim_band_internal_taskpool_t *)this_task->taskpool;
+  parsec_assignment_t generic_locals[MAX_PARAM_COUNT];  /* generic task locals */
+  int target_device = 0; (void)target_device;
+  (void)__parsec_tp; (void)generic_locals; (void)es;
+  parsec_data_copy_t *chunk = NULL;
+  data_repo_t        *reshape_repo  = NULL, *consumed_repo  = NULL;
+  data_repo_entry_t  *reshape_entry = NULL, *consumed_entry = NULL;
+  parsec_key_t        reshape_entry_key = 0, consumed_entry_key = 0;
+  uint8_t             consumed_flow_index;
+  parsec_dep_data_description_t data;
+  int ret;
+  (void)reshape_repo; (void)reshape_entry; (void)reshape_entry_key;
+  (void)consumed_repo; (void)consumed_entry; (void)consumed_entry_key;
+  (void)consumed_flow_index;
+  (void)chunk; (void)data; (void)ret;
+  const int m = this_task->locals.m.value; (void)m;
+  if( NULL == this_task->repo_entry ){
+    this_task->repo_entry = data_repo_lookup_entry_and_create(es, D_Allocate_repo,                                       __jdf2c_make_key_D_Allocate((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    data_repo_entry_addto_usage_limit(D_Allocate_repo, this_task->repo_entry->ht_item.key, 1);    this_task->repo_entry ->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(this_task->repo_entry ->sim_exec_date == 0);
+    this_task->repo_entry ->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  /* The reshape repo is the current task repo. */  reshape_repo = D_Allocate_repo;
+  reshape_entry_key = __jdf2c_make_key_D_Allocate((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals) ;
+  reshape_entry = this_task->repo_entry;
+  /* Lookup the input data, and store them in the context if any */
+
+if(! this_task->data._f_Y.fulfill ){ /* Flow Y */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_Y.data_out = NULL;  /* By default, if nothing matches */
+  /* Flow Y [0] dependency [0] from memory NEW or NULL data */
+  if( NULL == (chunk = this_task->data._f_Y.data_in) ) {
+  /* No data set up by predecessor on this task input flow */
+  } 
+    this_task->data._f_Y.data_in     = chunk;
+    this_task->data._f_Y.source_repo       = consumed_repo;
+    this_task->data._f_Y.source_repo_entry = consumed_entry;
+    if( this_task->data._f_Y.source_repo_entry == this_task->repo_entry ){
+      /* in case we have consume from this task repo entry for the flow,
+       * it is cleaned up, avoiding having old stuff during release_deps_of
+       */
+      this_task->repo_entry->data[0] = NULL;
+    }
+    this_task->data._f_Y.fulfill = 1;
+}
+
+  /* ctl is a control flow */
+  this_task->data._f_ctl.data_in         = NULL;
+  this_task->data._f_ctl.data_out        = NULL;
+  this_task->data._f_ctl.source_repo       = NULL;
+  this_task->data._f_ctl.source_repo_entry = NULL;
+  /** Generate profiling information */
+#if defined(PARSEC_PROF_TRACE)
+  this_task->prof_info.desc = (parsec_data_collection_t*)__parsec_tp->super._g_descY;
+  this_task->prof_info.priority = this_task->priority;
+  this_task->prof_info.data_id   = ((parsec_data_collection_t*)__parsec_tp->super._g_descY)->data_key((parsec_data_collection_t*)__parsec_tp->super._g_descY, m, m);
+  this_task->prof_info.task_class_id = this_task->task_class->task_class_id;
+  this_task->prof_info.task_return_code = -1;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int datatype_lookup_of_two_dim_band_D_Allocate(parsec_execution_stream_t *es, const parsec_task_t *this_generic_task, const parsec_task_t *parent_task,
+              uint32_t* flow_mask, parsec_dep_data_description_t* data)
+{
+  const __parsec_two_dim_band_D_Allocate_task_t *this_task = (__parsec_two_dim_band_D_Allocate_task_t*)this_generic_task;
+  const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp = (__parsec_two_dim_band_internal_taskpool_t *)this_task->taskpool;
+  (void)__parsec_tp; (void)es; (void)this_task; (void)data; (void)parent_task;
+  const int m = this_task->locals.m.value; (void)m;
+  data->local.arena = data->remote.arena = NULL;
+  data->local.src_datatype  = data->local.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->local.src_count     = data->local.dst_count = 0;
+  data->local.src_displ     = data->local.dst_displ = 0;
+  data->data_future  = NULL;
+  if( (*flow_mask) & 0x80000000U ) { /* these are the input dependencies remote datatypes  */
+if( (*flow_mask) & 0x1U ) {  /* Flow Y */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_two_dim_band_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_two_dim_band_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_two_dim_band_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+    goto no_mask_match;
+  }
+
+  /* these are the output dependencies remote datatypes */
+if( (*flow_mask) & 0x1U ) {  /* Flow Y */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_two_dim_band_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_two_dim_band_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_two_dim_band_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+ no_mask_match:
+  data->data                             = NULL;
+  data->remote.src_datatype = data->remote.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->remote.src_count    = data->remote.dst_count = 0;
+  data->remote.src_displ    = data->remote.dst_displ = 0;
+  data->data_future  = NULL;
+  (*flow_mask) = 0;  /* nothing left */
+  (void)m;
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+static int hook_of_two_dim_band_D_Allocate(parsec_execution_stream_t *es, __parsec_two_dim_band_D_Allocate_task_t *this_task)
+{
+  __parsec_two_dim_band_internal_taskpool_t *__parsec_tp = (__parsec_two_dim_band_internal_taskpool_t *)this_task->taskpool;
+  (void)es; (void)__parsec_tp;
+  const int m = this_task->locals.m.value; (void)m;
+  (void)m;
+
+  /** Declare the variables that will hold the data, and all the accounting for each */
+  parsec_data_copy_t *_f_Y = this_task->data._f_Y.data_in;
+  void *Y = PARSEC_DATA_COPY_GET_PTR(_f_Y); (void)Y;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    data_repo_entry_t *eY = this_task->data._f_Y.source_repo_entry;
+    if( (NULL != eY) && (eY->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eY->sim_exec_date;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+    if ( NULL != _f_Y ) {
+#if defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) || defined(PARSEC_HAVE_DEV_HIP_SUPPORT)
+      parsec_data_transfer_ownership_to_copy( _f_Y->original, 0 /* device */,
+                                           PARSEC_FLOW_ACCESS_RW);
+#endif  /* defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) || defined(PARSEC_HAVE_DEV_HIP_SUPPORT) */
+      _f_Y->version++;  /* Y */
+#if defined(PARSEC_DEBUG_NOISIER)
+      char tmp[128];
+      PARSEC_DEBUG_VERBOSE(10, parsec_debug_output,
+                           "Body of %s: change Data copy %p to version %d",
+                           parsec_task_snprintf(tmp, 128, (parsec_task_t*)(this_task)),
+                           _f_Y, _f_Y->version);
+#endif /* defined(PARSEC_DEBUG_NOISIER) */
+    }
+  /** Cache Awareness Accounting */
+#if defined(PARSEC_CACHE_AWARENESS)
+  cache_buf_referenced(es->closest_cache, Y);
+#endif /* PARSEC_CACHE_AWARENESS */
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                                D_Allocate BODY                                -----*/
+
+{
+    int size = descY->bsiz * sizeof(double);   /* Could be changed flexibly */
+    this_task->data._f_Y.data_out = parsec_data_copy_new(data_of_descY(m, m), 0,
+                                                         PARSEC_two_dim_band_DEFAULT_ADT->opaque_dtt,
+                                                         PARSEC_DATA_FLAG_PARSEC_MANAGED);
+    this_task->data._f_Y.data_out->device_private = malloc(size);
+}
+
+/*-----                            END OF D_Allocate BODY                            -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#endif  /*  defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+static int complete_hook_of_two_dim_band_D_Allocate(parsec_execution_stream_t *es, __parsec_two_dim_band_D_Allocate_task_t *this_task)
+{
+  const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp = (__parsec_two_dim_band_internal_taskpool_t *)this_task->taskpool;
+#if defined(DISTRIBUTED)
+    const int m = this_task->locals.m.value; (void)m;
+#endif  /* defined(DISTRIBUTED) */
+  (void)es; (void)__parsec_tp;
+parsec_data_t* data_t_desc = NULL; (void)data_t_desc;
+#if defined(DISTRIBUTED)
+  /** If not working on distributed, there is no risk that data is not in place */
+  data_t_desc = data_of_descY(m, m);
+  if( (NULL != this_task->data._f_Y.data_out) && (this_task->data._f_Y.data_out->original != data_t_desc) ) {
+    /* Writting back using remote_type */;
+    parsec_dep_data_description_t data;
+    data.data         = this_task->data._f_Y.data_out;
+    data.local.arena        = NULL;
+    data.local.src_datatype = data.data->dtt;
+    data.local.src_count    = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_datatype = parsec_data_get_copy(data_t_desc, 0)->dtt;
+    data.local.dst_count    = 1;
+    data.local.dst_displ    = 0;
+    data.data_future  = NULL;
+    assert( data.local.src_count > 0 );
+    parsec_remote_dep_memcpy(es,
+                            this_task->taskpool,
+                            parsec_data_get_copy(data_of_descY(m, m), 0),
+                            this_task->data._f_Y.data_out, &data);
+  }
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+  parsec_prof_grapher_data_output((parsec_task_t*)this_task, data_of_descY(m, m), &flow_of_two_dim_band_D_Allocate_for_Y);
+#endif
+  (void)m;
+
+#endif /* DISTRIBUTED */
+#if defined(PARSEC_PROF_GRAPHER)
+  parsec_prof_grapher_task((parsec_task_t*)this_task, es->th_id, es->virtual_process->vp_id,
+     __jdf2c_key_fns_D_Allocate.key_hash(this_task->task_class->make_key( (parsec_taskpool_t*)this_task->taskpool, ((parsec_task_t*)this_task)->locals), NULL));
+#endif  /* defined(PARSEC_PROF_GRAPHER) */
+  release_deps_of_two_dim_band_D_Allocate(es, this_task,
+      PARSEC_ACTION_RELEASE_REMOTE_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_REFS |
+      PARSEC_ACTION_RESHAPE_ON_RELEASE |
+      0x3,  /* mask of all dep_index */ 
+      NULL);
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static parsec_hook_return_t release_task_of_two_dim_band_D_Allocate(parsec_execution_stream_t *es, parsec_task_t *this_task)
+{
+    const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp =
+        (const __parsec_two_dim_band_internal_taskpool_t *)this_task->taskpool;
+    parsec_hash_table_t *ht = (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[4];
+    parsec_key_t key = this_task->task_class->make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals);
+    parsec_hashable_dependency_t *hash_dep = (parsec_hashable_dependency_t *)parsec_hash_table_remove(ht, key);
+    parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);
+    return parsec_release_task_to_mempool_update_nbtasks(es, this_task);
+}
+
+static char *two_dim_band_two_dim_band_D_Allocate_internal_init_deps_key_functions_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_two_dim_band_internal_taskpool_t *__parsec_tp = (__parsec_two_dim_band_internal_taskpool_t *)user_data;
+  int m = (__parsec_key) % __parsec_tp->D_Allocate_m_range + __parsec_tp->D_Allocate_m_min;
+  __parsec_key = __parsec_key / __parsec_tp->D_Allocate_m_range;
+  snprintf(buffer, buffer_size, "D_Allocate(%d)", m);
+  return buffer;
+}
+
+static parsec_key_fn_t two_dim_band_two_dim_band_D_Allocate_internal_init_deps_key_functions = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = two_dim_band_two_dim_band_D_Allocate_internal_init_deps_key_functions_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/* Needs: min-max count-tasks iterate */
+static int two_dim_band_D_Allocate_internal_init(parsec_execution_stream_t * es, __parsec_two_dim_band_D_Allocate_task_t * this_task)
+{
+  __parsec_two_dim_band_internal_taskpool_t *__parsec_tp = (__parsec_two_dim_band_internal_taskpool_t*)this_task->taskpool;
+  int32_t nb_tasks = 0, saved_nb_tasks = 0;
+int32_t __m_min = 0x7fffffff, __m_max = 0;int32_t __jdf2c_m_min = 0x7fffffff, __jdf2c_m_max = 0;  __parsec_two_dim_band_D_Allocate_parsec_assignment_t assignments = {  .m.value = 0 };
+  int32_t  m;
+  int32_t __jdf2c_m_start, __jdf2c_m_end, __jdf2c_m_inc;
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+  PARSEC_PROFILING_TRACE(es->es_profile,
+                         this_task->taskpool->profiling_array[START_KEY(this_task->task_class->task_class_id)],
+                         0,
+                         this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    __jdf2c_m_start = 0;
+    __jdf2c_m_end = (descY->lmt - 1);
+    __jdf2c_m_inc = 1;
+    __m_min = parsec_imin(__jdf2c_m_start, __jdf2c_m_end);
+    __m_max = parsec_imax(__jdf2c_m_start, __jdf2c_m_end);
+    __jdf2c_m_min = parsec_imin(__jdf2c_m_min, __m_min);
+    __jdf2c_m_max = parsec_imax(__jdf2c_m_max, __m_max);
+    for(m =  __jdf2c_m_start;
+        m <= __jdf2c_m_end;
+        m += __jdf2c_m_inc) {
+    assignments.m.value = m;
+    if( !D_Allocate_pred(m) ) continue;
+    nb_tasks++;
+  } /* Loop on normal range m */
+   if( 0 != nb_tasks ) {
+     (void)parsec_atomic_fetch_add_int32(&__parsec_tp->initial_number_tasks, nb_tasks);
+   }
+  /* Set the range variables for the collision-free hash-computation */
+  __parsec_tp->D_Allocate_m_min   = __jdf2c_m_min;
+  __parsec_tp->D_Allocate_m_range = (__jdf2c_m_max - __jdf2c_m_min) + 1;
+    do {
+      this_task->super.list_next = (parsec_list_item_t*)__parsec_tp->startup_queue;
+    } while(!parsec_atomic_cas_ptr(&__parsec_tp->startup_queue, (parsec_list_item_t*)this_task->super.list_next, this_task));
+    this_task->status = PARSEC_TASK_STATUS_HOOK;
+
+  PARSEC_AYU_REGISTER_TASK(&two_dim_band_D_Allocate);
+  __parsec_tp->super.super.dependencies_array[4] = PARSEC_OBJ_NEW(parsec_hash_table_t);
+  parsec_hash_table_init(__parsec_tp->super.super.dependencies_array[4], offsetof(parsec_hashable_dependency_t, ht_item), 10, two_dim_band_two_dim_band_D_Allocate_internal_init_deps_key_functions, this_task->taskpool);
+  __parsec_tp->repositories[4] = data_repo_create_nothreadsafe(nb_tasks, __jdf2c_key_fns_D_Allocate, (parsec_taskpool_t*)__parsec_tp, 2);
+(void)saved_nb_tasks;
+(void)__m_min; (void)__m_max;  (void)__jdf2c_m_start; (void)__jdf2c_m_end; (void)__jdf2c_m_inc;  (void)assignments; (void)__parsec_tp; (void)es;
+  if(1 == parsec_atomic_fetch_dec_int32(&__parsec_tp->sync_point)) {
+    /* Last initialization task complete. Update the number of tasks. */
+    __parsec_tp->super.super.tdm.module->taskpool_addto_nb_tasks(&__parsec_tp->super.super, __parsec_tp->initial_number_tasks);
+    parsec_mfence();  /* write memory barrier to guarantee that the scheduler gets the correct number of tasks */
+    parsec_taskpool_enable((parsec_taskpool_t*)__parsec_tp, &__parsec_tp->startup_queue,
+                           (parsec_task_t*)this_task, es, __parsec_tp->super.super.nb_pending_actions);
+    __parsec_tp->super.super.tdm.module->taskpool_ready(&__parsec_tp->super.super);
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+    PARSEC_PROFILING_TRACE(es->es_profile,
+                           this_task->taskpool->profiling_array[2 * this_task->task_class->task_class_id + 1],
+                           0,
+                           this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    if( 1 >= __parsec_tp->super.super.nb_pending_actions ) {
+        /* if no tasks will be generated let's prevent the runtime from calling the hook and instead go directly to complete the task */
+        this_task->status = PARSEC_TASK_STATUS_COMPLETE;
+    }
+    return PARSEC_HOOK_RETURN_DONE;
+  }
+  return PARSEC_HOOK_RETURN_ASYNC;
+}
+
+static int __jdf2c_startup_D_Allocate(parsec_execution_stream_t * es, __parsec_two_dim_band_D_Allocate_task_t *this_task)
+{
+  __parsec_two_dim_band_D_Allocate_task_t* new_task;
+  __parsec_two_dim_band_internal_taskpool_t* __parsec_tp = (__parsec_two_dim_band_internal_taskpool_t*)this_task->taskpool;
+  parsec_context_t *context = __parsec_tp->super.super.context;
+  int vpid = 0, nb_tasks = 0;
+  size_t total_nb_tasks = 0;
+  parsec_list_item_t* pready_ring[context->nb_vp];
+  int restore_context = 0;
+  int m = this_task->locals.m.value;  /* retrieve value saved during the last iteration */
+  for(int _i = 0; _i < context->nb_vp; pready_ring[_i++] = NULL );
+  if( 0 != this_task->locals.reserved[0].value ) {
+    this_task->locals.reserved[0].value = 1; /* reset the submission process */
+    restore_context = 1;
+    goto restore_context_0;
+  }
+  this_task->locals.reserved[0].value = 1; /* a sane default value */
+  for(this_task->locals.m.value = m = 0;
+      this_task->locals.m.value <= (descY->lmt - 1);
+      this_task->locals.m.value += 1, m = this_task->locals.m.value) {
+    if( !D_Allocate_pred(m) ) continue;
+  __parsec_two_dim_band_D_Allocate_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_two_dim_band_D_Allocate_parsec_assignment_t*)&this_task->locals;
+  (void)__jdf2c__tmp_locals;
+  /* Flow for Y is always a memory reference */
+    if( NULL != ((parsec_data_collection_t*)__parsec_tp->super._g_descY)->vpid_of ) {
+      vpid = ((parsec_data_collection_t*)__parsec_tp->super._g_descY)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descY, m, m);
+      assert(context->nb_vp >= vpid);
+    } else {
+      vpid = (vpid + 1) % context->nb_vp;  /* spread the initial joy */
+    }
+    new_task = (__parsec_two_dim_band_D_Allocate_task_t*)parsec_thread_mempool_allocate( context->virtual_processes[vpid]->execution_streams[0]->context_mempool );
+    PARSEC_OBJ_CONSTRUCT(new_task, parsec_task_t); /* construct called only when new, force-construct it again */
+    /* Copy only the valid elements from this_task to new_task one */
+    new_task->taskpool   = this_task->taskpool;
+    new_task->task_class = __parsec_tp->super.super.task_classes_array[two_dim_band_D_Allocate.task_class_id];
+    new_task->chore_mask   = PARSEC_DEV_ALL;
+    new_task->locals.m.value = this_task->locals.m.value;
+    PARSEC_LIST_ITEM_SINGLETON(new_task);
+    new_task->priority = __parsec_tp->super.super.priority;
+    new_task->repo_entry = NULL;
+    new_task->data._f_Y.source_repo_entry = NULL;
+    new_task->data._f_Y.source_repo       = NULL;
+    new_task->data._f_Y.data_in         = NULL;
+    new_task->data._f_Y.data_out        = NULL;
+    new_task->data._f_Y.fulfill         = 0;
+    new_task->data._f_ctl.source_repo_entry = NULL;
+    new_task->data._f_ctl.source_repo       = NULL;
+    new_task->data._f_ctl.data_in         = NULL;
+    new_task->data._f_ctl.data_out        = NULL;
+    new_task->data._f_ctl.fulfill         = 0;
+#if defined(PARSEC_DEBUG_NOISIER)
+    {
+      char tmp[128];
+      PARSEC_DEBUG_VERBOSE(10, parsec_debug_output, "Add startup task %s to vpid %d",
+             parsec_task_snprintf(tmp, 128, (parsec_task_t*)new_task), vpid);
+    }
+#endif
+    parsec_dependencies_mark_task_as_startup((parsec_task_t*)new_task, es);
+    pready_ring[vpid] = parsec_list_item_ring_push_sorted(pready_ring[vpid],
+                                                          (parsec_list_item_t*)new_task,
+                                                          parsec_execution_context_priority_comparator);
+    nb_tasks++;
+   restore_context_0:  /* we jump here just so that we have code after the label */
+    restore_context = 0;
+    (void)restore_context;
+    if( nb_tasks > this_task->locals.reserved[0].value ) {
+      if( (size_t)this_task->locals.reserved[0].value < parsec_task_startup_iter ) this_task->locals.reserved[0].value <<= 1;
+      __parsec_schedule_vp(es, (parsec_task_t**)pready_ring, 0);
+      total_nb_tasks += nb_tasks;
+      nb_tasks = 0;
+      if( total_nb_tasks > parsec_task_startup_chunk ) {  /* stop here and request to be rescheduled */
+        return PARSEC_HOOK_RETURN_AGAIN;
+      }
+    }
+  } /* Loop on normal range m */
+  (void)vpid;
+  if( 0 != nb_tasks ) {
+    __parsec_schedule_vp(es, (parsec_task_t**)pready_ring, 0);
+    nb_tasks = 0;
+  }
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static const __parsec_chore_t __two_dim_band_D_Allocate_chores[] ={
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+    { .type     = PARSEC_DEV_CPU,
+      .evaluate = (parsec_evaluate_function_t*)NULL,
+      .hook     = (parsec_hook_t*)hook_of_two_dim_band_D_Allocate },
+#endif  /* defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+    { .type     = PARSEC_DEV_NONE,
+      .evaluate = NULL,
+      .hook     = (parsec_hook_t*)NULL },  /* End marker */
+};
+
+static const parsec_task_class_t two_dim_band_D_Allocate = {
+  .name = "D_Allocate",
+  .task_class_id = 4,
+  .nb_flows = 2,
+  .nb_parameters = 1,
+  .nb_locals = 1,
+  .task_class_type = PARSEC_TASK_CLASS_TYPE_PTG,
+  .params = { &symb_two_dim_band_D_Allocate_m, NULL },
+  .locals = { &symb_two_dim_band_D_Allocate_m, NULL },
+  .data_affinity = (parsec_data_ref_fn_t*)affinity_of_two_dim_band_D_Allocate,
+  .initial_data = (parsec_data_ref_fn_t*)affinity_of_two_dim_band_D_Allocate,
+  .final_data = (parsec_data_ref_fn_t*)affinity_of_two_dim_band_D_Allocate,
+  .priority = NULL,
+  .properties = properties_of_two_dim_band_D_Allocate,
+#if MAX_PARAM_COUNT < 1  /* number of read flows of D_Allocate */
+  #error Too many read flows for task D_Allocate
+#endif  /* MAX_PARAM_COUNT */
+#if MAX_PARAM_COUNT < 1  /* number of write flows of D_Allocate */
+  #error Too many write flows for task D_Allocate
+#endif  /* MAX_PARAM_COUNT */
+  .in = { &flow_of_two_dim_band_D_Allocate_for_Y, NULL },
+  .out = { &flow_of_two_dim_band_D_Allocate_for_Y, &flow_of_two_dim_band_D_Allocate_for_ctl, NULL },
+  .flags = 0x0 | PARSEC_HAS_IN_IN_DEPENDENCIES | PARSEC_USE_DEPS_MASK,
+  .dependencies_goal = 0x1,
+  .make_key = __jdf2c_make_key_D_Allocate,
+  .task_snprintf = parsec_task_snprintf,
+#if defined(PARSEC_PROF_TRACE)
+  .profile_info = &parsec_task_profile_info,
+#endif
+  .key_functions = &__jdf2c_key_fns_D_Allocate,
+  .fini = (parsec_hook_t*)NULL,
+  .incarnations = __two_dim_band_D_Allocate_chores,
+  .find_deps = parsec_hash_find_deps,
+  .update_deps = parsec_update_deps_with_mask,
+  .iterate_successors = (parsec_traverse_function_t*)iterate_successors_of_two_dim_band_D_Allocate,
+  .iterate_predecessors = (parsec_traverse_function_t*)NULL,
+  .release_deps = (parsec_release_deps_t*)release_deps_of_two_dim_band_D_Allocate,
+  .prepare_output = (parsec_hook_t*)NULL,
+  .prepare_input = (parsec_hook_t*)data_lookup_of_two_dim_band_D_Allocate,
+  .time_estimate = NULL,
+  .get_datatype = datatype_lookup_of_two_dim_band_D_Allocate,
+  .complete_execution = (parsec_hook_t*)complete_hook_of_two_dim_band_D_Allocate,
+  .release_task = &release_task_of_two_dim_band_D_Allocate,
+#if defined(PARSEC_SIM)
+  .sim_cost_fct = (parsec_sim_cost_fct_t*)NULL,
+#endif
+};
+
+
+/******                                    U_Init                                    ******/
+
+static inline int32_t minexpr_of_symb_two_dim_band_U_Init_m_fct(const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp, const __parsec_two_dim_band_U_Init_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_two_dim_band_U_Init_m = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_two_dim_band_U_Init_m_fct }
+                   }
+};
+static inline int maxexpr_of_symb_two_dim_band_U_Init_m_fct(const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp, const __parsec_two_dim_band_U_Init_parsec_assignment_t *locals)
+{
+  const int m = locals->m.value; (void)m;
+  const int n = locals->n.value; (void)n;
+
+  (void)m;
+  (void)n;
+  (void)__parsec_tp; (void)locals;
+  return (descY->lmt - 2);
+}
+static const parsec_expr_t maxexpr_of_symb_two_dim_band_U_Init_m = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_two_dim_band_U_Init_m_fct }
+                   }
+};
+static const parsec_symbol_t symb_two_dim_band_U_Init_m = { .name = "m", .context_index = 0, .min = &minexpr_of_symb_two_dim_band_U_Init_m, .max = &maxexpr_of_symb_two_dim_band_U_Init_m, .cst_inc = 1, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int minexpr_of_symb_two_dim_band_U_Init_n_fct(const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp, const __parsec_two_dim_band_U_Init_parsec_assignment_t *locals)
+{
+  const int m = locals->m.value;
+  const int n = locals->n.value; (void)n;
+
+  (void)m;
+  (void)n;
+  (void)__parsec_tp; (void)locals;
+  return (m + 1);
+}
+static const parsec_expr_t minexpr_of_symb_two_dim_band_U_Init_n = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_two_dim_band_U_Init_n_fct }
+                   }
+};
+static inline int maxexpr_of_symb_two_dim_band_U_Init_n_fct(const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp, const __parsec_two_dim_band_U_Init_parsec_assignment_t *locals)
+{
+  const int m = locals->m.value; (void)m;
+  const int n = locals->n.value; (void)n;
+
+  (void)m;
+  (void)n;
+  (void)__parsec_tp; (void)locals;
+  return (((uplo) == (matrix_lower)) ? (0) : ((descY->lnt - 1)));
+}
+static const parsec_expr_t maxexpr_of_symb_two_dim_band_U_Init_n = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_two_dim_band_U_Init_n_fct }
+                   }
+};
+static const parsec_symbol_t symb_two_dim_band_U_Init_n = { .name = "n", .context_index = 1, .min = &minexpr_of_symb_two_dim_band_U_Init_n, .max = &maxexpr_of_symb_two_dim_band_U_Init_n, .cst_inc = 1, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int affinity_of_two_dim_band_U_Init(const __parsec_two_dim_band_U_Init_task_t *this_task,
+                     parsec_data_ref_t *ref)
+{
+    const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp = (const __parsec_two_dim_band_internal_taskpool_t*)this_task->taskpool;
+  const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+
+  /* Silent Warnings: should look into predicate to know what variables are usefull */
+  (void)m;
+  (void)n;
+  ref->dc = (parsec_data_collection_t *)__parsec_tp->super._g_descY;
+  /* Compute data key */
+  ref->key = ref->dc->data_key(ref->dc, m, n);
+  return 1;
+}
+static const parsec_property_t properties_of_two_dim_band_U_Init[1] = {
+  {.name = NULL, .expr = NULL}
+};
+static parsec_data_t *flow_of_two_dim_band_U_Init_for_Y_dep1_atline_127_direct_access(const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp, const __parsec_two_dim_band_U_Init_parsec_assignment_t *assignments)
+{
+  const int m = assignments->m.value; (void)m;
+  const int n = assignments->n.value; (void)n;
+
+  /* Silence Warnings: should look into parameters to know what variables are useful */
+  (void)m;
+  (void)n;
+  if( __parsec_tp->super.super.context->my_rank == (int32_t)rank_of_descY(m, n) )
+    return data_of_descY(m, n);
+  return NULL;
+}
+
+static const parsec_dep_t flow_of_two_dim_band_U_Init_for_Y_dep1_atline_127 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = PARSEC_LOCAL_DATA_TASK_CLASS_ID, /* two_dim_band_descY */
+  .direct_data = (parsec_data_lookup_func_t)&flow_of_two_dim_band_U_Init_for_Y_dep1_atline_127_direct_access,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_two_dim_band_U_Init_for_Y,
+};
+static parsec_data_t *flow_of_two_dim_band_U_Init_for_Y_dep2_atline_128_direct_access(const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp, const __parsec_two_dim_band_U_Init_parsec_assignment_t *assignments)
+{
+  const int m = assignments->m.value; (void)m;
+  const int n = assignments->n.value; (void)n;
+
+  /* Silence Warnings: should look into parameters to know what variables are useful */
+  (void)m;
+  (void)n;
+  if( __parsec_tp->super.super.context->my_rank == (int32_t)rank_of_descY(m, n) )
+    return data_of_descY(m, n);
+  return NULL;
+}
+
+static const parsec_dep_t flow_of_two_dim_band_U_Init_for_Y_dep2_atline_128 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = PARSEC_LOCAL_DATA_TASK_CLASS_ID, /* two_dim_band_descY */
+  .direct_data = (parsec_data_lookup_func_t)&flow_of_two_dim_band_U_Init_for_Y_dep2_atline_128_direct_access,
+  .flags = PARSEC_DEP_FINAL_WRITE_AS_IS,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_two_dim_band_U_Init_for_Y,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+#if MAX_DEP_OUT_COUNT < 1  /* number of output dependencies */
+    #error Too many output dependencies (supports up to MAX_DEP_OUT_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_OUT_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_two_dim_band_U_Init_for_Y = {
+  .name               = "Y",
+  .sym_type           = PARSEC_SYM_INOUT,
+  .flow_flags         = PARSEC_FLOW_ACCESS_RW|PARSEC_FLOW_HAS_IN_DEPS,
+  .flow_index         = 0,
+  .flow_datatype_mask = 0x1,
+  .dep_in     = { &flow_of_two_dim_band_U_Init_for_Y_dep1_atline_127 },
+  .dep_out    = { &flow_of_two_dim_band_U_Init_for_Y_dep2_atline_128 }
+};
+
+static const parsec_dep_t flow_of_two_dim_band_U_Init_for_ctl_dep1_atline_130 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 2, /* two_dim_band_U_Allocate */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_two_dim_band_U_Allocate_for_ctl,
+  .dep_index = 1,
+  .dep_datatype_index = 1,
+  .belongs_to = &flow_of_two_dim_band_U_Init_for_ctl,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_two_dim_band_U_Init_for_ctl = {
+  .name               = "ctl",
+  .sym_type           = PARSEC_SYM_IN,
+  .flow_flags         = PARSEC_FLOW_ACCESS_NONE,
+  .flow_index         = 1,
+  .flow_datatype_mask = 0x0,
+  .dep_in     = { &flow_of_two_dim_band_U_Init_for_ctl_dep1_atline_130 },
+  .dep_out    = { NULL }
+};
+
+static void
+iterate_predecessors_of_two_dim_band_U_Init(parsec_execution_stream_t *es, const __parsec_two_dim_band_U_Init_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp = (const __parsec_two_dim_band_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_two_dim_band_U_Init_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_two_dim_band_U_Init_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int m = __jdf2c__tmp_locals.m.value; (void)m;
+  const int n = __jdf2c__tmp_locals.n.value; (void)n;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)m;  (void)n;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_descY(m, n);
+#endif
+  /* Flow of data Y has only OUTPUT dependencies to Memory */
+  if( action_mask & 0x2 ) {  /* Flow of data ctl [1] */
+    data.data   = this_task->data._f_ctl.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x2 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  =   /* Control: always empty */ 0;
+    data.local.dst_count  =   /* Control: always empty */ 0;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = NULL;
+    data.remote.src_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.src_count  =   /* Control: always empty */ 0;
+    data.remote.dst_count  =   /* Control: always empty */ 0;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        __parsec_two_dim_band_U_Allocate_task_t* ncc = (__parsec_two_dim_band_U_Allocate_task_t*)&nc;
+    nc.task_class = __parsec_tp->super.super.task_classes_array[two_dim_band_U_Allocate.task_class_id];
+      const int U_Allocate_m = m;
+      if( (U_Allocate_m >= (0)) && (U_Allocate_m <= ((descY->lmt - 2))) ) {
+        assert(&nc.locals[0].value == &ncc->locals.m.value);
+        ncc->locals.m.value = U_Allocate_m;
+        const int U_Allocate_n = n;
+        if( (U_Allocate_n >= ((ncc->locals.m.value + 1))) && (U_Allocate_n <= ((((uplo) == (matrix_lower)) ? (0) : ((descY->lnt - 1))))) ) {
+          assert(&nc.locals[1].value == &ncc->locals.n.value);
+          ncc->locals.n.value = U_Allocate_n;
+#if defined(DISTRIBUTED)
+          rank_dst = rank_of_descY(ncc->locals.m.value, ncc->locals.n.value);
+          if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+            vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descY)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descY, ncc->locals.m.value, ncc->locals.n.value);
+          nc.priority = __parsec_tp->super.super.priority;
+          successor_repo = NULL;
+          successor_repo_key = 0;
+        RELEASE_DEP_OUTPUT(es, "ctl", this_task, "ctl", &nc, rank_src, rank_dst, &data);
+        if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_two_dim_band_U_Init_for_ctl_dep1_atline_130, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+          }
+        }
+  }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static int release_deps_of_two_dim_band_U_Init(parsec_execution_stream_t *es, __parsec_two_dim_band_U_Init_task_t *this_task, uint32_t action_mask, parsec_remote_deps_t *deps)
+{
+  PARSEC_PINS(es, RELEASE_DEPS_BEGIN, (parsec_task_t *)this_task);  const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp = (const __parsec_two_dim_band_internal_taskpool_t *)this_task->taskpool;
+  parsec_release_dep_fct_arg_t arg;
+  int __vp_id;
+  int consume_local_repo = 0;
+  arg.action_mask = action_mask;
+  arg.output_entry = NULL;
+  arg.output_repo = NULL;
+#if defined(DISTRIBUTED)
+  arg.remote_deps = deps;
+#endif  /* defined(DISTRIBUTED) */
+  assert(NULL != es);
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS )    arg.ready_lists = alloca(sizeof(parsec_task_t *) * es->virtual_process->parsec_context->nb_vp);
+  else
+    arg.ready_lists = NULL;
+  for( __vp_id = 0; __vp_id < es->virtual_process->parsec_context->nb_vp; arg.ready_lists[__vp_id++] = NULL );
+  (void)__parsec_tp; (void)deps;
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_Y.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_Y.source_repo, this_task->data._f_Y.source_repo_entry->ht_item.key );
+    }
+  }
+  consume_local_repo = (this_task->repo_entry != NULL);
+  /* No successors, don't call iterate_successors and don't release any local deps */
+      if (consume_local_repo) {
+         data_repo_entry_used_once( U_Init_repo, this_task->repo_entry->ht_item.key );
+      }
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_Y.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_Y.data_in);
+    }
+  }
+  PARSEC_PINS(es, RELEASE_DEPS_END, (parsec_task_t *)this_task);  return 0;
+}
+
+static int data_lookup_of_two_dim_band_U_Init(parsec_execution_stream_t *es, __parsec_two_dim_band_U_Init_task_t *this_task)
+{
+  const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp = (__parsec_two_dim_band_internal_taskpool_t *)this_task->taskpool;
+  parsec_assignment_t generic_locals[MAX_PARAM_COUNT];  /* generic task locals */
+  int target_device = 0; (void)target_device;
+  (void)__parsec_tp; (void)generic_locals; (void)es;
+  parsec_data_copy_t *chunk = NULL;
+  data_repo_t        *reshape_repo  = NULL, *consumed_repo  = NULL;
+  data_repo_entry_t  *reshape_entry = NULL, *consumed_entry = NULL;
+  parsec_key_t        reshape_entry_key = 0, consumed_entry_key = 0;
+  uint8_t             consumed_flow_index;
+  parsec_dep_data_description_t data;
+  int ret;
+  (void)reshape_repo; (void)reshape_entry; (void)reshape_entry_key;
+  (void)consumed_repo; (void)consumed_entry; (void)consumed_entry_key;
+  (void)consumed_flow_index;
+  (void)chunk; (void)data; (void)ret;
+  const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+  if( NULL == this_task->repo_entry ){
+    this_task->repo_entry = data_repo_lookup_entry_and_create(es, U_Init_repo,                                       __jdf2c_make_key_U_Init((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    data_repo_entry_addto_usage_limit(U_Init_repo, this_task->repo_entry->ht_item.key, 1);    this_task->repo_entry ->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(this_task->repo_entry ->sim_exec_date == 0);
+    this_task->repo_entry ->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  /* The reshape repo is the current task repo. */  reshape_repo = U_Init_repo;
+  reshape_entry_key = __jdf2c_make_key_U_Init((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals) ;
+  reshape_entry = this_task->repo_entry;
+  /* Lookup the input data, and store them in the context if any */
+
+if(! this_task->data._f_Y.fulfill ){ /* Flow Y */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_Y.data_out = NULL;  /* By default, if nothing matches */
+  /* Flow Y [0] dependency [0] from memory descY */
+  if( NULL == (chunk = this_task->data._f_Y.data_in) ) {
+  /* No data set up by predecessor on this task input flow */
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+  parsec_prof_grapher_data_input(data_of_descY(m, n), (parsec_task_t*)this_task, &flow_of_two_dim_band_U_Init_for_Y, 1);
+#endif
+    chunk = parsec_data_get_copy(data_of_descY(m, n), target_device);
+    data.data = chunk;
+    data.data_future  = NULL;
+        data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.data_future   = NULL;
+    if( (ret = parsec_get_copy_reshape_from_desc(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    this_task->data._f_Y.data_out = chunk;
+    PARSEC_OBJ_RETAIN(chunk);
+  } 
+    this_task->data._f_Y.data_in     = chunk;
+    this_task->data._f_Y.source_repo       = consumed_repo;
+    this_task->data._f_Y.source_repo_entry = consumed_entry;
+    this_task->data._f_Y.fulfill = 1;
+}
+
+  /* ctl is a control flow */
+  this_task->data._f_ctl.data_in         = NULL;
+  this_task->data._f_ctl.data_out        = NULL;
+  this_task->data._f_ctl.source_repo       = NULL;
+  this_task->data._f_ctl.source_repo_entry = NULL;
+  /** Generate profiling information */
+#if defined(PARSEC_PROF_TRACE)
+  this_task->prof_info.desc = (parsec_data_collection_t*)__parsec_tp->super._g_descY;
+  this_task->prof_info.priority = this_task->priority;
+  this_task->prof_info.data_id   = ((parsec_data_collection_t*)__parsec_tp->super._g_descY)->data_key((parsec_data_collection_t*)__parsec_tp->super._g_descY, m, n);
+  this_task->prof_info.task_class_id = this_task->task_class->task_class_id;
+  this_task->prof_info.task_return_code = -1;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int datatype_lookup_of_two_dim_band_U_Init(parsec_execution_stream_t *es, const parsec_task_t *this_generic_task, const parsec_task_t *parent_task,
+              uint32_t* flow_mask, parsec_dep_data_description_t* data)
+{
+  const __parsec_two_dim_band_U_Init_task_t *this_task = (__parsec_two_dim_band_U_Init_task_t*)this_generic_task;
+  const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp = (__parsec_two_dim_band_internal_taskpool_t *)this_task->taskpool;
+  (void)__parsec_tp; (void)es; (void)this_task; (void)data; (void)parent_task;
+  const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+  data->local.arena = data->remote.arena = NULL;
+  data->local.src_datatype  = data->local.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->local.src_count     = data->local.dst_count = 0;
+  data->local.src_displ     = data->local.dst_displ = 0;
+  data->data_future  = NULL;
+  if( (*flow_mask) & 0x80000000U ) { /* these are the input dependencies remote datatypes  */
+if( (*flow_mask) & 0x1U ) {  /* Flow Y */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_two_dim_band_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_two_dim_band_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_two_dim_band_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+    goto no_mask_match;
+  }
+
+  /* these are the output dependencies remote datatypes */
+if( (*flow_mask) & 0x1U ) {  /* Flow Y */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_two_dim_band_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_two_dim_band_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_two_dim_band_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+ no_mask_match:
+  data->data                             = NULL;
+  data->remote.src_datatype = data->remote.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->remote.src_count    = data->remote.dst_count = 0;
+  data->remote.src_displ    = data->remote.dst_displ = 0;
+  data->data_future  = NULL;
+  (*flow_mask) = 0;  /* nothing left */
+  (void)m;  (void)n;
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+static int hook_of_two_dim_band_U_Init(parsec_execution_stream_t *es, __parsec_two_dim_band_U_Init_task_t *this_task)
+{
+  __parsec_two_dim_band_internal_taskpool_t *__parsec_tp = (__parsec_two_dim_band_internal_taskpool_t *)this_task->taskpool;
+  (void)es; (void)__parsec_tp;
+  const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+  (void)m;  (void)n;
+
+  /** Declare the variables that will hold the data, and all the accounting for each */
+  parsec_data_copy_t *_f_Y = this_task->data._f_Y.data_in;
+  void *Y = PARSEC_DATA_COPY_GET_PTR(_f_Y); (void)Y;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    data_repo_entry_t *eY = this_task->data._f_Y.source_repo_entry;
+    if( (NULL != eY) && (eY->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eY->sim_exec_date;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+    if ( NULL != _f_Y ) {
+#if defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) || defined(PARSEC_HAVE_DEV_HIP_SUPPORT)
+      parsec_data_transfer_ownership_to_copy( _f_Y->original, 0 /* device */,
+                                           PARSEC_FLOW_ACCESS_RW);
+#endif  /* defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) || defined(PARSEC_HAVE_DEV_HIP_SUPPORT) */
+      _f_Y->version++;  /* Y */
+#if defined(PARSEC_DEBUG_NOISIER)
+      char tmp[128];
+      PARSEC_DEBUG_VERBOSE(10, parsec_debug_output,
+                           "Body of %s: change Data copy %p to version %d",
+                           parsec_task_snprintf(tmp, 128, (parsec_task_t*)(this_task)),
+                           _f_Y, _f_Y->version);
+#endif /* defined(PARSEC_DEBUG_NOISIER) */
+    }
+  /** Cache Awareness Accounting */
+#if defined(PARSEC_CACHE_AWARENESS)
+  cache_buf_referenced(es->closest_cache, Y);
+#endif /* PARSEC_CACHE_AWARENESS */
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                                  U_Init BODY                                  -----*/
+
+{
+    CORE_two_dim_band(Y, descY->mb, descY->nb);
+    if( print_rank ) printf("rank_U %d %d : %d %d\n", m, n, descY->super.myrank, descY->super.rank_of(&descY->super, m, n ));
+}
+
+/*-----                              END OF U_Init BODY                              -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#endif  /*  defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+static int complete_hook_of_two_dim_band_U_Init(parsec_execution_stream_t *es, __parsec_two_dim_band_U_Init_task_t *this_task)
+{
+  const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp = (__parsec_two_dim_band_internal_taskpool_t *)this_task->taskpool;
+#if defined(DISTRIBUTED)
+    const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+#endif  /* defined(DISTRIBUTED) */
+  (void)es; (void)__parsec_tp;
+parsec_data_t* data_t_desc = NULL; (void)data_t_desc;
+#if defined(DISTRIBUTED)
+  /** If not working on distributed, there is no risk that data is not in place */
+  data_t_desc = data_of_descY(m, n);
+  if( (NULL != this_task->data._f_Y.data_out) && (this_task->data._f_Y.data_out->original != data_t_desc) ) {
+    /* Writting back using remote_type */;
+    parsec_dep_data_description_t data;
+    data.data         = this_task->data._f_Y.data_out;
+    data.local.arena        = NULL;
+    data.local.src_datatype = data.data->dtt;
+    data.local.src_count    = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_datatype = parsec_data_get_copy(data_t_desc, 0)->dtt;
+    data.local.dst_count    = 1;
+    data.local.dst_displ    = 0;
+    data.data_future  = NULL;
+    assert( data.local.src_count > 0 );
+    parsec_remote_dep_memcpy(es,
+                            this_task->taskpool,
+                            parsec_data_get_copy(data_of_descY(m, n), 0),
+                            this_task->data._f_Y.data_out, &data);
+  }
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+  parsec_prof_grapher_data_output((parsec_task_t*)this_task, data_of_descY(m, n), &flow_of_two_dim_band_U_Init_for_Y);
+#endif
+  (void)m;  (void)n;
+
+#endif /* DISTRIBUTED */
+#if defined(PARSEC_PROF_GRAPHER)
+  parsec_prof_grapher_task((parsec_task_t*)this_task, es->th_id, es->virtual_process->vp_id,
+     __jdf2c_key_fns_U_Init.key_hash(this_task->task_class->make_key( (parsec_taskpool_t*)this_task->taskpool, ((parsec_task_t*)this_task)->locals), NULL));
+#endif  /* defined(PARSEC_PROF_GRAPHER) */
+  release_deps_of_two_dim_band_U_Init(es, this_task,
+      PARSEC_ACTION_RELEASE_REMOTE_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_REFS |
+      PARSEC_ACTION_RESHAPE_ON_RELEASE |
+      0x1,  /* mask of all dep_index */ 
+      NULL);
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static parsec_hook_return_t release_task_of_two_dim_band_U_Init(parsec_execution_stream_t *es, parsec_task_t *this_task)
+{
+    const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp =
+        (const __parsec_two_dim_band_internal_taskpool_t *)this_task->taskpool;
+    parsec_hash_table_t *ht = (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[3];
+    parsec_key_t key = this_task->task_class->make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals);
+    parsec_hashable_dependency_t *hash_dep = (parsec_hashable_dependency_t *)parsec_hash_table_remove(ht, key);
+    parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);
+    return parsec_release_task_to_mempool_update_nbtasks(es, this_task);
+}
+
+static char *two_dim_band_two_dim_band_U_Init_internal_init_deps_key_functions_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_two_dim_band_internal_taskpool_t *__parsec_tp = (__parsec_two_dim_band_internal_taskpool_t *)user_data;
+  int m = (__parsec_key) % __parsec_tp->U_Init_m_range + __parsec_tp->U_Init_m_min;
+  __parsec_key = __parsec_key / __parsec_tp->U_Init_m_range;
+  int n = (__parsec_key) % __parsec_tp->U_Init_n_range + __parsec_tp->U_Init_n_min;
+  __parsec_key = __parsec_key / __parsec_tp->U_Init_n_range;
+  snprintf(buffer, buffer_size, "U_Init(%d, %d)", m, n);
+  return buffer;
+}
+
+static parsec_key_fn_t two_dim_band_two_dim_band_U_Init_internal_init_deps_key_functions = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = two_dim_band_two_dim_band_U_Init_internal_init_deps_key_functions_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/* Needs: min-max count-tasks iterate */
+static int two_dim_band_U_Init_internal_init(parsec_execution_stream_t * es, __parsec_two_dim_band_U_Init_task_t * this_task)
+{
+  __parsec_two_dim_band_internal_taskpool_t *__parsec_tp = (__parsec_two_dim_band_internal_taskpool_t*)this_task->taskpool;
+  int32_t nb_tasks = 0, saved_nb_tasks = 0;
+int32_t __m_min = 0x7fffffff, __m_max = 0;int32_t __jdf2c_m_min = 0x7fffffff, __jdf2c_m_max = 0;int32_t __n_min = 0x7fffffff, __n_max = 0;int32_t __jdf2c_n_min = 0x7fffffff, __jdf2c_n_max = 0;  __parsec_two_dim_band_U_Init_parsec_assignment_t assignments = {  .m.value = 0, .n.value = 0 };
+  int32_t  m,  n;
+  int32_t __jdf2c_m_start, __jdf2c_m_end, __jdf2c_m_inc;
+  int32_t __jdf2c_n_start, __jdf2c_n_end, __jdf2c_n_inc;
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+  PARSEC_PROFILING_TRACE(es->es_profile,
+                         this_task->taskpool->profiling_array[START_KEY(this_task->task_class->task_class_id)],
+                         0,
+                         this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    __jdf2c_m_start = 0;
+    __jdf2c_m_end = (descY->lmt - 2);
+    __jdf2c_m_inc = 1;
+    __m_min = parsec_imin(__jdf2c_m_start, __jdf2c_m_end);
+    __m_max = parsec_imax(__jdf2c_m_start, __jdf2c_m_end);
+    __jdf2c_m_min = parsec_imin(__jdf2c_m_min, __m_min);
+    __jdf2c_m_max = parsec_imax(__jdf2c_m_max, __m_max);
+    for(m =  __jdf2c_m_start;
+        m <= __jdf2c_m_end;
+        m += __jdf2c_m_inc) {
+    assignments.m.value = m;
+      __jdf2c_n_start = (m + 1);
+      __jdf2c_n_end = (((uplo) == (matrix_lower)) ? (0) : ((descY->lnt - 1)));
+      __jdf2c_n_inc = 1;
+      __n_min = parsec_imin(__jdf2c_n_start, __jdf2c_n_end);
+      __n_max = parsec_imax(__jdf2c_n_start, __jdf2c_n_end);
+      __jdf2c_n_min = parsec_imin(__jdf2c_n_min, __n_min);
+      __jdf2c_n_max = parsec_imax(__jdf2c_n_max, __n_max);
+      for(n =  __jdf2c_n_start;
+          n <= __jdf2c_n_end;
+          n += __jdf2c_n_inc) {
+      assignments.n.value = n;
+      if( !U_Init_pred(m, n) ) continue;
+      nb_tasks++;
+    } /* Loop on normal range n */
+  } /* For loop of m */ 
+   if( 0 != nb_tasks ) {
+     (void)parsec_atomic_fetch_add_int32(&__parsec_tp->initial_number_tasks, nb_tasks);
+   }
+  /* Set the range variables for the collision-free hash-computation */
+  __parsec_tp->U_Init_m_min   = __jdf2c_m_min;
+  __parsec_tp->U_Init_m_range = (__jdf2c_m_max - __jdf2c_m_min) + 1;
+  __parsec_tp->U_Init_n_min   = __jdf2c_n_min;
+  __parsec_tp->U_Init_n_range = (__jdf2c_n_max - __jdf2c_n_min) + 1;
+  this_task->status = PARSEC_TASK_STATUS_COMPLETE;
+
+  PARSEC_AYU_REGISTER_TASK(&two_dim_band_U_Init);
+  __parsec_tp->super.super.dependencies_array[3] = PARSEC_OBJ_NEW(parsec_hash_table_t);
+  parsec_hash_table_init(__parsec_tp->super.super.dependencies_array[3], offsetof(parsec_hashable_dependency_t, ht_item), 10, two_dim_band_two_dim_band_U_Init_internal_init_deps_key_functions, this_task->taskpool);
+  __parsec_tp->repositories[3] = data_repo_create_nothreadsafe(nb_tasks, __jdf2c_key_fns_U_Init, (parsec_taskpool_t*)__parsec_tp, 2);
+(void)saved_nb_tasks;
+(void)__m_min; (void)__m_max;(void)__n_min; (void)__n_max;  (void)__jdf2c_m_start; (void)__jdf2c_m_end; (void)__jdf2c_m_inc;  (void)__jdf2c_n_start; (void)__jdf2c_n_end; (void)__jdf2c_n_inc;  (void)assignments; (void)__parsec_tp; (void)es;
+  if(1 == parsec_atomic_fetch_dec_int32(&__parsec_tp->sync_point)) {
+    /* Last initialization task complete. Update the number of tasks. */
+    __parsec_tp->super.super.tdm.module->taskpool_addto_nb_tasks(&__parsec_tp->super.super, __parsec_tp->initial_number_tasks);
+    parsec_mfence();  /* write memory barrier to guarantee that the scheduler gets the correct number of tasks */
+    parsec_taskpool_enable((parsec_taskpool_t*)__parsec_tp, &__parsec_tp->startup_queue,
+                           (parsec_task_t*)this_task, es, __parsec_tp->super.super.nb_pending_actions);
+    __parsec_tp->super.super.tdm.module->taskpool_ready(&__parsec_tp->super.super);
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+    PARSEC_PROFILING_TRACE(es->es_profile,
+                           this_task->taskpool->profiling_array[2 * this_task->task_class->task_class_id + 1],
+                           0,
+                           this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    return PARSEC_HOOK_RETURN_DONE;
+  }
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static const __parsec_chore_t __two_dim_band_U_Init_chores[] ={
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+    { .type     = PARSEC_DEV_CPU,
+      .evaluate = (parsec_evaluate_function_t*)NULL,
+      .hook     = (parsec_hook_t*)hook_of_two_dim_band_U_Init },
+#endif  /* defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+    { .type     = PARSEC_DEV_NONE,
+      .evaluate = NULL,
+      .hook     = (parsec_hook_t*)NULL },  /* End marker */
+};
+
+static const parsec_task_class_t two_dim_band_U_Init = {
+  .name = "U_Init",
+  .task_class_id = 3,
+  .nb_flows = 2,
+  .nb_parameters = 2,
+  .nb_locals = 2,
+  .task_class_type = PARSEC_TASK_CLASS_TYPE_PTG,
+  .params = { &symb_two_dim_band_U_Init_m, &symb_two_dim_band_U_Init_n, NULL },
+  .locals = { &symb_two_dim_band_U_Init_m, &symb_two_dim_band_U_Init_n, NULL },
+  .data_affinity = (parsec_data_ref_fn_t*)affinity_of_two_dim_band_U_Init,
+  .initial_data = (parsec_data_ref_fn_t*)affinity_of_two_dim_band_U_Init,
+  .final_data = (parsec_data_ref_fn_t*)affinity_of_two_dim_band_U_Init,
+  .priority = NULL,
+  .properties = properties_of_two_dim_band_U_Init,
+#if MAX_PARAM_COUNT < 1  /* number of read flows of U_Init */
+  #error Too many read flows for task U_Init
+#endif  /* MAX_PARAM_COUNT */
+#if MAX_PARAM_COUNT < 1  /* number of write flows of U_Init */
+  #error Too many write flows for task U_Init
+#endif  /* MAX_PARAM_COUNT */
+  .in = { &flow_of_two_dim_band_U_Init_for_Y, &flow_of_two_dim_band_U_Init_for_ctl, NULL },
+  .out = { &flow_of_two_dim_band_U_Init_for_Y, NULL },
+  .flags = 0x0 | PARSEC_HAS_IN_IN_DEPENDENCIES | PARSEC_USE_DEPS_MASK,
+  .dependencies_goal = 0x3,
+  .make_key = __jdf2c_make_key_U_Init,
+  .task_snprintf = parsec_task_snprintf,
+#if defined(PARSEC_PROF_TRACE)
+  .profile_info = &parsec_task_profile_info,
+#endif
+  .key_functions = &__jdf2c_key_fns_U_Init,
+  .fini = (parsec_hook_t*)NULL,
+  .incarnations = __two_dim_band_U_Init_chores,
+  .find_deps = parsec_hash_find_deps,
+  .update_deps = parsec_update_deps_with_mask,
+  .iterate_successors = (parsec_traverse_function_t*)NULL,
+  .iterate_predecessors = (parsec_traverse_function_t*)iterate_predecessors_of_two_dim_band_U_Init,
+  .release_deps = (parsec_release_deps_t*)release_deps_of_two_dim_band_U_Init,
+  .prepare_output = (parsec_hook_t*)NULL,
+  .prepare_input = (parsec_hook_t*)data_lookup_of_two_dim_band_U_Init,
+  .time_estimate = NULL,
+  .get_datatype = datatype_lookup_of_two_dim_band_U_Init,
+  .complete_execution = (parsec_hook_t*)complete_hook_of_two_dim_band_U_Init,
+  .release_task = &release_task_of_two_dim_band_U_Init,
+#if defined(PARSEC_SIM)
+  .sim_cost_fct = (parsec_sim_cost_fct_t*)NULL,
+#endif
+};
+
+
+/******                                  U_Allocate                                  ******/
+
+static inline int32_t minexpr_of_symb_two_dim_band_U_Allocate_m_fct(const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp, const __parsec_two_dim_band_U_Allocate_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_two_dim_band_U_Allocate_m = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_two_dim_band_U_Allocate_m_fct }
+                   }
+};
+static inline int maxexpr_of_symb_two_dim_band_U_Allocate_m_fct(const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp, const __parsec_two_dim_band_U_Allocate_parsec_assignment_t *locals)
+{
+  const int m = locals->m.value; (void)m;
+  const int n = locals->n.value; (void)n;
+
+  (void)m;
+  (void)n;
+  (void)__parsec_tp; (void)locals;
+  return (descY->lmt - 2);
+}
+static const parsec_expr_t maxexpr_of_symb_two_dim_band_U_Allocate_m = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_two_dim_band_U_Allocate_m_fct }
+                   }
+};
+static const parsec_symbol_t symb_two_dim_band_U_Allocate_m = { .name = "m", .context_index = 0, .min = &minexpr_of_symb_two_dim_band_U_Allocate_m, .max = &maxexpr_of_symb_two_dim_band_U_Allocate_m, .cst_inc = 1, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int minexpr_of_symb_two_dim_band_U_Allocate_n_fct(const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp, const __parsec_two_dim_band_U_Allocate_parsec_assignment_t *locals)
+{
+  const int m = locals->m.value;
+  const int n = locals->n.value; (void)n;
+
+  (void)m;
+  (void)n;
+  (void)__parsec_tp; (void)locals;
+  return (m + 1);
+}
+static const parsec_expr_t minexpr_of_symb_two_dim_band_U_Allocate_n = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_two_dim_band_U_Allocate_n_fct }
+                   }
+};
+static inline int maxexpr_of_symb_two_dim_band_U_Allocate_n_fct(const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp, const __parsec_two_dim_band_U_Allocate_parsec_assignment_t *locals)
+{
+  const int m = locals->m.value; (void)m;
+  const int n = locals->n.value; (void)n;
+
+  (void)m;
+  (void)n;
+  (void)__parsec_tp; (void)locals;
+  return (((uplo) == (matrix_lower)) ? (0) : ((descY->lnt - 1)));
+}
+static const parsec_expr_t maxexpr_of_symb_two_dim_band_U_Allocate_n = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_two_dim_band_U_Allocate_n_fct }
+                   }
+};
+static const parsec_symbol_t symb_two_dim_band_U_Allocate_n = { .name = "n", .context_index = 1, .min = &minexpr_of_symb_two_dim_band_U_Allocate_n, .max = &maxexpr_of_symb_two_dim_band_U_Allocate_n, .cst_inc = 1, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int affinity_of_two_dim_band_U_Allocate(const __parsec_two_dim_band_U_Allocate_task_t *this_task,
+                     parsec_data_ref_t *ref)
+{
+    const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp = (const __parsec_two_dim_band_internal_taskpool_t*)this_task->taskpool;
+  const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+
+  /* Silent Warnings: should look into predicate to know what variables are usefull */
+  (void)m;
+  (void)n;
+  ref->dc = (parsec_data_collection_t *)__parsec_tp->super._g_descY;
+  /* Compute data key */
+  ref->key = ref->dc->data_key(ref->dc, m, n);
+  return 1;
+}
+static const parsec_property_t properties_of_two_dim_band_U_Allocate[1] = {
+  {.name = NULL, .expr = NULL}
+};
+static const parsec_dep_t flow_of_two_dim_band_U_Allocate_for_Y_dep1_atline_99 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = PARSEC_LOCAL_DATA_TASK_CLASS_ID, /* two_dim_band___parsec_null_type */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_two_dim_band_U_Allocate_for_Y,
+};
+static parsec_data_t *flow_of_two_dim_band_U_Allocate_for_Y_dep2_atline_100_direct_access(const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp, const __parsec_two_dim_band_U_Allocate_parsec_assignment_t *assignments)
+{
+  const int m = assignments->m.value; (void)m;
+  const int n = assignments->n.value; (void)n;
+
+  /* Silence Warnings: should look into parameters to know what variables are useful */
+  (void)m;
+  (void)n;
+  if( __parsec_tp->super.super.context->my_rank == (int32_t)rank_of_descY(m, n) )
+    return data_of_descY(m, n);
+  return NULL;
+}
+
+static const parsec_dep_t flow_of_two_dim_band_U_Allocate_for_Y_dep2_atline_100 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = PARSEC_LOCAL_DATA_TASK_CLASS_ID, /* two_dim_band_descY */
+  .direct_data = (parsec_data_lookup_func_t)&flow_of_two_dim_band_U_Allocate_for_Y_dep2_atline_100_direct_access,
+  .flags = PARSEC_DEP_FINAL_WRITE_AS_IS,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_two_dim_band_U_Allocate_for_Y,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+#if MAX_DEP_OUT_COUNT < 1  /* number of output dependencies */
+    #error Too many output dependencies (supports up to MAX_DEP_OUT_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_OUT_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_two_dim_band_U_Allocate_for_Y = {
+  .name               = "Y",
+  .sym_type           = PARSEC_SYM_INOUT,
+  .flow_flags         = PARSEC_FLOW_ACCESS_RW|PARSEC_FLOW_HAS_IN_DEPS,
+  .flow_index         = 0,
+  .flow_datatype_mask = 0x1,
+  .dep_in     = { &flow_of_two_dim_band_U_Allocate_for_Y_dep1_atline_99 },
+  .dep_out    = { &flow_of_two_dim_band_U_Allocate_for_Y_dep2_atline_100 }
+};
+
+static const parsec_dep_t flow_of_two_dim_band_U_Allocate_for_ctl_dep1_atline_102 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 3, /* two_dim_band_U_Init */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_two_dim_band_U_Init_for_ctl,
+  .dep_index = 1,
+  .dep_datatype_index = 1,
+  .belongs_to = &flow_of_two_dim_band_U_Allocate_for_ctl,
+};
+#if MAX_DEP_OUT_COUNT < 1  /* number of output dependencies */
+    #error Too many output dependencies (supports up to MAX_DEP_OUT_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_OUT_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_two_dim_band_U_Allocate_for_ctl = {
+  .name               = "ctl",
+  .sym_type           = PARSEC_SYM_OUT,
+  .flow_flags         = PARSEC_FLOW_ACCESS_NONE,
+  .flow_index         = 1,
+  .flow_datatype_mask = 0x2,
+  .dep_in     = { NULL },
+  .dep_out    = { &flow_of_two_dim_band_U_Allocate_for_ctl_dep1_atline_102 }
+};
+
+static void
+iterate_successors_of_two_dim_band_U_Allocate(parsec_execution_stream_t *es, const __parsec_two_dim_band_U_Allocate_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp = (const __parsec_two_dim_band_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_two_dim_band_U_Allocate_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_two_dim_band_U_Allocate_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int m = __jdf2c__tmp_locals.m.value; (void)m;
+  const int n = __jdf2c__tmp_locals.n.value; (void)n;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)m;  (void)n;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_descY(m, n);
+#endif
+  /* Flow of data Y has only OUTPUT dependencies to Memory */
+  if( action_mask & 0x2 ) {  /* Flow of data ctl [1] */
+    data.data   = this_task->data._f_ctl.data_out;
+    data.data_future  = NULL;
+    if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  =   /* Control: always empty */ 0;
+    data.local.dst_count  =   /* Control: always empty */ 0;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = NULL;
+    data.remote.src_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.src_count  =   /* Control: always empty */ 0;
+    data.remote.dst_count  =   /* Control: always empty */ 0;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+       __parsec_two_dim_band_U_Init_task_t* ncc = (__parsec_two_dim_band_U_Init_task_t*)&nc;
+    nc.task_class = __parsec_tp->super.super.task_classes_array[two_dim_band_U_Init.task_class_id];
+      const int U_Init_m = m;
+      if( (U_Init_m >= (0)) && (U_Init_m <= ((descY->lmt - 2))) ) {
+        assert(&nc.locals[0].value == &ncc->locals.m.value);
+        ncc->locals.m.value = U_Init_m;
+        const int U_Init_n = n;
+        if( (U_Init_n >= ((ncc->locals.m.value + 1))) && (U_Init_n <= ((((uplo) == (matrix_lower)) ? (0) : ((descY->lnt - 1))))) ) {
+          assert(&nc.locals[1].value == &ncc->locals.n.value);
+          ncc->locals.n.value = U_Init_n;
+#if defined(DISTRIBUTED)
+          rank_dst = rank_of_descY(ncc->locals.m.value, ncc->locals.n.value);
+          if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+            vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descY)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descY, ncc->locals.m.value, ncc->locals.n.value);
+          nc.priority = __parsec_tp->super.super.priority;
+          successor_repo = U_Init_repo;
+          successor_repo_key = __jdf2c_make_key_U_Init((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+        RELEASE_DEP_OUTPUT(es, "ctl", this_task, "ctl", &nc, rank_src, rank_dst, &data);
+        if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_two_dim_band_U_Allocate_for_ctl_dep1_atline_102, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+          }
+        }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static int release_deps_of_two_dim_band_U_Allocate(parsec_execution_stream_t *es, __parsec_two_dim_band_U_Allocate_task_t *this_task, uint32_t action_mask, parsec_remote_deps_t *deps)
+{
+  PARSEC_PINS(es, RELEASE_DEPS_BEGIN, (parsec_task_t *)this_task);  const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp = (const __parsec_two_dim_band_internal_taskpool_t *)this_task->taskpool;
+  parsec_release_dep_fct_arg_t arg;
+  int __vp_id;
+  int consume_local_repo = 0;
+  arg.action_mask = action_mask;
+  arg.output_entry = NULL;
+  arg.output_repo = NULL;
+#if defined(DISTRIBUTED)
+  arg.remote_deps = deps;
+#endif  /* defined(DISTRIBUTED) */
+  assert(NULL != es);
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS )    arg.ready_lists = alloca(sizeof(parsec_task_t *) * es->virtual_process->parsec_context->nb_vp);
+  else
+    arg.ready_lists = NULL;
+  for( __vp_id = 0; __vp_id < es->virtual_process->parsec_context->nb_vp; arg.ready_lists[__vp_id++] = NULL );
+  (void)__parsec_tp; (void)deps;
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_Y.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_Y.source_repo, this_task->data._f_Y.source_repo_entry->ht_item.key );
+    }
+  }
+  consume_local_repo = (this_task->repo_entry != NULL);
+  arg.output_repo = U_Allocate_repo;
+  arg.output_entry = this_task->repo_entry;
+  arg.output_usage = 0;
+  if( action_mask & (PARSEC_ACTION_RELEASE_LOCAL_DEPS | PARSEC_ACTION_GET_REPO_ENTRY) ) {
+    arg.output_entry = data_repo_lookup_entry_and_create( es, arg.output_repo, __jdf2c_make_key_U_Allocate((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    arg.output_entry->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(arg.output_entry->sim_exec_date == 0);
+    arg.output_entry->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  if(action_mask & ( PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE ) ){
+    /* Generate the reshape promise for the outputs that need it */
+    iterate_successors_of_two_dim_band_U_Allocate(es, this_task, action_mask, parsec_set_up_reshape_promise, &arg);
+   }
+  iterate_successors_of_two_dim_band_U_Allocate(es, this_task, action_mask, parsec_release_dep_fct, &arg);
+
+#if defined(DISTRIBUTED)
+  if( (action_mask & PARSEC_ACTION_SEND_REMOTE_DEPS) && (NULL != arg.remote_deps)) {
+    parsec_remote_dep_activate(es, (parsec_task_t *)this_task, arg.remote_deps, arg.remote_deps->outgoing_mask);
+  }
+#endif
+
+  if(action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS) {
+    data_repo_entry_addto_usage_limit(U_Allocate_repo, arg.output_entry->ht_item.key, arg.output_usage);
+    __parsec_schedule_vp(es, arg.ready_lists, 0);
+  }
+      if (consume_local_repo) {
+         data_repo_entry_used_once( U_Allocate_repo, this_task->repo_entry->ht_item.key );
+      }
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_Y.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_Y.data_in);
+    }
+  }
+  PARSEC_PINS(es, RELEASE_DEPS_END, (parsec_task_t *)this_task);  return 0;
+}
+
+static int data_lookup_of_two_dim_band_U_Allocate(parsec_execution_stream_t *es, __parsec_two_dim_band_U_Allocate_task_t *this_task)
+{
+  const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp = (__parsec_two_dim_band_internal_taskpool_t *)this_task->taskpool;
+  parsec_assignment_t generic_locals[MAX_PARAM_COUNT];  /* generic task locals */
+  int target_device = 0; (void)target_device;
+  (void)__parsec_tp; (void)generic_locals; (void)es;
+  parsec_data_copy_t *chunk = NULL;
+  data_repo_t        *reshape_repo  = NULL, *consumed_repo  = NULL;
+  data_repo_entry_t  *reshape_entry = NULL, *consumed_entry = NULL;
+  parsec_key_t        reshape_entry_key = 0, consumed_entry_key = 0;
+  uint8_t             consumed_flow_index;
+  parsec_dep_data_description_t data;
+  int ret;
+  (void)reshape_repo; (void)reshape_entry; (void)reshape_entry_key;
+  (void)consumed_repo; (void)consumed_entry; (void)consumed_entry_key;
+  (void)consumed_flow_index;
+  (void)chunk; (void)data; (void)ret;
+  const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+  if( NULL == this_task->repo_entry ){
+    this_task->repo_entry = data_repo_lookup_entry_and_create(es, U_Allocate_repo,                                       __jdf2c_make_key_U_Allocate((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    data_repo_entry_addto_usage_limit(U_Allocate_repo, this_task->repo_entry->ht_item.key, 1);    this_task->repo_entry ->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(this_task->repo_entry ->sim_exec_date == 0);
+    this_task->repo_entry ->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  /* The reshape repo is the current task repo. */  reshape_repo = U_Allocate_repo;
+  reshape_entry_key = __jdf2c_make_key_U_Allocate((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals) ;
+  reshape_entry = this_task->repo_entry;
+  /* Lookup the input data, and store them in the context if any */
+
+if(! this_task->data._f_Y.fulfill ){ /* Flow Y */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_Y.data_out = NULL;  /* By default, if nothing matches */
+  /* Flow Y [0] dependency [0] from memory NEW or NULL data */
+  if( NULL == (chunk = this_task->data._f_Y.data_in) ) {
+  /* No data set up by predecessor on this task input flow */
+  } 
+    this_task->data._f_Y.data_in     = chunk;
+    this_task->data._f_Y.source_repo       = consumed_repo;
+    this_task->data._f_Y.source_repo_entry = consumed_entry;
+    if( this_task->data._f_Y.source_repo_entry == this_task->repo_entry ){
+      /* in case we have consume from this task repo entry for the flow,
+       * it is cleaned up, avoiding having old stuff during release_deps_of
+       */
+      this_task->repo_entry->data[0] = NULL;
+    }
+    this_task->data._f_Y.fulfill = 1;
+}
+
+  /* ctl is a control flow */
+  this_task->data._f_ctl.data_in         = NULL;
+  this_task->data._f_ctl.data_out        = NULL;
+  this_task->data._f_ctl.source_repo       = NULL;
+  this_task->data._f_ctl.source_repo_entry = NULL;
+  /** Generate profiling information */
+#if defined(PARSEC_PROF_TRACE)
+  this_task->prof_info.desc = (parsec_data_collection_t*)__parsec_tp->super._g_descY;
+  this_task->prof_info.priority = this_task->priority;
+  this_task->prof_info.data_id   = ((parsec_data_collection_t*)__parsec_tp->super._g_descY)->data_key((parsec_data_collection_t*)__parsec_tp->super._g_descY, m, n);
+  this_task->prof_info.task_class_id = this_task->task_class->task_class_id;
+  this_task->prof_info.task_return_code = -1;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int datatype_lookup_of_two_dim_band_U_Allocate(parsec_execution_stream_t *es, const parsec_task_t *this_generic_task, const parsec_task_t *parent_task,
+              uint32_t* flow_mask, parsec_dep_data_description_t* data)
+{
+  const __parsec_two_dim_band_U_Allocate_task_t *this_task = (__parsec_two_dim_band_U_Allocate_task_t*)this_generic_task;
+  const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp = (__parsec_two_dim_band_internal_taskpool_t *)this_task->taskpool;
+  (void)__parsec_tp; (void)es; (void)this_task; (void)data; (void)parent_task;
+  const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+  data->local.arena = data->remote.arena = NULL;
+  data->local.src_datatype  = data->local.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->local.src_count     = data->local.dst_count = 0;
+  data->local.src_displ     = data->local.dst_displ = 0;
+  data->data_future  = NULL;
+  if( (*flow_mask) & 0x80000000U ) { /* these are the input dependencies remote datatypes  */
+if( (*flow_mask) & 0x1U ) {  /* Flow Y */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_two_dim_band_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_two_dim_band_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_two_dim_band_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+    goto no_mask_match;
+  }
+
+  /* these are the output dependencies remote datatypes */
+if( (*flow_mask) & 0x1U ) {  /* Flow Y */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_two_dim_band_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_two_dim_band_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_two_dim_band_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+ no_mask_match:
+  data->data                             = NULL;
+  data->remote.src_datatype = data->remote.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->remote.src_count    = data->remote.dst_count = 0;
+  data->remote.src_displ    = data->remote.dst_displ = 0;
+  data->data_future  = NULL;
+  (*flow_mask) = 0;  /* nothing left */
+  (void)m;  (void)n;
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+static int hook_of_two_dim_band_U_Allocate(parsec_execution_stream_t *es, __parsec_two_dim_band_U_Allocate_task_t *this_task)
+{
+  __parsec_two_dim_band_internal_taskpool_t *__parsec_tp = (__parsec_two_dim_band_internal_taskpool_t *)this_task->taskpool;
+  (void)es; (void)__parsec_tp;
+  const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+  (void)m;  (void)n;
+
+  /** Declare the variables that will hold the data, and all the accounting for each */
+  parsec_data_copy_t *_f_Y = this_task->data._f_Y.data_in;
+  void *Y = PARSEC_DATA_COPY_GET_PTR(_f_Y); (void)Y;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    data_repo_entry_t *eY = this_task->data._f_Y.source_repo_entry;
+    if( (NULL != eY) && (eY->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eY->sim_exec_date;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+    if ( NULL != _f_Y ) {
+#if defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) || defined(PARSEC_HAVE_DEV_HIP_SUPPORT)
+      parsec_data_transfer_ownership_to_copy( _f_Y->original, 0 /* device */,
+                                           PARSEC_FLOW_ACCESS_RW);
+#endif  /* defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) || defined(PARSEC_HAVE_DEV_HIP_SUPPORT) */
+      _f_Y->version++;  /* Y */
+#if defined(PARSEC_DEBUG_NOISIER)
+      char tmp[128];
+      PARSEC_DEBUG_VERBOSE(10, parsec_debug_output,
+                           "Body of %s: change Data copy %p to version %d",
+                           parsec_task_snprintf(tmp, 128, (parsec_task_t*)(this_task)),
+                           _f_Y, _f_Y->version);
+#endif /* defined(PARSEC_DEBUG_NOISIER) */
+    }
+  /** Cache Awareness Accounting */
+#if defined(PARSEC_CACHE_AWARENESS)
+  cache_buf_referenced(es->closest_cache, Y);
+#endif /* PARSEC_CACHE_AWARENESS */
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                                U_Allocate BODY                                -----*/
+
+{
+    int size = descY->bsiz * sizeof(double);   /* Could be changed flexibly */
+    this_task->data._f_Y.data_out = parsec_data_copy_new(data_of_descY(m, n), 0,
+                                                         PARSEC_two_dim_band_DEFAULT_ADT->opaque_dtt,
+                                                         PARSEC_DATA_FLAG_PARSEC_MANAGED);
+    this_task->data._f_Y.data_out->device_private = malloc(size);
+}
+
+/*-----                            END OF U_Allocate BODY                            -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#endif  /*  defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+static int complete_hook_of_two_dim_band_U_Allocate(parsec_execution_stream_t *es, __parsec_two_dim_band_U_Allocate_task_t *this_task)
+{
+  const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp = (__parsec_two_dim_band_internal_taskpool_t *)this_task->taskpool;
+#if defined(DISTRIBUTED)
+    const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+#endif  /* defined(DISTRIBUTED) */
+  (void)es; (void)__parsec_tp;
+parsec_data_t* data_t_desc = NULL; (void)data_t_desc;
+#if defined(DISTRIBUTED)
+  /** If not working on distributed, there is no risk that data is not in place */
+  data_t_desc = data_of_descY(m, n);
+  if( (NULL != this_task->data._f_Y.data_out) && (this_task->data._f_Y.data_out->original != data_t_desc) ) {
+    /* Writting back using remote_type */;
+    parsec_dep_data_description_t data;
+    data.data         = this_task->data._f_Y.data_out;
+    data.local.arena        = NULL;
+    data.local.src_datatype = data.data->dtt;
+    data.local.src_count    = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_datatype = parsec_data_get_copy(data_t_desc, 0)->dtt;
+    data.local.dst_count    = 1;
+    data.local.dst_displ    = 0;
+    data.data_future  = NULL;
+    assert( data.local.src_count > 0 );
+    parsec_remote_dep_memcpy(es,
+                            this_task->taskpool,
+                            parsec_data_get_copy(data_of_descY(m, n), 0),
+                            this_task->data._f_Y.data_out, &data);
+  }
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+  parsec_prof_grapher_data_output((parsec_task_t*)this_task, data_of_descY(m, n), &flow_of_two_dim_band_U_Allocate_for_Y);
+#endif
+  (void)m;  (void)n;
+
+#endif /* DISTRIBUTED */
+#if defined(PARSEC_PROF_GRAPHER)
+  parsec_prof_grapher_task((parsec_task_t*)this_task, es->th_id, es->virtual_process->vp_id,
+     __jdf2c_key_fns_U_Allocate.key_hash(this_task->task_class->make_key( (parsec_taskpool_t*)this_task->taskpool, ((parsec_task_t*)this_task)->locals), NULL));
+#endif  /* defined(PARSEC_PROF_GRAPHER) */
+  release_deps_of_two_dim_band_U_Allocate(es, this_task,
+      PARSEC_ACTION_RELEASE_REMOTE_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_REFS |
+      PARSEC_ACTION_RESHAPE_ON_RELEASE |
+      0x3,  /* mask of all dep_index */ 
+      NULL);
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static parsec_hook_return_t release_task_of_two_dim_band_U_Allocate(parsec_execution_stream_t *es, parsec_task_t *this_task)
+{
+    const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp =
+        (const __parsec_two_dim_band_internal_taskpool_t *)this_task->taskpool;
+    parsec_hash_table_t *ht = (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[2];
+    parsec_key_t key = this_task->task_class->make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals);
+    parsec_hashable_dependency_t *hash_dep = (parsec_hashable_dependency_t *)parsec_hash_table_remove(ht, key);
+    parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);
+    return parsec_release_task_to_mempool_update_nbtasks(es, this_task);
+}
+
+static char *two_dim_band_two_dim_band_U_Allocate_internal_init_deps_key_functions_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_two_dim_band_internal_taskpool_t *__parsec_tp = (__parsec_two_dim_band_internal_taskpool_t *)user_data;
+  int m = (__parsec_key) % __parsec_tp->U_Allocate_m_range + __parsec_tp->U_Allocate_m_min;
+  __parsec_key = __parsec_key / __parsec_tp->U_Allocate_m_range;
+  int n = (__parsec_key) % __parsec_tp->U_Allocate_n_range + __parsec_tp->U_Allocate_n_min;
+  __parsec_key = __parsec_key / __parsec_tp->U_Allocate_n_range;
+  snprintf(buffer, buffer_size, "U_Allocate(%d, %d)", m, n);
+  return buffer;
+}
+
+static parsec_key_fn_t two_dim_band_two_dim_band_U_Allocate_internal_init_deps_key_functions = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = two_dim_band_two_dim_band_U_Allocate_internal_init_deps_key_functions_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/* Needs: min-max count-tasks iterate */
+static int two_dim_band_U_Allocate_internal_init(parsec_execution_stream_t * es, __parsec_two_dim_band_U_Allocate_task_t * this_task)
+{
+  __parsec_two_dim_band_internal_taskpool_t *__parsec_tp = (__parsec_two_dim_band_internal_taskpool_t*)this_task->taskpool;
+  int32_t nb_tasks = 0, saved_nb_tasks = 0;
+int32_t __m_min = 0x7fffffff, __m_max = 0;int32_t __jdf2c_m_min = 0x7fffffff, __jdf2c_m_max = 0;int32_t __n_min = 0x7fffffff, __n_max = 0;int32_t __jdf2c_n_min = 0x7fffffff, __jdf2c_n_max = 0;  __parsec_two_dim_band_U_Allocate_parsec_assignment_t assignments = {  .m.value = 0, .n.value = 0 };
+  int32_t  m,  n;
+  int32_t __jdf2c_m_start, __jdf2c_m_end, __jdf2c_m_inc;
+  int32_t __jdf2c_n_start, __jdf2c_n_end, __jdf2c_n_inc;
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+  PARSEC_PROFILING_TRACE(es->es_profile,
+                         this_task->taskpool->profiling_array[START_KEY(this_task->task_class->task_class_id)],
+                         0,
+                         this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    __jdf2c_m_start = 0;
+    __jdf2c_m_end = (descY->lmt - 2);
+    __jdf2c_m_inc = 1;
+    __m_min = parsec_imin(__jdf2c_m_start, __jdf2c_m_end);
+    __m_max = parsec_imax(__jdf2c_m_start, __jdf2c_m_end);
+    __jdf2c_m_min = parsec_imin(__jdf2c_m_min, __m_min);
+    __jdf2c_m_max = parsec_imax(__jdf2c_m_max, __m_max);
+    for(m =  __jdf2c_m_start;
+        m <= __jdf2c_m_end;
+        m += __jdf2c_m_inc) {
+    assignments.m.value = m;
+      __jdf2c_n_start = (m + 1);
+      __jdf2c_n_end = (((uplo) == (matrix_lower)) ? (0) : ((descY->lnt - 1)));
+      __jdf2c_n_inc = 1;
+      __n_min = parsec_imin(__jdf2c_n_start, __jdf2c_n_end);
+      __n_max = parsec_imax(__jdf2c_n_start, __jdf2c_n_end);
+      __jdf2c_n_min = parsec_imin(__jdf2c_n_min, __n_min);
+      __jdf2c_n_max = parsec_imax(__jdf2c_n_max, __n_max);
+      for(n =  __jdf2c_n_start;
+          n <= __jdf2c_n_end;
+          n += __jdf2c_n_inc) {
+      assignments.n.value = n;
+      if( !U_Allocate_pred(m, n) ) continue;
+      nb_tasks++;
+    } /* Loop on normal range n */
+  } /* For loop of m */ 
+   if( 0 != nb_tasks ) {
+     (void)parsec_atomic_fetch_add_int32(&__parsec_tp->initial_number_tasks, nb_tasks);
+   }
+  /* Set the range variables for the collision-free hash-computation */
+  __parsec_tp->U_Allocate_m_min   = __jdf2c_m_min;
+  __parsec_tp->U_Allocate_m_range = (__jdf2c_m_max - __jdf2c_m_min) + 1;
+  __parsec_tp->U_Allocate_n_min   = __jdf2c_n_min;
+  __parsec_tp->U_Allocate_n_range = (__jdf2c_n_max - __jdf2c_n_min) + 1;
+    do {
+      this_task->super.list_next = (parsec_list_item_t*)__parsec_tp->startup_queue;
+    } while(!parsec_atomic_cas_ptr(&__parsec_tp->startup_queue, (parsec_list_item_t*)this_task->super.list_next, this_task));
+    this_task->status = PARSEC_TASK_STATUS_HOOK;
+
+  PARSEC_AYU_REGISTER_TASK(&two_dim_band_U_Allocate);
+  __parsec_tp->super.super.dependencies_array[2] = PARSEC_OBJ_NEW(parsec_hash_table_t);
+  parsec_hash_table_init(__parsec_tp->super.super.dependencies_array[2], offsetof(parsec_hashable_dependency_t, ht_item), 10, two_dim_band_two_dim_band_U_Allocate_internal_init_deps_key_functions, this_task->taskpool);
+  __parsec_tp->repositories[2] = data_repo_create_nothreadsafe(nb_tasks, __jdf2c_key_fns_U_Allocate, (parsec_taskpool_t*)__parsec_tp, 2);
+(void)saved_nb_tasks;
+(void)__m_min; (void)__m_max;(void)__n_min; (void)__n_max;  (void)__jdf2c_m_start; (void)__jdf2c_m_end; (void)__jdf2c_m_inc;  (void)__jdf2c_n_start; (void)__jdf2c_n_end; (void)__jdf2c_n_inc;  (void)assignments; (void)__parsec_tp; (void)es;
+  if(1 == parsec_atomic_fetch_dec_int32(&__parsec_tp->sync_point)) {
+    /* Last initialization task complete. Update the number of tasks. */
+    __parsec_tp->super.super.tdm.module->taskpool_addto_nb_tasks(&__parsec_tp->super.super, __parsec_tp->initial_number_tasks);
+    parsec_mfence();  /* write memory barrier to guarantee that the scheduler gets the correct number of tasks */
+    parsec_taskpool_enable((parsec_taskpool_t*)__parsec_tp, &__parsec_tp->startup_queue,
+                           (parsec_task_t*)this_task, es, __parsec_tp->super.super.nb_pending_actions);
+    __parsec_tp->super.super.tdm.module->taskpool_ready(&__parsec_tp->super.super);
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+    PARSEC_PROFILING_TRACE(es->es_profile,
+                           this_task->taskpool->profiling_array[2 * this_task->task_class->task_class_id + 1],
+                           0,
+                           this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    if( 1 >= __parsec_tp->super.super.nb_pending_actions ) {
+        /* if no tasks will be generated let's prevent the runtime from calling the hook and instead go directly to complete the task */
+        this_task->status = PARSEC_TASK_STATUS_COMPLETE;
+    }
+    return PARSEC_HOOK_RETURN_DONE;
+  }
+  return PARSEC_HOOK_RETURN_ASYNC;
+}
+
+static int __jdf2c_startup_U_Allocate(parsec_execution_stream_t * es, __parsec_two_dim_band_U_Allocate_task_t *this_task)
+{
+  __parsec_two_dim_band_U_Allocate_task_t* new_task;
+  __parsec_two_dim_band_internal_taskpool_t* __parsec_tp = (__parsec_two_dim_band_internal_taskpool_t*)this_task->taskpool;
+  parsec_context_t *context = __parsec_tp->super.super.context;
+  int vpid = 0, nb_tasks = 0;
+  size_t total_nb_tasks = 0;
+  parsec_list_item_t* pready_ring[context->nb_vp];
+  int restore_context = 0;
+  int m = this_task->locals.m.value;  /* retrieve value saved during the last iteration */
+  int n = this_task->locals.n.value;  /* retrieve value saved during the last iteration */
+  for(int _i = 0; _i < context->nb_vp; pready_ring[_i++] = NULL );
+  if( 0 != this_task->locals.reserved[0].value ) {
+    this_task->locals.reserved[0].value = 1; /* reset the submission process */
+    restore_context = 1;
+    goto restore_context_0;
+  }
+  this_task->locals.reserved[0].value = 1; /* a sane default value */
+  for(this_task->locals.m.value = m = 0;
+      this_task->locals.m.value <= (descY->lmt - 2);
+      this_task->locals.m.value += 1, m = this_task->locals.m.value) {
+    for(this_task->locals.n.value = n = (m + 1);
+        this_task->locals.n.value <= (((uplo) == (matrix_lower)) ? (0) : ((descY->lnt - 1)));
+        this_task->locals.n.value += 1, n = this_task->locals.n.value) {
+      if( !U_Allocate_pred(m, n) ) continue;
+  __parsec_two_dim_band_U_Allocate_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_two_dim_band_U_Allocate_parsec_assignment_t*)&this_task->locals;
+  (void)__jdf2c__tmp_locals;
+  /* Flow for Y is always a memory reference */
+      if( NULL != ((parsec_data_collection_t*)__parsec_tp->super._g_descY)->vpid_of ) {
+        vpid = ((parsec_data_collection_t*)__parsec_tp->super._g_descY)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descY, m, n);
+        assert(context->nb_vp >= vpid);
+      } else {
+        vpid = (vpid + 1) % context->nb_vp;  /* spread the initial joy */
+      }
+      new_task = (__parsec_two_dim_band_U_Allocate_task_t*)parsec_thread_mempool_allocate( context->virtual_processes[vpid]->execution_streams[0]->context_mempool );
+      PARSEC_OBJ_CONSTRUCT(new_task, parsec_task_t); /* construct called only when new, force-construct it again */
+      /* Copy only the valid elements from this_task to new_task one */
+      new_task->taskpool   = this_task->taskpool;
+      new_task->task_class = __parsec_tp->super.super.task_classes_array[two_dim_band_U_Allocate.task_class_id];
+      new_task->chore_mask   = PARSEC_DEV_ALL;
+      new_task->locals.m.value = this_task->locals.m.value;
+      new_task->locals.n.value = this_task->locals.n.value;
+      PARSEC_LIST_ITEM_SINGLETON(new_task);
+      new_task->priority = __parsec_tp->super.super.priority;
+      new_task->repo_entry = NULL;
+      new_task->data._f_Y.source_repo_entry = NULL;
+      new_task->data._f_Y.source_repo       = NULL;
+      new_task->data._f_Y.data_in         = NULL;
+      new_task->data._f_Y.data_out        = NULL;
+      new_task->data._f_Y.fulfill         = 0;
+      new_task->data._f_ctl.source_repo_entry = NULL;
+      new_task->data._f_ctl.source_repo       = NULL;
+      new_task->data._f_ctl.data_in         = NULL;
+      new_task->data._f_ctl.data_out        = NULL;
+      new_task->data._f_ctl.fulfill         = 0;
+#if defined(PARSEC_DEBUG_NOISIER)
+      {
+        char tmp[128];
+        PARSEC_DEBUG_VERBOSE(10, parsec_debug_output, "Add startup task %s to vpid %d",
+               parsec_task_snprintf(tmp, 128, (parsec_task_t*)new_task), vpid);
+      }
+#endif
+      parsec_dependencies_mark_task_as_startup((parsec_task_t*)new_task, es);
+      pready_ring[vpid] = parsec_list_item_ring_push_sorted(pready_ring[vpid],
+                                                            (parsec_list_item_t*)new_task,
+                                                            parsec_execution_context_priority_comparator);
+      nb_tasks++;
+     restore_context_0:  /* we jump here just so that we have code after the label */
+      restore_context = 0;
+      (void)restore_context;
+      if( nb_tasks > this_task->locals.reserved[0].value ) {
+        if( (size_t)this_task->locals.reserved[0].value < parsec_task_startup_iter ) this_task->locals.reserved[0].value <<= 1;
+        __parsec_schedule_vp(es, (parsec_task_t**)pready_ring, 0);
+        total_nb_tasks += nb_tasks;
+        nb_tasks = 0;
+        if( total_nb_tasks > parsec_task_startup_chunk ) {  /* stop here and request to be rescheduled */
+          return PARSEC_HOOK_RETURN_AGAIN;
+        }
+      }
+    } /* Loop on normal range n */
+  } /* Loop on normal range m */
+  (void)vpid;
+  if( 0 != nb_tasks ) {
+    __parsec_schedule_vp(es, (parsec_task_t**)pready_ring, 0);
+    nb_tasks = 0;
+  }
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static const __parsec_chore_t __two_dim_band_U_Allocate_chores[] ={
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+    { .type     = PARSEC_DEV_CPU,
+      .evaluate = (parsec_evaluate_function_t*)NULL,
+      .hook     = (parsec_hook_t*)hook_of_two_dim_band_U_Allocate },
+#endif  /* defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+    { .type     = PARSEC_DEV_NONE,
+      .evaluate = NULL,
+      .hook     = (parsec_hook_t*)NULL },  /* End marker */
+};
+
+static const parsec_task_class_t two_dim_band_U_Allocate = {
+  .name = "U_Allocate",
+  .task_class_id = 2,
+  .nb_flows = 2,
+  .nb_parameters = 2,
+  .nb_locals = 2,
+  .task_class_type = PARSEC_TASK_CLASS_TYPE_PTG,
+  .params = { &symb_two_dim_band_U_Allocate_m, &symb_two_dim_band_U_Allocate_n, NULL },
+  .locals = { &symb_two_dim_band_U_Allocate_m, &symb_two_dim_band_U_Allocate_n, NULL },
+  .data_affinity = (parsec_data_ref_fn_t*)affinity_of_two_dim_band_U_Allocate,
+  .initial_data = (parsec_data_ref_fn_t*)affinity_of_two_dim_band_U_Allocate,
+  .final_data = (parsec_data_ref_fn_t*)affinity_of_two_dim_band_U_Allocate,
+  .priority = NULL,
+  .properties = properties_of_two_dim_band_U_Allocate,
+#if MAX_PARAM_COUNT < 1  /* number of read flows of U_Allocate */
+  #error Too many read flows for task U_Allocate
+#endif  /* MAX_PARAM_COUNT */
+#if MAX_PARAM_COUNT < 1  /* number of write flows of U_Allocate */
+  #error Too many write flows for task U_Allocate
+#endif  /* MAX_PARAM_COUNT */
+  .in = { &flow_of_two_dim_band_U_Allocate_for_Y, NULL },
+  .out = { &flow_of_two_dim_band_U_Allocate_for_Y, &flow_of_two_dim_band_U_Allocate_for_ctl, NULL },
+  .flags = 0x0 | PARSEC_HAS_IN_IN_DEPENDENCIES | PARSEC_USE_DEPS_MASK,
+  .dependencies_goal = 0x1,
+  .make_key = __jdf2c_make_key_U_Allocate,
+  .task_snprintf = parsec_task_snprintf,
+#if defined(PARSEC_PROF_TRACE)
+  .profile_info = &parsec_task_profile_info,
+#endif
+  .key_functions = &__jdf2c_key_fns_U_Allocate,
+  .fini = (parsec_hook_t*)NULL,
+  .incarnations = __two_dim_band_U_Allocate_chores,
+  .find_deps = parsec_hash_find_deps,
+  .update_deps = parsec_update_deps_with_mask,
+  .iterate_successors = (parsec_traverse_function_t*)iterate_successors_of_two_dim_band_U_Allocate,
+  .iterate_predecessors = (parsec_traverse_function_t*)NULL,
+  .release_deps = (parsec_release_deps_t*)release_deps_of_two_dim_band_U_Allocate,
+  .prepare_output = (parsec_hook_t*)NULL,
+  .prepare_input = (parsec_hook_t*)data_lookup_of_two_dim_band_U_Allocate,
+  .time_estimate = NULL,
+  .get_datatype = datatype_lookup_of_two_dim_band_U_Allocate,
+  .complete_execution = (parsec_hook_t*)complete_hook_of_two_dim_band_U_Allocate,
+  .release_task = &release_task_of_two_dim_band_U_Allocate,
+#if defined(PARSEC_SIM)
+  .sim_cost_fct = (parsec_sim_cost_fct_t*)NULL,
+#endif
+};
+
+
+/******                                    L_Init                                    ******/
+
+static inline int32_t minexpr_of_symb_two_dim_band_L_Init_m_fct(const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp, const __parsec_two_dim_band_L_Init_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 1;
+}
+static const parsec_expr_t minexpr_of_symb_two_dim_band_L_Init_m = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_two_dim_band_L_Init_m_fct }
+                   }
+};
+static inline int maxexpr_of_symb_two_dim_band_L_Init_m_fct(const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp, const __parsec_two_dim_band_L_Init_parsec_assignment_t *locals)
+{
+  const int m = locals->m.value; (void)m;
+  const int n = locals->n.value; (void)n;
+
+  (void)m;
+  (void)n;
+  (void)__parsec_tp; (void)locals;
+  return (((uplo) == (matrix_upper)) ? (0) : ((descY->lmt - 1)));
+}
+static const parsec_expr_t maxexpr_of_symb_two_dim_band_L_Init_m = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_two_dim_band_L_Init_m_fct }
+                   }
+};
+static const parsec_symbol_t symb_two_dim_band_L_Init_m = { .name = "m", .context_index = 0, .min = &minexpr_of_symb_two_dim_band_L_Init_m, .max = &maxexpr_of_symb_two_dim_band_L_Init_m, .cst_inc = 1, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t minexpr_of_symb_two_dim_band_L_Init_n_fct(const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp, const __parsec_two_dim_band_L_Init_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_two_dim_band_L_Init_n = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_two_dim_band_L_Init_n_fct }
+                   }
+};
+static inline int maxexpr_of_symb_two_dim_band_L_Init_n_fct(const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp, const __parsec_two_dim_band_L_Init_parsec_assignment_t *locals)
+{
+  const int m = locals->m.value;
+  const int n = locals->n.value; (void)n;
+
+  (void)m;
+  (void)n;
+  (void)__parsec_tp; (void)locals;
+  return (m - 1);
+}
+static const parsec_expr_t maxexpr_of_symb_two_dim_band_L_Init_n = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_two_dim_band_L_Init_n_fct }
+                   }
+};
+static const parsec_symbol_t symb_two_dim_band_L_Init_n = { .name = "n", .context_index = 1, .min = &minexpr_of_symb_two_dim_band_L_Init_n, .max = &maxexpr_of_symb_two_dim_band_L_Init_n, .cst_inc = 1, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int affinity_of_two_dim_band_L_Init(const __parsec_two_dim_band_L_Init_task_t *this_task,
+                     parsec_data_ref_t *ref)
+{
+    const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp = (const __parsec_two_dim_band_internal_taskpool_t*)this_task->taskpool;
+  const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+
+  /* Silent Warnings: should look into predicate to know what variables are usefull */
+  (void)m;
+  (void)n;
+  ref->dc = (parsec_data_collection_t *)__parsec_tp->super._g_descY;
+  /* Compute data key */
+  ref->key = ref->dc->data_key(ref->dc, m, n);
+  return 1;
+}
+static const parsec_property_t properties_of_two_dim_band_L_Init[1] = {
+  {.name = NULL, .expr = NULL}
+};
+static parsec_data_t *flow_of_two_dim_band_L_Init_for_Y_dep1_atline_74_direct_access(const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp, const __parsec_two_dim_band_L_Init_parsec_assignment_t *assignments)
+{
+  const int m = assignments->m.value; (void)m;
+  const int n = assignments->n.value; (void)n;
+
+  /* Silence Warnings: should look into parameters to know what variables are useful */
+  (void)m;
+  (void)n;
+  if( __parsec_tp->super.super.context->my_rank == (int32_t)rank_of_descY(m, n) )
+    return data_of_descY(m, n);
+  return NULL;
+}
+
+static const parsec_dep_t flow_of_two_dim_band_L_Init_for_Y_dep1_atline_74 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = PARSEC_LOCAL_DATA_TASK_CLASS_ID, /* two_dim_band_descY */
+  .direct_data = (parsec_data_lookup_func_t)&flow_of_two_dim_band_L_Init_for_Y_dep1_atline_74_direct_access,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_two_dim_band_L_Init_for_Y,
+};
+static parsec_data_t *flow_of_two_dim_band_L_Init_for_Y_dep2_atline_75_direct_access(const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp, const __parsec_two_dim_band_L_Init_parsec_assignment_t *assignments)
+{
+  const int m = assignments->m.value; (void)m;
+  const int n = assignments->n.value; (void)n;
+
+  /* Silence Warnings: should look into parameters to know what variables are useful */
+  (void)m;
+  (void)n;
+  if( __parsec_tp->super.super.context->my_rank == (int32_t)rank_of_descY(m, n) )
+    return data_of_descY(m, n);
+  return NULL;
+}
+
+static const parsec_dep_t flow_of_two_dim_band_L_Init_for_Y_dep2_atline_75 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = PARSEC_LOCAL_DATA_TASK_CLASS_ID, /* two_dim_band_descY */
+  .direct_data = (parsec_data_lookup_func_t)&flow_of_two_dim_band_L_Init_for_Y_dep2_atline_75_direct_access,
+  .flags = PARSEC_DEP_FINAL_WRITE_AS_IS,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_two_dim_band_L_Init_for_Y,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+#if MAX_DEP_OUT_COUNT < 1  /* number of output dependencies */
+    #error Too many output dependencies (supports up to MAX_DEP_OUT_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_OUT_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_two_dim_band_L_Init_for_Y = {
+  .name               = "Y",
+  .sym_type           = PARSEC_SYM_INOUT,
+  .flow_flags         = PARSEC_FLOW_ACCESS_RW|PARSEC_FLOW_HAS_IN_DEPS,
+  .flow_index         = 0,
+  .flow_datatype_mask = 0x1,
+  .dep_in     = { &flow_of_two_dim_band_L_Init_for_Y_dep1_atline_74 },
+  .dep_out    = { &flow_of_two_dim_band_L_Init_for_Y_dep2_atline_75 }
+};
+
+static const parsec_dep_t flow_of_two_dim_band_L_Init_for_ctl_dep1_atline_77 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 0, /* two_dim_band_L_Allocate */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_two_dim_band_L_Allocate_for_ctl,
+  .dep_index = 1,
+  .dep_datatype_index = 1,
+  .belongs_to = &flow_of_two_dim_band_L_Init_for_ctl,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_two_dim_band_L_Init_for_ctl = {
+  .name               = "ctl",
+  .sym_type           = PARSEC_SYM_IN,
+  .flow_flags         = PARSEC_FLOW_ACCESS_NONE,
+  .flow_index         = 1,
+  .flow_datatype_mask = 0x0,
+  .dep_in     = { &flow_of_two_dim_band_L_Init_for_ctl_dep1_atline_77 },
+  .dep_out    = { NULL }
+};
+
+static void
+iterate_predecessors_of_two_dim_band_L_Init(parsec_execution_stream_t *es, const __parsec_two_dim_band_L_Init_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp = (const __parsec_two_dim_band_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_two_dim_band_L_Init_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_two_dim_band_L_Init_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int m = __jdf2c__tmp_locals.m.value; (void)m;
+  const int n = __jdf2c__tmp_locals.n.value; (void)n;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)m;  (void)n;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_descY(m, n);
+#endif
+  /* Flow of data Y has only OUTPUT dependencies to Memory */
+  if( action_mask & 0x2 ) {  /* Flow of data ctl [1] */
+    data.data   = this_task->data._f_ctl.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x2 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  =   /* Control: always empty */ 0;
+    data.local.dst_count  =   /* Control: always empty */ 0;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = NULL;
+    data.remote.src_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.src_count  =   /* Control: always empty */ 0;
+    data.remote.dst_count  =   /* Control: always empty */ 0;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        __parsec_two_dim_band_L_Allocate_task_t* ncc = (__parsec_two_dim_band_L_Allocate_task_t*)&nc;
+    nc.task_class = __parsec_tp->super.super.task_classes_array[two_dim_band_L_Allocate.task_class_id];
+      const int L_Allocate_m = m;
+      if( (L_Allocate_m >= (1)) && (L_Allocate_m <= ((((uplo) == (matrix_upper)) ? (0) : ((descY->lmt - 1))))) ) {
+        assert(&nc.locals[0].value == &ncc->locals.m.value);
+        ncc->locals.m.value = L_Allocate_m;
+        const int L_Allocate_n = n;
+        if( (L_Allocate_n >= (0)) && (L_Allocate_n <= ((ncc->locals.m.value - 1))) ) {
+          assert(&nc.locals[1].value == &ncc->locals.n.value);
+          ncc->locals.n.value = L_Allocate_n;
+#if defined(DISTRIBUTED)
+          rank_dst = rank_of_descY(ncc->locals.m.value, ncc->locals.n.value);
+          if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+            vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descY)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descY, ncc->locals.m.value, ncc->locals.n.value);
+          nc.priority = __parsec_tp->super.super.priority;
+          successor_repo = NULL;
+          successor_repo_key = 0;
+        RELEASE_DEP_OUTPUT(es, "ctl", this_task, "ctl", &nc, rank_src, rank_dst, &data);
+        if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_two_dim_band_L_Init_for_ctl_dep1_atline_77, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+          }
+        }
+  }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static int release_deps_of_two_dim_band_L_Init(parsec_execution_stream_t *es, __parsec_two_dim_band_L_Init_task_t *this_task, uint32_t action_mask, parsec_remote_deps_t *deps)
+{
+  PARSEC_PINS(es, RELEASE_DEPS_BEGIN, (parsec_task_t *)this_task);  const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp = (const __parsec_two_dim_band_internal_taskpool_t *)this_task->taskpool;
+  parsec_release_dep_fct_arg_t arg;
+  int __vp_id;
+  int consume_local_repo = 0;
+  arg.action_mask = action_mask;
+  arg.output_entry = NULL;
+  arg.output_repo = NULL;
+#if defined(DISTRIBUTED)
+  arg.remote_deps = deps;
+#endif  /* defined(DISTRIBUTED) */
+  assert(NULL != es);
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS )    arg.ready_lists = alloca(sizeof(parsec_task_t *) * es->virtual_process->parsec_context->nb_vp);
+  else
+    arg.ready_lists = NULL;
+  for( __vp_id = 0; __vp_id < es->virtual_process->parsec_context->nb_vp; arg.ready_lists[__vp_id++] = NULL );
+  (void)__parsec_tp; (void)deps;
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_Y.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_Y.source_repo, this_task->data._f_Y.source_repo_entry->ht_item.key );
+    }
+  }
+  consume_local_repo = (this_task->repo_entry != NULL);
+  /* No successors, don't call iterate_successors and don't release any local deps */
+      if (consume_local_repo) {
+         data_repo_entry_used_once( L_Init_repo, this_task->repo_entry->ht_item.key );
+      }
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_Y.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_Y.data_in);
+    }
+  }
+  PARSEC_PINS(es, RELEASE_DEPS_END, (parsec_task_t *)this_task);  return 0;
+}
+
+static int data_lookup_of_two_dim_band_L_Init(parsec_execution_stream_t *es, __parsec_two_dim_band_L_Init_task_t *this_task)
+{
+  const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp = (__parsec_two_dim_band_internal_taskpool_t *)this_task->taskpool;
+  parsec_assignment_t generic_locals[MAX_PARAM_COUNT];  /* generic task locals */
+  int target_device = 0; (void)target_device;
+  (void)__parsec_tp; (void)generic_locals; (void)es;
+  parsec_data_copy_t *chunk = NULL;
+  data_repo_t        *reshape_repo  = NULL, *consumed_repo  = NULL;
+  data_repo_entry_t  *reshape_entry = NULL, *consumed_entry = NULL;
+  parsec_key_t        reshape_entry_key = 0, consumed_entry_key = 0;
+  uint8_t             consumed_flow_index;
+  parsec_dep_data_description_t data;
+  int ret;
+  (void)reshape_repo; (void)reshape_entry; (void)reshape_entry_key;
+  (void)consumed_repo; (void)consumed_entry; (void)consumed_entry_key;
+  (void)consumed_flow_index;
+  (void)chunk; (void)data; (void)ret;
+  const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+  if( NULL == this_task->repo_entry ){
+    this_task->repo_entry = data_repo_lookup_entry_and_create(es, L_Init_repo,                                       __jdf2c_make_key_L_Init((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    data_repo_entry_addto_usage_limit(L_Init_repo, this_task->repo_entry->ht_item.key, 1);    this_task->repo_entry ->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(this_task->repo_entry ->sim_exec_date == 0);
+    this_task->repo_entry ->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  /* The reshape repo is the current task repo. */  reshape_repo = L_Init_repo;
+  reshape_entry_key = __jdf2c_make_key_L_Init((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals) ;
+  reshape_entry = this_task->repo_entry;
+  /* Lookup the input data, and store them in the context if any */
+
+if(! this_task->data._f_Y.fulfill ){ /* Flow Y */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_Y.data_out = NULL;  /* By default, if nothing matches */
+  /* Flow Y [0] dependency [0] from memory descY */
+  if( NULL == (chunk = this_task->data._f_Y.data_in) ) {
+  /* No data set up by predecessor on this task input flow */
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+  parsec_prof_grapher_data_input(data_of_descY(m, n), (parsec_task_t*)this_task, &flow_of_two_dim_band_L_Init_for_Y, 1);
+#endif
+    chunk = parsec_data_get_copy(data_of_descY(m, n), target_device);
+    data.data = chunk;
+    data.data_future  = NULL;
+        data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.data_future   = NULL;
+    if( (ret = parsec_get_copy_reshape_from_desc(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    this_task->data._f_Y.data_out = chunk;
+    PARSEC_OBJ_RETAIN(chunk);
+  } 
+    this_task->data._f_Y.data_in     = chunk;
+    this_task->data._f_Y.source_repo       = consumed_repo;
+    this_task->data._f_Y.source_repo_entry = consumed_entry;
+    this_task->data._f_Y.fulfill = 1;
+}
+
+  /* ctl is a control flow */
+  this_task->data._f_ctl.data_in         = NULL;
+  this_task->data._f_ctl.data_out        = NULL;
+  this_task->data._f_ctl.source_repo       = NULL;
+  this_task->data._f_ctl.source_repo_entry = NULL;
+  /** Generate profiling information */
+#if defined(PARSEC_PROF_TRACE)
+  this_task->prof_info.desc = (parsec_data_collection_t*)__parsec_tp->super._g_descY;
+  this_task->prof_info.priority = this_task->priority;
+  this_task->prof_info.data_id   = ((parsec_data_collection_t*)__parsec_tp->super._g_descY)->data_key((parsec_data_collection_t*)__parsec_tp->super._g_descY, m, n);
+  this_task->prof_info.task_class_id = this_task->task_class->task_class_id;
+  this_task->prof_info.task_return_code = -1;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int datatype_lookup_of_two_dim_band_L_Init(parsec_execution_stream_t *es, const parsec_task_t *this_generic_task, const parsec_task_t *parent_task,
+              uint32_t* flow_mask, parsec_dep_data_description_t* data)
+{
+  const __parsec_two_dim_band_L_Init_task_t *this_task = (__parsec_two_dim_band_L_Init_task_t*)this_generic_task;
+  const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp = (__parsec_two_dim_band_internal_taskpool_t *)this_task->taskpool;
+  (void)__parsec_tp; (void)es; (void)this_task; (void)data; (void)parent_task;
+  const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+  data->local.arena = data->remote.arena = NULL;
+  data->local.src_datatype  = data->local.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->local.src_count     = data->local.dst_count = 0;
+  data->local.src_displ     = data->local.dst_displ = 0;
+  data->data_future  = NULL;
+  if( (*flow_mask) & 0x80000000U ) { /* these are the input dependencies remote datatypes  */
+if( (*flow_mask) & 0x1U ) {  /* Flow Y */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_two_dim_band_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_two_dim_band_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_two_dim_band_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+    goto no_mask_match;
+  }
+
+  /* these are the output dependencies remote datatypes */
+if( (*flow_mask) & 0x1U ) {  /* Flow Y */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_two_dim_band_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_two_dim_band_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_two_dim_band_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+ no_mask_match:
+  data->data                             = NULL;
+  data->remote.src_datatype = data->remote.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->remote.src_count    = data->remote.dst_count = 0;
+  data->remote.src_displ    = data->remote.dst_displ = 0;
+  data->data_future  = NULL;
+  (*flow_mask) = 0;  /* nothing left */
+  (void)m;  (void)n;
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+static int hook_of_two_dim_band_L_Init(parsec_execution_stream_t *es, __parsec_two_dim_band_L_Init_task_t *this_task)
+{
+  __parsec_two_dim_band_internal_taskpool_t *__parsec_tp = (__parsec_two_dim_band_internal_taskpool_t *)this_task->taskpool;
+  (void)es; (void)__parsec_tp;
+  const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+  (void)m;  (void)n;
+
+  /** Declare the variables that will hold the data, and all the accounting for each */
+  parsec_data_copy_t *_f_Y = this_task->data._f_Y.data_in;
+  void *Y = PARSEC_DATA_COPY_GET_PTR(_f_Y); (void)Y;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    data_repo_entry_t *eY = this_task->data._f_Y.source_repo_entry;
+    if( (NULL != eY) && (eY->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eY->sim_exec_date;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+    if ( NULL != _f_Y ) {
+#if defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) || defined(PARSEC_HAVE_DEV_HIP_SUPPORT)
+      parsec_data_transfer_ownership_to_copy( _f_Y->original, 0 /* device */,
+                                           PARSEC_FLOW_ACCESS_RW);
+#endif  /* defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) || defined(PARSEC_HAVE_DEV_HIP_SUPPORT) */
+      _f_Y->version++;  /* Y */
+#if defined(PARSEC_DEBUG_NOISIER)
+      char tmp[128];
+      PARSEC_DEBUG_VERBOSE(10, parsec_debug_output,
+                           "Body of %s: change Data copy %p to version %d",
+                           parsec_task_snprintf(tmp, 128, (parsec_task_t*)(this_task)),
+                           _f_Y, _f_Y->version);
+#endif /* defined(PARSEC_DEBUG_NOISIER) */
+    }
+  /** Cache Awareness Accounting */
+#if defined(PARSEC_CACHE_AWARENESS)
+  cache_buf_referenced(es->closest_cache, Y);
+#endif /* PARSEC_CACHE_AWARENESS */
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                                  L_Init BODY                                  -----*/
+
+{
+    CORE_two_dim_band(Y, descY->mb, descY->nb);
+    if( print_rank ) printf("rank_L %d %d : %d %d\n", m, n, descY->super.myrank, descY->super.rank_of(&descY->super, m, n ));
+}
+
+/*-----                              END OF L_Init BODY                              -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#endif  /*  defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+static int complete_hook_of_two_dim_band_L_Init(parsec_execution_stream_t *es, __parsec_two_dim_band_L_Init_task_t *this_task)
+{
+  const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp = (__parsec_two_dim_band_internal_taskpool_t *)this_task->taskpool;
+#if defined(DISTRIBUTED)
+    const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+#endif  /* defined(DISTRIBUTED) */
+  (void)es; (void)__parsec_tp;
+parsec_data_t* data_t_desc = NULL; (void)data_t_desc;
+#if defined(DISTRIBUTED)
+  /** If not working on distributed, there is no risk that data is not in place */
+  data_t_desc = data_of_descY(m, n);
+  if( (NULL != this_task->data._f_Y.data_out) && (this_task->data._f_Y.data_out->original != data_t_desc) ) {
+    /* Writting back using remote_type */;
+    parsec_dep_data_description_t data;
+    data.data         = this_task->data._f_Y.data_out;
+    data.local.arena        = NULL;
+    data.local.src_datatype = data.data->dtt;
+    data.local.src_count    = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_datatype = parsec_data_get_copy(data_t_desc, 0)->dtt;
+    data.local.dst_count    = 1;
+    data.local.dst_displ    = 0;
+    data.data_future  = NULL;
+    assert( data.local.src_count > 0 );
+    parsec_remote_dep_memcpy(es,
+                            this_task->taskpool,
+                            parsec_data_get_copy(data_of_descY(m, n), 0),
+                            this_task->data._f_Y.data_out, &data);
+  }
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+  parsec_prof_grapher_data_output((parsec_task_t*)this_task, data_of_descY(m, n), &flow_of_two_dim_band_L_Init_for_Y);
+#endif
+  (void)m;  (void)n;
+
+#endif /* DISTRIBUTED */
+#if defined(PARSEC_PROF_GRAPHER)
+  parsec_prof_grapher_task((parsec_task_t*)this_task, es->th_id, es->virtual_process->vp_id,
+     __jdf2c_key_fns_L_Init.key_hash(this_task->task_class->make_key( (parsec_taskpool_t*)this_task->taskpool, ((parsec_task_t*)this_task)->locals), NULL));
+#endif  /* defined(PARSEC_PROF_GRAPHER) */
+  release_deps_of_two_dim_band_L_Init(es, this_task,
+      PARSEC_ACTION_RELEASE_REMOTE_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_REFS |
+      PARSEC_ACTION_RESHAPE_ON_RELEASE |
+      0x1,  /* mask of all dep_index */ 
+      NULL);
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static parsec_hook_return_t release_task_of_two_dim_band_L_Init(parsec_execution_stream_t *es, parsec_task_t *this_task)
+{
+    const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp =
+        (const __parsec_two_dim_band_internal_taskpool_t *)this_task->taskpool;
+    parsec_hash_table_t *ht = (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[1];
+    parsec_key_t key = this_task->task_class->make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals);
+    parsec_hashable_dependency_t *hash_dep = (parsec_hashable_dependency_t *)parsec_hash_table_remove(ht, key);
+    parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);
+    return parsec_release_task_to_mempool_update_nbtasks(es, this_task);
+}
+
+static char *two_dim_band_two_dim_band_L_Init_internal_init_deps_key_functions_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_two_dim_band_internal_taskpool_t *__parsec_tp = (__parsec_two_dim_band_internal_taskpool_t *)user_data;
+  int m = (__parsec_key) % __parsec_tp->L_Init_m_range + __parsec_tp->L_Init_m_min;
+  __parsec_key = __parsec_key / __parsec_tp->L_Init_m_range;
+  int n = (__parsec_key) % __parsec_tp->L_Init_n_range + __parsec_tp->L_Init_n_min;
+  __parsec_key = __parsec_key / __parsec_tp->L_Init_n_range;
+  snprintf(buffer, buffer_size, "L_Init(%d, %d)", m, n);
+  return buffer;
+}
+
+static parsec_key_fn_t two_dim_band_two_dim_band_L_Init_internal_init_deps_key_functions = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = two_dim_band_two_dim_band_L_Init_internal_init_deps_key_functions_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/* Needs: min-max count-tasks iterate */
+static int two_dim_band_L_Init_internal_init(parsec_execution_stream_t * es, __parsec_two_dim_band_L_Init_task_t * this_task)
+{
+  __parsec_two_dim_band_internal_taskpool_t *__parsec_tp = (__parsec_two_dim_band_internal_taskpool_t*)this_task->taskpool;
+  int32_t nb_tasks = 0, saved_nb_tasks = 0;
+int32_t __m_min = 0x7fffffff, __m_max = 0;int32_t __jdf2c_m_min = 0x7fffffff, __jdf2c_m_max = 0;int32_t __n_min = 0x7fffffff, __n_max = 0;int32_t __jdf2c_n_min = 0x7fffffff, __jdf2c_n_max = 0;  __parsec_two_dim_band_L_Init_parsec_assignment_t assignments = {  .m.value = 0, .n.value = 0 };
+  int32_t  m,  n;
+  int32_t __jdf2c_m_start, __jdf2c_m_end, __jdf2c_m_inc;
+  int32_t __jdf2c_n_start, __jdf2c_n_end, __jdf2c_n_inc;
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+  PARSEC_PROFILING_TRACE(es->es_profile,
+                         this_task->taskpool->profiling_array[START_KEY(this_task->task_class->task_class_id)],
+                         0,
+                         this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    __jdf2c_m_start = 1;
+    __jdf2c_m_end = (((uplo) == (matrix_upper)) ? (0) : ((descY->lmt - 1)));
+    __jdf2c_m_inc = 1;
+    __m_min = parsec_imin(__jdf2c_m_start, __jdf2c_m_end);
+    __m_max = parsec_imax(__jdf2c_m_start, __jdf2c_m_end);
+    __jdf2c_m_min = parsec_imin(__jdf2c_m_min, __m_min);
+    __jdf2c_m_max = parsec_imax(__jdf2c_m_max, __m_max);
+    for(m =  __jdf2c_m_start;
+        m <= __jdf2c_m_end;
+        m += __jdf2c_m_inc) {
+    assignments.m.value = m;
+      __jdf2c_n_start = 0;
+      __jdf2c_n_end = (m - 1);
+      __jdf2c_n_inc = 1;
+      __n_min = parsec_imin(__jdf2c_n_start, __jdf2c_n_end);
+      __n_max = parsec_imax(__jdf2c_n_start, __jdf2c_n_end);
+      __jdf2c_n_min = parsec_imin(__jdf2c_n_min, __n_min);
+      __jdf2c_n_max = parsec_imax(__jdf2c_n_max, __n_max);
+      for(n =  __jdf2c_n_start;
+          n <= __jdf2c_n_end;
+          n += __jdf2c_n_inc) {
+      assignments.n.value = n;
+      if( !L_Init_pred(m, n) ) continue;
+      nb_tasks++;
+    } /* Loop on normal range n */
+  } /* For loop of m */ 
+   if( 0 != nb_tasks ) {
+     (void)parsec_atomic_fetch_add_int32(&__parsec_tp->initial_number_tasks, nb_tasks);
+   }
+  /* Set the range variables for the collision-free hash-computation */
+  __parsec_tp->L_Init_m_min   = __jdf2c_m_min;
+  __parsec_tp->L_Init_m_range = (__jdf2c_m_max - __jdf2c_m_min) + 1;
+  __parsec_tp->L_Init_n_min   = __jdf2c_n_min;
+  __parsec_tp->L_Init_n_range = (__jdf2c_n_max - __jdf2c_n_min) + 1;
+  this_task->status = PARSEC_TASK_STATUS_COMPLETE;
+
+  PARSEC_AYU_REGISTER_TASK(&two_dim_band_L_Init);
+  __parsec_tp->super.super.dependencies_array[1] = PARSEC_OBJ_NEW(parsec_hash_table_t);
+  parsec_hash_table_init(__parsec_tp->super.super.dependencies_array[1], offsetof(parsec_hashable_dependency_t, ht_item), 10, two_dim_band_two_dim_band_L_Init_internal_init_deps_key_functions, this_task->taskpool);
+  __parsec_tp->repositories[1] = data_repo_create_nothreadsafe(nb_tasks, __jdf2c_key_fns_L_Init, (parsec_taskpool_t*)__parsec_tp, 2);
+(void)saved_nb_tasks;
+(void)__m_min; (void)__m_max;(void)__n_min; (void)__n_max;  (void)__jdf2c_m_start; (void)__jdf2c_m_end; (void)__jdf2c_m_inc;  (void)__jdf2c_n_start; (void)__jdf2c_n_end; (void)__jdf2c_n_inc;  (void)assignments; (void)__parsec_tp; (void)es;
+  if(1 == parsec_atomic_fetch_dec_int32(&__parsec_tp->sync_point)) {
+    /* Last initialization task complete. Update the number of tasks. */
+    __parsec_tp->super.super.tdm.module->taskpool_addto_nb_tasks(&__parsec_tp->super.super, __parsec_tp->initial_number_tasks);
+    parsec_mfence();  /* write memory barrier to guarantee that the scheduler gets the correct number of tasks */
+    parsec_taskpool_enable((parsec_taskpool_t*)__parsec_tp, &__parsec_tp->startup_queue,
+                           (parsec_task_t*)this_task, es, __parsec_tp->super.super.nb_pending_actions);
+    __parsec_tp->super.super.tdm.module->taskpool_ready(&__parsec_tp->super.super);
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+    PARSEC_PROFILING_TRACE(es->es_profile,
+                           this_task->taskpool->profiling_array[2 * this_task->task_class->task_class_id + 1],
+                           0,
+                           this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    return PARSEC_HOOK_RETURN_DONE;
+  }
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static const __parsec_chore_t __two_dim_band_L_Init_chores[] ={
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+    { .type     = PARSEC_DEV_CPU,
+      .evaluate = (parsec_evaluate_function_t*)NULL,
+      .hook     = (parsec_hook_t*)hook_of_two_dim_band_L_Init },
+#endif  /* defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+    { .type     = PARSEC_DEV_NONE,
+      .evaluate = NULL,
+      .hook     = (parsec_hook_t*)NULL },  /* End marker */
+};
+
+static const parsec_task_class_t two_dim_band_L_Init = {
+  .name = "L_Init",
+  .task_class_id = 1,
+  .nb_flows = 2,
+  .nb_parameters = 2,
+  .nb_locals = 2,
+  .task_class_type = PARSEC_TASK_CLASS_TYPE_PTG,
+  .params = { &symb_two_dim_band_L_Init_m, &symb_two_dim_band_L_Init_n, NULL },
+  .locals = { &symb_two_dim_band_L_Init_m, &symb_two_dim_band_L_Init_n, NULL },
+  .data_affinity = (parsec_data_ref_fn_t*)affinity_of_two_dim_band_L_Init,
+  .initial_data = (parsec_data_ref_fn_t*)affinity_of_two_dim_band_L_Init,
+  .final_data = (parsec_data_ref_fn_t*)affinity_of_two_dim_band_L_Init,
+  .priority = NULL,
+  .properties = properties_of_two_dim_band_L_Init,
+#if MAX_PARAM_COUNT < 1  /* number of read flows of L_Init */
+  #error Too many read flows for task L_Init
+#endif  /* MAX_PARAM_COUNT */
+#if MAX_PARAM_COUNT < 1  /* number of write flows of L_Init */
+  #error Too many write flows for task L_Init
+#endif  /* MAX_PARAM_COUNT */
+  .in = { &flow_of_two_dim_band_L_Init_for_Y, &flow_of_two_dim_band_L_Init_for_ctl, NULL },
+  .out = { &flow_of_two_dim_band_L_Init_for_Y, NULL },
+  .flags = 0x0 | PARSEC_HAS_IN_IN_DEPENDENCIES | PARSEC_USE_DEPS_MASK,
+  .dependencies_goal = 0x3,
+  .make_key = __jdf2c_make_key_L_Init,
+  .task_snprintf = parsec_task_snprintf,
+#if defined(PARSEC_PROF_TRACE)
+  .profile_info = &parsec_task_profile_info,
+#endif
+  .key_functions = &__jdf2c_key_fns_L_Init,
+  .fini = (parsec_hook_t*)NULL,
+  .incarnations = __two_dim_band_L_Init_chores,
+  .find_deps = parsec_hash_find_deps,
+  .update_deps = parsec_update_deps_with_mask,
+  .iterate_successors = (parsec_traverse_function_t*)NULL,
+  .iterate_predecessors = (parsec_traverse_function_t*)iterate_predecessors_of_two_dim_band_L_Init,
+  .release_deps = (parsec_release_deps_t*)release_deps_of_two_dim_band_L_Init,
+  .prepare_output = (parsec_hook_t*)NULL,
+  .prepare_input = (parsec_hook_t*)data_lookup_of_two_dim_band_L_Init,
+  .time_estimate = NULL,
+  .get_datatype = datatype_lookup_of_two_dim_band_L_Init,
+  .complete_execution = (parsec_hook_t*)complete_hook_of_two_dim_band_L_Init,
+  .release_task = &release_task_of_two_dim_band_L_Init,
+#if defined(PARSEC_SIM)
+  .sim_cost_fct = (parsec_sim_cost_fct_t*)NULL,
+#endif
+};
+
+
+/******                                  L_Allocate                                  ******/
+
+static inline int32_t minexpr_of_symb_two_dim_band_L_Allocate_m_fct(const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp, const __parsec_two_dim_band_L_Allocate_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 1;
+}
+static const parsec_expr_t minexpr_of_symb_two_dim_band_L_Allocate_m = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_two_dim_band_L_Allocate_m_fct }
+                   }
+};
+static inline int maxexpr_of_symb_two_dim_band_L_Allocate_m_fct(const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp, const __parsec_two_dim_band_L_Allocate_parsec_assignment_t *locals)
+{
+  const int m = locals->m.value; (void)m;
+  const int n = locals->n.value; (void)n;
+
+  (void)m;
+  (void)n;
+  (void)__parsec_tp; (void)locals;
+  return (((uplo) == (matrix_upper)) ? (0) : ((descY->lmt - 1)));
+}
+static const parsec_expr_t maxexpr_of_symb_two_dim_band_L_Allocate_m = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_two_dim_band_L_Allocate_m_fct }
+                   }
+};
+static const parsec_symbol_t symb_two_dim_band_L_Allocate_m = { .name = "m", .context_index = 0, .min = &minexpr_of_symb_two_dim_band_L_Allocate_m, .max = &maxexpr_of_symb_two_dim_band_L_Allocate_m, .cst_inc = 1, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t minexpr_of_symb_two_dim_band_L_Allocate_n_fct(const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp, const __parsec_two_dim_band_L_Allocate_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_two_dim_band_L_Allocate_n = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_two_dim_band_L_Allocate_n_fct }
+                   }
+};
+static inline int maxexpr_of_symb_two_dim_band_L_Allocate_n_fct(const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp, const __parsec_two_dim_band_L_Allocate_parsec_assignment_t *locals)
+{
+  const int m = locals->m.value;
+  const int n = locals->n.value; (void)n;
+
+  (void)m;
+  (void)n;
+  (void)__parsec_tp; (void)locals;
+  return (m - 1);
+}
+static const parsec_expr_t maxexpr_of_symb_two_dim_band_L_Allocate_n = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_two_dim_band_L_Allocate_n_fct }
+                   }
+};
+static const parsec_symbol_t symb_two_dim_band_L_Allocate_n = { .name = "n", .context_index = 1, .min = &minexpr_of_symb_two_dim_band_L_Allocate_n, .max = &maxexpr_of_symb_two_dim_band_L_Allocate_n, .cst_inc = 1, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int affinity_of_two_dim_band_L_Allocate(const __parsec_two_dim_band_L_Allocate_task_t *this_task,
+                     parsec_data_ref_t *ref)
+{
+    const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp = (const __parsec_two_dim_band_internal_taskpool_t*)this_task->taskpool;
+  const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+
+  /* Silent Warnings: should look into predicate to know what variables are usefull */
+  (void)m;
+  (void)n;
+  ref->dc = (parsec_data_collection_t *)__parsec_tp->super._g_descY;
+  /* Compute data key */
+  ref->key = ref->dc->data_key(ref->dc, m, n);
+  return 1;
+}
+static const parsec_property_t properties_of_two_dim_band_L_Allocate[1] = {
+  {.name = NULL, .expr = NULL}
+};
+static const parsec_dep_t flow_of_two_dim_band_L_Allocate_for_Y_dep1_atline_46 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = PARSEC_LOCAL_DATA_TASK_CLASS_ID, /* two_dim_band___parsec_null_type */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_two_dim_band_L_Allocate_for_Y,
+};
+static parsec_data_t *flow_of_two_dim_band_L_Allocate_for_Y_dep2_atline_47_direct_access(const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp, const __parsec_two_dim_band_L_Allocate_parsec_assignment_t *assignments)
+{
+  const int m = assignments->m.value; (void)m;
+  const int n = assignments->n.value; (void)n;
+
+  /* Silence Warnings: should look into parameters to know what variables are useful */
+  (void)m;
+  (void)n;
+  if( __parsec_tp->super.super.context->my_rank == (int32_t)rank_of_descY(m, n) )
+    return data_of_descY(m, n);
+  return NULL;
+}
+
+static const parsec_dep_t flow_of_two_dim_band_L_Allocate_for_Y_dep2_atline_47 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = PARSEC_LOCAL_DATA_TASK_CLASS_ID, /* two_dim_band_descY */
+  .direct_data = (parsec_data_lookup_func_t)&flow_of_two_dim_band_L_Allocate_for_Y_dep2_atline_47_direct_access,
+  .flags = PARSEC_DEP_FINAL_WRITE_AS_IS,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_two_dim_band_L_Allocate_for_Y,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+#if MAX_DEP_OUT_COUNT < 1  /* number of output dependencies */
+    #error Too many output dependencies (supports up to MAX_DEP_OUT_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_OUT_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_two_dim_band_L_Allocate_for_Y = {
+  .name               = "Y",
+  .sym_type           = PARSEC_SYM_INOUT,
+  .flow_flags         = PARSEC_FLOW_ACCESS_RW|PARSEC_FLOW_HAS_IN_DEPS,
+  .flow_index         = 0,
+  .flow_datatype_mask = 0x1,
+  .dep_in     = { &flow_of_two_dim_band_L_Allocate_for_Y_dep1_atline_46 },
+  .dep_out    = { &flow_of_two_dim_band_L_Allocate_for_Y_dep2_atline_47 }
+};
+
+static const parsec_dep_t flow_of_two_dim_band_L_Allocate_for_ctl_dep1_atline_49 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 1, /* two_dim_band_L_Init */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_two_dim_band_L_Init_for_ctl,
+  .dep_index = 1,
+  .dep_datatype_index = 1,
+  .belongs_to = &flow_of_two_dim_band_L_Allocate_for_ctl,
+};
+#if MAX_DEP_OUT_COUNT < 1  /* number of output dependencies */
+    #error Too many output dependencies (supports up to MAX_DEP_OUT_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_OUT_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_two_dim_band_L_Allocate_for_ctl = {
+  .name               = "ctl",
+  .sym_type           = PARSEC_SYM_OUT,
+  .flow_flags         = PARSEC_FLOW_ACCESS_NONE,
+  .flow_index         = 1,
+  .flow_datatype_mask = 0x2,
+  .dep_in     = { NULL },
+  .dep_out    = { &flow_of_two_dim_band_L_Allocate_for_ctl_dep1_atline_49 }
+};
+
+static void
+iterate_successors_of_two_dim_band_L_Allocate(parsec_execution_stream_t *es, const __parsec_two_dim_band_L_Allocate_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp = (const __parsec_two_dim_band_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_two_dim_band_L_Allocate_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_two_dim_band_L_Allocate_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int m = __jdf2c__tmp_locals.m.value; (void)m;
+  const int n = __jdf2c__tmp_locals.n.value; (void)n;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)m;  (void)n;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_descY(m, n);
+#endif
+  /* Flow of data Y has only OUTPUT dependencies to Memory */
+  if( action_mask & 0x2 ) {  /* Flow of data ctl [1] */
+    data.data   = this_task->data._f_ctl.data_out;
+    data.data_future  = NULL;
+    if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  =   /* Control: always empty */ 0;
+    data.local.dst_count  =   /* Control: always empty */ 0;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = NULL;
+    data.remote.src_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.src_count  =   /* Control: always empty */ 0;
+    data.remote.dst_count  =   /* Control: always empty */ 0;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+       __parsec_two_dim_band_L_Init_task_t* ncc = (__parsec_two_dim_band_L_Init_task_t*)&nc;
+    nc.task_class = __parsec_tp->super.super.task_classes_array[two_dim_band_L_Init.task_class_id];
+      const int L_Init_m = m;
+      if( (L_Init_m >= (1)) && (L_Init_m <= ((((uplo) == (matrix_upper)) ? (0) : ((descY->lmt - 1))))) ) {
+        assert(&nc.locals[0].value == &ncc->locals.m.value);
+        ncc->locals.m.value = L_Init_m;
+        const int L_Init_n = n;
+        if( (L_Init_n >= (0)) && (L_Init_n <= ((ncc->locals.m.value - 1))) ) {
+          assert(&nc.locals[1].value == &ncc->locals.n.value);
+          ncc->locals.n.value = L_Init_n;
+#if defined(DISTRIBUTED)
+          rank_dst = rank_of_descY(ncc->locals.m.value, ncc->locals.n.value);
+          if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+            vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descY)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descY, ncc->locals.m.value, ncc->locals.n.value);
+          nc.priority = __parsec_tp->super.super.priority;
+          successor_repo = L_Init_repo;
+          successor_repo_key = __jdf2c_make_key_L_Init((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+        RELEASE_DEP_OUTPUT(es, "ctl", this_task, "ctl", &nc, rank_src, rank_dst, &data);
+        if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_two_dim_band_L_Allocate_for_ctl_dep1_atline_49, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+          }
+        }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static int release_deps_of_two_dim_band_L_Allocate(parsec_execution_stream_t *es, __parsec_two_dim_band_L_Allocate_task_t *this_task, uint32_t action_mask, parsec_remote_deps_t *deps)
+{
+  PARSEC_PINS(es, RELEASE_DEPS_BEGIN, (parsec_task_t *)this_task);  const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp = (const __parsec_two_dim_band_internal_taskpool_t *)this_task->taskpool;
+  parsec_release_dep_fct_arg_t arg;
+  int __vp_id;
+  int consume_local_repo = 0;
+  arg.action_mask = action_mask;
+  arg.output_entry = NULL;
+  arg.output_repo = NULL;
+#if defined(DISTRIBUTED)
+  arg.remote_deps = deps;
+#endif  /* defined(DISTRIBUTED) */
+  assert(NULL != es);
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS )    arg.ready_lists = alloca(sizeof(parsec_task_t *) * es->virtual_process->parsec_context->nb_vp);
+  else
+    arg.ready_lists = NULL;
+  for( __vp_id = 0; __vp_id < es->virtual_process->parsec_context->nb_vp; arg.ready_lists[__vp_id++] = NULL );
+  (void)__parsec_tp; (void)deps;
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_Y.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_Y.source_repo, this_task->data._f_Y.source_repo_entry->ht_item.key );
+    }
+  }
+  consume_local_repo = (this_task->repo_entry != NULL);
+  arg.output_repo = L_Allocate_repo;
+  arg.output_entry = this_task->repo_entry;
+  arg.output_usage = 0;
+  if( action_mask & (PARSEC_ACTION_RELEASE_LOCAL_DEPS | PARSEC_ACTION_GET_REPO_ENTRY) ) {
+    arg.output_entry = data_repo_lookup_entry_and_create( es, arg.output_repo, __jdf2c_make_key_L_Allocate((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    arg.output_entry->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(arg.output_entry->sim_exec_date == 0);
+    arg.output_entry->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  if(action_mask & ( PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE ) ){
+    /* Generate the reshape promise for the outputs that need it */
+    iterate_successors_of_two_dim_band_L_Allocate(es, this_task, action_mask, parsec_set_up_reshape_promise, &arg);
+   }
+  iterate_successors_of_two_dim_band_L_Allocate(es, this_task, action_mask, parsec_release_dep_fct, &arg);
+
+#if defined(DISTRIBUTED)
+  if( (action_mask & PARSEC_ACTION_SEND_REMOTE_DEPS) && (NULL != arg.remote_deps)) {
+    parsec_remote_dep_activate(es, (parsec_task_t *)this_task, arg.remote_deps, arg.remote_deps->outgoing_mask);
+  }
+#endif
+
+  if(action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS) {
+    data_repo_entry_addto_usage_limit(L_Allocate_repo, arg.output_entry->ht_item.key, arg.output_usage);
+    __parsec_schedule_vp(es, arg.ready_lists, 0);
+  }
+      if (consume_local_repo) {
+         data_repo_entry_used_once( L_Allocate_repo, this_task->repo_entry->ht_item.key );
+      }
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_Y.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_Y.data_in);
+    }
+  }
+  PARSEC_PINS(es, RELEASE_DEPS_END, (parsec_task_t *)this_task);  return 0;
+}
+
+static int data_lookup_of_two_dim_band_L_Allocate(parsec_execution_stream_t *es, __parsec_two_dim_band_L_Allocate_task_t *this_task)
+{
+  const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp = (__parsec_two_dim_band_internal_taskpool_t *)this_task->taskpool;
+  parsec_assignment_t generic_locals[MAX_PARAM_COUNT];  /* generic task locals */
+  int target_device = 0; (void)target_device;
+  (void)__parsec_tp; (void)generic_locals; (void)es;
+  parsec_data_copy_t *chunk = NULL;
+  data_repo_t        *reshape_repo  = NULL, *consumed_repo  = NULL;
+  data_repo_entry_t  *reshape_entry = NULL, *consumed_entry = NULL;
+  parsec_key_t        reshape_entry_key = 0, consumed_entry_key = 0;
+  uint8_t             consumed_flow_index;
+  parsec_dep_data_description_t data;
+  int ret;
+  (void)reshape_repo; (void)reshape_entry; (void)reshape_entry_key;
+  (void)consumed_repo; (void)consumed_entry; (void)consumed_entry_key;
+  (void)consumed_flow_index;
+  (void)chunk; (void)data; (void)ret;
+  const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+  if( NULL == this_task->repo_entry ){
+    this_task->repo_entry = data_repo_lookup_entry_and_create(es, L_Allocate_repo,                                       __jdf2c_make_key_L_Allocate((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    data_repo_entry_addto_usage_limit(L_Allocate_repo, this_task->repo_entry->ht_item.key, 1);    this_task->repo_entry ->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(this_task->repo_entry ->sim_exec_date == 0);
+    this_task->repo_entry ->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  /* The reshape repo is the current task repo. */  reshape_repo = L_Allocate_repo;
+  reshape_entry_key = __jdf2c_make_key_L_Allocate((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals) ;
+  reshape_entry = this_task->repo_entry;
+  /* Lookup the input data, and store them in the context if any */
+
+if(! this_task->data._f_Y.fulfill ){ /* Flow Y */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_Y.data_out = NULL;  /* By default, if nothing matches */
+  /* Flow Y [0] dependency [0] from memory NEW or NULL data */
+  if( NULL == (chunk = this_task->data._f_Y.data_in) ) {
+  /* No data set up by predecessor on this task input flow */
+  } 
+    this_task->data._f_Y.data_in     = chunk;
+    this_task->data._f_Y.source_repo       = consumed_repo;
+    this_task->data._f_Y.source_repo_entry = consumed_entry;
+    if( this_task->data._f_Y.source_repo_entry == this_task->repo_entry ){
+      /* in case we have consume from this task repo entry for the flow,
+       * it is cleaned up, avoiding having old stuff during release_deps_of
+       */
+      this_task->repo_entry->data[0] = NULL;
+    }
+    this_task->data._f_Y.fulfill = 1;
+}
+
+  /* ctl is a control flow */
+  this_task->data._f_ctl.data_in         = NULL;
+  this_task->data._f_ctl.data_out        = NULL;
+  this_task->data._f_ctl.source_repo       = NULL;
+  this_task->data._f_ctl.source_repo_entry = NULL;
+  /** Generate profiling information */
+#if defined(PARSEC_PROF_TRACE)
+  this_task->prof_info.desc = (parsec_data_collection_t*)__parsec_tp->super._g_descY;
+  this_task->prof_info.priority = this_task->priority;
+  this_task->prof_info.data_id   = ((parsec_data_collection_t*)__parsec_tp->super._g_descY)->data_key((parsec_data_collection_t*)__parsec_tp->super._g_descY, m, n);
+  this_task->prof_info.task_class_id = this_task->task_class->task_class_id;
+  this_task->prof_info.task_return_code = -1;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int datatype_lookup_of_two_dim_band_L_Allocate(parsec_execution_stream_t *es, const parsec_task_t *this_generic_task, const parsec_task_t *parent_task,
+              uint32_t* flow_mask, parsec_dep_data_description_t* data)
+{
+  const __parsec_two_dim_band_L_Allocate_task_t *this_task = (__parsec_two_dim_band_L_Allocate_task_t*)this_generic_task;
+  const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp = (__parsec_two_dim_band_internal_taskpool_t *)this_task->taskpool;
+  (void)__parsec_tp; (void)es; (void)this_task; (void)data; (void)parent_task;
+  const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+  data->local.arena = data->remote.arena = NULL;
+  data->local.src_datatype  = data->local.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->local.src_count     = data->local.dst_count = 0;
+  data->local.src_displ     = data->local.dst_displ = 0;
+  data->data_future  = NULL;
+  if( (*flow_mask) & 0x80000000U ) { /* these are the input dependencies remote datatypes  */
+if( (*flow_mask) & 0x1U ) {  /* Flow Y */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_two_dim_band_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_two_dim_band_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_two_dim_band_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+    goto no_mask_match;
+  }
+
+  /* these are the output dependencies remote datatypes */
+if( (*flow_mask) & 0x1U ) {  /* Flow Y */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_two_dim_band_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_two_dim_band_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_two_dim_band_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+ no_mask_match:
+  data->data                             = NULL;
+  data->remote.src_datatype = data->remote.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->remote.src_count    = data->remote.dst_count = 0;
+  data->remote.src_displ    = data->remote.dst_displ = 0;
+  data->data_future  = NULL;
+  (*flow_mask) = 0;  /* nothing left */
+  (void)m;  (void)n;
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+static int hook_of_two_dim_band_L_Allocate(parsec_execution_stream_t *es, __parsec_two_dim_band_L_Allocate_task_t *this_task)
+{
+  __parsec_two_dim_band_internal_taskpool_t *__parsec_tp = (__parsec_two_dim_band_internal_taskpool_t *)this_task->taskpool;
+  (void)es; (void)__parsec_tp;
+  const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+  (void)m;  (void)n;
+
+  /** Declare the variables that will hold the data, and all the accounting for each */
+  parsec_data_copy_t *_f_Y = this_task->data._f_Y.data_in;
+  void *Y = PARSEC_DATA_COPY_GET_PTR(_f_Y); (void)Y;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    data_repo_entry_t *eY = this_task->data._f_Y.source_repo_entry;
+    if( (NULL != eY) && (eY->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eY->sim_exec_date;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+    if ( NULL != _f_Y ) {
+#if defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) || defined(PARSEC_HAVE_DEV_HIP_SUPPORT)
+      parsec_data_transfer_ownership_to_copy( _f_Y->original, 0 /* device */,
+                                           PARSEC_FLOW_ACCESS_RW);
+#endif  /* defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) || defined(PARSEC_HAVE_DEV_HIP_SUPPORT) */
+      _f_Y->version++;  /* Y */
+#if defined(PARSEC_DEBUG_NOISIER)
+      char tmp[128];
+      PARSEC_DEBUG_VERBOSE(10, parsec_debug_output,
+                           "Body of %s: change Data copy %p to version %d",
+                           parsec_task_snprintf(tmp, 128, (parsec_task_t*)(this_task)),
+                           _f_Y, _f_Y->version);
+#endif /* defined(PARSEC_DEBUG_NOISIER) */
+    }
+  /** Cache Awareness Accounting */
+#if defined(PARSEC_CACHE_AWARENESS)
+  cache_buf_referenced(es->closest_cache, Y);
+#endif /* PARSEC_CACHE_AWARENESS */
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                                L_Allocate BODY                                -----*/
+
+{
+    int size = descY->bsiz * sizeof(double);   /* Could be changed flexibly */
+    this_task->data._f_Y.data_out = parsec_data_copy_new(data_of_descY(m, n), 0,
+                                                         PARSEC_two_dim_band_DEFAULT_ADT->opaque_dtt,
+                                                         PARSEC_DATA_FLAG_PARSEC_MANAGED);
+    this_task->data._f_Y.data_out->device_private = malloc(size);
+}
+
+/*-----                            END OF L_Allocate BODY                            -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#endif  /*  defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+static int complete_hook_of_two_dim_band_L_Allocate(parsec_execution_stream_t *es, __parsec_two_dim_band_L_Allocate_task_t *this_task)
+{
+  const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp = (__parsec_two_dim_band_internal_taskpool_t *)this_task->taskpool;
+#if defined(DISTRIBUTED)
+    const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+#endif  /* defined(DISTRIBUTED) */
+  (void)es; (void)__parsec_tp;
+parsec_data_t* data_t_desc = NULL; (void)data_t_desc;
+#if defined(DISTRIBUTED)
+  /** If not working on distributed, there is no risk that data is not in place */
+  data_t_desc = data_of_descY(m, n);
+  if( (NULL != this_task->data._f_Y.data_out) && (this_task->data._f_Y.data_out->original != data_t_desc) ) {
+    /* Writting back using remote_type */;
+    parsec_dep_data_description_t data;
+    data.data         = this_task->data._f_Y.data_out;
+    data.local.arena        = NULL;
+    data.local.src_datatype = data.data->dtt;
+    data.local.src_count    = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_datatype = parsec_data_get_copy(data_t_desc, 0)->dtt;
+    data.local.dst_count    = 1;
+    data.local.dst_displ    = 0;
+    data.data_future  = NULL;
+    assert( data.local.src_count > 0 );
+    parsec_remote_dep_memcpy(es,
+                            this_task->taskpool,
+                            parsec_data_get_copy(data_of_descY(m, n), 0),
+                            this_task->data._f_Y.data_out, &data);
+  }
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+  parsec_prof_grapher_data_output((parsec_task_t*)this_task, data_of_descY(m, n), &flow_of_two_dim_band_L_Allocate_for_Y);
+#endif
+  (void)m;  (void)n;
+
+#endif /* DISTRIBUTED */
+#if defined(PARSEC_PROF_GRAPHER)
+  parsec_prof_grapher_task((parsec_task_t*)this_task, es->th_id, es->virtual_process->vp_id,
+     __jdf2c_key_fns_L_Allocate.key_hash(this_task->task_class->make_key( (parsec_taskpool_t*)this_task->taskpool, ((parsec_task_t*)this_task)->locals), NULL));
+#endif  /* defined(PARSEC_PROF_GRAPHER) */
+  release_deps_of_two_dim_band_L_Allocate(es, this_task,
+      PARSEC_ACTION_RELEASE_REMOTE_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_REFS |
+      PARSEC_ACTION_RESHAPE_ON_RELEASE |
+      0x3,  /* mask of all dep_index */ 
+      NULL);
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static parsec_hook_return_t release_task_of_two_dim_band_L_Allocate(parsec_execution_stream_t *es, parsec_task_t *this_task)
+{
+    const __parsec_two_dim_band_internal_taskpool_t *__parsec_tp =
+        (const __parsec_two_dim_band_internal_taskpool_t *)this_task->taskpool;
+    parsec_hash_table_t *ht = (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[0];
+    parsec_key_t key = this_task->task_class->make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals);
+    parsec_hashable_dependency_t *hash_dep = (parsec_hashable_dependency_t *)parsec_hash_table_remove(ht, key);
+    parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);
+    return parsec_release_task_to_mempool_update_nbtasks(es, this_task);
+}
+
+static char *two_dim_band_two_dim_band_L_Allocate_internal_init_deps_key_functions_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_two_dim_band_internal_taskpool_t *__parsec_tp = (__parsec_two_dim_band_internal_taskpool_t *)user_data;
+  int m = (__parsec_key) % __parsec_tp->L_Allocate_m_range + __parsec_tp->L_Allocate_m_min;
+  __parsec_key = __parsec_key / __parsec_tp->L_Allocate_m_range;
+  int n = (__parsec_key) % __parsec_tp->L_Allocate_n_range + __parsec_tp->L_Allocate_n_min;
+  __parsec_key = __parsec_key / __parsec_tp->L_Allocate_n_range;
+  snprintf(buffer, buffer_size, "L_Allocate(%d, %d)", m, n);
+  return buffer;
+}
+
+static parsec_key_fn_t two_dim_band_two_dim_band_L_Allocate_internal_init_deps_key_functions = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = two_dim_band_two_dim_band_L_Allocate_internal_init_deps_key_functions_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/* Needs: min-max count-tasks iterate */
+static int two_dim_band_L_Allocate_internal_init(parsec_execution_stream_t * es, __parsec_two_dim_band_L_Allocate_task_t * this_task)
+{
+  __parsec_two_dim_band_internal_taskpool_t *__parsec_tp = (__parsec_two_dim_band_internal_taskpool_t*)this_task->taskpool;
+  int32_t nb_tasks = 0, saved_nb_tasks = 0;
+int32_t __m_min = 0x7fffffff, __m_max = 0;int32_t __jdf2c_m_min = 0x7fffffff, __jdf2c_m_max = 0;int32_t __n_min = 0x7fffffff, __n_max = 0;int32_t __jdf2c_n_min = 0x7fffffff, __jdf2c_n_max = 0;  __parsec_two_dim_band_L_Allocate_parsec_assignment_t assignments = {  .m.value = 0, .n.value = 0 };
+  int32_t  m,  n;
+  int32_t __jdf2c_m_start, __jdf2c_m_end, __jdf2c_m_inc;
+  int32_t __jdf2c_n_start, __jdf2c_n_end, __jdf2c_n_inc;
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+  PARSEC_PROFILING_TRACE(es->es_profile,
+                         this_task->taskpool->profiling_array[START_KEY(this_task->task_class->task_class_id)],
+                         0,
+                         this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    __jdf2c_m_start = 1;
+    __jdf2c_m_end = (((uplo) == (matrix_upper)) ? (0) : ((descY->lmt - 1)));
+    __jdf2c_m_inc = 1;
+    __m_min = parsec_imin(__jdf2c_m_start, __jdf2c_m_end);
+    __m_max = parsec_imax(__jdf2c_m_start, __jdf2c_m_end);
+    __jdf2c_m_min = parsec_imin(__jdf2c_m_min, __m_min);
+    __jdf2c_m_max = parsec_imax(__jdf2c_m_max, __m_max);
+    for(m =  __jdf2c_m_start;
+        m <= __jdf2c_m_end;
+        m += __jdf2c_m_inc) {
+    assignments.m.value = m;
+      __jdf2c_n_start = 0;
+      __jdf2c_n_end = (m - 1);
+      __jdf2c_n_inc = 1;
+      __n_min = parsec_imin(__jdf2c_n_start, __jdf2c_n_end);
+      __n_max = parsec_imax(__jdf2c_n_start, __jdf2c_n_end);
+      __jdf2c_n_min = parsec_imin(__jdf2c_n_min, __n_min);
+      __jdf2c_n_max = parsec_imax(__jdf2c_n_max, __n_max);
+      for(n =  __jdf2c_n_start;
+          n <= __jdf2c_n_end;
+          n += __jdf2c_n_inc) {
+      assignments.n.value = n;
+      if( !L_Allocate_pred(m, n) ) continue;
+      nb_tasks++;
+    } /* Loop on normal range n */
+  } /* For loop of m */ 
+   if( 0 != nb_tasks ) {
+     (void)parsec_atomic_fetch_add_int32(&__parsec_tp->initial_number_tasks, nb_tasks);
+   }
+  /* Set the range variables for the collision-free hash-computation */
+  __parsec_tp->L_Allocate_m_min   = __jdf2c_m_min;
+  __parsec_tp->L_Allocate_m_range = (__jdf2c_m_max - __jdf2c_m_min) + 1;
+  __parsec_tp->L_Allocate_n_min   = __jdf2c_n_min;
+  __parsec_tp->L_Allocate_n_range = (__jdf2c_n_max - __jdf2c_n_min) + 1;
+    do {
+      this_task->super.list_next = (parsec_list_item_t*)__parsec_tp->startup_queue;
+    } while(!parsec_atomic_cas_ptr(&__parsec_tp->startup_queue, (parsec_list_item_t*)this_task->super.list_next, this_task));
+    this_task->status = PARSEC_TASK_STATUS_HOOK;
+
+  PARSEC_AYU_REGISTER_TASK(&two_dim_band_L_Allocate);
+  __parsec_tp->super.super.dependencies_array[0] = PARSEC_OBJ_NEW(parsec_hash_table_t);
+  parsec_hash_table_init(__parsec_tp->super.super.dependencies_array[0], offsetof(parsec_hashable_dependency_t, ht_item), 10, two_dim_band_two_dim_band_L_Allocate_internal_init_deps_key_functions, this_task->taskpool);
+  __parsec_tp->repositories[0] = data_repo_create_nothreadsafe(nb_tasks, __jdf2c_key_fns_L_Allocate, (parsec_taskpool_t*)__parsec_tp, 2);
+(void)saved_nb_tasks;
+(void)__m_min; (void)__m_max;(void)__n_min; (void)__n_max;  (void)__jdf2c_m_start; (void)__jdf2c_m_end; (void)__jdf2c_m_inc;  (void)__jdf2c_n_start; (void)__jdf2c_n_end; (void)__jdf2c_n_inc;  (void)assignments; (void)__parsec_tp; (void)es;
+  if(1 == parsec_atomic_fetch_dec_int32(&__parsec_tp->sync_point)) {
+    /* Last initialization task complete. Update the number of tasks. */
+    __parsec_tp->super.super.tdm.module->taskpool_addto_nb_tasks(&__parsec_tp->super.super, __parsec_tp->initial_number_tasks);
+    parsec_mfence();  /* write memory barrier to guarantee that the scheduler gets the correct number of tasks */
+    parsec_taskpool_enable((parsec_taskpool_t*)__parsec_tp, &__parsec_tp->startup_queue,
+                           (parsec_task_t*)this_task, es, __parsec_tp->super.super.nb_pending_actions);
+    __parsec_tp->super.super.tdm.module->taskpool_ready(&__parsec_tp->super.super);
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+    PARSEC_PROFILING_TRACE(es->es_profile,
+                           this_task->taskpool->profiling_array[2 * this_task->task_class->task_class_id + 1],
+                           0,
+                           this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    if( 1 >= __parsec_tp->super.super.nb_pending_actions ) {
+        /* if no tasks will be generated let's prevent the runtime from calling the hook and instead go directly to complete the task */
+        this_task->status = PARSEC_TASK_STATUS_COMPLETE;
+    }
+    return PARSEC_HOOK_RETURN_DONE;
+  }
+  return PARSEC_HOOK_RETURN_ASYNC;
+}
+
+static int __jdf2c_startup_L_Allocate(parsec_execution_stream_t * es, __parsec_two_dim_band_L_Allocate_task_t *this_task)
+{
+  __parsec_two_dim_band_L_Allocate_task_t* new_task;
+  __parsec_two_dim_band_internal_taskpool_t* __parsec_tp = (__parsec_two_dim_band_internal_taskpool_t*)this_task->taskpool;
+  parsec_context_t *context = __parsec_tp->super.super.context;
+  int vpid = 0, nb_tasks = 0;
+  size_t total_nb_tasks = 0;
+  parsec_list_item_t* pready_ring[context->nb_vp];
+  int restore_context = 0;
+  int m = this_task->locals.m.value;  /* retrieve value saved during the last iteration */
+  int n = this_task->locals.n.value;  /* retrieve value saved during the last iteration */
+  for(int _i = 0; _i < context->nb_vp; pready_ring[_i++] = NULL );
+  if( 0 != this_task->locals.reserved[0].value ) {
+    this_task->locals.reserved[0].value = 1; /* reset the submission process */
+    restore_context = 1;
+    goto restore_context_0;
+  }
+  this_task->locals.reserved[0].value = 1; /* a sane default value */
+  for(this_task->locals.m.value = m = 1;
+      this_task->locals.m.value <= (((uplo) == (matrix_upper)) ? (0) : ((descY->lmt - 1)));
+      this_task->locals.m.value += 1, m = this_task->locals.m.value) {
+    for(this_task->locals.n.value = n = 0;
+        this_task->locals.n.value <= (m - 1);
+        this_task->locals.n.value += 1, n = this_task->locals.n.value) {
+      if( !L_Allocate_pred(m, n) ) continue;
+  __parsec_two_dim_band_L_Allocate_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_two_dim_band_L_Allocate_parsec_assignment_t*)&this_task->locals;
+  (void)__jdf2c__tmp_locals;
+  /* Flow for Y is always a memory reference */
+      if( NULL != ((parsec_data_collection_t*)__parsec_tp->super._g_descY)->vpid_of ) {
+        vpid = ((parsec_data_collection_t*)__parsec_tp->super._g_descY)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descY, m, n);
+        assert(context->nb_vp >= vpid);
+      } else {
+        vpid = (vpid + 1) % context->nb_vp;  /* spread the initial joy */
+      }
+      new_task = (__parsec_two_dim_band_L_Allocate_task_t*)parsec_thread_mempool_allocate( context->virtual_processes[vpid]->execution_streams[0]->context_mempool );
+      PARSEC_OBJ_CONSTRUCT(new_task, parsec_task_t); /* construct called only when new, force-construct it again */
+      /* Copy only the valid elements from this_task to new_task one */
+      new_task->taskpool   = this_task->taskpool;
+      new_task->task_class = __parsec_tp->super.super.task_classes_array[two_dim_band_L_Allocate.task_class_id];
+      new_task->chore_mask   = PARSEC_DEV_ALL;
+      new_task->locals.m.value = this_task->locals.m.value;
+      new_task->locals.n.value = this_task->locals.n.value;
+      PARSEC_LIST_ITEM_SINGLETON(new_task);
+      new_task->priority = __parsec_tp->super.super.priority;
+      new_task->repo_entry = NULL;
+      new_task->data._f_Y.source_repo_entry = NULL;
+      new_task->data._f_Y.source_repo       = NULL;
+      new_task->data._f_Y.data_in         = NULL;
+      new_task->data._f_Y.data_out        = NULL;
+      new_task->data._f_Y.fulfill         = 0;
+      new_task->data._f_ctl.source_repo_entry = NULL;
+      new_task->data._f_ctl.source_repo       = NULL;
+      new_task->data._f_ctl.data_in         = NULL;
+      new_task->data._f_ctl.data_out        = NULL;
+      new_task->data._f_ctl.fulfill         = 0;
+#if defined(PARSEC_DEBUG_NOISIER)
+      {
+        char tmp[128];
+        PARSEC_DEBUG_VERBOSE(10, parsec_debug_output, "Add startup task %s to vpid %d",
+               parsec_task_snprintf(tmp, 128, (parsec_task_t*)new_task), vpid);
+      }
+#endif
+      parsec_dependencies_mark_task_as_startup((parsec_task_t*)new_task, es);
+      pready_ring[vpid] = parsec_list_item_ring_push_sorted(pready_ring[vpid],
+                                                            (parsec_list_item_t*)new_task,
+                                                            parsec_execution_context_priority_comparator);
+      nb_tasks++;
+     restore_context_0:  /* we jump here just so that we have code after the label */
+      restore_context = 0;
+      (void)restore_context;
+      if( nb_tasks > this_task->locals.reserved[0].value ) {
+        if( (size_t)this_task->locals.reserved[0].value < parsec_task_startup_iter ) this_task->locals.reserved[0].value <<= 1;
+        __parsec_schedule_vp(es, (parsec_task_t**)pready_ring, 0);
+        total_nb_tasks += nb_tasks;
+        nb_tasks = 0;
+        if( total_nb_tasks > parsec_task_startup_chunk ) {  /* stop here and request to be rescheduled */
+          return PARSEC_HOOK_RETURN_AGAIN;
+        }
+      }
+    } /* Loop on normal range n */
+  } /* Loop on normal range m */
+  (void)vpid;
+  if( 0 != nb_tasks ) {
+    __parsec_schedule_vp(es, (parsec_task_t**)pready_ring, 0);
+    nb_tasks = 0;
+  }
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static const __parsec_chore_t __two_dim_band_L_Allocate_chores[] ={
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+    { .type     = PARSEC_DEV_CPU,
+      .evaluate = (parsec_evaluate_function_t*)NULL,
+      .hook     = (parsec_hook_t*)hook_of_two_dim_band_L_Allocate },
+#endif  /* defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+    { .type     = PARSEC_DEV_NONE,
+      .evaluate = NULL,
+      .hook     = (parsec_hook_t*)NULL },  /* End marker */
+};
+
+static const parsec_task_class_t two_dim_band_L_Allocate = {
+  .name = "L_Allocate",
+  .task_class_id = 0,
+  .nb_flows = 2,
+  .nb_parameters = 2,
+  .nb_locals = 2,
+  .task_class_type = PARSEC_TASK_CLASS_TYPE_PTG,
+  .params = { &symb_two_dim_band_L_Allocate_m, &symb_two_dim_band_L_Allocate_n, NULL },
+  .locals = { &symb_two_dim_band_L_Allocate_m, &symb_two_dim_band_L_Allocate_n, NULL },
+  .data_affinity = (parsec_data_ref_fn_t*)affinity_of_two_dim_band_L_Allocate,
+  .initial_data = (parsec_data_ref_fn_t*)affinity_of_two_dim_band_L_Allocate,
+  .final_data = (parsec_data_ref_fn_t*)affinity_of_two_dim_band_L_Allocate,
+  .priority = NULL,
+  .properties = properties_of_two_dim_band_L_Allocate,
+#if MAX_PARAM_COUNT < 1  /* number of read flows of L_Allocate */
+  #error Too many read flows for task L_Allocate
+#endif  /* MAX_PARAM_COUNT */
+#if MAX_PARAM_COUNT < 1  /* number of write flows of L_Allocate */
+  #error Too many write flows for task L_Allocate
+#endif  /* MAX_PARAM_COUNT */
+  .in = { &flow_of_two_dim_band_L_Allocate_for_Y, NULL },
+  .out = { &flow_of_two_dim_band_L_Allocate_for_Y, &flow_of_two_dim_band_L_Allocate_for_ctl, NULL },
+  .flags = 0x0 | PARSEC_HAS_IN_IN_DEPENDENCIES | PARSEC_USE_DEPS_MASK,
+  .dependencies_goal = 0x1,
+  .make_key = __jdf2c_make_key_L_Allocate,
+  .task_snprintf = parsec_task_snprintf,
+#if defined(PARSEC_PROF_TRACE)
+  .profile_info = &parsec_task_profile_info,
+#endif
+  .key_functions = &__jdf2c_key_fns_L_Allocate,
+  .fini = (parsec_hook_t*)NULL,
+  .incarnations = __two_dim_band_L_Allocate_chores,
+  .find_deps = parsec_hash_find_deps,
+  .update_deps = parsec_update_deps_with_mask,
+  .iterate_successors = (parsec_traverse_function_t*)iterate_successors_of_two_dim_band_L_Allocate,
+  .iterate_predecessors = (parsec_traverse_function_t*)NULL,
+  .release_deps = (parsec_release_deps_t*)release_deps_of_two_dim_band_L_Allocate,
+  .prepare_output = (parsec_hook_t*)NULL,
+  .prepare_input = (parsec_hook_t*)data_lookup_of_two_dim_band_L_Allocate,
+  .time_estimate = NULL,
+  .get_datatype = datatype_lookup_of_two_dim_band_L_Allocate,
+  .complete_execution = (parsec_hook_t*)complete_hook_of_two_dim_band_L_Allocate,
+  .release_task = &release_task_of_two_dim_band_L_Allocate,
+#if defined(PARSEC_SIM)
+  .sim_cost_fct = (parsec_sim_cost_fct_t*)NULL,
+#endif
+};
+
+
+static const parsec_task_class_t *two_dim_band_task_classes[] = {
+  &two_dim_band_L_Allocate,
+  &two_dim_band_L_Init,
+  &two_dim_band_U_Allocate,
+  &two_dim_band_U_Init,
+  &two_dim_band_D_Allocate,
+  &two_dim_band_D_Init
+};
+
+static void two_dim_band_startup(parsec_context_t *context, __parsec_two_dim_band_internal_taskpool_t *__parsec_tp, parsec_list_item_t ** ready_tasks)
+{
+  uint32_t i, supported_dev = 0;
+ 
+  for( i = 0; i < parsec_nb_devices; i++ ) {
+    if( !(__parsec_tp->super.super.devices_index_mask & (1<<i)) ) continue;
+    parsec_device_module_t* device = parsec_mca_device_get(i);
+    parsec_data_collection_t* parsec_dc;
+ 
+    if(NULL == device) continue;
+    if(NULL != device->taskpool_register)
+      if( PARSEC_SUCCESS != device->taskpool_register(device, (parsec_taskpool_t*)__parsec_tp) ) {
+        parsec_debug_verbose(5, parsec_debug_output, "Device %s refused to register taskpool %p", device->name, __parsec_tp);
+        __parsec_tp->super.super.devices_index_mask &= ~(1 << device->device_index);
+        continue;
+      }
+    if(NULL != device->memory_register) {  /* Register all the data */
+      parsec_dc = (parsec_data_collection_t*)__parsec_tp->super._g_descY;
+      if( (NULL != parsec_dc->register_memory) &&
+          (PARSEC_SUCCESS != parsec_dc->register_memory(parsec_dc, device)) ) {
+        parsec_debug_verbose(3, parsec_debug_output, "Device %s refused to register memory for data %s (%p) from taskpool %p",
+                     device->name, parsec_dc->key_base, parsec_dc, __parsec_tp);
+        __parsec_tp->super.super.devices_index_mask &= ~(1 << device->device_index);
+      }
+    }
+    supported_dev |= device->type;
+  }
+  /* Remove all the chores without a backend device */
+  for( i = 0; i < PARSEC_two_dim_band_NB_TASK_CLASSES; i++ ) {
+    parsec_task_class_t* tc = (parsec_task_class_t*)__parsec_tp->super.super.task_classes_array[i];
+    __parsec_chore_t* chores = (__parsec_chore_t*)tc->incarnations;
+    uint32_t idx = 0, j;
+    for( j = 0; PARSEC_DEV_NONE != chores[j].type; j++ ) {
+      if( !(supported_dev & chores[j].type) ) continue;
+      if( j != idx ) {
+        chores[idx] = chores[j];
+        parsec_debug_verbose(20, parsec_debug_output, "Device type %i disabled for function %s"
+, chores[j].type, tc->name);
+      }
+      idx++;
+    }
+    chores[idx].type     = PARSEC_DEV_NONE;
+    chores[idx].evaluate = NULL;
+    chores[idx].hook     = NULL;
+    /* Create the initialization tasks for each taskclass */
+    parsec_task_t* task = (parsec_task_t*)parsec_thread_mempool_allocate(context->virtual_processes[0]->execution_streams[0]->context_mempool);
+    PARSEC_OBJ_CONSTRUCT(task, parsec_task_t); /* construct called only when new, force-construct it again */
+    task->taskpool = (parsec_taskpool_t *)__parsec_tp;
+    task->chore_mask = PARSEC_DEV_CPU;
+    memset(&task->locals, 0, sizeof(parsec_assignment_t) * MAX_LOCAL_COUNT);
+    PARSEC_LIST_ITEM_SINGLETON(task);
+    task->priority = -1;
+    task->task_class = task->taskpool->task_classes_array[PARSEC_two_dim_band_NB_TASK_CLASSES + i];
+    int where = i % context->nb_vp;
+    if( NULL == ready_tasks[where] ) ready_tasks[where] = &task->super;
+    else ready_tasks[where] = parsec_list_item_ring_push(ready_tasks[where], &task->super);
+  }
+}
+static void __parsec_two_dim_band_internal_destructor( __parsec_two_dim_band_internal_taskpool_t *__parsec_tp )
+{
+  uint32_t i;
+  parsec_taskpool_unregister( &__parsec_tp->super.super );
+  if(NULL != __parsec_tp->super.super.tdm.module) __parsec_tp->super.super.tdm.module->unmonitor_taskpool(&__parsec_tp->super.super);
+  for( i = 0; i < (uint32_t)(2 * __parsec_tp->super.super.nb_task_classes); i++ ) {  /* Extra startup function added at the end */
+    parsec_task_class_t* tc = (parsec_task_class_t*)__parsec_tp->super.super.task_classes_array[i];
+    free((void*)tc->incarnations);
+    free(tc);
+  }
+  free(__parsec_tp->super.super.task_classes_array); __parsec_tp->super.super.task_classes_array = NULL;
+  __parsec_tp->super.super.nb_task_classes = 0;
+
+  for(i = 0; i < (uint32_t)__parsec_tp->super.arenas_datatypes_size; i++) {
+    if( NULL != __parsec_tp->super.arenas_datatypes[i].arena ) {
+      PARSEC_OBJ_RELEASE(__parsec_tp->super.arenas_datatypes[i].arena);
+    }
+  }
+  /* Destroy the data repositories for this object */
+   data_repo_destroy_nothreadsafe(__parsec_tp->repositories[5]);  /* D_Init */
+   data_repo_destroy_nothreadsafe(__parsec_tp->repositories[4]);  /* D_Allocate */
+   data_repo_destroy_nothreadsafe(__parsec_tp->repositories[3]);  /* U_Init */
+   data_repo_destroy_nothreadsafe(__parsec_tp->repositories[2]);  /* U_Allocate */
+   data_repo_destroy_nothreadsafe(__parsec_tp->repositories[1]);  /* L_Init */
+   data_repo_destroy_nothreadsafe(__parsec_tp->repositories[0]);  /* L_Allocate */
+  /* Release the dependencies arrays for this object */
+  parsec_hash_table_fini( (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[5] );
+  PARSEC_OBJ_RELEASE(__parsec_tp->super.super.dependencies_array[5]);
+  __parsec_tp->super.super.dependencies_array[5] = NULL;
+  parsec_hash_table_fini( (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[4] );
+  PARSEC_OBJ_RELEASE(__parsec_tp->super.super.dependencies_array[4]);
+  __parsec_tp->super.super.dependencies_array[4] = NULL;
+  parsec_hash_table_fini( (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[3] );
+  PARSEC_OBJ_RELEASE(__parsec_tp->super.super.dependencies_array[3]);
+  __parsec_tp->super.super.dependencies_array[3] = NULL;
+  parsec_hash_table_fini( (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[2] );
+  PARSEC_OBJ_RELEASE(__parsec_tp->super.super.dependencies_array[2]);
+  __parsec_tp->super.super.dependencies_array[2] = NULL;
+  parsec_hash_table_fini( (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[1] );
+  PARSEC_OBJ_RELEASE(__parsec_tp->super.super.dependencies_array[1]);
+  __parsec_tp->super.super.dependencies_array[1] = NULL;
+  parsec_hash_table_fini( (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[0] );
+  PARSEC_OBJ_RELEASE(__parsec_tp->super.super.dependencies_array[0]);
+  __parsec_tp->super.super.dependencies_array[0] = NULL;
+  free( __parsec_tp->super.super.dependencies_array );
+  __parsec_tp->super.super.dependencies_array = NULL;
+  /* Unregister all the data */
+  uint32_t _i;
+  for( _i = 0; _i < parsec_nb_devices; _i++ ) {
+    parsec_device_module_t* device;
+    parsec_data_collection_t* parsec_dc;
+    if(!(__parsec_tp->super.super.devices_index_mask & (1 << _i))) continue;
+    if((NULL == (device = parsec_mca_device_get(_i))) || (NULL == device->memory_unregister)) continue;
+    parsec_dc = (parsec_data_collection_t*)__parsec_tp->super._g_descY;
+  if( NULL != parsec_dc->unregister_memory ) { (void)parsec_dc->unregister_memory(parsec_dc, device); };
+}
+  /* Unregister the taskpool from the devices */
+  for( i = 0; i < parsec_nb_devices; i++ ) {
+    if(!(__parsec_tp->super.super.devices_index_mask & (1 << i))) continue;
+    __parsec_tp->super.super.devices_index_mask ^= (1 << i);
+    parsec_device_module_t* device = parsec_mca_device_get(i);
+    if((NULL == device) || (NULL == device->taskpool_unregister)) continue;
+    if( PARSEC_SUCCESS != device->taskpool_unregister(device, &__parsec_tp->super.super) ) continue;
+  }
+  free(__parsec_tp->super.super.taskpool_name); __parsec_tp->super.super.taskpool_name = NULL;
+}
+
+void __parsec_two_dim_band_internal_constructor(__parsec_two_dim_band_internal_taskpool_t* __parsec_tp)
+{
+  parsec_task_class_t* tc;
+  uint32_t i, j;
+
+  __parsec_tp->super.super.nb_task_classes = PARSEC_two_dim_band_NB_TASK_CLASSES;
+  __parsec_tp->super.super.devices_index_mask = PARSEC_DEVICES_ALL;
+  __parsec_tp->super.super.taskpool_name = strdup("two_dim_band");
+  parsec_termdet_open_module(&__parsec_tp->super.super, "local");
+  __parsec_tp->super.super.tdm.module->monitor_taskpool(&__parsec_tp->super.super,
+                                                        parsec_taskpool_termination_detected);
+  __parsec_tp->super.super.update_nb_runtime_task = parsec_add_fetch_runtime_task;
+  __parsec_tp->super.super.dependencies_array = (void **)
+              calloc(__parsec_tp->super.super.nb_task_classes, sizeof(void*));
+  /* Twice the size to hold the startup tasks function_t */
+  __parsec_tp->super.super.task_classes_array = (const parsec_task_class_t**)
+              calloc((2 * PARSEC_two_dim_band_NB_TASK_CLASSES + 1), sizeof(parsec_task_class_t*));
+  __parsec_tp->super.super.tdm.module->taskpool_addto_runtime_actions(&__parsec_tp->super.super, PARSEC_two_dim_band_NB_TASK_CLASSES);  /* for the startup tasks */
+  __parsec_tp->super.super.taskpool_type = PARSEC_TASKPOOL_TYPE_PTG;
+  __parsec_tp->sync_point = __parsec_tp->super.super.nb_task_classes;
+  __parsec_tp->initial_number_tasks = 0;
+  __parsec_tp->startup_queue = NULL;
+  for( i = 0; i < __parsec_tp->super.super.nb_task_classes; i++ ) {
+    __parsec_tp->super.super.task_classes_array[i] = tc = malloc(sizeof(parsec_task_class_t));
+    memcpy(tc, two_dim_band_task_classes[i], sizeof(parsec_task_class_t));
+    for( j = 0; PARSEC_DEV_NONE != tc->incarnations[j].type; j++);  /* compute the number of incarnations */
+    tc->incarnations = (__parsec_chore_t*)malloc((j+1) * sizeof(__parsec_chore_t));
+        memcpy((__parsec_chore_t*)tc->incarnations, two_dim_band_task_classes[i]->incarnations, (j+1) * sizeof(__parsec_chore_t));
+
+    /* Add a placeholder for initialization and startup task */
+    __parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+i] = tc = (parsec_task_class_t*)malloc(sizeof(parsec_task_class_t));
+    memcpy(tc, (void*)&__parsec_generic_startup, sizeof(parsec_task_class_t));
+    tc->task_class_id = __parsec_tp->super.super.nb_task_classes + i;
+    tc->incarnations = (__parsec_chore_t*)malloc(2 * sizeof(__parsec_chore_t));
+    memcpy((__parsec_chore_t*)tc->incarnations, (void*)__parsec_generic_startup.incarnations, 2 * sizeof(__parsec_chore_t));
+    tc->release_task = parsec_release_task_to_mempool_and_count_as_runtime_tasks;
+  }
+  /* Startup task for D_Init */
+  tc = (parsec_task_class_t *)__parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+0];
+  tc->name = "Startup for D_Init";
+  tc->prepare_input = (parsec_hook_t*)two_dim_band_D_Init_internal_init;
+  /* Startup task for D_Allocate */
+  tc = (parsec_task_class_t *)__parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+1];
+  tc->name = "Startup for D_Allocate";
+  tc->prepare_input = (parsec_hook_t*)two_dim_band_D_Allocate_internal_init;
+  ((__parsec_chore_t*)&tc->incarnations[0])->hook = (parsec_hook_t *)__jdf2c_startup_D_Allocate;
+  /* Startup task for U_Init */
+  tc = (parsec_task_class_t *)__parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+2];
+  tc->name = "Startup for U_Init";
+  tc->prepare_input = (parsec_hook_t*)two_dim_band_U_Init_internal_init;
+  /* Startup task for U_Allocate */
+  tc = (parsec_task_class_t *)__parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+3];
+  tc->name = "Startup for U_Allocate";
+  tc->prepare_input = (parsec_hook_t*)two_dim_band_U_Allocate_internal_init;
+  ((__parsec_chore_t*)&tc->incarnations[0])->hook = (parsec_hook_t *)__jdf2c_startup_U_Allocate;
+  /* Startup task for L_Init */
+  tc = (parsec_task_class_t *)__parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+4];
+  tc->name = "Startup for L_Init";
+  tc->prepare_input = (parsec_hook_t*)two_dim_band_L_Init_internal_init;
+  /* Startup task for L_Allocate */
+  tc = (parsec_task_class_t *)__parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+5];
+  tc->name = "Startup for L_Allocate";
+  tc->prepare_input = (parsec_hook_t*)two_dim_band_L_Allocate_internal_init;
+  ((__parsec_chore_t*)&tc->incarnations[0])->hook = (parsec_hook_t *)__jdf2c_startup_L_Allocate;
+  /* Compute the number of arenas_datatypes: */
+  /*   PARSEC_two_dim_band_DEFAULT_ARENA  ->  0 */
+  __parsec_tp->super.arenas_datatypes_size = 1;
+  memset(&__parsec_tp->super.arenas_datatypes[0], 0, __parsec_tp->super.arenas_datatypes_size*sizeof(parsec_arena_datatype_t));
+  /* If profiling is enabled, the keys for profiling */
+#  if defined(PARSEC_PROF_TRACE)
+  __parsec_tp->super.super.profiling_array = two_dim_band_profiling_array;
+  if( -2 == two_dim_band_profiling_array[0] ) {
+    #if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+parsec_profiling_add_dictionary_keyword("two_dim_band::D_Init::internal init", "fill:34D8D8",
+                                       0,
+                                       NULL,
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(two_dim_band_D_Init.task_class_id  + PARSEC_two_dim_band_NB_TASK_CLASSES)/* D_Init (internal init) start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(two_dim_band_D_Init.task_class_id  + PARSEC_two_dim_band_NB_TASK_CLASSES)/* D_Init (internal init) end key */]);
+#endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+parsec_profiling_add_dictionary_keyword("two_dim_band::D_Init", "fill:CC2828",
+                                       sizeof(parsec_task_prof_info_t)+1*sizeof(parsec_assignment_t),
+                                       "dc_key{uint64_t};priority{int32_t};dc_dataid{uint32_t};tcid{uint32_t};trc{int32_t};m{int32_t}",
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(two_dim_band_D_Init.task_class_id) /* D_Init start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(two_dim_band_D_Init.task_class_id) /* D_Init end key */]);
+
+    #if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+parsec_profiling_add_dictionary_keyword("two_dim_band::D_Allocate::internal init", "fill:3434D8",
+                                       0,
+                                       NULL,
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(two_dim_band_D_Allocate.task_class_id  + PARSEC_two_dim_band_NB_TASK_CLASSES)/* D_Allocate (internal init) start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(two_dim_band_D_Allocate.task_class_id  + PARSEC_two_dim_band_NB_TASK_CLASSES)/* D_Allocate (internal init) end key */]);
+#endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+parsec_profiling_add_dictionary_keyword("two_dim_band::D_Allocate", "fill:CCCC28",
+                                       sizeof(parsec_task_prof_info_t)+1*sizeof(parsec_assignment_t),
+                                       "dc_key{uint64_t};priority{int32_t};dc_dataid{uint32_t};tcid{uint32_t};trc{int32_t};m{int32_t}",
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(two_dim_band_D_Allocate.task_class_id) /* D_Allocate start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(two_dim_band_D_Allocate.task_class_id) /* D_Allocate end key */]);
+
+    #if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+parsec_profiling_add_dictionary_keyword("two_dim_band::U_Init::internal init", "fill:D834D8",
+                                       0,
+                                       NULL,
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(two_dim_band_U_Init.task_class_id  + PARSEC_two_dim_band_NB_TASK_CLASSES)/* U_Init (internal init) start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(two_dim_band_U_Init.task_class_id  + PARSEC_two_dim_band_NB_TASK_CLASSES)/* U_Init (internal init) end key */]);
+#endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+parsec_profiling_add_dictionary_keyword("two_dim_band::U_Init", "fill:28CC28",
+                                       sizeof(parsec_task_prof_info_t)+2*sizeof(parsec_assignment_t),
+                                       "dc_key{uint64_t};priority{int32_t};dc_dataid{uint32_t};tcid{uint32_t};trc{int32_t};m{int32_t};n{int32_t}",
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(two_dim_band_U_Init.task_class_id) /* U_Init start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(two_dim_band_U_Init.task_class_id) /* U_Init end key */]);
+
+    #if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+parsec_profiling_add_dictionary_keyword("two_dim_band::U_Allocate::internal init", "fill:D83434",
+                                       0,
+                                       NULL,
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(two_dim_band_U_Allocate.task_class_id  + PARSEC_two_dim_band_NB_TASK_CLASSES)/* U_Allocate (internal init) start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(two_dim_band_U_Allocate.task_class_id  + PARSEC_two_dim_band_NB_TASK_CLASSES)/* U_Allocate (internal init) end key */]);
+#endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+parsec_profiling_add_dictionary_keyword("two_dim_band::U_Allocate", "fill:28CCCC",
+                                       sizeof(parsec_task_prof_info_t)+2*sizeof(parsec_assignment_t),
+                                       "dc_key{uint64_t};priority{int32_t};dc_dataid{uint32_t};tcid{uint32_t};trc{int32_t};m{int32_t};n{int32_t}",
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(two_dim_band_U_Allocate.task_class_id) /* U_Allocate start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(two_dim_band_U_Allocate.task_class_id) /* U_Allocate end key */]);
+
+    #if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+parsec_profiling_add_dictionary_keyword("two_dim_band::L_Init::internal init", "fill:D8D834",
+                                       0,
+                                       NULL,
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(two_dim_band_L_Init.task_class_id  + PARSEC_two_dim_band_NB_TASK_CLASSES)/* L_Init (internal init) start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(two_dim_band_L_Init.task_class_id  + PARSEC_two_dim_band_NB_TASK_CLASSES)/* L_Init (internal init) end key */]);
+#endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+parsec_profiling_add_dictionary_keyword("two_dim_band::L_Init", "fill:2828CC",
+                                       sizeof(parsec_task_prof_info_t)+2*sizeof(parsec_assignment_t),
+                                       "dc_key{uint64_t};priority{int32_t};dc_dataid{uint32_t};tcid{uint32_t};trc{int32_t};m{int32_t};n{int32_t}",
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(two_dim_band_L_Init.task_class_id) /* L_Init start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(two_dim_band_L_Init.task_class_id) /* L_Init end key */]);
+
+    #if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+parsec_profiling_add_dictionary_keyword("two_dim_band::L_Allocate::internal init", "fill:34D834",
+                                       0,
+                                       NULL,
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(two_dim_band_L_Allocate.task_class_id  + PARSEC_two_dim_band_NB_TASK_CLASSES)/* L_Allocate (internal init) start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(two_dim_band_L_Allocate.task_class_id  + PARSEC_two_dim_band_NB_TASK_CLASSES)/* L_Allocate (internal init) end key */]);
+#endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+parsec_profiling_add_dictionary_keyword("two_dim_band::L_Allocate", "fill:CC28CC",
+                                       sizeof(parsec_task_prof_info_t)+2*sizeof(parsec_assignment_t),
+                                       "dc_key{uint64_t};priority{int32_t};dc_dataid{uint32_t};tcid{uint32_t};trc{int32_t};m{int32_t};n{int32_t}",
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(two_dim_band_L_Allocate.task_class_id) /* L_Allocate start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(two_dim_band_L_Allocate.task_class_id) /* L_Allocate end key */]);
+
+  }
+#  endif /* defined(PARSEC_PROF_TRACE) */
+  __parsec_tp->super.super.repo_array = __parsec_tp->repositories;
+  __parsec_tp->super.super.startup_hook = (parsec_startup_fn_t)two_dim_band_startup;
+  (void)parsec_taskpool_reserve_id((parsec_taskpool_t*)__parsec_tp);
+}
+
+  /** Generate class declaration and instance using the above constructor and destructor */
+  PARSEC_OBJ_CLASS_DECLARATION(__parsec_two_dim_band_internal_taskpool_t);
+  PARSEC_OBJ_CLASS_INSTANCE(__parsec_two_dim_band_internal_taskpool_t, parsec_two_dim_band_taskpool_t,
+                            __parsec_two_dim_band_internal_constructor, __parsec_two_dim_band_internal_destructor);
+
+#undef descY
+#undef uplo
+#undef matrix_upper
+#undef matrix_lower
+
+parsec_two_dim_band_taskpool_t *parsec_two_dim_band_new(parsec_tiled_matrix_t* descY /* data descY */, int uplo)
+{
+  __parsec_two_dim_band_internal_taskpool_t *__parsec_tp = PARSEC_OBJ_NEW(__parsec_two_dim_band_internal_taskpool_t);
+  /* Dump the hidden parameters with default values */
+  int matrix_upper;
+  int matrix_lower;
+  /* Now the Parameter-dependent structures: */
+  __parsec_tp->super._g_descY = descY;
+  __parsec_tp->super._g_uplo = uplo;
+  __parsec_tp->super._g_matrix_upper = matrix_upper = PARSEC_MATRIX_UPPER;
+  __parsec_tp->super._g_matrix_lower = matrix_lower = PARSEC_MATRIX_LOWER;
+  PARSEC_AYU_REGISTER_TASK(&two_dim_band_D_Init);
+  PARSEC_AYU_REGISTER_TASK(&two_dim_band_D_Allocate);
+  PARSEC_AYU_REGISTER_TASK(&two_dim_band_U_Init);
+  PARSEC_AYU_REGISTER_TASK(&two_dim_band_U_Allocate);
+  PARSEC_AYU_REGISTER_TASK(&two_dim_band_L_Init);
+  PARSEC_AYU_REGISTER_TASK(&two_dim_band_L_Allocate);
+  __parsec_tp->super.super.startup_hook = (parsec_startup_fn_t)two_dim_band_startup;
+  (void)parsec_taskpool_reserve_id((parsec_taskpool_t*)__parsec_tp);
+/* Prevent warnings related to not used hidden global variables */
+  (void)matrix_upper;  (void)matrix_lower;
+  return (parsec_two_dim_band_taskpool_t*)__parsec_tp;
+}
+
+
+/**
+ * @param [in] Y:    the data, already distributed and allocated
+ * @param [in] uplo: Upper / Lower / UpperLower
+ * @return the parsec object to schedule.
+ */
+parsec_taskpool_t*
+parsec_two_dim_band_New(parsec_tiled_matrix_t *Y, int uplo)
+{
+    parsec_taskpool_t* two_dim_band_taskpool;
+    parsec_two_dim_band_taskpool_t* taskpool = NULL;
+
+    taskpool = parsec_two_dim_band_new(Y, uplo);
+    two_dim_band_taskpool = (parsec_taskpool_t*)taskpool;
+
+    parsec_add2arena( &taskpool->arenas_datatypes[PARSEC_two_dim_band_DEFAULT_ADT_IDX],
+                             parsec_datatype_double_t, PARSEC_MATRIX_FULL,
+                             1, Y->mb, Y->nb, Y->mb,
+                             PARSEC_ARENA_ALIGNMENT_SSE, -1 );
+    return two_dim_band_taskpool;
+}
+
+/**
+ * @param [inout] the parsec object to destroy
+*/
+void parsec_two_dim_band_Destruct(parsec_taskpool_t *taskpool)
+{
+    parsec_two_dim_band_taskpool_t *two_dim_band_taskpool = (parsec_two_dim_band_taskpool_t *)taskpool;
+    parsec_del2arena(&two_dim_band_taskpool->arenas_datatypes[PARSEC_two_dim_band_DEFAULT_ADT_IDX]);
+    parsec_taskpool_free(taskpool);
+}
+
+/**
+ * @brief Init dcY
+ *
+ * @param [inout] dcY: the data, already distributed and allocated
+ * @param [in] uplo: Upper / Lower / UpperLower
+ */
+int parsec_two_dim_band_test(parsec_context_t *parsec,
+                             parsec_tiled_matrix_t *dcY, int uplo)
+{
+    parsec_taskpool_t *parsec_two_dim_band = NULL;
+
+    parsec_two_dim_band = parsec_two_dim_band_New(
+                               (parsec_tiled_matrix_t *)dcY, uplo);
+
+    if( parsec_two_dim_band != NULL ){
+        parsec_enqueue(parsec, parsec_two_dim_band);
+        parsec_context_start(parsec);
+        parsec_context_wait(parsec);
+        parsec_two_dim_band_Destruct(parsec_two_dim_band);
+    }
+
+    return 0;
+}
+
+PARSEC_OBJ_CLASS_INSTANCE(parsec_two_dim_band_taskpool_t, parsec_taskpool_t, NULL, NULL);
+
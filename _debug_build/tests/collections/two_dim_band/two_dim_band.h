@@ -0,0 +1,216 @@
+#ifndef _two_dim_band_h_
+#define _two_dim_band_h_
+#include "parsec.h"
+#include "parsec/parsec_internal.h"
+#include "parsec/remote_dep.h"
+
+BEGIN_C_DECLS
+
+#define PARSEC_two_dim_band_DEFAULT_ADT_IDX    0
+#define PARSEC_two_dim_band_ADT_IDX_MAX       1
+typedef struct parsec_two_dim_band_taskpool_s {
+  parsec_taskpool_t super;
+  /* The list of globals */
+  parsec_tiled_matrix_t* _g_descY /* data descY */;
+  int _g_uplo;
+  int _g_matrix_upper;
+  int _g_matrix_lower;
+  /* The array of datatypes (DEFAULT and co.) */
+  parsec_arena_datatype_t arenas_datatypes[PARSEC_two_dim_band_ADT_IDX_MAX];
+  uint32_t arenas_datatypes_size;
+} parsec_two_dim_band_taskpool_t;
+
+/** Beware that this object is not a superset of the internal object, and as a result
+ *  we should never create one directly. Instead we should rely on the creation of the
+ *  internal object (__parsec_two_dim_band_taskpool_t).
+ */
+PARSEC_OBJ_CLASS_DECLARATION(parsec_two_dim_band_taskpool_t);
+extern parsec_two_dim_band_taskpool_t *parsec_two_dim_band_new(parsec_tiled_matrix_t* _g_descY /* data descY */, int _g_uplo);
+
+#if MAX_LOCAL_COUNT < 1  /* number of parameters and locals D_Init */
+  #error Too many parameters and local variables (1 out of MAX_LOCAL_COUNT) for task D_Init
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_two_dim_band_D_Init_assignment_s {
+  parsec_assignment_t m;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-1];
+} __parsec_two_dim_band_D_Init_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 2  /* total number of flows for task D_Init */
+  #error Too many flows (2 out of MAX_PARAM_COUNT) for task D_Init
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_two_dim_band_D_Init_data_s {
+  parsec_data_pair_t _f_Y;
+  parsec_data_pair_t _f_ctl;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-2];
+} __parsec_two_dim_band_D_Init_data_t;
+
+typedef struct __parsec_two_dim_band_D_Init_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_two_dim_band_D_Init_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_two_dim_band_D_Init_data_s data;
+} __parsec_two_dim_band_D_Init_task_t;
+
+
+#if MAX_LOCAL_COUNT < 1  /* number of parameters and locals D_Allocate */
+  #error Too many parameters and local variables (1 out of MAX_LOCAL_COUNT) for task D_Allocate
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_two_dim_band_D_Allocate_assignment_s {
+  parsec_assignment_t m;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-1];
+} __parsec_two_dim_band_D_Allocate_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 2  /* total number of flows for task D_Allocate */
+  #error Too many flows (2 out of MAX_PARAM_COUNT) for task D_Allocate
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_two_dim_band_D_Allocate_data_s {
+  parsec_data_pair_t _f_Y;
+  parsec_data_pair_t _f_ctl;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-2];
+} __parsec_two_dim_band_D_Allocate_data_t;
+
+typedef struct __parsec_two_dim_band_D_Allocate_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_two_dim_band_D_Allocate_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_two_dim_band_D_Allocate_data_s data;
+} __parsec_two_dim_band_D_Allocate_task_t;
+
+
+#if MAX_LOCAL_COUNT < 2  /* number of parameters and locals U_Init */
+  #error Too many parameters and local variables (2 out of MAX_LOCAL_COUNT) for task U_Init
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_two_dim_band_U_Init_assignment_s {
+  parsec_assignment_t m;
+  parsec_assignment_t n;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-2];
+} __parsec_two_dim_band_U_Init_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 2  /* total number of flows for task U_Init */
+  #error Too many flows (2 out of MAX_PARAM_COUNT) for task U_Init
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_two_dim_band_U_Init_data_s {
+  parsec_data_pair_t _f_Y;
+  parsec_data_pair_t _f_ctl;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-2];
+} __parsec_two_dim_band_U_Init_data_t;
+
+typedef struct __parsec_two_dim_band_U_Init_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_two_dim_band_U_Init_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_two_dim_band_U_Init_data_s data;
+} __parsec_two_dim_band_U_Init_task_t;
+
+
+#if MAX_LOCAL_COUNT < 2  /* number of parameters and locals U_Allocate */
+  #error Too many parameters and local variables (2 out of MAX_LOCAL_COUNT) for task U_Allocate
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_two_dim_band_U_Allocate_assignment_s {
+  parsec_assignment_t m;
+  parsec_assignment_t n;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-2];
+} __parsec_two_dim_band_U_Allocate_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 2  /* total number of flows for task U_Allocate */
+  #error Too many flows (2 out of MAX_PARAM_COUNT) for task U_Allocate
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_two_dim_band_U_Allocate_data_s {
+  parsec_data_pair_t _f_Y;
+  parsec_data_pair_t _f_ctl;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-2];
+} __parsec_two_dim_band_U_Allocate_data_t;
+
+typedef struct __parsec_two_dim_band_U_Allocate_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_two_dim_band_U_Allocate_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_two_dim_band_U_Allocate_data_s data;
+} __parsec_two_dim_band_U_Allocate_task_t;
+
+
+#if MAX_LOCAL_COUNT < 2  /* number of parameters and locals L_Init */
+  #error Too many parameters and local variables (2 out of MAX_LOCAL_COUNT) for task L_Init
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_two_dim_band_L_Init_assignment_s {
+  parsec_assignment_t m;
+  parsec_assignment_t n;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-2];
+} __parsec_two_dim_band_L_Init_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 2  /* total number of flows for task L_Init */
+  #error Too many flows (2 out of MAX_PARAM_COUNT) for task L_Init
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_two_dim_band_L_Init_data_s {
+  parsec_data_pair_t _f_Y;
+  parsec_data_pair_t _f_ctl;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-2];
+} __parsec_two_dim_band_L_Init_data_t;
+
+typedef struct __parsec_two_dim_band_L_Init_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_two_dim_band_L_Init_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_two_dim_band_L_Init_data_s data;
+} __parsec_two_dim_band_L_Init_task_t;
+
+
+#if MAX_LOCAL_COUNT < 2  /* number of parameters and locals L_Allocate */
+  #error Too many parameters and local variables (2 out of MAX_LOCAL_COUNT) for task L_Allocate
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_two_dim_band_L_Allocate_assignment_s {
+  parsec_assignment_t m;
+  parsec_assignment_t n;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-2];
+} __parsec_two_dim_band_L_Allocate_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 2  /* total number of flows for task L_Allocate */
+  #error Too many flows (2 out of MAX_PARAM_COUNT) for task L_Allocate
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_two_dim_band_L_Allocate_data_s {
+  parsec_data_pair_t _f_Y;
+  parsec_data_pair_t _f_ctl;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-2];
+} __parsec_two_dim_band_L_Allocate_data_t;
+
+typedef struct __parsec_two_dim_band_L_Allocate_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_two_dim_band_L_Allocate_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_two_dim_band_L_Allocate_data_s data;
+} __parsec_two_dim_band_L_Allocate_task_t;
+
+
+END_C_DECLS
+
+#endif /* _two_dim_band_h_ */ 
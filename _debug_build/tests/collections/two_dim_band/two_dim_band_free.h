@@ -0,0 +1,120 @@
+#ifndef _two_dim_band_free_h_
+#define _two_dim_band_free_h_
+#include "parsec.h"
+#include "parsec/parsec_internal.h"
+#include "parsec/remote_dep.h"
+
+BEGIN_C_DECLS
+
+#define PARSEC_two_dim_band_free_ADT_IDX_MAX       0
+typedef struct parsec_two_dim_band_free_taskpool_s {
+  parsec_taskpool_t super;
+  /* The list of globals */
+  parsec_tiled_matrix_t* _g_descY /* data descY */;
+  int _g_uplo;
+  int _g_matrix_upper;
+  int _g_matrix_lower;
+  /* The array of datatypes ( and co.) */
+  parsec_arena_datatype_t arenas_datatypes[PARSEC_two_dim_band_free_ADT_IDX_MAX];
+  uint32_t arenas_datatypes_size;
+} parsec_two_dim_band_free_taskpool_t;
+
+/** Beware that this object is not a superset of the internal object, and as a result
+ *  we should never create one directly. Instead we should rely on the creation of the
+ *  internal object (__parsec_two_dim_band_free_taskpool_t).
+ */
+PARSEC_OBJ_CLASS_DECLARATION(parsec_two_dim_band_free_taskpool_t);
+extern parsec_two_dim_band_free_taskpool_t *parsec_two_dim_band_free_new(parsec_tiled_matrix_t* _g_descY /* data descY */, int _g_uplo);
+
+#if MAX_LOCAL_COUNT < 1  /* number of parameters and locals D_Free */
+  #error Too many parameters and local variables (1 out of MAX_LOCAL_COUNT) for task D_Free
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_two_dim_band_free_D_Free_assignment_s {
+  parsec_assignment_t m;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-1];
+} __parsec_two_dim_band_free_D_Free_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 0  /* total number of flows for task D_Free */
+  #error Too many flows (0 out of MAX_PARAM_COUNT) for task D_Free
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_two_dim_band_free_D_Free_data_s {
+;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-0];
+} __parsec_two_dim_band_free_D_Free_data_t;
+
+typedef struct __parsec_two_dim_band_free_D_Free_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_two_dim_band_free_D_Free_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_two_dim_band_free_D_Free_data_s data;
+} __parsec_two_dim_band_free_D_Free_task_t;
+
+
+#if MAX_LOCAL_COUNT < 2  /* number of parameters and locals U_Free */
+  #error Too many parameters and local variables (2 out of MAX_LOCAL_COUNT) for task U_Free
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_two_dim_band_free_U_Free_assignment_s {
+  parsec_assignment_t m;
+  parsec_assignment_t n;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-2];
+} __parsec_two_dim_band_free_U_Free_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 0  /* total number of flows for task U_Free */
+  #error Too many flows (0 out of MAX_PARAM_COUNT) for task U_Free
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_two_dim_band_free_U_Free_data_s {
+;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-0];
+} __parsec_two_dim_band_free_U_Free_data_t;
+
+typedef struct __parsec_two_dim_band_free_U_Free_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_two_dim_band_free_U_Free_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_two_dim_band_free_U_Free_data_s data;
+} __parsec_two_dim_band_free_U_Free_task_t;
+
+
+#if MAX_LOCAL_COUNT < 2  /* number of parameters and locals L_Free */
+  #error Too many parameters and local variables (2 out of MAX_LOCAL_COUNT) for task L_Free
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_two_dim_band_free_L_Free_assignment_s {
+  parsec_assignment_t m;
+  parsec_assignment_t n;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-2];
+} __parsec_two_dim_band_free_L_Free_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 0  /* total number of flows for task L_Free */
+  #error Too many flows (0 out of MAX_PARAM_COUNT) for task L_Free
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_two_dim_band_free_L_Free_data_s {
+;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-0];
+} __parsec_two_dim_band_free_L_Free_data_t;
+
+typedef struct __parsec_two_dim_band_free_L_Free_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_two_dim_band_free_L_Free_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_two_dim_band_free_L_Free_data_s data;
+} __parsec_two_dim_band_free_L_Free_task_t;
+
+
+END_C_DECLS
+
+#endif /* _two_dim_band_free_h_ */ 
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dtd_test_allreduce.dir/dtd_test_allreduce.c.o"
+  "CMakeFiles/dtd_test_allreduce.dir/dtd_test_allreduce.c.o.d"
+  "dtd_test_allreduce"
+  "dtd_test_allreduce.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dtd_test_allreduce.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
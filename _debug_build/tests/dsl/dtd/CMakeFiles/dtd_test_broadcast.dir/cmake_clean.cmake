@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dtd_test_broadcast.dir/dtd_test_broadcast.c.o"
+  "CMakeFiles/dtd_test_broadcast.dir/dtd_test_broadcast.c.o.d"
+  "dtd_test_broadcast"
+  "dtd_test_broadcast.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dtd_test_broadcast.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dtd_test_ce.dir/dtd_test_ce.c.o"
+  "CMakeFiles/dtd_test_ce.dir/dtd_test_ce.c.o.d"
+  "dtd_test_ce"
+  "dtd_test_ce.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dtd_test_ce.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dtd_test_data_flush.dir/dtd_test_data_flush.c.o"
+  "CMakeFiles/dtd_test_data_flush.dir/dtd_test_data_flush.c.o.d"
+  "dtd_test_data_flush"
+  "dtd_test_data_flush.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dtd_test_data_flush.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dtd_test_empty.dir/dtd_test_empty.c.o"
+  "CMakeFiles/dtd_test_empty.dir/dtd_test_empty.c.o.d"
+  "dtd_test_empty"
+  "dtd_test_empty.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dtd_test_empty.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dtd_test_explicit_task_creation.dir/dtd_test_explicit_task_creation.c.o"
+  "CMakeFiles/dtd_test_explicit_task_creation.dir/dtd_test_explicit_task_creation.c.o.d"
+  "dtd_test_explicit_task_creation"
+  "dtd_test_explicit_task_creation.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dtd_test_explicit_task_creation.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dtd_test_flag_dont_track.dir/dtd_test_flag_dont_track.c.o"
+  "CMakeFiles/dtd_test_flag_dont_track.dir/dtd_test_flag_dont_track.c.o.d"
+  "dtd_test_flag_dont_track"
+  "dtd_test_flag_dont_track.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dtd_test_flag_dont_track.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
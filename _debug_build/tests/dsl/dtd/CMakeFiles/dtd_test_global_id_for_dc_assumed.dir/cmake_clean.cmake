@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dtd_test_global_id_for_dc_assumed.dir/dtd_test_global_id_for_dc_assumed.c.o"
+  "CMakeFiles/dtd_test_global_id_for_dc_assumed.dir/dtd_test_global_id_for_dc_assumed.c.o.d"
+  "dtd_test_global_id_for_dc_assumed"
+  "dtd_test_global_id_for_dc_assumed.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dtd_test_global_id_for_dc_assumed.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
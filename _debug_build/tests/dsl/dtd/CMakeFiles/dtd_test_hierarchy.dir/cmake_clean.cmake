@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dtd_test_hierarchy.dir/dtd_test_hierarchy.c.o"
+  "CMakeFiles/dtd_test_hierarchy.dir/dtd_test_hierarchy.c.o.d"
+  "dtd_test_hierarchy"
+  "dtd_test_hierarchy.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dtd_test_hierarchy.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dtd_test_insert_task_interface.dir/dtd_test_insert_task_interface.c.o"
+  "CMakeFiles/dtd_test_insert_task_interface.dir/dtd_test_insert_task_interface.c.o.d"
+  "dtd_test_insert_task_interface"
+  "dtd_test_insert_task_interface.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dtd_test_insert_task_interface.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
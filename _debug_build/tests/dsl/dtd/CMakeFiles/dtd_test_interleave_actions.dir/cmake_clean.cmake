@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dtd_test_interleave_actions.dir/dtd_test_interleave_actions.c.o"
+  "CMakeFiles/dtd_test_interleave_actions.dir/dtd_test_interleave_actions.c.o.d"
+  "dtd_test_interleave_actions"
+  "dtd_test_interleave_actions.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dtd_test_interleave_actions.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dtd_test_multiple_handle_wait.dir/dtd_test_multiple_handle_wait.c.o"
+  "CMakeFiles/dtd_test_multiple_handle_wait.dir/dtd_test_multiple_handle_wait.c.o.d"
+  "dtd_test_multiple_handle_wait"
+  "dtd_test_multiple_handle_wait.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dtd_test_multiple_handle_wait.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
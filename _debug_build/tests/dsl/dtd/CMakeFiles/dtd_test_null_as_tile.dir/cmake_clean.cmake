@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dtd_test_null_as_tile.dir/dtd_test_null_as_tile.c.o"
+  "CMakeFiles/dtd_test_null_as_tile.dir/dtd_test_null_as_tile.c.o.d"
+  "dtd_test_null_as_tile"
+  "dtd_test_null_as_tile.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dtd_test_null_as_tile.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
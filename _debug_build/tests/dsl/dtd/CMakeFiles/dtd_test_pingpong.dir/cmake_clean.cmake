@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dtd_test_pingpong.dir/dtd_test_pingpong.c.o"
+  "CMakeFiles/dtd_test_pingpong.dir/dtd_test_pingpong.c.o.d"
+  "dtd_test_pingpong"
+  "dtd_test_pingpong.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dtd_test_pingpong.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
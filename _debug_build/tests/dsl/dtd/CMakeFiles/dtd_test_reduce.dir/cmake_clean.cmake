@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dtd_test_reduce.dir/dtd_test_reduce.c.o"
+  "CMakeFiles/dtd_test_reduce.dir/dtd_test_reduce.c.o.d"
+  "dtd_test_reduce"
+  "dtd_test_reduce.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dtd_test_reduce.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
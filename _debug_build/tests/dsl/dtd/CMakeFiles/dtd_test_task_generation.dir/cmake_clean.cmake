@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dtd_test_task_generation.dir/dtd_test_task_generation.c.o"
+  "CMakeFiles/dtd_test_task_generation.dir/dtd_test_task_generation.c.o.d"
+  "dtd_test_task_generation"
+  "dtd_test_task_generation.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dtd_test_task_generation.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dtd_test_task_inserting_task.dir/dtd_test_task_inserting_task.c.o"
+  "CMakeFiles/dtd_test_task_inserting_task.dir/dtd_test_task_inserting_task.c.o.d"
+  "dtd_test_task_inserting_task"
+  "dtd_test_task_inserting_task.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dtd_test_task_inserting_task.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
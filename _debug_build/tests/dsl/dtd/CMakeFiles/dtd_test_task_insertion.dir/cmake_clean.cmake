@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dtd_test_task_insertion.dir/dtd_test_task_insertion.c.o"
+  "CMakeFiles/dtd_test_task_insertion.dir/dtd_test_task_insertion.c.o.d"
+  "dtd_test_task_insertion"
+  "dtd_test_task_insertion.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dtd_test_task_insertion.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
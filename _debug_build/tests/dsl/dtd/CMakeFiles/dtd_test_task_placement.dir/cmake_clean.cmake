@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dtd_test_task_placement.dir/dtd_test_task_placement.c.o"
+  "CMakeFiles/dtd_test_task_placement.dir/dtd_test_task_placement.c.o.d"
+  "dtd_test_task_placement"
+  "dtd_test_task_placement.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dtd_test_task_placement.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dtd_test_template_counter.dir/dtd_test_template_counter.c.o"
+  "CMakeFiles/dtd_test_template_counter.dir/dtd_test_template_counter.c.o.d"
+  "dtd_test_template_counter"
+  "dtd_test_template_counter.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dtd_test_template_counter.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dtd_test_tp_enqueue_dequeue.dir/dtd_test_tp_enqueue_dequeue.c.o"
+  "CMakeFiles/dtd_test_tp_enqueue_dequeue.dir/dtd_test_tp_enqueue_dequeue.c.o.d"
+  "dtd_test_tp_enqueue_dequeue"
+  "dtd_test_tp_enqueue_dequeue.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dtd_test_tp_enqueue_dequeue.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
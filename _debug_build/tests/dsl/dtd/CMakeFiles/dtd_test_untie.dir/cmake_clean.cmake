@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dtd_test_untie.dir/dtd_test_untie.c.o"
+  "CMakeFiles/dtd_test_untie.dir/dtd_test_untie.c.o.d"
+  "dtd_test_untie"
+  "dtd_test_untie.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dtd_test_untie.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
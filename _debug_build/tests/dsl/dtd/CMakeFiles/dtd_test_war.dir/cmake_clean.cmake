@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dtd_test_war.dir/dtd_test_war.c.o"
+  "CMakeFiles/dtd_test_war.dir/dtd_test_war.c.o.d"
+  "dtd_test_war"
+  "dtd_test_war.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dtd_test_war.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/complex_deps.dir/complex_deps.c.o"
+  "CMakeFiles/complex_deps.dir/complex_deps.c.o.d"
+  "complex_deps"
+  "complex_deps.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/complex_deps.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/fusion.dir/fusion.c.o"
+  "CMakeFiles/fusion.dir/fusion.c.o.d"
+  "fusion"
+  "fusion.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/fusion.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
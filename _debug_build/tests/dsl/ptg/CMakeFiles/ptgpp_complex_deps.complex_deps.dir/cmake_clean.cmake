@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ptgpp_complex_deps.complex_deps"
+  "complex_deps.c"
+  "complex_deps.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ptgpp_complex_deps.complex_deps.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ptgpp_fusion.fusion"
+  "fusion.c"
+  "fusion.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ptgpp_fusion.fusion.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ptgpp_recursive.recursive"
+  "recursive.c"
+  "recursive.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ptgpp_recursive.recursive.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ptgpp_single_consumer.single_consumer"
+  "single_consumer.c"
+  "single_consumer.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ptgpp_single_consumer.single_consumer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
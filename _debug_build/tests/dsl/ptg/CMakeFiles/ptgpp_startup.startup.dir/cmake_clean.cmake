@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ptgpp_startup.startup"
+  "startup.c"
+  "startup.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ptgpp_startup.startup.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
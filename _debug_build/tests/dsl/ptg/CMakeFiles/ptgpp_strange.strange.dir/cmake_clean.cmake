@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ptgpp_strange.strange"
+  "strange.c"
+  "strange.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ptgpp_strange.strange.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
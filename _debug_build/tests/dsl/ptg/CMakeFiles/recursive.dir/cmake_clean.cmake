@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/recursive.dir/recursive.c.o"
+  "CMakeFiles/recursive.dir/recursive.c.o.d"
+  "recursive"
+  "recursive.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/recursive.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
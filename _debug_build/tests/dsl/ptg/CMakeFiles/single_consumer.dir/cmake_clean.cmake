@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/single_consumer.dir/single_consumer.c.o"
+  "CMakeFiles/single_consumer.dir/single_consumer.c.o.d"
+  "single_consumer"
+  "single_consumer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/single_consumer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/strange.dir/strange.c.o"
+  "CMakeFiles/strange.dir/strange.c.o.d"
+  "strange"
+  "strange.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/strange.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/dsl/ptg
+# Build directory: /root/repo/_debug_build/tests/dsl/ptg
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("ptgpp")
+subdirs("branching")
+subdirs("choice")
+subdirs("controlgather")
+subdirs("user-defined-functions")
+subdirs("local-indices")
+subdirs("multisize_bcast")
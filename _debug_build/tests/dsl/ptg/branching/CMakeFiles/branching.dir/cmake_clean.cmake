@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/branching.dir/branching.c.o"
+  "CMakeFiles/branching.dir/branching.c.o.d"
+  "CMakeFiles/branching.dir/branching_data.c.o"
+  "CMakeFiles/branching.dir/branching_data.c.o.d"
+  "CMakeFiles/branching.dir/branching_wrapper.c.o"
+  "CMakeFiles/branching.dir/branching_wrapper.c.o.d"
+  "CMakeFiles/branching.dir/main.c.o"
+  "CMakeFiles/branching.dir/main.c.o.d"
+  "branching"
+  "branching.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/branching.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
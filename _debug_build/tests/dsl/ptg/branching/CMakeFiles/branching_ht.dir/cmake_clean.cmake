@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/branching_ht.dir/branching_data.c.o"
+  "CMakeFiles/branching_ht.dir/branching_data.c.o.d"
+  "CMakeFiles/branching_ht.dir/branching_ht.c.o"
+  "CMakeFiles/branching_ht.dir/branching_ht.c.o.d"
+  "CMakeFiles/branching_ht.dir/branching_wrapper.c.o"
+  "CMakeFiles/branching_ht.dir/branching_wrapper.c.o.d"
+  "CMakeFiles/branching_ht.dir/main.c.o"
+  "CMakeFiles/branching_ht.dir/main.c.o.d"
+  "branching_ht"
+  "branching_ht.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/branching_ht.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
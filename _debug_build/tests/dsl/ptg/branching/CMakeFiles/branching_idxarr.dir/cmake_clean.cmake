@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/branching_idxarr.dir/branching_data.c.o"
+  "CMakeFiles/branching_idxarr.dir/branching_data.c.o.d"
+  "CMakeFiles/branching_idxarr.dir/branching_idxarr.c.o"
+  "CMakeFiles/branching_idxarr.dir/branching_idxarr.c.o.d"
+  "CMakeFiles/branching_idxarr.dir/branching_wrapper.c.o"
+  "CMakeFiles/branching_idxarr.dir/branching_wrapper.c.o.d"
+  "CMakeFiles/branching_idxarr.dir/main.c.o"
+  "CMakeFiles/branching_idxarr.dir/main.c.o.d"
+  "branching_idxarr"
+  "branching_idxarr.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/branching_idxarr.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ptgpp_branching.branching"
+  "branching.c"
+  "branching.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ptgpp_branching.branching.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ptgpp_branching_ht.branching_ht"
+  "branching_ht.c"
+  "branching_ht.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ptgpp_branching_ht.branching_ht.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ptgpp_branching_idxarr.branching_idxarr"
+  "branching_idxarr.c"
+  "branching_idxarr.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ptgpp_branching_idxarr.branching_idxarr.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/choice.dir/choice.c.o"
+  "CMakeFiles/choice.dir/choice.c.o.d"
+  "CMakeFiles/choice.dir/choice_data.c.o"
+  "CMakeFiles/choice.dir/choice_data.c.o.d"
+  "CMakeFiles/choice.dir/choice_wrapper.c.o"
+  "CMakeFiles/choice.dir/choice_wrapper.c.o.d"
+  "CMakeFiles/choice.dir/main.c.o"
+  "CMakeFiles/choice.dir/main.c.o.d"
+  "choice"
+  "choice.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/choice.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
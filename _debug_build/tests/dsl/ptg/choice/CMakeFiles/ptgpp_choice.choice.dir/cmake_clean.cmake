@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ptgpp_choice.choice"
+  "choice.c"
+  "choice.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ptgpp_choice.choice.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,5171 @@
+#include "parsec.h"
+#include "parsec/parsec_internal.h"
+#include "parsec/ayudame.h"
+#include "parsec/execution_stream.h"
+#include "parsec/parsec_binary_profile.h"
+#include "parsec/mca/device/device_gpu.h"
+#if defined(PARSEC_HAVE_DEV_CUDA_SUPPORT)
+#include "parsec/mca/device/cuda/device_cuda.h"
+#endif  /* defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) */
+#if defined(PARSEC_HAVE_DEV_HIP_SUPPORT)
+#include "parsec/mca/device/hip/device_hip.h"
+#endif  /* defined(PARSEC_HAVE_DEV_HIP_SUPPORT) */
+#if defined(_MSC_VER) || defined(__MINGW32__)
+#  include <malloc.h>
+#else
+#  include <alloca.h>
+#endif  /* defined(_MSC_VER) || defined(__MINGW32__) */
+
+#define PARSEC_complex_deps_NB_TASK_CLASSES 5
+#define PARSEC_complex_deps_NB_DATA 1
+
+typedef struct __parsec_complex_deps_internal_taskpool_s __parsec_complex_deps_internal_taskpool_t;
+struct parsec_complex_deps_internal_taskpool_s;
+
+/** Predeclarations of the parsec_task_class_t */
+static const parsec_task_class_t complex_deps_FCT5;
+static const parsec_task_class_t complex_deps_FCT4;
+static const parsec_task_class_t complex_deps_FCT3;
+static const parsec_task_class_t complex_deps_FCT2;
+static const parsec_task_class_t complex_deps_FCT1;
+/** Predeclarations of the parameters */
+static const parsec_flow_t flow_of_complex_deps_FCT5_for_A;
+static const parsec_flow_t flow_of_complex_deps_FCT4_for_A;
+static const parsec_flow_t flow_of_complex_deps_FCT3_for_A;
+static const parsec_flow_t flow_of_complex_deps_FCT3_for_B;
+static const parsec_flow_t flow_of_complex_deps_FCT2_for_A;
+static const parsec_flow_t flow_of_complex_deps_FCT1_for_A;
+static const parsec_flow_t flow_of_complex_deps_FCT1_for_B;
+/**
+ * Copyright (c) 2013-2022 The University of Tennessee and The University
+ *                         of Tennessee Research Foundation.  All rights
+ *                         reserved.
+ */
+
+#include "parsec/data_dist/matrix/two_dim_rectangle_cyclic.h"
+#include <sys/time.h>
+#include <inttypes.h>
+#include <string.h>
+#include <stdlib.h>
+
+#define BLOCK 10
+#define NN    10
+#define TYPE  PARSEC_MATRIX_FLOAT
+
+#define PARSEC_complex_deps_DEFAULT_ADT    (&__parsec_tp->super.arenas_datatypes[PARSEC_complex_deps_DEFAULT_ADT_IDX])
+#include "complex_deps.h"
+
+struct __parsec_complex_deps_internal_taskpool_s {
+ parsec_complex_deps_taskpool_t super;
+ volatile int32_t sync_point;
+ volatile int32_t initial_number_tasks;
+ parsec_task_t* startup_queue;
+  /* The ranges to compute the hash key */
+  int FCT5_i_min;
+  int FCT5_i_range;
+  int FCT5_k_min;
+  int FCT5_k_range;
+  int FCT4_i_min;
+  int FCT4_i_range;
+  int FCT4_k_min;
+  int FCT4_k_range;
+  int FCT3_i_min;
+  int FCT3_i_range;
+  int FCT3_k_min;
+  int FCT3_k_range;
+  int FCT3_j_min;
+  int FCT3_j_range;
+  int FCT2_i_min;
+  int FCT2_i_range;
+  int FCT2_k_min;
+  int FCT2_k_range;
+  int FCT2_j_min;
+  int FCT2_j_range;
+  int FCT1_i_min;
+  int FCT1_i_range;
+  int FCT1_k_min;
+  int FCT1_k_range;
+  /* The list of data repositories  FCT2  FCT1 */
+  data_repo_t* repositories[5];
+};
+
+#if defined(PARSEC_PROF_TRACE)
+#  if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+static int complex_deps_profiling_array[4*PARSEC_complex_deps_NB_TASK_CLASSES] = {-2}; /* 2 pairs (begin, end) per task, times two because each task class has an internal_init task */
+#  else /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+static int complex_deps_profiling_array[2*PARSEC_complex_deps_NB_TASK_CLASSES] = {-2}; /* 2 pairs (begin, end) per task */
+#  endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+#endif  /* defined(PARSEC_PROF_TRACE) */
+/* Globals */
+#define descA __parsec_tp->super._g_descA
+#define NI (__parsec_tp->super._g_NI)
+#define NK (__parsec_tp->super._g_NK)
+
+static inline int parsec_imin(int a, int b) { return (a <= b) ? a : b; };
+
+static inline int parsec_imax(int a, int b) { return (a >= b) ? a : b; };
+
+/* Data Access Macros */
+#define data_of_descA(descA_d0, descA_d1)  (((parsec_data_collection_t*)__parsec_tp->super._g_descA)->data_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, (descA_d0), (descA_d1)))
+
+#define rank_of_descA(descA_d0, descA_d1)  (((parsec_data_collection_t*)__parsec_tp->super._g_descA)->rank_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, (descA_d0), (descA_d1)))
+
+/* Functions Predicates */
+#define FCT5_pred(i, k) (((parsec_data_collection_t*)(__parsec_tp->super._g_descA))->myrank == rank_of_descA(i, 0))
+#define FCT4_pred(i, k) (((parsec_data_collection_t*)(__parsec_tp->super._g_descA))->myrank == rank_of_descA(i, 0))
+#define FCT3_pred(i, k, j) (((parsec_data_collection_t*)(__parsec_tp->super._g_descA))->myrank == rank_of_descA(i, 0))
+#define FCT2_pred(i, k, j) (((parsec_data_collection_t*)(__parsec_tp->super._g_descA))->myrank == rank_of_descA(i, 0))
+#define FCT1_pred(i, k) (((parsec_data_collection_t*)(__parsec_tp->super._g_descA))->myrank == rank_of_descA(i, 0))
+
+/* Data Repositories */
+#define FCT5_repo (__parsec_tp->repositories[4])
+#define FCT4_repo (__parsec_tp->repositories[3])
+#define FCT3_repo (__parsec_tp->repositories[2])
+#define FCT2_repo (__parsec_tp->repositories[1])
+#define FCT1_repo (__parsec_tp->repositories[0])
+/* Release dependencies output macro */
+#if defined(PARSEC_DEBUG_NOISIER)
+#define RELEASE_DEP_OUTPUT(ES, DEPO, TASKO, DEPI, TASKI, RSRC, RDST, DATA)\
+  do { \
+    char tmp1[128], tmp2[128]; (void)tmp1; (void)tmp2;\
+    PARSEC_DEBUG_VERBOSE(20, parsec_debug_output, "thread %d VP %d explore deps from %s:%s to %s:%s (from rank %d to %d) base ptr %p",\
+           (NULL != (ES) ? (ES)->th_id : -1), (NULL != (ES) ? (ES)->virtual_process->vp_id : -1),\
+           DEPO, parsec_task_snprintf(tmp1, 128, (parsec_task_t*)(TASKO)),\
+           DEPI, parsec_task_snprintf(tmp2, 128, (parsec_task_t*)(TASKI)), (RSRC), (RDST), (DATA));\
+  } while(0)
+#define ACQUIRE_FLOW(TASKI, DEPI, FUNO, DEPO, LOCALS, PTR)\
+  do { \
+    char tmp1[128], tmp2[128]; (void)tmp1; (void)tmp2;\
+    PARSEC_DEBUG_VERBOSE(20, parsec_debug_output, "task %s acquires flow %s from %s %s data ptr %p",\
+           parsec_task_snprintf(tmp1, 128, (parsec_task_t*)(TASKI)), (DEPI),\
+           (DEPO), parsec_snprintf_assignments(tmp2, 128, (FUNO), (parsec_assignment_t*)(LOCALS)), (PTR));\
+  } while(0)
+#else
+#define RELEASE_DEP_OUTPUT(ES, DEPO, TASKO, DEPI, TASKI, RSRC, RDST, DATA)
+#define ACQUIRE_FLOW(TASKI, DEPI, TASKO, DEPO, LOCALS, PTR)
+#endif
+static inline parsec_key_t __jdf2c_make_key_FCT5(const parsec_taskpool_t *tp, const parsec_assignment_t *as)
+{
+  const __parsec_complex_deps_internal_taskpool_t *__parsec_tp = (const __parsec_complex_deps_internal_taskpool_t *)tp;
+  const __parsec_complex_deps_FCT5_parsec_assignment_t *assignment = (const __parsec_complex_deps_FCT5_parsec_assignment_t*)as;
+  uint64_t __parsec_id = 0;
+  __parsec_id += (assignment->i.value - __parsec_tp->FCT5_i_min);
+  __parsec_id += (assignment->k.value - __parsec_tp->FCT5_k_min) * __parsec_tp->FCT5_i_range;
+  return (parsec_key_t)__parsec_id;
+}
+static char *__jdf2c_key_fns_FCT5_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_complex_deps_internal_taskpool_t *__parsec_tp = (__parsec_complex_deps_internal_taskpool_t *)user_data;
+  int i = (__parsec_key) % __parsec_tp->FCT5_i_range + __parsec_tp->FCT5_i_min;
+  __parsec_key = __parsec_key / __parsec_tp->FCT5_i_range;
+  int k = (__parsec_key) % __parsec_tp->FCT5_k_range + __parsec_tp->FCT5_k_min;
+  __parsec_key = __parsec_key / __parsec_tp->FCT5_k_range;
+  snprintf(buffer, buffer_size, "FCT5(%d, %d)", i, k);
+  return buffer;
+}
+
+static parsec_key_fn_t __jdf2c_key_fns_FCT5 = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = __jdf2c_key_fns_FCT5_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+static inline parsec_key_t __jdf2c_make_key_FCT4(const parsec_taskpool_t *tp, const parsec_assignment_t *as)
+{
+  const __parsec_complex_deps_internal_taskpool_t *__parsec_tp = (const __parsec_complex_deps_internal_taskpool_t *)tp;
+  const __parsec_complex_deps_FCT4_parsec_assignment_t *assignment = (const __parsec_complex_deps_FCT4_parsec_assignment_t*)as;
+  uint64_t __parsec_id = 0;
+  __parsec_id += (assignment->i.value - __parsec_tp->FCT4_i_min);
+  __parsec_id += (assignment->k.value - __parsec_tp->FCT4_k_min) * __parsec_tp->FCT4_i_range;
+  return (parsec_key_t)__parsec_id;
+}
+static char *__jdf2c_key_fns_FCT4_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_complex_deps_internal_taskpool_t *__parsec_tp = (__parsec_complex_deps_internal_taskpool_t *)user_data;
+  int i = (__parsec_key) % __parsec_tp->FCT4_i_range + __parsec_tp->FCT4_i_min;
+  __parsec_key = __parsec_key / __parsec_tp->FCT4_i_range;
+  int k = (__parsec_key) % __parsec_tp->FCT4_k_range + __parsec_tp->FCT4_k_min;
+  __parsec_key = __parsec_key / __parsec_tp->FCT4_k_range;
+  snprintf(buffer, buffer_size, "FCT4(%d, %d)", i, k);
+  return buffer;
+}
+
+static parsec_key_fn_t __jdf2c_key_fns_FCT4 = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = __jdf2c_key_fns_FCT4_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+static inline parsec_key_t __jdf2c_make_key_FCT3(const parsec_taskpool_t *tp, const parsec_assignment_t *as)
+{
+  const __parsec_complex_deps_internal_taskpool_t *__parsec_tp = (const __parsec_complex_deps_internal_taskpool_t *)tp;
+  const __parsec_complex_deps_FCT3_parsec_assignment_t *assignment = (const __parsec_complex_deps_FCT3_parsec_assignment_t*)as;
+  uint64_t __parsec_id = 0;
+  __parsec_id += (assignment->i.value - __parsec_tp->FCT3_i_min);
+  __parsec_id += (assignment->k.value - __parsec_tp->FCT3_k_min) * __parsec_tp->FCT3_i_range;
+  __parsec_id += (assignment->j.value - __parsec_tp->FCT3_j_min) * __parsec_tp->FCT3_i_range * __parsec_tp->FCT3_k_range;
+  return (parsec_key_t)__parsec_id;
+}
+static char *__jdf2c_key_fns_FCT3_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_complex_deps_internal_taskpool_t *__parsec_tp = (__parsec_complex_deps_internal_taskpool_t *)user_data;
+  int i = (__parsec_key) % __parsec_tp->FCT3_i_range + __parsec_tp->FCT3_i_min;
+  __parsec_key = __parsec_key / __parsec_tp->FCT3_i_range;
+  int k = (__parsec_key) % __parsec_tp->FCT3_k_range + __parsec_tp->FCT3_k_min;
+  __parsec_key = __parsec_key / __parsec_tp->FCT3_k_range;
+  int j = (__parsec_key) % __parsec_tp->FCT3_j_range + __parsec_tp->FCT3_j_min;
+  __parsec_key = __parsec_key / __parsec_tp->FCT3_j_range;
+  snprintf(buffer, buffer_size, "FCT3(%d, %d, %d)", i, k, j);
+  return buffer;
+}
+
+static parsec_key_fn_t __jdf2c_key_fns_FCT3 = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = __jdf2c_key_fns_FCT3_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+static inline parsec_key_t __jdf2c_make_key_FCT2(const parsec_taskpool_t *tp, const parsec_assignment_t *as)
+{
+  const __parsec_complex_deps_internal_taskpool_t *__parsec_tp = (const __parsec_complex_deps_internal_taskpool_t *)tp;
+  const __parsec_complex_deps_FCT2_parsec_assignment_t *assignment = (const __parsec_complex_deps_FCT2_parsec_assignment_t*)as;
+  uint64_t __parsec_id = 0;
+  __parsec_id += (assignment->i.value - __parsec_tp->FCT2_i_min);
+  __parsec_id += (assignment->k.value - __parsec_tp->FCT2_k_min) * __parsec_tp->FCT2_i_range;
+  __parsec_id += (assignment->j.value - __parsec_tp->FCT2_j_min) * __parsec_tp->FCT2_i_range * __parsec_tp->FCT2_k_range;
+  return (parsec_key_t)__parsec_id;
+}
+static char *__jdf2c_key_fns_FCT2_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_complex_deps_internal_taskpool_t *__parsec_tp = (__parsec_complex_deps_internal_taskpool_t *)user_data;
+  int i = (__parsec_key) % __parsec_tp->FCT2_i_range + __parsec_tp->FCT2_i_min;
+  __parsec_key = __parsec_key / __parsec_tp->FCT2_i_range;
+  int k = (__parsec_key) % __parsec_tp->FCT2_k_range + __parsec_tp->FCT2_k_min;
+  __parsec_key = __parsec_key / __parsec_tp->FCT2_k_range;
+  int j = (__parsec_key) % __parsec_tp->FCT2_j_range + __parsec_tp->FCT2_j_min;
+  __parsec_key = __parsec_key / __parsec_tp->FCT2_j_range;
+  snprintf(buffer, buffer_size, "FCT2(%d, %d, %d)", i, k, j);
+  return buffer;
+}
+
+static parsec_key_fn_t __jdf2c_key_fns_FCT2 = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = __jdf2c_key_fns_FCT2_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+static inline parsec_key_t __jdf2c_make_key_FCT1(const parsec_taskpool_t *tp, const parsec_assignment_t *as)
+{
+  const __parsec_complex_deps_internal_taskpool_t *__parsec_tp = (const __parsec_complex_deps_internal_taskpool_t *)tp;
+  const __parsec_complex_deps_FCT1_parsec_assignment_t *assignment = (const __parsec_complex_deps_FCT1_parsec_assignment_t*)as;
+  uint64_t __parsec_id = 0;
+  __parsec_id += (assignment->i.value - __parsec_tp->FCT1_i_min);
+  __parsec_id += (assignment->k.value - __parsec_tp->FCT1_k_min) * __parsec_tp->FCT1_i_range;
+  return (parsec_key_t)__parsec_id;
+}
+static char *__jdf2c_key_fns_FCT1_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_complex_deps_internal_taskpool_t *__parsec_tp = (__parsec_complex_deps_internal_taskpool_t *)user_data;
+  int i = (__parsec_key) % __parsec_tp->FCT1_i_range + __parsec_tp->FCT1_i_min;
+  __parsec_key = __parsec_key / __parsec_tp->FCT1_i_range;
+  int k = (__parsec_key) % __parsec_tp->FCT1_k_range + __parsec_tp->FCT1_k_min;
+  __parsec_key = __parsec_key / __parsec_tp->FCT1_k_range;
+  snprintf(buffer, buffer_size, "FCT1(%d, %d)", i, k);
+  return buffer;
+}
+
+static parsec_key_fn_t __jdf2c_key_fns_FCT1 = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = __jdf2c_key_fns_FCT1_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/******                                      FCT5                                      ******/
+
+static inline int32_t minexpr_of_symb_complex_deps_FCT5_i_fct(const __parsec_complex_deps_internal_taskpool_t *__parsec_tp, const __parsec_complex_deps_FCT5_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_complex_deps_FCT5_i = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_complex_deps_FCT5_i_fct }
+                   }
+};
+static inline int maxexpr_of_symb_complex_deps_FCT5_i_fct(const __parsec_complex_deps_internal_taskpool_t *__parsec_tp, const __parsec_complex_deps_FCT5_parsec_assignment_t *locals)
+{
+  const int i = locals->i.value; (void)i;
+  const int k = locals->k.value; (void)k;
+
+  (void)i;
+  (void)k;
+  (void)__parsec_tp; (void)locals;
+  return (NI - 1);
+}
+static const parsec_expr_t maxexpr_of_symb_complex_deps_FCT5_i = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_complex_deps_FCT5_i_fct }
+                   }
+};
+static const parsec_symbol_t symb_complex_deps_FCT5_i = { .name = "i", .context_index = 0, .min = &minexpr_of_symb_complex_deps_FCT5_i, .max = &maxexpr_of_symb_complex_deps_FCT5_i, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int32_t minexpr_of_symb_complex_deps_FCT5_k_fct(const __parsec_complex_deps_internal_taskpool_t *__parsec_tp, const __parsec_complex_deps_FCT5_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_complex_deps_FCT5_k = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_complex_deps_FCT5_k_fct }
+                   }
+};
+static inline int maxexpr_of_symb_complex_deps_FCT5_k_fct(const __parsec_complex_deps_internal_taskpool_t *__parsec_tp, const __parsec_complex_deps_FCT5_parsec_assignment_t *locals)
+{
+  const int i = locals->i.value; (void)i;
+  const int k = locals->k.value; (void)k;
+
+  (void)i;
+  (void)k;
+  (void)__parsec_tp; (void)locals;
+  return (NK - 1);
+}
+static const parsec_expr_t maxexpr_of_symb_complex_deps_FCT5_k = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_complex_deps_FCT5_k_fct }
+                   }
+};
+static const parsec_symbol_t symb_complex_deps_FCT5_k = { .name = "k", .context_index = 1, .min = &minexpr_of_symb_complex_deps_FCT5_k, .max = &maxexpr_of_symb_complex_deps_FCT5_k, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int affinity_of_complex_deps_FCT5(const __parsec_complex_deps_FCT5_task_t *this_task,
+                     parsec_data_ref_t *ref)
+{
+    const __parsec_complex_deps_internal_taskpool_t *__parsec_tp = (const __parsec_complex_deps_internal_taskpool_t*)this_task->taskpool;
+  const int i = this_task->locals.i.value; (void)i;
+  const int k = this_task->locals.k.value; (void)k;
+
+  /* Silent Warnings: should look into predicate to know what variables are usefull */
+  (void)i;
+  (void)k;
+  ref->dc = (parsec_data_collection_t *)__parsec_tp->super._g_descA;
+  /* Compute data key */
+  ref->key = ref->dc->data_key(ref->dc, i, 0);
+  return 1;
+}
+static const parsec_property_t properties_of_complex_deps_FCT5[1] = {
+  {.name = NULL, .expr = NULL}
+};
+static const parsec_dep_t flow_of_complex_deps_FCT5_for_A_dep1_atline_89 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 0, /* complex_deps_FCT1 */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_complex_deps_FCT1_for_A,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_complex_deps_FCT5_for_A,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_complex_deps_FCT5_for_A = {
+  .name               = "A",
+  .sym_type           = PARSEC_SYM_IN,
+  .flow_flags         = PARSEC_FLOW_ACCESS_READ,
+  .flow_index         = 0,
+  .flow_datatype_mask = 0x0,
+  .dep_in     = { &flow_of_complex_deps_FCT5_for_A_dep1_atline_89 },
+  .dep_out    = { NULL }
+};
+
+static void
+iterate_predecessors_of_complex_deps_FCT5(parsec_execution_stream_t *es, const __parsec_complex_deps_FCT5_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_complex_deps_internal_taskpool_t *__parsec_tp = (const __parsec_complex_deps_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_complex_deps_FCT5_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_complex_deps_FCT5_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int i = __jdf2c__tmp_locals.i.value; (void)i;
+  const int k = __jdf2c__tmp_locals.k.value; (void)k;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)i;  (void)k;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_descA(i, 0);
+#endif
+  if( action_mask & 0x1 ) {  /* Flow of data A [0] */
+    data.data   = this_task->data._f_A.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x1 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_complex_deps_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_complex_deps_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        __parsec_complex_deps_FCT1_task_t* ncc = (__parsec_complex_deps_FCT1_task_t*)&nc;
+    nc.task_class = __parsec_tp->super.super.task_classes_array[complex_deps_FCT1.task_class_id];
+      const int FCT1_i = i;
+      if( (FCT1_i >= (0)) && (FCT1_i <= ((NI - 1))) ) {
+        assert(&nc.locals[0].value == &ncc->locals.i.value);
+        ncc->locals.i.value = FCT1_i;
+        const int FCT1_k = k;
+        if( (FCT1_k >= (0)) && (FCT1_k <= ((NK - 1))) ) {
+          assert(&nc.locals[1].value == &ncc->locals.k.value);
+          ncc->locals.k.value = FCT1_k;
+#if defined(DISTRIBUTED)
+          rank_dst = rank_of_descA(ncc->locals.i.value, 0);
+          if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+            vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, ncc->locals.i.value, 0);
+          nc.priority = __parsec_tp->super.super.priority;
+          successor_repo = FCT1_repo;
+          successor_repo_key = __jdf2c_make_key_FCT1((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+        RELEASE_DEP_OUTPUT(es, "A", this_task, "A", &nc, rank_src, rank_dst, &data);
+        if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_complex_deps_FCT5_for_A_dep1_atline_89, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+          }
+        }
+  }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static int release_deps_of_complex_deps_FCT5(parsec_execution_stream_t *es, __parsec_complex_deps_FCT5_task_t *this_task, uint32_t action_mask, parsec_remote_deps_t *deps)
+{
+  PARSEC_PINS(es, RELEASE_DEPS_BEGIN, (parsec_task_t *)this_task);  const __parsec_complex_deps_internal_taskpool_t *__parsec_tp = (const __parsec_complex_deps_internal_taskpool_t *)this_task->taskpool;
+  parsec_release_dep_fct_arg_t arg;
+  int __vp_id;
+  int consume_local_repo = 0;
+  arg.action_mask = action_mask;
+  arg.output_entry = NULL;
+  arg.output_repo = NULL;
+#if defined(DISTRIBUTED)
+  arg.remote_deps = deps;
+#endif  /* defined(DISTRIBUTED) */
+  assert(NULL != es);
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS )    arg.ready_lists = alloca(sizeof(parsec_task_t *) * es->virtual_process->parsec_context->nb_vp);
+  else
+    arg.ready_lists = NULL;
+  for( __vp_id = 0; __vp_id < es->virtual_process->parsec_context->nb_vp; arg.ready_lists[__vp_id++] = NULL );
+  (void)__parsec_tp; (void)deps;
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_A.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_A.source_repo, this_task->data._f_A.source_repo_entry->ht_item.key );
+    }
+  }
+  consume_local_repo = (this_task->repo_entry != NULL);
+  /* No successors, don't call iterate_successors and don't release any local deps */
+      if (consume_local_repo) {
+         data_repo_entry_used_once( FCT5_repo, this_task->repo_entry->ht_item.key );
+      }
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_A.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_A.data_in);
+    }
+  }
+  PARSEC_PINS(es, RELEASE_DEPS_END, (parsec_task_t *)this_task);  return 0;
+}
+
+static int data_lookup_of_complex_deps_FCT5(parsec_execution_stream_t *es, __parsec_complex_deps_FCT5_task_t *this_task)
+{
+  const __parsec_complex_deps_internal_taskpool_t *__parsec_tp = (__parsec_complex_deps_internal_taskpool_t *)this_task->taskpool;
+  parsec_assignment_t generic_locals[MAX_PARAM_COUNT];  /* generic task locals */
+  int target_device = 0; (void)target_device;
+  (void)__parsec_tp; (void)generic_locals; (void)es;
+  parsec_data_copy_t *chunk = NULL;
+  data_repo_t        *reshape_repo  = NULL, *consumed_repo  = NULL;
+  data_repo_entry_t  *reshape_entry = NULL, *consumed_entry = NULL;
+  parsec_key_t        reshape_entry_key = 0, consumed_entry_key = 0;
+  uint8_t             consumed_flow_index;
+  parsec_dep_data_description_t data;
+  int ret;
+  (void)reshape_repo; (void)reshape_entry; (void)reshape_entry_key;
+  (void)consumed_repo; (void)consumed_entry; (void)consumed_entry_key;
+  (void)consumed_flow_index;
+  (void)chunk; (void)data; (void)ret;
+  const int i = this_task->locals.i.value; (void)i;
+  const int k = this_task->locals.k.value; (void)k;
+  if( NULL == this_task->repo_entry ){
+    this_task->repo_entry = data_repo_lookup_entry_and_create(es, FCT5_repo,                                       __jdf2c_make_key_FCT5((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    data_repo_entry_addto_usage_limit(FCT5_repo, this_task->repo_entry->ht_item.key, 1);    this_task->repo_entry ->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(this_task->repo_entry ->sim_exec_date == 0);
+    this_task->repo_entry ->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  /* The reshape repo is the current task repo. */  reshape_repo = FCT5_repo;
+  reshape_entry_key = __jdf2c_make_key_FCT5((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals) ;
+  reshape_entry = this_task->repo_entry;
+  /* Lookup the input data, and store them in the context if any */
+
+if(! this_task->data._f_A.fulfill ){ /* Flow A */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_A.data_out = NULL;  /* input only */
+  /* Flow A [0] dependency [0] from predecessor FCT1 */
+  if( NULL == (chunk = this_task->data._f_A.data_in) ) {
+  /* No data set up by predecessor on this task input flow */
+__parsec_complex_deps_FCT1_parsec_assignment_t *target_locals = (__parsec_complex_deps_FCT1_parsec_assignment_t*)&generic_locals;
+  const int FCT1i = target_locals->i.value = i; (void)FCT1i;
+  const int FCT1k = target_locals->k.value = k; (void)FCT1k;
+    if( (reshape_entry != NULL) && (reshape_entry->data[0] != NULL) ){
+        /* Reshape promise set up on this task repo by predecessor */
+        consumed_repo = reshape_repo;
+        consumed_entry = reshape_entry;
+        consumed_entry_key = reshape_entry_key;
+        consumed_flow_index = 0;
+    }else{
+        /* Consume from predecessor's repo */
+        consumed_repo = FCT1_repo;
+        consumed_entry_key = __jdf2c_make_key_FCT1((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)target_locals) ;
+        consumed_entry = data_repo_lookup_entry( consumed_repo, consumed_entry_key );
+        consumed_flow_index = 0;
+    }
+    data.data   = NULL;
+    data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+        data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    ACQUIRE_FLOW(this_task, "A", &complex_deps_FCT1, "A", target_locals, chunk);
+    this_task->data._f_A.data_out = chunk;
+  } 
+  else {
+    /* Data set up by predecessor on this task input flow */
+    consumed_repo = this_task->data._f_A.source_repo;
+    consumed_entry = this_task->data._f_A.source_repo_entry;
+    consumed_entry_key = this_task->data._f_A.source_repo_entry->ht_item.key;
+    if( (reshape_entry != NULL) && (reshape_entry->data[0] != NULL) ){
+        /* Reshape promise set up on input by predecessor is on this task repo */
+        consumed_flow_index = 0;
+        assert( (this_task->data._f_A.source_repo == reshape_repo)
+             && (this_task->data._f_A.source_repo_entry == reshape_entry));
+    }else{
+        /* Reshape promise set up on input by predecessor is the predecesssor task repo */
+        consumed_flow_index = 0;
+    }
+    data.data   = NULL;
+    data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+        data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    this_task->data._f_A.data_out = parsec_data_get_copy(chunk->original, target_device);
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+    parsec_prof_grapher_data_input(chunk->original, (parsec_task_t*)this_task, &flow_of_complex_deps_FCT5_for_A, 0);
+#endif
+  }
+    this_task->data._f_A.data_in     = chunk;
+    this_task->data._f_A.source_repo       = consumed_repo;
+    this_task->data._f_A.source_repo_entry = consumed_entry;
+    this_task->data._f_A.fulfill = 1;
+}
+
+  /** Generate profiling information */
+#if defined(PARSEC_PROF_TRACE)
+  this_task->prof_info.desc = (parsec_data_collection_t*)__parsec_tp->super._g_descA;
+  this_task->prof_info.priority = this_task->priority;
+  this_task->prof_info.data_id   = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->data_key((parsec_data_collection_t*)__parsec_tp->super._g_descA, i, 0);
+  this_task->prof_info.task_class_id = this_task->task_class->task_class_id;
+  this_task->prof_info.task_return_code = -1;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int datatype_lookup_of_complex_deps_FCT5(parsec_execution_stream_t *es, const parsec_task_t *this_generic_task, const parsec_task_t *parent_task,
+              uint32_t* flow_mask, parsec_dep_data_description_t* data)
+{
+  const __parsec_complex_deps_FCT5_task_t *this_task = (__parsec_complex_deps_FCT5_task_t*)this_generic_task;
+  const __parsec_complex_deps_internal_taskpool_t *__parsec_tp = (__parsec_complex_deps_internal_taskpool_t *)this_task->taskpool;
+  (void)__parsec_tp; (void)es; (void)this_task; (void)data; (void)parent_task;
+  const int i = this_task->locals.i.value; (void)i;
+  const int k = this_task->locals.k.value; (void)k;
+  data->local.arena = data->remote.arena = NULL;
+  data->local.src_datatype  = data->local.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->local.src_count     = data->local.dst_count = 0;
+  data->local.src_displ     = data->local.dst_displ = 0;
+  data->data_future  = NULL;
+  if( (*flow_mask) & 0x80000000U ) { /* these are the input dependencies remote datatypes  */
+if( (*flow_mask) & 0x1U ) {  /* Flow A */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_complex_deps_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_complex_deps_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_complex_deps_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+    goto no_mask_match;
+  }
+
+  /* these are the output dependencies remote datatypes */
+ no_mask_match:
+  data->data                             = NULL;
+  data->remote.src_datatype = data->remote.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->remote.src_count    = data->remote.dst_count = 0;
+  data->remote.src_displ    = data->remote.dst_displ = 0;
+  data->data_future  = NULL;
+  (*flow_mask) = 0;  /* nothing left */
+  (void)i;  (void)k;
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+static int hook_of_complex_deps_FCT5(parsec_execution_stream_t *es, __parsec_complex_deps_FCT5_task_t *this_task)
+{
+  __parsec_complex_deps_internal_taskpool_t *__parsec_tp = (__parsec_complex_deps_internal_taskpool_t *)this_task->taskpool;
+  (void)es; (void)__parsec_tp;
+  const int i = this_task->locals.i.value; (void)i;
+  const int k = this_task->locals.k.value; (void)k;
+  (void)i;  (void)k;
+
+  /** Declare the variables that will hold the data, and all the accounting for each */
+  parsec_data_copy_t *_f_A = this_task->data._f_A.data_in;
+  void *A = PARSEC_DATA_COPY_GET_PTR(_f_A); (void)A;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    data_repo_entry_t *eA = this_task->data._f_A.source_repo_entry;
+    if( (NULL != eA) && (eA->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eA->sim_exec_date;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+  /** Cache Awareness Accounting */
+#if defined(PARSEC_CACHE_AWARENESS)
+  cache_buf_referenced(es->closest_cache, A);
+#endif /* PARSEC_CACHE_AWARENESS */
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                                  FCT5 BODY                                    -----*/
+
+
+/*-----                                END OF FCT5 BODY                                -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#endif  /*  defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+static int complete_hook_of_complex_deps_FCT5(parsec_execution_stream_t *es, __parsec_complex_deps_FCT5_task_t *this_task)
+{
+  const __parsec_complex_deps_internal_taskpool_t *__parsec_tp = (__parsec_complex_deps_internal_taskpool_t *)this_task->taskpool;
+#if defined(DISTRIBUTED)
+    const int i = this_task->locals.i.value; (void)i;
+  const int k = this_task->locals.k.value; (void)k;
+#endif  /* defined(DISTRIBUTED) */
+  (void)es; (void)__parsec_tp;
+parsec_data_t* data_t_desc = NULL; (void)data_t_desc;
+#if defined(DISTRIBUTED)
+  /** If not working on distributed, there is no risk that data is not in place */
+  (void)i;  (void)k;
+
+#endif /* DISTRIBUTED */
+#if defined(PARSEC_PROF_GRAPHER)
+  parsec_prof_grapher_task((parsec_task_t*)this_task, es->th_id, es->virtual_process->vp_id,
+     __jdf2c_key_fns_FCT5.key_hash(this_task->task_class->make_key( (parsec_taskpool_t*)this_task->taskpool, ((parsec_task_t*)this_task)->locals), NULL));
+#endif  /* defined(PARSEC_PROF_GRAPHER) */
+  release_deps_of_complex_deps_FCT5(es, this_task,
+      PARSEC_ACTION_RELEASE_REMOTE_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_REFS |
+      PARSEC_ACTION_RESHAPE_ON_RELEASE |
+      0x0,  /* mask of all dep_index */ 
+      NULL);
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static parsec_hook_return_t release_task_of_complex_deps_FCT5(parsec_execution_stream_t *es, parsec_task_t *this_task)
+{
+    const __parsec_complex_deps_internal_taskpool_t *__parsec_tp =
+        (const __parsec_complex_deps_internal_taskpool_t *)this_task->taskpool;
+    parsec_hash_table_t *ht = (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[4];
+    parsec_key_t key = this_task->task_class->make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals);
+    parsec_hashable_dependency_t *hash_dep = (parsec_hashable_dependency_t *)parsec_hash_table_remove(ht, key);
+    parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);
+    return parsec_release_task_to_mempool_update_nbtasks(es, this_task);
+}
+
+static char *complex_deps_complex_deps_FCT5_internal_init_deps_key_functions_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_complex_deps_internal_taskpool_t *__parsec_tp = (__parsec_complex_deps_internal_taskpool_t *)user_data;
+  int i = (__parsec_key) % __parsec_tp->FCT5_i_range + __parsec_tp->FCT5_i_min;
+  __parsec_key = __parsec_key / __parsec_tp->FCT5_i_range;
+  int k = (__parsec_key) % __parsec_tp->FCT5_k_range + __parsec_tp->FCT5_k_min;
+  __parsec_key = __parsec_key / __parsec_tp->FCT5_k_range;
+  snprintf(buffer, buffer_size, "FCT5(%d, %d)", i, k);
+  return buffer;
+}
+
+static parsec_key_fn_t complex_deps_complex_deps_FCT5_internal_init_deps_key_functions = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = complex_deps_complex_deps_FCT5_internal_init_deps_key_functions_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/* Needs: min-max count-tasks iterate */
+static int complex_deps_FCT5_internal_init(parsec_execution_stream_t * es, __parsec_complex_deps_FCT5_task_t * this_task)
+{
+  __parsec_complex_deps_internal_taskpool_t *__parsec_tp = (__parsec_complex_deps_internal_taskpool_t*)this_task->taskpool;
+  int32_t nb_tasks = 0, saved_nb_tasks = 0;
+int32_t __i_min = 0x7fffffff, __i_max = 0;int32_t __jdf2c_i_min = 0x7fffffff, __jdf2c_i_max = 0;int32_t __k_min = 0x7fffffff, __k_max = 0;int32_t __jdf2c_k_min = 0x7fffffff, __jdf2c_k_max = 0;  __parsec_complex_deps_FCT5_parsec_assignment_t assignments = {  .i.value = 0, .k.value = 0 };
+  int32_t  i,  k;
+  int32_t __jdf2c_i_start, __jdf2c_i_end, __jdf2c_i_inc;
+  int32_t __jdf2c_k_start, __jdf2c_k_end, __jdf2c_k_inc;
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+  PARSEC_PROFILING_TRACE(es->es_profile,
+                         this_task->taskpool->profiling_array[START_KEY(this_task->task_class->task_class_id)],
+                         0,
+                         this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    __jdf2c_i_start = 0;
+    __jdf2c_i_end = (NI - 1);
+    __jdf2c_i_inc = 1;
+    __i_min = parsec_imin(__jdf2c_i_start, __jdf2c_i_end);
+    __i_max = parsec_imax(__jdf2c_i_start, __jdf2c_i_end);
+    __jdf2c_i_min = parsec_imin(__jdf2c_i_min, __i_min);
+    __jdf2c_i_max = parsec_imax(__jdf2c_i_max, __i_max);
+    for(i =  __jdf2c_i_start;
+        i <= __jdf2c_i_end;
+        i += __jdf2c_i_inc) {
+    assignments.i.value = i;
+      __jdf2c_k_start = 0;
+      __jdf2c_k_end = (NK - 1);
+      __jdf2c_k_inc = 1;
+      __k_min = parsec_imin(__jdf2c_k_start, __jdf2c_k_end);
+      __k_max = parsec_imax(__jdf2c_k_start, __jdf2c_k_end);
+      __jdf2c_k_min = parsec_imin(__jdf2c_k_min, __k_min);
+      __jdf2c_k_max = parsec_imax(__jdf2c_k_max, __k_max);
+      for(k =  __jdf2c_k_start;
+          k <= __jdf2c_k_end;
+          k += __jdf2c_k_inc) {
+      assignments.k.value = k;
+      if( !FCT5_pred(i, k) ) continue;
+      nb_tasks++;
+    } /* Loop on normal range k */
+  } /* For loop of i */ 
+   if( 0 != nb_tasks ) {
+     (void)parsec_atomic_fetch_add_int32(&__parsec_tp->initial_number_tasks, nb_tasks);
+   }
+  /* Set the range variables for the collision-free hash-computation */
+  __parsec_tp->FCT5_i_min   = __jdf2c_i_min;
+  __parsec_tp->FCT5_i_range = (__jdf2c_i_max - __jdf2c_i_min) + 1;
+  __parsec_tp->FCT5_k_min   = __jdf2c_k_min;
+  __parsec_tp->FCT5_k_range = (__jdf2c_k_max - __jdf2c_k_min) + 1;
+  this_task->status = PARSEC_TASK_STATUS_COMPLETE;
+
+  PARSEC_AYU_REGISTER_TASK(&complex_deps_FCT5);
+  __parsec_tp->super.super.dependencies_array[4] = PARSEC_OBJ_NEW(parsec_hash_table_t);
+  parsec_hash_table_init(__parsec_tp->super.super.dependencies_array[4], offsetof(parsec_hashable_dependency_t, ht_item), 10, complex_deps_complex_deps_FCT5_internal_init_deps_key_functions, this_task->taskpool);
+  __parsec_tp->repositories[4] = data_repo_create_nothreadsafe(nb_tasks, __jdf2c_key_fns_FCT5, (parsec_taskpool_t*)__parsec_tp, 1);
+(void)saved_nb_tasks;
+(void)__i_min; (void)__i_max;(void)__k_min; (void)__k_max;  (void)__jdf2c_i_start; (void)__jdf2c_i_end; (void)__jdf2c_i_inc;  (void)__jdf2c_k_start; (void)__jdf2c_k_end; (void)__jdf2c_k_inc;  (void)assignments; (void)__parsec_tp; (void)es;
+  if(1 == parsec_atomic_fetch_dec_int32(&__parsec_tp->sync_point)) {
+    /* Last initialization task complete. Update the number of tasks. */
+    __parsec_tp->super.super.tdm.module->taskpool_addto_nb_tasks(&__parsec_tp->super.super, __parsec_tp->initial_number_tasks);
+    parsec_mfence();  /* write memory barrier to guarantee that the scheduler gets the correct number of tasks */
+    parsec_taskpool_enable((parsec_taskpool_t*)__parsec_tp, &__parsec_tp->startup_queue,
+                           (parsec_task_t*)this_task, es, __parsec_tp->super.super.nb_pending_actions);
+    __parsec_tp->super.super.tdm.module->taskpool_ready(&__parsec_tp->super.super);
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+    PARSEC_PROFILING_TRACE(es->es_profile,
+                           this_task->taskpool->profiling_array[2 * this_task->task_class->task_class_id + 1],
+                           0,
+                           this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    return PARSEC_HOOK_RETURN_DONE;
+  }
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static const __parsec_chore_t __complex_deps_FCT5_chores[] ={
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+    { .type     = PARSEC_DEV_CPU,
+      .evaluate = (parsec_evaluate_function_t*)NULL,
+      .hook     = (parsec_hook_t*)hook_of_complex_deps_FCT5 },
+#endif  /* defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+    { .type     = PARSEC_DEV_NONE,
+      .evaluate = NULL,
+      .hook     = (parsec_hook_t*)NULL },  /* End marker */
+};
+
+static const parsec_task_class_t complex_deps_FCT5 = {
+  .name = "FCT5",
+  .task_class_id = 4,
+  .nb_flows = 1,
+  .nb_parameters = 2,
+  .nb_locals = 2,
+  .task_class_type = PARSEC_TASK_CLASS_TYPE_PTG,
+  .params = { &symb_complex_deps_FCT5_i, &symb_complex_deps_FCT5_k, NULL },
+  .locals = { &symb_complex_deps_FCT5_i, &symb_complex_deps_FCT5_k, NULL },
+  .data_affinity = (parsec_data_ref_fn_t*)affinity_of_complex_deps_FCT5,
+  .initial_data = (parsec_data_ref_fn_t*)affinity_of_complex_deps_FCT5,
+  .final_data = (parsec_data_ref_fn_t*)affinity_of_complex_deps_FCT5,
+  .priority = NULL,
+  .properties = properties_of_complex_deps_FCT5,
+#if MAX_PARAM_COUNT < 1  /* number of read flows of FCT5 */
+  #error Too many read flows for task FCT5
+#endif  /* MAX_PARAM_COUNT */
+#if MAX_PARAM_COUNT < 0  /* number of write flows of FCT5 */
+  #error Too many write flows for task FCT5
+#endif  /* MAX_PARAM_COUNT */
+  .in = { &flow_of_complex_deps_FCT5_for_A, NULL },
+  .out = { NULL },
+  .flags = 0x0 | PARSEC_USE_DEPS_MASK,
+  .dependencies_goal = 0x1,
+  .make_key = __jdf2c_make_key_FCT5,
+  .task_snprintf = parsec_task_snprintf,
+#if defined(PARSEC_PROF_TRACE)
+  .profile_info = &parsec_task_profile_info,
+#endif
+  .key_functions = &__jdf2c_key_fns_FCT5,
+  .fini = (parsec_hook_t*)NULL,
+  .incarnations = __complex_deps_FCT5_chores,
+  .find_deps = parsec_hash_find_deps,
+  .update_deps = parsec_update_deps_with_mask,
+  .iterate_successors = (parsec_traverse_function_t*)NULL,
+  .iterate_predecessors = (parsec_traverse_function_t*)iterate_predecessors_of_complex_deps_FCT5,
+  .release_deps = (parsec_release_deps_t*)release_deps_of_complex_deps_FCT5,
+  .prepare_output = (parsec_hook_t*)NULL,
+  .prepare_input = (parsec_hook_t*)data_lookup_of_complex_deps_FCT5,
+  .time_estimate = NULL,
+  .get_datatype = datatype_lookup_of_complex_deps_FCT5,
+  .complete_execution = (parsec_hook_t*)complete_hook_of_complex_deps_FCT5,
+  .release_task = &release_task_of_complex_deps_FCT5,
+#if defined(PARSEC_SIM)
+  .sim_cost_fct = (parsec_sim_cost_fct_t*)NULL,
+#endif
+};
+
+
+/******                                      FCT4                                      ******/
+
+static inline int32_t minexpr_of_symb_complex_deps_FCT4_i_fct(const __parsec_complex_deps_internal_taskpool_t *__parsec_tp, const __parsec_complex_deps_FCT4_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_complex_deps_FCT4_i = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_complex_deps_FCT4_i_fct }
+                   }
+};
+static inline int maxexpr_of_symb_complex_deps_FCT4_i_fct(const __parsec_complex_deps_internal_taskpool_t *__parsec_tp, const __parsec_complex_deps_FCT4_parsec_assignment_t *locals)
+{
+  const int i = locals->i.value; (void)i;
+  const int k = locals->k.value; (void)k;
+
+  (void)i;
+  (void)k;
+  (void)__parsec_tp; (void)locals;
+  return (NI - 1);
+}
+static const parsec_expr_t maxexpr_of_symb_complex_deps_FCT4_i = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_complex_deps_FCT4_i_fct }
+                   }
+};
+static const parsec_symbol_t symb_complex_deps_FCT4_i = { .name = "i", .context_index = 0, .min = &minexpr_of_symb_complex_deps_FCT4_i, .max = &maxexpr_of_symb_complex_deps_FCT4_i, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int32_t minexpr_of_symb_complex_deps_FCT4_k_fct(const __parsec_complex_deps_internal_taskpool_t *__parsec_tp, const __parsec_complex_deps_FCT4_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_complex_deps_FCT4_k = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_complex_deps_FCT4_k_fct }
+                   }
+};
+static inline int maxexpr_of_symb_complex_deps_FCT4_k_fct(const __parsec_complex_deps_internal_taskpool_t *__parsec_tp, const __parsec_complex_deps_FCT4_parsec_assignment_t *locals)
+{
+  const int i = locals->i.value; (void)i;
+  const int k = locals->k.value; (void)k;
+
+  (void)i;
+  (void)k;
+  (void)__parsec_tp; (void)locals;
+  return (NK - 1);
+}
+static const parsec_expr_t maxexpr_of_symb_complex_deps_FCT4_k = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_complex_deps_FCT4_k_fct }
+                   }
+};
+static const parsec_symbol_t symb_complex_deps_FCT4_k = { .name = "k", .context_index = 1, .min = &minexpr_of_symb_complex_deps_FCT4_k, .max = &maxexpr_of_symb_complex_deps_FCT4_k, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int affinity_of_complex_deps_FCT4(const __parsec_complex_deps_FCT4_task_t *this_task,
+                     parsec_data_ref_t *ref)
+{
+    const __parsec_complex_deps_internal_taskpool_t *__parsec_tp = (const __parsec_complex_deps_internal_taskpool_t*)this_task->taskpool;
+  const int i = this_task->locals.i.value; (void)i;
+  const int k = this_task->locals.k.value; (void)k;
+
+  /* Silent Warnings: should look into predicate to know what variables are usefull */
+  (void)i;
+  (void)k;
+  ref->dc = (parsec_data_collection_t *)__parsec_tp->super._g_descA;
+  /* Compute data key */
+  ref->key = ref->dc->data_key(ref->dc, i, 0);
+  return 1;
+}
+static const parsec_property_t properties_of_complex_deps_FCT4[1] = {
+  {.name = NULL, .expr = NULL}
+};
+static const parsec_dep_t flow_of_complex_deps_FCT4_for_A_dep1_atline_77 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 0, /* complex_deps_FCT1 */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_complex_deps_FCT1_for_B,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_complex_deps_FCT4_for_A,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_complex_deps_FCT4_for_A = {
+  .name               = "A",
+  .sym_type           = PARSEC_SYM_IN,
+  .flow_flags         = PARSEC_FLOW_ACCESS_READ,
+  .flow_index         = 0,
+  .flow_datatype_mask = 0x0,
+  .dep_in     = { &flow_of_complex_deps_FCT4_for_A_dep1_atline_77 },
+  .dep_out    = { NULL }
+};
+
+static void
+iterate_predecessors_of_complex_deps_FCT4(parsec_execution_stream_t *es, const __parsec_complex_deps_FCT4_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_complex_deps_internal_taskpool_t *__parsec_tp = (const __parsec_complex_deps_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_complex_deps_FCT4_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_complex_deps_FCT4_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int i = __jdf2c__tmp_locals.i.value; (void)i;
+  const int k = __jdf2c__tmp_locals.k.value; (void)k;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)i;  (void)k;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_descA(i, 0);
+#endif
+  if( action_mask & 0x1 ) {  /* Flow of data A [0] */
+    data.data   = this_task->data._f_A.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x1 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_complex_deps_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_complex_deps_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        __parsec_complex_deps_FCT1_task_t* ncc = (__parsec_complex_deps_FCT1_task_t*)&nc;
+    nc.task_class = __parsec_tp->super.super.task_classes_array[complex_deps_FCT1.task_class_id];
+      const int FCT1_i = i;
+      if( (FCT1_i >= (0)) && (FCT1_i <= ((NI - 1))) ) {
+        assert(&nc.locals[0].value == &ncc->locals.i.value);
+        ncc->locals.i.value = FCT1_i;
+        const int FCT1_k = k;
+        if( (FCT1_k >= (0)) && (FCT1_k <= ((NK - 1))) ) {
+          assert(&nc.locals[1].value == &ncc->locals.k.value);
+          ncc->locals.k.value = FCT1_k;
+#if defined(DISTRIBUTED)
+          rank_dst = rank_of_descA(ncc->locals.i.value, 0);
+          if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+            vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, ncc->locals.i.value, 0);
+          nc.priority = __parsec_tp->super.super.priority;
+          successor_repo = FCT1_repo;
+          successor_repo_key = __jdf2c_make_key_FCT1((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+        RELEASE_DEP_OUTPUT(es, "A", this_task, "B", &nc, rank_src, rank_dst, &data);
+        if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_complex_deps_FCT4_for_A_dep1_atline_77, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+          }
+        }
+  }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static int release_deps_of_complex_deps_FCT4(parsec_execution_stream_t *es, __parsec_complex_deps_FCT4_task_t *this_task, uint32_t action_mask, parsec_remote_deps_t *deps)
+{
+  PARSEC_PINS(es, RELEASE_DEPS_BEGIN, (parsec_task_t *)this_task);  const __parsec_complex_deps_internal_taskpool_t *__parsec_tp = (const __parsec_complex_deps_internal_taskpool_t *)this_task->taskpool;
+  parsec_release_dep_fct_arg_t arg;
+  int __vp_id;
+  int consume_local_repo = 0;
+  arg.action_mask = action_mask;
+  arg.output_entry = NULL;
+  arg.output_repo = NULL;
+#if defined(DISTRIBUTED)
+  arg.remote_deps = deps;
+#endif  /* defined(DISTRIBUTED) */
+  assert(NULL != es);
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS )    arg.ready_lists = alloca(sizeof(parsec_task_t *) * es->virtual_process->parsec_context->nb_vp);
+  else
+    arg.ready_lists = NULL;
+  for( __vp_id = 0; __vp_id < es->virtual_process->parsec_context->nb_vp; arg.ready_lists[__vp_id++] = NULL );
+  (void)__parsec_tp; (void)deps;
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_A.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_A.source_repo, this_task->data._f_A.source_repo_entry->ht_item.key );
+    }
+  }
+  consume_local_repo = (this_task->repo_entry != NULL);
+  /* No successors, don't call iterate_successors and don't release any local deps */
+      if (consume_local_repo) {
+         data_repo_entry_used_once( FCT4_repo, this_task->repo_entry->ht_item.key );
+      }
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_A.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_A.data_in);
+    }
+  }
+  PARSEC_PINS(es, RELEASE_DEPS_END, (parsec_task_t *)this_task);  return 0;
+}
+
+static int data_lookup_of_complex_deps_FCT4(parsec_execution_stream_t *es, __parsec_complex_deps_FCT4_task_t *this_task)
+{
+  const __parsec_complex_deps_internal_taskpool_t *__parsec_tp = (__parsec_complex_deps_internal_taskpool_t *)this_task->taskpool;
+  parsec_assignment_t generic_locals[MAX_PARAM_COUNT];  /* generic task locals */
+  int target_device = 0; (void)target_device;
+  (void)__parsec_tp; (void)generic_locals; (void)es;
+  parsec_data_copy_t *chunk = NULL;
+  data_repo_t        *reshape_repo  = NULL, *consumed_repo  = NULL;
+  data_repo_entry_t  *reshape_entry = NULL, *consumed_entry = NULL;
+  parsec_key_t        reshape_entry_key = 0, consumed_entry_key = 0;
+  uint8_t             consumed_flow_index;
+  parsec_dep_data_description_t data;
+  int ret;
+  (void)reshape_repo; (void)reshape_entry; (void)reshape_entry_key;
+  (void)consumed_repo; (void)consumed_entry; (void)consumed_entry_key;
+  (void)consumed_flow_index;
+  (void)chunk; (void)data; (void)ret;
+  const int i = this_task->locals.i.value; (void)i;
+  const int k = this_task->locals.k.value; (void)k;
+  if( NULL == this_task->repo_entry ){
+    this_task->repo_entry = data_repo_lookup_entry_and_create(es, FCT4_repo,                                       __jdf2c_make_key_FCT4((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    data_repo_entry_addto_usage_limit(FCT4_repo, this_task->repo_entry->ht_item.key, 1);    this_task->repo_entry ->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(this_task->repo_entry ->sim_exec_date == 0);
+    this_task->repo_entry ->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  /* The reshape repo is the current task repo. */  reshape_repo = FCT4_repo;
+  reshape_entry_key = __jdf2c_make_key_FCT4((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals) ;
+  reshape_entry = this_task->repo_entry;
+  /* Lookup the input data, and store them in the context if any */
+
+if(! this_task->data._f_A.fulfill ){ /* Flow A */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_A.data_out = NULL;  /* input only */
+  /* Flow A [0] dependency [0] from predecessor FCT1 */
+  if( NULL == (chunk = this_task->data._f_A.data_in) ) {
+  /* No data set up by predecessor on this task input flow */
+__parsec_complex_deps_FCT1_parsec_assignment_t *target_locals = (__parsec_complex_deps_FCT1_parsec_assignment_t*)&generic_locals;
+  const int FCT1i = target_locals->i.value = i; (void)FCT1i;
+  const int FCT1k = target_locals->k.value = k; (void)FCT1k;
+    if( (reshape_entry != NULL) && (reshape_entry->data[0] != NULL) ){
+        /* Reshape promise set up on this task repo by predecessor */
+        consumed_repo = reshape_repo;
+        consumed_entry = reshape_entry;
+        consumed_entry_key = reshape_entry_key;
+        consumed_flow_index = 0;
+    }else{
+        /* Consume from predecessor's repo */
+        consumed_repo = FCT1_repo;
+        consumed_entry_key = __jdf2c_make_key_FCT1((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)target_locals) ;
+        consumed_entry = data_repo_lookup_entry( consumed_repo, consumed_entry_key );
+        consumed_flow_index = 1;
+    }
+    data.data   = NULL;
+    data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+        data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    ACQUIRE_FLOW(this_task, "A", &complex_deps_FCT1, "B", target_locals, chunk);
+    this_task->data._f_A.data_out = chunk;
+  } 
+  else {
+    /* Data set up by predecessor on this task input flow */
+    consumed_repo = this_task->data._f_A.source_repo;
+    consumed_entry = this_task->data._f_A.source_repo_entry;
+    consumed_entry_key = this_task->data._f_A.source_repo_entry->ht_item.key;
+    if( (reshape_entry != NULL) && (reshape_entry->data[0] != NULL) ){
+        /* Reshape promise set up on input by predecessor is on this task repo */
+        consumed_flow_index = 0;
+        assert( (this_task->data._f_A.source_repo == reshape_repo)
+             && (this_task->data._f_A.source_repo_entry == reshape_entry));
+    }else{
+        /* Reshape promise set up on input by predecessor is the predecesssor task repo */
+        consumed_flow_index = 1;
+    }
+    data.data   = NULL;
+    data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+        data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    this_task->data._f_A.data_out = parsec_data_get_copy(chunk->original, target_device);
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+    parsec_prof_grapher_data_input(chunk->original, (parsec_task_t*)this_task, &flow_of_complex_deps_FCT4_for_A, 0);
+#endif
+  }
+    this_task->data._f_A.data_in     = chunk;
+    this_task->data._f_A.source_repo       = consumed_repo;
+    this_task->data._f_A.source_repo_entry = consumed_entry;
+    this_task->data._f_A.fulfill = 1;
+}
+
+  /** Generate profiling information */
+#if defined(PARSEC_PROF_TRACE)
+  this_task->prof_info.desc = (parsec_data_collection_t*)__parsec_tp->super._g_descA;
+  this_task->prof_info.priority = this_task->priority;
+  this_task->prof_info.data_id   = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->data_key((parsec_data_collection_t*)__parsec_tp->super._g_descA, i, 0);
+  this_task->prof_info.task_class_id = this_task->task_class->task_class_id;
+  this_task->prof_info.task_return_code = -1;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int datatype_lookup_of_complex_deps_FCT4(parsec_execution_stream_t *es, const parsec_task_t *this_generic_task, const parsec_task_t *parent_task,
+              uint32_t* flow_mask, parsec_dep_data_description_t* data)
+{
+  const __parsec_complex_deps_FCT4_task_t *this_task = (__parsec_complex_deps_FCT4_task_t*)this_generic_task;
+  const __parsec_complex_deps_internal_taskpool_t *__parsec_tp = (__parsec_complex_deps_internal_taskpool_t *)this_task->taskpool;
+  (void)__parsec_tp; (void)es; (void)this_task; (void)data; (void)parent_task;
+  const int i = this_task->locals.i.value; (void)i;
+  const int k = this_task->locals.k.value; (void)k;
+  data->local.arena = data->remote.arena = NULL;
+  data->local.src_datatype  = data->local.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->local.src_count     = data->local.dst_count = 0;
+  data->local.src_displ     = data->local.dst_displ = 0;
+  data->data_future  = NULL;
+  if( (*flow_mask) & 0x80000000U ) { /* these are the input dependencies remote datatypes  */
+if( (*flow_mask) & 0x1U ) {  /* Flow A */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_complex_deps_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_complex_deps_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_complex_deps_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+    goto no_mask_match;
+  }
+
+  /* these are the output dependencies remote datatypes */
+ no_mask_match:
+  data->data                             = NULL;
+  data->remote.src_datatype = data->remote.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->remote.src_count    = data->remote.dst_count = 0;
+  data->remote.src_displ    = data->remote.dst_displ = 0;
+  data->data_future  = NULL;
+  (*flow_mask) = 0;  /* nothing left */
+  (void)i;  (void)k;
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+static int hook_of_complex_deps_FCT4(parsec_execution_stream_t *es, __parsec_complex_deps_FCT4_task_t *this_task)
+{
+  __parsec_complex_deps_internal_taskpool_t *__parsec_tp = (__parsec_complex_deps_internal_taskpool_t *)this_task->taskpool;
+  (void)es; (void)__parsec_tp;
+  const int i = this_task->locals.i.value; (void)i;
+  const int k = this_task->locals.k.value; (void)k;
+  (void)i;  (void)k;
+
+  /** Declare the variables that will hold the data, and all the accounting for each */
+  parsec_data_copy_t *_f_A = this_task->data._f_A.data_in;
+  void *A = PARSEC_DATA_COPY_GET_PTR(_f_A); (void)A;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    data_repo_entry_t *eA = this_task->data._f_A.source_repo_entry;
+    if( (NULL != eA) && (eA->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eA->sim_exec_date;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+  /** Cache Awareness Accounting */
+#if defined(PARSEC_CACHE_AWARENESS)
+  cache_buf_referenced(es->closest_cache, A);
+#endif /* PARSEC_CACHE_AWARENESS */
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                                  FCT4 BODY                                    -----*/
+
+
+/*-----                                END OF FCT4 BODY                                -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#endif  /*  defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+static int complete_hook_of_complex_deps_FCT4(parsec_execution_stream_t *es, __parsec_complex_deps_FCT4_task_t *this_task)
+{
+  const __parsec_complex_deps_internal_taskpool_t *__parsec_tp = (__parsec_complex_deps_internal_taskpool_t *)this_task->taskpool;
+#if defined(DISTRIBUTED)
+    const int i = this_task->locals.i.value; (void)i;
+  const int k = this_task->locals.k.value; (void)k;
+#endif  /* defined(DISTRIBUTED) */
+  (void)es; (void)__parsec_tp;
+parsec_data_t* data_t_desc = NULL; (void)data_t_desc;
+#if defined(DISTRIBUTED)
+  /** If not working on distributed, there is no risk that data is not in place */
+  (void)i;  (void)k;
+
+#endif /* DISTRIBUTED */
+#if defined(PARSEC_PROF_GRAPHER)
+  parsec_prof_grapher_task((parsec_task_t*)this_task, es->th_id, es->virtual_process->vp_id,
+     __jdf2c_key_fns_FCT4.key_hash(this_task->task_class->make_key( (parsec_taskpool_t*)this_task->taskpool, ((parsec_task_t*)this_task)->locals), NULL));
+#endif  /* defined(PARSEC_PROF_GRAPHER) */
+  release_deps_of_complex_deps_FCT4(es, this_task,
+      PARSEC_ACTION_RELEASE_REMOTE_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_REFS |
+      PARSEC_ACTION_RESHAPE_ON_RELEASE |
+      0x0,  /* mask of all dep_index */ 
+      NULL);
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static parsec_hook_return_t release_task_of_complex_deps_FCT4(parsec_execution_stream_t *es, parsec_task_t *this_task)
+{
+    const __parsec_complex_deps_internal_taskpool_t *__parsec_tp =
+        (const __parsec_complex_deps_internal_taskpool_t *)this_task->taskpool;
+    parsec_hash_table_t *ht = (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[3];
+    parsec_key_t key = this_task->task_class->make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals);
+    parsec_hashable_dependency_t *hash_dep = (parsec_hashable_dependency_t *)parsec_hash_table_remove(ht, key);
+    parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);
+    return parsec_release_task_to_mempool_update_nbtasks(es, this_task);
+}
+
+static char *complex_deps_complex_deps_FCT4_internal_init_deps_key_functions_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_complex_deps_internal_taskpool_t *__parsec_tp = (__parsec_complex_deps_internal_taskpool_t *)user_data;
+  int i = (__parsec_key) % __parsec_tp->FCT4_i_range + __parsec_tp->FCT4_i_min;
+  __parsec_key = __parsec_key / __parsec_tp->FCT4_i_range;
+  int k = (__parsec_key) % __parsec_tp->FCT4_k_range + __parsec_tp->FCT4_k_min;
+  __parsec_key = __parsec_key / __parsec_tp->FCT4_k_range;
+  snprintf(buffer, buffer_size, "FCT4(%d, %d)", i, k);
+  return buffer;
+}
+
+static parsec_key_fn_t complex_deps_complex_deps_FCT4_internal_init_deps_key_functions = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = complex_deps_complex_deps_FCT4_internal_init_deps_key_functions_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/* Needs: min-max count-tasks iterate */
+static int complex_deps_FCT4_internal_init(parsec_execution_stream_t * es, __parsec_complex_deps_FCT4_task_t * this_task)
+{
+  __parsec_complex_deps_internal_taskpool_t *__parsec_tp = (__parsec_complex_deps_internal_taskpool_t*)this_task->taskpool;
+  int32_t nb_tasks = 0, saved_nb_tasks = 0;
+int32_t __i_min = 0x7fffffff, __i_max = 0;int32_t __jdf2c_i_min = 0x7fffffff, __jdf2c_i_max = 0;int32_t __k_min = 0x7fffffff, __k_max = 0;int32_t __jdf2c_k_min = 0x7fffffff, __jdf2c_k_max = 0;  __parsec_complex_deps_FCT4_parsec_assignment_t assignments = {  .i.value = 0, .k.value = 0 };
+  int32_t  i,  k;
+  int32_t __jdf2c_i_start, __jdf2c_i_end, __jdf2c_i_inc;
+  int32_t __jdf2c_k_start, __jdf2c_k_end, __jdf2c_k_inc;
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+  PARSEC_PROFILING_TRACE(es->es_profile,
+                         this_task->taskpool->profiling_array[START_KEY(this_task->task_class->task_class_id)],
+                         0,
+                         this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    __jdf2c_i_start = 0;
+    __jdf2c_i_end = (NI - 1);
+    __jdf2c_i_inc = 1;
+    __i_min = parsec_imin(__jdf2c_i_start, __jdf2c_i_end);
+    __i_max = parsec_imax(__jdf2c_i_start, __jdf2c_i_end);
+    __jdf2c_i_min = parsec_imin(__jdf2c_i_min, __i_min);
+    __jdf2c_i_max = parsec_imax(__jdf2c_i_max, __i_max);
+    for(i =  __jdf2c_i_start;
+        i <= __jdf2c_i_end;
+        i += __jdf2c_i_inc) {
+    assignments.i.value = i;
+      __jdf2c_k_start = 0;
+      __jdf2c_k_end = (NK - 1);
+      __jdf2c_k_inc = 1;
+      __k_min = parsec_imin(__jdf2c_k_start, __jdf2c_k_end);
+      __k_max = parsec_imax(__jdf2c_k_start, __jdf2c_k_end);
+      __jdf2c_k_min = parsec_imin(__jdf2c_k_min, __k_min);
+      __jdf2c_k_max = parsec_imax(__jdf2c_k_max, __k_max);
+      for(k =  __jdf2c_k_start;
+          k <= __jdf2c_k_end;
+          k += __jdf2c_k_inc) {
+      assignments.k.value = k;
+      if( !FCT4_pred(i, k) ) continue;
+      nb_tasks++;
+    } /* Loop on normal range k */
+  } /* For loop of i */ 
+   if( 0 != nb_tasks ) {
+     (void)parsec_atomic_fetch_add_int32(&__parsec_tp->initial_number_tasks, nb_tasks);
+   }
+  /* Set the range variables for the collision-free hash-computation */
+  __parsec_tp->FCT4_i_min   = __jdf2c_i_min;
+  __parsec_tp->FCT4_i_range = (__jdf2c_i_max - __jdf2c_i_min) + 1;
+  __parsec_tp->FCT4_k_min   = __jdf2c_k_min;
+  __parsec_tp->FCT4_k_range = (__jdf2c_k_max - __jdf2c_k_min) + 1;
+  this_task->status = PARSEC_TASK_STATUS_COMPLETE;
+
+  PARSEC_AYU_REGISTER_TASK(&complex_deps_FCT4);
+  __parsec_tp->super.super.dependencies_array[3] = PARSEC_OBJ_NEW(parsec_hash_table_t);
+  parsec_hash_table_init(__parsec_tp->super.super.dependencies_array[3], offsetof(parsec_hashable_dependency_t, ht_item), 10, complex_deps_complex_deps_FCT4_internal_init_deps_key_functions, this_task->taskpool);
+  __parsec_tp->repositories[3] = data_repo_create_nothreadsafe(nb_tasks, __jdf2c_key_fns_FCT4, (parsec_taskpool_t*)__parsec_tp, 1);
+(void)saved_nb_tasks;
+(void)__i_min; (void)__i_max;(void)__k_min; (void)__k_max;  (void)__jdf2c_i_start; (void)__jdf2c_i_end; (void)__jdf2c_i_inc;  (void)__jdf2c_k_start; (void)__jdf2c_k_end; (void)__jdf2c_k_inc;  (void)assignments; (void)__parsec_tp; (void)es;
+  if(1 == parsec_atomic_fetch_dec_int32(&__parsec_tp->sync_point)) {
+    /* Last initialization task complete. Update the number of tasks. */
+    __parsec_tp->super.super.tdm.module->taskpool_addto_nb_tasks(&__parsec_tp->super.super, __parsec_tp->initial_number_tasks);
+    parsec_mfence();  /* write memory barrier to guarantee that the scheduler gets the correct number of tasks */
+    parsec_taskpool_enable((parsec_taskpool_t*)__parsec_tp, &__parsec_tp->startup_queue,
+                           (parsec_task_t*)this_task, es, __parsec_tp->super.super.nb_pending_actions);
+    __parsec_tp->super.super.tdm.module->taskpool_ready(&__parsec_tp->super.super);
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+    PARSEC_PROFILING_TRACE(es->es_profile,
+                           this_task->taskpool->profiling_array[2 * this_task->task_class->task_class_id + 1],
+                           0,
+                           this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    return PARSEC_HOOK_RETURN_DONE;
+  }
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static const __parsec_chore_t __complex_deps_FCT4_chores[] ={
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+    { .type     = PARSEC_DEV_CPU,
+      .evaluate = (parsec_evaluate_function_t*)NULL,
+      .hook     = (parsec_hook_t*)hook_of_complex_deps_FCT4 },
+#endif  /* defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+    { .type     = PARSEC_DEV_NONE,
+      .evaluate = NULL,
+      .hook     = (parsec_hook_t*)NULL },  /* End marker */
+};
+
+static const parsec_task_class_t complex_deps_FCT4 = {
+  .name = "FCT4",
+  .task_class_id = 3,
+  .nb_flows = 1,
+  .nb_parameters = 2,
+  .nb_locals = 2,
+  .task_class_type = PARSEC_TASK_CLASS_TYPE_PTG,
+  .params = { &symb_complex_deps_FCT4_i, &symb_complex_deps_FCT4_k, NULL },
+  .locals = { &symb_complex_deps_FCT4_i, &symb_complex_deps_FCT4_k, NULL },
+  .data_affinity = (parsec_data_ref_fn_t*)affinity_of_complex_deps_FCT4,
+  .initial_data = (parsec_data_ref_fn_t*)affinity_of_complex_deps_FCT4,
+  .final_data = (parsec_data_ref_fn_t*)affinity_of_complex_deps_FCT4,
+  .priority = NULL,
+  .properties = properties_of_complex_deps_FCT4,
+#if MAX_PARAM_COUNT < 1  /* number of read flows of FCT4 */
+  #error Too many read flows for task FCT4
+#endif  /* MAX_PARAM_COUNT */
+#if MAX_PARAM_COUNT < 0  /* number of write flows of FCT4 */
+  #error Too many write flows for task FCT4
+#endif  /* MAX_PARAM_COUNT */
+  .in = { &flow_of_complex_deps_FCT4_for_A, NULL },
+  .out = { NULL },
+  .flags = 0x0 | PARSEC_USE_DEPS_MASK,
+  .dependencies_goal = 0x1,
+  .make_key = __jdf2c_make_key_FCT4,
+  .task_snprintf = parsec_task_snprintf,
+#if defined(PARSEC_PROF_TRACE)
+  .profile_info = &parsec_task_profile_info,
+#endif
+  .key_functions = &__jdf2c_key_fns_FCT4,
+  .fini = (parsec_hook_t*)NULL,
+  .incarnations = __complex_deps_FCT4_chores,
+  .find_deps = parsec_hash_find_deps,
+  .update_deps = parsec_update_deps_with_mask,
+  .iterate_successors = (parsec_traverse_function_t*)NULL,
+  .iterate_predecessors = (parsec_traverse_function_t*)iterate_predecessors_of_complex_deps_FCT4,
+  .release_deps = (parsec_release_deps_t*)release_deps_of_complex_deps_FCT4,
+  .prepare_output = (parsec_hook_t*)NULL,
+  .prepare_input = (parsec_hook_t*)data_lookup_of_complex_deps_FCT4,
+  .time_estimate = NULL,
+  .get_datatype = datatype_lookup_of_complex_deps_FCT4,
+  .complete_execution = (parsec_hook_t*)complete_hook_of_complex_deps_FCT4,
+  .release_task = &release_task_of_complex_deps_FCT4,
+#if defined(PARSEC_SIM)
+  .sim_cost_fct = (parsec_sim_cost_fct_t*)NULL,
+#endif
+};
+
+
+/******                                      FCT3                                      ******/
+
+static inline int32_t minexpr_of_symb_complex_deps_FCT3_i_fct(const __parsec_complex_deps_internal_taskpool_t *__parsec_tp, const __parsec_complex_deps_FCT3_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_complex_deps_FCT3_i = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_complex_deps_FCT3_i_fct }
+                   }
+};
+static inline int maxexpr_of_symb_complex_deps_FCT3_i_fct(const __parsec_complex_deps_internal_taskpool_t *__parsec_tp, const __parsec_complex_deps_FCT3_parsec_assignment_t *locals)
+{
+  const int i = locals->i.value; (void)i;
+  const int k = locals->k.value; (void)k;
+  const int j = locals->j.value; (void)j;
+
+  (void)i;
+  (void)k;
+  (void)j;
+  (void)__parsec_tp; (void)locals;
+  return (NI - 1);
+}
+static const parsec_expr_t maxexpr_of_symb_complex_deps_FCT3_i = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_complex_deps_FCT3_i_fct }
+                   }
+};
+static const parsec_symbol_t symb_complex_deps_FCT3_i = { .name = "i", .context_index = 0, .min = &minexpr_of_symb_complex_deps_FCT3_i, .max = &maxexpr_of_symb_complex_deps_FCT3_i, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int32_t minexpr_of_symb_complex_deps_FCT3_k_fct(const __parsec_complex_deps_internal_taskpool_t *__parsec_tp, const __parsec_complex_deps_FCT3_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_complex_deps_FCT3_k = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_complex_deps_FCT3_k_fct }
+                   }
+};
+static inline int maxexpr_of_symb_complex_deps_FCT3_k_fct(const __parsec_complex_deps_internal_taskpool_t *__parsec_tp, const __parsec_complex_deps_FCT3_parsec_assignment_t *locals)
+{
+  const int i = locals->i.value; (void)i;
+  const int k = locals->k.value; (void)k;
+  const int j = locals->j.value; (void)j;
+
+  (void)i;
+  (void)k;
+  (void)j;
+  (void)__parsec_tp; (void)locals;
+  return (NK - 1);
+}
+static const parsec_expr_t maxexpr_of_symb_complex_deps_FCT3_k = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_complex_deps_FCT3_k_fct }
+                   }
+};
+static const parsec_symbol_t symb_complex_deps_FCT3_k = { .name = "k", .context_index = 1, .min = &minexpr_of_symb_complex_deps_FCT3_k, .max = &maxexpr_of_symb_complex_deps_FCT3_k, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int minexpr_of_symb_complex_deps_FCT3_j_fct(const __parsec_complex_deps_internal_taskpool_t *__parsec_tp, const __parsec_complex_deps_FCT3_parsec_assignment_t *locals)
+{
+  const int i = locals->i.value; (void)i;
+  const int k = locals->k.value;
+  const int j = locals->j.value; (void)j;
+
+  (void)i;
+  (void)k;
+  (void)j;
+  (void)__parsec_tp; (void)locals;
+  return k;
+}
+static const parsec_expr_t minexpr_of_symb_complex_deps_FCT3_j = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_complex_deps_FCT3_j_fct }
+                   }
+};
+static inline int maxexpr_of_symb_complex_deps_FCT3_j_fct(const __parsec_complex_deps_internal_taskpool_t *__parsec_tp, const __parsec_complex_deps_FCT3_parsec_assignment_t *locals)
+{
+  const int i = locals->i.value; (void)i;
+  const int k = locals->k.value; (void)k;
+  const int j = locals->j.value; (void)j;
+
+  (void)i;
+  (void)k;
+  (void)j;
+  (void)__parsec_tp; (void)locals;
+  return NK;
+}
+static const parsec_expr_t maxexpr_of_symb_complex_deps_FCT3_j = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_complex_deps_FCT3_j_fct }
+                   }
+};
+static const parsec_symbol_t symb_complex_deps_FCT3_j = { .name = "j", .context_index = 2, .min = &minexpr_of_symb_complex_deps_FCT3_j, .max = &maxexpr_of_symb_complex_deps_FCT3_j, .cst_inc = 1, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int affinity_of_complex_deps_FCT3(const __parsec_complex_deps_FCT3_task_t *this_task,
+                     parsec_data_ref_t *ref)
+{
+    const __parsec_complex_deps_internal_taskpool_t *__parsec_tp = (const __parsec_complex_deps_internal_taskpool_t*)this_task->taskpool;
+  const int i = this_task->locals.i.value; (void)i;
+  const int k = this_task->locals.k.value; (void)k;
+  const int j = this_task->locals.j.value; (void)j;
+
+  /* Silent Warnings: should look into predicate to know what variables are usefull */
+  (void)i;
+  (void)k;
+  (void)j;
+  ref->dc = (parsec_data_collection_t *)__parsec_tp->super._g_descA;
+  /* Compute data key */
+  ref->key = ref->dc->data_key(ref->dc, i, 0);
+  return 1;
+}
+static const parsec_property_t properties_of_complex_deps_FCT3[1] = {
+  {.name = NULL, .expr = NULL}
+};
+static const parsec_dep_t flow_of_complex_deps_FCT3_for_A_dep1_atline_65 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 0, /* complex_deps_FCT1 */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_complex_deps_FCT1_for_B,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_complex_deps_FCT3_for_A,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_complex_deps_FCT3_for_A = {
+  .name               = "A",
+  .sym_type           = PARSEC_SYM_IN,
+  .flow_flags         = PARSEC_FLOW_ACCESS_READ,
+  .flow_index         = 0,
+  .flow_datatype_mask = 0x0,
+  .dep_in     = { &flow_of_complex_deps_FCT3_for_A_dep1_atline_65 },
+  .dep_out    = { NULL }
+};
+
+static const parsec_dep_t flow_of_complex_deps_FCT3_for_B_dep1_atline_66 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 1, /* complex_deps_FCT2 */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_complex_deps_FCT2_for_A,
+  .dep_index = 1,
+  .dep_datatype_index = 1,
+  .belongs_to = &flow_of_complex_deps_FCT3_for_B,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_complex_deps_FCT3_for_B = {
+  .name               = "B",
+  .sym_type           = PARSEC_SYM_IN,
+  .flow_flags         = PARSEC_FLOW_ACCESS_READ,
+  .flow_index         = 1,
+  .flow_datatype_mask = 0x0,
+  .dep_in     = { &flow_of_complex_deps_FCT3_for_B_dep1_atline_66 },
+  .dep_out    = { NULL }
+};
+
+static void
+iterate_predecessors_of_complex_deps_FCT3(parsec_execution_stream_t *es, const __parsec_complex_deps_FCT3_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_complex_deps_internal_taskpool_t *__parsec_tp = (const __parsec_complex_deps_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_complex_deps_FCT3_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_complex_deps_FCT3_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int i = __jdf2c__tmp_locals.i.value; (void)i;
+  const int k = __jdf2c__tmp_locals.k.value; (void)k;
+  const int j = __jdf2c__tmp_locals.j.value; (void)j;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)i;  (void)k;  (void)j;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_descA(i, 0);
+#endif
+  if( action_mask & 0x1 ) {  /* Flow of data A [0] */
+    data.data   = this_task->data._f_A.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x1 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_complex_deps_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_complex_deps_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        __parsec_complex_deps_FCT1_task_t* ncc = (__parsec_complex_deps_FCT1_task_t*)&nc;
+    nc.task_class = __parsec_tp->super.super.task_classes_array[complex_deps_FCT1.task_class_id];
+      const int FCT1_i = i;
+      if( (FCT1_i >= (0)) && (FCT1_i <= ((NI - 1))) ) {
+        assert(&nc.locals[0].value == &ncc->locals.i.value);
+        ncc->locals.i.value = FCT1_i;
+        const int FCT1_k = k;
+        if( (FCT1_k >= (0)) && (FCT1_k <= ((NK - 1))) ) {
+          assert(&nc.locals[1].value == &ncc->locals.k.value);
+          ncc->locals.k.value = FCT1_k;
+#if defined(DISTRIBUTED)
+          rank_dst = rank_of_descA(ncc->locals.i.value, 0);
+          if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+            vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, ncc->locals.i.value, 0);
+          nc.priority = __parsec_tp->super.super.priority;
+          successor_repo = FCT1_repo;
+          successor_repo_key = __jdf2c_make_key_FCT1((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+        RELEASE_DEP_OUTPUT(es, "A", this_task, "B", &nc, rank_src, rank_dst, &data);
+        if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_complex_deps_FCT3_for_A_dep1_atline_65, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+          }
+        }
+  }
+  }
+  if( action_mask & 0x2 ) {  /* Flow of data B [1] */
+    data.data   = this_task->data._f_B.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x2 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_complex_deps_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_complex_deps_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        __parsec_complex_deps_FCT2_task_t* ncc = (__parsec_complex_deps_FCT2_task_t*)&nc;
+    nc.task_class = __parsec_tp->super.super.task_classes_array[complex_deps_FCT2.task_class_id];
+      const int FCT2_i = i;
+      if( (FCT2_i >= (0)) && (FCT2_i <= ((NI - 1))) ) {
+        assert(&nc.locals[0].value == &ncc->locals.i.value);
+        ncc->locals.i.value = FCT2_i;
+        const int FCT2_k = j;
+        if( (FCT2_k >= (0)) && (FCT2_k <= ((NK - 1))) ) {
+          assert(&nc.locals[1].value == &ncc->locals.k.value);
+          ncc->locals.k.value = FCT2_k;
+          const int FCT2_j = k;
+          if( (FCT2_j >= (ncc->locals.k.value)) && (FCT2_j <= (NK)) ) {
+            assert(&nc.locals[2].value == &ncc->locals.j.value);
+            ncc->locals.j.value = FCT2_j;
+#if defined(DISTRIBUTED)
+            rank_dst = rank_of_descA(ncc->locals.i.value, 0);
+            if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+              vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, ncc->locals.i.value, 0);
+            nc.priority = __parsec_tp->super.super.priority;
+            successor_repo = FCT2_repo;
+            successor_repo_key = __jdf2c_make_key_FCT2((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+          RELEASE_DEP_OUTPUT(es, "B", this_task, "A", &nc, rank_src, rank_dst, &data);
+          if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_complex_deps_FCT3_for_B_dep1_atline_66, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+            }
+          }
+        }
+  }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static int release_deps_of_complex_deps_FCT3(parsec_execution_stream_t *es, __parsec_complex_deps_FCT3_task_t *this_task, uint32_t action_mask, parsec_remote_deps_t *deps)
+{
+  PARSEC_PINS(es, RELEASE_DEPS_BEGIN, (parsec_task_t *)this_task);  const __parsec_complex_deps_internal_taskpool_t *__parsec_tp = (const __parsec_complex_deps_internal_taskpool_t *)this_task->taskpool;
+  parsec_release_dep_fct_arg_t arg;
+  int __vp_id;
+  int consume_local_repo = 0;
+  arg.action_mask = action_mask;
+  arg.output_entry = NULL;
+  arg.output_repo = NULL;
+#if defined(DISTRIBUTED)
+  arg.remote_deps = deps;
+#endif  /* defined(DISTRIBUTED) */
+  assert(NULL != es);
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS )    arg.ready_lists = alloca(sizeof(parsec_task_t *) * es->virtual_process->parsec_context->nb_vp);
+  else
+    arg.ready_lists = NULL;
+  for( __vp_id = 0; __vp_id < es->virtual_process->parsec_context->nb_vp; arg.ready_lists[__vp_id++] = NULL );
+  (void)__parsec_tp; (void)deps;
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_A.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_A.source_repo, this_task->data._f_A.source_repo_entry->ht_item.key );
+    }
+    if( NULL != this_task->data._f_B.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_B.source_repo, this_task->data._f_B.source_repo_entry->ht_item.key );
+    }
+  }
+  consume_local_repo = (this_task->repo_entry != NULL);
+  /* No successors, don't call iterate_successors and don't release any local deps */
+      if (consume_local_repo) {
+         data_repo_entry_used_once( FCT3_repo, this_task->repo_entry->ht_item.key );
+      }
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_A.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_A.data_in);
+    }
+    if( NULL != this_task->data._f_B.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_B.data_in);
+    }
+  }
+  PARSEC_PINS(es, RELEASE_DEPS_END, (parsec_task_t *)this_task);  return 0;
+}
+
+static int data_lookup_of_complex_deps_FCT3(parsec_execution_stream_t *es, __parsec_complex_deps_FCT3_task_t *this_task)
+{
+  const __parsec_complex_deps_internal_taskpool_t *__parsec_tp = (__parsec_complex_deps_internal_taskpool_t *)this_task->taskpool;
+  parsec_assignment_t generic_locals[MAX_PARAM_COUNT];  /* generic task locals */
+  int target_device = 0; (void)target_device;
+  (void)__parsec_tp; (void)generic_locals; (void)es;
+  parsec_data_copy_t *chunk = NULL;
+  data_repo_t        *reshape_repo  = NULL, *consumed_repo  = NULL;
+  data_repo_entry_t  *reshape_entry = NULL, *consumed_entry = NULL;
+  parsec_key_t        reshape_entry_key = 0, consumed_entry_key = 0;
+  uint8_t             consumed_flow_index;
+  parsec_dep_data_description_t data;
+  int ret;
+  (void)reshape_repo; (void)reshape_entry; (void)reshape_entry_key;
+  (void)consumed_repo; (void)consumed_entry; (void)consumed_entry_key;
+  (void)consumed_flow_index;
+  (void)chunk; (void)data; (void)ret;
+  const int i = this_task->locals.i.value; (void)i;
+  const int k = this_task->locals.k.value; (void)k;
+  const int j = this_task->locals.j.value; (void)j;
+  if( NULL == this_task->repo_entry ){
+    this_task->repo_entry = data_repo_lookup_entry_and_create(es, FCT3_repo,                                       __jdf2c_make_key_FCT3((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    data_repo_entry_addto_usage_limit(FCT3_repo, this_task->repo_entry->ht_item.key, 1);    this_task->repo_entry ->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(this_task->repo_entry ->sim_exec_date == 0);
+    this_task->repo_entry ->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  /* The reshape repo is the current task repo. */  reshape_repo = FCT3_repo;
+  reshape_entry_key = __jdf2c_make_key_FCT3((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals) ;
+  reshape_entry = this_task->repo_entry;
+  /* Lookup the input data, and store them in the context if any */
+
+if(! this_task->data._f_A.fulfill ){ /* Flow A */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_A.data_out = NULL;  /* input only */
+  /* Flow A [0] dependency [0] from predecessor FCT1 */
+  if( NULL == (chunk = this_task->data._f_A.data_in) ) {
+  /* No data set up by predecessor on this task input flow */
+__parsec_complex_deps_FCT1_parsec_assignment_t *target_locals = (__parsec_complex_deps_FCT1_parsec_assignment_t*)&generic_locals;
+  const int FCT1i = target_locals->i.value = i; (void)FCT1i;
+  const int FCT1k = target_locals->k.value = k; (void)FCT1k;
+    if( (reshape_entry != NULL) && (reshape_entry->data[0] != NULL) ){
+        /* Reshape promise set up on this task repo by predecessor */
+        consumed_repo = reshape_repo;
+        consumed_entry = reshape_entry;
+        consumed_entry_key = reshape_entry_key;
+        consumed_flow_index = 0;
+    }else{
+        /* Consume from predecessor's repo */
+        consumed_repo = FCT1_repo;
+        consumed_entry_key = __jdf2c_make_key_FCT1((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)target_locals) ;
+        consumed_entry = data_repo_lookup_entry( consumed_repo, consumed_entry_key );
+        consumed_flow_index = 1;
+    }
+    data.data   = NULL;
+    data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+        data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    ACQUIRE_FLOW(this_task, "A", &complex_deps_FCT1, "B", target_locals, chunk);
+    this_task->data._f_A.data_out = chunk;
+  } 
+  else {
+    /* Data set up by predecessor on this task input flow */
+    consumed_repo = this_task->data._f_A.source_repo;
+    consumed_entry = this_task->data._f_A.source_repo_entry;
+    consumed_entry_key = this_task->data._f_A.source_repo_entry->ht_item.key;
+    if( (reshape_entry != NULL) && (reshape_entry->data[0] != NULL) ){
+        /* Reshape promise set up on input by predecessor is on this task repo */
+        consumed_flow_index = 0;
+        assert( (this_task->data._f_A.source_repo == reshape_repo)
+             && (this_task->data._f_A.source_repo_entry == reshape_entry));
+    }else{
+        /* Reshape promise set up on input by predecessor is the predecesssor task repo */
+        consumed_flow_index = 1;
+    }
+    data.data   = NULL;
+    data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+        data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    this_task->data._f_A.data_out = parsec_data_get_copy(chunk->original, target_device);
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+    parsec_prof_grapher_data_input(chunk->original, (parsec_task_t*)this_task, &flow_of_complex_deps_FCT3_for_A, 0);
+#endif
+  }
+    this_task->data._f_A.data_in     = chunk;
+    this_task->data._f_A.source_repo       = consumed_repo;
+    this_task->data._f_A.source_repo_entry = consumed_entry;
+    this_task->data._f_A.fulfill = 1;
+}
+
+
+if(! this_task->data._f_B.fulfill ){ /* Flow B */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_B.data_out = NULL;  /* input only */
+  /* Flow B [1] dependency [1] from predecessor FCT2 */
+  if( NULL == (chunk = this_task->data._f_B.data_in) ) {
+  /* No data set up by predecessor on this task input flow */
+__parsec_complex_deps_FCT2_parsec_assignment_t *target_locals = (__parsec_complex_deps_FCT2_parsec_assignment_t*)&generic_locals;
+  const int FCT2i = target_locals->i.value = i; (void)FCT2i;
+  const int FCT2k = target_locals->k.value = j; (void)FCT2k;
+  const int FCT2j = target_locals->j.value = k; (void)FCT2j;
+    if( (reshape_entry != NULL) && (reshape_entry->data[1] != NULL) ){
+        /* Reshape promise set up on this task repo by predecessor */
+        consumed_repo = reshape_repo;
+        consumed_entry = reshape_entry;
+        consumed_entry_key = reshape_entry_key;
+        consumed_flow_index = 1;
+    }else{
+        /* Consume from predecessor's repo */
+        consumed_repo = FCT2_repo;
+        consumed_entry_key = __jdf2c_make_key_FCT2((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)target_locals) ;
+        consumed_entry = data_repo_lookup_entry( consumed_repo, consumed_entry_key );
+        consumed_flow_index = 0;
+    }
+    data.data   = NULL;
+    data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+        data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 1, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    ACQUIRE_FLOW(this_task, "B", &complex_deps_FCT2, "A", target_locals, chunk);
+    this_task->data._f_B.data_out = chunk;
+  } 
+  else {
+    /* Data set up by predecessor on this task input flow */
+    consumed_repo = this_task->data._f_B.source_repo;
+    consumed_entry = this_task->data._f_B.source_repo_entry;
+    consumed_entry_key = this_task->data._f_B.source_repo_entry->ht_item.key;
+    if( (reshape_entry != NULL) && (reshape_entry->data[1] != NULL) ){
+        /* Reshape promise set up on input by predecessor is on this task repo */
+        consumed_flow_index = 1;
+        assert( (this_task->data._f_B.source_repo == reshape_repo)
+             && (this_task->data._f_B.source_repo_entry == reshape_entry));
+    }else{
+        /* Reshape promise set up on input by predecessor is the predecesssor task repo */
+        consumed_flow_index = 0;
+    }
+    data.data   = NULL;
+    data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+        data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 1, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    this_task->data._f_B.data_out = parsec_data_get_copy(chunk->original, target_device);
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+    parsec_prof_grapher_data_input(chunk->original, (parsec_task_t*)this_task, &flow_of_complex_deps_FCT3_for_B, 0);
+#endif
+  }
+    this_task->data._f_B.data_in     = chunk;
+    this_task->data._f_B.source_repo       = consumed_repo;
+    this_task->data._f_B.source_repo_entry = consumed_entry;
+    this_task->data._f_B.fulfill = 1;
+}
+
+  /** Generate profiling information */
+#if defined(PARSEC_PROF_TRACE)
+  this_task->prof_info.desc = (parsec_data_collection_t*)__parsec_tp->super._g_descA;
+  this_task->prof_info.priority = this_task->priority;
+  this_task->prof_info.data_id   = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->data_key((parsec_data_collection_t*)__parsec_tp->super._g_descA, i, 0);
+  this_task->prof_info.task_class_id = this_task->task_class->task_class_id;
+  this_task->prof_info.task_return_code = -1;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int datatype_lookup_of_complex_deps_FCT3(parsec_execution_stream_t *es, const parsec_task_t *this_generic_task, const parsec_task_t *parent_task,
+              uint32_t* flow_mask, parsec_dep_data_description_t* data)
+{
+  const __parsec_complex_deps_FCT3_task_t *this_task = (__parsec_complex_deps_FCT3_task_t*)this_generic_task;
+  const __parsec_complex_deps_internal_taskpool_t *__parsec_tp = (__parsec_complex_deps_internal_taskpool_t *)this_task->taskpool;
+  (void)__parsec_tp; (void)es; (void)this_task; (void)data; (void)parent_task;
+  const int i = this_task->locals.i.value; (void)i;
+  const int k = this_task->locals.k.value; (void)k;
+  const int j = this_task->locals.j.value; (void)j;
+  data->local.arena = data->remote.arena = NULL;
+  data->local.src_datatype  = data->local.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->local.src_count     = data->local.dst_count = 0;
+  data->local.src_displ     = data->local.dst_displ = 0;
+  data->data_future  = NULL;
+  if( (*flow_mask) & 0x80000000U ) { /* these are the input dependencies remote datatypes  */
+if( (*flow_mask) & 0x1U ) {  /* Flow A */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_complex_deps_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_complex_deps_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_complex_deps_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+if( (*flow_mask) & 0x2U ) {  /* Flow B */
+    if( ((*flow_mask) & 0x2U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_complex_deps_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_complex_deps_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_complex_deps_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x2U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x2U) */
+    goto no_mask_match;
+  }
+
+  /* these are the output dependencies remote datatypes */
+ no_mask_match:
+  data->data                             = NULL;
+  data->remote.src_datatype = data->remote.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->remote.src_count    = data->remote.dst_count = 0;
+  data->remote.src_displ    = data->remote.dst_displ = 0;
+  data->data_future  = NULL;
+  (*flow_mask) = 0;  /* nothing left */
+  (void)i;  (void)k;  (void)j;
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+static int hook_of_complex_deps_FCT3(parsec_execution_stream_t *es, __parsec_complex_deps_FCT3_task_t *this_task)
+{
+  __parsec_complex_deps_internal_taskpool_t *__parsec_tp = (__parsec_complex_deps_internal_taskpool_t *)this_task->taskpool;
+  (void)es; (void)__parsec_tp;
+  const int i = this_task->locals.i.value; (void)i;
+  const int k = this_task->locals.k.value; (void)k;
+  const int j = this_task->locals.j.value; (void)j;
+  (void)i;  (void)k;  (void)j;
+
+  /** Declare the variables that will hold the data, and all the accounting for each */
+  parsec_data_copy_t *_f_A = this_task->data._f_A.data_in;
+  void *A = PARSEC_DATA_COPY_GET_PTR(_f_A); (void)A;
+  parsec_data_copy_t *_f_B = this_task->data._f_B.data_in;
+  void *B = PARSEC_DATA_COPY_GET_PTR(_f_B); (void)B;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    data_repo_entry_t *eA = this_task->data._f_A.source_repo_entry;
+    if( (NULL != eA) && (eA->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eA->sim_exec_date;
+    data_repo_entry_t *eB = this_task->data._f_B.source_repo_entry;
+    if( (NULL != eB) && (eB->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eB->sim_exec_date;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+  /** Cache Awareness Accounting */
+#if defined(PARSEC_CACHE_AWARENESS)
+  cache_buf_referenced(es->closest_cache, A);
+  cache_buf_referenced(es->closest_cache, B);
+#endif /* PARSEC_CACHE_AWARENESS */
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                                  FCT3 BODY                                    -----*/
+
+
+/*-----                                END OF FCT3 BODY                                -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#endif  /*  defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+static int complete_hook_of_complex_deps_FCT3(parsec_execution_stream_t *es, __parsec_complex_deps_FCT3_task_t *this_task)
+{
+  const __parsec_complex_deps_internal_taskpool_t *__parsec_tp = (__parsec_complex_deps_internal_taskpool_t *)this_task->taskpool;
+#if defined(DISTRIBUTED)
+    const int i = this_task->locals.i.value; (void)i;
+  const int k = this_task->locals.k.value; (void)k;
+  const int j = this_task->locals.j.value; (void)j;
+#endif  /* defined(DISTRIBUTED) */
+  (void)es; (void)__parsec_tp;
+parsec_data_t* data_t_desc = NULL; (void)data_t_desc;
+#if defined(DISTRIBUTED)
+  /** If not working on distributed, there is no risk that data is not in place */
+  (void)i;  (void)k;  (void)j;
+
+#endif /* DISTRIBUTED */
+#if defined(PARSEC_PROF_GRAPHER)
+  parsec_prof_grapher_task((parsec_task_t*)this_task, es->th_id, es->virtual_process->vp_id,
+     __jdf2c_key_fns_FCT3.key_hash(this_task->task_class->make_key( (parsec_taskpool_t*)this_task->taskpool, ((parsec_task_t*)this_task)->locals), NULL));
+#endif  /* defined(PARSEC_PROF_GRAPHER) */
+  release_deps_of_complex_deps_FCT3(es, this_task,
+      PARSEC_ACTION_RELEASE_REMOTE_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_REFS |
+      PARSEC_ACTION_RESHAPE_ON_RELEASE |
+      0x0,  /* mask of all dep_index */ 
+      NULL);
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static parsec_hook_return_t release_task_of_complex_deps_FCT3(parsec_execution_stream_t *es, parsec_task_t *this_task)
+{
+    const __parsec_complex_deps_internal_taskpool_t *__parsec_tp =
+        (const __parsec_complex_deps_internal_taskpool_t *)this_task->taskpool;
+    parsec_hash_table_t *ht = (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[2];
+    parsec_key_t key = this_task->task_class->make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals);
+    parsec_hashable_dependency_t *hash_dep = (parsec_hashable_dependency_t *)parsec_hash_table_remove(ht, key);
+    parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);
+    return parsec_release_task_to_mempool_update_nbtasks(es, this_task);
+}
+
+static char *complex_deps_complex_deps_FCT3_internal_init_deps_key_functions_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_complex_deps_internal_taskpool_t *__parsec_tp = (__parsec_complex_deps_internal_taskpool_t *)user_data;
+  int i = (__parsec_key) % __parsec_tp->FCT3_i_range + __parsec_tp->FCT3_i_min;
+  __parsec_key = __parsec_key / __parsec_tp->FCT3_i_range;
+  int k = (__parsec_key) % __parsec_tp->FCT3_k_range + __parsec_tp->FCT3_k_min;
+  __parsec_key = __parsec_key / __parsec_tp->FCT3_k_range;
+  int j = (__parsec_key) % __parsec_tp->FCT3_j_range + __parsec_tp->FCT3_j_min;
+  __parsec_key = __parsec_key / __parsec_tp->FCT3_j_range;
+  snprintf(buffer, buffer_size, "FCT3(%d, %d, %d)", i, k, j);
+  return buffer;
+}
+
+static parsec_key_fn_t complex_deps_complex_deps_FCT3_internal_init_deps_key_functions = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = complex_deps_complex_deps_FCT3_internal_init_deps_key_functions_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/* Needs: min-max count-tasks iterate */
+static int complex_deps_FCT3_internal_init(parsec_execution_stream_t * es, __parsec_complex_deps_FCT3_task_t * this_task)
+{
+  __parsec_complex_deps_internal_taskpool_t *__parsec_tp = (__parsec_complex_deps_internal_taskpool_t*)this_task->taskpool;
+  int32_t nb_tasks = 0, saved_nb_tasks = 0;
+int32_t __i_min = 0x7fffffff, __i_max = 0;int32_t __jdf2c_i_min = 0x7fffffff, __jdf2c_i_max = 0;int32_t __k_min = 0x7fffffff, __k_max = 0;int32_t __jdf2c_k_min = 0x7fffffff, __jdf2c_k_max = 0;int32_t __j_min = 0x7fffffff, __j_max = 0;int32_t __jdf2c_j_min = 0x7fffffff, __jdf2c_j_max = 0;  __parsec_complex_deps_FCT3_parsec_assignment_t assignments = {  .i.value = 0, .k.value = 0, .j.value = 0 };
+  int32_t  i,  k,  j;
+  int32_t __jdf2c_i_start, __jdf2c_i_end, __jdf2c_i_inc;
+  int32_t __jdf2c_k_start, __jdf2c_k_end, __jdf2c_k_inc;
+  int32_t __jdf2c_j_start, __jdf2c_j_end, __jdf2c_j_inc;
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+  PARSEC_PROFILING_TRACE(es->es_profile,
+                         this_task->taskpool->profiling_array[START_KEY(this_task->task_class->task_class_id)],
+                         0,
+                         this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    __jdf2c_i_start = 0;
+    __jdf2c_i_end = (NI - 1);
+    __jdf2c_i_inc = 1;
+    __i_min = parsec_imin(__jdf2c_i_start, __jdf2c_i_end);
+    __i_max = parsec_imax(__jdf2c_i_start, __jdf2c_i_end);
+    __jdf2c_i_min = parsec_imin(__jdf2c_i_min, __i_min);
+    __jdf2c_i_max = parsec_imax(__jdf2c_i_max, __i_max);
+    for(i =  __jdf2c_i_start;
+        i <= __jdf2c_i_end;
+        i += __jdf2c_i_inc) {
+    assignments.i.value = i;
+      __jdf2c_k_start = 0;
+      __jdf2c_k_end = (NK - 1);
+      __jdf2c_k_inc = 1;
+      __k_min = parsec_imin(__jdf2c_k_start, __jdf2c_k_end);
+      __k_max = parsec_imax(__jdf2c_k_start, __jdf2c_k_end);
+      __jdf2c_k_min = parsec_imin(__jdf2c_k_min, __k_min);
+      __jdf2c_k_max = parsec_imax(__jdf2c_k_max, __k_max);
+      for(k =  __jdf2c_k_start;
+          k <= __jdf2c_k_end;
+          k += __jdf2c_k_inc) {
+      assignments.k.value = k;
+        __jdf2c_j_start = k;
+        __jdf2c_j_end = NK;
+        __jdf2c_j_inc = 1;
+        __j_min = parsec_imin(__jdf2c_j_start, __jdf2c_j_end);
+        __j_max = parsec_imax(__jdf2c_j_start, __jdf2c_j_end);
+        __jdf2c_j_min = parsec_imin(__jdf2c_j_min, __j_min);
+        __jdf2c_j_max = parsec_imax(__jdf2c_j_max, __j_max);
+        for(j =  __jdf2c_j_start;
+            j <= __jdf2c_j_end;
+            j += __jdf2c_j_inc) {
+        assignments.j.value = j;
+        if( !FCT3_pred(i, k, j) ) continue;
+        nb_tasks++;
+      } /* Loop on normal range j */
+    } /* For loop of k */ 
+  } /* For loop of i */ 
+   if( 0 != nb_tasks ) {
+     (void)parsec_atomic_fetch_add_int32(&__parsec_tp->initial_number_tasks, nb_tasks);
+   }
+  /* Set the range variables for the collision-free hash-computation */
+  __parsec_tp->FCT3_i_min   = __jdf2c_i_min;
+  __parsec_tp->FCT3_i_range = (__jdf2c_i_max - __jdf2c_i_min) + 1;
+  __parsec_tp->FCT3_k_min   = __jdf2c_k_min;
+  __parsec_tp->FCT3_k_range = (__jdf2c_k_max - __jdf2c_k_min) + 1;
+  __parsec_tp->FCT3_j_min   = __jdf2c_j_min;
+  __parsec_tp->FCT3_j_range = (__jdf2c_j_max - __jdf2c_j_min) + 1;
+  this_task->status = PARSEC_TASK_STATUS_COMPLETE;
+
+  PARSEC_AYU_REGISTER_TASK(&complex_deps_FCT3);
+  __parsec_tp->super.super.dependencies_array[2] = PARSEC_OBJ_NEW(parsec_hash_table_t);
+  parsec_hash_table_init(__parsec_tp->super.super.dependencies_array[2], offsetof(parsec_hashable_dependency_t, ht_item), 10, complex_deps_complex_deps_FCT3_internal_init_deps_key_functions, this_task->taskpool);
+  __parsec_tp->repositories[2] = data_repo_create_nothreadsafe(nb_tasks, __jdf2c_key_fns_FCT3, (parsec_taskpool_t*)__parsec_tp, 2);
+(void)saved_nb_tasks;
+(void)__i_min; (void)__i_max;(void)__k_min; (void)__k_max;(void)__j_min; (void)__j_max;  (void)__jdf2c_i_start; (void)__jdf2c_i_end; (void)__jdf2c_i_inc;  (void)__jdf2c_k_start; (void)__jdf2c_k_end; (void)__jdf2c_k_inc;  (void)__jdf2c_j_start; (void)__jdf2c_j_end; (void)__jdf2c_j_inc;  (void)assignments; (void)__parsec_tp; (void)es;
+  if(1 == parsec_atomic_fetch_dec_int32(&__parsec_tp->sync_point)) {
+    /* Last initialization task complete. Update the number of tasks. */
+    __parsec_tp->super.super.tdm.module->taskpool_addto_nb_tasks(&__parsec_tp->super.super, __parsec_tp->initial_number_tasks);
+    parsec_mfence();  /* write memory barrier to guarantee that the scheduler gets the correct number of tasks */
+    parsec_taskpool_enable((parsec_taskpool_t*)__parsec_tp, &__parsec_tp->startup_queue,
+                           (parsec_task_t*)this_task, es, __parsec_tp->super.super.nb_pending_actions);
+    __parsec_tp->super.super.tdm.module->taskpool_ready(&__parsec_tp->super.super);
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+    PARSEC_PROFILING_TRACE(es->es_profile,
+                           this_task->taskpool->profiling_array[2 * this_task->task_class->task_class_id + 1],
+                           0,
+                           this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    return PARSEC_HOOK_RETURN_DONE;
+  }
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static const __parsec_chore_t __complex_deps_FCT3_chores[] ={
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+    { .type     = PARSEC_DEV_CPU,
+      .evaluate = (parsec_evaluate_function_t*)NULL,
+      .hook     = (parsec_hook_t*)hook_of_complex_deps_FCT3 },
+#endif  /* defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+    { .type     = PARSEC_DEV_NONE,
+      .evaluate = NULL,
+      .hook     = (parsec_hook_t*)NULL },  /* End marker */
+};
+
+static const parsec_task_class_t complex_deps_FCT3 = {
+  .name = "FCT3",
+  .task_class_id = 2,
+  .nb_flows = 2,
+  .nb_parameters = 3,
+  .nb_locals = 3,
+  .task_class_type = PARSEC_TASK_CLASS_TYPE_PTG,
+  .params = { &symb_complex_deps_FCT3_i, &symb_complex_deps_FCT3_k, &symb_complex_deps_FCT3_j, NULL },
+  .locals = { &symb_complex_deps_FCT3_i, &symb_complex_deps_FCT3_k, &symb_complex_deps_FCT3_j, NULL },
+  .data_affinity = (parsec_data_ref_fn_t*)affinity_of_complex_deps_FCT3,
+  .initial_data = (parsec_data_ref_fn_t*)affinity_of_complex_deps_FCT3,
+  .final_data = (parsec_data_ref_fn_t*)affinity_of_complex_deps_FCT3,
+  .priority = NULL,
+  .properties = properties_of_complex_deps_FCT3,
+#if MAX_PARAM_COUNT < 2  /* number of read flows of FCT3 */
+  #error Too many read flows for task FCT3
+#endif  /* MAX_PARAM_COUNT */
+#if MAX_PARAM_COUNT < 0  /* number of write flows of FCT3 */
+  #error Too many write flows for task FCT3
+#endif  /* MAX_PARAM_COUNT */
+  .in = { &flow_of_complex_deps_FCT3_for_A, &flow_of_complex_deps_FCT3_for_B, NULL },
+  .out = { NULL },
+  .flags = 0x0 | PARSEC_USE_DEPS_MASK,
+  .dependencies_goal = 0x3,
+  .make_key = __jdf2c_make_key_FCT3,
+  .task_snprintf = parsec_task_snprintf,
+#if defined(PARSEC_PROF_TRACE)
+  .profile_info = &parsec_task_profile_info,
+#endif
+  .key_functions = &__jdf2c_key_fns_FCT3,
+  .fini = (parsec_hook_t*)NULL,
+  .incarnations = __complex_deps_FCT3_chores,
+  .find_deps = parsec_hash_find_deps,
+  .update_deps = parsec_update_deps_with_mask,
+  .iterate_successors = (parsec_traverse_function_t*)NULL,
+  .iterate_predecessors = (parsec_traverse_function_t*)iterate_predecessors_of_complex_deps_FCT3,
+  .release_deps = (parsec_release_deps_t*)release_deps_of_complex_deps_FCT3,
+  .prepare_output = (parsec_hook_t*)NULL,
+  .prepare_input = (parsec_hook_t*)data_lookup_of_complex_deps_FCT3,
+  .time_estimate = NULL,
+  .get_datatype = datatype_lookup_of_complex_deps_FCT3,
+  .complete_execution = (parsec_hook_t*)complete_hook_of_complex_deps_FCT3,
+  .release_task = &release_task_of_complex_deps_FCT3,
+#if defined(PARSEC_SIM)
+  .sim_cost_fct = (parsec_sim_cost_fct_t*)NULL,
+#endif
+};
+
+
+/******                                      FCT2                                      ******/
+
+static inline int32_t minexpr_of_symb_complex_deps_FCT2_i_fct(const __parsec_complex_deps_internal_taskpool_t *__parsec_tp, const __parsec_complex_deps_FCT2_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_complex_deps_FCT2_i = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_complex_deps_FCT2_i_fct }
+                   }
+};
+static inline int maxexpr_of_symb_complex_deps_FCT2_i_fct(const __parsec_complex_deps_internal_taskpool_t *__parsec_tp, const __parsec_complex_deps_FCT2_parsec_assignment_t *locals)
+{
+  const int i = locals->i.value; (void)i;
+  const int k = locals->k.value; (void)k;
+  const int j = locals->j.value; (void)j;
+
+  (void)i;
+  (void)k;
+  (void)j;
+  (void)__parsec_tp; (void)locals;
+  return (NI - 1);
+}
+static const parsec_expr_t maxexpr_of_symb_complex_deps_FCT2_i = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_complex_deps_FCT2_i_fct }
+                   }
+};
+static const parsec_symbol_t symb_complex_deps_FCT2_i = { .name = "i", .context_index = 0, .min = &minexpr_of_symb_complex_deps_FCT2_i, .max = &maxexpr_of_symb_complex_deps_FCT2_i, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int32_t minexpr_of_symb_complex_deps_FCT2_k_fct(const __parsec_complex_deps_internal_taskpool_t *__parsec_tp, const __parsec_complex_deps_FCT2_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_complex_deps_FCT2_k = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_complex_deps_FCT2_k_fct }
+                   }
+};
+static inline int maxexpr_of_symb_complex_deps_FCT2_k_fct(const __parsec_complex_deps_internal_taskpool_t *__parsec_tp, const __parsec_complex_deps_FCT2_parsec_assignment_t *locals)
+{
+  const int i = locals->i.value; (void)i;
+  const int k = locals->k.value; (void)k;
+  const int j = locals->j.value; (void)j;
+
+  (void)i;
+  (void)k;
+  (void)j;
+  (void)__parsec_tp; (void)locals;
+  return (NK - 1);
+}
+static const parsec_expr_t maxexpr_of_symb_complex_deps_FCT2_k = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_complex_deps_FCT2_k_fct }
+                   }
+};
+static const parsec_symbol_t symb_complex_deps_FCT2_k = { .name = "k", .context_index = 1, .min = &minexpr_of_symb_complex_deps_FCT2_k, .max = &maxexpr_of_symb_complex_deps_FCT2_k, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int minexpr_of_symb_complex_deps_FCT2_j_fct(const __parsec_complex_deps_internal_taskpool_t *__parsec_tp, const __parsec_complex_deps_FCT2_parsec_assignment_t *locals)
+{
+  const int i = locals->i.value; (void)i;
+  const int k = locals->k.value;
+  const int j = locals->j.value; (void)j;
+
+  (void)i;
+  (void)k;
+  (void)j;
+  (void)__parsec_tp; (void)locals;
+  return k;
+}
+static const parsec_expr_t minexpr_of_symb_complex_deps_FCT2_j = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_complex_deps_FCT2_j_fct }
+                   }
+};
+static inline int maxexpr_of_symb_complex_deps_FCT2_j_fct(const __parsec_complex_deps_internal_taskpool_t *__parsec_tp, const __parsec_complex_deps_FCT2_parsec_assignment_t *locals)
+{
+  const int i = locals->i.value; (void)i;
+  const int k = locals->k.value; (void)k;
+  const int j = locals->j.value; (void)j;
+
+  (void)i;
+  (void)k;
+  (void)j;
+  (void)__parsec_tp; (void)locals;
+  return NK;
+}
+static const parsec_expr_t maxexpr_of_symb_complex_deps_FCT2_j = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_complex_deps_FCT2_j_fct }
+                   }
+};
+static const parsec_symbol_t symb_complex_deps_FCT2_j = { .name = "j", .context_index = 2, .min = &minexpr_of_symb_complex_deps_FCT2_j, .max = &maxexpr_of_symb_complex_deps_FCT2_j, .cst_inc = 1, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int affinity_of_complex_deps_FCT2(const __parsec_complex_deps_FCT2_task_t *this_task,
+                     parsec_data_ref_t *ref)
+{
+    const __parsec_complex_deps_internal_taskpool_t *__parsec_tp = (const __parsec_complex_deps_internal_taskpool_t*)this_task->taskpool;
+  const int i = this_task->locals.i.value; (void)i;
+  const int k = this_task->locals.k.value; (void)k;
+  const int j = this_task->locals.j.value; (void)j;
+
+  /* Silent Warnings: should look into predicate to know what variables are usefull */
+  (void)i;
+  (void)k;
+  (void)j;
+  ref->dc = (parsec_data_collection_t *)__parsec_tp->super._g_descA;
+  /* Compute data key */
+  ref->key = ref->dc->data_key(ref->dc, i, 0);
+  return 1;
+}
+static const parsec_property_t properties_of_complex_deps_FCT2[1] = {
+  {.name = NULL, .expr = NULL}
+};
+static const parsec_dep_t flow_of_complex_deps_FCT2_for_A_dep1_atline_51 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 0, /* complex_deps_FCT1 */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_complex_deps_FCT1_for_B,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_complex_deps_FCT2_for_A,
+};
+static const parsec_dep_t flow_of_complex_deps_FCT2_for_A_dep2_atline_52 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 2, /* complex_deps_FCT3 */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_complex_deps_FCT3_for_B,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_complex_deps_FCT2_for_A,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+#if MAX_DEP_OUT_COUNT < 1  /* number of output dependencies */
+    #error Too many output dependencies (supports up to MAX_DEP_OUT_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_OUT_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_complex_deps_FCT2_for_A = {
+  .name               = "A",
+  .sym_type           = PARSEC_SYM_INOUT,
+  .flow_flags         = PARSEC_FLOW_ACCESS_READ,
+  .flow_index         = 0,
+  .flow_datatype_mask = 0x1,
+  .dep_in     = { &flow_of_complex_deps_FCT2_for_A_dep1_atline_51 },
+  .dep_out    = { &flow_of_complex_deps_FCT2_for_A_dep2_atline_52 }
+};
+
+static void
+iterate_successors_of_complex_deps_FCT2(parsec_execution_stream_t *es, const __parsec_complex_deps_FCT2_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_complex_deps_internal_taskpool_t *__parsec_tp = (const __parsec_complex_deps_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_complex_deps_FCT2_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_complex_deps_FCT2_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int i = __jdf2c__tmp_locals.i.value; (void)i;
+  const int k = __jdf2c__tmp_locals.k.value; (void)k;
+  const int j = __jdf2c__tmp_locals.j.value; (void)j;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)i;  (void)k;  (void)j;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_descA(i, 0);
+#endif
+  if( action_mask & 0x1 ) {  /* Flow of data A [0] */
+    data.data   = this_task->data._f_A.data_out;
+    data.data_future  = NULL;
+    if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_complex_deps_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_complex_deps_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+       __parsec_complex_deps_FCT3_task_t* ncc = (__parsec_complex_deps_FCT3_task_t*)&nc;
+    nc.task_class = __parsec_tp->super.super.task_classes_array[complex_deps_FCT3.task_class_id];
+      const int FCT3_i = i;
+      if( (FCT3_i >= (0)) && (FCT3_i <= ((NI - 1))) ) {
+        assert(&nc.locals[0].value == &ncc->locals.i.value);
+        ncc->locals.i.value = FCT3_i;
+        const int FCT3_k = j;
+        if( (FCT3_k >= (0)) && (FCT3_k <= ((NK - 1))) ) {
+          assert(&nc.locals[1].value == &ncc->locals.k.value);
+          ncc->locals.k.value = FCT3_k;
+          const int FCT3_j = k;
+          if( (FCT3_j >= (ncc->locals.k.value)) && (FCT3_j <= (NK)) ) {
+            assert(&nc.locals[2].value == &ncc->locals.j.value);
+            ncc->locals.j.value = FCT3_j;
+#if defined(DISTRIBUTED)
+            rank_dst = rank_of_descA(ncc->locals.i.value, 0);
+            if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+              vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, ncc->locals.i.value, 0);
+            nc.priority = __parsec_tp->super.super.priority;
+            successor_repo = FCT3_repo;
+            successor_repo_key = __jdf2c_make_key_FCT3((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+          RELEASE_DEP_OUTPUT(es, "A", this_task, "B", &nc, rank_src, rank_dst, &data);
+          if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_complex_deps_FCT2_for_A_dep2_atline_52, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+            }
+          }
+        }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static void
+iterate_predecessors_of_complex_deps_FCT2(parsec_execution_stream_t *es, const __parsec_complex_deps_FCT2_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_complex_deps_internal_taskpool_t *__parsec_tp = (const __parsec_complex_deps_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_complex_deps_FCT2_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_complex_deps_FCT2_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int i = __jdf2c__tmp_locals.i.value; (void)i;
+  const int k = __jdf2c__tmp_locals.k.value; (void)k;
+  const int j = __jdf2c__tmp_locals.j.value; (void)j;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)i;  (void)k;  (void)j;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_descA(i, 0);
+#endif
+  if( action_mask & 0x1 ) {  /* Flow of data A [0] */
+    data.data   = this_task->data._f_A.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x1 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_complex_deps_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_complex_deps_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        __parsec_complex_deps_FCT1_task_t* ncc = (__parsec_complex_deps_FCT1_task_t*)&nc;
+    nc.task_class = __parsec_tp->super.super.task_classes_array[complex_deps_FCT1.task_class_id];
+      const int FCT1_i = i;
+      if( (FCT1_i >= (0)) && (FCT1_i <= ((NI - 1))) ) {
+        assert(&nc.locals[0].value == &ncc->locals.i.value);
+        ncc->locals.i.value = FCT1_i;
+        const int FCT1_k = k;
+        if( (FCT1_k >= (0)) && (FCT1_k <= ((NK - 1))) ) {
+          assert(&nc.locals[1].value == &ncc->locals.k.value);
+          ncc->locals.k.value = FCT1_k;
+#if defined(DISTRIBUTED)
+          rank_dst = rank_of_descA(ncc->locals.i.value, 0);
+          if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+            vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, ncc->locals.i.value, 0);
+          nc.priority = __parsec_tp->super.super.priority;
+          successor_repo = FCT1_repo;
+          successor_repo_key = __jdf2c_make_key_FCT1((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+        RELEASE_DEP_OUTPUT(es, "A", this_task, "B", &nc, rank_src, rank_dst, &data);
+        if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_complex_deps_FCT2_for_A_dep1_atline_51, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+          }
+        }
+  }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static int release_deps_of_complex_deps_FCT2(parsec_execution_stream_t *es, __parsec_complex_deps_FCT2_task_t *this_task, uint32_t action_mask, parsec_remote_deps_t *deps)
+{
+  PARSEC_PINS(es, RELEASE_DEPS_BEGIN, (parsec_task_t *)this_task);  const __parsec_complex_deps_internal_taskpool_t *__parsec_tp = (const __parsec_complex_deps_internal_taskpool_t *)this_task->taskpool;
+  parsec_release_dep_fct_arg_t arg;
+  int __vp_id;
+  int consume_local_repo = 0;
+  arg.action_mask = action_mask;
+  arg.output_entry = NULL;
+  arg.output_repo = NULL;
+#if defined(DISTRIBUTED)
+  arg.remote_deps = deps;
+#endif  /* defined(DISTRIBUTED) */
+  assert(NULL != es);
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS )    arg.ready_lists = alloca(sizeof(parsec_task_t *) * es->virtual_process->parsec_context->nb_vp);
+  else
+    arg.ready_lists = NULL;
+  for( __vp_id = 0; __vp_id < es->virtual_process->parsec_context->nb_vp; arg.ready_lists[__vp_id++] = NULL );
+  (void)__parsec_tp; (void)deps;
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_A.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_A.source_repo, this_task->data._f_A.source_repo_entry->ht_item.key );
+    }
+  }
+  consume_local_repo = (this_task->repo_entry != NULL);
+  arg.output_repo = FCT2_repo;
+  arg.output_entry = this_task->repo_entry;
+  arg.output_usage = 0;
+  if( action_mask & (PARSEC_ACTION_RELEASE_LOCAL_DEPS | PARSEC_ACTION_GET_REPO_ENTRY) ) {
+    arg.output_entry = data_repo_lookup_entry_and_create( es, arg.output_repo, __jdf2c_make_key_FCT2((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    arg.output_entry->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(arg.output_entry->sim_exec_date == 0);
+    arg.output_entry->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  if(action_mask & ( PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE ) ){
+    /* Generate the reshape promise for the outputs that need it */
+    iterate_successors_of_complex_deps_FCT2(es, this_task, action_mask, parsec_set_up_reshape_promise, &arg);
+   }
+  iterate_successors_of_complex_deps_FCT2(es, this_task, action_mask, parsec_release_dep_fct, &arg);
+
+#if defined(DISTRIBUTED)
+  if( (action_mask & PARSEC_ACTION_SEND_REMOTE_DEPS) && (NULL != arg.remote_deps)) {
+    parsec_remote_dep_activate(es, (parsec_task_t *)this_task, arg.remote_deps, arg.remote_deps->outgoing_mask);
+  }
+#endif
+
+  if(action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS) {
+    data_repo_entry_addto_usage_limit(FCT2_repo, arg.output_entry->ht_item.key, arg.output_usage);
+    __parsec_schedule_vp(es, arg.ready_lists, 0);
+  }
+      if (consume_local_repo) {
+         data_repo_entry_used_once( FCT2_repo, this_task->repo_entry->ht_item.key );
+      }
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_A.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_A.data_in);
+    }
+  }
+  PARSEC_PINS(es, RELEASE_DEPS_END, (parsec_task_t *)this_task);  return 0;
+}
+
+static int data_lookup_of_complex_deps_FCT2(parsec_execution_stream_t *es, __parsec_complex_deps_FCT2_task_t *this_task)
+{
+  const __parsec_complex_deps_internal_taskpool_t *__parsec_tp = (__parsec_complex_deps_internal_taskpool_t *)this_task->taskpool;
+  parsec_assignment_t generic_locals[MAX_PARAM_COUNT];  /* generic task locals */
+  int target_device = 0; (void)target_device;
+  (void)__parsec_tp; (void)generic_locals; (void)es;
+  parsec_data_copy_t *chunk = NULL;
+  data_repo_t        *reshape_repo  = NULL, *consumed_repo  = NULL;
+  data_repo_entry_t  *reshape_entry = NULL, *consumed_entry = NULL;
+  parsec_key_t        reshape_entry_key = 0, consumed_entry_key = 0;
+  uint8_t             consumed_flow_index;
+  parsec_dep_data_description_t data;
+  int ret;
+  (void)reshape_repo; (void)reshape_entry; (void)reshape_entry_key;
+  (void)consumed_repo; (void)consumed_entry; (void)consumed_entry_key;
+  (void)consumed_flow_index;
+  (void)chunk; (void)data; (void)ret;
+  const int i = this_task->locals.i.value; (void)i;
+  const int k = this_task->locals.k.value; (void)k;
+  const int j = this_task->locals.j.value; (void)j;
+  if( NULL == this_task->repo_entry ){
+    this_task->repo_entry = data_repo_lookup_entry_and_create(es, FCT2_repo,                                       __jdf2c_make_key_FCT2((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    data_repo_entry_addto_usage_limit(FCT2_repo, this_task->repo_entry->ht_item.key, 1);    this_task->repo_entry ->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(this_task->repo_entry ->sim_exec_date == 0);
+    this_task->repo_entry ->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  /* The reshape repo is the current task repo. */  reshape_repo = FCT2_repo;
+  reshape_entry_key = __jdf2c_make_key_FCT2((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals) ;
+  reshape_entry = this_task->repo_entry;
+  /* Lookup the input data, and store them in the context if any */
+
+if(! this_task->data._f_A.fulfill ){ /* Flow A */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_A.data_out = NULL;  /* By default, if nothing matches */
+  /* Flow A [0] dependency [0] from predecessor FCT1 */
+  if( NULL == (chunk = this_task->data._f_A.data_in) ) {
+  /* No data set up by predecessor on this task input flow */
+__parsec_complex_deps_FCT1_parsec_assignment_t *target_locals = (__parsec_complex_deps_FCT1_parsec_assignment_t*)&generic_locals;
+  const int FCT1i = target_locals->i.value = i; (void)FCT1i;
+  const int FCT1k = target_locals->k.value = k; (void)FCT1k;
+    if( (reshape_entry != NULL) && (reshape_entry->data[0] != NULL) ){
+        /* Reshape promise set up on this task repo by predecessor */
+        consumed_repo = reshape_repo;
+        consumed_entry = reshape_entry;
+        consumed_entry_key = reshape_entry_key;
+        consumed_flow_index = 0;
+    }else{
+        /* Consume from predecessor's repo */
+        consumed_repo = FCT1_repo;
+        consumed_entry_key = __jdf2c_make_key_FCT1((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)target_locals) ;
+        consumed_entry = data_repo_lookup_entry( consumed_repo, consumed_entry_key );
+        consumed_flow_index = 1;
+    }
+    data.data   = NULL;
+    data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+        data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    ACQUIRE_FLOW(this_task, "A", &complex_deps_FCT1, "B", target_locals, chunk);
+    this_task->data._f_A.data_out = chunk;
+  } 
+  else {
+    /* Data set up by predecessor on this task input flow */
+    consumed_repo = this_task->data._f_A.source_repo;
+    consumed_entry = this_task->data._f_A.source_repo_entry;
+    consumed_entry_key = this_task->data._f_A.source_repo_entry->ht_item.key;
+    if( (reshape_entry != NULL) && (reshape_entry->data[0] != NULL) ){
+        /* Reshape promise set up on input by predecessor is on this task repo */
+        consumed_flow_index = 0;
+        assert( (this_task->data._f_A.source_repo == reshape_repo)
+             && (this_task->data._f_A.source_repo_entry == reshape_entry));
+    }else{
+        /* Reshape promise set up on input by predecessor is the predecesssor task repo */
+        consumed_flow_index = 1;
+    }
+    data.data   = NULL;
+    data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+        data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    this_task->data._f_A.data_out = parsec_data_get_copy(chunk->original, target_device);
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+    parsec_prof_grapher_data_input(chunk->original, (parsec_task_t*)this_task, &flow_of_complex_deps_FCT2_for_A, 0);
+#endif
+  }
+    this_task->data._f_A.data_in     = chunk;
+    this_task->data._f_A.source_repo       = consumed_repo;
+    this_task->data._f_A.source_repo_entry = consumed_entry;
+    if( this_task->data._f_A.source_repo_entry == this_task->repo_entry ){
+      /* in case we have consume from this task repo entry for the flow,
+       * it is cleaned up, avoiding having old stuff during release_deps_of
+       */
+      this_task->repo_entry->data[0] = NULL;
+    }
+    this_task->data._f_A.fulfill = 1;
+}
+
+  /** Generate profiling information */
+#if defined(PARSEC_PROF_TRACE)
+  this_task->prof_info.desc = (parsec_data_collection_t*)__parsec_tp->super._g_descA;
+  this_task->prof_info.priority = this_task->priority;
+  this_task->prof_info.data_id   = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->data_key((parsec_data_collection_t*)__parsec_tp->super._g_descA, i, 0);
+  this_task->prof_info.task_class_id = this_task->task_class->task_class_id;
+  this_task->prof_info.task_return_code = -1;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int datatype_lookup_of_complex_deps_FCT2(parsec_execution_stream_t *es, const parsec_task_t *this_generic_task, const parsec_task_t *parent_task,
+              uint32_t* flow_mask, parsec_dep_data_description_t* data)
+{
+  const __parsec_complex_deps_FCT2_task_t *this_task = (__parsec_complex_deps_FCT2_task_t*)this_generic_task;
+  const __parsec_complex_deps_internal_taskpool_t *__parsec_tp = (__parsec_complex_deps_internal_taskpool_t *)this_task->taskpool;
+  (void)__parsec_tp; (void)es; (void)this_task; (void)data; (void)parent_task;
+  const int i = this_task->locals.i.value; (void)i;
+  const int k = this_task->locals.k.value; (void)k;
+  const int j = this_task->locals.j.value; (void)j;
+  data->local.arena = data->remote.arena = NULL;
+  data->local.src_datatype  = data->local.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->local.src_count     = data->local.dst_count = 0;
+  data->local.src_displ     = data->local.dst_displ = 0;
+  data->data_future  = NULL;
+  if( (*flow_mask) & 0x80000000U ) { /* these are the input dependencies remote datatypes  */
+if( (*flow_mask) & 0x1U ) {  /* Flow A */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_complex_deps_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_complex_deps_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_complex_deps_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+    goto no_mask_match;
+  }
+
+  /* these are the output dependencies remote datatypes */
+if( (*flow_mask) & 0x1U ) {  /* Flow A */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_complex_deps_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_complex_deps_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_complex_deps_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+ no_mask_match:
+  data->data                             = NULL;
+  data->remote.src_datatype = data->remote.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->remote.src_count    = data->remote.dst_count = 0;
+  data->remote.src_displ    = data->remote.dst_displ = 0;
+  data->data_future  = NULL;
+  (*flow_mask) = 0;  /* nothing left */
+  (void)i;  (void)k;  (void)j;
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+static int hook_of_complex_deps_FCT2(parsec_execution_stream_t *es, __parsec_complex_deps_FCT2_task_t *this_task)
+{
+  __parsec_complex_deps_internal_taskpool_t *__parsec_tp = (__parsec_complex_deps_internal_taskpool_t *)this_task->taskpool;
+  (void)es; (void)__parsec_tp;
+  const int i = this_task->locals.i.value; (void)i;
+  const int k = this_task->locals.k.value; (void)k;
+  const int j = this_task->locals.j.value; (void)j;
+  (void)i;  (void)k;  (void)j;
+
+  /** Declare the variables that will hold the data, and all the accounting for each */
+  parsec_data_copy_t *_f_A = this_task->data._f_A.data_in;
+  void *A = PARSEC_DATA_COPY_GET_PTR(_f_A); (void)A;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    data_repo_entry_t *eA = this_task->data._f_A.source_repo_entry;
+    if( (NULL != eA) && (eA->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eA->sim_exec_date;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+  /** Cache Awareness Accounting */
+#if defined(PARSEC_CACHE_AWARENESS)
+  cache_buf_referenced(es->closest_cache, A);
+#endif /* PARSEC_CACHE_AWARENESS */
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                                  FCT2 BODY                                    -----*/
+
+
+/*-----                                END OF FCT2 BODY                                -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#endif  /*  defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+static int complete_hook_of_complex_deps_FCT2(parsec_execution_stream_t *es, __parsec_complex_deps_FCT2_task_t *this_task)
+{
+  const __parsec_complex_deps_internal_taskpool_t *__parsec_tp = (__parsec_complex_deps_internal_taskpool_t *)this_task->taskpool;
+#if defined(DISTRIBUTED)
+    const int i = this_task->locals.i.value; (void)i;
+  const int k = this_task->locals.k.value; (void)k;
+  const int j = this_task->locals.j.value; (void)j;
+#endif  /* defined(DISTRIBUTED) */
+  (void)es; (void)__parsec_tp;
+parsec_data_t* data_t_desc = NULL; (void)data_t_desc;
+#if defined(DISTRIBUTED)
+  /** If not working on distributed, there is no risk that data is not in place */
+  (void)i;  (void)k;  (void)j;
+
+#endif /* DISTRIBUTED */
+#if defined(PARSEC_PROF_GRAPHER)
+  parsec_prof_grapher_task((parsec_task_t*)this_task, es->th_id, es->virtual_process->vp_id,
+     __jdf2c_key_fns_FCT2.key_hash(this_task->task_class->make_key( (parsec_taskpool_t*)this_task->taskpool, ((parsec_task_t*)this_task)->locals), NULL));
+#endif  /* defined(PARSEC_PROF_GRAPHER) */
+  release_deps_of_complex_deps_FCT2(es, this_task,
+      PARSEC_ACTION_RELEASE_REMOTE_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_REFS |
+      PARSEC_ACTION_RESHAPE_ON_RELEASE |
+      0x1,  /* mask of all dep_index */ 
+      NULL);
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static parsec_hook_return_t release_task_of_complex_deps_FCT2(parsec_execution_stream_t *es, parsec_task_t *this_task)
+{
+    const __parsec_complex_deps_internal_taskpool_t *__parsec_tp =
+        (const __parsec_complex_deps_internal_taskpool_t *)this_task->taskpool;
+    parsec_hash_table_t *ht = (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[1];
+    parsec_key_t key = this_task->task_class->make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals);
+    parsec_hashable_dependency_t *hash_dep = (parsec_hashable_dependency_t *)parsec_hash_table_remove(ht, key);
+    parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);
+    return parsec_release_task_to_mempool_update_nbtasks(es, this_task);
+}
+
+static char *complex_deps_complex_deps_FCT2_internal_init_deps_key_functions_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_complex_deps_internal_taskpool_t *__parsec_tp = (__parsec_complex_deps_internal_taskpool_t *)user_data;
+  int i = (__parsec_key) % __parsec_tp->FCT2_i_range + __parsec_tp->FCT2_i_min;
+  __parsec_key = __parsec_key / __parsec_tp->FCT2_i_range;
+  int k = (__parsec_key) % __parsec_tp->FCT2_k_range + __parsec_tp->FCT2_k_min;
+  __parsec_key = __parsec_key / __parsec_tp->FCT2_k_range;
+  int j = (__parsec_key) % __parsec_tp->FCT2_j_range + __parsec_tp->FCT2_j_min;
+  __parsec_key = __parsec_key / __parsec_tp->FCT2_j_range;
+  snprintf(buffer, buffer_size, "FCT2(%d, %d, %d)", i, k, j);
+  return buffer;
+}
+
+static parsec_key_fn_t complex_deps_complex_deps_FCT2_internal_init_deps_key_functions = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = complex_deps_complex_deps_FCT2_internal_init_deps_key_functions_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/* Needs: min-max count-tasks iterate */
+static int complex_deps_FCT2_internal_init(parsec_execution_stream_t * es, __parsec_complex_deps_FCT2_task_t * this_task)
+{
+  __parsec_complex_deps_internal_taskpool_t *__parsec_tp = (__parsec_complex_deps_internal_taskpool_t*)this_task->taskpool;
+  int32_t nb_tasks = 0, saved_nb_tasks = 0;
+int32_t __i_min = 0x7fffffff, __i_max = 0;int32_t __jdf2c_i_min = 0x7fffffff, __jdf2c_i_max = 0;int32_t __k_min = 0x7fffffff, __k_max = 0;int32_t __jdf2c_k_min = 0x7fffffff, __jdf2c_k_max = 0;int32_t __j_min = 0x7fffffff, __j_max = 0;int32_t __jdf2c_j_min = 0x7fffffff, __jdf2c_j_max = 0;  __parsec_complex_deps_FCT2_parsec_assignment_t assignments = {  .i.value = 0, .k.value = 0, .j.value = 0 };
+  int32_t  i,  k,  j;
+  int32_t __jdf2c_i_start, __jdf2c_i_end, __jdf2c_i_inc;
+  int32_t __jdf2c_k_start, __jdf2c_k_end, __jdf2c_k_inc;
+  int32_t __jdf2c_j_start, __jdf2c_j_end, __jdf2c_j_inc;
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+  PARSEC_PROFILING_TRACE(es->es_profile,
+                         this_task->taskpool->profiling_array[START_KEY(this_task->task_class->task_class_id)],
+                         0,
+                         this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    __jdf2c_i_start = 0;
+    __jdf2c_i_end = (NI - 1);
+    __jdf2c_i_inc = 1;
+    __i_min = parsec_imin(__jdf2c_i_start, __jdf2c_i_end);
+    __i_max = parsec_imax(__jdf2c_i_start, __jdf2c_i_end);
+    __jdf2c_i_min = parsec_imin(__jdf2c_i_min, __i_min);
+    __jdf2c_i_max = parsec_imax(__jdf2c_i_max, __i_max);
+    for(i =  __jdf2c_i_start;
+        i <= __jdf2c_i_end;
+        i += __jdf2c_i_inc) {
+    assignments.i.value = i;
+      __jdf2c_k_start = 0;
+      __jdf2c_k_end = (NK - 1);
+      __jdf2c_k_inc = 1;
+      __k_min = parsec_imin(__jdf2c_k_start, __jdf2c_k_end);
+      __k_max = parsec_imax(__jdf2c_k_start, __jdf2c_k_end);
+      __jdf2c_k_min = parsec_imin(__jdf2c_k_min, __k_min);
+      __jdf2c_k_max = parsec_imax(__jdf2c_k_max, __k_max);
+      for(k =  __jdf2c_k_start;
+          k <= __jdf2c_k_end;
+          k += __jdf2c_k_inc) {
+      assignments.k.value = k;
+        __jdf2c_j_start = k;
+        __jdf2c_j_end = NK;
+        __jdf2c_j_inc = 1;
+        __j_min = parsec_imin(__jdf2c_j_start, __jdf2c_j_end);
+        __j_max = parsec_imax(__jdf2c_j_start, __jdf2c_j_end);
+        __jdf2c_j_min = parsec_imin(__jdf2c_j_min, __j_min);
+        __jdf2c_j_max = parsec_imax(__jdf2c_j_max, __j_max);
+        for(j =  __jdf2c_j_start;
+            j <= __jdf2c_j_end;
+            j += __jdf2c_j_inc) {
+        assignments.j.value = j;
+        if( !FCT2_pred(i, k, j) ) continue;
+        nb_tasks++;
+      } /* Loop on normal range j */
+    } /* For loop of k */ 
+  } /* For loop of i */ 
+   if( 0 != nb_tasks ) {
+     (void)parsec_atomic_fetch_add_int32(&__parsec_tp->initial_number_tasks, nb_tasks);
+   }
+  /* Set the range variables for the collision-free hash-computation */
+  __parsec_tp->FCT2_i_min   = __jdf2c_i_min;
+  __parsec_tp->FCT2_i_range = (__jdf2c_i_max - __jdf2c_i_min) + 1;
+  __parsec_tp->FCT2_k_min   = __jdf2c_k_min;
+  __parsec_tp->FCT2_k_range = (__jdf2c_k_max - __jdf2c_k_min) + 1;
+  __parsec_tp->FCT2_j_min   = __jdf2c_j_min;
+  __parsec_tp->FCT2_j_range = (__jdf2c_j_max - __jdf2c_j_min) + 1;
+  this_task->status = PARSEC_TASK_STATUS_COMPLETE;
+
+  PARSEC_AYU_REGISTER_TASK(&complex_deps_FCT2);
+  __parsec_tp->super.super.dependencies_array[1] = PARSEC_OBJ_NEW(parsec_hash_table_t);
+  parsec_hash_table_init(__parsec_tp->super.super.dependencies_array[1], offsetof(parsec_hashable_dependency_t, ht_item), 10, complex_deps_complex_deps_FCT2_internal_init_deps_key_functions, this_task->taskpool);
+  __parsec_tp->repositories[1] = data_repo_create_nothreadsafe(nb_tasks, __jdf2c_key_fns_FCT2, (parsec_taskpool_t*)__parsec_tp, 1);
+(void)saved_nb_tasks;
+(void)__i_min; (void)__i_max;(void)__k_min; (void)__k_max;(void)__j_min; (void)__j_max;  (void)__jdf2c_i_start; (void)__jdf2c_i_end; (void)__jdf2c_i_inc;  (void)__jdf2c_k_start; (void)__jdf2c_k_end; (void)__jdf2c_k_inc;  (void)__jdf2c_j_start; (void)__jdf2c_j_end; (void)__jdf2c_j_inc;  (void)assignments; (void)__parsec_tp; (void)es;
+  if(1 == parsec_atomic_fetch_dec_int32(&__parsec_tp->sync_point)) {
+    /* Last initialization task complete. Update the number of tasks. */
+    __parsec_tp->super.super.tdm.module->taskpool_addto_nb_tasks(&__parsec_tp->super.super, __parsec_tp->initial_number_tasks);
+    parsec_mfence();  /* write memory barrier to guarantee that the scheduler gets the correct number of tasks */
+    parsec_taskpool_enable((parsec_taskpool_t*)__parsec_tp, &__parsec_tp->startup_queue,
+                           (parsec_task_t*)this_task, es, __parsec_tp->super.super.nb_pending_actions);
+    __parsec_tp->super.super.tdm.module->taskpool_ready(&__parsec_tp->super.super);
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+    PARSEC_PROFILING_TRACE(es->es_profile,
+                           this_task->taskpool->profiling_array[2 * this_task->task_class->task_class_id + 1],
+                           0,
+                           this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    return PARSEC_HOOK_RETURN_DONE;
+  }
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static const __parsec_chore_t __complex_deps_FCT2_chores[] ={
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+    { .type     = PARSEC_DEV_CPU,
+      .evaluate = (parsec_evaluate_function_t*)NULL,
+      .hook     = (parsec_hook_t*)hook_of_complex_deps_FCT2 },
+#endif  /* defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+    { .type     = PARSEC_DEV_NONE,
+      .evaluate = NULL,
+      .hook     = (parsec_hook_t*)NULL },  /* End marker */
+};
+
+static const parsec_task_class_t complex_deps_FCT2 = {
+  .name = "FCT2",
+  .task_class_id = 1,
+  .nb_flows = 1,
+  .nb_parameters = 3,
+  .nb_locals = 3,
+  .task_class_type = PARSEC_TASK_CLASS_TYPE_PTG,
+  .params = { &symb_complex_deps_FCT2_i, &symb_complex_deps_FCT2_k, &symb_complex_deps_FCT2_j, NULL },
+  .locals = { &symb_complex_deps_FCT2_i, &symb_complex_deps_FCT2_k, &symb_complex_deps_FCT2_j, NULL },
+  .data_affinity = (parsec_data_ref_fn_t*)affinity_of_complex_deps_FCT2,
+  .initial_data = (parsec_data_ref_fn_t*)affinity_of_complex_deps_FCT2,
+  .final_data = (parsec_data_ref_fn_t*)affinity_of_complex_deps_FCT2,
+  .priority = NULL,
+  .properties = properties_of_complex_deps_FCT2,
+#if MAX_PARAM_COUNT < 1  /* number of read flows of FCT2 */
+  #error Too many read flows for task FCT2
+#endif  /* MAX_PARAM_COUNT */
+#if MAX_PARAM_COUNT < 0  /* number of write flows of FCT2 */
+  #error Too many write flows for task FCT2
+#endif  /* MAX_PARAM_COUNT */
+  .in = { &flow_of_complex_deps_FCT2_for_A, NULL },
+  .out = { &flow_of_complex_deps_FCT2_for_A, NULL },
+  .flags = 0x0 | PARSEC_USE_DEPS_MASK,
+  .dependencies_goal = 0x1,
+  .make_key = __jdf2c_make_key_FCT2,
+  .task_snprintf = parsec_task_snprintf,
+#if defined(PARSEC_PROF_TRACE)
+  .profile_info = &parsec_task_profile_info,
+#endif
+  .key_functions = &__jdf2c_key_fns_FCT2,
+  .fini = (parsec_hook_t*)NULL,
+  .incarnations = __complex_deps_FCT2_chores,
+  .find_deps = parsec_hash_find_deps,
+  .update_deps = parsec_update_deps_with_mask,
+  .iterate_successors = (parsec_traverse_function_t*)iterate_successors_of_complex_deps_FCT2,
+  .iterate_predecessors = (parsec_traverse_function_t*)iterate_predecessors_of_complex_deps_FCT2,
+  .release_deps = (parsec_release_deps_t*)release_deps_of_complex_deps_FCT2,
+  .prepare_output = (parsec_hook_t*)NULL,
+  .prepare_input = (parsec_hook_t*)data_lookup_of_complex_deps_FCT2,
+  .time_estimate = NULL,
+  .get_datatype = datatype_lookup_of_complex_deps_FCT2,
+  .complete_execution = (parsec_hook_t*)complete_hook_of_complex_deps_FCT2,
+  .release_task = &release_task_of_complex_deps_FCT2,
+#if defined(PARSEC_SIM)
+  .sim_cost_fct = (parsec_sim_cost_fct_t*)NULL,
+#endif
+};
+
+
+/******                                      FCT1                                      ******/
+
+static inline int32_t minexpr_of_symb_complex_deps_FCT1_i_fct(const __parsec_complex_deps_internal_taskpool_t *__parsec_tp, const __parsec_complex_deps_FCT1_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_complex_deps_FCT1_i = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_complex_deps_FCT1_i_fct }
+                   }
+};
+static inline int maxexpr_of_symb_complex_deps_FCT1_i_fct(const __parsec_complex_deps_internal_taskpool_t *__parsec_tp, const __parsec_complex_deps_FCT1_parsec_assignment_t *locals)
+{
+  const int i = locals->i.value; (void)i;
+  const int k = locals->k.value; (void)k;
+
+  (void)i;
+  (void)k;
+  (void)__parsec_tp; (void)locals;
+  return (NI - 1);
+}
+static const parsec_expr_t maxexpr_of_symb_complex_deps_FCT1_i = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_complex_deps_FCT1_i_fct }
+                   }
+};
+static const parsec_symbol_t symb_complex_deps_FCT1_i = { .name = "i", .context_index = 0, .min = &minexpr_of_symb_complex_deps_FCT1_i, .max = &maxexpr_of_symb_complex_deps_FCT1_i, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int32_t minexpr_of_symb_complex_deps_FCT1_k_fct(const __parsec_complex_deps_internal_taskpool_t *__parsec_tp, const __parsec_complex_deps_FCT1_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_complex_deps_FCT1_k = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_complex_deps_FCT1_k_fct }
+                   }
+};
+static inline int maxexpr_of_symb_complex_deps_FCT1_k_fct(const __parsec_complex_deps_internal_taskpool_t *__parsec_tp, const __parsec_complex_deps_FCT1_parsec_assignment_t *locals)
+{
+  const int i = locals->i.value; (void)i;
+  const int k = locals->k.value; (void)k;
+
+  (void)i;
+  (void)k;
+  (void)__parsec_tp; (void)locals;
+  return (NK - 1);
+}
+static const parsec_expr_t maxexpr_of_symb_complex_deps_FCT1_k = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_complex_deps_FCT1_k_fct }
+                   }
+};
+static const parsec_symbol_t symb_complex_deps_FCT1_k = { .name = "k", .context_index = 1, .min = &minexpr_of_symb_complex_deps_FCT1_k, .max = &maxexpr_of_symb_complex_deps_FCT1_k, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int affinity_of_complex_deps_FCT1(const __parsec_complex_deps_FCT1_task_t *this_task,
+                     parsec_data_ref_t *ref)
+{
+    const __parsec_complex_deps_internal_taskpool_t *__parsec_tp = (const __parsec_complex_deps_internal_taskpool_t*)this_task->taskpool;
+  const int i = this_task->locals.i.value; (void)i;
+  const int k = this_task->locals.k.value; (void)k;
+
+  /* Silent Warnings: should look into predicate to know what variables are usefull */
+  (void)i;
+  (void)k;
+  ref->dc = (parsec_data_collection_t *)__parsec_tp->super._g_descA;
+  /* Compute data key */
+  ref->key = ref->dc->data_key(ref->dc, i, 0);
+  return 1;
+}
+static const parsec_property_t properties_of_complex_deps_FCT1[1] = {
+  {.name = NULL, .expr = NULL}
+};
+static inline int expr_of_cond_for_flow_of_complex_deps_FCT1_for_A_dep1_atline_31_iftrue_fct(const __parsec_complex_deps_internal_taskpool_t *__parsec_tp, const __parsec_complex_deps_FCT1_parsec_assignment_t *locals)
+{
+  const int i = locals->i.value; (void)i;
+  const int k = locals->k.value;
+
+  (void)i;
+  (void)k;
+  (void)__parsec_tp; (void)locals;
+  return (0) == (k);
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_complex_deps_FCT1_for_A_dep1_atline_31_iftrue = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_complex_deps_FCT1_for_A_dep1_atline_31_iftrue_fct }
+                   }
+};
+static parsec_data_t *flow_of_complex_deps_FCT1_for_A_dep1_atline_31_direct_access(const __parsec_complex_deps_internal_taskpool_t *__parsec_tp, const __parsec_complex_deps_FCT1_parsec_assignment_t *assignments)
+{
+  const int i = assignments->i.value; (void)i;
+  const int k = assignments->k.value; (void)k;
+
+  /* Silence Warnings: should look into parameters to know what variables are useful */
+  (void)i;
+  (void)k;
+  if( __parsec_tp->super.super.context->my_rank == (int32_t)rank_of_descA(i, 0) )
+    return data_of_descA(i, 0);
+  return NULL;
+}
+
+static const parsec_dep_t flow_of_complex_deps_FCT1_for_A_dep1_atline_31_iftrue = {
+  .cond = &expr_of_cond_for_flow_of_complex_deps_FCT1_for_A_dep1_atline_31_iftrue,  /* (0) == (k) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = PARSEC_LOCAL_DATA_TASK_CLASS_ID, /* complex_deps_descA */
+  .direct_data = (parsec_data_lookup_func_t)&flow_of_complex_deps_FCT1_for_A_dep1_atline_31_direct_access,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_complex_deps_FCT1_for_A,
+};
+static inline int expr_of_cond_for_flow_of_complex_deps_FCT1_for_A_dep1_atline_31_iffalse_fct(const __parsec_complex_deps_internal_taskpool_t *__parsec_tp, const __parsec_complex_deps_FCT1_parsec_assignment_t *locals)
+{
+  const int i = locals->i.value; (void)i;
+  const int k = locals->k.value;
+
+  (void)i;
+  (void)k;
+  (void)__parsec_tp; (void)locals;
+  return !((0) == (k));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_complex_deps_FCT1_for_A_dep1_atline_31_iffalse = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_complex_deps_FCT1_for_A_dep1_atline_31_iffalse_fct }
+                   }
+};
+static const parsec_dep_t flow_of_complex_deps_FCT1_for_A_dep1_atline_31_iffalse = {
+  .cond = &expr_of_cond_for_flow_of_complex_deps_FCT1_for_A_dep1_atline_31_iffalse,  /* !(0) == (k) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 0, /* complex_deps_FCT1 */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_complex_deps_FCT1_for_A,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_complex_deps_FCT1_for_A,
+};
+static inline int expr_of_cond_for_flow_of_complex_deps_FCT1_for_A_dep2_atline_32_fct(const __parsec_complex_deps_internal_taskpool_t *__parsec_tp, const __parsec_complex_deps_FCT1_parsec_assignment_t *locals)
+{
+  const int i = locals->i.value; (void)i;
+  const int k = locals->k.value; (void)k;
+
+  (void)i;
+  (void)k;
+  (void)__parsec_tp; (void)locals;
+  return (NK) != (k);
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_complex_deps_FCT1_for_A_dep2_atline_32 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_complex_deps_FCT1_for_A_dep2_atline_32_fct }
+                   }
+};
+static const parsec_dep_t flow_of_complex_deps_FCT1_for_A_dep2_atline_32 = {
+  .cond = &expr_of_cond_for_flow_of_complex_deps_FCT1_for_A_dep2_atline_32,  /* (NK) != (k) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 0, /* complex_deps_FCT1 */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_complex_deps_FCT1_for_A,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_complex_deps_FCT1_for_A,
+};
+static const parsec_dep_t flow_of_complex_deps_FCT1_for_A_dep3_atline_33 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 4, /* complex_deps_FCT5 */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_complex_deps_FCT5_for_A,
+  .dep_index = 1,
+  .dep_datatype_index = 1,
+  .belongs_to = &flow_of_complex_deps_FCT1_for_A,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+#if MAX_DEP_OUT_COUNT < 2  /* number of output dependencies */
+    #error Too many output dependencies (supports up to MAX_DEP_OUT_COUNT [=10] but found 2). Fix the code or recompile PaRSEC with a larger MAX_DEP_OUT_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_complex_deps_FCT1_for_A = {
+  .name               = "A",
+  .sym_type           = PARSEC_SYM_INOUT,
+  .flow_flags         = PARSEC_FLOW_ACCESS_READ|PARSEC_FLOW_HAS_IN_DEPS,
+  .flow_index         = 0,
+  .flow_datatype_mask = 0x3,
+  .dep_in     = { &flow_of_complex_deps_FCT1_for_A_dep1_atline_31_iftrue,
+ &flow_of_complex_deps_FCT1_for_A_dep1_atline_31_iffalse },
+  .dep_out    = { &flow_of_complex_deps_FCT1_for_A_dep2_atline_32,
+ &flow_of_complex_deps_FCT1_for_A_dep3_atline_33 }
+};
+
+static inline int expr_of_cond_for_flow_of_complex_deps_FCT1_for_B_dep1_atline_34_iftrue_fct(const __parsec_complex_deps_internal_taskpool_t *__parsec_tp, const __parsec_complex_deps_FCT1_parsec_assignment_t *locals)
+{
+  const int i = locals->i.value; (void)i;
+  const int k = locals->k.value;
+
+  (void)i;
+  (void)k;
+  (void)__parsec_tp; (void)locals;
+  return (0) == (k);
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_complex_deps_FCT1_for_B_dep1_atline_34_iftrue = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_complex_deps_FCT1_for_B_dep1_atline_34_iftrue_fct }
+                   }
+};
+static parsec_data_t *flow_of_complex_deps_FCT1_for_B_dep1_atline_34_direct_access(const __parsec_complex_deps_internal_taskpool_t *__parsec_tp, const __parsec_complex_deps_FCT1_parsec_assignment_t *assignments)
+{
+  const int i = assignments->i.value; (void)i;
+  const int k = assignments->k.value; (void)k;
+
+  /* Silence Warnings: should look into parameters to know what variables are useful */
+  (void)i;
+  (void)k;
+  if( __parsec_tp->super.super.context->my_rank == (int32_t)rank_of_descA(i, 0) )
+    return data_of_descA(i, 0);
+  return NULL;
+}
+
+static const parsec_dep_t flow_of_complex_deps_FCT1_for_B_dep1_atline_34_iftrue = {
+  .cond = &expr_of_cond_for_flow_of_complex_deps_FCT1_for_B_dep1_atline_34_iftrue,  /* (0) == (k) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = PARSEC_LOCAL_DATA_TASK_CLASS_ID, /* complex_deps_descA */
+  .direct_data = (parsec_data_lookup_func_t)&flow_of_complex_deps_FCT1_for_B_dep1_atline_34_direct_access,
+  .dep_index = 1,
+  .dep_datatype_index = 1,
+  .belongs_to = &flow_of_complex_deps_FCT1_for_B,
+};
+static inline int expr_of_cond_for_flow_of_complex_deps_FCT1_for_B_dep1_atline_34_iffalse_fct(const __parsec_complex_deps_internal_taskpool_t *__parsec_tp, const __parsec_complex_deps_FCT1_parsec_assignment_t *locals)
+{
+  const int i = locals->i.value; (void)i;
+  const int k = locals->k.value;
+
+  (void)i;
+  (void)k;
+  (void)__parsec_tp; (void)locals;
+  return !((0) == (k));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_complex_deps_FCT1_for_B_dep1_atline_34_iffalse = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_complex_deps_FCT1_for_B_dep1_atline_34_iffalse_fct }
+                   }
+};
+static const parsec_dep_t flow_of_complex_deps_FCT1_for_B_dep1_atline_34_iffalse = {
+  .cond = &expr_of_cond_for_flow_of_complex_deps_FCT1_for_B_dep1_atline_34_iffalse,  /* !(0) == (k) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 0, /* complex_deps_FCT1 */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_complex_deps_FCT1_for_B,
+  .dep_index = 1,
+  .dep_datatype_index = 1,
+  .belongs_to = &flow_of_complex_deps_FCT1_for_B,
+};
+static const parsec_dep_t flow_of_complex_deps_FCT1_for_B_dep2_atline_35 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 1, /* complex_deps_FCT2 */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_complex_deps_FCT2_for_A,
+  .dep_index = 2,
+  .dep_datatype_index = 2,
+  .belongs_to = &flow_of_complex_deps_FCT1_for_B,
+};
+static const parsec_dep_t flow_of_complex_deps_FCT1_for_B_dep3_atline_36 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 2, /* complex_deps_FCT3 */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_complex_deps_FCT3_for_A,
+  .dep_index = 3,
+  .dep_datatype_index = 3,
+  .belongs_to = &flow_of_complex_deps_FCT1_for_B,
+};
+static const parsec_dep_t flow_of_complex_deps_FCT1_for_B_dep4_atline_37 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 3, /* complex_deps_FCT4 */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_complex_deps_FCT4_for_A,
+  .dep_index = 4,
+  .dep_datatype_index = 2,
+  .belongs_to = &flow_of_complex_deps_FCT1_for_B,
+};
+static inline int expr_of_cond_for_flow_of_complex_deps_FCT1_for_B_dep5_atline_38_fct(const __parsec_complex_deps_internal_taskpool_t *__parsec_tp, const __parsec_complex_deps_FCT1_parsec_assignment_t *locals)
+{
+  const int i = locals->i.value; (void)i;
+  const int k = locals->k.value; (void)k;
+
+  (void)i;
+  (void)k;
+  (void)__parsec_tp; (void)locals;
+  return (NK) != (k);
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_complex_deps_FCT1_for_B_dep5_atline_38 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_complex_deps_FCT1_for_B_dep5_atline_38_fct }
+                   }
+};
+static const parsec_dep_t flow_of_complex_deps_FCT1_for_B_dep5_atline_38 = {
+  .cond = &expr_of_cond_for_flow_of_complex_deps_FCT1_for_B_dep5_atline_38,  /* (NK) != (k) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 0, /* complex_deps_FCT1 */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_complex_deps_FCT1_for_B,
+  .dep_index = 5,
+  .dep_datatype_index = 2,
+  .belongs_to = &flow_of_complex_deps_FCT1_for_B,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+#if MAX_DEP_OUT_COUNT < 4  /* number of output dependencies */
+    #error Too many output dependencies (supports up to MAX_DEP_OUT_COUNT [=10] but found 4). Fix the code or recompile PaRSEC with a larger MAX_DEP_OUT_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_complex_deps_FCT1_for_B = {
+  .name               = "B",
+  .sym_type           = PARSEC_SYM_INOUT,
+  .flow_flags         = PARSEC_FLOW_ACCESS_RW|PARSEC_FLOW_HAS_IN_DEPS,
+  .flow_index         = 1,
+  .flow_datatype_mask = 0xc,
+  .dep_in     = { &flow_of_complex_deps_FCT1_for_B_dep1_atline_34_iftrue,
+ &flow_of_complex_deps_FCT1_for_B_dep1_atline_34_iffalse },
+  .dep_out    = { &flow_of_complex_deps_FCT1_for_B_dep2_atline_35,
+ &flow_of_complex_deps_FCT1_for_B_dep3_atline_36,
+ &flow_of_complex_deps_FCT1_for_B_dep4_atline_37,
+ &flow_of_complex_deps_FCT1_for_B_dep5_atline_38 }
+};
+
+static void
+iterate_successors_of_complex_deps_FCT1(parsec_execution_stream_t *es, const __parsec_complex_deps_FCT1_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_complex_deps_internal_taskpool_t *__parsec_tp = (const __parsec_complex_deps_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_complex_deps_FCT1_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_complex_deps_FCT1_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int i = __jdf2c__tmp_locals.i.value; (void)i;
+  const int k = __jdf2c__tmp_locals.k.value; (void)k;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)i;  (void)k;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_descA(i, 0);
+#endif
+  if( action_mask & 0x3 ) {  /* Flow of data A [0] */
+    data.data   = this_task->data._f_A.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x1 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_complex_deps_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_complex_deps_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( (NK) != (k) ) {
+      __parsec_complex_deps_FCT1_task_t* ncc = (__parsec_complex_deps_FCT1_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[complex_deps_FCT1.task_class_id];
+        const int FCT1_i = i;
+        if( (FCT1_i >= (0)) && (FCT1_i <= ((NI - 1))) ) {
+          assert(&nc.locals[0].value == &ncc->locals.i.value);
+          ncc->locals.i.value = FCT1_i;
+          const int FCT1_k = (k + 1);
+          if( (FCT1_k >= (0)) && (FCT1_k <= ((NK - 1))) ) {
+            assert(&nc.locals[1].value == &ncc->locals.k.value);
+            ncc->locals.k.value = FCT1_k;
+#if defined(DISTRIBUTED)
+            rank_dst = rank_of_descA(ncc->locals.i.value, 0);
+            if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+              vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, ncc->locals.i.value, 0);
+            nc.priority = __parsec_tp->super.super.priority;
+            successor_repo = FCT1_repo;
+            successor_repo_key = __jdf2c_make_key_FCT1((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+          RELEASE_DEP_OUTPUT(es, "A", this_task, "A", &nc, rank_src, rank_dst, &data);
+          if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_complex_deps_FCT1_for_A_dep2_atline_32, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+            }
+          }
+    }
+  }
+  if( action_mask & 0x2 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_complex_deps_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_complex_deps_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = BLOCK;
+    data.remote.dst_displ    = BLOCK;
+  }
+        __parsec_complex_deps_FCT5_task_t* ncc = (__parsec_complex_deps_FCT5_task_t*)&nc;
+    nc.task_class = __parsec_tp->super.super.task_classes_array[complex_deps_FCT5.task_class_id];
+      const int FCT5_i = i;
+      if( (FCT5_i >= (0)) && (FCT5_i <= ((NI - 1))) ) {
+        assert(&nc.locals[0].value == &ncc->locals.i.value);
+        ncc->locals.i.value = FCT5_i;
+        const int FCT5_k = k;
+        if( (FCT5_k >= (0)) && (FCT5_k <= ((NK - 1))) ) {
+          assert(&nc.locals[1].value == &ncc->locals.k.value);
+          ncc->locals.k.value = FCT5_k;
+#if defined(DISTRIBUTED)
+          rank_dst = rank_of_descA(ncc->locals.i.value, 0);
+          if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+            vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, ncc->locals.i.value, 0);
+          nc.priority = __parsec_tp->super.super.priority;
+          successor_repo = FCT5_repo;
+          successor_repo_key = __jdf2c_make_key_FCT5((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+        RELEASE_DEP_OUTPUT(es, "A", this_task, "A", &nc, rank_src, rank_dst, &data);
+        if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_complex_deps_FCT1_for_A_dep3_atline_33, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+          }
+        }
+  }
+  }
+  if( action_mask & 0x3c ) {  /* Flow of data B [1] */
+    data.data   = this_task->data._f_B.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x4 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_complex_deps_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_complex_deps_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        __parsec_complex_deps_FCT2_task_t* ncc = (__parsec_complex_deps_FCT2_task_t*)&nc;
+    nc.task_class = __parsec_tp->super.super.task_classes_array[complex_deps_FCT2.task_class_id];
+      const int FCT2_i = i;
+      if( (FCT2_i >= (0)) && (FCT2_i <= ((NI - 1))) ) {
+        assert(&nc.locals[0].value == &ncc->locals.i.value);
+        ncc->locals.i.value = FCT2_i;
+        const int FCT2_k = k;
+        if( (FCT2_k >= (0)) && (FCT2_k <= ((NK - 1))) ) {
+          assert(&nc.locals[1].value == &ncc->locals.k.value);
+          ncc->locals.k.value = FCT2_k;
+          int FCT2_j;
+        for( FCT2_j = k;FCT2_j <= NK; FCT2_j+=1) {
+            if( (FCT2_j >= (ncc->locals.k.value)) && (FCT2_j <= (NK)) ) {
+              assert(&nc.locals[2].value == &ncc->locals.j.value);
+              ncc->locals.j.value = FCT2_j;
+#if defined(DISTRIBUTED)
+              rank_dst = rank_of_descA(ncc->locals.i.value, 0);
+              if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+                vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, ncc->locals.i.value, 0);
+              nc.priority = __parsec_tp->super.super.priority;
+              successor_repo = FCT2_repo;
+              successor_repo_key = __jdf2c_make_key_FCT2((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+            RELEASE_DEP_OUTPUT(es, "B", this_task, "A", &nc, rank_src, rank_dst, &data);
+            if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_complex_deps_FCT1_for_B_dep2_atline_35, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+              }
+            }
+          }
+        }
+  }
+  if( action_mask & 0x8 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_complex_deps_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_complex_deps_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = BLOCK;
+    data.remote.dst_displ    = BLOCK;
+  }
+        __parsec_complex_deps_FCT3_task_t* ncc = (__parsec_complex_deps_FCT3_task_t*)&nc;
+    nc.task_class = __parsec_tp->super.super.task_classes_array[complex_deps_FCT3.task_class_id];
+      const int FCT3_i = i;
+      if( (FCT3_i >= (0)) && (FCT3_i <= ((NI - 1))) ) {
+        assert(&nc.locals[0].value == &ncc->locals.i.value);
+        ncc->locals.i.value = FCT3_i;
+        const int FCT3_k = k;
+        if( (FCT3_k >= (0)) && (FCT3_k <= ((NK - 1))) ) {
+          assert(&nc.locals[1].value == &ncc->locals.k.value);
+          ncc->locals.k.value = FCT3_k;
+          int FCT3_j;
+        for( FCT3_j = k;FCT3_j <= NK; FCT3_j+=1) {
+            if( (FCT3_j >= (ncc->locals.k.value)) && (FCT3_j <= (NK)) ) {
+              assert(&nc.locals[2].value == &ncc->locals.j.value);
+              ncc->locals.j.value = FCT3_j;
+#if defined(DISTRIBUTED)
+              rank_dst = rank_of_descA(ncc->locals.i.value, 0);
+              if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+                vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, ncc->locals.i.value, 0);
+              nc.priority = __parsec_tp->super.super.priority;
+              successor_repo = FCT3_repo;
+              successor_repo_key = __jdf2c_make_key_FCT3((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+            RELEASE_DEP_OUTPUT(es, "B", this_task, "A", &nc, rank_src, rank_dst, &data);
+            if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_complex_deps_FCT1_for_B_dep3_atline_36, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+              }
+            }
+          }
+        }
+  }
+  if( action_mask & 0x10 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_complex_deps_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_complex_deps_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        __parsec_complex_deps_FCT4_task_t* ncc = (__parsec_complex_deps_FCT4_task_t*)&nc;
+    nc.task_class = __parsec_tp->super.super.task_classes_array[complex_deps_FCT4.task_class_id];
+      const int FCT4_i = i;
+      if( (FCT4_i >= (0)) && (FCT4_i <= ((NI - 1))) ) {
+        assert(&nc.locals[0].value == &ncc->locals.i.value);
+        ncc->locals.i.value = FCT4_i;
+        const int FCT4_k = k;
+        if( (FCT4_k >= (0)) && (FCT4_k <= ((NK - 1))) ) {
+          assert(&nc.locals[1].value == &ncc->locals.k.value);
+          ncc->locals.k.value = FCT4_k;
+#if defined(DISTRIBUTED)
+          rank_dst = rank_of_descA(ncc->locals.i.value, 0);
+          if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+            vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, ncc->locals.i.value, 0);
+          nc.priority = __parsec_tp->super.super.priority;
+          successor_repo = FCT4_repo;
+          successor_repo_key = __jdf2c_make_key_FCT4((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+        RELEASE_DEP_OUTPUT(es, "B", this_task, "A", &nc, rank_src, rank_dst, &data);
+        if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_complex_deps_FCT1_for_B_dep4_atline_37, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+          }
+        }
+  }
+  if( action_mask & 0x20 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_complex_deps_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_complex_deps_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( (NK) != (k) ) {
+      __parsec_complex_deps_FCT1_task_t* ncc = (__parsec_complex_deps_FCT1_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[complex_deps_FCT1.task_class_id];
+        const int FCT1_i = i;
+        if( (FCT1_i >= (0)) && (FCT1_i <= ((NI - 1))) ) {
+          assert(&nc.locals[0].value == &ncc->locals.i.value);
+          ncc->locals.i.value = FCT1_i;
+          const int FCT1_k = (k + 1);
+          if( (FCT1_k >= (0)) && (FCT1_k <= ((NK - 1))) ) {
+            assert(&nc.locals[1].value == &ncc->locals.k.value);
+            ncc->locals.k.value = FCT1_k;
+#if defined(DISTRIBUTED)
+            rank_dst = rank_of_descA(ncc->locals.i.value, 0);
+            if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+              vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, ncc->locals.i.value, 0);
+            nc.priority = __parsec_tp->super.super.priority;
+            successor_repo = FCT1_repo;
+            successor_repo_key = __jdf2c_make_key_FCT1((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+          RELEASE_DEP_OUTPUT(es, "B", this_task, "B", &nc, rank_src, rank_dst, &data);
+          if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_complex_deps_FCT1_for_B_dep5_atline_38, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+            }
+          }
+    }
+  }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static void
+iterate_predecessors_of_complex_deps_FCT1(parsec_execution_stream_t *es, const __parsec_complex_deps_FCT1_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_complex_deps_internal_taskpool_t *__parsec_tp = (const __parsec_complex_deps_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_complex_deps_FCT1_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_complex_deps_FCT1_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int i = __jdf2c__tmp_locals.i.value; (void)i;
+  const int k = __jdf2c__tmp_locals.k.value; (void)k;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)i;  (void)k;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_descA(i, 0);
+#endif
+  if( action_mask & 0x1 ) {  /* Flow of data A [0] */
+    data.data   = this_task->data._f_A.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x1 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_complex_deps_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_complex_deps_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( !((0) == (k)) ) {
+      __parsec_complex_deps_FCT1_task_t* ncc = (__parsec_complex_deps_FCT1_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[complex_deps_FCT1.task_class_id];
+        const int FCT1_i = i;
+        if( (FCT1_i >= (0)) && (FCT1_i <= ((NI - 1))) ) {
+          assert(&nc.locals[0].value == &ncc->locals.i.value);
+          ncc->locals.i.value = FCT1_i;
+          const int FCT1_k = (k - 1);
+          if( (FCT1_k >= (0)) && (FCT1_k <= ((NK - 1))) ) {
+            assert(&nc.locals[1].value == &ncc->locals.k.value);
+            ncc->locals.k.value = FCT1_k;
+#if defined(DISTRIBUTED)
+            rank_dst = rank_of_descA(ncc->locals.i.value, 0);
+            if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+              vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, ncc->locals.i.value, 0);
+            nc.priority = __parsec_tp->super.super.priority;
+            successor_repo = FCT1_repo;
+            successor_repo_key = __jdf2c_make_key_FCT1((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+          RELEASE_DEP_OUTPUT(es, "A", this_task, "A", &nc, rank_src, rank_dst, &data);
+          if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_complex_deps_FCT1_for_A_dep1_atline_31_iffalse, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+            }
+          }
+    }
+  }
+  }
+  if( action_mask & 0x2 ) {  /* Flow of data B [1] */
+    data.data   = this_task->data._f_B.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x2 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_complex_deps_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_complex_deps_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( !((0) == (k)) ) {
+      __parsec_complex_deps_FCT1_task_t* ncc = (__parsec_complex_deps_FCT1_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[complex_deps_FCT1.task_class_id];
+        const int FCT1_i = i;
+        if( (FCT1_i >= (0)) && (FCT1_i <= ((NI - 1))) ) {
+          assert(&nc.locals[0].value == &ncc->locals.i.value);
+          ncc->locals.i.value = FCT1_i;
+          const int FCT1_k = (k - 1);
+          if( (FCT1_k >= (0)) && (FCT1_k <= ((NK - 1))) ) {
+            assert(&nc.locals[1].value == &ncc->locals.k.value);
+            ncc->locals.k.value = FCT1_k;
+#if defined(DISTRIBUTED)
+            rank_dst = rank_of_descA(ncc->locals.i.value, 0);
+            if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+              vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, ncc->locals.i.value, 0);
+            nc.priority = __parsec_tp->super.super.priority;
+            successor_repo = FCT1_repo;
+            successor_repo_key = __jdf2c_make_key_FCT1((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+          RELEASE_DEP_OUTPUT(es, "B", this_task, "B", &nc, rank_src, rank_dst, &data);
+          if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_complex_deps_FCT1_for_B_dep1_atline_34_iffalse, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+            }
+          }
+    }
+  }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static int release_deps_of_complex_deps_FCT1(parsec_execution_stream_t *es, __parsec_complex_deps_FCT1_task_t *this_task, uint32_t action_mask, parsec_remote_deps_t *deps)
+{
+  PARSEC_PINS(es, RELEASE_DEPS_BEGIN, (parsec_task_t *)this_task);  const __parsec_complex_deps_internal_taskpool_t *__parsec_tp = (const __parsec_complex_deps_internal_taskpool_t *)this_task->taskpool;
+  parsec_release_dep_fct_arg_t arg;
+  int __vp_id;
+  int consume_local_repo = 0;
+  arg.action_mask = action_mask;
+  arg.output_entry = NULL;
+  arg.output_repo = NULL;
+#if defined(DISTRIBUTED)
+  arg.remote_deps = deps;
+#endif  /* defined(DISTRIBUTED) */
+  assert(NULL != es);
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS )    arg.ready_lists = alloca(sizeof(parsec_task_t *) * es->virtual_process->parsec_context->nb_vp);
+  else
+    arg.ready_lists = NULL;
+  for( __vp_id = 0; __vp_id < es->virtual_process->parsec_context->nb_vp; arg.ready_lists[__vp_id++] = NULL );
+  (void)__parsec_tp; (void)deps;
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_A.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_A.source_repo, this_task->data._f_A.source_repo_entry->ht_item.key );
+    }
+    if( NULL != this_task->data._f_B.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_B.source_repo, this_task->data._f_B.source_repo_entry->ht_item.key );
+    }
+  }
+  consume_local_repo = (this_task->repo_entry != NULL);
+  arg.output_repo = FCT1_repo;
+  arg.output_entry = this_task->repo_entry;
+  arg.output_usage = 0;
+  if( action_mask & (PARSEC_ACTION_RELEASE_LOCAL_DEPS | PARSEC_ACTION_GET_REPO_ENTRY) ) {
+    arg.output_entry = data_repo_lookup_entry_and_create( es, arg.output_repo, __jdf2c_make_key_FCT1((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    arg.output_entry->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(arg.output_entry->sim_exec_date == 0);
+    arg.output_entry->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  if(action_mask & ( PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE ) ){
+    /* Generate the reshape promise for the outputs that need it */
+    iterate_successors_of_complex_deps_FCT1(es, this_task, action_mask, parsec_set_up_reshape_promise, &arg);
+   }
+  iterate_successors_of_complex_deps_FCT1(es, this_task, action_mask, parsec_release_dep_fct, &arg);
+
+#if defined(DISTRIBUTED)
+  if( (action_mask & PARSEC_ACTION_SEND_REMOTE_DEPS) && (NULL != arg.remote_deps)) {
+    parsec_remote_dep_activate(es, (parsec_task_t *)this_task, arg.remote_deps, arg.remote_deps->outgoing_mask);
+  }
+#endif
+
+  if(action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS) {
+    data_repo_entry_addto_usage_limit(FCT1_repo, arg.output_entry->ht_item.key, arg.output_usage);
+    __parsec_schedule_vp(es, arg.ready_lists, 0);
+  }
+      if (consume_local_repo) {
+         data_repo_entry_used_once( FCT1_repo, this_task->repo_entry->ht_item.key );
+      }
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_A.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_A.data_in);
+    }
+    if( NULL != this_task->data._f_B.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_B.data_in);
+    }
+  }
+  PARSEC_PINS(es, RELEASE_DEPS_END, (parsec_task_t *)this_task);  return 0;
+}
+
+static int data_lookup_of_complex_deps_FCT1(parsec_execution_stream_t *es, __parsec_complex_deps_FCT1_task_t *this_task)
+{
+  const __parsec_complex_deps_internal_taskpool_t *__parsec_tp = (__parsec_complex_deps_internal_taskpool_t *)this_task->taskpool;
+  parsec_assignment_t generic_locals[MAX_PARAM_COUNT];  /* generic task locals */
+  int target_device = 0; (void)target_device;
+  (void)__parsec_tp; (void)generic_locals; (void)es;
+  parsec_data_copy_t *chunk = NULL;
+  data_repo_t        *reshape_repo  = NULL, *consumed_repo  = NULL;
+  data_repo_entry_t  *reshape_entry = NULL, *consumed_entry = NULL;
+  parsec_key_t        reshape_entry_key = 0, consumed_entry_key = 0;
+  uint8_t             consumed_flow_index;
+  parsec_dep_data_description_t data;
+  int ret;
+  (void)reshape_repo; (void)reshape_entry; (void)reshape_entry_key;
+  (void)consumed_repo; (void)consumed_entry; (void)consumed_entry_key;
+  (void)consumed_flow_index;
+  (void)chunk; (void)data; (void)ret;
+  const int i = this_task->locals.i.value; (void)i;
+  const int k = this_task->locals.k.value; (void)k;
+  if( NULL == this_task->repo_entry ){
+    this_task->repo_entry = data_repo_lookup_entry_and_create(es, FCT1_repo,                                       __jdf2c_make_key_FCT1((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    data_repo_entry_addto_usage_limit(FCT1_repo, this_task->repo_entry->ht_item.key, 1);    this_task->repo_entry ->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(this_task->repo_entry ->sim_exec_date == 0);
+    this_task->repo_entry ->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  /* The reshape repo is the current task repo. */  reshape_repo = FCT1_repo;
+  reshape_entry_key = __jdf2c_make_key_FCT1((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals) ;
+  reshape_entry = this_task->repo_entry;
+  /* Lookup the input data, and store them in the context if any */
+
+if(! this_task->data._f_A.fulfill ){ /* Flow A */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_A.data_out = NULL;  /* By default, if nothing matches */
+    if( (0) == (k) ) {
+    /* Flow A [0] dependency [0] from memory descA */
+    if( NULL == (chunk = this_task->data._f_A.data_in) ) {
+    /* No data set up by predecessor on this task input flow */
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+    parsec_prof_grapher_data_input(data_of_descA(i, 0), (parsec_task_t*)this_task, &flow_of_complex_deps_FCT1_for_A, 1);
+#endif
+      chunk = parsec_data_get_copy(data_of_descA(i, 0), target_device);
+      data.data = chunk;
+      data.data_future  = NULL;
+          data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      data.data_future   = NULL;
+      if( (ret = parsec_get_copy_reshape_from_desc(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      this_task->data._f_A.data_out = chunk;
+      PARSEC_OBJ_RETAIN(chunk);
+    } 
+    } else {
+    /* Flow A [0] dependency [0] from predecessor FCT1 */
+    if( NULL == (chunk = this_task->data._f_A.data_in) ) {
+    /* No data set up by predecessor on this task input flow */
+__parsec_complex_deps_FCT1_parsec_assignment_t *target_locals = (__parsec_complex_deps_FCT1_parsec_assignment_t*)&generic_locals;
+      const int FCT1i = target_locals->i.value = i; (void)FCT1i;
+      const int FCT1k = target_locals->k.value = (k - 1); (void)FCT1k;
+      if( (reshape_entry != NULL) && (reshape_entry->data[0] != NULL) ){
+          /* Reshape promise set up on this task repo by predecessor */
+          consumed_repo = reshape_repo;
+          consumed_entry = reshape_entry;
+          consumed_entry_key = reshape_entry_key;
+          consumed_flow_index = 0;
+      }else{
+          /* Consume from predecessor's repo */
+          consumed_repo = FCT1_repo;
+          consumed_entry_key = __jdf2c_make_key_FCT1((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)target_locals) ;
+          consumed_entry = data_repo_lookup_entry( consumed_repo, consumed_entry_key );
+          consumed_flow_index = 0;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      ACQUIRE_FLOW(this_task, "A", &complex_deps_FCT1, "A", target_locals, chunk);
+      this_task->data._f_A.data_out = chunk;
+    } 
+    else {
+      /* Data set up by predecessor on this task input flow */
+      consumed_repo = this_task->data._f_A.source_repo;
+      consumed_entry = this_task->data._f_A.source_repo_entry;
+      consumed_entry_key = this_task->data._f_A.source_repo_entry->ht_item.key;
+      if( (reshape_entry != NULL) && (reshape_entry->data[0] != NULL) ){
+          /* Reshape promise set up on input by predecessor is on this task repo */
+          consumed_flow_index = 0;
+          assert( (this_task->data._f_A.source_repo == reshape_repo)
+               && (this_task->data._f_A.source_repo_entry == reshape_entry));
+      }else{
+          /* Reshape promise set up on input by predecessor is the predecesssor task repo */
+          consumed_flow_index = 0;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      this_task->data._f_A.data_out = parsec_data_get_copy(chunk->original, target_device);
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+      parsec_prof_grapher_data_input(chunk->original, (parsec_task_t*)this_task, &flow_of_complex_deps_FCT1_for_A, 0);
+#endif
+    }
+    }
+    this_task->data._f_A.data_in     = chunk;
+    this_task->data._f_A.source_repo       = consumed_repo;
+    this_task->data._f_A.source_repo_entry = consumed_entry;
+    if( this_task->data._f_A.source_repo_entry == this_task->repo_entry ){
+      /* in case we have consume from this task repo entry for the flow,
+       * it is cleaned up, avoiding having old stuff during release_deps_of
+       */
+      this_task->repo_entry->data[0] = NULL;
+    }
+    this_task->data._f_A.fulfill = 1;
+}
+
+
+if(! this_task->data._f_B.fulfill ){ /* Flow B */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_B.data_out = NULL;  /* By default, if nothing matches */
+    if( (0) == (k) ) {
+    /* Flow B [1] dependency [1] from memory descA */
+    if( NULL == (chunk = this_task->data._f_B.data_in) ) {
+    /* No data set up by predecessor on this task input flow */
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+    parsec_prof_grapher_data_input(data_of_descA(i, 0), (parsec_task_t*)this_task, &flow_of_complex_deps_FCT1_for_B, 1);
+#endif
+      chunk = parsec_data_get_copy(data_of_descA(i, 0), target_device);
+      data.data = chunk;
+      data.data_future  = NULL;
+          data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      data.data_future   = NULL;
+      if( (ret = parsec_get_copy_reshape_from_desc(es, this_task->taskpool, (parsec_task_t *)this_task, 1, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      this_task->data._f_B.data_out = chunk;
+      PARSEC_OBJ_RETAIN(chunk);
+    } 
+    } else {
+    /* Flow B [1] dependency [1] from predecessor FCT1 */
+    if( NULL == (chunk = this_task->data._f_B.data_in) ) {
+    /* No data set up by predecessor on this task input flow */
+__parsec_complex_deps_FCT1_parsec_assignment_t *target_locals = (__parsec_complex_deps_FCT1_parsec_assignment_t*)&generic_locals;
+      const int FCT1i = target_locals->i.value = i; (void)FCT1i;
+      const int FCT1k = target_locals->k.value = (k - 1); (void)FCT1k;
+      if( (reshape_entry != NULL) && (reshape_entry->data[1] != NULL) ){
+          /* Reshape promise set up on this task repo by predecessor */
+          consumed_repo = reshape_repo;
+          consumed_entry = reshape_entry;
+          consumed_entry_key = reshape_entry_key;
+          consumed_flow_index = 1;
+      }else{
+          /* Consume from predecessor's repo */
+          consumed_repo = FCT1_repo;
+          consumed_entry_key = __jdf2c_make_key_FCT1((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)target_locals) ;
+          consumed_entry = data_repo_lookup_entry( consumed_repo, consumed_entry_key );
+          consumed_flow_index = 1;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 1, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      ACQUIRE_FLOW(this_task, "B", &complex_deps_FCT1, "B", target_locals, chunk);
+      this_task->data._f_B.data_out = chunk;
+    } 
+    else {
+      /* Data set up by predecessor on this task input flow */
+      consumed_repo = this_task->data._f_B.source_repo;
+      consumed_entry = this_task->data._f_B.source_repo_entry;
+      consumed_entry_key = this_task->data._f_B.source_repo_entry->ht_item.key;
+      if( (reshape_entry != NULL) && (reshape_entry->data[1] != NULL) ){
+          /* Reshape promise set up on input by predecessor is on this task repo */
+          consumed_flow_index = 1;
+          assert( (this_task->data._f_B.source_repo == reshape_repo)
+               && (this_task->data._f_B.source_repo_entry == reshape_entry));
+      }else{
+          /* Reshape promise set up on input by predecessor is the predecesssor task repo */
+          consumed_flow_index = 1;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 1, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      this_task->data._f_B.data_out = parsec_data_get_copy(chunk->original, target_device);
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+      parsec_prof_grapher_data_input(chunk->original, (parsec_task_t*)this_task, &flow_of_complex_deps_FCT1_for_B, 0);
+#endif
+    }
+    }
+    this_task->data._f_B.data_in     = chunk;
+    this_task->data._f_B.source_repo       = consumed_repo;
+    this_task->data._f_B.source_repo_entry = consumed_entry;
+    if( this_task->data._f_B.source_repo_entry == this_task->repo_entry ){
+      /* in case we have consume from this task repo entry for the flow,
+       * it is cleaned up, avoiding having old stuff during release_deps_of
+       */
+      this_task->repo_entry->data[1] = NULL;
+    }
+    this_task->data._f_B.fulfill = 1;
+}
+
+  /** Generate profiling information */
+#if defined(PARSEC_PROF_TRACE)
+  this_task->prof_info.desc = (parsec_data_collection_t*)__parsec_tp->super._g_descA;
+  this_task->prof_info.priority = this_task->priority;
+  this_task->prof_info.data_id   = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->data_key((parsec_data_collection_t*)__parsec_tp->super._g_descA, i, 0);
+  this_task->prof_info.task_class_id = this_task->task_class->task_class_id;
+  this_task->prof_info.task_return_code = -1;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int datatype_lookup_of_complex_deps_FCT1(parsec_execution_stream_t *es, const parsec_task_t *this_generic_task, const parsec_task_t *parent_task,
+              uint32_t* flow_mask, parsec_dep_data_description_t* data)
+{
+  const __parsec_complex_deps_FCT1_task_t *this_task = (__parsec_complex_deps_FCT1_task_t*)this_generic_task;
+  const __parsec_complex_deps_internal_taskpool_t *__parsec_tp = (__parsec_complex_deps_internal_taskpool_t *)this_task->taskpool;
+  (void)__parsec_tp; (void)es; (void)this_task; (void)data; (void)parent_task;
+  const int i = this_task->locals.i.value; (void)i;
+  const int k = this_task->locals.k.value; (void)k;
+  data->local.arena = data->remote.arena = NULL;
+  data->local.src_datatype  = data->local.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->local.src_count     = data->local.dst_count = 0;
+  data->local.src_displ     = data->local.dst_displ = 0;
+  data->data_future  = NULL;
+  if( (*flow_mask) & 0x80000000U ) { /* these are the input dependencies remote datatypes  */
+if( (*flow_mask) & 0x1U ) {  /* Flow A */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_complex_deps_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_complex_deps_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_complex_deps_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+if( (*flow_mask) & 0x2U ) {  /* Flow B */
+    if( ((*flow_mask) & 0x2U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_complex_deps_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_complex_deps_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_complex_deps_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x2U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x2U) */
+    goto no_mask_match;
+  }
+
+  /* these are the output dependencies remote datatypes */
+if( (*flow_mask) & 0x3U ) {  /* Flow A */
+    if( ((*flow_mask) & 0x1U)
+ && ((NK) != (k)) ) {
+    data->remote.arena  =  PARSEC_complex_deps_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_complex_deps_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_complex_deps_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+    if( ((*flow_mask) & 0x2U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_complex_deps_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_complex_deps_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_complex_deps_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = BLOCK;
+    data->remote.dst_displ    = BLOCK;
+      (*flow_mask) &= ~0x2U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x3U) */
+if( (*flow_mask) & 0x3cU ) {  /* Flow B */
+    if( ((*flow_mask) & 0x4U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_complex_deps_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_complex_deps_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_complex_deps_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x4U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+    if( ((*flow_mask) & 0x8U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_complex_deps_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_complex_deps_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_complex_deps_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = BLOCK;
+    data->remote.dst_displ    = BLOCK;
+      (*flow_mask) &= ~0x8U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+    if( ((*flow_mask) & 0x30U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_complex_deps_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_complex_deps_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_complex_deps_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x30U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x3cU) */
+ no_mask_match:
+  data->data                             = NULL;
+  data->remote.src_datatype = data->remote.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->remote.src_count    = data->remote.dst_count = 0;
+  data->remote.src_displ    = data->remote.dst_displ = 0;
+  data->data_future  = NULL;
+  (*flow_mask) = 0;  /* nothing left */
+  (void)i;  (void)k;
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+static int hook_of_complex_deps_FCT1(parsec_execution_stream_t *es, __parsec_complex_deps_FCT1_task_t *this_task)
+{
+  __parsec_complex_deps_internal_taskpool_t *__parsec_tp = (__parsec_complex_deps_internal_taskpool_t *)this_task->taskpool;
+  (void)es; (void)__parsec_tp;
+  const int i = this_task->locals.i.value; (void)i;
+  const int k = this_task->locals.k.value; (void)k;
+  (void)i;  (void)k;
+
+  /** Declare the variables that will hold the data, and all the accounting for each */
+  parsec_data_copy_t *_f_A = this_task->data._f_A.data_in;
+  void *A = PARSEC_DATA_COPY_GET_PTR(_f_A); (void)A;
+  parsec_data_copy_t *_f_B = this_task->data._f_B.data_in;
+  void *B = PARSEC_DATA_COPY_GET_PTR(_f_B); (void)B;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    data_repo_entry_t *eA = this_task->data._f_A.source_repo_entry;
+    if( (NULL != eA) && (eA->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eA->sim_exec_date;
+    data_repo_entry_t *eB = this_task->data._f_B.source_repo_entry;
+    if( (NULL != eB) && (eB->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eB->sim_exec_date;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+    if ( NULL != _f_B ) {
+#if defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) || defined(PARSEC_HAVE_DEV_HIP_SUPPORT)
+      parsec_data_transfer_ownership_to_copy( _f_B->original, 0 /* device */,
+                                           PARSEC_FLOW_ACCESS_RW);
+#endif  /* defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) || defined(PARSEC_HAVE_DEV_HIP_SUPPORT) */
+      _f_B->version++;  /* B */
+#if defined(PARSEC_DEBUG_NOISIER)
+      char tmp[128];
+      PARSEC_DEBUG_VERBOSE(10, parsec_debug_output,
+                           "Body of %s: change Data copy %p to version %d",
+                           parsec_task_snprintf(tmp, 128, (parsec_task_t*)(this_task)),
+                           _f_B, _f_B->version);
+#endif /* defined(PARSEC_DEBUG_NOISIER) */
+    }
+  /** Cache Awareness Accounting */
+#if defined(PARSEC_CACHE_AWARENESS)
+  cache_buf_referenced(es->closest_cache, A);
+  cache_buf_referenced(es->closest_cache, B);
+#endif /* PARSEC_CACHE_AWARENESS */
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                                  FCT1 BODY                                    -----*/
+
+
+/*-----                                END OF FCT1 BODY                                -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#endif  /*  defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+static int complete_hook_of_complex_deps_FCT1(parsec_execution_stream_t *es, __parsec_complex_deps_FCT1_task_t *this_task)
+{
+  const __parsec_complex_deps_internal_taskpool_t *__parsec_tp = (__parsec_complex_deps_internal_taskpool_t *)this_task->taskpool;
+#if defined(DISTRIBUTED)
+    const int i = this_task->locals.i.value; (void)i;
+  const int k = this_task->locals.k.value; (void)k;
+#endif  /* defined(DISTRIBUTED) */
+  (void)es; (void)__parsec_tp;
+parsec_data_t* data_t_desc = NULL; (void)data_t_desc;
+#if defined(DISTRIBUTED)
+  /** If not working on distributed, there is no risk that data is not in place */
+  (void)i;  (void)k;
+
+#endif /* DISTRIBUTED */
+#if defined(PARSEC_PROF_GRAPHER)
+  parsec_prof_grapher_task((parsec_task_t*)this_task, es->th_id, es->virtual_process->vp_id,
+     __jdf2c_key_fns_FCT1.key_hash(this_task->task_class->make_key( (parsec_taskpool_t*)this_task->taskpool, ((parsec_task_t*)this_task)->locals), NULL));
+#endif  /* defined(PARSEC_PROF_GRAPHER) */
+  release_deps_of_complex_deps_FCT1(es, this_task,
+      PARSEC_ACTION_RELEASE_REMOTE_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_REFS |
+      PARSEC_ACTION_RESHAPE_ON_RELEASE |
+      0x3f,  /* mask of all dep_index */ 
+      NULL);
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static parsec_hook_return_t release_task_of_complex_deps_FCT1(parsec_execution_stream_t *es, parsec_task_t *this_task)
+{
+    const __parsec_complex_deps_internal_taskpool_t *__parsec_tp =
+        (const __parsec_complex_deps_internal_taskpool_t *)this_task->taskpool;
+    parsec_hash_table_t *ht = (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[0];
+    parsec_key_t key = this_task->task_class->make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals);
+    parsec_hashable_dependency_t *hash_dep = (parsec_hashable_dependency_t *)parsec_hash_table_remove(ht, key);
+    parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);
+    return parsec_release_task_to_mempool_update_nbtasks(es, this_task);
+}
+
+static char *complex_deps_complex_deps_FCT1_internal_init_deps_key_functions_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_complex_deps_internal_taskpool_t *__parsec_tp = (__parsec_complex_deps_internal_taskpool_t *)user_data;
+  int i = (__parsec_key) % __parsec_tp->FCT1_i_range + __parsec_tp->FCT1_i_min;
+  __parsec_key = __parsec_key / __parsec_tp->FCT1_i_range;
+  int k = (__parsec_key) % __parsec_tp->FCT1_k_range + __parsec_tp->FCT1_k_min;
+  __parsec_key = __parsec_key / __parsec_tp->FCT1_k_range;
+  snprintf(buffer, buffer_size, "FCT1(%d, %d)", i, k);
+  return buffer;
+}
+
+static parsec_key_fn_t complex_deps_complex_deps_FCT1_internal_init_deps_key_functions = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = complex_deps_complex_deps_FCT1_internal_init_deps_key_functions_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/* Needs: min-max count-tasks iterate */
+static int complex_deps_FCT1_internal_init(parsec_execution_stream_t * es, __parsec_complex_deps_FCT1_task_t * this_task)
+{
+  __parsec_complex_deps_internal_taskpool_t *__parsec_tp = (__parsec_complex_deps_internal_taskpool_t*)this_task->taskpool;
+  int32_t nb_tasks = 0, saved_nb_tasks = 0;
+int32_t __i_min = 0x7fffffff, __i_max = 0;int32_t __jdf2c_i_min = 0x7fffffff, __jdf2c_i_max = 0;int32_t __k_min = 0x7fffffff, __k_max = 0;int32_t __jdf2c_k_min = 0x7fffffff, __jdf2c_k_max = 0;  __parsec_complex_deps_FCT1_parsec_assignment_t assignments = {  .i.value = 0, .k.value = 0 };
+  int32_t  i,  k;
+  int32_t __jdf2c_i_start, __jdf2c_i_end, __jdf2c_i_inc;
+  int32_t __jdf2c_k_start, __jdf2c_k_end, __jdf2c_k_inc;
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+  PARSEC_PROFILING_TRACE(es->es_profile,
+                         this_task->taskpool->profiling_array[START_KEY(this_task->task_class->task_class_id)],
+                         0,
+                         this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    __jdf2c_i_start = 0;
+    __jdf2c_i_end = (NI - 1);
+    __jdf2c_i_inc = 1;
+    __i_min = parsec_imin(__jdf2c_i_start, __jdf2c_i_end);
+    __i_max = parsec_imax(__jdf2c_i_start, __jdf2c_i_end);
+    __jdf2c_i_min = parsec_imin(__jdf2c_i_min, __i_min);
+    __jdf2c_i_max = parsec_imax(__jdf2c_i_max, __i_max);
+    for(i =  __jdf2c_i_start;
+        i <= __jdf2c_i_end;
+        i += __jdf2c_i_inc) {
+    assignments.i.value = i;
+      __jdf2c_k_start = 0;
+      __jdf2c_k_end = (NK - 1);
+      __jdf2c_k_inc = 1;
+      __k_min = parsec_imin(__jdf2c_k_start, __jdf2c_k_end);
+      __k_max = parsec_imax(__jdf2c_k_start, __jdf2c_k_end);
+      __jdf2c_k_min = parsec_imin(__jdf2c_k_min, __k_min);
+      __jdf2c_k_max = parsec_imax(__jdf2c_k_max, __k_max);
+      for(k =  __jdf2c_k_start;
+          k <= __jdf2c_k_end;
+          k += __jdf2c_k_inc) {
+      assignments.k.value = k;
+      if( !FCT1_pred(i, k) ) continue;
+      nb_tasks++;
+    } /* Loop on normal range k */
+  } /* For loop of i */ 
+   if( 0 != nb_tasks ) {
+     (void)parsec_atomic_fetch_add_int32(&__parsec_tp->initial_number_tasks, nb_tasks);
+   }
+  /* Set the range variables for the collision-free hash-computation */
+  __parsec_tp->FCT1_i_min   = __jdf2c_i_min;
+  __parsec_tp->FCT1_i_range = (__jdf2c_i_max - __jdf2c_i_min) + 1;
+  __parsec_tp->FCT1_k_min   = __jdf2c_k_min;
+  __parsec_tp->FCT1_k_range = (__jdf2c_k_max - __jdf2c_k_min) + 1;
+    do {
+      this_task->super.list_next = (parsec_list_item_t*)__parsec_tp->startup_queue;
+    } while(!parsec_atomic_cas_ptr(&__parsec_tp->startup_queue, (parsec_list_item_t*)this_task->super.list_next, this_task));
+    this_task->status = PARSEC_TASK_STATUS_HOOK;
+
+  PARSEC_AYU_REGISTER_TASK(&complex_deps_FCT1);
+  __parsec_tp->super.super.dependencies_array[0] = PARSEC_OBJ_NEW(parsec_hash_table_t);
+  parsec_hash_table_init(__parsec_tp->super.super.dependencies_array[0], offsetof(parsec_hashable_dependency_t, ht_item), 10, complex_deps_complex_deps_FCT1_internal_init_deps_key_functions, this_task->taskpool);
+  __parsec_tp->repositories[0] = data_repo_create_nothreadsafe(nb_tasks, __jdf2c_key_fns_FCT1, (parsec_taskpool_t*)__parsec_tp, 2);
+(void)saved_nb_tasks;
+(void)__i_min; (void)__i_max;(void)__k_min; (void)__k_max;  (void)__jdf2c_i_start; (void)__jdf2c_i_end; (void)__jdf2c_i_inc;  (void)__jdf2c_k_start; (void)__jdf2c_k_end; (void)__jdf2c_k_inc;  (void)assignments; (void)__parsec_tp; (void)es;
+  if(1 == parsec_atomic_fetch_dec_int32(&__parsec_tp->sync_point)) {
+    /* Last initialization task complete. Update the number of tasks. */
+    __parsec_tp->super.super.tdm.module->taskpool_addto_nb_tasks(&__parsec_tp->super.super, __parsec_tp->initial_number_tasks);
+    parsec_mfence();  /* write memory barrier to guarantee that the scheduler gets the correct number of tasks */
+    parsec_taskpool_enable((parsec_taskpool_t*)__parsec_tp, &__parsec_tp->startup_queue,
+                           (parsec_task_t*)this_task, es, __parsec_tp->super.super.nb_pending_actions);
+    __parsec_tp->super.super.tdm.module->taskpool_ready(&__parsec_tp->super.super);
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+    PARSEC_PROFILING_TRACE(es->es_profile,
+                           this_task->taskpool->profiling_array[2 * this_task->task_class->task_class_id + 1],
+                           0,
+                           this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    if( 1 >= __parsec_tp->super.super.nb_pending_actions ) {
+        /* if no tasks will be generated let's prevent the runtime from calling the hook and instead go directly to complete the task */
+        this_task->status = PARSEC_TASK_STATUS_COMPLETE;
+    }
+    return PARSEC_HOOK_RETURN_DONE;
+  }
+  return PARSEC_HOOK_RETURN_ASYNC;
+}
+
+static int __jdf2c_startup_FCT1(parsec_execution_stream_t * es, __parsec_complex_deps_FCT1_task_t *this_task)
+{
+  __parsec_complex_deps_FCT1_task_t* new_task;
+  __parsec_complex_deps_internal_taskpool_t* __parsec_tp = (__parsec_complex_deps_internal_taskpool_t*)this_task->taskpool;
+  parsec_context_t *context = __parsec_tp->super.super.context;
+  int vpid = 0, nb_tasks = 0;
+  size_t total_nb_tasks = 0;
+  parsec_list_item_t* pready_ring[context->nb_vp];
+  int restore_context = 0;
+  int i = this_task->locals.i.value;  /* retrieve value saved during the last iteration */
+  int k = this_task->locals.k.value;  /* retrieve value saved during the last iteration */
+  for(int _i = 0; _i < context->nb_vp; pready_ring[_i++] = NULL );
+  if( 0 != this_task->locals.reserved[0].value ) {
+    this_task->locals.reserved[0].value = 1; /* reset the submission process */
+    restore_context = 1;
+    goto restore_context_0;
+  }
+  this_task->locals.reserved[0].value = 1; /* a sane default value */
+  for(this_task->locals.i.value = i = 0;
+      this_task->locals.i.value <= (NI - 1);
+      this_task->locals.i.value += 1, i = this_task->locals.i.value) {
+    for(this_task->locals.k.value = k = 0;
+        this_task->locals.k.value <= (NK - 1);
+        this_task->locals.k.value += 1, k = this_task->locals.k.value) {
+      if( !FCT1_pred(i, k) ) continue;
+  __parsec_complex_deps_FCT1_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_complex_deps_FCT1_parsec_assignment_t*)&this_task->locals;
+  (void)__jdf2c__tmp_locals;
+  if( (0) == (k) ) goto B_check_flow;
+  continue; /* All other cases are not startup tasks */
+ B_check_flow:
+  if( (0) == (k) ) goto __jdf2c_done_check_flow;
+  continue; /* All other cases are not startup tasks */
+ __jdf2c_done_check_flow:
+      if( NULL != ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of ) {
+        vpid = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, i, 0);
+        assert(context->nb_vp >= vpid);
+      } else {
+        vpid = (vpid + 1) % context->nb_vp;  /* spread the initial joy */
+      }
+      new_task = (__parsec_complex_deps_FCT1_task_t*)parsec_thread_mempool_allocate( context->virtual_processes[vpid]->execution_streams[0]->context_mempool );
+      PARSEC_OBJ_CONSTRUCT(new_task, parsec_task_t); /* construct called only when new, force-construct it again */
+      /* Copy only the valid elements from this_task to new_task one */
+      new_task->taskpool   = this_task->taskpool;
+      new_task->task_class = __parsec_tp->super.super.task_classes_array[complex_deps_FCT1.task_class_id];
+      new_task->chore_mask   = PARSEC_DEV_ALL;
+      new_task->locals.i.value = this_task->locals.i.value;
+      new_task->locals.k.value = this_task->locals.k.value;
+      PARSEC_LIST_ITEM_SINGLETON(new_task);
+      new_task->priority = __parsec_tp->super.super.priority;
+      new_task->repo_entry = NULL;
+      new_task->data._f_A.source_repo_entry = NULL;
+      new_task->data._f_A.source_repo       = NULL;
+      new_task->data._f_A.data_in         = NULL;
+      new_task->data._f_A.data_out        = NULL;
+      new_task->data._f_A.fulfill         = 0;
+      new_task->data._f_B.source_repo_entry = NULL;
+      new_task->data._f_B.source_repo       = NULL;
+      new_task->data._f_B.data_in         = NULL;
+      new_task->data._f_B.data_out        = NULL;
+      new_task->data._f_B.fulfill         = 0;
+#if defined(PARSEC_DEBUG_NOISIER)
+      {
+        char tmp[128];
+        PARSEC_DEBUG_VERBOSE(10, parsec_debug_output, "Add startup task %s to vpid %d",
+               parsec_task_snprintf(tmp, 128, (parsec_task_t*)new_task), vpid);
+      }
+#endif
+      parsec_dependencies_mark_task_as_startup((parsec_task_t*)new_task, es);
+      pready_ring[vpid] = parsec_list_item_ring_push_sorted(pready_ring[vpid],
+                                                            (parsec_list_item_t*)new_task,
+                                                            parsec_execution_context_priority_comparator);
+      nb_tasks++;
+     restore_context_0:  /* we jump here just so that we have code after the label */
+      restore_context = 0;
+      (void)restore_context;
+      if( nb_tasks > this_task->locals.reserved[0].value ) {
+        if( (size_t)this_task->locals.reserved[0].value < parsec_task_startup_iter ) this_task->locals.reserved[0].value <<= 1;
+        __parsec_schedule_vp(es, (parsec_task_t**)pready_ring, 0);
+        total_nb_tasks += nb_tasks;
+        nb_tasks = 0;
+        if( total_nb_tasks > parsec_task_startup_chunk ) {  /* stop here and request to be rescheduled */
+          return PARSEC_HOOK_RETURN_AGAIN;
+        }
+      }
+    } /* Loop on normal range k */
+  } /* Loop on normal range i */
+  (void)vpid;
+  if( 0 != nb_tasks ) {
+    __parsec_schedule_vp(es, (parsec_task_t**)pready_ring, 0);
+    nb_tasks = 0;
+  }
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static const __parsec_chore_t __complex_deps_FCT1_chores[] ={
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+    { .type     = PARSEC_DEV_CPU,
+      .evaluate = (parsec_evaluate_function_t*)NULL,
+      .hook     = (parsec_hook_t*)hook_of_complex_deps_FCT1 },
+#endif  /* defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+    { .type     = PARSEC_DEV_NONE,
+      .evaluate = NULL,
+      .hook     = (parsec_hook_t*)NULL },  /* End marker */
+};
+
+static const parsec_task_class_t complex_deps_FCT1 = {
+  .name = "FCT1",
+  .task_class_id = 0,
+  .nb_flows = 2,
+  .nb_parameters = 2,
+  .nb_locals = 2,
+  .task_class_type = PARSEC_TASK_CLASS_TYPE_PTG,
+  .params = { &symb_complex_deps_FCT1_i, &symb_complex_deps_FCT1_k, NULL },
+  .locals = { &symb_complex_deps_FCT1_i, &symb_complex_deps_FCT1_k, NULL },
+  .data_affinity = (parsec_data_ref_fn_t*)affinity_of_complex_deps_FCT1,
+  .initial_data = (parsec_data_ref_fn_t*)affinity_of_complex_deps_FCT1,
+  .final_data = (parsec_data_ref_fn_t*)affinity_of_complex_deps_FCT1,
+  .priority = NULL,
+  .properties = properties_of_complex_deps_FCT1,
+#if MAX_PARAM_COUNT < 2  /* number of read flows of FCT1 */
+  #error Too many read flows for task FCT1
+#endif  /* MAX_PARAM_COUNT */
+#if MAX_PARAM_COUNT < 1  /* number of write flows of FCT1 */
+  #error Too many write flows for task FCT1
+#endif  /* MAX_PARAM_COUNT */
+  .in = { &flow_of_complex_deps_FCT1_for_A, &flow_of_complex_deps_FCT1_for_B, NULL },
+  .out = { &flow_of_complex_deps_FCT1_for_A, &flow_of_complex_deps_FCT1_for_B, NULL },
+  .flags = 0x0 | PARSEC_HAS_IN_IN_DEPENDENCIES | PARSEC_USE_DEPS_MASK,
+  .dependencies_goal = 0x3,
+  .make_key = __jdf2c_make_key_FCT1,
+  .task_snprintf = parsec_task_snprintf,
+#if defined(PARSEC_PROF_TRACE)
+  .profile_info = &parsec_task_profile_info,
+#endif
+  .key_functions = &__jdf2c_key_fns_FCT1,
+  .fini = (parsec_hook_t*)NULL,
+  .incarnations = __complex_deps_FCT1_chores,
+  .find_deps = parsec_hash_find_deps,
+  .update_deps = parsec_update_deps_with_mask,
+  .iterate_successors = (parsec_traverse_function_t*)iterate_successors_of_complex_deps_FCT1,
+  .iterate_predecessors = (parsec_traverse_function_t*)iterate_predecessors_of_complex_deps_FCT1,
+  .release_deps = (parsec_release_deps_t*)release_deps_of_complex_deps_FCT1,
+  .prepare_output = (parsec_hook_t*)NULL,
+  .prepare_input = (parsec_hook_t*)data_lookup_of_complex_deps_FCT1,
+  .time_estimate = NULL,
+  .get_datatype = datatype_lookup_of_complex_deps_FCT1,
+  .complete_execution = (parsec_hook_t*)complete_hook_of_complex_deps_FCT1,
+  .release_task = &release_task_of_complex_deps_FCT1,
+#if defined(PARSEC_SIM)
+  .sim_cost_fct = (parsec_sim_cost_fct_t*)NULL,
+#endif
+};
+
+
+static const parsec_task_class_t *complex_deps_task_classes[] = {
+  &complex_deps_FCT1,
+  &complex_deps_FCT2,
+  &complex_deps_FCT3,
+  &complex_deps_FCT4,
+  &complex_deps_FCT5
+};
+
+static void complex_deps_startup(parsec_context_t *context, __parsec_complex_deps_internal_taskpool_t *__parsec_tp, parsec_list_item_t ** ready_tasks)
+{
+  uint32_t i, supported_dev = 0;
+ 
+  for( i = 0; i < parsec_nb_devices; i++ ) {
+    if( !(__parsec_tp->super.super.devices_index_mask & (1<<i)) ) continue;
+    parsec_device_module_t* device = parsec_mca_device_get(i);
+    parsec_data_collection_t* parsec_dc;
+ 
+    if(NULL == device) continue;
+    if(NULL != device->taskpool_register)
+      if( PARSEC_SUCCESS != device->taskpool_register(device, (parsec_taskpool_t*)__parsec_tp) ) {
+        parsec_debug_verbose(5, parsec_debug_output, "Device %s refused to register taskpool %p", device->name, __parsec_tp);
+        __parsec_tp->super.super.devices_index_mask &= ~(1 << device->device_index);
+        continue;
+      }
+    if(NULL != device->memory_register) {  /* Register all the data */
+      parsec_dc = (parsec_data_collection_t*)__parsec_tp->super._g_descA;
+      if( (NULL != parsec_dc->register_memory) &&
+          (PARSEC_SUCCESS != parsec_dc->register_memory(parsec_dc, device)) ) {
+        parsec_debug_verbose(3, parsec_debug_output, "Device %s refused to register memory for data %s (%p) from taskpool %p",
+                     device->name, parsec_dc->key_base, parsec_dc, __parsec_tp);
+        __parsec_tp->super.super.devices_index_mask &= ~(1 << device->device_index);
+      }
+    }
+    supported_dev |= device->type;
+  }
+  /* Remove all the chores without a backend device */
+  for( i = 0; i < PARSEC_complex_deps_NB_TASK_CLASSES; i++ ) {
+    parsec_task_class_t* tc = (parsec_task_class_t*)__parsec_tp->super.super.task_classes_array[i];
+    __parsec_chore_t* chores = (__parsec_chore_t*)tc->incarnations;
+    uint32_t idx = 0, j;
+    for( j = 0; PARSEC_DEV_NONE != chores[j].type; j++ ) {
+      if( !(supported_dev & chores[j].type) ) continue;
+      if( j != idx ) {
+        chores[idx] = chores[j];
+        parsec_debug_verbose(20, parsec_debug_output, "Device type %i disabled for function %s"
+, chores[j].type, tc->name);
+      }
+      idx++;
+    }
+    chores[idx].type     = PARSEC_DEV_NONE;
+    chores[idx].evaluate = NULL;
+    chores[idx].hook     = NULL;
+    /* Create the initialization tasks for each taskclass */
+    parsec_task_t* task = (parsec_task_t*)parsec_thread_mempool_allocate(context->virtual_processes[0]->execution_streams[0]->context_mempool);
+    PARSEC_OBJ_CONSTRUCT(task, parsec_task_t); /* construct called only when new, force-construct it again */
+    task->taskpool = (parsec_taskpool_t *)__parsec_tp;
+    task->chore_mask = PARSEC_DEV_CPU;
+    memset(&task->locals, 0, sizeof(parsec_assignment_t) * MAX_LOCAL_COUNT);
+    PARSEC_LIST_ITEM_SINGLETON(task);
+    task->priority = -1;
+    task->task_class = task->taskpool->task_classes_array[PARSEC_complex_deps_NB_TASK_CLASSES + i];
+    int where = i % context->nb_vp;
+    if( NULL == ready_tasks[where] ) ready_tasks[where] = &task->super;
+    else ready_tasks[where] = parsec_list_item_ring_push(ready_tasks[where], &task->super);
+  }
+}
+static void __parsec_complex_deps_internal_destructor( __parsec_complex_deps_internal_taskpool_t *__parsec_tp )
+{
+  uint32_t i;
+  parsec_taskpool_unregister( &__parsec_tp->super.super );
+  if(NULL != __parsec_tp->super.super.tdm.module) __parsec_tp->super.super.tdm.module->unmonitor_taskpool(&__parsec_tp->super.super);
+  for( i = 0; i < (uint32_t)(2 * __parsec_tp->super.super.nb_task_classes); i++ ) {  /* Extra startup function added at the end */
+    parsec_task_class_t* tc = (parsec_task_class_t*)__parsec_tp->super.super.task_classes_array[i];
+    free((void*)tc->incarnations);
+    free(tc);
+  }
+  free(__parsec_tp->super.super.task_classes_array); __parsec_tp->super.super.task_classes_array = NULL;
+  __parsec_tp->super.super.nb_task_classes = 0;
+
+  for(i = 0; i < (uint32_t)__parsec_tp->super.arenas_datatypes_size; i++) {
+    if( NULL != __parsec_tp->super.arenas_datatypes[i].arena ) {
+      PARSEC_OBJ_RELEASE(__parsec_tp->super.arenas_datatypes[i].arena);
+    }
+  }
+  /* Destroy the data repositories for this object */
+   data_repo_destroy_nothreadsafe(__parsec_tp->repositories[4]);  /* FCT5 */
+   data_repo_destroy_nothreadsafe(__parsec_tp->repositories[3]);  /* FCT4 */
+   data_repo_destroy_nothreadsafe(__parsec_tp->repositories[2]);  /* FCT3 */
+   data_repo_destroy_nothreadsafe(__parsec_tp->repositories[1]);  /* FCT2 */
+   data_repo_destroy_nothreadsafe(__parsec_tp->repositories[0]);  /* FCT1 */
+  /* Release the dependencies arrays for this object */
+  parsec_hash_table_fini( (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[4] );
+  PARSEC_OBJ_RELEASE(__parsec_tp->super.super.dependencies_array[4]);
+  __parsec_tp->super.super.dependencies_array[4] = NULL;
+  parsec_hash_table_fini( (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[3] );
+  PARSEC_OBJ_RELEASE(__parsec_tp->super.super.dependencies_array[3]);
+  __parsec_tp->super.super.dependencies_array[3] = NULL;
+  parsec_hash_table_fini( (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[2] );
+  PARSEC_OBJ_RELEASE(__parsec_tp->super.super.dependencies_array[2]);
+  __parsec_tp->super.super.dependencies_array[2] = NULL;
+  parsec_hash_table_fini( (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[1] );
+  PARSEC_OBJ_RELEASE(__parsec_tp->super.super.dependencies_array[1]);
+  __parsec_tp->super.super.dependencies_array[1] = NULL;
+  parsec_hash_table_fini( (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[0] );
+  PARSEC_OBJ_RELEASE(__parsec_tp->super.super.dependencies_array[0]);
+  __parsec_tp->super.super.dependencies_array[0] = NULL;
+  free( __parsec_tp->super.super.dependencies_array );
+  __parsec_tp->super.super.dependencies_array = NULL;
+  /* Unregister all the data */
+  uint32_t _i;
+  for( _i = 0; _i < parsec_nb_devices; _i++ ) {
+    parsec_device_module_t* device;
+    parsec_data_collection_t* parsec_dc;
+    if(!(__parsec_tp->super.super.devices_index_mask & (1 << _i))) continue;
+    if((NULL == (device = parsec_mca_device_get(_i))) || (NULL == device->memory_unregister)) continue;
+    parsec_dc = (parsec_data_collection_t*)__parsec_tp->super._g_descA;
+  if( NULL != parsec_dc->unregister_memory ) { (void)parsec_dc->unregister_memory(parsec_dc, device); };
+}
+  /* Unregister the taskpool from the devices */
+  for( i = 0; i < parsec_nb_devices; i++ ) {
+    if(!(__parsec_tp->super.super.devices_index_mask & (1 << i))) continue;
+    __parsec_tp->super.super.devices_index_mask ^= (1 << i);
+    parsec_device_module_t* device = parsec_mca_device_get(i);
+    if((NULL == device) || (NULL == device->taskpool_unregister)) continue;
+    if( PARSEC_SUCCESS != device->taskpool_unregister(device, &__parsec_tp->super.super) ) continue;
+  }
+  free(__parsec_tp->super.super.taskpool_name); __parsec_tp->super.super.taskpool_name = NULL;
+}
+
+void __parsec_complex_deps_internal_constructor(__parsec_complex_deps_internal_taskpool_t* __parsec_tp)
+{
+  parsec_task_class_t* tc;
+  uint32_t i, j;
+
+  __parsec_tp->super.super.nb_task_classes = PARSEC_complex_deps_NB_TASK_CLASSES;
+  __parsec_tp->super.super.devices_index_mask = PARSEC_DEVICES_ALL;
+  __parsec_tp->super.super.taskpool_name = strdup("complex_deps");
+  parsec_termdet_open_module(&__parsec_tp->super.super, "local");
+  __parsec_tp->super.super.tdm.module->monitor_taskpool(&__parsec_tp->super.super,
+                                                        parsec_taskpool_termination_detected);
+  __parsec_tp->super.super.update_nb_runtime_task = parsec_add_fetch_runtime_task;
+  __parsec_tp->super.super.dependencies_array = (void **)
+              calloc(__parsec_tp->super.super.nb_task_classes, sizeof(void*));
+  /* Twice the size to hold the startup tasks function_t */
+  __parsec_tp->super.super.task_classes_array = (const parsec_task_class_t**)
+              calloc((2 * PARSEC_complex_deps_NB_TASK_CLASSES + 1), sizeof(parsec_task_class_t*));
+  __parsec_tp->super.super.tdm.module->taskpool_addto_runtime_actions(&__parsec_tp->super.super, PARSEC_complex_deps_NB_TASK_CLASSES);  /* for the startup tasks */
+  __parsec_tp->super.super.taskpool_type = PARSEC_TASKPOOL_TYPE_PTG;
+  __parsec_tp->sync_point = __parsec_tp->super.super.nb_task_classes;
+  __parsec_tp->initial_number_tasks = 0;
+  __parsec_tp->startup_queue = NULL;
+  for( i = 0; i < __parsec_tp->super.super.nb_task_classes; i++ ) {
+    __parsec_tp->super.super.task_classes_array[i] = tc = malloc(sizeof(parsec_task_class_t));
+    memcpy(tc, complex_deps_task_classes[i], sizeof(parsec_task_class_t));
+    for( j = 0; PARSEC_DEV_NONE != tc->incarnations[j].type; j++);  /* compute the number of incarnations */
+    tc->incarnations = (__parsec_chore_t*)malloc((j+1) * sizeof(__parsec_chore_t));
+        memcpy((__parsec_chore_t*)tc->incarnations, complex_deps_task_classes[i]->incarnations, (j+1) * sizeof(__parsec_chore_t));
+
+    /* Add a placeholder for initialization and startup task */
+    __parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+i] = tc = (parsec_task_class_t*)malloc(sizeof(parsec_task_class_t));
+    memcpy(tc, (void*)&__parsec_generic_startup, sizeof(parsec_task_class_t));
+    tc->task_class_id = __parsec_tp->super.super.nb_task_classes + i;
+    tc->incarnations = (__parsec_chore_t*)malloc(2 * sizeof(__parsec_chore_t));
+    memcpy((__parsec_chore_t*)tc->incarnations, (void*)__parsec_generic_startup.incarnations, 2 * sizeof(__parsec_chore_t));
+    tc->release_task = parsec_release_task_to_mempool_and_count_as_runtime_tasks;
+  }
+  /* Startup task for FCT5 */
+  tc = (parsec_task_class_t *)__parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+0];
+  tc->name = "Startup for FCT5";
+  tc->prepare_input = (parsec_hook_t*)complex_deps_FCT5_internal_init;
+  /* Startup task for FCT4 */
+  tc = (parsec_task_class_t *)__parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+1];
+  tc->name = "Startup for FCT4";
+  tc->prepare_input = (parsec_hook_t*)complex_deps_FCT4_internal_init;
+  /* Startup task for FCT3 */
+  tc = (parsec_task_class_t *)__parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+2];
+  tc->name = "Startup for FCT3";
+  tc->prepare_input = (parsec_hook_t*)complex_deps_FCT3_internal_init;
+  /* Startup task for FCT2 */
+  tc = (parsec_task_class_t *)__parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+3];
+  tc->name = "Startup for FCT2";
+  tc->prepare_input = (parsec_hook_t*)complex_deps_FCT2_internal_init;
+  /* Startup task for FCT1 */
+  tc = (parsec_task_class_t *)__parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+4];
+  tc->name = "Startup for FCT1";
+  tc->prepare_input = (parsec_hook_t*)complex_deps_FCT1_internal_init;
+  ((__parsec_chore_t*)&tc->incarnations[0])->hook = (parsec_hook_t *)__jdf2c_startup_FCT1;
+  /* Compute the number of arenas_datatypes: */
+  /*   PARSEC_complex_deps_DEFAULT_ARENA  ->  0 */
+  __parsec_tp->super.arenas_datatypes_size = 1;
+  memset(&__parsec_tp->super.arenas_datatypes[0], 0, __parsec_tp->super.arenas_datatypes_size*sizeof(parsec_arena_datatype_t));
+  /* If profiling is enabled, the keys for profiling */
+#  if defined(PARSEC_PROF_TRACE)
+  __parsec_tp->super.super.profiling_array = complex_deps_profiling_array;
+  if( -2 == complex_deps_profiling_array[0] ) {
+    #if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+parsec_profiling_add_dictionary_keyword("complex_deps::FCT5::internal init", "fill:34D8D8",
+                                       0,
+                                       NULL,
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(complex_deps_FCT5.task_class_id  + PARSEC_complex_deps_NB_TASK_CLASSES)/* FCT5 (internal init) start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(complex_deps_FCT5.task_class_id  + PARSEC_complex_deps_NB_TASK_CLASSES)/* FCT5 (internal init) end key */]);
+#endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+parsec_profiling_add_dictionary_keyword("complex_deps::FCT5", "fill:CC2828",
+                                       sizeof(parsec_task_prof_info_t)+2*sizeof(parsec_assignment_t),
+                                       "dc_key{uint64_t};priority{int32_t};dc_dataid{uint32_t};tcid{uint32_t};trc{int32_t};i{int32_t};k{int32_t}",
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(complex_deps_FCT5.task_class_id) /* FCT5 start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(complex_deps_FCT5.task_class_id) /* FCT5 end key */]);
+
+    #if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+parsec_profiling_add_dictionary_keyword("complex_deps::FCT4::internal init", "fill:5534D8",
+                                       0,
+                                       NULL,
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(complex_deps_FCT4.task_class_id  + PARSEC_complex_deps_NB_TASK_CLASSES)/* FCT4 (internal init) start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(complex_deps_FCT4.task_class_id  + PARSEC_complex_deps_NB_TASK_CLASSES)/* FCT4 (internal init) end key */]);
+#endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+parsec_profiling_add_dictionary_keyword("complex_deps::FCT4", "fill:ABCC28",
+                                       sizeof(parsec_task_prof_info_t)+2*sizeof(parsec_assignment_t),
+                                       "dc_key{uint64_t};priority{int32_t};dc_dataid{uint32_t};tcid{uint32_t};trc{int32_t};i{int32_t};k{int32_t}",
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(complex_deps_FCT4.task_class_id) /* FCT4 start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(complex_deps_FCT4.task_class_id) /* FCT4 end key */]);
+
+    #if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+parsec_profiling_add_dictionary_keyword("complex_deps::FCT3::internal init", "fill:D83496",
+                                       0,
+                                       NULL,
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(complex_deps_FCT3.task_class_id  + PARSEC_complex_deps_NB_TASK_CLASSES)/* FCT3 (internal init) start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(complex_deps_FCT3.task_class_id  + PARSEC_complex_deps_NB_TASK_CLASSES)/* FCT3 (internal init) end key */]);
+#endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+parsec_profiling_add_dictionary_keyword("complex_deps::FCT3", "fill:28CC6A",
+                                       sizeof(parsec_task_prof_info_t)+3*sizeof(parsec_assignment_t),
+                                       "dc_key{uint64_t};priority{int32_t};dc_dataid{uint32_t};tcid{uint32_t};trc{int32_t};i{int32_t};k{int32_t};j{int32_t}",
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(complex_deps_FCT3.task_class_id) /* FCT3 start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(complex_deps_FCT3.task_class_id) /* FCT3 end key */]);
+
+    #if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+parsec_profiling_add_dictionary_keyword("complex_deps::FCT2::internal init", "fill:D89634",
+                                       0,
+                                       NULL,
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(complex_deps_FCT2.task_class_id  + PARSEC_complex_deps_NB_TASK_CLASSES)/* FCT2 (internal init) start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(complex_deps_FCT2.task_class_id  + PARSEC_complex_deps_NB_TASK_CLASSES)/* FCT2 (internal init) end key */]);
+#endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+parsec_profiling_add_dictionary_keyword("complex_deps::FCT2", "fill:286ACC",
+                                       sizeof(parsec_task_prof_info_t)+3*sizeof(parsec_assignment_t),
+                                       "dc_key{uint64_t};priority{int32_t};dc_dataid{uint32_t};tcid{uint32_t};trc{int32_t};i{int32_t};k{int32_t};j{int32_t}",
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(complex_deps_FCT2.task_class_id) /* FCT2 start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(complex_deps_FCT2.task_class_id) /* FCT2 end key */]);
+
+    #if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+parsec_profiling_add_dictionary_keyword("complex_deps::FCT1::internal init", "fill:55D834",
+                                       0,
+                                       NULL,
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(complex_deps_FCT1.task_class_id  + PARSEC_complex_deps_NB_TASK_CLASSES)/* FCT1 (internal init) start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(complex_deps_FCT1.task_class_id  + PARSEC_complex_deps_NB_TASK_CLASSES)/* FCT1 (internal init) end key */]);
+#endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+parsec_profiling_add_dictionary_keyword("complex_deps::FCT1", "fill:AB28CC",
+                                       sizeof(parsec_task_prof_info_t)+2*sizeof(parsec_assignment_t),
+                                       "dc_key{uint64_t};priority{int32_t};dc_dataid{uint32_t};tcid{uint32_t};trc{int32_t};i{int32_t};k{int32_t}",
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(complex_deps_FCT1.task_class_id) /* FCT1 start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(complex_deps_FCT1.task_class_id) /* FCT1 end key */]);
+
+  }
+#  endif /* defined(PARSEC_PROF_TRACE) */
+  __parsec_tp->super.super.repo_array = __parsec_tp->repositories;
+  __parsec_tp->super.super.startup_hook = (parsec_startup_fn_t)complex_deps_startup;
+  (void)parsec_taskpool_reserve_id((parsec_taskpool_t*)__parsec_tp);
+}
+
+  /** Generate class declaration and instance using the above constructor and destructor */
+  PARSEC_OBJ_CLASS_DECLARATION(__parsec_complex_deps_internal_taskpool_t);
+  PARSEC_OBJ_CLASS_INSTANCE(__parsec_complex_deps_internal_taskpool_t, parsec_complex_deps_taskpool_t,
+                            __parsec_complex_deps_internal_constructor, __parsec_complex_deps_internal_destructor);
+
+#undef descA
+#undef NI
+#undef NK
+
+parsec_complex_deps_taskpool_t *parsec_complex_deps_new(parsec_matrix_block_cyclic_t* descA /* data descA */, int NI, int NK)
+{
+  __parsec_complex_deps_internal_taskpool_t *__parsec_tp = PARSEC_OBJ_NEW(__parsec_complex_deps_internal_taskpool_t);
+  /* Dump the hidden parameters with default values */
+
+  /* Now the Parameter-dependent structures: */
+  __parsec_tp->super._g_descA = descA;
+  __parsec_tp->super._g_NI = NI;
+  __parsec_tp->super._g_NK = NK;
+  PARSEC_AYU_REGISTER_TASK(&complex_deps_FCT5);
+  PARSEC_AYU_REGISTER_TASK(&complex_deps_FCT4);
+  PARSEC_AYU_REGISTER_TASK(&complex_deps_FCT3);
+  PARSEC_AYU_REGISTER_TASK(&complex_deps_FCT2);
+  PARSEC_AYU_REGISTER_TASK(&complex_deps_FCT1);
+  __parsec_tp->super.super.startup_hook = (parsec_startup_fn_t)complex_deps_startup;
+  (void)parsec_taskpool_reserve_id((parsec_taskpool_t*)__parsec_tp);
+/* Prevent warnings related to not used hidden global variables */
+;
+  return (parsec_complex_deps_taskpool_t*)__parsec_tp;
+}
+
+
+#define TIMER_START(TIMER)                      \
+    do {                                        \
+        struct timeval tv;                      \
+        gettimeofday(&tv,NULL);                 \
+        (TIMER) = tv.tv_sec * 1e6 + tv.tv_usec; \
+    } while (0)
+
+#define TIMER_STOP(TIMER)                                   \
+    do {                                                    \
+        struct timeval tv;                                  \
+        gettimeofday(&tv,NULL);                             \
+        (TIMER) = (tv.tv_sec * 1e6 + tv.tv_usec) - (TIMER); \
+    } while (0)
+
+int main( int argc, char** argv )
+{
+    parsec_complex_deps_taskpool_t* tp;
+    parsec_matrix_block_cyclic_t descA;
+    parsec_arena_datatype_t adt;
+    parsec_datatype_t otype;
+    parsec_context_t *parsec;
+    int ni = NN, nk = NN, verbose = 0, i = 1, rc;
+    int rank = 0, size = 1, mat_size, cores = -1;
+    long time_elapsed;
+
+    int pargc = 0; char **pargv = NULL;
+    for( i = 1; i < argc; i++) {
+        if( 0 == strncmp(argv[i], "--", 3) ) {
+            pargc = argc - i;
+            pargv = argv + i;
+            break;
+        }
+        if( 0 == strncmp(argv[i], "-i=", 3) ) {
+            ni = strtol(argv[i]+3, NULL, 10);
+            continue;
+        }
+        if( 0 == strncmp(argv[i], "-k=", 3) ) {
+            nk = strtol(argv[i]+3, NULL, 10);
+            continue;
+        }
+        if( 0 == strncmp(argv[i], "-v=", 3) ) {
+            verbose = strtol(argv[i]+3, NULL, 10);
+            continue;
+        }
+        if( 0 == strncmp(argv[i], "-c=", 3) ) {
+            cores = strtol(argv[i]+3, NULL, 10);
+            continue;
+        }
+    }
+#ifdef DISTRIBUTED
+    {
+        int provided;
+        MPI_Init_thread(NULL, NULL, MPI_THREAD_SERIALIZED, &provided);
+    }
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#endif  /* DISTRIBUTED */
+    parsec = parsec_init(cores, &pargc, &pargv);
+    if( NULL == parsec ) {
+        exit(-1);
+    }
+
+    /**
+     * Build the data and the arena to hold it up.
+     */
+    mat_size = 2*BLOCK*size*NN;
+    parsec_matrix_block_cyclic_init( &descA, TYPE, PARSEC_MATRIX_TILE,
+                               rank /*rank*/,
+                               2*BLOCK, 1, mat_size, 1,
+                               0, 0, mat_size, 1, 1, size, 1, 1, 0, 0);
+    descA.mat = parsec_data_allocate( descA.super.nb_local_tiles *
+                                     descA.super.bsiz *
+                                     parsec_datadist_getsizeoftype(TYPE) );
+    parsec_translate_matrix_type(TYPE, &otype);
+    parsec_add2arena_rect(&adt, otype,
+                                 descA.super.mb, descA.super.nb, descA.super.mb);
+
+
+    /* Heat up the engine: small tasks */
+    tp = parsec_complex_deps_new( &descA, ni, nk );
+    assert( NULL != tp );
+    tp->arenas_datatypes[PARSEC_complex_deps_DEFAULT_ADT_IDX] = adt;
+    PARSEC_OBJ_RETAIN(adt.arena);
+
+    rc = parsec_context_add_taskpool( parsec, (parsec_taskpool_t*)tp );
+    PARSEC_CHECK_ERROR(rc, "parsec_context_add_taskpool");
+
+    rc = parsec_context_start(parsec);
+    PARSEC_CHECK_ERROR(rc, "parsec_context_start");
+
+    rc = parsec_context_wait(parsec);
+    parsec_taskpool_free(&tp->super);
+    PARSEC_CHECK_ERROR(rc, "parsec_context_wait");
+
+    /* No priority */
+    tp = parsec_complex_deps_new( &descA, ni, nk );
+    assert( NULL != tp );
+    TIMER_START(time_elapsed);
+    tp->arenas_datatypes[PARSEC_complex_deps_DEFAULT_ADT_IDX] = adt;
+    rc = parsec_context_add_taskpool( parsec, (parsec_taskpool_t*)tp );
+    PARSEC_CHECK_ERROR(rc, "parsec_context_add_taskpool");
+    TIMER_STOP(time_elapsed);
+    printf("DAG construction in %ld micro-sec\n", time_elapsed);
+    if( verbose >= 5 ) {
+        printf("<DartMeasurement name=\"no_pri\" type=\"numeric/double\"\n"
+               "                 encoding=\"none\" compression=\"none\">\n"
+               "%g\n"
+               "</DartMeasurement>\n",
+               (double)time_elapsed);
+    }
+    rc = parsec_context_start(parsec);
+    PARSEC_CHECK_ERROR(rc, "parsec_context_start");
+
+    TIMER_START(time_elapsed);
+    rc = parsec_context_wait(parsec);
+    parsec_taskpool_free(&tp->super);
+    PARSEC_CHECK_ERROR(rc, "parsec_context_wait");
+    TIMER_STOP(time_elapsed);
+    printf("DAG execution in %ld micro-sec\n", time_elapsed);
+
+    parsec_del2arena( & adt );
+
+    free(descA.mat);
+
+    parsec_fini( &parsec);
+
+    return 0;
+}
+
+PARSEC_OBJ_CLASS_INSTANCE(parsec_complex_deps_taskpool_t, parsec_taskpool_t, NULL, NULL);
+
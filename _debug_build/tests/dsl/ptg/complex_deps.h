@@ -0,0 +1,185 @@
+#ifndef _complex_deps_h_
+#define _complex_deps_h_
+#include "parsec.h"
+#include "parsec/parsec_internal.h"
+#include "parsec/remote_dep.h"
+
+BEGIN_C_DECLS
+
+#define PARSEC_complex_deps_DEFAULT_ADT_IDX    0
+#define PARSEC_complex_deps_ADT_IDX_MAX       1
+typedef struct parsec_complex_deps_taskpool_s {
+  parsec_taskpool_t super;
+  /* The list of globals */
+  parsec_matrix_block_cyclic_t* _g_descA /* data descA */;
+  int _g_NI;
+  int _g_NK;
+  /* The array of datatypes (DEFAULT and co.) */
+  parsec_arena_datatype_t arenas_datatypes[PARSEC_complex_deps_ADT_IDX_MAX];
+  uint32_t arenas_datatypes_size;
+} parsec_complex_deps_taskpool_t;
+
+/** Beware that this object is not a superset of the internal object, and as a result
+ *  we should never create one directly. Instead we should rely on the creation of the
+ *  internal object (__parsec_complex_deps_taskpool_t).
+ */
+PARSEC_OBJ_CLASS_DECLARATION(parsec_complex_deps_taskpool_t);
+extern parsec_complex_deps_taskpool_t *parsec_complex_deps_new(parsec_matrix_block_cyclic_t* _g_descA /* data descA */, int _g_NI, int _g_NK);
+
+#if MAX_LOCAL_COUNT < 2  /* number of parameters and locals FCT5 */
+  #error Too many parameters and local variables (2 out of MAX_LOCAL_COUNT) for task FCT5
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_complex_deps_FCT5_assignment_s {
+  parsec_assignment_t i;
+  parsec_assignment_t k;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-2];
+} __parsec_complex_deps_FCT5_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 1  /* total number of flows for task FCT5 */
+  #error Too many flows (1 out of MAX_PARAM_COUNT) for task FCT5
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_complex_deps_FCT5_data_s {
+  parsec_data_pair_t _f_A;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-1];
+} __parsec_complex_deps_FCT5_data_t;
+
+typedef struct __parsec_complex_deps_FCT5_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_complex_deps_FCT5_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_complex_deps_FCT5_data_s data;
+} __parsec_complex_deps_FCT5_task_t;
+
+
+#if MAX_LOCAL_COUNT < 2  /* number of parameters and locals FCT4 */
+  #error Too many parameters and local variables (2 out of MAX_LOCAL_COUNT) for task FCT4
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_complex_deps_FCT4_assignment_s {
+  parsec_assignment_t i;
+  parsec_assignment_t k;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-2];
+} __parsec_complex_deps_FCT4_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 1  /* total number of flows for task FCT4 */
+  #error Too many flows (1 out of MAX_PARAM_COUNT) for task FCT4
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_complex_deps_FCT4_data_s {
+  parsec_data_pair_t _f_A;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-1];
+} __parsec_complex_deps_FCT4_data_t;
+
+typedef struct __parsec_complex_deps_FCT4_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_complex_deps_FCT4_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_complex_deps_FCT4_data_s data;
+} __parsec_complex_deps_FCT4_task_t;
+
+
+#if MAX_LOCAL_COUNT < 3  /* number of parameters and locals FCT3 */
+  #error Too many parameters and local variables (3 out of MAX_LOCAL_COUNT) for task FCT3
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_complex_deps_FCT3_assignment_s {
+  parsec_assignment_t i;
+  parsec_assignment_t k;
+  parsec_assignment_t j;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-3];
+} __parsec_complex_deps_FCT3_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 2  /* total number of flows for task FCT3 */
+  #error Too many flows (2 out of MAX_PARAM_COUNT) for task FCT3
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_complex_deps_FCT3_data_s {
+  parsec_data_pair_t _f_A;
+  parsec_data_pair_t _f_B;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-2];
+} __parsec_complex_deps_FCT3_data_t;
+
+typedef struct __parsec_complex_deps_FCT3_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_complex_deps_FCT3_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_complex_deps_FCT3_data_s data;
+} __parsec_complex_deps_FCT3_task_t;
+
+
+#if MAX_LOCAL_COUNT < 3  /* number of parameters and locals FCT2 */
+  #error Too many parameters and local variables (3 out of MAX_LOCAL_COUNT) for task FCT2
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_complex_deps_FCT2_assignment_s {
+  parsec_assignment_t i;
+  parsec_assignment_t k;
+  parsec_assignment_t j;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-3];
+} __parsec_complex_deps_FCT2_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 1  /* total number of flows for task FCT2 */
+  #error Too many flows (1 out of MAX_PARAM_COUNT) for task FCT2
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_complex_deps_FCT2_data_s {
+  parsec_data_pair_t _f_A;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-1];
+} __parsec_complex_deps_FCT2_data_t;
+
+typedef struct __parsec_complex_deps_FCT2_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_complex_deps_FCT2_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_complex_deps_FCT2_data_s data;
+} __parsec_complex_deps_FCT2_task_t;
+
+
+#if MAX_LOCAL_COUNT < 2  /* number of parameters and locals FCT1 */
+  #error Too many parameters and local variables (2 out of MAX_LOCAL_COUNT) for task FCT1
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_complex_deps_FCT1_assignment_s {
+  parsec_assignment_t i;
+  parsec_assignment_t k;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-2];
+} __parsec_complex_deps_FCT1_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 2  /* total number of flows for task FCT1 */
+  #error Too many flows (2 out of MAX_PARAM_COUNT) for task FCT1
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_complex_deps_FCT1_data_s {
+  parsec_data_pair_t _f_A;
+  parsec_data_pair_t _f_B;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-2];
+} __parsec_complex_deps_FCT1_data_t;
+
+typedef struct __parsec_complex_deps_FCT1_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_complex_deps_FCT1_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_complex_deps_FCT1_data_s data;
+} __parsec_complex_deps_FCT1_task_t;
+
+
+END_C_DECLS
+
+#endif /* _complex_deps_h_ */ 
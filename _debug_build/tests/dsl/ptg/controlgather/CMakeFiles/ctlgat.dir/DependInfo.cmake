@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/_debug_build/tests/dsl/ptg/controlgather/ctlgat.c" "tests/dsl/ptg/controlgather/CMakeFiles/ctlgat.dir/ctlgat.c.o" "gcc" "tests/dsl/ptg/controlgather/CMakeFiles/ctlgat.dir/ctlgat.c.o.d"
+  "/root/repo/tests/dsl/ptg/controlgather/ctlgat_data.c" "tests/dsl/ptg/controlgather/CMakeFiles/ctlgat.dir/ctlgat_data.c.o" "gcc" "tests/dsl/ptg/controlgather/CMakeFiles/ctlgat.dir/ctlgat_data.c.o.d"
+  "/root/repo/tests/dsl/ptg/controlgather/ctlgat_wrapper.c" "tests/dsl/ptg/controlgather/CMakeFiles/ctlgat.dir/ctlgat_wrapper.c.o" "gcc" "tests/dsl/ptg/controlgather/CMakeFiles/ctlgat.dir/ctlgat_wrapper.c.o.d"
+  "/root/repo/tests/dsl/ptg/controlgather/main.c" "tests/dsl/ptg/controlgather/CMakeFiles/ctlgat.dir/main.c.o" "gcc" "tests/dsl/ptg/controlgather/CMakeFiles/ctlgat.dir/main.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_debug_build/parsec/CMakeFiles/parsec.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "/root/repo/_debug_build/parsec/include/fortran")
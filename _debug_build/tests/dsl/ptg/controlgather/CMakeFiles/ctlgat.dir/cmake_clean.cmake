@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ctlgat.dir/ctlgat.c.o"
+  "CMakeFiles/ctlgat.dir/ctlgat.c.o.d"
+  "CMakeFiles/ctlgat.dir/ctlgat_data.c.o"
+  "CMakeFiles/ctlgat.dir/ctlgat_data.c.o.d"
+  "CMakeFiles/ctlgat.dir/ctlgat_wrapper.c.o"
+  "CMakeFiles/ctlgat.dir/ctlgat_wrapper.c.o.d"
+  "CMakeFiles/ctlgat.dir/main.c.o"
+  "CMakeFiles/ctlgat.dir/main.c.o.d"
+  "ctlgat"
+  "ctlgat.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ctlgat.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
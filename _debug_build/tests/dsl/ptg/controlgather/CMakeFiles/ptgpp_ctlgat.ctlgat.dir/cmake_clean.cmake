@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ptgpp_ctlgat.ctlgat"
+  "ctlgat.c"
+  "ctlgat.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ptgpp_ctlgat.ctlgat.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/local_indices.dir/local_indices.c.o"
+  "CMakeFiles/local_indices.dir/local_indices.c.o.d"
+  "local_indices"
+  "local_indices.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/local_indices.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ptgpp_local_indices.local_indices"
+  "local_indices.c"
+  "local_indices.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ptgpp_local_indices.local_indices.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,5494 @@
+#include "parsec.h"
+#include "parsec/parsec_internal.h"
+#include "parsec/ayudame.h"
+#include "parsec/execution_stream.h"
+#include "parsec/parsec_binary_profile.h"
+#include "parsec/mca/device/device_gpu.h"
+#if defined(PARSEC_HAVE_DEV_CUDA_SUPPORT)
+#include "parsec/mca/device/cuda/device_cuda.h"
+#endif  /* defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) */
+#if defined(PARSEC_HAVE_DEV_HIP_SUPPORT)
+#include "parsec/mca/device/hip/device_hip.h"
+#endif  /* defined(PARSEC_HAVE_DEV_HIP_SUPPORT) */
+#if defined(_MSC_VER) || defined(__MINGW32__)
+#  include <malloc.h>
+#else
+#  include <alloca.h>
+#endif  /* defined(_MSC_VER) || defined(__MINGW32__) */
+
+#define PARSEC_local_indices_NB_TASK_CLASSES 5
+#define PARSEC_local_indices_NB_DATA 1
+
+typedef struct __parsec_local_indices_internal_taskpool_s __parsec_local_indices_internal_taskpool_t;
+struct parsec_local_indices_internal_taskpool_s;
+
+/** Predeclarations of the parsec_task_class_t */
+static const parsec_task_class_t local_indices_tC;
+static const parsec_task_class_t local_indices_tB;
+static const parsec_task_class_t local_indices_tA;
+static const parsec_task_class_t local_indices_tG;
+static const parsec_task_class_t local_indices_STARTUP;
+/** Predeclarations of the parameters */
+static const parsec_flow_t flow_of_local_indices_tC_for_A;
+static const parsec_flow_t flow_of_local_indices_tB_for_A;
+static const parsec_flow_t flow_of_local_indices_tA_for_A;
+static const parsec_flow_t flow_of_local_indices_tG_for_Y;
+static const parsec_flow_t flow_of_local_indices_tG_for_Z;
+static const parsec_flow_t flow_of_local_indices_STARTUP_for_A;
+static const parsec_flow_t flow_of_local_indices_STARTUP_for_X;
+/*
+ * Copyright (c) 2019-2023 The University of Tennessee and The University
+ *                         of Tennessee Research Foundation.  All rights
+ *                         reserved.
+ *
+ */
+
+#include <sys/time.h>
+#include <inttypes.h>
+#include <string.h>
+#include <stdlib.h>
+#include "parsec/data_dist/matrix/two_dim_rectangle_cyclic.h"
+
+/**
+ * This test defines sparse execution domains to illustrate the
+ * use of local indices in the PTG/JDF syntax.
+ */
+#define PARSEC_local_indices_DEFAULT_ADT    (&__parsec_tp->super.arenas_datatypes[PARSEC_local_indices_DEFAULT_ADT_IDX])
+#include "local_indices.h"
+
+struct __parsec_local_indices_internal_taskpool_s {
+ parsec_local_indices_taskpool_t super;
+ volatile int32_t sync_point;
+ volatile int32_t initial_number_tasks;
+ parsec_task_t* startup_queue;
+  /* The ranges to compute the hash key */
+  int tC_l1_min;
+  int tC_l1_range;
+  int tC_l2_min;
+  int tC_l2_range;
+  int tB_o_min;
+  int tB_o_range;
+  int tB_e_min;
+  int tB_e_range;
+  int tB_i_min;
+  int tB_i_range;
+  int tB_j_min;
+  int tB_j_range;
+  int tA_o_min;
+  int tA_o_range;
+  int tA_e_min;
+  int tA_e_range;
+  int tA_i_min;
+  int tA_i_range;
+  int tA_j_min;
+  int tA_j_range;
+  int tG_zero_min;
+  int tG_zero_range;
+  int STARTUP_odd_min;
+  int STARTUP_odd_range;
+  int STARTUP_even_min;
+  int STARTUP_even_range;
+  /* The list of data repositories  tB  STARTUP */
+  data_repo_t* repositories[5];
+};
+
+#if defined(PARSEC_PROF_TRACE)
+#  if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+static int local_indices_profiling_array[4*PARSEC_local_indices_NB_TASK_CLASSES] = {-2}; /* 2 pairs (begin, end) per task, times two because each task class has an internal_init task */
+#  else /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+static int local_indices_profiling_array[2*PARSEC_local_indices_NB_TASK_CLASSES] = {-2}; /* 2 pairs (begin, end) per task */
+#  endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+#endif  /* defined(PARSEC_PROF_TRACE) */
+/* Globals */
+#define descA __parsec_tp->super._g_descA
+#define nb_tasks_array (__parsec_tp->super._g_nb_tasks_array)
+
+static inline int parsec_imin(int a, int b) { return (a <= b) ? a : b; };
+
+static inline int parsec_imax(int a, int b) { return (a >= b) ? a : b; };
+
+static inline int32_t local_indices_STARTUP_inline_c_expr1_line_32(const __parsec_local_indices_internal_taskpool_t *__parsec_tp, const __parsec_local_indices_STARTUP_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task STARTUP */
+  const int i = assignments->ldef[2].value;
+  const int j = assignments->ldef[3].value;
+  const int odd = assignments->odd.value; (void)odd;
+  const int even = assignments->even.value; (void)even;
+
+  (void)i;
+  (void)j;
+  (void)odd;  (void)even;
+
+ return i; 
+}
+
+static inline int32_t local_indices_STARTUP_inline_c_expr2_line_32(const __parsec_local_indices_internal_taskpool_t *__parsec_tp, const __parsec_local_indices_STARTUP_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task STARTUP */
+  const int i = assignments->ldef[2].value;
+  const int odd = assignments->odd.value; (void)odd;
+  const int even = assignments->even.value; (void)even;
+
+  (void)i;
+  (void)odd;  (void)even;
+
+ return even; 
+}
+
+static inline int32_t local_indices_STARTUP_inline_c_expr3_line_26(const __parsec_local_indices_internal_taskpool_t *__parsec_tp, const __parsec_local_indices_STARTUP_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task STARTUP */
+  const int i = assignments->ldef[0].value;
+  const int odd = assignments->odd.value; (void)odd;
+  const int even = assignments->even.value; (void)even;
+
+  (void)i;
+  (void)odd;  (void)even;
+
+ return 2*i+1; 
+}
+
+static inline int32_t local_indices_STARTUP_inline_c_expr4_line_26(const __parsec_local_indices_internal_taskpool_t *__parsec_tp, const __parsec_local_indices_STARTUP_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task STARTUP */
+  const int odd = assignments->odd.value; (void)odd;
+  const int even = assignments->even.value; (void)even;
+
+  (void)odd;  (void)even;
+
+ return 4; 
+}
+
+/* Data Access Macros */
+#define data_of_descA(descA_d0, descA_d1)  (((parsec_data_collection_t*)__parsec_tp->super._g_descA)->data_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, (descA_d0), (descA_d1)))
+
+#define rank_of_descA(descA_d0, descA_d1)  (((parsec_data_collection_t*)__parsec_tp->super._g_descA)->rank_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, (descA_d0), (descA_d1)))
+
+/* Functions Predicates */
+#define tC_pred(l1, l2) (((parsec_data_collection_t*)(__parsec_tp->super._g_descA))->myrank == rank_of_descA((l1 % descA->super.mt), (l2 % descA->super.nt)))
+#define tB_pred(o, e, i, j) (((parsec_data_collection_t*)(__parsec_tp->super._g_descA))->myrank == rank_of_descA((i % descA->super.mt), (j % descA->super.nt)))
+#define tA_pred(o, e, i, j) (((parsec_data_collection_t*)(__parsec_tp->super._g_descA))->myrank == rank_of_descA((i % descA->super.mt), (j % descA->super.nt)))
+#define tG_pred(zero) (((parsec_data_collection_t*)(__parsec_tp->super._g_descA))->myrank == rank_of_descA(0, 0))
+#define STARTUP_pred(odd, even) (((parsec_data_collection_t*)(__parsec_tp->super._g_descA))->myrank == rank_of_descA(((odd / 2) % descA->super.mt), ((even / 2) % descA->super.nt)))
+
+/* Data Repositories */
+#define tC_repo (__parsec_tp->repositories[4])
+#define tB_repo (__parsec_tp->repositories[3])
+#define tA_repo (__parsec_tp->repositories[2])
+#define tG_repo (__parsec_tp->repositories[1])
+#define STARTUP_repo (__parsec_tp->repositories[0])
+/* Release dependencies output macro */
+#if defined(PARSEC_DEBUG_NOISIER)
+#define RELEASE_DEP_OUTPUT(ES, DEPO, TASKO, DEPI, TASKI, RSRC, RDST, DATA)\
+  do { \
+    char tmp1[128], tmp2[128]; (void)tmp1; (void)tmp2;\
+    PARSEC_DEBUG_VERBOSE(20, parsec_debug_output, "thread %d VP %d explore deps from %s:%s to %s:%s (from rank %d to %d) base ptr %p",\
+           (NULL != (ES) ? (ES)->th_id : -1), (NULL != (ES) ? (ES)->virtual_process->vp_id : -1),\
+           DEPO, parsec_task_snprintf(tmp1, 128, (parsec_task_t*)(TASKO)),\
+           DEPI, parsec_task_snprintf(tmp2, 128, (parsec_task_t*)(TASKI)), (RSRC), (RDST), (DATA));\
+  } while(0)
+#define ACQUIRE_FLOW(TASKI, DEPI, FUNO, DEPO, LOCALS, PTR)\
+  do { \
+    char tmp1[128], tmp2[128]; (void)tmp1; (void)tmp2;\
+    PARSEC_DEBUG_VERBOSE(20, parsec_debug_output, "task %s acquires flow %s from %s %s data ptr %p",\
+           parsec_task_snprintf(tmp1, 128, (parsec_task_t*)(TASKI)), (DEPI),\
+           (DEPO), parsec_snprintf_assignments(tmp2, 128, (FUNO), (parsec_assignment_t*)(LOCALS)), (PTR));\
+  } while(0)
+#else
+#define RELEASE_DEP_OUTPUT(ES, DEPO, TASKO, DEPI, TASKI, RSRC, RDST, DATA)
+#define ACQUIRE_FLOW(TASKI, DEPI, TASKO, DEPO, LOCALS, PTR)
+#endif
+static inline parsec_key_t __jdf2c_make_key_tC(const parsec_taskpool_t *tp, const parsec_assignment_t *as)
+{
+  const __parsec_local_indices_internal_taskpool_t *__parsec_tp = (const __parsec_local_indices_internal_taskpool_t *)tp;
+  const __parsec_local_indices_tC_parsec_assignment_t *assignment = (const __parsec_local_indices_tC_parsec_assignment_t*)as;
+  uint64_t __parsec_id = 0;
+  __parsec_id += (assignment->l1.value - __parsec_tp->tC_l1_min);
+  __parsec_id += (assignment->l2.value - __parsec_tp->tC_l2_min) * __parsec_tp->tC_l1_range;
+  return (parsec_key_t)__parsec_id;
+}
+static char *__jdf2c_key_fns_tC_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_local_indices_internal_taskpool_t *__parsec_tp = (__parsec_local_indices_internal_taskpool_t *)user_data;
+  int l1 = (__parsec_key) % __parsec_tp->tC_l1_range + __parsec_tp->tC_l1_min;
+  __parsec_key = __parsec_key / __parsec_tp->tC_l1_range;
+  int l2 = (__parsec_key) % __parsec_tp->tC_l2_range + __parsec_tp->tC_l2_min;
+  __parsec_key = __parsec_key / __parsec_tp->tC_l2_range;
+  snprintf(buffer, buffer_size, "tC(%d, %d)", l1, l2);
+  return buffer;
+}
+
+static parsec_key_fn_t __jdf2c_key_fns_tC = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = __jdf2c_key_fns_tC_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+static inline parsec_key_t __jdf2c_make_key_tB(const parsec_taskpool_t *tp, const parsec_assignment_t *as)
+{
+  const __parsec_local_indices_internal_taskpool_t *__parsec_tp = (const __parsec_local_indices_internal_taskpool_t *)tp;
+  const __parsec_local_indices_tB_parsec_assignment_t *assignment = (const __parsec_local_indices_tB_parsec_assignment_t*)as;
+  uint64_t __parsec_id = 0;
+  __parsec_id += (assignment->o.value - __parsec_tp->tB_o_min);
+  __parsec_id += (assignment->e.value - __parsec_tp->tB_e_min) * __parsec_tp->tB_o_range;
+  __parsec_id += (assignment->i.value - __parsec_tp->tB_i_min) * __parsec_tp->tB_o_range * __parsec_tp->tB_e_range;
+  __parsec_id += (assignment->j.value - __parsec_tp->tB_j_min) * __parsec_tp->tB_o_range * __parsec_tp->tB_e_range * __parsec_tp->tB_i_range;
+  return (parsec_key_t)__parsec_id;
+}
+static char *__jdf2c_key_fns_tB_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_local_indices_internal_taskpool_t *__parsec_tp = (__parsec_local_indices_internal_taskpool_t *)user_data;
+  __parsec_local_indices_tB_parsec_assignment_t __jdf2c__assignments = {  .o.value = 0, .e.value = 0, .i.value = 0, .j.value = 0 };
+  int o = (__parsec_key) % __parsec_tp->tB_o_range + __parsec_tp->tB_o_min;
+  __parsec_key = __parsec_key / __parsec_tp->tB_o_range;
+  __jdf2c__assignments.o.value = o;
+  int e = (__parsec_key) % __parsec_tp->tB_e_range + __parsec_tp->tB_e_min;
+  __parsec_key = __parsec_key / __parsec_tp->tB_e_range;
+  __jdf2c__assignments.e.value = e;
+  int i = (__parsec_key) % __parsec_tp->tB_i_range + __parsec_tp->tB_i_min;
+  __parsec_key = __parsec_key / __parsec_tp->tB_i_range;
+  __jdf2c__assignments.i.value = i;
+  int j = (__parsec_key) % __parsec_tp->tB_j_range + __parsec_tp->tB_j_min;
+  __parsec_key = __parsec_key / __parsec_tp->tB_j_range;
+  __jdf2c__assignments.j.value = j;
+  (void)__jdf2c__assignments;
+  snprintf(buffer, buffer_size, "tB(%d, %d, %d, %d)", o, e, i, j);
+  return buffer;
+}
+
+static parsec_key_fn_t __jdf2c_key_fns_tB = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = __jdf2c_key_fns_tB_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+static inline parsec_key_t __jdf2c_make_key_tA(const parsec_taskpool_t *tp, const parsec_assignment_t *as)
+{
+  const __parsec_local_indices_internal_taskpool_t *__parsec_tp = (const __parsec_local_indices_internal_taskpool_t *)tp;
+  const __parsec_local_indices_tA_parsec_assignment_t *assignment = (const __parsec_local_indices_tA_parsec_assignment_t*)as;
+  uint64_t __parsec_id = 0;
+  __parsec_id += (assignment->o.value - __parsec_tp->tA_o_min);
+  __parsec_id += (assignment->e.value - __parsec_tp->tA_e_min) * __parsec_tp->tA_o_range;
+  __parsec_id += (assignment->i.value - __parsec_tp->tA_i_min) * __parsec_tp->tA_o_range * __parsec_tp->tA_e_range;
+  __parsec_id += (assignment->j.value - __parsec_tp->tA_j_min) * __parsec_tp->tA_o_range * __parsec_tp->tA_e_range * __parsec_tp->tA_i_range;
+  return (parsec_key_t)__parsec_id;
+}
+static char *__jdf2c_key_fns_tA_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_local_indices_internal_taskpool_t *__parsec_tp = (__parsec_local_indices_internal_taskpool_t *)user_data;
+  __parsec_local_indices_tA_parsec_assignment_t __jdf2c__assignments = {  .o.value = 0, .e.value = 0, .i.value = 0, .j.value = 0 };
+  int o = (__parsec_key) % __parsec_tp->tA_o_range + __parsec_tp->tA_o_min;
+  __parsec_key = __parsec_key / __parsec_tp->tA_o_range;
+  __jdf2c__assignments.o.value = o;
+  int e = (__parsec_key) % __parsec_tp->tA_e_range + __parsec_tp->tA_e_min;
+  __parsec_key = __parsec_key / __parsec_tp->tA_e_range;
+  __jdf2c__assignments.e.value = e;
+  int i = (__parsec_key) % __parsec_tp->tA_i_range + __parsec_tp->tA_i_min;
+  __parsec_key = __parsec_key / __parsec_tp->tA_i_range;
+  __jdf2c__assignments.i.value = i;
+  int j = (__parsec_key) % __parsec_tp->tA_j_range + __parsec_tp->tA_j_min;
+  __parsec_key = __parsec_key / __parsec_tp->tA_j_range;
+  __jdf2c__assignments.j.value = j;
+  (void)__jdf2c__assignments;
+  snprintf(buffer, buffer_size, "tA(%d, %d, %d, %d)", o, e, i, j);
+  return buffer;
+}
+
+static parsec_key_fn_t __jdf2c_key_fns_tA = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = __jdf2c_key_fns_tA_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+static inline parsec_key_t __jdf2c_make_key_tG(const parsec_taskpool_t *tp, const parsec_assignment_t *as)
+{
+  const __parsec_local_indices_internal_taskpool_t *__parsec_tp = (const __parsec_local_indices_internal_taskpool_t *)tp;
+  const __parsec_local_indices_tG_parsec_assignment_t *assignment = (const __parsec_local_indices_tG_parsec_assignment_t*)as;
+  uint64_t __parsec_id = 0;
+  __parsec_id += (assignment->zero.value - __parsec_tp->tG_zero_min);
+  return (parsec_key_t)__parsec_id;
+}
+static char *__jdf2c_key_fns_tG_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_local_indices_internal_taskpool_t *__parsec_tp = (__parsec_local_indices_internal_taskpool_t *)user_data;
+  int zero = (__parsec_key) % __parsec_tp->tG_zero_range + __parsec_tp->tG_zero_min;
+  __parsec_key = __parsec_key / __parsec_tp->tG_zero_range;
+  snprintf(buffer, buffer_size, "tG(%d)", zero);
+  return buffer;
+}
+
+static parsec_key_fn_t __jdf2c_key_fns_tG = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = __jdf2c_key_fns_tG_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+static inline parsec_key_t __jdf2c_make_key_STARTUP(const parsec_taskpool_t *tp, const parsec_assignment_t *as)
+{
+  const __parsec_local_indices_internal_taskpool_t *__parsec_tp = (const __parsec_local_indices_internal_taskpool_t *)tp;
+  const __parsec_local_indices_STARTUP_parsec_assignment_t *assignment = (const __parsec_local_indices_STARTUP_parsec_assignment_t*)as;
+  uint64_t __parsec_id = 0;
+  __parsec_id += (assignment->odd.value - __parsec_tp->STARTUP_odd_min);
+  __parsec_id += (assignment->even.value - __parsec_tp->STARTUP_even_min) * __parsec_tp->STARTUP_odd_range;
+  return (parsec_key_t)__parsec_id;
+}
+static char *__jdf2c_key_fns_STARTUP_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_local_indices_internal_taskpool_t *__parsec_tp = (__parsec_local_indices_internal_taskpool_t *)user_data;
+  __parsec_local_indices_STARTUP_parsec_assignment_t __jdf2c__assignments = {  .odd.value = 0, .even.value = 0 };
+  int odd = (__parsec_key) % __parsec_tp->STARTUP_odd_range + __parsec_tp->STARTUP_odd_min;
+  __parsec_key = __parsec_key / __parsec_tp->STARTUP_odd_range;
+  __jdf2c__assignments.odd.value = odd;
+  int even = (__parsec_key) % __parsec_tp->STARTUP_even_range + __parsec_tp->STARTUP_even_min;
+  __parsec_key = __parsec_key / __parsec_tp->STARTUP_even_range;
+  __jdf2c__assignments.even.value = even;
+  (void)__jdf2c__assignments;
+  snprintf(buffer, buffer_size, "STARTUP(%d, %d)", odd, even);
+  return buffer;
+}
+
+static parsec_key_fn_t __jdf2c_key_fns_STARTUP = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = __jdf2c_key_fns_STARTUP_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/******                                      tC                                      ******/
+
+static inline int32_t minexpr_of_symb_local_indices_tC_l1_fct(const __parsec_local_indices_internal_taskpool_t *__parsec_tp, const __parsec_local_indices_tC_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 1;
+}
+static const parsec_expr_t minexpr_of_symb_local_indices_tC_l1 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_local_indices_tC_l1_fct }
+                   }
+};
+static inline int32_t maxexpr_of_symb_local_indices_tC_l1_fct(const __parsec_local_indices_internal_taskpool_t *__parsec_tp, const __parsec_local_indices_tC_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 2;
+}
+static const parsec_expr_t maxexpr_of_symb_local_indices_tC_l1 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_local_indices_tC_l1_fct }
+                   }
+};
+static const parsec_symbol_t symb_local_indices_tC_l1 = { .name = "l1", .context_index = 0, .min = &minexpr_of_symb_local_indices_tC_l1, .max = &maxexpr_of_symb_local_indices_tC_l1, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int minexpr_of_symb_local_indices_tC_l2_fct(const __parsec_local_indices_internal_taskpool_t *__parsec_tp, const __parsec_local_indices_tC_parsec_assignment_t *locals)
+{
+  const int l1 = locals->l1.value;
+  const int l2 = locals->l2.value; (void)l2;
+
+  (void)l1;
+  (void)l2;
+  (void)__parsec_tp; (void)locals;
+  return (2 * l1);
+}
+static const parsec_expr_t minexpr_of_symb_local_indices_tC_l2 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_local_indices_tC_l2_fct }
+                   }
+};
+static inline int maxexpr_of_symb_local_indices_tC_l2_fct(const __parsec_local_indices_internal_taskpool_t *__parsec_tp, const __parsec_local_indices_tC_parsec_assignment_t *locals)
+{
+  const int l1 = locals->l1.value;
+  const int l2 = locals->l2.value; (void)l2;
+
+  (void)l1;
+  (void)l2;
+  (void)__parsec_tp; (void)locals;
+  return (3 * l1);
+}
+static const parsec_expr_t maxexpr_of_symb_local_indices_tC_l2 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_local_indices_tC_l2_fct }
+                   }
+};
+static const parsec_symbol_t symb_local_indices_tC_l2 = { .name = "l2", .context_index = 1, .min = &minexpr_of_symb_local_indices_tC_l2, .max = &maxexpr_of_symb_local_indices_tC_l2, .cst_inc = 1, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int affinity_of_local_indices_tC(const __parsec_local_indices_tC_task_t *this_task,
+                     parsec_data_ref_t *ref)
+{
+    const __parsec_local_indices_internal_taskpool_t *__parsec_tp = (const __parsec_local_indices_internal_taskpool_t*)this_task->taskpool;
+  const int l1 = this_task->locals.l1.value; (void)l1;
+  const int l2 = this_task->locals.l2.value; (void)l2;
+
+  /* Silent Warnings: should look into predicate to know what variables are usefull */
+  (void)l1;
+  (void)l2;
+  ref->dc = (parsec_data_collection_t *)__parsec_tp->super._g_descA;
+  /* Compute data key */
+  ref->key = ref->dc->data_key(ref->dc, (l1 % descA->super.mt), (l2 % descA->super.nt));
+  return 1;
+}
+static const parsec_property_t properties_of_local_indices_tC[1] = {
+  {.name = NULL, .expr = NULL}
+};
+static const parsec_dep_t flow_of_local_indices_tC_for_A_dep1_atline_106 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 3, /* local_indices_tB */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_local_indices_tB_for_A,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_local_indices_tC_for_A,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_local_indices_tC_for_A = {
+  .name               = "A",
+  .sym_type           = PARSEC_SYM_IN,
+  .flow_flags         = PARSEC_FLOW_ACCESS_READ,
+  .flow_index         = 0,
+  .flow_datatype_mask = 0x0,
+  .dep_in     = { &flow_of_local_indices_tC_for_A_dep1_atline_106 },
+  .dep_out    = { NULL }
+};
+
+static void
+iterate_predecessors_of_local_indices_tC(parsec_execution_stream_t *es, const __parsec_local_indices_tC_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_local_indices_internal_taskpool_t *__parsec_tp = (const __parsec_local_indices_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_local_indices_tC_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_local_indices_tC_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int l1 = __jdf2c__tmp_locals.l1.value; (void)l1;
+  const int l2 = __jdf2c__tmp_locals.l2.value; (void)l2;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)l1;  (void)l2;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_descA((l1 % descA->super.mt), (l2 % descA->super.nt));
+#endif
+  if( action_mask & 0x1 ) {  /* Flow of data A [0] */
+    data.data   = this_task->data._f_A.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x1 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_local_indices_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_local_indices_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        __parsec_local_indices_tB_task_t* ncc = (__parsec_local_indices_tB_task_t*)&nc;
+    nc.task_class = __parsec_tp->super.super.task_classes_array[local_indices_tB.task_class_id];
+      const int tB_o = 7;
+      /* We cannot check if tB_o is within the iterator space, because that space is defined with local indices. We need to trust */
+      assert(&nc.locals[0].value == &ncc->locals.o.value);
+      ncc->locals.o.value = tB_o;
+      const int tB_e = 0;
+      /* We cannot check if tB_e is within the iterator space, because that space is defined with local indices. We need to trust */
+      assert(&nc.locals[1].value == &ncc->locals.e.value);
+      ncc->locals.e.value = tB_e;
+      const int tB_i = 7;
+      if( (tB_i >= (6)) && (tB_i <= (ncc->locals.o.value)) ) {
+        assert(&nc.locals[2].value == &ncc->locals.i.value);
+        ncc->locals.i.value = tB_i;
+        const int tB_j = 0;
+        if( (tB_j >= (0)) && (tB_j <= ((ncc->locals.e.value / 2))) ) {
+          assert(&nc.locals[3].value == &ncc->locals.j.value);
+          ncc->locals.j.value = tB_j;
+#if defined(DISTRIBUTED)
+          rank_dst = rank_of_descA((ncc->locals.i.value % descA->super.mt), (ncc->locals.j.value % descA->super.nt));
+          if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+            vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, (ncc->locals.i.value % descA->super.mt), (ncc->locals.j.value % descA->super.nt));
+          nc.priority = __parsec_tp->super.super.priority;
+          successor_repo = tB_repo;
+          successor_repo_key = __jdf2c_make_key_tB((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+        RELEASE_DEP_OUTPUT(es, "A", this_task, "A", &nc, rank_src, rank_dst, &data);
+        if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_local_indices_tC_for_A_dep1_atline_106, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+          }
+        }
+  }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static int release_deps_of_local_indices_tC(parsec_execution_stream_t *es, __parsec_local_indices_tC_task_t *this_task, uint32_t action_mask, parsec_remote_deps_t *deps)
+{
+  PARSEC_PINS(es, RELEASE_DEPS_BEGIN, (parsec_task_t *)this_task);  const __parsec_local_indices_internal_taskpool_t *__parsec_tp = (const __parsec_local_indices_internal_taskpool_t *)this_task->taskpool;
+  parsec_release_dep_fct_arg_t arg;
+  int __vp_id;
+  int consume_local_repo = 0;
+  arg.action_mask = action_mask;
+  arg.output_entry = NULL;
+  arg.output_repo = NULL;
+#if defined(DISTRIBUTED)
+  arg.remote_deps = deps;
+#endif  /* defined(DISTRIBUTED) */
+  assert(NULL != es);
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS )    arg.ready_lists = alloca(sizeof(parsec_task_t *) * es->virtual_process->parsec_context->nb_vp);
+  else
+    arg.ready_lists = NULL;
+  for( __vp_id = 0; __vp_id < es->virtual_process->parsec_context->nb_vp; arg.ready_lists[__vp_id++] = NULL );
+  (void)__parsec_tp; (void)deps;
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_A.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_A.source_repo, this_task->data._f_A.source_repo_entry->ht_item.key );
+    }
+  }
+  consume_local_repo = (this_task->repo_entry != NULL);
+  /* No successors, don't call iterate_successors and don't release any local deps */
+      if (consume_local_repo) {
+         data_repo_entry_used_once( tC_repo, this_task->repo_entry->ht_item.key );
+      }
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_A.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_A.data_in);
+    }
+  }
+  PARSEC_PINS(es, RELEASE_DEPS_END, (parsec_task_t *)this_task);  return 0;
+}
+
+static int data_lookup_of_local_indices_tC(parsec_execution_stream_t *es, __parsec_local_indices_tC_task_t *this_task)
+{
+  const __parsec_local_indices_internal_taskpool_t *__parsec_tp = (__parsec_local_indices_internal_taskpool_t *)this_task->taskpool;
+  parsec_assignment_t generic_locals[MAX_PARAM_COUNT];  /* generic task locals */
+  int target_device = 0; (void)target_device;
+  (void)__parsec_tp; (void)generic_locals; (void)es;
+  parsec_data_copy_t *chunk = NULL;
+  data_repo_t        *reshape_repo  = NULL, *consumed_repo  = NULL;
+  data_repo_entry_t  *reshape_entry = NULL, *consumed_entry = NULL;
+  parsec_key_t        reshape_entry_key = 0, consumed_entry_key = 0;
+  uint8_t             consumed_flow_index;
+  parsec_dep_data_description_t data;
+  int ret;
+  (void)reshape_repo; (void)reshape_entry; (void)reshape_entry_key;
+  (void)consumed_repo; (void)consumed_entry; (void)consumed_entry_key;
+  (void)consumed_flow_index;
+  (void)chunk; (void)data; (void)ret;
+  const int l1 = this_task->locals.l1.value; (void)l1;
+  const int l2 = this_task->locals.l2.value; (void)l2;
+  if( NULL == this_task->repo_entry ){
+    this_task->repo_entry = data_repo_lookup_entry_and_create(es, tC_repo,                                       __jdf2c_make_key_tC((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    data_repo_entry_addto_usage_limit(tC_repo, this_task->repo_entry->ht_item.key, 1);    this_task->repo_entry ->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(this_task->repo_entry ->sim_exec_date == 0);
+    this_task->repo_entry ->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  /* The reshape repo is the current task repo. */  reshape_repo = tC_repo;
+  reshape_entry_key = __jdf2c_make_key_tC((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals) ;
+  reshape_entry = this_task->repo_entry;
+  /* Lookup the input data, and store them in the context if any */
+
+if(! this_task->data._f_A.fulfill ){ /* Flow A */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_A.data_out = NULL;  /* input only */
+  /* Flow A [0] dependency [0] from predecessor tB */
+  if( NULL == (chunk = this_task->data._f_A.data_in) ) {
+  /* No data set up by predecessor on this task input flow */
+__parsec_local_indices_tB_parsec_assignment_t *target_locals = (__parsec_local_indices_tB_parsec_assignment_t*)&generic_locals;
+  const int tBo = target_locals->o.value = 7; (void)tBo;
+  const int tBe = target_locals->e.value = 0; (void)tBe;
+  const int tBi = target_locals->i.value = 7; (void)tBi;
+  const int tBj = target_locals->j.value = 0; (void)tBj;
+    if( (reshape_entry != NULL) && (reshape_entry->data[0] != NULL) ){
+        /* Reshape promise set up on this task repo by predecessor */
+        consumed_repo = reshape_repo;
+        consumed_entry = reshape_entry;
+        consumed_entry_key = reshape_entry_key;
+        consumed_flow_index = 0;
+    }else{
+        /* Consume from predecessor's repo */
+        consumed_repo = tB_repo;
+        consumed_entry_key = __jdf2c_make_key_tB((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)target_locals) ;
+        consumed_entry = data_repo_lookup_entry( consumed_repo, consumed_entry_key );
+        consumed_flow_index = 0;
+    }
+    data.data   = NULL;
+    data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+        data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    ACQUIRE_FLOW(this_task, "A", &local_indices_tB, "A", target_locals, chunk);
+    this_task->data._f_A.data_out = chunk;
+  } 
+  else {
+    /* Data set up by predecessor on this task input flow */
+    consumed_repo = this_task->data._f_A.source_repo;
+    consumed_entry = this_task->data._f_A.source_repo_entry;
+    consumed_entry_key = this_task->data._f_A.source_repo_entry->ht_item.key;
+    if( (reshape_entry != NULL) && (reshape_entry->data[0] != NULL) ){
+        /* Reshape promise set up on input by predecessor is on this task repo */
+        consumed_flow_index = 0;
+        assert( (this_task->data._f_A.source_repo == reshape_repo)
+             && (this_task->data._f_A.source_repo_entry == reshape_entry));
+    }else{
+        /* Reshape promise set up on input by predecessor is the predecesssor task repo */
+        consumed_flow_index = 0;
+    }
+    data.data   = NULL;
+    data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+        data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    this_task->data._f_A.data_out = parsec_data_get_copy(chunk->original, target_device);
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+    parsec_prof_grapher_data_input(chunk->original, (parsec_task_t*)this_task, &flow_of_local_indices_tC_for_A, 0);
+#endif
+  }
+    this_task->data._f_A.data_in     = chunk;
+    this_task->data._f_A.source_repo       = consumed_repo;
+    this_task->data._f_A.source_repo_entry = consumed_entry;
+    this_task->data._f_A.fulfill = 1;
+}
+
+  /** Generate profiling information */
+#if defined(PARSEC_PROF_TRACE)
+  this_task->prof_info.desc = (parsec_data_collection_t*)__parsec_tp->super._g_descA;
+  this_task->prof_info.priority = this_task->priority;
+  this_task->prof_info.data_id   = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->data_key((parsec_data_collection_t*)__parsec_tp->super._g_descA, (l1 % descA->super.mt), (l2 % descA->super.nt));
+  this_task->prof_info.task_class_id = this_task->task_class->task_class_id;
+  this_task->prof_info.task_return_code = -1;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int datatype_lookup_of_local_indices_tC(parsec_execution_stream_t *es, const parsec_task_t *this_generic_task, const parsec_task_t *parent_task,
+              uint32_t* flow_mask, parsec_dep_data_description_t* data)
+{
+  const __parsec_local_indices_tC_task_t *this_task = (__parsec_local_indices_tC_task_t*)this_generic_task;
+  const __parsec_local_indices_internal_taskpool_t *__parsec_tp = (__parsec_local_indices_internal_taskpool_t *)this_task->taskpool;
+  (void)__parsec_tp; (void)es; (void)this_task; (void)data; (void)parent_task;
+  const int l1 = this_task->locals.l1.value; (void)l1;
+  const int l2 = this_task->locals.l2.value; (void)l2;
+  data->local.arena = data->remote.arena = NULL;
+  data->local.src_datatype  = data->local.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->local.src_count     = data->local.dst_count = 0;
+  data->local.src_displ     = data->local.dst_displ = 0;
+  data->data_future  = NULL;
+  if( (*flow_mask) & 0x80000000U ) { /* these are the input dependencies remote datatypes  */
+if( (*flow_mask) & 0x1U ) {  /* Flow A */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_local_indices_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_local_indices_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_local_indices_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+    goto no_mask_match;
+  }
+
+  /* these are the output dependencies remote datatypes */
+ no_mask_match:
+  data->data                             = NULL;
+  data->remote.src_datatype = data->remote.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->remote.src_count    = data->remote.dst_count = 0;
+  data->remote.src_displ    = data->remote.dst_displ = 0;
+  data->data_future  = NULL;
+  (*flow_mask) = 0;  /* nothing left */
+  (void)l1;  (void)l2;
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+static int hook_of_local_indices_tC(parsec_execution_stream_t *es, __parsec_local_indices_tC_task_t *this_task)
+{
+  __parsec_local_indices_internal_taskpool_t *__parsec_tp = (__parsec_local_indices_internal_taskpool_t *)this_task->taskpool;
+  (void)es; (void)__parsec_tp;
+  const int l1 = this_task->locals.l1.value; (void)l1;
+  const int l2 = this_task->locals.l2.value; (void)l2;
+  (void)l1;  (void)l2;
+
+  /** Declare the variables that will hold the data, and all the accounting for each */
+  parsec_data_copy_t *_f_A = this_task->data._f_A.data_in;
+  void *A = PARSEC_DATA_COPY_GET_PTR(_f_A); (void)A;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    data_repo_entry_t *eA = this_task->data._f_A.source_repo_entry;
+    if( (NULL != eA) && (eA->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eA->sim_exec_date;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+  /** Cache Awareness Accounting */
+#if defined(PARSEC_CACHE_AWARENESS)
+  cache_buf_referenced(es->closest_cache, A);
+#endif /* PARSEC_CACHE_AWARENESS */
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                                    tC BODY                                    -----*/
+
+{
+   usleep( rand() % 50000 + 50000);
+   parsec_atomic_fetch_inc_int32(&nb_tasks_array[3]);
+}
+
+/*-----                                END OF tC BODY                                -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#endif  /*  defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+static int complete_hook_of_local_indices_tC(parsec_execution_stream_t *es, __parsec_local_indices_tC_task_t *this_task)
+{
+  const __parsec_local_indices_internal_taskpool_t *__parsec_tp = (__parsec_local_indices_internal_taskpool_t *)this_task->taskpool;
+#if defined(DISTRIBUTED)
+    const int l1 = this_task->locals.l1.value; (void)l1;
+  const int l2 = this_task->locals.l2.value; (void)l2;
+#endif  /* defined(DISTRIBUTED) */
+  (void)es; (void)__parsec_tp;
+parsec_data_t* data_t_desc = NULL; (void)data_t_desc;
+#if defined(DISTRIBUTED)
+  /** If not working on distributed, there is no risk that data is not in place */
+  (void)l1;  (void)l2;
+
+#endif /* DISTRIBUTED */
+#if defined(PARSEC_PROF_GRAPHER)
+  parsec_prof_grapher_task((parsec_task_t*)this_task, es->th_id, es->virtual_process->vp_id,
+     __jdf2c_key_fns_tC.key_hash(this_task->task_class->make_key( (parsec_taskpool_t*)this_task->taskpool, ((parsec_task_t*)this_task)->locals), NULL));
+#endif  /* defined(PARSEC_PROF_GRAPHER) */
+  release_deps_of_local_indices_tC(es, this_task,
+      PARSEC_ACTION_RELEASE_REMOTE_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_REFS |
+      PARSEC_ACTION_RESHAPE_ON_RELEASE |
+      0x0,  /* mask of all dep_index */ 
+      NULL);
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static parsec_hook_return_t release_task_of_local_indices_tC(parsec_execution_stream_t *es, parsec_task_t *this_task)
+{
+    const __parsec_local_indices_internal_taskpool_t *__parsec_tp =
+        (const __parsec_local_indices_internal_taskpool_t *)this_task->taskpool;
+    parsec_hash_table_t *ht = (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[4];
+    parsec_key_t key = this_task->task_class->make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals);
+    parsec_hashable_dependency_t *hash_dep = (parsec_hashable_dependency_t *)parsec_hash_table_remove(ht, key);
+    parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);
+    return parsec_release_task_to_mempool_update_nbtasks(es, this_task);
+}
+
+static char *local_indices_local_indices_tC_internal_init_deps_key_functions_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_local_indices_internal_taskpool_t *__parsec_tp = (__parsec_local_indices_internal_taskpool_t *)user_data;
+  int l1 = (__parsec_key) % __parsec_tp->tC_l1_range + __parsec_tp->tC_l1_min;
+  __parsec_key = __parsec_key / __parsec_tp->tC_l1_range;
+  int l2 = (__parsec_key) % __parsec_tp->tC_l2_range + __parsec_tp->tC_l2_min;
+  __parsec_key = __parsec_key / __parsec_tp->tC_l2_range;
+  snprintf(buffer, buffer_size, "tC(%d, %d)", l1, l2);
+  return buffer;
+}
+
+static parsec_key_fn_t local_indices_local_indices_tC_internal_init_deps_key_functions = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = local_indices_local_indices_tC_internal_init_deps_key_functions_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/* Needs: min-max count-tasks iterate */
+static int local_indices_tC_internal_init(parsec_execution_stream_t * es, __parsec_local_indices_tC_task_t * this_task)
+{
+  __parsec_local_indices_internal_taskpool_t *__parsec_tp = (__parsec_local_indices_internal_taskpool_t*)this_task->taskpool;
+  int32_t nb_tasks = 0, saved_nb_tasks = 0;
+int32_t __l1_min = 0x7fffffff, __l1_max = 0;int32_t __jdf2c_l1_min = 0x7fffffff, __jdf2c_l1_max = 0;int32_t __l2_min = 0x7fffffff, __l2_max = 0;int32_t __jdf2c_l2_min = 0x7fffffff, __jdf2c_l2_max = 0;  __parsec_local_indices_tC_parsec_assignment_t assignments = {  .l1.value = 0, .l2.value = 0 };
+  int32_t  l1,  l2;
+  int32_t __jdf2c_l1_start, __jdf2c_l1_end, __jdf2c_l1_inc;
+  int32_t __jdf2c_l2_start, __jdf2c_l2_end, __jdf2c_l2_inc;
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+  PARSEC_PROFILING_TRACE(es->es_profile,
+                         this_task->taskpool->profiling_array[START_KEY(this_task->task_class->task_class_id)],
+                         0,
+                         this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    __jdf2c_l1_start = 1;
+    __jdf2c_l1_end = 2;
+    __jdf2c_l1_inc = 1;
+    __l1_min = parsec_imin(__jdf2c_l1_start, __jdf2c_l1_end);
+    __l1_max = parsec_imax(__jdf2c_l1_start, __jdf2c_l1_end);
+    __jdf2c_l1_min = parsec_imin(__jdf2c_l1_min, __l1_min);
+    __jdf2c_l1_max = parsec_imax(__jdf2c_l1_max, __l1_max);
+    for(l1 =  __jdf2c_l1_start;
+        l1 <= __jdf2c_l1_end;
+        l1 += __jdf2c_l1_inc) {
+    assignments.l1.value = l1;
+      __jdf2c_l2_start = (2 * l1);
+      __jdf2c_l2_end = (3 * l1);
+      __jdf2c_l2_inc = 1;
+      __l2_min = parsec_imin(__jdf2c_l2_start, __jdf2c_l2_end);
+      __l2_max = parsec_imax(__jdf2c_l2_start, __jdf2c_l2_end);
+      __jdf2c_l2_min = parsec_imin(__jdf2c_l2_min, __l2_min);
+      __jdf2c_l2_max = parsec_imax(__jdf2c_l2_max, __l2_max);
+      for(l2 =  __jdf2c_l2_start;
+          l2 <= __jdf2c_l2_end;
+          l2 += __jdf2c_l2_inc) {
+      assignments.l2.value = l2;
+      if( !tC_pred(l1, l2) ) continue;
+      nb_tasks++;
+    } /* Loop on normal range l2 */
+  } /* For loop of l1 */ 
+   if( 0 != nb_tasks ) {
+     (void)parsec_atomic_fetch_add_int32(&__parsec_tp->initial_number_tasks, nb_tasks);
+   }
+  /* Set the range variables for the collision-free hash-computation */
+  __parsec_tp->tC_l1_min   = __jdf2c_l1_min;
+  __parsec_tp->tC_l1_range = (__jdf2c_l1_max - __jdf2c_l1_min) + 1;
+  __parsec_tp->tC_l2_min   = __jdf2c_l2_min;
+  __parsec_tp->tC_l2_range = (__jdf2c_l2_max - __jdf2c_l2_min) + 1;
+  this_task->status = PARSEC_TASK_STATUS_COMPLETE;
+
+  PARSEC_AYU_REGISTER_TASK(&local_indices_tC);
+  __parsec_tp->super.super.dependencies_array[4] = PARSEC_OBJ_NEW(parsec_hash_table_t);
+  parsec_hash_table_init(__parsec_tp->super.super.dependencies_array[4], offsetof(parsec_hashable_dependency_t, ht_item), 10, local_indices_local_indices_tC_internal_init_deps_key_functions, this_task->taskpool);
+  __parsec_tp->repositories[4] = data_repo_create_nothreadsafe(nb_tasks, __jdf2c_key_fns_tC, (parsec_taskpool_t*)__parsec_tp, 1);
+(void)saved_nb_tasks;
+(void)__l1_min; (void)__l1_max;(void)__l2_min; (void)__l2_max;  (void)__jdf2c_l1_start; (void)__jdf2c_l1_end; (void)__jdf2c_l1_inc;  (void)__jdf2c_l2_start; (void)__jdf2c_l2_end; (void)__jdf2c_l2_inc;  (void)assignments; (void)__parsec_tp; (void)es;
+  if(1 == parsec_atomic_fetch_dec_int32(&__parsec_tp->sync_point)) {
+    /* Last initialization task complete. Update the number of tasks. */
+    __parsec_tp->super.super.tdm.module->taskpool_addto_nb_tasks(&__parsec_tp->super.super, __parsec_tp->initial_number_tasks);
+    parsec_mfence();  /* write memory barrier to guarantee that the scheduler gets the correct number of tasks */
+    parsec_taskpool_enable((parsec_taskpool_t*)__parsec_tp, &__parsec_tp->startup_queue,
+                           (parsec_task_t*)this_task, es, __parsec_tp->super.super.nb_pending_actions);
+    __parsec_tp->super.super.tdm.module->taskpool_ready(&__parsec_tp->super.super);
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+    PARSEC_PROFILING_TRACE(es->es_profile,
+                           this_task->taskpool->profiling_array[2 * this_task->task_class->task_class_id + 1],
+                           0,
+                           this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    return PARSEC_HOOK_RETURN_DONE;
+  }
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static const __parsec_chore_t __local_indices_tC_chores[] ={
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+    { .type     = PARSEC_DEV_CPU,
+      .evaluate = (parsec_evaluate_function_t*)NULL,
+      .hook     = (parsec_hook_t*)hook_of_local_indices_tC },
+#endif  /* defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+    { .type     = PARSEC_DEV_NONE,
+      .evaluate = NULL,
+      .hook     = (parsec_hook_t*)NULL },  /* End marker */
+};
+
+static const parsec_task_class_t local_indices_tC = {
+  .name = "tC",
+  .task_class_id = 4,
+  .nb_flows = 1,
+  .nb_parameters = 2,
+  .nb_locals = 2,
+  .task_class_type = PARSEC_TASK_CLASS_TYPE_PTG,
+  .params = { &symb_local_indices_tC_l1, &symb_local_indices_tC_l2, NULL },
+  .locals = { &symb_local_indices_tC_l1, &symb_local_indices_tC_l2, NULL },
+  .data_affinity = (parsec_data_ref_fn_t*)affinity_of_local_indices_tC,
+  .initial_data = (parsec_data_ref_fn_t*)affinity_of_local_indices_tC,
+  .final_data = (parsec_data_ref_fn_t*)affinity_of_local_indices_tC,
+  .priority = NULL,
+  .properties = properties_of_local_indices_tC,
+#if MAX_PARAM_COUNT < 1  /* number of read flows of tC */
+  #error Too many read flows for task tC
+#endif  /* MAX_PARAM_COUNT */
+#if MAX_PARAM_COUNT < 0  /* number of write flows of tC */
+  #error Too many write flows for task tC
+#endif  /* MAX_PARAM_COUNT */
+  .in = { &flow_of_local_indices_tC_for_A, NULL },
+  .out = { NULL },
+  .flags = 0x0 | PARSEC_USE_DEPS_MASK,
+  .dependencies_goal = 0x1,
+  .make_key = __jdf2c_make_key_tC,
+  .task_snprintf = parsec_task_snprintf,
+#if defined(PARSEC_PROF_TRACE)
+  .profile_info = &parsec_task_profile_info,
+#endif
+  .key_functions = &__jdf2c_key_fns_tC,
+  .fini = (parsec_hook_t*)NULL,
+  .incarnations = __local_indices_tC_chores,
+  .find_deps = parsec_hash_find_deps,
+  .update_deps = parsec_update_deps_with_mask,
+  .iterate_successors = (parsec_traverse_function_t*)NULL,
+  .iterate_predecessors = (parsec_traverse_function_t*)iterate_predecessors_of_local_indices_tC,
+  .release_deps = (parsec_release_deps_t*)release_deps_of_local_indices_tC,
+  .prepare_output = (parsec_hook_t*)NULL,
+  .prepare_input = (parsec_hook_t*)data_lookup_of_local_indices_tC,
+  .time_estimate = NULL,
+  .get_datatype = datatype_lookup_of_local_indices_tC,
+  .complete_execution = (parsec_hook_t*)complete_hook_of_local_indices_tC,
+  .release_task = &release_task_of_local_indices_tC,
+#if defined(PARSEC_SIM)
+  .sim_cost_fct = (parsec_sim_cost_fct_t*)NULL,
+#endif
+};
+
+
+/******                                      tB                                      ******/
+
+static inline int32_t rangemin_of_expr_of_symb_local_indices_tB_o_fct(const __parsec_local_indices_internal_taskpool_t *__parsec_tp, __parsec_local_indices_tB_parsec_assignment_t *locals)
+{
+  int32_t __parsec_ret;
+  const int o = locals->o.value; (void)o;
+  const int e = locals->e.value; (void)e;
+  const int i = locals->i.value; (void)i;
+  const int j = locals->j.value; (void)j;
+
+  { /* New scope for local definition 'k' */ 
+    int k = 0;
+    locals->ldef[0].value = k;
+  __parsec_ret = ((2 * k) + 1);
+  }
+  (void)__parsec_tp;
+  return __parsec_ret;
+}
+static const parsec_expr_t rangemin_of_expr_of_symb_local_indices_tB_o = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)rangemin_of_expr_of_symb_local_indices_tB_o_fct }
+                   }
+};
+static inline int32_t rangemax_of_expr_of_symb_local_indices_tB_o_fct(const __parsec_local_indices_internal_taskpool_t *__parsec_tp, __parsec_local_indices_tB_parsec_assignment_t *locals)
+{
+  int32_t __parsec_ret;
+  const int o = locals->o.value; (void)o;
+  const int e = locals->e.value; (void)e;
+  const int i = locals->i.value; (void)i;
+  const int j = locals->j.value; (void)j;
+
+  { /* New scope for local definition 'k' */ 
+    int k = 4;
+    locals->ldef[0].value = k;
+  __parsec_ret = ((2 * k) + 1);
+  }
+  (void)__parsec_tp; (void)locals;
+  return __parsec_ret;
+}
+static const parsec_expr_t rangemax_of_expr_of_symb_local_indices_tB_o = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)rangemax_of_expr_of_symb_local_indices_tB_o_fct }
+                   }
+};
+static inline int32_t rangeincrement_of_expr_of_symb_local_indices_tB_o_fct(const __parsec_local_indices_internal_taskpool_t *__parsec_tp, __parsec_local_indices_tB_parsec_assignment_t *locals)
+{
+  int32_t __parsec_ret;
+  const int o = locals->o.value; (void)o;
+  const int e = locals->e.value; (void)e;
+  const int i = locals->i.value; (void)i;
+  const int j = locals->j.value; (void)j;
+
+  { /* New scope for local index 'k' */ 
+    int k = locals->ldef[0].value;
+    k += 1;
+    locals->ldef[0].value = k;
+  __parsec_ret = ((2 * k) + 1);
+  }
+  (void)__parsec_tp;
+  return __parsec_ret;
+}
+static const parsec_expr_t rangeincrement_of_expr_of_symb_local_indices_tB_o = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)rangeincrement_of_expr_of_symb_local_indices_tB_o_fct }
+                   }
+};
+static const parsec_expr_t expr_of_symb_local_indices_tB_o = {
+  .op = PARSEC_EXPR_OP_RANGE_EXPR_INCREMENT,
+  .u_expr.range = {
+    .op1 = &rangemin_of_expr_of_symb_local_indices_tB_o,
+    .op2 = &rangemax_of_expr_of_symb_local_indices_tB_o,
+    .increment.expr = &rangeincrement_of_expr_of_symb_local_indices_tB_o
+  }
+};
+static const parsec_symbol_t symb_local_indices_tB_o = { .name = "o", .context_index = 0, .min = &expr_of_symb_local_indices_tB_o, .max = &expr_of_symb_local_indices_tB_o, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t rangemin_of_expr_of_symb_local_indices_tB_e_fct(const __parsec_local_indices_internal_taskpool_t *__parsec_tp, __parsec_local_indices_tB_parsec_assignment_t *locals)
+{
+  int32_t __parsec_ret;
+  const int o = locals->o.value; (void)o;
+  const int e = locals->e.value; (void)e;
+  const int i = locals->i.value; (void)i;
+  const int j = locals->j.value; (void)j;
+
+  { /* New scope for local definition 'k' */ 
+    int k = 0;
+    locals->ldef[1].value = k;
+  __parsec_ret = (2 * k);
+  }
+  (void)__parsec_tp;
+  return __parsec_ret;
+}
+static const parsec_expr_t rangemin_of_expr_of_symb_local_indices_tB_e = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)rangemin_of_expr_of_symb_local_indices_tB_e_fct }
+                   }
+};
+static inline int32_t rangemax_of_expr_of_symb_local_indices_tB_e_fct(const __parsec_local_indices_internal_taskpool_t *__parsec_tp, __parsec_local_indices_tB_parsec_assignment_t *locals)
+{
+  int32_t __parsec_ret;
+  const int o = locals->o.value; (void)o;
+  const int e = locals->e.value; (void)e;
+  const int i = locals->i.value; (void)i;
+  const int j = locals->j.value; (void)j;
+
+  { /* New scope for local definition 'k' */ 
+    int k = 4;
+    locals->ldef[1].value = k;
+  __parsec_ret = (2 * k);
+  }
+  (void)__parsec_tp; (void)locals;
+  return __parsec_ret;
+}
+static const parsec_expr_t rangemax_of_expr_of_symb_local_indices_tB_e = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)rangemax_of_expr_of_symb_local_indices_tB_e_fct }
+                   }
+};
+static inline int32_t rangeincrement_of_expr_of_symb_local_indices_tB_e_fct(const __parsec_local_indices_internal_taskpool_t *__parsec_tp, __parsec_local_indices_tB_parsec_assignment_t *locals)
+{
+  int32_t __parsec_ret;
+  const int o = locals->o.value; (void)o;
+  const int e = locals->e.value; (void)e;
+  const int i = locals->i.value; (void)i;
+  const int j = locals->j.value; (void)j;
+
+  { /* New scope for local index 'k' */ 
+    int k = locals->ldef[1].value;
+    k += 1;
+    locals->ldef[1].value = k;
+  __parsec_ret = (2 * k);
+  }
+  (void)__parsec_tp;
+  return __parsec_ret;
+}
+static const parsec_expr_t rangeincrement_of_expr_of_symb_local_indices_tB_e = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)rangeincrement_of_expr_of_symb_local_indices_tB_e_fct }
+                   }
+};
+static const parsec_expr_t expr_of_symb_local_indices_tB_e = {
+  .op = PARSEC_EXPR_OP_RANGE_EXPR_INCREMENT,
+  .u_expr.range = {
+    .op1 = &rangemin_of_expr_of_symb_local_indices_tB_e,
+    .op2 = &rangemax_of_expr_of_symb_local_indices_tB_e,
+    .increment.expr = &rangeincrement_of_expr_of_symb_local_indices_tB_e
+  }
+};
+static const parsec_symbol_t symb_local_indices_tB_e = { .name = "e", .context_index = 1, .min = &expr_of_symb_local_indices_tB_e, .max = &expr_of_symb_local_indices_tB_e, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t minexpr_of_symb_local_indices_tB_i_fct(const __parsec_local_indices_internal_taskpool_t *__parsec_tp, const __parsec_local_indices_tB_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 6;
+}
+static const parsec_expr_t minexpr_of_symb_local_indices_tB_i = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_local_indices_tB_i_fct }
+                   }
+};
+static inline int maxexpr_of_symb_local_indices_tB_i_fct(const __parsec_local_indices_internal_taskpool_t *__parsec_tp, const __parsec_local_indices_tB_parsec_assignment_t *locals)
+{
+  const int o = locals->o.value;
+  const int e = locals->e.value; (void)e;
+  const int i = locals->i.value; (void)i;
+  const int j = locals->j.value; (void)j;
+
+  (void)o;
+  (void)e;
+  (void)i;
+  (void)j;
+  (void)__parsec_tp; (void)locals;
+  return o;
+}
+static const parsec_expr_t maxexpr_of_symb_local_indices_tB_i = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_local_indices_tB_i_fct }
+                   }
+};
+static const parsec_symbol_t symb_local_indices_tB_i = { .name = "i", .context_index = 2, .min = &minexpr_of_symb_local_indices_tB_i, .max = &maxexpr_of_symb_local_indices_tB_i, .cst_inc = 1, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t minexpr_of_symb_local_indices_tB_j_fct(const __parsec_local_indices_internal_taskpool_t *__parsec_tp, const __parsec_local_indices_tB_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_local_indices_tB_j = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_local_indices_tB_j_fct }
+                   }
+};
+static inline int maxexpr_of_symb_local_indices_tB_j_fct(const __parsec_local_indices_internal_taskpool_t *__parsec_tp, const __parsec_local_indices_tB_parsec_assignment_t *locals)
+{
+  const int o = locals->o.value; (void)o;
+  const int e = locals->e.value;
+  const int i = locals->i.value; (void)i;
+  const int j = locals->j.value; (void)j;
+
+  (void)o;
+  (void)e;
+  (void)i;
+  (void)j;
+  (void)__parsec_tp; (void)locals;
+  return (e / 2);
+}
+static const parsec_expr_t maxexpr_of_symb_local_indices_tB_j = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_local_indices_tB_j_fct }
+                   }
+};
+static const parsec_symbol_t symb_local_indices_tB_j = { .name = "j", .context_index = 3, .min = &minexpr_of_symb_local_indices_tB_j, .max = &maxexpr_of_symb_local_indices_tB_j, .cst_inc = 1, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int affinity_of_local_indices_tB(const __parsec_local_indices_tB_task_t *this_task,
+                     parsec_data_ref_t *ref)
+{
+    const __parsec_local_indices_internal_taskpool_t *__parsec_tp = (const __parsec_local_indices_internal_taskpool_t*)this_task->taskpool;
+  const int o = this_task->locals.o.value; (void)o;
+  const int e = this_task->locals.e.value; (void)e;
+  const int i = this_task->locals.i.value; (void)i;
+  const int j = this_task->locals.j.value; (void)j;
+
+  /* Silent Warnings: should look into predicate to know what variables are usefull */
+  (void)o;
+  (void)e;
+  (void)i;
+  (void)j;
+  ref->dc = (parsec_data_collection_t *)__parsec_tp->super._g_descA;
+  /* Compute data key */
+  ref->key = ref->dc->data_key(ref->dc, (i % descA->super.mt), (j % descA->super.nt));
+  return 1;
+}
+static const parsec_property_t properties_of_local_indices_tB[1] = {
+  {.name = NULL, .expr = NULL}
+};
+static const parsec_dep_t flow_of_local_indices_tB_for_A_dep1_atline_89 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 0, /* local_indices_STARTUP */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_local_indices_STARTUP_for_A,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_local_indices_tB_for_A,
+};
+static inline int expr_of_cond_for_flow_of_local_indices_tB_for_A_dep2_atline_90_fct(const __parsec_local_indices_internal_taskpool_t *__parsec_tp, const __parsec_local_indices_tB_parsec_assignment_t *locals)
+{
+  const int o = locals->o.value; (void)o;
+  const int e = locals->e.value; (void)e;
+  const int i = locals->i.value; (void)i;
+  const int j = locals->j.value; (void)j;
+
+  (void)o;
+  (void)e;
+  (void)i;
+  (void)j;
+  (void)__parsec_tp; (void)locals;
+  return ((((o) == (7) && (e) == (0)) && (i) == (7)) && (j) == (0));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_local_indices_tB_for_A_dep2_atline_90 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_local_indices_tB_for_A_dep2_atline_90_fct }
+                   }
+};
+static const parsec_dep_t flow_of_local_indices_tB_for_A_dep2_atline_90 = {
+  .cond = &expr_of_cond_for_flow_of_local_indices_tB_for_A_dep2_atline_90,  /* ((((o) == (7) && (e) == (0)) && (i) == (7)) && (j) == (0)) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 4, /* local_indices_tC */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_local_indices_tC_for_A,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_local_indices_tB_for_A,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+#if MAX_DEP_OUT_COUNT < 1  /* number of output dependencies */
+    #error Too many output dependencies (supports up to MAX_DEP_OUT_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_OUT_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_local_indices_tB_for_A = {
+  .name               = "A",
+  .sym_type           = PARSEC_SYM_INOUT,
+  .flow_flags         = PARSEC_FLOW_ACCESS_READ,
+  .flow_index         = 0,
+  .flow_datatype_mask = 0x1,
+  .dep_in     = { &flow_of_local_indices_tB_for_A_dep1_atline_89 },
+  .dep_out    = { &flow_of_local_indices_tB_for_A_dep2_atline_90 }
+};
+
+static void
+iterate_successors_of_local_indices_tB(parsec_execution_stream_t *es, const __parsec_local_indices_tB_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_local_indices_internal_taskpool_t *__parsec_tp = (const __parsec_local_indices_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_local_indices_tB_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_local_indices_tB_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int o = __jdf2c__tmp_locals.o.value; (void)o;
+  const int e = __jdf2c__tmp_locals.e.value; (void)e;
+  const int i = __jdf2c__tmp_locals.i.value; (void)i;
+  const int j = __jdf2c__tmp_locals.j.value; (void)j;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)o;  (void)e;  (void)i;  (void)j;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_descA((i % descA->super.mt), (j % descA->super.nt));
+#endif
+  if( action_mask & 0x1 ) {  /* Flow of data A [0] */
+    data.data   = this_task->data._f_A.data_out;
+    data.data_future  = NULL;
+    if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_local_indices_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_local_indices_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+       if( ((((o) == (7) && (e) == (0)) && (i) == (7)) && (j) == (0)) ) {
+      __parsec_local_indices_tC_task_t* ncc = (__parsec_local_indices_tC_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[local_indices_tC.task_class_id];
+        int l;
+      for( l = 1;l <= 2; l+=1) {
+        __jdf2c__tmp_locals.ldef[2].value = l;
+          const int tC_l1 = l;
+          if( (tC_l1 >= (1)) && (tC_l1 <= (2)) ) {
+            assert(&nc.locals[0].value == &ncc->locals.l1.value);
+            ncc->locals.l1.value = tC_l1;
+            int tC_l2;
+          for( tC_l2 = (2 * l);tC_l2 <= (3 * l); tC_l2+=1) {
+              if( (tC_l2 >= ((2 * ncc->locals.l1.value))) && (tC_l2 <= ((3 * ncc->locals.l1.value))) ) {
+                assert(&nc.locals[1].value == &ncc->locals.l2.value);
+                ncc->locals.l2.value = tC_l2;
+#if defined(DISTRIBUTED)
+                rank_dst = rank_of_descA((ncc->locals.l1.value % descA->super.mt), (ncc->locals.l2.value % descA->super.nt));
+                if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+                  vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, (ncc->locals.l1.value % descA->super.mt), (ncc->locals.l2.value % descA->super.nt));
+                nc.priority = __parsec_tp->super.super.priority;
+                successor_repo = tC_repo;
+                successor_repo_key = __jdf2c_make_key_tC((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+              RELEASE_DEP_OUTPUT(es, "A", this_task, "A", &nc, rank_src, rank_dst, &data);
+              if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_local_indices_tB_for_A_dep2_atline_90, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+                }
+              }
+            }
+          }
+    }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static void
+iterate_predecessors_of_local_indices_tB(parsec_execution_stream_t *es, const __parsec_local_indices_tB_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_local_indices_internal_taskpool_t *__parsec_tp = (const __parsec_local_indices_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_local_indices_tB_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_local_indices_tB_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int o = __jdf2c__tmp_locals.o.value; (void)o;
+  const int e = __jdf2c__tmp_locals.e.value; (void)e;
+  const int i = __jdf2c__tmp_locals.i.value; (void)i;
+  const int j = __jdf2c__tmp_locals.j.value; (void)j;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)o;  (void)e;  (void)i;  (void)j;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_descA((i % descA->super.mt), (j % descA->super.nt));
+#endif
+  if( action_mask & 0x1 ) {  /* Flow of data A [0] */
+    data.data   = this_task->data._f_A.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x1 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_local_indices_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_local_indices_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        __parsec_local_indices_STARTUP_task_t* ncc = (__parsec_local_indices_STARTUP_task_t*)&nc;
+    nc.task_class = __parsec_tp->super.super.task_classes_array[local_indices_STARTUP.task_class_id];
+      const int STARTUP_odd = o;
+      /* We cannot check if STARTUP_odd is within the iterator space, because that space is defined with local indices. We need to trust */
+      assert(&nc.locals[0].value == &ncc->locals.odd.value);
+      ncc->locals.odd.value = STARTUP_odd;
+      const int STARTUP_even = e;
+      /* We cannot check if STARTUP_even is within the iterator space, because that space is defined with local indices. We need to trust */
+      assert(&nc.locals[1].value == &ncc->locals.even.value);
+      ncc->locals.even.value = STARTUP_even;
+#if defined(DISTRIBUTED)
+      rank_dst = rank_of_descA(((ncc->locals.odd.value / 2) % descA->super.mt), ((ncc->locals.even.value / 2) % descA->super.nt));
+      if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+        vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, ((ncc->locals.odd.value / 2) % descA->super.mt), ((ncc->locals.even.value / 2) % descA->super.nt));
+      nc.priority = __parsec_tp->super.super.priority;
+      successor_repo = STARTUP_repo;
+      successor_repo_key = __jdf2c_make_key_STARTUP((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+    RELEASE_DEP_OUTPUT(es, "A", this_task, "A", &nc, rank_src, rank_dst, &data);
+    if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_local_indices_tB_for_A_dep1_atline_89, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+  }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static int release_deps_of_local_indices_tB(parsec_execution_stream_t *es, __parsec_local_indices_tB_task_t *this_task, uint32_t action_mask, parsec_remote_deps_t *deps)
+{
+  PARSEC_PINS(es, RELEASE_DEPS_BEGIN, (parsec_task_t *)this_task);  const __parsec_local_indices_internal_taskpool_t *__parsec_tp = (const __parsec_local_indices_internal_taskpool_t *)this_task->taskpool;
+  parsec_release_dep_fct_arg_t arg;
+  int __vp_id;
+  int consume_local_repo = 0;
+  arg.action_mask = action_mask;
+  arg.output_entry = NULL;
+  arg.output_repo = NULL;
+#if defined(DISTRIBUTED)
+  arg.remote_deps = deps;
+#endif  /* defined(DISTRIBUTED) */
+  assert(NULL != es);
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS )    arg.ready_lists = alloca(sizeof(parsec_task_t *) * es->virtual_process->parsec_context->nb_vp);
+  else
+    arg.ready_lists = NULL;
+  for( __vp_id = 0; __vp_id < es->virtual_process->parsec_context->nb_vp; arg.ready_lists[__vp_id++] = NULL );
+  (void)__parsec_tp; (void)deps;
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_A.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_A.source_repo, this_task->data._f_A.source_repo_entry->ht_item.key );
+    }
+  }
+  consume_local_repo = (this_task->repo_entry != NULL);
+  arg.output_repo = tB_repo;
+  arg.output_entry = this_task->repo_entry;
+  arg.output_usage = 0;
+  if( action_mask & (PARSEC_ACTION_RELEASE_LOCAL_DEPS | PARSEC_ACTION_GET_REPO_ENTRY) ) {
+    arg.output_entry = data_repo_lookup_entry_and_create( es, arg.output_repo, __jdf2c_make_key_tB((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    arg.output_entry->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(arg.output_entry->sim_exec_date == 0);
+    arg.output_entry->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  if(action_mask & ( PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE ) ){
+    /* Generate the reshape promise for the outputs that need it */
+    iterate_successors_of_local_indices_tB(es, this_task, action_mask, parsec_set_up_reshape_promise, &arg);
+   }
+  iterate_successors_of_local_indices_tB(es, this_task, action_mask, parsec_release_dep_fct, &arg);
+
+#if defined(DISTRIBUTED)
+  if( (action_mask & PARSEC_ACTION_SEND_REMOTE_DEPS) && (NULL != arg.remote_deps)) {
+    parsec_remote_dep_activate(es, (parsec_task_t *)this_task, arg.remote_deps, arg.remote_deps->outgoing_mask);
+  }
+#endif
+
+  if(action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS) {
+    data_repo_entry_addto_usage_limit(tB_repo, arg.output_entry->ht_item.key, arg.output_usage);
+    __parsec_schedule_vp(es, arg.ready_lists, 0);
+  }
+      if (consume_local_repo) {
+         data_repo_entry_used_once( tB_repo, this_task->repo_entry->ht_item.key );
+      }
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_A.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_A.data_in);
+    }
+  }
+  PARSEC_PINS(es, RELEASE_DEPS_END, (parsec_task_t *)this_task);  return 0;
+}
+
+static int data_lookup_of_local_indices_tB(parsec_execution_stream_t *es, __parsec_local_indices_tB_task_t *this_task)
+{
+  const __parsec_local_indices_internal_taskpool_t *__parsec_tp = (__parsec_local_indices_internal_taskpool_t *)this_task->taskpool;
+  parsec_assignment_t generic_locals[MAX_PARAM_COUNT];  /* generic task locals */
+  int target_device = 0; (void)target_device;
+  (void)__parsec_tp; (void)generic_locals; (void)es;
+  parsec_data_copy_t *chunk = NULL;
+  data_repo_t        *reshape_repo  = NULL, *consumed_repo  = NULL;
+  data_repo_entry_t  *reshape_entry = NULL, *consumed_entry = NULL;
+  parsec_key_t        reshape_entry_key = 0, consumed_entry_key = 0;
+  uint8_t             consumed_flow_index;
+  parsec_dep_data_description_t data;
+  int ret;
+  (void)reshape_repo; (void)reshape_entry; (void)reshape_entry_key;
+  (void)consumed_repo; (void)consumed_entry; (void)consumed_entry_key;
+  (void)consumed_flow_index;
+  (void)chunk; (void)data; (void)ret;
+  const int o = this_task->locals.o.value; (void)o;
+  const int e = this_task->locals.e.value; (void)e;
+  const int i = this_task->locals.i.value; (void)i;
+  const int j = this_task->locals.j.value; (void)j;
+  if( NULL == this_task->repo_entry ){
+    this_task->repo_entry = data_repo_lookup_entry_and_create(es, tB_repo,                                       __jdf2c_make_key_tB((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    data_repo_entry_addto_usage_limit(tB_repo, this_task->repo_entry->ht_item.key, 1);    this_task->repo_entry ->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(this_task->repo_entry ->sim_exec_date == 0);
+    this_task->repo_entry ->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  /* The reshape repo is the current task repo. */  reshape_repo = tB_repo;
+  reshape_entry_key = __jdf2c_make_key_tB((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals) ;
+  reshape_entry = this_task->repo_entry;
+  /* Lookup the input data, and store them in the context if any */
+
+if(! this_task->data._f_A.fulfill ){ /* Flow A */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_A.data_out = NULL;  /* By default, if nothing matches */
+  /* Flow A [0] dependency [0] from predecessor STARTUP */
+  if( NULL == (chunk = this_task->data._f_A.data_in) ) {
+  /* No data set up by predecessor on this task input flow */
+__parsec_local_indices_STARTUP_parsec_assignment_t *target_locals = (__parsec_local_indices_STARTUP_parsec_assignment_t*)&generic_locals;
+  const int STARTUPodd = target_locals->odd.value = o; (void)STARTUPodd;
+  const int STARTUPeven = target_locals->even.value = e; (void)STARTUPeven;
+    if( (reshape_entry != NULL) && (reshape_entry->data[0] != NULL) ){
+        /* Reshape promise set up on this task repo by predecessor */
+        consumed_repo = reshape_repo;
+        consumed_entry = reshape_entry;
+        consumed_entry_key = reshape_entry_key;
+        consumed_flow_index = 0;
+    }else{
+        /* Consume from predecessor's repo */
+        consumed_repo = STARTUP_repo;
+        consumed_entry_key = __jdf2c_make_key_STARTUP((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)target_locals) ;
+        consumed_entry = data_repo_lookup_entry( consumed_repo, consumed_entry_key );
+        consumed_flow_index = 0;
+    }
+    data.data   = NULL;
+    data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+        data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    ACQUIRE_FLOW(this_task, "A", &local_indices_STARTUP, "A", target_locals, chunk);
+    this_task->data._f_A.data_out = chunk;
+  } 
+  else {
+    /* Data set up by predecessor on this task input flow */
+    consumed_repo = this_task->data._f_A.source_repo;
+    consumed_entry = this_task->data._f_A.source_repo_entry;
+    consumed_entry_key = this_task->data._f_A.source_repo_entry->ht_item.key;
+    if( (reshape_entry != NULL) && (reshape_entry->data[0] != NULL) ){
+        /* Reshape promise set up on input by predecessor is on this task repo */
+        consumed_flow_index = 0;
+        assert( (this_task->data._f_A.source_repo == reshape_repo)
+             && (this_task->data._f_A.source_repo_entry == reshape_entry));
+    }else{
+        /* Reshape promise set up on input by predecessor is the predecesssor task repo */
+        consumed_flow_index = 0;
+    }
+    data.data   = NULL;
+    data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+        data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    this_task->data._f_A.data_out = parsec_data_get_copy(chunk->original, target_device);
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+    parsec_prof_grapher_data_input(chunk->original, (parsec_task_t*)this_task, &flow_of_local_indices_tB_for_A, 0);
+#endif
+  }
+    this_task->data._f_A.data_in     = chunk;
+    this_task->data._f_A.source_repo       = consumed_repo;
+    this_task->data._f_A.source_repo_entry = consumed_entry;
+    if( this_task->data._f_A.source_repo_entry == this_task->repo_entry ){
+      /* in case we have consume from this task repo entry for the flow,
+       * it is cleaned up, avoiding having old stuff during release_deps_of
+       */
+      this_task->repo_entry->data[0] = NULL;
+    }
+    this_task->data._f_A.fulfill = 1;
+}
+
+  /** Generate profiling information */
+#if defined(PARSEC_PROF_TRACE)
+  this_task->prof_info.desc = (parsec_data_collection_t*)__parsec_tp->super._g_descA;
+  this_task->prof_info.priority = this_task->priority;
+  this_task->prof_info.data_id   = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->data_key((parsec_data_collection_t*)__parsec_tp->super._g_descA, (i % descA->super.mt), (j % descA->super.nt));
+  this_task->prof_info.task_class_id = this_task->task_class->task_class_id;
+  this_task->prof_info.task_return_code = -1;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int datatype_lookup_of_local_indices_tB(parsec_execution_stream_t *es, const parsec_task_t *this_generic_task, const parsec_task_t *parent_task,
+              uint32_t* flow_mask, parsec_dep_data_description_t* data)
+{
+  const __parsec_local_indices_tB_task_t *this_task = (__parsec_local_indices_tB_task_t*)this_generic_task;
+  const __parsec_local_indices_internal_taskpool_t *__parsec_tp = (__parsec_local_indices_internal_taskpool_t *)this_task->taskpool;
+  (void)__parsec_tp; (void)es; (void)this_task; (void)data; (void)parent_task;
+  const int o = this_task->locals.o.value; (void)o;
+  const int e = this_task->locals.e.value; (void)e;
+  const int i = this_task->locals.i.value; (void)i;
+  const int j = this_task->locals.j.value; (void)j;
+  data->local.arena = data->remote.arena = NULL;
+  data->local.src_datatype  = data->local.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->local.src_count     = data->local.dst_count = 0;
+  data->local.src_displ     = data->local.dst_displ = 0;
+  data->data_future  = NULL;
+  if( (*flow_mask) & 0x80000000U ) { /* these are the input dependencies remote datatypes  */
+if( (*flow_mask) & 0x1U ) {  /* Flow A */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_local_indices_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_local_indices_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_local_indices_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+    goto no_mask_match;
+  }
+
+  /* these are the output dependencies remote datatypes */
+if( (*flow_mask) & 0x1U ) {  /* Flow A */
+    if( ((*flow_mask) & 0x1U)
+ && (((((o) == (7) && (e) == (0)) && (i) == (7)) && (j) == (0))) ) {
+    data->remote.arena  =  PARSEC_local_indices_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_local_indices_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_local_indices_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+ no_mask_match:
+  data->data                             = NULL;
+  data->remote.src_datatype = data->remote.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->remote.src_count    = data->remote.dst_count = 0;
+  data->remote.src_displ    = data->remote.dst_displ = 0;
+  data->data_future  = NULL;
+  (*flow_mask) = 0;  /* nothing left */
+  (void)o;  (void)e;  (void)i;  (void)j;
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+static int hook_of_local_indices_tB(parsec_execution_stream_t *es, __parsec_local_indices_tB_task_t *this_task)
+{
+  __parsec_local_indices_internal_taskpool_t *__parsec_tp = (__parsec_local_indices_internal_taskpool_t *)this_task->taskpool;
+  (void)es; (void)__parsec_tp;
+  const int o = this_task->locals.o.value; (void)o;
+  const int e = this_task->locals.e.value; (void)e;
+  const int i = this_task->locals.i.value; (void)i;
+  const int j = this_task->locals.j.value; (void)j;
+  (void)o;  (void)e;  (void)i;  (void)j;
+
+  /** Declare the variables that will hold the data, and all the accounting for each */
+  parsec_data_copy_t *_f_A = this_task->data._f_A.data_in;
+  void *A = PARSEC_DATA_COPY_GET_PTR(_f_A); (void)A;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    data_repo_entry_t *eA = this_task->data._f_A.source_repo_entry;
+    if( (NULL != eA) && (eA->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eA->sim_exec_date;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+  /** Cache Awareness Accounting */
+#if defined(PARSEC_CACHE_AWARENESS)
+  cache_buf_referenced(es->closest_cache, A);
+#endif /* PARSEC_CACHE_AWARENESS */
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                                    tB BODY                                    -----*/
+
+{
+   usleep( rand() % 50000 + 50000);
+   parsec_atomic_fetch_inc_int32(&nb_tasks_array[2]);
+}
+
+/*-----                                END OF tB BODY                                -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#endif  /*  defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+static int complete_hook_of_local_indices_tB(parsec_execution_stream_t *es, __parsec_local_indices_tB_task_t *this_task)
+{
+  const __parsec_local_indices_internal_taskpool_t *__parsec_tp = (__parsec_local_indices_internal_taskpool_t *)this_task->taskpool;
+#if defined(DISTRIBUTED)
+    const int o = this_task->locals.o.value; (void)o;
+  const int e = this_task->locals.e.value; (void)e;
+  const int i = this_task->locals.i.value; (void)i;
+  const int j = this_task->locals.j.value; (void)j;
+#endif  /* defined(DISTRIBUTED) */
+  (void)es; (void)__parsec_tp;
+parsec_data_t* data_t_desc = NULL; (void)data_t_desc;
+#if defined(DISTRIBUTED)
+  /** If not working on distributed, there is no risk that data is not in place */
+  (void)o;  (void)e;  (void)i;  (void)j;
+
+#endif /* DISTRIBUTED */
+#if defined(PARSEC_PROF_GRAPHER)
+  parsec_prof_grapher_task((parsec_task_t*)this_task, es->th_id, es->virtual_process->vp_id,
+     __jdf2c_key_fns_tB.key_hash(this_task->task_class->make_key( (parsec_taskpool_t*)this_task->taskpool, ((parsec_task_t*)this_task)->locals), NULL));
+#endif  /* defined(PARSEC_PROF_GRAPHER) */
+  release_deps_of_local_indices_tB(es, this_task,
+      PARSEC_ACTION_RELEASE_REMOTE_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_REFS |
+      PARSEC_ACTION_RESHAPE_ON_RELEASE |
+      0x1,  /* mask of all dep_index */ 
+      NULL);
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static parsec_hook_return_t release_task_of_local_indices_tB(parsec_execution_stream_t *es, parsec_task_t *this_task)
+{
+    const __parsec_local_indices_internal_taskpool_t *__parsec_tp =
+        (const __parsec_local_indices_internal_taskpool_t *)this_task->taskpool;
+    parsec_hash_table_t *ht = (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[3];
+    parsec_key_t key = this_task->task_class->make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals);
+    parsec_hashable_dependency_t *hash_dep = (parsec_hashable_dependency_t *)parsec_hash_table_remove(ht, key);
+    parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);
+    return parsec_release_task_to_mempool_update_nbtasks(es, this_task);
+}
+
+static char *local_indices_local_indices_tB_internal_init_deps_key_functions_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_local_indices_internal_taskpool_t *__parsec_tp = (__parsec_local_indices_internal_taskpool_t *)user_data;
+  __parsec_local_indices_tB_parsec_assignment_t __jdf2c__assignments = {  .o.value = 0, .e.value = 0, .i.value = 0, .j.value = 0 };
+  int o = (__parsec_key) % __parsec_tp->tB_o_range + __parsec_tp->tB_o_min;
+  __parsec_key = __parsec_key / __parsec_tp->tB_o_range;
+  __jdf2c__assignments.o.value = o;
+  int e = (__parsec_key) % __parsec_tp->tB_e_range + __parsec_tp->tB_e_min;
+  __parsec_key = __parsec_key / __parsec_tp->tB_e_range;
+  __jdf2c__assignments.e.value = e;
+  int i = (__parsec_key) % __parsec_tp->tB_i_range + __parsec_tp->tB_i_min;
+  __parsec_key = __parsec_key / __parsec_tp->tB_i_range;
+  __jdf2c__assignments.i.value = i;
+  int j = (__parsec_key) % __parsec_tp->tB_j_range + __parsec_tp->tB_j_min;
+  __parsec_key = __parsec_key / __parsec_tp->tB_j_range;
+  __jdf2c__assignments.j.value = j;
+  (void)__jdf2c__assignments;
+  snprintf(buffer, buffer_size, "tB(%d, %d, %d, %d)", o, e, i, j);
+  return buffer;
+}
+
+static parsec_key_fn_t local_indices_local_indices_tB_internal_init_deps_key_functions = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = local_indices_local_indices_tB_internal_init_deps_key_functions_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/* Needs: min-max count-tasks iterate */
+static int local_indices_tB_internal_init(parsec_execution_stream_t * es, __parsec_local_indices_tB_task_t * this_task)
+{
+  __parsec_local_indices_internal_taskpool_t *__parsec_tp = (__parsec_local_indices_internal_taskpool_t*)this_task->taskpool;
+  int32_t nb_tasks = 0, saved_nb_tasks = 0;
+int32_t __o_min = 0x7fffffff, __o_max = 0;int32_t __jdf2c_o_min = 0x7fffffff, __jdf2c_o_max = 0;int32_t __e_min = 0x7fffffff, __e_max = 0;int32_t __jdf2c_e_min = 0x7fffffff, __jdf2c_e_max = 0;int32_t __i_min = 0x7fffffff, __i_max = 0;int32_t __jdf2c_i_min = 0x7fffffff, __jdf2c_i_max = 0;int32_t __j_min = 0x7fffffff, __j_max = 0;int32_t __jdf2c_j_min = 0x7fffffff, __jdf2c_j_max = 0;  __parsec_local_indices_tB_parsec_assignment_t assignments = {  .o.value = 0, .e.value = 0, .i.value = 0, .j.value = 0 };
+  int32_t  o,  e,  i,  j;
+  int32_t __jdf2c_o_start, __jdf2c_o_end, __jdf2c_o_inc;
+  int32_t __jdf2c_e_start, __jdf2c_e_end, __jdf2c_e_inc;
+  int32_t __jdf2c_i_start, __jdf2c_i_end, __jdf2c_i_inc;
+  int32_t __jdf2c_j_start, __jdf2c_j_end, __jdf2c_j_inc;
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+  PARSEC_PROFILING_TRACE(es->es_profile,
+                         this_task->taskpool->profiling_array[START_KEY(this_task->task_class->task_class_id)],
+                         0,
+                         this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+  { /* block for the local variable 'k' */
+    int k;
+    for(assignments.ldef[0].value = k = 0; k <= 4; assignments.ldef[0].value = k += 1 ) { /* Iterator on k */ 
+        o = ((2 * k) + 1);
+        assignments.o.value = o;
+        { /* block for the local variable 'k' */
+          int k;
+          for(assignments.ldef[1].value = k = 0; k <= 4; assignments.ldef[1].value = k += 1 ) { /* Iterator on k */ 
+              e = (2 * k);
+              assignments.e.value = e;
+                __jdf2c_i_start = 6;
+                __jdf2c_i_end = o;
+                __jdf2c_i_inc = 1;
+                __i_min = parsec_imin(__jdf2c_i_start, __jdf2c_i_end);
+                __i_max = parsec_imax(__jdf2c_i_start, __jdf2c_i_end);
+                __jdf2c_i_min = parsec_imin(__jdf2c_i_min, __i_min);
+                __jdf2c_i_max = parsec_imax(__jdf2c_i_max, __i_max);
+                for(i =  __jdf2c_i_start;
+                    i <= __jdf2c_i_end;
+                    i += __jdf2c_i_inc) {
+                assignments.i.value = i;
+                  __jdf2c_j_start = 0;
+                  __jdf2c_j_end = (e / 2);
+                  __jdf2c_j_inc = 1;
+                  __j_min = parsec_imin(__jdf2c_j_start, __jdf2c_j_end);
+                  __j_max = parsec_imax(__jdf2c_j_start, __jdf2c_j_end);
+                  __jdf2c_j_min = parsec_imin(__jdf2c_j_min, __j_min);
+                  __jdf2c_j_max = parsec_imax(__jdf2c_j_max, __j_max);
+                  for(j =  __jdf2c_j_start;
+                      j <= __jdf2c_j_end;
+                      j += __jdf2c_j_inc) {
+                  assignments.j.value = j;
+                    __jdf2c_o_min = parsec_imin(__jdf2c_o_min, o);
+                    __jdf2c_o_max = parsec_imax(__jdf2c_o_max, o);
+                    __jdf2c_e_min = parsec_imin(__jdf2c_e_min, e);
+                    __jdf2c_e_max = parsec_imax(__jdf2c_e_max, e);
+                  if( !tB_pred(o, e, i, j) ) continue;
+                  nb_tasks++;
+                } /* Loop on normal range j */
+              } /* For loop of i */ 
+              assignments.ldef[1].value = k;
+              } /* Iterator on k */ 
+            } /* Block for local definition of k */ 
+          assignments.ldef[0].value = k;
+          } /* Iterator on k */ 
+        } /* Block for local definition of k */ 
+       if( 0 != nb_tasks ) {
+         (void)parsec_atomic_fetch_add_int32(&__parsec_tp->initial_number_tasks, nb_tasks);
+       }
+  /* Set the range variables for the collision-free hash-computation */
+  __parsec_tp->tB_o_min   = __jdf2c_o_min;
+  __parsec_tp->tB_o_range = (__jdf2c_o_max - __jdf2c_o_min) + 1;
+  __parsec_tp->tB_e_min   = __jdf2c_e_min;
+  __parsec_tp->tB_e_range = (__jdf2c_e_max - __jdf2c_e_min) + 1;
+  __parsec_tp->tB_i_min   = __jdf2c_i_min;
+  __parsec_tp->tB_i_range = (__jdf2c_i_max - __jdf2c_i_min) + 1;
+  __parsec_tp->tB_j_min   = __jdf2c_j_min;
+  __parsec_tp->tB_j_range = (__jdf2c_j_max - __jdf2c_j_min) + 1;
+  this_task->status = PARSEC_TASK_STATUS_COMPLETE;
+
+  PARSEC_AYU_REGISTER_TASK(&local_indices_tB);
+  __parsec_tp->super.super.dependencies_array[3] = PARSEC_OBJ_NEW(parsec_hash_table_t);
+  parsec_hash_table_init(__parsec_tp->super.super.dependencies_array[3], offsetof(parsec_hashable_dependency_t, ht_item), 10, local_indices_local_indices_tB_internal_init_deps_key_functions, this_task->taskpool);
+  __parsec_tp->repositories[3] = data_repo_create_nothreadsafe(nb_tasks, __jdf2c_key_fns_tB, (parsec_taskpool_t*)__parsec_tp, 1);
+(void)saved_nb_tasks;
+(void)__o_min; (void)__o_max;(void)__e_min; (void)__e_max;(void)__i_min; (void)__i_max;(void)__j_min; (void)__j_max;  (void)__jdf2c_o_start; (void)__jdf2c_o_end; (void)__jdf2c_o_inc;  (void)__jdf2c_e_start; (void)__jdf2c_e_end; (void)__jdf2c_e_inc;  (void)__jdf2c_i_start; (void)__jdf2c_i_end; (void)__jdf2c_i_inc;  (void)__jdf2c_j_start; (void)__jdf2c_j_end; (void)__jdf2c_j_inc;  (void)assignments; (void)__parsec_tp; (void)es;
+  if(1 == parsec_atomic_fetch_dec_int32(&__parsec_tp->sync_point)) {
+    /* Last initialization task complete. Update the number of tasks. */
+    __parsec_tp->super.super.tdm.module->taskpool_addto_nb_tasks(&__parsec_tp->super.super, __parsec_tp->initial_number_tasks);
+    parsec_mfence();  /* write memory barrier to guarantee that the scheduler gets the correct number of tasks */
+    parsec_taskpool_enable((parsec_taskpool_t*)__parsec_tp, &__parsec_tp->startup_queue,
+                           (parsec_task_t*)this_task, es, __parsec_tp->super.super.nb_pending_actions);
+    __parsec_tp->super.super.tdm.module->taskpool_ready(&__parsec_tp->super.super);
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+    PARSEC_PROFILING_TRACE(es->es_profile,
+                           this_task->taskpool->profiling_array[2 * this_task->task_class->task_class_id + 1],
+                           0,
+                           this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    return PARSEC_HOOK_RETURN_DONE;
+  }
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static const __parsec_chore_t __local_indices_tB_chores[] ={
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+    { .type     = PARSEC_DEV_CPU,
+      .evaluate = (parsec_evaluate_function_t*)NULL,
+      .hook     = (parsec_hook_t*)hook_of_local_indices_tB },
+#endif  /* defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+    { .type     = PARSEC_DEV_NONE,
+      .evaluate = NULL,
+      .hook     = (parsec_hook_t*)NULL },  /* End marker */
+};
+
+static const parsec_task_class_t local_indices_tB = {
+  .name = "tB",
+  .task_class_id = 3,
+  .nb_flows = 1,
+  .nb_parameters = 4,
+  .nb_locals = 4,
+  .task_class_type = PARSEC_TASK_CLASS_TYPE_PTG,
+  .params = { &symb_local_indices_tB_o, &symb_local_indices_tB_e, &symb_local_indices_tB_i, &symb_local_indices_tB_j, NULL },
+  .locals = { &symb_local_indices_tB_o, &symb_local_indices_tB_e, &symb_local_indices_tB_i, &symb_local_indices_tB_j, NULL },
+  .data_affinity = (parsec_data_ref_fn_t*)affinity_of_local_indices_tB,
+  .initial_data = (parsec_data_ref_fn_t*)affinity_of_local_indices_tB,
+  .final_data = (parsec_data_ref_fn_t*)affinity_of_local_indices_tB,
+  .priority = NULL,
+  .properties = properties_of_local_indices_tB,
+#if MAX_PARAM_COUNT < 1  /* number of read flows of tB */
+  #error Too many read flows for task tB
+#endif  /* MAX_PARAM_COUNT */
+#if MAX_PARAM_COUNT < 0  /* number of write flows of tB */
+  #error Too many write flows for task tB
+#endif  /* MAX_PARAM_COUNT */
+  .in = { &flow_of_local_indices_tB_for_A, NULL },
+  .out = { &flow_of_local_indices_tB_for_A, NULL },
+  .flags = 0x0 | PARSEC_USE_DEPS_MASK,
+  .dependencies_goal = 0x1,
+  .make_key = __jdf2c_make_key_tB,
+  .task_snprintf = parsec_task_snprintf,
+#if defined(PARSEC_PROF_TRACE)
+  .profile_info = &parsec_task_profile_info,
+#endif
+  .key_functions = &__jdf2c_key_fns_tB,
+  .fini = (parsec_hook_t*)NULL,
+  .incarnations = __local_indices_tB_chores,
+  .find_deps = parsec_hash_find_deps,
+  .update_deps = parsec_update_deps_with_mask,
+  .iterate_successors = (parsec_traverse_function_t*)iterate_successors_of_local_indices_tB,
+  .iterate_predecessors = (parsec_traverse_function_t*)iterate_predecessors_of_local_indices_tB,
+  .release_deps = (parsec_release_deps_t*)release_deps_of_local_indices_tB,
+  .prepare_output = (parsec_hook_t*)NULL,
+  .prepare_input = (parsec_hook_t*)data_lookup_of_local_indices_tB,
+  .time_estimate = NULL,
+  .get_datatype = datatype_lookup_of_local_indices_tB,
+  .complete_execution = (parsec_hook_t*)complete_hook_of_local_indices_tB,
+  .release_task = &release_task_of_local_indices_tB,
+#if defined(PARSEC_SIM)
+  .sim_cost_fct = (parsec_sim_cost_fct_t*)NULL,
+#endif
+};
+
+
+/******                                      tA                                      ******/
+
+static inline int32_t rangemin_of_expr_of_symb_local_indices_tA_o_fct(const __parsec_local_indices_internal_taskpool_t *__parsec_tp, __parsec_local_indices_tA_parsec_assignment_t *locals)
+{
+  int32_t __parsec_ret;
+  const int o = locals->o.value; (void)o;
+  const int e = locals->e.value; (void)e;
+  const int i = locals->i.value; (void)i;
+  const int j = locals->j.value; (void)j;
+
+  { /* New scope for local definition 'k' */ 
+    int k = 0;
+    locals->ldef[0].value = k;
+  __parsec_ret = ((2 * k) + 1);
+  }
+  (void)__parsec_tp;
+  return __parsec_ret;
+}
+static const parsec_expr_t rangemin_of_expr_of_symb_local_indices_tA_o = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)rangemin_of_expr_of_symb_local_indices_tA_o_fct }
+                   }
+};
+static inline int32_t rangemax_of_expr_of_symb_local_indices_tA_o_fct(const __parsec_local_indices_internal_taskpool_t *__parsec_tp, __parsec_local_indices_tA_parsec_assignment_t *locals)
+{
+  int32_t __parsec_ret;
+  const int o = locals->o.value; (void)o;
+  const int e = locals->e.value; (void)e;
+  const int i = locals->i.value; (void)i;
+  const int j = locals->j.value; (void)j;
+
+  { /* New scope for local definition 'k' */ 
+    int k = 4;
+    locals->ldef[0].value = k;
+  __parsec_ret = ((2 * k) + 1);
+  }
+  (void)__parsec_tp; (void)locals;
+  return __parsec_ret;
+}
+static const parsec_expr_t rangemax_of_expr_of_symb_local_indices_tA_o = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)rangemax_of_expr_of_symb_local_indices_tA_o_fct }
+                   }
+};
+static inline int32_t rangeincrement_of_expr_of_symb_local_indices_tA_o_fct(const __parsec_local_indices_internal_taskpool_t *__parsec_tp, __parsec_local_indices_tA_parsec_assignment_t *locals)
+{
+  int32_t __parsec_ret;
+  const int o = locals->o.value; (void)o;
+  const int e = locals->e.value; (void)e;
+  const int i = locals->i.value; (void)i;
+  const int j = locals->j.value; (void)j;
+
+  { /* New scope for local index 'k' */ 
+    int k = locals->ldef[0].value;
+    k += 1;
+    locals->ldef[0].value = k;
+  __parsec_ret = ((2 * k) + 1);
+  }
+  (void)__parsec_tp;
+  return __parsec_ret;
+}
+static const parsec_expr_t rangeincrement_of_expr_of_symb_local_indices_tA_o = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)rangeincrement_of_expr_of_symb_local_indices_tA_o_fct }
+                   }
+};
+static const parsec_expr_t expr_of_symb_local_indices_tA_o = {
+  .op = PARSEC_EXPR_OP_RANGE_EXPR_INCREMENT,
+  .u_expr.range = {
+    .op1 = &rangemin_of_expr_of_symb_local_indices_tA_o,
+    .op2 = &rangemax_of_expr_of_symb_local_indices_tA_o,
+    .increment.expr = &rangeincrement_of_expr_of_symb_local_indices_tA_o
+  }
+};
+static const parsec_symbol_t symb_local_indices_tA_o = { .name = "o", .context_index = 0, .min = &expr_of_symb_local_indices_tA_o, .max = &expr_of_symb_local_indices_tA_o, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t rangemin_of_expr_of_symb_local_indices_tA_e_fct(const __parsec_local_indices_internal_taskpool_t *__parsec_tp, __parsec_local_indices_tA_parsec_assignment_t *locals)
+{
+  int32_t __parsec_ret;
+  const int o = locals->o.value; (void)o;
+  const int e = locals->e.value; (void)e;
+  const int i = locals->i.value; (void)i;
+  const int j = locals->j.value; (void)j;
+
+  { /* New scope for local definition 'k' */ 
+    int k = 0;
+    locals->ldef[1].value = k;
+  __parsec_ret = (2 * k);
+  }
+  (void)__parsec_tp;
+  return __parsec_ret;
+}
+static const parsec_expr_t rangemin_of_expr_of_symb_local_indices_tA_e = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)rangemin_of_expr_of_symb_local_indices_tA_e_fct }
+                   }
+};
+static inline int32_t rangemax_of_expr_of_symb_local_indices_tA_e_fct(const __parsec_local_indices_internal_taskpool_t *__parsec_tp, __parsec_local_indices_tA_parsec_assignment_t *locals)
+{
+  int32_t __parsec_ret;
+  const int o = locals->o.value; (void)o;
+  const int e = locals->e.value; (void)e;
+  const int i = locals->i.value; (void)i;
+  const int j = locals->j.value; (void)j;
+
+  { /* New scope for local definition 'k' */ 
+    int k = 4;
+    locals->ldef[1].value = k;
+  __parsec_ret = (2 * k);
+  }
+  (void)__parsec_tp; (void)locals;
+  return __parsec_ret;
+}
+static const parsec_expr_t rangemax_of_expr_of_symb_local_indices_tA_e = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)rangemax_of_expr_of_symb_local_indices_tA_e_fct }
+                   }
+};
+static inline int32_t rangeincrement_of_expr_of_symb_local_indices_tA_e_fct(const __parsec_local_indices_internal_taskpool_t *__parsec_tp, __parsec_local_indices_tA_parsec_assignment_t *locals)
+{
+  int32_t __parsec_ret;
+  const int o = locals->o.value; (void)o;
+  const int e = locals->e.value; (void)e;
+  const int i = locals->i.value; (void)i;
+  const int j = locals->j.value; (void)j;
+
+  { /* New scope for local index 'k' */ 
+    int k = locals->ldef[1].value;
+    k += 1;
+    locals->ldef[1].value = k;
+  __parsec_ret = (2 * k);
+  }
+  (void)__parsec_tp;
+  return __parsec_ret;
+}
+static const parsec_expr_t rangeincrement_of_expr_of_symb_local_indices_tA_e = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)rangeincrement_of_expr_of_symb_local_indices_tA_e_fct }
+                   }
+};
+static const parsec_expr_t expr_of_symb_local_indices_tA_e = {
+  .op = PARSEC_EXPR_OP_RANGE_EXPR_INCREMENT,
+  .u_expr.range = {
+    .op1 = &rangemin_of_expr_of_symb_local_indices_tA_e,
+    .op2 = &rangemax_of_expr_of_symb_local_indices_tA_e,
+    .increment.expr = &rangeincrement_of_expr_of_symb_local_indices_tA_e
+  }
+};
+static const parsec_symbol_t symb_local_indices_tA_e = { .name = "e", .context_index = 1, .min = &expr_of_symb_local_indices_tA_e, .max = &expr_of_symb_local_indices_tA_e, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t minexpr_of_symb_local_indices_tA_i_fct(const __parsec_local_indices_internal_taskpool_t *__parsec_tp, const __parsec_local_indices_tA_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_local_indices_tA_i = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_local_indices_tA_i_fct }
+                   }
+};
+static inline int maxexpr_of_symb_local_indices_tA_i_fct(const __parsec_local_indices_internal_taskpool_t *__parsec_tp, const __parsec_local_indices_tA_parsec_assignment_t *locals)
+{
+  const int o = locals->o.value;
+  const int e = locals->e.value; (void)e;
+  const int i = locals->i.value; (void)i;
+  const int j = locals->j.value; (void)j;
+
+  (void)o;
+  (void)e;
+  (void)i;
+  (void)j;
+  (void)__parsec_tp; (void)locals;
+  return (((o) < (4)) ? (o) : (-1));
+}
+static const parsec_expr_t maxexpr_of_symb_local_indices_tA_i = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_local_indices_tA_i_fct }
+                   }
+};
+static const parsec_symbol_t symb_local_indices_tA_i = { .name = "i", .context_index = 2, .min = &minexpr_of_symb_local_indices_tA_i, .max = &maxexpr_of_symb_local_indices_tA_i, .cst_inc = 1, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t minexpr_of_symb_local_indices_tA_j_fct(const __parsec_local_indices_internal_taskpool_t *__parsec_tp, const __parsec_local_indices_tA_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_local_indices_tA_j = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_local_indices_tA_j_fct }
+                   }
+};
+static inline int maxexpr_of_symb_local_indices_tA_j_fct(const __parsec_local_indices_internal_taskpool_t *__parsec_tp, const __parsec_local_indices_tA_parsec_assignment_t *locals)
+{
+  const int o = locals->o.value; (void)o;
+  const int e = locals->e.value;
+  const int i = locals->i.value; (void)i;
+  const int j = locals->j.value; (void)j;
+
+  (void)o;
+  (void)e;
+  (void)i;
+  (void)j;
+  (void)__parsec_tp; (void)locals;
+  return (e / 2);
+}
+static const parsec_expr_t maxexpr_of_symb_local_indices_tA_j = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_local_indices_tA_j_fct }
+                   }
+};
+static const parsec_symbol_t symb_local_indices_tA_j = { .name = "j", .context_index = 3, .min = &minexpr_of_symb_local_indices_tA_j, .max = &maxexpr_of_symb_local_indices_tA_j, .cst_inc = 1, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int affinity_of_local_indices_tA(const __parsec_local_indices_tA_task_t *this_task,
+                     parsec_data_ref_t *ref)
+{
+    const __parsec_local_indices_internal_taskpool_t *__parsec_tp = (const __parsec_local_indices_internal_taskpool_t*)this_task->taskpool;
+  const int o = this_task->locals.o.value; (void)o;
+  const int e = this_task->locals.e.value; (void)e;
+  const int i = this_task->locals.i.value; (void)i;
+  const int j = this_task->locals.j.value; (void)j;
+
+  /* Silent Warnings: should look into predicate to know what variables are usefull */
+  (void)o;
+  (void)e;
+  (void)i;
+  (void)j;
+  ref->dc = (parsec_data_collection_t *)__parsec_tp->super._g_descA;
+  /* Compute data key */
+  ref->key = ref->dc->data_key(ref->dc, (i % descA->super.mt), (j % descA->super.nt));
+  return 1;
+}
+static const parsec_property_t properties_of_local_indices_tA[1] = {
+  {.name = NULL, .expr = NULL}
+};
+static const parsec_dep_t flow_of_local_indices_tA_for_A_dep1_atline_71 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 0, /* local_indices_STARTUP */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_local_indices_STARTUP_for_A,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_local_indices_tA_for_A,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_local_indices_tA_for_A = {
+  .name               = "A",
+  .sym_type           = PARSEC_SYM_IN,
+  .flow_flags         = PARSEC_FLOW_ACCESS_READ,
+  .flow_index         = 0,
+  .flow_datatype_mask = 0x0,
+  .dep_in     = { &flow_of_local_indices_tA_for_A_dep1_atline_71 },
+  .dep_out    = { NULL }
+};
+
+static void
+iterate_predecessors_of_local_indices_tA(parsec_execution_stream_t *es, const __parsec_local_indices_tA_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_local_indices_internal_taskpool_t *__parsec_tp = (const __parsec_local_indices_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_local_indices_tA_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_local_indices_tA_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int o = __jdf2c__tmp_locals.o.value; (void)o;
+  const int e = __jdf2c__tmp_locals.e.value; (void)e;
+  const int i = __jdf2c__tmp_locals.i.value; (void)i;
+  const int j = __jdf2c__tmp_locals.j.value; (void)j;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)o;  (void)e;  (void)i;  (void)j;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_descA((i % descA->super.mt), (j % descA->super.nt));
+#endif
+  if( action_mask & 0x1 ) {  /* Flow of data A [0] */
+    data.data   = this_task->data._f_A.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x1 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_local_indices_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_local_indices_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        __parsec_local_indices_STARTUP_task_t* ncc = (__parsec_local_indices_STARTUP_task_t*)&nc;
+    nc.task_class = __parsec_tp->super.super.task_classes_array[local_indices_STARTUP.task_class_id];
+      const int STARTUP_odd = o;
+      /* We cannot check if STARTUP_odd is within the iterator space, because that space is defined with local indices. We need to trust */
+      assert(&nc.locals[0].value == &ncc->locals.odd.value);
+      ncc->locals.odd.value = STARTUP_odd;
+      const int STARTUP_even = e;
+      /* We cannot check if STARTUP_even is within the iterator space, because that space is defined with local indices. We need to trust */
+      assert(&nc.locals[1].value == &ncc->locals.even.value);
+      ncc->locals.even.value = STARTUP_even;
+#if defined(DISTRIBUTED)
+      rank_dst = rank_of_descA(((ncc->locals.odd.value / 2) % descA->super.mt), ((ncc->locals.even.value / 2) % descA->super.nt));
+      if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+        vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, ((ncc->locals.odd.value / 2) % descA->super.mt), ((ncc->locals.even.value / 2) % descA->super.nt));
+      nc.priority = __parsec_tp->super.super.priority;
+      successor_repo = STARTUP_repo;
+      successor_repo_key = __jdf2c_make_key_STARTUP((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+    RELEASE_DEP_OUTPUT(es, "A", this_task, "A", &nc, rank_src, rank_dst, &data);
+    if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_local_indices_tA_for_A_dep1_atline_71, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+  }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static int release_deps_of_local_indices_tA(parsec_execution_stream_t *es, __parsec_local_indices_tA_task_t *this_task, uint32_t action_mask, parsec_remote_deps_t *deps)
+{
+  PARSEC_PINS(es, RELEASE_DEPS_BEGIN, (parsec_task_t *)this_task);  const __parsec_local_indices_internal_taskpool_t *__parsec_tp = (const __parsec_local_indices_internal_taskpool_t *)this_task->taskpool;
+  parsec_release_dep_fct_arg_t arg;
+  int __vp_id;
+  int consume_local_repo = 0;
+  arg.action_mask = action_mask;
+  arg.output_entry = NULL;
+  arg.output_repo = NULL;
+#if defined(DISTRIBUTED)
+  arg.remote_deps = deps;
+#endif  /* defined(DISTRIBUTED) */
+  assert(NULL != es);
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS )    arg.ready_lists = alloca(sizeof(parsec_task_t *) * es->virtual_process->parsec_context->nb_vp);
+  else
+    arg.ready_lists = NULL;
+  for( __vp_id = 0; __vp_id < es->virtual_process->parsec_context->nb_vp; arg.ready_lists[__vp_id++] = NULL );
+  (void)__parsec_tp; (void)deps;
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_A.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_A.source_repo, this_task->data._f_A.source_repo_entry->ht_item.key );
+    }
+  }
+  consume_local_repo = (this_task->repo_entry != NULL);
+  /* No successors, don't call iterate_successors and don't release any local deps */
+      if (consume_local_repo) {
+         data_repo_entry_used_once( tA_repo, this_task->repo_entry->ht_item.key );
+      }
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_A.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_A.data_in);
+    }
+  }
+  PARSEC_PINS(es, RELEASE_DEPS_END, (parsec_task_t *)this_task);  return 0;
+}
+
+static int data_lookup_of_local_indices_tA(parsec_execution_stream_t *es, __parsec_local_indices_tA_task_t *this_task)
+{
+  const __parsec_local_indices_internal_taskpool_t *__parsec_tp = (__parsec_local_indices_internal_taskpool_t *)this_task->taskpool;
+  parsec_assignment_t generic_locals[MAX_PARAM_COUNT];  /* generic task locals */
+  int target_device = 0; (void)target_device;
+  (void)__parsec_tp; (void)generic_locals; (void)es;
+  parsec_data_copy_t *chunk = NULL;
+  data_repo_t        *reshape_repo  = NULL, *consumed_repo  = NULL;
+  data_repo_entry_t  *reshape_entry = NULL, *consumed_entry = NULL;
+  parsec_key_t        reshape_entry_key = 0, consumed_entry_key = 0;
+  uint8_t             consumed_flow_index;
+  parsec_dep_data_description_t data;
+  int ret;
+  (void)reshape_repo; (void)reshape_entry; (void)reshape_entry_key;
+  (void)consumed_repo; (void)consumed_entry; (void)consumed_entry_key;
+  (void)consumed_flow_index;
+  (void)chunk; (void)data; (void)ret;
+  const int o = this_task->locals.o.value; (void)o;
+  const int e = this_task->locals.e.value; (void)e;
+  const int i = this_task->locals.i.value; (void)i;
+  const int j = this_task->locals.j.value; (void)j;
+  if( NULL == this_task->repo_entry ){
+    this_task->repo_entry = data_repo_lookup_entry_and_create(es, tA_repo,                                       __jdf2c_make_key_tA((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    data_repo_entry_addto_usage_limit(tA_repo, this_task->repo_entry->ht_item.key, 1);    this_task->repo_entry ->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(this_task->repo_entry ->sim_exec_date == 0);
+    this_task->repo_entry ->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  /* The reshape repo is the current task repo. */  reshape_repo = tA_repo;
+  reshape_entry_key = __jdf2c_make_key_tA((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals) ;
+  reshape_entry = this_task->repo_entry;
+  /* Lookup the input data, and store them in the context if any */
+
+if(! this_task->data._f_A.fulfill ){ /* Flow A */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_A.data_out = NULL;  /* input only */
+  /* Flow A [0] dependency [0] from predecessor STARTUP */
+  if( NULL == (chunk = this_task->data._f_A.data_in) ) {
+  /* No data set up by predecessor on this task input flow */
+__parsec_local_indices_STARTUP_parsec_assignment_t *target_locals = (__parsec_local_indices_STARTUP_parsec_assignment_t*)&generic_locals;
+  const int STARTUPodd = target_locals->odd.value = o; (void)STARTUPodd;
+  const int STARTUPeven = target_locals->even.value = e; (void)STARTUPeven;
+    if( (reshape_entry != NULL) && (reshape_entry->data[0] != NULL) ){
+        /* Reshape promise set up on this task repo by predecessor */
+        consumed_repo = reshape_repo;
+        consumed_entry = reshape_entry;
+        consumed_entry_key = reshape_entry_key;
+        consumed_flow_index = 0;
+    }else{
+        /* Consume from predecessor's repo */
+        consumed_repo = STARTUP_repo;
+        consumed_entry_key = __jdf2c_make_key_STARTUP((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)target_locals) ;
+        consumed_entry = data_repo_lookup_entry( consumed_repo, consumed_entry_key );
+        consumed_flow_index = 0;
+    }
+    data.data   = NULL;
+    data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+        data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    ACQUIRE_FLOW(this_task, "A", &local_indices_STARTUP, "A", target_locals, chunk);
+    this_task->data._f_A.data_out = chunk;
+  } 
+  else {
+    /* Data set up by predecessor on this task input flow */
+    consumed_repo = this_task->data._f_A.source_repo;
+    consumed_entry = this_task->data._f_A.source_repo_entry;
+    consumed_entry_key = this_task->data._f_A.source_repo_entry->ht_item.key;
+    if( (reshape_entry != NULL) && (reshape_entry->data[0] != NULL) ){
+        /* Reshape promise set up on input by predecessor is on this task repo */
+        consumed_flow_index = 0;
+        assert( (this_task->data._f_A.source_repo == reshape_repo)
+             && (this_task->data._f_A.source_repo_entry == reshape_entry));
+    }else{
+        /* Reshape promise set up on input by predecessor is the predecesssor task repo */
+        consumed_flow_index = 0;
+    }
+    data.data   = NULL;
+    data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+        data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    this_task->data._f_A.data_out = parsec_data_get_copy(chunk->original, target_device);
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+    parsec_prof_grapher_data_input(chunk->original, (parsec_task_t*)this_task, &flow_of_local_indices_tA_for_A, 0);
+#endif
+  }
+    this_task->data._f_A.data_in     = chunk;
+    this_task->data._f_A.source_repo       = consumed_repo;
+    this_task->data._f_A.source_repo_entry = consumed_entry;
+    this_task->data._f_A.fulfill = 1;
+}
+
+  /** Generate profiling information */
+#if defined(PARSEC_PROF_TRACE)
+  this_task->prof_info.desc = (parsec_data_collection_t*)__parsec_tp->super._g_descA;
+  this_task->prof_info.priority = this_task->priority;
+  this_task->prof_info.data_id   = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->data_key((parsec_data_collection_t*)__parsec_tp->super._g_descA, (i % descA->super.mt), (j % descA->super.nt));
+  this_task->prof_info.task_class_id = this_task->task_class->task_class_id;
+  this_task->prof_info.task_return_code = -1;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int datatype_lookup_of_local_indices_tA(parsec_execution_stream_t *es, const parsec_task_t *this_generic_task, const parsec_task_t *parent_task,
+              uint32_t* flow_mask, parsec_dep_data_description_t* data)
+{
+  const __parsec_local_indices_tA_task_t *this_task = (__parsec_local_indices_tA_task_t*)this_generic_task;
+  const __parsec_local_indices_internal_taskpool_t *__parsec_tp = (__parsec_local_indices_internal_taskpool_t *)this_task->taskpool;
+  (void)__parsec_tp; (void)es; (void)this_task; (void)data; (void)parent_task;
+  const int o = this_task->locals.o.value; (void)o;
+  const int e = this_task->locals.e.value; (void)e;
+  const int i = this_task->locals.i.value; (void)i;
+  const int j = this_task->locals.j.value; (void)j;
+  data->local.arena = data->remote.arena = NULL;
+  data->local.src_datatype  = data->local.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->local.src_count     = data->local.dst_count = 0;
+  data->local.src_displ     = data->local.dst_displ = 0;
+  data->data_future  = NULL;
+  if( (*flow_mask) & 0x80000000U ) { /* these are the input dependencies remote datatypes  */
+if( (*flow_mask) & 0x1U ) {  /* Flow A */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_local_indices_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_local_indices_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_local_indices_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+    goto no_mask_match;
+  }
+
+  /* these are the output dependencies remote datatypes */
+ no_mask_match:
+  data->data                             = NULL;
+  data->remote.src_datatype = data->remote.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->remote.src_count    = data->remote.dst_count = 0;
+  data->remote.src_displ    = data->remote.dst_displ = 0;
+  data->data_future  = NULL;
+  (*flow_mask) = 0;  /* nothing left */
+  (void)o;  (void)e;  (void)i;  (void)j;
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+static int hook_of_local_indices_tA(parsec_execution_stream_t *es, __parsec_local_indices_tA_task_t *this_task)
+{
+  __parsec_local_indices_internal_taskpool_t *__parsec_tp = (__parsec_local_indices_internal_taskpool_t *)this_task->taskpool;
+  (void)es; (void)__parsec_tp;
+  const int o = this_task->locals.o.value; (void)o;
+  const int e = this_task->locals.e.value; (void)e;
+  const int i = this_task->locals.i.value; (void)i;
+  const int j = this_task->locals.j.value; (void)j;
+  (void)o;  (void)e;  (void)i;  (void)j;
+
+  /** Declare the variables that will hold the data, and all the accounting for each */
+  parsec_data_copy_t *_f_A = this_task->data._f_A.data_in;
+  void *A = PARSEC_DATA_COPY_GET_PTR(_f_A); (void)A;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    data_repo_entry_t *eA = this_task->data._f_A.source_repo_entry;
+    if( (NULL != eA) && (eA->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eA->sim_exec_date;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+  /** Cache Awareness Accounting */
+#if defined(PARSEC_CACHE_AWARENESS)
+  cache_buf_referenced(es->closest_cache, A);
+#endif /* PARSEC_CACHE_AWARENESS */
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                                    tA BODY                                    -----*/
+
+{
+   usleep( rand() % 50000 + 50000);
+   parsec_atomic_fetch_inc_int32(&nb_tasks_array[1]);
+}
+
+/*-----                                END OF tA BODY                                -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#endif  /*  defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+static int complete_hook_of_local_indices_tA(parsec_execution_stream_t *es, __parsec_local_indices_tA_task_t *this_task)
+{
+  const __parsec_local_indices_internal_taskpool_t *__parsec_tp = (__parsec_local_indices_internal_taskpool_t *)this_task->taskpool;
+#if defined(DISTRIBUTED)
+    const int o = this_task->locals.o.value; (void)o;
+  const int e = this_task->locals.e.value; (void)e;
+  const int i = this_task->locals.i.value; (void)i;
+  const int j = this_task->locals.j.value; (void)j;
+#endif  /* defined(DISTRIBUTED) */
+  (void)es; (void)__parsec_tp;
+parsec_data_t* data_t_desc = NULL; (void)data_t_desc;
+#if defined(DISTRIBUTED)
+  /** If not working on distributed, there is no risk that data is not in place */
+  (void)o;  (void)e;  (void)i;  (void)j;
+
+#endif /* DISTRIBUTED */
+#if defined(PARSEC_PROF_GRAPHER)
+  parsec_prof_grapher_task((parsec_task_t*)this_task, es->th_id, es->virtual_process->vp_id,
+     __jdf2c_key_fns_tA.key_hash(this_task->task_class->make_key( (parsec_taskpool_t*)this_task->taskpool, ((parsec_task_t*)this_task)->locals), NULL));
+#endif  /* defined(PARSEC_PROF_GRAPHER) */
+  release_deps_of_local_indices_tA(es, this_task,
+      PARSEC_ACTION_RELEASE_REMOTE_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_REFS |
+      PARSEC_ACTION_RESHAPE_ON_RELEASE |
+      0x0,  /* mask of all dep_index */ 
+      NULL);
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static parsec_hook_return_t release_task_of_local_indices_tA(parsec_execution_stream_t *es, parsec_task_t *this_task)
+{
+    const __parsec_local_indices_internal_taskpool_t *__parsec_tp =
+        (const __parsec_local_indices_internal_taskpool_t *)this_task->taskpool;
+    parsec_hash_table_t *ht = (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[2];
+    parsec_key_t key = this_task->task_class->make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals);
+    parsec_hashable_dependency_t *hash_dep = (parsec_hashable_dependency_t *)parsec_hash_table_remove(ht, key);
+    parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);
+    return parsec_release_task_to_mempool_update_nbtasks(es, this_task);
+}
+
+static char *local_indices_local_indices_tA_internal_init_deps_key_functions_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_local_indices_internal_taskpool_t *__parsec_tp = (__parsec_local_indices_internal_taskpool_t *)user_data;
+  __parsec_local_indices_tA_parsec_assignment_t __jdf2c__assignments = {  .o.value = 0, .e.value = 0, .i.value = 0, .j.value = 0 };
+  int o = (__parsec_key) % __parsec_tp->tA_o_range + __parsec_tp->tA_o_min;
+  __parsec_key = __parsec_key / __parsec_tp->tA_o_range;
+  __jdf2c__assignments.o.value = o;
+  int e = (__parsec_key) % __parsec_tp->tA_e_range + __parsec_tp->tA_e_min;
+  __parsec_key = __parsec_key / __parsec_tp->tA_e_range;
+  __jdf2c__assignments.e.value = e;
+  int i = (__parsec_key) % __parsec_tp->tA_i_range + __parsec_tp->tA_i_min;
+  __parsec_key = __parsec_key / __parsec_tp->tA_i_range;
+  __jdf2c__assignments.i.value = i;
+  int j = (__parsec_key) % __parsec_tp->tA_j_range + __parsec_tp->tA_j_min;
+  __parsec_key = __parsec_key / __parsec_tp->tA_j_range;
+  __jdf2c__assignments.j.value = j;
+  (void)__jdf2c__assignments;
+  snprintf(buffer, buffer_size, "tA(%d, %d, %d, %d)", o, e, i, j);
+  return buffer;
+}
+
+static parsec_key_fn_t local_indices_local_indices_tA_internal_init_deps_key_functions = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = local_indices_local_indices_tA_internal_init_deps_key_functions_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/* Needs: min-max count-tasks iterate */
+static int local_indices_tA_internal_init(parsec_execution_stream_t * es, __parsec_local_indices_tA_task_t * this_task)
+{
+  __parsec_local_indices_internal_taskpool_t *__parsec_tp = (__parsec_local_indices_internal_taskpool_t*)this_task->taskpool;
+  int32_t nb_tasks = 0, saved_nb_tasks = 0;
+int32_t __o_min = 0x7fffffff, __o_max = 0;int32_t __jdf2c_o_min = 0x7fffffff, __jdf2c_o_max = 0;int32_t __e_min = 0x7fffffff, __e_max = 0;int32_t __jdf2c_e_min = 0x7fffffff, __jdf2c_e_max = 0;int32_t __i_min = 0x7fffffff, __i_max = 0;int32_t __jdf2c_i_min = 0x7fffffff, __jdf2c_i_max = 0;int32_t __j_min = 0x7fffffff, __j_max = 0;int32_t __jdf2c_j_min = 0x7fffffff, __jdf2c_j_max = 0;  __parsec_local_indices_tA_parsec_assignment_t assignments = {  .o.value = 0, .e.value = 0, .i.value = 0, .j.value = 0 };
+  int32_t  o,  e,  i,  j;
+  int32_t __jdf2c_o_start, __jdf2c_o_end, __jdf2c_o_inc;
+  int32_t __jdf2c_e_start, __jdf2c_e_end, __jdf2c_e_inc;
+  int32_t __jdf2c_i_start, __jdf2c_i_end, __jdf2c_i_inc;
+  int32_t __jdf2c_j_start, __jdf2c_j_end, __jdf2c_j_inc;
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+  PARSEC_PROFILING_TRACE(es->es_profile,
+                         this_task->taskpool->profiling_array[START_KEY(this_task->task_class->task_class_id)],
+                         0,
+                         this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+  { /* block for the local variable 'k' */
+    int k;
+    for(assignments.ldef[0].value = k = 0; k <= 4; assignments.ldef[0].value = k += 1 ) { /* Iterator on k */ 
+        o = ((2 * k) + 1);
+        assignments.o.value = o;
+        { /* block for the local variable 'k' */
+          int k;
+          for(assignments.ldef[1].value = k = 0; k <= 4; assignments.ldef[1].value = k += 1 ) { /* Iterator on k */ 
+              e = (2 * k);
+              assignments.e.value = e;
+                __jdf2c_i_start = 0;
+                __jdf2c_i_end = (((o) < (4)) ? (o) : (-1));
+                __jdf2c_i_inc = 1;
+                __i_min = parsec_imin(__jdf2c_i_start, __jdf2c_i_end);
+                __i_max = parsec_imax(__jdf2c_i_start, __jdf2c_i_end);
+                __jdf2c_i_min = parsec_imin(__jdf2c_i_min, __i_min);
+                __jdf2c_i_max = parsec_imax(__jdf2c_i_max, __i_max);
+                for(i =  __jdf2c_i_start;
+                    i <= __jdf2c_i_end;
+                    i += __jdf2c_i_inc) {
+                assignments.i.value = i;
+                  __jdf2c_j_start = 0;
+                  __jdf2c_j_end = (e / 2);
+                  __jdf2c_j_inc = 1;
+                  __j_min = parsec_imin(__jdf2c_j_start, __jdf2c_j_end);
+                  __j_max = parsec_imax(__jdf2c_j_start, __jdf2c_j_end);
+                  __jdf2c_j_min = parsec_imin(__jdf2c_j_min, __j_min);
+                  __jdf2c_j_max = parsec_imax(__jdf2c_j_max, __j_max);
+                  for(j =  __jdf2c_j_start;
+                      j <= __jdf2c_j_end;
+                      j += __jdf2c_j_inc) {
+                  assignments.j.value = j;
+                    __jdf2c_o_min = parsec_imin(__jdf2c_o_min, o);
+                    __jdf2c_o_max = parsec_imax(__jdf2c_o_max, o);
+                    __jdf2c_e_min = parsec_imin(__jdf2c_e_min, e);
+                    __jdf2c_e_max = parsec_imax(__jdf2c_e_max, e);
+                  if( !tA_pred(o, e, i, j) ) continue;
+                  nb_tasks++;
+                } /* Loop on normal range j */
+              } /* For loop of i */ 
+              assignments.ldef[1].value = k;
+              } /* Iterator on k */ 
+            } /* Block for local definition of k */ 
+          assignments.ldef[0].value = k;
+          } /* Iterator on k */ 
+        } /* Block for local definition of k */ 
+       if( 0 != nb_tasks ) {
+         (void)parsec_atomic_fetch_add_int32(&__parsec_tp->initial_number_tasks, nb_tasks);
+       }
+  /* Set the range variables for the collision-free hash-computation */
+  __parsec_tp->tA_o_min   = __jdf2c_o_min;
+  __parsec_tp->tA_o_range = (__jdf2c_o_max - __jdf2c_o_min) + 1;
+  __parsec_tp->tA_e_min   = __jdf2c_e_min;
+  __parsec_tp->tA_e_range = (__jdf2c_e_max - __jdf2c_e_min) + 1;
+  __parsec_tp->tA_i_min   = __jdf2c_i_min;
+  __parsec_tp->tA_i_range = (__jdf2c_i_max - __jdf2c_i_min) + 1;
+  __parsec_tp->tA_j_min   = __jdf2c_j_min;
+  __parsec_tp->tA_j_range = (__jdf2c_j_max - __jdf2c_j_min) + 1;
+  this_task->status = PARSEC_TASK_STATUS_COMPLETE;
+
+  PARSEC_AYU_REGISTER_TASK(&local_indices_tA);
+  __parsec_tp->super.super.dependencies_array[2] = PARSEC_OBJ_NEW(parsec_hash_table_t);
+  parsec_hash_table_init(__parsec_tp->super.super.dependencies_array[2], offsetof(parsec_hashable_dependency_t, ht_item), 10, local_indices_local_indices_tA_internal_init_deps_key_functions, this_task->taskpool);
+  __parsec_tp->repositories[2] = data_repo_create_nothreadsafe(nb_tasks, __jdf2c_key_fns_tA, (parsec_taskpool_t*)__parsec_tp, 1);
+(void)saved_nb_tasks;
+(void)__o_min; (void)__o_max;(void)__e_min; (void)__e_max;(void)__i_min; (void)__i_max;(void)__j_min; (void)__j_max;  (void)__jdf2c_o_start; (void)__jdf2c_o_end; (void)__jdf2c_o_inc;  (void)__jdf2c_e_start; (void)__jdf2c_e_end; (void)__jdf2c_e_inc;  (void)__jdf2c_i_start; (void)__jdf2c_i_end; (void)__jdf2c_i_inc;  (void)__jdf2c_j_start; (void)__jdf2c_j_end; (void)__jdf2c_j_inc;  (void)assignments; (void)__parsec_tp; (void)es;
+  if(1 == parsec_atomic_fetch_dec_int32(&__parsec_tp->sync_point)) {
+    /* Last initialization task complete. Update the number of tasks. */
+    __parsec_tp->super.super.tdm.module->taskpool_addto_nb_tasks(&__parsec_tp->super.super, __parsec_tp->initial_number_tasks);
+    parsec_mfence();  /* write memory barrier to guarantee that the scheduler gets the correct number of tasks */
+    parsec_taskpool_enable((parsec_taskpool_t*)__parsec_tp, &__parsec_tp->startup_queue,
+                           (parsec_task_t*)this_task, es, __parsec_tp->super.super.nb_pending_actions);
+    __parsec_tp->super.super.tdm.module->taskpool_ready(&__parsec_tp->super.super);
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+    PARSEC_PROFILING_TRACE(es->es_profile,
+                           this_task->taskpool->profiling_array[2 * this_task->task_class->task_class_id + 1],
+                           0,
+                           this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    return PARSEC_HOOK_RETURN_DONE;
+  }
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static const __parsec_chore_t __local_indices_tA_chores[] ={
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+    { .type     = PARSEC_DEV_CPU,
+      .evaluate = (parsec_evaluate_function_t*)NULL,
+      .hook     = (parsec_hook_t*)hook_of_local_indices_tA },
+#endif  /* defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+    { .type     = PARSEC_DEV_NONE,
+      .evaluate = NULL,
+      .hook     = (parsec_hook_t*)NULL },  /* End marker */
+};
+
+static const parsec_task_class_t local_indices_tA = {
+  .name = "tA",
+  .task_class_id = 2,
+  .nb_flows = 1,
+  .nb_parameters = 4,
+  .nb_locals = 4,
+  .task_class_type = PARSEC_TASK_CLASS_TYPE_PTG,
+  .params = { &symb_local_indices_tA_o, &symb_local_indices_tA_e, &symb_local_indices_tA_i, &symb_local_indices_tA_j, NULL },
+  .locals = { &symb_local_indices_tA_o, &symb_local_indices_tA_e, &symb_local_indices_tA_i, &symb_local_indices_tA_j, NULL },
+  .data_affinity = (parsec_data_ref_fn_t*)affinity_of_local_indices_tA,
+  .initial_data = (parsec_data_ref_fn_t*)affinity_of_local_indices_tA,
+  .final_data = (parsec_data_ref_fn_t*)affinity_of_local_indices_tA,
+  .priority = NULL,
+  .properties = properties_of_local_indices_tA,
+#if MAX_PARAM_COUNT < 1  /* number of read flows of tA */
+  #error Too many read flows for task tA
+#endif  /* MAX_PARAM_COUNT */
+#if MAX_PARAM_COUNT < 0  /* number of write flows of tA */
+  #error Too many write flows for task tA
+#endif  /* MAX_PARAM_COUNT */
+  .in = { &flow_of_local_indices_tA_for_A, NULL },
+  .out = { NULL },
+  .flags = 0x0 | PARSEC_USE_DEPS_MASK,
+  .dependencies_goal = 0x1,
+  .make_key = __jdf2c_make_key_tA,
+  .task_snprintf = parsec_task_snprintf,
+#if defined(PARSEC_PROF_TRACE)
+  .profile_info = &parsec_task_profile_info,
+#endif
+  .key_functions = &__jdf2c_key_fns_tA,
+  .fini = (parsec_hook_t*)NULL,
+  .incarnations = __local_indices_tA_chores,
+  .find_deps = parsec_hash_find_deps,
+  .update_deps = parsec_update_deps_with_mask,
+  .iterate_successors = (parsec_traverse_function_t*)NULL,
+  .iterate_predecessors = (parsec_traverse_function_t*)iterate_predecessors_of_local_indices_tA,
+  .release_deps = (parsec_release_deps_t*)release_deps_of_local_indices_tA,
+  .prepare_output = (parsec_hook_t*)NULL,
+  .prepare_input = (parsec_hook_t*)data_lookup_of_local_indices_tA,
+  .time_estimate = NULL,
+  .get_datatype = datatype_lookup_of_local_indices_tA,
+  .complete_execution = (parsec_hook_t*)complete_hook_of_local_indices_tA,
+  .release_task = &release_task_of_local_indices_tA,
+#if defined(PARSEC_SIM)
+  .sim_cost_fct = (parsec_sim_cost_fct_t*)NULL,
+#endif
+};
+
+
+/******                                      tG                                      ******/
+
+static inline int32_t minexpr_of_symb_local_indices_tG_zero_fct(const __parsec_local_indices_internal_taskpool_t *__parsec_tp, const __parsec_local_indices_tG_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_local_indices_tG_zero = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_local_indices_tG_zero_fct }
+                   }
+};
+static inline int32_t maxexpr_of_symb_local_indices_tG_zero_fct(const __parsec_local_indices_internal_taskpool_t *__parsec_tp, const __parsec_local_indices_tG_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t maxexpr_of_symb_local_indices_tG_zero = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_local_indices_tG_zero_fct }
+                   }
+};
+static const parsec_symbol_t symb_local_indices_tG_zero = { .name = "zero", .context_index = 0, .min = &minexpr_of_symb_local_indices_tG_zero, .max = &maxexpr_of_symb_local_indices_tG_zero, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int affinity_of_local_indices_tG(const __parsec_local_indices_tG_task_t *this_task,
+                     parsec_data_ref_t *ref)
+{
+    const __parsec_local_indices_internal_taskpool_t *__parsec_tp = (const __parsec_local_indices_internal_taskpool_t*)this_task->taskpool;
+  const int zero = this_task->locals.zero.value; (void)zero;
+
+  /* Silent Warnings: should look into predicate to know what variables are usefull */
+  (void)zero;
+  ref->dc = (parsec_data_collection_t *)__parsec_tp->super._g_descA;
+  /* Compute data key */
+  ref->key = ref->dc->data_key(ref->dc, 0, 0);
+  return 1;
+}
+static const parsec_property_t properties_of_local_indices_tG[1] = {
+  {.name = NULL, .expr = NULL}
+};
+static inline int32_t rangemin_of_expr_of_cond_for_flow_of_local_indices_tG_for_Y_dep1_atline_52_fct(const __parsec_local_indices_internal_taskpool_t *__parsec_tp, __parsec_local_indices_tG_parsec_assignment_t *locals)
+{
+  int32_t __parsec_ret;
+  const int zero = locals->zero.value; (void)zero;
+
+  { /* New scope for local definition 'i' */ 
+    int i = 0;
+    locals->ldef[1].value = i;
+  { /* New scope for local definition 'j' */ 
+    int j = 0;
+    locals->ldef[0].value = j;
+  __parsec_ret = (i) >= (0);
+  }
+  }
+  (void)__parsec_tp;
+  return __parsec_ret;
+}
+static const parsec_expr_t rangemin_of_expr_of_cond_for_flow_of_local_indices_tG_for_Y_dep1_atline_52 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)rangemin_of_expr_of_cond_for_flow_of_local_indices_tG_for_Y_dep1_atline_52_fct }
+                   }
+};
+static inline int32_t rangemax_of_expr_of_cond_for_flow_of_local_indices_tG_for_Y_dep1_atline_52_fct(const __parsec_local_indices_internal_taskpool_t *__parsec_tp, __parsec_local_indices_tG_parsec_assignment_t *locals)
+{
+  int32_t __parsec_ret;
+  const int zero = locals->zero.value; (void)zero;
+
+  { /* New scope for local definition 'i' */ 
+    int i = 4;
+    locals->ldef[1].value = i;
+  { /* New scope for local definition 'j' */ 
+    int j = 4;
+    locals->ldef[0].value = j;
+  __parsec_ret = (i) >= (0);
+  }
+  }
+  (void)__parsec_tp; (void)locals;
+  return __parsec_ret;
+}
+static const parsec_expr_t rangemax_of_expr_of_cond_for_flow_of_local_indices_tG_for_Y_dep1_atline_52 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)rangemax_of_expr_of_cond_for_flow_of_local_indices_tG_for_Y_dep1_atline_52_fct }
+                   }
+};
+static inline int32_t rangeincrement_of_expr_of_cond_for_flow_of_local_indices_tG_for_Y_dep1_atline_52_fct(const __parsec_local_indices_internal_taskpool_t *__parsec_tp, __parsec_local_indices_tG_parsec_assignment_t *locals)
+{
+  int32_t __parsec_ret;
+  const int zero = locals->zero.value; (void)zero;
+
+  { /* New scope for local index 'i' */ 
+    int i = locals->ldef[1].value;
+    i += 1;
+    locals->ldef[1].value = i;
+  { /* New scope for local index 'j' */ 
+    int j = locals->ldef[0].value;
+    j += 1;
+    locals->ldef[0].value = j;
+  __parsec_ret = (i) >= (0);
+  }
+  }
+  (void)__parsec_tp;
+  return __parsec_ret;
+}
+static const parsec_expr_t rangeincrement_of_expr_of_cond_for_flow_of_local_indices_tG_for_Y_dep1_atline_52 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)rangeincrement_of_expr_of_cond_for_flow_of_local_indices_tG_for_Y_dep1_atline_52_fct }
+                   }
+};
+static const parsec_expr_t expr_of_cond_for_flow_of_local_indices_tG_for_Y_dep1_atline_52 = {
+  .op = PARSEC_EXPR_OP_RANGE_EXPR_INCREMENT,
+  .u_expr.range = {
+    .op1 = &rangemin_of_expr_of_cond_for_flow_of_local_indices_tG_for_Y_dep1_atline_52,
+    .op2 = &rangemax_of_expr_of_cond_for_flow_of_local_indices_tG_for_Y_dep1_atline_52,
+    .increment.expr = &rangeincrement_of_expr_of_cond_for_flow_of_local_indices_tG_for_Y_dep1_atline_52
+  }
+};
+static inline int ctl_gather_compute_for_dep_flow_of_local_indices_tG_for_Y_dep1_atline_52_fct(const __parsec_local_indices_internal_taskpool_t *__parsec_tp, const __parsec_local_indices_tG_parsec_assignment_t *assignments)
+{
+  int   __nb_found = 0;
+  __parsec_local_indices_tG_parsec_assignment_t __jdf2c__tmp_locals = *assignments;
+  (void)__parsec_tp;
+  const int zero = __jdf2c__tmp_locals.zero.value; (void)zero;
+  (void)zero;
+  int i = __jdf2c__tmp_locals.ldef[1].value;
+  (void)i;
+  int j = __jdf2c__tmp_locals.ldef[0].value;
+  (void)j;
+  int STARTUP_odd = ((2 * i) + 1);
+  (void)STARTUP_odd;
+  int STARTUP_even = (2 * j);
+  (void)STARTUP_even;
+  __nb_found++;
+  return __nb_found;
+}
+
+static const parsec_expr_t ctl_gather_compute_for_dep_flow_of_local_indices_tG_for_Y_dep1_atline_52 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)ctl_gather_compute_for_dep_flow_of_local_indices_tG_for_Y_dep1_atline_52_fct }
+                   }
+};
+
+static const parsec_dep_t flow_of_local_indices_tG_for_Y_dep1_atline_52 = {
+  .cond = &expr_of_cond_for_flow_of_local_indices_tG_for_Y_dep1_atline_52,  /* (i) >= (0) */
+  .ctl_gather_nb = &ctl_gather_compute_for_dep_flow_of_local_indices_tG_for_Y_dep1_atline_52,
+  .task_class_id = 0, /* local_indices_STARTUP */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_local_indices_STARTUP_for_X,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_local_indices_tG_for_Y,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_local_indices_tG_for_Y = {
+  .name               = "Y",
+  .sym_type           = PARSEC_SYM_IN,
+  .flow_flags         = PARSEC_FLOW_ACCESS_NONE|PARSEC_FLOW_HAS_IN_DEPS,
+  .flow_index         = 0,
+  .flow_datatype_mask = 0x0,
+  .dep_in     = { &flow_of_local_indices_tG_for_Y_dep1_atline_52 },
+  .dep_out    = { NULL }
+};
+
+static inline int32_t rangemin_of_expr_of_cond_for_flow_of_local_indices_tG_for_Z_dep1_atline_53_fct(const __parsec_local_indices_internal_taskpool_t *__parsec_tp, __parsec_local_indices_tG_parsec_assignment_t *locals)
+{
+  int32_t __parsec_ret;
+  const int zero = locals->zero.value; (void)zero;
+
+  { /* New scope for local definition 'i' */ 
+    int i = 0;
+    locals->ldef[1].value = i;
+  { /* New scope for local definition 'j' */ 
+    int j = 0;
+    locals->ldef[0].value = j;
+  __parsec_ret = (i) >= (0);
+  }
+  }
+  (void)__parsec_tp;
+  return __parsec_ret;
+}
+static const parsec_expr_t rangemin_of_expr_of_cond_for_flow_of_local_indices_tG_for_Z_dep1_atline_53 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)rangemin_of_expr_of_cond_for_flow_of_local_indices_tG_for_Z_dep1_atline_53_fct }
+                   }
+};
+static inline int32_t rangemax_of_expr_of_cond_for_flow_of_local_indices_tG_for_Z_dep1_atline_53_fct(const __parsec_local_indices_internal_taskpool_t *__parsec_tp, __parsec_local_indices_tG_parsec_assignment_t *locals)
+{
+  int32_t __parsec_ret;
+  const int zero = locals->zero.value; (void)zero;
+
+  { /* New scope for local definition 'i' */ 
+    int i = 4;
+    locals->ldef[1].value = i;
+  { /* New scope for local definition 'j' */ 
+    int j = 4;
+    locals->ldef[0].value = j;
+  __parsec_ret = (i) >= (0);
+  }
+  }
+  (void)__parsec_tp; (void)locals;
+  return __parsec_ret;
+}
+static const parsec_expr_t rangemax_of_expr_of_cond_for_flow_of_local_indices_tG_for_Z_dep1_atline_53 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)rangemax_of_expr_of_cond_for_flow_of_local_indices_tG_for_Z_dep1_atline_53_fct }
+                   }
+};
+static inline int32_t rangeincrement_of_expr_of_cond_for_flow_of_local_indices_tG_for_Z_dep1_atline_53_fct(const __parsec_local_indices_internal_taskpool_t *__parsec_tp, __parsec_local_indices_tG_parsec_assignment_t *locals)
+{
+  int32_t __parsec_ret;
+  const int zero = locals->zero.value; (void)zero;
+
+  { /* New scope for local index 'i' */ 
+    int i = locals->ldef[1].value;
+    i += 1;
+    locals->ldef[1].value = i;
+  { /* New scope for local index 'j' */ 
+    int j = locals->ldef[0].value;
+    j += 1;
+    locals->ldef[0].value = j;
+  __parsec_ret = (i) >= (0);
+  }
+  }
+  (void)__parsec_tp;
+  return __parsec_ret;
+}
+static const parsec_expr_t rangeincrement_of_expr_of_cond_for_flow_of_local_indices_tG_for_Z_dep1_atline_53 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)rangeincrement_of_expr_of_cond_for_flow_of_local_indices_tG_for_Z_dep1_atline_53_fct }
+                   }
+};
+static const parsec_expr_t expr_of_cond_for_flow_of_local_indices_tG_for_Z_dep1_atline_53 = {
+  .op = PARSEC_EXPR_OP_RANGE_EXPR_INCREMENT,
+  .u_expr.range = {
+    .op1 = &rangemin_of_expr_of_cond_for_flow_of_local_indices_tG_for_Z_dep1_atline_53,
+    .op2 = &rangemax_of_expr_of_cond_for_flow_of_local_indices_tG_for_Z_dep1_atline_53,
+    .increment.expr = &rangeincrement_of_expr_of_cond_for_flow_of_local_indices_tG_for_Z_dep1_atline_53
+  }
+};
+static inline int ctl_gather_compute_for_dep_flow_of_local_indices_tG_for_Z_dep1_atline_53_fct(const __parsec_local_indices_internal_taskpool_t *__parsec_tp, const __parsec_local_indices_tG_parsec_assignment_t *assignments)
+{
+  int   __nb_found = 0;
+  __parsec_local_indices_tG_parsec_assignment_t __jdf2c__tmp_locals = *assignments;
+  (void)__parsec_tp;
+  const int zero = __jdf2c__tmp_locals.zero.value; (void)zero;
+  (void)zero;
+  int i = __jdf2c__tmp_locals.ldef[1].value;
+  (void)i;
+  int j = __jdf2c__tmp_locals.ldef[0].value;
+  (void)j;
+  int STARTUP_odd = ((2 * i) + 1);
+  (void)STARTUP_odd;
+  int STARTUP_even = (2 * j);
+  (void)STARTUP_even;
+  __nb_found++;
+  return __nb_found;
+}
+
+static const parsec_expr_t ctl_gather_compute_for_dep_flow_of_local_indices_tG_for_Z_dep1_atline_53 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)ctl_gather_compute_for_dep_flow_of_local_indices_tG_for_Z_dep1_atline_53_fct }
+                   }
+};
+
+static const parsec_dep_t flow_of_local_indices_tG_for_Z_dep1_atline_53 = {
+  .cond = &expr_of_cond_for_flow_of_local_indices_tG_for_Z_dep1_atline_53,  /* (i) >= (0) */
+  .ctl_gather_nb = &ctl_gather_compute_for_dep_flow_of_local_indices_tG_for_Z_dep1_atline_53,
+  .task_class_id = 0, /* local_indices_STARTUP */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_local_indices_STARTUP_for_X,
+  .dep_index = 1,
+  .dep_datatype_index = 1,
+  .belongs_to = &flow_of_local_indices_tG_for_Z,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_local_indices_tG_for_Z = {
+  .name               = "Z",
+  .sym_type           = PARSEC_SYM_IN,
+  .flow_flags         = PARSEC_FLOW_ACCESS_NONE|PARSEC_FLOW_HAS_IN_DEPS,
+  .flow_index         = 1,
+  .flow_datatype_mask = 0x0,
+  .dep_in     = { &flow_of_local_indices_tG_for_Z_dep1_atline_53 },
+  .dep_out    = { NULL }
+};
+
+static void
+iterate_predecessors_of_local_indices_tG(parsec_execution_stream_t *es, const __parsec_local_indices_tG_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_local_indices_internal_taskpool_t *__parsec_tp = (const __parsec_local_indices_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_local_indices_tG_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_local_indices_tG_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int zero = __jdf2c__tmp_locals.zero.value; (void)zero;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)zero;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_descA(0, 0);
+#endif
+  if( action_mask & 0x1 ) {  /* Flow of data Y [0] */
+    data.data   = this_task->data._f_Y.data_out;
+    data.data_future  = NULL;
+  int i;
+  for( i = 0;i <= 4; i+=1) {
+  __jdf2c__tmp_locals.ldef[1].value = i;
+    int j;
+    for( j = 0;j <= 4; j+=1) {
+    __jdf2c__tmp_locals.ldef[0].value = j;
+  if( action_mask & 0x1 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  =   /* Control: always empty */ 0;
+    data.local.dst_count  =   /* Control: always empty */ 0;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = NULL;
+    data.remote.src_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.src_count  =   /* Control: always empty */ 0;
+    data.remote.dst_count  =   /* Control: always empty */ 0;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( (i) >= (0) ) {
+      __parsec_local_indices_STARTUP_task_t* ncc = (__parsec_local_indices_STARTUP_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[local_indices_STARTUP.task_class_id];
+        const int STARTUP_odd = ((2 * i) + 1);
+        /* We cannot check if STARTUP_odd is within the iterator space, because that space is defined with local indices. We need to trust */
+        assert(&nc.locals[0].value == &ncc->locals.odd.value);
+        ncc->locals.odd.value = STARTUP_odd;
+        const int STARTUP_even = (2 * j);
+        /* We cannot check if STARTUP_even is within the iterator space, because that space is defined with local indices. We need to trust */
+        assert(&nc.locals[1].value == &ncc->locals.even.value);
+        ncc->locals.even.value = STARTUP_even;
+#if defined(DISTRIBUTED)
+        rank_dst = rank_of_descA(((ncc->locals.odd.value / 2) % descA->super.mt), ((ncc->locals.even.value / 2) % descA->super.nt));
+        if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+          vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, ((ncc->locals.odd.value / 2) % descA->super.mt), ((ncc->locals.even.value / 2) % descA->super.nt));
+        nc.priority = __parsec_tp->super.super.priority;
+        successor_repo = STARTUP_repo;
+        successor_repo_key = __jdf2c_make_key_STARTUP((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+      RELEASE_DEP_OUTPUT(es, "Y", this_task, "X", &nc, rank_src, rank_dst, &data);
+      if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_local_indices_tG_for_Y_dep1_atline_52, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+    }
+  }
+      }
+    }
+  }
+  if( action_mask & 0x2 ) {  /* Flow of data Z [1] */
+    data.data   = this_task->data._f_Z.data_out;
+    data.data_future  = NULL;
+  int i;
+  for( i = 0;i <= 4; i+=1) {
+  __jdf2c__tmp_locals.ldef[1].value = i;
+    int j;
+    for( j = 0;j <= 4; j+=1) {
+    __jdf2c__tmp_locals.ldef[0].value = j;
+  if( action_mask & 0x2 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  =   /* Control: always empty */ 0;
+    data.local.dst_count  =   /* Control: always empty */ 0;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = NULL;
+    data.remote.src_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.src_count  =   /* Control: always empty */ 0;
+    data.remote.dst_count  =   /* Control: always empty */ 0;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( (i) >= (0) ) {
+      __parsec_local_indices_STARTUP_task_t* ncc = (__parsec_local_indices_STARTUP_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[local_indices_STARTUP.task_class_id];
+        const int STARTUP_odd = ((2 * i) + 1);
+        /* We cannot check if STARTUP_odd is within the iterator space, because that space is defined with local indices. We need to trust */
+        assert(&nc.locals[0].value == &ncc->locals.odd.value);
+        ncc->locals.odd.value = STARTUP_odd;
+        const int STARTUP_even = (2 * j);
+        /* We cannot check if STARTUP_even is within the iterator space, because that space is defined with local indices. We need to trust */
+        assert(&nc.locals[1].value == &ncc->locals.even.value);
+        ncc->locals.even.value = STARTUP_even;
+#if defined(DISTRIBUTED)
+        rank_dst = rank_of_descA(((ncc->locals.odd.value / 2) % descA->super.mt), ((ncc->locals.even.value / 2) % descA->super.nt));
+        if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+          vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, ((ncc->locals.odd.value / 2) % descA->super.mt), ((ncc->locals.even.value / 2) % descA->super.nt));
+        nc.priority = __parsec_tp->super.super.priority;
+        successor_repo = STARTUP_repo;
+        successor_repo_key = __jdf2c_make_key_STARTUP((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+      RELEASE_DEP_OUTPUT(es, "Z", this_task, "X", &nc, rank_src, rank_dst, &data);
+      if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_local_indices_tG_for_Z_dep1_atline_53, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+    }
+  }
+      }
+    }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static int release_deps_of_local_indices_tG(parsec_execution_stream_t *es, __parsec_local_indices_tG_task_t *this_task, uint32_t action_mask, parsec_remote_deps_t *deps)
+{
+  PARSEC_PINS(es, RELEASE_DEPS_BEGIN, (parsec_task_t *)this_task);  const __parsec_local_indices_internal_taskpool_t *__parsec_tp = (const __parsec_local_indices_internal_taskpool_t *)this_task->taskpool;
+  parsec_release_dep_fct_arg_t arg;
+  int __vp_id;
+  int consume_local_repo = 0;
+  arg.action_mask = action_mask;
+  arg.output_entry = NULL;
+  arg.output_repo = NULL;
+#if defined(DISTRIBUTED)
+  arg.remote_deps = deps;
+#endif  /* defined(DISTRIBUTED) */
+  assert(NULL != es);
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS )    arg.ready_lists = alloca(sizeof(parsec_task_t *) * es->virtual_process->parsec_context->nb_vp);
+  else
+    arg.ready_lists = NULL;
+  for( __vp_id = 0; __vp_id < es->virtual_process->parsec_context->nb_vp; arg.ready_lists[__vp_id++] = NULL );
+  (void)__parsec_tp; (void)deps;
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+  }
+  consume_local_repo = (this_task->repo_entry != NULL);
+  /* No successors, don't call iterate_successors and don't release any local deps */
+      if (consume_local_repo) {
+         data_repo_entry_used_once( tG_repo, this_task->repo_entry->ht_item.key );
+      }
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+  }
+  PARSEC_PINS(es, RELEASE_DEPS_END, (parsec_task_t *)this_task);  return 0;
+}
+
+static int data_lookup_of_local_indices_tG(parsec_execution_stream_t *es, __parsec_local_indices_tG_task_t *this_task)
+{
+  const __parsec_local_indices_internal_taskpool_t *__parsec_tp = (__parsec_local_indices_internal_taskpool_t *)this_task->taskpool;
+  parsec_assignment_t generic_locals[MAX_PARAM_COUNT];  /* generic task locals */
+  int target_device = 0; (void)target_device;
+  (void)__parsec_tp; (void)generic_locals; (void)es;
+  parsec_data_copy_t *chunk = NULL;
+  data_repo_t        *reshape_repo  = NULL, *consumed_repo  = NULL;
+  data_repo_entry_t  *reshape_entry = NULL, *consumed_entry = NULL;
+  parsec_key_t        reshape_entry_key = 0, consumed_entry_key = 0;
+  uint8_t             consumed_flow_index;
+  parsec_dep_data_description_t data;
+  int ret;
+  (void)reshape_repo; (void)reshape_entry; (void)reshape_entry_key;
+  (void)consumed_repo; (void)consumed_entry; (void)consumed_entry_key;
+  (void)consumed_flow_index;
+  (void)chunk; (void)data; (void)ret;
+  const int zero = this_task->locals.zero.value; (void)zero;
+  if( NULL == this_task->repo_entry ){
+    this_task->repo_entry = data_repo_lookup_entry_and_create(es, tG_repo,                                       __jdf2c_make_key_tG((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    data_repo_entry_addto_usage_limit(tG_repo, this_task->repo_entry->ht_item.key, 1);    this_task->repo_entry ->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(this_task->repo_entry ->sim_exec_date == 0);
+    this_task->repo_entry ->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  /* The reshape repo is the current task repo. */  reshape_repo = tG_repo;
+  reshape_entry_key = __jdf2c_make_key_tG((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals) ;
+  reshape_entry = this_task->repo_entry;
+  /* Lookup the input data, and store them in the context if any */
+  /* Y is a control flow */
+  this_task->data._f_Y.data_in         = NULL;
+  this_task->data._f_Y.data_out        = NULL;
+  this_task->data._f_Y.source_repo       = NULL;
+  this_task->data._f_Y.source_repo_entry = NULL;
+  /* Z is a control flow */
+  this_task->data._f_Z.data_in         = NULL;
+  this_task->data._f_Z.data_out        = NULL;
+  this_task->data._f_Z.source_repo       = NULL;
+  this_task->data._f_Z.source_repo_entry = NULL;
+  /** Generate profiling information */
+#if defined(PARSEC_PROF_TRACE)
+  this_task->prof_info.desc = (parsec_data_collection_t*)__parsec_tp->super._g_descA;
+  this_task->prof_info.priority = this_task->priority;
+  this_task->prof_info.data_id   = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->data_key((parsec_data_collection_t*)__parsec_tp->super._g_descA, 0, 0);
+  this_task->prof_info.task_class_id = this_task->task_class->task_class_id;
+  this_task->prof_info.task_return_code = -1;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int datatype_lookup_of_local_indices_tG(parsec_execution_stream_t *es, const parsec_task_t *this_generic_task, const parsec_task_t *parent_task,
+              uint32_t* flow_mask, parsec_dep_data_description_t* data)
+{
+  const __parsec_local_indices_tG_task_t *this_task = (__parsec_local_indices_tG_task_t*)this_generic_task;
+  const __parsec_local_indices_internal_taskpool_t *__parsec_tp = (__parsec_local_indices_internal_taskpool_t *)this_task->taskpool;
+  (void)__parsec_tp; (void)es; (void)this_task; (void)data; (void)parent_task;
+  const int zero = this_task->locals.zero.value; (void)zero;
+  data->local.arena = data->remote.arena = NULL;
+  data->local.src_datatype  = data->local.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->local.src_count     = data->local.dst_count = 0;
+  data->local.src_displ     = data->local.dst_displ = 0;
+  data->data_future  = NULL;
+
+  /* these are the output dependencies remote datatypes */
+  data->data                             = NULL;
+  data->remote.src_datatype = data->remote.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->remote.src_count    = data->remote.dst_count = 0;
+  data->remote.src_displ    = data->remote.dst_displ = 0;
+  data->data_future  = NULL;
+  (*flow_mask) = 0;  /* nothing left */
+  (void)zero;
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+static int hook_of_local_indices_tG(parsec_execution_stream_t *es, __parsec_local_indices_tG_task_t *this_task)
+{
+  __parsec_local_indices_internal_taskpool_t *__parsec_tp = (__parsec_local_indices_internal_taskpool_t *)this_task->taskpool;
+  (void)es; (void)__parsec_tp;
+  const int zero = this_task->locals.zero.value; (void)zero;
+  (void)zero;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                                    tG BODY                                    -----*/
+
+{
+   assert(nb_tasks_array[0] == 25); // tG(0) can only execute after all STARTUP tasks have executed
+   /* nothing */
+}
+
+/*-----                                END OF tG BODY                                -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#endif  /*  defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+static int complete_hook_of_local_indices_tG(parsec_execution_stream_t *es, __parsec_local_indices_tG_task_t *this_task)
+{
+  const __parsec_local_indices_internal_taskpool_t *__parsec_tp = (__parsec_local_indices_internal_taskpool_t *)this_task->taskpool;
+#if defined(DISTRIBUTED)
+    const int zero = this_task->locals.zero.value; (void)zero;
+#endif  /* defined(DISTRIBUTED) */
+  (void)es; (void)__parsec_tp;
+parsec_data_t* data_t_desc = NULL; (void)data_t_desc;
+#if defined(DISTRIBUTED)
+  /** If not working on distributed, there is no risk that data is not in place */
+  (void)zero;
+
+#endif /* DISTRIBUTED */
+#if defined(PARSEC_PROF_GRAPHER)
+  parsec_prof_grapher_task((parsec_task_t*)this_task, es->th_id, es->virtual_process->vp_id,
+     __jdf2c_key_fns_tG.key_hash(this_task->task_class->make_key( (parsec_taskpool_t*)this_task->taskpool, ((parsec_task_t*)this_task)->locals), NULL));
+#endif  /* defined(PARSEC_PROF_GRAPHER) */
+  release_deps_of_local_indices_tG(es, this_task,
+      PARSEC_ACTION_RELEASE_REMOTE_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_REFS |
+      PARSEC_ACTION_RESHAPE_ON_RELEASE |
+      0x0,  /* mask of all dep_index */ 
+      NULL);
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static parsec_hook_return_t release_task_of_local_indices_tG(parsec_execution_stream_t *es, parsec_task_t *this_task)
+{
+    const __parsec_local_indices_internal_taskpool_t *__parsec_tp =
+        (const __parsec_local_indices_internal_taskpool_t *)this_task->taskpool;
+    parsec_hash_table_t *ht = (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[1];
+    parsec_key_t key = this_task->task_class->make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals);
+    parsec_hashable_dependency_t *hash_dep = (parsec_hashable_dependency_t *)parsec_hash_table_remove(ht, key);
+    parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);
+    return parsec_release_task_to_mempool_update_nbtasks(es, this_task);
+}
+
+static char *local_indices_local_indices_tG_internal_init_deps_key_functions_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_local_indices_internal_taskpool_t *__parsec_tp = (__parsec_local_indices_internal_taskpool_t *)user_data;
+  int zero = (__parsec_key) % __parsec_tp->tG_zero_range + __parsec_tp->tG_zero_min;
+  __parsec_key = __parsec_key / __parsec_tp->tG_zero_range;
+  snprintf(buffer, buffer_size, "tG(%d)", zero);
+  return buffer;
+}
+
+static parsec_key_fn_t local_indices_local_indices_tG_internal_init_deps_key_functions = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = local_indices_local_indices_tG_internal_init_deps_key_functions_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/* Needs: min-max count-tasks iterate */
+static int local_indices_tG_internal_init(parsec_execution_stream_t * es, __parsec_local_indices_tG_task_t * this_task)
+{
+  __parsec_local_indices_internal_taskpool_t *__parsec_tp = (__parsec_local_indices_internal_taskpool_t*)this_task->taskpool;
+  int32_t nb_tasks = 0, saved_nb_tasks = 0;
+int32_t __zero_min = 0x7fffffff, __zero_max = 0;int32_t __jdf2c_zero_min = 0x7fffffff, __jdf2c_zero_max = 0;  __parsec_local_indices_tG_parsec_assignment_t assignments = {  .zero.value = 0 };
+  int32_t  zero;
+  int32_t __jdf2c_zero_start, __jdf2c_zero_end, __jdf2c_zero_inc;
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+  PARSEC_PROFILING_TRACE(es->es_profile,
+                         this_task->taskpool->profiling_array[START_KEY(this_task->task_class->task_class_id)],
+                         0,
+                         this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    __jdf2c_zero_start = 0;
+    __jdf2c_zero_end = 0;
+    __jdf2c_zero_inc = 1;
+    __zero_min = parsec_imin(__jdf2c_zero_start, __jdf2c_zero_end);
+    __zero_max = parsec_imax(__jdf2c_zero_start, __jdf2c_zero_end);
+    __jdf2c_zero_min = parsec_imin(__jdf2c_zero_min, __zero_min);
+    __jdf2c_zero_max = parsec_imax(__jdf2c_zero_max, __zero_max);
+    for(zero =  __jdf2c_zero_start;
+        zero <= __jdf2c_zero_end;
+        zero += __jdf2c_zero_inc) {
+    assignments.zero.value = zero;
+    if( !tG_pred(zero) ) continue;
+    nb_tasks++;
+  } /* Loop on normal range zero */
+   if( 0 != nb_tasks ) {
+     (void)parsec_atomic_fetch_add_int32(&__parsec_tp->initial_number_tasks, nb_tasks);
+   }
+  /* Set the range variables for the collision-free hash-computation */
+  __parsec_tp->tG_zero_min   = __jdf2c_zero_min;
+  __parsec_tp->tG_zero_range = (__jdf2c_zero_max - __jdf2c_zero_min) + 1;
+    do {
+      this_task->super.list_next = (parsec_list_item_t*)__parsec_tp->startup_queue;
+    } while(!parsec_atomic_cas_ptr(&__parsec_tp->startup_queue, (parsec_list_item_t*)this_task->super.list_next, this_task));
+    this_task->status = PARSEC_TASK_STATUS_HOOK;
+
+  PARSEC_AYU_REGISTER_TASK(&local_indices_tG);
+  __parsec_tp->super.super.dependencies_array[1] = PARSEC_OBJ_NEW(parsec_hash_table_t);
+  parsec_hash_table_init(__parsec_tp->super.super.dependencies_array[1], offsetof(parsec_hashable_dependency_t, ht_item), 10, local_indices_local_indices_tG_internal_init_deps_key_functions, this_task->taskpool);
+  __parsec_tp->repositories[1] = data_repo_create_nothreadsafe(nb_tasks, __jdf2c_key_fns_tG, (parsec_taskpool_t*)__parsec_tp, 2);
+(void)saved_nb_tasks;
+(void)__zero_min; (void)__zero_max;  (void)__jdf2c_zero_start; (void)__jdf2c_zero_end; (void)__jdf2c_zero_inc;  (void)assignments; (void)__parsec_tp; (void)es;
+  if(1 == parsec_atomic_fetch_dec_int32(&__parsec_tp->sync_point)) {
+    /* Last initialization task complete. Update the number of tasks. */
+    __parsec_tp->super.super.tdm.module->taskpool_addto_nb_tasks(&__parsec_tp->super.super, __parsec_tp->initial_number_tasks);
+    parsec_mfence();  /* write memory barrier to guarantee that the scheduler gets the correct number of tasks */
+    parsec_taskpool_enable((parsec_taskpool_t*)__parsec_tp, &__parsec_tp->startup_queue,
+                           (parsec_task_t*)this_task, es, __parsec_tp->super.super.nb_pending_actions);
+    __parsec_tp->super.super.tdm.module->taskpool_ready(&__parsec_tp->super.super);
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+    PARSEC_PROFILING_TRACE(es->es_profile,
+                           this_task->taskpool->profiling_array[2 * this_task->task_class->task_class_id + 1],
+                           0,
+                           this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    if( 1 >= __parsec_tp->super.super.nb_pending_actions ) {
+        /* if no tasks will be generated let's prevent the runtime from calling the hook and instead go directly to complete the task */
+        this_task->status = PARSEC_TASK_STATUS_COMPLETE;
+    }
+    return PARSEC_HOOK_RETURN_DONE;
+  }
+  return PARSEC_HOOK_RETURN_ASYNC;
+}
+
+static int __jdf2c_startup_tG(parsec_execution_stream_t * es, __parsec_local_indices_tG_task_t *this_task)
+{
+  __parsec_local_indices_tG_task_t* new_task;
+  __parsec_local_indices_internal_taskpool_t* __parsec_tp = (__parsec_local_indices_internal_taskpool_t*)this_task->taskpool;
+  parsec_context_t *context = __parsec_tp->super.super.context;
+  int vpid = 0, nb_tasks = 0;
+  size_t total_nb_tasks = 0;
+  parsec_list_item_t* pready_ring[context->nb_vp];
+  int restore_context = 0;
+  int zero = this_task->locals.zero.value;  /* retrieve value saved during the last iteration */
+  for(int _i = 0; _i < context->nb_vp; pready_ring[_i++] = NULL );
+  if( 0 != this_task->locals.reserved[0].value ) {
+    this_task->locals.reserved[0].value = 1; /* reset the submission process */
+    restore_context = 1;
+    goto restore_context_0;
+  }
+  this_task->locals.reserved[0].value = 1; /* a sane default value */
+  for(this_task->locals.zero.value = zero = 0;
+      this_task->locals.zero.value <= 0;
+      this_task->locals.zero.value += 1, zero = this_task->locals.zero.value) {
+    if( !tG_pred(zero) ) continue;
+  __parsec_local_indices_tG_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_local_indices_tG_parsec_assignment_t*)&this_task->locals;
+  (void)__jdf2c__tmp_locals;
+  {
+    int __active_dep_found = 0;
+    int i;
+    for( i = 0;(!__active_dep_found) && (i <= 4); i+=1) {
+       __jdf2c__tmp_locals.ldef[1].value = i;
+    int j;
+    for( j = 0;(!__active_dep_found) && (j <= 4); j+=1) {
+       __jdf2c__tmp_locals.ldef[0].value = j;
+  if( (i) >= (0) ) { __active_dep_found = 1; break; /* X STARTUP() is not a memory reference for flow Y */ }
+  }
+  }
+    if(__active_dep_found) continue;
+  }
+  {
+    int __active_dep_found = 0;
+    int i;
+    for( i = 0;(!__active_dep_found) && (i <= 4); i+=1) {
+       __jdf2c__tmp_locals.ldef[1].value = i;
+    int j;
+    for( j = 0;(!__active_dep_found) && (j <= 4); j+=1) {
+       __jdf2c__tmp_locals.ldef[0].value = j;
+  if( (i) >= (0) ) { __active_dep_found = 1; break; /* X STARTUP() is not a memory reference for flow Z */ }
+  }
+  }
+    if(__active_dep_found) continue;
+  }
+    if( NULL != ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of ) {
+      vpid = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, 0, 0);
+      assert(context->nb_vp >= vpid);
+    } else {
+      vpid = (vpid + 1) % context->nb_vp;  /* spread the initial joy */
+    }
+    new_task = (__parsec_local_indices_tG_task_t*)parsec_thread_mempool_allocate( context->virtual_processes[vpid]->execution_streams[0]->context_mempool );
+    PARSEC_OBJ_CONSTRUCT(new_task, parsec_task_t); /* construct called only when new, force-construct it again */
+    /* Copy only the valid elements from this_task to new_task one */
+    new_task->taskpool   = this_task->taskpool;
+    new_task->task_class = __parsec_tp->super.super.task_classes_array[local_indices_tG.task_class_id];
+    new_task->chore_mask   = PARSEC_DEV_ALL;
+    new_task->locals.zero.value = this_task->locals.zero.value;
+    PARSEC_LIST_ITEM_SINGLETON(new_task);
+    new_task->priority = __parsec_tp->super.super.priority;
+    new_task->repo_entry = NULL;
+    new_task->data._f_Y.source_repo_entry = NULL;
+    new_task->data._f_Y.source_repo       = NULL;
+    new_task->data._f_Y.data_in         = NULL;
+    new_task->data._f_Y.data_out        = NULL;
+    new_task->data._f_Y.fulfill         = 0;
+    new_task->data._f_Z.source_repo_entry = NULL;
+    new_task->data._f_Z.source_repo       = NULL;
+    new_task->data._f_Z.data_in         = NULL;
+    new_task->data._f_Z.data_out        = NULL;
+    new_task->data._f_Z.fulfill         = 0;
+#if defined(PARSEC_DEBUG_NOISIER)
+    {
+      char tmp[128];
+      PARSEC_DEBUG_VERBOSE(10, parsec_debug_output, "Add startup task %s to vpid %d",
+             parsec_task_snprintf(tmp, 128, (parsec_task_t*)new_task), vpid);
+    }
+#endif
+    parsec_dependencies_mark_task_as_startup((parsec_task_t*)new_task, es);
+    pready_ring[vpid] = parsec_list_item_ring_push_sorted(pready_ring[vpid],
+                                                          (parsec_list_item_t*)new_task,
+                                                          parsec_execution_context_priority_comparator);
+    nb_tasks++;
+   restore_context_0:  /* we jump here just so that we have code after the label */
+    restore_context = 0;
+    (void)restore_context;
+    if( nb_tasks > this_task->locals.reserved[0].value ) {
+      if( (size_t)this_task->locals.reserved[0].value < parsec_task_startup_iter ) this_task->locals.reserved[0].value <<= 1;
+      __parsec_schedule_vp(es, (parsec_task_t**)pready_ring, 0);
+      total_nb_tasks += nb_tasks;
+      nb_tasks = 0;
+      if( total_nb_tasks > parsec_task_startup_chunk ) {  /* stop here and request to be rescheduled */
+        return PARSEC_HOOK_RETURN_AGAIN;
+      }
+    }
+  } /* Loop on normal range zero */
+  (void)vpid;
+  if( 0 != nb_tasks ) {
+    __parsec_schedule_vp(es, (parsec_task_t**)pready_ring, 0);
+    nb_tasks = 0;
+  }
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static const __parsec_chore_t __local_indices_tG_chores[] ={
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+    { .type     = PARSEC_DEV_CPU,
+      .evaluate = (parsec_evaluate_function_t*)NULL,
+      .hook     = (parsec_hook_t*)hook_of_local_indices_tG },
+#endif  /* defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+    { .type     = PARSEC_DEV_NONE,
+      .evaluate = NULL,
+      .hook     = (parsec_hook_t*)NULL },  /* End marker */
+};
+
+static const parsec_task_class_t local_indices_tG = {
+  .name = "tG",
+  .task_class_id = 1,
+  .nb_flows = 2,
+  .nb_parameters = 1,
+  .nb_locals = 1,
+  .task_class_type = PARSEC_TASK_CLASS_TYPE_PTG,
+  .params = { &symb_local_indices_tG_zero, NULL },
+  .locals = { &symb_local_indices_tG_zero, NULL },
+  .data_affinity = (parsec_data_ref_fn_t*)affinity_of_local_indices_tG,
+  .initial_data = (parsec_data_ref_fn_t*)affinity_of_local_indices_tG,
+  .final_data = (parsec_data_ref_fn_t*)affinity_of_local_indices_tG,
+  .priority = NULL,
+  .properties = properties_of_local_indices_tG,
+#if MAX_PARAM_COUNT < 0  /* number of read flows of tG */
+  #error Too many read flows for task tG
+#endif  /* MAX_PARAM_COUNT */
+#if MAX_PARAM_COUNT < 0  /* number of write flows of tG */
+  #error Too many write flows for task tG
+#endif  /* MAX_PARAM_COUNT */
+  .in = { &flow_of_local_indices_tG_for_Y, &flow_of_local_indices_tG_for_Z, NULL },
+  .out = { NULL },
+  .flags = 0x0 | PARSEC_HAS_IN_IN_DEPENDENCIES|PARSEC_HAS_CTL_GATHER,
+  .dependencies_goal = 2,
+  .make_key = __jdf2c_make_key_tG,
+  .task_snprintf = parsec_task_snprintf,
+#if defined(PARSEC_PROF_TRACE)
+  .profile_info = &parsec_task_profile_info,
+#endif
+  .key_functions = &__jdf2c_key_fns_tG,
+  .fini = (parsec_hook_t*)NULL,
+  .incarnations = __local_indices_tG_chores,
+  .find_deps = parsec_hash_find_deps,
+  .update_deps = parsec_update_deps_with_counter,
+  .iterate_successors = (parsec_traverse_function_t*)NULL,
+  .iterate_predecessors = (parsec_traverse_function_t*)iterate_predecessors_of_local_indices_tG,
+  .release_deps = (parsec_release_deps_t*)release_deps_of_local_indices_tG,
+  .prepare_output = (parsec_hook_t*)NULL,
+  .prepare_input = (parsec_hook_t*)data_lookup_of_local_indices_tG,
+  .time_estimate = NULL,
+  .get_datatype = datatype_lookup_of_local_indices_tG,
+  .complete_execution = (parsec_hook_t*)complete_hook_of_local_indices_tG,
+  .release_task = &release_task_of_local_indices_tG,
+#if defined(PARSEC_SIM)
+  .sim_cost_fct = (parsec_sim_cost_fct_t*)NULL,
+#endif
+};
+
+
+/******                                    STARTUP                                    ******/
+
+static inline int32_t rangemin_of_expr_of_symb_local_indices_STARTUP_odd_fct(const __parsec_local_indices_internal_taskpool_t *__parsec_tp, __parsec_local_indices_STARTUP_parsec_assignment_t *locals)
+{
+  int32_t __parsec_ret;
+  const int odd = locals->odd.value; (void)odd;
+  const int even = locals->even.value; (void)even;
+
+  { /* New scope for local definition 'i' */ 
+    int i = 0;
+    locals->ldef[0].value = i;
+  __parsec_ret = local_indices_STARTUP_inline_c_expr3_line_26(__parsec_tp, locals);
+  }
+  (void)__parsec_tp;
+  return __parsec_ret;
+}
+static const parsec_expr_t rangemin_of_expr_of_symb_local_indices_STARTUP_odd = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)rangemin_of_expr_of_symb_local_indices_STARTUP_odd_fct }
+                   }
+};
+static inline int32_t rangemax_of_expr_of_symb_local_indices_STARTUP_odd_fct(const __parsec_local_indices_internal_taskpool_t *__parsec_tp, __parsec_local_indices_STARTUP_parsec_assignment_t *locals)
+{
+  int32_t __parsec_ret;
+  const int odd = locals->odd.value; (void)odd;
+  const int even = locals->even.value; (void)even;
+
+  { /* New scope for local definition 'i' */ 
+    int i = local_indices_STARTUP_inline_c_expr4_line_26(__parsec_tp, locals);
+    locals->ldef[0].value = i;
+  __parsec_ret = local_indices_STARTUP_inline_c_expr3_line_26(__parsec_tp, locals);
+  }
+  (void)__parsec_tp; (void)locals;
+  return __parsec_ret;
+}
+static const parsec_expr_t rangemax_of_expr_of_symb_local_indices_STARTUP_odd = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)rangemax_of_expr_of_symb_local_indices_STARTUP_odd_fct }
+                   }
+};
+static inline int32_t rangeincrement_of_expr_of_symb_local_indices_STARTUP_odd_fct(const __parsec_local_indices_internal_taskpool_t *__parsec_tp, __parsec_local_indices_STARTUP_parsec_assignment_t *locals)
+{
+  int32_t __parsec_ret;
+  const int odd = locals->odd.value; (void)odd;
+  const int even = locals->even.value; (void)even;
+
+  { /* New scope for local index 'i' */ 
+    int i = locals->ldef[0].value;
+    i += 1;
+    locals->ldef[0].value = i;
+  __parsec_ret = local_indices_STARTUP_inline_c_expr3_line_26(__parsec_tp, locals);
+  }
+  (void)__parsec_tp;
+  return __parsec_ret;
+}
+static const parsec_expr_t rangeincrement_of_expr_of_symb_local_indices_STARTUP_odd = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)rangeincrement_of_expr_of_symb_local_indices_STARTUP_odd_fct }
+                   }
+};
+static const parsec_expr_t expr_of_symb_local_indices_STARTUP_odd = {
+  .op = PARSEC_EXPR_OP_RANGE_EXPR_INCREMENT,
+  .u_expr.range = {
+    .op1 = &rangemin_of_expr_of_symb_local_indices_STARTUP_odd,
+    .op2 = &rangemax_of_expr_of_symb_local_indices_STARTUP_odd,
+    .increment.expr = &rangeincrement_of_expr_of_symb_local_indices_STARTUP_odd
+  }
+};
+static const parsec_symbol_t symb_local_indices_STARTUP_odd = { .name = "odd", .context_index = 0, .min = &expr_of_symb_local_indices_STARTUP_odd, .max = &expr_of_symb_local_indices_STARTUP_odd, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t rangemin_of_expr_of_symb_local_indices_STARTUP_even_fct(const __parsec_local_indices_internal_taskpool_t *__parsec_tp, __parsec_local_indices_STARTUP_parsec_assignment_t *locals)
+{
+  int32_t __parsec_ret;
+  const int odd = locals->odd.value; (void)odd;
+  const int even = locals->even.value; (void)even;
+
+  { /* New scope for local definition 'i' */ 
+    int i = 0;
+    locals->ldef[1].value = i;
+  __parsec_ret = (2 * i);
+  }
+  (void)__parsec_tp;
+  return __parsec_ret;
+}
+static const parsec_expr_t rangemin_of_expr_of_symb_local_indices_STARTUP_even = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)rangemin_of_expr_of_symb_local_indices_STARTUP_even_fct }
+                   }
+};
+static inline int32_t rangemax_of_expr_of_symb_local_indices_STARTUP_even_fct(const __parsec_local_indices_internal_taskpool_t *__parsec_tp, __parsec_local_indices_STARTUP_parsec_assignment_t *locals)
+{
+  int32_t __parsec_ret;
+  const int odd = locals->odd.value; (void)odd;
+  const int even = locals->even.value; (void)even;
+
+  { /* New scope for local definition 'i' */ 
+    int i = 4;
+    locals->ldef[1].value = i;
+  __parsec_ret = (2 * i);
+  }
+  (void)__parsec_tp; (void)locals;
+  return __parsec_ret;
+}
+static const parsec_expr_t rangemax_of_expr_of_symb_local_indices_STARTUP_even = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)rangemax_of_expr_of_symb_local_indices_STARTUP_even_fct }
+                   }
+};
+static inline int32_t rangeincrement_of_expr_of_symb_local_indices_STARTUP_even_fct(const __parsec_local_indices_internal_taskpool_t *__parsec_tp, __parsec_local_indices_STARTUP_parsec_assignment_t *locals)
+{
+  int32_t __parsec_ret;
+  const int odd = locals->odd.value; (void)odd;
+  const int even = locals->even.value; (void)even;
+
+  { /* New scope for local index 'i' */ 
+    int i = locals->ldef[1].value;
+    i += 1;
+    locals->ldef[1].value = i;
+  __parsec_ret = (2 * i);
+  }
+  (void)__parsec_tp;
+  return __parsec_ret;
+}
+static const parsec_expr_t rangeincrement_of_expr_of_symb_local_indices_STARTUP_even = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)rangeincrement_of_expr_of_symb_local_indices_STARTUP_even_fct }
+                   }
+};
+static const parsec_expr_t expr_of_symb_local_indices_STARTUP_even = {
+  .op = PARSEC_EXPR_OP_RANGE_EXPR_INCREMENT,
+  .u_expr.range = {
+    .op1 = &rangemin_of_expr_of_symb_local_indices_STARTUP_even,
+    .op2 = &rangemax_of_expr_of_symb_local_indices_STARTUP_even,
+    .increment.expr = &rangeincrement_of_expr_of_symb_local_indices_STARTUP_even
+  }
+};
+static const parsec_symbol_t symb_local_indices_STARTUP_even = { .name = "even", .context_index = 1, .min = &expr_of_symb_local_indices_STARTUP_even, .max = &expr_of_symb_local_indices_STARTUP_even, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int affinity_of_local_indices_STARTUP(const __parsec_local_indices_STARTUP_task_t *this_task,
+                     parsec_data_ref_t *ref)
+{
+    const __parsec_local_indices_internal_taskpool_t *__parsec_tp = (const __parsec_local_indices_internal_taskpool_t*)this_task->taskpool;
+  const int odd = this_task->locals.odd.value; (void)odd;
+  const int even = this_task->locals.even.value; (void)even;
+
+  /* Silent Warnings: should look into predicate to know what variables are usefull */
+  (void)odd;
+  (void)even;
+  ref->dc = (parsec_data_collection_t *)__parsec_tp->super._g_descA;
+  /* Compute data key */
+  ref->key = ref->dc->data_key(ref->dc, ((odd / 2) % descA->super.mt), ((even / 2) % descA->super.nt));
+  return 1;
+}
+static const parsec_property_t properties_of_local_indices_STARTUP[1] = {
+  {.name = NULL, .expr = NULL}
+};
+static parsec_data_t *flow_of_local_indices_STARTUP_for_A_dep1_atline_31_direct_access(const __parsec_local_indices_internal_taskpool_t *__parsec_tp, const __parsec_local_indices_STARTUP_parsec_assignment_t *assignments)
+{
+  const int odd = assignments->odd.value; (void)odd;
+  const int even = assignments->even.value; (void)even;
+
+  /* Silence Warnings: should look into parameters to know what variables are useful */
+  (void)odd;
+  (void)even;
+  if( __parsec_tp->super.super.context->my_rank == (int32_t)rank_of_descA(((odd / 2) % descA->super.mt), ((even / 2) % descA->super.nt)) )
+    return data_of_descA(((odd / 2) % descA->super.mt), ((even / 2) % descA->super.nt));
+  return NULL;
+}
+
+static const parsec_dep_t flow_of_local_indices_STARTUP_for_A_dep1_atline_31 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = PARSEC_LOCAL_DATA_TASK_CLASS_ID, /* local_indices_descA */
+  .direct_data = (parsec_data_lookup_func_t)&flow_of_local_indices_STARTUP_for_A_dep1_atline_31_direct_access,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_local_indices_STARTUP_for_A,
+};
+static inline int32_t rangemin_of_expr_of_cond_for_flow_of_local_indices_STARTUP_for_A_dep2_atline_32_iftrue_fct(const __parsec_local_indices_internal_taskpool_t *__parsec_tp, __parsec_local_indices_STARTUP_parsec_assignment_t *locals)
+{
+  int32_t __parsec_ret;
+  const int odd = locals->odd.value;
+  const int even = locals->even.value; (void)even;
+
+  { /* New scope for local definition 'i' */ 
+    int i = 0;
+    locals->ldef[2].value = i;
+  __parsec_ret = (odd) < (4);
+  }
+  (void)__parsec_tp;
+  return __parsec_ret;
+}
+static const parsec_expr_t rangemin_of_expr_of_cond_for_flow_of_local_indices_STARTUP_for_A_dep2_atline_32_iftrue = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)rangemin_of_expr_of_cond_for_flow_of_local_indices_STARTUP_for_A_dep2_atline_32_iftrue_fct }
+                   }
+};
+static inline int32_t rangemax_of_expr_of_cond_for_flow_of_local_indices_STARTUP_for_A_dep2_atline_32_iftrue_fct(const __parsec_local_indices_internal_taskpool_t *__parsec_tp, __parsec_local_indices_STARTUP_parsec_assignment_t *locals)
+{
+  int32_t __parsec_ret;
+  const int odd = locals->odd.value;
+  const int even = locals->even.value; (void)even;
+
+  { /* New scope for local definition 'i' */ 
+    int i = odd;
+    locals->ldef[2].value = i;
+  __parsec_ret = (odd) < (4);
+  }
+  (void)__parsec_tp; (void)locals;
+  return __parsec_ret;
+}
+static const parsec_expr_t rangemax_of_expr_of_cond_for_flow_of_local_indices_STARTUP_for_A_dep2_atline_32_iftrue = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)rangemax_of_expr_of_cond_for_flow_of_local_indices_STARTUP_for_A_dep2_atline_32_iftrue_fct }
+                   }
+};
+static inline int32_t rangeincrement_of_expr_of_cond_for_flow_of_local_indices_STARTUP_for_A_dep2_atline_32_iftrue_fct(const __parsec_local_indices_internal_taskpool_t *__parsec_tp, __parsec_local_indices_STARTUP_parsec_assignment_t *locals)
+{
+  int32_t __parsec_ret;
+  const int odd = locals->odd.value;
+  const int even = locals->even.value; (void)even;
+
+  { /* New scope for local index 'i' */ 
+    int i = locals->ldef[2].value;
+    i += 1;
+    locals->ldef[2].value = i;
+  __parsec_ret = (odd) < (4);
+  }
+  (void)__parsec_tp;
+  return __parsec_ret;
+}
+static const parsec_expr_t rangeincrement_of_expr_of_cond_for_flow_of_local_indices_STARTUP_for_A_dep2_atline_32_iftrue = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)rangeincrement_of_expr_of_cond_for_flow_of_local_indices_STARTUP_for_A_dep2_atline_32_iftrue_fct }
+                   }
+};
+static const parsec_expr_t expr_of_cond_for_flow_of_local_indices_STARTUP_for_A_dep2_atline_32_iftrue = {
+  .op = PARSEC_EXPR_OP_RANGE_EXPR_INCREMENT,
+  .u_expr.range = {
+    .op1 = &rangemin_of_expr_of_cond_for_flow_of_local_indices_STARTUP_for_A_dep2_atline_32_iftrue,
+    .op2 = &rangemax_of_expr_of_cond_for_flow_of_local_indices_STARTUP_for_A_dep2_atline_32_iftrue,
+    .increment.expr = &rangeincrement_of_expr_of_cond_for_flow_of_local_indices_STARTUP_for_A_dep2_atline_32_iftrue
+  }
+};
+static const parsec_dep_t flow_of_local_indices_STARTUP_for_A_dep2_atline_32_iftrue = {
+  .cond = &expr_of_cond_for_flow_of_local_indices_STARTUP_for_A_dep2_atline_32_iftrue,  /* (odd) < (4) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 2, /* local_indices_tA */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_local_indices_tA_for_A,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_local_indices_STARTUP_for_A,
+};
+static inline int expr_of_cond_for_flow_of_local_indices_STARTUP_for_A_dep2_atline_32_iffalse_fct(const __parsec_local_indices_internal_taskpool_t *__parsec_tp, const __parsec_local_indices_STARTUP_parsec_assignment_t *locals)
+{
+  const int odd = locals->odd.value;
+  const int even = locals->even.value; (void)even;
+
+  (void)odd;
+  (void)even;
+  (void)__parsec_tp; (void)locals;
+  return !((odd) < (4));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_local_indices_STARTUP_for_A_dep2_atline_32_iffalse = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_local_indices_STARTUP_for_A_dep2_atline_32_iffalse_fct }
+                   }
+};
+static const parsec_dep_t flow_of_local_indices_STARTUP_for_A_dep2_atline_32_iffalse = {
+  .cond = &expr_of_cond_for_flow_of_local_indices_STARTUP_for_A_dep2_atline_32_iffalse,  /* !(odd) < (4) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 3, /* local_indices_tB */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_local_indices_tB_for_A,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_local_indices_STARTUP_for_A,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+#if MAX_DEP_OUT_COUNT < 1  /* number of output dependencies */
+    #error Too many output dependencies (supports up to MAX_DEP_OUT_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_OUT_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_local_indices_STARTUP_for_A = {
+  .name               = "A",
+  .sym_type           = PARSEC_SYM_INOUT,
+  .flow_flags         = PARSEC_FLOW_ACCESS_READ|PARSEC_FLOW_HAS_IN_DEPS,
+  .flow_index         = 0,
+  .flow_datatype_mask = 0x1,
+  .dep_in     = { &flow_of_local_indices_STARTUP_for_A_dep1_atline_31 },
+  .dep_out    = { &flow_of_local_indices_STARTUP_for_A_dep2_atline_32_iftrue,
+ &flow_of_local_indices_STARTUP_for_A_dep2_atline_32_iffalse }
+};
+
+static inline int32_t rangemin_of_expr_of_cond_for_flow_of_local_indices_STARTUP_for_X_dep1_atline_34_fct(const __parsec_local_indices_internal_taskpool_t *__parsec_tp, __parsec_local_indices_STARTUP_parsec_assignment_t *locals)
+{
+  int32_t __parsec_ret;
+  const int odd = locals->odd.value; (void)odd;
+  const int even = locals->even.value; (void)even;
+
+  { /* New scope for local definition 'i' */ 
+    int i = 0;
+    locals->ldef[2].value = i;
+  __parsec_ret = (i) == (-1);
+  }
+  (void)__parsec_tp;
+  return __parsec_ret;
+}
+static const parsec_expr_t rangemin_of_expr_of_cond_for_flow_of_local_indices_STARTUP_for_X_dep1_atline_34 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)rangemin_of_expr_of_cond_for_flow_of_local_indices_STARTUP_for_X_dep1_atline_34_fct }
+                   }
+};
+static inline int32_t rangemax_of_expr_of_cond_for_flow_of_local_indices_STARTUP_for_X_dep1_atline_34_fct(const __parsec_local_indices_internal_taskpool_t *__parsec_tp, __parsec_local_indices_STARTUP_parsec_assignment_t *locals)
+{
+  int32_t __parsec_ret;
+  const int odd = locals->odd.value; (void)odd;
+  const int even = locals->even.value; (void)even;
+
+  { /* New scope for local definition 'i' */ 
+    int i = odd;
+    locals->ldef[2].value = i;
+  __parsec_ret = (i) == (-1);
+  }
+  (void)__parsec_tp; (void)locals;
+  return __parsec_ret;
+}
+static const parsec_expr_t rangemax_of_expr_of_cond_for_flow_of_local_indices_STARTUP_for_X_dep1_atline_34 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)rangemax_of_expr_of_cond_for_flow_of_local_indices_STARTUP_for_X_dep1_atline_34_fct }
+                   }
+};
+static inline int32_t rangeincrement_of_expr_of_cond_for_flow_of_local_indices_STARTUP_for_X_dep1_atline_34_fct(const __parsec_local_indices_internal_taskpool_t *__parsec_tp, __parsec_local_indices_STARTUP_parsec_assignment_t *locals)
+{
+  int32_t __parsec_ret;
+  const int odd = locals->odd.value; (void)odd;
+  const int even = locals->even.value; (void)even;
+
+  { /* New scope for local index 'i' */ 
+    int i = locals->ldef[2].value;
+    i += 1;
+    locals->ldef[2].value = i;
+  __parsec_ret = (i) == (-1);
+  }
+  (void)__parsec_tp;
+  return __parsec_ret;
+}
+static const parsec_expr_t rangeincrement_of_expr_of_cond_for_flow_of_local_indices_STARTUP_for_X_dep1_atline_34 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)rangeincrement_of_expr_of_cond_for_flow_of_local_indices_STARTUP_for_X_dep1_atline_34_fct }
+                   }
+};
+static const parsec_expr_t expr_of_cond_for_flow_of_local_indices_STARTUP_for_X_dep1_atline_34 = {
+  .op = PARSEC_EXPR_OP_RANGE_EXPR_INCREMENT,
+  .u_expr.range = {
+    .op1 = &rangemin_of_expr_of_cond_for_flow_of_local_indices_STARTUP_for_X_dep1_atline_34,
+    .op2 = &rangemax_of_expr_of_cond_for_flow_of_local_indices_STARTUP_for_X_dep1_atline_34,
+    .increment.expr = &rangeincrement_of_expr_of_cond_for_flow_of_local_indices_STARTUP_for_X_dep1_atline_34
+  }
+};
+static inline int ctl_gather_compute_for_dep_flow_of_local_indices_STARTUP_for_X_dep1_atline_34_fct(const __parsec_local_indices_internal_taskpool_t *__parsec_tp, const __parsec_local_indices_STARTUP_parsec_assignment_t *assignments)
+{
+  int   __nb_found = 0;
+  __parsec_local_indices_STARTUP_parsec_assignment_t __jdf2c__tmp_locals = *assignments;
+  (void)__parsec_tp;
+  const int odd = __jdf2c__tmp_locals.odd.value; (void)odd;
+  const int even = __jdf2c__tmp_locals.even.value; (void)even;
+  (void)odd; (void)even;
+  int i = __jdf2c__tmp_locals.ldef[2].value;
+  (void)i;
+  int STARTUP_odd = 0;
+  (void)STARTUP_odd;
+  int STARTUP_even = 0;
+  (void)STARTUP_even;
+  __nb_found++;
+  return __nb_found;
+}
+
+static const parsec_expr_t ctl_gather_compute_for_dep_flow_of_local_indices_STARTUP_for_X_dep1_atline_34 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)ctl_gather_compute_for_dep_flow_of_local_indices_STARTUP_for_X_dep1_atline_34_fct }
+                   }
+};
+
+static const parsec_dep_t flow_of_local_indices_STARTUP_for_X_dep1_atline_34 = {
+  .cond = &expr_of_cond_for_flow_of_local_indices_STARTUP_for_X_dep1_atline_34,  /* (i) == (-1) */
+  .ctl_gather_nb = &ctl_gather_compute_for_dep_flow_of_local_indices_STARTUP_for_X_dep1_atline_34,
+  .task_class_id = 0, /* local_indices_STARTUP */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_local_indices_STARTUP_for_X,
+  .dep_index = 1,
+  .dep_datatype_index = 1,
+  .belongs_to = &flow_of_local_indices_STARTUP_for_X,
+};
+static inline int32_t rangemin_of_expr_of_cond_for_flow_of_local_indices_STARTUP_for_X_dep2_atline_35_fct(const __parsec_local_indices_internal_taskpool_t *__parsec_tp, __parsec_local_indices_STARTUP_parsec_assignment_t *locals)
+{
+  int32_t __parsec_ret;
+  const int odd = locals->odd.value; (void)odd;
+  const int even = locals->even.value; (void)even;
+
+  { /* New scope for local definition 'i' */ 
+    int i = 0;
+    locals->ldef[2].value = i;
+  __parsec_ret = (i) == (-1);
+  }
+  (void)__parsec_tp;
+  return __parsec_ret;
+}
+static const parsec_expr_t rangemin_of_expr_of_cond_for_flow_of_local_indices_STARTUP_for_X_dep2_atline_35 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)rangemin_of_expr_of_cond_for_flow_of_local_indices_STARTUP_for_X_dep2_atline_35_fct }
+                   }
+};
+static inline int32_t rangemax_of_expr_of_cond_for_flow_of_local_indices_STARTUP_for_X_dep2_atline_35_fct(const __parsec_local_indices_internal_taskpool_t *__parsec_tp, __parsec_local_indices_STARTUP_parsec_assignment_t *locals)
+{
+  int32_t __parsec_ret;
+  const int odd = locals->odd.value; (void)odd;
+  const int even = locals->even.value; (void)even;
+
+  { /* New scope for local definition 'i' */ 
+    int i = odd;
+    locals->ldef[2].value = i;
+  __parsec_ret = (i) == (-1);
+  }
+  (void)__parsec_tp; (void)locals;
+  return __parsec_ret;
+}
+static const parsec_expr_t rangemax_of_expr_of_cond_for_flow_of_local_indices_STARTUP_for_X_dep2_atline_35 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)rangemax_of_expr_of_cond_for_flow_of_local_indices_STARTUP_for_X_dep2_atline_35_fct }
+                   }
+};
+static inline int32_t rangeincrement_of_expr_of_cond_for_flow_of_local_indices_STARTUP_for_X_dep2_atline_35_fct(const __parsec_local_indices_internal_taskpool_t *__parsec_tp, __parsec_local_indices_STARTUP_parsec_assignment_t *locals)
+{
+  int32_t __parsec_ret;
+  const int odd = locals->odd.value; (void)odd;
+  const int even = locals->even.value; (void)even;
+
+  { /* New scope for local index 'i' */ 
+    int i = locals->ldef[2].value;
+    i += 1;
+    locals->ldef[2].value = i;
+  __parsec_ret = (i) == (-1);
+  }
+  (void)__parsec_tp;
+  return __parsec_ret;
+}
+static const parsec_expr_t rangeincrement_of_expr_of_cond_for_flow_of_local_indices_STARTUP_for_X_dep2_atline_35 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)rangeincrement_of_expr_of_cond_for_flow_of_local_indices_STARTUP_for_X_dep2_atline_35_fct }
+                   }
+};
+static const parsec_expr_t expr_of_cond_for_flow_of_local_indices_STARTUP_for_X_dep2_atline_35 = {
+  .op = PARSEC_EXPR_OP_RANGE_EXPR_INCREMENT,
+  .u_expr.range = {
+    .op1 = &rangemin_of_expr_of_cond_for_flow_of_local_indices_STARTUP_for_X_dep2_atline_35,
+    .op2 = &rangemax_of_expr_of_cond_for_flow_of_local_indices_STARTUP_for_X_dep2_atline_35,
+    .increment.expr = &rangeincrement_of_expr_of_cond_for_flow_of_local_indices_STARTUP_for_X_dep2_atline_35
+  }
+};
+static const parsec_dep_t flow_of_local_indices_STARTUP_for_X_dep2_atline_35 = {
+  .cond = &expr_of_cond_for_flow_of_local_indices_STARTUP_for_X_dep2_atline_35,  /* (i) == (-1) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 0, /* local_indices_STARTUP */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_local_indices_STARTUP_for_X,
+  .dep_index = 1,
+  .dep_datatype_index = 1,
+  .belongs_to = &flow_of_local_indices_STARTUP_for_X,
+};
+static const parsec_dep_t flow_of_local_indices_STARTUP_for_X_dep3_atline_36 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 1, /* local_indices_tG */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_local_indices_tG_for_Y,
+  .dep_index = 2,
+  .dep_datatype_index = 1,
+  .belongs_to = &flow_of_local_indices_STARTUP_for_X,
+};
+static const parsec_dep_t flow_of_local_indices_STARTUP_for_X_dep4_atline_37 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 1, /* local_indices_tG */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_local_indices_tG_for_Z,
+  .dep_index = 3,
+  .dep_datatype_index = 1,
+  .belongs_to = &flow_of_local_indices_STARTUP_for_X,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+#if MAX_DEP_OUT_COUNT < 3  /* number of output dependencies */
+    #error Too many output dependencies (supports up to MAX_DEP_OUT_COUNT [=10] but found 3). Fix the code or recompile PaRSEC with a larger MAX_DEP_OUT_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_local_indices_STARTUP_for_X = {
+  .name               = "X",
+  .sym_type           = PARSEC_SYM_INOUT,
+  .flow_flags         = PARSEC_FLOW_ACCESS_NONE|PARSEC_FLOW_HAS_IN_DEPS,
+  .flow_index         = 1,
+  .flow_datatype_mask = 0x2,
+  .dep_in     = { &flow_of_local_indices_STARTUP_for_X_dep1_atline_34 },
+  .dep_out    = { &flow_of_local_indices_STARTUP_for_X_dep2_atline_35,
+ &flow_of_local_indices_STARTUP_for_X_dep3_atline_36,
+ &flow_of_local_indices_STARTUP_for_X_dep4_atline_37 }
+};
+
+static void
+iterate_successors_of_local_indices_STARTUP(parsec_execution_stream_t *es, const __parsec_local_indices_STARTUP_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_local_indices_internal_taskpool_t *__parsec_tp = (const __parsec_local_indices_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_local_indices_STARTUP_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_local_indices_STARTUP_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int odd = __jdf2c__tmp_locals.odd.value; (void)odd;
+  const int even = __jdf2c__tmp_locals.even.value; (void)even;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)odd;  (void)even;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_descA(((odd / 2) % descA->super.mt), ((even / 2) % descA->super.nt));
+#endif
+  if( action_mask & 0x1 ) {  /* Flow of data A [0] */
+    data.data   = this_task->data._f_A.data_out;
+    data.data_future  = NULL;
+  int i;
+  for( i = 0;i <= odd; i+=1) {
+  __jdf2c__tmp_locals.ldef[2].value = i;
+    if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_local_indices_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_local_indices_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+       if( (odd) < (4) ) {
+      __parsec_local_indices_tA_task_t* ncc = (__parsec_local_indices_tA_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[local_indices_tA.task_class_id];
+        int j;
+      for( j = 0;j <= local_indices_STARTUP_inline_c_expr2_line_32(__parsec_tp, &__jdf2c__tmp_locals); j+=2) {
+        __jdf2c__tmp_locals.ldef[3].value = j;
+          const int tA_o = odd;
+          /* We cannot check if tA_o is within the iterator space, because that space is defined with local indices. We need to trust */
+          assert(&nc.locals[0].value == &ncc->locals.o.value);
+          ncc->locals.o.value = tA_o;
+          const int tA_e = even;
+          /* We cannot check if tA_e is within the iterator space, because that space is defined with local indices. We need to trust */
+          assert(&nc.locals[1].value == &ncc->locals.e.value);
+          ncc->locals.e.value = tA_e;
+          const int tA_i = local_indices_STARTUP_inline_c_expr1_line_32(__parsec_tp, &__jdf2c__tmp_locals);
+          if( (tA_i >= (0)) && (tA_i <= ((((ncc->locals.o.value) < (4)) ? (ncc->locals.o.value) : (-1)))) ) {
+            assert(&nc.locals[2].value == &ncc->locals.i.value);
+            ncc->locals.i.value = tA_i;
+            const int tA_j = (j / 2);
+            if( (tA_j >= (0)) && (tA_j <= ((ncc->locals.e.value / 2))) ) {
+              assert(&nc.locals[3].value == &ncc->locals.j.value);
+              ncc->locals.j.value = tA_j;
+#if defined(DISTRIBUTED)
+              rank_dst = rank_of_descA((ncc->locals.i.value % descA->super.mt), (ncc->locals.j.value % descA->super.nt));
+              if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+                vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, (ncc->locals.i.value % descA->super.mt), (ncc->locals.j.value % descA->super.nt));
+              nc.priority = __parsec_tp->super.super.priority;
+              successor_repo = tA_repo;
+              successor_repo_key = __jdf2c_make_key_tA((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+            RELEASE_DEP_OUTPUT(es, "A", this_task, "A", &nc, rank_src, rank_dst, &data);
+            if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_local_indices_STARTUP_for_A_dep2_atline_32_iftrue, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+              }
+            }
+          }
+    } else {
+      __parsec_local_indices_tB_task_t* ncc = (__parsec_local_indices_tB_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[local_indices_tB.task_class_id];
+        int j;
+      for( j = 0;j <= even; j+=2) {
+        __jdf2c__tmp_locals.ldef[3].value = j;
+          const int tB_o = odd;
+          /* We cannot check if tB_o is within the iterator space, because that space is defined with local indices. We need to trust */
+          assert(&nc.locals[0].value == &ncc->locals.o.value);
+          ncc->locals.o.value = tB_o;
+          const int tB_e = even;
+          /* We cannot check if tB_e is within the iterator space, because that space is defined with local indices. We need to trust */
+          assert(&nc.locals[1].value == &ncc->locals.e.value);
+          ncc->locals.e.value = tB_e;
+          const int tB_i = i;
+          if( (tB_i >= (6)) && (tB_i <= (ncc->locals.o.value)) ) {
+            assert(&nc.locals[2].value == &ncc->locals.i.value);
+            ncc->locals.i.value = tB_i;
+            const int tB_j = (j / 2);
+            if( (tB_j >= (0)) && (tB_j <= ((ncc->locals.e.value / 2))) ) {
+              assert(&nc.locals[3].value == &ncc->locals.j.value);
+              ncc->locals.j.value = tB_j;
+#if defined(DISTRIBUTED)
+              rank_dst = rank_of_descA((ncc->locals.i.value % descA->super.mt), (ncc->locals.j.value % descA->super.nt));
+              if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+                vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, (ncc->locals.i.value % descA->super.mt), (ncc->locals.j.value % descA->super.nt));
+              nc.priority = __parsec_tp->super.super.priority;
+              successor_repo = tB_repo;
+              successor_repo_key = __jdf2c_make_key_tB((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+            RELEASE_DEP_OUTPUT(es, "A", this_task, "A", &nc, rank_src, rank_dst, &data);
+            if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_local_indices_STARTUP_for_A_dep2_atline_32_iffalse, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+              }
+            }
+          }
+    }
+    }
+  }
+  if( action_mask & 0xe ) {  /* Flow of data X [1] */
+    data.data   = this_task->data._f_X.data_out;
+    data.data_future  = NULL;
+  int i;
+  for( i = 0;i <= odd; i+=1) {
+  __jdf2c__tmp_locals.ldef[2].value = i;
+  if( action_mask & 0x2 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  =   /* Control: always empty */ 0;
+    data.local.dst_count  =   /* Control: always empty */ 0;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = NULL;
+    data.remote.src_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.src_count  =   /* Control: always empty */ 0;
+    data.remote.dst_count  =   /* Control: always empty */ 0;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( (i) == (-1) ) {
+      __parsec_local_indices_STARTUP_task_t* ncc = (__parsec_local_indices_STARTUP_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[local_indices_STARTUP.task_class_id];
+        const int STARTUP_odd = 0;
+        /* We cannot check if STARTUP_odd is within the iterator space, because that space is defined with local indices. We need to trust */
+        assert(&nc.locals[0].value == &ncc->locals.odd.value);
+        ncc->locals.odd.value = STARTUP_odd;
+        const int STARTUP_even = 0;
+        /* We cannot check if STARTUP_even is within the iterator space, because that space is defined with local indices. We need to trust */
+        assert(&nc.locals[1].value == &ncc->locals.even.value);
+        ncc->locals.even.value = STARTUP_even;
+#if defined(DISTRIBUTED)
+        rank_dst = rank_of_descA(((ncc->locals.odd.value / 2) % descA->super.mt), ((ncc->locals.even.value / 2) % descA->super.nt));
+        if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+          vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, ((ncc->locals.odd.value / 2) % descA->super.mt), ((ncc->locals.even.value / 2) % descA->super.nt));
+        nc.priority = __parsec_tp->super.super.priority;
+        successor_repo = STARTUP_repo;
+        successor_repo_key = __jdf2c_make_key_STARTUP((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+      RELEASE_DEP_OUTPUT(es, "X", this_task, "X", &nc, rank_src, rank_dst, &data);
+      if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_local_indices_STARTUP_for_X_dep2_atline_35, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+    }
+  }
+    }
+  if( action_mask & 0x4 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  =   /* Control: always empty */ 0;
+    data.local.dst_count  =   /* Control: always empty */ 0;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = NULL;
+    data.remote.src_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.src_count  =   /* Control: always empty */ 0;
+    data.remote.dst_count  =   /* Control: always empty */ 0;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        __parsec_local_indices_tG_task_t* ncc = (__parsec_local_indices_tG_task_t*)&nc;
+    nc.task_class = __parsec_tp->super.super.task_classes_array[local_indices_tG.task_class_id];
+      const int tG_zero = 0;
+      if( (tG_zero >= (0)) && (tG_zero <= (0)) ) {
+        assert(&nc.locals[0].value == &ncc->locals.zero.value);
+        ncc->locals.zero.value = tG_zero;
+#if defined(DISTRIBUTED)
+        rank_dst = rank_of_descA(0, 0);
+        if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+          vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, 0, 0);
+        nc.priority = __parsec_tp->super.super.priority;
+        successor_repo = tG_repo;
+        successor_repo_key = __jdf2c_make_key_tG((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+      RELEASE_DEP_OUTPUT(es, "X", this_task, "Y", &nc, rank_src, rank_dst, &data);
+      if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_local_indices_STARTUP_for_X_dep3_atline_36, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+        }
+  }
+  if( action_mask & 0x8 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  =   /* Control: always empty */ 0;
+    data.local.dst_count  =   /* Control: always empty */ 0;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = NULL;
+    data.remote.src_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.src_count  =   /* Control: always empty */ 0;
+    data.remote.dst_count  =   /* Control: always empty */ 0;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        __parsec_local_indices_tG_task_t* ncc = (__parsec_local_indices_tG_task_t*)&nc;
+    nc.task_class = __parsec_tp->super.super.task_classes_array[local_indices_tG.task_class_id];
+      const int tG_zero = 0;
+      if( (tG_zero >= (0)) && (tG_zero <= (0)) ) {
+        assert(&nc.locals[0].value == &ncc->locals.zero.value);
+        ncc->locals.zero.value = tG_zero;
+#if defined(DISTRIBUTED)
+        rank_dst = rank_of_descA(0, 0);
+        if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+          vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, 0, 0);
+        nc.priority = __parsec_tp->super.super.priority;
+        successor_repo = tG_repo;
+        successor_repo_key = __jdf2c_make_key_tG((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+      RELEASE_DEP_OUTPUT(es, "X", this_task, "Z", &nc, rank_src, rank_dst, &data);
+      if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_local_indices_STARTUP_for_X_dep4_atline_37, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+        }
+  }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static void
+iterate_predecessors_of_local_indices_STARTUP(parsec_execution_stream_t *es, const __parsec_local_indices_STARTUP_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_local_indices_internal_taskpool_t *__parsec_tp = (const __parsec_local_indices_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_local_indices_STARTUP_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_local_indices_STARTUP_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int odd = __jdf2c__tmp_locals.odd.value; (void)odd;
+  const int even = __jdf2c__tmp_locals.even.value; (void)even;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)odd;  (void)even;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_descA(((odd / 2) % descA->super.mt), ((even / 2) % descA->super.nt));
+#endif
+  /* Flow of data A has only OUTPUT dependencies to Memory */
+  if( action_mask & 0x2 ) {  /* Flow of data X [1] */
+    data.data   = this_task->data._f_X.data_out;
+    data.data_future  = NULL;
+  int i;
+  for( i = 0;i <= odd; i+=1) {
+  __jdf2c__tmp_locals.ldef[2].value = i;
+  if( action_mask & 0x2 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  =   /* Control: always empty */ 0;
+    data.local.dst_count  =   /* Control: always empty */ 0;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = NULL;
+    data.remote.src_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.src_count  =   /* Control: always empty */ 0;
+    data.remote.dst_count  =   /* Control: always empty */ 0;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( (i) == (-1) ) {
+      __parsec_local_indices_STARTUP_task_t* ncc = (__parsec_local_indices_STARTUP_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[local_indices_STARTUP.task_class_id];
+        const int STARTUP_odd = 0;
+        /* We cannot check if STARTUP_odd is within the iterator space, because that space is defined with local indices. We need to trust */
+        assert(&nc.locals[0].value == &ncc->locals.odd.value);
+        ncc->locals.odd.value = STARTUP_odd;
+        const int STARTUP_even = 0;
+        /* We cannot check if STARTUP_even is within the iterator space, because that space is defined with local indices. We need to trust */
+        assert(&nc.locals[1].value == &ncc->locals.even.value);
+        ncc->locals.even.value = STARTUP_even;
+#if defined(DISTRIBUTED)
+        rank_dst = rank_of_descA(((ncc->locals.odd.value / 2) % descA->super.mt), ((ncc->locals.even.value / 2) % descA->super.nt));
+        if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+          vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, ((ncc->locals.odd.value / 2) % descA->super.mt), ((ncc->locals.even.value / 2) % descA->super.nt));
+        nc.priority = __parsec_tp->super.super.priority;
+        successor_repo = STARTUP_repo;
+        successor_repo_key = __jdf2c_make_key_STARTUP((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+      RELEASE_DEP_OUTPUT(es, "X", this_task, "X", &nc, rank_src, rank_dst, &data);
+      if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_local_indices_STARTUP_for_X_dep1_atline_34, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+    }
+  }
+    }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static int release_deps_of_local_indices_STARTUP(parsec_execution_stream_t *es, __parsec_local_indices_STARTUP_task_t *this_task, uint32_t action_mask, parsec_remote_deps_t *deps)
+{
+  PARSEC_PINS(es, RELEASE_DEPS_BEGIN, (parsec_task_t *)this_task);  const __parsec_local_indices_internal_taskpool_t *__parsec_tp = (const __parsec_local_indices_internal_taskpool_t *)this_task->taskpool;
+  parsec_release_dep_fct_arg_t arg;
+  int __vp_id;
+  int consume_local_repo = 0;
+  arg.action_mask = action_mask;
+  arg.output_entry = NULL;
+  arg.output_repo = NULL;
+#if defined(DISTRIBUTED)
+  arg.remote_deps = deps;
+#endif  /* defined(DISTRIBUTED) */
+  assert(NULL != es);
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS )    arg.ready_lists = alloca(sizeof(parsec_task_t *) * es->virtual_process->parsec_context->nb_vp);
+  else
+    arg.ready_lists = NULL;
+  for( __vp_id = 0; __vp_id < es->virtual_process->parsec_context->nb_vp; arg.ready_lists[__vp_id++] = NULL );
+  (void)__parsec_tp; (void)deps;
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_A.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_A.source_repo, this_task->data._f_A.source_repo_entry->ht_item.key );
+    }
+  }
+  consume_local_repo = (this_task->repo_entry != NULL);
+  arg.output_repo = STARTUP_repo;
+  arg.output_entry = this_task->repo_entry;
+  arg.output_usage = 0;
+  if( action_mask & (PARSEC_ACTION_RELEASE_LOCAL_DEPS | PARSEC_ACTION_GET_REPO_ENTRY) ) {
+    arg.output_entry = data_repo_lookup_entry_and_create( es, arg.output_repo, __jdf2c_make_key_STARTUP((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    arg.output_entry->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(arg.output_entry->sim_exec_date == 0);
+    arg.output_entry->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  if(action_mask & ( PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE ) ){
+    /* Generate the reshape promise for the outputs that need it */
+    iterate_successors_of_local_indices_STARTUP(es, this_task, action_mask, parsec_set_up_reshape_promise, &arg);
+   }
+  iterate_successors_of_local_indices_STARTUP(es, this_task, action_mask, parsec_release_dep_fct, &arg);
+
+#if defined(DISTRIBUTED)
+  if( (action_mask & PARSEC_ACTION_SEND_REMOTE_DEPS) && (NULL != arg.remote_deps)) {
+    parsec_remote_dep_activate(es, (parsec_task_t *)this_task, arg.remote_deps, arg.remote_deps->outgoing_mask);
+  }
+#endif
+
+  if(action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS) {
+    data_repo_entry_addto_usage_limit(STARTUP_repo, arg.output_entry->ht_item.key, arg.output_usage);
+    __parsec_schedule_vp(es, arg.ready_lists, 0);
+  }
+      if (consume_local_repo) {
+         data_repo_entry_used_once( STARTUP_repo, this_task->repo_entry->ht_item.key );
+      }
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_A.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_A.data_in);
+    }
+  }
+  PARSEC_PINS(es, RELEASE_DEPS_END, (parsec_task_t *)this_task);  return 0;
+}
+
+static int data_lookup_of_local_indices_STARTUP(parsec_execution_stream_t *es, __parsec_local_indices_STARTUP_task_t *this_task)
+{
+  const __parsec_local_indices_internal_taskpool_t *__parsec_tp = (__parsec_local_indices_internal_taskpool_t *)this_task->taskpool;
+  parsec_assignment_t generic_locals[MAX_PARAM_COUNT];  /* generic task locals */
+  int target_device = 0; (void)target_device;
+  (void)__parsec_tp; (void)generic_locals; (void)es;
+  parsec_data_copy_t *chunk = NULL;
+  data_repo_t        *reshape_repo  = NULL, *consumed_repo  = NULL;
+  data_repo_entry_t  *reshape_entry = NULL, *consumed_entry = NULL;
+  parsec_key_t        reshape_entry_key = 0, consumed_entry_key = 0;
+  uint8_t             consumed_flow_index;
+  parsec_dep_data_description_t data;
+  int ret;
+  (void)reshape_repo; (void)reshape_entry; (void)reshape_entry_key;
+  (void)consumed_repo; (void)consumed_entry; (void)consumed_entry_key;
+  (void)consumed_flow_index;
+  (void)chunk; (void)data; (void)ret;
+  const int odd = this_task->locals.odd.value; (void)odd;
+  const int even = this_task->locals.even.value; (void)even;
+  if( NULL == this_task->repo_entry ){
+    this_task->repo_entry = data_repo_lookup_entry_and_create(es, STARTUP_repo,                                       __jdf2c_make_key_STARTUP((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    data_repo_entry_addto_usage_limit(STARTUP_repo, this_task->repo_entry->ht_item.key, 1);    this_task->repo_entry ->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(this_task->repo_entry ->sim_exec_date == 0);
+    this_task->repo_entry ->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  /* The reshape repo is the current task repo. */  reshape_repo = STARTUP_repo;
+  reshape_entry_key = __jdf2c_make_key_STARTUP((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals) ;
+  reshape_entry = this_task->repo_entry;
+  /* Lookup the input data, and store them in the context if any */
+
+if(! this_task->data._f_A.fulfill ){ /* Flow A */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_A.data_out = NULL;  /* By default, if nothing matches */
+  /* Flow A [0] dependency [0] from memory descA */
+  if( NULL == (chunk = this_task->data._f_A.data_in) ) {
+  /* No data set up by predecessor on this task input flow */
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+  parsec_prof_grapher_data_input(data_of_descA(((odd / 2) % descA->super.mt), ((even / 2) % descA->super.nt)), (parsec_task_t*)this_task, &flow_of_local_indices_STARTUP_for_A, 1);
+#endif
+    chunk = parsec_data_get_copy(data_of_descA(((odd / 2) % descA->super.mt), ((even / 2) % descA->super.nt)), target_device);
+    data.data = chunk;
+    data.data_future  = NULL;
+        data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.data_future   = NULL;
+    if( (ret = parsec_get_copy_reshape_from_desc(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    this_task->data._f_A.data_out = chunk;
+    PARSEC_OBJ_RETAIN(chunk);
+  } 
+    this_task->data._f_A.data_in     = chunk;
+    this_task->data._f_A.source_repo       = consumed_repo;
+    this_task->data._f_A.source_repo_entry = consumed_entry;
+    if( this_task->data._f_A.source_repo_entry == this_task->repo_entry ){
+      /* in case we have consume from this task repo entry for the flow,
+       * it is cleaned up, avoiding having old stuff during release_deps_of
+       */
+      this_task->repo_entry->data[0] = NULL;
+    }
+    this_task->data._f_A.fulfill = 1;
+}
+
+  /* X is a control flow */
+  this_task->data._f_X.data_in         = NULL;
+  this_task->data._f_X.data_out        = NULL;
+  this_task->data._f_X.source_repo       = NULL;
+  this_task->data._f_X.source_repo_entry = NULL;
+  /** Generate profiling information */
+#if defined(PARSEC_PROF_TRACE)
+  this_task->prof_info.desc = (parsec_data_collection_t*)__parsec_tp->super._g_descA;
+  this_task->prof_info.priority = this_task->priority;
+  this_task->prof_info.data_id   = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->data_key((parsec_data_collection_t*)__parsec_tp->super._g_descA, ((odd / 2) % descA->super.mt), ((even / 2) % descA->super.nt));
+  this_task->prof_info.task_class_id = this_task->task_class->task_class_id;
+  this_task->prof_info.task_return_code = -1;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int datatype_lookup_of_local_indices_STARTUP(parsec_execution_stream_t *es, const parsec_task_t *this_generic_task, const parsec_task_t *parent_task,
+              uint32_t* flow_mask, parsec_dep_data_description_t* data)
+{
+  const __parsec_local_indices_STARTUP_task_t *this_task = (__parsec_local_indices_STARTUP_task_t*)this_generic_task;
+  const __parsec_local_indices_internal_taskpool_t *__parsec_tp = (__parsec_local_indices_internal_taskpool_t *)this_task->taskpool;
+  (void)__parsec_tp; (void)es; (void)this_task; (void)data; (void)parent_task;
+  const int odd = this_task->locals.odd.value; (void)odd;
+  const int even = this_task->locals.even.value; (void)even;
+  data->local.arena = data->remote.arena = NULL;
+  data->local.src_datatype  = data->local.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->local.src_count     = data->local.dst_count = 0;
+  data->local.src_displ     = data->local.dst_displ = 0;
+  data->data_future  = NULL;
+  if( (*flow_mask) & 0x80000000U ) { /* these are the input dependencies remote datatypes  */
+if( (*flow_mask) & 0x1U ) {  /* Flow A */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_local_indices_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_local_indices_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_local_indices_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+    goto no_mask_match;
+  }
+
+  /* these are the output dependencies remote datatypes */
+if( (*flow_mask) & 0x1U ) {  /* Flow A */
+    if( ((*flow_mask) & 0x1U) ) {
+    data->remote.arena  =  PARSEC_local_indices_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_local_indices_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_local_indices_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+ no_mask_match:
+  data->data                             = NULL;
+  data->remote.src_datatype = data->remote.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->remote.src_count    = data->remote.dst_count = 0;
+  data->remote.src_displ    = data->remote.dst_displ = 0;
+  data->data_future  = NULL;
+  (*flow_mask) = 0;  /* nothing left */
+  (void)odd;  (void)even;
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+static int hook_of_local_indices_STARTUP(parsec_execution_stream_t *es, __parsec_local_indices_STARTUP_task_t *this_task)
+{
+  __parsec_local_indices_internal_taskpool_t *__parsec_tp = (__parsec_local_indices_internal_taskpool_t *)this_task->taskpool;
+  (void)es; (void)__parsec_tp;
+  const int odd = this_task->locals.odd.value; (void)odd;
+  const int even = this_task->locals.even.value; (void)even;
+  (void)odd;  (void)even;
+
+  /** Declare the variables that will hold the data, and all the accounting for each */
+  parsec_data_copy_t *_f_A = this_task->data._f_A.data_in;
+  void *A = PARSEC_DATA_COPY_GET_PTR(_f_A); (void)A;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    data_repo_entry_t *eA = this_task->data._f_A.source_repo_entry;
+    if( (NULL != eA) && (eA->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eA->sim_exec_date;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+  /** Cache Awareness Accounting */
+#if defined(PARSEC_CACHE_AWARENESS)
+  cache_buf_referenced(es->closest_cache, A);
+#endif /* PARSEC_CACHE_AWARENESS */
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                                  STARTUP BODY                                  -----*/
+
+{
+   usleep( rand() % 50000 + 50000);
+   parsec_atomic_fetch_inc_int32(&nb_tasks_array[0]);
+}
+
+/*-----                              END OF STARTUP BODY                              -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#endif  /*  defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+static int complete_hook_of_local_indices_STARTUP(parsec_execution_stream_t *es, __parsec_local_indices_STARTUP_task_t *this_task)
+{
+  const __parsec_local_indices_internal_taskpool_t *__parsec_tp = (__parsec_local_indices_internal_taskpool_t *)this_task->taskpool;
+#if defined(DISTRIBUTED)
+    const int odd = this_task->locals.odd.value; (void)odd;
+  const int even = this_task->locals.even.value; (void)even;
+#endif  /* defined(DISTRIBUTED) */
+  (void)es; (void)__parsec_tp;
+parsec_data_t* data_t_desc = NULL; (void)data_t_desc;
+#if defined(DISTRIBUTED)
+  /** If not working on distributed, there is no risk that data is not in place */
+  (void)odd;  (void)even;
+
+#endif /* DISTRIBUTED */
+#if defined(PARSEC_PROF_GRAPHER)
+  parsec_prof_grapher_task((parsec_task_t*)this_task, es->th_id, es->virtual_process->vp_id,
+     __jdf2c_key_fns_STARTUP.key_hash(this_task->task_class->make_key( (parsec_taskpool_t*)this_task->taskpool, ((parsec_task_t*)this_task)->locals), NULL));
+#endif  /* defined(PARSEC_PROF_GRAPHER) */
+  release_deps_of_local_indices_STARTUP(es, this_task,
+      PARSEC_ACTION_RELEASE_REMOTE_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_REFS |
+      PARSEC_ACTION_RESHAPE_ON_RELEASE |
+      0xf,  /* mask of all dep_index */ 
+      NULL);
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static parsec_hook_return_t release_task_of_local_indices_STARTUP(parsec_execution_stream_t *es, parsec_task_t *this_task)
+{
+    const __parsec_local_indices_internal_taskpool_t *__parsec_tp =
+        (const __parsec_local_indices_internal_taskpool_t *)this_task->taskpool;
+    parsec_hash_table_t *ht = (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[0];
+    parsec_key_t key = this_task->task_class->make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals);
+    parsec_hashable_dependency_t *hash_dep = (parsec_hashable_dependency_t *)parsec_hash_table_remove(ht, key);
+    parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);
+    return parsec_release_task_to_mempool_update_nbtasks(es, this_task);
+}
+
+static char *local_indices_local_indices_STARTUP_internal_init_deps_key_functions_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_local_indices_internal_taskpool_t *__parsec_tp = (__parsec_local_indices_internal_taskpool_t *)user_data;
+  __parsec_local_indices_STARTUP_parsec_assignment_t __jdf2c__assignments = {  .odd.value = 0, .even.value = 0 };
+  int odd = (__parsec_key) % __parsec_tp->STARTUP_odd_range + __parsec_tp->STARTUP_odd_min;
+  __parsec_key = __parsec_key / __parsec_tp->STARTUP_odd_range;
+  __jdf2c__assignments.odd.value = odd;
+  int even = (__parsec_key) % __parsec_tp->STARTUP_even_range + __parsec_tp->STARTUP_even_min;
+  __parsec_key = __parsec_key / __parsec_tp->STARTUP_even_range;
+  __jdf2c__assignments.even.value = even;
+  (void)__jdf2c__assignments;
+  snprintf(buffer, buffer_size, "STARTUP(%d, %d)", odd, even);
+  return buffer;
+}
+
+static parsec_key_fn_t local_indices_local_indices_STARTUP_internal_init_deps_key_functions = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = local_indices_local_indices_STARTUP_internal_init_deps_key_functions_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/* Needs: min-max count-tasks iterate */
+static int local_indices_STARTUP_internal_init(parsec_execution_stream_t * es, __parsec_local_indices_STARTUP_task_t * this_task)
+{
+  __parsec_local_indices_internal_taskpool_t *__parsec_tp = (__parsec_local_indices_internal_taskpool_t*)this_task->taskpool;
+  int32_t nb_tasks = 0, saved_nb_tasks = 0;
+int32_t __odd_min = 0x7fffffff, __odd_max = 0;int32_t __jdf2c_odd_min = 0x7fffffff, __jdf2c_odd_max = 0;int32_t __even_min = 0x7fffffff, __even_max = 0;int32_t __jdf2c_even_min = 0x7fffffff, __jdf2c_even_max = 0;  __parsec_local_indices_STARTUP_parsec_assignment_t assignments = {  .odd.value = 0, .even.value = 0 };
+  int32_t  odd,  even;
+  int32_t __jdf2c_odd_start, __jdf2c_odd_end, __jdf2c_odd_inc;
+  int32_t __jdf2c_even_start, __jdf2c_even_end, __jdf2c_even_inc;
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+  PARSEC_PROFILING_TRACE(es->es_profile,
+                         this_task->taskpool->profiling_array[START_KEY(this_task->task_class->task_class_id)],
+                         0,
+                         this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+  { /* block for the local variable 'i' */
+    int i;
+    for(assignments.ldef[0].value = i = 0; i <= local_indices_STARTUP_inline_c_expr4_line_26(__parsec_tp, &assignments); assignments.ldef[0].value = i += 1 ) { /* Iterator on i */ 
+        odd = local_indices_STARTUP_inline_c_expr3_line_26(__parsec_tp, &assignments);
+        assignments.odd.value = odd;
+        { /* block for the local variable 'i' */
+          int i;
+          for(assignments.ldef[1].value = i = 0; i <= 4; assignments.ldef[1].value = i += 1 ) { /* Iterator on i */ 
+              even = (2 * i);
+              assignments.even.value = even;
+                __jdf2c_odd_min = parsec_imin(__jdf2c_odd_min, odd);
+                __jdf2c_odd_max = parsec_imax(__jdf2c_odd_max, odd);
+                __jdf2c_even_min = parsec_imin(__jdf2c_even_min, even);
+                __jdf2c_even_max = parsec_imax(__jdf2c_even_max, even);
+              if( !STARTUP_pred(odd, even) ) continue;
+              nb_tasks++;
+              } /* Iterator on i */ 
+            } /* Block for local definition of i */ 
+          } /* Iterator on i */ 
+        } /* Block for local definition of i */ 
+       if( 0 != nb_tasks ) {
+         (void)parsec_atomic_fetch_add_int32(&__parsec_tp->initial_number_tasks, nb_tasks);
+       }
+  /* Set the range variables for the collision-free hash-computation */
+  __parsec_tp->STARTUP_odd_min   = __jdf2c_odd_min;
+  __parsec_tp->STARTUP_odd_range = (__jdf2c_odd_max - __jdf2c_odd_min) + 1;
+  __parsec_tp->STARTUP_even_min   = __jdf2c_even_min;
+  __parsec_tp->STARTUP_even_range = (__jdf2c_even_max - __jdf2c_even_min) + 1;
+        do {
+          this_task->super.list_next = (parsec_list_item_t*)__parsec_tp->startup_queue;
+        } while(!parsec_atomic_cas_ptr(&__parsec_tp->startup_queue, (parsec_list_item_t*)this_task->super.list_next, this_task));
+        this_task->status = PARSEC_TASK_STATUS_HOOK;
+
+  PARSEC_AYU_REGISTER_TASK(&local_indices_STARTUP);
+  __parsec_tp->super.super.dependencies_array[0] = PARSEC_OBJ_NEW(parsec_hash_table_t);
+  parsec_hash_table_init(__parsec_tp->super.super.dependencies_array[0], offsetof(parsec_hashable_dependency_t, ht_item), 10, local_indices_local_indices_STARTUP_internal_init_deps_key_functions, this_task->taskpool);
+  __parsec_tp->repositories[0] = data_repo_create_nothreadsafe(nb_tasks, __jdf2c_key_fns_STARTUP, (parsec_taskpool_t*)__parsec_tp, 2);
+(void)saved_nb_tasks;
+(void)__odd_min; (void)__odd_max;(void)__even_min; (void)__even_max;  (void)__jdf2c_odd_start; (void)__jdf2c_odd_end; (void)__jdf2c_odd_inc;  (void)__jdf2c_even_start; (void)__jdf2c_even_end; (void)__jdf2c_even_inc;  (void)assignments; (void)__parsec_tp; (void)es;
+  if(1 == parsec_atomic_fetch_dec_int32(&__parsec_tp->sync_point)) {
+    /* Last initialization task complete. Update the number of tasks. */
+    __parsec_tp->super.super.tdm.module->taskpool_addto_nb_tasks(&__parsec_tp->super.super, __parsec_tp->initial_number_tasks);
+    parsec_mfence();  /* write memory barrier to guarantee that the scheduler gets the correct number of tasks */
+    parsec_taskpool_enable((parsec_taskpool_t*)__parsec_tp, &__parsec_tp->startup_queue,
+                           (parsec_task_t*)this_task, es, __parsec_tp->super.super.nb_pending_actions);
+    __parsec_tp->super.super.tdm.module->taskpool_ready(&__parsec_tp->super.super);
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+    PARSEC_PROFILING_TRACE(es->es_profile,
+                           this_task->taskpool->profiling_array[2 * this_task->task_class->task_class_id + 1],
+                           0,
+                           this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    if( 1 >= __parsec_tp->super.super.nb_pending_actions ) {
+        /* if no tasks will be generated let's prevent the runtime from calling the hook and instead go directly to complete the task */
+        this_task->status = PARSEC_TASK_STATUS_COMPLETE;
+    }
+    return PARSEC_HOOK_RETURN_DONE;
+  }
+  return PARSEC_HOOK_RETURN_ASYNC;
+}
+
+static int __jdf2c_startup_STARTUP(parsec_execution_stream_t * es, __parsec_local_indices_STARTUP_task_t *this_task)
+{
+  __parsec_local_indices_STARTUP_task_t* new_task;
+  __parsec_local_indices_internal_taskpool_t* __parsec_tp = (__parsec_local_indices_internal_taskpool_t*)this_task->taskpool;
+  parsec_context_t *context = __parsec_tp->super.super.context;
+  int vpid = 0, nb_tasks = 0;
+  size_t total_nb_tasks = 0;
+  parsec_list_item_t* pready_ring[context->nb_vp];
+  int restore_context = 0;
+  int odd = this_task->locals.odd.value;  /* retrieve value saved during the last iteration */
+  int even = this_task->locals.even.value;  /* retrieve value saved during the last iteration */
+  for(int _i = 0; _i < context->nb_vp; pready_ring[_i++] = NULL );
+  if( 0 != this_task->locals.reserved[0].value ) {
+    this_task->locals.reserved[0].value = 1; /* reset the submission process */
+    restore_context = 1;
+    goto restore_context_0;
+  }
+  this_task->locals.reserved[0].value = 1; /* a sane default value */
+  { /* block for the local variable 'i' */
+    int i;
+    for( i = 0;i <= local_indices_STARTUP_inline_c_expr4_line_26(__parsec_tp, &this_task->locals);i += 1) {
+      this_task->locals.ldef[0].value = i;
+    restore_context_0:
+      i = this_task->locals.ldef[0].value;
+      if( restore_context ) goto restore_context_1;
+        this_task->locals.odd.value = odd = local_indices_STARTUP_inline_c_expr3_line_26(__parsec_tp, &this_task->locals);
+      { /* block for the local variable 'i' */
+        int i;
+        for( i = 0;i <= 4;i += 1) {
+          this_task->locals.ldef[1].value = i;
+        restore_context_1:
+          i = this_task->locals.ldef[1].value;
+          if( restore_context ) goto restore_context_2;
+            this_task->locals.even.value = even = (2 * i);
+          if( !STARTUP_pred(odd, even) ) continue;
+  __parsec_local_indices_STARTUP_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_local_indices_STARTUP_parsec_assignment_t*)&this_task->locals;
+  (void)__jdf2c__tmp_locals;
+  /* Flow for A is always a memory reference */
+  {
+    int __active_dep_found = 0;
+    int i;
+    for( i = 0;(!__active_dep_found) && (i <= odd); i+=1) {
+       __jdf2c__tmp_locals.ldef[2].value = i;
+  if( (i) == (-1) ) { __active_dep_found = 1; break; /* X STARTUP() is not a memory reference for flow X */ }
+  }
+    if(__active_dep_found) continue;
+  }
+          if( NULL != ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of ) {
+            vpid = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, ((odd / 2) % descA->super.mt), ((even / 2) % descA->super.nt));
+            assert(context->nb_vp >= vpid);
+          } else {
+            vpid = (vpid + 1) % context->nb_vp;  /* spread the initial joy */
+          }
+          new_task = (__parsec_local_indices_STARTUP_task_t*)parsec_thread_mempool_allocate( context->virtual_processes[vpid]->execution_streams[0]->context_mempool );
+          PARSEC_OBJ_CONSTRUCT(new_task, parsec_task_t); /* construct called only when new, force-construct it again */
+          /* Copy only the valid elements from this_task to new_task one */
+          new_task->taskpool   = this_task->taskpool;
+          new_task->task_class = __parsec_tp->super.super.task_classes_array[local_indices_STARTUP.task_class_id];
+          new_task->chore_mask   = PARSEC_DEV_ALL;
+          new_task->locals.odd.value = this_task->locals.odd.value;
+          new_task->locals.even.value = this_task->locals.even.value;
+          PARSEC_LIST_ITEM_SINGLETON(new_task);
+          new_task->priority = __parsec_tp->super.super.priority;
+          new_task->repo_entry = NULL;
+          new_task->data._f_A.source_repo_entry = NULL;
+          new_task->data._f_A.source_repo       = NULL;
+          new_task->data._f_A.data_in         = NULL;
+          new_task->data._f_A.data_out        = NULL;
+          new_task->data._f_A.fulfill         = 0;
+          new_task->data._f_X.source_repo_entry = NULL;
+          new_task->data._f_X.source_repo       = NULL;
+          new_task->data._f_X.data_in         = NULL;
+          new_task->data._f_X.data_out        = NULL;
+          new_task->data._f_X.fulfill         = 0;
+#if defined(PARSEC_DEBUG_NOISIER)
+          {
+            char tmp[128];
+            PARSEC_DEBUG_VERBOSE(10, parsec_debug_output, "Add startup task %s to vpid %d",
+                   parsec_task_snprintf(tmp, 128, (parsec_task_t*)new_task), vpid);
+          }
+#endif
+          parsec_dependencies_mark_task_as_startup((parsec_task_t*)new_task, es);
+          pready_ring[vpid] = parsec_list_item_ring_push_sorted(pready_ring[vpid],
+                                                                (parsec_list_item_t*)new_task,
+                                                                parsec_execution_context_priority_comparator);
+          nb_tasks++;
+         restore_context_2:  /* we jump here just so that we have code after the label */
+          restore_context = 0;
+          (void)restore_context;
+          if( nb_tasks > this_task->locals.reserved[0].value ) {
+            if( (size_t)this_task->locals.reserved[0].value < parsec_task_startup_iter ) this_task->locals.reserved[0].value <<= 1;
+            __parsec_schedule_vp(es, (parsec_task_t**)pready_ring, 0);
+            total_nb_tasks += nb_tasks;
+            nb_tasks = 0;
+            if( total_nb_tasks > parsec_task_startup_chunk ) {  /* stop here and request to be rescheduled */
+              return PARSEC_HOOK_RETURN_AGAIN;
+            }
+          }
+          } /* Iterator on i */ 
+        } /* Block for local definition of i */ 
+      } /* Iterator on i */ 
+    } /* Block for local definition of i */ 
+  (void)vpid;
+  if( 0 != nb_tasks ) {
+    __parsec_schedule_vp(es, (parsec_task_t**)pready_ring, 0);
+    nb_tasks = 0;
+  }
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static const __parsec_chore_t __local_indices_STARTUP_chores[] ={
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+    { .type     = PARSEC_DEV_CPU,
+      .evaluate = (parsec_evaluate_function_t*)NULL,
+      .hook     = (parsec_hook_t*)hook_of_local_indices_STARTUP },
+#endif  /* defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+    { .type     = PARSEC_DEV_NONE,
+      .evaluate = NULL,
+      .hook     = (parsec_hook_t*)NULL },  /* End marker */
+};
+
+static const parsec_task_class_t local_indices_STARTUP = {
+  .name = "STARTUP",
+  .task_class_id = 0,
+  .nb_flows = 2,
+  .nb_parameters = 2,
+  .nb_locals = 2,
+  .task_class_type = PARSEC_TASK_CLASS_TYPE_PTG,
+  .params = { &symb_local_indices_STARTUP_odd, &symb_local_indices_STARTUP_even, NULL },
+  .locals = { &symb_local_indices_STARTUP_odd, &symb_local_indices_STARTUP_even, NULL },
+  .data_affinity = (parsec_data_ref_fn_t*)affinity_of_local_indices_STARTUP,
+  .initial_data = (parsec_data_ref_fn_t*)affinity_of_local_indices_STARTUP,
+  .final_data = (parsec_data_ref_fn_t*)affinity_of_local_indices_STARTUP,
+  .priority = NULL,
+  .properties = properties_of_local_indices_STARTUP,
+#if MAX_PARAM_COUNT < 1  /* number of read flows of STARTUP */
+  #error Too many read flows for task STARTUP
+#endif  /* MAX_PARAM_COUNT */
+#if MAX_PARAM_COUNT < 0  /* number of write flows of STARTUP */
+  #error Too many write flows for task STARTUP
+#endif  /* MAX_PARAM_COUNT */
+  .in = { &flow_of_local_indices_STARTUP_for_A, &flow_of_local_indices_STARTUP_for_X, NULL },
+  .out = { &flow_of_local_indices_STARTUP_for_A, &flow_of_local_indices_STARTUP_for_X, NULL },
+  .flags = 0x0 | PARSEC_HAS_IN_IN_DEPENDENCIES|PARSEC_HAS_CTL_GATHER,
+  .dependencies_goal = 2,
+  .make_key = __jdf2c_make_key_STARTUP,
+  .task_snprintf = parsec_task_snprintf,
+#if defined(PARSEC_PROF_TRACE)
+  .profile_info = &parsec_task_profile_info,
+#endif
+  .key_functions = &__jdf2c_key_fns_STARTUP,
+  .fini = (parsec_hook_t*)NULL,
+  .incarnations = __local_indices_STARTUP_chores,
+  .find_deps = parsec_hash_find_deps,
+  .update_deps = parsec_update_deps_with_counter,
+  .iterate_successors = (parsec_traverse_function_t*)iterate_successors_of_local_indices_STARTUP,
+  .iterate_predecessors = (parsec_traverse_function_t*)iterate_predecessors_of_local_indices_STARTUP,
+  .release_deps = (parsec_release_deps_t*)release_deps_of_local_indices_STARTUP,
+  .prepare_output = (parsec_hook_t*)NULL,
+  .prepare_input = (parsec_hook_t*)data_lookup_of_local_indices_STARTUP,
+  .time_estimate = NULL,
+  .get_datatype = datatype_lookup_of_local_indices_STARTUP,
+  .complete_execution = (parsec_hook_t*)complete_hook_of_local_indices_STARTUP,
+  .release_task = &release_task_of_local_indices_STARTUP,
+#if defined(PARSEC_SIM)
+  .sim_cost_fct = (parsec_sim_cost_fct_t*)NULL,
+#endif
+};
+
+
+static const parsec_task_class_t *local_indices_task_classes[] = {
+  &local_indices_STARTUP,
+  &local_indices_tG,
+  &local_indices_tA,
+  &local_indices_tB,
+  &local_indices_tC
+};
+
+static void local_indices_startup(parsec_context_t *context, __parsec_local_indices_internal_taskpool_t *__parsec_tp, parsec_list_item_t ** ready_tasks)
+{
+  uint32_t i, supported_dev = 0;
+ 
+  for( i = 0; i < parsec_nb_devices; i++ ) {
+    if( !(__parsec_tp->super.super.devices_index_mask & (1<<i)) ) continue;
+    parsec_device_module_t* device = parsec_mca_device_get(i);
+    parsec_data_collection_t* parsec_dc;
+ 
+    if(NULL == device) continue;
+    if(NULL != device->taskpool_register)
+      if( PARSEC_SUCCESS != device->taskpool_register(device, (parsec_taskpool_t*)__parsec_tp) ) {
+        parsec_debug_verbose(5, parsec_debug_output, "Device %s refused to register taskpool %p", device->name, __parsec_tp);
+        __parsec_tp->super.super.devices_index_mask &= ~(1 << device->device_index);
+        continue;
+      }
+    if(NULL != device->memory_register) {  /* Register all the data */
+      parsec_dc = (parsec_data_collection_t*)__parsec_tp->super._g_descA;
+      if( (NULL != parsec_dc->register_memory) &&
+          (PARSEC_SUCCESS != parsec_dc->register_memory(parsec_dc, device)) ) {
+        parsec_debug_verbose(3, parsec_debug_output, "Device %s refused to register memory for data %s (%p) from taskpool %p",
+                     device->name, parsec_dc->key_base, parsec_dc, __parsec_tp);
+        __parsec_tp->super.super.devices_index_mask &= ~(1 << device->device_index);
+      }
+    }
+    supported_dev |= device->type;
+  }
+  /* Remove all the chores without a backend device */
+  for( i = 0; i < PARSEC_local_indices_NB_TASK_CLASSES; i++ ) {
+    parsec_task_class_t* tc = (parsec_task_class_t*)__parsec_tp->super.super.task_classes_array[i];
+    __parsec_chore_t* chores = (__parsec_chore_t*)tc->incarnations;
+    uint32_t idx = 0, j;
+    for( j = 0; PARSEC_DEV_NONE != chores[j].type; j++ ) {
+      if( !(supported_dev & chores[j].type) ) continue;
+      if( j != idx ) {
+        chores[idx] = chores[j];
+        parsec_debug_verbose(20, parsec_debug_output, "Device type %i disabled for function %s"
+, chores[j].type, tc->name);
+      }
+      idx++;
+    }
+    chores[idx].type     = PARSEC_DEV_NONE;
+    chores[idx].evaluate = NULL;
+    chores[idx].hook     = NULL;
+    /* Create the initialization tasks for each taskclass */
+    parsec_task_t* task = (parsec_task_t*)parsec_thread_mempool_allocate(context->virtual_processes[0]->execution_streams[0]->context_mempool);
+    PARSEC_OBJ_CONSTRUCT(task, parsec_task_t); /* construct called only when new, force-construct it again */
+    task->taskpool = (parsec_taskpool_t *)__parsec_tp;
+    task->chore_mask = PARSEC_DEV_CPU;
+    memset(&task->locals, 0, sizeof(parsec_assignment_t) * MAX_LOCAL_COUNT);
+    PARSEC_LIST_ITEM_SINGLETON(task);
+    task->priority = -1;
+    task->task_class = task->taskpool->task_classes_array[PARSEC_local_indices_NB_TASK_CLASSES + i];
+    int where = i % context->nb_vp;
+    if( NULL == ready_tasks[where] ) ready_tasks[where] = &task->super;
+    else ready_tasks[where] = parsec_list_item_ring_push(ready_tasks[where], &task->super);
+  }
+}
+static void __parsec_local_indices_internal_destructor( __parsec_local_indices_internal_taskpool_t *__parsec_tp )
+{
+  uint32_t i;
+  parsec_taskpool_unregister( &__parsec_tp->super.super );
+  if(NULL != __parsec_tp->super.super.tdm.module) __parsec_tp->super.super.tdm.module->unmonitor_taskpool(&__parsec_tp->super.super);
+  for( i = 0; i < (uint32_t)(2 * __parsec_tp->super.super.nb_task_classes); i++ ) {  /* Extra startup function added at the end */
+    parsec_task_class_t* tc = (parsec_task_class_t*)__parsec_tp->super.super.task_classes_array[i];
+    free((void*)tc->incarnations);
+    free(tc);
+  }
+  free(__parsec_tp->super.super.task_classes_array); __parsec_tp->super.super.task_classes_array = NULL;
+  __parsec_tp->super.super.nb_task_classes = 0;
+
+  for(i = 0; i < (uint32_t)__parsec_tp->super.arenas_datatypes_size; i++) {
+    if( NULL != __parsec_tp->super.arenas_datatypes[i].arena ) {
+      PARSEC_OBJ_RELEASE(__parsec_tp->super.arenas_datatypes[i].arena);
+    }
+  }
+  /* Destroy the data repositories for this object */
+   data_repo_destroy_nothreadsafe(__parsec_tp->repositories[4]);  /* tC */
+   data_repo_destroy_nothreadsafe(__parsec_tp->repositories[3]);  /* tB */
+   data_repo_destroy_nothreadsafe(__parsec_tp->repositories[2]);  /* tA */
+   data_repo_destroy_nothreadsafe(__parsec_tp->repositories[1]);  /* tG */
+   data_repo_destroy_nothreadsafe(__parsec_tp->repositories[0]);  /* STARTUP */
+  /* Release the dependencies arrays for this object */
+  parsec_hash_table_fini( (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[4] );
+  PARSEC_OBJ_RELEASE(__parsec_tp->super.super.dependencies_array[4]);
+  __parsec_tp->super.super.dependencies_array[4] = NULL;
+  parsec_hash_table_fini( (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[3] );
+  PARSEC_OBJ_RELEASE(__parsec_tp->super.super.dependencies_array[3]);
+  __parsec_tp->super.super.dependencies_array[3] = NULL;
+  parsec_hash_table_fini( (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[2] );
+  PARSEC_OBJ_RELEASE(__parsec_tp->super.super.dependencies_array[2]);
+  __parsec_tp->super.super.dependencies_array[2] = NULL;
+  parsec_hash_table_fini( (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[1] );
+  PARSEC_OBJ_RELEASE(__parsec_tp->super.super.dependencies_array[1]);
+  __parsec_tp->super.super.dependencies_array[1] = NULL;
+  parsec_hash_table_fini( (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[0] );
+  PARSEC_OBJ_RELEASE(__parsec_tp->super.super.dependencies_array[0]);
+  __parsec_tp->super.super.dependencies_array[0] = NULL;
+  free( __parsec_tp->super.super.dependencies_array );
+  __parsec_tp->super.super.dependencies_array = NULL;
+  /* Unregister all the data */
+  uint32_t _i;
+  for( _i = 0; _i < parsec_nb_devices; _i++ ) {
+    parsec_device_module_t* device;
+    parsec_data_collection_t* parsec_dc;
+    if(!(__parsec_tp->super.super.devices_index_mask & (1 << _i))) continue;
+    if((NULL == (device = parsec_mca_device_get(_i))) || (NULL == device->memory_unregister)) continue;
+    parsec_dc = (parsec_data_collection_t*)__parsec_tp->super._g_descA;
+  if( NULL != parsec_dc->unregister_memory ) { (void)parsec_dc->unregister_memory(parsec_dc, device); };
+}
+  /* Unregister the taskpool from the devices */
+  for( i = 0; i < parsec_nb_devices; i++ ) {
+    if(!(__parsec_tp->super.super.devices_index_mask & (1 << i))) continue;
+    __parsec_tp->super.super.devices_index_mask ^= (1 << i);
+    parsec_device_module_t* device = parsec_mca_device_get(i);
+    if((NULL == device) || (NULL == device->taskpool_unregister)) continue;
+    if( PARSEC_SUCCESS != device->taskpool_unregister(device, &__parsec_tp->super.super) ) continue;
+  }
+  free(__parsec_tp->super.super.taskpool_name); __parsec_tp->super.super.taskpool_name = NULL;
+}
+
+void __parsec_local_indices_internal_constructor(__parsec_local_indices_internal_taskpool_t* __parsec_tp)
+{
+  parsec_task_class_t* tc;
+  uint32_t i, j;
+
+  __parsec_tp->super.super.nb_task_classes = PARSEC_local_indices_NB_TASK_CLASSES;
+  __parsec_tp->super.super.devices_index_mask = PARSEC_DEVICES_ALL;
+  __parsec_tp->super.super.taskpool_name = strdup("local_indices");
+  parsec_termdet_open_module(&__parsec_tp->super.super, "local");
+  __parsec_tp->super.super.tdm.module->monitor_taskpool(&__parsec_tp->super.super,
+                                                        parsec_taskpool_termination_detected);
+  __parsec_tp->super.super.update_nb_runtime_task = parsec_add_fetch_runtime_task;
+  __parsec_tp->super.super.dependencies_array = (void **)
+              calloc(__parsec_tp->super.super.nb_task_classes, sizeof(void*));
+  /* Twice the size to hold the startup tasks function_t */
+  __parsec_tp->super.super.task_classes_array = (const parsec_task_class_t**)
+              calloc((2 * PARSEC_local_indices_NB_TASK_CLASSES + 1), sizeof(parsec_task_class_t*));
+  __parsec_tp->super.super.tdm.module->taskpool_addto_runtime_actions(&__parsec_tp->super.super, PARSEC_local_indices_NB_TASK_CLASSES);  /* for the startup tasks */
+  __parsec_tp->super.super.taskpool_type = PARSEC_TASKPOOL_TYPE_PTG;
+  __parsec_tp->sync_point = __parsec_tp->super.super.nb_task_classes;
+  __parsec_tp->initial_number_tasks = 0;
+  __parsec_tp->startup_queue = NULL;
+  for( i = 0; i < __parsec_tp->super.super.nb_task_classes; i++ ) {
+    __parsec_tp->super.super.task_classes_array[i] = tc = malloc(sizeof(parsec_task_class_t));
+    memcpy(tc, local_indices_task_classes[i], sizeof(parsec_task_class_t));
+    for( j = 0; PARSEC_DEV_NONE != tc->incarnations[j].type; j++);  /* compute the number of incarnations */
+    tc->incarnations = (__parsec_chore_t*)malloc((j+1) * sizeof(__parsec_chore_t));
+        memcpy((__parsec_chore_t*)tc->incarnations, local_indices_task_classes[i]->incarnations, (j+1) * sizeof(__parsec_chore_t));
+
+    /* Add a placeholder for initialization and startup task */
+    __parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+i] = tc = (parsec_task_class_t*)malloc(sizeof(parsec_task_class_t));
+    memcpy(tc, (void*)&__parsec_generic_startup, sizeof(parsec_task_class_t));
+    tc->task_class_id = __parsec_tp->super.super.nb_task_classes + i;
+    tc->incarnations = (__parsec_chore_t*)malloc(2 * sizeof(__parsec_chore_t));
+    memcpy((__parsec_chore_t*)tc->incarnations, (void*)__parsec_generic_startup.incarnations, 2 * sizeof(__parsec_chore_t));
+    tc->release_task = parsec_release_task_to_mempool_and_count_as_runtime_tasks;
+  }
+  /* Startup task for tC */
+  tc = (parsec_task_class_t *)__parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+0];
+  tc->name = "Startup for tC";
+  tc->prepare_input = (parsec_hook_t*)local_indices_tC_internal_init;
+  /* Startup task for tB */
+  tc = (parsec_task_class_t *)__parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+1];
+  tc->name = "Startup for tB";
+  tc->prepare_input = (parsec_hook_t*)local_indices_tB_internal_init;
+  /* Startup task for tA */
+  tc = (parsec_task_class_t *)__parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+2];
+  tc->name = "Startup for tA";
+  tc->prepare_input = (parsec_hook_t*)local_indices_tA_internal_init;
+  /* Startup task for tG */
+  tc = (parsec_task_class_t *)__parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+3];
+  tc->name = "Startup for tG";
+  tc->prepare_input = (parsec_hook_t*)local_indices_tG_internal_init;
+  ((__parsec_chore_t*)&tc->incarnations[0])->hook = (parsec_hook_t *)__jdf2c_startup_tG;
+  /* Startup task for STARTUP */
+  tc = (parsec_task_class_t *)__parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+4];
+  tc->name = "Startup for STARTUP";
+  tc->prepare_input = (parsec_hook_t*)local_indices_STARTUP_internal_init;
+  ((__parsec_chore_t*)&tc->incarnations[0])->hook = (parsec_hook_t *)__jdf2c_startup_STARTUP;
+  /* Compute the number of arenas_datatypes: */
+  /*   PARSEC_local_indices_DEFAULT_ARENA  ->  0 */
+  __parsec_tp->super.arenas_datatypes_size = 1;
+  memset(&__parsec_tp->super.arenas_datatypes[0], 0, __parsec_tp->super.arenas_datatypes_size*sizeof(parsec_arena_datatype_t));
+  /* If profiling is enabled, the keys for profiling */
+#  if defined(PARSEC_PROF_TRACE)
+  __parsec_tp->super.super.profiling_array = local_indices_profiling_array;
+  if( -2 == local_indices_profiling_array[0] ) {
+    #if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+parsec_profiling_add_dictionary_keyword("local_indices::tC::internal init", "fill:34D8D8",
+                                       0,
+                                       NULL,
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(local_indices_tC.task_class_id  + PARSEC_local_indices_NB_TASK_CLASSES)/* tC (internal init) start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(local_indices_tC.task_class_id  + PARSEC_local_indices_NB_TASK_CLASSES)/* tC (internal init) end key */]);
+#endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+parsec_profiling_add_dictionary_keyword("local_indices::tC", "fill:CC2828",
+                                       sizeof(parsec_task_prof_info_t)+2*sizeof(parsec_assignment_t),
+                                       "dc_key{uint64_t};priority{int32_t};dc_dataid{uint32_t};tcid{uint32_t};trc{int32_t};l1{int32_t};l2{int32_t}",
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(local_indices_tC.task_class_id) /* tC start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(local_indices_tC.task_class_id) /* tC end key */]);
+
+    #if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+parsec_profiling_add_dictionary_keyword("local_indices::tB::internal init", "fill:5534D8",
+                                       0,
+                                       NULL,
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(local_indices_tB.task_class_id  + PARSEC_local_indices_NB_TASK_CLASSES)/* tB (internal init) start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(local_indices_tB.task_class_id  + PARSEC_local_indices_NB_TASK_CLASSES)/* tB (internal init) end key */]);
+#endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+parsec_profiling_add_dictionary_keyword("local_indices::tB", "fill:ABCC28",
+                                       sizeof(parsec_task_prof_info_t)+4*sizeof(parsec_assignment_t),
+                                       "dc_key{uint64_t};priority{int32_t};dc_dataid{uint32_t};tcid{uint32_t};trc{int32_t};o{int32_t};e{int32_t};i{int32_t};j{int32_t}",
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(local_indices_tB.task_class_id) /* tB start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(local_indices_tB.task_class_id) /* tB end key */]);
+
+    #if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+parsec_profiling_add_dictionary_keyword("local_indices::tA::internal init", "fill:D83496",
+                                       0,
+                                       NULL,
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(local_indices_tA.task_class_id  + PARSEC_local_indices_NB_TASK_CLASSES)/* tA (internal init) start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(local_indices_tA.task_class_id  + PARSEC_local_indices_NB_TASK_CLASSES)/* tA (internal init) end key */]);
+#endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+parsec_profiling_add_dictionary_keyword("local_indices::tA", "fill:28CC6A",
+                                       sizeof(parsec_task_prof_info_t)+4*sizeof(parsec_assignment_t),
+                                       "dc_key{uint64_t};priority{int32_t};dc_dataid{uint32_t};tcid{uint32_t};trc{int32_t};o{int32_t};e{int32_t};i{int32_t};j{int32_t}",
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(local_indices_tA.task_class_id) /* tA start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(local_indices_tA.task_class_id) /* tA end key */]);
+
+    #if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+parsec_profiling_add_dictionary_keyword("local_indices::tG::internal init", "fill:D89634",
+                                       0,
+                                       NULL,
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(local_indices_tG.task_class_id  + PARSEC_local_indices_NB_TASK_CLASSES)/* tG (internal init) start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(local_indices_tG.task_class_id  + PARSEC_local_indices_NB_TASK_CLASSES)/* tG (internal init) end key */]);
+#endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+parsec_profiling_add_dictionary_keyword("local_indices::tG", "fill:286ACC",
+                                       sizeof(parsec_task_prof_info_t)+1*sizeof(parsec_assignment_t),
+                                       "dc_key{uint64_t};priority{int32_t};dc_dataid{uint32_t};tcid{uint32_t};trc{int32_t};zero{int32_t}",
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(local_indices_tG.task_class_id) /* tG start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(local_indices_tG.task_class_id) /* tG end key */]);
+
+    #if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+parsec_profiling_add_dictionary_keyword("local_indices::STARTUP::internal init", "fill:55D834",
+                                       0,
+                                       NULL,
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(local_indices_STARTUP.task_class_id  + PARSEC_local_indices_NB_TASK_CLASSES)/* STARTUP (internal init) start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(local_indices_STARTUP.task_class_id  + PARSEC_local_indices_NB_TASK_CLASSES)/* STARTUP (internal init) end key */]);
+#endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+parsec_profiling_add_dictionary_keyword("local_indices::STARTUP", "fill:AB28CC",
+                                       sizeof(parsec_task_prof_info_t)+2*sizeof(parsec_assignment_t),
+                                       "dc_key{uint64_t};priority{int32_t};dc_dataid{uint32_t};tcid{uint32_t};trc{int32_t};odd{int32_t};even{int32_t}",
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(local_indices_STARTUP.task_class_id) /* STARTUP start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(local_indices_STARTUP.task_class_id) /* STARTUP end key */]);
+
+  }
+#  endif /* defined(PARSEC_PROF_TRACE) */
+  __parsec_tp->super.super.repo_array = __parsec_tp->repositories;
+  __parsec_tp->super.super.startup_hook = (parsec_startup_fn_t)local_indices_startup;
+  (void)parsec_taskpool_reserve_id((parsec_taskpool_t*)__parsec_tp);
+}
+
+  /** Generate class declaration and instance using the above constructor and destructor */
+  PARSEC_OBJ_CLASS_DECLARATION(__parsec_local_indices_internal_taskpool_t);
+  PARSEC_OBJ_CLASS_INSTANCE(__parsec_local_indices_internal_taskpool_t, parsec_local_indices_taskpool_t,
+                            __parsec_local_indices_internal_constructor, __parsec_local_indices_internal_destructor);
+
+#undef descA
+#undef nb_tasks_array
+
+parsec_local_indices_taskpool_t *parsec_local_indices_new(parsec_matrix_block_cyclic_t* descA /* data descA */, int32_t * nb_tasks_array)
+{
+  __parsec_local_indices_internal_taskpool_t *__parsec_tp = PARSEC_OBJ_NEW(__parsec_local_indices_internal_taskpool_t);
+  /* Dump the hidden parameters with default values */
+
+  /* Now the Parameter-dependent structures: */
+  __parsec_tp->super._g_descA = descA;
+  __parsec_tp->super._g_nb_tasks_array = nb_tasks_array;
+  PARSEC_AYU_REGISTER_TASK(&local_indices_tC);
+  PARSEC_AYU_REGISTER_TASK(&local_indices_tB);
+  PARSEC_AYU_REGISTER_TASK(&local_indices_tA);
+  PARSEC_AYU_REGISTER_TASK(&local_indices_tG);
+  PARSEC_AYU_REGISTER_TASK(&local_indices_STARTUP);
+  __parsec_tp->super.super.startup_hook = (parsec_startup_fn_t)local_indices_startup;
+  (void)parsec_taskpool_reserve_id((parsec_taskpool_t*)__parsec_tp);
+/* Prevent warnings related to not used hidden global variables */
+;
+  return (parsec_local_indices_taskpool_t*)__parsec_tp;
+}
+
+
+#include <math.h>
+
+int main( int argc, char** argv )
+{
+    parsec_local_indices_taskpool_t* tp;
+    parsec_matrix_block_cyclic_t descA;
+    parsec_arena_datatype_t adt;
+    parsec_datatype_t dt;
+    parsec_context_t *parsec;
+    int ws = 1, mr = 0;
+    int rc;
+    int p = 1, c;
+    int local_nb[4];
+    int global_nb[4];
+    int ret;
+
+    srand( getpid() );
+
+#ifdef PARSEC_HAVE_MPI
+    {
+        int provided;
+        MPI_Init_thread(NULL, NULL, MPI_THREAD_SERIALIZED, &provided);
+        MPI_Comm_size(MPI_COMM_WORLD, &ws);
+        MPI_Comm_rank(MPI_COMM_WORLD, &mr);
+        for(c = (int)sqrt(ws)+1; c > 0; c--) {
+            if( (c < ws) && (ws % c) == 0 ) {
+                p = c;
+                break;
+            }
+        }
+    }
+#endif
+
+    parsec = parsec_init(-1, &argc, &argv);
+    if( NULL == parsec ) {
+       exit(-1);
+    }
+
+    /**
+     * Build the data and the arena to hold it up.
+     */
+    parsec_matrix_block_cyclic_init( &descA, PARSEC_MATRIX_DOUBLE, PARSEC_MATRIX_TILE,
+                               mr /*rank*/,
+                               100 /* mb */, 100 /* nb */,
+                               100*10 /* lm */, 100*10 /* ln */,
+                               0 /* i */, 0 /* j */,
+                               100*10 /* m */, 100*10 /* n */,
+                               p, ws/p, 1 /* sm */, 1 /* sn */,
+                               0, 0);
+    descA.mat = parsec_data_allocate( descA.super.nb_local_tiles *
+                                      descA.super.bsiz *
+                                      parsec_datadist_getsizeoftype(PARSEC_MATRIX_DOUBLE) );
+    parsec_data_collection_set_key(&descA.super.super, "A");
+
+    parsec_translate_matrix_type(PARSEC_MATRIX_DOUBLE, &dt);
+    parsec_add2arena_rect(&adt, dt,
+                                 descA.super.mb, descA.super.nb, descA.super.mb);
+    /* Start the PaRSEC engine */
+    rc = parsec_context_start(parsec);
+    PARSEC_CHECK_ERROR(rc, "parsec_context_start");
+
+    /* Heat up the engine: small tasks no priority */
+    memset(local_nb, 0, 4*sizeof(int));
+    tp = parsec_local_indices_new( &descA, (int32_t*)local_nb );
+    assert( NULL != tp );
+    tp->arenas_datatypes[PARSEC_local_indices_DEFAULT_ADT_IDX] = adt;
+    rc = parsec_context_add_taskpool( parsec, (parsec_taskpool_t*)tp );
+    PARSEC_CHECK_ERROR(rc, "parsec_context_add_taskpool");
+    rc = parsec_context_wait(parsec);
+
+    PARSEC_CHECK_ERROR(rc, "parsec_context_wait");
+
+    rc = parsec_context_start(parsec);
+    PARSEC_CHECK_ERROR(rc, "parsec_context_start");
+
+    parsec_context_wait(parsec);
+
+#ifdef PARSEC_HAVE_MPI
+    MPI_Reduce(local_nb, global_nb, 4, MPI_INT, MPI_SUM, 0, MPI_COMM_WORLD);
+#else
+    memcpy(global_nb, local_nb, 4*sizeof(int));
+#endif
+    ret = 0;
+    if( 0 == mr ) {
+        if( global_nb[0] != 25 ) {
+            fprintf(stderr, "*** Test failed: expected 25 STARTUP tasks, found %d total\n", global_nb[0]);
+            ret++;
+        }
+        if( global_nb[1] != 90 ) {
+            fprintf(stderr, "*** Test failed: expected 90 tA tasks, found %d total\n", global_nb[1]);
+            ret++;
+        }
+        if( global_nb[2] != 90 ) {
+            fprintf(stderr, "*** Test failed: expected 90 tB tasks, found %d total\n", global_nb[2]);
+            ret++;
+        }
+        if( global_nb[3] != 5 ) {
+            fprintf(stderr, "*** Test failed: expected 5 tC tasks, found %d total\n", global_nb[3]);
+            ret++;
+        }
+    }
+
+    parsec_taskpool_free(&tp->super);
+
+    free(descA.mat);
+    parsec_del2arena( & adt );
+
+    parsec_fini( &parsec);
+
+#ifdef PARSEC_HAVE_MPI
+    MPI_Finalize();
+#endif
+
+    return ret;
+}
+
+PARSEC_OBJ_CLASS_INSTANCE(parsec_local_indices_taskpool_t, parsec_taskpool_t, NULL, NULL);
+
@@ -0,0 +1,189 @@
+#ifndef _local_indices_h_
+#define _local_indices_h_
+#include "parsec.h"
+#include "parsec/parsec_internal.h"
+#include "parsec/remote_dep.h"
+
+BEGIN_C_DECLS
+
+#define PARSEC_local_indices_DEFAULT_ADT_IDX    0
+#define PARSEC_local_indices_ADT_IDX_MAX       1
+typedef struct parsec_local_indices_taskpool_s {
+  parsec_taskpool_t super;
+  /* The list of globals */
+  parsec_matrix_block_cyclic_t* _g_descA /* data descA */;
+  int32_t * _g_nb_tasks_array;
+  /* The array of datatypes (DEFAULT and co.) */
+  parsec_arena_datatype_t arenas_datatypes[PARSEC_local_indices_ADT_IDX_MAX];
+  uint32_t arenas_datatypes_size;
+} parsec_local_indices_taskpool_t;
+
+/** Beware that this object is not a superset of the internal object, and as a result
+ *  we should never create one directly. Instead we should rely on the creation of the
+ *  internal object (__parsec_local_indices_taskpool_t).
+ */
+PARSEC_OBJ_CLASS_DECLARATION(parsec_local_indices_taskpool_t);
+extern parsec_local_indices_taskpool_t *parsec_local_indices_new(parsec_matrix_block_cyclic_t* _g_descA /* data descA */, int32_t * _g_nb_tasks_array);
+
+#if MAX_LOCAL_COUNT < 2  /* number of parameters and locals tC */
+  #error Too many parameters and local variables (2 out of MAX_LOCAL_COUNT) for task tC
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_local_indices_tC_assignment_s {
+  parsec_assignment_t l1;
+  parsec_assignment_t l2;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-2];
+} __parsec_local_indices_tC_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 1  /* total number of flows for task tC */
+  #error Too many flows (1 out of MAX_PARAM_COUNT) for task tC
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_local_indices_tC_data_s {
+  parsec_data_pair_t _f_A;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-1];
+} __parsec_local_indices_tC_data_t;
+
+typedef struct __parsec_local_indices_tC_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_local_indices_tC_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_local_indices_tC_data_s data;
+} __parsec_local_indices_tC_task_t;
+
+
+#if MAX_LOCAL_COUNT < 7  /* number of parameters and locals tB */
+  #error Too many parameters and local variables (7 out of MAX_LOCAL_COUNT) for task tB
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_local_indices_tB_assignment_s {
+  parsec_assignment_t o;
+  parsec_assignment_t e;
+  parsec_assignment_t i;
+  parsec_assignment_t j;
+  parsec_assignment_t ldef[3];
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-7];
+} __parsec_local_indices_tB_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 1  /* total number of flows for task tB */
+  #error Too many flows (1 out of MAX_PARAM_COUNT) for task tB
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_local_indices_tB_data_s {
+  parsec_data_pair_t _f_A;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-1];
+} __parsec_local_indices_tB_data_t;
+
+typedef struct __parsec_local_indices_tB_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_local_indices_tB_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_local_indices_tB_data_s data;
+} __parsec_local_indices_tB_task_t;
+
+
+#if MAX_LOCAL_COUNT < 6  /* number of parameters and locals tA */
+  #error Too many parameters and local variables (6 out of MAX_LOCAL_COUNT) for task tA
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_local_indices_tA_assignment_s {
+  parsec_assignment_t o;
+  parsec_assignment_t e;
+  parsec_assignment_t i;
+  parsec_assignment_t j;
+  parsec_assignment_t ldef[2];
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-6];
+} __parsec_local_indices_tA_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 1  /* total number of flows for task tA */
+  #error Too many flows (1 out of MAX_PARAM_COUNT) for task tA
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_local_indices_tA_data_s {
+  parsec_data_pair_t _f_A;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-1];
+} __parsec_local_indices_tA_data_t;
+
+typedef struct __parsec_local_indices_tA_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_local_indices_tA_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_local_indices_tA_data_s data;
+} __parsec_local_indices_tA_task_t;
+
+
+#if MAX_LOCAL_COUNT < 3  /* number of parameters and locals tG */
+  #error Too many parameters and local variables (3 out of MAX_LOCAL_COUNT) for task tG
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_local_indices_tG_assignment_s {
+  parsec_assignment_t zero;
+  parsec_assignment_t ldef[2];
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-3];
+} __parsec_local_indices_tG_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 2  /* total number of flows for task tG */
+  #error Too many flows (2 out of MAX_PARAM_COUNT) for task tG
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_local_indices_tG_data_s {
+  parsec_data_pair_t _f_Y;
+  parsec_data_pair_t _f_Z;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-2];
+} __parsec_local_indices_tG_data_t;
+
+typedef struct __parsec_local_indices_tG_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_local_indices_tG_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_local_indices_tG_data_s data;
+} __parsec_local_indices_tG_task_t;
+
+
+#if MAX_LOCAL_COUNT < 6  /* number of parameters and locals STARTUP */
+  #error Too many parameters and local variables (6 out of MAX_LOCAL_COUNT) for task STARTUP
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_local_indices_STARTUP_assignment_s {
+  parsec_assignment_t odd;
+  parsec_assignment_t even;
+  parsec_assignment_t ldef[4];
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-6];
+} __parsec_local_indices_STARTUP_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 2  /* total number of flows for task STARTUP */
+  #error Too many flows (2 out of MAX_PARAM_COUNT) for task STARTUP
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_local_indices_STARTUP_data_s {
+  parsec_data_pair_t _f_A;
+  parsec_data_pair_t _f_X;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-2];
+} __parsec_local_indices_STARTUP_data_t;
+
+typedef struct __parsec_local_indices_STARTUP_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_local_indices_STARTUP_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_local_indices_STARTUP_data_s data;
+} __parsec_local_indices_STARTUP_task_t;
+
+
+END_C_DECLS
+
+#endif /* _local_indices_h_ */ 
@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/_debug_build/tests/dsl/ptg/multisize_bcast/check_multisize_bcast.c" "tests/dsl/ptg/multisize_bcast/CMakeFiles/check_multisize_bcast.dir/check_multisize_bcast.c.o" "gcc" "tests/dsl/ptg/multisize_bcast/CMakeFiles/check_multisize_bcast.dir/check_multisize_bcast.c.o.d"
+  "/root/repo/tests/dsl/ptg/multisize_bcast/check_multisize_bcast_wrapper.c" "tests/dsl/ptg/multisize_bcast/CMakeFiles/check_multisize_bcast.dir/check_multisize_bcast_wrapper.c.o" "gcc" "tests/dsl/ptg/multisize_bcast/CMakeFiles/check_multisize_bcast.dir/check_multisize_bcast_wrapper.c.o.d"
+  "/root/repo/tests/dsl/ptg/multisize_bcast/data_gen.c" "tests/dsl/ptg/multisize_bcast/CMakeFiles/check_multisize_bcast.dir/data_gen.c.o" "gcc" "tests/dsl/ptg/multisize_bcast/CMakeFiles/check_multisize_bcast.dir/data_gen.c.o.d"
+  "/root/repo/tests/dsl/ptg/multisize_bcast/main.c" "tests/dsl/ptg/multisize_bcast/CMakeFiles/check_multisize_bcast.dir/main.c.o" "gcc" "tests/dsl/ptg/multisize_bcast/CMakeFiles/check_multisize_bcast.dir/main.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_debug_build/parsec/CMakeFiles/parsec.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "/root/repo/_debug_build/parsec/include/fortran")
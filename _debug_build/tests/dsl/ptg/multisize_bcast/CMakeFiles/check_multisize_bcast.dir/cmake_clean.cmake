@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/check_multisize_bcast.dir/check_multisize_bcast.c.o"
+  "CMakeFiles/check_multisize_bcast.dir/check_multisize_bcast.c.o.d"
+  "CMakeFiles/check_multisize_bcast.dir/check_multisize_bcast_wrapper.c.o"
+  "CMakeFiles/check_multisize_bcast.dir/check_multisize_bcast_wrapper.c.o.d"
+  "CMakeFiles/check_multisize_bcast.dir/data_gen.c.o"
+  "CMakeFiles/check_multisize_bcast.dir/data_gen.c.o.d"
+  "CMakeFiles/check_multisize_bcast.dir/main.c.o"
+  "CMakeFiles/check_multisize_bcast.dir/main.c.o.d"
+  "check_multisize_bcast"
+  "check_multisize_bcast.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/check_multisize_bcast.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
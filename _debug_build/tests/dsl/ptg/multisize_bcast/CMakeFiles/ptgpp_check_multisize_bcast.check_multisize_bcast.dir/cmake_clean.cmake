@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ptgpp_check_multisize_bcast.check_multisize_bcast"
+  "check_multisize_bcast.c"
+  "check_multisize_bcast.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ptgpp_check_multisize_bcast.check_multisize_bcast.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/dsl/ptg/multisize_bcast
+# Build directory: /root/repo/_debug_build/tests/dsl/ptg/multisize_bcast
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
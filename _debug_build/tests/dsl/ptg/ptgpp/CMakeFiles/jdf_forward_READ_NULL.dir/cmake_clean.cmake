@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/jdf_forward_READ_NULL.dir/forward_READ_NULL.c.o"
+  "CMakeFiles/jdf_forward_READ_NULL.dir/forward_READ_NULL.c.o.d"
+  "jdf_forward_READ_NULL"
+  "jdf_forward_READ_NULL.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/jdf_forward_READ_NULL.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
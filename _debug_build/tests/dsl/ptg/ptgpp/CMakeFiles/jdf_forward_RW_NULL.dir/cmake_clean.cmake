@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/jdf_forward_RW_NULL.dir/forward_RW_NULL.c.o"
+  "CMakeFiles/jdf_forward_RW_NULL.dir/forward_RW_NULL.c.o.d"
+  "jdf_forward_RW_NULL"
+  "jdf_forward_RW_NULL.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/jdf_forward_RW_NULL.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
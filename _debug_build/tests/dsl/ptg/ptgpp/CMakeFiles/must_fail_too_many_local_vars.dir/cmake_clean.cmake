@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/must_fail_too_many_local_vars.dir/too_many_local_vars.c.o"
+  "CMakeFiles/must_fail_too_many_local_vars.dir/too_many_local_vars.c.o.d"
+  "must_fail_too_many_local_vars"
+  "must_fail_too_many_local_vars.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/must_fail_too_many_local_vars.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
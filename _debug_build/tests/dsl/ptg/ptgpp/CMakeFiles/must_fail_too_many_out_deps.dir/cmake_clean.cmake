@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/must_fail_too_many_out_deps.dir/too_many_out_deps.c.o"
+  "CMakeFiles/must_fail_too_many_out_deps.dir/too_many_out_deps.c.o.d"
+  "must_fail_too_many_out_deps"
+  "must_fail_too_many_out_deps.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/must_fail_too_many_out_deps.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/must_fail_too_many_write_flows.dir/too_many_write_flows.c.o"
+  "CMakeFiles/must_fail_too_many_write_flows.dir/too_many_write_flows.c.o.d"
+  "must_fail_too_many_write_flows"
+  "must_fail_too_many_write_flows.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/must_fail_too_many_write_flows.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ptgpp_jdf_forward_RW_NULL.forward_RW_NULL"
+  "forward_RW_NULL.c"
+  "forward_RW_NULL.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ptgpp_jdf_forward_RW_NULL.forward_RW_NULL.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
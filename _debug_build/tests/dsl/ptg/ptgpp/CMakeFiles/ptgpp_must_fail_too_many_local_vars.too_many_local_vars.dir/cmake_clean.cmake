@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ptgpp_must_fail_too_many_local_vars.too_many_local_vars"
+  "too_many_local_vars.c"
+  "too_many_local_vars.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ptgpp_must_fail_too_many_local_vars.too_many_local_vars.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
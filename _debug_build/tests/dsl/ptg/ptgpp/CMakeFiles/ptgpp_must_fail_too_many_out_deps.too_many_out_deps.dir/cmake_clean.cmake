@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ptgpp_must_fail_too_many_out_deps.too_many_out_deps"
+  "too_many_out_deps.c"
+  "too_many_out_deps.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ptgpp_must_fail_too_many_out_deps.too_many_out_deps.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
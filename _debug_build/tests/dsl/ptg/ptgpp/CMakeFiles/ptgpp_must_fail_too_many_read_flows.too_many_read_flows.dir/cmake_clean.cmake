@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ptgpp_must_fail_too_many_read_flows.too_many_read_flows"
+  "too_many_read_flows.c"
+  "too_many_read_flows.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ptgpp_must_fail_too_many_read_flows.too_many_read_flows.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ptgpp_write_check.write_check"
+  "write_check.c"
+  "write_check.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ptgpp_write_check.write_check.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/write_check.dir/vector.c.o"
+  "CMakeFiles/write_check.dir/vector.c.o.d"
+  "CMakeFiles/write_check.dir/write_check.c.o"
+  "CMakeFiles/write_check.dir/write_check.c.o.d"
+  "write_check"
+  "write_check.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/write_check.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,125 @@
+#ifndef _write_check_h_
+#define _write_check_h_
+#include "parsec.h"
+#include "parsec/parsec_internal.h"
+#include "parsec/remote_dep.h"
+
+BEGIN_C_DECLS
+
+#define PARSEC_write_check_DEFAULT_ADT_IDX    0
+#define PARSEC_write_check_ADT_IDX_MAX       1
+typedef struct parsec_write_check_taskpool_s {
+  parsec_taskpool_t super;
+  /* The list of globals */
+  parsec_data_collection_t* _g_A /* data A */;
+  int _g_NT;
+  int _g_BLOCK;
+  int _g_P;
+  /* The array of datatypes (DEFAULT and co.) */
+  parsec_arena_datatype_t arenas_datatypes[PARSEC_write_check_ADT_IDX_MAX];
+  uint32_t arenas_datatypes_size;
+} parsec_write_check_taskpool_t;
+
+/** Beware that this object is not a superset of the internal object, and as a result
+ *  we should never create one directly. Instead we should rely on the creation of the
+ *  internal object (__parsec_write_check_taskpool_t).
+ */
+PARSEC_OBJ_CLASS_DECLARATION(parsec_write_check_taskpool_t);
+extern parsec_write_check_taskpool_t *parsec_write_check_new(parsec_data_collection_t* _g_A /* data A */, int _g_NT, int _g_BLOCK);
+
+#if MAX_LOCAL_COUNT < 2  /* number of parameters and locals TASK2 */
+  #error Too many parameters and local variables (2 out of MAX_LOCAL_COUNT) for task TASK2
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_write_check_TASK2_assignment_s {
+  parsec_assignment_t k;
+  parsec_assignment_t p;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-2];
+} __parsec_write_check_TASK2_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 2  /* total number of flows for task TASK2 */
+  #error Too many flows (2 out of MAX_PARAM_COUNT) for task TASK2
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_write_check_TASK2_data_s {
+  parsec_data_pair_t _f_A2;
+  parsec_data_pair_t _f_A1;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-2];
+} __parsec_write_check_TASK2_data_t;
+
+typedef struct __parsec_write_check_TASK2_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_write_check_TASK2_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_write_check_TASK2_data_s data;
+} __parsec_write_check_TASK2_task_t;
+
+
+#if MAX_LOCAL_COUNT < 2  /* number of parameters and locals TASK1 */
+  #error Too many parameters and local variables (2 out of MAX_LOCAL_COUNT) for task TASK1
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_write_check_TASK1_assignment_s {
+  parsec_assignment_t k;
+  parsec_assignment_t p;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-2];
+} __parsec_write_check_TASK1_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 3  /* total number of flows for task TASK1 */
+  #error Too many flows (3 out of MAX_PARAM_COUNT) for task TASK1
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_write_check_TASK1_data_s {
+  parsec_data_pair_t _f_A3;
+  parsec_data_pair_t _f_A1;
+  parsec_data_pair_t _f_A2;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-3];
+} __parsec_write_check_TASK1_data_t;
+
+typedef struct __parsec_write_check_TASK1_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_write_check_TASK1_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_write_check_TASK1_data_s data;
+} __parsec_write_check_TASK1_task_t;
+
+
+#if MAX_LOCAL_COUNT < 2  /* number of parameters and locals STARTUP */
+  #error Too many parameters and local variables (2 out of MAX_LOCAL_COUNT) for task STARTUP
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_write_check_STARTUP_assignment_s {
+  parsec_assignment_t k;
+  parsec_assignment_t p;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-2];
+} __parsec_write_check_STARTUP_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 1  /* total number of flows for task STARTUP */
+  #error Too many flows (1 out of MAX_PARAM_COUNT) for task STARTUP
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_write_check_STARTUP_data_s {
+  parsec_data_pair_t _f_A1;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-1];
+} __parsec_write_check_STARTUP_data_t;
+
+typedef struct __parsec_write_check_STARTUP_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_write_check_STARTUP_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_write_check_STARTUP_data_s data;
+} __parsec_write_check_STARTUP_task_t;
+
+
+END_C_DECLS
+
+#endif /* _write_check_h_ */ 
@@ -0,0 +1,120 @@
+#ifndef _single_consumer_h_
+#define _single_consumer_h_
+#include "parsec.h"
+#include "parsec/parsec_internal.h"
+#include "parsec/remote_dep.h"
+
+BEGIN_C_DECLS
+
+#define PARSEC_single_consumer_DEFAULT_ADT_IDX    0
+#define PARSEC_single_consumer_ADT_IDX_MAX       1
+typedef struct parsec_single_consumer_taskpool_s {
+  parsec_taskpool_t super;
+  /* The list of globals */
+  parsec_matrix_block_cyclic_t* _g_descA /* data descA */;
+  int _g_NI;
+  int _g_NK;
+  int _g_MIGRATE;
+  /* The array of datatypes (DEFAULT and co.) */
+  parsec_arena_datatype_t arenas_datatypes[PARSEC_single_consumer_ADT_IDX_MAX];
+  uint32_t arenas_datatypes_size;
+} parsec_single_consumer_taskpool_t;
+
+/** Beware that this object is not a superset of the internal object, and as a result
+ *  we should never create one directly. Instead we should rely on the creation of the
+ *  internal object (__parsec_single_consumer_taskpool_t).
+ */
+PARSEC_OBJ_CLASS_DECLARATION(parsec_single_consumer_taskpool_t);
+extern parsec_single_consumer_taskpool_t *parsec_single_consumer_new(parsec_matrix_block_cyclic_t* _g_descA /* data descA */, int _g_NI, int _g_NK, int _g_MIGRATE);
+
+#if MAX_LOCAL_COUNT < 1  /* number of parameters and locals LAST */
+  #error Too many parameters and local variables (1 out of MAX_LOCAL_COUNT) for task LAST
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_single_consumer_LAST_assignment_s {
+  parsec_assignment_t i;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-1];
+} __parsec_single_consumer_LAST_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 1  /* total number of flows for task LAST */
+  #error Too many flows (1 out of MAX_PARAM_COUNT) for task LAST
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_single_consumer_LAST_data_s {
+  parsec_data_pair_t _f_A;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-1];
+} __parsec_single_consumer_LAST_data_t;
+
+typedef struct __parsec_single_consumer_LAST_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_single_consumer_LAST_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_single_consumer_LAST_data_s data;
+} __parsec_single_consumer_LAST_task_t;
+
+
+#if MAX_LOCAL_COUNT < 2  /* number of parameters and locals STEP */
+  #error Too many parameters and local variables (2 out of MAX_LOCAL_COUNT) for task STEP
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_single_consumer_STEP_assignment_s {
+  parsec_assignment_t i;
+  parsec_assignment_t k;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-2];
+} __parsec_single_consumer_STEP_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 1  /* total number of flows for task STEP */
+  #error Too many flows (1 out of MAX_PARAM_COUNT) for task STEP
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_single_consumer_STEP_data_s {
+  parsec_data_pair_t _f_A;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-1];
+} __parsec_single_consumer_STEP_data_t;
+
+typedef struct __parsec_single_consumer_STEP_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_single_consumer_STEP_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_single_consumer_STEP_data_s data;
+} __parsec_single_consumer_STEP_task_t;
+
+
+#if MAX_LOCAL_COUNT < 1  /* number of parameters and locals FIRST */
+  #error Too many parameters and local variables (1 out of MAX_LOCAL_COUNT) for task FIRST
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_single_consumer_FIRST_assignment_s {
+  parsec_assignment_t i;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-1];
+} __parsec_single_consumer_FIRST_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 1  /* total number of flows for task FIRST */
+  #error Too many flows (1 out of MAX_PARAM_COUNT) for task FIRST
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_single_consumer_FIRST_data_s {
+  parsec_data_pair_t _f_A;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-1];
+} __parsec_single_consumer_FIRST_data_t;
+
+typedef struct __parsec_single_consumer_FIRST_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_single_consumer_FIRST_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_single_consumer_FIRST_data_s data;
+} __parsec_single_consumer_FIRST_task_t;
+
+
+END_C_DECLS
+
+#endif /* _single_consumer_h_ */ 
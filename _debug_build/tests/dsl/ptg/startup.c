@@ -0,0 +1,1461 @@
+#include "parsec.h"
+#include "parsec/parsec_internal.h"
+#include "parsec/ayudame.h"
+#include "parsec/execution_stream.h"
+#include "parsec/parsec_binary_profile.h"
+#include "parsec/mca/device/device_gpu.h"
+#if defined(PARSEC_HAVE_DEV_CUDA_SUPPORT)
+#include "parsec/mca/device/cuda/device_cuda.h"
+#endif  /* defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) */
+#if defined(PARSEC_HAVE_DEV_HIP_SUPPORT)
+#include "parsec/mca/device/hip/device_hip.h"
+#endif  /* defined(PARSEC_HAVE_DEV_HIP_SUPPORT) */
+#if defined(_MSC_VER) || defined(__MINGW32__)
+#  include <malloc.h>
+#else
+#  include <alloca.h>
+#endif  /* defined(_MSC_VER) || defined(__MINGW32__) */
+
+#define PARSEC_startup_NB_TASK_CLASSES 1
+#define PARSEC_startup_NB_DATA 1
+
+typedef struct __parsec_startup_internal_taskpool_s __parsec_startup_internal_taskpool_t;
+struct parsec_startup_internal_taskpool_s;
+
+/** Predeclarations of the parsec_task_class_t */
+static const parsec_task_class_t startup_STARTUP;
+/** Predeclarations of the parameters */
+static const parsec_flow_t flow_of_startup_STARTUP_for_A;
+/*
+ * Copyright (c) 2019-2023 The University of Tennessee and The University
+ *                         of Tennessee Research Foundation. All rights
+ *                         reserved.
+ */
+
+#include <sys/time.h>
+#include <inttypes.h>
+#include <string.h>
+#include <stdlib.h>
+#include "parsec/data_dist/matrix/two_dim_rectangle_cyclic.h"
+
+/**
+ * This test stress the startup mechanism by generating NI*NJ*NK independent
+ * tasks from the beginning. A sequential startup will incur a high overhead,
+ * while a more parallel startup will mitigate this overhead.
+ *
+ * The behavior of the test is altered by the defined priority, -1 and 1 is
+ * for an increasing priority, respectively decreasing, 0 is for no priority
+ * and 2 is for a random behavior. The generated priory is global, but it does
+ * not impose a strict scheduling.
+ */
+#define PARSEC_startup_DEFAULT_ADT    (&__parsec_tp->super.arenas_datatypes[PARSEC_startup_DEFAULT_ADT_IDX])
+#include "startup.h"
+
+struct __parsec_startup_internal_taskpool_s {
+ parsec_startup_taskpool_t super;
+ volatile int32_t sync_point;
+ volatile int32_t initial_number_tasks;
+ parsec_task_t* startup_queue;
+  /* The ranges to compute the hash key */
+  int STARTUP_i_min;
+  int STARTUP_i_range;
+  int STARTUP_j_min;
+  int STARTUP_j_range;
+  int STARTUP_k_min;
+  int STARTUP_k_range;
+  /* The list of data repositories  STARTUP */
+  data_repo_t* repositories[1];
+};
+
+#if defined(PARSEC_PROF_TRACE)
+#  if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+static int startup_profiling_array[4*PARSEC_startup_NB_TASK_CLASSES] = {-2}; /* 2 pairs (begin, end) per task, times two because each task class has an internal_init task */
+#  else /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+static int startup_profiling_array[2*PARSEC_startup_NB_TASK_CLASSES] = {-2}; /* 2 pairs (begin, end) per task */
+#  endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+#endif  /* defined(PARSEC_PROF_TRACE) */
+/* Globals */
+#define descA __parsec_tp->super._g_descA
+#define NI (__parsec_tp->super._g_NI)
+#define NJ (__parsec_tp->super._g_NJ)
+#define NK (__parsec_tp->super._g_NK)
+#define pri (__parsec_tp->super._g_pri)
+
+static inline int parsec_imin(int a, int b) { return (a <= b) ? a : b; };
+
+static inline int parsec_imax(int a, int b) { return (a >= b) ? a : b; };
+
+static inline int32_t startup_STARTUP_inline_c_expr1_line_41(const __parsec_startup_internal_taskpool_t *__parsec_tp, const __parsec_startup_STARTUP_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task STARTUP */
+  const int i = assignments->i.value; (void)i;
+  const int j = assignments->j.value; (void)j;
+  const int k = assignments->k.value; (void)k;
+  const int valid1 = assignments->valid1.value; (void)valid1;
+  const int valid2 = assignments->valid2.value; (void)valid2;
+  const int prio = assignments->prio.value; (void)prio;
+
+  (void)i;  (void)j;  (void)k;  (void)valid1;  (void)valid2;  (void)prio;
+
+ return pri == 2 ? (int)(random()) : ((NJ*NK*i + NK*j + k)*pri); 
+}
+
+/* Data Access Macros */
+#define data_of_descA(descA_d0, descA_d1)  (((parsec_data_collection_t*)__parsec_tp->super._g_descA)->data_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, (descA_d0), (descA_d1)))
+
+#define rank_of_descA(descA_d0, descA_d1)  (((parsec_data_collection_t*)__parsec_tp->super._g_descA)->rank_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, (descA_d0), (descA_d1)))
+
+/* Functions Predicates */
+#define STARTUP_pred(i, j, k, valid1, valid2, prio) (((parsec_data_collection_t*)(__parsec_tp->super._g_descA))->myrank == rank_of_descA(i, 0))
+
+/* Data Repositories */
+#define STARTUP_repo (__parsec_tp->repositories[0])
+/* Release dependencies output macro */
+#if defined(PARSEC_DEBUG_NOISIER)
+#define RELEASE_DEP_OUTPUT(ES, DEPO, TASKO, DEPI, TASKI, RSRC, RDST, DATA)\
+  do { \
+    char tmp1[128], tmp2[128]; (void)tmp1; (void)tmp2;\
+    PARSEC_DEBUG_VERBOSE(20, parsec_debug_output, "thread %d VP %d explore deps from %s:%s to %s:%s (from rank %d to %d) base ptr %p",\
+           (NULL != (ES) ? (ES)->th_id : -1), (NULL != (ES) ? (ES)->virtual_process->vp_id : -1),\
+           DEPO, parsec_task_snprintf(tmp1, 128, (parsec_task_t*)(TASKO)),\
+           DEPI, parsec_task_snprintf(tmp2, 128, (parsec_task_t*)(TASKI)), (RSRC), (RDST), (DATA));\
+  } while(0)
+#define ACQUIRE_FLOW(TASKI, DEPI, FUNO, DEPO, LOCALS, PTR)\
+  do { \
+    char tmp1[128], tmp2[128]; (void)tmp1; (void)tmp2;\
+    PARSEC_DEBUG_VERBOSE(20, parsec_debug_output, "task %s acquires flow %s from %s %s data ptr %p",\
+           parsec_task_snprintf(tmp1, 128, (parsec_task_t*)(TASKI)), (DEPI),\
+           (DEPO), parsec_snprintf_assignments(tmp2, 128, (FUNO), (parsec_assignment_t*)(LOCALS)), (PTR));\
+  } while(0)
+#else
+#define RELEASE_DEP_OUTPUT(ES, DEPO, TASKO, DEPI, TASKI, RSRC, RDST, DATA)
+#define ACQUIRE_FLOW(TASKI, DEPI, TASKO, DEPO, LOCALS, PTR)
+#endif
+static inline parsec_key_t __jdf2c_make_key_STARTUP(const parsec_taskpool_t *tp, const parsec_assignment_t *as)
+{
+  const __parsec_startup_internal_taskpool_t *__parsec_tp = (const __parsec_startup_internal_taskpool_t *)tp;
+  const __parsec_startup_STARTUP_parsec_assignment_t *assignment = (const __parsec_startup_STARTUP_parsec_assignment_t*)as;
+  uint64_t __parsec_id = 0;
+  __parsec_id += (assignment->i.value - __parsec_tp->STARTUP_i_min);
+  __parsec_id += (assignment->j.value - __parsec_tp->STARTUP_j_min) * __parsec_tp->STARTUP_i_range;
+  __parsec_id += (assignment->k.value - __parsec_tp->STARTUP_k_min) * __parsec_tp->STARTUP_i_range * __parsec_tp->STARTUP_j_range;
+  return (parsec_key_t)__parsec_id;
+}
+static char *__jdf2c_key_fns_STARTUP_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_startup_internal_taskpool_t *__parsec_tp = (__parsec_startup_internal_taskpool_t *)user_data;
+  __parsec_startup_STARTUP_parsec_assignment_t __jdf2c__assignments = {  .i.value = 0, .j.value = 0, .k.value = 0, .valid1.value = 0, .valid2.value = 0, .prio.value = 0 };
+  int i = (__parsec_key) % __parsec_tp->STARTUP_i_range + __parsec_tp->STARTUP_i_min;
+  __parsec_key = __parsec_key / __parsec_tp->STARTUP_i_range;
+  __jdf2c__assignments.i.value = i;
+  int j = (__parsec_key) % __parsec_tp->STARTUP_j_range + __parsec_tp->STARTUP_j_min;
+  __parsec_key = __parsec_key / __parsec_tp->STARTUP_j_range;
+  __jdf2c__assignments.j.value = j;
+  int k = (__parsec_key) % __parsec_tp->STARTUP_k_range + __parsec_tp->STARTUP_k_min;
+  __parsec_key = __parsec_key / __parsec_tp->STARTUP_k_range;
+  __jdf2c__assignments.k.value = k;
+  int valid1 = ((i) == (1) && (j) == (1));
+  (void)valid1;
+  __jdf2c__assignments.valid1.value = valid1;
+  int valid2 = ((i) == (1) && (j) == (1));
+  (void)valid2;
+  __jdf2c__assignments.valid2.value = valid2;
+  int prio = startup_STARTUP_inline_c_expr1_line_41(__parsec_tp, &__jdf2c__assignments);
+  (void)prio;
+  __jdf2c__assignments.prio.value = prio;
+  (void)__jdf2c__assignments;
+  snprintf(buffer, buffer_size, "STARTUP(%d, %d, %d)", i, j, k);
+  return buffer;
+}
+
+static parsec_key_fn_t __jdf2c_key_fns_STARTUP = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = __jdf2c_key_fns_STARTUP_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+static inline int priority_of_startup_STARTUP_as_expr_fct(const __parsec_startup_internal_taskpool_t *__parsec_tp, const __parsec_startup_STARTUP_parsec_assignment_t *assignments);
+/******                                    STARTUP                                    ******/
+
+static inline int32_t minexpr_of_symb_startup_STARTUP_i_fct(const __parsec_startup_internal_taskpool_t *__parsec_tp, const __parsec_startup_STARTUP_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_startup_STARTUP_i = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_startup_STARTUP_i_fct }
+                   }
+};
+static inline int maxexpr_of_symb_startup_STARTUP_i_fct(const __parsec_startup_internal_taskpool_t *__parsec_tp, const __parsec_startup_STARTUP_parsec_assignment_t *locals)
+{
+  const int i = locals->i.value; (void)i;
+  const int j = locals->j.value; (void)j;
+  const int k = locals->k.value; (void)k;
+  const int valid1 = locals->valid1.value; (void)valid1;
+  const int valid2 = locals->valid2.value; (void)valid2;
+  const int prio = locals->prio.value; (void)prio;
+
+  (void)i;
+  (void)j;
+  (void)k;
+  (void)valid1;
+  (void)valid2;
+  (void)prio;
+  (void)__parsec_tp; (void)locals;
+  return (NI - 1);
+}
+static const parsec_expr_t maxexpr_of_symb_startup_STARTUP_i = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_startup_STARTUP_i_fct }
+                   }
+};
+static const parsec_symbol_t symb_startup_STARTUP_i = { .name = "i", .context_index = 0, .min = &minexpr_of_symb_startup_STARTUP_i, .max = &maxexpr_of_symb_startup_STARTUP_i, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int32_t minexpr_of_symb_startup_STARTUP_j_fct(const __parsec_startup_internal_taskpool_t *__parsec_tp, const __parsec_startup_STARTUP_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_startup_STARTUP_j = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_startup_STARTUP_j_fct }
+                   }
+};
+static inline int maxexpr_of_symb_startup_STARTUP_j_fct(const __parsec_startup_internal_taskpool_t *__parsec_tp, const __parsec_startup_STARTUP_parsec_assignment_t *locals)
+{
+  const int i = locals->i.value; (void)i;
+  const int j = locals->j.value; (void)j;
+  const int k = locals->k.value; (void)k;
+  const int valid1 = locals->valid1.value; (void)valid1;
+  const int valid2 = locals->valid2.value; (void)valid2;
+  const int prio = locals->prio.value; (void)prio;
+
+  (void)i;
+  (void)j;
+  (void)k;
+  (void)valid1;
+  (void)valid2;
+  (void)prio;
+  (void)__parsec_tp; (void)locals;
+  return (NJ - 1);
+}
+static const parsec_expr_t maxexpr_of_symb_startup_STARTUP_j = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_startup_STARTUP_j_fct }
+                   }
+};
+static const parsec_symbol_t symb_startup_STARTUP_j = { .name = "j", .context_index = 1, .min = &minexpr_of_symb_startup_STARTUP_j, .max = &maxexpr_of_symb_startup_STARTUP_j, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int32_t minexpr_of_symb_startup_STARTUP_k_fct(const __parsec_startup_internal_taskpool_t *__parsec_tp, const __parsec_startup_STARTUP_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_startup_STARTUP_k = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_startup_STARTUP_k_fct }
+                   }
+};
+static inline int maxexpr_of_symb_startup_STARTUP_k_fct(const __parsec_startup_internal_taskpool_t *__parsec_tp, const __parsec_startup_STARTUP_parsec_assignment_t *locals)
+{
+  const int i = locals->i.value; (void)i;
+  const int j = locals->j.value; (void)j;
+  const int k = locals->k.value; (void)k;
+  const int valid1 = locals->valid1.value; (void)valid1;
+  const int valid2 = locals->valid2.value; (void)valid2;
+  const int prio = locals->prio.value; (void)prio;
+
+  (void)i;
+  (void)j;
+  (void)k;
+  (void)valid1;
+  (void)valid2;
+  (void)prio;
+  (void)__parsec_tp; (void)locals;
+  return (NK - 1);
+}
+static const parsec_expr_t maxexpr_of_symb_startup_STARTUP_k = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_startup_STARTUP_k_fct }
+                   }
+};
+static const parsec_symbol_t symb_startup_STARTUP_k = { .name = "k", .context_index = 2, .min = &minexpr_of_symb_startup_STARTUP_k, .max = &maxexpr_of_symb_startup_STARTUP_k, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int expr_of_symb_startup_STARTUP_valid1_fct(const __parsec_startup_internal_taskpool_t *__parsec_tp, const __parsec_startup_STARTUP_parsec_assignment_t *locals)
+{
+  const int i = locals->i.value; (void)i;
+  const int j = locals->j.value; (void)j;
+  const int k = locals->k.value; (void)k;
+  const int valid1 = locals->valid1.value; (void)valid1;
+  const int valid2 = locals->valid2.value; (void)valid2;
+  const int prio = locals->prio.value; (void)prio;
+
+  (void)i;
+  (void)j;
+  (void)k;
+  (void)valid1;
+  (void)valid2;
+  (void)prio;
+  (void)__parsec_tp; (void)locals;
+  return ((i) == (1) && (j) == (1));
+}
+static const parsec_expr_t expr_of_symb_startup_STARTUP_valid1 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_startup_STARTUP_valid1_fct }
+                   }
+};
+static const parsec_symbol_t symb_startup_STARTUP_valid1 = { .name = "valid1", .context_index = 3, .min = &expr_of_symb_startup_STARTUP_valid1, .max = &expr_of_symb_startup_STARTUP_valid1, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int expr_of_symb_startup_STARTUP_valid2_fct(const __parsec_startup_internal_taskpool_t *__parsec_tp, const __parsec_startup_STARTUP_parsec_assignment_t *locals)
+{
+  const int i = locals->i.value; (void)i;
+  const int j = locals->j.value; (void)j;
+  const int k = locals->k.value; (void)k;
+  const int valid1 = locals->valid1.value; (void)valid1;
+  const int valid2 = locals->valid2.value; (void)valid2;
+  const int prio = locals->prio.value; (void)prio;
+
+  (void)i;
+  (void)j;
+  (void)k;
+  (void)valid1;
+  (void)valid2;
+  (void)prio;
+  (void)__parsec_tp; (void)locals;
+  return ((i) == (1) && (j) == (1));
+}
+static const parsec_expr_t expr_of_symb_startup_STARTUP_valid2 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_startup_STARTUP_valid2_fct }
+                   }
+};
+static const parsec_symbol_t symb_startup_STARTUP_valid2 = { .name = "valid2", .context_index = 4, .min = &expr_of_symb_startup_STARTUP_valid2, .max = &expr_of_symb_startup_STARTUP_valid2, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int32_t expr_of_symb_startup_STARTUP_prio_fct(const __parsec_startup_internal_taskpool_t *__parsec_tp, const __parsec_startup_STARTUP_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return startup_STARTUP_inline_c_expr1_line_41(__parsec_tp, locals);
+}
+static const parsec_expr_t expr_of_symb_startup_STARTUP_prio = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_symb_startup_STARTUP_prio_fct }
+                   }
+};
+static const parsec_symbol_t symb_startup_STARTUP_prio = { .name = "prio", .context_index = 5, .min = &expr_of_symb_startup_STARTUP_prio, .max = &expr_of_symb_startup_STARTUP_prio, .cst_inc = 0, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int affinity_of_startup_STARTUP(const __parsec_startup_STARTUP_task_t *this_task,
+                     parsec_data_ref_t *ref)
+{
+    const __parsec_startup_internal_taskpool_t *__parsec_tp = (const __parsec_startup_internal_taskpool_t*)this_task->taskpool;
+  const int i = this_task->locals.i.value; (void)i;
+  const int j = this_task->locals.j.value; (void)j;
+  const int k = this_task->locals.k.value; (void)k;
+  const int valid1 = this_task->locals.valid1.value; (void)valid1;
+  const int valid2 = this_task->locals.valid2.value; (void)valid2;
+  const int prio = this_task->locals.prio.value; (void)prio;
+
+  /* Silent Warnings: should look into predicate to know what variables are usefull */
+  (void)i;
+  (void)j;
+  (void)k;
+  (void)valid1;
+  (void)valid2;
+  (void)prio;
+  ref->dc = (parsec_data_collection_t *)__parsec_tp->super._g_descA;
+  /* Compute data key */
+  ref->key = ref->dc->data_key(ref->dc, i, 0);
+  return 1;
+}
+static inline int priority_of_startup_STARTUP_as_expr_fct(const __parsec_startup_internal_taskpool_t *__parsec_tp, const __parsec_startup_STARTUP_parsec_assignment_t *locals)
+{
+  const int i = locals->i.value; (void)i;
+  const int j = locals->j.value; (void)j;
+  const int k = locals->k.value; (void)k;
+  const int valid1 = locals->valid1.value; (void)valid1;
+  const int valid2 = locals->valid2.value; (void)valid2;
+  const int prio = locals->prio.value;
+
+  (void)i;
+  (void)j;
+  (void)k;
+  (void)valid1;
+  (void)valid2;
+  (void)prio;
+  (void)__parsec_tp; (void)locals;
+  return prio;
+}
+static const parsec_expr_t priority_of_startup_STARTUP_as_expr = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)priority_of_startup_STARTUP_as_expr_fct }
+                   }
+};
+static const parsec_property_t properties_of_startup_STARTUP[1] = {
+  {.name = NULL, .expr = NULL}
+};
+static parsec_data_t *flow_of_startup_STARTUP_for_A_dep1_atline_45_direct_access(const __parsec_startup_internal_taskpool_t *__parsec_tp, const __parsec_startup_STARTUP_parsec_assignment_t *assignments)
+{
+  const int i = assignments->i.value; (void)i;
+  const int j = assignments->j.value; (void)j;
+  const int k = assignments->k.value; (void)k;
+  const int valid1 = assignments->valid1.value; (void)valid1;
+  const int valid2 = assignments->valid2.value; (void)valid2;
+  const int prio = assignments->prio.value; (void)prio;
+
+  /* Silence Warnings: should look into parameters to know what variables are useful */
+  (void)i;
+  (void)j;
+  (void)k;
+  (void)valid1;
+  (void)valid2;
+  (void)prio;
+  if( __parsec_tp->super.super.context->my_rank == (int32_t)rank_of_descA(i, 0) )
+    return data_of_descA(i, 0);
+  return NULL;
+}
+
+static const parsec_dep_t flow_of_startup_STARTUP_for_A_dep1_atline_45 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = PARSEC_LOCAL_DATA_TASK_CLASS_ID, /* startup_descA */
+  .direct_data = (parsec_data_lookup_func_t)&flow_of_startup_STARTUP_for_A_dep1_atline_45_direct_access,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_startup_STARTUP_for_A,
+};
+static parsec_data_t *flow_of_startup_STARTUP_for_A_dep2_atline_46_direct_access(const __parsec_startup_internal_taskpool_t *__parsec_tp, const __parsec_startup_STARTUP_parsec_assignment_t *assignments)
+{
+  const int i = assignments->i.value; (void)i;
+  const int j = assignments->j.value; (void)j;
+  const int k = assignments->k.value; (void)k;
+  const int valid1 = assignments->valid1.value; (void)valid1;
+  const int valid2 = assignments->valid2.value; (void)valid2;
+  const int prio = assignments->prio.value; (void)prio;
+
+  /* Silence Warnings: should look into parameters to know what variables are useful */
+  (void)i;
+  (void)j;
+  (void)k;
+  (void)valid1;
+  (void)valid2;
+  (void)prio;
+  if( __parsec_tp->super.super.context->my_rank == (int32_t)rank_of_descA(i, 0) )
+    return data_of_descA(i, 0);
+  return NULL;
+}
+
+static const parsec_dep_t flow_of_startup_STARTUP_for_A_dep2_atline_46 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = PARSEC_LOCAL_DATA_TASK_CLASS_ID, /* startup_descA */
+  .direct_data = (parsec_data_lookup_func_t)&flow_of_startup_STARTUP_for_A_dep2_atline_46_direct_access,
+  .flags = PARSEC_DEP_FINAL_WRITE_AS_IS,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_startup_STARTUP_for_A,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+#if MAX_DEP_OUT_COUNT < 1  /* number of output dependencies */
+    #error Too many output dependencies (supports up to MAX_DEP_OUT_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_OUT_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_startup_STARTUP_for_A = {
+  .name               = "A",
+  .sym_type           = PARSEC_SYM_INOUT,
+  .flow_flags         = PARSEC_FLOW_ACCESS_READ|PARSEC_FLOW_HAS_IN_DEPS,
+  .flow_index         = 0,
+  .flow_datatype_mask = 0x1,
+  .dep_in     = { &flow_of_startup_STARTUP_for_A_dep1_atline_45 },
+  .dep_out    = { &flow_of_startup_STARTUP_for_A_dep2_atline_46 }
+};
+
+static int release_deps_of_startup_STARTUP(parsec_execution_stream_t *es, __parsec_startup_STARTUP_task_t *this_task, uint32_t action_mask, parsec_remote_deps_t *deps)
+{
+  PARSEC_PINS(es, RELEASE_DEPS_BEGIN, (parsec_task_t *)this_task);  const __parsec_startup_internal_taskpool_t *__parsec_tp = (const __parsec_startup_internal_taskpool_t *)this_task->taskpool;
+  parsec_release_dep_fct_arg_t arg;
+  int __vp_id;
+  int consume_local_repo = 0;
+  arg.action_mask = action_mask;
+  arg.output_entry = NULL;
+  arg.output_repo = NULL;
+#if defined(DISTRIBUTED)
+  arg.remote_deps = deps;
+#endif  /* defined(DISTRIBUTED) */
+  assert(NULL != es);
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS )    arg.ready_lists = alloca(sizeof(parsec_task_t *) * es->virtual_process->parsec_context->nb_vp);
+  else
+    arg.ready_lists = NULL;
+  for( __vp_id = 0; __vp_id < es->virtual_process->parsec_context->nb_vp; arg.ready_lists[__vp_id++] = NULL );
+  (void)__parsec_tp; (void)deps;
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_A.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_A.source_repo, this_task->data._f_A.source_repo_entry->ht_item.key );
+    }
+  }
+  consume_local_repo = (this_task->repo_entry != NULL);
+  /* No successors, don't call iterate_successors and don't release any local deps */
+      if (consume_local_repo) {
+         data_repo_entry_used_once( STARTUP_repo, this_task->repo_entry->ht_item.key );
+      }
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_A.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_A.data_in);
+    }
+  }
+  PARSEC_PINS(es, RELEASE_DEPS_END, (parsec_task_t *)this_task);  return 0;
+}
+
+static int data_lookup_of_startup_STARTUP(parsec_execution_stream_t *es, __parsec_startup_STARTUP_task_t *this_task)
+{
+  const __parsec_startup_internal_taskpool_t *__parsec_tp = (__parsec_startup_internal_taskpool_t *)this_task->taskpool;
+  parsec_assignment_t generic_locals[MAX_PARAM_COUNT];  /* generic task locals */
+  int target_device = 0; (void)target_device;
+  (void)__parsec_tp; (void)generic_locals; (void)es;
+  parsec_data_copy_t *chunk = NULL;
+  data_repo_t        *reshape_repo  = NULL, *consumed_repo  = NULL;
+  data_repo_entry_t  *reshape_entry = NULL, *consumed_entry = NULL;
+  parsec_key_t        reshape_entry_key = 0, consumed_entry_key = 0;
+  uint8_t             consumed_flow_index;
+  parsec_dep_data_description_t data;
+  int ret;
+  (void)reshape_repo; (void)reshape_entry; (void)reshape_entry_key;
+  (void)consumed_repo; (void)consumed_entry; (void)consumed_entry_key;
+  (void)consumed_flow_index;
+  (void)chunk; (void)data; (void)ret;
+  const int i = this_task->locals.i.value; (void)i;
+  const int j = this_task->locals.j.value; (void)j;
+  const int k = this_task->locals.k.value; (void)k;
+  const int valid1 = this_task->locals.valid1.value; (void)valid1;
+  const int valid2 = this_task->locals.valid2.value; (void)valid2;
+  const int prio = this_task->locals.prio.value; (void)prio;
+  if( NULL == this_task->repo_entry ){
+    this_task->repo_entry = data_repo_lookup_entry_and_create(es, STARTUP_repo,                                       __jdf2c_make_key_STARTUP((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    data_repo_entry_addto_usage_limit(STARTUP_repo, this_task->repo_entry->ht_item.key, 1);    this_task->repo_entry ->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(this_task->repo_entry ->sim_exec_date == 0);
+    this_task->repo_entry ->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  /* The reshape repo is the current task repo. */  reshape_repo = STARTUP_repo;
+  reshape_entry_key = __jdf2c_make_key_STARTUP((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals) ;
+  reshape_entry = this_task->repo_entry;
+  /* Lookup the input data, and store them in the context if any */
+
+if(! this_task->data._f_A.fulfill ){ /* Flow A */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_A.data_out = NULL;  /* By default, if nothing matches */
+  /* Flow A [0] dependency [0] from memory descA */
+  if( NULL == (chunk = this_task->data._f_A.data_in) ) {
+  /* No data set up by predecessor on this task input flow */
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+  parsec_prof_grapher_data_input(data_of_descA(i, 0), (parsec_task_t*)this_task, &flow_of_startup_STARTUP_for_A, 1);
+#endif
+    chunk = parsec_data_get_copy(data_of_descA(i, 0), target_device);
+    data.data = chunk;
+    data.data_future  = NULL;
+        data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.data_future   = NULL;
+    if( (ret = parsec_get_copy_reshape_from_desc(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    this_task->data._f_A.data_out = chunk;
+    PARSEC_OBJ_RETAIN(chunk);
+  } 
+    this_task->data._f_A.data_in     = chunk;
+    this_task->data._f_A.source_repo       = consumed_repo;
+    this_task->data._f_A.source_repo_entry = consumed_entry;
+    this_task->data._f_A.fulfill = 1;
+}
+
+  /** Generate profiling information */
+#if defined(PARSEC_PROF_TRACE)
+  this_task->prof_info.desc = (parsec_data_collection_t*)__parsec_tp->super._g_descA;
+  this_task->prof_info.priority = this_task->priority;
+  this_task->prof_info.data_id   = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->data_key((parsec_data_collection_t*)__parsec_tp->super._g_descA, i, 0);
+  this_task->prof_info.task_class_id = this_task->task_class->task_class_id;
+  this_task->prof_info.task_return_code = -1;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int datatype_lookup_of_startup_STARTUP(parsec_execution_stream_t *es, const parsec_task_t *this_generic_task, const parsec_task_t *parent_task,
+              uint32_t* flow_mask, parsec_dep_data_description_t* data)
+{
+  const __parsec_startup_STARTUP_task_t *this_task = (__parsec_startup_STARTUP_task_t*)this_generic_task;
+  const __parsec_startup_internal_taskpool_t *__parsec_tp = (__parsec_startup_internal_taskpool_t *)this_task->taskpool;
+  (void)__parsec_tp; (void)es; (void)this_task; (void)data; (void)parent_task;
+  const int i = this_task->locals.i.value; (void)i;
+  const int j = this_task->locals.j.value; (void)j;
+  const int k = this_task->locals.k.value; (void)k;
+  const int valid1 = this_task->locals.valid1.value; (void)valid1;
+  const int valid2 = this_task->locals.valid2.value; (void)valid2;
+  const int prio = this_task->locals.prio.value; (void)prio;
+  data->local.arena = data->remote.arena = NULL;
+  data->local.src_datatype  = data->local.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->local.src_count     = data->local.dst_count = 0;
+  data->local.src_displ     = data->local.dst_displ = 0;
+  data->data_future  = NULL;
+  if( (*flow_mask) & 0x80000000U ) { /* these are the input dependencies remote datatypes  */
+if( (*flow_mask) & 0x1U ) {  /* Flow A */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_startup_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_startup_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_startup_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+    goto no_mask_match;
+  }
+
+  /* these are the output dependencies remote datatypes */
+if( (*flow_mask) & 0x1U ) {  /* Flow A */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_startup_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_startup_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_startup_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+ no_mask_match:
+  data->data                             = NULL;
+  data->remote.src_datatype = data->remote.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->remote.src_count    = data->remote.dst_count = 0;
+  data->remote.src_displ    = data->remote.dst_displ = 0;
+  data->data_future  = NULL;
+  (*flow_mask) = 0;  /* nothing left */
+  (void)i;  (void)j;  (void)k;  (void)valid1;  (void)valid2;  (void)prio;
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+static int hook_of_startup_STARTUP(parsec_execution_stream_t *es, __parsec_startup_STARTUP_task_t *this_task)
+{
+  __parsec_startup_internal_taskpool_t *__parsec_tp = (__parsec_startup_internal_taskpool_t *)this_task->taskpool;
+  (void)es; (void)__parsec_tp;
+  const int i = this_task->locals.i.value; (void)i;
+  const int j = this_task->locals.j.value; (void)j;
+  const int k = this_task->locals.k.value; (void)k;
+  const int valid1 = this_task->locals.valid1.value; (void)valid1;
+  const int valid2 = this_task->locals.valid2.value; (void)valid2;
+  const int prio = this_task->locals.prio.value; (void)prio;
+  (void)i;  (void)j;  (void)k;  (void)valid1;  (void)valid2;  (void)prio;
+
+  /** Declare the variables that will hold the data, and all the accounting for each */
+  parsec_data_copy_t *_f_A = this_task->data._f_A.data_in;
+  void *A = PARSEC_DATA_COPY_GET_PTR(_f_A); (void)A;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    data_repo_entry_t *eA = this_task->data._f_A.source_repo_entry;
+    if( (NULL != eA) && (eA->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eA->sim_exec_date;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+  /** Cache Awareness Accounting */
+#if defined(PARSEC_CACHE_AWARENESS)
+  cache_buf_referenced(es->closest_cache, A);
+#endif /* PARSEC_CACHE_AWARENESS */
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                                  STARTUP BODY                                  -----*/
+
+{
+#if defined(DEBUG_STARTUP_TASK)
+    fprintf(stderr, "priority(%d, %d, %d): %d\n",
+            i, j, k, prio );
+#endif
+    assert(valid1 == valid2);
+}
+
+/*-----                              END OF STARTUP BODY                              -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#endif  /*  defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+static int complete_hook_of_startup_STARTUP(parsec_execution_stream_t *es, __parsec_startup_STARTUP_task_t *this_task)
+{
+  const __parsec_startup_internal_taskpool_t *__parsec_tp = (__parsec_startup_internal_taskpool_t *)this_task->taskpool;
+#if defined(DISTRIBUTED)
+    const int i = this_task->locals.i.value; (void)i;
+  const int j = this_task->locals.j.value; (void)j;
+  const int k = this_task->locals.k.value; (void)k;
+  const int valid1 = this_task->locals.valid1.value; (void)valid1;
+  const int valid2 = this_task->locals.valid2.value; (void)valid2;
+  const int prio = this_task->locals.prio.value; (void)prio;
+#endif  /* defined(DISTRIBUTED) */
+  (void)es; (void)__parsec_tp;
+parsec_data_t* data_t_desc = NULL; (void)data_t_desc;
+#if defined(DISTRIBUTED)
+  /** If not working on distributed, there is no risk that data is not in place */
+  data_t_desc = data_of_descA(i, 0);
+  if( (NULL != this_task->data._f_A.data_out) && (this_task->data._f_A.data_out->original != data_t_desc) ) {
+    /* Writting back using remote_type */;
+    parsec_dep_data_description_t data;
+    data.data         = this_task->data._f_A.data_out;
+    data.local.arena        = NULL;
+    data.local.src_datatype = data.data->dtt;
+    data.local.src_count    = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_datatype = parsec_data_get_copy(data_t_desc, 0)->dtt;
+    data.local.dst_count    = 1;
+    data.local.dst_displ    = 0;
+    data.data_future  = NULL;
+    assert( data.local.src_count > 0 );
+    parsec_remote_dep_memcpy(es,
+                            this_task->taskpool,
+                            parsec_data_get_copy(data_of_descA(i, 0), 0),
+                            this_task->data._f_A.data_out, &data);
+  }
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+  parsec_prof_grapher_data_output((parsec_task_t*)this_task, data_of_descA(i, 0), &flow_of_startup_STARTUP_for_A);
+#endif
+  (void)i;  (void)j;  (void)k;  (void)valid1;  (void)valid2;  (void)prio;
+
+#endif /* DISTRIBUTED */
+#if defined(PARSEC_PROF_GRAPHER)
+  parsec_prof_grapher_task((parsec_task_t*)this_task, es->th_id, es->virtual_process->vp_id,
+     __jdf2c_key_fns_STARTUP.key_hash(this_task->task_class->make_key( (parsec_taskpool_t*)this_task->taskpool, ((parsec_task_t*)this_task)->locals), NULL));
+#endif  /* defined(PARSEC_PROF_GRAPHER) */
+  release_deps_of_startup_STARTUP(es, this_task,
+      PARSEC_ACTION_RELEASE_REMOTE_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_REFS |
+      PARSEC_ACTION_RESHAPE_ON_RELEASE |
+      0x1,  /* mask of all dep_index */ 
+      NULL);
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static parsec_hook_return_t release_task_of_startup_STARTUP(parsec_execution_stream_t *es, parsec_task_t *this_task)
+{
+    const __parsec_startup_internal_taskpool_t *__parsec_tp =
+        (const __parsec_startup_internal_taskpool_t *)this_task->taskpool;
+    parsec_hash_table_t *ht = (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[0];
+    parsec_key_t key = this_task->task_class->make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals);
+    parsec_hashable_dependency_t *hash_dep = (parsec_hashable_dependency_t *)parsec_hash_table_remove(ht, key);
+    parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);
+    return parsec_release_task_to_mempool_update_nbtasks(es, this_task);
+}
+
+static char *startup_startup_STARTUP_internal_init_deps_key_functions_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_startup_internal_taskpool_t *__parsec_tp = (__parsec_startup_internal_taskpool_t *)user_data;
+  __parsec_startup_STARTUP_parsec_assignment_t __jdf2c__assignments = {  .i.value = 0, .j.value = 0, .k.value = 0, .valid1.value = 0, .valid2.value = 0, .prio.value = 0 };
+  int i = (__parsec_key) % __parsec_tp->STARTUP_i_range + __parsec_tp->STARTUP_i_min;
+  __parsec_key = __parsec_key / __parsec_tp->STARTUP_i_range;
+  __jdf2c__assignments.i.value = i;
+  int j = (__parsec_key) % __parsec_tp->STARTUP_j_range + __parsec_tp->STARTUP_j_min;
+  __parsec_key = __parsec_key / __parsec_tp->STARTUP_j_range;
+  __jdf2c__assignments.j.value = j;
+  int k = (__parsec_key) % __parsec_tp->STARTUP_k_range + __parsec_tp->STARTUP_k_min;
+  __parsec_key = __parsec_key / __parsec_tp->STARTUP_k_range;
+  __jdf2c__assignments.k.value = k;
+  int valid1 = ((i) == (1) && (j) == (1));
+  (void)valid1;
+  __jdf2c__assignments.valid1.value = valid1;
+  int valid2 = ((i) == (1) && (j) == (1));
+  (void)valid2;
+  __jdf2c__assignments.valid2.value = valid2;
+  int prio = startup_STARTUP_inline_c_expr1_line_41(__parsec_tp, &__jdf2c__assignments);
+  (void)prio;
+  __jdf2c__assignments.prio.value = prio;
+  (void)__jdf2c__assignments;
+  snprintf(buffer, buffer_size, "STARTUP(%d, %d, %d)", i, j, k);
+  return buffer;
+}
+
+static parsec_key_fn_t startup_startup_STARTUP_internal_init_deps_key_functions = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = startup_startup_STARTUP_internal_init_deps_key_functions_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/* Needs: min-max count-tasks iterate */
+static int startup_STARTUP_internal_init(parsec_execution_stream_t * es, __parsec_startup_STARTUP_task_t * this_task)
+{
+  __parsec_startup_internal_taskpool_t *__parsec_tp = (__parsec_startup_internal_taskpool_t*)this_task->taskpool;
+  int32_t nb_tasks = 0, saved_nb_tasks = 0;
+int32_t __i_min = 0x7fffffff, __i_max = 0;int32_t __jdf2c_i_min = 0x7fffffff, __jdf2c_i_max = 0;int32_t __j_min = 0x7fffffff, __j_max = 0;int32_t __jdf2c_j_min = 0x7fffffff, __jdf2c_j_max = 0;int32_t __k_min = 0x7fffffff, __k_max = 0;int32_t __jdf2c_k_min = 0x7fffffff, __jdf2c_k_max = 0;  __parsec_startup_STARTUP_parsec_assignment_t assignments = {  .i.value = 0, .j.value = 0, .k.value = 0, .valid1.value = 0, .valid2.value = 0, .prio.value = 0 };
+  int32_t  i,  j,  k,  valid1,  valid2,  prio;
+  int32_t __jdf2c_i_start, __jdf2c_i_end, __jdf2c_i_inc;
+  int32_t __jdf2c_j_start, __jdf2c_j_end, __jdf2c_j_inc;
+  int32_t __jdf2c_k_start, __jdf2c_k_end, __jdf2c_k_inc;
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+  PARSEC_PROFILING_TRACE(es->es_profile,
+                         this_task->taskpool->profiling_array[START_KEY(this_task->task_class->task_class_id)],
+                         0,
+                         this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    __jdf2c_i_start = 0;
+    __jdf2c_i_end = (NI - 1);
+    __jdf2c_i_inc = 1;
+    __i_min = parsec_imin(__jdf2c_i_start, __jdf2c_i_end);
+    __i_max = parsec_imax(__jdf2c_i_start, __jdf2c_i_end);
+    __jdf2c_i_min = parsec_imin(__jdf2c_i_min, __i_min);
+    __jdf2c_i_max = parsec_imax(__jdf2c_i_max, __i_max);
+    for(i =  __jdf2c_i_start;
+        i <= __jdf2c_i_end;
+        i += __jdf2c_i_inc) {
+    assignments.i.value = i;
+      __jdf2c_j_start = 0;
+      __jdf2c_j_end = (NJ - 1);
+      __jdf2c_j_inc = 1;
+      __j_min = parsec_imin(__jdf2c_j_start, __jdf2c_j_end);
+      __j_max = parsec_imax(__jdf2c_j_start, __jdf2c_j_end);
+      __jdf2c_j_min = parsec_imin(__jdf2c_j_min, __j_min);
+      __jdf2c_j_max = parsec_imax(__jdf2c_j_max, __j_max);
+      for(j =  __jdf2c_j_start;
+          j <= __jdf2c_j_end;
+          j += __jdf2c_j_inc) {
+      assignments.j.value = j;
+        __jdf2c_k_start = 0;
+        __jdf2c_k_end = (NK - 1);
+        __jdf2c_k_inc = 1;
+        __k_min = parsec_imin(__jdf2c_k_start, __jdf2c_k_end);
+        __k_max = parsec_imax(__jdf2c_k_start, __jdf2c_k_end);
+        __jdf2c_k_min = parsec_imin(__jdf2c_k_min, __k_min);
+        __jdf2c_k_max = parsec_imax(__jdf2c_k_max, __k_max);
+        for(k =  __jdf2c_k_start;
+            k <= __jdf2c_k_end;
+            k += __jdf2c_k_inc) {
+        assignments.k.value = k;
+      {  /* block for the non-range variable valid1 */
+          valid1 = ((i) == (1) && (j) == (1));
+          assignments.valid1.value = valid1;
+        {  /* block for the non-range variable valid2 */
+            valid2 = ((i) == (1) && (j) == (1));
+            assignments.valid2.value = valid2;
+          {  /* block for the non-range variable prio */
+              prio = startup_STARTUP_inline_c_expr1_line_41(__parsec_tp, &assignments);
+              assignments.prio.value = prio;
+              if( !STARTUP_pred(i, j, k, valid1, valid2, prio) ) continue;
+              nb_tasks++;
+            } /* block for the non-range variable prio */ 
+          } /* block for the non-range variable valid2 */ 
+        } /* block for the non-range variable valid1 */ 
+      } /* Loop on normal range k */
+    } /* For loop of j */ 
+  } /* For loop of i */ 
+   if( 0 != nb_tasks ) {
+     (void)parsec_atomic_fetch_add_int32(&__parsec_tp->initial_number_tasks, nb_tasks);
+   }
+  /* Set the range variables for the collision-free hash-computation */
+  __parsec_tp->STARTUP_i_min   = __jdf2c_i_min;
+  __parsec_tp->STARTUP_i_range = (__jdf2c_i_max - __jdf2c_i_min) + 1;
+  __parsec_tp->STARTUP_j_min   = __jdf2c_j_min;
+  __parsec_tp->STARTUP_j_range = (__jdf2c_j_max - __jdf2c_j_min) + 1;
+  __parsec_tp->STARTUP_k_min   = __jdf2c_k_min;
+  __parsec_tp->STARTUP_k_range = (__jdf2c_k_max - __jdf2c_k_min) + 1;
+    do {
+      this_task->super.list_next = (parsec_list_item_t*)__parsec_tp->startup_queue;
+    } while(!parsec_atomic_cas_ptr(&__parsec_tp->startup_queue, (parsec_list_item_t*)this_task->super.list_next, this_task));
+    this_task->status = PARSEC_TASK_STATUS_HOOK;
+
+  PARSEC_AYU_REGISTER_TASK(&startup_STARTUP);
+  __parsec_tp->super.super.dependencies_array[0] = PARSEC_OBJ_NEW(parsec_hash_table_t);
+  parsec_hash_table_init(__parsec_tp->super.super.dependencies_array[0], offsetof(parsec_hashable_dependency_t, ht_item), 10, startup_startup_STARTUP_internal_init_deps_key_functions, this_task->taskpool);
+  __parsec_tp->repositories[0] = data_repo_create_nothreadsafe(nb_tasks, __jdf2c_key_fns_STARTUP, (parsec_taskpool_t*)__parsec_tp, 1);
+(void)saved_nb_tasks;
+(void)__i_min; (void)__i_max;(void)__j_min; (void)__j_max;(void)__k_min; (void)__k_max;  (void)__jdf2c_i_start; (void)__jdf2c_i_end; (void)__jdf2c_i_inc;  (void)__jdf2c_j_start; (void)__jdf2c_j_end; (void)__jdf2c_j_inc;  (void)__jdf2c_k_start; (void)__jdf2c_k_end; (void)__jdf2c_k_inc;  (void)assignments; (void)__parsec_tp; (void)es;
+  if(1 == parsec_atomic_fetch_dec_int32(&__parsec_tp->sync_point)) {
+    /* Last initialization task complete. Update the number of tasks. */
+    __parsec_tp->super.super.tdm.module->taskpool_addto_nb_tasks(&__parsec_tp->super.super, __parsec_tp->initial_number_tasks);
+    parsec_mfence();  /* write memory barrier to guarantee that the scheduler gets the correct number of tasks */
+    parsec_taskpool_enable((parsec_taskpool_t*)__parsec_tp, &__parsec_tp->startup_queue,
+                           (parsec_task_t*)this_task, es, __parsec_tp->super.super.nb_pending_actions);
+    __parsec_tp->super.super.tdm.module->taskpool_ready(&__parsec_tp->super.super);
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+    PARSEC_PROFILING_TRACE(es->es_profile,
+                           this_task->taskpool->profiling_array[2 * this_task->task_class->task_class_id + 1],
+                           0,
+                           this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    if( 1 >= __parsec_tp->super.super.nb_pending_actions ) {
+        /* if no tasks will be generated let's prevent the runtime from calling the hook and instead go directly to complete the task */
+        this_task->status = PARSEC_TASK_STATUS_COMPLETE;
+    }
+    return PARSEC_HOOK_RETURN_DONE;
+  }
+  return PARSEC_HOOK_RETURN_ASYNC;
+}
+
+static int __jdf2c_startup_STARTUP(parsec_execution_stream_t * es, __parsec_startup_STARTUP_task_t *this_task)
+{
+  __parsec_startup_STARTUP_task_t* new_task;
+  __parsec_startup_internal_taskpool_t* __parsec_tp = (__parsec_startup_internal_taskpool_t*)this_task->taskpool;
+  parsec_context_t *context = __parsec_tp->super.super.context;
+  int vpid = 0, nb_tasks = 0;
+  size_t total_nb_tasks = 0;
+  parsec_list_item_t* pready_ring[context->nb_vp];
+  int restore_context = 0;
+  int i = this_task->locals.i.value;  /* retrieve value saved during the last iteration */
+  int j = this_task->locals.j.value;  /* retrieve value saved during the last iteration */
+  int k = this_task->locals.k.value;  /* retrieve value saved during the last iteration */
+  int valid1 = this_task->locals.valid1.value;  /* retrieve value saved during the last iteration */
+  int valid2 = this_task->locals.valid2.value;  /* retrieve value saved during the last iteration */
+  int prio = this_task->locals.prio.value;  /* retrieve value saved during the last iteration */
+  for(int _i = 0; _i < context->nb_vp; pready_ring[_i++] = NULL );
+  if( 0 != this_task->locals.reserved[0].value ) {
+    this_task->locals.reserved[0].value = 1; /* reset the submission process */
+    restore_context = 1;
+    goto restore_context_0;
+  }
+  this_task->locals.reserved[0].value = 1; /* a sane default value */
+  for(this_task->locals.i.value = i = 0;
+      this_task->locals.i.value <= (NI - 1);
+      this_task->locals.i.value += 1, i = this_task->locals.i.value) {
+    for(this_task->locals.j.value = j = 0;
+        this_task->locals.j.value <= (NJ - 1);
+        this_task->locals.j.value += 1, j = this_task->locals.j.value) {
+      for(this_task->locals.k.value = k = 0;
+          this_task->locals.k.value <= (NK - 1);
+          this_task->locals.k.value += 1, k = this_task->locals.k.value) {
+        this_task->locals.valid1.value = valid1 = ((i) == (1) && (j) == (1));
+        this_task->locals.valid2.value = valid2 = ((i) == (1) && (j) == (1));
+        this_task->locals.prio.value = prio = startup_STARTUP_inline_c_expr1_line_41(__parsec_tp, &this_task->locals);
+        if( !STARTUP_pred(i, j, k, valid1, valid2, prio) ) continue;
+  __parsec_startup_STARTUP_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_startup_STARTUP_parsec_assignment_t*)&this_task->locals;
+  (void)__jdf2c__tmp_locals;
+  /* Flow for A is always a memory reference */
+        if( NULL != ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of ) {
+          vpid = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, i, 0);
+          assert(context->nb_vp >= vpid);
+        } else {
+          vpid = (vpid + 1) % context->nb_vp;  /* spread the initial joy */
+        }
+        new_task = (__parsec_startup_STARTUP_task_t*)parsec_thread_mempool_allocate( context->virtual_processes[vpid]->execution_streams[0]->context_mempool );
+        PARSEC_OBJ_CONSTRUCT(new_task, parsec_task_t); /* construct called only when new, force-construct it again */
+        /* Copy only the valid elements from this_task to new_task one */
+        new_task->taskpool   = this_task->taskpool;
+        new_task->task_class = __parsec_tp->super.super.task_classes_array[startup_STARTUP.task_class_id];
+        new_task->chore_mask   = PARSEC_DEV_ALL;
+        new_task->locals.i.value = this_task->locals.i.value;
+        new_task->locals.j.value = this_task->locals.j.value;
+        new_task->locals.k.value = this_task->locals.k.value;
+        new_task->locals.valid1.value = this_task->locals.valid1.value;
+        new_task->locals.valid2.value = this_task->locals.valid2.value;
+        new_task->locals.prio.value = this_task->locals.prio.value;
+        PARSEC_LIST_ITEM_SINGLETON(new_task);
+        new_task->priority = __parsec_tp->super.super.priority + priority_of_startup_STARTUP_as_expr_fct((__parsec_startup_internal_taskpool_t*)new_task->taskpool, &new_task->locals);
+        new_task->repo_entry = NULL;
+        new_task->data._f_A.source_repo_entry = NULL;
+        new_task->data._f_A.source_repo       = NULL;
+        new_task->data._f_A.data_in         = NULL;
+        new_task->data._f_A.data_out        = NULL;
+        new_task->data._f_A.fulfill         = 0;
+#if defined(PARSEC_DEBUG_NOISIER)
+        {
+          char tmp[128];
+          PARSEC_DEBUG_VERBOSE(10, parsec_debug_output, "Add startup task %s to vpid %d",
+                 parsec_task_snprintf(tmp, 128, (parsec_task_t*)new_task), vpid);
+        }
+#endif
+        parsec_dependencies_mark_task_as_startup((parsec_task_t*)new_task, es);
+        pready_ring[vpid] = parsec_list_item_ring_push_sorted(pready_ring[vpid],
+                                                              (parsec_list_item_t*)new_task,
+                                                              parsec_execution_context_priority_comparator);
+        nb_tasks++;
+       restore_context_0:  /* we jump here just so that we have code after the label */
+        restore_context = 0;
+        (void)restore_context;
+        if( nb_tasks > this_task->locals.reserved[0].value ) {
+          if( (size_t)this_task->locals.reserved[0].value < parsec_task_startup_iter ) this_task->locals.reserved[0].value <<= 1;
+          __parsec_schedule_vp(es, (parsec_task_t**)pready_ring, 0);
+          total_nb_tasks += nb_tasks;
+          nb_tasks = 0;
+          if( total_nb_tasks > parsec_task_startup_chunk ) {  /* stop here and request to be rescheduled */
+            return PARSEC_HOOK_RETURN_AGAIN;
+          }
+        }
+      } /* Loop on normal range k */
+    } /* Loop on normal range j */
+  } /* Loop on normal range i */
+  (void)vpid;
+  if( 0 != nb_tasks ) {
+    __parsec_schedule_vp(es, (parsec_task_t**)pready_ring, 0);
+    nb_tasks = 0;
+  }
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static const __parsec_chore_t __startup_STARTUP_chores[] ={
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+    { .type     = PARSEC_DEV_CPU,
+      .evaluate = (parsec_evaluate_function_t*)NULL,
+      .hook     = (parsec_hook_t*)hook_of_startup_STARTUP },
+#endif  /* defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+    { .type     = PARSEC_DEV_NONE,
+      .evaluate = NULL,
+      .hook     = (parsec_hook_t*)NULL },  /* End marker */
+};
+
+static const parsec_task_class_t startup_STARTUP = {
+  .name = "STARTUP",
+  .task_class_id = 0,
+  .nb_flows = 1,
+  .nb_parameters = 3,
+  .nb_locals = 6,
+  .task_class_type = PARSEC_TASK_CLASS_TYPE_PTG,
+  .params = { &symb_startup_STARTUP_i, &symb_startup_STARTUP_j, &symb_startup_STARTUP_k, NULL },
+  .locals = { &symb_startup_STARTUP_i, &symb_startup_STARTUP_j, &symb_startup_STARTUP_k, &symb_startup_STARTUP_valid1, &symb_startup_STARTUP_valid2, &symb_startup_STARTUP_prio, NULL },
+  .data_affinity = (parsec_data_ref_fn_t*)affinity_of_startup_STARTUP,
+  .initial_data = (parsec_data_ref_fn_t*)affinity_of_startup_STARTUP,
+  .final_data = (parsec_data_ref_fn_t*)affinity_of_startup_STARTUP,
+  .priority = &priority_of_startup_STARTUP_as_expr,
+  .properties = properties_of_startup_STARTUP,
+#if MAX_PARAM_COUNT < 1  /* number of read flows of STARTUP */
+  #error Too many read flows for task STARTUP
+#endif  /* MAX_PARAM_COUNT */
+#if MAX_PARAM_COUNT < 0  /* number of write flows of STARTUP */
+  #error Too many write flows for task STARTUP
+#endif  /* MAX_PARAM_COUNT */
+  .in = { &flow_of_startup_STARTUP_for_A, NULL },
+  .out = { &flow_of_startup_STARTUP_for_A, NULL },
+  .flags = 0x0 | PARSEC_HAS_IN_IN_DEPENDENCIES | PARSEC_USE_DEPS_MASK,
+  .dependencies_goal = 0x1,
+  .make_key = __jdf2c_make_key_STARTUP,
+  .task_snprintf = parsec_task_snprintf,
+#if defined(PARSEC_PROF_TRACE)
+  .profile_info = &parsec_task_profile_info,
+#endif
+  .key_functions = &__jdf2c_key_fns_STARTUP,
+  .fini = (parsec_hook_t*)NULL,
+  .incarnations = __startup_STARTUP_chores,
+  .find_deps = parsec_hash_find_deps,
+  .update_deps = parsec_update_deps_with_mask,
+  .iterate_successors = (parsec_traverse_function_t*)NULL,
+  .iterate_predecessors = (parsec_traverse_function_t*)NULL,
+  .release_deps = (parsec_release_deps_t*)release_deps_of_startup_STARTUP,
+  .prepare_output = (parsec_hook_t*)NULL,
+  .prepare_input = (parsec_hook_t*)data_lookup_of_startup_STARTUP,
+  .time_estimate = NULL,
+  .get_datatype = datatype_lookup_of_startup_STARTUP,
+  .complete_execution = (parsec_hook_t*)complete_hook_of_startup_STARTUP,
+  .release_task = &release_task_of_startup_STARTUP,
+#if defined(PARSEC_SIM)
+  .sim_cost_fct = (parsec_sim_cost_fct_t*)NULL,
+#endif
+};
+
+
+static const parsec_task_class_t *startup_task_classes[] = {
+  &startup_STARTUP
+};
+
+static void startup_startup(parsec_context_t *context, __parsec_startup_internal_taskpool_t *__parsec_tp, parsec_list_item_t ** ready_tasks)
+{
+  uint32_t i, supported_dev = 0;
+ 
+  for( i = 0; i < parsec_nb_devices; i++ ) {
+    if( !(__parsec_tp->super.super.devices_index_mask & (1<<i)) ) continue;
+    parsec_device_module_t* device = parsec_mca_device_get(i);
+    parsec_data_collection_t* parsec_dc;
+ 
+    if(NULL == device) continue;
+    if(NULL != device->taskpool_register)
+      if( PARSEC_SUCCESS != device->taskpool_register(device, (parsec_taskpool_t*)__parsec_tp) ) {
+        parsec_debug_verbose(5, parsec_debug_output, "Device %s refused to register taskpool %p", device->name, __parsec_tp);
+        __parsec_tp->super.super.devices_index_mask &= ~(1 << device->device_index);
+        continue;
+      }
+    if(NULL != device->memory_register) {  /* Register all the data */
+      parsec_dc = (parsec_data_collection_t*)__parsec_tp->super._g_descA;
+      if( (NULL != parsec_dc->register_memory) &&
+          (PARSEC_SUCCESS != parsec_dc->register_memory(parsec_dc, device)) ) {
+        parsec_debug_verbose(3, parsec_debug_output, "Device %s refused to register memory for data %s (%p) from taskpool %p",
+                     device->name, parsec_dc->key_base, parsec_dc, __parsec_tp);
+        __parsec_tp->super.super.devices_index_mask &= ~(1 << device->device_index);
+      }
+    }
+    supported_dev |= device->type;
+  }
+  /* Remove all the chores without a backend device */
+  for( i = 0; i < PARSEC_startup_NB_TASK_CLASSES; i++ ) {
+    parsec_task_class_t* tc = (parsec_task_class_t*)__parsec_tp->super.super.task_classes_array[i];
+    __parsec_chore_t* chores = (__parsec_chore_t*)tc->incarnations;
+    uint32_t idx = 0, j;
+    for( j = 0; PARSEC_DEV_NONE != chores[j].type; j++ ) {
+      if( !(supported_dev & chores[j].type) ) continue;
+      if( j != idx ) {
+        chores[idx] = chores[j];
+        parsec_debug_verbose(20, parsec_debug_output, "Device type %i disabled for function %s"
+, chores[j].type, tc->name);
+      }
+      idx++;
+    }
+    chores[idx].type     = PARSEC_DEV_NONE;
+    chores[idx].evaluate = NULL;
+    chores[idx].hook     = NULL;
+    /* Create the initialization tasks for each taskclass */
+    parsec_task_t* task = (parsec_task_t*)parsec_thread_mempool_allocate(context->virtual_processes[0]->execution_streams[0]->context_mempool);
+    PARSEC_OBJ_CONSTRUCT(task, parsec_task_t); /* construct called only when new, force-construct it again */
+    task->taskpool = (parsec_taskpool_t *)__parsec_tp;
+    task->chore_mask = PARSEC_DEV_CPU;
+    memset(&task->locals, 0, sizeof(parsec_assignment_t) * MAX_LOCAL_COUNT);
+    PARSEC_LIST_ITEM_SINGLETON(task);
+    task->priority = -1;
+    task->task_class = task->taskpool->task_classes_array[PARSEC_startup_NB_TASK_CLASSES + i];
+    int where = i % context->nb_vp;
+    if( NULL == ready_tasks[where] ) ready_tasks[where] = &task->super;
+    else ready_tasks[where] = parsec_list_item_ring_push(ready_tasks[where], &task->super);
+  }
+}
+static void __parsec_startup_internal_destructor( __parsec_startup_internal_taskpool_t *__parsec_tp )
+{
+  uint32_t i;
+  parsec_taskpool_unregister( &__parsec_tp->super.super );
+  if(NULL != __parsec_tp->super.super.tdm.module) __parsec_tp->super.super.tdm.module->unmonitor_taskpool(&__parsec_tp->super.super);
+  for( i = 0; i < (uint32_t)(2 * __parsec_tp->super.super.nb_task_classes); i++ ) {  /* Extra startup function added at the end */
+    parsec_task_class_t* tc = (parsec_task_class_t*)__parsec_tp->super.super.task_classes_array[i];
+    free((void*)tc->incarnations);
+    free(tc);
+  }
+  free(__parsec_tp->super.super.task_classes_array); __parsec_tp->super.super.task_classes_array = NULL;
+  __parsec_tp->super.super.nb_task_classes = 0;
+
+  for(i = 0; i < (uint32_t)__parsec_tp->super.arenas_datatypes_size; i++) {
+    if( NULL != __parsec_tp->super.arenas_datatypes[i].arena ) {
+      PARSEC_OBJ_RELEASE(__parsec_tp->super.arenas_datatypes[i].arena);
+    }
+  }
+  /* Destroy the data repositories for this object */
+   data_repo_destroy_nothreadsafe(__parsec_tp->repositories[0]);  /* STARTUP */
+  /* Release the dependencies arrays for this object */
+  parsec_hash_table_fini( (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[0] );
+  PARSEC_OBJ_RELEASE(__parsec_tp->super.super.dependencies_array[0]);
+  __parsec_tp->super.super.dependencies_array[0] = NULL;
+  free( __parsec_tp->super.super.dependencies_array );
+  __parsec_tp->super.super.dependencies_array = NULL;
+  /* Unregister all the data */
+  uint32_t _i;
+  for( _i = 0; _i < parsec_nb_devices; _i++ ) {
+    parsec_device_module_t* device;
+    parsec_data_collection_t* parsec_dc;
+    if(!(__parsec_tp->super.super.devices_index_mask & (1 << _i))) continue;
+    if((NULL == (device = parsec_mca_device_get(_i))) || (NULL == device->memory_unregister)) continue;
+    parsec_dc = (parsec_data_collection_t*)__parsec_tp->super._g_descA;
+  if( NULL != parsec_dc->unregister_memory ) { (void)parsec_dc->unregister_memory(parsec_dc, device); };
+}
+  /* Unregister the taskpool from the devices */
+  for( i = 0; i < parsec_nb_devices; i++ ) {
+    if(!(__parsec_tp->super.super.devices_index_mask & (1 << i))) continue;
+    __parsec_tp->super.super.devices_index_mask ^= (1 << i);
+    parsec_device_module_t* device = parsec_mca_device_get(i);
+    if((NULL == device) || (NULL == device->taskpool_unregister)) continue;
+    if( PARSEC_SUCCESS != device->taskpool_unregister(device, &__parsec_tp->super.super) ) continue;
+  }
+  free(__parsec_tp->super.super.taskpool_name); __parsec_tp->super.super.taskpool_name = NULL;
+}
+
+void __parsec_startup_internal_constructor(__parsec_startup_internal_taskpool_t* __parsec_tp)
+{
+  parsec_task_class_t* tc;
+  uint32_t i, j;
+
+  __parsec_tp->super.super.nb_task_classes = PARSEC_startup_NB_TASK_CLASSES;
+  __parsec_tp->super.super.devices_index_mask = PARSEC_DEVICES_ALL;
+  __parsec_tp->super.super.taskpool_name = strdup("startup");
+  parsec_termdet_open_module(&__parsec_tp->super.super, "local");
+  __parsec_tp->super.super.tdm.module->monitor_taskpool(&__parsec_tp->super.super,
+                                                        parsec_taskpool_termination_detected);
+  __parsec_tp->super.super.update_nb_runtime_task = parsec_add_fetch_runtime_task;
+  __parsec_tp->super.super.dependencies_array = (void **)
+              calloc(__parsec_tp->super.super.nb_task_classes, sizeof(void*));
+  /* Twice the size to hold the startup tasks function_t */
+  __parsec_tp->super.super.task_classes_array = (const parsec_task_class_t**)
+              calloc((2 * PARSEC_startup_NB_TASK_CLASSES + 1), sizeof(parsec_task_class_t*));
+  __parsec_tp->super.super.tdm.module->taskpool_addto_runtime_actions(&__parsec_tp->super.super, PARSEC_startup_NB_TASK_CLASSES);  /* for the startup tasks */
+  __parsec_tp->super.super.taskpool_type = PARSEC_TASKPOOL_TYPE_PTG;
+  __parsec_tp->sync_point = __parsec_tp->super.super.nb_task_classes;
+  __parsec_tp->initial_number_tasks = 0;
+  __parsec_tp->startup_queue = NULL;
+  for( i = 0; i < __parsec_tp->super.super.nb_task_classes; i++ ) {
+    __parsec_tp->super.super.task_classes_array[i] = tc = malloc(sizeof(parsec_task_class_t));
+    memcpy(tc, startup_task_classes[i], sizeof(parsec_task_class_t));
+    for( j = 0; PARSEC_DEV_NONE != tc->incarnations[j].type; j++);  /* compute the number of incarnations */
+    tc->incarnations = (__parsec_chore_t*)malloc((j+1) * sizeof(__parsec_chore_t));
+        memcpy((__parsec_chore_t*)tc->incarnations, startup_task_classes[i]->incarnations, (j+1) * sizeof(__parsec_chore_t));
+
+    /* Add a placeholder for initialization and startup task */
+    __parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+i] = tc = (parsec_task_class_t*)malloc(sizeof(parsec_task_class_t));
+    memcpy(tc, (void*)&__parsec_generic_startup, sizeof(parsec_task_class_t));
+    tc->task_class_id = __parsec_tp->super.super.nb_task_classes + i;
+    tc->incarnations = (__parsec_chore_t*)malloc(2 * sizeof(__parsec_chore_t));
+    memcpy((__parsec_chore_t*)tc->incarnations, (void*)__parsec_generic_startup.incarnations, 2 * sizeof(__parsec_chore_t));
+    tc->release_task = parsec_release_task_to_mempool_and_count_as_runtime_tasks;
+  }
+  /* Startup task for STARTUP */
+  tc = (parsec_task_class_t *)__parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+0];
+  tc->name = "Startup for STARTUP";
+  tc->prepare_input = (parsec_hook_t*)startup_STARTUP_internal_init;
+  ((__parsec_chore_t*)&tc->incarnations[0])->hook = (parsec_hook_t *)__jdf2c_startup_STARTUP;
+  /* Compute the number of arenas_datatypes: */
+  /*   PARSEC_startup_DEFAULT_ARENA  ->  0 */
+  __parsec_tp->super.arenas_datatypes_size = 1;
+  memset(&__parsec_tp->super.arenas_datatypes[0], 0, __parsec_tp->super.arenas_datatypes_size*sizeof(parsec_arena_datatype_t));
+  /* If profiling is enabled, the keys for profiling */
+#  if defined(PARSEC_PROF_TRACE)
+  __parsec_tp->super.super.profiling_array = startup_profiling_array;
+  if( -2 == startup_profiling_array[0] ) {
+    #if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+parsec_profiling_add_dictionary_keyword("startup::STARTUP::internal init", "fill:34D8D8",
+                                       0,
+                                       NULL,
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(startup_STARTUP.task_class_id  + PARSEC_startup_NB_TASK_CLASSES)/* STARTUP (internal init) start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(startup_STARTUP.task_class_id  + PARSEC_startup_NB_TASK_CLASSES)/* STARTUP (internal init) end key */]);
+#endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+parsec_profiling_add_dictionary_keyword("startup::STARTUP", "fill:CC2828",
+                                       sizeof(parsec_task_prof_info_t)+6*sizeof(parsec_assignment_t),
+                                       "dc_key{uint64_t};priority{int32_t};dc_dataid{uint32_t};tcid{uint32_t};trc{int32_t};i{int32_t};j{int32_t};k{int32_t};valid1{int32_t};valid2{int32_t};prio{int32_t}",
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(startup_STARTUP.task_class_id) /* STARTUP start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(startup_STARTUP.task_class_id) /* STARTUP end key */]);
+
+  }
+#  endif /* defined(PARSEC_PROF_TRACE) */
+  __parsec_tp->super.super.repo_array = __parsec_tp->repositories;
+  __parsec_tp->super.super.startup_hook = (parsec_startup_fn_t)startup_startup;
+  (void)parsec_taskpool_reserve_id((parsec_taskpool_t*)__parsec_tp);
+}
+
+  /** Generate class declaration and instance using the above constructor and destructor */
+  PARSEC_OBJ_CLASS_DECLARATION(__parsec_startup_internal_taskpool_t);
+  PARSEC_OBJ_CLASS_INSTANCE(__parsec_startup_internal_taskpool_t, parsec_startup_taskpool_t,
+                            __parsec_startup_internal_constructor, __parsec_startup_internal_destructor);
+
+#undef descA
+#undef NI
+#undef NJ
+#undef NK
+#undef pri
+
+parsec_startup_taskpool_t *parsec_startup_new(parsec_matrix_block_cyclic_t* descA /* data descA */, int NI, int NJ, int NK)
+{
+  __parsec_startup_internal_taskpool_t *__parsec_tp = PARSEC_OBJ_NEW(__parsec_startup_internal_taskpool_t);
+  /* Dump the hidden parameters with default values */
+  int pri;
+  /* Now the Parameter-dependent structures: */
+  __parsec_tp->super._g_descA = descA;
+  __parsec_tp->super._g_NI = NI;
+  __parsec_tp->super._g_NJ = NJ;
+  __parsec_tp->super._g_NK = NK;
+  __parsec_tp->super._g_pri = pri = 0;
+  PARSEC_AYU_REGISTER_TASK(&startup_STARTUP);
+  __parsec_tp->super.super.startup_hook = (parsec_startup_fn_t)startup_startup;
+  (void)parsec_taskpool_reserve_id((parsec_taskpool_t*)__parsec_tp);
+/* Prevent warnings related to not used hidden global variables */
+  (void)pri;
+  return (parsec_startup_taskpool_t*)__parsec_tp;
+}
+
+
+#define NN    10
+#define TYPE  PARSEC_MATRIX_FLOAT
+
+struct my_priority_s {
+    int prio;
+    char* message;
+} priorities[] = {
+    { .prio = -1, .message = "Decreasing priority" },
+    { .prio =  0, .message = "No priority" },
+    { .prio =  1, .message = "Increasing priority" },
+    { .prio =  2, .message = "Random priority" },
+    { .prio =  0, .message = NULL}};
+
+#define TIMER_START(TIMER)                      \
+    do {                                        \
+        struct timeval tv;                      \
+        gettimeofday(&tv,NULL);                 \
+        (TIMER) = tv.tv_sec * 1e6 + tv.tv_usec; \
+    } while (0)
+
+#define TIMER_STOP(TIMER)                                   \
+    do {                                                    \
+        struct timeval tv;                                  \
+        gettimeofday(&tv,NULL);                             \
+        (TIMER) = (tv.tv_sec * 1e6 + tv.tv_usec) - (TIMER); \
+    } while (0)
+
+int main( int argc, char** argv )
+{
+    parsec_startup_taskpool_t* tp;
+    parsec_matrix_block_cyclic_t descA;
+    parsec_arena_datatype_t adt;
+    parsec_datatype_t dt;
+    parsec_context_t *parsec;
+    int ni = NN, nj = NN, nk = NN, verbose = 0, i = 1, rc;
+    long time_elapsed;
+
+#ifdef PARSEC_HAVE_MPI
+    {
+        int provided;
+        MPI_Init_thread(NULL, NULL, MPI_THREAD_SERIALIZED, &provided);
+    }
+#endif
+
+    int pargc = 0; char **pargv = NULL;
+    for( i = 1; i < argc; i++) {
+        if( 0 == strncmp(argv[i], "--", 3) ) {
+            pargc = argc - i;
+            pargv = argv + i;
+            break;
+        }
+        if( 0 == strncmp(argv[i], "-i=", 3) ) {
+            ni = strtol(argv[i]+3, NULL, 10);
+            continue;
+        }
+        if( 0 == strncmp(argv[i], "-j=", 3) ) {
+            nj = strtol(argv[i]+3, NULL, 10);
+            continue;
+        }
+        if( 0 == strncmp(argv[i], "-k=", 3) ) {
+            nk = strtol(argv[i]+3, NULL, 10);
+            continue;
+        }
+        if( 0 == strncmp(argv[i], "-v=", 3) ) {
+            verbose = strtol(argv[i]+3, NULL, 10);
+            continue;
+        }
+    }
+
+    parsec = parsec_init(-1, &pargc, &pargv);
+    if( NULL == parsec ) {
+       exit(-1);
+    }
+
+    /**
+     * Build the data and the arena to hold it up.
+     */
+    parsec_matrix_block_cyclic_init( &descA, TYPE, PARSEC_MATRIX_TILE,
+                               0 /*rank*/,
+                               NN, NN, ni * NN, NN,
+                               0, 0, ni * NN, NN, 1, 1, 1, 1, 0, 0);
+    descA.mat = parsec_data_allocate( descA.super.nb_local_tiles *
+                                     descA.super.bsiz *
+                                     parsec_datadist_getsizeoftype(TYPE) );
+
+    parsec_translate_matrix_type(TYPE, &dt);
+    parsec_add2arena_rect(&adt, dt,
+                                 descA.super.mb, descA.super.nb, descA.super.mb);
+
+    srandom((int)getpid());  /* Start the random generator */
+
+    /* Start the PaRSEC engine */
+    rc = parsec_context_start(parsec);
+    PARSEC_CHECK_ERROR(rc, "parsec_context_start");
+
+    /* Heat up the engine: small tasks no priority */
+    tp = parsec_startup_new( &descA, ni, nj, nk );
+    assert( NULL != tp );
+    tp->arenas_datatypes[PARSEC_startup_DEFAULT_ADT_IDX] = adt;
+    PARSEC_OBJ_RETAIN(adt.arena);
+
+    tp->_g_pri = 0;
+    rc = parsec_context_add_taskpool( parsec, (parsec_taskpool_t*)tp );
+    PARSEC_CHECK_ERROR(rc, "parsec_context_add_taskpool");
+    rc = parsec_context_wait(parsec);
+    parsec_taskpool_free(&tp->super);
+    PARSEC_CHECK_ERROR(rc, "parsec_context_wait");
+
+    for(i = 0; NULL != priorities[i].message; i++) {
+
+        /* Start the PaRSEC engine */
+        rc = parsec_context_start(parsec);
+        PARSEC_CHECK_ERROR(rc, "parsec_context_start");
+
+        tp = parsec_startup_new( &descA, ni, nj, nk );
+        assert( NULL != tp );
+
+        TIMER_START(time_elapsed);
+        tp->arenas_datatypes[PARSEC_startup_DEFAULT_ADT_IDX] = adt;
+        PARSEC_OBJ_RETAIN(adt.arena);
+        tp->_g_pri = priorities[i].prio;
+
+        rc = parsec_context_add_taskpool( parsec, (parsec_taskpool_t*)tp );
+        PARSEC_CHECK_ERROR(rc, "parsec_context_add_taskpool");
+
+        TIMER_STOP(time_elapsed);
+        printf("DAG construction [%s] in %ld micro-sec\n",
+               priorities[i].message, time_elapsed);
+        if( verbose >= 5 ) {
+            printf("<DartMeasurement name=\"%s\" type=\"numeric/double\"\n"
+                   "                 encoding=\"none\" compression=\"none\">\n"
+                   "%g\n"
+                   "</DartMeasurement>\n",
+                   priorities[i].message, (double)time_elapsed);
+        }
+        TIMER_START(time_elapsed);
+        parsec_context_wait(parsec);
+        parsec_taskpool_free(&tp->super);
+        TIMER_STOP(time_elapsed);
+        printf("DAG execution [%s] in %ld micro-sec\n",
+               priorities[i].message, time_elapsed);
+    }
+
+    free(descA.mat);
+    PARSEC_OBJ_RELEASE(adt.arena);
+    parsec_del2arena( & adt );
+
+    parsec_fini( &parsec);
+
+#ifdef PARSEC_HAVE_MPI
+    MPI_Finalize();
+#endif
+
+    return 0;
+}
+
+PARSEC_OBJ_CLASS_INSTANCE(parsec_startup_taskpool_t, parsec_taskpool_t, NULL, NULL);
+
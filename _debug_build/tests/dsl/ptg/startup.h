@@ -0,0 +1,67 @@
+#ifndef _startup_h_
+#define _startup_h_
+#include "parsec.h"
+#include "parsec/parsec_internal.h"
+#include "parsec/remote_dep.h"
+
+BEGIN_C_DECLS
+
+#define PARSEC_startup_DEFAULT_ADT_IDX    0
+#define PARSEC_startup_ADT_IDX_MAX       1
+typedef struct parsec_startup_taskpool_s {
+  parsec_taskpool_t super;
+  /* The list of globals */
+  parsec_matrix_block_cyclic_t* _g_descA /* data descA */;
+  int _g_NI;
+  int _g_NJ;
+  int _g_NK;
+  int _g_pri;
+  /* The array of datatypes (DEFAULT and co.) */
+  parsec_arena_datatype_t arenas_datatypes[PARSEC_startup_ADT_IDX_MAX];
+  uint32_t arenas_datatypes_size;
+} parsec_startup_taskpool_t;
+
+/** Beware that this object is not a superset of the internal object, and as a result
+ *  we should never create one directly. Instead we should rely on the creation of the
+ *  internal object (__parsec_startup_taskpool_t).
+ */
+PARSEC_OBJ_CLASS_DECLARATION(parsec_startup_taskpool_t);
+extern parsec_startup_taskpool_t *parsec_startup_new(parsec_matrix_block_cyclic_t* _g_descA /* data descA */, int _g_NI, int _g_NJ, int _g_NK);
+
+#if MAX_LOCAL_COUNT < 6  /* number of parameters and locals STARTUP */
+  #error Too many parameters and local variables (6 out of MAX_LOCAL_COUNT) for task STARTUP
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_startup_STARTUP_assignment_s {
+  parsec_assignment_t i;
+  parsec_assignment_t j;
+  parsec_assignment_t k;
+  parsec_assignment_t valid1;
+  parsec_assignment_t valid2;
+  parsec_assignment_t prio;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-6];
+} __parsec_startup_STARTUP_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 1  /* total number of flows for task STARTUP */
+  #error Too many flows (1 out of MAX_PARAM_COUNT) for task STARTUP
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_startup_STARTUP_data_s {
+  parsec_data_pair_t _f_A;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-1];
+} __parsec_startup_STARTUP_data_t;
+
+typedef struct __parsec_startup_STARTUP_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_startup_STARTUP_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_startup_STARTUP_data_s data;
+} __parsec_startup_STARTUP_task_t;
+
+
+END_C_DECLS
+
+#endif /* _startup_h_ */ 
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ptgpp_udf.udf"
+  "udf.c"
+  "udf.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ptgpp_udf.udf.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ptgpp_utt.utt"
+  "utt.c"
+  "utt.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ptgpp_utt.utt.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
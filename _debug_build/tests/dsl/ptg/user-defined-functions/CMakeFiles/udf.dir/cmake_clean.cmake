@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/udf.dir/main.c.o"
+  "CMakeFiles/udf.dir/main.c.o.d"
+  "CMakeFiles/udf.dir/udf.c.o"
+  "CMakeFiles/udf.dir/udf.c.o.d"
+  "CMakeFiles/udf.dir/udf_wrapper.c.o"
+  "CMakeFiles/udf.dir/udf_wrapper.c.o.d"
+  "udf"
+  "udf.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/udf.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/utt.dir/utt.c.o"
+  "CMakeFiles/utt.dir/utt.c.o.d"
+  "utt"
+  "utt.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/utt.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
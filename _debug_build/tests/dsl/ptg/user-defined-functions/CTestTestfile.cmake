@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/dsl/ptg/user-defined-functions
+# Build directory: /root/repo/_debug_build/tests/dsl/ptg/user-defined-functions
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
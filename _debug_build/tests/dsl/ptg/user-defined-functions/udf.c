@@ -0,0 +1,3875 @@
+#include "parsec.h"
+#include "parsec/parsec_internal.h"
+#include "parsec/ayudame.h"
+#include "parsec/execution_stream.h"
+#include "parsec/parsec_binary_profile.h"
+#include "parsec/mca/device/device_gpu.h"
+#if defined(PARSEC_HAVE_DEV_CUDA_SUPPORT)
+#include "parsec/mca/device/cuda/device_cuda.h"
+#endif  /* defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) */
+#if defined(PARSEC_HAVE_DEV_HIP_SUPPORT)
+#include "parsec/mca/device/hip/device_hip.h"
+#endif  /* defined(PARSEC_HAVE_DEV_HIP_SUPPORT) */
+#if defined(_MSC_VER) || defined(__MINGW32__)
+#  include <malloc.h>
+#else
+#  include <alloca.h>
+#endif  /* defined(_MSC_VER) || defined(__MINGW32__) */
+
+#define PARSEC_udf_NB_TASK_CLASSES 5
+#define PARSEC_udf_NB_DATA 1
+
+typedef struct __parsec_udf_internal_taskpool_s __parsec_udf_internal_taskpool_t;
+struct parsec_udf_internal_taskpool_s;
+
+/** Predeclarations of the parsec_task_class_t */
+static const parsec_task_class_t udf_UD_STARTUP2;
+static const parsec_task_class_t udf_UD_HASH_STRUCT;
+static const parsec_task_class_t udf_UD_STARTUP1;
+static const parsec_task_class_t udf_UD_MAKE_KEY;
+static const parsec_task_class_t udf_NOUD;
+/** Predeclarations of the parameters */
+static const parsec_flow_t flow_of_udf_UD_STARTUP2_for_X;
+static const parsec_flow_t flow_of_udf_UD_HASH_STRUCT_for_X;
+static const parsec_flow_t flow_of_udf_UD_STARTUP1_for_X;
+static const parsec_flow_t flow_of_udf_UD_MAKE_KEY_for_X;
+static const parsec_flow_t flow_of_udf_NOUD_for_X;
+/*
+ * Copyright (c) 2019-2023 The University of Tennessee and The University
+ *                         of Tennessee Research Foundation.  All rights
+ *                         reserved.
+ */
+
+#include "parsec/data_dist/matrix/two_dim_rectangle_cyclic.h"
+#include "udf_wrapper.h"
+
+static int ud_nbtasks_nb_local_tasks(struct __parsec_udf_internal_taskpool_s *tp);
+static parsec_key_t ud_make_key(const parsec_taskpool_t *tp, const parsec_assignment_t *locals);
+static int ud_startup1(parsec_execution_stream_t * es,
+                       struct __parsec_udf_UD_STARTUP1_task_s * this_task);
+static int ud_startup2(parsec_execution_stream_t * es,
+                       struct __parsec_udf_UD_STARTUP2_task_s * this_task);
+		       
+static char *ud_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data);
+static parsec_key_fn_t ud_hash_struct = {
+    .key_equal = parsec_hash_table_generic_64bits_key_equal,
+    .key_print = ud_key_print,
+    .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+static inline parsec_hook_return_t
+always_here(const parsec_task_t* task)
+{
+    (void)task;
+    return PARSEC_HOOK_RETURN_DONE;
+}
+
+static inline parsec_hook_return_t
+never_here(const parsec_task_t* task)
+{
+    (void)task;
+    return PARSEC_HOOK_RETURN_NEXT;
+}
+
+#define PARSEC_udf_DEFAULT_ADT    (&__parsec_tp->super.arenas_datatypes[PARSEC_udf_DEFAULT_ADT_IDX])
+#include "udf.h"
+
+struct __parsec_udf_internal_taskpool_s {
+ parsec_udf_taskpool_t super;
+ volatile int32_t sync_point;
+ volatile int32_t initial_number_tasks;
+ parsec_task_t* startup_queue;
+  /* The ranges to compute the hash key */
+  /* nothing for UD_STARTUP2 as it gets a user-defined make_key */
+  int UD_HASH_STRUCT_m_min;
+  int UD_HASH_STRUCT_m_range;
+  int UD_HASH_STRUCT_n_min;
+  int UD_HASH_STRUCT_n_range;
+  int UD_STARTUP1_m_min;
+  int UD_STARTUP1_m_range;
+  int UD_STARTUP1_n_min;
+  int UD_STARTUP1_n_range;
+  /* nothing for UD_MAKE_KEY as it gets a user-defined make_key */
+  int NOUD_m_min;
+  int NOUD_m_range;
+  int NOUD_n_min;
+  int NOUD_n_range;
+  /* The list of data repositories */
+  data_repo_t* repositories[5];
+};
+
+#if defined(PARSEC_PROF_TRACE)
+#  if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+static int udf_profiling_array[4*PARSEC_udf_NB_TASK_CLASSES] = {-2}; /* 2 pairs (begin, end) per task, times two because each task class has an internal_init task */
+#  else /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+static int udf_profiling_array[2*PARSEC_udf_NB_TASK_CLASSES] = {-2}; /* 2 pairs (begin, end) per task */
+#  endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+#endif  /* defined(PARSEC_PROF_TRACE) */
+/* Globals */
+#define A __parsec_tp->super._g_A
+#define logger (__parsec_tp->super._g_logger)
+
+static inline int parsec_imin(int a, int b) { return (a <= b) ? a : b; };
+
+static inline int parsec_imax(int a, int b) { return (a >= b) ? a : b; };
+
+static inline int32_t udf_UD_STARTUP2_inline_c_expr1_line_123(const __parsec_udf_internal_taskpool_t *__parsec_tp, const __parsec_udf_UD_STARTUP2_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task UD_STARTUP2 */
+  const int m = assignments->m.value; (void)m;
+  const int n = assignments->n.value; (void)n;
+
+  (void)m;  (void)n;
+
+ return logger(1, UDF_TT_NBLOCAL_MAKEKEY_STARTUP); 
+}
+
+static inline int32_t udf_UD_STARTUP2_inline_c_expr2_line_122(const __parsec_udf_internal_taskpool_t *__parsec_tp, const __parsec_udf_UD_STARTUP2_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task UD_STARTUP2 */
+  const int m = assignments->m.value; (void)m;
+  const int n = assignments->n.value; (void)n;
+
+  (void)m;  (void)n;
+
+ return logger(1, UDF_TT_NBLOCAL_MAKEKEY_STARTUP); 
+}
+
+static inline int32_t udf_UD_HASH_STRUCT_inline_c_expr3_line_90(const __parsec_udf_internal_taskpool_t *__parsec_tp, const __parsec_udf_UD_HASH_STRUCT_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task UD_HASH_STRUCT */
+  const int m = assignments->m.value; (void)m;
+  const int n = assignments->n.value; (void)n;
+
+  (void)m;  (void)n;
+
+ return logger(1, UDF_TT_NBLOCAL_HASHSTRUCT); 
+}
+
+static inline int32_t udf_UD_HASH_STRUCT_inline_c_expr4_line_89(const __parsec_udf_internal_taskpool_t *__parsec_tp, const __parsec_udf_UD_HASH_STRUCT_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task UD_HASH_STRUCT */
+  const int m = assignments->m.value; (void)m;
+  const int n = assignments->n.value; (void)n;
+
+  (void)m;  (void)n;
+
+ return logger(1, UDF_TT_NBLOCAL_HASHSTRUCT); 
+}
+
+static inline parsec_hook_return_t udf_UD_STARTUP1_inline_c_expr5_line_82(const __parsec_udf_UD_STARTUP1_task_t *this_task)
+{
+  const __parsec_udf_UD_STARTUP1_parsec_assignment_t *assignments = &this_task->locals;
+  /* This inline C function was declared in the context of the task UD_STARTUP1 */
+  const int m = assignments->m.value; (void)m;
+  const int n = assignments->n.value; (void)n;
+
+  (void)m;  (void)n;
+
+ return PARSEC_HOOK_RETURN_DONE; 
+}
+
+static inline int32_t udf_UD_STARTUP1_inline_c_expr6_line_76(const __parsec_udf_internal_taskpool_t *__parsec_tp, const __parsec_udf_UD_STARTUP1_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task UD_STARTUP1 */
+  const int m = assignments->m.value; (void)m;
+  const int n = assignments->n.value; (void)n;
+
+  (void)m;  (void)n;
+
+ return logger(1, UDF_TT_NBLOCAL_STARTUP); 
+}
+
+static inline int32_t udf_UD_STARTUP1_inline_c_expr7_line_75(const __parsec_udf_internal_taskpool_t *__parsec_tp, const __parsec_udf_UD_STARTUP1_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task UD_STARTUP1 */
+  const int m = assignments->m.value; (void)m;
+  const int n = assignments->n.value; (void)n;
+
+  (void)m;  (void)n;
+
+ return logger(1, UDF_TT_NBLOCAL_STARTUP); 
+}
+
+static inline int32_t udf_UD_MAKE_KEY_inline_c_expr8_line_62(const __parsec_udf_internal_taskpool_t *__parsec_tp, const __parsec_udf_UD_MAKE_KEY_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task UD_MAKE_KEY */
+  const int m = assignments->m.value; (void)m;
+  const int n = assignments->n.value; (void)n;
+
+  (void)m;  (void)n;
+
+ return logger(1, UDF_TT_NBLOCAL_MAKEKEY); 
+}
+
+static inline int32_t udf_UD_MAKE_KEY_inline_c_expr9_line_61(const __parsec_udf_internal_taskpool_t *__parsec_tp, const __parsec_udf_UD_MAKE_KEY_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task UD_MAKE_KEY */
+  const int m = assignments->m.value; (void)m;
+  const int n = assignments->n.value; (void)n;
+
+  (void)m;  (void)n;
+
+ return logger(1, UDF_TT_NBLOCAL_MAKEKEY); 
+}
+
+static inline int32_t udf_NOUD_inline_c_expr10_line_48(const __parsec_udf_internal_taskpool_t *__parsec_tp, const __parsec_udf_NOUD_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task NOUD */
+  const int m = assignments->m.value; (void)m;
+  const int n = assignments->n.value; (void)n;
+
+  (void)m;  (void)n;
+
+ return logger(1, UDF_TT_NBLOCAL); 
+}
+
+static inline int32_t udf_NOUD_inline_c_expr11_line_47(const __parsec_udf_internal_taskpool_t *__parsec_tp, const __parsec_udf_NOUD_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task NOUD */
+  const int m = assignments->m.value; (void)m;
+  const int n = assignments->n.value; (void)n;
+
+  (void)m;  (void)n;
+
+ return logger(1, UDF_TT_NBLOCAL); 
+}
+
+/* Data Access Macros */
+#define data_of_A(A_d0, A_d1)  (((parsec_data_collection_t*)__parsec_tp->super._g_A)->data_of((parsec_data_collection_t*)__parsec_tp->super._g_A, (A_d0), (A_d1)))
+
+#define rank_of_A(A_d0, A_d1)  (((parsec_data_collection_t*)__parsec_tp->super._g_A)->rank_of((parsec_data_collection_t*)__parsec_tp->super._g_A, (A_d0), (A_d1)))
+
+/* Functions Predicates */
+#define UD_STARTUP2_pred(m, n) (((parsec_data_collection_t*)(__parsec_tp->super._g_A))->myrank == rank_of_A(m, n))
+#define UD_HASH_STRUCT_pred(m, n) (((parsec_data_collection_t*)(__parsec_tp->super._g_A))->myrank == rank_of_A(m, n))
+#define UD_STARTUP1_pred(m, n) (((parsec_data_collection_t*)(__parsec_tp->super._g_A))->myrank == rank_of_A(m, n))
+#define UD_MAKE_KEY_pred(m, n) (((parsec_data_collection_t*)(__parsec_tp->super._g_A))->myrank == rank_of_A(m, n))
+#define NOUD_pred(m, n) (((parsec_data_collection_t*)(__parsec_tp->super._g_A))->myrank == rank_of_A(m, n))
+
+/* Data Repositories */
+#define UD_STARTUP2_repo (__parsec_tp->repositories[4])
+#define UD_HASH_STRUCT_repo (__parsec_tp->repositories[3])
+#define UD_STARTUP1_repo (__parsec_tp->repositories[2])
+#define UD_MAKE_KEY_repo (__parsec_tp->repositories[1])
+#define NOUD_repo (__parsec_tp->repositories[0])
+/* Release dependencies output macro */
+#if defined(PARSEC_DEBUG_NOISIER)
+#define RELEASE_DEP_OUTPUT(ES, DEPO, TASKO, DEPI, TASKI, RSRC, RDST, DATA)\
+  do { \
+    char tmp1[128], tmp2[128]; (void)tmp1; (void)tmp2;\
+    PARSEC_DEBUG_VERBOSE(20, parsec_debug_output, "thread %d VP %d explore deps from %s:%s to %s:%s (from rank %d to %d) base ptr %p",\
+           (NULL != (ES) ? (ES)->th_id : -1), (NULL != (ES) ? (ES)->virtual_process->vp_id : -1),\
+           DEPO, parsec_task_snprintf(tmp1, 128, (parsec_task_t*)(TASKO)),\
+           DEPI, parsec_task_snprintf(tmp2, 128, (parsec_task_t*)(TASKI)), (RSRC), (RDST), (DATA));\
+  } while(0)
+#define ACQUIRE_FLOW(TASKI, DEPI, FUNO, DEPO, LOCALS, PTR)\
+  do { \
+    char tmp1[128], tmp2[128]; (void)tmp1; (void)tmp2;\
+    PARSEC_DEBUG_VERBOSE(20, parsec_debug_output, "task %s acquires flow %s from %s %s data ptr %p",\
+           parsec_task_snprintf(tmp1, 128, (parsec_task_t*)(TASKI)), (DEPI),\
+           (DEPO), parsec_snprintf_assignments(tmp2, 128, (FUNO), (parsec_assignment_t*)(LOCALS)), (PTR));\
+  } while(0)
+#else
+#define RELEASE_DEP_OUTPUT(ES, DEPO, TASKO, DEPI, TASKI, RSRC, RDST, DATA)
+#define ACQUIRE_FLOW(TASKI, DEPI, TASKO, DEPO, LOCALS, PTR)
+#endif
+static char *__jdf2c_key_fns_UD_STARTUP2_key_print(char *buffer, size_t buffer_size, parsec_key_t k, void *user_data)
+{
+  (void)user_data;
+  snprintf(buffer, buffer_size, "(%llu)", (unsigned long long int)k);
+  return buffer;
+}
+
+static parsec_key_fn_t __jdf2c_key_fns_UD_STARTUP2 = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = __jdf2c_key_fns_UD_STARTUP2_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+static inline parsec_key_t __jdf2c_make_key_UD_HASH_STRUCT(const parsec_taskpool_t *tp, const parsec_assignment_t *as)
+{
+  const __parsec_udf_internal_taskpool_t *__parsec_tp = (const __parsec_udf_internal_taskpool_t *)tp;
+  const __parsec_udf_UD_HASH_STRUCT_parsec_assignment_t *assignment = (const __parsec_udf_UD_HASH_STRUCT_parsec_assignment_t*)as;
+  uint64_t __parsec_id = 0;
+  __parsec_id += (assignment->m.value - __parsec_tp->UD_HASH_STRUCT_m_min);
+  __parsec_id += (assignment->n.value - __parsec_tp->UD_HASH_STRUCT_n_min) * __parsec_tp->UD_HASH_STRUCT_m_range;
+  return (parsec_key_t)__parsec_id;
+}
+static inline parsec_key_t __jdf2c_make_key_UD_STARTUP1(const parsec_taskpool_t *tp, const parsec_assignment_t *as)
+{
+  const __parsec_udf_internal_taskpool_t *__parsec_tp = (const __parsec_udf_internal_taskpool_t *)tp;
+  const __parsec_udf_UD_STARTUP1_parsec_assignment_t *assignment = (const __parsec_udf_UD_STARTUP1_parsec_assignment_t*)as;
+  uint64_t __parsec_id = 0;
+  __parsec_id += (assignment->m.value - __parsec_tp->UD_STARTUP1_m_min);
+  __parsec_id += (assignment->n.value - __parsec_tp->UD_STARTUP1_n_min) * __parsec_tp->UD_STARTUP1_m_range;
+  return (parsec_key_t)__parsec_id;
+}
+static char *__jdf2c_key_fns_UD_STARTUP1_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_udf_internal_taskpool_t *__parsec_tp = (__parsec_udf_internal_taskpool_t *)user_data;
+  int m = (__parsec_key) % __parsec_tp->UD_STARTUP1_m_range + __parsec_tp->UD_STARTUP1_m_min;
+  __parsec_key = __parsec_key / __parsec_tp->UD_STARTUP1_m_range;
+  int n = (__parsec_key) % __parsec_tp->UD_STARTUP1_n_range + __parsec_tp->UD_STARTUP1_n_min;
+  __parsec_key = __parsec_key / __parsec_tp->UD_STARTUP1_n_range;
+  snprintf(buffer, buffer_size, "UD_STARTUP1(%d, %d)", m, n);
+  return buffer;
+}
+
+static parsec_key_fn_t __jdf2c_key_fns_UD_STARTUP1 = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = __jdf2c_key_fns_UD_STARTUP1_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+static char *__jdf2c_key_fns_UD_MAKE_KEY_key_print(char *buffer, size_t buffer_size, parsec_key_t k, void *user_data)
+{
+  (void)user_data;
+  snprintf(buffer, buffer_size, "(%llu)", (unsigned long long int)k);
+  return buffer;
+}
+
+static parsec_key_fn_t __jdf2c_key_fns_UD_MAKE_KEY = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = __jdf2c_key_fns_UD_MAKE_KEY_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+static inline parsec_key_t __jdf2c_make_key_NOUD(const parsec_taskpool_t *tp, const parsec_assignment_t *as)
+{
+  const __parsec_udf_internal_taskpool_t *__parsec_tp = (const __parsec_udf_internal_taskpool_t *)tp;
+  const __parsec_udf_NOUD_parsec_assignment_t *assignment = (const __parsec_udf_NOUD_parsec_assignment_t*)as;
+  uint64_t __parsec_id = 0;
+  __parsec_id += (assignment->m.value - __parsec_tp->NOUD_m_min);
+  __parsec_id += (assignment->n.value - __parsec_tp->NOUD_n_min) * __parsec_tp->NOUD_m_range;
+  return (parsec_key_t)__parsec_id;
+}
+static char *__jdf2c_key_fns_NOUD_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_udf_internal_taskpool_t *__parsec_tp = (__parsec_udf_internal_taskpool_t *)user_data;
+  int m = (__parsec_key) % __parsec_tp->NOUD_m_range + __parsec_tp->NOUD_m_min;
+  __parsec_key = __parsec_key / __parsec_tp->NOUD_m_range;
+  int n = (__parsec_key) % __parsec_tp->NOUD_n_range + __parsec_tp->NOUD_n_min;
+  __parsec_key = __parsec_key / __parsec_tp->NOUD_n_range;
+  snprintf(buffer, buffer_size, "NOUD(%d, %d)", m, n);
+  return buffer;
+}
+
+static parsec_key_fn_t __jdf2c_key_fns_NOUD = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = __jdf2c_key_fns_NOUD_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/******                                  UD_STARTUP2                                  ******/
+
+static inline int32_t minexpr_of_symb_udf_UD_STARTUP2_m_fct(const __parsec_udf_internal_taskpool_t *__parsec_tp, const __parsec_udf_UD_STARTUP2_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_udf_UD_STARTUP2_m = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_udf_UD_STARTUP2_m_fct }
+                   }
+};
+static inline int maxexpr_of_symb_udf_UD_STARTUP2_m_fct(const __parsec_udf_internal_taskpool_t *__parsec_tp, const __parsec_udf_UD_STARTUP2_parsec_assignment_t *locals)
+{
+  const int m = locals->m.value; (void)m;
+  const int n = locals->n.value; (void)n;
+
+  (void)m;
+  (void)n;
+  (void)__parsec_tp; (void)locals;
+  return (A->super.mt - 1);
+}
+static const parsec_expr_t maxexpr_of_symb_udf_UD_STARTUP2_m = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_udf_UD_STARTUP2_m_fct }
+                   }
+};
+static inline int32_t incexpr_of_symb_udf_UD_STARTUP2_m_fct(const __parsec_udf_internal_taskpool_t *__parsec_tp, const __parsec_udf_UD_STARTUP2_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return udf_UD_STARTUP2_inline_c_expr2_line_122(__parsec_tp, locals);
+}
+static const parsec_expr_t incexpr_of_symb_udf_UD_STARTUP2_m = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)incexpr_of_symb_udf_UD_STARTUP2_m_fct }
+                   }
+};
+static const parsec_symbol_t symb_udf_UD_STARTUP2_m = { .name = "m", .context_index = 0, .min = &minexpr_of_symb_udf_UD_STARTUP2_m, .max = &maxexpr_of_symb_udf_UD_STARTUP2_m, .cst_inc = 0, .expr_inc = &incexpr_of_symb_udf_UD_STARTUP2_m,  .flags = 0x0};
+
+static inline int32_t minexpr_of_symb_udf_UD_STARTUP2_n_fct(const __parsec_udf_internal_taskpool_t *__parsec_tp, const __parsec_udf_UD_STARTUP2_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_udf_UD_STARTUP2_n = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_udf_UD_STARTUP2_n_fct }
+                   }
+};
+static inline int maxexpr_of_symb_udf_UD_STARTUP2_n_fct(const __parsec_udf_internal_taskpool_t *__parsec_tp, const __parsec_udf_UD_STARTUP2_parsec_assignment_t *locals)
+{
+  const int m = locals->m.value; (void)m;
+  const int n = locals->n.value; (void)n;
+
+  (void)m;
+  (void)n;
+  (void)__parsec_tp; (void)locals;
+  return (A->super.nt - 1);
+}
+static const parsec_expr_t maxexpr_of_symb_udf_UD_STARTUP2_n = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_udf_UD_STARTUP2_n_fct }
+                   }
+};
+static inline int32_t incexpr_of_symb_udf_UD_STARTUP2_n_fct(const __parsec_udf_internal_taskpool_t *__parsec_tp, const __parsec_udf_UD_STARTUP2_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return udf_UD_STARTUP2_inline_c_expr1_line_123(__parsec_tp, locals);
+}
+static const parsec_expr_t incexpr_of_symb_udf_UD_STARTUP2_n = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)incexpr_of_symb_udf_UD_STARTUP2_n_fct }
+                   }
+};
+static const parsec_symbol_t symb_udf_UD_STARTUP2_n = { .name = "n", .context_index = 1, .min = &minexpr_of_symb_udf_UD_STARTUP2_n, .max = &maxexpr_of_symb_udf_UD_STARTUP2_n, .cst_inc = 0, .expr_inc = &incexpr_of_symb_udf_UD_STARTUP2_n,  .flags = 0x0};
+
+static inline int affinity_of_udf_UD_STARTUP2(const __parsec_udf_UD_STARTUP2_task_t *this_task,
+                     parsec_data_ref_t *ref)
+{
+    const __parsec_udf_internal_taskpool_t *__parsec_tp = (const __parsec_udf_internal_taskpool_t*)this_task->taskpool;
+  const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+
+  /* Silent Warnings: should look into predicate to know what variables are usefull */
+  (void)m;
+  (void)n;
+  ref->dc = (parsec_data_collection_t *)__parsec_tp->super._g_A;
+  /* Compute data key */
+  ref->key = ref->dc->data_key(ref->dc, m, n);
+  return 1;
+}
+static const parsec_property_t properties_of_udf_UD_STARTUP2[1] = {
+  {.name = NULL, .expr = NULL}
+};
+static parsec_data_t *flow_of_udf_UD_STARTUP2_for_X_dep1_atline_127_direct_access(const __parsec_udf_internal_taskpool_t *__parsec_tp, const __parsec_udf_UD_STARTUP2_parsec_assignment_t *assignments)
+{
+  const int m = assignments->m.value; (void)m;
+  const int n = assignments->n.value; (void)n;
+
+  /* Silence Warnings: should look into parameters to know what variables are useful */
+  (void)m;
+  (void)n;
+  if( __parsec_tp->super.super.context->my_rank == (int32_t)rank_of_A(m, n) )
+    return data_of_A(m, n);
+  return NULL;
+}
+
+static const parsec_dep_t flow_of_udf_UD_STARTUP2_for_X_dep1_atline_127 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = PARSEC_LOCAL_DATA_TASK_CLASS_ID, /* udf_A */
+  .direct_data = (parsec_data_lookup_func_t)&flow_of_udf_UD_STARTUP2_for_X_dep1_atline_127_direct_access,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_udf_UD_STARTUP2_for_X,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_udf_UD_STARTUP2_for_X = {
+  .name               = "X",
+  .sym_type           = PARSEC_SYM_IN,
+  .flow_flags         = PARSEC_FLOW_ACCESS_READ|PARSEC_FLOW_HAS_IN_DEPS,
+  .flow_index         = 0,
+  .flow_datatype_mask = 0x0,
+  .dep_in     = { &flow_of_udf_UD_STARTUP2_for_X_dep1_atline_127 },
+  .dep_out    = { NULL }
+};
+
+static int release_deps_of_udf_UD_STARTUP2(parsec_execution_stream_t *es, __parsec_udf_UD_STARTUP2_task_t *this_task, uint32_t action_mask, parsec_remote_deps_t *deps)
+{
+  PARSEC_PINS(es, RELEASE_DEPS_BEGIN, (parsec_task_t *)this_task);  const __parsec_udf_internal_taskpool_t *__parsec_tp = (const __parsec_udf_internal_taskpool_t *)this_task->taskpool;
+  parsec_release_dep_fct_arg_t arg;
+  int __vp_id;
+  int consume_local_repo = 0;
+  arg.action_mask = action_mask;
+  arg.output_entry = NULL;
+  arg.output_repo = NULL;
+#if defined(DISTRIBUTED)
+  arg.remote_deps = deps;
+#endif  /* defined(DISTRIBUTED) */
+  assert(NULL != es);
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS )    arg.ready_lists = alloca(sizeof(parsec_task_t *) * es->virtual_process->parsec_context->nb_vp);
+  else
+    arg.ready_lists = NULL;
+  for( __vp_id = 0; __vp_id < es->virtual_process->parsec_context->nb_vp; arg.ready_lists[__vp_id++] = NULL );
+  (void)__parsec_tp; (void)deps;
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_X.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_X.source_repo, this_task->data._f_X.source_repo_entry->ht_item.key );
+    }
+  }
+  consume_local_repo = (this_task->repo_entry != NULL);
+  /* No successors, don't call iterate_successors and don't release any local deps */
+      if (consume_local_repo) {
+         data_repo_entry_used_once( UD_STARTUP2_repo, this_task->repo_entry->ht_item.key );
+      }
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_X.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_X.data_in);
+    }
+  }
+  PARSEC_PINS(es, RELEASE_DEPS_END, (parsec_task_t *)this_task);  return 0;
+}
+
+static int data_lookup_of_udf_UD_STARTUP2(parsec_execution_stream_t *es, __parsec_udf_UD_STARTUP2_task_t *this_task)
+{
+  const __parsec_udf_internal_taskpool_t *__parsec_tp = (__parsec_udf_internal_taskpool_t *)this_task->taskpool;
+  parsec_assignment_t generic_locals[MAX_PARAM_COUNT];  /* generic task locals */
+  int target_device = 0; (void)target_device;
+  (void)__parsec_tp; (void)generic_locals; (void)es;
+  parsec_data_copy_t *chunk = NULL;
+  data_repo_t        *reshape_repo  = NULL, *consumed_repo  = NULL;
+  data_repo_entry_t  *reshape_entry = NULL, *consumed_entry = NULL;
+  parsec_key_t        reshape_entry_key = 0, consumed_entry_key = 0;
+  uint8_t             consumed_flow_index;
+  parsec_dep_data_description_t data;
+  int ret;
+  (void)reshape_repo; (void)reshape_entry; (void)reshape_entry_key;
+  (void)consumed_repo; (void)consumed_entry; (void)consumed_entry_key;
+  (void)consumed_flow_index;
+  (void)chunk; (void)data; (void)ret;
+  const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+  if( NULL == this_task->repo_entry ){
+    this_task->repo_entry = data_repo_lookup_entry_and_create(es, UD_STARTUP2_repo,                                       ud_make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    data_repo_entry_addto_usage_limit(UD_STARTUP2_repo, this_task->repo_entry->ht_item.key, 1);    this_task->repo_entry ->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(this_task->repo_entry ->sim_exec_date == 0);
+    this_task->repo_entry ->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  /* The reshape repo is the current task repo. */  reshape_repo = UD_STARTUP2_repo;
+  reshape_entry_key = ud_make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals) ;
+  reshape_entry = this_task->repo_entry;
+  /* Lookup the input data, and store them in the context if any */
+
+if(! this_task->data._f_X.fulfill ){ /* Flow X */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_X.data_out = NULL;  /* input only */
+  /* Flow X [0] dependency [0] from memory A */
+  if( NULL == (chunk = this_task->data._f_X.data_in) ) {
+  /* No data set up by predecessor on this task input flow */
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+  parsec_prof_grapher_data_input(data_of_A(m, n), (parsec_task_t*)this_task, &flow_of_udf_UD_STARTUP2_for_X, 1);
+#endif
+    chunk = parsec_data_get_copy(data_of_A(m, n), target_device);
+    data.data = chunk;
+    data.data_future  = NULL;
+        data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.data_future   = NULL;
+    if( (ret = parsec_get_copy_reshape_from_desc(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    this_task->data._f_X.data_out = chunk;
+    PARSEC_OBJ_RETAIN(chunk);
+  } 
+    this_task->data._f_X.data_in     = chunk;
+    this_task->data._f_X.source_repo       = consumed_repo;
+    this_task->data._f_X.source_repo_entry = consumed_entry;
+    this_task->data._f_X.fulfill = 1;
+}
+
+  /** Generate profiling information */
+#if defined(PARSEC_PROF_TRACE)
+  this_task->prof_info.desc = (parsec_data_collection_t*)__parsec_tp->super._g_A;
+  this_task->prof_info.priority = this_task->priority;
+  this_task->prof_info.data_id   = ((parsec_data_collection_t*)__parsec_tp->super._g_A)->data_key((parsec_data_collection_t*)__parsec_tp->super._g_A, m, n);
+  this_task->prof_info.task_class_id = this_task->task_class->task_class_id;
+  this_task->prof_info.task_return_code = -1;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int datatype_lookup_of_udf_UD_STARTUP2(parsec_execution_stream_t *es, const parsec_task_t *this_generic_task, const parsec_task_t *parent_task,
+              uint32_t* flow_mask, parsec_dep_data_description_t* data)
+{
+  const __parsec_udf_UD_STARTUP2_task_t *this_task = (__parsec_udf_UD_STARTUP2_task_t*)this_generic_task;
+  const __parsec_udf_internal_taskpool_t *__parsec_tp = (__parsec_udf_internal_taskpool_t *)this_task->taskpool;
+  (void)__parsec_tp; (void)es; (void)this_task; (void)data; (void)parent_task;
+  const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+  data->local.arena = data->remote.arena = NULL;
+  data->local.src_datatype  = data->local.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->local.src_count     = data->local.dst_count = 0;
+  data->local.src_displ     = data->local.dst_displ = 0;
+  data->data_future  = NULL;
+  if( (*flow_mask) & 0x80000000U ) { /* these are the input dependencies remote datatypes  */
+if( (*flow_mask) & 0x1U ) {  /* Flow X */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_udf_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_udf_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_udf_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+    goto no_mask_match;
+  }
+
+  /* these are the output dependencies remote datatypes */
+ no_mask_match:
+  data->data                             = NULL;
+  data->remote.src_datatype = data->remote.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->remote.src_count    = data->remote.dst_count = 0;
+  data->remote.src_displ    = data->remote.dst_displ = 0;
+  data->data_future  = NULL;
+  (*flow_mask) = 0;  /* nothing left */
+  (void)m;  (void)n;
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+static int hook_of_udf_UD_STARTUP2(parsec_execution_stream_t *es, __parsec_udf_UD_STARTUP2_task_t *this_task)
+{
+  __parsec_udf_internal_taskpool_t *__parsec_tp = (__parsec_udf_internal_taskpool_t *)this_task->taskpool;
+  (void)es; (void)__parsec_tp;
+  const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+  (void)m;  (void)n;
+
+  /** Declare the variables that will hold the data, and all the accounting for each */
+  parsec_data_copy_t *_f_X = this_task->data._f_X.data_in;
+  void *X = PARSEC_DATA_COPY_GET_PTR(_f_X); (void)X;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    data_repo_entry_t *eX = this_task->data._f_X.source_repo_entry;
+    if( (NULL != eX) && (eX->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eX->sim_exec_date;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+  /** Cache Awareness Accounting */
+#if defined(PARSEC_CACHE_AWARENESS)
+  cache_buf_referenced(es->closest_cache, X);
+#endif /* PARSEC_CACHE_AWARENESS */
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                                UD_STARTUP2 BODY                                -----*/
+
+{
+    /* Nothing */
+}
+
+/*-----                            END OF UD_STARTUP2 BODY                            -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#endif  /*  defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+static int complete_hook_of_udf_UD_STARTUP2(parsec_execution_stream_t *es, __parsec_udf_UD_STARTUP2_task_t *this_task)
+{
+  const __parsec_udf_internal_taskpool_t *__parsec_tp = (__parsec_udf_internal_taskpool_t *)this_task->taskpool;
+#if defined(DISTRIBUTED)
+    const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+#endif  /* defined(DISTRIBUTED) */
+  (void)es; (void)__parsec_tp;
+parsec_data_t* data_t_desc = NULL; (void)data_t_desc;
+#if defined(DISTRIBUTED)
+  /** If not working on distributed, there is no risk that data is not in place */
+  (void)m;  (void)n;
+
+#endif /* DISTRIBUTED */
+#if defined(PARSEC_PROF_GRAPHER)
+  parsec_prof_grapher_task((parsec_task_t*)this_task, es->th_id, es->virtual_process->vp_id,
+     __jdf2c_key_fns_UD_STARTUP2.key_hash(this_task->task_class->make_key( (parsec_taskpool_t*)this_task->taskpool, ((parsec_task_t*)this_task)->locals), NULL));
+#endif  /* defined(PARSEC_PROF_GRAPHER) */
+  release_deps_of_udf_UD_STARTUP2(es, this_task,
+      PARSEC_ACTION_RELEASE_REMOTE_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_REFS |
+      PARSEC_ACTION_RESHAPE_ON_RELEASE |
+      0x0,  /* mask of all dep_index */ 
+      NULL);
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static parsec_hook_return_t release_task_of_udf_UD_STARTUP2(parsec_execution_stream_t *es, parsec_task_t *this_task)
+{
+    const __parsec_udf_internal_taskpool_t *__parsec_tp =
+        (const __parsec_udf_internal_taskpool_t *)this_task->taskpool;
+    parsec_hash_table_t *ht = (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[4];
+    parsec_key_t key = this_task->task_class->make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals);
+    parsec_hashable_dependency_t *hash_dep = (parsec_hashable_dependency_t *)parsec_hash_table_remove(ht, key);
+    /* Must test for NULL, as user-provided startup tasks may not have a dep in the hash table */
+    if(NULL != hash_dep) parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);
+    if( (PARSEC_UNDETERMINED_NB_TASKS == __parsec_tp->super.super.nb_tasks) ||
+        (0 == __parsec_tp->super.super.nb_tasks) ||
+        (PARSEC_RUNTIME_RESERVED_NB_TASKS == __parsec_tp->super.super.nb_tasks) ) {
+        /* don't spend time counting */
+        return parsec_release_task_to_mempool(es, this_task);
+    }
+    return parsec_release_task_to_mempool_update_nbtasks(es, this_task);
+}
+
+static char *udf_udf_UD_STARTUP2_internal_init_deps_key_functions_key_print(char *buffer, size_t buffer_size, parsec_key_t k, void *user_data)
+{
+  (void)user_data;
+  snprintf(buffer, buffer_size, "(%llu)", (unsigned long long int)k);
+  return buffer;
+}
+
+static parsec_key_fn_t udf_udf_UD_STARTUP2_internal_init_deps_key_functions = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = udf_udf_UD_STARTUP2_internal_init_deps_key_functions_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/* Needs: - - - */
+static int udf_UD_STARTUP2_internal_init(parsec_execution_stream_t * es, __parsec_udf_UD_STARTUP2_task_t * this_task)
+{
+  __parsec_udf_internal_taskpool_t *__parsec_tp = (__parsec_udf_internal_taskpool_t*)this_task->taskpool;
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+  PARSEC_PROFILING_TRACE(es->es_profile,
+                         this_task->taskpool->profiling_array[START_KEY(this_task->task_class->task_class_id)],
+                         0,
+                         this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    do {
+      this_task->super.list_next = (parsec_list_item_t*)__parsec_tp->startup_queue;
+    } while(!parsec_atomic_cas_ptr(&__parsec_tp->startup_queue, (parsec_list_item_t*)this_task->super.list_next, this_task));
+    this_task->status = PARSEC_TASK_STATUS_HOOK;
+
+  PARSEC_AYU_REGISTER_TASK(&udf_UD_STARTUP2);
+  __parsec_tp->super.super.dependencies_array[4] = PARSEC_OBJ_NEW(parsec_hash_table_t);
+  parsec_hash_table_init(__parsec_tp->super.super.dependencies_array[4], offsetof(parsec_hashable_dependency_t, ht_item), 10, udf_udf_UD_STARTUP2_internal_init_deps_key_functions, this_task->taskpool);
+  __parsec_tp->repositories[4] = data_repo_create_nothreadsafe(PARSEC_DEFAULT_DATAREPO_HASH_LENGTH, __jdf2c_key_fns_UD_STARTUP2, (parsec_taskpool_t*)__parsec_tp, 1);
+   (void)__parsec_tp; (void)es;
+  if(1 == parsec_atomic_fetch_dec_int32(&__parsec_tp->sync_point)) {
+    /* Last initialization task complete. Update the number of tasks. */
+    __parsec_tp->super.super.tdm.module->taskpool_addto_nb_tasks(&__parsec_tp->super.super, ud_nbtasks_nb_local_tasks(__parsec_tp));
+    parsec_mfence();  /* write memory barrier to guarantee that the scheduler gets the correct number of tasks */
+    parsec_taskpool_enable((parsec_taskpool_t*)__parsec_tp, &__parsec_tp->startup_queue,
+                           (parsec_task_t*)this_task, es, __parsec_tp->super.super.nb_pending_actions);
+    __parsec_tp->super.super.tdm.module->taskpool_ready(&__parsec_tp->super.super);
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+    PARSEC_PROFILING_TRACE(es->es_profile,
+                           this_task->taskpool->profiling_array[2 * this_task->task_class->task_class_id + 1],
+                           0,
+                           this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    if( 1 >= __parsec_tp->super.super.nb_pending_actions ) {
+        /* if no tasks will be generated let's prevent the runtime from calling the hook and instead go directly to complete the task */
+        this_task->status = PARSEC_TASK_STATUS_COMPLETE;
+    }
+    return PARSEC_HOOK_RETURN_DONE;
+  }
+  return PARSEC_HOOK_RETURN_ASYNC;
+}
+
+static const __parsec_chore_t __udf_UD_STARTUP2_chores[] ={
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+    { .type     = PARSEC_DEV_CPU,
+      .evaluate = (parsec_evaluate_function_t*)NULL,
+      .hook     = (parsec_hook_t*)hook_of_udf_UD_STARTUP2 },
+#endif  /* defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+    { .type     = PARSEC_DEV_NONE,
+      .evaluate = NULL,
+      .hook     = (parsec_hook_t*)NULL },  /* End marker */
+};
+
+static const parsec_task_class_t udf_UD_STARTUP2 = {
+  .name = "UD_STARTUP2",
+  .task_class_id = 4,
+  .nb_flows = 1,
+  .nb_parameters = 2,
+  .nb_locals = 2,
+  .task_class_type = PARSEC_TASK_CLASS_TYPE_PTG,
+  .params = { &symb_udf_UD_STARTUP2_m, &symb_udf_UD_STARTUP2_n, NULL },
+  .locals = { &symb_udf_UD_STARTUP2_m, &symb_udf_UD_STARTUP2_n, NULL },
+  .data_affinity = (parsec_data_ref_fn_t*)affinity_of_udf_UD_STARTUP2,
+  .initial_data = (parsec_data_ref_fn_t*)affinity_of_udf_UD_STARTUP2,
+  .final_data = (parsec_data_ref_fn_t*)affinity_of_udf_UD_STARTUP2,
+  .priority = NULL,
+  .properties = properties_of_udf_UD_STARTUP2,
+#if MAX_PARAM_COUNT < 1  /* number of read flows of UD_STARTUP2 */
+  #error Too many read flows for task UD_STARTUP2
+#endif  /* MAX_PARAM_COUNT */
+#if MAX_PARAM_COUNT < 0  /* number of write flows of UD_STARTUP2 */
+  #error Too many write flows for task UD_STARTUP2
+#endif  /* MAX_PARAM_COUNT */
+  .in = { &flow_of_udf_UD_STARTUP2_for_X, NULL },
+  .out = { NULL },
+  .flags = 0x0 | PARSEC_HAS_IN_IN_DEPENDENCIES | PARSEC_USE_DEPS_MASK,
+  .dependencies_goal = 0x1,
+  .make_key = ud_make_key,
+  .task_snprintf = parsec_task_snprintf,
+#if defined(PARSEC_PROF_TRACE)
+  .profile_info = &parsec_task_profile_info,
+#endif
+  .key_functions = &__jdf2c_key_fns_UD_STARTUP2,
+  .fini = (parsec_hook_t*)NULL,
+  .incarnations = __udf_UD_STARTUP2_chores,
+  .find_deps = parsec_hash_find_deps,
+  .update_deps = parsec_update_deps_with_mask,
+  .iterate_successors = (parsec_traverse_function_t*)NULL,
+  .iterate_predecessors = (parsec_traverse_function_t*)NULL,
+  .release_deps = (parsec_release_deps_t*)release_deps_of_udf_UD_STARTUP2,
+  .prepare_output = (parsec_hook_t*)NULL,
+  .prepare_input = (parsec_hook_t*)data_lookup_of_udf_UD_STARTUP2,
+  .time_estimate = NULL,
+  .get_datatype = datatype_lookup_of_udf_UD_STARTUP2,
+  .complete_execution = (parsec_hook_t*)complete_hook_of_udf_UD_STARTUP2,
+  .release_task = &release_task_of_udf_UD_STARTUP2,
+#if defined(PARSEC_SIM)
+  .sim_cost_fct = (parsec_sim_cost_fct_t*)NULL,
+#endif
+};
+
+
+/******                                UD_HASH_STRUCT                                ******/
+
+static inline int32_t minexpr_of_symb_udf_UD_HASH_STRUCT_m_fct(const __parsec_udf_internal_taskpool_t *__parsec_tp, const __parsec_udf_UD_HASH_STRUCT_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_udf_UD_HASH_STRUCT_m = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_udf_UD_HASH_STRUCT_m_fct }
+                   }
+};
+static inline int maxexpr_of_symb_udf_UD_HASH_STRUCT_m_fct(const __parsec_udf_internal_taskpool_t *__parsec_tp, const __parsec_udf_UD_HASH_STRUCT_parsec_assignment_t *locals)
+{
+  const int m = locals->m.value; (void)m;
+  const int n = locals->n.value; (void)n;
+
+  (void)m;
+  (void)n;
+  (void)__parsec_tp; (void)locals;
+  return (A->super.mt - 1);
+}
+static const parsec_expr_t maxexpr_of_symb_udf_UD_HASH_STRUCT_m = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_udf_UD_HASH_STRUCT_m_fct }
+                   }
+};
+static inline int32_t incexpr_of_symb_udf_UD_HASH_STRUCT_m_fct(const __parsec_udf_internal_taskpool_t *__parsec_tp, const __parsec_udf_UD_HASH_STRUCT_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return udf_UD_HASH_STRUCT_inline_c_expr4_line_89(__parsec_tp, locals);
+}
+static const parsec_expr_t incexpr_of_symb_udf_UD_HASH_STRUCT_m = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)incexpr_of_symb_udf_UD_HASH_STRUCT_m_fct }
+                   }
+};
+static const parsec_symbol_t symb_udf_UD_HASH_STRUCT_m = { .name = "m", .context_index = 0, .min = &minexpr_of_symb_udf_UD_HASH_STRUCT_m, .max = &maxexpr_of_symb_udf_UD_HASH_STRUCT_m, .cst_inc = 0, .expr_inc = &incexpr_of_symb_udf_UD_HASH_STRUCT_m,  .flags = 0x0};
+
+static inline int32_t minexpr_of_symb_udf_UD_HASH_STRUCT_n_fct(const __parsec_udf_internal_taskpool_t *__parsec_tp, const __parsec_udf_UD_HASH_STRUCT_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_udf_UD_HASH_STRUCT_n = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_udf_UD_HASH_STRUCT_n_fct }
+                   }
+};
+static inline int maxexpr_of_symb_udf_UD_HASH_STRUCT_n_fct(const __parsec_udf_internal_taskpool_t *__parsec_tp, const __parsec_udf_UD_HASH_STRUCT_parsec_assignment_t *locals)
+{
+  const int m = locals->m.value; (void)m;
+  const int n = locals->n.value; (void)n;
+
+  (void)m;
+  (void)n;
+  (void)__parsec_tp; (void)locals;
+  return (A->super.nt - 1);
+}
+static const parsec_expr_t maxexpr_of_symb_udf_UD_HASH_STRUCT_n = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_udf_UD_HASH_STRUCT_n_fct }
+                   }
+};
+static inline int32_t incexpr_of_symb_udf_UD_HASH_STRUCT_n_fct(const __parsec_udf_internal_taskpool_t *__parsec_tp, const __parsec_udf_UD_HASH_STRUCT_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return udf_UD_HASH_STRUCT_inline_c_expr3_line_90(__parsec_tp, locals);
+}
+static const parsec_expr_t incexpr_of_symb_udf_UD_HASH_STRUCT_n = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)incexpr_of_symb_udf_UD_HASH_STRUCT_n_fct }
+                   }
+};
+static const parsec_symbol_t symb_udf_UD_HASH_STRUCT_n = { .name = "n", .context_index = 1, .min = &minexpr_of_symb_udf_UD_HASH_STRUCT_n, .max = &maxexpr_of_symb_udf_UD_HASH_STRUCT_n, .cst_inc = 0, .expr_inc = &incexpr_of_symb_udf_UD_HASH_STRUCT_n,  .flags = 0x0};
+
+static inline int affinity_of_udf_UD_HASH_STRUCT(const __parsec_udf_UD_HASH_STRUCT_task_t *this_task,
+                     parsec_data_ref_t *ref)
+{
+    const __parsec_udf_internal_taskpool_t *__parsec_tp = (const __parsec_udf_internal_taskpool_t*)this_task->taskpool;
+  const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+
+  /* Silent Warnings: should look into predicate to know what variables are usefull */
+  (void)m;
+  (void)n;
+  ref->dc = (parsec_data_collection_t *)__parsec_tp->super._g_A;
+  /* Compute data key */
+  ref->key = ref->dc->data_key(ref->dc, m, n);
+  return 1;
+}
+static const parsec_property_t properties_of_udf_UD_HASH_STRUCT[1] = {
+  {.name = NULL, .expr = NULL}
+};
+static parsec_data_t *flow_of_udf_UD_HASH_STRUCT_for_X_dep1_atline_94_direct_access(const __parsec_udf_internal_taskpool_t *__parsec_tp, const __parsec_udf_UD_HASH_STRUCT_parsec_assignment_t *assignments)
+{
+  const int m = assignments->m.value; (void)m;
+  const int n = assignments->n.value; (void)n;
+
+  /* Silence Warnings: should look into parameters to know what variables are useful */
+  (void)m;
+  (void)n;
+  if( __parsec_tp->super.super.context->my_rank == (int32_t)rank_of_A(m, n) )
+    return data_of_A(m, n);
+  return NULL;
+}
+
+static const parsec_dep_t flow_of_udf_UD_HASH_STRUCT_for_X_dep1_atline_94 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = PARSEC_LOCAL_DATA_TASK_CLASS_ID, /* udf_A */
+  .direct_data = (parsec_data_lookup_func_t)&flow_of_udf_UD_HASH_STRUCT_for_X_dep1_atline_94_direct_access,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_udf_UD_HASH_STRUCT_for_X,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_udf_UD_HASH_STRUCT_for_X = {
+  .name               = "X",
+  .sym_type           = PARSEC_SYM_IN,
+  .flow_flags         = PARSEC_FLOW_ACCESS_READ|PARSEC_FLOW_HAS_IN_DEPS,
+  .flow_index         = 0,
+  .flow_datatype_mask = 0x0,
+  .dep_in     = { &flow_of_udf_UD_HASH_STRUCT_for_X_dep1_atline_94 },
+  .dep_out    = { NULL }
+};
+
+static int release_deps_of_udf_UD_HASH_STRUCT(parsec_execution_stream_t *es, __parsec_udf_UD_HASH_STRUCT_task_t *this_task, uint32_t action_mask, parsec_remote_deps_t *deps)
+{
+  PARSEC_PINS(es, RELEASE_DEPS_BEGIN, (parsec_task_t *)this_task);  const __parsec_udf_internal_taskpool_t *__parsec_tp = (const __parsec_udf_internal_taskpool_t *)this_task->taskpool;
+  parsec_release_dep_fct_arg_t arg;
+  int __vp_id;
+  int consume_local_repo = 0;
+  arg.action_mask = action_mask;
+  arg.output_entry = NULL;
+  arg.output_repo = NULL;
+#if defined(DISTRIBUTED)
+  arg.remote_deps = deps;
+#endif  /* defined(DISTRIBUTED) */
+  assert(NULL != es);
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS )    arg.ready_lists = alloca(sizeof(parsec_task_t *) * es->virtual_process->parsec_context->nb_vp);
+  else
+    arg.ready_lists = NULL;
+  for( __vp_id = 0; __vp_id < es->virtual_process->parsec_context->nb_vp; arg.ready_lists[__vp_id++] = NULL );
+  (void)__parsec_tp; (void)deps;
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_X.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_X.source_repo, this_task->data._f_X.source_repo_entry->ht_item.key );
+    }
+  }
+  consume_local_repo = (this_task->repo_entry != NULL);
+  /* No successors, don't call iterate_successors and don't release any local deps */
+      if (consume_local_repo) {
+         data_repo_entry_used_once( UD_HASH_STRUCT_repo, this_task->repo_entry->ht_item.key );
+      }
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_X.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_X.data_in);
+    }
+  }
+  PARSEC_PINS(es, RELEASE_DEPS_END, (parsec_task_t *)this_task);  return 0;
+}
+
+static int data_lookup_of_udf_UD_HASH_STRUCT(parsec_execution_stream_t *es, __parsec_udf_UD_HASH_STRUCT_task_t *this_task)
+{
+  const __parsec_udf_internal_taskpool_t *__parsec_tp = (__parsec_udf_internal_taskpool_t *)this_task->taskpool;
+  parsec_assignment_t generic_locals[MAX_PARAM_COUNT];  /* generic task locals */
+  int target_device = 0; (void)target_device;
+  (void)__parsec_tp; (void)generic_locals; (void)es;
+  parsec_data_copy_t *chunk = NULL;
+  data_repo_t        *reshape_repo  = NULL, *consumed_repo  = NULL;
+  data_repo_entry_t  *reshape_entry = NULL, *consumed_entry = NULL;
+  parsec_key_t        reshape_entry_key = 0, consumed_entry_key = 0;
+  uint8_t             consumed_flow_index;
+  parsec_dep_data_description_t data;
+  int ret;
+  (void)reshape_repo; (void)reshape_entry; (void)reshape_entry_key;
+  (void)consumed_repo; (void)consumed_entry; (void)consumed_entry_key;
+  (void)consumed_flow_index;
+  (void)chunk; (void)data; (void)ret;
+  const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+  if( NULL == this_task->repo_entry ){
+    this_task->repo_entry = data_repo_lookup_entry_and_create(es, UD_HASH_STRUCT_repo,                                       __jdf2c_make_key_UD_HASH_STRUCT((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    data_repo_entry_addto_usage_limit(UD_HASH_STRUCT_repo, this_task->repo_entry->ht_item.key, 1);    this_task->repo_entry ->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(this_task->repo_entry ->sim_exec_date == 0);
+    this_task->repo_entry ->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  /* The reshape repo is the current task repo. */  reshape_repo = UD_HASH_STRUCT_repo;
+  reshape_entry_key = __jdf2c_make_key_UD_HASH_STRUCT((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals) ;
+  reshape_entry = this_task->repo_entry;
+  /* Lookup the input data, and store them in the context if any */
+
+if(! this_task->data._f_X.fulfill ){ /* Flow X */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_X.data_out = NULL;  /* input only */
+  /* Flow X [0] dependency [0] from memory A */
+  if( NULL == (chunk = this_task->data._f_X.data_in) ) {
+  /* No data set up by predecessor on this task input flow */
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+  parsec_prof_grapher_data_input(data_of_A(m, n), (parsec_task_t*)this_task, &flow_of_udf_UD_HASH_STRUCT_for_X, 1);
+#endif
+    chunk = parsec_data_get_copy(data_of_A(m, n), target_device);
+    data.data = chunk;
+    data.data_future  = NULL;
+        data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.data_future   = NULL;
+    if( (ret = parsec_get_copy_reshape_from_desc(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    this_task->data._f_X.data_out = chunk;
+    PARSEC_OBJ_RETAIN(chunk);
+  } 
+    this_task->data._f_X.data_in     = chunk;
+    this_task->data._f_X.source_repo       = consumed_repo;
+    this_task->data._f_X.source_repo_entry = consumed_entry;
+    this_task->data._f_X.fulfill = 1;
+}
+
+  /** Generate profiling information */
+#if defined(PARSEC_PROF_TRACE)
+  this_task->prof_info.desc = (parsec_data_collection_t*)__parsec_tp->super._g_A;
+  this_task->prof_info.priority = this_task->priority;
+  this_task->prof_info.data_id   = ((parsec_data_collection_t*)__parsec_tp->super._g_A)->data_key((parsec_data_collection_t*)__parsec_tp->super._g_A, m, n);
+  this_task->prof_info.task_class_id = this_task->task_class->task_class_id;
+  this_task->prof_info.task_return_code = -1;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int datatype_lookup_of_udf_UD_HASH_STRUCT(parsec_execution_stream_t *es, const parsec_task_t *this_generic_task, const parsec_task_t *parent_task,
+              uint32_t* flow_mask, parsec_dep_data_description_t* data)
+{
+  const __parsec_udf_UD_HASH_STRUCT_task_t *this_task = (__parsec_udf_UD_HASH_STRUCT_task_t*)this_generic_task;
+  const __parsec_udf_internal_taskpool_t *__parsec_tp = (__parsec_udf_internal_taskpool_t *)this_task->taskpool;
+  (void)__parsec_tp; (void)es; (void)this_task; (void)data; (void)parent_task;
+  const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+  data->local.arena = data->remote.arena = NULL;
+  data->local.src_datatype  = data->local.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->local.src_count     = data->local.dst_count = 0;
+  data->local.src_displ     = data->local.dst_displ = 0;
+  data->data_future  = NULL;
+  if( (*flow_mask) & 0x80000000U ) { /* these are the input dependencies remote datatypes  */
+if( (*flow_mask) & 0x1U ) {  /* Flow X */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_udf_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_udf_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_udf_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+    goto no_mask_match;
+  }
+
+  /* these are the output dependencies remote datatypes */
+ no_mask_match:
+  data->data                             = NULL;
+  data->remote.src_datatype = data->remote.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->remote.src_count    = data->remote.dst_count = 0;
+  data->remote.src_displ    = data->remote.dst_displ = 0;
+  data->data_future  = NULL;
+  (*flow_mask) = 0;  /* nothing left */
+  (void)m;  (void)n;
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#if defined(PARSEC_HAVE_DEV_CUDA_SUPPORT)
+struct parsec_body_cuda_udf_UD_HASH_STRUCT_s {
+  uint8_t      index;
+  cudaStream_t stream;
+  void*           dyld_fn;
+};
+
+static int cuda_kernel_submit_udf_UD_HASH_STRUCT(parsec_device_gpu_module_t  *gpu_device,
+                                  parsec_gpu_task_t           *gpu_task,
+                                  parsec_gpu_exec_stream_t    *gpu_stream )
+{
+  __parsec_udf_UD_HASH_STRUCT_task_t *this_task = (__parsec_udf_UD_HASH_STRUCT_task_t *)gpu_task->ec;
+  parsec_device_cuda_module_t *cuda_device = (parsec_device_cuda_module_t*)gpu_device;
+  parsec_cuda_exec_stream_t *cuda_stream = (parsec_cuda_exec_stream_t*)gpu_stream;
+  __parsec_udf_internal_taskpool_t *__parsec_tp = (__parsec_udf_internal_taskpool_t *)this_task->taskpool;
+  struct parsec_body_cuda_udf_UD_HASH_STRUCT_s parsec_body = { cuda_device->cuda_index, cuda_stream->cuda_stream, NULL };
+  const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+  (void)m;  (void)n;
+
+  (void)gpu_device; (void)gpu_stream; (void)__parsec_tp; (void)parsec_body; (void)cuda_device; (void)cuda_stream;
+  /** Declare the variables that will hold the data, and all the accounting for each */
+  parsec_data_copy_t *_f_X = this_task->data._f_X.data_out;
+  void *X = PARSEC_DATA_COPY_GET_PTR(_f_X); (void)X;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    data_repo_entry_t *eX = this_task->data._f_X.source_repo_entry;
+    if( (NULL != eX) && (eX->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eX->sim_exec_date;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+  /** Cache Awareness Accounting */
+#if defined(PARSEC_CACHE_AWARENESS)
+  cache_buf_referenced(es->closest_cache, X);
+#endif /* PARSEC_CACHE_AWARENESS */
+#if defined(PARSEC_DEBUG_NOISIER)
+  {
+    char tmp[MAX_TASK_STRLEN];
+    PARSEC_DEBUG_VERBOSE(10, parsec_gpu_output_stream, "GPU[%d:%s]:\tEnqueue on device %s", gpu_device->super.device_index, gpu_device->super.name, 
+           parsec_task_snprintf(tmp, MAX_TASK_STRLEN, (parsec_task_t *)this_task));
+  }
+#endif /* defined(PARSEC_DEBUG_NOISIER) */
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                              UD_HASH_STRUCT BODY                              -----*/
+
+#if defined(PARSEC_PROF_TRACE)
+  if(gpu_stream->prof_event_track_enable) {
+    PARSEC_TASK_PROF_TRACE(gpu_stream->profiling,
+                           PARSEC_PROF_FUNC_KEY_START(this_task->taskpool,
+                                     this_task->task_class->task_class_id),
+                           (parsec_task_t*)this_task, 1);
+    gpu_task->prof_key_end = PARSEC_PROF_FUNC_KEY_END(this_task->taskpool,
+                                   this_task->task_class->task_class_id);
+    gpu_task->prof_event_id = this_task->task_class->key_functions->
+           key_hash(this_task->task_class->make_key(this_task->taskpool, ((parsec_task_t*)this_task)->locals), NULL);
+    gpu_task->prof_tp_id = this_task->taskpool->taskpool_id;
+  }
+#endif /* PARSEC_PROF_TRACE */
+{
+    fprintf(stderr, "We should never execute the CUDA incarnation for task UD_HASH_STRUCT(%d, %d)\n",
+            m, n);
+}
+
+/*-----                          END OF UD_HASH_STRUCT BODY                          -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int hook_of_udf_UD_HASH_STRUCT_CUDA(parsec_execution_stream_t *es, __parsec_udf_UD_HASH_STRUCT_task_t *this_task)
+{
+  __parsec_udf_internal_taskpool_t *__parsec_tp = (__parsec_udf_internal_taskpool_t *)this_task->taskpool;
+  parsec_gpu_task_t *gpu_task;
+  parsec_device_module_t *dev;
+    const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+  (void)m;  (void)n;
+
+  (void)es; (void)__parsec_tp;
+
+  dev = this_task->selected_device;
+  assert(NULL != dev);
+  assert(PARSEC_DEV_IS_GPU(dev->type));
+
+  gpu_task = (parsec_gpu_task_t*)calloc(1, sizeof(parsec_gpu_task_t));
+  PARSEC_OBJ_CONSTRUCT(gpu_task, parsec_list_item_t);
+  gpu_task->release_device_task = free;  /* by default free the device task */
+  gpu_task->ec = (parsec_task_t*)this_task;
+  gpu_task->submit = &cuda_kernel_submit_udf_UD_HASH_STRUCT;
+  gpu_task->task_type = 0;
+  gpu_task->last_data_check_epoch = -1;  /* force at least one validation for the task */
+  gpu_task->stage_in  = parsec_default_gpu_stage_in;
+  gpu_task->stage_out = parsec_default_gpu_stage_out;
+  gpu_task->pushout = 0;
+  gpu_task->flow[0]         = &flow_of_udf_UD_HASH_STRUCT_for_X;
+  gpu_task->flow_dc[0] = NULL;
+  // A shortcut to check if the flow exists
+  if (gpu_task->ec->data[0].data_in != NULL) {
+  gpu_task->flow_nb_elts[0] = gpu_task->ec->data[0].data_in->original->nb_elts;
+}
+
+  return dev->kernel_scheduler(dev, es, gpu_task);
+}
+
+#endif  /*  defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) */
+#if defined(PARSEC_HAVE_DEV_RECURSIVE_SUPPORT)
+static int hook_of_udf_UD_HASH_STRUCT_RECURSIVE(parsec_execution_stream_t *es, __parsec_udf_UD_HASH_STRUCT_task_t *this_task)
+{
+  __parsec_udf_internal_taskpool_t *__parsec_tp = (__parsec_udf_internal_taskpool_t *)this_task->taskpool;
+  (void)es; (void)__parsec_tp;
+  const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+  (void)m;  (void)n;
+
+  /** Declare the variables that will hold the data, and all the accounting for each */
+  parsec_data_copy_t *_f_X = this_task->data._f_X.data_in;
+  void *X = PARSEC_DATA_COPY_GET_PTR(_f_X); (void)X;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    data_repo_entry_t *eX = this_task->data._f_X.source_repo_entry;
+    if( (NULL != eX) && (eX->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eX->sim_exec_date;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+  /** Cache Awareness Accounting */
+#if defined(PARSEC_CACHE_AWARENESS)
+  cache_buf_referenced(es->closest_cache, X);
+#endif /* PARSEC_CACHE_AWARENESS */
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                              UD_HASH_STRUCT BODY                              -----*/
+
+{
+    fprintf(stderr, "We should never execute the RECURSIVE incarnation for task UD_HASH_STRUCT(%d, %d)\n",
+            m, n);
+}
+
+/*-----                          END OF UD_HASH_STRUCT BODY                          -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#endif  /*  defined(PARSEC_HAVE_DEV_RECURSIVE_SUPPORT) */
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+static int hook_of_udf_UD_HASH_STRUCT_CPU(parsec_execution_stream_t *es, __parsec_udf_UD_HASH_STRUCT_task_t *this_task)
+{
+  __parsec_udf_internal_taskpool_t *__parsec_tp = (__parsec_udf_internal_taskpool_t *)this_task->taskpool;
+  (void)es; (void)__parsec_tp;
+  const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+  (void)m;  (void)n;
+
+  /** Declare the variables that will hold the data, and all the accounting for each */
+  parsec_data_copy_t *_f_X = this_task->data._f_X.data_in;
+  void *X = PARSEC_DATA_COPY_GET_PTR(_f_X); (void)X;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    data_repo_entry_t *eX = this_task->data._f_X.source_repo_entry;
+    if( (NULL != eX) && (eX->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eX->sim_exec_date;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+  /** Cache Awareness Accounting */
+#if defined(PARSEC_CACHE_AWARENESS)
+  cache_buf_referenced(es->closest_cache, X);
+#endif /* PARSEC_CACHE_AWARENESS */
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                              UD_HASH_STRUCT BODY                              -----*/
+
+{
+    fprintf(stderr, "We should always execute the CPU incarnation for task UD_HASH_STRUCT(%d, %d)\n",
+            m, n);
+}
+
+/*-----                          END OF UD_HASH_STRUCT BODY                          -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#endif  /*  defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+static int complete_hook_of_udf_UD_HASH_STRUCT(parsec_execution_stream_t *es, __parsec_udf_UD_HASH_STRUCT_task_t *this_task)
+{
+  const __parsec_udf_internal_taskpool_t *__parsec_tp = (__parsec_udf_internal_taskpool_t *)this_task->taskpool;
+#if defined(DISTRIBUTED)
+    const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+#endif  /* defined(DISTRIBUTED) */
+  (void)es; (void)__parsec_tp;
+parsec_data_t* data_t_desc = NULL; (void)data_t_desc;
+#if defined(DISTRIBUTED)
+  /** If not working on distributed, there is no risk that data is not in place */
+  (void)m;  (void)n;
+
+#endif /* DISTRIBUTED */
+#if defined(PARSEC_PROF_GRAPHER)
+  parsec_prof_grapher_task((parsec_task_t*)this_task, es->th_id, es->virtual_process->vp_id,
+     ud_hash_struct.key_hash(this_task->task_class->make_key( (parsec_taskpool_t*)this_task->taskpool, ((parsec_task_t*)this_task)->locals), NULL));
+#endif  /* defined(PARSEC_PROF_GRAPHER) */
+  release_deps_of_udf_UD_HASH_STRUCT(es, this_task,
+      PARSEC_ACTION_RELEASE_REMOTE_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_REFS |
+      PARSEC_ACTION_RESHAPE_ON_RELEASE |
+      0x0,  /* mask of all dep_index */ 
+      NULL);
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static parsec_hook_return_t release_task_of_udf_UD_HASH_STRUCT(parsec_execution_stream_t *es, parsec_task_t *this_task)
+{
+    const __parsec_udf_internal_taskpool_t *__parsec_tp =
+        (const __parsec_udf_internal_taskpool_t *)this_task->taskpool;
+    parsec_hash_table_t *ht = (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[3];
+    parsec_key_t key = this_task->task_class->make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals);
+    parsec_hashable_dependency_t *hash_dep = (parsec_hashable_dependency_t *)parsec_hash_table_remove(ht, key);
+    parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);
+    if( (PARSEC_UNDETERMINED_NB_TASKS == __parsec_tp->super.super.nb_tasks) ||
+        (0 == __parsec_tp->super.super.nb_tasks) ||
+        (PARSEC_RUNTIME_RESERVED_NB_TASKS == __parsec_tp->super.super.nb_tasks) ) {
+        /* don't spend time counting */
+        return parsec_release_task_to_mempool(es, this_task);
+    }
+    return parsec_release_task_to_mempool_update_nbtasks(es, this_task);
+}
+
+/* Needs: min-max - iterate */
+static int udf_UD_HASH_STRUCT_internal_init(parsec_execution_stream_t * es, __parsec_udf_UD_HASH_STRUCT_task_t * this_task)
+{
+  __parsec_udf_internal_taskpool_t *__parsec_tp = (__parsec_udf_internal_taskpool_t*)this_task->taskpool;
+int32_t __m_min = 0x7fffffff, __m_max = 0;int32_t __jdf2c_m_min = 0x7fffffff, __jdf2c_m_max = 0;int32_t __n_min = 0x7fffffff, __n_max = 0;int32_t __jdf2c_n_min = 0x7fffffff, __jdf2c_n_max = 0;  __parsec_udf_UD_HASH_STRUCT_parsec_assignment_t assignments = {  .m.value = 0, .n.value = 0 };
+  int32_t  m,  n;
+  int32_t __jdf2c_m_start, __jdf2c_m_end, __jdf2c_m_inc;
+  int32_t __jdf2c_n_start, __jdf2c_n_end, __jdf2c_n_inc;
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+  PARSEC_PROFILING_TRACE(es->es_profile,
+                         this_task->taskpool->profiling_array[START_KEY(this_task->task_class->task_class_id)],
+                         0,
+                         this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    __jdf2c_m_start = 0;
+    __jdf2c_m_end = (A->super.mt - 1);
+    __jdf2c_m_inc = udf_UD_HASH_STRUCT_inline_c_expr4_line_89(__parsec_tp, &assignments);
+    __m_min = parsec_imin(__jdf2c_m_start, __jdf2c_m_end);
+    __m_max = parsec_imax(__jdf2c_m_start, __jdf2c_m_end);
+    __jdf2c_m_min = parsec_imin(__jdf2c_m_min, __m_min);
+    __jdf2c_m_max = parsec_imax(__jdf2c_m_max, __m_max);
+    for(m =  __jdf2c_m_start;
+        (((__jdf2c_m_inc >= 0) && (m <= __jdf2c_m_end)) ||
+         ((__jdf2c_m_inc <  0) && (m >= __jdf2c_m_end)));
+        m += __jdf2c_m_inc) {
+    assignments.m.value = m;
+      __jdf2c_n_start = 0;
+      __jdf2c_n_end = (A->super.nt - 1);
+      __jdf2c_n_inc = udf_UD_HASH_STRUCT_inline_c_expr3_line_90(__parsec_tp, &assignments);
+      __n_min = parsec_imin(__jdf2c_n_start, __jdf2c_n_end);
+      __n_max = parsec_imax(__jdf2c_n_start, __jdf2c_n_end);
+      __jdf2c_n_min = parsec_imin(__jdf2c_n_min, __n_min);
+      __jdf2c_n_max = parsec_imax(__jdf2c_n_max, __n_max);
+      for(n =  __jdf2c_n_start;
+          (((__jdf2c_n_inc >= 0) && (n <= __jdf2c_n_end)) ||
+           ((__jdf2c_n_inc <  0) && (n >= __jdf2c_n_end)));
+          n += __jdf2c_n_inc) {
+      assignments.n.value = n;
+      if( !UD_HASH_STRUCT_pred(m, n) ) continue;
+    } /* Loop on normal range n */
+  } /* For loop of m */ 
+  /* Set the range variables for the collision-free hash-computation */
+  __parsec_tp->UD_HASH_STRUCT_m_min   = __jdf2c_m_min;
+  __parsec_tp->UD_HASH_STRUCT_m_range = (__jdf2c_m_max - __jdf2c_m_min) + 1;
+  __parsec_tp->UD_HASH_STRUCT_n_min   = __jdf2c_n_min;
+  __parsec_tp->UD_HASH_STRUCT_n_range = (__jdf2c_n_max - __jdf2c_n_min) + 1;
+    do {
+      this_task->super.list_next = (parsec_list_item_t*)__parsec_tp->startup_queue;
+    } while(!parsec_atomic_cas_ptr(&__parsec_tp->startup_queue, (parsec_list_item_t*)this_task->super.list_next, this_task));
+    this_task->status = PARSEC_TASK_STATUS_HOOK;
+
+  PARSEC_AYU_REGISTER_TASK(&udf_UD_HASH_STRUCT);
+  __parsec_tp->super.super.dependencies_array[3] = PARSEC_OBJ_NEW(parsec_hash_table_t);
+  parsec_hash_table_init(__parsec_tp->super.super.dependencies_array[3], offsetof(parsec_hashable_dependency_t, ht_item), 10, ud_hash_struct, this_task->taskpool);
+  __parsec_tp->repositories[3] = data_repo_create_nothreadsafe(PARSEC_DEFAULT_DATAREPO_HASH_LENGTH, ud_hash_struct, (parsec_taskpool_t*)__parsec_tp, 1);
+(void)__m_min; (void)__m_max;(void)__n_min; (void)__n_max;  (void)__jdf2c_m_start; (void)__jdf2c_m_end; (void)__jdf2c_m_inc;  (void)__jdf2c_n_start; (void)__jdf2c_n_end; (void)__jdf2c_n_inc;  (void)assignments; (void)__parsec_tp; (void)es;
+  if(1 == parsec_atomic_fetch_dec_int32(&__parsec_tp->sync_point)) {
+    /* Last initialization task complete. Update the number of tasks. */
+    __parsec_tp->super.super.tdm.module->taskpool_addto_nb_tasks(&__parsec_tp->super.super, ud_nbtasks_nb_local_tasks(__parsec_tp));
+    parsec_mfence();  /* write memory barrier to guarantee that the scheduler gets the correct number of tasks */
+    parsec_taskpool_enable((parsec_taskpool_t*)__parsec_tp, &__parsec_tp->startup_queue,
+                           (parsec_task_t*)this_task, es, __parsec_tp->super.super.nb_pending_actions);
+    __parsec_tp->super.super.tdm.module->taskpool_ready(&__parsec_tp->super.super);
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+    PARSEC_PROFILING_TRACE(es->es_profile,
+                           this_task->taskpool->profiling_array[2 * this_task->task_class->task_class_id + 1],
+                           0,
+                           this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    if( 1 >= __parsec_tp->super.super.nb_pending_actions ) {
+        /* if no tasks will be generated let's prevent the runtime from calling the hook and instead go directly to complete the task */
+        this_task->status = PARSEC_TASK_STATUS_COMPLETE;
+    }
+    return PARSEC_HOOK_RETURN_DONE;
+  }
+  return PARSEC_HOOK_RETURN_ASYNC;
+}
+
+static int __jdf2c_startup_UD_HASH_STRUCT(parsec_execution_stream_t * es, __parsec_udf_UD_HASH_STRUCT_task_t *this_task)
+{
+  __parsec_udf_UD_HASH_STRUCT_task_t* new_task;
+  __parsec_udf_internal_taskpool_t* __parsec_tp = (__parsec_udf_internal_taskpool_t*)this_task->taskpool;
+  parsec_context_t *context = __parsec_tp->super.super.context;
+  int vpid = 0, nb_tasks = 0;
+  size_t total_nb_tasks = 0;
+  parsec_list_item_t* pready_ring[context->nb_vp];
+  int restore_context = 0;
+  int m = this_task->locals.m.value;  /* retrieve value saved during the last iteration */
+  int n = this_task->locals.n.value;  /* retrieve value saved during the last iteration */
+  for(int _i = 0; _i < context->nb_vp; pready_ring[_i++] = NULL );
+  if( 0 != this_task->locals.reserved[0].value ) {
+    this_task->locals.reserved[0].value = 1; /* reset the submission process */
+    restore_context = 1;
+    goto restore_context_0;
+  }
+  this_task->locals.reserved[0].value = 1; /* a sane default value */
+  for(this_task->locals.m.value = m = 0;
+      this_task->locals.m.value <= (A->super.mt - 1);
+      this_task->locals.m.value += udf_UD_HASH_STRUCT_inline_c_expr4_line_89(__parsec_tp, &this_task->locals), m = this_task->locals.m.value) {
+    for(this_task->locals.n.value = n = 0;
+        this_task->locals.n.value <= (A->super.nt - 1);
+        this_task->locals.n.value += udf_UD_HASH_STRUCT_inline_c_expr3_line_90(__parsec_tp, &this_task->locals), n = this_task->locals.n.value) {
+      if( !UD_HASH_STRUCT_pred(m, n) ) continue;
+  __parsec_udf_UD_HASH_STRUCT_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_udf_UD_HASH_STRUCT_parsec_assignment_t*)&this_task->locals;
+  (void)__jdf2c__tmp_locals;
+  /* Flow for X is always a memory reference */
+      if( NULL != ((parsec_data_collection_t*)__parsec_tp->super._g_A)->vpid_of ) {
+        vpid = ((parsec_data_collection_t*)__parsec_tp->super._g_A)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_A, m, n);
+        assert(context->nb_vp >= vpid);
+      } else {
+        vpid = (vpid + 1) % context->nb_vp;  /* spread the initial joy */
+      }
+      new_task = (__parsec_udf_UD_HASH_STRUCT_task_t*)parsec_thread_mempool_allocate( context->virtual_processes[vpid]->execution_streams[0]->context_mempool );
+      PARSEC_OBJ_CONSTRUCT(new_task, parsec_task_t); /* construct called only when new, force-construct it again */
+      /* Copy only the valid elements from this_task to new_task one */
+      new_task->taskpool   = this_task->taskpool;
+      new_task->task_class = __parsec_tp->super.super.task_classes_array[udf_UD_HASH_STRUCT.task_class_id];
+      new_task->chore_mask   = PARSEC_DEV_ALL;
+      new_task->locals.m.value = this_task->locals.m.value;
+      new_task->locals.n.value = this_task->locals.n.value;
+      PARSEC_LIST_ITEM_SINGLETON(new_task);
+      new_task->priority = __parsec_tp->super.super.priority;
+      new_task->repo_entry = NULL;
+      new_task->data._f_X.source_repo_entry = NULL;
+      new_task->data._f_X.source_repo       = NULL;
+      new_task->data._f_X.data_in         = NULL;
+      new_task->data._f_X.data_out        = NULL;
+      new_task->data._f_X.fulfill         = 0;
+#if defined(PARSEC_DEBUG_NOISIER)
+      {
+        char tmp[128];
+        PARSEC_DEBUG_VERBOSE(10, parsec_debug_output, "Add startup task %s to vpid %d",
+               parsec_task_snprintf(tmp, 128, (parsec_task_t*)new_task), vpid);
+      }
+#endif
+      parsec_dependencies_mark_task_as_startup((parsec_task_t*)new_task, es);
+      pready_ring[vpid] = parsec_list_item_ring_push_sorted(pready_ring[vpid],
+                                                            (parsec_list_item_t*)new_task,
+                                                            parsec_execution_context_priority_comparator);
+      nb_tasks++;
+     restore_context_0:  /* we jump here just so that we have code after the label */
+      restore_context = 0;
+      (void)restore_context;
+      if( nb_tasks > this_task->locals.reserved[0].value ) {
+        if( (size_t)this_task->locals.reserved[0].value < parsec_task_startup_iter ) this_task->locals.reserved[0].value <<= 1;
+        __parsec_schedule_vp(es, (parsec_task_t**)pready_ring, 0);
+        total_nb_tasks += nb_tasks;
+        nb_tasks = 0;
+        if( total_nb_tasks > parsec_task_startup_chunk ) {  /* stop here and request to be rescheduled */
+          return PARSEC_HOOK_RETURN_AGAIN;
+        }
+      }
+    } /* Loop on normal range n */
+  } /* Loop on normal range m */
+  (void)vpid;
+  if( 0 != nb_tasks ) {
+    __parsec_schedule_vp(es, (parsec_task_t**)pready_ring, 0);
+    nb_tasks = 0;
+  }
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static const __parsec_chore_t __udf_UD_HASH_STRUCT_chores[] ={
+#if defined(PARSEC_HAVE_DEV_CUDA_SUPPORT)
+    { .type     = PARSEC_DEV_CUDA,
+      .dyld     = NULL,
+      .evaluate = (parsec_evaluate_function_t*)never_here,
+      .hook     = (parsec_hook_t*)hook_of_udf_UD_HASH_STRUCT_CUDA },
+#endif  /* defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) */
+#if defined(PARSEC_HAVE_DEV_RECURSIVE_SUPPORT)
+    { .type     = PARSEC_DEV_RECURSIVE,
+      .dyld     = NULL,
+      .evaluate = (parsec_evaluate_function_t*)never_here,
+      .hook     = (parsec_hook_t*)hook_of_udf_UD_HASH_STRUCT_RECURSIVE },
+#endif  /* defined(PARSEC_HAVE_DEV_RECURSIVE_SUPPORT) */
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+    { .type     = PARSEC_DEV_CPU,
+      .dyld     = NULL,
+      .evaluate = (parsec_evaluate_function_t*)always_here,
+      .hook     = (parsec_hook_t*)hook_of_udf_UD_HASH_STRUCT_CPU },
+#endif  /* defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+    { .type     = PARSEC_DEV_NONE,
+      .evaluate = NULL,
+      .hook     = (parsec_hook_t*)NULL },  /* End marker */
+};
+
+static const parsec_task_class_t udf_UD_HASH_STRUCT = {
+  .name = "UD_HASH_STRUCT",
+  .task_class_id = 3,
+  .nb_flows = 1,
+  .nb_parameters = 2,
+  .nb_locals = 2,
+  .task_class_type = PARSEC_TASK_CLASS_TYPE_PTG,
+  .params = { &symb_udf_UD_HASH_STRUCT_m, &symb_udf_UD_HASH_STRUCT_n, NULL },
+  .locals = { &symb_udf_UD_HASH_STRUCT_m, &symb_udf_UD_HASH_STRUCT_n, NULL },
+  .data_affinity = (parsec_data_ref_fn_t*)affinity_of_udf_UD_HASH_STRUCT,
+  .initial_data = (parsec_data_ref_fn_t*)affinity_of_udf_UD_HASH_STRUCT,
+  .final_data = (parsec_data_ref_fn_t*)affinity_of_udf_UD_HASH_STRUCT,
+  .priority = NULL,
+  .properties = properties_of_udf_UD_HASH_STRUCT,
+#if MAX_PARAM_COUNT < 1  /* number of read flows of UD_HASH_STRUCT */
+  #error Too many read flows for task UD_HASH_STRUCT
+#endif  /* MAX_PARAM_COUNT */
+#if MAX_PARAM_COUNT < 0  /* number of write flows of UD_HASH_STRUCT */
+  #error Too many write flows for task UD_HASH_STRUCT
+#endif  /* MAX_PARAM_COUNT */
+  .in = { &flow_of_udf_UD_HASH_STRUCT_for_X, NULL },
+  .out = { NULL },
+  .flags = 0x0 | PARSEC_HAS_IN_IN_DEPENDENCIES | PARSEC_USE_DEPS_MASK,
+  .dependencies_goal = 0x1,
+  .make_key = __jdf2c_make_key_UD_HASH_STRUCT,
+  .task_snprintf = parsec_task_snprintf,
+#if defined(PARSEC_PROF_TRACE)
+  .profile_info = &parsec_task_profile_info,
+#endif
+  .key_functions = &ud_hash_struct,
+  .fini = (parsec_hook_t*)NULL,
+  .incarnations = __udf_UD_HASH_STRUCT_chores,
+  .find_deps = parsec_hash_find_deps,
+  .update_deps = parsec_update_deps_with_mask,
+  .iterate_successors = (parsec_traverse_function_t*)NULL,
+  .iterate_predecessors = (parsec_traverse_function_t*)NULL,
+  .release_deps = (parsec_release_deps_t*)release_deps_of_udf_UD_HASH_STRUCT,
+  .prepare_output = (parsec_hook_t*)NULL,
+  .prepare_input = (parsec_hook_t*)data_lookup_of_udf_UD_HASH_STRUCT,
+  .time_estimate = NULL,
+  .get_datatype = datatype_lookup_of_udf_UD_HASH_STRUCT,
+  .complete_execution = (parsec_hook_t*)complete_hook_of_udf_UD_HASH_STRUCT,
+  .release_task = &release_task_of_udf_UD_HASH_STRUCT,
+#if defined(PARSEC_SIM)
+  .sim_cost_fct = (parsec_sim_cost_fct_t*)NULL,
+#endif
+};
+
+
+/******                                  UD_STARTUP1                                  ******/
+
+static inline int32_t minexpr_of_symb_udf_UD_STARTUP1_m_fct(const __parsec_udf_internal_taskpool_t *__parsec_tp, const __parsec_udf_UD_STARTUP1_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_udf_UD_STARTUP1_m = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_udf_UD_STARTUP1_m_fct }
+                   }
+};
+static inline int maxexpr_of_symb_udf_UD_STARTUP1_m_fct(const __parsec_udf_internal_taskpool_t *__parsec_tp, const __parsec_udf_UD_STARTUP1_parsec_assignment_t *locals)
+{
+  const int m = locals->m.value; (void)m;
+  const int n = locals->n.value; (void)n;
+
+  (void)m;
+  (void)n;
+  (void)__parsec_tp; (void)locals;
+  return (A->super.mt - 1);
+}
+static const parsec_expr_t maxexpr_of_symb_udf_UD_STARTUP1_m = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_udf_UD_STARTUP1_m_fct }
+                   }
+};
+static inline int32_t incexpr_of_symb_udf_UD_STARTUP1_m_fct(const __parsec_udf_internal_taskpool_t *__parsec_tp, const __parsec_udf_UD_STARTUP1_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return udf_UD_STARTUP1_inline_c_expr7_line_75(__parsec_tp, locals);
+}
+static const parsec_expr_t incexpr_of_symb_udf_UD_STARTUP1_m = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)incexpr_of_symb_udf_UD_STARTUP1_m_fct }
+                   }
+};
+static const parsec_symbol_t symb_udf_UD_STARTUP1_m = { .name = "m", .context_index = 0, .min = &minexpr_of_symb_udf_UD_STARTUP1_m, .max = &maxexpr_of_symb_udf_UD_STARTUP1_m, .cst_inc = 0, .expr_inc = &incexpr_of_symb_udf_UD_STARTUP1_m,  .flags = 0x0};
+
+static inline int32_t minexpr_of_symb_udf_UD_STARTUP1_n_fct(const __parsec_udf_internal_taskpool_t *__parsec_tp, const __parsec_udf_UD_STARTUP1_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_udf_UD_STARTUP1_n = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_udf_UD_STARTUP1_n_fct }
+                   }
+};
+static inline int maxexpr_of_symb_udf_UD_STARTUP1_n_fct(const __parsec_udf_internal_taskpool_t *__parsec_tp, const __parsec_udf_UD_STARTUP1_parsec_assignment_t *locals)
+{
+  const int m = locals->m.value; (void)m;
+  const int n = locals->n.value; (void)n;
+
+  (void)m;
+  (void)n;
+  (void)__parsec_tp; (void)locals;
+  return (A->super.nt - 1);
+}
+static const parsec_expr_t maxexpr_of_symb_udf_UD_STARTUP1_n = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_udf_UD_STARTUP1_n_fct }
+                   }
+};
+static inline int32_t incexpr_of_symb_udf_UD_STARTUP1_n_fct(const __parsec_udf_internal_taskpool_t *__parsec_tp, const __parsec_udf_UD_STARTUP1_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return udf_UD_STARTUP1_inline_c_expr6_line_76(__parsec_tp, locals);
+}
+static const parsec_expr_t incexpr_of_symb_udf_UD_STARTUP1_n = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)incexpr_of_symb_udf_UD_STARTUP1_n_fct }
+                   }
+};
+static const parsec_symbol_t symb_udf_UD_STARTUP1_n = { .name = "n", .context_index = 1, .min = &minexpr_of_symb_udf_UD_STARTUP1_n, .max = &maxexpr_of_symb_udf_UD_STARTUP1_n, .cst_inc = 0, .expr_inc = &incexpr_of_symb_udf_UD_STARTUP1_n,  .flags = 0x0};
+
+static inline int affinity_of_udf_UD_STARTUP1(const __parsec_udf_UD_STARTUP1_task_t *this_task,
+                     parsec_data_ref_t *ref)
+{
+    const __parsec_udf_internal_taskpool_t *__parsec_tp = (const __parsec_udf_internal_taskpool_t*)this_task->taskpool;
+  const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+
+  /* Silent Warnings: should look into predicate to know what variables are usefull */
+  (void)m;
+  (void)n;
+  ref->dc = (parsec_data_collection_t *)__parsec_tp->super._g_A;
+  /* Compute data key */
+  ref->key = ref->dc->data_key(ref->dc, m, n);
+  return 1;
+}
+static const parsec_property_t properties_of_udf_UD_STARTUP1[1] = {
+  {.name = NULL, .expr = NULL}
+};
+static parsec_data_t *flow_of_udf_UD_STARTUP1_for_X_dep1_atline_80_direct_access(const __parsec_udf_internal_taskpool_t *__parsec_tp, const __parsec_udf_UD_STARTUP1_parsec_assignment_t *assignments)
+{
+  const int m = assignments->m.value; (void)m;
+  const int n = assignments->n.value; (void)n;
+
+  /* Silence Warnings: should look into parameters to know what variables are useful */
+  (void)m;
+  (void)n;
+  if( __parsec_tp->super.super.context->my_rank == (int32_t)rank_of_A(m, n) )
+    return data_of_A(m, n);
+  return NULL;
+}
+
+static const parsec_dep_t flow_of_udf_UD_STARTUP1_for_X_dep1_atline_80 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = PARSEC_LOCAL_DATA_TASK_CLASS_ID, /* udf_A */
+  .direct_data = (parsec_data_lookup_func_t)&flow_of_udf_UD_STARTUP1_for_X_dep1_atline_80_direct_access,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_udf_UD_STARTUP1_for_X,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_udf_UD_STARTUP1_for_X = {
+  .name               = "X",
+  .sym_type           = PARSEC_SYM_IN,
+  .flow_flags         = PARSEC_FLOW_ACCESS_READ|PARSEC_FLOW_HAS_IN_DEPS,
+  .flow_index         = 0,
+  .flow_datatype_mask = 0x0,
+  .dep_in     = { &flow_of_udf_UD_STARTUP1_for_X_dep1_atline_80 },
+  .dep_out    = { NULL }
+};
+
+static int release_deps_of_udf_UD_STARTUP1(parsec_execution_stream_t *es, __parsec_udf_UD_STARTUP1_task_t *this_task, uint32_t action_mask, parsec_remote_deps_t *deps)
+{
+  PARSEC_PINS(es, RELEASE_DEPS_BEGIN, (parsec_task_t *)this_task);  const __parsec_udf_internal_taskpool_t *__parsec_tp = (const __parsec_udf_internal_taskpool_t *)this_task->taskpool;
+  parsec_release_dep_fct_arg_t arg;
+  int __vp_id;
+  int consume_local_repo = 0;
+  arg.action_mask = action_mask;
+  arg.output_entry = NULL;
+  arg.output_repo = NULL;
+#if defined(DISTRIBUTED)
+  arg.remote_deps = deps;
+#endif  /* defined(DISTRIBUTED) */
+  assert(NULL != es);
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS )    arg.ready_lists = alloca(sizeof(parsec_task_t *) * es->virtual_process->parsec_context->nb_vp);
+  else
+    arg.ready_lists = NULL;
+  for( __vp_id = 0; __vp_id < es->virtual_process->parsec_context->nb_vp; arg.ready_lists[__vp_id++] = NULL );
+  (void)__parsec_tp; (void)deps;
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_X.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_X.source_repo, this_task->data._f_X.source_repo_entry->ht_item.key );
+    }
+  }
+  consume_local_repo = (this_task->repo_entry != NULL);
+  /* No successors, don't call iterate_successors and don't release any local deps */
+      if (consume_local_repo) {
+         data_repo_entry_used_once( UD_STARTUP1_repo, this_task->repo_entry->ht_item.key );
+      }
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_X.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_X.data_in);
+    }
+  }
+  PARSEC_PINS(es, RELEASE_DEPS_END, (parsec_task_t *)this_task);  return 0;
+}
+
+static int data_lookup_of_udf_UD_STARTUP1(parsec_execution_stream_t *es, __parsec_udf_UD_STARTUP1_task_t *this_task)
+{
+  const __parsec_udf_internal_taskpool_t *__parsec_tp = (__parsec_udf_internal_taskpool_t *)this_task->taskpool;
+  parsec_assignment_t generic_locals[MAX_PARAM_COUNT];  /* generic task locals */
+  int target_device = 0; (void)target_device;
+  (void)__parsec_tp; (void)generic_locals; (void)es;
+  parsec_data_copy_t *chunk = NULL;
+  data_repo_t        *reshape_repo  = NULL, *consumed_repo  = NULL;
+  data_repo_entry_t  *reshape_entry = NULL, *consumed_entry = NULL;
+  parsec_key_t        reshape_entry_key = 0, consumed_entry_key = 0;
+  uint8_t             consumed_flow_index;
+  parsec_dep_data_description_t data;
+  int ret;
+  (void)reshape_repo; (void)reshape_entry; (void)reshape_entry_key;
+  (void)consumed_repo; (void)consumed_entry; (void)consumed_entry_key;
+  (void)consumed_flow_index;
+  (void)chunk; (void)data; (void)ret;
+  const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+  if( NULL == this_task->repo_entry ){
+    this_task->repo_entry = data_repo_lookup_entry_and_create(es, UD_STARTUP1_repo,                                       __jdf2c_make_key_UD_STARTUP1((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    data_repo_entry_addto_usage_limit(UD_STARTUP1_repo, this_task->repo_entry->ht_item.key, 1);    this_task->repo_entry ->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(this_task->repo_entry ->sim_exec_date == 0);
+    this_task->repo_entry ->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  /* The reshape repo is the current task repo. */  reshape_repo = UD_STARTUP1_repo;
+  reshape_entry_key = __jdf2c_make_key_UD_STARTUP1((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals) ;
+  reshape_entry = this_task->repo_entry;
+  /* Lookup the input data, and store them in the context if any */
+
+if(! this_task->data._f_X.fulfill ){ /* Flow X */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_X.data_out = NULL;  /* input only */
+  /* Flow X [0] dependency [0] from memory A */
+  if( NULL == (chunk = this_task->data._f_X.data_in) ) {
+  /* No data set up by predecessor on this task input flow */
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+  parsec_prof_grapher_data_input(data_of_A(m, n), (parsec_task_t*)this_task, &flow_of_udf_UD_STARTUP1_for_X, 1);
+#endif
+    chunk = parsec_data_get_copy(data_of_A(m, n), target_device);
+    data.data = chunk;
+    data.data_future  = NULL;
+        data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.data_future   = NULL;
+    if( (ret = parsec_get_copy_reshape_from_desc(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    this_task->data._f_X.data_out = chunk;
+    PARSEC_OBJ_RETAIN(chunk);
+  } 
+    this_task->data._f_X.data_in     = chunk;
+    this_task->data._f_X.source_repo       = consumed_repo;
+    this_task->data._f_X.source_repo_entry = consumed_entry;
+    this_task->data._f_X.fulfill = 1;
+}
+
+  /** Generate profiling information */
+#if defined(PARSEC_PROF_TRACE)
+  this_task->prof_info.desc = (parsec_data_collection_t*)__parsec_tp->super._g_A;
+  this_task->prof_info.priority = this_task->priority;
+  this_task->prof_info.data_id   = ((parsec_data_collection_t*)__parsec_tp->super._g_A)->data_key((parsec_data_collection_t*)__parsec_tp->super._g_A, m, n);
+  this_task->prof_info.task_class_id = this_task->task_class->task_class_id;
+  this_task->prof_info.task_return_code = -1;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int datatype_lookup_of_udf_UD_STARTUP1(parsec_execution_stream_t *es, const parsec_task_t *this_generic_task, const parsec_task_t *parent_task,
+              uint32_t* flow_mask, parsec_dep_data_description_t* data)
+{
+  const __parsec_udf_UD_STARTUP1_task_t *this_task = (__parsec_udf_UD_STARTUP1_task_t*)this_generic_task;
+  const __parsec_udf_internal_taskpool_t *__parsec_tp = (__parsec_udf_internal_taskpool_t *)this_task->taskpool;
+  (void)__parsec_tp; (void)es; (void)this_task; (void)data; (void)parent_task;
+  const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+  data->local.arena = data->remote.arena = NULL;
+  data->local.src_datatype  = data->local.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->local.src_count     = data->local.dst_count = 0;
+  data->local.src_displ     = data->local.dst_displ = 0;
+  data->data_future  = NULL;
+  if( (*flow_mask) & 0x80000000U ) { /* these are the input dependencies remote datatypes  */
+if( (*flow_mask) & 0x1U ) {  /* Flow X */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_udf_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_udf_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_udf_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+    goto no_mask_match;
+  }
+
+  /* these are the output dependencies remote datatypes */
+ no_mask_match:
+  data->data                             = NULL;
+  data->remote.src_datatype = data->remote.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->remote.src_count    = data->remote.dst_count = 0;
+  data->remote.src_displ    = data->remote.dst_displ = 0;
+  data->data_future  = NULL;
+  (*flow_mask) = 0;  /* nothing left */
+  (void)m;  (void)n;
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+static int hook_of_udf_UD_STARTUP1(parsec_execution_stream_t *es, __parsec_udf_UD_STARTUP1_task_t *this_task)
+{
+  __parsec_udf_internal_taskpool_t *__parsec_tp = (__parsec_udf_internal_taskpool_t *)this_task->taskpool;
+  (void)es; (void)__parsec_tp;
+  const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+  (void)m;  (void)n;
+
+  /** Declare the variables that will hold the data, and all the accounting for each */
+  parsec_data_copy_t *_f_X = this_task->data._f_X.data_in;
+  void *X = PARSEC_DATA_COPY_GET_PTR(_f_X); (void)X;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    data_repo_entry_t *eX = this_task->data._f_X.source_repo_entry;
+    if( (NULL != eX) && (eX->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eX->sim_exec_date;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+  /** Cache Awareness Accounting */
+#if defined(PARSEC_CACHE_AWARENESS)
+  cache_buf_referenced(es->closest_cache, X);
+#endif /* PARSEC_CACHE_AWARENESS */
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                                UD_STARTUP1 BODY                                -----*/
+
+{
+    /* Nothing */
+}
+
+/*-----                            END OF UD_STARTUP1 BODY                            -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#endif  /*  defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+static int complete_hook_of_udf_UD_STARTUP1(parsec_execution_stream_t *es, __parsec_udf_UD_STARTUP1_task_t *this_task)
+{
+  const __parsec_udf_internal_taskpool_t *__parsec_tp = (__parsec_udf_internal_taskpool_t *)this_task->taskpool;
+#if defined(DISTRIBUTED)
+    const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+#endif  /* defined(DISTRIBUTED) */
+  (void)es; (void)__parsec_tp;
+parsec_data_t* data_t_desc = NULL; (void)data_t_desc;
+#if defined(DISTRIBUTED)
+  /** If not working on distributed, there is no risk that data is not in place */
+  (void)m;  (void)n;
+
+#endif /* DISTRIBUTED */
+#if defined(PARSEC_PROF_GRAPHER)
+  parsec_prof_grapher_task((parsec_task_t*)this_task, es->th_id, es->virtual_process->vp_id,
+     __jdf2c_key_fns_UD_STARTUP1.key_hash(this_task->task_class->make_key( (parsec_taskpool_t*)this_task->taskpool, ((parsec_task_t*)this_task)->locals), NULL));
+#endif  /* defined(PARSEC_PROF_GRAPHER) */
+  release_deps_of_udf_UD_STARTUP1(es, this_task,
+      PARSEC_ACTION_RELEASE_REMOTE_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_REFS |
+      PARSEC_ACTION_RESHAPE_ON_RELEASE |
+      0x0,  /* mask of all dep_index */ 
+      NULL);
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static parsec_hook_return_t release_task_of_udf_UD_STARTUP1(parsec_execution_stream_t *es, parsec_task_t *this_task)
+{
+    const __parsec_udf_internal_taskpool_t *__parsec_tp =
+        (const __parsec_udf_internal_taskpool_t *)this_task->taskpool;
+    parsec_hash_table_t *ht = (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[2];
+    parsec_key_t key = this_task->task_class->make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals);
+    parsec_hashable_dependency_t *hash_dep = (parsec_hashable_dependency_t *)parsec_hash_table_remove(ht, key);
+    /* Must test for NULL, as user-provided startup tasks may not have a dep in the hash table */
+    if(NULL != hash_dep) parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);
+    if( (PARSEC_UNDETERMINED_NB_TASKS == __parsec_tp->super.super.nb_tasks) ||
+        (0 == __parsec_tp->super.super.nb_tasks) ||
+        (PARSEC_RUNTIME_RESERVED_NB_TASKS == __parsec_tp->super.super.nb_tasks) ) {
+        /* don't spend time counting */
+        return parsec_release_task_to_mempool(es, this_task);
+    }
+    return parsec_release_task_to_mempool_update_nbtasks(es, this_task);
+}
+
+static char *udf_udf_UD_STARTUP1_internal_init_deps_key_functions_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_udf_internal_taskpool_t *__parsec_tp = (__parsec_udf_internal_taskpool_t *)user_data;
+  int m = (__parsec_key) % __parsec_tp->UD_STARTUP1_m_range + __parsec_tp->UD_STARTUP1_m_min;
+  __parsec_key = __parsec_key / __parsec_tp->UD_STARTUP1_m_range;
+  int n = (__parsec_key) % __parsec_tp->UD_STARTUP1_n_range + __parsec_tp->UD_STARTUP1_n_min;
+  __parsec_key = __parsec_key / __parsec_tp->UD_STARTUP1_n_range;
+  snprintf(buffer, buffer_size, "UD_STARTUP1(%d, %d)", m, n);
+  return buffer;
+}
+
+static parsec_key_fn_t udf_udf_UD_STARTUP1_internal_init_deps_key_functions = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = udf_udf_UD_STARTUP1_internal_init_deps_key_functions_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/* Needs: min-max - iterate */
+static int udf_UD_STARTUP1_internal_init(parsec_execution_stream_t * es, __parsec_udf_UD_STARTUP1_task_t * this_task)
+{
+  __parsec_udf_internal_taskpool_t *__parsec_tp = (__parsec_udf_internal_taskpool_t*)this_task->taskpool;
+int32_t __m_min = 0x7fffffff, __m_max = 0;int32_t __jdf2c_m_min = 0x7fffffff, __jdf2c_m_max = 0;int32_t __n_min = 0x7fffffff, __n_max = 0;int32_t __jdf2c_n_min = 0x7fffffff, __jdf2c_n_max = 0;  __parsec_udf_UD_STARTUP1_parsec_assignment_t assignments = {  .m.value = 0, .n.value = 0 };
+  int32_t  m,  n;
+  int32_t __jdf2c_m_start, __jdf2c_m_end, __jdf2c_m_inc;
+  int32_t __jdf2c_n_start, __jdf2c_n_end, __jdf2c_n_inc;
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+  PARSEC_PROFILING_TRACE(es->es_profile,
+                         this_task->taskpool->profiling_array[START_KEY(this_task->task_class->task_class_id)],
+                         0,
+                         this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    __jdf2c_m_start = 0;
+    __jdf2c_m_end = (A->super.mt - 1);
+    __jdf2c_m_inc = udf_UD_STARTUP1_inline_c_expr7_line_75(__parsec_tp, &assignments);
+    __m_min = parsec_imin(__jdf2c_m_start, __jdf2c_m_end);
+    __m_max = parsec_imax(__jdf2c_m_start, __jdf2c_m_end);
+    __jdf2c_m_min = parsec_imin(__jdf2c_m_min, __m_min);
+    __jdf2c_m_max = parsec_imax(__jdf2c_m_max, __m_max);
+    for(m =  __jdf2c_m_start;
+        (((__jdf2c_m_inc >= 0) && (m <= __jdf2c_m_end)) ||
+         ((__jdf2c_m_inc <  0) && (m >= __jdf2c_m_end)));
+        m += __jdf2c_m_inc) {
+    assignments.m.value = m;
+      __jdf2c_n_start = 0;
+      __jdf2c_n_end = (A->super.nt - 1);
+      __jdf2c_n_inc = udf_UD_STARTUP1_inline_c_expr6_line_76(__parsec_tp, &assignments);
+      __n_min = parsec_imin(__jdf2c_n_start, __jdf2c_n_end);
+      __n_max = parsec_imax(__jdf2c_n_start, __jdf2c_n_end);
+      __jdf2c_n_min = parsec_imin(__jdf2c_n_min, __n_min);
+      __jdf2c_n_max = parsec_imax(__jdf2c_n_max, __n_max);
+      for(n =  __jdf2c_n_start;
+          (((__jdf2c_n_inc >= 0) && (n <= __jdf2c_n_end)) ||
+           ((__jdf2c_n_inc <  0) && (n >= __jdf2c_n_end)));
+          n += __jdf2c_n_inc) {
+      assignments.n.value = n;
+      if( !UD_STARTUP1_pred(m, n) ) continue;
+    } /* Loop on normal range n */
+  } /* For loop of m */ 
+  /* Set the range variables for the collision-free hash-computation */
+  __parsec_tp->UD_STARTUP1_m_min   = __jdf2c_m_min;
+  __parsec_tp->UD_STARTUP1_m_range = (__jdf2c_m_max - __jdf2c_m_min) + 1;
+  __parsec_tp->UD_STARTUP1_n_min   = __jdf2c_n_min;
+  __parsec_tp->UD_STARTUP1_n_range = (__jdf2c_n_max - __jdf2c_n_min) + 1;
+    do {
+      this_task->super.list_next = (parsec_list_item_t*)__parsec_tp->startup_queue;
+    } while(!parsec_atomic_cas_ptr(&__parsec_tp->startup_queue, (parsec_list_item_t*)this_task->super.list_next, this_task));
+    this_task->status = PARSEC_TASK_STATUS_HOOK;
+
+  PARSEC_AYU_REGISTER_TASK(&udf_UD_STARTUP1);
+  __parsec_tp->super.super.dependencies_array[2] = PARSEC_OBJ_NEW(parsec_hash_table_t);
+  parsec_hash_table_init(__parsec_tp->super.super.dependencies_array[2], offsetof(parsec_hashable_dependency_t, ht_item), 10, udf_udf_UD_STARTUP1_internal_init_deps_key_functions, this_task->taskpool);
+  __parsec_tp->repositories[2] = data_repo_create_nothreadsafe(PARSEC_DEFAULT_DATAREPO_HASH_LENGTH, __jdf2c_key_fns_UD_STARTUP1, (parsec_taskpool_t*)__parsec_tp, 1);
+(void)__m_min; (void)__m_max;(void)__n_min; (void)__n_max;  (void)__jdf2c_m_start; (void)__jdf2c_m_end; (void)__jdf2c_m_inc;  (void)__jdf2c_n_start; (void)__jdf2c_n_end; (void)__jdf2c_n_inc;  (void)assignments; (void)__parsec_tp; (void)es;
+  if(1 == parsec_atomic_fetch_dec_int32(&__parsec_tp->sync_point)) {
+    /* Last initialization task complete. Update the number of tasks. */
+    __parsec_tp->super.super.tdm.module->taskpool_addto_nb_tasks(&__parsec_tp->super.super, ud_nbtasks_nb_local_tasks(__parsec_tp));
+    parsec_mfence();  /* write memory barrier to guarantee that the scheduler gets the correct number of tasks */
+    parsec_taskpool_enable((parsec_taskpool_t*)__parsec_tp, &__parsec_tp->startup_queue,
+                           (parsec_task_t*)this_task, es, __parsec_tp->super.super.nb_pending_actions);
+    __parsec_tp->super.super.tdm.module->taskpool_ready(&__parsec_tp->super.super);
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+    PARSEC_PROFILING_TRACE(es->es_profile,
+                           this_task->taskpool->profiling_array[2 * this_task->task_class->task_class_id + 1],
+                           0,
+                           this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    if( 1 >= __parsec_tp->super.super.nb_pending_actions ) {
+        /* if no tasks will be generated let's prevent the runtime from calling the hook and instead go directly to complete the task */
+        this_task->status = PARSEC_TASK_STATUS_COMPLETE;
+    }
+    return PARSEC_HOOK_RETURN_DONE;
+  }
+  return PARSEC_HOOK_RETURN_ASYNC;
+}
+
+static const __parsec_chore_t __udf_UD_STARTUP1_chores[] ={
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+    { .type     = PARSEC_DEV_CPU,
+      .evaluate = (parsec_evaluate_function_t*)udf_UD_STARTUP1_inline_c_expr5_line_82,
+      .hook     = (parsec_hook_t*)hook_of_udf_UD_STARTUP1 },
+#endif  /* defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+    { .type     = PARSEC_DEV_NONE,
+      .evaluate = NULL,
+      .hook     = (parsec_hook_t*)NULL },  /* End marker */
+};
+
+static const parsec_task_class_t udf_UD_STARTUP1 = {
+  .name = "UD_STARTUP1",
+  .task_class_id = 2,
+  .nb_flows = 1,
+  .nb_parameters = 2,
+  .nb_locals = 2,
+  .task_class_type = PARSEC_TASK_CLASS_TYPE_PTG,
+  .params = { &symb_udf_UD_STARTUP1_m, &symb_udf_UD_STARTUP1_n, NULL },
+  .locals = { &symb_udf_UD_STARTUP1_m, &symb_udf_UD_STARTUP1_n, NULL },
+  .data_affinity = (parsec_data_ref_fn_t*)affinity_of_udf_UD_STARTUP1,
+  .initial_data = (parsec_data_ref_fn_t*)affinity_of_udf_UD_STARTUP1,
+  .final_data = (parsec_data_ref_fn_t*)affinity_of_udf_UD_STARTUP1,
+  .priority = NULL,
+  .properties = properties_of_udf_UD_STARTUP1,
+#if MAX_PARAM_COUNT < 1  /* number of read flows of UD_STARTUP1 */
+  #error Too many read flows for task UD_STARTUP1
+#endif  /* MAX_PARAM_COUNT */
+#if MAX_PARAM_COUNT < 0  /* number of write flows of UD_STARTUP1 */
+  #error Too many write flows for task UD_STARTUP1
+#endif  /* MAX_PARAM_COUNT */
+  .in = { &flow_of_udf_UD_STARTUP1_for_X, NULL },
+  .out = { NULL },
+  .flags = 0x0 | PARSEC_HAS_IN_IN_DEPENDENCIES | PARSEC_USE_DEPS_MASK,
+  .dependencies_goal = 0x1,
+  .make_key = __jdf2c_make_key_UD_STARTUP1,
+  .task_snprintf = parsec_task_snprintf,
+#if defined(PARSEC_PROF_TRACE)
+  .profile_info = &parsec_task_profile_info,
+#endif
+  .key_functions = &__jdf2c_key_fns_UD_STARTUP1,
+  .fini = (parsec_hook_t*)NULL,
+  .incarnations = __udf_UD_STARTUP1_chores,
+  .find_deps = parsec_hash_find_deps,
+  .update_deps = parsec_update_deps_with_mask,
+  .iterate_successors = (parsec_traverse_function_t*)NULL,
+  .iterate_predecessors = (parsec_traverse_function_t*)NULL,
+  .release_deps = (parsec_release_deps_t*)release_deps_of_udf_UD_STARTUP1,
+  .prepare_output = (parsec_hook_t*)NULL,
+  .prepare_input = (parsec_hook_t*)data_lookup_of_udf_UD_STARTUP1,
+  .time_estimate = NULL,
+  .get_datatype = datatype_lookup_of_udf_UD_STARTUP1,
+  .complete_execution = (parsec_hook_t*)complete_hook_of_udf_UD_STARTUP1,
+  .release_task = &release_task_of_udf_UD_STARTUP1,
+#if defined(PARSEC_SIM)
+  .sim_cost_fct = (parsec_sim_cost_fct_t*)NULL,
+#endif
+};
+
+
+/******                                  UD_MAKE_KEY                                  ******/
+
+static inline int32_t minexpr_of_symb_udf_UD_MAKE_KEY_m_fct(const __parsec_udf_internal_taskpool_t *__parsec_tp, const __parsec_udf_UD_MAKE_KEY_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_udf_UD_MAKE_KEY_m = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_udf_UD_MAKE_KEY_m_fct }
+                   }
+};
+static inline int maxexpr_of_symb_udf_UD_MAKE_KEY_m_fct(const __parsec_udf_internal_taskpool_t *__parsec_tp, const __parsec_udf_UD_MAKE_KEY_parsec_assignment_t *locals)
+{
+  const int m = locals->m.value; (void)m;
+  const int n = locals->n.value; (void)n;
+
+  (void)m;
+  (void)n;
+  (void)__parsec_tp; (void)locals;
+  return (A->super.mt - 1);
+}
+static const parsec_expr_t maxexpr_of_symb_udf_UD_MAKE_KEY_m = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_udf_UD_MAKE_KEY_m_fct }
+                   }
+};
+static inline int32_t incexpr_of_symb_udf_UD_MAKE_KEY_m_fct(const __parsec_udf_internal_taskpool_t *__parsec_tp, const __parsec_udf_UD_MAKE_KEY_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return udf_UD_MAKE_KEY_inline_c_expr9_line_61(__parsec_tp, locals);
+}
+static const parsec_expr_t incexpr_of_symb_udf_UD_MAKE_KEY_m = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)incexpr_of_symb_udf_UD_MAKE_KEY_m_fct }
+                   }
+};
+static const parsec_symbol_t symb_udf_UD_MAKE_KEY_m = { .name = "m", .context_index = 0, .min = &minexpr_of_symb_udf_UD_MAKE_KEY_m, .max = &maxexpr_of_symb_udf_UD_MAKE_KEY_m, .cst_inc = 0, .expr_inc = &incexpr_of_symb_udf_UD_MAKE_KEY_m,  .flags = 0x0};
+
+static inline int32_t minexpr_of_symb_udf_UD_MAKE_KEY_n_fct(const __parsec_udf_internal_taskpool_t *__parsec_tp, const __parsec_udf_UD_MAKE_KEY_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_udf_UD_MAKE_KEY_n = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_udf_UD_MAKE_KEY_n_fct }
+                   }
+};
+static inline int maxexpr_of_symb_udf_UD_MAKE_KEY_n_fct(const __parsec_udf_internal_taskpool_t *__parsec_tp, const __parsec_udf_UD_MAKE_KEY_parsec_assignment_t *locals)
+{
+  const int m = locals->m.value; (void)m;
+  const int n = locals->n.value; (void)n;
+
+  (void)m;
+  (void)n;
+  (void)__parsec_tp; (void)locals;
+  return (A->super.nt - 1);
+}
+static const parsec_expr_t maxexpr_of_symb_udf_UD_MAKE_KEY_n = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_udf_UD_MAKE_KEY_n_fct }
+                   }
+};
+static inline int32_t incexpr_of_symb_udf_UD_MAKE_KEY_n_fct(const __parsec_udf_internal_taskpool_t *__parsec_tp, const __parsec_udf_UD_MAKE_KEY_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return udf_UD_MAKE_KEY_inline_c_expr8_line_62(__parsec_tp, locals);
+}
+static const parsec_expr_t incexpr_of_symb_udf_UD_MAKE_KEY_n = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)incexpr_of_symb_udf_UD_MAKE_KEY_n_fct }
+                   }
+};
+static const parsec_symbol_t symb_udf_UD_MAKE_KEY_n = { .name = "n", .context_index = 1, .min = &minexpr_of_symb_udf_UD_MAKE_KEY_n, .max = &maxexpr_of_symb_udf_UD_MAKE_KEY_n, .cst_inc = 0, .expr_inc = &incexpr_of_symb_udf_UD_MAKE_KEY_n,  .flags = 0x0};
+
+static inline int affinity_of_udf_UD_MAKE_KEY(const __parsec_udf_UD_MAKE_KEY_task_t *this_task,
+                     parsec_data_ref_t *ref)
+{
+    const __parsec_udf_internal_taskpool_t *__parsec_tp = (const __parsec_udf_internal_taskpool_t*)this_task->taskpool;
+  const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+
+  /* Silent Warnings: should look into predicate to know what variables are usefull */
+  (void)m;
+  (void)n;
+  ref->dc = (parsec_data_collection_t *)__parsec_tp->super._g_A;
+  /* Compute data key */
+  ref->key = ref->dc->data_key(ref->dc, m, n);
+  return 1;
+}
+static const parsec_property_t properties_of_udf_UD_MAKE_KEY[1] = {
+  {.name = NULL, .expr = NULL}
+};
+static parsec_data_t *flow_of_udf_UD_MAKE_KEY_for_X_dep1_atline_66_direct_access(const __parsec_udf_internal_taskpool_t *__parsec_tp, const __parsec_udf_UD_MAKE_KEY_parsec_assignment_t *assignments)
+{
+  const int m = assignments->m.value; (void)m;
+  const int n = assignments->n.value; (void)n;
+
+  /* Silence Warnings: should look into parameters to know what variables are useful */
+  (void)m;
+  (void)n;
+  if( __parsec_tp->super.super.context->my_rank == (int32_t)rank_of_A(m, n) )
+    return data_of_A(m, n);
+  return NULL;
+}
+
+static const parsec_dep_t flow_of_udf_UD_MAKE_KEY_for_X_dep1_atline_66 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = PARSEC_LOCAL_DATA_TASK_CLASS_ID, /* udf_A */
+  .direct_data = (parsec_data_lookup_func_t)&flow_of_udf_UD_MAKE_KEY_for_X_dep1_atline_66_direct_access,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_udf_UD_MAKE_KEY_for_X,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_udf_UD_MAKE_KEY_for_X = {
+  .name               = "X",
+  .sym_type           = PARSEC_SYM_IN,
+  .flow_flags         = PARSEC_FLOW_ACCESS_READ|PARSEC_FLOW_HAS_IN_DEPS,
+  .flow_index         = 0,
+  .flow_datatype_mask = 0x0,
+  .dep_in     = { &flow_of_udf_UD_MAKE_KEY_for_X_dep1_atline_66 },
+  .dep_out    = { NULL }
+};
+
+static int release_deps_of_udf_UD_MAKE_KEY(parsec_execution_stream_t *es, __parsec_udf_UD_MAKE_KEY_task_t *this_task, uint32_t action_mask, parsec_remote_deps_t *deps)
+{
+  PARSEC_PINS(es, RELEASE_DEPS_BEGIN, (parsec_task_t *)this_task);  const __parsec_udf_internal_taskpool_t *__parsec_tp = (const __parsec_udf_internal_taskpool_t *)this_task->taskpool;
+  parsec_release_dep_fct_arg_t arg;
+  int __vp_id;
+  int consume_local_repo = 0;
+  arg.action_mask = action_mask;
+  arg.output_entry = NULL;
+  arg.output_repo = NULL;
+#if defined(DISTRIBUTED)
+  arg.remote_deps = deps;
+#endif  /* defined(DISTRIBUTED) */
+  assert(NULL != es);
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS )    arg.ready_lists = alloca(sizeof(parsec_task_t *) * es->virtual_process->parsec_context->nb_vp);
+  else
+    arg.ready_lists = NULL;
+  for( __vp_id = 0; __vp_id < es->virtual_process->parsec_context->nb_vp; arg.ready_lists[__vp_id++] = NULL );
+  (void)__parsec_tp; (void)deps;
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_X.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_X.source_repo, this_task->data._f_X.source_repo_entry->ht_item.key );
+    }
+  }
+  consume_local_repo = (this_task->repo_entry != NULL);
+  /* No successors, don't call iterate_successors and don't release any local deps */
+      if (consume_local_repo) {
+         data_repo_entry_used_once( UD_MAKE_KEY_repo, this_task->repo_entry->ht_item.key );
+      }
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_X.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_X.data_in);
+    }
+  }
+  PARSEC_PINS(es, RELEASE_DEPS_END, (parsec_task_t *)this_task);  return 0;
+}
+
+static int data_lookup_of_udf_UD_MAKE_KEY(parsec_execution_stream_t *es, __parsec_udf_UD_MAKE_KEY_task_t *this_task)
+{
+  const __parsec_udf_internal_taskpool_t *__parsec_tp = (__parsec_udf_internal_taskpool_t *)this_task->taskpool;
+  parsec_assignment_t generic_locals[MAX_PARAM_COUNT];  /* generic task locals */
+  int target_device = 0; (void)target_device;
+  (void)__parsec_tp; (void)generic_locals; (void)es;
+  parsec_data_copy_t *chunk = NULL;
+  data_repo_t        *reshape_repo  = NULL, *consumed_repo  = NULL;
+  data_repo_entry_t  *reshape_entry = NULL, *consumed_entry = NULL;
+  parsec_key_t        reshape_entry_key = 0, consumed_entry_key = 0;
+  uint8_t             consumed_flow_index;
+  parsec_dep_data_description_t data;
+  int ret;
+  (void)reshape_repo; (void)reshape_entry; (void)reshape_entry_key;
+  (void)consumed_repo; (void)consumed_entry; (void)consumed_entry_key;
+  (void)consumed_flow_index;
+  (void)chunk; (void)data; (void)ret;
+  const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+  if( NULL == this_task->repo_entry ){
+    this_task->repo_entry = data_repo_lookup_entry_and_create(es, UD_MAKE_KEY_repo,                                       ud_make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    data_repo_entry_addto_usage_limit(UD_MAKE_KEY_repo, this_task->repo_entry->ht_item.key, 1);    this_task->repo_entry ->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(this_task->repo_entry ->sim_exec_date == 0);
+    this_task->repo_entry ->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  /* The reshape repo is the current task repo. */  reshape_repo = UD_MAKE_KEY_repo;
+  reshape_entry_key = ud_make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals) ;
+  reshape_entry = this_task->repo_entry;
+  /* Lookup the input data, and store them in the context if any */
+
+if(! this_task->data._f_X.fulfill ){ /* Flow X */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_X.data_out = NULL;  /* input only */
+  /* Flow X [0] dependency [0] from memory A */
+  if( NULL == (chunk = this_task->data._f_X.data_in) ) {
+  /* No data set up by predecessor on this task input flow */
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+  parsec_prof_grapher_data_input(data_of_A(m, n), (parsec_task_t*)this_task, &flow_of_udf_UD_MAKE_KEY_for_X, 1);
+#endif
+    chunk = parsec_data_get_copy(data_of_A(m, n), target_device);
+    data.data = chunk;
+    data.data_future  = NULL;
+        data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.data_future   = NULL;
+    if( (ret = parsec_get_copy_reshape_from_desc(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    this_task->data._f_X.data_out = chunk;
+    PARSEC_OBJ_RETAIN(chunk);
+  } 
+    this_task->data._f_X.data_in     = chunk;
+    this_task->data._f_X.source_repo       = consumed_repo;
+    this_task->data._f_X.source_repo_entry = consumed_entry;
+    this_task->data._f_X.fulfill = 1;
+}
+
+  /** Generate profiling information */
+#if defined(PARSEC_PROF_TRACE)
+  this_task->prof_info.desc = (parsec_data_collection_t*)__parsec_tp->super._g_A;
+  this_task->prof_info.priority = this_task->priority;
+  this_task->prof_info.data_id   = ((parsec_data_collection_t*)__parsec_tp->super._g_A)->data_key((parsec_data_collection_t*)__parsec_tp->super._g_A, m, n);
+  this_task->prof_info.task_class_id = this_task->task_class->task_class_id;
+  this_task->prof_info.task_return_code = -1;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int datatype_lookup_of_udf_UD_MAKE_KEY(parsec_execution_stream_t *es, const parsec_task_t *this_generic_task, const parsec_task_t *parent_task,
+              uint32_t* flow_mask, parsec_dep_data_description_t* data)
+{
+  const __parsec_udf_UD_MAKE_KEY_task_t *this_task = (__parsec_udf_UD_MAKE_KEY_task_t*)this_generic_task;
+  const __parsec_udf_internal_taskpool_t *__parsec_tp = (__parsec_udf_internal_taskpool_t *)this_task->taskpool;
+  (void)__parsec_tp; (void)es; (void)this_task; (void)data; (void)parent_task;
+  const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+  data->local.arena = data->remote.arena = NULL;
+  data->local.src_datatype  = data->local.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->local.src_count     = data->local.dst_count = 0;
+  data->local.src_displ     = data->local.dst_displ = 0;
+  data->data_future  = NULL;
+  if( (*flow_mask) & 0x80000000U ) { /* these are the input dependencies remote datatypes  */
+if( (*flow_mask) & 0x1U ) {  /* Flow X */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_udf_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_udf_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_udf_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+    goto no_mask_match;
+  }
+
+  /* these are the output dependencies remote datatypes */
+ no_mask_match:
+  data->data                             = NULL;
+  data->remote.src_datatype = data->remote.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->remote.src_count    = data->remote.dst_count = 0;
+  data->remote.src_displ    = data->remote.dst_displ = 0;
+  data->data_future  = NULL;
+  (*flow_mask) = 0;  /* nothing left */
+  (void)m;  (void)n;
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+static int hook_of_udf_UD_MAKE_KEY(parsec_execution_stream_t *es, __parsec_udf_UD_MAKE_KEY_task_t *this_task)
+{
+  __parsec_udf_internal_taskpool_t *__parsec_tp = (__parsec_udf_internal_taskpool_t *)this_task->taskpool;
+  (void)es; (void)__parsec_tp;
+  const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+  (void)m;  (void)n;
+
+  /** Declare the variables that will hold the data, and all the accounting for each */
+  parsec_data_copy_t *_f_X = this_task->data._f_X.data_in;
+  void *X = PARSEC_DATA_COPY_GET_PTR(_f_X); (void)X;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    data_repo_entry_t *eX = this_task->data._f_X.source_repo_entry;
+    if( (NULL != eX) && (eX->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eX->sim_exec_date;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+  /** Cache Awareness Accounting */
+#if defined(PARSEC_CACHE_AWARENESS)
+  cache_buf_referenced(es->closest_cache, X);
+#endif /* PARSEC_CACHE_AWARENESS */
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                                UD_MAKE_KEY BODY                                -----*/
+
+{
+    /* Nothing */
+}
+
+/*-----                            END OF UD_MAKE_KEY BODY                            -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#endif  /*  defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+static int complete_hook_of_udf_UD_MAKE_KEY(parsec_execution_stream_t *es, __parsec_udf_UD_MAKE_KEY_task_t *this_task)
+{
+  const __parsec_udf_internal_taskpool_t *__parsec_tp = (__parsec_udf_internal_taskpool_t *)this_task->taskpool;
+#if defined(DISTRIBUTED)
+    const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+#endif  /* defined(DISTRIBUTED) */
+  (void)es; (void)__parsec_tp;
+parsec_data_t* data_t_desc = NULL; (void)data_t_desc;
+#if defined(DISTRIBUTED)
+  /** If not working on distributed, there is no risk that data is not in place */
+  (void)m;  (void)n;
+
+#endif /* DISTRIBUTED */
+#if defined(PARSEC_PROF_GRAPHER)
+  parsec_prof_grapher_task((parsec_task_t*)this_task, es->th_id, es->virtual_process->vp_id,
+     __jdf2c_key_fns_UD_MAKE_KEY.key_hash(this_task->task_class->make_key( (parsec_taskpool_t*)this_task->taskpool, ((parsec_task_t*)this_task)->locals), NULL));
+#endif  /* defined(PARSEC_PROF_GRAPHER) */
+  release_deps_of_udf_UD_MAKE_KEY(es, this_task,
+      PARSEC_ACTION_RELEASE_REMOTE_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_REFS |
+      PARSEC_ACTION_RESHAPE_ON_RELEASE |
+      0x0,  /* mask of all dep_index */ 
+      NULL);
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static parsec_hook_return_t release_task_of_udf_UD_MAKE_KEY(parsec_execution_stream_t *es, parsec_task_t *this_task)
+{
+    const __parsec_udf_internal_taskpool_t *__parsec_tp =
+        (const __parsec_udf_internal_taskpool_t *)this_task->taskpool;
+    parsec_hash_table_t *ht = (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[1];
+    parsec_key_t key = this_task->task_class->make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals);
+    parsec_hashable_dependency_t *hash_dep = (parsec_hashable_dependency_t *)parsec_hash_table_remove(ht, key);
+    parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);
+    if( (PARSEC_UNDETERMINED_NB_TASKS == __parsec_tp->super.super.nb_tasks) ||
+        (0 == __parsec_tp->super.super.nb_tasks) ||
+        (PARSEC_RUNTIME_RESERVED_NB_TASKS == __parsec_tp->super.super.nb_tasks) ) {
+        /* don't spend time counting */
+        return parsec_release_task_to_mempool(es, this_task);
+    }
+    return parsec_release_task_to_mempool_update_nbtasks(es, this_task);
+}
+
+static char *udf_udf_UD_MAKE_KEY_internal_init_deps_key_functions_key_print(char *buffer, size_t buffer_size, parsec_key_t k, void *user_data)
+{
+  (void)user_data;
+  snprintf(buffer, buffer_size, "(%llu)", (unsigned long long int)k);
+  return buffer;
+}
+
+static parsec_key_fn_t udf_udf_UD_MAKE_KEY_internal_init_deps_key_functions = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = udf_udf_UD_MAKE_KEY_internal_init_deps_key_functions_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/* Needs: - - - */
+static int udf_UD_MAKE_KEY_internal_init(parsec_execution_stream_t * es, __parsec_udf_UD_MAKE_KEY_task_t * this_task)
+{
+  __parsec_udf_internal_taskpool_t *__parsec_tp = (__parsec_udf_internal_taskpool_t*)this_task->taskpool;
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+  PARSEC_PROFILING_TRACE(es->es_profile,
+                         this_task->taskpool->profiling_array[START_KEY(this_task->task_class->task_class_id)],
+                         0,
+                         this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    do {
+      this_task->super.list_next = (parsec_list_item_t*)__parsec_tp->startup_queue;
+    } while(!parsec_atomic_cas_ptr(&__parsec_tp->startup_queue, (parsec_list_item_t*)this_task->super.list_next, this_task));
+    this_task->status = PARSEC_TASK_STATUS_HOOK;
+
+  PARSEC_AYU_REGISTER_TASK(&udf_UD_MAKE_KEY);
+  __parsec_tp->super.super.dependencies_array[1] = PARSEC_OBJ_NEW(parsec_hash_table_t);
+  parsec_hash_table_init(__parsec_tp->super.super.dependencies_array[1], offsetof(parsec_hashable_dependency_t, ht_item), 10, udf_udf_UD_MAKE_KEY_internal_init_deps_key_functions, this_task->taskpool);
+  __parsec_tp->repositories[1] = data_repo_create_nothreadsafe(PARSEC_DEFAULT_DATAREPO_HASH_LENGTH, __jdf2c_key_fns_UD_MAKE_KEY, (parsec_taskpool_t*)__parsec_tp, 1);
+   (void)__parsec_tp; (void)es;
+  if(1 == parsec_atomic_fetch_dec_int32(&__parsec_tp->sync_point)) {
+    /* Last initialization task complete. Update the number of tasks. */
+    __parsec_tp->super.super.tdm.module->taskpool_addto_nb_tasks(&__parsec_tp->super.super, ud_nbtasks_nb_local_tasks(__parsec_tp));
+    parsec_mfence();  /* write memory barrier to guarantee that the scheduler gets the correct number of tasks */
+    parsec_taskpool_enable((parsec_taskpool_t*)__parsec_tp, &__parsec_tp->startup_queue,
+                           (parsec_task_t*)this_task, es, __parsec_tp->super.super.nb_pending_actions);
+    __parsec_tp->super.super.tdm.module->taskpool_ready(&__parsec_tp->super.super);
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+    PARSEC_PROFILING_TRACE(es->es_profile,
+                           this_task->taskpool->profiling_array[2 * this_task->task_class->task_class_id + 1],
+                           0,
+                           this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    if( 1 >= __parsec_tp->super.super.nb_pending_actions ) {
+        /* if no tasks will be generated let's prevent the runtime from calling the hook and instead go directly to complete the task */
+        this_task->status = PARSEC_TASK_STATUS_COMPLETE;
+    }
+    return PARSEC_HOOK_RETURN_DONE;
+  }
+  return PARSEC_HOOK_RETURN_ASYNC;
+}
+
+static int __jdf2c_startup_UD_MAKE_KEY(parsec_execution_stream_t * es, __parsec_udf_UD_MAKE_KEY_task_t *this_task)
+{
+  __parsec_udf_UD_MAKE_KEY_task_t* new_task;
+  __parsec_udf_internal_taskpool_t* __parsec_tp = (__parsec_udf_internal_taskpool_t*)this_task->taskpool;
+  parsec_context_t *context = __parsec_tp->super.super.context;
+  int vpid = 0, nb_tasks = 0;
+  size_t total_nb_tasks = 0;
+  parsec_list_item_t* pready_ring[context->nb_vp];
+  int restore_context = 0;
+  int m = this_task->locals.m.value;  /* retrieve value saved during the last iteration */
+  int n = this_task->locals.n.value;  /* retrieve value saved during the last iteration */
+  for(int _i = 0; _i < context->nb_vp; pready_ring[_i++] = NULL );
+  if( 0 != this_task->locals.reserved[0].value ) {
+    this_task->locals.reserved[0].value = 1; /* reset the submission process */
+    restore_context = 1;
+    goto restore_context_0;
+  }
+  this_task->locals.reserved[0].value = 1; /* a sane default value */
+  for(this_task->locals.m.value = m = 0;
+      this_task->locals.m.value <= (A->super.mt - 1);
+      this_task->locals.m.value += udf_UD_MAKE_KEY_inline_c_expr9_line_61(__parsec_tp, &this_task->locals), m = this_task->locals.m.value) {
+    for(this_task->locals.n.value = n = 0;
+        this_task->locals.n.value <= (A->super.nt - 1);
+        this_task->locals.n.value += udf_UD_MAKE_KEY_inline_c_expr8_line_62(__parsec_tp, &this_task->locals), n = this_task->locals.n.value) {
+      if( !UD_MAKE_KEY_pred(m, n) ) continue;
+  __parsec_udf_UD_MAKE_KEY_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_udf_UD_MAKE_KEY_parsec_assignment_t*)&this_task->locals;
+  (void)__jdf2c__tmp_locals;
+  /* Flow for X is always a memory reference */
+      if( NULL != ((parsec_data_collection_t*)__parsec_tp->super._g_A)->vpid_of ) {
+        vpid = ((parsec_data_collection_t*)__parsec_tp->super._g_A)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_A, m, n);
+        assert(context->nb_vp >= vpid);
+      } else {
+        vpid = (vpid + 1) % context->nb_vp;  /* spread the initial joy */
+      }
+      new_task = (__parsec_udf_UD_MAKE_KEY_task_t*)parsec_thread_mempool_allocate( context->virtual_processes[vpid]->execution_streams[0]->context_mempool );
+      PARSEC_OBJ_CONSTRUCT(new_task, parsec_task_t); /* construct called only when new, force-construct it again */
+      /* Copy only the valid elements from this_task to new_task one */
+      new_task->taskpool   = this_task->taskpool;
+      new_task->task_class = __parsec_tp->super.super.task_classes_array[udf_UD_MAKE_KEY.task_class_id];
+      new_task->chore_mask   = PARSEC_DEV_ALL;
+      new_task->locals.m.value = this_task->locals.m.value;
+      new_task->locals.n.value = this_task->locals.n.value;
+      PARSEC_LIST_ITEM_SINGLETON(new_task);
+      new_task->priority = __parsec_tp->super.super.priority;
+      new_task->repo_entry = NULL;
+      new_task->data._f_X.source_repo_entry = NULL;
+      new_task->data._f_X.source_repo       = NULL;
+      new_task->data._f_X.data_in         = NULL;
+      new_task->data._f_X.data_out        = NULL;
+      new_task->data._f_X.fulfill         = 0;
+#if defined(PARSEC_DEBUG_NOISIER)
+      {
+        char tmp[128];
+        PARSEC_DEBUG_VERBOSE(10, parsec_debug_output, "Add startup task %s to vpid %d",
+               parsec_task_snprintf(tmp, 128, (parsec_task_t*)new_task), vpid);
+      }
+#endif
+      parsec_dependencies_mark_task_as_startup((parsec_task_t*)new_task, es);
+      pready_ring[vpid] = parsec_list_item_ring_push_sorted(pready_ring[vpid],
+                                                            (parsec_list_item_t*)new_task,
+                                                            parsec_execution_context_priority_comparator);
+      nb_tasks++;
+     restore_context_0:  /* we jump here just so that we have code after the label */
+      restore_context = 0;
+      (void)restore_context;
+      if( nb_tasks > this_task->locals.reserved[0].value ) {
+        if( (size_t)this_task->locals.reserved[0].value < parsec_task_startup_iter ) this_task->locals.reserved[0].value <<= 1;
+        __parsec_schedule_vp(es, (parsec_task_t**)pready_ring, 0);
+        total_nb_tasks += nb_tasks;
+        nb_tasks = 0;
+        if( total_nb_tasks > parsec_task_startup_chunk ) {  /* stop here and request to be rescheduled */
+          return PARSEC_HOOK_RETURN_AGAIN;
+        }
+      }
+    } /* Loop on normal range n */
+  } /* Loop on normal range m */
+  (void)vpid;
+  if( 0 != nb_tasks ) {
+    __parsec_schedule_vp(es, (parsec_task_t**)pready_ring, 0);
+    nb_tasks = 0;
+  }
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static const __parsec_chore_t __udf_UD_MAKE_KEY_chores[] ={
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+    { .type     = PARSEC_DEV_CPU,
+      .evaluate = (parsec_evaluate_function_t*)NULL,
+      .hook     = (parsec_hook_t*)hook_of_udf_UD_MAKE_KEY },
+#endif  /* defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+    { .type     = PARSEC_DEV_NONE,
+      .evaluate = NULL,
+      .hook     = (parsec_hook_t*)NULL },  /* End marker */
+};
+
+static const parsec_task_class_t udf_UD_MAKE_KEY = {
+  .name = "UD_MAKE_KEY",
+  .task_class_id = 1,
+  .nb_flows = 1,
+  .nb_parameters = 2,
+  .nb_locals = 2,
+  .task_class_type = PARSEC_TASK_CLASS_TYPE_PTG,
+  .params = { &symb_udf_UD_MAKE_KEY_m, &symb_udf_UD_MAKE_KEY_n, NULL },
+  .locals = { &symb_udf_UD_MAKE_KEY_m, &symb_udf_UD_MAKE_KEY_n, NULL },
+  .data_affinity = (parsec_data_ref_fn_t*)affinity_of_udf_UD_MAKE_KEY,
+  .initial_data = (parsec_data_ref_fn_t*)affinity_of_udf_UD_MAKE_KEY,
+  .final_data = (parsec_data_ref_fn_t*)affinity_of_udf_UD_MAKE_KEY,
+  .priority = NULL,
+  .properties = properties_of_udf_UD_MAKE_KEY,
+#if MAX_PARAM_COUNT < 1  /* number of read flows of UD_MAKE_KEY */
+  #error Too many read flows for task UD_MAKE_KEY
+#endif  /* MAX_PARAM_COUNT */
+#if MAX_PARAM_COUNT < 0  /* number of write flows of UD_MAKE_KEY */
+  #error Too many write flows for task UD_MAKE_KEY
+#endif  /* MAX_PARAM_COUNT */
+  .in = { &flow_of_udf_UD_MAKE_KEY_for_X, NULL },
+  .out = { NULL },
+  .flags = 0x0 | PARSEC_HAS_IN_IN_DEPENDENCIES | PARSEC_USE_DEPS_MASK,
+  .dependencies_goal = 0x1,
+  .make_key = ud_make_key,
+  .task_snprintf = parsec_task_snprintf,
+#if defined(PARSEC_PROF_TRACE)
+  .profile_info = &parsec_task_profile_info,
+#endif
+  .key_functions = &__jdf2c_key_fns_UD_MAKE_KEY,
+  .fini = (parsec_hook_t*)NULL,
+  .incarnations = __udf_UD_MAKE_KEY_chores,
+  .find_deps = parsec_hash_find_deps,
+  .update_deps = parsec_update_deps_with_mask,
+  .iterate_successors = (parsec_traverse_function_t*)NULL,
+  .iterate_predecessors = (parsec_traverse_function_t*)NULL,
+  .release_deps = (parsec_release_deps_t*)release_deps_of_udf_UD_MAKE_KEY,
+  .prepare_output = (parsec_hook_t*)NULL,
+  .prepare_input = (parsec_hook_t*)data_lookup_of_udf_UD_MAKE_KEY,
+  .time_estimate = NULL,
+  .get_datatype = datatype_lookup_of_udf_UD_MAKE_KEY,
+  .complete_execution = (parsec_hook_t*)complete_hook_of_udf_UD_MAKE_KEY,
+  .release_task = &release_task_of_udf_UD_MAKE_KEY,
+#if defined(PARSEC_SIM)
+  .sim_cost_fct = (parsec_sim_cost_fct_t*)NULL,
+#endif
+};
+
+
+/******                                      NOUD                                      ******/
+
+static inline int32_t minexpr_of_symb_udf_NOUD_m_fct(const __parsec_udf_internal_taskpool_t *__parsec_tp, const __parsec_udf_NOUD_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_udf_NOUD_m = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_udf_NOUD_m_fct }
+                   }
+};
+static inline int maxexpr_of_symb_udf_NOUD_m_fct(const __parsec_udf_internal_taskpool_t *__parsec_tp, const __parsec_udf_NOUD_parsec_assignment_t *locals)
+{
+  const int m = locals->m.value; (void)m;
+  const int n = locals->n.value; (void)n;
+
+  (void)m;
+  (void)n;
+  (void)__parsec_tp; (void)locals;
+  return (A->super.mt - 1);
+}
+static const parsec_expr_t maxexpr_of_symb_udf_NOUD_m = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_udf_NOUD_m_fct }
+                   }
+};
+static inline int32_t incexpr_of_symb_udf_NOUD_m_fct(const __parsec_udf_internal_taskpool_t *__parsec_tp, const __parsec_udf_NOUD_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return udf_NOUD_inline_c_expr11_line_47(__parsec_tp, locals);
+}
+static const parsec_expr_t incexpr_of_symb_udf_NOUD_m = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)incexpr_of_symb_udf_NOUD_m_fct }
+                   }
+};
+static const parsec_symbol_t symb_udf_NOUD_m = { .name = "m", .context_index = 0, .min = &minexpr_of_symb_udf_NOUD_m, .max = &maxexpr_of_symb_udf_NOUD_m, .cst_inc = 0, .expr_inc = &incexpr_of_symb_udf_NOUD_m,  .flags = 0x0};
+
+static inline int32_t minexpr_of_symb_udf_NOUD_n_fct(const __parsec_udf_internal_taskpool_t *__parsec_tp, const __parsec_udf_NOUD_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_udf_NOUD_n = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_udf_NOUD_n_fct }
+                   }
+};
+static inline int maxexpr_of_symb_udf_NOUD_n_fct(const __parsec_udf_internal_taskpool_t *__parsec_tp, const __parsec_udf_NOUD_parsec_assignment_t *locals)
+{
+  const int m = locals->m.value; (void)m;
+  const int n = locals->n.value; (void)n;
+
+  (void)m;
+  (void)n;
+  (void)__parsec_tp; (void)locals;
+  return (A->super.nt - 1);
+}
+static const parsec_expr_t maxexpr_of_symb_udf_NOUD_n = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_udf_NOUD_n_fct }
+                   }
+};
+static inline int32_t incexpr_of_symb_udf_NOUD_n_fct(const __parsec_udf_internal_taskpool_t *__parsec_tp, const __parsec_udf_NOUD_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return udf_NOUD_inline_c_expr10_line_48(__parsec_tp, locals);
+}
+static const parsec_expr_t incexpr_of_symb_udf_NOUD_n = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)incexpr_of_symb_udf_NOUD_n_fct }
+                   }
+};
+static const parsec_symbol_t symb_udf_NOUD_n = { .name = "n", .context_index = 1, .min = &minexpr_of_symb_udf_NOUD_n, .max = &maxexpr_of_symb_udf_NOUD_n, .cst_inc = 0, .expr_inc = &incexpr_of_symb_udf_NOUD_n,  .flags = 0x0};
+
+static inline int affinity_of_udf_NOUD(const __parsec_udf_NOUD_task_t *this_task,
+                     parsec_data_ref_t *ref)
+{
+    const __parsec_udf_internal_taskpool_t *__parsec_tp = (const __parsec_udf_internal_taskpool_t*)this_task->taskpool;
+  const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+
+  /* Silent Warnings: should look into predicate to know what variables are usefull */
+  (void)m;
+  (void)n;
+  ref->dc = (parsec_data_collection_t *)__parsec_tp->super._g_A;
+  /* Compute data key */
+  ref->key = ref->dc->data_key(ref->dc, m, n);
+  return 1;
+}
+static const parsec_property_t properties_of_udf_NOUD[1] = {
+  {.name = NULL, .expr = NULL}
+};
+static parsec_data_t *flow_of_udf_NOUD_for_X_dep1_atline_52_direct_access(const __parsec_udf_internal_taskpool_t *__parsec_tp, const __parsec_udf_NOUD_parsec_assignment_t *assignments)
+{
+  const int m = assignments->m.value; (void)m;
+  const int n = assignments->n.value; (void)n;
+
+  /* Silence Warnings: should look into parameters to know what variables are useful */
+  (void)m;
+  (void)n;
+  if( __parsec_tp->super.super.context->my_rank == (int32_t)rank_of_A(m, n) )
+    return data_of_A(m, n);
+  return NULL;
+}
+
+static const parsec_dep_t flow_of_udf_NOUD_for_X_dep1_atline_52 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = PARSEC_LOCAL_DATA_TASK_CLASS_ID, /* udf_A */
+  .direct_data = (parsec_data_lookup_func_t)&flow_of_udf_NOUD_for_X_dep1_atline_52_direct_access,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_udf_NOUD_for_X,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_udf_NOUD_for_X = {
+  .name               = "X",
+  .sym_type           = PARSEC_SYM_IN,
+  .flow_flags         = PARSEC_FLOW_ACCESS_READ|PARSEC_FLOW_HAS_IN_DEPS,
+  .flow_index         = 0,
+  .flow_datatype_mask = 0x0,
+  .dep_in     = { &flow_of_udf_NOUD_for_X_dep1_atline_52 },
+  .dep_out    = { NULL }
+};
+
+static int release_deps_of_udf_NOUD(parsec_execution_stream_t *es, __parsec_udf_NOUD_task_t *this_task, uint32_t action_mask, parsec_remote_deps_t *deps)
+{
+  PARSEC_PINS(es, RELEASE_DEPS_BEGIN, (parsec_task_t *)this_task);  const __parsec_udf_internal_taskpool_t *__parsec_tp = (const __parsec_udf_internal_taskpool_t *)this_task->taskpool;
+  parsec_release_dep_fct_arg_t arg;
+  int __vp_id;
+  int consume_local_repo = 0;
+  arg.action_mask = action_mask;
+  arg.output_entry = NULL;
+  arg.output_repo = NULL;
+#if defined(DISTRIBUTED)
+  arg.remote_deps = deps;
+#endif  /* defined(DISTRIBUTED) */
+  assert(NULL != es);
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS )    arg.ready_lists = alloca(sizeof(parsec_task_t *) * es->virtual_process->parsec_context->nb_vp);
+  else
+    arg.ready_lists = NULL;
+  for( __vp_id = 0; __vp_id < es->virtual_process->parsec_context->nb_vp; arg.ready_lists[__vp_id++] = NULL );
+  (void)__parsec_tp; (void)deps;
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_X.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_X.source_repo, this_task->data._f_X.source_repo_entry->ht_item.key );
+    }
+  }
+  consume_local_repo = (this_task->repo_entry != NULL);
+  /* No successors, don't call iterate_successors and don't release any local deps */
+      if (consume_local_repo) {
+         data_repo_entry_used_once( NOUD_repo, this_task->repo_entry->ht_item.key );
+      }
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_X.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_X.data_in);
+    }
+  }
+  PARSEC_PINS(es, RELEASE_DEPS_END, (parsec_task_t *)this_task);  return 0;
+}
+
+static int data_lookup_of_udf_NOUD(parsec_execution_stream_t *es, __parsec_udf_NOUD_task_t *this_task)
+{
+  const __parsec_udf_internal_taskpool_t *__parsec_tp = (__parsec_udf_internal_taskpool_t *)this_task->taskpool;
+  parsec_assignment_t generic_locals[MAX_PARAM_COUNT];  /* generic task locals */
+  int target_device = 0; (void)target_device;
+  (void)__parsec_tp; (void)generic_locals; (void)es;
+  parsec_data_copy_t *chunk = NULL;
+  data_repo_t        *reshape_repo  = NULL, *consumed_repo  = NULL;
+  data_repo_entry_t  *reshape_entry = NULL, *consumed_entry = NULL;
+  parsec_key_t        reshape_entry_key = 0, consumed_entry_key = 0;
+  uint8_t             consumed_flow_index;
+  parsec_dep_data_description_t data;
+  int ret;
+  (void)reshape_repo; (void)reshape_entry; (void)reshape_entry_key;
+  (void)consumed_repo; (void)consumed_entry; (void)consumed_entry_key;
+  (void)consumed_flow_index;
+  (void)chunk; (void)data; (void)ret;
+  const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+  if( NULL == this_task->repo_entry ){
+    this_task->repo_entry = data_repo_lookup_entry_and_create(es, NOUD_repo,                                       __jdf2c_make_key_NOUD((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    data_repo_entry_addto_usage_limit(NOUD_repo, this_task->repo_entry->ht_item.key, 1);    this_task->repo_entry ->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(this_task->repo_entry ->sim_exec_date == 0);
+    this_task->repo_entry ->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  /* The reshape repo is the current task repo. */  reshape_repo = NOUD_repo;
+  reshape_entry_key = __jdf2c_make_key_NOUD((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals) ;
+  reshape_entry = this_task->repo_entry;
+  /* Lookup the input data, and store them in the context if any */
+
+if(! this_task->data._f_X.fulfill ){ /* Flow X */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_X.data_out = NULL;  /* input only */
+  /* Flow X [0] dependency [0] from memory A */
+  if( NULL == (chunk = this_task->data._f_X.data_in) ) {
+  /* No data set up by predecessor on this task input flow */
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+  parsec_prof_grapher_data_input(data_of_A(m, n), (parsec_task_t*)this_task, &flow_of_udf_NOUD_for_X, 1);
+#endif
+    chunk = parsec_data_get_copy(data_of_A(m, n), target_device);
+    data.data = chunk;
+    data.data_future  = NULL;
+        data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.data_future   = NULL;
+    if( (ret = parsec_get_copy_reshape_from_desc(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    this_task->data._f_X.data_out = chunk;
+    PARSEC_OBJ_RETAIN(chunk);
+  } 
+    this_task->data._f_X.data_in     = chunk;
+    this_task->data._f_X.source_repo       = consumed_repo;
+    this_task->data._f_X.source_repo_entry = consumed_entry;
+    this_task->data._f_X.fulfill = 1;
+}
+
+  /** Generate profiling information */
+#if defined(PARSEC_PROF_TRACE)
+  this_task->prof_info.desc = (parsec_data_collection_t*)__parsec_tp->super._g_A;
+  this_task->prof_info.priority = this_task->priority;
+  this_task->prof_info.data_id   = ((parsec_data_collection_t*)__parsec_tp->super._g_A)->data_key((parsec_data_collection_t*)__parsec_tp->super._g_A, m, n);
+  this_task->prof_info.task_class_id = this_task->task_class->task_class_id;
+  this_task->prof_info.task_return_code = -1;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int datatype_lookup_of_udf_NOUD(parsec_execution_stream_t *es, const parsec_task_t *this_generic_task, const parsec_task_t *parent_task,
+              uint32_t* flow_mask, parsec_dep_data_description_t* data)
+{
+  const __parsec_udf_NOUD_task_t *this_task = (__parsec_udf_NOUD_task_t*)this_generic_task;
+  const __parsec_udf_internal_taskpool_t *__parsec_tp = (__parsec_udf_internal_taskpool_t *)this_task->taskpool;
+  (void)__parsec_tp; (void)es; (void)this_task; (void)data; (void)parent_task;
+  const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+  data->local.arena = data->remote.arena = NULL;
+  data->local.src_datatype  = data->local.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->local.src_count     = data->local.dst_count = 0;
+  data->local.src_displ     = data->local.dst_displ = 0;
+  data->data_future  = NULL;
+  if( (*flow_mask) & 0x80000000U ) { /* these are the input dependencies remote datatypes  */
+if( (*flow_mask) & 0x1U ) {  /* Flow X */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_udf_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_udf_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_udf_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+    goto no_mask_match;
+  }
+
+  /* these are the output dependencies remote datatypes */
+ no_mask_match:
+  data->data                             = NULL;
+  data->remote.src_datatype = data->remote.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->remote.src_count    = data->remote.dst_count = 0;
+  data->remote.src_displ    = data->remote.dst_displ = 0;
+  data->data_future  = NULL;
+  (*flow_mask) = 0;  /* nothing left */
+  (void)m;  (void)n;
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+static int hook_of_udf_NOUD(parsec_execution_stream_t *es, __parsec_udf_NOUD_task_t *this_task)
+{
+  __parsec_udf_internal_taskpool_t *__parsec_tp = (__parsec_udf_internal_taskpool_t *)this_task->taskpool;
+  (void)es; (void)__parsec_tp;
+  const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+  (void)m;  (void)n;
+
+  /** Declare the variables that will hold the data, and all the accounting for each */
+  parsec_data_copy_t *_f_X = this_task->data._f_X.data_in;
+  void *X = PARSEC_DATA_COPY_GET_PTR(_f_X); (void)X;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    data_repo_entry_t *eX = this_task->data._f_X.source_repo_entry;
+    if( (NULL != eX) && (eX->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eX->sim_exec_date;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+  /** Cache Awareness Accounting */
+#if defined(PARSEC_CACHE_AWARENESS)
+  cache_buf_referenced(es->closest_cache, X);
+#endif /* PARSEC_CACHE_AWARENESS */
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                                  NOUD BODY                                    -----*/
+
+{
+    /* Nothing */
+}
+
+/*-----                                END OF NOUD BODY                                -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#endif  /*  defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+static int complete_hook_of_udf_NOUD(parsec_execution_stream_t *es, __parsec_udf_NOUD_task_t *this_task)
+{
+  const __parsec_udf_internal_taskpool_t *__parsec_tp = (__parsec_udf_internal_taskpool_t *)this_task->taskpool;
+#if defined(DISTRIBUTED)
+    const int m = this_task->locals.m.value; (void)m;
+  const int n = this_task->locals.n.value; (void)n;
+#endif  /* defined(DISTRIBUTED) */
+  (void)es; (void)__parsec_tp;
+parsec_data_t* data_t_desc = NULL; (void)data_t_desc;
+#if defined(DISTRIBUTED)
+  /** If not working on distributed, there is no risk that data is not in place */
+  (void)m;  (void)n;
+
+#endif /* DISTRIBUTED */
+#if defined(PARSEC_PROF_GRAPHER)
+  parsec_prof_grapher_task((parsec_task_t*)this_task, es->th_id, es->virtual_process->vp_id,
+     __jdf2c_key_fns_NOUD.key_hash(this_task->task_class->make_key( (parsec_taskpool_t*)this_task->taskpool, ((parsec_task_t*)this_task)->locals), NULL));
+#endif  /* defined(PARSEC_PROF_GRAPHER) */
+  release_deps_of_udf_NOUD(es, this_task,
+      PARSEC_ACTION_RELEASE_REMOTE_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_REFS |
+      PARSEC_ACTION_RESHAPE_ON_RELEASE |
+      0x0,  /* mask of all dep_index */ 
+      NULL);
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static parsec_hook_return_t release_task_of_udf_NOUD(parsec_execution_stream_t *es, parsec_task_t *this_task)
+{
+    const __parsec_udf_internal_taskpool_t *__parsec_tp =
+        (const __parsec_udf_internal_taskpool_t *)this_task->taskpool;
+    parsec_hash_table_t *ht = (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[0];
+    parsec_key_t key = this_task->task_class->make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals);
+    parsec_hashable_dependency_t *hash_dep = (parsec_hashable_dependency_t *)parsec_hash_table_remove(ht, key);
+    parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);
+    if( (PARSEC_UNDETERMINED_NB_TASKS == __parsec_tp->super.super.nb_tasks) ||
+        (0 == __parsec_tp->super.super.nb_tasks) ||
+        (PARSEC_RUNTIME_RESERVED_NB_TASKS == __parsec_tp->super.super.nb_tasks) ) {
+        /* don't spend time counting */
+        return parsec_release_task_to_mempool(es, this_task);
+    }
+    return parsec_release_task_to_mempool_update_nbtasks(es, this_task);
+}
+
+static char *udf_udf_NOUD_internal_init_deps_key_functions_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_udf_internal_taskpool_t *__parsec_tp = (__parsec_udf_internal_taskpool_t *)user_data;
+  int m = (__parsec_key) % __parsec_tp->NOUD_m_range + __parsec_tp->NOUD_m_min;
+  __parsec_key = __parsec_key / __parsec_tp->NOUD_m_range;
+  int n = (__parsec_key) % __parsec_tp->NOUD_n_range + __parsec_tp->NOUD_n_min;
+  __parsec_key = __parsec_key / __parsec_tp->NOUD_n_range;
+  snprintf(buffer, buffer_size, "NOUD(%d, %d)", m, n);
+  return buffer;
+}
+
+static parsec_key_fn_t udf_udf_NOUD_internal_init_deps_key_functions = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = udf_udf_NOUD_internal_init_deps_key_functions_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/* Needs: min-max - iterate */
+static int udf_NOUD_internal_init(parsec_execution_stream_t * es, __parsec_udf_NOUD_task_t * this_task)
+{
+  __parsec_udf_internal_taskpool_t *__parsec_tp = (__parsec_udf_internal_taskpool_t*)this_task->taskpool;
+int32_t __m_min = 0x7fffffff, __m_max = 0;int32_t __jdf2c_m_min = 0x7fffffff, __jdf2c_m_max = 0;int32_t __n_min = 0x7fffffff, __n_max = 0;int32_t __jdf2c_n_min = 0x7fffffff, __jdf2c_n_max = 0;  __parsec_udf_NOUD_parsec_assignment_t assignments = {  .m.value = 0, .n.value = 0 };
+  int32_t  m,  n;
+  int32_t __jdf2c_m_start, __jdf2c_m_end, __jdf2c_m_inc;
+  int32_t __jdf2c_n_start, __jdf2c_n_end, __jdf2c_n_inc;
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+  PARSEC_PROFILING_TRACE(es->es_profile,
+                         this_task->taskpool->profiling_array[START_KEY(this_task->task_class->task_class_id)],
+                         0,
+                         this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    __jdf2c_m_start = 0;
+    __jdf2c_m_end = (A->super.mt - 1);
+    __jdf2c_m_inc = udf_NOUD_inline_c_expr11_line_47(__parsec_tp, &assignments);
+    __m_min = parsec_imin(__jdf2c_m_start, __jdf2c_m_end);
+    __m_max = parsec_imax(__jdf2c_m_start, __jdf2c_m_end);
+    __jdf2c_m_min = parsec_imin(__jdf2c_m_min, __m_min);
+    __jdf2c_m_max = parsec_imax(__jdf2c_m_max, __m_max);
+    for(m =  __jdf2c_m_start;
+        (((__jdf2c_m_inc >= 0) && (m <= __jdf2c_m_end)) ||
+         ((__jdf2c_m_inc <  0) && (m >= __jdf2c_m_end)));
+        m += __jdf2c_m_inc) {
+    assignments.m.value = m;
+      __jdf2c_n_start = 0;
+      __jdf2c_n_end = (A->super.nt - 1);
+      __jdf2c_n_inc = udf_NOUD_inline_c_expr10_line_48(__parsec_tp, &assignments);
+      __n_min = parsec_imin(__jdf2c_n_start, __jdf2c_n_end);
+      __n_max = parsec_imax(__jdf2c_n_start, __jdf2c_n_end);
+      __jdf2c_n_min = parsec_imin(__jdf2c_n_min, __n_min);
+      __jdf2c_n_max = parsec_imax(__jdf2c_n_max, __n_max);
+      for(n =  __jdf2c_n_start;
+          (((__jdf2c_n_inc >= 0) && (n <= __jdf2c_n_end)) ||
+           ((__jdf2c_n_inc <  0) && (n >= __jdf2c_n_end)));
+          n += __jdf2c_n_inc) {
+      assignments.n.value = n;
+      if( !NOUD_pred(m, n) ) continue;
+    } /* Loop on normal range n */
+  } /* For loop of m */ 
+  /* Set the range variables for the collision-free hash-computation */
+  __parsec_tp->NOUD_m_min   = __jdf2c_m_min;
+  __parsec_tp->NOUD_m_range = (__jdf2c_m_max - __jdf2c_m_min) + 1;
+  __parsec_tp->NOUD_n_min   = __jdf2c_n_min;
+  __parsec_tp->NOUD_n_range = (__jdf2c_n_max - __jdf2c_n_min) + 1;
+    do {
+      this_task->super.list_next = (parsec_list_item_t*)__parsec_tp->startup_queue;
+    } while(!parsec_atomic_cas_ptr(&__parsec_tp->startup_queue, (parsec_list_item_t*)this_task->super.list_next, this_task));
+    this_task->status = PARSEC_TASK_STATUS_HOOK;
+
+  PARSEC_AYU_REGISTER_TASK(&udf_NOUD);
+  __parsec_tp->super.super.dependencies_array[0] = PARSEC_OBJ_NEW(parsec_hash_table_t);
+  parsec_hash_table_init(__parsec_tp->super.super.dependencies_array[0], offsetof(parsec_hashable_dependency_t, ht_item), 10, udf_udf_NOUD_internal_init_deps_key_functions, this_task->taskpool);
+  __parsec_tp->repositories[0] = data_repo_create_nothreadsafe(PARSEC_DEFAULT_DATAREPO_HASH_LENGTH, __jdf2c_key_fns_NOUD, (parsec_taskpool_t*)__parsec_tp, 1);
+(void)__m_min; (void)__m_max;(void)__n_min; (void)__n_max;  (void)__jdf2c_m_start; (void)__jdf2c_m_end; (void)__jdf2c_m_inc;  (void)__jdf2c_n_start; (void)__jdf2c_n_end; (void)__jdf2c_n_inc;  (void)assignments; (void)__parsec_tp; (void)es;
+  if(1 == parsec_atomic_fetch_dec_int32(&__parsec_tp->sync_point)) {
+    /* Last initialization task complete. Update the number of tasks. */
+    __parsec_tp->super.super.tdm.module->taskpool_addto_nb_tasks(&__parsec_tp->super.super, ud_nbtasks_nb_local_tasks(__parsec_tp));
+    parsec_mfence();  /* write memory barrier to guarantee that the scheduler gets the correct number of tasks */
+    parsec_taskpool_enable((parsec_taskpool_t*)__parsec_tp, &__parsec_tp->startup_queue,
+                           (parsec_task_t*)this_task, es, __parsec_tp->super.super.nb_pending_actions);
+    __parsec_tp->super.super.tdm.module->taskpool_ready(&__parsec_tp->super.super);
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+    PARSEC_PROFILING_TRACE(es->es_profile,
+                           this_task->taskpool->profiling_array[2 * this_task->task_class->task_class_id + 1],
+                           0,
+                           this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    if( 1 >= __parsec_tp->super.super.nb_pending_actions ) {
+        /* if no tasks will be generated let's prevent the runtime from calling the hook and instead go directly to complete the task */
+        this_task->status = PARSEC_TASK_STATUS_COMPLETE;
+    }
+    return PARSEC_HOOK_RETURN_DONE;
+  }
+  return PARSEC_HOOK_RETURN_ASYNC;
+}
+
+static int __jdf2c_startup_NOUD(parsec_execution_stream_t * es, __parsec_udf_NOUD_task_t *this_task)
+{
+  __parsec_udf_NOUD_task_t* new_task;
+  __parsec_udf_internal_taskpool_t* __parsec_tp = (__parsec_udf_internal_taskpool_t*)this_task->taskpool;
+  parsec_context_t *context = __parsec_tp->super.super.context;
+  int vpid = 0, nb_tasks = 0;
+  size_t total_nb_tasks = 0;
+  parsec_list_item_t* pready_ring[context->nb_vp];
+  int restore_context = 0;
+  int m = this_task->locals.m.value;  /* retrieve value saved during the last iteration */
+  int n = this_task->locals.n.value;  /* retrieve value saved during the last iteration */
+  for(int _i = 0; _i < context->nb_vp; pready_ring[_i++] = NULL );
+  if( 0 != this_task->locals.reserved[0].value ) {
+    this_task->locals.reserved[0].value = 1; /* reset the submission process */
+    restore_context = 1;
+    goto restore_context_0;
+  }
+  this_task->locals.reserved[0].value = 1; /* a sane default value */
+  for(this_task->locals.m.value = m = 0;
+      this_task->locals.m.value <= (A->super.mt - 1);
+      this_task->locals.m.value += udf_NOUD_inline_c_expr11_line_47(__parsec_tp, &this_task->locals), m = this_task->locals.m.value) {
+    for(this_task->locals.n.value = n = 0;
+        this_task->locals.n.value <= (A->super.nt - 1);
+        this_task->locals.n.value += udf_NOUD_inline_c_expr10_line_48(__parsec_tp, &this_task->locals), n = this_task->locals.n.value) {
+      if( !NOUD_pred(m, n) ) continue;
+  __parsec_udf_NOUD_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_udf_NOUD_parsec_assignment_t*)&this_task->locals;
+  (void)__jdf2c__tmp_locals;
+  /* Flow for X is always a memory reference */
+      if( NULL != ((parsec_data_collection_t*)__parsec_tp->super._g_A)->vpid_of ) {
+        vpid = ((parsec_data_collection_t*)__parsec_tp->super._g_A)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_A, m, n);
+        assert(context->nb_vp >= vpid);
+      } else {
+        vpid = (vpid + 1) % context->nb_vp;  /* spread the initial joy */
+      }
+      new_task = (__parsec_udf_NOUD_task_t*)parsec_thread_mempool_allocate( context->virtual_processes[vpid]->execution_streams[0]->context_mempool );
+      PARSEC_OBJ_CONSTRUCT(new_task, parsec_task_t); /* construct called only when new, force-construct it again */
+      /* Copy only the valid elements from this_task to new_task one */
+      new_task->taskpool   = this_task->taskpool;
+      new_task->task_class = __parsec_tp->super.super.task_classes_array[udf_NOUD.task_class_id];
+      new_task->chore_mask   = PARSEC_DEV_ALL;
+      new_task->locals.m.value = this_task->locals.m.value;
+      new_task->locals.n.value = this_task->locals.n.value;
+      PARSEC_LIST_ITEM_SINGLETON(new_task);
+      new_task->priority = __parsec_tp->super.super.priority;
+      new_task->repo_entry = NULL;
+      new_task->data._f_X.source_repo_entry = NULL;
+      new_task->data._f_X.source_repo       = NULL;
+      new_task->data._f_X.data_in         = NULL;
+      new_task->data._f_X.data_out        = NULL;
+      new_task->data._f_X.fulfill         = 0;
+#if defined(PARSEC_DEBUG_NOISIER)
+      {
+        char tmp[128];
+        PARSEC_DEBUG_VERBOSE(10, parsec_debug_output, "Add startup task %s to vpid %d",
+               parsec_task_snprintf(tmp, 128, (parsec_task_t*)new_task), vpid);
+      }
+#endif
+      parsec_dependencies_mark_task_as_startup((parsec_task_t*)new_task, es);
+      pready_ring[vpid] = parsec_list_item_ring_push_sorted(pready_ring[vpid],
+                                                            (parsec_list_item_t*)new_task,
+                                                            parsec_execution_context_priority_comparator);
+      nb_tasks++;
+     restore_context_0:  /* we jump here just so that we have code after the label */
+      restore_context = 0;
+      (void)restore_context;
+      if( nb_tasks > this_task->locals.reserved[0].value ) {
+        if( (size_t)this_task->locals.reserved[0].value < parsec_task_startup_iter ) this_task->locals.reserved[0].value <<= 1;
+        __parsec_schedule_vp(es, (parsec_task_t**)pready_ring, 0);
+        total_nb_tasks += nb_tasks;
+        nb_tasks = 0;
+        if( total_nb_tasks > parsec_task_startup_chunk ) {  /* stop here and request to be rescheduled */
+          return PARSEC_HOOK_RETURN_AGAIN;
+        }
+      }
+    } /* Loop on normal range n */
+  } /* Loop on normal range m */
+  (void)vpid;
+  if( 0 != nb_tasks ) {
+    __parsec_schedule_vp(es, (parsec_task_t**)pready_ring, 0);
+    nb_tasks = 0;
+  }
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static const __parsec_chore_t __udf_NOUD_chores[] ={
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+    { .type     = PARSEC_DEV_CPU,
+      .evaluate = (parsec_evaluate_function_t*)NULL,
+      .hook     = (parsec_hook_t*)hook_of_udf_NOUD },
+#endif  /* defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+    { .type     = PARSEC_DEV_NONE,
+      .evaluate = NULL,
+      .hook     = (parsec_hook_t*)NULL },  /* End marker */
+};
+
+static const parsec_task_class_t udf_NOUD = {
+  .name = "NOUD",
+  .task_class_id = 0,
+  .nb_flows = 1,
+  .nb_parameters = 2,
+  .nb_locals = 2,
+  .task_class_type = PARSEC_TASK_CLASS_TYPE_PTG,
+  .params = { &symb_udf_NOUD_m, &symb_udf_NOUD_n, NULL },
+  .locals = { &symb_udf_NOUD_m, &symb_udf_NOUD_n, NULL },
+  .data_affinity = (parsec_data_ref_fn_t*)affinity_of_udf_NOUD,
+  .initial_data = (parsec_data_ref_fn_t*)affinity_of_udf_NOUD,
+  .final_data = (parsec_data_ref_fn_t*)affinity_of_udf_NOUD,
+  .priority = NULL,
+  .properties = properties_of_udf_NOUD,
+#if MAX_PARAM_COUNT < 1  /* number of read flows of NOUD */
+  #error Too many read flows for task NOUD
+#endif  /* MAX_PARAM_COUNT */
+#if MAX_PARAM_COUNT < 0  /* number of write flows of NOUD */
+  #error Too many write flows for task NOUD
+#endif  /* MAX_PARAM_COUNT */
+  .in = { &flow_of_udf_NOUD_for_X, NULL },
+  .out = { NULL },
+  .flags = 0x0 | PARSEC_HAS_IN_IN_DEPENDENCIES | PARSEC_USE_DEPS_MASK,
+  .dependencies_goal = 0x1,
+  .make_key = __jdf2c_make_key_NOUD,
+  .task_snprintf = parsec_task_snprintf,
+#if defined(PARSEC_PROF_TRACE)
+  .profile_info = &parsec_task_profile_info,
+#endif
+  .key_functions = &__jdf2c_key_fns_NOUD,
+  .fini = (parsec_hook_t*)NULL,
+  .incarnations = __udf_NOUD_chores,
+  .find_deps = parsec_hash_find_deps,
+  .update_deps = parsec_update_deps_with_mask,
+  .iterate_successors = (parsec_traverse_function_t*)NULL,
+  .iterate_predecessors = (parsec_traverse_function_t*)NULL,
+  .release_deps = (parsec_release_deps_t*)release_deps_of_udf_NOUD,
+  .prepare_output = (parsec_hook_t*)NULL,
+  .prepare_input = (parsec_hook_t*)data_lookup_of_udf_NOUD,
+  .time_estimate = NULL,
+  .get_datatype = datatype_lookup_of_udf_NOUD,
+  .complete_execution = (parsec_hook_t*)complete_hook_of_udf_NOUD,
+  .release_task = &release_task_of_udf_NOUD,
+#if defined(PARSEC_SIM)
+  .sim_cost_fct = (parsec_sim_cost_fct_t*)NULL,
+#endif
+};
+
+
+static const parsec_task_class_t *udf_task_classes[] = {
+  &udf_NOUD,
+  &udf_UD_MAKE_KEY,
+  &udf_UD_STARTUP1,
+  &udf_UD_HASH_STRUCT,
+  &udf_UD_STARTUP2
+};
+
+static void udf_startup(parsec_context_t *context, __parsec_udf_internal_taskpool_t *__parsec_tp, parsec_list_item_t ** ready_tasks)
+{
+  uint32_t i, supported_dev = 0;
+ 
+  for( i = 0; i < parsec_nb_devices; i++ ) {
+    if( !(__parsec_tp->super.super.devices_index_mask & (1<<i)) ) continue;
+    parsec_device_module_t* device = parsec_mca_device_get(i);
+    parsec_data_collection_t* parsec_dc;
+ 
+    if(NULL == device) continue;
+    if(NULL != device->taskpool_register)
+      if( PARSEC_SUCCESS != device->taskpool_register(device, (parsec_taskpool_t*)__parsec_tp) ) {
+        parsec_debug_verbose(5, parsec_debug_output, "Device %s refused to register taskpool %p", device->name, __parsec_tp);
+        __parsec_tp->super.super.devices_index_mask &= ~(1 << device->device_index);
+        continue;
+      }
+    if(NULL != device->memory_register) {  /* Register all the data */
+      parsec_dc = (parsec_data_collection_t*)__parsec_tp->super._g_A;
+      if( (NULL != parsec_dc->register_memory) &&
+          (PARSEC_SUCCESS != parsec_dc->register_memory(parsec_dc, device)) ) {
+        parsec_debug_verbose(3, parsec_debug_output, "Device %s refused to register memory for data %s (%p) from taskpool %p",
+                     device->name, parsec_dc->key_base, parsec_dc, __parsec_tp);
+        __parsec_tp->super.super.devices_index_mask &= ~(1 << device->device_index);
+      }
+    }
+    supported_dev |= device->type;
+  }
+  /* Remove all the chores without a backend device */
+  for( i = 0; i < PARSEC_udf_NB_TASK_CLASSES; i++ ) {
+    parsec_task_class_t* tc = (parsec_task_class_t*)__parsec_tp->super.super.task_classes_array[i];
+    __parsec_chore_t* chores = (__parsec_chore_t*)tc->incarnations;
+    uint32_t idx = 0, j;
+    for( j = 0; PARSEC_DEV_NONE != chores[j].type; j++ ) {
+      if( !(supported_dev & chores[j].type) ) continue;
+      if( j != idx ) {
+        chores[idx] = chores[j];
+        parsec_debug_verbose(20, parsec_debug_output, "Device type %i disabled for function %s"
+, chores[j].type, tc->name);
+      }
+      idx++;
+    }
+    chores[idx].type     = PARSEC_DEV_NONE;
+    chores[idx].evaluate = NULL;
+    chores[idx].hook     = NULL;
+    /* Create the initialization tasks for each taskclass */
+    parsec_task_t* task = (parsec_task_t*)parsec_thread_mempool_allocate(context->virtual_processes[0]->execution_streams[0]->context_mempool);
+    PARSEC_OBJ_CONSTRUCT(task, parsec_task_t); /* construct called only when new, force-construct it again */
+    task->taskpool = (parsec_taskpool_t *)__parsec_tp;
+    task->chore_mask = PARSEC_DEV_CPU;
+    memset(&task->locals, 0, sizeof(parsec_assignment_t) * MAX_LOCAL_COUNT);
+    PARSEC_LIST_ITEM_SINGLETON(task);
+    task->priority = -1;
+    task->task_class = task->taskpool->task_classes_array[PARSEC_udf_NB_TASK_CLASSES + i];
+    int where = i % context->nb_vp;
+    if( NULL == ready_tasks[where] ) ready_tasks[where] = &task->super;
+    else ready_tasks[where] = parsec_list_item_ring_push(ready_tasks[where], &task->super);
+  }
+}
+static void __parsec_udf_internal_destructor( __parsec_udf_internal_taskpool_t *__parsec_tp )
+{
+  uint32_t i;
+  parsec_taskpool_unregister( &__parsec_tp->super.super );
+  if(NULL != __parsec_tp->super.super.tdm.module) __parsec_tp->super.super.tdm.module->unmonitor_taskpool(&__parsec_tp->super.super);
+  for( i = 0; i < (uint32_t)(2 * __parsec_tp->super.super.nb_task_classes); i++ ) {  /* Extra startup function added at the end */
+    parsec_task_class_t* tc = (parsec_task_class_t*)__parsec_tp->super.super.task_classes_array[i];
+    free((void*)tc->incarnations);
+    free(tc);
+  }
+  free(__parsec_tp->super.super.task_classes_array); __parsec_tp->super.super.task_classes_array = NULL;
+  __parsec_tp->super.super.nb_task_classes = 0;
+
+  for(i = 0; i < (uint32_t)__parsec_tp->super.arenas_datatypes_size; i++) {
+    if( NULL != __parsec_tp->super.arenas_datatypes[i].arena ) {
+      PARSEC_OBJ_RELEASE(__parsec_tp->super.arenas_datatypes[i].arena);
+    }
+  }
+  /* Destroy the data repositories for this object */
+   data_repo_destroy_nothreadsafe(__parsec_tp->repositories[4]);  /* UD_STARTUP2 */
+   data_repo_destroy_nothreadsafe(__parsec_tp->repositories[3]);  /* UD_HASH_STRUCT */
+   data_repo_destroy_nothreadsafe(__parsec_tp->repositories[2]);  /* UD_STARTUP1 */
+   data_repo_destroy_nothreadsafe(__parsec_tp->repositories[1]);  /* UD_MAKE_KEY */
+   data_repo_destroy_nothreadsafe(__parsec_tp->repositories[0]);  /* NOUD */
+  /* Release the dependencies arrays for this object */
+  parsec_hash_table_fini( (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[4] );
+  PARSEC_OBJ_RELEASE(__parsec_tp->super.super.dependencies_array[4]);
+  __parsec_tp->super.super.dependencies_array[4] = NULL;
+  parsec_hash_table_fini( (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[3] );
+  PARSEC_OBJ_RELEASE(__parsec_tp->super.super.dependencies_array[3]);
+  __parsec_tp->super.super.dependencies_array[3] = NULL;
+  parsec_hash_table_fini( (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[2] );
+  PARSEC_OBJ_RELEASE(__parsec_tp->super.super.dependencies_array[2]);
+  __parsec_tp->super.super.dependencies_array[2] = NULL;
+  parsec_hash_table_fini( (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[1] );
+  PARSEC_OBJ_RELEASE(__parsec_tp->super.super.dependencies_array[1]);
+  __parsec_tp->super.super.dependencies_array[1] = NULL;
+  parsec_hash_table_fini( (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[0] );
+  PARSEC_OBJ_RELEASE(__parsec_tp->super.super.dependencies_array[0]);
+  __parsec_tp->super.super.dependencies_array[0] = NULL;
+  free( __parsec_tp->super.super.dependencies_array );
+  __parsec_tp->super.super.dependencies_array = NULL;
+  /* Unregister all the data */
+  uint32_t _i;
+  for( _i = 0; _i < parsec_nb_devices; _i++ ) {
+    parsec_device_module_t* device;
+    parsec_data_collection_t* parsec_dc;
+    if(!(__parsec_tp->super.super.devices_index_mask & (1 << _i))) continue;
+    if((NULL == (device = parsec_mca_device_get(_i))) || (NULL == device->memory_unregister)) continue;
+    parsec_dc = (parsec_data_collection_t*)__parsec_tp->super._g_A;
+  if( NULL != parsec_dc->unregister_memory ) { (void)parsec_dc->unregister_memory(parsec_dc, device); };
+}
+  /* Unregister the taskpool from the devices */
+  for( i = 0; i < parsec_nb_devices; i++ ) {
+    if(!(__parsec_tp->super.super.devices_index_mask & (1 << i))) continue;
+    __parsec_tp->super.super.devices_index_mask ^= (1 << i);
+    parsec_device_module_t* device = parsec_mca_device_get(i);
+    if((NULL == device) || (NULL == device->taskpool_unregister)) continue;
+    if( PARSEC_SUCCESS != device->taskpool_unregister(device, &__parsec_tp->super.super) ) continue;
+  }
+  free(__parsec_tp->super.super.taskpool_name); __parsec_tp->super.super.taskpool_name = NULL;
+}
+
+void __parsec_udf_internal_constructor(__parsec_udf_internal_taskpool_t* __parsec_tp)
+{
+  parsec_task_class_t* tc;
+  uint32_t i, j;
+
+  __parsec_tp->super.super.nb_task_classes = PARSEC_udf_NB_TASK_CLASSES;
+  __parsec_tp->super.super.devices_index_mask = PARSEC_DEVICES_ALL;
+  __parsec_tp->super.super.taskpool_name = strdup("udf");
+  parsec_termdet_open_module(&__parsec_tp->super.super, "local");
+  __parsec_tp->super.super.tdm.module->monitor_taskpool(&__parsec_tp->super.super,
+                                                        parsec_taskpool_termination_detected);
+  __parsec_tp->super.super.update_nb_runtime_task = parsec_add_fetch_runtime_task;
+  __parsec_tp->super.super.dependencies_array = (void **)
+              calloc(__parsec_tp->super.super.nb_task_classes, sizeof(void*));
+  /* Twice the size to hold the startup tasks function_t */
+  __parsec_tp->super.super.task_classes_array = (const parsec_task_class_t**)
+              calloc((2 * PARSEC_udf_NB_TASK_CLASSES + 1), sizeof(parsec_task_class_t*));
+  __parsec_tp->super.super.tdm.module->taskpool_addto_runtime_actions(&__parsec_tp->super.super, PARSEC_udf_NB_TASK_CLASSES);  /* for the startup tasks */
+  __parsec_tp->super.super.taskpool_type = PARSEC_TASKPOOL_TYPE_PTG;
+  __parsec_tp->sync_point = __parsec_tp->super.super.nb_task_classes;
+  __parsec_tp->initial_number_tasks = 0;
+  __parsec_tp->startup_queue = NULL;
+  for( i = 0; i < __parsec_tp->super.super.nb_task_classes; i++ ) {
+    __parsec_tp->super.super.task_classes_array[i] = tc = malloc(sizeof(parsec_task_class_t));
+    memcpy(tc, udf_task_classes[i], sizeof(parsec_task_class_t));
+    for( j = 0; PARSEC_DEV_NONE != tc->incarnations[j].type; j++);  /* compute the number of incarnations */
+    tc->incarnations = (__parsec_chore_t*)malloc((j+1) * sizeof(__parsec_chore_t));
+        memcpy((__parsec_chore_t*)tc->incarnations, udf_task_classes[i]->incarnations, (j+1) * sizeof(__parsec_chore_t));
+
+    /* Add a placeholder for initialization and startup task */
+    __parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+i] = tc = (parsec_task_class_t*)malloc(sizeof(parsec_task_class_t));
+    memcpy(tc, (void*)&__parsec_generic_startup, sizeof(parsec_task_class_t));
+    tc->task_class_id = __parsec_tp->super.super.nb_task_classes + i;
+    tc->incarnations = (__parsec_chore_t*)malloc(2 * sizeof(__parsec_chore_t));
+    memcpy((__parsec_chore_t*)tc->incarnations, (void*)__parsec_generic_startup.incarnations, 2 * sizeof(__parsec_chore_t));
+    tc->release_task = parsec_release_task_to_mempool_and_count_as_runtime_tasks;
+  }
+  /* Startup task for UD_STARTUP2 */
+  tc = (parsec_task_class_t *)__parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+0];
+  tc->name = "Startup for UD_STARTUP2";
+  tc->prepare_input = (parsec_hook_t*)udf_UD_STARTUP2_internal_init;
+  ((__parsec_chore_t*)&tc->incarnations[0])->hook = (parsec_hook_t *)ud_startup2;
+  /* Startup task for UD_HASH_STRUCT */
+  tc = (parsec_task_class_t *)__parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+1];
+  tc->name = "Startup for UD_HASH_STRUCT";
+  tc->prepare_input = (parsec_hook_t*)udf_UD_HASH_STRUCT_internal_init;
+  ((__parsec_chore_t*)&tc->incarnations[0])->hook = (parsec_hook_t *)__jdf2c_startup_UD_HASH_STRUCT;
+  /* Startup task for UD_STARTUP1 */
+  tc = (parsec_task_class_t *)__parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+2];
+  tc->name = "Startup for UD_STARTUP1";
+  tc->prepare_input = (parsec_hook_t*)udf_UD_STARTUP1_internal_init;
+  ((__parsec_chore_t*)&tc->incarnations[0])->hook = (parsec_hook_t *)ud_startup1;
+  /* Startup task for UD_MAKE_KEY */
+  tc = (parsec_task_class_t *)__parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+3];
+  tc->name = "Startup for UD_MAKE_KEY";
+  tc->prepare_input = (parsec_hook_t*)udf_UD_MAKE_KEY_internal_init;
+  ((__parsec_chore_t*)&tc->incarnations[0])->hook = (parsec_hook_t *)__jdf2c_startup_UD_MAKE_KEY;
+  /* Startup task for NOUD */
+  tc = (parsec_task_class_t *)__parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+4];
+  tc->name = "Startup for NOUD";
+  tc->prepare_input = (parsec_hook_t*)udf_NOUD_internal_init;
+  ((__parsec_chore_t*)&tc->incarnations[0])->hook = (parsec_hook_t *)__jdf2c_startup_NOUD;
+  /* Compute the number of arenas_datatypes: */
+  /*   PARSEC_udf_DEFAULT_ARENA  ->  0 */
+  __parsec_tp->super.arenas_datatypes_size = 1;
+  memset(&__parsec_tp->super.arenas_datatypes[0], 0, __parsec_tp->super.arenas_datatypes_size*sizeof(parsec_arena_datatype_t));
+  /* If profiling is enabled, the keys for profiling */
+#  if defined(PARSEC_PROF_TRACE)
+  __parsec_tp->super.super.profiling_array = udf_profiling_array;
+  if( -2 == udf_profiling_array[0] ) {
+    #if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+parsec_profiling_add_dictionary_keyword("udf::UD_STARTUP2::internal init", "fill:34D8D8",
+                                       0,
+                                       NULL,
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(udf_UD_STARTUP2.task_class_id  + PARSEC_udf_NB_TASK_CLASSES)/* UD_STARTUP2 (internal init) start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(udf_UD_STARTUP2.task_class_id  + PARSEC_udf_NB_TASK_CLASSES)/* UD_STARTUP2 (internal init) end key */]);
+#endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+parsec_profiling_add_dictionary_keyword("udf::UD_STARTUP2", "fill:CC2828",
+                                       sizeof(parsec_task_prof_info_t)+2*sizeof(parsec_assignment_t),
+                                       "dc_key{uint64_t};priority{int32_t};dc_dataid{uint32_t};tcid{uint32_t};trc{int32_t};m{int32_t};n{int32_t}",
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(udf_UD_STARTUP2.task_class_id) /* UD_STARTUP2 start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(udf_UD_STARTUP2.task_class_id) /* UD_STARTUP2 end key */]);
+
+    #if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+parsec_profiling_add_dictionary_keyword("udf::UD_HASH_STRUCT::internal init", "fill:5534D8",
+                                       0,
+                                       NULL,
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(udf_UD_HASH_STRUCT.task_class_id  + PARSEC_udf_NB_TASK_CLASSES)/* UD_HASH_STRUCT (internal init) start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(udf_UD_HASH_STRUCT.task_class_id  + PARSEC_udf_NB_TASK_CLASSES)/* UD_HASH_STRUCT (internal init) end key */]);
+#endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+parsec_profiling_add_dictionary_keyword("udf::UD_HASH_STRUCT", "fill:ABCC28",
+                                       sizeof(parsec_task_prof_info_t)+2*sizeof(parsec_assignment_t),
+                                       "dc_key{uint64_t};priority{int32_t};dc_dataid{uint32_t};tcid{uint32_t};trc{int32_t};m{int32_t};n{int32_t}",
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(udf_UD_HASH_STRUCT.task_class_id) /* UD_HASH_STRUCT start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(udf_UD_HASH_STRUCT.task_class_id) /* UD_HASH_STRUCT end key */]);
+
+    #if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+parsec_profiling_add_dictionary_keyword("udf::UD_STARTUP1::internal init", "fill:D83496",
+                                       0,
+                                       NULL,
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(udf_UD_STARTUP1.task_class_id  + PARSEC_udf_NB_TASK_CLASSES)/* UD_STARTUP1 (internal init) start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(udf_UD_STARTUP1.task_class_id  + PARSEC_udf_NB_TASK_CLASSES)/* UD_STARTUP1 (internal init) end key */]);
+#endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+parsec_profiling_add_dictionary_keyword("udf::UD_STARTUP1", "fill:28CC6A",
+                                       sizeof(parsec_task_prof_info_t)+2*sizeof(parsec_assignment_t),
+                                       "dc_key{uint64_t};priority{int32_t};dc_dataid{uint32_t};tcid{uint32_t};trc{int32_t};m{int32_t};n{int32_t}",
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(udf_UD_STARTUP1.task_class_id) /* UD_STARTUP1 start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(udf_UD_STARTUP1.task_class_id) /* UD_STARTUP1 end key */]);
+
+    #if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+parsec_profiling_add_dictionary_keyword("udf::UD_MAKE_KEY::internal init", "fill:D89634",
+                                       0,
+                                       NULL,
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(udf_UD_MAKE_KEY.task_class_id  + PARSEC_udf_NB_TASK_CLASSES)/* UD_MAKE_KEY (internal init) start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(udf_UD_MAKE_KEY.task_class_id  + PARSEC_udf_NB_TASK_CLASSES)/* UD_MAKE_KEY (internal init) end key */]);
+#endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+parsec_profiling_add_dictionary_keyword("udf::UD_MAKE_KEY", "fill:286ACC",
+                                       sizeof(parsec_task_prof_info_t)+2*sizeof(parsec_assignment_t),
+                                       "dc_key{uint64_t};priority{int32_t};dc_dataid{uint32_t};tcid{uint32_t};trc{int32_t};m{int32_t};n{int32_t}",
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(udf_UD_MAKE_KEY.task_class_id) /* UD_MAKE_KEY start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(udf_UD_MAKE_KEY.task_class_id) /* UD_MAKE_KEY end key */]);
+
+    #if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+parsec_profiling_add_dictionary_keyword("udf::NOUD::internal init", "fill:55D834",
+                                       0,
+                                       NULL,
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(udf_NOUD.task_class_id  + PARSEC_udf_NB_TASK_CLASSES)/* NOUD (internal init) start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(udf_NOUD.task_class_id  + PARSEC_udf_NB_TASK_CLASSES)/* NOUD (internal init) end key */]);
+#endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+parsec_profiling_add_dictionary_keyword("udf::NOUD", "fill:AB28CC",
+                                       sizeof(parsec_task_prof_info_t)+2*sizeof(parsec_assignment_t),
+                                       "dc_key{uint64_t};priority{int32_t};dc_dataid{uint32_t};tcid{uint32_t};trc{int32_t};m{int32_t};n{int32_t}",
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(udf_NOUD.task_class_id) /* NOUD start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(udf_NOUD.task_class_id) /* NOUD end key */]);
+
+  }
+#  endif /* defined(PARSEC_PROF_TRACE) */
+  __parsec_tp->super.super.repo_array = __parsec_tp->repositories;
+  __parsec_tp->super.super.startup_hook = (parsec_startup_fn_t)udf_startup;
+  (void)parsec_taskpool_reserve_id((parsec_taskpool_t*)__parsec_tp);
+}
+
+  /** Generate class declaration and instance using the above constructor and destructor */
+  PARSEC_OBJ_CLASS_DECLARATION(__parsec_udf_internal_taskpool_t);
+  PARSEC_OBJ_CLASS_INSTANCE(__parsec_udf_internal_taskpool_t, parsec_udf_taskpool_t,
+                            __parsec_udf_internal_constructor, __parsec_udf_internal_destructor);
+
+#undef A
+#undef logger
+
+parsec_udf_taskpool_t *parsec_udf_new(parsec_matrix_block_cyclic_t * A /* data A */, udf_logger_fn_t logger)
+{
+  __parsec_udf_internal_taskpool_t *__parsec_tp = PARSEC_OBJ_NEW(__parsec_udf_internal_taskpool_t);
+  /* Dump the hidden parameters with default values */
+
+  /* Now the Parameter-dependent structures: */
+  __parsec_tp->super._g_A = A;
+  __parsec_tp->super._g_logger = logger;
+  PARSEC_AYU_REGISTER_TASK(&udf_UD_STARTUP2);
+  PARSEC_AYU_REGISTER_TASK(&udf_UD_HASH_STRUCT);
+  PARSEC_AYU_REGISTER_TASK(&udf_UD_STARTUP1);
+  PARSEC_AYU_REGISTER_TASK(&udf_UD_MAKE_KEY);
+  PARSEC_AYU_REGISTER_TASK(&udf_NOUD);
+  __parsec_tp->super.super.startup_hook = (parsec_startup_fn_t)udf_startup;
+  (void)parsec_taskpool_reserve_id((parsec_taskpool_t*)__parsec_tp);
+/* Prevent warnings related to not used hidden global variables */
+;
+  return (parsec_udf_taskpool_t*)__parsec_tp;
+}
+
+
+static int ud_nbtasks_nb_local_tasks(struct __parsec_udf_internal_taskpool_s *tp)
+{
+  parsec_udf_taskpool_t *utp = (parsec_udf_taskpool_t*)tp;
+  parsec_matrix_block_cyclic_t *a = utp->_g_A;
+  return a->super.nb_local_tiles * 5;
+}
+
+static parsec_key_t ud_make_key(const parsec_taskpool_t *tp, const parsec_assignment_t *locals)
+{
+  const __parsec_udf_internal_taskpool_t *__parsec_tp = (const __parsec_udf_internal_taskpool_t *) tp;
+  const __parsec_udf_UD_MAKE_KEY_parsec_assignment_t *l = (const __parsec_udf_UD_MAKE_KEY_parsec_assignment_t *) locals;
+  return l->m.value * __parsec_tp->super._g_A->super.nt + l->n.value;
+}
+
+static int ud_startup1(parsec_execution_stream_t * es, __parsec_udf_UD_STARTUP1_task_t * this_task)
+{
+  __parsec_udf_UD_STARTUP1_task_t *new_task;
+  __parsec_udf_internal_taskpool_t *__tp = (__parsec_udf_internal_taskpool_t *) this_task->taskpool;
+  parsec_context_t *context = __tp->super.super.context;
+  int i, j;
+
+  for(i = 0; i < __tp->super._g_A->super.mt; i++) {
+    for(j = 0; j < __tp->super._g_A->super.nt; j++) {
+      if( ((parsec_data_collection_t*)(__tp->super._g_A))->rank_of((parsec_data_collection_t*)__tp->super._g_A, i, j) !=
+          ((parsec_data_collection_t*)(__tp->super._g_A))->myrank)
+        continue;
+      new_task = (__parsec_udf_UD_STARTUP1_task_t *) parsec_thread_mempool_allocate(context->virtual_processes[0]->execution_streams[0]->context_mempool);
+      new_task->taskpool = this_task->taskpool;
+      new_task->task_class = __tp->super.super.task_classes_array[udf_UD_STARTUP1.task_class_id];
+      new_task->priority = 0;
+      new_task->status = PARSEC_TASK_STATUS_NONE;
+      new_task->repo_entry = NULL;
+      new_task->chore_mask = PARSEC_DEV_ALL;
+
+      new_task->locals.m.value = i;
+      new_task->locals.n.value = j;
+
+      new_task->data._f_X.source_repo = NULL;
+      new_task->data._f_X.source_repo_entry = NULL;
+      new_task->data._f_X.data_in = NULL;
+      new_task->data._f_X.data_out = NULL;
+
+      new_task->priority = 1;
+
+      PARSEC_LIST_ITEM_SINGLETON(new_task);
+      parsec_dependencies_mark_task_as_startup((parsec_task_t *) new_task, es);
+      __parsec_schedule(es, (parsec_task_t *)new_task, 0);
+    }
+  }
+  
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int ud_startup2(parsec_execution_stream_t * es, __parsec_udf_UD_STARTUP2_task_t * this_task)
+{
+  __parsec_udf_UD_STARTUP2_task_t *new_task;
+  __parsec_udf_internal_taskpool_t *__tp = (__parsec_udf_internal_taskpool_t *) this_task->taskpool;
+  parsec_context_t *context = __tp->super.super.context;
+  int i, j;
+
+  for(i = 0; i < __tp->super._g_A->super.mt; i++) {
+    for(j = 0; j < __tp->super._g_A->super.nt; j++) {
+      if( ((parsec_data_collection_t*)(__tp->super._g_A))->rank_of((parsec_data_collection_t*)__tp->super._g_A, i, j) !=
+          ((parsec_data_collection_t*)(__tp->super._g_A))->myrank)
+        continue;
+      new_task = (__parsec_udf_UD_STARTUP2_task_t *) parsec_thread_mempool_allocate(context->virtual_processes[0]->execution_streams[0]->context_mempool);
+      new_task->taskpool = this_task->taskpool;
+      new_task->task_class = __tp->super.super.task_classes_array[udf_UD_STARTUP2.task_class_id];
+      new_task->priority = 0;
+      new_task->status = PARSEC_TASK_STATUS_NONE;
+      new_task->repo_entry = NULL;
+      new_task->chore_mask = PARSEC_DEV_ALL;
+
+      new_task->locals.m.value = i;
+      new_task->locals.n.value = j;
+
+      new_task->data._f_X.source_repo = NULL;
+      new_task->data._f_X.source_repo_entry = NULL;
+      new_task->data._f_X.data_in = NULL;
+      new_task->data._f_X.data_out = NULL;
+
+      new_task->priority = 1;
+
+      PARSEC_LIST_ITEM_SINGLETON(new_task);
+      parsec_dependencies_mark_task_as_startup((parsec_task_t *) new_task, es);
+      __parsec_schedule(es, (parsec_task_t *)new_task, 0);
+    }
+  }
+  
+  return PARSEC_HOOK_RETURN_DONE;
+}
+ 
+static char *ud_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+    const __parsec_udf_internal_taskpool_t *__parsec_tp =
+        (const __parsec_udf_internal_taskpool_t *) user_data;
+    unsigned long long __parsec_key = (unsigned long long)__parsec_key_;
+    int m = __parsec_key / __parsec_tp->super._g_A->super.mt;
+    int n = __parsec_key % __parsec_tp->super._g_A->super.mt;
+    snprintf(buffer, buffer_size, "UD_HASH_STRUCT*(%d, %d)", m, n);
+    return buffer;
+}
+
+PARSEC_OBJ_CLASS_INSTANCE(parsec_udf_taskpool_t, parsec_taskpool_t, NULL, NULL);
+
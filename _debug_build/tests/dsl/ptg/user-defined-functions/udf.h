@@ -0,0 +1,180 @@
+#ifndef _udf_h_
+#define _udf_h_
+#include "parsec.h"
+#include "parsec/parsec_internal.h"
+#include "parsec/remote_dep.h"
+
+BEGIN_C_DECLS
+
+#define PARSEC_udf_DEFAULT_ADT_IDX    0
+#define PARSEC_udf_ADT_IDX_MAX       1
+typedef struct parsec_udf_taskpool_s {
+  parsec_taskpool_t super;
+  /* The list of globals */
+  parsec_matrix_block_cyclic_t * _g_A /* data A */;
+  udf_logger_fn_t _g_logger;
+  /* The array of datatypes (DEFAULT and co.) */
+  parsec_arena_datatype_t arenas_datatypes[PARSEC_udf_ADT_IDX_MAX];
+  uint32_t arenas_datatypes_size;
+} parsec_udf_taskpool_t;
+
+/** Beware that this object is not a superset of the internal object, and as a result
+ *  we should never create one directly. Instead we should rely on the creation of the
+ *  internal object (__parsec_udf_taskpool_t).
+ */
+PARSEC_OBJ_CLASS_DECLARATION(parsec_udf_taskpool_t);
+extern parsec_udf_taskpool_t *parsec_udf_new(parsec_matrix_block_cyclic_t * _g_A /* data A */, udf_logger_fn_t _g_logger);
+
+#if MAX_LOCAL_COUNT < 2  /* number of parameters and locals UD_STARTUP2 */
+  #error Too many parameters and local variables (2 out of MAX_LOCAL_COUNT) for task UD_STARTUP2
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_udf_UD_STARTUP2_assignment_s {
+  parsec_assignment_t m;
+  parsec_assignment_t n;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-2];
+} __parsec_udf_UD_STARTUP2_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 1  /* total number of flows for task UD_STARTUP2 */
+  #error Too many flows (1 out of MAX_PARAM_COUNT) for task UD_STARTUP2
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_udf_UD_STARTUP2_data_s {
+  parsec_data_pair_t _f_X;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-1];
+} __parsec_udf_UD_STARTUP2_data_t;
+
+typedef struct __parsec_udf_UD_STARTUP2_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_udf_UD_STARTUP2_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_udf_UD_STARTUP2_data_s data;
+} __parsec_udf_UD_STARTUP2_task_t;
+
+
+#if MAX_LOCAL_COUNT < 2  /* number of parameters and locals UD_HASH_STRUCT */
+  #error Too many parameters and local variables (2 out of MAX_LOCAL_COUNT) for task UD_HASH_STRUCT
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_udf_UD_HASH_STRUCT_assignment_s {
+  parsec_assignment_t m;
+  parsec_assignment_t n;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-2];
+} __parsec_udf_UD_HASH_STRUCT_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 1  /* total number of flows for task UD_HASH_STRUCT */
+  #error Too many flows (1 out of MAX_PARAM_COUNT) for task UD_HASH_STRUCT
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_udf_UD_HASH_STRUCT_data_s {
+  parsec_data_pair_t _f_X;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-1];
+} __parsec_udf_UD_HASH_STRUCT_data_t;
+
+typedef struct __parsec_udf_UD_HASH_STRUCT_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_udf_UD_HASH_STRUCT_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_udf_UD_HASH_STRUCT_data_s data;
+} __parsec_udf_UD_HASH_STRUCT_task_t;
+
+
+#if MAX_LOCAL_COUNT < 2  /* number of parameters and locals UD_STARTUP1 */
+  #error Too many parameters and local variables (2 out of MAX_LOCAL_COUNT) for task UD_STARTUP1
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_udf_UD_STARTUP1_assignment_s {
+  parsec_assignment_t m;
+  parsec_assignment_t n;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-2];
+} __parsec_udf_UD_STARTUP1_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 1  /* total number of flows for task UD_STARTUP1 */
+  #error Too many flows (1 out of MAX_PARAM_COUNT) for task UD_STARTUP1
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_udf_UD_STARTUP1_data_s {
+  parsec_data_pair_t _f_X;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-1];
+} __parsec_udf_UD_STARTUP1_data_t;
+
+typedef struct __parsec_udf_UD_STARTUP1_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_udf_UD_STARTUP1_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_udf_UD_STARTUP1_data_s data;
+} __parsec_udf_UD_STARTUP1_task_t;
+
+
+#if MAX_LOCAL_COUNT < 2  /* number of parameters and locals UD_MAKE_KEY */
+  #error Too many parameters and local variables (2 out of MAX_LOCAL_COUNT) for task UD_MAKE_KEY
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_udf_UD_MAKE_KEY_assignment_s {
+  parsec_assignment_t m;
+  parsec_assignment_t n;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-2];
+} __parsec_udf_UD_MAKE_KEY_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 1  /* total number of flows for task UD_MAKE_KEY */
+  #error Too many flows (1 out of MAX_PARAM_COUNT) for task UD_MAKE_KEY
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_udf_UD_MAKE_KEY_data_s {
+  parsec_data_pair_t _f_X;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-1];
+} __parsec_udf_UD_MAKE_KEY_data_t;
+
+typedef struct __parsec_udf_UD_MAKE_KEY_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_udf_UD_MAKE_KEY_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_udf_UD_MAKE_KEY_data_s data;
+} __parsec_udf_UD_MAKE_KEY_task_t;
+
+
+#if MAX_LOCAL_COUNT < 2  /* number of parameters and locals NOUD */
+  #error Too many parameters and local variables (2 out of MAX_LOCAL_COUNT) for task NOUD
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_udf_NOUD_assignment_s {
+  parsec_assignment_t m;
+  parsec_assignment_t n;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-2];
+} __parsec_udf_NOUD_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 1  /* total number of flows for task NOUD */
+  #error Too many flows (1 out of MAX_PARAM_COUNT) for task NOUD
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_udf_NOUD_data_s {
+  parsec_data_pair_t _f_X;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-1];
+} __parsec_udf_NOUD_data_t;
+
+typedef struct __parsec_udf_NOUD_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_udf_NOUD_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_udf_NOUD_data_s data;
+} __parsec_udf_NOUD_task_t;
+
+
+END_C_DECLS
+
+#endif /* _udf_h_ */ 
@@ -0,0 +1,3181 @@
+#include "parsec.h"
+#include "parsec/parsec_internal.h"
+#include "parsec/ayudame.h"
+#include "parsec/execution_stream.h"
+#include "parsec/parsec_binary_profile.h"
+#include "parsec/mca/device/device_gpu.h"
+#if defined(PARSEC_HAVE_DEV_CUDA_SUPPORT)
+#include "parsec/mca/device/cuda/device_cuda.h"
+#endif  /* defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) */
+#if defined(PARSEC_HAVE_DEV_HIP_SUPPORT)
+#include "parsec/mca/device/hip/device_hip.h"
+#endif  /* defined(PARSEC_HAVE_DEV_HIP_SUPPORT) */
+#if defined(_MSC_VER) || defined(__MINGW32__)
+#  include <malloc.h>
+#else
+#  include <alloca.h>
+#endif  /* defined(_MSC_VER) || defined(__MINGW32__) */
+
+#define PARSEC_utt_NB_TASK_CLASSES 4
+#define PARSEC_utt_NB_DATA 1
+
+typedef struct __parsec_utt_internal_taskpool_s __parsec_utt_internal_taskpool_t;
+struct parsec_utt_internal_taskpool_s;
+
+/** Predeclarations of the parsec_task_class_t */
+static const parsec_task_class_t utt_END;
+static const parsec_task_class_t utt_FANIN;
+static const parsec_task_class_t utt_FANOUT;
+static const parsec_task_class_t utt_STARTUP;
+/** Predeclarations of the parameters */
+static const parsec_flow_t flow_of_utt_END_for_X;
+static const parsec_flow_t flow_of_utt_FANIN_for_X;
+static const parsec_flow_t flow_of_utt_FANOUT_for_X;
+static const parsec_flow_t flow_of_utt_STARTUP_for_X;
+/*
+ * Copyright (c)      2022 The University of Tennessee and The University
+ *                         of Tennessee Research Foundation.  All rights
+ *                         reserved.
+ */
+
+#include <sys/time.h>
+#include <inttypes.h>
+#include <string.h>
+#include <stdlib.h>
+#include "parsec/data_dist/matrix/two_dim_rectangle_cyclic.h"
+
+/**
+ * This test uses a User-Triggered-Termination (UTT) to detect
+ *  the completion of the DAG.
+ */
+#define PARSEC_utt_DEFAULT_ADT    (&__parsec_tp->super.arenas_datatypes[PARSEC_utt_DEFAULT_ADT_IDX])
+#include "utt.h"
+
+struct __parsec_utt_internal_taskpool_s {
+ parsec_utt_taskpool_t super;
+ volatile int32_t sync_point;
+ volatile int32_t initial_number_tasks;
+ parsec_task_t* startup_queue;
+  /* The ranges to compute the hash key */
+  int END_i_min;
+  int END_i_range;
+  int FANIN_i_min;
+  int FANIN_i_range;
+  int FANIN_j_min;
+  int FANIN_j_range;
+  int FANOUT_i_min;
+  int FANOUT_i_range;
+  int FANOUT_j_min;
+  int FANOUT_j_range;
+  int STARTUP_i_min;
+  int STARTUP_i_range;
+  /* The list of data repositories */
+  data_repo_t* repositories[4];
+};
+
+#if defined(PARSEC_PROF_TRACE)
+#  if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+static int utt_profiling_array[4*PARSEC_utt_NB_TASK_CLASSES] = {-2}; /* 2 pairs (begin, end) per task, times two because each task class has an internal_init task */
+#  else /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+static int utt_profiling_array[2*PARSEC_utt_NB_TASK_CLASSES] = {-2}; /* 2 pairs (begin, end) per task */
+#  endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+#endif  /* defined(PARSEC_PROF_TRACE) */
+/* Globals */
+#define descA __parsec_tp->super._g_descA
+#define tasks_cnt (__parsec_tp->super._g_tasks_cnt)
+#define NT (__parsec_tp->super._g_NT)
+#define verbose (__parsec_tp->super._g_verbose)
+
+static inline int parsec_imin(int a, int b) { return (a <= b) ? a : b; };
+
+static inline int parsec_imax(int a, int b) { return (a >= b) ? a : b; };
+
+static inline int32_t utt_FANIN_inline_c_expr1_line_63(const __parsec_utt_internal_taskpool_t *__parsec_tp, const __parsec_utt_FANIN_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task FANIN */
+  const int i = assignments->i.value; (void)i;
+  const int j = assignments->j.value; (void)j;
+
+  (void)i;  (void)j;
+
+ return (1 << (i+1)) - 1; 
+}
+
+static inline int32_t utt_FANOUT_inline_c_expr2_line_44(const __parsec_utt_internal_taskpool_t *__parsec_tp, const __parsec_utt_FANOUT_parsec_assignment_t *assignments)
+{
+  (void)__parsec_tp;
+  /* This inline C function was declared in the context of the task FANOUT */
+  const int i = assignments->i.value; (void)i;
+  const int j = assignments->j.value; (void)j;
+
+  (void)i;  (void)j;
+
+ return (1 << (i+1)) - 1; 
+}
+
+/* Data Access Macros */
+#define data_of_descA(descA_d0, descA_d1)  (((parsec_data_collection_t*)__parsec_tp->super._g_descA)->data_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, (descA_d0), (descA_d1)))
+
+#define rank_of_descA(descA_d0, descA_d1)  (((parsec_data_collection_t*)__parsec_tp->super._g_descA)->rank_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, (descA_d0), (descA_d1)))
+
+/* Functions Predicates */
+#define END_pred(i) (((parsec_data_collection_t*)(__parsec_tp->super._g_descA))->myrank == rank_of_descA(0, 0))
+#define FANIN_pred(i, j) (((parsec_data_collection_t*)(__parsec_tp->super._g_descA))->myrank == rank_of_descA(i, j))
+#define FANOUT_pred(i, j) (((parsec_data_collection_t*)(__parsec_tp->super._g_descA))->myrank == rank_of_descA(i, j))
+#define STARTUP_pred(i) (((parsec_data_collection_t*)(__parsec_tp->super._g_descA))->myrank == rank_of_descA(0, 0))
+
+/* Data Repositories */
+#define END_repo (__parsec_tp->repositories[3])
+#define FANIN_repo (__parsec_tp->repositories[2])
+#define FANOUT_repo (__parsec_tp->repositories[1])
+#define STARTUP_repo (__parsec_tp->repositories[0])
+/* Release dependencies output macro */
+#if defined(PARSEC_DEBUG_NOISIER)
+#define RELEASE_DEP_OUTPUT(ES, DEPO, TASKO, DEPI, TASKI, RSRC, RDST, DATA)\
+  do { \
+    char tmp1[128], tmp2[128]; (void)tmp1; (void)tmp2;\
+    PARSEC_DEBUG_VERBOSE(20, parsec_debug_output, "thread %d VP %d explore deps from %s:%s to %s:%s (from rank %d to %d) base ptr %p",\
+           (NULL != (ES) ? (ES)->th_id : -1), (NULL != (ES) ? (ES)->virtual_process->vp_id : -1),\
+           DEPO, parsec_task_snprintf(tmp1, 128, (parsec_task_t*)(TASKO)),\
+           DEPI, parsec_task_snprintf(tmp2, 128, (parsec_task_t*)(TASKI)), (RSRC), (RDST), (DATA));\
+  } while(0)
+#define ACQUIRE_FLOW(TASKI, DEPI, FUNO, DEPO, LOCALS, PTR)\
+  do { \
+    char tmp1[128], tmp2[128]; (void)tmp1; (void)tmp2;\
+    PARSEC_DEBUG_VERBOSE(20, parsec_debug_output, "task %s acquires flow %s from %s %s data ptr %p",\
+           parsec_task_snprintf(tmp1, 128, (parsec_task_t*)(TASKI)), (DEPI),\
+           (DEPO), parsec_snprintf_assignments(tmp2, 128, (FUNO), (parsec_assignment_t*)(LOCALS)), (PTR));\
+  } while(0)
+#else
+#define RELEASE_DEP_OUTPUT(ES, DEPO, TASKO, DEPI, TASKI, RSRC, RDST, DATA)
+#define ACQUIRE_FLOW(TASKI, DEPI, TASKO, DEPO, LOCALS, PTR)
+#endif
+static inline parsec_key_t __jdf2c_make_key_END(const parsec_taskpool_t *tp, const parsec_assignment_t *as)
+{
+  const __parsec_utt_internal_taskpool_t *__parsec_tp = (const __parsec_utt_internal_taskpool_t *)tp;
+  const __parsec_utt_END_parsec_assignment_t *assignment = (const __parsec_utt_END_parsec_assignment_t*)as;
+  uint64_t __parsec_id = 0;
+  __parsec_id += (assignment->i.value - __parsec_tp->END_i_min);
+  return (parsec_key_t)__parsec_id;
+}
+static char *__jdf2c_key_fns_END_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_utt_internal_taskpool_t *__parsec_tp = (__parsec_utt_internal_taskpool_t *)user_data;
+  int i = (__parsec_key) % __parsec_tp->END_i_range + __parsec_tp->END_i_min;
+  __parsec_key = __parsec_key / __parsec_tp->END_i_range;
+  snprintf(buffer, buffer_size, "END(%d)", i);
+  return buffer;
+}
+
+static parsec_key_fn_t __jdf2c_key_fns_END = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = __jdf2c_key_fns_END_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+static inline parsec_key_t __jdf2c_make_key_FANIN(const parsec_taskpool_t *tp, const parsec_assignment_t *as)
+{
+  const __parsec_utt_internal_taskpool_t *__parsec_tp = (const __parsec_utt_internal_taskpool_t *)tp;
+  const __parsec_utt_FANIN_parsec_assignment_t *assignment = (const __parsec_utt_FANIN_parsec_assignment_t*)as;
+  uint64_t __parsec_id = 0;
+  __parsec_id += (assignment->i.value - __parsec_tp->FANIN_i_min);
+  __parsec_id += (assignment->j.value - __parsec_tp->FANIN_j_min) * __parsec_tp->FANIN_i_range;
+  return (parsec_key_t)__parsec_id;
+}
+static char *__jdf2c_key_fns_FANIN_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_utt_internal_taskpool_t *__parsec_tp = (__parsec_utt_internal_taskpool_t *)user_data;
+  __parsec_utt_FANIN_parsec_assignment_t __jdf2c__assignments = {  .i.value = 0, .j.value = 0 };
+  int i = (__parsec_key) % __parsec_tp->FANIN_i_range + __parsec_tp->FANIN_i_min;
+  __parsec_key = __parsec_key / __parsec_tp->FANIN_i_range;
+  __jdf2c__assignments.i.value = i;
+  int j = (__parsec_key) % __parsec_tp->FANIN_j_range + __parsec_tp->FANIN_j_min;
+  __parsec_key = __parsec_key / __parsec_tp->FANIN_j_range;
+  __jdf2c__assignments.j.value = j;
+  (void)__jdf2c__assignments;
+  snprintf(buffer, buffer_size, "FANIN(%d, %d)", i, j);
+  return buffer;
+}
+
+static parsec_key_fn_t __jdf2c_key_fns_FANIN = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = __jdf2c_key_fns_FANIN_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+static inline parsec_key_t __jdf2c_make_key_FANOUT(const parsec_taskpool_t *tp, const parsec_assignment_t *as)
+{
+  const __parsec_utt_internal_taskpool_t *__parsec_tp = (const __parsec_utt_internal_taskpool_t *)tp;
+  const __parsec_utt_FANOUT_parsec_assignment_t *assignment = (const __parsec_utt_FANOUT_parsec_assignment_t*)as;
+  uint64_t __parsec_id = 0;
+  __parsec_id += (assignment->i.value - __parsec_tp->FANOUT_i_min);
+  __parsec_id += (assignment->j.value - __parsec_tp->FANOUT_j_min) * __parsec_tp->FANOUT_i_range;
+  return (parsec_key_t)__parsec_id;
+}
+static char *__jdf2c_key_fns_FANOUT_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_utt_internal_taskpool_t *__parsec_tp = (__parsec_utt_internal_taskpool_t *)user_data;
+  __parsec_utt_FANOUT_parsec_assignment_t __jdf2c__assignments = {  .i.value = 0, .j.value = 0 };
+  int i = (__parsec_key) % __parsec_tp->FANOUT_i_range + __parsec_tp->FANOUT_i_min;
+  __parsec_key = __parsec_key / __parsec_tp->FANOUT_i_range;
+  __jdf2c__assignments.i.value = i;
+  int j = (__parsec_key) % __parsec_tp->FANOUT_j_range + __parsec_tp->FANOUT_j_min;
+  __parsec_key = __parsec_key / __parsec_tp->FANOUT_j_range;
+  __jdf2c__assignments.j.value = j;
+  (void)__jdf2c__assignments;
+  snprintf(buffer, buffer_size, "FANOUT(%d, %d)", i, j);
+  return buffer;
+}
+
+static parsec_key_fn_t __jdf2c_key_fns_FANOUT = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = __jdf2c_key_fns_FANOUT_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+static inline parsec_key_t __jdf2c_make_key_STARTUP(const parsec_taskpool_t *tp, const parsec_assignment_t *as)
+{
+  const __parsec_utt_internal_taskpool_t *__parsec_tp = (const __parsec_utt_internal_taskpool_t *)tp;
+  const __parsec_utt_STARTUP_parsec_assignment_t *assignment = (const __parsec_utt_STARTUP_parsec_assignment_t*)as;
+  uint64_t __parsec_id = 0;
+  __parsec_id += (assignment->i.value - __parsec_tp->STARTUP_i_min);
+  return (parsec_key_t)__parsec_id;
+}
+static char *__jdf2c_key_fns_STARTUP_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_utt_internal_taskpool_t *__parsec_tp = (__parsec_utt_internal_taskpool_t *)user_data;
+  int i = (__parsec_key) % __parsec_tp->STARTUP_i_range + __parsec_tp->STARTUP_i_min;
+  __parsec_key = __parsec_key / __parsec_tp->STARTUP_i_range;
+  snprintf(buffer, buffer_size, "STARTUP(%d)", i);
+  return buffer;
+}
+
+static parsec_key_fn_t __jdf2c_key_fns_STARTUP = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = __jdf2c_key_fns_STARTUP_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/******                                      END                                      ******/
+
+static inline int32_t minexpr_of_symb_utt_END_i_fct(const __parsec_utt_internal_taskpool_t *__parsec_tp, const __parsec_utt_END_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_utt_END_i = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_utt_END_i_fct }
+                   }
+};
+static inline int32_t maxexpr_of_symb_utt_END_i_fct(const __parsec_utt_internal_taskpool_t *__parsec_tp, const __parsec_utt_END_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t maxexpr_of_symb_utt_END_i = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_utt_END_i_fct }
+                   }
+};
+static const parsec_symbol_t symb_utt_END_i = { .name = "i", .context_index = 0, .min = &minexpr_of_symb_utt_END_i, .max = &maxexpr_of_symb_utt_END_i, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int affinity_of_utt_END(const __parsec_utt_END_task_t *this_task,
+                     parsec_data_ref_t *ref)
+{
+    const __parsec_utt_internal_taskpool_t *__parsec_tp = (const __parsec_utt_internal_taskpool_t*)this_task->taskpool;
+  const int i = this_task->locals.i.value; (void)i;
+
+  /* Silent Warnings: should look into predicate to know what variables are usefull */
+  (void)i;
+  ref->dc = (parsec_data_collection_t *)__parsec_tp->super._g_descA;
+  /* Compute data key */
+  ref->key = ref->dc->data_key(ref->dc, 0, 0);
+  return 1;
+}
+static const parsec_property_t properties_of_utt_END[1] = {
+  {.name = NULL, .expr = NULL}
+};
+static inline int ctl_gather_compute_for_dep_flow_of_utt_END_for_X_dep1_atline_85_fct(const __parsec_utt_internal_taskpool_t *__parsec_tp, const __parsec_utt_END_parsec_assignment_t *assignments)
+{
+  int   __nb_found = 0;
+  __parsec_utt_END_parsec_assignment_t __jdf2c__tmp_locals = *assignments;
+  (void)__parsec_tp;
+  const int i = __jdf2c__tmp_locals.i.value; (void)i;
+  (void)i;
+  int FANIN_i = 0;
+  (void)FANIN_i;
+  {
+    int FANIN_j;
+    for(FANIN_j  = 0;
+        FANIN_j <= 1;
+        FANIN_j += 1) {
+      __nb_found++;
+    }
+  }
+  return __nb_found;
+}
+
+static const parsec_expr_t ctl_gather_compute_for_dep_flow_of_utt_END_for_X_dep1_atline_85 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)ctl_gather_compute_for_dep_flow_of_utt_END_for_X_dep1_atline_85_fct }
+                   }
+};
+
+static const parsec_dep_t flow_of_utt_END_for_X_dep1_atline_85 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = &ctl_gather_compute_for_dep_flow_of_utt_END_for_X_dep1_atline_85,
+  .task_class_id = 2, /* utt_FANIN */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_utt_FANIN_for_X,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_utt_END_for_X,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_utt_END_for_X = {
+  .name               = "X",
+  .sym_type           = PARSEC_SYM_IN,
+  .flow_flags         = PARSEC_FLOW_ACCESS_NONE,
+  .flow_index         = 0,
+  .flow_datatype_mask = 0x0,
+  .dep_in     = { &flow_of_utt_END_for_X_dep1_atline_85 },
+  .dep_out    = { NULL }
+};
+
+static void
+iterate_predecessors_of_utt_END(parsec_execution_stream_t *es, const __parsec_utt_END_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_utt_internal_taskpool_t *__parsec_tp = (const __parsec_utt_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_utt_END_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_utt_END_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int i = __jdf2c__tmp_locals.i.value; (void)i;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)i;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_descA(0, 0);
+#endif
+  if( action_mask & 0x1 ) {  /* Flow of data X [0] */
+    data.data   = this_task->data._f_X.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x1 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  =   /* Control: always empty */ 0;
+    data.local.dst_count  =   /* Control: always empty */ 0;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = NULL;
+    data.remote.src_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.src_count  =   /* Control: always empty */ 0;
+    data.remote.dst_count  =   /* Control: always empty */ 0;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        __parsec_utt_FANIN_task_t* ncc = (__parsec_utt_FANIN_task_t*)&nc;
+    nc.task_class = __parsec_tp->super.super.task_classes_array[utt_FANIN.task_class_id];
+      const int FANIN_i = 0;
+      if( (FANIN_i >= (0)) && (FANIN_i <= ((NT - 1))) ) {
+        assert(&nc.locals[0].value == &ncc->locals.i.value);
+        ncc->locals.i.value = FANIN_i;
+        int FANIN_j;
+      for( FANIN_j = 0;FANIN_j <= 1; FANIN_j+=1) {
+          if( (FANIN_j >= (0)) && (FANIN_j <= (utt_FANIN_inline_c_expr1_line_63(__parsec_tp, &ncc->locals))) ) {
+            assert(&nc.locals[1].value == &ncc->locals.j.value);
+            ncc->locals.j.value = FANIN_j;
+#if defined(DISTRIBUTED)
+            rank_dst = rank_of_descA(ncc->locals.i.value, ncc->locals.j.value);
+            if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+              vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, ncc->locals.i.value, ncc->locals.j.value);
+            nc.priority = __parsec_tp->super.super.priority;
+            successor_repo = FANIN_repo;
+            successor_repo_key = __jdf2c_make_key_FANIN((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+          RELEASE_DEP_OUTPUT(es, "X", this_task, "X", &nc, rank_src, rank_dst, &data);
+          if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_utt_END_for_X_dep1_atline_85, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+            }
+          }
+        }
+  }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static int release_deps_of_utt_END(parsec_execution_stream_t *es, __parsec_utt_END_task_t *this_task, uint32_t action_mask, parsec_remote_deps_t *deps)
+{
+  PARSEC_PINS(es, RELEASE_DEPS_BEGIN, (parsec_task_t *)this_task);  const __parsec_utt_internal_taskpool_t *__parsec_tp = (const __parsec_utt_internal_taskpool_t *)this_task->taskpool;
+  parsec_release_dep_fct_arg_t arg;
+  int __vp_id;
+  int consume_local_repo = 0;
+  arg.action_mask = action_mask;
+  arg.output_entry = NULL;
+  arg.output_repo = NULL;
+#if defined(DISTRIBUTED)
+  arg.remote_deps = deps;
+#endif  /* defined(DISTRIBUTED) */
+  assert(NULL != es);
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS )    arg.ready_lists = alloca(sizeof(parsec_task_t *) * es->virtual_process->parsec_context->nb_vp);
+  else
+    arg.ready_lists = NULL;
+  for( __vp_id = 0; __vp_id < es->virtual_process->parsec_context->nb_vp; arg.ready_lists[__vp_id++] = NULL );
+  (void)__parsec_tp; (void)deps;
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+  }
+  consume_local_repo = (this_task->repo_entry != NULL);
+  /* No successors, don't call iterate_successors and don't release any local deps */
+      if (consume_local_repo) {
+         data_repo_entry_used_once( END_repo, this_task->repo_entry->ht_item.key );
+      }
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+  }
+  PARSEC_PINS(es, RELEASE_DEPS_END, (parsec_task_t *)this_task);  return 0;
+}
+
+static int data_lookup_of_utt_END(parsec_execution_stream_t *es, __parsec_utt_END_task_t *this_task)
+{
+  const __parsec_utt_internal_taskpool_t *__parsec_tp = (__parsec_utt_internal_taskpool_t *)this_task->taskpool;
+  parsec_assignment_t generic_locals[MAX_PARAM_COUNT];  /* generic task locals */
+  int target_device = 0; (void)target_device;
+  (void)__parsec_tp; (void)generic_locals; (void)es;
+  parsec_data_copy_t *chunk = NULL;
+  data_repo_t        *reshape_repo  = NULL, *consumed_repo  = NULL;
+  data_repo_entry_t  *reshape_entry = NULL, *consumed_entry = NULL;
+  parsec_key_t        reshape_entry_key = 0, consumed_entry_key = 0;
+  uint8_t             consumed_flow_index;
+  parsec_dep_data_description_t data;
+  int ret;
+  (void)reshape_repo; (void)reshape_entry; (void)reshape_entry_key;
+  (void)consumed_repo; (void)consumed_entry; (void)consumed_entry_key;
+  (void)consumed_flow_index;
+  (void)chunk; (void)data; (void)ret;
+  const int i = this_task->locals.i.value; (void)i;
+  if( NULL == this_task->repo_entry ){
+    this_task->repo_entry = data_repo_lookup_entry_and_create(es, END_repo,                                       __jdf2c_make_key_END((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    data_repo_entry_addto_usage_limit(END_repo, this_task->repo_entry->ht_item.key, 1);    this_task->repo_entry ->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(this_task->repo_entry ->sim_exec_date == 0);
+    this_task->repo_entry ->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  /* The reshape repo is the current task repo. */  reshape_repo = END_repo;
+  reshape_entry_key = __jdf2c_make_key_END((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals) ;
+  reshape_entry = this_task->repo_entry;
+  /* Lookup the input data, and store them in the context if any */
+  /* X is a control flow */
+  this_task->data._f_X.data_in         = NULL;
+  this_task->data._f_X.data_out        = NULL;
+  this_task->data._f_X.source_repo       = NULL;
+  this_task->data._f_X.source_repo_entry = NULL;
+  /** Generate profiling information */
+#if defined(PARSEC_PROF_TRACE)
+  this_task->prof_info.desc = (parsec_data_collection_t*)__parsec_tp->super._g_descA;
+  this_task->prof_info.priority = this_task->priority;
+  this_task->prof_info.data_id   = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->data_key((parsec_data_collection_t*)__parsec_tp->super._g_descA, 0, 0);
+  this_task->prof_info.task_class_id = this_task->task_class->task_class_id;
+  this_task->prof_info.task_return_code = -1;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int datatype_lookup_of_utt_END(parsec_execution_stream_t *es, const parsec_task_t *this_generic_task, const parsec_task_t *parent_task,
+              uint32_t* flow_mask, parsec_dep_data_description_t* data)
+{
+  const __parsec_utt_END_task_t *this_task = (__parsec_utt_END_task_t*)this_generic_task;
+  const __parsec_utt_internal_taskpool_t *__parsec_tp = (__parsec_utt_internal_taskpool_t *)this_task->taskpool;
+  (void)__parsec_tp; (void)es; (void)this_task; (void)data; (void)parent_task;
+  const int i = this_task->locals.i.value; (void)i;
+  data->local.arena = data->remote.arena = NULL;
+  data->local.src_datatype  = data->local.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->local.src_count     = data->local.dst_count = 0;
+  data->local.src_displ     = data->local.dst_displ = 0;
+  data->data_future  = NULL;
+
+  /* these are the output dependencies remote datatypes */
+  data->data                             = NULL;
+  data->remote.src_datatype = data->remote.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->remote.src_count    = data->remote.dst_count = 0;
+  data->remote.src_displ    = data->remote.dst_displ = 0;
+  data->data_future  = NULL;
+  (*flow_mask) = 0;  /* nothing left */
+  (void)i;
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+static int hook_of_utt_END(parsec_execution_stream_t *es, __parsec_utt_END_task_t *this_task)
+{
+  __parsec_utt_internal_taskpool_t *__parsec_tp = (__parsec_utt_internal_taskpool_t *)this_task->taskpool;
+  (void)es; (void)__parsec_tp;
+  const int i = this_task->locals.i.value; (void)i;
+  (void)i;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                                    END BODY                                    -----*/
+
+{
+    if(verbose)
+         printf("END(0) on rank %d\n", this_task->taskpool->context->my_rank);
+    parsec_atomic_fetch_inc_int32(tasks_cnt);
+    this_task->taskpool->tdm.module->taskpool_set_nb_tasks(this_task->taskpool, 0);
+}
+
+/*-----                                END OF END BODY                                -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#endif  /*  defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+static int complete_hook_of_utt_END(parsec_execution_stream_t *es, __parsec_utt_END_task_t *this_task)
+{
+  const __parsec_utt_internal_taskpool_t *__parsec_tp = (__parsec_utt_internal_taskpool_t *)this_task->taskpool;
+#if defined(DISTRIBUTED)
+    const int i = this_task->locals.i.value; (void)i;
+#endif  /* defined(DISTRIBUTED) */
+  (void)es; (void)__parsec_tp;
+parsec_data_t* data_t_desc = NULL; (void)data_t_desc;
+#if defined(DISTRIBUTED)
+  /** If not working on distributed, there is no risk that data is not in place */
+  (void)i;
+
+#endif /* DISTRIBUTED */
+#if defined(PARSEC_PROF_GRAPHER)
+  parsec_prof_grapher_task((parsec_task_t*)this_task, es->th_id, es->virtual_process->vp_id,
+     __jdf2c_key_fns_END.key_hash(this_task->task_class->make_key( (parsec_taskpool_t*)this_task->taskpool, ((parsec_task_t*)this_task)->locals), NULL));
+#endif  /* defined(PARSEC_PROF_GRAPHER) */
+  release_deps_of_utt_END(es, this_task,
+      PARSEC_ACTION_RELEASE_REMOTE_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_REFS |
+      PARSEC_ACTION_RESHAPE_ON_RELEASE |
+      0x0,  /* mask of all dep_index */ 
+      NULL);
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static parsec_hook_return_t release_task_of_utt_END(parsec_execution_stream_t *es, parsec_task_t *this_task)
+{
+    const __parsec_utt_internal_taskpool_t *__parsec_tp =
+        (const __parsec_utt_internal_taskpool_t *)this_task->taskpool;
+    parsec_hash_table_t *ht = (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[3];
+    parsec_key_t key = this_task->task_class->make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals);
+    parsec_hashable_dependency_t *hash_dep = (parsec_hashable_dependency_t *)parsec_hash_table_remove(ht, key);
+    parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);
+    return parsec_release_task_to_mempool_update_nbtasks(es, this_task);
+}
+
+static char *utt_utt_END_internal_init_deps_key_functions_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_utt_internal_taskpool_t *__parsec_tp = (__parsec_utt_internal_taskpool_t *)user_data;
+  int i = (__parsec_key) % __parsec_tp->END_i_range + __parsec_tp->END_i_min;
+  __parsec_key = __parsec_key / __parsec_tp->END_i_range;
+  snprintf(buffer, buffer_size, "END(%d)", i);
+  return buffer;
+}
+
+static parsec_key_fn_t utt_utt_END_internal_init_deps_key_functions = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = utt_utt_END_internal_init_deps_key_functions_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/* Needs: min-max - iterate */
+static int utt_END_internal_init(parsec_execution_stream_t * es, __parsec_utt_END_task_t * this_task)
+{
+  __parsec_utt_internal_taskpool_t *__parsec_tp = (__parsec_utt_internal_taskpool_t*)this_task->taskpool;
+int32_t __i_min = 0x7fffffff, __i_max = 0;int32_t __jdf2c_i_min = 0x7fffffff, __jdf2c_i_max = 0;  __parsec_utt_END_parsec_assignment_t assignments = {  .i.value = 0 };
+  int32_t  i;
+  int32_t __jdf2c_i_start, __jdf2c_i_end, __jdf2c_i_inc;
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+  PARSEC_PROFILING_TRACE(es->es_profile,
+                         this_task->taskpool->profiling_array[START_KEY(this_task->task_class->task_class_id)],
+                         0,
+                         this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    __jdf2c_i_start = 0;
+    __jdf2c_i_end = 0;
+    __jdf2c_i_inc = 1;
+    __i_min = parsec_imin(__jdf2c_i_start, __jdf2c_i_end);
+    __i_max = parsec_imax(__jdf2c_i_start, __jdf2c_i_end);
+    __jdf2c_i_min = parsec_imin(__jdf2c_i_min, __i_min);
+    __jdf2c_i_max = parsec_imax(__jdf2c_i_max, __i_max);
+    for(i =  __jdf2c_i_start;
+        i <= __jdf2c_i_end;
+        i += __jdf2c_i_inc) {
+    assignments.i.value = i;
+    if( !END_pred(i) ) continue;
+  } /* Loop on normal range i */
+  /* Set the range variables for the collision-free hash-computation */
+  __parsec_tp->END_i_min   = __jdf2c_i_min;
+  __parsec_tp->END_i_range = (__jdf2c_i_max - __jdf2c_i_min) + 1;
+  this_task->status = PARSEC_TASK_STATUS_COMPLETE;
+
+  PARSEC_AYU_REGISTER_TASK(&utt_END);
+  __parsec_tp->super.super.dependencies_array[3] = PARSEC_OBJ_NEW(parsec_hash_table_t);
+  parsec_hash_table_init(__parsec_tp->super.super.dependencies_array[3], offsetof(parsec_hashable_dependency_t, ht_item), 10, utt_utt_END_internal_init_deps_key_functions, this_task->taskpool);
+  __parsec_tp->repositories[3] = data_repo_create_nothreadsafe(PARSEC_DEFAULT_DATAREPO_HASH_LENGTH, __jdf2c_key_fns_END, (parsec_taskpool_t*)__parsec_tp, 1);
+(void)__i_min; (void)__i_max;  (void)__jdf2c_i_start; (void)__jdf2c_i_end; (void)__jdf2c_i_inc;  (void)assignments; (void)__parsec_tp; (void)es;
+  if(1 == parsec_atomic_fetch_dec_int32(&__parsec_tp->sync_point)) {
+    /* Last initialization task complete. Update the number of tasks. */
+    __parsec_tp->sync_point = PARSEC_utt_NB_TASK_CLASSES;
+    //__parsec_tp->super.super.tdm.module->taskpool_addto_nb_tasks(&__parsec_tp->super.super, 1);
+    parsec_mfence();  /* write memory barrier to guarantee that the scheduler gets the correct number of tasks */
+    parsec_taskpool_enable((parsec_taskpool_t*)__parsec_tp, &__parsec_tp->startup_queue,
+                           (parsec_task_t*)this_task, es, __parsec_tp->super.super.nb_pending_actions);
+    __parsec_tp->super.super.tdm.module->taskpool_ready(&__parsec_tp->super.super);
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+    PARSEC_PROFILING_TRACE(es->es_profile,
+                           this_task->taskpool->profiling_array[2 * this_task->task_class->task_class_id + 1],
+                           0,
+                           this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    return PARSEC_HOOK_RETURN_DONE;
+  }
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static const __parsec_chore_t __utt_END_chores[] ={
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+    { .type     = PARSEC_DEV_CPU,
+      .evaluate = (parsec_evaluate_function_t*)NULL,
+      .hook     = (parsec_hook_t*)hook_of_utt_END },
+#endif  /* defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+    { .type     = PARSEC_DEV_NONE,
+      .evaluate = NULL,
+      .hook     = (parsec_hook_t*)NULL },  /* End marker */
+};
+
+static const parsec_task_class_t utt_END = {
+  .name = "END",
+  .task_class_id = 3,
+  .nb_flows = 1,
+  .nb_parameters = 1,
+  .nb_locals = 1,
+  .task_class_type = PARSEC_TASK_CLASS_TYPE_PTG,
+  .params = { &symb_utt_END_i, NULL },
+  .locals = { &symb_utt_END_i, NULL },
+  .data_affinity = (parsec_data_ref_fn_t*)affinity_of_utt_END,
+  .initial_data = (parsec_data_ref_fn_t*)affinity_of_utt_END,
+  .final_data = (parsec_data_ref_fn_t*)affinity_of_utt_END,
+  .priority = NULL,
+  .properties = properties_of_utt_END,
+#if MAX_PARAM_COUNT < 0  /* number of read flows of END */
+  #error Too many read flows for task END
+#endif  /* MAX_PARAM_COUNT */
+#if MAX_PARAM_COUNT < 0  /* number of write flows of END */
+  #error Too many write flows for task END
+#endif  /* MAX_PARAM_COUNT */
+  .in = { &flow_of_utt_END_for_X, NULL },
+  .out = { NULL },
+  .flags = 0x0|PARSEC_HAS_CTL_GATHER,
+  .dependencies_goal = 1,
+  .make_key = __jdf2c_make_key_END,
+  .task_snprintf = parsec_task_snprintf,
+#if defined(PARSEC_PROF_TRACE)
+  .profile_info = &parsec_task_profile_info,
+#endif
+  .key_functions = &__jdf2c_key_fns_END,
+  .fini = (parsec_hook_t*)NULL,
+  .incarnations = __utt_END_chores,
+  .find_deps = parsec_hash_find_deps,
+  .update_deps = parsec_update_deps_with_counter,
+  .iterate_successors = (parsec_traverse_function_t*)NULL,
+  .iterate_predecessors = (parsec_traverse_function_t*)iterate_predecessors_of_utt_END,
+  .release_deps = (parsec_release_deps_t*)release_deps_of_utt_END,
+  .prepare_output = (parsec_hook_t*)NULL,
+  .prepare_input = (parsec_hook_t*)data_lookup_of_utt_END,
+  .time_estimate = NULL,
+  .get_datatype = datatype_lookup_of_utt_END,
+  .complete_execution = (parsec_hook_t*)complete_hook_of_utt_END,
+  .release_task = &release_task_of_utt_END,
+#if defined(PARSEC_SIM)
+  .sim_cost_fct = (parsec_sim_cost_fct_t*)NULL,
+#endif
+};
+
+
+/******                                    FANIN                                      ******/
+
+static inline int32_t minexpr_of_symb_utt_FANIN_i_fct(const __parsec_utt_internal_taskpool_t *__parsec_tp, const __parsec_utt_FANIN_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_utt_FANIN_i = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_utt_FANIN_i_fct }
+                   }
+};
+static inline int maxexpr_of_symb_utt_FANIN_i_fct(const __parsec_utt_internal_taskpool_t *__parsec_tp, const __parsec_utt_FANIN_parsec_assignment_t *locals)
+{
+  const int i = locals->i.value; (void)i;
+  const int j = locals->j.value; (void)j;
+
+  (void)i;
+  (void)j;
+  (void)__parsec_tp; (void)locals;
+  return (NT - 1);
+}
+static const parsec_expr_t maxexpr_of_symb_utt_FANIN_i = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_utt_FANIN_i_fct }
+                   }
+};
+static const parsec_symbol_t symb_utt_FANIN_i = { .name = "i", .context_index = 0, .min = &minexpr_of_symb_utt_FANIN_i, .max = &maxexpr_of_symb_utt_FANIN_i, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int32_t minexpr_of_symb_utt_FANIN_j_fct(const __parsec_utt_internal_taskpool_t *__parsec_tp, const __parsec_utt_FANIN_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_utt_FANIN_j = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_utt_FANIN_j_fct }
+                   }
+};
+static inline int32_t maxexpr_of_symb_utt_FANIN_j_fct(const __parsec_utt_internal_taskpool_t *__parsec_tp, const __parsec_utt_FANIN_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return utt_FANIN_inline_c_expr1_line_63(__parsec_tp, locals);
+}
+static const parsec_expr_t maxexpr_of_symb_utt_FANIN_j = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_utt_FANIN_j_fct }
+                   }
+};
+static const parsec_symbol_t symb_utt_FANIN_j = { .name = "j", .context_index = 1, .min = &minexpr_of_symb_utt_FANIN_j, .max = &maxexpr_of_symb_utt_FANIN_j, .cst_inc = 1, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int affinity_of_utt_FANIN(const __parsec_utt_FANIN_task_t *this_task,
+                     parsec_data_ref_t *ref)
+{
+    const __parsec_utt_internal_taskpool_t *__parsec_tp = (const __parsec_utt_internal_taskpool_t*)this_task->taskpool;
+  const int i = this_task->locals.i.value; (void)i;
+  const int j = this_task->locals.j.value; (void)j;
+
+  /* Silent Warnings: should look into predicate to know what variables are usefull */
+  (void)i;
+  (void)j;
+  ref->dc = (parsec_data_collection_t *)__parsec_tp->super._g_descA;
+  /* Compute data key */
+  ref->key = ref->dc->data_key(ref->dc, i, j);
+  return 1;
+}
+static const parsec_property_t properties_of_utt_FANIN[1] = {
+  {.name = NULL, .expr = NULL}
+};
+static inline int expr_of_cond_for_flow_of_utt_FANIN_for_X_dep1_atline_67_iftrue_fct(const __parsec_utt_internal_taskpool_t *__parsec_tp, const __parsec_utt_FANIN_parsec_assignment_t *locals)
+{
+  const int i = locals->i.value; (void)i;
+  const int j = locals->j.value; (void)j;
+
+  (void)i;
+  (void)j;
+  (void)__parsec_tp; (void)locals;
+  return (i) == ((NT - 1));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_utt_FANIN_for_X_dep1_atline_67_iftrue = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_utt_FANIN_for_X_dep1_atline_67_iftrue_fct }
+                   }
+};
+static const parsec_dep_t flow_of_utt_FANIN_for_X_dep1_atline_67_iftrue = {
+  .cond = &expr_of_cond_for_flow_of_utt_FANIN_for_X_dep1_atline_67_iftrue,  /* (i) == ((NT - 1)) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 1, /* utt_FANOUT */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_utt_FANOUT_for_X,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_utt_FANIN_for_X,
+};
+static inline int expr_of_cond_for_flow_of_utt_FANIN_for_X_dep1_atline_67_iffalse_fct(const __parsec_utt_internal_taskpool_t *__parsec_tp, const __parsec_utt_FANIN_parsec_assignment_t *locals)
+{
+  const int i = locals->i.value; (void)i;
+  const int j = locals->j.value; (void)j;
+
+  (void)i;
+  (void)j;
+  (void)__parsec_tp; (void)locals;
+  return !((i) == ((NT - 1)));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_utt_FANIN_for_X_dep1_atline_67_iffalse = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_utt_FANIN_for_X_dep1_atline_67_iffalse_fct }
+                   }
+};
+static inline int ctl_gather_compute_for_dep_flow_of_utt_FANIN_for_X_dep1_atline_67_iffalse_fct(const __parsec_utt_internal_taskpool_t *__parsec_tp, const __parsec_utt_FANIN_parsec_assignment_t *assignments)
+{
+  int   __nb_found = 0;
+  __parsec_utt_FANIN_parsec_assignment_t __jdf2c__tmp_locals = *assignments;
+  (void)__parsec_tp;
+  const int i = __jdf2c__tmp_locals.i.value; (void)i;
+  const int j = __jdf2c__tmp_locals.j.value; (void)j;
+  (void)i; (void)j;
+  int FANIN_i = (i + 1);
+  (void)FANIN_i;
+  {
+    int FANIN_j;
+    for(FANIN_j  = (2 * j);
+        FANIN_j <= ((2 * j) + 1);
+        FANIN_j += 1) {
+      __nb_found++;
+    }
+  }
+  return __nb_found;
+}
+
+static const parsec_expr_t ctl_gather_compute_for_dep_flow_of_utt_FANIN_for_X_dep1_atline_67_iffalse = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)ctl_gather_compute_for_dep_flow_of_utt_FANIN_for_X_dep1_atline_67_iffalse_fct }
+                   }
+};
+
+static const parsec_dep_t flow_of_utt_FANIN_for_X_dep1_atline_67_iffalse = {
+  .cond = &expr_of_cond_for_flow_of_utt_FANIN_for_X_dep1_atline_67_iffalse,  /* !(i) == ((NT - 1)) */
+  .ctl_gather_nb = &ctl_gather_compute_for_dep_flow_of_utt_FANIN_for_X_dep1_atline_67_iffalse,
+  .task_class_id = 2, /* utt_FANIN */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_utt_FANIN_for_X,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_utt_FANIN_for_X,
+};
+static inline int expr_of_cond_for_flow_of_utt_FANIN_for_X_dep2_atline_69_iftrue_fct(const __parsec_utt_internal_taskpool_t *__parsec_tp, const __parsec_utt_FANIN_parsec_assignment_t *locals)
+{
+  const int i = locals->i.value;
+  const int j = locals->j.value; (void)j;
+
+  (void)i;
+  (void)j;
+  (void)__parsec_tp; (void)locals;
+  return (i) > (0);
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_utt_FANIN_for_X_dep2_atline_69_iftrue = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_utt_FANIN_for_X_dep2_atline_69_iftrue_fct }
+                   }
+};
+static const parsec_dep_t flow_of_utt_FANIN_for_X_dep2_atline_69_iftrue = {
+  .cond = &expr_of_cond_for_flow_of_utt_FANIN_for_X_dep2_atline_69_iftrue,  /* (i) > (0) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 2, /* utt_FANIN */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_utt_FANIN_for_X,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_utt_FANIN_for_X,
+};
+static inline int expr_of_cond_for_flow_of_utt_FANIN_for_X_dep2_atline_69_iffalse_fct(const __parsec_utt_internal_taskpool_t *__parsec_tp, const __parsec_utt_FANIN_parsec_assignment_t *locals)
+{
+  const int i = locals->i.value;
+  const int j = locals->j.value; (void)j;
+
+  (void)i;
+  (void)j;
+  (void)__parsec_tp; (void)locals;
+  return !((i) > (0));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_utt_FANIN_for_X_dep2_atline_69_iffalse = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_utt_FANIN_for_X_dep2_atline_69_iffalse_fct }
+                   }
+};
+static const parsec_dep_t flow_of_utt_FANIN_for_X_dep2_atline_69_iffalse = {
+  .cond = &expr_of_cond_for_flow_of_utt_FANIN_for_X_dep2_atline_69_iffalse,  /* !(i) > (0) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 3, /* utt_END */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_utt_END_for_X,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_utt_FANIN_for_X,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+#if MAX_DEP_OUT_COUNT < 1  /* number of output dependencies */
+    #error Too many output dependencies (supports up to MAX_DEP_OUT_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_OUT_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_utt_FANIN_for_X = {
+  .name               = "X",
+  .sym_type           = PARSEC_SYM_INOUT,
+  .flow_flags         = PARSEC_FLOW_ACCESS_NONE,
+  .flow_index         = 0,
+  .flow_datatype_mask = 0x1,
+  .dep_in     = { &flow_of_utt_FANIN_for_X_dep1_atline_67_iftrue,
+ &flow_of_utt_FANIN_for_X_dep1_atline_67_iffalse },
+  .dep_out    = { &flow_of_utt_FANIN_for_X_dep2_atline_69_iftrue,
+ &flow_of_utt_FANIN_for_X_dep2_atline_69_iffalse }
+};
+
+static void
+iterate_successors_of_utt_FANIN(parsec_execution_stream_t *es, const __parsec_utt_FANIN_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_utt_internal_taskpool_t *__parsec_tp = (const __parsec_utt_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_utt_FANIN_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_utt_FANIN_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int i = __jdf2c__tmp_locals.i.value; (void)i;
+  const int j = __jdf2c__tmp_locals.j.value; (void)j;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)i;  (void)j;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_descA(i, j);
+#endif
+  if( action_mask & 0x1 ) {  /* Flow of data X [0] */
+    data.data   = this_task->data._f_X.data_out;
+    data.data_future  = NULL;
+    if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  =   /* Control: always empty */ 0;
+    data.local.dst_count  =   /* Control: always empty */ 0;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = NULL;
+    data.remote.src_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.src_count  =   /* Control: always empty */ 0;
+    data.remote.dst_count  =   /* Control: always empty */ 0;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+       if( (i) > (0) ) {
+      __parsec_utt_FANIN_task_t* ncc = (__parsec_utt_FANIN_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[utt_FANIN.task_class_id];
+        const int FANIN_i = (i - 1);
+        if( (FANIN_i >= (0)) && (FANIN_i <= ((NT - 1))) ) {
+          assert(&nc.locals[0].value == &ncc->locals.i.value);
+          ncc->locals.i.value = FANIN_i;
+          const int FANIN_j = (j / 2);
+          if( (FANIN_j >= (0)) && (FANIN_j <= (utt_FANIN_inline_c_expr1_line_63(__parsec_tp, &ncc->locals))) ) {
+            assert(&nc.locals[1].value == &ncc->locals.j.value);
+            ncc->locals.j.value = FANIN_j;
+#if defined(DISTRIBUTED)
+            rank_dst = rank_of_descA(ncc->locals.i.value, ncc->locals.j.value);
+            if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+              vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, ncc->locals.i.value, ncc->locals.j.value);
+            nc.priority = __parsec_tp->super.super.priority;
+            successor_repo = FANIN_repo;
+            successor_repo_key = __jdf2c_make_key_FANIN((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+          RELEASE_DEP_OUTPUT(es, "X", this_task, "X", &nc, rank_src, rank_dst, &data);
+          if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_utt_FANIN_for_X_dep2_atline_69_iftrue, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+            }
+          }
+    } else {
+      __parsec_utt_END_task_t* ncc = (__parsec_utt_END_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[utt_END.task_class_id];
+        const int END_i = 0;
+        if( (END_i >= (0)) && (END_i <= (0)) ) {
+          assert(&nc.locals[0].value == &ncc->locals.i.value);
+          ncc->locals.i.value = END_i;
+#if defined(DISTRIBUTED)
+          rank_dst = rank_of_descA(0, 0);
+          if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+            vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, 0, 0);
+          nc.priority = __parsec_tp->super.super.priority;
+          successor_repo = END_repo;
+          successor_repo_key = __jdf2c_make_key_END((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+        RELEASE_DEP_OUTPUT(es, "X", this_task, "X", &nc, rank_src, rank_dst, &data);
+        if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_utt_FANIN_for_X_dep2_atline_69_iffalse, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+          }
+    }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static void
+iterate_predecessors_of_utt_FANIN(parsec_execution_stream_t *es, const __parsec_utt_FANIN_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_utt_internal_taskpool_t *__parsec_tp = (const __parsec_utt_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_utt_FANIN_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_utt_FANIN_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int i = __jdf2c__tmp_locals.i.value; (void)i;
+  const int j = __jdf2c__tmp_locals.j.value; (void)j;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)i;  (void)j;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_descA(i, j);
+#endif
+  if( action_mask & 0x1 ) {  /* Flow of data X [0] */
+    data.data   = this_task->data._f_X.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x1 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  =   /* Control: always empty */ 0;
+    data.local.dst_count  =   /* Control: always empty */ 0;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = NULL;
+    data.remote.src_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.src_count  =   /* Control: always empty */ 0;
+    data.remote.dst_count  =   /* Control: always empty */ 0;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( (i) == ((NT - 1)) ) {
+      __parsec_utt_FANOUT_task_t* ncc = (__parsec_utt_FANOUT_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[utt_FANOUT.task_class_id];
+        const int FANOUT_i = i;
+        if( (FANOUT_i >= (0)) && (FANOUT_i <= ((NT - 1))) ) {
+          assert(&nc.locals[0].value == &ncc->locals.i.value);
+          ncc->locals.i.value = FANOUT_i;
+          const int FANOUT_j = j;
+          if( (FANOUT_j >= (0)) && (FANOUT_j <= (utt_FANOUT_inline_c_expr2_line_44(__parsec_tp, &ncc->locals))) ) {
+            assert(&nc.locals[1].value == &ncc->locals.j.value);
+            ncc->locals.j.value = FANOUT_j;
+#if defined(DISTRIBUTED)
+            rank_dst = rank_of_descA(ncc->locals.i.value, ncc->locals.j.value);
+            if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+              vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, ncc->locals.i.value, ncc->locals.j.value);
+            nc.priority = __parsec_tp->super.super.priority;
+            successor_repo = FANOUT_repo;
+            successor_repo_key = __jdf2c_make_key_FANOUT((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+          RELEASE_DEP_OUTPUT(es, "X", this_task, "X", &nc, rank_src, rank_dst, &data);
+          if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_utt_FANIN_for_X_dep1_atline_67_iftrue, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+            }
+          }
+    } else {
+      __parsec_utt_FANIN_task_t* ncc = (__parsec_utt_FANIN_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[utt_FANIN.task_class_id];
+        const int FANIN_i = (i + 1);
+        if( (FANIN_i >= (0)) && (FANIN_i <= ((NT - 1))) ) {
+          assert(&nc.locals[0].value == &ncc->locals.i.value);
+          ncc->locals.i.value = FANIN_i;
+          int FANIN_j;
+        for( FANIN_j = (2 * j);FANIN_j <= ((2 * j) + 1); FANIN_j+=1) {
+            if( (FANIN_j >= (0)) && (FANIN_j <= (utt_FANIN_inline_c_expr1_line_63(__parsec_tp, &ncc->locals))) ) {
+              assert(&nc.locals[1].value == &ncc->locals.j.value);
+              ncc->locals.j.value = FANIN_j;
+#if defined(DISTRIBUTED)
+              rank_dst = rank_of_descA(ncc->locals.i.value, ncc->locals.j.value);
+              if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+                vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, ncc->locals.i.value, ncc->locals.j.value);
+              nc.priority = __parsec_tp->super.super.priority;
+              successor_repo = FANIN_repo;
+              successor_repo_key = __jdf2c_make_key_FANIN((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+            RELEASE_DEP_OUTPUT(es, "X", this_task, "X", &nc, rank_src, rank_dst, &data);
+            if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_utt_FANIN_for_X_dep1_atline_67_iffalse, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+              }
+            }
+          }
+    }
+  }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static int release_deps_of_utt_FANIN(parsec_execution_stream_t *es, __parsec_utt_FANIN_task_t *this_task, uint32_t action_mask, parsec_remote_deps_t *deps)
+{
+  PARSEC_PINS(es, RELEASE_DEPS_BEGIN, (parsec_task_t *)this_task);  const __parsec_utt_internal_taskpool_t *__parsec_tp = (const __parsec_utt_internal_taskpool_t *)this_task->taskpool;
+  parsec_release_dep_fct_arg_t arg;
+  int __vp_id;
+  int consume_local_repo = 0;
+  arg.action_mask = action_mask;
+  arg.output_entry = NULL;
+  arg.output_repo = NULL;
+#if defined(DISTRIBUTED)
+  arg.remote_deps = deps;
+#endif  /* defined(DISTRIBUTED) */
+  assert(NULL != es);
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS )    arg.ready_lists = alloca(sizeof(parsec_task_t *) * es->virtual_process->parsec_context->nb_vp);
+  else
+    arg.ready_lists = NULL;
+  for( __vp_id = 0; __vp_id < es->virtual_process->parsec_context->nb_vp; arg.ready_lists[__vp_id++] = NULL );
+  (void)__parsec_tp; (void)deps;
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+  }
+  consume_local_repo = (this_task->repo_entry != NULL);
+  arg.output_repo = FANIN_repo;
+  arg.output_entry = this_task->repo_entry;
+  arg.output_usage = 0;
+  if( action_mask & (PARSEC_ACTION_RELEASE_LOCAL_DEPS | PARSEC_ACTION_GET_REPO_ENTRY) ) {
+    arg.output_entry = data_repo_lookup_entry_and_create( es, arg.output_repo, __jdf2c_make_key_FANIN((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    arg.output_entry->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(arg.output_entry->sim_exec_date == 0);
+    arg.output_entry->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  if(action_mask & ( PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE ) ){
+    /* Generate the reshape promise for the outputs that need it */
+    iterate_successors_of_utt_FANIN(es, this_task, action_mask, parsec_set_up_reshape_promise, &arg);
+   }
+  iterate_successors_of_utt_FANIN(es, this_task, action_mask, parsec_release_dep_fct, &arg);
+
+#if defined(DISTRIBUTED)
+  if( (action_mask & PARSEC_ACTION_SEND_REMOTE_DEPS) && (NULL != arg.remote_deps)) {
+    parsec_remote_dep_activate(es, (parsec_task_t *)this_task, arg.remote_deps, arg.remote_deps->outgoing_mask);
+  }
+#endif
+
+  if(action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS) {
+    data_repo_entry_addto_usage_limit(FANIN_repo, arg.output_entry->ht_item.key, arg.output_usage);
+    __parsec_schedule_vp(es, arg.ready_lists, 0);
+  }
+      if (consume_local_repo) {
+         data_repo_entry_used_once( FANIN_repo, this_task->repo_entry->ht_item.key );
+      }
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+  }
+  PARSEC_PINS(es, RELEASE_DEPS_END, (parsec_task_t *)this_task);  return 0;
+}
+
+static int data_lookup_of_utt_FANIN(parsec_execution_stream_t *es, __parsec_utt_FANIN_task_t *this_task)
+{
+  const __parsec_utt_internal_taskpool_t *__parsec_tp = (__parsec_utt_internal_taskpool_t *)this_task->taskpool;
+  parsec_assignment_t generic_locals[MAX_PARAM_COUNT];  /* generic task locals */
+  int target_device = 0; (void)target_device;
+  (void)__parsec_tp; (void)generic_locals; (void)es;
+  parsec_data_copy_t *chunk = NULL;
+  data_repo_t        *reshape_repo  = NULL, *consumed_repo  = NULL;
+  data_repo_entry_t  *reshape_entry = NULL, *consumed_entry = NULL;
+  parsec_key_t        reshape_entry_key = 0, consumed_entry_key = 0;
+  uint8_t             consumed_flow_index;
+  parsec_dep_data_description_t data;
+  int ret;
+  (void)reshape_repo; (void)reshape_entry; (void)reshape_entry_key;
+  (void)consumed_repo; (void)consumed_entry; (void)consumed_entry_key;
+  (void)consumed_flow_index;
+  (void)chunk; (void)data; (void)ret;
+  const int i = this_task->locals.i.value; (void)i;
+  const int j = this_task->locals.j.value; (void)j;
+  if( NULL == this_task->repo_entry ){
+    this_task->repo_entry = data_repo_lookup_entry_and_create(es, FANIN_repo,                                       __jdf2c_make_key_FANIN((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    data_repo_entry_addto_usage_limit(FANIN_repo, this_task->repo_entry->ht_item.key, 1);    this_task->repo_entry ->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(this_task->repo_entry ->sim_exec_date == 0);
+    this_task->repo_entry ->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  /* The reshape repo is the current task repo. */  reshape_repo = FANIN_repo;
+  reshape_entry_key = __jdf2c_make_key_FANIN((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals) ;
+  reshape_entry = this_task->repo_entry;
+  /* Lookup the input data, and store them in the context if any */
+  /* X is a control flow */
+  this_task->data._f_X.data_in         = NULL;
+  this_task->data._f_X.data_out        = NULL;
+  this_task->data._f_X.source_repo       = NULL;
+  this_task->data._f_X.source_repo_entry = NULL;
+  /** Generate profiling information */
+#if defined(PARSEC_PROF_TRACE)
+  this_task->prof_info.desc = (parsec_data_collection_t*)__parsec_tp->super._g_descA;
+  this_task->prof_info.priority = this_task->priority;
+  this_task->prof_info.data_id   = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->data_key((parsec_data_collection_t*)__parsec_tp->super._g_descA, i, j);
+  this_task->prof_info.task_class_id = this_task->task_class->task_class_id;
+  this_task->prof_info.task_return_code = -1;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int datatype_lookup_of_utt_FANIN(parsec_execution_stream_t *es, const parsec_task_t *this_generic_task, const parsec_task_t *parent_task,
+              uint32_t* flow_mask, parsec_dep_data_description_t* data)
+{
+  const __parsec_utt_FANIN_task_t *this_task = (__parsec_utt_FANIN_task_t*)this_generic_task;
+  const __parsec_utt_internal_taskpool_t *__parsec_tp = (__parsec_utt_internal_taskpool_t *)this_task->taskpool;
+  (void)__parsec_tp; (void)es; (void)this_task; (void)data; (void)parent_task;
+  const int i = this_task->locals.i.value; (void)i;
+  const int j = this_task->locals.j.value; (void)j;
+  data->local.arena = data->remote.arena = NULL;
+  data->local.src_datatype  = data->local.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->local.src_count     = data->local.dst_count = 0;
+  data->local.src_displ     = data->local.dst_displ = 0;
+  data->data_future  = NULL;
+
+  /* these are the output dependencies remote datatypes */
+  data->data                             = NULL;
+  data->remote.src_datatype = data->remote.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->remote.src_count    = data->remote.dst_count = 0;
+  data->remote.src_displ    = data->remote.dst_displ = 0;
+  data->data_future  = NULL;
+  (*flow_mask) = 0;  /* nothing left */
+  (void)i;  (void)j;
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+static int hook_of_utt_FANIN(parsec_execution_stream_t *es, __parsec_utt_FANIN_task_t *this_task)
+{
+  __parsec_utt_internal_taskpool_t *__parsec_tp = (__parsec_utt_internal_taskpool_t *)this_task->taskpool;
+  (void)es; (void)__parsec_tp;
+  const int i = this_task->locals.i.value; (void)i;
+  const int j = this_task->locals.j.value; (void)j;
+  (void)i;  (void)j;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                                  FANIN BODY                                  -----*/
+
+{
+    if(verbose)
+        printf("FANIN(%d, %d) on rank %d\n", i, j, this_task->taskpool->context->my_rank);
+    parsec_atomic_fetch_inc_int32(tasks_cnt);
+}
+
+/*-----                              END OF FANIN BODY                                -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#endif  /*  defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+static int complete_hook_of_utt_FANIN(parsec_execution_stream_t *es, __parsec_utt_FANIN_task_t *this_task)
+{
+  const __parsec_utt_internal_taskpool_t *__parsec_tp = (__parsec_utt_internal_taskpool_t *)this_task->taskpool;
+#if defined(DISTRIBUTED)
+    const int i = this_task->locals.i.value; (void)i;
+  const int j = this_task->locals.j.value; (void)j;
+#endif  /* defined(DISTRIBUTED) */
+  (void)es; (void)__parsec_tp;
+parsec_data_t* data_t_desc = NULL; (void)data_t_desc;
+#if defined(DISTRIBUTED)
+  /** If not working on distributed, there is no risk that data is not in place */
+  (void)i;  (void)j;
+
+#endif /* DISTRIBUTED */
+#if defined(PARSEC_PROF_GRAPHER)
+  parsec_prof_grapher_task((parsec_task_t*)this_task, es->th_id, es->virtual_process->vp_id,
+     __jdf2c_key_fns_FANIN.key_hash(this_task->task_class->make_key( (parsec_taskpool_t*)this_task->taskpool, ((parsec_task_t*)this_task)->locals), NULL));
+#endif  /* defined(PARSEC_PROF_GRAPHER) */
+  release_deps_of_utt_FANIN(es, this_task,
+      PARSEC_ACTION_RELEASE_REMOTE_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_REFS |
+      PARSEC_ACTION_RESHAPE_ON_RELEASE |
+      0x1,  /* mask of all dep_index */ 
+      NULL);
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static parsec_hook_return_t release_task_of_utt_FANIN(parsec_execution_stream_t *es, parsec_task_t *this_task)
+{
+    const __parsec_utt_internal_taskpool_t *__parsec_tp =
+        (const __parsec_utt_internal_taskpool_t *)this_task->taskpool;
+    parsec_hash_table_t *ht = (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[2];
+    parsec_key_t key = this_task->task_class->make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals);
+    parsec_hashable_dependency_t *hash_dep = (parsec_hashable_dependency_t *)parsec_hash_table_remove(ht, key);
+    parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);
+    return parsec_release_task_to_mempool_update_nbtasks(es, this_task);
+}
+
+static char *utt_utt_FANIN_internal_init_deps_key_functions_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_utt_internal_taskpool_t *__parsec_tp = (__parsec_utt_internal_taskpool_t *)user_data;
+  __parsec_utt_FANIN_parsec_assignment_t __jdf2c__assignments = {  .i.value = 0, .j.value = 0 };
+  int i = (__parsec_key) % __parsec_tp->FANIN_i_range + __parsec_tp->FANIN_i_min;
+  __parsec_key = __parsec_key / __parsec_tp->FANIN_i_range;
+  __jdf2c__assignments.i.value = i;
+  int j = (__parsec_key) % __parsec_tp->FANIN_j_range + __parsec_tp->FANIN_j_min;
+  __parsec_key = __parsec_key / __parsec_tp->FANIN_j_range;
+  __jdf2c__assignments.j.value = j;
+  (void)__jdf2c__assignments;
+  snprintf(buffer, buffer_size, "FANIN(%d, %d)", i, j);
+  return buffer;
+}
+
+static parsec_key_fn_t utt_utt_FANIN_internal_init_deps_key_functions = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = utt_utt_FANIN_internal_init_deps_key_functions_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/* Needs: min-max - iterate */
+static int utt_FANIN_internal_init(parsec_execution_stream_t * es, __parsec_utt_FANIN_task_t * this_task)
+{
+  __parsec_utt_internal_taskpool_t *__parsec_tp = (__parsec_utt_internal_taskpool_t*)this_task->taskpool;
+int32_t __i_min = 0x7fffffff, __i_max = 0;int32_t __jdf2c_i_min = 0x7fffffff, __jdf2c_i_max = 0;int32_t __j_min = 0x7fffffff, __j_max = 0;int32_t __jdf2c_j_min = 0x7fffffff, __jdf2c_j_max = 0;  __parsec_utt_FANIN_parsec_assignment_t assignments = {  .i.value = 0, .j.value = 0 };
+  int32_t  i,  j;
+  int32_t __jdf2c_i_start, __jdf2c_i_end, __jdf2c_i_inc;
+  int32_t __jdf2c_j_start, __jdf2c_j_end, __jdf2c_j_inc;
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+  PARSEC_PROFILING_TRACE(es->es_profile,
+                         this_task->taskpool->profiling_array[START_KEY(this_task->task_class->task_class_id)],
+                         0,
+                         this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    __jdf2c_i_start = 0;
+    __jdf2c_i_end = (NT - 1);
+    __jdf2c_i_inc = 1;
+    __i_min = parsec_imin(__jdf2c_i_start, __jdf2c_i_end);
+    __i_max = parsec_imax(__jdf2c_i_start, __jdf2c_i_end);
+    __jdf2c_i_min = parsec_imin(__jdf2c_i_min, __i_min);
+    __jdf2c_i_max = parsec_imax(__jdf2c_i_max, __i_max);
+    for(i =  __jdf2c_i_start;
+        i <= __jdf2c_i_end;
+        i += __jdf2c_i_inc) {
+    assignments.i.value = i;
+      __jdf2c_j_start = 0;
+      __jdf2c_j_end = utt_FANIN_inline_c_expr1_line_63(__parsec_tp, &assignments);
+      __jdf2c_j_inc = 1;
+      __j_min = parsec_imin(__jdf2c_j_start, __jdf2c_j_end);
+      __j_max = parsec_imax(__jdf2c_j_start, __jdf2c_j_end);
+      __jdf2c_j_min = parsec_imin(__jdf2c_j_min, __j_min);
+      __jdf2c_j_max = parsec_imax(__jdf2c_j_max, __j_max);
+      for(j =  __jdf2c_j_start;
+          j <= __jdf2c_j_end;
+          j += __jdf2c_j_inc) {
+      assignments.j.value = j;
+      if( !FANIN_pred(i, j) ) continue;
+    } /* Loop on normal range j */
+  } /* For loop of i */ 
+  /* Set the range variables for the collision-free hash-computation */
+  __parsec_tp->FANIN_i_min   = __jdf2c_i_min;
+  __parsec_tp->FANIN_i_range = (__jdf2c_i_max - __jdf2c_i_min) + 1;
+  __parsec_tp->FANIN_j_min   = __jdf2c_j_min;
+  __parsec_tp->FANIN_j_range = (__jdf2c_j_max - __jdf2c_j_min) + 1;
+  this_task->status = PARSEC_TASK_STATUS_COMPLETE;
+
+  PARSEC_AYU_REGISTER_TASK(&utt_FANIN);
+  __parsec_tp->super.super.dependencies_array[2] = PARSEC_OBJ_NEW(parsec_hash_table_t);
+  parsec_hash_table_init(__parsec_tp->super.super.dependencies_array[2], offsetof(parsec_hashable_dependency_t, ht_item), 10, utt_utt_FANIN_internal_init_deps_key_functions, this_task->taskpool);
+  __parsec_tp->repositories[2] = data_repo_create_nothreadsafe(PARSEC_DEFAULT_DATAREPO_HASH_LENGTH, __jdf2c_key_fns_FANIN, (parsec_taskpool_t*)__parsec_tp, 1);
+(void)__i_min; (void)__i_max;(void)__j_min; (void)__j_max;  (void)__jdf2c_i_start; (void)__jdf2c_i_end; (void)__jdf2c_i_inc;  (void)__jdf2c_j_start; (void)__jdf2c_j_end; (void)__jdf2c_j_inc;  (void)assignments; (void)__parsec_tp; (void)es;
+  if(1 == parsec_atomic_fetch_dec_int32(&__parsec_tp->sync_point)) {
+    /* Last initialization task complete. Update the number of tasks. */
+    __parsec_tp->sync_point = PARSEC_utt_NB_TASK_CLASSES;
+    //__parsec_tp->super.super.tdm.module->taskpool_addto_nb_tasks(&__parsec_tp->super.super, 1);
+    parsec_mfence();  /* write memory barrier to guarantee that the scheduler gets the correct number of tasks */
+    parsec_taskpool_enable((parsec_taskpool_t*)__parsec_tp, &__parsec_tp->startup_queue,
+                           (parsec_task_t*)this_task, es, __parsec_tp->super.super.nb_pending_actions);
+    __parsec_tp->super.super.tdm.module->taskpool_ready(&__parsec_tp->super.super);
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+    PARSEC_PROFILING_TRACE(es->es_profile,
+                           this_task->taskpool->profiling_array[2 * this_task->task_class->task_class_id + 1],
+                           0,
+                           this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    return PARSEC_HOOK_RETURN_DONE;
+  }
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static const __parsec_chore_t __utt_FANIN_chores[] ={
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+    { .type     = PARSEC_DEV_CPU,
+      .evaluate = (parsec_evaluate_function_t*)NULL,
+      .hook     = (parsec_hook_t*)hook_of_utt_FANIN },
+#endif  /* defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+    { .type     = PARSEC_DEV_NONE,
+      .evaluate = NULL,
+      .hook     = (parsec_hook_t*)NULL },  /* End marker */
+};
+
+static const parsec_task_class_t utt_FANIN = {
+  .name = "FANIN",
+  .task_class_id = 2,
+  .nb_flows = 1,
+  .nb_parameters = 2,
+  .nb_locals = 2,
+  .task_class_type = PARSEC_TASK_CLASS_TYPE_PTG,
+  .params = { &symb_utt_FANIN_i, &symb_utt_FANIN_j, NULL },
+  .locals = { &symb_utt_FANIN_i, &symb_utt_FANIN_j, NULL },
+  .data_affinity = (parsec_data_ref_fn_t*)affinity_of_utt_FANIN,
+  .initial_data = (parsec_data_ref_fn_t*)affinity_of_utt_FANIN,
+  .final_data = (parsec_data_ref_fn_t*)affinity_of_utt_FANIN,
+  .priority = NULL,
+  .properties = properties_of_utt_FANIN,
+#if MAX_PARAM_COUNT < 0  /* number of read flows of FANIN */
+  #error Too many read flows for task FANIN
+#endif  /* MAX_PARAM_COUNT */
+#if MAX_PARAM_COUNT < 0  /* number of write flows of FANIN */
+  #error Too many write flows for task FANIN
+#endif  /* MAX_PARAM_COUNT */
+  .in = { &flow_of_utt_FANIN_for_X, NULL },
+  .out = { &flow_of_utt_FANIN_for_X, NULL },
+  .flags = 0x0|PARSEC_HAS_CTL_GATHER,
+  .dependencies_goal = 1,
+  .make_key = __jdf2c_make_key_FANIN,
+  .task_snprintf = parsec_task_snprintf,
+#if defined(PARSEC_PROF_TRACE)
+  .profile_info = &parsec_task_profile_info,
+#endif
+  .key_functions = &__jdf2c_key_fns_FANIN,
+  .fini = (parsec_hook_t*)NULL,
+  .incarnations = __utt_FANIN_chores,
+  .find_deps = parsec_hash_find_deps,
+  .update_deps = parsec_update_deps_with_counter,
+  .iterate_successors = (parsec_traverse_function_t*)iterate_successors_of_utt_FANIN,
+  .iterate_predecessors = (parsec_traverse_function_t*)iterate_predecessors_of_utt_FANIN,
+  .release_deps = (parsec_release_deps_t*)release_deps_of_utt_FANIN,
+  .prepare_output = (parsec_hook_t*)NULL,
+  .prepare_input = (parsec_hook_t*)data_lookup_of_utt_FANIN,
+  .time_estimate = NULL,
+  .get_datatype = datatype_lookup_of_utt_FANIN,
+  .complete_execution = (parsec_hook_t*)complete_hook_of_utt_FANIN,
+  .release_task = &release_task_of_utt_FANIN,
+#if defined(PARSEC_SIM)
+  .sim_cost_fct = (parsec_sim_cost_fct_t*)NULL,
+#endif
+};
+
+
+/******                                    FANOUT                                    ******/
+
+static inline int32_t minexpr_of_symb_utt_FANOUT_i_fct(const __parsec_utt_internal_taskpool_t *__parsec_tp, const __parsec_utt_FANOUT_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_utt_FANOUT_i = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_utt_FANOUT_i_fct }
+                   }
+};
+static inline int maxexpr_of_symb_utt_FANOUT_i_fct(const __parsec_utt_internal_taskpool_t *__parsec_tp, const __parsec_utt_FANOUT_parsec_assignment_t *locals)
+{
+  const int i = locals->i.value; (void)i;
+  const int j = locals->j.value; (void)j;
+
+  (void)i;
+  (void)j;
+  (void)__parsec_tp; (void)locals;
+  return (NT - 1);
+}
+static const parsec_expr_t maxexpr_of_symb_utt_FANOUT_i = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_utt_FANOUT_i_fct }
+                   }
+};
+static const parsec_symbol_t symb_utt_FANOUT_i = { .name = "i", .context_index = 0, .min = &minexpr_of_symb_utt_FANOUT_i, .max = &maxexpr_of_symb_utt_FANOUT_i, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int32_t minexpr_of_symb_utt_FANOUT_j_fct(const __parsec_utt_internal_taskpool_t *__parsec_tp, const __parsec_utt_FANOUT_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_utt_FANOUT_j = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_utt_FANOUT_j_fct }
+                   }
+};
+static inline int32_t maxexpr_of_symb_utt_FANOUT_j_fct(const __parsec_utt_internal_taskpool_t *__parsec_tp, const __parsec_utt_FANOUT_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return utt_FANOUT_inline_c_expr2_line_44(__parsec_tp, locals);
+}
+static const parsec_expr_t maxexpr_of_symb_utt_FANOUT_j = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_utt_FANOUT_j_fct }
+                   }
+};
+static const parsec_symbol_t symb_utt_FANOUT_j = { .name = "j", .context_index = 1, .min = &minexpr_of_symb_utt_FANOUT_j, .max = &maxexpr_of_symb_utt_FANOUT_j, .cst_inc = 1, .expr_inc = NULL,  .flags = 0x0};
+
+static inline int affinity_of_utt_FANOUT(const __parsec_utt_FANOUT_task_t *this_task,
+                     parsec_data_ref_t *ref)
+{
+    const __parsec_utt_internal_taskpool_t *__parsec_tp = (const __parsec_utt_internal_taskpool_t*)this_task->taskpool;
+  const int i = this_task->locals.i.value; (void)i;
+  const int j = this_task->locals.j.value; (void)j;
+
+  /* Silent Warnings: should look into predicate to know what variables are usefull */
+  (void)i;
+  (void)j;
+  ref->dc = (parsec_data_collection_t *)__parsec_tp->super._g_descA;
+  /* Compute data key */
+  ref->key = ref->dc->data_key(ref->dc, i, j);
+  return 1;
+}
+static const parsec_property_t properties_of_utt_FANOUT[1] = {
+  {.name = NULL, .expr = NULL}
+};
+static inline int expr_of_cond_for_flow_of_utt_FANOUT_for_X_dep1_atline_48_iftrue_fct(const __parsec_utt_internal_taskpool_t *__parsec_tp, const __parsec_utt_FANOUT_parsec_assignment_t *locals)
+{
+  const int i = locals->i.value;
+  const int j = locals->j.value; (void)j;
+
+  (void)i;
+  (void)j;
+  (void)__parsec_tp; (void)locals;
+  return (i) == (0);
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_utt_FANOUT_for_X_dep1_atline_48_iftrue = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_utt_FANOUT_for_X_dep1_atline_48_iftrue_fct }
+                   }
+};
+static const parsec_dep_t flow_of_utt_FANOUT_for_X_dep1_atline_48_iftrue = {
+  .cond = &expr_of_cond_for_flow_of_utt_FANOUT_for_X_dep1_atline_48_iftrue,  /* (i) == (0) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 0, /* utt_STARTUP */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_utt_STARTUP_for_X,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_utt_FANOUT_for_X,
+};
+static inline int expr_of_cond_for_flow_of_utt_FANOUT_for_X_dep1_atline_48_iffalse_fct(const __parsec_utt_internal_taskpool_t *__parsec_tp, const __parsec_utt_FANOUT_parsec_assignment_t *locals)
+{
+  const int i = locals->i.value;
+  const int j = locals->j.value; (void)j;
+
+  (void)i;
+  (void)j;
+  (void)__parsec_tp; (void)locals;
+  return !((i) == (0));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_utt_FANOUT_for_X_dep1_atline_48_iffalse = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_utt_FANOUT_for_X_dep1_atline_48_iffalse_fct }
+                   }
+};
+static const parsec_dep_t flow_of_utt_FANOUT_for_X_dep1_atline_48_iffalse = {
+  .cond = &expr_of_cond_for_flow_of_utt_FANOUT_for_X_dep1_atline_48_iffalse,  /* !(i) == (0) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 1, /* utt_FANOUT */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_utt_FANOUT_for_X,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_utt_FANOUT_for_X,
+};
+static inline int expr_of_cond_for_flow_of_utt_FANOUT_for_X_dep2_atline_50_iftrue_fct(const __parsec_utt_internal_taskpool_t *__parsec_tp, const __parsec_utt_FANOUT_parsec_assignment_t *locals)
+{
+  const int i = locals->i.value; (void)i;
+  const int j = locals->j.value; (void)j;
+
+  (void)i;
+  (void)j;
+  (void)__parsec_tp; (void)locals;
+  return ((i + 1)) < (NT);
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_utt_FANOUT_for_X_dep2_atline_50_iftrue = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_utt_FANOUT_for_X_dep2_atline_50_iftrue_fct }
+                   }
+};
+static const parsec_dep_t flow_of_utt_FANOUT_for_X_dep2_atline_50_iftrue = {
+  .cond = &expr_of_cond_for_flow_of_utt_FANOUT_for_X_dep2_atline_50_iftrue,  /* ((i + 1)) < (NT) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 1, /* utt_FANOUT */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_utt_FANOUT_for_X,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_utt_FANOUT_for_X,
+};
+static inline int expr_of_cond_for_flow_of_utt_FANOUT_for_X_dep2_atline_50_iffalse_fct(const __parsec_utt_internal_taskpool_t *__parsec_tp, const __parsec_utt_FANOUT_parsec_assignment_t *locals)
+{
+  const int i = locals->i.value; (void)i;
+  const int j = locals->j.value; (void)j;
+
+  (void)i;
+  (void)j;
+  (void)__parsec_tp; (void)locals;
+  return !(((i + 1)) < (NT));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_utt_FANOUT_for_X_dep2_atline_50_iffalse = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_utt_FANOUT_for_X_dep2_atline_50_iffalse_fct }
+                   }
+};
+static const parsec_dep_t flow_of_utt_FANOUT_for_X_dep2_atline_50_iffalse = {
+  .cond = &expr_of_cond_for_flow_of_utt_FANOUT_for_X_dep2_atline_50_iffalse,  /* !((i + 1)) < (NT) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 2, /* utt_FANIN */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_utt_FANIN_for_X,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_utt_FANOUT_for_X,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+#if MAX_DEP_OUT_COUNT < 1  /* number of output dependencies */
+    #error Too many output dependencies (supports up to MAX_DEP_OUT_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_OUT_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_utt_FANOUT_for_X = {
+  .name               = "X",
+  .sym_type           = PARSEC_SYM_INOUT,
+  .flow_flags         = PARSEC_FLOW_ACCESS_NONE,
+  .flow_index         = 0,
+  .flow_datatype_mask = 0x1,
+  .dep_in     = { &flow_of_utt_FANOUT_for_X_dep1_atline_48_iftrue,
+ &flow_of_utt_FANOUT_for_X_dep1_atline_48_iffalse },
+  .dep_out    = { &flow_of_utt_FANOUT_for_X_dep2_atline_50_iftrue,
+ &flow_of_utt_FANOUT_for_X_dep2_atline_50_iffalse }
+};
+
+static void
+iterate_successors_of_utt_FANOUT(parsec_execution_stream_t *es, const __parsec_utt_FANOUT_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_utt_internal_taskpool_t *__parsec_tp = (const __parsec_utt_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_utt_FANOUT_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_utt_FANOUT_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int i = __jdf2c__tmp_locals.i.value; (void)i;
+  const int j = __jdf2c__tmp_locals.j.value; (void)j;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)i;  (void)j;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_descA(i, j);
+#endif
+  if( action_mask & 0x1 ) {  /* Flow of data X [0] */
+    data.data   = this_task->data._f_X.data_out;
+    data.data_future  = NULL;
+    if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  =   /* Control: always empty */ 0;
+    data.local.dst_count  =   /* Control: always empty */ 0;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = NULL;
+    data.remote.src_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.src_count  =   /* Control: always empty */ 0;
+    data.remote.dst_count  =   /* Control: always empty */ 0;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+       if( ((i + 1)) < (NT) ) {
+      __parsec_utt_FANOUT_task_t* ncc = (__parsec_utt_FANOUT_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[utt_FANOUT.task_class_id];
+        const int FANOUT_i = (i + 1);
+        if( (FANOUT_i >= (0)) && (FANOUT_i <= ((NT - 1))) ) {
+          assert(&nc.locals[0].value == &ncc->locals.i.value);
+          ncc->locals.i.value = FANOUT_i;
+          int FANOUT_j;
+        for( FANOUT_j = (2 * j);FANOUT_j <= ((2 * j) + 1); FANOUT_j+=1) {
+            if( (FANOUT_j >= (0)) && (FANOUT_j <= (utt_FANOUT_inline_c_expr2_line_44(__parsec_tp, &ncc->locals))) ) {
+              assert(&nc.locals[1].value == &ncc->locals.j.value);
+              ncc->locals.j.value = FANOUT_j;
+#if defined(DISTRIBUTED)
+              rank_dst = rank_of_descA(ncc->locals.i.value, ncc->locals.j.value);
+              if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+                vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, ncc->locals.i.value, ncc->locals.j.value);
+              nc.priority = __parsec_tp->super.super.priority;
+              successor_repo = FANOUT_repo;
+              successor_repo_key = __jdf2c_make_key_FANOUT((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+            RELEASE_DEP_OUTPUT(es, "X", this_task, "X", &nc, rank_src, rank_dst, &data);
+            if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_utt_FANOUT_for_X_dep2_atline_50_iftrue, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+              }
+            }
+          }
+    } else {
+      __parsec_utt_FANIN_task_t* ncc = (__parsec_utt_FANIN_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[utt_FANIN.task_class_id];
+        const int FANIN_i = i;
+        if( (FANIN_i >= (0)) && (FANIN_i <= ((NT - 1))) ) {
+          assert(&nc.locals[0].value == &ncc->locals.i.value);
+          ncc->locals.i.value = FANIN_i;
+          const int FANIN_j = j;
+          if( (FANIN_j >= (0)) && (FANIN_j <= (utt_FANIN_inline_c_expr1_line_63(__parsec_tp, &ncc->locals))) ) {
+            assert(&nc.locals[1].value == &ncc->locals.j.value);
+            ncc->locals.j.value = FANIN_j;
+#if defined(DISTRIBUTED)
+            rank_dst = rank_of_descA(ncc->locals.i.value, ncc->locals.j.value);
+            if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+              vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, ncc->locals.i.value, ncc->locals.j.value);
+            nc.priority = __parsec_tp->super.super.priority;
+            successor_repo = FANIN_repo;
+            successor_repo_key = __jdf2c_make_key_FANIN((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+          RELEASE_DEP_OUTPUT(es, "X", this_task, "X", &nc, rank_src, rank_dst, &data);
+          if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_utt_FANOUT_for_X_dep2_atline_50_iffalse, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+            }
+          }
+    }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static void
+iterate_predecessors_of_utt_FANOUT(parsec_execution_stream_t *es, const __parsec_utt_FANOUT_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_utt_internal_taskpool_t *__parsec_tp = (const __parsec_utt_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_utt_FANOUT_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_utt_FANOUT_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int i = __jdf2c__tmp_locals.i.value; (void)i;
+  const int j = __jdf2c__tmp_locals.j.value; (void)j;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)i;  (void)j;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_descA(i, j);
+#endif
+  if( action_mask & 0x1 ) {  /* Flow of data X [0] */
+    data.data   = this_task->data._f_X.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x1 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  =   /* Control: always empty */ 0;
+    data.local.dst_count  =   /* Control: always empty */ 0;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = NULL;
+    data.remote.src_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.src_count  =   /* Control: always empty */ 0;
+    data.remote.dst_count  =   /* Control: always empty */ 0;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( (i) == (0) ) {
+      __parsec_utt_STARTUP_task_t* ncc = (__parsec_utt_STARTUP_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[utt_STARTUP.task_class_id];
+        const int STARTUP_i = 0;
+        if( (STARTUP_i >= (0)) && (STARTUP_i <= (0)) ) {
+          assert(&nc.locals[0].value == &ncc->locals.i.value);
+          ncc->locals.i.value = STARTUP_i;
+#if defined(DISTRIBUTED)
+          rank_dst = rank_of_descA(0, 0);
+          if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+            vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, 0, 0);
+          nc.priority = __parsec_tp->super.super.priority;
+          successor_repo = NULL;
+          successor_repo_key = 0;
+        RELEASE_DEP_OUTPUT(es, "X", this_task, "X", &nc, rank_src, rank_dst, &data);
+        if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_utt_FANOUT_for_X_dep1_atline_48_iftrue, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+          }
+    } else {
+      __parsec_utt_FANOUT_task_t* ncc = (__parsec_utt_FANOUT_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[utt_FANOUT.task_class_id];
+        const int FANOUT_i = (i - 1);
+        if( (FANOUT_i >= (0)) && (FANOUT_i <= ((NT - 1))) ) {
+          assert(&nc.locals[0].value == &ncc->locals.i.value);
+          ncc->locals.i.value = FANOUT_i;
+          const int FANOUT_j = (j / 2);
+          if( (FANOUT_j >= (0)) && (FANOUT_j <= (utt_FANOUT_inline_c_expr2_line_44(__parsec_tp, &ncc->locals))) ) {
+            assert(&nc.locals[1].value == &ncc->locals.j.value);
+            ncc->locals.j.value = FANOUT_j;
+#if defined(DISTRIBUTED)
+            rank_dst = rank_of_descA(ncc->locals.i.value, ncc->locals.j.value);
+            if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+              vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, ncc->locals.i.value, ncc->locals.j.value);
+            nc.priority = __parsec_tp->super.super.priority;
+            successor_repo = FANOUT_repo;
+            successor_repo_key = __jdf2c_make_key_FANOUT((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+          RELEASE_DEP_OUTPUT(es, "X", this_task, "X", &nc, rank_src, rank_dst, &data);
+          if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_utt_FANOUT_for_X_dep1_atline_48_iffalse, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+            }
+          }
+    }
+  }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static int release_deps_of_utt_FANOUT(parsec_execution_stream_t *es, __parsec_utt_FANOUT_task_t *this_task, uint32_t action_mask, parsec_remote_deps_t *deps)
+{
+  PARSEC_PINS(es, RELEASE_DEPS_BEGIN, (parsec_task_t *)this_task);  const __parsec_utt_internal_taskpool_t *__parsec_tp = (const __parsec_utt_internal_taskpool_t *)this_task->taskpool;
+  parsec_release_dep_fct_arg_t arg;
+  int __vp_id;
+  int consume_local_repo = 0;
+  arg.action_mask = action_mask;
+  arg.output_entry = NULL;
+  arg.output_repo = NULL;
+#if defined(DISTRIBUTED)
+  arg.remote_deps = deps;
+#endif  /* defined(DISTRIBUTED) */
+  assert(NULL != es);
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS )    arg.ready_lists = alloca(sizeof(parsec_task_t *) * es->virtual_process->parsec_context->nb_vp);
+  else
+    arg.ready_lists = NULL;
+  for( __vp_id = 0; __vp_id < es->virtual_process->parsec_context->nb_vp; arg.ready_lists[__vp_id++] = NULL );
+  (void)__parsec_tp; (void)deps;
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+  }
+  consume_local_repo = (this_task->repo_entry != NULL);
+  arg.output_repo = FANOUT_repo;
+  arg.output_entry = this_task->repo_entry;
+  arg.output_usage = 0;
+  if( action_mask & (PARSEC_ACTION_RELEASE_LOCAL_DEPS | PARSEC_ACTION_GET_REPO_ENTRY) ) {
+    arg.output_entry = data_repo_lookup_entry_and_create( es, arg.output_repo, __jdf2c_make_key_FANOUT((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    arg.output_entry->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(arg.output_entry->sim_exec_date == 0);
+    arg.output_entry->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  if(action_mask & ( PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE ) ){
+    /* Generate the reshape promise for the outputs that need it */
+    iterate_successors_of_utt_FANOUT(es, this_task, action_mask, parsec_set_up_reshape_promise, &arg);
+   }
+  iterate_successors_of_utt_FANOUT(es, this_task, action_mask, parsec_release_dep_fct, &arg);
+
+#if defined(DISTRIBUTED)
+  if( (action_mask & PARSEC_ACTION_SEND_REMOTE_DEPS) && (NULL != arg.remote_deps)) {
+    parsec_remote_dep_activate(es, (parsec_task_t *)this_task, arg.remote_deps, arg.remote_deps->outgoing_mask);
+  }
+#endif
+
+  if(action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS) {
+    data_repo_entry_addto_usage_limit(FANOUT_repo, arg.output_entry->ht_item.key, arg.output_usage);
+    __parsec_schedule_vp(es, arg.ready_lists, 0);
+  }
+      if (consume_local_repo) {
+         data_repo_entry_used_once( FANOUT_repo, this_task->repo_entry->ht_item.key );
+      }
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+  }
+  PARSEC_PINS(es, RELEASE_DEPS_END, (parsec_task_t *)this_task);  return 0;
+}
+
+static int data_lookup_of_utt_FANOUT(parsec_execution_stream_t *es, __parsec_utt_FANOUT_task_t *this_task)
+{
+  const __parsec_utt_internal_taskpool_t *__parsec_tp = (__parsec_utt_internal_taskpool_t *)this_task->taskpool;
+  parsec_assignment_t generic_locals[MAX_PARAM_COUNT];  /* generic task locals */
+  int target_device = 0; (void)target_device;
+  (void)__parsec_tp; (void)generic_locals; (void)es;
+  parsec_data_copy_t *chunk = NULL;
+  data_repo_t        *reshape_repo  = NULL, *consumed_repo  = NULL;
+  data_repo_entry_t  *reshape_entry = NULL, *consumed_entry = NULL;
+  parsec_key_t        reshape_entry_key = 0, consumed_entry_key = 0;
+  uint8_t             consumed_flow_index;
+  parsec_dep_data_description_t data;
+  int ret;
+  (void)reshape_repo; (void)reshape_entry; (void)reshape_entry_key;
+  (void)consumed_repo; (void)consumed_entry; (void)consumed_entry_key;
+  (void)consumed_flow_index;
+  (void)chunk; (void)data; (void)ret;
+  const int i = this_task->locals.i.value; (void)i;
+  const int j = this_task->locals.j.value; (void)j;
+  if( NULL == this_task->repo_entry ){
+    this_task->repo_entry = data_repo_lookup_entry_and_create(es, FANOUT_repo,                                       __jdf2c_make_key_FANOUT((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    data_repo_entry_addto_usage_limit(FANOUT_repo, this_task->repo_entry->ht_item.key, 1);    this_task->repo_entry ->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(this_task->repo_entry ->sim_exec_date == 0);
+    this_task->repo_entry ->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  /* The reshape repo is the current task repo. */  reshape_repo = FANOUT_repo;
+  reshape_entry_key = __jdf2c_make_key_FANOUT((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals) ;
+  reshape_entry = this_task->repo_entry;
+  /* Lookup the input data, and store them in the context if any */
+  /* X is a control flow */
+  this_task->data._f_X.data_in         = NULL;
+  this_task->data._f_X.data_out        = NULL;
+  this_task->data._f_X.source_repo       = NULL;
+  this_task->data._f_X.source_repo_entry = NULL;
+  /** Generate profiling information */
+#if defined(PARSEC_PROF_TRACE)
+  this_task->prof_info.desc = (parsec_data_collection_t*)__parsec_tp->super._g_descA;
+  this_task->prof_info.priority = this_task->priority;
+  this_task->prof_info.data_id   = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->data_key((parsec_data_collection_t*)__parsec_tp->super._g_descA, i, j);
+  this_task->prof_info.task_class_id = this_task->task_class->task_class_id;
+  this_task->prof_info.task_return_code = -1;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int datatype_lookup_of_utt_FANOUT(parsec_execution_stream_t *es, const parsec_task_t *this_generic_task, const parsec_task_t *parent_task,
+              uint32_t* flow_mask, parsec_dep_data_description_t* data)
+{
+  const __parsec_utt_FANOUT_task_t *this_task = (__parsec_utt_FANOUT_task_t*)this_generic_task;
+  const __parsec_utt_internal_taskpool_t *__parsec_tp = (__parsec_utt_internal_taskpool_t *)this_task->taskpool;
+  (void)__parsec_tp; (void)es; (void)this_task; (void)data; (void)parent_task;
+  const int i = this_task->locals.i.value; (void)i;
+  const int j = this_task->locals.j.value; (void)j;
+  data->local.arena = data->remote.arena = NULL;
+  data->local.src_datatype  = data->local.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->local.src_count     = data->local.dst_count = 0;
+  data->local.src_displ     = data->local.dst_displ = 0;
+  data->data_future  = NULL;
+
+  /* these are the output dependencies remote datatypes */
+  data->data                             = NULL;
+  data->remote.src_datatype = data->remote.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->remote.src_count    = data->remote.dst_count = 0;
+  data->remote.src_displ    = data->remote.dst_displ = 0;
+  data->data_future  = NULL;
+  (*flow_mask) = 0;  /* nothing left */
+  (void)i;  (void)j;
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+static int hook_of_utt_FANOUT(parsec_execution_stream_t *es, __parsec_utt_FANOUT_task_t *this_task)
+{
+  __parsec_utt_internal_taskpool_t *__parsec_tp = (__parsec_utt_internal_taskpool_t *)this_task->taskpool;
+  (void)es; (void)__parsec_tp;
+  const int i = this_task->locals.i.value; (void)i;
+  const int j = this_task->locals.j.value; (void)j;
+  (void)i;  (void)j;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                                  FANOUT BODY                                  -----*/
+
+{
+    if(verbose)
+        printf("FANOUT(%d, %d) on rank %d\n", i, j, this_task->taskpool->context->my_rank);
+    parsec_atomic_fetch_inc_int32(tasks_cnt);
+}
+
+/*-----                              END OF FANOUT BODY                              -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#endif  /*  defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+static int complete_hook_of_utt_FANOUT(parsec_execution_stream_t *es, __parsec_utt_FANOUT_task_t *this_task)
+{
+  const __parsec_utt_internal_taskpool_t *__parsec_tp = (__parsec_utt_internal_taskpool_t *)this_task->taskpool;
+#if defined(DISTRIBUTED)
+    const int i = this_task->locals.i.value; (void)i;
+  const int j = this_task->locals.j.value; (void)j;
+#endif  /* defined(DISTRIBUTED) */
+  (void)es; (void)__parsec_tp;
+parsec_data_t* data_t_desc = NULL; (void)data_t_desc;
+#if defined(DISTRIBUTED)
+  /** If not working on distributed, there is no risk that data is not in place */
+  (void)i;  (void)j;
+
+#endif /* DISTRIBUTED */
+#if defined(PARSEC_PROF_GRAPHER)
+  parsec_prof_grapher_task((parsec_task_t*)this_task, es->th_id, es->virtual_process->vp_id,
+     __jdf2c_key_fns_FANOUT.key_hash(this_task->task_class->make_key( (parsec_taskpool_t*)this_task->taskpool, ((parsec_task_t*)this_task)->locals), NULL));
+#endif  /* defined(PARSEC_PROF_GRAPHER) */
+  release_deps_of_utt_FANOUT(es, this_task,
+      PARSEC_ACTION_RELEASE_REMOTE_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_REFS |
+      PARSEC_ACTION_RESHAPE_ON_RELEASE |
+      0x1,  /* mask of all dep_index */ 
+      NULL);
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static parsec_hook_return_t release_task_of_utt_FANOUT(parsec_execution_stream_t *es, parsec_task_t *this_task)
+{
+    const __parsec_utt_internal_taskpool_t *__parsec_tp =
+        (const __parsec_utt_internal_taskpool_t *)this_task->taskpool;
+    parsec_hash_table_t *ht = (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[1];
+    parsec_key_t key = this_task->task_class->make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals);
+    parsec_hashable_dependency_t *hash_dep = (parsec_hashable_dependency_t *)parsec_hash_table_remove(ht, key);
+    parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);
+    return parsec_release_task_to_mempool_update_nbtasks(es, this_task);
+}
+
+static char *utt_utt_FANOUT_internal_init_deps_key_functions_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_utt_internal_taskpool_t *__parsec_tp = (__parsec_utt_internal_taskpool_t *)user_data;
+  __parsec_utt_FANOUT_parsec_assignment_t __jdf2c__assignments = {  .i.value = 0, .j.value = 0 };
+  int i = (__parsec_key) % __parsec_tp->FANOUT_i_range + __parsec_tp->FANOUT_i_min;
+  __parsec_key = __parsec_key / __parsec_tp->FANOUT_i_range;
+  __jdf2c__assignments.i.value = i;
+  int j = (__parsec_key) % __parsec_tp->FANOUT_j_range + __parsec_tp->FANOUT_j_min;
+  __parsec_key = __parsec_key / __parsec_tp->FANOUT_j_range;
+  __jdf2c__assignments.j.value = j;
+  (void)__jdf2c__assignments;
+  snprintf(buffer, buffer_size, "FANOUT(%d, %d)", i, j);
+  return buffer;
+}
+
+static parsec_key_fn_t utt_utt_FANOUT_internal_init_deps_key_functions = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = utt_utt_FANOUT_internal_init_deps_key_functions_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/* Needs: min-max - iterate */
+static int utt_FANOUT_internal_init(parsec_execution_stream_t * es, __parsec_utt_FANOUT_task_t * this_task)
+{
+  __parsec_utt_internal_taskpool_t *__parsec_tp = (__parsec_utt_internal_taskpool_t*)this_task->taskpool;
+int32_t __i_min = 0x7fffffff, __i_max = 0;int32_t __jdf2c_i_min = 0x7fffffff, __jdf2c_i_max = 0;int32_t __j_min = 0x7fffffff, __j_max = 0;int32_t __jdf2c_j_min = 0x7fffffff, __jdf2c_j_max = 0;  __parsec_utt_FANOUT_parsec_assignment_t assignments = {  .i.value = 0, .j.value = 0 };
+  int32_t  i,  j;
+  int32_t __jdf2c_i_start, __jdf2c_i_end, __jdf2c_i_inc;
+  int32_t __jdf2c_j_start, __jdf2c_j_end, __jdf2c_j_inc;
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+  PARSEC_PROFILING_TRACE(es->es_profile,
+                         this_task->taskpool->profiling_array[START_KEY(this_task->task_class->task_class_id)],
+                         0,
+                         this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    __jdf2c_i_start = 0;
+    __jdf2c_i_end = (NT - 1);
+    __jdf2c_i_inc = 1;
+    __i_min = parsec_imin(__jdf2c_i_start, __jdf2c_i_end);
+    __i_max = parsec_imax(__jdf2c_i_start, __jdf2c_i_end);
+    __jdf2c_i_min = parsec_imin(__jdf2c_i_min, __i_min);
+    __jdf2c_i_max = parsec_imax(__jdf2c_i_max, __i_max);
+    for(i =  __jdf2c_i_start;
+        i <= __jdf2c_i_end;
+        i += __jdf2c_i_inc) {
+    assignments.i.value = i;
+      __jdf2c_j_start = 0;
+      __jdf2c_j_end = utt_FANOUT_inline_c_expr2_line_44(__parsec_tp, &assignments);
+      __jdf2c_j_inc = 1;
+      __j_min = parsec_imin(__jdf2c_j_start, __jdf2c_j_end);
+      __j_max = parsec_imax(__jdf2c_j_start, __jdf2c_j_end);
+      __jdf2c_j_min = parsec_imin(__jdf2c_j_min, __j_min);
+      __jdf2c_j_max = parsec_imax(__jdf2c_j_max, __j_max);
+      for(j =  __jdf2c_j_start;
+          j <= __jdf2c_j_end;
+          j += __jdf2c_j_inc) {
+      assignments.j.value = j;
+      if( !FANOUT_pred(i, j) ) continue;
+    } /* Loop on normal range j */
+  } /* For loop of i */ 
+  /* Set the range variables for the collision-free hash-computation */
+  __parsec_tp->FANOUT_i_min   = __jdf2c_i_min;
+  __parsec_tp->FANOUT_i_range = (__jdf2c_i_max - __jdf2c_i_min) + 1;
+  __parsec_tp->FANOUT_j_min   = __jdf2c_j_min;
+  __parsec_tp->FANOUT_j_range = (__jdf2c_j_max - __jdf2c_j_min) + 1;
+  this_task->status = PARSEC_TASK_STATUS_COMPLETE;
+
+  PARSEC_AYU_REGISTER_TASK(&utt_FANOUT);
+  __parsec_tp->super.super.dependencies_array[1] = PARSEC_OBJ_NEW(parsec_hash_table_t);
+  parsec_hash_table_init(__parsec_tp->super.super.dependencies_array[1], offsetof(parsec_hashable_dependency_t, ht_item), 10, utt_utt_FANOUT_internal_init_deps_key_functions, this_task->taskpool);
+  __parsec_tp->repositories[1] = data_repo_create_nothreadsafe(PARSEC_DEFAULT_DATAREPO_HASH_LENGTH, __jdf2c_key_fns_FANOUT, (parsec_taskpool_t*)__parsec_tp, 1);
+(void)__i_min; (void)__i_max;(void)__j_min; (void)__j_max;  (void)__jdf2c_i_start; (void)__jdf2c_i_end; (void)__jdf2c_i_inc;  (void)__jdf2c_j_start; (void)__jdf2c_j_end; (void)__jdf2c_j_inc;  (void)assignments; (void)__parsec_tp; (void)es;
+  if(1 == parsec_atomic_fetch_dec_int32(&__parsec_tp->sync_point)) {
+    /* Last initialization task complete. Update the number of tasks. */
+    __parsec_tp->sync_point = PARSEC_utt_NB_TASK_CLASSES;
+    //__parsec_tp->super.super.tdm.module->taskpool_addto_nb_tasks(&__parsec_tp->super.super, 1);
+    parsec_mfence();  /* write memory barrier to guarantee that the scheduler gets the correct number of tasks */
+    parsec_taskpool_enable((parsec_taskpool_t*)__parsec_tp, &__parsec_tp->startup_queue,
+                           (parsec_task_t*)this_task, es, __parsec_tp->super.super.nb_pending_actions);
+    __parsec_tp->super.super.tdm.module->taskpool_ready(&__parsec_tp->super.super);
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+    PARSEC_PROFILING_TRACE(es->es_profile,
+                           this_task->taskpool->profiling_array[2 * this_task->task_class->task_class_id + 1],
+                           0,
+                           this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    return PARSEC_HOOK_RETURN_DONE;
+  }
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static const __parsec_chore_t __utt_FANOUT_chores[] ={
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+    { .type     = PARSEC_DEV_CPU,
+      .evaluate = (parsec_evaluate_function_t*)NULL,
+      .hook     = (parsec_hook_t*)hook_of_utt_FANOUT },
+#endif  /* defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+    { .type     = PARSEC_DEV_NONE,
+      .evaluate = NULL,
+      .hook     = (parsec_hook_t*)NULL },  /* End marker */
+};
+
+static const parsec_task_class_t utt_FANOUT = {
+  .name = "FANOUT",
+  .task_class_id = 1,
+  .nb_flows = 1,
+  .nb_parameters = 2,
+  .nb_locals = 2,
+  .task_class_type = PARSEC_TASK_CLASS_TYPE_PTG,
+  .params = { &symb_utt_FANOUT_i, &symb_utt_FANOUT_j, NULL },
+  .locals = { &symb_utt_FANOUT_i, &symb_utt_FANOUT_j, NULL },
+  .data_affinity = (parsec_data_ref_fn_t*)affinity_of_utt_FANOUT,
+  .initial_data = (parsec_data_ref_fn_t*)affinity_of_utt_FANOUT,
+  .final_data = (parsec_data_ref_fn_t*)affinity_of_utt_FANOUT,
+  .priority = NULL,
+  .properties = properties_of_utt_FANOUT,
+#if MAX_PARAM_COUNT < 0  /* number of read flows of FANOUT */
+  #error Too many read flows for task FANOUT
+#endif  /* MAX_PARAM_COUNT */
+#if MAX_PARAM_COUNT < 0  /* number of write flows of FANOUT */
+  #error Too many write flows for task FANOUT
+#endif  /* MAX_PARAM_COUNT */
+  .in = { &flow_of_utt_FANOUT_for_X, NULL },
+  .out = { &flow_of_utt_FANOUT_for_X, NULL },
+  .flags = 0x0 | PARSEC_USE_DEPS_MASK,
+  .dependencies_goal = 0x1,
+  .make_key = __jdf2c_make_key_FANOUT,
+  .task_snprintf = parsec_task_snprintf,
+#if defined(PARSEC_PROF_TRACE)
+  .profile_info = &parsec_task_profile_info,
+#endif
+  .key_functions = &__jdf2c_key_fns_FANOUT,
+  .fini = (parsec_hook_t*)NULL,
+  .incarnations = __utt_FANOUT_chores,
+  .find_deps = parsec_hash_find_deps,
+  .update_deps = parsec_update_deps_with_mask,
+  .iterate_successors = (parsec_traverse_function_t*)iterate_successors_of_utt_FANOUT,
+  .iterate_predecessors = (parsec_traverse_function_t*)iterate_predecessors_of_utt_FANOUT,
+  .release_deps = (parsec_release_deps_t*)release_deps_of_utt_FANOUT,
+  .prepare_output = (parsec_hook_t*)NULL,
+  .prepare_input = (parsec_hook_t*)data_lookup_of_utt_FANOUT,
+  .time_estimate = NULL,
+  .get_datatype = datatype_lookup_of_utt_FANOUT,
+  .complete_execution = (parsec_hook_t*)complete_hook_of_utt_FANOUT,
+  .release_task = &release_task_of_utt_FANOUT,
+#if defined(PARSEC_SIM)
+  .sim_cost_fct = (parsec_sim_cost_fct_t*)NULL,
+#endif
+};
+
+
+/******                                    STARTUP                                    ******/
+
+static inline int32_t minexpr_of_symb_utt_STARTUP_i_fct(const __parsec_utt_internal_taskpool_t *__parsec_tp, const __parsec_utt_STARTUP_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_utt_STARTUP_i = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_utt_STARTUP_i_fct }
+                   }
+};
+static inline int32_t maxexpr_of_symb_utt_STARTUP_i_fct(const __parsec_utt_internal_taskpool_t *__parsec_tp, const __parsec_utt_STARTUP_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t maxexpr_of_symb_utt_STARTUP_i = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_utt_STARTUP_i_fct }
+                   }
+};
+static const parsec_symbol_t symb_utt_STARTUP_i = { .name = "i", .context_index = 0, .min = &minexpr_of_symb_utt_STARTUP_i, .max = &maxexpr_of_symb_utt_STARTUP_i, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int affinity_of_utt_STARTUP(const __parsec_utt_STARTUP_task_t *this_task,
+                     parsec_data_ref_t *ref)
+{
+    const __parsec_utt_internal_taskpool_t *__parsec_tp = (const __parsec_utt_internal_taskpool_t*)this_task->taskpool;
+  const int i = this_task->locals.i.value; (void)i;
+
+  /* Silent Warnings: should look into predicate to know what variables are usefull */
+  (void)i;
+  ref->dc = (parsec_data_collection_t *)__parsec_tp->super._g_descA;
+  /* Compute data key */
+  ref->key = ref->dc->data_key(ref->dc, 0, 0);
+  return 1;
+}
+static const parsec_property_t properties_of_utt_STARTUP[1] = {
+  {.name = NULL, .expr = NULL}
+};
+static const parsec_dep_t flow_of_utt_STARTUP_for_X_dep1_atline_32 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 1, /* utt_FANOUT */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_utt_FANOUT_for_X,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_utt_STARTUP_for_X,
+};
+#if MAX_DEP_OUT_COUNT < 1  /* number of output dependencies */
+    #error Too many output dependencies (supports up to MAX_DEP_OUT_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_OUT_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_utt_STARTUP_for_X = {
+  .name               = "X",
+  .sym_type           = PARSEC_SYM_OUT,
+  .flow_flags         = PARSEC_FLOW_ACCESS_NONE,
+  .flow_index         = 0,
+  .flow_datatype_mask = 0x1,
+  .dep_in     = { NULL },
+  .dep_out    = { &flow_of_utt_STARTUP_for_X_dep1_atline_32 }
+};
+
+static void
+iterate_successors_of_utt_STARTUP(parsec_execution_stream_t *es, const __parsec_utt_STARTUP_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_utt_internal_taskpool_t *__parsec_tp = (const __parsec_utt_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_utt_STARTUP_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_utt_STARTUP_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int i = __jdf2c__tmp_locals.i.value; (void)i;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)i;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_descA(0, 0);
+#endif
+  if( action_mask & 0x1 ) {  /* Flow of data X [0] */
+    data.data   = this_task->data._f_X.data_out;
+    data.data_future  = NULL;
+    if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  =   /* Control: always empty */ 0;
+    data.local.dst_count  =   /* Control: always empty */ 0;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = NULL;
+    data.remote.src_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.remote.src_count  =   /* Control: always empty */ 0;
+    data.remote.dst_count  =   /* Control: always empty */ 0;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+       __parsec_utt_FANOUT_task_t* ncc = (__parsec_utt_FANOUT_task_t*)&nc;
+    nc.task_class = __parsec_tp->super.super.task_classes_array[utt_FANOUT.task_class_id];
+      const int FANOUT_i = 0;
+      if( (FANOUT_i >= (0)) && (FANOUT_i <= ((NT - 1))) ) {
+        assert(&nc.locals[0].value == &ncc->locals.i.value);
+        ncc->locals.i.value = FANOUT_i;
+        int FANOUT_j;
+      for( FANOUT_j = 0;FANOUT_j <= 1; FANOUT_j+=1) {
+          if( (FANOUT_j >= (0)) && (FANOUT_j <= (utt_FANOUT_inline_c_expr2_line_44(__parsec_tp, &ncc->locals))) ) {
+            assert(&nc.locals[1].value == &ncc->locals.j.value);
+            ncc->locals.j.value = FANOUT_j;
+#if defined(DISTRIBUTED)
+            rank_dst = rank_of_descA(ncc->locals.i.value, ncc->locals.j.value);
+            if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+              vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, ncc->locals.i.value, ncc->locals.j.value);
+            nc.priority = __parsec_tp->super.super.priority;
+            successor_repo = FANOUT_repo;
+            successor_repo_key = __jdf2c_make_key_FANOUT((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+          RELEASE_DEP_OUTPUT(es, "X", this_task, "X", &nc, rank_src, rank_dst, &data);
+          if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_utt_STARTUP_for_X_dep1_atline_32, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+            }
+          }
+        }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static int release_deps_of_utt_STARTUP(parsec_execution_stream_t *es, __parsec_utt_STARTUP_task_t *this_task, uint32_t action_mask, parsec_remote_deps_t *deps)
+{
+  PARSEC_PINS(es, RELEASE_DEPS_BEGIN, (parsec_task_t *)this_task);  const __parsec_utt_internal_taskpool_t *__parsec_tp = (const __parsec_utt_internal_taskpool_t *)this_task->taskpool;
+  parsec_release_dep_fct_arg_t arg;
+  int __vp_id;
+  int consume_local_repo = 0;
+  arg.action_mask = action_mask;
+  arg.output_entry = NULL;
+  arg.output_repo = NULL;
+#if defined(DISTRIBUTED)
+  arg.remote_deps = deps;
+#endif  /* defined(DISTRIBUTED) */
+  assert(NULL != es);
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS )    arg.ready_lists = alloca(sizeof(parsec_task_t *) * es->virtual_process->parsec_context->nb_vp);
+  else
+    arg.ready_lists = NULL;
+  for( __vp_id = 0; __vp_id < es->virtual_process->parsec_context->nb_vp; arg.ready_lists[__vp_id++] = NULL );
+  (void)__parsec_tp; (void)deps;
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+  }
+  consume_local_repo = (this_task->repo_entry != NULL);
+  arg.output_repo = STARTUP_repo;
+  arg.output_entry = this_task->repo_entry;
+  arg.output_usage = 0;
+  if( action_mask & (PARSEC_ACTION_RELEASE_LOCAL_DEPS | PARSEC_ACTION_GET_REPO_ENTRY) ) {
+    arg.output_entry = data_repo_lookup_entry_and_create( es, arg.output_repo, __jdf2c_make_key_STARTUP((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    arg.output_entry->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(arg.output_entry->sim_exec_date == 0);
+    arg.output_entry->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  if(action_mask & ( PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE ) ){
+    /* Generate the reshape promise for the outputs that need it */
+    iterate_successors_of_utt_STARTUP(es, this_task, action_mask, parsec_set_up_reshape_promise, &arg);
+   }
+  iterate_successors_of_utt_STARTUP(es, this_task, action_mask, parsec_release_dep_fct, &arg);
+
+#if defined(DISTRIBUTED)
+  if( (action_mask & PARSEC_ACTION_SEND_REMOTE_DEPS) && (NULL != arg.remote_deps)) {
+    parsec_remote_dep_activate(es, (parsec_task_t *)this_task, arg.remote_deps, arg.remote_deps->outgoing_mask);
+  }
+#endif
+
+  if(action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS) {
+    data_repo_entry_addto_usage_limit(STARTUP_repo, arg.output_entry->ht_item.key, arg.output_usage);
+    __parsec_schedule_vp(es, arg.ready_lists, 0);
+  }
+      if (consume_local_repo) {
+         data_repo_entry_used_once( STARTUP_repo, this_task->repo_entry->ht_item.key );
+      }
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+  }
+  PARSEC_PINS(es, RELEASE_DEPS_END, (parsec_task_t *)this_task);  return 0;
+}
+
+static int data_lookup_of_utt_STARTUP(parsec_execution_stream_t *es, __parsec_utt_STARTUP_task_t *this_task)
+{
+  const __parsec_utt_internal_taskpool_t *__parsec_tp = (__parsec_utt_internal_taskpool_t *)this_task->taskpool;
+  parsec_assignment_t generic_locals[MAX_PARAM_COUNT];  /* generic task locals */
+  int target_device = 0; (void)target_device;
+  (void)__parsec_tp; (void)generic_locals; (void)es;
+  parsec_data_copy_t *chunk = NULL;
+  data_repo_t        *reshape_repo  = NULL, *consumed_repo  = NULL;
+  data_repo_entry_t  *reshape_entry = NULL, *consumed_entry = NULL;
+  parsec_key_t        reshape_entry_key = 0, consumed_entry_key = 0;
+  uint8_t             consumed_flow_index;
+  parsec_dep_data_description_t data;
+  int ret;
+  (void)reshape_repo; (void)reshape_entry; (void)reshape_entry_key;
+  (void)consumed_repo; (void)consumed_entry; (void)consumed_entry_key;
+  (void)consumed_flow_index;
+  (void)chunk; (void)data; (void)ret;
+  const int i = this_task->locals.i.value; (void)i;
+  if( NULL == this_task->repo_entry ){
+    this_task->repo_entry = data_repo_lookup_entry_and_create(es, STARTUP_repo,                                       __jdf2c_make_key_STARTUP((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    data_repo_entry_addto_usage_limit(STARTUP_repo, this_task->repo_entry->ht_item.key, 1);    this_task->repo_entry ->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(this_task->repo_entry ->sim_exec_date == 0);
+    this_task->repo_entry ->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  /* The reshape repo is the current task repo. */  reshape_repo = STARTUP_repo;
+  reshape_entry_key = __jdf2c_make_key_STARTUP((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals) ;
+  reshape_entry = this_task->repo_entry;
+  /* Lookup the input data, and store them in the context if any */
+  /* X is a control flow */
+  this_task->data._f_X.data_in         = NULL;
+  this_task->data._f_X.data_out        = NULL;
+  this_task->data._f_X.source_repo       = NULL;
+  this_task->data._f_X.source_repo_entry = NULL;
+  /** Generate profiling information */
+#if defined(PARSEC_PROF_TRACE)
+  this_task->prof_info.desc = (parsec_data_collection_t*)__parsec_tp->super._g_descA;
+  this_task->prof_info.priority = this_task->priority;
+  this_task->prof_info.data_id   = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->data_key((parsec_data_collection_t*)__parsec_tp->super._g_descA, 0, 0);
+  this_task->prof_info.task_class_id = this_task->task_class->task_class_id;
+  this_task->prof_info.task_return_code = -1;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int datatype_lookup_of_utt_STARTUP(parsec_execution_stream_t *es, const parsec_task_t *this_generic_task, const parsec_task_t *parent_task,
+              uint32_t* flow_mask, parsec_dep_data_description_t* data)
+{
+  const __parsec_utt_STARTUP_task_t *this_task = (__parsec_utt_STARTUP_task_t*)this_generic_task;
+  const __parsec_utt_internal_taskpool_t *__parsec_tp = (__parsec_utt_internal_taskpool_t *)this_task->taskpool;
+  (void)__parsec_tp; (void)es; (void)this_task; (void)data; (void)parent_task;
+  const int i = this_task->locals.i.value; (void)i;
+  data->local.arena = data->remote.arena = NULL;
+  data->local.src_datatype  = data->local.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->local.src_count     = data->local.dst_count = 0;
+  data->local.src_displ     = data->local.dst_displ = 0;
+  data->data_future  = NULL;
+
+  /* these are the output dependencies remote datatypes */
+  data->data                             = NULL;
+  data->remote.src_datatype = data->remote.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->remote.src_count    = data->remote.dst_count = 0;
+  data->remote.src_displ    = data->remote.dst_displ = 0;
+  data->data_future  = NULL;
+  (*flow_mask) = 0;  /* nothing left */
+  (void)i;
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+static int hook_of_utt_STARTUP(parsec_execution_stream_t *es, __parsec_utt_STARTUP_task_t *this_task)
+{
+  __parsec_utt_internal_taskpool_t *__parsec_tp = (__parsec_utt_internal_taskpool_t *)this_task->taskpool;
+  (void)es; (void)__parsec_tp;
+  const int i = this_task->locals.i.value; (void)i;
+  (void)i;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                                  STARTUP BODY                                  -----*/
+
+{
+    if(verbose)
+        printf("STARTUP(0) on rank %d\n", this_task->taskpool->context->my_rank);
+    parsec_atomic_fetch_inc_int32(tasks_cnt);
+}
+
+/*-----                              END OF STARTUP BODY                              -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#endif  /*  defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+static int complete_hook_of_utt_STARTUP(parsec_execution_stream_t *es, __parsec_utt_STARTUP_task_t *this_task)
+{
+  const __parsec_utt_internal_taskpool_t *__parsec_tp = (__parsec_utt_internal_taskpool_t *)this_task->taskpool;
+#if defined(DISTRIBUTED)
+    const int i = this_task->locals.i.value; (void)i;
+#endif  /* defined(DISTRIBUTED) */
+  (void)es; (void)__parsec_tp;
+parsec_data_t* data_t_desc = NULL; (void)data_t_desc;
+#if defined(DISTRIBUTED)
+  /** If not working on distributed, there is no risk that data is not in place */
+  (void)i;
+
+#endif /* DISTRIBUTED */
+#if defined(PARSEC_PROF_GRAPHER)
+  parsec_prof_grapher_task((parsec_task_t*)this_task, es->th_id, es->virtual_process->vp_id,
+     __jdf2c_key_fns_STARTUP.key_hash(this_task->task_class->make_key( (parsec_taskpool_t*)this_task->taskpool, ((parsec_task_t*)this_task)->locals), NULL));
+#endif  /* defined(PARSEC_PROF_GRAPHER) */
+  release_deps_of_utt_STARTUP(es, this_task,
+      PARSEC_ACTION_RELEASE_REMOTE_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_REFS |
+      PARSEC_ACTION_RESHAPE_ON_RELEASE |
+      0x1,  /* mask of all dep_index */ 
+      NULL);
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static parsec_hook_return_t release_task_of_utt_STARTUP(parsec_execution_stream_t *es, parsec_task_t *this_task)
+{
+    const __parsec_utt_internal_taskpool_t *__parsec_tp =
+        (const __parsec_utt_internal_taskpool_t *)this_task->taskpool;
+    parsec_hash_table_t *ht = (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[0];
+    parsec_key_t key = this_task->task_class->make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals);
+    parsec_hashable_dependency_t *hash_dep = (parsec_hashable_dependency_t *)parsec_hash_table_remove(ht, key);
+    parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);
+    return parsec_release_task_to_mempool_update_nbtasks(es, this_task);
+}
+
+static char *utt_utt_STARTUP_internal_init_deps_key_functions_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_utt_internal_taskpool_t *__parsec_tp = (__parsec_utt_internal_taskpool_t *)user_data;
+  int i = (__parsec_key) % __parsec_tp->STARTUP_i_range + __parsec_tp->STARTUP_i_min;
+  __parsec_key = __parsec_key / __parsec_tp->STARTUP_i_range;
+  snprintf(buffer, buffer_size, "STARTUP(%d)", i);
+  return buffer;
+}
+
+static parsec_key_fn_t utt_utt_STARTUP_internal_init_deps_key_functions = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = utt_utt_STARTUP_internal_init_deps_key_functions_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/* Needs: min-max - iterate */
+static int utt_STARTUP_internal_init(parsec_execution_stream_t * es, __parsec_utt_STARTUP_task_t * this_task)
+{
+  __parsec_utt_internal_taskpool_t *__parsec_tp = (__parsec_utt_internal_taskpool_t*)this_task->taskpool;
+int32_t __i_min = 0x7fffffff, __i_max = 0;int32_t __jdf2c_i_min = 0x7fffffff, __jdf2c_i_max = 0;  __parsec_utt_STARTUP_parsec_assignment_t assignments = {  .i.value = 0 };
+  int32_t  i;
+  int32_t __jdf2c_i_start, __jdf2c_i_end, __jdf2c_i_inc;
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+  PARSEC_PROFILING_TRACE(es->es_profile,
+                         this_task->taskpool->profiling_array[START_KEY(this_task->task_class->task_class_id)],
+                         0,
+                         this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    __jdf2c_i_start = 0;
+    __jdf2c_i_end = 0;
+    __jdf2c_i_inc = 1;
+    __i_min = parsec_imin(__jdf2c_i_start, __jdf2c_i_end);
+    __i_max = parsec_imax(__jdf2c_i_start, __jdf2c_i_end);
+    __jdf2c_i_min = parsec_imin(__jdf2c_i_min, __i_min);
+    __jdf2c_i_max = parsec_imax(__jdf2c_i_max, __i_max);
+    for(i =  __jdf2c_i_start;
+        i <= __jdf2c_i_end;
+        i += __jdf2c_i_inc) {
+    assignments.i.value = i;
+    if( !STARTUP_pred(i) ) continue;
+  } /* Loop on normal range i */
+  /* Set the range variables for the collision-free hash-computation */
+  __parsec_tp->STARTUP_i_min   = __jdf2c_i_min;
+  __parsec_tp->STARTUP_i_range = (__jdf2c_i_max - __jdf2c_i_min) + 1;
+    do {
+      this_task->super.list_next = (parsec_list_item_t*)__parsec_tp->startup_queue;
+    } while(!parsec_atomic_cas_ptr(&__parsec_tp->startup_queue, (parsec_list_item_t*)this_task->super.list_next, this_task));
+    this_task->status = PARSEC_TASK_STATUS_HOOK;
+
+  PARSEC_AYU_REGISTER_TASK(&utt_STARTUP);
+  __parsec_tp->super.super.dependencies_array[0] = PARSEC_OBJ_NEW(parsec_hash_table_t);
+  parsec_hash_table_init(__parsec_tp->super.super.dependencies_array[0], offsetof(parsec_hashable_dependency_t, ht_item), 10, utt_utt_STARTUP_internal_init_deps_key_functions, this_task->taskpool);
+  __parsec_tp->repositories[0] = data_repo_create_nothreadsafe(PARSEC_DEFAULT_DATAREPO_HASH_LENGTH, __jdf2c_key_fns_STARTUP, (parsec_taskpool_t*)__parsec_tp, 1);
+(void)__i_min; (void)__i_max;  (void)__jdf2c_i_start; (void)__jdf2c_i_end; (void)__jdf2c_i_inc;  (void)assignments; (void)__parsec_tp; (void)es;
+  if(1 == parsec_atomic_fetch_dec_int32(&__parsec_tp->sync_point)) {
+    /* Last initialization task complete. Update the number of tasks. */
+    __parsec_tp->sync_point = PARSEC_utt_NB_TASK_CLASSES;
+    //__parsec_tp->super.super.tdm.module->taskpool_addto_nb_tasks(&__parsec_tp->super.super, 1);
+    parsec_mfence();  /* write memory barrier to guarantee that the scheduler gets the correct number of tasks */
+    parsec_taskpool_enable((parsec_taskpool_t*)__parsec_tp, &__parsec_tp->startup_queue,
+                           (parsec_task_t*)this_task, es, __parsec_tp->super.super.nb_pending_actions);
+    __parsec_tp->super.super.tdm.module->taskpool_ready(&__parsec_tp->super.super);
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+    PARSEC_PROFILING_TRACE(es->es_profile,
+                           this_task->taskpool->profiling_array[2 * this_task->task_class->task_class_id + 1],
+                           0,
+                           this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    if( 1 >= __parsec_tp->super.super.nb_pending_actions ) {
+        /* if no tasks will be generated let's prevent the runtime from calling the hook and instead go directly to complete the task */
+        this_task->status = PARSEC_TASK_STATUS_COMPLETE;
+    }
+    return PARSEC_HOOK_RETURN_DONE;
+  }
+  return PARSEC_HOOK_RETURN_ASYNC;
+}
+
+static int __jdf2c_startup_STARTUP(parsec_execution_stream_t * es, __parsec_utt_STARTUP_task_t *this_task)
+{
+  __parsec_utt_STARTUP_task_t* new_task;
+  __parsec_utt_internal_taskpool_t* __parsec_tp = (__parsec_utt_internal_taskpool_t*)this_task->taskpool;
+  parsec_context_t *context = __parsec_tp->super.super.context;
+  int vpid = 0, nb_tasks = 0;
+  size_t total_nb_tasks = 0;
+  parsec_list_item_t* pready_ring[context->nb_vp];
+  int restore_context = 0;
+  int i = this_task->locals.i.value;  /* retrieve value saved during the last iteration */
+  for(int _i = 0; _i < context->nb_vp; pready_ring[_i++] = NULL );
+  if( 0 != this_task->locals.reserved[0].value ) {
+    this_task->locals.reserved[0].value = 1; /* reset the submission process */
+    restore_context = 1;
+    goto restore_context_0;
+  }
+  this_task->locals.reserved[0].value = 1; /* a sane default value */
+  for(this_task->locals.i.value = i = 0;
+      this_task->locals.i.value <= 0;
+      this_task->locals.i.value += 1, i = this_task->locals.i.value) {
+    if( !STARTUP_pred(i) ) continue;
+  __parsec_utt_STARTUP_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_utt_STARTUP_parsec_assignment_t*)&this_task->locals;
+  (void)__jdf2c__tmp_locals;
+    if( NULL != ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of ) {
+      vpid = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, 0, 0);
+      assert(context->nb_vp >= vpid);
+    } else {
+      vpid = (vpid + 1) % context->nb_vp;  /* spread the initial joy */
+    }
+    new_task = (__parsec_utt_STARTUP_task_t*)parsec_thread_mempool_allocate( context->virtual_processes[vpid]->execution_streams[0]->context_mempool );
+    PARSEC_OBJ_CONSTRUCT(new_task, parsec_task_t); /* construct called only when new, force-construct it again */
+    /* Copy only the valid elements from this_task to new_task one */
+    new_task->taskpool   = this_task->taskpool;
+    new_task->task_class = __parsec_tp->super.super.task_classes_array[utt_STARTUP.task_class_id];
+    new_task->chore_mask   = PARSEC_DEV_ALL;
+    new_task->locals.i.value = this_task->locals.i.value;
+    PARSEC_LIST_ITEM_SINGLETON(new_task);
+    new_task->priority = __parsec_tp->super.super.priority;
+    new_task->repo_entry = NULL;
+    new_task->data._f_X.source_repo_entry = NULL;
+    new_task->data._f_X.source_repo       = NULL;
+    new_task->data._f_X.data_in         = NULL;
+    new_task->data._f_X.data_out        = NULL;
+    new_task->data._f_X.fulfill         = 0;
+#if defined(PARSEC_DEBUG_NOISIER)
+    {
+      char tmp[128];
+      PARSEC_DEBUG_VERBOSE(10, parsec_debug_output, "Add startup task %s to vpid %d",
+             parsec_task_snprintf(tmp, 128, (parsec_task_t*)new_task), vpid);
+    }
+#endif
+    parsec_dependencies_mark_task_as_startup((parsec_task_t*)new_task, es);
+    pready_ring[vpid] = parsec_list_item_ring_push_sorted(pready_ring[vpid],
+                                                          (parsec_list_item_t*)new_task,
+                                                          parsec_execution_context_priority_comparator);
+    nb_tasks++;
+   restore_context_0:  /* we jump here just so that we have code after the label */
+    restore_context = 0;
+    (void)restore_context;
+    if( nb_tasks > this_task->locals.reserved[0].value ) {
+      if( (size_t)this_task->locals.reserved[0].value < parsec_task_startup_iter ) this_task->locals.reserved[0].value <<= 1;
+      __parsec_schedule_vp(es, (parsec_task_t**)pready_ring, 0);
+      total_nb_tasks += nb_tasks;
+      nb_tasks = 0;
+      if( total_nb_tasks > parsec_task_startup_chunk ) {  /* stop here and request to be rescheduled */
+        return PARSEC_HOOK_RETURN_AGAIN;
+      }
+    }
+  } /* Loop on normal range i */
+  (void)vpid;
+  if( 0 != nb_tasks ) {
+    __parsec_schedule_vp(es, (parsec_task_t**)pready_ring, 0);
+    nb_tasks = 0;
+  }
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static const __parsec_chore_t __utt_STARTUP_chores[] ={
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+    { .type     = PARSEC_DEV_CPU,
+      .evaluate = (parsec_evaluate_function_t*)NULL,
+      .hook     = (parsec_hook_t*)hook_of_utt_STARTUP },
+#endif  /* defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+    { .type     = PARSEC_DEV_NONE,
+      .evaluate = NULL,
+      .hook     = (parsec_hook_t*)NULL },  /* End marker */
+};
+
+static const parsec_task_class_t utt_STARTUP = {
+  .name = "STARTUP",
+  .task_class_id = 0,
+  .nb_flows = 1,
+  .nb_parameters = 1,
+  .nb_locals = 1,
+  .task_class_type = PARSEC_TASK_CLASS_TYPE_PTG,
+  .params = { &symb_utt_STARTUP_i, NULL },
+  .locals = { &symb_utt_STARTUP_i, NULL },
+  .data_affinity = (parsec_data_ref_fn_t*)affinity_of_utt_STARTUP,
+  .initial_data = (parsec_data_ref_fn_t*)affinity_of_utt_STARTUP,
+  .final_data = (parsec_data_ref_fn_t*)affinity_of_utt_STARTUP,
+  .priority = NULL,
+  .properties = properties_of_utt_STARTUP,
+#if MAX_PARAM_COUNT < 0  /* number of read flows of STARTUP */
+  #error Too many read flows for task STARTUP
+#endif  /* MAX_PARAM_COUNT */
+#if MAX_PARAM_COUNT < 0  /* number of write flows of STARTUP */
+  #error Too many write flows for task STARTUP
+#endif  /* MAX_PARAM_COUNT */
+  .in = { NULL },
+  .out = { &flow_of_utt_STARTUP_for_X, NULL },
+  .flags = 0x0 | PARSEC_USE_DEPS_MASK,
+  .dependencies_goal = 0x0,
+  .make_key = __jdf2c_make_key_STARTUP,
+  .task_snprintf = parsec_task_snprintf,
+#if defined(PARSEC_PROF_TRACE)
+  .profile_info = &parsec_task_profile_info,
+#endif
+  .key_functions = &__jdf2c_key_fns_STARTUP,
+  .fini = (parsec_hook_t*)NULL,
+  .incarnations = __utt_STARTUP_chores,
+  .find_deps = parsec_hash_find_deps,
+  .update_deps = parsec_update_deps_with_mask,
+  .iterate_successors = (parsec_traverse_function_t*)iterate_successors_of_utt_STARTUP,
+  .iterate_predecessors = (parsec_traverse_function_t*)NULL,
+  .release_deps = (parsec_release_deps_t*)release_deps_of_utt_STARTUP,
+  .prepare_output = (parsec_hook_t*)NULL,
+  .prepare_input = (parsec_hook_t*)data_lookup_of_utt_STARTUP,
+  .time_estimate = NULL,
+  .get_datatype = datatype_lookup_of_utt_STARTUP,
+  .complete_execution = (parsec_hook_t*)complete_hook_of_utt_STARTUP,
+  .release_task = &release_task_of_utt_STARTUP,
+#if defined(PARSEC_SIM)
+  .sim_cost_fct = (parsec_sim_cost_fct_t*)NULL,
+#endif
+};
+
+
+static const parsec_task_class_t *utt_task_classes[] = {
+  &utt_STARTUP,
+  &utt_FANOUT,
+  &utt_FANIN,
+  &utt_END
+};
+
+static void utt_startup(parsec_context_t *context, __parsec_utt_internal_taskpool_t *__parsec_tp, parsec_list_item_t ** ready_tasks)
+{
+  uint32_t i, supported_dev = 0;
+ 
+  for( i = 0; i < parsec_nb_devices; i++ ) {
+    if( !(__parsec_tp->super.super.devices_index_mask & (1<<i)) ) continue;
+    parsec_device_module_t* device = parsec_mca_device_get(i);
+    parsec_data_collection_t* parsec_dc;
+ 
+    if(NULL == device) continue;
+    if(NULL != device->taskpool_register)
+      if( PARSEC_SUCCESS != device->taskpool_register(device, (parsec_taskpool_t*)__parsec_tp) ) {
+        parsec_debug_verbose(5, parsec_debug_output, "Device %s refused to register taskpool %p", device->name, __parsec_tp);
+        __parsec_tp->super.super.devices_index_mask &= ~(1 << device->device_index);
+        continue;
+      }
+    if(NULL != device->memory_register) {  /* Register all the data */
+      parsec_dc = (parsec_data_collection_t*)__parsec_tp->super._g_descA;
+      if( (NULL != parsec_dc->register_memory) &&
+          (PARSEC_SUCCESS != parsec_dc->register_memory(parsec_dc, device)) ) {
+        parsec_debug_verbose(3, parsec_debug_output, "Device %s refused to register memory for data %s (%p) from taskpool %p",
+                     device->name, parsec_dc->key_base, parsec_dc, __parsec_tp);
+        __parsec_tp->super.super.devices_index_mask &= ~(1 << device->device_index);
+      }
+    }
+    supported_dev |= device->type;
+  }
+  /* Remove all the chores without a backend device */
+  for( i = 0; i < PARSEC_utt_NB_TASK_CLASSES; i++ ) {
+    parsec_task_class_t* tc = (parsec_task_class_t*)__parsec_tp->super.super.task_classes_array[i];
+    __parsec_chore_t* chores = (__parsec_chore_t*)tc->incarnations;
+    uint32_t idx = 0, j;
+    for( j = 0; PARSEC_DEV_NONE != chores[j].type; j++ ) {
+      if( !(supported_dev & chores[j].type) ) continue;
+      if( j != idx ) {
+        chores[idx] = chores[j];
+        parsec_debug_verbose(20, parsec_debug_output, "Device type %i disabled for function %s"
+, chores[j].type, tc->name);
+      }
+      idx++;
+    }
+    chores[idx].type     = PARSEC_DEV_NONE;
+    chores[idx].evaluate = NULL;
+    chores[idx].hook     = NULL;
+    /* Create the initialization tasks for each taskclass */
+    parsec_task_t* task = (parsec_task_t*)parsec_thread_mempool_allocate(context->virtual_processes[0]->execution_streams[0]->context_mempool);
+    PARSEC_OBJ_CONSTRUCT(task, parsec_task_t); /* construct called only when new, force-construct it again */
+    task->taskpool = (parsec_taskpool_t *)__parsec_tp;
+    task->chore_mask = PARSEC_DEV_CPU;
+    memset(&task->locals, 0, sizeof(parsec_assignment_t) * MAX_LOCAL_COUNT);
+    PARSEC_LIST_ITEM_SINGLETON(task);
+    task->priority = -1;
+    task->task_class = task->taskpool->task_classes_array[PARSEC_utt_NB_TASK_CLASSES + i];
+    int where = i % context->nb_vp;
+    if( NULL == ready_tasks[where] ) ready_tasks[where] = &task->super;
+    else ready_tasks[where] = parsec_list_item_ring_push(ready_tasks[where], &task->super);
+  }
+}
+static void __parsec_utt_internal_destructor( __parsec_utt_internal_taskpool_t *__parsec_tp )
+{
+  uint32_t i;
+  parsec_taskpool_unregister( &__parsec_tp->super.super );
+  if(NULL != __parsec_tp->super.super.tdm.module) __parsec_tp->super.super.tdm.module->unmonitor_taskpool(&__parsec_tp->super.super);
+  for( i = 0; i < (uint32_t)(2 * __parsec_tp->super.super.nb_task_classes); i++ ) {  /* Extra startup function added at the end */
+    parsec_task_class_t* tc = (parsec_task_class_t*)__parsec_tp->super.super.task_classes_array[i];
+    free((void*)tc->incarnations);
+    free(tc);
+  }
+  free(__parsec_tp->super.super.task_classes_array); __parsec_tp->super.super.task_classes_array = NULL;
+  __parsec_tp->super.super.nb_task_classes = 0;
+
+  for(i = 0; i < (uint32_t)__parsec_tp->super.arenas_datatypes_size; i++) {
+    if( NULL != __parsec_tp->super.arenas_datatypes[i].arena ) {
+      PARSEC_OBJ_RELEASE(__parsec_tp->super.arenas_datatypes[i].arena);
+    }
+  }
+  /* Destroy the data repositories for this object */
+   data_repo_destroy_nothreadsafe(__parsec_tp->repositories[3]);  /* END */
+   data_repo_destroy_nothreadsafe(__parsec_tp->repositories[2]);  /* FANIN */
+   data_repo_destroy_nothreadsafe(__parsec_tp->repositories[1]);  /* FANOUT */
+   data_repo_destroy_nothreadsafe(__parsec_tp->repositories[0]);  /* STARTUP */
+  /* Release the dependencies arrays for this object */
+  parsec_hash_table_fini( (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[3] );
+  PARSEC_OBJ_RELEASE(__parsec_tp->super.super.dependencies_array[3]);
+  __parsec_tp->super.super.dependencies_array[3] = NULL;
+  parsec_hash_table_fini( (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[2] );
+  PARSEC_OBJ_RELEASE(__parsec_tp->super.super.dependencies_array[2]);
+  __parsec_tp->super.super.dependencies_array[2] = NULL;
+  parsec_hash_table_fini( (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[1] );
+  PARSEC_OBJ_RELEASE(__parsec_tp->super.super.dependencies_array[1]);
+  __parsec_tp->super.super.dependencies_array[1] = NULL;
+  parsec_hash_table_fini( (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[0] );
+  PARSEC_OBJ_RELEASE(__parsec_tp->super.super.dependencies_array[0]);
+  __parsec_tp->super.super.dependencies_array[0] = NULL;
+  free( __parsec_tp->super.super.dependencies_array );
+  __parsec_tp->super.super.dependencies_array = NULL;
+  /* Unregister all the data */
+  uint32_t _i;
+  for( _i = 0; _i < parsec_nb_devices; _i++ ) {
+    parsec_device_module_t* device;
+    parsec_data_collection_t* parsec_dc;
+    if(!(__parsec_tp->super.super.devices_index_mask & (1 << _i))) continue;
+    if((NULL == (device = parsec_mca_device_get(_i))) || (NULL == device->memory_unregister)) continue;
+    parsec_dc = (parsec_data_collection_t*)__parsec_tp->super._g_descA;
+  if( NULL != parsec_dc->unregister_memory ) { (void)parsec_dc->unregister_memory(parsec_dc, device); };
+}
+  /* Unregister the taskpool from the devices */
+  for( i = 0; i < parsec_nb_devices; i++ ) {
+    if(!(__parsec_tp->super.super.devices_index_mask & (1 << i))) continue;
+    __parsec_tp->super.super.devices_index_mask ^= (1 << i);
+    parsec_device_module_t* device = parsec_mca_device_get(i);
+    if((NULL == device) || (NULL == device->taskpool_unregister)) continue;
+    if( PARSEC_SUCCESS != device->taskpool_unregister(device, &__parsec_tp->super.super) ) continue;
+  }
+  free(__parsec_tp->super.super.taskpool_name); __parsec_tp->super.super.taskpool_name = NULL;
+}
+
+void __parsec_utt_internal_constructor(__parsec_utt_internal_taskpool_t* __parsec_tp)
+{
+  parsec_task_class_t* tc;
+  uint32_t i, j;
+
+  __parsec_tp->super.super.nb_task_classes = PARSEC_utt_NB_TASK_CLASSES;
+  __parsec_tp->super.super.devices_index_mask = PARSEC_DEVICES_ALL;
+  __parsec_tp->super.super.taskpool_name = strdup("utt");
+  parsec_termdet_open_module(&__parsec_tp->super.super, "user_trigger");
+  __parsec_tp->super.super.tdm.module->monitor_taskpool(&__parsec_tp->super.super,
+                                                        parsec_taskpool_termination_detected);
+  __parsec_tp->super.super.update_nb_runtime_task = parsec_add_fetch_runtime_task;
+  __parsec_tp->super.super.dependencies_array = (void **)
+              calloc(__parsec_tp->super.super.nb_task_classes, sizeof(void*));
+  /* Twice the size to hold the startup tasks function_t */
+  __parsec_tp->super.super.task_classes_array = (const parsec_task_class_t**)
+              calloc((2 * PARSEC_utt_NB_TASK_CLASSES + 1), sizeof(parsec_task_class_t*));
+  __parsec_tp->super.super.tdm.module->taskpool_addto_runtime_actions(&__parsec_tp->super.super, PARSEC_utt_NB_TASK_CLASSES);  /* for the startup tasks */
+  __parsec_tp->super.super.taskpool_type = PARSEC_TASKPOOL_TYPE_PTG;
+  __parsec_tp->sync_point = __parsec_tp->super.super.nb_task_classes;
+  __parsec_tp->initial_number_tasks = 0;
+  __parsec_tp->startup_queue = NULL;
+  for( i = 0; i < __parsec_tp->super.super.nb_task_classes; i++ ) {
+    __parsec_tp->super.super.task_classes_array[i] = tc = malloc(sizeof(parsec_task_class_t));
+    memcpy(tc, utt_task_classes[i], sizeof(parsec_task_class_t));
+    for( j = 0; PARSEC_DEV_NONE != tc->incarnations[j].type; j++);  /* compute the number of incarnations */
+    tc->incarnations = (__parsec_chore_t*)malloc((j+1) * sizeof(__parsec_chore_t));
+        memcpy((__parsec_chore_t*)tc->incarnations, utt_task_classes[i]->incarnations, (j+1) * sizeof(__parsec_chore_t));
+
+    /* Add a placeholder for initialization and startup task */
+    __parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+i] = tc = (parsec_task_class_t*)malloc(sizeof(parsec_task_class_t));
+    memcpy(tc, (void*)&__parsec_generic_startup, sizeof(parsec_task_class_t));
+    tc->task_class_id = __parsec_tp->super.super.nb_task_classes + i;
+    tc->incarnations = (__parsec_chore_t*)malloc(2 * sizeof(__parsec_chore_t));
+    memcpy((__parsec_chore_t*)tc->incarnations, (void*)__parsec_generic_startup.incarnations, 2 * sizeof(__parsec_chore_t));
+    tc->release_task = parsec_release_task_to_mempool_and_count_as_runtime_tasks;
+  }
+  /* Startup task for END */
+  tc = (parsec_task_class_t *)__parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+0];
+  tc->name = "Startup for END";
+  tc->prepare_input = (parsec_hook_t*)utt_END_internal_init;
+  /* Startup task for FANIN */
+  tc = (parsec_task_class_t *)__parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+1];
+  tc->name = "Startup for FANIN";
+  tc->prepare_input = (parsec_hook_t*)utt_FANIN_internal_init;
+  /* Startup task for FANOUT */
+  tc = (parsec_task_class_t *)__parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+2];
+  tc->name = "Startup for FANOUT";
+  tc->prepare_input = (parsec_hook_t*)utt_FANOUT_internal_init;
+  /* Startup task for STARTUP */
+  tc = (parsec_task_class_t *)__parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+3];
+  tc->name = "Startup for STARTUP";
+  tc->prepare_input = (parsec_hook_t*)utt_STARTUP_internal_init;
+  ((__parsec_chore_t*)&tc->incarnations[0])->hook = (parsec_hook_t *)__jdf2c_startup_STARTUP;
+  /* Compute the number of arenas_datatypes: */
+  /*   PARSEC_utt_DEFAULT_ARENA  ->  0 */
+  __parsec_tp->super.arenas_datatypes_size = 1;
+  memset(&__parsec_tp->super.arenas_datatypes[0], 0, __parsec_tp->super.arenas_datatypes_size*sizeof(parsec_arena_datatype_t));
+  /* If profiling is enabled, the keys for profiling */
+#  if defined(PARSEC_PROF_TRACE)
+  __parsec_tp->super.super.profiling_array = utt_profiling_array;
+  if( -2 == utt_profiling_array[0] ) {
+    #if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+parsec_profiling_add_dictionary_keyword("utt::END::internal init", "fill:34D8D8",
+                                       0,
+                                       NULL,
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(utt_END.task_class_id  + PARSEC_utt_NB_TASK_CLASSES)/* END (internal init) start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(utt_END.task_class_id  + PARSEC_utt_NB_TASK_CLASSES)/* END (internal init) end key */]);
+#endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+parsec_profiling_add_dictionary_keyword("utt::END", "fill:CC2828",
+                                       sizeof(parsec_task_prof_info_t)+1*sizeof(parsec_assignment_t),
+                                       "dc_key{uint64_t};priority{int32_t};dc_dataid{uint32_t};tcid{uint32_t};trc{int32_t};i{int32_t}",
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(utt_END.task_class_id) /* END start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(utt_END.task_class_id) /* END end key */]);
+
+    #if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+parsec_profiling_add_dictionary_keyword("utt::FANIN::internal init", "fill:8634D8",
+                                       0,
+                                       NULL,
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(utt_FANIN.task_class_id  + PARSEC_utt_NB_TASK_CLASSES)/* FANIN (internal init) start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(utt_FANIN.task_class_id  + PARSEC_utt_NB_TASK_CLASSES)/* FANIN (internal init) end key */]);
+#endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+parsec_profiling_add_dictionary_keyword("utt::FANIN", "fill:7ACC28",
+                                       sizeof(parsec_task_prof_info_t)+2*sizeof(parsec_assignment_t),
+                                       "dc_key{uint64_t};priority{int32_t};dc_dataid{uint32_t};tcid{uint32_t};trc{int32_t};i{int32_t};j{int32_t}",
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(utt_FANIN.task_class_id) /* FANIN start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(utt_FANIN.task_class_id) /* FANIN end key */]);
+
+    #if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+parsec_profiling_add_dictionary_keyword("utt::FANOUT::internal init", "fill:D83434",
+                                       0,
+                                       NULL,
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(utt_FANOUT.task_class_id  + PARSEC_utt_NB_TASK_CLASSES)/* FANOUT (internal init) start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(utt_FANOUT.task_class_id  + PARSEC_utt_NB_TASK_CLASSES)/* FANOUT (internal init) end key */]);
+#endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+parsec_profiling_add_dictionary_keyword("utt::FANOUT", "fill:28CCCC",
+                                       sizeof(parsec_task_prof_info_t)+2*sizeof(parsec_assignment_t),
+                                       "dc_key{uint64_t};priority{int32_t};dc_dataid{uint32_t};tcid{uint32_t};trc{int32_t};i{int32_t};j{int32_t}",
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(utt_FANOUT.task_class_id) /* FANOUT start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(utt_FANOUT.task_class_id) /* FANOUT end key */]);
+
+    #if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+parsec_profiling_add_dictionary_keyword("utt::STARTUP::internal init", "fill:86D834",
+                                       0,
+                                       NULL,
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(utt_STARTUP.task_class_id  + PARSEC_utt_NB_TASK_CLASSES)/* STARTUP (internal init) start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(utt_STARTUP.task_class_id  + PARSEC_utt_NB_TASK_CLASSES)/* STARTUP (internal init) end key */]);
+#endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+parsec_profiling_add_dictionary_keyword("utt::STARTUP", "fill:7A28CC",
+                                       sizeof(parsec_task_prof_info_t)+1*sizeof(parsec_assignment_t),
+                                       "dc_key{uint64_t};priority{int32_t};dc_dataid{uint32_t};tcid{uint32_t};trc{int32_t};i{int32_t}",
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(utt_STARTUP.task_class_id) /* STARTUP start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(utt_STARTUP.task_class_id) /* STARTUP end key */]);
+
+  }
+#  endif /* defined(PARSEC_PROF_TRACE) */
+  __parsec_tp->super.super.repo_array = __parsec_tp->repositories;
+  __parsec_tp->super.super.startup_hook = (parsec_startup_fn_t)utt_startup;
+  (void)parsec_taskpool_reserve_id((parsec_taskpool_t*)__parsec_tp);
+}
+
+  /** Generate class declaration and instance using the above constructor and destructor */
+  PARSEC_OBJ_CLASS_DECLARATION(__parsec_utt_internal_taskpool_t);
+  PARSEC_OBJ_CLASS_INSTANCE(__parsec_utt_internal_taskpool_t, parsec_utt_taskpool_t,
+                            __parsec_utt_internal_constructor, __parsec_utt_internal_destructor);
+
+#undef descA
+#undef tasks_cnt
+#undef NT
+#undef verbose
+
+parsec_utt_taskpool_t *parsec_utt_new(parsec_matrix_block_cyclic_t* descA /* data descA */, int32_t * tasks_cnt, int NT, int verbose)
+{
+  __parsec_utt_internal_taskpool_t *__parsec_tp = PARSEC_OBJ_NEW(__parsec_utt_internal_taskpool_t);
+  /* Dump the hidden parameters with default values */
+
+  /* Now the Parameter-dependent structures: */
+  __parsec_tp->super._g_descA = descA;
+  __parsec_tp->super._g_tasks_cnt = tasks_cnt;
+  __parsec_tp->super._g_NT = NT;
+  __parsec_tp->super._g_verbose = verbose;
+  PARSEC_AYU_REGISTER_TASK(&utt_END);
+  PARSEC_AYU_REGISTER_TASK(&utt_FANIN);
+  PARSEC_AYU_REGISTER_TASK(&utt_FANOUT);
+  PARSEC_AYU_REGISTER_TASK(&utt_STARTUP);
+  __parsec_tp->super.super.startup_hook = (parsec_startup_fn_t)utt_startup;
+  (void)parsec_taskpool_reserve_id((parsec_taskpool_t*)__parsec_tp);
+/* Prevent warnings related to not used hidden global variables */
+;
+  return (parsec_utt_taskpool_t*)__parsec_tp;
+}
+
+
+#include <math.h>
+
+int main( int argc, char** argv )
+{
+    parsec_utt_taskpool_t* tp;
+    parsec_matrix_block_cyclic_t descA;
+    parsec_arena_datatype_t adt;
+    parsec_datatype_t dt;
+    parsec_context_t *parsec;
+    int ws = 1, mr = 0;
+    int rc;
+    int32_t nb_tasks;
+    int ret;
+    int nt;
+
+#ifdef PARSEC_HAVE_MPI
+    {
+        int provided;
+        MPI_Init_thread(NULL, NULL, MPI_THREAD_SERIALIZED, &provided);
+        MPI_Comm_size(MPI_COMM_WORLD, &ws);
+        MPI_Comm_rank(MPI_COMM_WORLD, &mr);
+    }
+#endif
+    nt = 2*ws;
+
+    parsec = parsec_init(-1, &argc, &argv);
+    if( NULL == parsec ) {
+        exit(-1);
+    }
+
+    /**
+     * Build the data and the arena to hold it up.
+     */
+    parsec_matrix_block_cyclic_init( &descA, PARSEC_MATRIX_DOUBLE, PARSEC_MATRIX_TILE,
+                               mr /*rank*/,
+                               100 /* mb */, 100 /* nb */,
+                               100*nt /* lm */, 100*(1<<nt) /* ln */,
+                               0 /* i */, 0 /* j */,
+                               100*nt /* m */, 100*(1<<nt) /* n */,
+                               1 /*p*/, ws /*q*/,
+                               1 /*kp*/, 1 /*kq*/,
+                               0 /*ip*/, 0 /*jq*/ );
+    descA.mat = parsec_data_allocate( descA.super.nb_local_tiles *
+                                      descA.super.bsiz *
+                                      parsec_datadist_getsizeoftype(PARSEC_MATRIX_DOUBLE) );
+    parsec_data_collection_set_key(&descA.super.super, "A");
+
+    parsec_translate_matrix_type(PARSEC_MATRIX_DOUBLE, &dt);
+    parsec_add2arena( &adt, dt, PARSEC_MATRIX_FULL, 0, descA.super.mb, descA.super.nb, descA.super.mb, PARSEC_ARENA_ALIGNMENT_SSE, -1 );
+
+    /* Start the PaRSEC engine */
+    rc = parsec_context_start(parsec);
+    PARSEC_CHECK_ERROR(rc, "parsec_context_start");
+
+    nb_tasks = 0;
+    tp = parsec_utt_new( &descA, &nb_tasks, nt, 1 );
+    assert( NULL != tp );
+    tp->arenas_datatypes[PARSEC_utt_DEFAULT_ADT_IDX] = adt;
+    rc = parsec_context_add_taskpool( parsec, (parsec_taskpool_t*)tp );
+    PARSEC_CHECK_ERROR(rc, "parsec_context_add_taskpool");
+    rc = parsec_context_wait(parsec);
+
+    PARSEC_CHECK_ERROR(rc, "parsec_context_wait");
+
+    rc = parsec_context_start(parsec);
+    PARSEC_CHECK_ERROR(rc, "parsec_context_start");
+
+    parsec_context_wait(parsec);
+
+    ret = 0;
+    if( 0 == mr ) {
+        if( nb_tasks != 25 ) {
+            fprintf(stderr, "*** Test failed: expected 25 STARTUP tasks, found %d total\n", nb_tasks);
+            ret++;
+        }
+    }
+
+    free(descA.mat);
+    parsec_del2arena( & adt );
+
+    parsec_fini( &parsec);
+
+#ifdef PARSEC_HAVE_MPI
+    MPI_Finalize();
+#endif
+
+    return ret;
+}
+
+PARSEC_OBJ_CLASS_INSTANCE(parsec_utt_taskpool_t, parsec_taskpool_t, NULL, NULL);
+
@@ -0,0 +1,150 @@
+#ifndef _utt_h_
+#define _utt_h_
+#include "parsec.h"
+#include "parsec/parsec_internal.h"
+#include "parsec/remote_dep.h"
+
+BEGIN_C_DECLS
+
+#define PARSEC_utt_DEFAULT_ADT_IDX    0
+#define PARSEC_utt_ADT_IDX_MAX       1
+typedef struct parsec_utt_taskpool_s {
+  parsec_taskpool_t super;
+  /* The list of globals */
+  parsec_matrix_block_cyclic_t* _g_descA /* data descA */;
+  int32_t * _g_tasks_cnt;
+  int _g_NT;
+  int _g_verbose;
+  /* The array of datatypes (DEFAULT and co.) */
+  parsec_arena_datatype_t arenas_datatypes[PARSEC_utt_ADT_IDX_MAX];
+  uint32_t arenas_datatypes_size;
+} parsec_utt_taskpool_t;
+
+/** Beware that this object is not a superset of the internal object, and as a result
+ *  we should never create one directly. Instead we should rely on the creation of the
+ *  internal object (__parsec_utt_taskpool_t).
+ */
+PARSEC_OBJ_CLASS_DECLARATION(parsec_utt_taskpool_t);
+extern parsec_utt_taskpool_t *parsec_utt_new(parsec_matrix_block_cyclic_t* _g_descA /* data descA */, int32_t * _g_tasks_cnt, int _g_NT, int _g_verbose);
+
+#if MAX_LOCAL_COUNT < 1  /* number of parameters and locals END */
+  #error Too many parameters and local variables (1 out of MAX_LOCAL_COUNT) for task END
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_utt_END_assignment_s {
+  parsec_assignment_t i;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-1];
+} __parsec_utt_END_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 1  /* total number of flows for task END */
+  #error Too many flows (1 out of MAX_PARAM_COUNT) for task END
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_utt_END_data_s {
+  parsec_data_pair_t _f_X;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-1];
+} __parsec_utt_END_data_t;
+
+typedef struct __parsec_utt_END_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_utt_END_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_utt_END_data_s data;
+} __parsec_utt_END_task_t;
+
+
+#if MAX_LOCAL_COUNT < 2  /* number of parameters and locals FANIN */
+  #error Too many parameters and local variables (2 out of MAX_LOCAL_COUNT) for task FANIN
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_utt_FANIN_assignment_s {
+  parsec_assignment_t i;
+  parsec_assignment_t j;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-2];
+} __parsec_utt_FANIN_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 1  /* total number of flows for task FANIN */
+  #error Too many flows (1 out of MAX_PARAM_COUNT) for task FANIN
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_utt_FANIN_data_s {
+  parsec_data_pair_t _f_X;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-1];
+} __parsec_utt_FANIN_data_t;
+
+typedef struct __parsec_utt_FANIN_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_utt_FANIN_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_utt_FANIN_data_s data;
+} __parsec_utt_FANIN_task_t;
+
+
+#if MAX_LOCAL_COUNT < 2  /* number of parameters and locals FANOUT */
+  #error Too many parameters and local variables (2 out of MAX_LOCAL_COUNT) for task FANOUT
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_utt_FANOUT_assignment_s {
+  parsec_assignment_t i;
+  parsec_assignment_t j;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-2];
+} __parsec_utt_FANOUT_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 1  /* total number of flows for task FANOUT */
+  #error Too many flows (1 out of MAX_PARAM_COUNT) for task FANOUT
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_utt_FANOUT_data_s {
+  parsec_data_pair_t _f_X;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-1];
+} __parsec_utt_FANOUT_data_t;
+
+typedef struct __parsec_utt_FANOUT_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_utt_FANOUT_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_utt_FANOUT_data_s data;
+} __parsec_utt_FANOUT_task_t;
+
+
+#if MAX_LOCAL_COUNT < 1  /* number of parameters and locals STARTUP */
+  #error Too many parameters and local variables (1 out of MAX_LOCAL_COUNT) for task STARTUP
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_utt_STARTUP_assignment_s {
+  parsec_assignment_t i;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-1];
+} __parsec_utt_STARTUP_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 1  /* total number of flows for task STARTUP */
+  #error Too many flows (1 out of MAX_PARAM_COUNT) for task STARTUP
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_utt_STARTUP_data_s {
+  parsec_data_pair_t _f_X;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-1];
+} __parsec_utt_STARTUP_data_t;
+
+typedef struct __parsec_utt_STARTUP_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_utt_STARTUP_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_utt_STARTUP_data_s data;
+} __parsec_utt_STARTUP_task_t;
+
+
+END_C_DECLS
+
+#endif /* _utt_h_ */ 
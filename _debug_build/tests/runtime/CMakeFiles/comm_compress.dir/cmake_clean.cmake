@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/comm_compress.dir/comm_compress.c.o"
+  "CMakeFiles/comm_compress.dir/comm_compress.c.o.d"
+  "comm_compress"
+  "comm_compress.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/comm_compress.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/datatype_pack.dir/datatype_pack.c.o"
+  "CMakeFiles/datatype_pack.dir/datatype_pack.c.o.d"
+  "datatype_pack"
+  "datatype_pack.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/datatype_pack.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
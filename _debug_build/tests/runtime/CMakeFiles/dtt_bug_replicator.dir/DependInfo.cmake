@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/_debug_build/tests/runtime/dtt_bug_replicator.c" "tests/runtime/CMakeFiles/dtt_bug_replicator.dir/dtt_bug_replicator.c.o" "gcc" "tests/runtime/CMakeFiles/dtt_bug_replicator.dir/dtt_bug_replicator.c.o.d"
+  "/root/repo/tests/runtime/dtt_bug_replicator_ex.c" "tests/runtime/CMakeFiles/dtt_bug_replicator.dir/dtt_bug_replicator_ex.c.o" "gcc" "tests/runtime/CMakeFiles/dtt_bug_replicator.dir/dtt_bug_replicator_ex.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_debug_build/parsec/CMakeFiles/parsec.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "/root/repo/_debug_build/parsec/include/fortran")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dtt_bug_replicator.dir/dtt_bug_replicator.c.o"
+  "CMakeFiles/dtt_bug_replicator.dir/dtt_bug_replicator.c.o.d"
+  "CMakeFiles/dtt_bug_replicator.dir/dtt_bug_replicator_ex.c.o"
+  "CMakeFiles/dtt_bug_replicator.dir/dtt_bug_replicator_ex.c.o.d"
+  "dtt_bug_replicator"
+  "dtt_bug_replicator.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dtt_bug_replicator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
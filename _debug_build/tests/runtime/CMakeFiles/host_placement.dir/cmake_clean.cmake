@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/host_placement.dir/host_placement.c.o"
+  "CMakeFiles/host_placement.dir/host_placement.c.o.d"
+  "host_placement"
+  "host_placement.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/host_placement.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
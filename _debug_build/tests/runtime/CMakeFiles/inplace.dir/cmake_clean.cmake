@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/inplace.dir/inplace.c.o"
+  "CMakeFiles/inplace.dir/inplace.c.o.d"
+  "inplace"
+  "inplace.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/inplace.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
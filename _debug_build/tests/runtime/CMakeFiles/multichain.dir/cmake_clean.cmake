@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/multichain.dir/multichain.c.o"
+  "CMakeFiles/multichain.dir/multichain.c.o.d"
+  "multichain"
+  "multichain.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/multichain.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ptgpp_dtt_bug_replicator.dtt_bug_replicator"
+  "dtt_bug_replicator.c"
+  "dtt_bug_replicator.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ptgpp_dtt_bug_replicator.dtt_bug_replicator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ptgpp_host_placement.host_placement"
+  "host_placement.c"
+  "host_placement.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ptgpp_host_placement.host_placement.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ptgpp_inplace.inplace"
+  "inplace.c"
+  "inplace.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ptgpp_inplace.inplace.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
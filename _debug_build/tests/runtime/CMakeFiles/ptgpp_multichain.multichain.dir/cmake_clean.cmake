@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ptgpp_multichain.multichain"
+  "multichain.c"
+  "multichain.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ptgpp_multichain.multichain.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ptgpp_put_sched.put_sched"
+  "put_sched.c"
+  "put_sched.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ptgpp_put_sched.put_sched.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
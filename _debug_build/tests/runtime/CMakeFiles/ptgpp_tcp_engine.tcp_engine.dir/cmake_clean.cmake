@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ptgpp_tcp_engine.tcp_engine"
+  "tcp_engine.c"
+  "tcp_engine.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ptgpp_tcp_engine.tcp_engine.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
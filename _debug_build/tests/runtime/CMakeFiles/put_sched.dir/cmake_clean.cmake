@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/put_sched.dir/put_sched.c.o"
+  "CMakeFiles/put_sched.dir/put_sched.c.o.d"
+  "put_sched"
+  "put_sched.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/put_sched.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
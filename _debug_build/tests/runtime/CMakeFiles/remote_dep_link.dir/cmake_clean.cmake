@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/remote_dep_link.dir/remote_dep_link.c.o"
+  "CMakeFiles/remote_dep_link.dir/remote_dep_link.c.o.d"
+  "remote_dep_link"
+  "remote_dep_link.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/remote_dep_link.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/remote_dep_ranks.dir/remote_dep_ranks.c.o"
+  "CMakeFiles/remote_dep_ranks.dir/remote_dep_ranks.c.o.d"
+  "remote_dep_ranks"
+  "remote_dep_ranks.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/remote_dep_ranks.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
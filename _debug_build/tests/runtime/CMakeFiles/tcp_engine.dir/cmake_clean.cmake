@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tcp_engine.dir/tcp_engine.c.o"
+  "CMakeFiles/tcp_engine.dir/tcp_engine.c.o.d"
+  "tcp_engine"
+  "tcp_engine.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tcp_engine.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
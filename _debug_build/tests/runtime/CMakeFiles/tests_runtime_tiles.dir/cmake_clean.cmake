@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests_runtime_tiles.dir/tiles.c.o"
+  "CMakeFiles/tests_runtime_tiles.dir/tiles.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tests_runtime_tiles.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,93 @@
+#ifndef _dtt_bug_replicator_h_
+#define _dtt_bug_replicator_h_
+#include "parsec.h"
+#include "parsec/parsec_internal.h"
+#include "parsec/remote_dep.h"
+
+BEGIN_C_DECLS
+
+#define PARSEC_dtt_bug_replicator_DEFAULT_ADT_IDX    0
+#define PARSEC_dtt_bug_replicator_DTT1_ADT_IDX    1
+#define PARSEC_dtt_bug_replicator_DTT2_ADT_IDX    2
+#define PARSEC_dtt_bug_replicator_ADT_IDX_MAX       3
+typedef struct parsec_dtt_bug_replicator_taskpool_s {
+  parsec_taskpool_t super;
+  /* The list of globals */
+  parsec_data_collection_t * _g_dataA /* data dataA */;
+  parsec_tiled_matrix_t _g_descA;
+  int _g_procpid;
+  /* The array of datatypes (DEFAULT,DTT1,DTT2 and co.) */
+  parsec_arena_datatype_t arenas_datatypes[PARSEC_dtt_bug_replicator_ADT_IDX_MAX];
+  uint32_t arenas_datatypes_size;
+} parsec_dtt_bug_replicator_taskpool_t;
+
+/** Beware that this object is not a superset of the internal object, and as a result
+ *  we should never create one directly. Instead we should rely on the creation of the
+ *  internal object (__parsec_dtt_bug_replicator_taskpool_t).
+ */
+PARSEC_OBJ_CLASS_DECLARATION(parsec_dtt_bug_replicator_taskpool_t);
+extern parsec_dtt_bug_replicator_taskpool_t *parsec_dtt_bug_replicator_new(parsec_data_collection_t * _g_dataA /* data dataA */);
+
+#if MAX_LOCAL_COUNT < 1  /* number of parameters and locals PONG */
+  #error Too many parameters and local variables (1 out of MAX_LOCAL_COUNT) for task PONG
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_dtt_bug_replicator_PONG_assignment_s {
+  parsec_assignment_t k;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-1];
+} __parsec_dtt_bug_replicator_PONG_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 2  /* total number of flows for task PONG */
+  #error Too many flows (2 out of MAX_PARAM_COUNT) for task PONG
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_dtt_bug_replicator_PONG_data_s {
+  parsec_data_pair_t _f_A;
+  parsec_data_pair_t _f_B;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-2];
+} __parsec_dtt_bug_replicator_PONG_data_t;
+
+typedef struct __parsec_dtt_bug_replicator_PONG_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_dtt_bug_replicator_PONG_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_dtt_bug_replicator_PONG_data_s data;
+} __parsec_dtt_bug_replicator_PONG_task_t;
+
+
+#if MAX_LOCAL_COUNT < 1  /* number of parameters and locals PING */
+  #error Too many parameters and local variables (1 out of MAX_LOCAL_COUNT) for task PING
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_dtt_bug_replicator_PING_assignment_s {
+  parsec_assignment_t k;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-1];
+} __parsec_dtt_bug_replicator_PING_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 2  /* total number of flows for task PING */
+  #error Too many flows (2 out of MAX_PARAM_COUNT) for task PING
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_dtt_bug_replicator_PING_data_s {
+  parsec_data_pair_t _f_A;
+  parsec_data_pair_t _f_B;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-2];
+} __parsec_dtt_bug_replicator_PING_data_t;
+
+typedef struct __parsec_dtt_bug_replicator_PING_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_dtt_bug_replicator_PING_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_dtt_bug_replicator_PING_data_s data;
+} __parsec_dtt_bug_replicator_PING_task_t;
+
+
+END_C_DECLS
+
+#endif /* _dtt_bug_replicator_h_ */ 
@@ -0,0 +1,180 @@
+#ifndef _inplace_h_
+#define _inplace_h_
+#include "parsec.h"
+#include "parsec/parsec_internal.h"
+#include "parsec/remote_dep.h"
+
+BEGIN_C_DECLS
+
+#define PARSEC_inplace_DEFAULT_ADT_IDX    0
+#define PARSEC_inplace_ADT_IDX_MAX       1
+typedef struct parsec_inplace_taskpool_s {
+  parsec_taskpool_t super;
+  /* The list of globals */
+  parsec_matrix_block_cyclic_t* _g_descA /* data descA */;
+  parsec_matrix_block_cyclic_t* _g_descB /* data descB */;
+  int _g_NT;
+  int _g_NB;
+  int32_t* _g_errors;
+  /* The array of datatypes (DEFAULT and co.) */
+  parsec_arena_datatype_t arenas_datatypes[PARSEC_inplace_ADT_IDX_MAX];
+  uint32_t arenas_datatypes_size;
+} parsec_inplace_taskpool_t;
+
+/** Beware that this object is not a superset of the internal object, and as a result
+ *  we should never create one directly. Instead we should rely on the creation of the
+ *  internal object (__parsec_inplace_taskpool_t).
+ */
+PARSEC_OBJ_CLASS_DECLARATION(parsec_inplace_taskpool_t);
+extern parsec_inplace_taskpool_t *parsec_inplace_new(parsec_matrix_block_cyclic_t* _g_descA /* data descA */, parsec_matrix_block_cyclic_t* _g_descB /* data descB */, int _g_NT, int _g_NB, int32_t* _g_errors);
+
+#if MAX_LOCAL_COUNT < 1  /* number of parameters and locals PEEK */
+  #error Too many parameters and local variables (1 out of MAX_LOCAL_COUNT) for task PEEK
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_inplace_PEEK_assignment_s {
+  parsec_assignment_t i;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-1];
+} __parsec_inplace_PEEK_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 1  /* total number of flows for task PEEK */
+  #error Too many flows (1 out of MAX_PARAM_COUNT) for task PEEK
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_inplace_PEEK_data_s {
+  parsec_data_pair_t _f_A;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-1];
+} __parsec_inplace_PEEK_data_t;
+
+typedef struct __parsec_inplace_PEEK_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_inplace_PEEK_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_inplace_PEEK_data_s data;
+} __parsec_inplace_PEEK_task_t;
+
+
+#if MAX_LOCAL_COUNT < 1  /* number of parameters and locals LOOK_END */
+  #error Too many parameters and local variables (1 out of MAX_LOCAL_COUNT) for task LOOK_END
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_inplace_LOOK_END_assignment_s {
+  parsec_assignment_t i;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-1];
+} __parsec_inplace_LOOK_END_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 1  /* total number of flows for task LOOK_END */
+  #error Too many flows (1 out of MAX_PARAM_COUNT) for task LOOK_END
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_inplace_LOOK_END_data_s {
+  parsec_data_pair_t _f_B;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-1];
+} __parsec_inplace_LOOK_END_data_t;
+
+typedef struct __parsec_inplace_LOOK_END_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_inplace_LOOK_END_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_inplace_LOOK_END_data_s data;
+} __parsec_inplace_LOOK_END_task_t;
+
+
+#if MAX_LOCAL_COUNT < 1  /* number of parameters and locals LOOK */
+  #error Too many parameters and local variables (1 out of MAX_LOCAL_COUNT) for task LOOK
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_inplace_LOOK_assignment_s {
+  parsec_assignment_t i;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-1];
+} __parsec_inplace_LOOK_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 2  /* total number of flows for task LOOK */
+  #error Too many flows (2 out of MAX_PARAM_COUNT) for task LOOK
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_inplace_LOOK_data_s {
+  parsec_data_pair_t _f_B;
+  parsec_data_pair_t _f_C;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-2];
+} __parsec_inplace_LOOK_data_t;
+
+typedef struct __parsec_inplace_LOOK_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_inplace_LOOK_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_inplace_LOOK_data_s data;
+} __parsec_inplace_LOOK_task_t;
+
+
+#if MAX_LOCAL_COUNT < 1  /* number of parameters and locals RECV */
+  #error Too many parameters and local variables (1 out of MAX_LOCAL_COUNT) for task RECV
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_inplace_RECV_assignment_s {
+  parsec_assignment_t i;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-1];
+} __parsec_inplace_RECV_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 1  /* total number of flows for task RECV */
+  #error Too many flows (1 out of MAX_PARAM_COUNT) for task RECV
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_inplace_RECV_data_s {
+  parsec_data_pair_t _f_A;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-1];
+} __parsec_inplace_RECV_data_t;
+
+typedef struct __parsec_inplace_RECV_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_inplace_RECV_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_inplace_RECV_data_s data;
+} __parsec_inplace_RECV_task_t;
+
+
+#if MAX_LOCAL_COUNT < 1  /* number of parameters and locals SEND */
+  #error Too many parameters and local variables (1 out of MAX_LOCAL_COUNT) for task SEND
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_inplace_SEND_assignment_s {
+  parsec_assignment_t i;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-1];
+} __parsec_inplace_SEND_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 2  /* total number of flows for task SEND */
+  #error Too many flows (2 out of MAX_PARAM_COUNT) for task SEND
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_inplace_SEND_data_s {
+  parsec_data_pair_t _f_A;
+  parsec_data_pair_t _f_C;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-2];
+} __parsec_inplace_SEND_data_t;
+
+typedef struct __parsec_inplace_SEND_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_inplace_SEND_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_inplace_SEND_data_s data;
+} __parsec_inplace_SEND_task_t;
+
+
+END_C_DECLS
+
+#endif /* _inplace_h_ */ 
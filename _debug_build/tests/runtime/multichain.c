@@ -0,0 +1,3023 @@
+#include "parsec.h"
+#include "parsec/parsec_internal.h"
+#include "parsec/ayudame.h"
+#include "parsec/execution_stream.h"
+#include "parsec/parsec_binary_profile.h"
+#include "parsec/mca/device/device_gpu.h"
+#if defined(PARSEC_HAVE_DEV_CUDA_SUPPORT)
+#include "parsec/mca/device/cuda/device_cuda.h"
+#endif  /* defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) */
+#if defined(PARSEC_HAVE_DEV_HIP_SUPPORT)
+#include "parsec/mca/device/hip/device_hip.h"
+#endif  /* defined(PARSEC_HAVE_DEV_HIP_SUPPORT) */
+#if defined(_MSC_VER) || defined(__MINGW32__)
+#  include <malloc.h>
+#else
+#  include <alloca.h>
+#endif  /* defined(_MSC_VER) || defined(__MINGW32__) */
+
+#define PARSEC_multichain_NB_TASK_CLASSES 2
+#define PARSEC_multichain_NB_DATA 2
+
+typedef struct __parsec_multichain_internal_taskpool_s __parsec_multichain_internal_taskpool_t;
+struct parsec_multichain_internal_taskpool_s;
+
+/** Predeclarations of the parsec_task_class_t */
+static const parsec_task_class_t multichain_VERTICAL;
+static const parsec_task_class_t multichain_HORIZONTAL;
+/** Predeclarations of the parameters */
+static const parsec_flow_t flow_of_multichain_VERTICAL_for_A;
+static const parsec_flow_t flow_of_multichain_VERTICAL_for_B;
+static const parsec_flow_t flow_of_multichain_HORIZONTAL_for_A;
+static const parsec_flow_t flow_of_multichain_HORIZONTAL_for_B;
+/**
+ * Copyright (c) 2014-2022 The University of Tennessee and The University
+ *                         of Tennessee Research Foundation.  All rights
+ *                         reserved.
+ */
+
+#include <sys/time.h>
+#include <inttypes.h>
+#include <string.h>
+#include <stdlib.h>
+#include "parsec/data_dist/matrix/two_dim_rectangle_cyclic.h"
+
+#define BLOCK 10
+#define NN    4
+#define TYPE  PARSEC_MATRIX_FLOAT
+
+#include "multichain.h"
+static parsec_multichain_taskpool_t* tp;
+static int verbose = 0;
+
+/* Create an array of communicator to test PaRSEC capability
+ * to work over different communicators. In addition to informing
+ * the runtime about the change all data should be correctly
+ * created.
+ */
+ static int max_comms = 6;
+ static MPI_Comm comms[6] = {MPI_COMM_WORLD, MPI_COMM_SELF, MPI_COMM_NULL,
+                             MPI_COMM_NULL,  MPI_COMM_NULL, MPI_COMM_WORLD};
+ static char *comm_name[6] = {NULL};
+#define PARSEC_multichain_DEFAULT_ADT    (&__parsec_tp->super.arenas_datatypes[PARSEC_multichain_DEFAULT_ADT_IDX])
+#include "multichain.h"
+
+struct __parsec_multichain_internal_taskpool_s {
+ parsec_multichain_taskpool_t super;
+ volatile int32_t sync_point;
+ volatile int32_t initial_number_tasks;
+ parsec_task_t* startup_queue;
+  /* The ranges to compute the hash key */
+  int VERTICAL_i_min;
+  int VERTICAL_i_range;
+  int VERTICAL_j_min;
+  int VERTICAL_j_range;
+  int HORIZONTAL_i_min;
+  int HORIZONTAL_i_range;
+  /* The list of data repositories  VERTICAL  HORIZONTAL */
+  data_repo_t* repositories[2];
+};
+
+#if defined(PARSEC_PROF_TRACE)
+#  if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+static int multichain_profiling_array[4*PARSEC_multichain_NB_TASK_CLASSES] = {-2}; /* 2 pairs (begin, end) per task, times two because each task class has an internal_init task */
+#  else /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+static int multichain_profiling_array[2*PARSEC_multichain_NB_TASK_CLASSES] = {-2}; /* 2 pairs (begin, end) per task */
+#  endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+#endif  /* defined(PARSEC_PROF_TRACE) */
+/* Globals */
+#define descA __parsec_tp->super._g_descA
+#define descB __parsec_tp->super._g_descB
+#define NI (__parsec_tp->super._g_NI)
+#define NJ (__parsec_tp->super._g_NJ)
+
+static inline int parsec_imin(int a, int b) { return (a <= b) ? a : b; };
+
+static inline int parsec_imax(int a, int b) { return (a >= b) ? a : b; };
+
+/* Data Access Macros */
+#define data_of_descB(descB_d0, descB_d1)  (((parsec_data_collection_t*)__parsec_tp->super._g_descB)->data_of((parsec_data_collection_t*)__parsec_tp->super._g_descB, (descB_d0), (descB_d1)))
+#define data_of_descA(descA_d0, descA_d1)  (((parsec_data_collection_t*)__parsec_tp->super._g_descA)->data_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, (descA_d0), (descA_d1)))
+
+#define rank_of_descB(descB_d0, descB_d1)  (((parsec_data_collection_t*)__parsec_tp->super._g_descB)->rank_of((parsec_data_collection_t*)__parsec_tp->super._g_descB, (descB_d0), (descB_d1)))
+#define rank_of_descA(descA_d0, descA_d1)  (((parsec_data_collection_t*)__parsec_tp->super._g_descA)->rank_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, (descA_d0), (descA_d1)))
+
+/* Functions Predicates */
+#define VERTICAL_pred(i, j) (((parsec_data_collection_t*)(__parsec_tp->super._g_descA))->myrank == rank_of_descA(i, 0))
+#define HORIZONTAL_pred(i) (((parsec_data_collection_t*)(__parsec_tp->super._g_descA))->myrank == rank_of_descA(i, 0))
+
+/* Data Repositories */
+#define VERTICAL_repo (__parsec_tp->repositories[1])
+#define HORIZONTAL_repo (__parsec_tp->repositories[0])
+/* Release dependencies output macro */
+#if defined(PARSEC_DEBUG_NOISIER)
+#define RELEASE_DEP_OUTPUT(ES, DEPO, TASKO, DEPI, TASKI, RSRC, RDST, DATA)\
+  do { \
+    char tmp1[128], tmp2[128]; (void)tmp1; (void)tmp2;\
+    PARSEC_DEBUG_VERBOSE(20, parsec_debug_output, "thread %d VP %d explore deps from %s:%s to %s:%s (from rank %d to %d) base ptr %p",\
+           (NULL != (ES) ? (ES)->th_id : -1), (NULL != (ES) ? (ES)->virtual_process->vp_id : -1),\
+           DEPO, parsec_task_snprintf(tmp1, 128, (parsec_task_t*)(TASKO)),\
+           DEPI, parsec_task_snprintf(tmp2, 128, (parsec_task_t*)(TASKI)), (RSRC), (RDST), (DATA));\
+  } while(0)
+#define ACQUIRE_FLOW(TASKI, DEPI, FUNO, DEPO, LOCALS, PTR)\
+  do { \
+    char tmp1[128], tmp2[128]; (void)tmp1; (void)tmp2;\
+    PARSEC_DEBUG_VERBOSE(20, parsec_debug_output, "task %s acquires flow %s from %s %s data ptr %p",\
+           parsec_task_snprintf(tmp1, 128, (parsec_task_t*)(TASKI)), (DEPI),\
+           (DEPO), parsec_snprintf_assignments(tmp2, 128, (FUNO), (parsec_assignment_t*)(LOCALS)), (PTR));\
+  } while(0)
+#else
+#define RELEASE_DEP_OUTPUT(ES, DEPO, TASKO, DEPI, TASKI, RSRC, RDST, DATA)
+#define ACQUIRE_FLOW(TASKI, DEPI, TASKO, DEPO, LOCALS, PTR)
+#endif
+static inline parsec_key_t __jdf2c_make_key_VERTICAL(const parsec_taskpool_t *tp, const parsec_assignment_t *as)
+{
+  const __parsec_multichain_internal_taskpool_t *__parsec_tp = (const __parsec_multichain_internal_taskpool_t *)tp;
+  const __parsec_multichain_VERTICAL_parsec_assignment_t *assignment = (const __parsec_multichain_VERTICAL_parsec_assignment_t*)as;
+  uint64_t __parsec_id = 0;
+  __parsec_id += (assignment->i.value - __parsec_tp->VERTICAL_i_min);
+  __parsec_id += (assignment->j.value - __parsec_tp->VERTICAL_j_min) * __parsec_tp->VERTICAL_i_range;
+  return (parsec_key_t)__parsec_id;
+}
+static char *__jdf2c_key_fns_VERTICAL_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_multichain_internal_taskpool_t *__parsec_tp = (__parsec_multichain_internal_taskpool_t *)user_data;
+  int i = (__parsec_key) % __parsec_tp->VERTICAL_i_range + __parsec_tp->VERTICAL_i_min;
+  __parsec_key = __parsec_key / __parsec_tp->VERTICAL_i_range;
+  int j = (__parsec_key) % __parsec_tp->VERTICAL_j_range + __parsec_tp->VERTICAL_j_min;
+  __parsec_key = __parsec_key / __parsec_tp->VERTICAL_j_range;
+  snprintf(buffer, buffer_size, "VERTICAL(%d, %d)", i, j);
+  return buffer;
+}
+
+static parsec_key_fn_t __jdf2c_key_fns_VERTICAL = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = __jdf2c_key_fns_VERTICAL_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+static inline parsec_key_t __jdf2c_make_key_HORIZONTAL(const parsec_taskpool_t *tp, const parsec_assignment_t *as)
+{
+  const __parsec_multichain_internal_taskpool_t *__parsec_tp = (const __parsec_multichain_internal_taskpool_t *)tp;
+  const __parsec_multichain_HORIZONTAL_parsec_assignment_t *assignment = (const __parsec_multichain_HORIZONTAL_parsec_assignment_t*)as;
+  uint64_t __parsec_id = 0;
+  __parsec_id += (assignment->i.value - __parsec_tp->HORIZONTAL_i_min);
+  return (parsec_key_t)__parsec_id;
+}
+static char *__jdf2c_key_fns_HORIZONTAL_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_multichain_internal_taskpool_t *__parsec_tp = (__parsec_multichain_internal_taskpool_t *)user_data;
+  int i = (__parsec_key) % __parsec_tp->HORIZONTAL_i_range + __parsec_tp->HORIZONTAL_i_min;
+  __parsec_key = __parsec_key / __parsec_tp->HORIZONTAL_i_range;
+  snprintf(buffer, buffer_size, "HORIZONTAL(%d)", i);
+  return buffer;
+}
+
+static parsec_key_fn_t __jdf2c_key_fns_HORIZONTAL = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = __jdf2c_key_fns_HORIZONTAL_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/******                                    VERTICAL                                    ******/
+
+static inline int32_t minexpr_of_symb_multichain_VERTICAL_i_fct(const __parsec_multichain_internal_taskpool_t *__parsec_tp, const __parsec_multichain_VERTICAL_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_multichain_VERTICAL_i = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_multichain_VERTICAL_i_fct }
+                   }
+};
+static inline int maxexpr_of_symb_multichain_VERTICAL_i_fct(const __parsec_multichain_internal_taskpool_t *__parsec_tp, const __parsec_multichain_VERTICAL_parsec_assignment_t *locals)
+{
+  const int i = locals->i.value; (void)i;
+  const int j = locals->j.value; (void)j;
+
+  (void)i;
+  (void)j;
+  (void)__parsec_tp; (void)locals;
+  return (NI - 1);
+}
+static const parsec_expr_t maxexpr_of_symb_multichain_VERTICAL_i = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_multichain_VERTICAL_i_fct }
+                   }
+};
+static const parsec_symbol_t symb_multichain_VERTICAL_i = { .name = "i", .context_index = 0, .min = &minexpr_of_symb_multichain_VERTICAL_i, .max = &maxexpr_of_symb_multichain_VERTICAL_i, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int32_t minexpr_of_symb_multichain_VERTICAL_j_fct(const __parsec_multichain_internal_taskpool_t *__parsec_tp, const __parsec_multichain_VERTICAL_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_multichain_VERTICAL_j = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_multichain_VERTICAL_j_fct }
+                   }
+};
+static inline int maxexpr_of_symb_multichain_VERTICAL_j_fct(const __parsec_multichain_internal_taskpool_t *__parsec_tp, const __parsec_multichain_VERTICAL_parsec_assignment_t *locals)
+{
+  const int i = locals->i.value; (void)i;
+  const int j = locals->j.value; (void)j;
+
+  (void)i;
+  (void)j;
+  (void)__parsec_tp; (void)locals;
+  return (NJ - 1);
+}
+static const parsec_expr_t maxexpr_of_symb_multichain_VERTICAL_j = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_multichain_VERTICAL_j_fct }
+                   }
+};
+static const parsec_symbol_t symb_multichain_VERTICAL_j = { .name = "j", .context_index = 1, .min = &minexpr_of_symb_multichain_VERTICAL_j, .max = &maxexpr_of_symb_multichain_VERTICAL_j, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int affinity_of_multichain_VERTICAL(const __parsec_multichain_VERTICAL_task_t *this_task,
+                     parsec_data_ref_t *ref)
+{
+    const __parsec_multichain_internal_taskpool_t *__parsec_tp = (const __parsec_multichain_internal_taskpool_t*)this_task->taskpool;
+  const int i = this_task->locals.i.value; (void)i;
+  const int j = this_task->locals.j.value; (void)j;
+
+  /* Silent Warnings: should look into predicate to know what variables are usefull */
+  (void)i;
+  (void)j;
+  ref->dc = (parsec_data_collection_t *)__parsec_tp->super._g_descA;
+  /* Compute data key */
+  ref->key = ref->dc->data_key(ref->dc, i, 0);
+  return 1;
+}
+static const parsec_property_t properties_of_multichain_VERTICAL[1] = {
+  {.name = NULL, .expr = NULL}
+};
+static inline int expr_of_cond_for_flow_of_multichain_VERTICAL_for_A_dep1_atline_59_iftrue_fct(const __parsec_multichain_internal_taskpool_t *__parsec_tp, const __parsec_multichain_VERTICAL_parsec_assignment_t *locals)
+{
+  const int i = locals->i.value; (void)i;
+  const int j = locals->j.value;
+
+  (void)i;
+  (void)j;
+  (void)__parsec_tp; (void)locals;
+  return (j) == (0);
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_multichain_VERTICAL_for_A_dep1_atline_59_iftrue = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_multichain_VERTICAL_for_A_dep1_atline_59_iftrue_fct }
+                   }
+};
+static const parsec_dep_t flow_of_multichain_VERTICAL_for_A_dep1_atline_59_iftrue = {
+  .cond = &expr_of_cond_for_flow_of_multichain_VERTICAL_for_A_dep1_atline_59_iftrue,  /* (j) == (0) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 0, /* multichain_HORIZONTAL */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_multichain_HORIZONTAL_for_A,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_multichain_VERTICAL_for_A,
+};
+static inline int expr_of_cond_for_flow_of_multichain_VERTICAL_for_A_dep1_atline_59_iffalse_fct(const __parsec_multichain_internal_taskpool_t *__parsec_tp, const __parsec_multichain_VERTICAL_parsec_assignment_t *locals)
+{
+  const int i = locals->i.value; (void)i;
+  const int j = locals->j.value;
+
+  (void)i;
+  (void)j;
+  (void)__parsec_tp; (void)locals;
+  return !((j) == (0));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_multichain_VERTICAL_for_A_dep1_atline_59_iffalse = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_multichain_VERTICAL_for_A_dep1_atline_59_iffalse_fct }
+                   }
+};
+static const parsec_dep_t flow_of_multichain_VERTICAL_for_A_dep1_atline_59_iffalse = {
+  .cond = &expr_of_cond_for_flow_of_multichain_VERTICAL_for_A_dep1_atline_59_iffalse,  /* !(j) == (0) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 1, /* multichain_VERTICAL */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_multichain_VERTICAL_for_A,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_multichain_VERTICAL_for_A,
+};
+static inline int expr_of_cond_for_flow_of_multichain_VERTICAL_for_A_dep2_atline_60_fct(const __parsec_multichain_internal_taskpool_t *__parsec_tp, const __parsec_multichain_VERTICAL_parsec_assignment_t *locals)
+{
+  const int i = locals->i.value; (void)i;
+  const int j = locals->j.value; (void)j;
+
+  (void)i;
+  (void)j;
+  (void)__parsec_tp; (void)locals;
+  return (j) != ((NJ - 1));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_multichain_VERTICAL_for_A_dep2_atline_60 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_multichain_VERTICAL_for_A_dep2_atline_60_fct }
+                   }
+};
+static const parsec_dep_t flow_of_multichain_VERTICAL_for_A_dep2_atline_60 = {
+  .cond = &expr_of_cond_for_flow_of_multichain_VERTICAL_for_A_dep2_atline_60,  /* (j) != ((NJ - 1)) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 1, /* multichain_VERTICAL */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_multichain_VERTICAL_for_A,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_multichain_VERTICAL_for_A,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+#if MAX_DEP_OUT_COUNT < 1  /* number of output dependencies */
+    #error Too many output dependencies (supports up to MAX_DEP_OUT_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_OUT_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_multichain_VERTICAL_for_A = {
+  .name               = "A",
+  .sym_type           = PARSEC_SYM_INOUT,
+  .flow_flags         = PARSEC_FLOW_ACCESS_READ,
+  .flow_index         = 0,
+  .flow_datatype_mask = 0x1,
+  .dep_in     = { &flow_of_multichain_VERTICAL_for_A_dep1_atline_59_iftrue,
+ &flow_of_multichain_VERTICAL_for_A_dep1_atline_59_iffalse },
+  .dep_out    = { &flow_of_multichain_VERTICAL_for_A_dep2_atline_60 }
+};
+
+static inline int expr_of_cond_for_flow_of_multichain_VERTICAL_for_B_dep1_atline_61_iftrue_fct(const __parsec_multichain_internal_taskpool_t *__parsec_tp, const __parsec_multichain_VERTICAL_parsec_assignment_t *locals)
+{
+  const int i = locals->i.value;
+  const int j = locals->j.value; (void)j;
+
+  (void)i;
+  (void)j;
+  (void)__parsec_tp; (void)locals;
+  return (i) == (0);
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_multichain_VERTICAL_for_B_dep1_atline_61_iftrue = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_multichain_VERTICAL_for_B_dep1_atline_61_iftrue_fct }
+                   }
+};
+static parsec_data_t *flow_of_multichain_VERTICAL_for_B_dep1_atline_61_direct_access(const __parsec_multichain_internal_taskpool_t *__parsec_tp, const __parsec_multichain_VERTICAL_parsec_assignment_t *assignments)
+{
+  const int i = assignments->i.value; (void)i;
+  const int j = assignments->j.value; (void)j;
+
+  /* Silence Warnings: should look into parameters to know what variables are useful */
+  (void)i;
+  (void)j;
+  if( __parsec_tp->super.super.context->my_rank == (int32_t)rank_of_descB(i, 0) )
+    return data_of_descB(i, 0);
+  return NULL;
+}
+
+static const parsec_dep_t flow_of_multichain_VERTICAL_for_B_dep1_atline_61_iftrue = {
+  .cond = &expr_of_cond_for_flow_of_multichain_VERTICAL_for_B_dep1_atline_61_iftrue,  /* (i) == (0) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = PARSEC_LOCAL_DATA_TASK_CLASS_ID, /* multichain_descB */
+  .direct_data = (parsec_data_lookup_func_t)&flow_of_multichain_VERTICAL_for_B_dep1_atline_61_direct_access,
+  .dep_index = 1,
+  .dep_datatype_index = 1,
+  .belongs_to = &flow_of_multichain_VERTICAL_for_B,
+};
+static inline int expr_of_cond_for_flow_of_multichain_VERTICAL_for_B_dep1_atline_61_iffalse_fct(const __parsec_multichain_internal_taskpool_t *__parsec_tp, const __parsec_multichain_VERTICAL_parsec_assignment_t *locals)
+{
+  const int i = locals->i.value;
+  const int j = locals->j.value; (void)j;
+
+  (void)i;
+  (void)j;
+  (void)__parsec_tp; (void)locals;
+  return !((i) == (0));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_multichain_VERTICAL_for_B_dep1_atline_61_iffalse = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_multichain_VERTICAL_for_B_dep1_atline_61_iffalse_fct }
+                   }
+};
+static const parsec_dep_t flow_of_multichain_VERTICAL_for_B_dep1_atline_61_iffalse = {
+  .cond = &expr_of_cond_for_flow_of_multichain_VERTICAL_for_B_dep1_atline_61_iffalse,  /* !(i) == (0) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 1, /* multichain_VERTICAL */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_multichain_VERTICAL_for_B,
+  .dep_index = 1,
+  .dep_datatype_index = 1,
+  .belongs_to = &flow_of_multichain_VERTICAL_for_B,
+};
+static inline int expr_of_cond_for_flow_of_multichain_VERTICAL_for_B_dep2_atline_62_iftrue_fct(const __parsec_multichain_internal_taskpool_t *__parsec_tp, const __parsec_multichain_VERTICAL_parsec_assignment_t *locals)
+{
+  const int i = locals->i.value; (void)i;
+  const int j = locals->j.value; (void)j;
+
+  (void)i;
+  (void)j;
+  (void)__parsec_tp; (void)locals;
+  return (i) != ((NI - 1));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_multichain_VERTICAL_for_B_dep2_atline_62_iftrue = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_multichain_VERTICAL_for_B_dep2_atline_62_iftrue_fct }
+                   }
+};
+static const parsec_dep_t flow_of_multichain_VERTICAL_for_B_dep2_atline_62_iftrue = {
+  .cond = &expr_of_cond_for_flow_of_multichain_VERTICAL_for_B_dep2_atline_62_iftrue,  /* (i) != ((NI - 1)) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 1, /* multichain_VERTICAL */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_multichain_VERTICAL_for_B,
+  .dep_index = 1,
+  .dep_datatype_index = 1,
+  .belongs_to = &flow_of_multichain_VERTICAL_for_B,
+};
+static inline int expr_of_cond_for_flow_of_multichain_VERTICAL_for_B_dep2_atline_62_iffalse_fct(const __parsec_multichain_internal_taskpool_t *__parsec_tp, const __parsec_multichain_VERTICAL_parsec_assignment_t *locals)
+{
+  const int i = locals->i.value; (void)i;
+  const int j = locals->j.value; (void)j;
+
+  (void)i;
+  (void)j;
+  (void)__parsec_tp; (void)locals;
+  return !((i) != ((NI - 1)));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_multichain_VERTICAL_for_B_dep2_atline_62_iffalse = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_multichain_VERTICAL_for_B_dep2_atline_62_iffalse_fct }
+                   }
+};
+static parsec_data_t *flow_of_multichain_VERTICAL_for_B_dep2_atline_62_direct_access(const __parsec_multichain_internal_taskpool_t *__parsec_tp, const __parsec_multichain_VERTICAL_parsec_assignment_t *assignments)
+{
+  const int i = assignments->i.value; (void)i;
+  const int j = assignments->j.value; (void)j;
+
+  /* Silence Warnings: should look into parameters to know what variables are useful */
+  (void)i;
+  (void)j;
+  if( __parsec_tp->super.super.context->my_rank == (int32_t)rank_of_descB(i, 0) )
+    return data_of_descB(i, 0);
+  return NULL;
+}
+
+static const parsec_dep_t flow_of_multichain_VERTICAL_for_B_dep2_atline_62_iffalse = {
+  .cond = &expr_of_cond_for_flow_of_multichain_VERTICAL_for_B_dep2_atline_62_iffalse,  /* !(i) != ((NI - 1)) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = PARSEC_LOCAL_DATA_TASK_CLASS_ID, /* multichain_descB */
+  .direct_data = (parsec_data_lookup_func_t)&flow_of_multichain_VERTICAL_for_B_dep2_atline_62_direct_access,
+  .flags = PARSEC_DEP_FINAL_WRITE_AS_IS,
+  .dep_index = 1,
+  .dep_datatype_index = 1,
+  .belongs_to = &flow_of_multichain_VERTICAL_for_B,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+#if MAX_DEP_OUT_COUNT < 1  /* number of output dependencies */
+    #error Too many output dependencies (supports up to MAX_DEP_OUT_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_OUT_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_multichain_VERTICAL_for_B = {
+  .name               = "B",
+  .sym_type           = PARSEC_SYM_INOUT,
+  .flow_flags         = PARSEC_FLOW_ACCESS_RW|PARSEC_FLOW_HAS_IN_DEPS,
+  .flow_index         = 1,
+  .flow_datatype_mask = 0x2,
+  .dep_in     = { &flow_of_multichain_VERTICAL_for_B_dep1_atline_61_iftrue,
+ &flow_of_multichain_VERTICAL_for_B_dep1_atline_61_iffalse },
+  .dep_out    = { &flow_of_multichain_VERTICAL_for_B_dep2_atline_62_iftrue,
+ &flow_of_multichain_VERTICAL_for_B_dep2_atline_62_iffalse }
+};
+
+static void
+iterate_successors_of_multichain_VERTICAL(parsec_execution_stream_t *es, const __parsec_multichain_VERTICAL_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_multichain_internal_taskpool_t *__parsec_tp = (const __parsec_multichain_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_multichain_VERTICAL_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_multichain_VERTICAL_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int i = __jdf2c__tmp_locals.i.value; (void)i;
+  const int j = __jdf2c__tmp_locals.j.value; (void)j;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)i;  (void)j;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_descA(i, 0);
+#endif
+  if( action_mask & 0x1 ) {  /* Flow of data A [0] */
+    data.data   = this_task->data._f_A.data_out;
+    data.data_future  = NULL;
+    if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_multichain_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_multichain_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+       if( (j) != ((NJ - 1)) ) {
+      __parsec_multichain_VERTICAL_task_t* ncc = (__parsec_multichain_VERTICAL_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[multichain_VERTICAL.task_class_id];
+        const int VERTICAL_i = i;
+        if( (VERTICAL_i >= (0)) && (VERTICAL_i <= ((NI - 1))) ) {
+          assert(&nc.locals[0].value == &ncc->locals.i.value);
+          ncc->locals.i.value = VERTICAL_i;
+          const int VERTICAL_j = (j + 1);
+          if( (VERTICAL_j >= (0)) && (VERTICAL_j <= ((NJ - 1))) ) {
+            assert(&nc.locals[1].value == &ncc->locals.j.value);
+            ncc->locals.j.value = VERTICAL_j;
+#if defined(DISTRIBUTED)
+            rank_dst = rank_of_descA(ncc->locals.i.value, 0);
+            if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+              vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, ncc->locals.i.value, 0);
+            nc.priority = __parsec_tp->super.super.priority;
+            successor_repo = VERTICAL_repo;
+            successor_repo_key = __jdf2c_make_key_VERTICAL((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+          RELEASE_DEP_OUTPUT(es, "A", this_task, "A", &nc, rank_src, rank_dst, &data);
+          if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_multichain_VERTICAL_for_A_dep2_atline_60, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+            }
+          }
+    }
+  }
+  if( action_mask & 0x2 ) {  /* Flow of data B [1] */
+    data.data   = this_task->data._f_B.data_out;
+    data.data_future  = NULL;
+    if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_multichain_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_multichain_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+       if( (i) != ((NI - 1)) ) {
+      __parsec_multichain_VERTICAL_task_t* ncc = (__parsec_multichain_VERTICAL_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[multichain_VERTICAL.task_class_id];
+        const int VERTICAL_i = (i + 1);
+        if( (VERTICAL_i >= (0)) && (VERTICAL_i <= ((NI - 1))) ) {
+          assert(&nc.locals[0].value == &ncc->locals.i.value);
+          ncc->locals.i.value = VERTICAL_i;
+          const int VERTICAL_j = j;
+          if( (VERTICAL_j >= (0)) && (VERTICAL_j <= ((NJ - 1))) ) {
+            assert(&nc.locals[1].value == &ncc->locals.j.value);
+            ncc->locals.j.value = VERTICAL_j;
+#if defined(DISTRIBUTED)
+            rank_dst = rank_of_descA(ncc->locals.i.value, 0);
+            if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+              vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, ncc->locals.i.value, 0);
+            nc.priority = __parsec_tp->super.super.priority;
+            successor_repo = VERTICAL_repo;
+            successor_repo_key = __jdf2c_make_key_VERTICAL((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+          RELEASE_DEP_OUTPUT(es, "B", this_task, "B", &nc, rank_src, rank_dst, &data);
+          if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_multichain_VERTICAL_for_B_dep2_atline_62_iftrue, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+            }
+          }
+    }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static void
+iterate_predecessors_of_multichain_VERTICAL(parsec_execution_stream_t *es, const __parsec_multichain_VERTICAL_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_multichain_internal_taskpool_t *__parsec_tp = (const __parsec_multichain_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_multichain_VERTICAL_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_multichain_VERTICAL_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int i = __jdf2c__tmp_locals.i.value; (void)i;
+  const int j = __jdf2c__tmp_locals.j.value; (void)j;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)i;  (void)j;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_descA(i, 0);
+#endif
+  if( action_mask & 0x1 ) {  /* Flow of data A [0] */
+    data.data   = this_task->data._f_A.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x1 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_multichain_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_multichain_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( (j) == (0) ) {
+      __parsec_multichain_HORIZONTAL_task_t* ncc = (__parsec_multichain_HORIZONTAL_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[multichain_HORIZONTAL.task_class_id];
+        const int HORIZONTAL_i = i;
+        if( (HORIZONTAL_i >= (0)) && (HORIZONTAL_i <= ((NI - 1))) ) {
+          assert(&nc.locals[0].value == &ncc->locals.i.value);
+          ncc->locals.i.value = HORIZONTAL_i;
+#if defined(DISTRIBUTED)
+          rank_dst = rank_of_descA(ncc->locals.i.value, 0);
+          if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+            vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, ncc->locals.i.value, 0);
+          nc.priority = __parsec_tp->super.super.priority;
+          successor_repo = HORIZONTAL_repo;
+          successor_repo_key = __jdf2c_make_key_HORIZONTAL((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+        RELEASE_DEP_OUTPUT(es, "A", this_task, "A", &nc, rank_src, rank_dst, &data);
+        if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_multichain_VERTICAL_for_A_dep1_atline_59_iftrue, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+          }
+    } else {
+      __parsec_multichain_VERTICAL_task_t* ncc = (__parsec_multichain_VERTICAL_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[multichain_VERTICAL.task_class_id];
+        const int VERTICAL_i = i;
+        if( (VERTICAL_i >= (0)) && (VERTICAL_i <= ((NI - 1))) ) {
+          assert(&nc.locals[0].value == &ncc->locals.i.value);
+          ncc->locals.i.value = VERTICAL_i;
+          const int VERTICAL_j = (j - 1);
+          if( (VERTICAL_j >= (0)) && (VERTICAL_j <= ((NJ - 1))) ) {
+            assert(&nc.locals[1].value == &ncc->locals.j.value);
+            ncc->locals.j.value = VERTICAL_j;
+#if defined(DISTRIBUTED)
+            rank_dst = rank_of_descA(ncc->locals.i.value, 0);
+            if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+              vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, ncc->locals.i.value, 0);
+            nc.priority = __parsec_tp->super.super.priority;
+            successor_repo = VERTICAL_repo;
+            successor_repo_key = __jdf2c_make_key_VERTICAL((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+          RELEASE_DEP_OUTPUT(es, "A", this_task, "A", &nc, rank_src, rank_dst, &data);
+          if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_multichain_VERTICAL_for_A_dep1_atline_59_iffalse, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+            }
+          }
+    }
+  }
+  }
+  if( action_mask & 0x2 ) {  /* Flow of data B [1] */
+    data.data   = this_task->data._f_B.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x2 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_multichain_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_multichain_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( !((i) == (0)) ) {
+      __parsec_multichain_VERTICAL_task_t* ncc = (__parsec_multichain_VERTICAL_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[multichain_VERTICAL.task_class_id];
+        const int VERTICAL_i = (i - 1);
+        if( (VERTICAL_i >= (0)) && (VERTICAL_i <= ((NI - 1))) ) {
+          assert(&nc.locals[0].value == &ncc->locals.i.value);
+          ncc->locals.i.value = VERTICAL_i;
+          const int VERTICAL_j = j;
+          if( (VERTICAL_j >= (0)) && (VERTICAL_j <= ((NJ - 1))) ) {
+            assert(&nc.locals[1].value == &ncc->locals.j.value);
+            ncc->locals.j.value = VERTICAL_j;
+#if defined(DISTRIBUTED)
+            rank_dst = rank_of_descA(ncc->locals.i.value, 0);
+            if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+              vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, ncc->locals.i.value, 0);
+            nc.priority = __parsec_tp->super.super.priority;
+            successor_repo = VERTICAL_repo;
+            successor_repo_key = __jdf2c_make_key_VERTICAL((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+          RELEASE_DEP_OUTPUT(es, "B", this_task, "B", &nc, rank_src, rank_dst, &data);
+          if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_multichain_VERTICAL_for_B_dep1_atline_61_iffalse, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+            }
+          }
+    }
+  }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static int release_deps_of_multichain_VERTICAL(parsec_execution_stream_t *es, __parsec_multichain_VERTICAL_task_t *this_task, uint32_t action_mask, parsec_remote_deps_t *deps)
+{
+  PARSEC_PINS(es, RELEASE_DEPS_BEGIN, (parsec_task_t *)this_task);  const __parsec_multichain_internal_taskpool_t *__parsec_tp = (const __parsec_multichain_internal_taskpool_t *)this_task->taskpool;
+  parsec_release_dep_fct_arg_t arg;
+  int __vp_id;
+  int consume_local_repo = 0;
+  arg.action_mask = action_mask;
+  arg.output_entry = NULL;
+  arg.output_repo = NULL;
+#if defined(DISTRIBUTED)
+  arg.remote_deps = deps;
+#endif  /* defined(DISTRIBUTED) */
+  assert(NULL != es);
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS )    arg.ready_lists = alloca(sizeof(parsec_task_t *) * es->virtual_process->parsec_context->nb_vp);
+  else
+    arg.ready_lists = NULL;
+  for( __vp_id = 0; __vp_id < es->virtual_process->parsec_context->nb_vp; arg.ready_lists[__vp_id++] = NULL );
+  (void)__parsec_tp; (void)deps;
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_A.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_A.source_repo, this_task->data._f_A.source_repo_entry->ht_item.key );
+    }
+    if( NULL != this_task->data._f_B.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_B.source_repo, this_task->data._f_B.source_repo_entry->ht_item.key );
+    }
+  }
+  consume_local_repo = (this_task->repo_entry != NULL);
+  arg.output_repo = VERTICAL_repo;
+  arg.output_entry = this_task->repo_entry;
+  arg.output_usage = 0;
+  if( action_mask & (PARSEC_ACTION_RELEASE_LOCAL_DEPS | PARSEC_ACTION_GET_REPO_ENTRY) ) {
+    arg.output_entry = data_repo_lookup_entry_and_create( es, arg.output_repo, __jdf2c_make_key_VERTICAL((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    arg.output_entry->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(arg.output_entry->sim_exec_date == 0);
+    arg.output_entry->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  if(action_mask & ( PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE ) ){
+    /* Generate the reshape promise for the outputs that need it */
+    iterate_successors_of_multichain_VERTICAL(es, this_task, action_mask, parsec_set_up_reshape_promise, &arg);
+   }
+  iterate_successors_of_multichain_VERTICAL(es, this_task, action_mask, parsec_release_dep_fct, &arg);
+
+#if defined(DISTRIBUTED)
+  if( (action_mask & PARSEC_ACTION_SEND_REMOTE_DEPS) && (NULL != arg.remote_deps)) {
+    parsec_remote_dep_activate(es, (parsec_task_t *)this_task, arg.remote_deps, arg.remote_deps->outgoing_mask);
+  }
+#endif
+
+  if(action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS) {
+    data_repo_entry_addto_usage_limit(VERTICAL_repo, arg.output_entry->ht_item.key, arg.output_usage);
+    __parsec_schedule_vp(es, arg.ready_lists, 0);
+  }
+      if (consume_local_repo) {
+         data_repo_entry_used_once( VERTICAL_repo, this_task->repo_entry->ht_item.key );
+      }
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_A.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_A.data_in);
+    }
+    if( NULL != this_task->data._f_B.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_B.data_in);
+    }
+  }
+  PARSEC_PINS(es, RELEASE_DEPS_END, (parsec_task_t *)this_task);  return 0;
+}
+
+static int data_lookup_of_multichain_VERTICAL(parsec_execution_stream_t *es, __parsec_multichain_VERTICAL_task_t *this_task)
+{
+  const __parsec_multichain_internal_taskpool_t *__parsec_tp = (__parsec_multichain_internal_taskpool_t *)this_task->taskpool;
+  parsec_assignment_t generic_locals[MAX_PARAM_COUNT];  /* generic task locals */
+  int target_device = 0; (void)target_device;
+  (void)__parsec_tp; (void)generic_locals; (void)es;
+  parsec_data_copy_t *chunk = NULL;
+  data_repo_t        *reshape_repo  = NULL, *consumed_repo  = NULL;
+  data_repo_entry_t  *reshape_entry = NULL, *consumed_entry = NULL;
+  parsec_key_t        reshape_entry_key = 0, consumed_entry_key = 0;
+  uint8_t             consumed_flow_index;
+  parsec_dep_data_description_t data;
+  int ret;
+  (void)reshape_repo; (void)reshape_entry; (void)reshape_entry_key;
+  (void)consumed_repo; (void)consumed_entry; (void)consumed_entry_key;
+  (void)consumed_flow_index;
+  (void)chunk; (void)data; (void)ret;
+  const int i = this_task->locals.i.value; (void)i;
+  const int j = this_task->locals.j.value; (void)j;
+  if( NULL == this_task->repo_entry ){
+    this_task->repo_entry = data_repo_lookup_entry_and_create(es, VERTICAL_repo,                                       __jdf2c_make_key_VERTICAL((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    data_repo_entry_addto_usage_limit(VERTICAL_repo, this_task->repo_entry->ht_item.key, 1);    this_task->repo_entry ->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(this_task->repo_entry ->sim_exec_date == 0);
+    this_task->repo_entry ->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  /* The reshape repo is the current task repo. */  reshape_repo = VERTICAL_repo;
+  reshape_entry_key = __jdf2c_make_key_VERTICAL((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals) ;
+  reshape_entry = this_task->repo_entry;
+  /* Lookup the input data, and store them in the context if any */
+
+if(! this_task->data._f_A.fulfill ){ /* Flow A */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_A.data_out = NULL;  /* By default, if nothing matches */
+    if( (j) == (0) ) {
+    /* Flow A [0] dependency [0] from predecessor HORIZONTAL */
+    if( NULL == (chunk = this_task->data._f_A.data_in) ) {
+    /* No data set up by predecessor on this task input flow */
+__parsec_multichain_HORIZONTAL_parsec_assignment_t *target_locals = (__parsec_multichain_HORIZONTAL_parsec_assignment_t*)&generic_locals;
+      const int HORIZONTALi = target_locals->i.value = i; (void)HORIZONTALi;
+      if( (reshape_entry != NULL) && (reshape_entry->data[0] != NULL) ){
+          /* Reshape promise set up on this task repo by predecessor */
+          consumed_repo = reshape_repo;
+          consumed_entry = reshape_entry;
+          consumed_entry_key = reshape_entry_key;
+          consumed_flow_index = 0;
+      }else{
+          /* Consume from predecessor's repo */
+          consumed_repo = HORIZONTAL_repo;
+          consumed_entry_key = __jdf2c_make_key_HORIZONTAL((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)target_locals) ;
+          consumed_entry = data_repo_lookup_entry( consumed_repo, consumed_entry_key );
+          consumed_flow_index = 0;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      ACQUIRE_FLOW(this_task, "A", &multichain_HORIZONTAL, "A", target_locals, chunk);
+      this_task->data._f_A.data_out = chunk;
+    } 
+    else {
+      /* Data set up by predecessor on this task input flow */
+      consumed_repo = this_task->data._f_A.source_repo;
+      consumed_entry = this_task->data._f_A.source_repo_entry;
+      consumed_entry_key = this_task->data._f_A.source_repo_entry->ht_item.key;
+      if( (reshape_entry != NULL) && (reshape_entry->data[0] != NULL) ){
+          /* Reshape promise set up on input by predecessor is on this task repo */
+          consumed_flow_index = 0;
+          assert( (this_task->data._f_A.source_repo == reshape_repo)
+               && (this_task->data._f_A.source_repo_entry == reshape_entry));
+      }else{
+          /* Reshape promise set up on input by predecessor is the predecesssor task repo */
+          consumed_flow_index = 0;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      this_task->data._f_A.data_out = parsec_data_get_copy(chunk->original, target_device);
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+      parsec_prof_grapher_data_input(chunk->original, (parsec_task_t*)this_task, &flow_of_multichain_VERTICAL_for_A, 0);
+#endif
+    }
+    } else {
+    /* Flow A [0] dependency [0] from predecessor VERTICAL */
+    if( NULL == (chunk = this_task->data._f_A.data_in) ) {
+    /* No data set up by predecessor on this task input flow */
+__parsec_multichain_VERTICAL_parsec_assignment_t *target_locals = (__parsec_multichain_VERTICAL_parsec_assignment_t*)&generic_locals;
+      const int VERTICALi = target_locals->i.value = i; (void)VERTICALi;
+      const int VERTICALj = target_locals->j.value = (j - 1); (void)VERTICALj;
+      if( (reshape_entry != NULL) && (reshape_entry->data[0] != NULL) ){
+          /* Reshape promise set up on this task repo by predecessor */
+          consumed_repo = reshape_repo;
+          consumed_entry = reshape_entry;
+          consumed_entry_key = reshape_entry_key;
+          consumed_flow_index = 0;
+      }else{
+          /* Consume from predecessor's repo */
+          consumed_repo = VERTICAL_repo;
+          consumed_entry_key = __jdf2c_make_key_VERTICAL((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)target_locals) ;
+          consumed_entry = data_repo_lookup_entry( consumed_repo, consumed_entry_key );
+          consumed_flow_index = 0;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      ACQUIRE_FLOW(this_task, "A", &multichain_VERTICAL, "A", target_locals, chunk);
+      this_task->data._f_A.data_out = chunk;
+    } 
+    else {
+      /* Data set up by predecessor on this task input flow */
+      consumed_repo = this_task->data._f_A.source_repo;
+      consumed_entry = this_task->data._f_A.source_repo_entry;
+      consumed_entry_key = this_task->data._f_A.source_repo_entry->ht_item.key;
+      if( (reshape_entry != NULL) && (reshape_entry->data[0] != NULL) ){
+          /* Reshape promise set up on input by predecessor is on this task repo */
+          consumed_flow_index = 0;
+          assert( (this_task->data._f_A.source_repo == reshape_repo)
+               && (this_task->data._f_A.source_repo_entry == reshape_entry));
+      }else{
+          /* Reshape promise set up on input by predecessor is the predecesssor task repo */
+          consumed_flow_index = 0;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      this_task->data._f_A.data_out = parsec_data_get_copy(chunk->original, target_device);
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+      parsec_prof_grapher_data_input(chunk->original, (parsec_task_t*)this_task, &flow_of_multichain_VERTICAL_for_A, 0);
+#endif
+    }
+    }
+    this_task->data._f_A.data_in     = chunk;
+    this_task->data._f_A.source_repo       = consumed_repo;
+    this_task->data._f_A.source_repo_entry = consumed_entry;
+    if( this_task->data._f_A.source_repo_entry == this_task->repo_entry ){
+      /* in case we have consume from this task repo entry for the flow,
+       * it is cleaned up, avoiding having old stuff during release_deps_of
+       */
+      this_task->repo_entry->data[0] = NULL;
+    }
+    this_task->data._f_A.fulfill = 1;
+}
+
+
+if(! this_task->data._f_B.fulfill ){ /* Flow B */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_B.data_out = NULL;  /* By default, if nothing matches */
+    if( (i) == (0) ) {
+    /* Flow B [1] dependency [1] from memory descB */
+    if( NULL == (chunk = this_task->data._f_B.data_in) ) {
+    /* No data set up by predecessor on this task input flow */
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+    parsec_prof_grapher_data_input(data_of_descB(i, 0), (parsec_task_t*)this_task, &flow_of_multichain_VERTICAL_for_B, 1);
+#endif
+      chunk = parsec_data_get_copy(data_of_descB(i, 0), target_device);
+      data.data = chunk;
+      data.data_future  = NULL;
+          data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      data.data_future   = NULL;
+      if( (ret = parsec_get_copy_reshape_from_desc(es, this_task->taskpool, (parsec_task_t *)this_task, 1, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      this_task->data._f_B.data_out = chunk;
+      PARSEC_OBJ_RETAIN(chunk);
+    } 
+    } else {
+    /* Flow B [1] dependency [1] from predecessor VERTICAL */
+    if( NULL == (chunk = this_task->data._f_B.data_in) ) {
+    /* No data set up by predecessor on this task input flow */
+__parsec_multichain_VERTICAL_parsec_assignment_t *target_locals = (__parsec_multichain_VERTICAL_parsec_assignment_t*)&generic_locals;
+      const int VERTICALi = target_locals->i.value = (i - 1); (void)VERTICALi;
+      const int VERTICALj = target_locals->j.value = j; (void)VERTICALj;
+      if( (reshape_entry != NULL) && (reshape_entry->data[1] != NULL) ){
+          /* Reshape promise set up on this task repo by predecessor */
+          consumed_repo = reshape_repo;
+          consumed_entry = reshape_entry;
+          consumed_entry_key = reshape_entry_key;
+          consumed_flow_index = 1;
+      }else{
+          /* Consume from predecessor's repo */
+          consumed_repo = VERTICAL_repo;
+          consumed_entry_key = __jdf2c_make_key_VERTICAL((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)target_locals) ;
+          consumed_entry = data_repo_lookup_entry( consumed_repo, consumed_entry_key );
+          consumed_flow_index = 1;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 1, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      ACQUIRE_FLOW(this_task, "B", &multichain_VERTICAL, "B", target_locals, chunk);
+      this_task->data._f_B.data_out = chunk;
+    } 
+    else {
+      /* Data set up by predecessor on this task input flow */
+      consumed_repo = this_task->data._f_B.source_repo;
+      consumed_entry = this_task->data._f_B.source_repo_entry;
+      consumed_entry_key = this_task->data._f_B.source_repo_entry->ht_item.key;
+      if( (reshape_entry != NULL) && (reshape_entry->data[1] != NULL) ){
+          /* Reshape promise set up on input by predecessor is on this task repo */
+          consumed_flow_index = 1;
+          assert( (this_task->data._f_B.source_repo == reshape_repo)
+               && (this_task->data._f_B.source_repo_entry == reshape_entry));
+      }else{
+          /* Reshape promise set up on input by predecessor is the predecesssor task repo */
+          consumed_flow_index = 1;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 1, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      this_task->data._f_B.data_out = parsec_data_get_copy(chunk->original, target_device);
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+      parsec_prof_grapher_data_input(chunk->original, (parsec_task_t*)this_task, &flow_of_multichain_VERTICAL_for_B, 0);
+#endif
+    }
+    }
+    this_task->data._f_B.data_in     = chunk;
+    this_task->data._f_B.source_repo       = consumed_repo;
+    this_task->data._f_B.source_repo_entry = consumed_entry;
+    if( this_task->data._f_B.source_repo_entry == this_task->repo_entry ){
+      /* in case we have consume from this task repo entry for the flow,
+       * it is cleaned up, avoiding having old stuff during release_deps_of
+       */
+      this_task->repo_entry->data[1] = NULL;
+    }
+    this_task->data._f_B.fulfill = 1;
+}
+
+  /** Generate profiling information */
+#if defined(PARSEC_PROF_TRACE)
+  this_task->prof_info.desc = (parsec_data_collection_t*)__parsec_tp->super._g_descA;
+  this_task->prof_info.priority = this_task->priority;
+  this_task->prof_info.data_id   = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->data_key((parsec_data_collection_t*)__parsec_tp->super._g_descA, i, 0);
+  this_task->prof_info.task_class_id = this_task->task_class->task_class_id;
+  this_task->prof_info.task_return_code = -1;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int datatype_lookup_of_multichain_VERTICAL(parsec_execution_stream_t *es, const parsec_task_t *this_generic_task, const parsec_task_t *parent_task,
+              uint32_t* flow_mask, parsec_dep_data_description_t* data)
+{
+  const __parsec_multichain_VERTICAL_task_t *this_task = (__parsec_multichain_VERTICAL_task_t*)this_generic_task;
+  const __parsec_multichain_internal_taskpool_t *__parsec_tp = (__parsec_multichain_internal_taskpool_t *)this_task->taskpool;
+  (void)__parsec_tp; (void)es; (void)this_task; (void)data; (void)parent_task;
+  const int i = this_task->locals.i.value; (void)i;
+  const int j = this_task->locals.j.value; (void)j;
+  data->local.arena = data->remote.arena = NULL;
+  data->local.src_datatype  = data->local.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->local.src_count     = data->local.dst_count = 0;
+  data->local.src_displ     = data->local.dst_displ = 0;
+  data->data_future  = NULL;
+  if( (*flow_mask) & 0x80000000U ) { /* these are the input dependencies remote datatypes  */
+if( (*flow_mask) & 0x1U ) {  /* Flow A */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_multichain_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_multichain_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_multichain_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+if( (*flow_mask) & 0x2U ) {  /* Flow B */
+    if( ((*flow_mask) & 0x2U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_multichain_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_multichain_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_multichain_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x2U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x2U) */
+    goto no_mask_match;
+  }
+
+  /* these are the output dependencies remote datatypes */
+if( (*flow_mask) & 0x1U ) {  /* Flow A */
+    if( ((*flow_mask) & 0x1U)
+ && ((j) != ((NJ - 1))) ) {
+    data->remote.arena  =  PARSEC_multichain_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_multichain_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_multichain_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+if( (*flow_mask) & 0x2U ) {  /* Flow B */
+    if( ((*flow_mask) & 0x2U) ) {
+    data->remote.arena  =  PARSEC_multichain_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_multichain_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_multichain_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x2U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x2U) */
+ no_mask_match:
+  data->data                             = NULL;
+  data->remote.src_datatype = data->remote.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->remote.src_count    = data->remote.dst_count = 0;
+  data->remote.src_displ    = data->remote.dst_displ = 0;
+  data->data_future  = NULL;
+  (*flow_mask) = 0;  /* nothing left */
+  (void)i;  (void)j;
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+static int hook_of_multichain_VERTICAL(parsec_execution_stream_t *es, __parsec_multichain_VERTICAL_task_t *this_task)
+{
+  __parsec_multichain_internal_taskpool_t *__parsec_tp = (__parsec_multichain_internal_taskpool_t *)this_task->taskpool;
+  (void)es; (void)__parsec_tp;
+  const int i = this_task->locals.i.value; (void)i;
+  const int j = this_task->locals.j.value; (void)j;
+  (void)i;  (void)j;
+
+  /** Declare the variables that will hold the data, and all the accounting for each */
+  parsec_data_copy_t *_f_A = this_task->data._f_A.data_in;
+  void *A = PARSEC_DATA_COPY_GET_PTR(_f_A); (void)A;
+  parsec_data_copy_t *_f_B = this_task->data._f_B.data_in;
+  void *B = PARSEC_DATA_COPY_GET_PTR(_f_B); (void)B;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    data_repo_entry_t *eA = this_task->data._f_A.source_repo_entry;
+    if( (NULL != eA) && (eA->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eA->sim_exec_date;
+    data_repo_entry_t *eB = this_task->data._f_B.source_repo_entry;
+    if( (NULL != eB) && (eB->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eB->sim_exec_date;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+    if ( NULL != _f_B ) {
+#if defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) || defined(PARSEC_HAVE_DEV_HIP_SUPPORT)
+      parsec_data_transfer_ownership_to_copy( _f_B->original, 0 /* device */,
+                                           PARSEC_FLOW_ACCESS_RW);
+#endif  /* defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) || defined(PARSEC_HAVE_DEV_HIP_SUPPORT) */
+      _f_B->version++;  /* B */
+#if defined(PARSEC_DEBUG_NOISIER)
+      char tmp[128];
+      PARSEC_DEBUG_VERBOSE(10, parsec_debug_output,
+                           "Body of %s: change Data copy %p to version %d",
+                           parsec_task_snprintf(tmp, 128, (parsec_task_t*)(this_task)),
+                           _f_B, _f_B->version);
+#endif /* defined(PARSEC_DEBUG_NOISIER) */
+    }
+  /** Cache Awareness Accounting */
+#if defined(PARSEC_CACHE_AWARENESS)
+  cache_buf_referenced(es->closest_cache, A);
+  cache_buf_referenced(es->closest_cache, B);
+#endif /* PARSEC_CACHE_AWARENESS */
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                                VERTICAL BODY                                  -----*/
+
+    if(verbose)
+        printf("VERTICAL(%d, %d) [left-over tasks %d]\n", i, j, tp->super.nb_tasks);
+
+/*-----                              END OF VERTICAL BODY                              -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#endif  /*  defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+static int complete_hook_of_multichain_VERTICAL(parsec_execution_stream_t *es, __parsec_multichain_VERTICAL_task_t *this_task)
+{
+  const __parsec_multichain_internal_taskpool_t *__parsec_tp = (__parsec_multichain_internal_taskpool_t *)this_task->taskpool;
+#if defined(DISTRIBUTED)
+    const int i = this_task->locals.i.value; (void)i;
+  const int j = this_task->locals.j.value; (void)j;
+#endif  /* defined(DISTRIBUTED) */
+  (void)es; (void)__parsec_tp;
+parsec_data_t* data_t_desc = NULL; (void)data_t_desc;
+#if defined(DISTRIBUTED)
+  /** If not working on distributed, there is no risk that data is not in place */
+  if( !((i) != ((NI - 1))) ) {
+    data_t_desc = data_of_descB(i, 0);
+    if( (NULL != this_task->data._f_B.data_out) && (this_task->data._f_B.data_out->original != data_t_desc) ) {
+      /* Writting back using remote_type */;
+      parsec_dep_data_description_t data;
+      data.data         = this_task->data._f_B.data_out;
+      data.local.arena        = NULL;
+      data.local.src_datatype = data.data->dtt;
+      data.local.src_count    = 1;
+      data.local.src_displ    = 0;
+      data.local.dst_datatype = parsec_data_get_copy(data_t_desc, 0)->dtt;
+      data.local.dst_count    = 1;
+      data.local.dst_displ    = 0;
+      data.data_future  = NULL;
+      assert( data.local.src_count > 0 );
+      parsec_remote_dep_memcpy(es,
+                              this_task->taskpool,
+                              parsec_data_get_copy(data_of_descB(i, 0), 0),
+                              this_task->data._f_B.data_out, &data);
+    }
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+    parsec_prof_grapher_data_output((parsec_task_t*)this_task, data_of_descB(i, 0), &flow_of_multichain_VERTICAL_for_B);
+#endif
+  }
+  (void)i;  (void)j;
+
+#endif /* DISTRIBUTED */
+#if defined(PARSEC_PROF_GRAPHER)
+  parsec_prof_grapher_task((parsec_task_t*)this_task, es->th_id, es->virtual_process->vp_id,
+     __jdf2c_key_fns_VERTICAL.key_hash(this_task->task_class->make_key( (parsec_taskpool_t*)this_task->taskpool, ((parsec_task_t*)this_task)->locals), NULL));
+#endif  /* defined(PARSEC_PROF_GRAPHER) */
+  release_deps_of_multichain_VERTICAL(es, this_task,
+      PARSEC_ACTION_RELEASE_REMOTE_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_REFS |
+      PARSEC_ACTION_RESHAPE_ON_RELEASE |
+      0x3,  /* mask of all dep_index */ 
+      NULL);
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static parsec_hook_return_t release_task_of_multichain_VERTICAL(parsec_execution_stream_t *es, parsec_task_t *this_task)
+{
+    const __parsec_multichain_internal_taskpool_t *__parsec_tp =
+        (const __parsec_multichain_internal_taskpool_t *)this_task->taskpool;
+    parsec_hash_table_t *ht = (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[1];
+    parsec_key_t key = this_task->task_class->make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals);
+    parsec_hashable_dependency_t *hash_dep = (parsec_hashable_dependency_t *)parsec_hash_table_remove(ht, key);
+    parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);
+    return parsec_release_task_to_mempool_update_nbtasks(es, this_task);
+}
+
+static char *multichain_multichain_VERTICAL_internal_init_deps_key_functions_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_multichain_internal_taskpool_t *__parsec_tp = (__parsec_multichain_internal_taskpool_t *)user_data;
+  int i = (__parsec_key) % __parsec_tp->VERTICAL_i_range + __parsec_tp->VERTICAL_i_min;
+  __parsec_key = __parsec_key / __parsec_tp->VERTICAL_i_range;
+  int j = (__parsec_key) % __parsec_tp->VERTICAL_j_range + __parsec_tp->VERTICAL_j_min;
+  __parsec_key = __parsec_key / __parsec_tp->VERTICAL_j_range;
+  snprintf(buffer, buffer_size, "VERTICAL(%d, %d)", i, j);
+  return buffer;
+}
+
+static parsec_key_fn_t multichain_multichain_VERTICAL_internal_init_deps_key_functions = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = multichain_multichain_VERTICAL_internal_init_deps_key_functions_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/* Needs: min-max count-tasks iterate */
+static int multichain_VERTICAL_internal_init(parsec_execution_stream_t * es, __parsec_multichain_VERTICAL_task_t * this_task)
+{
+  __parsec_multichain_internal_taskpool_t *__parsec_tp = (__parsec_multichain_internal_taskpool_t*)this_task->taskpool;
+  int32_t nb_tasks = 0, saved_nb_tasks = 0;
+int32_t __i_min = 0x7fffffff, __i_max = 0;int32_t __jdf2c_i_min = 0x7fffffff, __jdf2c_i_max = 0;int32_t __j_min = 0x7fffffff, __j_max = 0;int32_t __jdf2c_j_min = 0x7fffffff, __jdf2c_j_max = 0;  __parsec_multichain_VERTICAL_parsec_assignment_t assignments = {  .i.value = 0, .j.value = 0 };
+  int32_t  i,  j;
+  int32_t __jdf2c_i_start, __jdf2c_i_end, __jdf2c_i_inc;
+  int32_t __jdf2c_j_start, __jdf2c_j_end, __jdf2c_j_inc;
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+  PARSEC_PROFILING_TRACE(es->es_profile,
+                         this_task->taskpool->profiling_array[START_KEY(this_task->task_class->task_class_id)],
+                         0,
+                         this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    __jdf2c_i_start = 0;
+    __jdf2c_i_end = (NI - 1);
+    __jdf2c_i_inc = 1;
+    __i_min = parsec_imin(__jdf2c_i_start, __jdf2c_i_end);
+    __i_max = parsec_imax(__jdf2c_i_start, __jdf2c_i_end);
+    __jdf2c_i_min = parsec_imin(__jdf2c_i_min, __i_min);
+    __jdf2c_i_max = parsec_imax(__jdf2c_i_max, __i_max);
+    for(i =  __jdf2c_i_start;
+        i <= __jdf2c_i_end;
+        i += __jdf2c_i_inc) {
+    assignments.i.value = i;
+      __jdf2c_j_start = 0;
+      __jdf2c_j_end = (NJ - 1);
+      __jdf2c_j_inc = 1;
+      __j_min = parsec_imin(__jdf2c_j_start, __jdf2c_j_end);
+      __j_max = parsec_imax(__jdf2c_j_start, __jdf2c_j_end);
+      __jdf2c_j_min = parsec_imin(__jdf2c_j_min, __j_min);
+      __jdf2c_j_max = parsec_imax(__jdf2c_j_max, __j_max);
+      for(j =  __jdf2c_j_start;
+          j <= __jdf2c_j_end;
+          j += __jdf2c_j_inc) {
+      assignments.j.value = j;
+      if( !VERTICAL_pred(i, j) ) continue;
+      nb_tasks++;
+    } /* Loop on normal range j */
+  } /* For loop of i */ 
+   if( 0 != nb_tasks ) {
+     (void)parsec_atomic_fetch_add_int32(&__parsec_tp->initial_number_tasks, nb_tasks);
+   }
+  /* Set the range variables for the collision-free hash-computation */
+  __parsec_tp->VERTICAL_i_min   = __jdf2c_i_min;
+  __parsec_tp->VERTICAL_i_range = (__jdf2c_i_max - __jdf2c_i_min) + 1;
+  __parsec_tp->VERTICAL_j_min   = __jdf2c_j_min;
+  __parsec_tp->VERTICAL_j_range = (__jdf2c_j_max - __jdf2c_j_min) + 1;
+  this_task->status = PARSEC_TASK_STATUS_COMPLETE;
+
+  PARSEC_AYU_REGISTER_TASK(&multichain_VERTICAL);
+  __parsec_tp->super.super.dependencies_array[1] = PARSEC_OBJ_NEW(parsec_hash_table_t);
+  parsec_hash_table_init(__parsec_tp->super.super.dependencies_array[1], offsetof(parsec_hashable_dependency_t, ht_item), 10, multichain_multichain_VERTICAL_internal_init_deps_key_functions, this_task->taskpool);
+  __parsec_tp->repositories[1] = data_repo_create_nothreadsafe(nb_tasks, __jdf2c_key_fns_VERTICAL, (parsec_taskpool_t*)__parsec_tp, 2);
+(void)saved_nb_tasks;
+(void)__i_min; (void)__i_max;(void)__j_min; (void)__j_max;  (void)__jdf2c_i_start; (void)__jdf2c_i_end; (void)__jdf2c_i_inc;  (void)__jdf2c_j_start; (void)__jdf2c_j_end; (void)__jdf2c_j_inc;  (void)assignments; (void)__parsec_tp; (void)es;
+  if(1 == parsec_atomic_fetch_dec_int32(&__parsec_tp->sync_point)) {
+    /* Last initialization task complete. Update the number of tasks. */
+    __parsec_tp->super.super.tdm.module->taskpool_addto_nb_tasks(&__parsec_tp->super.super, __parsec_tp->initial_number_tasks);
+    parsec_mfence();  /* write memory barrier to guarantee that the scheduler gets the correct number of tasks */
+    parsec_taskpool_enable((parsec_taskpool_t*)__parsec_tp, &__parsec_tp->startup_queue,
+                           (parsec_task_t*)this_task, es, __parsec_tp->super.super.nb_pending_actions);
+    __parsec_tp->super.super.tdm.module->taskpool_ready(&__parsec_tp->super.super);
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+    PARSEC_PROFILING_TRACE(es->es_profile,
+                           this_task->taskpool->profiling_array[2 * this_task->task_class->task_class_id + 1],
+                           0,
+                           this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    return PARSEC_HOOK_RETURN_DONE;
+  }
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static const __parsec_chore_t __multichain_VERTICAL_chores[] ={
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+    { .type     = PARSEC_DEV_CPU,
+      .evaluate = (parsec_evaluate_function_t*)NULL,
+      .hook     = (parsec_hook_t*)hook_of_multichain_VERTICAL },
+#endif  /* defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+    { .type     = PARSEC_DEV_NONE,
+      .evaluate = NULL,
+      .hook     = (parsec_hook_t*)NULL },  /* End marker */
+};
+
+static const parsec_task_class_t multichain_VERTICAL = {
+  .name = "VERTICAL",
+  .task_class_id = 1,
+  .nb_flows = 2,
+  .nb_parameters = 2,
+  .nb_locals = 2,
+  .task_class_type = PARSEC_TASK_CLASS_TYPE_PTG,
+  .params = { &symb_multichain_VERTICAL_i, &symb_multichain_VERTICAL_j, NULL },
+  .locals = { &symb_multichain_VERTICAL_i, &symb_multichain_VERTICAL_j, NULL },
+  .data_affinity = (parsec_data_ref_fn_t*)affinity_of_multichain_VERTICAL,
+  .initial_data = (parsec_data_ref_fn_t*)affinity_of_multichain_VERTICAL,
+  .final_data = (parsec_data_ref_fn_t*)affinity_of_multichain_VERTICAL,
+  .priority = NULL,
+  .properties = properties_of_multichain_VERTICAL,
+#if MAX_PARAM_COUNT < 2  /* number of read flows of VERTICAL */
+  #error Too many read flows for task VERTICAL
+#endif  /* MAX_PARAM_COUNT */
+#if MAX_PARAM_COUNT < 1  /* number of write flows of VERTICAL */
+  #error Too many write flows for task VERTICAL
+#endif  /* MAX_PARAM_COUNT */
+  .in = { &flow_of_multichain_VERTICAL_for_A, &flow_of_multichain_VERTICAL_for_B, NULL },
+  .out = { &flow_of_multichain_VERTICAL_for_A, &flow_of_multichain_VERTICAL_for_B, NULL },
+  .flags = 0x0 | PARSEC_HAS_IN_IN_DEPENDENCIES | PARSEC_USE_DEPS_MASK,
+  .dependencies_goal = 0x3,
+  .make_key = __jdf2c_make_key_VERTICAL,
+  .task_snprintf = parsec_task_snprintf,
+#if defined(PARSEC_PROF_TRACE)
+  .profile_info = &parsec_task_profile_info,
+#endif
+  .key_functions = &__jdf2c_key_fns_VERTICAL,
+  .fini = (parsec_hook_t*)NULL,
+  .incarnations = __multichain_VERTICAL_chores,
+  .find_deps = parsec_hash_find_deps,
+  .update_deps = parsec_update_deps_with_mask,
+  .iterate_successors = (parsec_traverse_function_t*)iterate_successors_of_multichain_VERTICAL,
+  .iterate_predecessors = (parsec_traverse_function_t*)iterate_predecessors_of_multichain_VERTICAL,
+  .release_deps = (parsec_release_deps_t*)release_deps_of_multichain_VERTICAL,
+  .prepare_output = (parsec_hook_t*)NULL,
+  .prepare_input = (parsec_hook_t*)data_lookup_of_multichain_VERTICAL,
+  .time_estimate = NULL,
+  .get_datatype = datatype_lookup_of_multichain_VERTICAL,
+  .complete_execution = (parsec_hook_t*)complete_hook_of_multichain_VERTICAL,
+  .release_task = &release_task_of_multichain_VERTICAL,
+#if defined(PARSEC_SIM)
+  .sim_cost_fct = (parsec_sim_cost_fct_t*)NULL,
+#endif
+};
+
+
+/******                                  HORIZONTAL                                  ******/
+
+static inline int32_t minexpr_of_symb_multichain_HORIZONTAL_i_fct(const __parsec_multichain_internal_taskpool_t *__parsec_tp, const __parsec_multichain_HORIZONTAL_parsec_assignment_t *locals)
+{
+  (void)__parsec_tp; (void)locals;
+  return 0;
+}
+static const parsec_expr_t minexpr_of_symb_multichain_HORIZONTAL_i = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32,
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)minexpr_of_symb_multichain_HORIZONTAL_i_fct }
+                   }
+};
+static inline int maxexpr_of_symb_multichain_HORIZONTAL_i_fct(const __parsec_multichain_internal_taskpool_t *__parsec_tp, const __parsec_multichain_HORIZONTAL_parsec_assignment_t *locals)
+{
+  const int i = locals->i.value; (void)i;
+
+  (void)i;
+  (void)__parsec_tp; (void)locals;
+  return (NI - 1);
+}
+static const parsec_expr_t maxexpr_of_symb_multichain_HORIZONTAL_i = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)maxexpr_of_symb_multichain_HORIZONTAL_i_fct }
+                   }
+};
+static const parsec_symbol_t symb_multichain_HORIZONTAL_i = { .name = "i", .context_index = 0, .min = &minexpr_of_symb_multichain_HORIZONTAL_i, .max = &maxexpr_of_symb_multichain_HORIZONTAL_i, .cst_inc = 1, .expr_inc = NULL,  .flags = PARSEC_SYMBOL_IS_STANDALONE};
+
+static inline int affinity_of_multichain_HORIZONTAL(const __parsec_multichain_HORIZONTAL_task_t *this_task,
+                     parsec_data_ref_t *ref)
+{
+    const __parsec_multichain_internal_taskpool_t *__parsec_tp = (const __parsec_multichain_internal_taskpool_t*)this_task->taskpool;
+  const int i = this_task->locals.i.value; (void)i;
+
+  /* Silent Warnings: should look into predicate to know what variables are usefull */
+  (void)i;
+  ref->dc = (parsec_data_collection_t *)__parsec_tp->super._g_descA;
+  /* Compute data key */
+  ref->key = ref->dc->data_key(ref->dc, i, 0);
+  return 1;
+}
+static const parsec_property_t properties_of_multichain_HORIZONTAL[1] = {
+  {.name = NULL, .expr = NULL}
+};
+static parsec_data_t *flow_of_multichain_HORIZONTAL_for_A_dep1_atline_44_direct_access(const __parsec_multichain_internal_taskpool_t *__parsec_tp, const __parsec_multichain_HORIZONTAL_parsec_assignment_t *assignments)
+{
+  const int i = assignments->i.value; (void)i;
+
+  /* Silence Warnings: should look into parameters to know what variables are useful */
+  (void)i;
+  if( __parsec_tp->super.super.context->my_rank == (int32_t)rank_of_descA(i, 0) )
+    return data_of_descA(i, 0);
+  return NULL;
+}
+
+static const parsec_dep_t flow_of_multichain_HORIZONTAL_for_A_dep1_atline_44 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = PARSEC_LOCAL_DATA_TASK_CLASS_ID, /* multichain_descA */
+  .direct_data = (parsec_data_lookup_func_t)&flow_of_multichain_HORIZONTAL_for_A_dep1_atline_44_direct_access,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_multichain_HORIZONTAL_for_A,
+};
+static const parsec_dep_t flow_of_multichain_HORIZONTAL_for_A_dep2_atline_45 = {
+  .cond = NULL,  /*  */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 1, /* multichain_VERTICAL */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_multichain_VERTICAL_for_A,
+  .dep_index = 0,
+  .dep_datatype_index = 0,
+  .belongs_to = &flow_of_multichain_HORIZONTAL_for_A,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+#if MAX_DEP_OUT_COUNT < 1  /* number of output dependencies */
+    #error Too many output dependencies (supports up to MAX_DEP_OUT_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_OUT_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_multichain_HORIZONTAL_for_A = {
+  .name               = "A",
+  .sym_type           = PARSEC_SYM_INOUT,
+  .flow_flags         = PARSEC_FLOW_ACCESS_READ|PARSEC_FLOW_HAS_IN_DEPS,
+  .flow_index         = 0,
+  .flow_datatype_mask = 0x1,
+  .dep_in     = { &flow_of_multichain_HORIZONTAL_for_A_dep1_atline_44 },
+  .dep_out    = { &flow_of_multichain_HORIZONTAL_for_A_dep2_atline_45 }
+};
+
+static inline int expr_of_cond_for_flow_of_multichain_HORIZONTAL_for_B_dep1_atline_46_iftrue_fct(const __parsec_multichain_internal_taskpool_t *__parsec_tp, const __parsec_multichain_HORIZONTAL_parsec_assignment_t *locals)
+{
+  const int i = locals->i.value;
+
+  (void)i;
+  (void)__parsec_tp; (void)locals;
+  return (i) == (0);
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_multichain_HORIZONTAL_for_B_dep1_atline_46_iftrue = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_multichain_HORIZONTAL_for_B_dep1_atline_46_iftrue_fct }
+                   }
+};
+static parsec_data_t *flow_of_multichain_HORIZONTAL_for_B_dep1_atline_46_direct_access(const __parsec_multichain_internal_taskpool_t *__parsec_tp, const __parsec_multichain_HORIZONTAL_parsec_assignment_t *assignments)
+{
+  const int i = assignments->i.value; (void)i;
+
+  /* Silence Warnings: should look into parameters to know what variables are useful */
+  (void)i;
+  if( __parsec_tp->super.super.context->my_rank == (int32_t)rank_of_descB(i, 0) )
+    return data_of_descB(i, 0);
+  return NULL;
+}
+
+static const parsec_dep_t flow_of_multichain_HORIZONTAL_for_B_dep1_atline_46_iftrue = {
+  .cond = &expr_of_cond_for_flow_of_multichain_HORIZONTAL_for_B_dep1_atline_46_iftrue,  /* (i) == (0) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = PARSEC_LOCAL_DATA_TASK_CLASS_ID, /* multichain_descB */
+  .direct_data = (parsec_data_lookup_func_t)&flow_of_multichain_HORIZONTAL_for_B_dep1_atline_46_direct_access,
+  .dep_index = 1,
+  .dep_datatype_index = 1,
+  .belongs_to = &flow_of_multichain_HORIZONTAL_for_B,
+};
+static inline int expr_of_cond_for_flow_of_multichain_HORIZONTAL_for_B_dep1_atline_46_iffalse_fct(const __parsec_multichain_internal_taskpool_t *__parsec_tp, const __parsec_multichain_HORIZONTAL_parsec_assignment_t *locals)
+{
+  const int i = locals->i.value;
+
+  (void)i;
+  (void)__parsec_tp; (void)locals;
+  return !((i) == (0));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_multichain_HORIZONTAL_for_B_dep1_atline_46_iffalse = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_multichain_HORIZONTAL_for_B_dep1_atline_46_iffalse_fct }
+                   }
+};
+static const parsec_dep_t flow_of_multichain_HORIZONTAL_for_B_dep1_atline_46_iffalse = {
+  .cond = &expr_of_cond_for_flow_of_multichain_HORIZONTAL_for_B_dep1_atline_46_iffalse,  /* !(i) == (0) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 0, /* multichain_HORIZONTAL */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_multichain_HORIZONTAL_for_B,
+  .dep_index = 1,
+  .dep_datatype_index = 1,
+  .belongs_to = &flow_of_multichain_HORIZONTAL_for_B,
+};
+static inline int expr_of_cond_for_flow_of_multichain_HORIZONTAL_for_B_dep2_atline_47_fct(const __parsec_multichain_internal_taskpool_t *__parsec_tp, const __parsec_multichain_HORIZONTAL_parsec_assignment_t *locals)
+{
+  const int i = locals->i.value; (void)i;
+
+  (void)i;
+  (void)__parsec_tp; (void)locals;
+  return (i) != ((NI - 1));
+}
+static const parsec_expr_t expr_of_cond_for_flow_of_multichain_HORIZONTAL_for_B_dep2_atline_47 = {
+  .op = PARSEC_EXPR_OP_INLINE,
+  .u_expr.v_func = { .type = PARSEC_RETURN_TYPE_INT32, /* PARSEC_RETURN_TYPE_INT32 */
+                     .func = { .inline_func_int32 = (parsec_expr_op_int32_inline_func_t)expr_of_cond_for_flow_of_multichain_HORIZONTAL_for_B_dep2_atline_47_fct }
+                   }
+};
+static const parsec_dep_t flow_of_multichain_HORIZONTAL_for_B_dep2_atline_47 = {
+  .cond = &expr_of_cond_for_flow_of_multichain_HORIZONTAL_for_B_dep2_atline_47,  /* (i) != ((NI - 1)) */
+  .ctl_gather_nb = NULL,
+  .task_class_id = 0, /* multichain_HORIZONTAL */
+  .direct_data = (parsec_data_lookup_func_t)NULL,
+  .flow = &flow_of_multichain_HORIZONTAL_for_B,
+  .dep_index = 1,
+  .dep_datatype_index = 1,
+  .belongs_to = &flow_of_multichain_HORIZONTAL_for_B,
+};
+#if MAX_DEP_IN_COUNT < 1  /* number of input dependencies */
+    #error Too many input dependencies (supports up to MAX_DEP_IN_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_IN_COUNT.
+#endif
+#if MAX_DEP_OUT_COUNT < 1  /* number of output dependencies */
+    #error Too many output dependencies (supports up to MAX_DEP_OUT_COUNT [=10] but found 1). Fix the code or recompile PaRSEC with a larger MAX_DEP_OUT_COUNT.
+#endif
+
+static const parsec_flow_t flow_of_multichain_HORIZONTAL_for_B = {
+  .name               = "B",
+  .sym_type           = PARSEC_SYM_INOUT,
+  .flow_flags         = PARSEC_FLOW_ACCESS_RW|PARSEC_FLOW_HAS_IN_DEPS,
+  .flow_index         = 1,
+  .flow_datatype_mask = 0x2,
+  .dep_in     = { &flow_of_multichain_HORIZONTAL_for_B_dep1_atline_46_iftrue,
+ &flow_of_multichain_HORIZONTAL_for_B_dep1_atline_46_iffalse },
+  .dep_out    = { &flow_of_multichain_HORIZONTAL_for_B_dep2_atline_47 }
+};
+
+static void
+iterate_successors_of_multichain_HORIZONTAL(parsec_execution_stream_t *es, const __parsec_multichain_HORIZONTAL_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_multichain_internal_taskpool_t *__parsec_tp = (const __parsec_multichain_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_multichain_HORIZONTAL_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_multichain_HORIZONTAL_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int i = __jdf2c__tmp_locals.i.value; (void)i;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)i;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_descA(i, 0);
+#endif
+  if( action_mask & 0x1 ) {  /* Flow of data A [0] */
+    data.data   = this_task->data._f_A.data_out;
+    data.data_future  = NULL;
+    if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_multichain_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_multichain_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+       __parsec_multichain_VERTICAL_task_t* ncc = (__parsec_multichain_VERTICAL_task_t*)&nc;
+    nc.task_class = __parsec_tp->super.super.task_classes_array[multichain_VERTICAL.task_class_id];
+      const int VERTICAL_i = i;
+      if( (VERTICAL_i >= (0)) && (VERTICAL_i <= ((NI - 1))) ) {
+        assert(&nc.locals[0].value == &ncc->locals.i.value);
+        ncc->locals.i.value = VERTICAL_i;
+        const int VERTICAL_j = 0;
+        if( (VERTICAL_j >= (0)) && (VERTICAL_j <= ((NJ - 1))) ) {
+          assert(&nc.locals[1].value == &ncc->locals.j.value);
+          ncc->locals.j.value = VERTICAL_j;
+#if defined(DISTRIBUTED)
+          rank_dst = rank_of_descA(ncc->locals.i.value, 0);
+          if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+            vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, ncc->locals.i.value, 0);
+          nc.priority = __parsec_tp->super.super.priority;
+          successor_repo = VERTICAL_repo;
+          successor_repo_key = __jdf2c_make_key_VERTICAL((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+        RELEASE_DEP_OUTPUT(es, "A", this_task, "A", &nc, rank_src, rank_dst, &data);
+        if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_multichain_HORIZONTAL_for_A_dep2_atline_45, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+          }
+        }
+  }
+  if( action_mask & 0x2 ) {  /* Flow of data B [1] */
+    data.data   = this_task->data._f_B.data_out;
+    data.data_future  = NULL;
+    if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_multichain_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_multichain_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+       if( (i) != ((NI - 1)) ) {
+      __parsec_multichain_HORIZONTAL_task_t* ncc = (__parsec_multichain_HORIZONTAL_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[multichain_HORIZONTAL.task_class_id];
+        const int HORIZONTAL_i = (i + 1);
+        if( (HORIZONTAL_i >= (0)) && (HORIZONTAL_i <= ((NI - 1))) ) {
+          assert(&nc.locals[0].value == &ncc->locals.i.value);
+          ncc->locals.i.value = HORIZONTAL_i;
+#if defined(DISTRIBUTED)
+          rank_dst = rank_of_descA(ncc->locals.i.value, 0);
+          if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+            vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, ncc->locals.i.value, 0);
+          nc.priority = __parsec_tp->super.super.priority;
+          successor_repo = HORIZONTAL_repo;
+          successor_repo_key = __jdf2c_make_key_HORIZONTAL((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+        RELEASE_DEP_OUTPUT(es, "B", this_task, "B", &nc, rank_src, rank_dst, &data);
+        if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_multichain_HORIZONTAL_for_B_dep2_atline_47, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+          }
+    }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static void
+iterate_predecessors_of_multichain_HORIZONTAL(parsec_execution_stream_t *es, const __parsec_multichain_HORIZONTAL_task_t *this_task,
+               uint32_t action_mask, parsec_ontask_function_t *ontask, void *ontask_arg)
+{
+  const __parsec_multichain_internal_taskpool_t *__parsec_tp = (const __parsec_multichain_internal_taskpool_t*)this_task->taskpool;
+  parsec_task_t nc;  /* generic placeholder for locals */
+  parsec_dep_data_description_t data;
+  __parsec_multichain_HORIZONTAL_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_multichain_HORIZONTAL_parsec_assignment_t*)&this_task->locals;   /* copy of this_task locals in R/W mode to manage local definitions */
+  int vpid_dst = -1, rank_src = 0, rank_dst = 0;
+  const int i = __jdf2c__tmp_locals.i.value; (void)i;
+  (void)rank_src; (void)rank_dst; (void)__parsec_tp; (void)vpid_dst;
+   data_repo_t *successor_repo; parsec_key_t successor_repo_key;  (void)i;
+  PARSEC_OBJ_CONSTRUCT(&nc, parsec_task_t);
+  nc.taskpool  = this_task->taskpool;
+  nc.priority  = this_task->priority;
+  nc.chore_mask  = PARSEC_DEV_ALL;
+#if defined(DISTRIBUTED)
+  rank_src = rank_of_descA(i, 0);
+#endif
+  /* Flow of data A has only OUTPUT dependencies to Memory */
+  if( action_mask & 0x2 ) {  /* Flow of data B [1] */
+    data.data   = this_task->data._f_B.data_out;
+    data.data_future  = NULL;
+  if( action_mask & 0x2 ) {
+      if (action_mask & (PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE | PARSEC_ACTION_SEND_REMOTE_DEPS)) {
+    data.local.arena  = PARSEC_multichain_DEFAULT_ADT->arena;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.remote.arena  = PARSEC_multichain_DEFAULT_ADT->arena;
+    data.remote.src_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.dst_datatype = (data.data != NULL ? data.data->dtt : PARSEC_DATATYPE_NULL );
+    data.remote.src_count  = 1;
+    data.remote.dst_count  = 1;
+    data.remote.src_displ    = 0;
+    data.remote.dst_displ    = 0;
+  }
+        if( !((i) == (0)) ) {
+      __parsec_multichain_HORIZONTAL_task_t* ncc = (__parsec_multichain_HORIZONTAL_task_t*)&nc;
+      nc.task_class = __parsec_tp->super.super.task_classes_array[multichain_HORIZONTAL.task_class_id];
+        const int HORIZONTAL_i = (i - 1);
+        if( (HORIZONTAL_i >= (0)) && (HORIZONTAL_i <= ((NI - 1))) ) {
+          assert(&nc.locals[0].value == &ncc->locals.i.value);
+          ncc->locals.i.value = HORIZONTAL_i;
+#if defined(DISTRIBUTED)
+          rank_dst = rank_of_descA(ncc->locals.i.value, 0);
+          if( (NULL != es) && (rank_dst == es->virtual_process->parsec_context->my_rank) )
+#endif /* DISTRIBUTED */
+            vpid_dst = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, ncc->locals.i.value, 0);
+          nc.priority = __parsec_tp->super.super.priority;
+          successor_repo = HORIZONTAL_repo;
+          successor_repo_key = __jdf2c_make_key_HORIZONTAL((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&ncc->locals);
+        RELEASE_DEP_OUTPUT(es, "B", this_task, "B", &nc, rank_src, rank_dst, &data);
+        if( PARSEC_ITERATE_STOP == ontask(es, &nc, (const parsec_task_t *)this_task, &flow_of_multichain_HORIZONTAL_for_B_dep1_atline_46_iffalse, &data, rank_src, rank_dst, vpid_dst, successor_repo, successor_repo_key, ontask_arg) )
+  return;
+          }
+    }
+  }
+  }
+  (void)data;(void)nc;(void)es;(void)ontask;(void)ontask_arg;(void)rank_dst;(void)action_mask;
+}
+
+static int release_deps_of_multichain_HORIZONTAL(parsec_execution_stream_t *es, __parsec_multichain_HORIZONTAL_task_t *this_task, uint32_t action_mask, parsec_remote_deps_t *deps)
+{
+  PARSEC_PINS(es, RELEASE_DEPS_BEGIN, (parsec_task_t *)this_task);  const __parsec_multichain_internal_taskpool_t *__parsec_tp = (const __parsec_multichain_internal_taskpool_t *)this_task->taskpool;
+  parsec_release_dep_fct_arg_t arg;
+  int __vp_id;
+  int consume_local_repo = 0;
+  arg.action_mask = action_mask;
+  arg.output_entry = NULL;
+  arg.output_repo = NULL;
+#if defined(DISTRIBUTED)
+  arg.remote_deps = deps;
+#endif  /* defined(DISTRIBUTED) */
+  assert(NULL != es);
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS )    arg.ready_lists = alloca(sizeof(parsec_task_t *) * es->virtual_process->parsec_context->nb_vp);
+  else
+    arg.ready_lists = NULL;
+  for( __vp_id = 0; __vp_id < es->virtual_process->parsec_context->nb_vp; arg.ready_lists[__vp_id++] = NULL );
+  (void)__parsec_tp; (void)deps;
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_A.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_A.source_repo, this_task->data._f_A.source_repo_entry->ht_item.key );
+    }
+    if( NULL != this_task->data._f_B.source_repo_entry ) {
+        data_repo_entry_used_once( this_task->data._f_B.source_repo, this_task->data._f_B.source_repo_entry->ht_item.key );
+    }
+  }
+  consume_local_repo = (this_task->repo_entry != NULL);
+  arg.output_repo = HORIZONTAL_repo;
+  arg.output_entry = this_task->repo_entry;
+  arg.output_usage = 0;
+  if( action_mask & (PARSEC_ACTION_RELEASE_LOCAL_DEPS | PARSEC_ACTION_GET_REPO_ENTRY) ) {
+    arg.output_entry = data_repo_lookup_entry_and_create( es, arg.output_repo, __jdf2c_make_key_HORIZONTAL((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    arg.output_entry->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(arg.output_entry->sim_exec_date == 0);
+    arg.output_entry->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  if(action_mask & ( PARSEC_ACTION_RESHAPE_ON_RELEASE | PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE ) ){
+    /* Generate the reshape promise for the outputs that need it */
+    iterate_successors_of_multichain_HORIZONTAL(es, this_task, action_mask, parsec_set_up_reshape_promise, &arg);
+   }
+  iterate_successors_of_multichain_HORIZONTAL(es, this_task, action_mask, parsec_release_dep_fct, &arg);
+
+#if defined(DISTRIBUTED)
+  if( (action_mask & PARSEC_ACTION_SEND_REMOTE_DEPS) && (NULL != arg.remote_deps)) {
+    parsec_remote_dep_activate(es, (parsec_task_t *)this_task, arg.remote_deps, arg.remote_deps->outgoing_mask);
+  }
+#endif
+
+  if(action_mask & PARSEC_ACTION_RELEASE_LOCAL_DEPS) {
+    data_repo_entry_addto_usage_limit(HORIZONTAL_repo, arg.output_entry->ht_item.key, arg.output_usage);
+    __parsec_schedule_vp(es, arg.ready_lists, 0);
+  }
+      if (consume_local_repo) {
+         data_repo_entry_used_once( HORIZONTAL_repo, this_task->repo_entry->ht_item.key );
+      }
+  if( action_mask & PARSEC_ACTION_RELEASE_LOCAL_REFS ) {
+    if( NULL != this_task->data._f_A.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_A.data_in);
+    }
+    if( NULL != this_task->data._f_B.data_in ) {
+        PARSEC_DATA_COPY_RELEASE(this_task->data._f_B.data_in);
+    }
+  }
+  PARSEC_PINS(es, RELEASE_DEPS_END, (parsec_task_t *)this_task);  return 0;
+}
+
+static int data_lookup_of_multichain_HORIZONTAL(parsec_execution_stream_t *es, __parsec_multichain_HORIZONTAL_task_t *this_task)
+{
+  const __parsec_multichain_internal_taskpool_t *__parsec_tp = (__parsec_multichain_internal_taskpool_t *)this_task->taskpool;
+  parsec_assignment_t generic_locals[MAX_PARAM_COUNT];  /* generic task locals */
+  int target_device = 0; (void)target_device;
+  (void)__parsec_tp; (void)generic_locals; (void)es;
+  parsec_data_copy_t *chunk = NULL;
+  data_repo_t        *reshape_repo  = NULL, *consumed_repo  = NULL;
+  data_repo_entry_t  *reshape_entry = NULL, *consumed_entry = NULL;
+  parsec_key_t        reshape_entry_key = 0, consumed_entry_key = 0;
+  uint8_t             consumed_flow_index;
+  parsec_dep_data_description_t data;
+  int ret;
+  (void)reshape_repo; (void)reshape_entry; (void)reshape_entry_key;
+  (void)consumed_repo; (void)consumed_entry; (void)consumed_entry_key;
+  (void)consumed_flow_index;
+  (void)chunk; (void)data; (void)ret;
+  const int i = this_task->locals.i.value; (void)i;
+  if( NULL == this_task->repo_entry ){
+    this_task->repo_entry = data_repo_lookup_entry_and_create(es, HORIZONTAL_repo,                                       __jdf2c_make_key_HORIZONTAL((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals));
+    data_repo_entry_addto_usage_limit(HORIZONTAL_repo, this_task->repo_entry->ht_item.key, 1);    this_task->repo_entry ->generator = (void*)this_task;  /* for AYU */
+#if defined(PARSEC_SIM)
+    assert(this_task->repo_entry ->sim_exec_date == 0);
+    this_task->repo_entry ->sim_exec_date = this_task->sim_exec_date;
+#endif
+  }
+  /* The reshape repo is the current task repo. */  reshape_repo = HORIZONTAL_repo;
+  reshape_entry_key = __jdf2c_make_key_HORIZONTAL((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals) ;
+  reshape_entry = this_task->repo_entry;
+  /* Lookup the input data, and store them in the context if any */
+
+if(! this_task->data._f_A.fulfill ){ /* Flow A */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_A.data_out = NULL;  /* By default, if nothing matches */
+  /* Flow A [0] dependency [0] from memory descA */
+  if( NULL == (chunk = this_task->data._f_A.data_in) ) {
+  /* No data set up by predecessor on this task input flow */
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+  parsec_prof_grapher_data_input(data_of_descA(i, 0), (parsec_task_t*)this_task, &flow_of_multichain_HORIZONTAL_for_A, 1);
+#endif
+    chunk = parsec_data_get_copy(data_of_descA(i, 0), target_device);
+    data.data = chunk;
+    data.data_future  = NULL;
+        data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+    data.data_future   = NULL;
+    if( (ret = parsec_get_copy_reshape_from_desc(es, this_task->taskpool, (parsec_task_t *)this_task, 0, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+        return ret;
+    }
+    this_task->data._f_A.data_out = chunk;
+    PARSEC_OBJ_RETAIN(chunk);
+  } 
+    this_task->data._f_A.data_in     = chunk;
+    this_task->data._f_A.source_repo       = consumed_repo;
+    this_task->data._f_A.source_repo_entry = consumed_entry;
+    if( this_task->data._f_A.source_repo_entry == this_task->repo_entry ){
+      /* in case we have consume from this task repo entry for the flow,
+       * it is cleaned up, avoiding having old stuff during release_deps_of
+       */
+      this_task->repo_entry->data[0] = NULL;
+    }
+    this_task->data._f_A.fulfill = 1;
+}
+
+
+if(! this_task->data._f_B.fulfill ){ /* Flow B */
+  consumed_repo = NULL;
+  consumed_entry_key = 0;
+  consumed_entry = NULL;
+  chunk = NULL;
+
+    this_task->data._f_B.data_out = NULL;  /* By default, if nothing matches */
+    if( (i) == (0) ) {
+    /* Flow B [1] dependency [1] from memory descB */
+    if( NULL == (chunk = this_task->data._f_B.data_in) ) {
+    /* No data set up by predecessor on this task input flow */
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+    parsec_prof_grapher_data_input(data_of_descB(i, 0), (parsec_task_t*)this_task, &flow_of_multichain_HORIZONTAL_for_B, 1);
+#endif
+      chunk = parsec_data_get_copy(data_of_descB(i, 0), target_device);
+      data.data = chunk;
+      data.data_future  = NULL;
+          data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      data.data_future   = NULL;
+      if( (ret = parsec_get_copy_reshape_from_desc(es, this_task->taskpool, (parsec_task_t *)this_task, 1, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      this_task->data._f_B.data_out = chunk;
+      PARSEC_OBJ_RETAIN(chunk);
+    } 
+    } else {
+    /* Flow B [1] dependency [1] from predecessor HORIZONTAL */
+    if( NULL == (chunk = this_task->data._f_B.data_in) ) {
+    /* No data set up by predecessor on this task input flow */
+__parsec_multichain_HORIZONTAL_parsec_assignment_t *target_locals = (__parsec_multichain_HORIZONTAL_parsec_assignment_t*)&generic_locals;
+      const int HORIZONTALi = target_locals->i.value = (i - 1); (void)HORIZONTALi;
+      if( (reshape_entry != NULL) && (reshape_entry->data[1] != NULL) ){
+          /* Reshape promise set up on this task repo by predecessor */
+          consumed_repo = reshape_repo;
+          consumed_entry = reshape_entry;
+          consumed_entry_key = reshape_entry_key;
+          consumed_flow_index = 1;
+      }else{
+          /* Consume from predecessor's repo */
+          consumed_repo = HORIZONTAL_repo;
+          consumed_entry_key = __jdf2c_make_key_HORIZONTAL((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)target_locals) ;
+          consumed_entry = data_repo_lookup_entry( consumed_repo, consumed_entry_key );
+          consumed_flow_index = 1;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 1, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      ACQUIRE_FLOW(this_task, "B", &multichain_HORIZONTAL, "B", target_locals, chunk);
+      this_task->data._f_B.data_out = chunk;
+    } 
+    else {
+      /* Data set up by predecessor on this task input flow */
+      consumed_repo = this_task->data._f_B.source_repo;
+      consumed_entry = this_task->data._f_B.source_repo_entry;
+      consumed_entry_key = this_task->data._f_B.source_repo_entry->ht_item.key;
+      if( (reshape_entry != NULL) && (reshape_entry->data[1] != NULL) ){
+          /* Reshape promise set up on input by predecessor is on this task repo */
+          consumed_flow_index = 1;
+          assert( (this_task->data._f_B.source_repo == reshape_repo)
+               && (this_task->data._f_B.source_repo_entry == reshape_entry));
+      }else{
+          /* Reshape promise set up on input by predecessor is the predecesssor task repo */
+          consumed_flow_index = 1;
+      }
+      data.data   = NULL;
+      data.data_future   = (parsec_datacopy_future_t*)consumed_entry->data[consumed_flow_index];
+          data.local.arena  = NULL;
+    data.local.src_datatype = PARSEC_DATATYPE_NULL;
+    data.local.dst_datatype = PARSEC_DATATYPE_NULL;
+    data.local.src_count  = 1;
+    data.local.dst_count  = 1;
+    data.local.src_displ    = 0;
+    data.local.dst_displ    = 0;
+      if( (ret = parsec_get_copy_reshape_from_dep(es, this_task->taskpool, (parsec_task_t *)this_task, 1, reshape_repo, reshape_entry_key, &data, &chunk)) < 0){
+          return ret;
+      }
+      this_task->data._f_B.data_out = parsec_data_get_copy(chunk->original, target_device);
+#if defined(PARSEC_PROF_GRAPHER) && defined(PARSEC_PROF_TRACE)
+      parsec_prof_grapher_data_input(chunk->original, (parsec_task_t*)this_task, &flow_of_multichain_HORIZONTAL_for_B, 0);
+#endif
+    }
+    }
+    this_task->data._f_B.data_in     = chunk;
+    this_task->data._f_B.source_repo       = consumed_repo;
+    this_task->data._f_B.source_repo_entry = consumed_entry;
+    if( this_task->data._f_B.source_repo_entry == this_task->repo_entry ){
+      /* in case we have consume from this task repo entry for the flow,
+       * it is cleaned up, avoiding having old stuff during release_deps_of
+       */
+      this_task->repo_entry->data[1] = NULL;
+    }
+    this_task->data._f_B.fulfill = 1;
+}
+
+  /** Generate profiling information */
+#if defined(PARSEC_PROF_TRACE)
+  this_task->prof_info.desc = (parsec_data_collection_t*)__parsec_tp->super._g_descA;
+  this_task->prof_info.priority = this_task->priority;
+  this_task->prof_info.data_id   = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->data_key((parsec_data_collection_t*)__parsec_tp->super._g_descA, i, 0);
+  this_task->prof_info.task_class_id = this_task->task_class->task_class_id;
+  this_task->prof_info.task_return_code = -1;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static int datatype_lookup_of_multichain_HORIZONTAL(parsec_execution_stream_t *es, const parsec_task_t *this_generic_task, const parsec_task_t *parent_task,
+              uint32_t* flow_mask, parsec_dep_data_description_t* data)
+{
+  const __parsec_multichain_HORIZONTAL_task_t *this_task = (__parsec_multichain_HORIZONTAL_task_t*)this_generic_task;
+  const __parsec_multichain_internal_taskpool_t *__parsec_tp = (__parsec_multichain_internal_taskpool_t *)this_task->taskpool;
+  (void)__parsec_tp; (void)es; (void)this_task; (void)data; (void)parent_task;
+  const int i = this_task->locals.i.value; (void)i;
+  data->local.arena = data->remote.arena = NULL;
+  data->local.src_datatype  = data->local.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->local.src_count     = data->local.dst_count = 0;
+  data->local.src_displ     = data->local.dst_displ = 0;
+  data->data_future  = NULL;
+  if( (*flow_mask) & 0x80000000U ) { /* these are the input dependencies remote datatypes  */
+if( (*flow_mask) & 0x1U ) {  /* Flow A */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_multichain_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_multichain_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_multichain_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+if( (*flow_mask) & 0x2U ) {  /* Flow B */
+    if( ((*flow_mask) & 0x2U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_multichain_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_multichain_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_multichain_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x2U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x2U) */
+    goto no_mask_match;
+  }
+
+  /* these are the output dependencies remote datatypes */
+if( (*flow_mask) & 0x1U ) {  /* Flow A */
+    if( ((*flow_mask) & 0x1U) ) {  /* Have unconditional! */
+    data->remote.arena  =  PARSEC_multichain_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_multichain_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_multichain_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x1U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x1U) */
+if( (*flow_mask) & 0x2U ) {  /* Flow B */
+    if( ((*flow_mask) & 0x2U)
+ && ((i) != ((NI - 1))) ) {
+    data->remote.arena  =  PARSEC_multichain_DEFAULT_ADT->arena ;
+    data->remote.src_datatype = PARSEC_multichain_DEFAULT_ADT->opaque_dtt;
+    data->remote.dst_datatype = PARSEC_multichain_DEFAULT_ADT->opaque_dtt;
+    data->remote.src_count  = 1;
+    data->remote.dst_count  = 1;
+    data->remote.src_displ    = 0;
+    data->remote.dst_displ    = 0;
+      (*flow_mask) &= ~0x2U;
+      return PARSEC_HOOK_RETURN_NEXT;
+    }
+}  /* (flow_mask & 0x2U) */
+ no_mask_match:
+  data->data                             = NULL;
+  data->remote.src_datatype = data->remote.dst_datatype = PARSEC_DATATYPE_NULL;
+  data->remote.src_count    = data->remote.dst_count = 0;
+  data->remote.src_displ    = data->remote.dst_displ = 0;
+  data->data_future  = NULL;
+  (*flow_mask) = 0;  /* nothing left */
+  (void)i;
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+static int hook_of_multichain_HORIZONTAL(parsec_execution_stream_t *es, __parsec_multichain_HORIZONTAL_task_t *this_task)
+{
+  __parsec_multichain_internal_taskpool_t *__parsec_tp = (__parsec_multichain_internal_taskpool_t *)this_task->taskpool;
+  (void)es; (void)__parsec_tp;
+  const int i = this_task->locals.i.value; (void)i;
+  (void)i;
+
+  /** Declare the variables that will hold the data, and all the accounting for each */
+  parsec_data_copy_t *_f_A = this_task->data._f_A.data_in;
+  void *A = PARSEC_DATA_COPY_GET_PTR(_f_A); (void)A;
+  parsec_data_copy_t *_f_B = this_task->data._f_B.data_in;
+  void *B = PARSEC_DATA_COPY_GET_PTR(_f_B); (void)B;
+
+  /** Update starting simulation date */
+#if defined(PARSEC_SIM)
+  {
+    this_task->sim_exec_date = 0;
+    data_repo_entry_t *eA = this_task->data._f_A.source_repo_entry;
+    if( (NULL != eA) && (eA->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eA->sim_exec_date;
+    data_repo_entry_t *eB = this_task->data._f_B.source_repo_entry;
+    if( (NULL != eB) && (eB->sim_exec_date > this_task->sim_exec_date) )
+      this_task->sim_exec_date = eB->sim_exec_date;
+    if( this_task->task_class->sim_cost_fct != NULL ) {
+      this_task->sim_exec_date += this_task->task_class->sim_cost_fct(this_task);
+    }
+    if( es->largest_simulation_date < this_task->sim_exec_date )
+      es->largest_simulation_date = this_task->sim_exec_date;
+  }
+#endif
+    if ( NULL != _f_B ) {
+#if defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) || defined(PARSEC_HAVE_DEV_HIP_SUPPORT)
+      parsec_data_transfer_ownership_to_copy( _f_B->original, 0 /* device */,
+                                           PARSEC_FLOW_ACCESS_RW);
+#endif  /* defined(PARSEC_HAVE_DEV_CUDA_SUPPORT) || defined(PARSEC_HAVE_DEV_HIP_SUPPORT) */
+      _f_B->version++;  /* B */
+#if defined(PARSEC_DEBUG_NOISIER)
+      char tmp[128];
+      PARSEC_DEBUG_VERBOSE(10, parsec_debug_output,
+                           "Body of %s: change Data copy %p to version %d",
+                           parsec_task_snprintf(tmp, 128, (parsec_task_t*)(this_task)),
+                           _f_B, _f_B->version);
+#endif /* defined(PARSEC_DEBUG_NOISIER) */
+    }
+  /** Cache Awareness Accounting */
+#if defined(PARSEC_CACHE_AWARENESS)
+  cache_buf_referenced(es->closest_cache, A);
+  cache_buf_referenced(es->closest_cache, B);
+#endif /* PARSEC_CACHE_AWARENESS */
+
+
+#if !defined(PARSEC_PROF_DRY_BODY)
+#if defined(PARSEC_SIM)
+  if( !parsec_sim_dry_body ) {
+#endif /* defined(PARSEC_SIM) */
+
+/*-----                                HORIZONTAL BODY                                -----*/
+
+    if(verbose)
+        printf("HORIZONTAL(%d) [left-over tasks %d]\n", i, tp->super.nb_tasks);
+
+/*-----                            END OF HORIZONTAL BODY                            -----*/
+
+
+
+#if defined(PARSEC_SIM)
+  }
+#endif /* defined(PARSEC_SIM) */
+#endif /*!defined(PARSEC_PROF_DRY_BODY)*/
+
+  return PARSEC_HOOK_RETURN_DONE;
+}
+#endif  /*  defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+static int complete_hook_of_multichain_HORIZONTAL(parsec_execution_stream_t *es, __parsec_multichain_HORIZONTAL_task_t *this_task)
+{
+  const __parsec_multichain_internal_taskpool_t *__parsec_tp = (__parsec_multichain_internal_taskpool_t *)this_task->taskpool;
+#if defined(DISTRIBUTED)
+    const int i = this_task->locals.i.value; (void)i;
+#endif  /* defined(DISTRIBUTED) */
+  (void)es; (void)__parsec_tp;
+parsec_data_t* data_t_desc = NULL; (void)data_t_desc;
+#if defined(DISTRIBUTED)
+  /** If not working on distributed, there is no risk that data is not in place */
+  (void)i;
+
+#endif /* DISTRIBUTED */
+#if defined(PARSEC_PROF_GRAPHER)
+  parsec_prof_grapher_task((parsec_task_t*)this_task, es->th_id, es->virtual_process->vp_id,
+     __jdf2c_key_fns_HORIZONTAL.key_hash(this_task->task_class->make_key( (parsec_taskpool_t*)this_task->taskpool, ((parsec_task_t*)this_task)->locals), NULL));
+#endif  /* defined(PARSEC_PROF_GRAPHER) */
+  release_deps_of_multichain_HORIZONTAL(es, this_task,
+      PARSEC_ACTION_RELEASE_REMOTE_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_DEPS |
+      PARSEC_ACTION_RELEASE_LOCAL_REFS |
+      PARSEC_ACTION_RESHAPE_ON_RELEASE |
+      0x3,  /* mask of all dep_index */ 
+      NULL);
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static parsec_hook_return_t release_task_of_multichain_HORIZONTAL(parsec_execution_stream_t *es, parsec_task_t *this_task)
+{
+    const __parsec_multichain_internal_taskpool_t *__parsec_tp =
+        (const __parsec_multichain_internal_taskpool_t *)this_task->taskpool;
+    parsec_hash_table_t *ht = (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[0];
+    parsec_key_t key = this_task->task_class->make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals);
+    parsec_hashable_dependency_t *hash_dep = (parsec_hashable_dependency_t *)parsec_hash_table_remove(ht, key);
+    parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);
+    return parsec_release_task_to_mempool_update_nbtasks(es, this_task);
+}
+
+static char *multichain_multichain_HORIZONTAL_internal_init_deps_key_functions_key_print(char *buffer, size_t buffer_size, parsec_key_t __parsec_key_, void *user_data)
+{
+  uint64_t __parsec_key = (uint64_t)(uintptr_t)__parsec_key_;
+  __parsec_multichain_internal_taskpool_t *__parsec_tp = (__parsec_multichain_internal_taskpool_t *)user_data;
+  int i = (__parsec_key) % __parsec_tp->HORIZONTAL_i_range + __parsec_tp->HORIZONTAL_i_min;
+  __parsec_key = __parsec_key / __parsec_tp->HORIZONTAL_i_range;
+  snprintf(buffer, buffer_size, "HORIZONTAL(%d)", i);
+  return buffer;
+}
+
+static parsec_key_fn_t multichain_multichain_HORIZONTAL_internal_init_deps_key_functions = {
+   .key_equal = parsec_hash_table_generic_64bits_key_equal,
+   .key_print = multichain_multichain_HORIZONTAL_internal_init_deps_key_functions_key_print,
+   .key_hash  = parsec_hash_table_generic_64bits_key_hash
+};
+
+/* Needs: min-max count-tasks iterate */
+static int multichain_HORIZONTAL_internal_init(parsec_execution_stream_t * es, __parsec_multichain_HORIZONTAL_task_t * this_task)
+{
+  __parsec_multichain_internal_taskpool_t *__parsec_tp = (__parsec_multichain_internal_taskpool_t*)this_task->taskpool;
+  int32_t nb_tasks = 0, saved_nb_tasks = 0;
+int32_t __i_min = 0x7fffffff, __i_max = 0;int32_t __jdf2c_i_min = 0x7fffffff, __jdf2c_i_max = 0;  __parsec_multichain_HORIZONTAL_parsec_assignment_t assignments = {  .i.value = 0 };
+  int32_t  i;
+  int32_t __jdf2c_i_start, __jdf2c_i_end, __jdf2c_i_inc;
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+  PARSEC_PROFILING_TRACE(es->es_profile,
+                         this_task->taskpool->profiling_array[START_KEY(this_task->task_class->task_class_id)],
+                         0,
+                         this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    __jdf2c_i_start = 0;
+    __jdf2c_i_end = (NI - 1);
+    __jdf2c_i_inc = 1;
+    __i_min = parsec_imin(__jdf2c_i_start, __jdf2c_i_end);
+    __i_max = parsec_imax(__jdf2c_i_start, __jdf2c_i_end);
+    __jdf2c_i_min = parsec_imin(__jdf2c_i_min, __i_min);
+    __jdf2c_i_max = parsec_imax(__jdf2c_i_max, __i_max);
+    for(i =  __jdf2c_i_start;
+        i <= __jdf2c_i_end;
+        i += __jdf2c_i_inc) {
+    assignments.i.value = i;
+    if( !HORIZONTAL_pred(i) ) continue;
+    nb_tasks++;
+  } /* Loop on normal range i */
+   if( 0 != nb_tasks ) {
+     (void)parsec_atomic_fetch_add_int32(&__parsec_tp->initial_number_tasks, nb_tasks);
+   }
+  /* Set the range variables for the collision-free hash-computation */
+  __parsec_tp->HORIZONTAL_i_min   = __jdf2c_i_min;
+  __parsec_tp->HORIZONTAL_i_range = (__jdf2c_i_max - __jdf2c_i_min) + 1;
+    do {
+      this_task->super.list_next = (parsec_list_item_t*)__parsec_tp->startup_queue;
+    } while(!parsec_atomic_cas_ptr(&__parsec_tp->startup_queue, (parsec_list_item_t*)this_task->super.list_next, this_task));
+    this_task->status = PARSEC_TASK_STATUS_HOOK;
+
+  PARSEC_AYU_REGISTER_TASK(&multichain_HORIZONTAL);
+  __parsec_tp->super.super.dependencies_array[0] = PARSEC_OBJ_NEW(parsec_hash_table_t);
+  parsec_hash_table_init(__parsec_tp->super.super.dependencies_array[0], offsetof(parsec_hashable_dependency_t, ht_item), 10, multichain_multichain_HORIZONTAL_internal_init_deps_key_functions, this_task->taskpool);
+  __parsec_tp->repositories[0] = data_repo_create_nothreadsafe(nb_tasks, __jdf2c_key_fns_HORIZONTAL, (parsec_taskpool_t*)__parsec_tp, 2);
+(void)saved_nb_tasks;
+(void)__i_min; (void)__i_max;  (void)__jdf2c_i_start; (void)__jdf2c_i_end; (void)__jdf2c_i_inc;  (void)assignments; (void)__parsec_tp; (void)es;
+  if(1 == parsec_atomic_fetch_dec_int32(&__parsec_tp->sync_point)) {
+    /* Last initialization task complete. Update the number of tasks. */
+    __parsec_tp->super.super.tdm.module->taskpool_addto_nb_tasks(&__parsec_tp->super.super, __parsec_tp->initial_number_tasks);
+    parsec_mfence();  /* write memory barrier to guarantee that the scheduler gets the correct number of tasks */
+    parsec_taskpool_enable((parsec_taskpool_t*)__parsec_tp, &__parsec_tp->startup_queue,
+                           (parsec_task_t*)this_task, es, __parsec_tp->super.super.nb_pending_actions);
+    __parsec_tp->super.super.tdm.module->taskpool_ready(&__parsec_tp->super.super);
+#if defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+    PARSEC_PROFILING_TRACE(es->es_profile,
+                           this_task->taskpool->profiling_array[2 * this_task->task_class->task_class_id + 1],
+                           0,
+                           this_task->taskpool->taskpool_id, NULL);
+#endif /* defined(PARSEC_PROF_TRACE) && defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+    if( 1 >= __parsec_tp->super.super.nb_pending_actions ) {
+        /* if no tasks will be generated let's prevent the runtime from calling the hook and instead go directly to complete the task */
+        this_task->status = PARSEC_TASK_STATUS_COMPLETE;
+    }
+    return PARSEC_HOOK_RETURN_DONE;
+  }
+  return PARSEC_HOOK_RETURN_ASYNC;
+}
+
+static int __jdf2c_startup_HORIZONTAL(parsec_execution_stream_t * es, __parsec_multichain_HORIZONTAL_task_t *this_task)
+{
+  __parsec_multichain_HORIZONTAL_task_t* new_task;
+  __parsec_multichain_internal_taskpool_t* __parsec_tp = (__parsec_multichain_internal_taskpool_t*)this_task->taskpool;
+  parsec_context_t *context = __parsec_tp->super.super.context;
+  int vpid = 0, nb_tasks = 0;
+  size_t total_nb_tasks = 0;
+  parsec_list_item_t* pready_ring[context->nb_vp];
+  int restore_context = 0;
+  int i = this_task->locals.i.value;  /* retrieve value saved during the last iteration */
+  for(int _i = 0; _i < context->nb_vp; pready_ring[_i++] = NULL );
+  if( 0 != this_task->locals.reserved[0].value ) {
+    this_task->locals.reserved[0].value = 1; /* reset the submission process */
+    restore_context = 1;
+    goto restore_context_0;
+  }
+  this_task->locals.reserved[0].value = 1; /* a sane default value */
+  for(this_task->locals.i.value = i = 0;
+      this_task->locals.i.value <= (NI - 1);
+      this_task->locals.i.value += 1, i = this_task->locals.i.value) {
+    if( !HORIZONTAL_pred(i) ) continue;
+  __parsec_multichain_HORIZONTAL_parsec_assignment_t __jdf2c__tmp_locals = *(__parsec_multichain_HORIZONTAL_parsec_assignment_t*)&this_task->locals;
+  (void)__jdf2c__tmp_locals;
+  /* Flow for A is always a memory reference */
+  if( (i) == (0) ) goto __jdf2c_done_check_flow;
+  continue; /* All other cases are not startup tasks */
+ __jdf2c_done_check_flow:
+    if( NULL != ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of ) {
+      vpid = ((parsec_data_collection_t*)__parsec_tp->super._g_descA)->vpid_of((parsec_data_collection_t*)__parsec_tp->super._g_descA, i, 0);
+      assert(context->nb_vp >= vpid);
+    } else {
+      vpid = (vpid + 1) % context->nb_vp;  /* spread the initial joy */
+    }
+    new_task = (__parsec_multichain_HORIZONTAL_task_t*)parsec_thread_mempool_allocate( context->virtual_processes[vpid]->execution_streams[0]->context_mempool );
+    PARSEC_OBJ_CONSTRUCT(new_task, parsec_task_t); /* construct called only when new, force-construct it again */
+    /* Copy only the valid elements from this_task to new_task one */
+    new_task->taskpool   = this_task->taskpool;
+    new_task->task_class = __parsec_tp->super.super.task_classes_array[multichain_HORIZONTAL.task_class_id];
+    new_task->chore_mask   = PARSEC_DEV_ALL;
+    new_task->locals.i.value = this_task->locals.i.value;
+    PARSEC_LIST_ITEM_SINGLETON(new_task);
+    new_task->priority = __parsec_tp->super.super.priority;
+    new_task->repo_entry = NULL;
+    new_task->data._f_A.source_repo_entry = NULL;
+    new_task->data._f_A.source_repo       = NULL;
+    new_task->data._f_A.data_in         = NULL;
+    new_task->data._f_A.data_out        = NULL;
+    new_task->data._f_A.fulfill         = 0;
+    new_task->data._f_B.source_repo_entry = NULL;
+    new_task->data._f_B.source_repo       = NULL;
+    new_task->data._f_B.data_in         = NULL;
+    new_task->data._f_B.data_out        = NULL;
+    new_task->data._f_B.fulfill         = 0;
+#if defined(PARSEC_DEBUG_NOISIER)
+    {
+      char tmp[128];
+      PARSEC_DEBUG_VERBOSE(10, parsec_debug_output, "Add startup task %s to vpid %d",
+             parsec_task_snprintf(tmp, 128, (parsec_task_t*)new_task), vpid);
+    }
+#endif
+    parsec_dependencies_mark_task_as_startup((parsec_task_t*)new_task, es);
+    pready_ring[vpid] = parsec_list_item_ring_push_sorted(pready_ring[vpid],
+                                                          (parsec_list_item_t*)new_task,
+                                                          parsec_execution_context_priority_comparator);
+    nb_tasks++;
+   restore_context_0:  /* we jump here just so that we have code after the label */
+    restore_context = 0;
+    (void)restore_context;
+    if( nb_tasks > this_task->locals.reserved[0].value ) {
+      if( (size_t)this_task->locals.reserved[0].value < parsec_task_startup_iter ) this_task->locals.reserved[0].value <<= 1;
+      __parsec_schedule_vp(es, (parsec_task_t**)pready_ring, 0);
+      total_nb_tasks += nb_tasks;
+      nb_tasks = 0;
+      if( total_nb_tasks > parsec_task_startup_chunk ) {  /* stop here and request to be rescheduled */
+        return PARSEC_HOOK_RETURN_AGAIN;
+      }
+    }
+  } /* Loop on normal range i */
+  (void)vpid;
+  if( 0 != nb_tasks ) {
+    __parsec_schedule_vp(es, (parsec_task_t**)pready_ring, 0);
+    nb_tasks = 0;
+  }
+  return PARSEC_HOOK_RETURN_DONE;
+}
+
+static const __parsec_chore_t __multichain_HORIZONTAL_chores[] ={
+#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)
+    { .type     = PARSEC_DEV_CPU,
+      .evaluate = (parsec_evaluate_function_t*)NULL,
+      .hook     = (parsec_hook_t*)hook_of_multichain_HORIZONTAL },
+#endif  /* defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */
+    { .type     = PARSEC_DEV_NONE,
+      .evaluate = NULL,
+      .hook     = (parsec_hook_t*)NULL },  /* End marker */
+};
+
+static const parsec_task_class_t multichain_HORIZONTAL = {
+  .name = "HORIZONTAL",
+  .task_class_id = 0,
+  .nb_flows = 2,
+  .nb_parameters = 1,
+  .nb_locals = 1,
+  .task_class_type = PARSEC_TASK_CLASS_TYPE_PTG,
+  .params = { &symb_multichain_HORIZONTAL_i, NULL },
+  .locals = { &symb_multichain_HORIZONTAL_i, NULL },
+  .data_affinity = (parsec_data_ref_fn_t*)affinity_of_multichain_HORIZONTAL,
+  .initial_data = (parsec_data_ref_fn_t*)affinity_of_multichain_HORIZONTAL,
+  .final_data = (parsec_data_ref_fn_t*)affinity_of_multichain_HORIZONTAL,
+  .priority = NULL,
+  .properties = properties_of_multichain_HORIZONTAL,
+#if MAX_PARAM_COUNT < 2  /* number of read flows of HORIZONTAL */
+  #error Too many read flows for task HORIZONTAL
+#endif  /* MAX_PARAM_COUNT */
+#if MAX_PARAM_COUNT < 1  /* number of write flows of HORIZONTAL */
+  #error Too many write flows for task HORIZONTAL
+#endif  /* MAX_PARAM_COUNT */
+  .in = { &flow_of_multichain_HORIZONTAL_for_A, &flow_of_multichain_HORIZONTAL_for_B, NULL },
+  .out = { &flow_of_multichain_HORIZONTAL_for_A, &flow_of_multichain_HORIZONTAL_for_B, NULL },
+  .flags = 0x0 | PARSEC_HAS_IN_IN_DEPENDENCIES | PARSEC_USE_DEPS_MASK,
+  .dependencies_goal = 0x3,
+  .make_key = __jdf2c_make_key_HORIZONTAL,
+  .task_snprintf = parsec_task_snprintf,
+#if defined(PARSEC_PROF_TRACE)
+  .profile_info = &parsec_task_profile_info,
+#endif
+  .key_functions = &__jdf2c_key_fns_HORIZONTAL,
+  .fini = (parsec_hook_t*)NULL,
+  .incarnations = __multichain_HORIZONTAL_chores,
+  .find_deps = parsec_hash_find_deps,
+  .update_deps = parsec_update_deps_with_mask,
+  .iterate_successors = (parsec_traverse_function_t*)iterate_successors_of_multichain_HORIZONTAL,
+  .iterate_predecessors = (parsec_traverse_function_t*)iterate_predecessors_of_multichain_HORIZONTAL,
+  .release_deps = (parsec_release_deps_t*)release_deps_of_multichain_HORIZONTAL,
+  .prepare_output = (parsec_hook_t*)NULL,
+  .prepare_input = (parsec_hook_t*)data_lookup_of_multichain_HORIZONTAL,
+  .time_estimate = NULL,
+  .get_datatype = datatype_lookup_of_multichain_HORIZONTAL,
+  .complete_execution = (parsec_hook_t*)complete_hook_of_multichain_HORIZONTAL,
+  .release_task = &release_task_of_multichain_HORIZONTAL,
+#if defined(PARSEC_SIM)
+  .sim_cost_fct = (parsec_sim_cost_fct_t*)NULL,
+#endif
+};
+
+
+static const parsec_task_class_t *multichain_task_classes[] = {
+  &multichain_HORIZONTAL,
+  &multichain_VERTICAL
+};
+
+static void multichain_startup(parsec_context_t *context, __parsec_multichain_internal_taskpool_t *__parsec_tp, parsec_list_item_t ** ready_tasks)
+{
+  uint32_t i, supported_dev = 0;
+ 
+  for( i = 0; i < parsec_nb_devices; i++ ) {
+    if( !(__parsec_tp->super.super.devices_index_mask & (1<<i)) ) continue;
+    parsec_device_module_t* device = parsec_mca_device_get(i);
+    parsec_data_collection_t* parsec_dc;
+ 
+    if(NULL == device) continue;
+    if(NULL != device->taskpool_register)
+      if( PARSEC_SUCCESS != device->taskpool_register(device, (parsec_taskpool_t*)__parsec_tp) ) {
+        parsec_debug_verbose(5, parsec_debug_output, "Device %s refused to register taskpool %p", device->name, __parsec_tp);
+        __parsec_tp->super.super.devices_index_mask &= ~(1 << device->device_index);
+        continue;
+      }
+    if(NULL != device->memory_register) {  /* Register all the data */
+      parsec_dc = (parsec_data_collection_t*)__parsec_tp->super._g_descA;
+      if( (NULL != parsec_dc->register_memory) &&
+          (PARSEC_SUCCESS != parsec_dc->register_memory(parsec_dc, device)) ) {
+        parsec_debug_verbose(3, parsec_debug_output, "Device %s refused to register memory for data %s (%p) from taskpool %p",
+                     device->name, parsec_dc->key_base, parsec_dc, __parsec_tp);
+        __parsec_tp->super.super.devices_index_mask &= ~(1 << device->device_index);
+      }
+      parsec_dc = (parsec_data_collection_t*)__parsec_tp->super._g_descB;
+      if( (NULL != parsec_dc->register_memory) &&
+          (PARSEC_SUCCESS != parsec_dc->register_memory(parsec_dc, device)) ) {
+        parsec_debug_verbose(3, parsec_debug_output, "Device %s refused to register memory for data %s (%p) from taskpool %p",
+                     device->name, parsec_dc->key_base, parsec_dc, __parsec_tp);
+        __parsec_tp->super.super.devices_index_mask &= ~(1 << device->device_index);
+      }
+    }
+    supported_dev |= device->type;
+  }
+  /* Remove all the chores without a backend device */
+  for( i = 0; i < PARSEC_multichain_NB_TASK_CLASSES; i++ ) {
+    parsec_task_class_t* tc = (parsec_task_class_t*)__parsec_tp->super.super.task_classes_array[i];
+    __parsec_chore_t* chores = (__parsec_chore_t*)tc->incarnations;
+    uint32_t idx = 0, j;
+    for( j = 0; PARSEC_DEV_NONE != chores[j].type; j++ ) {
+      if( !(supported_dev & chores[j].type) ) continue;
+      if( j != idx ) {
+        chores[idx] = chores[j];
+        parsec_debug_verbose(20, parsec_debug_output, "Device type %i disabled for function %s"
+, chores[j].type, tc->name);
+      }
+      idx++;
+    }
+    chores[idx].type     = PARSEC_DEV_NONE;
+    chores[idx].evaluate = NULL;
+    chores[idx].hook     = NULL;
+    /* Create the initialization tasks for each taskclass */
+    parsec_task_t* task = (parsec_task_t*)parsec_thread_mempool_allocate(context->virtual_processes[0]->execution_streams[0]->context_mempool);
+    PARSEC_OBJ_CONSTRUCT(task, parsec_task_t); /* construct called only when new, force-construct it again */
+    task->taskpool = (parsec_taskpool_t *)__parsec_tp;
+    task->chore_mask = PARSEC_DEV_CPU;
+    memset(&task->locals, 0, sizeof(parsec_assignment_t) * MAX_LOCAL_COUNT);
+    PARSEC_LIST_ITEM_SINGLETON(task);
+    task->priority = -1;
+    task->task_class = task->taskpool->task_classes_array[PARSEC_multichain_NB_TASK_CLASSES + i];
+    int where = i % context->nb_vp;
+    if( NULL == ready_tasks[where] ) ready_tasks[where] = &task->super;
+    else ready_tasks[where] = parsec_list_item_ring_push(ready_tasks[where], &task->super);
+  }
+}
+static void __parsec_multichain_internal_destructor( __parsec_multichain_internal_taskpool_t *__parsec_tp )
+{
+  uint32_t i;
+  parsec_taskpool_unregister( &__parsec_tp->super.super );
+  if(NULL != __parsec_tp->super.super.tdm.module) __parsec_tp->super.super.tdm.module->unmonitor_taskpool(&__parsec_tp->super.super);
+  for( i = 0; i < (uint32_t)(2 * __parsec_tp->super.super.nb_task_classes); i++ ) {  /* Extra startup function added at the end */
+    parsec_task_class_t* tc = (parsec_task_class_t*)__parsec_tp->super.super.task_classes_array[i];
+    free((void*)tc->incarnations);
+    free(tc);
+  }
+  free(__parsec_tp->super.super.task_classes_array); __parsec_tp->super.super.task_classes_array = NULL;
+  __parsec_tp->super.super.nb_task_classes = 0;
+
+  for(i = 0; i < (uint32_t)__parsec_tp->super.arenas_datatypes_size; i++) {
+    if( NULL != __parsec_tp->super.arenas_datatypes[i].arena ) {
+      PARSEC_OBJ_RELEASE(__parsec_tp->super.arenas_datatypes[i].arena);
+    }
+  }
+  /* Destroy the data repositories for this object */
+   data_repo_destroy_nothreadsafe(__parsec_tp->repositories[1]);  /* VERTICAL */
+   data_repo_destroy_nothreadsafe(__parsec_tp->repositories[0]);  /* HORIZONTAL */
+  /* Release the dependencies arrays for this object */
+  parsec_hash_table_fini( (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[1] );
+  PARSEC_OBJ_RELEASE(__parsec_tp->super.super.dependencies_array[1]);
+  __parsec_tp->super.super.dependencies_array[1] = NULL;
+  parsec_hash_table_fini( (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[0] );
+  PARSEC_OBJ_RELEASE(__parsec_tp->super.super.dependencies_array[0]);
+  __parsec_tp->super.super.dependencies_array[0] = NULL;
+  free( __parsec_tp->super.super.dependencies_array );
+  __parsec_tp->super.super.dependencies_array = NULL;
+  /* Unregister all the data */
+  uint32_t _i;
+  for( _i = 0; _i < parsec_nb_devices; _i++ ) {
+    parsec_device_module_t* device;
+    parsec_data_collection_t* parsec_dc;
+    if(!(__parsec_tp->super.super.devices_index_mask & (1 << _i))) continue;
+    if((NULL == (device = parsec_mca_device_get(_i))) || (NULL == device->memory_unregister)) continue;
+    parsec_dc = (parsec_data_collection_t*)__parsec_tp->super._g_descA;
+  if( NULL != parsec_dc->unregister_memory ) { (void)parsec_dc->unregister_memory(parsec_dc, device); };
+  parsec_dc = (parsec_data_collection_t*)__parsec_tp->super._g_descB;
+  if( NULL != parsec_dc->unregister_memory ) { (void)parsec_dc->unregister_memory(parsec_dc, device); };
+}
+  /* Unregister the taskpool from the devices */
+  for( i = 0; i < parsec_nb_devices; i++ ) {
+    if(!(__parsec_tp->super.super.devices_index_mask & (1 << i))) continue;
+    __parsec_tp->super.super.devices_index_mask ^= (1 << i);
+    parsec_device_module_t* device = parsec_mca_device_get(i);
+    if((NULL == device) || (NULL == device->taskpool_unregister)) continue;
+    if( PARSEC_SUCCESS != device->taskpool_unregister(device, &__parsec_tp->super.super) ) continue;
+  }
+  free(__parsec_tp->super.super.taskpool_name); __parsec_tp->super.super.taskpool_name = NULL;
+}
+
+void __parsec_multichain_internal_constructor(__parsec_multichain_internal_taskpool_t* __parsec_tp)
+{
+  parsec_task_class_t* tc;
+  uint32_t i, j;
+
+  __parsec_tp->super.super.nb_task_classes = PARSEC_multichain_NB_TASK_CLASSES;
+  __parsec_tp->super.super.devices_index_mask = PARSEC_DEVICES_ALL;
+  __parsec_tp->super.super.taskpool_name = strdup("multichain");
+  parsec_termdet_open_module(&__parsec_tp->super.super, "local");
+  __parsec_tp->super.super.tdm.module->monitor_taskpool(&__parsec_tp->super.super,
+                                                        parsec_taskpool_termination_detected);
+  __parsec_tp->super.super.update_nb_runtime_task = parsec_add_fetch_runtime_task;
+  __parsec_tp->super.super.dependencies_array = (void **)
+              calloc(__parsec_tp->super.super.nb_task_classes, sizeof(void*));
+  /* Twice the size to hold the startup tasks function_t */
+  __parsec_tp->super.super.task_classes_array = (const parsec_task_class_t**)
+              calloc((2 * PARSEC_multichain_NB_TASK_CLASSES + 1), sizeof(parsec_task_class_t*));
+  __parsec_tp->super.super.tdm.module->taskpool_addto_runtime_actions(&__parsec_tp->super.super, PARSEC_multichain_NB_TASK_CLASSES);  /* for the startup tasks */
+  __parsec_tp->super.super.taskpool_type = PARSEC_TASKPOOL_TYPE_PTG;
+  __parsec_tp->sync_point = __parsec_tp->super.super.nb_task_classes;
+  __parsec_tp->initial_number_tasks = 0;
+  __parsec_tp->startup_queue = NULL;
+  for( i = 0; i < __parsec_tp->super.super.nb_task_classes; i++ ) {
+    __parsec_tp->super.super.task_classes_array[i] = tc = malloc(sizeof(parsec_task_class_t));
+    memcpy(tc, multichain_task_classes[i], sizeof(parsec_task_class_t));
+    for( j = 0; PARSEC_DEV_NONE != tc->incarnations[j].type; j++);  /* compute the number of incarnations */
+    tc->incarnations = (__parsec_chore_t*)malloc((j+1) * sizeof(__parsec_chore_t));
+        memcpy((__parsec_chore_t*)tc->incarnations, multichain_task_classes[i]->incarnations, (j+1) * sizeof(__parsec_chore_t));
+
+    /* Add a placeholder for initialization and startup task */
+    __parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+i] = tc = (parsec_task_class_t*)malloc(sizeof(parsec_task_class_t));
+    memcpy(tc, (void*)&__parsec_generic_startup, sizeof(parsec_task_class_t));
+    tc->task_class_id = __parsec_tp->super.super.nb_task_classes + i;
+    tc->incarnations = (__parsec_chore_t*)malloc(2 * sizeof(__parsec_chore_t));
+    memcpy((__parsec_chore_t*)tc->incarnations, (void*)__parsec_generic_startup.incarnations, 2 * sizeof(__parsec_chore_t));
+    tc->release_task = parsec_release_task_to_mempool_and_count_as_runtime_tasks;
+  }
+  /* Startup task for VERTICAL */
+  tc = (parsec_task_class_t *)__parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+0];
+  tc->name = "Startup for VERTICAL";
+  tc->prepare_input = (parsec_hook_t*)multichain_VERTICAL_internal_init;
+  /* Startup task for HORIZONTAL */
+  tc = (parsec_task_class_t *)__parsec_tp->super.super.task_classes_array[__parsec_tp->super.super.nb_task_classes+1];
+  tc->name = "Startup for HORIZONTAL";
+  tc->prepare_input = (parsec_hook_t*)multichain_HORIZONTAL_internal_init;
+  ((__parsec_chore_t*)&tc->incarnations[0])->hook = (parsec_hook_t *)__jdf2c_startup_HORIZONTAL;
+  /* Compute the number of arenas_datatypes: */
+  /*   PARSEC_multichain_DEFAULT_ARENA  ->  0 */
+  __parsec_tp->super.arenas_datatypes_size = 1;
+  memset(&__parsec_tp->super.arenas_datatypes[0], 0, __parsec_tp->super.arenas_datatypes_size*sizeof(parsec_arena_datatype_t));
+  /* If profiling is enabled, the keys for profiling */
+#  if defined(PARSEC_PROF_TRACE)
+  __parsec_tp->super.super.profiling_array = multichain_profiling_array;
+  if( -2 == multichain_profiling_array[0] ) {
+    #if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+parsec_profiling_add_dictionary_keyword("multichain::VERTICAL::internal init", "fill:34D8D8",
+                                       0,
+                                       NULL,
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(multichain_VERTICAL.task_class_id  + PARSEC_multichain_NB_TASK_CLASSES)/* VERTICAL (internal init) start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(multichain_VERTICAL.task_class_id  + PARSEC_multichain_NB_TASK_CLASSES)/* VERTICAL (internal init) end key */]);
+#endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+parsec_profiling_add_dictionary_keyword("multichain::VERTICAL", "fill:CC2828",
+                                       sizeof(parsec_task_prof_info_t)+2*sizeof(parsec_assignment_t),
+                                       "dc_key{uint64_t};priority{int32_t};dc_dataid{uint32_t};tcid{uint32_t};trc{int32_t};i{int32_t};j{int32_t}",
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(multichain_VERTICAL.task_class_id) /* VERTICAL start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(multichain_VERTICAL.task_class_id) /* VERTICAL end key */]);
+
+    #if defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT)
+parsec_profiling_add_dictionary_keyword("multichain::HORIZONTAL::internal init", "fill:D83434",
+                                       0,
+                                       NULL,
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(multichain_HORIZONTAL.task_class_id  + PARSEC_multichain_NB_TASK_CLASSES)/* HORIZONTAL (internal init) start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(multichain_HORIZONTAL.task_class_id  + PARSEC_multichain_NB_TASK_CLASSES)/* HORIZONTAL (internal init) end key */]);
+#endif /* defined(PARSEC_PROF_TRACE_PTG_INTERNAL_INIT) */
+parsec_profiling_add_dictionary_keyword("multichain::HORIZONTAL", "fill:28CCCC",
+                                       sizeof(parsec_task_prof_info_t)+1*sizeof(parsec_assignment_t),
+                                       "dc_key{uint64_t};priority{int32_t};dc_dataid{uint32_t};tcid{uint32_t};trc{int32_t};i{int32_t}",
+                                       (int*)&__parsec_tp->super.super.profiling_array[START_KEY(multichain_HORIZONTAL.task_class_id) /* HORIZONTAL start key */],
+                                       (int*)&__parsec_tp->super.super.profiling_array[END_KEY(multichain_HORIZONTAL.task_class_id) /* HORIZONTAL end key */]);
+
+  }
+#  endif /* defined(PARSEC_PROF_TRACE) */
+  __parsec_tp->super.super.repo_array = __parsec_tp->repositories;
+  __parsec_tp->super.super.startup_hook = (parsec_startup_fn_t)multichain_startup;
+  (void)parsec_taskpool_reserve_id((parsec_taskpool_t*)__parsec_tp);
+}
+
+  /** Generate class declaration and instance using the above constructor and destructor */
+  PARSEC_OBJ_CLASS_DECLARATION(__parsec_multichain_internal_taskpool_t);
+  PARSEC_OBJ_CLASS_INSTANCE(__parsec_multichain_internal_taskpool_t, parsec_multichain_taskpool_t,
+                            __parsec_multichain_internal_constructor, __parsec_multichain_internal_destructor);
+
+#undef descA
+#undef descB
+#undef NI
+#undef NJ
+
+parsec_multichain_taskpool_t *parsec_multichain_new(parsec_matrix_block_cyclic_t* descA /* data descA */, parsec_matrix_block_cyclic_t* descB /* data descB */, int NI, int NJ)
+{
+  __parsec_multichain_internal_taskpool_t *__parsec_tp = PARSEC_OBJ_NEW(__parsec_multichain_internal_taskpool_t);
+  /* Dump the hidden parameters with default values */
+
+  /* Now the Parameter-dependent structures: */
+  __parsec_tp->super._g_descA = descA;
+  __parsec_tp->super._g_descB = descB;
+  __parsec_tp->super._g_NI = NI;
+  __parsec_tp->super._g_NJ = NJ;
+  PARSEC_AYU_REGISTER_TASK(&multichain_VERTICAL);
+  PARSEC_AYU_REGISTER_TASK(&multichain_HORIZONTAL);
+  __parsec_tp->super.super.startup_hook = (parsec_startup_fn_t)multichain_startup;
+  (void)parsec_taskpool_reserve_id((parsec_taskpool_t*)__parsec_tp);
+/* Prevent warnings related to not used hidden global variables */
+;
+  return (parsec_multichain_taskpool_t*)__parsec_tp;
+}
+
+
+static void create_communicators(void)
+{
+    int rank, size;
+
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+    comm_name[0] = strdup("MPI_COMM_WORLD");
+    comm_name[1] = strdup("MPI_COMM_SELF");
+
+    MPI_Comm_split(MPI_COMM_WORLD, 0, size-1-rank, &comms[2]);
+    asprintf(&comm_name[2], "WORLD.split(0, size-1-rank): same comm reorder ranks");
+
+    MPI_Comm_split(MPI_COMM_WORLD, (rank < (size-1) ? 0 : MPI_UNDEFINED), rank, &comms[3]);
+    asprintf(&comm_name[3], "WORLD.split((rank < (size-1) ? 0 : MPI_UNDEFINED), rank): all but last same ranks");
+
+    MPI_Comm_split(MPI_COMM_WORLD, rank % 2, rank, &comms[4]);
+    asprintf(&comm_name[4], "WORLD.split(rank %% 2, rank): split comm in 2 same ranks");
+
+    comm_name[5] = strdup("MPI_COMM_WORLD");
+}
+
+static void release_comms(void)
+{
+    int i;
+    for( i = 0; i < (int)(sizeof(comms) / sizeof(MPI_Comm)); i++ ) {
+        free(comm_name[i]);
+        if( (MPI_COMM_WORLD == comms[i]) ||
+            (MPI_COMM_SELF == comms[i]) ||
+            (MPI_COMM_NULL == comms[i]) )
+            continue;
+        MPI_Comm_free(&comms[i]);
+    }
+}
+
+#define TIMER_START(_TIMER)                      \
+    do {                                         \
+        struct timeval tv;                       \
+        gettimeofday(&tv,NULL);                  \
+        (_TIMER) = tv.tv_sec * 1e6 + tv.tv_usec; \
+    } while (0)
+
+#define TIMER_STOP(_TIMER)                                    \
+    do {                                                      \
+        struct timeval tv;                                    \
+        gettimeofday(&tv,NULL);                               \
+        (_TIMER) = (tv.tv_sec * 1e6 + tv.tv_usec) - (_TIMER); \
+    } while (0)
+
+int main(int argc, char* argv[])
+{
+    parsec_matrix_block_cyclic_t descA, descB;
+    parsec_arena_datatype_t adt;
+    parsec_context_t *parsec;
+    int ni = NN, nj = NN, loops = 5, sleep_between_comms = 1, i = 1, l, rc;
+    int rank = 0, size = 1, mat_size;
+    int world_rank = 0, world_size = 1;
+    long time_elapsed;
+    parsec_datatype_t baseType, newtype;
+    MPI_Comm comm;
+
+    int pargc = 0; char **pargv = NULL;
+    for( i = 1; i < argc; i++) {
+        if( 0 == strncmp(argv[i], "--", 3) ) {
+            pargc = argc - i;
+            pargv = argv + i;
+            break;
+        }
+        if( 0 == strncmp(argv[i], "-i=", 3) ) {
+            ni = strtol(argv[i]+3, NULL, 10);
+            if( 0 >= ni ) ni = NN;
+            continue;
+        }
+        if( 0 == strncmp(argv[i], "-j=", 3) ) {
+            nj = strtol(argv[i]+3, NULL, 10);
+            if( 0 >= nj ) nj = NN;
+            continue;
+        }
+        if( 0 == strncmp(argv[i], "-v=", 3) ) {
+            verbose = strtol(argv[i]+3, NULL, 10);
+            if( 0 > verbose ) verbose = 0;
+            continue;
+        }
+        if( 0 == strncmp(argv[i], "-s=", 3) ) {
+            sleep_between_comms = strtol(argv[i]+3, NULL, 10);
+            continue;
+        }
+        if( 0 == strncmp(argv[i], "-c=", 3) ) {
+            max_comms = strtol(argv[i]+3, NULL, 10);
+            if(max_comms > 6) max_comms = 6;
+            if(max_comms < 1) max_comms = 1;
+            continue;
+        }
+        if( 0 == strncmp(argv[i], "-l=", 3) ) {
+            loops = strtol(argv[i]+3, NULL, 10);
+            if( 0 >= loops ) loops = 5;
+            continue;
+        }
+        if( 0 == strncmp(argv[i], "-h", 2) ) {
+            printf("-h: help\n"
+                   "-i=<nb> the number of horizontal tasks\n"
+                   "-j=<nb> the number of vertical tasks for each horizontal task\n"
+                   "-l=<nb> the number of repetition\n"
+                   "-s=<nb> the number of seconds to sleep between two new communicator test\n"
+                   "-c=<nb> the number of communicators to test (between 1 and 6)\n"
+                   "-v=<nb> the verbosity level\n");
+            exit(0);
+        }
+    }
+#ifdef DISTRIBUTED
+    {
+        int provided;
+        MPI_Init_thread(NULL, NULL, MPI_THREAD_SERIALIZED, &provided);
+        MPI_Comm_size(MPI_COMM_WORLD, &world_size);
+        MPI_Comm_rank(MPI_COMM_WORLD, &world_rank);
+    }
+    create_communicators();
+#endif  /* DISTRIBUTED */
+    parsec = parsec_init(2, &pargc, &pargv);
+    assert( NULL != parsec );
+
+    for( i = 0; i < max_comms; i++ ) {
+        /**
+         * Build the data and the arena to hold it up.
+         */
+#ifdef DISTRIBUTED
+        MPI_Barrier(MPI_COMM_WORLD);
+        comm = comms[i];
+        if( MPI_COMM_NULL == comm ) continue;
+        MPI_Comm_size(comm, &size);
+        MPI_Comm_rank(comm, &rank);
+        if(verbose>0) printf("Starting the test %d (using communicator %s) (%d/%d)\n", i, comm_name[i], rank, size);
+        parsec_remote_dep_set_ctx(parsec, (intptr_t)comm);
+#endif  /* DISTRIBUTED */
+        mat_size = 2*BLOCK*size*ni;
+        parsec_matrix_block_cyclic_init( &descA, TYPE, PARSEC_MATRIX_TILE,
+                                   rank /*rank*/,
+                                   2*BLOCK, 1, mat_size, 1,
+                                   0, 0, mat_size, 1,
+                                   size, 1, 1, 1, 0, 0);
+        printf("Rank %d/%d has %d tiles locally\n", rank, size, descA.super.nb_local_tiles);
+        descA.mat = parsec_data_allocate( descA.super.nb_local_tiles *
+                                          descA.super.bsiz *
+                                          parsec_datadist_getsizeoftype(TYPE) );
+        parsec_matrix_block_cyclic_init( &descB, TYPE, PARSEC_MATRIX_TILE,
+                                   rank /*rank*/,
+                                   2*BLOCK, 1, mat_size, 1,
+                                   0, 0, mat_size, 1,
+                                   size, 1, 1, 1, 0, 0);
+        descB.mat = parsec_data_allocate( descB.super.nb_local_tiles *
+                                          descB.super.bsiz *
+                                          parsec_datadist_getsizeoftype(TYPE) );
+
+        parsec_translate_matrix_type(TYPE, &baseType);
+        parsec_type_create_contiguous(descA.super.mb * descA.super.nb,
+                                      baseType, &newtype);
+        parsec_arena_datatype_construct( &adt,
+                                         descA.super.mb * descA.super.nb * parsec_datadist_getsizeoftype(TYPE),
+                                         PARSEC_ARENA_ALIGNMENT_SSE, newtype);
+
+        for( l = loops; l > 0; l-- ) {
+
+            if(verbose>0) printf("\n\n\n%d iterations remaining\n\n\n", l);
+            tp = parsec_multichain_new( &descA, &descB, ni, nj );
+            assert( NULL != tp );
+            tp->arenas_datatypes[PARSEC_multichain_DEFAULT_ADT_IDX] = adt;
+            PARSEC_OBJ_RETAIN(adt.arena);
+
+            rc = parsec_context_start(parsec);
+            PARSEC_CHECK_ERROR(rc, "parsec_context_start");
+
+            TIMER_START(time_elapsed);
+            rc = parsec_context_add_taskpool( parsec, (parsec_taskpool_t*)tp );
+            PARSEC_CHECK_ERROR(rc, "parsec_context_add_taskpool");
+            TIMER_STOP(time_elapsed);
+            printf("Comm %s (test %d) Loop %d DAG construction in %ld micro-sec\n", comm_name[i], i, l, time_elapsed);
+
+            TIMER_START(time_elapsed);
+            rc = parsec_context_wait(parsec);
+            parsec_taskpool_free(&tp->super);
+            PARSEC_CHECK_ERROR(rc, "parsec_context_wait");
+            TIMER_STOP(time_elapsed);
+
+            printf("Comm %s (test %d) Loop %d DAG execution in %ld micro-sec [world %d/%d]\n",
+                   comm_name[i], i, l, time_elapsed, world_rank, world_size);
+            if( verbose >= 5 ) {
+                printf("<DartMeasurement name=\"no_pri\" type=\"numeric/double\"\n"
+                       "                 encoding=\"none\" compression=\"none\">\n"
+                       "%g\n"
+                       "</DartMeasurement>\n",
+                       (double)time_elapsed);
+            }
+
+            /**
+             * Validate the parsec_context_start / parsec_context_wait functionality.
+             */
+            if(verbose>0) printf("\n\nChecking the parsec_context_start / parsec_context_wait (sleep %d)\n\n", sleep_between_comms);
+            tp = parsec_multichain_new( &descA, &descB, ni, nj );
+            assert( NULL != tp );
+
+            tp->arenas_datatypes[PARSEC_multichain_DEFAULT_ADT_IDX] = adt;
+            PARSEC_OBJ_RETAIN(adt.arena);
+            TIMER_START(time_elapsed);
+            rc = parsec_context_add_taskpool( parsec, (parsec_taskpool_t*)tp );
+            PARSEC_CHECK_ERROR(rc, "parsec_context_add_taskpool");
+            TIMER_STOP(time_elapsed);
+
+            rc = parsec_context_start(parsec);
+            PARSEC_CHECK_ERROR(rc, "parsec_context_start");
+
+            if(sleep_between_comms>0) sleep(sleep_between_comms);
+            if(verbose>0) printf("Main thread going for the wait (remaining tasks %d)\n", tp->super.nb_tasks);
+            /* By now most of the tasks should be completed */
+            TIMER_START(time_elapsed);
+            rc = parsec_context_wait(parsec);
+            parsec_taskpool_free(&tp->super);
+            PARSEC_CHECK_ERROR(rc, "parsec_context_wait");
+            TIMER_STOP(time_elapsed);
+
+            printf("Comm %s (test %d) Loop %d DAG execution in %ld micro-sec [world %d/%d]\n",
+                   comm_name[i], i, l, time_elapsed, world_rank, world_size);
+        }
+        free(descA.mat);
+        free(descB.mat);
+        PARSEC_OBJ_RELEASE(adt.arena);
+        parsec_type_free(&newtype);
+    }  /* go to the next communicator */
+
+    parsec_fini( &parsec);
+#ifdef DISTRIBUTED
+    release_comms();
+    MPI_Finalize();
+#endif  /* DISTRIBUTED */
+
+    return 0;
+}
+
+PARSEC_OBJ_CLASS_INSTANCE(parsec_multichain_taskpool_t, parsec_taskpool_t, NULL, NULL);
+
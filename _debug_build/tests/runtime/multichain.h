@@ -0,0 +1,93 @@
+#ifndef _multichain_h_
+#define _multichain_h_
+#include "parsec.h"
+#include "parsec/parsec_internal.h"
+#include "parsec/remote_dep.h"
+
+BEGIN_C_DECLS
+
+#define PARSEC_multichain_DEFAULT_ADT_IDX    0
+#define PARSEC_multichain_ADT_IDX_MAX       1
+typedef struct parsec_multichain_taskpool_s {
+  parsec_taskpool_t super;
+  /* The list of globals */
+  parsec_matrix_block_cyclic_t* _g_descA /* data descA */;
+  parsec_matrix_block_cyclic_t* _g_descB /* data descB */;
+  int _g_NI;
+  int _g_NJ;
+  /* The array of datatypes (DEFAULT and co.) */
+  parsec_arena_datatype_t arenas_datatypes[PARSEC_multichain_ADT_IDX_MAX];
+  uint32_t arenas_datatypes_size;
+} parsec_multichain_taskpool_t;
+
+/** Beware that this object is not a superset of the internal object, and as a result
+ *  we should never create one directly. Instead we should rely on the creation of the
+ *  internal object (__parsec_multichain_taskpool_t).
+ */
+PARSEC_OBJ_CLASS_DECLARATION(parsec_multichain_taskpool_t);
+extern parsec_multichain_taskpool_t *parsec_multichain_new(parsec_matrix_block_cyclic_t* _g_descA /* data descA */, parsec_matrix_block_cyclic_t* _g_descB /* data descB */, int _g_NI, int _g_NJ);
+
+#if MAX_LOCAL_COUNT < 2  /* number of parameters and locals VERTICAL */
+  #error Too many parameters and local variables (2 out of MAX_LOCAL_COUNT) for task VERTICAL
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_multichain_VERTICAL_assignment_s {
+  parsec_assignment_t i;
+  parsec_assignment_t j;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-2];
+} __parsec_multichain_VERTICAL_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 2  /* total number of flows for task VERTICAL */
+  #error Too many flows (2 out of MAX_PARAM_COUNT) for task VERTICAL
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_multichain_VERTICAL_data_s {
+  parsec_data_pair_t _f_A;
+  parsec_data_pair_t _f_B;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-2];
+} __parsec_multichain_VERTICAL_data_t;
+
+typedef struct __parsec_multichain_VERTICAL_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_multichain_VERTICAL_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_multichain_VERTICAL_data_s data;
+} __parsec_multichain_VERTICAL_task_t;
+
+
+#if MAX_LOCAL_COUNT < 1  /* number of parameters and locals HORIZONTAL */
+  #error Too many parameters and local variables (1 out of MAX_LOCAL_COUNT) for task HORIZONTAL
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_multichain_HORIZONTAL_assignment_s {
+  parsec_assignment_t i;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-1];
+} __parsec_multichain_HORIZONTAL_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 2  /* total number of flows for task HORIZONTAL */
+  #error Too many flows (2 out of MAX_PARAM_COUNT) for task HORIZONTAL
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_multichain_HORIZONTAL_data_s {
+  parsec_data_pair_t _f_A;
+  parsec_data_pair_t _f_B;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-2];
+} __parsec_multichain_HORIZONTAL_data_t;
+
+typedef struct __parsec_multichain_HORIZONTAL_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_multichain_HORIZONTAL_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_multichain_HORIZONTAL_data_s data;
+} __parsec_multichain_HORIZONTAL_task_t;
+
+
+END_C_DECLS
+
+#endif /* _multichain_h_ */ 
@@ -0,0 +1,124 @@
+#ifndef _put_sched_h_
+#define _put_sched_h_
+#include "parsec.h"
+#include "parsec/parsec_internal.h"
+#include "parsec/remote_dep.h"
+
+BEGIN_C_DECLS
+
+#define PARSEC_put_sched_DEFAULT_ADT_IDX    0
+#define PARSEC_put_sched_BULK_ADT_IDX    1
+#define PARSEC_put_sched_CHAIN_ADT_IDX    2
+#define PARSEC_put_sched_ADT_IDX_MAX       3
+typedef struct parsec_put_sched_taskpool_s {
+  parsec_taskpool_t super;
+  /* The list of globals */
+  parsec_matrix_block_cyclic_t* _g_descA /* data descA */;
+  parsec_matrix_block_cyclic_t* _g_descB /* data descB */;
+  parsec_matrix_block_cyclic_t* _g_descC /* data descC */;
+  int _g_NT;
+  int _g_NB;
+  int _g_NK;
+  int32_t* _g_errors;
+  /* The array of datatypes (DEFAULT,BULK,CHAIN and co.) */
+  parsec_arena_datatype_t arenas_datatypes[PARSEC_put_sched_ADT_IDX_MAX];
+  uint32_t arenas_datatypes_size;
+} parsec_put_sched_taskpool_t;
+
+/** Beware that this object is not a superset of the internal object, and as a result
+ *  we should never create one directly. Instead we should rely on the creation of the
+ *  internal object (__parsec_put_sched_taskpool_t).
+ */
+PARSEC_OBJ_CLASS_DECLARATION(parsec_put_sched_taskpool_t);
+extern parsec_put_sched_taskpool_t *parsec_put_sched_new(parsec_matrix_block_cyclic_t* _g_descA /* data descA */, parsec_matrix_block_cyclic_t* _g_descB /* data descB */, parsec_matrix_block_cyclic_t* _g_descC /* data descC */, int _g_NT, int _g_NB, int _g_NK, int32_t* _g_errors);
+
+#if MAX_LOCAL_COUNT < 1  /* number of parameters and locals CHAIN */
+  #error Too many parameters and local variables (1 out of MAX_LOCAL_COUNT) for task CHAIN
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_put_sched_CHAIN_assignment_s {
+  parsec_assignment_t k;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-1];
+} __parsec_put_sched_CHAIN_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 1  /* total number of flows for task CHAIN */
+  #error Too many flows (1 out of MAX_PARAM_COUNT) for task CHAIN
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_put_sched_CHAIN_data_s {
+  parsec_data_pair_t _f_C;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-1];
+} __parsec_put_sched_CHAIN_data_t;
+
+typedef struct __parsec_put_sched_CHAIN_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_put_sched_CHAIN_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_put_sched_CHAIN_data_s data;
+} __parsec_put_sched_CHAIN_task_t;
+
+
+#if MAX_LOCAL_COUNT < 1  /* number of parameters and locals BULK_DST */
+  #error Too many parameters and local variables (1 out of MAX_LOCAL_COUNT) for task BULK_DST
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_put_sched_BULK_DST_assignment_s {
+  parsec_assignment_t i;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-1];
+} __parsec_put_sched_BULK_DST_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 1  /* total number of flows for task BULK_DST */
+  #error Too many flows (1 out of MAX_PARAM_COUNT) for task BULK_DST
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_put_sched_BULK_DST_data_s {
+  parsec_data_pair_t _f_A;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-1];
+} __parsec_put_sched_BULK_DST_data_t;
+
+typedef struct __parsec_put_sched_BULK_DST_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_put_sched_BULK_DST_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_put_sched_BULK_DST_data_s data;
+} __parsec_put_sched_BULK_DST_task_t;
+
+
+#if MAX_LOCAL_COUNT < 1  /* number of parameters and locals BULK_SRC */
+  #error Too many parameters and local variables (1 out of MAX_LOCAL_COUNT) for task BULK_SRC
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_put_sched_BULK_SRC_assignment_s {
+  parsec_assignment_t i;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-1];
+} __parsec_put_sched_BULK_SRC_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 1  /* total number of flows for task BULK_SRC */
+  #error Too many flows (1 out of MAX_PARAM_COUNT) for task BULK_SRC
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_put_sched_BULK_SRC_data_s {
+  parsec_data_pair_t _f_A;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-1];
+} __parsec_put_sched_BULK_SRC_data_t;
+
+typedef struct __parsec_put_sched_BULK_SRC_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_put_sched_BULK_SRC_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_put_sched_BULK_SRC_data_s data;
+} __parsec_put_sched_BULK_SRC_task_t;
+
+
+END_C_DECLS
+
+#endif /* _put_sched_h_ */ 
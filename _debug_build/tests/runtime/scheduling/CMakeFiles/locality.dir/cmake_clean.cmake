@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/locality.dir/locality.c.o"
+  "CMakeFiles/locality.dir/locality.c.o.d"
+  "locality"
+  "locality.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/locality.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
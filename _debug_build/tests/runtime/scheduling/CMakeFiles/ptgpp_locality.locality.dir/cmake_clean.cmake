@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ptgpp_locality.locality"
+  "locality.c"
+  "locality.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ptgpp_locality.locality.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
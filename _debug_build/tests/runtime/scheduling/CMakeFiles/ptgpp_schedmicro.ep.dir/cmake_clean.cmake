@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ptgpp_schedmicro.ep"
+  "ep.c"
+  "ep.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ptgpp_schedmicro.ep.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
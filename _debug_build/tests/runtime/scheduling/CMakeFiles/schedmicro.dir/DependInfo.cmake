@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/_debug_build/tests/runtime/scheduling/ep.c" "tests/runtime/scheduling/CMakeFiles/schedmicro.dir/ep.c.o" "gcc" "tests/runtime/scheduling/CMakeFiles/schedmicro.dir/ep.c.o.d"
+  "/root/repo/tests/runtime/scheduling/ep_wrapper.c" "tests/runtime/scheduling/CMakeFiles/schedmicro.dir/ep_wrapper.c.o" "gcc" "tests/runtime/scheduling/CMakeFiles/schedmicro.dir/ep_wrapper.c.o.d"
+  "/root/repo/tests/runtime/scheduling/main.c" "tests/runtime/scheduling/CMakeFiles/schedmicro.dir/main.c.o" "gcc" "tests/runtime/scheduling/CMakeFiles/schedmicro.dir/main.c.o.d"
+  "/root/repo/tests/runtime/scheduling/schedmicro_data.c" "tests/runtime/scheduling/CMakeFiles/schedmicro.dir/schedmicro_data.c.o" "gcc" "tests/runtime/scheduling/CMakeFiles/schedmicro.dir/schedmicro_data.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_debug_build/parsec/CMakeFiles/parsec.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "/root/repo/_debug_build/parsec/include/fortran")
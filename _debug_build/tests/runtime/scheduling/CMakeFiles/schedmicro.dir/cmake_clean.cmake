@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/schedmicro.dir/ep.c.o"
+  "CMakeFiles/schedmicro.dir/ep.c.o.d"
+  "CMakeFiles/schedmicro.dir/ep_wrapper.c.o"
+  "CMakeFiles/schedmicro.dir/ep_wrapper.c.o.d"
+  "CMakeFiles/schedmicro.dir/main.c.o"
+  "CMakeFiles/schedmicro.dir/main.c.o.d"
+  "CMakeFiles/schedmicro.dir/schedmicro_data.c.o"
+  "CMakeFiles/schedmicro.dir/schedmicro_data.c.o.d"
+  "schedmicro"
+  "schedmicro.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/schedmicro.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
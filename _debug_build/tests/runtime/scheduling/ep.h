@@ -0,0 +1,90 @@
+#ifndef _ep_h_
+#define _ep_h_
+#include "parsec.h"
+#include "parsec/parsec_internal.h"
+#include "parsec/remote_dep.h"
+
+BEGIN_C_DECLS
+
+#define PARSEC_ep_DEFAULT_ADT_IDX    0
+#define PARSEC_ep_ADT_IDX_MAX       1
+typedef struct parsec_ep_taskpool_s {
+  parsec_taskpool_t super;
+  /* The list of globals */
+  int _g_NT;
+  int _g_DEPTH;
+  parsec_data_collection_t* _g_A /* data A */;
+  /* The array of datatypes (DEFAULT and co.) */
+  parsec_arena_datatype_t arenas_datatypes[PARSEC_ep_ADT_IDX_MAX];
+  uint32_t arenas_datatypes_size;
+} parsec_ep_taskpool_t;
+
+/** Beware that this object is not a superset of the internal object, and as a result
+ *  we should never create one directly. Instead we should rely on the creation of the
+ *  internal object (__parsec_ep_taskpool_t).
+ */
+PARSEC_OBJ_CLASS_DECLARATION(parsec_ep_taskpool_t);
+extern parsec_ep_taskpool_t *parsec_ep_new(int _g_NT, int _g_DEPTH, parsec_data_collection_t* _g_A /* data A */);
+
+#if MAX_LOCAL_COUNT < 2  /* number of parameters and locals TASK */
+  #error Too many parameters and local variables (2 out of MAX_LOCAL_COUNT) for task TASK
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_ep_TASK_assignment_s {
+  parsec_assignment_t i;
+  parsec_assignment_t l;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-2];
+} __parsec_ep_TASK_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 1  /* total number of flows for task TASK */
+  #error Too many flows (1 out of MAX_PARAM_COUNT) for task TASK
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_ep_TASK_data_s {
+  parsec_data_pair_t _f_S;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-1];
+} __parsec_ep_TASK_data_t;
+
+typedef struct __parsec_ep_TASK_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_ep_TASK_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_ep_TASK_data_s data;
+} __parsec_ep_TASK_task_t;
+
+
+#if MAX_LOCAL_COUNT < 1  /* number of parameters and locals INIT */
+  #error Too many parameters and local variables (1 out of MAX_LOCAL_COUNT) for task INIT
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_ep_INIT_assignment_s {
+  parsec_assignment_t k;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-1];
+} __parsec_ep_INIT_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 1  /* total number of flows for task INIT */
+  #error Too many flows (1 out of MAX_PARAM_COUNT) for task INIT
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_ep_INIT_data_s {
+  parsec_data_pair_t _f_S;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-1];
+} __parsec_ep_INIT_data_t;
+
+typedef struct __parsec_ep_INIT_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_ep_INIT_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_ep_INIT_data_s data;
+} __parsec_ep_INIT_task_t;
+
+
+END_C_DECLS
+
+#endif /* _ep_h_ */ 
@@ -0,0 +1,152 @@
+#ifndef _tcp_engine_h_
+#define _tcp_engine_h_
+#include "parsec.h"
+#include "parsec/parsec_internal.h"
+#include "parsec/remote_dep.h"
+
+BEGIN_C_DECLS
+
+#define PARSEC_tcp_engine_DEFAULT_ADT_IDX    0
+#define PARSEC_tcp_engine_LOWER_ADT_IDX    1
+#define PARSEC_tcp_engine_ADT_IDX_MAX       2
+typedef struct parsec_tcp_engine_taskpool_s {
+  parsec_taskpool_t super;
+  /* The list of globals */
+  parsec_matrix_block_cyclic_t* _g_descA /* data descA */;
+  parsec_matrix_block_cyclic_t* _g_descB /* data descB */;
+  parsec_matrix_block_cyclic_t* _g_descC /* data descC */;
+  int _g_NT;
+  int _g_NB;
+  int _g_NP;
+  int32_t* _g_errors;
+  /* The array of datatypes (DEFAULT,LOWER and co.) */
+  parsec_arena_datatype_t arenas_datatypes[PARSEC_tcp_engine_ADT_IDX_MAX];
+  uint32_t arenas_datatypes_size;
+} parsec_tcp_engine_taskpool_t;
+
+/** Beware that this object is not a superset of the internal object, and as a result
+ *  we should never create one directly. Instead we should rely on the creation of the
+ *  internal object (__parsec_tcp_engine_taskpool_t).
+ */
+PARSEC_OBJ_CLASS_DECLARATION(parsec_tcp_engine_taskpool_t);
+extern parsec_tcp_engine_taskpool_t *parsec_tcp_engine_new(parsec_matrix_block_cyclic_t* _g_descA /* data descA */, parsec_matrix_block_cyclic_t* _g_descB /* data descB */, parsec_matrix_block_cyclic_t* _g_descC /* data descC */, int _g_NT, int _g_NB, int _g_NP, int32_t* _g_errors);
+
+#if MAX_LOCAL_COUNT < 1  /* number of parameters and locals READER */
+  #error Too many parameters and local variables (1 out of MAX_LOCAL_COUNT) for task READER
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_tcp_engine_READER_assignment_s {
+  parsec_assignment_t r;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-1];
+} __parsec_tcp_engine_READER_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 1  /* total number of flows for task READER */
+  #error Too many flows (1 out of MAX_PARAM_COUNT) for task READER
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_tcp_engine_READER_data_s {
+  parsec_data_pair_t _f_L;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-1];
+} __parsec_tcp_engine_READER_data_t;
+
+typedef struct __parsec_tcp_engine_READER_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_tcp_engine_READER_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_tcp_engine_READER_data_s data;
+} __parsec_tcp_engine_READER_task_t;
+
+
+#if MAX_LOCAL_COUNT < 1  /* number of parameters and locals BCAST */
+  #error Too many parameters and local variables (1 out of MAX_LOCAL_COUNT) for task BCAST
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_tcp_engine_BCAST_assignment_s {
+  parsec_assignment_t k;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-1];
+} __parsec_tcp_engine_BCAST_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 1  /* total number of flows for task BCAST */
+  #error Too many flows (1 out of MAX_PARAM_COUNT) for task BCAST
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_tcp_engine_BCAST_data_s {
+  parsec_data_pair_t _f_L;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-1];
+} __parsec_tcp_engine_BCAST_data_t;
+
+typedef struct __parsec_tcp_engine_BCAST_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_tcp_engine_BCAST_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_tcp_engine_BCAST_data_s data;
+} __parsec_tcp_engine_BCAST_task_t;
+
+
+#if MAX_LOCAL_COUNT < 1  /* number of parameters and locals RECV */
+  #error Too many parameters and local variables (1 out of MAX_LOCAL_COUNT) for task RECV
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_tcp_engine_RECV_assignment_s {
+  parsec_assignment_t i;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-1];
+} __parsec_tcp_engine_RECV_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 1  /* total number of flows for task RECV */
+  #error Too many flows (1 out of MAX_PARAM_COUNT) for task RECV
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_tcp_engine_RECV_data_s {
+  parsec_data_pair_t _f_A;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-1];
+} __parsec_tcp_engine_RECV_data_t;
+
+typedef struct __parsec_tcp_engine_RECV_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_tcp_engine_RECV_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_tcp_engine_RECV_data_s data;
+} __parsec_tcp_engine_RECV_task_t;
+
+
+#if MAX_LOCAL_COUNT < 1  /* number of parameters and locals SEND */
+  #error Too many parameters and local variables (1 out of MAX_LOCAL_COUNT) for task SEND
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_tcp_engine_SEND_assignment_s {
+  parsec_assignment_t i;
+  parsec_assignment_t reserved[MAX_LOCAL_COUNT-1];
+} __parsec_tcp_engine_SEND_parsec_assignment_t;
+
+#if MAX_PARAM_COUNT < 1  /* total number of flows for task SEND */
+  #error Too many flows (1 out of MAX_PARAM_COUNT) for task SEND
+#endif  /* MAX_PARAM_COUNT */
+typedef struct __parsec_tcp_engine_SEND_data_s {
+  parsec_data_pair_t _f_A;
+  parsec_data_pair_t unused[MAX_LOCAL_COUNT-1];
+} __parsec_tcp_engine_SEND_data_t;
+
+typedef struct __parsec_tcp_engine_SEND_task_s {
+    PARSEC_MINIMAL_EXECUTION_CONTEXT
+#if defined(PARSEC_PROF_TRACE)
+    parsec_task_prof_info_t prof_info;
+#endif /* defined(PARSEC_PROF_TRACE) */
+    struct __parsec_tcp_engine_SEND_assignment_s locals;
+#if defined(PARSEC_SIM)
+    int                        sim_exec_date;
+#endif
+    struct __parsec_tcp_engine_SEND_data_s data;
+} __parsec_tcp_engine_SEND_task_t;
+
+
+END_C_DECLS
+
+#endif /* _tcp_engine_h_ */ 
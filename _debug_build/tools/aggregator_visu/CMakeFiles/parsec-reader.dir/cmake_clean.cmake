@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/parsec-reader.dir/reader.c.o"
+  "CMakeFiles/parsec-reader.dir/reader.c.o.d"
+  "parsec-reader"
+  "parsec-reader.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/parsec-reader.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
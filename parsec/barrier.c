@@ -6,9 +6,134 @@
 
 #include "parsec/parsec_config.h"
 #include "parsec/class/barrier.h"
+#include <assert.h>
 
 #if PARSEC_IMPLEMENT_BARRIERS
 
+#if defined(PARSEC_HAVE_LINUX_FUTEX_H)
+
+#include "parsec/sys/atomic.h"
+#include "parsec/utils/futex.h"
+#include <stdlib.h>
+#include <errno.h>
+
+/* Number of polls of the generation before blocking in the kernel */
+#define PARSEC_BARRIER_SPIN 128
+
+int parsec_barrier_init(parsec_barrier_t* barrier, const void* attr, unsigned int count)
+{
+    int nb_nodes, level_start, level_size, i;
+
+    (void)attr;
+    if( 0 == count ) return EINVAL;
+
+    barrier->count      = count;
+    barrier->generation = 0;
+    barrier->sleepers   = 0;
+    barrier->nb_leaves  = (count + PARSEC_BARRIER_FANIN - 1) / PARSEC_BARRIER_FANIN;
+    for( nb_nodes = 0, level_size = barrier->nb_leaves; level_size > 1;
+         level_size = (level_size + PARSEC_BARRIER_FANIN - 1) / PARSEC_BARRIER_FANIN )
+        nb_nodes += level_size;
+    barrier->nb_nodes = nb_nodes + 1;
+    if( 0 != posix_memalign((void**)&barrier->nodes, 64,
+                            barrier->nb_nodes * sizeof(parsec_barrier_node_t)) )
+        return ENOMEM;
+
+    /* The threads are spread evenly over the leaves, each upper level
+     * combines groups of PARSEC_BARRIER_FANIN nodes of the level below */
+    for( i = 0; i < barrier->nb_leaves; i++ ) {
+        barrier->nodes[i].expected = count / barrier->nb_leaves +
+            ((unsigned int)i < count % barrier->nb_leaves ? 1 : 0);
+    }
+    for( level_start = 0, level_size = barrier->nb_leaves; level_size > 1; ) {
+        int next_start = level_start + level_size;
+        int next_size  = (level_size + PARSEC_BARRIER_FANIN - 1) / PARSEC_BARRIER_FANIN;
+        for( i = 0; i < next_size; i++ ) {
+            int nb_children = level_size - i * PARSEC_BARRIER_FANIN;
+            barrier->nodes[next_start + i].expected =
+                nb_children < PARSEC_BARRIER_FANIN ? nb_children : PARSEC_BARRIER_FANIN;
+        }
+        for( i = 0; i < level_size; i++ )
+            barrier->nodes[level_start + i].parent = next_start + i / PARSEC_BARRIER_FANIN;
+        level_start = next_start;
+        level_size  = next_size;
+    }
+    barrier->nodes[barrier->nb_nodes - 1].parent = -1;
+    for( i = 0; i < barrier->nb_nodes; i++ )
+        barrier->nodes[i].arrived = 0;
+    return 0;
+}
+
+/* Threads start their search for a free spot on a leaf derived from their
+ * identity, so that the same thread tends to use the same leaf. */
+static inline int parsec_barrier_leaf_hint(const parsec_barrier_t* barrier)
+{
+    uintptr_t id = (uintptr_t)pthread_self();
+    id ^= (id >> 12) ^ (id >> 24);
+    return (int)(id % (uintptr_t)barrier->nb_leaves);
+}
+
+int parsec_barrier_wait(parsec_barrier_t* barrier)
+{
+    int32_t generation = barrier->generation;
+    int node = -1, hint, i, spin;
+
+    parsec_atomic_rmb();
+    /* Claim a spot on a leaf. The leaves hold exactly count spots, so a
+     * thread finding its leaf full always finds a spot on another one. */
+    hint = parsec_barrier_leaf_hint(barrier);
+    for( i = 0; i < barrier->nb_leaves; i++ ) {
+        int leaf = (hint + i) % barrier->nb_leaves;
+        int32_t pos;
+        if( barrier->nodes[leaf].arrived >= barrier->nodes[leaf].expected ) continue;
+        pos = parsec_atomic_fetch_inc_int32(&barrier->nodes[leaf].arrived);
+        if( pos < barrier->nodes[leaf].expected ) {
+            node = (pos + 1 == barrier->nodes[leaf].expected) ? leaf : -2;
+            break;
+        }
+    }
+    assert(-1 != node);
+
+    /* The last arrival on a node combines it into its parent */
+    while( node >= 0 ) {
+        int parent = barrier->nodes[node].parent;
+        if( -1 == parent ) {
+            /* Everybody arrived: reset the tree before releasing the
+             * threads, as they may enter the next episode right away */
+            for( i = 0; i < barrier->nb_nodes; i++ )
+                barrier->nodes[i].arrived = 0;
+            parsec_atomic_wmb();
+            parsec_atomic_fetch_inc_int32(&barrier->generation);
+            if( 0 != barrier->sleepers )
+                parsec_futex_wake(&barrier->generation, PARSEC_FUTEX_WAKE_ALL);
+            return 1;
+        }
+        node = (parsec_atomic_fetch_inc_int32(&barrier->nodes[parent].arrived) + 1 ==
+                barrier->nodes[parent].expected) ? parent : -2;
+    }
+
+    for( spin = 0; spin < PARSEC_BARRIER_SPIN; spin++ ) {
+        if( generation != barrier->generation ) return 0;
+    }
+    parsec_atomic_fetch_inc_int32(&barrier->sleepers);
+    while( generation == barrier->generation ) {
+        parsec_futex_wait(&barrier->generation, generation, NULL);
+    }
+    parsec_atomic_fetch_dec_int32(&barrier->sleepers);
+    return 0;
+}
+
+int parsec_barrier_destroy(parsec_barrier_t* barrier)
+{
+    free(barrier->nodes);
+    barrier->nodes    = NULL;
+    barrier->count    = 0;
+    barrier->nb_nodes = barrier->nb_leaves = 0;
+    return 0;
+}
+
+#else
+
 int parsec_barrier_init(parsec_barrier_t* barrier, const void* attr, unsigned int count)
 {
     int rc;
@@ -60,4 +185,6 @@ int parsec_barrier_destroy(parsec_barrier_t* barrier)
     return 0;
 }
 
+#endif  /* defined(PARSEC_HAVE_LINUX_FUTEX_H) */
+
 #endif  /* !(defined(_POSIX_BARRIERS) && (_POSIX_BARRIERS - 20012L) >= 0) */
@@ -0,0 +1,393 @@
+/*
+ * Copyright (c) 2026      The University of Tennessee and The University
+ *                         of Tennessee Research Foundation.  All rights
+ *                         reserved.
+ */
+
+#include "parsec/parsec_config.h"
+#include "parsec/parsec_internal.h"
+#include "parsec/utils/debug.h"
+#include "parsec/data_internal.h"
+#include "parsec/checkpoint.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define PARSEC_CHECKPOINT_MAGIC "PaRSECck"
+
+typedef struct parsec_checkpoint_entry_s {
+    parsec_data_key_t key;
+    parsec_data_t    *data;
+    size_t            size;
+    off_t             offset;     /**< of the first slot, the second follows */
+    int               slot;       /**< slot of the last complete checkpoint, -1 if none */
+    int               saved;      /**< version below holds the snapshotted version */
+    uint32_t          version;
+} parsec_checkpoint_entry_t;
+
+/* Record of the manifest, one per data present in the checkpoint */
+typedef struct parsec_checkpoint_record_s {
+    uint64_t key;
+    uint64_t size;
+    uint32_t version;
+    int32_t  slot;
+} parsec_checkpoint_record_t;
+
+typedef struct parsec_checkpoint_header_s {
+    char     magic[8];
+    uint64_t epoch;
+    uint64_t count;
+} parsec_checkpoint_header_t;
+
+/* A snapshot waiting to be written by the I/O thread */
+typedef struct parsec_checkpoint_snapshot_s {
+    int   entry;
+    int   old_slot;
+    void *buffer;
+} parsec_checkpoint_snapshot_t;
+
+struct parsec_checkpoint_s {
+    parsec_data_collection_t  *dc;
+    char                      *data_file;
+    char                      *manifest_file;
+    int                        fd;
+
+    parsec_checkpoint_entry_t *entries;
+    int                        nb_entries;
+    int                        max_entries;
+    off_t                      file_size;
+    uint64_t                   epoch;
+
+    /* Work handed to the I/O thread: at most one checkpoint in flight */
+    pthread_t                  io_thread;
+    pthread_mutex_t            lock;
+    pthread_cond_t             cond;
+    parsec_checkpoint_snapshot_t *pending;
+    int                        nb_pending;
+    int                        busy;
+    int                        stop;
+    int                        status;
+};
+
+static int parsec_checkpoint_pwrite(int fd, const char *buf, size_t len, off_t offset)
+{
+    while( len > 0 ) {
+        ssize_t rc = pwrite(fd, buf, len, offset);
+        if( rc < 0 ) {
+            if( EINTR == errno ) continue;
+            return PARSEC_ERROR;
+        }
+        buf += rc; len -= rc; offset += rc;
+    }
+    return PARSEC_SUCCESS;
+}
+
+static int parsec_checkpoint_pread(int fd, char *buf, size_t len, off_t offset)
+{
+    while( len > 0 ) {
+        ssize_t rc = pread(fd, buf, len, offset);
+        if( rc < 0 ) {
+            if( EINTR == errno ) continue;
+            return PARSEC_ERROR;
+        }
+        if( 0 == rc ) return PARSEC_ERR_TRUNCATE;
+        buf += rc; len -= rc; offset += rc;
+    }
+    return PARSEC_SUCCESS;
+}
+
+/* Replace the manifest with the description of the current slots */
+static int parsec_checkpoint_write_manifest(parsec_checkpoint_t *ckpt)
+{
+    parsec_checkpoint_header_t header;
+    parsec_checkpoint_record_t *records;
+    size_t len = strlen(ckpt->manifest_file) + 5;
+    char *tmp = (char*)malloc(len);
+    int fd, rc = PARSEC_SUCCESS;
+    uint64_t count = 0;
+
+    records = (parsec_checkpoint_record_t*)malloc(sizeof(parsec_checkpoint_record_t) * (ckpt->nb_entries + 1));
+    for( int i = 0; i < ckpt->nb_entries; i++ ) {
+        parsec_checkpoint_entry_t *e = &ckpt->entries[i];
+        if( -1 == e->slot ) continue;
+        records[count].key     = e->key;
+        records[count].size    = e->size;
+        records[count].version = e->version;
+        records[count].slot    = e->slot;
+        count++;
+    }
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, PARSEC_CHECKPOINT_MAGIC, sizeof(header.magic));
+    header.epoch = ckpt->epoch;
+    header.count = count;
+
+    snprintf(tmp, len, "%s.tmp", ckpt->manifest_file);
+    fd = open(tmp, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if( (-1 == fd) ||
+        (PARSEC_SUCCESS != parsec_checkpoint_pwrite(fd, (char*)&header, sizeof(header), 0)) ||
+        (PARSEC_SUCCESS != parsec_checkpoint_pwrite(fd, (char*)records, sizeof(parsec_checkpoint_record_t) * count,
+                                                    sizeof(header))) ||
+        (0 != fsync(fd)) ) {
+        rc = PARSEC_ERROR;
+    }
+    if( -1 != fd ) close(fd);
+    if( (PARSEC_SUCCESS == rc) && (0 != rename(tmp, ckpt->manifest_file)) )
+        rc = PARSEC_ERROR;
+    free(records);
+    free(tmp);
+    return rc;
+}
+
+static void *parsec_checkpoint_io_thread(void *arg)
+{
+    parsec_checkpoint_t *ckpt = (parsec_checkpoint_t*)arg;
+
+    pthread_mutex_lock(&ckpt->lock);
+    while( 1 ) {
+        parsec_checkpoint_snapshot_t *pending;
+        int nb_pending, rc = PARSEC_SUCCESS;
+
+        while( !ckpt->stop && (NULL == ckpt->pending) )
+            pthread_cond_wait(&ckpt->cond, &ckpt->lock);
+        if( NULL == ckpt->pending ) break;  /* stopping with nothing left to write */
+        pending = ckpt->pending;
+        nb_pending = ckpt->nb_pending;
+        pthread_mutex_unlock(&ckpt->lock);
+
+        /* The entries only change when no checkpoint is in flight, so they
+         * can be read without the lock. */
+        for( int i = 0; i < nb_pending; i++ ) {
+            parsec_checkpoint_entry_t *e = &ckpt->entries[pending[i].entry];
+            int slot = (0 == e->slot) ? 1 : 0;
+            pending[i].old_slot = e->slot;
+            if( PARSEC_SUCCESS == rc )
+                rc = parsec_checkpoint_pwrite(ckpt->fd, pending[i].buffer, e->size,
+                                              e->offset + (off_t)slot * e->size);
+            free(pending[i].buffer);
+        }
+        if( (PARSEC_SUCCESS == rc) && (0 != fsync(ckpt->fd)) ) rc = PARSEC_ERROR;
+        if( PARSEC_SUCCESS == rc ) {
+            for( int i = 0; i < nb_pending; i++ ) {
+                parsec_checkpoint_entry_t *e = &ckpt->entries[pending[i].entry];
+                e->slot = (0 == e->slot) ? 1 : 0;
+            }
+            ckpt->epoch++;
+            rc = parsec_checkpoint_write_manifest(ckpt);
+            if( PARSEC_SUCCESS != rc ) {
+                /* the previous manifest still points to the other slots */
+                for( int i = 0; i < nb_pending; i++ )
+                    ckpt->entries[pending[i].entry].slot = pending[i].old_slot;
+                ckpt->epoch--;
+            }
+        }
+        if( PARSEC_SUCCESS != rc ) {
+            parsec_warning("Checkpoint %"PRIu64" to %s failed (%s)",
+                           ckpt->epoch, ckpt->data_file, strerror(errno));
+            /* snapshot them again next time */
+            for( int i = 0; i < nb_pending; i++ )
+                ckpt->entries[pending[i].entry].saved = 0;
+        }
+        free(pending);
+
+        pthread_mutex_lock(&ckpt->lock);
+        ckpt->pending = NULL;
+        ckpt->nb_pending = 0;
+        ckpt->busy = 0;
+        if( PARSEC_SUCCESS != rc ) ckpt->status = rc;
+        pthread_cond_broadcast(&ckpt->cond);
+    }
+    pthread_mutex_unlock(&ckpt->lock);
+    return NULL;
+}
+
+parsec_checkpoint_t *parsec_checkpoint_new(parsec_data_collection_t *dc,
+                                           const char *basename)
+{
+    parsec_checkpoint_t *ckpt;
+    size_t len = strlen(basename) + 32;
+
+    ckpt = (parsec_checkpoint_t*)calloc(1, sizeof(parsec_checkpoint_t));
+    ckpt->dc = dc;
+    ckpt->data_file = (char*)malloc(len);
+    ckpt->manifest_file = (char*)malloc(len);
+    snprintf(ckpt->data_file, len, "%s.%u.data", basename, dc->myrank);
+    snprintf(ckpt->manifest_file, len, "%s.%u.manifest", basename, dc->myrank);
+    ckpt->fd = open(ckpt->data_file, O_RDWR | O_CREAT, 0644);
+    if( -1 == ckpt->fd ) {
+        parsec_warning("The checkpoint file %s cannot be open (%s)", ckpt->data_file, strerror(errno));
+        free(ckpt->data_file); free(ckpt->manifest_file);
+        free(ckpt);
+        return NULL;
+    }
+    ckpt->status = PARSEC_SUCCESS;
+    pthread_mutex_init(&ckpt->lock, NULL);
+    pthread_cond_init(&ckpt->cond, NULL);
+    if( 0 != pthread_create(&ckpt->io_thread, NULL, parsec_checkpoint_io_thread, ckpt) ) {
+        parsec_warning("Cannot start the checkpoint I/O thread");
+        close(ckpt->fd);
+        pthread_mutex_destroy(&ckpt->lock);
+        pthread_cond_destroy(&ckpt->cond);
+        free(ckpt->data_file); free(ckpt->manifest_file);
+        free(ckpt);
+        return NULL;
+    }
+    return ckpt;
+}
+
+int parsec_checkpoint_add(parsec_checkpoint_t *ckpt, parsec_data_key_t key)
+{
+    parsec_checkpoint_entry_t *e;
+    parsec_data_t *data = ckpt->dc->data_of_key(ckpt->dc, key);
+
+    if( NULL == data ) return PARSEC_ERR_NOT_FOUND;
+    if( ckpt->nb_entries == ckpt->max_entries ) {
+        ckpt->max_entries = (0 == ckpt->max_entries) ? 64 : 2 * ckpt->max_entries;
+        ckpt->entries = (parsec_checkpoint_entry_t*)realloc(ckpt->entries,
+                                                            sizeof(parsec_checkpoint_entry_t) * ckpt->max_entries);
+    }
+    e = &ckpt->entries[ckpt->nb_entries++];
+    e->key     = key;
+    e->data    = data;
+    e->size    = data->nb_elts;
+    e->offset  = ckpt->file_size;
+    e->slot    = -1;
+    e->saved   = 0;
+    e->version = 0;
+    ckpt->file_size += 2 * (off_t)e->size;
+    return PARSEC_SUCCESS;
+}
+
+int parsec_checkpoint_wait(parsec_checkpoint_t *ckpt)
+{
+    int rc;
+
+    pthread_mutex_lock(&ckpt->lock);
+    while( ckpt->busy )
+        pthread_cond_wait(&ckpt->cond, &ckpt->lock);
+    rc = ckpt->status;
+    ckpt->status = PARSEC_SUCCESS;
+    pthread_mutex_unlock(&ckpt->lock);
+    return rc;
+}
+
+int parsec_checkpoint_take(parsec_checkpoint_t *ckpt)
+{
+    parsec_checkpoint_snapshot_t *pending;
+    int nb_pending = 0, rc;
+
+    rc = parsec_checkpoint_wait(ckpt);
+    if( PARSEC_SUCCESS != rc ) return rc;
+
+    /* Copy the modified data now, so that the next taskpool can update them
+     * while the I/O thread writes the copies. */
+    pending = (parsec_checkpoint_snapshot_t*)malloc(sizeof(parsec_checkpoint_snapshot_t) * (ckpt->nb_entries + 1));
+    for( int i = 0; i < ckpt->nb_entries; i++ ) {
+        parsec_checkpoint_entry_t *e = &ckpt->entries[i];
+        parsec_data_copy_t *copy = e->data->device_copies[0];
+
+        if( (NULL == copy) || (NULL == copy->device_private) ) continue;
+        if( e->saved && (copy->version == e->version) ) continue;
+        pending[nb_pending].entry = i;
+        pending[nb_pending].buffer = malloc(e->size);
+        memcpy(pending[nb_pending].buffer, copy->device_private, e->size);
+        e->version = copy->version;
+        e->saved = 1;
+        nb_pending++;
+    }
+    PARSEC_DEBUG_VERBOSE(10, parsec_debug_output, "Checkpoint of %s: %d of %d data modified",
+                         ckpt->data_file, nb_pending, ckpt->nb_entries);
+    if( 0 == nb_pending ) {
+        free(pending);
+        return 0;
+    }
+
+    pthread_mutex_lock(&ckpt->lock);
+    ckpt->pending = pending;
+    ckpt->nb_pending = nb_pending;
+    ckpt->busy = 1;
+    pthread_cond_signal(&ckpt->cond);
+    pthread_mutex_unlock(&ckpt->lock);
+    return nb_pending;
+}
+
+static int parsec_checkpoint_record_cmp(const void *a, const void *b)
+{
+    const parsec_checkpoint_record_t *ra = a, *rb = b;
+    return (ra->key < rb->key) ? -1 : (ra->key > rb->key);
+}
+
+int parsec_checkpoint_restore(parsec_checkpoint_t *ckpt)
+{
+    parsec_checkpoint_header_t header;
+    parsec_checkpoint_record_t *records = NULL;
+    int fd, rc, restored = 0;
+
+    rc = parsec_checkpoint_wait(ckpt);
+    if( PARSEC_SUCCESS != rc ) return rc;
+
+    fd = open(ckpt->manifest_file, O_RDONLY);
+    if( -1 == fd ) return PARSEC_ERR_NOT_FOUND;
+    rc = parsec_checkpoint_pread(fd, (char*)&header, sizeof(header), 0);
+    if( (PARSEC_SUCCESS == rc) &&
+        (0 != memcmp(header.magic, PARSEC_CHECKPOINT_MAGIC, sizeof(header.magic))) )
+        rc = PARSEC_ERR_BAD_PARAM;
+    if( PARSEC_SUCCESS == rc ) {
+        records = (parsec_checkpoint_record_t*)malloc(sizeof(parsec_checkpoint_record_t) * (header.count + 1));
+        rc = parsec_checkpoint_pread(fd, (char*)records, sizeof(parsec_checkpoint_record_t) * header.count,
+                                     sizeof(header));
+    }
+    close(fd);
+    if( PARSEC_SUCCESS != rc ) {
+        parsec_warning("The checkpoint manifest %s is corrupted", ckpt->manifest_file);
+        free(records);
+        return rc;
+    }
+    qsort(records, header.count, sizeof(parsec_checkpoint_record_t), parsec_checkpoint_record_cmp);
+
+    for( int i = 0; i < ckpt->nb_entries; i++ ) {
+        parsec_checkpoint_entry_t *e = &ckpt->entries[i];
+        parsec_checkpoint_record_t what = { .key = e->key }, *r;
+        parsec_data_copy_t *copy = e->data->device_copies[0];
+
+        r = bsearch(&what, records, header.count, sizeof(parsec_checkpoint_record_t),
+                    parsec_checkpoint_record_cmp);
+        if( (NULL == r) || (NULL == copy) || (r->size != e->size) ) continue;
+        rc = parsec_checkpoint_pread(ckpt->fd, copy->device_private, e->size,
+                                     e->offset + (off_t)r->slot * e->size);
+        if( PARSEC_SUCCESS != rc ) {
+            parsec_warning("Cannot restore data %"PRIu64" from %s", e->key, ckpt->data_file);
+            break;
+        }
+        copy->version = r->version;
+        e->version = r->version;
+        e->slot = r->slot;
+        e->saved = 1;
+        restored++;
+    }
+    ckpt->epoch = header.epoch;
+    free(records);
+    return (PARSEC_SUCCESS == rc) ? restored : rc;
+}
+
+void parsec_checkpoint_free(parsec_checkpoint_t *ckpt)
+{
+    pthread_mutex_lock(&ckpt->lock);
+    ckpt->stop = 1;
+    pthread_cond_broadcast(&ckpt->cond);
+    pthread_mutex_unlock(&ckpt->lock);
+    pthread_join(ckpt->io_thread, NULL);
+
+    close(ckpt->fd);
+    pthread_mutex_destroy(&ckpt->lock);
+    pthread_cond_destroy(&ckpt->cond);
+    free(ckpt->entries);
+    free(ckpt->data_file);
+    free(ckpt->manifest_file);
+    free(ckpt);
+}
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2026      The University of Tennessee and The University
+ *                         of Tennessee Research Foundation.  All rights
+ *                         reserved.
+ */
+
+#ifndef PARSEC_CHECKPOINT_H_HAS_BEEN_INCLUDED
+#define PARSEC_CHECKPOINT_H_HAS_BEEN_INCLUDED
+
+#include "parsec/data.h"
+#include "parsec/data_distribution.h"
+
+/** @defgroup parsec_public_checkpoint Checkpoint
+ *  @ingroup parsec_public
+ *    Incremental checkpoint and restart of the local data of a data
+ *    collection. Checkpoints are taken between taskpools: the data modified
+ *    since the previous checkpoint (detected through the version of their
+ *    host copy) are snapshotted, and written to disk by a background I/O
+ *    thread while the next taskpool runs.
+ *
+ *    Each process keeps two files, basename.<rank>.data with two slots per
+ *    registered data, and basename.<rank>.manifest describing the last
+ *    complete checkpoint. A data is always written in the slot not used by
+ *    the current manifest, and the manifest is replaced atomically once all
+ *    the data of a checkpoint are on disk, so a crash during a checkpoint
+ *    leaves the previous one usable.
+ *  @addtogroup parsec_public_checkpoint
+ *  @{
+ */
+
+BEGIN_C_DECLS
+
+typedef struct parsec_checkpoint_s parsec_checkpoint_t;
+
+/**
+ * Create a checkpoint context for the local data of dc. The files are named
+ * after basename and the rank of the process.
+ */
+parsec_checkpoint_t *parsec_checkpoint_new(parsec_data_collection_t *dc,
+                                           const char *basename);
+
+/**
+ * Register the local data of key in the checkpoint. All data must be
+ * registered, in the same order, before the first checkpoint or restart.
+ */
+int parsec_checkpoint_add(parsec_checkpoint_t *ckpt, parsec_data_key_t key);
+
+/**
+ * Snapshot the registered data modified since the last checkpoint and hand
+ * them to the I/O thread. Must be called when no taskpool modifies the
+ * collection. Waits for the previous checkpoint to be on disk first.
+ *
+ * @return the number of data snapshotted, or a negative error code.
+ */
+int parsec_checkpoint_take(parsec_checkpoint_t *ckpt);
+
+/**
+ * Wait until the last checkpoint is on disk.
+ *
+ * @return PARSEC_SUCCESS or the error met while writing it.
+ */
+int parsec_checkpoint_wait(parsec_checkpoint_t *ckpt);
+
+/**
+ * Load the last complete checkpoint into the registered data. Must be called
+ * when no taskpool uses the collection.
+ *
+ * @return the number of data restored, or a negative error code.
+ */
+int parsec_checkpoint_restore(parsec_checkpoint_t *ckpt);
+
+/**
+ * Wait for the pending checkpoint, stop the I/O thread and release the
+ * context. The files are kept.
+ */
+void parsec_checkpoint_free(parsec_checkpoint_t *ckpt);
+
+END_C_DECLS
+
+/** @} */
+
+#endif  /* PARSEC_CHECKPOINT_H_HAS_BEEN_INCLUDED */
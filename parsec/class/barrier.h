@@ -10,6 +10,7 @@
 #include "parsec/parsec_config.h"
 
 #include <unistd.h>
+#include <stdint.h>
 #include <pthread.h>
 
 /**
@@ -46,7 +47,46 @@ typedef pthread_barrier_t parsec_barrier_t;
 
 /**
  * @endcond
+ */
+#if defined(PARSEC_HAVE_LINUX_FUTEX_H)
+
+/** Number of threads (or child nodes) combined by each node of the barrier tree */
+#define PARSEC_BARRIER_FANIN 4
+
+/**
+ * @brief A node of the combining tree of a barrier. Nodes live on their own
+ *        cache line so that groups of threads arriving on different leaves
+ *        do not contend.
+ */
+typedef struct parsec_barrier_node_s {
+    int32_t          expected;   /**< Number of arrivals that complete this node */
+    volatile int32_t arrived;    /**< Arrivals in the current episode */
+    int32_t          parent;     /**< Index of the parent node, -1 for the root */
+    char             pad[64 - 3 * sizeof(int32_t)];
+} parsec_barrier_node_t;
+
+/**
+ * @brief A multithread barrier
  *
+ * @details Threads arrive on the leaves of a combining tree with a fan-in of
+ *          PARSEC_BARRIER_FANIN, the last arrival on a node moves up to its
+ *          parent, and the last arrival at the root releases everybody by
+ *          bumping the generation. Waiting threads spin shortly on the
+ *          generation, and then block on it with a futex.
+ */
+typedef struct parsec_barrier_t {
+    int                    count;       /**< Number of threads expected to enter the barrier */
+    int                    nb_leaves;   /**< Number of leaves, the first nodes of the tree */
+    int                    nb_nodes;    /**< Number of nodes, the root being the last one */
+    parsec_barrier_node_t *nodes;       /**< The combining tree */
+    volatile int32_t       generation;  /**< Unique number used to count how many times this
+                                         *   barrier was used, and futex word of the waiters */
+    volatile int32_t       sleepers;    /**< Number of threads blocked in the kernel */
+} parsec_barrier_t;
+
+#else
+
+/**
  * @brief A multithread barrier
  *
  * @details This structure is used to enable thread synchronization by
@@ -62,6 +102,8 @@ typedef struct parsec_barrier_t {
                                       *   passively once all threads have joined the barrier */
 } parsec_barrier_t;
 
+#endif  /* defined(PARSEC_HAVE_LINUX_FUTEX_H) */
+
 //Note how in the following API we return a posix error code, not a parsec one.
 
 /**
@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2026      The University of Tennessee and The University
+ *                         of Tennessee Research Foundation.  All rights
+ *                         reserved.
+ */
+
+#ifndef MPMC_RING_H_HAS_BEEN_INCLUDED
+#define MPMC_RING_H_HAS_BEEN_INCLUDED
+
+#include "parsec/parsec_config.h"
+#include "parsec/class/parsec_object.h"
+#include "parsec/constants.h"
+#include "parsec/sys/atomic.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @defgroup parsec_internal_classes_mpmc_ring Bounded MPMC ring
+ * @ingroup parsec_internal_classes
+ * @{
+ *
+ *  @brief Lock-free bounded multi-producer / multi-consumer FIFO of pointers
+ *
+ *  @details Each cell of the ring holds a sequence number telling which
+ *     position of the ring it is ready for: a cell is free for the producer
+ *     of position pos when its sequence is pos, and holds the element of
+ *     position pos for the consumers when its sequence is pos+1. Producers
+ *     and consumers claim positions by moving the tail and the head with a
+ *     compare-and-swap, and then publish the cell by updating its sequence,
+ *     so no operation ever waits on a lock. Consecutive positions can be
+ *     claimed with a single compare-and-swap by the batch operations.
+ *
+ *     The ring is bounded: pushing in a full ring fails, and the callers
+ *     are expected to handle the overflow.
+ */
+
+BEGIN_C_DECLS
+
+typedef struct parsec_mpmc_ring_cell_s {
+    volatile int64_t sequence;  /**< Position the cell is ready for */
+    void            *item;      /**< The element stored in the cell */
+} parsec_mpmc_ring_cell_t;
+
+/**
+ * @brief A bounded MPMC ring object
+ */
+typedef struct parsec_mpmc_ring_s {
+    parsec_object_t          super;
+    int64_t                  mask;      /**< Capacity - 1, the capacity is a power of 2 */
+    parsec_mpmc_ring_cell_t *cells;
+    char                     pad0[64];
+    volatile int64_t         head;      /**< Next position to pop */
+    char                     pad1[64];
+    volatile int64_t         tail;      /**< Next position to push */
+    char                     pad2[64];
+} parsec_mpmc_ring_t;
+
+PARSEC_DECLSPEC PARSEC_OBJ_CLASS_DECLARATION(parsec_mpmc_ring_t);
+
+/**
+ * @brief Allocate the cells of the ring
+ *
+ * @param[inout] ring the ring to initialize
+ * @param[in] capacity the minimal number of elements the ring holds, rounded
+ *            up to the next power of 2
+ * @return PARSEC_SUCCESS or PARSEC_ERR_OUT_OF_RESOURCE
+ *
+ * @remark this function is not thread safe
+ */
+int parsec_mpmc_ring_init(parsec_mpmc_ring_t *ring, size_t capacity);
+
+/**
+ * @brief Push up to nb elements at the tail of the ring
+ *
+ * @param[inout] ring the ring
+ * @param[in] items the elements to push, in order
+ * @param[in] nb the number of elements in items
+ * @return the number of elements pushed, the first ones of items. It is
+ *         only smaller than nb when the ring is full.
+ *
+ * @remark this function is thread safe
+ */
+static inline int
+parsec_mpmc_ring_push_batch( parsec_mpmc_ring_t *ring, void **items, int nb )
+{
+    parsec_mpmc_ring_cell_t *cell;
+    int64_t pos = ring->tail;
+    int k;
+
+    for(;;) {
+        /* count the free cells following the tail */
+        for( k = 0; k < nb; k++ ) {
+            if( ring->cells[(pos + k) & ring->mask].sequence != pos + k )
+                break;
+        }
+        if( 0 == k ) {
+            if( ring->cells[pos & ring->mask].sequence < pos )
+                return 0;  /* the ring is full */
+            pos = ring->tail;  /* somebody else took this position */
+            continue;
+        }
+        if( parsec_atomic_cas_int64(&ring->tail, pos, pos + k) )
+            break;
+        pos = ring->tail;
+    }
+    for( int i = 0; i < k; i++ ) {
+        cell = &ring->cells[(pos + i) & ring->mask];
+        cell->item = items[i];
+        parsec_atomic_wmb();
+        cell->sequence = pos + i + 1;
+    }
+    return k;
+}
+
+/**
+ * @brief Pop up to nb elements from the head of the ring
+ *
+ * @param[inout] ring the ring
+ * @param[out] items where to store the elements, in order
+ * @param[in] nb the maximal number of elements to pop
+ * @return the number of elements popped, 0 if the ring is empty
+ *
+ * @remark this function is thread safe
+ */
+static inline int
+parsec_mpmc_ring_pop_batch( parsec_mpmc_ring_t *ring, void **items, int nb )
+{
+    parsec_mpmc_ring_cell_t *cell;
+    int64_t pos = ring->head;
+    int k;
+
+    for(;;) {
+        /* count the published cells following the head */
+        for( k = 0; k < nb; k++ ) {
+            if( ring->cells[(pos + k) & ring->mask].sequence != pos + k + 1 )
+                break;
+        }
+        if( 0 == k ) {
+            if( ring->cells[pos & ring->mask].sequence < pos + 1 )
+                return 0;  /* the ring is empty */
+            pos = ring->head;  /* somebody else took this position */
+            continue;
+        }
+        if( parsec_atomic_cas_int64(&ring->head, pos, pos + k) )
+            break;
+        pos = ring->head;
+    }
+    parsec_atomic_rmb();
+    for( int i = 0; i < k; i++ )
+        items[i] = ring->cells[(pos + i) & ring->mask].item;
+    /* The items must be loaded before the cells are handed back to the
+     * producers: a store barrier does not order the earlier loads. */
+    parsec_mfence();
+    for( int i = 0; i < k; i++ ) {
+        cell = &ring->cells[(pos + i) & ring->mask];
+        cell->sequence = pos + i + ring->mask + 1;
+    }
+    return k;
+}
+
+/**
+ * @brief Push an element at the tail of the ring
+ *
+ * @return 1 if the element was pushed, 0 if the ring is full
+ *
+ * @remark this function is thread safe
+ */
+static inline int
+parsec_mpmc_ring_push( parsec_mpmc_ring_t *ring, void *item )
+{
+    return parsec_mpmc_ring_push_batch(ring, &item, 1);
+}
+
+/**
+ * @brief Pop the element at the head of the ring
+ *
+ * @return the element, or NULL if the ring is empty
+ *
+ * @remark this function is thread safe
+ */
+static inline void*
+parsec_mpmc_ring_pop( parsec_mpmc_ring_t *ring )
+{
+    void *item = NULL;
+    (void)parsec_mpmc_ring_pop_batch(ring, &item, 1);
+    return item;
+}
+
+/**
+ * @brief check if the ring is empty
+ *
+ * @return 1 if the ring was empty when checked, 0 otherwise
+ *
+ * @remark this function is thread safe, but the answer may be outdated
+ *         as soon as it is returned
+ */
+static inline int
+parsec_mpmc_ring_is_empty( parsec_mpmc_ring_t *ring )
+{
+    return ring->head >= ring->tail;
+}
+
+END_C_DECLS
+
+/** @} */
+
+#endif  /* MPMC_RING_H_HAS_BEEN_INCLUDED */
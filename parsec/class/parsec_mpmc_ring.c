@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2026      The University of Tennessee and The University
+ *                         of Tennessee Research Foundation.  All rights
+ *                         reserved.
+ */
+
+#include "parsec/parsec_config.h"
+#include "parsec/class/mpmc_ring.h"
+#include "parsec/constants.h"
+
+#include <stdlib.h>
+
+static void parsec_mpmc_ring_construct(parsec_mpmc_ring_t *ring)
+{
+    ring->mask  = -1;
+    ring->cells = NULL;
+    ring->head  = 0;
+    ring->tail  = 0;
+}
+
+static void parsec_mpmc_ring_destruct(parsec_mpmc_ring_t *ring)
+{
+    free(ring->cells);
+    ring->cells = NULL;
+    ring->mask  = -1;
+}
+
+PARSEC_OBJ_CLASS_INSTANCE(parsec_mpmc_ring_t, parsec_object_t,
+                          parsec_mpmc_ring_construct, parsec_mpmc_ring_destruct);
+
+int parsec_mpmc_ring_init(parsec_mpmc_ring_t *ring, size_t capacity)
+{
+    size_t size = 2;
+
+    while( size < capacity ) size <<= 1;
+    free(ring->cells);
+    if( 0 != posix_memalign((void**)&ring->cells, 64, size * sizeof(parsec_mpmc_ring_cell_t)) ) {
+        ring->cells = NULL;
+        ring->mask  = -1;
+        return PARSEC_ERR_OUT_OF_RESOURCE;
+    }
+    for( size_t i = 0; i < size; i++ ) {
+        ring->cells[i].sequence = (int64_t)i;
+        ring->cells[i].item     = NULL;
+    }
+    ring->mask = (int64_t)size - 1;
+    ring->head = 0;
+    ring->tail = 0;
+    return PARSEC_SUCCESS;
+}
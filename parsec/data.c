@@ -35,6 +35,7 @@ static void parsec_data_copy_construct(parsec_data_copy_t* obj)
     obj->dtt                  = PARSEC_DATATYPE_NULL;
     obj->alloc_cb             = NULL;
     obj->release_cb           = NULL;
+    obj->view_of              = NULL;
     PARSEC_DEBUG_VERBOSE(20, parsec_debug_output, "Allocate data copy %p", obj);
 }
 
@@ -58,6 +59,11 @@ static void parsec_data_copy_destruct(parsec_data_copy_t* obj)
     if (NULL != obj->release_cb) {
         obj->release_cb(obj, obj->device_index);
     }
+
+    if( obj->flags & PARSEC_DATA_FLAG_VIEW ) {
+        /* The view kept the copy owning the memory alive */
+        PARSEC_OBJ_RELEASE(obj->view_of);
+    }
 }
 
 PARSEC_OBJ_CLASS_INSTANCE(parsec_data_copy_t, parsec_list_item_t,
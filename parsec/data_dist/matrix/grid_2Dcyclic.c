@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009-2022 The University of Tennessee and The University
+ * Copyright (c) 2009-2026 The University of Tennessee and The University
  *                         of Tennessee Research Foundation.  All rights
  *                         reserved.
  */
@@ -10,6 +10,7 @@
 #include "parsec/data_dist/matrix/grid_2Dcyclic.h"
 #include "parsec/vpmap.h"
 #include "parsec/utils/debug.h"
+#include "parsec/remote_dep.h"
 
 #include <math.h>
 #include <assert.h>
@@ -36,12 +37,60 @@ void parsec_grid_2Dcyclic_init(parsec_grid_2Dcyclic_t *grid, int myrank, int P,
     grid->rloc = 0;
     grid->cloc = 0;
 
+    grid->hrows = 0;
+    grid->hcols = 0;
+
     /* VPMAP data distribution */
     /* TODO:: Users should be able to define it through parameters */
     grid->vp_q = default_vp_data_dist();
     grid->vp_p = vpmap_get_nb_vp()/default_vp_data_dist();
 }
 
+void parsec_grid_2Dcyclic_place_by_host(parsec_grid_2Dcyclic_t *grid)
+{
+    int P = grid->rows, Q = grid->cols, ranks_per_host, index, hsize;
+
+    if( !parsec_remote_dep_host_placement(P * Q, &ranks_per_host) )
+        return;
+
+    /* a tile is broadcast to the P-1 other processes of its column and the
+     * Q-1 of its row, of which hrows-1 and hcols-1 are on the same host:
+     * keep the shape maximizing hrows+hcols, the widest on a tie */
+    for( int hr = 1; hr <= ranks_per_host; hr++ ) {
+        int hc = ranks_per_host / hr;
+        if( (0 != ranks_per_host % hr) || (0 != P % hr) || (0 != Q % hc) ) continue;
+        if( (0 == grid->hrows) || ((hr + hc) > (grid->hrows + grid->hcols)) ||
+            (((hr + hc) == (grid->hrows + grid->hcols)) && (hc > grid->hcols)) ) {
+            grid->hrows = hr;
+            grid->hcols = hc;
+        }
+    }
+    if( 0 == grid->hrows ) {
+        /* no block of a host fits the grid, only follow the order by host */
+        grid->hrows = 1;
+        grid->hcols = 1;
+    }
+    /* the position of this process */
+    hsize = grid->hrows * grid->hcols;
+    index = parsec_remote_dep_host_index(grid->rank);
+    grid->rrank = ((index / hsize) / (Q / grid->hcols)) * grid->hrows + (index % hsize) / grid->hcols;
+    grid->crank = ((index / hsize) % (Q / grid->hcols)) * grid->hcols + (index % hsize) % grid->hcols;
+    grid->rrank = (grid->rrank + (P - grid->ip)) % P;
+    grid->crank = (grid->crank + (Q - grid->jq)) % Q;
+    assert(parsec_grid_2Dcyclic_rank(grid, (grid->rrank + grid->ip) % P, (grid->crank + grid->jq) % Q) == grid->rank);
+
+    parsec_debug_verbose(4, parsec_debug_output, "Process grid %dx%d placed by host in blocks of %dx%d, rank %d at (%d, %d)",
+                         P, Q, grid->hrows, grid->hcols, grid->rank, grid->rrank, grid->crank);
+}
+
+int parsec_grid_2Dcyclic_placed_rank(const parsec_grid_2Dcyclic_t *grid, int rr, int cr)
+{
+    int hsize = grid->hrows * grid->hcols;
+    int block = (rr / grid->hrows) * (grid->cols / grid->hcols) + cr / grid->hcols;
+
+    return parsec_remote_dep_host_rank(block * hsize + (rr % grid->hrows) * grid->hcols + cr % grid->hcols);
+}
+
 static
 int default_vp_data_dist()
 {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009-2022 The University of Tennessee and The University
+ * Copyright (c) 2009-2026 The University of Tennessee and The University
  *                         of Tennessee Research Foundation.  All rights
  *                         reserved.
  */
@@ -29,6 +29,8 @@ typedef struct parsec_grid_2Dcyclic {
     int cloc;       /**< number of column of tiles handled by this process - derived parameter */
     int vp_p;       /**< number of rows used for data distribution by the VP */
     int vp_q;       /**< number of cols used for data distribution by the VP */
+    int hrows;      /**< rows of the blocks of positions given to the processes of a host, 0 if the positions follow the ranks */
+    int hcols;      /**< cols of the blocks of positions given to the processes of a host */
 } parsec_grid_2Dcyclic_t;
 
 /************************************************
@@ -54,6 +56,33 @@ typedef struct parsec_grid_2Dcyclic {
  */
 void parsec_grid_2Dcyclic_init(parsec_grid_2Dcyclic_t* grid, int rank, int P, int Q, int kp, int kq, int ip, int jq);
 
+/**
+ * Place the processes of the same host on neighbouring positions of the
+ * process grid, when runtime_comm_host_placement is set and the grid spans
+ * all the processes. Must be called right after parsec_grid_2Dcyclic_init.
+ * The grid is cut in blocks of hrows x hcols positions, as many as the
+ * processes of a host, given in row major order to the hosts: with hcols=Q a
+ * host holds whole rows of the grid. The shape of the blocks minimizes the
+ * tiles sent between hosts by the broadcasts along the rows and columns. When
+ * the hosts have different numbers of processes, the positions follow the
+ * processes ordered by host.
+ * @param grid: the grid, already initialized
+ */
+void parsec_grid_2Dcyclic_place_by_host(parsec_grid_2Dcyclic_t* grid);
+
+/* Rank of the process placed at row rr and column cr of a grid placed by host */
+int parsec_grid_2Dcyclic_placed_rank(const parsec_grid_2Dcyclic_t* grid, int rr, int cr);
+
+/**
+ * Rank of the process at row rr and column cr of the process grid
+ */
+static inline int parsec_grid_2Dcyclic_rank(const parsec_grid_2Dcyclic_t* grid, int rr, int cr)
+{
+    if( 0 == grid->hrows )
+        return rr * grid->cols + cr;
+    return parsec_grid_2Dcyclic_placed_rank(grid, rr, cr);
+}
+
 /* include deprecated symbols */
 #include "parsec/data_dist/matrix/deprecated/grid_2Dcyclic.h"
 
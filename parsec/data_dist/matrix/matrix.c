@@ -309,7 +309,7 @@ int parsec_tiled_matrix_data_read(parsec_tiled_matrix_t *tdesc, char *filename)
     uint32_t myrank = tdesc->super.myrank;
     int eltsize =  parsec_datadist_getsizeoftype( tdesc->mtype );
 
-    tmpf = fopen(filename, "w");
+    tmpf = fopen(filename, "r");
     if(NULL == tmpf) {
         parsec_warning("The file %s cannot be open", filename);
         return -1;
@@ -134,6 +134,35 @@ int  parsec_tiled_matrix_data_write(parsec_tiled_matrix_t *tdesc, char *filename
 
 int  parsec_tiled_matrix_data_read(parsec_tiled_matrix_t *tdesc, char *filename);
 
+/**
+ * Backends of the parallel matrix I/O. Tiles are transferred concurrently by
+ * one task each, at fixed offsets of a self-describing file that does not
+ * depend on the distribution of the matrix.
+ */
+typedef enum parsec_matrix_io_mode_e {
+    PARSEC_MATRIX_IO_PREAD  = 0, /**< pread/pwrite through the page cache */
+    PARSEC_MATRIX_IO_DIRECT = 1, /**< pread/pwrite with O_DIRECT */
+    PARSEC_MATRIX_IO_MMAP   = 2  /**< memcpy in a shared mapping of the file */
+} parsec_matrix_io_mode_t;
+
+extern struct parsec_taskpool_s*
+parsec_tiled_matrix_io_write_New( parsec_tiled_matrix_t *A, const char *filename,
+                                  parsec_matrix_io_mode_t mode );
+
+extern struct parsec_taskpool_s*
+parsec_tiled_matrix_io_read_New( parsec_tiled_matrix_t *A, const char *filename,
+                                 parsec_matrix_io_mode_t mode );
+
+extern int parsec_tiled_matrix_io_Destruct( struct parsec_taskpool_s *tp );
+
+extern int
+parsec_tiled_matrix_io_write( parsec_context_t *parsec, parsec_tiled_matrix_t *A,
+                              const char *filename, parsec_matrix_io_mode_t mode );
+
+extern int
+parsec_tiled_matrix_io_read( parsec_context_t *parsec, parsec_tiled_matrix_t *A,
+                             const char *filename, parsec_matrix_io_mode_t mode );
+
 typedef int (*parsec_operator_t)( struct parsec_execution_stream_s *es,
                                   const void* src,
                                   void* dst,
@@ -22,6 +22,11 @@ size_t parsec_matrix_sym_block_cyclic_coord2pos(
     int m,
     int n);
 
+/* Moves one tile between the collection and the file, see matrix_io_wrapper.c */
+struct parsec_matrix_io_s;
+int parsec_matrix_io_tile(struct parsec_matrix_io_s *io,
+                          parsec_tiled_matrix_t *A,
+                          void *tile, int m, int n);
 
 END_C_DECLS
 
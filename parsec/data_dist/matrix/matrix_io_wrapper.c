@@ -0,0 +1,424 @@
+/*
+ * Copyright (c) 2026      The University of Tennessee and The University
+ *                         of Tennessee Research Foundation.  All rights
+ *                         reserved.
+ */
+/************************************************************
+ * Parallel tiled matrix I/O
+ *
+ * The file starts with a header block describing the matrix (type, sizes,
+ * tiling) followed by the tiles of the matrix in column-major tile order,
+ * each tile stored as a dense mb x nb column-major block. The layout does
+ * not depend on the data distribution: any process grid using the same
+ * tile size can read back a file written under another grid. Each local
+ * tile is moved by its own task, at its own offset in the file.
+ ************************************************************/
+
+#include "parsec/parsec_config.h"
+#include "parsec/parsec_internal.h"
+#include "parsec/utils/debug.h"
+#include "parsec/sys/atomic.h"
+#include "parsec/data_dist/matrix/matrix.h"
+#include "parsec/data_dist/matrix/matrix_internal.h"
+#include "matrix_io.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define PARSEC_MATRIX_IO_MAGIC   "PaRSECtm"
+#define PARSEC_MATRIX_IO_VERSION 1
+/* Size of the header block, and alignment of the tiles for O_DIRECT */
+#define PARSEC_MATRIX_IO_ALIGN   4096
+
+typedef struct parsec_matrix_io_header_s {
+    char     magic[8];
+    uint32_t version;
+    uint32_t mtype;
+    uint32_t eltsize;
+    uint32_t reserved;
+    int64_t  m, n;          /**< size of the matrix */
+    int64_t  mb, nb;        /**< size of a tile */
+    int64_t  mt, nt;        /**< number of tiles */
+    int64_t  tile_stride;   /**< bytes between two consecutive tiles */
+    int64_t  data_offset;   /**< offset of the first tile */
+} parsec_matrix_io_header_t;
+
+struct parsec_matrix_io_s {
+    int      fd;
+    int      mode;          /**< backend actually in use */
+    int      writing;
+    size_t   tile_size;     /**< bytes of data in a tile */
+    size_t   tile_stride;
+    off_t    data_offset;
+    char    *map;
+    size_t   map_size;
+    int32_t  status;        /**< first error met by a task */
+};
+
+static void parsec_matrix_io_error(struct parsec_matrix_io_s *io, int rc)
+{
+    parsec_atomic_cas_int32(&io->status, PARSEC_SUCCESS, rc);
+}
+
+static int parsec_matrix_io_pread_full(int fd, char *buf, size_t len, off_t offset)
+{
+    while( len > 0 ) {
+        ssize_t rc = pread(fd, buf, len, offset);
+        if( rc < 0 ) {
+            if( EINTR == errno ) continue;
+            return PARSEC_ERROR;
+        }
+        if( 0 == rc ) return PARSEC_ERR_TRUNCATE;
+        buf += rc; len -= rc; offset += rc;
+    }
+    return PARSEC_SUCCESS;
+}
+
+static int parsec_matrix_io_pwrite_full(int fd, const char *buf, size_t len, off_t offset)
+{
+    while( len > 0 ) {
+        ssize_t rc = pwrite(fd, buf, len, offset);
+        if( rc < 0 ) {
+            if( EINTR == errno ) continue;
+            return PARSEC_ERROR;
+        }
+        buf += rc; len -= rc; offset += rc;
+    }
+    return PARSEC_SUCCESS;
+}
+
+/*
+ * Copy between a tile of the collection and its dense mb x nb image. Tile
+ * storage is already dense; LAPACK storage is strided by the local leading
+ * dimension, and the border tiles only hold part of the block.
+ */
+static void parsec_matrix_io_tile_copy(const parsec_tiled_matrix_t *A, char *tile, char *dense,
+                                       int m, int n, int to_dense)
+{
+    size_t eltsize = parsec_datadist_getsizeoftype(A->mtype);
+    int gm = m + A->i / A->mb, gn = n + A->j / A->nb;
+    int rows = (A->lm - gm * A->mb) < A->mb ? (A->lm - gm * A->mb) : A->mb;
+    int cols = (A->ln - gn * A->nb) < A->nb ? (A->ln - gn * A->nb) : A->nb;
+
+    if( PARSEC_MATRIX_TILE == A->storage ) {
+        if( to_dense ) memcpy(dense, tile, A->bsiz * eltsize);
+        else           memcpy(tile, dense, A->bsiz * eltsize);
+        return;
+    }
+    if( to_dense ) memset(dense, 0, (size_t)A->mb * A->nb * eltsize);
+    for( int k = 0; k < cols; k++ ) {
+        char *col = tile + (size_t)k * A->llm * eltsize;
+        char *dcol = dense + (size_t)k * A->mb * eltsize;
+        if( to_dense ) memcpy(dcol, col, rows * eltsize);
+        else           memcpy(col, dcol, rows * eltsize);
+    }
+}
+
+int parsec_matrix_io_tile(struct parsec_matrix_io_s *io, parsec_tiled_matrix_t *A,
+                          void *tile, int m, int n)
+{
+    off_t offset = io->data_offset + ((off_t)n * A->mt + m) * (off_t)io->tile_stride;
+    char *bounce = NULL, *dense = (char*)tile;
+    size_t len = io->tile_size;
+    int rc = PARSEC_SUCCESS;
+
+    if( PARSEC_MATRIX_IO_MMAP == io->mode ) {
+        parsec_matrix_io_tile_copy(A, (char*)tile, io->map + offset, m, n, io->writing);
+        return PARSEC_SUCCESS;
+    }
+
+    if( PARSEC_MATRIX_IO_DIRECT == io->mode ) {
+        /* O_DIRECT wants aligned buffers, offsets and sizes */
+        len = io->tile_stride;
+        if( 0 != posix_memalign((void**)&bounce, PARSEC_MATRIX_IO_ALIGN, len) ) {
+            parsec_matrix_io_error(io, PARSEC_ERR_OUT_OF_RESOURCE);
+            return PARSEC_ERR_OUT_OF_RESOURCE;
+        }
+        if( io->writing ) memset(bounce + io->tile_size, 0, len - io->tile_size);
+    } else if( PARSEC_MATRIX_TILE != A->storage ) {
+        bounce = (char*)malloc(len);
+    }
+    if( NULL != bounce ) dense = bounce;
+
+    if( io->writing ) {
+        if( NULL != bounce ) parsec_matrix_io_tile_copy(A, (char*)tile, bounce, m, n, 1);
+        rc = parsec_matrix_io_pwrite_full(io->fd, dense, len, offset);
+    } else {
+        rc = parsec_matrix_io_pread_full(io->fd, dense, len, offset);
+        if( (PARSEC_SUCCESS == rc) && (NULL != bounce) )
+            parsec_matrix_io_tile_copy(A, (char*)tile, bounce, m, n, 0);
+    }
+    free(bounce);
+
+    if( PARSEC_SUCCESS != rc ) {
+        parsec_warning("Matrix I/O: %s of tile (%d, %d) failed (%s)",
+                       io->writing ? "write" : "read", m, n,
+                       PARSEC_ERR_TRUNCATE == rc ? "file too short" : strerror(errno));
+        parsec_matrix_io_error(io, rc);
+    }
+    return rc;
+}
+
+static void parsec_matrix_io_release(struct parsec_matrix_io_s *io)
+{
+    if( NULL != io->map ) munmap(io->map, io->map_size);
+    if( -1 != io->fd ) close(io->fd);
+    free(io);
+}
+
+static struct parsec_matrix_io_s *
+parsec_matrix_io_open(parsec_tiled_matrix_t *A, const char *filename, int mode, int writing)
+{
+    struct parsec_matrix_io_s *io;
+    parsec_matrix_io_header_t header;
+    size_t eltsize = parsec_datadist_getsizeoftype(A->mtype);
+    int flags = writing ? (O_RDWR | O_CREAT) : O_RDONLY;
+
+    io = (struct parsec_matrix_io_s*)calloc(1, sizeof(struct parsec_matrix_io_s));
+    io->fd = -1;
+    io->writing = writing;
+    io->status = PARSEC_SUCCESS;
+    io->mode = mode;
+    io->tile_size = (size_t)A->mb * A->nb * eltsize;
+
+#if defined(O_DIRECT)
+    if( PARSEC_MATRIX_IO_DIRECT == mode ) {
+        io->fd = open(filename, flags | O_DIRECT, 0644);
+        if( -1 == io->fd ) {
+            /* Not all file systems accept O_DIRECT */
+            parsec_debug_verbose(3, parsec_debug_output,
+                                 "Matrix I/O: O_DIRECT refused on %s (%s), using buffered I/O",
+                                 filename, strerror(errno));
+            io->mode = PARSEC_MATRIX_IO_PREAD;
+        }
+    }
+#else
+    if( PARSEC_MATRIX_IO_DIRECT == mode ) io->mode = PARSEC_MATRIX_IO_PREAD;
+#endif  /* defined(O_DIRECT) */
+    if( -1 == io->fd ) io->fd = open(filename, flags, 0644);
+    if( -1 == io->fd ) {
+        parsec_warning("The file %s cannot be open (%s)", filename, strerror(errno));
+        free(io);
+        return NULL;
+    }
+
+    if( writing ) {
+        io->tile_stride = io->tile_size;
+        if( PARSEC_MATRIX_IO_DIRECT == io->mode )
+            io->tile_stride = (io->tile_size + PARSEC_MATRIX_IO_ALIGN - 1) & ~((size_t)PARSEC_MATRIX_IO_ALIGN - 1);
+        io->data_offset = PARSEC_MATRIX_IO_ALIGN;
+
+        memset(&header, 0, sizeof(header));
+        memcpy(header.magic, PARSEC_MATRIX_IO_MAGIC, sizeof(header.magic));
+        header.version = PARSEC_MATRIX_IO_VERSION;
+        header.mtype   = A->mtype;
+        header.eltsize = eltsize;
+        header.m  = A->m;  header.n  = A->n;
+        header.mb = A->mb; header.nb = A->nb;
+        header.mt = A->mt; header.nt = A->nt;
+        header.tile_stride = io->tile_stride;
+        header.data_offset = io->data_offset;
+        io->map_size = io->data_offset + (size_t)A->mt * A->nt * io->tile_stride;
+
+        /* Every process writes the same header and sets the same size, so
+         * there is no need to synchronize them. Writing the header through
+         * a separate descriptor keeps O_DIRECT out of the way. */
+        {
+            char block[PARSEC_MATRIX_IO_ALIGN];
+            int hfd = open(filename, O_WRONLY);
+            memset(block, 0, sizeof(block));
+            memcpy(block, &header, sizeof(header));
+            if( (-1 == hfd) ||
+                (PARSEC_SUCCESS != parsec_matrix_io_pwrite_full(hfd, block, sizeof(block), 0)) ||
+                (0 != ftruncate(hfd, io->map_size)) ) {
+                parsec_warning("Matrix I/O: cannot prepare %s (%s)", filename, strerror(errno));
+                if( -1 != hfd ) close(hfd);
+                parsec_matrix_io_release(io);
+                return NULL;
+            }
+            close(hfd);
+        }
+    } else {
+        char block[PARSEC_MATRIX_IO_ALIGN];
+        int hfd = open(filename, O_RDONLY);
+        if( (-1 == hfd) ||
+            (PARSEC_SUCCESS != parsec_matrix_io_pread_full(hfd, block, sizeof(header), 0)) ) {
+            parsec_warning("Matrix I/O: cannot read the header of %s", filename);
+            if( -1 != hfd ) close(hfd);
+            parsec_matrix_io_release(io);
+            return NULL;
+        }
+        close(hfd);
+        memcpy(&header, block, sizeof(header));
+        if( (0 != memcmp(header.magic, PARSEC_MATRIX_IO_MAGIC, sizeof(header.magic))) ||
+            (PARSEC_MATRIX_IO_VERSION != header.version) ) {
+            parsec_warning("Matrix I/O: %s is not a PaRSEC matrix file", filename);
+            parsec_matrix_io_release(io);
+            return NULL;
+        }
+        if( (header.mtype != (uint32_t)A->mtype) ||
+            (header.m != A->m) || (header.n != A->n) ||
+            (header.mb != A->mb) || (header.nb != A->nb) ) {
+            parsec_warning("Matrix I/O: %s holds a %"PRId64"x%"PRId64" matrix of type %u in %"PRId64"x%"PRId64" tiles, "
+                           "which does not match the %dx%d matrix of type %d in %dx%d tiles",
+                           filename, header.m, header.n, header.mtype, header.mb, header.nb,
+                           A->m, A->n, A->mtype, A->mb, A->nb);
+            parsec_matrix_io_release(io);
+            return NULL;
+        }
+        io->tile_stride = header.tile_stride;
+        io->data_offset = header.data_offset;
+        io->map_size = io->data_offset + (size_t)A->mt * A->nt * io->tile_stride;
+        if( (PARSEC_MATRIX_IO_DIRECT == io->mode) &&
+            ((0 != (io->tile_stride % PARSEC_MATRIX_IO_ALIGN)) ||
+             (0 != (io->data_offset % PARSEC_MATRIX_IO_ALIGN))) ) {
+            /* The file was not written for O_DIRECT */
+            close(io->fd);
+            io->fd = open(filename, O_RDONLY);
+            io->mode = PARSEC_MATRIX_IO_PREAD;
+        }
+    }
+
+    if( PARSEC_MATRIX_IO_MMAP == io->mode ) {
+        io->map = mmap(NULL, io->map_size, writing ? (PROT_READ | PROT_WRITE) : PROT_READ,
+                       MAP_SHARED, io->fd, 0);
+        if( MAP_FAILED == io->map ) {
+            parsec_debug_verbose(3, parsec_debug_output,
+                                 "Matrix I/O: cannot map %s (%s), using buffered I/O",
+                                 filename, strerror(errno));
+            io->map = NULL;
+            io->mode = PARSEC_MATRIX_IO_PREAD;
+        }
+    }
+    return io;
+}
+
+static parsec_taskpool_t *
+parsec_tiled_matrix_io_New(parsec_tiled_matrix_t *A, const char *filename,
+                           parsec_matrix_io_mode_t mode, int writing)
+{
+    struct parsec_matrix_io_s *io;
+
+    if( (PARSEC_MATRIX_IO_PREAD != mode) && (PARSEC_MATRIX_IO_DIRECT != mode) &&
+        (PARSEC_MATRIX_IO_MMAP != mode) ) {
+        return NULL;
+    }
+    io = parsec_matrix_io_open(A, filename, mode, writing);
+    if( NULL == io ) return NULL;
+    return (parsec_taskpool_t*)parsec_matrix_io_new(A, io, writing);
+}
+
+/**
+ *******************************************************************************
+ * parsec_tiled_matrix_io_write_New - Generates a taskpool that stores the
+ * local tiles of A into filename, each tile being written by its own task.
+ *
+ * WARNING: The I/O are not done by this call.
+ *
+ * The taskpool only reads A, so it can be enqueued together with a following
+ * taskpool that also only reads A, and the writes will overlap with that
+ * computation.
+ *
+ *******************************************************************************
+ *
+ * @param[in] A
+ *          Descriptor of the distributed matrix to save.
+ *
+ * @param[in] filename
+ *          File shared by all processes. It is created if needed.
+ *
+ * @param[in] mode
+ *          PARSEC_MATRIX_IO_PREAD for pwrite at computed offsets,
+ *          PARSEC_MATRIX_IO_DIRECT to bypass the page cache with O_DIRECT,
+ *          PARSEC_MATRIX_IO_MMAP to copy the tiles in a shared mapping.
+ *          Backends the system refuses fall back to PARSEC_MATRIX_IO_PREAD.
+ *
+ *******************************************************************************
+ *
+ * @return
+ *          \retval NULL if the parameters are incorrect or the file cannot be
+ *          prepared.
+ *          \retval The parsec taskpool, to be destroyed with
+ *          parsec_tiled_matrix_io_Destruct().
+ *
+ ******************************************************************************/
+parsec_taskpool_t *
+parsec_tiled_matrix_io_write_New(parsec_tiled_matrix_t *A, const char *filename,
+                                 parsec_matrix_io_mode_t mode)
+{
+    return parsec_tiled_matrix_io_New(A, filename, mode, 1);
+}
+
+/**
+ *******************************************************************************
+ * parsec_tiled_matrix_io_read_New - Generates a taskpool that loads the local
+ * tiles of A from filename. The file may have been written under any process
+ * grid, but the type, the size and the tiling of the matrix must match.
+ *
+ * WARNING: The I/O are not done by this call.
+ *
+ * See parsec_tiled_matrix_io_write_New() for the parameters.
+ *
+ ******************************************************************************/
+parsec_taskpool_t *
+parsec_tiled_matrix_io_read_New(parsec_tiled_matrix_t *A, const char *filename,
+                                parsec_matrix_io_mode_t mode)
+{
+    return parsec_tiled_matrix_io_New(A, filename, mode, 0);
+}
+
+/**
+ *******************************************************************************
+ * parsec_tiled_matrix_io_Destruct - Close the file and free a taskpool
+ * created with parsec_tiled_matrix_io_write_New() or
+ * parsec_tiled_matrix_io_read_New().
+ *
+ * @return PARSEC_SUCCESS if all the local tiles were transferred, the error
+ *         of the first failed transfer otherwise.
+ *
+ ******************************************************************************/
+int
+parsec_tiled_matrix_io_Destruct(parsec_taskpool_t *tp)
+{
+    parsec_matrix_io_taskpool_t *iotp = (parsec_matrix_io_taskpool_t*)tp;
+    struct parsec_matrix_io_s *io = iotp->_g_io;
+    int rc = io->status;
+
+    parsec_matrix_io_release(io);
+    parsec_taskpool_free(tp);
+    return rc;
+}
+
+static int
+parsec_tiled_matrix_io(parsec_context_t *parsec, parsec_tiled_matrix_t *A,
+                       const char *filename, parsec_matrix_io_mode_t mode, int writing)
+{
+    parsec_taskpool_t *tp = parsec_tiled_matrix_io_New(A, filename, mode, writing);
+
+    if( NULL == tp ) return PARSEC_ERROR;
+    parsec_context_add_taskpool(parsec, tp);
+    parsec_context_start(parsec);
+    parsec_context_wait(parsec);
+    return parsec_tiled_matrix_io_Destruct(tp);
+}
+
+int
+parsec_tiled_matrix_io_write(parsec_context_t *parsec, parsec_tiled_matrix_t *A,
+                             const char *filename, parsec_matrix_io_mode_t mode)
+{
+    return parsec_tiled_matrix_io(parsec, A, filename, mode, 1);
+}
+
+int
+parsec_tiled_matrix_io_read(parsec_context_t *parsec, parsec_tiled_matrix_t *A,
+                            const char *filename, parsec_matrix_io_mode_t mode)
+{
+    return parsec_tiled_matrix_io(parsec, A, filename, mode, 0);
+}
@@ -0,0 +1,233 @@
+/*
+ * Copyright (c) 2026      The University of Tennessee and The University
+ *                         of Tennessee Research Foundation.  All rights
+ *                         reserved.
+ */
+
+#include "parsec/parsec_config.h"
+#include "parsec/parsec_internal.h"
+#include "parsec/utils/debug.h"
+#include "parsec/execution_stream.h"
+#include "parsec/mca/pins/pins.h"
+#include "parsec/os-spec-timing.h"
+#include "parsec/vpmap.h"
+#include "parsec/data_dist/matrix/redistribute/rebalance.h"
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(PARSEC_HAVE_MPI)
+#include <mpi.h>
+#endif
+
+typedef struct parsec_matrix_rebalance_stream_s {
+    parsec_pins_next_callback_t        begin_cb;
+    parsec_pins_next_callback_t        end_cb;
+    parsec_execution_stream_t         *es;
+    parsec_matrix_rebalance_monitor_t *monitor;
+    parsec_time_t                      start;
+} parsec_matrix_rebalance_stream_t;
+
+struct parsec_matrix_rebalance_monitor_s {
+    parsec_context_t                 *context;
+    parsec_tiled_matrix_t            *A;
+    int                               nb_tiles;
+    volatile int64_t                 *costs;     /**< time spent in the tasks of each local tile */
+    int                               nb_streams;
+    parsec_matrix_rebalance_stream_t *streams;
+};
+
+#if defined(PARSEC_PROF_PINS)
+static void rebalance_exec_begin(parsec_execution_stream_t *es, parsec_task_t *task,
+                                 parsec_pins_next_callback_t *cb_data)
+{
+    parsec_matrix_rebalance_stream_t *s = (parsec_matrix_rebalance_stream_t*)
+        ((char*)cb_data - offsetof(parsec_matrix_rebalance_stream_t, begin_cb));
+    s->start = take_time();
+    (void)es; (void)task;
+}
+
+static void rebalance_exec_end(parsec_execution_stream_t *es, parsec_task_t *task,
+                               parsec_pins_next_callback_t *cb_data)
+{
+    parsec_matrix_rebalance_stream_t *s = (parsec_matrix_rebalance_stream_t*)
+        ((char*)cb_data - offsetof(parsec_matrix_rebalance_stream_t, end_cb));
+    parsec_matrix_rebalance_monitor_t *monitor = s->monitor;
+    parsec_data_ref_t ref;
+
+    if( NULL == task->task_class->data_affinity ) return;
+    task->task_class->data_affinity(task, &ref);
+    if( (ref.dc != &monitor->A->super) || (ref.key >= (parsec_data_key_t)monitor->nb_tiles) )
+        return;
+    parsec_atomic_fetch_add_int64(&monitor->costs[ref.key], (int64_t)diff_time(s->start, take_time()));
+    (void)es;
+}
+#endif  /* defined(PARSEC_PROF_PINS) */
+
+parsec_matrix_rebalance_monitor_t *
+parsec_matrix_rebalance_monitor_start(parsec_context_t *parsec, parsec_tiled_matrix_t *A)
+{
+#if defined(PARSEC_PROF_PINS)
+    parsec_matrix_rebalance_monitor_t *monitor;
+    int v, t, s = 0;
+
+    monitor = (parsec_matrix_rebalance_monitor_t*)calloc(1, sizeof(parsec_matrix_rebalance_monitor_t));
+    monitor->context  = parsec;
+    monitor->A        = A;
+    monitor->nb_tiles = A->lmt * A->lnt;
+    monitor->costs    = (volatile int64_t*)calloc(monitor->nb_tiles, sizeof(int64_t));
+    for( v = 0; v < parsec->nb_vp; v++ )
+        monitor->nb_streams += parsec->virtual_processes[v]->nb_cores;
+    monitor->streams = (parsec_matrix_rebalance_stream_t*)calloc(monitor->nb_streams,
+                                                                 sizeof(parsec_matrix_rebalance_stream_t));
+    for( v = 0; v < parsec->nb_vp; v++ ) {
+        for( t = 0; t < parsec->virtual_processes[v]->nb_cores; t++, s++ ) {
+            parsec_execution_stream_t *es = parsec->virtual_processes[v]->execution_streams[t];
+            monitor->streams[s].es = es;
+            monitor->streams[s].monitor = monitor;
+            PARSEC_PINS_REGISTER(es, EXEC_BEGIN, rebalance_exec_begin, &monitor->streams[s].begin_cb);
+            PARSEC_PINS_REGISTER(es, EXEC_END, rebalance_exec_end, &monitor->streams[s].end_cb);
+        }
+    }
+    return monitor;
+#else
+    parsec_warning("The task times cannot be measured for load balancing: PaRSEC was built without PINS");
+    (void)parsec; (void)A;
+    return NULL;
+#endif  /* defined(PARSEC_PROF_PINS) */
+}
+
+int parsec_matrix_rebalance_monitor_stop(parsec_matrix_rebalance_monitor_t *monitor, double *costs)
+{
+    int64_t *local;
+
+    if( NULL == monitor ) return PARSEC_ERR_BAD_PARAM;
+#if defined(PARSEC_PROF_PINS)
+    for( int s = 0; s < monitor->nb_streams; s++ ) {
+        parsec_pins_next_callback_t *cb_data;
+        PARSEC_PINS_UNREGISTER(monitor->streams[s].es, EXEC_END, rebalance_exec_end, &cb_data);
+        PARSEC_PINS_UNREGISTER(monitor->streams[s].es, EXEC_BEGIN, rebalance_exec_begin, &cb_data);
+    }
+#endif  /* defined(PARSEC_PROF_PINS) */
+
+    local = (int64_t*)monitor->costs;
+#if defined(DISTRIBUTED) && defined(PARSEC_HAVE_MPI)
+    {
+        int mpi_is_on;
+        MPI_Initialized(&mpi_is_on);
+        if( mpi_is_on && (monitor->A->super.nodes > 1) ) {
+            MPI_Allreduce(MPI_IN_PLACE, local, monitor->nb_tiles, MPI_INT64_T, MPI_SUM,
+                          (MPI_Comm)monitor->context->comm_ctx);
+        }
+    }
+#endif  /* defined(DISTRIBUTED) && defined(PARSEC_HAVE_MPI) */
+    for( int k = 0; k < monitor->nb_tiles; k++ )
+        costs[k] = (double)local[k];
+
+    free(local);
+    free(monitor->streams);
+    free(monitor);
+    return PARSEC_SUCCESS;
+}
+
+int parsec_matrix_rebalance_table(parsec_tiled_matrix_t *A, const double *costs,
+                                  double tolerance, int max_moves,
+                                  parsec_two_dim_td_table_t **ptable)
+{
+    parsec_data_collection_t *dc = &A->super;
+    int nodes = dc->nodes, nb_tiles = A->lmt * A->lnt;
+    int moves = 0, nb_local = 0, nbvp = vpmap_get_nb_vp();
+    parsec_two_dim_td_table_t *table;
+    double *load, total = 0.0, before;
+    int m, n, k, r;
+
+    if( (0 != A->i) || (0 != A->j) || (A->mt != A->lmt) || (A->nt != A->lnt) ) {
+        parsec_warning("Load balancing is only supported on whole matrices");
+        return PARSEC_ERR_BAD_PARAM;
+    }
+    if( max_moves < 0 ) max_moves = nb_tiles;
+
+    table = (parsec_two_dim_td_table_t*)malloc( sizeof(parsec_two_dim_td_table_t)
+                                                + (nb_tiles-1)*sizeof(parsec_two_dim_td_table_elem_t) );
+    table->nbelem = nb_tiles;
+    load = (double*)calloc(nodes, sizeof(double));
+    for( n = 0; n < A->lnt; n++ ) {
+        for( m = 0; m < A->lmt; m++ ) {
+            k = n * A->lmt + m;
+            table->elems[k].rank = dc->rank_of(dc, m, n);
+            load[table->elems[k].rank] += costs[k];
+            total += costs[k];
+        }
+    }
+
+    /* Move tiles from the most loaded process to the least loaded one. A
+     * move is only done when it lowers the load of the most loaded process,
+     * and the tile chosen is the one leaving the two processes the closest to
+     * each other. Every move decreases the sum of the squares of the loads,
+     * and the choices only depend on the costs, so all processes build the
+     * same table. */
+    before = 0.0;
+    for( r = 0; r < nodes; r++ ) if( load[r] > before ) before = load[r];
+    while( moves < max_moves ) {
+        int hi = 0, lo = 0, best = -1;
+        double gap, best_dist = 0.0;
+
+        for( r = 1; r < nodes; r++ ) {
+            if( load[r] > load[hi] ) hi = r;
+            if( load[r] < load[lo] ) lo = r;
+        }
+        if( load[hi] <= (1.0 + tolerance) * (total / nodes) ) break;
+        gap = load[hi] - load[lo];
+        for( k = 0; k < nb_tiles; k++ ) {
+            double dist;
+            if( ((int)table->elems[k].rank != hi) || (costs[k] <= 0.0) || (costs[k] >= gap) )
+                continue;
+            dist = costs[k] - gap / 2.0;
+            if( dist < 0.0 ) dist = -dist;
+            if( (-1 == best) || (dist < best_dist) ) {
+                best = k;
+                best_dist = dist;
+            }
+        }
+        if( -1 == best ) break;  /* no single move lowers the makespan */
+        table->elems[best].rank = lo;
+        load[hi] -= costs[best];
+        load[lo] += costs[best];
+        moves++;
+    }
+
+    for( k = 0; k < nb_tiles; k++ ) {
+        table->elems[k].vpid = -1;
+        if( table->elems[k].rank == dc->myrank )
+            table->elems[k].vpid = (nb_local++) % nbvp;
+    }
+
+    if( 0 == dc->myrank ) {
+        double after = 0.0;
+        for( r = 0; r < nodes; r++ ) if( load[r] > after ) after = load[r];
+        parsec_debug_verbose(3, parsec_debug_output,
+                             "Load balancing: %d tiles moved, makespan %g -> %g (average load %g)",
+                             moves, before, after, total / nodes);
+    }
+    free(load);
+    *ptable = table;
+    return moves;
+}
+
+int parsec_matrix_rebalance(parsec_context_t *parsec, parsec_tiled_matrix_t *A,
+                            const double *costs, double tolerance, int max_moves,
+                            parsec_matrix_tabular_t *B)
+{
+    parsec_two_dim_td_table_t *table;
+    int moves, rc;
+
+    moves = parsec_matrix_rebalance_table(A, costs, tolerance, max_moves, &table);
+    if( moves < 0 ) return moves;
+
+    parsec_matrix_tabular_init(B, A->mtype, A->super.nodes, A->super.myrank,
+                               A->mb, A->nb, A->lm, A->ln, 0, 0, A->m, A->n, table);
+    rc = parsec_redistribute(parsec, A, &B->super, A->m, A->n, 0, 0, 0, 0);
+    if( PARSEC_SUCCESS != rc ) return rc;
+    return moves;
+}
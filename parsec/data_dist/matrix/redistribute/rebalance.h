@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2026      The University of Tennessee and The University
+ *                         of Tennessee Research Foundation.  All rights
+ *                         reserved.
+ */
+#ifndef __PARSEC_MATRIX_REBALANCE_H__
+#define __PARSEC_MATRIX_REBALANCE_H__
+
+#include "parsec/data_dist/matrix/matrix.h"
+#include "parsec/data_dist/matrix/two_dim_tabular.h"
+
+BEGIN_C_DECLS
+
+/**
+ * @brief Load balancing of a tiled matrix from measured task times
+ *
+ * @details The cost of a tile is the time spent executing the tasks whose
+ * affinity is that tile. From these costs, a new tabular distribution is
+ * computed by moving tiles away from the most loaded process until the
+ * expected makespan is within a tolerance of the average load, or no move
+ * improves it, or the budget of moved tiles is exhausted. Only the tiles
+ * that change owner are transferred, by the redistribute taskpool.
+ *
+ * Typical use in an iterative solver:
+ *   monitor = parsec_matrix_rebalance_monitor_start(parsec, A);
+ *   ... run some iterations on A ...
+ *   parsec_matrix_rebalance_monitor_stop(monitor, costs);
+ *   parsec_matrix_rebalance(parsec, A, costs, 0.05, -1, &B);
+ *   ... continue on B ...
+ */
+
+typedef struct parsec_matrix_rebalance_monitor_s parsec_matrix_rebalance_monitor_t;
+
+/**
+ * @brief Start measuring the time spent in the tasks of each tile of A
+ *
+ * The measures rely on the PINS EXEC_BEGIN and EXEC_END events of all the
+ * execution streams of the context. Must be called while no taskpool is
+ * running on the context.
+ *
+ * @return the monitor, or NULL if the runtime was built without PINS.
+ */
+parsec_matrix_rebalance_monitor_t *
+parsec_matrix_rebalance_monitor_start(parsec_context_t *parsec, parsec_tiled_matrix_t *A);
+
+/**
+ * @brief Stop a monitor and gather the costs of all the tiles
+ *
+ * Collective over the processes of A. Must be called while no taskpool is
+ * running on the context.
+ *
+ * @param[in] monitor the monitor, released by this call
+ * @param[out] costs array of A->lmt * A->lnt elements receiving the time
+ *             spent on each tile (tile (m, n) at index n * lmt + m) by all
+ *             the processes, in the unit of the parsec timers
+ * @return PARSEC_SUCCESS
+ */
+int parsec_matrix_rebalance_monitor_stop(parsec_matrix_rebalance_monitor_t *monitor, double *costs);
+
+/**
+ * @brief Compute a tabular distribution balancing the costs of the tiles
+ *
+ * The computation is deterministic: given the same costs, all the processes
+ * compute the same table.
+ *
+ * @param[in] A the current distribution, the whole matrix (no submatrix)
+ * @param[in] costs cost of each tile, as returned by the monitor
+ * @param[in] tolerance stop when the most loaded process is within
+ *            (1 + tolerance) of the average load
+ * @param[in] max_moves maximal number of tiles changing owner, -1 for no
+ *            limit
+ * @param[out] table the new table, to give to parsec_matrix_tabular_init()
+ * @return the number of moved tiles, or PARSEC_ERR_BAD_PARAM.
+ */
+int parsec_matrix_rebalance_table(parsec_tiled_matrix_t *A, const double *costs,
+                                  double tolerance, int max_moves,
+                                  parsec_two_dim_td_table_t **table);
+
+/**
+ * @brief Balance the costs of the tiles of A and migrate them to B
+ *
+ * Computes the table with parsec_matrix_rebalance_table(), initializes B as
+ * a tabular distribution of the same matrix, and moves the data with
+ * parsec_redistribute(), with the same restrictions on the data type.
+ *
+ * @param[out] B the new distribution, to destroy with
+ *             parsec_matrix_tabular_destroy()
+ * @return the number of moved tiles, or an error code.
+ */
+int parsec_matrix_rebalance(parsec_context_t *parsec, parsec_tiled_matrix_t *A,
+                            const double *costs, double tolerance, int max_moves,
+                            parsec_matrix_tabular_t *B);
+
+END_C_DECLS
+
+#endif /* __PARSEC_MATRIX_REBALANCE_H__ */
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2026      The University of Tennessee and The University
+ *                         of Tennessee Research Foundation.  All rights
+ *                         reserved.
+ */
+
+#include "parsec/parsec_config.h"
+#include "parsec/parsec_internal.h"
+#include "parsec/utils/debug.h"
+#include "parsec/arena.h"
+#include "parsec/data_dist/matrix/matrix.h"
+#include "parsec/data_dist/matrix/two_dim_rectangle_cyclic_replicated.h"
+#include "replicated_reduce.h"
+
+static void
+__parsec_replicated_reduce_destructor(parsec_replicated_reduce_taskpool_t *tp)
+{
+    parsec_type_free(&tp->arenas_datatypes[PARSEC_replicated_reduce_DEFAULT_ADT_IDX].opaque_dtt);
+}
+
+PARSEC_OBJ_CLASS_INSTANCE(parsec_replicated_reduce_taskpool_t, parsec_taskpool_t,
+                          NULL, __parsec_replicated_reduce_destructor);
+
+/**
+ *******************************************************************************
+ * parsec_matrix_block_cyclic_replicated_reduce_New - Generates a taskpool
+ * folding the c replicas of each tile of dc into the replica of layer 0:
+ *
+ *    A(m, n, 0) = op( A(m, n, c-1), ... op( A(m, n, 1), A(m, n, 0) ) )
+ *
+ * WARNING: The computations are not done by this call.
+ *
+ *******************************************************************************
+ *
+ * @param[in,out] dc
+ *          Descriptor of the replicated matrix.
+ *
+ * @param[in] op
+ *          Binary operator accumulating the tile src in the tile dst, called
+ *          as op(es, src, dst, op_data, m, n).
+ *
+ * @param[in] op_data
+ *          Arguments given to each call to the operator.
+ *
+ * @param[in] broadcast
+ *          If not 0, the folded tiles are copied back in the replicas of all
+ *          the layers. Otherwise the replicas of the layers above 0 are left
+ *          with partial results.
+ *
+ *******************************************************************************
+ *
+ * @return
+ *          \retval NULL if the matrix type is unknown or the storage is not
+ *          the tile storage.
+ *          \retval The parsec taskpool describing the operation.
+ *
+ ******************************************************************************/
+parsec_taskpool_t *
+parsec_matrix_block_cyclic_replicated_reduce_New(parsec_matrix_block_cyclic_replicated_t *dc,
+                                                 parsec_operator_t op,
+                                                 void *op_data,
+                                                 int broadcast)
+{
+    parsec_tiled_matrix_t *A = &dc->super.super;
+    parsec_replicated_reduce_taskpool_t *tp;
+    parsec_datatype_t oldtype, newtype;
+    ptrdiff_t lb, extent;
+
+    if( PARSEC_MATRIX_TILE != A->storage ) {
+        parsec_debug_verbose(3, parsec_debug_output, "Replicated reduce only supports the tile storage.");
+        return NULL;
+    }
+    if( PARSEC_SUCCESS != parsec_translate_matrix_type(A->mtype, &oldtype) ) {
+        parsec_debug_verbose(3, parsec_debug_output, "Unknown matrix type %d.", A->mtype );
+        return NULL;
+    }
+
+    tp = parsec_replicated_reduce_new(&dc->layers, op, op_data,
+                                      A->mt, A->nt, dc->nb_layers, broadcast);
+
+    parsec_type_create_contiguous(A->mb*A->nb, oldtype, &newtype);
+    parsec_type_extent(newtype, &lb, &extent);
+    parsec_arena_datatype_construct(&tp->arenas_datatypes[PARSEC_replicated_reduce_DEFAULT_ADT_IDX],
+                                    extent,
+                                    PARSEC_ARENA_ALIGNMENT_SSE,
+                                    newtype);
+    return (parsec_taskpool_t*)tp;
+}
+
+void
+parsec_matrix_block_cyclic_replicated_reduce_Destruct(parsec_taskpool_t *tp)
+{
+    parsec_taskpool_free(tp);
+}
+
+int
+parsec_matrix_block_cyclic_replicated_reduce(parsec_context_t *parsec,
+                                             parsec_matrix_block_cyclic_replicated_t *dc,
+                                             parsec_operator_t op,
+                                             void *op_data,
+                                             int broadcast)
+{
+    parsec_taskpool_t *tp;
+
+    tp = parsec_matrix_block_cyclic_replicated_reduce_New(dc, op, op_data, broadcast);
+    if( NULL == tp ) return PARSEC_ERROR;
+
+    parsec_context_add_taskpool(parsec, tp);
+    parsec_context_start(parsec);
+    parsec_context_wait(parsec);
+    parsec_matrix_block_cyclic_replicated_reduce_Destruct(tp);
+    return PARSEC_SUCCESS;
+}
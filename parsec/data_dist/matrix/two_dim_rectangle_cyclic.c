@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009-2023 The University of Tennessee and The University
+ * Copyright (c) 2009-2026 The University of Tennessee and The University
  *                         of Tennessee Research Foundation.  All rights
  *                         reserved.
  */
@@ -134,6 +134,7 @@ void parsec_matrix_block_cyclic_init(parsec_matrix_block_cyclic_t * dc,
 #else
     parsec_grid_2Dcyclic_init(&dc->grid, myrank, P, Q, 1, 1, ip, jq);
 #endif /* PARSEC_KCYCLIC_WITH_VIEW */
+    parsec_grid_2Dcyclic_place_by_host(&dc->grid);
 
     if(storage == PARSEC_MATRIX_LAPACK) {
         tdesc->slm = tdesc->sln = 0;
@@ -280,7 +281,7 @@ static uint32_t twoDBC_rank_of(parsec_data_collection_t * desc, ...)
     /* P(rr, cr) has the tile, compute the mpi rank*/
     rr = (m % dc->grid.rows + dc->grid.ip) % dc->grid.rows;
     cr = (n % dc->grid.cols + dc->grid.jq) % dc->grid.cols;
-    res = rr * dc->grid.cols + cr;
+    res = parsec_grid_2Dcyclic_rank(&dc->grid, rr, cr);
 
     return res;
 }
@@ -559,7 +560,7 @@ static uint32_t twoDBC_kcyclic_rank_of(parsec_data_collection_t * desc, ...)
     /* P(rr, cr) has the tile, compute the mpi rank*/
     rr = (str % dc->grid.rows + dc->grid.ip) % dc->grid.rows;
     cr = (stc % dc->grid.cols + dc->grid.jq) % dc->grid.cols;
-    res = rr * dc->grid.cols + cr;
+    res = parsec_grid_2Dcyclic_rank(&dc->grid, rr, cr);
 
     /* printf("tile (%d, %d) belongs to process %d [%d,%d] in a grid of %dx%d\n", */
     /*            m, n, res, rr, cr, dc->grid.rows, dc->grid.cols); */
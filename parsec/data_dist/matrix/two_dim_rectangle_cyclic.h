@@ -36,6 +36,8 @@ typedef struct parsec_matrix_block_cyclic {
  *   |---------------|
  *   | 4 | 5 | 6 | 7 |
  *   -----------------
+ *   With runtime_comm_host_placement, the processes of the same host take
+ *   neighbouring positions instead (see parsec_grid_2Dcyclic_place_by_host).
  ************************************************/
 
 // #define A(m,n) &((double*)descA.mat)[descA.bsiz*(m)+descA.bsiz*descA.lmt*(n)]
@@ -0,0 +1,256 @@
+/*
+ * Copyright (c) 2026      The University of Tennessee and The University
+ *                         of Tennessee Research Foundation.  All rights
+ *                         reserved.
+ */
+
+#include "parsec/parsec_config.h"
+#include "parsec/parsec_internal.h"
+#include "parsec/utils/debug.h"
+#include "parsec/data_dist/matrix/matrix.h"
+#include "parsec/data_dist/matrix/two_dim_rectangle_cyclic_replicated.h"
+#include "parsec/data_dist/matrix/matrix_internal.h"
+
+#include <stddef.h>
+
+#define REPLICATED_OF_LAYERS(d) \
+    ((parsec_matrix_block_cyclic_replicated_t*)((char*)(d) - offsetof(parsec_matrix_block_cyclic_replicated_t, layers)))
+
+/*
+ * Rank of the owner of tile (m, n) inside the grid of a layer. Only depends
+ * on the fields of the block cyclic distribution, so that the submatrices
+ * created by parsec_tiled_matrix_submatrix() keep working.
+ */
+static inline uint32_t twoDBC_replicated_grid_rank(parsec_matrix_block_cyclic_t *dc, int m, int n)
+{
+    int rr, cr;
+
+    /* Offset by (i,j) to translate (m,n) in the global matrix */
+    m += dc->super.i / dc->super.mb;
+    n += dc->super.j / dc->super.nb;
+
+    rr = (m % dc->grid.rows + dc->grid.ip) % dc->grid.rows;
+    cr = (n % dc->grid.cols + dc->grid.jq) % dc->grid.cols;
+    return parsec_grid_2Dcyclic_rank(&dc->grid, rr, cr);
+}
+
+/* First rank of the layer of the local process */
+static inline uint32_t twoDBC_replicated_layer_base(parsec_matrix_block_cyclic_t *dc)
+{
+    uint32_t layer_size = dc->grid.rows * dc->grid.cols;
+    return (dc->super.super.myrank / layer_size) * layer_size;
+}
+
+static uint32_t twoDBC_replicated_rank_of(parsec_data_collection_t *desc, ...)
+{
+    parsec_matrix_block_cyclic_t *dc = (parsec_matrix_block_cyclic_t *)desc;
+    int m, n;
+    va_list ap;
+
+    va_start(ap, desc);
+    m = va_arg(ap, unsigned int);
+    n = va_arg(ap, unsigned int);
+    va_end(ap);
+
+    assert( m < dc->super.mt );
+    assert( n < dc->super.nt );
+
+    return twoDBC_replicated_layer_base(dc) + twoDBC_replicated_grid_rank(dc, m, n);
+}
+
+static uint32_t twoDBC_replicated_rank_of_key(parsec_data_collection_t *desc, parsec_data_key_t key)
+{
+    int m, n;
+    parsec_matrix_block_cyclic_key2coords(desc, key, &m, &n);
+    return twoDBC_replicated_rank_of(desc, m, n);
+}
+
+/*
+ * The (m, n, layer) view. The keys of the replicas of layer l follow the
+ * keys of the replicas of layer l-1, and the local replicas are the tiles of
+ * the 2-D collection.
+ */
+static parsec_data_key_t twoDBC_layers_data_key(parsec_data_collection_t *desc, ...)
+{
+    parsec_matrix_block_cyclic_replicated_t *dc = REPLICATED_OF_LAYERS(desc);
+    parsec_tiled_matrix_t *tdesc = &dc->super.super;
+    int m, n, l;
+    va_list ap;
+
+    va_start(ap, desc);
+    m = va_arg(ap, unsigned int);
+    n = va_arg(ap, unsigned int);
+    l = va_arg(ap, unsigned int);
+    va_end(ap);
+
+    m += tdesc->i / tdesc->mb;
+    n += tdesc->j / tdesc->nb;
+    return ((parsec_data_key_t)l * tdesc->lmt * tdesc->lnt) + (n * tdesc->lmt) + m;
+}
+
+static void twoDBC_layers_key2coords(parsec_matrix_block_cyclic_replicated_t *dc, parsec_data_key_t key,
+                                     int *m, int *n, int *l)
+{
+    parsec_tiled_matrix_t *tdesc = &dc->super.super;
+    parsec_data_key_t layer_keys = (parsec_data_key_t)tdesc->lmt * tdesc->lnt;
+
+    *l = key / layer_keys;
+    parsec_matrix_block_cyclic_key2coords(&tdesc->super, key % layer_keys, m, n);
+}
+
+static uint32_t twoDBC_layers_rank_of(parsec_data_collection_t *desc, ...)
+{
+    parsec_matrix_block_cyclic_replicated_t *dc = REPLICATED_OF_LAYERS(desc);
+    int m, n, l;
+    va_list ap;
+
+    va_start(ap, desc);
+    m = va_arg(ap, unsigned int);
+    n = va_arg(ap, unsigned int);
+    l = va_arg(ap, unsigned int);
+    va_end(ap);
+
+    return parsec_matrix_block_cyclic_replicated_rank_of_layer(dc, m, n, l);
+}
+
+static uint32_t twoDBC_layers_rank_of_key(parsec_data_collection_t *desc, parsec_data_key_t key)
+{
+    int m, n, l;
+    twoDBC_layers_key2coords(REPLICATED_OF_LAYERS(desc), key, &m, &n, &l);
+    return twoDBC_layers_rank_of(desc, m, n, l);
+}
+
+static int32_t twoDBC_layers_vpid_of(parsec_data_collection_t *desc, ...)
+{
+    parsec_matrix_block_cyclic_replicated_t *dc = REPLICATED_OF_LAYERS(desc);
+    parsec_data_collection_t *o = &dc->super.super.super;
+    int m, n, l;
+    va_list ap;
+
+    va_start(ap, desc);
+    m = va_arg(ap, unsigned int);
+    n = va_arg(ap, unsigned int);
+    l = va_arg(ap, unsigned int);
+    va_end(ap);
+
+    assert( l == dc->layer ); (void)l;
+    return o->vpid_of(o, m, n);
+}
+
+static int32_t twoDBC_layers_vpid_of_key(parsec_data_collection_t *desc, parsec_data_key_t key)
+{
+    int m, n, l;
+    twoDBC_layers_key2coords(REPLICATED_OF_LAYERS(desc), key, &m, &n, &l);
+    return twoDBC_layers_vpid_of(desc, m, n, l);
+}
+
+static parsec_data_t* twoDBC_layers_data_of(parsec_data_collection_t *desc, ...)
+{
+    parsec_matrix_block_cyclic_replicated_t *dc = REPLICATED_OF_LAYERS(desc);
+    parsec_data_collection_t *o = &dc->super.super.super;
+    int m, n, l;
+    va_list ap;
+
+    va_start(ap, desc);
+    m = va_arg(ap, unsigned int);
+    n = va_arg(ap, unsigned int);
+    l = va_arg(ap, unsigned int);
+    va_end(ap);
+
+    /* Only the replicas of the local layer are stored here */
+    assert( l == dc->layer ); (void)l;
+    return o->data_of(o, m, n);
+}
+
+static parsec_data_t* twoDBC_layers_data_of_key(parsec_data_collection_t *desc, parsec_data_key_t key)
+{
+    int m, n, l;
+    twoDBC_layers_key2coords(REPLICATED_OF_LAYERS(desc), key, &m, &n, &l);
+    return twoDBC_layers_data_of(desc, m, n, l);
+}
+
+static int twoDBC_layers_key_to_string(parsec_data_collection_t *desc, parsec_data_key_t key,
+                                       char *buffer, uint32_t buffer_size)
+{
+    parsec_matrix_block_cyclic_replicated_t *dc = REPLICATED_OF_LAYERS(desc);
+    parsec_tiled_matrix_t *tdesc = &dc->super.super;
+    parsec_data_key_t layer_keys = (parsec_data_key_t)tdesc->lmt * tdesc->lnt;
+    int res;
+
+    res = snprintf(buffer, buffer_size, "(%u, %u, %u)",
+                   (unsigned int)((key % layer_keys) % tdesc->lmt),
+                   (unsigned int)((key % layer_keys) / tdesc->lmt),
+                   (unsigned int)(key / layer_keys));
+    if( res < 0 ) {
+        parsec_warning("Wrong key_to_string for replicated tile key: %u", key);
+    }
+    return res;
+}
+
+uint32_t parsec_matrix_block_cyclic_replicated_rank_of_layer(parsec_matrix_block_cyclic_replicated_t *dc,
+                                                             int m, int n, int layer)
+{
+    assert( (layer >= 0) && (layer < dc->nb_layers) );
+    return (uint32_t)layer * dc->super.grid.rows * dc->super.grid.cols
+        + twoDBC_replicated_grid_rank(&dc->super, m, n);
+}
+
+void parsec_matrix_block_cyclic_replicated_init(parsec_matrix_block_cyclic_replicated_t *dc,
+                                                parsec_matrix_type_t mtype,
+                                                parsec_matrix_storage_t storage,
+                                                int myrank,
+                                                int mb, int nb,   /* Tile size */
+                                                int lm, int ln,   /* Global matrix size (what is stored)*/
+                                                int i,  int j,    /* Staring point in the global matrix */
+                                                int m,  int n,    /* Submatrix size (the one concerned by the computation */
+                                                int P,  int Q,    /* process grid of each layer */
+                                                int c)            /* number of layers */
+{
+    parsec_data_collection_t *o = &(dc->super.super.super);
+    parsec_tiled_matrix_t *tdesc = &(dc->super.super);
+    int layer_size = P * Q;
+
+    assert( c >= 1 );
+    assert( myrank < layer_size * c );
+
+    /* Each layer is a regular block cyclic distribution, in which the local
+     * process has the position it has in its own layer */
+    parsec_matrix_block_cyclic_init(&dc->super, mtype, storage, myrank % layer_size,
+                                    mb, nb, lm, ln, i, j, m, n,
+                                    P, Q, 1, 1, 0, 0);
+    dc->nb_layers = c;
+    dc->layer = myrank / layer_size;
+
+    /* The collection spans all the layers: only the ownership changes, the
+     * local tiles, their position and their vpid are those of the layer. */
+    o->nodes = layer_size * c;
+    o->myrank = myrank;
+    o->rank_of = twoDBC_replicated_rank_of;
+    o->rank_of_key = twoDBC_replicated_rank_of_key;
+
+    parsec_data_collection_init(&dc->layers, layer_size * c, myrank);
+    dc->layers.data_key      = twoDBC_layers_data_key;
+    dc->layers.rank_of       = twoDBC_layers_rank_of;
+    dc->layers.rank_of_key   = twoDBC_layers_rank_of_key;
+    dc->layers.vpid_of       = twoDBC_layers_vpid_of;
+    dc->layers.vpid_of_key   = twoDBC_layers_vpid_of_key;
+    dc->layers.data_of       = twoDBC_layers_data_of;
+    dc->layers.data_of_key   = twoDBC_layers_data_of_key;
+    dc->layers.key_to_string = twoDBC_layers_key_to_string;
+    dc->layers.default_dtt   = o->default_dtt;
+    if( asprintf(&(dc->layers.key_dim), "(%d, %d, %d)", tdesc->lmt, tdesc->lnt, c) <= 0 ) {
+        dc->layers.key_dim = NULL;
+    }
+
+    PARSEC_DEBUG_VERBOSE(20, parsec_debug_output, "parsec_matrix_block_cyclic_replicated_init: \n"
+           "      dc = %p, nodes = %u, myrank = %d, P = %d, Q = %d, layers = %d, layer = %d, nb_local_tile = %d",
+           dc, o->nodes, myrank, P, Q, c, dc->layer, tdesc->nb_local_tiles);
+}
+
+void parsec_matrix_block_cyclic_replicated_destroy(parsec_matrix_block_cyclic_replicated_t *dc)
+{
+    if( NULL != dc->layers.key_dim ) free(dc->layers.key_dim);
+    dc->layers.key_dim = NULL;
+    parsec_data_collection_destroy(&dc->layers);
+    parsec_tiled_matrix_destroy(&dc->super.super);
+}
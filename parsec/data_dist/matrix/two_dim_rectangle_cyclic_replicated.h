@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2026      The University of Tennessee and The University
+ *                         of Tennessee Research Foundation.  All rights
+ *                         reserved.
+ */
+#ifndef __TWO_DIM_RECTANGLE_CYCLIC_REPLICATED_H__
+#define __TWO_DIM_RECTANGLE_CYCLIC_REPLICATED_H__
+
+#include "parsec/data_dist/matrix/matrix.h"
+#include "parsec/data_dist/matrix/two_dim_rectangle_cyclic.h"
+
+BEGIN_C_DECLS
+
+/*******************************************************************
+ * 2.5D distribution: a 2-D block cyclic distribution replicated on
+ * several layers of processes
+ *******************************************************************/
+
+/************************************************
+ *   mpi ranks distribution for PxQ=2x2 and c=2 layers
+ *   layer 0          layer 1
+ *   ---------        ---------
+ *   | 0 | 1 |        | 4 | 5 |
+ *   |-------|        |-------|
+ *   | 2 | 3 |        | 6 | 7 |
+ *   ---------        ---------
+ *   Tile (m, n) has one replica per layer, owned by the process at the
+ *   same position of the PxQ grid in each layer.
+ ************************************************/
+
+typedef struct parsec_matrix_block_cyclic_replicated {
+    parsec_matrix_block_cyclic_t super;   /**< distribution of the tiles inside a layer, holds the local replicas */
+    parsec_data_collection_t     layers;  /**< view of all the replicas, indexed by (m, n, layer) */
+    int nb_layers;                        /**< number of layers, i.e. of replicas of each tile */
+    int layer;                            /**< layer of the local process */
+} parsec_matrix_block_cyclic_replicated_t;
+
+/**
+ * Initialize the description of a 2-D block cyclic distributed matrix
+ * replicated on c layers of p x q processes, for a total of p*q*c processes.
+ * Process r belongs to layer r / (p*q), and holds the replicas of the tiles
+ * given to position r % (p*q) of the p x q grid.
+ *
+ * The collection itself answers for the layer of the caller: rank_of(m, n)
+ * returns the owner of the replica in the local layer, and data_of(m, n) the
+ * local replica. An algorithm using the collection as a regular 2-D matrix is
+ * thus executed independently in each layer, without any communication
+ * between layers; each layer usually works on its own part of the
+ * computation (e.g. a slice of the k loop of a GEMM), and the partial results
+ * are then folded together with
+ * parsec_matrix_block_cyclic_replicated_reduce().
+ *
+ * The layers member addresses a given replica with a third index:
+ * layers.rank_of(&layers, m, n, l) is the owner of the replica of layer l.
+ *
+ * @param dc matrix description structure, already allocated, that will be initialize
+ * @param mtype type of data used for this matrix
+ * @param storage type of storage of data
+ * @param myrank rank of the local node (as of mpi rank)
+ * @param mb, nb tile size
+ * @param lm, ln size of the entire matrix
+ * @param i, j starting point of the submatrix concerned by the computation
+ * @param m, n size of the submatrix
+ * @param p, q process grid of each layer
+ * @param c number of layers, p*q*c must be the number of nodes
+ */
+void parsec_matrix_block_cyclic_replicated_init(parsec_matrix_block_cyclic_replicated_t *dc,
+                                                parsec_matrix_type_t mtype,
+                                                parsec_matrix_storage_t storage,
+                                                int myrank,
+                                                int mb, int nb,   /* Tile size */
+                                                int lm, int ln,   /* Global matrix size (what is stored)*/
+                                                int i,  int j,    /* Staring point in the global matrix */
+                                                int m,  int n,    /* Submatrix size (the one concerned by the computation */
+                                                int p,  int q,    /* process grid of each layer */
+                                                int c);           /* number of layers */
+
+void parsec_matrix_block_cyclic_replicated_destroy(parsec_matrix_block_cyclic_replicated_t *dc);
+
+/**
+ * Rank of the owner of the replica of tile (m, n) in layer.
+ */
+uint32_t parsec_matrix_block_cyclic_replicated_rank_of_layer(parsec_matrix_block_cyclic_replicated_t *dc,
+                                                             int m, int n, int layer);
+
+/**
+ * Generates a taskpool folding the replicas of each tile into the replica of
+ * layer 0, with replica(0) = op(replica(c-1), ... op(replica(1), replica(0))).
+ * The operator is called as op(es, src, dst, op_data, m, n) and must
+ * accumulate src into dst. The replicas of the other layers are used as
+ * accumulators of the partial results, unless broadcast is set, in which
+ * case they all receive the final result.
+ *
+ * The matrix must use tile storage.
+ *
+ * @return the parsec taskpool, or NULL if the matrix type is unknown or the
+ *         storage is not supported.
+ */
+extern struct parsec_taskpool_s*
+parsec_matrix_block_cyclic_replicated_reduce_New(parsec_matrix_block_cyclic_replicated_t *dc,
+                                                 parsec_operator_t op,
+                                                 void *op_data,
+                                                 int broadcast);
+
+extern void
+parsec_matrix_block_cyclic_replicated_reduce_Destruct(struct parsec_taskpool_s *tp);
+
+/**
+ * Blocking version of parsec_matrix_block_cyclic_replicated_reduce_New().
+ */
+extern int
+parsec_matrix_block_cyclic_replicated_reduce(parsec_context_t *parsec,
+                                             parsec_matrix_block_cyclic_replicated_t *dc,
+                                             parsec_operator_t op,
+                                             void *op_data,
+                                             int broadcast);
+
+END_C_DECLS
+
+#endif /* __TWO_DIM_RECTANGLE_CYCLIC_REPLICATED_H__ */
@@ -79,6 +79,9 @@ struct parsec_data_copy_s {
     parsec_datatype_t            dtt;                /**< the appropriate type for the network engine to send an element */
     parsec_data_copy_alloc_cb   *alloc_cb;           /**< callback to allocate data copy memory */
     parsec_data_copy_release_cb *release_cb;         /**< callback to release data copy memory */
+    struct parsec_data_copy_s   *view_of;            /**< For PARSEC_DATA_FLAG_VIEW copies, the copy owning the
+                                                      *   memory. The view shares its device_private, and dtt
+                                                      *   describes the strided subset of that memory it exposes. */
 };
 
 #define PARSEC_DATA_CREATE_ON_DEMAND ((parsec_data_copy_t*)(intptr_t)(-1))
@@ -123,6 +123,34 @@ int parsec_type_match(parsec_datatype_t dtt1,
  * @return PARSEC_SUCCESS if it was created with MPI_Type_contiguous, PARSEC_ERROR otherwise.
  */
 int parsec_type_contiguous(parsec_datatype_t dtt);
+
+/**
+ * Native pack engine. The datatype is flattened once into the list of its
+ * contiguous blocks, which is then used to pack count elements from inbuf
+ * into outbuf at position (updated on return), producing the same stream
+ * as MPI_Pack on homogeneous systems.
+ * @return PARSEC_SUCCESS, PARSEC_ERR_NOT_SUPPORTED if the datatype can not
+ * be handled natively, or PARSEC_ERR_VALUE_OUT_OF_BOUNDS if the buffer is too
+ * small.
+ */
+int parsec_type_pack(const void *inbuf, int incount, parsec_datatype_t type,
+                     void *outbuf, int outsize, int *position);
+/**
+ * Unpack outcount elements of type from inbuf at position (updated on
+ * return) into outbuf. Counterpart of parsec_type_pack, same return codes.
+ */
+int parsec_type_unpack(const void *inbuf, int insize, int *position,
+                       void *outbuf, int outcount, parsec_datatype_t type);
+/**
+ * Exact size of incount elements of type packed by parsec_type_pack.
+ */
+int parsec_type_pack_size(int incount, parsec_datatype_t type, int *size);
+/**
+ * Size of the basic elements of type: the size of the predefined datatype
+ * it is built upon, or the greatest common divisor of the sizes of the
+ * predefined datatypes for heterogeneous types.
+ */
+int parsec_type_element_size(parsec_datatype_t type, size_t *size);
 END_C_DECLS
 
 /** @} */
@@ -150,3 +150,29 @@ int parsec_type_contiguous(parsec_datatype_t dtt)
     (void)dtt;
     return PARSEC_SUCCESS;
 }
+
+int parsec_type_pack(const void *inbuf, int incount, parsec_datatype_t type,
+                     void *outbuf, int outsize, int *position)
+{
+    (void)inbuf; (void)incount; (void)type; (void)outbuf; (void)outsize; (void)position;
+    return PARSEC_ERR_NOT_SUPPORTED;
+}
+
+int parsec_type_unpack(const void *inbuf, int insize, int *position,
+                       void *outbuf, int outcount, parsec_datatype_t type)
+{
+    (void)inbuf; (void)insize; (void)position; (void)outbuf; (void)outcount; (void)type;
+    return PARSEC_ERR_NOT_SUPPORTED;
+}
+
+int parsec_type_pack_size(int incount, parsec_datatype_t type, int *size)
+{
+    (void)incount; (void)type; (void)size;
+    return PARSEC_ERR_NOT_SUPPORTED;
+}
+
+int parsec_type_element_size(parsec_datatype_t type, size_t *size)
+{
+    (void)type; (void)size;
+    return PARSEC_ERR_NOT_SUPPORTED;
+}
@@ -0,0 +1,324 @@
+/*
+ * Copyright (c) 2026      The University of Tennessee and The University
+ *                         of Tennessee Research Foundation.  All rights
+ *                         reserved.
+ */
+
+#include "parsec/parsec_config.h"
+#include "parsec/datatype.h"
+#include "parsec/sys/atomic.h"
+#include "parsec/utils/debug.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#if !defined(PARSEC_HAVE_MPI)
+#error __FILE__ should only be used when MPI support is enabled.
+#endif  /* !defined(PARSEC_HAVE_MPI) */
+
+/**
+ * Native pack/unpack engine for the datatypes built by the parsec_type_create_*
+ * constructors.
+ *
+ * The first time a datatype is packed, its type map is flattened into a
+ * program: the list of the contiguous blocks (displacement and length in
+ * bytes) of one element, with the adjacent blocks merged. The program is
+ * cached as an attribute of the datatype, and released with it. Packing
+ * count elements then only walks the program with memcpy, which is what
+ * MPI_Pack produces on homogeneous systems.
+ *
+ * Vector, hvector, indexed, hindexed, indexed_block, hindexed_block,
+ * contiguous, struct, resized and dup datatypes on top of predefined types
+ * are supported. Anything else (or a type map with too many blocks) is
+ * reported as PARSEC_ERR_NOT_SUPPORTED so the caller can fall back to MPI.
+ */
+
+#define PARSEC_TYPE_PROGRAM_MAX_BLOCKS  (1 << 20)
+
+typedef struct parsec_type_block_s {
+    ptrdiff_t disp;
+    size_t    len;
+} parsec_type_block_t;
+
+typedef struct parsec_type_program_s {
+    int                  supported;  /**< 0 if the datatype can not be flattened */
+    int                  nb_blocks;
+    int                  max_blocks;
+    size_t               size;       /**< bytes of data in one element */
+    size_t               elem;       /**< gcd of the sizes of the predefined types */
+    ptrdiff_t            extent;     /**< distance between two consecutive elements */
+    parsec_type_block_t *blocks;
+} parsec_type_program_t;
+
+static int parsec_type_program_keyval = MPI_KEYVAL_INVALID;
+static parsec_atomic_lock_t parsec_type_program_lock = PARSEC_ATOMIC_UNLOCKED;
+
+static int
+parsec_type_program_delete(MPI_Datatype type, int keyval, void *attr, void *extra)
+{
+    parsec_type_program_t *prog = (parsec_type_program_t*)attr;
+    free(prog->blocks);
+    free(prog);
+    (void)type; (void)keyval; (void)extra;
+    return MPI_SUCCESS;
+}
+
+static int
+parsec_type_program_append(parsec_type_program_t *prog, ptrdiff_t disp, size_t len)
+{
+    if( 0 == len ) return PARSEC_SUCCESS;
+    if( prog->nb_blocks > 0 ) {
+        parsec_type_block_t *last = &prog->blocks[prog->nb_blocks-1];
+        if( (last->disp + (ptrdiff_t)last->len) == disp ) {
+            last->len += len;
+            return PARSEC_SUCCESS;
+        }
+    }
+    if( prog->nb_blocks == prog->max_blocks ) {
+        if( prog->max_blocks >= PARSEC_TYPE_PROGRAM_MAX_BLOCKS )
+            return PARSEC_ERR_NOT_SUPPORTED;
+        prog->max_blocks = (0 == prog->max_blocks) ? 16 : 2 * prog->max_blocks;
+        prog->blocks = (parsec_type_block_t*)realloc(prog->blocks, prog->max_blocks * sizeof(parsec_type_block_t));
+        if( NULL == prog->blocks ) return PARSEC_ERR_OUT_OF_RESOURCE;
+    }
+    prog->blocks[prog->nb_blocks].disp = disp;
+    prog->blocks[prog->nb_blocks].len  = len;
+    prog->nb_blocks++;
+    return PARSEC_SUCCESS;
+}
+
+/* Append to the program count consecutive elements of type starting at base */
+static int
+parsec_type_program_flatten(parsec_type_program_t *prog, MPI_Datatype type,
+                            ptrdiff_t base, int count)
+{
+    int nb_ints, nb_addrs, nb_types, combiner, rc = PARSEC_SUCCESS, i, j;
+    int *ints = NULL;
+    MPI_Aint *addrs = NULL, lb, extent, old_lb, old_extent;
+    MPI_Datatype *types = NULL;
+
+    MPI_Type_get_envelope(type, &nb_ints, &nb_addrs, &nb_types, &combiner);
+    MPI_Type_get_extent(type, &lb, &extent);
+    if( MPI_COMBINER_NAMED == combiner ) {
+        int size;
+        MPI_Type_size(type, &size);
+        for( size_t a = prog->elem, b = (size_t)size; ; ) {  /* gcd */
+            if( 0 == b ) { prog->elem = a; break; }
+            size_t t = a % b; a = b; b = t;
+        }
+        return parsec_type_program_append(prog, base, (size_t)size * count);
+    }
+
+    ints  = (int*)malloc(sizeof(int) * (nb_ints + 1));
+    addrs = (MPI_Aint*)malloc(sizeof(MPI_Aint) * (nb_addrs + 1));
+    types = (MPI_Datatype*)malloc(sizeof(MPI_Datatype) * (nb_types + 1));
+    MPI_Type_get_contents(type, nb_ints, nb_addrs, nb_types, ints, addrs, types);
+    MPI_Type_get_extent(types[0], &old_lb, &old_extent);
+
+    for( int e = 0; (e < count) && (PARSEC_SUCCESS == rc); e++, base += extent ) {
+        switch( combiner ) {
+        case MPI_COMBINER_DUP:
+        case MPI_COMBINER_RESIZED:
+            /* the repetition uses the extent of the new type, the content is unchanged */
+            rc = parsec_type_program_flatten(prog, types[0], base, 1);
+            break;
+        case MPI_COMBINER_CONTIGUOUS:
+            rc = parsec_type_program_flatten(prog, types[0], base, ints[0]);
+            break;
+        case MPI_COMBINER_VECTOR:
+            for( i = 0; (i < ints[0]) && (PARSEC_SUCCESS == rc); i++ )
+                rc = parsec_type_program_flatten(prog, types[0], base + (ptrdiff_t)i * ints[2] * old_extent, ints[1]);
+            break;
+        case MPI_COMBINER_HVECTOR:
+            for( i = 0; (i < ints[0]) && (PARSEC_SUCCESS == rc); i++ )
+                rc = parsec_type_program_flatten(prog, types[0], base + (ptrdiff_t)i * addrs[0], ints[1]);
+            break;
+        case MPI_COMBINER_INDEXED:
+            for( i = 0; (i < ints[0]) && (PARSEC_SUCCESS == rc); i++ )
+                rc = parsec_type_program_flatten(prog, types[0], base + (ptrdiff_t)ints[1 + ints[0] + i] * old_extent, ints[1 + i]);
+            break;
+        case MPI_COMBINER_HINDEXED:
+            for( i = 0; (i < ints[0]) && (PARSEC_SUCCESS == rc); i++ )
+                rc = parsec_type_program_flatten(prog, types[0], base + addrs[i], ints[1 + i]);
+            break;
+        case MPI_COMBINER_INDEXED_BLOCK:
+            for( i = 0; (i < ints[0]) && (PARSEC_SUCCESS == rc); i++ )
+                rc = parsec_type_program_flatten(prog, types[0], base + (ptrdiff_t)ints[2 + i] * old_extent, ints[1]);
+            break;
+#if defined(MPI_COMBINER_HINDEXED_BLOCK)
+        case MPI_COMBINER_HINDEXED_BLOCK:
+            for( i = 0; (i < ints[0]) && (PARSEC_SUCCESS == rc); i++ )
+                rc = parsec_type_program_flatten(prog, types[0], base + addrs[i], ints[1]);
+            break;
+#endif  /* defined(MPI_COMBINER_HINDEXED_BLOCK) */
+        case MPI_COMBINER_STRUCT:
+            for( i = 0; (i < ints[0]) && (PARSEC_SUCCESS == rc); i++ )
+                rc = parsec_type_program_flatten(prog, types[i], base + addrs[i], ints[1 + i]);
+            break;
+        default:
+            rc = PARSEC_ERR_NOT_SUPPORTED;
+        }
+    }
+
+    for( j = 0; j < nb_types; j++ ) {
+        MPI_Type_get_envelope(types[j], &nb_ints, &nb_addrs, &i, &combiner);
+        if( MPI_COMBINER_NAMED != combiner ) MPI_Type_free(&types[j]);
+    }
+    free(ints); free(addrs); free(types);
+    return rc;
+}
+
+static parsec_type_program_t *
+parsec_type_program_get(parsec_datatype_t type)
+{
+    parsec_type_program_t *prog = NULL;
+    int flag = 0, size;
+    MPI_Aint lb, extent;
+
+    if( MPI_KEYVAL_INVALID != parsec_type_program_keyval ) {
+        MPI_Type_get_attr(type, parsec_type_program_keyval, &prog, &flag);
+        if( flag ) return prog->supported ? prog : NULL;
+    }
+
+    parsec_atomic_lock(&parsec_type_program_lock);
+    if( MPI_KEYVAL_INVALID == parsec_type_program_keyval ) {
+        MPI_Type_create_keyval(MPI_TYPE_NULL_COPY_FN, parsec_type_program_delete,
+                               &parsec_type_program_keyval, NULL);
+    }
+    MPI_Type_get_attr(type, parsec_type_program_keyval, &prog, &flag);
+    if( !flag ) {
+        prog = (parsec_type_program_t*)calloc(1, sizeof(parsec_type_program_t));
+        MPI_Type_size(type, &size);
+        MPI_Type_get_extent(type, &lb, &extent);
+        prog->size   = size;
+        prog->extent = extent;
+        prog->supported = (PARSEC_SUCCESS == parsec_type_program_flatten(prog, type, 0, 1));
+        if( !prog->supported ) {
+            free(prog->blocks);
+            prog->blocks = NULL;
+            prog->nb_blocks = 0;
+        }
+        PARSEC_DEBUG_VERBOSE(20, parsec_debug_output, "Datatype %p flattened in %d blocks (%zu bytes, %s)",
+                             (void*)type, prog->nb_blocks, prog->size,
+                             prog->supported ? "native pack" : "MPI pack");
+        if( MPI_SUCCESS != MPI_Type_set_attr(type, parsec_type_program_keyval, prog) ) {
+            parsec_type_program_delete(type, parsec_type_program_keyval, prog, NULL);
+            prog = NULL;
+        }
+    }
+    parsec_atomic_unlock(&parsec_type_program_lock);
+    return ((NULL != prog) && prog->supported) ? prog : NULL;
+}
+
+/* Predefined datatypes are a single block, no need for a program */
+static int
+parsec_type_named_size(parsec_datatype_t type, size_t *size)
+{
+    int nb_ints, nb_addrs, nb_types, combiner, s;
+    MPI_Type_get_envelope(type, &nb_ints, &nb_addrs, &nb_types, &combiner);
+    if( MPI_COMBINER_NAMED != combiner ) return 0;
+    MPI_Type_size(type, &s);
+    *size = (size_t)s;
+    return 1;
+}
+
+/* Copy kernel: constant sizes let the compiler emit straight vector moves */
+static inline void
+parsec_type_copy_block(char *dst, const char *src, size_t len)
+{
+    switch( len ) {
+    case 4:  memcpy(dst, src, 4);  break;
+    case 8:  memcpy(dst, src, 8);  break;
+    case 16: memcpy(dst, src, 16); break;
+    case 32: memcpy(dst, src, 32); break;
+    default: memcpy(dst, src, len);
+    }
+}
+
+int
+parsec_type_pack_size(int incount, parsec_datatype_t type, int *size)
+{
+    parsec_type_program_t *prog;
+    size_t named;
+
+    if( (PARSEC_DATATYPE_NULL == type) || (PARSEC_DATATYPE_PACKED == type) ) return PARSEC_ERR_NOT_SUPPORTED;
+    if( parsec_type_named_size(type, &named) ) {
+        *size = (int)(named * incount);
+        return PARSEC_SUCCESS;
+    }
+    if( NULL == (prog = parsec_type_program_get(type)) ) return PARSEC_ERR_NOT_SUPPORTED;
+    *size = (int)(prog->size * incount);
+    return PARSEC_SUCCESS;
+}
+
+int
+parsec_type_element_size(parsec_datatype_t type, size_t *size)
+{
+    parsec_type_program_t *prog;
+
+    if( (PARSEC_DATATYPE_NULL == type) || (PARSEC_DATATYPE_PACKED == type) ) return PARSEC_ERR_NOT_SUPPORTED;
+    if( parsec_type_named_size(type, size) ) return PARSEC_SUCCESS;
+    if( NULL == (prog = parsec_type_program_get(type)) ) return PARSEC_ERR_NOT_SUPPORTED;
+    *size = prog->elem;
+    return PARSEC_SUCCESS;
+}
+
+int
+parsec_type_pack(const void *inbuf, int incount, parsec_datatype_t type,
+                 void *outbuf, int outsize, int *position)
+{
+    parsec_type_program_t *prog;
+    const char *in = (const char*)inbuf;
+    char *out;
+    size_t named;
+
+    if( (PARSEC_DATATYPE_NULL == type) || (PARSEC_DATATYPE_PACKED == type) ) return PARSEC_ERR_NOT_SUPPORTED;
+    if( parsec_type_named_size(type, &named) ) {
+        if( (size_t)(*position) + named * incount > (size_t)outsize ) return PARSEC_ERR_VALUE_OUT_OF_BOUNDS;
+        memcpy((char*)outbuf + *position, inbuf, named * incount);
+        *position += (int)(named * incount);
+        return PARSEC_SUCCESS;
+    }
+    if( NULL == (prog = parsec_type_program_get(type)) ) return PARSEC_ERR_NOT_SUPPORTED;
+    if( (size_t)(*position) + prog->size * incount > (size_t)outsize ) return PARSEC_ERR_VALUE_OUT_OF_BOUNDS;
+
+    out = (char*)outbuf + *position;
+    for( int e = 0; e < incount; e++, in += prog->extent ) {
+        for( int b = 0; b < prog->nb_blocks; b++ ) {
+            parsec_type_copy_block(out, in + prog->blocks[b].disp, prog->blocks[b].len);
+            out += prog->blocks[b].len;
+        }
+    }
+    *position = (int)(out - (char*)outbuf);
+    return PARSEC_SUCCESS;
+}
+
+int
+parsec_type_unpack(const void *inbuf, int insize, int *position,
+                   void *outbuf, int outcount, parsec_datatype_t type)
+{
+    parsec_type_program_t *prog;
+    const char *in;
+    char *out = (char*)outbuf;
+    size_t named;
+
+    if( (PARSEC_DATATYPE_NULL == type) || (PARSEC_DATATYPE_PACKED == type) ) return PARSEC_ERR_NOT_SUPPORTED;
+    if( parsec_type_named_size(type, &named) ) {
+        if( (size_t)(*position) + named * outcount > (size_t)insize ) return PARSEC_ERR_VALUE_OUT_OF_BOUNDS;
+        memcpy(outbuf, (const char*)inbuf + *position, named * outcount);
+        *position += (int)(named * outcount);
+        return PARSEC_SUCCESS;
+    }
+    if( NULL == (prog = parsec_type_program_get(type)) ) return PARSEC_ERR_NOT_SUPPORTED;
+    if( (size_t)(*position) + prog->size * outcount > (size_t)insize ) return PARSEC_ERR_VALUE_OUT_OF_BOUNDS;
+
+    in = (const char*)inbuf + *position;
+    for( int e = 0; e < outcount; e++, out += prog->extent ) {
+        for( int b = 0; b < prog->nb_blocks; b++ ) {
+            parsec_type_copy_block(out + prog->blocks[b].disp, in, prog->blocks[b].len);
+            in += prog->blocks[b].len;
+        }
+    }
+    *position = (int)(in - (const char*)inbuf);
+    return PARSEC_SUCCESS;
+}
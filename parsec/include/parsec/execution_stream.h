@@ -52,6 +52,9 @@ struct parsec_execution_stream_s {
      * the scheduler decision.
      */
     struct parsec_task_s* next_task;
+    int32_t next_task_depth;  /**< Number of tasks executed in a row from next_task */
+    struct parsec_sched_stats_s *sched_stats;  /**< Scheduler instrumentation, NULL when disabled */
+    struct parsec_remote_dep_stats_s *remote_stats; /**< Remote data being released by this stream (comm_stats), or NULL */
 
 #if defined(PARSEC_SIM)
     int largest_simulation_date;
@@ -126,7 +129,6 @@ struct parsec_context_s {
 
     parsec_barrier_t  barrier;
 
-    size_t remote_dep_fw_mask_sizeof; /* Size of the remote dep fw mask */
 
     pthread_t *pthreads; /**< all POSIX threads used for computation are stored here in order
                           *   threads[0] is uninitialized, this is the user's thread
@@ -141,6 +143,8 @@ struct parsec_context_s {
     parsec_hash_table_t  dtd_arena_datatypes_hash_table; /**< Hash table that stores the arena datatypes used by DTD */
     int                  dtd_arena_datatypes_next_id;    /**< Next ID to use for the next Arena Datatype by DTD */
 
+    struct parsec_parking_lot_s *parking_lot;  /**< Where the idle execution streams wait for new tasks */
+
 #if defined(PARSEC_SIM)
     int largest_simulation_date;
 #endif
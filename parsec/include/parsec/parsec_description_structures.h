@@ -127,6 +127,9 @@ struct parsec_comm_desc_s {
     parsec_cst_or_fct_64_t         displ;
 };
 
+#define PARSEC_DEP_FINAL_WRITE_AS_IS  ((uint8_t)(1 << 0))  /**< This dep writes the data of its flow in memory as is,
+                                                             *   without changing its datatype */
+
 struct parsec_dep_s {
     parsec_expr_t const        *cond;           /**< The runtime-evaluable condition on this dependency */
     parsec_expr_t const        *ctl_gather_nb;  /**< In case of control gather, the runtime-evaluable number of controls to expect */
@@ -134,6 +137,7 @@ struct parsec_dep_s {
     uint8_t                    dep_index;      /**< Output index of the dependency. This is used to store the flow
                                                 *   before transfering it to the successors. */
     uint8_t                    dep_datatype_index;  /**< Index of the output datatype. */
+    uint8_t                    flags;           /**< Mask of PARSEC_DEP_* */
     parsec_flow_t const        *flow;           /**< Pointer to the flow pointed to/from this dependency */
     parsec_flow_t const        *belongs_to;     /**< The flow this dependency belongs tp */
     parsec_data_lookup_func_t  direct_data;    /**< Lookup the data associated with this dep, if (and only if)
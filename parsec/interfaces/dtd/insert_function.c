@@ -1554,13 +1554,10 @@ dtd_release_dep_fct(parsec_execution_stream_t *es,
             if( parsec_dtd_not_sent_to_rank((parsec_dtd_task_t *)oldcontext,
                                             dep->belongs_to->flow_index, dst_rank)) {
                 struct remote_dep_output_param_s *output;
-                uint32_t _array_pos, _array_bit, _array_mask;
 
 #if !defined(PARSEC_DIST_COLLECTIVES)
                 assert(src_rank == es->virtual_process->parsec_context->my_rank);
 #endif
-                remote_dep_rank_to_bit(dst_rank, &_array_pos, &_array_bit, src_rank);
-                _array_mask = 1 << _array_bit;
                 PARSEC_ALLOCATE_REMOTE_DEPS_IF_NULL(arg->remote_deps, oldcontext, MAX_PARAM_COUNT);
                 output = &arg->remote_deps->output[dep->dep_datatype_index];
                 assert((-1 == arg->remote_deps->root) || (arg->remote_deps->root == src_rank));
@@ -1572,22 +1569,20 @@ dtd_release_dep_fct(parsec_execution_stream_t *es,
                 output->data.repo = NULL;
                 output->data.repo_key = -1;
 #endif
-                if( !(output->rank_bits[_array_pos] & _array_mask)) {
-                    output->rank_bits[_array_pos] |= _array_mask;
+                if( remote_dep_rank_set_add(&output->ranks, remote_dep_rank_to_pos(dst_rank, src_rank)) ) {
                     /* For DTD this means nothing at this point */
                     output->deps_mask |= (1 << dep->dep_index);
-                    if( 0 == output->count_bits ) {
+                    if( 1 == output->ranks.count ) {
                         output->data = *data;
                     } else {
                         assert(output->data.data == data->data);
                     }
-                    output->count_bits++;
                     if( newcontext->priority > output->priority ) {
                         output->priority = newcontext->priority;
                         if( newcontext->priority > arg->remote_deps->max_priority )
                             arg->remote_deps->max_priority = newcontext->priority;
                     }
-                }  /* otherwise the bit is already flipped, the peer is already part of the propagation. */
+                }  /* otherwise the peer is already part of the propagation. */
             }
         }
     }
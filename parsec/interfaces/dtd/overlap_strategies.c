@@ -324,6 +324,7 @@ parsec_dtd_ordering_correctly( parsec_execution_stream_t *es,
                 deps.belongs_to      = current_task->super.task_class->out[current_dep];
                 deps.direct_data     = NULL;
                 deps.dep_datatype_index = current_dep;
+                deps.flags           = 0;
 
                 rank_dst = current_desc->rank;
 
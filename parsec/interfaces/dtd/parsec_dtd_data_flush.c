@@ -85,6 +85,7 @@ set_deps_for_flush_task(const parsec_task_class_t *tc)
     parent_dep->belongs_to      = tc->out[0];
     parent_dep->direct_data     = NULL;
     parent_dep->dep_datatype_index = tc->out[0]->flow_index;
+    parent_dep->flags           = 0;
 
     desc_dep->cond              = NULL;
     desc_dep->ctl_gather_nb     = NULL;
@@ -94,6 +95,7 @@ set_deps_for_flush_task(const parsec_task_class_t *tc)
     desc_dep->belongs_to        = tc->in[0];
     desc_dep->direct_data       = NULL;
     desc_dep->dep_datatype_index = tc->in[0]->flow_index;
+    desc_dep->flags             = 0;
 
 
     parsec_flow_t **parent_out = (parsec_flow_t **)&(tc->out[0]);
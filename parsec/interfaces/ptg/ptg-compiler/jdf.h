@@ -108,6 +108,7 @@ typedef struct jdf_compiler_global_args {
     int   noline;  /**< Don't dump the jdf line number in the generate .c file */
     struct jdf_name_list *ignore_properties; /**< Properties to ignore */
     int   termdet; /**< What termination detection to use (one of TERMDET_*) */
+    int   no_fusion; /**< Don't fuse the links of one-to-one chains of tasks (see jdf_optimize) */
 } jdf_compiler_global_args_t;
 extern jdf_compiler_global_args_t JDF_COMPILER_GLOBAL_ARGS;
 
@@ -181,6 +182,7 @@ typedef unsigned int jdf_flags_t;
 #define JDF_FUNCTION_FLAG_HAS_DATA_INPUT    ((jdf_flags_t)(1 << 4))
 #define JDF_FUNCTION_FLAG_HAS_DATA_OUTPUT   ((jdf_flags_t)(1 << 5))
 #define JDF_FUNCTION_FLAG_NO_PREDECESSORS   ((jdf_flags_t)(1 << 6))
+#define JDF_FUNCTION_FLAG_FUSED             ((jdf_flags_t)(1 << 7))
 
 #define JDF_HAS_UD_NB_LOCAL_TASKS              ((jdf_flags_t)(1 << 0))
 #define JDF_PROP_UD_NB_LOCAL_TASKS_FN_NAME     "nb_local_tasks_fn"
@@ -2606,6 +2606,12 @@ static int jdf_generate_dependency( const jdf_t *jdf, jdf_dataflow_t *flow, jdf_
                                     jdf_basename, call->func_or_mem,
                                     string_arena_get_string(tmp_fct_name));
             string_arena_free(tmp_fct_name);
+            /* A final write without datatype copies the data of the flow as is */
+            if( (dep->dep_flags & JDF_DEP_FLOW_OUT) &&
+                (DEP_UNDEFINED_DATATYPE == jdf_dep_undefined_type(dep->datatype_local)) &&
+                (DEP_UNDEFINED_DATATYPE == jdf_dep_undefined_type(dep->datatype_data)) ) {
+                string_arena_add_string(sa, "  .flags = PARSEC_DEP_FINAL_WRITE_AS_IS,\n");
+            }
         }
         else {
             string_arena_add_string(sa,
@@ -4013,6 +4019,9 @@ static void jdf_generate_release_task_fct(const jdf_t *jdf, jdf_function_entry_t
         if( f->user_defines & JDF_FUNCTION_HAS_UD_STARTUP_TASKS_FUN ) {
             coutput("    /* Must test for NULL, as user-provided startup tasks may not have a dep in the hash table */\n"
                     "    if(NULL != hash_dep) parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);\n");
+        } else if( f->flags & JDF_FUNCTION_FLAG_FUSED ) {
+            coutput("    /* Must test for NULL, as the tasks fused with their predecessor have no dep in the hash table */\n"
+                    "    if(NULL != hash_dep) parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);\n");
         } else {
             coutput("    parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);\n");
         }
@@ -4264,19 +4273,21 @@ static void jdf_generate_one_function( const jdf_t *jdf, jdf_function_entry_t *f
 
     if( use_mask ) {
         string_arena_add_string(sa,
-                                "  .flags = %s%s%s | PARSEC_USE_DEPS_MASK,\n"
+                                "  .flags = %s%s%s%s | PARSEC_USE_DEPS_MASK,\n"
                                 "  .dependencies_goal = 0x%x,\n",
                                 (f->flags & JDF_FUNCTION_FLAG_HIGH_PRIORITY) ? "PARSEC_HIGH_PRIORITY_TASK" : "0x0",
                                 has_in_in_dep ? " | PARSEC_HAS_IN_IN_DEPENDENCIES" : "",
                                 jdf_property_get_int(f->properties, "immediate", 0) ? " | PARSEC_IMMEDIATE_TASK" : "",
+                                (f->flags & JDF_FUNCTION_FLAG_FUSED) ? " | PARSEC_FUSED_TASK" : "",
                                 inputmask);
     } else {
         string_arena_add_string(sa,
-                                "  .flags = %s%s%s%s,\n"
+                                "  .flags = %s%s%s%s%s,\n"
                                 "  .dependencies_goal = %d,\n",
                                 (f->flags & JDF_FUNCTION_FLAG_HIGH_PRIORITY) ? "PARSEC_HIGH_PRIORITY_TASK" : "0x0",
                                 has_in_in_dep ? " | PARSEC_HAS_IN_IN_DEPENDENCIES" : "",
                                 jdf_property_get_int(f->properties, "immediate", 0) ? " | PARSEC_IMMEDIATE_TASK" : "",
+                                (f->flags & JDF_FUNCTION_FLAG_FUSED) ? " | PARSEC_FUSED_TASK" : "",
                                 has_control_gather ? "|PARSEC_HAS_CTL_GATHER" : "",
                                 nb_input);
     }
@@ -6131,7 +6142,10 @@ static void jdf_generate_code_dry_run_before(const jdf_t *jdf, const jdf_functio
     (void)jdf;
     (void)f;
 
-    coutput("\n\n#if !defined(PARSEC_PROF_DRY_BODY)\n\n");
+    coutput("\n\n#if !defined(PARSEC_PROF_DRY_BODY)\n"
+            "#if defined(PARSEC_SIM)\n"
+            "  if( !parsec_sim_dry_body ) {\n"
+            "#endif /* defined(PARSEC_SIM) */\n\n");
 }
 
 static void jdf_generate_code_dry_run_after(const jdf_t *jdf, const jdf_function_entry_t *f)
@@ -6139,7 +6153,10 @@ static void jdf_generate_code_dry_run_after(const jdf_t *jdf, const jdf_function
     (void)jdf;
     (void)f;
 
-    coutput("\n\n#endif /*!defined(PARSEC_PROF_DRY_BODY)*/\n\n");
+    coutput("\n\n#if defined(PARSEC_SIM)\n"
+            "  }\n"
+            "#endif /* defined(PARSEC_SIM) */\n"
+            "#endif /*!defined(PARSEC_PROF_DRY_BODY)*/\n\n");
 }
 
 static void jdf_generate_code_grapher_task_done(const jdf_t *jdf, const jdf_function_entry_t *f, const char* context_name)
@@ -6448,6 +6465,40 @@ jdf_generate_code_time_estimate(const jdf_t *jdf,
     sprintf(name, "NULL");
 }
 
+static void jdf_generate_code_prof_info(const jdf_t *jdf, const jdf_function_entry_t *f)
+{
+    (void)jdf;
+    /* If the function has the property profile turned off do not generate the profiling code */
+    if( profile_enabled(f->properties) ) {
+        string_arena_t *sa2 = string_arena_new(64);
+        string_arena_t *sa3 = string_arena_new(64);
+        expr_info_t linfo = EMPTY_EXPR_INFO;
+
+        linfo.prefix = "";
+        linfo.suffix = "";
+        linfo.sa = sa2;
+        linfo.assignments = "&this_task->locals";
+
+        coutput("  /** Generate profiling information */\n"
+                "#if defined(PARSEC_PROF_TRACE)\n"
+                "  this_task->prof_info.desc = (parsec_data_collection_t*)"TASKPOOL_GLOBAL_PREFIX"_g_%s;\n"
+                "  this_task->prof_info.priority = this_task->priority;\n"
+                "  this_task->prof_info.data_id   = ((parsec_data_collection_t*)"TASKPOOL_GLOBAL_PREFIX"_g_%s)->data_key((parsec_data_collection_t*)"TASKPOOL_GLOBAL_PREFIX"_g_%s, %s);\n"
+                "  this_task->prof_info.task_class_id = this_task->task_class->task_class_id;\n"
+                "  this_task->prof_info.task_return_code = -1;\n"
+                "#endif  /* defined(PARSEC_PROF_TRACE) */\n",
+                f->predicate->func_or_mem,
+                f->predicate->func_or_mem, f->predicate->func_or_mem,
+                UTIL_DUMP_LIST(sa3, f->predicate->parameters, next,
+                               dump_expr, (void*)&linfo,
+                               "", "", ", ", "") );
+        string_arena_free(sa2);
+        string_arena_free(sa3);
+    } else {
+        coutput("  /** No profiling information */\n");
+    }
+}
+
 static void
 jdf_generate_code_data_lookup(const jdf_t *jdf,
                               const jdf_function_entry_t *f,
@@ -6523,33 +6574,7 @@ jdf_generate_code_data_lookup(const jdf_t *jdf,
         jdf_generate_code_flow_initialization(jdf, f, fl);
     }
 
-    /* If the function has the property profile turned off do not generate the profiling code */
-    if( profile_enabled(f->properties) ) {
-        string_arena_t *sa3 = string_arena_new(64);
-        expr_info_t linfo = EMPTY_EXPR_INFO;
-
-        linfo.prefix = "";
-        linfo.suffix = "";
-        linfo.sa = sa2;
-        linfo.assignments = "&this_task->locals";
-
-        coutput("  /** Generate profiling information */\n"
-                "#if defined(PARSEC_PROF_TRACE)\n"
-                "  this_task->prof_info.desc = (parsec_data_collection_t*)"TASKPOOL_GLOBAL_PREFIX"_g_%s;\n"
-                "  this_task->prof_info.priority = this_task->priority;\n"
-                "  this_task->prof_info.data_id   = ((parsec_data_collection_t*)"TASKPOOL_GLOBAL_PREFIX"_g_%s)->data_key((parsec_data_collection_t*)"TASKPOOL_GLOBAL_PREFIX"_g_%s, %s);\n"
-                "  this_task->prof_info.task_class_id = this_task->task_class->task_class_id;\n"
-                "  this_task->prof_info.task_return_code = -1;\n"
-                "#endif  /* defined(PARSEC_PROF_TRACE) */\n",
-                f->predicate->func_or_mem,
-                f->predicate->func_or_mem, f->predicate->func_or_mem,
-                UTIL_DUMP_LIST(sa3, f->predicate->parameters, next,
-                               dump_expr, (void*)&linfo,
-                               "", "", ", ", "") );
-        string_arena_free(sa3);
-    } else {
-        coutput("  /** No profiling information */\n");
-    }
+    jdf_generate_code_prof_info(jdf, f);
     coutput("  return PARSEC_HOOK_RETURN_DONE;\n"
             "}\n\n");
     string_arena_free(sa);
@@ -7006,9 +7031,12 @@ static void jdf_generate_code_hook(const jdf_t *jdf,
 
     coutput("{\n"
             "  __parsec_%s_internal_taskpool_t *__parsec_tp = (__parsec_%s_internal_taskpool_t *)this_task->taskpool;\n"
-            "  (void)es; (void)__parsec_tp;\n"
-            "%s",
-            jdf_basename, jdf_basename,
+            "  (void)es; (void)__parsec_tp;\n",
+            jdf_basename, jdf_basename);
+    if( f->flags & JDF_FUNCTION_FLAG_FUSED ) {
+        coutput("  do {  /* once per link of the chain, see fuse_%s */\n", name);
+    }
+    coutput("%s",
             UTIL_DUMP_LIST(sa, f->locals, next,
                            dump_local_assignments, &ai, "", "  ", "\n", "\n"));
     coutput("%s\n",
@@ -7091,6 +7119,9 @@ static void jdf_generate_code_hook(const jdf_t *jdf,
     }
     jdf_coutput_prettycomment('-', "END OF %s BODY", f->fname);
     jdf_generate_code_dry_run_after(jdf, f);
+    if( f->flags & JDF_FUNCTION_FLAG_FUSED ) {
+        coutput("  } while( fuse_%s(es, this_task) );\n", name);
+    }
     coutput("  return PARSEC_HOOK_RETURN_DONE;\n"
             "}\n");
 
@@ -7151,11 +7182,139 @@ jdf_generate_code_complete_hook(const jdf_t *jdf,
     string_arena_free(sa2);
 }
 
+/**
+ * Generate the function called by the hook of a fused class (see
+ * jdf_fusion_analysis) after each body: when the only successor of the task
+ * is a local task of the same class, it completes the task as its
+ * complete_execution and release_task would, without releasing any
+ * successor, and turns the task into its successor for the hook to run the
+ * next body.
+ */
+static void
+jdf_generate_code_fuse(const jdf_t *jdf,
+                       const jdf_function_entry_t *f,
+                       const char *name)
+{
+    string_arena_t *sa, *sa2;
+    assignment_info_t ai;
+    jdf_dataflow_t *fl;
+    uint32_t complete_mask = 0;
+
+    sa  = string_arena_new(64);
+    sa2 = string_arena_new(64);
+    ai.sa = sa2;
+    ai.holder = "this_task->locals.";
+    ai.expr = NULL;
+    for( fl = f->dataflow; fl != NULL; fl = fl->next ) {
+        complete_mask |= fl->flow_dep_mask_out;
+    }
+
+    coutput("#if defined(PARSEC_HAVE_DEV_CPU_SUPPORT)\n"
+            "static int fuse_%s(parsec_execution_stream_t *es, %s *this_task)\n"
+            "{\n"
+            "  const __parsec_%s_internal_taskpool_t *__parsec_tp = (__parsec_%s_internal_taskpool_t *)this_task->taskpool;\n"
+            "  parsec_fuse_successor_arg_t arg;\n"
+            "\n"
+            "  if( !parsec_runtime_task_fusion ) return 0;\n"
+            "  arg.nb_successors = 0;\n"
+            "  iterate_successors_of_%s_%s(es, this_task, PARSEC_ACTION_RELEASE_LOCAL_DEPS | 0x%x,\n"
+            "                              parsec_fuse_successor_fct, &arg);\n"
+            "  if( 1 != arg.nb_successors ) return 0;\n"
+            "\n"
+            "  __parsec_fused_task_complete(es, (parsec_task_t*)this_task);\n",
+            name, parsec_get_name(jdf, f, "task_t"),
+            jdf_basename, jdf_basename,
+            jdf_basename, f->fname, complete_mask);
+
+    coutput("#if defined(DISTRIBUTED)\n"
+            "  {\n"
+            "  parsec_data_t* data_t_desc = NULL; (void)data_t_desc;\n"
+            "%s",
+            UTIL_DUMP_LIST(sa, f->locals, next,
+                           dump_local_assignments, &ai, "", "  ", "\n", "\n"));
+    for( fl = f->dataflow; fl != NULL; fl = fl->next ) {
+        jdf_generate_code_flow_final_writes(jdf, f, fl);
+    }
+    coutput("%s"
+            "  }\n"
+            "#endif  /* defined(DISTRIBUTED) */\n",
+            UTIL_DUMP_LIST_FIELD(sa, f->locals, next, name,
+                                 dump_string, NULL, "", "  (void)", ";", ";\n"));
+
+    coutput("  /* Consume the inputs of this_task as its release_deps would */\n");
+    for( fl = f->dataflow; fl != NULL; fl = fl->next ) {
+        coutput("  if( NULL != this_task->data._f_%s.source_repo_entry ) {\n"
+                "    data_repo_entry_used_once( this_task->data._f_%s.source_repo, this_task->data._f_%s.source_repo_entry->ht_item.key );\n"
+                "    this_task->data._f_%s.source_repo_entry = NULL;\n"
+                "    this_task->data._f_%s.source_repo = NULL;\n"
+                "  }\n",
+                fl->varname,
+                fl->varname, fl->varname,
+                fl->varname,
+                fl->varname);
+    }
+    coutput("  if( NULL != this_task->repo_entry ) {\n"
+            "    data_repo_entry_used_once( %s_repo, this_task->repo_entry->ht_item.key );\n"
+            "    this_task->repo_entry = NULL;\n"
+            "  }\n",
+            f->fname);
+    if( JDF_COMPILER_GLOBAL_ARGS.dep_management == DEP_MANAGEMENT_DYNAMIC_HASH_TABLE ) {
+        coutput("  /* Release the task as its release_task would */\n"
+                "  {\n"
+                "    parsec_hash_table_t *ht = (parsec_hash_table_t*)__parsec_tp->super.super.dependencies_array[%d];\n"
+                "    parsec_key_t key = this_task->task_class->make_key((const parsec_taskpool_t*)__parsec_tp, (const parsec_assignment_t*)&this_task->locals);\n"
+                "    parsec_hashable_dependency_t *hash_dep = (parsec_hashable_dependency_t *)parsec_hash_table_remove(ht, key);\n"
+                "    /* NULL if this_task was itself fused with its predecessor */\n"
+                "    if(NULL != hash_dep) parsec_thread_mempool_free(hash_dep->mempool_owner, hash_dep);\n"
+                "  }\n",
+                f->task_class_id);
+    }
+    coutput("  __parsec_tp->super.super.tdm.module->taskpool_addto_nb_tasks((parsec_taskpool_t*)__parsec_tp, -1);\n"
+            "  PARSEC_PINS(es, COMPLETE_EXEC_END, (parsec_task_t*)this_task);\n"
+            "\n"
+            "  /* this_task becomes its successor, which inherits its data */\n"
+            "  memcpy(&this_task->locals, arg.locals, sizeof(this_task->locals));\n"
+            "  this_task->priority = arg.priority;\n");
+    for( fl = f->dataflow; fl != NULL; fl = fl->next ) {
+        coutput("  if( this_task->data._f_%s.data_in != this_task->data._f_%s.data_out ) {\n"
+                "    PARSEC_OBJ_RETAIN(this_task->data._f_%s.data_out);\n"
+                "    if( NULL != this_task->data._f_%s.data_in ) {\n"
+                "      PARSEC_DATA_COPY_RELEASE(this_task->data._f_%s.data_in);\n"
+                "    }\n"
+                "    this_task->data._f_%s.data_in = this_task->data._f_%s.data_out;\n"
+                "  }\n",
+                fl->varname, fl->varname,
+                fl->varname,
+                fl->varname,
+                fl->varname,
+                fl->varname, fl->varname);
+    }
+    coutput("  {\n"
+            "%s",
+            UTIL_DUMP_LIST(sa, f->locals, next,
+                           dump_local_assignments, &ai, "", "  ", "\n", "\n"));
+    jdf_generate_code_prof_info(jdf, f);
+    coutput("%s"
+            "  }\n"
+            "  __parsec_fused_task_start(es, (parsec_task_t*)this_task);\n"
+            "  return 1;\n"
+            "}\n"
+            "#endif  /* defined(PARSEC_HAVE_DEV_CPU_SUPPORT) */\n\n",
+            UTIL_DUMP_LIST_FIELD(sa, f->locals, next, name,
+                                 dump_string, NULL, "", "  (void)", ";", ";\n"));
+
+    string_arena_free(sa);
+    string_arena_free(sa2);
+}
+
 static void jdf_generate_code_hooks(const jdf_t *jdf,
                                     const jdf_function_entry_t *f,
                                     const char *name)
 {
     jdf_body_t* body = f->bodies;
+    if( f->flags & JDF_FUNCTION_FLAG_FUSED ) {
+        jdf_generate_code_fuse(jdf, f, name);
+    }
     do {
         jdf_generate_code_hook(jdf, f, body, name);
         body = body->next;
@@ -8345,6 +8504,97 @@ jdf_generate_code_find_deps(const jdf_t *jdf,
     (void)jdf;
 }
 
+/**
+ * Return 1 if the expression can designate more than one value (a range,
+ * or a named range).
+ */
+static int jdf_expr_has_range(const jdf_expr_t *e)
+{
+    if( NULL == e ) return 0;
+    if( (JDF_RANGE == e->op) || (NULL != e->local_variables) ) return 1;
+    if( JDF_OP_IS_TERNARY(e->op) )
+        return jdf_expr_has_range(e->jdf_ta2) || jdf_expr_has_range(e->jdf_ta3);
+    return 0;
+}
+
+/**
+ * Return 1 if the call designates at most one task, 0 otherwise.
+ */
+static int jdf_call_is_one_to_one(const jdf_call_t *call)
+{
+    const jdf_expr_t *e;
+
+    if( NULL != call->local_defs ) return 0;
+    for( e = call->parameters; NULL != e; e = e->next ) {
+        if( jdf_expr_has_range(e) ) return 0;
+    }
+    return 1;
+}
+
+/**
+ * Return 1 if the dependency passes the data as is (no datatype).
+ */
+static int jdf_dep_is_untyped(const jdf_dep_t *dep)
+{
+    return (DEP_UNDEFINED_DATATYPE == jdf_dep_undefined_type(dep->datatype_local)) &&
+           (DEP_UNDEFINED_DATATYPE == jdf_dep_undefined_type(dep->datatype_data));
+}
+
+/**
+ * Detect the task classes whose tasks can be fused with their successor:
+ * the links of one-to-one chains of tasks of the same class, with a single
+ * RW flow passed as is from a task to the next, and a single CPU body. The
+ * hook of these classes runs the body of the successor of a task right
+ * away when it is the only successor and it runs here (see
+ * jdf_generate_code_fuse), each link keeping its own execution events and
+ * priority. Disabled by the --no-fusion option, or the fusion property of
+ * a class.
+ */
+static void jdf_fusion_analysis(const jdf_t *jdf, jdf_function_entry_t *f)
+{
+    const jdf_dataflow_t *fl = f->dataflow;
+    const jdf_dep_t *dep;
+    jdf_expr_t *termdet;
+    int to_self = 0;
+
+    if( !jdf_property_get_int(f->properties, "fusion", !JDF_COMPILER_GLOBAL_ARGS.no_fusion) )
+        return;
+    /* the task counting, startup and dependency tracking must see all the tasks */
+    termdet = jdf_find_property(jdf->global_properties, JDF_PROP_TERMDET_NAME, NULL);
+    if( ((NULL != termdet) && strcmp(termdet->jdf_var, JDF_PROP_TERMDET_LOCAL)) ||
+        (NULL != jdf_find_property(jdf->global_properties, JDF_PROP_UD_NB_LOCAL_TASKS_FN_NAME, NULL)) ||
+        (NULL != jdf_find_property(f->properties, JDF_PROP_UD_STARTUP_TASKS_FN_NAME, NULL)) ||
+        (NULL != jdf_find_property(f->properties, JDF_PROP_UD_FIND_DEPS_FN_NAME, NULL)) )
+        return;
+    if( (NULL != f->bodies->next) ||
+        (NULL != jdf_find_property(f->bodies->properties, "type", NULL)) ||
+        (NULL != jdf_find_property(f->bodies->properties, JDF_BODY_PROP_EVALUATE, NULL)) ||
+        (NULL != jdf_find_property(f->bodies->properties, JDF_BODY_PROP_HOOK, NULL)) )
+        return;
+    if( (NULL == fl) || (NULL != fl->next) ||
+        ((JDF_FLOW_TYPE_READ | JDF_FLOW_TYPE_WRITE) != (fl->flow_flags & (JDF_FLOW_TYPE_CTL | JDF_FLOW_TYPE_READ | JDF_FLOW_TYPE_WRITE))) )
+        return;
+
+    for( dep = fl->deps; NULL != dep; dep = dep->next ) {
+        const jdf_call_t *calls[2];
+        if( NULL != dep->local_defs ) return;
+        calls[0] = dep->guard->calltrue;
+        calls[1] = (JDF_GUARD_TERNARY == dep->guard->guard_type) ? dep->guard->callfalse : NULL;
+        for( int c = 0; c < 2; c++ ) {
+            /* memory, NEW, NULL and the other classes do not matter */
+            if( (NULL == calls[c]) || (NULL == calls[c]->var) || strcmp(calls[c]->func_or_mem, f->fname) )
+                continue;
+            if( !jdf_call_is_one_to_one(calls[c]) || !jdf_dep_is_untyped(dep) )
+                return;
+            if( dep->dep_flags & JDF_DEP_FLOW_OUT )
+                to_self = 1;
+        }
+    }
+    if( to_self ) {
+        f->flags |= JDF_FUNCTION_FLAG_FUSED;
+    }
+}
+
 /**
  * Analyze the code to optimize the output
  */
@@ -8386,6 +8636,7 @@ int jdf_optimize( jdf_t* jdf )
             if( JDF_DEP_HAS_DISPL & has_displacement )
                 flow->flow_flags |= JDF_FLOW_HAS_DISPL;
         }
+        jdf_fusion_analysis(jdf, f);
     }
     string_arena_free(sa);
     return 0;
@@ -92,6 +92,8 @@ static void usage(void)
             "                     in the source code (default don't)\n"
             "  --ignore-property  List (comma separated) of properties to ignore in the JDF\n"
             "                     (default none)\n"
+            "  --no-fusion        Do not generate the hooks that run the links of one-to-one\n"
+            "                     chains of tasks back to back (default generate them)\n"
             "\n",
             DEFAULTS.input,
             DEFAULTS.output_c,
@@ -195,6 +197,7 @@ static void parse_args(int argc, char *argv[])
         { "force-profile", no_argument,             NULL,   2  },
         { "ignore-properties", required_argument,   NULL,  'I' },
         { "dynamic-termdet", no_argument,           NULL,  'D' },
+        { "no-fusion",     no_argument, &JDF_COMPILER_GLOBAL_ARGS.no_fusion, 1 },
         { NULL,            0,                       NULL,   0  }
     };
 
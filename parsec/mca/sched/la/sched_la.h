@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2026      The University of Tennessee and The University
+ *                         of Tennessee Research Foundation.  All rights
+ *                         reserved.
+ * $COPYRIGHT$
+ * 
+ * Additional copyrights may follow
+ * 
+ * $HEADER$
+ */
+
+/**
+ * @file
+ *
+ * Locality Aware Scheduler
+ *
+ * A local queues scheduler (see lfq) that remembers, for each piece of
+ * data, the execution stream that last executed a task owning or writing
+ * it. When tasks become ready, they are pushed in the local queue of the
+ * execution stream where most of their known inputs are resident, unless
+ * that queue holds more than sched_la_imbalance tasks more than the
+ * local queue of the releasing stream.
+ *
+ */
+
+
+#ifndef MCA_SCHED_LA_H
+#define MCA_SCHED_LA_H
+
+#include "parsec/parsec_config.h"
+#include "parsec/mca/mca.h"
+#include "parsec/mca/sched/sched.h"
+
+
+BEGIN_C_DECLS
+
+/**
+ * Globally exported variable
+ */
+PARSEC_DECLSPEC extern const parsec_sched_base_component_t parsec_sched_la_component;
+PARSEC_DECLSPEC extern const parsec_sched_module_t parsec_sched_la_module;
+/* static accessor */
+mca_base_component_t *sched_la_static_component(void);
+
+/** Maximal number of tasks the preferred queue can hold in excess of the local one */
+extern int sched_la_imbalance;
+/** Log2 of the number of entries of the data locality table, shared by all the virtual processes */
+extern int sched_la_table_bits;
+
+
+END_C_DECLS
+#endif /* MCA_SCHED_LA_H */
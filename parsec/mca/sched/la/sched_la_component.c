@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2026      The University of Tennessee and The University
+ *                         of Tennessee Research Foundation.  All rights
+ *                         reserved.
+ * $COPYRIGHT$
+ * 
+ * Additional copyrights may follow
+ * 
+ * $HEADER$
+ *
+ * These symbols are in a file by themselves to provide nice linker
+ * semantics.  Since linkers generally pull in symbols by object
+ * files, keeping these symbols as the only symbols in this file
+ * prevents utility programs such as "ompi_info" from having to import
+ * entire components just to query their version and parameters.
+ */
+
+#include "parsec/parsec_config.h"
+#include "parsec/runtime.h"
+
+#include "parsec/mca/sched/sched.h"
+#include "parsec/mca/sched/la/sched_la.h"
+#include "parsec/papi_sde.h"
+#include "parsec/utils/mca_param.h"
+
+/*
+ * Local function
+ */
+static int sched_la_component_query(mca_base_module_t **module, int *priority);
+static int sched_la_component_register(void);
+
+/*
+ * Instantiate the public struct with all of our public information
+ * and pointers to our public functions in it
+ */
+const parsec_sched_base_component_t parsec_sched_la_component = {
+
+    /* First, the mca_component_t struct containing meta information
+       about the component itself */
+
+    {
+        PARSEC_SCHED_BASE_VERSION_2_0_0,
+
+        /* Component name and version */
+        "la",
+        "", /* options */
+        PARSEC_VERSION_MAJOR,
+        PARSEC_VERSION_MINOR,
+
+        /* Component open and close functions */
+        NULL, /*< No open: sched_la is always available, no need to check at runtime */
+        NULL, /*< No close: open did not allocate any resource, no need to release them */
+        sched_la_component_query, 
+        /*< specific query to return the module and add it to the list of available modules */
+        sched_la_component_register,
+        "", /*< no reserve */
+    },
+    {
+        /* The component has no metada */
+        MCA_BASE_METADATA_PARAM_NONE,
+        "", /*< no reserve */
+    }
+};
+
+mca_base_component_t *sched_la_static_component(void)
+{
+    return (mca_base_component_t *)&parsec_sched_la_component;
+}
+
+static int sched_la_component_query(mca_base_module_t **module, int *priority)
+{
+    /* module type should be: const mca_base_module_t ** */
+    void *ptr = (void*)&parsec_sched_la_module;
+    *priority = 16;
+    *module = (mca_base_module_t *)ptr;
+    return MCA_SUCCESS;
+}
+
+int sched_la_imbalance  = 4;
+int sched_la_table_bits = 14;
+
+static int sched_la_component_register(void)
+{
+    (void)parsec_mca_param_reg_int_name("sched_la", "imbalance",
+                                        "Number of tasks the queue of the execution stream holding the inputs of a ready task "
+                                        "can have in excess of the local queue before the task is kept local",
+                                        false, false, sched_la_imbalance, &sched_la_imbalance);
+    (void)parsec_mca_param_reg_int_name("sched_la", "table_bits",
+                                        "Log2 of the number of entries of the table tracking the location of the data",
+                                        false, false, sched_la_table_bits, &sched_la_table_bits);
+    PARSEC_PAPI_SDE_DESCRIBE_COUNTER("SCHEDULER::PENDING_TASKS::SCHED=LA",
+                              "the number of pending tasks for the LA scheduler");
+    PARSEC_PAPI_SDE_DESCRIBE_COUNTER("SCHEDULER::PENDING_TASKS::QUEUE=<VPID>/<QID>::SCHED=LA",
+                              "the number of pending tasks that end up in the virtual process <VPID> queue of queue identifier <QID> for the LA scheduler");
+    return MCA_SUCCESS;
+}
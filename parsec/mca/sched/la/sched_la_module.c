@@ -0,0 +1,418 @@
+/**
+ * Copyright (c) 2026      The University of Tennessee and The University
+ *                         of Tennessee Research Foundation.  All rights
+ *                         reserved.
+ * $COPYRIGHT$
+ *
+ * Additional copyrights may follow
+ *
+ * $HEADER$
+ *
+ */
+
+#include "parsec/parsec_config.h"
+#include "parsec/parsec_internal.h"
+#include "parsec/utils/debug.h"
+#include "parsec/class/dequeue.h"
+#include "parsec/data_internal.h"
+
+#include "parsec/mca/sched/sched.h"
+#include "parsec/mca/sched/sched_local_queues_utils.h"
+#include "parsec/mca/sched/la/sched_la.h"
+#include "parsec/mca/pins/pins.h"
+#include "parsec/parsec_hwloc.h"
+#include "parsec/papi_sde.h"
+
+/**
+ * Module functions
+ */
+static int sched_la_install(parsec_context_t* master);
+static int sched_la_schedule(parsec_execution_stream_t* es,
+                             parsec_task_t* new_context,
+                             int32_t distance);
+static parsec_task_t*
+sched_la_select(parsec_execution_stream_t *es,
+                int32_t* distance);
+static void sched_la_remove(parsec_context_t* master);
+static parsec_task_t*
+sched_la_select_task(parsec_execution_stream_t *es,
+                     int32_t* distance);
+static int flow_la_init(parsec_execution_stream_t* es, struct parsec_barrier_t* barrier);
+
+const parsec_sched_module_t parsec_sched_la_module = {
+    &parsec_sched_la_component,
+    {
+        sched_la_install,
+        flow_la_init,
+        sched_la_schedule,
+        sched_la_select,
+        NULL,
+        sched_la_remove
+    }
+};
+
+/**
+ * The local queues object, extended with the placement statistics of
+ * the execution stream.
+ */
+typedef struct {
+    parsec_mca_sched_local_queues_scheduler_object_t super;
+    int64_t nb_local;      /**< tasks kept in the queue of the releasing stream */
+    int64_t nb_moved;      /**< tasks pushed to the stream holding their inputs */
+    int64_t nb_imbalanced; /**< tasks kept local because the preferred queue was too loaded */
+} sched_la_object_t;
+
+#define SCHED_LA_OBJECT(es) ((sched_la_object_t*)(es)->scheduler_object)
+
+/**
+ * Direct mapped table from a piece of data (identified by its collection
+ * and key) to the execution stream that last executed a task owning or
+ * writing it. Collisions simply overwrite the previous owner: this is only
+ * a placement hint, and a stale entry costs at most a cache miss.
+ */
+static parsec_execution_stream_t * volatile *sched_la_table = NULL;
+static uint64_t sched_la_table_mask = 0;
+
+static inline uint64_t sched_la_index(const parsec_data_collection_t *dc, parsec_data_key_t key)
+{
+    uint64_t h = ((uint64_t)(uintptr_t)dc >> 4) ^ ((uint64_t)key * 0x9E3779B97F4A7C15ULL);
+    return (h ^ (h >> 29)) & sched_la_table_mask;
+}
+
+static inline parsec_execution_stream_t *
+sched_la_owner(const parsec_data_collection_t *dc, parsec_data_key_t key)
+{
+    return sched_la_table[sched_la_index(dc, key)];
+}
+
+static inline void
+sched_la_set_owner(const parsec_data_collection_t *dc, parsec_data_key_t key, parsec_execution_stream_t *es)
+{
+    uint64_t idx = sched_la_index(dc, key);
+    /* avoid dirtying the cache line if we already own the data */
+    if( sched_la_table[idx] != es )
+        sched_la_table[idx] = es;
+}
+
+static int sched_la_install( parsec_context_t *master )
+{
+    int bits = sched_la_table_bits;
+    (void)master;
+
+    if( bits < 4 ) bits = 4;
+    if( bits > 28 ) bits = 28;
+    sched_la_table_mask = (1ULL << bits) - 1;
+    sched_la_table = (parsec_execution_stream_t * volatile *)calloc(1ULL << bits, sizeof(parsec_execution_stream_t*));
+    if( NULL == sched_la_table ) return PARSEC_ERR_OUT_OF_RESOURCE;
+    return PARSEC_SUCCESS;
+}
+
+static int flow_la_init(parsec_execution_stream_t* es, struct parsec_barrier_t* barrier)
+{
+    parsec_mca_sched_local_queues_scheduler_object_t *sched_obj = NULL;
+    int nq, hwloc_levels;
+    uint32_t queue_size;
+    parsec_vp_t* vp;
+
+    vp = es->virtual_process;
+
+    /* Every flow creates its own local object */
+    sched_obj = (parsec_mca_sched_local_queues_scheduler_object_t*)calloc(1, sizeof(sched_la_object_t));
+    es->scheduler_object = sched_obj;
+    if( 0 == es->th_id ) {  /* And flow 0 creates the system_queue */
+        sched_obj->system_queue = PARSEC_OBJ_NEW(parsec_dequeue_t);
+    }
+
+    sched_obj->nb_hierarch_queues = vp->nb_cores;
+    sched_obj->hierarch_queues = (parsec_hbbuffer_t **)malloc(sched_obj->nb_hierarch_queues * sizeof(parsec_hbbuffer_t*) );
+    queue_size = vp->nb_cores * 4;
+
+    /* All local allocations are now completed. Synchronize with the other
+     threads before setting up the entire queues hierarchy. */
+    parsec_barrier_wait(barrier);
+
+    /* Get the flow 0 system queue and store it locally */
+    sched_obj->system_queue = PARSEC_MCA_SCHED_LOCAL_QUEUES_OBJECT(vp->execution_streams[0])->system_queue;
+
+    /* Each thread creates its own "local" queue, connected to the shared dequeue */
+    sched_obj->task_queue = parsec_hbbuffer_new( queue_size, 1, parsec_mca_sched_push_in_system_queue_wrapper,
+                                                (void*)sched_obj );
+    sched_obj->hierarch_queues[0] = sched_obj->task_queue;
+
+    /* All local allocations are now completed. Synchronize with the other
+     threads before setting up the entire queues hierarchy. */
+    parsec_barrier_wait(barrier);
+
+    nq = 1;
+#if defined(PARSEC_HAVE_HWLOC)
+    hwloc_levels = parsec_hwloc_nb_levels();
+#else
+    hwloc_levels = -1;
+#endif
+
+    /* Handle the case when HWLOC is present but cannot compute the hierarchy,
+     * as well as the case when HWLOC is missing.
+     */
+    if( hwloc_levels == -1 ) {
+        for( ; nq < sched_obj->nb_hierarch_queues; nq++ ) {
+            sched_obj->hierarch_queues[nq] =
+                PARSEC_MCA_SCHED_LOCAL_QUEUES_OBJECT(vp->execution_streams[(es->th_id + nq) % vp->nb_cores])->task_queue;
+        }
+#if defined(PARSEC_HAVE_HWLOC)
+    } else {
+        /* Then, they know about all other queues, from the closest to the farthest */
+        for(int level = 0; level <= hwloc_levels; level++) {
+            for(int id = (es->th_id + 1) % vp->nb_cores;
+                id != es->th_id;
+                id = (id + 1) %  vp->nb_cores) {
+                int d;
+                d = parsec_hwloc_distance(es->th_id, id);
+                if( d == 2*level || d == 2*level + 1 ) {
+                    sched_obj->hierarch_queues[nq] = PARSEC_MCA_SCHED_LOCAL_QUEUES_OBJECT(vp->execution_streams[id])->task_queue;
+                    PARSEC_DEBUG_VERBOSE(20, parsec_debug_output, "%d of %d: my %d preferred queue is the task queue of %d (%p)",
+                           es->th_id, es->virtual_process->vp_id, nq, id, sched_obj->hierarch_queues[nq]);
+                    nq++;
+                    if( nq == sched_obj->nb_hierarch_queues )
+                        break;
+                }
+            }
+            if( nq == sched_obj->nb_hierarch_queues )
+                break;
+        }
+        assert( nq == sched_obj->nb_hierarch_queues );
+#endif
+    }
+
+#if defined(PARSEC_PAPI_SDE)
+    if( 0 == es->th_id ) {
+        char event_name[PARSEC_PAPI_SDE_MAX_COUNTER_NAME_LEN];
+        int thid;
+        parsec_vp_t *vp;
+        snprintf(event_name, PARSEC_PAPI_SDE_MAX_COUNTER_NAME_LEN,
+                 "SCHEDULER::PENDING_TASKS::QUEUE=%d/overflow::SCHED=LA", es->virtual_process->vp_id);
+        parsec_papi_sde_register_fp_counter(event_name, PAPI_SDE_RO|PAPI_SDE_INSTANT,
+                                     PAPI_SDE_int, (papi_sde_fptr_t)parsec_mca_sched_system_queue_length, es->virtual_process);
+        parsec_papi_sde_add_counter_to_group(event_name,
+                                      "SCHEDULER::PENDING_TASKS", PAPI_SDE_SUM);
+        parsec_papi_sde_add_counter_to_group(event_name,
+                                      "SCHEDULER::PENDING_TASKS::SCHED=LA", PAPI_SDE_SUM);
+        vp = es->virtual_process;
+        for(thid = 0; thid < vp->nb_cores; thid++) {
+            snprintf(event_name, PARSEC_PAPI_SDE_MAX_COUNTER_NAME_LEN,
+                     "SCHEDULER::PENDING_TASKS::QUEUE=%d/%d::SCHED=LA", vp->vp_id, thid);
+            parsec_papi_sde_register_fp_counter(event_name, PAPI_SDE_RO|PAPI_SDE_INSTANT,
+                                         PAPI_SDE_int, (papi_sde_fptr_t)parsec_hbbuffer_approx_occupency,
+                                         PARSEC_MCA_SCHED_LOCAL_QUEUES_OBJECT(vp->execution_streams[thid])->task_queue);
+            parsec_papi_sde_add_counter_to_group(event_name,
+                                          "SCHEDULER::PENDING_TASKS", PAPI_SDE_SUM);
+            parsec_papi_sde_add_counter_to_group(event_name,
+                                          "SCHEDULER::PENDING_TASKS::SCHED=LA", PAPI_SDE_SUM);
+        }
+    }
+#endif
+
+    return PARSEC_SUCCESS;
+}
+
+/**
+ * Record that es is about to execute task: the data it has affinity
+ * with, and the inputs already attached to it that it is going to
+ * modify, will be hot in the caches of es.
+ */
+static void sched_la_record(parsec_execution_stream_t *es, const parsec_task_t *task)
+{
+    const parsec_task_class_t *tc = task->task_class;
+    parsec_data_ref_t ref;
+
+    if( NULL != tc->data_affinity ) {
+        ref.dc = NULL;
+        if( tc->data_affinity(task, &ref) && (NULL != ref.dc) )
+            sched_la_set_owner(ref.dc, ref.key, es);
+    }
+    for( int i = 0; i < tc->nb_flows; i++ ) {
+        const parsec_flow_t *flow = tc->in[i];
+        parsec_data_copy_t *copy;
+        if( (NULL == flow) || !(flow->flow_flags & PARSEC_FLOW_ACCESS_WRITE) ) continue;
+        copy = task->data[flow->flow_index].data_in;
+        if( (NULL == copy) || (NULL == copy->original) || (NULL == copy->original->dc) ) continue;
+        sched_la_set_owner(copy->original->dc, copy->original->key, es);
+    }
+}
+
+static parsec_task_t*
+sched_la_select(parsec_execution_stream_t *es,
+                int32_t* distance)
+{
+    parsec_task_t *task;
+
+    task = sched_la_select_task(es, distance);
+    if( NULL != task )
+        sched_la_record(es, task);
+    return task;
+}
+
+static parsec_task_t*
+sched_la_select_task(parsec_execution_stream_t *es,
+                     int32_t* distance)
+{
+    parsec_task_t *task = NULL;
+    task = (parsec_task_t*)parsec_hbbuffer_pop_best(PARSEC_MCA_SCHED_LOCAL_QUEUES_OBJECT(es)->task_queue,
+                                                                       parsec_execution_context_priority_comparator);
+    if( NULL != task ) {
+        *distance = 0;
+        return task;
+    }
+    for(int i = 0; i <  PARSEC_MCA_SCHED_LOCAL_QUEUES_OBJECT(es)->nb_hierarch_queues; i++ ) {
+        task = (parsec_task_t*)parsec_hbbuffer_pop_best(PARSEC_MCA_SCHED_LOCAL_QUEUES_OBJECT(es)->hierarch_queues[i],
+                                                                           parsec_execution_context_priority_comparator);
+        if( NULL != task ) {
+            PARSEC_DEBUG_VERBOSE(20, parsec_debug_output, "LQ\t: %d:%d found task %p in its %d-preferred hierarchical queue %p",
+                    es->virtual_process->vp_id, es->th_id, task, i, PARSEC_MCA_SCHED_LOCAL_QUEUES_OBJECT(es)->hierarch_queues[i]);
+            *distance = i + 1;
+            return task;
+        }
+    }
+
+    task = parsec_mca_sched_pop_from_system_queue_wrapper(PARSEC_MCA_SCHED_LOCAL_QUEUES_OBJECT(es));
+    if( NULL != task ) {
+        PARSEC_DEBUG_VERBOSE(20, parsec_debug_output, "LQ\t: %d:%d found task %p in its system queue %p",
+                es->virtual_process->vp_id, es->th_id, task, PARSEC_MCA_SCHED_LOCAL_QUEUES_OBJECT(es)->system_queue);
+        *distance = 1 + PARSEC_MCA_SCHED_LOCAL_QUEUES_OBJECT(es)->nb_hierarch_queues;
+    }
+    return task;
+}
+
+/**
+ * Returns the execution stream of the virtual process of es where most of
+ * the known inputs of task are resident, or es if none is known.
+ */
+static parsec_execution_stream_t *
+sched_la_preferred_stream(parsec_execution_stream_t *es, const parsec_task_t *task)
+{
+#define SCHED_LA_MAX_CANDIDATES (MAX_PARAM_COUNT + 1)
+    parsec_execution_stream_t *cand[SCHED_LA_MAX_CANDIDATES], *owner;
+    int votes[SCHED_LA_MAX_CANDIDATES], nb_cand = 0, best = -1;
+    const parsec_task_class_t *tc = task->task_class;
+    parsec_data_ref_t ref;
+
+    if( NULL != tc->data_affinity ) {
+        ref.dc = NULL;
+        if( tc->data_affinity(task, &ref) && (NULL != ref.dc) &&
+            (NULL != (owner = sched_la_owner(ref.dc, ref.key))) ) {
+            cand[0] = owner;
+            votes[0] = 1;
+            nb_cand = 1;
+        }
+    }
+    for( int i = 0; i < tc->nb_flows; i++ ) {
+        parsec_data_copy_t *copy = task->data[i].data_in;
+        int c;
+        if( (NULL == copy) || (NULL == copy->original) || (NULL == copy->original->dc) ) continue;
+        if( NULL == (owner = sched_la_owner(copy->original->dc, copy->original->key)) ) continue;
+        for( c = 0; (c < nb_cand) && (cand[c] != owner); c++ ) /* nothing */;
+        if( c == nb_cand ) {
+            if( SCHED_LA_MAX_CANDIDATES == nb_cand ) continue;
+            cand[c] = owner;
+            votes[c] = 0;
+            nb_cand++;
+        }
+        votes[c]++;
+    }
+    for( int c = 0; c < nb_cand; c++ ) {
+        /* the queues hierarchy does not span virtual processes */
+        if( cand[c]->virtual_process != es->virtual_process ) continue;
+        if( (-1 == best) || (votes[c] > votes[best]) ||
+            ((votes[c] == votes[best]) && (cand[c] == es)) )
+            best = c;
+    }
+    return (-1 == best) ? es : cand[best];
+#undef SCHED_LA_MAX_CANDIDATES
+}
+
+static int sched_la_schedule(parsec_execution_stream_t* es,
+                             parsec_task_t* new_context,
+                             int32_t distance)
+{
+    parsec_mca_sched_local_queues_scheduler_object_t *sched_obj = PARSEC_MCA_SCHED_LOCAL_QUEUES_OBJECT(es);
+    parsec_list_item_t *local = NULL, *next, *item = (parsec_list_item_t*)new_context;
+    long long int local_load = -1;
+
+    if( 0 != distance ) {
+        /* the caller explicitly asked to delay these tasks */
+        parsec_hbbuffer_push_all(sched_obj->task_queue, item, distance);
+        return PARSEC_SUCCESS;
+    }
+
+    while( NULL != item ) {
+        parsec_execution_stream_t *target;
+        next = parsec_list_item_ring_chop(item);
+        PARSEC_LIST_ITEM_SINGLETON(item);
+
+        target = sched_la_preferred_stream(es, (parsec_task_t*)item);
+        if( target != es ) {
+            parsec_hbbuffer_t *target_queue = PARSEC_MCA_SCHED_LOCAL_QUEUES_OBJECT(target)->task_queue;
+            if( -1 == local_load )
+                local_load = parsec_hbbuffer_approx_occupency(sched_obj->task_queue);
+            if( parsec_hbbuffer_approx_occupency(target_queue) <= local_load + sched_la_imbalance ) {
+                PARSEC_DEBUG_VERBOSE(20, parsec_debug_output, "LA\t: %d:%d pushes task %p close to its data in the queue of %d",
+                                     es->virtual_process->vp_id, es->th_id, item, target->th_id);
+                parsec_hbbuffer_push_all(target_queue, item, 0);
+                SCHED_LA_OBJECT(es)->nb_moved++;
+                item = next;
+                continue;
+            }
+            SCHED_LA_OBJECT(es)->nb_imbalanced++;
+        } else {
+            SCHED_LA_OBJECT(es)->nb_local++;
+        }
+        local = (NULL == local) ? item : parsec_list_item_ring_push(local, item);
+        item = next;
+    }
+    if( NULL != local )
+        parsec_hbbuffer_push_all(sched_obj->task_queue, local, 0);
+    return PARSEC_SUCCESS;
+}
+
+static void sched_la_remove( parsec_context_t *master )
+{
+    int p, t;
+    parsec_execution_stream_t *es;
+    parsec_vp_t *vp;
+    parsec_mca_sched_local_queues_scheduler_object_t *sched_obj;
+
+    for(p = 0; p < master->nb_vp; p++) {
+        vp = master->virtual_processes[p];
+        for(t = 0; t < vp->nb_cores; t++) {
+            es = vp->execution_streams[t];
+            if (es != NULL) {
+                sched_obj = PARSEC_MCA_SCHED_LOCAL_QUEUES_OBJECT(es);
+                PARSEC_DEBUG_VERBOSE(10, parsec_debug_output, "LA\t: %d:%d placed %"PRId64" tasks locally, %"PRId64" close to their data "
+                                     "and %"PRId64" locally because of the imbalance",
+                                     vp->vp_id, t, SCHED_LA_OBJECT(es)->nb_local, SCHED_LA_OBJECT(es)->nb_moved,
+                                     SCHED_LA_OBJECT(es)->nb_imbalanced);
+
+                if( es->th_id == 0 ) {
+                    PARSEC_OBJ_DESTRUCT( sched_obj->system_queue );
+                    free( sched_obj->system_queue );
+                }
+                sched_obj->system_queue = NULL;
+
+                parsec_hbbuffer_destruct( sched_obj->task_queue );
+                sched_obj->task_queue = NULL;
+
+                free(sched_obj->hierarch_queues);
+                sched_obj->hierarch_queues = NULL;
+
+                free(es->scheduler_object);
+                es->scheduler_object = NULL;
+            }
+            // else the scheduler wasn't really initialized anyway
+            PARSEC_PAPI_SDE_UNREGISTER_COUNTER("SCHEDULER::PENDING_TASKS::QUEUE=%d/%d::SCHED=LA", vp->vp_id, t);
+        }
+        PARSEC_PAPI_SDE_UNREGISTER_COUNTER("SCHEDULER::PENDING_TASKS::QUEUE=%d/overflow::SCHED=LA", p);
+    }
+    PARSEC_PAPI_SDE_UNREGISTER_COUNTER("SCHEDULER::PENDING_TASKS::SCHED=LA");
+
+    free((void*)sched_la_table);
+    sched_la_table = NULL;
+}
@@ -35,6 +35,9 @@ PARSEC_DECLSPEC extern const parsec_sched_module_t parsec_sched_lfq_module;
 /* static accessor */
 mca_base_component_t *sched_lfq_static_component(void);
 
+/** Capacity, per execution stream, of the lock-free front of the system queue */
+extern int sched_lfq_system_ring_size;
+
 
 END_C_DECLS
 #endif /* MCA_SCHED_LFQ_H */
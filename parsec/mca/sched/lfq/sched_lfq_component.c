@@ -21,6 +21,7 @@
 #include "parsec/mca/sched/sched.h"
 #include "parsec/mca/sched/lfq/sched_lfq.h"
 #include "parsec/papi_sde.h"
+#include "parsec/utils/mca_param.h"
 
 /*
  * Local function
@@ -75,8 +76,14 @@ static int sched_lfq_component_query(mca_base_module_t **module, int *priority)
     return MCA_SUCCESS;
 }
 
+int sched_lfq_system_ring_size = 256;
+
 static int sched_lfq_component_register(void)
 {
+    (void)parsec_mca_param_reg_int_name("sched_lfq", "system_ring_size",
+                                        "Number of tasks per execution stream the lock-free ring in front of the overflow queue "
+                                        "of a virtual process holds (0 to only use the locked overflow queue)",
+                                        false, false, sched_lfq_system_ring_size, &sched_lfq_system_ring_size);
     PARSEC_PAPI_SDE_DESCRIBE_COUNTER("SCHEDULER::PENDING_TASKS::SCHED=LFQ",
                               "the number of pending tasks for the LFQ scheduler");
     PARSEC_PAPI_SDE_DESCRIBE_COUNTER("SCHEDULER::PENDING_TASKS::QUEUE=<VPID>/<QID>::SCHED=LFQ",
@@ -69,6 +69,14 @@ static int flow_lfq_init(parsec_execution_stream_t* es, struct parsec_barrier_t*
     es->scheduler_object = sched_obj;
     if( 0 == es->th_id ) {  /* And flow 0 creates the system_queue */
         sched_obj->system_queue = PARSEC_OBJ_NEW(parsec_dequeue_t);
+        if( sched_lfq_system_ring_size > 0 ) {
+            sched_obj->system_ring = PARSEC_OBJ_NEW(parsec_mpmc_ring_t);
+            if( PARSEC_SUCCESS != parsec_mpmc_ring_init(sched_obj->system_ring,
+                                                        (size_t)sched_lfq_system_ring_size * vp->nb_cores) ) {
+                PARSEC_OBJ_RELEASE(sched_obj->system_ring);
+                sched_obj->system_ring = NULL;
+            }
+        }
     }
 
     sched_obj->nb_hierarch_queues = vp->nb_cores;
@@ -81,6 +89,7 @@ static int flow_lfq_init(parsec_execution_stream_t* es, struct parsec_barrier_t*
 
     /* Get the flow 0 system queue and store it locally */
     sched_obj->system_queue = PARSEC_MCA_SCHED_LOCAL_QUEUES_OBJECT(vp->execution_streams[0])->system_queue;
+    sched_obj->system_ring = PARSEC_MCA_SCHED_LOCAL_QUEUES_OBJECT(vp->execution_streams[0])->system_ring;
 
     /* Each thread creates its own "local" queue, connected to the shared dequeue */
     sched_obj->task_queue = parsec_hbbuffer_new( queue_size, 1, parsec_mca_sched_push_in_system_queue_wrapper,
@@ -220,8 +229,13 @@ static void sched_lfq_remove( parsec_context_t *master )
                 if( es->th_id == 0 ) {
                     PARSEC_OBJ_DESTRUCT( sched_obj->system_queue );
                     free( sched_obj->system_queue );
+                    if( NULL != sched_obj->system_ring ) {
+                        assert(parsec_mpmc_ring_is_empty(sched_obj->system_ring));
+                        PARSEC_OBJ_RELEASE(sched_obj->system_ring);
+                    }
                 }
                 sched_obj->system_queue = NULL;
+                sched_obj->system_ring  = NULL;
 
                 parsec_hbbuffer_destruct( sched_obj->task_queue );
                 sched_obj->task_queue = NULL;
@@ -339,6 +339,72 @@ typedef struct parsec_sched_module_s {
     parsec_sched_base_module_t           module;
 } parsec_sched_module_t;
 
+/**
+ * @brief Scheduler instrumentation
+ *
+ * @details
+ * When the runtime_sched_stats MCA parameter is set, each computation
+ * execution stream owns a parsec_sched_stats_t (es->sched_stats, NULL
+ * otherwise) in which the generic scheduling layer and the scheduler
+ * components report what happens to the tasks:
+ *   - the number of tasks pushed to and popped from each level of the
+ *     queue hierarchy. The levels follow the distance returned by the
+ *     select function: 0 for the queue local to the stream, i+1 for the
+ *     queue of the i-th closest stream, and the last levels for the shared
+ *     overflow queues. The pops by level are thus the histogram of the steal
+ *     distances. The generic layer counts all the pushes at level 0, the
+ *     schedulers report with parsec_sched_stats_push() the tasks that
+ *     overflow from one level into the next.
+ *   - the time the tasks spend in the queues, from the call to schedule
+ *     to their selection.
+ *   - the number of tasks pending in the queues, sampled every
+ *     PARSEC_SCHED_STATS_DEPTH_PERIOD selections of each stream.
+ * The counters of each stream are exported through PAPI-SDE as
+ * SCHEDULER::{PUSHES,POPS}::LEVEL=<l>::QUEUE=<vp>/<th>,
+ * SCHEDULER::QUEUE_TIME::QUEUE=<vp>/<th> and
+ * SCHEDULER::QUEUE_DEPTH::QUEUE=<vp>/<th> (and the groups without the
+ * queue); the queue depth samples are traced as sched_queue_depth counter
+ * events, and the statistics are summarized at finalization.
+ */
+#define PARSEC_SCHED_STATS_NB_LEVELS    16  /**< Deeper levels are accounted in the last one */
+#define PARSEC_SCHED_STATS_DEPTH_PERIOD 64
+
+typedef struct parsec_sched_stats_s {
+    long long pushes[PARSEC_SCHED_STATS_NB_LEVELS]; /**< Tasks entering the queues of each level */
+    long long pops[PARSEC_SCHED_STATS_NB_LEVELS];   /**< Tasks selected at each distance */
+    long long next_task_pops;  /**< Tasks executed from next_task, without going through the queues */
+    long long failed_selects;  /**< Selections that did not find any task */
+    long long queue_time;      /**< Cumulated time (in TIMER_UNIT) between schedule and select */
+    long long queue_time_max;
+    long long balance;         /**< Tasks pushed minus tasks popped by this stream */
+    long long depth;           /**< Last sample of the number of pending tasks */
+    long long depth_sum;
+    long long depth_max;
+    long long depth_samples;
+    int       depth_countdown; /**< Selections before the next sample of the depth */
+} parsec_sched_stats_t;
+
+/**
+ * @brief Report nb tasks entering the queues at the given level of the
+ *        hierarchy, on behalf of the stream es (NULL or not instrumented
+ *        streams are ignored).
+ */
+static inline void parsec_sched_stats_push(parsec_execution_stream_t *es, int level, long long nb)
+{
+    if( (NULL == es) || (NULL == es->sched_stats) ) return;
+    if( level >= PARSEC_SCHED_STATS_NB_LEVELS ) level = PARSEC_SCHED_STATS_NB_LEVELS - 1;
+    es->sched_stats->pushes[level] += nb;
+}
+
+/**
+ * @brief Sum the statistics of all the execution streams of the context
+ *        in total (the maximums are the maximums over all the streams).
+ *
+ * @return PARSEC_SUCCESS, or PARSEC_ERR_NOT_FOUND if the scheduler
+ *         instrumentation is disabled.
+ */
+PARSEC_DECLSPEC int parsec_sched_stats_collect(parsec_context_t *context, parsec_sched_stats_t *total);
+
 /**
  * Macro for use in components that are of type sched
  */
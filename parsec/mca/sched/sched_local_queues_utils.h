@@ -19,10 +19,15 @@
 #define _SCHED_LOCAL_QUEUES_UTILS_H
 
 #include "parsec/parsec_config.h"
+#include "parsec/runtime.h"
 #include "parsec/hbbuffer.h"
+#include "parsec/mca/sched/sched.h"
+#include "parsec/class/mpmc_ring.h"
 
 typedef struct {
     parsec_dequeue_t   *system_queue;               /* The overflow queue itself. */
+    parsec_mpmc_ring_t *system_ring;                /* Optional lock-free front of the overflow queue,
+                                                     * the system_queue only gets what does not fit */
 #if defined(PARSEC_PAPI_SDE)
     int                 local_system_queue_balance; /* A local sum of how many elements have been pushed / poped
                                                      * out of the system queue -- used for lockfree statistics and
@@ -61,7 +66,14 @@ static inline long long int parsec_mca_sched_system_queue_length( parsec_vp_t *v
 
 static inline parsec_task_t *parsec_mca_sched_pop_from_system_queue_wrapper(parsec_mca_sched_local_queues_scheduler_object_t *sched_obj)
 {
-    parsec_task_t *task = (parsec_task_t*)parsec_dequeue_try_pop_front(sched_obj->system_queue);
+    parsec_task_t *task = NULL;
+    /* What overflowed the ring is older, drain it first */
+    if( (NULL == sched_obj->system_ring) || !parsec_dequeue_nolock_is_empty(sched_obj->system_queue) )
+        task = (parsec_task_t*)parsec_dequeue_try_pop_front(sched_obj->system_queue);
+    if( (NULL == task) && (NULL != sched_obj->system_ring) ) {
+        task = (parsec_task_t*)parsec_mpmc_ring_pop(sched_obj->system_ring);
+        if( NULL != task ) PARSEC_LIST_ITEM_SINGLETON(task);
+    }
 #if defined(PARSEC_PAPI_SDE)
     if( task != NULL )
         sched_obj->local_system_queue_balance--;
@@ -72,12 +84,43 @@ static inline parsec_task_t *parsec_mca_sched_pop_from_system_queue_wrapper(pars
 static inline void parsec_mca_sched_push_in_system_queue_wrapper(void *sobj, parsec_list_item_t *elt, int32_t distance)
 {
     parsec_mca_sched_local_queues_scheduler_object_t *obj = (parsec_mca_sched_local_queues_scheduler_object_t*)sobj;
+    parsec_execution_stream_t *es = parsec_my_execution_stream();
 #if defined(PARSEC_PAPI_SDE)
     int len = 0;
     _LIST_ITEM_ITERATOR(elt, elt, item, {len++; });
     obj->local_system_queue_balance += len;
 #endif
-    parsec_dequeue_chain_back( obj->system_queue, elt );
+    if( (NULL != es) && (NULL != es->sched_stats) ) {
+        /* the overflow queue is selected at the distance following the hierarch_queues */
+        long long nb = 0;
+        _LIST_ITEM_ITERATOR(elt, elt, item, {nb++; });
+        parsec_sched_stats_push(es, obj->nb_hierarch_queues + 1, nb);
+    }
+    if( NULL != obj->system_ring ) {
+        /* Move the tasks into the system ring by batches while it has room,
+         * and chain what does not fit in the system queue */
+        void *batch[32];
+        parsec_list_item_t *rest = elt, *item;
+        int nb, pushed;
+        while( NULL != rest ) {
+            for( nb = 0; (nb < 32) && (NULL != rest); nb++ ) {
+                item = rest;
+                rest = parsec_list_item_ring_chop(item);
+                batch[nb] = parsec_list_item_singleton(item);
+            }
+            pushed = parsec_mpmc_ring_push_batch(obj->system_ring, batch, nb);
+            if( pushed < nb ) {
+                for( int i = pushed + 1; i < nb; i++ )
+                    parsec_list_item_ring_push((parsec_list_item_t*)batch[pushed], (parsec_list_item_t*)batch[i]);
+                if( NULL != rest )
+                    parsec_list_item_ring_merge((parsec_list_item_t*)batch[pushed], rest);
+                parsec_dequeue_chain_back( obj->system_queue, (parsec_list_item_t*)batch[pushed] );
+                break;
+            }
+        }
+    } else {
+        parsec_dequeue_chain_back( obj->system_queue, elt );
+    }
     (void)distance;
 }
 
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2026      The University of Tennessee and The University
+ *                         of Tennessee Research Foundation.  All rights
+ *                         reserved.
+ */
+
+#include "parsec/parsec_config.h"
+#include "parsec/parking_lot.h"
+#include "parsec/utils/futex.h"
+#include "parsec/utils/debug.h"
+
+#include <string.h>
+#include <time.h>
+
+static inline int64_t parsec_parking_lot_now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+void parsec_parking_lot_init(parsec_parking_lot_t *lot)
+{
+    memset((void*)lot, 0, sizeof(parsec_parking_lot_t));
+}
+
+void parsec_parking_lot_park(parsec_parking_lot_t *lot, int32_t epoch, int timeout_us)
+{
+    struct timespec timeout;
+    int64_t latency, max;
+
+    timeout.tv_sec  = timeout_us / 1000000;
+    timeout.tv_nsec = (long)(timeout_us % 1000000) * 1000;
+
+    parsec_atomic_fetch_inc_int64(&lot->nb_parks);
+    if( 0 != parsec_futex_wait(&lot->epoch, epoch, &timeout) ) {
+        parsec_atomic_fetch_inc_int64(&lot->nb_timeouts);
+        return;
+    }
+    if( epoch == lot->epoch )  /* spurious wake up */
+        return;
+    parsec_atomic_fetch_inc_int64(&lot->nb_wakeups);
+    latency = parsec_parking_lot_now() - lot->last_wake_ns;
+    if( latency < 0 ) return;  /* a more recent wake up than ours */
+    parsec_atomic_fetch_add_int64(&lot->sum_latency_ns, latency);
+    while( latency > (max = lot->max_latency_ns) ) {
+        if( parsec_atomic_cas_int64(&lot->max_latency_ns, max, latency) )
+            break;
+    }
+}
+
+void parsec_parking_lot_wake(parsec_parking_lot_t *lot, int nb)
+{
+    int32_t parked = lot->nb_parked;
+
+    if( nb > parked ) nb = parked;
+    if( nb <= 0 ) return;
+    lot->last_wake_ns = parsec_parking_lot_now();
+    parsec_atomic_fetch_inc_int32(&lot->epoch);
+    parsec_futex_wake(&lot->epoch, nb);
+}
+
+void parsec_parking_lot_report(parsec_parking_lot_t *lot)
+{
+    parsec_inform("Idle parking: %lld parks, %lld woken up (mean latency %.2f us, max %.2f us), %lld timeouts",
+                  (long long)lot->nb_parks, (long long)lot->nb_wakeups,
+                  (0 == lot->nb_wakeups) ? 0.0 : (double)lot->sum_latency_ns / (double)lot->nb_wakeups / 1e3,
+                  (double)lot->max_latency_ns / 1e3, (long long)lot->nb_timeouts);
+}
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2026      The University of Tennessee and The University
+ *                         of Tennessee Research Foundation.  All rights
+ *                         reserved.
+ */
+
+#ifndef PARSEC_PARKING_LOT_H_HAS_BEEN_INCLUDED
+#define PARSEC_PARKING_LOT_H_HAS_BEEN_INCLUDED
+
+#include "parsec/parsec_config.h"
+#include "parsec/sys/atomic.h"
+
+/**
+ * @defgroup parsec_internal_parking_lot Parking lot
+ * @ingroup parsec_internal
+ * @{
+ *
+ * @brief Where idle execution streams block until new tasks are scheduled.
+ *
+ * @details An idle thread first registers itself with
+ *   parsec_parking_lot_enter(), checks one last time for work, and then
+ *   blocks with parsec_parking_lot_park() until the epoch of the lot changes.
+ *   The threads scheduling tasks call parsec_parking_lot_notify() after the
+ *   tasks are visible to the scheduler, which wakes at most as many threads
+ *   as there are new tasks. Registering before the last check and notifying
+ *   after the push guarantees that no task is left behind with everybody
+ *   parked; a timeout bounds the sleep in case some path making work
+ *   available does not notify the lot.
+ */
+
+BEGIN_C_DECLS
+
+typedef struct parsec_parking_lot_s {
+    volatile int32_t epoch;           /**< Bumped on each wake up, futex word of the parked threads */
+    volatile int32_t nb_parked;       /**< Number of threads registered as parked */
+    volatile int64_t last_wake_ns;    /**< Date of the last wake up, to measure the latency */
+    volatile int64_t nb_parks;        /**< Number of times a thread blocked */
+    volatile int64_t nb_wakeups;      /**< Number of blocks ended by a wake up */
+    volatile int64_t nb_timeouts;     /**< Number of blocks ended by the timeout */
+    volatile int64_t sum_latency_ns;  /**< Sum of the wake up latencies */
+    volatile int64_t max_latency_ns;  /**< Largest wake up latency */
+} parsec_parking_lot_t;
+
+void parsec_parking_lot_init(parsec_parking_lot_t *lot);
+
+/**
+ * Register the calling thread as parked, and return the epoch to pass to
+ * parsec_parking_lot_park(). The caller must look for work once more
+ * before parking, and call parsec_parking_lot_leave() in all cases.
+ */
+static inline int32_t parsec_parking_lot_enter(parsec_parking_lot_t *lot)
+{
+    parsec_atomic_fetch_inc_int32(&lot->nb_parked);
+    return lot->epoch;
+}
+
+static inline void parsec_parking_lot_leave(parsec_parking_lot_t *lot)
+{
+    parsec_atomic_fetch_dec_int32(&lot->nb_parked);
+}
+
+/**
+ * Block until the epoch moves past epoch, or at most timeout_us
+ * microseconds.
+ */
+void parsec_parking_lot_park(parsec_parking_lot_t *lot, int32_t epoch, int timeout_us);
+
+/** Wake up to nb parked threads, use the notify fast path instead. */
+void parsec_parking_lot_wake(parsec_parking_lot_t *lot, int nb);
+
+/**
+ * Signal that nb new tasks are available. Must be called once the tasks
+ * are visible to the other threads.
+ */
+static inline void parsec_parking_lot_notify(parsec_parking_lot_t *lot, int nb)
+{
+    parsec_mfence();
+    if( 0 != lot->nb_parked )
+        parsec_parking_lot_wake(lot, nb);
+}
+
+/** Print the statistics of the lot with parsec_inform */
+void parsec_parking_lot_report(parsec_parking_lot_t *lot);
+
+END_C_DECLS
+
+/** @} */
+
+#endif  /* PARSEC_PARKING_LOT_H_HAS_BEEN_INCLUDED */
@@ -32,10 +32,14 @@
 #include "parsec/class/list.h"
 #include "parsec/scheduling.h"
 #include "parsec/class/barrier.h"
+#include "parsec/parking_lot.h"
 #include "parsec/remote_dep.h"
 #include "parsec/datarepo.h"
 #include "parsec/bindthread.h"
 #include "parsec/parsec_prof_grapher.h"
+#if defined(PARSEC_SIM)
+#include "parsec/parsec_sim.h"
+#endif  /* defined(PARSEC_SIM) */
 #include "parsec/vpmap.h"
 #include "parsec/class/info.h"
 #include "parsec/utils/mca_param.h"
@@ -153,6 +157,13 @@ static int parsec_runtime_bind_main_thread = 0;
 static int parsec_runtime_bind_threads     = 0;
 
 int parsec_runtime_keep_highest_priority_task = 1;
+int parsec_runtime_keep_highest_priority_task_depth = 32;
+int parsec_runtime_task_fusion = 1;
+int parsec_runtime_sched_stats = 0;
+int parsec_runtime_idle_park = 0;
+int parsec_runtime_idle_spin = 32;
+int parsec_runtime_idle_park_timeout = 1000;
+static int parsec_runtime_idle_stats = 0;
 
 static PARSEC_TLS_DECLARE(parsec_tls_execution_stream);
 
@@ -215,6 +226,7 @@ static void __parsec_task_constructor(parsec_task_t* task) {
     task->selected_chore = -1;
     task->load = 0;
     task->status = PARSEC_TASK_STATUS_NONE;
+    task->remote_stats = NULL;
 }
 
 /*
@@ -271,6 +283,9 @@ static void* __parsec_thread_init( __parsec_temporary_thread_initialization_t* s
     es->rand_seed        = tv_now.tv_usec + startup->th_id;
     es->scheduler_object = NULL;
     es->next_task        = NULL;
+    es->next_task_depth  = 0;
+    es->sched_stats      = NULL;
+    es->remote_stats     = NULL;
     startup->virtual_process->execution_streams[startup->th_id] = es;
     es->core_id          = startup->bindto;
 #if defined(PARSEC_HAVE_HWLOC)
@@ -307,6 +322,7 @@ static void* __parsec_thread_init( __parsec_temporary_thread_initialization_t* s
 
     if( NULL != parsec_current_scheduler->module.flow_init )
         parsec_current_scheduler->module.flow_init(es, startup->barrier);
+    parsec_sched_stats_init(es);
 
     es->context_mempool = &(es->virtual_process->context_mempool.thread_mempools[es->th_id]);
     for(pi = 0; pi <= MAX_PARAM_COUNT; pi++) {
@@ -540,6 +556,46 @@ parsec_context_t* parsec_init( int nb_cores, int* pargc, char** pargv[] )
      */
     parsec_mca_param_reg_int_name("runtime", "keep_highest_priority_task", "Allow a compute thread to retain the highest priority task to be executed locally. This change makes the scheduling decision non-deterministic because some tasks will never be handled to the scheduler.", false, false,
                                   parsec_runtime_keep_highest_priority_task, &parsec_runtime_keep_highest_priority_task);
+    parsec_mca_param_reg_int_name("runtime", "keep_highest_priority_task_depth", "Maximum number of tasks a compute thread executes in a row by retaining the highest priority successor of the previous one. Once reached, the successor is given to the scheduler, so that the other ready tasks get a chance to run (0 for no limit).", false, false,
+                                  parsec_runtime_keep_highest_priority_task_depth, &parsec_runtime_keep_highest_priority_task_depth);
+    parsec_mca_param_reg_int_name("runtime", "task_fusion", "Allow the hooks generated by the PTG compiler for the links of one-to-one chains of tasks (ptgpp --no-fusion to disable) to run the successor of a task right away, when it is local and of the same class, instead of releasing it to the scheduler.", false, false,
+                                  parsec_runtime_task_fusion, &parsec_runtime_task_fusion);
+#if defined(PARSEC_SIM) || defined(PARSEC_PROF_GRAPHER)
+    /* The simulation dates and the DAG traces follow the released dependencies */
+    parsec_runtime_task_fusion = 0;
+#endif  /* defined(PARSEC_SIM) || defined(PARSEC_PROF_GRAPHER) */
+    parsec_mca_param_reg_int_name("runtime", "sched_stats", "Account per execution stream the tasks pushed and popped at each level of the scheduler queues, the time they spend in the queues and the depth of the queues. The counters are exported through PAPI-SDE and profiling, and reported at finalization.", false, false,
+                                  parsec_runtime_sched_stats, &parsec_runtime_sched_stats);
+
+    /* MCA params controlling what the execution streams do when they run
+     * out of work: block in the parking lot of the context until new tasks
+     * are scheduled, or poll the scheduler with an exponential backoff.
+     */
+    {
+        char *idle_policy = NULL;
+        parsec_mca_param_reg_string_name("runtime", "idle_policy", "What an execution stream does when it runs out of work: "
+                                         "\"park\" blocks until new tasks are scheduled, \"backoff\" sleeps for increasing "
+                                         "amounts of time between attempts to find work.", false, false,
+                                         parsec_runtime_idle_park ? "park" : "backoff", &idle_policy);
+        if( NULL != idle_policy ) {
+            if( !strcmp(idle_policy, "park") ) {
+                parsec_runtime_idle_park = 1;
+            } else if( !strcmp(idle_policy, "backoff") ) {
+                parsec_runtime_idle_park = 0;
+            } else {
+                parsec_warning("Unknown idle policy %s (possible values are park and backoff), using %s",
+                               idle_policy, parsec_runtime_idle_park ? "park" : "backoff");
+            }
+        }
+    }
+    parsec_mca_param_reg_int_name("runtime", "idle_spin", "Number of failed attempts to find work before an execution stream parks itself.",
+                                  false, false, parsec_runtime_idle_spin, &parsec_runtime_idle_spin);
+    parsec_mca_param_reg_int_name("runtime", "idle_park_timeout", "Maximum time (in microseconds) an execution stream stays parked "
+                                  "before looking for work again.", false, false,
+                                  parsec_runtime_idle_park_timeout, &parsec_runtime_idle_park_timeout);
+    if( parsec_runtime_idle_park_timeout <= 0 ) parsec_runtime_idle_park_timeout = 1000;
+    parsec_mca_param_reg_int_name("runtime", "idle_stats", "Report the parking and wake up latency statistics of the idle execution streams at finalization.",
+                                  false, false, parsec_runtime_idle_stats, &parsec_runtime_idle_stats);
 
     /*
      * Initialize the VPMAP, the discrete domains hosting
@@ -610,6 +666,8 @@ parsec_context_t* parsec_init( int nb_cores, int* pargc, char** pargv[] )
     parsec_hash_table_init(&context->dtd_arena_datatypes_hash_table, offsetof(parsec_arena_datatype_t, ht_item),
                            8, parsec_hash_table_generic_key_fn, NULL);
     context->dtd_arena_datatypes_next_id = 0;
+    context->parking_lot         = (parsec_parking_lot_t*)malloc(sizeof(parsec_parking_lot_t));
+    parsec_parking_lot_init(context->parking_lot);
 #if defined(PARSEC_SIM)
     context->largest_simulation_date = 0;
 #endif /* PARSEC_SIM */
@@ -790,6 +848,10 @@ parsec_context_t* parsec_init( int nb_cores, int* pargc, char** pargv[] )
     }
 #endif  /* defined(PARSEC_PROF_GRAPHER) */
 
+#if defined(PARSEC_SIM)
+    parsec_sim_init(context);
+#endif  /* defined(PARSEC_SIM) */
+
 #if defined(PARSEC_DEBUG_NOISIER) || defined(PARSEC_DEBUG_PARANOID)
     slow_option_used = 1;
 #endif
@@ -1225,6 +1287,9 @@ int parsec_fini( parsec_context_t** pcontext )
     parsec_mempool_stats(context);
 #endif  /* PARSEC_PROF_TRACE */
 
+    /* Report the scheduler statistics, and stop exposing them to PAPI SDE */
+    parsec_sched_stats_fini(context);
+
     /* PAPI SDE needs to process the shutdown before resources exposed to it are freed.
      * This includes scheduling resources, so SDE needs to be finalized before the 
      * computation threads leave */
@@ -1255,9 +1320,18 @@ int parsec_fini( parsec_context_t** pcontext )
         free(parsec_dot_file);
         parsec_dot_file = NULL;
     }
+#if defined(PARSEC_SIM)
+    parsec_sim_fini();
+#endif  /* defined(PARSEC_SIM) */
     /* Destroy all resources allocated for the barrier */
     parsec_barrier_destroy( &(context->barrier) );
 
+    if( parsec_runtime_idle_stats ) {
+        parsec_parking_lot_report(context->parking_lot);
+    }
+    free(context->parking_lot);
+    context->parking_lot = NULL;
+
 #if defined(PARSEC_HAVE_HWLOC_BITMAP)
     /* Release thread binding masks */
     hwloc_bitmap_free(context->cpuset_allowed_mask);
@@ -1704,6 +1778,9 @@ parsec_release_local_OUT_dependencies(parsec_execution_stream_t* es,
 #if defined(PARSEC_PROF_GRAPHER)
     parsec_prof_grapher_dep(origin, task, completed, origin_flow, dest_flow);
 #endif  /* defined(PARSEC_PROF_GRAPHER) */
+#if defined(PARSEC_SIM)
+    parsec_sim_dep(origin, task, (NULL != data) ? data->data : NULL);
+#endif  /* defined(PARSEC_SIM) */
 
     if( completed ) {
 
@@ -1819,22 +1896,18 @@ parsec_release_dep_fct(parsec_execution_stream_t *es,
 
         if( arg->action_mask & PARSEC_ACTION_SEND_INIT_REMOTE_DEPS ){
             struct remote_dep_output_param_s* output;
-            uint32_t _array_pos, _array_bit, _array_mask;
 
 #if !defined(PARSEC_DIST_COLLECTIVES)
             assert(src_rank == es->virtual_process->parsec_context->my_rank);
 #endif
-            remote_dep_rank_to_bit(dst_rank, &_array_pos, &_array_bit, src_rank);
-            _array_mask = 1 << _array_bit;
             PARSEC_ALLOCATE_REMOTE_DEPS_IF_NULL(arg->remote_deps, oldcontext, MAX_PARAM_COUNT);
             output = &arg->remote_deps->output[dep->dep_datatype_index];
             assert( (-1 == arg->remote_deps->root) || (arg->remote_deps->root == src_rank) );
             arg->remote_deps->root = src_rank;
             arg->remote_deps->outgoing_mask |= (1 << dep->dep_datatype_index);
-            if( !(output->rank_bits[_array_pos] & _array_mask) ) {
-                output->rank_bits[_array_pos] |= _array_mask;
+            if( remote_dep_rank_set_add(&output->ranks, remote_dep_rank_to_pos(dst_rank, src_rank)) ) {
                 output->deps_mask |= (1 << dep->dep_index);
-                if( 0 == output->count_bits ) {
+                if( 1 == output->ranks.count ) {
                     output->data = *data;
                     assert(output->data.data_future == NULL);
 #ifdef PARSEC_RESHAPE_BEFORE_SEND_TO_REMOTE
@@ -1863,13 +1936,12 @@ parsec_release_dep_fct(parsec_execution_stream_t *es,
                     assert( !((entry_for_reshapping != NULL) && (entry_for_reshapping->data[dst_flow->flow_index] != NULL)) );
 #endif
                 }
-                output->count_bits++;
                 if(newcontext->priority > output->priority) {
                     output->priority = newcontext->priority;
                     if(newcontext->priority > arg->remote_deps->max_priority)
                         arg->remote_deps->max_priority = newcontext->priority;
                 }
-            }  /* otherwise the bit is already flipped, the peer is already part of the propagation. */
+            }  /* otherwise the peer is already part of the propagation. */
             else{
                 assert(output->data.data == data->data);
 #ifdef PARSEC_RESHAPE_BEFORE_SEND_TO_REMOTE
@@ -1904,6 +1976,35 @@ parsec_release_dep_fct(parsec_execution_stream_t *es,
     return PARSEC_ITERATE_CONTINUE;
 }
 
+parsec_ontask_iterate_t
+parsec_fuse_successor_fct(parsec_execution_stream_t *es,
+                          const parsec_task_t *newcontext,
+                          const parsec_task_t *oldcontext,
+                          const parsec_dep_t* dep,
+                          parsec_dep_data_description_t* data,
+                          int src_rank, int dst_rank, int dst_vpid,
+                          data_repo_t *successor_repo, parsec_key_t successor_repo_key,
+                          void *param)
+{
+    parsec_fuse_successor_arg_t *arg = (parsec_fuse_successor_arg_t *)param;
+    (void)dep; (void)src_rank; (void)successor_repo; (void)successor_repo_key;
+
+    /* The task can only become its successor if it is the only one, and
+     * if it runs here, on the same data */
+    if( (0 != arg->nb_successors) ||
+        (newcontext->task_class != oldcontext->task_class) ||
+        (es->virtual_process->parsec_context->my_rank != dst_rank) ||
+        (es->virtual_process->vp_id != dst_vpid) ||
+        (NULL == data->data) ) {
+        arg->nb_successors = -1;
+        return PARSEC_ITERATE_STOP;
+    }
+    arg->nb_successors = 1;
+    arg->priority = newcontext->priority;
+    memcpy(arg->locals, newcontext->locals, newcontext->task_class->nb_locals * sizeof(parsec_assignment_t));
+    return PARSEC_ITERATE_CONTINUE;
+}
+
 /*
  * Convert the execution context to a string.
  */
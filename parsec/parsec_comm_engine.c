@@ -5,8 +5,15 @@
  */
 
 #include <assert.h>
+#include <stdlib.h>
+#include <string.h>
 #include "parsec/parsec_mpi_funnelled.h"
+#if defined(PARSEC_HAVE_SYS_EPOLL_H)
+#include "parsec/parsec_tcp.h"
+#endif  /* defined(PARSEC_HAVE_SYS_EPOLL_H) */
 #include "parsec/remote_dep.h"
+#include "parsec/utils/debug.h"
+#include "parsec/utils/mca_param.h"
 
 parsec_comm_engine_t parsec_ce;
 
@@ -14,8 +21,28 @@ parsec_comm_engine_t parsec_ce;
 parsec_comm_engine_t *
 parsec_comm_engine_init(parsec_context_t *parsec_context)
 {
+    parsec_comm_engine_t *ce;
+    char *name = NULL;
+
+    parsec_mca_param_reg_string_name("runtime", "comm_engine",
+                                     "Select the communication engine: mpi, or tcp to connect the processes with sockets "
+                                     "without an MPI launcher (the processes are then described by PARSEC_TCP_RANK and "
+                                     "PARSEC_TCP_NODES, PARSEC_TCP_HOSTFILE or PARSEC_TCP_SIZE).",
+                                     false, false, "mpi", &name);
+
     /* call the selected module init */
-    parsec_comm_engine_t *ce = mpi_funnelled_init(parsec_context);
+#if defined(PARSEC_HAVE_SYS_EPOLL_H)
+    if( (NULL != name) && (0 == strcmp(name, "tcp")) ) {
+        ce = tcp_comm_engine_init(parsec_context);
+    } else
+#endif  /* defined(PARSEC_HAVE_SYS_EPOLL_H) */
+    {
+        if( (NULL != name) && (0 != strcmp(name, "mpi")) )
+            parsec_warning("Unknown communication engine %s, using mpi instead", name);
+        ce = mpi_funnelled_init(parsec_context);
+    }
+    free(name);
+    if( NULL == ce ) return NULL;
 
     assert(ce->capabilites.sided > 0 && ce->capabilites.sided < 3);
     return ce;
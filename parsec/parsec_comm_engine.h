@@ -117,6 +117,14 @@ typedef int (*parsec_ce_send_active_message_fn_t)(parsec_comm_engine_t *comm_eng
                                              int remote,
                                              void *addr, size_t size);
 
+/**
+ * Optional, collective: fill host_of[r] with the lowest rank of the host of
+ * the rank r, the processes sharing memory being on the same host. When not
+ * provided, each process is on its own host.
+ */
+typedef int (*parsec_ce_hosts_fn_t)(parsec_comm_engine_t *comm_engine,
+                                    int *host_of);
+
 typedef int (*parsec_ce_progress_fn_t)(parsec_comm_engine_t *comm_engine);
 
 typedef int (*parsec_ce_enable_fn_t)(parsec_comm_engine_t *comm_engine);
@@ -196,6 +204,7 @@ struct parsec_comm_engine_s {
     parsec_ce_sync_fn_t                    sync;
     parsec_ce_can_serve_fn_t               can_serve;
     parsec_ce_send_active_message_fn_t     send_am;
+    parsec_ce_hosts_fn_t                   hosts;
 };
 
 /* global comm_engine */
@@ -18,6 +18,7 @@
 #include "parsec/class/parsec_hash_table.h"
 #include "parsec/parsec_description_structures.h"
 #include "parsec/profiling.h"
+#include "parsec/os-spec-timing.h"
 #include "parsec/mempool.h"
 #include "parsec/arena.h"
 #include "parsec/datarepo.h"
@@ -346,6 +347,9 @@ typedef int (parsec_data_ref_fn_t)(const parsec_task_t *task, parsec_data_ref_t
 #define PARSEC_IMMEDIATE_TASK             0x0010
 #define PARSEC_USE_DEPS_MASK              0x0020
 #define PARSEC_HAS_CTL_GATHER             0X0040
+/* The hook runs the successors of the same class of the tasks right away
+ * (task fusion, see parsec_fuse_successor_fct) */
+#define PARSEC_FUSED_TASK                 0x0080
 
 #define PARSEC_TASK_CLASS_TYPE_PTG        0x01
 #define PARSEC_TASK_CLASS_TYPE_DTD        0x02
@@ -492,6 +496,37 @@ PARSEC_DECLSPEC extern int parsec_slow_bind_warning;
  * the scheduler, but can provide a better cache reuse.
  */
 PARSEC_DECLSPEC extern int parsec_runtime_keep_highest_priority_task;
+/**
+ * Maximum number of tasks an execution stream runs in a row from its
+ * next_task, before handing the highest priority successor to the scheduler
+ * (0 for no limit). This bounds how long a chain of tasks can keep a thread
+ * away from the other ready tasks.
+ */
+PARSEC_DECLSPEC extern int parsec_runtime_keep_highest_priority_task_depth;
+/**
+ * Global configuration variable enabling task fusion: the hooks of the task
+ * classes flagged PARSEC_FUSED_TASK by the PTG compiler run the successor of
+ * a task right away when it is local and of the same class.
+ */
+PARSEC_DECLSPEC extern int parsec_runtime_task_fusion;
+/**
+ * Global configuration variable enabling the scheduler instrumentation
+ * (see parsec_sched_stats_t): the pushes and pops by level of the queue
+ * hierarchy, the time spent by the tasks in the queues and the depth of
+ * the queues are accounted per execution stream, exported through PAPI-SDE
+ * and profiling counters, and reported at finalization.
+ */
+PARSEC_DECLSPEC extern int parsec_runtime_sched_stats;
+/**
+ * Global configuration variables controlling what idle execution streams do.
+ * With parking enabled, a thread that failed to find work more than
+ * parsec_runtime_idle_spin times in a row blocks in the parking lot of the
+ * context, for at most parsec_runtime_idle_park_timeout microseconds, until
+ * new tasks are scheduled. Otherwise it sleeps with an exponential backoff.
+ */
+PARSEC_DECLSPEC extern int parsec_runtime_idle_park;
+PARSEC_DECLSPEC extern int parsec_runtime_idle_spin;
+PARSEC_DECLSPEC extern int parsec_runtime_idle_park_timeout;
 
 /**
  * Description of the state of the task. It indicates what will be the next
@@ -550,6 +585,9 @@ struct parsec_task_s {
     int                        sim_exec_date;
 #endif
     parsec_data_pair_t         data[MAX_PARAM_COUNT];
+    parsec_time_t              sched_date;  /**< When the task was given to the scheduler (scheduler statistics only) */
+    parsec_time_t              remote_date; /**< When the remote data that made the task ready arrived (comm_stats only) */
+    struct parsec_remote_dep_stats_s *remote_stats; /**< Where to account the wait of the task for a worker, or NULL */
 };
 PARSEC_DECLSPEC PARSEC_OBJ_CLASS_DECLARATION(parsec_task_t);
 
@@ -652,6 +690,27 @@ parsec_release_dep_fct(struct parsec_execution_stream_s *es,
                        data_repo_t *successor_repo, parsec_key_t successor_repo_key,
                        void *param);
 
+/**
+ * Task fusion: the locals and priority of the successor of a task, when it
+ * is the only one and it can run in place of the task (same class, same
+ * process and virtual process). nb_successors is 1 in that case only.
+ */
+typedef struct {
+    int                  nb_successors;
+    int32_t              priority;
+    parsec_assignment_t  locals[MAX_LOCAL_COUNT];
+} parsec_fuse_successor_arg_t;
+
+parsec_ontask_iterate_t
+parsec_fuse_successor_fct(struct parsec_execution_stream_s *es,
+                          const parsec_task_t *newcontext,
+                          const parsec_task_t *oldcontext,
+                          const parsec_dep_t* dep,
+                          parsec_dep_data_description_t* data,
+                          int rank_src, int rank_dst, int vpid_dst,
+                          data_repo_t *successor_repo, parsec_key_t successor_repo_key,
+                          void *param);
+
 /**
  * Function to create reshaping promises during iterate_successors.
  */
@@ -685,6 +744,35 @@ parsec_get_copy_reshape_from_dep(parsec_execution_stream_t *es,
                                  parsec_dep_data_description_t *data,
                                  parsec_data_copy_t**reshape);
 
+/**
+ * Check if a reshape promise can be fulfilled with its input copy instead of
+ * a new copy: both datatypes must describe the same dense memory layout, no
+ * consumer of the promise may write or forward the data, and the input copy
+ * must have no readers (this includes the pending sends to remote
+ * processes). The successors would then share the same copy as if the
+ * datatypes were identical. Accounts for the avoided copy when it returns 1.
+ */
+int parsec_reshape_reuse_copy(parsec_reshape_promise_description_t *dt);
+
+/**
+ * Returns the number of reshaped copies, and the corresponding number of
+ * bytes, avoided by parsec_reshape_reuse_copy and parsec_reshape_view_copy
+ * since the beginning of the execution.
+ */
+PARSEC_DECLSPEC void parsec_reshape_avoided_copies(int64_t *nb_copies, int64_t *nb_bytes);
+
+/**
+ * Fulfill a local reshape promise without packing: when the reshape keeps
+ * the same datatype on both sides, return a new PARSEC_DATA_FLAG_VIEW copy
+ * sharing the memory of the input copy, with the reshape datatype describing
+ * the (possibly strided) part of the memory the consumers can access.
+ * Promises consumed by a writing flow or sent to a remote process always get
+ * a packed copy. Returns NULL if a view can not be used, and accounts for the
+ * avoided copy otherwise. Controlled by the runtime_reshape_view MCA parameter.
+ */
+parsec_data_copy_t *parsec_reshape_view_copy(parsec_reshape_promise_description_t *dt);
+PARSEC_DECLSPEC extern int parsec_param_reshape_view;
+
 
 /** deps is an array of size MAX_PARAM_COUNT
  *  Returns the number of output deps on which there is a final output
@@ -715,6 +803,27 @@ void parsec_set_my_execution_stream(parsec_execution_stream_t *es);
 
 #if defined(PARSEC_SIM)
 int parsec_getsimulationdate( parsec_context_t *parsec_context );
+
+/**
+ * Returns the makespan predicted by the replay of the DAG executed by the
+ * last completed parsec_context_wait (see parsec_sim.h).
+ */
+int64_t parsec_getsimulatedmakespan( parsec_context_t *parsec_context );
+
+/**
+ * Function placing a task on one of the nb_ranks simulated processes.
+ */
+typedef int (parsec_sim_rank_of_fn_t)(const parsec_task_t *task, int nb_ranks, void *cb_data);
+
+/**
+ * Overrides the default placement of the tasks on the simulated processes
+ * (the key of the data the task has affinity with, modulo the number of
+ * simulated processes). A NULL fn restores the default placement.
+ */
+void parsec_sim_set_rank_of( parsec_sim_rank_of_fn_t *fn, void *cb_data );
+
+/** When set, the generated code skips the body of the tasks */
+PARSEC_DECLSPEC extern int parsec_sim_dry_body;
 #endif
 
 /*********************** Global Info Handles *****************************/
@@ -8,6 +8,8 @@
 #include <assert.h>
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
+#include <unistd.h>
 #include "parsec/parsec_mpi_funnelled.h"
 #include "parsec/remote_dep.h"
 #include "parsec/class/parsec_hash_table.h"
@@ -31,6 +33,9 @@ typedef struct mpi_funnelled_mem_reg_handle_s {
     void *mem;
     parsec_datatype_t datatype;
     int count;
+    int contiguous_size;  /* size in bytes of the data if contiguous, 0 otherwise */
+    int rma_attached;     /* the data is exposed in the RMA window */
+    MPI_Aint rma_addr;    /* and its address in the window */
 } mpi_funnelled_mem_reg_handle_t;
 
 PARSEC_DECLSPEC PARSEC_OBJ_CLASS_DECLARATION(mpi_funnelled_mem_reg_handle_t);
@@ -132,7 +137,8 @@ static struct mpi_funnelled_tag_s parsec_mpi_funnelled_array_of_registered_tags[
 typedef enum mpi_funnelled_callback_type_e {
     MPI_FUNNELLED_TYPE_AM       = 0, /* indicating active message */
     MPI_FUNNELLED_TYPE_ONESIDED = 1,  /* indicating one sided */
-    MPI_FUNNELLED_TYPE_ONESIDED_MIMIC_AM = 2  /* indicating one sided with am callback type */
+    MPI_FUNNELLED_TYPE_ONESIDED_MIMIC_AM = 2,  /* indicating one sided with am callback type */
+    MPI_FUNNELLED_TYPE_RMA_PUT = 3  /* indicating a put through the RMA window, to notify to the target */
 } mpi_funnelled_callback_type_t;
 
 /* Structure to hold information about callbacks,
@@ -155,6 +161,10 @@ typedef struct mpi_funnelled_callback_s {
             parsec_ce_am_callback_t fct;
             void *msg;
         } onesided_mimic_am;
+        struct {
+            void *msg;  /* the notification for the target */
+            size_t msg_size;
+        } rma;
     } cb_type;
     struct {
         parsec_ce_onesided_callback_t fct;
@@ -197,6 +207,7 @@ static int parsec_param_enable_mpi_overtake = 1;
 #else
 static int parsec_param_enable_mpi_overtake = 0;  /* Default to 0 if not supported to avoid complaints about the MCA */
 #endif
+static int parsec_param_native_pack = 1;
 
 /* List to hold pending requests */
 parsec_list_t mpi_funnelled_dynamic_sendreq_fifo; /* ordered non threaded fifo */
@@ -238,9 +249,634 @@ typedef struct mpi_funnelled_handshake_info_s {
     parsec_ce_mem_reg_handle_t source_memory_handle;
     parsec_ce_mem_reg_handle_t remote_memory_handle;
     uintptr_t cb_fn;
-
+    int shard;  /* request pool of the transfer, -1 for the funnelled arrays */
 } mpi_funnelled_handshake_info_t;
 
+/* A handshake with this shard notifies the completion of a put through the RMA window */
+#define MPI_FUNNELLED_HANDSHAKE_RMA (-2)
+
+/* With MPI_THREAD_MULTIPLE the data transfers (put and get) are not funnelled
+ * through the arrays above but spread over a set of request pools, the
+ * shards. Each shard has its own duplicate of the data communicator (and thus
+ * its own tag space and matching queue), its own growing arrays of requests
+ * and its own lock. The initiator of a transfer picks the shard of the
+ * calling execution stream (or of the peer for the communication thread) and
+ * carries the shard in the handshake, so that both sides of the transfer post
+ * on the same communicator. Any thread can progress a shard, but the upper
+ * level callbacks are not thread safe: the completions found by the workers
+ * are queued on the shard and served by the communication thread.
+ */
+typedef struct mpi_multiple_shard_s {
+    parsec_atomic_lock_t      lock;
+    MPI_Comm                  comm;
+    volatile int32_t          next_tag;
+    int                       nb_active;
+    int                       size;
+    MPI_Request              *requests;
+    mpi_funnelled_callback_t *callbacks;
+    int                      *indices;
+    MPI_Status               *statuses;
+    parsec_list_t             completed;  /* completed by a worker, callbacks not yet served */
+} mpi_multiple_shard_t;
+
+/* A completed transfer, and what is needed to serve its callback */
+typedef struct mpi_multiple_completion_s {
+    parsec_list_item_t super;
+    parsec_thread_mempool_t *mempool_owner;
+    int tag;
+    int source;
+    int length;
+    mpi_funnelled_callback_t cb;
+} mpi_multiple_completion_t;
+
+PARSEC_DECLSPEC PARSEC_OBJ_CLASS_DECLARATION(mpi_multiple_completion_t);
+PARSEC_OBJ_CLASS_INSTANCE(mpi_multiple_completion_t, parsec_list_item_t,
+                   NULL, NULL);
+
+static int parsec_param_mpi_shards = 0;
+static int mpi_multiple_nb_shards = 0;
+static mpi_multiple_shard_t *mpi_multiple_shards = NULL;
+static parsec_mempool_t *mpi_multiple_completion_mempool = NULL;
+
+#define MPI_MULTIPLE_SHARD_INITIAL_SIZE 16
+
+/* The RMA backend: the data of a put is written directly in the memory of the
+ * target with MPI_Rput through a dynamic window, instead of a handshake
+ * followed by a matching Isend/Irecv. Once the put is complete the target is
+ * notified with an active message carrying the callback. The memory is
+ * attached to the window when registered, and stays attached (it is usually
+ * an arena chunk, that will be registered again) until it overlaps a new
+ * registration while not in use. Non contiguous data and memory that cannot
+ * be attached use the handshake. */
+typedef struct mpi_rma_region_s {
+    char  *base;
+    size_t len;
+    int    refcount;  /* number of registered handles in the region */
+} mpi_rma_region_t;
+
+static int parsec_param_mpi_rma = 0;
+static int parsec_param_mpi_rma_regions = 32;
+static int mpi_rma_enabled = 0;
+static MPI_Win mpi_rma_win = MPI_WIN_NULL;
+static mpi_multiple_shard_t mpi_rma_pool;  /* the MPI_Rput requests */
+/* The attached regions, sorted and disjoint */
+static parsec_atomic_lock_t mpi_rma_regions_lock = PARSEC_ATOMIC_UNLOCKED;
+static mpi_rma_region_t *mpi_rma_regions = NULL;
+static int mpi_rma_nb_regions = 0, mpi_rma_size_regions = 0;
+static long mpi_rma_page_size = 4096;
+
+int
+mpi_no_thread_serve_cb(parsec_comm_engine_t *ce, mpi_funnelled_callback_t *cb,
+                       int mpi_tag, int mpi_source, int length, void *buf);
+
+/* The shard of the calling thread: workers use the shard of their execution
+ * stream, the communication thread spreads the transfers by peer. */
+static inline int mpi_multiple_my_shard(int remote)
+{
+    parsec_execution_stream_t *es = parsec_my_execution_stream();
+    if( (NULL == es) || (&parsec_comm_es == es) )
+        return remote % mpi_multiple_nb_shards;
+    return (es->virtual_process->vp_id + es->th_id) % mpi_multiple_nb_shards;
+}
+
+static inline int mpi_multiple_next_tag(mpi_multiple_shard_t *shard)
+{
+    uint32_t t = (uint32_t)parsec_atomic_fetch_inc_int32(&shard->next_tag);
+    return (int)(t % (uint32_t)MAX_MPI_TAG);
+}
+
+/* Return a free slot in the shard, growing the arrays if necessary. The
+ * shard lock must be held. */
+static int mpi_multiple_shard_slot(mpi_multiple_shard_t *shard)
+{
+    if( shard->nb_active == shard->size ) {
+        int size = 2 * shard->size;
+        shard->requests  = (MPI_Request*)realloc(shard->requests, size * sizeof(MPI_Request));
+        shard->callbacks = (mpi_funnelled_callback_t*)realloc(shard->callbacks, size * sizeof(mpi_funnelled_callback_t));
+        shard->indices   = (int*)realloc(shard->indices, size * sizeof(int));
+        shard->statuses  = (MPI_Status*)realloc(shard->statuses, size * sizeof(MPI_Status));
+        for( int i = shard->size; i < size; i++ )
+            shard->requests[i] = MPI_REQUEST_NULL;
+        shard->size = size;
+    }
+    return shard->nb_active++;
+}
+
+/* Create the arrays of a request pool, and duplicate comm for it unless it
+ * is MPI_COMM_NULL. */
+static void mpi_multiple_shard_construct(mpi_multiple_shard_t *shard, MPI_Comm comm)
+{
+    parsec_atomic_lock_init(&shard->lock);
+    shard->comm = MPI_COMM_NULL;
+    if( MPI_COMM_NULL != comm )
+        MPI_Comm_dup(comm, &shard->comm);
+    shard->next_tag  = 0;
+    shard->nb_active = 0;
+    shard->size      = MPI_MULTIPLE_SHARD_INITIAL_SIZE;
+    shard->requests  = (MPI_Request*)malloc(shard->size * sizeof(MPI_Request));
+    shard->callbacks = (mpi_funnelled_callback_t*)calloc(shard->size, sizeof(mpi_funnelled_callback_t));
+    shard->indices   = (int*)calloc(shard->size, sizeof(int));
+    shard->statuses  = (MPI_Status*)calloc(shard->size, sizeof(MPI_Status));
+    for( int i = 0; i < shard->size; i++ )
+        shard->requests[i] = MPI_REQUEST_NULL;
+    PARSEC_OBJ_CONSTRUCT(&shard->completed, parsec_list_t);
+}
+
+static void mpi_multiple_shard_destruct(mpi_multiple_shard_t *shard)
+{
+    assert(0 == shard->nb_active);
+    assert(parsec_list_nolock_is_empty(&shard->completed));
+    if( MPI_COMM_NULL != shard->comm )
+        MPI_Comm_free(&shard->comm);
+    free(shard->requests);
+    free(shard->callbacks);
+    free(shard->indices);
+    free(shard->statuses);
+    PARSEC_OBJ_DESTRUCT(&shard->completed);
+}
+
+static void mpi_multiple_completion_mempool_init(void)
+{
+    if( NULL != mpi_multiple_completion_mempool ) return;
+    mpi_multiple_completion_mempool = (parsec_mempool_t*) malloc (sizeof(parsec_mempool_t));
+    parsec_mempool_construct(mpi_multiple_completion_mempool,
+                             PARSEC_OBJ_CLASS(mpi_multiple_completion_t), sizeof(mpi_multiple_completion_t),
+                             offsetof(mpi_multiple_completion_t, mempool_owner),
+                             1);
+}
+
+static void mpi_multiple_shards_init(MPI_Comm comm)
+{
+    mpi_multiple_nb_shards = parsec_param_mpi_shards;
+    if( !(parsec_comm_es.virtual_process->parsec_context->flags & PARSEC_CONTEXT_FLAG_COMM_MT) )
+        mpi_multiple_nb_shards = 0;
+    /* The shards duplicate the communicator, all processes must agree on their number */
+    MPI_Allreduce(MPI_IN_PLACE, &mpi_multiple_nb_shards, 1, MPI_INT, MPI_MIN, comm);
+    if( mpi_multiple_nb_shards <= 0 ) {
+        if( parsec_param_mpi_shards > 0 )
+            parsec_warning("MPI:\tThe sharded request pools need MPI_THREAD_MULTIPLE on all processes, "
+                           "the data transfers are funnelled through the communication thread");
+        mpi_multiple_nb_shards = 0;
+        return;
+    }
+
+    mpi_multiple_completion_mempool_init();
+    mpi_multiple_shards = (mpi_multiple_shard_t*)calloc(mpi_multiple_nb_shards, sizeof(mpi_multiple_shard_t));
+    for( int s = 0; s < mpi_multiple_nb_shards; s++ ) {
+        mpi_multiple_shard_construct(&mpi_multiple_shards[s], comm);
+    }
+    parsec_debug_verbose(3, parsec_comm_output_stream,
+                         "MPI:\tData transfers spread over %d request pools", mpi_multiple_nb_shards);
+}
+
+static void mpi_multiple_shards_fini(void)
+{
+    for( int s = 0; s < mpi_multiple_nb_shards; s++ ) {
+        mpi_multiple_shard_destruct(&mpi_multiple_shards[s]);
+    }
+    free(mpi_multiple_shards); mpi_multiple_shards = NULL;
+    mpi_multiple_nb_shards = 0;
+}
+
+static int mpi_multiple_index_cmp(const void *a, const void *b)
+{
+    return *(const int*)a - *(const int*)b;
+}
+
+/* Test the requests of a shard, and either serve the callbacks of the
+ * completed ones (serve != 0, communication thread only) or queue them on
+ * the shard. Returns the number of completed requests, or 0 if another
+ * thread is already progressing the shard. */
+static int mpi_multiple_shard_progress(parsec_comm_engine_t *ce, mpi_multiple_shard_t *shard, int serve)
+{
+    mpi_multiple_completion_t *item;
+    parsec_list_t done;
+    int outcount = 0, idx, pos;
+
+    if( 0 == shard->nb_active ) return 0;  /* racy, but the next call will see it */
+    if( !parsec_atomic_trylock(&shard->lock) ) return 0;
+    if( 0 < shard->nb_active )
+        MPI_Testsome(shard->nb_active, shard->requests, &outcount, shard->indices, shard->statuses);
+    if( (0 >= outcount) || (MPI_UNDEFINED == outcount) ) {
+        parsec_atomic_unlock(&shard->lock);
+        return 0;
+    }
+    PARSEC_OBJ_CONSTRUCT(&done, parsec_list_t);
+    for( idx = 0; idx < outcount; idx++ ) {
+        item = (mpi_multiple_completion_t *)parsec_thread_mempool_allocate(mpi_multiple_completion_mempool->thread_mempools);
+        item->cb     = shard->callbacks[shard->indices[idx]];
+        item->tag    = shard->statuses[idx].MPI_TAG;
+        item->source = shard->statuses[idx].MPI_SOURCE;
+        MPI_Get_count(&shard->statuses[idx], MPI_PACKED, &item->length);
+        parsec_list_nolock_push_back(&done, &item->super);
+    }
+    /* Compact the arrays, from the highest completed index down: MPI does not
+     * order the indices, and moving the last request into a lower slot is
+     * only safe once all the completed slots above it are gone. */
+    qsort(shard->indices, outcount, sizeof(int), mpi_multiple_index_cmp);
+    for( idx = outcount-1; idx >= 0; idx-- ) {
+        pos = shard->indices[idx];
+        shard->nb_active--;
+        if( shard->nb_active > pos ) {
+            shard->requests[pos]  = shard->requests[shard->nb_active];
+            shard->callbacks[pos] = shard->callbacks[shard->nb_active];
+        }
+        shard->requests[shard->nb_active] = MPI_REQUEST_NULL;
+    }
+    parsec_atomic_unlock(&shard->lock);
+
+    /* Callbacks may post new transfers on this shard: serve them unlocked */
+    while( NULL != (item = (mpi_multiple_completion_t*)parsec_list_nolock_pop_front(&done)) ) {
+        if( serve ) {
+            mpi_no_thread_serve_cb(ce, &item->cb, item->tag, item->source, item->length, NULL);
+            parsec_thread_mempool_free(mpi_multiple_completion_mempool->thread_mempools, item);
+        } else {
+            parsec_list_push_back(&shard->completed, &item->super);
+        }
+    }
+    PARSEC_OBJ_DESTRUCT(&done);
+    return outcount;
+}
+
+/* Serve the completions queued by the workers, then progress all the shards.
+ * Communication thread only. */
+static int mpi_multiple_progress_all(parsec_comm_engine_t *ce)
+{
+    mpi_multiple_completion_t *item;
+    int ret = 0;
+
+    for( int s = 0; s < mpi_multiple_nb_shards; s++ ) {
+        mpi_multiple_shard_t *shard = &mpi_multiple_shards[s];
+        while( NULL != (item = (mpi_multiple_completion_t*)parsec_list_pop_front(&shard->completed)) ) {
+            mpi_no_thread_serve_cb(ce, &item->cb, item->tag, item->source, item->length, NULL);
+            parsec_thread_mempool_free(mpi_multiple_completion_mempool->thread_mempools, item);
+            ret++;
+        }
+        ret += mpi_multiple_shard_progress(ce, shard, 1);
+    }
+    return ret;
+}
+
+int
+mpi_multiple_progress(parsec_comm_engine_t *ce)
+{
+    if( 0 == mpi_multiple_nb_shards ) return 0;
+    return mpi_multiple_shard_progress(ce, &mpi_multiple_shards[mpi_multiple_my_shard(0)], 0);
+}
+
+/* First region ending after addr, the regions lock must be held */
+static int mpi_rma_region_find(char *addr)
+{
+    int lo = 0, hi = mpi_rma_nb_regions;
+    while( lo < hi ) {
+        int mid = (lo + hi) / 2;
+        if( mpi_rma_regions[mid].base + mpi_rma_regions[mid].len <= addr ) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo;
+}
+
+/* Expose [mem, mem+len) in the window. The regions are extended to whole
+ * pages, as the MPI implementations register memory by pages and two
+ * regions sharing a page would overlap. Returns 0 if the memory overlaps a
+ * region in use that does not contain it. */
+static int mpi_rma_attach(char *mem, size_t len)
+{
+    uintptr_t page = (uintptr_t)mpi_rma_page_size;
+    int i, j;
+
+    len = (((uintptr_t)mem + len + page - 1) & ~(page - 1)) - ((uintptr_t)mem & ~(page - 1));
+    mem = (char*)((uintptr_t)mem & ~(page - 1));
+
+    parsec_atomic_lock(&mpi_rma_regions_lock);
+    i = mpi_rma_region_find(mem);
+    if( (i < mpi_rma_nb_regions) && (mpi_rma_regions[i].base <= mem) &&
+        ((mem + len) <= (mpi_rma_regions[i].base + mpi_rma_regions[i].len)) ) {
+        mpi_rma_regions[i].refcount++;
+        parsec_atomic_unlock(&mpi_rma_regions_lock);
+        return 1;
+    }
+    for( j = i; (j < mpi_rma_nb_regions) && (mpi_rma_regions[j].base < (mem + len)); j++ ) {
+        if( mpi_rma_regions[j].refcount > 0 ) {
+            parsec_atomic_unlock(&mpi_rma_regions_lock);
+            return 0;
+        }
+    }
+    /* Replace the unused regions [i, j) overlapping the new one */
+    for( int k = i; k < j; k++ )
+        MPI_Win_detach(mpi_rma_win, mpi_rma_regions[k].base);
+    memmove(&mpi_rma_regions[i], &mpi_rma_regions[j], (mpi_rma_nb_regions - j) * sizeof(mpi_rma_region_t));
+    mpi_rma_nb_regions -= j - i;
+    if( mpi_rma_nb_regions >= parsec_param_mpi_rma_regions ) {
+        /* The number of attached regions is bounded by the MPI library (and
+         * some do not recover from a failed attach): release the unused ones */
+        for( j = i = 0; i < mpi_rma_nb_regions; i++ ) {
+            if( 0 == mpi_rma_regions[i].refcount )
+                MPI_Win_detach(mpi_rma_win, mpi_rma_regions[i].base);
+            else
+                mpi_rma_regions[j++] = mpi_rma_regions[i];
+        }
+        mpi_rma_nb_regions = j;
+        i = mpi_rma_region_find(mem);
+    }
+    if( (mpi_rma_nb_regions >= parsec_param_mpi_rma_regions) ||
+        (MPI_SUCCESS != MPI_Win_attach(mpi_rma_win, mem, (MPI_Aint)len)) ) {
+        parsec_atomic_unlock(&mpi_rma_regions_lock);
+        return 0;
+    }
+    if( mpi_rma_nb_regions == mpi_rma_size_regions ) {
+        mpi_rma_size_regions = (0 == mpi_rma_size_regions) ? 64 : 2 * mpi_rma_size_regions;
+        mpi_rma_regions = (mpi_rma_region_t*)realloc(mpi_rma_regions, mpi_rma_size_regions * sizeof(mpi_rma_region_t));
+    }
+    memmove(&mpi_rma_regions[i + 1], &mpi_rma_regions[i], (mpi_rma_nb_regions - i) * sizeof(mpi_rma_region_t));
+    mpi_rma_nb_regions++;
+    mpi_rma_regions[i].base = mem;
+    mpi_rma_regions[i].len = len;
+    mpi_rma_regions[i].refcount = 1;
+    parsec_atomic_unlock(&mpi_rma_regions_lock);
+    return 1;
+}
+
+static void mpi_rma_release(char *mem)
+{
+    int i;
+
+    parsec_atomic_lock(&mpi_rma_regions_lock);
+    i = mpi_rma_region_find(mem);
+    assert((i < mpi_rma_nb_regions) && (mpi_rma_regions[i].base <= mem) && (mpi_rma_regions[i].refcount > 0));
+    mpi_rma_regions[i].refcount--;
+    parsec_atomic_unlock(&mpi_rma_regions_lock);
+}
+
+static void mpi_rma_init(MPI_Comm comm)
+{
+    mpi_rma_enabled = parsec_param_mpi_rma;
+    /* The window is created collectively, all processes must agree */
+    MPI_Allreduce(MPI_IN_PLACE, &mpi_rma_enabled, 1, MPI_INT, MPI_MIN, comm);
+    if( mpi_rma_enabled <= 0 ) {
+        mpi_rma_enabled = 0;
+        return;
+    }
+    mpi_rma_page_size = sysconf(_SC_PAGESIZE);
+    MPI_Win_create_dynamic(MPI_INFO_NULL, comm, &mpi_rma_win);
+    /* a failed attach falls back to the handshake */
+    MPI_Win_set_errhandler(mpi_rma_win, MPI_ERRORS_RETURN);
+    /* A single passive target epoch to all processes for the whole run */
+    MPI_Win_lock_all(MPI_MODE_NOCHECK, mpi_rma_win);
+    mpi_multiple_completion_mempool_init();
+    mpi_multiple_shard_construct(&mpi_rma_pool, MPI_COMM_NULL);
+    parsec_debug_verbose(3, parsec_comm_output_stream,
+                         "MPI:\tData transfers through a dynamic RMA window");
+}
+
+static void mpi_rma_fini(void)
+{
+    if( !mpi_rma_enabled ) return;
+    mpi_multiple_shard_destruct(&mpi_rma_pool);
+    MPI_Win_unlock_all(mpi_rma_win);
+    for( int i = 0; i < mpi_rma_nb_regions; i++ ) {
+        assert(0 == mpi_rma_regions[i].refcount);
+        MPI_Win_detach(mpi_rma_win, mpi_rma_regions[i].base);
+    }
+    free(mpi_rma_regions); mpi_rma_regions = NULL;
+    mpi_rma_nb_regions = mpi_rma_size_regions = 0;
+    MPI_Win_free(&mpi_rma_win);
+    mpi_rma_enabled = 0;
+}
+
+/* Can the data of lreg be put in rreg through the window? */
+static inline int
+mpi_rma_can_put(mpi_funnelled_mem_reg_handle_t *source, mpi_funnelled_mem_reg_handle_t *remote)
+{
+    return mpi_rma_enabled && remote->rma_attached && (0 < source->contiguous_size) &&
+        (source->contiguous_size <= remote->contiguous_size);
+}
+
+static int
+mpi_rma_put(parsec_comm_engine_t *ce,
+            mpi_funnelled_mem_reg_handle_t *source_memory_handle, ptrdiff_t ldispl,
+            mpi_funnelled_mem_reg_handle_t *remote_memory_handle, ptrdiff_t rdispl,
+            int remote,
+            parsec_ce_onesided_callback_t l_cb, void *l_cb_data,
+            parsec_ce_tag_t r_tag, void *r_cb_data, size_t r_cb_data_size)
+{
+    mpi_funnelled_handshake_info_t handshake_info;
+    mpi_funnelled_callback_t cb;
+    int slot;
+    (void)ce;
+
+    /* The notification sent to the target once the data has reached it */
+    handshake_info.tag = -1;
+    handshake_info.source_memory_handle = source_memory_handle;
+    handshake_info.remote_memory_handle = remote_memory_handle->self;
+    handshake_info.cb_fn = (uintptr_t) r_tag;
+    handshake_info.shard = MPI_FUNNELLED_HANDSHAKE_RMA;
+    cb.cb_type.rma.msg_size = sizeof(mpi_funnelled_handshake_info_t) + r_cb_data_size;
+    cb.cb_type.rma.msg = malloc(cb.cb_type.rma.msg_size);
+    memcpy( cb.cb_type.rma.msg, &handshake_info, sizeof(mpi_funnelled_handshake_info_t) );
+    memcpy( ((char *)cb.cb_type.rma.msg) + sizeof(mpi_funnelled_handshake_info_t), r_cb_data, r_cb_data_size );
+
+    cb.storage2 = remote;
+    cb.cb_data  = l_cb_data;
+    cb.tag_reg  = NULL;
+    cb.type     = MPI_FUNNELLED_TYPE_RMA_PUT;
+    cb.is_dynamic_recv = false;
+    cb.onesided.fct    = l_cb;
+    cb.onesided.lreg   = source_memory_handle->self;
+    cb.onesided.ldispl = ldispl;
+    cb.onesided.rreg   = remote_memory_handle;
+    cb.onesided.rdispl = rdispl;
+    cb.onesided.size   = source_memory_handle->count;
+    cb.onesided.remote = remote;
+    cb.onesided.tag    = -1;
+
+    parsec_atomic_lock(&mpi_rma_pool.lock);
+    slot = mpi_multiple_shard_slot(&mpi_rma_pool);
+    MPI_Rput((char *)source_memory_handle->mem + ldispl, source_memory_handle->contiguous_size, MPI_BYTE,
+             remote, remote_memory_handle->rma_addr + rdispl, source_memory_handle->contiguous_size, MPI_BYTE,
+             mpi_rma_win, &mpi_rma_pool.requests[slot]);
+    mpi_rma_pool.callbacks[slot] = cb;
+    mpi_rma_pool.callbacks[slot].storage1 = slot;
+    parsec_atomic_unlock(&mpi_rma_pool.lock);
+    return 1;
+}
+
+/* Target side of a put through the window: the data is in place */
+static int
+mpi_rma_notify_callback(parsec_comm_engine_t *ce, parsec_ce_tag_t tag,
+                        void *msg, size_t msg_size, int src)
+{
+    mpi_funnelled_handshake_info_t *handshake_info = (mpi_funnelled_handshake_info_t *) msg;
+    parsec_ce_am_callback_t fct = (parsec_ce_am_callback_t) handshake_info->cb_fn;
+
+    /* make the remote updates visible to our loads */
+    MPI_Win_sync(mpi_rma_win);
+    return fct(ce, tag, ((char*)msg) + sizeof(mpi_funnelled_handshake_info_t),
+               msg_size - sizeof(mpi_funnelled_handshake_info_t), src,
+               handshake_info->remote_memory_handle);
+}
+
+/* Post the data movement of a transfer on a shard, and record its callback */
+static void
+mpi_multiple_post(mpi_multiple_shard_t *shard, int post_isend,
+                  mpi_funnelled_mem_reg_handle_t *handle, ptrdiff_t displ,
+                  int remote, int tag, const mpi_funnelled_callback_t *cb)
+{
+    int slot;
+
+    parsec_atomic_lock(&shard->lock);
+    slot = mpi_multiple_shard_slot(shard);
+    if( post_isend ) {
+        MPI_Isend((char *)handle->mem + displ, handle->count, handle->datatype,
+                  remote, tag, shard->comm, &shard->requests[slot]);
+    } else {
+        MPI_Irecv((char *)handle->mem + displ, handle->count, handle->datatype,
+                  remote, tag, shard->comm, &shard->requests[slot]);
+    }
+    shard->callbacks[slot] = *cb;
+    shard->callbacks[slot].storage1 = slot;
+    parsec_atomic_unlock(&shard->lock);
+}
+
+/* Send the handshake of a transfer, along with the callback data of the peer */
+static void
+mpi_multiple_handshake(parsec_comm_engine_t *ce, parsec_ce_tag_t am_tag, int remote,
+                       mpi_funnelled_handshake_info_t *handshake_info,
+                       void *r_cb_data, size_t r_cb_data_size)
+{
+    int buf_size = sizeof(mpi_funnelled_handshake_info_t) + r_cb_data_size;
+    void *buf = malloc(buf_size);
+    memcpy( buf, handshake_info, sizeof(mpi_funnelled_handshake_info_t) );
+    memcpy( ((char *)buf) + sizeof(mpi_funnelled_handshake_info_t), r_cb_data, r_cb_data_size );
+    /* this is blocking, the buffer can be released right away */
+    ce->send_am(ce, am_tag, remote, buf, buf_size);
+    free(buf);
+}
+
+int
+mpi_multiple_put(parsec_comm_engine_t *ce,
+                 parsec_ce_mem_reg_handle_t lreg,
+                 ptrdiff_t ldispl,
+                 parsec_ce_mem_reg_handle_t rreg,
+                 ptrdiff_t rdispl,
+                 size_t size,
+                 int remote,
+                 parsec_ce_onesided_callback_t l_cb, void *l_cb_data,
+                 parsec_ce_tag_t r_tag, void *r_cb_data, size_t r_cb_data_size)
+{
+    mpi_funnelled_mem_reg_handle_t *source_memory_handle = (mpi_funnelled_mem_reg_handle_t *) lreg;
+    mpi_funnelled_mem_reg_handle_t *remote_memory_handle = (mpi_funnelled_mem_reg_handle_t *) rreg;
+    int s = mpi_multiple_my_shard(remote);
+    mpi_multiple_shard_t *shard = &mpi_multiple_shards[s];
+    mpi_funnelled_handshake_info_t handshake_info;
+    mpi_funnelled_callback_t cb;
+    (void)size;
+
+    if( mpi_rma_can_put(source_memory_handle, remote_memory_handle) )
+        return mpi_rma_put(ce, source_memory_handle, ldispl, remote_memory_handle, rdispl, remote,
+                           l_cb, l_cb_data, r_tag, r_cb_data, r_cb_data_size);
+
+    handshake_info.tag = mpi_multiple_next_tag(shard);
+    handshake_info.source_memory_handle = source_memory_handle;
+    handshake_info.remote_memory_handle = remote_memory_handle->self;
+    handshake_info.cb_fn = (uintptr_t) r_tag;
+    handshake_info.shard = s;
+    mpi_multiple_handshake(ce, PARSEC_CE_MPI_FUNNELLED_PUT_TAG_INTERNAL, remote,
+                           &handshake_info, r_cb_data, r_cb_data_size);
+
+    cb.storage2 = remote;
+    cb.cb_data  = l_cb_data;
+    cb.tag_reg  = NULL;
+    cb.type     = MPI_FUNNELLED_TYPE_ONESIDED;
+    cb.is_dynamic_recv = false;
+    cb.onesided.fct    = l_cb;
+    cb.onesided.lreg   = source_memory_handle->self;
+    cb.onesided.ldispl = ldispl;
+    cb.onesided.rreg   = remote_memory_handle;
+    cb.onesided.rdispl = rdispl;
+    cb.onesided.size   = source_memory_handle->count;
+    cb.onesided.remote = remote;
+    cb.onesided.tag    = handshake_info.tag;
+    mpi_multiple_post(shard, 1, source_memory_handle, ldispl, remote, handshake_info.tag, &cb);
+    return 1;
+}
+
+int
+mpi_multiple_get(parsec_comm_engine_t *ce,
+                 parsec_ce_mem_reg_handle_t lreg,
+                 ptrdiff_t ldispl,
+                 parsec_ce_mem_reg_handle_t rreg,
+                 ptrdiff_t rdispl,
+                 size_t size,
+                 int remote,
+                 parsec_ce_onesided_callback_t l_cb, void *l_cb_data,
+                 parsec_ce_tag_t r_tag, void *r_cb_data, size_t r_cb_data_size)
+{
+    mpi_funnelled_mem_reg_handle_t *source_memory_handle = (mpi_funnelled_mem_reg_handle_t *) lreg;
+    mpi_funnelled_mem_reg_handle_t *remote_memory_handle = (mpi_funnelled_mem_reg_handle_t *) rreg;
+    int s = mpi_multiple_my_shard(remote);
+    mpi_multiple_shard_t *shard = &mpi_multiple_shards[s];
+    mpi_funnelled_handshake_info_t handshake_info;
+    mpi_funnelled_callback_t cb;
+
+    handshake_info.tag = mpi_multiple_next_tag(shard);
+    handshake_info.source_memory_handle = source_memory_handle;
+    handshake_info.remote_memory_handle = remote_memory_handle->self;
+    handshake_info.cb_fn = r_tag;
+    handshake_info.shard = s;
+    mpi_multiple_handshake(ce, PARSEC_CE_MPI_FUNNELLED_GET_TAG_INTERNAL, remote,
+                           &handshake_info, r_cb_data, r_cb_data_size);
+
+    cb.storage2 = remote;
+    cb.cb_data  = l_cb_data;
+    cb.tag_reg  = NULL;
+    cb.type     = MPI_FUNNELLED_TYPE_ONESIDED;
+    cb.is_dynamic_recv = false;
+    cb.onesided.fct    = l_cb;
+    cb.onesided.lreg   = source_memory_handle;
+    cb.onesided.ldispl = ldispl;
+    cb.onesided.rreg   = remote_memory_handle;
+    cb.onesided.rdispl = rdispl;
+    cb.onesided.size   = size;
+    cb.onesided.remote = remote;
+    cb.onesided.tag    = handshake_info.tag;
+    mpi_multiple_post(shard, 0, source_memory_handle, ldispl, remote, handshake_info.tag, &cb);
+    return 1;
+}
+
+/* Receiving side of the handshake of a sharded transfer: post the matching
+ * operation on the shard selected by the initiator. */
+static int
+mpi_multiple_handshake_callback(int post_isend, void *msg, size_t msg_size, int src)
+{
+    mpi_funnelled_handshake_info_t *handshake_info = (mpi_funnelled_handshake_info_t *) msg;
+    mpi_funnelled_mem_reg_handle_t *remote_memory_handle = (mpi_funnelled_mem_reg_handle_t *) (handshake_info->remote_memory_handle);
+    mpi_funnelled_callback_t cb;
+    void *callback_data;
+
+    assert((handshake_info->shard >= 0) && (handshake_info->shard < mpi_multiple_nb_shards));
+    callback_data = malloc(msg_size - sizeof(mpi_funnelled_handshake_info_t));
+    memcpy( callback_data,
+            ((char*)msg) + sizeof(mpi_funnelled_handshake_info_t),
+            msg_size - sizeof(mpi_funnelled_handshake_info_t) );
+
+    cb.cb_type.onesided_mimic_am.fct = (parsec_ce_am_callback_t) handshake_info->cb_fn;
+    cb.cb_type.onesided_mimic_am.msg = callback_data;
+    cb.storage2 = src;
+    cb.cb_data  = remote_memory_handle;
+    cb.tag_reg  = NULL;
+    cb.type     = MPI_FUNNELLED_TYPE_ONESIDED_MIMIC_AM;
+    cb.is_dynamic_recv = false;
+    cb.onesided.fct    = NULL;
+    cb.onesided.lreg   = remote_memory_handle;
+    cb.onesided.ldispl = 0;
+    cb.onesided.remote = src;
+    cb.onesided.tag    = handshake_info->tag;
+    mpi_multiple_post(&mpi_multiple_shards[handshake_info->shard], post_isend,
+                      remote_memory_handle, 0, src, handshake_info->tag, &cb);
+    return 1;
+}
+
 /* This is the callback that is triggered on the sender side for a
  * GET. In this function we get the TAG on which the receiver has
  * posted an Irecv and using which the sender should post an Isend
@@ -259,6 +895,9 @@ mpi_funnelled_internal_get_am_callback(parsec_comm_engine_t *ce,
     mpi_funnelled_handshake_info_t *handshake_info = (mpi_funnelled_handshake_info_t *) msg;
     mpi_funnelled_callback_t *cb;
 
+    if( handshake_info->shard >= 0 )
+        return mpi_multiple_handshake_callback(1, msg, msg_size, src);
+
     /* This rank sent it's mem_reg in the activation msg, which is being
      * sent back as rreg of the msg */
     mpi_funnelled_mem_reg_handle_t *remote_memory_handle = (mpi_funnelled_mem_reg_handle_t *) (handshake_info->remote_memory_handle); /* This is the memory handle of the remote(our) side */
@@ -331,6 +970,11 @@ mpi_funnelled_internal_put_am_callback(parsec_comm_engine_t *ce,
 
     mpi_funnelled_handshake_info_t *handshake_info = (mpi_funnelled_handshake_info_t *) msg;
 
+    if( MPI_FUNNELLED_HANDSHAKE_RMA == handshake_info->shard )
+        return mpi_rma_notify_callback(ce, tag, msg, msg_size, src);
+    if( handshake_info->shard >= 0 )
+        return mpi_multiple_handshake_callback(0, msg, msg_size, src);
+
     /* Get the local memory handle from the peer (it was originally sent with the request) */
     mpi_funnelled_mem_reg_handle_t *remote_memory_handle = (mpi_funnelled_mem_reg_handle_t*)handshake_info->remote_memory_handle;
 
@@ -519,6 +1163,42 @@ static int mpi_funneled_init_once(parsec_context_t* context)
     parsec_param_enable_mpi_overtake = 0;  /* Don't allow to be changed */
 #endif  /* !defined(PARSEC_HAVE_MPI_OVERTAKE) */
 
+    parsec_mca_param_reg_int_name("runtime", "comm_mpi_shards",
+                                  "With MPI_THREAD_MULTIPLE (see runtime_comm_thread_multiple), spread the data transfers over this many request pools, "
+                                  "each with its own communicator, instead of funnelling them through the communication thread arrays. (0: disabled)",
+                                  false, false, parsec_param_mpi_shards, &parsec_param_mpi_shards);
+
+    parsec_mca_param_reg_int_name("runtime", "comm_mpi_rma",
+                                  "Move the data of the contiguous transfers with MPI_Rput through a dynamic MPI window, instead of a handshake and a matching Isend/Irecv. (0: no, 1: yes)",
+                                  false, false, parsec_param_mpi_rma, &parsec_param_mpi_rma);
+    parsec_mca_param_reg_int_name("runtime", "comm_mpi_rma_regions",
+                                  "Maximum number of memory regions attached to the RMA window, it must not exceed the limit of the MPI library (e.g. osc_rdma_max_attach for Open MPI).",
+                                  false, false, parsec_param_mpi_rma_regions, &parsec_param_mpi_rma_regions);
+
+    parsec_mca_param_reg_int_name("runtime", "comm_native_pack",
+                                  "Pack and unpack the data embedded in the activation messages with the PaRSEC datatype engine instead of MPI_Pack when the datatype allows it. (0: no, 1: yes)",
+                                  false, false, parsec_param_native_pack, &parsec_param_native_pack);
+    if( parsec_param_native_pack ) {
+        /* The peers may still use MPI_Unpack on the packed data: make sure
+         * the native engine produces the same stream as MPI_Pack. */
+        double src[12];
+        char mpi_buf[sizeof(src)], native_buf[sizeof(src)];
+        int mpi_pos = 0, native_pos = 0;
+        MPI_Datatype vector;
+
+        for( int i = 0; i < 12; i++ ) src[i] = (double)i;
+        MPI_Type_vector(3, 2, 4, MPI_DOUBLE, &vector);
+        MPI_Type_commit(&vector);
+        MPI_Pack(src, 1, vector, mpi_buf, sizeof(mpi_buf), &mpi_pos, parsec_ce_mpi_self_comm);
+        if( (PARSEC_SUCCESS != parsec_type_pack(src, 1, vector, native_buf, sizeof(native_buf), &native_pos)) ||
+            (mpi_pos != native_pos) || (0 != memcmp(mpi_buf, native_buf, mpi_pos)) ) {
+            parsec_debug_verbose(3, parsec_comm_output_stream,
+                                 "MPI:\tThe MPI pack format is not the native one, disable the native pack engine");
+            parsec_param_native_pack = 0;
+        }
+        MPI_Type_free(&vector);
+    }
+
     (void)context;
     return 0;
 }
@@ -567,6 +1247,7 @@ mpi_funnelled_init(parsec_context_t *context)
     parsec_ce.reshape             = NULL;
     parsec_ce.can_serve           = NULL;
     parsec_ce.send_am             = NULL;
+    parsec_ce.hosts               = mpi_no_thread_hosts;
 
     parsec_ce.parsec_context      = context;
     parsec_ce.capabilites.sided   = 2;
@@ -635,6 +1316,12 @@ mpi_funnelled_fini(parsec_comm_engine_t *ce)
     /* Remove the static handles */
     MPI_Comm_free(&parsec_ce_mpi_self_comm); /* parsec_ce_mpi_self_comm becomes MPI_COMM_NULL */
 
+    mpi_multiple_shards_fini();
+    mpi_rma_fini();
+    if( NULL != mpi_multiple_completion_mempool ) {
+        parsec_mempool_destruct(mpi_multiple_completion_mempool);
+        free(mpi_multiple_completion_mempool); mpi_multiple_completion_mempool = NULL;
+    }
     /* Release the context communicators if any */
     if( MPI_COMM_NULL != parsec_ce_mpi_comm) {
         MPI_Comm_free(&parsec_ce_mpi_comm);
@@ -857,6 +1544,25 @@ mpi_no_thread_mem_register(void *mem, parsec_mem_type_t mem_type,
     handle->mem  = mem;
     handle->datatype = datatype;
     handle->count = count;
+    handle->contiguous_size = 0;
+    handle->rma_attached = 0;
+    handle->rma_addr = 0;
+
+    {
+        MPI_Aint lb, extent, true_lb, true_extent;
+        int size;
+        MPI_Type_size(datatype, &size);
+        MPI_Type_get_extent(datatype, &lb, &extent);
+        MPI_Type_get_true_extent(datatype, &true_lb, &true_extent);
+        if( (0 == lb) && (0 == true_lb) && (extent == size) && (true_extent == size) &&
+            ((size_t)size * count <= INT_MAX) )
+            handle->contiguous_size = size * (int)count;
+    }
+    if( mpi_rma_enabled && (0 < handle->contiguous_size) &&
+        mpi_rma_attach((char*)mem, handle->contiguous_size) ) {
+        handle->rma_attached = 1;
+        MPI_Get_address(mem, &handle->rma_addr);
+    }
 
     // Push in a table
 
@@ -869,6 +1575,8 @@ mpi_no_thread_mem_unregister(parsec_ce_mem_reg_handle_t *lreg)
     //remove from table
 
     mpi_funnelled_mem_reg_handle_t *handle = (mpi_funnelled_mem_reg_handle_t *) *lreg;
+    if( handle->rma_attached )
+        mpi_rma_release((char*)handle->mem);
     parsec_thread_mempool_free(mpi_funnelled_mem_reg_handle_mempool->thread_mempools, handle->self);
     return 1;
 }
@@ -911,11 +1619,14 @@ mpi_no_thread_put(parsec_comm_engine_t *ce,
 
     mpi_funnelled_callback_t *cb;
 
-    int tag = next_tag(1);
-
     mpi_funnelled_mem_reg_handle_t *source_memory_handle = (mpi_funnelled_mem_reg_handle_t *) lreg;
     mpi_funnelled_mem_reg_handle_t *remote_memory_handle = (mpi_funnelled_mem_reg_handle_t *) rreg;
 
+    if( mpi_rma_can_put(source_memory_handle, remote_memory_handle) )
+        return mpi_rma_put(ce, source_memory_handle, ldispl, remote_memory_handle, rdispl, remote,
+                           l_cb, l_cb_data, r_tag, r_cb_data, r_cb_data_size);
+
+    int tag = next_tag(1);
 
     mpi_funnelled_handshake_info_t handshake_info;
 
@@ -925,6 +1636,7 @@ mpi_no_thread_put(parsec_comm_engine_t *ce,
                                                                          instead of copying the whole
                                                                          memory_handle */
     handshake_info.cb_fn = (uintptr_t) r_tag;
+    handshake_info.shard = -1;
 
     /* We pack the static message(handshake_info) and the callback data
      * the other side have sent us, to be forwarded.
@@ -1017,6 +1729,7 @@ mpi_no_thread_get(parsec_comm_engine_t *ce,
     handshake_info.remote_memory_handle = remote_memory_handle->self; /* we store the actual pointer, as we
                                                                          do not pass the while handle */
     handshake_info.cb_fn = r_tag; /* This is what the other side has passed to us to invoke when the GET is done */
+    handshake_info.shard = -1;
 
     /* Packing the callback data the other side has sent us and sending it back to them */
     int buf_size = sizeof(mpi_funnelled_handshake_info_t) + r_cb_data_size;
@@ -1132,8 +1845,23 @@ mpi_no_thread_serve_cb(parsec_comm_engine_t *ce, mpi_funnelled_callback_t *cb,
                                      length, mpi_source, cb->cb_data);
             free(cb->cb_type.onesided_mimic_am.msg);
         }
+    } else if (cb->type == MPI_FUNNELLED_TYPE_RMA_PUT) {
+        /* The data left the local buffer, make sure it reached the target before notifying it */
+        MPI_Win_flush(cb->onesided.remote, mpi_rma_win);
+        ce->send_am(ce, PARSEC_CE_MPI_FUNNELLED_PUT_TAG_INTERNAL, cb->onesided.remote,
+                    cb->cb_type.rma.msg, cb->cb_type.rma.msg_size);
+        free(cb->cb_type.rma.msg);
+        if(NULL != cb->onesided.fct) {
+            ret = cb->onesided.fct(ce, cb->onesided.lreg,
+                                   cb->onesided.ldispl,
+                                   cb->onesided.rreg,
+                                   cb->onesided.rdispl,
+                                   cb->onesided.size,
+                                   cb->onesided.remote,
+                                   cb->cb_data);
+        }
     } else {
-        /* We only have three types */
+        /* We only have four types */
         assert(0);
     }
 
@@ -1207,6 +1935,11 @@ mpi_no_thread_progress(parsec_comm_engine_t *ce)
     mpi_funnelled_callback_t *cb;
     int length;
 
+    if( mpi_multiple_nb_shards > 0 )
+        ret = mpi_multiple_progress_all(ce);
+    if( mpi_rma_enabled )
+        ret += mpi_multiple_shard_progress(ce, &mpi_rma_pool, 1);
+
     do {
         MPI_Testsome(mpi_funnelled_last_active_req, array_of_requests,
                      &outcount, array_of_indices, array_of_statuses);
@@ -1405,6 +2138,18 @@ mpi_no_thread_enable(parsec_comm_engine_t *ce)
         MPI_Comm_dup((MPI_Comm) context->comm_ctx, &parsec_ce_mpi_am_comm[i]);
     }
 
+    if( NULL == mpi_multiple_shards ) {
+        mpi_multiple_shards_init(parsec_ce_mpi_comm);
+    }
+    if( MPI_WIN_NULL == mpi_rma_win ) {
+        mpi_rma_init(parsec_ce_mpi_comm);
+    }
+    if( mpi_multiple_nb_shards > 0 ) {
+        parsec_ce.put = mpi_multiple_put;
+        parsec_ce.get = mpi_multiple_get;
+        parsec_ce.capabilites.multithreaded = 1;
+    }
+
     parsec_check_overlapping_binding(context);
 
     parsec_ce_rebuild_am_requests();
@@ -1425,6 +2170,9 @@ mpi_no_thread_pack(parsec_comm_engine_t *ce,
                    int *positionA)
 {
     (void) ce;
+    if( parsec_param_native_pack &&
+        (PARSEC_SUCCESS == parsec_type_pack(inbuf, incount, type, outbuf, outsize, positionA)) )
+        return MPI_SUCCESS;
     return MPI_Pack(inbuf, incount, type, outbuf, outsize, positionA, parsec_ce_mpi_comm);
 
 }
@@ -1435,6 +2183,9 @@ mpi_no_thread_pack_size(parsec_comm_engine_t *ce,
                         int* size)
 {
     (void) ce;
+    if( parsec_param_native_pack &&
+        (PARSEC_SUCCESS == parsec_type_pack_size(incount, type, size)) )
+        return MPI_SUCCESS;
     return MPI_Pack_size(incount, type, parsec_ce_mpi_comm, size);
 }
 int
@@ -1443,6 +2194,9 @@ mpi_no_thread_unpack(parsec_comm_engine_t *ce,
                      void *outbuf, int outcount, parsec_datatype_t type)
 {
     (void) ce;
+    if( parsec_param_native_pack &&
+        (PARSEC_SUCCESS == parsec_type_unpack(inbuf, insize, position, outbuf, outcount, type)) )
+        return MPI_SUCCESS;
     return MPI_Unpack(inbuf, insize, position, outbuf, outcount, type, parsec_ce_mpi_comm);
 }
 
@@ -1455,6 +2209,22 @@ mpi_no_thread_sync(parsec_comm_engine_t *ce)
     return 0;
 }
 
+/* The processes of a shared memory communicator are on the same host. Can be
+ * called before the engine is enabled, on the communicator of the context. */
+int
+mpi_no_thread_hosts(parsec_comm_engine_t *ce, int *host_of)
+{
+    MPI_Comm comm = (MPI_Comm)ce->parsec_context->comm_ctx, shm;
+    int rank, first;
+
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_split_type(comm, MPI_COMM_TYPE_SHARED, rank, MPI_INFO_NULL, &shm);
+    MPI_Allreduce(&rank, &first, 1, MPI_INT, MPI_MIN, shm);
+    MPI_Comm_free(&shm);
+    MPI_Allgather(&first, 1, MPI_INT, host_of, 1, MPI_INT, comm);
+    return 0;
+}
+
 /* The upper layer will query the bottom layer before pushing
  * additional one-sided messages.
  */
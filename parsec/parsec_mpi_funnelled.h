@@ -59,6 +59,32 @@ int mpi_no_thread_send_active_message(parsec_comm_engine_t *comm_engine,
 
 int mpi_no_thread_progress(parsec_comm_engine_t *comm_engine);
 
+/* Sharded request pools, used for the data transfers with MPI_THREAD_MULTIPLE */
+int mpi_multiple_put(parsec_comm_engine_t *comm_engine,
+                     parsec_ce_mem_reg_handle_t lreg,
+                     ptrdiff_t ldispl,
+                     parsec_ce_mem_reg_handle_t rreg,
+                     ptrdiff_t rdispl,
+                     size_t size,
+                     int remote,
+                     parsec_ce_onesided_callback_t l_cb, void *l_cb_data,
+                     parsec_ce_tag_t r_tag, void *r_cb_data, size_t r_cb_data_size);
+
+int mpi_multiple_get(parsec_comm_engine_t *comm_engine,
+                     parsec_ce_mem_reg_handle_t lreg,
+                     ptrdiff_t ldispl,
+                     parsec_ce_mem_reg_handle_t rreg,
+                     ptrdiff_t rdispl,
+                     size_t size,
+                     int remote,
+                     parsec_ce_onesided_callback_t l_cb, void *l_cb_data,
+                     parsec_ce_tag_t r_tag, void *r_cb_data, size_t r_cb_data_size);
+
+/* Progress the request pool of the calling thread, can be called by any
+ * thread. The callbacks of the completed transfers are delayed until the
+ * next progress of the communication thread. */
+int mpi_multiple_progress(parsec_comm_engine_t *comm_engine);
+
 int mpi_no_thread_enable(parsec_comm_engine_t *comm_engine);
 int mpi_no_thread_disable(parsec_comm_engine_t *comm_engine);
 
@@ -77,6 +103,8 @@ int mpi_no_thread_unpack(parsec_comm_engine_t *ce,
 
 int mpi_no_thread_sync(parsec_comm_engine_t *comm_engine);
 
+int mpi_no_thread_hosts(parsec_comm_engine_t *comm_engine, int *host_of);
+
 int
 mpi_no_thread_can_push_more(parsec_comm_engine_t *c_e);
 
@@ -20,6 +20,111 @@
 #define PARSEC_UNFULFILLED_RESHAPE_PROMISE 0
 #define PARSEC_FULFILLED_RESHAPE_PROMISE   1
 
+/* Number of reshaped copies, and their size, avoided by reusing the input copy */
+static int64_t parsec_reshape_nb_avoided_copies = 0;
+static int64_t parsec_reshape_nb_avoided_bytes  = 0;
+
+/* Let local reshapes that keep the datatype expose a view on the input copy */
+int parsec_param_reshape_view = 1;
+
+/**
+ *
+ * Auxiliary routine to check if count elements of datatype dtt cover a
+ * dense range of memory, stored in the natural order.
+ *
+ * @param[in] dtt datatype.
+ * @param[in] count number of elements.
+ * @param[out] bytes size of the range.
+ * @return 1 if the layout is dense, 0 otherwise.
+ */
+static int
+parsec_reshape_dense_layout(parsec_datatype_t dtt, int count, ptrdiff_t *bytes)
+{
+    ptrdiff_t lb, extent;
+    int size;
+
+    if( PARSEC_DATATYPE_NULL == dtt ) return 0;
+    if( PARSEC_SUCCESS != parsec_type_size(dtt, &size) ) return 0;
+    if( PARSEC_SUCCESS != parsec_type_extent(dtt, &lb, &extent) ) return 0;
+    if( (0 != lb) || ((ptrdiff_t)size != extent) ) return 0;
+    /* A dense datatype could still permute the elements */
+    if( PARSEC_SUCCESS != parsec_type_contiguous(dtt) ) return 0;
+    *bytes = (ptrdiff_t)size * count;
+    return 1;
+}
+
+int
+parsec_reshape_reuse_copy(parsec_reshape_promise_description_t *dt)
+{
+    parsec_data_copy_t *copy = dt->data;
+    ptrdiff_t src_bytes, dst_bytes;
+
+    if( NULL == copy ) return 0;
+    /* A consumer that writes, or ships, the data needs a copy of its own:
+     * PTG does not count the local readers of the copy, so the other
+     * consumers cannot be seen through copy->readers. */
+    if( dt->pack_required ) return 0;
+    /* Concurrent readers, or pending sends to remote processes, still
+     * expect the original copy to stay untouched. */
+    if( 0 != copy->readers ) return 0;
+    if( dt->local->src_displ != dt->local->dst_displ ) return 0;
+    if( !parsec_reshape_dense_layout(dt->local->src_datatype, dt->local->src_count, &src_bytes) ||
+        !parsec_reshape_dense_layout(dt->local->dst_datatype, dt->local->dst_count, &dst_bytes) ||
+        (src_bytes != dst_bytes) ) {
+        return 0;
+    }
+    parsec_atomic_fetch_inc_int64(&parsec_reshape_nb_avoided_copies);
+    parsec_atomic_fetch_add_int64(&parsec_reshape_nb_avoided_bytes, (int64_t)src_bytes);
+    return 1;
+}
+
+parsec_data_copy_t *
+parsec_reshape_view_copy(parsec_reshape_promise_description_t *dt)
+{
+    parsec_data_copy_t *copy = dt->data, *view;
+    parsec_data_t *data;
+    int size;
+
+    if( !parsec_param_reshape_view || dt->pack_required ) return NULL;
+    if( (NULL == copy) || (NULL == copy->device_private) || (0 != copy->device_index) ) return NULL;
+    /* Packing with the same datatype on both sides keeps every element at
+     * its place: the consumers can read them directly from the input copy. */
+    if( (PARSEC_DATATYPE_NULL == dt->local->dst_datatype) ||
+        (PARSEC_SUCCESS != parsec_type_match(dt->local->src_datatype, dt->local->dst_datatype)) ||
+        (dt->local->src_count != dt->local->dst_count) ||
+        (dt->local->src_displ != dt->local->dst_displ) ) {
+        return NULL;
+    }
+    if( PARSEC_SUCCESS != parsec_type_size(dt->local->dst_datatype, &size) ) return NULL;
+
+    data = parsec_data_new();
+    if( NULL == data ) return NULL;
+    view = parsec_data_copy_new(data, 0, dt->local->dst_datatype, PARSEC_DATA_FLAG_VIEW);
+    if( NULL == view ) {
+        PARSEC_OBJ_RELEASE(data);
+        return NULL;
+    }
+    data->nb_elts = NULL != copy->original ? copy->original->nb_elts : 0;
+    view->device_private = copy->device_private;
+    view->coherency_state = PARSEC_DATA_COHERENCY_EXCLUSIVE;
+    PARSEC_OBJ_RETAIN(copy);
+    view->view_of = copy;
+    parsec_data_start_transfer_ownership_to_copy(data, 0, PARSEC_FLOW_ACCESS_RW);
+    /* The data lives as long as the view, as for the arena copies */
+    PARSEC_OBJ_RELEASE(data);
+
+    parsec_atomic_fetch_inc_int64(&parsec_reshape_nb_avoided_copies);
+    parsec_atomic_fetch_add_int64(&parsec_reshape_nb_avoided_bytes, (int64_t)size * dt->local->dst_count);
+    return view;
+}
+
+void
+parsec_reshape_avoided_copies(int64_t *nb_copies, int64_t *nb_bytes)
+{
+    *nb_copies = parsec_reshape_nb_avoided_copies;
+    *nb_bytes  = parsec_reshape_nb_avoided_bytes;
+}
+
 
 /**
  *
@@ -133,6 +238,7 @@ parsec_new_reshape_promise(parsec_dep_data_description_t* data,
     future_in_data->remote_send_guard            = 0;
 #endif
     future_in_data->remote_recv_guard            = 0;
+    future_in_data->pack_required                = 0;
 
     parsec_future_init(data_future, parsec_local_reshape_cb, future_in_data,
                        parsec_reshape_check_match_datatypes, match_data,
@@ -178,6 +284,8 @@ void parsec_setup_nested_future(parsec_datacopy_future_t** future, ...)
     data->local.src_count    = old_cb_data_in->local->src_count;
     data->local.src_displ    = old_cb_data_in->local->src_displ;
     *future = parsec_new_reshape_promise(data, PARSEC_UNFULFILLED_RESHAPE_PROMISE);
+    /* The nested reshape is consumed by the successors of the parent one */
+    ((parsec_reshape_promise_description_t *)(*future)->cb_fulfill_data_in)->pack_required = old_cb_data_in->pack_required;
 
     /*However the match data has to match the one pass as arg */
     ((parsec_datatype_t*)(*future)->cb_match_data_in)[0] = match_d0;
@@ -204,6 +312,33 @@ void parsec_setup_nested_future(parsec_datacopy_future_t** future, ...)
 }
 
 
+/**
+ *
+ * Auxiliary routine to check if the consumer flow of a reshape could alter
+ * the data it receives: either by writing it, or by forwarding it to other
+ * successors that may write it.
+ */
+static int
+parsec_reshape_flow_needs_pack(const parsec_flow_t *flow)
+{
+    return (NULL == flow) || (flow->flow_flags & PARSEC_FLOW_ACCESS_WRITE) || (NULL != flow->dep_out[0]);
+}
+
+/**
+ *
+ * Auxiliary routine to find the input flow flow_index of task.
+ */
+static const parsec_flow_t *
+parsec_reshape_find_flow(const parsec_task_t *task, uint8_t flow_index)
+{
+    const parsec_task_class_t *tc = task->task_class;
+    for( int i = 0; (i < MAX_PARAM_COUNT) && (NULL != tc->in[i]); i++ ) {
+        if( tc->in[i]->flow_index == flow_index )
+            return tc->in[i];
+    }
+    return NULL;
+}
+
 /**
  *
  * Auxiliary routine to create a fulfilled/unfulfilled reshape promise if one was not
@@ -238,6 +373,7 @@ void parsec_setup_nested_future(parsec_datacopy_future_t** future, ...)
  * @param[inout] ouput_usage counter for the predecessor repo usage.
  *
  * @param[in] promise_type fulfilled or unfulfilled reshape promise.
+ * @param[in] successor_writes the successor flow may modify the data.
  */
 static void
 parsec_create_reshape_promise(parsec_execution_stream_t *es,
@@ -253,7 +389,8 @@ parsec_create_reshape_promise(parsec_execution_stream_t *es,
                               data_repo_t **setup_repo,
                               parsec_key_t *setup_repo_key,
                               uint32_t *output_usage,
-                              int promise_type)
+                              int promise_type,
+                              int successor_writes)
 {
     parsec_reshape_promise_description_t *future_in_data;
     uint8_t setup_flow_index;
@@ -324,6 +461,12 @@ parsec_create_reshape_promise(parsec_execution_stream_t *es,
     future_in_data = ((parsec_reshape_promise_description_t *)data->data_future->cb_fulfill_data_in);
     assert( data->data == future_in_data->data );
 
+    /* A view would let this successor modify, or ship, the memory of the
+     * input copy: it needs a packed copy of its own. */
+    if( successor_writes || ((dst_rank >= 0) && (dst_rank != src_rank)) ) {
+        future_in_data->pack_required = 1;
+    }
+
 #ifdef PARSEC_RESHAPE_BEFORE_SEND_TO_REMOTE
     if ( dst_rank != src_rank ) {
         if ( future_in_data->remote_send_guard & (1 << dep_datatype_index) ) return;
@@ -486,7 +629,8 @@ parsec_set_up_reshape_promise(parsec_execution_stream_t *es,
                                   &setup_repo,
                                   &setup_repo_key,
                                   &arg->output_usage,
-                                  promise_type);
+                                  promise_type,
+                                  parsec_reshape_flow_needs_pack(dep->flow));
 
     if(arg->action_mask & PARSEC_ACTION_RESHAPE_REMOTE_ON_RELEASE){
         /* Mark this future as originated after a reception
@@ -588,7 +732,8 @@ parsec_get_copy_reshape_inline(parsec_execution_stream_t *es,
                                       &setup_repo,
                                       &setup_repo_key,
                                       NULL,
-                                      PARSEC_UNFULFILLED_RESHAPE_PROMISE);
+                                      PARSEC_UNFULFILLED_RESHAPE_PROMISE,
+                                      parsec_reshape_flow_needs_pack(parsec_reshape_find_flow(task, dep_flow_index)));
 
 
 #if defined(PARSEC_DEBUG_NOISIER) || defined(PARSEC_DEBUG_PARANOID)
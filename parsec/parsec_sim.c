@@ -0,0 +1,613 @@
+/*
+ * Copyright (c) 2026      The University of Tennessee and The University
+ *                         of Tennessee Research Foundation.  All rights
+ *                         reserved.
+ */
+
+#include "parsec/parsec_config.h"
+#include "parsec/parsec_internal.h"
+#include "parsec/parsec_sim.h"
+#include "parsec/execution_stream.h"
+#include "parsec/data_internal.h"
+#include "parsec/data_distribution.h"
+#include "parsec/class/parsec_hash_table.h"
+#include "parsec/utils/mca_param.h"
+#include "parsec/utils/debug.h"
+#include "parsec/profiling.h"
+
+#include <string.h>
+#include <inttypes.h>
+
+#if defined(PARSEC_SIM)
+
+int parsec_sim_dry_body = 0;
+
+static int     parsec_sim_replay_enabled = 1;
+static int     parsec_sim_nb_ranks       = 1;
+static int     parsec_sim_nb_cores       = 0;
+static int     parsec_sim_default_cost   = 1000;
+static int     parsec_sim_net_latency    = 1000;
+static int     parsec_sim_net_bandwidth  = 10;   /* bytes per time unit */
+static int     parsec_sim_trace          = 1;
+
+static parsec_sim_rank_of_fn_t *parsec_sim_rank_of = NULL;
+static void                    *parsec_sim_rank_of_data = NULL;
+
+typedef struct parsec_sim_node_s parsec_sim_node_t;
+
+typedef struct {
+    uint32_t    taskpool_id;
+    uint32_t    task_class_id;
+    parsec_key_t key;
+} parsec_sim_task_id_t;
+
+typedef struct {
+    parsec_sim_node_t *dst;
+    uint64_t           bytes;
+} parsec_sim_edge_t;
+
+struct parsec_sim_node_s {
+    parsec_hash_table_item_t ht_item;
+    parsec_sim_task_id_t     id;
+    parsec_atomic_lock_t     lock;      /**< protects the successors array */
+    int32_t                  class_idx; /**< -1 as long as the task has only been seen as a successor */
+    int32_t                  rank;
+    int32_t                  priority;
+    int32_t                  pending;   /**< number of predecessors not yet simulated */
+    int64_t                  cost;
+    int64_t                  ready;     /**< date at which the last input is available on rank */
+    int64_t                  start;
+    int64_t                  end;
+    int32_t                  core;
+    uint64_t                 seq;       /**< FIFO order between tasks of the same priority */
+    uint64_t                 event_id;
+    int                      prof_key_start;
+    int                      prof_key_end;
+    int32_t                  nb_succ;
+    int32_t                  max_succ;
+    parsec_sim_edge_t       *succ;
+};
+
+typedef struct {
+    uint32_t taskpool_id;
+    uint32_t task_class_id;
+    char    *name;
+    int64_t  nb_tasks;
+    int64_t  busy;
+} parsec_sim_class_t;
+
+static parsec_hash_table_t *sim_nodes_ht = NULL;
+static parsec_atomic_lock_t sim_classes_lock = PARSEC_ATOMIC_UNLOCKED;
+static parsec_sim_class_t  *sim_classes = NULL;
+static int                  sim_nb_classes = 0;
+static int                  sim_max_classes = 0;
+static int64_t              sim_last_makespan = 0;
+#if defined(PARSEC_PROF_TRACE)
+static parsec_profiling_stream_t **sim_streams = NULL;
+static int                         sim_nb_streams = 0;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+
+static int sim_task_id_key_equal(parsec_key_t a, parsec_key_t b, void *unused)
+{
+    parsec_sim_task_id_t *id_a = (parsec_sim_task_id_t*)a;
+    parsec_sim_task_id_t *id_b = (parsec_sim_task_id_t*)b;
+    (void)unused;
+    return (id_a->taskpool_id == id_b->taskpool_id) &&
+           (id_a->task_class_id == id_b->task_class_id) &&
+           (id_a->key == id_b->key);
+}
+
+static char *sim_task_id_key_print(char *buffer, size_t buffer_size, parsec_key_t k, void *unused)
+{
+    parsec_sim_task_id_t *id = (parsec_sim_task_id_t*)k;
+    (void)unused;
+    snprintf(buffer, buffer_size, "tp %u tc %u key %"PRIu64,
+             id->taskpool_id, id->task_class_id, (uint64_t)id->key);
+    return buffer;
+}
+
+static uint64_t sim_task_id_key_hash(parsec_key_t k, void *unused)
+{
+    parsec_sim_task_id_t *id = (parsec_sim_task_id_t*)k;
+    (void)unused;
+    return ((uint64_t)id->key * 0x9E3779B97F4A7C15ULL) ^
+           ((uint64_t)id->taskpool_id << 32) ^ (uint64_t)id->task_class_id;
+}
+
+static parsec_key_fn_t parsec_sim_task_key_fns = {
+    .key_equal = sim_task_id_key_equal,
+    .key_print = sim_task_id_key_print,
+    .key_hash  = sim_task_id_key_hash
+};
+
+void parsec_sim_set_rank_of( parsec_sim_rank_of_fn_t *fn, void *cb_data )
+{
+    parsec_sim_rank_of      = fn;
+    parsec_sim_rank_of_data = cb_data;
+}
+
+int64_t parsec_getsimulatedmakespan( parsec_context_t *parsec_context )
+{
+    (void)parsec_context;
+    return sim_last_makespan;
+}
+
+int parsec_sim_init(parsec_context_t *context)
+{
+    parsec_mca_param_reg_int_name("sim", "replay", "Replay the DAG executed by each context wait on a virtual cluster "
+                                  "to predict its makespan (0: only compute the critical path)",
+                                  false, false, parsec_sim_replay_enabled, &parsec_sim_replay_enabled);
+    parsec_mca_param_reg_int_name("sim", "dry_body", "Do not execute the bodies of the tasks, only unfold the DAG",
+                                  false, false, parsec_sim_dry_body, &parsec_sim_dry_body);
+    parsec_mca_param_reg_int_name("sim", "ranks", "Number of processes of the simulated cluster",
+                                  false, false, parsec_sim_nb_ranks, &parsec_sim_nb_ranks);
+    parsec_mca_param_reg_int_name("sim", "cores", "Number of cores per process of the simulated cluster "
+                                  "(0: same as the number of computing threads of this process)",
+                                  false, false, parsec_sim_nb_cores, &parsec_sim_nb_cores);
+    parsec_mca_param_reg_int_name("sim", "default_cost", "Duration of the tasks that have no SIMCOST",
+                                  false, false, parsec_sim_default_cost, &parsec_sim_default_cost);
+    parsec_mca_param_reg_int_name("sim", "latency", "Latency of a transfer between two simulated processes",
+                                  false, false, parsec_sim_net_latency, &parsec_sim_net_latency);
+    parsec_mca_param_reg_int_name("sim", "bandwidth", "Bandwidth (in bytes per time unit) of the network link of each simulated process",
+                                  false, false, parsec_sim_net_bandwidth, &parsec_sim_net_bandwidth);
+    parsec_mca_param_reg_int_name("sim", "trace", "Generate one profiling stream per simulated core (requires profiling)",
+                                  false, false, parsec_sim_trace, &parsec_sim_trace);
+
+    if( parsec_sim_nb_ranks < 1 ) parsec_sim_nb_ranks = 1;
+    if( parsec_sim_nb_cores < 1 ) {
+        parsec_sim_nb_cores = 0;
+        for(int vp = 0; vp < context->nb_vp; vp++)
+            parsec_sim_nb_cores += context->virtual_processes[vp]->nb_cores;
+    }
+    if( parsec_sim_net_bandwidth < 1 ) parsec_sim_net_bandwidth = 1;
+    if( !parsec_sim_replay_enabled ) return PARSEC_SUCCESS;
+
+    sim_nodes_ht = PARSEC_OBJ_NEW(parsec_hash_table_t);
+    parsec_hash_table_init(sim_nodes_ht, offsetof(parsec_sim_node_t, ht_item), 16, parsec_sim_task_key_fns, NULL);
+    return PARSEC_SUCCESS;
+}
+
+static parsec_sim_node_t *parsec_sim_get_node(const parsec_task_t *task)
+{
+    parsec_sim_task_id_t id;
+    parsec_sim_node_t *node;
+    parsec_key_handle_t kh;
+    parsec_key_t key;
+
+    id.taskpool_id   = task->taskpool->taskpool_id;
+    id.task_class_id = task->task_class->task_class_id;
+    id.key           = task->task_class->make_key(task->taskpool, task->locals);
+    key = (parsec_key_t)(uintptr_t)&id;
+
+    parsec_hash_table_lock_bucket_handle(sim_nodes_ht, key, &kh);
+    if( NULL == (node = parsec_hash_table_nolock_find_handle(sim_nodes_ht, &kh)) ) {
+        node = (parsec_sim_node_t*)calloc(1, sizeof(parsec_sim_node_t));
+        node->id = id;
+        node->ht_item.key = (parsec_key_t)(uintptr_t)&node->id;
+        node->class_idx = -1;
+        parsec_atomic_lock_init(&node->lock);
+        parsec_hash_table_nolock_insert_handle(sim_nodes_ht, &kh, &node->ht_item);
+    }
+    parsec_hash_table_unlock_bucket_handle(sim_nodes_ht, &kh);
+    return node;
+}
+
+static int parsec_sim_get_class(const parsec_task_t *task)
+{
+    const parsec_task_class_t *tc = task->task_class;
+    uint32_t tp_id = task->taskpool->taskpool_id;
+    int idx;
+
+    parsec_atomic_lock(&sim_classes_lock);
+    for( idx = 0; idx < sim_nb_classes; idx++ ) {
+        if( (sim_classes[idx].taskpool_id == tp_id) &&
+            (sim_classes[idx].task_class_id == tc->task_class_id) )
+            goto done;
+    }
+    if( sim_nb_classes == sim_max_classes ) {
+        sim_max_classes = (0 == sim_max_classes) ? 16 : 2 * sim_max_classes;
+        sim_classes = (parsec_sim_class_t*)realloc(sim_classes, sim_max_classes * sizeof(parsec_sim_class_t));
+    }
+    sim_classes[idx].taskpool_id   = tp_id;
+    sim_classes[idx].task_class_id = tc->task_class_id;
+    sim_classes[idx].name          = strdup(tc->name);
+    sim_classes[idx].nb_tasks      = 0;
+    sim_classes[idx].busy          = 0;
+    sim_nb_classes++;
+  done:
+    parsec_atomic_unlock(&sim_classes_lock);
+    return idx;
+}
+
+void parsec_sim_task(parsec_execution_stream_t *es, const parsec_task_t *task)
+{
+    const parsec_task_class_t *tc = task->task_class;
+    parsec_sim_node_t *node;
+    (void)es;
+
+    if( NULL == sim_nodes_ht || NULL == tc->make_key ) return;
+
+    node = parsec_sim_get_node(task);
+    node->class_idx = parsec_sim_get_class(task);
+    node->priority  = task->priority;
+    node->cost      = (NULL != tc->sim_cost_fct) ? tc->sim_cost_fct(task) : parsec_sim_default_cost;
+    if( node->cost < 0 ) node->cost = 0;
+
+    node->rank = 0;
+    if( NULL != parsec_sim_rank_of ) {
+        node->rank = parsec_sim_rank_of(task, parsec_sim_nb_ranks, parsec_sim_rank_of_data);
+    } else if( NULL != tc->data_affinity ) {
+        parsec_data_ref_t ref;
+        ref.dc = NULL;
+        if( tc->data_affinity(task, &ref) && (NULL != ref.dc) ) {
+            node->rank = (int32_t)(ref.key % (parsec_data_key_t)parsec_sim_nb_ranks);
+        }
+    }
+    if( (node->rank < 0) || (node->rank >= parsec_sim_nb_ranks) )
+        node->rank = node->rank % parsec_sim_nb_ranks;
+    if( node->rank < 0 ) node->rank += parsec_sim_nb_ranks;
+
+#if defined(PARSEC_PROF_TRACE)
+    node->event_id = (NULL != tc->key_functions) ? tc->key_functions->key_hash(node->id.key, NULL) : node->id.key;
+    node->prof_key_start = node->prof_key_end = -1;
+    if( NULL != task->taskpool->profiling_array ) {
+        node->prof_key_start = PARSEC_PROF_FUNC_KEY_START(task->taskpool, tc->task_class_id);
+        node->prof_key_end   = PARSEC_PROF_FUNC_KEY_END(task->taskpool, tc->task_class_id);
+    }
+#endif  /* defined(PARSEC_PROF_TRACE) */
+}
+
+void parsec_sim_dep(const parsec_task_t *from, const parsec_task_t *to,
+                    const parsec_data_copy_t *data)
+{
+    parsec_sim_node_t *src, *dst;
+
+    if( NULL == sim_nodes_ht ||
+        NULL == from->task_class->make_key || NULL == to->task_class->make_key ) return;
+
+    src = parsec_sim_get_node(from);
+    dst = parsec_sim_get_node(to);
+
+    parsec_atomic_lock(&src->lock);
+    if( src->nb_succ == src->max_succ ) {
+        src->max_succ = (0 == src->max_succ) ? 4 : 2 * src->max_succ;
+        src->succ = (parsec_sim_edge_t*)realloc(src->succ, src->max_succ * sizeof(parsec_sim_edge_t));
+    }
+    src->succ[src->nb_succ].dst   = dst;
+    src->succ[src->nb_succ].bytes = ((NULL != data) && (NULL != data->original)) ? data->original->nb_elts : 0;
+    src->nb_succ++;
+    parsec_atomic_unlock(&src->lock);
+}
+
+/*
+ * Binary heaps used by the replay: the events are ordered by date, the ready
+ * tasks of each simulated process by priority (and FIFO for equal priorities).
+ */
+#define SIM_EVENT_READY 0
+#define SIM_EVENT_DONE  1
+
+typedef struct {
+    int64_t            date;
+    uint64_t           seq;
+    int                type;
+    parsec_sim_node_t *node;
+} parsec_sim_event_t;
+
+typedef struct {
+    void   *elts;
+    size_t  elt_size;
+    int     size;
+    int     max;
+    int   (*lower)(const void *a, const void *b);
+} parsec_sim_heap_t;
+
+static int sim_event_lower(const void *a, const void *b)
+{
+    const parsec_sim_event_t *ea = (const parsec_sim_event_t*)a, *eb = (const parsec_sim_event_t*)b;
+    if( ea->date != eb->date ) return ea->date < eb->date;
+    return ea->seq < eb->seq;
+}
+
+static int sim_ready_lower(const void *a, const void *b)
+{
+    const parsec_sim_node_t *na = *(parsec_sim_node_t* const*)a, *nb = *(parsec_sim_node_t* const*)b;
+    if( na->priority != nb->priority ) return na->priority > nb->priority;
+    return na->seq < nb->seq;
+}
+
+#define SIM_HEAP_ELT(H, I) ((char*)(H)->elts + (size_t)(I) * (H)->elt_size)
+
+static void sim_heap_swap(parsec_sim_heap_t *h, int i, int j)
+{
+    char tmp[sizeof(parsec_sim_event_t)];
+    memcpy(tmp, SIM_HEAP_ELT(h, i), h->elt_size);
+    memcpy(SIM_HEAP_ELT(h, i), SIM_HEAP_ELT(h, j), h->elt_size);
+    memcpy(SIM_HEAP_ELT(h, j), tmp, h->elt_size);
+}
+
+static void sim_heap_push(parsec_sim_heap_t *h, const void *elt)
+{
+    int i;
+    if( h->size == h->max ) {
+        h->max = (0 == h->max) ? 64 : 2 * h->max;
+        h->elts = realloc(h->elts, h->max * h->elt_size);
+    }
+    i = h->size++;
+    memcpy(SIM_HEAP_ELT(h, i), elt, h->elt_size);
+    while( i > 0 && h->lower(SIM_HEAP_ELT(h, i), SIM_HEAP_ELT(h, (i - 1) / 2)) ) {
+        sim_heap_swap(h, i, (i - 1) / 2);
+        i = (i - 1) / 2;
+    }
+}
+
+static int sim_heap_pop(parsec_sim_heap_t *h, void *elt)
+{
+    int i = 0, c;
+    if( 0 == h->size ) return 0;
+    memcpy(elt, SIM_HEAP_ELT(h, 0), h->elt_size);
+    h->size--;
+    if( 0 == h->size ) return 1;
+    memcpy(SIM_HEAP_ELT(h, 0), SIM_HEAP_ELT(h, h->size), h->elt_size);
+    while( (c = 2 * i + 1) < h->size ) {
+        if( (c + 1 < h->size) && h->lower(SIM_HEAP_ELT(h, c + 1), SIM_HEAP_ELT(h, c)) ) c++;
+        if( !h->lower(SIM_HEAP_ELT(h, c), SIM_HEAP_ELT(h, i)) ) break;
+        sim_heap_swap(h, i, c);
+        i = c;
+    }
+    return 1;
+}
+
+typedef struct {
+    parsec_sim_node_t **nodes;
+    int64_t             nb_nodes;
+} parsec_sim_collect_t;
+
+static void sim_collect_node(void *item, void *cb_data)
+{
+    parsec_sim_collect_t *col = (parsec_sim_collect_t*)cb_data;
+    col->nodes[col->nb_nodes++] = (parsec_sim_node_t*)item;
+}
+
+static void sim_count_node(void *item, void *cb_data)
+{
+    (void)item;
+    (*(int64_t*)cb_data)++;
+}
+
+static int sim_node_timeline_cmp(const void *a, const void *b)
+{
+    const parsec_sim_node_t *na = *(parsec_sim_node_t* const*)a, *nb = *(parsec_sim_node_t* const*)b;
+    if( na->rank != nb->rank ) return na->rank < nb->rank ? -1 : 1;
+    if( na->core != nb->core ) return na->core < nb->core ? -1 : 1;
+    if( na->start != nb->start ) return na->start < nb->start ? -1 : 1;
+    return 0;
+}
+
+#if defined(PARSEC_PROF_TRACE)
+static void parsec_sim_dump_trace(parsec_sim_node_t **nodes, int64_t nb_nodes)
+{
+    int nb_streams = parsec_sim_nb_ranks * parsec_sim_nb_cores;
+
+    if( !parsec_sim_trace || !parsec_profile_enabled ) return;
+    if( NULL == sim_streams ) {
+        sim_streams = (parsec_profiling_stream_t**)calloc(nb_streams, sizeof(parsec_profiling_stream_t*));
+        for( int s = 0; s < nb_streams; s++ ) {
+            sim_streams[s] = parsec_profiling_stream_init(2*1024*1024, "SIM rank %d core %d",
+                                                          s / parsec_sim_nb_cores, s % parsec_sim_nb_cores);
+            if( NULL == sim_streams[s] ) {
+                parsec_warning("Simulation:\tunable to create the profiling stream of simulated core %d (%s)",
+                               s, parsec_profiling_strerror());
+                break;
+            }
+            PROFILING_STREAM_SAVE_iINFO(sim_streams[s], "sim_rank", s / parsec_sim_nb_cores);
+            PROFILING_STREAM_SAVE_iINFO(sim_streams[s], "sim_core", s % parsec_sim_nb_cores);
+        }
+        sim_nb_streams = nb_streams;
+    }
+
+    qsort(nodes, nb_nodes, sizeof(parsec_sim_node_t*), sim_node_timeline_cmp);
+    for( int64_t i = 0; i < nb_nodes; i++ ) {
+        parsec_sim_node_t *node = nodes[i];
+        parsec_profiling_stream_t *stream;
+        if( -1 == node->prof_key_start ) continue;
+        stream = sim_streams[node->rank * parsec_sim_nb_cores + node->core];
+        if( NULL == stream ) continue;
+        parsec_profiling_trace_flags_at(stream, node->prof_key_start, node->event_id,
+                                        node->id.taskpool_id, NULL, 0, (uint64_t)node->start);
+        parsec_profiling_trace_flags_at(stream, node->prof_key_end, node->event_id,
+                                        node->id.taskpool_id, NULL, 0, (uint64_t)node->end);
+    }
+}
+#endif  /* defined(PARSEC_PROF_TRACE) */
+
+static void sim_free_node(void *item, void *cb_data)
+{
+    parsec_sim_node_t *node = (parsec_sim_node_t*)item;
+    parsec_hash_table_nolock_remove((parsec_hash_table_t*)cb_data, node->ht_item.key);
+    free(node->succ);
+    free(node);
+}
+
+int64_t parsec_sim_replay(parsec_context_t *context)
+{
+    parsec_sim_heap_t events = { NULL, sizeof(parsec_sim_event_t), 0, 0, sim_event_lower };
+    parsec_sim_heap_t *ready;
+    parsec_sim_collect_t col = { NULL, 0 };
+    parsec_sim_event_t ev;
+    int64_t nb_nodes = 0, nb_executed = 0, makespan = 0, work = 0;
+    int64_t *nic_free, *sent_to;
+    uint64_t seq = 0, inter_bytes = 0, nb_transfers = 0;
+    int32_t *idle_cores, *dirty, nb_dirty = 0;
+    uint8_t *core_busy;
+    char    *is_dirty;
+    (void)context;
+
+    if( NULL == sim_nodes_ht ) return 0;
+
+    parsec_hash_table_for_all(sim_nodes_ht, sim_count_node, &nb_nodes);
+    if( 0 == nb_nodes ) return 0;
+    col.nodes = (parsec_sim_node_t**)malloc(nb_nodes * sizeof(parsec_sim_node_t*));
+    parsec_hash_table_for_all(sim_nodes_ht, sim_collect_node, &col);
+
+    /* Count the predecessors of each task that has been executed */
+    for( int64_t i = 0; i < nb_nodes; i++ ) {
+        parsec_sim_node_t *node = col.nodes[i];
+        node->pending = 0;
+        node->ready   = 0;
+        node->seq     = 0;
+    }
+    for( int64_t i = 0; i < nb_nodes; i++ ) {
+        parsec_sim_node_t *node = col.nodes[i];
+        if( -1 == node->class_idx ) continue;
+        for( int32_t s = 0; s < node->nb_succ; s++ )
+            node->succ[s].dst->pending++;
+    }
+
+    ready      = (parsec_sim_heap_t*)calloc(parsec_sim_nb_ranks, sizeof(parsec_sim_heap_t));
+    idle_cores = (int32_t*)malloc(parsec_sim_nb_ranks * sizeof(int32_t));
+    nic_free   = (int64_t*)calloc(parsec_sim_nb_ranks, sizeof(int64_t));
+    sent_to    = (int64_t*)malloc(parsec_sim_nb_ranks * sizeof(int64_t));
+    dirty      = (int32_t*)malloc(parsec_sim_nb_ranks * sizeof(int32_t));
+    is_dirty   = (char*)calloc(parsec_sim_nb_ranks, sizeof(char));
+    core_busy  = (uint8_t*)calloc((size_t)parsec_sim_nb_ranks * parsec_sim_nb_cores, sizeof(uint8_t));
+    for( int r = 0; r < parsec_sim_nb_ranks; r++ ) {
+        ready[r].elt_size = sizeof(parsec_sim_node_t*);
+        ready[r].lower    = sim_ready_lower;
+        idle_cores[r]     = parsec_sim_nb_cores;
+    }
+
+    for( int64_t i = 0; i < nb_nodes; i++ ) {
+        parsec_sim_node_t *node = col.nodes[i];
+        if( -1 == node->class_idx || 0 != node->pending ) continue;
+        ev.date = 0; ev.seq = seq++; ev.type = SIM_EVENT_READY; ev.node = node;
+        sim_heap_push(&events, &ev);
+    }
+
+    while( sim_heap_pop(&events, &ev) ) {
+        parsec_sim_node_t *node = ev.node;
+        int64_t now = ev.date;
+
+        if( SIM_EVENT_READY == ev.type ) {
+            node->seq = seq++;
+            sim_heap_push(&ready[node->rank], &node);
+        } else {
+            core_busy[node->rank * parsec_sim_nb_cores + node->core] = 0;
+            idle_cores[node->rank]++;
+            if( node->end > makespan ) makespan = node->end;
+            for( int r = 0; r < parsec_sim_nb_ranks; r++ ) sent_to[r] = -1;
+            for( int32_t s = 0; s < node->nb_succ; s++ ) {
+                parsec_sim_node_t *succ = node->succ[s].dst;
+                int64_t arrival = now;
+                if( -1 == succ->class_idx ) continue;
+                if( succ->rank != node->rank ) {
+                    /* The data is sent once per destination process, and the
+                     * transfers from a process are serialized on its link */
+                    if( -1 == sent_to[succ->rank] ) {
+                        int64_t xfer  = (int64_t)(node->succ[s].bytes / (uint64_t)parsec_sim_net_bandwidth);
+                        int64_t start = (nic_free[node->rank] > now) ? nic_free[node->rank] : now;
+                        nic_free[node->rank] = start + xfer;
+                        sent_to[succ->rank] = start + xfer + parsec_sim_net_latency;
+                        inter_bytes += node->succ[s].bytes;
+                        nb_transfers++;
+                    }
+                    arrival = sent_to[succ->rank];
+                }
+                if( arrival > succ->ready ) succ->ready = arrival;
+                if( 0 == --succ->pending ) {
+                    ev.date = succ->ready; ev.seq = seq++; ev.type = SIM_EVENT_READY; ev.node = succ;
+                    sim_heap_push(&events, &ev);
+                }
+            }
+        }
+        if( !is_dirty[node->rank] ) {
+            is_dirty[node->rank] = 1;
+            dirty[nb_dirty++] = node->rank;
+        }
+
+        /* Process all the events happening at the same date before
+         * dispatching the ready tasks on the idle cores */
+        if( (events.size > 0) && (((parsec_sim_event_t*)events.elts)[0].date == now) ) continue;
+
+        for( int d = 0; d < nb_dirty; d++ ) {
+            int r = dirty[d];
+            parsec_sim_node_t *task;
+            is_dirty[r] = 0;
+            while( idle_cores[r] > 0 && sim_heap_pop(&ready[r], &task) ) {
+                int c;
+                for( c = 0; core_busy[r * parsec_sim_nb_cores + c]; c++ ) /* nothing */;
+                core_busy[r * parsec_sim_nb_cores + c] = 1;
+                idle_cores[r]--;
+                task->core  = c;
+                task->start = now;
+                task->end   = now + task->cost;
+                ev.date = task->end; ev.seq = seq++; ev.type = SIM_EVENT_DONE; ev.node = task;
+                sim_heap_push(&events, &ev);
+                sim_classes[task->class_idx].nb_tasks++;
+                sim_classes[task->class_idx].busy += task->cost;
+                work += task->cost;
+                nb_executed++;
+            }
+        }
+        nb_dirty = 0;
+    }
+
+    sim_last_makespan = makespan;
+    parsec_inform("Simulation:\t%"PRId64" tasks replayed on %d process(es) x %d core(s): predicted makespan %"PRId64
+                  " (efficiency %.2f%%, %"PRIu64" transfers, %"PRIu64" bytes between processes)",
+                  nb_executed, parsec_sim_nb_ranks, parsec_sim_nb_cores, makespan,
+                  (0 == makespan) ? 0.0 : (100.0 * (double)work) / ((double)makespan * parsec_sim_nb_ranks * parsec_sim_nb_cores),
+                  nb_transfers, inter_bytes);
+    for( int c = 0; c < sim_nb_classes; c++ ) {
+        if( 0 == sim_classes[c].nb_tasks ) continue;
+        parsec_debug_verbose(3, parsec_debug_output, "Simulation:\ttask class %s (taskpool %u): %"PRId64" tasks, busy %"PRId64,
+                             sim_classes[c].name, sim_classes[c].taskpool_id,
+                             sim_classes[c].nb_tasks, sim_classes[c].busy);
+        sim_classes[c].nb_tasks = 0;
+        sim_classes[c].busy = 0;
+    }
+    if( nb_executed != col.nb_nodes ) {
+        int64_t nb_recorded = 0;
+        for( int64_t i = 0; i < nb_nodes; i++ )
+            if( -1 != col.nodes[i]->class_idx ) nb_recorded++;
+        if( nb_executed != nb_recorded )
+            parsec_warning("Simulation:\tonly %"PRId64" out of %"PRId64" recorded tasks could be replayed (cycle in the recorded DAG?)",
+                           nb_executed, nb_recorded);
+    }
+
+#if defined(PARSEC_PROF_TRACE)
+    parsec_sim_dump_trace(col.nodes, nb_nodes);
+#endif  /* defined(PARSEC_PROF_TRACE) */
+
+    /* Forget about this DAG, the next context wait will record a new one */
+    parsec_hash_table_for_all(sim_nodes_ht, sim_free_node, sim_nodes_ht);
+
+    for( int r = 0; r < parsec_sim_nb_ranks; r++ ) free(ready[r].elts);
+    free(ready); free(idle_cores); free(nic_free); free(sent_to);
+    free(dirty); free(is_dirty); free(core_busy);
+    free(events.elts);
+    free(col.nodes);
+    return makespan;
+}
+
+void parsec_sim_fini(void)
+{
+    if( NULL != sim_nodes_ht ) {
+        parsec_hash_table_for_all(sim_nodes_ht, sim_free_node, sim_nodes_ht);
+        parsec_hash_table_fini(sim_nodes_ht);
+        PARSEC_OBJ_RELEASE(sim_nodes_ht);
+        sim_nodes_ht = NULL;
+    }
+    for( int c = 0; c < sim_nb_classes; c++ )
+        free(sim_classes[c].name);
+    free(sim_classes);
+    sim_classes = NULL;
+    sim_nb_classes = sim_max_classes = 0;
+#if defined(PARSEC_PROF_TRACE)
+    /* the streams are owned by the profiling system */
+    free(sim_streams);
+    sim_streams = NULL;
+    sim_nb_streams = 0;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+}
+
+#endif /* defined(PARSEC_SIM) */
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2026      The University of Tennessee and The University
+ *                         of Tennessee Research Foundation.  All rights
+ *                         reserved.
+ */
+
+#ifndef _parsec_sim_h
+#define _parsec_sim_h
+
+/**
+ *  @addtogroup parsec_internal_profiling
+ *  @{
+ *
+ * @file
+ *
+ * Discrete-event simulation of the DAG of tasks.
+ *
+ * When PaRSEC is compiled with PARSEC_SIM, the runtime records every task
+ * executed on this process, together with the dependencies between them and
+ * the amount of data each dependency carries. Once the context has been
+ * waited upon, the recorded DAG is replayed on a virtual cluster of
+ * sim_ranks processes with sim_cores cores each, using the per task class
+ * cost function (SIMCOST in the JDF) and a simple latency/bandwidth network
+ * model. The replay produces a predicted makespan and, if profiling is
+ * enabled, a trace in the normal profiling format with one stream per
+ * virtual core.
+ *
+ * All simulated dates and durations are expressed in the unit of the
+ * profiling clock (nanoseconds by default).
+ */
+
+#include "parsec/runtime.h"
+
+BEGIN_C_DECLS
+
+struct parsec_task_s;
+struct parsec_data_copy_s;
+
+/**
+ * Register the MCA parameters of the simulation engine and prepare
+ * the DAG recording.
+ */
+int   parsec_sim_init(parsec_context_t *context);
+
+/**
+ * Record a task executing on this process. Called before the body of
+ * the task is (possibly) executed.
+ */
+void  parsec_sim_task(parsec_execution_stream_t *es, const struct parsec_task_s *task);
+
+/**
+ * Record a dependency between the task from and the task to, carrying
+ * the data copy data (which can be NULL for control dependencies).
+ */
+void  parsec_sim_dep(const struct parsec_task_s *from, const struct parsec_task_s *to,
+                     const struct parsec_data_copy_s *data);
+
+/**
+ * Replay the DAG recorded since the last replay on the virtual cluster,
+ * report the predicted makespan and release the recorded DAG. Must be
+ * called by a single thread once all the recorded tasks are completed.
+ *
+ * @return the predicted makespan
+ */
+int64_t parsec_sim_replay(parsec_context_t *context);
+
+/**
+ * Release all resources used by the simulation engine.
+ */
+void  parsec_sim_fini(void);
+
+END_C_DECLS
+
+/** @} */
+
+#endif /* _parsec_sim_h */
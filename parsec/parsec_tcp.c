@@ -0,0 +1,1414 @@
+/*
+ * Copyright (c) 2026      The University of Tennessee and The University
+ *                         of Tennessee Research Foundation.  All rights
+ *                         reserved.
+ */
+
+#include "parsec/parsec_config.h"
+
+#include <assert.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <netdb.h>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/uio.h>
+#if defined(PARSEC_HAVE_MPI)
+#include <mpi.h>
+#endif  /* defined(PARSEC_HAVE_MPI) */
+
+#include "parsec/parsec_tcp.h"
+#include "parsec/remote_dep.h"
+#include "parsec/class/list.h"
+#include "parsec/execution_stream.h"
+#include "parsec/utils/debug.h"
+#include "parsec/utils/mca_param.h"
+#include "parsec/sys/atomic.h"
+
+/**
+ * Communication engine over TCP sockets, for the deployments without an MPI
+ * launcher. The processes are connected in a full mesh at initialization,
+ * and all the traffic to a peer goes through a single non-blocking socket,
+ * progressed by the communication thread with epoll.
+ *
+ * Every message is a frame: a fixed header, followed by the callback data
+ * (or the payload of an active message) and by the data of a transfer.
+ *  - the frames of a peer are queued in order, and sent with writev straight
+ *    from the memory of the data when it is contiguous;
+ *  - the data of a put up to runtime_comm_tcp_eager bytes follows the
+ *    header (eager), and is received with readv directly in the registered
+ *    memory of the target when it is contiguous;
+ *  - the larger data is only announced (RTS), and the target answers when
+ *    it knows where the data goes (CTS). The data is then sent in fragments
+ *    of runtime_comm_tcp_frag bytes, each fragment going back to the end of
+ *    the queue so the active messages are not stuck behind a large transfer;
+ *  - a get asks the owner of the data to put it back, the requester being
+ *    notified once the data has arrived and the owner once it is sent.
+ * The noncontiguous data is packed before being sent and unpacked once
+ * received, with the native datatype engine when the datatype allows it.
+ *
+ * The frames carry the addresses of callbacks, memory handles and operations
+ * of their sender, which the receiver trusts. Each process only listens on
+ * the address given for its rank, and the connections are only accepted from
+ * the processes that know the key of the job (PARSEC_TCP_KEY, or by default a
+ * hash of the addresses of all the processes); the key is sent in clear, so
+ * this only keeps the stray connections and the other jobs out. The engine
+ * must be run on a trusted network.
+ */
+
+typedef enum {
+    TCP_FRAME_AM = 1,    /**< active message, the payload is the callback data */
+    TCP_FRAME_PUT,       /**< eager put, the data follows the callback data */
+    TCP_FRAME_RTS,       /**< rendezvous put, the data waits for the CTS */
+    TCP_FRAME_CTS,       /**< the target of a rendezvous is ready */
+    TCP_FRAME_DATA,      /**< a fragment of the data of a rendezvous */
+    TCP_FRAME_GET,       /**< ask the owner of the data to put it back */
+    TCP_FRAME_BARRIER
+} tcp_frame_type_t;
+
+typedef struct tcp_frame_hdr_s {
+    uint32_t type;
+    uint32_t cb_size;    /**< bytes of callback data following the header */
+    uint64_t size;       /**< bytes of data following the callback data, or of the transfer */
+    uint64_t tag;        /**< tag of the active message, or callback of the transfer */
+    uint64_t handle;     /**< memory handle of the target (0 for the reply of a get) */
+    uint64_t displ;      /**< displacement in the target memory, or offset of a fragment */
+    uint64_t op;         /**< operation of the sender of the data */
+    uint64_t rop;        /**< operation of the receiver of the data */
+} tcp_frame_hdr_t;
+
+typedef struct tcp_mem_reg_handle_s {
+    void              *self;
+    void              *mem;
+    parsec_datatype_t  datatype;
+    int                count;
+    int                contiguous;  /**< the data is size bytes at mem */
+    size_t             size;        /**< bytes of the packed data */
+} tcp_mem_reg_handle_t;
+
+/* A transfer, on the side sending the data or on the side receiving it */
+typedef struct tcp_op_s {
+    int                            peer;
+    uint64_t                       rop;       /**< operation of the receiver (sender side) */
+    tcp_mem_reg_handle_t          *handle;    /**< local memory of the data */
+    ptrdiff_t                      displ;
+    char                          *buf;       /**< the data, in place or packed */
+    char                          *packed;    /**< packed copy of noncontiguous data */
+    size_t                         size;
+    size_t                         done;      /**< bytes sent (or received) */
+    /* completion of a put (sender side) or of a get (receiver side) */
+    parsec_ce_onesided_callback_t  l_cb;
+    void                          *l_cb_data;
+    parsec_ce_mem_reg_handle_t     lreg, rreg;
+    ptrdiff_t                      ldispl, rdispl;
+    /* completion of a put (receiver side) or of a get (sender side) */
+    parsec_ce_am_callback_t        am_cb;
+    void                          *msg;
+    size_t                         msg_size;
+    void                          *am_cb_data;
+} tcp_op_t;
+
+typedef struct tcp_frag_s {
+    parsec_list_item_t  super;
+    tcp_frame_hdr_t     hdr;
+    struct iovec        iov[3];
+    int                 first, iovcnt;
+    char               *owned;   /**< copy of the callback data, released once sent */
+    tcp_op_t           *op;      /**< transfer completed (or continued) once sent */
+} tcp_frag_t;
+
+typedef enum {
+    TCP_RECV_HDR = 0,
+    TCP_RECV_BODY
+} tcp_recv_state_t;
+
+typedef struct tcp_peer_s {
+    int                 fd;
+    volatile int32_t    armed;     /**< EPOLLOUT is registered */
+    int                 closed;    /**< the peer has shut down its side */
+    parsec_list_t       sendq;     /**< fed by any thread (active messages of the termination detection) */
+    tcp_frag_t         *current;   /**< partially written frame */
+    /* reception of the current frame */
+    tcp_recv_state_t    rstate;
+    tcp_frame_hdr_t     rhdr;
+    size_t              rgot;
+    char               *rcb;
+    tcp_op_t           *rop;
+    struct iovec        riov[2];
+    int                 rfirst;
+} tcp_peer_t;
+
+typedef struct tcp_tag_s {
+    parsec_ce_am_callback_t  callback;
+    void                    *cb_data;
+    size_t                   msg_length;
+} tcp_tag_t;
+
+/* An active message received before its tag was registered */
+typedef struct tcp_pending_am_s {
+    parsec_list_item_t  super;
+    parsec_ce_tag_t     tag;
+    int                 src;
+    size_t              size;
+    char               *msg;
+} tcp_pending_am_t;
+
+#define TCP_MAX_EVENTS 64
+
+static int tcp_param_port = 27500;
+static int tcp_param_eager = 64 * 1024;
+static int tcp_param_frag = 1024 * 1024;
+static int tcp_param_timeout = 60;
+
+static tcp_peer_t *tcp_peers = NULL;
+static int tcp_nb_peers = 0;
+static int tcp_my_rank = 0;
+static int *tcp_host_of = NULL;  /**< lowest rank with the same host address, for each rank */
+static int tcp_epfd = -1;
+static tcp_tag_t tcp_tags[PARSEC_MAX_REGISTERED_TAGS];
+static parsec_list_t tcp_pending_ams;
+static int tcp_barrier_arrived = 0;
+static int tcp_barrier_released = 0;
+
+static int tcp_comm_engine_enable(parsec_comm_engine_t *ce);
+static int tcp_comm_engine_disable(parsec_comm_engine_t *ce);
+static int tcp_comm_engine_progress(parsec_comm_engine_t *ce);
+
+/******************************************************************************
+ * Bootstrap
+ ******************************************************************************/
+
+/* Split host[:port], the port defaulting to the base port plus the rank */
+static int
+tcp_parse_address(const char *str, int rank, char **hosts, int *ports)
+{
+    const char *colon = strrchr(str, ':');
+    size_t len = (NULL != colon) ? (size_t)(colon - str) : strlen(str);
+
+    while( (len > 0) && ((' ' == *str) || ('\t' == *str)) ) { str++; len--; }
+    while( (len > 0) && ((' ' == str[len-1]) || ('\t' == str[len-1]) ||
+                         ('\n' == str[len-1]) || ('\r' == str[len-1])) ) len--;
+    if( 0 == len ) return PARSEC_ERROR;
+    hosts[rank] = strndup(str, len);
+    ports[rank] = (NULL != colon) ? atoi(colon + 1) : tcp_param_port + rank;
+    return PARSEC_SUCCESS;
+}
+
+/* Find this process and its peers in the environment: the addresses of the
+ * processes come from PARSEC_TCP_NODES, PARSEC_TCP_HOSTFILE or, when only
+ * PARSEC_TCP_SIZE is given, are all on the loopback. */
+static int
+tcp_bootstrap(int *rank, int *size, char ***hosts, int **ports)
+{
+    const char *env;
+    char *list = NULL, *saveptr = NULL, *token;
+    int n = 0, cap = 16;
+
+    *rank = 0; *size = 1;
+    *hosts = NULL; *ports = NULL;
+    if( NULL == (env = getenv("PARSEC_TCP_RANK")) ) {
+        parsec_warning("TCP:\tPARSEC_TCP_RANK is not set, running as a single process");
+        return PARSEC_SUCCESS;
+    }
+    *rank = atoi(env);
+
+    if( NULL != (env = getenv("PARSEC_TCP_NODES")) ) {
+        list = strdup(env);
+    } else if( NULL != (env = getenv("PARSEC_TCP_HOSTFILE")) ) {
+        FILE *f = fopen(env, "r");
+        char line[1024];
+        size_t used = 0, total = 1024;
+
+        if( NULL == f ) {
+            parsec_warning("TCP:\tCannot open the hostfile %s (%s)", env, strerror(errno));
+            return PARSEC_ERROR;
+        }
+        list = (char*)calloc(1, total);
+        while( NULL != fgets(line, sizeof(line), f) ) {
+            char *l = line + strspn(line, " \t");
+            size_t len = strcspn(l, "#\r\n");
+            if( 0 == len ) continue;
+            if( used + len + 2 > total ) {
+                total = 2 * (used + len + 2);
+                list = (char*)realloc(list, total);
+            }
+            memcpy(list + used, l, len);
+            used += len;
+            list[used++] = ',';
+            list[used] = '\0';
+        }
+        fclose(f);
+    } else if( NULL != (env = getenv("PARSEC_TCP_SIZE")) ) {
+        *size = atoi(env);
+        if( (*size < 1) || (*rank < 0) || (*rank >= *size) ) {
+            parsec_warning("TCP:\tInvalid rank %d for %d processes", *rank, *size);
+            return PARSEC_ERROR;
+        }
+        *hosts = (char**)calloc(*size, sizeof(char*));
+        *ports = (int*)calloc(*size, sizeof(int));
+        for( n = 0; n < *size; n++ ) {
+            (*hosts)[n] = strdup("127.0.0.1");
+            (*ports)[n] = tcp_param_port + n;
+        }
+        return PARSEC_SUCCESS;
+    } else {
+        parsec_warning("TCP:\tNone of PARSEC_TCP_NODES, PARSEC_TCP_HOSTFILE or PARSEC_TCP_SIZE is set");
+        return PARSEC_ERROR;
+    }
+
+    *hosts = (char**)calloc(cap, sizeof(char*));
+    *ports = (int*)calloc(cap, sizeof(int));
+    for( token = strtok_r(list, ",", &saveptr); NULL != token; token = strtok_r(NULL, ",", &saveptr) ) {
+        if( n == cap ) {
+            cap *= 2;
+            *hosts = (char**)realloc(*hosts, cap * sizeof(char*));
+            *ports = (int*)realloc(*ports, cap * sizeof(int));
+        }
+        if( PARSEC_SUCCESS == tcp_parse_address(token, n, *hosts, *ports) ) n++;
+    }
+    free(list);
+    *size = n;
+    if( (*rank < 0) || (*rank >= *size) ) {
+        parsec_warning("TCP:\tInvalid rank %d for %d processes", *rank, *size);
+        return PARSEC_ERROR;
+    }
+    return PARSEC_SUCCESS;
+}
+
+static int
+tcp_write_all(int fd, const void *buf, size_t len)
+{
+    const char *p = (const char*)buf;
+    while( len > 0 ) {
+        ssize_t n = write(fd, p, len);
+        if( n < 0 ) {
+            if( EINTR == errno ) continue;
+            return PARSEC_ERROR;
+        }
+        p += n; len -= (size_t)n;
+    }
+    return PARSEC_SUCCESS;
+}
+
+static int
+tcp_read_all(int fd, void *buf, size_t len)
+{
+    char *p = (char*)buf;
+    while( len > 0 ) {
+        ssize_t n = read(fd, p, len);
+        if( n < 0 ) {
+            if( EINTR == errno ) continue;
+            return PARSEC_ERROR;
+        }
+        if( 0 == n ) return PARSEC_ERROR;
+        p += n; len -= (size_t)n;
+    }
+    return PARSEC_SUCCESS;
+}
+
+/* Listen on the address of this process only, not on all the interfaces */
+static int
+tcp_listen(const char *host, int port)
+{
+    struct addrinfo hints, *res, *ai;
+    char service[16];
+    int fd = -1, one = 1, err = EADDRNOTAVAIL, rc;
+
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    hints.ai_flags = AI_PASSIVE;
+    snprintf(service, sizeof(service), "%d", port);
+    if( 0 != (rc = getaddrinfo(host, service, &hints, &res)) ) {
+        parsec_warning("TCP:\tCannot resolve %s (%s)", host, gai_strerror(rc));
+        errno = EADDRNOTAVAIL;
+        return -1;
+    }
+    for( ai = res; NULL != ai; ai = ai->ai_next ) {
+        if( -1 == (fd = socket(ai->ai_family, ai->ai_socktype, ai->ai_protocol)) ) continue;
+        setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+        if( (0 == bind(fd, ai->ai_addr, ai->ai_addrlen)) &&
+            (0 == listen(fd, SOMAXCONN)) ) break;
+        err = errno;
+        close(fd); fd = -1;
+    }
+    freeaddrinfo(res);
+    if( -1 == fd ) errno = err;
+    return fd;
+}
+
+/* Connect to a peer, retrying until it listens or the timeout expires */
+static int
+tcp_connect(const char *host, int port, time_t deadline)
+{
+    struct addrinfo hints, *res, *ai;
+    char service[16];
+    int fd = -1, rc;
+
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    snprintf(service, sizeof(service), "%d", port);
+    if( 0 != (rc = getaddrinfo(host, service, &hints, &res)) ) {
+        parsec_warning("TCP:\tCannot resolve %s (%s)", host, gai_strerror(rc));
+        return -1;
+    }
+    do {
+        for( ai = res; NULL != ai; ai = ai->ai_next ) {
+            if( -1 == (fd = socket(ai->ai_family, ai->ai_socktype, ai->ai_protocol)) ) continue;
+            if( 0 == connect(fd, ai->ai_addr, ai->ai_addrlen) ) break;
+            close(fd); fd = -1;
+        }
+        if( -1 != fd ) break;
+        usleep(10000);
+    } while( time(NULL) < deadline );
+    freeaddrinfo(res);
+    return fd;
+}
+
+static void
+tcp_peer_setup(int rank, int fd)
+{
+    struct epoll_event ev;
+    int one = 1;
+
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+    tcp_peers[rank].fd = fd;
+    ev.events = EPOLLIN;
+    ev.data.u32 = (uint32_t)rank;
+    epoll_ctl(tcp_epfd, EPOLL_CTL_ADD, fd, &ev);
+}
+
+/* What a process sends when it connects, and the answer it gets back */
+typedef struct tcp_hello_s {
+    uint64_t key;    /**< key of the job, see tcp_job_key */
+    int32_t  rank;
+    int32_t  size;
+} tcp_hello_t;
+
+/* The key the processes of the job must present: a hash (FNV-1a) of
+ * PARSEC_TCP_KEY when it is set, otherwise of the addresses of all the
+ * processes, so at least the processes of another job are rejected */
+static uint64_t
+tcp_job_key(char **hosts, int *ports)
+{
+    const char *key = getenv("PARSEC_TCP_KEY");
+    uint64_t h = 0xcbf29ce484222325ULL;
+    char port[16];
+
+#define TCP_HASH(STR) for( const char *c = (STR); '\0' != *c; c++ ) { h ^= (uint8_t)*c; h *= 0x100000001b3ULL; }
+    if( NULL != key ) {
+        TCP_HASH(key);
+        return h;
+    }
+    for( int i = 0; i < tcp_nb_peers; i++ ) {
+        snprintf(port, sizeof(port), ":%d,", ports[i]);
+        TCP_HASH(hosts[i]);
+        TCP_HASH(port);
+    }
+#undef TCP_HASH
+    return h;
+}
+
+/* Receive the hello of a peer, waiting at most timeout seconds for it */
+static int
+tcp_read_hello(int fd, tcp_hello_t *hello, int timeout)
+{
+    struct timeval tv = { .tv_sec = (timeout > 0) ? timeout : 1, .tv_usec = 0 };
+    int rc;
+
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+    rc = tcp_read_all(fd, hello, sizeof(tcp_hello_t));
+    tv.tv_sec = 0;
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+    return rc;
+}
+
+/* Full mesh: every process connects to the lower ranks, and accepts the
+ * connections of the higher ones, each of them introducing itself with the
+ * key of the job and its rank, and getting the same back. The connections
+ * that do not present the key are dropped. */
+static int
+tcp_wireup(char **hosts, int *ports)
+{
+    time_t deadline = time(NULL) + tcp_param_timeout;
+    int lfd = -1, i, fd, peer, accepted;
+    tcp_hello_t hello, mine;
+
+    mine.key  = tcp_job_key(hosts, ports);
+    mine.rank = tcp_my_rank;
+    mine.size = tcp_nb_peers;
+    if( tcp_my_rank < tcp_nb_peers - 1 ) {
+        /* the port can be briefly held by another connection */
+        while( (-1 == (lfd = tcp_listen(hosts[tcp_my_rank], ports[tcp_my_rank]))) &&
+               (EADDRINUSE == errno) && (time(NULL) < deadline) )
+            usleep(10000);
+        if( -1 == lfd ) {
+            parsec_warning("TCP:\tRank %d cannot listen on port %d (%s)", tcp_my_rank, ports[tcp_my_rank], strerror(errno));
+            return PARSEC_ERROR;
+        }
+    }
+    for( i = 0; i < tcp_my_rank; i++ ) {
+        if( -1 == (fd = tcp_connect(hosts[i], ports[i], deadline)) ) {
+            parsec_warning("TCP:\tRank %d cannot connect to rank %d at %s:%d", tcp_my_rank, i, hosts[i], ports[i]);
+            goto error;
+        }
+        if( (PARSEC_SUCCESS != tcp_write_all(fd, &mine, sizeof(mine))) ||
+            (PARSEC_SUCCESS != tcp_read_hello(fd, &hello, (int)(deadline - time(NULL)))) ||
+            (hello.key != mine.key) || (hello.rank != i) || (hello.size != tcp_nb_peers) ) {
+            parsec_warning("TCP:\tRank %d cannot introduce itself to rank %d at %s:%d (not the same job?)",
+                           tcp_my_rank, i, hosts[i], ports[i]);
+            close(fd);
+            goto error;
+        }
+        tcp_peer_setup(i, fd);
+    }
+    for( accepted = tcp_my_rank + 1; accepted < tcp_nb_peers; ) {
+        struct pollfd pfd = { .fd = lfd, .events = POLLIN, .revents = 0 };
+        int remaining = (int)(deadline - time(NULL));
+
+        if( (remaining <= 0) || (1 != poll(&pfd, 1, remaining * 1000)) ||
+            (-1 == (fd = accept(lfd, NULL, NULL))) ) {
+            parsec_warning("TCP:\tRank %d timed out waiting for the connections of the higher ranks", tcp_my_rank);
+            goto error;
+        }
+        if( (PARSEC_SUCCESS != tcp_read_hello(fd, &hello, remaining)) ||
+            (hello.key != mine.key) || (hello.size != tcp_nb_peers) ||
+            (hello.rank <= tcp_my_rank) || (hello.rank >= tcp_nb_peers) || (-1 != tcp_peers[hello.rank].fd) ||
+            (PARSEC_SUCCESS != tcp_write_all(fd, &mine, sizeof(mine))) ) {
+            /* not a process of this job, keep waiting for them */
+            parsec_warning("TCP:\tRank %d dropped an invalid connection", tcp_my_rank);
+            close(fd);
+            continue;
+        }
+        peer = hello.rank;
+        tcp_peer_setup(peer, fd);
+        accepted++;
+    }
+    if( -1 != lfd ) close(lfd);
+    return PARSEC_SUCCESS;
+  error:
+    if( -1 != lfd ) close(lfd);
+    return PARSEC_ERROR;
+}
+
+/******************************************************************************
+ * Datatypes
+ ******************************************************************************/
+
+static int
+tcp_pack(parsec_comm_engine_t *ce,
+         void *inbuf, int incount, parsec_datatype_t type,
+         void *outbuf, int outsize,
+         int *position)
+{
+    (void)ce;
+    if( PARSEC_SUCCESS == parsec_type_pack(inbuf, incount, type, outbuf, outsize, position) )
+        return PARSEC_SUCCESS;
+#if defined(PARSEC_HAVE_MPI)
+    return (MPI_SUCCESS == MPI_Pack(inbuf, incount, type, outbuf, outsize, position, MPI_COMM_SELF)) ? PARSEC_SUCCESS : PARSEC_ERROR;
+#else
+    return PARSEC_ERR_NOT_SUPPORTED;
+#endif  /* defined(PARSEC_HAVE_MPI) */
+}
+
+static int
+tcp_pack_size(parsec_comm_engine_t *ce,
+              int incount, parsec_datatype_t type,
+              int *size)
+{
+    (void)ce;
+    if( PARSEC_SUCCESS == parsec_type_pack_size(incount, type, size) )
+        return PARSEC_SUCCESS;
+#if defined(PARSEC_HAVE_MPI)
+    return (MPI_SUCCESS == MPI_Pack_size(incount, type, MPI_COMM_SELF, size)) ? PARSEC_SUCCESS : PARSEC_ERROR;
+#else
+    return PARSEC_ERR_NOT_SUPPORTED;
+#endif  /* defined(PARSEC_HAVE_MPI) */
+}
+
+static int
+tcp_unpack(parsec_comm_engine_t *ce,
+           void *inbuf, int insize, int *position,
+           void *outbuf, int outcount, parsec_datatype_t type)
+{
+    (void)ce;
+    if( PARSEC_SUCCESS == parsec_type_unpack(inbuf, insize, position, outbuf, outcount, type) )
+        return PARSEC_SUCCESS;
+#if defined(PARSEC_HAVE_MPI)
+    return (MPI_SUCCESS == MPI_Unpack(inbuf, insize, position, outbuf, outcount, type, MPI_COMM_SELF)) ? PARSEC_SUCCESS : PARSEC_ERROR;
+#else
+    return PARSEC_ERR_NOT_SUPPORTED;
+#endif  /* defined(PARSEC_HAVE_MPI) */
+}
+
+/* Local copy between two layouts, through the packed representation */
+static int
+tcp_reshape(parsec_comm_engine_t *ce,
+            parsec_execution_stream_t* es,
+            parsec_data_copy_t *dst,
+            int64_t displ_dst,
+            parsec_datatype_t layout_dst,
+            uint64_t count_dst,
+            parsec_data_copy_t *src,
+            int64_t displ_src,
+            parsec_datatype_t layout_src,
+            uint64_t count_src)
+{
+    int size = 0, position = 0, rc;
+    char *buf;
+
+    (void)es;
+    if( PARSEC_SUCCESS != tcp_pack_size(ce, (int)count_src, layout_src, &size) ) return -1;
+    buf = (char*)malloc(size > 0 ? size : 1);
+    rc = tcp_pack(ce, (char*)PARSEC_DATA_COPY_GET_PTR(src) + displ_src, (int)count_src, layout_src,
+                  buf, size, &position);
+    if( PARSEC_SUCCESS == rc ) {
+        position = 0;
+        rc = tcp_unpack(ce, buf, size, &position,
+                        (char*)PARSEC_DATA_COPY_GET_PTR(dst) + displ_dst, (int)count_dst, layout_dst);
+    }
+    free(buf);
+    return (PARSEC_SUCCESS == rc) ? 0 : -1;
+}
+
+/******************************************************************************
+ * Memory registration
+ ******************************************************************************/
+
+static int
+tcp_mem_register(void *mem, parsec_mem_type_t mem_type,
+                 size_t count, parsec_datatype_t datatype,
+                 size_t mem_size,
+                 parsec_ce_mem_reg_handle_t *lreg,
+                 size_t *lreg_size)
+{
+    tcp_mem_reg_handle_t *handle = (tcp_mem_reg_handle_t*)malloc(sizeof(tcp_mem_reg_handle_t));
+
+    handle->self = handle;
+    handle->mem  = mem;
+    if( PARSEC_MEM_TYPE_CONTIGUOUS == mem_type ) {
+        handle->datatype   = parsec_datatype_uint8_t;
+        handle->count      = (int)mem_size;
+        handle->contiguous = 1;
+        handle->size       = mem_size;
+    } else {
+        ptrdiff_t lb, extent;
+        int size = 0, packed = 0;
+        parsec_type_size(datatype, &size);
+        parsec_type_extent(datatype, &lb, &extent);
+        handle->datatype   = datatype;
+        handle->count      = (int)count;
+        handle->contiguous = (0 == lb) && (extent == size);
+        if( handle->contiguous ) {
+            handle->size = (size_t)size * count;
+        } else {
+            tcp_pack_size(NULL, (int)count, datatype, &packed);
+            handle->size = (size_t)packed;
+        }
+    }
+    *lreg = handle;
+    *lreg_size = sizeof(tcp_mem_reg_handle_t);
+    return 1;
+}
+
+static int
+tcp_mem_unregister(parsec_ce_mem_reg_handle_t *lreg)
+{
+    tcp_mem_reg_handle_t *handle = (tcp_mem_reg_handle_t*)*lreg;
+    free(handle->self);
+    *lreg = NULL;
+    return 1;
+}
+
+static int
+tcp_get_mem_reg_handle_size(void)
+{
+    return sizeof(tcp_mem_reg_handle_t);
+}
+
+static int
+tcp_mem_retrieve(parsec_ce_mem_reg_handle_t lreg,
+                 void **mem, parsec_datatype_t *datatype, int *count)
+{
+    tcp_mem_reg_handle_t *handle = (tcp_mem_reg_handle_t*)lreg;
+    *mem = handle->mem;
+    *datatype = handle->datatype;
+    *count = handle->count;
+    return 1;
+}
+
+/******************************************************************************
+ * Sending
+ ******************************************************************************/
+
+/* Skip n bytes of an iovec array, returns 1 once everything is consumed */
+static int
+tcp_iov_advance(struct iovec *iov, int *first, int iovcnt, size_t n)
+{
+    while( *first < iovcnt ) {
+        if( n < iov[*first].iov_len ) {
+            iov[*first].iov_base = (char*)iov[*first].iov_base + n;
+            iov[*first].iov_len -= n;
+            return 0;
+        }
+        n -= iov[*first].iov_len;
+        (*first)++;
+    }
+    return 1;
+}
+
+static void
+tcp_peer_arm(tcp_peer_t *peer, int rank, int on)
+{
+    struct epoll_event ev;
+
+    if( peer->armed == on ) return;
+    ev.events = EPOLLIN | (on ? EPOLLOUT : 0);
+    ev.data.u32 = (uint32_t)rank;
+    epoll_ctl(tcp_epfd, EPOLL_CTL_MOD, peer->fd, &ev);
+    peer->armed = on;
+}
+
+static tcp_frag_t *
+tcp_frag_new(int type, const void *cb, size_t cb_size, const void *data, size_t size)
+{
+    tcp_frag_t *frag = (tcp_frag_t*)calloc(1, sizeof(tcp_frag_t));
+
+    PARSEC_OBJ_CONSTRUCT(&frag->super, parsec_list_item_t);
+    frag->hdr.type = (uint32_t)type;
+    frag->hdr.cb_size = (uint32_t)cb_size;
+    frag->hdr.size = size;
+    if( cb_size > 0 ) {
+        frag->owned = (char*)malloc(cb_size);
+        memcpy(frag->owned, cb, cb_size);
+    }
+    frag->iov[0].iov_base = &frag->hdr;
+    frag->iov[0].iov_len  = sizeof(tcp_frame_hdr_t);
+    frag->iov[1].iov_base = frag->owned;
+    frag->iov[1].iov_len  = cb_size;
+    frag->iov[2].iov_base = (void*)data;
+    frag->iov[2].iov_len  = size;
+    frag->iovcnt = 3;
+    return frag;
+}
+
+/* The next fragment of the data of a rendezvous */
+static void
+tcp_frag_data(tcp_frag_t *frag, tcp_op_t *op)
+{
+    size_t len = op->size - op->done;
+
+    if( (tcp_param_frag > 0) && (len > (size_t)tcp_param_frag) ) len = (size_t)tcp_param_frag;
+    memset(&frag->hdr, 0, sizeof(tcp_frame_hdr_t));
+    frag->hdr.type  = TCP_FRAME_DATA;
+    frag->hdr.size  = len;
+    frag->hdr.displ = op->done;
+    frag->hdr.rop   = op->rop;
+    frag->iov[0].iov_base = &frag->hdr;
+    frag->iov[0].iov_len  = sizeof(tcp_frame_hdr_t);
+    frag->iov[1].iov_len  = 0;
+    frag->iov[2].iov_base = op->buf + op->done;
+    frag->iov[2].iov_len  = len;
+    frag->first = 0;
+    frag->op = op;
+    op->done += len;
+}
+
+static void
+tcp_op_free(tcp_op_t *op)
+{
+    free(op->packed);
+    free(op->msg);
+    free(op);
+}
+
+/* All the data of a transfer is sent */
+static void
+tcp_op_send_done(parsec_comm_engine_t *ce, tcp_op_t *op)
+{
+    if( NULL != op->l_cb ) {
+        op->l_cb(ce, op->lreg, op->ldispl, op->rreg, op->rdispl, op->size, op->peer, op->l_cb_data);
+    } else if( NULL != op->am_cb ) {
+        op->am_cb(ce, 0, op->msg, op->msg_size, op->peer, op->am_cb_data);
+    }
+    tcp_op_free(op);
+}
+
+/* All the data of a transfer is received */
+static void
+tcp_op_recv_done(parsec_comm_engine_t *ce, tcp_op_t *op)
+{
+    if( NULL != op->packed ) {
+        int position = 0;
+        if( PARSEC_SUCCESS != tcp_unpack(ce, op->packed, (int)op->size, &position,
+                                         (char*)op->handle->mem + op->displ, op->handle->count, op->handle->datatype) )
+            parsec_fatal("TCP:\tCannot unpack the %zu bytes received from %d", op->size, op->peer);
+    }
+    if( NULL != op->l_cb ) {
+        op->l_cb(ce, op->lreg, op->ldispl, op->rreg, op->rdispl, op->size, op->peer, op->l_cb_data);
+    } else if( NULL != op->am_cb ) {
+        op->am_cb(ce, 0, op->msg, op->msg_size, op->peer, NULL);
+    }
+    tcp_op_free(op);
+}
+
+/* A frame is completely written */
+static void
+tcp_frag_sent(parsec_comm_engine_t *ce, tcp_peer_t *peer, tcp_frag_t *frag)
+{
+    tcp_op_t *op = frag->op;
+
+    if( TCP_FRAME_DATA == frag->hdr.type ) {
+        if( op->done < op->size ) {
+            /* behind the frames queued in the meantime */
+            tcp_frag_data(frag, op);
+            parsec_list_push_back(&peer->sendq, &frag->super);
+            return;
+        }
+        tcp_op_send_done(ce, op);
+    } else if( (TCP_FRAME_PUT == frag->hdr.type) && (NULL != op) ) {
+        tcp_op_send_done(ce, op);
+    }
+    free(frag->owned);
+    PARSEC_OBJ_DESTRUCT(&frag->super);
+    free(frag);
+}
+
+static int
+tcp_peer_send(parsec_comm_engine_t *ce, int rank)
+{
+    tcp_peer_t *peer = &tcp_peers[rank];
+    tcp_frag_t *frag;
+    int nb = 0;
+
+  again:
+    while( (NULL != (frag = peer->current)) ||
+           (NULL != (frag = (tcp_frag_t*)parsec_list_pop_front(&peer->sendq))) ) {
+        struct msghdr mh;
+        ssize_t n;
+
+        memset(&mh, 0, sizeof(mh));
+        mh.msg_iov    = frag->iov + frag->first;
+        mh.msg_iovlen = frag->iovcnt - frag->first;
+        /* writev, without SIGPIPE should the peer be gone */
+        n = sendmsg(peer->fd, &mh, MSG_NOSIGNAL);
+        if( n < 0 ) {
+            if( EINTR == errno ) {
+                peer->current = frag;  /* retry this frame, not the next one */
+                continue;
+            }
+            if( (EAGAIN == errno) || (EWOULDBLOCK == errno) ) {
+                peer->current = frag;
+                tcp_peer_arm(peer, rank, 1);
+                return nb;
+            }
+            parsec_fatal("TCP:\tCannot write to rank %d (%s)", rank, strerror(errno));
+        }
+        if( !tcp_iov_advance(frag->iov, &frag->first, frag->iovcnt, (size_t)n) ) {
+            peer->current = frag;
+            continue;
+        }
+        peer->current = NULL;
+        tcp_frag_sent(ce, peer, frag);
+        nb++;
+    }
+    tcp_peer_arm(peer, rank, 0);
+    /* a frame queued by another thread while the peer was still armed */
+    parsec_mfence();
+    if( !parsec_list_is_empty(&peer->sendq) ) goto again;
+    return nb;
+}
+
+/* Queue a frame, it is written by the next progress */
+static void
+tcp_peer_post(int rank, tcp_frag_t *frag)
+{
+    tcp_peer_t *peer = &tcp_peers[rank];
+    parsec_list_push_back(&peer->sendq, &frag->super);
+    parsec_mfence();
+    tcp_peer_arm(peer, rank, 1);
+}
+
+/* Send the data of op, eager or announced, to the memory designated by the
+ * handle of the target (or by its operation for the reply of a get) */
+static void
+tcp_op_post(tcp_op_t *op, parsec_ce_tag_t r_tag, uint64_t handle, ptrdiff_t rdispl,
+            void *cb, size_t cb_size)
+{
+    tcp_frag_t *frag;
+
+    if( op->size <= (size_t)tcp_param_eager ) {
+        frag = tcp_frag_new(TCP_FRAME_PUT, cb, cb_size, op->buf, op->size);
+        frag->op = op;
+    } else {
+        frag = tcp_frag_new(TCP_FRAME_RTS, cb, cb_size, NULL, 0);
+        frag->hdr.size = op->size;
+        frag->hdr.op = (uint64_t)(uintptr_t)op;
+    }
+    frag->hdr.tag    = r_tag;
+    frag->hdr.handle = handle;
+    frag->hdr.displ  = (uint64_t)rdispl;
+    frag->hdr.rop    = op->rop;
+    tcp_peer_post(op->peer, frag);
+}
+
+/* The data of a local memory handle, packed if needed */
+static void
+tcp_op_source(tcp_op_t *op, tcp_mem_reg_handle_t *handle, ptrdiff_t displ)
+{
+    op->handle = handle;
+    op->displ  = displ;
+    op->size   = handle->size;
+    if( handle->contiguous ) {
+        op->buf = (char*)handle->mem + displ;
+    } else {
+        int position = 0;
+        op->packed = (char*)malloc(handle->size > 0 ? handle->size : 1);
+        if( PARSEC_SUCCESS != tcp_pack(NULL, (char*)handle->mem + displ, handle->count, handle->datatype,
+                                       op->packed, (int)handle->size, &position) )
+            parsec_fatal("TCP:\tCannot pack %d elements of the datatype %p", handle->count, handle->datatype);
+        op->buf = op->packed;
+    }
+}
+
+static int
+tcp_put(parsec_comm_engine_t *ce,
+        parsec_ce_mem_reg_handle_t lreg,
+        ptrdiff_t ldispl,
+        parsec_ce_mem_reg_handle_t rreg,
+        ptrdiff_t rdispl,
+        size_t size,
+        int remote,
+        parsec_ce_onesided_callback_t l_cb, void *l_cb_data,
+        parsec_ce_tag_t r_tag, void *r_cb_data, size_t r_cb_data_size)
+{
+    tcp_mem_reg_handle_t *rhandle = (tcp_mem_reg_handle_t*)rreg;
+    tcp_op_t *op = (tcp_op_t*)calloc(1, sizeof(tcp_op_t));
+
+    (void)ce; (void)size;
+    op->peer      = remote;
+    op->l_cb      = l_cb;
+    op->l_cb_data = l_cb_data;
+    op->lreg      = lreg;
+    op->ldispl    = ldispl;
+    op->rreg      = rreg;
+    op->rdispl    = rdispl;
+    tcp_op_source(op, (tcp_mem_reg_handle_t*)lreg, ldispl);
+    PARSEC_DEBUG_VERBOSE(20, parsec_comm_output_stream, "TCP:\tPut %zu bytes to %d (%s)",
+                         op->size, remote, (op->size <= (size_t)tcp_param_eager) ? "eager" : "rendezvous");
+    tcp_op_post(op, r_tag, (uint64_t)(uintptr_t)rhandle->self, rdispl, r_cb_data, r_cb_data_size);
+    return 1;
+}
+
+static int
+tcp_get(parsec_comm_engine_t *ce,
+        parsec_ce_mem_reg_handle_t lreg,
+        ptrdiff_t ldispl,
+        parsec_ce_mem_reg_handle_t rreg,
+        ptrdiff_t rdispl,
+        size_t size,
+        int remote,
+        parsec_ce_onesided_callback_t l_cb, void *l_cb_data,
+        parsec_ce_tag_t r_tag, void *r_cb_data, size_t r_cb_data_size)
+{
+    tcp_mem_reg_handle_t *rhandle = (tcp_mem_reg_handle_t*)rreg;
+    tcp_op_t *op = (tcp_op_t*)calloc(1, sizeof(tcp_op_t));
+    tcp_frag_t *frag;
+
+    (void)ce; (void)size;
+    /* the operation receiving the data, designated by the reply of the owner */
+    op->peer      = remote;
+    op->handle    = (tcp_mem_reg_handle_t*)lreg;
+    op->displ     = ldispl;
+    op->l_cb      = l_cb;
+    op->l_cb_data = l_cb_data;
+    op->lreg      = lreg;
+    op->ldispl    = ldispl;
+    op->rreg      = rreg;
+    op->rdispl    = rdispl;
+
+    frag = tcp_frag_new(TCP_FRAME_GET, r_cb_data, r_cb_data_size, NULL, 0);
+    frag->hdr.tag    = r_tag;
+    frag->hdr.handle = (uint64_t)(uintptr_t)rhandle->self;
+    frag->hdr.displ  = (uint64_t)rdispl;
+    frag->hdr.op     = (uint64_t)(uintptr_t)op;
+    tcp_peer_post(remote, frag);
+    return 1;
+}
+
+static int
+tcp_send_active_message(parsec_comm_engine_t *ce,
+                        parsec_ce_tag_t tag,
+                        int remote,
+                        void *addr, size_t size)
+{
+    tcp_frag_t *frag = tcp_frag_new(TCP_FRAME_AM, addr, size, NULL, 0);
+
+    (void)ce;
+    assert(remote != tcp_my_rank);
+    frag->hdr.tag = tag;
+    /* written by the next progress of the communication thread */
+    tcp_peer_post(remote, frag);
+    return 1;
+}
+
+/******************************************************************************
+ * Receiving
+ ******************************************************************************/
+
+static void
+tcp_deliver_am(parsec_comm_engine_t *ce, parsec_ce_tag_t tag, char *msg, size_t size, int src)
+{
+    tcp_tag_t *t;
+
+    if( tag >= PARSEC_MAX_REGISTERED_TAGS )
+        parsec_fatal("TCP:\tActive message with the invalid tag %lu received from %d", (unsigned long)tag, src);
+    t = &tcp_tags[tag];
+    if( NULL == t->callback ) {
+        /* kept until the tag is registered */
+        tcp_pending_am_t *am = (tcp_pending_am_t*)malloc(sizeof(tcp_pending_am_t));
+        PARSEC_OBJ_CONSTRUCT(&am->super, parsec_list_item_t);
+        am->tag = tag; am->src = src; am->size = size; am->msg = msg;
+        parsec_list_nolock_push_back(&tcp_pending_ams, &am->super);
+        return;
+    }
+    assert(size <= t->msg_length);
+    t->callback(ce, tag, msg, size, src, t->cb_data);
+    free(msg);
+}
+
+static int
+tcp_deliver_pending_ams(parsec_comm_engine_t *ce)
+{
+    parsec_list_item_t *item, *next;
+    int nb = 0;
+
+    for( item = PARSEC_LIST_ITERATOR_FIRST(&tcp_pending_ams);
+         item != PARSEC_LIST_ITERATOR_END(&tcp_pending_ams);
+         item = next ) {
+        tcp_pending_am_t *am = (tcp_pending_am_t*)item;
+        next = PARSEC_LIST_ITERATOR_NEXT(item);
+        if( NULL == tcp_tags[am->tag].callback ) continue;
+        parsec_list_nolock_remove(&tcp_pending_ams, item);
+        tcp_deliver_am(ce, am->tag, am->msg, am->size, am->src);
+        PARSEC_OBJ_DESTRUCT(&am->super);
+        free(am);
+        nb++;
+    }
+    return nb;
+}
+
+/* The operation receiving the data of a put, or of the reply of a get, and
+ * where the data goes: in place when the target memory is contiguous */
+static tcp_op_t *
+tcp_recv_op(int src, const tcp_frame_hdr_t *hdr)
+{
+    tcp_op_t *op;
+
+    if( 0 != hdr->handle ) {
+        op = (tcp_op_t*)calloc(1, sizeof(tcp_op_t));
+        op->peer   = src;
+        op->handle = (tcp_mem_reg_handle_t*)(uintptr_t)hdr->handle;
+        op->displ  = (ptrdiff_t)hdr->displ;
+        op->am_cb  = (parsec_ce_am_callback_t)(uintptr_t)hdr->tag;
+    } else {
+        op = (tcp_op_t*)(uintptr_t)hdr->rop;
+    }
+    op->size = hdr->size;
+    if( op->handle->contiguous && (op->size <= op->handle->size) ) {
+        op->buf = (char*)op->handle->mem + op->displ;
+    } else {
+        op->packed = (char*)malloc(op->size > 0 ? op->size : 1);
+        op->buf = op->packed;
+    }
+    return op;
+}
+
+/* The header of a frame is received: where do the rest of it go */
+static void
+tcp_recv_start(tcp_peer_t *peer, int src)
+{
+    tcp_frame_hdr_t *hdr = &peer->rhdr;
+    tcp_op_t *op = NULL;
+    char *data = NULL;
+    size_t size = 0;
+
+    peer->rcb = (hdr->cb_size > 0) ? (char*)malloc(hdr->cb_size) : NULL;
+    if( TCP_FRAME_PUT == hdr->type ) {
+        op = tcp_recv_op(src, hdr);
+        data = op->buf; size = op->size;
+    } else if( TCP_FRAME_DATA == hdr->type ) {
+        op = (tcp_op_t*)(uintptr_t)hdr->rop;
+        data = op->buf + hdr->displ; size = hdr->size;
+    }
+    peer->rop = op;
+    peer->riov[0].iov_base = peer->rcb;
+    peer->riov[0].iov_len  = hdr->cb_size;
+    peer->riov[1].iov_base = data;
+    peer->riov[1].iov_len  = size;
+    peer->rfirst = 0;
+    (void)tcp_iov_advance(peer->riov, &peer->rfirst, 2, 0);
+}
+
+/* The whole frame is received */
+static void
+tcp_recv_complete(parsec_comm_engine_t *ce, tcp_peer_t *peer, int src)
+{
+    tcp_frame_hdr_t *hdr = &peer->rhdr;
+    tcp_op_t *op = peer->rop;
+    tcp_frag_t *frag;
+
+    switch( hdr->type ) {
+    case TCP_FRAME_AM:
+        tcp_deliver_am(ce, hdr->tag, peer->rcb, hdr->cb_size, src);
+        peer->rcb = NULL;
+        break;
+    case TCP_FRAME_PUT:
+        op->msg = peer->rcb; op->msg_size = hdr->cb_size;
+        peer->rcb = NULL;
+        tcp_op_recv_done(ce, op);
+        break;
+    case TCP_FRAME_RTS:
+        op = tcp_recv_op(src, hdr);
+        op->msg = peer->rcb; op->msg_size = hdr->cb_size;
+        peer->rcb = NULL;
+        frag = tcp_frag_new(TCP_FRAME_CTS, NULL, 0, NULL, 0);
+        frag->hdr.op  = hdr->op;
+        frag->hdr.rop = (uint64_t)(uintptr_t)op;
+        tcp_peer_post(src, frag);
+        break;
+    case TCP_FRAME_CTS:
+        op = (tcp_op_t*)(uintptr_t)hdr->op;
+        op->rop = hdr->rop;
+        frag = tcp_frag_new(TCP_FRAME_DATA, NULL, 0, NULL, 0);
+        tcp_frag_data(frag, op);
+        tcp_peer_post(src, frag);
+        break;
+    case TCP_FRAME_DATA:
+        op->done += hdr->size;
+        if( op->done == op->size )
+            tcp_op_recv_done(ce, op);
+        break;
+    case TCP_FRAME_GET: {
+        tcp_mem_reg_handle_t *handle = (tcp_mem_reg_handle_t*)(uintptr_t)hdr->handle;
+        /* put the data back to the operation of the requester, and let the
+         * upper layer know once it is sent */
+        op = (tcp_op_t*)calloc(1, sizeof(tcp_op_t));
+        op->peer       = src;
+        op->rop        = hdr->op;
+        op->am_cb      = (parsec_ce_am_callback_t)(uintptr_t)hdr->tag;
+        op->msg        = peer->rcb;
+        op->msg_size   = hdr->cb_size;
+        op->am_cb_data = handle;
+        peer->rcb = NULL;
+        tcp_op_source(op, handle, (ptrdiff_t)hdr->displ);
+        tcp_op_post(op, 0, 0, 0, NULL, 0);
+        break;
+    }
+    case TCP_FRAME_BARRIER:
+        if( 0 == tcp_my_rank ) tcp_barrier_arrived++;
+        else tcp_barrier_released++;
+        break;
+    default:
+        parsec_fatal("TCP:\tUnknown frame %u received from %d", hdr->type, src);
+    }
+    free(peer->rcb);
+    peer->rcb = NULL;
+    peer->rop = NULL;
+}
+
+static int
+tcp_peer_recv(parsec_comm_engine_t *ce, int rank)
+{
+    tcp_peer_t *peer = &tcp_peers[rank];
+    int nb = 0;
+    ssize_t n;
+
+    while( !peer->closed ) {
+        if( TCP_RECV_HDR == peer->rstate ) {
+            n = read(peer->fd, (char*)&peer->rhdr + peer->rgot, sizeof(tcp_frame_hdr_t) - peer->rgot);
+        } else {
+            n = (peer->rfirst < 2) ? readv(peer->fd, peer->riov + peer->rfirst, 2 - peer->rfirst) : 0;
+        }
+        if( n < 0 ) {
+            if( EINTR == errno ) continue;
+            if( (EAGAIN == errno) || (EWOULDBLOCK == errno) ) break;
+            parsec_fatal("TCP:\tCannot read from rank %d (%s)", rank, strerror(errno));
+        }
+        if( (0 == n) && ((TCP_RECV_HDR == peer->rstate) || (peer->rfirst < 2)) ) {
+            if( (TCP_RECV_HDR != peer->rstate) || (0 != peer->rgot) )
+                parsec_fatal("TCP:\tRank %d closed the connection in the middle of a message", rank);
+            peer->closed = 1;
+            epoll_ctl(tcp_epfd, EPOLL_CTL_DEL, peer->fd, NULL);
+            break;
+        }
+        if( TCP_RECV_HDR == peer->rstate ) {
+            peer->rgot += (size_t)n;
+            if( peer->rgot < sizeof(tcp_frame_hdr_t) ) continue;
+            tcp_recv_start(peer, rank);
+            peer->rstate = TCP_RECV_BODY;
+        } else if( !tcp_iov_advance(peer->riov, &peer->rfirst, 2, (size_t)n) ) {
+            continue;
+        }
+        if( peer->rfirst < 2 ) continue;
+        tcp_recv_complete(ce, peer, rank);
+        peer->rstate = TCP_RECV_HDR;
+        peer->rgot = 0;
+        nb++;
+    }
+    return nb;
+}
+
+static int
+tcp_comm_engine_progress(parsec_comm_engine_t *ce)
+{
+    struct epoll_event events[TCP_MAX_EVENTS];
+    int i, n, nb = 0;
+
+    if( !parsec_list_nolock_is_empty(&tcp_pending_ams) )
+        nb += tcp_deliver_pending_ams(ce);
+    if( -1 == tcp_epfd ) return nb;
+    n = epoll_wait(tcp_epfd, events, TCP_MAX_EVENTS, 0);
+    for( i = 0; i < n; i++ ) {
+        int rank = (int)events[i].data.u32;
+        if( events[i].events & (EPOLLIN | EPOLLHUP | EPOLLERR) )
+            nb += tcp_peer_recv(ce, rank);
+        if( (events[i].events & EPOLLOUT) && !tcp_peers[rank].closed )
+            nb += tcp_peer_send(ce, rank);
+    }
+    return nb;
+}
+
+/******************************************************************************
+ * Management
+ ******************************************************************************/
+
+static int
+tcp_tag_register(parsec_ce_tag_t tag,
+                 parsec_ce_am_callback_t callback,
+                 void *cb_data,
+                 size_t msg_length)
+{
+    if( tag >= PARSEC_MAX_REGISTERED_TAGS ) return PARSEC_ERROR;
+    if( NULL != tcp_tags[tag].callback ) {
+        parsec_warning("Tag: %ld is already registered", (long)tag);
+        return PARSEC_ERROR;
+    }
+    tcp_tags[tag].callback   = callback;
+    tcp_tags[tag].cb_data    = cb_data;
+    tcp_tags[tag].msg_length = msg_length;
+    return PARSEC_SUCCESS;
+}
+
+static int
+tcp_tag_unregister(parsec_ce_tag_t tag)
+{
+    if( tag >= PARSEC_MAX_REGISTERED_TAGS ) return PARSEC_ERROR;
+    tcp_tags[tag].callback = NULL;
+    return PARSEC_SUCCESS;
+}
+
+static int
+tcp_set_ctx(parsec_comm_engine_t *ce, intptr_t ctx)
+{
+    (void)ce; (void)ctx;
+    parsec_warning("TCP:\tThe processes of the TCP communication engine cannot be changed [ignored]");
+    return PARSEC_ERR_NOT_SUPPORTED;
+}
+
+/* Gather on the first process, then release everybody */
+static int
+tcp_sync(parsec_comm_engine_t *ce)
+{
+    int i;
+
+    if( 1 == tcp_nb_peers ) return 0;
+    if( 0 == tcp_my_rank ) {
+        while( tcp_barrier_arrived < tcp_nb_peers - 1 ) tcp_comm_engine_progress(ce);
+        tcp_barrier_arrived -= tcp_nb_peers - 1;
+        for( i = 1; i < tcp_nb_peers; i++ )
+            tcp_peer_post(i, tcp_frag_new(TCP_FRAME_BARRIER, NULL, 0, NULL, 0));
+    } else {
+        tcp_peer_post(0, tcp_frag_new(TCP_FRAME_BARRIER, NULL, 0, NULL, 0));
+        while( 0 == tcp_barrier_released ) tcp_comm_engine_progress(ce);
+        tcp_barrier_released--;
+    }
+    return 0;
+}
+
+static int
+tcp_can_push_more(parsec_comm_engine_t *ce)
+{
+    (void)ce;
+    return 1;
+}
+
+/* The processes given the same host address share the host */
+static int
+tcp_hosts(parsec_comm_engine_t *ce, int *host_of)
+{
+    (void)ce;
+    memcpy(host_of, tcp_host_of, tcp_nb_peers * sizeof(int));
+    return 0;
+}
+
+static int
+tcp_comm_engine_enable(parsec_comm_engine_t *ce)
+{
+    (void)ce;
+    return PARSEC_SUCCESS;
+}
+
+static int
+tcp_comm_engine_disable(parsec_comm_engine_t *ce)
+{
+    (void)ce;
+    return 1;
+}
+
+parsec_comm_engine_t *
+tcp_comm_engine_init(parsec_context_t *context)
+{
+    char **hosts = NULL;
+    int *ports = NULL, rank, size, i, rc;
+
+    parsec_mca_param_reg_int_name("runtime", "comm_tcp_port",
+                                  "Base port of the TCP communication engine, the rank i listens on this port plus i (unless PARSEC_TCP_NODES or PARSEC_TCP_HOSTFILE give the port).",
+                                  false, false, tcp_param_port, &tcp_param_port);
+    parsec_mca_param_reg_int_name("runtime", "comm_tcp_eager",
+                                  "Size in bytes up to which the TCP communication engine sends the data with the announce of a put, instead of waiting for the target to be ready.",
+                                  false, false, tcp_param_eager, &tcp_param_eager);
+    parsec_mca_param_reg_int_name("runtime", "comm_tcp_frag",
+                                  "Size in bytes of the fragments of the large data sent by the TCP communication engine, interleaved with the other messages to the same process (0 to send the data at once).",
+                                  false, false, tcp_param_frag, &tcp_param_frag);
+    parsec_mca_param_reg_int_name("runtime", "comm_tcp_timeout",
+                                  "Time in seconds the TCP communication engine waits for the other processes to connect.",
+                                  false, false, tcp_param_timeout, &tcp_param_timeout);
+
+    if( PARSEC_SUCCESS != tcp_bootstrap(&rank, &size, &hosts, &ports) )
+        return NULL;
+
+    tcp_my_rank  = rank;
+    tcp_nb_peers = size;
+    tcp_peers = (tcp_peer_t*)calloc(size, sizeof(tcp_peer_t));
+    for( i = 0; i < size; i++ ) {
+        tcp_peers[i].fd = -1;
+        PARSEC_OBJ_CONSTRUCT(&tcp_peers[i].sendq, parsec_list_t);
+    }
+    tcp_host_of = (int*)malloc(size * sizeof(int));
+    for( i = 0; i < size; i++ ) {
+        int j = 0;
+        while( (NULL != hosts) && (j < i) && (0 != strcmp(hosts[i], hosts[j])) ) j++;
+        tcp_host_of[i] = j;
+    }
+    PARSEC_OBJ_CONSTRUCT(&tcp_pending_ams, parsec_list_t);
+    memset(tcp_tags, 0, sizeof(tcp_tags));
+    tcp_barrier_arrived = tcp_barrier_released = 0;
+
+    rc = PARSEC_SUCCESS;
+    if( size > 1 ) {
+        tcp_epfd = epoll_create1(0);
+        rc = tcp_wireup(hosts, ports);
+    }
+    for( i = 0; (NULL != hosts) && (i < size); i++ ) free(hosts[i]);
+    free(hosts); free(ports);
+    if( PARSEC_SUCCESS != rc ) {
+        tcp_comm_engine_fini(&parsec_ce);
+        return NULL;
+    }
+
+    parsec_ce.enable              = tcp_comm_engine_enable;
+    parsec_ce.disable             = tcp_comm_engine_disable;
+    parsec_ce.set_ctx             = tcp_set_ctx;
+    parsec_ce.fini                = tcp_comm_engine_fini;
+    parsec_ce.tag_register        = tcp_tag_register;
+    parsec_ce.tag_unregister      = tcp_tag_unregister;
+    parsec_ce.mem_register        = tcp_mem_register;
+    parsec_ce.mem_unregister      = tcp_mem_unregister;
+    parsec_ce.get_mem_handle_size = tcp_get_mem_reg_handle_size;
+    parsec_ce.mem_retrieve        = tcp_mem_retrieve;
+    parsec_ce.put                 = tcp_put;
+    parsec_ce.get                 = tcp_get;
+    parsec_ce.progress            = tcp_comm_engine_progress;
+    parsec_ce.pack                = tcp_pack;
+    parsec_ce.pack_size           = tcp_pack_size;
+    parsec_ce.unpack              = tcp_unpack;
+    parsec_ce.sync                = tcp_sync;
+    parsec_ce.reshape             = tcp_reshape;
+    parsec_ce.can_serve           = tcp_can_push_more;
+    parsec_ce.send_am             = tcp_send_active_message;
+    parsec_ce.hosts               = tcp_hosts;
+
+    parsec_ce.parsec_context      = context;
+    parsec_ce.capabilites.sided   = 2;
+    parsec_ce.capabilites.supports_noncontiguous_datatype = 1;
+    parsec_ce.capabilites.multithreaded = 0;
+
+    context->nb_nodes = size;
+    context->my_rank  = rank;
+    parsec_debug_rank = rank;
+    parsec_debug_verbose(3, parsec_comm_output_stream, "TCP:\tRank %d of %d connected (eager %d bytes, fragments of %d bytes)",
+                         rank, size, tcp_param_eager, tcp_param_frag);
+    return &parsec_ce;
+}
+
+/* Everything queued is written, then each side shuts down its half of the
+ * connections and waits for the peers to do the same. */
+int
+tcp_comm_engine_fini(parsec_comm_engine_t *ce)
+{
+    int i, pending;
+
+    if( NULL != tcp_peers ) {
+        do {
+            pending = 0;
+            for( i = 0; i < tcp_nb_peers; i++ ) {
+                if( -1 == tcp_peers[i].fd ) continue;
+                if( (NULL != tcp_peers[i].current) || !parsec_list_is_empty(&tcp_peers[i].sendq) ) {
+                    pending = 1;
+                    if( !tcp_peers[i].closed ) tcp_peer_send(ce, i);
+                }
+            }
+            if( pending ) tcp_comm_engine_progress(ce);
+        } while( pending );
+        for( i = 0; i < tcp_nb_peers; i++ )
+            if( -1 != tcp_peers[i].fd ) shutdown(tcp_peers[i].fd, SHUT_WR);
+        do {
+            pending = 0;
+            for( i = 0; i < tcp_nb_peers; i++ )
+                if( (-1 != tcp_peers[i].fd) && !tcp_peers[i].closed ) pending = 1;
+            if( pending ) tcp_comm_engine_progress(ce);
+        } while( pending );
+        for( i = 0; i < tcp_nb_peers; i++ ) {
+            if( -1 != tcp_peers[i].fd ) close(tcp_peers[i].fd);
+            PARSEC_OBJ_DESTRUCT(&tcp_peers[i].sendq);
+        }
+        free(tcp_peers); tcp_peers = NULL;
+    }
+    while( !parsec_list_nolock_is_empty(&tcp_pending_ams) ) {
+        tcp_pending_am_t *am = (tcp_pending_am_t*)parsec_list_nolock_pop_front(&tcp_pending_ams);
+        free(am->msg);
+        PARSEC_OBJ_DESTRUCT(&am->super);
+        free(am);
+    }
+    PARSEC_OBJ_DESTRUCT(&tcp_pending_ams);
+    free(tcp_host_of); tcp_host_of = NULL;
+    if( -1 != tcp_epfd ) {
+        close(tcp_epfd);
+        tcp_epfd = -1;
+    }
+    tcp_nb_peers = 0;
+    return PARSEC_SUCCESS;
+}
@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) 2026      The University of Tennessee and The University
+ *                         of Tennessee Research Foundation.  All rights
+ *                         reserved.
+ */
+#ifndef __USE_PARSEC_TCP_H__
+#define __USE_PARSEC_TCP_H__
+
+#include "parsec/parsec_comm_engine.h"
+
+/* ------- TCP socket implementation below ------- */
+
+/**
+ * The processes are not started by an MPI launcher: each of them finds its
+ * rank and the address of its peers in the environment.
+ *  - PARSEC_TCP_RANK: the rank of this process.
+ *  - PARSEC_TCP_NODES: comma separated list of host[:port], one per rank, or
+ *  - PARSEC_TCP_HOSTFILE: a file with one host[:port] per line (the lines
+ *    starting with # are ignored), or
+ *  - PARSEC_TCP_SIZE: the number of processes, all of them on the loopback.
+ *  - PARSEC_TCP_KEY: optional secret shared by the processes of the job; they
+ *    reject the connections that do not present it (by default, the key is
+ *    derived from the list of addresses).
+ * When the port is not given, the rank i listens on runtime_comm_tcp_port + i.
+ * Each process only listens on its own address. The messages carry raw
+ * addresses of the sender, and the key is sent in clear: the engine must
+ * only be used on a trusted network.
+ */
+parsec_comm_engine_t * tcp_comm_engine_init(parsec_context_t *parsec_context);
+int tcp_comm_engine_fini(parsec_comm_engine_t *comm_engine);
+
+#endif /* __USE_PARSEC_TCP_H__ */
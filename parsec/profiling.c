@@ -982,16 +982,17 @@ parsec_profiling_trace_flags(parsec_profiling_stream_t* context, int key,
     return parsec_profiling_trace_flags_info_fn(context, key, event_id, taskpool_id, memcpy, info, flags);
 }
 
-int
-parsec_profiling_trace_flags_info_fn(parsec_profiling_stream_t* context, int key,
-                                     uint64_t event_id, uint32_t taskpool_id,
-                                     parsec_profiling_info_fn_t *info_fn, const void *info_data, uint16_t flags)
+static int
+parsec_profiling_trace_event(parsec_profiling_stream_t* context, int key,
+                             uint64_t event_id, uint32_t taskpool_id,
+                             parsec_profiling_info_fn_t *info_fn, const void *info_data, uint16_t flags,
+                             const uint64_t *timestamp)
 {
     parsec_profiling_output_t *this_event;
     size_t this_event_length;
     parsec_time_t now;
 
-    if(flags & PARSEC_PROFILING_EVENT_TIME_AT_START) {
+    if( (NULL == timestamp) && (flags & PARSEC_PROFILING_EVENT_TIME_AT_START) ) {
         now = take_time();
     }
 
@@ -1034,6 +1035,11 @@ parsec_profiling_trace_flags_info_fn(parsec_profiling_stream_t* context, int key
         this_event->event.flags = PARSEC_PROFILING_EVENT_HAS_INFO;
     }
     this_event->event.flags |= flags;
+    if( NULL != timestamp ) {
+        /* the caller provides the date of the event */
+        this_event->event.timestamp = *timestamp;
+        return 0;
+    }
     if(flags ^ PARSEC_PROFILING_EVENT_TIME_AT_START) {
         /* default behavior is to take time at end */
         now = take_time();
@@ -1043,6 +1049,22 @@ parsec_profiling_trace_flags_info_fn(parsec_profiling_stream_t* context, int key
     return 0;
 }
 
+int
+parsec_profiling_trace_flags_info_fn(parsec_profiling_stream_t* context, int key,
+                                     uint64_t event_id, uint32_t taskpool_id,
+                                     parsec_profiling_info_fn_t *info_fn, const void *info_data, uint16_t flags)
+{
+    return parsec_profiling_trace_event(context, key, event_id, taskpool_id, info_fn, info_data, flags, NULL);
+}
+
+int
+parsec_profiling_trace_flags_at(parsec_profiling_stream_t* context, int key,
+                                uint64_t event_id, uint32_t taskpool_id,
+                                const void *info, uint16_t flags, uint64_t timestamp)
+{
+    return parsec_profiling_trace_event(context, key, event_id, taskpool_id, memcpy, info, flags, &timestamp);
+}
+
 static int64_t dump_global_infos(int *nbinfos)
 {
     parsec_profiling_buffer_t *b, *n;
@@ -361,6 +361,29 @@ int parsec_profiling_trace_flags_info_fn(parsec_profiling_stream_t* context, int
                                          uint64_t event_id, uint32_t taskpool_id,
                                          parsec_profiling_info_fn_t *info_fn, const void *info_data, uint16_t flags );
 
+/**
+ * @brief Trace one event at a given date
+ *
+ * @details Similar to parsec_profiling_trace_flags, except that the timestamp
+ * of the event is not read from the clock but provided by the caller. This is
+ * used by tools that reconstruct a timeline after the fact (e.g. the
+ * simulation engine), and the timestamp is expressed in the same unit and
+ * relative to the same origin as parsec_profiling_get_time.
+ *
+ * @param[in] context a thread profiling context
+ * @param[in] key     the key (as returned by add_dictionary_keyword) of the event to log
+ * @param[in] event_id a (possibly unique) event identifier
+ * @param[in] taskpool_id unique object/handle identifier (use PROFILE_OBJECT_ID_NULL if N/A)
+ * @param[in] info    a pointer to an area of size info_length for this key
+ * @param[in] flags   flags related to the event
+ * @param[in] timestamp the date of the event
+ * @return 0 if success, negative otherwise.
+ * @remark not thread safe (if two threads share a same thread_context. Safe per thread_context)
+ */
+int parsec_profiling_trace_flags_at(parsec_profiling_stream_t* context, int key,
+                                    uint64_t event_id, uint32_t taskpool_id,
+                                    const void *info, uint16_t flags, uint64_t timestamp);
+
 /**
  * @brief Convenience macro used to trace events without flags
  */
@@ -715,10 +715,11 @@ parsec_profiling_trace_flags(parsec_profiling_stream_t* context, int key,
     return parsec_profiling_trace_flags_info_fn(context, key, event_id, taskpool_id, memcpy, info, flags);
 }
 
-int
-parsec_profiling_trace_flags_info_fn(parsec_profiling_stream_t* context, int key,
-                                     uint64_t event_id, uint32_t taskpool_id,
-                                     parsec_profiling_info_fn_t *info_fn, const void *info_data, uint16_t flags)
+static int
+parsec_profiling_trace_event(parsec_profiling_stream_t* context, int key,
+                             uint64_t event_id, uint32_t taskpool_id,
+                             parsec_profiling_info_fn_t *info_fn, const void *info_data, uint16_t flags,
+                             const uint64_t *at_date)
 {
     parsec_time_t now;
     int region;
@@ -743,8 +744,12 @@ parsec_profiling_trace_flags_info_fn(parsec_profiling_stream_t* context, int key
         return PARSEC_ERR_BAD_PARAM;
     }
 
-    now = take_time();
-    timestamp = diff_time(parsec_start_time, now);
+    if( NULL != at_date ) {
+        timestamp = *at_date;
+    } else {
+        now = take_time();
+        timestamp = diff_time(parsec_start_time, now);
+    }
 
     region = key < 0 ? -key : key;
 
@@ -833,6 +838,22 @@ parsec_profiling_trace_flags_info_fn(parsec_profiling_stream_t* context, int key
     return 0;
 }
 
+int
+parsec_profiling_trace_flags_info_fn(parsec_profiling_stream_t* context, int key,
+                                     uint64_t event_id, uint32_t taskpool_id,
+                                     parsec_profiling_info_fn_t *info_fn, const void *info_data, uint16_t flags)
+{
+    return parsec_profiling_trace_event(context, key, event_id, taskpool_id, info_fn, info_data, flags, NULL);
+}
+
+int
+parsec_profiling_trace_flags_at(parsec_profiling_stream_t* context, int key,
+                                uint64_t event_id, uint32_t taskpool_id,
+                                const void *info, uint16_t flags, uint64_t timestamp)
+{
+    return parsec_profiling_trace_event(context, key, event_id, taskpool_id, memcpy, info, flags, &timestamp);
+}
+
 int parsec_profiling_dbp_dump( void )
 {
     uint64_t epoch, gepoch;
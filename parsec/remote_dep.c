@@ -26,6 +26,7 @@
 int parsec_communication_engine_up = -1;
 int parsec_comm_output_stream = 0;
 int parsec_comm_verbose = 0;
+int parsec_comm_stats = 0;
 
 #ifdef DISTRIBUTED
 
@@ -55,8 +56,8 @@ remote_dep_reset_forwarded(parsec_execution_stream_t* es,
                            parsec_remote_deps_t* rdeps)
 {
     PARSEC_DEBUG_VERBOSE(20, parsec_comm_output_stream, "fw reset\tcontext %p deps %p", (void*)es, rdeps);
-    memset(rdeps->remote_dep_fw_mask, 0,
-           es->virtual_process->parsec_context->remote_dep_fw_mask_sizeof);
+    (void)es;
+    remote_dep_rank_set_clear(&rdeps->forwarded);
 }
 
 /* Mark a rank as already forwarded the termination of the current task */
@@ -65,13 +66,9 @@ remote_dep_mark_forwarded(parsec_execution_stream_t* es,
                           parsec_remote_deps_t* rdeps,
                           int rank)
 {
-    uint32_t boffset, bit;
-
     PARSEC_DEBUG_VERBOSE(20, parsec_comm_output_stream, "fw mark\tREMOTE rank %d", rank);
-    remote_dep_rank_to_bit(rank, &boffset, &bit, rdeps->root);
-    assert(boffset <= es->virtual_process->parsec_context->remote_dep_fw_mask_sizeof);
     (void)es;
-    rdeps->remote_dep_fw_mask[boffset] |= ((uint32_t)1) << bit;
+    (void)remote_dep_rank_set_add(&rdeps->forwarded, remote_dep_rank_to_pos(rank, rdeps->root));
 }
 
 /* Check if rank has already been forwarded the termination of the current task */
@@ -80,14 +77,11 @@ remote_dep_is_forwarded(parsec_execution_stream_t* es,
                         parsec_remote_deps_t* rdeps,
                         int rank)
 {
-    uint32_t boffset, bit, mask;
+    int forwarded = remote_dep_rank_set_contains(&rdeps->forwarded, remote_dep_rank_to_pos(rank, rdeps->root));
 
-    remote_dep_rank_to_bit(rank, &boffset, &bit, rdeps->root);
-    mask = ((uint32_t)1) << bit;
-    assert(boffset <= es->virtual_process->parsec_context->remote_dep_fw_mask_sizeof);
-    PARSEC_DEBUG_VERBOSE(20, parsec_comm_output_stream, "fw test\tREMOTE rank %d (value=%x)", rank, (int) (rdeps->remote_dep_fw_mask[boffset] & mask));
+    PARSEC_DEBUG_VERBOSE(20, parsec_comm_output_stream, "fw test\tREMOTE rank %d (value=%d)", rank, forwarded);
     (void)es;
-    return (int) ((rdeps->remote_dep_fw_mask[boffset] & mask) != 0);
+    return forwarded;
 }
 
 #if 0
@@ -126,13 +120,16 @@ remote_dep_complete_and_cleanup(parsec_remote_deps_t** deps,
          */
         for( int i = 0; (*deps)->outgoing_mask >> i; i++ )
             if( (1U << i) & (*deps)->outgoing_mask ) {
-                assert( (*deps)->output[i].count_bits );
+                assert( (*deps)->output[i].ranks.count );
                 if( NULL != (*deps)->output[i].data.data ) { /* if not CONTROL */
-                    if( PARSEC_TASKPOOL_TYPE_DTD == (*deps)->taskpool->taskpool_type ) {
-                        (void)parsec_atomic_fetch_dec_int32(&(*deps)->output[i].data.data->readers);
-                    }
+                    (void)parsec_atomic_fetch_dec_int32(&(*deps)->output[i].data.data->readers);
                     PARSEC_DATA_COPY_RELEASE((*deps)->output[i].data.data);
                 }
+                if( NULL != (*deps)->output[i].compressed ) {
+                    free((*deps)->output[i].compressed);
+                    (*deps)->output[i].compressed = NULL;
+                    (*deps)->output[i].compressed_size = 0;
+                }
             }
         (*deps)->outgoing_mask = 0;
         if(ncompleted)
@@ -147,32 +144,25 @@ remote_dep_complete_and_cleanup(parsec_remote_deps_t** deps,
 parsec_remote_deps_t* remote_deps_allocate( parsec_lifo_t* lifo )
 {
     parsec_remote_deps_t* remote_deps = (parsec_remote_deps_t*)parsec_lifo_pop(lifo);
-    uint32_t i, rank_bit_size;
+    uint32_t i;
 
     if( NULL == remote_deps ) {
-        char *ptr;
         remote_deps = (parsec_remote_deps_t*)parsec_lifo_item_alloc( lifo, parsec_remote_dep_context.elem_size );
         PARSEC_VALGRIND_MEMPOOL_ALLOC(lifo,
                                       ((unsigned char *)remote_deps)+sizeof(parsec_list_item_t),
                                       parsec_remote_dep_context.elem_size - sizeof(parsec_list_item_t));
         remote_deps->origin = lifo;
         remote_deps->taskpool = NULL;
-        ptr = (char*)(&(remote_deps->output[parsec_remote_dep_context.max_dep_count]));
-        rank_bit_size = sizeof(uint32_t) * ((parsec_remote_dep_context.max_nodes_number + 31) / 32);
-        memset(ptr, 0, rank_bit_size * parsec_remote_dep_context.max_dep_count);
         for( i = 0; i < parsec_remote_dep_context.max_dep_count; i++ ) {
             PARSEC_OBJ_CONSTRUCT(&remote_deps->output[i].super, parsec_list_item_t);
             remote_deps->output[i].parent     = remote_deps;
-            remote_deps->output[i].rank_bits  = (uint32_t*)ptr;
             remote_deps->output[i].deps_mask  = 0;
-            remote_deps->output[i].count_bits = 0;
             remote_deps->output[i].priority   = 0xffffffff;
-            ptr += rank_bit_size;
+            remote_deps->output[i].compressed = NULL;
+            remote_deps->output[i].compressed_size = 0;
+            remote_dep_rank_set_init(&remote_deps->output[i].ranks);
         }
-        /* fw_mask immediately follows outputs */
-        remote_deps->remote_dep_fw_mask = (uint32_t*) ptr;
-        assert( (int)(ptr - (char*)remote_deps) ==
-                (int)(parsec_remote_dep_context.elem_size - rank_bit_size));
+        remote_dep_rank_set_init(&remote_deps->forwarded);
     } else {
         PARSEC_VALGRIND_MEMPOOL_ALLOC(lifo,
                                       ((unsigned char *)remote_deps)+sizeof(parsec_list_item_t),
@@ -190,15 +180,13 @@ parsec_remote_deps_t* remote_deps_allocate( parsec_lifo_t* lifo )
 
 inline void remote_deps_free(parsec_remote_deps_t* deps)
 {
-    uint32_t k, a;
+    uint32_t k;
     assert(0 == deps->pending_ack);
     assert(0 == deps->incoming_mask);
     assert(0 == deps->outgoing_mask);
     for( k = 0; k < parsec_remote_dep_context.max_dep_count; k++ ) {
-        if( 0 == deps->output[k].count_bits ) continue;
-        for(a = 0; a < (parsec_remote_dep_context.max_nodes_number + 31)/32; a++)
-            deps->output[k].rank_bits[a] = 0;
-        deps->output[k].count_bits = 0;
+        if( 0 == deps->output[k].ranks.count ) continue;
+        remote_dep_rank_set_clear(&deps->output[k].ranks);
 #if defined(PARSEC_DEBUG_PARANOID)
         deps->output[k].data.data   = NULL;
         deps->output[k].data.local.arena  = NULL;
@@ -240,6 +228,14 @@ int parsec_remote_dep_init(parsec_context_t* context)
             "  0: the communication thread access is serialized.\n"
             "  1: the communication thread access is multiple (if the underlying transports allows (e.g., MPI_THREAD_MULTIPLE).",
                                   false, false, parsec_param_comm_thread_multiple, &parsec_param_comm_thread_multiple);
+    parsec_mca_param_reg_int_name("runtime", "comm_rank_set_sparse", "The number of processes participating in the propagation of a data up to which\n"
+                                  "the participants are kept in a sorted array instead of a bitmap of all processes (at most 16,\n"
+                                  "0 always uses the bitmap). Runs of up to 512 processes always use a bitmap.",
+                                  false, false, parsec_remote_dep_rank_set_sparse, &parsec_remote_dep_rank_set_sparse);
+    if( (parsec_remote_dep_rank_set_sparse < 0) || (parsec_remote_dep_rank_set_sparse > PARSEC_REMOTE_DEP_RANK_SET_INLINE) ) {
+        parsec_warning("Invalid runtime_comm_rank_set_sparse %d; using %d.", parsec_remote_dep_rank_set_sparse, PARSEC_REMOTE_DEP_RANK_SET_INLINE);
+        parsec_remote_dep_rank_set_sparse = PARSEC_REMOTE_DEP_RANK_SET_INLINE;
+    }
     parsec_mca_param_reg_int_name("comm", "verbose",
                                   "Set the output level for the communication engine messages"
                                   ", 0: Errors only"
@@ -284,8 +280,6 @@ int parsec_remote_dep_init(parsec_context_t* context)
 
     (void)remote_dep_dequeue_init(context);
 
-    context->remote_dep_fw_mask_sizeof = 0;
-
     return PARSEC_SUCCESS;
 }
 
@@ -299,8 +293,7 @@ int parsec_remote_dep_init(parsec_context_t* context)
  */
 int parsec_remote_dep_reconfigure(parsec_context_t* context)
 {
-    if(context->nb_nodes > 1)
-        context->remote_dep_fw_mask_sizeof = ((context->nb_nodes + 31) / 32) * sizeof(uint32_t);
+    (void)context;
     return PARSEC_SUCCESS;
 }
 
@@ -313,8 +306,11 @@ int parsec_remote_dep_fini(parsec_context_t* context)
 
 int parsec_remote_dep_set_ctx( parsec_context_t* context, intptr_t opaque_comm_ctx )
 {
-    (void)context;
-    return parsec_ce.set_ctx(&parsec_ce, opaque_comm_ctx);
+    int rc = parsec_ce.set_ctx(&parsec_ce, opaque_comm_ctx);
+    /* the ranks changed, and set_ctx is collective on the new communicator */
+    if( PARSEC_SUCCESS == rc )
+        rc = remote_dep_hosts_discover(context);
+    return rc;
 }
 
 static int remote_dep_bcast_star_child(int me, int him)
@@ -375,20 +371,15 @@ parsec_gather_collective_pattern(parsec_execution_stream_t *es,
                                  data_repo_t *successor_repo, parsec_key_t successor_repo_key,
                                  void *param)
 {
-    uint32_t _array_pos, _array_bit, _array_mask;
     (void)successor_repo; (void) successor_repo_key;
     parsec_remote_deps_t* deps = (parsec_remote_deps_t*)param;
     struct remote_dep_output_param_s* output = &deps->output[dep->dep_datatype_index];
-    remote_dep_rank_to_bit(dst_rank, &_array_pos, &_array_bit, src_rank);
-    _array_mask = 1 << _array_bit;
 
     if( dst_rank == es->virtual_process->parsec_context->my_rank )
         deps->outgoing_mask |= (1 << dep->dep_datatype_index);
 
-    if( !(output->rank_bits[_array_pos] & _array_mask) ) {  /* new participant */
-        output->rank_bits[_array_pos] |= _array_mask;
+    if( remote_dep_rank_set_add(&output->ranks, remote_dep_rank_to_pos(dst_rank, src_rank)) ) {  /* new participant */
         output->deps_mask |= (1 << dep->dep_index);
-        output->count_bits++;
     }
     if(newcontext->priority > output->priority) {  /* select the priority */
         output->priority = newcontext->priority;
@@ -444,8 +435,8 @@ int parsec_remote_dep_activate(parsec_execution_stream_t* es,
                                uint32_t propagation_mask)
 {
     const parsec_task_class_t* tc = task->task_class;
-    int i, my_idx, idx, current_mask, keeper = 0;
-    unsigned int array_index, count, bit_index;
+    int i, my_idx, idx, pos, keeper = 0;
+    uint32_t cursor;
     struct remote_dep_output_param_s* output;
 
     assert(es->virtual_process->parsec_context->nb_nodes > 1);
@@ -474,10 +465,16 @@ int parsec_remote_dep_activate(parsec_execution_stream_t* es,
     remote_dep_mark_forwarded(es, remote_deps, remote_deps->root);
     assert((propagation_mask & remote_deps->outgoing_mask) == remote_deps->outgoing_mask);
 
+    /* The payloads must be compressed before the first activation is packed */
+    for( i = 0; remote_deps->outgoing_mask >> i; i++ ) {
+        if( (remote_deps->outgoing_mask & (1U<<i)) && (NULL != remote_deps->output[i].data.data) )
+            remote_dep_compress_output(&remote_deps->output[i]);
+    }
+
     for( i = 0; propagation_mask >> i; i++ ) {
         if( !((1U << i) & propagation_mask )) continue;
         output = &remote_deps->output[i];
-        assert( 0 != output->count_bits );
+        assert( 0 != output->ranks.count );
 
         my_idx = (remote_deps->root == es->virtual_process->parsec_context->my_rank) ? 0 : -1;
         idx = 0;
@@ -493,85 +490,79 @@ int parsec_remote_dep_activate(parsec_execution_stream_t* es,
              * assert(NULL != output->data.remote.arena);*/
             assert( !parsec_is_CTL_dep(&output->data) );
             PARSEC_OBJ_RETAIN(output->data.data);
+            if( PARSEC_TASKPOOL_TYPE_DTD != remote_deps->taskpool->taskpool_type ) {
+                /* DTD already accounts for the pending sends in its readers */
+                (void)parsec_atomic_fetch_inc_int32(&output->data.data->readers);
+            }
         }
 
-        for( array_index = count = 0; count < remote_deps->output[i].count_bits; array_index++ ) {
-            current_mask = output->rank_bits[array_index];
-            if( 0 == current_mask ) continue;  /* no bits here */
-            for( bit_index = 0; current_mask != 0; bit_index++ ) {
-                if( !(current_mask & (1 << bit_index)) ) continue;
-
-                int rank;
-                remote_dep_bit_to_rank(&rank, array_index, bit_index, remote_deps->root);
-                assert((rank >= 0) && (rank < es->virtual_process->parsec_context->nb_nodes));
+        for( cursor = 0; -1 != (pos = remote_dep_rank_set_next(&output->ranks, &cursor)); ) {
+            int rank = remote_dep_pos_to_rank((uint32_t)pos, remote_deps->root);
+            assert((rank >= 0) && (rank < es->virtual_process->parsec_context->nb_nodes));
 
-                current_mask ^= (1 << bit_index);
-                count++;
-
-                if(remote_dep_is_forwarded(es, remote_deps, rank)) {  /* already in the counting */
-                    PARSEC_DEBUG_VERBOSE(20, parsec_comm_output_stream, "[%d:%d] task %s my_idx %d idx %d rank %d -- skip (already done)",
-                            remote_deps->root, i, tmp, my_idx, idx, rank);
-                    continue;
-                }
-                idx++;
-                if(my_idx == -1) {
-                    PARSEC_DEBUG_VERBOSE(20, parsec_comm_output_stream, "[%d:%d] task %s my_idx %d idx %d rank %d -- skip",
-                            remote_deps->root, i, tmp, my_idx, idx, rank);
-                    if(rank == es->virtual_process->parsec_context->my_rank) {
-                        my_idx = idx;
-                    }
-                    remote_dep_mark_forwarded(es, remote_deps, rank);
-                    continue;
+            if(remote_dep_is_forwarded(es, remote_deps, rank)) {  /* already in the counting */
+                PARSEC_DEBUG_VERBOSE(20, parsec_comm_output_stream, "[%d:%d] task %s my_idx %d idx %d rank %d -- skip (already done)",
+                        remote_deps->root, i, tmp, my_idx, idx, rank);
+                continue;
+            }
+            idx++;
+            if(my_idx == -1) {
+                PARSEC_DEBUG_VERBOSE(20, parsec_comm_output_stream, "[%d:%d] task %s my_idx %d idx %d rank %d -- skip",
+                        remote_deps->root, i, tmp, my_idx, idx, rank);
+                if(rank == es->virtual_process->parsec_context->my_rank) {
+                    my_idx = idx;
                 }
-                PARSEC_DEBUG_VERBOSE(20, parsec_comm_output_stream, " TOPO\t%s\troot=%d\t%d (d%d) -? %d (dna)",
-                        tmp, remote_deps->root, es->virtual_process->parsec_context->my_rank, my_idx, rank);
-
-                int remote_dep_bcast_child_permits = 0;
-                /* Right now DTD only supports a star broadcast topology */
-                if( PARSEC_TASKPOOL_TYPE_DTD == task->taskpool->taskpool_type ) {
-                    remote_dep_bcast_child_permits = remote_dep_bcast_star_child(my_idx, idx);
-                } else {
+                remote_dep_mark_forwarded(es, remote_deps, rank);
+                continue;
+            }
+            PARSEC_DEBUG_VERBOSE(20, parsec_comm_output_stream, " TOPO\t%s\troot=%d\t%d (d%d) -? %d (dna)",
+                    tmp, remote_deps->root, es->virtual_process->parsec_context->my_rank, my_idx, rank);
+
+            int remote_dep_bcast_child_permits = 0;
+            /* Right now DTD only supports a star broadcast topology */
+            if( PARSEC_TASKPOOL_TYPE_DTD == task->taskpool->taskpool_type ) {
+                remote_dep_bcast_child_permits = remote_dep_bcast_star_child(my_idx, idx);
+            } else {
 #ifdef PARSEC_DIST_COLLECTIVES
-                    remote_dep_bcast_child_permits = remote_dep_bcast_child(my_idx, idx);
+                remote_dep_bcast_child_permits = remote_dep_bcast_child(my_idx, idx);
 #else
-                    remote_dep_bcast_child_permits = remote_dep_bcast_star_child(my_idx, idx);
+                remote_dep_bcast_child_permits = remote_dep_bcast_star_child(my_idx, idx);
 #endif  /* PARSEC_DIST_COLLECTIVES */
-                }
+            }
 
-                if(remote_dep_bcast_child_permits) {
-                    PARSEC_DEBUG_VERBOSE(20, parsec_comm_output_stream, "[%d:%d] task %s my_idx %d idx %d rank %d -- send (%x)",
-                            remote_deps->root, i, tmp, my_idx, idx, rank, remote_deps->outgoing_mask);
-                    assert(remote_deps->outgoing_mask & (1U<<i));
+            if(remote_dep_bcast_child_permits) {
+                PARSEC_DEBUG_VERBOSE(20, parsec_comm_output_stream, "[%d:%d] task %s my_idx %d idx %d rank %d -- send (%x)",
+                        remote_deps->root, i, tmp, my_idx, idx, rank, remote_deps->outgoing_mask);
+                assert(remote_deps->outgoing_mask & (1U<<i));
 #if defined(PARSEC_DEBUG_NOISIER)
-                    for(int flow_index = 0; NULL != task->task_class->out[flow_index]; flow_index++) {
-                        if( task->task_class->out[flow_index]->flow_datatype_mask & (1<<i) ) {
-                            assert( NULL != task->task_class->out[flow_index] );
-                            PARSEC_DEBUG_VERBOSE(10, parsec_comm_output_stream, " TOPO\t%s flow %s root=%d\t%d (d%d) -> %d (d%d)",
-                                    tmp, task->task_class->out[flow_index]->name, remote_deps->root,
-                                    es->virtual_process->parsec_context->my_rank, my_idx, rank, idx);
-                            break;
-                        }
+                for(int flow_index = 0; NULL != task->task_class->out[flow_index]; flow_index++) {
+                    if( task->task_class->out[flow_index]->flow_datatype_mask & (1<<i) ) {
+                        assert( NULL != task->task_class->out[flow_index] );
+                        PARSEC_DEBUG_VERBOSE(10, parsec_comm_output_stream, " TOPO\t%s flow %s root=%d\t%d (d%d) -> %d (d%d)",
+                                tmp, task->task_class->out[flow_index]->name, remote_deps->root,
+                                es->virtual_process->parsec_context->my_rank, my_idx, rank, idx);
+                        break;
                     }
+                }
 #endif  /* PARSEC_DEBUG_NOISIER */
-                    assert(output->parent->taskpool == task->taskpool);
-                    if( 0 == parsec_atomic_fetch_inc_int32(&remote_deps->pending_ack) ) {
-                        keeper = 1;
-                        /* Let the engine know we're working to activate the dependencies remotely */
-                        remote_dep_inc_flying_messages(task->taskpool);
-                        /* We need to increase the pending_ack to make the deps persistent until the
-                         * end of this function.
-                         */
-                        (void)parsec_atomic_fetch_inc_int32(&remote_deps->pending_ack);
-                    }
-                    if( task->taskpool->tdm.module->outgoing_message_start(task->taskpool, rank, remote_deps) )
-                        remote_dep_dequeue_send(es, rank, remote_deps);
-                } else {
-                    PARSEC_DEBUG_VERBOSE(20, parsec_comm_output_stream, "[%d:%d] task %s my_idx %d idx %d rank %d -- skip (not my direct descendant)",
-                            remote_deps->root, i, tmp, my_idx, idx, rank);
+                assert(output->parent->taskpool == task->taskpool);
+                if( 0 == parsec_atomic_fetch_inc_int32(&remote_deps->pending_ack) ) {
+                    keeper = 1;
+                    /* Let the engine know we're working to activate the dependencies remotely */
+                    remote_dep_inc_flying_messages(task->taskpool);
+                    /* We need to increase the pending_ack to make the deps persistent until the
+                     * end of this function.
+                     */
+                    (void)parsec_atomic_fetch_inc_int32(&remote_deps->pending_ack);
                 }
-                assert(!remote_dep_is_forwarded(es, remote_deps, rank));
-                remote_dep_mark_forwarded(es, remote_deps, rank);
+                if( task->taskpool->tdm.module->outgoing_message_start(task->taskpool, rank, remote_deps) )
+                    remote_dep_dequeue_send(es, rank, remote_deps);
+            } else {
+                PARSEC_DEBUG_VERBOSE(20, parsec_comm_output_stream, "[%d:%d] task %s my_idx %d idx %d rank %d -- skip (not my direct descendant)",
+                        remote_deps->root, i, tmp, my_idx, idx, rank);
             }
+            assert(!remote_dep_is_forwarded(es, remote_deps, rank));
+            remote_dep_mark_forwarded(es, remote_deps, rank);
         }
     }
     remote_dep_complete_and_cleanup(&remote_deps, (keeper ? 1 : 0));
@@ -580,6 +571,38 @@ int parsec_remote_dep_activate(parsec_execution_stream_t* es,
 
 parsec_remote_dep_context_t parsec_remote_dep_context;
 int parsec_remote_dep_inited = 0;
+int parsec_remote_dep_rank_set_sparse = PARSEC_REMOTE_DEP_RANK_SET_INLINE;
+
+void remote_dep_rank_set_init(remote_dep_rank_set_t *set)
+{
+    set->count = 0;
+    set->heap  = NULL;
+    memset(set->local, 0, sizeof(set->local));
+    /* on small runs the inline storage is large enough for the bitmap */
+    set->dense = (parsec_remote_dep_context.max_nodes_number <= 32 * PARSEC_REMOTE_DEP_RANK_SET_INLINE);
+    set->bits  = set->dense ? set->local : NULL;
+}
+
+/* Move the members of the sorted array to the heap bitmap */
+void remote_dep_rank_set_densify(remote_dep_rank_set_t *set)
+{
+    uint32_t i;
+
+    assert(!set->dense);
+    if( NULL == set->heap ) {
+        set->heap = (uint32_t*)calloc((parsec_remote_dep_context.max_nodes_number + 31) / 32, sizeof(uint32_t));
+    }
+    for( i = 0; i < set->count; i++ )
+        set->heap[set->local[i] / 32] |= 1U << (set->local[i] % 32);
+    set->bits  = set->heap;
+    set->dense = 1;
+}
+
+void remote_dep_rank_set_release(remote_dep_rank_set_t *set)
+{
+    free(set->heap);
+    set->heap = NULL;
+}
 
 /* THIS FUNCTION MUST NOT BE CALLED WHILE REMOTE DEP IS ON.
  * NOT THREAD SAFE (AND SHOULD NOT BE) */
@@ -594,18 +617,13 @@ void remote_deps_allocation_init(int np, int max_output_deps)
 
     if( 0 == parsec_remote_dep_inited ) {
         /* compute the maximum size of the dependencies array */
-        int rankbits_size = sizeof(uint32_t) * ((np + 31)/32);
         parsec_remote_deps_t fake_rdep;
 
         parsec_remote_dep_context.max_dep_count = max_output_deps;
         parsec_remote_dep_context.max_nodes_number = np;
         parsec_remote_dep_context.elem_size =
             /* sizeof(parsec_remote_deps_t+outputs+padding) */
-            ((intptr_t)&fake_rdep.output[parsec_remote_dep_context.max_dep_count])-(intptr_t)&fake_rdep +
-            /* One rankbits fw array per output param */
-            parsec_remote_dep_context.max_dep_count * rankbits_size +
-            /* One extra rankbit to track the delivery of Activates */
-            rankbits_size;
+            ((intptr_t)&fake_rdep.output[parsec_remote_dep_context.max_dep_count])-(intptr_t)&fake_rdep;
         PARSEC_OBJ_CONSTRUCT(&parsec_remote_dep_context.freelist, parsec_lifo_t);
         PARSEC_VALGRIND_CREATE_MEMPOOL(&parsec_remote_dep_context.freelist, 0, 1);
         parsec_remote_dep_inited = 1;
@@ -621,6 +639,9 @@ void remote_deps_allocation_fini(void)
     if(1 == parsec_remote_dep_inited) {
         parsec_remote_deps_t* rdeps;
         while(NULL != (rdeps = (parsec_remote_deps_t*) parsec_lifo_pop(&parsec_remote_dep_context.freelist))) {
+            for( uint32_t i = 0; i < parsec_remote_dep_context.max_dep_count; i++ )
+                remote_dep_rank_set_release(&rdeps->output[i].ranks);
+            remote_dep_rank_set_release(&rdeps->forwarded);
             free(rdeps);
         }
         PARSEC_OBJ_DESTRUCT(&parsec_remote_dep_context.freelist);
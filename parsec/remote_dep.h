@@ -54,6 +54,10 @@ typedef struct remote_dep_wire_get_s {
     remote_dep_datakey_t       remote_callback_data;
     remote_dep_datakey_t       output_mask;
     uintptr_t                  callback_fn;
+    int32_t                    priority;   /**< priority of the consumer of the data */
+    uint32_t                   nb_chunks;  /**< number of chunks of the data (set on the first one) */
+    uint64_t                   offset;     /**< offset of the chunk in the contiguous payload */
+    uint64_t                   size;       /**< size of the chunk, 0 for the whole data */
     parsec_ce_mem_reg_handle_t remote_memory_handle;
 } remote_dep_wire_get_t;
 
@@ -107,12 +111,34 @@ struct parsec_reshape_promise_description_s {
                                                               * the same reshape promise (workaround comm engine) */
 #endif
     uint32_t                              remote_recv_guard; /* Use to prevent re-reshaping after reception */
+    uint32_t                              pack_required;     /* A consumer writes the data or sends it to a remote,
+                                                              * the reshape can not be a view on the input copy */
 };
 
 /* Callback to do a local reshaping of a datacopy */
 void parsec_local_reshape_cb(parsec_base_future_t *future, ... );
 /* assumed: void **in_data, parsec_execution_stream_t *es, parsec_task_t *task */
 
+/**
+ * Set of the processes participating in the propagation of an output, each
+ * stored by its position relative to the root of the propagation. While the
+ * bitmap of all the processes fits in the inline storage it is used as such.
+ * On larger runs the inline storage holds a sorted array of the few members,
+ * and only when it overflows the set switches to a bitmap of
+ * max_nodes_number bits, allocated the first time and kept with the set. The
+ * cost of the set is then proportional to the number of members, not to the
+ * number of processes. Both representations enumerate the members in
+ * increasing position, so that all processes see the same order.
+ */
+#define PARSEC_REMOTE_DEP_RANK_SET_INLINE 16
+typedef struct remote_dep_rank_set_s {
+    uint32_t  count;   /**< The number of members */
+    uint32_t  dense;   /**< The members are in the bitmap bits, not in the sorted array */
+    uint32_t *bits;    /**< The bitmap (inline or heap) when dense */
+    uint32_t *heap;    /**< The heap bitmap, NULL until it is needed */
+    uint32_t  local[PARSEC_REMOTE_DEP_RANK_SET_INLINE];  /**< Sorted members or small bitmap */
+} remote_dep_rank_set_t;
+
 struct remote_dep_output_param_s {
     /** Never change this structure without understanding the
      *   "subtle" relation with remote_deps_allocation_init in
@@ -125,8 +151,12 @@ struct remote_dep_output_param_s {
                                                        propagated by this message. The bitmask uses
                                                        dependencies indexes not flow indexes. */
     int32_t                              priority;    /**< the priority of the message */
-    uint32_t                             count_bits;  /**< The number of participants */
-    uint32_t*                            rank_bits;   /**< The array of bits representing the propagation path */
+    remote_dep_rank_set_t                ranks;       /**< The participants of the propagation */
+    void*                                compressed;  /**< The compressed payload (sent, or staged for reception), or NULL */
+    uint32_t                             compressed_size; /**< Size of the compressed payload */
+    uint32_t                             contiguous_size; /**< Size of the payload if the sender exposes it as contiguous bytes, or 0 */
+    uint32_t                             pending_chunks;  /**< Chunks of the payload still expected (receiver) */
+    parsec_time_t                        get_date;    /**< When the GET was issued (receiver, comm_stats only) */
 };
 
 struct parsec_remote_deps_s {
@@ -142,15 +172,14 @@ struct parsec_remote_deps_s {
     void                            *eager_msg;     /**< A pointer to the eager buffer if this is an eager msg, otherwise NULL */
     int32_t                          max_priority;
     int32_t                          priority;
-    uint32_t                        *remote_dep_fw_mask;  /**< list of peers already notified about
-                                                           * the control sequence (only used for control messages) */
+    parsec_time_t                    activate_date; /**< When the activation was received (comm_stats only) */
+    remote_dep_rank_set_t            forwarded;     /**< peers already notified about the control
+                                                     * sequence (only used for control messages) */
     struct data_repo_entry_s        *repo_entry;
     struct remote_dep_output_param_s output[1];
 };
-/* { item .. remote_dep_fw_mask (points to fw_mask_bitfield),
- *   output[0] .. output[max_deps < MAX_PARAM_COUNT],
- *   (max_dep_count x (np+31)/32 uint32_t) rank_bits
- *   ((np+31)/32 x uint32_t) fw_mask_bitfield } */
+/* { item .. forwarded, output[0] .. output[max_deps < MAX_PARAM_COUNT] },
+ * the size does not depend on the number of processes */
 
 /* This int can take the following values:
  * - negative: no communication engine has been enabled
@@ -163,6 +192,32 @@ extern int parsec_comm_verbose;
 extern parsec_execution_stream_t parsec_comm_es;
 extern int parsec_param_comm_thread_multiple;
 
+/**
+ * Accounting of the remote dependencies received from a peer for the
+ * outputs of a task class (see comm_stats). All the times are taken on the
+ * local clock: from the reception of the activation to the GET, from the GET
+ * to the arrival of the data, and from the arrival of the data to the start
+ * of the local consumers it made ready. The data received in the activation
+ * message (eager) have no GET. The consumer fields are updated atomically by
+ * the computation threads, everything else by the communication thread.
+ */
+typedef struct parsec_remote_dep_stats_s {
+    struct parsec_remote_dep_stats_s *next;
+    char    *name;              /**< name of the producer task class */
+    int      peer;              /**< rank of the producer */
+    parsec_time_t arrival;      /**< arrival of the data being released (communication thread) */
+    int64_t  nb_data;           /**< data received, including the eager ones */
+    int64_t  nb_eager;          /**< data received in the activation message */
+    int64_t  bytes;             /**< bytes received */
+    int64_t  activate_to_get, activate_to_get_max;
+    int64_t  get_to_data, get_to_data_max, get_to_data_min;
+    int64_t  nb_consumers;      /**< local consumers started */
+    int64_t  data_to_start, data_to_start_max;
+} parsec_remote_dep_stats_t;
+
+/* Enable the accounting of the remote dependencies, see comm_stats */
+extern int parsec_comm_stats;
+
 #ifdef DISTRIBUTED
 
 typedef struct {
@@ -221,6 +276,10 @@ int parsec_remote_dep_activate(parsec_execution_stream_t* es,
                                parsec_remote_deps_t* remote_deps,
                                uint32_t propagation_mask);
 
+/* Compress the payload of an output before it is sent, if the communication
+ * engine is configured to do so. Called from the thread releasing the deps. */
+void remote_dep_compress_output(struct remote_dep_output_param_s* output);
+
 /* Memcpy a particular data using datatype specification */
 void parsec_remote_dep_memcpy(parsec_execution_stream_t* es,
                               parsec_taskpool_t* tp,
@@ -236,6 +295,49 @@ int remote_dep_dequeue_delayed_dep_release(parsec_remote_deps_t *deps);
 /* Reconfigure the remote_dep part of the communication engine */
 int parsec_remote_dep_reconfigure(parsec_context_t* context);
 
+/* Report the accounting of the remote dependencies received so far by this
+ * process (comm_stats), and where the transfers spent their time */
+PARSEC_DECLSPEC int parsec_remote_dep_stats_report(parsec_context_t* context);
+
+/* Hosts of the processes, discovered by the communication engine at init and
+ * when the communicator changes (or emulated, see comm_emulate_hosts): the
+ * processes sharing memory are on the same host, numbered from 0 in the order
+ * of their first rank. */
+int remote_dep_hosts_discover(parsec_context_t* context);
+PARSEC_DECLSPEC int parsec_remote_dep_nb_hosts(void);
+PARSEC_DECLSPEC int parsec_remote_dep_host_of(int rank);
+
+/* Placement of the process grids by host (comm_host_placement): returns 1 if
+ * the grids spanning nb_ranks processes should be placed by host, and sets
+ * ranks_per_host to the number of processes of each host, or to 1 if the hosts
+ * have different numbers of processes. In the order by host, the processes
+ * are sorted by host then by rank: host_rank gives the rank at an index of
+ * this order, and host_index the index of a rank. */
+PARSEC_DECLSPEC int parsec_remote_dep_host_placement(int nb_ranks, int *ranks_per_host);
+PARSEC_DECLSPEC int parsec_remote_dep_host_rank(int index);
+PARSEC_DECLSPEC int parsec_remote_dep_host_index(int rank);
+
+/* Model of the link to a peer (comm_short_adaptive), fitted on the puts to
+ * this peer: a put completes after the latency plus the time to drain the
+ * bytes in flight to the peer when it started and its own bytes. Sending a
+ * data in the activation message saves a round trip, but delays the following
+ * activations by its own transfer time: it is worth it below the
+ * bandwidth-delay product of the link. The limit applies to the packed size
+ * of the data, whatever its datatype. */
+typedef struct parsec_remote_dep_link_s {
+    double   n, x, t, xx, xt;  /**< decayed sums of the bytes ahead and durations of the puts */
+    int      nb_puts;          /**< puts accounted */
+    double   latency;          /**< of the last fit, in the unit of the timer */
+    double   bandwidth;        /**< of the last fit, in bytes per unit of the timer */
+    size_t   limit;            /**< largest data sent in the activation message to this peer */
+} parsec_remote_dep_link_t;
+
+/* Account a put that completed in duration with ahead bytes to drain (its own
+ * included), and move the limit of the link to the bandwidth-delay product,
+ * at most max_limit, once the model is known. Returns 1 if the limit changed. */
+PARSEC_DECLSPEC int parsec_remote_dep_link_update(parsec_remote_dep_link_t *link, size_t ahead,
+                                                  double duration, size_t max_limit);
+
 #if defined(PARSEC_DIST_COLLECTIVES)
 /* Propagate an activation order from the current node down the original tree */
 int parsec_remote_dep_propagate(parsec_execution_stream_t* es,
@@ -252,6 +354,12 @@ int parsec_remote_dep_propagate(parsec_execution_stream_t* es,
 #define parsec_remote_dep_activate(ctx, o, r) -1
 #define parsec_remote_dep_new_taskpool(ctx)    0
 #define remote_dep_mpi_initialize_execution_stream(ctx) 0
+#define parsec_remote_dep_stats_report(ctx)    0
+#define parsec_remote_dep_nb_hosts()           1
+#define parsec_remote_dep_host_of(r)           0
+#define parsec_remote_dep_host_placement(n, c) 0
+#define parsec_remote_dep_host_rank(i)         (i)
+#define parsec_remote_dep_host_index(r)        (r)
 #endif /* DISTRIBUTED */
 
 /* check if this data description represents a CTL dependency */
@@ -295,6 +403,7 @@ union dep_cmd_u {
     struct {
         remote_dep_wire_get_t      task;
         int                        peer;
+        size_t                     bytes;  /**< size of the transfer, for the put scheduler */
         parsec_ce_mem_reg_handle_t remote_memory_handle;
     } activate;
     struct {
@@ -423,21 +532,93 @@ extern int parsec_comm_gets;
 extern int parsec_comm_puts_max;
 extern int parsec_comm_puts;
 
-static inline void
-remote_dep_rank_to_bit(int rank, uint32_t *bank, uint32_t *bit, int root)
+#ifdef DISTRIBUTED
+/* The largest number of members kept in the sorted array of a rank set */
+extern int parsec_remote_dep_rank_set_sparse;
+
+static inline uint32_t
+remote_dep_rank_to_pos(int rank, int root)
+{
+    uint32_t nb_nodes = parsec_remote_dep_context.max_nodes_number;
+    return (rank + nb_nodes - root) % nb_nodes;
+}
+
+static inline int
+remote_dep_pos_to_rank(uint32_t pos, int root)
 {
     uint32_t nb_nodes = parsec_remote_dep_context.max_nodes_number;
-    uint32_t _rank = (rank + nb_nodes - root) % nb_nodes;
-    *bank = _rank / (8 * sizeof(uint32_t));
-    *bit =  _rank % (8 * sizeof(uint32_t));
+    return (int)((pos + root) % nb_nodes);
+}
+
+void remote_dep_rank_set_init(remote_dep_rank_set_t *set);
+void remote_dep_rank_set_densify(remote_dep_rank_set_t *set);
+void remote_dep_rank_set_release(remote_dep_rank_set_t *set);
+
+static inline int
+remote_dep_rank_set_contains(const remote_dep_rank_set_t *set, uint32_t pos)
+{
+    uint32_t i;
+    if( set->dense )
+        return (int)((set->bits[pos / 32] >> (pos % 32)) & 1);
+    for( i = 0; i < set->count; i++ ) {
+        if( set->local[i] >= pos ) return set->local[i] == pos;
+    }
+    return 0;
+}
+
+/* Add the position to the set, returns 1 if it was not yet a member */
+static inline int
+remote_dep_rank_set_add(remote_dep_rank_set_t *set, uint32_t pos)
+{
+    uint32_t i;
+    if( !set->dense ) {
+        for( i = 0; (i < set->count) && (set->local[i] < pos); i++ );
+        if( (i < set->count) && (set->local[i] == pos) ) return 0;
+        if( set->count < (uint32_t)parsec_remote_dep_rank_set_sparse ) {
+            memmove(&set->local[i + 1], &set->local[i], (set->count - i) * sizeof(uint32_t));
+            set->local[i] = pos;
+            set->count++;
+            return 1;
+        }
+        remote_dep_rank_set_densify(set);
+    }
+    if( set->bits[pos / 32] & (1U << (pos % 32)) ) return 0;
+    set->bits[pos / 32] |= 1U << (pos % 32);
+    set->count++;
+    return 1;
 }
 
 static inline void
-remote_dep_bit_to_rank(int *rank, uint32_t bank, uint32_t bit, int root)
+remote_dep_rank_set_clear(remote_dep_rank_set_t *set)
 {
-    int nb_nodes = parsec_remote_dep_context.max_nodes_number;
-    uint32_t _rank = bank * (8 * sizeof(uint32_t)) + bit;
-    *rank = (_rank + root) % nb_nodes;
+    if( set->dense && (0 != set->count) )
+        memset(set->bits, 0, ((parsec_remote_dep_context.max_nodes_number + 31) / 32) * sizeof(uint32_t));
+    /* large sets return to the sorted array */
+    set->dense = (set->bits == set->local);
+    set->count = 0;
 }
 
+/* Enumerate the members in increasing positions: start with *cursor at 0,
+ * returns the next member, or -1 once all have been returned */
+static inline int
+remote_dep_rank_set_next(const remote_dep_rank_set_t *set, uint32_t *cursor)
+{
+    uint32_t c = *cursor, word, nb_nodes = parsec_remote_dep_context.max_nodes_number;
+    if( !set->dense )
+        return (c < set->count) ? (int)set->local[(*cursor)++] : -1;
+    while( c < nb_nodes ) {
+        word = set->bits[c / 32] >> (c % 32);
+        if( 0 == word ) {  /* skip the empty words */
+            c = (c / 32 + 1) * 32;
+            continue;
+        }
+        for( ; !(word & 1); word >>= 1, c++ );
+        *cursor = c + 1;
+        return (int)c;
+    }
+    *cursor = nb_nodes;
+    return -1;
+}
+#endif /* DISTRIBUTED */
+
 #endif /* __USE_PARSEC_REMOTE_DEP_H__ */
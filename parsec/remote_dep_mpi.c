@@ -18,11 +18,16 @@
 #include "parsec/papi_sde.h"
 #include "parsec/interfaces/dtd/insert_function_internal.h"
 #include "parsec/remote_dep.h"
+#include "parsec/parsec_mpi_funnelled.h"
 #include "parsec/class/dequeue.h"
+#include "parsec/class/mpmc_ring.h"
+#include "parsec/utils/compress.h"
+#include "parsec/os-spec-timing.h"
 
 #include "parsec/parsec_binary_profile.h"
 
 #include "parsec/parsec_internal.h"
+#include "parsec/interfaces/interface.h"
 
 #if defined(PARSEC_DEBUG_NOISIER)
 static int64_t count_reshaping = 0;
@@ -42,12 +47,84 @@ int parsec_comm_puts      = 0;
  */
 static void remote_dep_mpi_params(parsec_context_t* context);
 static int parsec_param_nb_tasks_extracted = 20;
+static int parsec_param_cmd_ring_size = 1024;
 /* For the meaning of aggregate, short and eager, refer to the
  * param register help text for comm_aggregate, and
  * comm_short_limit respectively.
  */
 static size_t parsec_param_short_limit = RDEP_MSG_SHORT_LIMIT;
 static int parsec_param_enable_aggregate = 0;
+/* Adaptation of the short limit to each peer, see comm_short_adaptive */
+static int parsec_param_comm_short_adaptive = 0;
+
+/* Model of the link to each peer, see parsec_remote_dep_link_update */
+static parsec_remote_dep_link_t *remote_dep_peer_links = NULL;
+/* weight of the past puts in the model, and puts needed before adapting */
+#define REMOTE_DEP_LINK_DECAY  0.95
+#define REMOTE_DEP_LINK_WARMUP 8
+/* Compression of the payloads sent by rendez-vous, see comm_compress */
+static int parsec_param_comm_compress = 0;
+static size_t parsec_param_comm_compress_min = 16384;
+
+/* In the data sizes of an activation, marks a payload sent compressed */
+#define PARSEC_REMOTE_DEP_COMPRESSED_SIZE  0x80000000U
+/* In the data sizes of an activation, marks a payload the sender exposes as
+ * contiguous bytes, that can then be transferred in chunks */
+#define PARSEC_REMOTE_DEP_CONTIGUOUS_SIZE  0x40000000U
+
+static struct {
+    int64_t nb_data;     /**< number of payloads given to the compressor */
+    int64_t nb_sent;     /**< number of payloads sent compressed */
+    int64_t raw_bytes;   /**< bytes given to the compressor */
+    int64_t sent_bytes;  /**< bytes sent for these payloads */
+    int64_t time;        /**< time spent compressing, in TIMER_UNIT */
+} parsec_comm_compress_stats;
+
+/* Reception of the data directly in the tile of their consumer, see comm_inplace */
+static int parsec_param_comm_inplace = 0;
+
+static struct {
+    int64_t nb_data;     /**< number of data received in place */
+    int64_t bytes;       /**< bytes received in place, neither allocated nor copied */
+} parsec_comm_inplace_stats;
+
+/* Scheduling of the outgoing transfers, see comm_put_max_bytes,
+ * comm_put_peer_max_bytes and comm_put_chunk (all off by default) */
+static int parsec_param_comm_put_max_bytes = 0;
+static int parsec_param_comm_put_peer_max_bytes = 0;
+static int parsec_param_comm_put_chunk = 0;
+static size_t remote_dep_put_inflight = 0;         /**< bytes of the puts in flight */
+static size_t *remote_dep_put_peer_inflight = NULL; /**< bytes of the puts in flight to each peer */
+
+static struct {
+    int64_t nb_puts;     /**< number of puts started */
+    int64_t nb_chunks;   /**< number of these puts that are a chunk of a larger data */
+    int64_t max_inflight; /**< largest number of bytes in flight */
+} parsec_comm_put_stats;
+
+/* Hosts of the processes, see parsec_remote_dep_host_of. The order by host
+ * lists the ranks sorted by host then by rank, and is used to place the
+ * process grids when comm_host_placement is set. */
+static int parsec_param_comm_emulate_hosts = 0;
+static int parsec_param_comm_host_placement = 0;
+static int remote_dep_nb_hosts = 1;
+static int remote_dep_ranks_per_host = 1;  /**< processes on each host, 1 if the hosts differ */
+static int *remote_dep_host_of = NULL;
+static int *remote_dep_host_order = NULL;  /**< rank at each index of the order by host */
+static int *remote_dep_host_index_of = NULL; /**< index of each rank in the order by host */
+
+/* Traffic to the processes of the same host [0] and of the other hosts [1] */
+static struct {
+    int64_t nb_activations; /**< activation messages sent */
+    int64_t activation_bytes; /**< bytes of these messages, with the data sent eagerly */
+    int64_t data_bytes;     /**< bytes of the data put on demand */
+} parsec_comm_host_stats[2];
+
+/* Accounting of the remote dependencies, see comm_stats: a list of entries,
+ * one by task class, for each peer. The lists are only grown by the
+ * communication thread, and can be walked by any thread. */
+static parsec_remote_dep_stats_t **remote_dep_stats = NULL;
+static int remote_dep_stats_nb_peers = 0;
 
 parsec_mempool_t *parsec_remote_dep_cb_data_mempool = NULL;
 
@@ -60,6 +137,10 @@ typedef struct remote_dep_cb_data_s {
     uint64_t event_id;
 #endif /* PARSEC_PROF_TRACE */
     int k;
+    int peer;      /* destination of a put */
+    size_t size;   /* bytes of a put */
+    size_t ahead;  /* bytes in flight to the peer when the put started, plus its own */
+    parsec_time_t start; /* start of the put */
 } remote_dep_cb_data_t;
 
 PARSEC_DECLSPEC PARSEC_OBJ_CLASS_DECLARATION(remote_dep_cb_data_t);
@@ -96,6 +177,13 @@ remote_dep_cmd_to_string(remote_dep_wire_activate_t* origin,
 #define datakey_count 3
 
 static pthread_t dep_thread_id;
+/* Commands handed to the communication thread go through a lock-free bounded
+ * ring, and overflow into dep_cmd_queue when the ring is full. Producers keep
+ * using the overflow queue for as long as it holds commands, so that the
+ * commands of a thread are always consumed in order. */
+static parsec_mpmc_ring_t dep_cmd_ring;
+static volatile int32_t dep_cmd_overflow = 0;
+static dep_cmd_item_t* dep_cmd_held = NULL;  /* DEP_CTL waiting for the fifo to drain */
 parsec_dequeue_t dep_cmd_queue;
 parsec_list_t    dep_cmd_fifo;             /* ordered non threaded fifo */
 parsec_list_t    dep_activates_fifo;       /* ordered non threaded fifo */
@@ -139,7 +227,8 @@ parsec_execution_stream_t parsec_comm_es = {
     .datarepo_mempools = {0}
 };
 
-static void remote_dep_mpi_put_start(parsec_execution_stream_t* es, dep_cmd_item_t* item);
+static int remote_dep_mpi_put_start(parsec_execution_stream_t* es, dep_cmd_item_t* item);
+static int remote_dep_mpi_put_schedule(parsec_execution_stream_t* es);
 static void remote_dep_mpi_get_start(parsec_execution_stream_t* es, parsec_remote_deps_t* deps);
 
 static void remote_dep_mpi_get_end(parsec_execution_stream_t* es,
@@ -197,6 +286,31 @@ static void remote_dep_mpi_profiling_init(void);
 #endif // PARSEC_PROF_TRACE
 
 
+static inline void remote_dep_cmd_push(dep_cmd_item_t* item)
+{
+    if( (0 == dep_cmd_overflow) && parsec_mpmc_ring_push(&dep_cmd_ring, item) )
+        return;
+    parsec_atomic_fetch_inc_int32(&dep_cmd_overflow);
+    parsec_dequeue_push_back(&dep_cmd_queue, (parsec_list_item_t*)item);
+}
+
+/* Only called by the thread progressing the communications */
+static inline dep_cmd_item_t* remote_dep_cmd_pop(void)
+{
+    dep_cmd_item_t* item = dep_cmd_held;
+
+    if( NULL != item ) {
+        dep_cmd_held = NULL;
+        return item;
+    }
+    if( NULL != (item = (dep_cmd_item_t*)parsec_mpmc_ring_pop(&dep_cmd_ring)) )
+        return item;
+    if( 0 == dep_cmd_overflow ) return NULL;
+    if( NULL != (item = (dep_cmd_item_t*)parsec_dequeue_try_pop_front(&dep_cmd_queue)) )
+        parsec_atomic_fetch_dec_int32(&dep_cmd_overflow);
+    return item;
+}
+
 static void remote_dep_mpi_params(parsec_context_t* context) {
     (void)context;
 #if RDEP_MSG_SHORT_LIMIT != 0
@@ -207,8 +321,123 @@ static void remote_dep_mpi_params(parsec_context_t* context) {
         parsec_param_short_limit = RDEP_MSG_SHORT_LIMIT;
     }
 #endif
+    parsec_mca_param_reg_int_name("runtime", "comm_short_adaptive", "Adapt the short limit to each peer: the latency and bandwidth of the link are measured on the data transfers, "
+                                  "and the data smaller than the bandwidth-delay product (up to comm_short_limit) are sent in the activation message. "
+                                  "Otherwise comm_short_limit applies to all the peers (1=true,0=false).",
+                                  false, false, parsec_param_comm_short_adaptive, &parsec_param_comm_short_adaptive);
     parsec_mca_param_reg_int_name("runtime", "comm_aggregate", "Aggregate multiple dependencies in the same short message (1=true,0=false).",
                                   false, false, parsec_param_enable_aggregate, &parsec_param_enable_aggregate);
+    parsec_mca_param_reg_int_name("runtime", "comm_compress", "Compress the data sent by rendez-vous (1=true,0=false). The data is packed, its bytes are shuffled by element "
+                                  "and compressed with a lossless LZ coder on the thread releasing the task, and only sent compressed when at least 1/8 of the bytes are saved.",
+                                  false, false, parsec_param_comm_compress, &parsec_param_comm_compress);
+    parsec_mca_param_reg_sizet_name("runtime", "comm_compress_min", "Minimum size in bytes of the data to compress, when comm_compress is enabled.",
+                                    false, false, parsec_param_comm_compress_min, &parsec_param_comm_compress_min);
+    parsec_mca_param_reg_int_name("runtime", "comm_inplace", "Receive the data directly in the local tile of a collection in which their only consumer writes them back "
+                                  "unchanged, instead of in a temporary copy, when no local task uses the tile (1=true,0=false, the default).",
+                                  false, false, parsec_param_comm_inplace, &parsec_param_comm_inplace);
+    parsec_mca_param_reg_int_name("runtime", "comm_put_max_bytes", "Maximum number of bytes of the outgoing data transfers in flight, the pending transfers being started "
+                                  "in the order of the priority of their consumer (0 for no limit, the default).",
+                                  false, false, parsec_param_comm_put_max_bytes, &parsec_param_comm_put_max_bytes);
+    parsec_mca_param_reg_int_name("runtime", "comm_put_peer_max_bytes", "Maximum number of bytes of the outgoing data transfers in flight to each process (0 for no limit, the default).",
+                                  false, false, parsec_param_comm_put_peer_max_bytes, &parsec_param_comm_put_peer_max_bytes);
+    parsec_mca_param_reg_int_name("runtime", "comm_put_chunk", "Size in bytes of the chunks in which the large contiguous (or compressed) data are transferred, letting the "
+                                  "transfers of higher priority overtake the rest of a large one (0 to transfer the data at once, the default).",
+                                  false, false, parsec_param_comm_put_chunk, &parsec_param_comm_put_chunk);
+    parsec_mca_param_reg_int_name("runtime", "comm_stats", "Account the time of each remote dependency, from the reception of the activation to the GET, from the GET to the "
+                                  "arrival of the data, and from the arrival of the data to the start of the local consumers it made ready, by task class "
+                                  "and peer, and report it at finalization, together with the traffic inside and between the hosts (1=true,0=false).",
+                                  false, false, parsec_comm_stats, &parsec_comm_stats);
+    parsec_mca_param_reg_int_name("runtime", "comm_emulate_hosts", "Emulate this many hosts instead of discovering the processes sharing memory, the rank r "
+                                  "being on the host r modulo this number, as when a launcher distributes the processes round-robin over the nodes (0 to discover the hosts).",
+                                  false, false, parsec_param_comm_emulate_hosts, &parsec_param_comm_emulate_hosts);
+    parsec_mca_param_reg_int_name("runtime", "comm_host_placement", "Place the processes of the same host on neighbouring positions of the process grid of the 2-D block cyclic "
+                                  "collections spanning all the processes, so that the rows (or blocks of rows and columns) of the grid exchanging the tiles are on the same host "
+                                  "(1=true,0=false).",
+                                  false, false, parsec_param_comm_host_placement, &parsec_param_comm_host_placement);
+    parsec_mca_param_reg_int_name("runtime", "comm_cmd_ring_size", "Number of commands the lock-free queue feeding the communication thread holds before overflowing into a locked queue.",
+                                  false, false, parsec_param_cmd_ring_size, &parsec_param_cmd_ring_size);
+    parsec_mca_param_reg_int_name("runtime", "reshape_view", "Local reshapes keeping the same datatype give the read-only consumers a view on the input copy instead of a packed copy (1=true,0=false).",
+                                  false, false, parsec_param_reshape_view, &parsec_param_reshape_view);
+}
+
+/* Find the host of each process, from the communication engine or emulated
+ * (comm_emulate_hosts), and sort the processes by host. Collective with the
+ * MPI engine: called at init and when the communicator changes. */
+int remote_dep_hosts_discover(parsec_context_t* context)
+{
+    int nb = context->nb_nodes, r, h, *first, *count;
+
+    free(remote_dep_host_of); free(remote_dep_host_order); free(remote_dep_host_index_of);
+    remote_dep_host_of       = (int*)malloc(nb * sizeof(int));
+    remote_dep_host_order    = (int*)malloc(nb * sizeof(int));
+    remote_dep_host_index_of = (int*)malloc(nb * sizeof(int));
+    if( parsec_param_comm_emulate_hosts > 0 ) {
+        for( r = 0; r < nb; r++ ) remote_dep_host_of[r] = r % parsec_param_comm_emulate_hosts;
+    } else if( NULL != parsec_ce.hosts ) {
+        parsec_ce.hosts(&parsec_ce, remote_dep_host_of);
+    } else {
+        for( r = 0; r < nb; r++ ) remote_dep_host_of[r] = r;
+    }
+
+    /* number the hosts in the order of their first rank */
+    first = (int*)malloc(nb * sizeof(int));
+    count = (int*)calloc(nb + 1, sizeof(int));
+    for( r = 0; r < nb; r++ ) first[r] = -1;
+    remote_dep_nb_hosts = 0;
+    for( r = 0; r < nb; r++ ) {
+        h = remote_dep_host_of[r];
+        if( -1 == first[h] ) first[h] = remote_dep_nb_hosts++;
+        remote_dep_host_of[r] = first[h];
+        count[first[h] + 1]++;
+    }
+    remote_dep_ranks_per_host = count[1];
+    for( h = 1; h <= remote_dep_nb_hosts; h++ ) {
+        if( count[h] != remote_dep_ranks_per_host ) remote_dep_ranks_per_host = 1;
+        count[h] += count[h - 1];
+    }
+    /* the ranks in increasing order inside each host */
+    for( r = 0; r < nb; r++ ) {
+        int idx = count[remote_dep_host_of[r]]++;
+        remote_dep_host_order[idx] = r;
+        remote_dep_host_index_of[r] = idx;
+    }
+    free(first); free(count);
+
+    parsec_debug_verbose(3, parsec_comm_output_stream, "Rank %d of %d on host %d of %d (%d processes by host%s)",
+                         context->my_rank, nb, remote_dep_host_of[context->my_rank], remote_dep_nb_hosts,
+                         remote_dep_ranks_per_host, (remote_dep_nb_hosts * remote_dep_ranks_per_host == nb) ? "" : " at most");
+    return PARSEC_SUCCESS;
+}
+
+int parsec_remote_dep_nb_hosts(void)
+{
+    return remote_dep_nb_hosts;
+}
+
+int parsec_remote_dep_host_of(int rank)
+{
+    return (NULL == remote_dep_host_of) ? 0 : remote_dep_host_of[rank];
+}
+
+int parsec_remote_dep_host_placement(int nb_ranks, int *ranks_per_host)
+{
+    /* nothing to gain when all the processes are on the same host, or each on its own */
+    if( !parsec_param_comm_host_placement || (NULL == remote_dep_host_order) ||
+        (nb_ranks != parsec_ce.parsec_context->nb_nodes) ||
+        (1 == remote_dep_nb_hosts) || (nb_ranks == remote_dep_nb_hosts) )
+        return 0;
+    *ranks_per_host = remote_dep_ranks_per_host;
+    return 1;
+}
+
+int parsec_remote_dep_host_rank(int index)
+{
+    return (NULL == remote_dep_host_order) ? index : remote_dep_host_order[index];
+}
+
+int parsec_remote_dep_host_index(int rank)
+{
+    return (NULL == remote_dep_host_index_of) ? rank : remote_dep_host_index_of[rank];
 }
 
 int
@@ -257,6 +486,9 @@ remote_dep_dequeue_init(parsec_context_t* context)
         return PARSEC_ERR_NOT_FOUND;
     }
 
+    /* before the communication thread starts, the engine may be collective */
+    remote_dep_hosts_discover(context);
+
     if(parsec_param_comm_thread_multiple) {
         if( thread_level_support >= MPI_THREAD_MULTIPLE ) {
             context->flags |= PARSEC_CONTEXT_FLAG_COMM_MT;
@@ -267,6 +499,11 @@ remote_dep_dequeue_init(parsec_context_t* context)
         }
     }
 
+    PARSEC_OBJ_CONSTRUCT(&dep_cmd_ring, parsec_mpmc_ring_t);
+    if( PARSEC_SUCCESS != parsec_mpmc_ring_init(&dep_cmd_ring, parsec_param_cmd_ring_size > 0 ? parsec_param_cmd_ring_size : 1) ) {
+        parsec_warning("Could not allocate the communication command queue of %d elements", parsec_param_cmd_ring_size);
+        return PARSEC_ERR_OUT_OF_RESOURCE;
+    }
     PARSEC_OBJ_CONSTRUCT(&dep_cmd_queue, parsec_dequeue_t);
     PARSEC_OBJ_CONSTRUCT(&dep_cmd_fifo, parsec_list_t);
 
@@ -328,7 +565,7 @@ remote_dep_dequeue_fini(parsec_context_t* context)
         item->action = DEP_CTL;
         item->cmd.ctl.enable = -1;  /* turn off and return from the MPI thread */
         item->priority = 0;
-        parsec_dequeue_push_back(&dep_cmd_queue, (parsec_list_item_t*) item);
+        remote_dep_cmd_push(item);
 
         /* I am supposed to own the lock. Wake the MPI thread */
         pthread_cond_signal(&mpi_thread_condition);
@@ -337,13 +574,21 @@ remote_dep_dequeue_fini(parsec_context_t* context)
         assert((parsec_context_t*)ret == context);
     }
 
-    assert(NULL == parsec_dequeue_pop_front(&dep_cmd_queue));
+    assert(NULL == remote_dep_cmd_pop());
     PARSEC_OBJ_DESTRUCT(&dep_cmd_queue);
+    PARSEC_OBJ_DESTRUCT(&dep_cmd_ring);
     assert(NULL == parsec_dequeue_pop_front(&dep_cmd_fifo));
     PARSEC_OBJ_DESTRUCT(&dep_cmd_fifo);
     mpi_initialized = 0;
 
     PARSEC_DEBUG_VERBOSE(10, parsec_debug_output, "Process has reshaped %zu tiles.", count_reshaping);
+    {
+        int64_t nb_copies, nb_bytes;
+        parsec_reshape_avoided_copies(&nb_copies, &nb_bytes);
+        if( 0 != nb_copies )
+            parsec_debug_verbose(3, parsec_debug_output, "Process has avoided %"PRId64" reshaped copies (%"PRId64" bytes) by reusing or viewing the input copies.",
+                                 nb_copies, nb_bytes);
+    }
     (void)context;
     return 0;
 }
@@ -401,7 +646,7 @@ remote_dep_dequeue_off(parsec_context_t* context)
     while( 3 != parsec_communication_engine_up ) sched_yield();
     PARSEC_DEBUG_VERBOSE(20, parsec_comm_output_stream, "MPI: comm engine signalled OFF on process %d/%d",
                          context->my_rank, context->nb_nodes);
-    parsec_dequeue_push_back(&dep_cmd_queue, (parsec_list_item_t*) item);
+    remote_dep_cmd_push(item);
 
     /* wait until we own the PaRSEC MPI synchronization mutex */
     pthread_mutex_lock(&mpi_thread_mutex);
@@ -492,7 +737,7 @@ int remote_dep_dequeue_new_taskpool(parsec_taskpool_t* tp)
     item->action = DEP_NEW_TASKPOOL;
     item->priority = 0;
     item->cmd.new_taskpool.tp = tp;
-    parsec_dequeue_push_back(&dep_cmd_queue, (parsec_list_item_t*)item);
+    remote_dep_cmd_push(item);
     return 1;
 }
 
@@ -505,7 +750,7 @@ remote_dep_dequeue_delayed_dep_release(parsec_remote_deps_t *deps)
     item->action = DEP_DTD_DELAYED_RELEASE;
     item->priority = 0;
     item->cmd.release.deps = deps;
-    parsec_dequeue_push_back(&dep_cmd_queue, (parsec_list_item_t*)item);
+    remote_dep_cmd_push(item);
     return 1;
 }
 
@@ -528,9 +773,11 @@ remote_dep_dequeue_send(parsec_execution_stream_t* es, int rank,
     if( parsec_comm_es.virtual_process->parsec_context->flags & PARSEC_CONTEXT_FLAG_COMM_MT ) {
         parsec_list_item_singleton(&item->pos_list); /* NOTE: this disables aggregation in MT cases. */
         remote_dep_nothread_send(es, &item);
+        /* and help progressing the transfers of our request pool */
+        mpi_multiple_progress(&parsec_ce);
     }
     else {
-        parsec_dequeue_push_back(&dep_cmd_queue, (parsec_list_item_t*)item);
+        remote_dep_cmd_push(item);
     }
     return 1;
 }
@@ -568,7 +815,59 @@ void parsec_remote_dep_memcpy(parsec_execution_stream_t* es,
     PARSEC_OBJ_RETAIN(src);
     remote_dep_inc_flying_messages(tp);
 
-    parsec_dequeue_push_back(&dep_cmd_queue, (parsec_list_item_t*) item);
+    remote_dep_cmd_push(item);
+}
+
+/**
+ * Called by the thread releasing the deps, before any activation is sent.
+ * The payload is packed with the native pack engine (no MPI call outside
+ * of the communication thread), its elements are byte-shuffled according
+ * to the basic type of the datatype, and it is compressed. The compressed
+ * buffer is shared by all the peers, and released with the deps.
+ */
+void remote_dep_compress_output(struct remote_dep_output_param_s* output)
+{
+    parsec_dep_type_description_t *type_desc = &output->data.remote;
+    size_t width = 1, clen, capacity;
+    int size, position = 0, rc;
+    parsec_time_t start;
+    char *packed;
+    void *buf;
+
+    if( !parsec_param_comm_compress || (NULL != output->compressed) ||
+        (NULL != output->data.data_future) || parsec_is_CTL_dep(&output->data) )
+        return;
+    if( (PARSEC_SUCCESS != parsec_type_pack_size((int)type_desc->src_count, type_desc->src_datatype, &size)) ||
+        ((size_t)size <= parsec_param_short_limit) || ((size_t)size < parsec_param_comm_compress_min) )
+        return;
+
+    start = take_time();
+    packed = (char*)malloc(size);
+    rc = parsec_type_pack((char*)PARSEC_DATA_COPY_GET_PTR(output->data.data) + type_desc->src_displ,
+                          (int)type_desc->src_count, type_desc->src_datatype, packed, size, &position);
+    if( PARSEC_SUCCESS != rc ) {
+        free(packed);
+        return;
+    }
+    parsec_type_element_size(type_desc->src_datatype, &width);
+    /* not worth the decompression if less than 1/8 of the bytes are saved */
+    capacity = (size_t)size - (size_t)size / 8;
+    buf = malloc(capacity);
+    if( PARSEC_SUCCESS == parsec_compress(packed, size, width, buf, capacity, &clen) ) {
+        output->compressed      = buf;
+        output->compressed_size = (uint32_t)clen;
+        parsec_atomic_fetch_inc_int64(&parsec_comm_compress_stats.nb_sent);
+    } else {
+        free(buf);
+        clen = size;
+    }
+    free(packed);
+    parsec_atomic_fetch_inc_int64(&parsec_comm_compress_stats.nb_data);
+    parsec_atomic_fetch_add_int64(&parsec_comm_compress_stats.raw_bytes, size);
+    parsec_atomic_fetch_add_int64(&parsec_comm_compress_stats.sent_bytes, (int64_t)clen);
+    parsec_atomic_fetch_add_int64(&parsec_comm_compress_stats.time, (int64_t)diff_time(start, take_time()));
+    PARSEC_DEBUG_VERBOSE(20, parsec_comm_output_stream, "Payload of %d bytes compressed to %zu bytes (shuffle %zu)%s",
+                         size, clen, width, (NULL == output->compressed) ? ", sent as is" : "");
 }
 
 static inline parsec_data_copy_t*
@@ -587,6 +886,34 @@ remote_dep_copy_allocate(parsec_dep_type_description_t* data)
     return dc;
 }
 
+/**
+ * Prepare the copy receiving a data: the tile found by
+ * remote_dep_inplace_target, unless it started being sent, or being used by
+ * a local task, since, or a new copy. The data received in the tile is a
+ * new version of the tile.
+ */
+static inline parsec_data_copy_t*
+remote_dep_copy_prepare(parsec_dep_data_description_t* data)
+{
+    parsec_data_copy_t* dc = data->data;
+    int size;
+
+    if( NULL != dc ) {
+        /* the collection and remote_dep_inplace_target hold the only references */
+        if( (0 == dc->readers) && (2 == dc->super.super.obj_reference_count) ) {
+            dc->version++;
+            parsec_ce.pack_size(&parsec_ce, data->remote.dst_count, data->remote.dst_datatype, &size);
+            parsec_atomic_fetch_inc_int64(&parsec_comm_inplace_stats.nb_data);
+            parsec_atomic_fetch_add_int64(&parsec_comm_inplace_stats.bytes, size);
+            PARSEC_DEBUG_VERBOSE(20, parsec_comm_output_stream, "MPI:\tReceive in place in tile %p (version %u) size %d",
+                                 dc, dc->version, size);
+            return dc;
+        }
+        PARSEC_DATA_COPY_RELEASE(dc);
+    }
+    return remote_dep_copy_allocate(&data->remote);
+}
+
 /**
  *
  * Allocate a new datacopy for a reshape.
@@ -663,6 +990,26 @@ void parsec_local_reshape_cb(parsec_base_future_t *future, ... )
     }
 #endif
 
+    if( parsec_reshape_reuse_copy(dt) ) {
+        PARSEC_DEBUG_VERBOSE(4, parsec_debug_output,
+                             "th%d RESHAPE_PROMISE AVOIDED reuse [%p:%p] for %s fut %p",
+                             es->th_id, dt->data, dt->data->dtt, task_string, future);
+        /* the future releases the tracked copy once all successors consumed it */
+        PARSEC_OBJ_RETAIN(dt->data);
+        parsec_future_set(future, dt->data);
+        return;
+    }
+
+    if( NULL != task ) {  /* not a reshape before sending to a remote */
+        parsec_data_copy_t *view = parsec_reshape_view_copy(dt);
+        if( NULL != view ) {
+            PARSEC_DEBUG_VERBOSE(4, parsec_debug_output,
+                                 "th%d RESHAPE_PROMISE AVOIDED view [%p:%p -> %p:%p] for %s fut %p",
+                                 es->th_id, dt->data, dt->data->dtt, view, view->dtt, task_string, future);
+            parsec_future_set(future, view);
+            return;
+        }
+    }
 
     /* if MPI is multithreaded do not thread-shift the sendrecv */
     if( (es->virtual_process->parsec_context->flags & PARSEC_CONTEXT_FLAG_COMM_MT)
@@ -706,12 +1053,100 @@ void parsec_local_reshape_cb(parsec_base_future_t *future, ... )
     item->cmd.memcpy_reshape.task = task;
 
     remote_dep_inc_flying_messages(tp);
-    parsec_dequeue_push_back(&dep_cmd_queue, (parsec_list_item_t*) item);
+    remote_dep_cmd_push(item);
 }
 
-#define is_inplace(ctx,dep) NULL
 #define is_read_only(ctx,dep) NULL
 
+/* Two datatypes describe the same bytes, both being contiguous if they differ */
+static int remote_dep_same_layout(parsec_datatype_t a, parsec_datatype_t b)
+{
+    ptrdiff_t lba, lbb, exta, extb;
+    int sa, sb;
+
+    if( a == b ) return 1;
+    if( (PARSEC_DATATYPE_NULL == a) || (PARSEC_DATATYPE_NULL == b) ) return 0;
+    parsec_type_size(a, &sa);
+    parsec_type_size(b, &sb);
+    parsec_type_extent(a, &lba, &exta);
+    parsec_type_extent(b, &lbb, &extb);
+    return (sa == sb) && (0 == lba) && (0 == lbb) && (exta == sa) && (extb == sb);
+}
+
+/* The count elements of the datatype are contiguous bytes */
+static int remote_dep_is_contiguous(parsec_datatype_t type, int count)
+{
+    ptrdiff_t lb, extent;
+    int size;
+
+    if( (PARSEC_DATATYPE_NULL == type) || (count <= 0) ) return 0;
+    parsec_type_size(type, &size);
+    parsec_type_extent(type, &lb, &extent);
+    return (0 == lb) && (extent == size);
+}
+
+/**
+ * Find the tile in which a data can be received in place: the successor
+ * writes the data, unchanged, in a local tile of a collection when it
+ * completes, and this data is its only input. The data received in the tile
+ * saves the allocation of a temporary copy and the final write. The tile
+ * must not be held by another device, nor by a local task: PTG does not
+ * count the local readers of a copy, but every task, or repo entry, using
+ * the tile holds a reference on it, while the collection holds the only
+ * one of an idle tile. Called for the first local successor of the data
+ * only, the other ones release the tile (remote_dep_mpi_retrieve_datatype).
+ *
+ * @return the retained copy of the tile, or NULL.
+ */
+static parsec_data_copy_t*
+remote_dep_inplace_target(const parsec_task_t *task, const parsec_dep_t *dep,
+                          const parsec_dep_type_description_t *type)
+{
+    const parsec_task_class_t *tc = task->task_class;
+    const parsec_flow_t *flow = dep->flow;
+    const parsec_dep_t *final = NULL;
+    parsec_data_copy_t *copy;
+    parsec_data_t *data;
+    int size;
+
+    if( !parsec_param_comm_inplace || (PARSEC_TASKPOOL_TYPE_PTG != task->taskpool->taskpool_type) )
+        return NULL;
+    if( !(flow->flow_flags & PARSEC_FLOW_ACCESS_WRITE) || (tc->in[0] != flow) || (NULL != tc->in[1]) )
+        return NULL;
+    for( int i = 0; (i < MAX_DEP_OUT_COUNT) && (NULL != flow->dep_out[i]); i++ ) {
+        const parsec_dep_t *out = flow->dep_out[i];
+        if( PARSEC_LOCAL_DATA_TASK_CLASS_ID != out->task_class_id ) continue;
+        if( (NULL != out->cond) && (0 == out->cond->u_expr.v_func.func.inline_func_int32(task->taskpool, task->locals)) ) continue;
+        if( (NULL != final) || (NULL == out->direct_data) || !(out->flags & PARSEC_DEP_FINAL_WRITE_AS_IS) )
+            return NULL;
+        final = out;
+    }
+    if( (NULL == final) || (NULL == (data = final->direct_data(task->taskpool, task->locals))) )
+        return NULL;
+
+    /* the data fills the tile exactly */
+    if( (NULL == type->arena) || (1 != type->dst_count) || (0 != type->dst_displ) )
+        return NULL;
+    copy = parsec_data_get_copy(data, 0);
+    if( (NULL == copy) || !remote_dep_same_layout(type->dst_datatype, copy->dtt) )
+        return NULL;
+    parsec_ce.pack_size(&parsec_ce, 1, type->dst_datatype, &size);
+    if( (size_t)size > data->nb_elts )
+        return NULL;
+
+    /* the host holds the current version, and nobody uses it */
+    if( (PARSEC_DATA_COHERENCY_INVALID == copy->coherency_state) || (0 != copy->readers) ||
+        (1 != copy->super.super.obj_reference_count) )
+        return NULL;
+    for( uint32_t i = 1; i < parsec_nb_devices; i++ ) {
+        parsec_data_copy_t *other = parsec_data_get_copy(data, i);
+        if( (NULL != other) && (PARSEC_DATA_COHERENCY_INVALID != other->coherency_state) )
+            return NULL;
+    }
+    PARSEC_OBJ_RETAIN(copy);
+    return copy;
+}
+
 /**
  * This function is called from the task successors iterator. It exists for a
  * single purpose: to retrieve the datatype involved with the operation. Thus,
@@ -766,10 +1201,14 @@ remote_dep_mpi_retrieve_datatype(parsec_execution_stream_t *eu,
         output->deps_mask &= ~(1U << dep->dep_index); /* unmark all data that are RO we already hold from previous tasks */
     } else {
         output->deps_mask |= (1U << dep->dep_index); /* mark all data that are not RO */
-        data_arena = is_inplace(oldcontext, dep);  /* Can we do it inplace */
     }
+    /* A data is received in place only by its first, and only, local successor */
+    int first = !(deps->incoming_mask & (1U << dep->dep_datatype_index));
+    if( !first && (NULL != output->data.data) )
+        PARSEC_DATA_COPY_RELEASE(output->data.data);
     output->data.data = NULL;
 
+    if( first || (output->priority < newcontext->priority) ) output->priority = newcontext->priority;
     if( deps->max_priority < newcontext->priority ) deps->max_priority = newcontext->priority;
     deps->incoming_mask |= (1U << dep->dep_datatype_index);
     deps->root           = src_rank;
@@ -808,6 +1247,8 @@ remote_dep_mpi_retrieve_datatype(parsec_execution_stream_t *eu,
                 newcontext->task_class->name, dep->dep_datatype_index, type_name_src, type_name_dst, output->data.remote.dst_datatype);
     }
 #endif
+    if( first )
+        output->data.data = remote_dep_inplace_target(newcontext, dep, &output->data.remote);
     return PARSEC_ITERATE_CONTINUE;
 }
 
@@ -923,7 +1364,7 @@ remote_dep_get_datatypes(parsec_execution_stream_t* es,
 
             origin->output[k].data.remote.src_datatype = origin->output[k].data.remote.dst_datatype = PARSEC_DATATYPE_NULL;
             assert(idx <= data_sizes[0]);
-            origin->output[k].data.remote.src_count = data_sizes[idx+1];
+            origin->output[k].data.remote.src_count = data_sizes[idx+1] & ~PARSEC_REMOTE_DEP_CONTIGUOUS_SIZE;
             PARSEC_DEBUG_VERBOSE(20, parsec_comm_output_stream,
                                  "MPI:\tRetrieve datatype with mask 0x%x (remote_dep_get_datatypes) remote size %d",
                                  local_mask, origin->output[k].data.remote.src_count);
@@ -945,6 +1386,103 @@ remote_dep_get_datatypes(parsec_execution_stream_t* es,
     return 0;
 }
 
+/* Find the accounting entry of the task class of the deps, or create it */
+static parsec_remote_dep_stats_t*
+remote_dep_stats_lookup(parsec_remote_deps_t* deps)
+{
+    const parsec_task_class_t* tc = deps->taskpool->task_classes_array[deps->msg.task_class_id];
+    parsec_remote_dep_stats_t* stats;
+
+    for( stats = remote_dep_stats[deps->from]; NULL != stats; stats = stats->next )
+        if( 0 == strcmp(stats->name, tc->name) ) return stats;
+    stats = (parsec_remote_dep_stats_t*)calloc(1, sizeof(parsec_remote_dep_stats_t));
+    stats->name = strdup(tc->name);
+    stats->peer = deps->from;
+    stats->get_to_data_min = INT64_MAX;
+    stats->next = remote_dep_stats[deps->from];
+    parsec_mfence();  /* complete the entry before a report can find it */
+    remote_dep_stats[deps->from] = stats;
+    return stats;
+}
+
+/* Account the arrival of the output k of the deps, and let the stream
+ * releasing it mark the local consumers made ready by this data */
+static void
+remote_dep_stats_arrival(parsec_execution_stream_t* es,
+                         parsec_remote_deps_t* deps,
+                         int k, size_t bytes, int eager)
+{
+    parsec_remote_dep_stats_t* stats = remote_dep_stats_lookup(deps);
+    parsec_time_t now = take_time();
+    int64_t t;
+
+    stats->nb_data++;
+    stats->bytes += bytes;
+    if( eager ) {
+        stats->nb_eager++;
+    } else {
+        t = (int64_t)diff_time(deps->activate_date, deps->output[k].get_date);
+        stats->activate_to_get += t;
+        if( t > stats->activate_to_get_max ) stats->activate_to_get_max = t;
+        t = (int64_t)diff_time(deps->output[k].get_date, now);
+        stats->get_to_data += t;
+        if( t > stats->get_to_data_max ) stats->get_to_data_max = t;
+        if( t < stats->get_to_data_min ) stats->get_to_data_min = t;
+    }
+    stats->arrival = now;
+    es->remote_stats = stats;
+}
+
+int parsec_remote_dep_stats_report(parsec_context_t* context)
+{
+    int64_t nb_data = 0, nb_gets = 0, bytes = 0, nb_consumers = 0, latency = INT64_MAX;
+    int64_t activate_to_get = 0, get_to_data = 0, data_to_start = 0;
+    const char *verdict;
+
+    for( int p = 0; p < remote_dep_stats_nb_peers; p++ ) {
+        for( parsec_remote_dep_stats_t* stats = remote_dep_stats[p]; NULL != stats; stats = stats->next ) {
+            int64_t nb_rdv = stats->nb_data - stats->nb_eager, nb_started = stats->nb_consumers;
+            if( 0 == stats->nb_data ) continue;
+            parsec_inform("Remote deps of %s from rank %d on rank %d: %lld data (%lld eager) of %lld bytes, activation to GET mean %.1f max %lld %s,"
+                          " GET to data mean %.1f max %lld %s, data to start of %lld consumers mean %.1f max %lld %s",
+                          stats->name, stats->peer, context->my_rank,
+                          (long long)stats->nb_data, (long long)stats->nb_eager, (long long)stats->bytes,
+                          (0 == nb_rdv) ? 0.0 : (double)stats->activate_to_get / (double)nb_rdv, (long long)stats->activate_to_get_max, TIMER_UNIT,
+                          (0 == nb_rdv) ? 0.0 : (double)stats->get_to_data / (double)nb_rdv, (long long)stats->get_to_data_max, TIMER_UNIT,
+                          (long long)nb_started, (0 == nb_started) ? 0.0 : (double)stats->data_to_start / (double)nb_started,
+                          (long long)stats->data_to_start_max, TIMER_UNIT);
+            nb_data += stats->nb_data;
+            nb_gets += nb_rdv;
+            bytes   += stats->bytes;
+            nb_consumers    += nb_started;
+            activate_to_get += stats->activate_to_get;
+            get_to_data     += stats->get_to_data;
+            data_to_start   += stats->data_to_start;
+            if( stats->get_to_data_min < latency ) latency = stats->get_to_data_min;
+        }
+    }
+    if( 0 == nb_data ) return PARSEC_SUCCESS;
+
+    /* The stage where the remote data spent most of their time: waiting for
+     * the communication thread to issue their GET, in flight, or waiting for
+     * a worker. The transfers are latency bound when the fastest of them,
+     * taken as the latency, accounts for most of the time in flight. */
+    if( (0 != activate_to_get) && (activate_to_get >= get_to_data) && (activate_to_get >= data_to_start) )
+        verdict = "bound by the communication thread (the activations wait for their GET)";
+    else if( data_to_start >= get_to_data )
+        verdict = "overlapped with the computation (the received data wait for a worker)";
+    else if( 2 * nb_gets * latency >= get_to_data )
+        verdict = "latency bound (the transfers take about as long as the fastest one)";
+    else
+        verdict = "bandwidth bound (the transfers take longer than the fastest one)";
+    parsec_inform("Remote deps on rank %d: %lld data (%lld GET) of %lld bytes, %lld consumers started, total activation to GET %lld %s,"
+                  " GET to data %lld %s (latency %lld %s), data to start %lld %s: %s",
+                  context->my_rank, (long long)nb_data, (long long)nb_gets, (long long)bytes, (long long)nb_consumers,
+                  (long long)activate_to_get, TIMER_UNIT, (long long)get_to_data, TIMER_UNIT,
+                  (long long)((0 == nb_gets) ? 0 : latency), TIMER_UNIT, (long long)data_to_start, TIMER_UNIT, verdict);
+    return PARSEC_SUCCESS;
+}
+
 /**
  * Trigger the local reception of a remote task data. Upon completion of all
  * pending receives related to a remote task completion, we call the
@@ -1079,13 +1617,13 @@ remote_dep_dequeue_nothread_progress(parsec_execution_stream_t* es,
 
     /* Move a number of transfers from the shared dequeue into our ordered lifo. */
     how_many = 0;
-    while( NULL != (item = (dep_cmd_item_t*) parsec_dequeue_try_pop_front(&dep_cmd_queue)) ) {
+    while( NULL != (item = remote_dep_cmd_pop()) ) {
         if( DEP_CTL == item->action ) {
             /* A DEP_CTL is a barrier that must not be crossed, flush the
              * ordered fifo and don't add anything until it is consumed */
             if( parsec_list_nolock_is_empty(&dep_cmd_fifo) && parsec_list_nolock_is_empty(&temp_list) )
                 goto handle_now;
-            parsec_dequeue_push_front(&dep_cmd_queue, (parsec_list_item_t*)item);
+            dep_cmd_held = item;
             break;
         }
         how_many++;
@@ -1276,14 +1814,13 @@ static int remote_dep_mpi_pack_dep(int peer,
     parsec_remote_deps_t *deps = (parsec_remote_deps_t*)item->cmd.activate.task.source_deps;
     remote_dep_wire_activate_t* msg = &deps->msg;
     int k, dsize, data_idx, saved_position = *position;
-    uint32_t peer_bank, peer_bit, peer_mask, expected = 0, *data_sizes;
+    uint32_t peer_pos, expected = 0, *data_sizes;
 #if defined(PARSEC_DEBUG) || defined(PARSEC_DEBUG_NOISIER)
     char tmp[MAX_TASK_STRLEN];
     remote_dep_cmd_to_string(&deps->msg, tmp, 128);
 #endif
 
-    remote_dep_rank_to_bit(peer, &peer_bank, &peer_bit, deps->root);
-    peer_mask = 1U << peer_bit;
+    peer_pos = remote_dep_rank_to_pos(peer, deps->root);
 
     /* size of the handshake header */
     parsec_ce.pack_size(&parsec_ce, dep_count, dep_dtt, &dsize);
@@ -1292,7 +1829,7 @@ static int remote_dep_mpi_pack_dep(int peer,
     /* count the number of data to prepare the space for their length */
     for(k = 0, data_idx = 0; deps->outgoing_mask >> k; k++) {
         if( !((1U << k) & deps->outgoing_mask )) continue;
-        if( !(deps->output[k].rank_bits[peer_bank] & peer_mask) ) continue;
+        if( !remote_dep_rank_set_contains(&deps->output[k].ranks, peer_pos) ) continue;
         data_idx++;
     }
     if( (length - (*position)) < (dsize + (data_idx + 1) * (int)sizeof(uint32_t)) ) {  /* no room. bail out */
@@ -1319,7 +1856,7 @@ static int remote_dep_mpi_pack_dep(int peer,
     /* Treat for special cases: CTL, Short, etc... */
     for(k = 0, data_idx = 1; deps->outgoing_mask >> k; k++) {
         if( !((1U << k) & deps->outgoing_mask )) continue;
-        if( !(deps->output[k].rank_bits[peer_bank] & peer_mask) ) continue;
+        if( !remote_dep_rank_set_contains(&deps->output[k].ranks, peer_pos) ) continue;
 
         parsec_dep_data_description_t *data_desc = &deps->output[k].data;
         parsec_dep_type_description_t *type_desc = &data_desc->remote;
@@ -1339,14 +1876,28 @@ static int remote_dep_mpi_pack_dep(int peer,
         }
 #endif
         assert(type_desc->src_count > 0);
-        /* Embed data (up to short size) with the activate msg */
+        if( NULL != deps->output[k].compressed ) {
+            /* Compressed data is always sent on demand, its size is flagged */
+            data_sizes[data_idx++] = deps->output[k].compressed_size | PARSEC_REMOTE_DEP_COMPRESSED_SIZE;
+            expected++;
+            item->cmd.activate.task.output_mask |= (1U<<k);
+            PARSEC_DEBUG_VERBOSE(10, parsec_comm_output_stream, "DATA\t%s\tparam %d\tdeps %p send on demand, compressed to %u bytes",
+                                 tmp, k, deps, deps->output[k].compressed_size);
+            continue;
+        }
+        /* Embed data (up to short size) with the activate msg. The limit of
+         * the peer is updated by the communication thread, a worker sending
+         * the activation may read the previous one. */
         parsec_ce.pack_size( &parsec_ce, type_desc->src_count, type_desc->src_datatype, &dsize);
         data_sizes[data_idx++] = dsize;
+        if( ((uint32_t)dsize < PARSEC_REMOTE_DEP_CONTIGUOUS_SIZE) &&
+            remote_dep_is_contiguous(type_desc->src_datatype, type_desc->src_count) )
+            data_sizes[data_idx-1] |= PARSEC_REMOTE_DEP_CONTIGUOUS_SIZE;
 #ifdef PARSEC_RESHAPE_BEFORE_SEND_TO_REMOTE
         /* If we want to reshape before sending, we don't do short messages. */
-        if( (deps->output[k].data.data_future == NULL) && (parsec_param_short_limit) ) {
+        if( (deps->output[k].data.data_future == NULL) && ((size_t)dsize <= remote_dep_peer_links[peer].limit) ) {
 #else
-        if( parsec_param_short_limit ) {
+        if( (size_t)dsize <= remote_dep_peer_links[peer].limit ) {
 #endif
             if((length - (*position)) >= dsize) {
                 parsec_ce.pack(&parsec_ce, ((char*)PARSEC_DATA_COPY_GET_PTR(data_desc->data)) + type_desc->src_displ,
@@ -1500,6 +2051,11 @@ static int remote_dep_nothread_send(parsec_execution_stream_t* es,
                         deps->msg, position, PARSEC_DATATYPE_PACKED);
     parsec_ce.send_am(&parsec_ce, PARSEC_CE_REMOTE_DEP_ACTIVATE_TAG, peer, packed_buffer, position);
     TAKE_TIME(es->es_profile, MPI_Activate_ek, 0);
+    if( parsec_comm_stats ) {
+        int far = remote_dep_host_of[peer] != remote_dep_host_of[es->virtual_process->parsec_context->my_rank];
+        parsec_atomic_fetch_inc_int64(&parsec_comm_host_stats[far].nb_activations);
+        parsec_atomic_fetch_add_int64(&parsec_comm_host_stats[far].activation_bytes, position);
+    }
     DEBUG_MARK_CTL_MSG_ACTIVATE_SENT(peer, (void*)&deps->msg, &deps->msg);
 
     do {
@@ -1533,15 +2089,61 @@ static int remote_dep_mpi_progress(parsec_execution_stream_t* es)
         remote_dep_mpi_get_start(es, deps);
         ret++;
     }
-    if(parsec_ce.can_serve(&parsec_ce) && !parsec_list_nolock_is_empty(&dep_put_fifo)) {
-            dep_cmd_item_t* item = (dep_cmd_item_t*)parsec_list_nolock_pop_front(&dep_put_fifo);
-        remote_dep_mpi_put_start(es, item);
-        ret++;
-    }
+    ret += remote_dep_mpi_put_schedule(es);
 
     return ret;
 }
 
+/* Size of the data sent by a put, accounted in the in-flight bytes */
+static size_t
+remote_dep_mpi_put_size(parsec_remote_deps_t* deps, remote_dep_wire_get_t* task, int k)
+{
+    int size;
+
+    if( 0 != task->size ) return task->size;
+    if( NULL != deps->output[k].compressed ) return deps->output[k].compressed_size;
+    parsec_ce.pack_size(&parsec_ce, deps->output[k].data.remote.src_count,
+                        deps->output[k].data.remote.src_datatype, &size);
+    return (size_t)size;
+}
+
+/**
+ * Start the pending puts in the order of the priority of their consumers, as
+ * long as the bytes in flight stay within the limits. A peer having reached
+ * its limit does not hold back the transfers to the other peers, but once the
+ * total limit is reached the transfers of lower priority wait as well. A
+ * transfer larger than a limit is started when nothing else is in flight.
+ *
+ * @return the number of puts started
+ */
+static int remote_dep_mpi_put_schedule(parsec_execution_stream_t* es)
+{
+    parsec_list_item_t *ring = PARSEC_LIST_ITERATOR_FIRST(&dep_put_fifo), *next;
+    int started = 0;
+
+    while( (ring != PARSEC_LIST_ITERATOR_END(&dep_put_fifo)) && parsec_ce.can_serve(&parsec_ce) ) {
+        dep_cmd_item_t* item = (dep_cmd_item_t*)ring;
+        int peer = item->cmd.activate.peer;
+        size_t bytes = item->cmd.activate.bytes;
+
+        next = PARSEC_LIST_ITERATOR_NEXT(ring);
+        if( parsec_param_comm_put_max_bytes && (0 != remote_dep_put_inflight) &&
+            (remote_dep_put_inflight + bytes > (size_t)parsec_param_comm_put_max_bytes) )
+            break;
+        if( parsec_param_comm_put_peer_max_bytes && (0 != remote_dep_put_peer_inflight[peer]) &&
+            (remote_dep_put_peer_inflight[peer] + bytes > (size_t)parsec_param_comm_put_peer_max_bytes) ) {
+            ring = next;
+            continue;
+        }
+        parsec_list_nolock_remove(&dep_put_fifo, ring);
+        if( !remote_dep_mpi_put_start(es, item) )
+            break;  /* pushed back, waiting on a reshape */
+        started++;
+        ring = next;
+    }
+    return started;
+}
+
 static int
 remote_dep_mpi_save_put_cb(parsec_comm_engine_t *ce,
                            parsec_ce_tag_t tag,
@@ -1581,26 +2183,103 @@ remote_dep_mpi_save_put_cb(parsec_comm_engine_t *ce,
     deps = (parsec_remote_deps_t*)(remote_dep_datakey_t)task->source_deps; /* get our deps back */
     assert(0 != deps->pending_ack);
     assert(0 != deps->outgoing_mask);
-    item->priority = deps->max_priority;
+    item->priority = task->priority;
+    item->cmd.activate.bytes = 0;
+    for( int k = 0; task->output_mask >> k; k++ )
+        if( (1U<<k) & task->output_mask )
+            item->cmd.activate.bytes += remote_dep_mpi_put_size(deps, task, k);
+    if( (0 == task->offset) && (task->nb_chunks > 1) ) {
+        /* The activation only accounted for one GET per output, the number
+         * of chunks being chosen by the receiver. This relies on the GET of
+         * the first chunk being handled before the GETs of the other chunks,
+         * so that no chunk can complete before they are all accounted: the
+         * receiver sends them in order (remote_dep_mpi_get_start), and the
+         * comm engine delivers the active messages of a peer in order (MPI
+         * messages do not overtake each other). An engine that reorders them
+         * must not be used with comm_put_chunk. */
+        (void)parsec_atomic_fetch_add_int32(&deps->pending_ack, (int32_t)task->nb_chunks - 1);
+    }
 
     PARSEC_DEBUG_VERBOSE(6, parsec_debug_output, "MPI: Put cb_received for %s from %d tag %u which 0x%x (deps %p)",
                 remote_dep_cmd_to_string(&deps->msg, tmp, MAX_TASK_STRLEN), item->cmd.activate.peer,
                 -1, task->output_mask, (void*)deps);
 
-    /* Get the highest priority PUT operation */
+    /* Start the highest priority PUT operations */
     parsec_list_nolock_push_sorted(&dep_put_fifo, (parsec_list_item_t*)item, dep_cmd_prio);
-    if( parsec_ce.can_serve(&parsec_ce) ) {
-        item = (dep_cmd_item_t*)parsec_list_nolock_pop_front(&dep_put_fifo);
-        remote_dep_mpi_put_start(es, item);
-    } else {
+    if( 0 == remote_dep_mpi_put_schedule(es) ) {
         PARSEC_DEBUG_VERBOSE(6, parsec_debug_output, "MPI: Put DELAYED for %s from %d tag %u which 0x%x (deps %p)",
-                remote_dep_cmd_to_string(&deps->msg, tmp, MAX_TASK_STRLEN), item->cmd.activate.peer,
+                remote_dep_cmd_to_string(&deps->msg, tmp, MAX_TASK_STRLEN), src,
                 -1, task->output_mask, (void*)deps);
     }
     return 1;
 }
 
+/* A compressed payload, or a chunk of a payload, is registered as contiguous bytes */
 static void
+remote_dep_mpi_register_bytes(void *buf, size_t size,
+                              parsec_ce_mem_reg_handle_t *handle,
+                              size_t *handle_size)
+{
+    if(parsec_ce.capabilites.supports_noncontiguous_datatype) {
+        parsec_ce.mem_register(buf, PARSEC_MEM_TYPE_NONCONTIGUOUS,
+                               size, parsec_datatype_uint8_t,
+                               -1,
+                               handle, handle_size);
+    } else {
+        parsec_ce.mem_register(buf, PARSEC_MEM_TYPE_CONTIGUOUS,
+                               -1, parsec_datatype_uint8_t,
+                               size,
+                               handle, handle_size);
+    }
+}
+
+/**
+ * Account a put that completed in duration, with ahead bytes to drain, and
+ * update the short limit of the link once its model is known: the fit of the
+ * durations gives the latency (the intercept) and the bandwidth (the inverse
+ * of the slope).
+ */
+int parsec_remote_dep_link_update(parsec_remote_dep_link_t *link, size_t ahead, double duration, size_t max_limit)
+{
+    double x = (double)ahead, mx, mt, var, slope, latency;
+    size_t limit;
+
+    link->n  = link->n  * REMOTE_DEP_LINK_DECAY + 1.0;
+    link->x  = link->x  * REMOTE_DEP_LINK_DECAY + x;
+    link->t  = link->t  * REMOTE_DEP_LINK_DECAY + duration;
+    link->xx = link->xx * REMOTE_DEP_LINK_DECAY + x * x;
+    link->xt = link->xt * REMOTE_DEP_LINK_DECAY + x * duration;
+    if( ++link->nb_puts < REMOTE_DEP_LINK_WARMUP ) return 0;
+
+    mx  = link->x / link->n;
+    mt  = link->t / link->n;
+    var = link->xx / link->n - mx * mx;
+    if( var <= 0.0001 * mx * mx ) return 0;  /* the puts are too alike to tell the latency from the bandwidth */
+    slope   = (link->xt / link->n - mx * mt) / var;
+    latency = mt - slope * mx;
+    if( (slope <= 0.0) || (latency <= 0.0) ) return 0;  /* no usable model yet */
+    link->latency   = latency;
+    link->bandwidth = 1.0 / slope;
+
+    limit = (latency / slope >= (double)max_limit) ? max_limit : (size_t)(latency / slope) & ~(size_t)7;
+    if( (limit == link->limit) ||
+        ((limit > link->limit - link->limit / 8) && (limit < link->limit + link->limit / 8)) )
+        return 0;  /* not worth a change */
+    link->limit = limit;
+    return 1;
+}
+
+static void remote_dep_link_update(int peer, size_t ahead, double duration)
+{
+    parsec_remote_dep_link_t *link = &remote_dep_peer_links[peer];
+    size_t was = link->limit;
+
+    if( parsec_remote_dep_link_update(link, ahead, duration, parsec_param_short_limit) )
+        parsec_debug_verbose(4, parsec_comm_output_stream, "MPI:\tShort limit to %d set to %zu bytes (was %zu): latency %.1f %s, %.1f bytes per %s, over %d puts",
+                             peer, link->limit, was, link->latency, TIMER_UNIT, link->bandwidth, TIMER_UNIT, link->nb_puts);
+}
+
+static int
 remote_dep_mpi_put_start(parsec_execution_stream_t* es,
                          dep_cmd_item_t* item)
 {
@@ -1650,6 +2329,9 @@ remote_dep_mpi_put_start(parsec_execution_stream_t* es,
             deps->output[k].data.data = reshape_data;
 
             PARSEC_OBJ_RETAIN(reshape_data);
+            /* the pending send is now accounted on the reshaped copy */
+            (void)parsec_atomic_fetch_inc_int32(&reshape_data->readers);
+            (void)parsec_atomic_fetch_dec_int32(&old_data->readers);
             PARSEC_DATA_COPY_RELEASE(old_data);/*old data has been retained for remote communication*/
 
             PARSEC_OBJ_RELEASE(deps->output[k].data.data_future);
@@ -1663,7 +2345,7 @@ remote_dep_mpi_put_start(parsec_execution_stream_t* es,
     if( ! all_completed ) {
         PARSEC_DEBUG_VERBOSE(4, parsec_comm_output_stream, "MPI:\tReshaping promises not yet completed for deps 0x%lx. Reschedule.", deps);
         parsec_list_nolock_push_front(&dep_put_fifo, (parsec_list_item_t*)item);
-        return;
+        return 0;
     }
 #endif
 
@@ -1681,9 +2363,19 @@ remote_dep_mpi_put_start(parsec_execution_stream_t* es,
         task->output_mask ^= (1U<<k);
 
         parsec_ce_mem_reg_handle_t source_memory_handle;
-        size_t source_memory_handle_size;
-
-        if(parsec_ce.capabilites.supports_noncontiguous_datatype) {
+        size_t source_memory_handle_size, size = remote_dep_mpi_put_size(deps, task, k);
+
+        if( 0 != task->size ) {
+            /* a chunk of the contiguous (or compressed) payload */
+            char *base = (NULL != deps->output[k].compressed) ? (char*)deps->output[k].compressed
+                                                             : (char*)dataptr + deps->output[k].data.remote.src_displ;
+            remote_dep_mpi_register_bytes(base + task->offset, task->size,
+                                          &source_memory_handle, &source_memory_handle_size);
+            parsec_comm_put_stats.nb_chunks++;
+        } else if( NULL != deps->output[k].compressed ) {
+            remote_dep_mpi_register_bytes(deps->output[k].compressed, deps->output[k].compressed_size,
+                                          &source_memory_handle, &source_memory_handle_size);
+        } else if(parsec_ce.capabilites.supports_noncontiguous_datatype) {
             parsec_ce.mem_register(dataptr, PARSEC_MEM_TYPE_NONCONTIGUOUS,
                                    nbdtt, dtt,
                                    -1,
@@ -1713,6 +2405,18 @@ remote_dep_mpi_put_start(parsec_execution_stream_t* es,
                                             (parsec_remote_dep_cb_data_mempool->thread_mempools);
         cb_data->deps  = deps;
         cb_data->k     = k;
+        cb_data->peer  = item->cmd.activate.peer;
+        cb_data->size  = size;
+        cb_data->ahead = remote_dep_put_peer_inflight[cb_data->peer] + size;
+        if( parsec_param_comm_short_adaptive )
+            cb_data->start = take_time();
+        remote_dep_put_inflight += size;
+        remote_dep_put_peer_inflight[cb_data->peer] += size;
+        if( (int64_t)remote_dep_put_inflight > parsec_comm_put_stats.max_inflight )
+            parsec_comm_put_stats.max_inflight = (int64_t)remote_dep_put_inflight;
+        parsec_comm_put_stats.nb_puts++;
+        if( parsec_comm_stats )
+            parsec_comm_host_stats[remote_dep_host_of[cb_data->peer] != remote_dep_host_of[es->virtual_process->parsec_context->my_rank]].data_bytes += size;
 
 #if defined(PARSEC_PROF_TRACE)
         uint64_t event_id = remote_dep_mpi_profiling_event_id();
@@ -1739,6 +2443,7 @@ remote_dep_mpi_put_start(parsec_execution_stream_t* es,
         }
         free(item);
     }
+    return 1;
 }
 
 static int
@@ -1763,6 +2468,11 @@ remote_dep_mpi_put_end_cb(parsec_comm_engine_t *ce,
               ((remote_dep_cb_data_t *)cb_data)->event_id);
 #endif /* PARSEC_PROF_TRACE */
 
+    if( parsec_param_comm_short_adaptive )
+        remote_dep_link_update(((remote_dep_cb_data_t *)cb_data)->peer, ((remote_dep_cb_data_t *)cb_data)->ahead,
+                               (double)diff_time(((remote_dep_cb_data_t *)cb_data)->start, take_time()));
+    remote_dep_put_inflight -= ((remote_dep_cb_data_t *)cb_data)->size;
+    remote_dep_put_peer_inflight[((remote_dep_cb_data_t *)cb_data)->peer] -= ((remote_dep_cb_data_t *)cb_data)->size;
     remote_dep_complete_and_cleanup(&deps, 1);
 
     ce->mem_unregister(&lreg);
@@ -1790,7 +2500,7 @@ static void remote_dep_mpi_recv_activate(parsec_execution_stream_t* es,
     (void) packed_buffer;
     remote_dep_datakey_t complete_mask = 0;
     int k, dsize, ds_idx;
-    uint32_t *data_sizes = (uint32_t*)(packed_buffer + *position);
+    uint32_t size, *data_sizes = (uint32_t*)(packed_buffer + *position);
 #if defined(PARSEC_DEBUG) || defined(PARSEC_DEBUG_NOISIER)
     char tmp[MAX_TASK_STRLEN];
     remote_dep_cmd_to_string(&deps->msg, tmp, MAX_TASK_STRLEN);
@@ -1826,46 +2536,61 @@ static void remote_dep_mpi_recv_activate(parsec_execution_stream_t* es,
 
         ds_idx++;
 
+        deps->output[k].contiguous_size = 0;
+        if( data_sizes[ds_idx] & PARSEC_REMOTE_DEP_COMPRESSED_SIZE ) {
+            deps->output[k].compressed_size = data_sizes[ds_idx] & ~PARSEC_REMOTE_DEP_COMPRESSED_SIZE;
+            PARSEC_DEBUG_VERBOSE(10, parsec_comm_output_stream, "MPI:\tFROM\t%d\tGet DATA\t% -8s\tk=%d\twith datakey %lx compressed to %u bytes (to be posted)",
+                                 deps->from, tmp, k, deps->msg.deps, deps->output[k].compressed_size);
+            continue;
+        }
+
+        size = data_sizes[ds_idx] & ~PARSEC_REMOTE_DEP_CONTIGUOUS_SIZE;
+        if( data_sizes[ds_idx] & PARSEC_REMOTE_DEP_CONTIGUOUS_SIZE )
+            deps->output[k].contiguous_size = size;
+
         if( parsec_param_short_limit && (length > *position) ) {
             parsec_ce.pack_size( &parsec_ce, 1, type_desc->dst_datatype, &dsize);  /* for a single type */
-            if( (type_desc->dst_count * dsize) != data_sizes[ds_idx] ) {
+            if( (type_desc->dst_count * dsize) != size ) {
                 /* We only receive the minimum between expected and sent, potentially converting to byte */
-                int count_in_msg = data_sizes[ds_idx] / dsize;
-                if( (dsize * type_desc->dst_count) > data_sizes[ds_idx] ) {
-                    if( data_sizes[ds_idx] % dsize ) {
+                int count_in_msg = size / dsize;
+                if( (dsize * type_desc->dst_count) > size ) {
+                    if( size % dsize ) {
                         type_desc->dst_datatype = parsec_datatype_int8_t;
-                        count_in_msg = data_sizes[ds_idx];
+                        count_in_msg = size;
                     }
                 } else {
                     count_in_msg = type_desc->dst_count;
-                    if( data_sizes[ds_idx] % dsize ) {
+                    if( size % dsize ) {
                         type_desc->dst_datatype = parsec_datatype_int8_t;
                         count_in_msg = dsize * type_desc->dst_count;
                     }
                 }
                 type_desc->dst_count = count_in_msg;  /* update the count */
+                if( NULL != data_desc->data ) {  /* the tile would be partially overwritten */
+                    PARSEC_DATA_COPY_RELEASE(data_desc->data);
+                    data_desc->data = NULL;
+                }
                 PARSEC_DEBUG_VERBOSE(0, parsec_comm_output_stream,
                                      " EGR\t%s\tparam %d\treceive does not match the expected type and count (leftover %d)."
                                      " Convert to byte and receive as much as possible.\n",
-                                     tmp, k, data_sizes[ds_idx] % dsize);
+                                     tmp, k, size % dsize);
             }
 
             /* Check if the data is short-embedded in the activate */
-            if((length - (*position)) >= (int)data_sizes[ds_idx]) {
-                assert(NULL == data_desc->data); /* we do not support in-place tiles now, make sure it doesn't happen yet */
-                if(NULL == data_desc->data) {
-                    data_desc->data = remote_dep_copy_allocate(type_desc);
-                }
+            if((length - (*position)) >= (int)size) {
+                data_desc->data = remote_dep_copy_prepare(data_desc);
 #ifndef PARSEC_PROF_DRY_DEP
                 PARSEC_DEBUG_VERBOSE(10, parsec_comm_output_stream,
                                      " EGR\t%s\tparam %d\tshort from the activate msg (exp/rcv/avail) (%d/%d/%d)",
-                                     tmp, k, type_desc->dst_count * dsize, data_sizes[ds_idx], length - *position);
+                                     tmp, k, type_desc->dst_count * dsize, size, length - *position);
                 int save_position = *position;  /* save the position */
-                parsec_ce.unpack(&parsec_ce, packed_buffer, *position + data_sizes[ds_idx], position,
+                parsec_ce.unpack(&parsec_ce, packed_buffer, *position + size, position,
                                  (char*)PARSEC_DATA_COPY_GET_PTR(data_desc->data) + type_desc->dst_displ,
                                  type_desc->dst_count, type_desc->dst_datatype);
-                *position = save_position + data_sizes[ds_idx];  /* jump the entire short data */
+                *position = save_position + size;  /* jump the entire short data */
 #endif  /* PARSEC_PROF_DRY_DEP */
+                if( parsec_comm_stats )
+                    remote_dep_stats_arrival(es, deps, k, size, 1);
                 complete_mask |= (1U<<k);
                 continue;
             }
@@ -1886,6 +2611,7 @@ static void remote_dep_mpi_recv_activate(parsec_execution_stream_t* es,
 #endif
         /* If this is the only call then force the remote deps propagation */
         deps = remote_dep_release_incoming(es, deps, complete_mask);
+        es->remote_stats = NULL;
     }
 
     /* Store the request in the rdv queue if any unsatisfied dep exist at this point */
@@ -1919,6 +2645,8 @@ remote_dep_mpi_save_activate_cb(parsec_comm_engine_t *ce, parsec_ce_tag_t tag,
 
     while(position < length) {
         deps = remote_deps_allocate(&parsec_remote_dep_context.freelist);
+        if( parsec_comm_stats )
+            deps->activate_date = take_time();
 
         ce->unpack(ce, msg, length, &position, &deps->msg, dep_count, dep_dtt);
         deps->from = src;
@@ -2039,123 +2767,181 @@ remote_dep_mpi_release_delayed_deps(parsec_execution_stream_t* es,
     PARSEC_PINS(es, ACTIVATE_CB_END, NULL);
 }
 
-static void remote_dep_mpi_get_start(parsec_execution_stream_t* es,
-                                     parsec_remote_deps_t* deps)
+/* Size of the payload of an output if it can be received in chunks of
+ * contiguous bytes, or 0 */
+static size_t remote_dep_mpi_chunkable_size(struct remote_dep_output_param_s* output)
+{
+    parsec_dep_type_description_t *type_desc = &output->data.remote;
+    int size;
+
+    if( 0 != output->compressed_size ) return output->compressed_size;
+    if( (0 == output->contiguous_size) ||
+        !remote_dep_is_contiguous(type_desc->dst_datatype, type_desc->dst_count) )
+        return 0;
+    parsec_ce.pack_size(&parsec_ce, type_desc->dst_count, type_desc->dst_datatype, &size);
+    return ((uint32_t)size == output->contiguous_size) ? (size_t)size : 0;
+}
+
+/* Ask the source for the output k, or for the chunk of msg->size bytes at
+ * msg->offset of its payload if msg->size is not 0 */
+static void remote_dep_mpi_get_post(parsec_execution_stream_t* es,
+                                    parsec_remote_deps_t* deps, int k,
+                                    remote_dep_wire_get_t* msg)
 {
     remote_dep_wire_activate_t* task = &(deps->msg);
-    int from = deps->from, k, count, nbdtt;
-    remote_dep_wire_get_t msg;
+    int from = deps->from, nbdtt;
     MPI_Datatype dtt;
 #if defined(PARSEC_DEBUG_NOISIER)
     char tmp[MAX_TASK_STRLEN], type_name[MPI_MAX_OBJECT_NAME];
     int len;
     remote_dep_cmd_to_string(task, tmp, MAX_TASK_STRLEN);
 #endif
-    for(k = count = 0; deps->incoming_mask >> k; k++)
-        if( ((1U<<k) & deps->incoming_mask) ) count++;
 
-    (void)es;
-    DEBUG_MARK_CTL_MSG_ACTIVATE_RECV(from, (void*)task, task);
+    msg->output_mask = (1U<<k);  /* Only get what I need */
 
-    msg.source_deps = task->deps; /* the deps copied from activate message from source */
-    msg.callback_fn = (uintptr_t)remote_dep_mpi_get_end_cb; /* We let the source know to call this
-                                                             * function when the PUT is over, in a true
-                                                             * one sided case the (integer) value of this
-                                                             * function pointer will be registered as the
-                                                             * TAG to receive the same notification. */
-
-    for(k = 0; deps->incoming_mask >> k; k++) {
-        if( !((1U<<k) & deps->incoming_mask) ) continue;
-        msg.output_mask = 0;  /* Only get what I need */
-        msg.output_mask |= (1U<<k);
-
-        /* We pack the callback data that should be passed to us when the other side
-         * notifies us to invoke the callback_fn we have assigned above
-         */
-        remote_dep_cb_data_t *callback_data = (remote_dep_cb_data_t *) parsec_thread_mempool_allocate
-                                                    (parsec_remote_dep_cb_data_mempool->thread_mempools);
-        callback_data->deps = deps;
-        callback_data->k    = k;
-
-        /* prepare the local receiving data */
-        assert(NULL == deps->output[k].data.data); /* we do not support in-place tiles now, make sure it doesn't happen yet */
-        if(NULL == deps->output[k].data.data) {
-            deps->output[k].data.data = remote_dep_copy_allocate(&deps->output[k].data.remote);
-        }
-        dtt   = deps->output[k].data.remote.dst_datatype;
-        nbdtt = deps->output[k].data.remote.dst_count;
+    /* We pack the callback data that should be passed to us when the other side
+     * notifies us to invoke the callback_fn we have assigned above
+     */
+    remote_dep_cb_data_t *callback_data = (remote_dep_cb_data_t *) parsec_thread_mempool_allocate
+                                                (parsec_remote_dep_cb_data_mempool->thread_mempools);
+    callback_data->deps = deps;
+    callback_data->k    = k;
 
-        /* We have the remote mem_handle.
-         * Let's allocate our mem_reg_handle
-         * and let the source know.
-         */
-        parsec_ce_mem_reg_handle_t receiver_memory_handle;
-        size_t receiver_memory_handle_size;
+    dtt   = deps->output[k].data.remote.dst_datatype;
+    nbdtt = deps->output[k].data.remote.dst_count;
 
-        if(parsec_ce.capabilites.supports_noncontiguous_datatype) {
-            parsec_ce.mem_register(PARSEC_DATA_COPY_GET_PTR(deps->output[k].data.data), PARSEC_MEM_TYPE_NONCONTIGUOUS,
-                                   nbdtt, dtt,
-                                   -1,
-                                   &receiver_memory_handle, &receiver_memory_handle_size);
-        } else {
-            /* TODO: Implement converter to pack and unpack
-             * register the whole region including the holes because we don't support sparse
-             * registration. */
-            ptrdiff_t extent, lb;
-            parsec_type_extent(dtt, &lb, &extent); (void)lb;
-            parsec_ce.mem_register(PARSEC_DATA_COPY_GET_PTR(deps->output[k].data.data), PARSEC_MEM_TYPE_CONTIGUOUS,
-                                   -1, parsec_datatype_uint8_t,
-                                   nbdtt * extent,
-                                   &receiver_memory_handle, &receiver_memory_handle_size);
+    /* We have the remote mem_handle.
+     * Let's allocate our mem_reg_handle
+     * and let the source know.
+     */
+    parsec_ce_mem_reg_handle_t receiver_memory_handle;
+    size_t receiver_memory_handle_size;
+
+    if( 0 != msg->size ) {
+        /* a chunk of the contiguous (or compressed) payload */
+        char *base = (0 != deps->output[k].compressed_size) ? (char*)deps->output[k].compressed
+                   : (char*)PARSEC_DATA_COPY_GET_PTR(deps->output[k].data.data) + deps->output[k].data.remote.dst_displ;
+        remote_dep_mpi_register_bytes(base + msg->offset, msg->size,
+                                      &receiver_memory_handle, &receiver_memory_handle_size);
+    } else if( 0 != deps->output[k].compressed_size ) {
+        remote_dep_mpi_register_bytes(deps->output[k].compressed, deps->output[k].compressed_size,
+                                      &receiver_memory_handle, &receiver_memory_handle_size);
+    } else if(parsec_ce.capabilites.supports_noncontiguous_datatype) {
+        parsec_ce.mem_register(PARSEC_DATA_COPY_GET_PTR(deps->output[k].data.data), PARSEC_MEM_TYPE_NONCONTIGUOUS,
+                               nbdtt, dtt,
+                               -1,
+                               &receiver_memory_handle, &receiver_memory_handle_size);
+    } else {
+        /* TODO: Implement converter to pack and unpack
+         * register the whole region including the holes because we don't support sparse
+         * registration. */
+        ptrdiff_t extent, lb;
+        parsec_type_extent(dtt, &lb, &extent); (void)lb;
+        parsec_ce.mem_register(PARSEC_DATA_COPY_GET_PTR(deps->output[k].data.data), PARSEC_MEM_TYPE_CONTIGUOUS,
+                               -1, parsec_datatype_uint8_t,
+                               nbdtt * extent,
+                               &receiver_memory_handle, &receiver_memory_handle_size);
 
-        }
+    }
 
 #  if defined(PARSEC_DEBUG_NOISIER)
-        MPI_Type_get_name(dtt, type_name, &len);
-        int _size;
-        MPI_Type_size(dtt, &_size);
-        PARSEC_DEBUG_VERBOSE(10, parsec_debug_output, "MPI:\tTO\t%d\tGet START\t% -8s\tk=%d\twith datakey %lx at %p type %s count %d displ %ld \t(k=%d, dst_mem_handle=%p)",
-                from, tmp, k, task->deps, PARSEC_DATA_COPY_GET_PTR(deps->output[k].data.data), type_name, nbdtt,
-                deps->output[k].data.remote.dst_displ, k, receiver_memory_handle);
+    MPI_Type_get_name(dtt, type_name, &len);
+    int _size;
+    MPI_Type_size(dtt, &_size);
+    PARSEC_DEBUG_VERBOSE(10, parsec_debug_output, "MPI:\tTO\t%d\tGet START\t% -8s\tk=%d\twith datakey %lx at %p type %s count %d displ %ld \t(k=%d, dst_mem_handle=%p)",
+            from, tmp, k, task->deps, PARSEC_DATA_COPY_GET_PTR(deps->output[k].data.data), type_name, nbdtt,
+            deps->output[k].data.remote.dst_displ, k, receiver_memory_handle);
 #  endif
 
-        callback_data->memory_handle = receiver_memory_handle;
+    callback_data->memory_handle = receiver_memory_handle;
 
-        /* We need multiple information to be passed to the callback_fn we have assigned above.
-         * We pack the pointer to this callback_data and pass to the other side so we can complete
-         * cleanup and take necessary action when the data is available on our side */
-        msg.remote_callback_data = (remote_dep_datakey_t)callback_data;
+    /* We need multiple information to be passed to the callback_fn we have assigned above.
+     * We pack the pointer to this callback_data and pass to the other side so we can complete
+     * cleanup and take necessary action when the data is available on our side */
+    msg->remote_callback_data = (remote_dep_datakey_t)callback_data;
 
-        /* We pack the static message(remote_dep_wire_get_t) and our memory_handle and send this message
-         * to the source. Source is anticipating this exact configuration.
-         */
-        int buf_size = sizeof(remote_dep_wire_get_t) + receiver_memory_handle_size;
-        void *buf = malloc(buf_size);
-        memcpy( buf,
-                &msg,
-                sizeof(remote_dep_wire_get_t) );
-        memcpy( ((char*)buf) +  sizeof(remote_dep_wire_get_t),
-                receiver_memory_handle,
-                receiver_memory_handle_size );
+    /* We pack the static message(remote_dep_wire_get_t) and our memory_handle and send this message
+     * to the source. Source is anticipating this exact configuration.
+     */
+    int buf_size = sizeof(remote_dep_wire_get_t) + receiver_memory_handle_size;
+    void *buf = malloc(buf_size);
+    memcpy( buf,
+            msg,
+            sizeof(remote_dep_wire_get_t) );
+    memcpy( ((char*)buf) +  sizeof(remote_dep_wire_get_t),
+            receiver_memory_handle,
+            receiver_memory_handle_size );
 
 #if defined(PARSEC_PROF_TRACE)
-        uint64_t event_id = remote_dep_mpi_profiling_event_id();
-        callback_data->event_id = event_id;
+    uint64_t event_id = remote_dep_mpi_profiling_event_id();
+    callback_data->event_id = event_id;
 #endif /* PARSEC_PROF_TRACE */
 
-        /* Send AM */
-        TAKE_TIME_WITH_INFO(es->es_profile, MPI_Data_pldr_sk, event_id, k,
-                            from, es->virtual_process->parsec_context->my_rank,
-                            *task, nbdtt, dtt);
-        TAKE_TIME_WITH_INFO(es->es_profile, MPI_Data_ctl_sk, event_id, k,
-                            from, es->virtual_process->parsec_context->my_rank,
-                            *task, nbdtt, dtt);
-        parsec_ce.send_am(&parsec_ce, PARSEC_CE_REMOTE_DEP_GET_DATA_TAG, from, buf, buf_size);
-        TAKE_TIME(es->es_profile, MPI_Data_ctl_ek, event_id);
+    /* Send AM */
+    TAKE_TIME_WITH_INFO(es->es_profile, MPI_Data_pldr_sk, event_id, k,
+                        from, es->virtual_process->parsec_context->my_rank,
+                        *task, nbdtt, dtt);
+    TAKE_TIME_WITH_INFO(es->es_profile, MPI_Data_ctl_sk, event_id, k,
+                        from, es->virtual_process->parsec_context->my_rank,
+                        *task, nbdtt, dtt);
+    parsec_ce.send_am(&parsec_ce, PARSEC_CE_REMOTE_DEP_GET_DATA_TAG, from, buf, buf_size);
+    TAKE_TIME(es->es_profile, MPI_Data_ctl_ek, event_id);
 
-        free(buf);
+    free(buf);
+
+    parsec_comm_gets++;
+    (void)es; (void)task;
+}
 
-        parsec_comm_gets++;
+static void remote_dep_mpi_get_start(parsec_execution_stream_t* es,
+                                     parsec_remote_deps_t* deps)
+{
+    remote_dep_wire_activate_t* task = &(deps->msg);
+    int from = deps->from, k;
+    size_t bytes, chunk = (size_t)parsec_param_comm_put_chunk;
+    remote_dep_wire_get_t msg;
+
+    (void)es; (void)from;
+    DEBUG_MARK_CTL_MSG_ACTIVATE_RECV(from, (void*)task, task);
+
+    msg.source_deps = task->deps; /* the deps copied from activate message from source */
+    msg.callback_fn = (uintptr_t)remote_dep_mpi_get_end_cb; /* We let the source know to call this
+                                                             * function when the PUT is over, in a true
+                                                             * one sided case the (integer) value of this
+                                                             * function pointer will be registered as the
+                                                             * TAG to receive the same notification. */
+
+    for(k = 0; deps->incoming_mask >> k; k++) {
+        if( !((1U<<k) & deps->incoming_mask) ) continue;
+
+        /* prepare the local receiving data */
+        deps->output[k].data.data = remote_dep_copy_prepare(&deps->output[k].data);
+        if( 0 != deps->output[k].compressed_size ) {
+            /* receive in a staging buffer, decompressed in remote_dep_mpi_get_end */
+            deps->output[k].compressed = malloc(deps->output[k].compressed_size);
+        }
+        /* the source starts the transfers in the order of the priority of their consumer */
+        msg.priority  = deps->output[k].priority;
+        msg.nb_chunks = 1;
+        msg.offset    = 0;
+        msg.size      = 0;
+        bytes = remote_dep_mpi_chunkable_size(&deps->output[k]);
+        if( (0 != chunk) && (bytes > chunk) )
+            msg.nb_chunks = (uint32_t)((bytes + chunk - 1) / chunk);
+        deps->output[k].pending_chunks = msg.nb_chunks;
+        if( parsec_comm_stats )
+            deps->output[k].get_date = take_time();
+        if( 1 == msg.nb_chunks ) {
+            remote_dep_mpi_get_post(es, deps, k, &msg);
+            continue;
+        }
+        /* Large payloads are requested in chunks, in order: the source
+         * schedules each of them, letting higher priority transfers overtake
+         * the remaining chunks */
+        for( msg.offset = 0; msg.offset < bytes; msg.offset += msg.size ) {
+            msg.size = ((bytes - msg.offset) < chunk) ? (bytes - msg.offset) : chunk;
+            remote_dep_mpi_get_post(es, deps, k, &msg);
+        }
     }
 }
 
@@ -2163,8 +2949,40 @@ static void remote_dep_mpi_get_end(parsec_execution_stream_t* es,
                                    int idx,
                                    parsec_remote_deps_t* deps)
 {
+    struct remote_dep_output_param_s *output = &deps->output[idx];
+
+    if( parsec_comm_stats ) {
+        int size = (int)output->compressed_size;
+        if( 0 == size )
+            parsec_ce.pack_size(&parsec_ce, output->data.remote.dst_count, output->data.remote.dst_datatype, &size);
+        remote_dep_stats_arrival(es, deps, idx, (size_t)size, 0);
+    }
+    if( NULL != output->compressed ) {
+        parsec_dep_type_description_t *type_desc = &output->data.remote;
+        char *dst = (char*)PARSEC_DATA_COPY_GET_PTR(output->data.data) + type_desc->dst_displ;
+        int size, position = 0;
+        char *packed;
+
+        parsec_ce.pack_size(&parsec_ce, type_desc->dst_count, type_desc->dst_datatype, &size);
+        packed = (char*)malloc(size);
+        if( PARSEC_SUCCESS != parsec_decompress(output->compressed, output->compressed_size, packed, size) ) {
+            parsec_fatal("The compressed payload of output %d received from %d (%u bytes) does not expand to %d bytes",
+                         idx, deps->from, output->compressed_size, size);
+        }
+        if( PARSEC_SUCCESS != parsec_type_unpack(packed, size, &position, dst,
+                                                 (int)type_desc->dst_count, type_desc->dst_datatype) ) {
+            position = 0;
+            parsec_ce.unpack(&parsec_ce, packed, size, &position, dst,
+                             type_desc->dst_count, type_desc->dst_datatype);
+        }
+        free(packed);
+        free(output->compressed);
+        output->compressed = NULL;
+        output->compressed_size = 0;
+    }
     /* The ref on the data will be released below */
     remote_dep_release_incoming(es, deps, (1U<<idx));
+    es->remote_stats = NULL;
 }
 
 static int
@@ -2197,7 +3015,9 @@ remote_dep_mpi_get_end_cb(parsec_comm_engine_t *ce,
 #if defined(PARSEC_PROF_TRACE)
     TAKE_TIME(es->es_profile, MPI_Data_pldr_ek, callback_data->event_id);
 #endif /* PARSEC_PROF_TRACE */
-    remote_dep_mpi_get_end(es, callback_data->k, deps);
+    /* the data is complete with its last chunk */
+    if( 0 == --deps->output[callback_data->k].pending_chunks )
+        remote_dep_mpi_get_end(es, callback_data->k, deps);
 
     parsec_ce.mem_unregister(&callback_data->memory_handle);
     parsec_thread_mempool_free(parsec_remote_dep_cb_data_mempool->thread_mempools, callback_data);
@@ -2229,6 +3049,24 @@ int remote_dep_ce_reconfigure(parsec_context_t* context)
      */
     remote_deps_allocation_init(context->nb_nodes, MAX_PARAM_COUNT);
 
+    free(remote_dep_put_peer_inflight);
+    remote_dep_put_peer_inflight = (size_t*)calloc(context->nb_nodes, sizeof(size_t));
+    remote_dep_put_inflight = 0;
+
+    /* all the peers start with the configured short limit */
+    free(remote_dep_peer_links);
+    remote_dep_peer_links = (parsec_remote_dep_link_t*)calloc(context->nb_nodes, sizeof(parsec_remote_dep_link_t));
+    for( int p = 0; p < context->nb_nodes; p++ )
+        remote_dep_peer_links[p].limit = parsec_param_short_limit;
+
+    if( context->nb_nodes > remote_dep_stats_nb_peers ) {
+        /* keep the accounting of the peers already known */
+        remote_dep_stats = (parsec_remote_dep_stats_t**)realloc(remote_dep_stats, context->nb_nodes * sizeof(parsec_remote_dep_stats_t*));
+        memset(remote_dep_stats + remote_dep_stats_nb_peers, 0,
+               (context->nb_nodes - remote_dep_stats_nb_peers) * sizeof(parsec_remote_dep_stats_t*));
+        remote_dep_stats_nb_peers = context->nb_nodes;
+    }
+
     parsec_mpi_same_pos_items_size = context->nb_nodes + (int)DEP_LAST;
     assert( NULL == parsec_mpi_same_pos_items );
     parsec_mpi_same_pos_items = (dep_cmd_item_t**)calloc(parsec_mpi_same_pos_items_size,
@@ -2285,6 +3123,57 @@ int remote_dep_ce_fini(parsec_context_t* context)
     (void)context;
     remote_dep_mpi_profiling_fini();
 
+    if( parsec_comm_compress_stats.nb_data > 0 ) {
+        parsec_inform("Compression of remote transfers: %lld of %lld data compressed, %lld bytes sent as %lld (ratio %.2f),"
+                      " %lld %s spent compressing",
+                      (long long)parsec_comm_compress_stats.nb_sent, (long long)parsec_comm_compress_stats.nb_data,
+                      (long long)parsec_comm_compress_stats.raw_bytes, (long long)parsec_comm_compress_stats.sent_bytes,
+                      (double)parsec_comm_compress_stats.raw_bytes / (double)parsec_comm_compress_stats.sent_bytes,
+                      (long long)parsec_comm_compress_stats.time, TIMER_UNIT);
+        memset(&parsec_comm_compress_stats, 0, sizeof(parsec_comm_compress_stats));
+    }
+    if( parsec_comm_inplace_stats.nb_data > 0 ) {
+        parsec_inform("In-place reception of remote transfers: %lld data received in their destination tile, %lld bytes of copies avoided",
+                      (long long)parsec_comm_inplace_stats.nb_data, (long long)parsec_comm_inplace_stats.bytes);
+        memset(&parsec_comm_inplace_stats, 0, sizeof(parsec_comm_inplace_stats));
+    }
+    if( parsec_comm_put_stats.nb_chunks > 0 ) {
+        parsec_inform("Scheduling of remote transfers: %lld puts started, %lld of them chunks of a larger data, at most %lld bytes in flight",
+                      (long long)parsec_comm_put_stats.nb_puts, (long long)parsec_comm_put_stats.nb_chunks,
+                      (long long)parsec_comm_put_stats.max_inflight);
+    }
+    memset(&parsec_comm_put_stats, 0, sizeof(parsec_comm_put_stats));
+    if( parsec_comm_stats && (remote_dep_nb_hosts > 1) &&
+        ((parsec_comm_host_stats[0].nb_activations + parsec_comm_host_stats[1].nb_activations) > 0) ) {
+        int64_t inside = parsec_comm_host_stats[0].activation_bytes + parsec_comm_host_stats[0].data_bytes;
+        int64_t between = parsec_comm_host_stats[1].activation_bytes + parsec_comm_host_stats[1].data_bytes;
+        parsec_inform("Traffic of rank %d on host %d of %d: inside the host %lld activations of %lld bytes and %lld bytes of data,"
+                      " to the other hosts %lld activations of %lld bytes and %lld bytes of data (%.1f%% of the bytes between hosts)",
+                      context->my_rank, remote_dep_host_of[context->my_rank], remote_dep_nb_hosts,
+                      (long long)parsec_comm_host_stats[0].nb_activations, (long long)parsec_comm_host_stats[0].activation_bytes,
+                      (long long)parsec_comm_host_stats[0].data_bytes,
+                      (long long)parsec_comm_host_stats[1].nb_activations, (long long)parsec_comm_host_stats[1].activation_bytes,
+                      (long long)parsec_comm_host_stats[1].data_bytes,
+                      100.0 * (double)between / (double)(inside + between));
+    }
+    memset(parsec_comm_host_stats, 0, sizeof(parsec_comm_host_stats));
+    free(remote_dep_host_of); remote_dep_host_of = NULL;
+    free(remote_dep_host_order); remote_dep_host_order = NULL;
+    free(remote_dep_host_index_of); remote_dep_host_index_of = NULL;
+    remote_dep_nb_hosts = remote_dep_ranks_per_host = 1;
+    if( parsec_comm_stats )
+        parsec_remote_dep_stats_report(context);
+    for( int p = 0; p < remote_dep_stats_nb_peers; p++ ) {
+        parsec_remote_dep_stats_t *stats;
+        while( NULL != (stats = remote_dep_stats[p]) ) {
+            remote_dep_stats[p] = stats->next;
+            free(stats->name);
+            free(stats);
+        }
+    }
+    free(remote_dep_stats); remote_dep_stats = NULL;
+    remote_dep_stats_nb_peers = 0;
+
     // Unregister tags
     parsec_ce.tag_unregister(PARSEC_CE_REMOTE_DEP_ACTIVATE_TAG);
     parsec_ce.tag_unregister(PARSEC_CE_REMOTE_DEP_GET_DATA_TAG);
@@ -2298,6 +3187,20 @@ int remote_dep_ce_fini(parsec_context_t* context)
         free(parsec_mpi_same_pos_items); parsec_mpi_same_pos_items = NULL;
         parsec_mpi_same_pos_items_size = 0;
     }
+    free(remote_dep_put_peer_inflight); remote_dep_put_peer_inflight = NULL;
+    if( NULL != remote_dep_peer_links ) {
+        if( parsec_param_comm_short_adaptive && (parsec_comm_verbose >= 3) ) {
+            char limits[1024];
+            int len = 0;
+            for( int p = 0; (p < context->nb_nodes) && (len < (int)sizeof(limits) - 32); p++ ) {
+                if( p == context->my_rank ) continue;
+                len += snprintf(limits + len, sizeof(limits) - len, " %d:%zu", p, remote_dep_peer_links[p].limit);
+            }
+            parsec_debug_verbose(3, parsec_comm_output_stream, "MPI:\tShort limits by peer (configured %zu bytes):%s%s",
+                                 parsec_param_short_limit, limits, (len >= (int)sizeof(limits) - 32) ? " ..." : "");
+        }
+        free(remote_dep_peer_links); remote_dep_peer_links = NULL;
+    }
 
     PARSEC_OBJ_DESTRUCT(&dep_activates_fifo);
     PARSEC_OBJ_DESTRUCT(&dep_activates_noobj_fifo);
@@ -27,6 +27,10 @@
 #include "parsec/utils/debug.h"
 #include "parsec/dictionary.h"
 #include "parsec/utils/backoff.h"
+#include "parsec/parking_lot.h"
+#if defined(PARSEC_SIM)
+#include "parsec/parsec_sim.h"
+#endif  /* defined(PARSEC_SIM) */
 
 #include <signal.h>
 #if defined(PARSEC_HAVE_STRING_H)
@@ -149,6 +153,9 @@ int __parsec_execute( parsec_execution_stream_t* es,
 
     parsec_hook_t *hook = tc->incarnations[task->selected_chore].hook;
     assert( NULL != hook );
+#if defined(PARSEC_SIM)
+    parsec_sim_task(es, task);
+#endif  /* defined(PARSEC_SIM) */
     PARSEC_PINS(es, EXEC_BEGIN, task);
     rc = hook( es, task );
 #if defined(PARSEC_PROF_TRACE)
@@ -195,13 +202,250 @@ void parsec_taskpool_termination_detected(parsec_taskpool_t *tp)
     if( NULL != tp->on_complete ) {
         (void)tp->on_complete( tp, tp->on_complete_data );
     }
-    (void)parsec_atomic_fetch_dec_int32( &(tp->context->active_taskpools) );
+    if( 1 == parsec_atomic_fetch_dec_int32( &(tp->context->active_taskpools) ) ) {
+        /* no more work, release the parked threads */
+        parsec_parking_lot_notify(tp->context->parking_lot, INT32_MAX);
+    }
     PARSEC_PINS_TASKPOOL_FINI(tp);
 }
 
 parsec_sched_module_t *parsec_current_scheduler           = NULL;
 static parsec_sched_base_component_t *scheduler_component = NULL;
 
+/*
+ * Scheduler instrumentation (see parsec_sched_stats_t). Each computation
+ * stream only updates its own statistics; the tasks scheduled by the other
+ * threads (communication thread, application threads) are only accounted
+ * in the depth of the queues, through an atomic balance.
+ */
+static int64_t parsec_sched_stats_foreign_balance = 0;
+#if defined(PARSEC_PROF_TRACE)
+static int parsec_sched_stats_depth_key_start = -1;
+static int parsec_sched_stats_depth_key_end = -1;
+#endif  /* defined(PARSEC_PROF_TRACE) */
+
+static void parsec_sched_stats_account(parsec_sched_stats_t *total, const parsec_sched_stats_t *stats)
+{
+    for( int l = 0; l < PARSEC_SCHED_STATS_NB_LEVELS; l++ ) {
+        total->pushes[l] += stats->pushes[l];
+        total->pops[l]   += stats->pops[l];
+    }
+    total->next_task_pops += stats->next_task_pops;
+    total->failed_selects += stats->failed_selects;
+    total->queue_time     += stats->queue_time;
+    total->balance        += stats->balance;
+    total->depth_sum      += stats->depth_sum;
+    total->depth_samples  += stats->depth_samples;
+    if( stats->queue_time_max > total->queue_time_max ) total->queue_time_max = stats->queue_time_max;
+    if( stats->depth_max > total->depth_max ) total->depth_max = stats->depth_max;
+}
+
+int parsec_sched_stats_collect(parsec_context_t *context, parsec_sched_stats_t *total)
+{
+    int found = 0;
+
+    memset(total, 0, sizeof(parsec_sched_stats_t));
+    for( int p = 0; p < context->nb_vp; p++ ) {
+        parsec_vp_t *vp = context->virtual_processes[p];
+        for( int t = 0; t < vp->nb_cores; t++ ) {
+            parsec_execution_stream_t *es = vp->execution_streams[t];
+            if( (NULL == es) || (NULL == es->sched_stats) ) continue;
+            parsec_sched_stats_account(total, es->sched_stats);
+            found = 1;
+        }
+    }
+    total->balance += parsec_sched_stats_foreign_balance;
+    total->depth = (total->balance > 0) ? total->balance : 0;
+    return found ? PARSEC_SUCCESS : PARSEC_ERR_NOT_FOUND;
+}
+
+void parsec_sched_stats_init(parsec_execution_stream_t *es)
+{
+    if( !parsec_runtime_sched_stats ) return;
+    es->sched_stats = (parsec_sched_stats_t*)calloc(1, sizeof(parsec_sched_stats_t));
+#if defined(PARSEC_PAPI_SDE)
+    {
+        char name[PARSEC_PAPI_SDE_MAX_COUNTER_NAME_LEN], group[PARSEC_PAPI_SDE_MAX_COUNTER_NAME_LEN];
+        int vp = es->virtual_process->vp_id;
+
+        for( int l = 0; l < PARSEC_SCHED_STATS_NB_LEVELS; l++ ) {
+            snprintf(name, PARSEC_PAPI_SDE_MAX_COUNTER_NAME_LEN, "SCHEDULER::PUSHES::LEVEL=%d::QUEUE=%d/%d", l, vp, es->th_id);
+            snprintf(group, PARSEC_PAPI_SDE_MAX_COUNTER_NAME_LEN, "SCHEDULER::PUSHES::LEVEL=%d", l);
+            parsec_papi_sde_register_counter(name, PAPI_SDE_RO|PAPI_SDE_DELTA, PAPI_SDE_long_long, &es->sched_stats->pushes[l]);
+            parsec_papi_sde_add_counter_to_group(name, group, PAPI_SDE_SUM);
+            snprintf(name, PARSEC_PAPI_SDE_MAX_COUNTER_NAME_LEN, "SCHEDULER::POPS::LEVEL=%d::QUEUE=%d/%d", l, vp, es->th_id);
+            snprintf(group, PARSEC_PAPI_SDE_MAX_COUNTER_NAME_LEN, "SCHEDULER::POPS::LEVEL=%d", l);
+            parsec_papi_sde_register_counter(name, PAPI_SDE_RO|PAPI_SDE_DELTA, PAPI_SDE_long_long, &es->sched_stats->pops[l]);
+            parsec_papi_sde_add_counter_to_group(name, group, PAPI_SDE_SUM);
+        }
+        snprintf(name, PARSEC_PAPI_SDE_MAX_COUNTER_NAME_LEN, "SCHEDULER::QUEUE_TIME::QUEUE=%d/%d", vp, es->th_id);
+        parsec_papi_sde_register_counter(name, PAPI_SDE_RO|PAPI_SDE_DELTA, PAPI_SDE_long_long, &es->sched_stats->queue_time);
+        parsec_papi_sde_add_counter_to_group(name, "SCHEDULER::QUEUE_TIME", PAPI_SDE_SUM);
+        snprintf(name, PARSEC_PAPI_SDE_MAX_COUNTER_NAME_LEN, "SCHEDULER::QUEUE_DEPTH::QUEUE=%d/%d", vp, es->th_id);
+        parsec_papi_sde_register_counter(name, PAPI_SDE_RO|PAPI_SDE_INSTANT, PAPI_SDE_long_long, &es->sched_stats->depth);
+        parsec_papi_sde_add_counter_to_group(name, "SCHEDULER::QUEUE_DEPTH", PAPI_SDE_MAX);
+        if( (0 == vp) && (0 == es->th_id) ) {
+            PARSEC_PAPI_SDE_DESCRIBE_COUNTER("SCHEDULER::PUSHES::LEVEL=<L>",
+                                             "the number of tasks that entered the scheduler queues of level L (0 is the local queue of the stream)");
+            PARSEC_PAPI_SDE_DESCRIBE_COUNTER("SCHEDULER::POPS::LEVEL=<L>",
+                                             "the number of tasks selected at distance L (0 is the local queue of the stream, higher levels are steals)");
+            PARSEC_PAPI_SDE_DESCRIBE_COUNTER("SCHEDULER::QUEUE_TIME",
+                                             "the cumulated time spent by the tasks in the scheduler queues");
+            PARSEC_PAPI_SDE_DESCRIBE_COUNTER("SCHEDULER::QUEUE_DEPTH",
+                                             "the last sampled number of tasks pending in the scheduler queues");
+        }
+    }
+#endif  /* defined(PARSEC_PAPI_SDE) */
+}
+
+static void parsec_sched_stats_print(const char *who, const parsec_sched_stats_t *stats)
+{
+    char pushes[PARSEC_SCHED_STATS_NB_LEVELS * 24], pops[PARSEC_SCHED_STATS_NB_LEVELS * 24];
+    long long nb_pops = 0;
+    int last = 0, lp = 0, lq = 0;
+
+    for( int l = 0; l < PARSEC_SCHED_STATS_NB_LEVELS; l++ ) {
+        if( (0 != stats->pushes[l]) || (0 != stats->pops[l]) ) last = l;
+        nb_pops += stats->pops[l];
+    }
+    pushes[0] = pops[0] = '\0';
+    for( int l = 0; l <= last; l++ ) {
+        lp += snprintf(pushes + lp, sizeof(pushes) - lp, " %lld", stats->pushes[l]);
+        lq += snprintf(pops + lq, sizeof(pops) - lq, " %lld", stats->pops[l]);
+    }
+    parsec_inform("Scheduler %s %s: pushes by level%s, pops by level%s (%lld steals), %lld from next_task, %lld failed selects, "
+                  "queue time mean %.1f max %lld %s, queue depth mean %.1f max %lld",
+                  parsec_current_scheduler->component->base_version.mca_component_name, who,
+                  pushes, pops, nb_pops - stats->pops[0], stats->next_task_pops, stats->failed_selects,
+                  (0 == nb_pops) ? 0.0 : (double)stats->queue_time / (double)nb_pops, stats->queue_time_max, TIMER_UNIT,
+                  (0 == stats->depth_samples) ? 0.0 : (double)stats->depth_sum / (double)stats->depth_samples, stats->depth_max);
+}
+
+void parsec_sched_stats_fini(parsec_context_t *context)
+{
+    parsec_sched_stats_t total;
+    char who[64];
+
+    if( PARSEC_SUCCESS != parsec_sched_stats_collect(context, &total) ) return;
+    for( int p = 0; p < context->nb_vp; p++ ) {
+        parsec_vp_t *vp = context->virtual_processes[p];
+        for( int t = 0; t < vp->nb_cores; t++ ) {
+            parsec_execution_stream_t *es = vp->execution_streams[t];
+            if( (NULL == es) || (NULL == es->sched_stats) ) continue;
+            if( NULL != parsec_current_scheduler->module.display_stats )
+                parsec_current_scheduler->module.display_stats(es);
+            if( context->nb_vp * vp->nb_cores > 1 ) {
+                snprintf(who, sizeof(who), "stream %d/%d", p, t);
+                parsec_sched_stats_print(who, es->sched_stats);
+            }
+#if defined(PARSEC_PAPI_SDE)
+            for( int l = 0; l < PARSEC_SCHED_STATS_NB_LEVELS; l++ ) {
+                PARSEC_PAPI_SDE_UNREGISTER_COUNTER("SCHEDULER::PUSHES::LEVEL=%d::QUEUE=%d/%d", l, p, t);
+                PARSEC_PAPI_SDE_UNREGISTER_COUNTER("SCHEDULER::POPS::LEVEL=%d::QUEUE=%d/%d", l, p, t);
+            }
+            PARSEC_PAPI_SDE_UNREGISTER_COUNTER("SCHEDULER::QUEUE_TIME::QUEUE=%d/%d", p, t);
+            PARSEC_PAPI_SDE_UNREGISTER_COUNTER("SCHEDULER::QUEUE_DEPTH::QUEUE=%d/%d", p, t);
+#endif  /* defined(PARSEC_PAPI_SDE) */
+            free(es->sched_stats);
+            es->sched_stats = NULL;
+        }
+    }
+    snprintf(who, sizeof(who), "rank %d", context->my_rank);
+    parsec_sched_stats_print(who, &total);
+    parsec_sched_stats_foreign_balance = 0;
+}
+
+/* Stamp the tasks given to the scheduler and account them on the calling stream */
+static void parsec_sched_stats_schedule(parsec_task_t *tasks_ring, int nb_tasks)
+{
+    parsec_execution_stream_t *es = parsec_my_execution_stream();
+    parsec_time_t now = take_time();
+
+    _LIST_ITEM_ITERATOR(tasks_ring, &tasks_ring->super, item, { ((parsec_task_t*)item)->sched_date = now; });
+    if( (NULL == es) || (NULL == es->sched_stats) ) {
+        parsec_atomic_fetch_add_int64(&parsec_sched_stats_foreign_balance, nb_tasks);
+        return;
+    }
+    es->sched_stats->pushes[0] += nb_tasks;
+    es->sched_stats->balance += nb_tasks;
+}
+
+/* Remember on the tasks made ready by the remote data being released by the
+ * stream (see comm_stats) when the data arrived, to account their wait for
+ * a worker when they start */
+static void parsec_remote_dep_stats_schedule(parsec_execution_stream_t *es, parsec_task_t **task_rings, int nb_vp)
+{
+    parsec_remote_dep_stats_t *stats = es->remote_stats;
+
+    for( int vp = 0; vp < nb_vp; vp++ ) {
+        parsec_task_t *ring = task_rings[vp];
+        if( NULL == ring ) continue;
+        _LIST_ITEM_ITERATOR(ring, &ring->super, item, {
+                parsec_task_t *task = (parsec_task_t*)item;
+                if( NULL != task->remote_stats ) continue;
+                task->remote_stats = stats;
+                task->remote_date  = stats->arrival;
+            });
+    }
+}
+
+/* Account the time a task made ready by a remote data waited to start */
+static void parsec_remote_dep_stats_start(parsec_task_t *task)
+{
+    parsec_remote_dep_stats_t *stats = task->remote_stats;
+    int64_t t = (int64_t)diff_time(task->remote_date, take_time()), max;
+
+    task->remote_stats = NULL;
+    parsec_atomic_fetch_inc_int64(&stats->nb_consumers);
+    parsec_atomic_fetch_add_int64(&stats->data_to_start, t);
+    while( t > (max = stats->data_to_start_max) )
+        if( parsec_atomic_cas_int64(&stats->data_to_start_max, max, t) ) break;
+}
+
+/* Account the selection of task at distance, and sample the depth of the queues */
+static void parsec_sched_stats_select(parsec_execution_stream_t *es, parsec_task_t *task, int distance)
+{
+    parsec_sched_stats_t *stats = es->sched_stats;
+    parsec_context_t *context;
+    long long t, depth;
+
+    if( NULL == task ) {
+        stats->failed_selects++;
+        return;
+    }
+    if( distance < 0 ) distance = 0;
+    if( distance >= PARSEC_SCHED_STATS_NB_LEVELS ) distance = PARSEC_SCHED_STATS_NB_LEVELS - 1;
+    stats->pops[distance]++;
+    stats->balance--;
+    t = (long long)diff_time(task->sched_date, take_time());
+    stats->queue_time += t;
+    if( t > stats->queue_time_max ) stats->queue_time_max = t;
+
+    if( --stats->depth_countdown > 0 ) return;
+    stats->depth_countdown = PARSEC_SCHED_STATS_DEPTH_PERIOD;
+    context = es->virtual_process->parsec_context;
+    depth = parsec_sched_stats_foreign_balance;
+    for( int p = 0; p < context->nb_vp; p++ ) {
+        parsec_vp_t *vp = context->virtual_processes[p];
+        for( int th = 0; th < vp->nb_cores; th++ ) {
+            parsec_execution_stream_t *other = vp->execution_streams[th];
+            if( (NULL != other) && (NULL != other->sched_stats) ) depth += other->sched_stats->balance;
+        }
+    }
+    if( depth < 0 ) depth = 0;  /* the balances are read without synchronization */
+    stats->depth = depth;
+    stats->depth_sum += depth;
+    stats->depth_samples++;
+    if( depth > stats->depth_max ) stats->depth_max = depth;
+#if defined(PARSEC_PROF_TRACE)
+    if( (-1 != parsec_sched_stats_depth_key_start) && (NULL != es->es_profile) ) {
+        int64_t info = depth;
+        parsec_profiling_trace_flags(es->es_profile, parsec_sched_stats_depth_key_start, 0, PROFILE_OBJECT_ID_NULL,
+                                     &info, PARSEC_PROFILING_EVENT_COUNTER|PARSEC_PROFILING_EVENT_HAS_INFO);
+    }
+#endif  /* defined(PARSEC_PROF_TRACE) */
+}
+
 void parsec_remove_scheduler( parsec_context_t *parsec )
 {
     if( NULL != parsec_current_scheduler ) {
@@ -236,6 +480,13 @@ int parsec_set_scheduler( parsec_context_t *parsec )
 
     parsec_debug_verbose(4, parsec_debug_output, " Installing scheduler %s", parsec_current_scheduler->component->base_version.mca_component_name);
     PROFILING_SAVE_sINFO("sched", (char *)parsec_current_scheduler->component->base_version.mca_component_name);
+#if defined(PARSEC_PROF_TRACE)
+    if( parsec_runtime_sched_stats && (-1 == parsec_sched_stats_depth_key_start) ) {
+        parsec_profiling_add_dictionary_keyword("sched_queue_depth", "fill:#AAAAFF",
+                                                sizeof(int64_t), "depth{int64_t}",
+                                                &parsec_sched_stats_depth_key_start, &parsec_sched_stats_depth_key_end);
+    }
+#endif  /* defined(PARSEC_PROF_TRACE) */
 
     parsec_current_scheduler->module.install( parsec );
     return PARSEC_SUCCESS;
@@ -255,7 +506,7 @@ __parsec_schedule(parsec_execution_stream_t* es,
                   parsec_task_t* tasks_ring,
                   int32_t distance)
 {
-    int ret;
+    int ret, nb_tasks = 0;
 #ifdef PARSEC_PROF_PINS
     parsec_execution_stream_t* local_es = parsec_my_execution_stream();
 #endif  /* PARSEC_PROF_PINS */
@@ -303,8 +554,18 @@ __parsec_schedule(parsec_execution_stream_t* es,
     }
 #endif  /* defined(PARSEC_PAPI_SDE) */
 
+    /* count the tasks before the ring is handed over to the scheduler */
+    if( parsec_runtime_idle_park || parsec_runtime_sched_stats )
+        _LIST_ITEM_ITERATOR(tasks_ring, &tasks_ring->super, item, {nb_tasks++; });
+    if( parsec_runtime_sched_stats )
+        parsec_sched_stats_schedule(tasks_ring, nb_tasks);
+
     ret = parsec_current_scheduler->module.schedule(es, tasks_ring, distance);
 
+    /* wake up one parked thread per new task */
+    if( parsec_runtime_idle_park )
+        parsec_parking_lot_notify(es->virtual_process->parsec_context->parking_lot, nb_tasks);
+
     PARSEC_PINS(local_es, SCHEDULE_END, tasks_ring);
 
     return ret;
@@ -320,6 +581,11 @@ __parsec_schedule(parsec_execution_stream_t* es,
  * If the provided execution stream is NULL, all tasks are delivered to their
  * respective vp.
  *
+ * A task already saved as next task is replaced if the new ring holds a
+ * higher priority task, and no task is saved once the execution stream ran
+ * parsec_runtime_keep_highest_priority_task_depth tasks in a row from its
+ * next_task, to leave the other ready tasks a chance to run.
+ *
  * Beware, as the manipulation of next_task is not protected, an execution
  * stream should never be used concurrently in two call to this function (or
  * a thread should never `borrow` an execution stream for this call).
@@ -332,6 +598,10 @@ int __parsec_schedule_vp(parsec_execution_stream_t* submission_es,
                               *es = (NULL == submission_es ? parsec_my_execution_stream() : submission_es);
     int ret = 0;
 
+    if( parsec_comm_stats && (NULL != submission_es) && (NULL != submission_es->remote_stats) )
+        parsec_remote_dep_stats_schedule(submission_es, task_rings,
+                                         es->virtual_process->parsec_context->nb_vp);
+
     if( NULL == submission_es || !parsec_runtime_keep_highest_priority_task ||
         distance || NULL == submission_es->scheduler_object /* not the communication thread */ ) {
         parsec_context_t* context = es->virtual_process->parsec_context;
@@ -363,7 +633,16 @@ int __parsec_schedule_vp(parsec_execution_stream_t* submission_es,
         target_es = context->virtual_processes[vp]->execution_streams[0];
 
         if( vp == submission_es->virtual_process->vp_id ) {
-            if( NULL == submission_es->next_task ) {
+            if( (NULL != submission_es->next_task) &&
+                (ring->priority > submission_es->next_task->priority) ) {
+                ring = (parsec_task_t*)parsec_list_item_ring_push_sorted(&ring->super,
+                                                                        &submission_es->next_task->super,
+                                                                        parsec_execution_context_priority_comparator);
+                submission_es->next_task = NULL;
+            }
+            if( (NULL == submission_es->next_task) &&
+                ((0 == parsec_runtime_keep_highest_priority_task_depth) ||
+                 (submission_es->next_task_depth < parsec_runtime_keep_highest_priority_task_depth)) ) {
                 submission_es->next_task = ring;
                 ring = (parsec_task_t*)parsec_list_item_ring_chop(&ring->super);
                 if( NULL == ring ) {
@@ -471,12 +750,39 @@ int __parsec_complete_execution( parsec_execution_stream_t *es,
     return rc;
 }
 
+void __parsec_fused_task_complete( parsec_execution_stream_t *es,
+                                   parsec_task_t *task )
+{
+#if defined(PARSEC_PROF_TRACE)
+    task->prof_info.task_return_code = PARSEC_HOOK_RETURN_DONE;
+#endif
+    PARSEC_PINS(es, EXEC_END, task);
+    task->status = PARSEC_TASK_STATUS_COMPLETE;
+    parsec_atomic_fetch_inc_int64((int64_t*)&task->selected_device->executed_tasks);
+
+    PARSEC_PINS(es, COMPLETE_EXEC_BEGIN, task);
+    PARSEC_PAPI_SDE_COUNTER_ADD(PARSEC_PAPI_SDE_TASKS_RETIRED, 1);
+    PARSEC_AYU_TASK_COMPLETE(task);
+    DEBUG_MARK_EXE( es->th_id, es->virtual_process->vp_id, task );
+}
+
+void __parsec_fused_task_start( parsec_execution_stream_t *es,
+                                parsec_task_t *task )
+{
+    task->status = PARSEC_TASK_STATUS_HOOK;
+    PARSEC_AYU_TASK_RUN(es->th_id, task);
+    PARSEC_PINS(es, EXEC_BEGIN, task);
+}
+
 int __parsec_task_progress( parsec_execution_stream_t* es,
                             parsec_task_t* task,
                             int distance)
 {
     int rc = PARSEC_HOOK_RETURN_DONE;
 
+    if( parsec_comm_stats && (NULL != task->remote_stats) )
+        parsec_remote_dep_stats_start(task);
+
     if(task->status <= PARSEC_TASK_STATUS_PREPARE_INPUT) {
         PARSEC_PINS(es, PREPARE_INPUT_BEGIN, task);
         rc = task->task_class->prepare_input(es, task);
@@ -549,9 +855,15 @@ __parsec_get_next_task( parsec_execution_stream_t *es,
 
     if( NULL == (task = es->next_task) ) {
         task = parsec_current_scheduler->module.select(es, distance);
+        es->next_task_depth = 0;
+        if( NULL != es->sched_stats )
+            parsec_sched_stats_select(es, task, *distance);
     } else {
         es->next_task = NULL;
+        es->next_task_depth++;
         *distance = 1;
+        if( NULL != es->sched_stats )
+            es->sched_stats->next_task_pops++;
     }
     return task;
 }
@@ -691,13 +1003,33 @@ static void parsec_context_leave_wait(parsec_context_t *parsec)
 
 int remote_dep_ce_reconfigure(parsec_context_t* context);
 
+/*
+ * Register the execution stream in the parking lot of the context, look for
+ * work one last time, and block until new tasks are scheduled if there is
+ * still none. Return the task found during the last attempt, if any.
+ */
+static parsec_task_t* __parsec_idle_park( parsec_execution_stream_t* es, int* distance )
+{
+    parsec_context_t* parsec_context = es->virtual_process->parsec_context;
+    parsec_parking_lot_t* lot = parsec_context->parking_lot;
+    int32_t epoch = parsec_parking_lot_enter(lot);
+    parsec_task_t* task;
+
+    task = __parsec_get_next_task(es, distance);
+    if( (NULL == task) && !all_tasks_done(parsec_context) ) {
+        parsec_parking_lot_park(lot, epoch, parsec_runtime_idle_park_timeout);
+    }
+    parsec_parking_lot_leave(lot);
+    return task;
+}
+
 int __parsec_context_wait( parsec_execution_stream_t* es )
 {
     uint64_t misses_in_a_row;
     parsec_context_t* parsec_context = es->virtual_process->parsec_context;
     int32_t my_barrier_counter = parsec_context->__parsec_internal_finalization_counter;
     parsec_task_t* task;
-    int nbiterations = 0, distance, rc;
+    int nbiterations = 0, distance, rc, park;
     struct timespec rqtp;
 
     rqtp.tv_sec = 0;
@@ -754,6 +1086,7 @@ int __parsec_context_wait( parsec_execution_stream_t* es )
     }
   skip_first_barrier:
     while( !all_tasks_done(parsec_context) ) {
+        park = parsec_runtime_idle_park;
 #if defined(DISTRIBUTED)
         if( (1 == parsec_communication_engine_up) &&
             (es->virtual_process[0].parsec_context->nb_nodes == 1) &&
@@ -762,16 +1095,20 @@ int __parsec_context_wait( parsec_execution_stream_t* es )
             while(parsec_remote_dep_progress(es) > 0)  {
                 misses_in_a_row = 0;
             }
+            park = 0;  /* nobody would wake us up for the communications */
         }
 #endif /* defined(DISTRIBUTED) */
 
-        if( misses_in_a_row > 1 ) {
+        if( !park && (misses_in_a_row > 1) ) {
             rqtp.tv_nsec = parsec_exponential_backoff(es, misses_in_a_row);
             nanosleep(&rqtp, NULL);
         }
         misses_in_a_row++;  /* assume we fail to extract a task */
 
-        task = __parsec_get_next_task(es, &distance);
+        if( park && (misses_in_a_row > (uint64_t)parsec_runtime_idle_spin) )
+            task = __parsec_idle_park(es, &distance);
+        else
+            task = __parsec_get_next_task(es, &distance);
         if( NULL != task ) {
             misses_in_a_row = 0;  /* reset the misses counter */
 
@@ -802,6 +1139,7 @@ int __parsec_context_wait( parsec_execution_stream_t* es )
             }
         }
         parsec_context->largest_simulation_date = largest_date;
+        parsec_sim_replay(parsec_context);
     }
     parsec_barrier_wait( &(parsec_context->barrier) );
     es->largest_simulation_date = 0;
@@ -981,6 +1319,10 @@ int parsec_context_wait( parsec_context_t* context )
         (void)parsec_atomic_fetch_inc_int32( &context->active_taskpools );
         return PARSEC_ERR_NOT_SUPPORTED;
     }
+    if( 0 == active ) {
+        /* the workers might be parked waiting for new tasks */
+        parsec_parking_lot_notify(context->parking_lot, INT32_MAX);
+    }
 
     ret = __parsec_context_wait( parsec_my_execution_stream() );
 
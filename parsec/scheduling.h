@@ -145,6 +145,21 @@ int __parsec_execute( parsec_execution_stream_t*, parsec_task_t*);
 int __parsec_complete_execution( parsec_execution_stream_t *es,
                                  parsec_task_t *task);
 
+/**
+ * Task fusion: the hook of the task ran its body, and turns the task into
+ * its successor to run the body of the successor right away. These account
+ * for the end of the execution of the task and the start of the successor,
+ * as __parsec_execute and __parsec_complete_execution would.
+ * __parsec_fused_task_complete closes the execution of the task and opens
+ * its completion, that the hook closes (PINS COMPLETE_EXEC_END) once it
+ * released the inputs of the task. __parsec_fused_task_start opens the
+ * execution of the successor.
+ */
+void __parsec_fused_task_complete( parsec_execution_stream_t *es,
+                                   parsec_task_t *task);
+void __parsec_fused_task_start( parsec_execution_stream_t *es,
+                                parsec_task_t *task);
+
 /**
  * Signal the handle that a certain number of runtime bound activities have been
  * completed. Such activities includes network communications, other local data
@@ -188,6 +203,20 @@ int parsec_set_scheduler( parsec_context_t *parsec );
  */
 void parsec_remove_scheduler( parsec_context_t *parsec );
 
+/**
+ *  Allocate the scheduler statistics of a computation execution stream
+ *  and export them through PAPI-SDE (does nothing unless
+ *  parsec_runtime_sched_stats is set).
+ */
+void parsec_sched_stats_init( parsec_execution_stream_t *es );
+
+/**
+ *  Report the scheduler statistics of all the execution streams, and
+ *  release them. Must be called once the computation threads are gone,
+ *  before the scheduler is removed.
+ */
+void parsec_sched_stats_fini( parsec_context_t *parsec );
+
 struct parsec_sched_module_s;
 extern struct parsec_sched_module_s *parsec_current_scheduler;
 
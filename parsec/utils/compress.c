@@ -0,0 +1,216 @@
+/*
+ * Copyright (c) 2026      The University of Tennessee and The University
+ *                         of Tennessee Research Foundation.  All rights
+ *                         reserved.
+ */
+
+#include "parsec/parsec_config.h"
+#include "parsec/constants.h"
+#include "parsec/utils/compress.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * Stream format: one byte holding the shuffle width, then a list of
+ * sequences. Each sequence is a token (number of literals in the high
+ * nibble, match length minus 4 in the low nibble, 15 meaning that extra
+ * bytes follow, each adding up to 255), the literals, and unless the
+ * sequence is the last one, the 16-bit little endian offset of the match
+ * followed by the extra bytes of the match length.
+ */
+
+#define PARSEC_LZ_HASH_LOG    12
+#define PARSEC_LZ_MIN_MATCH   4
+#define PARSEC_LZ_MAX_OFFSET  65535
+
+static inline uint32_t parsec_lz_read32(const uint8_t *p)
+{
+    uint32_t v;
+    memcpy(&v, p, sizeof(uint32_t));
+    return v;
+}
+
+static inline uint32_t parsec_lz_hash(uint32_t v)
+{
+    return (v * 2654435761U) >> (32 - PARSEC_LZ_HASH_LOG);
+}
+
+static inline int parsec_lz_length(uint8_t **op, const uint8_t *oend, size_t l)
+{
+    for( ; l >= 255; l -= 255 ) {
+        if( *op >= oend ) return 0;
+        *(*op)++ = 255;
+    }
+    if( *op >= oend ) return 0;
+    *(*op)++ = (uint8_t)l;
+    return 1;
+}
+
+/* Emit a sequence, a match length of 0 marks the last one */
+static int parsec_lz_sequence(uint8_t **op, const uint8_t *oend,
+                              const uint8_t *literals, size_t nb_literals,
+                              size_t offset, size_t match)
+{
+    uint8_t *token;
+
+    if( *op >= oend ) return 0;
+    token = (*op)++;
+    *token = (uint8_t)(((nb_literals >= 15) ? 15 : nb_literals) << 4);
+    if( (nb_literals >= 15) && !parsec_lz_length(op, oend, nb_literals - 15) ) return 0;
+    if( (size_t)(oend - *op) < nb_literals ) return 0;
+    memcpy(*op, literals, nb_literals);
+    *op += nb_literals;
+    if( 0 == match ) return 1;
+
+    match -= PARSEC_LZ_MIN_MATCH;
+    *token |= (uint8_t)((match >= 15) ? 15 : match);
+    if( (oend - *op) < 2 ) return 0;
+    (*op)[0] = (uint8_t)(offset & 0xff);
+    (*op)[1] = (uint8_t)(offset >> 8);
+    *op += 2;
+    if( (match >= 15) && !parsec_lz_length(op, oend, match - 15) ) return 0;
+    return 1;
+}
+
+static int parsec_lz_compress(const uint8_t *in, size_t len, uint8_t **op, const uint8_t *oend)
+{
+    int32_t table[1 << PARSEC_LZ_HASH_LOG];
+    size_t ip = 0, anchor = 0, misses = 0;
+
+    memset(table, 0xff, sizeof(table));
+    while( ip + PARSEC_LZ_MIN_MATCH <= len ) {
+        uint32_t v = parsec_lz_read32(in + ip), h = parsec_lz_hash(v);
+        int32_t ref = table[h];
+
+        table[h] = (int32_t)ip;
+        if( (ref >= 0) && ((ip - (size_t)ref) <= PARSEC_LZ_MAX_OFFSET) &&
+            (parsec_lz_read32(in + ref) == v) ) {
+            size_t match = PARSEC_LZ_MIN_MATCH;
+            while( (ip + match < len) && (in[ref + match] == in[ip + match]) ) match++;
+            if( !parsec_lz_sequence(op, oend, in + anchor, ip - anchor, ip - (size_t)ref, match) )
+                return PARSEC_ERR_VALUE_OUT_OF_BOUNDS;
+            ip += match;
+            anchor = ip;
+            misses = 0;
+            continue;
+        }
+        /* skip faster over incompressible data */
+        ip += 1 + (misses++ >> 6);
+    }
+    if( !parsec_lz_sequence(op, oend, in + anchor, len - anchor, 0, 0) )
+        return PARSEC_ERR_VALUE_OUT_OF_BOUNDS;
+    return PARSEC_SUCCESS;
+}
+
+int parsec_compress(const void *src, size_t len, size_t width,
+                    void *dst, size_t dst_len, size_t *out_len)
+{
+    const uint8_t *in = (const uint8_t*)src;
+    uint8_t *op = (uint8_t*)dst, *shuffled = NULL;
+    int rc;
+
+    if( (width < 2) || (width > 255) || (len < 2 * width) ) width = 1;
+    if( dst_len < 1 ) return PARSEC_ERR_VALUE_OUT_OF_BOUNDS;
+    *op++ = (uint8_t)width;
+
+    if( width > 1 ) {
+        size_t n = len / width, tail = n * width;
+        shuffled = (uint8_t*)malloc(len);
+        if( NULL == shuffled ) return PARSEC_ERR_OUT_OF_RESOURCE;
+        for( size_t b = 0; b < width; b++ )
+            for( size_t i = 0; i < n; i++ )
+                shuffled[b * n + i] = in[i * width + b];
+        memcpy(shuffled + tail, in + tail, len - tail);
+        in = shuffled;
+    }
+    rc = parsec_lz_compress(in, len, &op, (uint8_t*)dst + dst_len);
+    free(shuffled);
+    if( PARSEC_SUCCESS == rc )
+        *out_len = (size_t)(op - (uint8_t*)dst);
+    return rc;
+}
+
+static int parsec_lz_decompress(const uint8_t *ip, const uint8_t *iend,
+                                uint8_t *out, size_t out_len)
+{
+    uint8_t *op = out, *oend = out + out_len;
+
+    while( ip < iend ) {
+        unsigned token = *ip++;
+        size_t nb_literals = token >> 4, match = token & 15, offset;
+        uint8_t b;
+
+        if( 15 == nb_literals ) {
+            do {
+                if( ip >= iend ) return PARSEC_ERR_TRUNCATE;
+                b = *ip++;
+                nb_literals += b;
+            } while( 255 == b );
+        }
+        if( ((size_t)(iend - ip) < nb_literals) || ((size_t)(oend - op) < nb_literals) )
+            return PARSEC_ERR_TRUNCATE;
+        memcpy(op, ip, nb_literals);
+        ip += nb_literals;
+        op += nb_literals;
+        if( ip == iend ) break;  /* the last sequence has no match */
+
+        if( (iend - ip) < 2 ) return PARSEC_ERR_TRUNCATE;
+        offset = (size_t)ip[0] | ((size_t)ip[1] << 8);
+        ip += 2;
+        if( 15 == match ) {
+            do {
+                if( ip >= iend ) return PARSEC_ERR_TRUNCATE;
+                b = *ip++;
+                match += b;
+            } while( 255 == b );
+        }
+        match += PARSEC_LZ_MIN_MATCH;
+        if( (0 == offset) || (offset > (size_t)(op - out)) || ((size_t)(oend - op) < match) )
+            return PARSEC_ERR_TRUNCATE;
+        if( offset >= match ) {
+            memcpy(op, op - offset, match);
+            op += match;
+        } else {
+            /* Overlapping copy of a period of offset bytes: each copy
+             * doubles the length of the periodic region behind op */
+            const uint8_t *from = op - offset;
+            size_t done = 0, chunk = offset;
+            while( done < match ) {
+                size_t c = ((match - done) < chunk) ? (match - done) : chunk;
+                memcpy(op + done, from, c);
+                done += c;
+                chunk = done + offset;
+            }
+            op += match;
+        }
+    }
+    return (op == oend) ? PARSEC_SUCCESS : PARSEC_ERR_TRUNCATE;
+}
+
+int parsec_decompress(const void *src, size_t len, void *dst, size_t dst_len)
+{
+    const uint8_t *in = (const uint8_t*)src;
+    uint8_t *out = (uint8_t*)dst, *shuffled;
+    size_t width;
+    int rc;
+
+    if( len < 1 ) return PARSEC_ERR_TRUNCATE;
+    width = in[0];
+    if( width < 2 )
+        return parsec_lz_decompress(in + 1, in + len, out, dst_len);
+
+    shuffled = (uint8_t*)malloc(dst_len);
+    if( NULL == shuffled ) return PARSEC_ERR_OUT_OF_RESOURCE;
+    rc = parsec_lz_decompress(in + 1, in + len, shuffled, dst_len);
+    if( PARSEC_SUCCESS == rc ) {
+        size_t n = dst_len / width, tail = n * width;
+        for( size_t b = 0; b < width; b++ )
+            for( size_t i = 0; i < n; i++ )
+                out[i * width + b] = shuffled[b * n + i];
+        memcpy(out + tail, shuffled + tail, dst_len - tail);
+    }
+    free(shuffled);
+    return rc;
+}
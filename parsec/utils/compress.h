@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2026      The University of Tennessee and The University
+ *                         of Tennessee Research Foundation.  All rights
+ *                         reserved.
+ */
+
+#ifndef _PARSEC_COMPRESS_H_
+#define _PARSEC_COMPRESS_H_
+
+#include "parsec/parsec_config.h"
+
+#include <stddef.h>
+
+BEGIN_C_DECLS
+
+/**
+ * Lossless compression of packed data.
+ *
+ * The bytes of the elements (of width bytes each) are first shuffled, so
+ * that the i-th byte of all elements are contiguous: on numerical data the
+ * exponents and high order bytes are very repetitive and compress well once
+ * grouped. The result is then compressed with a byte-oriented LZ77 in the
+ * spirit of LZ4 (token, literals, 16-bit offset, match length), which
+ * favors speed over ratio. The width is stored in the compressed stream.
+ */
+
+/**
+ * Compress len bytes from src into dst. Elements of width bytes are
+ * shuffled before compression, a width of 0 or 1 disables the shuffle.
+ *
+ * @return PARSEC_SUCCESS with the compressed size in *out_len, or
+ * PARSEC_ERR_VALUE_OUT_OF_BOUNDS if the result does not fit in dst_len bytes
+ * (the caller should then send the data as is).
+ */
+int parsec_compress(const void *src, size_t len, size_t width,
+                    void *dst, size_t dst_len, size_t *out_len);
+
+/**
+ * Decompress len bytes from src, that must expand exactly to dst_len bytes
+ * into dst.
+ *
+ * @return PARSEC_SUCCESS, or PARSEC_ERR_TRUNCATE if the stream is corrupted
+ * or does not expand to dst_len bytes.
+ */
+int parsec_decompress(const void *src, size_t len, void *dst, size_t dst_len);
+
+END_C_DECLS
+
+#endif  /* _PARSEC_COMPRESS_H_ */
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2026      The University of Tennessee and The University
+ *                         of Tennessee Research Foundation.  All rights
+ *                         reserved.
+ */
+
+#ifndef PARSEC_FUTEX_H_HAS_BEEN_INCLUDED
+#define PARSEC_FUTEX_H_HAS_BEEN_INCLUDED
+
+#include "parsec/parsec_config.h"
+
+#include <stdint.h>
+#include <time.h>
+
+/*
+ * Minimal wrappers around the Linux futex: a thread blocks in the kernel
+ * as long as a 32-bit word holds the value it saw, and is woken up
+ * explicitly. Without futex support, waiting degrades to a short sleep and
+ * waking is a no-op, so callers must always recheck their condition.
+ */
+
+#if defined(PARSEC_HAVE_LINUX_FUTEX_H)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <errno.h>
+#include <limits.h>
+
+/**
+ * Block while *addr == val, at most timeout if not NULL.
+ * @return 0 if woken up (or the value already changed), -1 on timeout.
+ */
+static inline int parsec_futex_wait(volatile int32_t *addr, int32_t val,
+                                    const struct timespec *timeout)
+{
+    long rc = syscall(SYS_futex, (int32_t*)addr, FUTEX_WAIT_PRIVATE, val, timeout, NULL, 0);
+    return ((-1 == rc) && (ETIMEDOUT == errno)) ? -1 : 0;
+}
+
+/** Wake up to nb threads blocked on addr, returns the number woken. */
+static inline int parsec_futex_wake(volatile int32_t *addr, int32_t nb)
+{
+    return (int)syscall(SYS_futex, (int32_t*)addr, FUTEX_WAKE_PRIVATE, nb, NULL, NULL, 0);
+}
+
+#define PARSEC_FUTEX_WAKE_ALL INT_MAX
+
+#else
+
+static inline int parsec_futex_wait(volatile int32_t *addr, int32_t val,
+                                    const struct timespec *timeout)
+{
+    struct timespec rqtp = { .tv_sec = 0, .tv_nsec = 50000 };
+    if( (NULL != timeout) && (0 == timeout->tv_sec) && (timeout->tv_nsec < rqtp.tv_nsec) )
+        rqtp = *timeout;
+    if( *addr == val ) nanosleep(&rqtp, NULL);
+    return 0;
+}
+
+static inline int parsec_futex_wake(volatile int32_t *addr, int32_t nb)
+{
+    (void)addr; (void)nb;
+    return 0;
+}
+
+#define PARSEC_FUTEX_WAKE_ALL 0x7fffffff
+
+#endif  /* defined(PARSEC_HAVE_LINUX_FUTEX_H) */
+
+#endif  /* PARSEC_FUTEX_H_HAS_BEEN_INCLUDED */
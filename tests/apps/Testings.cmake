@@ -1,3 +1,4 @@
 include(${CMAKE_CURRENT_LIST_DIR}/haar_tree/Testings.cmake)
 include(${CMAKE_CURRENT_LIST_DIR}/merge_sort/Testings.cmake)
+include(${CMAKE_CURRENT_LIST_DIR}/pingpong/Testings.cmake)
 include(${CMAKE_CURRENT_LIST_DIR}/stencil/Testings.cmake)
@@ -0,0 +1,12 @@
+if( MPI_C_FOUND )
+  # Message rate of small transfers, funnelled through the communication
+  # thread or spread over the request pools of the MPI_THREAD_MULTIPLE engine
+  parsec_addtest_cmd(apps/pingpong/bw_test:mp ${MPI_TEST_CMD_LIST} 2 apps/pingpong/bw_test -n 20 -f 200 -l 64 -c 4 -- --mca runtime_comm_thread_multiple 0)
+  parsec_addtest_cmd(apps/pingpong/bw_test:mt:mp ${MPI_TEST_CMD_LIST} 2 apps/pingpong/bw_test -n 20 -f 200 -l 64 -c 4 -- --mca runtime_comm_thread_multiple 1 --mca runtime_comm_mpi_shards 4)
+  # Round trip of the activations, handed to the communication thread or
+  # posted by the workers themselves when MPI is MPI_THREAD_MULTIPLE
+  parsec_addtest_cmd(apps/pingpong/rtt:mp ${MPI_TEST_CMD_LIST} 2 apps/pingpong/rtt -n=200 -- --mca runtime_comm_thread_multiple 0)
+  parsec_addtest_cmd(apps/pingpong/rtt:mt:mp ${MPI_TEST_CMD_LIST} 2 apps/pingpong/rtt -n=200 -- --mca runtime_comm_thread_multiple 1)
+  # Latency and bandwidth of the transfers through the dynamic RMA window
+  parsec_addtest_cmd(apps/pingpong/bw_test:rma:mp ${MPI_TEST_CMD_LIST} 2 apps/pingpong/bw_test -n 100 -f 1 -l 65536 -- --mca runtime_comm_mpi_rma 1)
+endif( MPI_C_FOUND )
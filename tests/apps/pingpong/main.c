@@ -1,12 +1,20 @@
 /*
- * Copyright (c) 2009-2021 The University of Tennessee and The University
+ * Copyright (c) 2009-2026 The University of Tennessee and The University
  *                         of Tennessee Research Foundation.  All rights
  *                         reserved.
  */
 
+/* A token of size bytes goes nb times from one process to the next one. The
+ * time of the run is reported on the first process, with the average round
+ * trip, as the activation of PING(k+1) is on the critical path of each hop.
+ * Options: -s=<size> -n=<nb>, the PaRSEC options follow --. */
+
 #include "parsec/runtime.h"
+#include "parsec/os-spec-timing.h"
 #include "rtt_wrapper.h"
 #include "rtt_data.h"
+#include <stdio.h>
+#include <stdlib.h>
 #if defined(PARSEC_HAVE_STRING_H)
 #include <string.h>
 #endif  /* defined(PARSEC_HAVE_STRING_H) */
@@ -19,14 +27,34 @@ int main(int argc, char *argv[])
 {
     parsec_context_t* parsec;
     int rank, world;
-    int size, nb, rc;
+    int size = 256, nb = -1, rc, i;
     parsec_data_collection_t *dcA;
     parsec_taskpool_t *rtt;
+    parsec_time_t start;
+    double elapsed;
+
+    int pargc = 0; char **pargv = NULL;
+    for( i = 1; i < argc; i++) {
+        if( 0 == strncmp(argv[i], "--", 3) ) {
+            pargc = argc - i;
+            pargv = argv + i;
+            break;
+        }
+        if( 0 == strncmp(argv[i], "-s=", 3) ) {
+            size = strtol(argv[i]+3, NULL, 10);
+            continue;
+        }
+        if( 0 == strncmp(argv[i], "-n=", 3) ) {
+            nb = strtol(argv[i]+3, NULL, 10);
+            continue;
+        }
+    }
 
 #if defined(PARSEC_HAVE_MPI)
     {
+        /* let runtime_comm_thread_multiple decide how the runtime uses MPI */
         int provided;
-        MPI_Init_thread(&argc, &argv, MPI_THREAD_SERIALIZED, &provided);
+        MPI_Init_thread(NULL, NULL, MPI_THREAD_MULTIPLE, &provided);
     }
     MPI_Comm_size(MPI_COMM_WORLD, &world);
     MPI_Comm_rank(MPI_COMM_WORLD, &rank);
@@ -35,15 +63,24 @@ int main(int argc, char *argv[])
     rank = 0;
 #endif
 
-    parsec = parsec_init(-1, &argc, &argv);
-
-    size = 256;
+    parsec = parsec_init(-1, &pargc, &pargv);
+    if( NULL == parsec ) {
+        exit(-1);
+    }
 
     dcA = create_and_distribute_data(rank, world, size);
     parsec_data_collection_set_key(dcA, "A");
 
-    nb   = 4 * world;
+    if( nb <= 0 ) nb = 4 * world;
     rtt = rtt_new(dcA, size, nb);
+    if( NULL == rtt ) {
+        exit(-1);
+    }
+
+#if defined(PARSEC_HAVE_MPI)
+    MPI_Barrier(MPI_COMM_WORLD);
+#endif
+    start = take_time();
     rc = parsec_context_add_taskpool(parsec, rtt);
     PARSEC_CHECK_ERROR(rc, "parsec_context_add_taskpool");
 
@@ -52,8 +89,16 @@ int main(int argc, char *argv[])
 
     rc = parsec_context_wait(parsec);
     PARSEC_CHECK_ERROR(rc, "parsec_context_wait");
+    elapsed = (double)diff_time(start, take_time());
 
     parsec_taskpool_free((parsec_taskpool_t*)rtt);
+#if defined(PARSEC_HAVE_MPI)
+    MPI_Allreduce(MPI_IN_PLACE, &elapsed, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+#endif
+    if( (0 == rank) && (world > 1) && (nb > 1) ) {
+        printf("%d hops of %d bytes between %d processes in %.1f %s, %.2f %s per round trip\n",
+               nb - 1, size, world, elapsed, TIMER_UNIT, 2.0 * elapsed / (double)(nb - 1), TIMER_UNIT);
+    }
 
     free_data(dcA);
 
@@ -1,7 +1,12 @@
 parsec_addtest_cmd(apps/stencil ${SHM_TEST_CMD_LIST} apps/stencil/testing_stencil_1D -t 100 -T 100 -N 1000 -M 1000 -I 10 -R 2 -m 1)
+# Compare with apps/stencil to evaluate the locality aware scheduler; add
+# --mca mca_pins papi --mca pins_papi_event PAPI_L3_TCM to count the LLC misses
+parsec_addtest_cmd(apps/stencil:la ${SHM_TEST_CMD_LIST} apps/stencil/testing_stencil_1D -t 100 -T 100 -N 1000 -M 1000 -I 10 -R 2 -m 1 -- --mca mca_sched la)
 if( MPI_C_FOUND )
   parsec_addtest_cmd(apps/stencil:mp ${MPI_TEST_CMD_LIST} 8 apps/stencil/testing_stencil_1D -t 100 -T 100 -N 1000 -M 1000 -I 10 -R 2 -m 1)
   if(TEST apps/stencil:mp)
     set_tests_properties(apps/stencil:mp PROPERTIES DEPENDS launch:mp)
   endif()
+  # Reports the overhead of incremental checkpoints taken every 5 iterations
+  parsec_addtest_cmd(apps/stencil:ckpt:mp ${MPI_TEST_CMD_LIST} 4 apps/stencil/testing_stencil_1D -t 100 -T 100 -N 1000 -M 1000 -I 20 -R 2 -C 5)
 endif( MPI_C_FOUND )
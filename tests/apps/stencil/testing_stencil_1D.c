@@ -5,6 +5,7 @@
  */
 #include "stencil_internal.h"
 #include "tests/tests_timing.h"
+#include "parsec/checkpoint.h"
 
 /* Timming */
 double sync_time_elapsed = 0.0;
@@ -12,6 +13,83 @@ double sync_time_elapsed = 0.0;
 /* Global array of weight */
 DTYPE * weight_1D;
 
+static double stencil_local_checksum(parsec_tiled_matrix_t *A)
+{
+    parsec_data_collection_t *dc = &A->super;
+    double sum = 0.0;
+
+    for(int m = 0; m < A->lmt; m++)
+        for(int n = 0; n < A->lnt; n++) {
+            DTYPE *tile;
+            if( dc->rank_of(dc, m, n) != dc->myrank ) continue;
+            tile = (DTYPE*)parsec_data_get_ptr(dc->data_of(dc, m, n), 0);
+            for(size_t k = 0; k < A->bsiz; k++)
+                sum += (k + 1) * (double)tile[k];
+        }
+    return sum;
+}
+
+/*
+ * Run the stencil in chunks of every iterations, first without and then with
+ * a checkpoint after each chunk, and report the overhead of the checkpoints.
+ * Then scramble the matrix and check that the restart brings back the last
+ * checkpoint.
+ */
+static int stencil_checkpoint(parsec_context_t *parsec, parsec_tiled_matrix_t *A,
+                              int iter, int every, int R, int rank)
+{
+    parsec_data_collection_t *dc = &A->super;
+    parsec_checkpoint_t *ckpt;
+    double t_base, t_ckpt, before, after;
+    char basename[64];
+    int chunks = (iter + every - 1) / every, rc, ret = 0;
+
+    snprintf(basename, sizeof(basename), "stencil_ckpt_%d", (int)getpid());
+    ckpt = parsec_checkpoint_new(dc, basename);
+    if( NULL == ckpt ) return 1;
+    for(int m = 0; m < A->lmt; m++)
+        for(int n = 0; n < A->lnt; n++)
+            if( dc->rank_of(dc, m, n) == dc->myrank )
+                parsec_checkpoint_add(ckpt, dc->data_key(dc, m, n));
+
+    t_base = get_cur_time();
+    for(int c = 0; c < chunks; c++)
+        parsec_stencil_1D(parsec, A, every, R);
+    t_base = get_cur_time() - t_base;
+
+    t_ckpt = get_cur_time();
+    for(int c = 0; c < chunks; c++) {
+        parsec_stencil_1D(parsec, A, every, R);
+        rc = parsec_checkpoint_take(ckpt);
+        if( rc < 0 ) ret = 1;
+    }
+    if( PARSEC_SUCCESS != parsec_checkpoint_wait(ckpt) ) ret = 1;
+    t_ckpt = get_cur_time() - t_ckpt;
+
+    before = stencil_local_checksum(A);
+    parsec_apply( parsec, PARSEC_MATRIX_FULL, A,
+                  (parsec_tiled_matrix_unary_op_t)stencil_1D_init_ops, &R);
+    rc = parsec_checkpoint_restore(ckpt);
+    after = stencil_local_checksum(A);
+    if( (rc < 0) || (before != after) ) {
+        fprintf(stderr, "[%d] restart from checkpoint failed (rc %d, checksum %g instead of %g)\n",
+                rank, rc, after, before);
+        ret = 1;
+    }
+    parsec_checkpoint_free(ckpt);
+    snprintf(basename, sizeof(basename), "stencil_ckpt_%d.%u.data", (int)getpid(), dc->myrank);
+    unlink(basename);
+    snprintf(basename, sizeof(basename), "stencil_ckpt_%d.%u.manifest", (int)getpid(), dc->myrank);
+    unlink(basename);
+
+    if( 0 == rank )
+        printf("Checkpoint every %d iterations: %d chunks in %lf s, %lf s without checkpoints, "
+               "overhead %.2f%% (%lf s per checkpoint)\n",
+               every, chunks, t_ckpt, t_base, 100.0 * (t_ckpt - t_base) / t_base,
+               (t_ckpt - t_base) / chunks);
+    return ret;
+}
+
 int main(int argc, char *argv[])
 {
     parsec_context_t* parsec;
@@ -33,8 +111,10 @@ int main(int argc, char *argv[])
     int cores = -1;
     int iter = 10;
     int R = 1;
+    int ckpt_every = 0;
+    int ret = 0;
 
-    while ((ch = getopt(argc, argv, "m:M:N:t:T:s:S:P:Q:c:I:R:h:")) != -1) {
+    while ((ch = getopt(argc, argv, "m:M:N:t:T:s:S:P:Q:c:I:R:C:h:")) != -1) {
         switch (ch) {
             case 'm': m = atoi(optarg); break;
             case 'M': M = atoi(optarg); break;
@@ -47,6 +127,7 @@ int main(int argc, char *argv[])
             case 'c': cores = atoi(optarg); break;
             case 'I': iter = atoi(optarg); break;
             case 'R': R = atoi(optarg); break;
+            case 'C': ckpt_every = atoi(optarg); break;
             case '?': case 'h': default:
                 fprintf(stderr,
                         "-m : initialize MPI_THREAD_MULTIPLE (default: 0/no)\n"
@@ -60,6 +141,7 @@ int main(int argc, char *argv[])
                         "-c : number of cores used (default: -1/all cores)\n"
                         "-I : iterations (default: 10)\n"
                         "-R : radius (default: 1)\n"
+                        "-C : checkpoint every C iterations and report the overhead (default: 0/no)\n"
                         "\n");
                  exit(1);
         }
@@ -196,6 +278,9 @@ int main(int argc, char *argv[])
                            N, NB, M, MB, P, nodes/P, KP, KQ, iter, R, LOOPGEN,
                            MMB, cores, gflops=(flops/1e9)/sync_time_elapsed));
 
+    if( ckpt_every > 0 )
+        ret = stencil_checkpoint(parsec, (parsec_tiled_matrix_t *)&dcA, iter, ckpt_every, R, rank);
+
     parsec_data_free(dcA.mat);
     parsec_tiled_matrix_destroy((parsec_tiled_matrix_t*)&dcA);
 
@@ -207,5 +292,5 @@ int main(int argc, char *argv[])
 #endif
 
 
-    return 0;
+    return ret;
 }
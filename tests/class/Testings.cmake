@@ -2,6 +2,9 @@ if(TARGET atomics)
   add_test(class/atomics ${SHM_TEST_CMD_LIST} class/atomics -c 4)
 endif()
 add_test(class/rwlock ${SHM_TEST_CMD_LIST} class/rwlock -c 4)
+add_test(class/barrier ${SHM_TEST_CMD_LIST} class/barrier -m 0 -M 17 -n 500)
+add_test(class/mpmc_ring ${SHM_TEST_CMD_LIST} class/mpmc_ring -c 4 -b 8)
+add_test(class/mpmc_ring:single ${SHM_TEST_CMD_LIST} class/mpmc_ring -c 8 -b 1 -s 16)
 add_test(class/lifo ${SHM_TEST_CMD_LIST} class/lifo -c 4)
 add_test(class/list ${SHM_TEST_CMD_LIST} class/list -c 4)
 add_test(class/hash ${SHM_TEST_CMD_LIST} class/hash -\# 65536 -r 4 -n)
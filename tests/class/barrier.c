@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2026      The University of Tennessee and The University
+ *                         of Tennessee Research Foundation.  All rights
+ *                         reserved.
+ */
+
+#include "parsec/runtime.h"
+#include <pthread.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <signal.h>
+#include "parsec/sys/atomic.h"
+#include "parsec/class/barrier.h"
+#include "parsec/os-spec-timing.h"
+
+/* Every thread goes through the barrier many times, checking at each round
+ * that nobody left the barrier before everybody arrived, and that exactly
+ * one thread per round was told it completed the barrier. */
+
+static parsec_barrier_t barrier;
+static volatile int32_t arrived = 0;
+static volatile int32_t serial = 0;
+static int nb_loops = 1000;
+static int nb_participants;
+
+static void *do_test(void *param)
+{
+    int l;
+    parsec_time_t t0, t1;
+
+    (void)param;
+    parsec_barrier_wait(&barrier);
+    t0 = take_time();
+    for(l = 0; l < nb_loops; l++) {
+        parsec_atomic_fetch_inc_int32(&arrived);
+        if( 0 != parsec_barrier_wait(&barrier) )
+            parsec_atomic_fetch_inc_int32(&serial);
+        if( arrived != (l + 1) * nb_participants ) {
+            fprintf(stderr, "round %d: %d threads arrived instead of %d\n",
+                    l, arrived, (l + 1) * nb_participants);
+            raise(SIGABRT);
+        }
+        parsec_barrier_wait(&barrier);
+    }
+    t1 = take_time();
+
+    return (void*)(uintptr_t)diff_time(t0, t1);
+}
+
+int main(int argc, char *argv[])
+{
+    pthread_t *threads;
+    int ch, e, minthreads = 0, maxthreads = 0, nbthreads;
+    char *m;
+    uint64_t maxtime;
+    void *retval;
+
+    while( (ch = getopt(argc, argv, "c:m:M:n:h?")) != -1 ) {
+        switch(ch) {
+        case 'c':
+            minthreads = maxthreads = strtol(optarg, &m, 0);
+            break;
+        case 'm':
+            minthreads = strtol(optarg, &m, 0);
+            break;
+        case 'M':
+            maxthreads = strtol(optarg, &m, 0);
+            break;
+        case 'n':
+            nb_loops = strtol(optarg, &m, 0);
+            break;
+        case 'h':
+        case '?':
+        default:
+            fprintf(stderr, "Usage: %s [-c nbthreads|-m minthreads -M maxthreads] [-n nbloops]\n", argv[0]);
+            exit(1);
+            break;
+        }
+    }
+
+    if( (minthreads < 0) || (maxthreads < minthreads) || (nb_loops <= 0) ) {
+        fprintf(stderr, "Usage: %s [-c nbthreads|-m minthreads -M maxthreads] [-n nbloops]\n", argv[0]);
+        exit(1);
+    }
+
+    threads = (pthread_t*)calloc(maxthreads + 1, sizeof(pthread_t));
+
+    for( nbthreads = minthreads; nbthreads <= maxthreads; nbthreads++) {
+        nb_participants = nbthreads + 1;
+        arrived = 0;
+        serial = 0;
+        parsec_barrier_init(&barrier, NULL, nb_participants);
+
+        for(e = 0; e < nbthreads; e++) {
+            pthread_create(&threads[e], NULL, do_test, NULL);
+        }
+        maxtime = (uint64_t)(uintptr_t)do_test(NULL);
+        for(e = 0; e < nbthreads; e++) {
+            pthread_join(threads[e], &retval);
+            if( (uint64_t)(uintptr_t)retval > maxtime )
+                maxtime = (uint64_t)(uintptr_t)retval;
+        }
+        parsec_barrier_destroy(&barrier);
+        if( serial != nb_loops ) {
+            fprintf(stderr, "%d threads: %d barrier completions reported instead of %d\n",
+                    nb_participants, serial, nb_loops);
+            raise(SIGABRT);
+        }
+        printf("%d threads %"PRIu64" "TIMER_UNIT" (%d barriers)\n", nb_participants, maxtime, 2 * nb_loops);
+        fflush(stdout);
+    }
+    free(threads);
+    return 0;
+}
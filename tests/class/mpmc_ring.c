@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2026      The University of Tennessee and The University
+ *                         of Tennessee Research Foundation.  All rights
+ *                         reserved.
+ */
+
+#include "parsec/runtime.h"
+#include <pthread.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <signal.h>
+#include <sched.h>
+#include "parsec/sys/atomic.h"
+#include "parsec/class/mpmc_ring.h"
+#include "parsec/class/dequeue.h"
+#include "parsec/class/barrier.h"
+#include "parsec/os-spec-timing.h"
+
+/* Half of the threads produce numbered elements and the other half consume
+ * them, first through a bounded MPMC ring and then through a dequeue. Every
+ * element must be received exactly once, and each consumer must see the
+ * elements of a given producer in order. */
+
+static parsec_mpmc_ring_t ring;
+static parsec_dequeue_t   dequeue;
+static parsec_barrier_t   barrier;
+static int nb_producers, nb_consumers, nb_elems = 100000, batch = 8;
+static volatile int32_t nb_received = 0;
+static volatile int64_t checksum = 0;
+static parsec_list_item_t *items;  /* elements pushed in the dequeue */
+
+#define ELEM(p, i)     ((void*)(uintptr_t)(((uint64_t)(p) << 32) | (uint64_t)((i) + 1)))
+#define ELEM_PROD(e)   ((int)((uint64_t)(uintptr_t)(e) >> 32))
+#define ELEM_INDEX(e)  ((int)((uint64_t)(uintptr_t)(e) & 0xffffffff) - 1)
+
+static void check_order(int *last, void *e)
+{
+    int p = ELEM_PROD(e), i = ELEM_INDEX(e);
+    if( (p >= nb_producers) || (i <= last[p]) || (i >= nb_elems) ) {
+        fprintf(stderr, "element %d of producer %d received after element %d\n", i, p, last[p]);
+        raise(SIGABRT);
+    }
+    last[p] = i;
+}
+
+static void *ring_producer(void *param)
+{
+    int p = (int)(intptr_t)param, i = 0, k, nb;
+    void *elems[64];
+
+    parsec_barrier_wait(&barrier);
+    while( i < nb_elems ) {
+        nb = (nb_elems - i) < batch ? (nb_elems - i) : batch;
+        for( k = 0; k < nb; k++ ) elems[k] = ELEM(p, i + k);
+        k = parsec_mpmc_ring_push_batch(&ring, elems, nb);
+        if( 0 == k ) sched_yield();  /* the ring is full */
+        i += k;
+    }
+    parsec_barrier_wait(&barrier);
+    return NULL;
+}
+
+static void *ring_consumer(void *param)
+{
+    int *last = (int*)malloc(nb_producers * sizeof(int)), k, nb;
+    int64_t sum = 0;
+    void *elems[64];
+
+    for( k = 0; k < nb_producers; k++ ) last[k] = -1;
+    parsec_barrier_wait(&barrier);
+    while( nb_received < nb_producers * nb_elems ) {
+        nb = parsec_mpmc_ring_pop_batch(&ring, elems, batch);
+        for( k = 0; k < nb; k++ ) {
+            check_order(last, elems[k]);
+            sum += ELEM_INDEX(elems[k]);
+        }
+        if( nb > 0 ) parsec_atomic_fetch_add_int32(&nb_received, nb);
+        else sched_yield();
+    }
+    parsec_atomic_fetch_add_int64(&checksum, sum);
+    parsec_barrier_wait(&barrier);
+    free(last);
+    (void)param;
+    return NULL;
+}
+
+static void *dequeue_producer(void *param)
+{
+    int p = (int)(intptr_t)param;
+
+    parsec_barrier_wait(&barrier);
+    for( int i = 0; i < nb_elems; i++ ) {
+        parsec_dequeue_push_back(&dequeue, &items[p * nb_elems + i]);
+    }
+    parsec_barrier_wait(&barrier);
+    return NULL;
+}
+
+static void *dequeue_consumer(void *param)
+{
+    int *last = (int*)malloc(nb_producers * sizeof(int)), k;
+    int64_t sum = 0;
+    parsec_list_item_t *item;
+
+    for( k = 0; k < nb_producers; k++ ) last[k] = -1;
+    parsec_barrier_wait(&barrier);
+    while( nb_received < nb_producers * nb_elems ) {
+        if( NULL == (item = parsec_dequeue_try_pop_front(&dequeue)) ) {
+            sched_yield();
+            continue;
+        }
+        k = (int)(item - items);
+        check_order(last, ELEM(k / nb_elems, k % nb_elems));
+        sum += k % nb_elems;
+        parsec_atomic_fetch_inc_int32(&nb_received);
+    }
+    parsec_atomic_fetch_add_int64(&checksum, sum);
+    parsec_barrier_wait(&barrier);
+    free(last);
+    (void)param;
+    return NULL;
+}
+
+static uint64_t run(const char *name, void *(*producer)(void*), void *(*consumer)(void*))
+{
+    pthread_t *threads = (pthread_t*)calloc(nb_producers + nb_consumers, sizeof(pthread_t));
+    int64_t expected = (int64_t)nb_producers * ((int64_t)nb_elems * (nb_elems - 1) / 2);
+    parsec_time_t t0, t1;
+    uint64_t duration;
+
+    nb_received = 0;
+    checksum = 0;
+    parsec_barrier_init(&barrier, NULL, nb_producers + nb_consumers + 1);
+    for( int t = 0; t < nb_producers; t++ )
+        pthread_create(&threads[t], NULL, producer, (void*)(intptr_t)t);
+    for( int t = 0; t < nb_consumers; t++ )
+        pthread_create(&threads[nb_producers + t], NULL, consumer, NULL);
+    parsec_barrier_wait(&barrier);
+    t0 = take_time();
+    parsec_barrier_wait(&barrier);
+    t1 = take_time();
+    for( int t = 0; t < nb_producers + nb_consumers; t++ )
+        pthread_join(threads[t], NULL);
+    parsec_barrier_destroy(&barrier);
+    free(threads);
+
+    duration = diff_time(t0, t1);
+    if( (nb_received != nb_producers * nb_elems) || (checksum != expected) ) {
+        fprintf(stderr, "%s: received %d elements instead of %d (checksum %lld instead of %lld)\n",
+                name, nb_received, nb_producers * nb_elems, (long long)checksum, (long long)expected);
+        raise(SIGABRT);
+    }
+    printf("%-8s %d producers %d consumers: %"PRIu64" "TIMER_UNIT" for %d elements\n",
+           name, nb_producers, nb_consumers, duration, nb_producers * nb_elems);
+    fflush(stdout);
+    return duration;
+}
+
+int main(int argc, char *argv[])
+{
+    int ch, nb_threads = 4, capacity = 256;
+    char *m;
+
+    while( (ch = getopt(argc, argv, "c:n:b:s:h?")) != -1 ) {
+        switch(ch) {
+        case 'c': nb_threads = strtol(optarg, &m, 0); break;
+        case 'n': nb_elems = strtol(optarg, &m, 0); break;
+        case 'b': batch = strtol(optarg, &m, 0); break;
+        case 's': capacity = strtol(optarg, &m, 0); break;
+        case 'h':
+        case '?':
+        default:
+            fprintf(stderr, "Usage: %s [-c nbthreads] [-n elements per producer] [-b batch size (<= 64)] [-s ring capacity]\n", argv[0]);
+            exit(1);
+        }
+    }
+    if( (nb_threads < 2) || (nb_elems <= 0) || (batch <= 0) || (batch > 64) || (capacity <= 0) ) {
+        fprintf(stderr, "Usage: %s [-c nbthreads] [-n elements per producer] [-b batch size (<= 64)] [-s ring capacity]\n", argv[0]);
+        exit(1);
+    }
+    nb_producers = nb_threads / 2;
+    nb_consumers = nb_threads - nb_producers;
+
+    PARSEC_OBJ_CONSTRUCT(&ring, parsec_mpmc_ring_t);
+    if( PARSEC_SUCCESS != parsec_mpmc_ring_init(&ring, capacity) ) {
+        fprintf(stderr, "Could not allocate a ring of %d elements\n", capacity);
+        exit(1);
+    }
+    run("ring", ring_producer, ring_consumer);
+    if( !parsec_mpmc_ring_is_empty(&ring) || (NULL != parsec_mpmc_ring_pop(&ring)) ) {
+        fprintf(stderr, "ring not empty at the end of the run\n");
+        raise(SIGABRT);
+    }
+    PARSEC_OBJ_DESTRUCT(&ring);
+
+    PARSEC_OBJ_CONSTRUCT(&dequeue, parsec_dequeue_t);
+    items = (parsec_list_item_t*)calloc((size_t)nb_producers * nb_elems, sizeof(parsec_list_item_t));
+    for( int i = 0; i < nb_producers * nb_elems; i++ )
+        PARSEC_OBJ_CONSTRUCT(&items[i], parsec_list_item_t);
+    run("dequeue", dequeue_producer, dequeue_consumer);
+    for( int i = 0; i < nb_producers * nb_elems; i++ )
+        PARSEC_OBJ_DESTRUCT(&items[i]);
+    free(items);
+    PARSEC_OBJ_DESTRUCT(&dequeue);
+
+    return 0;
+}
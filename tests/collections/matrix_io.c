@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2026      The University of Tennessee and The University
+ *                         of Tennessee Research Foundation.  All rights
+ *                         reserved.
+ */
+
+/* Write a matrix with the parallel matrix I/O under one distribution and
+ * storage, read it back under another one, and check every element, for
+ * each of the I/O backends. Also check that the legacy sequential writer
+ * and reader round-trip the local tiles of each process. */
+
+#include "parsec/runtime.h"
+#include "parsec/execution_stream.h"
+#include "parsec/data_dist/matrix/two_dim_rectangle_cyclic.h"
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+static int tile_rows(const parsec_tiled_matrix_t *A, int m)
+{
+    return (m == A->mt-1) ? A->m - m * A->mb : A->mb;
+}
+
+static int tile_cols(const parsec_tiled_matrix_t *A, int n)
+{
+    return (n == A->nt-1) ? A->n - n * A->nb : A->nb;
+}
+
+static int fill_op(parsec_execution_stream_t *es, const parsec_tiled_matrix_t *A,
+                   void *data, int uplo, int m, int n, void *args)
+{
+    double *tile = (double*)data;
+    int ld = (PARSEC_MATRIX_TILE == A->storage) ? A->mb : A->llm;
+    double seed = *(double*)args;
+
+    for( int j = 0; j < tile_cols(A, n); j++ )
+        for( int i = 0; i < tile_rows(A, m); i++ )
+            tile[j * ld + i] = seed + (m * A->mb + i) + 1e5 * (n * A->nb + j);
+    (void)es; (void)uplo;
+    return 0;
+}
+
+static int check_op(parsec_execution_stream_t *es, const parsec_tiled_matrix_t *A,
+                    void *data, int uplo, int m, int n, void *args)
+{
+    double *tile = (double*)data;
+    int ld = (PARSEC_MATRIX_TILE == A->storage) ? A->mb : A->llm;
+    int *errors = (int*)args;
+
+    for( int j = 0; j < tile_cols(A, n); j++ )
+        for( int i = 0; i < tile_rows(A, m); i++ )
+            if( tile[j * ld + i] != (m * A->mb + i) + 1e5 * (n * A->nb + j) )
+                parsec_atomic_fetch_inc_int32(errors);
+    (void)es; (void)uplo;
+    return 0;
+}
+
+int main(int argc, char *argv[])
+{
+    parsec_context_t* parsec;
+    parsec_matrix_block_cyclic_t dcA, dcB;
+    int world = 1, rank = 0, N = 500, NB = 64, ret = 0;
+    const char *modes[] = { "pread", "direct", "mmap" };
+    char filename[64];
+    double zero = 0.0, garbage = -1.0;
+
+#if defined(PARSEC_HAVE_MPI)
+    {
+        int provided;
+        MPI_Init_thread(&argc, &argv, MPI_THREAD_SERIALIZED, &provided);
+    }
+    MPI_Comm_size(MPI_COMM_WORLD, &world);
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#endif
+
+    parsec = parsec_init(-1, &argc, &argv);
+
+    /* A is distributed by rows of processes in tile storage, B by columns of
+     * processes in LAPACK storage */
+    parsec_matrix_block_cyclic_init(&dcA, PARSEC_MATRIX_DOUBLE, PARSEC_MATRIX_TILE,
+                                    rank, NB, NB, N, N, 0, 0, N, N,
+                                    world, 1, 1, 1, 0, 0);
+    dcA.mat = parsec_data_allocate((size_t)dcA.super.nb_local_tiles *
+                                   (size_t)dcA.super.bsiz *
+                                   (size_t)parsec_datadist_getsizeoftype(dcA.super.mtype));
+    parsec_data_collection_set_key(&dcA.super.super, "A");
+    parsec_matrix_block_cyclic_init(&dcB, PARSEC_MATRIX_DOUBLE, PARSEC_MATRIX_LAPACK,
+                                    rank, NB, NB, N, N, 0, 0, N, N,
+                                    1, world, 1, 1, 0, 0);
+    dcB.mat = parsec_data_allocate((size_t)dcB.super.llm * (size_t)dcB.super.lln *
+                                   (size_t)parsec_datadist_getsizeoftype(dcB.super.mtype));
+    parsec_data_collection_set_key(&dcB.super.super, "B");
+
+    snprintf(filename, sizeof(filename), "matrix_io_%d.bin", (int)getpid());
+#if defined(PARSEC_HAVE_MPI)
+    {
+        int pid = (int)getpid();
+        MPI_Bcast(&pid, 1, MPI_INT, 0, MPI_COMM_WORLD);
+        snprintf(filename, sizeof(filename), "matrix_io_%d.bin", pid);
+    }
+#endif
+
+    parsec_apply(parsec, PARSEC_MATRIX_FULL, &dcA.super, fill_op, &zero);
+    for( int mode = PARSEC_MATRIX_IO_PREAD; mode <= PARSEC_MATRIX_IO_MMAP; mode++ ) {
+        int errors = 0, rc;
+
+        parsec_apply(parsec, PARSEC_MATRIX_FULL, &dcB.super, fill_op, &garbage);
+        rc = parsec_tiled_matrix_io_write(parsec, &dcA.super, filename, mode);
+#if defined(PARSEC_HAVE_MPI)
+        MPI_Barrier(MPI_COMM_WORLD);
+#endif
+        if( PARSEC_SUCCESS == rc )
+            rc = parsec_tiled_matrix_io_read(parsec, &dcB.super, filename, mode);
+        parsec_apply(parsec, PARSEC_MATRIX_FULL, &dcB.super, check_op, &errors);
+#if defined(PARSEC_HAVE_MPI)
+        MPI_Allreduce(MPI_IN_PLACE, &errors, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+        MPI_Allreduce(MPI_IN_PLACE, &rc, 1, MPI_INT, MPI_MIN, MPI_COMM_WORLD);
+        MPI_Barrier(MPI_COMM_WORLD);
+#endif
+        if( 0 == rank ) {
+            printf("matrix I/O %-6s: %s (%d wrong elements)\n", modes[mode],
+                   (PARSEC_SUCCESS == rc && 0 == errors) ? "PASSED" : "FAILED", errors);
+            unlink(filename);
+        }
+        if( (PARSEC_SUCCESS != rc) || (0 != errors) ) ret = 1;
+    }
+
+    /* The legacy functions write and read the local tiles in a file per process */
+    {
+        char seqname[80];
+        int errors = 0, rc;
+
+        snprintf(seqname, sizeof(seqname), "%s.%d", filename, rank);
+        rc = parsec_tiled_matrix_data_write(&dcA.super, seqname);
+        parsec_apply(parsec, PARSEC_MATRIX_FULL, &dcA.super, fill_op, &garbage);
+        if( PARSEC_SUCCESS == rc )
+            rc = parsec_tiled_matrix_data_read(&dcA.super, seqname);
+        parsec_apply(parsec, PARSEC_MATRIX_FULL, &dcA.super, check_op, &errors);
+        unlink(seqname);
+#if defined(PARSEC_HAVE_MPI)
+        MPI_Allreduce(MPI_IN_PLACE, &errors, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+        MPI_Allreduce(MPI_IN_PLACE, &rc, 1, MPI_INT, MPI_MIN, MPI_COMM_WORLD);
+#endif
+        if( 0 == rank ) {
+            printf("matrix I/O legacy: %s (%d wrong elements)\n",
+                   (PARSEC_SUCCESS == rc && 0 == errors) ? "PASSED" : "FAILED", errors);
+        }
+        if( (PARSEC_SUCCESS != rc) || (0 != errors) ) ret = 1;
+    }
+
+    parsec_data_free(dcA.mat);
+    parsec_tiled_matrix_destroy((parsec_tiled_matrix_t*)&dcA);
+    parsec_data_free(dcB.mat);
+    parsec_tiled_matrix_destroy((parsec_tiled_matrix_t*)&dcB);
+
+    parsec_fini(&parsec);
+#if defined(PARSEC_HAVE_MPI)
+    MPI_Finalize();
+#endif
+    return ret;
+}
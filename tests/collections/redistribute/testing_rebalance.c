@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2026      The University of Tennessee and The University
+ *                         of Tennessee Research Foundation.  All rights
+ *                         reserved.
+ */
+
+/* Make the tasks on the tiles of rank 0 much longer than the others, measure
+ * them, rebalance the matrix according to the measures, and check that the
+ * new distribution is the same everywhere, has a lower makespan, and holds
+ * the same data. */
+
+#include "parsec/runtime.h"
+#include "parsec/execution_stream.h"
+#include "parsec/data_dist/matrix/two_dim_rectangle_cyclic.h"
+#include "parsec/data_dist/matrix/redistribute/rebalance.h"
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#define HEAVY_US 2000
+#define LIGHT_US 100
+
+static double value(const parsec_tiled_matrix_t *A, int m, int n, int i, int j)
+{
+    return (m * A->mb + i) + 1e4 * (n * A->nb + j);
+}
+
+static int heavy(const parsec_tiled_matrix_t *A, int m, int n)
+{
+    return 0 == ((parsec_data_collection_t*)A)->rank_of((parsec_data_collection_t*)A, m, n);
+}
+
+static int fill_op(parsec_execution_stream_t *es, const parsec_tiled_matrix_t *A,
+                   void *data, int uplo, int m, int n, void *args)
+{
+    double *tile = (double*)data;
+
+    for( int j = 0; j < A->nb; j++ )
+        for( int i = 0; i < A->mb; i++ )
+            tile[j * A->mb + i] = value(A, m, n, i, j);
+    usleep(heavy(A, m, n) ? HEAVY_US : LIGHT_US);
+    (void)es; (void)uplo; (void)args;
+    return 0;
+}
+
+static double makespan(const double *costs, const uint32_t *owners, int nb_tiles, int nodes)
+{
+    double *load = (double*)calloc(nodes, sizeof(double)), max = 0.0;
+    for( int k = 0; k < nb_tiles; k++ ) load[owners[k]] += costs[k];
+    for( int r = 0; r < nodes; r++ ) if( load[r] > max ) max = load[r];
+    free(load);
+    return max;
+}
+
+int main(int argc, char *argv[])
+{
+    parsec_context_t* parsec;
+    parsec_matrix_block_cyclic_t dcA;
+    parsec_matrix_tabular_t dcB;
+    parsec_matrix_rebalance_monitor_t *monitor;
+    parsec_two_dim_td_table_t *table;
+    parsec_data_collection_t *A, *B;
+    int world = 1, rank = 0, NB = 16, T = 8, ret = 0, moves, nb_tiles;
+    uint32_t *owners_before, *owners_after, *owners_max;
+    double *costs, hsum = 0.0, lsum = 0.0, before, after;
+    int nh = 0, nl = 0, errors = 0;
+
+#if defined(PARSEC_HAVE_MPI)
+    {
+        int provided;
+        MPI_Init_thread(&argc, &argv, MPI_THREAD_SERIALIZED, &provided);
+    }
+    MPI_Comm_size(MPI_COMM_WORLD, &world);
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#endif
+
+    parsec = parsec_init(-1, &argc, &argv);
+
+    parsec_matrix_block_cyclic_init(&dcA, PARSEC_MATRIX_DOUBLE, PARSEC_MATRIX_TILE,
+                                    rank, NB, NB, T * NB, T * NB, 0, 0, T * NB, T * NB,
+                                    1, world, 1, 1, 0, 0);
+    dcA.mat = parsec_data_allocate((size_t)dcA.super.nb_local_tiles * (size_t)dcA.super.bsiz *
+                                   (size_t)parsec_datadist_getsizeoftype(dcA.super.mtype));
+    parsec_data_collection_set_key(&dcA.super.super, "A");
+    A = &dcA.super.super;
+    nb_tiles = dcA.super.lmt * dcA.super.lnt;
+    costs = (double*)calloc(nb_tiles, sizeof(double));
+
+    /* Measure the tasks, or make up the costs without PINS */
+    monitor = parsec_matrix_rebalance_monitor_start(parsec, &dcA.super);
+    parsec_apply(parsec, PARSEC_MATRIX_FULL, &dcA.super, fill_op, NULL);
+    if( NULL != monitor ) {
+        parsec_matrix_rebalance_monitor_stop(monitor, costs);
+    } else {
+        for( int n = 0; n < T; n++ )
+            for( int m = 0; m < T; m++ )
+                costs[n * T + m] = heavy(&dcA.super, m, n) ? HEAVY_US : LIGHT_US;
+    }
+    for( int n = 0; n < T; n++ ) {
+        for( int m = 0; m < T; m++ ) {
+            if( heavy(&dcA.super, m, n) ) { hsum += costs[n * T + m]; nh++; }
+            else                          { lsum += costs[n * T + m]; nl++; }
+        }
+    }
+    if( (0 == nh) || (hsum / nh <= 0.0) || ((nl > 0) && (hsum / nh <= lsum / nl)) ) {
+        fprintf(stderr, "[%d] heavy tiles measured %g, light tiles %g\n",
+                rank, hsum / (nh ? nh : 1), lsum / (nl ? nl : 1));
+        ret = 1;
+    }
+
+    /* The budget of moves is respected */
+    moves = parsec_matrix_rebalance_table(&dcA.super, costs, 0.0, 1, &table);
+    if( (moves < 0) || (moves > 1) ) {
+        fprintf(stderr, "[%d] %d tiles moved with a budget of 1\n", rank, moves);
+        ret = 1;
+    }
+    if( moves >= 0 ) free(table);
+
+    /* Rebalance and migrate */
+    owners_before = (uint32_t*)malloc(nb_tiles * sizeof(uint32_t));
+    owners_after  = (uint32_t*)malloc(nb_tiles * sizeof(uint32_t));
+    owners_max    = (uint32_t*)malloc(nb_tiles * sizeof(uint32_t));
+    for( int n = 0; n < T; n++ )
+        for( int m = 0; m < T; m++ )
+            owners_before[n * T + m] = A->rank_of(A, m, n);
+    moves = parsec_matrix_rebalance(parsec, &dcA.super, costs, 0.1, -1, &dcB);
+    if( moves < 0 ) {
+        fprintf(stderr, "[%d] rebalance failed (%d)\n", rank, moves);
+        ret = 1;
+        goto done;
+    }
+    B = &dcB.super.super;
+    for( int n = 0; n < T; n++ )
+        for( int m = 0; m < T; m++ )
+            owners_after[n * T + m] = B->rank_of(B, m, n);
+
+    before = makespan(costs, owners_before, nb_tiles, world);
+    after  = makespan(costs, owners_after, nb_tiles, world);
+    if( (world > 1) && ((0 == moves) || (after >= before)) ) {
+        fprintf(stderr, "[%d] %d tiles moved, makespan %g -> %g\n", rank, moves, before, after);
+        ret = 1;
+    }
+
+    /* Every process computed the same distribution */
+    memcpy(owners_max, owners_after, nb_tiles * sizeof(uint32_t));
+#if defined(PARSEC_HAVE_MPI)
+    MPI_Allreduce(MPI_IN_PLACE, owners_max, nb_tiles, MPI_UINT32_T, MPI_MAX, MPI_COMM_WORLD);
+#endif
+    if( 0 != memcmp(owners_max, owners_after, nb_tiles * sizeof(uint32_t)) ) {
+        fprintf(stderr, "[%d] the processes disagree on the new distribution\n", rank);
+        ret = 1;
+    }
+
+    /* The data followed the tiles */
+    for( int n = 0; n < T; n++ ) {
+        for( int m = 0; m < T; m++ ) {
+            if( B->rank_of(B, m, n) != (uint32_t)rank ) continue;
+            double *tile = (double*)parsec_data_copy_get_ptr(parsec_data_get_copy(B->data_of(B, m, n), 0));
+            for( int j = 0; j < NB; j++ )
+                for( int i = 0; i < NB; i++ )
+                    if( tile[j * NB + i] != value(&dcA.super, m, n, i, j) ) errors++;
+        }
+    }
+    if( errors > 0 ) {
+        fprintf(stderr, "[%d] %d wrong elements after the migration\n", rank, errors);
+        ret = 1;
+    }
+    if( 0 == rank ) {
+        printf("%d tiles moved, makespan %g -> %g\n", moves, before, after);
+    }
+    parsec_matrix_tabular_destroy(&dcB);
+
+  done:
+#if defined(PARSEC_HAVE_MPI)
+    MPI_Allreduce(MPI_IN_PLACE, &ret, 1, MPI_INT, MPI_MAX, MPI_COMM_WORLD);
+#endif
+    free(owners_before); free(owners_after); free(owners_max);
+    free(costs);
+    parsec_data_free(dcA.mat);
+    parsec_tiled_matrix_destroy(&dcA.super);
+    parsec_fini(&parsec);
+#if defined(PARSEC_HAVE_MPI)
+    MPI_Finalize();
+#endif
+    return ret;
+}
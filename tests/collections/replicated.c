@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2026      The University of Tennessee and The University
+ *                         of Tennessee Research Foundation.  All rights
+ *                         reserved.
+ */
+
+/* Fill each replica of a 2.5D matrix with a multiple of a reference matrix,
+ * each layer working independently on its own replicas, and check that the
+ * replicated reduction folds them in layer 0, and in every layer when the
+ * result is broadcast. */
+
+#include "parsec/runtime.h"
+#include "parsec/execution_stream.h"
+#include "parsec/data_dist/matrix/two_dim_rectangle_cyclic_replicated.h"
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+static parsec_matrix_block_cyclic_replicated_t dcA;
+
+static double reference(const parsec_tiled_matrix_t *A, int m, int n, int i, int j)
+{
+    return (m * A->mb + i) + 1e4 * (n * A->nb + j);
+}
+
+static int fill_op(parsec_execution_stream_t *es, const parsec_tiled_matrix_t *A,
+                   void *data, int uplo, int m, int n, void *args)
+{
+    double *tile = (double*)data;
+
+    for( int j = 0; j < A->nb; j++ )
+        for( int i = 0; i < A->mb; i++ )
+            tile[j * A->mb + i] = (dcA.layer + 1) * reference(A, m, n, i, j);
+    (void)es; (void)uplo; (void)args;
+    return 0;
+}
+
+static int sum_op(parsec_execution_stream_t *es, const void *src, void *dst, void *op_data, ...)
+{
+    const parsec_tiled_matrix_t *A = (const parsec_tiled_matrix_t*)op_data;
+    const double *s = (const double*)src;
+    double *d = (double*)dst;
+
+    for( size_t k = 0; k < A->bsiz; k++ )
+        d[k] += s[k];
+    (void)es;
+    return 0;
+}
+
+/* Count the local elements that differ from factor times the reference */
+static int check(double factor)
+{
+    parsec_tiled_matrix_t *A = &dcA.super.super;
+    parsec_data_collection_t *o = &A->super;
+    int errors = 0;
+
+    for( int m = 0; m < A->mt; m++ ) {
+        for( int n = 0; n < A->nt; n++ ) {
+            if( o->rank_of(o, m, n) != o->myrank ) continue;
+            double *tile = (double*)parsec_data_copy_get_ptr(parsec_data_get_copy(o->data_of(o, m, n), 0));
+            for( int j = 0; j < A->nb; j++ )
+                for( int i = 0; i < A->mb; i++ )
+                    if( tile[j * A->mb + i] != factor * reference(A, m, n, i, j) )
+                        errors++;
+        }
+    }
+    return errors;
+}
+
+int main(int argc, char *argv[])
+{
+    parsec_context_t* parsec;
+    parsec_data_collection_t *o;
+    int world = 1, rank = 0, N = 300, NB = 32, P = 1, c = 1, ch, ret = 0;
+    int errors = 0, folded;
+
+#if defined(PARSEC_HAVE_MPI)
+    {
+        int provided;
+        MPI_Init_thread(&argc, &argv, MPI_THREAD_SERIALIZED, &provided);
+    }
+    MPI_Comm_size(MPI_COMM_WORLD, &world);
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#endif
+
+    while( (ch = getopt(argc, argv, "c:P:N:t:")) != -1 ) {
+        switch(ch) {
+        case 'c': c = atoi(optarg); break;
+        case 'P': P = atoi(optarg); break;
+        case 'N': N = atoi(optarg); break;
+        case 't': NB = atoi(optarg); break;
+        default:
+            fprintf(stderr, "Usage: %s [-c layers] [-P rows of each layer] [-N size] [-t tile size]\n", argv[0]);
+            exit(1);
+        }
+    }
+    if( (c < 1) || (P < 1) || (0 != world % (c * P)) ) {
+        fprintf(stderr, "The %d processes cannot be arranged in %d layers of %d rows\n", world, c, P);
+        exit(1);
+    }
+    argc -= optind - 1; argv += optind - 1;
+
+    parsec = parsec_init(-1, &argc, &argv);
+
+    parsec_matrix_block_cyclic_replicated_init(&dcA, PARSEC_MATRIX_DOUBLE, PARSEC_MATRIX_TILE,
+                                               rank, NB, NB, N, N, 0, 0, N, N,
+                                               P, world / (c * P), c);
+    dcA.super.mat = parsec_data_allocate((size_t)dcA.super.super.nb_local_tiles *
+                                         (size_t)dcA.super.super.bsiz *
+                                         (size_t)parsec_datadist_getsizeoftype(dcA.super.super.mtype));
+    parsec_data_collection_set_key(&dcA.super.super.super, "A");
+    o = &dcA.super.super.super;
+
+    /* The collection answers with the replica of the local layer, the
+     * layers view with the replica of any layer */
+    for( int m = 0; m < dcA.super.super.mt; m++ ) {
+        for( int n = 0; n < dcA.super.super.nt; n++ ) {
+            uint32_t owner = o->rank_of(o, m, n);
+            if( (int)owner / (world / c) != dcA.layer ) errors++;
+            for( int l = 0; l < c; l++ ) {
+                uint32_t r = dcA.layers.rank_of(&dcA.layers, m, n, l);
+                if( (r != parsec_matrix_block_cyclic_replicated_rank_of_layer(&dcA, m, n, l)) ||
+                    ((int)r / (world / c) != l) ||
+                    (r % (world / c) != owner % (world / c)) )
+                    errors++;
+            }
+        }
+    }
+    if( errors > 0 ) {
+        fprintf(stderr, "[%d] %d wrong owners\n", rank, errors);
+        ret = 1;
+    }
+
+    /* Fold without broadcast: only layer 0 holds the sum */
+    folded = c * (c + 1) / 2;
+    parsec_apply(parsec, PARSEC_MATRIX_FULL, &dcA.super.super, fill_op, NULL);
+    parsec_matrix_block_cyclic_replicated_reduce(parsec, &dcA, sum_op, &dcA.super.super, 0);
+    if( 0 == dcA.layer && 0 != (errors = check(folded)) ) {
+        fprintf(stderr, "[%d] %d wrong elements after the reduction\n", rank, errors);
+        ret = 1;
+    }
+
+    /* Fold and broadcast: every layer holds the sum */
+    parsec_apply(parsec, PARSEC_MATRIX_FULL, &dcA.super.super, fill_op, NULL);
+    parsec_matrix_block_cyclic_replicated_reduce(parsec, &dcA, sum_op, &dcA.super.super, 1);
+    if( 0 != (errors = check(folded)) ) {
+        fprintf(stderr, "[%d] %d wrong elements after the reduction and broadcast\n", rank, errors);
+        ret = 1;
+    }
+
+#if defined(PARSEC_HAVE_MPI)
+    MPI_Allreduce(MPI_IN_PLACE, &ret, 1, MPI_INT, MPI_MAX, MPI_COMM_WORLD);
+#endif
+    if( 0 == rank && 0 == ret ) {
+        printf("%d layers of %d processes: replicated reduction correct\n", c, world / c);
+    }
+
+    parsec_data_free(dcA.super.mat);
+    parsec_matrix_block_cyclic_replicated_destroy(&dcA);
+    parsec_fini(&parsec);
+#if defined(PARSEC_HAVE_MPI)
+    MPI_Finalize();
+#endif
+    return ret;
+}
@@ -11,9 +11,11 @@
 #endif
 
 #include "parsec/data_dist/matrix/two_dim_rectangle_cyclic.h"
+#include "parsec/parsec_internal.h"
 #include "common.h"
 
 #include "avoidable_reshape.h"
+#include "local_reuse_reshape.h"
 
 /* Program to test the different reshaping functionalities
  * Logical equal types on DEFAULT_ADT and data collection result
@@ -91,6 +93,19 @@ int main(int argc, char *argv[])
 
       DO_RUN(ctp);
       DO_CHECK(avoidable_reshape, dcA, dcA_check);
+#ifndef AVOID_UNNECESSARY_RESHAPING
+      {
+          /* The datatypes describe the same layout, but the consumers write
+           * the data: the input copies must not have been reused */
+          int64_t nb_copies, nb_bytes;
+          parsec_reshape_avoided_copies(&nb_copies, &nb_bytes);
+          if( 0 != nb_copies ) {
+              printf("Test avoidable_reshape FAILED: %"PRId64" input copies reused by writing consumers\n",
+                     nb_copies);
+              ret |= 1;
+          }
+      }
+#endif
 
 #ifdef AVOID_UNNECESSARY_RESHAPING
       adt_default.opaque_dtt = tmp;
@@ -98,6 +113,40 @@ int main(int argc, char *argv[])
 
     }
 
+    /*******************
+     * Same layout reshape consumed by a READ and a RW flow: the RW consumer
+     * must not get the input copy.
+     *******************/
+    parsec_apply( parsec, PARSEC_MATRIX_FULL,
+                  (parsec_tiled_matrix_t *)&dcA,
+                  (parsec_tiled_matrix_unary_op_t)reshape_set_matrix_value_count, &op_args);
+    {
+      parsec_matrix_block_cyclic_t dcB;
+      parsec_local_reuse_reshape_taskpool_t *ctp = NULL;
+
+      parsec_matrix_block_cyclic_init(&dcB, PARSEC_MATRIX_INTEGER, PARSEC_MATRIX_TILE,
+                                rank, MB, NB, M, N, 0, 0,
+                                M, N, P, nodes/P, KP, KQ, 0, 0);
+      dcB.mat = parsec_data_allocate((size_t)dcB.super.nb_local_tiles *
+                                     (size_t)dcB.super.bsiz *
+                                     (size_t)parsec_datadist_getsizeoftype(dcB.super.mtype));
+      parsec_data_collection_set_key((parsec_data_collection_t*)&dcB, "dcB");
+      parsec_apply( parsec, PARSEC_MATRIX_FULL,
+                    (parsec_tiled_matrix_t *)&dcB,
+                    (parsec_tiled_matrix_unary_op_t)reshape_set_matrix_value, &op_args);
+
+      ctp = parsec_local_reuse_reshape_new((parsec_tiled_matrix_t *)&dcA, (parsec_tiled_matrix_t *)&dcB);
+      ctp->arenas_datatypes[PARSEC_local_reuse_reshape_DEFAULT_ADT_IDX] = adt_default;
+      PARSEC_OBJ_RETAIN(adt_default.arena);
+
+      DO_RUN(ctp);
+      DO_CHECK(local_reuse_reshape_A, dcA, dcA_check);
+      DO_CHECK(local_reuse_reshape_B, dcB, dcA_check);
+
+      parsec_data_free(dcB.mat);
+      parsec_tiled_matrix_destroy((parsec_tiled_matrix_t*)&dcB);
+    }
+
 
     /* Clean up */
     DO_FINI_DATATYPES();
@@ -11,6 +11,7 @@
 #endif
 
 #include "parsec/data_dist/matrix/two_dim_rectangle_cyclic.h"
+#include "parsec/parsec_internal.h"
 #include "common.h"
 
 #include "local_no_reshape.h"
@@ -20,6 +21,7 @@
 #include "remote_read_reshape.h"
 #include "remote_no_re_reshape.h"
 #include "local_input_LU_LL.h"
+#include "local_view_reshape.h"
 
 /* Program to test the different reshaping functionalities
  * Each different test is commented on the main program.
@@ -232,6 +234,56 @@ int main(int argc, char *argv[])
 
 
 
+    /*************************
+     * Local reshape on a read-only input
+     * The same [type] on both sides of a dependency consumed by a READ flow
+     * gives a view on the original tile instead of a new datacopy.
+     * Thus, only the lower part of the tiles is copied into dcB.
+     *************************/
+    parsec_apply( parsec, PARSEC_MATRIX_FULL,
+                  (parsec_tiled_matrix_t *)&dcA,
+                  (parsec_tiled_matrix_unary_op_t)reshape_set_matrix_value, &op_args1);
+
+    op_args2[0] = 0; op_args2[1] = 1;
+    parsec_apply( parsec, PARSEC_MATRIX_FULL,
+                  (parsec_tiled_matrix_t *)&dcA_check,
+                  (parsec_tiled_matrix_unary_op_t)reshape_set_matrix_value_lower_tile, op_args2);
+    {
+      parsec_matrix_block_cyclic_t dcB;
+      parsec_local_view_reshape_taskpool_t *ctp = NULL;
+      int64_t nb_views, nb_bytes, nb_views_before;
+
+      parsec_matrix_block_cyclic_init(&dcB, PARSEC_MATRIX_INTEGER, PARSEC_MATRIX_TILE,
+                                rank, MB, NB, M, N, 0, 0,
+                                M, N, P, nodes/P, KP, KQ, 0, 0);
+      dcB.mat = parsec_data_allocate((size_t)dcB.super.nb_local_tiles *
+                                     (size_t)dcB.super.bsiz *
+                                     (size_t)parsec_datadist_getsizeoftype(dcB.super.mtype));
+      parsec_data_collection_set_key((parsec_data_collection_t*)&dcB, "dcB");
+      parsec_apply( parsec, PARSEC_MATRIX_FULL,
+                    (parsec_tiled_matrix_t *)&dcB,
+                    (parsec_tiled_matrix_unary_op_t)reshape_set_matrix_value, &op_args0);
+
+      parsec_reshape_avoided_copies(&nb_views_before, &nb_bytes);
+      ctp = parsec_local_view_reshape_new((parsec_tiled_matrix_t *)&dcA, (parsec_tiled_matrix_t *)&dcB);
+
+      ctp->arenas_datatypes[PARSEC_local_view_reshape_DEFAULT_ADT_IDX]    = adt_default;
+      ctp->arenas_datatypes[PARSEC_local_view_reshape_LOWER_TILE_ADT_IDX] = adt_lower;
+      PARSEC_OBJ_RETAIN(adt_default.arena);
+      PARSEC_OBJ_RETAIN(adt_lower.arena);
+
+      DO_RUN(ctp);
+      parsec_reshape_avoided_copies(&nb_views, &nb_bytes);
+      if( parsec_param_reshape_view && (dcA.super.nb_local_tiles > 0) && (nb_views == nb_views_before) ) {
+          printf("Test local_view_reshape FAILED: no view was used on rank %d\n", rank);
+          ret |= 1;
+      }
+      DO_CHECK(local_view_reshape, dcB, dcA_check);
+
+      parsec_data_free(dcB.mat);
+      parsec_tiled_matrix_destroy((parsec_tiled_matrix_t*)&dcB);
+    }
+
     /*******************************
      * Local reshape 2 different types LU -> LL
      * Get tile lower and transform into upper
@@ -7,3 +7,9 @@ parsec_addtest_cmd(dsl/ptg/startup1 ${SHM_TEST_CMD_LIST} dsl/ptg/startup -i=10 -
 parsec_addtest_cmd(dsl/ptg/startup2 ${SHM_TEST_CMD_LIST} dsl/ptg/startup -i=10 -j=20 -k=30 -v=5)
 parsec_addtest_cmd(dsl/ptg/startup3 ${SHM_TEST_CMD_LIST} dsl/ptg/startup -i=30 -j=30 -k=30 -v=5)
 parsec_addtest_cmd(dsl/ptg/strange ${SHM_TEST_CMD_LIST} dsl/ptg/strange)
+parsec_addtest_cmd(dsl/ptg/fusion ${SHM_TEST_CMD_LIST} dsl/ptg/fusion -i=64 -k=1000)
+if( MPI_C_FOUND )
+  parsec_addtest_cmd(dsl/ptg/fusion:mp ${MPI_TEST_CMD_LIST} 2 dsl/ptg/fusion -i=8 -k=200 -m)
+endif( MPI_C_FOUND )
+parsec_addtest_cmd(dsl/ptg/fusion:depth1 ${SHM_TEST_CMD_LIST} dsl/ptg/fusion -i=64 -k=200 -- --mca runtime_keep_highest_priority_task_depth 1)
+parsec_addtest_cmd(dsl/ptg/fusion:off ${SHM_TEST_CMD_LIST} dsl/ptg/fusion -i=64 -k=200 -- --mca runtime_task_fusion 0)
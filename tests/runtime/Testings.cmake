@@ -1,2 +1,33 @@
+if( MPI_C_FOUND )
+  parsec_addtest_cmd(runtime/datatype_pack ${SHM_TEST_CMD_LIST} runtime/datatype_pack -n 64 -r 10)
+  parsec_addtest_cmd(runtime/comm_compress ${SHM_TEST_CMD_LIST} runtime/comm_compress -- --mca runtime_comm_compress 1)
+  parsec_addtest_cmd(runtime/comm_compress:mp ${MPI_TEST_CMD_LIST} 4 runtime/comm_compress -- --mca runtime_comm_compress 1)
+  parsec_addtest_cmd(runtime/comm_compress:mp:raw ${MPI_TEST_CMD_LIST} 4 runtime/comm_compress)
+  parsec_addtest_cmd(runtime/remote_dep_ranks ${SHM_TEST_CMD_LIST} runtime/remote_dep_ranks -r 1000)
+  parsec_addtest_cmd(runtime/remote_dep_link ${SHM_TEST_CMD_LIST} runtime/remote_dep_link)
+  parsec_addtest_cmd(runtime/inplace:mp ${MPI_TEST_CMD_LIST} 4 runtime/inplace -- --mca runtime_comm_inplace 1)
+  parsec_addtest_cmd(runtime/inplace:mp:copy ${MPI_TEST_CMD_LIST} 4 runtime/inplace)
+  parsec_addtest_cmd(runtime/put_sched:mp ${MPI_TEST_CMD_LIST} 2 runtime/put_sched -- --mca runtime_comm_put_max_bytes 33554432 --mca runtime_comm_put_peer_max_bytes 8388608 --mca runtime_comm_put_chunk 2097152)
+  parsec_addtest_cmd(runtime/put_sched:mp:fifo ${MPI_TEST_CMD_LIST} 2 runtime/put_sched)
+  parsec_addtest_cmd(runtime/put_sched:mp:chunks ${MPI_TEST_CMD_LIST} 3 runtime/put_sched -t=4 -b=512 -- --mca runtime_comm_put_chunk 65536 --mca runtime_comm_put_peer_max_bytes 262144 --mca runtime_comm_compress 1)
+  parsec_addtest_cmd(runtime/put_sched:mp:stats ${MPI_TEST_CMD_LIST} 2 runtime/put_sched -t=4 -b=512 -- --mca runtime_comm_stats 1 --mca runtime_comm_put_chunk 65536)
+  set_tests_properties(runtime/put_sched:mp:stats PROPERTIES
+    PASS_REGULAR_EXPRESSION "Remote deps on rank [0-9]+: [1-9][0-9]* data"
+    FAIL_REGULAR_EXPRESSION "errors")
+  # 2 hosts emulated on this machine, the rank r being on the host r % 2
+  parsec_addtest_cmd(runtime/host_placement:mp ${MPI_TEST_CMD_LIST} 6 runtime/host_placement -- --mca runtime_comm_emulate_hosts 2 --mca runtime_comm_host_placement 1)
+  parsec_addtest_cmd(runtime/host_placement:mp:plain ${MPI_TEST_CMD_LIST} 6 runtime/host_placement -- --mca runtime_comm_emulate_hosts 2)
+  if( PARSEC_HAVE_SYS_EPOLL_H )
+    parsec_addtest_cmd(runtime/tcp_engine ${SHM_TEST_CMD_LIST} runtime/tcp_engine -n=3 -b=16)
+    parsec_addtest_cmd(runtime/tcp_engine:rdv ${SHM_TEST_CMD_LIST} runtime/tcp_engine -n=3 -t=4 -b=256 -- --mca runtime_comm_tcp_frag 65536)
+    set_tests_properties(runtime/tcp_engine:rdv PROPERTIES ENVIRONMENT "PARSEC_TCP_KEY=tcp_engine_rdv")
+    parsec_addtest_cmd(runtime/tcp_engine:short_adaptive ${SHM_TEST_CMD_LIST} runtime/tcp_engine -n=3 -b=8 -- --mca runtime_comm_short_adaptive 1)
+  endif( PARSEC_HAVE_SYS_EPOLL_H )
+endif( MPI_C_FOUND )
+if( PARSEC_SIM )
+  parsec_addtest_cmd(runtime/sim_replay ${SHM_TEST_CMD_LIST} runtime/sim_replay -n=8 -c=4)
+  parsec_addtest_cmd(runtime/sim_replay:dry ${SHM_TEST_CMD_LIST} runtime/sim_replay -n=8 -c=3 -d)
+endif( PARSEC_SIM )
+
 include(runtime/scheduling/Testings.cmake)
 include(runtime/cuda/Testings.cmake)
@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2026      The University of Tennessee and The University
+ *                         of Tennessee Research Foundation.  All rights
+ *                         reserved.
+ */
+
+/* Check the lossless compressor on compressible and incompressible data,
+ * then exchange all the tiles of a matrix between all the processes (each
+ * tile of a 1 x world distribution goes to the owner in a world x 1
+ * distribution), check the data and report the bandwidth. Run with
+ * --mca runtime_comm_compress 1 to compress the transfers; the runtime
+ * reports the compression ratio at exit. */
+
+#include "parsec/runtime.h"
+#include "parsec/utils/compress.h"
+#include "parsec/data_dist/matrix/two_dim_rectangle_cyclic.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+static double value(int i, int j)
+{
+    return (double)(i % 1024) + 0.5 * (double)j;
+}
+
+/* Round trip through the compressor, returns the compressed size, or 0 if
+ * it did not fit, or -1 on error */
+static long roundtrip(const void *data, size_t len, size_t width)
+{
+    char *buf = (char*)malloc(len), *out = (char*)malloc(len + 1);
+    size_t clen;
+    long ret;
+
+    if( PARSEC_SUCCESS != parsec_compress(data, len, width, buf, len, &clen) ) {
+        ret = 0;
+    } else if( (PARSEC_SUCCESS != parsec_decompress(buf, clen, out, len)) ||
+               (0 != memcmp(data, out, len)) ||
+               (PARSEC_SUCCESS == parsec_decompress(buf, clen, out, len + 1)) ) {
+        ret = -1;
+    } else {
+        ret = (long)clen;
+    }
+    free(buf); free(out);
+    return ret;
+}
+
+static int check_codec(void)
+{
+    size_t n = 100003;  /* not a multiple of the width */
+    double *d = (double*)malloc(n * sizeof(double));
+    unsigned char *r = (unsigned char*)malloc(n);
+    long c;
+    int errors = 0;
+
+    for( size_t i = 0; i < n; i++ ) d[i] = value((int)i, 3);
+    c = roundtrip(d, n * sizeof(double) - 3, sizeof(double));
+    if( c <= 0 ) { fprintf(stderr, "smooth doubles: %ld\n", c); errors++; }
+    c = roundtrip(d, n * sizeof(double), 1);
+    if( c < 0 ) { fprintf(stderr, "smooth doubles without shuffle: %ld\n", c); errors++; }
+
+    memset(r, 7, n);
+    c = roundtrip(r, n, 1);
+    if( (c <= 0) || (c > 1024) ) { fprintf(stderr, "constant bytes: %ld\n", c); errors++; }
+
+    srand(42);
+    for( size_t i = 0; i < n; i++ ) r[i] = (unsigned char)rand();
+    c = roundtrip(r, n, 4);
+    if( 0 != c ) { fprintf(stderr, "random bytes: %ld\n", c); errors++; }
+
+    c = roundtrip(r, 5, 8);
+    if( c < 0 ) { fprintf(stderr, "tiny buffer: %ld\n", c); errors++; }
+
+    free(d); free(r);
+    return errors;
+}
+
+int main(int argc, char *argv[])
+{
+    parsec_context_t* parsec;
+    parsec_matrix_block_cyclic_t dcA, dcB;
+    parsec_data_collection_t *B;
+    int world = 1, rank = 0, NB = 256, T = 0, ch, ret = 0, errors;
+    double t0 = 0.0, t1 = 0.0;
+
+#if defined(PARSEC_HAVE_MPI)
+    {
+        int provided;
+        MPI_Init_thread(&argc, &argv, MPI_THREAD_SERIALIZED, &provided);
+    }
+    MPI_Comm_size(MPI_COMM_WORLD, &world);
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#endif
+
+    while( (ch = getopt(argc, argv, "t:T:")) != -1 ) {
+        switch(ch) {
+        case 't': NB = atoi(optarg); break;
+        case 'T': T = atoi(optarg); break;
+        default:
+            fprintf(stderr, "Usage: %s [-t tile size] [-T tiles per dimension]\n", argv[0]);
+            exit(1);
+        }
+    }
+    argc -= optind - 1; argv += optind - 1;
+    if( T <= 0 ) T = 2 * world;
+
+    parsec = parsec_init(-1, &argc, &argv);
+
+    if( 0 != (errors = check_codec()) ) {
+        fprintf(stderr, "[%d] %d compression round trips failed\n", rank, errors);
+        ret = 1;
+    }
+
+    parsec_matrix_block_cyclic_init(&dcA, PARSEC_MATRIX_DOUBLE, PARSEC_MATRIX_TILE,
+                                    rank, NB, NB, T * NB, T * NB, 0, 0, T * NB, T * NB,
+                                    1, world, 1, 1, 0, 0);
+    parsec_matrix_block_cyclic_init(&dcB, PARSEC_MATRIX_DOUBLE, PARSEC_MATRIX_TILE,
+                                    rank, NB, NB, T * NB, T * NB, 0, 0, T * NB, T * NB,
+                                    world, 1, 1, 1, 0, 0);
+    dcA.mat = parsec_data_allocate((size_t)dcA.super.nb_local_tiles * (size_t)dcA.super.bsiz * sizeof(double));
+    dcB.mat = parsec_data_allocate((size_t)dcB.super.nb_local_tiles * (size_t)dcB.super.bsiz * sizeof(double));
+    parsec_data_collection_set_key(&dcA.super.super, "A");
+    parsec_data_collection_set_key(&dcB.super.super, "B");
+    for( int m = 0; m < T; m++ ) {
+        for( int n = 0; n < T; n++ ) {
+            parsec_data_collection_t *A = &dcA.super.super;
+            if( A->rank_of(A, m, n) != (uint32_t)rank ) continue;
+            double *tile = (double*)parsec_data_copy_get_ptr(parsec_data_get_copy(A->data_of(A, m, n), 0));
+            for( int j = 0; j < NB; j++ )
+                for( int i = 0; i < NB; i++ )
+                    tile[j * NB + i] = value(m * NB + i, n * NB + j);
+        }
+    }
+
+#if defined(PARSEC_HAVE_MPI)
+    MPI_Barrier(MPI_COMM_WORLD);
+    t0 = MPI_Wtime();
+#endif
+    parsec_redistribute(parsec, &dcA.super, &dcB.super, T * NB, T * NB, 0, 0, 0, 0);
+#if defined(PARSEC_HAVE_MPI)
+    MPI_Barrier(MPI_COMM_WORLD);
+    t1 = MPI_Wtime();
+#endif
+
+    errors = 0;
+    B = &dcB.super.super;
+    for( int m = 0; m < T; m++ ) {
+        for( int n = 0; n < T; n++ ) {
+            if( B->rank_of(B, m, n) != (uint32_t)rank ) continue;
+            double *tile = (double*)parsec_data_copy_get_ptr(parsec_data_get_copy(B->data_of(B, m, n), 0));
+            for( int j = 0; j < NB; j++ )
+                for( int i = 0; i < NB; i++ )
+                    if( tile[j * NB + i] != value(m * NB + i, n * NB + j) ) errors++;
+        }
+    }
+    if( errors > 0 ) {
+        fprintf(stderr, "[%d] %d wrong elements after the exchange\n", rank, errors);
+        ret = 1;
+    }
+
+#if defined(PARSEC_HAVE_MPI)
+    MPI_Allreduce(MPI_IN_PLACE, &ret, 1, MPI_INT, MPI_MAX, MPI_COMM_WORLD);
+#endif
+    if( (0 == rank) && (0 == ret) ) {
+        /* the tiles on the diagonal of the owners do not move */
+        double moved = (double)T * T * (world - 1) / world * NB * NB * sizeof(double);
+        printf("all2all of %.1f MB between %d processes in %.3f s (%.1f MB/s)\n",
+               moved / 1e6, world, t1 - t0, (t1 > t0) ? moved / 1e6 / (t1 - t0) : 0.0);
+    }
+
+    parsec_data_free(dcA.mat);
+    parsec_data_free(dcB.mat);
+    parsec_tiled_matrix_destroy(&dcA.super);
+    parsec_tiled_matrix_destroy(&dcB.super);
+    parsec_fini(&parsec);
+#if defined(PARSEC_HAVE_MPI)
+    MPI_Finalize();
+#endif
+    return ret;
+}
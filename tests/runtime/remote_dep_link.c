@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2026      The University of Tennessee and The University
+ *                         of Tennessee Research Foundation.  All rights
+ *                         reserved.
+ */
+
+/* Check the model of the links used to adapt the short limit to each peer
+ * (runtime_comm_short_adaptive): puts of varied sizes on a simulated link of
+ * known latency and bandwidth, with some jitter, must move the limit to the
+ * bandwidth-delay product of the link, capped by the configured limit, and
+ * follow the link when its bandwidth changes. Puts all of the same size must
+ * leave the limit alone. */
+
+#include "parsec/parsec_config.h"
+#include "parsec/parsec_internal.h"
+#include "parsec/remote_dep.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define MAX_LIMIT 1024
+
+/* Feed nb puts to the link, the bytes ahead of each put varying from 64 bytes
+ * to 64KB (or always size bytes if size is not 0), and return the number of
+ * changes of the limit */
+static int drive(parsec_remote_dep_link_t *link, double latency, double bandwidth,
+                 size_t size, int nb, unsigned int *seed)
+{
+    int changes = 0;
+    for( int i = 0; i < nb; i++ ) {
+        size_t ahead = (0 != size) ? size : ((size_t)64 << (i % 11));
+        double jitter;
+        *seed = *seed * 1103515245U + 12345U;
+        jitter = latency * (0.1 * (double)((*seed >> 8) % 1000) / 1000.0 - 0.05);  /* +/- 5% of the latency */
+        changes += parsec_remote_dep_link_update(link, ahead, latency + jitter + (double)ahead / bandwidth, MAX_LIMIT);
+    }
+    return changes;
+}
+
+static int check(const char *what, const parsec_remote_dep_link_t *link, int changes,
+                 size_t low, size_t high, int changed)
+{
+    printf("%-40s limit %5zu bytes after %2d changes (latency %.1f, %.3f bytes per unit)\n",
+           what, link->limit, changes, link->latency, link->bandwidth);
+    if( (link->limit < low) || (link->limit > high) || ((changes > 0) != changed) ) {
+        fprintf(stderr, "%s: limit %zu out of [%zu, %zu] or unexpected changes (%d)\n",
+                what, link->limit, low, high, changes);
+        return 1;
+    }
+    return 0;
+}
+
+int main(int argc, char *argv[])
+{
+    parsec_remote_dep_link_t link;
+    unsigned int seed = 42;
+    int ch, nb = 200, changes, errors = 0;
+
+    while( -1 != (ch = getopt(argc, argv, "n:")) ) {
+        switch(ch) {
+        case 'n': nb = atoi(optarg); break;
+        default:
+            fprintf(stderr, "Usage: %s [-n puts]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    /* latency 2000, 0.25 bytes per unit: 500 bytes in flight */
+    memset(&link, 0, sizeof(link)); link.limit = MAX_LIMIT;
+    changes = drive(&link, 2000.0, 0.25, 0, nb, &seed);
+    errors += check("slow link (500 bytes in flight)", &link, changes, 400, 600, 1);
+
+    /* the bandwidth grows 8 times: 4000 bytes in flight, capped */
+    changes = drive(&link, 2000.0, 2.0, 0, nb, &seed);
+    errors += check("faster link (capped at the limit)", &link, changes, MAX_LIMIT, MAX_LIMIT, 1);
+
+    /* a fast link from the start keeps the configured limit */
+    memset(&link, 0, sizeof(link)); link.limit = MAX_LIMIT;
+    changes = drive(&link, 2000.0, 2.0, 0, nb, &seed);
+    errors += check("fast link (4000 bytes in flight)", &link, changes, MAX_LIMIT, MAX_LIMIT, 0);
+
+    /* puts of a single size cannot tell the latency from the bandwidth */
+    memset(&link, 0, sizeof(link)); link.limit = MAX_LIMIT;
+    changes = drive(&link, 2000.0, 0.25, 4096, nb, &seed);
+    errors += check("puts of the same size", &link, changes, MAX_LIMIT, MAX_LIMIT, 0);
+
+    if( errors > 0 ) {
+        fprintf(stderr, "%d errors in the model of the links\n", errors);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2026      The University of Tennessee and The University
+ *                         of Tennessee Research Foundation.  All rights
+ *                         reserved.
+ */
+
+/* Check the sets of participants of the remote dependencies, and measure the
+ * cost of the bookkeeping of an activation (building the sets of two outputs,
+ * walking them as the broadcast does while marking the forwarded processes,
+ * checking the membership of each destination as the packing does, and
+ * releasing the dependencies) against the simulated number of processes.
+ * The sorted array of the few participants is compared with the bitmap of
+ * all processes (runtime_comm_rank_set_sparse 0). */
+
+#include "parsec/parsec_config.h"
+#include "parsec/parsec_internal.h"
+#include "parsec/remote_dep.h"
+#include "parsec/os-spec-timing.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define NB_OUTPUTS 2
+
+/* Distinct pseudo-random ranks other than the root (0) */
+static void draw_members(int *members, int m, int np, unsigned int seed)
+{
+    for( int j = 0; j < m; j++ ) {
+        int r, dup;
+        do {
+            seed = seed * 1103515245U + 12345U;
+            r = 1 + (int)((seed >> 8) % (unsigned int)(np - 1));
+            dup = 0;
+            for( int k = 0; k < j; k++ ) dup |= (members[k] == r);
+        } while( dup );
+        members[j] = r;
+    }
+}
+
+static int activate(const int *members, int m, int check)
+{
+    parsec_remote_deps_t *deps = remote_deps_allocate(&parsec_remote_dep_context.freelist);
+    int k, j, pos, errors = 0;
+    uint32_t cursor, last, count;
+
+    deps->root = 0;
+    for( k = 0; k < NB_OUTPUTS; k++ ) {
+        for( j = 0; j < m; j++ )
+            (void)remote_dep_rank_set_add(&deps->output[k].ranks, remote_dep_rank_to_pos(members[j], deps->root));
+        /* a second insertion is not a new member */
+        errors += remote_dep_rank_set_add(&deps->output[k].ranks, remote_dep_rank_to_pos(members[0], deps->root));
+    }
+
+    remote_dep_rank_set_clear(&deps->forwarded);
+    (void)remote_dep_rank_set_add(&deps->forwarded, remote_dep_rank_to_pos(deps->root, deps->root));
+    for( k = 0; k < NB_OUTPUTS; k++ ) {
+        last = 0; count = 0;
+        for( cursor = 0; -1 != (pos = remote_dep_rank_set_next(&deps->output[k].ranks, &cursor)); count++ ) {
+            int rank = remote_dep_pos_to_rank((uint32_t)pos, deps->root);
+            if( check && ((0 != count) && ((uint32_t)pos <= last)) ) errors++;  /* increasing order */
+            last = (uint32_t)pos;
+            if( remote_dep_rank_set_contains(&deps->forwarded, remote_dep_rank_to_pos(rank, deps->root)) )
+                continue;
+            (void)remote_dep_rank_set_add(&deps->forwarded, remote_dep_rank_to_pos(rank, deps->root));
+        }
+        if( check && ((count != (uint32_t)m) || (deps->output[k].ranks.count != (uint32_t)m)) ) errors++;
+    }
+    if( check && (deps->forwarded.count != (uint32_t)m + 1) ) errors++;
+
+    for( j = 0; j < m; j++ ) {
+        uint32_t peer = remote_dep_rank_to_pos(members[j], deps->root);
+        for( k = 0; k < NB_OUTPUTS; k++ )
+            errors += !remote_dep_rank_set_contains(&deps->output[k].ranks, peer);
+    }
+    if( check ) {
+        /* the root and the neighbours of the members are not part of it */
+        errors += remote_dep_rank_set_contains(&deps->output[0].ranks, 0);
+        for( j = 0; j < m; j++ ) {
+            uint32_t p = remote_dep_rank_to_pos(members[j], deps->root) + 1, in = 0;
+            for( k = 0; k < m; k++ ) in |= ((uint32_t)members[k] == p);
+            if( (p < parsec_remote_dep_context.max_nodes_number) &&
+                (remote_dep_rank_set_contains(&deps->output[0].ranks, p) != (int)in) ) errors++;
+        }
+    }
+    remote_deps_free(deps);
+    return errors;
+}
+
+static int run(int np, int m, int sparse, int reps, double *elapsed)
+{
+    int *members = (int*)malloc(m * sizeof(int)), errors = 0;
+    parsec_time_t start;
+
+    parsec_remote_dep_rank_set_sparse = sparse;
+    remote_deps_allocation_fini();
+    remote_deps_allocation_init(np, MAX_PARAM_COUNT);
+    draw_members(members, m, np, (unsigned int)(np + m));
+
+    /* check, and warm up the freelist */
+    errors += activate(members, m, 1);
+    errors += activate(members, m, 1);
+    start = take_time();
+    for( int r = 0; r < reps; r++ )
+        errors += activate(members, m, 0);
+    *elapsed = (double)diff_time(start, take_time()) / reps;
+    free(members);
+    return errors;
+}
+
+int main(int argc, char *argv[])
+{
+    int nps[] = { 64, 1024, 4096, 16384, 65536, 262144 };
+    int ms[] = { 1, 4, 16, 64 };
+    int reps = 10000, ch, errors = 0, ret = 0;
+    double sparse, dense;
+
+    while( -1 != (ch = getopt(argc, argv, "r:")) ) {
+        switch(ch) {
+        case 'r': reps = atoi(optarg); break;
+        default:
+            fprintf(stderr, "Usage: %s [-r repetitions]\n", argv[0]);
+            exit(1);
+        }
+    }
+
+    printf("activation of %d outputs, %s per activation\n", NB_OUTPUTS, TIMER_UNIT);
+    for( size_t i = 0; i < sizeof(nps) / sizeof(nps[0]); i++ ) {
+        for( size_t j = 0; j < sizeof(ms) / sizeof(ms[0]); j++ ) {
+            if( ms[j] >= nps[i] ) continue;
+            errors += run(nps[i], ms[j], PARSEC_REMOTE_DEP_RANK_SET_INLINE, reps, &sparse);
+            errors += run(nps[i], ms[j], 0, reps, &dense);
+            printf("%7d processes %3d members  sorted array %10.1f  bitmap %10.1f  (x%.2f)\n",
+                   nps[i], ms[j], sparse, dense, (sparse > 0.0) ? dense / sparse : 0.0);
+        }
+    }
+    remote_deps_allocation_fini();
+    parsec_remote_dep_rank_set_sparse = PARSEC_REMOTE_DEP_RANK_SET_INLINE;
+
+    if( errors > 0 ) {
+        fprintf(stderr, "%d errors in the sets of participants\n", errors);
+        ret = 1;
+    }
+    return ret;
+}
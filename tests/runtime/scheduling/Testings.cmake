@@ -1,6 +1,10 @@
 foreach(_sched ${MCA_sched})
     parsec_addtest_cmd(runtime/scheduling:${_sched} ${MPI_TEST_CMD_LIST} 1 runtime/scheduling/schedmicro -t 10 -l 8 -n 512 -- --mca mca_sched ${_sched})
+    parsec_addtest_cmd(runtime/scheduling:stats:${_sched} ${MPI_TEST_CMD_LIST} 1 runtime/scheduling/schedmicro -t 2 -l 8 -n 512 -- --mca mca_sched ${_sched} --mca runtime_sched_stats 1)
+    # Time and LLC misses (with PAPI) of chains of tasks reusing their tile
+    parsec_addtest_cmd(runtime/scheduling:locality:${_sched} ${MPI_TEST_CMD_LIST} 1 runtime/scheduling/locality -n=16 -i=4 -b=64 -t=2 -- --mca mca_sched ${_sched})
 endforeach()
+parsec_addtest_cmd(runtime/scheduling:park ${MPI_TEST_CMD_LIST} 1 runtime/scheduling/schedmicro -t 10 -l 8 -n 512 -- --mca runtime_idle_policy park --mca runtime_idle_stats 1)
 
 if( MPI_C_FOUND )
   foreach(_sched ${MCA_sched})
@@ -7,6 +7,7 @@
 #include <stdio.h>
 #include "parsec/runtime.h"
 #include "parsec/utils/debug.h"
+#include "parsec/mca/sched/sched.h"
 #include "ep_wrapper.h"
 #include "schedmicro_data.h"
 #include "parsec/os-spec-timing.h"
@@ -39,6 +40,9 @@ int main(int argc, char *argv[])
     double sum, sumsqr, val;
     int parsec_argc = 0;
     char **parsec_argv = NULL;
+    long long nb_tasks = 0;
+    parsec_sched_stats_t stats;
+    int ret = 0;
 
 #if defined(PARSEC_HAVE_MPI)
     {
@@ -120,6 +124,7 @@ int main(int argc, char *argv[])
 
                 parsec_taskpool_free(ep);
 
+                nb_tasks += 1 + (long long)nt * level;
                 val = (double)diff_time(start, end);
                 sum = sum + val;
                 sumsqr = sumsqr + val*val;
@@ -132,6 +137,31 @@ int main(int argc, char *argv[])
     printf("\n"
            "\n");
 
+    /* With --mca runtime_sched_stats 1, every task given to the scheduler
+     * must have been selected, and each task selected (the internal
+     * initialization tasks of the taskpools also go through the scheduler) */
+    if( PARSEC_SUCCESS == parsec_sched_stats_collect(parsec, &stats) ) {
+        long long nb_pops = stats.next_task_pops;
+        printf("#Scheduler statistics\n#Level\tPushes\tPops\n");
+        for( int l = 0; l < PARSEC_SCHED_STATS_NB_LEVELS; l++ ) {
+            nb_pops += stats.pops[l];
+            if( (0 != stats.pushes[l]) || (0 != stats.pops[l]) )
+                printf("%6d\t%lld\t%lld\n", l, stats.pushes[l], stats.pops[l]);
+        }
+        printf("#Next task\t%lld\n#Mean queue time\t%g\n#Mean queue depth\t%g\n\n",
+               stats.next_task_pops,
+               (nb_pops == stats.next_task_pops) ? 0.0 : (double)stats.queue_time / (double)(nb_pops - stats.next_task_pops),
+               (0 == stats.depth_samples) ? 0.0 : (double)stats.depth_sum / (double)stats.depth_samples);
+        if( 0 != stats.balance ) {
+            fprintf(stderr, "%lld tasks scheduled but never selected\n", stats.balance);
+            ret = 1;
+        }
+        if( (1 == world) && (nb_pops < nb_tasks) ) {
+            fprintf(stderr, "%lld tasks selected for %lld tasks executed\n", nb_pops, nb_tasks);
+            ret = 1;
+        }
+    }
+
     free_data(dcA);
 
     parsec_fini(&parsec);
@@ -139,5 +169,5 @@ int main(int argc, char *argv[])
     MPI_Finalize();
 #endif
 
-    return 0;
+    return ret;
 }
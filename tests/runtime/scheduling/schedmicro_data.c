@@ -73,7 +73,6 @@ static parsec_data_t* data_of(parsec_data_collection_t *desc, ...)
     return (void*)(dat->data);
 }
 
-#if defined(PARSEC_PROF_TRACE)
 static parsec_data_key_t data_key(parsec_data_collection_t *desc, ...)
 {
     int k;
@@ -88,7 +87,6 @@ static parsec_data_key_t data_key(parsec_data_collection_t *desc, ...)
 
     return (uint32_t)k;
 }
-#endif
 
 parsec_data_collection_t *create_and_distribute_data(int rank, int world, int size, int seg)
 {
@@ -100,13 +98,13 @@ parsec_data_collection_t *create_and_distribute_data(int rank, int world, int si
     d->rank_of = rank_of;
     d->data_of = data_of;
     d->vpid_of = vpid_of;
+    d->data_key = data_key;
 #if defined(PARSEC_PROF_TRACE)
     {
       int len = asprintf(&d->key_dim, "(%d)", size);
       if( -1 == len )
 	d->key_dim = NULL;
       d->key_base = strdup("A");
-      d->data_key = data_key;
     }
 #endif
     parsec_type_create_contiguous(size, parsec_datatype_uint32_t, &d->default_dtt);
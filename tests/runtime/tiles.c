@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2026      The University of Tennessee and The University
+ *                         of Tennessee Research Foundation.  All rights
+ *                         reserved.
+ */
+
+#include "parsec/parsec_config.h"
+#include "parsec/parsec_internal.h"
+#include "parsec/execution_stream.h"
+#include "tests/runtime/tiles.h"
+#include <stdarg.h>
+#include <string.h>
+#include <stdlib.h>
+
+double tiles_value(int i, int k)
+{
+    return (double)i * 1048576.0 + (double)k;
+}
+
+void tiles_fill(double *tile, int i, int nb)
+{
+    for( int k = 0; k < nb * nb; k++ )
+        tile[k] = tiles_value(i, k);
+}
+
+int tiles_check(const double *tile, int i, int nb)
+{
+    int errors = 0;
+    for( int k = 0; k < nb * nb; k++ )
+        if( tile[k] != tiles_value(i, k) ) errors++;
+    return errors;
+}
+
+void tiles_matrix_init(parsec_matrix_block_cyclic_t *dc, int rank, int nb,
+                       int mt, int nt, int P, int Q, int kp, int ip)
+{
+    parsec_matrix_block_cyclic_init( dc, PARSEC_MATRIX_DOUBLE, PARSEC_MATRIX_TILE,
+                                     rank, nb, nb, mt * nb, nt * nb, 0, 0, mt * nb, nt * nb,
+                                     P, Q, kp, 1, ip, 0);
+    dc->mat = parsec_data_allocate( (size_t)dc->super.nb_local_tiles * dc->super.bsiz * sizeof(double) );
+}
+
+void tiles_matrix_fini(parsec_matrix_block_cyclic_t *dc)
+{
+    parsec_data_free(dc->mat);
+    parsec_tiled_matrix_destroy(&dc->super);
+}
+
+double *tiles_local(parsec_matrix_block_cyclic_t *dc, int m, int n)
+{
+    parsec_data_collection_t *A = &dc->super.super;
+    if( A->rank_of(A, m, n) != A->myrank ) return NULL;
+    return (double*)parsec_data_copy_get_ptr(parsec_data_get_copy(A->data_of(A, m, n), 0));
+}
+
+void tiles_args(int argc, char **argv, int *pargc, char ***pargv, const char *options, ...)
+{
+    *pargc = 0; *pargv = NULL;
+    for( int i = 1; i < argc; i++ ) {
+        if( 0 == strncmp(argv[i], "--", 3) ) {
+            *pargc = argc - i;
+            *pargv = argv + i;
+            break;
+        }
+        if( ('-' != argv[i][0]) || ('\0' == argv[i][1]) || ('=' != argv[i][2]) ) continue;
+        va_list ap;
+        va_start(ap, options);
+        for( const char *c = options; '\0' != *c; c++ ) {
+            int *value = va_arg(ap, int*);
+            if( *c == argv[i][1] ) {
+                *value = strtol(argv[i]+3, NULL, 10);
+                break;
+            }
+        }
+        va_end(ap);
+    }
+}
+
+parsec_context_t *tiles_init(int *pargc, char ***pargv, int *rank, int *size)
+{
+    parsec_context_t *parsec;
+#ifdef DISTRIBUTED
+    {
+        int provided;
+        MPI_Init_thread(NULL, NULL, MPI_THREAD_SERIALIZED, &provided);
+    }
+#endif  /* DISTRIBUTED */
+    parsec = parsec_init(-1, pargc, pargv);
+    if( NULL == parsec ) {
+        exit(-1);
+    }
+    /* as found by the communication engine */
+    *rank = parsec->my_rank;
+    *size = parsec->nb_nodes;
+    return parsec;
+}
+
+void tiles_run(parsec_context_t *parsec, parsec_taskpool_t *tp)
+{
+    int rc;
+    rc = parsec_context_add_taskpool(parsec, tp);
+    PARSEC_CHECK_ERROR(rc, "parsec_context_add_taskpool");
+    rc = parsec_context_start(parsec);
+    PARSEC_CHECK_ERROR(rc, "parsec_context_start");
+    rc = parsec_context_wait(parsec);
+    PARSEC_CHECK_ERROR(rc, "parsec_context_wait");
+}
+
+void tiles_fini(parsec_context_t **parsec)
+{
+    parsec_fini(parsec);
+#ifdef DISTRIBUTED
+    MPI_Finalize();
+#endif  /* DISTRIBUTED */
+}
@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2026      The University of Tennessee and The University
+ *                         of Tennessee Research Foundation.  All rights
+ *                         reserved.
+ */
+#if !defined(_TESTS_RUNTIME_TILES_H_)
+#define _TESTS_RUNTIME_TILES_H_
+
+/* Common part of the tests of the communications moving tiles of doubles
+ * between the processes (inplace, put_sched, tcp_engine, host_placement) */
+
+#include "parsec/runtime.h"
+#include "parsec/data_dist/matrix/two_dim_rectangle_cyclic.h"
+
+/* Value of the element k of the tile i: the elements of the tiles of up to
+ * 1M elements are all different */
+double tiles_value(int i, int k);
+/* Fill the nb x nb tile with the values of the tile i */
+void tiles_fill(double *tile, int i, int nb);
+/* Number of elements of the nb x nb tile differing from the tile i */
+int tiles_check(const double *tile, int i, int nb);
+
+/* Matrix of mt x nt tiles of nb x nb doubles on a P x Q grid of processes,
+ * with kp consecutive rows of tiles on each process and the first row on
+ * the process ip, its local tiles allocated */
+void tiles_matrix_init(parsec_matrix_block_cyclic_t *dc, int rank, int nb,
+                       int mt, int nt, int P, int Q, int kp, int ip);
+void tiles_matrix_fini(parsec_matrix_block_cyclic_t *dc);
+/* The tile (m, n) if this process holds it, NULL otherwise */
+double *tiles_local(parsec_matrix_block_cyclic_t *dc, int m, int n);
+
+/* Parse the options of the test, -<c>=<value> for each letter c of options
+ * setting the int pointed by the next argument, and return in pargc and
+ * pargv the arguments following "--", for PaRSEC */
+void tiles_args(int argc, char **argv, int *pargc, char ***pargv, const char *options, ...);
+/* Initialize MPI (when PaRSEC uses it) and PaRSEC, exit on failure */
+parsec_context_t *tiles_init(int *pargc, char ***pargv, int *rank, int *size);
+/* Run the taskpool to completion */
+void tiles_run(parsec_context_t *parsec, parsec_taskpool_t *tp);
+void tiles_fini(parsec_context_t **parsec);
+
+#endif  /* !defined(_TESTS_RUNTIME_TILES_H_) */